@@ -286,7 +286,10 @@ zip_clean:
 #
 ##############################
 
-ifeq ($(shell [ -d "$(ARM_SDK_DIR)" ] && echo "exists"), exists)
+ifeq ($(TARGET),SITL)
+  # software in the loop target is built with the host compiler
+  ARM_SDK_PREFIX :=
+else ifeq ($(shell [ -d "$(ARM_SDK_DIR)" ] && echo "exists"), exists)
   ARM_SDK_PREFIX := $(ARM_SDK_DIR)/bin/arm-none-eabi-
 else ifeq (,$(findstring _install,$(MAKECMDGOALS)))
   GCC_VERSION = $(shell arm-none-eabi-gcc -dumpversion)
@@ -0,0 +1,5516 @@
+	.file	"build_config.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	build_config.c.135caed3
+	.weak	build_config.c.135caed3
+build_config.c.135caed3:
+	.long	0x5e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2
+	.long	.LASF956
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF948
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF949
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF950
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF951
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF952
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF953
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF954
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 1 "./src/main/build/build_config.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 2 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x4
+	.file 5 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 7 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 8 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x8
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 11 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 13 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 21 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.file 22 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 23 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x17
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 25 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x19
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x4
+	.file 26 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF807
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF768
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF908
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xa
+	.long	.LASF1
+	.long	.LASF957
+	.long	.LASF958
+	.long	.LASF959
+	.long	.LASF960
+	.long	.LASF961
+	.long	.LASF962
+	.long	.LASF963
+	.long	.LASF964
+	.long	.LASF965
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x1b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF966
+	.byte	0x1
+	.long	.LASF967
+	.byte	0x8
+	.long	.LASF968
+	.byte	0x9
+	.long	.LASF969
+	.byte	0x9
+	.long	.LASF969
+	.byte	0x8
+	.long	.LASF970
+	.byte	0x5
+	.long	.LASF971
+	.byte	0x8
+	.long	.LASF972
+	.byte	0x8
+	.long	.LASF973
+	.byte	0x5
+	.long	.LASF974
+	.byte	0x5
+	.long	.LASF975
+	.byte	0x7
+	.long	.LASF976
+	.byte	0x5
+	.long	.LASF977
+	.byte	0x6
+	.long	.LASF978
+	.byte	0x6
+	.long	.LASF979
+	.byte	0x5
+	.long	.LASF980
+	.byte	0x5
+	.long	.LASF981
+	.byte	0x5
+	.long	.LASF982
+	.byte	0x5
+	.long	.LASF983
+	.byte	0x5
+	.long	.LASF984
+	.byte	0x5
+	.long	.LASF985
+	.byte	0x4
+	.long	.LASF986
+	.byte	0x3
+	.long	.LASF987
+	.byte	0x2
+	.long	.LASF988
+	.byte	0x9
+	.long	.LASF989
+	.byte	0x3
+	.long	.LASF990
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF783:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF860:
+	.string	"NULL ((void *)0)"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF763:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF522:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF867:
+	.string	"U_ID_0 0"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF879:
+	.string	"USE_UART1 "
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF862:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF885:
+	.string	"USE_UART7 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF932:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF925:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF509:
+	.string	"__P(args) args"
+.LASF939:
+	.string	"__enable_irq() "
+.LASF823:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF779:
+	.string	"USE_SERIALRX_SUMD "
+.LASF858:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF807:
+	.string	"VTX_TRAMP "
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF816:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF837:
+	.string	"_GCC_SIZE_T "
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF796:
+	.string	"TELEMETRY_MAVLINK "
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF827:
+	.string	"_T_SIZE "
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF923:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF868:
+	.string	"U_ID_1 1"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF806:
+	.string	"VTX_SMARTAUDIO "
+.LASF895:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF808:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF801:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF546:
+	.string	"__always_inline"
+.LASF825:
+	.string	"_SYS_SIZE_T_H "
+.LASF776:
+	.string	"USE_SERIALRX_IBUS "
+.LASF790:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF934:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF954:
+	.string	"long int"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF907:
+	.string	"TELEMETRY_MAVLINK"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF815:
+	.string	"_PTRDIFF_T_ "
+.LASF822:
+	.string	"__size_t__ "
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF911:
+	.string	"VTX_COMMON"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF909:
+	.string	"USE_DASHBOARD"
+.LASF898:
+	.string	"USE_SERIALRX_XBUS"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF787:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF937:
+	.string	"EEPROM_SIZE 32768"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF784:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF944:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF940:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF952:
+	.string	"signed char"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF886:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF799:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF905:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF948:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF835:
+	.string	"__DEFINED_size_t "
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF786:
+	.string	"TELEMETRY_HOTT "
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF881:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF831:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF859:
+	.string	"NULL"
+.LASF778:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF899:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF919:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF924:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF805:
+	.string	"VTX_CONTROL "
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF929:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF872:
+	.string	"USE_FAKE_GYRO "
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF834:
+	.string	"_SIZE_T_DECLARED "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF775:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF863:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF853:
+	.string	"__INT_WCHAR_T_H "
+.LASF894:
+	.string	"USE_SERIALRX_SBUS"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF840:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF777:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF882:
+	.string	"USE_UART4 "
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF928:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF400:
+	.string	"bool _Bool"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF848:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF766:
+	.string	"I2C1_OVERCLOCK true"
+.LASF866:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF896:
+	.string	"USE_SERIALRX_SUMD"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF869:
+	.string	"U_ID_2 2"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF900:
+	.string	"LED_STRIP"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF803:
+	.string	"USE_SENSOR_NAMES "
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF910:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF935:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF826:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF933:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF770:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF870:
+	.string	"LED0_PIN NONE"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF887:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF817:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF812:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF903:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF769:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF768:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF844:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF829:
+	.string	"_SIZE_T_ "
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF891:
+	.string	"SERIAL_RX"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF841:
+	.string	"__wchar_t__ "
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF915:
+	.string	"BLACKBOX"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF846:
+	.string	"__WCHAR_T "
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF781:
+	.string	"USE_SERIALRX_XBUS "
+.LASF828:
+	.string	"__SIZE_T "
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF499:
+	.string	"__PMT"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF810:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF789:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF950:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF945:
+	.string	"UNIT_TESTED "
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF855:
+	.string	"_WCHAR_T_DECLARED "
+.LASF788:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF813:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF811:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF797:
+	.string	"TELEMETRY_SRXL "
+.LASF545:
+	.string	"__wur "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF901:
+	.string	"TELEMETRY_FRSKY"
+.LASF402:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF401:
+	.string	"true 1"
+.LASF819:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF873:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF888:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF836:
+	.string	"___int_size_t_h "
+.LASF843:
+	.string	"_WCHAR_T "
+.LASF877:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF876:
+	.string	"USE_FAKE_BARO "
+.LASF833:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF818:
+	.string	"_GCC_PTRDIFF_T "
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF955:
+	.string	"char"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF824:
+	.string	"_SIZE_T "
+.LASF851:
+	.string	"_WCHAR_T_H "
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF914:
+	.string	"VTX_TRAMP"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF355:
+	.string	"__amd64 1"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF949:
+	.string	"short unsigned int"
+.LASF917:
+	.string	"USE_SERVOS"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF782:
+	.string	"BLACKBOX "
+.LASF800:
+	.string	"USE_MSP_PUSH "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF871:
+	.string	"GYRO "
+.LASF918:
+	.string	"USE_DSHOT"
+.LASF938:
+	.string	"__disable_irq() "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF893:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF854:
+	.string	"_GCC_WCHAR_T "
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF936:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF794:
+	.string	"TELEMETRY_IBUS "
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF875:
+	.string	"BARO "
+.LASF393:
+	.string	"SITL 1"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF832:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF814:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF943:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF951:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF912:
+	.string	"VTX_CONTROL"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF883:
+	.string	"USE_UART5 "
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF892:
+	.string	"USE_SERIALRX_CRSF"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF839:
+	.string	"__size_t "
+.LASF850:
+	.string	"_WCHAR_T_DEFINED "
+.LASF792:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF586:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF798:
+	.string	"USE_DASHBOARD "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF830:
+	.string	"_BSD_SIZE_T_ "
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF861:
+	.string	"__need_NULL"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF845:
+	.string	"_T_WCHAR "
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF772:
+	.string	"USE_PPM "
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF847:
+	.string	"_WCHAR_T_ "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF849:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF765:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF773:
+	.string	"USE_PWM "
+.LASF838:
+	.string	"_SIZET_ "
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF884:
+	.string	"USE_UART6 "
+.LASF774:
+	.string	"SERIAL_RX "
+.LASF791:
+	.string	"GPS "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF767:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF889:
+	.string	"USE_PPM"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF804:
+	.string	"VTX_COMMON "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF927:
+	.string	"USED_TIMERS 0"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF953:
+	.string	"short int"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF946:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF821:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF947:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF842:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF956:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF856:
+	.string	"__DEFINED_wchar_t "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF941:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF771:
+	.string	"USE_CLI "
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF793:
+	.string	"TELEMETRY_CRSF "
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF852:
+	.string	"___int_wchar_t_h "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF920:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF880:
+	.string	"USE_UART2 "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF857:
+	.string	"_BSD_WCHAR_T_"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF930:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF764:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF913:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF922:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF802:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF795:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF780:
+	.string	"USE_SERIALRX_SUMH "
+.LASF820:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF902:
+	.string	"TELEMETRY_HOTT"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF809:
+	.string	"_STDDEF_H_ "
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF890:
+	.string	"USE_PWM"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF931:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF942:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF785:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF926:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF864:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF908:
+	.string	"TELEMETRY_IBUS"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF921:
+	.string	"USE_PROFILE "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF976:
+	.string	"long-double.h"
+.LASF978:
+	.string	"stubs-64.h"
+.LASF964:
+	.string	"/usr/include"
+.LASF983:
+	.string	"stdint-intn.h"
+.LASF970:
+	.string	"libc-header-start.h"
+.LASF959:
+	.string	"src/main/target"
+.LASF982:
+	.string	"wchar.h"
+.LASF974:
+	.string	"timesize.h"
+.LASF984:
+	.string	"stdint-uintn.h"
+.LASF963:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF990:
+	.string	"build_config.h"
+.LASF965:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF958:
+	.string	"src/main/target/SITL"
+.LASF971:
+	.string	"features.h"
+.LASF981:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF986:
+	.string	"common.h"
+.LASF966:
+	.string	"build_config.c"
+.LASF961:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF980:
+	.string	"typesizes.h"
+.LASF0:
+	.string	"./src/main/build/build_config.c"
+.LASF977:
+	.string	"stubs.h"
+.LASF962:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF988:
+	.string	"stddef.h"
+.LASF972:
+	.string	"features-time64.h"
+.LASF989:
+	.string	"common_post.h"
+.LASF987:
+	.string	"target.h"
+.LASF975:
+	.string	"cdefs.h"
+.LASF985:
+	.string	"platform.h"
+.LASF957:
+	.string	"src/main/build"
+.LASF960:
+	.string	"src/main"
+.LASF968:
+	.string	"stdbool.h"
+.LASF973:
+	.string	"wordsize.h"
+.LASF967:
+	.string	"stdc-predef.h"
+.LASF969:
+	.string	"stdint.h"
+.LASF979:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.c1d3b9cca62448f8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c1d3b9cca62448f8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c1d3b9cca62448f8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.c1d3b9cca62448f8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c1d3b9cca62448f8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.c1d3b9cca62448f8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.c1d3b9cca62448f8,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.c1d3b9cca62448f8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c1d3b9cca62448f8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.c1d3b9cca62448f8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c1d3b9cca62448f8,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symtab.c1d3b9cca62448f8,"e",@progbits
+	.text
+	.section	.gnu.lto_.ext_symtab.c1d3b9cca62448f8,"e",@progbits
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,7292 @@
+	.file	"profile.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 6 "./src/main/build/profile.h"
+	.file 7 "./src/main/scheduler/scheduler.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "/usr/include/time.h"
+	.file 10 "./src/main/build/profile.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	profile.c.6bcba402
+	.weak	profile.c.6bcba402
+profile.c.6bcba402:
+	.long	0x2dc
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xd
+	.long	.LASF1091
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1032
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1033
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1034
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1035
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1036
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1037
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1039
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1038
+	.uleb128 0x2
+	.long	.LASF1040
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x2
+	.long	.LASF1041
+	.byte	0x1
+	.byte	0xa0
+	.byte	0x12
+	.long	0x5f
+	.uleb128 0x2
+	.long	.LASF1042
+	.byte	0x1
+	.byte	0xa9
+	.byte	0xd
+	.long	0x4c
+	.uleb128 0xf
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1043
+	.byte	0x1
+	.byte	0xc5
+	.byte	0x12
+	.long	0x5f
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1044
+	.uleb128 0x6
+	.long	0x98
+	.uleb128 0x2
+	.long	.LASF1045
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x53
+	.uleb128 0x2
+	.long	.LASF1046
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x14
+	.long	0x66
+	.uleb128 0x2
+	.long	.LASF1047
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x7
+	.long	0x9f
+	.uleb128 0x6
+	.long	0xc8
+	.uleb128 0x8
+	.long	.LASF1080
+	.byte	0x4
+	.byte	0xb
+	.byte	0x8
+	.long	0xf9
+	.uleb128 0x4
+	.long	.LASF1048
+	.byte	0x4
+	.byte	0x10
+	.byte	0xc
+	.long	0x72
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1049
+	.byte	0x4
+	.byte	0x15
+	.byte	0x15
+	.long	0x8c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1050
+	.byte	0x5
+	.byte	0x7
+	.byte	0x15
+	.long	0x7e
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1051
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x7
+	.byte	0x3c
+	.long	0x184
+	.uleb128 0x1
+	.long	.LASF1052
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1053
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1054
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1055
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1056
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1059
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1060
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1061
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1062
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1063
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1064
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1065
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1066
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1067
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1068
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1069
+	.byte	0x10
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1070
+	.byte	0x6
+	.byte	0x23
+	.byte	0x12
+	.long	0xa4
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x6
+	.byte	0x25
+	.long	0x1cc
+	.uleb128 0x1
+	.long	.LASF1071
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1072
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1073
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1074
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1075
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1078
+	.byte	0x15
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1079
+	.byte	0x6
+	.byte	0x2e
+	.byte	0x3
+	.long	0x190
+	.uleb128 0x8
+	.long	.LASF1081
+	.byte	0x6
+	.byte	0x32
+	.byte	0x10
+	.long	0x20c
+	.uleb128 0x4
+	.long	.LASF1082
+	.byte	0x6
+	.byte	0x33
+	.byte	0xe
+	.long	0xa4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1083
+	.byte	0x6
+	.byte	0x34
+	.byte	0x14
+	.long	0x184
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1084
+	.byte	0x6
+	.byte	0x35
+	.byte	0xe
+	.long	0xb0
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1085
+	.byte	0x6
+	.byte	0x36
+	.byte	0x3
+	.long	0x1d8
+	.uleb128 0xa
+	.long	0x20c
+	.long	0x228
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x14
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1092
+	.byte	0x6
+	.byte	0x4b
+	.byte	0x17
+	.long	0x218
+	.uleb128 0x11
+	.long	0x228
+	.byte	0xa
+	.byte	0x1f
+	.byte	0x10
+	.uleb128 0xa
+	.long	0xcd
+	.long	0x24c
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	0x23c
+	.uleb128 0x12
+	.long	.LASF1090
+	.byte	0xa
+	.byte	0x21
+	.byte	0x1b
+	.long	0x24c
+	.uleb128 0x13
+	.long	.LASF1086
+	.byte	0x8
+	.byte	0x3d
+	.byte	0xe
+	.long	0x8a
+	.long	0x27d
+	.uleb128 0x5
+	.long	0x8a
+	.uleb128 0x5
+	.long	0x4c
+	.uleb128 0x5
+	.long	0xbc
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1087
+	.byte	0x9
+	.value	0x120
+	.byte	0xc
+	.long	0x4c
+	.long	0x299
+	.uleb128 0x5
+	.long	0xf9
+	.uleb128 0x5
+	.long	0x299
+	.byte	0
+	.uleb128 0x7
+	.long	0xd2
+	.uleb128 0x15
+	.long	.LASF1093
+	.byte	0xa
+	.byte	0x4a
+	.byte	0xd
+	.long	0xc8
+	.long	0x2bb
+	.uleb128 0x16
+	.long	.LASF1094
+	.byte	0xa
+	.byte	0x4a
+	.byte	0x2d
+	.long	0x1cc
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1088
+	.byte	0x42
+	.uleb128 0xc
+	.long	.LASF1089
+	.byte	0x34
+	.uleb128 0x17
+	.long	.LASF1095
+	.byte	0xa
+	.byte	0x2c
+	.byte	0x10
+	.long	0x184
+	.uleb128 0x18
+	.string	"ts"
+	.byte	0xa
+	.byte	0x2e
+	.byte	0x15
+	.long	0xd2
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.file 14 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 30 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 33 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 34 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x22
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/timex.h"
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF964
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF965
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1007
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1008
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1009
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1010
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1019
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1020
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1021
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x7
+	.file 45 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1025
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.timex.h.88.8db50feb82d841a67daef3e223fd9324,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1006
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1014
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1016
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1018
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.55.c652f4b9bdb1320101bf05dca1d9b661,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1024
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.50.10d0067a73777b2d14d79db5df156f88,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1029
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.profile.h.48.b5d3bdbbb4f3d375ccee68ec649323aa,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1031
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF1096
+	.long	.LASF1097
+	.long	.LASF1098
+	.long	.LASF1099
+	.long	.LASF1100
+	.long	.LASF1101
+	.long	.LASF1102
+	.long	.LASF1103
+	.long	.LASF1104
+	.long	.LASF1105
+	.long	.LASF1106
+	.long	.LASF1107
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2e
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1108
+	.byte	0x8
+	.long	.LASF1109
+	.byte	0x8
+	.long	.LASF1110
+	.byte	0xc
+	.long	.LASF1111
+	.byte	0x7
+	.long	.LASF1112
+	.byte	0x7
+	.long	.LASF1113
+	.byte	0x1
+	.long	.LASF1114
+	.byte	0x3
+	.long	.LASF1115
+	.byte	0xb
+	.long	.LASF1116
+	.byte	0xb
+	.long	.LASF1117
+	.byte	0x1
+	.long	.LASF1118
+	.byte	0xb
+	.long	.LASF1119
+	.byte	0xc
+	.long	.LASF1120
+	.byte	0xc
+	.long	.LASF1120
+	.byte	0xb
+	.long	.LASF1121
+	.byte	0x8
+	.long	.LASF1122
+	.byte	0xb
+	.long	.LASF1123
+	.byte	0xb
+	.long	.LASF1124
+	.byte	0x8
+	.long	.LASF1125
+	.byte	0x8
+	.long	.LASF1126
+	.byte	0xa
+	.long	.LASF1127
+	.byte	0x8
+	.long	.LASF1128
+	.byte	0x9
+	.long	.LASF1129
+	.byte	0x9
+	.long	.LASF1130
+	.byte	0x8
+	.long	.LASF1131
+	.byte	0x8
+	.long	.LASF1132
+	.byte	0x8
+	.long	.LASF1133
+	.byte	0x8
+	.long	.LASF1134
+	.byte	0x7
+	.long	.LASF1135
+	.byte	0x7
+	.long	.LASF1136
+	.byte	0xb
+	.long	.LASF1137
+	.byte	0x6
+	.long	.LASF1138
+	.byte	0x5
+	.long	.LASF1139
+	.byte	0x4
+	.long	.LASF1140
+	.byte	0x5
+	.long	.LASF1116
+	.byte	0x8
+	.long	.LASF1141
+	.byte	0x8
+	.long	.LASF1142
+	.byte	0x7
+	.long	.LASF1143
+	.byte	0x7
+	.long	.LASF1144
+	.byte	0x7
+	.long	.LASF1145
+	.byte	0x7
+	.long	.LASF1146
+	.byte	0x8
+	.long	.LASF1147
+	.byte	0x8
+	.long	.LASF1148
+	.byte	0x7
+	.long	.LASF1149
+	.byte	0x7
+	.long	.LASF1116
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF813:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1047:
+	.string	"size_t"
+.LASF1029:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1064:
+	.string	"TASK_ALTITUDE"
+.LASF1063:
+	.string	"TASK_BARO"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF1079:
+	.string	"profileProbe_e"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1019:
+	.string	"__clockid_t_defined 1"
+.LASF522:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF999:
+	.string	"STA_PPSJITTER 0x0200"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1089:
+	.string	"profileInit"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1001:
+	.string	"STA_PPSERROR 0x0800"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1012:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1075:
+	.string	"PROFILE_CHECK_FUNC"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF953:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF509:
+	.string	"__P(args) args"
+.LASF986:
+	.string	"MOD_CLKA ADJ_OFFSET_SINGLESHOT"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1021:
+	.string	"__itimerspec_defined 1"
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF994:
+	.string	"STA_INS 0x0010"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF995:
+	.string	"STA_DEL 0x0020"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF1008:
+	.string	"__time_t_defined 1"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF978:
+	.string	"ADJ_OFFSET_SS_READ 0xa001"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF546:
+	.string	"__always_inline"
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1038:
+	.string	"long int"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF956:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF766:
+	.string	"__size_t__ "
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF996:
+	.string	"STA_UNSYNC 0x0040"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1014:
+	.string	"__PDP_ENDIAN 3412"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1071:
+	.string	"PROFILE_GYRO_UPDATE"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF981:
+	.string	"MOD_MAXERROR ADJ_MAXERROR"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1061:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF991:
+	.string	"STA_PPSFREQ 0x0002"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1036:
+	.string	"signed char"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1069:
+	.string	"TASK_SELF"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF982:
+	.string	"MOD_ESTERROR ADJ_ESTERROR"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1032:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1066:
+	.string	"TASK_MSP_PUSH"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1024:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1022:
+	.string	"__pid_t_defined "
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1043:
+	.string	"__syscall_slong_t"
+.LASF1051:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF785:
+	.string	"NULL"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF974:
+	.string	"ADJ_MICRO 0x1000"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF764:
+	.string	"__need_size_t "
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF965:
+	.string	"__timeval_defined 1"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1077:
+	.string	"PROFILE_TASK_FIRST"
+.LASF957:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1007:
+	.string	"__clock_t_defined 1"
+.LASF1092:
+	.string	"profileProbes"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF784:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1010:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF949:
+	.string	"_TIME_H 1"
+.LASF400:
+	.string	"bool _Bool"
+.LASF962:
+	.string	"CLOCK_TAI 11"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF959:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF1023:
+	.string	"TIME_UTC 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF983:
+	.string	"MOD_STATUS ADJ_STATUS"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1000:
+	.string	"STA_PPSWANDER 0x0400"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF950:
+	.string	"_BITS_TIME_H 1"
+.LASF1062:
+	.string	"TASK_COMPASS"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF993:
+	.string	"STA_FLL 0x0008"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF975:
+	.string	"ADJ_NANO 0x2000"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1083:
+	.string	"maxTicks"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1040:
+	.string	"__uint64_t"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1055:
+	.string	"TASK_ATTITUDE"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF961:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1009:
+	.string	"__struct_tm_defined 1"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1094:
+	.string	"probe"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF765:
+	.string	"__need_NULL "
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1011:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF955:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF883:
+	.string	"BARO "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF972:
+	.string	"ADJ_TAI 0x0080"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1090:
+	.string	"profileProbeNames"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF963:
+	.string	"TIMER_ABSTIME 1"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1039:
+	.string	"__uint32_t"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF976:
+	.string	"ADJ_TICK 0x4000"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF979:
+	.string	"MOD_OFFSET ADJ_OFFSET"
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF772:
+	.string	"__SIZE_T "
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1052:
+	.string	"TASK_SYSTEM"
+.LASF1059:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF499:
+	.string	"__PMT"
+.LASF1006:
+	.string	"STA_RONLY (STA_PPSSIGNAL | STA_PPSJITTER | STA_PPSWANDER | STA_PPSERROR | STA_CLOCKERR | STA_NANO | STA_MODE | STA_CLK)"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1028:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF989:
+	.string	"MOD_NANO ADJ_NANO"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF951:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1082:
+	.string	"count"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1078:
+	.string	"PROFILE_PROBE_COUNT"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1034:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1095:
+	.string	"profileTicks"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF990:
+	.string	"STA_PLL 0x0001"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF992:
+	.string	"STA_PPSTIME 0x0004"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF545:
+	.string	"__wur "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF402:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF401:
+	.string	"true 1"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF881:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF964:
+	.string	"_BITS_TIMEX_H 1"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1053:
+	.string	"TASK_GYROPID"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF985:
+	.string	"MOD_CLKB ADJ_TICK"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF885:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1044:
+	.string	"char"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF1057:
+	.string	"TASK_SERIAL"
+.LASF984:
+	.string	"MOD_TIMECONST ADJ_TIMECONST"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1033:
+	.string	"short unsigned int"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF879:
+	.string	"GYRO "
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF960:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF1091:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1093:
+	.string	"profileProbeName"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1080:
+	.string	"timespec"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF997:
+	.string	"STA_FREQHOLD 0x0080"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF966:
+	.string	"ADJ_OFFSET 0x0001"
+.LASF1004:
+	.string	"STA_MODE 0x4000"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1042:
+	.string	"__clockid_t"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF393:
+	.string	"SITL 1"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1060:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1070:
+	.string	"profileTicks_t"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF1076:
+	.string	"PROFILE_SCHEDULER"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1035:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1020:
+	.string	"__timer_t_defined 1"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF1030:
+	.string	"PROFILE_TASK(taskId) ((profileProbe_e)(PROFILE_TASK_FIRST + (taskId)))"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1003:
+	.string	"STA_NANO 0x2000"
+.LASF1005:
+	.string	"STA_CLK 0x8000"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF783:
+	.string	"__size_t "
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF822:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF586:
+	.string	"__stub_stty "
+.LASF970:
+	.string	"ADJ_STATUS 0x0010"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1041:
+	.string	"__time_t"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF1067:
+	.string	"TASK_COUNT"
+.LASF1002:
+	.string	"STA_CLOCKERR 0x1000"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1050:
+	.string	"clockid_t"
+.LASF1086:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF802:
+	.string	"USE_PPM "
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF968:
+	.string	"ADJ_MAXERROR 0x0004"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1065:
+	.string	"TASK_TELEMETRY"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1068:
+	.string	"TASK_NONE"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF998:
+	.string	"STA_PPSSIGNAL 0x0100"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1074:
+	.string	"PROFILE_HANDLE_BLACKBOX"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1054:
+	.string	"TASK_ACCEL"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF803:
+	.string	"USE_PWM "
+.LASF1081:
+	.string	"profileProbe_s"
+.LASF1085:
+	.string	"profileProbe_t"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF821:
+	.string	"GPS "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF987:
+	.string	"MOD_TAI ADJ_TAI"
+.LASF1027:
+	.string	"SCHEDULER_TRACE_SIZE 64"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF897:
+	.string	"USE_PPM"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1031:
+	.string	"PROFILE_TICKS_PER_US 1000"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF967:
+	.string	"ADJ_FREQUENCY 0x0002"
+.LASF1026:
+	.string	"SCHEDULER_HISTOGRAM_BUCKETS 16"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF787:
+	.string	"__need_NULL"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1037:
+	.string	"short int"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1013:
+	.string	"__BIG_ENDIAN 4321"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1015:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1046:
+	.string	"uint64_t"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF980:
+	.string	"MOD_FREQUENCY ADJ_FREQUENCY"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF988:
+	.string	"MOD_MICRO ADJ_MICRO"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1049:
+	.string	"tv_nsec"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF1084:
+	.string	"totalTicks"
+.LASF952:
+	.string	"CLOCK_REALTIME 0"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF971:
+	.string	"ADJ_TIMECONST 0x0020"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1073:
+	.string	"PROFILE_MIX_TABLE"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF958:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF801:
+	.string	"USE_CLI "
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF969:
+	.string	"ADJ_ESTERROR 0x0008"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1088:
+	.string	"profileReset"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF888:
+	.string	"USE_UART2 "
+.LASF1072:
+	.string	"PROFILE_PID_CONTROLLER"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1016:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1045:
+	.string	"uint32_t"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1018:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF355:
+	.string	"__amd64 1"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1058:
+	.string	"TASK_DISPATCH"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF977:
+	.string	"ADJ_OFFSET_SINGLESHOT 0x8001"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1087:
+	.string	"clock_gettime"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF973:
+	.string	"ADJ_SETOFFSET 0x0100"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF954:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF898:
+	.string	"USE_PWM"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1056:
+	.string	"TASK_RX"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1017:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1025:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1048:
+	.string	"tv_sec"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF929:
+	.string	"USE_PROFILE "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1140:
+	.string	"common_post.h"
+.LASF1127:
+	.string	"long-double.h"
+.LASF1135:
+	.string	"__locale_t.h"
+.LASF1137:
+	.string	"platform.h"
+.LASF1139:
+	.string	"target.h"
+.LASF1121:
+	.string	"libc-header-start.h"
+.LASF1105:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1146:
+	.string	"endian.h"
+.LASF1097:
+	.string	"src/main/common"
+.LASF1133:
+	.string	"stdint-intn.h"
+.LASF1104:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1107:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1128:
+	.string	"stubs.h"
+.LASF1099:
+	.string	"src/main/target/SITL"
+.LASF1117:
+	.string	"profile.c"
+.LASF1143:
+	.string	"clock_t.h"
+.LASF1125:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1126:
+	.string	"cdefs.h"
+.LASF1103:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1149:
+	.string	"struct_itimerspec.h"
+.LASF1136:
+	.string	"strings.h"
+.LASF1123:
+	.string	"features-time64.h"
+.LASF1108:
+	.string	"types.h"
+.LASF1145:
+	.string	"struct_tm.h"
+.LASF1119:
+	.string	"stdbool.h"
+.LASF1106:
+	.string	"/usr/include"
+.LASF1111:
+	.string	"struct_timespec.h"
+.LASF1144:
+	.string	"time_t.h"
+.LASF1096:
+	.string	"src/main/build"
+.LASF1122:
+	.string	"features.h"
+.LASF1138:
+	.string	"common.h"
+.LASF1130:
+	.string	"typesizes.h"
+.LASF1134:
+	.string	"locale_t.h"
+.LASF1142:
+	.string	"struct_timeval.h"
+.LASF1112:
+	.string	"clockid_t.h"
+.LASF1114:
+	.string	"scheduler.h"
+.LASF1131:
+	.string	"time64.h"
+.LASF1109:
+	.string	"stdint-uintn.h"
+.LASF1100:
+	.string	"src/main/target"
+.LASF1148:
+	.string	"timer_t.h"
+.LASF1113:
+	.string	"profile.h"
+.LASF1101:
+	.string	"src/main"
+.LASF1116:
+	.string	"time.h"
+.LASF1141:
+	.string	"timex.h"
+.LASF1132:
+	.string	"wchar.h"
+.LASF1115:
+	.string	"string.h"
+.LASF1102:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1120:
+	.string	"stdint.h"
+.LASF1110:
+	.string	"stddef.h"
+.LASF1129:
+	.string	"stubs-64.h"
+.LASF0:
+	.string	"./src/main/build/profile.c"
+.LASF1124:
+	.string	"wordsize.h"
+.LASF1098:
+	.string	"src/main/scheduler"
+.LASF1147:
+	.string	"endianness.h"
+.LASF1118:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375 F\345\001"
+	.string	"\024\003:"
+	.string	"\006"
+	.string	"\364\316\353\256\004\006\002"
+	.string	"\002\001\001\002\001\001\375\224\300\215\013"
+	.string	"\002\240\342\234\212\n\003\004\357\202\374\263\004\002\002\002\002\003\005\366\226\215\270\r"
+	.string	"\003"
+	.ascii	"a\316\332\335\264\001,"
+	.text
+	.section	.gnu.lto_.ipa_sra.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375 $\365"
+	.string	""
+	.string	"\260\030"
+	.string	"\004"
+	.string	""
+	.string	"\003"
+	.string	"\001\001"
+	.string	"\001"
+	.string	"\001\003\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\002"
+	.string	"(!m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375 \362\305\003"
+	.string	"\242\206\025 \240'\351\3769V\367/p\202\021\253\356\222\005\205\r\373?"
+	.string	""
+	.string	""
+	.string	"\007\245m\221\264\326$\221;\005\3773q\016\266xH\034;M\345\347\224B,\334\341]\316\032\317\344a&\372"
+	.string	"\023m\025U@\220\266\314U\017@\377{\204\345\235\265m\332\227a\214\266\215`\036\t\f"
+	.ascii	"\256\375-\033\030\035\0045\201\275L\025\016\314Ze\341\250P\323"
+	.ascii	"<\337\322\022,bl\240\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375 \260\265\002"
+	.string	"\262D\016\027\260%\351\224-X\261<\312a%\200b%I*\016\f\267\313&2\245\322\312x\232\360pgg\0135}x\017^\360\266\250\215\322\313\244\236\324\02602\223Y\342\221J\006\002\n"
+	.ascii	"[q\243W\205u.\\S 9\311\367\263z\345\240\247\001;\3737\200\005"
+	.text
+	.section	.gnu.lto_.pureconst.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\001\230\004\003\230\004\004\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375 =\035\001"
+	.string	"\300+"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\004"
+	.string	"\001"
+	.string	"0\003"
+	.string	"0\004\001@"
+	.string	"\0051cO3"
+	.string	"\005\020"
+	.ascii	"D\347\221q\301C\021"
+	.text
+	.section	.gnu.lto_.lto.c40283c7f9a8ca8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_profileProbeNames.4.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375`/"
+	.string	"\025\b"
+	.string	"T\016\257"
+	.string	""
+	.string	""
+	.string	"t"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\370T}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'5\230'}\276\004\005\001'@\206\b{\330&y\301\003\005\001'P\206\bw\230&u\304\002\005\001'Z\206\bs\330%q\307'i\206\bo\230%m\311\001"
+	.string	"?\202\210\2000k3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\nscheduler"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/profile.c"
+	.string	"\ncheckFunc"
+	.string	"\017handleBlackbox"
+	.string	"\tmixTable"
+	.string	"\016pidControlgyroUpdate"
+	.string	"\013"
+	.ascii	"\206/\204\024\230\324\300\022\2209\310\004d\0162\001\231\367"
+	.ascii	"\314$@\3557\200\""
+	.text
+	.section	.gnu.lto_profileTicks.5.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375`\325"
+	.string	"-\f"
+	.string	"\326VSB\020q\224\016\363\"\005\305c\345\001\b\001O"
+	.string	"X\031\004\301\f\342`?)Q\200\305\227\002,\267\242\327\377}\020O\003\202}$|\373"
+	.string	"@\245\b\320\353$\006\303h\320\362\242\3044\203\353\204vo)S\n>"
+	.string	"?"
+	.string	"A"
+	.ascii	"\233!\301\243\021"
+	.string	"X\217\337\001~\211\2330\371\004;\020+\b%\252\221\224\335\356\312\034Sy\204\277T\036\365\303O\317\223\177\357\005P\220l+\324\023@gw\235\333J\303\255\267m\300v\307~(&2P6g\330\035*\325\203}\270\032b;m\301t\3244\204i\205\351\324\364\003`*\022L\214]\f\037\2155\211)F\274\373m\223\357\331\022U(\340~\302\364\316\243\223\272\360`\005\213\223\r\032%\334\303\240~$\004\247%06\354\017TRU\017B\"\225\237\257\251w\241\252aO\270G\262v\227s\325\274\340>\362\263\200MA\261\362\"\367*X\233\346v\251#\2779cAQ>\327\342\"\002f\260\240\201\347\003\372p6\227\022G\032\264\021\215\260\b\231\266q\205FX\307\347\242\200yH\027H+]\033\002\3166D\332\305\221e\332e\351\366p5\304\322\314\207\246\354\001w;88\021\311\317QU-=\b\007\030\025"
+	.ascii	"\214YE&\036\345\243\225\331\370\304&\024\b\003\030\271\352\312"
+	.ascii	"B\331\340\246a\243\026_\215Y\026K]\023Ef\261\017&\344P\035\006"
+	.ascii	"M\222\022 \334\225N;\311"
+	.text
+	.section	.gnu.lto_profileInit.6.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"}\b"
+	.string	"\242\217990\217\323\001\3009\312\364\370\254\213\033\306\341\343w\020\376B\032\334\271\321y\f\n\2617\322\330\017\305\017\212Y\336\250\r~((\304\203@\233\364\330\235\333\220=\350\217\366\367N)\366p>\240\314A\333B\265\001\224\215:\025\"cx\250\236MT9\007\326B\237\255Fh\332V\351\370\375t"
+	.string	"U\270\372f\311\032)Mn\224\314\346\0179\tG\340\261\373\035\364E>\"\362?\216y\304\311\203\\F\224\230\220\007\215`\232\236/^@\225AM\030)\005/\326\312\027{,\311\311a\037\263s\303\236\035\257\205\2652[\343Z\274\\\273\302N@l\337O]$\035\345\215K\003\265\273\364\230\237\"\331\364\330\251;\233\305\200b@\245\242\304ew\353\354xw\331\371?="
+	.string	"\f\275K\315\302\356Z\202\341\305=o;\301\266\202\355V\017"
+	.ascii	"2\003\3020\301\302\206\305\004L\005F\207\210\232\260\005\016"
+	.ascii	"\242\022\220k\370x\b\207P1^\256\b\227c\321N2"
+	.text
+	.section	.gnu.lto_profileReset.7.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"-\007"
+	.string	"BN36@o\222\016@\265\345T\023k%\361\346\253\276\327"
+	.string	"\005\034\366_\275\273mG\331?\212>Z7w\003\324\212}\260c@&\031c\n\027\313K\315l\312\272YBd\ns6\035\317\345\200e\037\330\340\271@\f\020\342Zx\200\234,\002n\b\306>\235\fJ`X\0065[6\223\257\244\320\221\032=\213-\347Nz\212\205\320\242\272\205\004L\231\243\306+\322\021\320\005i\365D\3105\266\272!\253\325ST\270\306\013.\236hg\262\301\222\356\3457\221{\036\337L\276\322?\213ce@%3#\006&S\025\312\351\357\027\245\275f\355[\272\231\262$\021\243\304%3\341\373\250V\247\335\2064 \222Du"
+	.string	"\t\231\271\213$\215\376\372\033\374\007\377)\007"
+	.ascii	"3\241g\037\350 \314=\256\211\320B \3402/\332I\006"
+	.text
+	.section	.gnu.lto_profileProbeName.8.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\025\f"
+	.string	"\246VTB"
+	.string	"q\225\016|V\fzM\027{Z\277\230\311}$\363\247g\0214\2769F\rM\210&\364\327\277n\026\341\232\346\203\030\200\245\357\251\375\377\177\365\037z\371\335\201\364x'\355&\346\317Mm#{o\231R?"
+	.string	"@"
+	.string	"B"
+	.string	"%*\273S\363\374\200\354\362rMv\tE\356=B\365\374\324#\3463Y\335\200\361y8\214\007FL\221"
+	.string	"\037+&@!A9\354\352\372V\252\226\316\356Z[\337\353\226\267M\301\366\004\373\016\002V\307\317_\255\276\2040Ur\024\230\261\333a\205\307\322\220'(l\243\354\214-OpT\355\2578\t\352\363d\314n\210\024\031\273\223\201\027\\.\021D\333\376\310S\240\354\021\230$^\026\021\0378\004q\303c\244\313.K\202\337\342%\245x\023\227\326`\312\336\272\364MP\001\216\023\225\256\030@L\205\202\210\321\343\005\204!\226?e\n7\026),\325\341\303\376\021\033\251\261\272\303\236)\205!\366\343B\020;n\300y\340\331>[\204\215\006\264q\335H\372\263\001\211B\026\270n\244U\020\205J\233\206!\344\271\240}:\222\2661`n\004\352\264\f\034\327i\231\271\207 \316l\224pa\242\276\227\035v\0010\302C\027tG\005W\001\021"
+	.ascii	"\247Y\305\253\320x:xf\001\306\261\202\204\201\2150g2\3263U\034"
+	.ascii	"\\p\256\341-Z<\237L<\270\033I5H\225\016E\255\202\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375 \315U\003"
+	.string	"\342\004\022\036\260%\351\f\303q\256\3220eA\212\265U\016\207\242INEn\255\021B\b!d\357\235\002\007\020m\031\n\314x\244\262\377\332> ad2lA\212Jt)\217\255\201\301\202\322\034\241\206\317G\024\214\264\355\311r\377\207\f"
+	.ascii	"\256Lh\226G\026\206\301\247~\216\005\303%\344je*\320\004\320"
+	.ascii	" \212-\200\206\313\3161"
+	.text
+	.section	.gnu.lto_.refs.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\001\001\002\002\004"
+	.string	"\001\003\002\002\002"
+	.string	"\001\004"
+	.string	"\005\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c40283c7f9a8ca8,"e",@progbits
+	.string	"(\265/\375`\017\016\235K"
+	.string	"\312\211\334\035VP\022\036\245\003\025\001\320;B\242\214^\341\bi\375U\250\261\226f\013o{\264\215"
+	.string	"2\2213e\360;\356r2gs\f\303\257)\370\351\257\224:\225\312\335\353\037z\0079\3445\204"
+	.string	"\252\004*\201\352L\177\234L\333\334\3161\362\213\204\237E^\"\242\244\373K\231\002\217\001\313\001\317\001\335iN-\b\265\245\n\327\022\373S\326\005*w\200\304\264\334dx*\343\302\365\253\345\337\0346\313b\301\035\273\205\335-@N\023\225\240\220k\r\305\372\224{C\356\213\303}je\305/\036\\maX\266\314\212\2051\256\377b\271\262\303\344i\310\221t\353\366\205\226\305\203\353Z\331\257/\330V\371\220\212\327\200\310\336\002#:v\007\027l'\210\356\340\316\356\001\273\007\324%SU^e\375R\331\300W\2061,\341\372\0244l\224\002\230\320\013\264\212\230uw\rKe\221;e\273\276R\326\353#\322\356)\335\375\335\372s;e\235lr\311\214i\353\370"
+	.ascii	"I\224%g\335mb\204\211%\366\260B\226\262n\357O\311\343\002J\211"
+	.ascii	"\203\352\006\312\365 \230\357\300\334'\233.\362c;CI4\246\275"
+	.ascii	"\203kbc\215\030\327O`\342\202\276\\\367\221j\025\027a\246\320"
+	.ascii	"i\373\261\362l\376\333\344_&\273\365\261\032\352t\354\256\356"
+	.ascii	"\264\247\342\220\305\005\344\372t\177Js}\312\177q2\370\025\237"
+	.ascii	"\337\374\214\363/\003\377\3170\270\371\363\315\177\257\3773\374"
+	.ascii	"\237\362\037\312\277\006\\\360_\201\377 \374\257\241\354\177"
+	.ascii	"\316\317\373/\356_\013\376\255\340\337\t\376\225\340_\b\376}"
+	.ascii	"\340\337\006\376]\361o\212\177\207\376\343\374L\342\337\023\377"
+	.ascii	"\226\3707\347\337\333\277\266\177k\377\376?\332\3776\377w\370"
+	.ascii	"\257\345?\226\377T\376o\375\327\371/\366\277LKKK\3737\201\237"
+	.ascii	"\037\370q\200\004\335Ufj\314\253*A\037\\\377\227\350"
+	.string	"\377\217\240\201Z\302`\261\247\323&\242I) JC\227bO\332-\b\320\311 \215\246R\305zl\356\264\267\205RE\022\320\364HD\323#\220\247\205G`wZ\344A\273\202\300E\223RE4y,\366\264\260\201\235\f\266`\n\217Et\354X\344A\223\301\"*\224*\366$13b\306\306\017\301-\013D\205\215c\030\025$\362\220\241\351\261\313\272\267\213F\023\021\350\216:\022\313\202*\254\025&2\034LS\202\307M\273{\200!\323\324\261\205d(\326\261\033\213\351\250\207D\300\224\254\251\226\f\030$\252\235ht\023\320i\367\260\033\270M\326\335\300\356\276!F\245\335=xP\253\341\260\3338b\330Q\300/\032\335\3345\306J\021MN\035s_P\222V\335\224\002\327\252\313\244\210f\022\310\325NiL\253\342\016\037\270V\254\240/\032r\321\266M\004E\322\006n\360\004J\353\254\211\306\005\312,$=\246\234"
+	.string	"\321\346\346\313\220\247 \327o\233\177yX0{f\032I\203\250\301\365\207\0215-C\0342p=W\231j6\315\256Y\344\262Y3)\306l\031\235[\267\024\031\253-6{f}\3302c\326\235~\271\374\271/\233\r\263b\n\250\321-u\204\2040\f\f\310Yw:\302\204\t\023\270++\034l0\353\366\260f\213\274\330\242\021\021D\013\2264C\230Oa/V~\323\230\337/dn`\322\260\320%f~\303L\240-\273\t\323\035S\215\2220_\240\230\337&\346\017[\361\222\373~1\207\270\001\007\025W"
+	.string	"\326\247\334\035r\262\2244\331\340\372Mb\356\330nY\344\222\375\253\303ryE\036;\031\271\263\025\216\360\311+\t\327\333\372\224u\213\3249\210\024#\251\201\3015\020\3319n\252\344\340%\n\207\353\006\327\016Tg$\347#C*n\306\324\212\001L\220+\033\271\216q\013\230\231\013\374\343JH\362\204\211\204*\026\271r\221\233a,3Nh\2702\221\207\341\214a\316\210\360\220\3530\345\205\211Y\210\016X\223\0241 &O\235\211`?\204Hq\375\215\027\030\037V\\_\215f\025\202s\234w\344\340\343\210#\020Mn\005\264\013\324Y\243F \263F*V\364q>\236\201\f\251x\030\256\314\0316d\\\317,\360\217\377f^\371\272\342\001\315<G\211(\322\005I\026Wf(\356\361\377V\305\264"
+	.string	"q\305\225U`\343\"\037\306+|E\265\311\202\306\224q\023V~\r\363`#\374\301\b\017~\032\200\007\231,\256O\333e\363\0022E\005\256\\<\353\370o7\035MUe\314\237\211\377\255\226cj\206\225/\346k7\230\365+h\225,\337X$\337\340\341\005i\003K\220\362\264"
+	.string	";\225cNObWR\034#J\305I\322\264\375hj\342\032lu\023e\252\207Y\033\243\200\252\022 \316\214a\364\\c\261\340\220!\0333\306\365k\266\313\377\233\355\0054!\206W\246\215\311\f\2461\203\350\305\006\224\226\226\371u\204\222d\210i\343\342 \007\231i\215]+S\006J\353\254\026\206\013\2230\246\237\261u\301J\342\325\303\264E\tZ!v\210o\032r\323\270\315\356\256u\377\030\263j\243\021\350F\244\310V\2335\347\376\207T\254\030\\\367Vw\027P;r\004\310\365\265\241\371\345\277\354 \261\273u\330\322&2\341\312\265\355\002\3759[[\004\376\327\256\021Y\005?\nz\341\353)\235\277"
+	.string	"N\035\017\205\336\257<y?\030<\030\345\217\202"
+	.string	"@BZ\362\371\222|7\247\316E\357&\202\021\017\251\232\220\244tt&\371nN\336\013\335\b\273$\244]\316\257\207\007\303H\003\236\223\367\343qp\366|\030\340\340\276\353)\361|\274\027\346\211\212N\024\255\220q\363\025,P\260@Q~\005\213\\\216EQ\316|Q\256\366\335/\347\374\021\211'\305\340)\t\235IIJB8\247\216\250\b\311\350L:E\374N\335P\212\323\327[2O\337R\322\316v\352~#\354z\035\3100\202a\362t\274\026IJ\033\350(\031\035\355\352\217\202t\347nI\351\374\t\375x1N8\205~g\257\205\320\222\357\305\t\031K\276\036\322\t\242\"]\321\n\031B<\027KH;_OH\351\267$\344\300\216\027\343g\236:\036\214\336\251\323\231;\336OW\302Y\236\272\027\276$\244\237\016\t\311h\367;\341\247\323\365|\b\005\221Q\213]\213\242 \2377\320"
+	.ascii	"\005%<\320\300\002s\027\304C\352\211\220\244\024C\310\005Ro\251"
+	.ascii	"\205\220\257g\004Ch\247\364\023\n\"`\307\373\371t%\23475\f\305"
+	.ascii	"\324\020\202\306\013\211\016\331\2234*)G\021QG\212\264\320\025"
+	.ascii	"\205+\307\016,\256\347(?\323\300P\206\234\250\210p}\016\373S"
+	.ascii	"\342\274\220;'K-\024m\311\f\310&\033\322\205\353\031\371s\026"
+	.ascii	"s\261\223\017c\017\\o\366$wN\271\252KL\214k\216\223&6.\224\215"
+	.ascii	"\027\327s\223\237\253x\313\005\036;\272\366\247\\&\2713\223\035"
+	.ascii	"/U\326$Y\242\0047E\024#\204\353Y\311\3172\260\026N,\213\0274"
+	.ascii	"\256?\333\237r'+w\216!-\355\n\025W\035\306\272\302\231A\034\233"
+	.ascii	"\301\365|\365\363\013\f\303\202\205\220V\245\306\211\353\255"
+	.ascii	"\354O)b}J\256\n\200\357\250a0\205\2204\006\021!\231\021\2214"
+	.ascii	"I:\200\002\221\261*n\003\021P-\203JLF\222\244N\007\214\035M-"
+	.ascii	"db\241[\343gO_L\360 %a\"\360\023\360\325\240\374\204g}\271\004"
+	.ascii	"\016\240q\006\210\215\264.`\246\261"
+	.string	"\303\206\301\334\262>?8\306\342\231\277\302\202\252\275,!w$\331\355\003\306\334\n\320\031\333\021\223\303\253*\222\216J"
+	.ascii	"j8\373\230\207\201\321T,!S@\300;qd/^\330\032\r\020!\344@B4\227"
+	.ascii	"\210`\312#)\022l4\213\024\212\265\364&\023\247\353\315\007\214"
+	.ascii	"Y\347\323N?\262\\\005\324\301Y\233\340\253\367\303m\026z\025"
+	.ascii	"\234VJj\027 \342\356\033\025\004S\314\315Y\337d\323\023\222q"
+	.ascii	"@\314\341\207\r\004\013*\351\032\316\303\360)\361\366N\364eE"
+	.ascii	"\230\204\001\326l\330\305\361K\364\363|k7P\340@\307v\352V\370"
+	.ascii	"\371\257\301o3\"\030\235>\345\267\217\267\217\255n\244.`\222"
+	.ascii	">C[\t/\341\237\301\203\311\335Q\250k\210\3606\f\217I1i9&hVx\253"
+	.ascii	"XW{\256\277\n(E5\314\274dy4\302A\223\337\270\277\344?\317\252"
+	.ascii	"i\226#\006n!\232l\023A;\261H\312S\034z\274=\001\254.\231\337"
+	.ascii	"(\307\331bU?\354w\25730\030ha\\\314\240\300#\221\353\013\007"
+	.ascii	"\217\216\321\226\t\332\026\031\323b\266\273\345\377\216@L+\365"
+	.ascii	"`I\256\030\232X\300\001\226\320\337K\025\301r\035\340\035\256"
+	.ascii	"{\302M\003\032<\377\2044n8\331\305\3669\227U\324.n\013\335\334"
+	.ascii	"\361\255\307 _T\007\001\303\312\344\243\004\305$\326\223\027"
+	.ascii	"\330\f\227\013d\200\001{h]6Z}\336VX#AYU\357\227A\230\031h\013"
+	.ascii	"\233\270ah\025\322\257\026\307\373\357cl/c\362\364\301M`/\261"
+	.ascii	"\205\016;Q\363P\001\nE\276\360T\001"
+	.text
+	.section	.gnu.lto_.symtab.c40283c7f9a8ca8,"e",@progbits
+	.string	"profileTicks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"profileInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"profileProbes"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"profileReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"profileProbeName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c40283c7f9a8ca8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,4996 @@
+	.file	"colorconversion.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/common/color.h"
+	.file 4 "./src/main/common/colorconversion.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	colorconversion.c.74adb262
+	.weak	colorconversion.c.74adb262
+colorconversion.c.74adb262:
+	.long	0x1a4
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x8
+	.long	.LASF782
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF763
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF764
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF765
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF766
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF767
+	.uleb128 0x2
+	.long	.LASF769
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF768
+	.uleb128 0x2
+	.long	.LASF770
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF771
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF772
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF773
+	.uleb128 0x2
+	.long	.LASF774
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF775
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF776
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x5
+	.long	.LASF778
+	.byte	0x3
+	.byte	0x1d
+	.byte	0x8
+	.long	0xd4
+	.uleb128 0x3
+	.string	"r"
+	.byte	0x1e
+	.byte	0xd
+	.long	0x85
+	.byte	0
+	.uleb128 0x3
+	.string	"g"
+	.byte	0x1f
+	.byte	0xd
+	.long	0x85
+	.byte	0x1
+	.uleb128 0x3
+	.string	"b"
+	.byte	0x20
+	.byte	0xd
+	.long	0x85
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.byte	0x3
+	.byte	0x3
+	.byte	0x23
+	.byte	0x9
+	.long	0xf4
+	.uleb128 0x6
+	.string	"rgb"
+	.byte	0x24
+	.byte	0x1c
+	.long	0xa9
+	.uleb128 0x6
+	.string	"raw"
+	.byte	0x25
+	.byte	0xd
+	.long	0xf4
+	.byte	0
+	.uleb128 0xb
+	.long	0x85
+	.long	0x104
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF777
+	.byte	0x3
+	.byte	0x26
+	.byte	0x3
+	.long	0xd4
+	.uleb128 0x5
+	.long	.LASF779
+	.byte	0x4
+	.byte	0x34
+	.byte	0x10
+	.long	0x13b
+	.uleb128 0x3
+	.string	"h"
+	.byte	0x35
+	.byte	0xe
+	.long	0x91
+	.byte	0
+	.uleb128 0x3
+	.string	"s"
+	.byte	0x36
+	.byte	0xd
+	.long	0x85
+	.byte	0x2
+	.uleb128 0x3
+	.string	"v"
+	.byte	0x37
+	.byte	0xd
+	.long	0x85
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF780
+	.byte	0x3
+	.byte	0x38
+	.byte	0x3
+	.long	0x110
+	.uleb128 0xd
+	.long	0x13b
+	.uleb128 0xe
+	.long	.LASF783
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x12
+	.long	0x19d
+	.long	0x19d
+	.uleb128 0xf
+	.string	"c"
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x2f
+	.long	0x1a2
+	.uleb128 0x4
+	.string	"r"
+	.byte	0x1d
+	.byte	0x1c
+	.long	0x104
+	.uleb128 0x4
+	.string	"val"
+	.byte	0x1f
+	.byte	0xe
+	.long	0x91
+	.uleb128 0x4
+	.string	"sat"
+	.byte	0x20
+	.byte	0xe
+	.long	0x91
+	.uleb128 0x10
+	.long	.LASF781
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x4
+	.string	"hue"
+	.byte	0x22
+	.byte	0xe
+	.long	0x91
+	.byte	0
+	.uleb128 0x7
+	.long	0x104
+	.uleb128 0x7
+	.long	0x147
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.file 7 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF555
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF573
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF596
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF656
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF660
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF661
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF757
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 21 "./src/main/common/colorconversion.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF476
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF479
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF492
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF493
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF540
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF554
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF572
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF653
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF756
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF762
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1
+	.long	.LASF784
+	.long	.LASF785
+	.long	.LASF786
+	.long	.LASF787
+	.long	.LASF788
+	.long	.LASF789
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x16
+	.long	.LASF0
+	.byte	0
+	.long	.LASF790
+	.byte	0x2
+	.long	.LASF791
+	.byte	0x2
+	.long	.LASF792
+	.byte	0x1
+	.long	.LASF793
+	.byte	0x1
+	.long	.LASF794
+	.byte	0x5
+	.long	.LASF795
+	.byte	0x6
+	.long	.LASF795
+	.byte	0x5
+	.long	.LASF796
+	.byte	0x2
+	.long	.LASF797
+	.byte	0x5
+	.long	.LASF798
+	.byte	0x5
+	.long	.LASF799
+	.byte	0x2
+	.long	.LASF800
+	.byte	0x2
+	.long	.LASF801
+	.byte	0x4
+	.long	.LASF802
+	.byte	0x2
+	.long	.LASF803
+	.byte	0x3
+	.long	.LASF804
+	.byte	0x3
+	.long	.LASF805
+	.byte	0x2
+	.long	.LASF806
+	.byte	0x2
+	.long	.LASF807
+	.byte	0x2
+	.long	.LASF808
+	.byte	0x2
+	.long	.LASF809
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF448:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF611:
+	.string	"__STD_TYPE typedef"
+.LASF478:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF673:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF649:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF580:
+	.string	"__stub_sigreturn "
+.LASF417:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF542:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF556:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF517:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF715:
+	.string	"INT16_C(c) c"
+.LASF746:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF488:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF469:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF484:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF757:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF745:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF728:
+	.string	"INT32_WIDTH 32"
+.LASF730:
+	.string	"INT64_WIDTH 64"
+.LASF531:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF656:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF694:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF504:
+	.string	"__P(args) args"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF624:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF449:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF698:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF719:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF663:
+	.string	"INT8_MIN (-128)"
+.LASF650:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF608:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF492:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF437:
+	.string	"_ISOC99_SOURCE 1"
+.LASF519:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF408:
+	.string	"__USE_POSIX2"
+.LASF672:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF693:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF564:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF689:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF420:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF407:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF707:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF654:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF779:
+	.string	"hsvColor_s"
+.LASF780:
+	.string	"hsvColor_t"
+.LASF710:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF576:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF633:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF431:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF411:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF416:
+	.string	"__USE_XOPEN2K8"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF541:
+	.string	"__always_inline"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF427:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF684:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF490:
+	.string	"__GLIBC__ 2"
+.LASF438:
+	.string	"_ISOC11_SOURCE"
+.LASF772:
+	.string	"long int"
+.LASF480:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF432:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF467:
+	.string	"__USE_XOPEN2K8 1"
+.LASF642:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF396:
+	.string	"__REVISION__ \"7b45b89\""
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF653:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF638:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF700:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF632:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF538:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF522:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF506:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF562:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF527:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF520:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF739:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF635:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF583:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF761:
+	.string	"HSV_VALUE_MAX 255"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF487:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF497:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF729:
+	.string	"UINT32_WIDTH 32"
+.LASF767:
+	.string	"signed char"
+.LASF731:
+	.string	"UINT64_WIDTH 64"
+.LASF774:
+	.string	"uint8_t"
+.LASF598:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF508:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF613:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF555:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF629:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF631:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF763:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF460:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF505:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF685:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF783:
+	.string	"hsvToRgb24"
+.LASF475:
+	.string	"__USE_LARGEFILE 1"
+.LASF756:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF664:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF549:
+	.string	"__restrict_arr __restrict"
+.LASF574:
+	.string	"__stub___compat_bdflush "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF640:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF486:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF680:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF528:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF747:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF585:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF579:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF601:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF623:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF546:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF778:
+	.string	"rgbColor24bpp_s"
+.LASF777:
+	.string	"rgbColor24bpp_t"
+.LASF770:
+	.string	"__uint16_t"
+.LASF414:
+	.string	"__USE_XOPEN2K"
+.LASF514:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF655:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF415:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF544:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF447:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF464:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF691:
+	.string	"INT_FAST8_MAX (127)"
+.LASF679:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF752:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF720:
+	.string	"UINT32_C(c) c ## U"
+.LASF699:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF409:
+	.string	"__USE_POSIX199309"
+.LASF670:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF709:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF418:
+	.string	"__USE_LARGEFILE"
+.LASF702:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF413:
+	.string	"__USE_UNIX98"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF430:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF617:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF602:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF647:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF548:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF687:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF440:
+	.string	"_ISOC2X_SOURCE"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF769:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF586:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF526:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF697:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF690:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF587:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF536:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF547:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF465:
+	.string	"__USE_POSIX199506 1"
+.LASF755:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF454:
+	.string	"_ATFILE_SOURCE"
+.LASF607:
+	.string	"__SLONG32_TYPE int"
+.LASF712:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF628:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF403:
+	.string	"__USE_ISOC11"
+.LASF479:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF733:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF661:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF584:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF735:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF476:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF703:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF630:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF742:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF596:
+	.string	"_BITS_TYPES_H 1"
+.LASF671:
+	.string	"UINT8_MAX (255)"
+.LASF708:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF718:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF461:
+	.string	"__USE_ISOC95 1"
+.LASF565:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF578:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF743:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF518:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF434:
+	.string	"_ISOC95_SOURCE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF509:
+	.string	"__BEGIN_DECLS "
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF500:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF402:
+	.string	"_FEATURES_H 1"
+.LASF453:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF498:
+	.string	"__LEAF , __leaf__"
+.LASF659:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF530:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF744:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF612:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF470:
+	.string	"__USE_UNIX98 1"
+.LASF471:
+	.string	"_LARGEFILE_SOURCE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF422:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF450:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF648:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF558:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF696:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF771:
+	.string	"__uint32_t"
+.LASF483:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF753:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF567:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF572:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF399:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF553:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF503:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF446:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF732:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF534:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF552:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF494:
+	.string	"__PMT"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF634:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF455:
+	.string	"_ATFILE_SOURCE 1"
+.LASF603:
+	.string	"__SQUAD_TYPE long int"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF724:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF425:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF569:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF749:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF667:
+	.string	"INT8_MAX (127)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF765:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF727:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF495:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF421:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF466:
+	.string	"__USE_XOPEN2K 1"
+.LASF459:
+	.string	"__USE_ISOC11 1"
+.LASF641:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF637:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF600:
+	.string	"__U32_TYPE unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF525:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF529:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF457:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF551:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF577:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF682:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF675:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF758:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF540:
+	.string	"__wur "
+.LASF473:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF760:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF725:
+	.string	"UINT8_WIDTH 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF714:
+	.string	"INT8_C(c) c"
+.LASF606:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF652:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF489:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF616:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF501:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF557:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF759:
+	.string	"HSV_HUE_MAX 359"
+.LASF507:
+	.string	"__STRING(x) #x"
+.LASF554:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF561:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF773:
+	.string	"char"
+.LASF502:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF563:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF677:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF674:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF764:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF754:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF405:
+	.string	"__USE_ISOC95"
+.LASF705:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF412:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF686:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF537:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF662:
+	.string	"__intptr_t_defined "
+.LASF468:
+	.string	"__USE_XOPEN 1"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF625:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF644:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF393:
+	.string	"SITL 1"
+.LASF435:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF406:
+	.string	"__USE_ISOCXX11"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF775:
+	.string	"uint16_t"
+.LASF610:
+	.string	"__U64_TYPE unsigned long int"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF766:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF669:
+	.string	"INT32_MAX (2147483647)"
+.LASF533:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF410:
+	.string	"__USE_POSIX199506"
+.LASF740:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF716:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF721:
+	.string	"UINT64_C(c) c ## UL"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF477:
+	.string	"__WORDSIZE 64"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF581:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF515:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF609:
+	.string	"__S64_TYPE long int"
+.LASF568:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF512:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF723:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF599:
+	.string	"__S32_TYPE int"
+.LASF734:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF711:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF657:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF665:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF737:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF575:
+	.string	"__stub_chflags "
+.LASF424:
+	.string	"__USE_GNU"
+.LASF643:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF456:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF636:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF614:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF545:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF423:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF683:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF535:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF695:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF510:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF481:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF736:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF768:
+	.string	"short int"
+.LASF493:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF433:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF523:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF738:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF560:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF604:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF571:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF521:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF621:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF524:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF605:
+	.string	"__SWORD_TYPE long int"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF532:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF678:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF618:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF462:
+	.string	"__USE_POSIX 1"
+.LASF704:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF701:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF782:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF570:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF451:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF472:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF597:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF713:
+	.string	"WINT_MAX (4294967295u)"
+.LASF539:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF482:
+	.string	"__USE_ATFILE 1"
+.LASF543:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF741:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF559:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF639:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF626:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF666:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF491:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF452:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF681:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF751:
+	.string	"UINTMAX_WIDTH 64"
+.LASF776:
+	.string	"uint32_t"
+.LASF458:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF615:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF676:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF441:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF688:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF511:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF463:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF627:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF566:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF750:
+	.string	"INTMAX_WIDTH 64"
+.LASF668:
+	.string	"INT16_MAX (32767)"
+.LASF588:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF762:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF619:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF474:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF620:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF496:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF439:
+	.string	"_ISOC11_SOURCE 1"
+.LASF660:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF692:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF485:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF781:
+	.string	"base"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF646:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF658:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF748:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF516:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF573:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF499:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF622:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF419:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF717:
+	.string	"INT64_C(c) c ## L"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF436:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF582:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF651:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF706:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF645:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF722:
+	.string	"INTMAX_C(c) c ## L"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF550:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF726:
+	.string	"INT16_WIDTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF802:
+	.string	"long-double.h"
+.LASF804:
+	.string	"stubs-64.h"
+.LASF788:
+	.string	"/usr/include"
+.LASF808:
+	.string	"stdint-intn.h"
+.LASF796:
+	.string	"libc-header-start.h"
+.LASF786:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF807:
+	.string	"wchar.h"
+.LASF800:
+	.string	"timesize.h"
+.LASF803:
+	.string	"stubs.h"
+.LASF791:
+	.string	"stdint-uintn.h"
+.LASF787:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF789:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF797:
+	.string	"features.h"
+.LASF806:
+	.string	"time64.h"
+.LASF0:
+	.string	"./src/main/common/colorconversion.c"
+.LASF785:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF805:
+	.string	"typesizes.h"
+.LASF793:
+	.string	"colorconversion.c"
+.LASF1:
+	.string	"/root/repo"
+.LASF798:
+	.string	"features-time64.h"
+.LASF809:
+	.string	"colorconversion.h"
+.LASF801:
+	.string	"cdefs.h"
+.LASF792:
+	.string	"color.h"
+.LASF799:
+	.string	"wordsize.h"
+.LASF784:
+	.string	"src/main/common"
+.LASF794:
+	.string	"stdc-predef.h"
+.LASF795:
+	.string	"stdint.h"
+.LASF790:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.69c587df7ecefda2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.69c587df7ecefda2,"e",@progbits
+	.string	"(\265/\375 {%\001"
+	.string	"\320o"
+	.string	"\002"
+	.string	"\322\206\312\366\f0\002"
+	.string	"\002\001\002\002\001\002\003\001\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"\237Cz'\322\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.69c587df7ecefda2,"e",@progbits
+	.string	"(\265/\375 *\r\001"
+	.string	"\270\036"
+	.string	"\001"
+	.string	"\001\003\002\004\002\002"
+	.string	"\002\001\002\005\003\001\001\020\004\006\003"
+	.string	"\003"
+	.ascii	"*\002\244\204\277\001,"
+	.text
+	.section	.gnu.lto_.inline.69c587df7ecefda2,"e",@progbits
+	.string	"(\265/\375`\302\001m\t"
+	.string	"\"\317-+\200)I\007\246\205\211M\306h\203\017\240\004\351\254*\202\216\225\004\227dX\206\034\001++\217\201\235\206\324\205O\017\357F,!{\247\377\253\225\223\33220e\214\235\214i\2551mZ\323\234\315\335-\3471\r\221i\017\265\324"
+	.string	"%\024\021\007<U\037i\202q\361\260\316\326\023\202\023-\024p.=\035u\262\236\020\336\032\353\2204\321V\031Y\307\354\331\361"
+	.ascii	"\333\366\306\321IQ\024e\254Wh\013\275\300\247\025{I7\360\032"
+	.ascii	"*\241\304\335\3009\326\211\005w\372\034K\301\347\213\270\203"
+	.ascii	"\270\205\t_t\317:\005\t\022\027\220\245\357Y\013\237\001>\004"
+	.ascii	"l\210H*\266\370\033'\001: \320\002\241\354\034r\200\237\231["
+	.ascii	"\241P\350o\360\035\b\021\322\236\260\r\227u\020\201\205n\315"
+	.ascii	"\305\265@1\24306\254\223\334\330.d]\310A\bb\234L\210\201\020"
+	.ascii	"\2300\222\001\361\204\200\240\340\250d\023\304\232;*G;\033#\212"
+	.ascii	"H\006\266\b\363\204\203\316\244\321$^\313\270\334\033\005\365"
+	.ascii	"k\357\016\303\2703{J\001\001\356\"\017w\214\345\0043\250\265"
+	.ascii	"\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.69c587df7ecefda2,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.69c587df7ecefda2,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.69c587df7ecefda2,"e",@progbits
+	.string	"(\265/\375 8\205\001"
+	.string	"T\002,"
+	.string	"\001"
+	.string	"\001T"
+	.string	""
+	.string	""
+	.string	"\001\002\t"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\020\b\020\002\004"
+	.string	"\020\020"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\2730[n\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.69c587df7ecefda2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_hsvToRgb24.0.69c587df7ecefda2,"e",@progbits
+	.string	"(\265/\375`n\016]7"
+	.ascii	"z_L\024<@\350J\007\341X<\376\347\242\207\325\036\007|O\376\332"
+	.ascii	"\177X\347!\223;Hh\274\3151)\324;\205^\t\262\357h\252\341\360"
+	.ascii	"\207Z0>\n\330\\a\224\335\217\206\334[n\222RJ\001*\001\026\001"
+	.ascii	"5\001l\225:\033Q\347*\353Le\235\001T\347\251\352,U\235\243\254"
+	.ascii	"3\224u~\262\316N\326\271\311:3\241\3166uNSg4u\256\251\363\231"
+	.ascii	":\027Q\347\257\316^\235\333\204\331\027\252B\367\006I\264t\001"
+	.ascii	"\235s\262\264`\367`7a\237^d\306\301}\246\325\364\232n\303M\316"
+	.ascii	"\210M\031\022i\237^\211\260\206\326y/\037a\210\264\317\337\201"
+	.ascii	"\246\323\340\350A\032Z\366\336\2765\177\036\322>\265\212J\263"
+	.ascii	"e\233\301\321\2025\212W\n\333\0306\205\367.\301\372\344\ri\237"
+	.ascii	"R\336T\325\373\230\271w\240\215\236\272\327\357O\234{\227aL\226"
+	.ascii	"\366\311\314\334bz\f\016\246\273ZJ\311\353 \006/\315\244{\227"
+	.ascii	"G^\266\261\366\2316U\355\363\2434]71\331\024\255g\361\235\216"
+	.ascii	";M\017ORY\327M{LH\354'\323\033\350\013-\025e+\002\036jt\352%"
+	.ascii	"\351>!H\360\220L\312\035\325\346\371\255\341\255>!J\320\"\312"
+	.ascii	"\326\227\247\244\037J\251\243\250u\357\3556\355=\224w\356(\333"
+	.ascii	"\275\227=\251\314kvjf\346\303\314n\314P]\001\216\340\224\370"
+	.ascii	"\275\267\356\377\t\2378sH\207Wbc\222\266oA\267\256\363fe\250"
+	.ascii	"\355\243\246\0046\021\343\220\f\337\204\255e\347\207\374\337"
+	.ascii	"\211]\243f\3706D\376\335y\"\373\3777\036\""
+	.string	"3\\\313\361\3172*\333\315\215\032\310f\323\021\370\354\374\220\231S4\234\025\351\275:\316\270\337\344(d\221\336{\333J\237\3346j\237\375V\207\002\355<\221s\b\272~\310U\207\202\256\0372/\353\272x\357\275\376O\230\273x\357\275\374~\314=\330\254\241\005\233\333\232\2609C\007vc\250\316\027\252\263\005\353\\\301:S\260\316l\251\363\204\324Y\002\352\034\301:\257Yg\b\325\371AuV\253\316i\325\031\315:\237Yg3\353\\\206:\223Y\3471\353\354\240:7\250\316G\353,f\235\303\2543\203\324\031,u^\200:\177Yg\005\326\331\253:wU\347\004\325\231\313:#\260\316\007\254\363\026\352\254e\235\rX\347\002\3259\253:\023\250\316X\325y\200u\026`\235\257\254s\200\324\003o\020\373\352\005<\312\f\360T\177\365EC\344\026\253\017`\3745\253?\007!\377\252\336\330\203\272\355\253\2762\221s\356"
+	.ascii	"<\025\200;\211\272\353\3249:R\216\004a\364\035#\242\\GsN\316"
+	.ascii	"\224\333y\235_\251\217\372\251o\344^\372RP\037\365\225\271\326"
+	.ascii	"4\352\323C\375\331D\002:}\323?}#\267\264\275\323\0275<\3237}"
+	.ascii	"#\377\230\376\r\361\020\347\312\\\002a\2644\"\352\260\331c\f"
+	.ascii	"u\003\002\252\363K\314\313\272\346Z\223\347w\376\223I\334\224"
+	.ascii	"N=C\356HE\366\344\275\363\341\210\373\321#2\342.\364I\212\270"
+	.ascii	"\233-\025\347\"\372\273|\207\270\021\361\242\364\336\272\336"
+	.ascii	"\343\366\252\314w\001\231\205\367\336\257.\304\314\213"
+	.string	"\272\367\230\231\027\245R\256\220\273\274_}\332\257].\022G\344\265\366\252mo\337\233H\300\2730\032\276\007\323\327\360m\230\242\237~q\020\022\261\376\371\3507rK\177\375o\026\331N=\2773|\361\335\020\017\321K\221C\013\n\004\210\211\207\366\303\354\263\244\237\371C\357\001\021\305,\242\365\214x\222r\357=\303\323yJ0\317\321y'\351\336$\003-\334f\274\f\267\030\017\027\303\355D\021nN\305\363\330\331\330\t\024nehbXo\315ob/\342V\304\220\203\233\361\"\356M.\256E\234\013\027qo\307\027+\334\\\034\337\344b\034\305\2708\016\006\234\334QF\\\234\334\261iy\373\375\330\007\351\322{\355:\231F\215\317\356\357\330\007\355\020\352\376\304\304\304KMd.\234\0214c\341\037\374\205\no\201\302W`\373\265\2470\341\331$L\210\360\022\"|eB\3705\bb\036\224\t$\363\340\275\031\306\305"
+	.ascii	"\206\371\"\251k\027&-`\276xa\222\306e\213\226%jY\260\\I{\264"
+	.ascii	"WK;{4\263?+\373\2617#\37322\007?\346\340\337\260\352A\352\212"
+	.ascii	"\304B\r\026\351*T\246\fi\020\005\312\223\343w}\003\261?\376\325"
+	.ascii	"\233\260\027{\224\311\340\025|\030\3303X\360\216\327`_\277\340"
+	.ascii	"\353+\323\353\025xA\r*\273\234\3645\351Bl\324m)\245\224\200\311"
+	.ascii	"\336\022\256\317\372\004\b\236\353Q;\007\036\301\327A[o\340\017"
+	.ascii	"h"
+	.string	"\375\226\326\237\315\002o\240\200$%zI\f\263\216\030)\322IGvY\357MG\213\272\013Q&\226\017\001a\364\274\021Q\256l\316\361\361 @~\314\351!\340=\222<\260~\300\023\300\022\360\003\376*\201\037\250AT\346\234*\221\221\240\240 )H2\214\001A\006\304 Ud\335\021\2408\211\230)\023\223$\205B\007\261\031M\274\034y\212\262\242\013\365\260\306,m\266\245\224:Pj\0334h\002\242.\311{\b\266\026&\260\320\370\021\372\345l$d\200\220=\265\245V\222\222PMV\342\312\332Ro\266Xa\304y\225\202\226\b\340\251\017\240h\212\t~@\304\3419@S=\303\262\227\2600\252\0312|\")\212s\232\321&\301Y_b\271(\212\205\003\327\267&\311\373\360\364\267\267\270\355\250\331\254\007\n\352w\371;\230P\342\204#\350 \212\273\373PF!]\3740\013U\245\361\365\343]\234\r\341|u"
+	.string	"\017\277\3109\367\305$^uY_\242>N\266\253\246\2773[\347@ \300b\216(\215\231\204?\026\256\237?\375.\234u3<\207j\177\021^\354\321\240\017\nJ\361\366\021\023\022PS\262P\233\366<\326\3425\263p\302\253\360\357t\340\363{?}|)uRg\224\223`\3110\243,\\j\221D\n\024\020\201/\304\022\332\016\031/\354\241M\225\251A<*,;\032\226\210C\2305B\220G\2246\313}\270\020o\316\361<\245\333\217<\325\305%\243\2261`\262[Z?\240\226z\302\260eJ\255\243|6T\322\212\211"
+	.ascii	"F\030\374~<\207}\211\316\234IQ-\227\036I!\261:\270\335~oB\r\226"
+	.ascii	"\203\r\313\326\262z2U\336L\353D$\351T\262\235\237T\241\315\242"
+	.ascii	"o2G^Ec\2436\023\037\031\275.\021\235^\240N\254\375x:\237'\357"
+	.ascii	"&~\216\362\252\3421\022\b\376\330z\377\363\002\230M\3352_\233"
+	.ascii	"\030\031\344\217Q\300d{\2346a\276\031\367\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.69c587df7ecefda2,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\001\f\200\204\001"
+	.string	""
+	.string	"\003"
+	.text
+	.section	.gnu.lto_.refs.69c587df7ecefda2,"e",@progbits
+	.string	"(\265/\375 n\235\002"
+	.string	"\344\003j"
+	.string	""
+	.string	""
+	.string	"\026"
+	.string	"\001\001\021"
+	.string	"\001\001\023"
+	.string	"\001\001\025"
+	.string	"\001\001#"
+	.string	"\001\001-"
+	.string	"\001\001/"
+	.string	"\001\001>"
+	.string	"\001\001\300"
+	.string	""
+	.string	"\001\001\302\307\311\323\330\344\346\363\365\367\373\376\212\001"
+	.string	"\002\001\216\001"
+	.string	""
+	.ascii	"\f\004\001@\300\001\006\004\034`@\300\001\006\004\\\241\224\001"
+	.text
+	.section	.gnu.lto_.decls.69c587df7ecefda2,"e",@progbits
+	.string	"(\265/\375`#\007=+"
+	.string	"\212P`\021Hp\\N:\377\207\360\342\227,\026\016\344\220\202\312\310\302\277\300\225B\371\027\335\002\032\017L\253\262.9=-\221\034\374\312( \320*\021P\222K\333\256\305\346\234\r\264\232\030\272\337\351\177"
+	.string	"\\Y\310\020\241=A\322\210L\001\337"
+	.string	"\b\001"
+	.ascii	"\001\315^a+\354\306-\267\361\2243\025\256\362\223\355n\273\233"
+	.ascii	"\307\343\031\241s"
+	.string	"^gn.z\0217\001\027\245\350\207\313P8\n\267I,\345\374\204\317\316#d\233=\177\330\201\342\344D\357\341\236\223\322]\263\311I\351;\334\223\211Rf\302M\270Eb\264\373\234\276\0136\351\262n6\b\350N\222;tN\364\031\356O\357\354\344\003\204\355t\364\236\221Rn2R\372\363\nqQj\304E\351\317f?\223q\031\322N}\261\266Z7;\024\304\316 \216\235\350Y.J/\023\245\377\305\374\037\363?\356?\332\177\271\377pmn\377\255$\375\347\320\244\363\237\300\317t\377\347\374g\376O\363\037\313\377\006\377\245\374?\360\377\314\1773\377\227\377\265\374\317\362\277\354?\320\177/\377\317f\263\331\374?\366\363\322\237Z\bm]\335\247\332\0316\243\332\352X{mim\262Y\260AN\366\022Y\274m\220I\277\350n\256\273Ic\2146\234\346\350\247\314\214\267\345\211\236\315.[\366\363\365\365c=Q6"
+	.ascii	"[\030\024\031f\226\001\\\b1;\236\250\034\227\341\226\227\377"
+	.ascii	"rD\231ks\335\275\344.\374&\234\222\354\356#\036\317\307\3100"
+	.ascii	"\256F\212\336)\314YR\271$\t\307dx\f\267\034\307b\316\354\371"
+	.ascii	",\216\301\250%\273Y\036\317\210\347\363\225d\350v\3213\220{\376"
+	.ascii	"q\317=\356\231\307=\353\270\347\267\237\271\360\022N\373\320"
+	.ascii	"=\354n\002\300 5\322N\224\237\364\316^\210\322\342\221\355\240"
+	.ascii	"\035[\226\256:9\356\216\211\266$\335\241\025)e'\372\263\026\316"
+	.ascii	"\362\263\303\007\034\220\023\305\302\032\361\204\271\3215\344"
+	.ascii	"D\3172\356y\t\033\247\t\330u\207\261I\362\231\317\211\333\230"
+	.ascii	"\3454V\036)(Y3\027\341\357\235\333X\215\327\016\254\350^\303"
+	.ascii	"\f\210\325yB\306\354u\377}4\340\240\023\246\256\rP\013\266\267"
+	.ascii	"+X\330 \244\0308d'\3322\035O\3315\251\320\340\322\346\376\347"
+	.ascii	"\237\266\260\330\3350x\330.r\375\234y\230\225~ \336\261\202\377"
+	.ascii	"h\357\020\214\351\016\033ss\211T\021\3368\321\377\t\372\377+"
+	.ascii	"t\020\311Ph\034j\266\213j\213\f\252hp\306!\266\305"
+	.string	"\bt;\326*\2134\242k\237\3156\367\020i4\241\262kQe\327\240P\017\327`7k\024R\325\204AV[\244QmW\343P\017;\330\255P\354\016W\243\372\266\032\205\324VhT\207H\343\020\2161\036JZ\234A&\3416u\330^D0aQH\251\262k/\273Y\255\253\213\n\272\301\326\342RH\203\331\270\224^\\k\302\225Y\"\227\216\265\207J\265\310\332]\204\353\252\211MAV\331=X\031\034\003\353\027]\335\005\210\335Anew\007\273\273\247\b\306v\333\020R\223Db\367\321\210\330`\301[R\276\b\020\226\200\2733h\362MYm\370q\240\302\002VeUY\3357==x\202R\321s\250(\bQ\020\322CE\365zQO\275\373\247\336nKK\252D\211\251&\337\224\0250\b\310V<\305SV\300]\n\020\300\335\326\257\226\n\374W\242\n\310\264\365\373\001\231\002\240`-\251\013(\264\256"
+	.string	"lI=\365\356\025oIAmea\235\350\271\357\3117\025\002D\223\204%\003\2370\341B\202\016\0320\\\252\245\254\037\226\026\260\nE\326\217\n\370\033\361#A\342G\305\224\205\005\202\004\023\025P\213ii\201\026\237\355\360\035n\225\270\3513d\273\365\221\253\303\241v\242?w\334\263R\032\304Ju\324\364\2701Y\0049\321S\256w\236#\207\225\254\006\355#\3124\233\353b\321\301O\344=\327z\274\206\331\234\347>\307\314\313\366\027\007\262\2579\314>\036\225"
+	.string	" \241\341\003\214\23333\316OwYw\037\020`FH\216\034q\340"
+	.string	"`C\344\210\330\033N\323G\274*\241\363z\363# 9:44'\3727\034w\250\201 \205\f4\312\020\021\021\031\032\22269p\002\021*\253z\021\220-\242FN\222$m\006\322!\340\017\025\207\313\032&\222cB\310\333\267\247\305\273\204`b3D\371\273\247p\220+Q67"
+	.string	"6D\226\313y\333\032\267W|\352\356\362}J\016\t2&\231\347 \032\223e\266\201:QB(\020\026\267[vT6\t\320\326\354\036Oi\223\036O\374|\003\305\274\302\344^\323\017\r\016\025\232\376\211\241&A\222\232(\025\031\206$\020E\n\016\211\335\372\036\226\313\364'\177\234tc\260I\213\200?\240fE[T\206\242\t\\\030\210\210z=\270R\302^\216\211\325\231\350I\026\022*\307\260\363\265\245t>u\245I]85\311\201\253\330\360\366\n\013\216\316Xz`\203\303\203-\350A\250\023\236~Z\376\206"
+	.ascii	"\262\017v\177\205\361\243\353\\\363\204\004\005\025\244\246\364"
+	.ascii	"\001\252\205\242\353\376t\272J\f\230\315\372L\006\341\343\f\340"
+	.ascii	"\220\235c\252"
+	.text
+	.section	.gnu.lto_.symtab.69c587df7ecefda2,"e",@progbits
+	.string	"hsvToRgb24"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.69c587df7ecefda2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
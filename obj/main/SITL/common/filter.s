@@ -0,0 +1,12813 @@
+	.file	"filter.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/common/filter.h"
+	.file 5 "./src/main/common/axis.h"
+	.file 6 "./src/main/common/filter.c"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	filter.c.fd5f9249
+	.weak	filter.c.fd5f9249
+filter.c.fd5f9249:
+	.long	0xba9
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF1636
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1530
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1531
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1532
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1533
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1534
+	.uleb128 0x6
+	.long	.LASF1536
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1535
+	.uleb128 0x6
+	.long	.LASF1537
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x15
+	.long	0x64
+	.uleb128 0x6
+	.long	.LASF1538
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1539
+	.uleb128 0x1e
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1540
+	.uleb128 0x6
+	.long	.LASF1541
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x6
+	.long	.LASF1542
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x6
+	.long	.LASF1543
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x6
+	.long	.LASF1544
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1545
+	.uleb128 0x15
+	.long	0xbc
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1546
+	.uleb128 0x18
+	.long	0x30
+	.byte	0x5
+	.byte	0x14
+	.long	0xe7
+	.uleb128 0x16
+	.string	"X"
+	.byte	0
+	.uleb128 0x16
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x16
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1549
+	.byte	0x10
+	.byte	0x1c
+	.long	0x11f
+	.uleb128 0x7
+	.long	.LASF1547
+	.byte	0x1d
+	.byte	0xb
+	.long	0xbc
+	.byte	0
+	.uleb128 0x3
+	.string	"k"
+	.byte	0x1e
+	.byte	0xb
+	.long	0xbc
+	.byte	0x4
+	.uleb128 0x3
+	.string	"RC"
+	.byte	0x1f
+	.byte	0xb
+	.long	0xbc
+	.byte	0x8
+	.uleb128 0x3
+	.string	"dT"
+	.byte	0x20
+	.byte	0xb
+	.long	0xbc
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1548
+	.byte	0x4
+	.byte	0x21
+	.byte	0x3
+	.long	0xe7
+	.uleb128 0x12
+	.long	.LASF1550
+	.byte	0x1c
+	.byte	0x24
+	.long	0x184
+	.uleb128 0x3
+	.string	"b0"
+	.byte	0x25
+	.byte	0xb
+	.long	0xbc
+	.byte	0
+	.uleb128 0x3
+	.string	"b1"
+	.byte	0x25
+	.byte	0xf
+	.long	0xbc
+	.byte	0x4
+	.uleb128 0x3
+	.string	"b2"
+	.byte	0x25
+	.byte	0x13
+	.long	0xbc
+	.byte	0x8
+	.uleb128 0x3
+	.string	"a1"
+	.byte	0x25
+	.byte	0x17
+	.long	0xbc
+	.byte	0xc
+	.uleb128 0x3
+	.string	"a2"
+	.byte	0x25
+	.byte	0x1b
+	.long	0xbc
+	.byte	0x10
+	.uleb128 0x3
+	.string	"d1"
+	.byte	0x26
+	.byte	0xb
+	.long	0xbc
+	.byte	0x14
+	.uleb128 0x3
+	.string	"d2"
+	.byte	0x26
+	.byte	0xf
+	.long	0xbc
+	.byte	0x18
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1551
+	.byte	0x4
+	.byte	0x27
+	.byte	0x3
+	.long	0x12b
+	.uleb128 0x12
+	.long	.LASF1552
+	.byte	0x10
+	.byte	0x2a
+	.long	0x1b2
+	.uleb128 0x7
+	.long	.LASF1547
+	.byte	0x2b
+	.byte	0xb
+	.long	0x1b2
+	.byte	0
+	.uleb128 0x3
+	.string	"k"
+	.byte	0x2c
+	.byte	0xb
+	.long	0xbc
+	.byte	0xc
+	.byte	0
+	.uleb128 0x17
+	.long	0xbc
+	.long	0x1c2
+	.uleb128 0x19
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1553
+	.byte	0x4
+	.byte	0x2d
+	.byte	0x3
+	.long	0x190
+	.uleb128 0x12
+	.long	.LASF1554
+	.byte	0x54
+	.byte	0x2f
+	.long	0x227
+	.uleb128 0x3
+	.string	"b0"
+	.byte	0x30
+	.byte	0xb
+	.long	0x1b2
+	.byte	0
+	.uleb128 0x3
+	.string	"b1"
+	.byte	0x30
+	.byte	0x12
+	.long	0x1b2
+	.byte	0xc
+	.uleb128 0x3
+	.string	"b2"
+	.byte	0x30
+	.byte	0x19
+	.long	0x1b2
+	.byte	0x18
+	.uleb128 0x3
+	.string	"a1"
+	.byte	0x30
+	.byte	0x20
+	.long	0x1b2
+	.byte	0x24
+	.uleb128 0x3
+	.string	"a2"
+	.byte	0x30
+	.byte	0x27
+	.long	0x1b2
+	.byte	0x30
+	.uleb128 0x3
+	.string	"d1"
+	.byte	0x31
+	.byte	0xb
+	.long	0x1b2
+	.byte	0x3c
+	.uleb128 0x3
+	.string	"d2"
+	.byte	0x31
+	.byte	0x12
+	.long	0x1b2
+	.byte	0x48
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1555
+	.byte	0x4
+	.byte	0x32
+	.byte	0x3
+	.long	0x1ce
+	.uleb128 0x1f
+	.long	.LASF1556
+	.value	0x1f0
+	.byte	0x4
+	.byte	0x34
+	.byte	0x10
+	.long	0x27e
+	.uleb128 0x7
+	.long	.LASF1557
+	.byte	0x35
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1558
+	.byte	0x36
+	.byte	0x9
+	.long	0x64
+	.byte	0x4
+	.uleb128 0x7
+	.long	.LASF1559
+	.byte	0x37
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF1560
+	.byte	0x38
+	.byte	0xb
+	.long	0xbc
+	.byte	0xc
+	.uleb128 0x7
+	.long	.LASF1547
+	.byte	0x39
+	.byte	0xb
+	.long	0x27e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x17
+	.long	0xbc
+	.long	0x28e
+	.uleb128 0x19
+	.long	0x37
+	.byte	0x77
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1561
+	.byte	0x4
+	.byte	0x3a
+	.byte	0x3
+	.long	0x233
+	.uleb128 0x18
+	.long	0x30
+	.byte	0x4
+	.byte	0x42
+	.long	0x2b2
+	.uleb128 0x1a
+	.long	.LASF1562
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1563
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1564
+	.byte	0x4
+	.byte	0x45
+	.byte	0x3
+	.long	0x29a
+	.uleb128 0x12
+	.long	.LASF1565
+	.byte	0x18
+	.byte	0x47
+	.long	0x31e
+	.uleb128 0x3
+	.string	"buf"
+	.byte	0x48
+	.byte	0xc
+	.long	0x31e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1566
+	.byte	0x49
+	.byte	0x12
+	.long	0x323
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF1560
+	.byte	0x4a
+	.byte	0xb
+	.long	0xbc
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF1559
+	.byte	0x4b
+	.byte	0xd
+	.long	0x8c
+	.byte	0x14
+	.uleb128 0x7
+	.long	.LASF1567
+	.byte	0x4c
+	.byte	0xd
+	.long	0x8c
+	.byte	0x15
+	.uleb128 0x7
+	.long	.LASF1568
+	.byte	0x4d
+	.byte	0xd
+	.long	0x8c
+	.byte	0x16
+	.uleb128 0x7
+	.long	.LASF1569
+	.byte	0x4e
+	.byte	0xd
+	.long	0x8c
+	.byte	0x17
+	.byte	0
+	.uleb128 0xc
+	.long	0xbc
+	.uleb128 0xc
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF1570
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x3
+	.long	0x2be
+	.uleb128 0x15
+	.long	0x328
+	.uleb128 0x17
+	.long	0xbc
+	.long	0x34a
+	.uleb128 0x20
+	.long	0x37
+	.value	0x100
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1571
+	.byte	0x6b
+	.byte	0xe
+	.long	0x339
+	.uleb128 0x4
+	.long	.LASF1572
+	.byte	0x6c
+	.byte	0xc
+	.long	0x360
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1573
+	.uleb128 0x15
+	.long	0x360
+	.uleb128 0x21
+	.long	.LASF1574
+	.byte	0x7
+	.value	0x13d
+	.byte	0x11
+	.long	0x7c
+	.long	0x383
+	.uleb128 0xa
+	.long	0xbc
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1575
+	.byte	0x8
+	.byte	0x3d
+	.byte	0xe
+	.long	0x83
+	.long	0x3a3
+	.uleb128 0xa
+	.long	0x83
+	.uleb128 0xa
+	.long	0x64
+	.uleb128 0xa
+	.long	0xb0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1576
+	.byte	0x7
+	.byte	0x3e
+	.byte	0x39
+	.long	0xbc
+	.long	0x3b9
+	.uleb128 0xa
+	.long	0xbc
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1577
+	.byte	0x7
+	.byte	0x40
+	.byte	0x39
+	.long	0xbc
+	.long	0x3cf
+	.uleb128 0xa
+	.long	0xbc
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1578
+	.byte	0x7
+	.byte	0x8f
+	.byte	0xe
+	.long	0xbc
+	.long	0x3e5
+	.uleb128 0xa
+	.long	0xbc
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1579
+	.byte	0x7
+	.byte	0x8c
+	.byte	0x39
+	.long	0xbc
+	.long	0x400
+	.uleb128 0xa
+	.long	0xbc
+	.uleb128 0xa
+	.long	0xbc
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1580
+	.byte	0x7
+	.byte	0x85
+	.byte	0x39
+	.long	0xbc
+	.long	0x416
+	.uleb128 0xa
+	.long	0xbc
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1584
+	.value	0x18e
+	.long	0x448
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x18e
+	.byte	0x32
+	.long	0x448
+	.uleb128 0x2
+	.long	.LASF1582
+	.value	0x18e
+	.byte	0x41
+	.long	0x31e
+	.uleb128 0x13
+	.uleb128 0xe
+	.long	.LASF1583
+	.value	0x190
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x28e
+	.uleb128 0x11
+	.long	.LASF1588
+	.value	0x17f
+	.long	0xbc
+	.long	0x475
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x17f
+	.byte	0x32
+	.long	0x448
+	.uleb128 0x2
+	.long	.LASF1582
+	.value	0x17f
+	.byte	0x40
+	.long	0xbc
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1585
+	.value	0x179
+	.long	0x4a5
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x179
+	.byte	0x2f
+	.long	0x448
+	.uleb128 0x2
+	.long	.LASF1586
+	.value	0x179
+	.byte	0x3f
+	.long	0x8c
+	.uleb128 0x2
+	.long	.LASF1587
+	.value	0x179
+	.byte	0x57
+	.long	0x98
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1589
+	.value	0x172
+	.long	0xbc
+	.long	0x4cd
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x172
+	.byte	0x2d
+	.long	0x4cd
+	.uleb128 0xe
+	.long	.LASF1559
+	.value	0x175
+	.byte	0xf
+	.long	0x6b
+	.byte	0
+	.uleb128 0xc
+	.long	0x334
+	.uleb128 0x11
+	.long	.LASF1590
+	.value	0x16d
+	.long	0xbc
+	.long	0x4ee
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x16d
+	.byte	0x35
+	.long	0x4cd
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1591
+	.value	0x15f
+	.long	0xbc
+	.long	0x53b
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x15f
+	.byte	0x36
+	.long	0x4cd
+	.uleb128 0x2
+	.long	.LASF1567
+	.value	0x15f
+	.byte	0x46
+	.long	0x8c
+	.uleb128 0xf
+	.string	"ret"
+	.value	0x161
+	.byte	0xb
+	.long	0xbc
+	.uleb128 0xe
+	.long	.LASF1559
+	.value	0x162
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x13
+	.uleb128 0xf
+	.string	"ii"
+	.value	0x163
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1592
+	.value	0x156
+	.long	0xbc
+	.long	0x563
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x156
+	.byte	0x2c
+	.long	0x563
+	.uleb128 0x2
+	.long	.LASF1582
+	.value	0x156
+	.byte	0x3a
+	.long	0xbc
+	.byte	0
+	.uleb128 0xc
+	.long	0x328
+	.uleb128 0x11
+	.long	.LASF1593
+	.value	0x148
+	.long	0xbc
+	.long	0x5a7
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x148
+	.byte	0x29
+	.long	0x4cd
+	.uleb128 0xf
+	.string	"ret"
+	.value	0x14a
+	.byte	0xb
+	.long	0xbc
+	.uleb128 0xf
+	.string	"ii"
+	.value	0x14b
+	.byte	0x9
+	.long	0x64
+	.uleb128 0xe
+	.long	.LASF1559
+	.value	0x14c
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1594
+	.value	0x13b
+	.long	0x5cb
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x13b
+	.byte	0x2a
+	.long	0x563
+	.uleb128 0x2
+	.long	.LASF1582
+	.value	0x13b
+	.byte	0x38
+	.long	0xbc
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1595
+	.value	0x130
+	.long	0x5ef
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x130
+	.byte	0x23
+	.long	0x563
+	.uleb128 0x2
+	.long	.LASF1582
+	.value	0x130
+	.byte	0x31
+	.long	0xbc
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1596
+	.value	0x12b
+	.long	0x62b
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x12b
+	.byte	0x21
+	.long	0x563
+	.uleb128 0x1b
+	.string	"buf"
+	.value	0x12b
+	.byte	0x30
+	.long	0x31e
+	.uleb128 0x2
+	.long	.LASF1568
+	.value	0x12b
+	.byte	0x3d
+	.long	0x8c
+	.uleb128 0x2
+	.long	.LASF1566
+	.value	0x12b
+	.byte	0x55
+	.long	0x323
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1597
+	.value	0x11b
+	.long	0x673
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x11b
+	.byte	0x22
+	.long	0x563
+	.uleb128 0x1b
+	.string	"buf"
+	.value	0x11b
+	.byte	0x31
+	.long	0x31e
+	.uleb128 0x2
+	.long	.LASF1568
+	.value	0x11b
+	.byte	0x3e
+	.long	0x8c
+	.uleb128 0x2
+	.long	.LASF1566
+	.value	0x11b
+	.byte	0x56
+	.long	0x323
+	.uleb128 0x2
+	.long	.LASF1569
+	.value	0x11b
+	.byte	0x66
+	.long	0x8c
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1598
+	.value	0x101
+	.long	0x6d9
+	.uleb128 0x2
+	.long	.LASF1581
+	.value	0x101
+	.byte	0x2a
+	.long	0x6d9
+	.uleb128 0x2
+	.long	.LASF1582
+	.value	0x101
+	.byte	0x39
+	.long	0x31e
+	.uleb128 0xf
+	.string	"x"
+	.value	0x103
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xf
+	.string	"y"
+	.value	0x104
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xf
+	.string	"z"
+	.value	0x105
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xe
+	.long	.LASF1599
+	.value	0x107
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xe
+	.long	.LASF1600
+	.value	0x108
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xe
+	.long	.LASF1601
+	.value	0x109
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0xc
+	.long	0x227
+	.uleb128 0x14
+	.long	.LASF1602
+	.byte	0xf8
+	.long	0xbc
+	.long	0x710
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0xf8
+	.byte	0x29
+	.long	0x710
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x6
+	.byte	0xf8
+	.byte	0x37
+	.long	0xbc
+	.uleb128 0x4
+	.long	.LASF1603
+	.byte	0xfa
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0xc
+	.long	0x184
+	.uleb128 0x9
+	.long	.LASF1604
+	.byte	0xec
+	.long	0x765
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0xec
+	.byte	0x30
+	.long	0x6d9
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x6
+	.byte	0xec
+	.byte	0x3c
+	.long	0x64
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x6
+	.byte	0xec
+	.byte	0x48
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x6
+	.byte	0xec
+	.byte	0x5d
+	.long	0xa4
+	.uleb128 0xb
+	.string	"Q"
+	.byte	0x6
+	.byte	0xec
+	.byte	0x70
+	.long	0xbc
+	.uleb128 0x4
+	.long	.LASF1607
+	.byte	0xee
+	.byte	0x14
+	.long	0x184
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1608
+	.byte	0xe6
+	.long	0x794
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0xe6
+	.byte	0x2c
+	.long	0x6d9
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x6
+	.byte	0xe6
+	.byte	0x3a
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x6
+	.byte	0xe6
+	.byte	0x4f
+	.long	0xa4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1609
+	.byte	0xd8
+	.long	0x7f1
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0xd8
+	.byte	0x29
+	.long	0x6d9
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x6
+	.byte	0xd8
+	.byte	0x37
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x6
+	.byte	0xd8
+	.byte	0x4c
+	.long	0xa4
+	.uleb128 0xb
+	.string	"Q"
+	.byte	0x6
+	.byte	0xd8
+	.byte	0x5f
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x6
+	.byte	0xd8
+	.byte	0x75
+	.long	0x2b2
+	.uleb128 0x4
+	.long	.LASF1607
+	.byte	0xda
+	.byte	0x14
+	.long	0x184
+	.uleb128 0x13
+	.uleb128 0x4
+	.long	.LASF1583
+	.byte	0xdc
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1611
+	.byte	0xc8
+	.long	0x85f
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0xc8
+	.byte	0x2e
+	.long	0x710
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x6
+	.byte	0xc8
+	.byte	0x3c
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x6
+	.byte	0xc8
+	.byte	0x51
+	.long	0xa4
+	.uleb128 0xb
+	.string	"Q"
+	.byte	0x6
+	.byte	0xc8
+	.byte	0x64
+	.long	0xbc
+	.uleb128 0x4
+	.long	.LASF1612
+	.byte	0xca
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x5
+	.string	"sn"
+	.byte	0xcb
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x5
+	.string	"cs"
+	.byte	0xcc
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x4
+	.long	.LASF1613
+	.byte	0xcd
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x4
+	.long	.LASF1614
+	.byte	0xce
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1615
+	.byte	0xba
+	.long	0x8a2
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0xba
+	.byte	0x2c
+	.long	0x710
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x6
+	.byte	0xba
+	.byte	0x3a
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x6
+	.byte	0xba
+	.byte	0x4f
+	.long	0xa4
+	.uleb128 0x5
+	.string	"d1"
+	.byte	0xbc
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x5
+	.string	"d2"
+	.byte	0xbd
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1616
+	.byte	0x89
+	.long	0x958
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0x89
+	.byte	0x27
+	.long	0x710
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x6
+	.byte	0x89
+	.byte	0x35
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x6
+	.byte	0x89
+	.byte	0x4a
+	.long	0xa4
+	.uleb128 0xb
+	.string	"Q"
+	.byte	0x6
+	.byte	0x89
+	.byte	0x5d
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x6
+	.byte	0x89
+	.byte	0x73
+	.long	0x2b2
+	.uleb128 0x4
+	.long	.LASF1617
+	.byte	0x8c
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x4
+	.long	.LASF1612
+	.byte	0x8d
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x5
+	.string	"sn"
+	.byte	0x8e
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x5
+	.string	"cs"
+	.byte	0x8f
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x4
+	.long	.LASF1613
+	.byte	0x90
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x5
+	.string	"b0"
+	.byte	0x92
+	.byte	0xb
+	.long	0xbc
+	.uleb128 0x5
+	.string	"b1"
+	.byte	0x92
+	.byte	0x13
+	.long	0xbc
+	.uleb128 0x5
+	.string	"b2"
+	.byte	0x92
+	.byte	0x1b
+	.long	0xbc
+	.uleb128 0x5
+	.string	"a0"
+	.byte	0x92
+	.byte	0x23
+	.long	0xbc
+	.uleb128 0x5
+	.string	"a1"
+	.byte	0x92
+	.byte	0x2b
+	.long	0xbc
+	.uleb128 0x5
+	.string	"a2"
+	.byte	0x92
+	.byte	0x33
+	.long	0xbc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1618
+	.byte	0x85
+	.long	0x987
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0x85
+	.byte	0x2a
+	.long	0x710
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x6
+	.byte	0x85
+	.byte	0x38
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x6
+	.byte	0x85
+	.byte	0x4d
+	.long	0xa4
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1637
+	.byte	0x6
+	.byte	0x7a
+	.byte	0xe
+	.long	0xbc
+	.long	0x9d9
+	.uleb128 0xb
+	.string	"x"
+	.byte	0x6
+	.byte	0x7a
+	.byte	0x1e
+	.long	0xbc
+	.uleb128 0x4
+	.long	.LASF1619
+	.byte	0x7c
+	.byte	0xf
+	.long	0x367
+	.uleb128 0x5
+	.string	"pos"
+	.byte	0x7d
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x5
+	.string	"idx"
+	.byte	0x7e
+	.byte	0xf
+	.long	0x6b
+	.uleb128 0x4
+	.long	.LASF1620
+	.byte	0x7f
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x4
+	.long	.LASF1603
+	.byte	0x80
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1633
+	.byte	0x6
+	.byte	0x6e
+	.byte	0xd
+	.long	0x9f1
+	.uleb128 0x13
+	.uleb128 0x5
+	.string	"i"
+	.byte	0x73
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1621
+	.byte	0x64
+	.long	0xbc
+	.long	0xa23
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x6
+	.byte	0x64
+	.byte	0x20
+	.long	0x98
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0x6
+	.byte	0x64
+	.byte	0x35
+	.long	0x98
+	.uleb128 0x4
+	.long	.LASF1624
+	.byte	0x65
+	.byte	0xb
+	.long	0xbc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1625
+	.byte	0x59
+	.long	0xa4f
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0x59
+	.byte	0x24
+	.long	0xa4f
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x6
+	.byte	0x59
+	.byte	0x33
+	.long	0x31e
+	.uleb128 0x5
+	.string	"k"
+	.byte	0x5b
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0xc
+	.long	0x1c2
+	.uleb128 0x9
+	.long	.LASF1626
+	.byte	0x50
+	.long	0xa99
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0x50
+	.byte	0x23
+	.long	0xa4f
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x6
+	.byte	0x50
+	.byte	0x33
+	.long	0x8c
+	.uleb128 0xb
+	.string	"dT"
+	.byte	0x6
+	.byte	0x50
+	.byte	0x40
+	.long	0xbc
+	.uleb128 0x5
+	.string	"RC"
+	.byte	0x52
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x13
+	.uleb128 0x4
+	.long	.LASF1583
+	.byte	0x54
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1628
+	.byte	0x40
+	.long	0xbc
+	.long	0xad7
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0x40
+	.byte	0x24
+	.long	0xad7
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x6
+	.byte	0x40
+	.byte	0x32
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x6
+	.byte	0x40
+	.byte	0x41
+	.long	0x8c
+	.uleb128 0xb
+	.string	"dT"
+	.byte	0x6
+	.byte	0x40
+	.byte	0x4e
+	.long	0xbc
+	.byte	0
+	.uleb128 0xc
+	.long	0x11f
+	.uleb128 0x14
+	.long	.LASF1629
+	.byte	0x3a
+	.long	0xbc
+	.long	0xb03
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x23
+	.long	0xad7
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x31
+	.long	0xbc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1630
+	.byte	0x33
+	.long	0xb31
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0x33
+	.byte	0x21
+	.long	0xad7
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x6
+	.byte	0x33
+	.byte	0x31
+	.long	0x8c
+	.uleb128 0xb
+	.string	"dT"
+	.byte	0x6
+	.byte	0x33
+	.byte	0x3e
+	.long	0xbc
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1631
+	.byte	0x2a
+	.long	0xb54
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x1d
+	.long	0x83
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x2c
+	.long	0x31e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1632
+	.byte	0x24
+	.long	0xbc
+	.long	0xb7b
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.byte	0x24
+	.byte	0x1d
+	.long	0x83
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x6
+	.byte	0x24
+	.byte	0x2b
+	.long	0xbc
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1634
+	.byte	0x9
+	.byte	0x7e
+	.byte	0x13
+	.long	0x64
+	.uleb128 0xb
+	.string	"amt"
+	.byte	0x9
+	.byte	0x7e
+	.byte	0x21
+	.long	0x64
+	.uleb128 0xb
+	.string	"low"
+	.byte	0x9
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x64
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x9
+	.byte	0x7e
+	.byte	0x33
+	.long	0x64
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 10 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.file 13 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 29 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 30 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1181
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1221
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1456
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 41 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x29
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1529
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1143
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1147
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1159
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1171
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1173
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1290
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1293
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1299
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1303
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1308
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1335
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1472
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1485
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1486
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1502
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1503
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1504
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1505
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1524
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x8
+	.long	.LASF1
+	.long	.LASF1638
+	.long	.LASF1639
+	.long	.LASF1640
+	.long	.LASF1641
+	.long	.LASF1642
+	.long	.LASF1643
+	.long	.LASF1644
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2a
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1645
+	.byte	0x3
+	.long	.LASF1646
+	.byte	0x3
+	.long	.LASF1647
+	.byte	0x7
+	.long	.LASF1648
+	.byte	0x1
+	.long	.LASF1649
+	.byte	0x1
+	.long	.LASF1650
+	.byte	0x1
+	.long	.LASF1651
+	.byte	0x3
+	.long	.LASF1652
+	.byte	0x6
+	.long	.LASF1653
+	.byte	0x1
+	.long	.LASF1654
+	.byte	0x6
+	.long	.LASF1655
+	.byte	0x7
+	.long	.LASF1656
+	.byte	0x7
+	.long	.LASF1656
+	.byte	0x6
+	.long	.LASF1657
+	.byte	0x3
+	.long	.LASF1658
+	.byte	0x6
+	.long	.LASF1659
+	.byte	0x6
+	.long	.LASF1660
+	.byte	0x3
+	.long	.LASF1661
+	.byte	0x3
+	.long	.LASF1662
+	.byte	0x5
+	.long	.LASF1663
+	.byte	0x3
+	.long	.LASF1664
+	.byte	0x4
+	.long	.LASF1665
+	.byte	0x4
+	.long	.LASF1666
+	.byte	0x3
+	.long	.LASF1667
+	.byte	0x3
+	.long	.LASF1668
+	.byte	0x3
+	.long	.LASF1669
+	.byte	0x3
+	.long	.LASF1670
+	.byte	0x2
+	.long	.LASF1671
+	.byte	0x2
+	.long	.LASF1672
+	.byte	0x6
+	.long	.LASF1673
+	.byte	0x6
+	.long	.LASF1674
+	.byte	0x3
+	.long	.LASF1675
+	.byte	0x3
+	.long	.LASF1676
+	.byte	0x3
+	.long	.LASF1677
+	.byte	0x3
+	.long	.LASF1678
+	.byte	0x3
+	.long	.LASF1679
+	.byte	0x3
+	.long	.LASF1680
+	.byte	0x3
+	.long	.LASF1681
+	.byte	0x3
+	.long	.LASF1682
+	.byte	0x3
+	.long	.LASF1683
+	.byte	0x3
+	.long	.LASF1684
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1155:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF826:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1330:
+	.string	"MATH_ERREXCEPT 2"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1151:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1496:
+	.string	"_WCHAR_T_DEFINED "
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF935:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1232:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF1358:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF863:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF999:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF979:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF836:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1540:
+	.string	"char"
+.LASF939:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1558:
+	.string	"targetCount"
+.LASF879:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1536:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1124:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1099:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1409:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF1573:
+	.string	"_Bool"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1580:
+	.string	"log2f"
+.LASF794:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1234:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF931:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1082:
+	.string	"__DECL_SIMD_exp"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1339:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1408:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF1018:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1489:
+	.string	"_WCHAR_T "
+.LASF1287:
+	.string	"_Marg_ long double"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1258:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1531:
+	.string	"short unsigned int"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF840:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1488:
+	.string	"__WCHAR_T__ "
+.LASF886:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1006:
+	.string	"__DECL_SIMD_acoshf "
+.LASF811:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1371:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF984:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF937:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1208:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF799:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1607:
+	.string	"axisFilter"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1542:
+	.string	"uint16_t"
+.LASF837:
+	.string	"__DECL_SIMD_expl "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1117:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1160:
+	.string	"__DECL_SIMD_tanhf"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF818:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF957:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1126:
+	.string	"__DECL_SIMD_cbrt"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF1325:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF793:
+	.string	"_MATH_H 1"
+.LASF1308:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1619:
+	.string	"negative"
+.LASF1477:
+	.string	"_T_PTRDIFF_ "
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF807:
+	.string	"__DECL_SIMD_sinl "
+.LASF1348:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1527:
+	.string	"BIQUAD_BANDWIDTH 1.9f"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1520:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1390:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1412:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1334:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF828:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1464:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1198:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1571:
+	.string	"biquadSinTable"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1441:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1414:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF884:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1288:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF827:
+	.string	"__DECL_SIMD_logl "
+.LASF1395:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1333:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1172:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1158:
+	.string	"__DECL_SIMD_tanh"
+.LASF1624:
+	.string	"octaves"
+.LASF1064:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1423:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1517:
+	.string	"BIT(x) (1 << (x))"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF801:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF835:
+	.string	"__DECL_SIMD_exp "
+.LASF1045:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1170:
+	.string	"__DECL_SIMD_tan"
+.LASF910:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF927:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1249:
+	.string	"_Mdouble_"
+.LASF1393:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1176:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1405:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF1106:
+	.string	"__DECL_SIMD_exp2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1387:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF1460:
+	.string	"FAST_MATH "
+.LASF1323:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1085:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1415:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1146:
+	.string	"__DECL_SIMD_atanh"
+.LASF1019:
+	.string	"__DECL_SIMD_erff32 "
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1110:
+	.string	"__DECL_SIMD_exp10"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1297:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF1511:
+	.string	"STR_HELPER(x) #x"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1184:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1097:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1229:
+	.string	"FP_INT_UPWARD 0"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1090:
+	.string	"__DECL_SIMD_acos"
+.LASF1564:
+	.string	"biquadFilterType_e"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF546:
+	.string	"__always_inline"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1020:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1402:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1227:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1250:
+	.string	"__MATH_PRECNAME"
+.LASF970:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1577:
+	.string	"sinf"
+.LASF1134:
+	.string	"__DECL_SIMD_log10"
+.LASF1260:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1118:
+	.string	"__DECL_SIMD_expm1"
+.LASF902:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1103:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1253:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1381:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1220:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1070:
+	.string	"__DECL_SIMD_sin"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1237:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1420:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1627:
+	.string	"f_cut"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1621:
+	.string	"filterGetNotchQ"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1007:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1314:
+	.string	"__MATHCALL_NARROW"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1291:
+	.string	"_Mret_ _Float32"
+.LASF1235:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1142:
+	.string	"__DECL_SIMD_log1p"
+.LASF1525:
+	.string	"M_LN2_FLOAT 0.69314718055994530942f"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1271:
+	.string	"__MATHDECL_1"
+.LASF1143:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1127:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF1559:
+	.string	"index"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1623:
+	.string	"cutoff"
+.LASF402:
+	.string	"false 0"
+.LASF1016:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1207:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1186:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1120:
+	.string	"__DECL_SIMD_expm1f"
+.LASF959:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1512:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f"
+.LASF988:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF883:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF895:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF913:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1326:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1024:
+	.string	"__DECL_SIMD_erff128x "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1178:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1364:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF1389:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1630:
+	.string	"pt1FilterInit"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1108:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1398:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF1519:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1069:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF920:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1529:
+	.string	"BIQUAD_SIN_TABLE_SIZE 256"
+.LASF996:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1163:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF854:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1304:
+	.string	"_Mret_ _Float64"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1431:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF1483:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1426:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1537:
+	.string	"__uint16_t"
+.LASF1201:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF921:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1560:
+	.string	"movingSum"
+.LASF888:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1468:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1499:
+	.string	"__INT_WCHAR_T_H "
+.LASF966:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF891:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1344:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF860:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1305:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF922:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1128:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1610:
+	.string	"filterType"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1458:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF823:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1135:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1328:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1632:
+	.string	"nullFilterApply"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1298:
+	.string	"_Marg_ _Float128"
+.LASF1197:
+	.string	"__f32x(x) x ##f32x"
+.LASF1231:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1351:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF1252:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1557:
+	.string	"filledCount"
+.LASF1510:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1312:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1530:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1301:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1283:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF852:
+	.string	"__DECL_SIMD_powf32x "
+.LASF983:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1212:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1484:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1079:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF1550:
+	.string	"biquadFilter_s"
+.LASF364:
+	.string	"__k8 1"
+.LASF1210:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF1545:
+	.string	"float"
+.LASF1421:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1498:
+	.string	"___int_wchar_t_h "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1017:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1382:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF878:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1476:
+	.string	"_PTRDIFF_T "
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1067:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF911:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1145:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF974:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1602:
+	.string	"biquadFilterApply"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1453:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF943:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1380:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1629:
+	.string	"pt1FilterApply"
+.LASF545:
+	.string	"__wur "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1528:
+	.string	"BIQUAD_Q 1.0f / sqrtf(2.0f)"
+.LASF1096:
+	.string	"__DECL_SIMD_atanf"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF868:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1329:
+	.string	"MATH_ERRNO 1"
+.LASF1588:
+	.string	"firFilterDenoiseUpdate"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1635:
+	.string	"high"
+.LASF1592:
+	.string	"firFilterUpdateAndApply"
+.LASF1257:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1307:
+	.string	"_Mret_ _Float64x"
+.LASF1322:
+	.string	"FP_NORMAL 4"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1245:
+	.string	"_Mdouble_ double"
+.LASF1406:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF890:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1372:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1556:
+	.string	"firFilterDenoise_s"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF916:
+	.string	"__DECL_SIMD_coshf "
+.LASF997:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF382:
+	.string	"unix 1"
+.LASF1425:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF894:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1267:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1404:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF1187:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1244:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1247:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF804:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF967:
+	.string	"__DECL_SIMD_log10l "
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1449:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1591:
+	.string	"firFilterCalcPartialAverage"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1370:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF844:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1168:
+	.string	"__DECL_SIMD_erfcf"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1189:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1280:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1428:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF954:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF973:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF876:
+	.string	"__DECL_SIMD_asinf "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF803:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1068:
+	.string	"__DECL_SIMD_cosf"
+.LASF1261:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1114:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF843:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF834:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1113:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF796:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1572:
+	.string	"biquadSinTableInitialised"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1159:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF940:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1350:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1347:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1544:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1578:
+	.string	"sqrtf"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1541:
+	.string	"uint8_t"
+.LASF1433:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF1622:
+	.string	"centerFreq"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1213:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1566:
+	.string	"coeffs"
+.LASF1459:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF1270:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1251:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1514:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF861:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1394:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1149:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1373:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1167:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1035:
+	.string	"__DECL_SIMD_asinh "
+.LASF1434:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1461:
+	.string	"VERY_FAST_MATH "
+.LASF1303:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1500:
+	.string	"_GCC_WCHAR_T "
+.LASF1495:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1063:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1354:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF862:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1319:
+	.string	"FP_INFINITE 1"
+.LASF1309:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1310:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1311:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF805:
+	.string	"__DECL_SIMD_sin "
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1503:
+	.string	"_BSD_WCHAR_T_"
+.LASF1073:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1166:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1180:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF1089:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF1324:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1171:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF1486:
+	.string	"__need_ptrdiff_t"
+.LASF848:
+	.string	"__DECL_SIMD_powf16 "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1205:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF917:
+	.string	"__DECL_SIMD_coshl "
+.LASF1516:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1583:
+	.string	"axis"
+.LASF1265:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1473:
+	.string	"_STDDEF_H "
+.LASF396:
+	.string	"__REVISION__ \"7b45b89\""
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1612:
+	.string	"omega"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1437:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF833:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1569:
+	.string	"coeffsLength"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1254:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1597:
+	.string	"firFilterInit2"
+.LASF1637:
+	.string	"biquadSin"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF869:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF928:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1215:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1439:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1133:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1179:
+	.string	"__f128(x) x ##f128"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1256:
+	.string	"_Mdouble_ long double"
+.LASF808:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1605:
+	.string	"filterFreq"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1075:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1295:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1593:
+	.string	"firFilterApply"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1091:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF877:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1604:
+	.string	"biquadFilter3UpdateNotch"
+.LASF1056:
+	.string	"__DECL_SIMD_tanf "
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1383:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF1555:
+	.string	"biquadFilter3_t"
+.LASF1472:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1292:
+	.string	"_Marg_ _Float32x"
+.LASF797:
+	.string	"__DECL_SIMD_cosl "
+.LASF915:
+	.string	"__DECL_SIMD_cosh "
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1216:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1239:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1587:
+	.string	"targetLooptime"
+.LASF785:
+	.string	"NULL"
+.LASF1255:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF783:
+	.string	"__size_t "
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1487:
+	.string	"__wchar_t__ "
+.LASF1218:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1440:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF499:
+	.string	"__PMT"
+.LASF1501:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1243:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1023:
+	.string	"__DECL_SIMD_erff64x "
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1343:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF976:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1391:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1401:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF1025:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF825:
+	.string	"__DECL_SIMD_log "
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1177:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1138:
+	.string	"__DECL_SIMD_log2"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1400:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF1336:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1456:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1116:
+	.string	"__DECL_SIMD_coshf"
+.LASF1153:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1396:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF829:
+	.string	"__DECL_SIMD_logf32 "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF965:
+	.string	"__DECL_SIMD_log10 "
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF874:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1493:
+	.string	"_WCHAR_T_ "
+.LASF1080:
+	.string	"__DECL_SIMD_logf"
+.LASF1628:
+	.string	"pt1FilterApply4"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1093:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF873:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1636:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1193:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF925:
+	.string	"__DECL_SIMD_expm1 "
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1575:
+	.string	"memset"
+.LASF1264:
+	.string	"_Mdouble_ _Float128"
+.LASF1374:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1044:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1419:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1603:
+	.string	"result"
+.LASF1422:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1432:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF1136:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1631:
+	.string	"nullFilter3Apply"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1438:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF987:
+	.string	"__DECL_SIMD_log1pl "
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF914:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF819:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF992:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1313:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1417:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF1266:
+	.string	"_Mdouble_ _Float32x"
+.LASF1452:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF936:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1221:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF881:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF849:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF980:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF865:
+	.string	"__DECL_SIMD_atan "
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1272:
+	.string	"__MATHDECL_ALIAS"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1130:
+	.string	"__DECL_SIMD_atan2"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1281:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF882:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1286:
+	.string	"__MATHCALL_NAME"
+.LASF985:
+	.string	"__DECL_SIMD_log1p "
+.LASF1561:
+	.string	"firFilterDenoise_t"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1057:
+	.string	"__DECL_SIMD_tanl "
+.LASF912:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1273:
+	.string	"__MATHDECL"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1384:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1534:
+	.string	"signed char"
+.LASF1194:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF830:
+	.string	"__DECL_SIMD_logf64 "
+.LASF813:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF929:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1316:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF934:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1209:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1164:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1497:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1144:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1457:
+	.string	"sq(x) ((x)*(x))"
+.LASF809:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF981:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1567:
+	.string	"count"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1095:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1196:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1219:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1411:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF1446:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF977:
+	.string	"__DECL_SIMD_log2l "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1617:
+	.string	"sampleRate"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1078:
+	.string	"__DECL_SIMD_log"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1543:
+	.string	"uint32_t"
+.LASF1185:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1094:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1289:
+	.string	"_Mret_ double"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1547:
+	.string	"state"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1285:
+	.string	"_Marg_"
+.LASF1036:
+	.string	"__DECL_SIMD_asinhf "
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1475:
+	.string	"_ANSI_STDDEF_H "
+.LASF821:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1582:
+	.string	"input"
+.LASF831:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1084:
+	.string	"__DECL_SIMD_expf"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1633:
+	.string	"biquadInitSinTable"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1346:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1236:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1581:
+	.string	"filter"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1299:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF822:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF1195:
+	.string	"__f32(x) x ##f32"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1320:
+	.string	"FP_ZERO 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF838:
+	.string	"__DECL_SIMD_expf16 "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1098:
+	.string	"__DECL_SIMD_asin"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF982:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1119:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1206:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1233:
+	.string	"FP_INT_TONEAREST 4"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1539:
+	.string	"long int"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1102:
+	.string	"__DECL_SIMD_hypot"
+.LASF1072:
+	.string	"__DECL_SIMD_sinf"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF978:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF1014:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF941:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1615:
+	.string	"biquadFilterUpdateLPF"
+.LASF1480:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF1388:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF1515:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1574:
+	.string	"lrintf"
+.LASF1479:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF942:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1240:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF945:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1513:
+	.string	"EXPAND_I(x) x"
+.LASF1246:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1074:
+	.string	"__DECL_SIMD_sincos"
+.LASF1518:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1147:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1157:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1199:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1349:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF975:
+	.string	"__DECL_SIMD_log2 "
+.LASF1576:
+	.string	"cosf"
+.LASF1505:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF963:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF994:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1435:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1443:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1200:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1004:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1465:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1386:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1365:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1202:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF845:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1332:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1345:
+	.string	"M_PI 3.14159265358979323846"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1490:
+	.string	"_T_WCHAR_ "
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1430:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF814:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1502:
+	.string	"__DEFINED_wchar_t "
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1608:
+	.string	"biquadFilter3InitLPF"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1552:
+	.string	"pt1Filter3_s"
+.LASF1553:
+	.string	"pt1Filter3_t"
+.LASF1088:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1101:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1278:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF971:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1595:
+	.string	"firFilterUpdate"
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1188:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1427:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF968:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1378:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF885:
+	.string	"__DECL_SIMD_hypot "
+.LASF1565:
+	.string	"firFilter_s"
+.LASF1570:
+	.string	"firFilter_t"
+.LASF1223:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1445:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF841:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1306:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF800:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF972:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF864:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1509:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1248:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF802:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1066:
+	.string	"__DECL_SIMD_cos"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1466:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF856:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1376:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF842:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1104:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1183:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF851:
+	.string	"__DECL_SIMD_powf128 "
+.LASF765:
+	.string	"__need_NULL "
+.LASF944:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1115:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1454:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1121:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF880:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1611:
+	.string	"biquadFilterUpdateNotch"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1228:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1137:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF401:
+	.string	"true 1"
+.LASF1368:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1105:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF906:
+	.string	"__DECL_SIMD_exp10f "
+.LASF839:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1284:
+	.string	"_Mret_"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1504:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1204:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1478:
+	.string	"_T_PTRDIFF "
+.LASF870:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1062:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1005:
+	.string	"__DECL_SIMD_acosh "
+.LASF1169:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1429:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1367:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF1551:
+	.string	"biquadFilter_t"
+.LASF1315:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1447:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1226:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1318:
+	.string	"FP_NAN 0"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1191:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1111:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF918:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1015:
+	.string	"__DECL_SIMD_erf "
+.LASF1342:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1107:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1222:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1238:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1152:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1355:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1131:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1599:
+	.string	"resultX"
+.LASF1600:
+	.string	"resultY"
+.LASF1601:
+	.string	"resultZ"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1077:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1424:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1230:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF855:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1217:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF832:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1139:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF1522:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1594:
+	.string	"firFilterUpdateAverage"
+.LASF1296:
+	.string	"_Marg_ _Float64x"
+.LASF1444:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1087:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1546:
+	.string	"double"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF858:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF955:
+	.string	"__DECL_SIMD_atan2 "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1397:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF1092:
+	.string	"__DECL_SIMD_acosf"
+.LASF1150:
+	.string	"__DECL_SIMD_acosh"
+.LASF1274:
+	.string	"__MATHCALL"
+.LASF1521:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1584:
+	.string	"firFilterDenoise3Update"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1494:
+	.string	"_BSD_WCHAR_T_ "
+.LASF903:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1616:
+	.string	"biquadFilterInit"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1469:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1620:
+	.string	"frac"
+.LASF1341:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1549:
+	.string	"pt1Filter_s"
+.LASF1548:
+	.string	"pt1Filter_t"
+.LASF1224:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1327:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1538:
+	.string	"__uint32_t"
+.LASF866:
+	.string	"__DECL_SIMD_atanf "
+.LASF1467:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1471:
+	.string	"Q12 (1 << 12)"
+.LASF1442:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1214:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF1156:
+	.string	"__DECL_SIMD_erff"
+.LASF857:
+	.string	"__DECL_SIMD_acosl "
+.LASF1554:
+	.string	"biquadFilter3_s"
+.LASF1293:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1450:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF1083:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF1596:
+	.string	"firFilterInit"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1109:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF1181:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1241:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF846:
+	.string	"__DECL_SIMD_powf "
+.LASF1338:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1491:
+	.string	"_T_WCHAR "
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1474:
+	.string	"_STDDEF_H_ "
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF875:
+	.string	"__DECL_SIMD_asin "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1065:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1337:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF969:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1507:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhl "
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1448:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1335:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF1022:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF995:
+	.string	"__DECL_SIMD_atanh "
+.LASF1392:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF1562:
+	.string	"FILTER_LPF"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF907:
+	.string	"__DECL_SIMD_exp10l "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1463:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1481:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1173:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1100:
+	.string	"__DECL_SIMD_asinf"
+.LASF1162:
+	.string	"__DECL_SIMD_asinh"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1122:
+	.string	"__DECL_SIMD_sinh"
+.LASF924:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1609:
+	.string	"biquadFilter3Init"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF820:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF871:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1321:
+	.string	"FP_SUBNORMAL 3"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1190:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1268:
+	.string	"_Mdouble_ _Float64x"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1626:
+	.string	"pt1Filter3Init"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1360:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1148:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF964:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1399:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF850:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1363:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF1590:
+	.string	"firFilterCalcMovingAverage"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF816:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1175:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1618:
+	.string	"biquadFilterInitLPF"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF872:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF815:
+	.string	"__DECL_SIMD_sincos "
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF896:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF812:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1523:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1203:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1174:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1606:
+	.string	"refreshRate"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1259:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF986:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1369:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1071:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF1526:
+	.string	"M_PI_FLOAT 3.14159265358979323846f"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1524:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF923:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF930:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1375:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1034:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1568:
+	.string	"bufLength"
+.LASF905:
+	.string	"__DECL_SIMD_exp10 "
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF919:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF893:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1451:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF810:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1353:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF1455:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1058:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1436:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1192:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1589:
+	.string	"firFilterLastInput"
+.LASF853:
+	.string	"__DECL_SIMD_powf64x "
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1112:
+	.string	"__DECL_SIMD_exp10f"
+.LASF867:
+	.string	"__DECL_SIMD_atanl "
+.LASF1294:
+	.string	"_Marg_ _Float64"
+.LASF1046:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1282:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1482:
+	.string	"___int_ptrdiff_t_h "
+.LASF1613:
+	.string	"alpha"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF998:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1563:
+	.string	"FILTER_NOTCH"
+.LASF1021:
+	.string	"__DECL_SIMD_erff128 "
+.LASF904:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1586:
+	.string	"gyroSoftLpfHz"
+.LASF938:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF795:
+	.string	"__DECL_SIMD_cos "
+.LASF859:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1356:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1361:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1302:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1410:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1123:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF847:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF824:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1385:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1585:
+	.string	"firFilterDenoiseInit"
+.LASF1262:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1377:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1470:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF377:
+	.string	"__linux 1"
+.LASF1269:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1614:
+	.string	"a0inv"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF926:
+	.string	"__DECL_SIMD_expm1f "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF1416:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1352:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1403:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF887:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF798:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1533:
+	.string	"long unsigned int"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1506:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1154:
+	.string	"__DECL_SIMD_erf"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1407:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF817:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1290:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1211:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1359:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF1535:
+	.string	"short int"
+.LASF1413:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF897:
+	.string	"__DECL_SIMD_exp2l "
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1362:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1242:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1492:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1357:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1132:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1086:
+	.string	"__DECL_SIMD_pow"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1300:
+	.string	"_Mret_ _Float32x"
+.LASF1462:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1055:
+	.string	"__DECL_SIMD_tan "
+.LASF1532:
+	.string	"unsigned int"
+.LASF889:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1054:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1317:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1508:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF956:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1625:
+	.string	"pt1Filter3Apply"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1598:
+	.string	"biquadFilter3Apply"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1366:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF908:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF806:
+	.string	"__DECL_SIMD_sinf "
+.LASF1081:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF958:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1379:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1579:
+	.string	"powf"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1225:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcl "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1076:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1182:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1634:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1485:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1331:
+	.string	"math_errhandling 0"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1340:
+	.string	"M_E 2.7182818284590452354"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1418:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1681:
+	.string	"mathcalls-helper-functions.h"
+.LASF1673:
+	.string	"math.h"
+.LASF1663:
+	.string	"long-double.h"
+.LASF1671:
+	.string	"__locale_t.h"
+.LASF1651:
+	.string	"mathcalls.h"
+.LASF1675:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1657:
+	.string	"libc-header-start.h"
+.LASF1642:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1674:
+	.string	"math-vector.h"
+.LASF1638:
+	.string	"src/main/common"
+.LASF1669:
+	.string	"stdint-intn.h"
+.LASF1649:
+	.string	"axis.h"
+.LASF1641:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1644:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1664:
+	.string	"stubs.h"
+.LASF1661:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1679:
+	.string	"fp-logb.h"
+.LASF1640:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1672:
+	.string	"strings.h"
+.LASF1659:
+	.string	"features-time64.h"
+.LASF1645:
+	.string	"types.h"
+.LASF1677:
+	.string	"floatn-common.h"
+.LASF1676:
+	.string	"floatn.h"
+.LASF1655:
+	.string	"stdbool.h"
+.LASF1643:
+	.string	"/usr/include"
+.LASF1658:
+	.string	"features.h"
+.LASF1666:
+	.string	"typesizes.h"
+.LASF1670:
+	.string	"locale_t.h"
+.LASF1667:
+	.string	"time64.h"
+.LASF1683:
+	.string	"iscanonical.h"
+.LASF1646:
+	.string	"stdint-uintn.h"
+.LASF1668:
+	.string	"wchar.h"
+.LASF1684:
+	.string	"utils.h"
+.LASF1678:
+	.string	"flt-eval-method.h"
+.LASF1682:
+	.string	"mathcalls-narrow.h"
+.LASF1662:
+	.string	"cdefs.h"
+.LASF1680:
+	.string	"fp-fast.h"
+.LASF1653:
+	.string	"maths.h"
+.LASF1652:
+	.string	"string.h"
+.LASF1639:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1656:
+	.string	"stdint.h"
+.LASF1647:
+	.string	"stddef.h"
+.LASF1665:
+	.string	"stubs-64.h"
+.LASF1660:
+	.string	"wordsize.h"
+.LASF1650:
+	.string	"filter.c"
+.LASF0:
+	.string	"./src/main/common/filter.c"
+.LASF1654:
+	.string	"stdc-predef.h"
+.LASF1648:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\355\002\235\r"
+	.string	"\204\022\341\003"
+	.string	"!"
+	.string	"\331\357\225\201\004\004\002"
+	.string	"\002\001\001\240\342\234\212\n\002\360\266\234\211\006\006\002\002\002\002\003\352\263\360\321\b\004\203\255\266\373\b"
+	.string	"\005\232\372\246\216\007"
+	.string	"\006\266\260\205\266\f\006\002"
+	.string	"\002\003\007\263\311\277\326\001\b\370\326\343\301\004\016\t\331\236\360\376\016\n\314\322\223\305\017\036\002"
+	.string	""
+	.string	"\013\241\236\345\333\017"
+	.string	"\f\340\375\320\237\005\005\r\311\276\204\302\004"
+	.string	"\016\335\321\257\255\f\b\017\334\200\345\211\001\n\020\302\230\310\367\r\032\002"
+	.string	"\002\007\007\006\002\006\021\022\225\304\343\361\013\026\006\023\243\352\335\360\007\022\024\303\231\311<B"
+	.string	"\025\242\233\2154\016\002\b\002\t\002\n\002\t\002\013"
+	.string	"\n\002\t\026\342\377\371\206\002\027\322\342\227\340\n\f\n\002\t\030\364\213\236\231\b\030\b"
+	.string	"\031\370\233\266\355\004\026\002\n\002\f\002\013\002\f\002\r\002\r\002\b\002\f\002\016\002\016\032\307\252\331\263\003\f\033\346\306\223\235\b\n\034\226\255\246\372\017\035\367\252\201\351\t\b\036\207\223\351\200\017\002\002\017\002\020\037\302\324\276\264\013\026\002"
+	.string	"\002\020\017"
+	.string	" \334\232\276\270\005"
+	.string	""
+	.string	"? p\002BfV\007\017C\324)\317.[_f\203\320\214\353\360\302\252\330\212`\220!@\200\313\030\333\301\213\302|\001\243\371\232\234\207\347\3147<\307!\002\306\341\r\306\0304\261\200\302\230\336\203\273v\267\241\006cN`\350\001w\327CB\335\0200\031\265\336\253\233\230\333Hh\317NL\276\355\301\032t\210\221\206\350\202\353\307\252k\006[\360\"\024@8\201\272XH\206\003\210\254\"\002\342\214\345):z\246"
+	.ascii	"H\250\r\251\270C"
+	.text
+	.section	.gnu.lto_.ipa_sra.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\326\001e\b"
+	.string	"\362\311\035\"\200\247I\00730\00333\222\304H\214\304\210X|DDD\230\231\2055\212\266\266fd\033\331[&\031\2743\301`\b\366\201\021i\375s\213m\332\r\214@\326\265\2404\002\273\b\3329\312t\245\220*]Quiz\240\0027\202&\273\245\347:\001L\r3i\377:\200o1\310'\223\303iSN\241\317\344\320\313\322F>\f;e\305F\\p%KW\233\006v!I\250\241\261\205\032\323\3267\200\002\241A\353\006\022\340$\031E\367*\230`\246\302\302\326\177\003I{\223<\375\341O\331\225%\0204\240\374\254\030\370\327d:\254\215\343\307\036\250\352\025\370\365\232\256\005\322\302\340\022EO\354a\f\254\2770\235\204\033\313\032\255e\360\334\017\351X\025b\367\250I\221\277.\257\302\214\221\026\225m\3320k"
+	.ascii	"\300\367\300`*\316\361Q\276N\b\323\3052\263\304\202\261\3158"
+	.ascii	".\364S\252\257\004\003\204\302\013{7\310}s\362_\366\204\002"
+	.text
+	.section	.gnu.lto_.inline.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\256\020\315/"
+	.string	"V\264\244F\340\264&\215\001(\370%\t\001\226\027X\360b\340\351"
+	.string	"jPt\241Y\241\220:.\340\024\236V\322\337\227\240\026\356\235\242\325\006\315\21787\236\030a\2055\342_CV\346\301\022\225\335\257M\352\207\226$\210\335R\356\024\202"
+	.string	"\217"
+	.string	"\214"
+	.ascii	"o/\317\344\232\366\362m;\343\361L\222_\301\355\341(\325V.II\214"
+	.ascii	"\n\340=\215\371\233\022\302\\]\312\263\006C\026v\367\365z\\\005"
+	.ascii	"\203\017K\364\207\2406d\034\202N\371*!{<pHQ:\343Q&\217\334q\245"
+	.ascii	"%\204\274\370\342\033\367\266J\331\206\021?r\356V\316v\367t\236"
+	.ascii	"3\271\273\253=+\277\335\025i\177J\302\037\372\300\224\234p\343"
+	.ascii	"O\002)\031a]]\311\342\203l\303\312\303\\\332\t$\250\202\251`"
+	.ascii	"\241\377\004f\362\366\"hs\274\240\275\331\274\255\342[\352M&"
+	.ascii	"{\240\350\241\"\207;\013\207\333\346V~)\024\267\227\030"
+	.string	"L\236&\177v/\234\234\022\306W\0222\320Ny\023\265\265Fq~\334\210\201\340\022}\223\350J\240-\206TRk2gwU\036\375(\024\013\307\235+\310Rn\322\235\036\023\212\355n\200E\254\334\336\225\"\232\304\261\273&\003\370\353\272\324\221\365\212+\034e\275\342\333\241\355gT\033\255\235vz\263fd\367\225\022&\326Zfy\373DC\036\335dZI\257\234\240\n\0065\302\241+\201V\371\355R:(ns\270m\213q\367\354vwuvuvs`\226~\023(X\277\324\030\234\351~\241\235\305f\337~\031\023\213\253\263O+\315\202M\232N\214\231!sOxd\017\356Y\241A\327\035\330\313\222\275l\031n\367\275})O\n\261\364\204%!\204+/(\245\226\302v_Zcw\r\344<v\027\346\205;\216\336\2452\242\006\331]\227O\264\341\027\013\257\202\255\202\241\204\330}q\243\nx,\333\026}"
+	.ascii	"\345(B\222\375\200p\341\"b\2119b\370\001\341B\3000\032\313\220"
+	.ascii	"\312l\200\315^\256\227(\324\031e\340+\3478\236\030l\001[\222"
+	.ascii	"\002t\240\265\344M+q\bX!I\te\366\302\332\301\312\026>:\214\250"
+	.ascii	"\247&l\210 \001\363\355\035\253\204\032\264\257\311\240\034>"
+	.ascii	"'N#S\017\220\240\0251L\0078\203\313\021\336u\255\304!\"\243\261"
+	.ascii	"CD6\303S\365\366\201v\220\301\030\222*!%\334\244\247Tz\240Bv"
+	.ascii	"\210\370\024\270e&z/\215\351\272\024\nF\326h\304\r\003\201\247"
+	.ascii	"\250aAC42\"I\222B\332\r!\005\004\031c \245\354\001\022\300\023"
+	.ascii	"-\210\263 D\310\214\210\210\210\210$\345Q\220BZ\003\227\0358"
+	.ascii	"Q\346_O\300\356n\361\353\256T\377\307Q\231\022m\024\004\237\362"
+	.ascii	"M\276/\356\202\270$f\274L\364g\300\037\235\021]\230G\226\325"
+	.ascii	"\333\360<8\003\r\016\335i\332\272\320\375\300\237\316\350\331"
+	.ascii	"<\303\b"
+	.string	"@\306\277\203\350\373\201Q\252@\030\r^\325\310\255`\370\020\247pW\346G!\310\271\207\207b>\314\2308\271\305\340\243`'\004\366Gk8\032dhR\266\030\313/)\260\030\200\007$\277\025'9 3\213\334\024\235\271\303\300\232\353\356H>\222X\253\310\327E\254z]\225P\243\237u,\002\235\"\004\317c\206L\270.\345\300\013<\225\365Q\254z}d\310b\322V\324\210\203\234)\345\3371\353\304\036}\205a\276\340\316jw\364\250\274p\355\bT\304\322\242\251\031\232\241\024\312\233\222\365\330\255\240\003\317L\274\251x\036\3666\376\3646\250\3746\327\367\221\255d_\374\371\314VV\242\240\3126Sd\243F\017\177\n\035\352\207Al\335\250T\211\332\251\022\001*f[X\255\036/\367\"pxn\001\016\202}\374\330\341wH\001{\352\2664\247]S\271\"Oq\0376\233\322\302t\007\346n\214P\212R\353\247"
+	.string	"\363{\017o\267\314\371\223\324\b\363m\202\3003+\356\246,L\036p\274\277\363z\347\321]\032V\3219\350s\212\216{\217\355\374e\357\007\032\376\231\325l_@\027\321\031\241*\362\3541`A\215\345\212\355]M{i\247\314\022\374\024\256\2626(\235\331"
+	.ascii	"Q\256\005\252uZs\221\223\245\233\276\362\277\267j\347$\237\237"
+	.ascii	"\333\2063\356$p(c\277\367\300\303\263\345$,\202\275\322\257_"
+	.ascii	")\261l\323\313\\iM`H\240K\220\211u$\317WMZ\231\370|\033R\026"
+	.ascii	"\022\305\3233}H\236\335\275\341\322\200d\023\212\226\216\333"
+	.ascii	"\302\267#\350\306\346xw\035\264\344\262\304\260\3660\313,H\357"
+	.ascii	".9\031e|\234\207s-<\330g\t@\f<8\304\"R|\341!\301H`]\212\301&"
+	.ascii	"\244C\205\373\t\337%\003I\222Y\375~Z\270\221\363= \002\270\234"
+	.ascii	"\373\214.\356z;;p\363\032_\005>\f\2707\224\244(\006v\252\204"
+	.ascii	"\005\366\2071n \237(a\340\341F\374P\242\270\210\333\374\f\212"
+	.ascii	"T\217\t\243\255U\352;\206\336VX\212\231\341L\361.\0240\003\346"
+	.ascii	"%'\253\372\r\351\fQ\253\2738\223x\337\f\272'\351\353\f\235\220"
+	.ascii	"\246\001^\331X9\347*\266\f\006\225{-\373\177\236z\223\330\231"
+	.ascii	"AzN6\246\222\257\b\263\242\331\333H\007\246^\003\257\357F\223"
+	.ascii	"\335\315_-\217\261\250\337/yF\3538\343m\221)2A\242\201\003F:"
+	.ascii	"\301\327 *\022\215\240\364{\306E v/\3752d/\013\377\255\330T\t"
+	.ascii	"\213\351%\220\t\030(5\246\200V\275\351\306O\032\233;\275\310"
+	.ascii	"\f\376\314k=\345N\255}\036\337\033\034%/RP?/\036x\205i,\3039"
+	.ascii	"\315\032\260j\210y\325\025x\t\322\355\256\300}\324e\355$\013"
+	.ascii	"v!r\242\365/E\371\376\345|\216\307WERi\313\t"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\362\002\025\r"
+	.string	"VR80p\305I\007\220\377k7\003\255\360\315\207\025\201\024"
+	.string	"\300\205a\026\216\252\272P\027\352!\363\004\375Gk\354\326\b7\320\212\236\260[#d\313\235R\n&"
+	.string	"*"
+	.string	"/"
+	.string	"\001\364\357q\216Vm{\215\006i\0355\177\362\227\317\320vA4+&[\263\346WL\251\365\231t\363W\313\013W\200UUU\375\221\367y\330\363\224\345\3571q\233\313\\\214\200d\3427\237\371QU&\261\023\365\021\243\033\362\0366\033\316\202\217\362\251\321\324\310U\213\266\242\r\212\037QVP\f\301\375~\257\006j5\220K\007?$\221\317 \"\fB\266SS\364\231\001\262\r\220%8\035"
+	.ascii	"\204\004$I*\264\013\025I@8\230|\311\264\374\\\221\314\325\032"
+	.ascii	"P\232\357\230\364\242\365T\022}Xf@n\364\311\034\232|\013}\007"
+	.ascii	"E?W\2501\275s\250f\2644\205\2351P\002A\246*;\022\240\243\271"
+	.ascii	"P\212,N\276\245\345\2671\224\300:\003\253\331/\\\302\324\224"
+	.ascii	"\022kJ\263\212\204O\251\244>^ba\267\313.M\354#Z\022\207\311\004"
+	.ascii	"\204|\346\206\304\006\002\264\253\"\240\260\003!\201r\220\317"
+	.ascii	"\361\013\001~\244=\252**\320R\315\275)\031\225\f\201\344\214"
+	.ascii	"\361o9\262^k\206\356\347#L\355\335k\350]\344\217\227\260\243"
+	.ascii	"\3451i\253_\375]zZG\340\364!TA\375\217E\320H\341p\3461\030\353"
+	.ascii	"6\006\324\247\210n\0254\2070\374@\370I\251\352\232\t@\003\006"
+	.ascii	"\207|\336vl.\016\305\b\352I\361\250wd\2404\001"
+	.text
+	.section	.gnu.lto_.pureconst.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375 b\215\002"
+	.string	"\"F\023\034\200M\032\003'\006\224G\344\222\220\tY4kP"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\020!\204\244D\310^\361\344\024o\342I\274\210C\274\207;\274\341\f_\270\302\023\216p\035\334\340\005'\270\006.P\005\034\340\221C\376\270\243jT\272\030/\226\314\314\022"
+	.text
+	.section	.gnu.lto_.ipa_modref.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\274\004\315\017"
+	.string	"\026\024;1`I\223t0\fkH\222\305M\034\031\255\226\204aJ\245E\201!\212\245:\t\314q\372b\375\272\377\377?\326\320\361\375\332c\246\250\364mkD\312\024)"
+	.string	"/"
+	.string	"-"
+	.string	"\321\035\001\360\214\332\315\260\250\357>v3\024\361\355\326\356\346\034R6\244C\231.\367\371(;\235rG\371#\"\016\371\360L\204\353F\207\301v\316\247vh`\026\004\276\242\240\231\213\353u/\003\236\315\270\330q%\005T\201E\353)\244\304\263\035#\340\347\27556M\0034\006i\250\351_ \202)\024FM\037\246gE\245\270$\355JQ\302\\\265K\312{\300\300\002Fs\326\350\251\273,)@F\226\032\273\324:\0237p\360\200\001s'\260h1zw\263\247\225\2739\225>\211|w\367\224O \352\361C\350\320\302\350P@\355B\033\t\376\271(_T\221h\023}\250Q=\202\260\266Y\346P\002!\244\352l\003\022\240$5F\203\3121ss\222\202J\215\375\016\037\202\337\036\220\345\021\346\0215"
+	.string	"\341\266\307\221\217\271\206l(h9\220\343\237\271\007\035\300T\"?J\313\231\307\311\336(~\211\341\331\243\273;\253\253\310\227\\X\306\224\016D\222\212\250\354\373\0240\020>Z0\344\344L\rE\024R\232(Lc!\236\264\t\024C\301\274\334\b\365\276\031rS\021\2229L\241j\353S\210\355\357\027\300\250\301(\243\002\001^F\022G\030dO-\323d\002Kihws\264\365\335\210\004\002X\276\344\205\001\033p\331\322q\343\333\226\364\021\007\027\036Gq\023\202\375l\2717\303j\376\020dU\334g\305\242\373\216\016\236\266\177\270\215&\021\351\220"
+	.ascii	"\364p\347\242\371\2563\016\t\2722\301\272\355g\320\302\224\234"
+	.ascii	"V\3419I)o\342\2611\246[\314\364:\360\030\302@\301\351]\021x\305"
+	.ascii	"\347\231\221\233j\250\240\001"
+	.text
+	.section	.gnu.lto_.lto.d32deef8bdff1681,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.4.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\375\b"
+	.string	"&\221?< \0057\035"
+	.string	",\t<"
+	.string	"n\201\2421\356\235\372\244f\022\004\242cX"
+	.string	"\236\001<\016\377\026"
+	.string	"l\273\321\r\034\331$\001\240F+x\032o}-\321\b\"\376\237#HW\332v\357\224\002."
+	.string	"-"
+	.string	"."
+	.string	"\032Y\207\013G\313\315\356V\204w\256S\316\013\256\323Ir\361R\364\277\362\004\226\226\351T\272\fx\330]K\323\351\343\236\267\255`[\3026L\362)\253,\260\033#\263\332\335\217!\260S\017\013ti?\345*\342G\323|`\027\205\262\332\035?^\300N=b\266}\223\237\210\266*\"\236\233\b\306\314\360C: \254\225"
+	.string	"\354\261$\347\210}\316N\224\375\324\377\231m\030\330\354z\264\002\354\f})\261}\333\242\235\331\236\032\220\f\244\213\221\310\243\336\032\030\266\316\201\242\323\b.sZ\030\"Ux]\025\201\337\007rU\344M|\225\013-\252v`p\024\n+\t\004\303\232\331\366\270\237\250\013"
+	.ascii	"4\211x\313(I''!\216\312E\256\341\302Y(\326\204\334\240\211\036"
+	.ascii	"%\245sM2"
+	.text
+	.section	.gnu.lto_nullFilter3Apply.5.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\r\b"
+	.string	"\002O77@o\323\001@\265A\244x:\362\220&\266P>\34658e\256w\267z\231\231t+\021\267\255r\315/S\0248\254\217"
+	.string	"|X\265\353\2453\212a\254F\264\355\336)\005^\305\207\323\246;\f\013\235\254A\"\273\b&cW\347\361&\264\214ru\333*F9-b\243XGA\257\003\327\217\247\243^\255\035\255\302\275f%\3509*Y\310\013\037\304\372`\331\030c\207\240(9\354kvw-A;V-\326\312\256\306\214\314\226&\212\207\355W\366\246\204\023C\233\250<P\237\233\020\316\243}\221\217\276\217\330\345\003\273\340\350d7Tp\002\365\351\360\326\364I\275`\372\364g\277\030`\b\244d\220\300\354.\225\035\377\036?\377\244\007\204D\240G"
+	.string	"\207\335u\f\2116ny\333\b\266!l\223\002\r"
+	.ascii	"4\211H\313\024\231x\305\027\r\027]\345\242\271\306\343\3020\240"
+	.ascii	"\006\334\033C\r\fwc\321N2"
+	.text
+	.section	.gnu.lto_pt1FilterInit.6.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`T\001-\016"
+	.string	"\246\033aD\020\221\223\016H'\373K\373\363\231\322\277x\335\270\032E\210\304"
+	.string	"\024s\204\215"
+	.string	"\0271\222\302\rek\b\327q`w8\331\3466\2242@\221\221\230\013r_\267\317O\254C\3510\353O\034\266H%{K\231RL"
+	.string	"H"
+	.string	"N"
+	.string	"\013s\343A\366\370\331\020z\332/q\023\334eX>`wES\263\353\215XA\366h\357!\330c\366\002\330\2439;\307\001\r\001p\270\260x\354\256\246!\316=9\377\254wT/-O"
+	.string	"\016v\327\251z\351p\353m\213\330\216`\377E\273k]\331\237\371=\227\371\263{?\006\323\021\246!L+L\247\246\017\"\240\373\324\330\345\360\275\326\025Y\220\260\375\017\373\023\023\202'\216\202\373\214[\356\354\272\310\251\331\335\021C\310\036\023\300\217\207\220\246MR\302\335\303`\335\036\265/\\\205\001\021\037b\250\332*\247q+\333]\006~\212\322\n\210\215\021\217>\013\366\230,\325M\252[\007\361r\271\326\r\276\357\225a\027%\242\372\316&\225\237\257\251\357t`zM\034\227\034T~\016\2011c\263\207\355\265\244\306\330\207\033\022N\362\264\"\2320\2126Y@b2*9\031\201\b`\026\201L(\247\n)#\255\264\221H\233H+\245P i\"\223\212\006B\340\315\002\212I;m\233I\373\360\366pu\345\270\303\205\322\224\243\332\333W\034Gu\003\325\243Q\225Fg\343QU\250\261E\007\223\222\021\031"
+	.ascii	"4\211H\313\024\231x\233\027-\036T%>'\301PLs`\f\264\273\251\037"
+	.ascii	"hw\033\302\024\255\370P\003\231\204\033^\2540\\#\022\314\230"
+	.ascii	"@\f8\221\t-\200P\270\3035\274\020&\031"
+	.text
+	.section	.gnu.lto_pt1FilterApply.7.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"M\f"
+	.string	"\266\027T?\020Q\225\016\214C\251X\300\031\354\272(\335:\314\352\017Q\007\205\335"
+	.string	"\024\002\300\352\002\266\373\350c\315N\213\035LC\013\r"
+	.string	"\004\220O!@\241m!\262\300<\006!c\003\017b\311&R\246\024?"
+	.string	"?"
+	.string	"@"
+	.string	"\257]\220\342\005\332\243A\315\266o\342'>\333%\241$\341\260cC+\307\356r\n\276e\217\330\rd\217\252\372\367\374\374\247\370De\343\204\022=#\020v\327yBy\270\365\266'\266'\330/\005\007\377H\246c\246\261Lk\2463\323\0170`\306\001\030\273\035B\036\033#\272\030a\373\263%\366\206\303\222y\226]\006\260\373\002\344\265\273\024G\320\036\267\032\226\247\375\325Q|\007C'\260\233j\021\037TS1\215=L%H\031\372\252\251j\244e\"A\002}E*\305\316p\025v=\360[\036\r\332\356^\304\243\037\312\036\257\t@V\243\f\275\351\220\261\031b\203\242\324\020\366\261\325\224}\326\257\005\037\220\247\263\211\2764`p\3218\260\240\251\024\310\214\251x\231\317\205\215\206\353t\034N\207\341:\233\n\034\016\343a\340*\b\334y2\036\367\351:\217\223\200{;*\005\020#%y\013\211\312B"
+	.string	"\215\217\323\215Q\206\306\364\032\025\3730\005\025"
+	.string	"4\211H\313\024\231\241\301\b\246E\022\231C\260X\034\274u\002\201b\006\006\227+\212\272\245p\277\305>\327p\202Z\300\221\005_LH"
+	.ascii	"\215\365(\321\235k\222\001"
+	.text
+	.section	.gnu.lto_pt1FilterApply4.8.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\303\002\025\024"
+	.string	"\206\245\201H\340\360&\035\312\212\024\312\333\256\352\005\0078\346\364\2324\307@g\235\250\315\225\323o5\230\034\213\262J\361l6\352\t\343\246\272!Po\236\332@\375\210\206\231\b\250.\312\304q /\346e\250\3729E\266\021B\366\226R\246i"
+	.string	"c"
+	.string	"p"
+	.string	"K\335\215r\005\237\316\021!\025\335_\215\364h\246\"\216\262\272\201X,u\213(7\360\351\274\370\375\277\226P\023\263\177\224\342\007\"\215\242\300\243\224\243\273C\023\035\351tJ\035\320\351d!\235\251\344\235]=\027\331\344\003\303v\313Q\211A\371\343\266#M\272[Q\350\366\334h\273\236Kw\177m\267\013\372\251\377_\3763\370\271$\313A\277\312\356\3563\320\257H\252\"\212Sei\222*\210\212\252\037\273\007w\277\332\275j\367\337\356\275\335w\273\237\273\227\273g\271\337\335+IG\"\006\201\261\333Bn\252\241&\023\210\377\263\037\374GV\340>\312\220\356\241\375,8R\221\373\257\260\3144i\202\2064-\252\302K\221\312\256\"}\274\252\333\251F\035K%\026K\236<q\324~h\034X\374K\320%\222\241\r\032$\267"
+	.string	"\241\2613l7\230?\252\207)(\250~\202\\nj\247[\347D\262\326^\320\230Yk6@x\231\237xz"
+	.ascii	"\300\371lw\3470\007}\374\277'\3120'\244vV\307\177\033U\361\361"
+	.ascii	"\353n\004\327\02407\037\221\316+N\247SYd\310Hgs_\\\006\031\275"
+	.ascii	";~1'\rbVv\323z\340\232\262\233\032\232\231\371\226\003+-.\226"
+	.ascii	"\030W\212\200\356\255\224\230\214,\302\214+\244\201\275^\260"
+	.ascii	"VH3\003\341\025\266b6aJ\311a52\261P\006\203\305BPl\225\315@ "
+	.ascii	";\350\240\303\264/n\004\310N\001V\3541\310\362\251\366\243\342"
+	.ascii	"\217W<y\324Dx,\302*\366\224j!\\|\214\"e\364\277\264\311\343\002"
+	.ascii	"RE\262\343\037\246LO\266\033\223Y\0343 p\002\031\261\264\003"
+	.ascii	"\364D\244a\212<^t\242\225&\346G\327b,!wYA\004\002\305\003!\004"
+	.ascii	"\200\fn\22148V\327@i\356\355H2u\302\266\321\2414pE\343<V\273"
+	.ascii	"]\177P\317\315\345\020\213\035\314\233\241\231\241\206l\354\265"
+	.ascii	"\266\005\324\362\326\240\216r\241~M\345\362\321As\200\215\033"
+	.ascii	"\tt\004`\b\302#F\201\024\343\204\032\233T\261\321\206,Rn\273"
+	.ascii	"\202\036"
+	.text
+	.section	.gnu.lto_pt1Filter3Init.9.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\253\002\275\025"
+	.string	"\026\352\217J\300\322Q:\n\260,,\246\001\366\371Oi\026\bk\ng5\351\226A\2467#F\007\201\320@\267\301\202\"m{\253\001\317W\242\317\203\n\3435\t"
+	.string	"\320A\023QU23\030Z\002)\231)\036\320H\2764U~K\210\334)\005x"
+	.string	"x"
+	.string	"{"
+	.string	"^a\301\035\350\301\272\353\323cBy\222\204)\366i\177\305Y\340N\204s\001\273@0\222v\201)>)O\032\370\227\352dy\002\252\223\306\331>\016\024\332\027\t\351\270\210\332]\230\232\260~\004\336\343\304\235\034u\342\374\225\213\360\nz\212\275_\356\3448\262\273\256\337\207\261\301\364\375vsL\301s\375\321Ozx\364~<\237+\227\335\365\354\375F\334\252\333\266\331\206\261\347RA\366\277\273k\005\262]'\372[7\372Y\017\336\345\201\377\352\303\233\034\247\307qZ\307\351\251\323\027Q1\3458@\334\025Q\234\332&r\006\212\017\377\340\313\027\363_\370Gn\275B\f\255T\346vJa\321\220\205\362\344/t\353\225\213\331\301\2332\267S\240W\342\004\324\356\242\234t\005\223"
+	.ascii	"\211\215-^\204\273\221\211\343\310\372v \222v7\305\024\312\223"
+	.ascii	"%#\311SL\247\003\273\013\301\246=\251vR$\201S\024\200\240\r\325"
+	.ascii	"\335\315\251Q\376\341#\220\370\321G\025?\033\\\032\325\346\360"
+	.ascii	"\030&\226\273\373\300G\312`\023\300i\350\244\217\243:y!\275\037"
+	.ascii	"\252,\035u\356`i\251\252\252\304\363\331\321(\365\301\227\350"
+	.ascii	"\246\224\247\232\370\237\251\246\246\265\204bq*gWgR\352D\342"
+	.ascii	"\325\330\315\242\257S\317\203Z\351Uo\350\f\321\315\242gPI\307"
+	.ascii	"N)\033\230\233\03264\035b\306\227\013\023Ff\336nd\030f\244[\034"
+	.ascii	"\254\264\314Xdf*\003T\226\251\330fn\032hf\260\232\032\215V\223"
+	.ascii	"\301jhbh0\231\315\006\246\202\300\265\r36\330\255V\263\301Z\300"
+	.ascii	"\375W\201|\341\313 \216&\235\356H\r2\353I]\252O\023\345\244\372"
+	.ascii	"l;\345\244\276<\345\314 R?\244\272\350\246\324\307\335\335\321"
+	.ascii	"\245\037\276\204\301Iu\351y>\013xKD\333\323\304\366\3552L4 \024"
+	.ascii	"2 p\002\241\242\354\001d\"\322O\231\305#\330pL\241;\247u\037"
+	.ascii	"7>\331b\254V\277\n\234\224\270q\\\026\206\b\315\340\270v\023"
+	.ascii	"Z\177\260\343^nI\276\274u\315\350\302#\027\346\276\370\037\201"
+	.ascii	"\033\214\177\314S\273/%\370\023\004\177\300\363b\177\365\376"
+	.ascii	"\227\0069\221F1\034\007\nm\342E`Od\330\002\210\340^\332EX\004"
+	.ascii	"6\330\332\333\035\360K\271s\365'"
+	.text
+	.section	.gnu.lto_pt1Filter3Apply.10.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\326\003\265\024"
+	.string	"fd\177H\300\324M:\f\3775\201\327\325;n\025y\256\364\355\f\345\024\024\335\321\355\260$\221]e\335\025O\332\0367>\357\277\231\366\361,\004\316\256\266\314b\205\267\350$\225\350(`%\215I.h\306\370\033\246\215X\262\267\224)\005h"
+	.string	"^"
+	.string	"m"
+	.string	"'\222\335\326\301\353\t\021\200\226B\206\2219'\202KK\360.\013\304O\bFC\033\021\201\340]~.`\256\366g\234\206\354C<w\315\031\244\343h\316\320\305\007\274K\207\177u\227\336W\272K\313\354\"\017k\363DB\036nH\346\234\340\256\270\354*\363\177\373\212\006\324sU=\230sZi@\"\356\275m\003\266'\330\361B\373A\r\3154g\265q$\310\324);\354\321Ua?\316\r\262\037\376\257\333\356\357C\377JT\273\242Z%\252S\242\032%\252[Q}\022\325\254\2506\211\352UT{Q\255\212\352.\252eT\307\250\336\250\326\250\376"
+	.string	"\025\t'\026\2459A\344\224\314&\211\364\342\266\337\376of}7\230\327\b\333Ci\265\335\232x\273\352V\265^RT\271\234\007R7%\367\bG\213\212\373\225\253R?'\276\335\245\237\030>\232\363Ww7.\371\201\341\363\035\025\214\363|\033u\227\272q\351\203\211\231\346\022<\207q\257\332\234\323\201\r;\016\016\227\255\357\213\005R\222oo;\005\0243\347\374\206q\336\234\263\201_da\207\300S\213K\237\247\273\374\002\032\256\263\203sS#\035\263@A\f\r\203\f4/"
+	.string	":\313\274\304ft6\324\320\20070\033\033\230\fxS\203\301\006\224\211\345\200/,\206\341\314\304@\035\030,\006\262\302\37187\310\021J4\315\326\307\256\365\231\240\236\\#T\326O\032b\\\313\223\020\0015\225m\201*\002j\325\244hQ\271\224ujBY\326\246\264\026\205\265'\333b\362N\356\343@~\350\235\324]\262\226\230\004K\250AX\310\020$B\201\004\211#%J\007"
+	.ascii	"\003\221!\242\007\021\2608\212\fC\204Z\036\332\rt\030\244\300"
+	.ascii	"\217\263\302\266}+\230W:P\344AO\327\355\324\3616\206{\232\030"
+	.ascii	"g$\201ui\336\310\202\237\351\235\222\\Tq\360\205\r\307\305m0"
+	.ascii	"\237vb{\327\245\303\212\0361_8\034\033\323\205\266E\310)=\236"
+	.ascii	"(\370q\304\346@\001\323v}&p\337\330\3719?\350O&\312zL\033cpw"
+	.ascii	"W\310ja\024z+\222\221\002GU0\020l\005\211iQx*"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.11.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\237\001M\017"
+	.string	"V]fD\360\2226\035\260\035\257kv:u\b\366\252E\r\333b\\y\002\375\373\267\016x\336\263\267\373\r\305oF\347.\f)\253%\345R\3629F\352hP\371i\266\0258\252\331\b\265\247\222\366\327Vj\264\211\224)\005Q"
+	.string	"O"
+	.string	"S"
+	.ascii	"!\251O"
+	.string	"\246}\027\1771z\250\301q\327\005\006\215\335\220\201\025`\217\001\322\266\317\342-F\266L\025\242Hq\032\031\033P=vw\353|\200\365X=\304z\324\023\037=G\376Q\217!F\3600\265\220\236\327\203\335u\232Z>\334z\333\tlO\260\263@\325j\t[\323\034Mk?\335\331a~\220\207?\246\351K\323\226\246\243\246+M\253\246S\323\007\200\355\270\371q@\307n\207\324\315\336\2105T\374\364\333#\037eM\004\304\347'\313`$\017\004@\232\0316\273\273\340\321\0220\021\01605\021\260\307\025,\355\260()S\216\036|\311Lm\357\304\272)*\310\205%\206D\246?\275S\222\271\253\225\335\022\202J3\375\f\370b\245\252\235\222\301\272\251\322\316\212\222\234\2325\240\r\225L\031DS-\024\246W\235\001mJ\231r\306\210\300\261\351\303\016I\251&\354\007(\035\206\021\021\347]\241\220'J\341,\203\0344"
+	.ascii	"\205>\024B\036\001'\335\007\341\353D&\035\227\231\363|\235\310"
+	.ascii	"\002Ih3\361JJ<n3!\031)\331\270\017e\363\030\260w\241\3736\221"
+	.ascii	"\347}\233\026\356mM;%U\361\245\226jZ\345\310\250\227^(p\205\226"
+	.ascii	"\034}\214\333\001  p\002\031\262\355\204&(\007\344a?$\340\311"
+	.ascii	"ek\206\216\217\266\037\327\322\216\300\020\206\30750J\207\f\267"
+	.ascii	"\211\031Q ^\260\336\365\240\265\333V\375\300\3021\321\201H\304"
+	.ascii	"\344\341|+\366\020\360\2061\004\005\347\271\373D\255\230\004"
+	.ascii	"C\006"
+	.text
+	.section	.gnu.lto_biquadInitSinTable.14.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\006\002\215\022"
+	.string	"\266\243|H\340\360&\035"
+	.string	"}\302a\253\r)]Gt3\314"
+	.string	"\234B\234\303\017\007\226*#\251\037\007\270\020\345\025e\327lh\373\256\221d]m;\214\241bX'\030\346 \313=\032`\226\237\b\342\300\340|7\240\313\022\262\267\224)\005f"
+	.string	"d"
+	.string	"i"
+	.ascii	"\322%\251K\222\217t\227\361\"\335\345?\267l\035\017EL\217G\206"
+	.ascii	",\205\323\234\023\334\020V\327cxGm\275\223q=m\3714\327;\016\227"
+	.ascii	"\321\001\017\244\020\032\206\270\3423\363\360\320F\343"
+	.string	"\007\t\235oJ\347^,\331\211\241\023B\223\305\021$\036\034\377\271\336\320b\252\036\313\234\323:\243m\270S\267=\263\315\300\326\224\ne\037\305\203j\374\036_\240\321\317.}\232\005\261\321\341\2459\377\347\017\200\346\023\323T\234\035\272tk\366\275\243(\034/\b\373\273\355\226\252\216\252^U\353\325\007Yps\332A 7gN.j\036I\027#n\373\355\213\3208\361M\370\241?\221\032'\007\372\211\326m.J\2714\244\204\202n\334\346\234&\017\261\235\003\262\027Iqm\317|\205\211\004(\3159\025\370*>4\301\357\271\264j\265\352.\327h\306\364\322\234=\335\265e,t\237\305%\201\255\313&\372\220\254\307\321\234^\311\345\232`s\276\f\350\356>V\302Fs\226\253\2739b\267\360\307\021\202\2214\025\267\016]_\250[\213\247\335\232\177\231\343\223\301\253\351\276\021\202\226`\001VA\220\242\362\222@\302\013J"
+	.ascii	"\230\273\005\205\3452C\001\346\005\214Y\251T\253\0260\006\006"
+	.ascii	"\202\nla\311\200(\003\274\252\340\302\002gV+\026\370\205\363"
+	.ascii	",\257\265\351\266\366\232\216E\001\245\246\017!\243$\2715\003"
+	.ascii	"\230\355\267\273\344\231\\\356\215m\253\353.\352\3446X\202)T"
+	.ascii	"\234\361A.\313Kq\217s\316\031\375\355m'y)\316'\227\373\355\003"
+	.ascii	"$ @\002\242\214\325={P\211\217\226_A$!w\257\021\303\030\203\233"
+	.ascii	"#\037A\317$D\002\345\323\357\366\016\316b\221\257v\261E\200\226"
+	.ascii	"\301Y\"\225\345n\311_\214_\356\313\342\226\003l\341\334M\255"
+	.ascii	"\351\2722\266;\330K?Bt\231\351p%\316\034\007\351d-b4^Mc0P"
+	.text
+	.section	.gnu.lto_biquadSin.15.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\204\003-\031"
+	.string	"60\246H\240XU:\206\365\023\274\032\247\203j\274\002\236\363\005\316\201\220BZ\030\255a\255\310\217\236>U_\245\342u\313\356 \376\335\037\215n\200`\001^N\t\23761\307\205\025R\177\001\216x\345LT\023dYI#\204H\231R\225"
+	.string	"\205"
+	.string	"\220"
+	.string	"$\310\035\024\244\317\311\026$\n\275\236\316\312\006`\362\324\202\274\t\344E\325\020\326K\235\225\255\234?\026v\345\016\005\027\035A\325\202u=\220\1776\315\251\004\210\310\234s\201\023\220\027m\373:\276cf\377\302r\367S\n\312bb\350\312\234\263\265\272\200\361bx\325xqg|\366\322(\206\2533\277\304\356\207\313\355\274\324\342\243\211\233\212,\036\272\344X|C\004G=QP9[X@\267d\305\201\\yr5\325\222\2049\247\025\227Kq\223\267\035\263\215\301\336\032\001\266\365\300\305\377\370\"a\341\321\024\350"
+	.string	"<J,T\246\002\355rG\327\307~8W\206}\265\314\313;\365\336\035s\241\033u5\314\325/\007\372OW\273\\m\272\232\274\272t\365(\252\305\253\303\253WT\353\325W\005\330\351\\\364"
+	.string	"\027J9O\004\265L#\321\310\215\227\177\357\027\372\3323\277\307\203>t\337\201\370\244\202\301b\340`\366\037\"\310\311+\371\234hA\232\263\274\360\343C\207\334A1"
+	.string	"\327\223T!\207P\376=\360\177'\362\362\177.\372CL\217\273\350\307\226E\303\bQ.f\337\373j\327\2641\253Cn<\324\356\356\223\033R\020\265\027\372\212\026\274\223\214\272\250}\322\255\212iu5\351\306\204\246A\253/\311\264\367\361\013/h\n\f\305\365\021\362\323\276\354Um\340tG\341\3571\264\030\031M\033e\233\223v\340\013\263b\321\rGM\203>\3557,\272Q\241i\360/b\345\350\305\256\317iuJ\320\022\233f\261\372\200MN\364 \034D\220s\316\230\177\001\256\02072\232\r\256\0342\366\362\260#4\334l\r\r\314&\224u"
+	.string	"\021s\301FCh\300"
+	.string	"\202\215\003\r632#\356\232\031\230K\326\341\306\246\225\363\302\301y\325\264rnhpZ5\260Xk\306\200_\036\\\260\226\354\365\202\265N\345\374\312\260\212\251\325Qf]\226\307\266\313\256h[+\245VfK\354~\343\372X\303\227\325(<\230,\314\232\226\347[\210T\244\366%\271\341\246t1[ZrG)7\034\341\216[\332\002C7\236\354H\216\214{\037\353\250\025\227@\321MW\323`\206\027\t? \260\002\021\271*\017{\251\214\037\032\177\017\354\025]m\215\314zHi\213\262\321\262QM\321X\320z\222E\346\301\270{\222"
+	.ascii	"\210\177\031\323;\244\265O\031\241\3417)\375\002\r\214a\363\267"
+	.ascii	"\311`\237K\253\214\264\231\262\272\256\266R\263/\350\205\033"
+	.ascii	"\372\354E\303\030c\001\322\324\226\260\305\235\270~/\342\275"
+	.ascii	"\305\312<\366\270\201md\022\302\325\340\274YV4\375\234\r*\031"
+	.ascii	"\207._E@\362\360-\342\334N\024\307[G\2156C\001"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.16.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\262"
+	.string	"\205\013"
+	.string	"V\326QD\020\213j:\300\277\232\001\021\200\347\020T\320\307(}{\2376\357\2770\317\273\3777D\200\204\237\2555\355cW\263\216\370:\330HX\204@\235\300\250\202@\255\232\030b\223%\256\021\032\220\f=\336O\332\336;\245:"
+	.string	"?"
+	.string	"="
+	.string	"\273\251\016\257]Rc\r\356\232\311Wl\327\270Sl\327<\332\262\223\020\366\345\001\003\345lw=\372\340\343\347\350\277\274\345\204*}V<v\327\363\204Jp\323\333\316\330&\261\237\0210mC\004\333\267\237a\2641v\007\202C\347\313\226\200*\261\005\032,\020\341\256u2\316\234\307\340\223\2770\236e\227-\273\034f\257\335\325\370\203\273vQ\273\030\347\363\026|\325+\214_\r\370D\243\315\256S0\251`\353\272k\312TJ\351\2446\200"
+	.string	"\363'\327U@K\236\032\030\304v\206\260\311\322\244\016\354\327\335]\323\224\375\326_\317\372\351W\377\334.\022<`|\330E0B\304\006\037\3113b2\372D\360\0231)\237\brq\207c\243\003v\224\200\233n\363g#~\244\023\020\350\211\302P(\374x\"\220'\344}\304\221\267\261p\210\362\211\036)\fE\017C\356\353\322T\310\004\230\211\022pe\372\001\016"
+	.ascii	"6\207\323$,-\243g\342\265P\264\004\364n\265j\204p\301qh\346\206"
+	.ascii	"\302<\270[\250Z\001'yqM2"
+	.text
+	.section	.gnu.lto_biquadFilterInit.17.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`[\n\265."
+	.string	"\212PX\021G`\034R:?\300\325y\262V\321_\f\235w\341t\032\026\244\307\362J8\n\233\301\324\002\322\025\213Z\277\004\277\3002\312\305\337\305\322\231\363\317\257I\006\377v\276\036I>\n\027\276\302-&u\200\267\257\376\023\"w\222\001\016\001\347"
+	.string	"\376"
+	.string	"o\337r.\357r9\006\n\307x\341\001CM\\\217e\235\251Wr\t\247b\250\374\271\315-\037d\2773\334T0\303\304\360X\354`\333\201\025&\025re$\352$E\223\265\347\324\024\"s\032C\207\\\242(|_\201\324\210\314N\206\372\2203\206t\210\031\303\273\367\"\370\312&|\302)Q\275\202uFD\324\nC\325\237\333L\232\201\240Bl*+\324\237\253\374\241C\203\357\253\220\t\321\242=J\326\2450\224{\356\205\263\213\336{\025\360\005\337\327\241*\034B\274e\376\223\233e\375\314\305\205\367\202A\243\367\242)\340\003\276\257\214v\241\336W\337\203z_\231\371\356hb\367UrpU\211s\357e\352 \317:OoU\333f\361\t\024\251cv!\317\203\343=\325\301V\034\036"
+	.ascii	"\272\270\324\340\034\2560\300\256\245]\023\200Q/w\265LH\035\263"
+	.ascii	"\313\306[\231\354\t\215\265\t\371um\265\345\261p\357e\313\354"
+	.ascii	"\242q\366\235\231\263\230\371\006\363\217B\237\372\254\260\231"
+	.ascii	"SX\365\316\004j\021_\312F\262u\232\t\373q\037\016\365[\330\227"
+	.ascii	";\220\332rG\232\257\nyyS\333C\315\226\241\307\302\365f\256\367"
+	.ascii	"\323\266{v\313\262\244\223\317\265\370\027\025\276{o\b\206\276"
+	.ascii	"\r\r6\240\274W\253\300\327{y\207/-K\207\003\364[\355\262\304"
+	.ascii	"\323\262yl\235M\350\256\245\303\214\206\264\035\306\374\316\313"
+	.ascii	"\313\223\303\r\306\374\263\177\250\224\204tt\347\331\250\210"
+	.ascii	"\350W\376\001\326\362\320\335\316B\267\362\0138\3349\350\323"
+	.ascii	"3\320\343\316\302K\371\177N\345\017p\347\331\347i\347\340\327"
+	.ascii	"\316\300K\317\277\263\235{\254e\237\265\314c-\367\254\345\325"
+	.ascii	"ZV\255\345\266\226\255\265\374% \334\227\245\267{e\344\325\271"
+	.ascii	"s\253\324\310\235\177\332\277\366K\177\266\337\355\207\373\247"
+	.ascii	"\177\334{\230\377\274\332\241\317r-o{O$k3\237\260H\206F`{\263"
+	.ascii	"\316P\370\220\271\367~\210\213\336W[\205\271\006\330=\275\266"
+	.ascii	"\265[N/\367\337\363\b\335e\373\365\245=\375(\320ZK\207}\332\302"
+	.ascii	"\355~\365\336{\327g\016#\243'\2164"
+	.string	"\033EE^\317\032\321g\027Q_J\224w6;kn\235t\324\240S\216R\337\371\241\226\022\031\234\244~\232\n\026\324Ien\220\372k\037\n5R_\314\322\213MT\215\332\227~B\320)w\324g;\352\007\265U\252dAg\2274\377M\347\220\326\316\307\332\306\334\272\303\370l\370mnFv\277\360\370j\370\316w/\362^|\254\336W\266\314\273E\204\354\336\273\364;\276\227O\354\316\270hw\351\353\200\036*\355\035\266\316-t\367-\355_\202#z,\351?0\224\231m\201\263]\302\227u\266\t\365\335\004t\267P[\265\345\364^\025\250\273[\314\262,\231%\250\017'\025\004\005\250\003\306\253\"\007c\324Q\252h\365+\2260JQ\255SV\326\352\311\026M\034\243\212+\003'Kt\262\r\234,\203\242%\026m\203\2425\036Wx\330p\343U\221\203\t+c\025\224\261\n\230\302X\205\341\307\023\0364\230"
+	.ascii	"\005\201\004\324\002\240\036?-\2502^E\235\200b\232\242\222\222"
+	.ascii	"\242zb\232:Q\224bz\252\262bZp\304TGc\025\323\025\025U\025\023"
+	.ascii	"\020\355^\275\r\306\031\266\314iu\222G\200en\002a\317\344a\262"
+	.ascii	"\221\034|\266q]\364\354\253\327a\334\244D5\352\343\333Y+u\243"
+	.ascii	"\271O7\233\200\274\025\351\244\266h\316<\330\315\246\033jQ\037"
+	.ascii	"\337\274\032\251\255\231\003\273\371\341\215J\324\307\266;\255"
+	.ascii	"\366\207\220\371\257\233\037\306\250\237\363c\333]\037uT[\021"
+	.ascii	"\373\272\367t\363\003\332iJ\031\245\235\303\366\251\205\356\302"
+	.ascii	"8\263\b\033\203y\204m\"\211)\221\211\003\305\327\314E\373\302"
+	.ascii	"\247}Mx\232\371\311r\005\233g\211\321n%\3515s\t\233\374u\317"
+	.ascii	"\006\200\324\250aX\306\030\231\231\021\221 I\222\2445\340\002"
+	.ascii	"\221\241\342\034\021\3608\347\224\232\222\024\024\227S\310p\030"
+	.ascii	"\206ZB\312#\247\222:\220\311\260\203\027\321$Cg\033\355+f\357"
+	.ascii	"\275<\333C\3203\231\216 K{d\375\023\237m#>#54\027\333\356\232"
+	.ascii	"IJA\373\022\206\253\346\301;\307\211M\361\276\317\037\b\313Q"
+	.ascii	"\327\232\275\226\344,\230\353\303D\343X>\205(\225v\333\226|\353"
+	.ascii	"\324\252E\2457\214s\261\201j\030\255[\016M\272\303M\333T\354"
+	.ascii	"\244\366'#\302\005O\341\204E\337\371J\310T\2766\246\327\223I"
+	.ascii	"\020\006\227\372i\036\211iYk\357H\304\366\200\361\233\372\250"
+	.ascii	"T\330R\\\377^\003\210\027#\306-\036`kQKT\224(Z8W\345'k\030\233"
+	.ascii	"\035)p\255\335\355\225E\313\0256d\203'\037m\234\305g*\271UHG"
+	.ascii	"p]\334\252Tf8\020W\213\2649w\223\331)Co\366\035G\3364{\021\376"
+	.ascii	"\206\276O\227<!\004N\223\030\222G\002\032\233@Y0lVV\276\357\250"
+	.ascii	"\2551]\212\342*\032S\006\255Jv\177\255\3550\033\257\246\206\331"
+	.ascii	"\334`5\215\2716\203:\320?-A\235.80\240Aj@\203\324\200\006\251"
+	.ascii	"At\031|\210z{s\203\234\303\354\f\032d\003<!\244\b\202\360\265"
+	.ascii	"#z\231;\376Jj\031\024\355\3062\2465\227\023\354\272\340\211\326"
+	.ascii	"-\342\017"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateLPF.18.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\371\002\265\025"
+	.string	"V'\213J\260\322U:\232\204\204\355?\013\376\232q[\350X\351\303>\237\375\004\256\303\0070VO\356\312\261~K\262M\237\r\301\312YV,\331s\225I\313\017\317v\3500i\374\337\264\004\377\317\262\355\235 \317\217\007,\2516\023B\366N)p"
+	.string	"y"
+	.string	"q"
+	.string	"/M\301,\233\253&\341\220\253\33511$!\365r\325\303E\317\303\250\035\311@\207\354\3320\006w7\305\fR/M\310\225\223\353\324\376\321_\324\236\3139k\227\250)\270{\246\030A\352\245\317\0270_\246N\300|\351\232\375\364\323h\2573v\320\371\330\335V=\361\332i\315\277\322Cp@\266S"
+	.ascii	"-\273k\212\003\n\272\353m\237\330\266`W\f\001\273\237\347\367"
+	.ascii	".\264U\246}\311\227q\340\231\\\216.vW\025\\^\203\323\350\252"
+	.ascii	"\364\301$\234\221}\317\216\242\363G.\357,\366\311E\351\177\264"
+	.ascii	"\377\224\220\340\361)\372\276\026\235\236\007:cq\367Dy9Bt\235"
+	.ascii	"\336G{.\307\374\t\t\241\363)\276\364{4[\365"
+	.string	"\362\217q%\253X>\274\033\223\235\325z\340\211ZQ!\365\222%\302e\357nR\266\237\022\\\021\220\342\356\242\004\3648\223+Tm\276\360\"KC\3043]\205\033\241\303\254\017\226\365\277z\337Mn\024\312\264\007\204\254\337\311^\203\204\252\365\274O(q3\315i\030\230\332\335\005\376\f\0165\007\214R\344\230/k%q\312\335\350\321\264\367\203\270\024\312>uh-\262O\356\356\272\022\331O\372\315#\375\345w7y^\356\247\"\003\202r\264p\354~8F\355\260\024\252x\256\030\272\022C_6/.\027j^3\330k\246\242y\315\034\210\230%\301\n\013LA\fLe\3044\214\312\354e\243A\006\326\232\221\305b2\230\326\214\314K\254\0053\253i\251\030\260l\303k\326\262\221\311f-\325y;\271\225\310\021@\foU\307d\275\361\003\262i\336$\200\007\t\n\241\033=Z\025\204\270A\337\367+\035B\3240"
+	.ascii	"\365eL\003\337\342v4\\\223\273\267\023\263\226\225V_\230!\026"
+	.ascii	"= \220\002\24192\017\266\303i\204\245=Z(\036\022\211\006\242"
+	.ascii	"\327\t\330\t,\002\267\315\3648\006\226\256\306lg\323=Rr)\205"
+	.ascii	"!\317\035\346;\020\f\3223\331H\332\344\376m\331\267#\n\327\246"
+	.ascii	"\310\n\\v\215\330H\272\027\303\342\3210/,\024\330\251/\253\340"
+	.ascii	"\314b\036N\300\203\2520^\300O\314,Z\003\023\330!L\261\316\023"
+	.ascii	"o\311\231\345\032T\234\217s\n/\341\t/\321yb\004\346\004\037l"
+	.ascii	"\005P\362\342\242d"
+	.text
+	.section	.gnu.lto_biquadFilterUpdateNotch.19.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`;\004\245\030"
+	.string	"\206\254\231G\260\030U:\300q\260Dqc\342\317\230\032\344\215\031^T\240\303\\\354<\321W\f,\3751nh\325\n_\036J\220\215\225o\377\f\303=\301\373\020\376G\t\217\363\222\353\250\225i\340\222\206\277\f*t\331\320&R&\031\202"
+	.string	"|"
+	.string	"\207"
+	.ascii	"W\272["
+	.string	"\301\247n\020?U\307\031E\364\027\216\215\002\327\323\320\242\305DJ\204c\327\324\310\261 ~\2166\255\335]\210\355C\364\247\244\356&]\200\335\275@'\210\237\253\020\305\245\365U=\220\007\261\235\307\304S\3358B\300\356\335\002M ~\352\356\003D\237\342\003\210>\325\246j\345;\034}#76=[\272\233\3057n\373\332\364\3779I\267\202\346;\222\320\335\272\272\025,\256|UE\240\2523\252\341M\3136T\037vw+\343\250\236\347\017p\336Uu\237k\352E\376\361\275+\352\276\353\351\300\253\351C\376\322\211\374/\273J\332UqWG\273*\332\325\271\253\341\256\362\256\356\256\336\300)\bJ\314\257;E\260K\017M%:\316\373}\376\336\357\373\201\377\221#y\222\377\376\243\2451\007\350\242\334\341{!\303\323\203\021\343\371\220X\325\214\215\302&\206\316kIK\225GB\244QA@wCF\020\364A\031J"
+	.string	"Sr|\352M\210>\005\344\334\334~T|\336dU\212'\207=9\031AR|\237\221CN\005\3416\030\2368d\226\222\333\371\201\342\367\030\305+\023\353\357Gl\264,\363f\311\351\340|\234\370\276\321\232X\265&b\257;\361\006\0325L\243\353\353a\342\003\277\272\375\256\204\312\211\241\326\b\301\240PM\367\r\301\262\2117I\211\317\313\317\355\3406\250/|."
+	.string	"\224\273r\333\240\256\217G\224^.\252;\232\256\016\244\254\234\263\332\326^\353\362"
+	.ascii	"B\3065G\314b\f\\\363\302\311\031\027\006\0175\222\006#i\245\020"
+	.ascii	"$\215\302\213\3068h\020\003{\300\001\006\243\022\351\013\206"
+	.ascii	"F\316\310\304`\254Y)\223\225/\326,\346\222\261^\264\032\013\346"
+	.ascii	"\200\226 H\032k\246,i\254\322\256\0376\343Tx2tc\234\222X\225"
+	.ascii	"\274\024\221I\314YR\"o\225\234\016\316I\207Ga\022\373\020\320"
+	.ascii	"\210U?\\h{tXB\034\021\217T\214b\0213Pn\007\267DU\366'\372\023"
+	.ascii	"\273;T\250qP\243\230!\245D$\220\tR\320\264\305\300\002\221!\344"
+	.ascii	"\034\021\340@\312\240\t*HAIZ3&\232\004xJ\253Y/\ri\316\021\347"
+	.ascii	".\n\246\235\305gg1\331\262\211\246\013\322\341\367\270\373\r"
+	.ascii	"\371\2704\247\267\324\205 \274f(~~\302\245\007\322Z\265p[\225"
+	.ascii	"}8\325\300\211\02170o\031\032\201_\3534B'\362)\321$\323\336\303"
+	.ascii	"(2\306H\266\3166Y5D\035I<\006\367`\016A$\375\315\025DK4?M\244"
+	.ascii	"\261&\341JZ\206\231\205R\363\265\003By\202\021Y\212\367\016|"
+	.ascii	"i;\370\362*\364~q\2544"
+	.text
+	.section	.gnu.lto_biquadFilter3Init.20.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\223\004\315\031"
+	.string	"&\256\241F\240\\M:\344el\200\206\372\f\037\252\330\261I\217\257\215:(\207\304\324V\035\236\004\251&P\357\254\241M\025\314|\025\235f\304\024=8:ky \371.!\301fM_y\213\353+GA@\375\223J\310\336;\245\205"
+	.string	"\211"
+	.string	"\217"
+	.ascii	"\342\301\021Il\356>\345\366(\227v\355vY\323\333\335 g\020\017"
+	.ascii	"\"\250#S\354\323\376\323\243\334\016E\343\001v\233\274\364vw"
+	.ascii	"Af \036\364\356\004\302\203\342\007\204\007}\263\325|\347\264"
+	.ascii	"\227r\202\243\312\233\335\205Q#\246\257\273\273\316\333\301J"
+	.ascii	"\347\315\0070\304{\202'\254\234\016w\260\366\354.\217\316Fu0"
+	.ascii	"\225tI\263.\351q\372\336\031@\301\312\351z|\002\030\332]\317"
+	.ascii	"\234n\307\035\336v\315v\f\2732\005\264\210\375\357\356\2326\331"
+	.ascii	">\207\372\307_\371wn\345\177\235\312\257\363\250\337\365\362"
+	.ascii	"\016\34748\247\353\234\246sz\316\351\027\030\177\214\251P\356"
+	.ascii	"\352\370\311Y+P\213\222\227\377\324H&\346S\371=\277\30621\273"
+	.ascii	"t\225\210[\022\245\244\236\266v\327v\236_c\227\330\261<\313\355"
+	.ascii	"S0D\334\322\006\034O\266v\227\200\016Z\205x\360V\007\306\251"
+	.ascii	"X\275\022#M\211(+.k\317*%I!\321$F\251\314\250=[\203H\020\016"
+	.ascii	"\001\266\247\002-\227?N\037~f\201\223P\326\033\037 V\210\233"
+	.ascii	"\021\001\362\250dF\374\212D-uTL\211\2071A\177\023\214\354_\210"
+	.ascii	"\346\234\253\245\347\342\222@\326\356N\260\311oIQ"
+	.string	"ub6f%9\350\323\b\017\322\252\034\033{\305y.\305\335\225p\372s\004\ni\376\274C\345\243twq\324@\177y\013B\220\246\317\357\2752\031\302\363\3065w\350\213\352P\027=\325y41g\277\260\315\347\\\367\007\305\231\307\315\244js\265\323g\357p3\266\231\fY\325`\233\311\220\351\220.f\200\350p\362H\346A\205\215\254\025\221\265\327\013\262\246A\307\024 <\240P\024\001E\221\220\200\320DB5\362\210\305\254\b\326\202fdD#\202\265\230\311\214`D5\033L\310\200i.\310\032\354\210F\253\301^\273\375\2276\231\003\020+$\232d\030uw\310\205O\375\274\007\330\212\232?\220\026\261K\213\372P\2525\201\036R\245\240\207\024\203V\215\031\307\027\322!\244\351{\255>\364\345\0214xH}\350o0%\315\237\177r\300As5\035\236\246\f]\2501`\005\tB\"\"\022\210\0046\205Ic"
+	.ascii	"\003\031\032N\007\0210\2715c(\251U?\016B\243\261\333\033q\344"
+	.ascii	"\031RP\rm\232\375\321\352L-I^s\313i\342\314\325\256K)tlcG\222"
+	.ascii	"\330\302M\321\255\177\244\356\277\311}\326\254\214F%~2\316WB"
+	.ascii	"\374NiT\342'\343\362kJ\351\251\220\001\363\303\216e\261-\210"
+	.ascii	"R\204\001\202\236(\0060nA\244\351\254:)\355R|IH\030\013\277\177"
+	.ascii	"\344\311>j\023\250\2679\346\361\370\356\016c\217\003\343+<\001"
+	.ascii	"\266\230H\247\244J[|\244\356'\315\005\324[:\355\025\177\206\351"
+	.ascii	" \376\017"
+	.text
+	.section	.gnu.lto_biquadFilter3InitLPF.21.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\256"
+	.string	"]\013"
+	.string	"f\225OD \251*\035@\371\222<\204\240\231$\314\373!\205\317Oa\030\307\2274?\312:4\f\b\240^\256!<\3140\004\262\021TX!#P\262\240B4\0040\2357\220^\222\2031\222\242V\252K\032!{\357\224\0028"
+	.string	"?"
+	.string	"8"
+	.string	"\264\335\222c\013\357\234\313Kt\347\274Gt\347L\332\025^\032\330;x\240\222]\330\335\217\0268\371I\372\227\375\262b\241>-\033\273\353\271b\001\270\351mol\177\330\257\b\032\267\335\225[\206\255q\020\016\330>\306\326\250<4vR\035Ve\200"
+	.string	"\220w.c\363\314\362\r\310\303<\363e7\002\006\332\356r\314\341\235\243\250\031\013\236O\373\2563 \377B\371\303nKB\226\351\233:\317\276 \345\252\255\353njS)\245\223\332%&\363+\327\r@Q\2363\004\024v\332\354\0225)\001\373uw\327\264e?\366\327\303~\372\327?;M\202\t\001\340)\344\021b\002\307\020\0341$\340\330\321\340\017\306\305'\314"
+	.string	"\t;\020\235E\235\021<\211\214\302\257$\222H\242\350+\215B\244O4\232\276\316\204\305\021p\374N\2428~\230r_\227\266\fRPK\321\024\007\020"
+	.ascii	"6\207\323$,-\243e\342\245\320hp!\252\325%\343\032\333`\306\026"
+	.ascii	"Z\270\023\206\007b\200\023|\252\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_biquadFilter3UpdateNotch.22.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\357\002\325\022"
+	.string	"\326ayJ\320\224M:Tm4t\340(@"
+	.string	":\340\363\"1\316\t`$T\370\303;\332\266Z%\223\232\033\232\332\321M\f\303\230V\206\350\n\025J4\235k\311*R>1\230N\3454\360\222\315h\201hx\232\213FM\255m\262wJ\001^"
+	.string	"e"
+	.string	"`"
+	.ascii	"2Z\223\374\215\361?>rj\227\247\t\321\356\256x\202\367\252\322"
+	.ascii	"\255X\264>\355\333\270\317x\233\315\005\354\366\344\210v\311"
+	.ascii	"\025'\360^M\236\300\351\325{\312\351\325\243}\344$\214\275\216"
+	.ascii	"\245\234\034Kv\367\243/>~\216\376oO\325vh\237(\t\273\353Y\333"
+	.ascii	"Qq\323\333>`;\306\246/\001\266_u\241?\365\240\337;\320\217\242"
+	.ascii	"\323\225Nwt\232\322\351I\247\237\302\0022\004\002\222\335\024"
+	.ascii	"MM\026W\213h|\350\267\377\233U\253\244\226m\177\307y\214\037"
+	.ascii	"\252\361h:\025r\2020\355\352(x5"
+	.string	"\b\357\3658\003\253R(\367\001G\253\013*\321\241\354\211\026>/5Z\024\310e\207\262(pVP\360^W\001\363\207\353H\2579K\243S\333\260\373p\311\312\355\356\003\033\274\221\210\"\230X\200\334\214W\337\346\364:\225\324\222\330#~s\351\355\256\203S\0041l7\263\311,\242\324LQ\217\242\350{\374\026z5\233F6_\263J\016\245\231e\233\245\017\221\235Ll\2226\251\013\373\335\356\256i\217\375\237\037\300\003\"8\213\211\271\234\\88sa\200\221\201\"\f\024U4\240\350r\"\213\231puna\260\240\005\326 \004\214e\300\311/\026\021\234\305\304`\337L(#\023\276\276\231\230K\346{\211\262\217\245\200C\022\240\370\315\302P\374T\344\276[\332c\013J\270\033\212\343\232n\227'\002\323\317lr5\222\341E4\324\244\016\267\341B8tHt\251\303\225<\320\243: 0\003\031\032u\003B\260:"
+	.ascii	"\r\021)\247\214\216\207(\303U\222\342\233\030j\\\333\300G\263"
+	.ascii	"+\355bfs\260\324\267L\023\370\332&>\315\254h\007\263n>\245\r"
+	.ascii	"g)\"+\r\230]\267o\020[M\350\376\250\253Q_\024J\211\265\272N\271"
+	.ascii	"\316\271\375\221\331\004\257\303\221u\022/\354\020Z\3305lpW\344"
+	.ascii	"0\261\300|\202\357\267\002.yq\r2"
+	.text
+	.section	.gnu.lto_biquadFilterApply.23.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\235\002\275\021"
+	.string	"\346atF\360\320&\035\260\3509(\350\361\246/\314\310t@\212\262{\200\2376\214\244\301\357\246x\222\322\337\246\363Q\031\034\177\232\302I\255\332\022l\236\023/\031O\207\177\217\036\2740#\237_\263\360\301\226n\335\244\221M\244L)\\"
+	.string	"X"
+	.string	"a"
+	.string	"\241I\273@B>\273[\342\005\333#G\303\344i\177\347<\255\2031\007\331\275a\341\263\013\226\230\300\366hp\263\355\207\270\210\226\035f \207\234\307\030\262\020\033\332]\217\344"
+	.string	"\264\307\354\235\366\2508o=[\376c\317@\360\b\275jd\236#\005\273\353|\325d\270\365\266\007\330n`\353H>\354\356\336\363\207\034\374A2}\312\264)\323\\\246?2]\312\264G\246I\231\3362=\312\264\226\351\230\351,\323\232\351\314\364EN;^$\bw/\024\355X\027\361\307\303a\277\335\362c.\231*\230\3300\n\233\f\006\221\027\216\216\032\273[\340\321\f6n\310$\363=\016\333\207N5\035\251\246\302\245\363\035\205\246\250L\243j\220KG\302Md\032"
+	.string	"G\247\207\235d&\211\254\232\332i\236p\331\274\274\204\352\311\214\020\275\246fA.\035\232,\262\rs\022\016\267\335=\361G8\230\260\345<\3721\332\343U@\207\235\231,r\2067`l\022\331\240L\352\006\373\331\356\256\365\306\001,\026\230\027\225\225\306\202qiIE\243\0340\200\262\202"
+	.ascii	"\302\n*Ds\nj\245\302bI\255x-\237J\365\245x-\251\007*/e\365\342"
+	.ascii	"\241F\374\271\250\254<\326\367\255\274\022\270\267;E\3210\243"
+	.ascii	"4\316\220\350\244@&\375\320\023\247\246\324Wp%\375\210\360\024"
+	.ascii	"\245\034\036\372\303\311\310\330\313\006I7\365\320Q\013\227\215"
+	.ascii	"\352>$}l\244Q\003- \320\242\231*\333$D\244;E\204\346FX\220\370"
+	.ascii	"\035\016\233\267\270s-A3cc\320\013\016\342I\357\2209\221F\376"
+	.ascii	"@P\214ci\022\026m\030r\224@\225\261\031\333\017\243t\324>^l\024"
+	.ascii	"\351\370];\3018\214iJ\220]^F\033<6\307(\021\346\003\262Q\302"
+	.ascii	"+\246\334h\342\351\244\230.A\006"
+	.text
+	.section	.gnu.lto_biquadFilter3Apply.24.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`m\n-&"
+	.string	"Z@\260\rD\200\334M:\207V\b\363\033\202\002<\023\224\037\036D\236*\245|\306\260;\365\326Uw\007F\210)hU\276u\326\ng\273\031;sDe\377&\356\032{h\332xJ[\036<\301\344\307nV\354'dK\231R\304"
+	.string	"\252"
+	.string	"\320"
+	.ascii	"jr\252\307\251\236S\275S\255S}\tGb\316P`+K\031m|J3\343\332\221"
+	.ascii	"\227\375f\377\331\217\366\247\375\303\223\366o\345W\216\345Y"
+	.ascii	"\256v\242\205p8\206/\260\304\322`x(\202\026\203\003\2233\031"
+	.ascii	"\032\204f(t,\212\312\027.\302\220X\270}\304\245\365N\345U\202"
+	.ascii	"/Cq\353\232\241\004FD\207\234\262,\247>\272\302\355\243n\342"
+	.ascii	"\300z*"
+	.string	"\3640\317\204\333\307\241>\275\253}(\217\022\274\024\0257*\31310Z\312R\270\263\324\355\243\205O\"?\336\216D~t\320\206s!Yy,.ZX\301S\226%o\207<x\r\372'\036\b\214F\327\365GBY\226V0\0325\356\275\355'\333\037\354 \266FfOG\203\375\360\027\304\274\276%(fb\023\231\021\337C\362c\203U\265\027;\274\264\315\272\226\003M\251{la\227\256\020\373\263\3341\373e\367\357f\267\357g\267\325\245\374\016\216vW=\355\356}x7\270\360\347M\365n\252\251\246zj\252\245\246z\301T+\230\352\004S\0355\325\b\246\032j\252\237\246\372\300T\033\230j\335T;Mu\201\251n\232j\002S\3154\325\003\246Z\300T/Mu\200\251V\232\352\244\251\0060\325HS}4\325FS]4\325\271\251&\232j\334T\017M\265\320T\007M5\320T\337\246\372g\006\276EZ"
+	.ascii	"K\026\367\350AZ\237\321\036\341\271c\344\244h\355\230\230\253"
+	.ascii	"\203\033\003F'\267D[\264Kj_>\350\230\370a\326\347<-\267\037\342"
+	.ascii	"Vh\211v\026\277\220X\355\320\342\226,~)\211c\242\017\304\341"
+	.ascii	"\360"
+	.string	"\206\326\027\264B;\307\2741\321I\353n\232\202\326\251\311o_\006\264\267\375\265a\003T\265?{{\232\257Q\243w\027\362\343\317\022\337\336\214\334q}h\316\220\275\235;\356^\206\f\324Lb\265?\333\325\265ZU\373\362!\306\304\b\300\207\371\355Fh\263\346\245m\253;\252})Y\241mT\377bb\324\003\233\304\275\224\270\225e\371c\013\206\231\200b\363\321WA~\374F\265Y\373Q\265G\353r\253\342\321\333\247]\307%(f\242\037'\216\342)\216!\203\006\256\020&J\\m\375p\231\030!\"k4\004\253*\bX>\017X\f\216Hw`\260u\305\025\"\013\213'\002\250\245\005\354\300\023\221\265A\213\327a\253\004\217\001\223\201#\256\266x\\@\340\026OHX~\226;f\013c\314x\355\n\377\326\357\022\306\347\362\305\337\202#\313\021\tc\333-\331\020\252\225\332\335\324R-Y\02426\265`\245\202"
+	.string	"Y\300E\301\376\360\221`\021\254\202\250M\260d\261\007\217(\250E\240:\302\240\266<-\016\023s7\016\254n\237\f\354\201%\2136\256\264\206\201\3659\255\216Jg|P\031NS\nl\f\030MK`\013\200\251\213&\246\025\260\004~;`\231\226,\266\320\257\001\353[Z\001\312BW,=\t\260\323.-\2256i\003\364)*\001\330\243M\n\200\310\250a\\%\225\032\031\231 %EIZ\003"
+	.string	"\003\021\021\242\325\001\021\200,\246 S\354D\312C\313\034"
+	.string	"\005\006!\035\317R\350\237\023\031!s'\212\206\370-O\211&D\340\346\256\204\365.eBZ\372\244p\322w\345\243\264\342\374j_1\013\r\214\357\0251h(\032\310P_\3543$\312T\376Y;\234\347\361\021\324OA\373\346\301*\006\023\006\373\207<U\031\rK\230\355\363(\312\357f\217\250\210\233\231\037\374"
+	.ascii	"\001\025\",>\301\"0\374}oa\203\265\307\354]\202T\030-Zyb\324"
+	.ascii	"\233\253a\024V\273\3034\231\254\273\211\371/u+\266N\177?\310"
+	.ascii	"\204Q\242\026\261A\037\221\240\313\200\266\210\017\354\004)\262"
+	.ascii	"\026\326\222\263\331B\211\205QS\264\254\236\342\235,/\214d6\225"
+	.ascii	"\277\006\024\262\037\224\301\214\252\376\263\023\244\2568\003"
+	.ascii	"\334%4\303F \036\036\240bu\216\310\033\350\234`/\3034\326\262"
+	.ascii	"N\235FlJ,\326\321\340\210*\303\002\016\253\235\222O\272\274\362"
+	.ascii	"\261\271\361\245\311\006\034\320\003\024]\270\020Q\275\242\362"
+	.ascii	"Ga\"\226\f6\r\356P\225\037\335\007\260o?\364O?\364O?\364O\004"
+	.ascii	"\227\212c\247oj\213\230t\030\240.\bO\0252\351\302=T"
+	.text
+	.section	.gnu.lto_firFilterInit2.25.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`9\002\005\021"
+	.string	"\226_qI\340\262(\035K\301`\334x\370\035\310\346\370_\007\3136\f\177\351\002\004\326\007\023\n\332\377\271S"
+	.string	"\017\217:>\266L\323m\350L\365\306\017\357\001r(\341\261\3628\347\221\254\r\277"
+	.string	"FL\2031Fa\326\256\355\023B\366N)X"
+	.string	"Y"
+	.string	"_"
+	.string	"\273#\206\032\340R\224\036\306\351\034\020\203\321A\323\212\324\351_\370-\356\302<\315\313O\273\267\235\236\335\323\304\007F\007}~$<8\272Hx\320\246\315\343g\211\275\016\013\231\233\240\335\025+\211\233\247\246\377\234\223j\266\331\251h\301\356\232\326l\033\356z\333%\266G\233\316\004T\310>g\264\316\330\377vw]o\366q\376\322m~\322q\277\350\347\017\236\346\377Bj\032R\377$\002\342\206\203\035\273\032z>\366\007\324\245\260}\3731L\273d\233t\344\340\310\036\262\264\034\271\b5R \375\215Ml@\310f\250A\361 \227\372\350k|\202b\036's\r4\332\263\250\276\206>2C\273\017\237q[u\032\036.\013\355\361>#\274\036\273\016<\266i\211\275\272\316<$\274 \016\245j\263\336#+\260\263\221\252M\341\271\230"
+	.string	"\023=Q\265[\227!#\371\001V\273\374\216s\243\335U\340\353`\270"
+	.string	"\302;q\320\177\t\017\006"
+	.string	"\022\001C{\246:!\034\033-\260\225kT1\271\220\344X\252\302\026\330\3125\252\2201\026\022\031c\251NIp\222B\242L Q"
+	.string	"B\253P\257\021V\201E\212\256\262\325*U\242\213\265\322\022U/\027\021E\300\245\205\361%\302\312\362%\226\316\375\267\365f\b!~`*\315'J+\202KX\241\257\331@L\235\371\273m\204\257\264\232\304\250\b* "
+	.ascii	"\203\231\261m\320\215'&7\275)\302\361\3202Z \324v\304\243\303"
+	.ascii	"\336-\367\262\027X\214\245\256E+>\374\322\230\373\342\211\315"
+	.ascii	"\266\215S+ES\313nb#\221\342\261\211\322\216\310'\004s\243\021"
+	.ascii	"\026J0\263\017+\f\326\210\207B\346\330n\fE\b\331\334B\250O"
+	.text
+	.section	.gnu.lto_firFilterInit.26.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\275\003e\027"
+	.string	"\226\350\220J\300\322UcJ\016\344\253\301\321~*L\334\232;\250\265]\032\252\256!\224\006u4Mf\324\375\230*\267FF\213\336\023"
+	.string	"\211\3358g\305\273+\213\212\370\352\271\276\3422\020\300~\324\366o\240X\211\221\372\360$d\357-eJ\001u"
+	.string	"\200"
+	.string	"x"
+	.ascii	"\266\353\346]\366\353\0075\215t\005D\356\006\027)$\374\320\262"
+	.ascii	"\332,-\274\007w\266\367\376\by\300\272\371\322A+\320E\244\003"
+	.ascii	"\326M\027\020\364\325\376\320\211x/\302\271\200{\201\204K\367"
+	.ascii	"\002U\234\200u\323\300\227\2347Y'9o\232gK\035x\342^\370\264s"
+	.ascii	"Du\357\205Y\023\347\275\362\374\037\275\305\343\223\363\272z"
+	.ascii	"\271\367\272\362\370\374n{\333(\266ev\211 \253\352\363F\277y"
+	.ascii	"\340_\276\350\267\017\376\027!\031\212\212\240\343\336\016UA"
+	.ascii	".\224iT\341#=\305\375\205/<\214\307\270\322\215\023\244\\LK9"
+	.ascii	"\230\226v\347\275\351!\244\300*:\241f}\321H7s\337\303\203X\336"
+	.ascii	"\020\r\212hYO4K\013\356\301\235\202\225\r\3410\210\326\372!\356"
+	.ascii	"\354i\215\bz\322\213\217\003\004\341\323\324\275\300\224\233"
+	.ascii	"/\026\350\353\223p/\3029{Z"
+	.string	"?\241\320\324M\037\t\027\216=\252\004\351#\375`%\333\025\345\251e\257a%\023$\225\207\323\234\306\356@\352c\332\334IG \250\352\030>cgR\215B\21675\3552\\\f\200\274\3672\360\233nl>\n\234\363\346\200\035$z\265\312O\017\300\230<\032\357\372\375\270q\231L\373\342kM\372\366\304\373\245\264\037Z\373\244\237\364j\3225\025:\336\232\264\201\276jK\330/\357\275\327\026\310^U\257\00259\232\232\f\346\205\233\315d\266\330Y\223\243\251\311`f\272\231\326L7c\355\262\200\305e\326ra\2662r:\266r\223\3452\330\314`5\033\215f\213\301j624X\354\206\203\255\030\260M\203\354\006\313\331l7\230\013\330{y-P\f\021T\317\372\212\304\341\177\364\230\026P#ueS^Z?\255`\241\236\307':6\307\345\375t\236veUtV\370\354i\317\246\235!\"\216\177j\231\343"
+	.string	"\361\335\3714O\250QXf\02426\022\210D2[\322\034\300\002\231\271u\016\021"
+	.string	"=\216\250&HS\355\033\320*$\t\351\342\217\200-\244(\001iL\242\274\364\207\033\312\022AP$\323\334\362\346\266\220"
+	.string	"\024e\355\bW\035\235R\221\240\207\347\311\253\023\234\037\342\263\214\331w\022`;m\372^\305\244JC$.\355n\210\275)0d\204\226\235\207r\241\033P\353\322u\346\027\2423"
+	.ascii	"Qa9\331\367\324\342\300\334\223>\251DN\340\261?\023\346]QuN*"
+	.ascii	"Ac\217\310.\366\367\327\032@\245UF+1\bx\005\r\277(r\032"
+	.text
+	.section	.gnu.lto_firFilterUpdate.27.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\321\001%\020"
+	.string	"\206^jF\340\262(\035\"\241g\204x \261\250\271\365\020\330\"U\247!j8h@\005\346\007CP\024\214\004Z\371\330\260\001\"\273\002\\\313\275Q11\n\001Y\3479\324\020A\307\027P\207\366\215\263\244\322\026\332'{K\231RS"
+	.string	"O"
+	.string	"W"
+	.string	"\276\211\237\360Nc\371\200]\031\315\315\356Gb\005\241G\1777\260=\206.\262=\332\263q\374\203\331\267\340y\231\331\261\273\234\206\270w\250\351\371 \024\020X\254u\350\341* \346\002Gv\367\265\347\206\230+\023\204\262\273NX\254\303\035o\373\201m\bv\232\004>\334\335\265\312\354\313\374\243\323~"
+	.ascii	"0\r\322\364\026\3231\246!L+L\247\246\037\"B\343F\004\233]\016"
+	.ascii	"?>V'\342\214\260}\373*<[d\213vJ2_\363\277\247\360.c\033\203\354"
+	.ascii	"\306\350\271\331]\022;\b=\216@\321\213\222\347Q\004\005`|\327"
+	.ascii	"l\217\tb>D\275n\372W\tx\317\330\240F\315\231\027\t\227BU\237"
+	.ascii	"\227\037\2524\035\211\347\260\034\177\267\245\252\252\317\013"
+	.ascii	"\204+u\026]*\311\316\360\025\256\t\355n\003\177\306\302JH\304"
+	.ascii	"\243\317\262=^\003\364\320Z\362\307\231\343bg\263\207\375\265"
+	.ascii	"Rg\016,\r**T\364\t\203\005''\223\n\247\022\201\315\246\322*\205"
+	.ascii	"\205\001u\342T]*\325\2318\025jB\2123\255V\270\322\001w*)+\216"
+	.ascii	"\325u+N\364\355\341\252LB\r\235\026uA\235\271\333pBH<:F92rw["
+	.ascii	"\2523\220\252R\250\331pI\036\266/\374\006\244\bb`\214\324\257"
+	.ascii	"Y\331&$ `\002!\242\252\016t\"R<e\036/\210\321\254/l\322\346\307"
+	.ascii	"\030b\331\215\310\231FaH\254\270\336^\253\224D\315\333DC\024"
+	.ascii	"\202\332\343\220\026JA\230b\340\251\200\253\033Ks\240\331'\264"
+	.ascii	"\244\340\207\265\t}0d\333\232p\254\2607\r&H\003\026\225\333."
+	.ascii	"\245\007"
+	.text
+	.section	.gnu.lto_firFilterUpdateAverage.28.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`>\003\215\024"
+	.string	"\366c}H\300\224Q:\264D#\242E&\353\n\210pr\2266\302\252\365\355WCEq\377a\302\216\020\3462\243\013\375\323\210l\016\0376\212$\330\016\001\202\331.\372\024\024\371\226\335\223>\374\257\235\215\034\356\326X\373\215\220-eJ\001e"
+	.string	"^"
+	.string	"k"
+	.ascii	"n\200\272\207\022\301 \225\247\375\024W1;\256\346%\273=7\214"
+	.ascii	"vs)F\200\272\347\334\005|\367P\017\360\335\363\314\006\362\334"
+	.ascii	"\317\336E\023\016\021\323\356\276\224\304g\377\274\2509\363O"
+	.ascii	",\251\234\233\315\277\017\367l\0322z\270\002\270\335D\224\335"
+	.ascii	"\375\320S\347V\313<\261\354\2563\347\306\341>\335v\005\333\016"
+	.ascii	"l\315\0205\337\275+\313\007\216\226;\247\214&\036\233Mv\316&"
+	.ascii	"\325\307~\\\355\261/\364\267\216\373Kb\232\025\323\253\230\006"
+	.ascii	"cZ\225\351T\246Q\232>y\351\317K{1\0355\255\231\316L\237\300\200"
+	.ascii	"\235\035\017z\354n\330\025Y%\357\310\204\355\2036\210S\311\334"
+	.ascii	"W\314.d\235S\2735\230\214v7%!\210tk\251\311\317\001\240\035\225"
+	.ascii	"\316\bO\376\360\213\252R\035b\343\251\355R14u\242v\235\214u\276"
+	.ascii	"\213\364:\">U=\351m(n\034\237\247\237\306\037\266\240\250\236"
+	.ascii	"\036\347\b-w\207\021Fu\001\341h\261\277p\221\252\001 #\251-X"
+	.ascii	"K\317\t\322\322kj\032\261\361\324rg\373\302YX\207\332]\006>Q"
+	.ascii	"\204\031T\211{~4\030db`\236W\024$X\201Y0\001\306\325\372\354"
+	.ascii	"\342\222\275\320X\200\301\274bba\030sy\305\300$\204/\027\331"
+	.ascii	"\314\313U\3001\231\027\331\213&\026\223\275\300\334>\256\366"
+	.ascii	"\030\302\b%\232\326>\226&\231\034}\245,\275\215\247\026\302["
+	.ascii	")\250-CI\024\236c\245$H \242\3728\374l\204$'KBVH\035rwmT}@Ui"
+	.ascii	"\313\220\216\233$b\033v\032\001E\250!8\315*D32AJ\212\322\034"
+	.ascii	"\003\300\002\021)*\017\021@\275c\244h\024&\205\3323\264(RZ\315"
+	.ascii	"b\235`Cg\311\003\253\022\253\223Xp\243\"\2635\200\b9\372\034"
+	.ascii	"\3277=\211!\310`J(\311\226\356\017\325c\367oIAH0\017L\026q\354"
+	.ascii	"|\223\375[L\370\021\024<'Q\221\b\357\222\345S\3070\270I{\024"
+	.ascii	"8\003\344@\371?\034\217\024\232,K(%\211\352#+\rk\3574C\326M\241"
+	.ascii	"\236R\006\260\340\313(Qx<\267,9%k7\204\252\001"
+	.text
+	.section	.gnu.lto_firFilterApply.29.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\206\006\005#"
+	.string	"f?\331G\220\332M:\004\221+\304[\243\353G\253j\025\254\333\360\271j\217@\210\316\373j\315\002U\254\355\302G\374\237\304\225\261v\233}\213\275\022A\275V<\353\246^\257\362/^s$\035\202S\005\004P\241O\310\336;I)\003\312"
+	.string	"\271"
+	.string	"\276"
+	.string	"\314b\314B\376\256\3252\024\036c\262\255\325\262\204[6^\305\260\371\326\3340\263"
+	.ascii	"Cl\271\334\264\200\252V\020\034E*\214<k7\022p\330r\031\257b\214"
+	.ascii	"\302 9\314j\2558\236Kay\342$\340\336e0~b\305\301\025\034T+\217"
+	.ascii	"/Wj\rJ-\324\310s\203#\023nb\265[&\203>\204\360\032\033-\306\344"
+	.ascii	"\324Zu7\036\242<%\007\240<\337C\\Nc\031\344\225\267\342Q\244"
+	.ascii	"S\276\255\226!\200!\263\005\274\342\221\317\304\260\341k\261"
+	.ascii	"\006\323\rP\266\2005xJ\221\005\214!?@\026\022\302\231Y\026&\343"
+	.ascii	"\376\001\263Z\032\231\301g2\206\372\342f\0138\203[\224Pk\335"
+	.ascii	"\336\002\312\340\335\341\335\375\332]\f\2734E}nQgw\004O\351\215"
+	.ascii	"\265j9X\226bu\204j\024\302sy\005\345\311?\372\001\206\325ik["
+	.ascii	"r\246*\301-HR\266\273\335\304B~\240\003\253\321\266\207_gj\243"
+	.ascii	"\355\006\257\372]\273\f\301\307\231\331\236\307\256.'\025\205"
+	.ascii	"\203:\360\344\304Af\003\005\232\2308\214w\351\306b\274J"
+	.string	"I,\344Ez\357Q\367\032\321^\002\264\267H\354\0350{\211f\257M\354\035\242\275\002do\200\331+4{\203d/\320{\001t\357\017\355\365\241\275=bom\366\362\314\336\035\261w\244\275\242\354\245\263w\316^){\377\336\356^F`\363bFCY\2550\322\346\32423\013\021\016\013X\346\273\326\347\354\272\317\255v\372\322\177\357\362\032\363\334w^`\215c\245\377Rx\265\271\324{^C\232\2430\322\177\273;A\215V\237-\223\361L\262\243\262P\251\033m\227V\002V\243\261\254\265V\251[\272\356\224N\356,\026\305J\317\235V\361q9\0302\221:\013\221\356s\2513\033\037W\326\305\373\\\212\361\035\311\332\"b\313\246(\317\036\236\217\257\261\025\3369\317\322wN\307<p\226\251\361Ri\300\370J\325n\231Gy\212\347\337\215\371\237\236}H$o\030*?\317\276#J\227?\234\020\\\205\367\023\375"
+	.string	"\353\031:\371\311\272\260"
+	.string	"~\235\316a|\313q\337\351=\346\343\312\352\264\345\007(vU\347\361Z\305\356C\t\336\334\b\f\024D"
+	.string	"\321\340\003\210\234\020\335\251\\\325\016\005\t\036\b]\t\252^\217jJW\202\347\241\247\233\252:\241\313\031-\225\211]\225\016\005\025U\225\256\026\254,\305\24475=\202\016\254gm\017\273\214\357\332\005@h\324\347\326|:\323\177F\276^P\\\201\337\376c2\036\341|qQ\250\257\234\007\236t\373\321\373\r\2241F?:s\3401=\243;P\222tc\022\243\230\036\365\".\270\333q\037\200\306\307E\205\006\026\250\244\0238T\321\005\234\300\205-+\"\372\320\007\330N\304t[\230\241\f;\001B\007z\200\240\013\335\036\344\205\007t\242\037\354b\250\205J\245\027\370o\245D\372\201'"
+	.string	"\177\3729\200s\007\036\366~z\030\200\200\25018\343\234cdDh$\020\321$Mc\300\002\221\251\032=\021@93\022\005\246)S\007$\032\244\364\257\205\242l\t\037i\245\276\b\301\265v\255\271\004\262\330\007\300\215\204O9\3419\252\211\f2M\027a9\261r\333]\200\006A\r\030:i\361\223\223PbA\244\\s\\\271\362\325\333\203\250\241\347\032\004\203M\003\331\270\370\0266<["
+	.string	"6\237R\363\b\213c\032B\250\3156\361"
+	.ascii	"\344\362\311o\225x_A\177\262#2 \305\314c\225Nxtm\2423\342`\224"
+	.ascii	"\031/c\004h\001\243\201R)\235\232g-\310\003\217oA\257\307.\001"
+	.ascii	"c\311\270]\275\225\234l\031K.\001\322\023Ns\005S\2415)\243\312"
+	.ascii	"\204!>\313\030\233\311\b\270\221\200T\302\030H\351J>\245\301"
+	.ascii	"\305\242\322E*6\244\007V\314L\212*]\330\220>\343H\007\f\211\\"
+	.ascii	"\364\373\357\251C\013*"
+	.text
+	.section	.gnu.lto_firFilterUpdateAndApply.30.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\272\002M\025"
+	.string	"v'\211I\300\322Q:\"\307\360\302\035\250C\230\226\026*\262G\260=i\253lJ\327q\342\234\222\334\256\313!\345\300#.\267\351=\327\365\246\017\277\f\334`\272`\020Z\370\\\304\304\376\1775\2509}\023\021\271\313\023k\277\021B\344N)n"
+	.string	"r"
+	.string	"s"
+	.ascii	"^\355\326\3401\264\273%~\240z\310\332\275>\355\367\374\005\355"
+	.ascii	"%\314\t\354\336(\r\355\226%V\240z\350Re\333oq\0274\233\007\226"
+	.ascii	"(t\336\264C\223\333\261\273\256\326\017\210\017\301\033\020\037"
+	.ascii	"\352\211\323\016\352\244\371)\224\237\203<I\274\033.\346\240"
+	.ascii	"\210+\bN\006l\355\356w\237\037p\2669S(\273\353y\303\331\334\341"
+	.ascii	"mC\260\235b\353H\3404K\234^\211\323\252p:\025N\213s:\004\247"
+	.ascii	"\301\373\374\372\362\237\003Br\334\220\020\265\013\"\312\307"
+	.ascii	".\205D)\374\334w\263\303\360c<(\202\022\317\356\216:puW\261$"
+	.ascii	"\017G\337k\316\353f\257\t\031\221\363sz\b\204b\363\220\322\264"
+	.ascii	"\343\264[\222<\034{\257\317\003\315^\302\2105+\033\246\237\323"
+	.ascii	"C?7\263\307\323\354\321f\365^s\336\307\274\276\216o!\361a\202"
+	.ascii	"\034\022+\005\225\245\237a\001\336I\242JW:s3+l3\312\242\252T"
+	.ascii	"u\320\374H)\021)\362\373\r\252vR\0245\245\252c\246\204\r\303"
+	.ascii	"y\244\250\"\216}\206\205T\273\353\300\227\321A\203\257\003\243"
+	.ascii	"\001\230zj3\312\337\235Ud\344{\320\307\0204p\250^\247\007z\253"
+	.ascii	"6{x\366\236|;{\330\245m*\216}p\365\306\016\247\307/\034\\Z`\241"
+	.ascii	"O\030,8aiP\201\305\244\200h\025\023\331\312K\006\030\213\253"
+	.ascii	"%F\2221\025W\013l\002\351R\221mp\231\2148\346\262\"s\275\304"
+	.ascii	"b2\327X\326n\207\332\252\251\315 s\252\275ba\376\026\352\211"
+	.ascii	"\t\031\215q\b\224o\377\237\263zOK5PqL\212H\244\200\237\310/\007"
+	.ascii	"\200\"\244\271\2731\2528\0365\245\024~l\310L\036\260\037\221"
+	.ascii	"\252Q\021\344\364\314\242#\237ot\301\2746 @\002\242\f\262\362"
+	.ascii	"t\"R\235\"\017\355#\320\333x*\200\031I`\"\326I\203\311\353\f"
+	.ascii	"\307\336\022\2022\214\331\200\261\312\251\371\016,\r/\232\230"
+	.ascii	"\221Q040\031\301\260\204\265H\233a\013\031\260$\304\310\260\217"
+	.ascii	"i\024P\b\001tQ\315\261\037\201(33\207\273\246\001CB\303<T\257"
+	.ascii	"!\022\254\346\320\034\302\034[]\240\006\201qW\3277\243YO\302"
+	.ascii	"\372b\226`c\223\220\215\032fQ\271\355\nz"
+	.text
+	.section	.gnu.lto_firFilterCalcPartialAverage.31.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`{\004\335\035"
+	.string	"\2667\277J\260\324Q:\224\202q\237W\207\224Lt\276$a\305\315\207\210R\246\302\303\025*\220\300q\210\214\b\267\227\342:\246\347\375\"}\t\021}M\365\337H\272\260\363\203\265\377\324\35291"
+	.string	"\016\001Lf\006\332\017\376#\226\220-wJ\001\253"
+	.string	"\240"
+	.string	"\251"
+	.string	"e\020\007\261\253\326\312\363\321\024\034+\341\263\323V\300`\367\"#N\253<)'&\224\037a\274\370|\332\227:\221\335\201$NS+\r\256\253Z\201\t|\240\374h`)\344Cv\266\025\005\332\310q+D\220\250\264\324Zm;\267!?\322\007 ?n\r\377\353\024x\223sw\0309\322\235;_xz\245UL\372\021\035FaGJP\263\037\022}\300\245\013\353\304O\337\2177\311\030\017\026\037\227N\251\001(3\256\314~GT\307)k\205\354g4\367\304\037\310r\222\364c\361\t\223Pk\365L\372\245\270\313\333V\262}\301\246I\001[\333\222*\232_\236\305%+\333\223\300\203w"
+	.string	"\243hzy\026UD\251\323\313\006\022\315}\262\377\300\006\027./\r['\007\247\006\233\276y\221\337\246\346\300?"
+	.ascii	"\315\2077m\346S\367\354\301[\0066\035\263\323\262\235\216\321"
+	.ascii	"i\030\330t9N\303\310i\222\234\036\307i\272\323K\247'\235\276"
+	.ascii	"\200\032\020(\031"
+	.string	"\204\265*}u\251OF\254\035\037\376S\177\360k?\246\303\307?\342\023-\213A\r\205UU\026\312\217\267w>\325\205\226\305\226\202\266*\211P\334\364\254\f+\224\037c1|>e%%\021\212{\213J\262\265\235\255\317\326\331\017\021\234\266:\013\212L9\373\240\314\226\233\263\307\322s\342]\311\007[\371\034\366\276&r\351\302\366=\037\274\371ez3!\307%\367\275\036\274\035w\265n\307\342@\267v\343&\212<f+\241hz\315\021g\027g\247V\317\211\267\273\307\375j\356\200-\251Y\361\305\203T\361\035\321\332\352\214d\031M.\2565\325z>\263\265}\317\2117\277\034Sl\261\302\342\321o\315\363\017\037\001\006\361\364\207\214\312T\263\237\372\316\267f\217\004\351\213\335\341I\202\312Z\215\032\370H0\344\312\034\037}\022\344\307\0078\334\034\272\351V\304m\203\020n\034\022\n\221\373\031\ra\201\002\b@\f6"
+	.string	"\365"
+	.ascii	" \375\323\243\273\ry\300\001\331\204rAA\271\037\233\020NC\220"
+	.ascii	"\355G\007\302\326#\300\271\0177\235m(\227\323\331d\300\332uJ"
+	.ascii	"\312,\315\315\356\024-\3171K\2637\373\336\022\331\306\354{]6"
+	.ascii	"+\333I\205\364\345\302\307\212?\272`\373d\231\246Qg\267DIM\236"
+	.ascii	"\323\326g:\316\246DA\315\232\235Y\337\211/\263\b91\346\354\205"
+	.ascii	"/\261D9\315W]f}4*F\232\300ll\377\363b\020\314\026\330rQd\212"
+	.ascii	"R\037\234\231\323\313\264\375\360\264\326Z\311}\362uDqQ\234T"
+	.ascii	"\2501$\304\034d\006\221\231@\002\241\240\302Tc`\002!cv\036\021"
+	.ascii	"\3009$fa\3526d\004\251\324F\220\233\177\365\b\272\021\326}\224"
+	.ascii	"\205\264\026U\344B\320\250\273(\365E\241\305\341\362\377\371"
+	.ascii	"\023\255\207a\262\034Uk\227\023\254v\032X\206\307M\377\321+b"
+	.ascii	"\302\276<6\203\306\240\370[\317A\006Q\346\253zjH\020\244w\300"
+	.ascii	"d;b\320\354\207%=\346\275Up0\314S\302A\033\343`\021\351_3\203"
+	.ascii	"\r8\324\225\330y\302q}_\331\247\2274$\224\260\2673a\t\201\222"
+	.ascii	"Q\3257\316@\334\231\030s1\004\234T\210|\2346\354\211\232LG\312"
+	.ascii	"\210T\263\0064\312\334\t\315\037"
+	.text
+	.section	.gnu.lto_firFilterCalcMovingAverage.32.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\243"
+	.string	"\215\n"
+	.string	"\206\224I@@k\224\016\003\223\300q\215\256\227V:\2134\203\243Y\317\256+\261R\372v\320(\273\2765D\341Y\263\216x\257\332vQFQ\303\310\231#\f(\220\216W\234!\3423\036\315EB\b\331R\246\0246"
+	.string	"5"
+	.string	"7"
+	.string	"\276\203?\370l\013\021\\`\272\206\224\210\302\207\335\335(\237\\\267\342)\256[\252\340\337\363\363\037\341q\225\nG$\317\023\003\331]\347\210t\340\326\333\276\260\035b_\013\340\177e:\306\264j:3\375\254\002\245\022\361\260k \\m\006\353B\003\333\237-\261#T\033O\373\247C\370\016v.\261[\332\200\332\0055\234\221\3352\230\331\016\035B\034RU/\n\301\275B\227\212a\017\370\204M\266[\340\303\227\340\021\310v\367\246[~\347\272u\23508}2\264\004\301&\b\033\364\244&\260\037WKv\246\261\007\256tpT0\036"
+	.string	"0\332\304e\213\346]8\0012\230M\323q\\g\3314\231\021n\263x\233M\263p'\340\342m\234\256\3636\t\270\2671\245|\024\344\250WL\037\302"
+	.string	"\312\320\252Q5\017"
+	.ascii	"4\211H\313\024\231\241\301\b/&\334S\301\200\201\020\345\007("
+	.ascii	"5\240k8\274,\340\r&\036\334}R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_firFilterLastInput.33.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\354\001\275\020"
+	.string	"\226`oE\360\262&\035J\212\231\016\324\331\216b\326\352\216\310\224\251\241X\263\202M\347\216\311\270\311\r\233q\362\343\033\243\262\305-\246\302\027!\3572Gx\016CJ\214]\005d|\334\n\367\245p\203\032k\214\020\262\367\2262\245Z"
+	.string	"W"
+	.string	"_"
+	.string	"\027\260{#4c\267c`\005\331\241\273\314\266\257\342+X\366\317\353L\344\234H\307\214\217\217\335\335H>\022\017\337\t\304C-q\326\341\323d\371\030\312{\275z\320\270Z\2076\177"
+	.string	"\\6\327\222+\346\221\354\356{\2365.\230L\few\2354.\020w\274m\n\266'\330\031!\356Z\251$\354\277\325\033\033K\227^Z\344\245I\357\376\321Kk0\235\3054\026\323\021\246\341K\277\227VM\247\246\037\240\300\013G\005\033\273\036\206"
+	.string	"\331\033\220\006\n\333,\277\307#\255+9O\207\254\365!{A\264\203\307\356.8\264\204L\323)y\332\337y\013\326;\227z\231\024\232F\315 \247\307`\201:\202#\244\351y\016a\304K\026=\370\224t}z"
+	.string	"(\237\351\252\"j"
+	.ascii	"HF\004\214\252~F\210\215:\214T\023\234\347\356\266\324\251x%"
+	.ascii	"\235\350\031\212\311\037\2661\334E*\333\215y\340\373\\\340\262"
+	.ascii	"\234C\337%\036^\023\f\355\274\344\020g\215\240\034\233E\016\034"
+	.ascii	"N**\024\364\211\203\006'+&*+\246\001\321)\246\325\251%\003je"
+	.ascii	"Sq\251\024\227\262\251P\026R[\312j\303fB`N\303i\265\265p\334"
+	.ascii	"j\033\331v\267\177\2537\316GR\022\016\213\227\212\250\2465\266"
+	.ascii	"KJ\362\2420\366e\250\374\343\263\304\303\222\276&\004\246P3\275"
+	.ascii	"\214\316\273\203bT,$ `\"\"G\355\204DH30<\206\027a|\f\305\031"
+	.ascii	"\"\201\r%\202 \356\311y\2354\037^3\263c-\270\274B]\246\363uV"
+	.ascii	"\324,=\220\224 nQ\321q\003Y\270 \022\234g\230\361H\234,A\202"
+	.ascii	"\256\233\270 \234\240t\203\222\370<k\214\235\336\332Y\006"
+	.text
+	.section	.gnu.lto_firFilterDenoiseInit.34.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\347\002\345\025"
+	.string	"\026i\220J\300\020)\035\233sJ\220:\266A\373O=g=\304r\016\311\016\023 \232\251t\203|\366}\023m\277\322Z\277\237n\202\2537\023k\314\332Y/\241\310\374[\243,:\021\347zeM\331]1\303\377fq\265Q\362\t!r\247\024u"
+	.string	"z"
+	.string	"|"
+	.ascii	"\027\222\261]'\357\262[ d\273\342?\274\003\315\320\220\372\363"
+	.ascii	"\355H0O\206\320\326\006\331R;E\205\367a\006o\255\"\212\020\314"
+	.ascii	"\223\255*;\265\337\363\024\274\373\320\\@\2558NH\265\016Q\214"
+	.ascii	"\300<\351\341\t\224'\315\017(O\232g\337\3700\247\276\250*\030"
+	.ascii	"DUk\215\255\211\363Ny\376\203\336\022\332\324\234\262\036\324"
+	.ascii	"ZM\20567\367\336\366\211m\r\366.\b\366\307Zk\365\342\330K\375"
+	.ascii	"\272\317\017\340\303\377\343@\177k\251\315\245f\261\250\313\222"
+	.ascii	"\232,\251\307\222z\227\232\226\324\0170BE\243BS\255\035\212<"
+	.ascii	"\352\023\251\264\343\013}I\346,|\027?\272\022\213\247\207+\t"
+	.ascii	"iD\022\022I\215\237\021\321\203\021\261\300\317\253\311\253C"
+	.ascii	"u\324q\032\352Ipr$([\372\"\177\350-dNd\246qXmDH\\\005C\240\234"
+	.ascii	"\364\314<i2\006\255(\025'\252\244^k\256)P\307\213\263\366\265"
+	.ascii	"\016r\232\200S_\372\007\221\r\324\225\376\017B<8\360\344\240"
+	.ascii	"\272\231\312')\370\215X\373\242\233\364\250\225\313e\355\316"
+	.ascii	"\b^Qr\355\334Y^X\256\311ok<\256\217>uSk\365\201_\255\275\023"
+	.ascii	"r\307(\240\f\037-z\367;\356\201(|\273{\240\324\307\322-!\006"
+	.ascii	"\257Z\3735@\004J\365h\321\264i\007T\245V\366\320G\267D7\033\356"
+	.ascii	"6\316\234.\353\033,\346\266\233\345Hv\271\331\322r\270\035\314"
+	.ascii	"y\262\354h6\335l\367\302\020\241\006\303\262\253\235\023N\335"
+	.ascii	"\005\033\210W\030\244\254\324T,\324`\"\245[`:\332\316\005W\213"
+	.ascii	"\275\234\271\334\331\022{\301\315r\261\026]L\fV\342\023\206\246"
+	.ascii	"\213\355\316S\027s\r{\037\353\342\230B\325So}6\327\266=\206\231"
+	.ascii	"\314Zk\003\037F\r\007bC\347\244OS\236\\\242\020G\217\026\375"
+	.ascii	"\242?\350\0017 \300\002!\"\253\003\324\346\013\001\021\251\246"
+	.ascii	"\f\304SD\013D\3260\005\320I0\232\203Q\344#1|>\317\277\231\270"
+	.ascii	"\241\215f\006\023u\302\215\016\037Fc\303Bl\374-1\231\030a\326"
+	.ascii	"\264\002\331\273\264\354\220\263\233\314 \362u@\234\231Ev&\023"
+	.ascii	"\304|\0318\221\215\366\013\362^\363\b\327\321Z\007q\023\2343"
+	.ascii	"\340\214\345\355g\214r,\243\315\202`\270\241[^\b\207\f"
+	.text
+	.section	.gnu.lto_firFilterDenoiseUpdate.35.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\304\003\325\027"
+	.string	"\206\352\222K\300\224Q:d\242\324\024\356Ej{C9\220\252\200Jl\252\325\027\313\017\300\363\236v\321!\247\023\246\344\246\372j\267\005%C~\332\234\2777\220\3036E1$\002(\273\021V\224\tM\354\246\310W4\274\266\332O\b\331DJ\231\002~"
+	.string	"q"
+	.string	"\201"
+	.ascii	"w@.%\231^\226\377\335\355\013\331\362xV@"
+	.string	"\255B<\222j\345\271\274\205\\z\036\371\377\333b]\310~3\344\345\210\266Gp\303\321\220Zk\251\262'\342\322pM\304\245}be;\2124l\226}{v|\002\336\020\307\030  \222\355\026\264\224u\253\205*\265V\r\034\002m\207-8& \326\315'<q2\341c{\313?7\032\363\030Sk=\333n\037\366\344\376\307\360\377\301\337B\002\f\276G\020.\220DK\277<\342\322m\002\300\335\214\203\337\336\246| tT.\362\363z\270\207\376\rk\013\375\314o1\037e\215vM\226\267[\302|\026\363W\314'i\276\212\371\251\346\243\230O2\177l\276\330|\312\374\220\371\335|n\376\246\264X8M@\252\325C\320Hm\242J(\376\313~\325O\376^\230\327\350f\030\240\376\3208$\325Z]\0027\307\016\233l>RKA\343`lm\334d\371\235+\271\261Y\200JKb\227\272\335lDx`k"
+	.string	"\370\r\370=\221\370Dl\221\r\327\324=t\332\3342=\240\017\023\371\377Z\363'\355\025\335n\026\324\0356\037\251\341h\260\245q\263{\005\334\315z\306\3172\267\266 \bv\233[\374Q\303\3218x\366\2050\351\377\031V\306\315\223\\\255\265\301oac\344,]\375\f\350H\374;\013\343'Yk\r:;876\3640\n\022\300\324,\220P\343*\021?\343\212\321\350T\260\251)o`\257\027l\246\274\261\211\360*gb9\245+\3450\034\232X\251\003\203\305J\025\257n\013\275\201KE\"J\353\226:\320V\263\372\347?\253\0373k\332h\356\331\247\326Y\201U\243\364x6\331+\022U3\375t\235\250Vu\270\243\206\243\255\020SMv\253\267\346\243\235\352\360\254\001Q\301\265\326\036\212j\3322\275\034\024\326\207j\226\022d\343\bO\250q8i\311\320\020\005\023&iAI\332\200\002\031\271\252\033\021"
+	.string	"U\007Q)H\313\305d\020\322\247\357\363\267\210\307E\214\270VM/!\366,=\035\272\321AK\347\263x"
+	.string	"\232q\313qx{\037P\234\250\031pp<\025\344\207\231\033\2569 \262\034O\374\210z\013\210\235\323,AT\362N\221\204$\230\203\004v\fQ\344\316s0\270\"i\370\013\265Yc\321\006\351d}\303\n\310\227\202\260\255$\316\020+\227\333CoCG\244\006\372\226O"
+	.ascii	"\022N\006OHU\252\036\212\305PSPR+X\250\035\346OK\357=\264Sx\361"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_firFilterDenoise3Update.36.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`#\002\255\022"
+	.string	"F\344zF\340\360&\035\316\037t\024zS\254o\3412\230\315\214+\027\270\222f\343G\3563\375a.\004U\214\275\315|3\346\032\021:\216+}\307\r\346\260\006\347\005\036-\310\333Q\314\301\223\371\242\376\252\307\353\333\022\262\245L)e"
+	.string	"`"
+	.string	"d"
+	.ascii	"7\361\023\256\007]\270\200]\236\032\213\335\217\304\"\361\234"
+	.ascii	"\277\027\350\316\305\023\350\316\331e\333\370\347\2637\322\261"
+	.ascii	"\241\341\330]O=X\017\277\033\246\353\034\324t\371\247\023\241"
+	.ascii	"#\250\315\220\315^\347\340\307\356\006\230\325\300\005y3\233"
+	.ascii	"I(\002\347z\242\213\324\212d3\234\347\351dw\235\262\331\206\273"
+	.ascii	"\273\355\226\355\tvR\bv\352A\277\307\277\037u\332\035a\372\364"
+	.ascii	"t\247i\016\246a\246U\323\251\351\177\030\200Acu\333\315p\323"
+	.ascii	"\261J\234\213\020\247\375\366#\t\225\217\302'2*\226P\331\366"
+	.ascii	"\207\236\302u\232\221\342KC,2\362a\332\335\221s\226\020\317\205"
+	.ascii	"\300\243\354\bB\225\237\217@>\226f\bC\204x.vP=\3557N\t\265S\373"
+	.ascii	"%&/;iH\215\276\314\251\207v\232M1 e\342\264[\212\375\370*d\274"
+	.ascii	"\"~"
+	.string	"\360}\3245\335\344\244\242T\3651 x\313\350\256\251\217\375\314\344\315Q\257 H6;`y\263G\322\013\325\335}\251G~\332\037p\200\245\315':\034\261\223I-jl\332\354\357\225\332c\377\273\273V\236/+\031\024\b\023\343\322\262\342l\322\200\201\311\212\203\n+%\003:\247\224\264T`,\254V\274\026\026\013\013+\305kY\241\260x)\255\027\257\344\200Y.*-\017\206\305jy\250o\377U\036\013=&\305P\202\351\f\247=\006P\323\224j-G\036\365\306\266I\036\025B\215&s\330v\242\236\300\322v\bSz\332C\024<jJ\037\323I\220s\322\224O.\311\002+ P\002A\214\231\035d\"RM\021\343Y\037\016vW:\263\315\371t\343\337\206\301}\254\330\275\256\262R\226\210C\0340\322\0033\034\274|DJ\346\212\026\373\247\264\204\031]\224\307\335`\263\363\330\034v\261\342\201\205\305N\326"
+	.ascii	"Y\034\3011LMl\025f\\\016\210\f|/\303\343F\033,\354m\016\370\247"
+	.ascii	"\334\271\314\023"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\213\003\365\f"
+	.string	"\024\022\207\004"
+	.string	""
+	.string	""
+	.string	"\002\017\177%\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\f&\200\204\001"
+	.string	""
+	.string	"\003\002\016\177'\214\374\340\007\r(\004\177)\272\200\202\002\005\177*\006\177+\007\177,\b\177-\t\177.\001\n\177/\004\013\1770\021\1771\371\377\377\377\003\020\1772\022\1773\023\1774\024\1775\001\025\1776\026\1777\027\1778\030\1779\031\177:\032\177;\033\177<\034\177=\035\177>\360\372\2508\036\177?\037\177@\356 \177A!\177B\"\177C#\177D$\177E\001(\177F\377\037"
+	.string	""
+	.string	"\200\200\200\001,\177G&\177H%\177I)\177J*\177K+\177L\003\002!\371\321\360\372\003\001\344\001\003\013$\244\001\003\013#\006\003\013\"\344\006\003\f!\304\006\003\f%\244\007\003\f\002\240\276\320\347"
+	.string	"\001\202r\003\r\fB\003\016\242\007\003\017\200\004\001\342\001\006\003\020\f\001\001b\003\021\020\022\017b\003\025&\304\n\003\026\244\016\003\032\031\302\013\003\036'\344\001\003 \037\201\200\200\200\003\001\342\006"
+	.string	"? 0\003\241M\332C\343\320\236L\356 :0FE\201\230WG\320\222r\0364\306r\r\035\316\320\033\304\2255\225\203Z\217\340\b\016p 8\\\201\360\222K\215M0d/\355~\356>\027\350s\3609)\311\362G\234\b\350\2200\337\360\r\337\360\215\337\370\346"
+	.ascii	"\354\360M\274\301\360\r\370\215\355o@\3707\361\n\006\336\301"
+	.ascii	"\370\206o\300\237E\200y\003\264\001A\234\361\031\206\342!("
+	.text
+	.section	.gnu.lto_.refs.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001\023"
+	.string	""
+	.string	"\001\025"
+	.string	"\003\002"
+	.string	"\003\002"
+	.string	"\001\001\b"
+	.string	"\001\003\021"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d32deef8bdff1681,"e",@progbits
+	.string	"(\265/\375`\325/\375\303"
+	.string	":1\331BR N\301U\350\365\216\210V\264\"\212\222\220\262J\2422PZy`&7I\005)\273\275\034\265\"\252(\""
+	.ascii	"\251\214\260\331\327\332%.L;ab\22335r\\\036i\266=\257+\037y~"
+	.ascii	"~\375\223\315\r\246,-\333\266\243\316\326\202qK\242\334r\247"
+	.ascii	"\213\003\033\004=\004\200Xn<\304,\270\210m`!6b\"\352\344%\337"
+	.ascii	"s\222\2257\3709\335\002\251\235\322O\213\336\320\007\345\226"
+	.ascii	"\345\251\344\357\311K\n\205\332\321;\264&\364{\222@\343\006V"
+	.ascii	"\304\310\246[\250\2240\261\037\320\233b\210\033\304B\275\346"
+	.ascii	"\322\020\356+-\201h\311(n+C5\204]kEG\372\332\236aP\262\334\376"
+	.ascii	"|\270\005z\261=\247\320CJH\251\320*T\n5\244NZH\005O\007i\024"
+	.ascii	"\032\366l{\3227?07\265B\nx'\275C\243ZE\330\236$\324$\376@rm\372"
+	.ascii	"\024\315\322\016\250\020{\352eO\271\354\251\226=\345aO\261\354"
+	.ascii	")\016\276\275\"b\363\017\217[o\310\205\256\351\302\357\311\236"
+	.ascii	"\242\341\321\265\272<\372\204:)\036\275\033\242x\224\215\332"
+	.ascii	")\351\264<\2200\323w\026\325,\366\351\221=\265\373i\035Ec;)R"
+	.ascii	"\207\334\264\t\316\251\223\352\026G\204\310\315\364\246(Co\350"
+	.ascii	"\230\360\262+\316\210{\316\303L\227\220\"C\270O\223\366Tm\255"
+	.ascii	"\310\b6\"pT\t\225\243K\250\223\306Q\267\3237\212\344\315\274"
+	.ascii	"w\r-\311\2354/\367\312\241i\335{\323\250\032\215\243G\356\354"
+	.ascii	"\300\350^9\250\232'|gS\016\357\275$\220\340\201\004\022\212\315"
+	.ascii	"$N~0\375\rXz)\207\242\215\004\254L\n\3777 \273(\374\306~\306"
+	.ascii	">\306\336\332\017(\207b\337Q\016\305\237\0321s\001\213\263B\343"
+	.ascii	"\246fL\233\364\354\324\214\226]\004\n\227\031\272a\3672\251Y"
+	.ascii	"\337\253\244\024\004\032JAh\201\343\241"
+	.string	",+6%\243cu\351\202\212\211\001\214\232\226\330\036\367\351\330O\305(\363N\246\272w\350\336\273\201\013\331\017!\036\334gR\r\321\233\"%\202sZ\344\247`4\354\246\230\324\304\274h\367\336\032\027\304\033G\305\315\227I9\024-\275\261?\273\240=\370\351\002\030\360S\007\374T\001?m@\337\374\264\205\237\266\200\005\377?\300+x@\277T\231B\200(?\r\344\0255\177\335\243\353s\326#s7\177\035\373Y\004\310\237\212\360\323\021~Z\200\237\206\360\323\017?%\300O\rp\017P\340\031\374\225\213\006\007i1(\026\007u\370\253\321O\2010P\n~Z\177Z\244/\224\251\245-V\356\341\257)(\007N\363W\016|\346\257\021\370)\b\330\004\377\253\374'\374/\345\277\341\177*\377\237\377\01398\207\277\256\360S(Vq\373\327\007\360\317\317\307-\021\036\3633\330\317!H`\374\031\305\211\t\\\346\257!T"
+	.ascii	"\374\277\373\357\344?\336^\2559\314\317Y\342\230\274\370s\224"
+	.ascii	"\377K\376+\371\237\344{\306$\257?\247\375\334\363s\316\317\026"
+	.ascii	"\370\371\205\237W\370\031\347g\021~\246"
+	.string	"\371\371\345\347\376)\226\237Z\371i\225\237\022\376T\360\247}?\335\373\351\335O\347~\332\366\323\264\2376\177\032\366S\257\237f\375\364\352\247U?\215\372\251\322O]\374\264\350\247.\370)\n~\n\364S\343OM\3744\347\247!\370\251\007~\332\201\237\276\360S\020?=\300Oc\376[\371\257\367\177\356\177\363?\363\247>\377;\370O\303O1\360\323\031~:\201\237j\360\277\002?\345\340\2470\374\364\001\3773\360S\021?\305\371i\210\237\232\360\323\022~\212\200\237\316\374T\346?\226\377W\376\357\375g\362\377\354\377\030\005\376\323\375\377 111\361\267'\374-\037\370C \021tK`i\334|\203\315\223Z\"\302\315\2106\326\336np3\226;\213KA\270\016\271\371J\313\265\034\352\n\013\271\312\340\225'\r\026\346\026\037\225s\025'\214\031\242\215@n6\344\247L\214\032\207N)\266\203\020  \023\326{\245"
+	.ascii	"\265nS\323\007\031\242'?\232H9\023\306\f\225\201\361q\263 ?]"
+	.ascii	"\366\254\236\364=\243\324-\036/f\314\031\202\r\nq\017R7\026|"
+	.ascii	"\021%\220\227\330\211i\364\314\263\035\266\370\370\370\317\336"
+	.ascii	"{\003\231<;m\311\307\232\337\371\017\004A\037@\270\271\217\306"
+	.ascii	"\311\325\223d\233\335\2123\362Bb;(y\362\204\365h\323\255\203"
+	.ascii	"kQ\037Z\220\222~\210yg\275\031 M\334\346\270\031\357\2025u?\270"
+	.ascii	"\372\232\314\026\341R\240f\224\355\250\223\355\250\031\025\252"
+	.ascii	"Kb\036\340"
+	.string	"\235\303\336\314\325\325q\023k\345\204\233\f\266\340u\365P\343~/\331\242Z\ng&\324\311L\350\330\313\362\206@7\325\365u\223\222\016\360&\2627E)\260\022\206;\307\375\034\307r10/\222K\331\225\251\256\303\333\224\364\341\347%g\271;e\356\r\273\367v@\215@y\222\204\373\206wR mB\324\356\354\317\177\361*\223\356\2750Z\2307IH\346\264\205\316\320\372\276w\001a\367\206!\026Z.\247\022\212\3736\340&\277\206\224J\030\\\346MZ6\253\222K3<%\f\230\267\306\006\267yu\227\314*\245\246\272|\231\227\336\241*%\023,\231TIK&U\322\346\016Q%\357e*\331,\321\224I\272lV)-\233TJ\030\334\241\233\274Me\r;D\245\264\254\243R\262Y6\225J\313\241*%\f\202 \372hj!\206\027\205n-\207\356\213\243(e\222\315\335\222Iu\375\356\245hD7\211"
+	.ascii	"\367FQ%\371)gP7\241\273\027BkJ*\312\274\367\002\340H\310\212"
+	.ascii	"\352\016\335-\273\250\356\355\022Bq\217NH"
+	.string	"2\357\256\016z\227\274\212\272.\210\356\r\300\321\275Iz\357\356\275\311{\257KR\024\363\336'\233\245\326\321\321\275M\036\216nT\362\215\350^F\203\342\246\264lZQ\341\274\2355\265n\0213I\265\256_U\222m&\307\256\213{/\235b\265\224b\020r\177`$/C\314\232\027\276)4\320~\260\233\024@'\253)\313l\334F\235\354\374m\336\313\234\251J\246&\316\017\305\032\372\241\310h\234F\235#\260\332i\023>\362\026%\36329+KZ\031\267Me\262\247#\024kb\"\035\201)\203\204\224E\305g\fxc\250\213\273\031\304F\237\036\367\253\220\375\b\026\243lL\304\313\212\232\327\341\252\006\265\232\242<\235\274\016\313\230\311cL\306E\250\223\305\370\353,\204\207\260\030\0079\034\275C{\341\207\240\f\022 jD2}&\362s\027\003\241\371zZ\272q3\030\3169L&I\022\245\025\367\253\320\233\342"
+	.ascii	"\236O{\326\263g9+\200z\367\266;W\300S\343\342f\272\304\030za"
+	.ascii	"eK\253\311XX\351`\2768\373\210\\\371`\0321PXUo=<\250a2\035]\361"
+	.ascii	"\330\261\027\003\360\bwV3\301\350t\254\331+\266\342\033\234\203"
+	.ascii	"m\260\016\306A\235\214\305Sg*\256q\017OL\303\2062'\252\326\004"
+	.ascii	"\205\203\305RoS\201(\351\245H\250\351\3114#\3529\202\261\330"
+	.ascii	"\351\316:\226\324\201(\357\211\221\252x\211&is\205\362\244\264"
+	.ascii	"\356e\236\223D\240\300X\254\304K\225\251\345b\304\212\306\363"
+	.ascii	"^\346L^^\025\224M\237\305,\365\300\\\366\354\203\006G9-\261`"
+	.ascii	"s\336\311Po2\2521\033\031(\205lh:\354\271\312\236\233\354\031"
+	.ascii	"\206=\273\260\037(\207\"\303\340\030\324\351\001"
+	.string	"\313\250I\262\232\231\033\204\334\200\205\373<dO=(\322D\352A\361\364\212\rA9\024U\240\034^\274\255\210D\344\220\217\217\330\005\r\r\036O-\270[\274\320T\306\002J\342\037\265S\242\005\335QM\343-\325P\267\245N\240\272W\331R5\210\367*k(\005\201R\020z\210\225\017\265b\377\245\314\266\023\316\373\251\305\211\256F\026w\f\275)\266\214f\352\031SQ0^~\330\367\222\020\257.(\227\f\232\232p6\204\321$Ee\262p\212\273a\274c\300(\362\221E\311\212\205\233\241\275}Z\313\324-\272E\277`\223\352;\304(G\372\350\375\002\246\314\fH\026\356v\321\312b\017\244\345\232\225\263\226\255\211\232\250\215h\342S\306\306\222\271\031\275|\033\301\344\320\261D\bw\027\265\222f\313m\231f\307\2545\314\222\245\207\350\021+\317\230\034<r`\265\320{\250\036]%%q\327\304V\316"
+	.string	"\266\035\325\265\262\223O3\246t5\355\022\313\205\215\276\374\005\223cF\326\r\274\204\344\206\245\313\356\260/6\260`\251\2021"
+	.ascii	"B\301+2\243\t\367\255\223}Ab\305J\025\214\001\260\211\331\022"
+	.ascii	"\253\263\033\354\313`aa\255\022\203\230\326\013\332R\033\024"
+	.ascii	"*\257Uv\0341\334\343\256\206\025\260\330U4\345\t\317\302\200"
+	.ascii	"E\251\204\366\002\366x1\373\323\241C\312+\241\263&\fK\0227\356"
+	.ascii	"\372T\2630~\177\177U\360\005\260\351Y\357\334\2347\002_\005\235"
+	.ascii	"\305\346\220\302\"\025\260\246p\351L\b\020\n_\3009Af\221\316"
+	.ascii	"\016\311\b\230\215\301\321\327W\367\376\260\264\335\"SW6\346"
+	.ascii	"\b^\345\303\253{~Z\366\313\357\316J\357uo\260\210\\\213\274\272"
+	.ascii	"\304.\233;\250\270\310\2601Q\350\350\352\335\037\235\345Rz\016"
+	.ascii	"\261{\275\223B\"\322\306]\235\324%.H\272j\330q\327&os\023\354"
+	.ascii	"\301\203\273\326\361R1\251\256\353\215F\341\333\227\023\356\273"
+	.ascii	"\020Y\231,\267\312\304\255\316\331\344\037X\361\t*\216M\356u"
+	.ascii	"\356\351\205\345\307]\225\324%O\250\254%q9\260\350\342\262\016"
+	.ascii	"}\364H\203\343\2516\222V4\305]\223\274\315\310\310\016\027\334"
+	.ascii	"\025\t/\275\354\b{Zq\3277\246\001S\2667\267\203\227Z\254\250"
+	.ascii	"\004:\253X\231)G\216\324\2664\243gQ\nV^^e{m\033\314\212\341\266"
+	.ascii	"\304]\327jW\215\216\260\255\027E=;\343\344\354\254\246\365\035"
+	.ascii	">a\372\266\250\334@{Ms\312,\225\206D\270\253\221\372Tc\225\366"
+	.ascii	"\307\204\304\322,\025)R\233u\\\224h\264T\366\332\354\246\236"
+	.ascii	"!!w%\253]\205hJ\306\0167\323c\020\220\nwe\212\t\2614{__5\254"
+	.ascii	"mJJ\f\t\3545\214\316\351\026\203\273\016\251];OK\202\334UH\361"
+	.ascii	"\312\326\310\340q\036\325\313\336\276\2576\"[F\200\274z\265\244"
+	.ascii	"\355\260;\343\256[\265\253\205\021!\034]\\V\314H^S\013ZDU\203"
+	.ascii	"\306\017\2761\200F\204\226\334U\313G\217\"\f[#\345\306\215\232"
+	.ascii	"\325\327\244Es\220])\301z\315\2421#\"\247\304]u\324'\313C\212"
+	.ascii	"\f\033\3345\307\235N8v\240qW\034\234\244F\031\226\215]\2616v"
+	.ascii	"\365\252^\325\252\275+Z5zP\326\364l\006rR\325\252J\325*\233\334"
+	.ascii	";\322\"\n\304\372\2535^\253\006k\310\\0\261\302]\251\352\323"
+	.ascii	"\022#\261,\334u\352N92\266''):AB\274\342f1\250\2521j\214\032"
+	.ascii	"E\315\234\246\272\016\373\020\377\360*\324k\324 \r\251f w\235"
+	.ascii	"Q\237\0220D\267W\237\252\323\333U\016\245\025\031D(\302\276&"
+	.ascii	"*X\273\252\206\334qW\246;g\356\230LG\334u\211\223\354\260Q\204"
+	.ascii	"\211\273\312\270\323eJ\r\321\220\337\270\211\007v'fo\244\274"
+	.ascii	"xQ\225\362\326\236/\311\233\205,\351U\311Y\241\230\006apW$^\033"
+	.ascii	"\201\\^\025\257\265\030W\323\r\037V\003\253jT\215\252\213<!Z"
+	.string	"0_-\232}\265\305\253\213\301\244(\263&w\265\241\262\350:3(\316\226)\253A\275\365\326\242\005\224\345\260\227)\261\022\275\026]\325\300\361\304]\225\225E\214\221*\251\277\312\242\0161\013\371\274\364\\\2620E)\254B\364\356E\215J\257\220\273&\223,\007'+V\370\206\274e\007GaB\020\n\244N\212\243Q\007\350\005y4\326\036\344\321\b\344S<\n\023N\034\215@\310\240\016\307\237\243\0132\207G\005\306\240\"\222'(\005O\212bO\320\317N\367\2108\361\343\323\222s4\"}\214+J\344\344\320\364\240\340GE#\203\216?;-}\024;G\035\240\022G#\362\347(\003\244\203b\247M\2440\006}\300\003\244\343\263\303c\342\003\025)~l\216\302\204 \037\037\235\035\024H\235\024 \202\220\306\022 V\034O\224P\303\212\243\321\247\204\023H\344\220P\241\006\020<&V\370\354\034\215 \200\202V\200"
+	.string	"\321\243\303\343\323(\370\001B\201\3749\272\364\034\215A\255\001r\205\212c\004\220A:2d@\201"
+	.string	""
+	.string	"\351\314\260\343\243\343\002\007&\216-l\300sB\007\210\347\004-t\250\231\021A\343\001\206\031d\320"
+	.string	"\203\r`\230A\006\036\244\216\t\025\032\340"
+	.string	"\303\f2\334\330\\"
+	.string	"\305\016\362\247\002H\036\b\324\2148\241\206ff\204M\n|T\250h\301\307g\305\261\306\004O\220\321G\307\b"
+	.string	"\244\361\030\001\036\237\022:4\320|\347h\314\300\313w\214@<G\236\023\366'\220(\201\204\n5\270\\\005\026B\260\020\242x\025X\300\301a\201\004\216=\t\234\212\314\0211\202'\207GE\nh\310"
+	.string	"\231C\002\307\"\203rx\202\214?G\236\02720\301\343\343c\354\211q\001\311s\002H\007\031\203\224\0012\366\304\364\254(Q\221:?>=-A==<?;\305\024+2p\342h<\301O\212\227\032xL\034\215-\310\343\212\237\235\026d\216\n\310\243q\205\013\n\344\211#\217\f=+J\274 \203rF\324 E\230\320Ya\002c\t\232\020%\030\247\004\213(\3018:,B\207qL02(g\204\f\022\005\007\377Q\301\003\004\002\371\363\003\004\"\206\006\023\034\224\003\003\016RE\314W8A\304\n=(\230\3501!\203\257\260\202\013\037h\240\002\020\260;&"
+	.string	"\361 }\214= \216?)R\374\354\2008\032uR\200\330\001\n\002aB"
+	.ascii	"x\220:\310\240\226\022P\0270\300>??\016\310iI4\222\021\364\013"
+	.ascii	"lQW\273\214|\361ei\276\263\3036\030\334\035\260Ti\304\256\322"
+	.ascii	"XhRR\222\020\001bO\274`\034\336&\031\037\376\276\362\306\002"
+	.ascii	"G\024X\210\307\335V\016g\261\244\211\351q\367\241\013\235\023"
+	.ascii	"\253\251^z\003k\022\204\212\340\007\366\346\206\f\333\216\346"
+	.ascii	"N,QGa\315r\361\262R(d\212\327\314\232\221\331\021a\223Ns\312"
+	.ascii	"a\325Rj\224U\325\035\0377\223\246\350\265\243\350\215\273\003"
+	.ascii	"[\220:\017\327\203\314&\215\223>>?.[\203\313\341\212/qEzPP\266"
+	.ascii	"\270\224_\211\334L.\374\363\241\303\217\345\322\022\245\004r"
+	.ascii	"\027\003\237\274\365\2364\0375\244\314\333D\225$\024aj\016K\306"
+	.ascii	"\341\211\033Su\275\367\346\253K4s\253\352<<\230\035\326E\350"
+	.ascii	"\355\235\344\255\355*\237\314M\222]$\027\347\334\017&\207w\331"
+	.ascii	"\364!f\254\305\330\023&o\273\267\023\021(\\\320~y\361)\271\273"
+	.ascii	"\311\273\256\251\t\222']\327q\331h\0069\262/\201\214II\211\273"
+	.string	"\347.\330%\350B\nw\313\035\356M}\2078z\311\235X\345\tq\267\222\206\243\316\323u\334i\220\024\245\321q\037\206\310\376\005\364t\305F\362VB\"e\243*\206\032\037\224V\242u\261J\341\354\355<c9\021\300\260\341\rI\342\356\266#\315\266\206\326ji\fh2r\305\332\013\366n\202\261\\eb\331\256\226\r\334]\306l\2621\"-V\344L.\354\245\320\272\354\245 \004Gou\034M\2259*L\334\375\325@:H{uW\357h.\034o\036=z\213\263\356\025\n\301\024\362+\252\261\210\333j\255\367V\327\360s\302\301\335>\356\254i\033\363\313z\331\263\215\325;z\206\335\024\"\221,nk\322\361V\352\333\243#\343\356\034-P1"
+	.string	"\273\270/\223\243\316\t\341\235u\021\222B\322\333F\022\313\265(\271\227\210\222]\244\244\273\214\372"
+	.string	"\203C\257\254\216\273\255\336WSI\256 Ll7u\215\256\262\272\242<\202\263o\252(b=\374\270{\312\022\275\240\215\320-\324\016\233\334\357\251\226\032\301L\324\217+\033\034\204\020\250\343C\303H4\035*\244\2343#2#m\222\016\263\025@0`H&\037/\303\346\001\023"
+	.string	"\325h\363i\024\006\245\202\312\fI$\022$I\n\n\231\3061\325\016ABn\261[\301`.$\211\232Zk\322o\205\033\241\023\240\202\202\007\371\177\304\277\220\217Rt\365~\261w\347c\367\030\200\344\035\013\212\235%\267\201\\H\211\315\341\215\316c\332\360\301\306\2257n\273{\236\245\260\221w\261fq\260\232aU\b\332\024\025\002\361\366\3015\374J\006\355\256\034M\322\326q$\304\036\311\317\216P\364\2118V\036\354\201\223\213D\236\021\363\025b\336\317u\2308s\031\013\003b\230\241\371\032N\212\020D\220@\0213}\312\343\300V\354\256\233A\016\224\343\311\257J2NX\334\001\264\360\256c\353\006v\205\305\352\200\320\232\003B?\372\351\242=N\245\212\347\256\334\320Vc<\375"
+	.string	"\300\373\345\304c\0226\232\375\003u\302\374\353\206\001\345[E2\272\3524'\025\n\251\240+\371\340\311\324Z\2612C\307\215\261Z5\253\360\035\243\223p\311\007[\364\345\261<\364br$t\365d\367\026\n\234\326\234\2158\270\276\365\007\343\b\350(f\240\234\271\365\273\311\342\225\3012\3150@Q,2\344\327\332x\nf\353\001Ee[\206\3047n7\320}\251\362YbC\220\265xX\321eO\034U\3257\211\333v\n\213\003\332\025~\263\233\310x\221"
+	.ascii	"\355\244\201?\270c\321\277\211[J\227 \266\372@0\234|\332N\003"
+	.ascii	"\211\275\247\035K\302*\347\213m\272\215\376,\275\220`\002\220"
+	.ascii	"z\200E,\274\321+\214yd9u\0216b6-\360\262\212\036\265\322//\177"
+	.ascii	"\235.\357\376\372\377W\036\0019\223\034y\350\360o_c\334+'4^\305"
+	.ascii	"\037\221nIkT#\257<\021\217="
+	.string	"7\265\300\257+b\374b\f\256M\027C%^\2568\3511@\302{\356<9\032%\026\1771z\022\2754w\270]\035\251nI\3571\013\376W\b\355\225\222\2229x\311\230\34407\f]Y\306q\351\214\2035kG\245\3451\247\034\303]\330\331\362\202\307\037\372).]`\345\252\365Y\001\002\323\013\352\356EH\2545\305\375\020\366\f2\336\222\t\313^\222d\200\350Z\233\023\257\261IS]\032@\341 \273N\003\311j\312\362\315\\\2401\f\243\220%\337R\332\247\341=\310\232\"\205\326j\223\323i\n-1\202\244\370\232-\367\253o\260:5s\304Ny|\004\222 DR\236z\326\313\232G\356\237\t\331\023Y\360\253\316iH\361\274(\031\034:\220\317\237aF\035\323\305\360\021#\034m\002\340#+%!\230\030`e\033I\267\364\274$:\027/\250\206\246\311\242\371|\233Bl\360\0206\241\036\027\333\267x"
+	.string	"\304O\2079\025\330\366\257j\252\354\227~u;\367c\255#k\332\346\361WA\3432\304\344\262\022\230E\241Rh\360\270n\020~\241\321\340^\033\224z~5]\016\237\002\353\275\371\374\2467\342\304r0\301\362_\"|\305\3621\213\247\025.\013\003f/36Lgc\356\252\356L\210\025\211\370]\212\223_M:\001I\310\277\217/Ke\247\326\020au\305\211\025\030\324qu\237\367\177\266\364`\362\266\202'\254\210.\235G?|\005tRJ\024\210p\336\222<\350\3204\217\214f?\236\306\004\210l\357\251\207\300N\227\306;d\365\007#\371>\300G\234\3613\013\236#=\210~\323\tE\301|\213\b\022\247\034\356*\377\262\026\372\235\230l\370<Z1\376\005\247\3705\253\0365g4}\326?\206\n,;\321\203\224,\367TD`yO"
+	.string	"\251\315\004\264\223\257\232\206\033\264\302\016\265\350\265Pu\355T\303\263,\261\226]5\351\036\2119sK\344%\177j\006\340\364S\361%\367\301<\301\235,7\346^\210\025\340o\345\025\317\026\240+\326\2712\261P\030Q\b\271$*\371\337\227>/1$\344\334\201\261pLX\362\240 \334e_\355\342|q\001\334t5k\202\373\203t\036\002["
+	.ascii	"bt\"q\220\004^y\257\306\rQ\002T\267\224/\r\202\265Fm\221\337"
+	.ascii	"\312\213Z*\210q\374\002\316\223\363\300\230S\214\321\366\005"
+	.ascii	"\376mO\204\355&N$\343\312\006`TT\376\361\301\f\242v\222\021\250"
+	.ascii	"\204\302SSh\373d\216\017\2667#P\337\215\352\333m\301#\253\271"
+	.ascii	"\352lp\034\220\345Nq\013\340\232\372\256>\002\366\250\211\366"
+	.ascii	"n'\t\257\252R\360\212\365<\203\212\027'\247\371\264\370\326\361"
+	.ascii	"\305\0020.h\377+$\302\274a\305\017xE\376\357E-\301\\\220\001"
+	.ascii	"\263\264H\001h\2409J\324\351C6\374\312|A3iJt\253\375\231\271"
+	.ascii	"\177N\261b\376@$\032\357^\306\177,\013\2744\336p\201\0207;}\020"
+	.ascii	"\254f\f+\225\316\247g\370\016\3220\360qz]9\022\3205\323\335\274"
+	.ascii	"\013\335\301^\341\327L\303>\261\275>\350Z\021v\303\336\0041\224"
+	.ascii	"\220\364\004\214\256wICp\333!\255\342qW\201u\020\303j\312}{\""
+	.ascii	"\2160\n\231\002\\\315d\034\240\")8.\b\247\366\277'\n\237\305"
+	.ascii	"\366\263\305V\0028\206\262\305\337]f\223Ml{6jqk\254\303\370\365"
+	.ascii	"\0204\352O\305N`\001|\250\242\354\251\177\027\303E0l\b\001\304"
+	.ascii	"\353\315\217\275\203\361\021\331g\257\252\357\361\377\271\273"
+	.ascii	"\337\337E\205\334\027:\005\030\231\235\233F|w\n\357\250\274\005"
+	.ascii	".P\3610\274j*\334\234\016\t\214\271-\t\214\220\306\344\274[\373"
+	.ascii	"\347X\211L>\334\224\031\340\247\371\2318\224\307\353\370\022"
+	.ascii	"\006\224\217\226h\356\336\213\224tC\036\202\334\213b\\\317\033"
+	.ascii	"\327C\234\376u\307g\200c\221\254^\342B(*\"\345O\251\177\005z"
+	.ascii	":\337\346{{tS\2709\277G\fx\371\377\370X\316p_\271\313\334\243"
+	.ascii	"\201\203k\255\177\233~\324\347!\322\225\267\343\372\025\365\314"
+	.ascii	"O\231\376\213f\301\273\216.\206\237\3346\374\r\237\006G|\242"
+	.ascii	"\377K\021\027D=\004\271\2107\352\202\350r\374`9\023\365R\236"
+	.ascii	"g\325\361`\337\225\201c\343I\360c\357l\361%\352\031o\312\350"
+	.ascii	"\355\364#\270d\342\255\316hx\336\314\001\247\023\353\374\352"
+	.ascii	"\212=\221\270U\340\005ej\363=\331\"\034}\367\235\362\013\271"
+	.ascii	"\242.RG\030>\252\037\003\254\356\037\314\247\342<\351|\253\201"
+	.ascii	"\341"
+	.string	"Z\227\223\263/\016\343M\361\3674\354s>p\354\374Q"
+	.string	"\271\242\\0]\360\177\361\301\354\277\207\036\314\375\256z\323\336`z\215x\252\266\2619\365\322|%\326\340n\304\323\231U\213\346S\223\352\236\201\363\256O\206\313U\376\233g)0\037b\016\353W\303\312<\213\306\032\347\223\033\336}\255y:S?^\037\250\377\325^\033\377s\360\214\331\312\033\330\372=\214\201F\353\211\364@\312K\036\256\216q\235\215\343O\356\326\343\336\3407t|\371\376\250\212\345\265<\005\334\247\370Cf\330h\371E\027\271\204\353\304\366\020\302\214\036\253\246\017t\377By_^h3}\001\376\210\342\2054\300kRl\377?\347\006{\204\005\317\201\202l\313[J\376\307\306K\235W\t\373\033\365\317\324\265~h\236\373W\370\306\253\366\207|u\340\177Y\351\352\t\271\031\341ax\362V\367_\353"
+	.ascii	"\334\223a\215i\003\364\t\234\230|l\276\024\357<\223\367\213\247"
+	.ascii	"\213K\367\214-G\323\334P\357*G)]O9\241\007"
+	.text
+	.section	.gnu.lto_.symtab.d32deef8bdff1681,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"nullFilter3Apply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"pt1FilterApply4"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"pt1Filter3Init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"pt1Filter3Apply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"biquadFilterUpdateNotch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"biquadFilter3Init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"biquadFilter3InitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"biquadFilter3UpdateNotch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"biquadFilter3Apply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"firFilterInit2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"firFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"firFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"firFilterUpdateAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"firFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"firFilterUpdateAndApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"firFilterCalcPartialAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"firFilterCalcMovingAverage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"firFilterLastInput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"firFilterDenoiseUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"firFilterDenoise3Update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"sinf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"log2f"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"cosf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d32deef8bdff1681,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,5286 @@
+	.file	"huffman.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/common/huffman.h"
+	.file 4 "./src/main/common/huffman.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	huffman.c.9ec1bb32
+	.weak	huffman.c.9ec1bb32
+huffman.c.9ec1bb32:
+	.long	0x2f2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xf
+	.long	.LASF802
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF760
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF761
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF762
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF763
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF764
+	.uleb128 0x4
+	.long	.LASF766
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF765
+	.uleb128 0x4
+	.long	.LASF767
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF768
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF769
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF770
+	.uleb128 0x4
+	.long	.LASF771
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x9
+	.long	0x8a
+	.uleb128 0x4
+	.long	.LASF772
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x4
+	.long	.LASF773
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x70
+	.uleb128 0xb
+	.long	.LASF777
+	.byte	0x4
+	.byte	0x19
+	.long	0xd7
+	.uleb128 0x5
+	.long	.LASF774
+	.byte	0x1a
+	.byte	0xe
+	.long	0x9b
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF775
+	.byte	0x1b
+	.byte	0xd
+	.long	0x8a
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF776
+	.byte	0x3
+	.byte	0x1c
+	.byte	0x3
+	.long	0xb3
+	.uleb128 0x9
+	.long	0xd7
+	.uleb128 0xb
+	.long	.LASF778
+	.byte	0x18
+	.byte	0x1e
+	.long	0x130
+	.uleb128 0x5
+	.long	.LASF779
+	.byte	0x1f
+	.byte	0xe
+	.long	0x130
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF780
+	.byte	0x20
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF781
+	.byte	0x21
+	.byte	0x9
+	.long	0x64
+	.byte	0xc
+	.uleb128 0x5
+	.long	.LASF782
+	.byte	0x22
+	.byte	0xe
+	.long	0xa7
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF783
+	.byte	0x23
+	.byte	0x9
+	.long	0x64
+	.byte	0x14
+	.byte	0
+	.uleb128 0x8
+	.long	0x8a
+	.uleb128 0x4
+	.long	.LASF784
+	.byte	0x3
+	.byte	0x24
+	.byte	0x3
+	.long	0xe8
+	.uleb128 0xa
+	.long	.LASF796
+	.byte	0x4d
+	.long	0x64
+	.long	0x226
+	.uleb128 0x1
+	.long	.LASF779
+	.byte	0x4d
+	.byte	0x1c
+	.long	0x130
+	.uleb128 0x1
+	.long	.LASF785
+	.byte	0x4d
+	.byte	0x28
+	.long	0x64
+	.uleb128 0x1
+	.long	.LASF786
+	.byte	0x4d
+	.byte	0x41
+	.long	0x226
+	.uleb128 0x1
+	.long	.LASF787
+	.byte	0x4d
+	.byte	0x4c
+	.long	0x64
+	.uleb128 0x1
+	.long	.LASF788
+	.byte	0x4d
+	.byte	0x69
+	.long	0x22b
+	.uleb128 0x2
+	.long	.LASF789
+	.byte	0x50
+	.byte	0xe
+	.long	0x230
+	.uleb128 0x2
+	.long	.LASF790
+	.byte	0x54
+	.byte	0xe
+	.long	0x230
+	.uleb128 0x2
+	.long	.LASF791
+	.byte	0x55
+	.byte	0xe
+	.long	0x230
+	.uleb128 0x2
+	.long	.LASF792
+	.byte	0x56
+	.byte	0xd
+	.long	0x240
+	.uleb128 0x2
+	.long	.LASF774
+	.byte	0x57
+	.byte	0xe
+	.long	0x9b
+	.uleb128 0x2
+	.long	.LASF793
+	.byte	0x58
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF794
+	.byte	0x64
+	.byte	0x9
+	.long	0x64
+	.uleb128 0xc
+	.long	0x1e2
+	.uleb128 0x6
+	.string	"i"
+	.byte	0x51
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.uleb128 0xc
+	.long	0x1fe
+	.uleb128 0x6
+	.string	"len"
+	.byte	0x59
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x7
+	.uleb128 0x6
+	.string	"i"
+	.byte	0x5c
+	.byte	0x12
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x6
+	.string	"out"
+	.byte	0x65
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x7
+	.uleb128 0x6
+	.string	"len"
+	.byte	0x67
+	.byte	0xd
+	.long	0x64
+	.uleb128 0x7
+	.uleb128 0x2
+	.long	.LASF795
+	.byte	0x6f
+	.byte	0x17
+	.long	0x6b
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x96
+	.uleb128 0x8
+	.long	0xe3
+	.uleb128 0xd
+	.long	0x9b
+	.long	0x240
+	.uleb128 0xe
+	.long	0x37
+	.byte	0xc
+	.byte	0
+	.uleb128 0xd
+	.long	0x8a
+	.long	0x250
+	.uleb128 0xe
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF797
+	.byte	0x40
+	.long	0x64
+	.long	0x26a
+	.uleb128 0x1
+	.long	.LASF798
+	.byte	0x40
+	.byte	0x29
+	.long	0x26a
+	.byte	0
+	.uleb128 0x8
+	.long	0x135
+	.uleb128 0xa
+	.long	.LASF799
+	.byte	0x2a
+	.long	0x64
+	.long	0x2cb
+	.uleb128 0x1
+	.long	.LASF798
+	.byte	0x2a
+	.byte	0x23
+	.long	0x26a
+	.uleb128 0x1
+	.long	.LASF788
+	.byte	0x2a
+	.byte	0x40
+	.long	0x22b
+	.uleb128 0x1
+	.long	.LASF786
+	.byte	0x2a
+	.byte	0x56
+	.long	0x226
+	.uleb128 0x1
+	.long	.LASF787
+	.byte	0x2a
+	.byte	0x61
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF800
+	.byte	0x2c
+	.byte	0xf
+	.long	0x6b
+	.uleb128 0x6
+	.string	"i"
+	.byte	0x2d
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x7
+	.uleb128 0x2
+	.long	.LASF801
+	.byte	0x2f
+	.byte	0x1f
+	.long	0x22b
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF803
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF798
+	.byte	0x1e
+	.byte	0x28
+	.long	0x26a
+	.uleb128 0x1
+	.long	.LASF779
+	.byte	0x1e
+	.byte	0x38
+	.long	0x130
+	.uleb128 0x1
+	.long	.LASF780
+	.byte	0x1e
+	.byte	0x44
+	.long	0x64
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.file 7 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF555
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF573
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF596
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF656
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF660
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF661
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF757
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF476
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF479
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF492
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF493
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF540
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF554
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF572
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF653
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF756
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.huffman.h.22.39ca510718758a6c386740950620a041,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF759
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1
+	.long	.LASF804
+	.long	.LASF805
+	.long	.LASF806
+	.long	.LASF807
+	.long	.LASF808
+	.long	.LASF809
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x15
+	.long	.LASF0
+	.byte	0
+	.long	.LASF810
+	.byte	0x2
+	.long	.LASF811
+	.byte	0x2
+	.long	.LASF812
+	.byte	0x1
+	.long	.LASF813
+	.byte	0x1
+	.long	.LASF814
+	.byte	0x5
+	.long	.LASF815
+	.byte	0x6
+	.long	.LASF815
+	.byte	0x5
+	.long	.LASF816
+	.byte	0x2
+	.long	.LASF817
+	.byte	0x5
+	.long	.LASF818
+	.byte	0x5
+	.long	.LASF819
+	.byte	0x2
+	.long	.LASF820
+	.byte	0x2
+	.long	.LASF821
+	.byte	0x4
+	.long	.LASF822
+	.byte	0x2
+	.long	.LASF823
+	.byte	0x3
+	.long	.LASF824
+	.byte	0x3
+	.long	.LASF825
+	.byte	0x2
+	.long	.LASF826
+	.byte	0x2
+	.long	.LASF827
+	.byte	0x2
+	.long	.LASF828
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF669:
+	.string	"INT32_MAX (2147483647)"
+.LASF676:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF448:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF611:
+	.string	"__STD_TYPE typedef"
+.LASF478:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF673:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF781:
+	.string	"bytesWritten"
+.LASF649:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF580:
+	.string	"__stub_sigreturn "
+.LASF417:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF759:
+	.string	"HUFFMAN_MAX_CODE_LEN 12"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF542:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF624:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF556:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF517:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF715:
+	.string	"INT16_C(c) c"
+.LASF779:
+	.string	"outBuf"
+.LASF488:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF797:
+	.string	"huffmanEncodeFinish"
+.LASF469:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF484:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF786:
+	.string	"inBuf"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF789:
+	.string	"lengthCount"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF728:
+	.string	"INT32_WIDTH 32"
+.LASF730:
+	.string	"INT64_WIDTH 64"
+.LASF531:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF656:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF694:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF504:
+	.string	"__P(args) args"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF783:
+	.string	"bitCount"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF449:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF698:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF719:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF663:
+	.string	"INT8_MIN (-128)"
+.LASF650:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF608:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF492:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF437:
+	.string	"_ISOC99_SOURCE 1"
+.LASF519:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF408:
+	.string	"__USE_POSIX2"
+.LASF672:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF693:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF564:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF420:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF407:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF707:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF654:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF710:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF576:
+	.string	"__stub_fchflags "
+.LASF778:
+	.string	"huffmanState_s"
+.LASF784:
+	.string	"huffmanState_t"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF633:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF747:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF431:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF411:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF416:
+	.string	"__USE_XOPEN2K8"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF541:
+	.string	"__always_inline"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF427:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF684:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF490:
+	.string	"__GLIBC__ 2"
+.LASF438:
+	.string	"_ISOC11_SOURCE"
+.LASF769:
+	.string	"long int"
+.LASF480:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF792:
+	.string	"symbols"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF432:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF467:
+	.string	"__USE_XOPEN2K8 1"
+.LASF642:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF396:
+	.string	"__REVISION__ \"7b45b89\""
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF653:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF638:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF700:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF632:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF538:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF522:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF506:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF562:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF527:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF520:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF739:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF635:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF583:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF487:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF497:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF729:
+	.string	"UINT32_WIDTH 32"
+.LASF764:
+	.string	"signed char"
+.LASF604:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF771:
+	.string	"uint8_t"
+.LASF598:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF508:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF613:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF555:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF629:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF631:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF760:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF460:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF505:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF685:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF475:
+	.string	"__USE_LARGEFILE 1"
+.LASF756:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF664:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF549:
+	.string	"__restrict_arr __restrict"
+.LASF574:
+	.string	"__stub___compat_bdflush "
+.LASF788:
+	.string	"table"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF640:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF486:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF680:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF528:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF678:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF379:
+	.string	"linux 1"
+.LASF585:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF579:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF601:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF623:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF546:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF757:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF767:
+	.string	"__uint16_t"
+.LASF793:
+	.string	"symbolIndex"
+.LASF414:
+	.string	"__USE_XOPEN2K"
+.LASF514:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF655:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF415:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF544:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF447:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF464:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF691:
+	.string	"INT_FAST8_MAX (127)"
+.LASF679:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF752:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF720:
+	.string	"UINT32_C(c) c ## U"
+.LASF699:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF409:
+	.string	"__USE_POSIX199309"
+.LASF670:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF709:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF418:
+	.string	"__USE_LARGEFILE"
+.LASF702:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF413:
+	.string	"__USE_UNIX98"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF430:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF617:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF602:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF647:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF777:
+	.string	"huffmanTable_s"
+.LASF776:
+	.string	"huffmanTable_t"
+.LASF687:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF440:
+	.string	"_ISOC2X_SOURCE"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF731:
+	.string	"UINT64_WIDTH 64"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF766:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF586:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF526:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF697:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF690:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF587:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF536:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF547:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF465:
+	.string	"__USE_POSIX199506 1"
+.LASF755:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF454:
+	.string	"_ATFILE_SOURCE"
+.LASF607:
+	.string	"__SLONG32_TYPE int"
+.LASF712:
+	.string	"WINT_MIN (0u)"
+.LASF795:
+	.string	"index"
+.LASF628:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF790:
+	.string	"firstCode"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF403:
+	.string	"__USE_ISOC11"
+.LASF479:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF533:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF733:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF661:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF584:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF803:
+	.string	"huffmanEncodeInit"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF735:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF476:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF703:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF630:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF742:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF596:
+	.string	"_BITS_TYPES_H 1"
+.LASF671:
+	.string	"UINT8_MAX (255)"
+.LASF708:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF718:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF461:
+	.string	"__USE_ISOC95 1"
+.LASF565:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF578:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF743:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF518:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF780:
+	.string	"outBufLen"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF434:
+	.string	"_ISOC95_SOURCE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF500:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF402:
+	.string	"_FEATURES_H 1"
+.LASF453:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF498:
+	.string	"__LEAF , __leaf__"
+.LASF659:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF530:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF744:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF612:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF470:
+	.string	"__USE_UNIX98 1"
+.LASF471:
+	.string	"_LARGEFILE_SOURCE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF422:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF746:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF450:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF648:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF558:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF696:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF768:
+	.string	"__uint32_t"
+.LASF483:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF753:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF572:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF399:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF553:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF503:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF446:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF732:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF534:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF552:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF494:
+	.string	"__PMT"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF634:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF455:
+	.string	"_ATFILE_SOURCE 1"
+.LASF603:
+	.string	"__SQUAD_TYPE long int"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF724:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF425:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF569:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF749:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF787:
+	.string	"inLen"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF667:
+	.string	"INT8_MAX (127)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF762:
+	.string	"unsigned int"
+.LASF516:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF727:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF495:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF421:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF466:
+	.string	"__USE_XOPEN2K 1"
+.LASF459:
+	.string	"__USE_ISOC11 1"
+.LASF641:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF600:
+	.string	"__U32_TYPE unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF525:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF529:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF457:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF551:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF577:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF682:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF637:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF675:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF540:
+	.string	"__wur "
+.LASF473:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF725:
+	.string	"UINT8_WIDTH 8"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF714:
+	.string	"INT8_C(c) c"
+.LASF791:
+	.string	"firstSymbol"
+.LASF606:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF652:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF489:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF616:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF501:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF557:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF507:
+	.string	"__STRING(x) #x"
+.LASF554:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF561:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF770:
+	.string	"char"
+.LASF502:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF563:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF677:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF674:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF761:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF754:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF405:
+	.string	"__USE_ISOC95"
+.LASF705:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_ISOC99"
+.LASF801:
+	.string	"entry"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF412:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF794:
+	.string	"inBit"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF509:
+	.string	"__BEGIN_DECLS "
+.LASF686:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF537:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF662:
+	.string	"__intptr_t_defined "
+.LASF468:
+	.string	"__USE_XOPEN 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF625:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF644:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF393:
+	.string	"SITL 1"
+.LASF435:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF406:
+	.string	"__USE_ISOCXX11"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF772:
+	.string	"uint16_t"
+.LASF610:
+	.string	"__U64_TYPE unsigned long int"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF763:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF410:
+	.string	"__USE_POSIX199506"
+.LASF740:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF721:
+	.string	"UINT64_C(c) c ## UL"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF477:
+	.string	"__WORDSIZE 64"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF581:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF515:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF609:
+	.string	"__S64_TYPE long int"
+.LASF568:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF512:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF723:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF599:
+	.string	"__S32_TYPE int"
+.LASF734:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF711:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF657:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF796:
+	.string	"huffmanDecode"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF785:
+	.string	"outCount"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF774:
+	.string	"code"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF665:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF737:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF575:
+	.string	"__stub_chflags "
+.LASF424:
+	.string	"__USE_GNU"
+.LASF643:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF456:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF567:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF636:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF614:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF545:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF423:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF683:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF535:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF695:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF510:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF481:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF736:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF765:
+	.string	"short int"
+.LASF493:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF433:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF548:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF523:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF738:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF560:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF782:
+	.string	"bitBuffer"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF571:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF521:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF621:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF524:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF605:
+	.string	"__SWORD_TYPE long int"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF532:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF618:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF462:
+	.string	"__USE_POSIX 1"
+.LASF704:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF701:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF802:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF570:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF758:
+	.string	"HUFFMAN_TABLE_SIZE 256"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF451:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF472:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF597:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF713:
+	.string	"WINT_MAX (4294967295u)"
+.LASF539:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF482:
+	.string	"__USE_ATFILE 1"
+.LASF543:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF741:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF559:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF639:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF626:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF666:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF491:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF452:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF681:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF751:
+	.string	"UINTMAX_WIDTH 64"
+.LASF773:
+	.string	"uint32_t"
+.LASF458:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF615:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF689:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF441:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF688:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF511:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF463:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF627:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF566:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF750:
+	.string	"INTMAX_WIDTH 64"
+.LASF668:
+	.string	"INT16_MAX (32767)"
+.LASF588:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF619:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF474:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF620:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF496:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF439:
+	.string	"_ISOC11_SOURCE 1"
+.LASF660:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF716:
+	.string	"INT32_C(c) c"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF692:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF485:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF745:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF646:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF658:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF775:
+	.string	"codeLen"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF748:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF798:
+	.string	"state"
+.LASF573:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF499:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF622:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF419:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF800:
+	.string	"outBits"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF717:
+	.string	"INT64_C(c) c ## L"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF436:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF799:
+	.string	"huffmanEncode"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF582:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF651:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF706:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF645:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF722:
+	.string	"INTMAX_C(c) c ## L"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF550:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF726:
+	.string	"INT16_WIDTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF822:
+	.string	"long-double.h"
+.LASF824:
+	.string	"stubs-64.h"
+.LASF808:
+	.string	"/usr/include"
+.LASF828:
+	.string	"stdint-intn.h"
+.LASF816:
+	.string	"libc-header-start.h"
+.LASF812:
+	.string	"huffman.h"
+.LASF806:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF820:
+	.string	"timesize.h"
+.LASF823:
+	.string	"stubs.h"
+.LASF813:
+	.string	"huffman.c"
+.LASF807:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF805:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF827:
+	.string	"wchar.h"
+.LASF817:
+	.string	"features.h"
+.LASF826:
+	.string	"time64.h"
+.LASF809:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF825:
+	.string	"typesizes.h"
+.LASF811:
+	.string	"stdint-uintn.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF818:
+	.string	"features-time64.h"
+.LASF821:
+	.string	"cdefs.h"
+.LASF819:
+	.string	"wordsize.h"
+.LASF0:
+	.string	"./src/main/common/huffman.c"
+.LASF804:
+	.string	"src/main/common"
+.LASF814:
+	.string	"stdc-predef.h"
+.LASF815:
+	.string	"stdint.h"
+.LASF810:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375 \352\345\003"
+	.string	"4\004\336"
+	.string	"\004"
+	.string	"\251\326\346\223\006\n\002"
+	.string	"\002\001\002\002\003\001\237\362\352\357\006 \002\004\002\004\005\002\006\007\b\002\b\002\267\253\372\376\n\020\002\002\001\003\242\350\353\342\006&\002\t\002\t\007\002\t\005\002\n\t\n\002\n"
+	.string	"\030"
+	.ascii	"\271I\034\002v\006\330\021@@\304\004\270\271\311\261\005\366"
+	.ascii	"\033\312p\251Q\004\200\001 \006\202Q\002\203V\026v\022X\311k"
+	.ascii	"T\033B)q\261\2662\256]V\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375 N\025\001"
+	.string	"\220B"
+	.string	"\004"
+	.string	"\003"
+	.string	"\001\001\004"
+	.string	"\003\002\001\003\003\005\003"
+	.string	"\006"
+	.string	"\340"
+	.ascii	"\220\203\2465@'\300\220\r`\001"
+	.text
+	.section	.gnu.lto_.inline.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"E\b"
+	.ascii	"RN.2Pm\222\016@(\263`Kv\02100\301P\312\301\253\013\216\206R\237"
+	.ascii	"\033sc\360\322\333\332\2426\305\314\324\3311(h.\251\232\201X"
+	.ascii	"B\377\275\345N\001o\n!\n\215\024\3409\035\205p\214\254so\335"
+	.ascii	"8\035\245<P\334\321\217\373\307\314c%\302i\244n\303\001\344\231"
+	.ascii	"0\230\213\004k\244:Z.Z.\"\024\324\231(\261\327]\r\370\2013\367"
+	.ascii	"\312[`\373\234\201Im\270\262m\212br!q\271_\365e\343\325\335\305"
+	.ascii	"K53\323\024\316\243\002C\343\362\013\027\212\26089\300\277\247"
+	.ascii	"[\252\335\215\241\036\020\022\221\202\355\277W\323OfJ\237\320"
+	.ascii	"J\3374\227\221\231\353q\003\005  `\"Sd>:\221F\200\346\247Xko"
+	.ascii	"\237d\266\333a7t\277\205\007\270j\331\353q\254&w\307\322n\371"
+	.ascii	"\272Z\\*\021\304\343d\224\003ki\270\216\351\275\331\002l\320"
+	.ascii	"\210\303@\357\031\214\370\217\337&\302\367 ]\250\305u\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375 P%\002"
+	.string	"d\003D"
+	.string	"\004"
+	.string	"\003\001\001\001?\177\002\001\177\002\b\177\002\013\001\004\001\001\001\001\377\001\177\002\001\177\002\006\177\002\004\177\002\013\002\001\001\003\177\002\001\003\005\001\377\007\177\002\006"
+	.string	"\004"
+	.ascii	"?\007hj\260A(\033h\003"
+	.text
+	.section	.gnu.lto_.pureconst.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"%\004"
+	.string	"bG\024\034\240'\351\340\277\376\337\256\370\257\377\267\252\372\347\377\277v\200\326\257\034#\237\020\"S\n\252\256\345C\223N2\351,N\303\020\031\256\341M/\314\327y\314-QO2\351`(;\272j\304`U'\\Q\211\334)\230H\244\273\201\021\t[\200\202X\334\023"
+	.string	"*\001\336P\250\023\354\202\361\334\017B\n\016(\354t`!\246\030\340b\312HEi\021l\0318\333z\203#\210\245\324\020\013u\037\030\245"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.lto.14c5399d78601fe5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_huffmanEncodeInit.0.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375`H\001\345\f"
+	.string	"\026WUC\020Q\234\016p\331[\n\240OU\bvKle\343\254\233\204\r\200\334\214\013\223?\206'\037\267}\310\364\217\031Y\357g\245\274\365\021w#"
+	.string	"\345\267\202l\207\306\026R.\031\266x\256c\205:\322&{\247\024>"
+	.string	"B"
+	.string	"B"
+	.string	"\342W\244\023\330M\341\b\331\0357\326d\247\036\177\301N\263[\260S\213\366\016\003\032\002\2546\200\234\354\2566O\\\274\024\375\203\234rB\225.?\032\354\256\345\t\345\341\236\267\215\3006\004\373\2543e\237\365\323\217\377\374\352\227"
+	.string	"(7,\255\335\016\255\036;Bk\250\260\375\212MK\266\331\342.\304\263,r\r\330\f%8\204\354\356\306\235\354\364\300Eslr\034\235<\310N\251\215\355\322\376\212\263\b\257\230\355}F\305\250BhnW\270\214\f\211\t\b:m\321cX\004\203\342\303\234vx\030\243lw\027\370/.X\020\240Jq\352\223\260\323K\t\t\223l\371\202\322\261\222\207=\226\3444a\377\332\335u_\327\241\200B\007`X1'P\360\371l\\\307\200c\351@\017(\242\3468\237\307\003\201\302\b\332W=\257r\332'\301\343i\\H\244q2\256\024\272\220\006\326\032\322*\343\376\332\2312\0351b\232\030&\234F\001\022\023\021\001\035"
+	.string	"TF"
+	.ascii	"\232\265e\342I_4<6\026\327\020\230\037h7f\260\003\022\202a\340"
+	.ascii	"\332\340\007\264\333\224p\230J\b\206\221z\327\274\261X\\c\033"
+	.ascii	"\314\354@\f8\341\204F\200\"h\f\204\302\035\256\341\2050\311"
+	.text
+	.section	.gnu.lto_huffmanEncode.1.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375`\350\006\225'"
+	.string	"\352FL\017H\220\232Q:\003\242\347\006\200\304\311\242\222\240\352U\013\304^\333\3223\255g\232\255*\305\254Tz\"\263\201\377\376g\343j \2518o\270$"
+	.string	""
+	.string	""
+	.string	"\213\270\2347#\354\257\275\250\2511Aj\355eA\264A\b!{\313\235d\343"
+	.string	"\313"
+	.string	"\344"
+	.ascii	"v\270\325D\374Bq\225c\326\342c\275Z\035\254\306\210\335{o\267"
+	.ascii	"|\302\264T\271J\237\205\217\325\347:\025\321\322\345\336\033"
+	.ascii	"\201I\354\310\365\225\031LB\230\267\026*G\261h\b\371\\'+P\036"
+	.ascii	"\314\333Z\226;e>\361U|/"
+	.string	"\326\370\317\275F\270\272\334[\214\3007\363\226\213\346\245|\212\217\371\b\342\251*\021#\304\022\347\336\213C\360\032y[\017D\3366\022&\271<;;;{-\236\315\366\3754K\322\326\246>~VW\224\224\215\237ft\374\340\002R3\301\221)\037/k\371\224\203\t\217\224\260V \023\373rC\352\211\222Nz\3346\0346QR=^+\006*P\206\347r\212C\312\2516VV\327\255t\374\240}\256? \323\206\310\224\217\323R\303\275\227i\224\324\324Y\347\314\274\305\314I\314\344\222\272{\341\243y\357\245\300\357\342\203\322\302\\r\313\257A\336\276mC\342\217\236q-\212\231K\3450\027m\320\256b>\t\226\325\204\333\b\363\355\306\263\203c\375\r~\345g\360,\377\202o\235\213^\374\025\330*\345\003%e\"\032e\003$\345\002\2252\201Jy\210FY\350\244<\340\244\034T)\327*e\001'e\240\223r"
+	.string	"\035\312?'e\237k\235{N\312<\2252\200Jy\247\244L\253\224u*\345\263R6+\345\322\244L\232\224mI\2716\345&)\323J\371\270\236'5\260{s\234\315\271e\354\227&7\376Z\377\326\233\371\226J\216\277\205\317\205i\226\230c6\322\320"
+	.string	"\204\002a\006&vo\361\310\274=\263\217\257\345\\L\013Mc:\253\353i\312v\225\227\200>\303\307G\2719[@\2671H\005\f\003\324fP\364$\351c\224\233"
+	.string	"\355\323@-d\024\362\370\351"
+	.ascii	"%"
+	.string	"^\306\304O\177\313\220\270\323<\355\323v,8\007x\342dP\360\364\202\256\nI\310\304jWqQ\003h&+d\234(\031\357\264N\003h\262,HE\353\035N\361/$\363^'\n|/\037\023\0254\310[Zg8\333l\235\256aA\252\025\017s\266\321\220\370\345e\233]\215G\357*\2736$\352\2748\350\033\217\200\354\006\355\240\273,xu\366\"m\223m\303\202V\265m_h\366;\030\031H\374\031\375\033@h3\350\356\007\257lM\233\034#4;\227\233h\252\\\330b\345\253\371fA\310\247\324\244\024\365\267\216\340G\345\260y>\222\357\242~Y\320\nH\317\23093\230z<\235\215\321\333m\3505-\225\273\363t\"x;\233\324\264\201\267\263\272\027,\216z\226%L`\301\"\207\244\263`\004\244\353\035\365bXF2\342\035)%%5\271\300\361\226\224\224\226\220p\274\335\221\022\016\211)\006\316\310"
+	.string	"/\301\3201\341zKKL8Z\361\336\2645\327\266uOO[\020\362k \327\306\316\256\342RLy\353\336\242\267\333\372\306\202\2665\207/'JV\273\210\330Z\303\217\312y\006(\254 f_\013\302m}\353\007\251\200\\?\307\250\320\262\253(\2217\007:H\rq\210W\275\367^\222\250\371m>\214 J\262#\0074Q\223G\241Y\201\026j\003\335\307\340\325P\027h;&4#\320l\212 |\250\tP\205\361q\250\213\206\304\037\211\257\331\t\325:\250\007\264PX\320LMPcPC\374\201\325\322\324d\034\350ZwX\200\203\250A$\n*\206H\r\211D2R\320\2461p\002\02113z\021\200\2554U3ZP\234\003@\240\004\025\350\336\022\336\031P\016\022xhv\"l\324\236\321=V]\271\252\262\n*phC\350\033F\373\2724\315:@\004\206\255\370\t\346\340\366"
+	.ascii	"qa=\367\033\016([\2653\217?4\003lgx@\365(\301\312\310d?\3506"
+	.ascii	"\200\016\ra\221S\033=\376\177?\342\351\211\225dj0%7\245\303V"
+	.ascii	"T\371\202\235\003\337?\302\345^\260\217\027e\023$\255O~\351\210"
+	.ascii	"\020i\244\030\367/\350N\321'\325c\007\234{\253IG2\340\251\204"
+	.ascii	"\264ik&\325\306H\210\275\207\265\030\276\025v\t\003\210\200\325"
+	.ascii	"\307\301'H\237&yb|\016<?d\243\376\274X.V\2247;\371q\266\347\267"
+	.ascii	"q\303\223\211X*\2514\337\017\211>WYgz\312\303\362 [\025\177C"
+	.ascii	"\304\302\215\007\340\n\026\312\016\005r\003\336X\224\0071\240"
+	.ascii	"U\332\020$\263o\3352Ei;\370\364y\235\035\017S\001"
+	.text
+	.section	.gnu.lto_huffmanEncodeFinish.2.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375`\033\002\025\021"
+	.string	"\306\037pG\360\260(\035\322\027\027\340z\335\357\2265 \252h\2421"
+	.string	"\350\373p,\227{l\366\236\271\255S\371\324\027m\177\tG\251.D\325\351\332^\367\f<\027\266\223\272o\305!\206\324\007\004\260?cF+-H#{K\231R["
+	.string	"Q"
+	.string	"_"
+	.string	"12^\314\t*pIwi\260\263\355\243x\n\230\035Fp\306v\230\f.,t\3149=\222\027\340.\343C\270\313\025q\330\343*\314\277\315\343\316\207\0345[\354\361\345\033\017\334f\274\b\260\265D\004=06ns\325`\233\251\212\034\3149\2555\033\207[\3366\004\333\017l\215\005$\232\032\231\016Yq:\370L\r\262\301\230\256\214\3758\347\234\336\030[\325\245\203\177"
+	.string	"N=\212\352\017\251\356T-R5\027\325r\325Q\325\273jU\365\007p\267\036\223\316\234\033\206\204&\r\271S\3026\314\006\261#\217\311\325~\315U\300\016\262\2744g2t\351!\332\234\221\231\327n$8\267\242\225!\355&\341.\034r;BS#Ky\213\025\271$\232\215k\312\241\t}\273;\344vM<h&f:d\233\302qX\272'?"
+	.ascii	"p<(\211\332\255gW\306%\377\246nxZt\207\355\357+\034vs\316\023"
+	.ascii	"\377&\302\205n\304\245\317\302]~\003^\300 \2252Q\255\032\234"
+	.ascii	"BV/\324KEZuj\241X((\030&x\255\217\305\372T^+\005\305\362T.\025"
+	.ascii	"\357$\342\317\302\312\345\275\276\317\345\201\200\363\033SZ\022"
+	.ascii	"\331\316b\224\226\300O\210\2702\366w\030$\221\0328@\370L\r\362"
+	.ascii	"h}\235\n+\003\376\n\027w\264\022\310\245G\267r?V\201h'\270\355"
+	.ascii	"6' \200\002\2211\355\001@VP\f\230\330\214=\243~\335\254\224\330"
+	.ascii	"\275\206\221\203g\202\342\354U\342\0024\024\364 \314\305\013"
+	.ascii	"\004\034\334$P2`Y\363\026OGm{y\320\244\275\320\222\234\206\031"
+	.ascii	"\300\222\231\244\325\222\235\324\3063\224K\314u&\326)c\314U\017"
+	.ascii	"\302\211Hi\320R\244)\305\202\002"
+	.text
+	.section	.gnu.lto_huffmanDecode.3.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375`;\017]P"
+	.ascii	"\252\211\364\035S@\220\312I\007\027\316\363\243\327\004- \350"
+	.ascii	"j\n\342\333B\222\363\274p\307\357s3\177\t\r\032\\\027\305WdG"
+	.ascii	"_\252\370\257\2609\220P\322`\f\027\207\251\370\341\f\331\245"
+	.ascii	"5\257\013\031\262\317Jh\344\0213\322D\305U\250\364\3167#\333"
+	.ascii	"\324\032!R&\031\320\001\235\001\310\001\3132\233\376\354\266"
+	.ascii	"\345\225\255.\305\275\230\375\230M;m\315+k\367i\257\303\265\234"
+	.ascii	"\313\225\377r0W\333\264\217a\272\230X\371p\344\007*X\253\226"
+	.ascii	"\024*\"@\341\341=<=\355\bZ\317t\210\261\360\212\376\374\331\211"
+	.ascii	"\025\320\336\345\351^\230\320JE\207\326\224$\265Z)\356\360-O"
+	.ascii	"?sB\353\031:%\326\002\\\255aL\350\317 g1[\345\217\224\fT.@\177"
+	.ascii	"v\016\305\335\262U\242\036T\241I-3\270Z\353\360\347\036\241<"
+	.ascii	"W4s\320\340K\020\270\344*\315`\225\322\2022\001[\261q\330\240"
+	.ascii	"D\260J\211\205\320\303\207\"\363oX\345\366j\315J;\253\265\302"
+	.ascii	"\330\034\350O\336R<\357\236\206\327\360\3640\016\236S\353\026"
+	.ascii	"\226\263Z\303`\354\020\375\271a\350\301\216\345iWi\206uY]\353"
+	.ascii	"jjL\256\326J\374\271p\367\323\374\316\356g\257\320\003\362\352"
+	.ascii	"\352\352\352tv\367\227.\327\233a_s\367\364\035\241NN\020\347"
+	.ascii	"\006\370\343I}=\224\267;{\314\346\247\275\317\312\203\357\\]"
+	.ascii	"\270\254\212\342\306\002\353|=\007\212\225*/\016\232'\240\230"
+	.ascii	"+\310h\241\271\225\252.\306YV\241pc&\340\205\t\t_Va\231\034\345"
+	.ascii	"-\210\247\271\n+UQ\030\270Sr\365\337\327yL3n\256\206/\253\244"
+	.ascii	"\230\bPI\331\3602\037p\252\202\222'\3679a;rO\005%'\034U\221\245"
+	.ascii	"\244\311y\246\013\2540K\276\254jb\n\311h\241I\255\246x\307\366"
+	.ascii	"\034ZX\202\310Rr\302\317=\324\223\367\230\021\304\221\371\262"
+	.ascii	"j\212\251\300\024*\024>\346\214\264\212b\263\312\222"
+	.string	"\367\307\334\205\223-TVK\316\274\033\265\326e*+%_\022\337\275\334\356V\331\005\036\003]\247Zs\247\335\256ym\306\035\261\242\270\256\351jNh\255\325\306\256{\274\320\240\372\354O\321\355Z\3605G)\334j\225\022\332\007\221\004\tE\227\024\r:\305\033\r\334\024t\367\217/\230_0\2737\367\217V\242\270n_\364\273\225St\277\244\262]@\231\273\352\035&\220\002\024\317\355\307\334\204!\213\223]\216\240P\n<\314q\274\340\240\270n\257v_\222\313\262\362\334n\230\007\334\\\273\0272\303\332\336\3325\n\002\3449\374\024\374\360\321\343a\377\003E<v\020\035\207\337\201'\177\035\277\341\317q4\337\006\030\030\302\261\300\r\346\265Q\343m_!\032/\373\316\270\231o\320\227\337\242\214\0307\373\022\201~\366\205\361\265\357\013\037\357\360\274.\200\274\0060o\001\314\333\"\345e\301\274+R^\002\230w\200\224W"
+	.ascii	"\346U\361\343\375\371\361\006\360\343M\301\274(\230\327\207y"
+	.ascii	"\001`\336\023>^\023\315[\002\310K\202y{~\274B\346\345a\336\035"
+	.ascii	"\346\325IysR\336\240\217\027\347o\337\033\346\005\372x\177&o"
+	.ascii	"\332\343\365\365x{)/\232\362\362R\336\035\363\236>^\323\344\355"
+	.ascii	"\036/\367x_\001O\f\031\023lj%\241\316\210:\346Dk\341h\376\267"
+	.ascii	"\277\3557\363/\377\265\277\3547\373\317~/\177\332\357\303\037"
+	.ascii	"\346\300\335\233L\212\373\037\366i65M@c\324\241\314\032\234\024"
+	.ascii	"\364\247IU\334\277\355\317\230\310%\231\326\026:\267\272621-"
+	.ascii	"p]k\212{3{\266M[\210\26521,p\035dW\264\330\270\200\323\\5\330"
+	.ascii	"l\204\266N\306]\3354\327\016q\205N8\374\376n\272F#WH\243\327"
+	.ascii	"\374\335\350\031\215\374\231\243rW\324\b_\3675\177\0134P#g\264"
+	.ascii	"\216\032\252\243u\332\034;ZI\363\217@\346\302\262\236\251\262"
+	.ascii	"\004\352\237\315\350\227m\215\376[\332\tU\200\315\265\214\303"
+	.ascii	"\243\237\002\230\232 \217\276\331\321\b\360\020\334\3217\032"
+	.ascii	"\3118D\3754\357u\201\355\020$\352\005\376v\242&\355\307\323["
+	.ascii	"\333\363\301\367\243_\346\250\\\fX=\3105}8\314\3040B\317\360"
+	.ascii	"2\032y\205\211\317G_\355\250\034\ft={\247\035\214F\002\213&\233"
+	.ascii	"\254\237\311(\366\227\037k\243Bj\366b4\216F\356\376\350/\213"
+	.ascii	"\375\203ER\210\245\217\376\331\177^\300.\247}\364\343\216F\300"
+	.ascii	"\350`\3474\307\005{\305\033\032Y\t\354k\256\355\315\200\006\351"
+	.ascii	"\263}\305\3279|P#\027%\366\232\247\214\216\321\310\023\361\240"
+	.ascii	"\253\030\314s\033\3247c\326Zk\257\271|TbP\303\003\322k\356b4"
+	.ascii	"\261\221\273A\372f\202:H"
+	.string	"\377\\\311\"\226\304\276\031\2438XW\032\371\340\3649\006\244o\026\243\201\264\311v\304\342I\036q)Q`\240\201\327\\[l`?K\354\355\327\3006G>\030 \221\370\265\217\257)\350\364@\274\327\276\240\3565\307M\321\335$\347\272\r\034\027\271\335\004l7\263d\375\222E\240_d4\312\006F\357\356\223\223\203q\022\372x5)\363\213\220\214;I\230\002\302\331\\\373\236\336Z^\2336\352>\303\303\277h\344*w/z\350\214\024\267Y\313\252}\003\212\347\336\205\f\3144\352\257\375\347\305_\264Q?\200d\227%\257{\002I\222\206,)\235MN\306^J*\322J\307\240\351\202\245\244\"i\322\020\343PO\202&&$JDR&^\322\020#\222\231$i\310\022Q\021\243\020#\0330\245MJIE\204\0345\235KIEKJ'\021'\034KJg\323\222\223q\250\311\311\210n1H\210\020\031HI\007"
+	.ascii	"\355\020q\302\321\344d\334-\022\320\322\221\021\"D\2340 .\031"
+	.ascii	"\215\0301\"\021\227\224\216\214\020\221\2200\021\201|\326\230"
+	.ascii	"A\022\022b\223\321\210\204\230\206\325\367\326\002\201\016\227"
+	.ascii	"E\215N\216\036\0036\345\006\3506l\364\336\200\352\250e\362\222"
+	.ascii	"v\304\2545"
+	.string	"\353j\317\201\273\201\353v\022\370J\023\366\326\246_9=\372nbx\206\027\312\031\272\262\003\317\3604\032\231\243\205z(\214\024\267\271\"{B\243_&\324oS\300\213\234\016\0260\272`Q7\320H\006\032)&\270\243\207z\364\333\204\272\207\333\317\302\324\023\0362\345\260\227Ex\3722\"\341\306A\032\2525OS\2564\032v\013/4\003\372\201v!\324\0064\0371E\327@\267\350\002\2327v\304b\321-\210\370\027\026M\303\013\215\207\254K\017\00409\315\265E\275\242\277FL\f\001\275\202\200\246q6d\276\202\306]\321\332\r\031\227\242>\232\001ZE\0275\037q\244\"@\017\320\201\333\301\b\320\30474\242V\321&\333\024\035T\r<\372o5\232G\363X\226\035\375\262\031\275\243Yy\304\212\002#\372i\242\346\026\366\317\222\250\013v):\200\376T\023\024\235\242Mh\231\242\363\351\023\215\242wi\216t"
+	.string	"4\317\247yjG*Q"
+	.string	"t\t\265#\232\211>\301Q\020\034\241\373\rv?M\364\221NH\264\003]\242O-\307\027z\232D\177F\367\364n\3548C\013\333\034\233\242\203\372N\363\364\217F"
+	.ascii	"\365N\2672\201O\250a,$\235C\204HDD$I\222\264\006!\005\304(\n"
+	.ascii	"%4\017\021\220\261DW\242\264\035\326bw\031j92\332e*\252\253\034"
+	.ascii	"77\363\311\030\023\302\311\223\241\034\\\363RO\216\341\240z\213"
+	.ascii	"c\235P"
+	.string	"\201W\250\022\376~\246\032\345\363~\017\240\331=\216\372\203uV?_\265%+Y|\351\362\242j\017\036U-\334U\001\221n\"x\025&a\341D\241+\355T\2012\2107\001\350\316~\214\027d]\364\307\212\025\251\331\036\366\234:\204\337G`\nl\234\300\020\214\315\310\r\226\371<\223D\203\304Q\260\317\335\244\3369\\\244\001\277}\362\021{i\f_\"\277\231\264\004\303#+n@\256\026\304\027\"A\310\323\316\214\364\203y3!^9b\342\003\201"
+	.ascii	"\033\317\232\355"
+	.string	"\201\007\352\036C\312\322\313\241\341\004\222\004\277\261L\003\360\314\264N\004\200\354\337\326i0\fJI\220|\330z\352{\344S\343\270\236\023B\263\251\017\006Q)?\006\310\213\355P\"\232A\304P_3\247\316\335D\262\307\342\213W\370\343<\374\031\354\340Lc\030~\023V\031\210\372\026\357\211\340\205\330\307QU7u\016\237N7\307q\035\2772\200\006\\\362\367\263Ue\217\235\b\257\230\325\025_uS\307\331\353\215R\210v0;t\325\213\3053\210\214\365\244\321\261\355~b\260\322\266$\00166\334\221\2241\025y\360\300\271\373s\263\351\256\255<\005'my\302\257\230\3412`\373\241\036\217\236\023!\215\347=\b\006\312\306\207\247J\016qM\006,\2574U\346f\272\316\246\316H\023\273\304\301\327\250E\260\354\331\035|L\351<Y\376>\216W\335\004\330\256\346\341\r\n\227\003\250\227Kyr\253`\326F\312R\212"
+	.string	"\260+\371\204/\254\fM \\h\320\314C\352\310\215$S\302\272\2279.\322\216Saz\357$h_\2620\023\007\240\376\342\035#\351+\3034\303\241@e\265&\315\210F\017\357\320\266\362\243"
+	.ascii	"\220\246\270\0045\"\030\210hY\004\337\210\270I\233\226\225\301"
+	.ascii	"K\206\213\257#9\372\253\232Rs0\211\202p\270\275b\214\356K\001"
+	.ascii	"\020\251Ff!\246wpk\365\243\344\322\276\275\217G\003\006\371\241"
+	.ascii	"\331\215\266\bav8z\260\262\206X\246\343\243\030>=\236\262f\326"
+	.ascii	"\326\030@\247\277\202)\210-\213\201\020\376\371\037\211\206\204"
+	.ascii	"M\310\017\252\035\210\311?'\235\344\240\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375 c\325\001"
+	.string	"\264\002_"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\020\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\001\177\021\257\307\337\006\002\177\022\003\177\023\236\3146"
+	.string	"\004"
+	.ascii	"QuE\252o\350D\343\006s\f"
+	.text
+	.section	.gnu.lto_.refs.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.14c5399d78601fe5,"e",@progbits
+	.string	"(\265/\375`\375\n\355:"
+	.string	"\352g\224\026DPdR\007\245\365\247\036G\276\"\324\311\002\334s[\355\331-B\006x\027\314b\341\2217\321E\325\254\274"
+	.ascii	"\022\240\311\333!\200B\371\375\342\243\220\001\270^\321\257\274"
+	.ascii	"\002\302~\034\032t\225G\347{\273\322\312\224\0023\001[\001R\001"
+	.ascii	"\026\272\205TWs\263\336\033\366\017\365\002\276\271\271\312\302"
+	.ascii	"\347\377]\343l\234\315\325x\032\177\235\352k\355f\374L'\275\377"
+	.ascii	"\312\377\217\220\004\274bk\306\375r{\262\365$c\333QmC\265\335"
+	.ascii	"\242\355\252#\261~\346b\374]r\264\3660\376\245\205\224\357K\205"
+	.ascii	"\346\344\351\232\342\334(\332\366%\026\350Kl\207h\263\037\261"
+	.ascii	"A?b\0278\022\333\355R3\237\224\355\316\r\347n7\353\366->\346"
+	.ascii	"e=\027\353\371\323\377\327\b\303\265a%qv.N\346o\002\367\322\025"
+	.ascii	"0t\357X\366c\377"
+	.string	"/\220(P\226@\177pn\016\355O\251\275K\003\313\036C\343\266=\001\353WO\300\366\353Hl\353G\254\203\027z\272\373Ow\323\301\036\330\250\351\242n,\241\273\275\324\231s\203\320\335J\335\375\242\273\021tw\203.\320\215\037t\267\232\356^\303\246\273\323t7u\250\033\033u\273\202n\037\320\355\001\272\275\355n@\335]\207\326\335+\272;\257\273\361\272\273\254\273\255\335}\247\273\253\335\375\246\273\333\272[Ew\273\351n\263\356\026\320\335m\272\333w\275^\257\335\216\325\355;\272\333\267\377\037\324\344z\377\215\004\335(\223\371\277\225\304|\256\343\332\362\037O\347\324\234\2564\311S\270\006F\032\375\036\357\321\243\037\007\326l\245G/\217\365\377\236\247\215:\201\330\341\374\016\251y\235\005\001\224\227\257T\323\300\340\334\236\327\355~\374\217\227\301\310tbR\254p\016\276#\261\370\371\b\333\373\374\256\256\302\356p\366\353\036<"
+	.string	"K\267,(8\267\343u\373\235\353\3618\177\022\360)\251\206\231\341\354j\216\304\032\360#\326\355\204\355y\216\330\346\326\373\300!\2674\326.8\377\374\b\217R\253<\2036f\2753t]&\2278\327\275\322;\270\2549\271\266\216\333\361\327\351\\\016\277\377R\247\3638\036\347\325&\037\306\264\274U\300\340t>\347e^\335\352\240e\213\365\377M\212\020\001\200\234\021\27186\267\303i\333\315\264.\307\347\370\253\344t\332\341\374\255}\310\367_\374\004\320\231\331Y\333\256\304\366\256WWb\333\245-\366#6\b'\001\360\035\302\204V\337\364\256\270\334\225y\307~ZZO\236nKD}\346$\261\264\271)z\202\346\225\206s\233$"
+	.ascii	"]\304\326\034qn\027k\333\307\2209\233z\332\230\030\253\177\351"
+	.ascii	"v0h\232Z$\364\017\206\026\3651\247z\231\246zu*\202\312\324\372"
+	.ascii	"\377\035Z\300/A\374L\265\262~bvwt\352^\266M\364\213\312t9!+\350"
+	.ascii	"\035;8c\037^\275\372\271J\323Z\037\232\222_\3617>\366\021\273"
+	.ascii	"\276\365=;d@\310\370\374\326\326\222o\312\305\007[\217\306n\327"
+	.ascii	"\375\376\307\376\037\201"
+	.string	"\257\312\0204rp\306I\274,\202\332\365\251\342%\346\301Z\265t\305\265\031\022\203s\311p\306J_\303Q\"Vy8c\244\233\0211\303\220apn=BY\310\332\2266\234\033w\265\335\270\233}d\363\377\177\370\336o&\177\355>\367\245n\"\357\345\357=\210\376C\255wm\2252\310#8w\367\202\357\356\376\360G,J\244\323\350\337o\272R\260\243\373\345\315i\364\376\027\201\227B\337}\301\234\371\371\370\337\367W\2029q\270\357\263\351\276\317c\360\225\317\343\377\353\f\272S\344\321])\230\323\225>\235F\257\374\343K\221_\255\362\351t\335<\235AW\212t\272J0\247\021\022\253\023\246\325\025\331\305\217\256\362\263\230\\\310f\260\352\276\317\217\373\367\351\362\233\r\376\271\236\3158$\021WKV\263\222i\310\247\277\377_\200\231L\362|e\325\265\362\374\267\222\254\361\314\013\307\267\372N\274z\204r=\326\362\337"
+	.string	"\363\377\350_\375\377c\306\"\2617\024Q\203\212X$\222 j(#\261h\2428\302\250\241\210S\303\342\220F\333\027\232$4e\310\021\324\0316P\330@\201\355\f\033\204\302\rM\302\266\233\204=cqx\"\210\312ih\343)\306\n\243S\223p(C\n*\033\273\006\202\226\2721\234b2JIM1\r\031\213UR!\214\304\247\226\312ih\214aTQ\304\026\207'\252\244\204\212C\243\2218\345\202jh\324\361\3643:U\260\320N\rg\314\250\002a$>\t\031\2352\030\213\304\252\240\256`\341\351I\b5\3240\341\2505h\b\261\200E\212\022-\324\204b\214\250\0313\252j0\025\245\242\242\244\240\230\212\304\030QLPSTL\023\0164\206\372\365\232\007\005\272\322\347?\022/\301J\032C\333\031\2703"
+	.string	"\302\300J\202\305f\374\304_\3766\025\203\275\322\"7:s\342pn\234\327\346\bj*\213\275lma\257\256h\035\223\262\267\256\306^T.=xo8c.7\363\341\331\352\242\342\214\2174\025\363\371Z^\341\214\215x\365\307fK\021%\316\270HS\355\310\254\204\321\022\n\213\"'I]\233\325\202\004\301C\340\334("
+	.string	"\037cS\310\bi<\0047\201B\207\227~m#\203\306\326\346;W}\205\177\264\301O\316\261Y\361\210<!\342l\374\203:DG\206\307\025g\334\304\313\026P\034\247\025\316\030\013\007\200\336\250\3218e\2303\"\"$\")hA\322\001\220\002\221\251\263:\021\240)\223fJ\222\222d\353"
+	.string	"\251\b\030f\331\024*g\310\221\346\255|\364Y\217SM\205\346 \260\377J\022\360\3512Q\240\201\354\325\306\212V6\322\232\361\307\007T\3104\344e\006\376\244\007MD\271\217\357T?\231c\3561\332\367\236\235\n\350-\007\244\367\324\207uM\001i \242?\t\006\0328\f>m0\260L\3719\210\220\264!\310G\361\001\276\355\361\231\237\352"
+	.string	"\375\371{&\244\316R\300\351\237\023\026\226\247vB\203\307\302\264<\322]j\310\233\217\301\032\365\220\027\216v\003#\357b\252\033\232>\235"
+	.string	"\314\276#\220\200\355R\263"
+	.ascii	"Lxs\320D@y\234\304%iL\231c\230>\201\253\226,mY\371\222\244\317"
+	.ascii	"\0162\025\201\004\227\236\255\004'y\261\3427\322d\177\310\314"
+	.ascii	"JJ5\222\020\203\177\032!\016\247\355\353\006h~F\00616\362\245"
+	.ascii	"\212GH\324FZ;\020vf'P\032r\203eY\003\023\027\305a^t6\314\252"
+	.ascii	"\r\332d\274\202>\016S\234\262]c\366\272\377\343\347P\210\216"
+	.ascii	"\277hE\210\222\205\370\006B`$X\332\256\270U\207u\324z3w\241\343"
+	.ascii	"E'\035\232:N\301G\3464(|\220N\210=\234\001\276\026\\\300\023"
+	.ascii	"\333)\232\005G\021\227\311,\355u;\240\033\374\302\361\013|\203"
+	.ascii	"c\315\206\362s\353ql\230W\343\312\272\336\023|\215`\346\367\237"
+	.ascii	"N*\034\357\315\375|^\310\364/\232\265\201\216\355\246\027\201"
+	.ascii	"\377t\205\305\317\2054\373;\034\206\033(h\333\264\371N\256\002"
+	.text
+	.section	.gnu.lto_.symtab.14c5399d78601fe5,"e",@progbits
+	.string	"huffmanEncodeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"huffmanEncode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"huffmanEncodeFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"huffmanDecode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.14c5399d78601fe5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,12470 @@
+	.file	"maths.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/maths.h"
+	.file 5 "./src/main/common/maths.c"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	maths.c.95b6c0cd
+	.weak	maths.c.95b6c0cd
+maths.c.95b6c0cd:
+	.long	0xe68
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF1551
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1453
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1454
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1455
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1456
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1457
+	.uleb128 0x5
+	.long	.LASF1458
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.long	.LASF1459
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1460
+	.uleb128 0x5
+	.long	.LASF1461
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x5
+	.long	.LASF1462
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1463
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1464
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1465
+	.uleb128 0x5
+	.long	.LASF1466
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF1467
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF1468
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x19
+	.long	0xb5
+	.uleb128 0x5
+	.long	.LASF1469
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1470
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1471
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1472
+	.uleb128 0x1a
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.byte	0xe
+	.long	0x107
+	.uleb128 0x15
+	.string	"X"
+	.byte	0
+	.uleb128 0x15
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x15
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1473
+	.byte	0x4
+	.byte	0x2f
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x16
+	.long	.LASF1479
+	.byte	0x14
+	.byte	0x31
+	.long	0x15b
+	.uleb128 0x12
+	.long	.LASF1474
+	.byte	0x33
+	.byte	0xb
+	.long	0xde
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1475
+	.byte	0x33
+	.byte	0x13
+	.long	0xde
+	.byte	0x4
+	.uleb128 0x12
+	.long	.LASF1476
+	.byte	0x33
+	.byte	0x1b
+	.long	0xde
+	.byte	0x8
+	.uleb128 0x12
+	.long	.LASF1477
+	.byte	0x33
+	.byte	0x23
+	.long	0xde
+	.byte	0xc
+	.uleb128 0x13
+	.string	"m_n"
+	.byte	0x34
+	.byte	0x9
+	.long	0x7c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1478
+	.byte	0x4
+	.byte	0x35
+	.byte	0x3
+	.long	0x113
+	.uleb128 0x16
+	.long	.LASF1480
+	.byte	0xc
+	.byte	0x38
+	.long	0x191
+	.uleb128 0x13
+	.string	"X"
+	.byte	0x39
+	.byte	0xb
+	.long	0xde
+	.byte	0
+	.uleb128 0x13
+	.string	"Y"
+	.byte	0x3a
+	.byte	0xb
+	.long	0xde
+	.byte	0x4
+	.uleb128 0x13
+	.string	"Z"
+	.byte	0x3b
+	.byte	0xb
+	.long	0xde
+	.byte	0x8
+	.byte	0
+	.uleb128 0xf
+	.long	0xde
+	.long	0x1a1
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1481
+	.byte	0xc
+	.byte	0x45
+	.long	0x1d1
+	.uleb128 0x12
+	.long	.LASF1482
+	.byte	0x46
+	.byte	0xb
+	.long	0xde
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1483
+	.byte	0x47
+	.byte	0xb
+	.long	0xde
+	.byte	0x4
+	.uleb128 0x13
+	.string	"yaw"
+	.byte	0x48
+	.byte	0xb
+	.long	0xde
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1484
+	.byte	0x4
+	.byte	0x49
+	.byte	0x3
+	.long	0x1a1
+	.uleb128 0x1b
+	.byte	0xc
+	.byte	0x4
+	.byte	0x4b
+	.byte	0x9
+	.long	0x1ff
+	.uleb128 0x1c
+	.string	"raw"
+	.byte	0x4
+	.byte	0x4c
+	.byte	0xb
+	.long	0x191
+	.uleb128 0x1d
+	.long	.LASF1485
+	.byte	0x4
+	.byte	0x4d
+	.byte	0x13
+	.long	0x1d1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1486
+	.byte	0x4
+	.byte	0x4e
+	.byte	0x3
+	.long	0x1dd
+	.uleb128 0x1e
+	.long	.LASF1552
+	.byte	0x7
+	.byte	0x8f
+	.byte	0xe
+	.long	0xde
+	.long	0x221
+	.uleb128 0x1f
+	.long	0xde
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1487
+	.value	0x16c
+	.byte	0x9
+	.long	0xb5
+	.long	0x255
+	.uleb128 0x6
+	.string	"crc"
+	.value	0x16c
+	.byte	0x1d
+	.long	0xb5
+	.uleb128 0x6
+	.string	"a"
+	.value	0x16c
+	.byte	0x30
+	.long	0x22
+	.uleb128 0x8
+	.uleb128 0x7
+	.string	"ii"
+	.value	0x16f
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1488
+	.value	0x161
+	.byte	0xa
+	.long	0xc6
+	.long	0x2a0
+	.uleb128 0x6
+	.string	"crc"
+	.value	0x161
+	.byte	0x26
+	.long	0xc6
+	.uleb128 0x11
+	.long	.LASF1489
+	.value	0x161
+	.byte	0x37
+	.long	0x2a0
+	.uleb128 0x11
+	.long	.LASF1490
+	.value	0x161
+	.byte	0x46
+	.long	0xd2
+	.uleb128 0x7
+	.string	"p"
+	.value	0x163
+	.byte	0x14
+	.long	0x2a6
+	.uleb128 0x2
+	.long	.LASF1491
+	.value	0x164
+	.byte	0x14
+	.long	0x2a6
+	.byte	0
+	.uleb128 0x10
+	.long	0x2a5
+	.uleb128 0x20
+	.uleb128 0x10
+	.long	0xc1
+	.uleb128 0xb
+	.long	.LASF1492
+	.value	0x154
+	.byte	0xa
+	.long	0xc6
+	.long	0x2df
+	.uleb128 0x6
+	.string	"crc"
+	.value	0x154
+	.byte	0x1f
+	.long	0xc6
+	.uleb128 0x6
+	.string	"a"
+	.value	0x154
+	.byte	0x32
+	.long	0x22
+	.uleb128 0x8
+	.uleb128 0x7
+	.string	"ii"
+	.value	0x157
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1493
+	.value	0x150
+	.byte	0x9
+	.long	0x107
+	.long	0x308
+	.uleb128 0x6
+	.string	"num"
+	.value	0x150
+	.byte	0x1c
+	.long	0x9d
+	.uleb128 0x6
+	.string	"den"
+	.value	0x150
+	.byte	0x29
+	.long	0x9d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1494
+	.value	0x14c
+	.byte	0x9
+	.long	0x9d
+	.long	0x32f
+	.uleb128 0x6
+	.string	"q"
+	.value	0x14c
+	.byte	0x1b
+	.long	0x107
+	.uleb128 0x11
+	.long	.LASF1495
+	.value	0x14c
+	.byte	0x26
+	.long	0x9d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1496
+	.value	0x148
+	.byte	0x9
+	.long	0x9d
+	.long	0x34a
+	.uleb128 0x6
+	.string	"q"
+	.value	0x148
+	.byte	0x1a
+	.long	0x107
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1510
+	.byte	0x5
+	.value	0x141
+	.byte	0x6
+	.long	0x394
+	.uleb128 0x11
+	.long	.LASF1497
+	.value	0x141
+	.byte	0x1d
+	.long	0x394
+	.uleb128 0x11
+	.long	.LASF1498
+	.value	0x141
+	.byte	0x2c
+	.long	0x394
+	.uleb128 0x11
+	.long	.LASF1499
+	.value	0x141
+	.byte	0x3d
+	.long	0x394
+	.uleb128 0x11
+	.long	.LASF1500
+	.value	0x141
+	.byte	0x49
+	.long	0x7c
+	.uleb128 0x8
+	.uleb128 0x7
+	.string	"i"
+	.value	0x143
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xa9
+	.uleb128 0xb
+	.long	.LASF1501
+	.value	0x132
+	.byte	0x7
+	.long	0xde
+	.long	0x520
+	.uleb128 0x6
+	.string	"v"
+	.value	0x132
+	.byte	0x23
+	.long	0x520
+	.uleb128 0x7
+	.string	"p"
+	.value	0x134
+	.byte	0xb
+	.long	0x525
+	.uleb128 0x1
+	.long	0x3cd
+	.uleb128 0x7
+	.string	"i"
+	.value	0x135
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x3df
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x137
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x3f1
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x137
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x403
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x137
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x415
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x138
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x427
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x138
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x439
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x138
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x44b
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x139
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x45d
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x139
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x46f
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x139
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x481
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x13a
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x493
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x13a
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x4a5
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x13a
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x4b7
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x13b
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x4c9
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x13b
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x4db
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x13b
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x4ed
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x13c
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x4ff
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x13c
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x511
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x13c
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x13d
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xde
+	.uleb128 0xf
+	.long	0xde
+	.long	0x535
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1503
+	.value	0x125
+	.byte	0x7
+	.long	0xde
+	.long	0x650
+	.uleb128 0x6
+	.string	"v"
+	.value	0x125
+	.byte	0x23
+	.long	0x520
+	.uleb128 0x7
+	.string	"p"
+	.value	0x127
+	.byte	0xb
+	.long	0x650
+	.uleb128 0x1
+	.long	0x569
+	.uleb128 0x7
+	.string	"i"
+	.value	0x128
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x57b
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12a
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x58d
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12a
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x59f
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12a
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x5b1
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12b
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x5c3
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12b
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x5d5
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12b
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x5e7
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12c
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x5f9
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12c
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x60b
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12c
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x61d
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12d
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x62f
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12d
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x641
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12d
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x12e
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xde
+	.long	0x660
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x6
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1504
+	.value	0x11a
+	.byte	0x7
+	.long	0xde
+	.long	0x70f
+	.uleb128 0x6
+	.string	"v"
+	.value	0x11a
+	.byte	0x23
+	.long	0x520
+	.uleb128 0x7
+	.string	"p"
+	.value	0x11c
+	.byte	0xb
+	.long	0x70f
+	.uleb128 0x1
+	.long	0x694
+	.uleb128 0x7
+	.string	"i"
+	.value	0x11d
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x6a6
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x11f
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x6b8
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x11f
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x6ca
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x11f
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x6dc
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x120
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x6ee
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x120
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x700
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x120
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x121
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xde
+	.long	0x71f
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1505
+	.value	0x111
+	.byte	0x7
+	.long	0xde
+	.long	0x786
+	.uleb128 0x6
+	.string	"v"
+	.value	0x111
+	.byte	0x23
+	.long	0x520
+	.uleb128 0x7
+	.string	"p"
+	.value	0x113
+	.byte	0xb
+	.long	0x191
+	.uleb128 0x1
+	.long	0x753
+	.uleb128 0x7
+	.string	"i"
+	.value	0x114
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x765
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x116
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	0x777
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x116
+	.byte	0x74
+	.long	0xde
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x116
+	.byte	0xc6
+	.long	0xde
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1506
+	.value	0x102
+	.byte	0x9
+	.long	0xa9
+	.long	0x90d
+	.uleb128 0x6
+	.string	"v"
+	.value	0x102
+	.byte	0x26
+	.long	0x394
+	.uleb128 0x7
+	.string	"p"
+	.value	0x104
+	.byte	0xd
+	.long	0x90d
+	.uleb128 0x1
+	.long	0x7ba
+	.uleb128 0x7
+	.string	"i"
+	.value	0x105
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x7cc
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x107
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x7de
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x107
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x7f0
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x107
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x802
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x108
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x814
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x108
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x826
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x108
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x838
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x109
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x84a
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x109
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x85c
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x109
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x86e
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x10a
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x880
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x10a
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x892
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x10a
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x8a4
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x10b
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x8b6
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x10b
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x8c8
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x10b
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x8da
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x10c
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x8ec
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x10c
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x8fe
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x10c
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1502
+	.value	0x10d
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xa9
+	.long	0x91d
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1507
+	.byte	0xf5
+	.byte	0x9
+	.long	0xa9
+	.long	0xa27
+	.uleb128 0x4
+	.string	"v"
+	.byte	0xf5
+	.byte	0x26
+	.long	0x394
+	.uleb128 0xc
+	.string	"p"
+	.byte	0xf7
+	.byte	0xd
+	.long	0xa27
+	.uleb128 0x1
+	.long	0x94d
+	.uleb128 0xc
+	.string	"i"
+	.byte	0xf8
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x95e
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfa
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x96f
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfa
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x980
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfa
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x991
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfb
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9a2
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfb
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9b3
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfb
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9c4
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfc
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9d5
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfc
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9e6
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfc
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0x9f7
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfd
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xa08
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfd
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xa19
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfd
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xfe
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xa9
+	.long	0xa37
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1508
+	.byte	0xea
+	.byte	0x9
+	.long	0xa9
+	.long	0xadb
+	.uleb128 0x4
+	.string	"v"
+	.byte	0xea
+	.byte	0x26
+	.long	0x394
+	.uleb128 0xc
+	.string	"p"
+	.byte	0xec
+	.byte	0xd
+	.long	0xadb
+	.uleb128 0x1
+	.long	0xa67
+	.uleb128 0xc
+	.string	"i"
+	.byte	0xed
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xa78
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xef
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xa89
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xef
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xa9a
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xef
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xaab
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xf0
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xabc
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xf0
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xacd
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xf0
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xf1
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xa9
+	.long	0xaeb
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1509
+	.byte	0xe1
+	.byte	0x9
+	.long	0xa9
+	.long	0xb4b
+	.uleb128 0x4
+	.string	"v"
+	.byte	0xe1
+	.byte	0x26
+	.long	0x394
+	.uleb128 0xc
+	.string	"p"
+	.byte	0xe3
+	.byte	0xd
+	.long	0xb4b
+	.uleb128 0x1
+	.long	0xb1b
+	.uleb128 0xc
+	.string	"i"
+	.byte	0xe4
+	.byte	0xf
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xb2c
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xe6
+	.byte	0x24
+	.long	0xa9
+	.byte	0
+	.uleb128 0x1
+	.long	0xb3d
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xe6
+	.byte	0x78
+	.long	0xa9
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x3
+	.long	.LASF1502
+	.byte	0xe6
+	.byte	0xcc
+	.long	0xa9
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xa9
+	.long	0xb5b
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1511
+	.byte	0xcb
+	.long	0xb90
+	.uleb128 0x4
+	.string	"v"
+	.byte	0xcb
+	.byte	0x20
+	.long	0xb90
+	.uleb128 0xa
+	.long	.LASF1512
+	.byte	0xcb
+	.byte	0x30
+	.long	0xb95
+	.uleb128 0x3
+	.long	.LASF1513
+	.byte	0xcd
+	.byte	0x16
+	.long	0x167
+	.uleb128 0x3
+	.long	.LASF1514
+	.byte	0xcf
+	.byte	0xb
+	.long	0xb9a
+	.byte	0
+	.uleb128 0x10
+	.long	0x167
+	.uleb128 0x10
+	.long	0x1ff
+	.uleb128 0xf
+	.long	0xde
+	.long	0xbb0
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1515
+	.byte	0xae
+	.long	0xc3f
+	.uleb128 0xa
+	.long	.LASF1512
+	.byte	0xae
+	.byte	0x27
+	.long	0xb95
+	.uleb128 0xa
+	.long	.LASF1514
+	.byte	0xae
+	.byte	0x34
+	.long	0xc3f
+	.uleb128 0x3
+	.long	.LASF1516
+	.byte	0xb0
+	.byte	0xb
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1517
+	.byte	0xb0
+	.byte	0x11
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1518
+	.byte	0xb0
+	.byte	0x17
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1519
+	.byte	0xb0
+	.byte	0x1d
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1520
+	.byte	0xb0
+	.byte	0x23
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1521
+	.byte	0xb0
+	.byte	0x29
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1522
+	.byte	0xb1
+	.byte	0xb
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1523
+	.byte	0xb1
+	.byte	0x15
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1524
+	.byte	0xb1
+	.byte	0x1f
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1525
+	.byte	0xb1
+	.byte	0x29
+	.long	0xde
+	.byte	0
+	.uleb128 0x10
+	.long	0x191
+	.uleb128 0x14
+	.long	.LASF1526
+	.byte	0xa2
+	.long	0xc70
+	.uleb128 0x4
+	.string	"src"
+	.byte	0xa2
+	.byte	0x23
+	.long	0xb90
+	.uleb128 0xa
+	.long	.LASF1497
+	.byte	0xa2
+	.byte	0x3a
+	.long	0xb90
+	.uleb128 0x3
+	.long	.LASF1490
+	.byte	0xa4
+	.byte	0xb
+	.long	0xde
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1527
+	.byte	0x9b
+	.byte	0x5
+	.long	0x7c
+	.long	0xcc7
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x9b
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0xa
+	.long	.LASF1528
+	.byte	0x9b
+	.byte	0x1b
+	.long	0x7c
+	.uleb128 0xa
+	.long	.LASF1529
+	.byte	0x9b
+	.byte	0x27
+	.long	0x7c
+	.uleb128 0xa
+	.long	.LASF1530
+	.byte	0x9b
+	.byte	0x33
+	.long	0x7c
+	.uleb128 0xa
+	.long	.LASF1531
+	.byte	0x9b
+	.byte	0x40
+	.long	0x7c
+	.uleb128 0xc
+	.string	"a"
+	.byte	0x9c
+	.byte	0xe
+	.long	0x8f
+	.uleb128 0xc
+	.string	"b"
+	.byte	0x9d
+	.byte	0xe
+	.long	0x8f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1532
+	.byte	0x96
+	.byte	0x7
+	.long	0xde
+	.long	0xce2
+	.uleb128 0xa
+	.long	.LASF1533
+	.byte	0x96
+	.byte	0x20
+	.long	0x9d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1534
+	.byte	0x91
+	.byte	0x7
+	.long	0xde
+	.long	0xcfd
+	.uleb128 0x4
+	.string	"dev"
+	.byte	0x91
+	.byte	0x25
+	.long	0xcfd
+	.byte	0
+	.uleb128 0x10
+	.long	0x15b
+	.uleb128 0x9
+	.long	.LASF1535
+	.byte	0x8c
+	.byte	0x7
+	.long	0xde
+	.long	0xd1d
+	.uleb128 0x4
+	.string	"dev"
+	.byte	0x8c
+	.byte	0x1c
+	.long	0xcfd
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1536
+	.byte	0x7e
+	.long	0xd3c
+	.uleb128 0x4
+	.string	"dev"
+	.byte	0x7e
+	.byte	0x17
+	.long	0xcfd
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x7e
+	.byte	0x22
+	.long	0xde
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1537
+	.byte	0x79
+	.long	0xd52
+	.uleb128 0x4
+	.string	"dev"
+	.byte	0x79
+	.byte	0x18
+	.long	0xcfd
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1538
+	.byte	0x6d
+	.byte	0x9
+	.long	0xa9
+	.long	0xd78
+	.uleb128 0xa
+	.long	.LASF1539
+	.byte	0x6d
+	.byte	0x1f
+	.long	0xa9
+	.uleb128 0xa
+	.long	.LASF1540
+	.byte	0x6d
+	.byte	0x2e
+	.long	0xa9
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1541
+	.byte	0x66
+	.byte	0x7
+	.long	0xde
+	.long	0xdb6
+	.uleb128 0xa
+	.long	.LASF1542
+	.byte	0x66
+	.byte	0x14
+	.long	0xde
+	.uleb128 0x4
+	.string	"exp"
+	.byte	0x66
+	.byte	0x1e
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF1543
+	.byte	0x67
+	.byte	0xb
+	.long	0xde
+	.uleb128 0x8
+	.uleb128 0x3
+	.long	.LASF1500
+	.byte	0x68
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1544
+	.byte	0x5b
+	.byte	0x7
+	.long	0xde
+	.long	0xde4
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x5b
+	.byte	0x19
+	.long	0xde
+	.uleb128 0xc
+	.string	"xa"
+	.byte	0x5d
+	.byte	0xb
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1543
+	.byte	0x5e
+	.byte	0xb
+	.long	0xde
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1545
+	.byte	0x40
+	.byte	0x7
+	.long	0xde
+	.long	0xe27
+	.uleb128 0x4
+	.string	"y"
+	.byte	0x40
+	.byte	0x1a
+	.long	0xde
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x40
+	.byte	0x23
+	.long	0xde
+	.uleb128 0xc
+	.string	"res"
+	.byte	0x4a
+	.byte	0xb
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1546
+	.byte	0x4a
+	.byte	0x10
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1547
+	.byte	0x4a
+	.byte	0x16
+	.long	0xde
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1548
+	.byte	0x37
+	.byte	0x7
+	.long	0xde
+	.long	0xe40
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x37
+	.byte	0x18
+	.long	0xde
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1549
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x7
+	.long	0xde
+	.uleb128 0x4
+	.string	"x"
+	.byte	0x2b
+	.byte	0x18
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF1550
+	.byte	0x2d
+	.byte	0xd
+	.long	0xa9
+	.uleb128 0xc
+	.string	"x2"
+	.byte	0x33
+	.byte	0xb
+	.long	0xde
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x9
+	.file 10 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF555
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF573
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF596
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF656
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF660
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF661
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF757
+	.byte	0x4
+	.file 23 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1146
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF555
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1186
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1452
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF476
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF479
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF492
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF493
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF540
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF554
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF572
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF653
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF756
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1029
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1030
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1032
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1034
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1088
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1090
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1096
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1098
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1100
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1102
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1106
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1108
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1110
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1112
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1114
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1116
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1122
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1124
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1126
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1128
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1132
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1138
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1145
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1167
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1185
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1188
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1193
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1213
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1214
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1216
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1213
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1214
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1216
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1214
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1216
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1226
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1214
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1216
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1226
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1214
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1216
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1226
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1214
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1216
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1226
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1214
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1216
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1226
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1214
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1215
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1216
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1217
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1235
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1236
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1237
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1238
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1253
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1255
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1262
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1264
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1266
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1267
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1268
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1270
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1271
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1273
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1274
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1275
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1276
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1296
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1300
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1420
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1436
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1
+	.long	.LASF1553
+	.long	.LASF1554
+	.long	.LASF1555
+	.long	.LASF1556
+	.long	.LASF1557
+	.long	.LASF1558
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x22
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1559
+	.byte	0x2
+	.long	.LASF1560
+	.byte	0x2
+	.long	.LASF1561
+	.byte	0x2
+	.long	.LASF1562
+	.byte	0x1
+	.long	.LASF1563
+	.byte	0x1
+	.long	.LASF1564
+	.byte	0x1
+	.long	.LASF1565
+	.byte	0x2
+	.long	.LASF1566
+	.byte	0x5
+	.long	.LASF1567
+	.byte	0x6
+	.long	.LASF1567
+	.byte	0x5
+	.long	.LASF1568
+	.byte	0x2
+	.long	.LASF1569
+	.byte	0x5
+	.long	.LASF1570
+	.byte	0x5
+	.long	.LASF1571
+	.byte	0x2
+	.long	.LASF1572
+	.byte	0x2
+	.long	.LASF1573
+	.byte	0x4
+	.long	.LASF1574
+	.byte	0x2
+	.long	.LASF1575
+	.byte	0x3
+	.long	.LASF1576
+	.byte	0x3
+	.long	.LASF1577
+	.byte	0x2
+	.long	.LASF1578
+	.byte	0x2
+	.long	.LASF1579
+	.byte	0x2
+	.long	.LASF1580
+	.byte	0x5
+	.long	.LASF1581
+	.byte	0x2
+	.long	.LASF1582
+	.byte	0x2
+	.long	.LASF1583
+	.byte	0x2
+	.long	.LASF1584
+	.byte	0x2
+	.long	.LASF1585
+	.byte	0x2
+	.long	.LASF1586
+	.byte	0x2
+	.long	.LASF1587
+	.byte	0x2
+	.long	.LASF1588
+	.byte	0x2
+	.long	.LASF1589
+	.byte	0x2
+	.long	.LASF1590
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1120:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF791:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1295:
+	.string	"MATH_ERREXCEPT 2"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1024:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1116:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1503:
+	.string	"quickMedianFilter7f"
+.LASF1400:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF495:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF900:
+	.string	"__DECL_SIMD_sinh "
+.LASF457:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1197:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF1323:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF522:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF828:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF603:
+	.string	"__SQUAD_TYPE long int"
+.LASF1456:
+	.string	"long unsigned int"
+.LASF481:
+	.string	"__USE_MISC 1"
+.LASF964:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF944:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF801:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF904:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF546:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1367:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF844:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1005:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1475:
+	.string	"m_newM"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1458:
+	.string	"__uint8_t"
+.LASF657:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1477:
+	.string	"m_newS"
+.LASF1089:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1064:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1374:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF926:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF759:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF557:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1199:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF968:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF499:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF896:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1047:
+	.string	"__DECL_SIMD_exp"
+.LASF539:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1501:
+	.string	"quickMedianFilter9f"
+.LASF1304:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF486:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1373:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF983:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1252:
+	.string	"_Marg_ long double"
+.LASF865:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1454:
+	.string	"short unsigned int"
+.LASF897:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF805:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1440:
+	.string	"sinPolyCoef9 0"
+.LASF971:
+	.string	"__DECL_SIMD_acoshf "
+.LASF776:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1336:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF949:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF902:
+	.string	"__DECL_SIMD_sinhl "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF764:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF520:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF789:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1469:
+	.string	"uint16_t"
+.LASF802:
+	.string	"__DECL_SIMD_expl "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF653:
+	.string	"__FD_SETSIZE 1024"
+.LASF611:
+	.string	"__STD_TYPE typedef"
+.LASF1082:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1125:
+	.string	"__DECL_SIMD_tanhf"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF501:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1053:
+	.string	"__DECL_SIMD_powf"
+.LASF783:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF922:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1091:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1451:
+	.string	"QMF_SORTF(a,b) { if ((a)>(b)) QMF_SWAPF((a),(b)); }"
+.LASF1490:
+	.string	"length"
+.LASF1290:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF758:
+	.string	"_MATH_H 1"
+.LASF1273:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF434:
+	.string	"_ISOC95_SOURCE"
+.LASF1445:
+	.string	"atanPolyCoef5 0.05030176425872175f"
+.LASF691:
+	.string	"INT_FAST8_MAX (127)"
+.LASF600:
+	.string	"__U32_TYPE unsigned int"
+.LASF772:
+	.string	"__DECL_SIMD_sinl "
+.LASF1313:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF615:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF822:
+	.string	"__DECL_SIMD_acosl "
+.LASF421:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1355:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1377:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1299:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF412:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF718:
+	.string	"UINT8_C(c) c"
+.LASF793:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1428:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF668:
+	.string	"INT16_MAX (32767)"
+.LASF558:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF620:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1163:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1406:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1379:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF849:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1253:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF792:
+	.string	"__DECL_SIMD_logl "
+.LASF1360:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF649:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1298:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF518:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1137:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1123:
+	.string	"__DECL_SIMD_tanh"
+.LASF1029:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1513:
+	.string	"v_tmp"
+.LASF924:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF766:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF800:
+	.string	"__DECL_SIMD_exp "
+.LASF1010:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1135:
+	.string	"__DECL_SIMD_tan"
+.LASF875:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF892:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1214:
+	.string	"_Mdouble_"
+.LASF1467:
+	.string	"int32_t"
+.LASF1358:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1141:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1370:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF1071:
+	.string	"__DECL_SIMD_exp2"
+.LASF1511:
+	.string	"rotateV"
+.LASF1352:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF1424:
+	.string	"FAST_MATH "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1050:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1380:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF984:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1088:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF588:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF403:
+	.string	"__USE_ISOC11"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1062:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF727:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF568:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF735:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1055:
+	.string	"__DECL_SIMD_acos"
+.LASF927:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1527:
+	.string	"scaleRange"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF541:
+	.string	"__always_inline"
+.LASF866:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF985:
+	.string	"__DECL_SIMD_erff64 "
+.LASF476:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF898:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF751:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1192:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF665:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1438:
+	.string	"sinPolyCoef5 8.312366210e-3f"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1215:
+	.string	"__MATH_PRECNAME"
+.LASF935:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF658:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1075:
+	.string	"__DECL_SIMD_exp10"
+.LASF1099:
+	.string	"__DECL_SIMD_log10"
+.LASF1225:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1083:
+	.string	"__DECL_SIMD_expm1"
+.LASF867:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1068:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1218:
+	.string	"_Mdouble_ float"
+.LASF1517:
+	.string	"sinx"
+.LASF1519:
+	.string	"siny"
+.LASF1521:
+	.string	"sinz"
+.LASF1346:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF687:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1185:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1035:
+	.string	"__DECL_SIMD_sin"
+.LASF630:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1202:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1385:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF524:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF606:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1208:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1478:
+	.string	"stdev_t"
+.LASF777:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF972:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1279:
+	.string	"__MATHCALL_NARROW"
+.LASF514:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF470:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1256:
+	.string	"_Mret_ _Float32"
+.LASF1200:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1107:
+	.string	"__DECL_SIMD_log1p"
+.LASF575:
+	.string	"__stub_chflags "
+.LASF1236:
+	.string	"__MATHDECL_1"
+.LASF1108:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1092:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1228:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF981:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF714:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1172:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF579:
+	.string	"__stub_setlogin "
+.LASF1151:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1085:
+	.string	"__DECL_SIMD_expm1f"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1497:
+	.string	"dest"
+.LASF1485:
+	.string	"angles"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF581:
+	.string	"__stub_stty "
+.LASF1515:
+	.string	"buildRotationMatrix"
+.LASF1442:
+	.string	"atanPolyCoef2 0.99997356613987f"
+.LASF1105:
+	.string	"__DECL_SIMD_log2f"
+.LASF953:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF745:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF848:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF860:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF716:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF878:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1291:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF423:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF989:
+	.string	"__DECL_SIMD_erff128x "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1143:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF553:
+	.string	"__attribute_copy__"
+.LASF1329:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF1354:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF1288:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF485:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF583:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF664:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1073:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1498:
+	.string	"array1"
+.LASF1499:
+	.string	"array2"
+.LASF1034:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF534:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF885:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF961:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1128:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF463:
+	.string	"__USE_POSIX2 1"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF819:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1534:
+	.string	"devStandardDeviation"
+.LASF1269:
+	.string	"_Mret_ _Float64"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF677:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1396:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF1482:
+	.string	"roll"
+.LASF1307:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1487:
+	.string	"crc8_dvb_s2"
+.LASF1391:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF696:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1459:
+	.string	"__int16_t"
+.LASF713:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1461:
+	.string	"__uint16_t"
+.LASF1166:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1533:
+	.string	"degrees"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF886:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF853:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF364:
+	.string	"__k8 1"
+.LASF1432:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF462:
+	.string	"__USE_POSIX 1"
+.LASF407:
+	.string	"__USE_POSIX"
+.LASF1444:
+	.string	"atanPolyCoef4 0.3099814292351353f"
+.LASF931:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF856:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1309:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF565:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF825:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF694:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1270:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1305:
+	.string	"M_E 2.7182818284590452354"
+.LASF1093:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF995:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1308:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1422:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF788:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF584:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1100:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF857:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF551:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1293:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1263:
+	.string	"_Marg_ _Float128"
+.LASF1162:
+	.string	"__f32x(x) x ##f32x"
+.LASF874:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1196:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1316:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1241:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF678:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1453:
+	.string	"unsigned char"
+.LASF661:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1266:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1248:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF688:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF948:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF566:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1177:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF692:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1130:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1044:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF725:
+	.string	"UINT8_WIDTH 8"
+.LASF614:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1175:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF1471:
+	.string	"float"
+.LASF1386:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF405:
+	.string	"__USE_ISOC95"
+.LASF404:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF715:
+	.string	"INT16_C(c) c"
+.LASF1446:
+	.string	"atanPolyCoef6 0.1471039133652469f"
+.LASF1238:
+	.string	"__MATHDECL"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF982:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1347:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF660:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF843:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF562:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1522:
+	.string	"coszcosx"
+.LASF414:
+	.string	"__USE_XOPEN2K"
+.LASF1032:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1512:
+	.string	"delta"
+.LASF410:
+	.string	"__USE_POSIX199506"
+.LASF876:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1110:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF1397:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF939:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1418:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF908:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF452:
+	.string	"_DEFAULT_SOURCE"
+.LASF1345:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF683:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1014:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1535:
+	.string	"devVariance"
+.LASF540:
+	.string	"__wur "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF503:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF833:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1294:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1508:
+	.string	"quickMedianFilter5"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1507:
+	.string	"quickMedianFilter7"
+.LASF1506:
+	.string	"quickMedianFilter9"
+.LASF1340:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF1222:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1272:
+	.string	"_Mret_ _Float64x"
+.LASF1287:
+	.string	"FP_NORMAL 4"
+.LASF453:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1536:
+	.string	"devPush"
+.LASF622:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1245:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1210:
+	.string	"_Mdouble_ double"
+.LASF1371:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF855:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF497:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1337:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF500:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF662:
+	.string	"__intptr_t_defined "
+.LASF670:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF681:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF556:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF552:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF962:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF513:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF604:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1390:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF954:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1157:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1013:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF417:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF859:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1232:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF698:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1369:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF483:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF1152:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1209:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF480:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1212:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF646:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF451:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF913:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1492:
+	.string	"crc16_ccitt"
+.LASF1548:
+	.string	"cos_approx"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF564:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1539:
+	.string	"value"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF769:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF720:
+	.string	"UINT32_C(c) c ## U"
+.LASF932:
+	.string	"__DECL_SIMD_log10l "
+.LASF424:
+	.string	"__USE_GNU"
+.LASF1414:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF674:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1335:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1524:
+	.string	"coszsinx"
+.LASF809:
+	.string	"__DECL_SIMD_expf128x "
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1154:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF717:
+	.string	"INT64_C(c) c ## L"
+.LASF760:
+	.string	"__DECL_SIMD_cos "
+.LASF1031:
+	.string	"__DECL_SIMD_cos"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1393:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1106:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF610:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1025:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF654:
+	.string	"_BITS_TIME64_H 1"
+.LASF1441:
+	.string	"atanPolyCoef1 3.14551665884836e-07f"
+.LASF693:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF919:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF634:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF526:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF938:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF841:
+	.string	"__DECL_SIMD_asinf "
+.LASF419:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF542:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1126:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF598:
+	.string	"__U16_TYPE unsigned short int"
+.LASF537:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1242:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1213:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1226:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1079:
+	.string	"__DECL_SIMD_cosh"
+.LASF571:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF527:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF808:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF965:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF799:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1078:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF761:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF430:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1124:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1149:
+	.string	"__HAVE_FLOAT64 1"
+.LASF794:
+	.string	"__DECL_SIMD_logf32 "
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1315:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1312:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1552:
+	.string	"sqrtf"
+.LASF636:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1468:
+	.string	"uint8_t"
+.LASF1398:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF991:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1545:
+	.string	"atan2_approx"
+.LASF576:
+	.string	"__stub_fchflags "
+.LASF1178:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF602:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1423:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF1235:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1216:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF732:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF1448:
+	.string	"QMF_SORT(a,b) { if ((a)>(b)) QMF_SWAP((a),(b)); }"
+.LASF411:
+	.string	"__USE_XOPEN"
+.LASF826:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1359:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1114:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1338:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1132:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF433:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1018:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1000:
+	.string	"__DECL_SIMD_asinh "
+.LASF1399:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1425:
+	.string	"VERY_FAST_MATH "
+.LASF1268:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF1387:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF569:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF554:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF887:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1028:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF710:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF561:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1319:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF827:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1284:
+	.string	"FP_INFINITE 1"
+.LASF1274:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF770:
+	.string	"__DECL_SIMD_sin "
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF460:
+	.string	"__USE_ISOC99 1"
+.LASF1038:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1048:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF1131:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1488:
+	.string	"crc16_ccitt_update"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1145:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF560:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1054:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF1289:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1136:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF813:
+	.string	"__DECL_SIMD_powf16 "
+.LASF473:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF746:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1170:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1473:
+	.string	"fix12_t"
+.LASF1388:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF1217:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1230:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF396:
+	.string	"__REVISION__ \"7b45b89\""
+.LASF967:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1081:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF708:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF437:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1244:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF863:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF757:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1007:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1537:
+	.string	"devClear"
+.LASF723:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF413:
+	.string	"__USE_UNIX98"
+.LASF798:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1194:
+	.string	"FP_INT_UPWARD 0"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1219:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF506:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF577:
+	.string	"__stub_gtty "
+.LASF916:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF648:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF671:
+	.string	"UINT8_MAX (255)"
+.LASF1146:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1180:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1404:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF675:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF650:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1523:
+	.string	"sinzcosx"
+.LASF917:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF721:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1098:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1144:
+	.string	"__f128(x) x ##f128"
+.LASF1546:
+	.string	"absX"
+.LASF1221:
+	.string	"_Mdouble_ long double"
+.LASF773:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF676:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF743:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1040:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF484:
+	.string	"__USE_GNU 1"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1260:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1505:
+	.string	"quickMedianFilter3f"
+.LASF925:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1056:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF842:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1021:
+	.string	"__DECL_SIMD_tanf "
+.LASF488:
+	.string	"__GNU_LIBRARY__"
+.LASF474:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF482:
+	.string	"__USE_ATFILE 1"
+.LASF914:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1348:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF1436:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1257:
+	.string	"_Marg_ _Float32x"
+.LASF762:
+	.string	"__DECL_SIMD_cosl "
+.LASF880:
+	.string	"__DECL_SIMD_cosh "
+.LASF685:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF441:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1181:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1204:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1220:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1439:
+	.string	"sinPolyCoef7 -1.849218155e-4f"
+.LASF1479:
+	.string	"stdev_s"
+.LASF1483:
+	.string	"pitch"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF627:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1183:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1405:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF494:
+	.string	"__PMT"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF1382:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF729:
+	.string	"UINT32_WIDTH 32"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF988:
+	.string	"__DECL_SIMD_erff64x "
+.LASF734:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF941:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1356:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF496:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF722:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1366:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF990:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF790:
+	.string	"__DECL_SIMD_log "
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1142:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1525:
+	.string	"sinzsinx"
+.LASF966:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1103:
+	.string	"__DECL_SIMD_log2"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF547:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1365:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF1301:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF449:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1118:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1361:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF601:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1203:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF702:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF490:
+	.string	"__GLIBC__ 2"
+.LASF930:
+	.string	"__DECL_SIMD_log10 "
+.LASF689:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF839:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF669:
+	.string	"INT32_MAX (2147483647)"
+.LASF1045:
+	.string	"__DECL_SIMD_logf"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1058:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF838:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1551:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF504:
+	.string	"__P(args) args"
+.LASF1158:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF778:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF679:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF626:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF756:
+	.string	"WINT_WIDTH 32"
+.LASF1229:
+	.string	"_Mdouble_ _Float128"
+.LASF767:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1339:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1009:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1384:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1543:
+	.string	"result"
+.LASF956:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF973:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1101:
+	.string	"__DECL_SIMD_log10f"
+.LASF425:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1403:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF637:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF667:
+	.string	"INT8_MAX (127)"
+.LASF952:
+	.string	"__DECL_SIMD_log1pl "
+.LASF834:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF416:
+	.string	"__USE_XOPEN2K8"
+.LASF709:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF879:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF784:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF638:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF957:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1278:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1231:
+	.string	"_Mdouble_ _Float32x"
+.LASF1417:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF479:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF418:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF901:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1186:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF846:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF814:
+	.string	"__DECL_SIMD_powf32 "
+.LASF511:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF945:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF830:
+	.string	"__DECL_SIMD_atan "
+.LASF464:
+	.string	"__USE_POSIX199309 1"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1237:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1095:
+	.string	"__DECL_SIMD_atan2"
+.LASF695:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF864:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF438:
+	.string	"_ISOC11_SOURCE"
+.LASF1402:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF510:
+	.string	"__END_DECLS "
+.LASF1246:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF847:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1251:
+	.string	"__MATHCALL_NAME"
+.LASF950:
+	.string	"__DECL_SIMD_log1p "
+.LASF1022:
+	.string	"__DECL_SIMD_tanl "
+.LASF877:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF623:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1466:
+	.string	"int16_t"
+.LASF976:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1111:
+	.string	"__DECL_SIMD_atanh"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1349:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF1094:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1457:
+	.string	"signed char"
+.LASF1159:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF795:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1502:
+	.string	"temp"
+.LASF894:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF466:
+	.string	"__USE_XOPEN2K 1"
+.LASF1281:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF899:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1174:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1129:
+	.string	"__DECL_SIMD_asinhf"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF530:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1109:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF448:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF974:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1421:
+	.string	"sq(x) ((x)*(x))"
+.LASF774:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF703:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF574:
+	.string	"__stub___compat_bdflush "
+.LASF1500:
+	.string	"count"
+.LASF1076:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1550:
+	.string	"xint"
+.LASF1060:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF402:
+	.string	"_FEATURES_H 1"
+.LASF1161:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF548:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1184:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF532:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1376:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF478:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1411:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF942:
+	.string	"__DECL_SIMD_log2l "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF573:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1043:
+	.string	"__DECL_SIMD_log"
+.LASF624:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1470:
+	.string	"uint32_t"
+.LASF1150:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1059:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1223:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1452:
+	.string	"QMF_SWAPF(a,b) { float temp=(a);(a)=(b);(b)=temp; }"
+.LASF447:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1250:
+	.string	"_Marg_"
+.LASF616:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1003:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF786:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1495:
+	.string	"input"
+.LASF1049:
+	.string	"__DECL_SIMD_expf"
+.LASF918:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF748:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1311:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1514:
+	.string	"matrix"
+.LASF1176:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF563:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF690:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1264:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF787:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF946:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF440:
+	.string	"_ISOC2X_SOURCE"
+.LASF1160:
+	.string	"__f32(x) x ##f32"
+.LASF618:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1285:
+	.string	"FP_ZERO 2"
+.LASF617:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF803:
+	.string	"__DECL_SIMD_expf16 "
+.LASF893:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF567:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF701:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF508:
+	.string	"__ptr_t void *"
+.LASF1063:
+	.string	"__DECL_SIMD_asin"
+.LASF436:
+	.string	"_ISOC99_SOURCE"
+.LASF947:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF607:
+	.string	"__SLONG32_TYPE int"
+.LASF1084:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF673:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1171:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1198:
+	.string	"FP_INT_TONEAREST 4"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF406:
+	.string	"__USE_ISOCXX11"
+.LASF1464:
+	.string	"long int"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1067:
+	.string	"__DECL_SIMD_hypot"
+.LASF1037:
+	.string	"__DECL_SIMD_sinf"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF432:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1437:
+	.string	"sinPolyCoef3 -1.666568107e-1f"
+.LASF663:
+	.string	"INT8_MIN (-128)"
+.LASF979:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF906:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF521:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1538:
+	.string	"applyDeadband"
+.LASF955:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF744:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF505:
+	.string	"__PMT(args) args"
+.LASF393:
+	.string	"SITL 1"
+.LASF1353:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF680:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF731:
+	.string	"UINT64_WIDTH 64"
+.LASF907:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1205:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF640:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF736:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF493:
+	.string	"_SYS_CDEFS_H 1"
+.LASF910:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1211:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF740:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF645:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1039:
+	.string	"__DECL_SIMD_sincos"
+.LASF1112:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1122:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1164:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1314:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF940:
+	.string	"__DECL_SIMD_log2 "
+.LASF1187:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF728:
+	.string	"INT32_WIDTH 32"
+.LASF628:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF644:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF928:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF959:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1516:
+	.string	"cosx"
+.LASF1518:
+	.string	"cosy"
+.LASF1520:
+	.string	"cosz"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1408:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1165:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1240:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF969:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1429:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1351:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF998:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF523:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1330:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF517:
+	.string	"__flexarr []"
+.LASF1167:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF431:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF810:
+	.string	"__DECL_SIMD_pow "
+.LASF596:
+	.string	"_BITS_TYPES_H 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF684:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1297:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF741:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1310:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1201:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF519:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF587:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF459:
+	.string	"__USE_ISOC11 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1395:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF779:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1364:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF1443:
+	.string	"atanPolyCoef3 0.14744007058297684f"
+.LASF752:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1486:
+	.string	"fp_angles_t"
+.LASF599:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF469:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1530:
+	.string	"destMin"
+.LASF737:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1066:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1243:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF936:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF619:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF580:
+	.string	"__stub_sigreturn "
+.LASF996:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1153:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1392:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF747:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF933:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF597:
+	.string	"__S16_TYPE short int"
+.LASF850:
+	.string	"__DECL_SIMD_hypot "
+.LASF1188:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF641:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1410:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF890:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1271:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF536:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF765:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF937:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF829:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF659:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1193:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF1541:
+	.string	"powerf"
+.LASF1061:
+	.string	"__DECL_SIMD_atanf"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF821:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF631:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1341:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF807:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1004:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF656:
+	.string	"__STD_TYPE"
+.LASF1069:
+	.string	"__DECL_SIMD_hypotf"
+.LASF642:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF608:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1148:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF816:
+	.string	"__DECL_SIMD_powf128 "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF909:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1080:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1419:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1086:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1016:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF845:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1449:
+	.string	"QMF_SWAP(a,b) { int32_t temp=(a);(a)=(b);(b)=temp; }"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1001:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF977:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF666:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF529:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1102:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1333:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF711:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF559:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1070:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1017:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF871:
+	.string	"__DECL_SIMD_exp10f "
+.LASF804:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1249:
+	.string	"_Mret_"
+.LASF544:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF700:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1169:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF835:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1027:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF475:
+	.string	"__USE_LARGEFILE 1"
+.LASF970:
+	.string	"__DECL_SIMD_acosh "
+.LASF1134:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1026:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF585:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1394:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1332:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF450:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1280:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF492:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1412:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1191:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1283:
+	.string	"FP_NAN 0"
+.LASF570:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF572:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1156:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1510:
+	.string	"arraySubInt32"
+.LASF883:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF980:
+	.string	"__DECL_SIMD_erf "
+.LASF1493:
+	.string	"qConstruct"
+.LASF1072:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1363:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF1544:
+	.string	"acos_approx"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF435:
+	.string	"_ISOC95_SOURCE 1"
+.LASF796:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1117:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1320:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF545:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1015:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1096:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF512:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1042:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1389:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1195:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF820:
+	.string	"__DECL_SIMD_acos "
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1182:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF471:
+	.string	"_LARGEFILE_SOURCE"
+.LASF915:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF797:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1104:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF420:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1261:
+	.string	"_Marg_ _Float64x"
+.LASF1409:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1052:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1472:
+	.string	"double"
+.LASF446:
+	.string	"_XOPEN_SOURCE"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF823:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF920:
+	.string	"__DECL_SIMD_atan2 "
+.LASF629:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1362:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF1057:
+	.string	"__DECL_SIMD_acosf"
+.LASF1115:
+	.string	"__DECL_SIMD_acosh"
+.LASF1239:
+	.string	"__MATHCALL"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF993:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF639:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF455:
+	.string	"_ATFILE_SOURCE 1"
+.LASF997:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF868:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF682:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1433:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF531:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1306:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1462:
+	.string	"__int32_t"
+.LASF1189:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1292:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1463:
+	.string	"__uint32_t"
+.LASF1480:
+	.string	"fp_vector"
+.LASF831:
+	.string	"__DECL_SIMD_atanf "
+.LASF1431:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1008:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF408:
+	.string	"__USE_POSIX2"
+.LASF1489:
+	.string	"data"
+.LASF1173:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF905:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1435:
+	.string	"Q12 (1 << 12)"
+.LASF1407:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1447:
+	.string	"atanPolyCoef7 0.6444640676891548f"
+.LASF1179:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF1121:
+	.string	"__DECL_SIMD_erff"
+.LASF1494:
+	.string	"qMultiply"
+.LASF1258:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1415:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF605:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF415:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1074:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF697:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1206:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF958:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF811:
+	.string	"__DECL_SIMD_powf "
+.LASF1303:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF817:
+	.string	"__DECL_SIMD_powf32x "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF738:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF672:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF647:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF655:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1542:
+	.string	"base"
+.LASF840:
+	.string	"__DECL_SIMD_asin "
+.LASF726:
+	.string	"INT16_WIDTH 16"
+.LASF612:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1030:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1302:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF934:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1002:
+	.string	"__DECL_SIMD_asinhl "
+.LASF651:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF719:
+	.string	"UINT16_C(c) c"
+.LASF882:
+	.string	"__DECL_SIMD_coshl "
+.LASF705:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1413:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1300:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF730:
+	.string	"INT64_WIDTH 64"
+.LASF987:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF960:
+	.string	"__DECL_SIMD_atanh "
+.LASF1357:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF409:
+	.string	"__USE_POSIX199309"
+.LASF707:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF872:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1531:
+	.string	"destMax"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1427:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1138:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1065:
+	.string	"__DECL_SIMD_asinf"
+.LASF1127:
+	.string	"__DECL_SIMD_asinh"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1087:
+	.string	"__DECL_SIMD_sinh"
+.LASF889:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF851:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF1090:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF785:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF836:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1262:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF1286:
+	.string	"FP_SUBNORMAL 3"
+.LASF1155:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1233:
+	.string	"_Mdouble_ _Float64x"
+.LASF458:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1325:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1113:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF929:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF652:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF472:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF815:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1328:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF1481:
+	.string	"fp_angles"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF781:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1140:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1509:
+	.string	"quickMedianFilter3"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF837:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF739:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF509:
+	.string	"__BEGIN_DECLS "
+.LASF861:
+	.string	"__DECL_SIMD_exp2f "
+.LASF549:
+	.string	"__restrict_arr __restrict"
+.LASF1465:
+	.string	"char"
+.LASF399:
+	.string	"_STDINT_H 1"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1168:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1139:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF465:
+	.string	"__USE_POSIX199506 1"
+.LASF978:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1224:
+	.string	"_Mdouble_ _Float32"
+.LASF578:
+	.string	"__stub_revoke "
+.LASF1133:
+	.string	"__DECL_SIMD_erfcf"
+.LASF550:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF951:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1334:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1036:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1430:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF467:
+	.string	"__USE_XOPEN2K8 1"
+.LASF516:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF888:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF895:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1491:
+	.string	"pend"
+.LASF498:
+	.string	"__LEAF , __leaf__"
+.LASF999:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF870:
+	.string	"__DECL_SIMD_exp10 "
+.LASF477:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF750:
+	.string	"INTMAX_WIDTH 64"
+.LASF884:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF858:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1496:
+	.string	"qPercent"
+.LASF1416:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF975:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF775:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1318:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF1420:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF749:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1474:
+	.string	"m_oldM"
+.LASF742:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1023:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1476:
+	.string	"m_oldS"
+.LASF487:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1549:
+	.string	"sin_approx"
+.LASF1401:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF818:
+	.string	"__DECL_SIMD_powf64x "
+.LASF768:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1532:
+	.string	"degreesToRadians"
+.LASF525:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1077:
+	.string	"__DECL_SIMD_exp10f"
+.LASF832:
+	.string	"__DECL_SIMD_atanl "
+.LASF1259:
+	.string	"_Marg_ _Float64"
+.LASF1011:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF704:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1247:
+	.string	"_Marg_ double"
+.LASF753:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF1254:
+	.string	"_Mret_ double"
+.LASF439:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF963:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF943:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF643:
+	.string	"__TIMER_T_TYPE void *"
+.LASF986:
+	.string	"__DECL_SIMD_erff128 "
+.LASF869:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF903:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF824:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1321:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1326:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1267:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1375:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF911:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF812:
+	.string	"__DECL_SIMD_powl "
+.LASF489:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF633:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF712:
+	.string	"WINT_MIN (0u)"
+.LASF456:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1350:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF994:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1227:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1342:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1434:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1234:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1526:
+	.string	"normalizeV"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF543:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF891:
+	.string	"__DECL_SIMD_expm1f "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1528:
+	.string	"srcMin"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF533:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF755:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF422:
+	.string	"__USE_ATFILE"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1317:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1368:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF380:
+	.string	"__unix 1"
+.LASF555:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF852:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF763:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF535:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1033:
+	.string	"__DECL_SIMD_cosf"
+.LASF699:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF427:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF706:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1119:
+	.string	"__DECL_SIMD_erf"
+.LASF635:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1343:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF754:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1372:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF782:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1255:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF632:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF733:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1547:
+	.string	"absY"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1324:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF1460:
+	.string	"short int"
+.LASF881:
+	.string	"__DECL_SIMD_coshf "
+.LASF625:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF862:
+	.string	"__DECL_SIMD_exp2l "
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1327:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1207:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1322:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1097:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1051:
+	.string	"__DECL_SIMD_pow"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF621:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF515:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF507:
+	.string	"__STRING(x) #x"
+.LASF1265:
+	.string	"_Mret_ _Float32x"
+.LASF1426:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF468:
+	.string	"__USE_XOPEN 1"
+.LASF1381:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF1020:
+	.string	"__DECL_SIMD_tan "
+.LASF1455:
+	.string	"unsigned int"
+.LASF854:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1484:
+	.string	"fp_angles_def"
+.LASF1019:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1282:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF528:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF538:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF921:
+	.string	"__DECL_SIMD_atan2f "
+.LASF780:
+	.string	"__DECL_SIMD_sincos "
+.LASF992:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1504:
+	.string	"quickMedianFilter5f"
+.LASF613:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF491:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1331:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF873:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1540:
+	.string	"deadband"
+.LASF771:
+	.string	"__DECL_SIMD_sinf "
+.LASF1046:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF923:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF806:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF502:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1450:
+	.string	"QMF_COPY(p,v,n) { int32_t i; for (i=0; i<n; i++) p[i]=v[i]; }"
+.LASF1344:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF29:
+	.string	"_LP64 1"
+.LASF609:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1190:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1012:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1529:
+	.string	"srcMax"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF454:
+	.string	"_ATFILE_SOURCE"
+.LASF724:
+	.string	"INT8_WIDTH 8"
+.LASF1041:
+	.string	"__DECL_SIMD_sincosf"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1147:
+	.string	"__HAVE_FLOAT16 0"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1296:
+	.string	"math_errhandling 0"
+.LASF586:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF461:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1006:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1383:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF582:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1378:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF912:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1574:
+	.string	"long-double.h"
+.LASF1576:
+	.string	"stubs-64.h"
+.LASF1557:
+	.string	"/usr/include"
+.LASF1560:
+	.string	"stdint-intn.h"
+.LASF1568:
+	.string	"libc-header-start.h"
+.LASF1584:
+	.string	"floatn-common.h"
+.LASF1555:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1579:
+	.string	"wchar.h"
+.LASF1572:
+	.string	"timesize.h"
+.LASF1561:
+	.string	"stdint-uintn.h"
+.LASF1563:
+	.string	"maths.c"
+.LASF1556:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1558:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1562:
+	.string	"maths.h"
+.LASF1569:
+	.string	"features.h"
+.LASF0:
+	.string	"./src/main/common/maths.c"
+.LASF1580:
+	.string	"math.h"
+.LASF1586:
+	.string	"fp-logb.h"
+.LASF1554:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1565:
+	.string	"mathcalls.h"
+.LASF1589:
+	.string	"mathcalls-narrow.h"
+.LASF1577:
+	.string	"typesizes.h"
+.LASF1575:
+	.string	"stubs.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1587:
+	.string	"fp-fast.h"
+.LASF1570:
+	.string	"features-time64.h"
+.LASF1578:
+	.string	"time64.h"
+.LASF1585:
+	.string	"flt-eval-method.h"
+.LASF1573:
+	.string	"cdefs.h"
+.LASF1588:
+	.string	"mathcalls-helper-functions.h"
+.LASF1582:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1581:
+	.string	"math-vector.h"
+.LASF1583:
+	.string	"floatn.h"
+.LASF1571:
+	.string	"wordsize.h"
+.LASF1564:
+	.string	"axis.h"
+.LASF1553:
+	.string	"src/main/common"
+.LASF1590:
+	.string	"iscanonical.h"
+.LASF1566:
+	.string	"stdc-predef.h"
+.LASF1567:
+	.string	"stdint.h"
+.LASF1559:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\345\005\r\013"
+	.string	"d\020\331\006"
+	.string	" "
+	.string	"\341\333\245\345\002"
+	.string	"\001\237\247\223\212\n"
+	.string	"\002\337\352\303g"
+	.string	"\003\203\270\227\357\001"
+	.string	"\004\264\245\347\210\r"
+	.string	"\005\346\353\250\236\002"
+	.string	"\006\347\231\311\265\t"
+	.string	"\007\340\206\333\235\t"
+	.string	"\b\352\222\314\276\016\002\002"
+	.string	"\002\001\t\223\242\326\261\005\026\002\n\326\331\347\361\r\004\013\350\355\231\037\f\231\274\327\315\004"
+	.string	"\r\250\237\214\355\r"
+	.string	"\016\244\330\372\372\n\f\002\002\002\003\017\360\232\325\316\b\030\002\004\002\002\005\020\257\324\327\335\f \006\003\006\002\006\021\356\322\327\356\017\034\002\007\002\007\002"
+	.string	"\002\b\b\002\b\022\242\333\255\257\0038\t\t\002\t\023\333\332\376\205\007d\n\n\002\n\024\234\341\340\262\001\220\001\013\013\002\013\025\005\002\005\026\f\002\f\027\r\r\002\r\030\016\016\002\016\031\244\246\246\251\f\006\032\275\305\343\240\f"
+	.string	"\033\354\261\352\343\013"
+	.string	"\034\364\207\213\233\001"
+	.string	"\035\334\206\377\260\007"
+	.string	"\036\260\240\374\337\017\002\002\017\002\017\037\276\307\307\\"
+	.string	""
+	.string	"% @\002nfH\341$\270\276E\211Q\2078\300J\220n\350\341\b\260f\364c\200r\013l"
+	.string	"X\224\321\370"
+	.string	"\223\007"
+	.ascii	"\f`\315H\342\251\356t\327u\2272}\326bNL\340v>f\214\273\201\215"
+	.ascii	"7\367\rV\331\355\341\221\3704\321\021\256\237$\261;\037g\212"
+	.ascii	"oO\341\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\303"
+	.string	"\035\006"
+	.string	"\242G\027\034\220+\035\377\377\217\357\356\356\356.v]\327u]7K\301v\355\223M\bI)\245\024\223\330\021\310\303u4x\306B\221@\230\007\323`\026\036gK\024\226\315\252\370\215G\377\t\033\231T<:?w\340E\340\324\005\314\240\342k}\312\247\266Z\002\350\020\265\r\323-\356\335\272\364&c%3 \340\002\"c\035\310b\033\"\330\315l\033\263\265X\332\200\341\300\"\203\031\342qe01\306p\001'd\310O`\227\f#\202I4\366n\203uD\261#\211\255\231\253\307\340\026P8\020\215bo\b,\020E\333\207b\206\306bW\034\004\034\200\305\227=\226\203\024\241"
+	.ascii	"C\031\231\r\317\270H\003^\\\250!"
+	.text
+	.section	.gnu.lto_.inline.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`T\nM#"
+	.string	"\266s\245F\320VM:\210\202`\007\b+jV\264\373pW0\317\210OOD\200UQ-\223DL\"c\215\353%\341\0322Vaf\266\242s\023\003x\355^\025R\360\r`;\\\310\265\206|}+\207B\332\274\262\177\313$S\217"
+	.string	"\216"
+	.string	"\215"
+	.ascii	"\267\335M\245\215\364Q\362\020!\005\311\332\377\260\313s\300"
+	.ascii	"\335m\240\263F\036!\032\232\322b\365\315O\032\332\234F\307\242"
+	.ascii	"\332\356\236\3662\302\3110\267\201\271\207\325!\250}\313\b\247"
+	.ascii	"\356\027|\253Lo\020\r1\245|\3702\374n\363\tR\272c\367\272\243"
+	.ascii	"\347\370\251\013'9n\320\236a\207\335\335\261Oi{\365\334@#W\277"
+	.ascii	"\220\022N\253c\360\2123v&6\237 \224\363>\354\273\273'[\347;+"
+	.ascii	"jL\bn\253\316I\254\2501\315\330\236[\036\004~\314\251A\307\f"
+	.ascii	"\216\262\237(J\352\211\216\335\313\361{\364\374\210s Q\224Z\344"
+	.ascii	";\277\263K5W\255zn\260\202\264\3526\231\253\nRu\r>Ygo\002$J\022"
+	.ascii	"\032\243X\354\357y;a\032}\363\343\233\037\027\310A\347\034\336"
+	.ascii	");\024\026;\3470i?\261d3\212\267\255zf\326\226lF,>\301h"
+	.string	"\210c\331Y\3203UQ\224\004b\345\225\b\rq\026\230\366\021\273;\t\354u\206)K\036\035\350n!\241\225\366\037EI\"<\303\033\3272\030?B\270\226\035iwe\374oL\001\330\261Eq.\227\347\345\215T\224UG_\370\004\025\361\017\003hyv\026\273<\234\273\216\213_\"\331\335A\331\037\217\246\354\362\324\252c\227\207\345\027\016\226\275\034,\340\f;|Zm\270\342\234=\306\356\266\330\005\306Xc_\316\307\b\212\233\213[h\fc\237\342c\311\214\347@\303\316\207\235\017q`_\361\343\013\2035\005\321PS\312)\373\320\207\337A\230\260\375\250cB\311\315\365\243\037\003\266m\216%\340\351\034BH@\234\rpi\256\202*\r\301!\244\025\340I\363\374\235\025T\311\020\034BV.@\323\027BH@\035\264=\303\242\251\221\020\022\220\213\t\310~S\026-.?@&\005<\331\r\301z.\355\206xq"
+	.ascii	"\032\235Q\226\312Px\217\246&*\271\204\302\217\232\232\250XJM"
+	.ascii	"\214*\331\335\254\351\223 -\030\030UJ\364L\320\271\214*%z\030"
+	.ascii	"\304\254l\357\330]\006\264\023\331\335\026\247Jw\337\363{\352"
+	.ascii	"\315\236)\320\3566\21055\035\214\235\347\312=\275\254e\235\271"
+	.ascii	"M\005\200\331\250\361H\245\030\222\022IR\232R\007\200\002\231"
+	.ascii	"\221\242\252\007\022 41\207\362\220B\312\220\310\004$\222\202"
+	.ascii	"$\205R\373\006\250\235C\236FkDY\023d\323\311\001\310\006\b\366"
+	.ascii	"%*\224\352\022\026W]\341\271D\b\215\324a\236\264a\327=\363\252"
+	.ascii	"\201G\376\351+\017\261a\250\240\306\332\213H\267\346!\034\346"
+	.ascii	"sB\363A\221n\022H6\335&v\264\303.G\013\347\335T\022U \022\250"
+	.ascii	"$\233\250D\3429\364 \026\311\343\232\334\327\250}\025\313N\n"
+	.ascii	"B\245\330\277\253\315\037\330\ns\311\337\344\nx\316\3551\007"
+	.ascii	"\255\336z\203U\314\251\366\\\274\234F\3649\335\254T\246dV\200"
+	.ascii	"U?z\261\315\343\243\0021\367>\202\317\202\0212\254{\207)\244"
+	.ascii	"\355i\021{\235\004\0031\"\025\307X\342\016\2618\247\016\224]"
+	.ascii	"\347 \23680\215\3440\235e\353\253\341\206\306b\216P\261\361\032"
+	.ascii	"V\177`\204\260`\t.\200L(\177\375\300\242\256\367\300-\333!\371"
+	.ascii	"\363\221\n\207Ej\030\220`\340J}\t\325B\355;\003\312\315\212\366"
+	.ascii	"\233\034\263\211m\020\003\036MQ\253\373\355\314\227\360\333\026"
+	.ascii	"\033\316@\376\321\377\256\027\235 \213\001\335k\321\006*|\213"
+	.ascii	"nZ2K\266\206Z\006A\016\375/\366\232ox\237n\316\027\351\f\330"
+	.ascii	"\2511\315\355>\306\201\034\363\306\360`\344\311\217\346\316\\"
+	.ascii	"\331\264\002\037vB\220|4\200bB~\024\375\242OS\353x$7$\375\223"
+	.ascii	"*\006\244\347\221\205\227\255\007x\311\372{\366\271abt\257\237"
+	.ascii	"\220\3308\202\235<\024\370)\265\347JN\357?\f\307\304 \357z\374"
+	.ascii	"M{d\356\204{\313J\025\365\321\341\007\271!9\332g\275\346\037"
+	.ascii	"\373=\325D\205Q\275s1"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"\315\007"
+	.string	"\342\213&,\200)I\007+\t\310\030\266*\00230\317\004\252\274\035dB8\n\0230\211"
+	.string	"\376\267\326\332\326\366[\243\005\202}d[k\233\310\264\003&\261\022\005\b\033i\370U\202\304>\020 \026:\200\330\2105\210$N\303^\371\277\b\344!1\202\n\236\306\351\023\346'\f\267\007~\357\216+\266\361\\\013{\016\305*\032\201\3036\225\227\001H\2401M}\300b\007\230q\317\372Q\354\243|\215\303,\213]g\025OH\\XLf\214\230&\b\006\007\325#\037\366a\035\317\027\253\336\026l\212+ \220\002*+\333h\243\357E\030\3322&\246\300\b.\026\342\017\366\020\016zYC2\256d\260\206\356\003\244h\310{mD,X\260K\203\2712W"
+	.ascii	"\254+\262\306F\350v\235E\020G\242\031\214q\2612\277\366\306\302"
+	.ascii	"\302\246\253\254\0260\353w\330\305\306\200b\272Hw\250\006+\346"
+	.ascii	"\020"
+	.text
+	.section	.gnu.lto_.pureconst.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375 e\275\002"
+	.string	"R\306\024\037pk\322\001\374\337\373\036\252\375\377\273\252\252\252\332\201D\372\377\377\377\377\177333ki\315\356Sr#\0232\037\3231\033\037\343.\256\342&.\342\036\256\341\026.\341\033|\202/0\001\263\272\324\235>\351\213&4\237\351\314_\315\213\231\313\025\233\230\031%"
+	.text
+	.section	.gnu.lto_.ipa_modref.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\\\001U\006"
+	.string	"\242H\033#\220\265\031\016\377\217M\204\375\243\356T\373\377\277fTW_\273m~\336\376\367Z\353u\324\354\377rkR\246\377\317_\234\342\226(y:\253\002\030S\223\262P$\020\313a\207\346\033\246"
+	.string	"/\"\375~?V\327Wz\034\206\371x\243d-@$\374Oq\0340\242\233\267\366\274\257vUpk\214\346\234)g\224jb"
+	.ascii	"\272\352\244;\027\022, \340\202\031\252\036>\n\020\335d\303\340"
+	.ascii	"h\226\026\364 \"|\276\031C\313\351\213\2469.\203\207/-\023\247"
+	.ascii	"\001\261\213}yd\207\2660sKS\026\262\271\357K\373v\r\022\007\352"
+	.ascii	"k)\2173\006!\212@\nwq\t\267T\323\304;\346\021\363\026\202$\304"
+	.ascii	"\004\323\315\222V87"
+	.text
+	.section	.gnu.lto_.lto.a133c6431122e434,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sin_approx.2.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`1\001-\016"
+	.string	"&\033aE\360\222(\035B\253\033\2378\371\007\330\337\354`{?\305\366\004"
+	.string	"0\225]\333\352\017w\364\235\365@\034\246\033\350\r\r\265s\266\2210\361\353\271,\236\031\027E\273^\302\322\031\367TH\347\360\013\337\032\331[\312\224\002L"
+	.string	"O"
+	.string	"L"
+	.ascii	"\235G\333>\314WxvL\302\206\017\207\032+/~\354\356&:H{\204'\240"
+	.ascii	"=\252\b\317S\357P\323\363\001\260T\207\035\227+D\320\262\341"
+	.ascii	"\"\200\265\202 \034 z\374{\266"
+	.string	"\260R29!\273\353day\270\343mG\260-b\277\025\360\256[5\235\232\276'\300\f\320\216\335\0163 K\023e\2308\354\366]x~\314?\177B\262\017\246\001\256\214\210\212\033!\235\307\020\315\310~\314\3131\2702?\201\202G\315\356\216\036\r!\004c\364|\213\273\034\263g\227F\212\030\273\233\300\007\002\034\205\252\272\203\02165\372\372\211\226J\362\315\244\244\215E?\321\256\251Wi\255r\246\251c%\b\210\205\246\207]\204\2227\216\252\351}\250\314\240\344\314\377>\001&\307\346\215\375R\245\206\220\221\220\225\260\276\330Os\016\273\265\273\376\370t(SI\n.H\245)p\n\270\006$\f\036\220\006\244n\216db\0015R\332L]\251\324q\233\251d\244\264q'\223\215T\300\335\205\n\247\r\325u\247\355\263\327\027\216\376\373\350C:f;\r@CM]A\230QU[l-\243\332\0302hg\t\030"
+	.ascii	"re1C\023N\341\240\323VP[\013\263W\2456\306\260'\303\354\031\313"
+	.ascii	"\206M{@Y\333P\215\270\320\251\020l\327\231\002{\213\312\374("
+	.ascii	"\342'\225\301\250\266\005PxZ\332\243\201\251="
+	.text
+	.section	.gnu.lto_cos_approx.3.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\033\002\365\021"
+	.string	"F\342vG\340\322&\035\"\211\304\350\006z\363\262t\301\026\265\326\335\355\253q\300\\\262\356\202TE\002\224\303\362\363\342\327\226\f\362\231\227k\244\347\371@g\300\345a(\307aq\250h\304\233b\r\270x\232\013j\300\023K\366\3362\245`"
+	.string	"c"
+	.string	"]"
+	.string	"6\361\224\\\017\364\037\323,\262\013\343\004\213\335M\340\003\334\247m\277\347>\240MK\321\320\341\350\250!\372\261\273\237\367\221\355S\236\300\366\031G\034\274\214\n\372\007:\t\214f\323\232\271\314y\224\btd\344"
+	.string	"h\255\344\210\321\207\033\237]oZ,\325\322\311\356ZmZ\034\356y\333\020l\243\330\032\006\027\t \242"
+	.ascii	"lwC\222\220\255M\027%.\373\355\373D\217\371\262\317\334\031\004"
+	.ascii	"Uw\3710\223O\367\371\362X\002\366\006G\207i\305K\225\362\035"
+	.ascii	"\244\030H\237>\221\312\017\372\220\273O\323\213!\241\frc((f\234"
+	.ascii	"p\237\246Z\211\375 \325U\230&7\366\035\036\033H\273[\362\351"
+	.ascii	"\007\334\347}\027hw\016"
+	.string	"+BE,\005b\3571\333\214[\274\2143\352Q\315\220\221\0242^v/\224\3618h\212BM\362g\217\320C\003\366\t&j<\376u/\244]V\343\243\266V\326nH\242\361\361G4:+Mr\347a5\210\355Zi\fa_n\004a_\315]]\222\352M\252\347e\267\374\317\257W\0070-,2r\201\214\232\302I\301\251\301\n\003\007&\003d\356\223\311\213\005\030\025\324\327\222B\241R\247\257\205E\005\365\235\\^>\023\003N]\250\340\362\301\244R._\027^\306R\374\354\022H\344P\323l+\t\027ols\321\013\343\312\276\354\257\037\350\334\016\036\265P\226\364\321\217\275`\330nS\2122\316h\213\036F\035\242\3531\333\026\003) p\242\t\230\335rY\3646\001\274z\310>\3242\377a\226\264\201\004<\026K\272\202P\231\b\214\346mC\332j\321\2230I\030b^g\035.\\\013\347E(\n"
+	.ascii	"\020\250\334\306&\334\020\257>\206G\270\234m\343&\021cn\321\277"
+	.ascii	"\245\337]\353\026\034?>\037GQ\006pb\365\372)\305\203\002"
+	.text
+	.section	.gnu.lto_atan2_approx.4.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\214\005E\036"
+	.string	"Ft\267J\240\326Q:\n\026Q\304\031\207)\003\\p-h\004sH\256\325\313\356\310\032`\323\243\307;\306!\200N\334\322\236S\320,\327#JR^'Oa|\220\026\255\001\233\361\213\333\271\342\367\325\276\375\323\376\262\256\366I#\204\310\235R\242"
+	.string	"\217"
+	.string	"\246"
+	.ascii	"^"
+	.string	"\362\320\334\371\261\3710\001)\251\265\276\2344\203]\226\022\215\005\346\311\035\223\227\323'yhW\255<^\334\250\265\032p\001\363\244m\037\306c\350\330\303Q\311\b\305\177p\350q\272\252\265\366x\257\225'\307\323\312\223{\342:\177\271\314VI\216Ku\374\226\314\330\002HH\007\340\316_@w\001\t\b\376\220\240\246\200!\020#\336\032\tP\2310\362\252\237\021\243.\310G\210\036Z\2128y\302\200\033\350\370\002\206\370\306\200\277\221Wk\375\323\251\017\220\207\322\226L\255\325\264\003\020\304\r\273\355\240\355\0076\351\0130j\373\245\226\255Q\241\013\332\276\351<\037\3052\313\322\366\304\363\312G\213.YP!RU\245X\266\322\016\335\"\373c\255\265z\211\354\235.\207\273\331\276t\327\236\364\267\274\351\246]\351g\231\255\310.\274c\247V9u\312\251a\247~\235\332uj\363\324\255S\227\247&O=\236zOMO}"
+	.ascii	"e\024\025nX\353\207bV\235\"q\250\370\322\337\364\013\277\266"
+	.ascii	"\216\317t\247?\031\346\262AX\302\301\317\213\335\344!\317\350"
+	.ascii	"F\003\363\244K\211\027\007\253\340\blS6\006\n\024\220\320ka\333"
+	.ascii	"s:\203\210\240\004y-\f\361\f\032%!2\245\343g\256k/\325Zs\003"
+	.ascii	"H\235\301b\0218\226\333Z\027+r\313uq:\203\"\240\f\325\254q\311"
+	.ascii	"\3159\235A\261\335\035\027G<\203\353\341\203\242\256\246\242"
+	.ascii	"\354\222R\347\221\207\267\361\263!T\315\240X\274\372\325\352"
+	.ascii	"\033\020[\272\343\2213\370\247\277\204P\261\225\361\215\267\275"
+	.ascii	"-%\236Q\265%\255\316&<\264\350\005C\225b\235\326Zwv\213<\264"
+	.ascii	"M\007\330\226\206\251\310\217>1\025\312\260\355\205\347\371h"
+	.ascii	"k\333\3278\235\360\0049\023p\026B\204\034\232\2311\303-\241\346"
+	.ascii	"@M\002\032\004103\rw\rL\016\005\f36=\01376675=\013\025flz589"
+	.ascii	"=\030\235o.L\300\351a\270\271\301\351\301\224\352\307\272DI\256"
+	.ascii	"\335z4Wv6\333\030!\337\362\364\230\275v\273%\276\035\256\247"
+	.ascii	"\273\216\220R\264t"
+	.string	"\353\261\224\355J\313\216\025S'\033uK\201\264\234\304\252CYQ\t\265\266\310\037\202\024D\346V\002\222\207\021\267\262\365a!\312\312\034nF\217\223\251\334.\361<\272\2359\252\310-r\206\025Q\350\215V \331\333\306\326\3076\r\223\217\0348\225u-.\212\376RV%|\250AT\305\230a\246F$\005i\n\313\030\340\002\021\251\352\034\021\340@(Y\3154\311\032!0\311\202:%\237c\311\fs\274\220\001\246\335\200\270\223V\021t\333\271\032\001\317\226~XFC_,\0321\311\221e1\352.\304\031\362\033\236\254\"\022\357\rS\327\371\036CMW'\373^6\272EkC\272\026+\220\216;\2211\257#\207aNY\303\252\242Y\3153\037\030\0252\001\234#-\367* \313:\210\032\336~\356J\3766\007\264@\023\030.o\264\203\240,{\300a\321r\342Dh \016>\376:\323\007l\222\355\355\361U"
+	.ascii	"5\240\372O\360d\\\351H{\376j\316\341Y\013r5iH1\021K\305\303*"
+	.ascii	"\205\f\030#Q\026\213H\335\306o6\340\251\n\025w\353\215\351 -"
+	.ascii	"\212&\030\350\263\371\222\030\236{C\204\032"
+	.text
+	.section	.gnu.lto_acos_approx.5.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`A\002\315\022"
+	.string	"&\344}H\320\322(\035\230`\013O\371'y]\ri\001\212\020\241|\275\214"
+	.string	"D)\2622\004$\346\276\267A@\275\310\261\366\237Vrzm\004\244\212\272\301\025^p\274\241\233\034\257\200w\342\376\203\005S\314\314X\276\265F\310\2262\245h"
+	.string	"`"
+	.string	"m"
+	.string	"A9?\346\234$\367,!\225#\271>\307:\233\346\344\271\2611\347l`\006\245{\266}\234\303x\331:i\253a\361 \034\227\034\321\2343T\335\300wO\276\300woW\374u\271\372\362a\227\257\241\330y\241\301|\345\002 \025>"
+	.ascii	"\320D)\022\323\003s\334uF\223\251\222L\346\234\326\027\332\210"
+	.ascii	"\333\273m\013\266+\330Z\023>\356'\035\243\035S\215l\033L\227"
+	.ascii	"\306\276\234;c_\035r\333\215\372\355\006\237\363\237\2566]]\272"
+	.ascii	"\232t\365w\265w\265\274z"
+	.string	"\257\326\253\037\200D\002(\305c\316\020\273\243\371\343\341pq\333\177\273\332/_\306q\006S5n\326\251D\001s&\213Q\243P\272\227\342!\261m\326\225`\"\016\214\001\245\325E\355}f\214=H[\332\317g\214\371\226\264\244\234\216\023)\346\221\267\337\"\b2\326\300\225\353m\002\241\321\246\304\354\303O\221\270+7\225c\214\261\356&^\200\230\260\333\r\315\200\273\253\200\306h#\365kw\360\360\375EW%.\314\340Zw\2538gl\344\253BcM\246;\253N\020p\177\273*\246F>-\270\367\031\211b\272\013'-\312\242\201\303J\212\353\363\205\225\203\025\004\224\007\021J\006\264\334\253\222\025\f,'\254P\245\305b\265V\241J\206\023V\270r\255\204%\"nmHq\205,\255\226+\004m\363r\356\214/s\323BQ{\334\tl\310\232vf\333\2646\211\255L\242\326e\350G\212!\353\345P;\264\337"
+	.ascii	"\002$\263Kc\235m\0359-\n\256G\324\"\253\316\016\265\267\005)"
+	.ascii	" \220\202\221\200\3156\262e\231\243=u\245\315{\256\320\323X\315"
+	.ascii	"\032l8~\263H\347\361 \332\342\341\302[\326\303<\266\f\257\002"
+	.ascii	"^\336(\025b\257\346\224\205tD\300\231\233V\321_\337\226\257\273"
+	.ascii	"\232\027@\352\030\311h\317\206L\311\310N\031\333\033o\312'J\241"
+	.ascii	"t_\001\3468\255\221\347bP"
+	.text
+	.section	.gnu.lto_powerf.6.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\377\001\335\021"
+	.string	"\366\340tG\340\320(\035\"\0027Rg\270\007B\277\204b\354\377W[=g\f\\2\246C\260\335\303D\241ww\302?l\335D\"l\357v5\335\236'a\036r\250?@\334\215`\301BBc\274\241G\310\032\242%mo\271S\n`"
+	.string	"_"
+	.string	"]"
+	.string	"\3079\n\226}\213\261\031\232\373\260H\241\331\330\335\217t\002\241\313\370\001\241K\005\341.\227\313\335x\214\335\021\262.\243B\226?{\274\201\341Qy\265.cw\302\"\"\300\353$z"
+	.ascii	"\375\350\274v\270\3622\201\261\346\345\372\332\023\300\330T^"
+	.ascii	"/\207\035\310\356\032\252\274\\\356\320mg\260M\301\206\035\001"
+	.ascii	"\206\227\335\347\2304\202V\034\250\261\313\222\013\332\027Rg"
+	.ascii	"\304i\277\354\320\376h\306\363U\3705\213F!h\336\231\255\226i"
+	.ascii	"\233\365L\230\227\267Y\376\314\242\021\214g\313|\233\255\226"
+	.ascii	"\002(>\267\237\335Upi\t#\027\017\306\274\003\313\001\231\227"
+	.ascii	"\243\024\357\3609\276\231c\267\207\246\305\356.0\202y\031\n5"
+	.ascii	"\202\213\r\020(\007[U\020\027\304=\356\356\306I\3528\324\251"
+	.ascii	"G\351P\002"
+	.string	"\326\221\\\332ih\006\n\t\023\230\363S\300\026\342Tm<'/u\307O;\204\327\036m`[\243z\331\037\304\270 \316\320\346\001\306B\234\035kA\225\261\3571\003\364c\375`\317N>\366\307\347\374z\332\003\253\221\022TI\2560\224\250L\251\020\211\006\223\272B\211A\311\201H\203\017O\200I\025\"\022]\362T\026V!\247o\004u:\241J\337\310\205\220\323WJ\251>\317\200Q$\246\324\267B\241R\237(\266\217\361*\245~\304\270\324\304\237\035\200\315F\252\214E't\252\306\200+\257]t\203\303A;\375\354S\206\211\033p\305\266c, `\002\231\262\365\rY\300[s-<ZZ2A\251]J\032\341\332P\007oz\330\271\263\360o\327\205i\254\236\366\265\\\006aI\241\264C8\004\2148A8`\320\330`gh\227\2314\315U6\023\304n\237\026\322 \017\022\"\220-\276\3715\nxd\034"
+	.ascii	"\311\310\226}&\337Ta\261\032\357M\244s\231'"
+	.text
+	.section	.gnu.lto_applyDeadband.7.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"=\f"
+	.string	"\266VRA0o\223\016@\214"
+	.string	"\274I\301\345 |*\bU\033\271\275\201\203\336?X\214q\314\007\357\372h\033\032\3475\276\357\220\340\2657\"\021\006\2061\224\303(\235\030:U%\256^\251\365@\204\220\275\245L)>"
+	.string	"?"
+	.string	"="
+	.ascii	"\223\210"
+	.string	"\022\r#)\273\0331'0\035\276\017\230\016u\304\267?\315\315\2476\317\304\007\024\021\007\372\253<\\\003p\036\017\263\273/=A\270\217Lj\263\273N\021\327\341\206\267\355\300\366\003\373\r\002\357\243_?\2723\323\247(\223\223\002(\273\034Vf\354\013\330\242\204}\025\035\266\305\276\304(u&\f\252\303\313It\236\364\321f\215\335\020$\026\273\213\300\006\252C\333\376\211\243\350\360\366:\022\\!\365\360K\007@R\222\233P\252\274\007\363\251\252m\341\302t\021T\250\240T\025\361\323+g\205\213\217\224a\325\353\033\311\220\022\312\025'\t\t\306\246\212\335\201RE\354\277\325\020\033\276\373\003\230\307\342`V\007\253\214]\t\256\005\034\005\232\214\200\016\005\tV\005\350+\263\001\201\303\312\242G\3132\355\212\236\bV\026\257\317F\314\\\254M\350|\"\207\246}\242\245\333\277\325\020\250\030Rl\310\003O\005\261\235\252\001\021\030"
+	.ascii	"\226\311\022\243=&\262\006\211\226Al\302\360\204\300\0350\246"
+	.ascii	"\250f\201\210\251AT3\341\271\206\023M\020\312\304\223p$\b\007"
+	.ascii	"2\003C\f5\274\3709\216QC\0165y\273J\031"
+	.text
+	.section	.gnu.lto_devClear.8.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\255\b"
+	.string	"\306P>9@\345\2501"
+	.string	"\254\241;,ye\365\031\367\350\214\025\356\236\276U\311%\266kSXrA\204c\364\330c\314\204\3758\n\244\027\036\364!L69;\326S(H\332\336R\246\024*"
+	.string	"."
+	.string	","
+	.string	"\004\032s\005\333\030\207\260\333\204\226q2\373?e\207AG\260\366\210\003Z\256\225\343\306\341\177c\313\265\341J\267=h\333\320V%1;n\233\331\213\201\313\257Q\013p\031\307\362\321\326\235\366\203\002rl\035b\021\3201\225=\377\013d\345\017AE\340\230k\350\002\2159\216\003\030Mp[\341\222\266p\376\213j\022\213\013\001\230\207\271Z\24517"
+	.string	"\223a\305Zc\312\f\314#\2006\\E\311\321z\373\377\312W\353%u\n\235\bb\201!\344\241(\221d\273\020*\"5\362\246\351\363\274\257\233&\211\2217\273\023j\206>\375&J\247\231\372\276\323\354\204\367v\371\352\003M\306\222\001\t"
+	.ascii	"\204\231e\246=\245\254\005\226O\031\213\3432\364\267\032\r\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_devPush.9.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\013\003\225\023"
+	.string	"f\"xG\300\224Q:hbcBl\302\223\335\311y\030^\033\263T\332\232\255\024"
+	.string	"\356\022\235\275\322\0260A\255\374\374\240\217\330\231.\227\351'\370\214\242\250\202H\266)\360->,\256\r\240\324\343h\200Q\317l\311'{K\231R`"
+	.string	"Z"
+	.string	"h"
+	.string	"\253\247}\025_\001\273\255\346%\273:?C\273\267\225\017|\217\276\335\304{\374\016\300{4\314\366\361[\317\036w\344\202\220\220\335e)\317a\217P\023\346\037w\323\214f\363\230sx\242\345\\!\202\032\016\016)\032\01649\032\321\343\270'\006Z,\263\304\262\273\316\031M\303\355\335\266\003\333,\266\272\002>\266\233\3349s4\035\233D\354\233M\352\216}\270\252c?\350W\335\366\2472\215\312\364)\323\246L\177\231.e\332\313t\3144\314\264j:5}\001'\024G\003v\273\031vE\326(\306\370\261}\224}\002\264\312\333Y\300\036d\235M\2734rC\273\2732\203\357\221"
+	.string	"<\341\t\252R\250QHf\202\310:U\024\037\233\207$\nr$\002\352\216\316v\026\260_\207\221\n\300CH\007\t\177\221\312$\225\3323\317Y\207b"
+	.ascii	"\351\003I.\347%f5#\325\235\224\247\272\340\220pr\2103\267!\325"
+	.ascii	"\005I\317g@R~M}\222\254\026\313\235\355\to\341\242owW|!\227\n"
+	.ascii	"\037\211G\277\306{\274\222\004\026\356\227V\202\326\212\213\202"
+	.ascii	"\005*%\024`^\324-\225\231\0074-.V\314\313\345z\265X1\020Z\\\254"
+	.ascii	"\226\314\fK\345\304\257\b02,\232\327K\206\205\272\355\341\252"
+	.ascii	"\216\033\2440\272\321XD\351\215\0235B\240\324v}\306I?E\231\024"
+	.ascii	"\352\t\250\244*5iiG\321\007\242$\303S\325\222\302\034\262ZT\250"
+	.ascii	"\236^f#\246Q=#\262\037\032A\250\221L%\005E\250\206\224\224\323"
+	.ascii	"\244\003\240\002\221\251:\017\021\20055T\023\230SP\343\034\004"
+	.ascii	"\372\323\001\233\270\371Z\026O\244\371\356\364\332K\026\020\374"
+	.ascii	"\222\235\220e \264\232\275n\030\030\240\3328\353\315p\210\213"
+	.ascii	"<\255_\221Y\210\022\\\212\357\321]\027\f\261\333Qd I\226\375"
+	.ascii	"A\322{u6)\242#\244\372\026\244\322\212[D\202\2004$\263\031\345"
+	.ascii	"z\342X\220\207\266\320\2206\335\261 \353\334<\215\n\276\354?"
+	.ascii	"\257o\276\037\034\326@\240\032"
+	.text
+	.section	.gnu.lto_devVariance.10.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\005\001\355\f"
+	.string	"\026\231XC\020\221\223\016p\n#;.\225Y^\333\231\325qa\234\266G\300\333O\272m\"\030"
+	.string	"\231\337\335\370\242\217\337\t\376\354\202T\336\304\350"
+	.string	""
+	.string	""
+	.string	"\005V\210\276"
+	.string	"\022\355\026~\251\302\335\256T\373\304\222\275\245L)H"
+	.string	"@"
+	.string	"G"
+	.ascii	"N\301O\303\312WX\230 \202\306\356f\235\017\260\036\341\003X\217"
+	.ascii	"\232\341\335\241"
+	.string	"f\347_\306\206\031%\257\3440\343\245\\!\307t\"\005\200w\002\r\2500\264x\313\023\305\033eb\030\354\256\263\344U\270\343m7\260\275\300\376H\326\364\365\357\307h:j\032fZ5\235\231>G\006\245\362\274\330\245\260\272\261*b\211\016\366At\266\306\346x\237\347[|\324?t\377H\276\331=\261\220\330\375>\366\\\217\376.\333\276\207\263t\016/$\030\230Z1H\246Q\256l\213>\302\251\324\002O\016%\223JU\305\007~U\027.)N\262\206\355\b\017\341\227kwA\276K\210\204k\345\321'\261\036\257\002X\240Lre\315\205M\033\366W\222\252b\037\256\236\034\366\320\020h \007\t\024`\233\221\017\017\265\206\211\036\210tl\031\b\267m\234\226\201@\350\3302-$\3120\216\271\220\217P&\302q\241L\363\355\365\344L\247l'\201\250(\266\243vLt\004!\324\324K1(H&T\241\306\025"
+	.ascii	"\204\3112y\266Uj\276\242\341OV\214\013\327{\214q4\206@\013\b"
+	.ascii	"\350\016\301\026\016\356Q\370\353\236\2325\\\030\203jl\363+\323"
+	.ascii	"\240\211HJ`\314;5Z\005\005"
+	.text
+	.section	.gnu.lto_devStandardDeviation.11.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\250\001\315\020"
+	.string	"\226`rH\360\262&\035@\202\271\251\373i\320\"PX\274\256\321\241H\264\214v\235\341\303u\3067\026I\231c\333,\312luc\231M\260\030\351\307Gq\033\026\207i\374J2\001\253\310\"\016\354\306LW%5jM\032\331[\312\224\002]"
+	.string	"\\"
+	.string	"a"
+	.string	"s\302\310\2301g\210r\002\356\322!g\333_q\0260{'\206%f\016$\303!'\310\234\323;}\300v\031\037`\273\\\022\207=\256\302\374\327<\2460\261\203\006\252<\226@\227o4\275\340p\001"
+	.string	"\316\"\202\237\021A\257]Y@\231\352\210d\316i\245\201 ny\333\021lC\260\225@QM\212j.\252G\253\336\242ZFu\\\365>\374\265T\262\361\243\240g\316\226\242!\323G\322@\341\337\274\346\272\215\237\2636<\335%\016\211\254\203\004 \231\2419\303\005\227&\020u=\216\353\341k\373@j\331\020b\350\322\277q\331\335avg\027\370\201\272\332\247\271\013\330\303\327E\002\334\216r\254\334\330v\264\222ge(\365\335m7 +/2-\272\360\030\336\221{@O\320^~vc\314\340\273+t\243c\246B\374\232[\207a\036n\3169\342\277\320\200\301\237y\255"
+	.string	"\03741-\362k/\351\264\340\361\234w:*z\350\036\347\247\230\022\271\0231\225\310\016e\2721\366\343\\\030;6Q5P\215Lp\360 %\222\341\304d\255J\265(\244\224\254<\224o\265\372T\036J\205\222\225\247b\265\274\224\311\237\205\023\226\227\362},\257\263\3550\366\205\261.\267\257\275\013\252!\244\336\261\255\006H\313b;\356)\2662\227\224\264\366\352\333N\213{\232\255\312_\363{\240\365\370\304\342h\345\006\036"
+	.string	"\002\223aI8\220\207\002\034>_-4\352\271\\T\373a\325@\364\030\321"
+	.ascii	"\033\204\013\217\277Z\\5+\252K\3543CpM\254\231\025\033h<.BV,"
+	.ascii	"\234\036ApB1p>\252\241\237\214=h7\222\022H\363R\215VA\001"
+	.text
+	.section	.gnu.lto_degreesToRadians.12.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"U\t"
+	.string	"F\322B;@Eg8\240\276\326\3274!"
+	.string	"\\\361+\371\274\317\301B\b\203\375\303b\020\254\205b\"\3048\023\262>{\226\001\273\025\346(\002\353\022:x%\315\330\307[\020/$do)S\n1"
+	.string	"1"
+	.string	"/"
+	.string	"\231\210\242\362\330\312\307\214\200\335\335DG\370\\\313~\360\271\246'\017\237\241\177\231g9)4-W\352\t\262\330]g\3135r\353m3\330\276\260\315\023\351k\004"
+	.string	"v\034\306]\221\221\300\352h7,\266C;d'\340Dd\332\207yLx\261\303\332\356\253\306fw\037\3340p\255 m\373.\177\tmX!\005@^\353\212q\f\340\261\253Z\270\252\236\325\262\312\321\251\327\214\261zT9:D\2629\300\026S\251&\366\263\335]k\211\255i\275\370\247\006.q\020\334\004\206\004\305\310\340\324u`FW\002\231\033\2354P$o3}\236\367q\233i\203\344m\034x\332F\n\3768:pC}\037\270\205\304\275\255*R\351\312\206=\n"
+	.ascii	"@3\241L\2130l\026\002\350\253\253\3015\333\005\023\004\234xR"
+	.ascii	"\255\230\204I\006"
+	.text
+	.section	.gnu.lto_scaleRange.13.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`l\002\275\022"
+	.string	"\026\344{G\340\320(\035\276\223\342\331\016\3621c\344\323u\273%t\241\256d\304\200\225Rr\312"
+	.string	"\215\t\313~\334\316\026nfy\n\267?\356\370\347\f\200\031\030r\250\003\353"
+	.string	"\310\361\024\3101s\304\320\355"
+	.string	"\177,\371d\023)S\nj"
+	.string	"b"
+	.string	"a"
+	.string	"\340O_\312C\217\177<\323\302h\210a@\303\023cA\205\035\025\n\300\307T\314\355\006\001\370X\262S=\257\343\037\223v3\200X\261\273\003,"
+	.ascii	"|\264\355\337\034Gf\377x\267\0163\257\271\261\341h\354nhr\324"
+	.ascii	"\367\350\375\364=*\207\313\2362\377>\217$>\314\220\231yy\216"
+	.ascii	"\022\354\256Sf\206\302\255\267\035"
+	.string	"\300\366\003;\201\002!\347\371M\357\371A4\375\241i\017Mwh\272\3644\207\246I\231\0063=\312\364\227\351\230i/\323\232\351\314\364Knag\002\203\312\305\256\204\235\215}\021Y\204x\356\327=m\231\237\342>.\245F\350\f\344\355\005\323\302\340pl\034\344\250N\034\205\3549\003}k\023H6\\\216\214\335U=\272\301-\264\"\224>\027u\244(\233\021\035i\376\020\235\364\272\233\314\222\310\237\252\236\364C5\021Q=\3754\025$\242QSC!\352\351\250H\257\252\336P\315\206\226;\23345\342@\364\232-l7f\271s\346j\300\330$\262o/\2515\366\275\335]\353\006\373i\222\347n\324w\376\221\353\356\323o\277\310u\376\253\247\334e\345bAi\211\255\250\214\\V.\026\024\026,\366Y\205E\200e \245\300\201\223\020\227\233u\022\203\320\262j\205\256W\253\365b\205.\226U+d\301b\341\t"
+	.string	"\277\"\254\300\302\226\327\013\026\226n{\233DMfJ\363\207\222xh\207~\350k44\017\215A%%i\207\246\020\207\226\364\266\0333\020\345P\017\007*IS\b\245'\0055q\265\022\0011 "
+	.string	"#\032\223\007\373\240\202\273\344\313\"m\273#T\022R\235\020\327.a?\270\365\341+\267p\224\316q\307\266\034\365\306^\013\005\t\357\217]\226\033\345\243L\313\341a\b\205\317\240\251\241\313\3449\257\305\206\233\266\207\214%\226\023R\0220s\347\004\206\021\371\016\033\244\271\231\035\260\221\362\035\0317"
+	.ascii	"Lcj+\031"
+	.text
+	.section	.gnu.lto_normalizeV.14.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\204\002%\022"
+	.string	"\306\342vF\340\264&\035\024/\t\257\233\320\365k\225 nA\256\004\347IQW\324\234&\332\026\203\271\325\366\327W|\343\0340\274\215\337\274x\342\373\020\220a\256\003t\201BgJ\361\212\333\234\374\341\237\006F\261I#{K\231R`"
+	.string	"X"
+	.string	"b"
+	.ascii	"\361\004St|E\017\270\307\224\033+O\3731.\303\365\035\233\243"
+	.ascii	"\354\352\324\200v\277\025'\340\036\375\235\300\366\310]\300\366"
+	.ascii	"h"
+	.string	"\227]\344\037\212=\255\207\003-\311\356zz\342\256CM\227Or)\305d\257\303\020\327\023Y\016<\355\356i\317\0162\234L\222\313\356:c2\020w\274\355\b\266%\330\t$\376^\251&\354\303\335]\253\216\375\357\017\360\331m\372\316\177\222\351.\323&\231.e\232\3134)\323[\246c\246a\2465\323\231\351\017\350^\370P\351\261\353\341H\311\n\305 \025\237\375\366Os\227\362c\305\266?\343<\256\317\374\303\275>\024\200\021\371\030\331]\005\217\206\300=E\316Z\t\223~\366\323M\032\271\224\234\332\252\f\333c&=\345\350\313$\215\312\351\221l\272)IIKX\367\331\324\001\324\324\250\220\bFBU\025j$\242\341=\252*\327k\252\362\200\261\300\311#\333\033^\303?\334\356\266\3704`j\270\024\217\276\315\366x5 d\347&\217\334\215\310\232\210\241M#\0073\255\n42\027\266\026K&\006:\006\265"
+	.string	"\325\002\303\240\001\013\nj\305R\243XX3\255\227\224G\243J\245T(\217\306\302K\312C\255X\036\313\001\2530\310\254\274\226J\265\362\272o\017Wu<\001\206\320\215\342\300Nql\332\2710\321 U\223\026C\253@\024jN\202\244\215\330\021\223^K\2529`;"
+	.ascii	"\324V\344\356\276\364\307v\"\340\024\206gHN\006, \300\002\031"
+	.ascii	"\251\261\003\004\221e\2647[s\327-4\356\n\340\215\020\255\f\315"
+	.ascii	"\365M\200~H\321bh\256\2739\270\220\302U\320&YI`\210\223\035U"
+	.ascii	"%\024\200\334\"\020\333%G\224p\250s\354\001\226\203\030\363t"
+	.ascii	" \217\317\227\030\0335\027M<Xh\032\205\200\312\330\260\r\001"
+	.ascii	"\"\017\004\335\247Q\n\324\330.Z\006"
+	.text
+	.section	.gnu.lto_buildRotationMatrix.15.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`3\021\265>"
+	.string	"\252j\264\026@P\344J\007\243\225I\202\271\232\3234}\031^\325w\203\255\226 \217\276`\313\206\016v\355\375\342\347i\036&@X\221\032t1vA\351\003\314\320KY\001\263\257h\214\001K>\331[\356\235RJ\001f\0016\001]\001j5\006\355"
+	.string	"\307\366\374Z\0163\262\333p\307\3719D$\331y\353\032\n]_\323\224\245\365\376c\321p\370NC\307\021\016B\271\251~,\230\221o\306\270\335t\037#\033m\312\353\343kq\336\272\fV\370\bw\250\2156\371-\231\333\315X\357\335\211\303\2416j\033L\207\3511M\246\357\332L\243\351\274^\323z\214D\302c\343VcOM\2224\3004O\332\254\360L\0262F\2741.\316\312\324!d\301f\347\226\002\210\230&Zpu|\247<\336\313f\013^\b\265\321$)\313\366\322td\375\205\357\324\262\033\001v\034\t$\274\367:5\312\036\324F\225g\003\260HtKwn.s/\360l\340\226c>6\312\026\324F\221\254,\333\231\033Kg!k-0\272\350^#wx\367\312A1\002\265Q\226\353#\333\250\332"
+	.ascii	"l\243L\306,\330rp\267\351\372\316\350\366\334{\227\217\244\311"
+	.ascii	":)\024\204\004:\252\251E\317w2\356\326\353\243\214\265\262N\276"
+	.ascii	"\265\020\220\2647\017\372\321H77\373\341@m}\354\277\033>\030"
+	.ascii	"\333\\%@\204\255G\247g\212M \312\215\036nw4\032c\260\351g\216"
+	.ascii	"\3763\301\233\233\034\3115\346y\004\247\b\236\266\323\256\266"
+	.ascii	"f\346\236Z\335{\331e\254\2615\01753\377a\346\037\314D4\0020l"
+	.ascii	"\243\375\311$ZVod\244\032\344\031\037c\346\357\372\"\263\034"
+	.ascii	"\323\377\bs"
+	.string	"\237\367\2150[\347\013\326\331B\352l\225:W\350\300f\n\326y\202u\226`\235#\244\316\020R\347\252\026l\246\262\316S\326\371A\352\354 un\320\211\315\f\254\263\224u^`\235\025\244\316\313\3249\252\027\233\241\254\363\223uvJ\235\023\244\316\b\234\331|\300:\033\350\271n\001\375\245\271\251\353\232\231ZL\363R\3335+9ZsR\352\214\224:\007\260\316G\326\331\250\265t\003\260\316E\326\231\310:\017Y\347\244u\026\262\316A\326\031i\235\201\254\363\321:\253\3269\265\316\326:\243\326\371\264\316o\235\335:7\206d\034\034\250\306{m42^?\364\314\223\016\354\026\354N\354^lg\266\243u\177\351\256\353\026\323m\327@\314}\306\216\346i\336\3749F_\331\231n\346\227\275\254\361\317\317)\366\341^lF>?\247\210\310\235\330\212\207\334z\234\f\231Y\024\376\\\342\236\277<\334\202=\210\347\347\022\253"
+	.ascii	"\276\351:\334\201m\207\221L\346f/n\312\235\261\236\303M\247\t"
+	.ascii	"\013\240\322\214\350\006Nm\252\263\365\202\004\b>\301\201Gp\340"
+	.ascii	"\235\331\312\365\200\233y\231\201\367\373o\240\361\317\177\373"
+	.ascii	"\021\341nm\377f\301\367\231\305=|@\376\334}\024|3\036S\2476\353"
+	.ascii	"l=\265\214\372%\324GA}/\266r\205b\354\253+|\032\213\312\036\276"
+	.ascii	"\251\3574\211\204m\016\273"
+	.string	"\rU\251\347F|\360\255\230\242Nm\247\263\265\004\007\r\336\001\203o\300\340;\261\225+\003E=R\337\207\255\\k\264\277\224a\241\177\023f\371\016\035\356c\366$|\253\021\274\3235\324\364l?w\236\b\337\203me\206\236o\341\333N;\2659\337\025\270\360j~\243!\270\215\256z\bT_E\365-\330\312\225j\260\257\256\340i,*w\272J\310\252w\341\233M`\267^sP\343\267\372b\267\234V\013\017\375\3263\351\023\236\273N\t\023\266eX\370\363\313\334\f\"\234!/\327+\254\325\217\350\322g\346}X\331+l\205\267\372\246\360\025\336\347\234\3759\312B\341;\260\225+\205\357<\315\276\325N_]\241\323XT&|\003\336u\230\263D\277\313nv\357Z\240\177\302\367\234\346\033\323\033\271\345\364\325\341_\234\306z\023\247\277\377Z\271\362\226\323\340\273$\0343\n\237\301\245\336{\0374\312\256\006\302k"
+	.ascii	"\034\223F\271\003b\035\326\265%vJ\211\271\230\330\330\330y\202"
+	.ascii	"yi\201yi\251b][`.\272\266\300T\261\255\257\260,.\253UB\005\230"
+	.ascii	"\322\304W\226\312$\264\024h=\030\341\240*\252(+,E\t\022(kE\201"
+	.ascii	"\235"
+	.string	"\b\313\342Zvyqqyi-\273\266\262\270\226Z_`\313\250%\366RQ\342k\031\346\345\365\265D\256}\n}X\"\030\344lm\324\001\212\337\372L.\222\342\344\302O}\321\177\020\"(N\230~\350\211\336\226~\350Q> \311'N\222\204\276\351\223\377~\232qJ/\364(\237[\020\023$\310\017\222\360H\037@J\216\257\364@qM\177\344\241\302!\t\352\027v\351\323W\377\3634\337\026<\323\247\217\222iFa\226\321a\304\2174\347\331F\217\222\364\300a\241\234\210\321\243o\377\363\232Q\230\350\373\234\246\341Zf\355|f~r!|7\004w\357\245b\017\222\001K\250\316\013\333\250\347\3110\234\372\247?\377\31146}\1771\372\246E\246\357\272V\256O\317\304g\351[\214\321/)\376)}\333\265r}z\245o\304f\024&\242\321w\031G\363\030\205\311\177\366\263\243\3674!\244S\033\220\263\365S"
+	.ascii	"\244\017\220\364HI\357h\255\\\223\322\372\352\2127\033\213\212"
+	.ascii	"\307(|\372\306s\246\237>\277\335\215A\006\236}uz7C\036\003\201"
+	.ascii	"a\250aP\344\034\232\032\021\221\222\202$Ikq\0062Re\265\r\022"
+	.ascii	"@\243a\030H\03552\023\024\244\240\234\222:\231\003\240y\331\336"
+	.ascii	"p\254.\207\333\257\261\300\211\203\262\214\235\020\037Q\363K"
+	.ascii	"\335S\245\205\225#H\317]{\025\314~\016/?\242~Z\307\035\324\307"
+	.ascii	"\343\336\213\244\265j^}\375\\\264\220\b4\352$H\312\2506\321B"
+	.ascii	"/\313O\215\211A\355\001O\351.\002\363(\226\257\203*=\033\247"
+	.ascii	"J.!k\323y\223\306\374\002\017\201\364\326H\345\3415\210,\265"
+	.ascii	"\314g\177\020\353\321+\307\260\343\030\340\332\207\0031\305\301"
+	.ascii	"\310#\331\374T4\347`\017%\255\020\320\240}\272O\216A9tZi\301"
+	.ascii	"C#\307\311\260&\035a\234\033\3327\235\304\n\025'1\365\21348\325"
+	.ascii	"h\356CT\344D\003]f#\t\366\271x\"\373\256\326k\351P!\343,\246"
+	.ascii	"~\221\034Se\263\027\242\222\007\305\340-,\314#\252\352v\277>"
+	.ascii	"o\031\244d\002\353\034hf\256\301\335\207\252\312\207\006\332"
+	.ascii	"\264\217\263\021\276\001\233\004a\037\323\217\201\016<\210\252"
+	.ascii	"\336a\333\302\304\035\264\263\365\"\037\217\3709\r\"\312I:\353"
+	.ascii	"\301\340\235\024\260\370,D3\225\3475\263\210\337f\260N\362\213"
+	.ascii	"\356y_\022\307\225\254\2779\200dq\373?\325%\200\316\257\3435"
+	.ascii	"\\\311nP<Y$|\333^\200\017*@\214E}\375\207\204C\206\225\033\273"
+	.ascii	"\213\374\377\326\372\344\244\035t\211V]\3360\235\335bi\213Z\342"
+	.ascii	"!7\275\323\315\344\330\302\026\3468\265X\3173J\212\254\037\234"
+	.ascii	"C\343C\020\365\214\257\005\351\337Np\314\266\025{\301\212\356"
+	.ascii	"\262\217\245\344\370\314o\024\357\224A%\177\252\236\2354\235"
+	.ascii	"\r\336\320\310`\374\346\001\206\366\375 \300\021'Wj47\314\272"
+	.ascii	"\270\233\346\275(\265\273K\\\003y\243X\277\311xS\032\337\274"
+	.ascii	"\246\232o\311\312/\214!cp\362[W\311\260\307\262H\230\253\002"
+	.ascii	"\311\257\003\223Ne5!\017D0"
+	.ascii	"nT#g_4\021\001\300j\3037\345\364\250\001"
+	.text
+	.section	.gnu.lto_rotateV.16.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`}\005\225\034"
+	.string	"\306r\257I\240\226U: \227\341\211\252M3\204s\334\3425#\210Ot\312\371:}\013>)\213\275\005<\355i\0033\366\246\341\334>\234\222[5y1\307K\376\002\277f#\220D\220@\377\355\244$\f\317\356\3223X\327\276\277\224I\006\230"
+	.string	"\214"
+	.string	"\236"
+	.ascii	"5\267\027\350gO\313\304\235\266\\\241\3173\275\265\373\027\357"
+	.ascii	"\264\261\232\231%o\002\236\t\n\032L\252\320\204\303\252\326J"
+	.ascii	"\001Jfk\221{\222+\001\236I\005\r&M\220\322aUkR\356s%\320O\336"
+	.ascii	"\001T\253\3121q\305\324\003\372Y\213\312\235wo\344G\200_"
+	.string	"bqZ\255JL\242\324JD\260\006\350\347\022\277\343\372\244\317q}.p\267\352\304a}\323\r\030\3052\265V]\3778\360\f\334\337\3510\341\214\340\371\025\241\326\272,\234A\343\333\337]\334\356~\330\235R\001E\266T\306\332%\006\271}\354\276U[i\367\311\237\300\217\377\200\033\177\240'\277\270\037\277?7~}N\374\003|\351\007@yo\224\327Fyk\224w\207\362\352P\336\034\312\213Cyi\224\367\206\362\332P\336\031\345\255\241\2742\312\033\243\2744\224\027Fy)\345}Q^\027\345\235\224\267Ey\233\3622\345}\201\331\025-\r\244j\225\221u\246BM\244\020)I\016%\242\0341P#'\273\177r(\300\033\267\334\036\033\304\035A\222j0Q\270v\365\253oW]\266|\362\\^\344\275\034\362\367\311\365\351\352'\277 [\315=\273\205\345E\016\244\356VO*-[:\030\"x\221'4\325\355"
+	.string	"\b\262\2719\352\305\020$\316\332,[\362L\355\356\201\027y\002\206\265V\006\237o\236/H*2~\223\027\211\200\204\001z7D\217/\334\036\027\035\334\031\222\215Hp\375\244\225-\025\020\301\375\364\217U\266\214\365\370i\230O\337x[\214\"PG\214\265T\266\2345\236\204\366S(\240\340\031\006\371\334\263p}\372\264\r\310\322\021g-\033\003\0322`"
+	.ascii	"z\221\350\3756\234\230)\210\212~C=\327\320O\004\317\303\\\017"
+	.ascii	"\273\004;\241\016\013\032\004\321N|wAF ~C=\335\b_\257\347\333"
+	.ascii	"\351F\020\r\365t\273\"#]\020\200\365\221\340\025\351~>_\221."
+	.ascii	"F\254o\325VZ\013X\240\216\032iU\264j\345\001\341L\277U\222'\217"
+	.ascii	"\347\033\317\214\265\267&c\353\235\276\325\332\326\267\25315"
+	.ascii	"\235\306\351\235\234\326\351I%&\207\3268V4+7]e\3235}3k\233\276"
+	.ascii	"]\205\231\311\232\246kb-\353I\005&\006k\232)X\025\332^\266\244"
+	.ascii	"\375'\241\230W\317\246\375\ne\250QX\245\020TAI\220\240$)Q\032"
+	.ascii	"\003\300\002\031!\272\016\021 \265c\310\306\026\224SjY\003@\331"
+	.ascii	">\315\"\225\327?\002\037\214\312\257\325W\004m\255\r\346\371"
+	.ascii	"%\002\305n\304\212(\364$iC\206C\241sP\366.-0Zx\3759\304\225U"
+	.ascii	"\257#&D\254\327K\"W\351\216\376su\305l\337\310\017y\207\027o"
+	.ascii	"\024'\243\027m\264\020\277\204\007\017\200P\343\237\021\304Q"
+	.ascii	"W\007\017\177\007\347i\343\0202@C\215\336\031H\313\352\221\025"
+	.ascii	"\025{\301v\233\277c\013\312\212uM+\374\235Z\317\034\371\256G"
+	.ascii	"j\274\226\034\016\t\005\347\215\335\305i\307fH\303\220\317A\016"
+	.ascii	"|#\272.\1771\305\207\370D\341e\372AJ\340\354\013\304YA\347\264"
+	.ascii	"@\004\025"
+	.text
+	.section	.gnu.lto_quickMedianFilter3.17.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`I\005e\036"
+	.string	"v\364\265H\260XQ:@\253\026"
+	.string	"\007~\244\276^U\324\211\367\362p\271QM\f\005vT\027\f@g/\311+\253 \364\377\325\306,J\373\2069:\356O\332H+\004l\334+\217\247\302t\305\302\240p\2108\315f\t!{K\231d\240"
+	.string	"\234"
+	.string	"\234"
+	.string	"\030\222\236\300\324Z_\247+\301\n"
+	.ascii	"\226\324\213y\367CN\304\347=\025'P+\022\024\223Z{8\253\200<\335"
+	.ascii	"\036\371 g\362Y\332\354\335\310\211IH\202|fj\2550\327Y\342\351"
+	.ascii	"\274\001\361\264\223\266?{\337\311\264\227+\0259\212t6\323\366"
+	.ascii	"\243\316\004\3024\205\313\325^\026}U$\203U\bv.t'\205C:\004<\206"
+	.ascii	"\210x\214qq\272\202\246\313\007\304t\016\250\265\326\344VL\006"
+	.ascii	",\224\273\361\\z\361\276\323\347\023&-\270\334\213\363\250Sk"
+	.ascii	"]\306\345\\|\001|w\205\273ka\227\266\002\265\336\327\377{\211"
+	.ascii	"#\033\017\227\303\356N/\201:\006\306\020V\036\356\366j\334\274"
+	.ascii	"\335\2776\322\356\315{\277\315\362\262\376\373\226\224wEyU\224"
+	.ascii	"\227\244\274#\345\025)/\245\274\223y{\362\362\344\375\001\001"
+	.ascii	";\256D\200Rk\213)4\325\n\r\352\370\357ozK\bp\313\326\220\244"
+	.ascii	"\0319\226l\331Zr\375\f\250?6\3140i\025=m\331:J\342$\b\212\002"
+	.ascii	"y\332b\361\332\037\331;m\331\312\275\376\243\221\265!\362\247"
+	.ascii	"E\311\004\362t\356\372\354}[\266n\257\"7\342\363\246\024dm(\277"
+	.ascii	"C)\021\211:\261\035\214Q\264\237\344\327\035\331\236>\317|{\265"
+	.ascii	"V\261y+6\355\021F\250\374\260\024\216\330-\245\240\215\247\026"
+	.ascii	"\334G#\273\206K\260\201F\302\352"
+	.string	";\215\232\264y\253\302\3217=\342\370\365\262\205*t\371a\251\035\226\255c\343\341g\255\265\316\233\376\357.\333ib\3317} \0327\030\263w7\304}\264\004[j\255\017h\024N\314>\210\202F\346\330\253\350\013\311\340\266\351\356\003\365\230_)\342\233\373@<n<\265e\277i\226\24046\236\332\033\355*\017\273k\255\001;2\020=S\304w\276\037b\fb\016<4\200\220C\340\3047\226c\"DO\007\031\214\304L&\233\305`$Dt\220\301b<&`9\007v\266\003\202\007\3263\233\361\300\312^\375k#\261\332e\353\333\246\230\265\356&\274\351\007S\004\207\305\300\032\302\002\271\rgT\245\252\277li2JD\002~\324\214Q\365\241^\363\003x\r\272q\325\274]\265\252mp\254\232\323,P5\223)\211\224>2,\211\252U\030\222\225(\030\2632\032\373J>\206Yr\fM&\331\274%{\354"
+	.string	"RS\370\033%\236\222}/c\037\013\227`\231*\273\013Qz\244\375\200\202\250A0\213\244bfF&HA\013R\314\030\320\002\221):\007\020X\250T\223a3\362V\221e/O\221\370\255\030\211u\223\201\020^0l\246\261\341\035\226\027\302\307\300\320\313\022B\316\033\001\203]\0165\352\361i\271\201O70\267\320\333>\022t\216\330h\242\300\3140@A$\357+E*\360\242^za\345za\033\231\t\0273\035a\037\366\365\243\004\3347\215u\355\335\330\006\201r\251jm\fh\250J@\372GX\260vI*z\301Q\375\336\nm^\236\034\321"
+	.ascii	"\222\372& \323b\221$-\310\212A\270\t\252\215=\305\353\266\225"
+	.ascii	"\350e\351w\260\211\254\333\352\312H\b\225-\253\002\275+\327$"
+	.ascii	"\004\002\247\003kj\257\307\311\270\351K\374\347\241\276\246*"
+	.ascii	"\016=W\030\023\343\355\345\221\031\030\274\341\314\031\005>\261"
+	.ascii	"^\321\263\231\271\316\r\034e\202\231\n"
+	.text
+	.section	.gnu.lto_quickMedianFilter5.18.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\201\t\245'"
+	.string	"j@"
+	.string	"\016I\220\232Q:$\205\362\016u\377\201 \314\200\301\304n\t\220$\303\250\357\333 \340A\021q\271\"Q\271\301\266\275\261\315c\3449\007\022\211\214W=\353N\245\363\346H\347\321%\0038M\371~\027\377\355\1776K\b\331D\312$\003\313"
+	.string	"\304"
+	.string	"\307"
+	.ascii	"EL\021\252\250\204\251\265\366Nw\201y\372\250\335\016I\217y\367"
+	.ascii	"B>\204\350B\022\317\325:\265\305\244V\341\316\346\230\247+4\377"
+	.ascii	"\343@\210\3667\ng\004\311*)IXa\265V\337\315y\344\351x\035y\332"
+	.ascii	"UK?\n\277#\377\256\263\311\341n\266\032\355\234\311\314\222\244"
+	.ascii	"c\363o_\366\214>\204<Q\n\026]G\34364\2568gu\234\325\f\276A\335"
+	.ascii	"\006\025\203kO\247=\301\340\363\305g/\234X6@*E\323\315/\246\246"
+	.ascii	"\0019\230\\p\331\342\244-\2304\336`!1\035gE-\242-Xb4p\225\003"
+	.ascii	"\307\263\316KA#\036q\254x?\353c\223 `J\301\025\347\262\247\326"
+	.ascii	"\272\254\024L\361\335}\367!v\367\301\256\351#\317\372I\374\301"
+	.ascii	"\304\036_\225\305v\205E\334T\273\337b\r0a\333S\273\275\013\377"
+	.ascii	"\234\345\305\371\360\253\243\2746\2247Gyq\224\367Fym\224\267"
+	.ascii	"Fyi\224\367\244\2743\312+\243\274&\345-)/Iy)\345\035\231\267"
+	.ascii	"G^\036y\257ss\222e\301\225ZQ\214\245\251Xh\227\215\017\377#\347"
+	.ascii	"i=\331\223\267\345\005HqO\036\021\036\r\257=y7xN\\{\362\240\272"
+	.ascii	"\204\341\231 \356\311;Q\005#Lk\317\235\232\233#\\=\222\021\306"
+	.ascii	"d\307E\311\236;0I\274"
+	.string	"\222\25640OwPz{$\373\254=wUz\037\376\314\"&s\310\245\n\003\363\324\334%\332c\355\271#\366\212\334\b\321\217\2140\003kv\33154Z\306o\261\017\206\247\354k\361\322e\346\212\024\204(]6U\177\370-+\027d\023\331\007\312\"\355'\371\233\242\200J>\2369\001';\200\220M\265d\323\356`\304\312\021\243\331!\033\200U\027\220\307t\216\3653\333\346\245\253\211C\276*\326iq\244M\265\262\253\356u\251\304\275\353z\211:\370r\304hVL\327=@\026\373Xk\255c\177\370\033\340\177\244\256{}\244\030F,\306\336]\013\307\372\341t\251\265\"\240E\2451{)\"~f\215=\211\376\222\023wNw\037I\307\370\235B\276\271\217\224\303\210\307V\327o\272%i\r\220\307\366OR\225\305\272\257\274T\230\350\355\375\303\177\210\002\262\330V\220\nA?\032\206F\016\017\372f\360)\340s"
+	.string	"\203\201\004<\271\020_\037\036\020\033\206.\374\370<"
+	.string	"\375\374"
+	.string	"\371\370<p\270\360\343\363\021\002\341\343\021\260@A\032\204|C@@B\276SX\337S8}\003l\243\0351\326*\305\340G\3760Ep\230X\374j]\256s}'Oll:\007f\223\363\222\345pmEA\361\326oR\304\341\372\206\273\335j`\266\235Z\277\313\313f\353\032\030\333vj]\243\355\234}&\177\023\327\3073\2475\325\322\372\354\016\264\235\223\353\3536F\341\214\354\2245X\227\271\365\260\221\221\365\267n\353A\374\204\246r6kY\007\270\342\2315\257\321\2215\2279\207\234<$\340 eeWa-31f\363\222\0342\263\247\262\277\344\245\030\255G\340\032\315\246\n\200\332\250qL\352\030*\021IIAJ\212\031\003"
+	.string	"\003\021\241\251m\022 \224=F\305\306D\242\221&%)\264w2Lr;\037\351\235\017\337\362\265\207&\235O\344\026\215\013\207l,a\304\230\3522C?w\200;\033{\t\313\237\200\331\365XQ\252\354\2607\216\356\034\b\237\241\237p$$\257\264;<\312k\343\"p;\302\022\036\377\234e\326\220\300GP\262W]\350\342\257z;\200\345X\250\3055\234LNU\327\205\250C\005\\M\353\272t\036\t\022^\202@\244>`\37015\322\t\303\300\0023\367\211\013\206\004y\021\365= \347\013`@"
+	.string	"\220\020)\255I\024\227\031\177\277{\300p\013Q\2063\277\313\"#\330J"
+	.string	"\342\341\226\241xA\021\264P\204\322\024\363\217\336\277 \375\001j\303\300Ex\023/\004\036\274\230\276AY\023\276\324I\177\355\202n\224r\352l6\tt_\321\363"
+	.ascii	"LP\251\t#e7\341\353}/Da\226-\016c\234M\336\354\266\202\206\230"
+	.ascii	"\203\352\0312\265q\325Q\345\211\025\354\204\3575\372Y\332\367"
+	.ascii	"\005\240#I=\345\310U\243\300&4\f\013\301\336?\230%\215\233\346"
+	.ascii	"6\245N\f\216\"b\247|!\233%\200)\254=\030\223\216\270iG\334\264"
+	.ascii	"#n\332\021\307d\252\303\3233\002\2660\200\r\333\201O\306P\236"
+	.ascii	"\0045\316\2248T"
+	.text
+	.section	.gnu.lto_quickMedianFilter7.19.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\364\017\0055"
+	.string	"\312S"
+	.string	"\022G\200\334Q\007sOym\266\n\240\364m\201\255\255hH2\324>0D\273\315\005\3135\342\374\350C\237\225\024\\\310\340\3510Ls\340\277\247!\271qYe\036\273\247\314\303A\272\263\022[\262\265\3356\262\367\226;\245\224\002\023\001\375"
+	.string	"\013\001S\251\227\0319\f\322\2669\346%\356.V{C\202\2264\223\245\346\"\2212M\031]\261is\357\rj\313\n\322\266\r\246\247\267#\310\235\271\225\364\326R+K4\357^\034T\252\334\253\024b\001i[V\246}\244\221,\361\321T\346\240:\257\326Du\311\271\367\016\001\365\357lk\366z\266\375+F\333T6\233~\354\342\217O\017q(\344\t\002\177\276\265\307\333\351r\270\035\365fK\321\323\232\357Gn\224\3104\262\265&E\305\324\305\255\376\331R\342>I\272'\t\022'\036\351\341\021#.\324j\036\255\"\036\364\321@\037=\374\307\243}<v\370\252\243{:\262\234\207\325;\254\034\256\253\321\271\0324\034W\325;U3\\\225\3217\0311\334\006\300j\005\262\323\262)$"
+	.ascii	" S0\034}\321\247\t\024e\002uA\2715\323{o\216\312\204y\300QP9"
+	.ascii	"\271\371\203E\177;i\363\312\226\227\024\025\213v\224\350\336"
+	.ascii	"\313.E\265\242\031\250\231\235\0023;`\316M\b\276\374W\336\313"
+	.ascii	"\364\034\324\355\325\036l4\371\222+X\265\223V\277\316\374\213"
+	.ascii	"\254\354\372\222Y\311\344\237dnV>\016f\243Vv;`\347\242\366j."
+	.ascii	"Z\347\037\353\354c\235{\2543\321:\017\255\263\320:\363X\347\240"
+	.ascii	"u\006Z\347\237u\366Y\347\325:\367\2543\317:\357\254\263\316:"
+	.ascii	"\347\2543\316:\357Xg\325:\337\254\263\315:\247\326\031\265\316"
+	.ascii	"\247u\266\326\331t\3477\235\335tn\b\275\2510\013\342\334\253"
+	.ascii	"bm\316\005c\303|\264W7W\373\220bX\365\305\250\343;\021\206U_"
+	.ascii	"\2128d\254\256s\312|auUCG\254\013\253+\027\256-\254\256O\202"
+	.ascii	"dau-2g\265\022cu\275Z\251\254\260\272\272X/\030\253\253\211e"
+	.ascii	"\0336_\254\366\336\\\315\030\233\302jO\f\320\323\356>\335\220"
+	.ascii	"S\2457%\n\253\2750(V\242\324\032\244m{J\202\270\233p;a\265\307"
+	.ascii	"$\250\275\216)SKs\347\201Xi\256\306)\323\255MH\263\251\266g\363"
+	.ascii	"ptZ\267\377\261\004b94\3337\225\316i}\265\004$z\373$\337\336"
+	.ascii	"\366\301,\264\363\366^G\310\366\016G\335"
+	.string	"R\211D\370q\332>i\374\342cng\251K\021\200v\253B\277\2454z6\245\215\300\314\364\223\234>\37285c\372m\206~\217A\023\026\207\314\352\301\226G\355\267WS\301\202q\"\3177\200\212\331o(\335H\033MQ\332L\353\363\223|\276}$&cO\256f\326,v\266=\037\210\025\326\344k\003\272\353\230~\016M\330\177\241\225\335\256\266b\246\375$\333\262\336\350Q)\017\352\342\243(J\363\344j\274,>Q\223/\333\274\367^\323\350\333\253\201\232\372x\026\337\350\033\212\206S\013\363\231\231\250\273\216\001\316\334{\017X1)7\334eF\034\323\035\334%\276Q\304\360w\360\377\r%\304l\356r\366\3737\024\020'_\343\342\367[2Qu\232|\215\273\312\352\006\035\2222\20407t\207f\fG\004\216\f\\(\200\300\310\023\321|d\004\241!\204\205\244!\016JIIJGC\0346XH\032:\372"
+	.ascii	"b\3108d\245\016\031>\f\205PR\3720\244*o\263\362q\024=P\323;1"
+	.ascii	"\t\363^+\006\315\325\335f\211\257q\221\177\255\225}\361\347}"
+	.ascii	"\276\313\272\221b\332L\353\237O\362\317\373<\322\317\003}\350"
+	.ascii	"\330|\21094\3427\230\316i\205i\tH\264\247\347\211\037\314\352"
+	.ascii	"!\236D\341\017\205\204\337c\215\236\221\265\021\2309\374$\017"
+	.ascii	"_\3708\265\241\220\360\205<\313\340\267\227n\344\2276\323\232"
+	.ascii	"\347\223\314\363\301G2\343y\3402\270\264\005\201\277o"
+	.string	".]\200\300\377\241\001\177\277\325\270~k\331\342\363\375\352\3736[W\036Z\217\367\215%K\257\367<\264^\032/\215\2473\333\031u\337W:\247%\326\022\220\350\356\223\274{\335\007\263vF\235\016'\204\373\016\263\222\313=N(\207\303\251\313\235W\277\253t#\301\332L\353\235O\362\316\253\217\024\201Y\250\201H\350\034\242\021\221\202\024\244 \205\326q\006\"CtD\017\022`s9\206\265\312\021\211F\204DI\013Z\310vr[\311\310\237T+B\233$\237\313AK&\0369\320\017\224\305A6)2u\201\016\017nKm\\\203\260\220\323\335\372JRv^\017\313\252\024\327x\2370\371\031\346\324P]e\323s\323\2047\235\312\0328d\030\231\n\324H9\005\243\233b_-d\341\217\353qJF6\245\f\252\353 \2473\005_\231\265v\034\200C4<\207aK&QN0\"\f}\203\366\372t !\251\235"
+	.ascii	"\243xY\004e\002G\335\337t{\032\313D\001\022Q\307\017\243\022"
+	.ascii	"b\320HDV\245c7\326X9\270>\236\221\214\311\234IR\304\274\241H"
+	.ascii	"\256\332R;\327\",\244\317}\350\361\304"
+	.string	"\270<\336\204\t\275\267yK\243\310\310\333\"h\f2\203\273z~L[\331%[\005\020F\250\310\317\006\234\332](\313\231\201-w>K7H\242.\177\026\270\013$I\264\004W\247\251\263%\3279\"\"5\0079\246\210\f\313\226h\f\3422\207\021\032\376\3479\332\363\177o(\2501\302\241\030\202\237\230\304\314\026,\001\365\020e\033(\002+\365\002OZk\202g\332\302\037\001\332\fc\3260@\361-\031Z\324\245D\227\261\023\324\333\217\220\"\3447\333\320\304^jK\003\264\005\235\311A\263\2367S\372{J\321}\241L\354]\003Kj\215\204\230\357\001x \336z\277\303\234\374\346\376\006Y\022\344\306\320\032Knc\224\352\335\t|\375\274\333\332\003\245\037%\301\013\325\263\215\215\227\314\025a\007\237\236Cc\336\304\361\373\241\321\213p6s>\213\030\201\270\313\257[\300\254\177\b\235Z\3364\027\002\034\2110\003\210"
+	.ascii	"\230r4\"\202\213\266\252\212x\341F\310\230\0078\221\303\367$"
+	.ascii	"\270\227\034\276'\301\275\344\360=\t\356%\207\357Ip\343\322\020"
+	.ascii	"\007\336#\260\253\205\034`\233\322,\022\2437\036\200\333m\242"
+	.ascii	"\214\177"
+	.text
+	.section	.gnu.lto_quickMedianFilter9.20.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`h\026U@"
+	.ascii	"zc\204\025E`^R\007\300\334\226\205\\p\307\025g\037\316\213^'"
+	.ascii	"&:\2346kH!\370|\333h\215c5]\220\262\211j\371\213d\322\251\342"
+	.ascii	"d\267\202\021c\0301\325\345M#\336\307,\326~s#\265dk[\356\224"
+	.ascii	"R\nR\001/\001@\001V<\024Y<28\030\nx}\201\230Op\217\261\272\366"
+	.ascii	"PR\351*'\332J\t\036\212,\b]/\350\264m\253\354\313\tx}\275\307"
+	.ascii	"\322ZC\351\316\334S:\354D\213\231h\266m\177l\341\322\266bP\234"
+	.ascii	"\344\365e1^\203u\224\023l\205\212\t\321J\273\260X\214\305\265"
+	.ascii	"m+e\354a\332\027ma\332\367\203p\257Q\261f\324\255Z\371\224tB"
+	.ascii	"61-)%\035\215HGFEDCBAE\342\020H\370\303\006W\340\317G\365\365"
+	.ascii	"x\273\364\242\357V\334\273\005(\024,z\260\264P\264\262\255\237"
+	.ascii	"\332\304x\222\255\235\330\3028\022\255\233\320\2668\323Y/\235"
+	.ascii	"\231\271\222\226N\322\222\305\217X\332\210\245\314\221\302\372"
+	.ascii	"(l\212\033I\351\")Q\234\b\254\207\300\240\270\320W\007}=\361"
+	.ascii	"\342\221&\0361\342\303\"\rT\204\210\013\207\364\317\020/g\273"
+	.ascii	":\330%\304W\036\r\344\261\303\177[\355\263\245\303\325\034\355"
+	.ascii	"\313\201\303{G.\031\315\346\275e5\217I\262n\370\316F\247@-\026"
+	.ascii	"\250ql\205_4U\322<\003j\251@\017\230\255Q\322e\355.\264R8\212"
+	.ascii	"dF\177\2275\352\245l\016\226\326\214\366\335\202\266m\331\261"
+	.ascii	"\264d4\003h\346\027\300\314\016\230\205j\002\255\252\345p\265"
+	.ascii	"\346[\353{\230\305P\370;\231{@\323\254\r\377\017\346e\213u_`"
+	.ascii	"g\013M\326\254\274\316O\3279y\235\235\2563\362:7]g\246\353\274"
+	.ascii	"t\235\225\256"
+	.string	"s\322u>^g\343uF\272\316G\327\331\350:\027]g\242\353<t\235\205\256s\320u.^g\342u\036^g\240\353,\274\316?\327\231\275\316\301\353\274^g\340u\376]g\237\353\254^g\337u\356]g\336u\336]\347\364:\337\353\214\272\363\243\316\216:w\206\237)g\"\270\265m\214:\272\326\314U;\322d\335V\232}\316a\225\255\333\202\023\207U\266\216\2307\254\262nep\254\262g:\232\260a\225\005c\177\250a\225\355be\240a\225\265\221\203m\317\260\312\252\220\343\306j\360\316\0302\254\006\317\340\310\322\306j\020\355\t\033\253A)A `X\r\016i\006g\254\261\032l\006\231]X\r\262\240\223\306\352\212\347\006\2352h\254\256h\202\3500;cuM3^\005\333+\037q\\V(ZX]\303\262ti\021\203\001\257\357\352\245\344\276\302]\306\352zD\331d\001?:`\324\357\177\352\373"
+	.ascii	"P\277\271t7\323\032\225k\237w\262\317\253?\005\345\003@E\362"
+	.ascii	"\266\326Q\220\353\251\357\274\232\363y\326/\337\177\031\004k"
+	.ascii	"@<\275\357-\r\374B\353\t\315\235\317\367\275/z\371\025\317\367"
+	.ascii	"\376t\346\256\367\236"
+	.string	"G\rS\235H@\222\366vO2\236\306W\207\367n\226\304\343\333\332}\233\365\256\316YCHCy\357d\336\357\3767\367l^\373\206C\207\356\276\323\300\251\351q\343z\300\366\273\373M\326[\272n\244\315\364\013\354\326\356w\226\356f\017\246\226F\345Z\310l\315\222\364\235\234\376\375\251*e\256|.\316\233\327\322\276\351\023\273\324\230^\007\325cV\274\007\302\251\275\032\217\267v\254\357\032z\337\311=\257_\376\016\313\225\255|\027\r\334\\\371\034\272G\371\013\230\276\247\321\266m[t\371M\326Ff[\245\312_~\257\330\221\202\006\372\314l%\244\307\254\220m\332\2665p\327\260\354p\333!a\305#\302m\342\333\005\016\377\013\377\337+\226\240\315mi\277\177\257H\222\302\353X\371\375W\r\213'\323\353\270\267\270Z\337\363o\266FI\363Y\331M\326\037z0}\017W\340\352\262\036\2504\210@9\264\207\346\f\313"
+	.ascii	"\313\002\030\b\034\210bG4/\243Bl\020q\201J\252C\025\025U\325"
+	.ascii	"R\252\003\207\013TRK\020!\244\242\206\270\312\203\006\020R\""
+	.ascii	"\252\252@H\251bm\377\017\013od~\n.\201\266-\227\202\266\322M"
+	.ascii	"\207\212\005W\223\362\246|J~\313\351n\316iT\256\237\336\311O"
+	.ascii	"\237\374\251\247$X/\211|\3447\2348NN\217\374\242\027\235\023"
+	.ascii	"\022\311\024\327\304\364\355\246wu\3364\2044\264\351\235\334"
+	.ascii	"\364L\377\233k\372\206\303\364LK\257\364\335\006n\351\235\274"
+	.ascii	"\364J?\265\364D\245\257\236RR\334\361{\r\233\244\244?~\321+)"
+	.ascii	"\356xD\242C\372N\243\306h|$#\024\022\222\321\033}\277u7\3214"
+	.ascii	"*\327G\357\344\2437\372\251\254\243(#'FDED\337f\316\024\025="
+	.ascii	"Q\321\373\223(%\032z\n}\227q\033\032z\241\377\315\r=\205\204"
+	.ascii	"\212"
+	.string	"_\374\036C&(\350\213QAE&\305!q\370-\246\201_m=\241\271#\276\223\211?\374\242\327\025q8\024>\201^\370\035\206\r\b\350\205O \241\220\375a\277\277\200\371\371y\366\007\212U\302\256\314`\326\372\355e-\030\374\225\031\314J\327\365G\007\374\337\267Z\027 \360\003\201\301\250\201L\007\031\"\021\021%IRPHc\221\006\"Bd\253\007\022`Bi\214M\221$\206\004$2\"\022\bI\224l\007\362\330\207Kw\350\301\"\f\316\271pIK\030\020\3037E^\272U\001\327L\200\016jp\324\321\273\220\030 \210\031\001b\327#\r(\032\241S\007y\264\275\222WW8)\252e\231u\344\2059\024X]Y1\303\027\333\251\032\377\326U\215Y\201TT\226\256e\377C\312\234P\003\312\022[\006\034xe\301\262\221\305a\207YV\244\003\367\305d\301`\3342\371\016\234\332L\001\262[\363C\313Z"
+	.string	"\362\247\003G\207\300\237\300\bc\023L\245\302\321<\003\376?\310\342UU\204\203\312\310\221U\244\240+\271\241\036\213\303G\300\237\004\327P5\217\334\364\001\004(Y\036\242\202ur\333\331\370\3535F\034\032\202\033UF(\022!\036S\300q\260\325\2208\346\r\244g"
+	.string	"\274\241\035\b\n]Y1\207\336\333\301\026)7\251\036\375)\332I\314z&/W\020\2452\312U\374\275\020IX\231\002Z\362\234n=\345A\204\006\366\214#/\326\030\232\256\310`\220\f\276\003\367\3121\005\367\3246\233^\005\030\017-\210O\215\313T>\340}\213\357tAL\210\267\266\235\032\376!\214\n\251\325kE`\340\232\272\270\246\006\231P\203\243)\275)\223\2701g'A\235\255J\271\3078\f\246H\244\353\341\261\221\311\037\257J\320IAZ\031\332\343Q~\300\266\\\341\222!\026Iu==6\242\354\343\2128\254\266AF\335\004~R{\0227M"
+	.ascii	"a\233\273\326\302\313\226 \236\257\204\r3\265\330\023\310\336"
+	.ascii	"\032 #\020/\207\357*\036\242\326M\304\210\246\313\202-j\367\335"
+	.ascii	"\0355\3557&\2541?\t#\215l\027\b\210\354\233\365\343I\216\367"
+	.ascii	"\217\236\375\316\222\022\3317\341K5S8\357\333\013f)7!\022g\271"
+	.ascii	"\242\215\217,\271^\037\210\307\365\2159;\252o\206\277no\366W"
+	.ascii	"Dw\243\037ND\257\266\227\253\226\324\274\340\346t\274)\001'\321"
+	.ascii	"G\333\213\315\363}K\267?\305\251y\301Y\211\334]?\342D8\250\222"
+	.ascii	"+o\202\237\305'\253\301\334\351p\346\265\037:\227\224k\211\214"
+	.ascii	"\316\210\030L=\013\2707\022c\225"
+	.ascii	"\317\210\302\220\305q\216sq\365\355\216\307\342\352\357\036\315"
+	.ascii	"\342\225\337=\316\205\253\277s\234\213\253ow<\026W\177\367h\026"
+	.ascii	"\257\374\356q\352\302\374\253W*8\f\345\017X\331\260\261\3473"
+	.ascii	"Q:\023\2208&\267C\005"
+	.text
+	.section	.gnu.lto_quickMedianFilter3f.21.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\\\005\265\036"
+	.string	"\346t\267I\260XQ:\200\227\345\356+\213\262\327MV\025\365\242Y>\r\223\352|C\"\261\231n&:m\335\322s5G\253\375s\206,\"\373\2069:\356O\332H(\004l\235+\217\247\212\373\213\205\321\366\315\020\305f\t!\233H\231d\241"
+	.string	"\236"
+	.string	"\235"
+	.ascii	"\026\2048\246j\255\256\323\215@\005\300\251\303u\336=\221\027"
+	.ascii	"\231\235\267O'PkQS\222Zy6[S\236.\257|\220\013\231\355\376D\236"
+	.ascii	"\215\243\013\215|z_j\255\257\326e\306S\361\006\306\323\256\261"
+	.ascii	"}\221\367\025yv\223\265*\311\221\212\315\263=\211#\002a\252\272"
+	.ascii	"\345h7c\234\025\003\006\257\022\350\200\206^\006qC\tx\340\204"
+	.ascii	"\230|\361Ql\371\210\255^\017Sq@\255\365\314\255\020\031\360O"
+	.ascii	"\316\306\342\016\027\357/]d\302t\345\226sq&qj\255\313\267\034"
+	.ascii	"\320\027\300w7\270\273\025viM\256\337\367\0224j<\\\016\272/\335"
+	.ascii	"\004F1\260I\260\362p\227G\343\336\355\376\265\213vi\316\373\017"
+	.ascii	"P^\231\373\276&\345eQ\336\025\345-)/IyG\312K)\257x\336\026yY"
+	.ascii	"\344=\202\002SU04\251\265E\225\230J"
+	.string	"\205\002u\334\367'\235^~k\236_|XXqZ\363\304\322\342\031P\177lY\222\234K\232\326<\2350\355\257\244\341f\200\216\344\230P\236\236H\256\275\322~i\315s\311u_\212\222\206+}\302#\t\345\251\270;\333\367\326<\177\270\214\034i\366$\025%\r\027Ac7\220\"{7\252\232\022\332g\372\203h\324\232.\202\371\362j\255c\357vl\332#\220\244\360p\030\233\261g\214\2005\256ZP\366)\00460J\260\366N\241D\332\273]\335h\232&o\354\272\331?\024\260\360p\230\035\232\215S\343\341\305Zk\025i\372\276\267jO1\232M\323\357\221a\013\022{wC\274\267?\005R\265\326\007\024\352F\265\007\242\330_y\264\337\247\376\017\f\356\003\335\375\236\036\342\367\311\370\346~\017\017\033W\255\331oj\305gL\215\253\366D\272\312\303\356Z+\255791\020;\242\210\347|?\300\030\300\034xh"
+	.string	"\341\206\300\211/\354\306D\210\235\016\261\027\tY,&\203\275H\210\350\020{\301tL\274n\020\254,\007\204\316kG&\323y\231\274\372\327.\222\351V\255m\253B\254U'\341I\377\224\021\033\031\006N\t\n\350\262!\312\312\\u\026\251\326b$$\200\350\214Z\365\237~\022\375\256!G\262z\267\254^\365L\030V\263\230\005\253f.\246\017sF\206\241q\305\212*Y\251\006\212\025D\366\221\234\214r\372\205!b\331\273-\233\354"
+	.string	"TP\370\013\325\277B\366\247\b\201[\236\350,4Im\256t'#\2411\200\203\25014\213\244bff$HA\222\0243\006\320\002\221):\007\021\200\301$\266\262l\006\362\252\"50G\222B\250n\027{\245\223\2412j9c\331X\211\261\214\315\3705\220\351\203\333"
+	.string	"G\314\274\203\274\b\360\337U\03555>\223\322"
+	.string	"\201\003\2144\2419\212\216g\240"
+	.ascii	"\245^\355\221$\220%@\0068\320\302`\334s\232\007\227\211\b\310"
+	.ascii	"\320m\021\t\337|2\316\335\210\305\006<\316\302R\220\254\2621"
+	.ascii	"\347\360n\002\313[m\300\"l\273&\261\275\372T\244\027[\313\317"
+	.ascii	"\226Kv\200\247&\034\320\371\342\235dB\b\212A\270)\265\306\236"
+	.ascii	"\342U\263u\356\245\362\267\315Dn\234k\221%\030<\214Y\035\340"
+	.ascii	"}d\261\037\201-B0M\355\365:\031pr%\213\321R/\256\312CE\"\214"
+	.ascii	"\211\361\373p\b\r|\274\221\301%\n4\261]\320\260L]G\f<e\3522\025"
+	.text
+	.section	.gnu.lto_quickMedianFilter5f.22.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\246\t\345'"
+	.string	"*A\024\016I\240ZQ:p\031\370`8\311\214\210\016\274\375<u\265m/\031\b\022\337\277o2\271\334\314\377\2647\024\361\373\257\260\205\344\016wBZ\300\003\317\214\203\302\351\3203\370\372+\300\245\007\257\230\377o\373$\306f\t!\233\310\235d\315"
+	.string	"\307"
+	.string	"\310"
+	.string	"f\356\350\301\324\220\252{/\355\226\025\230\267\237\001\300UE{e~\221\033\301\375\307N\036\273\227\206\323\223{\1775\3061o\371g^\310\207\340\230\205\343\357F\216O\005)\002\232\271\367\336l\036\200\274\035?#o\333\006\333\217\277\363Xq\237\311b\260W\212\272\316\026\313,I;v\305\361\313\2351H\223\250\035/\367\031\216\313p0\325\330\322aK7\352K\306S\0311*\232tW\022\214z\276x\353\205\213\312\032\240\204\002\351\246\324\021\322"
+	.ascii	"\036G-j\311\342d\312+\032m\200D\325\216-\342\2230\345\221\030"
+	.ascii	"u\230x\354x\323\253\021O\250\216;T\274\337\3641\212\023\325\216"
+	.ascii	"\247\342\265\334\271\367r\335\361P\234\001\234\371 \230\331\001"
+	.ascii	"\263\231%\024\224\336\364sX\254\3033R\267\026\231\177\271\332"
+	.ascii	">\34631G\0303\3344\230i\377\3758\266\362\315\203\347\231\255"
+	.ascii	",\263\225c\266"
+	.string	"2\314V~\331\312\251\255\214\332\312.[\371\264\225[\2662\313V6m\345\322V&mek+\217\257\334c\345:V~\316l\305\226\bY\356=q\205\346j\261C\035\017\376I\322\033\305g\232[\"\206\310'J\306\n\024\237\350\026&P\370D\205MU@\204|\242D\212L\324x\342\023\305a3\004\273FBa\236\240*\234\370D\221\230\260\320\314\035\325\240Xb\204\201y\213\016\321\370J\370M|\242%h\017\2120sGfp\212\310\002\363\326d\306\361\201|\272\254hG\216\004\367$#\002>6\273lt\f\227\361L\354{\261\225\375,SC2U\224\036t\331\276\332\225\374i\251\005\331#[\347K\t\334\215\321A\261}&\177o\206\316\351\343\231\023\220\342c\b\331>&\3336\007$X\206\252U\215\354\232\245\241\256^\345\230\235N\r{x%u\201\267\304\321\266\217YLM\353rWi\237\265\221m"
+	.ascii	"f\250Zqq\326;\272Z\374x\357\275c?x\033\335E\220\263\246\365\211"
+	.ascii	"b\b\365\306f\346\n\007\262\360\346\313\275\367\200%\356\306\360"
+	.ascii	"\251\204`\241\231\203\317N\372F.j\343t\367\211z\214\347*\344"
+	.ascii	"\273\366\211x\b\325+\236\365\333v)J"
+	.string	"\243\253W\374$\245[\213\335LP)J4\323\376\340=\314\320\325\"\007?=\031\202\306\r\3779c\340)\300c\340\202\016\002[\f\304\231\307\366AC\220\205\236[\007\237\236\036\037\236[\207\r\026zn<@\037n6\001\354\363\223\001\350\026\344\343\003t;\177\367M\343\246mt-\304#\306{\225\026<\311_u\344\246B\365\244z\026\353X_J\224L\3261*Y,\005+\006\353\216J\320\345\325\217B\204\301\372\005{\275P\252\264\206\366\207Pi\332(UMkh\243\256\332\331\177\362\367\240|<sW\373\330\325gsp\325N(\236\324\213\314\204+\254\223\325\035\246\251^I\351\024V\337\311\323$\341%\360\312V\253Y]cekuE\223\303\352Z\346\374q\312\210\200D\262\312\256Q\025Kk\212i\253Jp\210\255^\331o\362r\312\323!\020\031\315\016\200\334\250qL\352\030\"\021\221\222\202\244\240\2301"
+	.string	"\003\021\241\251m\022`\204=\2053\305D$\030\005MJRh\3372,\271\374!\371\235O\013\323+\332M\206\306\3309H\f\t\332\270@\213a\334`\016\013\3048\356X\357_Xxcf\n\311\206V\325\204\202="
+	.ascii	"\022\f\037\205\301\272\0208\246\005\242*\257\004\250P\2121Y\034"
+	.ascii	"\024\260\206\020Pp\322\302\304\273\372\t#\277N\033\001K-\342"
+	.ascii	"\207\327\340\023ytq\325\244\210i(\206@\354\201&:\031\211eT\334"
+	.ascii	"n\235\340\3142#\323\201f\0262N6\305\302\206\004z \005J)j\311"
+	.ascii	"\006m*k\220\267\350b\004(\362\377\242\006F{\b\344X\343\213\t"
+	.ascii	"<\203S\b?\020\343Y\303\007?z!\27485\204\024\340?3\035\203\271"
+	.ascii	"\021\013#\321\351\027Y\236\031\323\006\004'\215\215\361RV\375"
+	.ascii	"\265\021:fJ\332\331\237\022\267\333\257O\343\300\002\366N\364"
+	.ascii	"T\t\207\217\377\267\321(\234\332\2263\226o\366=d\253\335\020"
+	.ascii	"\320`$\206\241l\034\255\324L\023k+\243\362\336j\265\337\217\340"
+	.ascii	"bB\022\234&$\253e`\211\222\214\344\t\232\023\342wj\034z\367\211"
+	.ascii	"i\311sjb\226\313\017r\256\0040\2055\266\360\363\210'M\314\207"
+	.ascii	"*\352\\\211|L\246:xz \310\026\026\260a;\360d\f\345=A\325\231"
+	.ascii	"\244\207\n"
+	.text
+	.section	.gnu.lto_quickMedianFilter7f.23.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`5\020\2355"
+	.string	"\332T4\022H\200ZR\007q\225\261\214_H\254\037+\026\350\0223\375\365\311\353X\246O\030P\r\360ey\360\252i\371\261\244 \334\253\221\252\372O\274\332=m%!8W1#\236\206\n!\316\242\210\301*\255\304\204\220\335D\356\224R\n\026\001\375"
+	.string	"\020\001$\322\243\246T\013M\312\202\264+\217\331\210;\213m\256\213\307H\0371j$%\322\243&\007h]`\356\275<]YA\332\265\255\340\344\262x\332\231\233Hc\0315\223\235\364\357\336)&^\3672{X@\332\225\231i[\365\020#\346\256\223I\343F\243q)e\225\271\367\372\354t\360\326\365l\340\255\353\317`\264Of\363\351Fm\324\311\301)\022\20776\302`\r\220\346\347\353\361v:\233\303\245\350\255\236\357F\334\350\317)\204\253m)y\324F\254\326\301\"\3429W\215s5\304\213VM\264\022\342\303 }\023\004\210\333T\265\260*\207\007qt\r\216\033\016\264\32146j\370\217\252}T4\274\027\325\274\250\030\276S\266N\t\303\355\213\316\275p\3418"
+	.ascii	"RNP\235\2365A\001\330\321\324\302Q\026};w\224\316\235\254$\257"
+	.ascii	"gz\357\345%O\234\007\234)\211\344\247\216\025\375\275\325'\024"
+	.ascii	".\255\245\344\212v\364\347\336\313\276\224tj\336if\247\300\314"
+	.ascii	"\r\230yM\001\327\233\377\314{\217\236y\272\265\332\203\f\244"
+	.ascii	"7\271\202To\265\005\323\341`Qg\327\233\314\314#\377%s3\363\247"
+	.ascii	"\230\203\232\331\335\240:\003\265V\263\261:\353T\347\234\352"
+	.ascii	"\214S\235\213\325\231X\235\207\325\371\246:\333Tgau\016V\347"
+	.ascii	"\232\352\f\254\3164\325\371W\235}\325\271W\235y\325yW\235u\325"
+	.ascii	"\331V\347\\u\306U\347\264:\243\325\371V\235ku>\333\371Og?\235"
+	.ascii	"\373\001\320\353J\0042\367\252h3s\255\324\257\252\326\352F\242"
+	.ascii	"+\202\205\255\316\210\231\256\352\n[\035\017\235\262\n[\235\224"
+	.ascii	"\216\251\214\255\256\251l\215\214\255=\263e\214\255M\013\023"
+	.ascii	"ck\247P9\022\306\326nY\035`l\255\017\033\365\204\255\235\"\003"
+	.ascii	"cQt\261\265NJ)\232\\l\355\3351\341\273L"
+	.string	"Hi^94&ls^\226pWz\324$tR2\205A\33257\306\303\235\204{\213m\316\214\247\265\002\315S\367B\2525\267?\316za&\224\341,\356?\355\277\364\224\271\236\027K\220\2057\206\373v\322<eWKH\242\271_r\356q/d\033s\313\275\233\351\301\275\213\261?l\024\004\250\033\356\227G17\243j\221\033K\337\223\b\b\313=\241\337M\032\035\343\352\240\2533\375%\247\217\376N\355\230~oA\277\253\240}\205!\223r\360h\375N\322\\T-n\267\001\005\320\254%5\344\223\372\275\244\373I\006\222I\237k}\373%\337\276\376\320\0213\023\316\226\326\034v\353z{!\325\027\322\333\006\244\317C\373z\260\036g7\253k\330Y\177\311\270\032\037\364\350\222\363\264\361\231\200\272\230p\266\263i\374\037\2447\373\274\367\3363\350[\253w\220M\342f\374\240\357\244\030HO\3473\363OgqW"
+	.string	".\367\336\0035lI\215[\313\b\356Jop\263\223o&\027\376\r\376\277\223x\234\315d\267~\377N\332\201\344ml\374\376\232E\351\f\322\333\270\225R\001\035\2102\20487t\207f\fB\004\204\f\\(\200\340\370\023\321,t\004\241!\204\005\"\037\016EDDEB>\0346X \362\021\372"
+	.ascii	"\302\347H\344\242\016\031>\370\204(*\372\340c\231\267\231\371"
+	.ascii	"S@\277\203|$.q\336+\265\240\221t\2031\342m\f\344`Xgo\324\371"
+	.ascii	"\234\357\263\356',}\256\265\316/Y\347s~H\347\2059"
+	.string	"W\270\234\"o\254\370m\245y\312+-!\211\342\340|\361\205l8E\bP\267\342\360\211=\303o\263F\307\252t\320\325I\374%\023\177\370;5b\317\360\2077M\233o*\335Oe}\256\365\315/\371\346m~(\355\346\205M\033+\234\2150\370=\205L(\374\340\030a0\b<\002\277\245\214\325\324<\260\346{\013\020\370\033C\363\373\216\"FC\363\27714k\277 \277^\232\357\330\373\206\322<eXKH\242\276_\262\357{/d\363\035{\275]\317\356\373\013\214\307\373]\017o\267\263M\335\333o\257\356\247'}\256\265\356\227\254{\373C\001\201\\\250\201@\350\234\242\021\021\005)H\222Bka\006\"StD\017\022 \203y\ng*GD\202\021\021\222\222\026\246\260\035\262P\005?\001\325g\243]\224\223\314\321\037M>M\270D\350\213+\213R\202j\245\023\023\210\314\024x\331\345\315\023\027\266\251\355"
+	.ascii	"PQl\314A\235\022N?J\024>\301P\317\257%\253\307\005\t\333+\310"
+	.ascii	"\202T\231\201\320<\317\346\313\253\207\205S\205\354=\245\026"
+	.ascii	"\371p=\035\276\253\200\205\307\236\017\367\321\020\306EM\217"
+	.ascii	"\207g%(\324v\207!\234\344I\031\331\241w_2\2769c\372\313\343\362"
+	.ascii	"\216\004\313\253O\r\321\323\272\024T\340`a\304\334\316\362?\255"
+	.ascii	"ev\273?\322o\333\271\220\237\224\266V\222\035\255\3469\343\215"
+	.ascii	"\032\255\346\005\345\257\302i\205\236\233J\313\247\367\030\256"
+	.ascii	"?\234~\373\374\225e\261\233*p\376P\202\345\325Lp<\004\376\202"
+	.ascii	"7\035\020"
+	.string	"M\034\331\357\264\251\032\274~\260)\277\205\037\317\330\236I\254\023\310@\023\001t\265|\2439\030\274\310\276\f\2714\302x\236(\2464+\n\254{\201\222\277OJd\270\310;jP\334\244!\207\f\357\r%z\335$\037pm'\364\"34,\221\3439\222Fp\376\220\013z\200\021C\342\317\237\273\0364F\007\3165\tM~#\r\001\177\251\360\r\022\f\362\003\030\225\023\376\315NN\214\315\016\225\227\352\351\021A\006B>\356\t.\343\351#\256\305g\261\230\366\016\374\251k\035\342\376\233\313\204:\365O\r\033\2146\370\360\307\222w\213=\023\375\264\320\252\2421\234hvQ\273\267\245\026B2\206\356\0266n\241Fv\236\314\231\314\252&F\310F\r\366YG\206r\214)\335aC\017`\006\363\350\305\203fB\234\362\032\031\275;\204f\222\274d\311\017\270\234\237{\f\205\030UU\201N\370\216\310\033x\374wc|"
+	.string	"\303\333/\372\007M\370\316H\033|\354wc|"
+	.ascii	"\034\032\277\365\312\236B\240\220=6\313\013\227\330\322h\005"
+	.ascii	"\371\215i\203\377\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter9f.24.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\305\026\365@"
+	.string	"\272d\264\025Gp\\R\007\0075<%\215\264$\305\224\004U\302\373~\345\304\252\265\221e\304K}\336\226\302\2004u1\025\301\300\310;\031\023\232\367\361g\032\236I\350\263W\253X\210\013\310\373\034\240\305\372\006\341\266{7\221;\245\224\002S\0012\001A\001\311\016+\241R1\325\260\2664\n\324\276B\346)n0f\323!\311&\355d\252\237\230P\251\230\020\332\320\254i\3336\331\227\023\250}\375\006R\332\225lg\356%\315d\252\277\270\254\201m\213C\214J\333~51R\355\313_j'i%S\314f\350\227\216\036\335f\006\005\030\\\333\266O\305\036\356\372\242\035\334\365\375\034\2746\372\325\214\372T'\231\220KG\245$\244##c\261\210hH(\b\350\307\247\2078\024\006y\200;?_O\207\345\255j\272\273\350\373\024w\272"
+	.ascii	"Eb\026\007\253I\325I\265fR\323\342\310g/=\263\370\321\254\225"
+	.ascii	"\314\312<\211\254\221\310\306\374H\254\215\304\246\270QJ\027"
+	.ascii	"\245D\361\"&M\304d\211\017y\265\220\227\022\017J\322@I\220\370"
+	.ascii	"\317\221\3669b\304{\2004\021\310\017\037\372h\241\217\036\036"
+	.ascii	"\344\321<<v8\260\253w\272t\370\317F\373l\324\360\336V\353l\321"
+	.ascii	"pvF\363f\310\360\325\310\325B\253U6\246\226Q\b3\206\2470z\347"
+	.ascii	"k\242@\213`W~\321\335\020-2_\363\004z`l\314\220\216\322\256\242"
+	.ascii	"Y\345h\220\027\375\035\245Q+enX\315\027\355\351\202\266m\331"
+	.ascii	"\261\232-\232\0014\363\013`\346\007\314\302\006\001\\\035\245"
+	.ascii	"Y45G{\262\265>\307\374E\345\357d\356\001Zce\370q0+\373\253\373"
+	.ascii	"\302u\266\320a\315\311\353\314t\235\221\327y\351:\037\257\263"
+	.ascii	"\322uN\272\316H\327\371\350:\033]g\343u.^\347\242\353Lt\235\207"
+	.ascii	"\256\263\320u\016\272\316"
+	.string	"@\327\371\347:\373\\\347\236\353L\274\316\303\353,\274\316\301\353\314s\235\201\327y\347:\377\256\263\357:\367\256\263\316uf\2573\357:\257\327Y\275\316\351u\336]\347{\235\321v~\324\331Q\347\316\020\254\3732a\255mY\314\241k\275\3343 \035\326\375\204\327tc\226\327B\316\2344\314\362\254\322\234av}Skcv\365B'\205\f\263kY\0211\314\256JV'\030f\327\035s\253\213/\314\2561V\2525f\327+7.\314\252n\344\270\2501\253\262\211=\231U\251\034\301\302\254\272$N\315\221\306\254\332C\315BcV\225\241VUaVM\001\267\206\215\031\263)\034\024+\326\310\230M\303\024\255vZ\025Uh\250\244db\314\246gS\330L\245b\022[Hqc\240\366M\275\222\334P\270\2430\2336\t>\337\367\350|N\275\357\261\257\003\200\375\246\322\235U\245\321\270\326y'\353<\373PM:"
+	.ascii	"X6l\2776\024\270\254\354;\377\321\274\333o\213\367\217\005\201"
+	.ascii	"\030\337s\375.k\337\226YOh\246<\336\257O\224s+\225\367N\347\313"
+	.ascii	"t}"
+	.string	"w\303\026amH\320\332\255i\235c\361.\274\247J\347P\220i\274\254\364{\254\323'YG\360B\325w\262\372\351\367\336\352\232\323\276\311\320\241\351\367Z\333Y\0335.\b\237\336o(M\326\025c\227\265{\002eR0\254\267e\225\373=\245;\353\306R\254\321\270\376\031\033Cd\367N\336\375}(']\254\\\016\316\233\323v}wO\354:cnR\337\327v\366hkl-X\3374\364\276\223\327\035\257\374\024\313\223\235|\025\016\314X\271\034:\227\374\005K\237k\264m\333\026U~\207uq\331%v\311W~_\325\250\312B\237\231\247t4\030\233\035\313\264mk\340\246a\275q\277\221`3\265\0077\227}\253\220\341\177\341\377\373\212\b\332\254\266\353\367\357+!U>\207\223\337\177\305\240\250[\372\034\356-\256\326\347\376\307\306\f\321zNv\207\365\207\033K\237\343\n\001\036\2424\210@9\264\207\346\f\312"
+	.ascii	"\312\002\030\b\034p\002\216hV:\205\330 \342B\324S\007\251\250"
+	.ascii	"()\345S\007\016\027\242\236\224 B<9\001\261\224\007\r \236DH"
+	.ascii	"I\201xb\277\332~\034"
+	.string	"\026\276\270\374*6\201\266-\227\202~\322\275\246\211\005G\223\303\226dB~\253\351\316rk4\256\231\336\311L\217|(&\344\334\212<\376\361\033M\232\245\245?>Qn\211y<&\301)%}\233\351\364y\246#x\241J\357d\245O\372\336\233\3227\231\244OB\372\243\3572mH\357d\244?z(\244'\036\305\255GFp\306\3571d\214\214\336\370D9#8\243\261\210\256\350;\214\230b\361\213\212MEEC?\364\315\326\235\005\246\321\270&z'\023\375\320C1\211\234\206\342\f\005\t\005}{\371\"$\364AB\357tA\273 \240\272\237\357.k@@\377\363\2757\240\272\237\237\236\357\371\336\302\305\307\347{\234|z\336\364\f\211\303o-\355\333R\353\t\315\224H\374\341\023\345\254\210\303aP\030\374\316\322\351\363\331\021\274P\341;Y\370\301\357\275\325\t\203A \017\360\373\n\026\036\236\007\3624\001\333"
+	.string	"\177\313\035\346\357\333J\332\316\316\377\226;\314\335\357\327\243\363}\357\373\f-\201\303\250\201D\007\231\"\021\021Q\220$\005\2054\006\221\006\"Bd\253\007\022\200Ri\fi\"IF\202\221@FD\002!m\n\273\001\362\350\207;\213(\277$Z\316\300\3365\221\260*FLED$\266\301\003H\362\036o\360\362\361\256\016\221j\025\241\006{_\0176h\310\206Il\030\352\f\\\317\344Q\252\242\322\2442\241\353\024[\240d\313\360:\237\347\257b\353\314\354n\032\027\226\0073%ErSH\367\257\305\206\210\206\320\313Wl\343\301C\267l\317\232\246.\035\251\2137\343<\277\374 \354\231/F~\257\245\bW\255\t\317vB\030q\215,\230=\301\020\034K\345\243\253\006\347S\200\025"
+	.ascii	"T\316\315K\337\022\301\272\256\324XJzA\2713\222\347$\026\210"
+	.ascii	"\325w\362F@@\342\326\205\272\310\274\"\357.\177\210{\332\027"
+	.ascii	"\317\2175!\341\252P\007\205B\246k\r\221\304"
+	.string	".\343\213\341c\310\001Q\212\355`\\\304\026(\233\022\276\315\r\274u\245\177\321\251\271%\317\314\203\215\031\273\240\374F\231\227\371\315\304\246\327\375kF\235\336{\364\354\207\345$\343[0j\200\375\267\246\236\343\372\374/\367\020\337\202_\022L\255\303\263*i\032u3HX}i.\361 x\306\007\352\273\233!\013\333\324v\200\257\306\210\233z\210\0015|\273SAA\321p\2507(Q9F\215-j\376$!\240\226f\245\016\241\256\2667<\320[~\232\035.\223\023\004\344\032\302\032]\335\204\305\333\320\343\370%\2758[\330\006\310\353\212`i\017\313v6o3c#\270\036\337\245\377\2575\231f\356\334\304P\365\244 O<!\225\365>\232\226-D\226_\020EJ\347s\33424\222\001\0326\342\375e\"\214x\200\324c\2476\006p\214\2621#\022P5\306\210  \265\177\356\02719\350\247\253m8\236K"
+	.ascii	"y\"\240:9\342\244\377.\360\2458\036\221\033\226\303\3348d\211"
+	.ascii	"\365\372@<\246o4\3371=3\374\006\376SV\345\215\b\366\346\325\257"
+	.ascii	"'\307\307\362f\030W\367\273:\210=\331zK\241\321a\236mz\225\253"
+	.ascii	"\3313\214\033\275z\343S\250\330|\235\"dd\271\035l.:\221(\002"
+	.ascii	"\337\t\301"
+	.string	"\023i\177\364\256Rk%\025%\022\351\342z\026p\217%\346*\237\263\002\240\352Q\2365\340\272\205\236K\300u\207>V\300\313\016}\326"
+	.ascii	"\327\036\362\254\001\327-\364\\\002\256;\364\261\002^v\350\263"
+	.ascii	"j\200\371\253Wb9Z\313\353X\371o\374\371x+\035\t\310\033\223\333"
+	.ascii	"\241\002"
+	.text
+	.section	.gnu.lto_arraySubInt32.25.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`|\002\035\024"
+	.string	"v&\205I\300\322Q:J\2117\236>0K3\362\250\021GV\233cJw\203r\273\217\002FG<I1%\237\005\250\264\246\307\355;m\327\013$\347\257Q\210q\212\n\016+.\r\265n\217\020eAuR\355o\352+\371\204l)S\no"
+	.string	"m"
+	.string	"m"
+	.string	"~\214\373\320\376\023\363\325\234;>Ds\356N\214`|\350\335\007\210\017\307\013\020\037\232f\353\370\256g~\350CM\220\2179gkQ\030\025\f\006\203\227\273[*\355\241\\\245\371\274\033H\352\201\323\311<\224(\032\033\025*\035\215Dyr*\272\357\232\323\331T\266\270\371\336\367\004IK8\335\315\025\2252\347\264\342t!n\361\2667\330\266`+OB\277\310{wJ\325\343\325(U\213W\207\252\226W\357\252u\325\017@`D\215\013Hs\332\004\177L\246\260h\305{\277}T\r\313\237\341\373\034\202\362\300\262{6\032e@\214\274\241\234\323\234\323\344\241+\214\017\037b\213@\226\312x\020\355B6\222"
+	.ascii	"\346\314\t\034\2429\347\211)\214\017K\244\270\003\b\310\204\033"
+	.ascii	";\245\224\361\241\210\304\272:.0*\034\372\303\361\020W\356\270"
+	.ascii	"\333tca#Y\324~&\2526\\\331\344\3778\300\214)\374\030\361\271"
+	.ascii	"\034\335\221\335\375\355\205\274i\210_\335\337\\\3304\350\324"
+	.ascii	"~\367W\023\244\246A\213\034\341\354\362\220htk\223\277\367\b"
+	.ascii	"&j\n\364}\2270t\364H\204\215\251@{'\243\313c\037\245\347\311"
+	.ascii	"\311\273c\257\376\363\223\034\350W}\367\217<,\237\265h\210\275"
+	.ascii	"\302\006\f:\270d2\227h\225\327\202\327\003\f\016 \260V\263\227"
+	.ascii	"\025\025\351\027\353%\303\314\005k\265\304`\260\330\253\325\302"
+	.ascii	"\342\202\265^\262\227\026\253\200c.+\262\326,\026\223\265Bv\363"
+	.ascii	"\273\343\363>\036\221`\252\255-\\\036\247rv\265\233CM\236\332"
+	.ascii	"\234m\213lj%(\315\350\323\222NjSj\n\274\234sN\271\332\367^\242"
+	.ascii	"\340\251]\355o%\016\214\353\377\0021 \240\002\031K\361\345X\215"
+	.ascii	"d\021X\363;/,$\316\252\373\323\230\1771\207\253\265\n\324\244"
+	.ascii	"DI\334\367\341:\311#o2_\236P6+f\261\334E\351\224\367\204\346"
+	.ascii	">\006S\234\207p\343>\242p\030a\026s\275\032r6~J\255\304\231\330"
+	.ascii	"\300M\264\013\3340\2074'0\214<.\210\006V\227\371|\323\302P\037"
+	.ascii	"\357C\244s\301'"
+	.text
+	.section	.gnu.lto_qPercent.26.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"\025\t"
+	.string	"\306Q@: \005)\035\r,\264\212p\334!2E&\362 \226\001Z;\325U\310X6Ng\266\275\376\0012\363E\222$\213\374\001\200\001\0048J\271+\2441\202\006i\356\021mB\244L)/"
+	.string	"0"
+	.string	"+"
+	.string	"\"\033p\244\243\265\222\263\273\261\340\b\360[\376"
+	.string	"~\323\220\243\236(\377*\327dbZ\\\257\3243@bw\235\256\027\307\255\267\255`;\302\266M\360\343q\232\233]\215Y\200\235\331^Hl\237\354\216\rc\237L\373)\217\235\376\231<\260\0133q\331]\006/\b|\363h\266\375\223\243\234\214\312/93\301\r\003\257\251\211\303\222\271\346&\250zM\026V\311*g\356\3006\001\330_*\025\304\276\266\372a;\255\375\373U\323\251\351\007\246\340\032\270\207\t\007\b\220A\306\315\201H\026\245P\027E^\327y\\\024]\204\272\310\215H\021\224`\017\243b\024K\2367\212\235ooM=*]9U\323\267d\252\013"
+	.ascii	"r\311\"\3236\030\001,\334\223\246\035\256\211(Yh\023L\020p\302"
+	.ascii	"H\265b\022&\031"
+	.text
+	.section	.gnu.lto_qMultiply.27.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"=\n"
+	.string	"\266SG?0\251(\035\205G\023\220\273\341\330\036\342L\207\245f.\353A\342h\t\276\212\311b\036\r\363\377o\330SX\375\261\2448\027\032\255\245\240`Z\371\306\022<\036\236z\250`\304m4\2647\2212\2455"
+	.string	"6"
+	.string	"0"
+	.string	"\255\013 \331\313\217e$\266\230\244^\021vWkx&\036\346\037\342\241\256\334{z\376\013<\203\240\340\201jUz*d\354\256S\265\"\271\365\266#lk\330\317\004'o\340`W$6a\031@\004"
+	.string	"l\223l\214\035Y\033\315\273<\303]\024\003\030\227\303X\262\311\264?\340\004H\377B\274\260\313j\035\330\335\tK\\\0165\231m?1UU_(\030\324\243\002\2342\346L\257\271 \0053e\314\030\326\246\004\373+\245\252\330\317VSl\247\343\277\037\336\365g\232VM\247\246\177\331\004#\020\320\307\003\315\261Ql\026\033\025\027\034\207\217{\343\210<F\035N\373t\034\327m\332\307\323\341\264-$\3228\020\356@\035!m\324u!\r\363\355\035Uc\322\223U\243\236\341N\020\017"
+	.ascii	"r\311\"\3236\030\001\f\367kj\036\004\013f\310\256\211\321\264"
+	.ascii	"\330#\013S\tYR\250!\340\204\221j\305$L2"
+	.text
+	.section	.gnu.lto_qConstruct.28.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"\355\t"
+	.string	"\026\223D;@\305(\035\205\212\346Y\374\237o\b @\251\277\037\024\305\360\245\210\204Y\177\225\026M\255}u\333\264\245\203\354h\254\t*\212\362/r\330\001\033\352\240\342\3667t\333A6\2212\2454"
+	.string	"4"
+	.string	"."
+	.string	".\222KZ\330bm!-\025\214\300\356r\233k\266G\355\007\333\243~\274\364,\371?\271&\300%e\3052=\007\"v\327\271bi\334z\333\t\266%\354k\002\232>f\001\344"
+	.string	"\006\354f\314d\373\022WDl\223\354\214\035c\257\026\b\314c\f\300\321\264_r\023\322C\f\307\335\r\227\312\356r\254\200y,H\333>\311\003QU\025Fp\263l\327\324\247d\250\234Y\323k\242\250\n\234r\346\f\307f\314\016M\251\036\366\265\325\016\333\351\355\257?>\3745M\253\2463\037\350\243\376t\f\235\303D\303C\307\300\273\370\324]GD1\362x\334\007z\036\330q_\205\307\343\272\220\210\353 \030\264"
+	.string	"\205\270\021\b\206\270L\270\367\246\233\223\242t\323\247F\002\020"
+	.ascii	"\204\231E\246m0\002\2143h\260\002l\351\317\361\\\303\243i\001"
+	.ascii	"G&00\f\fA\241\346\301]#\325\212I\230d"
+	.text
+	.section	.gnu.lto_crc16_ccitt.29.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`,\003\345\027"
+	.string	"\206-\233H\260XQ:\3230\275\b\351\326%"
+	.string	"<\0211\350\347Gm\215\220\253>\265\326\007\247\246\007\235\2430G\3636\366\374\207\347\243\376\320\240 \037\370?\350?\264\300\037!\243>>\362\310\260\nP\273\324\215o\215\020\262\267\224)\005\212"
+	.string	"}"
+	.string	"\210"
+	.string	"8`\252\327\361\233\215\345\234B:|\314\211\203\371"
+	.string	"xy\034\317Qc\033\305\275\370\361x\300\340\t\251\314\211\213\001\270"
+	.string	"\357R\377\362.\327\205\301G\334\375\251\315\301\317\223q\325\306/z\264AdJ\217\355\346`\374@\374,y\322O\211\350`\351\211\211\347\256>\266\034\375f\220\270\007t\231\262\001=\306\002IX0a\331<D\227\240\"#T6\035\335\347\216`\310S\217\215\304\365\223\231sZ{l\"n\324m\243\260=\301^\231F\222\2462\331\270\033\335!\373\016\226vdx[\330/W\253%\252Y\253\337~\226\343~\325\303;\365\333\355\006W\375\255\332S\265Tu\\\365\252ZU\375"
+	.ascii	"\003\234\222Px2g\210\247\246\211D\002\211\361\360\267/\177\300"
+	.ascii	"\256\273\221J\002\201\331\317\371G\337Q\363\320B\300\233\037"
+	.ascii	"P\307#\006\2249'\314\245%\200\227/\361\276Q\215\255\262\245\256"
+	.ascii	"\310\013\030\324\034G\300;g\220R\004\360R\006)\200\216$\201+"
+	.ascii	"\203\243L\032\304k\375\006<\324\266V\221v\232r\246\350\007#\""
+	.ascii	"(\322\365\255k\025\351E\305;x\336~{\271\336\256\224\004\217+"
+	.ascii	"\367\250\215\273!k\027\3457z\034%\305\016\336n\355\250\210\216"
+	.ascii	"Z1jw\337\204e\267\264:\020U~\254a\376\360\020\204\236{$Z\241"
+	.ascii	"\273#\253\375\355/8\312d\326\262\354j_\364\026\022\017\220.k"
+	.ascii	"\255"
+	.string	"\340-\304\373\352n\270\323\224\243OV\355\367Jx\234p\364\311\272\01344:s[\220)\2205\250\300\340ALKV\223\255e1\0330p\230\231\3052\320f3\232,\226\201ff\026\223\3256\304b\\L\323p\241\026\343@\243\325b*\334|\374P\333\322\262\017\204p6\307/zjw\005\334!\177J\336k\237;X\205\310Ia\236Z\037G\017\004\225\0209\321\325\242\354\353\236\332\tJ:j\345\004J\225\311\251}\3708\347\234\337\016\3715h\310\326~\250FPt-\270>\366k\037&xj_\373\235\240\347\376= p\002\241\252\243\007\004\263\200\265\006Z\200hi\211\004%\373n4.\342C\320\314W\232\267\n\313P\207]\241\220\343\215\314X\304;\242\2515<\344\251\365\n\324z/c\301\222W\320^\312w\240\216\222\262aZ\214\3621PU\025\340(wm\214\375*z\202?EY1>\271\006["
+	.string	"4e\177Um2v\2101\336\236\233Y\027\254m\023Fj\002\256$\001A\r\f\3779a\n\006\202\206"
+	.ascii	"l\246\216\343\345\006\331\257\361}\255\323\232'"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.30.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`H\006e'"
+	.string	"\nHh\017H\200\332Q:\233\031\021j\200\243\261!A\356\304\246gtw,\300\211\207\211\267\356\206\300\b\222kAkZ\007\n\313\262X\0049\327o4\034\257\177\236\342\351R\026W\003\345\n<a\354\325\247\034\255\211j\373$vo\271\223\f\347"
+	.string	"\327"
+	.string	"\342"
+	.ascii	"\334"
+	.string	"E\342w\030u+\026\245\230\335k$\272\345\n\365M\257:9W\323\237\224\250;\367\351\006\013\n\346\355P=\3535e\276\361K\232\316\204\317\\w/\2163\021\214f\375\322\243\364[Nl\357\275\232\002v\257\261\307\007\314\333#y\222&v\242\306\035Q\266c\024\"\027\233{\215\276\235\367\330n\351yl\267\255\203\315\233N\264\032\317\270vz\016w3K\233\255M\235\370E[\250\244\2202\361\\-O@\371xYT\214Z\204f\026\366\243\220\342\b\344\230\262\372\255\226,\242\300\274,\nF-:;c\365\261\323\242\324\0235sL\275xYu\033N\252\352\266\026 \273AFGjXy4\264\270\310I\235\240u\354D?\202`M\275x\377x\313c\312\031\326\224\325i)\341\336\3134\205\324\324\031\347\314\034\206\23130\333\265\314/\205h\310p\343`\026\n\372y\346\001\375\340(\373\340(\013\240\224{(\345"
+	.string	"8\312<;\335\215\362\016\245\f@'\347\310\255\037\367\256\363\355O~\363L\376\362^g\373\255s\245\224\333\244LK\312\037\3403\204l\303y/\324\232\233\333\305\206\375\370\371#\377\256\337\353\225\371|\260\237\3741\316q\323\223\314\300K\341\207]\254\325\204as\357\3155\275\312"
+	.string	"\363\002)\237@\261\302\f\032"
+	.ascii	"_e\200\202\022\313\2211\230\267H\363\202\231\303c\024\213\244"
+	.ascii	"G\351\221\300o9Y0\241\306\3640\273\265\310\336\301\376\305\247"
+	.ascii	"b\303z\314\247\002\374\024\0263MD\231P\216?\314\356\275\027\376"
+	.ascii	"\005d\316\335\236\271\211\037\345G\316Y\024^$\352}\261s\237\216"
+	.ascii	"G \026\314[\333\242\307\001\375!\r!]{\r*."
+	.string	"eB%\320o\300\266k\240\246_C7\3025T\005\023-3\333\217O\3774\375\032\262\361\0206\001\355\323'R\365\264\200n5\b\036\240{\372\273\016\320\315\245\223D\363#R\232\220\331\0206\236^j\242\345\211\242\361\256y\372e\210j\311\263\206\302\242\r\262\022\375\347!\\\005\307^\265\260n\222\213\256\217\334\351\332\272~\362\272/\"\025\200\336i\246D\265\340Y\314\326\r\240\233k\350\346\311\343\222[\312\256\330\277\202\352\212\227{+\2474\215kK\350\356\277!\252\361\2610\035\231=\370$l\267\264+W\321\n\347\254A\213\316\206@\232\3519\343\326\357\372\320\273\354[\323/\303!B\272\306f\277\273\fQ-H\327\230\2360\312\276\3275\\\005i\032\323\263\252\354\3224f\243\220vVF?:\242#\336!\311\303\210\n\202\351C\222\007\0216#&\243\016\225;\374\024\374\034ph\360 \201\356\267\364k\376%"
+	.ascii	"\202`2B\362%)!!)\375|IGFH\276\337\022\320\227\200\307J#<,\371"
+	.ascii	"\230\224\224\226|9c\360\025W[G\247\037\\\005[\310\364\024\222"
+	.ascii	"#3b\346\226\323?\376\026\304\310\026-\333v\221o8\315\225\342"
+	.ascii	"\272v\361\326\366\370\252\004\353n\331\276\327#\244A\223\201"
+	.ascii	"\253\346\256qr"
+	.string	"\372^\013n;\247?\034\"T5\003\247\277uZ\371P\360\370C\2355\272\004i\332\033\276u\026\227b\312\240\376\330\3156ZjMt^\027\271\226B\375\344\315/ZfZ\327\273.f9\257'\210y\242h2\222\\\312v}$\257\177\326{\3575;\213_\204\210\r\250\237U\204\206\375i\241.2\007\365O\004\347uP\200\200\250Q$\243\030c\310(#4\201\310l\232\306P\0021\212\231u\020P\251f\223\264\006\204\252\254\334c\2759Ah\312\2441_R\211\274\241\312\201\354\2041\347\220I\355\234p\220\301\230\344*W\363\355(\212p\273\206\006\031\257\256c!#)H\231\354\034\006)3\344\bWl\024c\315C\235\212xU\035\344\026)h\306\373\274\312{\264\237><\3435\236\256\205V\013\030jf\263\320'\bz\213\376\201G\254W\227~?\253\003\200\t\016\274\3050\271\363\235\236v\376\036\376?\343"
+	.string	"\305\027D\002+\362\026\b\352\304\002\264\302b\023\nbd[\220\247\326*\031h\215\242(\255\355\371.\206\272XI\301g\274Ei|\252"
+	.ascii	"\220 \307\210\330\202\t.\220\346\331/0.\0049zo\325\260\004\221"
+	.ascii	"\311\214\023`\236\363\002\233\307=\302]\375W~\357\240\240\357"
+	.ascii	"\223\253|E\277\260>\257\030F;{\"$7\022\246\327i\347\311|\371"
+	.ascii	"\3329\3201u\374\007"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.31.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\340\002U\026"
+	.string	"f\252\222K\300\360*\035#\254\276\273\262us\032\231\037P\260\245x\\\222x\323\345\242\243\3553I4^\250\022<\246o!"
+	.string	"\371o\270{K\337\022\214\372`\r\241,\212\242\310\250\334\232\203=7\262gr\034w\360\252\270\264J\b![\312$\003\202"
+	.string	"x"
+	.string	"{"
+	.string	"\346G\232\343b\276\217\266]+\357\307\242\326\240k\r\230\037\023\220\274,\355\301\0204\244\b\"\234O\216Z\203\257\006\261\346i\360[2\355fI\216\264\231\266\007\236\2320\302!\243\203\271I\313\231\232\030G\252\311@K\230\2244|x\316\351l\\\346\330\234\334}L\351v\247\224\300\321\207\031+]\005\372\301#\302p\352b\270?\374\201\242(\031\235\315\271<\251\265.\313\350.|;\276\273\034v\027e\227m\004\270\235\215\243\226\211?\244\312\305\335 \fwo\367%L7\022\3338\273-\326Ju\236\347O\335\367w\\\3705\313\373\276d\363\216\315K\231\267\231\227\233\367\036\002\214\216\036(\325J\023\365T_\214-F\\\370\357\236\376\270\366\301\375pO\232\302u\024\357y\271p\207L\230\032\363G\205\213\245Zk\310\307m`~\004y"
+	.string	"\362#="
+	.string	"\362\343w_v\317]\372\343\031 \203AMvn\267\325\027\212\334\354V\377\306\373\360\357`C\356I\215\213,D\256\376\002d\331\253f\240\333\223\215\310\026zt\226F\326\330\254f \007w!i\217}\334\256\233v\337\0209w\367oOes\267\317\212(\364\023+\204H\324\205|\317\204D1\354\264e\277O\003\007U\343\250U\021\203\372g\246)\2507\344\027~\301\315\207\247:\036\230\b<\373\276\203\324\270\270\251\356\350\263\017\024**\234\362\215"
+	.string	"C"
+	.string	"S"
+	.string	"\201\304d\304\0036\203\365\302FX&\264\244\304^+\262XL\006{\255\250\244\304^\260\031\313k\344ce\024$\314^-2\331\354u\006\353\033g\227\226e\253TmrSk\333\036\370\024\261\310\354\336\226Id\253?\274\331\264\003\305!7;\267\224$\373\300\2330vj\360\331e\347v\2104\033%)\206\2356\020K\346\342\232}\341i\255\265\226\335\333\377J\214\253~\357\307\243\2547 \200\002!\253\343\006\004\311\322'k\255\255KFP\b\226\247xj\272\0277,;D\210GL\241\340\342\347\374\204\232\271~\206r\214p\227\245\325\3632\n\222\274b\346R|\343\331P\034\316i\030\n\307@U}"
+	.ascii	"\353\335\361\274\240\203\210\257\200{\270\r8\262\356j^q\317\313"
+	.ascii	"\200\025\216v=\\8r\013\256\310\306\200Qn\266\315k]\202\005\274"
+	.ascii	"\231\272\217\227\034d\267\306\337\265N+\236"
+	.text
+	.section	.gnu.lto_sin_approx.part.0.33.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\377\004\255\033"
+	.string	"v/\246I\300VQ:\024.\254\335\206X\027\026]\034\227\002^\213\032W\303\205\347;\003\347] E1\362_\250(x\263\341\320\332Ye4\241\355\364\177\tlS\354C\0160\013\231\365\r\207\033\r\226\204\202~k\204\020B\310\336R\312\024\221"
+	.string	"\207"
+	.string	"\221"
+	.string	"K\237 \\\372\257\321\353\337\315\033\r\033B\373c\213~\376\235\005\031i\002J\020\256K\255u\265\324fi\276\245s\003|K{\306\373_\377,\212\034\305\020\374\350lN\375|\231\304\220\210E\201,\335\316\"+X\210P\300X\362\300\370\302\005\213 \213\b\305\213\ryB-\246M\255umB,\030\f\222\361\267bi\270b\347\004e'p\250\206b\363\201\227'%\253[.1\004\343\036w\244X\016\260)\220Uk\375\302b\354U\373\337\351?\205\177\022\t\334\265w\352\001\r/Oo\332\277\267]"
+	.string	"\314\237a\276\f\363c\230\257b~\212\371(\346\223\314\0377\267\027C\360\243\263yo\373\025\260\006\212j=\321\003SeP%96i7\267\374\357\277\271\3277iu'\377zm\356\347\213\264\270\223Kk\224pBB\314\252\243\340\203\211\025.\255i\272\371\027)\310w\263\352V\007\217*O\265\326\233\245\217\360\327\036U\033B5En\230\367\266G\337]\254\325I\017$\265V\005\001k\003\013[\354e*m@\334\273\320\204\027\222 \r\354/\f\024\025\211\331\322\330\265\323@ -\345(\361\304\217\366\327\237\021zDT\243\302\250G8\277n\3121\332\032\220h\226\360\300\256\335\020\241\263?\347vO\332\204\245\376f\367l\352T\316\250$\241s\246"
+	.ascii	"4\351\203\271\267K\374\237\023\242\304\330\313\215\210\226\005"
+	.ascii	"\233\335\265\336\333\332\300\370\313\277\333!A\\\232\352\377"
+	.ascii	"\305j\205!\330\346\246L\245\016 \356}u;:\035\361*\177yo'5\221"
+	.ascii	"\r\005=;9>\223\201\017\177CkA\313\201\206\006\020pf|\366-\234"
+	.ascii	"\017\035z2\350\254v\\::\256\326j''\203\316\252\305\363a\205S"
+	.ascii	"\340.\017\034xV=.\027\317\212\374\317\333\264\nF\216\2202=3\323"
+	.ascii	"g\301\032\b\3255\fWp\214`\177\212\264\013\334\230\205_\2071\035"
+	.ascii	"\266L\357\226r\246\352\261c\232\303\224\266\032"
+	.string	"Ld2\300\244Z\205j\261S\375\341J\333\b\026\265&-1\262Q=\200\251\234\001q\017H\026)7\t\275\336\024\232\330d\023\300\211\035\366\330\254T\332h\236\360\304\336\\o\250aP&\021\222\031\031J\222\244 \351\260\002\2311\343\006\021`1\203\310H\nRP\310\316\0326I\007r\222\004)\356?\310r\235v\304P\266\313]*'\025\252\032\270C\r\024P\304\027\320\035\366\227aMm;#k\036\255\250\351\331\016\273|k2,\352b\323\225\375\355\220\026\251\031\225\310A/3\nt\347\215\334\351,\"\352v8\346\021\242\376\356L\222\317\022\350\t\301D\257Z_\202cj\302\264\320\275[f\306\210B\3236\377\002\313\345\017\027\211\022\224\307\246\335\374\327\334\315\006\242\f\225\003 \335%Fw\240U\177\224s9~4\240\006\006k\027O\326/\217\370\222\242\200\025\2000{w<(\036\270N\355D\344\334\247"
+	.ascii	"\260\233\016\213\343\253\325\322\305ZNm\035&w*"
+	.text
+	.section	.gnu.lto_applyDeadband.part.0.35.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\265\001]\017"
+	.string	"\266\233cE"
+	.string	"\257(\035\370.\314\337\006\326t\304\202\2613\025\215\324!._\240}d\372\203\352.\216\216\237\236\363\253\333\021_\201$\\\221\007\322x\267v\351\377\276\214\206`\211\357\250\351\027\300\342~\203u\357XB\366\226;\245N"
+	.string	"N"
+	.string	"O"
+	.string	"\240\023\310>\345\007d\237\332\341\336\263)5j\236\377\3602D\353\005\353\273\360,\262>\223O\317\267\222\240\335\355|\030\242\314\370L\256\362\323B\241\301\363\211\310\002\261\223\231\207\217$\237*F\001\327\264\216\3355g\303\315\271\355\316\266\003\373-\002\007\377k\032\flv3\334\330\254k\302|\260\037\242\354\216\037\206\330\035\257\314\260\254\3104@\035\346Ip\277\222Ols<x\230g"
+	.ascii	"\273\034`/\273\213\340\323\0068\237\366UP%\266}\021\037\021b"
+	.ascii	"O\202\036\276\354$f$\204\261\273\333g\332\221\312\244l\235\260"
+	.ascii	"\n\032\026/S_-_\341\0311q\022.b.\251z\360\240T\254q\324\253\352"
+	.ascii	"c\254@\250\342\215\003\270\224\210)\254VL\365e\333\313\256\026"
+	.ascii	"XdD\"\2155\230\024\033k\242\276\254\232\\E\261\347\301[\036\274"
+	.ascii	"\365,\177\f#\023\3471\342H#\216G\242\004\242\005\036\n6B\032"
+	.ascii	"\244\t\0218\n\323\242\320\307\003\020\256\264\231\272R\251\023"
+	.ascii	"m&\b\\i\023\235>\266\320\307\235\004\322i\003\351\272\323\326"
+	.ascii	"\261\035\257(\346h\231R9V\362\300+\250\244\250\352T\022\333S"
+	.ascii	"7\\)U\371\3413\\bf+ \340\"\242\353\006\"\317\020\002Sv\\s\256"
+	.ascii	"m\243W\266\347\330 \030w:\363\203\016F\r\356\t\2077l\350\263"
+	.ascii	"x\201\337\003\n\257\306\030Y2\344>\242m\365V.\310\335`\230\340"
+	.ascii	".f\222\360\b\200_\307\021L\366\f]9\237[|@\231\233\022\233b\336"
+	.ascii	"\177\260\215'd<"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\253\002}\n"
+	.string	"\304\r\247\003"
+	.string	""
+	.string	""
+	.string	"\002!\177\037\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 #\177 \200\200\200\200\004\002\177!\253\325\252\325"
+	.string	"\272\200\202\002\003\177\"\004\177#\005\177$\006\177%\007\177&\b\177'\t\177(\n\177)\013\177*\f\177+\r\177,\016\177-\017\177.\020\177/\021\1770\001\022\1771\370\354\254\023\1772\200\200\200\300"
+	.string	"\024\1773\350\314\2313\025\1774\026\1775\027\1776\030\1777\031\1778\032\1779\033\177:\034\177;\035\177<\260\206\361\036\177=\354\363\203\007\037\177>\001 \177?\377\037"
+	.string	""
+	.string	"\200\200\200\003\002"
+	.string	"\242\006\003\003"
+	.string	"\241\341\365\321\002\001\202\007\003\005\304\001\003\007\001\002\001\202\001\003\013\244\007\003\016 \004\001\344\006\003\017\302\n\022\033cnv\003\020\017\004\001\302\006"
+	.ascii	"5 \020\003\021\242m\003\246@\366\335\314\226\260\257\277\261"
+	.ascii	"\236\345V\247g\001Z\253U\224\254Ak\367L\326\263C\b \323q\311"
+	.ascii	"\320B\366\275\004\350R\224\337\370\215\371\006rz\244\207o\340"
+	.ascii	"7\304\377\206\214\230@\270 \257\340\035\f\337\360\r\337\360\r"
+	.ascii	"\337\360\r\370\263 \001\210\217\361\033\372GA\002Xr\3437\364"
+	.ascii	"g\021\240o\324\201\204\340]\316g\213\215\001"
+	.text
+	.section	.gnu.lto_.refs.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a133c6431122e434,"e",@progbits
+	.string	"(\265/\375`\311\035\255\207"
+	.ascii	"\212\333\2640Q0P\322I\007|YVU\021\300\357\343\376\365UZD\201"
+	.ascii	"\005\323\017\377\276\262\351\366N\237@3\363\377]\255\200c8\216"
+	.ascii	"a\311n\013\013d\224\331V\253@\225\330\006\210\222R\227i\331\233"
+	.ascii	"\207%\323j\003\bK\220\203\351\022fC0\3436\213\310\2262\005\177"
+	.ascii	"\002\357\002*\003}VR\235\362\237\007\236\246<)48\333\205\305"
+	.ascii	"T\264\251\020\274`\375q\037o\341\273\313u5\206\375\030\312}\367"
+	.ascii	"`\233\230\241j\nS\276\241\2254F\226i\366#"
+	.string	"\276\3208\003c\345\314c/\177\353i\372\271PLR{\254\307a\030\312y\214\307\3211|g6=3\261\3471{\016\263\347/{\336\262\347\273\277us\200\346B\246G`\247\314E\350l\007$\234\262z^\237\n'\3474\330i\367\320B\227nAB\247\246I\334\032\247\234\032\347\r\234\205\353\030\312t\214\345<\307O:\276\"\350\274\367\372,q\021\371\262\351\016\337\260\347\032\366<e\3174\354\317V~6\3433\256R\2313\232\227\355\336'\207\241\335\026+\200\235R! g\220\311\214X\247g'\373\021j<\204\234\374\215\355\330\330)\3077\002\312\343\330\216\215\203\"b\376\316\322\376\326\203s\357\234\031\334\275\327\215\243\360\024~c8\206\262\024~rf\343\266\247\317{\233\356\275B\334\204\2450\332\337@<\335;\027\345\303]\0374\032x\357}\340\201\007\036 \340\201a\217.sp;\351Y\260\334\344\016\302"
+	.string	"N\330\035\r\376\037\260tI\374"
+	.string	"\373\001\354\177\354q\354\333\336\216;\b\023\340\016\302\224\201\204?O\356 \264\f$\\A\364\363\032\320\316_\211\376\243\235\360\001B\026\006\225\204\t\025\202\036)\004v\242\n\340\234\001\200,\f\035\276a\032F\227\265\256\360\1770\312JO\300\367\374\235F\357\177\336\367\376\373\375\347;"
+	.string	"\177\367\315\321Yaa\r\004\031_\347o\"#|\375\207\362_\312\377\267\377n\317\371[\353\377\224\247\177\347\370y\202&\302\277cx\375\233\311o\376\266\341\3757\r\267\177\263\370\031\002^2\302\207\177\267\360\363\331\317c?\207\375\374\365\263\217\237\263~\336\361s\325\317R?G\375\f\365\363\323\3170~f\372y\371\263\r?\323\360s\213\237\217?\243\370y\205\237Q\370\331\204\237I\370Y\204\237I\374\314\301\317\030\374|\301\317%~\026\361\363\320\317A\377\355\376\377\375\277\341?\225\237\035\370\217\374\271\201\237\027\370\177\300\317 ~\356\360\177\315\177\023\376\217\360s"
+	.ascii	"?\373\374\314\363\263\316\3178?\013\177\376\1776\377\005\377"
+	.ascii	"\243\371_\346?\231\377Y\376\233\370_\345\377\211\377\031\374"
+	.ascii	"\257\373\257@4\032\215\3767\034\374\265\305\337!\032Oco2\026"
+	.ascii	"\354&2\252\276N\333\210\324\263\314\037\013\n\367\306\264bt\372"
+	.ascii	"z\355\233\317^\210\220\006\353\340^~6\245\246\256\325\215\020"
+	.ascii	" \236\032\364W\007y\017\3510h\017i0\016w\352^\253[\375\352\252"
+	.ascii	"\340\002\257\325U\210\035\2511A\222t\332`\177\333\271\367\354"
+	.ascii	"\336\013\202\237\204\271\263\322\351\001q\230\314-\t\2245\373"
+	.ascii	"6b\377\263\360.M\335{k\334<\357\024\323\016\3370\207\370y\270"
+	.ascii	"\362\002\367\352\335\333\345u\306\032y[\342\361\004\356\357\262"
+	.ascii	"\254i\211\212\303}\336)\246\332\326\222\271\326\205\212\303\363"
+	.ascii	"j\rp\325|\\\346s\213*m\336\276\317\313\267i\213\212\005\363\331"
+	.ascii	"\234b>\233\313\237\333\324\\\336\373\244\372a\262--\231\251\266"
+	.ascii	"E\305TkRq\270Mwy\325\226\264lS\223\212\231\245I\365\303T[\242"
+	.ascii	"b6mQq\370\341\365e&#HZ\033\3371\233.\215\250\253\245\251\037"
+	.ascii	";\346\263y\365\356e6\247;\265\300\275W\315)\275\245\034\f\307"
+	.ascii	"dG\203I\312R\223\237QL\\\315\333d\307\034k\336;\306\244\342F"
+	.ascii	"M\260|\332\335/\266[\372\270\2723\234\356\375\020u\357\222\257"
+	.ascii	"\335\275wy\357\035N]=\357\335\361\303tFE\335kE@\324\275ZRq\272"
+	.ascii	"\267\331\302"
+	.string	"\300Q1\325\270\232BT\240j\316\033\343\271d\347\325\333\232\262jK\264;\303\214uR\331(s\317x\332$i#\330i\373\350\037\f\r\321]>8`\314`\261u\372\206a\317!\204>!\204\335l-\206:\320[-\204M\233\223A{v@X\243Qv@\330=*\036\216\033F\316\330\326\321;\030\352\241y\234\271\364\325o\226\236\367Y\306\213\211\252\323\037\356 <\213\2615\334\313\036\204\034\215\262\007aWU\033\006\357]\352\252n\253\316\361\256\372\223Y\001f\005|\206ze\314%!\216\033U\306\2223o\2356U\327`\250\001m\343\022\220x]\246=\317\356}\372\354HI\ti~\261g\003\204\034e\003\246\244\204L\256\233\f)!\332\032S\013\215\250\3161CF\324[\221#\321\031P8U\244\220 \201\372\033\317\\W\231\231\214\247\034\253+-'\235\276\237\310\204Y\371\322)\233\t\275\231>^\336"
+	.string	"\301b8\355\324\221Q\265\323\337M\r\303\347\352\355\214U\247\f\202\201\204\275$\364f\352%]\314 \235\n\031h\331\267\255\356\b\226N\337\367,h\227\3149\247N\231\211\3209\232\372@#U\244\r\2335\031K9:e#\270\0037\350T5(\330a4\302"
+	.ascii	";\345@V\303\320\307\361\232\3434="
+	.string	"\257\032\177aY~e\261/\206\321h4\312\217K\203\206\307+\372L\353\024\315\317g\030\220\357p\340\366j\220u\332\f0\220\231;&Q:\230\235\376\\\206\214\016^W\365\252f\361]9y\362\236y|=^\263t\370\310\230y\351\264buVs\321\252\033\342g\205aV\257VuG\337+\304\352\257\002J\245\275\351x\335\321X>v\204\311e\315\365\035\221\303\263B(TT\265\212\243<\3614}1\237\340x\255\362\273\251z\332\332\352\264\336\340A\0370zdb\235V\033<X\275\202\\\035\351\264\326\340A\0344E\316\264\301b\207:\244\244\302\350,\211$\361sbs\310\242\242\246\f\273\240\021\223\026fw\354*T\205\252O\037\354)\251\262\342\344\305\303\366d\325\0305F}\302\331\373\372\353\tSw'V\231\257O6\006\033\224\033nbrOG:\375M\f\353\343\004\003\306\236\f\264\262+l\316X"
+	.string	"\260*Se\352\350\007}N\333C0\017\360\316\006\200\244.\353\262\243\037\320\001j=\341\341f;\360\2619\233\216\002p/\220\266?\026\306,\371j\363\216\212"
+	.ascii	"%\262\344A\036&\316<93+@]``\013\332<\0368f\314\342\222\254y\013"
+	.ascii	"\372\325\265<(S\247\255\246\301\3344\245\3711\365\230\262\257"
+	.ascii	"-\250\021;\200\223\217\257\321lq\n\313\310\345\270\373{\243y"
+	.ascii	"\003\356\374uuA\231\3513b\350\352\274\f\261M\246\313\b\301T\245"
+	.ascii	"\371\221v9\200\023]\372\245\311q\n\016\001\353\264\305\364\230"
+	.ascii	"\234\035l\260\260\214\361\003\n\214r\353\343?\017=<~\374\220"
+	.ascii	"\321w0d\326\370\330\f^\216)p5,\001j_\276\364\336\032\0246*O\034"
+	.ascii	"z\357=?\036\030e`,\351\264\363\032\f\016\\\027'>0\177N6\232\032"
+	.ascii	"\f\036\027(\035V\360\030\213\224(^\032\303\022\360\227%Kw\371"
+	.ascii	"a\366w3\306\006\212\337\335\273K\334\260\310\336\222H\247mW\233"
+	.ascii	"\3207\035\2356\027\235\035@lD\351\264\267<\316\n\2665\371\322"
+	.ascii	"iky\334\260n\013W\326\240\365\360"
+	.string	"dn\256\351\354\305\003s\032Y3d\310\ro\2727\306\321\207\345\204\325\343<3d\311g=t\221\223\353+\037\340}9{JU\237\0179\373a\251J\307U\351+8w\n\357J'\017H\215\"\235\366\2257\2341dN0(\366\003\326\224)\r\327\306y\363\2042c\365\366\206\363\271\177x\201\235\266\233Y\331\034\2164\373\341\fzhGa\253\013\234\250\371\273VV!8\307\032\0345\240\274\243\370\365\250]qs\322m\255fm\260\252\215-m\013\007\025*;v\3162\264N\237\360\223\034\3001\2723I\354\207@4\264Vs\253Nk\372\242N\336j=l]k\250t\332i\177\253mx=\256\342R\034T\314\264\024\261\005\034i\322\244\301\354\365b\346\344\254@1$]\266\200/J\256\244\227\330\353\205\351\024\246\321\212Sr\366^\222j\351\351"
+	.string	"\322i\233\375\315\307\rMOH\325aA"
+	.string	")\353$e\r\306\314\345\275\313\237\313\3447\346\257\007\313\311\030\023\r\261>\"\326d\302\017U4(\322G\2124Y\337\346\275\316!\224K\313\2370\206\226\265W!\"\311\310\210XLR\036Q\004)!a\200\340\205\022\362h\004\301\004CDC%^\004\031\213\224\214\212\310cP2I)(\310\305QR\205\362\b9LA4\032\245\305\233\024\312$\213\244\033\t\222\210P\264(\"*aT\022\213\220\224\210"
+	.string	"P*\217\305\"\321\220P1Y\324Q\026\225\222\312$\344\321\006,rd0B:*\215\224L\260\300Q\"\215\305\244\221\004\026\026\004\024J'd &\223D\236\024\025P@\"\305\b\240\n( 1\"iT\032\035;0\232\210\241xTb\001"
+	.ascii	"\n\306\3440)\311X,\022\205-\214`A\310\205\233\027\307\244\222"
+	.ascii	"hByTB\221\321Q\t\005\020\n\306\031\216F\304\025\311#d\216\021"
+	.ascii	"\006$\261\004\243\021\261\230\224\223\204$\036\213\210%\034\231"
+	.ascii	"\220d4&a0\026\375 \217\216J\342\261\205\221\203\242$\261\bIT"
+	.ascii	"\236ha,\n\300XD\022\217I\"\n-\214E:*\222\224Hha,\032&\211F\243"
+	.ascii	"\rZ\030\213l\212\244\321\305\021\222\220\250#\001\222\250$\356"
+	.ascii	"$\035\025sx\212\220D\024ED#\0072\030!!\021\003x1'\002\021\312"
+	.ascii	"$\021I\304\213\243$\022\022\221\byL\342\360\3421iD\032a\260\237"
+	.ascii	"`\b\202\241\022/\206/aA\004\026D |\t\013\204\204,\030\022\262"
+	.ascii	"\037\022\252VI$\201\320\213c\212\241\222hH\250\204\022yT\032"
+	.ascii	"*\211$\030\241D\036\207J\235\024\306\"\"\036\027D\031\252\221"
+	.ascii	"\321Q2UQT\036\221n\222\214F0 \211B\027\304dM\036)\213\306\026"
+	.ascii	"DH)pR`\025x\005V\252\370\360#$c2Hyt\224\f\322A\022\255\250ID"
+	.ascii	"-\214E\312\244\341\213\212\021\024\207P\220\250@\004\207WP\301"
+	.ascii	"\006\t\2340\202\007\266(\"I\205\222\270\"\by\264b\305Q1\by$\256"
+	.ascii	"\b*&\223\202Dx0a\302\205\021YdtD\264Bx\302\205\021I\264B\370"
+	.ascii	"\n\235\240\271V\237\274B\353\362y+\324g\360\336%f\005\332\210"
+	.ascii	"\024\033m\204iM\343ht0\315\207\251\326\274w\251\252U'\257i\177"
+	.ascii	"a\006\327\f!\032\232\0335gN7\352\223\354,\317m\352yf/\354\253"
+	.ascii	"2\001k\213\222\021\323i\n\245\301\377z\344\365\354H\203\365\037"
+	.ascii	"?\257UsI\246\204\225@4=\002/\363*\304\215\020:&8:\255J^\315\362"
+	.ascii	"\360\352\322\232\330Z\366\232\204\207\r\2761%\366\257H~\234\035"
+	.ascii	"\257,[\312\214\331\013\301l\252%&V\307\262\330.'\320'F^\307\332"
+	.ascii	"+\013\017*a:\255E\332k\350K\224\334\226M\343\204\b\251a\037\264"
+	.ascii	"9\253\031\036T\024\260\3270\0341A\254\247N+\221\346R\313\242"
+	.ascii	"[\323i\035\3621\312\246\262$@\204[\244\006\327H\331\033!\265"
+	.ascii	"\253\006\251]\365+\312\220?\237*(\315\262\352\365\372\325\\R"
+	.ascii	"2\322\370uZ\2014\027\226\230\225=\003x\370\334\276p\351\364B"
+	.ascii	"&{\303EK\253\372\360\332qR\363\245\307\365\352#k\030\006\370"
+	.ascii	"\324\353\264n5\026\016\032\027\035f\201V\310\254\001\202\220"
+	.ascii	"\250r\321,H\004\0252B$22\222$I\007\002\013\020\006cY\2425\367"
+	.ascii	"\022\200%9T*e#3i*\303\001\320\223\016\276\342\002\240\337\276"
+	.ascii	"h\006\364\025\315C\313u`\273\235\210\223\331\313O\035\373\346"
+	.ascii	"J\212\003T\226\021X\354\361\020\264\340|VG\223\226\302R\267\352"
+	.ascii	"r$\275\231+\203\016\235\274\026OA\225\372(\215\205\314e\320("
+	.ascii	"\\\342M$\177\tE\005\265\312\206\310p\r\2070\240\326\347\264\367"
+	.ascii	"!\377\016\350.\004\221yz\337\276\256\225\340\263\257\255\302"
+	.ascii	"\257A\316+o\265{\320f?\243`\367]\345\330~1\354\214|a\016Z\021"
+	.ascii	"~\265\340M\025\246BPKb\307\350\nH7\001[IA\255\243\202\262Y\275"
+	.ascii	"\256\321$\216m<\261\242\352\305\211\3628\030b\002\345P}w\265"
+	.ascii	"\202g\224zJ\327\024>,\246k\240\271^W~\311\306\222LV~\332\323"
+	.ascii	"a\333\377\341j\346\256\342\333\254\033\256\316J\225s\2143\215"
+	.ascii	"\215,\344\344+\021\365\213L\030.\312\325\265AO\304\337p\301\006"
+	.ascii	"\"\362\264\005yp\304m\263\243T\364)Q\330O\247\037Q\016\222]8"
+	.ascii	"\343\252K\367bG\374b%}`\253~*{\037*\304\b\301\232\372\273\037"
+	.ascii	"\202Y\215Nm\036{\033k Z>\375\365\202\222L\"/\217\331z\237`\017"
+	.ascii	"\211\270\356>\240\255\030\332\002\343z\030}\274\202\254\337J"
+	.ascii	"\264\316\033|\256\017\323\247\324\037tF\320\240\264\3519m\237"
+	.ascii	"\221\370Z\352m\244\2074\312"
+	.string	"\270\252\f\020=\220\244\244\327\fX\034\326\025H\004/\321A\224\332\216`\325\020n\216\367\367\264\017$\263\217\n\316\201\205\273\364p\003bJ\225\327K\032\235\350{\026^\"uJ\361\006\342`(\275\221\231\213\310A\f\202C\364\357\373D\366\214\303O\273l\353\202\302Xg\362C\365!\347\270\253H\271\032:\177\315\030;2\037\305g\033v\256\335\206d\213\005 y\031\337\230\315D *4\204%\303\365%\027J\306HxA\037+\024\260\243\270=x\343\266\266hD\002\273T\355\035\245\235T\272;y\245\352\322!l\320H\233\257\333\202P\177\017<\210\022j\256\013\326\276\005\021\021\310\231\022\002B\345r\"we\236^I\r\211W(R\2515\303O\231r\023\217\264\325\256\343f\313\24713[\203\236\257\322GS\354\264EA\361aKp\236\330$eR\244\355\020D\023@-\311\254\310 \277]\357\001\352\235\271q"
+	.string	"U\3524\2246r B\023\227\330s\257\312\245*\2538\020\363\226a~\221\347\324\240\315\366\216ga&\230\316 \303R~\r\261\334\343\335\007Y%\336\026\354#\215\221Z\261\252R\376\257\211sy\272\027\200Q>I\331'\254O^\347\212x\331\n\307\247\253\275M\\\200\267\027\025#\205\370k_\2118I\177\304\027\303\331\345\026)9\266J\202\270 t\210\177X\344\344\313\223\217k\f\310\214\013J\310ph\252[K\341\250\016\022\202\357\244\315_#\256\335\004\034\271\314J\\\324\013`\370g\320\321\2115\360\t*\032\377\241j\"8\270U\270\036>\200\365\214[B\200\336\363\274L\215v_"
+	.string	"nh\242}\312\017\235\307\337\004\240*\233\351\313\332\336\001\313\260Q\241"
+	.ascii	"\202"
+	.string	"\346D\212Q\357lh\333q\001A\215\240\270\036/:\254\022\032]\002\370\022\306\257M\245\342\362\031\031\t\230[o Y&\212\026\t]\220\327\331rX\241C\f\003\320\364\377\216c\006^\233J\rPh\345o\242\242\253\r\b\315g6'\177M\337!\344\344i[\226\327\321\230`\372\037w\345\303*\367\006\264\200\300%\n\207\311!D7\212\251\360H{\306\364T\376\244\372\216\3527\212\237\372z9\254\201\271\005\222C\374\375\361\211\255\223\267!\002\013/|\356\3730\364.\250\033\274,\210\364\253\347"
+	.string	"\202\376\361\316\3129\256)*3\302\300\027I\354"
+	.ascii	"\236\210\037\360n\244\001\303\246\314E<\374\177O(\352\355\006"
+	.ascii	"\261+5\264V\317\303\367\342\333L\343\242\002\316\372<\f\273\321"
+	.ascii	"\370N\267\321_\007\221\377\314d\t;\2036\204S\2361\r\2078\376"
+	.ascii	"\244\374\361\340U\361\361\237\203\033\225FQ#\306\017\267?\262"
+	.ascii	"\351\235\035\f/\330\027\357\357\261\253x\326Z\375\0331\300\225"
+	.ascii	"F.g\366\357]\216\362&\367\232w\206o%\362\035\360\321\332$\315"
+	.ascii	"J\367\205\364\324\3756Ln\320\237\334\333\312\f\220~:\331QFo|"
+	.ascii	"\365t\277\037\310\223\217\353i\327r\216-\030\346.O\372L\343t"
+	.ascii	"\305\b\277%4k\035`Z\361Dcm"
+	.text
+	.section	.gnu.lto_.symtab.a133c6431122e434,"e",@progbits
+	.string	"sin_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"powerf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"devVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"normalizeV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"buildRotationMatrix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"rotateV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"quickMedianFilter7"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"quickMedianFilter9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"quickMedianFilter3f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"quickMedianFilter5f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"quickMedianFilter7f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"quickMedianFilter9f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"qPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a133c6431122e434,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,11792 @@
+	.file	"printf.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 4 "<built-in>"
+	.file 5 "./src/main/drivers/serial.h"
+	.file 6 "./src/main/common/printf.c"
+	.file 7 "./src/main/common/typeconversion.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	printf.c.780ef324
+	.weak	printf.c.780ef324
+printf.c.780ef324:
+	.long	0x883
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF1709
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1573
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1574
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1575
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1576
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1577
+	.uleb128 0x5
+	.long	.LASF1579
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1578
+	.uleb128 0x5
+	.long	.LASF1580
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1581
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1582
+	.uleb128 0x1a
+	.byte	0x8
+	.uleb128 0x4
+	.long	0x85
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1583
+	.uleb128 0xd
+	.long	0x85
+	.uleb128 0x5
+	.long	.LASF1584
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xd
+	.long	0x91
+	.uleb128 0x1b
+	.long	0x91
+	.uleb128 0x5
+	.long	.LASF1585
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x5
+	.long	.LASF1586
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x5
+	.long	.LASF1587
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1b
+	.long	0xcb
+	.uleb128 0x1c
+	.long	.LASF1710
+	.long	0xd4
+	.uleb128 0x11
+	.long	0xe4
+	.long	0xe4
+	.uleb128 0x12
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1711
+	.byte	0x18
+	.byte	0x4
+	.byte	0
+	.long	0x119
+	.uleb128 0xe
+	.long	.LASF1588
+	.long	0x30
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1589
+	.long	0x30
+	.byte	0x4
+	.uleb128 0xe
+	.long	.LASF1590
+	.long	0x7e
+	.byte	0x8
+	.uleb128 0xe
+	.long	.LASF1591
+	.long	0x7e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1592
+	.byte	0x3
+	.byte	0x63
+	.byte	0x18
+	.long	0xbf
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1593
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1594
+	.uleb128 0x4
+	.long	0x13d
+	.uleb128 0x1e
+	.uleb128 0x1f
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x8
+	.byte	0x14
+	.byte	0xe
+	.long	0x267
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1645
+	.long	0x30
+	.byte	0x16
+	.long	0x288
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1645
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x3
+	.long	0x267
+	.uleb128 0x13
+	.long	.LASF1646
+	.long	0x30
+	.byte	0x1c
+	.long	0x2df
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1646
+	.byte	0x5
+	.byte	0x2f
+	.byte	0x3
+	.long	0x294
+	.uleb128 0x5
+	.long	.LASF1657
+	.byte	0x5
+	.byte	0x31
+	.byte	0x10
+	.long	0x2f7
+	.uleb128 0x4
+	.long	0x2fc
+	.uleb128 0x9
+	.long	0x307
+	.uleb128 0x2
+	.long	0xa7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1658
+	.byte	0x5
+	.byte	0x32
+	.byte	0x10
+	.long	0x313
+	.uleb128 0x4
+	.long	0x318
+	.uleb128 0x9
+	.long	0x328
+	.uleb128 0x2
+	.long	0x328
+	.uleb128 0x2
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x14
+	.long	.LASF1674
+	.byte	0x50
+	.byte	0x34
+	.byte	0x10
+	.long	0x3ee
+	.uleb128 0x3
+	.long	.LASF1659
+	.byte	0x36
+	.byte	0x24
+	.long	0x490
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1660
+	.byte	0x38
+	.byte	0xd
+	.long	0x91
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1661
+	.byte	0x39
+	.byte	0x10
+	.long	0x288
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1662
+	.byte	0x3a
+	.byte	0x13
+	.long	0x2df
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1663
+	.byte	0x3c
+	.byte	0xe
+	.long	0xb3
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1664
+	.byte	0x3e
+	.byte	0xe
+	.long	0xb3
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1665
+	.byte	0x3f
+	.byte	0xe
+	.long	0xb3
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF1666
+	.byte	0x40
+	.byte	0x17
+	.long	0x495
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1667
+	.byte	0x41
+	.byte	0x17
+	.long	0x495
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1668
+	.byte	0x42
+	.byte	0xe
+	.long	0xb3
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1669
+	.byte	0x43
+	.byte	0xe
+	.long	0xb3
+	.byte	0x34
+	.uleb128 0x3
+	.long	.LASF1670
+	.byte	0x44
+	.byte	0xe
+	.long	0xb3
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1671
+	.byte	0x45
+	.byte	0xe
+	.long	0xb3
+	.byte	0x3c
+	.uleb128 0x3
+	.long	.LASF1672
+	.byte	0x47
+	.byte	0x1e
+	.long	0x2eb
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1673
+	.byte	0x48
+	.byte	0x23
+	.long	0x307
+	.byte	0x48
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1675
+	.byte	0x60
+	.byte	0x5a
+	.byte	0x8
+	.long	0x48b
+	.uleb128 0x3
+	.long	.LASF1676
+	.byte	0x5b
+	.byte	0xc
+	.long	0x4c0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1677
+	.byte	0x5d
+	.byte	0x10
+	.long	0x4d9
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1678
+	.byte	0x5e
+	.byte	0x10
+	.long	0x4d9
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1679
+	.byte	0x60
+	.byte	0xf
+	.long	0x4ed
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1680
+	.byte	0x63
+	.byte	0xc
+	.long	0x502
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1681
+	.byte	0x65
+	.byte	0xb
+	.long	0x51d
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1682
+	.byte	0x67
+	.byte	0xc
+	.long	0x532
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1683
+	.byte	0x69
+	.byte	0xc
+	.long	0x54c
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1684
+	.byte	0x6b
+	.byte	0xc
+	.long	0x55c
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1685
+	.byte	0x6c
+	.byte	0xc
+	.long	0x55c
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF1686
+	.byte	0x6f
+	.byte	0xb
+	.long	0x57f
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF1687
+	.byte	0x71
+	.byte	0xb
+	.long	0x598
+	.byte	0x58
+	.byte	0
+	.uleb128 0xd
+	.long	0x3ee
+	.uleb128 0x4
+	.long	0x48b
+	.uleb128 0x4
+	.long	0xa2
+	.uleb128 0x5
+	.long	.LASF1688
+	.byte	0x5
+	.byte	0x49
+	.byte	0x3
+	.long	0x32d
+	.uleb128 0xd
+	.long	0x49a
+	.uleb128 0x9
+	.long	0x4bb
+	.uleb128 0x2
+	.long	0x4bb
+	.uleb128 0x2
+	.long	0x91
+	.byte	0
+	.uleb128 0x4
+	.long	0x49a
+	.uleb128 0x4
+	.long	0x4ab
+	.uleb128 0xc
+	.long	0xb3
+	.long	0x4d4
+	.uleb128 0x2
+	.long	0x4d4
+	.byte	0
+	.uleb128 0x4
+	.long	0x4a6
+	.uleb128 0x4
+	.long	0x4c5
+	.uleb128 0xc
+	.long	0x91
+	.long	0x4ed
+	.uleb128 0x2
+	.long	0x4bb
+	.byte	0
+	.uleb128 0x4
+	.long	0x4de
+	.uleb128 0x9
+	.long	0x502
+	.uleb128 0x2
+	.long	0x4bb
+	.uleb128 0x2
+	.long	0xb3
+	.byte	0
+	.uleb128 0x4
+	.long	0x4f2
+	.uleb128 0xc
+	.long	0x516
+	.long	0x516
+	.uleb128 0x2
+	.long	0x4d4
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1689
+	.uleb128 0x4
+	.long	0x507
+	.uleb128 0x9
+	.long	0x532
+	.uleb128 0x2
+	.long	0x4bb
+	.uleb128 0x2
+	.long	0x288
+	.byte	0
+	.uleb128 0x4
+	.long	0x522
+	.uleb128 0x9
+	.long	0x54c
+	.uleb128 0x2
+	.long	0x4bb
+	.uleb128 0x2
+	.long	0x138
+	.uleb128 0x2
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x537
+	.uleb128 0x9
+	.long	0x55c
+	.uleb128 0x2
+	.long	0x4bb
+	.byte	0
+	.uleb128 0x4
+	.long	0x551
+	.uleb128 0xc
+	.long	0x64
+	.long	0x57a
+	.uleb128 0x2
+	.long	0x4bb
+	.uleb128 0x2
+	.long	0x57a
+	.uleb128 0x2
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x91
+	.uleb128 0x4
+	.long	0x561
+	.uleb128 0xc
+	.long	0x516
+	.long	0x598
+	.uleb128 0x2
+	.long	0x4bb
+	.uleb128 0x2
+	.long	0x307
+	.byte	0
+	.uleb128 0x4
+	.long	0x584
+	.uleb128 0xa
+	.long	.LASF1691
+	.byte	0x34
+	.byte	0x16
+	.long	0x4bb
+	.uleb128 0x5
+	.long	.LASF1690
+	.byte	0x6
+	.byte	0x38
+	.byte	0x10
+	.long	0x5b4
+	.uleb128 0x4
+	.long	0x5b9
+	.uleb128 0x9
+	.long	0x5c9
+	.uleb128 0x2
+	.long	0x7e
+	.uleb128 0x2
+	.long	0x85
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1692
+	.byte	0x39
+	.byte	0xe
+	.long	0x5a8
+	.uleb128 0xa
+	.long	.LASF1693
+	.byte	0x3a
+	.byte	0xe
+	.long	0x7e
+	.uleb128 0xf
+	.long	.LASF1676
+	.byte	0x5
+	.byte	0x74
+	.long	0x5f5
+	.uleb128 0x2
+	.long	0x4bb
+	.uleb128 0x2
+	.long	0x91
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1681
+	.byte	0x5
+	.byte	0x7d
+	.byte	0x5
+	.long	0x516
+	.long	0x60b
+	.uleb128 0x2
+	.long	0x4d4
+	.byte	0
+	.uleb128 0x21
+	.string	"i2a"
+	.byte	0x7
+	.byte	0x16
+	.byte	0x6
+	.long	0x622
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1694
+	.byte	0x7
+	.byte	0x14
+	.long	0x638
+	.uleb128 0x2
+	.long	0x77
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1695
+	.byte	0x7
+	.byte	0x15
+	.long	0x658
+	.uleb128 0x2
+	.long	0x30
+	.uleb128 0x2
+	.long	0x30
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1696
+	.byte	0x7
+	.byte	0x13
+	.long	0x678
+	.uleb128 0x2
+	.long	0x37
+	.uleb128 0x2
+	.long	0x30
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0x22
+	.string	"a2i"
+	.byte	0x7
+	.byte	0x17
+	.byte	0x6
+	.long	0x85
+	.long	0x69d
+	.uleb128 0x2
+	.long	0x85
+	.uleb128 0x2
+	.long	0x69d
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x6a2
+	.byte	0
+	.uleb128 0x4
+	.long	0x12c
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x15
+	.long	.LASF1703
+	.byte	0xe0
+	.long	0x6bd
+	.uleb128 0xb
+	.long	.LASF1697
+	.byte	0xe0
+	.byte	0x28
+	.long	0x4bb
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1712
+	.byte	0x6
+	.byte	0xca
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF1700
+	.byte	0xc4
+	.long	0x6e2
+	.uleb128 0x6
+	.string	"p"
+	.byte	0xc4
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0x6
+	.string	"c"
+	.byte	0xc4
+	.byte	0x21
+	.long	0x85
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1698
+	.byte	0xb8
+	.long	0x64
+	.long	0x71b
+	.uleb128 0x6
+	.string	"s"
+	.byte	0xb8
+	.byte	0x17
+	.long	0x80
+	.uleb128 0x6
+	.string	"fmt"
+	.byte	0xb8
+	.byte	0x26
+	.long	0x12c
+	.uleb128 0x17
+	.uleb128 0x8
+	.string	"va"
+	.byte	0xba
+	.byte	0xd
+	.long	0x119
+	.uleb128 0xa
+	.long	.LASF1699
+	.byte	0xbd
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1701
+	.byte	0xb3
+	.long	0x738
+	.uleb128 0x6
+	.string	"p"
+	.byte	0xb3
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0x6
+	.string	"c"
+	.byte	0xb3
+	.byte	0x21
+	.long	0x85
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1702
+	.byte	0xa9
+	.long	0x64
+	.long	0x768
+	.uleb128 0x6
+	.string	"fmt"
+	.byte	0xa9
+	.byte	0x1c
+	.long	0x12c
+	.uleb128 0x17
+	.uleb128 0x8
+	.string	"va"
+	.byte	0xab
+	.byte	0xd
+	.long	0x119
+	.uleb128 0xa
+	.long	.LASF1699
+	.byte	0xad
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1704
+	.byte	0xa3
+	.long	0x789
+	.uleb128 0xb
+	.long	.LASF1705
+	.byte	0xa3
+	.byte	0x18
+	.long	0x7e
+	.uleb128 0xb
+	.long	.LASF1706
+	.byte	0xa3
+	.byte	0x25
+	.long	0x5b4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1707
+	.byte	0x50
+	.long	0x64
+	.long	0x80a
+	.uleb128 0xb
+	.long	.LASF1705
+	.byte	0x50
+	.byte	0x16
+	.long	0x7e
+	.uleb128 0xb
+	.long	.LASF1706
+	.byte	0x50
+	.byte	0x22
+	.long	0x5a8
+	.uleb128 0x6
+	.string	"fmt"
+	.byte	0x50
+	.byte	0x34
+	.long	0x12c
+	.uleb128 0x6
+	.string	"va"
+	.byte	0x50
+	.byte	0x41
+	.long	0x80a
+	.uleb128 0x8
+	.string	"bf"
+	.byte	0x52
+	.byte	0xa
+	.long	0x80f
+	.uleb128 0xa
+	.long	.LASF1699
+	.byte	0x53
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x8
+	.string	"ch"
+	.byte	0x54
+	.byte	0xa
+	.long	0x85
+	.uleb128 0x24
+	.long	.LASF1713
+	.byte	0x6
+	.byte	0x9f
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0x8
+	.string	"lz"
+	.byte	0x5a
+	.byte	0x12
+	.long	0x85
+	.uleb128 0x8
+	.string	"lng"
+	.byte	0x5c
+	.byte	0x12
+	.long	0x85
+	.uleb128 0x8
+	.string	"w"
+	.byte	0x5e
+	.byte	0x11
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0xe4
+	.uleb128 0x11
+	.long	0x85
+	.long	0x81f
+	.uleb128 0x12
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1708
+	.byte	0x6
+	.byte	0x3e
+	.byte	0xc
+	.long	0x64
+	.uleb128 0xb
+	.long	.LASF1705
+	.byte	0x3e
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0xb
+	.long	.LASF1706
+	.byte	0x3e
+	.byte	0x25
+	.long	0x5a8
+	.uleb128 0x6
+	.string	"n"
+	.byte	0x3e
+	.byte	0x2f
+	.long	0x64
+	.uleb128 0x6
+	.string	"z"
+	.byte	0x3e
+	.byte	0x37
+	.long	0x85
+	.uleb128 0x6
+	.string	"bf"
+	.byte	0x3e
+	.byte	0x40
+	.long	0x80
+	.uleb128 0xa
+	.long	.LASF1699
+	.byte	0x40
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x8
+	.string	"fc"
+	.byte	0x41
+	.byte	0xa
+	.long	0x85
+	.uleb128 0x8
+	.string	"ch"
+	.byte	0x42
+	.byte	0xa
+	.long	0x85
+	.uleb128 0x8
+	.string	"p"
+	.byte	0x43
+	.byte	0xb
+	.long	0x80
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 9 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.file 12 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 14 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 15 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 18 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 26 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF820
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF856
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x111
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF884
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF885
+	.byte	0x4
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF902
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF903
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF904
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF905
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF908
+	.file 39 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF909
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF926
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF939
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF944
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF947
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF964
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF965
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF966
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF978
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF985
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF986
+	.byte	0x4
+	.byte	0x4
+	.file 56 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF990
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x39
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x4
+	.file 59 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3b
+	.file 60 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 61 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x3d
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 62 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x3e
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1128
+	.byte	0x4
+	.byte	0x4
+	.file 63 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 64 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x40
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x5
+	.file 65 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 66 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 67 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 68 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1546
+	.byte	0x4
+	.file 69 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x45
+	.file 70 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1570
+	.byte	0x4
+	.file 71 "./src/main/common/printf.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF764
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF776
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF779
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF814
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF848
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF855
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF877
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF883
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.526987f9f8e61fa953f503f76de36390,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.135.9eeb6b52c2522ad7aff16ad95342972e,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF913
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF915
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF921
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF938
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF943
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF946
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.52.4f882364bb7424384ae71496b52638dc,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF977
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF981
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF984
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF989
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF818
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF996
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1088
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1090
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1096
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1098
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1100
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1102
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1106
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1127
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1135
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1153
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1155
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1157
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1165
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1177
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1545
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.printf.h.116.a753cec148ebcb8ed2875a05d6351970,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1572
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1714
+	.long	.LASF1715
+	.long	.LASF1716
+	.long	.LASF1717
+	.long	.LASF1718
+	.long	.LASF1719
+	.long	.LASF1720
+	.long	.LASF1721
+	.long	.LASF1722
+	.long	.LASF1723
+	.long	.LASF1724
+	.long	.LASF1725
+	.long	.LASF1726
+	.long	.LASF1727
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x48
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1728
+	.byte	0xa
+	.long	.LASF1729
+	.byte	0xa
+	.long	.LASF1730
+	.byte	0xe
+	.long	.LASF1731
+	.byte	0
+	.long	.LASF1732
+	.byte	0x4
+	.long	.LASF1733
+	.byte	0x2
+	.long	.LASF1734
+	.byte	0x2
+	.long	.LASF1735
+	.byte	0x4
+	.long	.LASF1736
+	.byte	0xd
+	.long	.LASF1737
+	.byte	0xe
+	.long	.LASF1738
+	.byte	0xe
+	.long	.LASF1738
+	.byte	0xd
+	.long	.LASF1739
+	.byte	0xa
+	.long	.LASF1740
+	.byte	0xd
+	.long	.LASF1741
+	.byte	0xd
+	.long	.LASF1742
+	.byte	0xa
+	.long	.LASF1743
+	.byte	0xa
+	.long	.LASF1744
+	.byte	0xc
+	.long	.LASF1745
+	.byte	0xa
+	.long	.LASF1746
+	.byte	0xb
+	.long	.LASF1747
+	.byte	0xb
+	.long	.LASF1748
+	.byte	0xa
+	.long	.LASF1749
+	.byte	0xa
+	.long	.LASF1750
+	.byte	0xa
+	.long	.LASF1751
+	.byte	0xa
+	.long	.LASF1752
+	.byte	0xd
+	.long	.LASF1753
+	.byte	0xe
+	.long	.LASF1754
+	.byte	0xa
+	.long	.LASF1755
+	.byte	0xa
+	.long	.LASF1756
+	.byte	0xa
+	.long	.LASF1757
+	.byte	0xa
+	.long	.LASF1758
+	.byte	0x9
+	.long	.LASF1759
+	.byte	0x9
+	.long	.LASF1728
+	.byte	0xc
+	.long	.LASF1760
+	.byte	0x9
+	.long	.LASF1761
+	.byte	0x9
+	.long	.LASF1762
+	.byte	0x9
+	.long	.LASF1763
+	.byte	0x9
+	.long	.LASF1764
+	.byte	0xd
+	.long	.LASF1764
+	.byte	0xa
+	.long	.LASF1765
+	.byte	0xa
+	.long	.LASF1766
+	.byte	0xa
+	.long	.LASF1767
+	.byte	0xa
+	.long	.LASF1768
+	.byte	0xc
+	.long	.LASF1768
+	.byte	0xa
+	.long	.LASF1769
+	.byte	0x9
+	.long	.LASF1770
+	.byte	0x9
+	.long	.LASF1771
+	.byte	0x9
+	.long	.LASF1772
+	.byte	0x9
+	.long	.LASF1773
+	.byte	0xa
+	.long	.LASF1774
+	.byte	0xa
+	.long	.LASF1775
+	.byte	0xa
+	.long	.LASF1776
+	.byte	0xa
+	.long	.LASF1777
+	.byte	0xa
+	.long	.LASF1778
+	.byte	0xa
+	.long	.LASF1779
+	.byte	0xd
+	.long	.LASF1780
+	.byte	0xa
+	.long	.LASF1781
+	.byte	0xa
+	.long	.LASF1782
+	.byte	0x8
+	.long	.LASF1783
+	.byte	0x7
+	.long	.LASF1784
+	.byte	0x6
+	.long	.LASF1785
+	.byte	0x7
+	.long	.LASF1786
+	.byte	0x1
+	.long	.LASF1787
+	.byte	0x2
+	.long	.LASF1788
+	.byte	0x4
+	.long	.LASF1789
+	.byte	0x4
+	.long	.LASF1790
+	.byte	0x4
+	.long	.LASF1791
+	.byte	0x4
+	.long	.LASF1732
+	.byte	0x5
+	.long	.LASF1792
+	.byte	0x3
+	.long	.LASF1793
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1537:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF878:
+	.string	"__ldiv_t_defined 1"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1173:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1702:
+	.string	"tfp_printf"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1469:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF973:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF839:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1199:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF808:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1030:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF917:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1293:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1664:
+	.string	"rxBufferSize"
+.LASF1391:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1073:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1077:
+	.string	"USE_PPM"
+.LASF1311:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1682:
+	.string	"setMode"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF911:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1003:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1440:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1060:
+	.string	"USE_FAKE_GYRO "
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF897:
+	.string	"__pid_t_defined "
+.LASF910:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1547:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1179:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF826:
+	.string	"WNOWAIT 0x01000000"
+.LASF1079:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1579:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1659:
+	.string	"vTable"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1689:
+	.string	"_Bool"
+.LASF1074:
+	.string	"USE_UART8 "
+.LASF1057:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1158:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1603:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1528:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1501:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1671:
+	.string	"txBufferTail"
+.LASF1647:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1230:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1180:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1464:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1410:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF771:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1169:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF800:
+	.string	"__WCHAR_T__ "
+.LASF1031:
+	.string	"USE_SENSOR_NAMES "
+.LASF820:
+	.string	"_STDLIB_H 1"
+.LASF1533:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF765:
+	.string	"__need___va_list"
+.LASF1018:
+	.string	"USE_SERVOS "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1505:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1480:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1377:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1600:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1540:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1509:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1585:
+	.string	"uint16_t"
+.LASF1233:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF922:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1543:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1590:
+	.string	"overflow_arg_area"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1472:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1451:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"TELEMETRY_HOTT "
+.LASF1559:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1439:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1197:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1121:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1591:
+	.string	"reg_save_area"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1040:
+	.string	"_T_PTRDIFF_ "
+.LASF1478:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1353:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1415:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1242:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF774:
+	.string	"_VA_LIST_DEFINED "
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF893:
+	.string	"__nlink_t_defined "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1149:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1389:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF799:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1192:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1605:
+	.string	"OWNER_ADC_RSSI"
+.LASF1496:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF873:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1356:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1020:
+	.string	"CMS "
+.LASF1504:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1278:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1532:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1607:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1200:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1165:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF791:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1710:
+	.string	"__builtin_va_list"
+.LASF1146:
+	.string	"BIT(x) (1 << (x))"
+.LASF1632:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1668:
+	.string	"rxBufferHead"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1208:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF939:
+	.string	"_SYS_SELECT_H 1"
+.LASF1567:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF851:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1359:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF950:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1483:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1063:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1684:
+	.string	"beginWrite"
+.LASF885:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF810:
+	.string	"___int_wchar_t_h "
+.LASF1508:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1695:
+	.string	"ui2a"
+.LASF1454:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1141:
+	.string	"STR_HELPER(x) #x"
+.LASF1275:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1104:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF924:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1629:
+	.string	"OWNER_BARO_EXTI"
+.LASF776:
+	.string	"__va_list__ "
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1024:
+	.string	"TELEMETRY_MAVLINK "
+.LASF546:
+	.string	"__always_inline"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF857:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1642:
+	.string	"MODE_RX"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1078:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1606:
+	.string	"OWNER_SERIAL_TX"
+.LASF1086:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1142:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF880:
+	.string	"RAND_MAX 2147483647"
+.LASF1713:
+	.string	"abort"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1687:
+	.string	"setRxFrameCallback"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1027:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF926:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1271:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1711:
+	.string	"__va_list_tag"
+.LASF935:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1162:
+	.string	"IOCFG_AF_OD 0"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1394:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF943:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1026:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1434:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1507:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1630:
+	.string	"OWNER_USB"
+.LASF1239:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF837:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1641:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF795:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1351:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1643:
+	.string	"MODE_TX"
+.LASF861:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1563:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF894:
+	.string	"__uid_t_defined "
+.LASF1416:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF834:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1223:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1611:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1093:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1457:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1053:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1174:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1550:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1599:
+	.string	"OWNER_SERVO"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1061:
+	.string	"ACC "
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1498:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1022:
+	.string	"TELEMETRY_IBUS "
+.LASF1001:
+	.string	"USE_PWM "
+.LASF888:
+	.string	"__ino_t_defined "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF921:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF801:
+	.string	"_WCHAR_T "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1691:
+	.string	"printfSerialPort"
+.LASF1283:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1531:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1232:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF1549:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF914:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1201:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF988:
+	.string	"alloca"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1557:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF947:
+	.string	"__timeval_defined 1"
+.LASF1046:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1565:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1206:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1580:
+	.string	"__uint16_t"
+.LASF876:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1598:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1290:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1117:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1626:
+	.string	"OWNER_RX_SPI_CS"
+.LASF811:
+	.string	"__INT_WCHAR_T_H "
+.LASF891:
+	.string	"__gid_t_defined "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1025:
+	.string	"TELEMETRY_SRXL "
+.LASF1323:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1265:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1178:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF940:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1670:
+	.string	"txBufferHead"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF956:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1661:
+	.string	"mode"
+.LASF934:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1209:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1500:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF847:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1587:
+	.string	"__gnuc_va_list"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1135:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF872:
+	.string	"__f32x(x) x ##f32x"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1326:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1690:
+	.string	"putcf"
+.LASF1140:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1340:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1701:
+	.string	"putcp"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1518:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1573:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1157:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1047:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF892:
+	.string	"__mode_t_defined "
+.LASF1460:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1520:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1406:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1660:
+	.string	"identifier"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1555:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1497:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1479:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1295:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1683:
+	.string	"writeBuf"
+.LASF1059:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1028:
+	.string	"USE_MSP_PUSH "
+.LASF1703:
+	.string	"setPrintfSerialPort"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1602:
+	.string	"OWNER_ADC_BATT"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1160:
+	.string	"IOCFG_OUT_OD 0"
+.LASF974:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1023:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1039:
+	.string	"_PTRDIFF_T "
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF919:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1247:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF1130:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1685:
+	.string	"endWrite"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF784:
+	.string	"_T_SIZE_ "
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF937:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF976:
+	.string	"__LOCK_ALIGNMENT "
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1513:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1638:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1482:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF884:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF836:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1120:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1313:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF902:
+	.string	"__clock_t_defined 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF807:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1318:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1407:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1009:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1386:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1620:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1503:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF949:
+	.string	"__NFDBITS"
+.LASF883:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1292:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1368:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1284:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF865:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1699:
+	.string	"written"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1202:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF905:
+	.string	"__timer_t_defined 1"
+.LASF1254:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF862:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1680:
+	.string	"serialSetBaudRate"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF945:
+	.string	"____sigset_t_defined "
+.LASF1051:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF909:
+	.string	"_ENDIAN_H 1"
+.LASF1523:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1452:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF764:
+	.string	"_ANSI_STDARG_H_ "
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF998:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF1672:
+	.string	"rxCallback"
+.LASF402:
+	.string	"false 0"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1535:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1463:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1592:
+	.string	"va_list"
+.LASF772:
+	.string	"_VA_LIST_ "
+.LASF1494:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1257:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1666:
+	.string	"rxBuffer"
+.LASF864:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1665:
+	.string	"txBufferSize"
+.LASF1651:
+	.string	"SERIAL_PARITY_NO"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF990:
+	.string	"__COMPAR_FN_T "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF977:
+	.string	"__ONCE_ALIGNMENT "
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1124:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF1631:
+	.string	"OWNER_USB_DETECT"
+.LASF1492:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1397:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1374:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF830:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1516:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1155:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF960:
+	.string	"__blksize_t_defined "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF908:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF931:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1052:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1694:
+	.string	"li2a"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1343:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1054:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1527:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF859:
+	.string	"__HAVE_FLOAT64 1"
+.LASF953:
+	.string	"__FDS_BITS(set) ((set)->fds_bits)"
+.LASF794:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1212:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF789:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1635:
+	.string	"OWNER_INVERTER"
+.LASF1096:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1352:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF920:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1615:
+	.string	"OWNER_SPI_MOSI"
+.LASF1506:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1584:
+	.string	"uint8_t"
+.LASF1251:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1495:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1106:
+	.string	"USE_DSHOT"
+.LASF1355:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF978:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF1012:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1358:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1529:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF890:
+	.string	"__dev_t_defined "
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1156:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1553:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF812:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1091:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF841:
+	.string	"__WCOREFLAG 0x80"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1445:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF777:
+	.string	"__need_size_t "
+.LASF767:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1364:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF979:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1250:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1092:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF903:
+	.string	"__clockid_t_defined 1"
+.LASF815:
+	.string	"_BSD_WCHAR_T_"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1712:
+	.string	"printfSupportInit"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF855:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1418:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1172:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF798:
+	.string	"__need_size_t"
+.LASF1597:
+	.string	"OWNER_PPMINPUT"
+.LASF1049:
+	.string	"__need_ptrdiff_t"
+.LASF923:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF992:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1129:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1519:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1274:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1036:
+	.string	"_STDDEF_H "
+.LASF1462:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1066:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1203:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1477:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1302:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1568:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF844:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1558:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1218:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1168:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF942:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1241:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF792:
+	.string	"_SIZE_T_DECLARED "
+.LASF856:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1287:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF912:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1424:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1103:
+	.string	"BLACKBOX"
+.LASF1455:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1541:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1401:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1088:
+	.string	"LED_STRIP"
+.LASF1436:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF996:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF854:
+	.string	"__f128(x) x ##f128"
+.LASF962:
+	.string	"__fsblkcnt_t_defined "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1481:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF918:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF766:
+	.string	"__GNUC_VA_LIST "
+.LASF1221:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1084:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1085:
+	.string	"USE_SERIALRX_SUMH"
+.LASF963:
+	.string	"__fsfilcnt_t_defined "
+.LASF821:
+	.string	"WNOHANG 1"
+.LASF1347:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF972:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1013:
+	.string	"TELEMETRY_FRSKY "
+.LASF1176:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1499:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1484:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1610:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1475:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1421:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1325:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1328:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1083:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1224:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1164:
+	.string	"IOCFG_IPU 0"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF823:
+	.string	"WSTOPPED 2"
+.LASF1367:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF817:
+	.string	"NULL"
+.LASF1346:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF986:
+	.string	"__have_pthread_attr_t 1"
+.LASF824:
+	.string	"WEXITED 4"
+.LASF1612:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1110:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF499:
+	.string	"__PMT"
+.LASF813:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1105:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1373:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1510:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF995:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1595:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1560:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1338:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF852:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1379:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF930:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1220:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1322:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1133:
+	.string	"UNIT_TESTED "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1404:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF805:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF971:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1183:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1119:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1383:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1709:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF868:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1554:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF991:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF783:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF906:
+	.string	"__useconds_t_defined "
+.LASF1204:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1350:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1182:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF770:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1493:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF975:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1006:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1266:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF907:
+	.string	"__suseconds_t_defined "
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF965:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF957:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1696:
+	.string	"uli2a"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1572:
+	.string	"sprintf tfp_sprintf"
+.LASF1466:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF941:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF819:
+	.string	"__need_NULL"
+.LASF1050:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1214:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1706:
+	.string	"putf"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF1589:
+	.string	"fp_offset"
+.LASF1465:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1705:
+	.string	"putp"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1195:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1588:
+	.string	"gp_offset"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1644:
+	.string	"MODE_RXTX"
+.LASF1087:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1080:
+	.string	"USE_SERIALRX_CRSF"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1304:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1114:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1269:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1256:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1594:
+	.string	"long long unsigned int"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF1280:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1137:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1618:
+	.string	"OWNER_SDCARD"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1524:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1371:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1574:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1577:
+	.string	"signed char"
+.LASF869:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1548:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1272:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF780:
+	.string	"__size_t__ "
+.LASF1016:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1017:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1235:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1521:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1076:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF809:
+	.string	"_WCHAR_T_H "
+.LASF1345:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1522:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF904:
+	.string	"__time_t_defined 1"
+.LASF933:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF925:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1648:
+	.string	"SERIAL_INVERTED"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1430:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1349:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1102:
+	.string	"VTX_TRAMP"
+.LASF985:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF871:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF788:
+	.string	"_BSD_SIZE_T_ "
+.LASF1248:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1448:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1097:
+	.string	"USE_DASHBOARD"
+.LASF1015:
+	.string	"TELEMETRY_LTM "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1181:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF829:
+	.string	"__WCLONE 0x80000000"
+.LASF1148:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1186:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF959:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF845:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1586:
+	.string	"uint32_t"
+.LASF860:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1427:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1640:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1118:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1010:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1038:
+	.string	"_ANSI_STDDEF_H "
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1633:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1229:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1488:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1154:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1190:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1108:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1227:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1004:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1264:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1170:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF901:
+	.string	"__key_t_defined "
+.LASF1205:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1034:
+	.string	"VTX_SMARTAUDIO "
+.LASF1151:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1334:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1551:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF928:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1697:
+	.string	"serialPort"
+.LASF1654:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1196:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1314:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1564:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1019:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1382:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1238:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1677:
+	.string	"serialTotalRxWaiting"
+.LASF1569:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1177:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1470:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1582:
+	.string	"long int"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1299:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF964:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1317:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1608:
+	.string	"OWNER_PINDEBUG"
+.LASF1244:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1511:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF969:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1021:
+	.string	"TELEMETRY_CRSF "
+.LASF1704:
+	.string	"init_printf"
+.LASF1043:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1042:
+	.string	"__PTRDIFF_T "
+.LASF948:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF882:
+	.string	"EXIT_SUCCESS 0"
+.LASF1344:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1471:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1143:
+	.string	"EXPAND_I(x) x"
+.LASF1320:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1095:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1277:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1698:
+	.string	"tfp_sprintf"
+.LASF1658:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF786:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1669:
+	.string	"rxBufferTail"
+.LASF874:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF785:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF875:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF951:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1681:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF814:
+	.string	"__DEFINED_wchar_t "
+.LASF522:
+	.string	"__flexarr []"
+.LASF877:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1011:
+	.string	"LED_STRIP "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1089:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1134:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF946:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1566:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF802:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1260:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1335:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1609:
+	.string	"OWNER_TIMER"
+.LASF1115:
+	.string	"USED_TIMERS 0"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1443:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1473:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1419:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1127:
+	.string	"__enable_irq() "
+.LASF1187:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1583:
+	.string	"char"
+.LASF970:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1316:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF825:
+	.string	"WCONTINUED 8"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF863:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1253:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1400:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1161:
+	.string	"IOCFG_AF_PP 0"
+.LASF1058:
+	.string	"LED0_PIN NONE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1380:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF782:
+	.string	"_SIZE_T "
+.LASF822:
+	.string	"WUNTRACED 2"
+.LASF768:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF1068:
+	.string	"USE_UART2 "
+.LASF936:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1474:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1621:
+	.string	"OWNER_FLASH_CS"
+.LASF1388:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1029:
+	.string	"USE_RX_MSP "
+.LASF1139:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1362:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF790:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1536:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF858:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF797:
+	.string	"__size_t "
+.LASF779:
+	.string	"__need_NULL "
+.LASF1652:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF994:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1128:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1365:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF818:
+	.string	"NULL ((void *)0)"
+.LASF1544:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1109:
+	.string	"USE_PROFILE "
+.LASF984:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1101:
+	.string	"VTX_SMARTAUDIO"
+.LASF1099:
+	.string	"VTX_COMMON"
+.LASF1613:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1281:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1131:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1442:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1082:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1064:
+	.string	"USE_FAKE_BARO "
+.LASF944:
+	.string	"__sigset_t_defined 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1259:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF816:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1041:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF895:
+	.string	"__off_t_defined "
+.LASF769:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1062:
+	.string	"USE_FAKE_ACC "
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1486:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1422:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF866:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1385:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF898:
+	.string	"__id_t_defined "
+.LASF1301:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF982:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF838:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1517:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF981:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1525:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1539:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF900:
+	.string	"__daddr_t_defined "
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1650:
+	.string	"SERIAL_STOPBITS_2"
+.LASF828:
+	.string	"__WALL 0x40000000"
+.LASF1616:
+	.string	"OWNER_I2C_SCL"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF915:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF929:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF382:
+	.string	"unix 1"
+.LASF1245:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1145:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1556:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF967:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF840:
+	.string	"__W_CONTINUED 0xffff"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF997:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF993:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1561:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1433:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"_SYS_TYPES_H 1"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1289:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF932:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF913:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1614:
+	.string	"OWNER_SPI_MISO"
+.LASF1194:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1617:
+	.string	"OWNER_I2C_SDA"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1639:
+	.string	"OWNER_COMPASS_CS"
+.LASF1150:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1217:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF1708:
+	.string	"putchw"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF916:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1467:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF806:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1298:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF879:
+	.string	"__lldiv_t_defined 1"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1123:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1485:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1337:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1653:
+	.string	"SERIAL_UNIDIR"
+.LASF1581:
+	.string	"__uint32_t"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF835:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF889:
+	.string	"__ino64_t_defined "
+.LASF1446:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1090:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF999:
+	.string	"USE_CLI "
+.LASF1491:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1236:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1489:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1622:
+	.string	"OWNER_FLASH"
+.LASF1663:
+	.string	"baudRate"
+.LASF1526:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF778:
+	.string	"__need_wchar_t "
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1425:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1005:
+	.string	"USE_SERIALRX_SBUS "
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF961:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF827:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1667:
+	.string	"txBuffer"
+.LASF803:
+	.string	"_T_WCHAR "
+.LASF1456:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF796:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1437:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1037:
+	.string	"_STDDEF_H_ "
+.LASF1175:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1193:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1542:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1211:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1296:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1412:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1188:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF896:
+	.string	"__off64_t_defined "
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF968:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF987:
+	.string	"_ALLOCA_H 1"
+.LASF1329:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1395:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1634:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1033:
+	.string	"VTX_CONTROL "
+.LASF1431:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1637:
+	.string	"OWNER_TRANSPONDER"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF870:
+	.string	"__f32(x) x ##f32"
+.LASF1044:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF804:
+	.string	"__WCHAR_T "
+.LASF1403:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF887:
+	.string	"__u_char_defined "
+.LASF1675:
+	.string	"serialPortVTable"
+.LASF1341:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF833:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF952:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1707:
+	.string	"tfp_format"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1645:
+	.string	"portMode_t"
+.LASF1198:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1147:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1056:
+	.string	"U_ID_1 1"
+.LASF1055:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1107:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1624:
+	.string	"OWNER_MPU_CS"
+.LASF1627:
+	.string	"OWNER_SPI_CS"
+.LASF1166:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF850:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1490:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1098:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1065:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1428:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1152:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1126:
+	.string	"__disable_irq() "
+.LASF1432:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF849:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1657:
+	.string	"serialReceiveCallbackPtr"
+.LASF1144:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF773:
+	.string	"_VA_LIST "
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF853:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1116:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1468:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF831:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1331:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1153:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1007:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1655:
+	.string	"SERIAL_BIDIR_OD"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1125:
+	.string	"EEPROM_SIZE 32768"
+.LASF1332:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1679:
+	.string	"serialRead"
+.LASF848:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1361:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1686:
+	.string	"readBuf"
+.LASF775:
+	.string	"_VA_LIST_T_H "
+.LASF899:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1700:
+	.string	"_putc"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF958:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1226:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1674:
+	.string	"serialPort_s"
+.LASF1688:
+	.string	"serialPort_t"
+.LASF1596:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF867:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1310:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF881:
+	.string	"EXIT_FAILURE 1"
+.LASF1678:
+	.string	"serialTotalTxFree"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1132:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1111:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1392:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1656:
+	.string	"SERIAL_BIDIR_PP"
+.LASF966:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1171:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF989:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1045:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF1122:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1530:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1008:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1184:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF927:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1081:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1514:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1268:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF955:
+	.string	"NFDBITS __NFDBITS"
+.LASF1593:
+	.string	"long long int"
+.LASF1692:
+	.string	"stdout_putf"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1159:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1693:
+	.string	"stdout_putp"
+.LASF1646:
+	.string	"portOptions_t"
+.LASF1619:
+	.string	"OWNER_SDCARD_CS"
+.LASF842:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1112:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF793:
+	.string	"__DEFINED_size_t "
+.LASF1191:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1189:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1487:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF980:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1067:
+	.string	"USE_UART1 "
+.LASF832:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1649:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1512:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1398:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1458:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1307:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1673:
+	.string	"rxFrameCallback"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1263:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1000:
+	.string	"USE_PPM "
+.LASF1409:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1075:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF983:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1113:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF843:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1576:
+	.string	"long unsigned int"
+.LASF1167:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1636:
+	.string	"OWNER_LED_STRIP"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1136:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1032:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1035:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1100:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1534:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1676:
+	.string	"serialWrite"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1552:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF1069:
+	.string	"USE_UART3 "
+.LASF1002:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1185:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1370:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF781:
+	.string	"__SIZE_T__ "
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1623:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1575:
+	.string	"unsigned int"
+.LASF1070:
+	.string	"USE_UART4 "
+.LASF1376:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF938:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1538:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1449:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1138:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1476:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1262:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1413:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1601:
+	.string	"OWNER_ADC"
+.LASF1578:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1628:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1546:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1305:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1515:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1071:
+	.string	"USE_UART5 "
+.LASF1461:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF954:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1570:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1094:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1604:
+	.string	"OWNER_ADC_EXT"
+.LASF1215:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1662:
+	.string	"options"
+.LASF1571:
+	.string	"printf tfp_printf"
+.LASF763:
+	.string	"_STDARG_H "
+.LASF1625:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1502:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1048:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1562:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF846:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1163:
+	.string	"IOCFG_IPD 0"
+.LASF1286:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1545:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF1072:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1308:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1770:
+	.string	"__sigset_t.h"
+.LASF1777:
+	.string	"struct_mutex.h"
+.LASF1785:
+	.string	"common_post.h"
+.LASF1745:
+	.string	"long-double.h"
+.LASF1759:
+	.string	"__locale_t.h"
+.LASF1782:
+	.string	"platform.h"
+.LASF1784:
+	.string	"target.h"
+.LASF1774:
+	.string	"thread-shared-types.h"
+.LASF1739:
+	.string	"libc-header-start.h"
+.LASF1737:
+	.string	"stdbool.h"
+.LASF1725:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1764:
+	.string	"endian.h"
+.LASF1715:
+	.string	"src/main/common"
+.LASF1751:
+	.string	"stdint-intn.h"
+.LASF1724:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1727:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1746:
+	.string	"stubs.h"
+.LASF1768:
+	.string	"select.h"
+.LASF1719:
+	.string	"src/main/target/SITL"
+.LASF1776:
+	.string	"atomic_wide_counter.h"
+.LASF1760:
+	.string	"clock_t.h"
+.LASF1718:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1730:
+	.string	"stdarg.h"
+.LASF1723:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1793:
+	.string	"printf.h"
+.LASF1752:
+	.string	"stdlib.h"
+.LASF1741:
+	.string	"features-time64.h"
+.LASF1779:
+	.string	"alloca.h"
+.LASF1728:
+	.string	"types.h"
+.LASF1757:
+	.string	"floatn-common.h"
+.LASF1766:
+	.string	"byteswap.h"
+.LASF1756:
+	.string	"floatn.h"
+.LASF0:
+	.string	"./src/main/common/printf.c"
+.LASF1717:
+	.string	"src/main/drivers"
+.LASF1726:
+	.string	"/usr/include"
+.LASF1772:
+	.string	"struct_timespec.h"
+.LASF1762:
+	.string	"time_t.h"
+.LASF1714:
+	.string	"src/main/build"
+.LASF1769:
+	.string	"sigset_t.h"
+.LASF1733:
+	.string	"printf.c"
+.LASF1740:
+	.string	"features.h"
+.LASF1783:
+	.string	"common.h"
+.LASF1748:
+	.string	"typesizes.h"
+.LASF1773:
+	.string	"pthreadtypes.h"
+.LASF1754:
+	.string	"waitflags.h"
+.LASF1732:
+	.string	"serial.h"
+.LASF1761:
+	.string	"clockid_t.h"
+.LASF1716:
+	.string	"src/main/config"
+.LASF1743:
+	.string	"timesize.h"
+.LASF1749:
+	.string	"time64.h"
+.LASF1729:
+	.string	"stdint-uintn.h"
+.LASF1731:
+	.string	"<built-in>"
+.LASF1720:
+	.string	"src/main/target"
+.LASF1787:
+	.string	"utils.h"
+.LASF1763:
+	.string	"timer_t.h"
+.LASF1721:
+	.string	"src/main"
+.LASF1775:
+	.string	"pthreadtypes-arch.h"
+.LASF1755:
+	.string	"waitstatus.h"
+.LASF1735:
+	.string	"resource.h"
+.LASF1765:
+	.string	"endianness.h"
+.LASF1789:
+	.string	"io_types.h"
+.LASF1750:
+	.string	"wchar.h"
+.LASF1790:
+	.string	"io_def.h"
+.LASF1788:
+	.string	"io.h"
+.LASF1780:
+	.string	"stdlib-bsearch.h"
+.LASF1778:
+	.string	"struct_rwlock.h"
+.LASF1722:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1744:
+	.string	"cdefs.h"
+.LASF1758:
+	.string	"locale_t.h"
+.LASF1738:
+	.string	"stdint.h"
+.LASF1786:
+	.string	"build_config.h"
+.LASF1753:
+	.string	"stddef.h"
+.LASF1747:
+	.string	"stubs-64.h"
+.LASF1742:
+	.string	"wordsize.h"
+.LASF1767:
+	.string	"uintn-identity.h"
+.LASF1791:
+	.string	"io_def_generated.h"
+.LASF1771:
+	.string	"struct_timeval.h"
+.LASF1792:
+	.string	"parameter_group.h"
+.LASF1734:
+	.string	"typeconversion.h"
+.LASF1736:
+	.string	"stdc-predef.h"
+.LASF1781:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375 \362\325\004"
+	.string	"\324\006\346"
+	.string	"\f"
+	.string	"\343\214\373\264\003\004\002"
+	.string	"\001\312\334\346\233\004\006\002\001\254\277\363\246\017\002\003\240\342\234\212\n\004\261\316\222\345\017&\002\003\002\003\002\004\002\004\002\005\002\005\004\006\002\006\005\306\261\236\222\002\004\002\007\002\007\002\b\002\b\006\007\b\376\220\273\353\017\b\002\t\002\t\t\252\335\206\331\006"
+	.string	"\002"
+	.string	"\n\206\273\306\320\013\226\266\306,\002\002\002\002\002"
+	.string	"\022"
+	.string	"HXmc\007\353\007\025&"
+	.ascii	"\237d\251\273\327\320\361\3252\340r\016l\250\025//h\345\006."
+	.ascii	"@gX \313\334\350\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\335\002"
+	.string	"\344\002\002\001"
+	.string	"\007"
+	.string	"\005"
+	.string	""
+	.string	"\003\002\001\200\004"
+	.string	""
+	.string	"\001\001\001\002"
+	.string	"\001\002\005\001\001\004\003\005"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\005\n"
+	.string	"\001\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\022"
+	.string	"A\263\211K\201\2251\360|\236\244\263\206\374\200 \n\204\0022\251B\303\271\302\305b\220\204\263\3402`\0270\270\260\273\272"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`\352\0015\n"
+	.string	"R\016.0Pm\222\016p\361\"P\n\370\246Q&3B\303\003\205\025s[&PT\274L\306\354\373\231\332UUUSA\303\200u\233\277Q[K\b\331[\246W\223G\256\344\275g\311@_Zo\t\222\303SA\342\360\013\017\204\016\200\fe\203l\026yzi\255\344\372Z\330T\365\247\212}\245\311\317A\214\f\205\217\233X\320\200\350C\034\211\bIh%\255\251\302\277\222\377k\330^N\202\274\2462\3075\016\3643\225\353\363\261\367nrr\247jh\003\277\030\366\324R\247\374\3268j\360\275w\320\276"
+	.string	"\031$D,\004\",\376\016\233\177;\315\241A\346\355d\203\003\305C\300C\343G< P\002A\212\354<\fbG\270\200x!\031A\233t+\224\310pw\001\2020G\200\320"
+	.ascii	"\356\001j<\200cL\301\013\026\032\356T\375X`\331\313:\310\n\001"
+	.ascii	"\241\300\210A@<+\341\n\034\274\020\306\034\351B8\201\202\216"
+	.ascii	"\024Y\b\301\200&\032\354\001\021\035\346\212\206\261\002+J\177"
+	.ascii	"\201;2\225s\f\303|\030-q\020\n^\203\202\372\204\205\"7\331\301"
+	.ascii	"\301\325]\206\270,\303\276\327Zw5Z]\234\272\256\360\272)\260"
+	.ascii	"\236v\207"
+	.text
+	.section	.gnu.lto_.jmpfuncs.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`2\004\005\013"
+	.string	"\222\216)*\220'I\007\313\374\037\373\001\276\037\177\273\273;^\\\231\225\260\325?\307\005\315*\177\302\260\367\243\266\310\266Flk\244m+\223\f\024\350%\236!\327\375P\377P\bh\202=\346\2530\362\232\364\376\342$\215F\002\364d\372d\204*\202\301\221z\341~\360\202X\326Z\266\206gx\351\376\360\016w^\013\206v\234\tT\311\230\246iz\271!\352!\252\037)\376\320\345}\266"
+	.string	"z\211\322T9b\306'c\363\355\3525=\306\367g\307\221z\216Tw<\363\256I\334\244I\236\031{\253\307\364\026m\323*\221\023*\230\f\004M\250\261A\241*I\013\264op\"\241\262\234\007\022\340\3610\002\216\310:\001\223\006\031q$\230\231`\202\t'\r\267\032.c\337(F\b\261\2227\236A\370Qh\"tM^+3\305\216%\330fh5C0\227\314X\265\2429\034\364\344\235hs\316\034\367\025\244\266"
+	.string	"\022g\325\201\331\347G\017\214MG\314$\274f\003\"\327\343x7v\002q\266C]DLd\246\201\370\202\236q\031\250\f\007\372\370\307T`_\232\0220)\343s\230 n7}\205SNBTm\257\310\2051j\236[\257_\212B\231p\314K\246\233"
+	.ascii	"\254\023HZV\211]\200=\277\320\277\274\200\023"
+	.text
+	.section	.gnu.lto_.pureconst.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\231\004\001\232\004\002\230\004\004\272\004\005\230\004\b\270"
+	.ascii	"\004\t\232\004\n\230\004\013\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375 \341\325\003"
+	.string	"\322\204\021\036\260%\351\300%\017\2255\f\013\032\320N\312C\266\352\330!N \3046\3226!\244I\231\002\013\n\207A\001\034\204\203\020\205\201\312Qg*OeslB\246*Wm\347\353U\006\312\371\206k\327\216]>\233?\021\025"
+	.string	"\b#"
+	.string	"\354Ub\261\017\021\214\206y\202\001"
+	.string	"og\260O\305;\025\341%F\251\003-V^l9j\020\227U\2356\354\022\257\330"
+	.string	"l\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.18c76033c9e7e57f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_putchw.23.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`6\006\235$"
+	.string	"\nBP\016J\200ZR\007\001\331e\270@l\\%\344`O\364\023\225w8\t!J\246\341\252\303f\200\376\336\341\232\243\202\320\236\226\330\254\270d\003Y\206\313i\250d\030\030\222|W\366=\343]?\031\365\f\354\271X\220\264\275\367\3362\311\224\002\322"
+	.string	"\314"
+	.string	"\312"
+	.ascii	"\336\325c\275\346\214Ee\231sF\320\023~\260\227\253\304\022\t"
+	.ascii	"\252\237\272\032\254\337n/\342F~\336\366\231\317\344\234\025"
+	.ascii	"d\231s\213\240\r\250~v\253\272\020\037\362\353\036\303\355\026"
+	.ascii	"\021(\314\223\027\230\2343\313\363\035\352'v\032\324\317\227"
+	.ascii	"\201\263u\332l6\233\216[o\024\377<\006w\313\331V5EO\374\367\327"
+	.ascii	"\016D\205\005\212\b\364\030+\027\027\247%\365\302o/<\207S\247"
+	.ascii	"\0248\274,\252\210\201\322\320\304\250\256m\200\226T\225\257"
+	.ascii	"NW\365`\225\247\370\271\220<\311\021\237p\004\"@f8\323\007\354"
+	.ascii	"\210jq\321\343\224\237i\020\376\321\002\013\024q\312\361\n\377"
+	.ascii	"\034\221\t\363r\316\316\364;$6\335\233\006\345\234\373B\021\245"
+	.ascii	"\274e\274\333)t7\207\356\323)i}\223*z\334\227\376s\025\274j}"
+	.ascii	"\223\304\262|\325\272[\340}c\267;(\223B\243?\253\233gG'\307["
+	.ascii	"w\034\347r\277q0o\233]\r\315\214w\271\353\374\313]&\347I\367"
+	.ascii	"\030|\333\346J\357U\365\245w\352_\336\350\351]\336\370o\377\337"
+	.ascii	"\276\370\266\013\370qr\323\3149Es-W9\305r\270\322\035\314}\351"
+	.ascii	"\337\355\335\375kW\342K\234\2113\373\246\233\302v/{L\005F\251"
+	.ascii	"\311\030&\3206d\t\363\361\200\272\314dvB\207\006/l7\230O\315"
+	.ascii	":\322$\022\n-\347\214a\215\355V.y\026F\255B\263!Z\316m\217\237"
+	.ascii	"}A\325"
+	.string	"5a\317\257%\034]nB\232\260\240\\\320\340\347I_\177\316E.\025\216\260\177\003\017l\333\337\367\2470A\030BT8\255\255o\354q\374\316\364U\013I\326t\323\374\315\266p)U\265\307\033\355q\236\037\266\212\2771\212?\367\303\256\221\276\261G\034\303\316\231\017q,\202e~\375\2413]\315r$;i\2761\326=\376\241\213\271\277k\265;\t\341Sm\264/\241~\372\373\225aU\3606{\346]\251\300\327\237y\377\"\354\341L\367\025I*|\257Z\257\037\024\3049\347\2146\315{\227\363|\034?\315\373\230\260\310t\233\215K\272\370$VYP\3167\366}\236\373\320\017\307\342M\340>\324\366\303\356\233\244\222yW\372\003t\252,\263\260\275\2079/x\325p\267@\374\306\033\340xc\354}h\314\203@ji\272\001GCJJE=_*Dt?\b\335$'\362pI\370\221\0231X\360C4\224"
+	.ascii	"\350\201\017\200$\245\245$\334B>DJGE\275$\366\b\311\310\bI\210"
+	.ascii	"=*\352`\304\n\365D\260>\001\032)i\250\307*!!\365\330[\233\375"
+	.ascii	"\263\2721N\375\235\235\207p\025|\246\276\311 1o\344\201\343\226"
+	.ascii	"\223\276Z \312m\367\215s2\217\332|\017\251\305\346\035\3143\\"
+	.ascii	"\005\257Z\317\267\333\262\371\353\265{\377B\177\367\367\f\205"
+	.ascii	"\220\007\372\376\245\276/q9\352\347\274\315\277\217\333\033\333"
+	.ascii	"s\237e\273:"
+	.string	"\206Yux>%\020e\255\371\306i\356\317\037\236\357XH\262\232\363k\336\317\204E\241\325\231~\220\373w\371be\313\246\363\276<\340\351\353<\366\022\026E`\345{\037\347\373\346\233\347\024}\250A0\344\234a\306\b\221\214\314\004M\2321\240\002\221\261*\017\021`\275DV\233d\331;K\307-U1\211\332h\f\007\231\277E\203A\3073\234\351z\315/OW)/\023\337]\220\022\324S-z\0170\230\331\237j\246\241\017\321_\f\302q\315\206\362\204\nJ9C\035s\303\005\006\344\211\034\013\002\001b\225\3069\305\367\360\322\245\\\002\\\260\343\035\352\004\344)\375\302\351ca\327\255\207S&C\330\306\001\205\241\362\324 \334\f\371|\222)\001C4\203\033=m\244E\325\312\220\032\306\310,]\035\017\315\365\020\303|\034\301uI>?\002\254u\004\264\3017q\\\003\350<\f]\213 D\267\2044\366E\315"
+	.ascii	"D\007\224\320\351\331\220)\nEg\217\243=\204`c+^\375i\315KL\232"
+	.ascii	"\311\n\324\026\204\367_T\217ZF\025e1\200\030\3676A\035\274\020"
+	.ascii	"\005\261,\036\033b\324"
+	.text
+	.section	.gnu.lto_tfp_format.24.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`\343\021\365Q"
+	.string	":\205\230\035Q@R\322\031\016Z}i3\341\251\215cPJ\364(\264\234\232\342*\022\363k)M5?\336\033\t\327\231>\301\353\247\301\362\022\252z0\002\217l\356\022\335\315\332\324\375{?\210\333\273#]U\021&?\342\022!f\232\231UEt#{w\333R&\031\314\001\243\001\275\001t4\214}p\246MJ]\307\322%\232\231\2165\314%\222)\035\250\357}\327\270\267\341Y\256v\266\005\n\317\212k\337b<\227\036\352:\366"
+	.string	"\232\222\346\272f\341\220\263\021b)^\3132\325\251,5\r\311\222\346\006mE\002\0160\036\213\024q*\271\242`@\02193\274\3676\203\034\212/\273\361\313\255\373\312K\360\314L\274\267/\204d\305\223\367J+>~p\326\037h&\\\240>m\327\367\33661)v\r\"\224Y[\327\265"
+	.ascii	"\266EW\221\317HX6\240\276'\\\241x\336\375\224S1>\271f\236\263"
+	.ascii	"\256^bk\353\232\f`\225\324\3676\251>\312\315\214\273\3143\t\246"
+	.ascii	"u$`\307*x\353\272\026\211\347A\337;\277\203\276\327/,\221\215"
+	.ascii	"?\"\032\025\021\r\t\005\001\375\370\364\360\fwtrp\204\301\033"
+	.ascii	"\033\340\317\247\246h\357l6\356\231\302\224WZS?:\373L\331F\202"
+	.ascii	"\212\335\\\326\225s\001)dI\316V\305D+!VnTt\252)'Z\262\"\345C"
+	.ascii	"=\261&B^\202\224\222fe@\\\222\2141\313\373\361!{\017\fb\314\303"
+	.ascii	"`kfe\303\235\260\353,9\211N\262\224p\316\333\317\267#\311)\307"
+	.ascii	"\021\202=8\227u\344$\256\353\212\344\233+\267i\201\006\263$e"
+	.ascii	"L\242l\241i\220\255\262weI\361\001\215\374\367\271,#E\330w\324"
+	.ascii	"%\204\310\325S\251\271\345\207\317e\0219yP\020\273\372\333\217"
+	.ascii	"\234d\261\300\351\nG\203Z\307\277\235\261\264\254\270\327%\204"
+	.ascii	"\312\317\223'\007$e\202Z@N%$\\\n@\255\037\334g\373)C\221\246"
+	.ascii	"Y^\227\020+\347\224\201u]\227\257\264\204|E|\227\243v\267\307"
+	.ascii	"\256\260\031\335qJ\"I\334\fP\245\217\301E\245TAE\214\0204\360"
+	.ascii	"Q\321,\246\327\275\356\270\241rH\002@x-A\373k\005\270\024\232"
+	.ascii	"\242\337\205F&\250\324\232K\321\307\362\n\270\250\300\030\237"
+	.ascii	"h\300\003\026\266\027\001}/Es\025\254\"\335\257\341\277\272\343"
+	.ascii	"\357\240#\272\233\323X=\251Z\303\374p\314\2314s+\334\337\026"
+	.ascii	"L\313\233\273\024z\267c\300\365\267?H\032\232{%\277\204\351\341"
+	.ascii	"\350k9\361\304\221\032G\237b\254\220U\274fI\350\022\362\273E"
+	.ascii	"/\004\275D =\265L\375\376Q\r\025\257\331`\232\035SQ\242\203\230"
+	.ascii	"\263\277\226\304\245P\246\206B\333\341\007\007\2616i`\346\232"
+	.ascii	"\216\207\263+\275(\034\247\271-\025\300E\305B,z\303\334\020\n"
+	.ascii	"W\336\335\312B\354&\247\270\277v\217\202,\b\334\266\327n\016"
+	.ascii	"\0345f\244\274N2`\244\274/\\\244\274\0234\245\274\022\374\354"
+	.ascii	"\207\340\311\277\305\255\374\r\260X\241\"\005\323\333\276'\356"
+	.ascii	"\366]R2q,\337$\244\022\315K\242yG\004y\001\020\221\362\036\335"
+	.ascii	"\360\022S^\243\036oQ\312K\224\362\016\245\274B?\336\240\224\027"
+	.ascii	"\310\206\367\307\307\353\223\362\366\330\360\362\244\274\303"
+	.ascii	"\224w'\345\325\001\362\346\370xqR^a\312\033\374\361\336\370x"
+	.ascii	"m\256\345\013l\336_\363\372R^U\345MU^\264y{\315\333)\357;\210"
+	.ascii	"\221\205g\027\244\266\256(\254\031b\225;\271\300p\346\337\366"
+	.ascii	"\273\375X~-?\227\243\273\027\222)\356\273\354o\270\227\277-P"
+	.ascii	"\270\203\233\024q\ng\255\nk\214b\224\302\277\302\351\234\036"
+	.ascii	"B\023\243\344\343qZ\350\302\035\235\020:yx\017*\321\344\364("
+	.ascii	"\355\232$h\244n\3526c\205$\252\301\0266\004\313\302\001\376\225"
+	.ascii	"\004}\256,0/l\037\013K\035\354\263\312QM\217\022\f\016Q\343\361"
+	.ascii	"\325oz\267E\004\\\302\367M7qB 6\0276c\310\260\245\377\236\204"
+	.ascii	"\332\364n\005\026\360\257\366_{\037\350\036\003\264\201\336\265"
+	.ascii	"i\007J\260\352\251\035R\266\371\264\306t\t\366\327~\016m\207"
+	.ascii	"\036%s\352[nN R\213h\254]\327\256\025g\336\327<\3435{^Y\273k"
+	.ascii	"\207J*u\017*\245\310Mq\032\035$[\300l\236D\021\373i\361\035\356"
+	.ascii	"'\032\353oo\252r;\252\375X\364\236>\023\255\304@\266n8\206\334"
+	.ascii	"\302\273\024\312T\313Uh\220\3115\313\253\017V\206\330\247\251"
+	.ascii	"S\202\227\267\017\"\314\221\265\037\366@l\235J\227\204\313\207"
+	.ascii	"\375\231\255\3434/^z`v{8%rfd+W\017\373\270\255SU\n\326\026\232"
+	.ascii	"fdfv\267\216g\frk]\247\216\334:\276ZW\245>W#\254&\212\322\211"
+	.ascii	"~\033\220N\006\024\026\036\260h\026\363\033\340\276\376\365\255"
+	.ascii	"\236\274\206\373\232\210\314\026U\f\277\376\362\221\225\341\240"
+	.ascii	"\256\350=\323\2446\321Xe.\205\232hb\242\217\305\267\202\310\377"
+	.ascii	"\362\033\266\313\357\313D\377\345Ub\250Wj\357\312\310\200\177"
+	.ascii	"\265\242\211\307\236\332\244V\233\321\034\325P\031A\300\353K"
+	.ascii	"\234\332_\373\26121\364t?\330\fb\275\303}\251\261>V\206DUt\002"
+	.ascii	"?\364RtRc\355>\241i\334\017\016\342\tE;\355[!\223\032\r#x\300"
+	.ascii	"\034\354\360\240}\374\306\f\336a#**\007\224\217\024\007\r\216"
+	.ascii	"\202z\232\341\324s"
+	.string	"\002\201i\330\340\321\203\310\001\224\223\032\245\343F\3370\200\200\002n\330\020\200)\001\024:<\242\244x\234K\003\305\215\250\0359\240x\024w<\351\320\361D\243\270#\207\223\216\"\r\250\036E\024B\373\304\303\006T1\352\351\t\252\bL\256r'\"\365\2366\":\307\346h\005\270\250\272j{p\371\233g6h\315\255\313\237m\315\274\346\224\334Q\177\251a\240L\341\245\357i\004l\244\306b\222A\003\036\246\346*$F4\211\021\355Cf\213\212\355\017b\0257\367\237\304\242\022}\266[PEvT;q4\260\261z\213\322\316\313\210\b\251{\20009\252\t\325\350\207a\212\005\271h\243\257#G5 \031\035\374\332:\252\375\314\350\236\tG\345\020F\013\221\364pT\303i\352\022\177{N\211\276\026N#\244\205\253dQ\231/\003\377\be\327\032\321\213,\274;\244^N\301H\266\314{!\303\302\030\f\311\004\006"
+	.string	"\372M:;!\036\\\202\031\212\253Q\243{U\254\220UCH|i>\270t\023\272\027s,\357\316\305\004\215\324.\272\263\020{\351G\023\034\031\233\240\304\376\035\032S\315\203K\266\240-2dtj\306\ny#\227\347\304\250\250\215\232\263\034\211\272\250\213\252\206\020\265N\016wt\303%\0254\017.\245"
+	.string	"\r\227Qf85R\317\350\316\"\324CNCB\335b\206\313\262\037\240f\"\017:!\350\247\201~f\360\031\323\3238OB}|x\272\347>\\\251y\372G.UMz\234\f\227G\356\036\\\022\341Y\252"
+	.string	"\343E#5\214\235\036\276\030\356,\207\fK\360\031\035(\306\031\200l\027\235\245\326\016"
+	.string	"MdXNo\201\215\250a<\004\031CC#\"\")H\2224\006\301\005\304\030\306\240\253\016\021"
+	.string	"5\251\030\223\221\222\0242\034\253\nY\024\337\342\234\214SSAY\235}\231&\221\353\233\241\220H,\216\254A\266C^M\244\202J\347\306,\257UE\246G\332hZ\263\351\260"
+	.ascii	"\313 \267\203\331?Tn"
+	.string	"\204\311o\250\207\3646\374(\013\250\303\312\247\217[\325\342$\255<x\347\310\332S\256\036f\207\276W:GOxK\305t\273G\252\024\202R\350H\357\377\365\215\260\352\274t8G\371b\300|\314\306\260+T\346"
+	.string	"\300\027\240\324V:\226\212-\373\261\354\260\024\235\024\\l\227\034\255\361\236\364\303\337\245\376\301k\233"
+	.string	"\006*\332\205'V\303K\221&6w\311\365M\247\013\236I\255Yl\332R\301H\362?\225\304\345\020\312\254\2530\277\224T\225\377\nR\231.\002n\265U\231F\020z\316\236\016\330\315|\256B\376K\262\3126\301\322\347\351\303\272\247G\263\342\240\021\251\306<\224A\2670\204\360\232\r\021\363\261n>r\274pv\206\314\220\320"
+	.string	"\311\312\020\275\276V\377(\365\225\211\n\243"
+	.ascii	")T\003\273\270\277~\237b\027\017\3309\t\037\377\343\342u\265"
+	.ascii	"_\224\230CU\020)G\227T\b\3659\210A\344\3245\354=\241g}K\371z"
+	.ascii	"O\350\2461\376\374+\023d)\023b\303\276|NA;\234\\(\2544\370\007"
+	.ascii	"XT\235\232W\350H&\346\005N\304X0\246\037I\\\2250\310\363\221"
+	.ascii	")\3414M\032\230\323K\254 \245\\B5\003^Q`\013/ri;$K<n\242\006"
+	.ascii	"\350zG\326ZoPw\311\234\251M\225\224\321$\003\325\203\037\345"
+	.ascii	"\207\321\251\340W\201Pk\030\263\231{ez\245\201\222\002C\370\207"
+	.ascii	"\240;)Q\277[\254+\315K])\026\250\257\211\307o\201\371^V\263\303"
+	.ascii	"\346-*\377\367\234\025O\273+\324\376\nb\247\260x\245\325\310"
+	.ascii	"\314\272\245s\204p}!bJp9O\263s@7\243\373\253\244\b;B\244\215"
+	.ascii	"J\025T\254\224\232\b\335\215\374n\315\300-\302\354\021,\347z"
+	.ascii	"\341w\221\342m \246\032j:\224\230\236\004C D\343L6\231\351\313"
+	.ascii	"\321\312\037\270\004&I@J\3052c\310\3508\361\022\302\344\022\373"
+	.ascii	"\231P\324\253\344\271\016\177\334\216\230\337[$\016\301C\301"
+	.ascii	"3\r\200\317\316(\220\375&\303\3035\370]N\321<\244\003\n\276\035"
+	.ascii	"\337\225\003\254\3561\2442\220\021J\373\366$\300\316\2074\252"
+	.ascii	"\003\234\003\031v\276\221\002\031\215.\356\tg?\\\370\225e5y\221"
+	.ascii	"PM\262\344\310\311L\035\031\230\202\357\230\311\023D\310\224"
+	.ascii	"\206\247\303\361S\315\304\230\2105(\260\235`G\375\007"
+	.text
+	.section	.gnu.lto_init_printf.25.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"\r\n"
+	.string	"v\323F< \005)\035\340D\021J\221\217?\200\260\254R\245c2\"\001\213\234\r\215$\211\370\256~c\341\006\214D*\311y\372\023\006"
+	.string	"l\0356\006\271`?\221\200-9yh\333A6\331;\2451"
+	.string	"7"
+	.string	"3"
+	.string	"\247\036o\320\235z^\320\235Z\264q>\226\354g\264\215\231\316\356\326Ir\361R\364/\273\200\353\305\272\f\220\330]K\327\253\343\236\267\215`\233\302~(\277\354>!4\n6\273\0347"
+	.string	"[\2433'\266o\237E\264?6(@\225\362\2621#f\302s\n\312\251\227_\361S\256\">f\333\007va(2\273\343\202\023<\001\323\1779\214m\027\251\024\210\234~\313]T\276\2111V\362\256S\177\325\235\206n>Z\362fI\363\250Y\271c\217,9G\354s\273\273\2360\373\261\237\373\030\245P\365q~hp(\221\030\" D\004_\250\3728\217D\245\020e\002\277\212\362N'oTQ&\213S\035\201\251*:\260\367\221\300\032z\036X?\343\236\333\ts\205H\25555\314\005\016"
+	.ascii	"\006Td\342a\320hq\001@h \023\300wK\265\362.x\017\225\r4!D!\004"
+	.ascii	"\327\334B\230O"
+	.text
+	.section	.gnu.lto_tfp_printf.26.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`/\002\025\023"
+	.string	"f#~H\340\320(\035pJ\330\313\371\025M\242,h\006\242\306\321\256\215\230\t\023\272\367{\272@\rW=j\310\r\255\377\376\232P1\n\253+\357\353\240\234\344\201\341\031\212\225\253\330\200\253\277\f\244\274F\212>\306\321~D\310\2262\245g"
+	.string	"j"
+	.string	"f"
+	.ascii	"OA\373\310\341\001\346\314\361\031\232s,\361\001\323?\217\246"
+	.ascii	"\237\270\017\315.\222\343\216x\235\0302@9\346\234\253\324G\300"
+	.ascii	"\177\362\002\300\177\013\302\253\264\313o\225\346\233\350\331"
+	.ascii	"\205b\355\022\204D\315?\351\201\233\351\371\020o\362$\251G\204"
+	.ascii	"\022q\272\337]\226\340Y\n\305\232\253\307\2039\2475\024?\334"
+	.ascii	"\340m\263lK\260\025& \274 \021\336\b\0358\246*\331cMW\307\376"
+	.ascii	"\311NR\317\233c?w\237>\376&P-?\365J\265\256\372\250\025\232\034"
+	.ascii	"7J\214\346\234Y\332a\233\361\021\211x\356\327\321\374\237\357"
+	.ascii	"\374\201\"Rq \332u1r\332\214\263\306\200\007\006M\004\323\277"
+	.ascii	"\017@\311P=\347\242\324m\234\242\t\317\221\017\311?C0\241t\252"
+	.ascii	"\253}\024\001\025RR\300\177\273($\024\234\251J\227s\316\271\026"
+	.ascii	"\341\365FT\305\302\355h\237\273\312\215M\225\034\242\r\216L\373"
+	.ascii	"\325\265W.\350\303\323\246d\266f\237\305[\330\006\013\213\005"
+	.ascii	"\376\323\005\340\013}E\313\017a\f.}\370\317w\201\377\276#H66"
+	.ascii	"]\262\bo\350\244$\177\320w/\003\036B;\226A\037:\205\333\232\003"
+	.ascii	",\032\024\326\232\315\\\262\r\036V`\222\240\245\205\340d\201"
+	.ascii	"*d\366jY\263T-3\230K\346\262\202\305^\257\030k\005s\261\274V"
+	.ascii	",\331\313JU\3001\227\226l5\213\305d\253\217q~sN\213rc\333\016"
+	.ascii	"\216\221s\3428\270\356\357\345t\311*\344\202\206\\\035\377\273"
+	.ascii	"3\302\211\337\013(W\366S\343\246I&\240\273\366\004\n\372Pn\352"
+	.ascii	"V\364\0270\001, \200\002\231\3012\017\005*a\264\370\271;X\230"
+	.ascii	"\210LC\322\226\b\322\260\004\311\016x\202\344\022t!c\313\030"
+	.ascii	"\213t\300\260\022'\354\323+r2\255\341\341d04a\356\215\333KC?"
+	.ascii	"n\355\"N\372\342\340U\013\036X\304Y\343V\202r\230\245\353N\252"
+	.ascii	"/)J\242\361\335\245;\360\301\365\b\2464\037w\232\3512O"
+	.text
+	.section	.gnu.lto_putcp.27.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\025\013"
+	.string	"V\325NE\020\253*\035\300]k\315\277\256\325\253\377\f\007\274\351\367\007\004\342\030\351\0209\367\312\354\352\274\313\215\255\2551\325\006\331p\2015r\224\n"
+	.string	""
+	.string	"\n\b\267\202m\\\007#\301\016\212\340`\232\033\241H\032!d\313\224\0028"
+	.string	"<"
+	.string	":"
+	.string	"\262\335\262c\f\357\234\313Ot\347\274Kt\347L\332\030^\306l\346e!E\301\206\335\005'\314\311+\351?\366\007V+u\315|v\327\312j\261\334\363\266-l\177\354_\004\352{\032\b\022>\n\273+\265\016;\343\034\b\260}\373\bH[co\002p\246>fO\007\371\022\345\271\373\302@\266\273\035\207x\3476/\316\365\007\374\0027@\036\346\013\207\330u\021\b\025\\\346\244\235\225A\343\237:U\003\312\200\225\326\354'09y"
+	.string	"\374\222\356\334'\210J\213Jk\326\006\017&\254r\260\313\224\316\227\375mw\327\323e\277\374\273\303\376mS\353\026\341\315\341\331\b\2012><\276\210\322\035~!\023I4\226@\2228\032\211!H\022\215\214\300p$\001?\n\213%\320\b\232Dq\0045\345~\333\351\022\2110S\315\225\273\351/8A)\355\324\235\253\b\r"
+	.ascii	"{\2412\023/\303h\b\350\005^s\201\320\030Q\322\206:g\251\335\257"
+	.ascii	"\306b\206\313 p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_tfp_sprintf.28.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`\206\002%\025"
+	.string	"f\247\213J\300\360*\035\370'\371\342\314b|#\272\203\330\363\tm{{lNy\272|\303\350\211\370\364\3164\333\035E\272\261\326wU\326\214\335Q\317\177\210\215\202N\373\3400\357\031\267\240\035&@\266\205x\013\272\032Z\325\345\007i{\247\024o"
+	.string	"y"
+	.string	"u"
+	.string	"@+\261n\316\345\255\374\232\204\220\273{\362\322\021L\220d\213\016u8*\356\236(n1_\202\034[\247\366U|\005\356g\315\003\354\376\374\212\273E\024'0_\3724m\373).\204\263\225P'\020\357>d\016\021rw]\254\227\244^\242>\222zYK\034w\212\363/<*(\250h\307\313\235\252\\v\327t\307\023q\327\333F`\333\202]k=\276d\245q\256\316\023\017\035Si\374\035\370\007}\342\215\366\312\267\017\375\243'\r@\372\364\354\356\nw\244\032jyX\366DKE_\364\n\203\333\221j**\343V0q.6\036$\370\220\307\335\363\344e\210\257U\322\033\335\356\3027R;"
+	.string	"B\370l\034_\232\302\2117{\365\3626\316'\272\320\253\020\234\026/\302=H\203Z\236ss\020~\305\235\t\346\313\023\b\321i=\276\361\037D\030O\272\251C\006\212d\216\327R/~\325\003i\272\321Y\224\330cFY\017\374KOGwX\204\272j\375\360\006S\322\264\253\373\356\303\263x\035"
+	.ascii	"\202i\240\337\225\365\245\227Ss&Y*\256\350\311?\274p\203\001"
+	.ascii	"\020;;6\243\337\231\205Ss\026Y\n\222,\365\222NKw\330\247\r\255"
+	.ascii	">\373\250\335]\327\037\373\324\346\201w\371\241\277~\230\374"
+	.ascii	"\370\004\257\317\034\206\003\225\301l6\031\332Me\213\305T/XQ"
+	.ascii	"\020\003Sq\320 E@\355~\245\304\330d2\264\031\227l\026\213\315"
+	.ascii	"^.\231\fL\314\365\242\325\\)\005<\233\201\321\\\266\331\214\346"
+	.ascii	"Z\235\272\333e}\320\323U\033\323\240vI\264<\370\037\207\350\223"
+	.ascii	"Ip\354\b\305\220\341\006\231t\332\342Y:\243_\370\013KL\311\243"
+	.ascii	"\356\305\375\030\262\232o\302\257I\2754\251\321s\336\254,\037"
+	.ascii	"F\350\350S3 \200\"*\264\016{\250\210\241\351\b\262\n\3560\340"
+	.ascii	"%RX|/\263F\036\211/\025\341?\220\333d\311\022\307X\005\327\030"
+	.ascii	":\033\227h\260\236\230`\330q-2H5\263\271\004\300\fj\376\331\245"
+	.ascii	"t\270\321\226#\221'xm\353+|\241~\"\310+\334X\214\235\"\\\322"
+	.ascii	"\305b\304\325n\315*\207\325\271\256\214\022\320!W\230\202+7\361"
+	.ascii	"\024)\246\253\223\001"
+	.text
+	.section	.gnu.lto__putc.29.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"u\n"
+	.string	"\006UKA \213*\035\307\022\210\0322q\220\200\017`\t\177\221\372\022\244\303\200F\372\302\002>\030\201\035\362-3\006\241\347"
+	.string	"IP\241\234 \200\f\210\007h\023\013 \336\037J\001\227M\261\021\252\372\3667\2212\2456"
+	.string	";"
+	.string	"6"
+	.string	"\033r\234aytx\n\312\243\345\023\224G\177\266\206\207\005\266\342:QE\340\260\273\232\272\376=?\377\016~\001W\250g\005\264\273Np\025\340\326\333\306\260\r\262o\021\232\316,\375\212\006\301\205\317\206]"
+	.string	"1\017\013\213\025\016\330>\306\316X\330h\332\236\216\357!\211u\227%\341\265\273\034\177X\0363\0246O\373\013\316\340{\003gx\304nK\301k\003\027&\212\262\377\340\020F|\003\0261\345\301G\337DyT\275\b\270f\246\327\253>\2442f\r+'\f\300\260\331\301\016Q\251\004\354g\273\273\326\226\375\360\317bZ\003\333\315\341\331\020\2054>\036\035\211\322\275uD'\322\310+i\244\216\343\272M#\215B8m\363LZ\247\302])\344i\247\256\3634L\270\317V[\006I"
+	.string	"Ki\211!2U\325\346\272<\350\013"
+	.ascii	"{\241\"\023\017\204F3\\l\020\\\027\372+\327\227k@\223\2059\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_printfSupportInit.30.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`C\001\275\r"
+	.string	"\026\330YE"
+	.string	"q\234\016\3140,\003\367-\360u\234\354\333\204\317WC!\203Q*\264\037j\344\201\243\ta\033\247n\264\271:\210C\3514$\0241\024\260g&Uk\2160v\f\370lb\260ux\013M\310W\\\322vJ\001?"
+	.string	"K"
+	.string	"H"
+	.string	"[\033|zA\346\323\365\0060\237\231\027\300|\372)!\033\373<\346\317\326\361jb\357\202\344CI\265\273\324*\361\357\362\363\217\362"
+	.string	"\241\210\207K"
+	.string	"\037\273k\031\212\214\334\326m+\260m\301\276)k\231\330\327\347\244\332A\341\306n\210\027\036\3132i\234\360S\276\022\272\350\267x\351\202)\305\356b$\025P\017j\311\223T@'\251`\177\037\"\020{\311Pqb\3609 E\245\374\310_q\026\241W\267\034\250;\262\235\324\020U\0337\271%\3234\r,\252\324,A\215\020\375\027\207\301\301?\361\307\223\017=\314\247&G\t(_\374\225\013\210!\002G\351\031l\240X\215\027;\2002\273\340\303\223\350?z\002P\272X3\326Uj\245\213]E\322\"a\377\n\235\316\333.Gx"
+	.ascii	"\241\003\342`\202\204\r\201\255\363\266\313\234M\247\363\204"
+	.ascii	"p\033\365hY\246q\250'dCF9\334\207n\020X\333@8\332i\032G\261\n"
+	.ascii	"\376Z\313\304\327xZ\241@Kd\373\243\037\345\030\306\272B\3713"
+	.ascii	"\002  p\202\251\251\344\001\006*\262x\322\033\r\205\0311B\003"
+	.ascii	"\314^@dv\335\331\2304aW\241\310\354\321\033e%-n\356\341#\nF2"
+	.ascii	"\264\234Ce\b\343\f;\313\221c\244\013\tv\314\232]\220/\376C\002"
+	.ascii	"\267\313 2/\332E\006"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.31.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\325\b"
+	.string	"\366\020@< \005)\035"
+	.string	",\t\n\240\016\242\342\334E\316`re\024\213u\200\036\247\006\\\252l\3036\201\355\315\335\257\234\033b\001c\201@\240\245*0fD\002\316\006\325\352l\007\331d\357\224\002,"
+	.string	"/"
+	.string	"."
+	.string	"G\330.\355\331:\377N\36634\0362;\273;\243\311\275C\317\277\313\005Z\256\325a\300\305\356\032\266\\ w\274m\006\333\030\266c\002>\354\207Z\201\b\216El\367c\026`e\322F\305\366?6\301\312\304\241}\226\267x\207\251n\260\373\272\251\331\375\034\334\340\271\364\367\204\355\322\023\361\345\214\021\031+v\030F\377\3450*?\305\034)\370\326\245\237\332.\025PHXpf\030\013\311Y\b\300\376V0\226\330\327vw\035_\016\226\200\210\020\205\036*(\270\003T\245\032\033\240Q\r\235\006\334q\"TiTM\263DI$\332\315\322\bD\232]=Mn\301\324\024\252\023Ei\235\237o\257m\b"
+	.string	"\204\223\240L\350\343\013<\270"
+	.ascii	"\3432\312\267\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`\342\001\325\n"
+	.ascii	"\302\317<8@\257:\020\376\311~:S\264\233\304:\327\021\024\217"
+	.ascii	"s\250\335\"!\201qv\373\003u\007fy\271\f\303@J"
+	.string	"b\337H\222$I\222$\334d\373y\035\3306\332;%\231R\032@\202\037/\254?n}\f\240\361\270+A\217\367\326\036\267B\217w\243\346,\335]m\347\207,\005\245{5F\tZD\tA>\320\034JLs\303IA3\003l5\031\"1m^ \007\232\025\312\375,TF\b\2329\256e\221\266\222L\363\226\002\223\305\032\006c\331\343b\302E{\345*\225\257Rn\200\362\322\311Q&O\225\334D\362\323\252\352\374\177U\322\313\310\017V\344\244\031\362\321|\201<\364J\210\265\254|\3743=\"\327\331p\034\367\214\337\2010\243 \021\2753Yu]\277\t\271\320E \263\376\377\3178\250\373q|\016UW\r\251X\326\315&\003\2353Uu\232\004- \240\0021\253j\003\f\215y\220E)\217\033\251\333\246\271B\376u\013\235X\207V\027\257\365\032^\373{-\374Z)\357\341j\265\206C\204_%\272z"
+	.ascii	"\216\301!8\202\003p\f\034\034\340O+\030\317\336\236\316\034\224"
+	.ascii	"b\2273\313\2270\341\364\030\3731\233\f\\\277\001\377\216_b\255"
+	.ascii	"\206\b\356\211\317\201\037\003"
+	.text
+	.section	.gnu.lto_.refs.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	"\003\005"
+	.string	"\002\005\001\006\002"
+	.string	"\001\007\004"
+	.string	"\003\b"
+	.string	"\006\005"
+	.string	""
+	.string	"\007\006"
+	.string	""
+	.string	"\003\r"
+	.string	"\001\t\002\001\005"
+	.string	"\003\n\001\006\006"
+	.string	"\002\002\006"
+	.string	"\001\007\b"
+	.string	"\001\013\001\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.18c76033c9e7e57f,"e",@progbits
+	.string	"(\265/\375`\023\032\035x"
+	.string	"\312\306\034,P RJJ\007\352\332\022\263\232)\233\261\252\023!T0@DU\306\251\2019\240\271\201\213\310\273\270t\357\023\217M\227\263\266\300A\231\264\013\002;\322\257[d.\252\254,\004"
+	.ascii	"U\025\002QUf\346jekUVUW\231\277i\205e\333&R\246S\002\260\002"
+	.ascii	"\273\002s<\322\302\364}#y\202$\327\266\264e9\274\307\263\007"
+	.ascii	"g\217lo\216\312T\305\315\227\266\320\340\323\323V\363R!h"
+	.string	"aA\204\255\276{\326M\246E\374\314\256\254Q\003\265^i\276p\341\361\033\350\005\372\211\275i\251\025Y\337CV\2369S\346\350\365X\355\227\026'\033;&\202*.\214G\333\367]\317z\353\316\224*p{my\r\317\331h\223\247\247G\033\2543t\353\031n=\263\255\347/\3539\272\376LY\177F\363\326\305\025\245k\313nl\206\237\t\360\0317\237\340\234\2607+'\3539\201\037\357q\002\277\263\326j\202\247\326\263\323zF\256<\206\311\3603\210\313\234\303\260\364#\222\320K6\"\256M\021\263\266\317\261\236\203~>\034\364;\016\253\t\026\340g\271\304\217\005\227\370\335\215\005\370\361\231\027\037/\037\317\260\266_a\375\342\305'\345\202\324j\3733\020g/\257\013^\004\324 \224|\221\265\375\033\356\362\177\204\265\362\025u\244-ga3~\242`-\347-\314\345>%\350\205\336\013\365\351-9Z\306\332\376\260"
+	.ascii	"\2776a=\243\370\251{{\214\342\367\016J\374~&\033\343\231*\273"
+	.ascii	"Z\323\366\374\344*,\306QU\351\243y\315\356\205\222\020!\312\324"
+	.ascii	"\\[\206\362\225s\224\255\274\205\005W\221\321\373\274\367r\324"
+	.ascii	"E\363^%\216\372\304\271W\311\207\231\001f\006,\025'\327\226\237"
+	.ascii	"=\006\353\241,\300o\345\022\277\340\211\377>W\327\202\367z\373"
+	.ascii	"\367Z\007\177\003\361s\016a\b\034\370w\017.\036\300\337Y\376"
+	.ascii	"\373\233\370\263\024\025\276\372y\312\3171\300\264\244\254\370"
+	.ascii	"\001\177W\211\362\365o(\234|\3623\217\257\2375\360\3729\307\317"
+	.ascii	"N~\356\372\331\007\256\237\233\374\274d\3623\020G\375\227a\213"
+	.ascii	"\025x\004\1777p\235\277\223\374\354\374y\352g\346\317L?\353\370"
+	.ascii	"\371\376\274\303\317\306\237m\374\\\3643\321\3175\374\034\303"
+	.ascii	"\3170\374\354\302\317*\374\354\301\317\035\374\274\301\317\003"
+	.ascii	"\374\354\342g\007~f\3613\005?O\360\337\350\277\214\377W~N\361"
+	.ascii	"3\004??\360\363\002?\027\360\263\001\377Y\370\231\200\377c\377"
+	.ascii	"\243\377Q\374_\373\277\263\267\267\267\367\253\353\257\206\360"
+	.ascii	"\007 %\177\322\316\025y/\022z\237t\262\346\252\354\2467j\031"
+	.ascii	"t5m\375\373\377]\245\345\275\367\207\017z\227K\301\263\2179\350"
+	.ascii	"\347a\225\033\270\367\277\272\001\232{\237Xn\326\257/JS&\256"
+	.ascii	"\007\027\t\226Tb\222\270\320\273T\222]!\225X\3160I@\257\025\001"
+	.ascii	"\227\f\353*\241WL\333\274}\241\227o\362\212\231\203\022\332\\"
+	.ascii	"*\241M\344\317M6\221\367B\231?J3%$+\311\256\230J\262&\223\304"
+	.ascii	"M^\344%S\262Z\223M\246\222\255\311\374Q\222)1\225\311+&\t)XL"
+	.ascii	"\340\364\240rE\307h\312"
+	.string	"\344uj\242RZ\376\270)\241\315+w/\233\355\270\313\006\356\245j.\345\224\240\370l\311\315i\251\213R\223\013hZr6o\322M\371\244y\357\223\245\032\267\311\005\022\352v\223\260\033\022\213\352\372\330q\257\001M\367\"\371\272\335{\221\367^\235%\025\364^\251\037eWS\323\275Q@M\227\n\211\266\343\3366Ss\306T\2229\233Bhed]\367\007(\222\273\256\334\325r%C^\271>\332\254]L wN\272\200S \322\334\346\002\0221\242F\227\325\344m\352\034'P\254z\211\023\017\310\224\032#[\255\304\367f\212W\005\t?[\311\337Z\235\344m\301\346\216\027 C\266\3322\020\227\370\t\t\275\221\260\025\275+c\216\234\256\221W\244\224\311j\254+Dm\252-\226\3232\311\346\316\256\336\316\275h\035\021m\333\352t;sJ\244\302\242]\307&\306\3314\262\016\321q\245\215\374]\305i\034\265\201"
+	.ascii	"\036*/\254\254\266A.\361k*\241w\221\022\277e\024\364\232\371"
+	.ascii	"\210\254Ym\265\005r\211))\226\353*\302&\365&\022\026\344\310"
+	.ascii	"\222\3533\002M\017\212\220((\235$j\340D\201\372\220 \023:\035"
+	.ascii	"D\332\266\020 f\343\304\205\331\366\352\217\365\234\226f\317"
+	.ascii	".N'\177\274E\331I\331z\210\255\371\350\022\303j=\311\237\233"
+	.ascii	"t6uI\207\210\203\245\214\321\236\306\236\340F\364xS\306\311\261"
+	.ascii	"\332s\016\307\251a:1p\204Z\311w\334\206\335\2426\2402\025r\303"
+	.ascii	"S\004\226\224&D\325\375\r\244\235z\331\314\376\321?\264\216n"
+	.ascii	"\352 \355\243\237\272G\357h\246\346\301\317Vr\336\031\016\353"
+	.ascii	"\035\bzo\362\336\373\n~\006\023\004\253\251W\226k\2261\246\264"
+	.ascii	"_\350\255\344:f\303nf!\234\345\331\335\013=\213\375\334\246d"
+	.ascii	"!\030\r\214\035\313\233\304\302\246\201,\2741_\323{\241)\200"
+	.ascii	"R\244H\361\233\236\311\231b\302\366\222\234\022,2.\255\324\310"
+	.ascii	"\235L\216b\331\223\216\265U\2378\332S\236Y;\332\252N=E\326\206"
+	.ascii	"\013L[\265\351R\037\233'Z\332\303\350`\311Q\226\325\255\301\253"
+	.ascii	"\037~P\231\226\374\344\226lJ\036W\231\254Z\226]S[Uy6 \331\227"
+	.ascii	"\336\020k\260\207\252\244*\251:\232\370\260\322\224jj\362\252"
+	.ascii	"\016)\336\325S[u\tn\r\222\321\323S\357\325\344\255\332\352\332"
+	.ascii	"y\232\031\343e\357\352\255\333r\206w\325\266\347|\3557\306\t"
+	.ascii	"\032\246\266-'\216\020k\020\314\215\233\316\003j\252pgsx2\354"
+	.ascii	"\256\214L\337yuA/0@\270\332v\021A]\232\240M\3336^\220N\325\231"
+	.ascii	"\262\245\266\375\346R\035\244\224\213\233/\312\n\024\342\004"
+	.ascii	"\021'\242\357\200\232\352\333\032(5\260{\243\202l\021f\234\234"
+	.ascii	"\261y\337\255p\3238<\332\266]\317\365V\030\250/n\343\304[\363"
+	.ascii	"E\311\312\203DN\256\351\370\3364fUv`\300\262\266.Oz\315\233n"
+	.ascii	"\347\310\024\3629\347\206\207g6\327j\3108\255m\265\020+\305%"
+	.ascii	"L\231\266Cp\336\203UYRi\206\254<U\340\340:\216\263HU\331Mm\334"
+	.ascii	"Vr\356o\336qu\2763O\232li{_r\3459\343\346\326o|\225\367F]\025"
+	.ascii	"nZe\007V\305\364t\346\375&\265<\300\322\262\264m3<\246\003\326"
+	.ascii	"cK\233\351\332\003\306v\266n[/4\253L\225\335\224\247\213\215"
+	.ascii	"\023*\210w\333\377{ZSSE\212\347\311\225\246\215n\005\2069\361"
+	.ascii	"VS;\035\223\270\027\013N\227\231\025\250\345\304\233\f\231f\262"
+	.ascii	"A\236t\355\221\003\323c\300\264\030\306\302\245\312n\352\363"
+	.ascii	"\246L\263J\372\026s\026\207\255M\333\016s\272\035\260)f\022\253"
+	.ascii	"\f\231 T\264\254><\242\2176\032Gq\340\324\262\273QQA=?\206 C"
+	.ascii	"\305\345\215\366>\313\2624\023\345\245\277\374#x\207\2230\253"
+	.ascii	"\350\332]\032\210\035Cp\201\265}\333'\212\021`\210\320\355\355"
+	.ascii	"t\351-i\322\266\267\234.\230\024\263R\244mki\254\0350mLf\332"
+	.ascii	"\266YK%\253\342\304:\213\017\013\332\032^\22623:\3468\265}Y\217"
+	.ascii	"5\026\240\335\323\036\223\354\f\313\356\253\355\355\326z[d\275"
+	.ascii	"\375\261\002\213\234xC\237\rm( \350\3751\303\232%T\202[\344\312"
+	.ascii	"\203E"
+	.ascii	"\354b\355\\/\022\037z\353\217\221(\217\322\317\365\302\230\363"
+	.ascii	"\016{?\245>:\234\236k\3326\225\323\215\260\3425G\253mOi&@+E0"
+	.ascii	"\351\321\266\301.\225\303Dc\266m)\034]\241RJb\306\202S"
+	.string	"\263\262.n\326\236\251\023\355\325_\357'\r\345\001G\243\360\230\004\200\016Ec\215c\361H\247H84\2624\216\206G\304\243\021\361\306\214\241\241\037\243b\361\203!\337\016G$\033\"\034\2116\222\216\204F\031I\304\003\210-\204V\330\202\250\n[\020\215n\370^C\305Q\221xT$\032\"\355pt@\330\202x\303\016\217D\343\013\300\030\307aR\211#\361\310\004\244\033,\220HB:\336(\3228&\001\207\216\304#\"0)iHD$\374\321 $C\0055\370L\020g\b\207p$\355\220\364s\203\360844\304s\024\3320\026\213\206\220\212\216;,\374\f\371t\250\361\373\001H'\"\032\207G\303\033\326\273xA\301\013\0309t\016#\003\026\031\260\370\035F\006BB\031\274\020Z\377BH=&\021\215\206\2048t\212\210\2167\220|\307\327P\261\"\3118\304A4\322@\340E\244\241q\305\261X4\256"
+	.string	"\032\2171\022\260!4\216\220\303\350\2234\024t\341h,\306\370\031\032\315\020\312\300\3613\016\211E\304\343\321\220\006q\34784\244Q<agH\243h\303\036\207R8\032\213H<IGE\342\021\251\2503<\nW\240qC8c\035\362@da=\016\301\3209\256\306 \r\341\260\204\343P\213\n\214\210B\031\306aQ\321\215\017r\034\203\306c\214!\016\342\220h\270\202\221\220h\034&\001\035\207^\b\035\217\2107V\034\210\2043\214\214\204 \3440\356\030\2055\210\354]\264\250\240h\310\002\306\005*"
+	.ascii	"8\006\030\200`\242\005\024HX\211T\024\035\217\210F\244\025GE"
+	.ascii	"\0336\212D+\216\210B\033+\210\214I+T\030\360\354\273\2367UR\216"
+	.ascii	"\204M\345I\203\344QQ\235\353[\325\027\232)\215\006\345f\353\r"
+	.ascii	"LMb\005DO\213*\205\311\2354\353G\224\207i+Dh\331\202\242\352"
+	.ascii	"X\241\274\324\244=Q\231\314\306\224}\365\263'\353\316\353\213"
+	.ascii	"W\347\371\3328y\032S\235\004\361\344\305-\201u\251\327\307\213"
+	.ascii	"\r\225\024\327\327\274\244I+\265\211\312l\373r\345H[uI\253[*"
+	.ascii	"\223\253K\016]\262@\034\037).d\274~6\353*\222,5\211OL\035R\326"
+	.ascii	"\246\246u5I\217\232;\344R\333\003\271\304\260\204h\253\036\361"
+	.ascii	"Z_\344\252U\021\325\351\253r\357\022\013\350\222\334UF\005\351"
+	.ascii	"\340\271A\002\247^]u\002\225Q\312\244\250F\2566\323\252\262\256"
+	.ascii	"\224\254\277Z\265%n\252\253\355\177Y\353\177AV\340\033 @\324"
+	.ascii	")\216\336'v\312\201R\233\312y\301\242\245\016\271:\245\022\031"
+	.ascii	"\242\304K[\225H\253Q\252\324U\"*\324[X\360`\022\252\022\261\314"
+	.ascii	"@\0173\003>)\023\245\261\237\375\317i\375\033UH\020\212\274u"
+	.ascii	"\252\0205\310\210\2735s\311\236\245\251.$wkp\352\303\207\312"
+	.ascii	"\344\002>\361\236\264\226W\003\202\037\250\002\321<F3\035BF)"
+	.ascii	"\021\031\222$)t2\013\020\206\"q\242\267\314\003\022 uE\2151\310"
+	.ascii	"\206F\222\202Jac7\203p\n Q%t\302-S\2318\0250\315\\W\002\006\270"
+	.ascii	"\351\017\331Xq\355\\\322\362\214\020/\267\373l\306a\036\302\255"
+	.ascii	"\340;\3521\215\327\362\316\360R\330\362\313v\315\274\306\311"
+	.ascii	"n\177\347V\001\"\231]#\362'\344\237\007\363\351Z\364\221r\236"
+	.ascii	"\234\2416~b`\312\215D\200\204\316\352\371B\243\f@\360\006\020"
+	.ascii	"\345w\222p\302\020N\037Z/R\350r\371\345\227\177\213\022,,\303"
+	.ascii	"\016`F*\242b\200\027"
+	.string	"\221\313x\230QDC\231\363l\3430\026j:\326\337;\"\230\311\204\361\200\274\326\020\235/8\371<\373\273\304`-\337\331\204\372\354\333j\241\305~q\345\006S=.B\230\2135p\3328\005'\370\3602\357\305%~\370\351\347\223~\365\275\376\264\252\007\312\376\262!\005\341\367\254\307\227t\341c\232D\337\025\003\345\243BpyB\242\237\355\332\220G\305\303\024\362\345\254\205\004\3713\2442\2013\375d\327'>\255-*\3512\351\017\007\244\302I\004\001d\0170\217\364\251\306\270Z8*\212\360\0200\222Z9yU\360+\370\3331\210\261\303\270hc\250.\204\005v\016\200:\207\004\256\352@m\253\270)\337\234%\250Wt)\334\031\206\007f\363\256\361\013v(Z\231\t\361q\231\336\220}\fX\343n\004\207\035L\033J\234\247\200WtrP\353i\204\220\250\320\036\311B\307h6i\210\025\236\231\344\313\212Q\f"
+	.ascii	"*\226.\303j\331\360 &\235\377L\364\341\204\277)P\236BXaD\207"
+	.ascii	"\206K\re\351\f\336\330I2\374#$M\352\r\006\271\307\246E\241\372"
+	.ascii	"\355f\232\bB\277\350\311\316\276\343\324\004\263\232\036\371"
+	.ascii	"\352>\303&\227~\224~\250\230C\r\334$\220*\t\032\371P@4\365\243"
+	.ascii	"\204\026\236\250\300H\327\342\024\205\\9\302\364\034\f\266:\364"
+	.ascii	"&\343\364\255\340\2349j\031\316de\362\241D\374\343eG jKKU\321"
+	.ascii	"7M\363\262\210r\222\001\301C\202 \331 +\232\032\273x\3018\020"
+	.ascii	"\222\311\220=\bd\b\322\305%\324\025\344u\t0\202#\223k\333Q\326"
+	.ascii	"\270\262\222[\206\231\360\312&c\214Y\317^b@(\314\276!\317\254"
+	.ascii	"\350Mz\261\215\242c\341uVW\222 ut\315c\036\234\2276\260h?\377"
+	.ascii	"Z\242\220\242\201K\321$\277\240_\263\232\324X\333\225\371\007"
+	.ascii	"h{OB\314aD\377Dh{\301tae\\5\333 \033\007\353khXj\325\354\314"
+	.ascii	"\031\n\360;\253\251\260\337\343\013s\266\220\253\346._\325\230"
+	.ascii	"\252(uox3\211\245\016#\321\030\343\001\315\177\341~\201\260\353"
+	.ascii	"a\007\032\263\315!\212\033\255;\003\277\200n\307\312\210\"\035"
+	.ascii	"_\2141\311\003G!\220\tr\020>6\322,6\253\254O\260\343\n.(W\300"
+	.ascii	"$\257\250a$E\016\351\274\262\255$\344\370\202\227\225d\356\\"
+	.ascii	"\006=F>\232\rK2\3335\273\313\252\264\031\303\366\204\254\001"
+	.ascii	"*\374=CB\030n\257\205\264\242\271h\250\334\fA-\353\334\322\351"
+	.ascii	"\20006\277\306\026\204p\031\350\211\234\f\274\353z\310=\302\276"
+	.ascii	"`\332O5\237$\371\330|7\210x\205\366\316\343\235\246;H\362#|\036"
+	.ascii	"}\020\352\201\236\20465'\270\t\342\244?\016sDS\316kY5\360\334"
+	.ascii	">\307\341t\361;\362\345\373\242[^\n\016\023\235`\375\266\346"
+	.ascii	"K\350\232\370\371\220\033\374\227\3437\367\225\202'\342\237\310"
+	.ascii	"\227\243\r\203\361\3261\311\333+K\340\336\203\354\003\232@a\247"
+	.ascii	"\326\001\030\207\3062\001\361P\360\356\\\234\334\265_\371\243"
+	.ascii	"\366\320NO\3149\356\325wR\036\013\0072\355e6\242P\033,`+"
+	.text
+	.section	.gnu.lto_.symtab.18c76033c9e7e57f,"e",@progbits
+	.string	"tfp_format"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"uli2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"i2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"li2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"a2i"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.18c76033c9e7e57f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,6015 @@
+	.file	"streambuf.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/streambuf.h"
+	.file 5 "/usr/include/string.h"
+	.file 6 "./src/main/common/streambuf.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	streambuf.c.181aa5a2
+	.weak	streambuf.c.181aa5a2
+streambuf.c.181aa5a2:
+	.long	0x35d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xc
+	.long	.LASF825
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.long	.LASF794
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF788
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF789
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	0x4f
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF790
+	.uleb128 0x9
+	.long	0x48
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF791
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF792
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF793
+	.uleb128 0x3
+	.long	.LASF795
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x54
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF796
+	.uleb128 0x3
+	.long	.LASF797
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x3
+	.long	.LASF798
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5b
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF799
+	.uleb128 0xe
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF800
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x69
+	.uleb128 0x9
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF801
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF802
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0xf
+	.long	.LASF826
+	.byte	0x10
+	.byte	0x4
+	.byte	0x19
+	.byte	0x10
+	.long	0xea
+	.uleb128 0xa
+	.string	"ptr"
+	.byte	0x1a
+	.long	0xea
+	.byte	0
+	.uleb128 0xa
+	.string	"end"
+	.byte	0x1b
+	.long	0xea
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF803
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x3
+	.long	0xc6
+	.uleb128 0x9
+	.long	0xef
+	.uleb128 0x10
+	.long	.LASF804
+	.byte	0x5
+	.value	0x197
+	.byte	0xf
+	.long	0x22
+	.long	0x117
+	.uleb128 0x8
+	.long	0x43
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF805
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xe
+	.long	0x9b
+	.long	0x137
+	.uleb128 0x8
+	.long	0x9b
+	.uleb128 0x8
+	.long	0x137
+	.uleb128 0x8
+	.long	0x22
+	.byte	0
+	.uleb128 0x5
+	.long	0x13c
+	.uleb128 0x12
+	.uleb128 0x2
+	.long	.LASF807
+	.byte	0x7a
+	.long	0x15e
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0x7a
+	.byte	0x21
+	.long	0x15e
+	.uleb128 0x7
+	.long	.LASF806
+	.byte	0x7a
+	.byte	0x2f
+	.long	0xea
+	.byte	0
+	.uleb128 0x5
+	.long	0xef
+	.uleb128 0x2
+	.long	.LASF808
+	.byte	0x74
+	.long	0x184
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0x74
+	.byte	0x1a
+	.long	0x15e
+	.uleb128 0x7
+	.long	.LASF809
+	.byte	0x74
+	.byte	0x23
+	.long	0x3c
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF810
+	.byte	0x6c
+	.byte	0x10
+	.long	0x19f
+	.long	0x19f
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0x6c
+	.byte	0x2b
+	.long	0x1a4
+	.byte	0
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x5
+	.long	0xfb
+	.uleb128 0x6
+	.long	.LASF811
+	.byte	0x67
+	.byte	0xa
+	.long	0xea
+	.long	0x1c4
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0x67
+	.byte	0x1a
+	.long	0x15e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF812
+	.byte	0x62
+	.byte	0x5
+	.long	0x3c
+	.long	0x1df
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0x62
+	.byte	0x20
+	.long	0x15e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF813
+	.byte	0x5b
+	.long	0x20b
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x5b
+	.byte	0x1b
+	.long	0x15e
+	.uleb128 0x7
+	.long	.LASF814
+	.byte	0x5b
+	.byte	0x26
+	.long	0x9b
+	.uleb128 0x1
+	.string	"len"
+	.byte	0x5b
+	.byte	0x30
+	.long	0x3c
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF815
+	.byte	0x51
+	.byte	0xa
+	.long	0xba
+	.long	0x230
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x51
+	.byte	0x1e
+	.long	0x15e
+	.uleb128 0xb
+	.string	"ret"
+	.byte	0x53
+	.long	0xba
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF816
+	.byte	0x49
+	.byte	0xa
+	.long	0xae
+	.long	0x255
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x49
+	.byte	0x1e
+	.long	0x15e
+	.uleb128 0xb
+	.string	"ret"
+	.byte	0x4b
+	.long	0xae
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF817
+	.byte	0x44
+	.byte	0x9
+	.long	0x9d
+	.long	0x270
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x44
+	.byte	0x1c
+	.long	0x15e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF818
+	.byte	0x3f
+	.long	0x291
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x3f
+	.byte	0x1e
+	.long	0x15e
+	.uleb128 0x7
+	.long	.LASF819
+	.byte	0x3f
+	.byte	0x2f
+	.long	0x43
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x39
+	.long	0x2bd
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x39
+	.byte	0x1c
+	.long	0x15e
+	.uleb128 0x7
+	.long	.LASF814
+	.byte	0x39
+	.byte	0x2d
+	.long	0x137
+	.uleb128 0x1
+	.string	"len"
+	.byte	0x39
+	.byte	0x37
+	.long	0x3c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x30
+	.long	0x2de
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x30
+	.byte	0x24
+	.long	0x15e
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x30
+	.byte	0x32
+	.long	0xba
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF822
+	.byte	0x2a
+	.long	0x2ff
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x2a
+	.byte	0x24
+	.long	0x15e
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x2a
+	.byte	0x32
+	.long	0xae
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF823
+	.byte	0x22
+	.long	0x320
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x22
+	.byte	0x1b
+	.long	0x15e
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x22
+	.byte	0x29
+	.long	0xba
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF824
+	.byte	0x1c
+	.long	0x341
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x1c
+	.byte	0x1b
+	.long	0x15e
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x1c
+	.byte	0x29
+	.long	0xae
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF827
+	.byte	0x6
+	.byte	0x17
+	.byte	0x6
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x17
+	.byte	0x1a
+	.long	0x15e
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x17
+	.byte	0x27
+	.long	0x9d
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF555
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF573
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF620
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF621
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 19 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.file 21 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF686
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF690
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF691
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF787
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF476
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF479
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF492
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF493
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF540
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF554
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF572
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF597
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF616
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF618
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF623
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF596
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF616
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF683
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF685
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF689
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF786
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x8
+	.long	.LASF1
+	.long	.LASF828
+	.long	.LASF829
+	.long	.LASF830
+	.long	.LASF831
+	.long	.LASF832
+	.long	.LASF833
+	.long	.LASF834
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x1a
+	.long	.LASF0
+	.byte	0
+	.long	.LASF835
+	.byte	0x7
+	.long	.LASF836
+	.byte	0x3
+	.long	.LASF837
+	.byte	0x3
+	.long	.LASF838
+	.byte	0x1
+	.long	.LASF839
+	.byte	0x6
+	.long	.LASF840
+	.byte	0x1
+	.long	.LASF841
+	.byte	0x6
+	.long	.LASF842
+	.byte	0x3
+	.long	.LASF843
+	.byte	0x6
+	.long	.LASF844
+	.byte	0x6
+	.long	.LASF845
+	.byte	0x3
+	.long	.LASF846
+	.byte	0x3
+	.long	.LASF847
+	.byte	0x5
+	.long	.LASF848
+	.byte	0x3
+	.long	.LASF849
+	.byte	0x4
+	.long	.LASF850
+	.byte	0x4
+	.long	.LASF851
+	.byte	0x2
+	.long	.LASF852
+	.byte	0x2
+	.long	.LASF853
+	.byte	0x6
+	.long	.LASF854
+	.byte	0x7
+	.long	.LASF854
+	.byte	0x6
+	.long	.LASF855
+	.byte	0x3
+	.long	.LASF856
+	.byte	0x3
+	.long	.LASF857
+	.byte	0x3
+	.long	.LASF858
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF699:
+	.string	"INT32_MAX (2147483647)"
+.LASF448:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF641:
+	.string	"__STD_TYPE typedef"
+.LASF478:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF703:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF794:
+	.string	"size_t"
+.LASF679:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF620:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF580:
+	.string	"__stub_sigreturn "
+.LASF417:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF542:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF517:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF745:
+	.string	"INT16_C(c) c"
+.LASF776:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF488:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF738:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF469:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF484:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF735:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF775:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF769:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF758:
+	.string	"INT32_WIDTH 32"
+.LASF760:
+	.string	"INT64_WIDTH 64"
+.LASF531:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF807:
+	.string	"sbufSwitchToReader"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF686:
+	.string	"__STD_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF724:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF504:
+	.string	"__P(args) args"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF599:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF654:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF728:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF423:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF615:
+	.string	"__size_t "
+.LASF693:
+	.string	"INT8_MIN (-128)"
+.LASF680:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF638:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF492:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF437:
+	.string	"_ISOC99_SOURCE 1"
+.LASF519:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF603:
+	.string	"_T_SIZE "
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF702:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF723:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF564:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF420:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF407:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF617:
+	.string	"NULL"
+.LASF684:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF740:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF576:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF663:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF431:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF411:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF416:
+	.string	"__USE_XOPEN2K8"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF541:
+	.string	"__always_inline"
+.LASF601:
+	.string	"_SYS_SIZE_T_H "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF427:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF714:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF490:
+	.string	"__GLIBC__ 2"
+.LASF438:
+	.string	"_ISOC11_SOURCE"
+.LASF799:
+	.string	"long int"
+.LASF480:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF432:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF467:
+	.string	"__USE_XOPEN2K8 1"
+.LASF672:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF598:
+	.string	"__size_t__ "
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF396:
+	.string	"__REVISION__ \"7b45b89\""
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF683:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF668:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF730:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF662:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF661:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF610:
+	.string	"_SIZE_T_DECLARED "
+.LASF506:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF562:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF527:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF737:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF623:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF520:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF618:
+	.string	"NULL ((void *)0)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF583:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF487:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF497:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF759:
+	.string	"UINT32_WIDTH 32"
+.LASF793:
+	.string	"signed char"
+.LASF761:
+	.string	"UINT64_WIDTH 64"
+.LASF800:
+	.string	"uint8_t"
+.LASF628:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF508:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF643:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF555:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF498:
+	.string	"__LEAF , __leaf__"
+.LASF659:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF609:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF612:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF460:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF505:
+	.string	"__PMT(args) args"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF715:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF611:
+	.string	"__DEFINED_size_t "
+.LASF475:
+	.string	"__USE_LARGEFILE 1"
+.LASF786:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF694:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF549:
+	.string	"__restrict_arr __restrict"
+.LASF574:
+	.string	"__stub___compat_bdflush "
+.LASF607:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF670:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF486:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF710:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF528:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF777:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF585:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF579:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF596:
+	.string	"__need_size_t "
+.LASF631:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF653:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF546:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF787:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF797:
+	.string	"__uint16_t"
+.LASF810:
+	.string	"sbufConstPtr"
+.LASF414:
+	.string	"__USE_XOPEN2K"
+.LASF514:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF685:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF415:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF544:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF447:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF464:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF721:
+	.string	"INT_FAST8_MAX (127)"
+.LASF709:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF739:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF782:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF750:
+	.string	"UINT32_C(c) c ## U"
+.LASF729:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF409:
+	.string	"__USE_POSIX199309"
+.LASF700:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF719:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF491:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF413:
+	.string	"__USE_UNIX98"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF430:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF820:
+	.string	"sbufWriteData"
+.LASF647:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF632:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF677:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF548:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF717:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF440:
+	.string	"_ISOC2X_SOURCE"
+.LASF669:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF795:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF726:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF586:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF526:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF727:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF720:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF587:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF536:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF619:
+	.string	"__need_NULL"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF465:
+	.string	"__USE_POSIX199506 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF785:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF454:
+	.string	"_ATFILE_SOURCE"
+.LASF637:
+	.string	"__SLONG32_TYPE int"
+.LASF742:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF658:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF403:
+	.string	"__USE_ISOC11"
+.LASF479:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF533:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF763:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF691:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF584:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF765:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF476:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF733:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF660:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF772:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF626:
+	.string	"_BITS_TYPES_H 1"
+.LASF701:
+	.string	"UINT8_MAX (255)"
+.LASF622:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF748:
+	.string	"UINT8_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF798:
+	.string	"__uint32_t"
+.LASF461:
+	.string	"__USE_ISOC95 1"
+.LASF565:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF578:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF602:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF410:
+	.string	"__USE_POSIX199506"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF773:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF518:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF434:
+	.string	"_ISOC95_SOURCE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF500:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF597:
+	.string	"__need_NULL "
+.LASF402:
+	.string	"_FEATURES_H 1"
+.LASF453:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF556:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF689:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF530:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF774:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF642:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF470:
+	.string	"__USE_UNIX98 1"
+.LASF471:
+	.string	"_LARGEFILE_SOURCE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF422:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF450:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF678:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF558:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF408:
+	.string	"__USE_POSIX2"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF616:
+	.string	"__need_size_t"
+.LASF605:
+	.string	"_SIZE_T_ "
+.LASF483:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF783:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF572:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF625:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF732:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF553:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF811:
+	.string	"sbufPtr"
+.LASF503:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF446:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF762:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF534:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF552:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF494:
+	.string	"__PMT"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF664:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF455:
+	.string	"_ATFILE_SOURCE 1"
+.LASF633:
+	.string	"__SQUAD_TYPE long int"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF754:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF425:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF569:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF779:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF697:
+	.string	"INT8_MAX (127)"
+.LASF819:
+	.string	"string"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF792:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF757:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF495:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF421:
+	.string	"__USE_MISC"
+.LASF821:
+	.string	"sbufWriteU32BigEndian"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF418:
+	.string	"__USE_LARGEFILE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF466:
+	.string	"__USE_XOPEN2K 1"
+.LASF459:
+	.string	"__USE_ISOC11 1"
+.LASF671:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF630:
+	.string	"__U32_TYPE unsigned int"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF525:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF529:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF457:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF551:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF577:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF712:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF667:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF705:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF540:
+	.string	"__wur "
+.LASF473:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF755:
+	.string	"UINT8_WIDTH 8"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF744:
+	.string	"INT8_C(c) c"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF636:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF682:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF489:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF646:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF655:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF501:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF557:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF507:
+	.string	"__STRING(x) #x"
+.LASF791:
+	.string	"unsigned char"
+.LASF554:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF561:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF790:
+	.string	"char"
+.LASF502:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF563:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF600:
+	.string	"_SIZE_T "
+.LASF707:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF522:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF704:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF789:
+	.string	"short unsigned int"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF604:
+	.string	"__SIZE_T "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF405:
+	.string	"__USE_ISOC95"
+.LASF825:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF404:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF822:
+	.string	"sbufWriteU16BigEndian"
+.LASF412:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF509:
+	.string	"__BEGIN_DECLS "
+.LASF716:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF722:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF537:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF692:
+	.string	"__intptr_t_defined "
+.LASF468:
+	.string	"__USE_XOPEN 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF809:
+	.string	"size"
+.LASF674:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF393:
+	.string	"SITL 1"
+.LASF435:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF406:
+	.string	"__USE_ISOCXX11"
+.LASF608:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF801:
+	.string	"uint16_t"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF788:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF449:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF770:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF746:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF751:
+	.string	"UINT64_C(c) c ## UL"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF477:
+	.string	"__WORDSIZE 64"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF581:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF824:
+	.string	"sbufWriteU16"
+.LASF515:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF639:
+	.string	"__S64_TYPE long int"
+.LASF568:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF606:
+	.string	"_BSD_SIZE_T_ "
+.LASF512:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF817:
+	.string	"sbufReadU8"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF629:
+	.string	"__S32_TYPE int"
+.LASF764:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF741:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF399:
+	.string	"_STRING_H 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF687:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF747:
+	.string	"INT64_C(c) c ## L"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF753:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF784:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF808:
+	.string	"sbufAdvance"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF826:
+	.string	"sbuf_s"
+.LASF803:
+	.string	"sbuf_t"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF695:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF767:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF575:
+	.string	"__stub_chflags "
+.LASF424:
+	.string	"__USE_GNU"
+.LASF614:
+	.string	"_SIZET_ "
+.LASF673:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF456:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF813:
+	.string	"sbufReadData"
+.LASF567:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF666:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF644:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF545:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF713:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF823:
+	.string	"sbufWriteU32"
+.LASF535:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF725:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF510:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF481:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF816:
+	.string	"sbufReadU16"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF766:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF796:
+	.string	"short int"
+.LASF493:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF433:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF523:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF768:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF560:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF634:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF571:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF521:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF651:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF524:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF635:
+	.string	"__SWORD_TYPE long int"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF532:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF708:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF648:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF462:
+	.string	"__USE_POSIX 1"
+.LASF734:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF731:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF640:
+	.string	"__U64_TYPE unsigned long int"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF570:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF749:
+	.string	"UINT16_C(c) c"
+.LASF451:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF472:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF627:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF743:
+	.string	"WINT_MAX (4294967295u)"
+.LASF804:
+	.string	"strlen"
+.LASF539:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF482:
+	.string	"__USE_ATFILE 1"
+.LASF543:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF805:
+	.string	"memcpy"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF771:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF559:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF812:
+	.string	"sbufBytesRemaining"
+.LASF665:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF547:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF656:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF696:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF452:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF613:
+	.string	"_GCC_SIZE_T "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF711:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF781:
+	.string	"UINTMAX_WIDTH 64"
+.LASF676:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF818:
+	.string	"sbufWriteString"
+.LASF458:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF645:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF706:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF441:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF718:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF511:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF463:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF657:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF566:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF780:
+	.string	"INTMAX_WIDTH 64"
+.LASF698:
+	.string	"INT16_MAX (32767)"
+.LASF588:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF649:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF474:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF650:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF496:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF439:
+	.string	"_ISOC11_SOURCE 1"
+.LASF690:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF827:
+	.string	"sbufWriteU8"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF485:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF806:
+	.string	"base"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF802:
+	.string	"uint32_t"
+.LASF688:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF778:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF815:
+	.string	"sbufReadU32"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF516:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF573:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF499:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF652:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF419:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF621:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF814:
+	.string	"data"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF436:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF624:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF582:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF681:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF736:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF675:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF752:
+	.string	"INTMAX_C(c) c ## L"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF550:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF756:
+	.string	"INT16_WIDTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF848:
+	.string	"long-double.h"
+.LASF850:
+	.string	"stubs-64.h"
+.LASF833:
+	.string	"/usr/include"
+.LASF858:
+	.string	"stdint-intn.h"
+.LASF842:
+	.string	"libc-header-start.h"
+.LASF853:
+	.string	"strings.h"
+.LASF831:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF839:
+	.string	"string.h"
+.LASF846:
+	.string	"timesize.h"
+.LASF849:
+	.string	"stubs.h"
+.LASF837:
+	.string	"stdint-uintn.h"
+.LASF832:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF857:
+	.string	"wchar.h"
+.LASF854:
+	.string	"stdint.h"
+.LASF843:
+	.string	"features.h"
+.LASF856:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF851:
+	.string	"locale_t.h"
+.LASF830:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF835:
+	.string	"stddef.h"
+.LASF855:
+	.string	"typesizes.h"
+.LASF829:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF844:
+	.string	"features-time64.h"
+.LASF0:
+	.string	"./src/main/common/streambuf.c"
+.LASF847:
+	.string	"cdefs.h"
+.LASF838:
+	.string	"streambuf.h"
+.LASF840:
+	.string	"streambuf.c"
+.LASF845:
+	.string	"wordsize.h"
+.LASF852:
+	.string	"__locale_t.h"
+.LASF828:
+	.string	"src/main/common"
+.LASF841:
+	.string	"stdc-predef.h"
+.LASF834:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF836:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.98f4013487348623,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\205\005"
+	.string	"t\007\221\001"
+	.string	"\020"
+	.string	"\331\205\355\260\004\006\002"
+	.string	"\002\001\002\002\002\001\252\337\376\202\003\f\332\333\323\265\005\030\003\217\273\217\234\013\004\234\225\205\264\f\005\311\244\360\314\013\006"
+	.string	"\002\001\006\365\250\256\225"
+	.string	"\002\001\007\275\227\373\\\002\002\002\b\275\240\345\300\007\n\t\207\236\200\376\r\022\n\366\264\360\365\001\002\013\257\241\227\210\n\004\f\276\237\344\233\016\r\003\016\226\210\313\347\b\017\345\362\340\204\b\006"
+	.string	"\027"
+	.ascii	"6\t\200`\220*\346R\267\347\026\n\223\001\301\234\"`\224\001`"
+	.ascii	"\232\300z\201M\216j6\257>\303Aa\204\250da)\200\0046\217z9\200"
+	.ascii	"MF\273\22640\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\375\003"
+	.string	"\202\004\017\031\260%\351\f\3030\f+\034\206a\030\234\333\2555\322\032\331d\023\"w\222\001,\210\026\375\320\372\264\3566\023&\351~\261\333\350\006\306z\261\315)\274\232\034\200'%\243\364$\036\003\001\035"
+	.string	"\260E\326v\2260\3402\266t\265\247b\200T\203\243Va1-\204\363\"\037\037l\202\301T\246\311\f\347r\033\030\242\207\214\006\317"
+	.ascii	"A1\357T,\003\271\201-`\037\330\314e7\220\363\006\260"
+	.text
+	.section	.gnu.lto_.inline.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\357\003\355\n"
+	.ascii	"\262\214$%\220'I\007\360\312'"
+	.string	"\352\373\344+T\306\222\037\022\375\326-U \265\252\352\367Q\274\375\255\331\326H#d\023\271S\237%\222{\241%{\200S~\006\235lg\\`\r\037\304Z'\264Uxd^\337!8\322\323\026Y\306\212E\202N!0\261\262\025\013\364+\013m=sg\320\310\320\026qR\267\026\021\203T\243\274#\240\016\330\320v`\362\265\320\361\r\027\332\036)\321\214\233C\207\266\3116o.\2649\031>\006\350\036M\332\2665\250m\215\017\370\036\002^\250!iV\246\240)l\254\001\260\002\021\031\253z\022@\224%\206R\234(A\251\200DB\222\224\224UPp\fx\321*\366\311\242\013R\003\035\360aE\236\216\261Qm\213\243\034\355\"\270\226u;\260r\004\337\021\225\251\251\372>a\306\305\b\271cJ\313\260\322\005\230\341\207\212\265!2\3020\216\366\262\344\032P\224\314\023o+\24490Mb\001g4\365\333~\334\207"
+	.ascii	"\0179\237\260\256\361\020u\235\314\307\360\026\225\224M\177\024"
+	.ascii	"\257\037}\376)\007\373d\001K.\331@#U\335\212N\204yRd\273 ?\236"
+	.ascii	"\324\355H%\177\n\266\356r\317\033\301\354\bX\201\304\314\315"
+	.ascii	"\370\372pyV\246&\033\353yTz\212\243!\312\242\312"
+	.text
+	.section	.gnu.lto_.jmpfuncs.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"\225\004"
+	.string	"RG\026\036\260%\351\f3\r\240\b\036\206\205\272z\350h\016\207\201\3006kmk\215\020B\310\226I\006,\202\004\026"
+	.string	"\\\332\037\007\215\"\335\263G\035\361\207\215\366\336\361=\206\265\326JJ)5\023\307\376+\344\265$\274$\223\007\365\212~\217\360\2339\305\330\2519\365\356!_\016x!\027"
+	.ascii	"Pp\315*\004\227\251F\250\201X\030\316t|\004V\b \016\202\315\314"
+	.ascii	"\0250\256j\340q FL\260\305\262:P\\\320L\376@\301\240`P0\227\362"
+	.ascii	"\0130\004"
+	.text
+	.section	.gnu.lto_.pureconst.98f4013487348623,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004\b\232\004\t\232\004\n\231\004"
+	.ascii	"\013\205\004\f\205\004\r\205\004\016\232\004\017\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\204\001]\005"
+	.string	"2\306\026\"\240'\351\377\377\240X\241\353\252j\324\341%\304s\252\242\371\017o\210\217\020\333\272\315\376o\215\020\"e\n\037\030\020b\3758\217\002r\02466\002k\243\312\031\346S\307\205m\035\007\312\021i\220\350O\036\205$\b"
+	.string	"~A\305pQ\222HK\245\362\373\236\363\226/%\353\354\346\333\b\" \320\242\031$7'\201\277\360V$&To\003\034\016<\030\333\004:a,\3653]\333\353\271la\204\275\237\346\2478\314\334i.\314.\214\331\255\001\017tE$iQ\362"
+	.ascii	"\327\001-B2\223\002\362:G\320]\200\262H C(\002"
+	.text
+	.section	.gnu.lto_.lto.98f4013487348623,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sbufWriteU8.0.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"e\013"
+	.string	"\006\026PC0k\225\016@c?>\274?\241\233I\342q\034\307@\0021,\006\323%\235\036<\375\275\025\277\341b.\320\032\002!\006\274\212jc\021\021`\017\203\301"
+	.string	"\023\310\031q\203)\245n\245\361\206\330\275\311\336)\005:"
+	.string	";"
+	.string	"="
+	.string	"\023\273*\006\031vG\2141\332\251\307_\352\251\366J=\265h{\240"
+	.string	"@Y\t\230\020bw\267\231\340\342\245\350\277u\tT\252t)\321\330]KT\212\300=o\333\3026\207\375\214\037\377z\326\237e\3222\223\276&AP\251\260; 6b]T\303\312\366\355C\020\355\211]7pS\276e\315F\3748\362\3345\200aC;\255\027\270\313?\360\033\334\201x\026\351\001\247\226W\0019)P:\034\365\201\373\247\234\207\005Xp\2221\333\341%\210\264\335\275\360#\204@\232\202S\237TO?)/\226I\306l\001\301a\245\b{,\311y\300~\266\273\353\251\262\003!]hZ\323m\272\216\303\3402\227O\3501\315\311|\200:\274\256\003~\302\315\363y\336\307\331< \235\267q\300p\313T\370\023\351\200\333\347\373\300m2\356\263\235\252\f\3462\315\223\353\364-\214\214\244/\252\001\017"
+	.ascii	"@\323\340L\350\030\003\333\240\267&5\262\250h \210\250\f\206"
+	.ascii	"*\307X\31515\326'\227ab\250\331\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_sbufWriteU16.1.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\266\002U\023"
+	.string	"\206byG\3200'\035\337[\037\210\366\331\345\270\001\002\356\220\352w\256\026\325\221N\272Z,=\346N\374d\372\f@\332\327^o\033V\210\336X\345*Kk9\210#\3045\266\200#3:\200\020\256$\332;X5b\367&r\247\024_"
+	.string	"g"
+	.string	"b"
+	.string	"A1\233u\031Y\366\354\360i\370\020\262\333\036X\356bHa\240\273\354\210s\303\367h\377\347 d\257\315<\300.\317\207\244\335\220\304$\335\245\303\203\314\313\356\036\363\3222\373E\210\004\216\037\233\240\247\335\365T\303e\2172\377@_\335\344\320<\252Rv\327\361&\247\302\255\267=\3006\002[Q\002\321\252\327\376y\333\317\315hUE\307\031}"
+	.string	"\253\032\017\030\2738S5vI\226\360A\272\375H\356<Y\204&\\\034\n#/\212]\204?\342Dr\307\303\356\262d\267\301Dh:\226\346\342\304\247\361C69\211\335\006\013A\271`_\210[\013\035\033\341\366\343\264\033\216\\N\242\357\361B\261\327ft\302\201\031>N\227~0\277\307\007\347\345G\223\316\206\232"
+	.ascii	"9Z\374&\306\367\225n\350i\324p\240\271\345$\300nw\t\370I/\227"
+	.ascii	"\33733/W\312\321T{\321Ud0\021=\301\n\026\327\017\335)S/t\221"
+	.ascii	"Y\2042\247\327\333H\315\342\224?\242\2306B\331!-j\006\373\334"
+	.ascii	"\356\256\225\307\356\2427\272\350U\027\335u\001.-\007j\223\326"
+	.ascii	"I\253\365\025\370J@db\026\250WJ\030\300\024\270Z,/\231\030\357"
+	.ascii	"\005t\271\300\025\357\245A\313\345\255\274b\274\022\001\006a"
+	.ascii	"X^\236\f\b\276<V8;\267\312c\231\2634S\232\375\233\321\224\302"
+	.ascii	"|4\351\250\n\225vHn9\n\260S!\035\251\376f\024U\273[ir\032\365"
+	.ascii	"5R\020\230v\350\007\272J\324\322\314Wr\t; \240\002\231\301\262"
+	.ascii	"\003@kPV\350\240)0\007\217\230\023\372\266L\330\345\b\210<\256"
+	.ascii	"\233\035\310\303\326Q\236\232U\004B\354\2731\234\245Tb\f\275"
+	.ascii	"#\375\016\247Z| Y\243\300\317\027q\312\2603\0171\tu\206\274\031"
+	.ascii	"\260\275\247\304\3665\353\205=\026\017#\260\027p\312\027\304"
+	.ascii	"\212V\200\255\233\250`\021\242,\337\372[\227\321\213\247\020"
+	.ascii	"\272\252m:\304\311\222i\033\257\357B\2751\276,:\376\360\242]"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_sbufWriteU32.2.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\372\004=\030"
+	.string	"V)\222J\300\020)\035\363\233C\352\312\376\263\0315\273\331\216\252\372\017P{\203\302\374\371\305s\313\365\177S\231Q#^7\333\357\337\035G\\n7\024\256\213\262\320\323T\250\337\244\363K\267\253.\n\2778\013L\350\315\315\027i\334V\356\224\002w"
+	.string	"|"
+	.string	"z"
+	.string	"6j\005\242\234\216H\265\317\033\351\376\253\331\r\br\b\3318\365\213t\366\353\264\365\262\307\017\265\t<\213\335\203\030\374Qk\t\251\003\344\351\2545r\250}\332W\361\025\273\377j.\253\325'\005\261V`\212S\310S\003o2\236\222\0070\236zg\3278\321"
+	.ascii	"\023\336\024a\325Zi\013\364\335\347\316?\321?ptx\237\256\226"
+	.ascii	"Z\253'\216\216\207{o{\200\355\0046\345\005$\344\264\214\234\216"
+	.ascii	"\221\323#\344\264\b9\035BN\303\310\351\327\177?\310\203?9N\273"
+	.ascii	"\\\323\3438M]\323\255qz]\323s\234~\200\227M\311T\2559=xT*Z\024"
+	.ascii	"\212z:\024\005\302*\022\337D\201\206\226\206W\242?X\236\361\200"
+	.ascii	"5\247\003\312\205\272\267\360]\034\211\376\f\325Z_\273\007if"
+	.ascii	"\274X\365\321x\252\321\371#\257\260\350\036\24491\320c\337\250"
+	.ascii	"UA\304j\206\2410\273\037&\315\335M\271\311\"o\250\221\334\271"
+	.ascii	"\013e\223\345\013QU\217~\242/\330\241\352\3711\032\320\370A~"
+	.ascii	"9\236\226\\\361\220,\214\022fu\234\033\265\313\226d\257\303\006"
+	.ascii	"\205\317\267K\225d\255\225\200\377b\002\316\017\252\031Oe\013"
+	.ascii	"\273\372]x\0058\252\220\316`J\306\367Gw\013\310\336\350\263\336"
+	.ascii	"\334ar\277\277\311\352\315\0366\331\251\252s\207\r\364\3155a"
+	.ascii	"\277U\327\307&\247\003\024l\027\326+6\026\233\255V\240\246b2"
+	.ascii	"#\363\262vQ\201`\341\001\316\006\223\233\221\241\305\2248\\\351"
+	.ascii	"B\213\221`\303\321\\r24\025\001.+\300\344h3e\231\243\275\200"
+	.ascii	"\275\267\352\372\230\236\240\352\255\317\376\223\023\tW\004\330"
+	.ascii	"\326x-,\312\267\323xEA\271\366ON\343\272N\306\036\"\323\b\372"
+	.ascii	"\"\262V!+R\364\3553B\212MtOdj-\215\265x\206I\"\326A\311\025O"
+	.ascii	"l\253F6\266\344\333\251JrdI)d\250A`\305\020B$\"\"\"IA\222t\360"
+	.ascii	"\002\0211\252\016\022 \004R\310\002\027E\024((\247\320\376=@"
+	.ascii	"P%\320.,\231\340\372\257\004F4\337\314W/\t\235df\274\233\220"
+	.ascii	"\227(<'c\304\373y\234\224%\331Hf\306\364Si\211\002\357\305DR"
+	.ascii	"P\340\255\337Ve\327\317\224Y\005\017e\367<2\201\267hf\320\244"
+	.ascii	"\357zF\224\003\266\307\323gC\307l;&TEkh\270\207\334\324\212M"
+	.ascii	"\336\374\251\263e\026GR\0213\320zI\212\327\205\021cB\017F\261"
+	.ascii	"6\177J\230$\342\304\236\257\017\355\362\350\334\317\320\361\264"
+	.ascii	"\351;\007\302T\235\345n\031\313\307\370C\350/B\220\n"
+	.text
+	.section	.gnu.lto_sbufWriteU16BigEndian.3.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\271\002\245\023"
+	.string	"\226c|G\340.'\035\023o\203)\227\244\213OJ\027\365\271\336\377V-]\355d\027\215\347:?\217p;\001\362\273\265b\337\243\217\013Do\241\266f\fv\t\3065\254\351\214W\021\300\222\261\210\345o7\363m\330\266\264\233\334)\005a"
+	.string	"l"
+	.string	"e"
+	.string	"M\227~\317\314n]\306\226-\235>\r/\202v\334\004\313\335\032\026\b\346\345F\224K\337\243\375\020\337\241\375\326\362"
+	.string	"\2736\271\022\273!\210A\346\245\303\273\272\313y\001\335\245i\266\213\216\n\032G0=P\273\353)\207\323\036i\376y\316\212\231qy\\\221\354\256c\314\f\206[o\233\200m\005\266\222\004\0313\2325\243\347\214^\375\366w\307\375\252U\264\256\242c\027}"
+	.string	"\255\025.\244]\231\251\030\233$\213r\210r\037\2228P\366p\tW\346\302\307\203f\037\341\2238\220\304\361\260\273-\332q2\017\227\215\265\2650\3724\376\307\"#\263\343d\035\0074\330\367Qm\206\215\245\220;j\332\r?.;\240\357\361>\263\337Z\324B\002\0309\001`w\311\301D\223\241F\240\306\322c^|gi\206\376\351\245\203\315'/\002\347\356\026\360M\304`\376MKw\311R\r\246\333\203\276\300I\351@o\200\244bc\224\243\376\347&\351\364>\367\250\305(_\243\036F\252\026\247<\357\023\235J\257\177\221\262\305)\273t\2246F\331\241-\352\006\373\252\335]\253\215=\243\003(/\tj\221\327\310\353\365\031\370B\\,+\017\324%!\020d\016`/\223\030\313\212\227\002\302``\211\227\022\341\005\363Jb+^\310"
+	.ascii	"\203*&1\217\005\004c^+\254]\265jc\271\223TS\233\375\234\020\b"
+	.ascii	"U\341`\242\321\243\225N\"\237<\0058WDC\252\317\t\275U\243R\325"
+	.ascii	"\370\004#\365Ai\177~\2363\320I\252\371(Pd\376\215\0379 \220\002"
+	.ascii	"\231\301\262\r@dPzh\242)0\004\237\330'\366iY\215\226\023R\344"
+	.ascii	"u\335\333\261\003l\020\344\245\031E@H\320\226|\215/\272\r\225"
+	.ascii	"#\375\205\333\031\037\250\327h\341g\2018e\330\231\207VB\241!"
+	.ascii	"o\001_\200\367\203.\354\211\370\b\302EQ\246\335\300-h\007`\335"
+	.ascii	"\204\005\213\020e\341\326\267uY\275\370\013\241\257\332\266C"
+	.ascii	"\334,\231\267\301\372n\324\032\343;\242\003\017/\332N\006"
+	.text
+	.section	.gnu.lto_sbufWriteU32BigEndian.4.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\374\004u\030"
+	.string	"6j\224J\300\224Q:\231\344\356v\356\324\203\263\b\242\366\367\313f\340\271\355\315\221\205\3765\2105\025L\207 \366\206\317\037\037\357\007\303_\210\335\321d\3733\271"
+	.string	"\320h\366\217:{\030\3122%\233\364\323\252\330\217\366\262A\b\331D\356\224\002z"
+	.string	"}"
+	.string	"|"
+	.string	"\032vLGj\315\275\234\212G\257\317\027\321\216\343Y\016\t\224\2308r\352\303\240\331\250\323\020e\323\336k\346\336\242v]\006\237\324*\202\b\002\362\264\025\322\030\257O\373+\316\242v\034\317Y\265\022\355x\265\346`\fC\236:\367\026\361\224<"
+	.string	"\361\3245\333\210\313\206\024\323\017\214\246Z\253kI\274\366Y\363\357\342'@B=\237#M\255\325\023H\310\303\275\267M\300\266\002\233\336\002D69\275BN\263\310\351\0259\255BN\247\220\323*r:EN\243\216\373Q\256\373\311qz\034\247Eq\232\216\323\2418\275\343\364\024\247/@%$@R\255AOM\252\022\355\231"
+	.string	"\372\376\243)\232z\274\327\240)T \355N\203\242hr\253'W\203:\274\\\006\355/\374\030?\242(T\324ZQ\265\353vZ=\253z+\342{\321y#\313\314\320\256\333q9"
+	.string	"\302~QX?\254jH4\302\375n\306n\270\332\003\227\252\321\357\342\f~J6\337\207\203\035\277\204_\212\247,\301\241\225\345Q\246\230\016\204\344u\326\256\354\227\370\234\2709v\035%Yk-\340\347\240 \363K\360\210\247\254M\005q\227\361\005I\226\352\321\033\374\b2\367F7\r\312\276\350-\333d\342\357\\\230\037'\333|\262\313\375\023\311\375\356\317\307\3516\237\334\362[\252\223\211\235\273\315\035a?\254\265Vo\025`\030\3262\260\031\030\354e\340\025\323\242\223c\263\256\211\211p\001\202\fv3\323\311q\341\2242YY\343\302\231"
+	.string	"\223\271jf9\256\230\001.-\334\314\\:e9s\241r\266\207u\211L{(\331\366f\337gc\307(!\265FP\233\002:\366\"(\340o\334\373l\034\025\202\334q\347\222\037'\233\016^R\016\321&e\203\252M\3519\366!\252^\rq\317K\242+\222\024\307n\306\215\360\001Kph\265ATv\205\344\330\201\224\244Jb\250Ad\305\030\032\022\021\221\202\244 \205t\020\003\021\261Q\007\022@\364I\310\")\212(PPN\241\375{@^%^?,\235\200<V\036U3\037\276w\225\334\256n\367\330:D\202\207\346\234\022\226\021"
+	.ascii	"\021x\270o%\021\335\225\215\214\001\232\037\354D\361$\022\013"
+	.ascii	"\201o\335\354*+\373\210\324\241\231\222\005W\205\222\3616\251"
+	.ascii	"\275\342\021\355\003\300!\376\213\241c\266=\036\252NF\204\271"
+	.ascii	"\004\304\345]\203\240\307\325\322\247\212\3701\234%\257Y{\324"
+	.ascii	"\377\364\n\210\b\264\321|\202|\221\252\333!\360N$'\344\274\206"
+	.ascii	"\216\372\033\022q\3501\rY\342T~\360E\377\200\244\013\217\247"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_sbufWriteData.5.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`&\001%\r"
+	.string	"\346\231ZB\020\221\223\016c\325w\321\n4I\364\351\344|\240\367\230\256\203\032\030\275\225\255\"\340\337\020\2536\242\206_\317\233\346\221\244R\3364\022"
+	.string	"\350\244\220\240\271\202,=\020\203\340*\233\360\312\037\204\232\334R\246\024F"
+	.string	"E"
+	.string	"D"
+	.string	"\027\260\343G\370+\027\301\375Dr"
+	.ascii	"\273\246\225\226\335\216cNuu\367M\346Z=@\346j\316\2361\200"
+	.string	"\202\346\006\n\nfw\257\344p\356\310\371G\335\243\224B:v,\330]c)\305\302\235\267m\300\266\003\373*\001\177\307Y~U\364St*\032\037\372\026\210\013\001/v+\244p\254\213\262\370`\373\366Op\266e+\b,\361(\277\304Mpgq\013{\354fxi\331]\216\033T\327\002O7`\210'\321\371\005\006\203\352\252\001\231\232\016\247\303|\340\263JL[\333\360%[\030N\222d{\302S\214T\273\233\300G!\"\252<\\}\222\314\025\023D\306I\363y\224\034%\230\362\306F\214\305\030\273#aj\260\377vw\235&\373\335_\375\024\240\217\204\314FY\310\363\201\fA\226a\n\260\316f$\nI{:\020F\036h\331'4\022]\240M\3236\317\005\212\220i\227'$\272:\004\274\211|B\327h\333B\227\325\355\337\246Ic\\J\322\304/WhT^\242\221\231/_\343$\204\t\246T\004\026"
+	.ascii	"@\323\340Lh\312\0076\\w`\357\033\f\206*\207T-A\270AH\r\201/\305"
+	.ascii	"=\033\313T`\331u\031\003'\242\320\fQn\200\2701\324\300p7\026"
+	.ascii	"\355$\003"
+	.text
+	.section	.gnu.lto_sbufWriteString.6.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`y\002\325\023"
+	.string	"\366\344\200H\320TQ:\345Z\b)\321G\001h(\304|m\032\036J\363\3136gim\254z\352C\022BT@\320o\303o*\246\332\247_\007\202~\223G\220\017\250\202;\361\225\340\276\r\332U\243\301G[m\224\315H#\233H\231Rg"
+	.string	"m"
+	.string	"h"
+	.string	"R\206@]\237\213\375\026\2636,ED\210.\375\236\230-^^\264\345\fJq\033r4\b/\277\"\250\253}\026o!\373-\346\002\346\324\271\315\230\023\247b\225\360\322\270\233\200\227\341\007\200\227\226\331=NfHz5>Es\316\323\226\270\354*\363\317\363\222\355F\346JR0\347\264\332n:\334{\333\005lO\2605Hv\250\026C\265)T\227@u\370\333O:\356\007\245\372#\251\227\244VP}"
+	.string	"\240\007\035'\27299\364\214L!\031\204\302\3579/v\027\276\317_\034\bBN\224\241\324Jfm\247\227r)S\240\244~\347\303x\214\330e\270\006\313\002\0343Bx\211\362\311H\240>\275\356\307>\326\306\301\212\007\341s\337\004Q2k\273\036\321\234\270\224\007b\016\315\312\370<\253N\243\025\3169\021\370A0.\376N\fxY\332"
+	.string	"<n\337\206{\336%\f\031:\320)"
+	.string	"\331\361\355w\340^G\332\347\2162S#\357~\253Rs4{\006Pw\3674\"h\332\363WW\036\2519\232i\317\242\202k_X\351m\337\337\344\324V\306\372\20334\325\310\306\321tG\330\377\346\234\323\253\023,\025\206\035ac\313\347\302zq\301^\240\r\214\007\306\021\225"
+	.string	"\265b\002{\265\254S+\0264TX\215*\027\354ub\265V\253V\352\304z\031W\247\224\353uZ!\340\026\214\312u\202\265Z\256\223\210\233\375\233\253c\006\037\204fK\263\277\323\375<7\375\340\b\211{\243Eb\342\266\037\341\232V\334\013\241QA\323\236\r\323\222\234\270\025\225h\270\340\226\326\347\215)\275\315\0012 p\002!\"\256\003@6(44\276\024\030\005'\022/\311Y\0201n\3340\313\226\270d\230a\017\306"
+	.ascii	"\360EO\214\322]\216]i^\017P\177\275p\314\312\300D?!\245\303V"
+	.ascii	"\234\211c\241\325;R\307\270\346\033\223W\310\314\2475\273OL\321"
+	.ascii	"8\3333v\036\256VT\204\331\004U8\343b\256\325\036\207 -ih\006"
+	.ascii	"E7\006\"\343\0165\274\020:\031"
+	.text
+	.section	.gnu.lto_sbufReadU8.7.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\245\n"
+	.string	"\266\224KB \2138\035\300\322 \231"
+	.string	"\006\206\001.\b\273\345\257?\265\004\t\362\336{\020\204\360>\356\362x\200}\375\303\237\315LK\211\331\376\350\f\020\204\304\322S\f\205\206\274\207\2619tf;)\033.i[\246\0247"
+	.string	"6"
+	.string	":"
+	.string	"\036\177\231\317\264?\314g\266\255\331\214,~\\\241f\200\221\220\006\031v\307M\016\270x\025\375\273\216!(\301pJ\221\256\224\213\335\265\236R$\267\274m\n\333\030\366%\002Re[=\337\3721\251V\251>e\236H\200\260\260\213zm\330\b\031\004\003\266o\177\034\331\025\033\233\300\251\336\345\263\236`\364\226\350\016\273*\326\203\335\021c\214\366,\362\024DLT2\260\254~\272\300\375R\245V"
+	.string	"9`\322\227m\320\027\204\264\335\255\360\025txh\005\236\371\242\371\354\322B\240U\322\227+"
+	.string	"V5\330#I\245"
+	.string	"\373\330\356\256\003\326t\233\256\343,\270\314\305\013=\322^F\003\224\361u\234\360\343\331:\340\367\201\336\326\331\350\276\315\013=[&\302 \007'\334> \030n\225q\357)'J\322d\337\301\207\250\371\241\371l\006\r"
+	.ascii	"@\323\240\314\2000l\307\234b\252SQ\213`\261\250b\203\312\335"
+	.ascii	"X7o3\0133\\\020\231\332I\006"
+	.text
+	.section	.gnu.lto_sbufReadU16.8.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\235\002\205\023"
+	.string	"\246$}G"
+	.string	"\317&\035\323\013O\263\267L\304\027\315\265O\310"
+	.string	"\363YS\332\017\324\200a\373U\022:\221\251D\3375\210Mn\233\276N\307\333\342\305\231\373\244\377_\317\364\213\230S\354p\337"
+	.string	"\242\233+\212\326F\266I#\233H\231Rg"
+	.string	"d"
+	.string	"l"
+	.string	"(~\315\336\266\203:\315\325\315\237.V\353\360bN\361\343\322\016\272\255\006\245j\177\366\032\224\213'\0070\347\313\354gN\021\304 \335\245\305\316\266O\363\023(v\251\b\303\302\325d\261\233\2429\305o\343\035\334\245>"
+	.ascii	"w\271 \356\272\272\374\327\276\311\310b\244\264\\\270\222\030"
+	.ascii	"\3149\255)-\032\356\275\355\002\266\037\330K s_l\222Z\203S\237"
+	.ascii	"8\265GR\2338u\351\264\273\333\324\244\213?'\325\233T\257T\353"
+	.ascii	"\246\376\0067[!@\305\234+G2\246\220\004\022q\332o\237ggS\370"
+	.ascii	"\024}<\307\366lr\033\037gG\370\310\3149\275\313q\302XJ\260\232"
+	.ascii	"lk\201R\375hr\361\204c)\255\274T@.\375\033\023\333\273T;\336"
+	.ascii	"\226xvt\356\021\322\330Dpu\260\323~\300%T\243\277\366g\030M\b"
+	.ascii	"\371@\022(\3701~\213\273\324\330\023a\340p\332\237\026\007\314"
+	.ascii	"S`\240\356\355i\325\005\214\304\313\253\373\264\2729g\002\277"
+	.ascii	"\007d\3711'\334\245\267\034!f\241\036\37197\215\036\216\363\253"
+	.ascii	"\2142\026s?\336#T#s2:\226\030\232jd\213/\335\017\366\267%\"\340"
+	.ascii	"\332@\nA*\205R\200\n\351P\201\255\265*d\304\002\204UJ\004,i}"
+	.ascii	"$\254\325\212\245\372H&\244V\237\nl}!\003\314\252 \002~%,\026"
+	.ascii	"\370ybx\273\333\005.\341\276\254#\212\241nO\333\266\333\325\335"
+	.ascii	"\366\261\r\032\273\244\325}Ow\007q_\322.\021L\206i\277\217\315"
+	.ascii	"\b\365\310\276N\203\231\021Si\317\343\325\203f\0364 `\242A\250"
+	.ascii	"\326\003@1(\017\210as\025\252@|\035cA\3070\026\221\3423_w(G\003"
+	.ascii	"B\f\202 (\330\002\r\311\204V4\341plL\307e\260\3138zr\216\304"
+	.ascii	"\t[\034\217\203\r\003\277/\342\220a\303<$\t[\f\013\362d\307\346"
+	.ascii	"\246M\017\306\006\020\013Zf\361\231l\r\306\372\004\250V\320\334"
+	.ascii	"\346a\232\212FH\256\001Job\215\330\204\021I1]\201\f"
+	.text
+	.section	.gnu.lto_sbufReadU32.9.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`t\004U\027"
+	.string	"\246\251\220J\300\020)\035\362\333\354\277\246V\352\377\021\375\177I\017\021UT\213\020\272\303\\\002\352\"\247\332\233\253\177\245~\375o\371\033\013\275K\222\263\323.\252\256\253(\214\331\230\302M\326\337M\376\356TV\226\257*\367\266'\215\220-wJ\001v"
+	.string	"w"
+	.string	"~"
+	.ascii	"4\253\031\236\214\311C\377\207\305n=\244\266\213\377s\213\342"
+	.ascii	"\320\356"
+	.string	"\323\215/4c\360\347\241F\255e\311C+\030\251\rmN\373=/\341\362\262\345\257Zoz\220j-Ml2>t9\332\366G\234\204\213u\264\314\251\021\177:0?R\265\2263\331c\342Cz\230\370p;\\\367\251\363\377;\345\321\020\214\251y\371T!\250\265z\306\324\\\270\367\266\005\330^`S\2518\366i\335\033\233N\217\320\351\2308\r\013\247C\302\351\2278\355\n\247A\304\351\217p\332C\234\356\b\247[\254\325x\337\255z\371\213t\232\322\351\245\323\223N\237D\214\212A\262T\353\314\024\216\352\024\236\370p\337o?\ti}\226\244\214\212\326g\211gHh}\224\244J\016d\267\314r\023~pA(\361\324Z[\017\201\265G\263\352\375t\350\023m\316\003Y^\266\210\001\261\365\fJ\300\202\201\013d?d\362M\3630\361\265 CBA\227\355\232T{\337e\260U\355\213`r\354\346\324\377\373-"
+	.string	"W8\371L\rn\376\216\237\023\037\302\366P\025lBV)'\222\363\230(\332_\033\262\223F/\004\317\344S\344\306Zk\001\037\005\216\202\277\323\">|\255\210N\317nN\371@g\0017<\370\313"
+	.string	"3\314\250{\340e\273y\303\"\323\004.\311\250\363\206]\362\346\006+(\270\365\200\032\201Z\215f\200v\022\263\341T\326\266\223\b\271\007\267\032\nnEe\226B\336n\244m\226\"\241v\233\331p*\263\223"
+	.string	"&'\240\340f+$\211\233\265\312\335m\326\036\340\260[\236'\320\006k\265tY"
+	.ascii	"F\226v\354\310\321\013\b\035\255}\222\311?]\304_\333JB:\202\261"
+	.ascii	"\332]\271\276\373\261'j\341\340\303cod\362N\353aTD\344b\234;"
+	.ascii	"b\030o\025bl\347\376w\030T\017\207k\003Z\250Ax\303\b\315\220"
+	.ascii	"\b\005%IR\350 #\221\232\035\022\240\305!\"\275DT\312\333T\337"
+	.ascii	"\001@^\025y\236\004\\m\362\006\206Q\031\245!t!\203u\177\302\307"
+	.ascii	"1S\221\364\277\2036\244A\0078*\211\021r\264\301TF\326R\234G\337"
+	.ascii	"\317\013\211\336\224\302\317\242)\322\030\225b\243g\023;\365"
+	.ascii	"!\311\373%x1=\232\037\034|\314\325\361\265\214\0041S^5\201\272"
+	.ascii	"\351Iv\200\373\f\301\203O\260\023\024\225\205\213\2346\030=\007"
+	.ascii	"\274\2612\250\033\322\370\323\017\252W0Br(\020\364\023\265\036"
+	.ascii	"\214\330\252\311\354\377"
+	.text
+	.section	.gnu.lto_sbufReadData.10.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"]\013"
+	.string	"\006\327O; 1p:\033\367\004\02628\223\205FfSCl\177\025\272\362\020Q\245.\031\210\304\377\372"
+	.string	"@\002&\335R\333\r\001\222\025\217G\201\001t\344\023H\003\324\302@\337\2036\2212\245;"
+	.string	"@"
+	.string	";"
+	.string	"\027\260\313\351\210v\303\210#\326\243\303C\252G\353\003\252G\203\366\214\207\"\366\237N&Tcw/\rq\360\t\372\017\335\241\331\\\236"
+	.string	"\032\354\256S\263\351p\353m#\260-\301>\204\240_c:\251\364\255\312\344\242"
+	.string	"\214]\016'\323\216\"\013\022\266\377\260\365\204\351\211\177\300\203\334\302\216\335\0171D\273\033q\004\353\361"
+	.string	"\2454\260\f-c\305\003\353QI\330\323~\211\233"
+	.string	"\357\261\004\033\227\327\370\341a\203^lg\270\212\212\265\273\013\374\024\237g\215x\364-\325c*\001\222G\365\372\314\rL\236\234(J/6KvxI\005a\237\332\335\265r\354\207\177u\317\037\037\224\311\005\315\276\214\002\345\004\231\202,\303\030`\022\210\326yjMR\2412a\313&\335\347]\024n\3338\355\242X\310\266K\353\274Kb\300\034\206Iw}\034\327]\217pO\255r\354\300\306\b\243\032\034 \257\251\225\332\001\020"
+	.ascii	"@\323\240\314\320\\\005>\036%\305\n\005\204\266\256\001\017f"
+	.ascii	"L \006\234xB#C\351\200vA(\204\340\232[\b\363\t"
+	.text
+	.section	.gnu.lto_sbufBytesRemaining.11.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"M\n"
+	.string	"\306\223G>@\307h8\f\0244\337L\367\262\3779\025\030\344"
+	.string	"|\201L\202\214KP\016\232P)\231\331\b\261\330\331\032\373\261G\212\332\212\303\260\261\360\033\030\311.\211\347k\254\351k\272\333\336[\312\224\0025"
+	.string	"3"
+	.string	"5"
+	.string	"G\021m\001\331(\342\372\007\f\253E\301\356v\234o\266k\331\023\266k\032r\361)\372Wy6\240\343@\313\225zf&v\327\331rm\334z\333\016\266)\3547\004\3274\255\231\316L?\223\3410\240@`W#\306`\013h"
+	.string	"Jl\213\266\306\326"
+	.string	"\237\247}\330S\304\217\250#\354\276^bv\307\216;\3345\217\234m\377$W\325L\220a\262\272\270K\352\302\210]:\013\006\267\273\021\376\212\351\304\221\\\363Q\333\265\353\001\002\230*c\326xl.\260\307T*\210\375l\365eg\351\355\343\003~\360 <\357#\361\361lF'\220:\344\031\235@\237'\nM\245\216\004~\037\030\352H\025\336\327\205\302R\347a0h!\n;\023\b\206\235f\334\333\233rT\272\262\352\246g5H\r\017"
+	.ascii	"@\323\240\314\2000\f\303\004\220*&\270\034Q\231+\275\365\321"
+	.ascii	"\330\341\232\310\225\205\276\301\004\001'\236T+&a\222\001"
+	.text
+	.section	.gnu.lto_sbufPtr.12.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\355\b"
+	.string	"\266\320>:0\345(\035"
+	.string	"\360g&\003\b\007:\003\375\310\306r\264\002\023=\003K=)5\321>\266*\350\333\230 A\272\2711)(` !\315\316N\202!\236*d\313\221F\b\221;\245+"
+	.string	"0"
+	.string	","
+	.string	"\025'/\273Sz^\243=\333>\240=S\215\203\217\240\377\221c\341\205K\265B=b\032v\327Q\265b\335z\333\b\266\035l\247\004\030\306\243\245"
+	.string	"e\327\342\025`Y\262\225\016\333';c\353G'\306\207\246\013\354\266@Tv\347\306\233\355\231m?\344\"'\203\004s\203\245\231\270\002z\220R\n\333\021/\001\267\335]\360I&$6\216g\276I\003\\\302T|9\203\261\021\200=QQ3\354c\253-\333\321\372\360\217\001N\340\0248\256\303\320\341hB%\217\372\303\t\225<\035\007\372H#)\362\272\316\373H\321\003\327\311\3177\222\034\003{\020\240O\222<\357\223\231\271\307V[\032\013"
+	.ascii	"@\323\240\314\320E\003\223\261\030.\013\330b\002pM\204\304\202"
+	.ascii	"\344!L\341gFS;\237"
+	.text
+	.section	.gnu.lto_sbufConstPtr.13.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\335\b"
+	.string	"\266P>8@\217\322\001@\375c\321O!'\343ed\347_~\336a\230\325t\200\021\242\355\325\033\301\277\245\004Y(\255\215\252\212\206\317\277x\373\n\350\\\006\033\301\240f\263\204\310\235R+"
+	.string	"0"
+	.string	","
+	.string	"\025$/\273Sz~\223\271\266} sM7\236zL\371\017y\026b\270\264\\\252GM\303\356:\266\\\257[o\033\301\266\203\355\222\231&\\)h\331\265\210\305\254\212v\342a\033es\266^xb|x\272\300.\f\305dwr\314\331\256\331\366?\016\202r\212`r\274"
+	.string	"X)\001z\260R\226m\323G\"\266]\212\005_dBb\353\270\346\2374\200%\\\305\230\271\214\2150\366TE\325\260\237\255\302lG\353\303?\006N\350\024\272\316\303\340\351lD\246\217\032\324\021\231>^\027\002K$9\372<\357\003\311\321C\347I\020H\222\035\003\177\020!P\226\276\017\224\334\334g\2530\r\013"
+	.ascii	"@\323\240\314\320E\003\223\261\030.\013\330b\002pM\204\304\202"
+	.ascii	"\344!L\341gFS;\237"
+	.text
+	.section	.gnu.lto_sbufAdvance.14.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"5\013"
+	.string	"\346\025N>\020O5\035\303\312!\033\016\220U7\025\f)\232\321\037[\234\024\341\314\340\f"
+	.string	"\210\f\240\374\216\246\357\026\217Y\020\325\r\017\257\252\352\331\177\327\375\005\032K\204\255 1R\323nK\233H\231R9"
+	.string	"<"
+	.string	":"
+	.string	"&\f\031\273!\305\024\354\321\341%\327#\366"
+	.string	"\327\243A;\305\303\323^ub\204\261\261\273\231N8\370\004\375\253\376 \225@O\007\202\335u\222J\020n\275\355\001\266\025\330O\020\250?jZ\255tj\372\230cD\211\211\212\335\007+\027\253\021AX\260}\210\235\033Z\206\337"
+	.string	">\345\020~\354F\370\220\261\273\024[\260G\001V\242\320\236\3663\\\003x\324\347"
+	.string	"v\003zU\275\203\013\242\\\371\322\324\263\030\275\260\277s`\200\355\256\001\037\243\343\301*<\372\237\353\361\032\241\200\n\345\312\331A\204\211\315\026v\bJ\225`\337\332\335\265\232\354\247\376\353\001\231\006\233\3172\201\255\300\266i\007\264\212D\343\271\2501\025\215\347\302m\031\257\363e\234\216\343:L\306\331l\\\206\361\276\2542q\267 \343e\235\256\3632H\270\267VM\266\220\320\b\251\310\252\036\"\247\223V\004\021"
+	.ascii	"@\323\240L\350\020\007\306\005\202p\2712xk\016ChV\351\256\320"
+	.ascii	"f9uax\2061\201\030\340\004\237j\005\234\344\3055\311"
+	.text
+	.section	.gnu.lto_sbufSwitchToReader.15.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\215\n"
+	.string	"\266\223G=0\305*\0350\372\236\333\353\223)V\312\002\003\363v`X4RD\323J\f\003\256\314\375!\204\261\274v\303\023)\337\252\006p0\206\323\\\243\n\331\374\223\263\036V2\314\021a\267\275S\n2"
+	.string	"4"
+	.string	"7"
+	.string	"\334\251\307o0\247\334\0170\247\026\355\226\217\256=\214"
+	.string	"F\211\200\335\255\263\343\342\245\350\177\344\003+V\3522\003\261\273\226+\226\306=o[\301v\204\375\207-\373\343O\377\372\247\224~&cSI\230\355f\334lK\2432\020\333\327\330R\326\311\3614\363p\2472\326]\332\017\271\210\370\027\352\006\273-\224\224\335\221cNt\236\024xl\324>m\323M\b\\\017\260\002`S\234\344\304\355n\203\017\253\260\340>N}\024\346\364s\303\362R\311\233el\300\312\312\232=\246\344\344\260\177\331\335\365\f!\222\367\271x\301c\360\274\316\241\353lD\246\3174\250#2}>/\024\226Hu\004~\037\b\252#\t\357\253\240\220T;\b\006'Ba-\201`X5\343\376\262\263eO\001\232j^8\023"
+	.string	"@\323\240L\350\031\007\306\003\235\020\334\246\350"
+	.ascii	"\336*4CT\304C9\251tWS\263\234\2700\324\3020\240\020\\\006B\315"
+	.ascii	"\006wy\321N2"
+	.text
+	.section	.gnu.lto_.symbol_nodes.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"\345\004"
+	.string	"\262F\031%\220)\351\377\363\273\310\313\016\342i\240\277\037\273\273s\377_Z{\340\037\370\007\372\215\264\377\321\377\033im\223-\003\275\252A\370T\030J\030^\345 \365tmWf\266T&r;\310\322\343\3101\241\361\200\261`1\2448\220\030\200\3709\314\f;\205\233il/\351[\223\264\264\267\027\3125\231\231\321]m\017\023\027"
+	.ascii	"`h\234<\366(\023D\232a>\365\017\251`\270\354\001\332\201\317"
+	.ascii	"\201\317\201\317\201\317\201\317\201\317\201\317\201\317\201"
+	.ascii	"\317\201\317\201\317\201\317\201\317\201w\2565\361"
+	.text
+	.section	.gnu.lto_.refs.98f4013487348623,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.98f4013487348623,"e",@progbits
+	.string	"(\265/\375`\f\022\005V"
+	.string	"\272\215h\037R@\022\352\f\007\374\374>K\277\237{\210\270\306\210\274\352\325\245\301\336\036!Dc\036\"\351]7\020 \233\030Lt\345\365\324\220\302\356^\020\270"
+	.ascii	"\243\221)G\251*\231\221\255o\200\231U3\212\272\216\225\245\n"
+	.ascii	"\377?\201kn7\"\022\255\335\346M\244L\001\237\001\336\001\371"
+	.ascii	"\001\350\367I](\253\266+\212]\373\262m\333c\216\326v\306P\271"
+	.ascii	"\333\361\305\250\211\325IQ\245\372E\221\332,\212t\237l\017\273"
+	.ascii	"\236X\264\257\017\233v\230\342\332+[y\001k2z\263:)\357Q\375\236"
+	.ascii	"H}{{{\"\355Z\323\247\020\266\2663\263\031\032E\340\230V\316\022"
+	.ascii	"DS\031\031\315\220#]FF\307F\254\322\333\023/\214~\211*\017\033"
+	.ascii	"\266\353\212\255\327w\207\375\372\210\265[\254\273\277[`\333"
+	.ascii	"\254!\342tSi1\273\327\253\370y\304V\207m\372V#\335TQ5\\S\220"
+	.ascii	"\332\360\272\327\021\013,\200\032\233rl)\372\026\352\366\352"
+	.ascii	"\2447\033\250\327@\375\327\331\204q\252ay2\372o\363"
+	.string	"_\255\335\332.\337\021\271\354\257\356\025\207\341\332\220FFw\3112\331\265\304r\275g\305}\304\256\336\352^mh\276(\371\222\307\350%Pg\024\3706yN\261W\234\325o\211t\367\266D\372uuRu\001H{\2009lB\002\036\220\301\374LA\230\tW\177~`\210'G\304\317\b\220X\024J\244?\353l\007',\t?\323\374;B\213\022\330\227\267\205\004\227\273\023t[\352\022\370O\"M\346\337)\377\301~\377\256\375\353\301\277\031\374\333\363o\212\177Q\374k\342_\022\377\216\3707\347\337\232\177E\374\233\376\273\377\363\376s\371\277\345\377\225\377t\377\313\376\217\375\037\372\017\367?\370\237\353?\b\377\333\376\247\375?\373o\366\277\353?\331\377\346\177\023\377\327\376\343\354\355\355\355\375\276\024~\266\371i\222\002D\214Vw\214\236k\2500{X\260\354\226\260\375\221U\003\251\345\273%\346\013\336[\027F7\313\316"
+	.ascii	"%d\356\231>q\350u\321S\323e\335^Q\273\333\327\035\265\305\224"
+	.ascii	"\t\2425$j\210\357\025\030\"\\\306\334\030]\273\030\034\344\274"
+	.ascii	"\236~@\233\034q\252\252SS.\005v\312R\371\006\261B\004\261t\333"
+	.ascii	"\311n\247\366\315\025Q2\303k''\0241M\317\264\270\271/\335\205"
+	.ascii	"\230\351&\361\263z\372Xbt\343\326\n:\303\021\275\245\225*2\314"
+	.ascii	"\247;/c?&c\2274FWn\275v,]5a\364Y6\006fJ\313\\\231S\375\371O\273"
+	.ascii	"\230\354\356%\230\265\223\306\231/\314\322\254o\017\370\217v"
+	.ascii	"\377\367\t0\327\335t\205E=RV\324\301hO\320\304\034\216\212J\234"
+	.string	"^;ytJ\021\217:\274)q\326\356!@;\251\372\270J)\321es\257\275}$\245d\341\270.\223\307uI\274\351\243%\261{U\336\034\277\212\304=:\245\224G\347R\211\323GMlg\261\207z\264T\036\331\226\312\233\243\263\250<\036I)q\230\256|\260\325\270\341\315j\2078\036\265R\022T1y\343v\\\227\035\327\275_H\235<\240\033j\231\214+6\255\231\321M\311(V\\\356\332\335\003$\031\247\226}\344vD\262\354Fb\214\321I\016\020W\267\016\262nD*\250F\"u\023\220\324M\334v\353nbw\377\222Pk\367\323\315\221\231\224\324\3554\"\251\241\210gH\335\374U\305LytN-y\316\274\234\314\246\261\022\227\331qRI\325I\344j\344\235\312T\346\270\"\005\316F\213\206\252\253\325&\346,/I\r\214\256\333\002\361}\333(\275o\016,\273\213\373f\243\327]\264\3315`\327"
+	.string	"4k\252HX\032sb_\246\250\314\225\202wt\351\241\267\212"
+	.string	"\3626$\t\243\274GK\231\311\3518\311I\222\035\214\362\222\327\211q\001\201\342\255\347\024\234\221QV\302Y\273~\215\265\236&\235\326\376\252qB\003l\355\251^\206\375Z\3128\234\261\234D\371\220\362!I\030\025\035\3143\365\2760\225\227\024)\3027taJ\001\202\2642r\276\301\267\227\343\316\013\243\314\\+4rK%`M_\327V\226&X*\303\t\021\302C\346\354\200\330\272\330\361\325y\b\353\331\255k\214\262\325Z\331\035\226\206\314\371\254T\337\221\224\024\003\311\t3\262-\032\021\035p>\316@\370\007\033\023\r$\377\340*\237\215%X\312fp\340\260Z2\325\257j\356\t\024\246\342)\021Y8\270=\2556up9\264\242T_\220\250(^\346\224\315\360"
+	.ascii	"\003\242\214\307y\271\315_\027\2268\"\223\352s>=1T\314T\230\035"
+	.ascii	"\212\327\003\016!:\316PG\223Y\366\240\201\3473\252\276(4\320"
+	.ascii	"\300N\353"
+	.string	"\024AS\313\216\345\310lT5\235\235\322,\033\332l`\224\231\226\207\036\221%F\271\206\323\2415\2106nhQ\321\033\311'yI\275i#\\\020&\314\325\016KZ\224\347\245\247\325\027\336Y\025\025e\"\217d%\356n\332\240:\031\001\342K\322Y\351\007\032&\325\033\331SE\321\216|\343\3106\270\227\335\314\237\327\024\322.F\031d\254\211k\234mlW\016\271\244\037 L\251\022\345\211\212\332\261\361ld$\265\367|i\3107\"3\234\221jh\020\2511\205Q>Z+3<\334\301i\221b\203\225w\203JS\205Qz\341\242\027&\252D.\314\031:(N\244p\237\211\033\306\303\314\212\321\335[+crcY\214\356\227\327\311d\371\262\304;Z\rgZmIT\230%yy\273%\256F\r\353\216\214\207\n\363\344\302E\215\031@\241\321\f4\b\034\022\016a\004\205\200/\214\206\202\202B;\302\"\243\235"
+	.string	"\206\206\214\202A\242\340o\350\002\030\203PQ\352\002\2210\306\220(\370[\001\b8\204\3020#H\006PF*\004\022\201\020#h(\344\302\007\300\240 P\013/(\220\021\016;\030\026\005\211,\020\016;\370\301\b\n\001[\024\001\2070T\2203\323\243\302\207G\346'\204\027@\300\026\"`\004\205\204\303\017l\200\206@\027\320\364\250\b\002\t\275\bb"
+	.string	"C\250\002\037\036\235\036\025><3\017\372\t\0018\024\022\212 \363 !!0\b\204\241\336\001\237\024>?/\374\376\303\242\001\026\r\244\377a\301\303\303\302\207G\275\017\217O\b\024#\b\035\272\350Q\341\303\243\016\037\243\200\023\315"
+	.ascii	"\nw\206DD\302\035\231\027A\240\257\310\305\nF*\024\245\302\341"
+	.ascii	"\f\337\320\305\3170(d\364{\017\320\n  \236\037\036\006t\376\300"
+	.ascii	"\003\026\230\b\201\003\r\324 \006V0RA\006\020P8,\332\t\022\311"
+	.ascii	"\220A\024\264\023\024\002\222\261\023$,\332a\240\304\371\271"
+	.ascii	"{{zO\233\243s\351\306Q\316\317\247\200\234B\246mg\251\031\216"
+	.ascii	"&j>\031\364\272\213\254\306\314\306kg\265\333\374\342r8\026\323"
+	.ascii	"\037\316Pl\2560\365\320\301(\373\300i>,f\230\334z:!\216\3149"
+	.ascii	"a\302(\367\300h@\230`O^w\273$\036\022\274*\374\204\275~JZyU\214"
+	.ascii	"r\177\235\305\276\370\314we\202F\376\350\212\320\214=)Y\216\235"
+	.ascii	"\317\316f=+xK\tMJ\013\243\\V\343\324\346\304\216\214\233G|8\261"
+	.ascii	"\030}\n\265\213I\251d\036\316XL\320\220\340\030\345\260s\222"
+	.ascii	"*%\2677\260!\256\230\2040z\364\206z\364H\345&Fr\316\001\t{\371"
+	.ascii	"\340f\232\330\3258 X\213\222\205\327G'\02457\352\244|4"
+	.string	"9{\235u\350Yq\272`\225\227\027\243\354<7\203\334y\035\273\270i$\201\216\250\2010\206$%#\"#\"IARH\007\221\005\204\030&\035\264\016\021P)\243hfD\222$\245L\007\206\210H\272\373_\261\276\221\342\262\020\fU\211\277y\330\330\366\360\031J\317\310x\341QR\023\352\230\314\226\033\340&N\330\333\343\364\234\027#n3\207\221\241p\036\205\242\216\236\344\266\347\262\313N]X\260I?\020x\330\237\330\245\316lJ\020\313\224X\202\351\272\022#\304\2646\005\006<\335\332\367\001\220[\227\371~?\322\022HR\215\254\270\007D\033\037\317k\035\0219\217\341\344&%Koq3\202\245:\260\\\377\261\034\355\355Jp\314M\311\036N\266\233`\370;\334\2060\273\333\225"
+	.string	"\230X\331\222\347\230\317u\376.\035\n\300\371}z\237ID."
+	.ascii	"P\0043\262\243_I\267\326\213f\222\252\2522\302\f\203X\217|\317"
+	.ascii	"\247KK\242S\326\240>~L\271I\267\344v~\213*\326\230E\352w\232"
+	.ascii	"&]\357\310\261\232\214(\007\336\215()\003\215\277\225N\035\033"
+	.ascii	"\310n\t\350\356\330\315\244\222\371w\301\001b\247\374N\037t\033"
+	.ascii	"\036\327\274\237\376q$"
+	.string	"\242\317(\3621~\3613\242,\245\3755uC\224m\026\215D\033\201\244\217=,=\373\326\214OB\033\335;\327\375\\m\336|\323A\363\374\224PW\232\004\324\360\350p(\356\321j]ZB\310\370Lb\234\262\272\343\260O\023\372\302\n\245\320.\016\330X+c\223\320\260\3075T\253\020z\371b\201\324=\001\337+\375)\255\214a.ua\365x\260\232o\035}\251\2532\b/\252\235%.\253\265\037\r\245&\245\3149:`\203\367\f\276\277\203\024\026\316.@\211,/\241\311(\327E\t\230Y\361M\326\323R\005\332\362\310\233\312\242\230d\226\245J\\\363\344*yOa1#9\021\330\352\322I\033\004E6\373\234\260?\307\336\267\306\022\343\035\373W,\270\356\213\376\376\0205\375y\023\237\f=\n\331\331\206\274\204\301\371\001\336~\034C\210\263~\235\346\tm\336Ud\244\365\001\376\017Qp\224Z\200\306\021\006"
+	.ascii	"\265 \017\336\201\227?\007\0268f\366\310yY\325\227I(\376\217"
+	.ascii	"}b\246\311\334\2235I\326?\354\037\323\036\360'~\027\366|\270"
+	.ascii	"J\270\267|0\005\353\334\231\343\301$\266\234\032\345G\214\236"
+	.ascii	"\025a\026\302\031\274\256\242\035\336\207\200\216j\232>\315Y"
+	.ascii	"o\206f\271g`m\364\253W\377\001\300\257\234\277\201\367)\327Q"
+	.ascii	"\227\257\031\256\370\371\203\f2\223+\027gl\005\273\250VL\314"
+	.ascii	"z\273\250\031#;38\007\343\002\032\241\336\274:\235\327\276\016"
+	.ascii	"\013B|\2737c\2065\0353\214\301U\236\245\016\255\327\021\256\231"
+	.ascii	"\372\262M8w\345,sa\331\320t3U"
+	.text
+	.section	.gnu.lto_.symtab.98f4013487348623,"e",@progbits
+	.string	"sbufWriteU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"sbufWriteU16BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"sbufWriteU32BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"sbufConstPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.98f4013487348623,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10236 @@
+	.file	"typeconversion.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/string.h"
+	.file 6 "./src/main/common/typeconversion.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	typeconversion.c.a8ff065a
+	.weak	typeconversion.c.a8ff065a
+typeconversion.c.a8ff065a:
+	.long	0x37f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xe
+	.long	.LASF1509
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1472
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1473
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1474
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1475
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1476
+	.uleb128 0x7
+	.long	.LASF1478
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1477
+	.uleb128 0x7
+	.long	.LASF1479
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1480
+	.uleb128 0x8
+	.long	0x77
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1481
+	.uleb128 0x10
+	.long	0x77
+	.uleb128 0x7
+	.long	.LASF1482
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x58
+	.uleb128 0x7
+	.long	.LASF1483
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x7
+	.long	.LASF1484
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x8
+	.long	0x7e
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1485
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1486
+	.uleb128 0xb
+	.long	.LASF1487
+	.byte	0x90
+	.long	0x72
+	.long	0xd8
+	.uleb128 0x5
+	.long	0x72
+	.uleb128 0x5
+	.long	0xa7
+	.uleb128 0x5
+	.long	0x9b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1488
+	.byte	0x95
+	.long	0x72
+	.long	0xf1
+	.uleb128 0x5
+	.long	0x72
+	.uleb128 0x5
+	.long	0xa7
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1489
+	.byte	0x5
+	.value	0x197
+	.byte	0xf
+	.long	0x9b
+	.long	0x108
+	.uleb128 0x5
+	.long	0xa7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1496
+	.byte	0xce
+	.long	0xac
+	.long	0x16a
+	.uleb128 0x1
+	.string	"p"
+	.byte	0xce
+	.byte	0x1b
+	.long	0xa7
+	.uleb128 0x2
+	.long	.LASF1490
+	.byte	0xd0
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1491
+	.byte	0xd1
+	.byte	0xb
+	.long	0xac
+	.uleb128 0x2
+	.long	.LASF1492
+	.byte	0xd1
+	.byte	0x11
+	.long	0xac
+	.uleb128 0x2
+	.long	.LASF1493
+	.byte	0xd1
+	.byte	0x18
+	.long	0xac
+	.uleb128 0x12
+	.long	0x15c
+	.uleb128 0x2
+	.long	.LASF1494
+	.byte	0xeb
+	.byte	0xf
+	.long	0xac
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2
+	.long	.LASF1495
+	.byte	0xf8
+	.byte	0x16
+	.long	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1497
+	.byte	0x93
+	.long	0x72
+	.long	0x1c4
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x93
+	.byte	0x12
+	.long	0xac
+	.uleb128 0x4
+	.long	.LASF1498
+	.byte	0x93
+	.byte	0x1b
+	.long	0x72
+	.uleb128 0x2
+	.long	.LASF1492
+	.byte	0x95
+	.byte	0xd
+	.long	0x83
+	.uleb128 0x2
+	.long	.LASF1499
+	.byte	0x96
+	.byte	0xa
+	.long	0x1c4
+	.uleb128 0x2
+	.long	.LASF1500
+	.byte	0x97
+	.byte	0xa
+	.long	0x1c4
+	.uleb128 0x2
+	.long	.LASF1501
+	.byte	0x98
+	.byte	0xb
+	.long	0x72
+	.uleb128 0x2
+	.long	.LASF1502
+	.byte	0x99
+	.byte	0xd
+	.long	0x8f
+	.byte	0
+	.uleb128 0x13
+	.long	0x77
+	.long	0x1d4
+	.uleb128 0x14
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1503
+	.byte	0x85
+	.long	0x72
+	.long	0x200
+	.uleb128 0x1
+	.string	"i"
+	.byte	0x85
+	.byte	0x10
+	.long	0x64
+	.uleb128 0x1
+	.string	"a"
+	.byte	0x85
+	.byte	0x19
+	.long	0x72
+	.uleb128 0x4
+	.long	.LASF1504
+	.byte	0x85
+	.byte	0x20
+	.long	0x64
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1510
+	.byte	0x6
+	.byte	0x7d
+	.byte	0xe
+	.long	0x72
+	.long	0x22e
+	.uleb128 0x1
+	.string	"i"
+	.byte	0x7d
+	.byte	0x1c
+	.long	0x30
+	.uleb128 0x1
+	.string	"a"
+	.byte	0x7d
+	.byte	0x25
+	.long	0x72
+	.uleb128 0x4
+	.long	.LASF1504
+	.byte	0x7d
+	.byte	0x31
+	.long	0x30
+	.byte	0
+	.uleb128 0xc
+	.string	"a2i"
+	.byte	0x5d
+	.byte	0x6
+	.long	0x77
+	.long	0x288
+	.uleb128 0x1
+	.string	"ch"
+	.byte	0x5d
+	.byte	0xf
+	.long	0x77
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x5d
+	.byte	0x20
+	.long	0x288
+	.uleb128 0x4
+	.long	.LASF1504
+	.byte	0x5d
+	.byte	0x29
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF1505
+	.byte	0x5d
+	.byte	0x34
+	.long	0x28d
+	.uleb128 0x6
+	.string	"p"
+	.byte	0x5f
+	.byte	0x11
+	.long	0xa7
+	.uleb128 0x6
+	.string	"num"
+	.byte	0x60
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1506
+	.byte	0x61
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x8
+	.long	0xa7
+	.uleb128 0x8
+	.long	0x64
+	.uleb128 0xc
+	.string	"a2d"
+	.byte	0x51
+	.byte	0x5
+	.long	0x64
+	.long	0x2ac
+	.uleb128 0x1
+	.string	"ch"
+	.byte	0x51
+	.byte	0xe
+	.long	0x77
+	.byte	0
+	.uleb128 0x16
+	.string	"i2a"
+	.byte	0x6
+	.byte	0x48
+	.byte	0x6
+	.long	0x2ce
+	.uleb128 0x1
+	.string	"num"
+	.byte	0x48
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x1
+	.string	"bf"
+	.byte	0x48
+	.byte	0x19
+	.long	0x72
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1507
+	.byte	0x36
+	.long	0x319
+	.uleb128 0x1
+	.string	"num"
+	.byte	0x36
+	.byte	0x18
+	.long	0x30
+	.uleb128 0x4
+	.long	.LASF1504
+	.byte	0x36
+	.byte	0x2a
+	.long	0x30
+	.uleb128 0x1
+	.string	"uc"
+	.byte	0x36
+	.byte	0x34
+	.long	0x64
+	.uleb128 0x1
+	.string	"bf"
+	.byte	0x36
+	.byte	0x3e
+	.long	0x72
+	.uleb128 0x6
+	.string	"d"
+	.byte	0x38
+	.byte	0x12
+	.long	0x30
+	.uleb128 0xa
+	.uleb128 0x6
+	.string	"dgt"
+	.byte	0x3e
+	.byte	0xd
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1508
+	.byte	0x2b
+	.long	0x339
+	.uleb128 0x1
+	.string	"num"
+	.byte	0x2b
+	.byte	0x10
+	.long	0x6b
+	.uleb128 0x1
+	.string	"bf"
+	.byte	0x2b
+	.byte	0x1b
+	.long	0x72
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1511
+	.byte	0x6
+	.byte	0x19
+	.byte	0x6
+	.uleb128 0x1
+	.string	"num"
+	.byte	0x19
+	.byte	0x1e
+	.long	0x37
+	.uleb128 0x4
+	.long	.LASF1504
+	.byte	0x19
+	.byte	0x30
+	.long	0x30
+	.uleb128 0x1
+	.string	"uc"
+	.byte	0x19
+	.byte	0x3a
+	.long	0x64
+	.uleb128 0x1
+	.string	"bf"
+	.byte	0x19
+	.byte	0x44
+	.long	0x72
+	.uleb128 0x6
+	.string	"d"
+	.byte	0x1b
+	.byte	0x12
+	.long	0x30
+	.uleb128 0xa
+	.uleb128 0x6
+	.string	"dgt"
+	.byte	0x21
+	.byte	0xd
+	.long	0x64
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x11
+	.uleb128 0x8
+	.file 9 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF555
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF573
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF596
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF656
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF660
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF661
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF757
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF783
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF784
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 24 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 25 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1176
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF555
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1216
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x21
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 37 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 38 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1471
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF476
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF479
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF492
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF493
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF540
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF554
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF572
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF653
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF756
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF760
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF778
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF779
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF781
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF782
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF786
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF759
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF779
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF782
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1059
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1088
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1090
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1096
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1098
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1100
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1102
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1106
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1108
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1110
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1112
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1114
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1116
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1122
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1124
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1126
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1128
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1132
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1134
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1136
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1138
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1140
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1142
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1144
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1146
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1148
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1150
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1152
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1154
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1156
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1158
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1160
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1162
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1166
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1168
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1175
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1197
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1215
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1243
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1243
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1253
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1256
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1256
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1256
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1256
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1256
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1265
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1278
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1285
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1290
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1292
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1294
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1296
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1298
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1300
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1303
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1304
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1305
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1306
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1307
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1308
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1330
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1446
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1469
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x9
+	.long	.LASF1
+	.long	.LASF1512
+	.long	.LASF1513
+	.long	.LASF1514
+	.long	.LASF1515
+	.long	.LASF1516
+	.long	.LASF1517
+	.long	.LASF1518
+	.long	.LASF1519
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x27
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1520
+	.byte	0x4
+	.long	.LASF1521
+	.byte	0x4
+	.long	.LASF1522
+	.byte	0x4
+	.long	.LASF1523
+	.byte	0x8
+	.long	.LASF1524
+	.byte	0x7
+	.long	.LASF1525
+	.byte	0x2
+	.long	.LASF1526
+	.byte	0x7
+	.long	.LASF1527
+	.byte	0x8
+	.long	.LASF1527
+	.byte	0x7
+	.long	.LASF1528
+	.byte	0x4
+	.long	.LASF1529
+	.byte	0x7
+	.long	.LASF1530
+	.byte	0x7
+	.long	.LASF1531
+	.byte	0x4
+	.long	.LASF1532
+	.byte	0x4
+	.long	.LASF1533
+	.byte	0x6
+	.long	.LASF1534
+	.byte	0x4
+	.long	.LASF1535
+	.byte	0x5
+	.long	.LASF1536
+	.byte	0x5
+	.long	.LASF1537
+	.byte	0x4
+	.long	.LASF1538
+	.byte	0x4
+	.long	.LASF1539
+	.byte	0x4
+	.long	.LASF1540
+	.byte	0x3
+	.long	.LASF1541
+	.byte	0x3
+	.long	.LASF1542
+	.byte	0x7
+	.long	.LASF1543
+	.byte	0x7
+	.long	.LASF1544
+	.byte	0x4
+	.long	.LASF1545
+	.byte	0x4
+	.long	.LASF1546
+	.byte	0x4
+	.long	.LASF1547
+	.byte	0x4
+	.long	.LASF1548
+	.byte	0x4
+	.long	.LASF1549
+	.byte	0x4
+	.long	.LASF1550
+	.byte	0x4
+	.long	.LASF1551
+	.byte	0x4
+	.long	.LASF1552
+	.byte	0x4
+	.long	.LASF1553
+	.byte	0x4
+	.long	.LASF1554
+	.byte	0x4
+	.long	.LASF1555
+	.byte	0x1
+	.long	.LASF1556
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF669:
+	.string	"INT32_MAX (2147483647)"
+.LASF1077:
+	.string	"__DECL_SIMD_exp"
+.LASF1082:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1162:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF867:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF448:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF792:
+	.string	"__DECL_SIMD_cosl "
+.LASF1358:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF478:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF673:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF860:
+	.string	"__DECL_SIMD_atan "
+.LASF1171:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1030:
+	.string	"__DECL_SIMD_asinh "
+.LASF1484:
+	.string	"size_t"
+.LASF1333:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1265:
+	.string	"__MATHDECL_1_IMPL"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF649:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1321:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF781:
+	.string	"NULL ((void *)0)"
+.LASF897:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1191:
+	.string	"__f64(x) x ##f64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1414:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1435:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF580:
+	.string	"__stub_sigreturn "
+.LASF417:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1238:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF542:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1432:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF995:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1463:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF916:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF556:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1118:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF886:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF1088:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF517:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1297:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF882:
+	.string	"__DECL_SIMD_hypotl "
+.LASF715:
+	.string	"INT16_C(c) c"
+.LASF1482:
+	.string	"int32_t"
+.LASF746:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1331:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF488:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1295:
+	.string	"_Mret_ _Float32x"
+.LASF950:
+	.string	"__DECL_SIMD_atan2 "
+.LASF842:
+	.string	"__DECL_SIMD_powl "
+.LASF469:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1468:
+	.string	"Q12 (1 << 12)"
+.LASF1214:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF484:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF874:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1344:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF1368:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF887:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1300:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1200:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF745:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1403:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF1142:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF888:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1458:
+	.string	"VERY_FAST_MATH "
+.LASF959:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF845:
+	.string	"__DECL_SIMD_powf64 "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1444:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1060:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF918:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1501:
+	.string	"decimalPoint"
+.LASF869:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1186:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1154:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF728:
+	.string	"INT32_WIDTH 32"
+.LASF730:
+	.string	"INT64_WIDTH 64"
+.LASF531:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1491:
+	.string	"sign"
+.LASF1390:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF1111:
+	.string	"__DECL_SIMD_coshf"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF656:
+	.string	"__STD_TYPE"
+.LASF831:
+	.string	"__DECL_SIMD_expf "
+.LASF1337:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF694:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF816:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF504:
+	.string	"__P(args) args"
+.LASF990:
+	.string	"__DECL_SIMD_atanh "
+.LASF1090:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF1044:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1343:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1290:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF762:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1256:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF624:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF999:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1371:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF993:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1374:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF1347:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1057:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1164:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF698:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1391:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF1178:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1051:
+	.string	"__DECL_SIMD_tanf "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF776:
+	.string	"_GCC_SIZE_T "
+.LASF858:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF719:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1220:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF663:
+	.string	"INT8_MIN (-128)"
+.LASF1496:
+	.string	"fastA2F"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1396:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF608:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF492:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1303:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF437:
+	.string	"_ISOC99_SOURCE 1"
+.LASF519:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF766:
+	.string	"_T_SIZE "
+.LASF1356:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1131:
+	.string	"__DECL_SIMD_log10f"
+.LASF408:
+	.string	"__USE_POSIX2"
+.LASF812:
+	.string	"__DECL_SIMD_sincosl "
+.LASF672:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF693:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF828:
+	.string	"__DECL_SIMD_logf64x "
+.LASF564:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF689:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF980:
+	.string	"__DECL_SIMD_log1p "
+.LASF1124:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF420:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF784:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1430:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF1066:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1282:
+	.string	"_Marg_ long double"
+.LASF407:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF849:
+	.string	"__DECL_SIMD_powf128x "
+.LASF707:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1034:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1112:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF654:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1096:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1261:
+	.string	"_Mdouble_ _Float32x"
+.LASF1279:
+	.string	"_Mret_"
+.LASF710:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF576:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1313:
+	.string	"FP_NAN 0"
+.LASF633:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF431:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF411:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1354:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF416:
+	.string	"__USE_XOPEN2K8"
+.LASF1268:
+	.string	"__MATHDECL"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF541:
+	.string	"__always_inline"
+.LASF764:
+	.string	"_SYS_SIZE_T_H "
+.LASF1405:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF917:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1167:
+	.string	"__DECL_SIMD_tanf"
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF427:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF684:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF490:
+	.string	"__GLIBC__ 2"
+.LASF438:
+	.string	"_ISOC11_SOURCE"
+.LASF1185:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1480:
+	.string	"long int"
+.LASF480:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1073:
+	.string	"__DECL_SIMD_log"
+.LASF1423:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF1455:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1218:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1273:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF432:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF467:
+	.string	"__USE_XOPEN2K8 1"
+.LASF642:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1212:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF1408:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1325:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1068:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1020:
+	.string	"__DECL_SIMD_tanh "
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF396:
+	.string	"__REVISION__ \"7b45b89\""
+.LASF1465:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF991:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1095:
+	.string	"__DECL_SIMD_asinf"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF653:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1242:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF902:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1245:
+	.string	"__MATH_PRECNAME"
+.LASF638:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1398:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF1503:
+	.string	"itoa"
+.LASF880:
+	.string	"__DECL_SIMD_hypot "
+.LASF1304:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF700:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF632:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1146:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1087:
+	.string	"__DECL_SIMD_acosf"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF538:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF522:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF506:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF914:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF936:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF981:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1248:
+	.string	"_Mdouble_ float"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1076:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1139:
+	.string	"__DECL_SIMD_log1pf"
+.LASF851:
+	.string	"__DECL_SIMD_acosf "
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF527:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1316:
+	.string	"FP_SUBNORMAL 3"
+.LASF786:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1378:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF1267:
+	.string	"__MATHDECL_ALIAS"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1174:
+	.string	"__f128(x) x ##f128"
+.LASF822:
+	.string	"__DECL_SIMD_logl "
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF969:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1348:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF520:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF739:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF635:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF583:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF487:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF497:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1476:
+	.string	"signed char"
+.LASF604:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1459:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1483:
+	.string	"uint8_t"
+.LASF1247:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF598:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF508:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1193:
+	.string	"__f64x(x) x ##f64x"
+.LASF1394:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF1102:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF647:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF613:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF555:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1419:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF853:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF979:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF479:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF629:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1493:
+	.string	"scale"
+.LASF1086:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF987:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF631:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF965:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1251:
+	.string	"_Mdouble_ long double"
+.LASF1472:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF460:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF505:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF685:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF830:
+	.string	"__DECL_SIMD_exp "
+.LASF1326:
+	.string	"math_errhandling 0"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1402:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF774:
+	.string	"__DEFINED_size_t "
+.LASF1083:
+	.string	"__DECL_SIMD_powf"
+.LASF1125:
+	.string	"__DECL_SIMD_atan2"
+.LASF475:
+	.string	"__USE_LARGEFILE 1"
+.LASF783:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1101:
+	.string	"__DECL_SIMD_exp2"
+.LASF756:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1158:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1176:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF988:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1434:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1443:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1199:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1417:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF664:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1207:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1070:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF879:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF549:
+	.string	"__restrict_arr __restrict"
+.LASF574:
+	.string	"__stub___compat_bdflush "
+.LASF770:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF780:
+	.string	"NULL"
+.LASF1129:
+	.string	"__DECL_SIMD_log10"
+.LASF1492:
+	.string	"value"
+.LASF1140:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1126:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF640:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF486:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF680:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF923:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF528:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF678:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1175:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF747:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF585:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1367:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF1395:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF967:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF855:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF579:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF759:
+	.string	"__need_size_t "
+.LASF951:
+	.string	"__DECL_SIMD_atan2f "
+.LASF892:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1319:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF601:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF623:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF561:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1203:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1033:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF546:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1327:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF757:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF587:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF801:
+	.string	"__DECL_SIMD_sinf "
+.LASF414:
+	.string	"__USE_XOPEN2K"
+.LASF514:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF655:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1137:
+	.string	"__DECL_SIMD_log1p"
+.LASF415:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1135:
+	.string	"__DECL_SIMD_log2f"
+.LASF1339:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF544:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1106:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF447:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF856:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF761:
+	.string	"__size_t__ "
+.LASF464:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF1306:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF691:
+	.string	"INT_FAST8_MAX (127)"
+.LASF679:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1061:
+	.string	"__DECL_SIMD_cos"
+.LASF794:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1311:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1031:
+	.string	"__DECL_SIMD_asinhf "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1412:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF752:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1130:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF901:
+	.string	"__DECL_SIMD_exp10f "
+.LASF720:
+	.string	"UINT32_C(c) c ## U"
+.LASF1445:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF699:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF409:
+	.string	"__USE_POSIX199309"
+.LASF670:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF937:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1424:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF927:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1194:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1063:
+	.string	"__DECL_SIMD_cosf"
+.LASF817:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1004:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1012:
+	.string	"__DECL_SIMD_erfl "
+.LASF709:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1315:
+	.string	"FP_ZERO 2"
+.LASF1330:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF418:
+	.string	"__USE_LARGEFILE"
+.LASF1243:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF702:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF413:
+	.string	"__USE_UNIX98"
+.LASF1078:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1440:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF430:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF834:
+	.string	"__DECL_SIMD_expf32 "
+.LASF945:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF877:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1006:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1507:
+	.string	"ui2a"
+.LASF617:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1215:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1064:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1213:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1148:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF602:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF779:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1280:
+	.string	"_Marg_"
+.LASF1055:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1204:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1005:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF687:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF904:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF513:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF440:
+	.string	"_ISOC2X_SOURCE"
+.LASF976:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1274:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF1042:
+	.string	"__DECL_SIMD_erfcl "
+.LASF731:
+	.string	"UINT64_WIDTH 64"
+.LASF1211:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF966:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1461:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1296:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF930:
+	.string	"__DECL_SIMD_sinh "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1478:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF939:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF900:
+	.string	"__DECL_SIMD_exp10 "
+.LASF864:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF650:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF992:
+	.string	"__DECL_SIMD_atanhl "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1232:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1469:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF793:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF878:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF977:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF586:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF526:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1240:
+	.string	"_Mdouble_ double"
+.LASF1411:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1263:
+	.string	"_Mdouble_ _Float64x"
+.LASF1393:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1041:
+	.string	"__DECL_SIMD_erfcf "
+.LASF697:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1134:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF1446:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF982:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1506:
+	.string	"digit"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1329:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF1332:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF978:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1169:
+	.string	"_BITS_FLOATN_H "
+.LASF536:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF547:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1386:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF835:
+	.string	"__DECL_SIMD_expf64 "
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF870:
+	.string	"__DECL_SIMD_asin "
+.LASF465:
+	.string	"__USE_POSIX199506 1"
+.LASF1264:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1144:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF755:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1119:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1322:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF454:
+	.string	"_ATFILE_SOURCE"
+.LASF607:
+	.string	"__SLONG32_TYPE int"
+.LASF1177:
+	.string	"__HAVE_FLOAT16 0"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF628:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1138:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1183:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1153:
+	.string	"__DECL_SIMD_tanh"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF955:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF919:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF403:
+	.string	"__USE_ISOC11"
+.LASF1511:
+	.string	"uli2a"
+.LASF891:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1320:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF848:
+	.string	"__DECL_SIMD_powf64x "
+.LASF733:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF661:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF972:
+	.string	"__DECL_SIMD_log2l "
+.LASF1353:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF584:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF996:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1147:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1421:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF1216:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF735:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1381:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF476:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF703:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF907:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF630:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF742:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF596:
+	.string	"_BITS_TYPES_H 1"
+.LASF671:
+	.string	"UINT8_MAX (255)"
+.LASF708:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF588:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF718:
+	.string	"UINT8_C(c) c"
+.LASF799:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF1157:
+	.string	"__DECL_SIMD_asinh"
+.LASF1375:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF461:
+	.string	"__USE_ISOC95 1"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF565:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF765:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1400:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF410:
+	.string	"__USE_POSIX199506"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF743:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1262:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1305:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF796:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF518:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF844:
+	.string	"__DECL_SIMD_powf32 "
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1289:
+	.string	"_Marg_ _Float64"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1278:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF434:
+	.string	"_ISOC95_SOURCE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF925:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF500:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF963:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF760:
+	.string	"__need_NULL "
+.LASF402:
+	.string	"_FEATURES_H 1"
+.LASF453:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF833:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1373:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1234:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1145:
+	.string	"__DECL_SIMD_acosh"
+.LASF1310:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF498:
+	.string	"__LEAF , __leaf__"
+.LASF659:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1418:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1324:
+	.string	"MATH_ERRNO 1"
+.LASF530:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1407:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF1388:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF612:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1205:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF1284:
+	.string	"_Mret_ double"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1413:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF1107:
+	.string	"__DECL_SIMD_exp10f"
+.LASF943:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1246:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1092:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1067:
+	.string	"__DECL_SIMD_sinf"
+.LASF1058:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF470:
+	.string	"__USE_UNIX98 1"
+.LASF1508:
+	.string	"li2a"
+.LASF471:
+	.string	"_LARGEFILE_SOURCE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1128:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF821:
+	.string	"__DECL_SIMD_logf "
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1372:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF422:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1404:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF1441:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF1233:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1180:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF962:
+	.string	"__DECL_SIMD_log10l "
+.LASF952:
+	.string	"__DECL_SIMD_atan2l "
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1266:
+	.string	"__MATHDECL_1"
+.LASF1287:
+	.string	"_Marg_ _Float32x"
+.LASF1122:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF450:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF648:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1156:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF840:
+	.string	"__DECL_SIMD_pow "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF744:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF802:
+	.string	"__DECL_SIMD_sinl "
+.LASF558:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF696:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1422:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF944:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1349:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1341:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF510:
+	.string	"__END_DECLS "
+.LASF768:
+	.string	"_SIZE_T_ "
+.LASF1160:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF483:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF1003:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF753:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF1336:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF940:
+	.string	"__DECL_SIMD_cbrt "
+.LASF896:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF905:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF567:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF572:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1236:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF399:
+	.string	"_STDINT_H 1"
+.LASF1201:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF790:
+	.string	"__DECL_SIMD_cos "
+.LASF1427:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF1188:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF806:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1450:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF931:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1283:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF553:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1359:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF1486:
+	.string	"double"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1338:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF767:
+	.string	"__SIZE_T "
+.LASF998:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF503:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF819:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF446:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF732:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF534:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF552:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1460:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1328:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF1410:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF494:
+	.string	"__PMT"
+.LASF1275:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF847:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1000:
+	.string	"__DECL_SIMD_acosh "
+.LASF1250:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1258:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1132:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1123:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1464:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF868:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1196:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1094:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF634:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF690:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF455:
+	.string	"_ATFILE_SOURCE 1"
+.LASF603:
+	.string	"__SQUAD_TYPE long int"
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1230:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF724:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1109:
+	.string	"__DECL_SIMD_cosh"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF837:
+	.string	"__DECL_SIMD_expf32x "
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF425:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF569:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF749:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1452:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF920:
+	.string	"__DECL_SIMD_expm1 "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF994:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1080:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF986:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF667:
+	.string	"INT8_MAX (127)"
+.LASF1467:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF921:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1170:
+	.string	"__HAVE_FLOAT128 1"
+.LASF964:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF903:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1474:
+	.string	"unsigned int"
+.LASF516:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1451:
+	.string	"UNIT_TESTED "
+.LASF1098:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF727:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF495:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1035:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1025:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1108:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF970:
+	.string	"__DECL_SIMD_log2 "
+.LASF941:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF421:
+	.string	"__USE_MISC"
+.LASF1239:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1454:
+	.string	"sq(x) ((x)*(x))"
+.LASF1056:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1223:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF1442:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF466:
+	.string	"__USE_XOPEN2K 1"
+.LASF459:
+	.string	"__USE_ISOC11 1"
+.LASF829:
+	.string	"__DECL_SIMD_logf128x "
+.LASF641:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF637:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF600:
+	.string	"__U32_TYPE unsigned int"
+.LASF1254:
+	.string	"_Mdouble_ _Float32"
+.LASF960:
+	.string	"__DECL_SIMD_log10 "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF525:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF836:
+	.string	"__DECL_SIMD_expf128 "
+.LASF975:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1502:
+	.string	"dpLocation"
+.LASF529:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1084:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF457:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF551:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF577:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF682:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF675:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1252:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1291:
+	.string	"_Marg_ _Float64x"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF773:
+	.string	"_SIZE_T_DECLARED "
+.LASF540:
+	.string	"__wur "
+.LASF473:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF1379:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF841:
+	.string	"__DECL_SIMD_powf "
+.LASF1340:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1189:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1228:
+	.string	"FP_INT_TONEAREST 4"
+.LASF725:
+	.string	"UINT8_WIDTH 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF714:
+	.string	"INT8_C(c) c"
+.LASF1227:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF1091:
+	.string	"__DECL_SIMD_atanf"
+.LASF606:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF652:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF489:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF616:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF843:
+	.string	"__DECL_SIMD_powf16 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF803:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1387:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF501:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF557:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF838:
+	.string	"__DECL_SIMD_expf64x "
+.LASF507:
+	.string	"__STRING(x) #x"
+.LASF825:
+	.string	"__DECL_SIMD_logf64 "
+.LASF928:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF554:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1187:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1285:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF1456:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF818:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF775:
+	.string	"___int_size_t_h "
+.LASF1023:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF807:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1181:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1308:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF985:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1002:
+	.string	"__DECL_SIMD_acoshl "
+.LASF772:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF926:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1449:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF889:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF578:
+	.string	"__stub_revoke "
+.LASF785:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF1120:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF1481:
+	.string	"char"
+.LASF832:
+	.string	"__DECL_SIMD_expl "
+.LASF502:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF563:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1225:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF763:
+	.string	"_SIZE_T "
+.LASF1015:
+	.string	"__DECL_SIMD_erff64 "
+.LASF911:
+	.string	"__DECL_SIMD_coshf "
+.LASF1364:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF826:
+	.string	"__DECL_SIMD_logf128 "
+.LASF846:
+	.string	"__DECL_SIMD_powf128 "
+.LASF973:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1470:
+	.string	"white_space(c) ((c) == ' ' || (c) == '\\t')"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF677:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1397:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF674:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1293:
+	.string	"_Marg_ _Float128"
+.LASF935:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1335:
+	.string	"M_E 2.7182818284590452354"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1498:
+	.string	"floatString"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF876:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF1497:
+	.string	"ftoa"
+.LASF1473:
+	.string	"short unsigned int"
+.LASF895:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF754:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1007:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF984:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF729:
+	.string	"UINT32_WIDTH 32"
+.LASF852:
+	.string	"__DECL_SIMD_acosl "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF405:
+	.string	"__USE_ISOC95"
+.LASF1346:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF705:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF404:
+	.string	"__USE_ISOC99"
+.LASF1399:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF788:
+	.string	"_MATH_H 1"
+.LASF1054:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF412:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1133:
+	.string	"__DECL_SIMD_log2"
+.LASF1352:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF1173:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1052:
+	.string	"__DECL_SIMD_tanl "
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1043:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF509:
+	.string	"__BEGIN_DECLS "
+.LASF823:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1159:
+	.string	"__DECL_SIMD_asinhf"
+.LASF850:
+	.string	"__DECL_SIMD_acos "
+.LASF1113:
+	.string	"__DECL_SIMD_expm1"
+.LASF686:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF537:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1208:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF1053:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1385:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF662:
+	.string	"__intptr_t_defined "
+.LASF468:
+	.string	"__USE_XOPEN 1"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF625:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF983:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1165:
+	.string	"__DECL_SIMD_tan"
+.LASF908:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF644:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1021:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1370:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF393:
+	.string	"SITL 1"
+.LASF863:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF435:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF406:
+	.string	"__USE_ISOCXX11"
+.LASF771:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF820:
+	.string	"__DECL_SIMD_log "
+.LASF1050:
+	.string	"__DECL_SIMD_tan "
+.LASF815:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF610:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1110:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1312:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1210:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1323:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1475:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF968:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1105:
+	.string	"__DECL_SIMD_exp10"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1355:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1168:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF933:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1439:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF932:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1431:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1222:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF533:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF449:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF740:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF716:
+	.string	"INT32_C(c) c"
+.LASF1184:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF809:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1406:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF721:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1270:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1104:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF1182:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1013:
+	.string	"__DECL_SIMD_erff16 "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1237:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF477:
+	.string	"__WORDSIZE 64"
+.LASF1235:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF778:
+	.string	"__size_t "
+.LASF954:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1409:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF894:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF17:
+	.string	"__pic__ 2"
+.LASF581:
+	.string	"__stub_stty "
+.LASF1151:
+	.string	"__DECL_SIMD_erff"
+.LASF890:
+	.string	"__DECL_SIMD_exp2 "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1362:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF515:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF885:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1114:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF609:
+	.string	"__S64_TYPE long int"
+.LASF568:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1018:
+	.string	"__DECL_SIMD_erff64x "
+.LASF769:
+	.string	"_BSD_SIZE_T_ "
+.LASF512:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF782:
+	.string	"__need_NULL"
+.LASF723:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF798:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1363:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1179:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1046:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1286:
+	.string	"_Mret_ _Float32"
+.LASF599:
+	.string	"__S32_TYPE int"
+.LASF789:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF734:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1317:
+	.string	"FP_NORMAL 4"
+.LASF811:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1487:
+	.string	"strncpy"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF922:
+	.string	"__DECL_SIMD_expm1l "
+.LASF711:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF758:
+	.string	"_STRING_H 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF657:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1350:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF813:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1206:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF717:
+	.string	"INT64_C(c) c ## L"
+.LASF1383:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF1019:
+	.string	"__DECL_SIMD_erff128x "
+.LASF482:
+	.string	"__USE_ATFILE 1"
+.LASF1255:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1376:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1155:
+	.string	"__DECL_SIMD_tanhf"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF859:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1097:
+	.string	"__DECL_SIMD_hypot"
+.LASF1103:
+	.string	"__DECL_SIMD_exp2f"
+.LASF942:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1457:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF884:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF938:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1011:
+	.string	"__DECL_SIMD_erff "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF665:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF873:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1401:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1172:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF737:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1036:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF575:
+	.string	"__stub_chflags "
+.LASF929:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF424:
+	.string	"__USE_GNU"
+.LASF777:
+	.string	"_SIZET_ "
+.LASF643:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1365:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1150:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF456:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1152:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1437:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1075:
+	.string	"__DECL_SIMD_logf"
+.LASF1436:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1490:
+	.string	"frac"
+.LASF1198:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF636:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1425:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF1074:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF562:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1093:
+	.string	"__DECL_SIMD_asin"
+.LASF1366:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF545:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF423:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF683:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1288:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1260:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1190:
+	.string	"__f32(x) x ##f32"
+.LASF1149:
+	.string	"__DECL_SIMD_erf"
+.LASF535:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1271:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1244:
+	.string	"_Mdouble_"
+.LASF1438:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1292:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF695:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1495:
+	.string	"expon"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF791:
+	.string	"__DECL_SIMD_cosf "
+.LASF814:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF481:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1115:
+	.string	"__DECL_SIMD_expm1f"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF804:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF861:
+	.string	"__DECL_SIMD_atanf "
+.LASF1392:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF736:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF1259:
+	.string	"_Mdouble_ _Float128"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1477:
+	.string	"short int"
+.LASF493:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1281:
+	.string	"__MATHCALL_NAME"
+.LASF1010:
+	.string	"__DECL_SIMD_erf "
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1294:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF433:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF548:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF909:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF893:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF523:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1466:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF1209:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF738:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1016:
+	.string	"__DECL_SIMD_erff128 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF956:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF560:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF912:
+	.string	"__DECL_SIMD_coshl "
+.LASF881:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1505:
+	.string	"nump"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1298:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF1415:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1069:
+	.string	"__DECL_SIMD_sincos"
+.LASF571:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1231:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF521:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1166:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF1453:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1299:
+	.string	"_Mret_ _Float64"
+.LASF621:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF915:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1143:
+	.string	"__DECL_SIMD_atanhf"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF839:
+	.string	"__DECL_SIMD_expf128x "
+.LASF524:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF605:
+	.string	"__SWORD_TYPE long int"
+.LASF1127:
+	.string	"__DECL_SIMD_atan2f"
+.LASF875:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1369:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF532:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1361:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF1040:
+	.string	"__DECL_SIMD_erfc "
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF618:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF462:
+	.string	"__USE_POSIX 1"
+.LASF611:
+	.string	"__STD_TYPE typedef"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF704:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1269:
+	.string	"__MATHCALL"
+.LASF701:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1509:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF971:
+	.string	"__DECL_SIMD_log2f "
+.LASF570:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF805:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1318:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1192:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1447:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF451:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF472:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF958:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF597:
+	.string	"__S16_TYPE short int"
+.LASF1065:
+	.string	"__DECL_SIMD_sin"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF713:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1309:
+	.string	"__MATHCALL_NARROW"
+.LASF1489:
+	.string	"strlen"
+.LASF865:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1217:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF910:
+	.string	"__DECL_SIMD_cosh "
+.LASF953:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF539:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF543:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF961:
+	.string	"__DECL_SIMD_log10f "
+.LASF1161:
+	.string	"__DECL_SIMD_erfc"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1499:
+	.string	"intString1"
+.LASF1500:
+	.string	"intString2"
+.LASF872:
+	.string	"__DECL_SIMD_asinl "
+.LASF1001:
+	.string	"__DECL_SIMD_acoshf "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF741:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1117:
+	.string	"__DECL_SIMD_sinh"
+.LASF1426:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF559:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF639:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF626:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF666:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1022:
+	.string	"__DECL_SIMD_tanhl "
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF866:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1420:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF491:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF452:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1079:
+	.string	"__DECL_SIMD_expf"
+.LASF906:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1024:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1121:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1510:
+	.string	"_i2a"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF924:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1221:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF1494:
+	.string	"pow10"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1384:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF681:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF913:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF751:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1301:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF1471:
+	.string	"valid_digit(c) ((c) >= '0' && (c) <= '9')"
+.LASF1141:
+	.string	"__DECL_SIMD_atanh"
+.LASF1100:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF458:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF615:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF676:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1272:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF810:
+	.string	"__DECL_SIMD_sincos "
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF441:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF688:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF511:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF463:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF627:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1202:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF974:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF566:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF750:
+	.string	"INTMAX_WIDTH 64"
+.LASF668:
+	.string	"INT16_MAX (32767)"
+.LASF1136:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF712:
+	.string	"WINT_MIN (0u)"
+.LASF1253:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1229:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF619:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1416:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF474:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF620:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1014:
+	.string	"__DECL_SIMD_erff32 "
+.LASF997:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1276:
+	.string	"_Mret_ float"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF800:
+	.string	"__DECL_SIMD_sin "
+.LASF1081:
+	.string	"__DECL_SIMD_pow"
+.LASF1488:
+	.string	"strcat"
+.LASF854:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF496:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF808:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF382:
+	.string	"unix 1"
+.LASF439:
+	.string	"_ISOC11_SOURCE 1"
+.LASF660:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1485:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1257:
+	.string	"_Mdouble_ _Float64"
+.LASF692:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF1382:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF485:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1504:
+	.string	"base"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF646:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1071:
+	.string	"__DECL_SIMD_sincosf"
+.LASF658:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF934:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1045:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF748:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1334:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF871:
+	.string	"__DECL_SIMD_asinf "
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF862:
+	.string	"__DECL_SIMD_atanl "
+.LASF1380:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF824:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1017:
+	.string	"__DECL_SIMD_erff32x "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF957:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF797:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1241:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1462:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1089:
+	.string	"__DECL_SIMD_atan"
+.LASF1479:
+	.string	"__int32_t"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF573:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF499:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1277:
+	.string	"_Marg_ double"
+.LASF1163:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1197:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF622:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1360:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1345:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF857:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1377:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF1072:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF419:
+	.string	"__USE_LARGEFILE64"
+.LASF883:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1307:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF827:
+	.string	"__DECL_SIMD_logf32x "
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1433:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1224:
+	.string	"FP_INT_UPWARD 0"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF1032:
+	.string	"__DECL_SIMD_asinhl "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1448:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1116:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1219:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1428:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1314:
+	.string	"FP_INFINITE 1"
+.LASF436:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF787:
+	.string	"_STRINGS_H 1"
+.LASF1249:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF582:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1302:
+	.string	"_Mret_ _Float64x"
+.LASF1429:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1099:
+	.string	"__DECL_SIMD_hypotf"
+.LASF651:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF706:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1342:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1085:
+	.string	"__DECL_SIMD_acos"
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF1389:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF645:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF722:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1062:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1357:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF614:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF550:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1195:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF795:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF726:
+	.string	"INT16_WIDTH 16"
+.LASF1351:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1226:
+	.string	"FP_INT_TOWARDZERO 2"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1551:
+	.string	"mathcalls-helper-functions.h"
+.LASF1543:
+	.string	"math.h"
+.LASF1534:
+	.string	"long-double.h"
+.LASF1541:
+	.string	"__locale_t.h"
+.LASF1552:
+	.string	"mathcalls.h"
+.LASF1545:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1528:
+	.string	"libc-header-start.h"
+.LASF1517:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1544:
+	.string	"math-vector.h"
+.LASF0:
+	.string	"./src/main/common/typeconversion.c"
+.LASF1521:
+	.string	"stdint-intn.h"
+.LASF1516:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1519:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1535:
+	.string	"stubs.h"
+.LASF1532:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1549:
+	.string	"fp-logb.h"
+.LASF1515:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1542:
+	.string	"strings.h"
+.LASF1530:
+	.string	"features-time64.h"
+.LASF1520:
+	.string	"types.h"
+.LASF1546:
+	.string	"floatn.h"
+.LASF1518:
+	.string	"/usr/include"
+.LASF1512:
+	.string	"src/main/build"
+.LASF1547:
+	.string	"floatn-common.h"
+.LASF1537:
+	.string	"typesizes.h"
+.LASF1540:
+	.string	"locale_t.h"
+.LASF1529:
+	.string	"features.h"
+.LASF1538:
+	.string	"time64.h"
+.LASF1554:
+	.string	"iscanonical.h"
+.LASF1522:
+	.string	"stdint-uintn.h"
+.LASF1539:
+	.string	"wchar.h"
+.LASF1548:
+	.string	"flt-eval-method.h"
+.LASF1553:
+	.string	"mathcalls-narrow.h"
+.LASF1533:
+	.string	"cdefs.h"
+.LASF1550:
+	.string	"fp-fast.h"
+.LASF1513:
+	.string	"src/main/common"
+.LASF1556:
+	.string	"maths.h"
+.LASF1524:
+	.string	"string.h"
+.LASF1514:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1527:
+	.string	"stdint.h"
+.LASF1555:
+	.string	"build_config.h"
+.LASF1523:
+	.string	"stddef.h"
+.LASF1536:
+	.string	"stubs-64.h"
+.LASF1531:
+	.string	"wordsize.h"
+.LASF1525:
+	.string	"typeconversion.c"
+.LASF1526:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375 \354\r\004"
+	.string	"\264\005\340"
+	.string	"\n"
+	.string	"\232\317\241\374\t\002\002"
+	.string	"\002"
+	.string	"\001\201\351\223\225\002\004\364\223\222\365\n\006"
+	.string	"\002"
+	.string	"\003\303\224\212\270\b\004\004\344\300\270\257\t\006\005\251\243\200\233\007"
+	.string	"\006\331\327\376\320\001\b\002\001\002\001\002\003\002\003\007\221\334\215\370\004\n\b\376\242\274\376\b\030\002\004\t\241\221\303\212\f\f\002"
+	.string	"\020"
+	.string	"\270\3129\211\240\002\3301 \030q\260\001\025\026W\f\304Y"
+	.ascii	"k\0011\200 \231U\271\003]l\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375 \260}\002"
+	.string	"\344\002\244"
+	.string	"\n"
+	.string	"\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\004"
+	.string	"\001\002\002"
+	.string	"\001\003\004\005\001\003\006\004\003\007"
+	.string	""
+	.string	"\b\002\003"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\001\t\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\016"
+	.string	"@\310n@W\201"
+	.string	"A\324\200\020\344"
+	.string	"j\200\200`cA\371\006\262\fz\001\206l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`\276\003\005\023"
+	.string	"\226\036gC\020\221\324\0307oW81r\005g\027\343\270\256\254\352Uh\016\310\037J\255\271\264\355rBk^\373\0075\304\b\214\304H\366\023\361\320"
+	.string	"\300 \024("
+	.string	"\200\006\t\246\353\271\254l\024\211]I\331\244L)\005U"
+	.string	"Q"
+	.string	"W"
+	.string	"\375\214\013\025\213\216N;\267\333\305\316\027\36447H\324\006\364\\M\177P\203E\006Oo%V\003\243#\272M\340\370\006\177\365\351y\220\t\241\"\240.\211\365\332\2028"
+	.string	"Zr\b1ZZ\236\276\217\355\310\347\234\023\276\267\345\334}]\362V]\312K\250\365\024~\b\"\237\3052\270\304J\317J\221wc\206\214M\254gG\036Jl\035\3149QZy\327.\243\342\b\030\025\216_l\021\226O\325+\214\212\335\376\261\375\344\335\214\212\362\250\306\332\364\0164\"\264B\345\024\312\277\036\366\020\304\205\034\224\205\245\267B\203\231xe.W\316\364\026\257\030\031\250#\321v\006\241Z\255\226\303\247X\317?<?y\r\370\024\343S\2176-\255\024\036\355\204\270\357)\310\326\3447\260N\205"
+	.string	"\266\257\277\355\332\3448`\235\252@\243ga\351]\nL\314+9\016\344\241\220\255d\037\225\236\213\205\t\252W\212D\001m{!6\243y\365\366\235\216!6\243\365D\267\326\365k\223X.\211e\022+"
+	.string	"\364C\316RA\303\213\312\327\313\225\344\275\346\234 \323\333"
+	.string	"\342f\346\300\347\206\371s\224\n\217\317S}}\n^\215\204U\327\022\004\244\344\344\310%I\236\f\0166hB\275\354\245+S\250\341<f\020\031\242\tfd\0244-\034`\002!&U<\022\300\224U\203,\223\210h\371]v\261v\317\263\362\373\242j\035FN/$\007\357[K\324\266\275\342c\022\rPI\313\027j\264Q\251\335D]\031\205\003\314\314\2009\241\035\226\265u\254f\302*O\306S\252\245:\243\nJ\343\236(\307G;\340\327'.\177q\226\334\360\307\324\215\036"
+	.string	"\353\006\236(M\364\031\342\210;\n\217B\211(kp!/\214\255\202_j\345\252gz\tR\314hU@t/\0323\030\275\3558\307W\t\001\361\240\3151<\036\265\316)'\224\213\274u\315\037F\334i\366\332\255\274\351,\211\2043\337\245\363'"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`E\002\035\t"
+	.string	"\342\215&'\200)I\0073\260\314\210\327\f\21700\003\317u\025\\P\031x\234X\367\267f\035\003*\300\242\330,i\273m\"\223\f<(\273H\222\222\302\fl"
+	.string	"\365\b\240>q\021n\260\021\352\263\252'\236\266\262\235\025V\006\344p\301\271y\211\373W\305\036"
+	.string	":\342!\356\313\335\260oXOx\241\212a\030f\305~\270#\004\313Q\214+\326\217\031r\356!C\275\363G\035\207=\244\307\370\226=\013\350\235\376\353^\221\327\277\"#\245\224\256\206W3iG\217\275\243\267\374\207\t\017y\024\002< `\"1\254\352\257\222\b\244wx\263\300*t\n"
+	.string	"#\001H\006\337\322"
+	.ascii	"\332\251\371\205\002\240\321\335F\2113\034hV\333\253)!\354\345"
+	.ascii	"\201\006D/:\206V:\230\275\227\306\234\n(!\200\023\007$\344\202"
+	.ascii	"!\202\203\361\027\224d\325\006Ea\365\330\002\002\357\211\326"
+	.ascii	"\226\025N6P\356\206\274\315\005\261[\032\260\332\301\303\301"
+	.ascii	"\"\336\026\327\261\317\215}\352\032\221\023\305\355\020\037\267"
+	.ascii	"0\242\005\026\257i\206v-\362\206[\004"
+	.text
+	.section	.gnu.lto_.pureconst.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\200\004\006\232\004\007\232\004\b\232\004\t\265\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375 \335\235\004"
+	.string	"\222\307\033&\220+\215\001+\007\034H\254\253w\325=D\037N\214\347S\215{q\235\r\006Q2\3164<\365$v\373\357-e\noB*"
+	.string	"\216\\tX\267\n\311\265\365\025\023\"\304I=\215\243\0019\235\205 \363\370\274\310ds10$\020\212\347a\246O\270\006\232\276\373\251r\246\307\343g\346\252\331<#^l\251U\225Af\371\225\177\016=\370+\001\r"
+	.ascii	"+\001\351\253yU\205\021S\b\215\353\334\205\245Ua\200;\240:\203"
+	.ascii	"\271\363\314L\240a\f\024\001"
+	.text
+	.section	.gnu.lto_.lto.2b5c830531037d8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_uli2a.2.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`\266\004\305\036"
+	.string	"F\370\301K\240\230Q:\244\"\276\304\204\034\240\250\3354\037\204w\037l\241\375\236\226\254C\235nr\003\301]!\013&\006~\272S\360\354Rx\236\032\266\354\2445\322\302x!X9\320\377J\b,\005\"\212-\250\211\332\267$\226\220M\210\334I\006\255"
+	.string	"\245"
+	.string	"\251"
+	.string	"\\\341|i\215\264Z\337\304\037\376\007\357L6\354\272\327\005\326\204\363e\ri\177\320^\357\203\317\343=x\027r\221\307\334\013\024N\335;L\300\f\316\227<|\314\276<\037\300\276d\036\263\024\002B/\035CNY\356\275\263\206\301)\223\315\373+EO\323\302\310\256<~L\b\321/\304_*|55s^\034%\0355\340\342\b\351g\212\033FH\325\2742B\"k\214C\325\276\227t\030i\n\221P\372\225\321\n\022\347\230E\365\342k\321\017\250\2226L\274_\374\001\034S\210~&^\315\234{/W\242\337\321\371\345\314L\204\231k\314dO\247\320\242W\265X"
+	.string	"\226\253[\265\230\207!j\007\231\217\023\343\230\305\rd\246\221\315\310\034\310?\340Q\347\330\237~"
+	.string	"g\372c.\374a\312\312/\260\023\317\257\364\3023\372\247\263\313V>\313\312fY\331\276r\371\312\344+\367+\327W~\201\024E"
+	.string	"\253{Ilm\271IJ*\032\217\372\211\257\314\267Vh\227z\220\324^1Fq\325R1\353\336\213\341|y~\020^j\241\320\230_$\332\220\227\ba\310\216\254{\207\b^\362\005\266Jhd=\324\323\007\00207\250i\204\005+Z\327;\001\341\252\343\324\2757A/o\204\250\212\331gW)\231\376\323\202\247-\323w\362\345xi\333f\337\307\242l\333?K\240\035$\231\312\025%\300\263\201\b>\240\037<\t\252\307\177\t\024&\242\331Av\235\253l\254\377\242\351H\354D\254\037Uv\254\037\205l\264KX\223]\271\030\1772)a;\310\2075\220m\023)M\323(\224\260^\352\257.\352\256\375"
+	.string	"IP=rLwW&\r\323\265\357[\002\252[]\235\206\272\364\352\026\277xW\215W\347\364\310{\357%i\372\304\327\304\364\253i\372F|7\200\352\026\353pi(+\241_\263"
+	.ascii	"\255\337\306\236\030?\032tZ\347;\031\252mWo\272Z\006\222k\rh"
+	.ascii	"\nvvpj72\236\035\256\331v\203\313q\320\371\334<\340r\266[\017"
+	.ascii	"\210\237\031.\307\303\223\263\315p\034j<3\233\217nvs\200s=7\237"
+	.ascii	"\331O.\3473K\207\367d\232\266\253\304\221\244\327@\314\327Y\376"
+	.ascii	"T\207\027\226\225^\335\242`\343\325Av\"\005\225\275\032\026A"
+	.ascii	"\204\022*\003\240\323.\272\361\022d\034Ag\232I\030L\243]\304"
+	.ascii	"\267\261\260S\313\017\355\013\323Z\265\030\226v\220\253\351\340"
+	.ascii	";[\255\202\357,*C\351d\253\357\354\213\f\326\262\245\0253}\341"
+	.ascii	"L?\212\217\352\226t6\177j\203\256b\315\340\177\260\001b\250!"
+	.ascii	"(\306\230\224\204H&\022\031I\222t\200\002\2412\353\006\021\260"
+	.ascii	"\275d%)dX\003\225RURNZ\220\270#\372\0019\r(\242\334\275\375I"
+	.ascii	"\342\360\017\210\205\345\t&#\301H?$\346n/\255[\310P\351?A\307"
+	.ascii	"E\325\246 O\325\276\314\351\343\304b@\004\027\240\0048E\331`"
+	.ascii	"\344G\356\004\004\226\366i\363\255\"\362<>\275\320\205O \205"
+	.ascii	"|\205\322Bl\004\017\317\256[H\343\236\370:\242kcxCa\300x\344"
+	.ascii	"TC\374\336\237M\360\325\201\331K\257\b\261\r\323\334\227\025"
+	.ascii	"\032\367\320293\314\231\330\304\021/\316\250\b\331wp\304\337"
+	.ascii	"ts_C\334[\320I\362\271\254\342:\236k\331\236\371\377;\t\246\334"
+	.ascii	"\363%\322\371\004\025"
+	.text
+	.section	.gnu.lto_li2a.3.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`\013\007E("
+	.string	"ZE\374\016K\220\026R:\005\301+\3051\036\t\312\313\320\376PC>n \361J\200\243\306\t\nC\243\004{\310\r\222]\276\366\227K08\362V\026r\002\fx\377\211"
+	.string	"\257\021\220\221\377\272\200\230\300zb\351\356\340o\326\330\2144B\210\334I\006\333"
+	.string	"\321"
+	.string	"\326"
+	.ascii	"\367^\b\377jZ\217\246S\202\314\377\301\357\272\217\246{\361\234"
+	.ascii	"\027H\002$9\322\356M\0168\312\017\324\243\277\363+s\232\025\264"
+	.ascii	"I\247\034a\367&{\330\201z4]\021\274e\276\216\357\030~\213\313"
+	.ascii	".s\357\225\213\260{o\017\033P\217r\362\275\364\250z\232\364("
+	.ascii	"\017\231\321|P\272f\224\327\226{/\260[p\312k\017\257[s8u\227"
+	.ascii	"\242g\333!\277\212)\205\344p\235\t+\273\336\200XP\225x\016\200"
+	.ascii	"\n*\022\307\235M\2218\177d\007\24055\302\252'\226\370\356\274"
+	.ascii	"A}\310\372\331\324\211\363g-M\354cP6\245Qu\364c\017P\303\212"
+	.ascii	"\024\262\352g\210\367)`\311\n*0\310\342\231\203\242,\304\271"
+	.ascii	"n\217\310'ko@\367^\266RH\2523\314\231\231\n3\0171\247Z\001\275"
+	.ascii	"\034g\327\2621'\237lc1\377\307\305Z\032\367\025\363\216\216j"
+	.ascii	"9\007\307w\263|s\263ls\263\334;\363\\sZ\2469\330y\346\264,\303"
+	.ascii	"\273\362\034sZ\2069-\357t_\236W\234\372\344\237~\353G\237<\367"
+	.ascii	"\267\316\366\264\374\337\216E\357\311\275\037\276t\271JP1\031"
+	.ascii	"_\376\314\037\354W\376d>_\310\231|2^y\370%\177\214\207M\357\301"
+	.ascii	"\037r#\027;\022\324\306\252\\\022\264\366\312\244S:\2053Z\r/"
+	.ascii	"3\230\332\037\t\343e\220\002\265;ax\"<\277\"\357\026c\f\t\242"
+	.ascii	"\366E\210\360\004)\bc\t\314\007k\236\327\212w\213C\232)W\360"
+	.ascii	"\264\007k\372\0267\273CP\227\033iGS\265\340\205\374\213\037$"
+	.ascii	"K\020 \274\304\021$-=\3234\274\226i\353%\252\215Hv\325\t\bu\327"
+	.ascii	"W\234>AC"
+	.string	"u\235\373\332:o\366\265\217\270s3\205\351ku\231\355\372\r\3237\342X{\327\326+\252\215\210\233\301\266\366\227\347\275\367\246\272\376\362?b\222\257\255\353'1j=\331/j\023/\375\305\204B\242\215\305\307\266\306\245\335}<\327\031\300@k\265\371\264h\333>2\327\260\235\335\345\205R\020\307\376@\313\331E\362\bX\230\\\345\200\377H\356<\351\213\274\017\366\037\261\037\325v\256\013)\255\265l\334\rD<{.L\371M%\241\016\312\275\3671\370N\351\321\030(j\270~\262\300\323\306\365\235\030m<\361P\177D\313\306h\253\375*\306+D\373\205\215v\334\034\307Ltc\225\245h\023u\225\025\355\032\007E\032\254\321\322\020\321\311d\241BW\370\021\221\345\241\003A\002GG?C>9H\032\222\232\213|\222\204\027\226\224\2146$\t\213\214041\001\223\204HH\302\"`\322\205!$`\221\322\022\320'"
+	.ascii	"\0131\030)\001\231\204B%\340\232$\376\\}\035\203.\225\020\373"
+	.ascii	"\211\251<R\344J\230\202\016\212\232\020\215\263\253k,\216\202"
+	.ascii	"\226\333Y\233\267\300CV\016\247\333\327\307\223\235\301\013\263"
+	.ascii	"\234N\363\271{\317\360\244\274F \245h\327\270 g\372`\276\276"
+	.ascii	"\222\2676\026[\0343\237!\315\275\310R\t<Cj\263\303\353\035\034"
+	.ascii	"'tt\304J\3444\277\331@\310\217\361$RWn:\247-\221\2506\234\276"
+	.ascii	"\322\3278}/\243\r\233\356\365M\337\210\202\246{\375\\c\235\311"
+	.ascii	"\224\036@p}\305\313\264\246\317\242\313LDM\237I\3235\375*2\001"
+	.ascii	"\200\241\250\2018\243\030chHF$\005-H\206\003`\002\231\261"
+	.string	"\253n\021\2009TU\223\202\2441\225\277\322Ew\337\372@I\027\373V\233\030g\246\034\034\031V\251\347\024\342\200\023\356\324\265\230\377\234\274\255\333\004\\\026\201k,\330\020\024\354\342\320\r\225<\243\204@\364\227\375n\315\016\317\026+\317w\301\220n\004\242\214nA\345\337\203P\n2\001\204\022\327xJ\303\213Mi\361y\"\350\330\204\274\026$\303mH@\373\313'_\326>KXB7=\004\267oX\304\233,\277\341\354T\273\251'-\f\312\004z\2047,\255\305\306\270\334\240q\376\310+x\020\304\220\006C\274\025\226y\3447u\0227Jl\300]\200\273\230E\3100S\004\006SU\263\272h!\210\227\244\352\013\212\253\r\207\314R\267\n\2035b\032@D\204Q\221\331\275m\263G\354o\034:<,\340\023&(\ns\016`\001'\277\035\204\376\006\204\260&0 \277\226\214*JN\034\214$\313W\200\261\333"
+	.ascii	"E\t\263\263\313_\330\342V\312Br8\252\312\036\001\304e\005vL5"
+	.ascii	"\373\322t\027\373\0242\204'l\360i\262\036\324\316C_g\321\024"
+	.ascii	"^\250\001"
+	.text
+	.section	.gnu.lto_ui2a.4.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`\217\004\325\035"
+	.string	"6\366\272J\240\326Q:\r \340\322s\360k|\001Li\307\346f\3206\3459\360\023\257\320\325\320\353o\301q\025+Y\177\377Z^\202\224\033\3001\355\257\357\315\321\002\236:\307\223\322G(\374\345\211^\264)\254\253a\255\344\023B\310\2262\311\252"
+	.string	"\232"
+	.string	"\241"
+	.string	"\343\225\215\371LKK\245D\252\326j`%\020\271!\364\001\301\3748\366\260\235ocO\3435x\017\306\254\253V\0253\244j\025\032\330\004\346G\230\273\220\037\351Y\310\217\313\333\275\242\371\300\256~\232\244\324Zk\315b_K\233w\330\3534K2F\233y{.\021\005h\250\303a&|\374*iV\020\031\375\034\240\202\250\350f\211$\241\".\255\204\212(\f\324\017\223\357\031=FK\237\240\027\267\022:Ag\262\260\246\356t\376\r\3650E\022\361\276\323\t\310\250\002\032\022q.ij\255\313@CD\337\225\357\256\217\335\275\355\322\007\001'>B\212\036k\255K\023\253\312Z\273\302\016\334\300\335\317\264\310\302\332>\332\245\275<\370\235\265\260|\351\007\360\247\257\354\303\177\345\302?\366\340\017\243\274\247\353\304\257\371\341\267|\360K\216\274#\345\245\224\267\317\313\347}"
+	.string	"\004Ff\305Z\203\212T\252\220q\n\306\237~\342y\367\344\317\366\250\353x\221\037\240\236\226Ji\013\253\326j\301\374\370\275\016\336\213\354\331v\357D\214\241\225\330\200\207\024\254Z\205\005>n\205\035\245\330\232\237c\217\343M\274\017y.\253\365h\213\202\371q\205f.\366<\344\307\377"
+	.ascii	"rB{l\216j\351\017\021\274\354\226~\223/\306\331\335\264\357C"
+	.ascii	"\301\335}3\304\331@\272M\240\f92\373\250\300\0014\003$\0368\353"
+	.ascii	"'\222d\211X6p]_*R\326_\301\004\304\245(\353?q\313\372K~\266z"
+	.ascii	"\\\\W\223\315\315U\240n\026\251B6p\037\353\243%\231\004\233\326"
+	.ascii	"\347\016\020\374\250\233\375\213\365\373ILA<p\326\232\r\3537"
+	.ascii	"7\371\224\356t\027\222\3314=Zk\255\224\326'\036&\326f\323\372"
+	.ascii	"?|I=\\\334\\\224\316Q\3453\324\353\002\345\217!\003:"
+	.string	"\03104\206\327\\`\334\016\347rn\027\350\336\024\330\016\324\324\314\334d\004\330\354\350zq2\272\235\206\034\234\334\006\335\016\227\273\341\321\251\351v66;\\M\247\341fS\303\341\344\324d\b\354\356&\207S\323\331\355pj/a=}\225\315\342\340\204\220^\367\354~\207\334KM\200\035y\322\343\34294\2025p\225 \005\317\027\263]\016\202\266\316\226\225.\373\367\004\351\3059\353\2451X\223\375\333\307\220.s\212\026\331\017\226\314Z\353z5p\271\\p\016$\223\007`l\231[u\016\344\371\342\352\027%\022\263~p\326_\342\233\202\rG\214\275\227\272\331\341#\001b\250!8\344\030u\204H$H\030I\013\031\016\200\002)2\353\006\021\3209U$)dX\003\225\242\364\344\372V\262\342q\r\310}\b>\233\260\031\025\211dI\365'9\021\211\035\255sO\006\377\246f\227M\345D\b\255\013\324\240\360q"
+	.string	"\357\300\352\262\200\246j\312\266\231\037\207\251;A\031`D\375(\352\003\331\211te\304\204f\t\230\202\240\357p\n\233f\216\301+j\304D!\002< E\355\240,\306ql\013\335\332\f\342OM\365\341\247\026\n\363\025E"
+	.ascii	"\312\n(\230\003~\001\254\353)\352\313\367H\b08\234\004\235\370"
+	.ascii	"\227H\210\005#Q\301\240\342\027\210\321\005^(\316\245\016\322"
+	.ascii	"/\337d\377\340\375\337\232A9\320\257H\207\241\177"
+	.text
+	.section	.gnu.lto_i2a.5.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`\357\006\275'"
+	.string	"\352D\334\016K\220\026R:\005\301+\b'-\260\016\350d\226e\373\f\003\017[\002\036\354\363\f\030\\\202+\370\240\365\250V%\373\371b\222\343#oe\241.\340_`D\224\321\200\b\200a\276\330\213\306\025$\240P\207G\373\237M\342\t!r'\031\332"
+	.string	"\320"
+	.string	"\323"
+	.string	"\314\337b\272\326\316\274@\024\034\321\262\274\267\270\363\223\037\244?\2572\237\306\236-\276\007\360YM\217\271\267*G\221{\213<\354 \375\311\305\364\304\321\273e\276\216\357"
+	.ascii	"\236\310H\246\335\273\"E\221{/\017\037H\177\352\\\207\3764?\203"
+	.ascii	"\376d 3\225\027_\334\033G@ii\271\367\362\332\005\243\2546\360"
+	.ascii	"6\265FKo\350i\266\005\362\215\027@\342,\212J\303m'FX\365\345"
+	.ascii	"\247\205\007\023\257\005X\341\241\304i\312\251\022\246N\330\003"
+	.ascii	"\314\230\"a\323\257&~3_\236\244b\\9\205\302\364![~\035\354\311"
+	.ascii	"\242W!~\036\354\003n$\243\250B\334\374\3606\t0a!\005G\345d\346"
+	.ascii	"\244H\362\341\306\333!U\320\332\227\237{/\333(*\017g\334\231"
+	.ascii	"Y\n3\0131\243!\002N\226\214\355\226\r\345\265e\314\305\240m+"
+	.ascii	"\346\373\274 [rW1\347\340\334\240\226mj~<\353N\3134\247\345\231"
+	.ascii	"\323\262\314\223\347\030\3232L\356\\g\234i\371f;\362\254\322"
+	.ascii	"\322g\375\350\211\377\371\254s\237x\266\246\345\003@\211Lp\274"
+	.ascii	"\356\225:\343r\227\234_2\216\374\223?\327\177\274\311|\276\220"
+	.ascii	"'\371a\2542\360H>\030\003\231\356\203?\344^\377\372\021\007^"
+	.ascii	"8\356\275\352\361'\270\201\201\226\236\265?2=\253\25170\340\002"
+	.ascii	"\274Tz\2677R\204\221A@a\227B\027\221&]DvA@5x\002\363\271\200"
+	.ascii	"\214#\316\260\236i\317E\334\005)XRY\376D\207\275\013\371\017"
+	.ascii	"~\020\016A\2000\022\313ly\357\215\360\037L\352Ot\355\005\035"
+	.ascii	"\323\237\222k\\\303\264\355\"\304\n{\352\244Kz\353*F\253\020"
+	.ascii	"O[\327\274:\230\027\273\332C\332w\350\255?\303\250\304\311\222"
+	.ascii	"\365\255\255\226\020\213v\205E\355#\315{\357Em}\344u\326$W\333"
+	.ascii	"\326\027\023\316\b\332\263\324I\226\376\221|\242:\333\212\227"
+	.ascii	"4\272\232\206v\367\360"
+	.string	"\306\247c4\210\2356\233\366l\333Cf\035\026\345E\036\202\212\025\354\020\254(\357\221K\020kr\217;\277\221\332w\350\273\336\347\272\316\332\2072\273\361\265\255\035\326\3322\356\376YM\236\377P>\222\244\237\355\t\f~\023\3723\367dl\265gL\353g\0318\332\264\276\023a\215`\216\264O\274\316j\313\370\354\264?Exe\265gl\333\272a3\004;\321m\305;?{\310\230$DK\266\350'4d*Y\250\320\025n4dY\bA\257\200\221\221\217PO\316\321\022R3Q\017\222\357\302/\251(\003\222\217\250\b\003\223\022\017\311wt\344#\342!]\020:\342\021%\375x=\003\330\207\241(\211\247\344\363%\361\324\342zS\325u\316\002\036K\326\0162\037\231<\032\351\372\222\265\201\355\311\330Z\3332\241\274\266\266b)W\304\032\216\332\271\005Rf\265\232n]\017\307\256b\324n\232\315\333\033\267Cs\235"
+	.string	"\212\223%\333R\206\353s\351\372\307\234\332Vli\234\374\022Z\223a\226\026\370\022:\203\223k\034,\02177_ l\232\217\344\301\217\017\343bQWh\332\246-\021(\263\232\376Q\3275}-a\215\231\226i\232\2760\005L\313\364km\365&Q\262\200\320\272\212\031\211\306\364[\350\316\2241\375$L\200\235\250q8\243\230chfDD\n\232\244\320\001\200\002\031*\233m\021\220\265TE\223\202\2441\225^)\017\377\315\276@J8\226V]\371s=\326\247\334\306&\022\357\202\372\226\364\342\204\2678gJ\006\366>\031\024U\252 \332\260:\310\3650\205\350x\"U\031\210\315\365\036\264*\t\343\210\216\205\276\311\306\302\\V\3651\t\006u\376\310\301\003\220\037\250L\247\206\353\331\243\210\304Vf\326\345?N\307%x\332\216|a\"\231\346B!)g\222\007\377\235o\312\202\330|\233\232s\215\253\232\334"
+	.ascii	"\365\245\352\004\277X\252\217m\226\231\177\037\376\207\331e\222"
+	.ascii	"y\263h\212\313\032\214\340\241]\2267\225\025\373\001\f\b\034"
+	.ascii	"qLF&\021\223\374\"M\225\206K\031?E_\240\360%\216\211\347\242"
+	.ascii	"\n[\201'/8\333WV5.\241P\216,\0203\b\331\007\240\220-$\310*Nw"
+	.ascii	"\371B5u\347m\026\3601T\2167\303\337\276_\231I\216\241\232\224"
+	.ascii	"\216\261\001\350\304jd\f\315\250?\327\251\242\005\276\375\253"
+	.ascii	"\320Dq\322\256\314\265\234\254c*5C\\H\274~\360b\202b\274\243"
+	.ascii	"\253\2469E\022j"
+	.text
+	.section	.gnu.lto_a2d.6.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`\032\002%\021"
+	.string	"f`sH\360\316(\035\002Fu\323\017g\003\236\226\021S\234\275\214\302\270\037>\240M\373=\b\356y\256\030\n\3058\250\007\0174f\177\204\316\221\032\214\372>\f\213\363u\030r\265\214\340\344\241\035\311\206\251\\\353\263YB\366\336R\312\024b"
+	.string	"T"
+	.string	"`"
+	.ascii	"+{\201\331\264\250\265~\0026\203\356\224\033\200\356\354\013"
+	.ascii	"\033n\307\321)\233\303\357\310v\315A\003'Wv\202f\201&\254\310"
+	.ascii	"\005<*2\236\bcJ\222\315\346\313\023MX\212J\300\004YHY\331\226"
+	.ascii	"\004b<*$\261Df\374\310P,m\031Et1s\034\265\326\363\211\230\262"
+	.ascii	"\017\355\177\224\377\r~>\020\3438\216\357\226\237\371#\346{\314"
+	.ascii	"\027\355\314n\210\371\035\363\271\346S\346\317\346K\346w\363"
+	.ascii	"\271"
+	.string	"\371K\242,~4vj\2250\302\250>3'\303\277\265\360\367\376Y\301\304\274\264o\230\302\235\211\360\2565\026\303\251\265\026\370F\267\363\377\267\303z\b\177\035Y\303 \006\224F{\266\307%c\243\341\313lov\333nW\241B\2263\347\266\250l\021\n\262\333\006\300\213\004\207X\361\303\"\035\354uh\367\250G7\"vv\022\363\351vyh[\224\373\001\315\255\204]|q\266E\267\271\367\025s\361\370Po\363\r\026\203\204\307/mE7;@\225_\374\265\021n\227\177;?\231\020\030\350\350Pp*i@@\361Q\245\025\350\001\302J\211\254@T\352\243\025\362\255@\225\nD}+\217\223\352C\261@\276\322\200\203\037)\326\027\002\202\254\317\253\325\355\226/\313\206\031-m\202\027'\3525\021\223bz\275\264\r\301\304\200\350Qw\335\3659H\332%k\255\265c\300\265\210\353\266\005\215\370Pc\302\325l) "
+	.string	"#\221\3329\204 \354\025\360\266\237wi\030W\373^#\244\357.\350\225p@\263\206\336\306DA-\356\306\326"
+	.ascii	"\311\273t\221\315\274-\215\260\361X\025\373\362\233\025/\016"
+	.ascii	"\231\222\027$aG\316D\007\035\316|\271\201s\210v7G\310\363\216"
+	.ascii	"6\235G\250P"
+	.text
+	.section	.gnu.lto_a2i.7.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`\037\006u&"
+	.string	"\372E(\017I\220\330Q:\204\362\327\232\372\303\227+\343\323\2247OvU\313B\302\262\365\236S\007\231\236\251\327\016ej\236\361g\212\006\367\273\234\221<v\235\225\002D\272d\320h\320\005Ma\215\200\3205^\270\206\375\362\255\355\223-e\222\001\340"
+	.string	"\321"
+	.string	"\335"
+	.ascii	"c>\232\33401\034n7)\230\217\233\034\231\364\254\025[\\\255:\252"
+	.ascii	"l\270\335\364\241J_\363\356\227\234I\322\217&\036\240\326\035"
+	.ascii	"[^\265\036\025l\206\343sj7o\307\251\335\244X>\346_)m\327*u\303"
+	.ascii	"\253\326\252`\035\334n:\360%\255\322\217=X\034\211\345\244\205"
+	.ascii	"\246\326\332k\036k\262\322ug\016w\263\325L\332\254\264\227`\203"
+	.ascii	"\312S\361\304u_2\361\331I\210\344\350\215a\220/#\326\240\025"
+	.ascii	"\260\274\300z\025q\006\343x\306 \267\227\021eT\021\243\330\226"
+	.string	"\343B\205\246\243\005\215\327h\002),/xE'\232Cf\024s\260\363\260(d\223\b\324)\245\020\006\203\005\257\330D\031\b\030\264W\021kp\177yz\244\006\225\247\"\324\331f\241\326\272\374Tl\361\335}w\277\354\356\320\256\231\025T{\023\265\233\270\346\345p\306\022\267YN\266)\253\234\266{d\342\236\332=\2023A\324l\357\330e\336\036\346\345\331\261\361\026`^\002\003l\274:\314\233c\343\025`\343\305y\362\017p\303;W\326\257;\177\365\347p?\376\267s}\315w}\351\257\276\315\274\314\2747`;B\306s\246V\026m\324\324-&\230\220s\375]\337G9\330\356\271\301C\331\177\231_^\222\324Z\317\275\027\255Q\024\220Xf\016\037\363\275\326\201/\370+%\0066%\322\307\331\315}\224\340\356y\363\273I{'\177\362\345\236\324\314\267\333\205\364*$\342\236\214L\316j=\216@\343Z1\237&"
+	.string	"\265\311\2705\004\204\032\337\356\326\212\335N\020oI\243\223\263Z\353\317\315\365@\003\255\265\023^)\253\374e\206L\207-\303W\254\306\235#\305t\025\311*\017\362$\265\245\326S{d\225\205\356\032\204\325\n\376\271\331\303\343\260\"Cy\375\035H\3300\256i\017\277\374\355\314\212\f\275\351\245\234\353\356!\356$j\002\372\003r\354^'Q\303i\001}\241T7N\363\030\330/L\371\327sI)\\\274\270y\214\023\233/\377\033NP\335\277\242\315ik\266\205%Zk\255\346M\377\352\023\246\224"
+	.string	"\336\364@\252\335\274\351{\341\365\273\032\2346\257YKX\304\306\256\317u\237\236~\357\372c\204Rm\366\233\307\204UL\334fuJ\032TR|\241\240=\265=\255k#$\226&N\263:e\2146K\373\001\243\327\366\242\254\272\370\371\271\376\200\225E\\\277\353\032p,=\354\207\244c\026E'B\372\365\321\220\210!\020f\021\021\322\217\n\005\201>\320 \243`/\220\017\002\203\020!$"
+	.string	"-\330\031\021\304\033\264\340\007\034\n\032\t\225\370\001\203\204\212L\034\365~@\"\"`P\3577\004D\324\0132\n\366\026\034X`\221\220Q\357\b\b4\352\235\307\2455\307\231\275\247\331\333f\017\240\275'\355m\332;=\\\\\367\236\335K\273\373<{\002\216\245fZ[\221\001\275'\353\260b\274a\265\233;0Q\266\252\235f\263Z\353\251v>\242\224D\312\352\032]Om\004a\216\247\337\305\b\231\033\201>\330qTF\240\324r\272\247\207?\357\351\247Aji\3424[\367\201\241\204\332\262\324iZB%'\006\036\264[\331\312\022\346\256\274"
+	.ascii	"\223\002Z\256\205\t\013\nN\311\007\201\356erl\313\2241J\271\365"
+	.ascii	"\324\232'Q\323\351\0227t:{\250Q \306\234\202\246fD\202\t2\233"
+	.ascii	"f\f\200\002\2219+\036\021p\315sS[c3\204\266\242\240\325j\257"
+	.ascii	"}9\211\022\364Q\"\2342F\310D\267H\305X\036\327m\f@Z\005\026T"
+	.ascii	"Tx\200B\264D\002\246\002\221\"\fk\327\354\337\357\304_\234\306"
+	.ascii	"\216\234\346]7z\"\362\323i\313\346<YwL,\313\244\266p0\223\367"
+	.ascii	"\367\373\261HU-\354\207\202W\206\366\262\217KM\036^\263\302D"
+	.ascii	"\253\315r\242TK\001*\337w\220,\311\252\233\334\217P\343\254!"
+	.ascii	"/}\350\302\306\207\312{B\036gb\023\021D\263\220\234G,\006\312"
+	.ascii	"t\301|\177N\276{\310\306\255\244A\250G\254\306\203\251\005\f"
+	.ascii	"\303b.\200\262\260\373\356\3305\272{\030#7#\3464\237?\004\033"
+	.ascii	"q\356\036;\260\225\271~!\3356\337v\002zz\352\016\306\212\356"
+	.ascii	"\031F\bT\007\206\343\211=\345\222\036YicIO`2\315O\r"
+	.text
+	.section	.gnu.lto__i2a.8.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`\312\001\345\021"
+	.string	"\366!{H\260\226Q:ld\340\334\231\342\325\351\206\346:L\345\362\017M\346\013\243\234_\370\033s!ly\221\272\370\317\337\232\342\206\325.\246\025\243}\272\026\314\351\032\027\215G\021\203K\275z\311\231\273_L\333\035D\343\267dK\231Rb"
+	.string	"^"
+	.string	"f"
+	.string	"\307a\373\250\300"
+	.ascii	"\3464Rr\232sd\340\227\360`K\332\366m\\\311\346\033\2011\211h"
+	.ascii	"\265\364$\205\217\311\234\243\350\361+\252\203\341\007\250\016"
+	.ascii	"\356\213\337.Wo\376}\227JI>v<\240\313\242\257\\\020\365\244D"
+	.ascii	"\205\027$W\206d\354\356\273\n\361r\252\253\2319\247u\307#\272"
+	.ascii	"\301\333\246\261\215\302~\223\273H^\255jq\226\200\004\251\224"
+	.ascii	"u\307o\310\324){\004\322E\262/\347\036\331V\247\260\336\373\303"
+	.ascii	"3\375\253\217\277\352\275[\256zU\255\252\276\nJ\013!\006\226"
+	.ascii	"\3149\364s2\203\200P"
+	.string	"3\354\353\260\331,[\032\371\230\212\330\270pY\277\364\336\355\002\346<\352Q\023\036\224+\\\252\317\341\337\b)\333\302m\316.\227\233\262O\242\243\201R\264\3537\371\374(\221\030\376Mu\360\276\335\021\234\376N\234\307O8g\220L-\324\335$8\270\353\202\001\205\323\237\256\352\207\016*\247?\337w\224&\026rgp\222\265\357\275\205\323)\203\272\332p\277\266\315\204~\307\332\226n\201\2767\242\253\221\323\237\0034\361\236$\025\345\024.Ab\204\210\233\020 >x\260\351P\303a\203\206\f4\030.X\250@a\202\204\b\020\036\3108\210\201q5xqiA\020\253\275p\344\353~\301\304\264\344\344\310\274X\n\350\3340\026\331L\247F\213\371\310f\260\030\317O\217(\233\355\354\314`\242L\347\265#\302h5\221\345\200g<1\232\3303\233\321D\3268/\347\036\371\276\207H\236T,k-5\\\271B\266\003\036"
+	.ascii	"s\203\360\303\320!0\n\204\321(<\331\227Lay\033\254h\340\016i"
+	.ascii	"\022\013\032\033,FBs\224\022\377h\035f\023\232k8\311\n\0367\001"
+	.ascii	"}\034\t\302AfC\030\002\346\016\re\t\343t\250yp7\222j\320*\221"
+	.ascii	"\246\024\n\n"
+	.text
+	.section	.gnu.lto_itoa.9.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`\241\006\r%"
+	.string	"\352Bd\016E\200^Q:\027\n\231"
+	.string	"q\326\270\244\232f\215F(=\234\f\303\002\242\020\377\240d\023,\237\\\217\277\226\321\323\245\247\023\303DIP"
+	.string	"\003\305P\362-\327\306\256[*R\331\037\357\354i~\332\377\244\021\262\345N2\322"
+	.string	"\306"
+	.string	"\315"
+	.ascii	"\303S\rp\220\236{\213K/\371f|\314\265\227\225\031\007s\215\271"
+	.ascii	"\305\214Z&\356\354\270~\f\325\003\334\333\204K\362\336\342\022"
+	.ascii	"\2238_v\330\256V\346\207\271\030\034/\362\027\317\356\305z\222"
+	.ascii	"\274\367.\261\203\363e\31623\337\313\277\340`*\\\361\311\325"
+	.ascii	"\353\370\260:\376\271\267\250\343\342\211\314\227\347\207\314"
+	.ascii	"\227\355\344T\257\321f\247\314,mW*\276\335\002\305\217\220\230"
+	.ascii	"\3435Z\022\326\325\221\317\0366<\202|R\225\241\221z\312\230\222"
+	.ascii	"\260\256\220\\F\344\246M\240\207\253\317\215he\211\200H\021\336"
+	.ascii	"+XK{`\016\023<\017\033\026\261GI\336\b\321Q\255\220\367\215X"
+	.ascii	"es\367\336\037_y\020\201\265\312\230\356\275\\\205\304\253\263"
+	.ascii	"\355\314\\\206\231o0\233)\002\265\235\310\304\251\252\200\030"
+	.ascii	"@\232\246c\257a\276k?\230\004XS\256\365\273\326\261\032\373\325"
+	.ascii	"\224+\252$\354\326@\314E`\355,\346w\232\246)w\023f$\263\362\221"
+	.ascii	"\255<\340\350\031g"
+	.string	"+\033\025\231\225\211le\001O\236\207le\241\217\371o/\376\266\033\377\332\215\347\231\255|\332\3122[\331\264\225K\256lm\345.+\327\262\362\013\320\302\314Q\362s/\220T\320\005+\273\246\034\375\223\367J\236\353]\215\225\206sU\305K\254\270\342\275\032*8\322\3672\3743G\3634\215\205\374s\357\255m\031\261\266\214nP&\340\016\017Fv\\\217\372>\206\312\034\316\2020\321R\262WKC\035\037\n^\332\341\316\326k\371^Tz=~\224\037\205{~\314+\376\246w\336[5!\352\f\256@\360\222\250wP\272~5\025\320&\234`\027\260\246h\220\242~r\211l\350\254\335\266\205\232\357\345\233Q/\034\352\\\260sp\267\331B\375<\301.@\"\037\231\374\274\314\316b\263\273\235\310\300\361:\315L\032\366\256\037\210U :\335\347\262\375\244\331W\363\\\331f\377+\270\247\313\256\307\006\277\265\355\007\257"
+	.string	"k\312\263\356\376\227\325\030-\313\322{&\277\215S\317f'\n\237\312|y{\"fC\261p\361\231\243\244\354\254\363\217\327\217\376\232\263\255\265\2365\017ff\005\267\265\023\2317?\236\206Z\231\365\215g\246_[\332\371\313\274\361\025\226\374j \266\241T\336\235\305\005^\303\f\374\302E\013\026+T\244@q\302D\t\022#D\204"
+	.string	"\361\301C\007\016\0334d\300p\301\002\205\t\022\"@\330=p\320\200\301\001\250^\223\223m:7A\210\300"
+	.string	"\006\214\tM\013\216b\234\237\026H\361b\364\246\240lH\361\236\240d\370h\350\244xQQ\274'\235T\214\246(\335\323TO\267\300"
+	.ascii	"\363d@M\351h\360xS\272Z\361w{\273\311\255),\3715\020\214\275"
+	.ascii	"\310\031\256\331\236\267Fj\036\314\007;_N\007\002[\250\226\227"
+	.ascii	"\243\016!\216\006 \221\372(\r\327Ge}k\243\346#q\262>\333\210"
+	.ascii	"\016\233<\203fg\313\220id\375\255[\037\355k=\327g\337j\354'\353"
+	.ascii	"\201z\251R\204I\300\316\316:\305\270~\230C\315\266\264]$\347"
+	.ascii	"\304\227\354\210\361\271\236\343\253\371\217\277\017\241\026"
+	.ascii	"\260\212\016!j~\233\023\001\200\204\250\201D\204\030RffD$\310"
+	.ascii	"LAA\332\320\"\221\262\252\003\021@=Tv\223\024\262qsk%\233gw\317"
+	.ascii	" t\252\316\354\326f\3637F\215\320\324\244\001\016\312\234\221"
+	.ascii	"EcXd\217\373\227]\366\341\016\b\356q\217U\203\321\204\305\307"
+	.ascii	"\242F\211\327\226\"\266\022\020\331\r\023a\311\032\343\342\t"
+	.ascii	"*9\261f\226\226\357\037\033\313\217X\353!\232\233&\303\300\353"
+	.ascii	" \177q\275\027\250\022p\377\343\301\232n\231\321b\326w\210\326"
+	.ascii	"=\311\f\236KK\233\320\021\206\201\311s\316\315\242g#\325\"sK"
+	.ascii	"-s.\357\234\307xY\023/\2327#\214\272>\322\212\371\b\365\034l"
+	.ascii	"\035\307\307\337\t\036^\217\206F\274\276M\253\n\016\022;h\307"
+	.ascii	"%\027,^\347\001n\245\233\020w\237\026\005}\037s\360h$\007 T\230"
+	.ascii	"\022\223S\260.\222\213\2266j\230\374\027T\215\311\314-\275\324"
+	.ascii	"\351\312\263W\3579\0373\313\331\333fJ\005"
+	.text
+	.section	.gnu.lto_ftoa.10.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`!\bm)"
+	.string	"zF\214\017Fp\334Q:\177Cgf\204\0062P\203\224\321!w\237$\361{ \b\"\017\352S\374\276g\333\225m\211\023#q=\202\016\341\004\243\235p\320Mn\262S\313n\244[\236b\nH\312O\227\251\370O\032!D\312$\003\342"
+	.string	"\330"
+	.string	"\354"
+	.string	"9\343\2330\246\364g\207%M\2500u\261\031i\375\302\221uMi\2535\371\340\347\242H\233\230\264|-T'\252\265\b\225\263Z\223G;\"\375\311nI\314\273\277r,SO\356rs\265\236ArVk=\332\t\351O\237\271\273{*\2572\265T\004\222^Y\177\223\344j\314\255\326\344o\223\027\200\376L\017"
+	.string	"\375\331FN\365\036Oh\027\244\313\2458\3644\233\251\366\313\233aadG,\342{<!\323\201\026\232\216\257!\265L\001`H!\274\013\n\002\206\004\302\272!\317\231\024j\270\005\371\032\362\207\271\353s\345\346\313'"
+	.ascii	"C\372\3404\001\356\\Y=\216^\031\371\334qS\207\265\343m\026\320"
+	.ascii	"B\323\301\303\2622\027\250\021\231\363\345\371\006V\0253nC\255"
+	.ascii	"u\371\210\225\365\035\372\356\272\355\256\216]\234\215}5F\255"
+	.ascii	"*~\333]\031\037fr\324R\353\245\002^\257\330\262\306\212\373\254"
+	.ascii	"N\317\235\213\t\036\360\252\325\370\243\213\324\370,\243\237"
+	.ascii	"\347\362\013[E;R\374\034F/\273\320\021d\221\337V\267F\207\306"
+	.ascii	"ei\326*\373\331M\022"
+	.string	"\271\273vo\326.\262\273\274\fp\274F\327\362\373.\366-\272\331\227h\250\367\344\317{\362\233\313\361\246\313\213\303\361\242)\357\211\3435q\274\215\3622\363\276\001/K\315A\234Zs\274\375\251i\247\230&\027\373\313\376/\277\331\315\335\251\375\330\311\256<\230/7\250q$\355\232\301H\211\310\224\254kI[\255\3656x|\221\362\021\207j\355b\362U+\222\006WR\227{\231z\231TZ\277<\2145i\253\025\371\"\375\271i\273%I\273\\\250^\215\310e\376\220\261\361\320\230\251\303\306\207\023\241&\303ci\324~\354\306\204\301\"fL\032Y\020\323\340\335\260\322=\232dQ\323\r@\360\263+\201\001\274J\230\250\321\304\335)\251 My\233\277\341SJ\204#e\224\215sve+\327]\373\237@\273Wl\221\003\200\323]\024)\370\307n\n[VM\\V>Y\253\351\221r\b\316w\025\350\356B\270R\205"
+	.ascii	"\266Z+\206\001lx\212J hw\355\t8f\257\233\314\230\365P\347\372"
+	.ascii	"\306\302@\211z\305\0266\254\364\321c\335\227\f\372\263\203\001"
+	.ascii	"\376\274\216\334\273K-\370\307\365\031\233\270D\315}\243\033"
+	.ascii	"+"
+	.string	"w\020\365\315\356{\023\255)\362[\237Zk\200\\\277\033\214\021\354\313\353\224X\271\336P<{\275/@\017\223Gm\313\034\352'\357+._e\003HZ]\roos\254j-*\340\365P\213\304\273\274\004\243I)\306)a\2020\250\213\022\006\207$\232\224\234\202\300%\026;\3410\030\245\004\034\206xb\241k!\fBE\225\210R\03261\005\255R\005\013\021\230\2300(!\025\220\361\005\"\t\207\301\027PK1\204C\340\322\323\214\250\237p\350\3444\004\376\204A%\247\037\020\352\305\017I\301\016\237\226\240~Q\303!\324/(Yo\326.\262\235a\253\330UeRf\255\\\032\332\264\360\333\362\220\0038m_\007m\241\275W\002\r\260\245}@>\346o\032\024\307\205\026\306\240w9t0j_3\350\033\241\034\340\017 \370G\243\366\371Y\253\017\364\244\"\200\222=\025\372\023\001\033\036\264}\215\203R\305\247"
+	.ascii	"\243}\300\327\273\"F\0245\332\277\n\264\247\250/v_\021\320g\240"
+	.ascii	"g\0275\217\031\265\314>\333\244s\025\250\310oJ\263M\334\351\251"
+	.ascii	"y\200\236\250AT\246\frjDD\244 I\313\r\240\242\221*\243\007\022"
+	.ascii	" \3655\t"
+	.string	"-\232\231\n\n\n\n\352Q\332\f6\205(\002\241\346\232o\0019\250D\0367\210J'\027\246\254S\266\265gT\257G?S\002P\262P\n\022\2126\330\367v\250{P\320\217\374m\304\3329\031\033\315\340\211\331\027WV\353 x\355WI\036\220>f\363zyn\360F\320\204/\007\353\300\335P\253\264=\354\026(c\323\255\026K\256\275\322\246\2042%[7U\232`4\332\006\3616\245\364<\353UL\345x\022+quQj=4\036\333\375\240r\264\356U\302\331\2756\246\3621\302o\346\026\322c\226\333$\376^\351)B\002\231\250\207f\215\2531)m\312\036t\021\3073\234\312q\365-\005Ee\246\352`z\nG\360~\3453\312X\037\366\236}\275\030\366\313\037N\307\001(\302\rs\203D\302\354[o7K\264\201\027\021\300\023\224\272\352\r\001\252EwP\ro\331\303\324z}\262g\033\311\034\nD"
+	.string	"6h\276-\017\265\031-\255=\234\206\252\207\215\267\354\313G"
+	.ascii	"\\\303$\005\240\bZc4\316\357\353p\370\th\275\\kL\362\037"
+	.text
+	.section	.gnu.lto_fastA2F.11.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`s\020mM"
+	.ascii	"\212~\254\033=@\346\316\030o+\346>\227a\276\\\002\t\331\264\f"
+	.ascii	"\324\375\272H-1\257\374\b\342\357\260 =\314\377\004xwp\247\316"
+	.ascii	"/a^\314=S\b\242\"\242\252\252\272!\204\220\bI\"SJ)\263\001\211"
+	.ascii	"\001\253\001I\210u\016d\3377G6\321K\307\210\215\322\326n\300"
+	.ascii	"n\276\356\276n\277\3562\3552\267\313\271\262\322\007\255O@2\210"
+	.ascii	"\206\357[%\0018\306m\206;\220\225\216\006\220.O\034\3036f9n1"
+	.ascii	"=\246\311\364\037+\275H\031\026D\302\250C\372-\3113\364\320\304"
+	.ascii	"OH\007+}|u&\337\327\r\0234\034\220m\364\352X\363\361\025\t\243"
+	.ascii	"\256\t\007\035\023\303\367}\267\332\310\031\220\336c\254\235"
+	.ascii	"\271\2774\030\271\256\272h\244\367M\302\005\315\373V\2738\f\331"
+	.ascii	"F\256\"\233Kw\221c\276\266\325\274'\235\207J7\006\361}_\250\263"
+	.ascii	"\231\3346\266\255\344\266\361\227\034\217SY\335V\233\243\330"
+	.ascii	"\211\233\254\344\366(\327N\253*\252)\251\253(\250'\247&\246%"
+	.ascii	"\245$\244"
+	.string	"\243&\323h\251,J\"\217\256\261}\227\343\306\002\316\261a\007\243\235Ve\272\352\213S\265\310\302:/m\331\373\276\\|\252KKu\351\253?-\036\245\344nKC\265tK?e\271\352\271S\224n:\242\r\3101\345\310]\224fZ\202\362\304\225\240t\222\223&\216t\005\323:\337\367e\342Gy\201To\026i\3461\017a\240#wE\332(\260\257\n\353\362\210\370\262\013\353\206\\\355\325\005q\345\225\222;!]\244\0258\345\310\235\220N^!\273\260\016H\357\325\375\360\343\221; \355\266\004\250rv0\355\350Z\246:H\374(\355\346\334\330\036g\344\320c\332\315h\313\020\031b\373\257}j\027\303\333);\372\373\257\333+[\362\330\260\333\321~D{\337\227\335\206\335]3\200f\366!\314\374\306\314\354\020\335\246\271~zh\b\231\340\271=\036\277\304\241\325U\360\002\374\n\204\231\035\253\373\332@\321\325\207"
+	.string	"\367D\346\372\366K&H\220]\246qC\005\371x\274\365\202\211CQ"
+	.string	"\017B\210G\005\307Wp(\211\331\r\353\241\222\216\031\210n\333\006\370\343OW\024\262\266\375\337\325Q\367\377\203\230=n-tmv\031\357+\305j\277&\033d|<\244\237B\204\237\341\271\365\262\017\360Sf\341\032?\215\217\fG\304\355\373\033\277\351v$\333ogG\335~\377?C\207\345N#w%\212|\302\355\302mc\177\027\232\006\221z\226\373\257{\210\365M\200\227\266\357\373\276m\206\357j;\301:\300g\370\036\234\253\022\303\263\274\264\306y2mf\324=3\335\024\276j\266\304\214H=\221\335\232\246\360\365D\346*\f\177<\346.\313Cd\310\237\204Y-\003\206\013\255\263\205\326\271B\353La\202\204\b\020\0368Hk\300"
+	.string	"\355l\201\231\202\004\b\272\332]f\240u.@6\326\326f\261\006l\016\003k\276\346/\250WW\3735su\231\346-\002\003\236ZY\002\002\270\316X\2563"
+	.ascii	"w\276::;\217\316VG\347*w\246z\347\251w\226::G\2753\224;?\271"
+	.ascii	"\316N\256s\223;3\265\316K\255\263\222\3219\311\350\214\324}\315"
+	.ascii	"GM\327\231\351:\033\271\363\262uV\032\235\213\214\316\311\326"
+	.ascii	"\031\331\325\346\243;\273\357l|\347\326\235\377\235\335\235["
+	.ascii	"C\r\260<\334<?A\226\036\217\333MS}\353-\335\351H2\203\250\213"
+	.ascii	"R\232\267\222\373\374\264,\027\007\346U1\371\307\227(\351\361"
+	.ascii	"\270\3314\325\303\211\331\303\255GN\257\251\276\377L\203H\023"
+	.ascii	"\315\214,\257\207\030<\237ASP\341{\r4\265\303K\026\244\246\327"
+	.ascii	"\363\362\350\241?\345\246\326s\273l\376\263\327\364\324\177\020"
+	.ascii	"#\365P?5F\212\357t\324}z\250\367?t\330\030zO\337~\235\3037\370"
+	.ascii	"\204~\367\035=Q\304\301<\373\026\211_\214\232N\207\375\264\003"
+	.ascii	";\371$q\221\271\340\2715:z\257\237\266P\2442\321\276D\242\325"
+	.ascii	"\310\354\265~J\330N\203\335\364N\337M\377\177\2440\275\013R\257"
+	.ascii	"^\264\272/\354\033\260\365lP\3534\321\264\036\255\212\232\263"
+	.ascii	"o\300vJ\303\376l/F\232\005^\277\364\013\336\007\347\250a\257"
+	.ascii	"\364K\337sp\222^\351\3333s\206q\032\351\223\376\005\231\036\351"
+	.ascii	"]\221n\221y\005\323A\016\177\350a\362\362\352\305\254\371fW-"
+	.ascii	"\200}\026\330}\343\212\305H\331\365G?\345V\231"
+	.string	"\365\315\237\2568dU.\337\365\352\250\353^\255\024\276\313\307\343\026\207\b\213.<\213+\311~\323]?=\004\250\b\303s\233\024\360Y?Mv\234\313\374\264\301F\323q\256\3213\277\215\026\245{\313+\220\254\256\357>%\206\254\307p%r\341\273\257\235\312G\376\205o\305\242W\376+\316\031\2525\013\272\311/\372\366\317\034\365\223\337\n\322-J=k\004\331\365\310w\305\271\275\253\220\273\242\307cG\266`\2138\244\036[\260W\034~q\003n\321\267\025m\306/0\025\3217#\333\032\034\210\326-\304\210\270\266\rE\211\265\024\306\266\022klqF^#+\360\005\002D\331\232W\324[3\233\227[tD\034\\[\n\267([\333\033\213\023P\267\250\t\023Q6\250\333\2105\023P6\2708\250\027\026G\337\332\340\240'\242Q8\250\262\372\366'a\267\242\360\312-U\025\276\200\205wJ?\006\027x\256\267\360\033"
+	.string	"\347\264NE@Gm\247\271\245R{\004\b\036\372\024\366\334J\355\241_\341\373\257\223\315\264A\225S5\005\366j?\335z\007\204=,|\325\276\371\250\036\017\217\324\203\261'#\224r\360\334^}=\330O\3714\331\247\361y\003FV\007I\2370S\017\262\375t\311\376\001v\320\3017\037\330;x\2173&\207^\r\251\253Ob\344\241\004*B\324\217%\241\360\240BAxn\237\332N\177\375\364\230F(\303\021\371\270K\363\365\3157\366hQ\021\020\373\351\216}\004\254 \204o\276/\2044\n|=\004\034X5P\255\223\330\033\250\322O\327\300G}\337\231#\204\305R\370>A\321\201\243I\302\267\035\036\246\346\323b?\355k#\025uP\233&<\267L\003\236"
+	.ascii	"\026\200\307\002\320\344\212\212-B\340\273*\366m\365\367}a8M"
+	.ascii	" \360\023\250H\370\266\266\263\231\315f\321\364\323u\276\004"
+	.ascii	"\253\257z\347\325[};\206nQ\332OW\354\253\376\261S\332N\037\276"
+	.ascii	"\277\246\245\255^\221\265*mu\347e\001%q\365\326O]\330\351-5\370"
+	.ascii	"\022Y\252\022\203o\221]LJ\373\001Kl\221~\272m\3553#R,\221\001"
+	.ascii	"[\337e\230\032\364\236~~\201u\250aD%\225BC\"\"\222$\005\205t"
+	.ascii	"Q\005\304 \007\035\274:\021\360@\247\234\242\222\024\244\262"
+	.ascii	"\254\001sHYdG\243\344MC\017\2563(\tF\334f\252\320\021ac\b4&\236"
+	.ascii	"r\345\240\300\003ta\262\224P\177\215-\300#;D\364\261\342qE\337"
+	.ascii	"\341\364\002\276\320\b\335\324gu\351i\306\243\236\262a\271\252"
+	.ascii	"\343\2522\360\3234\335\300q\267WY\tjB\257\006\217|rn\216\252"
+	.ascii	"5~\312\237\315J\312\300Ce?\327\350\331B\206\245V(\357\004\323"
+	.ascii	"\377l\220\3237\301Ak\016\341\263\205\341?\267\007\251\033X\227"
+	.ascii	"\177\374\223\357\276`\312a\370\326\333~F1<p+\007\267K\003\026"
+	.ascii	".n\025Y\276\335f\"\247\234\250& \353\342/f\233\364\rGo\204G"
+	.ascii	"\177E\362\205\204'\247\333\262\324\342'\246\333aHSr\351\0073"
+	.ascii	"k$\375\246z\n\306\377|&\364\220\300\025\005\213\374\001\320"
+	.string	"\035\252\216V:B\272#\356j\363w\330\225\361\222[`M\236\306\3110\032e\335\217\230\007\225\250>\363\353\251G\305\222\020G4\026+d!\353*k\300mhBi\217\310\\_\323\033)B\333?NBYS7\307w\205\240\035y\275~A\201d'\240Ti\frw\033\251#~\341\034A\026d\302\264\303\t\330\261\366P\304:\032.\305\345X\276\317\211/C\003X\316\236P\257\205\272Ga\237\251\275\263:MR'\265C\253*S\336\230\013\243X\234T{t\0340\016\2120\246\236\r\350`\350\230\033\b\353@\234cPsE\277\321\314\3627\372\264m?\006\216\263Db@*=O\003\225: \3244?Zq\202\226m\001\004\367\265{\312\362Pg}D\036\237\002\300h\251\361\233\215X\372\322y\206\252x.\260-\204\202\314\030\276\023\255\215\276\374C\226f2c\336-$\032\320\334\302\240/\201,\225S"
+	.string	"B4\373\334\346\254\fc\315h%IE8\315\332.\342!]\222!\275\020\224\372\"\313\022\302\025_\322\224\305\262\206\370\322\264\244\360\006k\002\321\r\260t\257\253P\\A\312h%\222\253`\275\210\273\2174/\242\31788\257\344\225\323P\204\213\302\313>W\231P|\306\224\220\243\345'\036\363\222\007\320\005x\341k9\234\002\230\277\271q\333>"
+	.string	"\343\013h"
+	.string	"\221\013\237%\275!\310\351\341K\203\357\371\275(\320\374\274&\025\341\3724<\217\025\226T"
+	.ascii	"\210,(9\327!q-K@]$g\234\310\2212L_\342\357';\003\330\262t\236"
+	.ascii	"\235\206\345r(K\007(j\016\372X\001\376 c\233\212\216\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`\023\001=\b"
+	.string	"\262\21404P\215\322\0010]1\341\001\214\234)\351FLl\320\242\342$\204\022E\253n\267\222\314\034\363\231\231\231e\247\rf \003]\375\350\206\261\366\233\tk\277$2\005\006iN\023\024\262h2\\\\4\0272\214\346G\373d\210\033)R\210\323\364h\350\221\016\207\t\247\211eh\r\223\007\311iv24H\311\342\301ijB\232\327\2634\261\021\372\203C\244\304V^#4F\3043\331J\204@\024\241N%;\017~\361\374\302\27618\007w\327F(8\006\tn\351\334q\016\220@\"\221\332\334\312m\333\266\201W4\247\b|\022\360|[\241 B\2352\257*\373\336R\330\2673\032p\262\273{]+\333U&\033"
+	.string	"`\350\234C\303\320P\030\332ZK\t\335\234\2315\303\003\365"
+	.string	"\340"
+	.string	"\340\360\001\222\375\245}\020\306\303*! \220\346d\004"
+	.ascii	"\232cH\365\r@\f\030\020\016\350\001\350\241\223\016\252\304\340"
+	.ascii	"I\206\016\246\023"
+	.text
+	.section	.gnu.lto_.refs.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2b5c830531037d8,"e",@progbits
+	.string	"(\265/\375`\343\020\365T"
+	.string	"\332\221\340\037T@R\312I\007&\355\356Ny \331\355\n\375\260\305\303\rU\035\313\002T;M\335\252*\351pA\352\323.[\261\030d\242\332&\302\211YQ}&?\251\251\310"
+	.string	"3\310\22437\301\335\2359w%\315/GvU\252VnV\335\314\362#\2264\351\335\244L\001\260\001\350\001\361\001\335R\002@u\225\260\214\251\233\301\306X1\242J\254cP\331\227R\253\233R\341ju\333U\361T\n\243\364\323\231S\313h\303\f\327\257\226\177\261l\226\324\264\212Bd\311\225gM\230\274=\246P\320wi29\263j\303u\315t5\314\315\315\315\231\361\236\355\225\257\331\277V\266\354\"\226\322Vn\n^\033\023thV\024k\302\254Ux\307\226\354[\345i\272U\016p\263)v\250\250h9b\212Q9s\330\020e\212\353\227\312\277S6l\221*t/uw"
+	.ascii	":UG|\374\340\372\2655a\346l\217\271R\202\276`=fQ*m\260\335\024"
+	.ascii	"\232\225\020\2568\333\363\345\265mZ;\322\330K\271\343\344\206"
+	.ascii	"\016C\322\035\021er=\340\340\372\345\332\344\277O\266k\221:\364"
+	.ascii	"\351\330`\335i\t\r\224\350 \303u\323\215\362E.\224\013\r]'D6"
+	.ascii	"Ww/r\305\261{\270\310\0357\335\303\235\335\024\273)j\023,#af"
+	.ascii	"}\007\347\3235a\236\333c\346\374|\235\274\347\252\207\316\347"
+	.ascii	"/\201\177\033p\341_\bZ\370\327g\364\357\013\242\177%\370\327"
+	.ascii	"\203\024\226\207\302\277'\030\020\366/\t)~.\240L\204\021?s\371"
+	.ascii	"\027\004(\377\223\274\253\377\256a`\r\234\371o\030\244\210\177"
+	.ascii	"\263\224\300\373w\354\337\017\376\315\340\337\025\377:\360/\212"
+	.ascii	"\177K\374\253\363\357\371/\377\227\373\277\346\277\231\377d\376"
+	.ascii	"\213\371\337\345\177\226\377%\374\007\341\177\331\377\261\377"
+	.ascii	"Q\376\233\360_\204\377\f\374\247\362?\204\377\312\377^\377\221"
+	.ascii	"\377O\374G\373\2173777\367\363\213\177W\370I\350\004>8H\312\364"
+	.ascii	" '\304Wn\251$k\013\202\344\2674,X\\\347n\b\0324\273\346\344i"
+	.ascii	"\"\233\224\bc\323\231&5\3375\273\245\232\253(\256\233\206\311"
+	.ascii	"\271\253\342\266g\334\326\314)|\3235\t#\244G\231\257\231\234"
+	.ascii	"#Wl\030\341\272q>:bE\312\330p]\2707$\2479\325\366\266%sv\267"
+	.ascii	"\256\233\007\232\026O\331\202\203\033\363%\263\345G\034\024\327"
+	.ascii	"\005\342i8J$rENs\313\313\376\340e\305l\027\273\245Z\027\304\226"
+	.ascii	"\223\024\233\226\222\362A!\315\370\206\353\212\371[\r\263\242"
+	.ascii	"\346\212\353\2029\232\231\205\0070N\\\227\215\307\343\313\027"
+	.ascii	"\221\353~\371\222'\\"
+	.string	"RY\333d\016\033\260/\261\254\263\366\317\372\260[\276h\273\366\243m\227E\321\255\325D6/\024\\}5\225a\323RE\237\177\271|\273\374BC\233\314\3516\3404K\0133r]5\037\234 R\214\034\341\272i\233\034QD\n\271p}\032\237\035\247/5D\256O:\3717{X\354\356\032\273\264\213\304\234\357n\327\347\327Y\335\"\320\375_G\242\255\233F\026\232\023\t\331P\307Qt\005-d\26244\226\350\264\213\250\362J\210z}1\226H\333*\200V\372h4\2752\326cs\247\275\275te|\001M\217E4=\nyz\351(\354N\215<(\330P\270\250\362\312\210*\217\306\022\275\324\302V\016\255\316\245\243\021M;\032yP\345\320\210.]\031K@ea9A\307 \247\326\013\272\3244\240\252\206E\23654=v[\367\2021u\021\201\356\252c\261m\230\303Z!\256\321 \212\r\217\233v\367"
+	.ascii	"PD\254c/\255\241I\216\335I\2101\032j\2050]k \273&\364Q\325OL"
+	.string	"\335\004@u\013\267\327\272[\330\335\274bU\332M\305\203jAA\005-\344I\211a\262\264\326\\\211\253\001\345\254<'w\240l\2411red\024N\2736\271\363\322\003k\211+?Y/]\324\360\255\fs\351\270`\261\021\271\362\0267Y\256\243\261\223\247;$\314\232\246\240}\235\257a\217f\362\222\256!g-\0368\211\316L\221m\204A9r\344\234\344\214Dh\350h=A\252\334\230\310\311F\3169\272\226Ll\\\271\310\371\206\0164\326\276\020)3$G\220\254\363lu\376\352\354\343\007\007\321\261u\023U\244\304\266FQ\237\035\265\033\336\322\262\316A\316@\204\206\3566B\214\230\332\260c\212Z\232'\\y\207\273\035L\027U\312\225u8\034\t0H\324\224u\201\r\361Q<\031\213o8W\313\317\177\266q\316\301\006\037udrZ\210\354(\236\027\021\26236\215J\371\350\300\021\211s2u>\236{"
+	.ascii	"A\354\301\204+\363\370\0029\363\205V\361\016\036\202\020{3\346"
+	.ascii	"d\035\017\354\020\302\312\r\3273U\326\027\"=p\345\375\322d\251"
+	.ascii	"M\276\273\313\f\3438\347\370E\2100\343\361\343\352\313\371\363"
+	.ascii	"\21501:\264\324\316/\226\223\321\250s\024\033\007\350\376\201"
+	.ascii	"\207\223\024\223\235\267%\021\215\213"
+	.string	"g#\331)\006nj\207\327\316\0229\034\304T9y\f;\261\023C\205\021\242\265\303bl\267\2473\224.\r\214i\216+\343p\262\035\253\270\032TSN\335\031/\361\022\243iGm\030(')698\3224\t\233\316hr\305\223&B\2702\323\227X5\252\264\270\262\r\233<\311\224h\r\361e\305Q\346DMy\326\"C|\b\036nw\362I\3349E|:\303\302\363p\221^s\313$W\356E\362\026\327\017&\256;\267_\3123F\256p\3357_\356\312p\225\231\375\214\347c\b\364+=w5\332\254\2336+7\001\026\220\270\226\252\nG@\340\005D\273 \221\020\004\301\237\217\027$j\021\374\371\224xA\"#\032|I\346\f3\212~H\301$\236\021\222\322\214\3723:\"\372\371\202G>\245\025\210\210xf\230Q$\303H\206\371\030?,\374|H\301$ \243\027JGE?\037\020R\222\022\020"
+	.string	"GGJ\277\037\360\307\213\001\210\024#\b\374\361`\364\214\216j\260W\204\024L27\020\262 \230\324\203\301\353\001\2030j\017\030\364U\237PO\367B\250\247\353\t\371\224jO\310w\244\264{\002\007\3160B\002\n\002\201H@8=!\037Q}\221\017\311\350g\304\302\371\025,\036`\321B\006\336[\270P\341B\205\371\026.\202\202\\\260\b:\317\"H\207\324\213QT\337\033b\241\002\006\214\026\275\037\002\036A\004\030\240\030\001\004\016\316\242\237\037\320\227\204d\004\303\017Xd4c\206 \320\017(C\006\260\b\350\347\353\311"
+	.ascii	"*BJ\002\372A\200\3378\356\f\307n9K\fWI\354\246\330-\211\f\223"
+	.ascii	"f=\253\005\021\244\204\036MUd\222\340\250e5\001q\036sN\312\235"
+	.ascii	"\261\201\341\312m\3146\002Klm\215+\377\300^v\276\256n\260\"F"
+	.ascii	"yv\024\002\005s\016C6\245\227p\345/\314v.H\257\033H^\343*\222"
+	.ascii	"\345\345?\224l)R\034\321F\325\264f\355\270kc\026FH\2271\323J"
+	.ascii	"\024\224/.\214\016\213,\237\324\264\230R\256$}\340-\313\365%"
+	.ascii	"\243-\220,B \313S\006\336\222\261,\327\t\316\242\363f\353\215"
+	.ascii	"\334\330\371=a\356\334\2360\317g?\233\361\025\245(]Yk\302\\`"
+	.ascii	"{L\266\022t.\033\201:\241C\270*\260=\346\317d]vo\346\344\270"
+	.ascii	"\270n\231\037\260!<\2463SA?\271\031!;c\2433"
+	.string	"F\265u\234r\036;\213\t\r1\227\016\215\345\225\032\256L\345\274CJ\315,.\214w \371\241\\\302\365\017\234\310\034F\243\224\257m\362\243\344\314D\t+ujr\002\201X\250\241(\204\234%23#\"R\220$I\007a\005\204\030\006\245U\035\021\200\255\202FfD$IR\253\320\034\211\005"
+	.ascii	"iG\t\340\021R\037lP\342\030\005\\\251\355.:\351\235\243\300\267"
+	.ascii	"T.\343R"
+	.string	"!}\314 \353\225h\026M\327\253\251\226\263\202`q\252\245%r@\001\226\227\371\211I\267\260\214\342\375}\246\314\200\350M\353-\347\312\236\363\017\335\036\224^|\253.\256-\250\303\026\227\247\346\304\264\210\"G~3*\036\255\312A\b\353n\355\327\006hi\252\"\b\370\211\237'\241W\361)\314\3622\243\253:J\371\002\017\"\361\222\363\240\332\276\036\231\346\357\271\336\200\373\216\372m\313@\224\327\017n\304w\350\264\234\345Hq\232\262\262\022\350!\342J\271\003\243\370#\247\0215{\356\325\bz\002\020z8\217\003\"\266\323\207i\034\232\320k\354\310\364\231\306O|`\272{.&\314\266\372\340b\032\341Y\220\247\356Nc\375<Pv\006\2140\352\f\245\324\027\277$\023\263t\216\307\244\024\357\225LV\262\3140,v\244\245\277\244\263+c\335\025?H\241\n\331\346\201#*\242\352J\373=\334\023\327]\334\n\217\356"
+	.ascii	"\305\273\023\0253\265\250\260\303r\227\\\306\b\242\031r7\202"
+	.ascii	"$\255\215G\021\035\370Xr$\001_A&\331\034\342\304\270\271\022"
+	.ascii	"\0306\t-{\207\227\203Zm\352\335\312\257\037\034\275q\211\337"
+	.ascii	"\366\327\372\036\034\254o\026/\255\317W\1778\265\201\243\227"
+	.ascii	"\344\033^\024\210\317D\343\227\306*\343R\236\177\253\332\205"
+	.ascii	"\274RV1<\321a\0040\206\206\017\276\003\350\275\314\230\205\336"
+	.ascii	")\031-N2{[\372\035X\313\222!\260\335u6)\022\022AB\t\316\325\305"
+	.ascii	"\031n\222\007C4'%<\021\227\264(l{ Q\002R]R\276Q\275\017/%k\177"
+	.ascii	"rw\251%\312D\272\224\005z\246q\206X\207\304\240o\346@\365\364"
+	.ascii	"\001p\013\027\200\372N\247\300\001\363\246F\032\036\227\226w"
+	.ascii	"\f\r<\344\223\301\311\017M\007\262\257j\001>\017\352{r3>/TW\373"
+	.ascii	"Gn\033\376\220:\274<\013\"e\243\320\007\217\263!\247i\027M\237"
+	.ascii	"\241\217\217#~\007}t\350\320\270\032\302\335\371\376\327_\331"
+	.ascii	"\277g\273\b\030\273m\312h\034\331\377\225V\256E\276C7\226/\371"
+	.ascii	"\231\267E\374\272?d,\214#;\300\034\004?\346\325\371\337\306\341"
+	.ascii	"\327\232\203\3674\366\207\177\221B\357If\374\302\376\310u3/\363"
+	.ascii	"a\370\231KT\206\206\251\002"
+	.text
+	.section	.gnu.lto_.symtab.2b5c830531037d8,"e",@progbits
+	.string	"uli2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"li2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"i2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"a2d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373"
+	.string	""
+	.string	""
+	.string	"a2i"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2b5c830531037d8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8233 @@
+	.file	"config_eeprom.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/include/stdint.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/config_streamer.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/drivers/system.h"
+	.file 8 "./src/main/config/config_eeprom.c"
+	.file 9 "./src/main/common/maths.h"
+	.file 10 "/usr/include/strings.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	config_eeprom.c.83c53a6c
+	.weak	config_eeprom.c.83c53a6c
+config_eeprom.c.83c53a6c:
+	.long	0x769
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF1093
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1000
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1001
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1002
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1003
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1004
+	.uleb128 0x2
+	.long	.LASF1006
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1005
+	.uleb128 0x2
+	.long	.LASF1007
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1008
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1009
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1010
+	.uleb128 0x9
+	.long	0x80
+	.uleb128 0x2
+	.long	.LASF1011
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x9
+	.long	0x8c
+	.uleb128 0x2
+	.long	.LASF1012
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x9
+	.long	0x9d
+	.uleb128 0x2
+	.long	.LASF1013
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x2
+	.long	.LASF1014
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x2
+	.long	.LASF1015
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x6
+	.long	0x87
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1016
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.byte	0x1d
+	.long	0xfb
+	.uleb128 0x10
+	.string	"b"
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x11
+	.long	0xfb
+	.uleb128 0x10
+	.string	"w"
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x12
+	.long	0xae
+	.byte	0
+	.uleb128 0x11
+	.long	0x8c
+	.long	0x10b
+	.uleb128 0x18
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1031
+	.byte	0x5
+	.byte	0x1a
+	.long	0x164
+	.uleb128 0x4
+	.long	.LASF1017
+	.byte	0x5
+	.byte	0x1b
+	.byte	0xf
+	.long	0xba
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1018
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1019
+	.byte	0x5
+	.byte	0x20
+	.byte	0x7
+	.long	0xde
+	.byte	0xc
+	.uleb128 0xb
+	.string	"at"
+	.byte	0x5
+	.byte	0x21
+	.byte	0x9
+	.long	0x64
+	.byte	0x10
+	.uleb128 0xb
+	.string	"err"
+	.byte	0x5
+	.byte	0x22
+	.byte	0x9
+	.long	0x64
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF1020
+	.byte	0x5
+	.byte	0x23
+	.byte	0x9
+	.long	0x164
+	.byte	0x18
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1021
+	.uleb128 0x9
+	.long	0x164
+	.uleb128 0x2
+	.long	.LASF1022
+	.byte	0x5
+	.byte	0x24
+	.byte	0x3
+	.long	0x10b
+	.uleb128 0x2
+	.long	.LASF1023
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0x9d
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.byte	0xe
+	.long	0x1b7
+	.uleb128 0x13
+	.long	.LASF1024
+	.value	0xfff
+	.uleb128 0x13
+	.long	.LASF1025
+	.value	0xf000
+	.uleb128 0x13
+	.long	.LASF1026
+	.value	0xfff
+	.uleb128 0x5
+	.long	.LASF1027
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1028
+	.value	0x8000
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x6
+	.byte	0x29
+	.byte	0x6
+	.long	0x1ca
+	.uleb128 0x5
+	.long	.LASF1029
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1030
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xf
+	.long	0x1d6
+	.uleb128 0x1e
+	.long	0x1e6
+	.uleb128 0x1
+	.long	0x7e
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x17
+	.byte	0x8
+	.byte	0x6
+	.byte	0x35
+	.long	0x206
+	.uleb128 0x10
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x36
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0x10
+	.string	"fn"
+	.byte	0x6
+	.byte	0x37
+	.byte	0x16
+	.long	0x206
+	.byte	0
+	.uleb128 0x6
+	.long	0x1ca
+	.uleb128 0x19
+	.long	.LASF1032
+	.byte	0x6
+	.byte	0x30
+	.long	0x258
+	.uleb128 0xb
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x31
+	.byte	0xb
+	.long	0x17c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1018
+	.byte	0x6
+	.byte	0x32
+	.byte	0xe
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1017
+	.byte	0x6
+	.byte	0x33
+	.byte	0xe
+	.long	0x258
+	.byte	0x8
+	.uleb128 0xb
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x34
+	.byte	0xf
+	.long	0x25d
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1033
+	.byte	0x6
+	.byte	0x38
+	.byte	0x7
+	.long	0x1e6
+	.byte	0x18
+	.byte	0
+	.uleb128 0x6
+	.long	0x8c
+	.uleb128 0x6
+	.long	0x258
+	.uleb128 0x2
+	.long	.LASF1034
+	.byte	0x6
+	.byte	0x39
+	.byte	0x3
+	.long	0x20b
+	.uleb128 0x9
+	.long	0x262
+	.uleb128 0x11
+	.long	0x26e
+	.long	0x27e
+	.uleb128 0x1f
+	.byte	0
+	.uleb128 0x9
+	.long	0x273
+	.uleb128 0x14
+	.long	.LASF1035
+	.byte	0x6
+	.byte	0x4c
+	.byte	0x1b
+	.long	0x27e
+	.uleb128 0x14
+	.long	.LASF1036
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x27e
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xe
+	.long	0x2d2
+	.uleb128 0x5
+	.long	.LASF1037
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1038
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1039
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1040
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF1041
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1043
+	.byte	0x6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1044
+	.byte	0x7
+	.byte	0x27
+	.byte	0x3
+	.long	0x29b
+	.uleb128 0x14
+	.long	.LASF1045
+	.byte	0x8
+	.byte	0x22
+	.byte	0x10
+	.long	0x8c
+	.uleb128 0x14
+	.long	.LASF1046
+	.byte	0x8
+	.byte	0x23
+	.byte	0x10
+	.long	0x8c
+	.uleb128 0x3
+	.long	.LASF1072
+	.byte	0x25
+	.byte	0x11
+	.long	0x9d
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x8
+	.byte	0x27
+	.byte	0xe
+	.long	0x32c
+	.uleb128 0x5
+	.long	.LASF1047
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1048
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1049
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1050
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF1051
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1052
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x3
+	.long	0x301
+	.uleb128 0x16
+	.byte	0x7
+	.byte	0x34
+	.long	0x367
+	.uleb128 0x4
+	.long	.LASF1053
+	.byte	0x8
+	.byte	0x35
+	.byte	0xd
+	.long	0x8c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1054
+	.byte	0x8
+	.byte	0x36
+	.byte	0xd
+	.long	0x8c
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1055
+	.byte	0x8
+	.byte	0x37
+	.byte	0xa
+	.long	0x367
+	.byte	0x2
+	.byte	0
+	.uleb128 0x11
+	.long	0x80
+	.long	0x377
+	.uleb128 0x18
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1056
+	.byte	0x8
+	.byte	0x38
+	.byte	0x1b
+	.long	0x338
+	.uleb128 0x9
+	.long	0x377
+	.uleb128 0x16
+	.byte	0x6
+	.byte	0x3b
+	.long	0x3d0
+	.uleb128 0x4
+	.long	.LASF1018
+	.byte	0x8
+	.byte	0x3d
+	.byte	0xe
+	.long	0x9d
+	.byte	0
+	.uleb128 0xb
+	.string	"pgn"
+	.byte	0x8
+	.byte	0x3e
+	.byte	0xb
+	.long	0x17c
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1057
+	.byte	0x8
+	.byte	0x3f
+	.byte	0xd
+	.long	0x8c
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1058
+	.byte	0x8
+	.byte	0x42
+	.byte	0xd
+	.long	0x8c
+	.byte	0x5
+	.uleb128 0xb
+	.string	"pg"
+	.byte	0x8
+	.byte	0x44
+	.byte	0xd
+	.long	0x3d0
+	.byte	0x6
+	.byte	0
+	.uleb128 0x11
+	.long	0x8c
+	.long	0x3df
+	.uleb128 0x20
+	.long	0x37
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1059
+	.byte	0x8
+	.byte	0x45
+	.byte	0x1b
+	.long	0x388
+	.uleb128 0x9
+	.long	0x3df
+	.uleb128 0x16
+	.byte	0x2
+	.byte	0x48
+	.long	0x405
+	.uleb128 0x4
+	.long	.LASF1060
+	.byte	0x8
+	.byte	0x49
+	.byte	0xe
+	.long	0x9d
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1061
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x1b
+	.long	0x3f0
+	.uleb128 0x9
+	.long	0x405
+	.uleb128 0xc
+	.long	.LASF1062
+	.byte	0x5
+	.byte	0x2c
+	.byte	0x5
+	.long	0x64
+	.long	0x42c
+	.uleb128 0x1
+	.long	0x42c
+	.byte	0
+	.uleb128 0x6
+	.long	0x170
+	.uleb128 0xc
+	.long	.LASF1063
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x5
+	.long	0x64
+	.long	0x447
+	.uleb128 0x1
+	.long	0x42c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1064
+	.byte	0x5
+	.byte	0x29
+	.byte	0x5
+	.long	0x64
+	.long	0x467
+	.uleb128 0x1
+	.long	0x42c
+	.uleb128 0x1
+	.long	0x467
+	.uleb128 0x1
+	.long	0xae
+	.byte	0
+	.uleb128 0x6
+	.long	0x98
+	.uleb128 0xd
+	.long	.LASF1065
+	.byte	0x5
+	.byte	0x28
+	.long	0x487
+	.uleb128 0x1
+	.long	0x42c
+	.uleb128 0x1
+	.long	0xba
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1066
+	.byte	0x5
+	.byte	0x26
+	.long	0x498
+	.uleb128 0x1
+	.long	0x42c
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1067
+	.byte	0x7
+	.byte	0x2a
+	.long	0x4a9
+	.uleb128 0x1
+	.long	0x2d2
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1068
+	.byte	0x6
+	.byte	0xf3
+	.long	0x4bf
+	.uleb128 0x1
+	.long	0x4bf
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x6
+	.long	0x26e
+	.uleb128 0xd
+	.long	.LASF1069
+	.byte	0x6
+	.byte	0xee
+	.long	0x4e9
+	.uleb128 0x1
+	.long	0x4bf
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x4e9
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x6
+	.long	0x4ee
+	.uleb128 0x21
+	.uleb128 0xc
+	.long	.LASF1070
+	.byte	0x9
+	.byte	0x92
+	.byte	0xa
+	.long	0x9d
+	.long	0x50f
+	.uleb128 0x1
+	.long	0x9d
+	.uleb128 0x1
+	.long	0x4e9
+	.uleb128 0x1
+	.long	0xae
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1071
+	.byte	0xa
+	.byte	0x78
+	.byte	0xc
+	.long	0x64
+	.long	0x52f
+	.uleb128 0x1
+	.long	0xd2
+	.uleb128 0x1
+	.long	0xd2
+	.uleb128 0x1
+	.long	0xc6
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1094
+	.byte	0x8
+	.value	0x10b
+	.byte	0x6
+	.long	0x557
+	.uleb128 0x15
+	.long	.LASF1073
+	.value	0x10d
+	.byte	0x9
+	.long	0x164
+	.uleb128 0x7
+	.uleb128 0x15
+	.long	.LASF1074
+	.value	0x10f
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1085
+	.byte	0x8
+	.byte	0xcb
+	.byte	0xc
+	.long	0x164
+	.long	0x5eb
+	.uleb128 0x3
+	.long	.LASF1075
+	.byte	0xcd
+	.byte	0x17
+	.long	0x170
+	.uleb128 0x3
+	.long	.LASF1076
+	.byte	0xd2
+	.byte	0x14
+	.long	0x377
+	.uleb128 0xa
+	.string	"crc"
+	.byte	0xd9
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF1077
+	.byte	0xf9
+	.byte	0x14
+	.long	0x405
+	.uleb128 0x15
+	.long	.LASF1078
+	.value	0x101
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x15
+	.long	.LASF1073
+	.value	0x106
+	.byte	0xf
+	.long	0x16b
+	.uleb128 0x7
+	.uleb128 0xa
+	.string	"reg"
+	.byte	0xdb
+	.byte	0x1f
+	.long	0x4bf
+	.uleb128 0x7
+	.uleb128 0x3
+	.long	.LASF1079
+	.byte	0xdc
+	.byte	0x18
+	.long	0xa9
+	.uleb128 0x3
+	.long	.LASF1080
+	.byte	0xdd
+	.byte	0x18
+	.long	0x3df
+	.uleb128 0x7
+	.uleb128 0x3
+	.long	.LASF1081
+	.byte	0xed
+	.byte	0x1a
+	.long	0x8c
+	.uleb128 0x7
+	.uleb128 0x3
+	.long	.LASF1017
+	.byte	0xf2
+	.byte	0x20
+	.long	0x467
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1082
+	.byte	0xb2
+	.long	0x164
+	.long	0x644
+	.uleb128 0x7
+	.uleb128 0xa
+	.string	"reg"
+	.byte	0xb4
+	.byte	0x1f
+	.long	0x4bf
+	.uleb128 0x7
+	.uleb128 0x3
+	.long	.LASF1083
+	.byte	0xb5
+	.byte	0x1d
+	.long	0x32c
+	.uleb128 0x3
+	.long	.LASF1084
+	.byte	0xb5
+	.byte	0x28
+	.long	0x32c
+	.uleb128 0x7
+	.uleb128 0xa
+	.string	"cls"
+	.byte	0xbd
+	.byte	0x22
+	.long	0x32c
+	.uleb128 0x7
+	.uleb128 0x3
+	.long	.LASF1081
+	.byte	0xbe
+	.byte	0x11
+	.long	0x64
+	.uleb128 0xa
+	.string	"rec"
+	.byte	0xbf
+	.byte	0x23
+	.long	0x644
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x3eb
+	.uleb128 0xe
+	.long	.LASF1086
+	.byte	0x8
+	.byte	0x9c
+	.byte	0x1e
+	.long	0x644
+	.long	0x688
+	.uleb128 0xf
+	.string	"reg"
+	.byte	0x8
+	.byte	0x9c
+	.byte	0x3d
+	.long	0x4bf
+	.uleb128 0x23
+	.long	.LASF1087
+	.byte	0x8
+	.byte	0x9c
+	.byte	0x56
+	.long	0x32c
+	.uleb128 0xa
+	.string	"p"
+	.byte	0x9e
+	.byte	0x14
+	.long	0x467
+	.uleb128 0x7
+	.uleb128 0x3
+	.long	.LASF1080
+	.byte	0xa1
+	.byte	0x1f
+	.long	0x644
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1095
+	.byte	0x8
+	.byte	0x94
+	.byte	0xa
+	.long	0x9d
+	.uleb128 0x1a
+	.long	.LASF1088
+	.byte	0x60
+	.long	0x164
+	.long	0x6e5
+	.uleb128 0xa
+	.string	"p"
+	.byte	0x62
+	.byte	0x14
+	.long	0x467
+	.uleb128 0x3
+	.long	.LASF1076
+	.byte	0x63
+	.byte	0x1b
+	.long	0x6e5
+	.uleb128 0xa
+	.string	"crc"
+	.byte	0x6f
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x3
+	.long	.LASF1077
+	.byte	0x85
+	.byte	0x1b
+	.long	0x6ea
+	.uleb128 0x3
+	.long	.LASF1089
+	.byte	0x8a
+	.byte	0x15
+	.long	0x6ef
+	.uleb128 0x7
+	.uleb128 0x3
+	.long	.LASF1080
+	.byte	0x74
+	.byte	0x1f
+	.long	0x644
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x383
+	.uleb128 0x6
+	.long	0x411
+	.uleb128 0x6
+	.long	0xa9
+	.uleb128 0x25
+	.long	.LASF1096
+	.byte	0x8
+	.byte	0x53
+	.byte	0x6
+	.uleb128 0xe
+	.long	.LASF1090
+	.byte	0x6
+	.byte	0x3e
+	.byte	0x18
+	.long	0x9d
+	.long	0x719
+	.uleb128 0xf
+	.string	"reg"
+	.byte	0x6
+	.byte	0x3e
+	.byte	0x37
+	.long	0x4bf
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1091
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x18
+	.long	0x9d
+	.long	0x736
+	.uleb128 0xf
+	.string	"reg"
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x33
+	.long	0x4bf
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1092
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x17
+	.long	0x8c
+	.long	0x753
+	.uleb128 0xf
+	.string	"reg"
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x35
+	.long	0x4bf
+	.byte	0
+	.uleb128 0x26
+	.string	"pgN"
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x18
+	.long	0x9d
+	.uleb128 0xf
+	.string	"reg"
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x30
+	.long	0x4bf
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 27 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 30 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.file 31 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 32 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 33 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x21
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.file 34 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 35 "./src/main/config/config_eeprom.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF973
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF999
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF972
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF996
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF1097
+	.long	.LASF1098
+	.long	.LASF1099
+	.long	.LASF1100
+	.long	.LASF1101
+	.long	.LASF1102
+	.long	.LASF1103
+	.long	.LASF1104
+	.long	.LASF1105
+	.long	.LASF1106
+	.long	.LASF1107
+	.long	.LASF1108
+	.long	.LASF1109
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x24
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1110
+	.byte	0x9
+	.long	.LASF1111
+	.byte	0x9
+	.long	.LASF1112
+	.byte	0xc
+	.long	.LASF1113
+	.byte	0xd
+	.long	.LASF1114
+	.byte	0x3
+	.long	.LASF1115
+	.byte	0x3
+	.long	.LASF1116
+	.byte	0x4
+	.long	.LASF1117
+	.byte	0x3
+	.long	.LASF1118
+	.byte	0x2
+	.long	.LASF1119
+	.byte	0xc
+	.long	.LASF1120
+	.byte	0xc
+	.long	.LASF1121
+	.byte	0xd
+	.long	.LASF1112
+	.byte	0xd
+	.long	.LASF1122
+	.byte	0x9
+	.long	.LASF1123
+	.byte	0xc
+	.long	.LASF1124
+	.byte	0xc
+	.long	.LASF1125
+	.byte	0x9
+	.long	.LASF1126
+	.byte	0x9
+	.long	.LASF1127
+	.byte	0xb
+	.long	.LASF1128
+	.byte	0x9
+	.long	.LASF1129
+	.byte	0xa
+	.long	.LASF1130
+	.byte	0xa
+	.long	.LASF1131
+	.byte	0x9
+	.long	.LASF1132
+	.byte	0x9
+	.long	.LASF1133
+	.byte	0x9
+	.long	.LASF1134
+	.byte	0x9
+	.long	.LASF1135
+	.byte	0xc
+	.long	.LASF1136
+	.byte	0x8
+	.long	.LASF1137
+	.byte	0x8
+	.long	.LASF1138
+	.byte	0x7
+	.long	.LASF1139
+	.byte	0x6
+	.long	.LASF1140
+	.byte	0x5
+	.long	.LASF1141
+	.byte	0x6
+	.long	.LASF1142
+	.byte	0x1
+	.long	.LASF1143
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF813:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1015:
+	.string	"size_t"
+.LASF992:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1062:
+	.string	"config_streamer_finish"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1040:
+	.string	"FAILURE_ACC_INCOMPATIBLE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1080:
+	.string	"record"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1041:
+	.string	"FAILURE_INVALID_EEPROM_CONTENTS"
+.LASF995:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF522:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF985:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1076:
+	.string	"header"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF401:
+	.string	"true 1"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1086:
+	.string	"findEEPROM"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF993:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF509:
+	.string	"__P(args) args"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF973:
+	.string	"EEPROM_CONF_VERSION 159"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF1074:
+	.string	"attempt"
+.LASF989:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1094:
+	.string	"writeConfigToEEPROM"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1056:
+	.string	"configHeader_t"
+.LASF785:
+	.string	"NULL"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1053:
+	.string	"eepromConfigVersion"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1035:
+	.string	"__pg_registry_start"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1091:
+	.string	"pgSize"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF546:
+	.string	"__always_inline"
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF385:
+	.string	"DEBUG 1"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1009:
+	.string	"long int"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF957:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1025:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF968:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1023:
+	.string	"pgn_t"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1068:
+	.string	"pgReset"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF962:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1026:
+	.string	"PGR_SIZE_MASK"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF991:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1044:
+	.string	"failureMode_e"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1021:
+	.string	"_Bool"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF971:
+	.string	"Q12 (1 << 12)"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1004:
+	.string	"signed char"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF1011:
+	.string	"uint8_t"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1031:
+	.string	"config_streamer_s"
+.LASF1022:
+	.string	"config_streamer_t"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1000:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1051:
+	.string	"CR_CLASSICATION_PROFILE_LAST"
+.LASF1027:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF988:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1047:
+	.string	"CR_CLASSICATION_SYSTEM"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF979:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF923:
+	.string	"BLACKBOX"
+.LASF1059:
+	.string	"configRecord_t"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF764:
+	.string	"__need_size_t "
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1007:
+	.string	"__uint16_t"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF765:
+	.string	"__need_NULL "
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1020:
+	.string	"unlocked"
+.LASF766:
+	.string	"__size_t__ "
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1058:
+	.string	"flags"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1066:
+	.string	"config_streamer_init"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF978:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1084:
+	.string	"cls_end"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1070:
+	.string	"crc16_ccitt_update"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF784:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF400:
+	.string	"bool _Bool"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1006:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1019:
+	.string	"buffer"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1034:
+	.string	"pgRegistry_t"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1024:
+	.string	"PGR_PGN_MASK"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF980:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1052:
+	.string	"configRecordFlags_e"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF997:
+	.string	"CR_CLASSIFICATION_MASK (0x3)"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1060:
+	.string	"terminator"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1045:
+	.string	"__config_start"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1079:
+	.string	"regSize"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF960:
+	.string	"VERY_FAST_MATH "
+.LASF1077:
+	.string	"footer"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF970:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF1014:
+	.string	"uintptr_t"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF982:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF986:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF983:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF972:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1065:
+	.string	"config_streamer_start"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF975:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1083:
+	.string	"cls_start"
+.LASF1008:
+	.string	"__uint32_t"
+.LASF1055:
+	.string	"boardIdentifier"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF1029:
+	.string	"PG_PROFILE_COUNT"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1063:
+	.string	"config_streamer_flush"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1064:
+	.string	"config_streamer_write"
+.LASF1072:
+	.string	"eepromConfigSize"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF772:
+	.string	"__SIZE_T "
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF998:
+	.string	"CRC_START_VALUE 0xFFFF"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF29:
+	.string	"_LP64 1"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF499:
+	.string	"__PMT"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF967:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF984:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF963:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1002:
+	.string	"unsigned int"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF999:
+	.string	"CRC_CHECK_VALUE 0x1D0F"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1042:
+	.string	"FAILURE_FLASH_WRITE_FAILED"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1092:
+	.string	"pgVersion"
+.LASF1032:
+	.string	"pgRegistry_s"
+.LASF1090:
+	.string	"pgIsSystem"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF545:
+	.string	"__wur "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF402:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1046:
+	.string	"__config_end"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1017:
+	.string	"address"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF881:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF956:
+	.string	"sq(x) ((x)*(x))"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1075:
+	.string	"streamer"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF958:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF787:
+	.string	"__need_NULL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF885:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF1073:
+	.string	"success"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF1010:
+	.string	"char"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF893:
+	.string	"USE_UART7 "
+.LASF887:
+	.string	"USE_UART1 "
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF987:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF974:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1001:
+	.string	"short unsigned int"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF879:
+	.string	"GYRO "
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1096:
+	.string	"initEEPROM"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1093:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1087:
+	.string	"classification"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF1028:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1018:
+	.string	"size"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF1085:
+	.string	"writeSettingsToEEPROM"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF883:
+	.string	"BARO "
+.LASF393:
+	.string	"SITL 1"
+.LASF1037:
+	.string	"FAILURE_DEVELOPER"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF994:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1012:
+	.string	"uint16_t"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1003:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF990:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF783:
+	.string	"__size_t "
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF822:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF976:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF586:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF946:
+	.string	"__disable_irq() "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1057:
+	.string	"version"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF996:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1088:
+	.string	"isEEPROMContentValid"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF802:
+	.string	"USE_PPM "
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF959:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF966:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF803:
+	.string	"USE_PWM "
+.LASF782:
+	.string	"_SIZET_ "
+.LASF977:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF821:
+	.string	"GPS "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1033:
+	.string	"reset"
+.LASF897:
+	.string	"USE_PPM"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1081:
+	.string	"profileIndex"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1082:
+	.string	"loadEEPROM"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1095:
+	.string	"getEEPROMConfigSize"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF1043:
+	.string	"FAILURE_GYRO_INIT_FAILED"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1005:
+	.string	"short int"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF981:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF969:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1067:
+	.string	"failureMode"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1036:
+	.string	"__pg_registry_end"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF949:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF801:
+	.string	"USE_CLI "
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF964:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF888:
+	.string	"USE_UART2 "
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1013:
+	.string	"uint32_t"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1071:
+	.string	"strncasecmp"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1089:
+	.string	"storedCrc"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1048:
+	.string	"CR_CLASSICATION_PROFILE1"
+.LASF1049:
+	.string	"CR_CLASSICATION_PROFILE2"
+.LASF1050:
+	.string	"CR_CLASSICATION_PROFILE3"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1054:
+	.string	"magic_be"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF961:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1016:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1030:
+	.string	"pgResetFunc"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1038:
+	.string	"FAILURE_MISSING_ACC"
+.LASF965:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1039:
+	.string	"FAILURE_ACC_INIT"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF1078:
+	.string	"invertedBigEndianCrc"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1061:
+	.string	"configFooter_t"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF898:
+	.string	"USE_PWM"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1069:
+	.string	"pgLoad"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF929:
+	.string	"USE_PROFILE "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1124:
+	.string	"features-time64.h"
+.LASF1114:
+	.string	"config_streamer.h"
+.LASF1137:
+	.string	"__locale_t.h"
+.LASF1138:
+	.string	"platform.h"
+.LASF1140:
+	.string	"target.h"
+.LASF1122:
+	.string	"libc-header-start.h"
+.LASF1121:
+	.string	"stdbool.h"
+.LASF1107:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1098:
+	.string	"src/main/common"
+.LASF1134:
+	.string	"stdint-intn.h"
+.LASF1106:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1109:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1129:
+	.string	"stubs.h"
+.LASF1101:
+	.string	"src/main/target/SITL"
+.LASF1126:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1105:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1128:
+	.string	"long-double.h"
+.LASF1119:
+	.string	"strings.h"
+.LASF0:
+	.string	"./src/main/config/config_eeprom.c"
+.LASF1110:
+	.string	"types.h"
+.LASF1116:
+	.string	"system.h"
+.LASF1100:
+	.string	"src/main/drivers"
+.LASF1108:
+	.string	"/usr/include"
+.LASF1097:
+	.string	"src/main/build"
+.LASF1123:
+	.string	"features.h"
+.LASF1139:
+	.string	"common.h"
+.LASF1131:
+	.string	"typesizes.h"
+.LASF1136:
+	.string	"locale_t.h"
+.LASF1099:
+	.string	"src/main/config"
+.LASF1132:
+	.string	"time64.h"
+.LASF1111:
+	.string	"stdint-uintn.h"
+.LASF1133:
+	.string	"wchar.h"
+.LASF1103:
+	.string	"src/main"
+.LASF1102:
+	.string	"src/main/target"
+.LASF1117:
+	.string	"config_eeprom.c"
+.LASF1143:
+	.string	"config_eeprom.h"
+.LASF1104:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1118:
+	.string	"maths.h"
+.LASF1135:
+	.string	"string.h"
+.LASF1127:
+	.string	"cdefs.h"
+.LASF1112:
+	.string	"stdint.h"
+.LASF1142:
+	.string	"build_config.h"
+.LASF1113:
+	.string	"stddef.h"
+.LASF1130:
+	.string	"stubs-64.h"
+.LASF1125:
+	.string	"wordsize.h"
+.LASF1141:
+	.string	"common_post.h"
+.LASF1115:
+	.string	"parameter_group.h"
+.LASF1120:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375 \302\025\004"
+	.string	"2\006\027\"\220)\351k\231.\324H\t)"
+	.string	"\032\326nk\355U9UUUUi3\022\266\361\335\310&\244\355Ddm\223X@P\346\227\200\306!Q@\226\231\311\303\210X\016\236H\001/\277\345\236\350\264\207`u!\fNC\341\3514\233}\337\250\224W\325\267\362\235>\335\003\352\020\021Z\261-\017"
+	.string	"\273\201\257\002@\276\001\223\206UV\201\034v-\234\211\365\250&/\017"
+	.string	"1\273|W\312\357n\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375 V\235\001"
+	.string	"\024\002J"
+	.string	"\006"
+	.string	""
+	.string	"\003"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\001"
+	.string	"\001\005"
+	.string	"\001\006\b"
+	.string	"\003\t"
+	.string	"\003\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"(!z\206\302%X\2525\273\232`\200\005"
+	.text
+	.section	.gnu.lto_.inline.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375`.\001U\b"
+	.string	"\"\f)/PO\222\016"
+	.string	"\247\2748\007GYxM \302VH\230g*>l\200\025\236\344\004e\246&!\267\326\373$j\305\305\332V\277\235\204\264-w\n\377\007u\364\310\314\201\376=\364c\303I\0218`\326\306\210\250/f\025l\364\033\241\246%\355\204BA\323\216\205\312d0"
+	.string	"C\213\317\226g\355\032ZA2\2629ph\b\007d%\341\225\353%2s\3423\315\314\304\025k\343\177wwQ\267\364\314\032~g\031\370_\324K\017\324\373\376\bo\246\2319\255\207\300\016\023\024\216\205\376E\364b\322\300\270\203\360\272\004\001, \220\002\251\252\351\001\263\001#e\3004f\373S\217\026\027M\301q\024\321\007s\330\t]\246\255\r\346\002HlL\301\2417*#\374\r\300h\016\301\221\275={\302%\260+\340\004\"\034\232j\314\342$\307\315\227\271\031\270<\030["
+	.ascii	"\256Ah\260\210\200\305`\034\271\304\214\355\002\314\302+\242"
+	.ascii	"<\333\323\370\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375`N\004\035\f"
+	.string	"\322\r*-pK\222\016\274\352\352\377\345\303#\222V6@@P?{N\350\276\330^\377_0\274\364"
+	.ascii	"\360\235\245i\027\036\006\262\250\265M\032\221I\006LX@PP$\031"
+	.ascii	"\256%#7\202\373-$bE\n6\270\257#\206\004 \035*\325\340L<I\034"
+	.ascii	"w8p\013B<t\212U'\310\255\222@\223\306\275\324\256\026\256\327"
+	.ascii	"\363\343\242f\343\213\363\364\n>\275M3\345Rk\364\270\036\033"
+	.ascii	"\270\241\247\317\276\313\370\313\2226t\034\272.i?\271\031\320"
+	.ascii	"\347\226W\231Z\233\355\224\253\304\215\361\027\257+\367\225\353"
+	.ascii	"\214\3120\316\260\311\362Hu\020a\250\021\272!)J2m\006`\"1f\325"
+	.ascii	"\003\022@\2638\001\n\343\210D\002G\234@\210\210\244\240\3100"
+	.ascii	"\314\001\254#\275\r\036}\b`hO\"$\212O,\347\317\217\331\2029\245"
+	.ascii	",Dj\300h\316\224\242\261\fo\364\217\0363\264K\201^\255\240\024"
+	.ascii	"\217\334\201\357\325z\241\022p\255\242~+\025\310\035~R\031D\264"
+	.ascii	"\332\275\3662\260\r5\346]\005.r2\2633\377g\210\360\207\024\031"
+	.ascii	"\337;\213C\2702*\006 \255vw\307\3151#\230\227\006\326ve\372\006"
+	.ascii	"'\035\313\r\257\340<!.\331\266b\335o\036\235\2058\220\222x\332"
+	.ascii	")\263\300\035\206\007\276\275\334]\n\251\200A\272\315\337\032"
+	.ascii	"q\237f\2156\254\004h\327\217\036\317\377p$\350$\357\260\201\221"
+	.ascii	"_\2377\326RA\003"
+	.text
+	.section	.gnu.lto_.pureconst.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\231\004\005\200\004\006\271\004\b\204\004\t\271\004\n\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375 \210\265\002"
+	.string	"2\204\r\026\240\265\205\003\345k\006\007j\354\251\276M\376=L\272\273;\267$S&\225\324@`\230\214\326<\242\236\265\n:\3459\321\356|\341\002;\300ny\320<\t\017\225\020\r"
+	.string	"@"
+	.string	"\210\201{\243P\032%\220\315\002\004\267\331-\021j\017e\335@\026\bx"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.152ab9a3eee98019,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initEEPROM.8.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375 \370\225\006"
+	.string	"\324\n\231"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\253\303\001\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\347\032\361\370\3207\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\362\371\340\265\024\370\3605\2007\342\364\006\342\366\370\006"
+	.string	"\203\003\202\340\373F\244\003\001\200\300\013/root/repo"
+	.string	"\"./src/main/config_eeprom.c"
+	.string	"\016"
+	.string	"\252\244\233\2618\301\0312\276Ge\260\314\030 \340\225\031,7\271\206\247\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_isEEPROMContentValid.9.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375`<\bE-"
+	.string	":M \021F`^N:s\006\245\226\221\317\346\243\n\343\013\374i\177\327\225\2566\270\303\307\214\332!\214\3369\375\265\277}\r\257\342\346D\215\360\300B6)\250/JN\220\217\242\013\017\252\236w\215\3423\335\335\2324\"M\356$\003\002\001\363"
+	.string	"\376"
+	.ascii	"\314\037\226\211\300\177\362\331884\323EF\216\2568\027\352\321"
+	.ascii	"3O\361\261<\313\267\334\3715\016\016\221\250\315\260J>Y4\341"
+	.ascii	"R\303\006\227\231\262\273\024T\264\034m\352iRH\310\346\315\222"
+	.ascii	"P\344\356\204z\024\310\016\2634o\374*\263~Ws=\346\210P\217\016"
+	.ascii	"\331\"\274\354fS?\303\321\273A\232\327G\t\261/e\007\216r\002"
+	.ascii	"\365(7\037 =\252>(=\312\n\030L\361\361\3150\254'Q[n\271\273\267"
+	.ascii	"\311\324K\330g\217\027\006\201?\325\227\242\275\266G>\325\205"
+	.ascii	"\036\230\250\225\341!\361\301\365\240\217\002\2015u\320\334<"
+	.ascii	"\243l\0358\344'\227%D\355M\030\003\004\353lO\222\313\n\322\263"
+	.ascii	"M\350\350|\355IR\262\210X\337\326\323\336\321\227\021<\037-e"
+	.ascii	"\017\351-n\031\324JZTG\357H\256\267\217VU\017\351\336\373\265"
+	.ascii	"[+\255\244\265>\n\367^\266L-\037\347\341\231\271\216\231k0\373"
+	.ascii	"\274\004\013\274\224M\305B"
+	.string	"dP8N]\227\016\364\354&R;\342ohP\360\321U\\W\331\203\253\260\256\262{\221V\210\354\036\016M\231U\257\301\336ad\304\256\272\301\330\310M\244o\025hp\252\354\035f&\3612&\324{\253\032\360\335N\006E\323isw\357\255\321?tgH\233\307\326ID\314\352\243\232\263\022\346\\.e\235[r\377\262\026\205\335\213<\223\357\345mM|'G\331i\265g\036\345\257\351\321\253\235\204\027\322\342\341\257=\304\025/<\273k\36107\251l\2031\277\311\306\356\200p\1771\263\345%\245\244#\243\"\242!\266,\024D\004Z\0060\264\f\364\263\374\363\263\354\023\264<\004Z\026\376,\007\205\226\201O;\253\251e_\320rz\2653\n\264\334\373Yn\325\262U-\277@\200\260.\256$k\355\246y\261\362\362\33484\314\223\247\375j\267\001HA\035\354/\367 \201}0w\355\215\0227`\2031:"
+	.string	"K\016\032\\\225\275\3636\204K\235_\2031\336\272\364\346\256\211\217WV\333F45i\023\333\327\327\243\034K\332<\356u\332V\317r\317\023\226\272#P\356\324\006\3030\267c\331\006$\3527Kg:\324Amu\266_\230c.\333\200E\375\265\023\323?o\247\016\261\255\230\217fi\257\215htG\262\333\035\315\350\2248bQ/#=\332\353"
+	.ascii	"B'\\\227\037\275\220l?\017\347\031\271\013t\226!\266\305\303"
+	.ascii	"AM\001\331\273\367^\337\363rV\037\326W\335\3434\261\357\\\367"
+	.ascii	"#f\250\237\366\027f\027o\316\221\365\275B\312\207C\327\304n)"
+	.ascii	"\263\005\f\366\314\241v`\235`:/\357R\351\323>A\210lN\203\255"
+	.ascii	"3L\322\003o\"\213\236\337\322?\317F\203z\257\362L\016\2522\312"
+	.ascii	"\300\232\016V\315\343>p]z\224"
+	.string	"\031\204\b{fw\274!D\006\020\350\223\261\270B\031\323\250\033\241\236\234\240Z\244\253qm#\024\215bqE\312k\003\247\005\f\326\005\017\020\f\255\306\nOP\306\"\215\031?^\021\300(\032\243\240\240\232X\270X\021\243\2702\305p\341\004\203i5\316`B\240\304\305((#\023\215b\321\310\024l\336\367\027\003u\210-\333\202K\030\330xq\2665\377\230\n\t\265\355\244\320\027\324j[q\317Gl\024\002\326\245\322\244^j\273e\031&)\006@\263U\332\245\024\337\t\037\247\034\253\3303\217U\230v@\r\240m\035\266U\253Q\230M*5P\267\233\222J\322L\t\370\240\024m\245+I\317\373Q\377$\031\365O\225\347\024\271\243g9\332G=A9\2264bd_!E\333\307Hm\237>\234}\026A\373\315Ky}\370rGL\323\266#h\006\005\317\256\250\2576lb\027\365\341\224c\311\036\352\021\266"
+	.string	"\2613\341\363\007\021\022\260\211\035l\242\016\200\247\250Q4\006\021C\246dFD\024\244I\322\001\200\002\031)\253z\021\020\261e\314\210\222Lc\335\276W?\247\f;\266\220\033\205~\262_.dl\335\304\266\021\024uC\252I\334O\016\177\361"
+	.string	"\311\324\267~\302\331S\353\330\00123\256\367%\275\260\007\323l\334\226@$\211\225\r4\371i\0375\272Qg\3716\350\031\300\373da\rk\r\326\021\251\376\227\036HeZ\016\276\373B\023.\331z\357\336\033VX\322\002\266\210u"
+	.string	"8\243\250\241\177\270\317\242Czn\f\251\220U2iR\001\230\235\264Mc'\233Z\343\1778V\007\226;\214\b\373\261\332\237\276\267\227\246\216\3119\370\323\001\214$>\271{\335D\017/\354\341\307$\003\262k\300Y\243_\376\017<"
+	.string	"\376\016h\rR\016\263O\301m\253\t\374%\266\310_\r\253?\001\332"
+	.ascii	"\300[\323\t\343#\t\"nx\2625\242\26012j\243NL\331|\230\336+\222"
+	.ascii	"\"nj\004\332\036;I\361X\243\227\313T\336n\007\005\006\274\306"
+	.ascii	"x\232\007m\bm\035\3120w\242\200\367\264\025\244\323\337\335\201"
+	.ascii	"7\302\265\252\273\030Na0h\210\033Q\234$R\210\035\237h\022\301"
+	.ascii	"\241\313I\206\243\027\256\ff\340\351\203\267\361c\261\"\326 "
+	.ascii	"\021\226-~\177"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.10.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"2\21504Po\322\001\200\362MZ\343\032\021\303\177^\\p\207D\207r\232\352\034\212[C\255{t\215-\267~\002\201\230\031W\025Fgw\266\241\344Kl\311&R\246\024\2660\232\0079\327\265\340\220i\330<\313m2\f\032g\301\007\2071\360\343\\\320A\274\007]\025\367\323\252(\265"
+	.string	"\244\022\366I\0361\177\344\210N>{\363;\032\320q\001\312\222\253\214M\026;~R5\354O\253\"\333\351T"
+	.string	"\023\024\204\224]\212R\313\236\264\222\017\333\036\273\362C.\3421\226\221\243\202\"\215&H+\273\321\t\234\200z\313\017Po\272q\354\211\371\037\371\004\342\241\222\205>\317\213\302\356:\263\220\305\255\267}`;\3016F\n"
+	.ascii	"\252\244\2231Mz\303\267a\343\032,pM\274\215\300Y\210<\334\025"
+	.ascii	"S;\311"
+	.text
+	.section	.gnu.lto_loadEEPROM.12.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375`\344\fEE"
+	.string	"\372u\354\031BP^N:\177z\344k\354L\2366C\334\373\265\300\266q\006\332v\232g\021\2257\375\210m!\201d!\236EQ\354;\240\006\207\250\001\r\201\327\002\316\24222\020s}\236\035j[[\263\204\020\271\223\f\216\001|\001\214\001Pws6\3746\205m\354\226;\250\304\365(\262\301\342\327\375\201b~\035\326\327d\251\255\221h\373L\241\006\370UTS\203\031y\272\034G\303\237k;Bkm\333\"\277\312i\340\352\321\252rV\352\330\004\211~@\365\275\\\216Gq\f\210\266\317\3279\004{F\370\232\364\202\342\227\341\237y\\\362\013NKil[41u(\212_\223en7\263\3657\255\"\017\262\342\033\257>$\212_\225*r\020\212\317\306'\203$\204z\333\307l=\212\343\355\027\231\021H\037\037\300\266\215>\370\312\023\212_9\372"
+	.string	"\354\327\342\221\330\257|19\230\221_/\363\0263\222\002\324\0267\037M\003r\250\036\2607\301\266\215>u\024\346\"\033qQ\215\236\221\324\346\223\220\216\214"
+	.string	"\024\021\r%\221Gc\221\310\256j\337&?\314\021l\241s\342'W\306\343IT\310p]$(O\265\037\251D/ V.%\233\242b \004\264\373\233\257k\004\345)\345"
+	.string	"\212\320\236i'R\221\216\320\341\271\224\214\211\n\001\317\026$\247cv\207\324\fO\252\016\300\324"
+	.string	"Z\310\224\\d\222#\022\243\232\301\fO\310\373\356$%;\242\376\316\235\264\220-\271E\366i\344D'\264\247\221\263o\356\001j\370\007\355)\345\353\220\253*\0013<!De]\252\002;N\370<\356W\254\314\353\366\311\334\201\225=\266A\264\247\332/QC\333\266|\303\312\236\347"
+	.ascii	"g\376\027f\326\302\214\\\006gDs\202n\024\037r\352\024k\324L7"
+	.ascii	"\275\256K\310|\271?\356\305@y{\203\200\3166j\2467\260C.q\300"
+	.ascii	"\023\305\266\355\262\300\367\023\003\005\237\n\016\366kR\237"
+	.ascii	"NJ\233\363N\371t_\013\321\346n\264Sh\f\n\310\330\227\273\022"
+	.ascii	"\211'm\343\376\037st\244\353\2328\204\272\241\334\207\005\203"
+	.ascii	"\264\266\375z\030\177\317\371\250PO\345+\257`\301>\214\005\373"
+	.ascii	"\365\3217\317\234\267\220O\346j\027\264\244\274\350``{\013\231"
+	.ascii	"\243\\\267\241q\006\353p?a.^F`\274|\340x\331\351xY\231\274\334"
+	.ascii	"\224\274l y\231\211\275\274\004\340r\201\344e\002J\227\236\007"
+	.ascii	"\bH^N\372\2343\322Q\321e\243\337\235\223\177;#\017w>>z6\022]"
+	.ascii	".\"/\023\207.\263C\227\327\344e\025y\271\217\227\257\361\362"
+	.ascii	"\023,\361\231)\201\356i\277h\013dZ\250\335[\355\256\\\372\317"
+	.ascii	"\371\357\376\267\037\356\217\236e>_\315\377j\034\017?\017\023"
+	.ascii	"\221536?\035j{z~5\352\n\301\236\021\334\234\217\337\267\305\346"
+	.ascii	"R\376\235-\254\343\361\353\334\016\3629\025\334j\343ZuJ\037\224"
+	.ascii	"z\277\207u=-5\332\226\261xj{\021\236\024\363\222r\362\260\b\325"
+	.ascii	"\366\330\322\240\370p\370rNG\312\034\276\223\203\036\002\266"
+	.ascii	"m[\204K\234\345\263o\n\030D\t\024\277Yr\247\245\354\212\266e"
+	.ascii	"\027r%\017\020\302t~\344\323\003\034\004t\016\035\350d\333p\373"
+	.ascii	"s\352\003H\206`\207}&V\331N\3157\314\035k\212Q\366\032\3507\330"
+	.ascii	"\366\2631/:\311\206rS\033h\216\271?:4u\323\337\003\311i\232~"
+	.ascii	"\003\313\324\006z\200 0#\\\177\314\341\372\350\300\3247\363\367"
+	.ascii	"5/\317\215v\006\371]\351\234[\322o\002\321\025\"\033\312+\023"
+	.ascii	"\221-ny]\227\220oI\230\226\243\364~E-\270^#>D\335\245\266\341"
+	.ascii	"\246W\240\225z\251\357\335\027\027\002]\240\337w\006h}n~p\207"
+	.ascii	"\316;\355?\202\354416\364\210=\337\345\272N\fC\004\315\330\332"
+	.ascii	"\326\251\022\007\264R\213\235`\t4\323\355\357R\006\361\351\241"
+	.ascii	"\210\020K\366+\201\016\360\327\226\234\033\302\327\367\"\237"
+	.ascii	"\034\262\301\300v\256L\252\324\227\376^"
+	.string	"-\"\227\232\325\344R\017\370\333\216\f\017A\304\206\362\275P\024SO\260m\235\204/\034\301\247B\"\212\350\324[\373J<\367):\273rSi+\275`\324RZ\333:\007\235\320\b&\021u\243\244Wq\346\274\363\243\234\241\264\265s\243 \234\350 \240d\177\357Jg\336\225S\244\376\234+\337H}\323\034;\331o\265\357\013\013\327\235\362\351\374cs\206\021\332\016\177\260\re)/\352\001\375\\\364\306\372\201\216l1)(\352\003\215ly\207\315\327b\217-\306|\354!g\3167W\305\240\025J\217}\270\337\326\340\\\373\355+\bI\257\305\036\356R\0013\226V4\246\250\254\\XeeM\305\240\"\272Q\325b\006\210\252\030V.\226\314\253$U\025\263\263bPu\013\346\222\252\212\311^\235aH\270\252\261d\276\220bV\321\250\2221\305\234\272J@\2039E#\313\330bF\225TV\f*\"SY\230\252"
+	.string	"EU\001\203\004\245\027U\314f*\t2\226\314\253\252*\251\027V.f,\251\236fXM\311x\242bf=I8\300\313\253*\346\023\215\345\222\371\204\214:\337O\336d{m\020\213\263\271\370an\002P\233\324P\276\200\344\350\250\211\204\227W\030[\214\357\022\026\305\266\375\332s\225\250P\233QX\260\306\346\200\327u\t=\004A\213\262ivwHG\375\250\362H\254\261\217\372Fxsr\244G\r\345\tz"
+	.string	"\bh\343\224\365\330\311d#\233\203^\327%\\\365\320\356^a\f\016\227\221\200\376\335\225\201O\266\200\376\177\254\351\325]"
+	.ascii	"\017\256Z\263\212\322\253y0VT0\260\035\262\013\254+jp\273\211"
+	.ascii	"]l\24466s3Ks\313}\030\037\271\264F\232\007\363-B\3650\346f\227"
+	.ascii	"K\244\371\345k\261WAaD\330&\026M\247S\302W\261k\263M\024\364"
+	.ascii	"e\246\366\332\007\003q\203\234P\373"
+	.string	"\302_\333\355\356$\267>\270Cn\202\271eM1\315\265\020\305\266mo\023\235\231Uis\032\237\3749\033\fl\342#\306F\324P\276\307\033\276x\303\263\232T\352\337\271\207><\2705F1\303#\350\243\271\351!RS&E\320\217#\335\373\003\201\017\250a \346\224c\n\321\210\210$I\222\341\361\004\004!)\251\265\003\021\200\265SEC\222T\332\r\226\276\334Z(F\222T\247GQ\241\355\030o\3671W\236\267\317\033' ?g\350\231\372\243T\351\221X\2623\367\271\307E\360\245\235\231\217%L\220\315\256\336\355\235|\017\251\034\372\333\255\353\2718\307\370(\371L\273\"\204\256%m:c\322\371\322~\330[\222j\215B{\207\323?vG%\244\035\323Z\301\377B\335\215\007\032<M\227\311\214\036\362\336\201(rz\336'\300\n\017\007'@\b3\320g\225G\016;\204a(\233:$#@\220\020\360}"
+	.ascii	"\022#\3627hA\202,\340\214g\234ss\273|\223\362a\300D'|\200\f\224"
+	.ascii	"n\337\006\241\017\333\333b\256\271\001\003N\307\365\\Z\351\370"
+	.ascii	"%\375\333\016e5\335T\271\006\343>u\350g>\240\211\022\216\270"
+	.ascii	"\267\027S\024`\2334F\266\b\361*\3167\035\n\202\260\205p\226\n"
+	.ascii	"\337\207\322ZX|X$\0243B\2715\262 \027\035l}\271\261=\376\214"
+	.ascii	"z\245\004Z\231\310\274{\336x\262\324\224Q\265\177\035r\3761\247"
+	.ascii	"Q\354(ZT\374\323z\263S\031\351\023\0343"
+	.ascii	"\n\332\272X\253JKW1J\b5\257\t(\313\211h]\031\210h\035\2119-~"
+	.ascii	"\240,\245\023\203\354Q,\2461t\256\251\202T\354\247\2010\311\347"
+	.ascii	"\356\241\311\314\037\357$\230\313\271\335\371:s\244[,\350\233"
+	.ascii	"8\210\0018p`2\366a\037\215\034\307]_6.\007\t\367\177\237\376"
+	.ascii	"\367T\215\002`!t\032_\247\035}\306\2553v\204\025\224\017\177"
+	.ascii	"tc\322\364\370\370\206\233\027[\005\337\374\f\271\250\020'@K"
+	.ascii	"\351\317_?\204>u\r\025--\260\224\330\020|R\357\303\025qWi2\276"
+	.ascii	"}\2773\034\020\312\375H\340\242\026\335^\030\001|47\304v4\360"
+	.ascii	"\224\3243f\205\307h\345q,O\024jh\240'\367\353\255;\210\310\310"
+	.ascii	"*\343\271\313P\240\332\357IC\253\314dD\242\326\333B\230],}\315"
+	.ascii	"\334\037"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.13.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375`\320\017}N"
+	.ascii	"\032\201\244\034S0\022JJ\007O;\030\252\266\244\307\2055\026\321"
+	.ascii	"\251\372\2317\350\b\025\363lU\275\271\302\242\320\214\300\255"
+	.ascii	"v\243\212S\346\337\017\231:\303\250\316a\367\313\203\300p0w\310"
+	.ascii	"J\f_\237\240HE\220\353\236\335\201\263\271c\306v'pNe\255\344"
+	.ascii	"\223X\271\223\f\270\001\226\001\274\001V\016\305\020K\253Q\271"
+	.ascii	"\202\302\225a\024:+C'^e\351\215wl\342\b\025\"\250,=\371\342\304"
+	.ascii	"\222\2243\301\304D\223"
+	.string	",\321e\312\022S\230\320\236R\230\230\177\217\302\374c\342\333\370n\275\031\242\034\271\367\376\216B\331\335\037\313\2335\303\213-\206\210P\317\036\n\361iM7\313\233\365$\346\224P\n8\372\013B\210\217\004\237\355O\216(\261\203\307\b\326\245B\222\265'!u'\035\250\267\313(\031\366\244z\364'\305A\210o\306W\373\025A\373\021ROk\352Y\275}\035\227*\377\214\310\374;\2122K\361\303>\304\223\234\354K\336\204\177\276\267\"n\204\324\231|\360\213\274\232\340\r\206\346\b\352Q{y\340\210\270\022\251\227A\251\267k\202\344\r\315{\257\240\324\2433x\276\271\261(\365\242\251I%^\315{\227D\023\220\204\30035s\251\222\316\256{\2578P\217\376z\b]\354BH}\271\203\307\270\274W\030\224\225\241\035\251Gg^\223\036\265\247I\217\376d\020:\030\t<S\313k\305@Y\023\214\200\243l\200z\224\017"
+	.ascii	"\222\342\365K.+^\322\205$Y\227{\227>m\003s\247\254\356\226g\265"
+	.ascii	"\327\367T^\212\356|mW>\317\201&\027`\214\311\361\255\b\254\251"
+	.ascii	"\367v\274\022\254t8\363\n\310n\206\227f\332\325\216V\005\240"
+	.ascii	"\206\254\037\347\355f\356\2751X\311\335O\263\004\233\032\361"
+	.ascii	"qT\211\305\302w\252\217\373v5N\252\2663\257Z\330\301@>\267\376"
+	.ascii	"\344\266\n\213\312\366\325\016\343\213\r\3149$\353\307-\317\201"
+	.ascii	"{/[%V\326\371wf\326\302\314k\3141t\001j\337\3750\344\312\305"
+	.ascii	"\350\217]F\217\265U\367\341\342\265\255\325\006{e\214\226\021"
+	.ascii	"\204K\327\325=*\375\330\027\bb\264O\266fq\004"
+	.string	"X\336W\034\322\233}\311\232C\002UvX\215X3-\353\017*\362h/\230\327\036\276d\375\201\203zWbA\250[dxN\312\274z}\211\220\203l\270\266\030\221\b\300\332\356^\303V!~A\220=\305\374\272\243\004\252\320u\377m\273\200$\235\321\3261\377\313\321\327\236\0178\217N\306u\257\361J\276\334\273\b\371E\2162\321\221\275\362(=\372fA\206\004\342h\3538\006-\307\336\354M$P\225\314E\023\330+\231\207\252\2478\006\214\031\214Cs\302]\373d^\036mo1\277\007+\254\006n\032\230\203\226\221\202\226s\004-\037\005-\343\300\261\\A\3202\0057\214l\024\3258\334\231h\350\3062\215\203\235\201~b\004-\303x\226\363\316\323\316:9.>vn\001\264\314\"h\031'h\371&hy\005\320\262\r\320r\r\320r\020h\231\246\306\262\212\025\226\201@\3133@\3132@\31316\226S"
+	.ascii	"-\303\320X\376\001-\373l,\367l,\2535\226y@\313i\3202Jcy\247\302"
+	.ascii	"r\003-\333\031\313\267\340=\256\272h\021z\273\327\252\356\313"
+	.ascii	"\225\202\246\355p\270?\313\357\344O\373\301\376\345\217\344\037"
+	.ascii	"\373\313~&\3671\377\367D\210\257\205\037\307\277_\033\\RV\322"
+	.ascii	"J\263\314L\210\337\306o\236e\021\252\267\213g\246\304\255\371"
+	.ascii	"\245\006\315\003\241\234}\325\240\2511\32442l*\232\250\221ZE"
+	.ascii	"\337\tQ\037\016\330)\232\250wdH\037f\032(\3231=\323G\362\260"
+	.ascii	"\3232\375$]L\337\254\005\221\242{\236\020[\033\322`\313\0020"
+	.ascii	"C\335\242a\332\316%\351\202gj[\030\330\022<;b\327+\202\036w\032"
+	.ascii	".J\270_\357\232\255\022\356\031\244;\375\353\224\f\031\303Q\214"
+	.ascii	"y\343\376\025\316\302\272\357\275F\324\006\017\257{\355\263Q"
+	.ascii	"\324\276\034z\355CD\306\207V\373m\n\360Z\202%\262&\325N\340\t"
+	.ascii	"1\244\346\365{(\272`\3532\270\322.\352\234N\333\272%\351\214"
+	.ascii	"gF\322\266\263\255'\320h\223\211\201\031s\006\303\271\320\300"
+	.ascii	"ve\327[\374\337\3077R\032]L\262\004\225\365\242nq.\235\315\034"
+	.ascii	"M\243s\310\222tF(\216>\261\2747\345\213\226\327\225\363\300\234"
+	.string	"\001a\336\252\263U\220\302\331\204\034\244\300\025*R\234\327\331\244\240+\200\301\321\024\364\315\032\222\356X\345\250\334\333{a]\264\274\250\034Y\235m\305\232\322\353\222k:\233,\034G\037\365\r\227\344\217#\257=\254\013\253\026\216\376\030\021&\216\2721\217F\241ud\n\332\314+\013g\213\342\240\247\257,J\270\364/R\244F\373G\276\344\2201\300\230=\231H}%\376'\367q\311-\235\315\235\034\215\3248k\311\037G^\201X\037;\324{\251\202\330j\r\255.\360\2134\245Gs\364\311\236\020\213r4n\310u{o\212\027-\2578\235>\224\363<\371Q0s2-\027\032\330\260to\331\036\253\220\027\\\367\"\257d\213e\263V\030v\253\f\253\220t\025\222\366\365\001l#G\321\021\n\0055,*)%\361D\030*9\025\r=`\332\200X|\202a\016z\236\242\210\305%\r\212C\035\303\246\244b\322\323"
+	.string	"\303\021\230\216\226\206E\236R\221(\034\026\323\245a\261\213\303\246\244aQ\007\224Z\034*%\r9H\205Ea\027\207:\210\304\rRa\221\310)\211I\311)\202%\246!\245\241\216\342\020\004'\246 \013\203\222\020"
+	.string	"\022\"0\243\007\007\nj(\024FA\361X\330\323D,>\r\207\032,1m\340D\024\37281%5\371\b\213P>=\0010\361iX\364\321A$\026}~K\343wjN\337"
+	.string	"j\241 \306>\362\216e\bH\240\312>`\3627\221\030\001\352\203\235\307x\026\r\324\237K\246\035m\035\027\036O{%\213\346]9\273T\274"
+	.ascii	"\201\345\341\344\361"
+	.string	"\244\0022\004\2179\2524-\234V\302\3354N['\222-\300\350%W\260i\030\315\266\210\377\364\212\276i\202\244Sk\332\246\217\374\362\3235\315s\263i=~d(\271O\360\247ot\260\357f\317\346l\022\036ug\317\027SO\022\325\344\276\2638&W\217g\324W\373\013/\266\307\204[\027\235\256\342\035\317E\277\311U,r:\330\030\235\323U\274\\\205\250B\034u\232\b\n\225\365\002\0343\223c\346\350X\373\374\f@\370XA\335\245-\272\310S\207\235\215v\321U\314F\375\264/\271N\033\365\215\242`v\260\273wH\003w\002l\"\261u\354\242?fy\275\3052Z@\177\375\346{U\236Q|\\\365\270\367\300\346\314\320\032\315;_N\267\350\252\2760\335i\"+o\266\260\366\311;\355\200\321>\277K\177\375,\3471\006\201^\250Q<\307\224BhfDD4I\222\345a\005\304 '\0354\017\021"
+	.ascii	"=\251\330\314\004\221$%%\205\f\233\001\316\302'5{AU\313\0342"
+	.ascii	"\374\2468\251-\200}\217\032\354\217Z\034\213G&\300\241 pN\006"
+	.ascii	"S\0053\300\2334\347\223[\200\360wS\024\3424\306\372\217R\225"
+	.ascii	"\277\321\320\\(\213(d\013\3677\263\263\355\3636\025\312\006W"
+	.ascii	"\030\274:\315pX\314g\230\005\362V|\023\266;Ogu\215r\t\366\346"
+	.ascii	"\306\314\363%\241\235t\362c>\024I~N\342\250\025"
+	.ascii	"C\251Db\264\344Ih\240qm#\324\326K\334\223\022\346Z\353dj-R\032"
+	.ascii	"\215\264\340r\353\205\006Dm*"
+	.string	"\235\354O(s^\352~\032\210\345p\301a\303un1\321n\305t\030\307\202a=\325l\337\217'\"g\261\315\375\242\007L\264\343#\004\007\225\005\026\021\026\305\2031\032\233\370\356\3116x\344 2\2238\332\267\024\360x\267\360\r\240\271\177Q\2028\344\305\362\241\330n\315SM\253\251Ld\321J\246\bhb\260\200M\261\236\271\031;\311\232\2212%@l\336HYdj@\233\327\272\215\375\005\016\\\226\374^\211\345\220,L\275`\277\327R\233\216\247\362o\214n0\311o\024\006\220AP\265\202K3\251\273\220t\251\377\344;C\202\260\223\263\250\232\244.y\361n\332\201;\206\314\275\316xH\371\365\t\302\2767\235\237\221\367<\277\031-n\223\302?ti-Mi\362\232\rz\311\225/\252\224k\256\224\276T\307\351\t\335\2123f\200S\274\2122I\032\242\217\3742?\225\300DF\240a\033\332\023d/\202"
+	.string	";B\314\237cah\236a\200\204\031EhF\327+1Y#\305\304\f\347\n\204\036\302\271\363,w\256\346\270\223Y\227"
+	.ascii	"\262t\373\237:\240m\270-\352$\027vB\346\025\375zJ\314WzAw`\020"
+	.ascii	":\325F\330d\270;[\334\027\302U\321#n\024\336\007\327E.%\252`"
+	.ascii	"\331\261\212\301\321\336\354\227\210\366\317e\333\375W\376I\244"
+	.ascii	"\335w\261}\337\233\375BB\356\205\320\241\2741\3167`\324W\336"
+	.ascii	"\307\307\213T+C\351L\261d\023;+EXg\005\203\234\026-\221:\263"
+	.ascii	";P\207\025Y\203z\324|s\017\252\367\004\324\017\230\357\264\305"
+	.ascii	"\260\270C9s\313\266\022\343`L\222\256a|\243\2446C\327\267\323"
+	.ascii	"s\226!|\024\006'\n\036\211\023\320\326\007(Z\220\362\332sz\005"
+	.ascii	"!\242\022\004\022/[P\372\212\221?"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.14.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375`\272\002\265\025"
+	.string	"\326g\212I\300\322Q:(\212:91\202;\232\313&`\240\277l\325\320g\035\\B\346;\345@\300;f\233\266[\233\227\375\321<\003;WDM\325\347\031\364o\bJ,"
+	.string	"y"
+	.string	"\252d#,\f4\n\203"
+	.string	"\313\355\216O\b\331R\246\024w"
+	.string	"o"
+	.string	"t"
+	.string	"\266\363`\\\267q\326\220\374p\360\240\346\034E\016\232\201\352\240mv\216\217'\346\177\"r-\240\346\234\2575\341\275\034o\251\266\253\304\020\224\2536\177\265\273]e\340\347F\347\242L\300\263\224\023r\203\304\323\207lt4\224\256\234t\365f\024\224\2559g\200\335\007\271\200f\207S\251\"\347{\243\253\f\244\243\246\027\273\234\253\2102\347\264\352v77\310m\377\330\306`\353P:\016\023\236\367\265\211J\021\243R~\357\025pfD\355\230*e\2177\335 \373\237\013d\267X\367\335\342ywx5x\265\274z\257\326\253?"
+	.string	"\301\023\317\216\320\3166\215\263f\312\307\264\001&\241\270\357\347]\355\257\\\234\370,|#\263V\277\027}\264\335g%\227\3148w\020~P\323\202\352\240\353!\341Ay\002\341\301\277g\326\212wBb\022\277\236\034\222\212\\\\\032\313\375\276\367\tB#rH\372\243\207Kst\271\022\234d\264\207w\345\217\234N\270\273\240R.D\214NYo\245P\\]Y#G\204\323)\260'\\\225\262\270\367]\312\326\336w\227\202\213\333\332\317\360\340t\352\275\244\"\246\271\347\335(Rm\017/z\335\367\201\017no\006\220\024\203i\347\234\267\265\310\357{\004\037\243\313\025?!8\001\265\226\225X\255\226\"\032\326 \245\304\004V\342`\244"
+	.string	"\215\026\203\301\\h\242a#+\262YK,\226\201\203\312\006\026\031\354\305\242\222\262\362\202\315h\257\221\003\226\265\304f\257\232L6{\261\306\371\317\0052J\314\342|\025\210\202\227\205v\007\232^g\227\314\336\254I<\230\234x\226r\304\r2\270/\341\362\242\327\201\222\306=\3169C)\303e\261V\303\321\005\0200\300\r\262"
+	.string	"\242m\355\215N!= p\002\031\302\233\007\331zP\311<\317^\314d\r\033~\005\353\356 \351\257\001\254/\367&\3657 \201\2241\201\016\n\206\200\026\2047\245R:\202\203\261\226v)\253\247`\037\300\233k\265\210\245)(,\3600\017\t9n\366\225\263\245&V\202\255\304\260\214T\026\202\027N\237\264#\267\354\234\341"
+	.ascii	"\004M\\R\304\331=\240\211\032[\323f&\332\321\345\213\246\200"
+	.ascii	"\032#\021\332\321\361f\244\335\300\256\274\375\335\254\203\210"
+	.ascii	"\274\256\367\004"
+	.text
+	.section	.gnu.lto_.symbol_nodes.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375`\346\001\235\013"
+	.string	"v\222F=\020%)\035"
+	.string	"x,g;l3\364m\240\330"
+	.string	"\245\377Q\200Y\273P\301\204\217MH\"C\257\332+\266v\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\330\335\335\2357\372\267\210\365\355\377\266\264c\247\374#\211L\0015"
+	.string	"6"
+	.string	"4"
+	.string	"%\005\366\270\375Ul\330H\264/,C' \223\302v\t\350\356~\261"
+	.string	"\227\240r\025\230L\260VJ\364\277\3530\354\226\237\177\032\022\275(\211\231\261\370\343\376s\266\223\326\363}=\371\035\215\337\267\023M\337\215\323\327\202\r*xE\301\004\023|\222\340\203\bF\200`\324\003\263\034\270\245\335\375\203\001\032\330\245\312\300\222;\r@m\201\003S1PrVd\267#Q\017\364#\013Au\253)\342\300X\372\352L\344)\277\037*\337\327C\354\230\034S~c\243nw\207\337Wc\314"
+	.string	"\247\374\276FU\241\2277=\217L\307d\345\255\f\3652\335\335y\2536\220{\033\273\351w\023d\223\"ml*\3503\002\243\"-8\266\246\246j5\"\262[\325Mwfg\206#\273\365\002) \320\0029\353\034\206$F\213\264'\266]L+\307\303u!\345\267Tp\252`>v\345&\033\263\243:\257\270G\321rqa\\\217\340"
+	.ascii	"\016\300\021\034\301\0218\004\207k \006-\275V0\310^ZHXd\2673"
+	.ascii	"x\277\277\323\034b\033\331\237\027.\330\303\222\225\237"
+	.text
+	.section	.gnu.lto_.refs.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375 [=\002"
+	.string	"r\305\017\032\300%\215\001\300o\300,\351\377\377\277\366\377\225\205\177U\277\366\336{\313\235d\n\252r\353b\326\260-~\235'\225i\222L\221\227\260\035^\341\r\336\265\242EJ\001\267\006\314\246\367\330\036\365\b\001"
+	.ascii	"\007.\t"
+	.text
+	.section	.gnu.lto_.decls.152ab9a3eee98019,"e",@progbits
+	.string	"(\265/\375`E \245\225"
+	.string	":\360T5P0\022R\352\275\314\352w\211 \"\002*\221\333#J\223\374<\274\356\007\022:\211J\326zho\005B\006|u\336\275M|\356l7\350\n\024\032\177A\032\b\346\356\0203\227\312\252\252\250bh]\251+\214"
+	.string	"$Q\315\220\211\b\334\266 v\313\224R\367\0028\003T\003^\204\177q\253\3379\\{\234\313\371\235\257y\233\253Aq\200\005\347X\335\216v\347X\234\213\253EG\344\246\230\035\035\212\231\034B`8d\330\264\306r"
+	.ascii	"\220s\204\2549\272\025\3357\\|\316\267\270Z\364\3154d\310\362"
+	.ascii	"\274\263\313\371\355\342^\334\352\\\272\346\315\371\213\200\031"
+	.ascii	"\274+vY\277-Zd\230\f1\t=\353Dxu\312\f\035utn\365\272\236\223"
+	.ascii	"\311\007\320\b\005\3712\365\254gi,2\226C3\236m.m\326\335@\026"
+	.ascii	"\210&Wism\373[\373\331M\374NLyk\255\3209]\315\332\366&\255\263"
+	.ascii	"y\025\267>\340V\332\251xV\373\230o~?\352\013\330\326W\333\376"
+	.ascii	"\300\017\357\355\371\003\277\366\255\366\375j\210\253\257z\266"
+	.ascii	"\345"
+	.string	"z\035{\2664\" #\355\b/1\345\201\266\351$\f\353\354+\306\255\013\r\354Y\177\262\204C\310\221g{\005\023\037\023\342\234o`\241V0A\005\376\304\301|\314\325\242\031\0041G\227\363\333\016\305\243\270\325\237\264\223\271\023/k\177\263\363\346\211'\361\257\003\200rf.\031\260\366d\250\312.\347\214\002E\r\nl\306\214\212\265l\0137\361\203\361\022?`0\315\213\022\365\331\366e\333=\255+\3610\267\"\340b/\315\214\336\021=\274g\333me^t/\351\032\264r\005}\242mG\340\347{\216\300\257\007h\273}K\b\177\335\213\206\234\2339\347\001d\304\322\270x<\353\\\336\325\356\345\325\236\240\202\306K\255\214\225sv/\n\24493\335\213&/g&\215\273\002\356\n\260AL\251\224\374\330\006\240u\255\233\366\255\022?h\364\3154\254\216.\317 \317\262\337\332\270\211\237\317K\374F\270\t$\216\205"
+	.ascii	"v\022I\363W\316/\t\232\027\251H\307\263\375\272\211_\353%~\335"
+	.ascii	">\005g\302\225\016v\177\230\ron\335\016@\343\265\311\274\375"
+	.ascii	"X\251\322\335eK\266\030k\256\326\3350\\\317\244t\273\006\335"
+	.ascii	"\016\305\237\270\231\213\356wz*\353\366\037N\272=\246\333\311"
+	.ascii	"\272]\246\333\205\301<\f\354Xh\342b\335n\355v\260\257\267\333"
+	.ascii	"\263\374*\202\356\367j\266\373\267\214\314\364P\244\333\227\210"
+	.ascii	"\f\351\356'\335\r\245\333o\350\030\272\373\201\356\006\240Y\350"
+	.ascii	"\356\003\220B\272\235Z\323\335\016t\377\221\366\356'\322\355"
+	.ascii	"T\335\036\325\355\323ng\352\366\240ngv\273\017\335\216C\267\033"
+	.ascii	"\273\235\247\333\335n\307\351vb\267\317\320\3552t;\f\335\376"
+	.ascii	"B\267\267\320\355)t\373\t\335\216A\267\267\350v\022\272}\204"
+	.ascii	"n\027\241\273\365\272\335Ew{u\373\007\335\235\326\355\035t\267"
+	.ascii	"Xw[\351\366\005\272}\203n\317\240\333-\350v\026\335\036@w_\273"
+	.ascii	"\235\246\273\367\272\373\254\273\245tw\224\356\306\352\356\024"
+	.ascii	"\335=\245\273a\366\366\366\366\272\261\215n\026\203n\002t\002"
+	.ascii	"\335\277\314\204\346\234i\370\336\f\005\222\371\271\317\335\246"
+	.ascii	"{\306\261/\220qw\327\f\337\274\344\302\332\322\n\031c2\235\310"
+	.ascii	">5\250\263\372\264\344\340\351\250\371\224\344\254>\345esjI\002"
+	.ascii	"\232\237\226\316j\316$r\263\271\004A"
+	.string	"\232I8\253\371(\307X;\362\374>-sS\232I\344ff\236p6\237\216\234U\346\021\tg\365\351(W\237\362\210\334dBe43\224D\256>\325\345\252\364h\204\263*=rV\237\242\376t\25619\252bM\235^\345lf\243\242&&t\204\232\363\225\346\267\234\375+(C\027\310\271I\n}c&9\023 5#\240%L\251\2779g\002\212\200\246\322\334Ts\016\221\346<\004\bF.\242`\371\252e\037\256\266\324\321\224\211\202r.\240(\347\245g\265\234\3632\347\f\003mzs^\032\341\244\026\025\345\034\255)\312M\313&A9\377\027\034\223#gu*\275i\322U\245f\241w\351\324\374\366\004m\253\313$\231HKK=\252A\304\373\273\376@K{\363IM\367\274<\373\2761Ln\200\331x\366\273\202J\334ldqy.-\351;\203\231Hic\317\376\226O\035\375pz\261\200M\360\210"
+	.ascii	"\361\254\357\372\242?\211\365\223\370\030\273\324\312\317\024"
+	.ascii	"\224\fE\261\3139\n\004\330\231$\016\250\355\025B\b\346\345\f"
+	.ascii	"\352\331,\031$JH\3232$\217\205\345\207S\336\263\177\005\263\365"
+	.ascii	"\304\007\024W\020G\\F\025\231\334\263o\365\365\233\303\262%\252"
+	.ascii	"\210\221\252\006\250Y{\317~\225\253\375\324\225\323\337x(asD"
+	.ascii	"nN}\321\255h\002\243~\3203\265\231\020\230\363\223\022*V\225"
+	.ascii	"\257\265\231\260\371.\200\225tf\225s\246\276\220\037\362D>\310"
+	.ascii	"\027q\353W=\325W=\322+\t\227o~N\020\206\002\205\214\035t\213"
+	.ascii	"\221\220m\254\243\375\250\007\342\326\236\362R\315\316\360B\004"
+	.ascii	"\355\331\306Km\377\340=\345\247\343{\270Z\024\004\262\254\207"
+	.ascii	"z\034?\0256\337|\304\202\020Ig>\376\207[\037\252\3317\347*0\351"
+	.ascii	"kF\335\217\355\357\321\325\231\271\262W\352\331\337q\323\317"
+	.ascii	"#\203(\035A<\213\265\264/\375\034n\265\371\247v\255\017j`\363"
+	.ascii	"\315U`\233\026\247\257g\373\341\332v\233\037\215\333\374\372"
+	.ascii	"\337\332~*m\253]\333\376\263\366\225\376\243\277\324\257\364"
+	.ascii	"I2\315Wb]\001\241\273\002>3)\346\326\217\355/k\373\303\200\260"
+	.ascii	"a\004\t\226\264gk\270\365m\364\323xs\3166\376\310\333p\225\332"
+	.ascii	"\nm)\325\240\230i*\352\221\205e_\350\017\261GUN\3277\206\217"
+	.ascii	"\341\227\n\3435\035Z\213r\200\365\205.\350\207^h\217\372\313"
+	.ascii	"\241g~\023\277T\021\246Dt?$<zO\350\rE\261z\242\177~\321\317x"
+	.ascii	"#\267\376P\277\363e\374\022E\315o\352-+K\206\375Y\265'>H\333"
+	.ascii	"\337\3541\340\024\261\264\233~\240`\017'KqT\255\004\237\367\202"
+	.ascii	"U\266\210\b=\253\367\326\300\020I\315\310{\266\377\251\355\025"
+	.ascii	"n~\245\310\225\0335\277b\305\245\371\020rv\216\347y\001EH_\254"
+	.ascii	"\274\355\227\024\003/\314H\336\227U\307\336\"_\025\342-\221\242"
+	.ascii	"B\0043I\363h\030\031\202\205\320\200mE\363p\220\2577\306-\307"
+	.ascii	"\215\244\271\252\377\002R\237\326'\317\002\243RR\230\252F\212"
+	.ascii	"\343\244zd\005\020Q\277\246\032S\305@\341zj\275\027v;\002r\305"
+	.ascii	"\325\002\253;v\340\250\032)v\273>\357\254\350\236W#?\032G\305"
+	.ascii	"uy\351\361,\366\201s\b\363\274\246^\317b(a\320\330\027\364Y\334"
+	.ascii	"\243\2634\333\231\216\245g1\2176\203\231r\235f\265@\037N\355"
+	.ascii	"\204\247\256\225\237\356\025\367\274\263\233\371b\265\253>5\236"
+	.ascii	"\346\370@\n\362,\276\201s\364\225\013\310\216\034X*\303\007\021"
+	.ascii	"tz\357w\211b\345\004\343p8!\027\2578\034E\332\340\323\331\330"
+	.ascii	"\b;1\023\326\322F\245\313:\t\204p\336\345\331eg\324&heV\227\317"
+	.ascii	"b\246\306KNPCW\317b\245\306Q\037Z\272\234I8\332\r\004V\311-\321"
+	.ascii	"Cj1R\004Nw9\362\200\bB\255Iy\233\375p\rL#\b\346\025D\351Y|\204"
+	.ascii	"i\340's\256\016\323\330\242\271\262\301\003\b\206^\247l@\317"
+	.ascii	"\342\247"
+	.ascii	"\220L\bl\312\263\305D\215\213\272\2011YfAlB-\036j<\243\033\350"
+	.ascii	"<\214\324\326\236m\030f\333\215e\324\001A\372\361\245\355_]\013"
+	.ascii	"\024\302M\334\304AbT\230\032HP<\034\243q\320\\\260\210(CN\264"
+	.ascii	"\266\225\323\323\303\314\032)\226\213\222tf\347MtS'\274l\314"
+	.ascii	"d\203\252L\351=\213\363\303a\257\262*\221g\177\357\247Z\246%"
+	.ascii	"\241gW\013\314bg\367y5\322e\235\215\231TK\021;\237\335\036\033"
+	.ascii	"\217\307\353\317\303s\222\361\354\337y\233\257\212\343\354\356"
+	.ascii	"\331/\242\263(\233VG\242m\353EG\367]\244P\177[2\020-.\375]f\336"
+	.ascii	"\224\320\341x\366\267<\034\215\321\225\250\271g\277\356\265\310"
+	.ascii	"\264yY\002\247\205\b<\204d\313\330\2632\317g\224t\372\273>\363"
+	.ascii	"\356\236\355\037\263m\253\346\346^\256q3\3378\243\002\215\220"
+	.ascii	"\b\r!\327\266H/\334\332\355\345j\244\030\016-jC\343\266\244\262"
+	.ascii	"\345\343\372\345\332\254\355\222\202\322|\270w\2226\243\350\341"
+	.ascii	"\376\212\332\321r*kF\013o\232\237}{\252\266\214j\252\206Y\033"
+	.ascii	"\244\262b\345\317\300\230~R<\344\210\222\2641qll/\326\372\016"
+	.ascii	"8\226J\022\034U\212\2643N5\265\2472\302\217\013\b\320\255\255"
+	.ascii	"\007\332\263T\274-\030\225$(\307\263\355{j}]^\364_\255\177\365"
+	.ascii	"\266\1773T\005+\364\205\240}G\355\214\r4\264\027\233~Em\\\234"
+	.ascii	"\001]\363"
+	.string	"\332\231-R\244\374\231oE5\331\374\bE%=\353\326?\363\255\r\231RR\327\372\200^\364C\2012\342\315\323&j\020\356\313\r\252\264\326\367|\321OF\366f\034D\265\362R\310\346\324\004\001\360\216\306\217\035\276\207\233\3305\345g\313\332\211\214\024\232\233>/4\252j\260L+\266\241\260\326\007\367\242\237\t\2230\2303\035G\250\262\332 \224\027\037\366K\372\255\335o}\2616\347\f#\304\024\205\332t7\227~1%`\225\220)\321\263\315B\265\375\001\306c1\211t]\330\361\001\372\374\214E\235\340\t;>\330\035\272(\261B\222\204\035\237\240\362xt\3210R\364\270\312\344\016I\025Ed\316\00119\304c\t;>?\230\206\221\002\251L\252ps~xp\214E\025\310\344\217\212\001xx~\214\306\243\021F9\374\345pD\302P\036\2150:D\227\207u\221?>\254O\017\216\233$\342\030\221\312dL"
+	.ascii	"\r#E\022\206\222\330\243\302x\354"
+	.string	"\351)\300U\022s|~\206Je\021\007g\310\342\006\007\211\003\300\017\217\t\030\311\242\261\2503\024\240D\016\361\310\023T\272;%\\\036\212+\214\310)\362\020]P\032]\245\361\370A\262\030\200\262h,\006K\344\030]\344p\307g8$\221cteL@A\205\024B\b\341\310Br\307XT*\335\025\\e\021\231\203\211\306)\"]\243\273\3236\005,\"`\321B\007\230nq\201\004\027H\360\353\026\027\334\334\\\300\342\246m\0267\330\035\2729G\023\\\344\017O\221\2503\243D\022\207C\2412\007y\304qUP\016\221n\016\321\035A\230\034\222P\016\221J\037`\303H\201t{\210.R\231\254\301\225\303\tV\344\340HWG\347\247\206\237\222\370H\244\213y\216G\017\206\276#\217\361\247E\036\225Dc\261\007\351*\2038\300$w\210<:\276\035\237W6\214\024>?G\344\316\020\351*\335\036\"\222\350\303"
+	.ascii	"\216\361\307\205\322M\306\030u^\351&]\244/9\334\001\251L\026"
+	.ascii	"w\\\025v|d\224C\343\216\217\317\270\343\203\225C\0267\255\313"
+	.ascii	"C1\311&\223.2'\207\b\203T\372\340^\240\217>.R\205\362xD\252\210"
+	.ascii	"\311qm\300!\372\374\214\307b\022\351\272\360A\t\345\260\205\322"
+	.ascii	"X\374\201i\034\026\304\025\025\340\254h\221\202\200\266\300\202"
+	.ascii	"\017N\264p\202\b-N\212\236#\322\307u\207;E\035\343\021G\205\261"
+	.ascii	"H\354Q\201\203L\252H\241\200[\303\020\247\270C\354i\221D\030"
+	.ascii	"8,\322-\352\024\225F7\207\204\034$\361X\003M\034\225/n\355\252"
+	.ascii	"\n\356\305< \202h\307\225\227c\233yO1\336\240\264dg6t\270\341"
+	.ascii	")jN\256\020\265\341(-\017$\2713+]\202<\250D\375\250\202\231\300"
+	.ascii	"/xZH\330\202\236\344\262\234\236\305T\036\253\341\265\306T\360"
+	.ascii	"\362\315\230J\002KaQ\202\374Xa\0214<\004\032\276\002\241\320"
+	.ascii	"\234\243\031\\\363\350\322\032_\307f\252\230PY\332 m\320\253"
+	.ascii	"\307"
+	.string	"\273\344Y\241\222\024|&\345K\033\325\326`\253#M#\254&\267\374\354+\374\025\001\"\324\344\315\3604\214(K\277,*x\245\304\224\364\302\220A\2513z\2627\203\371\002\215ry\026\217\371\336^\336\030\215\263*m\202\2314\036\353L\003\321\224\b\213a\253\223&fO\317>\021\370\214\211\f\252g\261\022\374\003V\362x\t\016k\254\244i`\336\254\234\314\037+\003\246\205\301\264\360\227\177\321pa\rE\2516\376\302^nu6\220\260\027\356j2\002\373\361W\357\374\022^\241\272\272p\365;\273\235\331w\324U\365\344Y\2745C\n\022\036B\314\334\030\322\245)m\205N^\234\344\305\243\266M8K\006-\316\251\355\331n\235\030\311L\036>\202\261\360\021|E\302\322G\357y\207\203h|\205\245,\t\005\311!E\032\202\254\250\"\3418\306\002\231RF\241\031\221\231IR\350\242\n\020\204\"a\240(\342\r\022"
+	.string	"%=\225)\250f\206$I\n\303\236\001\177Q\264\245\313\221\315\bi\001I\313\221\303\202aUd\245\030\3214b\310v2 v\374l\305\337?\347K7\023\353A\264\227\233"
+	.string	"\205\210\235\304!T\230(\261\340\007\250in\205\212\303\340\027\330\035\272* xb!H\377A\033?\252\270h\247\035\273E\263\315\350QM\235\335-DL);\200\"U\254\237\364\377\016o\225b\367\2149\241\321*\005}\301\356\215\315@7\201/\374V%\332\351\313\263\220\325\177\203\234\023\275_0\225S\237\021\203\305\013\374\261N\203\023\013\264\005s\253R\240\305\316z\354\357T\275\377\322\371\360\302\321\270\246\001F\260\310oX;"
+	.string	"\020\2068\030\345\342)2\225\335I\276zO\371g\177tk\263=\3368\375\026\262\226AN)\330\330x\224_\264\310\231\363\302J\210\350\254\302G\032$\021\344\245\372\337!\217\f\364\216\245\032\230\332U9\203&\255\255/,\322\315\275I\220\215\374F\237\364^\336\350\003\377\220\331.\335\331\367\207\261\341\352x\345\031\233P%\"RT\320,\035\300\207\32644\223\205\260\260\255\r\365n\3412\374(\201\260\302$\216\023\306/Y[\021\005\320\177T\016\362"
+	.string	"\343\227\3602\266p\324\265j\241r-\220\034\213*\223\020\225\205TgWy\212\016\210\024\327\037\2152-P\030x\357\311\350\377r\216\271\\\374\260\263\036\006z%\031\223\270\033\007A\005\344\r1\213_\261.\034h\250\244zB\034E\333\016qYe\003\274;\027]\3350y\037T(\0042[\325\343\233\243\366O+'TL\266\315d\245"
+	.string	"\300\243\234\362\031\021\200W\274\256\247\006\320\227P\025\225\325\321\357\031\210T"
+	.ascii	"\3424\351\346\b\271\177q\002+4\304\365\337\220\211\221C\326<"
+	.ascii	"`k\003\025\320\351\231=\023\016U_}\216f\324N\305\200/C\330\003"
+	.ascii	"|/h\365e\351\274\013nyRr{\204I\264\355\0249\rAx8\216\271\234"
+	.ascii	"Y;\260Y\tH\342\003^"
+	.string	"\231\023W4\005.}eqS\023\003\350D\376\322*\337ts<`\n\277\372gE\366\312\306T!\362\310\020\204\3002gC\314\226`p\211E\340\226\364\335\357LE\037\301&\020\264P\360'\3435/\023\230;)%\331U\214D\217\023\242\363!\366o\001\365\314<\304\365\037\350H\221{\347\307\205\235\035\322o5\327!\020\215\220\207\225\207\022\310\210\224I\222}\275A+\221\246\254\203\317\273~\334\313B\243R\177\261\306\205l\306\202\023u`\340\224[\351\313t7\322\314Ie\262\035\316u`\021\026j\345]c\n+\220H\027\352\223\004!\317\347\274%o\276\274\254\334\234\226p\314\006A[\221\320\332$\025\226\212\301\034\3171\265K3\264\264\034\036\"\231H@\317\214\334X\034*\242\001\352d\201\215\375%\344M\242sa*\361'\365\032\221\2240\314E0\333/\273\306\033\314"
+	.string	"\254#C\317\n\240\270\237\333\275\215\037g\3446a@\275\b\225x\321Q\346\340d]\227\271\321\345\262t\026\006a\245\341\272r\r*\017\350\202\276\204\366V\311\b\317\313\270J\314>\323\361\373l\370\273\201m\025\f\263xF+GQ\b\271>\220\254>'\376\\\331\245\207\276\021\302\377\231\267\2572\241X\202\347\007\277\234?\353{e\036\336\2771\361\033\347\004\336\3578\307\265\343\257\033\f\006\303\013\006\252*\037;\031j.>#\344\262>m\211\254\352E\263-\270.%x\206#\217A\230R21eyYUp\355\233\257hH\323\260\005|\344n}\025\230\026\271\373j_\f-g\353\262\224b~_\233\026\017;1o\275\206\324\213;C\300\034`\005B\027\030\314\336\346\002\205120\001!\250H\363%z\177s\246\344\366\263>X\034\315\253p\r\316\327\226F\016\364\016\370"
+	.string	"\022\033\344\343\203\373gh\370aU\245\314\003-Vf`2K\317~M\304_\032|j6\032h\216"
+	.ascii	"3h\357\007\310\027\320KB\202\341\263;>\034\022\253\026B\270\246"
+	.ascii	"\307\367\203\315+\325\263\332\355^\224\t\264\216\021\377oykM"
+	.ascii	"\230\310\237m\251~A\267e\357\006\345\306\016\3645[>\003\230\345"
+	.ascii	"\033[\207\300\321\004\251\355\311x\360\307NC\361\30112F\236\247"
+	.ascii	"\315\202v\030\021\025P\302\345MEz\023\232\300\233\314e\324\247"
+	.ascii	"\330\036dn\342\3525\3221*\273\330\315\341\275\214\371\232\024"
+	.ascii	"\254\334\007\346\027k\006,nP\263\250\274\205\335%iI\362\021\026"
+	.ascii	"\267\265'\340o\333\306\\\017%,@\336G\306^\247\203K\326\333G>"
+	.ascii	"\307\227\374\2035\343\327\033\317Z9\006W\225\327W\366\031\276"
+	.ascii	"\313\177\377\307\334\007\233xn\356\016\365\0028\032\343\307I"
+	.ascii	"\337\212\017\363ne\364\311c\303\306k\322/\343.\340`\353\300\306"
+	.ascii	"\016G\255\366\333\206;j\343\3367\317\277\277\236\271\270x\322"
+	.ascii	"z\261\2573\317\261\365\317\316\364\256\252\317\237\035!\370\355"
+	.ascii	"\rO\377ZV\fy9\177\332\345\253i\005"
+	.text
+	.section	.gnu.lto_.symtab.152ab9a3eee98019,"e",@progbits
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"isEEPROMContentValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"__config_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"__config_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.152ab9a3eee98019,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,6855 @@
+	.file	"config_streamer.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/include/stdint.h"
+	.file 5 "./src/main/target/SITL/target.h"
+	.file 6 "./src/main/config/config_streamer.h"
+	.file 7 "/usr/include/string.h"
+	.file 8 "./src/main/config/config_streamer.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	config_streamer.c.aa08c222
+	.weak	config_streamer.c.aa08c222
+config_streamer.c.aa08c222:
+	.long	0x2ea
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x12
+	.long	.LASF987
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x2
+	.long	.LASF955
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF949
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF950
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF951
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF952
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF953
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF954
+	.uleb128 0x2
+	.long	.LASF956
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x4a
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF957
+	.uleb128 0x2
+	.long	.LASF958
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x51
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF959
+	.uleb128 0x14
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF960
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0xb
+	.long	0x87
+	.uleb128 0x2
+	.long	.LASF961
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x2
+	.long	.LASF962
+	.byte	0x4
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x15
+	.byte	0x7
+	.byte	0x4
+	.long	0x51
+	.byte	0x5
+	.byte	0xa6
+	.byte	0xe
+	.long	0xdd
+	.uleb128 0x4
+	.long	.LASF963
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF964
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF965
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF966
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF967
+	.byte	0x5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF968
+	.byte	0x5
+	.byte	0xac
+	.byte	0x3
+	.long	0xb0
+	.uleb128 0xb
+	.long	0xdd
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x5
+	.long	0x10a
+	.uleb128 0xc
+	.string	"b"
+	.byte	0x1e
+	.byte	0x11
+	.long	0x10a
+	.uleb128 0xc
+	.string	"w"
+	.byte	0x1f
+	.byte	0x12
+	.long	0x98
+	.byte	0
+	.uleb128 0x17
+	.long	0x87
+	.long	0x11a
+	.uleb128 0x18
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF988
+	.byte	0x20
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x10
+	.long	0x16d
+	.uleb128 0x6
+	.long	.LASF969
+	.byte	0x1b
+	.byte	0xf
+	.long	0xa4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF970
+	.byte	0x1c
+	.byte	0x9
+	.long	0x3c
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF971
+	.byte	0x20
+	.byte	0x7
+	.long	0xee
+	.byte	0xc
+	.uleb128 0xd
+	.string	"at"
+	.byte	0x21
+	.long	0x3c
+	.byte	0x10
+	.uleb128 0xd
+	.string	"err"
+	.byte	0x22
+	.long	0x3c
+	.byte	0x14
+	.uleb128 0x6
+	.long	.LASF972
+	.byte	0x23
+	.byte	0x9
+	.long	0x16d
+	.byte	0x18
+	.byte	0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF973
+	.uleb128 0x2
+	.long	.LASF974
+	.byte	0x6
+	.byte	0x24
+	.byte	0x3
+	.long	0x11a
+	.uleb128 0xe
+	.long	.LASF977
+	.byte	0xb5
+	.uleb128 0x8
+	.long	.LASF975
+	.byte	0x5
+	.byte	0xb7
+	.long	0xdd
+	.long	0x1a0
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0x98
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF976
+	.byte	0x5
+	.byte	0xb6
+	.long	0xdd
+	.long	0x1b5
+	.uleb128 0x3
+	.long	0xa4
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF978
+	.byte	0xb4
+	.uleb128 0x8
+	.long	.LASF979
+	.byte	0x7
+	.byte	0x3d
+	.long	0x85
+	.long	0x1da
+	.uleb128 0x3
+	.long	0x85
+	.uleb128 0x3
+	.long	0x3c
+	.uleb128 0x3
+	.long	0x22
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF980
+	.value	0x123
+	.long	0x3c
+	.long	0x1f4
+	.uleb128 0x5
+	.string	"c"
+	.value	0x123
+	.byte	0x2f
+	.long	0x1f4
+	.byte	0
+	.uleb128 0xf
+	.long	0x174
+	.uleb128 0x7
+	.long	.LASF981
+	.value	0x119
+	.long	0x3c
+	.long	0x213
+	.uleb128 0x5
+	.string	"c"
+	.value	0x119
+	.byte	0x2e
+	.long	0x1f4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF982
+	.value	0x114
+	.long	0x3c
+	.long	0x22d
+	.uleb128 0x5
+	.string	"c"
+	.value	0x114
+	.byte	0x2f
+	.long	0x1f4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF983
+	.value	0x107
+	.long	0x3c
+	.long	0x26d
+	.uleb128 0x5
+	.string	"c"
+	.value	0x107
+	.byte	0x2e
+	.long	0x1f4
+	.uleb128 0x5
+	.string	"p"
+	.value	0x107
+	.byte	0x40
+	.long	0x26d
+	.uleb128 0x1a
+	.long	.LASF970
+	.byte	0x8
+	.value	0x107
+	.byte	0x4c
+	.long	0x98
+	.uleb128 0x10
+	.uleb128 0x1b
+	.string	"pat"
+	.byte	0x8
+	.value	0x109
+	.byte	0x19
+	.long	0x26d
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x93
+	.uleb128 0x1c
+	.long	.LASF989
+	.byte	0x8
+	.byte	0xdc
+	.byte	0xc
+	.long	0x3c
+	.long	0x2af
+	.uleb128 0x9
+	.string	"c"
+	.byte	0xdc
+	.byte	0x2a
+	.long	0x1f4
+	.uleb128 0xa
+	.long	.LASF984
+	.byte	0xdc
+	.byte	0x36
+	.long	0x98
+	.uleb128 0x11
+	.long	.LASF985
+	.byte	0xfe
+	.byte	0x18
+	.long	0xe9
+	.uleb128 0x10
+	.uleb128 0x11
+	.long	.LASF985
+	.byte	0xf8
+	.byte	0x1c
+	.long	0xe9
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF990
+	.byte	0x8
+	.byte	0x42
+	.byte	0x6
+	.long	0x2db
+	.uleb128 0x9
+	.string	"c"
+	.byte	0x42
+	.byte	0x2f
+	.long	0x1f4
+	.uleb128 0xa
+	.long	.LASF986
+	.byte	0x42
+	.byte	0x3c
+	.long	0xa4
+	.uleb128 0xa
+	.long	.LASF970
+	.byte	0x42
+	.byte	0x46
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF991
+	.byte	0x8
+	.byte	0x3d
+	.byte	0x6
+	.uleb128 0x9
+	.string	"c"
+	.byte	0x3d
+	.byte	0x2e
+	.long	0x1f4
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 9 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF555
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF573
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF620
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF621
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 21 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 22 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.file 23 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x5
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF671
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF480
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF731
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF735
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF736
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF832
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 29 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x1d
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF943
+	.byte	0x4
+	.byte	0x4
+	.file 30 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF476
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF479
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF492
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF493
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF540
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF554
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF572
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF597
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF616
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF618
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF623
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF596
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF616
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF669
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF686
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF728
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF730
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF862
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF864
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF618
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF865
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF630
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF911
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF942
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF948
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF992
+	.long	.LASF993
+	.long	.LASF994
+	.long	.LASF995
+	.long	.LASF996
+	.long	.LASF997
+	.long	.LASF998
+	.long	.LASF999
+	.long	.LASF1000
+	.long	.LASF1001
+	.long	.LASF1002
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x20
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1003
+	.byte	0xb
+	.long	.LASF1004
+	.byte	0x7
+	.long	.LASF1005
+	.byte	0x7
+	.long	.LASF1006
+	.byte	0xa
+	.long	.LASF1007
+	.byte	0x3
+	.long	.LASF1008
+	.byte	0x1
+	.long	.LASF1009
+	.byte	0xa
+	.long	.LASF1010
+	.byte	0x1
+	.long	.LASF1011
+	.byte	0xa
+	.long	.LASF1012
+	.byte	0x7
+	.long	.LASF1013
+	.byte	0xa
+	.long	.LASF1014
+	.byte	0xa
+	.long	.LASF1015
+	.byte	0x7
+	.long	.LASF1016
+	.byte	0x7
+	.long	.LASF1017
+	.byte	0x9
+	.long	.LASF1018
+	.byte	0x7
+	.long	.LASF1019
+	.byte	0x8
+	.long	.LASF1020
+	.byte	0x8
+	.long	.LASF1021
+	.byte	0x6
+	.long	.LASF1022
+	.byte	0x6
+	.long	.LASF1023
+	.byte	0xa
+	.long	.LASF1024
+	.byte	0x5
+	.long	.LASF1025
+	.byte	0x4
+	.long	.LASF1006
+	.byte	0xb
+	.long	.LASF1026
+	.byte	0x7
+	.long	.LASF1027
+	.byte	0x7
+	.long	.LASF1028
+	.byte	0x7
+	.long	.LASF1029
+	.byte	0x7
+	.long	.LASF1030
+	.byte	0x4
+	.long	.LASF1031
+	.byte	0x2
+	.long	.LASF1032
+	.byte	0xb
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF744:
+	.string	"INT32_MAX (2147483647)"
+.LASF964:
+	.string	"FLASH_ERROR_PG"
+.LASF686:
+	.string	"__STD_TYPE typedef"
+.LASF478:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF645:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF955:
+	.string	"size_t"
+.LASF980:
+	.string	"config_streamer_finish"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF724:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF977:
+	.string	"FLASH_Lock"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF620:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF580:
+	.string	"__stub_sigreturn "
+.LASF417:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF542:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF625:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF699:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF556:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF517:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF719:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF790:
+	.string	"INT16_C(c) c"
+.LASF821:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF488:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF809:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF870:
+	.string	"U_ID_0 0"
+.LASF783:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF484:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF832:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF780:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF882:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF820:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF865:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF888:
+	.string	"USE_UART7 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF814:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF935:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF759:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF803:
+	.string	"INT32_WIDTH 32"
+.LASF805:
+	.string	"INT64_WIDTH 64"
+.LASF531:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF731:
+	.string	"__STD_TYPE"
+.LASF968:
+	.string	"FLASH_Status"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF769:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF504:
+	.string	"__P(args) args"
+.LASF942:
+	.string	"__enable_irq() "
+.LASF599:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF641:
+	.string	"USE_SERIALRX_SUMD "
+.LASF864:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF669:
+	.string	"VTX_TRAMP "
+.LASF449:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF773:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF841:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF423:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF615:
+	.string	"__size_t "
+.LASF738:
+	.string	"INT8_MIN (-128)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF683:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF492:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF658:
+	.string	"TELEMETRY_MAVLINK "
+.LASF437:
+	.string	"_ISOC99_SOURCE 1"
+.LASF519:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF603:
+	.string	"_T_SIZE "
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF747:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF768:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF926:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF760:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF420:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF407:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF617:
+	.string	"NULL"
+.LASF871:
+	.string	"U_ID_1 1"
+.LASF514:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF713:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF668:
+	.string	"VTX_SMARTAUDIO "
+.LASF898:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF785:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF576:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF833:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF708:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF431:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF411:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF416:
+	.string	"__USE_XOPEN2K8"
+.LASF663:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF541:
+	.string	"__always_inline"
+.LASF601:
+	.string	"_SYS_SIZE_T_H "
+.LASF638:
+	.string	"USE_SERIALRX_IBUS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF427:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF740:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF490:
+	.string	"__GLIBC__ 2"
+.LASF937:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF959:
+	.string	"long int"
+.LASF480:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF432:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF467:
+	.string	"__USE_XOPEN2K8 1"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF840:
+	.string	"_PTRDIFF_T_ "
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF654:
+	.string	"CMS "
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF728:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF643:
+	.string	"USE_SERIALRX_XBUS "
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF775:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF707:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF706:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF665:
+	.string	"USE_SENSOR_NAMES "
+.LASF610:
+	.string	"_SIZE_T_DECLARED "
+.LASF506:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF912:
+	.string	"USE_DASHBOARD"
+.LASF901:
+	.string	"USE_SERIALRX_XBUS"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF649:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF940:
+	.string	"EEPROM_SIZE 32768"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF527:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF782:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF646:
+	.string	"TELEMETRY "
+.LASF623:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF963:
+	.string	"FLASH_BUSY"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF689:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF520:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF618:
+	.string	"NULL ((void *)0)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF583:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF487:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF497:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF804:
+	.string	"UINT32_WIDTH 32"
+.LASF954:
+	.string	"signed char"
+.LASF806:
+	.string	"UINT64_WIDTH 64"
+.LASF960:
+	.string	"uint8_t"
+.LASF673:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF508:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF889:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF688:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF555:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF877:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF988:
+	.string	"config_streamer_s"
+.LASF974:
+	.string	"config_streamer_t"
+.LASF448:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF661:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF704:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF908:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF429:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF609:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF612:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF460:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF505:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF611:
+	.string	"__DEFINED_size_t "
+.LASF475:
+	.string	"__USE_LARGEFILE 1"
+.LASF648:
+	.string	"TELEMETRY_HOTT "
+.LASF831:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF884:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF739:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF973:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF549:
+	.string	"__restrict_arr __restrict"
+.LASF574:
+	.string	"__stub___compat_bdflush "
+.LASF607:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF918:
+	.string	"BLACKBOX"
+.LASF984:
+	.string	"value"
+.LASF640:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF715:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF486:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF651:
+	.string	"USE_RESOURCE_MGMT "
+.LASF755:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF528:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF753:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF822:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF585:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF579:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF596:
+	.string	"__need_size_t "
+.LASF902:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF676:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF698:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF561:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF546:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF922:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF627:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF927:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF414:
+	.string	"__USE_XOPEN2K"
+.LASF730:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF415:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF544:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF447:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF972:
+	.string	"unlocked"
+.LASF598:
+	.string	"__size_t__ "
+.LASF464:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF766:
+	.string	"INT_FAST8_MAX (127)"
+.LASF754:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF784:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF827:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF795:
+	.string	"UINT32_C(c) c ## U"
+.LASF774:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF409:
+	.string	"__USE_POSIX199309"
+.LASF745:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF989:
+	.string	"write_word"
+.LASF764:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF991:
+	.string	"config_streamer_init"
+.LASF491:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF413:
+	.string	"__USE_UNIX98"
+.LASF637:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF430:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF866:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF982:
+	.string	"config_streamer_status"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF729:
+	.string	"_BITS_TIME64_H 1"
+.LASF692:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF859:
+	.string	"__INT_WCHAR_T_H "
+.LASF677:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF722:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF548:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF762:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF440:
+	.string	"_ISOC2X_SOURCE"
+.LASF931:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF945:
+	.string	"bool _Bool"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF956:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF854:
+	.string	"_BSD_WCHAR_T_ "
+.LASF971:
+	.string	"buffer"
+.LASF985:
+	.string	"status"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF771:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF628:
+	.string	"I2C1_OVERCLOCK true"
+.LASF869:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF586:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF526:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF899:
+	.string	"USE_SERIALRX_SUMD"
+.LASF772:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF765:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF919:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF587:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF872:
+	.string	"U_ID_2 2"
+.LASF536:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF903:
+	.string	"LED_STRIP"
+.LASF619:
+	.string	"__need_NULL"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF830:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF454:
+	.string	"_ATFILE_SOURCE"
+.LASF682:
+	.string	"__SLONG32_TYPE int"
+.LASF787:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF703:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF401:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF403:
+	.string	"__USE_ISOC11"
+.LASF479:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF880:
+	.string	"MAG "
+.LASF734:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF808:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF736:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF913:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF652:
+	.string	"USE_SERVOS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF810:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF476:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF778:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF705:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF817:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF671:
+	.string	"_BITS_TYPES_H 1"
+.LASF746:
+	.string	"UINT8_MAX (255)"
+.LASF622:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF793:
+	.string	"UINT8_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF442:
+	.string	"_POSIX_SOURCE"
+.LASF967:
+	.string	"FLASH_TIMEOUT"
+.LASF938:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF958:
+	.string	"__uint32_t"
+.LASF461:
+	.string	"__USE_ISOC95 1"
+.LASF565:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF578:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF602:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF969:
+	.string	"address"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF818:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF936:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF632:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF518:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF434:
+	.string	"_ISOC95_SOURCE"
+.LASF975:
+	.string	"FLASH_ProgramWord"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF500:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF597:
+	.string	"__need_NULL "
+.LASF402:
+	.string	"_FEATURES_H 1"
+.LASF453:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF472:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF498:
+	.string	"__LEAF , __leaf__"
+.LASF418:
+	.string	"__USE_LARGEFILE"
+.LASF664:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF530:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF819:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF915:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF873:
+	.string	"LED0_PIN NONE"
+.LASF962:
+	.string	"uintptr_t"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF687:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF890:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF842:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF470:
+	.string	"__USE_UNIX98 1"
+.LASF723:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF471:
+	.string	"_LARGEFILE_SOURCE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF837:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF422:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF906:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF990:
+	.string	"config_streamer_start"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF450:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF469:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF631:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF630:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF850:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF558:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF932:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF408:
+	.string	"__USE_POSIX2"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF616:
+	.string	"__need_size_t"
+.LASF605:
+	.string	"_SIZE_T_ "
+.LASF483:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF894:
+	.string	"SERIAL_RX"
+.LASF828:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF928:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF847:
+	.string	"__wchar_t__ "
+.LASF567:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF572:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF981:
+	.string	"config_streamer_flush"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF670:
+	.string	"_STDINT_H 1"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF978:
+	.string	"FLASH_Unlock"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF983:
+	.string	"config_streamer_write"
+.LASF777:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF553:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF852:
+	.string	"__WCHAR_T "
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF914:
+	.string	"VTX_COMMON"
+.LASF503:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF446:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF807:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF534:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF552:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF494:
+	.string	"__PMT"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF709:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF455:
+	.string	"_ATFILE_SOURCE 1"
+.LASF678:
+	.string	"__SQUAD_TYPE long int"
+.LASF900:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF799:
+	.string	"INT8_WIDTH 8"
+.LASF710:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF425:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF569:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF835:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF824:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF564:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF953:
+	.string	"unsigned int"
+.LASF733:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF802:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF495:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF421:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF944:
+	.string	"_STDBOOL_H "
+.LASF861:
+	.string	"_WCHAR_T_DECLARED "
+.LASF650:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF466:
+	.string	"__USE_XOPEN2K 1"
+.LASF459:
+	.string	"__USE_ISOC11 1"
+.LASF716:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF675:
+	.string	"__U32_TYPE unsigned int"
+.LASF838:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF525:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF836:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF529:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF457:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF551:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF577:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF757:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF712:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF750:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF639:
+	.string	"USE_SERIALRX_SBUS "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF659:
+	.string	"TELEMETRY_SRXL "
+.LASF540:
+	.string	"__wur "
+.LASF473:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF904:
+	.string	"TELEMETRY_FRSKY"
+.LASF947:
+	.string	"false 0"
+.LASF966:
+	.string	"FLASH_COMPLETE"
+.LASF800:
+	.string	"UINT8_WIDTH 8"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF789:
+	.string	"INT8_C(c) c"
+.LASF946:
+	.string	"true 1"
+.LASF844:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF681:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF727:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF489:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF691:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF876:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF700:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF501:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF557:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF507:
+	.string	"__STRING(x) #x"
+.LASF584:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF952:
+	.string	"unsigned char"
+.LASF891:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF554:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF725:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF849:
+	.string	"_WCHAR_T "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF879:
+	.string	"USE_FAKE_BARO "
+.LASF910:
+	.string	"TELEMETRY_MAVLINK"
+.LASF843:
+	.string	"_GCC_PTRDIFF_T "
+.LASF951:
+	.string	"char"
+.LASF502:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF563:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF600:
+	.string	"_SIZE_T "
+.LASF857:
+	.string	"_WCHAR_T_H "
+.LASF976:
+	.string	"FLASH_ErasePage"
+.LASF752:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF881:
+	.string	"USE_FAKE_MAG "
+.LASF917:
+	.string	"VTX_TRAMP"
+.LASF522:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF749:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF834:
+	.string	"_STDDEF_H_ "
+.LASF920:
+	.string	"USE_SERVOS"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF604:
+	.string	"__SIZE_T "
+.LASF644:
+	.string	"BLACKBOX "
+.LASF662:
+	.string	"USE_MSP_PUSH "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF874:
+	.string	"GYRO "
+.LASF921:
+	.string	"USE_DSHOT"
+.LASF941:
+	.string	"__disable_irq() "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF896:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF405:
+	.string	"__USE_ISOC95"
+.LASF987:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF404:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF412:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF909:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF509:
+	.string	"__BEGIN_DECLS "
+.LASF860:
+	.string	"_GCC_WCHAR_T "
+.LASF761:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF939:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF537:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF465:
+	.string	"__USE_POSIX199506 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF737:
+	.string	"__intptr_t_defined "
+.LASF468:
+	.string	"__USE_XOPEN 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF970:
+	.string	"size"
+.LASF656:
+	.string	"TELEMETRY_IBUS "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF878:
+	.string	"BARO "
+.LASF393:
+	.string	"SITL 1"
+.LASF435:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF406:
+	.string	"__USE_ISOCXX11"
+.LASF608:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF685:
+	.string	"__U64_TYPE unsigned long int"
+.LASF839:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF758:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF445:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF875:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF533:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF410:
+	.string	"__USE_POSIX199506"
+.LASF815:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF791:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF796:
+	.string	"UINT64_C(c) c ## UL"
+.LASF886:
+	.string	"USE_UART5 "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF895:
+	.string	"USE_SERIALRX_CRSF"
+.LASF477:
+	.string	"__WORDSIZE 64"
+.LASF856:
+	.string	"_WCHAR_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF581:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF660:
+	.string	"USE_DASHBOARD "
+.LASF943:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF515:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF684:
+	.string	"__S64_TYPE long int"
+.LASF568:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF606:
+	.string	"_BSD_SIZE_T_ "
+.LASF512:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF798:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF979:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF851:
+	.string	"_T_WCHAR "
+.LASF674:
+	.string	"__S32_TYPE int"
+.LASF748:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF634:
+	.string	"USE_PPM "
+.LASF786:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF399:
+	.string	"_STRING_H 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF732:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF792:
+	.string	"INT64_C(c) c ## L"
+.LASF482:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF853:
+	.string	"_WCHAR_T_ "
+.LASF829:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF855:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF897:
+	.string	"USE_SERIALRX_SBUS"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF812:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF575:
+	.string	"__stub_chflags "
+.LASF868:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF424:
+	.string	"__USE_GNU"
+.LASF635:
+	.string	"USE_PWM "
+.LASF614:
+	.string	"_SIZET_ "
+.LASF718:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF887:
+	.string	"USE_UART6 "
+.LASF636:
+	.string	"SERIAL_RX "
+.LASF653:
+	.string	"GPS "
+.LASF456:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF629:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF711:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF562:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF892:
+	.string	"USE_PPM"
+.LASF545:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF438:
+	.string	"_ISOC11_SOURCE"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF666:
+	.string	"VTX_COMMON "
+.LASF535:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF770:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF510:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF481:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF930:
+	.string	"USED_TIMERS 0"
+.LASF811:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF957:
+	.string	"short int"
+.LASF493:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF433:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF742:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF523:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF813:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF560:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF679:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF846:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF571:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF717:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF521:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF696:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF524:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF680:
+	.string	"__SWORD_TYPE long int"
+.LASF848:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF532:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF693:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF462:
+	.string	"__USE_POSIX 1"
+.LASF779:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF776:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF570:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF862:
+	.string	"__DEFINED_wchar_t "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF794:
+	.string	"UINT16_C(c) c"
+.LASF451:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF633:
+	.string	"USE_CLI "
+.LASF667:
+	.string	"VTX_CONTROL "
+.LASF672:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF788:
+	.string	"WINT_MAX (4294967295u)"
+.LASF655:
+	.string	"TELEMETRY_CRSF "
+.LASF539:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF543:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF858:
+	.string	"___int_wchar_t_h "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF816:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF923:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF559:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF714:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF547:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF701:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF741:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF452:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF613:
+	.string	"_GCC_SIZE_T "
+.LASF883:
+	.string	"USE_UART2 "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF863:
+	.string	"_BSD_WCHAR_T_"
+.LASF756:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF826:
+	.string	"UINTMAX_WIDTH 64"
+.LASF961:
+	.string	"uint32_t"
+.LASF458:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF690:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF751:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF441:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF763:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF511:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF443:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF463:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF702:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF566:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF825:
+	.string	"INTMAX_WIDTH 64"
+.LASF743:
+	.string	"INT16_MAX (32767)"
+.LASF588:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF694:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF474:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF695:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF933:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF626:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF916:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF496:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF439:
+	.string	"_ISOC11_SOURCE 1"
+.LASF735:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF950:
+	.string	"short unsigned int"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF767:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF925:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF485:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF986:
+	.string	"base"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF948:
+	.string	"__bool_true_false_are_defined 1"
+.LASF721:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF823:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF657:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF642:
+	.string	"USE_SERIALRX_SUMH "
+.LASF845:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF516:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF573:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF499:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF905:
+	.string	"TELEMETRY_HOTT"
+.LASF697:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF885:
+	.string	"USE_UART4 "
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF419:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF621:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF893:
+	.string	"USE_PWM"
+.LASF934:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF647:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF436:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF624:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF582:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF726:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF781:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF444:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF720:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF929:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF797:
+	.string	"INTMAX_C(c) c ## L"
+.LASF949:
+	.string	"long unsigned int"
+.LASF867:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF965:
+	.string	"FLASH_ERROR_WRP"
+.LASF550:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF911:
+	.string	"TELEMETRY_IBUS"
+.LASF907:
+	.string	"TELEMETRY_CRSF"
+.LASF801:
+	.string	"INT16_WIDTH 16"
+.LASF924:
+	.string	"USE_PROFILE "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1012:
+	.string	"libc-header-start.h"
+.LASF1020:
+	.string	"stubs-64.h"
+.LASF1028:
+	.string	"wchar.h"
+.LASF1001:
+	.string	"/usr/include"
+.LASF1025:
+	.string	"common.h"
+.LASF1010:
+	.string	"config_streamer.c"
+.LASF1023:
+	.string	"strings.h"
+.LASF1022:
+	.string	"__locale_t.h"
+.LASF995:
+	.string	"src/main/target"
+.LASF1009:
+	.string	"string.h"
+.LASF1029:
+	.string	"stdint-intn.h"
+.LASF0:
+	.string	"./src/main/config/config_streamer.c"
+.LASF1031:
+	.string	"system.h"
+.LASF1005:
+	.string	"stdint-uintn.h"
+.LASF1000:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1002:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF994:
+	.string	"src/main/target/SITL"
+.LASF1013:
+	.string	"features.h"
+.LASF1027:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1008:
+	.string	"config_streamer.h"
+.LASF1021:
+	.string	"locale_t.h"
+.LASF998:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1003:
+	.string	"stddef.h"
+.LASF1019:
+	.string	"stubs.h"
+.LASF992:
+	.string	"src/main/config"
+.LASF1026:
+	.string	"typesizes.h"
+.LASF1014:
+	.string	"features-time64.h"
+.LASF1030:
+	.string	"common_post.h"
+.LASF1017:
+	.string	"cdefs.h"
+.LASF1007:
+	.string	"target.h"
+.LASF1016:
+	.string	"timesize.h"
+.LASF993:
+	.string	"src/main/drivers"
+.LASF1024:
+	.string	"platform.h"
+.LASF997:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF996:
+	.string	"src/main"
+.LASF1032:
+	.string	"stdbool.h"
+.LASF999:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1015:
+	.string	"wordsize.h"
+.LASF1018:
+	.string	"long-double.h"
+.LASF1011:
+	.string	"stdc-predef.h"
+.LASF1006:
+	.string	"stdint.h"
+.LASF1004:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375 \262\215\003"
+	.string	"\004\005\246"
+	.string	"\b"
+	.string	"\376\322\353\302\003\006\002"
+	.string	"\002\001\001\227\300\230\353\f\004\002\002\002\305\315\323\321\f"
+	.string	"\003\335\313\350\362\006\n\003\002\002\001\004\325\253\260\362\n\020\004\002\004\002\005\002\001\002\005\257\201\370\363\t\002\006\334\374\302\304\b\n\002\002\007\217\362\233\236\f\006"
+	.string	"\r"
+	.ascii	"c\340LR~lZ\003{A3 \300%\340.\257\247\0055\233\222\211\317\216"
+	.ascii	"\244\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375 \247\305\002"
+	.string	"\242\304\f\023\300\025\322\001?\350\377\377\237\265\353\256F\310n{\313\224\002\036\266\246h\200\016\3553\001Gy\016\022\237pT\336\324 \223`\013[\350j\333\352\317N\341 \016"
+	.string	".9:\006p\264\304\303\205\246y\b\f"
+	.ascii	"\203\270B=J`G\315Kg\340\226\333\300\310\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`T\002\255\r"
+	.string	"\326\026I;0m\223t\300D\303\313-\204\017\243\"\207h\340\335x\304\264%\342\366}i\312\255(\275jpUb\377\252\373\265a1\203'\274\320\3018\fx\203?D\332\307\337\b5\273\267\334)8"
+	.string	"8"
+	.string	"9"
+	.string	"\021\253\346\257\203\003nUs\204\343\001G\b\200\357\251z\252\372S2\317\213ik\255\335\275TA40|\260\247\360\003\324\021b\371x\324\373>\213\202\340H\310\240<\033\013\004\367\251\272'\230\354d\230</'\325\013\036\034\b\353\346\345\346\201v\224\030A\341\266L\365\323Z\213\\K\364\013Zk\f~\2756\3566\034\353\346\025r\027\321\254\324\215\337E#h\007\013$LT\260w\277\244\327~\t\332\340\003\350D\345\\ri\240s3\206\322W F\322\007?\005\221T\315\3752\rax4(\306\277\237*l\375\313\240\210\326\332\n\337q8\251\233\f\030\036\r\322\353\246*\233 <\005t:c\037\366\337\253mF\007\036\234\b\001\216\222\302<B D\377*z\336\2233\255\020\312\360\320{-:\301\003\262A9< `\"B2\327\0038\240\203\207\301\035]\026\3220\216R\336\242lDO\001?\331"
+	.string	"(\004\357\b\220\022\364WX\""
+	.string	"\006\275\0352\315c\324\254\213<\315\035\n@\230s\356Z\253\317\022{\351\361\205C>\006+b\030e\225\300R4\236\252\242\3210`\033"
+	.ascii	"g\360\305`\006\022\336\016\351\302V\307\017\330j\234\b\203^g"
+	.ascii	"\203@\225\233\337.\205\235\330\344\302\2524\332\253\270\355\262"
+	.ascii	"\236\200\031b\033\003\276\260\355\375\215v\203\262\325\350\323"
+	.ascii	"\273(n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"U\004"
+	.string	"\362\307\024\033\260%\351,h\001\006(\032\206)L\n\026\347\024\235@\202c\203%\333\356-\223\f\333\354<\0311\275\243\246\277D\361\2255;_s\363\200\022\215\260\305\316\032\376\231\242xGq\273\360J5\347J?B)\245|i+\311\330d\274\221\200\317\016\236\013\354C\025"
+	.ascii	"I\017P\031\271(\206C\320.\251Co\346\340\016\r,L\302g\356\202"
+	.ascii	"vi\212\223I\334\035a\023\263A\324qR\325 \224\0360\367\251\300"
+	.ascii	"\233Y\\\001\206"
+	.text
+	.section	.gnu.lto_.pureconst.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\231\004\002\230\004\003\232\004\004\232\004\005"
+	.ascii	"\205\004\006\232\004\007\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"\225\005"
+	.string	"\202\307\027 \240'\351\340j\\\305.\005\270\353\374\027\242\276Y\277\304\rp\026\214\250\373\317\204l\322\b\3312\005\013\006\205\300\361+e\266\364\220\365\025\335\311\036\217i\005\261\023\273\256AH\314yee\205x\336\3553\223RS}\026\306\034\305\262\016\tF\355G,\342\314\362\374\336\221u\2005\261\323\350k\b$ \240\242\031\302\036O\200\357\351\3141\241\301\347"
+	.string	"\337Q\211\352{\300\355.\224(,"
+	.string	"a\003{\030#m\330^\260\270\274\nI\270,\022\203\211u\356\013\262\005\213\033J\370\314p[.\330\251=\301\021\020\1779\356,\003\036"
+	.ascii	"E\2648#X)\002"
+	.text
+	.section	.gnu.lto_.lto.bcf380e00d9e0062,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.0.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\365\007"
+	.string	"\262\21787@o\323\001L\375\302j}g\240\\\200)\346x\034"
+	.string	"W\305Q\372\032\252n\3105\267\221v\274\035D\360\343Q\341p\322A\215\245N\213\001\306\246\356\205f\335\310\226)\005\3060L{X\310\262\313@\273\265\253\333@\331\326\215D\023\025\037\212\020\247\315\320'\003M\255\023\315\013\301\234\305\326\315\021\307u\2233\356\251\225\242#B\223\206\3340\245\236[\305J\270J\373\002C\017\332C\222\237;'\226\325\030{\374T\202\330\247vw-E\373\245_)\006\022\301\313\256\307IfMU\212\210\355s\354\252\305\341j\237\344%\336K\031\027\330\025WPvG\0057l^y|\307z\265\371\200\365\312\236\355R\300\0210\323q\002\263\273S\206\334\273z\376M\016"
+	.string	"\206\337U\003\261\273V0\374\270\345m\037\330\226\260=\022\t"
+	.ascii	"8gU\305\263\314>\335\333&\334\322p\301\372[\215\016wx\321N2"
+	.text
+	.section	.gnu.lto_config_streamer_start.1.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`\302\001\245\017"
+	.string	"6\034gH\360\222(\0350\004e\276bt\312\350\223\253!\253\231\024V\226X\005\037\227\232k\352D\370\270\037\330\2641C\365"
+	.string	"AW1\330\330U\323\210INUT2\215\357 \037k\222\027\365\307X\316\334\343\202w \237\354\275wJ\001N"
+	.string	"O"
+	.string	"V"
+	.ascii	"\264\335\261\304\013\270W\217\007m\257\334\007l\257F\3319>\276"
+	.ascii	"\3661V\207\031\316\356v\223\304Q\247S"
+	.string	"\242\374\317\016\302j\245N?|R\00464x|Z+\nr9\301\372\354\262\245\245\222\322\363`w-Y-\017w\275\355\b\266)\330\022\024\273\353\351\262/\373=\037\377z\330O\251\364C\032\324pt\024\230\331u\331\321\331Z\255\201\302\366?v\2351\232.\036C]f\031\032`W#Zh\273[\342\t\334+\t\255\262\221\034Ut$p\257u\305\350\322>\213\267@\035\266r\001\273\256\231,\223\250f\312!104\177\345\330\320\246O\333\247I\f\307J\346\330\016/\343\304}\212\324\300Dx\246\235\3411,\003\240F\306\204\240\251\3236\035\206\n\267\273\f\374\027\0334\314\227\211W\177e{\035)\001\202E\356x$\005\255\307\216\225>\3541%\347\213}\272\001 \007\222\211\202&\317\204Z$\022}\016\024x^\310\300w\177!\021,y\240\230b\252pB\262\200\022~\035\n\311+u\237h\352B\007\034b"
+	.ascii	"\305.%\f\305\3563\356\351N\227!\374\250\261L\225\023\334>\271"
+	.ascii	"\215\327\r\f\235/?m\264\223\b\201\0337\233\212\217\264/\224\344"
+	.ascii	"\003$ \220\002\031A\273\001\330\263\252\347yz\037\206\326\275"
+	.ascii	"\260\252\243\212\273\330\035t\227\302}\205\346\026\322X,\360"
+	.ascii	"\260\033$hz\210T\204\315\336\027\236\265a\356K\266\263M.\243"
+	.ascii	"i\f\003\261\016\375\200\206\307D\f\236pjDE\033\003\001q\013Z"
+	.ascii	"\236\n9\2458{"
+	.text
+	.section	.gnu.lto_write_word.2.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`Q\002\025\024"
+	.string	"\326'\213J\300\322Q:(\002up\025\220!\331\213\231PH\216\275\f\rp\310\341\250\220\303%\036\004Q\020\217zw\034Z\243\037\277\243h\007J\241\263\372\025\321a\216-\274)\r\241]S\236\2011\261;+j\221\3765 \215\354\275eJ\001t"
+	.string	"s"
+	.string	"w"
+	.ascii	"\265\366\3108\252uD`\005\341\251\307\320\266\217\342A8\033i\216"
+	.ascii	"@bJ\027\244\343A\325Z_\255\207\200\247\363\004\300S\371s\334"
+	.ascii	"A:\345\342|\225\230;\030\336\234\316\006I6B \242\314<\217\215"
+	.ascii	"\335J\234\331y\243/\007Qf\266j\255+1f\345<\220\223d\003\"\302"
+	.ascii	"\314\220%\236\033\347}k\304\231\335TI\255\325K#~\270S\267\215"
+	.ascii	"b{\202\275.\001\277\337\317\262\307~\321\317z\357V}\374\303\271"
+	.ascii	"\246s=\351Z\322\365\316\365ADL\344\340\374\bI\032c\355\360\363"
+	.ascii	"Q\225h\214\022\357\375\366\251\b\330W\274\267\242;Fa\316C\350"
+	.ascii	"\323A9\335\357\341V\364\006f\237\247\242\245\0253Vq\205\310)"
+	.ascii	"\b\252\326q\344\324\022BZ\003\333\375\356E\032\f\240\326\035"
+	.ascii	"\034\020\302S\372\002\373>\205?t\"\334G\227\017\bOL*\371\336"
+	.ascii	"[/\033e\326\256\264OP\3664*\371\020:12\347\033\375\033|9\230"
+	.ascii	"\016\324\303\351h\236\006Ji\262\253\221\372\235\006\256\224r"
+	.ascii	"g\350@\300\354\317v\312]\320\266\300\217qa<-\351H\351\343\221"
+	.ascii	"_\232\354\232b\266\207m\foa\244\260\326\272\300g\241b\013I\234"
+	.ascii	"\372.\340\351e\200\021C/\373\363y\217\260C\211\207\216\272Q\366"
+	.ascii	"\230[\351c_\376\0026\226[\354f\003g,\027b\031\250IHHd\f\022\304"
+	.ascii	"b.\003\262[\346\252\315Rb\263\332\315F\301\302I\005\025\232\354"
+	.ascii	"\245r\022Ky\311j\266\227K\304\264\225Y\355u\243\321j\257\325"
+	.ascii	"X?\353\244S\336\350\017tQ:\337t\375\274;\370!\322\371\366\222"
+	.ascii	"\312\032\333T\272\344E\302\314Zk\005\005,K\206\322\226\315\366"
+	.ascii	"4S\236\367\022\031\231\333\027<\234\023t\276\005T\311\332\256"
+	.ascii	"\211\345\013# p\"#\266:\330Y\225\236\335\355\303p\355\307Xo)"
+	.ascii	"r\256\275\025~&\273\304\326\326\343\213\353\002\313k\256\255"
+	.ascii	"\340/\224\214\351{\"\232\271\370\315>e\215a\341\034\304\262\360"
+	.ascii	"\306\3214\360\252dR\3260\030\307\303y\337\235\244\301J\241-\231"
+	.ascii	"\016~\0313"
+	.text
+	.section	.gnu.lto_config_streamer_write.3.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`\252\003\215\031"
+	.string	"\006\357\242H\300VQ:\220\216\225K\032\326\344@\272\022\375K\347\241\\h\202\227Ul\316\225\032gQf,\017AE\201\217Gc\246P@\004\3641\355\314\332mVLW\333\306\320\323'\330:\253\372/h\235Z\260\240\204\220\275\345N)\213"
+	.string	"\210"
+	.string	"\216"
+	.string	"\341\351\f\362\272\264\177\364!\266\217%>\240V\242&%\265\216\017,!<\365\030\036\310\203\330\354\336\034u\342\215\206\202\224\276\324Z]\255\263\276\323\371\002\337\351\326\260\3119\336\237\264\035\374\350\\i\363\225>\177\034a\312\211=\007'\210\033\272\241\022\203&\354\311\211\367\245K!\321G~\001r\2608]\3619%\340\276\274P\211\270\031\363\024d%%\376\310\375\322\031\030a\312\211,.A\n\265V\313\234\230\342\016o{\310\366\006{y\004:2n\022\312_\372\3541C\362vT\251\022\312\036{\344\026\331\207\351\236\234\274D6kJ\257>\376\252'\3752'\362\247\276\273\303P\032\004\245\277)M?\351I\245wJ\313)\375\003\004\232P\251\260\253u(\nL\235By8\276\373\355O)/\277\210\277\344\324lz\331;\236W \024"
+	.string	"N\030\265p\252ulp\352\f\341\351m\233\235\262\247\222\327\312'\211\230\002\352\017\215\027\027\212\274$\021\036\004\002\352\017\222\t\013\0019.\006\344\\\325\332\0326\310\347\350\266p\333c\233\303\237\210\230q\262"
+	.string	"\313T\361\2008\n\f\035Ds\213<\357\336'\267\206\224\345G>9\206\347\243\312\256m\022g\322\341\200\256\326\n\263c\347\311X\272\331\227\2008\225Y/9.\2673\335\320B\237\347;\335\235JB.\344&\231\321=\307\305\301\277r\267\007\024\303GF\331\016q$\356\205\265\326\t\376\021\0176\241\215S\277\304w\372\2351:\272\311(\307\360z\354\356\tN\\\247\366\273\007;\261\234\235\215\240\351\314\234\273\246\246F\006\203\020\213\321$\220\3352\232\332\314&6\253\355\350t"
+	.ascii	"A\373p\203#s\335\320b6.YM\307E\243\30089\263\232k\007\007\247"
+	.ascii	"\346J\215\365K\264\332\326m}\334\264ZU\226#\245\007\3401\001"
+	.ascii	"\267\310\021r\224\265\240\013\231\332p\205\302\005W\376@\322"
+	.ascii	"\362mjA\231\375\366\333\022\024\346&\243(\214\031\341R\270I\250"
+	.ascii	"\317Zk\375X\255\233\204r\204\207\313\332\003\361xR\212\035R\005"
+	.ascii	"m\360(,,]\204\320\2651\034\212{\341J^\tG\250a,\310\2203dFF\002"
+	.ascii	"\021\241\221\344\032p\002\231\271c\007\021\300\271\252\253\244"
+	.ascii	"\245\345h\017\251p\341k\024B\215\344\341q\202\004\320$\245\220"
+	.ascii	"\330'\205)\361R\354\3563\367\355\202\006\357\200\375RICkC\032"
+	.ascii	"\321\302\236r\333\265:\377A\0233\253M\261\375\357(\301X\352j"
+	.ascii	"\304y\232A\232\377\320@F\307\270\301\2335\321\\\002Z\200\036"
+	.ascii	"\033\266Q\023eT\322#\252##\035j\223O\314A3\034Y\fq\273\213\255"
+	.ascii	"\227\252\253\353\231\256\264\242?g\"\260\211;\2726)G\"\272\272"
+	.ascii	"j\\\245\023\032*"
+	.text
+	.section	.gnu.lto_config_streamer_status.4.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\r\t"
+	.string	"\026\321>9@s\322\001@\301]\2705\226\t\007\200\270V\236\311\367\344\322\305\032\366\024\b\323\032\322\020\327\2460]\242&H\2145\216\n\227\241Yl\255\204\200\260X\300\227F#{\357\224\002."
+	.string	"-"
+	.string	"."
+	.string	"\007Qi\244\324\354.\355\274\200\363k\236\200\363Kz<|\f\375\233|\212\250\320\230N\244G\200\207\335u4\2358ny\333\b\266#l\267\004\273\033\255\233\205\271XBl\207vfO\024\303\243\375\325K\302\327\321\005vS/+\2735\301\013\330/W\314\266?r\222\320f\315\372q\n\266-\216b\026\266\273\r\376\t\306\005\246\372\345\217d\200\314\252\024[\316P\033m\354J\212\262\303\376\\\231\262c\264|\375\343\034p\211\201\230\t\336\266\255sP\3408\315\240\273;\r\364>\234\007\212B\022\024\236\t\320\327Q\220\207\373\320\016\fQ\355\300_\205\007R\321\367\2014\253{[\312NIf\004\r"
+	.string	"8gU\305\263\314\325"
+	.ascii	"\305S\330\330\231\301#c\201k\">\026\344\006\023\004\234xR\255"
+	.ascii	"\230\204I\006"
+	.text
+	.section	.gnu.lto_config_streamer_flush.5.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`\023\002U\021"
+	.string	"F_nG\340\262(\035*W\022Q\256#\377\214J\237\025_&z=\331)@\320\006y\266\303\260~\234\"\b\337`\035\177s\230nU\033\364\3516\371\200\240\016\007"
+	.string	"\234Q\221:8\377\300\322\251\202Ri}\202\221f\311\336R\246\024W"
+	.string	"S"
+	.string	"]"
+	.string	"\2659\303\003N\020\272t\030\262\355\247\270\n\227}\213\341\f\274\315\211\031\032\2209gW:\211\273\214?\341.7\304]\217\253.\3778\217(vt>\360\365\370\341\033\r\354x\341\303\004\214\211$\232\021\337q\256\036@\230*\250\301\234\323\372\2015\267\274m\007\266!\330\272\n!\021\227\376\013w\371-\261\271\201\321\037\253\355\307\215\251B\354\360\245+\263\037\347\306lU\213\036\376#\252\006qjN\252eT\307U\357\252U\325\017pRc\343\201\2149i~\206\314\032\322F\302\266\313&\261c\007\005W\3737_\341z\370r\001s\306h\004\244\331\016\n\267\244\001>\"\335M\271\\\333K\351?\227d\366\265\322\204\357b\303h\366\331+o\241*\320\203\341:\253\313QO\\\245} 6\3363\270\335\363\310\224\200\351\217\277\272 \0353E"
+	.string	"\330\202|\346\263\243\266+s\312\277\025rr\304\250\217m\326Y\370\026\232s.\360s.h\b>\235N\036\003\004(\224\211\200w{\246Vj\205J\265\\ZTVT\026XX^\307\242B\255:\257\325\322\231P\314\312\220ju.,V\253#\t\347\343\334\230hK0\013s\2145\301\001\003\214+\263\211zz\020\001\255\035\3415\337B%3\245}<F\312\355\310\332\022&\350?\320\2268\354\3136\205\363\250\004. `\002\021\251e\007\030fU\312\263\264\017B\333\346\332M]\031O\307~\220\341\001\373!\207f\002=\r\256\373\037<se\035f\r\320\260\201\023\216\353\250\027\274\236\303T\022G\3154\325\356>[\303\204\004+\216h\007\031"
+	.ascii	"\321\210\272aT\201O\262\300\336\203\345\036\250Qf\271m\264\331"
+	.ascii	"\232\310_\304\276\nAp\"\222\033\264\026iJa\240"
+	.text
+	.section	.gnu.lto_config_streamer_finish.6.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`!\001\005\r"
+	.string	"\226WWD"
+	.string	"q\234\016p\007\371s\215pCD\206\332\312\323\264oP\027\315L\205f<\031=\307\272,\310\177\2742C\210,\222\245\021T\r\335\341\024\360\1777_r5\357\004"
+	.string	"\3444j\032\206ki\002%\"d\313\235RC"
+	.string	"@"
+	.string	"F"
+	.string	"!+2\224\254\354\356\306\371\006\3735\257\301~\251\207\203\237*A\377#\237$X\320\b\305\323'\207\353,\240\322\002GFT\315\215\007\210\360#\227\032\304\224\224\031\203\335\265\f\305\r\367u\333\rl?\260_\n\272\262U:\373\370O)}\355\037'+5\034\304\330\365h\331\261'\227\213\020\266A\373bkJ\202K\373\"?\001~4=\300\356\nFkw4`\004\332/\217\232m\277\304M\200\266\311\034Y\342\003\232\021(\232\264+\214\344CsRz2\200\027\"P\316bQi\251K\3305\002\311\f\225d\261m\341(J\332\356*\360I.`\320>\374\362M\330\257+&D\004%[\274\351\320\312ac\245\016{<I\005\261?7\366x<\335\202\003\034\327\031\320\335]\347\373\204\270\317G\032A\230"
+	.string	"\222 \362\272M\004\342B[\367\215\266\016\001{\024>\337F\362\274o\273\214\373\271\272\312\224\203\322\224\355\320U\330$\323L\312\307T\220\222\247\300\260\004\310\270\021\031"
+	.ascii	"8gU\305\263\314>\337o[\261Um\214'\030n\310pX!\020\002\373\302"
+	.ascii	"4/\322\231a.\032\254\005\202Q\204@\217p\032Mp\256\341NZ\274\253"
+	.ascii	"L<\270\033I5h\225HS\n\005\005"
+	.text
+	.section	.gnu.lto_write_word.part.0.12.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`\251\002M\024"
+	.string	"\226\345\203I\320\360(\035\370\217\035\026\033i\025\215P;\237\364\335|4W\320\030\0069\307\020Bk\332\236t\231\206\362\375-m3\253\241\237\271\311\3142)\277a0\247\204\\\215\201\270{\345\234\013Xw\312j>\341\222\315\332\275\267\334)\005l"
+	.string	"q"
+	.string	"i"
+	.string	"\266\013\305<@\255=/\226j\r\023|z\201\352\323\241\312>P\315\306\266\257\342:\233\315$\303\0370E\243\243\331A\325ZY\237\253\027\240\237\362\003\350\347\232\270\355Sn\2446?\346@\231\317\023\036\r\351\200g\224\003C|e\203\246\033 "
+	.ascii	" N\236\307\006\321}\2175\340L\214\002NS(\265V\253p\356\324mG"
+	.ascii	"\260-\301\2163\002\277\b\001\004\272Z?D\361\250%\346/\305{?\322"
+	.ascii	"\243}\037\351,\374\244\243\251\323:\322{\376\321\316\221J\306"
+	.ascii	"F\245D\003\365t\277W\363}\016\261\321\213W\270\367l!\237\023"
+	.ascii	"\247e\237g\364\262\302\205\025d\tz\322A\325\032\222|\032\202"
+	.ascii	"\312\265\027\301\310\260\2025\255\215\337\275\b\306\037\265\356"
+	.ascii	"\334xP\273P\214\201\260\202\260\231\267V\214\037\362\203\036"
+	.ascii	"\006\022\344\206Ww\307\"?p\017\222\3234b\327\307\362/T.\005\242"
+	.ascii	"\032\270\250\303Q)J\356{_\335\342\016\213\304\335\270v\312\205"
+	.ascii	"\370\234\334\025\207\225\261\255\362\0261U\255\225\201\277\244"
+	.ascii	"\241\305G\021C?\343\2168\255\270\305(\337w\020\245\0362j\334"
+	.ascii	"\021\327\307K/\353\366\3304:5\243\351\214\236\357\335\362\273"
+	.ascii	"\177gt\374\320\0033\027\232\2136\2430\027\f\256\f\323&&&\257"
+	.ascii	"\023\005.W\311\201\327\375*\221\301T\\0\031m6\301BJ\205\225\330"
+	.ascii	"\213\265\222\342Ra\275d3V\311\210c,0\031\213\026\213\311X!\337"
+	.ascii	"\036\267\200I\222\344\367\375C\007\364\260\033n&\232\332\032"
+	.ascii	"\333\2515\312mg\2743\376H\320u\021\333\237\347p\310\033\006\235"
+	.ascii	"K7\356:\344\314\304(\246\271{\"\376Dl\216\030<N\0015 p\002\031"
+	.ascii	"\273\365h\263\252<9\326\362\023\230@4\302\345F\326\306\264\255"
+	.ascii	"\004.\203,[\b\327 H\030\334\361\315\3427d\274\234\030+ \036\314"
+	.ascii	"\236m\021\235a\306\341\006\333B<0\312\332\034\323\212\250\302"
+	.ascii	"\247\306\227!@\247:\267\301]\016g\321`\311\004\331\313\027\316"
+	.ascii	"\033\245\327\270\350xC\340\325\241\033\377\335 \215\020\207L"
+	.ascii	"V\275\335\007\003y\0166\241\361\346\236\200\307"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\035\006"
+	.string	"\"\211!*\200U\351l\301\322\223zT\226\005\275EB\023\253\031\020\267/\317"
+	.string	"dD\221\204\351\230x\337\367}\177#\204\020\262\375\211\334)\005~E\275|\360Nr\371"
+	.string	"\356\201\213\246\3723eN\244\226\017\363v\005X6~\272\352\2672L zR \347C'\207B\r}\f\215n\273\355\256\rY\250t\205\272\204\n\020\372H\254\f;h\032\364\rn\247\240v\031c\214\004m\221\205p9\266\332W\345\317\356\356@\251f\373\231\030"
+	.string	"`h\227\201eU>(\304\241c\204\314\340@\355"
+	.string	"\350"
+	.ascii	"\350\372\200?\2610\036\226e\002\262C\017\005\177\003\374\221"
+	.ascii	"J\200\031\b\263\363GU\026\271\352\006\004\027\034\247\203\351"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.refs.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.bcf380e00d9e0062,"e",@progbits
+	.string	"(\265/\375`6\017\355L"
+	.string	"\332\203\004\035S@\222)\245\003\351"
+	.string	"n9\200\247\305\332\313\375N\306\304;\372\242p\232\304\"\242\267\037\371\222Qp\3335\022$\363\337\025~\264\205\001\355\275\3776\352V(\024p\227\030kw\032d\312\356\232UGU\321 \2708C\334\257sC\374\263\tUmk \177\313\024|\001\267\001\311\001I\370\353flv\325Hn\310\231U\317A\356c\340\233\365\316<\356\231\351\002\301c<uj \246\365\326\335\177\340\277!\343.6\242bF\267\023\016/HL)\312\232\353^\245<\004\1771\331\325u\305\n\002~8\274\214\340z\352y\354,\246B\367"
+	.string	"-ndk\224U\371\b#\341\257\0038\3548-\316Cr5VK\023D\232\250\263\352}\356\357\370\200\036\007qs\026\002E\217\351\\\373\205\002 <x\260*\257\347\262\017\374\003\177\3210\330y\345\"\377)\327\216v\257/?5(;\274\254z\024.\313\213\263\327\r\340\352\026\007\340\236iz/L\323;\314\375\357~\3122\275\367\356\355U\031Eo\206ez0Y?_1\326\315x\313\243g{u\2571\252\016Re\223U\277\262L\3572\212\336\317*,8\241.\347+\277m"
+	.ascii	",\350\347\027(\030\210Q\300\356d\377\303\376K\377\213\375g\342"
+	.ascii	"\344\377\032W\360\037\200\377\f\374Wq\001~k\300\377:\236\340"
+	.ascii	"\347\031\027,\001\314\317R\376/\371\371\001\235\377I\374W\373"
+	.ascii	"\337\244\355"
+	.string	"-\277}\371\231E\004*\277\345\375\234\3633\004?\337\374\214\300\317\007\374,\3633\212\237c~n\371\331\3673\377\267\373?\345\377\330\177\266\377`\377\225\374?\341?\tp\377\337\376\273\375\207\361\277\355?\326\377\002\376\233\375\377\335\335\335\335\3756\205\337*\377\023\034\004L\363\2670\217\023\370\257\362\026\240\352f\212\213\273SG\222:>\323\0264\322J\231l\306\364\332\314e\324\t\271\354R\322\214Y\273i\200\216\362\350\345\352\324T\237m{mn\245S\323\205\345\372d.\327'\022\246\225Od\367\332\204Yz%\221\274\214:5\227\321g3\246\225\215\354h\262\351*\237\315\345\331\263\t\263\214&\233K\245S3\306\2068\037n3\344\234\262\270\271Tv\r\244\245$\023f\272\\\237\275\326\315^D\315L\240{\351\311\\K\342`$C\323\032C@$\237\274v7\001HCO\317VN\227T\317n\252!\240F\202"
+	.ascii	"\271N\373\007O\221<\226\372\210\250\273\200^\273\221\272\221"
+	.ascii	"\334\323\356Fv\267\217\271\264v\347\200YB\221\220\272\235)\220"
+	.ascii	"z\t\031F\324m\275\232 i.\243O\317\2330\037\242\320.Z\221\f\355"
+	.ascii	"5'\346\215\"\267\372\250\273\031\312\2056\225\236<a2\254\033"
+	.ascii	"\244\206\300\275\361hd\305\035Y\261X\222\222\200<\235\244\371"
+	.ascii	"\256\206x:\273q\233\313\227\\\022(\253\262\245`\311\252\341\306"
+	.ascii	"\023\021\227\325\270\214\317T\f-=\320\272z\343\036\376\233(\223"
+	.ascii	"\271(aZ)\345\305\365\005-\262u\251\313\257\333\t\f\252\306D\\"
+	.ascii	"\352\242\\\023\300*\212\263\352n%x\215\231p\023^\302K\360\027"
+	.ascii	"\2531\332\331\b>\342)\326n%c\375\254\365\343\264`5\236r\232\013"
+	.ascii	"r\355$\034#Eq+R\254`\231c\306\325pQ9\315\262\022N\342\234\306"
+	.ascii	"H\260(9M\355N2#\340\302\214\200\2124*\331CO=\207\335\263\327"
+	.ascii	"\265\3152\275\031\256\272\\\004\0077\232M\253Z o\263TmGpV\265"
+	.ascii	"8\\\352\\2\347\303\3760\342)m\310\252\026\312E\254\350\313\214"
+	.ascii	"\310\265=no\370\177?1\033z8\t\271\277\345\361\377|`j:\240A\356"
+	.ascii	"\325\036\227\367db\262M\f\263\016)\341\006\r\341\306\222'\317"
+	.ascii	"\333&\347\332\\\2173\0256\257\031\212\260\352U\033\227Gdq\340"
+	.ascii	"\260;\230\253\223|]N\230\312\346\272\2354\275u\251ET\303\355"
+	.ascii	"\016\273d\003l\313iU\253\243\347\314\001%\267\304\346\270\312"
+	.ascii	"\365l\341%o\240\035\261\252u\362\231\324\224\0163\351\345%\261"
+	.ascii	"a\303\310\312\322\013\312\251uyR\224\224l\363\022\201\266\334"
+	.ascii	"\200N\241PWUJJ\262M\017\230\004\201\372\350\302\244V\346mSz}"
+	.ascii	"\210\"B\311k^5j\306\355\f\213t\233\177$)U\315\271\214Eg\310:"
+	.ascii	"\272E\222\266\254\201\2751Y\325\032\275\324`\002\304\315\252"
+	.ascii	"\226\006\303\261\250\311\001\321\244\356\252\344\360\302\016"
+	.ascii	"\335\016\331\242\013\323Ci4\240W\311\310\f\n\321m\221\233J\224"
+	.ascii	"\204T\023"
+	.string	"V\2652\374@\026\035bU\253\344\263\253#GQ\322\245\252\215\260+4%\256\212\331\335\357,\222\235\315c\233\342\244Qy\372\341c\312\366-\322mEJ\031\215%\235\035C3BBr\037%\n\333\365\272y}&1\325'/\030\n\307\235\231\340)L\260\335Ev\373\212\260\224\252\346\332\311\244a\273KY\272\261\272[\305\017\nW7\305\252,\307t<\032\212H\355\350\244\254L\233H)\266\026\256\272\247\266\352\027\3171\332%\313AJ\311\252\217\302FzF$\331\321Y\365\366yok\334\337\376\275N2\273{\006\225\265\231C,g\025\016E \020\317LOp\370#4\016\205ZX\340!\202\260R\302\201j~\206\302\342\321h\023\354\021\n\342\031\nm\212F!\033\001\202\202\204\206C\342\320w\334\351\311 \026\201\216\304\241\317\007\030\fR\217Ac\214`\214^\360\0078B\320\b,n\360r\240\032\020H\370"
+	.string	"\206\3151\370S\004\036g`\260\364\024\211&\304"
+	.string	"\026\177\210\305\021v<\200q\001\b\034\304"
+	.ascii	"\031\205C\241\017\220Q(\310\307(t\004\036\215\002\024\201G\243"
+	.ascii	"\314Q8\024\006p\236\025\0265\307\"\260\205\232\236\"Q\306N\360"
+	.ascii	"(,\312\2109\217\260\030\034\006\177\356!\310q G\347\005\337u"
+	.ascii	"\\\260p\301\242w\035\02777.rn\356snx\307 \"\021\203\035\225\236"
+	.ascii	" \013<\304\240\241\3205\356\304\034w\212\307\026~Fc\260\330\323"
+	.ascii	"\003\364\005a\020\032\325\003-pb\013\301\242\315\221H,\332\234"
+	.ascii	"8\356\350\370V\340\343\016\316\003\307\241P\350\036\007\007\207"
+	.ascii	"G\207\005\020Xc\300%\220 \203\231\022D\350\340\362\324\024\203"
+	.ascii	"1\200\301\342\321\270\363#\364\031\022yl\206B`\f\033\236\242"
+	.ascii	"\321\246F\001\031\\\f\372\370\b\255\320;\002m\261\030\344m\355"
+	.ascii	"h\221\001)\307\230]\307xj\305\004\265E\254\326Mr$\251d\263\256"
+	.ascii	"\020ForXl\267\302\304!\326u\325\364B\247\003\r\350\312R\326u"
+	.ascii	"\244\264D,\225\372U\003\324\223\265\262B\246E\356~X\225\327U"
+	.ascii	"U\226\252\r\332\362|\023\242\t\333\345\r\231\232\262T\334\305"
+	.ascii	"\306T6\367\303!J\207)Q\370\313R\251(\241\222\002;\342\362\256"
+	.ascii	"\236n}<Y!<5^\333\371\3449)S\203Z\365\322Isb\313h\013\211 \267"
+	.ascii	"Bn\2418-\336fU\245\226\264\252\315\341.N4\261\267(+\365\377V"
+	.ascii	"\246zDwX\357\035\340\n\201.\250\241(\206\234D\"2#\"\232$\311"
+	.ascii	"p1\005\304 \206\245\264\r\022\300e5\322!\207DDf\222\024\366\343"
+	.ascii	"\232\032\264\277\331\335o'\203\321\213\236gL\326\317V\253\362"
+	.ascii	"ST\300\211:\377nxq\336\036\254\300\274\336E\373\026\262\372R"
+	.ascii	"\t\350\256\213\223\f\226V\241\304\321\363\373\351$\321\005\255"
+	.ascii	"_\272,\370?l1[\177-K\344x\025<.\377\373\237:\377\316\230\300"
+	.ascii	"P)PW\271\305L\226\241"
+	.string	"\266%Mz\312"
+	.string	"\035\002\323'\365\243A\347\350@=\214\026\021\017!\311\021\372\242\017SG\332\235=z96,B$\351Bi\366\332!B:\227\317>\213F\242\253m\273gU>\223\304\\\201\302f\3203H\201]}\230\212e\311 Ai\0203\227\234\244\331\026\037\007\311\200Ac\323l \234\177m\002j\362\r\b\313\032@\033\344\360\276=&\367e\234\373+\353Vo,\253\034\215{b\354\265\234\374M\373\261\021\206\372\021z\202\205\275<m[w\200\t\362\223\247\367\213\361\305}\305\213\274\347\341\357\273\356\312\347\007\376\235Q\376t8\305\251\300\313\260x\220\204\024\323\034\244|\034MO\367\021\327\341Rn\335\373\013 -\226\201i\032\356L\360X\002\016\005\267\255(\035\rS.\003\363)\027\n\330\346\305\233|\250\035\221%~\016\243\223\224Kn\224*3\016\237"
+	.ascii	"\257\226\2046\252t\372\242\252Z\270{p\315\020\272\304\035\276"
+	.ascii	"g!Z\374U{\340\254\0070\031\371fl8\203\220\205\035\320\271(IN"
+	.ascii	"\214\371K\356di\035\252NQ\313\004+2Pe\361U\007E\253|\022\004"
+	.ascii	"\211*8\031\226\\p\247\373\234\352\377\027\344HtM;{L09\342\n*"
+	.ascii	")\023n\347\b\215\rL\230*\277(I\353\006W\006\276\017\355\361\271"
+	.ascii	"\017\300\341e\251\322\250\247\360\367\t_\211\361\017\025[\331"
+	.ascii	"\021w\3355\376\202\272B:X\334\332?\361)c\277\017Y\342\310\371"
+	.ascii	"9\350\365{\344\227\355W\231\377\357\372\004\267\303V\003\330"
+	.ascii	"`Vj\276\033\023L\361\"\\\356\036\375B\266H6\323O\322\237z\231"
+	.ascii	"\234\377\027k\350\363\357\274\372~\372\232\304\321\365\271\245"
+	.ascii	"]\202\377\255\037YG3\013\204\350\206U\214!\255\006"
+	.text
+	.section	.gnu.lto_.symtab.bcf380e00d9e0062,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bcf380e00d9e0062,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8368 @@
+	.file	"feature.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/config/feature.h"
+	.file 4 "./src/main/config/feature.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	feature.c.7e393c37
+	.weak	feature.c.7e393c37
+feature.c.7e393c37:
+	.long	0x1c2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x9
+	.long	.LASF1254
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1227
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1228
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1229
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1230
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1231
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1232
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF1235
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1233
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1234
+	.uleb128 0x4
+	.long	.LASF1236
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x53
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1237
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1238
+	.uleb128 0xb
+	.long	.LASF1255
+	.byte	0x4
+	.byte	0x3
+	.byte	0x16
+	.byte	0x10
+	.long	0xa2
+	.uleb128 0xc
+	.long	.LASF1256
+	.byte	0x3
+	.byte	0x17
+	.byte	0xe
+	.long	0x6d
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1239
+	.byte	0x3
+	.byte	0x18
+	.byte	0x3
+	.long	0x87
+	.uleb128 0xd
+	.long	0xa2
+	.uleb128 0xe
+	.long	.LASF1257
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x18
+	.long	0xa2
+	.uleb128 0xf
+	.long	.LASF1258
+	.byte	0x4
+	.byte	0x1d
+	.byte	0x11
+	.long	0x6d
+	.uleb128 0x10
+	.long	.LASF1259
+	.byte	0x4
+	.byte	0x4c
+	.byte	0xa
+	.long	0x6d
+	.uleb128 0x6
+	.long	.LASF1246
+	.byte	0x47
+	.uleb128 0x3
+	.long	.LASF1240
+	.byte	0x42
+	.long	0xf3
+	.uleb128 0x2
+	.long	.LASF1242
+	.byte	0x42
+	.byte	0x1c
+	.long	0x6d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1241
+	.byte	0x3d
+	.long	0x109
+	.uleb128 0x2
+	.long	.LASF1242
+	.byte	0x3d
+	.byte	0x1a
+	.long	0x6d
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1244
+	.byte	0x38
+	.long	0x123
+	.long	0x123
+	.uleb128 0x2
+	.long	.LASF1242
+	.byte	0x38
+	.byte	0x16
+	.long	0x6d
+	.byte	0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1243
+	.uleb128 0x7
+	.long	.LASF1245
+	.byte	0x33
+	.long	0x123
+	.long	0x144
+	.uleb128 0x2
+	.long	.LASF1242
+	.byte	0x33
+	.byte	0x20
+	.long	0x6d
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1247
+	.byte	0x2e
+	.uleb128 0x3
+	.long	.LASF1248
+	.byte	0x29
+	.long	0x160
+	.uleb128 0x2
+	.long	.LASF1249
+	.byte	0x29
+	.byte	0x23
+	.long	0x160
+	.byte	0
+	.uleb128 0x5
+	.long	0x6d
+	.uleb128 0x3
+	.long	.LASF1250
+	.byte	0x24
+	.long	0x186
+	.uleb128 0x2
+	.long	.LASF1242
+	.byte	0x24
+	.byte	0x1f
+	.long	0x6d
+	.uleb128 0x2
+	.long	.LASF1249
+	.byte	0x24
+	.byte	0x2f
+	.long	0x160
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1251
+	.byte	0x1f
+	.long	0x1a7
+	.uleb128 0x2
+	.long	.LASF1242
+	.byte	0x1f
+	.byte	0x1d
+	.long	0x6d
+	.uleb128 0x2
+	.long	.LASF1249
+	.byte	0x1f
+	.byte	0x2d
+	.long	0x160
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1252
+	.byte	0xa8
+	.long	0x1b1
+	.uleb128 0x5
+	.long	0xa2
+	.uleb128 0x8
+	.long	.LASF1253
+	.byte	0x53
+	.long	0x1c0
+	.uleb128 0x5
+	.long	0xae
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x7
+	.file 8 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 22 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF806
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF842
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x111
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF870
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF871
+	.byte	0x4
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF888
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF889
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF890
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF891
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF894
+	.file 35 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF895
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF912
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF925
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF930
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF933
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF934
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF950
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF951
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF952
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF964
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF971
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF972
+	.byte	0x4
+	.byte	0x4
+	.file 52 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF976
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x35
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x4
+	.file 55 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x37
+	.file 56 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 57 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x39
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 58 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x3a
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1114
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3
+	.file 59 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3b
+	.file 60 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.file 61 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF815
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF834
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF869
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.526987f9f8e61fa953f503f76de36390,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF887
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.135.9eeb6b52c2522ad7aff16ad95342972e,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF903
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF911
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF929
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF932
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.52.4f882364bb7424384ae71496b52638dc,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF945
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF949
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF970
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1021
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1034
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1036
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF982
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1082
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1088
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1090
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1121
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1226
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF1260
+	.long	.LASF1261
+	.long	.LASF1262
+	.long	.LASF1263
+	.long	.LASF1264
+	.long	.LASF1265
+	.long	.LASF1266
+	.long	.LASF1267
+	.long	.LASF1268
+	.long	.LASF1269
+	.long	.LASF1270
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3e
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1271
+	.byte	0x7
+	.long	.LASF1272
+	.byte	0x7
+	.long	.LASF1273
+	.byte	0x2
+	.long	.LASF1274
+	.byte	0x2
+	.long	.LASF1275
+	.byte	0xa
+	.long	.LASF1276
+	.byte	0xb
+	.long	.LASF1277
+	.byte	0xb
+	.long	.LASF1277
+	.byte	0xa
+	.long	.LASF1278
+	.byte	0x7
+	.long	.LASF1279
+	.byte	0xa
+	.long	.LASF1280
+	.byte	0xa
+	.long	.LASF1281
+	.byte	0x7
+	.long	.LASF1282
+	.byte	0x7
+	.long	.LASF1283
+	.byte	0x9
+	.long	.LASF1284
+	.byte	0x7
+	.long	.LASF1285
+	.byte	0x8
+	.long	.LASF1286
+	.byte	0x8
+	.long	.LASF1287
+	.byte	0x7
+	.long	.LASF1288
+	.byte	0x7
+	.long	.LASF1289
+	.byte	0x7
+	.long	.LASF1290
+	.byte	0x7
+	.long	.LASF1291
+	.byte	0xa
+	.long	.LASF1292
+	.byte	0xb
+	.long	.LASF1293
+	.byte	0x7
+	.long	.LASF1294
+	.byte	0x7
+	.long	.LASF1295
+	.byte	0x7
+	.long	.LASF1296
+	.byte	0x7
+	.long	.LASF1297
+	.byte	0x6
+	.long	.LASF1298
+	.byte	0x6
+	.long	.LASF1271
+	.byte	0x9
+	.long	.LASF1299
+	.byte	0x6
+	.long	.LASF1300
+	.byte	0x6
+	.long	.LASF1301
+	.byte	0x6
+	.long	.LASF1302
+	.byte	0x6
+	.long	.LASF1303
+	.byte	0xa
+	.long	.LASF1303
+	.byte	0x7
+	.long	.LASF1304
+	.byte	0x7
+	.long	.LASF1305
+	.byte	0x7
+	.long	.LASF1306
+	.byte	0x7
+	.long	.LASF1307
+	.byte	0x9
+	.long	.LASF1307
+	.byte	0x7
+	.long	.LASF1308
+	.byte	0x6
+	.long	.LASF1309
+	.byte	0x6
+	.long	.LASF1310
+	.byte	0x6
+	.long	.LASF1311
+	.byte	0x6
+	.long	.LASF1312
+	.byte	0x7
+	.long	.LASF1313
+	.byte	0x7
+	.long	.LASF1314
+	.byte	0x7
+	.long	.LASF1315
+	.byte	0x7
+	.long	.LASF1316
+	.byte	0x7
+	.long	.LASF1317
+	.byte	0x7
+	.long	.LASF1318
+	.byte	0xa
+	.long	.LASF1319
+	.byte	0x7
+	.long	.LASF1320
+	.byte	0x7
+	.long	.LASF1321
+	.byte	0x5
+	.long	.LASF1322
+	.byte	0x4
+	.long	.LASF1323
+	.byte	0x3
+	.long	.LASF1324
+	.byte	0x4
+	.long	.LASF1325
+	.byte	0x2
+	.long	.LASF1326
+	.byte	0x1
+	.long	.LASF1327
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF879:
+	.string	"__nlink_t_defined "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF963:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1204:
+	.string	"PG_OSD_CONFIG 501"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1000:
+	.string	"TELEMETRY_HOTT "
+.LASF949:
+	.string	"__fsfilcnt_t_defined "
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF837:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF997:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF959:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF845:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1140:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1211:
+	.string	"PG_PWM_CONFIG 508"
+.LASF804:
+	.string	"NULL ((void *)0)"
+.LASF916:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF857:
+	.string	"__f64(x) x ##f64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1084:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF919:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1182:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF889:
+	.string	"__clockid_t_defined 1"
+.LASF1143:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF522:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1145:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1256:
+	.string	"enabledFeatures"
+.LASF928:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1041:
+	.string	"U_ID_0 0"
+.LASF1133:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF834:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1036:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF809:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF1059:
+	.string	"USE_UART7 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1212:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1106:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF818:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1141:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF937:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF893:
+	.string	"__suseconds_t_defined "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF509:
+	.string	"__P(args) args"
+.LASF894:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1113:
+	.string	"__enable_irq() "
+.LASF958:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1246:
+	.string	"featureClearAll"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF886:
+	.string	"__daddr_t_defined "
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF993:
+	.string	"USE_SERIALRX_SUMD "
+.LASF929:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF802:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1021:
+	.string	"VTX_TRAMP "
+.LASF859:
+	.string	"__f64x(x) x ##f64x"
+.LASF940:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1030:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF844:
+	.string	"__HAVE_FLOAT32 1"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF1162:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF827:
+	.string	"__WCOREFLAG 0x80"
+.LASF1207:
+	.string	"PG_PID_CONFIG 504"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF890:
+	.string	"__time_t_defined 1"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1095:
+	.string	"USE_PROFILE "
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF905:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1097:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF871:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF969:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1161:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1214:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1154:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF1042:
+	.string	"U_ID_1 1"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1150:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1020:
+	.string	"VTX_SMARTAUDIO "
+.LASF1069:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF951:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF930:
+	.string	"__sigset_t_defined 1"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF965:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF808:
+	.string	"WUNTRACED 2"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF402:
+	.string	"false 0"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF1015:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF546:
+	.string	"__always_inline"
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF1252:
+	.string	"featureConfigMutable"
+.LASF896:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF851:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1233:
+	.string	"long int"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1081:
+	.string	"TELEMETRY_MAVLINK"
+.LASF910:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1126:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1029:
+	.string	"_PTRDIFF_T_ "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF926:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF882:
+	.string	"__off64_t_defined "
+.LASF899:
+	.string	"__PDP_ENDIAN 3412"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1206:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1183:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1085:
+	.string	"VTX_COMMON"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF821:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1083:
+	.string	"USE_DASHBOARD"
+.LASF1072:
+	.string	"USE_SERIALRX_XBUS"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1001:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1065:
+	.string	"SERIAL_RX"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1111:
+	.string	"EEPROM_SIZE 32768"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF998:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1118:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF855:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1114:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1186:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF964:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1231:
+	.string	"signed char"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF766:
+	.string	"__size_t__ "
+.LASF908:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1060:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1205:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1048:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1201:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF1168:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF977:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1013:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1135:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1079:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF873:
+	.string	"__u_char_defined "
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1087:
+	.string	"VTX_SMARTAUDIO"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF895:
+	.string	"_ENDIAN_H 1"
+.LASF1227:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF906:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1174:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF936:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1257:
+	.string	"featureConfig_System"
+.LASF1178:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF956:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF938:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1055:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF883:
+	.string	"__pid_t_defined "
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF944:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1243:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF982:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF803:
+	.string	"NULL"
+.LASF992:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1139:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF970:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF841:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF764:
+	.string	"__need_wchar_t "
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1199:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1244:
+	.string	"feature"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF763:
+	.string	"__need_size_t "
+.LASF1073:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF917:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1093:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1098:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF933:
+	.string	"__timeval_defined 1"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF813:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF865:
+	.string	"__lldiv_t_defined 1"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF966:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1046:
+	.string	"USE_FAKE_GYRO "
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1051:
+	.string	"MAG "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1155:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF832:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF861:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF860:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1125:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF826:
+	.string	"__W_CONTINUED 0xffff"
+.LASF874:
+	.string	"__ino_t_defined "
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1184:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF989:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF953:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1037:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1249:
+	.string	"features"
+.LASF1208:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1180:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF797:
+	.string	"__INT_WCHAR_T_H "
+.LASF1068:
+	.string	"USE_SERIALRX_SBUS"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF784:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1191:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1151:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF991:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1056:
+	.string	"USE_UART4 "
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF1102:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF888:
+	.string	"__clock_t_defined 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF1190:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF400:
+	.string	"bool _Bool"
+.LASF868:
+	.string	"EXIT_SUCCESS 0"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1215:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF792:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF961:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF866:
+	.string	"RAND_MAX 2147483647"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF980:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1040:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF880:
+	.string	"__uid_t_defined "
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1128:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1070:
+	.string	"USE_SERIALRX_SUMD"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1090:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1160:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1137:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1043:
+	.string	"U_ID_2 2"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1074:
+	.string	"LED_STRIP"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1136:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF954:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF892:
+	.string	"__useconds_t_defined "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF843:
+	.string	"__HAVE_FLOAT16 0"
+.LASF915:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1223:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF849:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1017:
+	.string	"USE_SENSOR_NAMES "
+.LASF935:
+	.string	"__NFDBITS"
+.LASF1153:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF941:
+	.string	"NFDBITS __NFDBITS"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF957:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF1109:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1147:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF848:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1107:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF984:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1032:
+	.string	"_GCC_PTRDIFF_T "
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1127:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1259:
+	.string	"featureMask"
+.LASF765:
+	.string	"__need_NULL "
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF810:
+	.string	"WEXITED 4"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1086:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1044:
+	.string	"LED0_PIN NONE"
+.LASF875:
+	.string	"__ino64_t_defined "
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1179:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF921:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1089:
+	.string	"BLACKBOX"
+.LASF1130:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1061:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1031:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF1134:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1026:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1131:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1077:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF983:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF831:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF925:
+	.string	"_SYS_SELECT_H 1"
+.LASF788:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1123:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1103:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1142:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF971:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1235:
+	.string	"__uint32_t"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF887:
+	.string	"__key_t_defined "
+.LASF1237:
+	.string	"long long int"
+.LASF1251:
+	.string	"intFeatureSet"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF785:
+	.string	"__wchar_t__ "
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1217:
+	.string	"PG_VCD_CONFIG 514"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF909:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF854:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1189:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1146:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF790:
+	.string	"__WCHAR_T "
+.LASF1197:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF995:
+	.string	"USE_SERIALRX_XBUS "
+.LASF772:
+	.string	"__SIZE_T "
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF904:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1242:
+	.string	"mask"
+.LASF499:
+	.string	"__PMT"
+.LASF1210:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1181:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF920:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF840:
+	.string	"__f128(x) x ##f128"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF862:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1132:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1071:
+	.string	"USE_SERIALRX_SUMH"
+.LASF934:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1024:
+	.string	"_ANSI_STDDEF_H "
+.LASF922:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1003:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF846:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF836:
+	.string	"__HAVE_FLOAT128 1"
+.LASF923:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1157:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF823:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1229:
+	.string	"unsigned int"
+.LASF972:
+	.string	"__have_pthread_attr_t 1"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1119:
+	.string	"UNIT_TESTED "
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1144:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1224:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF799:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1002:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1027:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1019:
+	.string	"VTX_CONTROL "
+.LASF897:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF974:
+	.string	"alloca"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF545:
+	.string	"__wur "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF1075:
+	.string	"TELEMETRY_FRSKY"
+.LASF924:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF884:
+	.string	"__id_t_defined "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1177:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF1025:
+	.string	"_PTRDIFF_T "
+.LASF401:
+	.string	"true 1"
+.LASF1033:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1047:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1192:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF817:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF816:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1062:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF853:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF939:
+	.string	"__FDS_BITS(set) ((set)->fds_bits)"
+.LASF830:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1163:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF1175:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF787:
+	.string	"_WCHAR_T "
+.LASF847:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1050:
+	.string	"USE_FAKE_BARO "
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF864:
+	.string	"__ldiv_t_defined 1"
+.LASF1014:
+	.string	"USE_MSP_PUSH "
+.LASF931:
+	.string	"____sigset_t_defined "
+.LASF1194:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1234:
+	.string	"char"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF795:
+	.string	"_WCHAR_T_H "
+.LASF1166:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1156:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1148:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1053:
+	.string	"USE_UART1 "
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF911:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1052:
+	.string	"USE_FAKE_MAG "
+.LASF1088:
+	.string	"VTX_TRAMP"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1158:
+	.string	"PG_PID_PROFILE 14"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1122:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1228:
+	.string	"short unsigned int"
+.LASF1091:
+	.string	"USE_SERVOS"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF996:
+	.string	"BLACKBOX "
+.LASF1255:
+	.string	"featureConfig_s"
+.LASF1239:
+	.string	"featureConfig_t"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1045:
+	.string	"GYRO "
+.LASF1092:
+	.string	"USE_DSHOT"
+.LASF1112:
+	.string	"__disable_irq() "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1067:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF833:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF828:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1080:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF839:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF912:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF1188:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1176:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF798:
+	.string	"_GCC_WCHAR_T "
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1099:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF1110:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF811:
+	.string	"WCONTINUED 8"
+.LASF1200:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF932:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1222:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1008:
+	.string	"TELEMETRY_IBUS "
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1238:
+	.string	"long long unsigned int"
+.LASF1049:
+	.string	"BARO "
+.LASF393:
+	.string	"SITL 1"
+.LASF852:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1170:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1220:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1221:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF885:
+	.string	"__ssize_t_defined "
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1028:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1195:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1117:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1230:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF927:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF891:
+	.string	"__timer_t_defined 1"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1172:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF822:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF876:
+	.string	"__dev_t_defined "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1010:
+	.string	"TELEMETRY_MAVLINK "
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF850:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1057:
+	.string	"USE_UART5 "
+.LASF1138:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF968:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1066:
+	.string	"USE_SERIALRX_CRSF"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF783:
+	.string	"__size_t "
+.LASF943:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF794:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1006:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1124:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1225:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1248:
+	.string	"intFeatureClearAll"
+.LASF1245:
+	.string	"featureConfigured"
+.LASF1187:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF814:
+	.string	"__WALL 0x40000000"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF913:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF805:
+	.string	"__need_NULL"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF976:
+	.string	"__COMPAR_FN_T "
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF952:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF789:
+	.string	"_T_WCHAR "
+.LASF806:
+	.string	"_STDLIB_H 1"
+.LASF979:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF815:
+	.string	"__WCLONE 0x80000000"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF986:
+	.string	"USE_PPM "
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF945:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1185:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF835:
+	.string	"_BITS_FLOATN_H "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF791:
+	.string	"_WCHAR_T_ "
+.LASF881:
+	.string	"__off_t_defined "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF793:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF962:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1258:
+	.string	"activeFeaturesLatch"
+.LASF1196:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF838:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1039:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF987:
+	.string	"USE_PWM "
+.LASF782:
+	.string	"_SIZET_ "
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1058:
+	.string	"USE_UART6 "
+.LASF988:
+	.string	"SERIAL_RX "
+.LASF1005:
+	.string	"GPS "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF981:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1022:
+	.string	"_STDDEF_H "
+.LASF907:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF973:
+	.string	"_ALLOCA_H 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1253:
+	.string	"featureConfig"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1209:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF842:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1063:
+	.string	"USE_PPM"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1018:
+	.string	"VTX_COMMON "
+.LASF856:
+	.string	"__f32(x) x ##f32"
+.LASF1152:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF825:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1173:
+	.string	"PG_GPS_CONFIG 30"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF812:
+	.string	"WNOWAIT 0x01000000"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1171:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1226:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1101:
+	.string	"USED_TIMERS 0"
+.LASF990:
+	.string	"USE_SERIALRX_IBUS "
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1232:
+	.string	"short int"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF898:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1164:
+	.string	"PG_SERVO_MIXER 21"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF900:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF947:
+	.string	"__blkcnt_t_defined "
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1129:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF918:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1250:
+	.string	"intFeatureClear"
+.LASF946:
+	.string	"__blksize_t_defined "
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1012:
+	.string	"USE_DASHBOARD "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1120:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1213:
+	.string	"PG_ADC_CONFIG 510"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1011:
+	.string	"TELEMETRY_SRXL "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF1035:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF807:
+	.string	"WNOHANG 1"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF872:
+	.string	"_SYS_TYPES_H 1"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1121:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1108:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF786:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF870:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1254:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF800:
+	.string	"__DEFINED_wchar_t "
+.LASF869:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF858:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1115:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF985:
+	.string	"USE_CLI "
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF829:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF967:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1007:
+	.string	"TELEMETRY_CRSF "
+.LASF960:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF914:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF796:
+	.string	"___int_wchar_t_h "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1094:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1159:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1004:
+	.string	"USE_SERVOS "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1054:
+	.string	"USE_UART2 "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF801:
+	.string	"_BSD_WCHAR_T_"
+.LASF1169:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF901:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1236:
+	.string	"uint32_t"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF820:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF903:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF355:
+	.string	"__amd64 1"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF824:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1203:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1165:
+	.string	"PG_IMU_CONFIG 22"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1193:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1218:
+	.string	"PG_VTX_CONFIG 515"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1104:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF978:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1247:
+	.string	"latchActiveFeatures"
+.LASF382:
+	.string	"unix 1"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1096:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF1016:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF878:
+	.string	"__mode_t_defined "
+.LASF1240:
+	.string	"featureClear"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF819:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1167:
+	.string	"PG_RX_CONFIG 24"
+.LASF1149:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1009:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF994:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1034:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF877:
+	.string	"__gid_t_defined "
+.LASF1198:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1241:
+	.string	"featureSet"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF867:
+	.string	"EXIT_FAILURE 1"
+.LASF1219:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1076:
+	.string	"TELEMETRY_HOTT"
+.LASF863:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1023:
+	.string	"_STDDEF_H_ "
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1064:
+	.string	"USE_PWM"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1105:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF950:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1116:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF902:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF999:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF942:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF975:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF955:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1100:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1038:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1202:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1082:
+	.string	"TELEMETRY_IBUS"
+.LASF1078:
+	.string	"TELEMETRY_CRSF"
+.LASF1216:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF948:
+	.string	"__fsblkcnt_t_defined "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1309:
+	.string	"__sigset_t.h"
+.LASF1316:
+	.string	"struct_mutex.h"
+.LASF1324:
+	.string	"common_post.h"
+.LASF1284:
+	.string	"long-double.h"
+.LASF1298:
+	.string	"__locale_t.h"
+.LASF1321:
+	.string	"platform.h"
+.LASF0:
+	.string	"./src/main/config/feature.c"
+.LASF1323:
+	.string	"target.h"
+.LASF1313:
+	.string	"thread-shared-types.h"
+.LASF1278:
+	.string	"libc-header-start.h"
+.LASF1276:
+	.string	"stdbool.h"
+.LASF1268:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1303:
+	.string	"endian.h"
+.LASF1290:
+	.string	"stdint-intn.h"
+.LASF1267:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1270:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1285:
+	.string	"stubs.h"
+.LASF1274:
+	.string	"feature.c"
+.LASF1262:
+	.string	"src/main/target/SITL"
+.LASF1315:
+	.string	"atomic_wide_counter.h"
+.LASF1282:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1266:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1291:
+	.string	"stdlib.h"
+.LASF1280:
+	.string	"features-time64.h"
+.LASF1314:
+	.string	"pthreadtypes-arch.h"
+.LASF1273:
+	.string	"feature.h"
+.LASF1295:
+	.string	"floatn.h"
+.LASF1299:
+	.string	"clock_t.h"
+.LASF1269:
+	.string	"/usr/include"
+.LASF1311:
+	.string	"struct_timespec.h"
+.LASF1301:
+	.string	"time_t.h"
+.LASF1260:
+	.string	"src/main/build"
+.LASF1308:
+	.string	"sigset_t.h"
+.LASF1296:
+	.string	"floatn-common.h"
+.LASF1322:
+	.string	"common.h"
+.LASF1287:
+	.string	"typesizes.h"
+.LASF1312:
+	.string	"pthreadtypes.h"
+.LASF1297:
+	.string	"locale_t.h"
+.LASF1310:
+	.string	"struct_timeval.h"
+.LASF1300:
+	.string	"clockid_t.h"
+.LASF1279:
+	.string	"features.h"
+.LASF1288:
+	.string	"time64.h"
+.LASF1272:
+	.string	"stdint-uintn.h"
+.LASF1305:
+	.string	"byteswap.h"
+.LASF1263:
+	.string	"src/main/target"
+.LASF1302:
+	.string	"timer_t.h"
+.LASF1318:
+	.string	"alloca.h"
+.LASF1293:
+	.string	"waitflags.h"
+.LASF1294:
+	.string	"waitstatus.h"
+.LASF1264:
+	.string	"src/main"
+.LASF1327:
+	.string	"parameter_group_ids.h"
+.LASF1289:
+	.string	"wchar.h"
+.LASF1261:
+	.string	"src/main/config"
+.LASF1319:
+	.string	"stdlib-bsearch.h"
+.LASF1317:
+	.string	"struct_rwlock.h"
+.LASF1265:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1283:
+	.string	"cdefs.h"
+.LASF1307:
+	.string	"select.h"
+.LASF1277:
+	.string	"stdint.h"
+.LASF1326:
+	.string	"build_config.h"
+.LASF1292:
+	.string	"stddef.h"
+.LASF1286:
+	.string	"stubs-64.h"
+.LASF1281:
+	.string	"wordsize.h"
+.LASF1306:
+	.string	"uintn-identity.h"
+.LASF1271:
+	.string	"types.h"
+.LASF1325:
+	.string	"parameter_group.h"
+.LASF1304:
+	.string	"endianness.h"
+.LASF1275:
+	.string	"stdc-predef.h"
+.LASF1320:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375 \226\225\003"
+	.string	"\244\005\212"
+	.string	"\013"
+	.string	"\311\205\244\223\006\004\002"
+	.string	"\001\232\246\342\242\f\002\354\332\201\276\f\002\003\262\364\321\367\001\004\002\001\002\002\002\001\002\001\005\352\263\360\321\b\006\376\365\265\277\006\002\007\220\352\317\274\f\001\b\225\333\315\253\t\t\263\321\243\267\n\233\304\365\321\002\002\013\207\312\266\244\016\002\002\001\002\002"
+	.string	"\t"
+	.string	"\020\214\031[#\241\214K\230i\306"
+	.ascii	"a\313,%7\320\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375 Pu\001"
+	.string	"\330D"
+	.string	"\n"
+	.string	"\002"
+	.string	"\001\001\002\001\001\003"
+	.string	"\001\006\003\007\b\001\t\n"
+	.string	"\001\013"
+	.string	"\003"
+	.string	"\b"
+	.ascii	"`\020\\\2462\255\345\036\260\315e7\220\363\006\260"
+	.text
+	.section	.gnu.lto_.inline.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\265\004"
+	.string	"bF\021\030\260%\351\f9\r\303"
+	.ascii	"\314q\215`\222$y\224\265\315\022B\310\336R\2463@p(\372\0070\205"
+	.ascii	"8\371{\310_1\246\237\277S\323\020\352\004\023\274\2569\347)?"
+	.ascii	"`\333n\374O\0237\276\202\204\266\344\207W\b\" \240\242\231\253"
+	.ascii	"\036\307\004\026\016B\216\221F\371:\231e\205\r\002\330\320(\206"
+	.ascii	"\024\301LR\200\274s\2239\242\355\277\023\311`\353\246I\337\263"
+	.ascii	"\267@\212/\202\364|9\020Ynt\255\023\347\216m\230k\336\362_\217"
+	.ascii	"cjF\372\233\253i`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375 P\245\001"
+	.string	"\024\002D"
+	.string	"\n"
+	.string	"\002\001\001\017\177\002\003\177\002"
+	.string	"\001\002\001\001\003"
+	.string	""
+	.string	"\006\003\007\b\t\n"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"`\b\030Wep\313\221\232vp\331\177\003X"
+	.text
+	.section	.gnu.lto_.pureconst.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\232\004\002\232\004\003\230\004\006\204\004\007"
+	.ascii	"\204\004\b\232\004\t\232\004\n\232\004\013\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"]\003"
+	.string	"D\003\030\001"
+	.string	"\n"
+	.string	"\002"
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001\002\003\001\001"
+	.string	""
+	.string	"  \002\001\270\006"
+	.string	""
+	.string	"\003\001\002\004"
+	.string	"\001\002\005\001\006\001\300\007"
+	.string	""
+	.string	""
+	.string	"\007\b\t\n"
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026"
+	.ascii	"\013#\343O\016`]\317\302\005J\013qd@{B\0137_\362s\024z\001$U"
+	.ascii	"\fT``\b\214\213\242\002\033.**\003:a0\023\225\335\360\005\030"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.lto.c312736bf677137b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_intFeatureSet.19.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\255\n"
+	.string	"\326\324KA0k\225\016X\323sqnT8+\341\202\025\221E\f\215\232,k\244\347\272\"\276>\361\366c\f#\374dB8-\032! #X\2255jpk@\203+\313\232\ni\365UC\225\rm\262eJ\0018"
+	.string	"8"
+	.string	"7"
+	.string	"\tV\023vE\f_h\237\025\267D>\263W\"\237\016m\f\023!\017\255\023L\303\356n\222\301\303k\350\377\365\t*E\272J4v\327\212J\r\270\345m[\330\346\260/\021V\251\276d\262 B\302n\200\221\303\306&\005\007\266o?BhSl\211"
+	.string	"\243\372\227/\036Bx\227\350\020\273\252\n\033\332\247EM\n\300\\\337\362\037|\025\2365\362d7R/\034\225\241\244\243\247\274T\371\016\247\002&\035\355\303@FZ\003_\024\371\274<\200\003%\035m!`au\203-\222T*\260\237\355\356Z\252\354\263\376y\327\237I\r\037\017\f\2018o\243Y\223\3512\031\031Os\251x|\270N\346\356\342\201!\020\347m\266\016\316\306\363u\233\207\303u\266\016\374l\027\n\177\037\036\270\201\276\017\334(\342>[\251\232\006b%i\262\006\r"
+	.ascii	"\007Uf\306\363\032\215nN\022\325\332C\005\3735\001W.#B5\005\356"
+	.ascii	"\362\251V\302\t^\\\223\f"
+	.text
+	.section	.gnu.lto_intFeatureClear.20.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\315\n"
+	.string	"F\325K>\020O5\035\f\037\243>\221*W\376s\001\304\202#\f"
+	.string	"\345\002`\032\036\351Qds\207\r\235\376q\343P\271\274t\252\253\252+\300\002\250\3137\360\227\310\242*\274\n\220\2615m\"eJ\001:"
+	.string	"8"
+	.string	"6"
+	.string	"\213\241$b7D\340\003\330#\201C\256G\353\217\353\321\240\215B"
+	.string	"\204\214\020 \324\212\335\315T\303\301'\350\377\364FH\324yb(\330]gH4\341\326\333.`\233\201}\003\001\232NM\037k\250\b\240\332\225\260r\261\2518\202\203\355\333\007\001\332\016;YH2\177\362\303\177"
+	.string	"o\332\034\300\356\250\304\002\354\321!\226*\311\363%\277\303=\200'q\334\330\241\024\251W\325\277"
+	.string	"Q\370\344\312\227\246&\t\220\217\3728\330\006\177s=^\037\241\202'W\206X0\261\331\302\016;\251\031\354[\273\273\326\221}\322\177\335\364GMk\031\316\323|\032W\301L\231l\223\004\023\216\022y8\310h\027\313[\204\3634\237\306U\262\006\226\n\246\3332\214E\273d\233\227\311\"\003\334=\340\274\354\353:/s\204{ku\024/\244<\372\261j\236x\017"
+	.ascii	"\007Uf\342)\030\215\200\236\204\252\265\247\304\005q{\016:~\026"
+	.ascii	"g.#B5\005\356\362\251V\302\t^\\\223\f"
+	.text
+	.section	.gnu.lto_intFeatureClearAll.21.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"E\b"
+	.string	"f\220;6P\217\032\003\200\332\323\034Z\261\234\253\302\345\032C&f\201\220!\243\226\217\326^\262{\366\004FT\177_!3\256\016[)H\247\031@S\256\bO\320J\"eJ\001*"
+	.string	"+"
+	.string	"*"
+	.string	"\030k2\313zmJ\001\205\300I\005\310\312\377\0313\354\031z\265]\016H\251N\206"
+	.string	"\f\377\013S\252\0137\272\355A\333\206\266\254!\033\223\337\"\326\362\227$\331h\353\326\237\327fZX\242`hW\355a\226\347\226\311\004\377Jd\344\377\022\212\200\261\354\347Mf\031\2508\321\272\224\325\037\022%\b\373o\215\332\224Y\016\300TP0\326\r\007\312!K\373\235`\304h}\371\377\306U\353\226\r/\231\365t\264\316Bg\363p4#L5\316\326E\220>\033h:\204@\"N\233\242\320\347aj\335hr\f\312Al\335$q\\73\337}y\\\311\216W\b"
+	.ascii	"7\013\226K\226\231\366\200Z\363\3064\375\271`\f\327\306B\230"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_latchActiveFeatures.22.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"}\007"
+	.string	"B\01646P\215\322\001\260\226'\002\236\263B\r\"\242\375\246\335\343z\247"
+	.string	"m\251\314q\302\244>\274\355i\272\253\207\222\344\314\314f\333\n\313\317\001\303\256c\021\277m\"eJ\001\2762X&\ni\260\r\\\340l<\361\202\036\216\246\003\257\f\0043\005\216\fX\006C1f\360\242\332n\255\232\236\310jS\222\257>\307;:\376\311\361\363\251\374\351\007gb\203\236\022\001\354B$\370\033G5\370\247?;\214\362\334\237?\252\374]\0210P[v\306\200\220l\242\330*R\252\205}k\325d?}k\240\002\323\355Nt)\273z!\031\266\177\261f\227\020D\b\214Hx\234\354.\324\213kO\315\277\306\003\270\322\303\323\242\260\273N\256Dq\353m\033\330>\260\235\n\n"
+	.ascii	"3\241\207\037\370\306\\\366T\362\203\312B\327\360\263\020\306"
+	.ascii	"\313\020\341r,\332I\006"
+	.text
+	.section	.gnu.lto_featureConfigured.23.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\265\t"
+	.string	"\246\323F< \005)\035"
+	.string	",\341\020\362L\002\307&\325\35011\031(\304W\013\340\314\266 \213\375\322?y\324\236A\266\013j\202X@@\210\013\247\334)%\025D\321n5\304\367\026\221M\266L)5"
+	.string	"3"
+	.string	"5"
+	.string	"\237\023t\237\334=\335\247m34\270\3742\300\220232\224\233\335\321\223\036\177]_\376I\016j\251\231\321,\256\001\020\273k\235\3214ny\333\t\266#l\333\004\273\226\034\266\325\363\266\237\223j\225\352w\003/\0050\273\031\267"
+	.string	"\3532W@l\273\354\216\255!\013\252\366E>\342\272\255e\201\335Z\212\312\356\250`\020\34732\026N^\252\2344\262\215\230\336l\207?\251\340\354^8\370%7I\371\037\237^\261\364\263O\237\325}^\"\304\330`zs\247\266\n\300\036c*;\354s\273\001\036\211>\321\203\b\034\205<\023)\322\211\363\027\002\305\225\212\004\226<\tS\t\025~\036\312D:y\237\230\362B\007\016)@\321S\205\241\350uF\330=\345\007&c\366[\235\312)\037\b"
+	.ascii	"\237YEfh0b\035.\0201m\034\327\3003\2078\235k\222\001"
+	.text
+	.section	.gnu.lto_feature.24.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"]\t"
+	.string	"\306RD>0\307(\035"
+	.string	"\333\317@\365\260!\350\375\354\031\334\203;\t\n3\354\343\244\032\255\201KM\355\353\337\f\332r\225\rO\226\2405\024\024\200\b\307\352\222\312\233\364a\205\037\342\240\007\331D\312\224\0021"
+	.string	"3"
+	.string	"/"
+	.string	"\217\331/\332\243mST\230|b\340\320\00400"
+	.string	"l7\334T\344\247\347\311\277\312!@\003+\026\352ip\261\273\316\025\313\343\326\333~\260\215a\033A\351\370\327\237i:5}-\341dA\300nGl\301\036\210\004Ll\233l\213\235\037\023\231\366Q\236b\372\253d\204]W\311\200\335P\302\021\007\217\230+h\001z\260@\246\327\324\203-U\306\354\257\034@\311'\361\210\224_=\372$\355\361\3520\322Je\314\026\327\246\002;D\245\206\330\317vw\255 \266\003\336h8\215\205\246\333d.\032!\316'3\227\351\276\221\210\323u\266\fO\007\344q\033\310\303\371l\334\027\3322\r\3666\272o\023y\336\267Y\302\275\243bR\252\262_\322Rc\b"
+	.ascii	"\237YEfh0\342\031.\030L\273\3075\373\231C\304\3165\237"
+	.text
+	.section	.gnu.lto_featureSet.25.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`m\001\275\016"
+	.string	"V[aD"
+	.string	"\221(\035\240\032\314\301\255\215\210P\215\303`"
+	.string	"\361"
+	.string	"\320\300[\020\021\261\207C\206[\372\261\301\271\234\313Vdk"
+	.string	"\2631\037\001\002\221\221\377_\262Ys\345\032\271\032\311\272\272\324JZ\267o\f\266\275\245L)J"
+	.string	"S"
+	.string	"G"
+	.string	"\234\307s\354\317|\236\366Q^\302\373K\345\215]\021$V\354~\b\354\261y\354\274C\363\b\317\241y\264g\313\030`!\300\314\210\nmw7-\271\367\364\374\303\276\321rQx\002X\260\273\316\226\213\303\255\267m\300\366\003\3730\001\n\323\251IpA"
+	.string	"\215]\r\265\032\373\022[\234\370)oI\375\363M\234%\3028\336WPp?|\007B|4/\363O\\%\365\025\224bX\350\302`\363\350o\363X\247\302W"
+	.string	"F\f\217G\335\360y>\226\372K\345`a\211\013\032\n\355\321OI\331\001Y\263\237\342*T\276\211\217\322<\246>\003\210U\326\374\226C\350p\226G\331,f\306Q\240\362-\177\356\242\362M\036]:\345[\217\227\251>\366\316*e\334Q{\261)c\177\254\324\021\366\341\356\256\225\304\206i\370\327\037%\256;\231B\334h\343\017\220\b\244"
+	.string	"\304}x8$\224B!\320\"\017\327\235L!n\264E"
+	.ascii	"\031\211\220D\233\bH(d\023u\245\315C\300\244\t\\\267\231H\244"
+	.ascii	"n\343|\253\303U\0227p\275\254\224e\377\260\307\223Y\314\f*\213"
+	.ascii	"\026\214j*\324\317\214x`\005  @\002c\314\312\016\237\250\"\021"
+	.ascii	"\317>\243\321 \022\312e\024\223\202Z\333$m\301Y\341\361\241\221"
+	.ascii	"X\320q\353\266\241\212/\355\350\240x-F\177\t\216\270V\230\017"
+	.ascii	"\b\303\236\262\342^\035\202\241\252\204\207\244\235\"+Y\237\224"
+	.ascii	"\250\303\2136\220\001"
+	.text
+	.section	.gnu.lto_featureClear.26.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`\205\001%\017"
+	.string	"\306\234dD"
+	.string	"\217*\035\034\361\315u/\322"
+	.string	"\b]\r>\334\t\320\346\370c0\211\356\201\036>\252\367\036\371\230IW\314\332\375\r"
+	.string	"\314\336B\022C\270\377\033\030gj\177\005\021Q`Y\355iD\300U\001\352a\367\2262\245K"
+	.string	"V"
+	.string	"J"
+	.ascii	"6\347\361\034\373(<O\373\260"
+	.string	"{X=\246\262\306.\006\030\314\356W\300\035\233G\216\007\320<\302oh\036\275\262S\374\323\260_\361\\,1\273\313)\312W\317\225\377\224kx$\021\236\031\037\273\353\364H(\334z\333\004l+\260\023@0\235\031\032\023\023\002J\354N\270\301X[\034\261\301Wy-\365\317_9m\301\254\303\356rV\237\241>Z#\013_^x4\337\342\1778K\3523\224\216,t9\260y\364\267\271\f.m\341\253\004\246\3431Ux\236\227\245\036S%X\210\342\302\006\213y\364UR\001$\\>\210\207P\371/\037\245yL\275\004\023V\336\374\332\033\\8\355\261\366\311\264\370\013*\357\331s\027\225\377zt\351\224\367\036\337\242z\3319X9\343\234U8\2619c\177\255\324\f\366\341\356\256\365\304\206\351\b\323\360\261_\003\245\216t2\201:\321\306\036\237\320\307\300\247\363\350l<(\201B\240C\235\216t2\201:\021\347"
+	.ascii	"D$2\nq\" \240\020.D*q\235\001\036A\350H\234i4\"q\234\217u\270"
+	.ascii	"zb\004\026l,m\331\177\312\031p\370dVD\025\341\261\200\232\032"
+	.ascii	"\3651\\%\255\274Y\025j\006  @\002c\320\322:\237T\221\027\317"
+	.ascii	"AF\243A<-W\226\230t\320\232&U\013f\026\336\004\033\334#\0201"
+	.ascii	"\341qm\266\261\203o\370\331\341\361\302\032\365]\343\334I\031"
+	.ascii	"\026\251\025\367\362\020,U<<$\355\024Y\311z\245@//\332G\006"
+	.text
+	.section	.gnu.lto_featureClearAll.27.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"m\013"
+	.string	"V\225M=\020/\330t@\243\367V\"\251\003d\245\232\370\2721\f\365V\274\\\340$\002\311\372\035\266\3546\370\353\357\241sl\177R\024@+\211\362\231\200\300k\324\251k*y5ZXO7\332;\2457"
+	.string	"?"
+	.string	";"
+	.string	"\345\007h\257\215;\264W\337\264\261\267\327o\026\355\025/;\354S\036\f*\330\356r\224\303\305O\321?\351\001H\320\205O"
+	.string	"\223\335\365$A\031nz\333\007l7\260\357 \032\b\024\004H\354zf/\366UM|\360MOm^\362Q\017\\\333\253m\361e8\341t\226\341\322"
+	.string	"{\274\316\023\n\346\374\311\027\361\021\233\227!\355,\2435b\225`\273%\202W?\032\257\016g\275\345\207\332\253"
+	.string	"\025.\3069\363S\217\020\342\250\327\022\237X\213\257\302y\322\t\256\322\370\036^]\301\302<\371\372\323\r\214S\346\271\022\245\330)\263K\316\244\033\3543\226\206l\032\226D\272\310\202\210'\20180\rw\020\017\324d(^\205\223`\251\\\276\216\273X(\023\270\016\304p\220\002\376(x \227\371>\220\333\312\3614d\006\243\327H9\366O?\351\020D\237\030\213Q\2439\024"
+	.ascii	"7\013\226K\026\031\333\030o\\\\\334\255n\273\262\301W\024\260"
+	.ascii	"\2728\246\232va\2244v\177\354\311h\321\307\026\016\225\324\205"
+	.ascii	"j\373E\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_featureMask.28.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"U\007"
+	.string	"\222\21645Po\322\001\200\342s\016\003p\263Pge\bLA\027\325\033\226\f\243\370M\006j=z\333\210\300V}$\355\252\252F\222\322\213<<WHi\020\332{o\231R\2462\325\005\372h\252\215\\\340l:\026%;\034\r\203\244.\217\314\024\330j\250.\371\261\254KN3\373[G\262\303dnd\333s\021P\300nD\202\037\362\351\340o\034\372!\244\327\016\375P<Tg\200R\312\364\305\323\305j\213=G\3520\354\277\335];\222m\265\272X:!H\331\235xqY\023X\322a[dO\276\307?D\306\336\324\330\342\210\205\004\t\313\356\224\230\017\304\303w\201x\3502\216]1\377 \177*\025+\332\006q\005P\330]\253\266Q\334\356\266\017l#\330\346\b\007"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"\357\232\227\205 \303]1\265\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"\035\003"
+	.string	"\204\004\002\001"
+	.string	""
+	.string	""
+	.string	"\002\023\177\006\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002\024\177\007\025\177\b\026\177\t\005\035\n "
+	.string	""
+	.string	""
+	.string	"\005\022\013\200\204\001"
+	.string	""
+	.string	"\003\002\027\177\f\030\177\r\031\177\016\032\177\017\002\033\177\020\034\177\021"
+	.string	"\n"
+	.string	"@\2171|\004\320\003|\003\276a\016\037\003\364"
+	.string	"\337"
+	.ascii	"?\\k\216\001"
+	.text
+	.section	.gnu.lto_.refs.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	"\004\002"
+	.string	"\001\005\003"
+	.string	"\001\006"
+	.string	"\004\002"
+	.string	"\001\007"
+	.string	"\005\002"
+	.string	"\002\b"
+	.string	"\004\006"
+	.string	"\001\004\b"
+	.string	"\002\t"
+	.string	"\004\006"
+	.string	"\001\004\t"
+	.string	"\001\n\001\004\005"
+	.string	"\001\013"
+	.string	"\004\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c312736bf677137b,"e",@progbits
+	.string	"(\265/\375`\201\b\355-"
+	.string	"\nO\\\021E`\236\316ps\375i\225m\242fVy/l\230\366_\373\035\326mc\230\226\\\033>c\023\340t\2555\231\034\3144)\253\216O"
+	.string	"\037\376\002>\202\013\234\330?\314\370\256\t\346+\\\320\250\323\035\256\315v\3332\005\345"
+	.string	"\370"
+	.string	"\001\001(Z\001`\023/,|<+S\252QAs\242_\372\225\316e\354\205\337\004V\335\311\"@i\362r\004\341\353v\315\330\3452&C\335n\007\005\204\270Z+3\024\375\211\364\036\322\237\273 \t\315\231\243\372:\3078\013\277\277\365\252m\262n\267(-\263c\3568Q\326\302[\330Eb.\3470\026\273\217\321\355\267\333\035\362\231\213C\204\354D\027\360"
+	.ascii	" \232!\r::\203}(\254+\374L\317H\300!F\002\336\345\001\300\224"
+	.ascii	"\215\200{p\362\332\260\341\255Y\353\3719M\035\360g3l\376\373"
+	.ascii	"\374<\246\214\357\347g,\277\237\247\2609\371\177\204\376\254"
+	.ascii	"\344\377\336\377\274\377x\377\357\376\327\375\247\373\037\367"
+	.ascii	"\037\356\377\333\377\266\377l\377\327\376\247\375G\373/\366\337"
+	.ascii	"\354\377\330\377\367\177\200\377g\376\003\365\365\365\365q\373"
+	.ascii	"\003\225\002\214\364\013\361\217\033t\023\220\353\316R\346\245"
+	.ascii	"^`\212CN\364\377\202\376\177"
+	.string	"\r\255~\031\213lQ\273\215\\\337\244\272\216\305\261En\037!\320\257\262W7\311\242m\237\3556\2671\311\316X\335\026\271\272\255J\324\306V\355vY\242\225\254\250\362\372&\331\365m\331\2426\266\332o\361Hjl\331\325\255e\211\326\267\310\256\306$[\004D\211\244\315*J\222\t\253\255\306\306:n\025\221D\314\325m\273\331\315dU\215l\320\275\325\"\233\305,^R1\261\250\320\212-\273\335m\340H\305\325\266\221\271Ji\273\245P\275\350#\005\325e\266\022f\252\312\255\276\252\352>\320n\367\261[\345fv\267\332\335=\310-\267[\b\321\332u<vk\0258\366\226\252V\325}\222\321-\331\365\345j\225\324\272\274]\235\303U\271\253\233Id\372\252\\\372\252\2739N\332\305\372\300s\005hU\301:\003W\\gl'\312t\334\024\322\033cn9Qn\236\314\206\333\234\233<\027dt\271\211v\027\231\031"
+	.string	"`f\3003\306IQ\f\210\376\204K\257\007D\303\243\016\235\264\224\301\216\230\311\034\027\307/\3526[B\013\322}\360\323Jz\346\027\310^Gg8\227\3418\r5\2065+\343J\216%_\267\326\203\0370ien\312\364|\335\356\306oi\243a\264\344\227\335\365\316o<qR\236\230\235\350Odz\232\225\3413e\270\315L\227\320\031\034\326\0273\347\266\337\222\fK\323Nz\256ac2l\274\226\252\335\277\356\"h]?J\320\232N\336\244\277\252#\006\303\313\263\032\217qY\215\327\270\221\335Z\375\253\003\303Z\362\265\226\026R\220\216\263\376!\346\274\366O\250p\273\240\356,\335\235\300\347\316\231k\344D9\f\277\274&i\325\023\275\036\217\245\220cB',\375\317\037\330Edw\367\340q\033I\025t\346\3410\246\234F"
+	.string	"\r\207\033\202Z\374\364\f\243\2428\250\340a!\224\242Q$\302\311(\206\2208u\303\204"
+	.string	"a\215'bp\303\213 \321ih4\034n\b \345$\034v\030z\220(4A\204z\022z\360IJ\b%t\221\236\002\023\004\246\0136z~\241IB\223\004\340/4))51)\245gR\372\021\377\"\301\243d\b\245\222\210QQRI@S*:\fM}`!\034\256p\202\022\016\021ULX\"B=\321Hoa)\270\204aIh!\202\3211`\350\260"
+	.string	"\005\t\020i0\202P\212\006\321I\330\"\311\305S\013\250\250`\022\324\223S\214\244\240\324TR\004\004s\322P\035h\307\254\023\34539rx/@WO\027\261\255;\240'll[{\374\322UaB\371\2212\231\274<~\343\301\346\316\017G\312oxxjt\344\371Pf\361\245\034\307\316\216\357R\242\246\252\263s\307I\224l\222\023\345;T\r\330\\\363D\337\244\247U\335\353\230.\204\253\200\017k\371\345s\346\365\306kMz.\221\273\034\323\371t\323\271\301Z\362\241\001\200\252\250\241(\207\034T#\"\"\"\222$I:p\002\221\2613n\021\200\031\323hf\202\246(\225\f\007@\006\316\331\217\013\265\273=\256\006noo8k\272\332Qj\310\235\342s\363\211\235\021\216\310S\377\375\274\323\021\243\217\\\340FF\313OmGfq\f\016\252zN"
+	.ascii	"Y_t\336\254\301Z\t^\221\242\222!1\334m\031\201\227\226J\266\032"
+	.ascii	"\035\004O\021\225\315\303\340 \t\255twH\033\003%w\263MQ\274l"
+	.ascii	"\367\273dS6IL\373j\262\314\0066\320H\351\003\367\213Z\322\216"
+	.ascii	"\201@\037\264\005\233C\253\225X\250=`\305\231'\351\331J\203P"
+	.ascii	"n\2731\"\316Ul\357XHa\bu\223\200\357\233\243\204r\330\236\177"
+	.ascii	",\360\363\264\245\2026\366\0268\201\r\322\232X\272\267e\375N"
+	.ascii	"\355\035h\342\357\240\311&1\214\t\276$\215\2226\003\233\b\264"
+	.ascii	"Z\002is\310A\354\352\373\030N%\237fLi\004\221\242\003\302\361"
+	.ascii	"v\222\315\310\220D \201\020\313xP\005s\245&\313:hlY\352 \241"
+	.ascii	"Y\003~!y\367\200o\257\017}}\371\327,\312M\034\311\026\177\036"
+	.ascii	"\363\227\375\366e\242\177\337\372_\227\357\035w\205\315w\222"
+	.ascii	"\027\260\331\370\027\375\235\360\2653\3725^\327\310M~\013\271"
+	.ascii	"\201\305\262\335^X\203j\f"
+	.text
+	.section	.gnu.lto_.symtab.c312736bf677137b,"e",@progbits
+	.string	"intFeatureSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.string	"intFeatureClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.string	"intFeatureClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.string	"latchActiveFeatures"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"featureConfigured"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352"
+	.string	""
+	.string	""
+	.string	"feature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"featureClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364"
+	.string	""
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c312736bf677137b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
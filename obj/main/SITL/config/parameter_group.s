@@ -0,0 +1,7676 @@
+	.file	"parameter_group.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "/usr/include/string.h"
+	.file 6 "./src/main/config/parameter_group.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	parameter_group.c.d5f62027
+	.weak	parameter_group.c.d5f62027
+parameter_group.c.d5f62027:
+	.long	0x497
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x16
+	.long	.LASF1049
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF996
+	.uleb128 0x4
+	.long	.LASF1003
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF997
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	0x3c
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF998
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF999
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1000
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1001
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1002
+	.uleb128 0x4
+	.long	.LASF1004
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1005
+	.uleb128 0x4
+	.long	.LASF1006
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x48
+	.uleb128 0x18
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1007
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0x6
+	.long	0x8c
+	.uleb128 0x4
+	.long	.LASF1008
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x6
+	.long	0x9d
+	.uleb128 0x4
+	.long	.LASF1009
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0x9d
+	.uleb128 0x19
+	.byte	0x7
+	.byte	0x4
+	.long	0x5d
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0xeb
+	.uleb128 0xc
+	.long	.LASF1010
+	.value	0xfff
+	.uleb128 0xc
+	.long	.LASF1011
+	.value	0xf000
+	.uleb128 0xc
+	.long	.LASF1012
+	.value	0xfff
+	.uleb128 0x1a
+	.long	.LASF1013
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1014
+	.value	0x8000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1015
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xf
+	.long	0xf7
+	.uleb128 0x1b
+	.long	0x107
+	.uleb128 0x5
+	.long	0x8a
+	.uleb128 0x5
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1c
+	.byte	0x8
+	.byte	0x4
+	.byte	0x35
+	.byte	0x5
+	.long	0x126
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x11
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x126
+	.byte	0
+	.uleb128 0x9
+	.long	0xeb
+	.uleb128 0x1d
+	.long	.LASF1050
+	.byte	0x20
+	.byte	0x4
+	.byte	0x30
+	.byte	0x10
+	.long	0x175
+	.uleb128 0x12
+	.string	"pgn"
+	.byte	0x31
+	.byte	0xb
+	.long	0xae
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1016
+	.byte	0x32
+	.byte	0xe
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0xf
+	.long	.LASF1017
+	.byte	0x33
+	.byte	0xe
+	.long	0x175
+	.byte	0x8
+	.uleb128 0x12
+	.string	"ptr"
+	.byte	0x34
+	.byte	0xf
+	.long	0x17a
+	.byte	0x10
+	.uleb128 0xf
+	.long	.LASF1018
+	.byte	0x38
+	.byte	0x7
+	.long	0x107
+	.byte	0x18
+	.byte	0
+	.uleb128 0x9
+	.long	0x8c
+	.uleb128 0x9
+	.long	0x175
+	.uleb128 0x4
+	.long	.LASF1019
+	.byte	0x4
+	.byte	0x39
+	.byte	0x3
+	.long	0x12b
+	.uleb128 0x6
+	.long	0x17f
+	.uleb128 0x13
+	.long	0x18b
+	.long	0x19b
+	.uleb128 0x14
+	.byte	0
+	.uleb128 0x6
+	.long	0x190
+	.uleb128 0xd
+	.long	.LASF1020
+	.byte	0x4c
+	.byte	0x1b
+	.long	0x19b
+	.uleb128 0xd
+	.long	.LASF1021
+	.byte	0x4d
+	.byte	0x1b
+	.long	0x19b
+	.uleb128 0x13
+	.long	0x98
+	.long	0x1c1
+	.uleb128 0x14
+	.byte	0
+	.uleb128 0x6
+	.long	0x1b6
+	.uleb128 0xd
+	.long	.LASF1022
+	.byte	0x50
+	.byte	0x16
+	.long	0x1c1
+	.uleb128 0xd
+	.long	.LASF1023
+	.byte	0x51
+	.byte	0x16
+	.long	0x1c1
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1024
+	.uleb128 0x15
+	.long	.LASF1025
+	.byte	0x2b
+	.long	0x8a
+	.long	0x201
+	.uleb128 0x5
+	.long	0x8a
+	.uleb128 0x5
+	.long	0x201
+	.uleb128 0x5
+	.long	0x29
+	.byte	0
+	.uleb128 0x9
+	.long	0x206
+	.uleb128 0x1e
+	.uleb128 0x15
+	.long	.LASF1026
+	.byte	0x3d
+	.long	0x8a
+	.long	0x225
+	.uleb128 0x5
+	.long	0x8a
+	.uleb128 0x5
+	.long	0x3c
+	.uleb128 0x5
+	.long	0x29
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1027
+	.byte	0x76
+	.long	0x255
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x76
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0x7
+	.uleb128 0xb
+	.string	"reg"
+	.byte	0x78
+	.byte	0x1f
+	.long	0x255
+	.uleb128 0x7
+	.uleb128 0xb
+	.string	"ptr"
+	.byte	0x7a
+	.byte	0x16
+	.long	0x175
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x18b
+	.uleb128 0xa
+	.long	.LASF1028
+	.byte	0x68
+	.long	0x28a
+	.uleb128 0x2
+	.long	.LASF1030
+	.byte	0x68
+	.byte	0x15
+	.long	0x3c
+	.uleb128 0x7
+	.uleb128 0xb
+	.string	"reg"
+	.byte	0x6a
+	.byte	0x1f
+	.long	0x255
+	.uleb128 0x7
+	.uleb128 0x8
+	.long	.LASF1029
+	.byte	0x6f
+	.byte	0x16
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1035
+	.byte	0x60
+	.byte	0x5
+	.long	0x3c
+	.long	0x2d2
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x60
+	.byte	0x21
+	.long	0x255
+	.uleb128 0x1
+	.string	"to"
+	.byte	0x6
+	.byte	0x60
+	.byte	0x2c
+	.long	0x8a
+	.uleb128 0x2
+	.long	.LASF1016
+	.byte	0x60
+	.byte	0x34
+	.long	0x3c
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x60
+	.byte	0x42
+	.long	0x8c
+	.uleb128 0x8
+	.long	.LASF1031
+	.byte	0x62
+	.byte	0xf
+	.long	0x43
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1032
+	.byte	0x56
+	.long	0x322
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x56
+	.byte	0x21
+	.long	0x255
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x56
+	.byte	0x2a
+	.long	0x3c
+	.uleb128 0x2
+	.long	.LASF1033
+	.byte	0x56
+	.byte	0x44
+	.long	0x201
+	.uleb128 0x2
+	.long	.LASF1016
+	.byte	0x56
+	.byte	0x4e
+	.long	0x3c
+	.uleb128 0x2
+	.long	.LASF1034
+	.byte	0x56
+	.byte	0x58
+	.long	0x3c
+	.uleb128 0x7
+	.uleb128 0x8
+	.long	.LASF1031
+	.byte	0x5b
+	.byte	0x13
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1036
+	.byte	0x4c
+	.byte	0x5
+	.long	0x354
+	.long	0x354
+	.uleb128 0x2
+	.long	.LASF1037
+	.byte	0x4c
+	.byte	0x17
+	.long	0x8a
+	.uleb128 0x1
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x4c
+	.byte	0x23
+	.long	0xae
+	.uleb128 0xb
+	.string	"reg"
+	.byte	0x4e
+	.byte	0x19
+	.long	0x255
+	.byte	0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1038
+	.uleb128 0xa
+	.long	.LASF1039
+	.byte	0x43
+	.long	0x372
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x43
+	.byte	0x29
+	.long	0x255
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1040
+	.byte	0x3e
+	.long	0x394
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x3e
+	.byte	0x22
+	.long	0x255
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x3e
+	.byte	0x2b
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1048
+	.byte	0x6
+	.byte	0x30
+	.byte	0xd
+	.long	0x3c3
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x30
+	.byte	0x31
+	.long	0x255
+	.uleb128 0x2
+	.long	.LASF1041
+	.byte	0x30
+	.byte	0x3f
+	.long	0x175
+	.uleb128 0x8
+	.long	.LASF1042
+	.byte	0x32
+	.byte	0x14
+	.long	0xa9
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1044
+	.byte	0x6
+	.byte	0x25
+	.byte	0x11
+	.long	0x175
+	.long	0x401
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x25
+	.byte	0x2e
+	.long	0x255
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x25
+	.byte	0x3b
+	.long	0x8c
+	.uleb128 0x8
+	.long	.LASF1042
+	.byte	0x27
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x8
+	.long	.LASF1041
+	.byte	0x29
+	.byte	0xe
+	.long	0x175
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1043
+	.byte	0x1b
+	.byte	0x15
+	.long	0x255
+	.long	0x42a
+	.uleb128 0x1
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x22
+	.long	0xae
+	.uleb128 0x7
+	.uleb128 0xb
+	.string	"reg"
+	.byte	0x1d
+	.byte	0x1f
+	.long	0x255
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1045
+	.byte	0x4
+	.byte	0x3e
+	.byte	0x18
+	.long	0x9d
+	.long	0x447
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x4
+	.byte	0x3e
+	.byte	0x37
+	.long	0x255
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1046
+	.byte	0x4
+	.byte	0x3d
+	.byte	0x18
+	.long	0x9d
+	.long	0x464
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x4
+	.byte	0x3d
+	.byte	0x33
+	.long	0x255
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1047
+	.byte	0x4
+	.byte	0x3c
+	.byte	0x17
+	.long	0x8c
+	.long	0x481
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x4
+	.byte	0x3c
+	.byte	0x35
+	.long	0x255
+	.byte	0
+	.uleb128 0x20
+	.string	"pgN"
+	.byte	0x4
+	.byte	0x3b
+	.byte	0x18
+	.long	0x9d
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x4
+	.byte	0x3b
+	.byte	0x30
+	.long	0x255
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF456
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF535
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF610
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF628
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF653
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF654
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 19 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.file 21 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF535
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF719
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF724
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF820
+	.byte	0x4
+	.file 26 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1a
+	.file 27 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 28 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 29 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x1d
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF943
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 31 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 32 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF478
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF480
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF481
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF483
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF494
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF496
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF502
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF504
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF510
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF516
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF516
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF522
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF525
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF529
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF516
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF531
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF534
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF542
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF548
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF595
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF636
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF638
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF640
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF642
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF644
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF646
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF648
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF650
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF652
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF656
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF651
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF455
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF638
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF640
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF642
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF644
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF646
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF648
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF650
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF674
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF718
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF722
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF865
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF911
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF942
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF948
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF978
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF995
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF1051
+	.long	.LASF1052
+	.long	.LASF1053
+	.long	.LASF1054
+	.long	.LASF1055
+	.long	.LASF1056
+	.long	.LASF1057
+	.long	.LASF1058
+	.long	.LASF1059
+	.long	.LASF1060
+	.long	.LASF1061
+	.long	.LASF1062
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x21
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1063
+	.byte	0xc
+	.long	.LASF1064
+	.byte	0x8
+	.long	.LASF1065
+	.byte	0x8
+	.long	.LASF1066
+	.byte	0x3
+	.long	.LASF1067
+	.byte	0xb
+	.long	.LASF1068
+	.byte	0x3
+	.long	.LASF1069
+	.byte	0xb
+	.long	.LASF1070
+	.byte	0x8
+	.long	.LASF1071
+	.byte	0xb
+	.long	.LASF1072
+	.byte	0xb
+	.long	.LASF1073
+	.byte	0x8
+	.long	.LASF1074
+	.byte	0x8
+	.long	.LASF1075
+	.byte	0xa
+	.long	.LASF1076
+	.byte	0x8
+	.long	.LASF1077
+	.byte	0x9
+	.long	.LASF1078
+	.byte	0x9
+	.long	.LASF1079
+	.byte	0x7
+	.long	.LASF1080
+	.byte	0x7
+	.long	.LASF1081
+	.byte	0xb
+	.long	.LASF1082
+	.byte	0xc
+	.long	.LASF1082
+	.byte	0xb
+	.long	.LASF1083
+	.byte	0x8
+	.long	.LASF1084
+	.byte	0x8
+	.long	.LASF1085
+	.byte	0x8
+	.long	.LASF1086
+	.byte	0x8
+	.long	.LASF1087
+	.byte	0x6
+	.long	.LASF1088
+	.byte	0x5
+	.long	.LASF1089
+	.byte	0x4
+	.long	.LASF1090
+	.byte	0x5
+	.long	.LASF1091
+	.byte	0xc
+	.long	.LASF1092
+	.byte	0x1
+	.long	.LASF1093
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF732:
+	.string	"INT32_MAX (2147483647)"
+.LASF851:
+	.string	"TELEMETRY_CRSF "
+.LASF503:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF674:
+	.string	"__STD_TYPE typedef"
+.LASF533:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1027:
+	.string	"pgActivateProfile"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF841:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1003:
+	.string	"size_t"
+.LASF974:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF712:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF635:
+	.string	"__stub_sigreturn "
+.LASF472:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF821:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF611:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF977:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF572:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF707:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF778:
+	.string	"INT16_C(c) c"
+.LASF809:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF543:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF797:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF870:
+	.string	"U_ID_0 0"
+.LASF967:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF771:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF865:
+	.string	"VTX_TRAMP "
+.LASF539:
+	.string	"__USE_GNU 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF768:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF882:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF808:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF888:
+	.string	"USE_UART7 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF802:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF935:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF747:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF791:
+	.string	"INT32_WIDTH 32"
+.LASF793:
+	.string	"INT64_WIDTH 64"
+.LASF586:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF975:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF719:
+	.string	"__STD_TYPE"
+.LASF928:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF757:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF559:
+	.string	"__P(args) args"
+.LASF942:
+	.string	"__enable_irq() "
+.LASF414:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF687:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF837:
+	.string	"USE_SERIALRX_SUMD "
+.LASF449:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1031:
+	.string	"take"
+.LASF504:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF761:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF407:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1043:
+	.string	"pgFind"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF782:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF430:
+	.string	"__size_t "
+.LASF726:
+	.string	"INT8_MIN (-128)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF671:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF547:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF854:
+	.string	"TELEMETRY_MAVLINK "
+.LASF1023:
+	.string	"__pg_resetdata_end"
+.LASF574:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF418:
+	.string	"_T_SIZE "
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF735:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF756:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1035:
+	.string	"pgStore"
+.LASF926:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF475:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF654:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1028:
+	.string	"pgResetAll"
+.LASF462:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF858:
+	.string	"USE_MSP_PUSH "
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF871:
+	.string	"U_ID_1 1"
+.LASF569:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF864:
+	.string	"VTX_SMARTAUDIO "
+.LASF898:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1020:
+	.string	"__pg_registry_start"
+.LASF773:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF631:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF696:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1046:
+	.string	"pgSize"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF486:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF466:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF471:
+	.string	"__USE_XOPEN2K8"
+.LASF859:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF596:
+	.string	"__always_inline"
+.LASF416:
+	.string	"_SYS_SIZE_T_H "
+.LASF834:
+	.string	"USE_SERIALRX_IBUS "
+.LASF848:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF482:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF728:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF545:
+	.string	"__GLIBC__ 2"
+.LASF996:
+	.string	"long int"
+.LASF535:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF910:
+	.string	"TELEMETRY_MAVLINK"
+.LASF980:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1011:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF487:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF522:
+	.string	"__USE_XOPEN2K8 1"
+.LASF705:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF960:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF406:
+	.string	"_PTRDIFF_T_ "
+.LASF483:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF991:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF716:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF701:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1040:
+	.string	"pgReset"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF763:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF695:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF593:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1037:
+	.string	"copy"
+.LASF425:
+	.string	"_SIZE_T_DECLARED "
+.LASF561:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF912:
+	.string	"USE_DASHBOARD"
+.LASF901:
+	.string	"USE_SERIALRX_XBUS"
+.LASF617:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF985:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1012:
+	.string	"PGR_SIZE_MASK"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF845:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF973:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF940:
+	.string	"EEPROM_SIZE 32768"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF582:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF770:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF842:
+	.string	"TELEMETRY "
+.LASF656:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF994:
+	.string	"Q12 (1 << 12)"
+.LASF455:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF943:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF575:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF451:
+	.string	"NULL ((void *)0)"
+.LASF698:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF638:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF681:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF542:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF552:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1002:
+	.string	"signed char"
+.LASF794:
+	.string	"UINT64_WIDTH 64"
+.LASF1007:
+	.string	"uint8_t"
+.LASF1044:
+	.string	"pgOffset"
+.LASF661:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF563:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF889:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF676:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF610:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF877:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF857:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF692:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF908:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF484:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF694:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF427:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF515:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF560:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF748:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF492:
+	.string	"_ISOC99_SOURCE 1"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF426:
+	.string	"__DEFINED_size_t "
+.LASF1013:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF530:
+	.string	"__USE_LARGEFILE 1"
+.LASF844:
+	.string	"TELEMETRY_HOTT "
+.LASF819:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF884:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF970:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF727:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1038:
+	.string	"_Bool"
+.LASF1033:
+	.string	"from"
+.LASF604:
+	.string	"__restrict_arr __restrict"
+.LASF629:
+	.string	"__stub___compat_bdflush "
+.LASF961:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF422:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF450:
+	.string	"NULL"
+.LASF836:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF703:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF541:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF743:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF583:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF741:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF810:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF640:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF634:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF651:
+	.string	"__need_size_t "
+.LASF902:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF664:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF686:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF616:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF601:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF922:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF820:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1006:
+	.string	"__uint16_t"
+.LASF927:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF469:
+	.string	"__USE_XOPEN2K"
+.LASF718:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1036:
+	.string	"pgResetCopy"
+.LASF470:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1022:
+	.string	"__pg_resetdata_start"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF863:
+	.string	"VTX_CONTROL "
+.LASF599:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF645:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF502:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF413:
+	.string	"__size_t__ "
+.LASF519:
+	.string	"__USE_POSIX199309 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF754:
+	.string	"INT_FAST8_MAX (127)"
+.LASF742:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF772:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF815:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF783:
+	.string	"UINT32_C(c) c ## U"
+.LASF762:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF464:
+	.string	"__USE_POSIX199309"
+.LASF733:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF752:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF546:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF468:
+	.string	"__USE_UNIX98"
+.LASF833:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF485:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF866:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF717:
+	.string	"_BITS_TIME64_H 1"
+.LASF680:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF897:
+	.string	"USE_SERIALRX_SBUS"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF665:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF710:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF603:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF835:
+	.string	"USE_SERIALRX_SBUS "
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF750:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF568:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF495:
+	.string	"_ISOC2X_SOURCE"
+.LASF931:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF648:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF945:
+	.string	"bool _Bool"
+.LASF987:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1004:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF439:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF759:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF824:
+	.string	"I2C1_OVERCLOCK true"
+.LASF869:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF641:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1019:
+	.string	"pgRegistry_t"
+.LASF581:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1010:
+	.string	"PGR_PGN_MASK"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF962:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF899:
+	.string	"USE_SERIALRX_SUMD"
+.LASF760:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF753:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF919:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF642:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF971:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF872:
+	.string	"U_ID_2 2"
+.LASF591:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF903:
+	.string	"LED_STRIP"
+.LASF452:
+	.string	"__need_NULL"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF520:
+	.string	"__USE_POSIX199506 1"
+.LASF818:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF509:
+	.string	"_ATFILE_SOURCE"
+.LASF670:
+	.string	"__SLONG32_TYPE int"
+.LASF775:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF691:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF456:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF458:
+	.string	"__USE_ISOC11"
+.LASF534:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF861:
+	.string	"USE_SENSOR_NAMES "
+.LASF796:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF724:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF913:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF639:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF798:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF531:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF766:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF693:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF805:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF659:
+	.string	"_BITS_TYPES_H 1"
+.LASF734:
+	.string	"UINT8_MAX (255)"
+.LASF655:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF554:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF781:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF497:
+	.string	"_POSIX_SOURCE"
+.LASF938:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF516:
+	.string	"__USE_ISOC95 1"
+.LASF620:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF633:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF417:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1017:
+	.string	"address"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF806:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF936:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF828:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF573:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF489:
+	.string	"_ISOC95_SOURCE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF555:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF652:
+	.string	"__need_NULL "
+.LASF457:
+	.string	"_FEATURES_H 1"
+.LASF508:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF983:
+	.string	"VERY_FAST_MATH "
+.LASF453:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF722:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF860:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF585:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF807:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF915:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF873:
+	.string	"LED0_PIN NONE"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF675:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF878:
+	.string	"BARO "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF964:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF890:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF408:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF525:
+	.string	"__USE_UNIX98 1"
+.LASF711:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF526:
+	.string	"_LARGEFILE_SOURCE"
+.LASF592:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF403:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF965:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF477:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF906:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF995:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF505:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF524:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF827:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF826:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF435:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF957:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF613:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF932:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF463:
+	.string	"__USE_POSIX2"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF914:
+	.string	"VTX_COMMON"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF431:
+	.string	"__need_size_t"
+.LASF420:
+	.string	"_SIZE_T_ "
+.LASF538:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF894:
+	.string	"SERIAL_RX"
+.LASF816:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF432:
+	.string	"__wchar_t__ "
+.LASF622:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF627:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF447:
+	.string	"__DEFINED_wchar_t "
+.LASF658:
+	.string	"_STDINT_H 1"
+.LASF918:
+	.string	"BLACKBOX"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1048:
+	.string	"pgResetInstance"
+.LASF765:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF946:
+	.string	"true 1"
+.LASF608:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF437:
+	.string	"__WCHAR_T "
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF839:
+	.string	"USE_SERIALRX_XBUS "
+.LASF558:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF501:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF795:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF589:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF553:
+	.string	"__LEAF , __leaf__"
+.LASF402:
+	.string	"_PTRDIFF_T "
+.LASF607:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF549:
+	.string	"__PMT"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF990:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF697:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF510:
+	.string	"_ATFILE_SOURCE 1"
+.LASF666:
+	.string	"__SQUAD_TYPE long int"
+.LASF900:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF787:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF480:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF624:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF401:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF812:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF986:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF847:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF619:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1018:
+	.string	"reset"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1001:
+	.string	"unsigned int"
+.LASF721:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF790:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF550:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF978:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF476:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF473:
+	.string	"__USE_LARGEFILE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF944:
+	.string	"_STDBOOL_H "
+.LASF446:
+	.string	"_WCHAR_T_DECLARED "
+.LASF846:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF521:
+	.string	"__USE_XOPEN2K 1"
+.LASF514:
+	.string	"__USE_ISOC11 1"
+.LASF704:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF663:
+	.string	"__U32_TYPE unsigned int"
+.LASF404:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF580:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF584:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1009:
+	.string	"pgn_t"
+.LASF606:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF632:
+	.string	"__stub_gtty "
+.LASF433:
+	.string	"__WCHAR_T__ "
+.LASF745:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF700:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF738:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1047:
+	.string	"pgVersion"
+.LASF1050:
+	.string	"pgRegistry_s"
+.LASF1045:
+	.string	"pgIsSystem"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF649:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF855:
+	.string	"TELEMETRY_SRXL "
+.LASF595:
+	.string	"__wur "
+.LASF528:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF904:
+	.string	"TELEMETRY_FRSKY"
+.LASF947:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF788:
+	.string	"UINT8_WIDTH 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF777:
+	.string	"INT8_C(c) c"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF410:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF669:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF715:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF544:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF679:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF876:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF979:
+	.string	"sq(x) ((x)*(x))"
+.LASF688:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF556:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF612:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF562:
+	.string	"__STRING(x) #x"
+.LASF1000:
+	.string	"unsigned char"
+.LASF891:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF609:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF981:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF713:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF434:
+	.string	"_WCHAR_T "
+.LASF880:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF879:
+	.string	"USE_FAKE_BARO "
+.LASF653:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF409:
+	.string	"_GCC_PTRDIFF_T "
+.LASF966:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF999:
+	.string	"char"
+.LASF557:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF618:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF415:
+	.string	"_SIZE_T "
+.LASF442:
+	.string	"_WCHAR_T_H "
+.LASF740:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF969:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF881:
+	.string	"USE_FAKE_MAG "
+.LASF917:
+	.string	"VTX_TRAMP"
+.LASF577:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF737:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF921:
+	.string	"USE_DSHOT"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF956:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF400:
+	.string	"_STDDEF_H_ "
+.LASF920:
+	.string	"USE_SERVOS"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF419:
+	.string	"__SIZE_T "
+.LASF840:
+	.string	"BLACKBOX "
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF874:
+	.string	"GYRO "
+.LASF792:
+	.string	"UINT32_WIDTH 32"
+.LASF941:
+	.string	"__disable_irq() "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF896:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF460:
+	.string	"__USE_ISOC95"
+.LASF1049:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF459:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF467:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF909:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF993:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF597:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF564:
+	.string	"__BEGIN_DECLS "
+.LASF1014:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF445:
+	.string	"_GCC_WCHAR_T "
+.LASF749:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF939:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF725:
+	.string	"__intptr_t_defined "
+.LASF523:
+	.string	"__USE_XOPEN 1"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1016:
+	.string	"size"
+.LASF852:
+	.string	"TELEMETRY_IBUS "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF393:
+	.string	"SITL 1"
+.LASF490:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF461:
+	.string	"__USE_ISOCXX11"
+.LASF423:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF976:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1008:
+	.string	"uint16_t"
+.LASF623:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF405:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF746:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF997:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF500:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF875:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF588:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF465:
+	.string	"__USE_POSIX199506"
+.LASF803:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF779:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF784:
+	.string	"UINT64_C(c) c ## UL"
+.LASF886:
+	.string	"USE_UART5 "
+.LASF972:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF895:
+	.string	"USE_SERIALRX_CRSF"
+.LASF532:
+	.string	"__WORDSIZE 64"
+.LASF441:
+	.string	"_WCHAR_T_DEFINED "
+.LASF850:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF958:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF636:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF856:
+	.string	"USE_DASHBOARD "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF570:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF672:
+	.string	"__S64_TYPE long int"
+.LASF421:
+	.string	"_BSD_SIZE_T_ "
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF567:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF438:
+	.string	"_WCHAR_T_ "
+.LASF1026:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1034:
+	.string	"version"
+.LASF436:
+	.string	"_T_WCHAR "
+.LASF512:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF662:
+	.string	"__S32_TYPE int"
+.LASF736:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF444:
+	.string	"__INT_WCHAR_T_H "
+.LASF830:
+	.string	"USE_PPM "
+.LASF774:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1042:
+	.string	"regSize"
+.LASF454:
+	.string	"_STRING_H 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF720:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF780:
+	.string	"INT64_C(c) c ## L"
+.LASF537:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF786:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF817:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF982:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF989:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF823:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF800:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF630:
+	.string	"__stub_chflags "
+.LASF868:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF968:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF479:
+	.string	"__USE_GNU"
+.LASF831:
+	.string	"USE_PWM "
+.LASF429:
+	.string	"_SIZET_ "
+.LASF959:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF706:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF887:
+	.string	"USE_UART6 "
+.LASF832:
+	.string	"SERIAL_RX "
+.LASF849:
+	.string	"GPS "
+.LASF511:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF825:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF699:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF677:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF892:
+	.string	"USE_PPM"
+.LASF600:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF478:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF493:
+	.string	"_ISOC11_SOURCE"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF862:
+	.string	"VTX_COMMON "
+.LASF590:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1029:
+	.string	"profileIndex"
+.LASF758:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF565:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF536:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF930:
+	.string	"USED_TIMERS 0"
+.LASF799:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1005:
+	.string	"short int"
+.LASF399:
+	.string	"_STDDEF_H "
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF488:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF548:
+	.string	"_SYS_CDEFS_H 1"
+.LASF730:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF963:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1039:
+	.string	"pgResetCurrent"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF578:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF992:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF801:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF615:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF667:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF644:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF412:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF626:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF576:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF684:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1021:
+	.string	"__pg_registry_end"
+.LASF937:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF579:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF668:
+	.string	"__SWORD_TYPE long int"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF587:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF517:
+	.string	"__USE_POSIX 1"
+.LASF767:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF764:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF673:
+	.string	"__U64_TYPE unsigned long int"
+.LASF625:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF949:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF506:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF829:
+	.string	"USE_CLI "
+.LASF527:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF660:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF776:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF594:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF598:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF443:
+	.string	"___int_wchar_t_h "
+.LASF1025:
+	.string	"memcpy"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF804:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF923:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF614:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF702:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF602:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF689:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF729:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF507:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF428:
+	.string	"_GCC_SIZE_T "
+.LASF883:
+	.string	"USE_UART2 "
+.LASF998:
+	.string	"short unsigned int"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF448:
+	.string	"_BSD_WCHAR_T_"
+.LASF744:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF814:
+	.string	"UINTMAX_WIDTH 64"
+.LASF513:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF678:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF739:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF496:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF751:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF566:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF498:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF518:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF690:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF621:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF813:
+	.string	"INTMAX_WIDTH 64"
+.LASF731:
+	.string	"INT16_MAX (32767)"
+.LASF643:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF682:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF529:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF683:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF933:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF822:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF984:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF916:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF424:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF382:
+	.string	"unix 1"
+.LASF494:
+	.string	"_ISOC11_SOURCE 1"
+.LASF723:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1024:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF755:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF925:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF646:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF540:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1041:
+	.string	"base"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF650:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF647:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF948:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1015:
+	.string	"pgResetFunc"
+.LASF709:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF811:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF853:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF838:
+	.string	"USE_SERIALRX_SUMH "
+.LASF411:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF988:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF571:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF628:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF905:
+	.string	"TELEMETRY_HOTT"
+.LASF1030:
+	.string	"profileCount"
+.LASF685:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF885:
+	.string	"USE_UART4 "
+.LASF481:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF474:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF893:
+	.string	"USE_PWM"
+.LASF934:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF377:
+	.string	"__linux 1"
+.LASF440:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF843:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF491:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF657:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF637:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF714:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF769:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1032:
+	.string	"pgLoad"
+.LASF499:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF708:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF929:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF785:
+	.string	"INTMAX_C(c) c ## L"
+.LASF867:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF605:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF911:
+	.string	"TELEMETRY_IBUS"
+.LASF907:
+	.string	"TELEMETRY_CRSF"
+.LASF789:
+	.string	"INT16_WIDTH 16"
+.LASF551:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF924:
+	.string	"USE_PROFILE "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1089:
+	.string	"target.h"
+.LASF1070:
+	.string	"libc-header-start.h"
+.LASF1078:
+	.string	"stubs-64.h"
+.LASF1061:
+	.string	"/usr/include"
+.LASF1060:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1086:
+	.string	"stdint-intn.h"
+.LASF1091:
+	.string	"stdbool.h"
+.LASF1081:
+	.string	"strings.h"
+.LASF1080:
+	.string	"__locale_t.h"
+.LASF1055:
+	.string	"src/main/target"
+.LASF1067:
+	.string	"string.h"
+.LASF1087:
+	.string	"platform.h"
+.LASF1051:
+	.string	"src/main/build"
+.LASF1065:
+	.string	"stdint-uintn.h"
+.LASF1064:
+	.string	"types.h"
+.LASF1092:
+	.string	"build_config.h"
+.LASF1085:
+	.string	"wchar.h"
+.LASF1054:
+	.string	"src/main/target/SITL"
+.LASF1071:
+	.string	"features.h"
+.LASF1084:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1088:
+	.string	"common.h"
+.LASF1079:
+	.string	"locale_t.h"
+.LASF1058:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1090:
+	.string	"common_post.h"
+.LASF1093:
+	.string	"maths.h"
+.LASF1063:
+	.string	"stddef.h"
+.LASF1077:
+	.string	"stubs.h"
+.LASF1053:
+	.string	"src/main/config"
+.LASF1066:
+	.string	"parameter_group.h"
+.LASF1072:
+	.string	"features-time64.h"
+.LASF0:
+	.string	"./src/main/config/parameter_group.c"
+.LASF1075:
+	.string	"cdefs.h"
+.LASF1083:
+	.string	"typesizes.h"
+.LASF1074:
+	.string	"timesize.h"
+.LASF1068:
+	.string	"parameter_group.c"
+.LASF1082:
+	.string	"stdint.h"
+.LASF1057:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1056:
+	.string	"src/main"
+.LASF1076:
+	.string	"long-double.h"
+.LASF1059:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1073:
+	.string	"wordsize.h"
+.LASF1052:
+	.string	"src/main/common"
+.LASF1069:
+	.string	"stdc-predef.h"
+.LASF1062:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+	.text
+	.section	.gnu.lto_.profile.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375 \270\335\003"
+	.string	"\224\005\254"
+	.string	"\n"
+	.string	"\342\271\271\232\t\004\002"
+	.string	"\002\001\002\002\002\001\003\310\211\230\272\b\004\002\003\002\001\002\004\002\004\004\375\333\340\341\003\002\007\313\263\271\350\007\004\002\001\b\345\332\323\263\r\t\336\367\357\221\002\002\n\266\206\221\356\002\n\013\356\216\350\245\f\251\302\311\210\005\b\r\201\377\327\337\017\b"
+	.string	"\r"
+	.string	"\017C"
+	.string	" \006\b"
+	.ascii	"b\216\2605\251\214\225\006z\276\001\313\310\324\207\251)\016"
+	.ascii	"*\274\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\275\004"
+	.string	"\362\207\022\023\260%\351\224$q\034\006\317\314Z\333\b!\215\354-S\n\256\272`7\260\016\305\n\260\256T\230v\020KC\235\371K/FWlu \316\245\324\3106B\226)\336\244\234\313\241\r{z&`\021\246\211\307\32277\366$|\020  P\002A\250\335\006\026#\220\030\352\341\200\317\301\212\rJ\302\300@\275\260\244A\r\314\366f[x\022"
+	.string	","
+	.ascii	"\320\247\337\327Y\346\260\013+V\007\210\202F;\347\232\225'\265"
+	.ascii	" \213\263s\331\rlX`\311\266\274\002\027\243pn"
+	.text
+	.section	.gnu.lto_.inline.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\023\003m\017"
+	.string	"\366\325MA o\223t \346\242\t\307jV\336H\277\217ff\232\016\370V\316\"\005\016 \305\037p~\017\002e\206`\302\327\307\203\217Y\200\240@\306\232*\001qY\204\314\224\201\215\b\033j\255\265\326\310\226;\0053"
+	.string	"9"
+	.string	"E"
+	.ascii	"\016\313\335\r\301\351E\352\306\227O\305qL\320\274\377\207\204"
+	.ascii	"\030\017\216c<\371s\270\336L\276\367^\365#i\222\"\242\221\365"
+	.ascii	"Q\323\013\033\022)\004\374\265\243\002kZv&A\357=\352f\267Z\244"
+	.ascii	"\016\336{\233\267\276\344T\226K\305\253\210V\037`\226#\203\251"
+	.ascii	"*\311\356D\347\303\351\230\372#L\257I\031\020>\324\350P\320M"
+	.ascii	"h"
+	.string	"\003]\007\235\017\307\343\r\034\205J\260\260~\244-V\230`\b\220++!(\020\370\2320=\200\222\023\013&<\266\034\306\363F\265\265\353@\372\341dpQ\t'\034\201U\033TH\021\251`W\b\234e\007\222\033F!P\003\377\2733\311\001\305\246\241\033\f\025\024K\236H\360\020\312\346@,\013\210\372\305\3623}\321\351\240b\207\333\364\013\272\215b\224\030(IA\200D\314\0300\2469p\371b\251\252\033\202\230\225P\002J\250\341@\246\224`JhF[h\315`\002\031\232I;\022 \243y\006Dzc\023T\230\264\245u\353\237\001\3428:z\027\3354a\277\377/\263\032Pv:\334\325vK\004!\026\210<\3122\034\224\306@\262T\304\346\222\340\021rb+:\217\207\206\217\005p\244gPm\3246;\343\260\026\356\261\327\277\260\325\220\301\364\345\352\225I\313\326(\204\260M\352\323\210\035ZN\234xu"
+	.ascii	"\217\031\"\245\354\246\234\225\372\351f\031\243\023O\210\314"
+	.ascii	"\323K\240s\252[\250\312\336\360\304\317g\f\222T3\305\0079.\223"
+	.ascii	"\033\203\350>\304\211\252\r\345\255\216{XSp\307\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`k\001M\007"
+	.ascii	"\202\313 &\220\245I\007\340\317\267_\274\303i\350\327\371\377"
+	.ascii	"\377\022/\365\342^\331\335\035\210\034|\320\335\255\355\377\226"
+	.ascii	"|\262e\332\001\206\315\373$\372\200\273=9\244\036R\035\221\001"
+	.ascii	"~\361m\331\243\211\027\244\343\260\326Z\r\342\266\246\302&6\227"
+	.ascii	"n\020<@\263\247)i*]\371\026z{O\300\346}\371\032I\363>m\375\376"
+	.ascii	"\232\024PNZ\361\211w\356\314\262m@uf\235M\221\235\242\315\316"
+	.ascii	"\244\220\336\265\343kh5\004) P\0021(\231\035\323\224\027\007"
+	.ascii	"\370\201\201\004\214\337\334M\322\315Km0\222\003\230\031\032"
+	.ascii	"\201\201s\026\317\257\270c\242\263\305]\262\"\204\013`\304\262"
+	.ascii	"\354\356\017;\030\202\221\213\310\265\"3\"@ \334\204\204\252"
+	.ascii	"\253\355\361\324x\247\035\324\001\264\255m^@hn2b\340\253\305"
+	.ascii	"0d!@`\0236\264\353\006"
+	.text
+	.section	.gnu.lto_.pureconst.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\231\004\003\231\004\004\205\004\007\231\004\b\231\004\t\231"
+	.ascii	"\004\n\231\004\013\231\004\f\231\004\r\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\255\005"
+	.string	"\"\210\032\"\2207\351\360\335\335\267\206\313\0203\237;\231\236\250x\351N\226\322_\235-)bc#\264\211Z\2232\005;\017\324\250\235\306y\240\346\270z\f\256S\265T\020E#bH\337M\007D`\370\031{\351\241\222\351\006\376"
+	.string	"\177k\301\364\226\362\032\221\251\224+\215V9ky,)\021\265\033[\241\214\2619W\355\254dz2\341\211\b\037"
+	.string	"\035\273\340d\354"
+	.string	"r;\233\215\177l2\024\006\231\301 \001\313A\024\233t\246E\250\234\006\265\320\3422L\005\216\001&\026\206\"p\f0a\206\244o\306\210pj\245\314@\273B\211i*\212P\241\267\334b\261d"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.4ff6681690705199,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pgFind.7.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\024\003-\027"
+	.string	"f\252\224I\300RRc\312\204\n\216\272\215\024\ra\314vN\374\335\260\362\031K<\362\300:\354s\266y\326\001\034\254\322a\264[y%\025dv?z\377qp\210Sp\240f\026\275f\b\235\373 \220\n\351\3058(\332\336[n)S\n}"
+	.string	"x"
+	.string	"\203"
+	.string	"\036d\225\336\311o:\213\233\2336\266\367\006MY\335k\242XAy\033\200^\351K7\326\231\230F=\024\224zg\327\275f\314\346K\306\333\362$\343m-r)\232\367Hu'G+V\252\3635\234\034\361\365~\236\356\370xtD\341sk\177C\035\037\210\213\"\003\246\244\243\021\337\006\261>\005i\300|8\264\376|\311\210\237\326\224\317\347\224\234\335{Mu|=wy\333?\266ml\352#\225\310\376JV\215\022\256C\366\313R\227\344\315\177\264\324\326\324\364\300\373"
+	.string	"\"\364\202$Z\367v\030\016\271X\026\306\211\003\177\373\376\357R5\207\362\243\b\220H\272\367\302n\203W<c\\-u\275xd\246\017\326\034\25031o\317\255\20498Pn\313\037\331\241\376\344\237%\220\314\376y\240n\306\343"
+	.string	"\241\b\323\326\275&\202[K(o\375_\215\r\273\275\377tc\303\3542\365\365Uwl\232\241"
+	.ascii	"* .\261\022\325\261\342~<p\250\020\373\301\377\374\203\"\254"
+	.ascii	" [\005\206\257\215\266\226\325\344G/\004\3170\267\272P\336\213"
+	.ascii	"\263\342We\210\361\221t\343\255\255\007\0365\355\350\320\227"
+	.ascii	"\272\275!\024\365W\016 <L\\\365\301\237\270\020\251:z<M\325J"
+	.ascii	"\344\027\271\003F\367\346\\\307oq\0276\361H\267\236\311\215\327"
+	.ascii	"\311\215\267\007^\027\264;/\252\020\272\323'\b\263.\025\332&"
+	.ascii	"\217\006\266P\243\341\252e*\tTV^\026\270\244\f\220\251\335\252"
+	.ascii	"[Rn\030l\270Z\005\034\215\206\026\303\202c\271\305j0/2\266\226"
+	.ascii	"\230\f\fKL\254\005\227\213\245\030\260\355F\303\305hl6\\\ff\356"
+	.ascii	"^\207\304\025S\301\252\361T\267\370\252\224V\317v\225g\202\254"
+	.ascii	"D\226\211\260d%\205P\317\274\356xF\256\224A{m`\343\347\035|\020"
+	.ascii	"\232\355\250\360\342H\326\003\177rR\311\372\234\024<:\364\317"
+	.ascii	"\237g\207\220J\001\r]Y1< P\002!\344\334u\230\223\312\324\201"
+	.ascii	"Q\030n\226A\264P\257\257\341HRuJ\031ew^\316\231\245lr\201PY\035"
+	.ascii	"\360D\350\375`{\n\361\325\325\311v#\211m\355\322z\225\345\033"
+	.ascii	"\243\215\007M\263%\224\344\005h\331\205Z\324 \3178\264\251%e"
+	.ascii	"\035X\237\350\016\255\304\327y\225c\357\225\351\222X\215m\211"
+	.ascii	"\b\3348\217\341\360}\214\355\273\255%`\306\374\004\331`k\255"
+	.ascii	"\207\335\203p\f\317>\261+t\r\355\ru;\277\217(,\303t)2"
+	.text
+	.section	.gnu.lto_pgResetInstance.9.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\\\003\305\030"
+	.string	"f\254\235H\260\030U:\020\033\300\321\031j\223\t37&\233T\007\226s\342\231a\004\255\f\324'\303\013\347\311\305\367\313\033\320\3460\255\311n\223\260kN\241\353\013\344\037,O\253J\261\332V\271A2\376N\316\341h\t!\233\310\235d\206"
+	.string	"\202"
+	.string	"\211"
+	.ascii	"-z\226\030\356\224\257\344\214\326\351\356\203\\\310\355?\333"
+	.ascii	"\003t\023iQ\322}6\330\007\345\353\236W\215\257\345k\306\327\275"
+	.ascii	"\355r\371\351\353\bYvA\246\356f\361\215\337N\216Udz\333\223\256"
+	.ascii	"\027Xx=\241\223\243X\023\003\311\225To'2\270\302C\006\2527D+"
+	.ascii	"\273\030\362z/.\212\013\226\226\200Q\255\320\301C\365t\224S\275"
+	.ascii	"\023\342\252\273\037<M\321\313QJ\272\272{)\257\327\342[~wm\273"
+	.ascii	"\253\333e\235bv\317\034e\033\273\027\273\273\227\211vOtS?\377"
+	.ascii	"\231\023\335\323\177\177Y\322\255"
+	.string	"$]\221\244\313#]Z\351\236\206\246\210\200$\335+\206c\232Je\262c_\364#\273\250\rz\221\275\021\t>\200t7\352F\256\034\212\026\201Hg\020\246\322I\353\364FA\377\331\006\234\335\342Hdv,\230^\367EA\273\250\327?\270(\362G\353C\016\274\235\310\b\261}\256'[\226\272O\233\327\275P\276\002\240d\216\264\273\205\030\351\245\300\327=t\336\276\311\205;\342Zx\215\347\275\306\036\340\024\035m\332]\fg\222A\225e5|\t\317k\312\327\335\224UP\224h\350\331\3463\274\0333\351y\273\032b!\376\256\214*I)\305'\362\007\257s4#\314\022\202\341e\343\211SL@\270\203\221\333\331\217F\224\335\272\234=\222\237\016\373\034\266\361\365\304\017j\371\341\350p\177\344\325K\215\033\371\251J\223\n\032^J\276\321W8*fUB\245\246\001\313\301$1\333\221\2315\322\004\001\353\021\267\205\343"
+	.ascii	"'\307\007\302\206\033\0032\263\306\033\273\001\022A\253\311x"
+	.ascii	"jf\b\323\003\254\006\003b\311f>?\264\030\353g\006\363\300\212"
+	.ascii	"\325@\260n\022,\r\310\254\261B\320h5\026\352\304]l&\252a\250"
+	.ascii	"\3408G\036\240U\344]\235\250\374#\312\"S)\346\027\212\203\206"
+	.ascii	"\225\036\343\204\221\331\004p\013ef\026\356\312|\350\3028\206"
+	.ascii	"\024%\325\002\364L\231\202\2169e\233\b\001\342\023\331\306>\351"
+	.ascii	"u\341\223\n\374\003F\321\321\246\007E\250a\030\b)\346\224)\t"
+	.ascii	"DFdH\n\322\006`\002\021\242u\007\022 G*\025\260\266\353\377\006"
+	.ascii	"Uj\247\351\353\240\030u0\005[\367\213\217\331q\241T\274\300h"
+	.ascii	"C\377\277\205\\!\260[k\241\205\360\316\020\220\n\311\364[\005"
+	.ascii	"9\2000E\300\020\002\307M\340\2125b\26618\001\315\377\270\353"
+	.ascii	"\023\324)|\251\360\326qY\325\274\030\233\334\022qc\0228\003a"
+	.ascii	"I\205u\345qMV\023)\037=\023\b\372\247\t\337\357\333\305AE\226"
+	.ascii	"3\007\b\243*\266\304\276X.\024\366\304\244*@n$E\005"
+	.text
+	.section	.gnu.lto_pgReset.10.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\273\0045\036"
+	.string	"\366\264\273H\240\330Qc\301\207"
+	.string	"\234\027\332\302\355\217*\266\330\343O\354\271\201&\262\217\030s\343\207d\245\261\027\350r\215\274H\327\360\233F&&o\220\326\302\365\030\037\035/\332\001ru\032\2356\353z\32604b\221\333\310\336R\246\024\234"
+	.string	"\251"
+	.string	"\246"
+	.ascii	"U\366\225c\237\211\357KP\344\202F\026\232\260\274\356-2\370\351"
+	.ascii	"\0177\006\331\264\237\325\207\372\3314[f\224S\353\237\374\342"
+	.ascii	"\225\374\356\344\244g\367\336\320\242\272\3676\260\006\364\347"
+	.ascii	"\315\214\211\311y}\022\277\351H~'\n=\300\275KO\250\356-60\004"
+	.ascii	"\364\247\213\257\211\375D/ \366\323?\233\213\r\213Z\230\320\b"
+	.ascii	"v\357"
+	.string	"\305\331\034\377\335\264\365\347\377\351\263\243\341\320M\244[s\201\022\307\026\333\220\310,Pc\013\351\310\327\026\303`\255\262\334\275\327\365h\030\343>o\273\202\355\241m^\005\325\263\037otV-\233U\307j\265y\342o\357\364\037\300\203\031\003\226\367\276X\212\271\\g\225\217\037\177\373>\326\267xZ\005z\024\3112\222\305\243\022\206\305\263i\277\n\272\024\337\212B\016\260d.htM#\022\226&0\364*\031t\242\220M\361\306\270\325\030\241\021\260\037\375\252#\375\373\371\016\345G9U\006\250\"\367^\332\357N&nC47\270\245\312\224q\"\370\356d\302f\202\027\373R\346M\242\271DP\302dH)\242\2205\272\320$\345\005\305\3473y\224LK\224\337\344N|\177\002d^\035\271)S)\372\223&_\274bvf\021\030\205a[?\303h}\246\024\223U#\004\265?~\202\022\360h\017\277\242;\240\003\265"
+	.string	"v\324"
+	.ascii	"\351\222\331W\375\310cp\342\365\305+\301\362;\261\230\225Y\002"
+	.ascii	"IaR\320\351\225@\350\275D\022|\256\024;\237\207\220\2751\013"
+	.ascii	"\021X\227\376\325\317.7\256\325gJ0.\276\272\334\344o@\3447\330"
+	.ascii	"\350\242\372\214\211\206\225\013\265\002"
+	.string	"\001Z\364\251;g\355\245\376\247W%`\r\343/\357d\354\326\264\256\302\244`]\272.\031v\335\032\306.\006\253e\262o^\273d\333fh\325\265ZM\253\32522\001\026\221\252\350\321\260K{\262\024H\007\302L\221\206\360\271\220\222\350\341\341\365~j\316\301q\200#\201'B\210\033\003\273\264g\275s\363\343\343\365v\036z\351\211\264\204\256\247\373\301\355zx|x;8\237\036]\t\334N\017\bw\243\300\274\237\264\207;\301\343\365p\264\"\360\346\265K\246\rA\276BT\215\212Z\233m\241#\203\013h\203\026Pm\326Z\233C\207\372#\337X\330\241)\353\300\340:\322e\263?\2323\366\307\337j\026\2653\366_EAh\266f/cMK\263/\372!\2632\326&S\"?~)\225\254e\362G\304f\026\304\323\026Q\005\243\023\245\024b\250\2018F\0343\306j&IRR\2206\200\002\021*;\017\022"
+	.string	"\2679\222\036\245P\331g\337$\276\225L\377\311\002xY\340\317h\310\361\253|T\376\031;\355\f\\H\3725\270\001\253\213\251P\250l\333dVX\265\204\2401\253\t\343\347sc\007G\030\223P\301.\217\006\353\373\271"
+	.ascii	"QR\243lvXk\t\246@\203U\222d\037bc/Q\313Zs\025c\rH2\n`\210\213"
+	.ascii	"~2\346t\351\300\337\003\225\333\331\350f~\302\341Z\264\303\033"
+	.ascii	"\t\334\275\020x\243\374\002G,iJ\361^\252\274\215\260x'\346l&"
+	.ascii	"X\215\266*\370\253\374]\024\217\347\263\005\311\373\360\354\276"
+	.ascii	"\206\367N\200X\016d\013\214\004\327\274Y\366\244\0215\017\205"
+	.ascii	"tj\222O\365\236B\020\177"
+	.text
+	.section	.gnu.lto_pgResetCurrent.11.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\321\001\355\020"
+	.string	"F\337pH\320TQ:\303Vk\032d\026O\030\375-\373\002f\003\375\340\256\200\250\b(JF\252;\"\b\030\255\277[\333[/\320dDf&\260\377\365k\360\305\003\274\362cv\340\273sB\036\242C\305H\323\254pR\311\336{\247\024X"
+	.string	"Y"
+	.string	"_"
+	.string	"\006vot\364\354\216\017\214\342\275z<\202\356\325\373\201\356\325.\233\310\307\024\373\233L\314\316\317\356~\023\305]\257tJ\227\377\332E3\361\365\352\321\234\006\020i>i\202\232\035!\b\2102\332 gb\310k\2272bLJ"
+	.string	"+\273k9\023g\356\356\266'\330\326`_(\363\306\256\322\035\225\246\247\375sJ_\324\301\310\225\004\331\0051\024\264>\365\206\013?\347:\254\217\376m\212\270\321m+1\017KyD\344\300\371\331\035\035\274z2l\254\323Z%\343\316\234\207P\007\034?\257~\016\313\036\275\336\037]\366\310\356\200\250\\\276\346\343|\206\353\264\326\003\273\237&Bh\002p$d\213YMn\032\246\353f\205[\017\231Lb\337\366\327\356\375x\321\203\244\b\235\335\\\260\023#d\36042x\273\262\024\037\267\301\305_\321\352\316\243\202\006\223C\276\316+P\211\337.\312\005}`ad\316\333\316"
+	.ascii	"&\201,q#|\254\004\262\307\230\234'\354\323\335]\007\276\240r"
+	.ascii	"\002\341$\205%\202\005\222\002\324)\2346\221V0`\210\242\020\236"
+	.ascii	"^N\252RXZ}\250\024K\013h\372ZR%\325g\n]>\222\211\301\325)\374"
+	.ascii	"^@0\374F#\354t\347\215%\304\360\201\315X- K&\371\231\351|\335"
+	.ascii	"\306\221\234\r\035 ?\347\264Q)\371\231Ql8\314\227m\f\257\241"
+	.ascii	"\3626# @\002B\230\2047\221\311c\272\201#k4;\n\254\302\013\257"
+	.ascii	"@0\2418\\\361\241\r4\310\245X\033[C\255\306\355\202\313\206\225"
+	.ascii	"\215\022\307FI\264)\t\005\305Y3\2600\003AC\217\307m\0247\300"
+	.ascii	"\305,V8\004\313\2510\251\231\251\345E\310\326\344\032W\206\002"
+	.text
+	.section	.gnu.lto_pgResetCopy.12.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\233\004E\037"
+	.string	"\3067\305L\240\024R:\f\207\212\034\315/mXi\351\263/\313]\324\363\017\370O\360,X\355\231\312\r\203\314oa\267T\257\033\335\367r\267\336kK\256=]\033\367I\301\373\304\236\020\263\031\353\256\025@RI[\263I\314\214\226\020\262\311\336I\006\254"
+	.string	"\252"
+	.string	"\260"
+	.string	"^9\257\017\216\233Cz\026i\346\372\037\275\033w\032\347<#Y\223\036\017\260'\016\232\265\335/\276G\357OM\345\004r&.]\345\274Bh\t\351q\2577p\036\247\1779\217e&\364\332\3675\211\305\215\204z\216`9\257\263\213\324\251\271\276\261\365=EOl^\353\353\237xj!FU1\254\b(\350\250\351"
+	.ascii	"F\216\344\273~\202\314\003N\254\232~\354\261\247\200a\360\313"
+	.ascii	"[\237!\320b\034/n\232\025z8\321\0200\3441\257\0219D\035\006\355"
+	.ascii	"\375\362\006\210\240\236P\r_\334\24249\347\266\302!\320[\366"
+	.ascii	"\356\336\321\335\271\333\354\020\266U\227\324\266,\265\235^\371"
+	.ascii	"F\377\364\343\033\377\333\266\017 \300\r\"!\243\241\373d\315"
+	.ascii	",\266d\311\\8k\351\312\277\373}\344\265\272\325\326\371U?K\201"
+	.ascii	"\f\254\336QkK\246\202\206\355\261t\036\305C\260f\240_\215\005"
+	.ascii	"\301\300\250\256\354/{\326\bJ\321\351V9\007\322\257B\253,\235"
+	.ascii	"r\316j?i\346\244l\nap\245?4\323>\231s\343\216\203\013.xx\035"
+	.ascii	"\247B\264S]\252?\225\016\321\272?\225\363(\036\r0E6\221_P\212"
+	.ascii	"`R9}\244N\267z\374\356^\377\330\352)E\353\216\342=\007\177d+"
+	.ascii	"\214\210\0029c\227{\345a`\376r\242\327\345>\250#@\223\261\251"
+	.ascii	"!\342\226y\217Zv\357\335AE\341\261b\377\362\032\220\270\302\274"
+	.ascii	"\026l\271\315\231^\331Ep\245'\b\330\265\027\261\2459\363\314"
+	.ascii	"\364\211\350n}%\336y\234\336G\321x\372\331-}\255c$E9\353\262"
+	.ascii	"%XTT\371B\357\261\016#BK\327e2\305Hu\207\340\032$\345\034\274"
+	.ascii	"\260\037\344Bn\314+\035w\t\334y!\356<\276\362\276\031\277\345"
+	.ascii	"\315\246\242l\365\232\261\256\\\365\rH7\302\276\356}\362M\363"
+	.ascii	"\263c\375\343k\230\270\302\254d;\326\275\002\355=\352\376L\227"
+	.ascii	"\221\032}\211\3358M\342f\333]\234\233\3566\005\231\b23#&\210"
+	.ascii	"\210I\260\243\313\325\314\256\305\350x\271\335\r\304\316f\302"
+	.ascii	"\206\263\331\331\350f\267\233\0218\271\332\f\347\306\0067\253"
+	.ascii	"\355tf1\f:\247\263\355f&r\271\335L]\177\277\304>\231\330@.\317"
+	.ascii	"\276\357\224\201L\242\277\357\374\365\271M\363\273@\245\364\314"
+	.ascii	"z\261\370\252\267\333\303\007{a\303\240\270'\372\307\247M\232"
+	.ascii	"r\230\225\002KD&\364\036\231;\250\220K\374\255\267y\321\253n"
+	.ascii	"]\275!\240\244X >\272\324\373\250\377xY\026&\033\347=j\n1L\227"
+	.ascii	"\213\212\331[\225@\257O+\301\245I@\240\027\303\021\036+\226\241"
+	.ascii	"E\221\322\3149Z\250q\034\345\020q\316\214\210H\211\3144I\007"
+	.ascii	"@\002B\020\203Z\007\022\200\307!\325\220\n\323\376oDj\235\267"
+	.ascii	"\242e\263N\272\364\244I\002\245\310d?\202\355&\034K\336X\350"
+	.ascii	"\273\273\373\023Br\034\243)\331\200\032\007&\351\330h\b\302\322"
+	.ascii	"a0\363\204=\bD\034u\2235\230'\326\206\023\231\035\007\333\210"
+	.ascii	"\223\\\025g[Z\022\237\276{\2202#{\274W\366\006\267&:\353\322"
+	.ascii	"\t)\304T\365\\v\036\020\252\004\320\243\232\337\bw-\356\317\330"
+	.ascii	"\004'2F\204\001;\205\354\023TQ\353Y\3012\020\026\032\317\235"
+	.ascii	"\030\332N\340\277\027-\331\310\244\336\035q\345\347Q\003\206"
+	.ascii	"B\374w\200\246\231\201\032\224\t\220\254\327\261s\226\t\r=]F"
+	.ascii	"\022\213\232,\201\n"
+	.text
+	.section	.gnu.lto_pgLoad.13.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`j\n\0053"
+	.ascii	"JT\230\022HpZR\007wW\372y\262?\222\345\266\nE\3252\220\272\273"
+	.ascii	"\351\r\200\360U;\365\244\347:a\255\023G\246\002<f1U\251\270\004"
+	.ascii	"%\322\001\245\030C\204A\3671\364.\2631>\304\215\371C\204\307"
+	.ascii	"*l\223\275w\222)\005\021\001\016\001\024\001\017\"$\035\354("
+	.ascii	"\314?g\344\213\327]\267"
+	.string	"\247I\311\361\372\322\212\216=\355\353\351c\fy\225\275T\222\355e\216\346\203Ck\237\342fI?S\261\346-\241+f\257\223\353\354\r\366\331\025\273\275,\351RX\b-c\3445\314\355\211\327]\316\317\005\3166\322\2438u\003\235e\201\335\255\214'](\364\306\032\272\336d),\035F\272\3427\3519\341M\226\n\243A\302u\226\375R\304Og\242t\260\206\366/g\036X\316r\316\f\272\203\353,qe\331\212\216\273\335\313\227(\375\353\311\003\344\234Ev\226\363\223ACp\235\355\247\353\264\316\272\236\323:\333\312n9\177ne\017\013\322\024\273\3139\007}\017W\272\353k\331\365\261\262\235\314\177SUP\356:\017\033W\356\303\341m\363ebvU@\255q\265\352L\261\342\234\f\006^\255\374W\004S\254\270\232*\251u\250\203\315\312\325\034\317\250Zb\354\023\31297\236\252\262\341\375\363\356\246\352\356\255n"
+	.string	"\t\002\324\214\361\272\237K\374Z\335\276\346\317\352\006\"\332\340\376\301\270\013\324\340\366q9\357\236 n\236 \356\341\216\320\0067\001\214{"
+	.ascii	"\306\255S\203[\200G\275s\202\270q\274\211\373M\020\267M\020w"
+	.ascii	"\215\217\271\007\375\211;\r\306\r\f\342\376\371\227\273\353`"
+	.ascii	"\356-\306\275\322\340~\214\033c\334n\240\315\233\016\367r\246"
+	.ascii	"\332\313\313R\226\212\020\227s\217:\356v2v?\264\266\2735:1\355"
+	.ascii	"c\206@\244\030\250\224\275r\355s\376\202i\217\3630,T\226&B=3"
+	.ascii	"U\215\241\260 okUl\270\366F\261\373-\311\205\252\341B\331\242"
+	.ascii	"\344\3159/\310r\271\270\027\245.,\2236\267:7%,y\\\224\2648ui"
+	.ascii	":\004\322%M\"]\312\242\247e\251\033\350mN\216\245\235\215B\217"
+	.ascii	"\27351\253/nt\315\311\277\236\204\317l\303\255\234i\352\335y"
+	.ascii	"\264\375\212\253\265R\231t(\355U\334\n\021[W\316\031\250t\260"
+	.ascii	"\343\232\257\362\307i)b\354\320\016\357_\"\354\255\346\335\207"
+	.ascii	"p9\253/\215\315\327\274\020\312\324[\266\006\274\334\340\332"
+	.ascii	"\274\233\275}yq\266L\027\377-\271sk\353\204x\347\335\357&\352"
+	.ascii	"\200}\252\2110\036\252\333\243\320^\271\362\335\253\204\272\363"
+	.ascii	"\036]\205D\002\237\363\302w;\246\221\001O\340\275\251\367\300"
+	.ascii	"\037\360\316$\202\363:\377P#\227\243\331M\235\377Z\355F\255\200"
+	.ascii	"/\021\306&\205\315X\210\342\254\276\277\027\360>bM=\252\263x"
+	.ascii	"S\377M\363\244:Gr\336\243>\301\031\025m\017\276\367\241g+\347"
+	.ascii	"m|\350\024\241\342\274_qWs\016do\365\375\331s\020\355\357q~\007"
+	.ascii	"\332\274Zv\b\317S\341\346,%\241\035\217ID\373\217\247\326\331"
+	.ascii	"\337\273\330\333WT\233\263t<2\233\377\246f\250\316\320\3455'"
+	.ascii	"F\251\271\207\035T+\236\301\307Y\225.\227q\207z\013\271\357i"
+	.ascii	"\356d\216\235\276\347\rm\333\007~\343\346\325\022\357\265CA\372"
+	.ascii	"\020\261u1G\264\217{\366\302\322s@\214\302x\215\307\304\004F"
+	.ascii	"\245\242\025k\2370\276H\352\200dD\372\214\311\242\022+\3231)"
+	.ascii	"\2114\266\360\031_$%\327\245#\362hua4\3014dL\221ttD6\321t\361"
+	.ascii	"\201\203\007\022\216\"\230h\300\203dD~\0335hbqD\"\215@\032W\030"
+	.ascii	"\227\212\220EMAHIGLG\243 \246\244\242\245 #d2\250\301\201>6\031"
+	.ascii	"\221A+\216Gd\020\360\031\345k\376,2\257\300%\255\276Q\277t[\342"
+	.ascii	"\373\313\366<\220\017\376\277y\240\357\2760\004\301\311|\250"
+	.ascii	"80?'\327\263\372\002\275\313\371\210\357r?\337\363\304\002\377"
+	.ascii	"\003|\374\005\376\241L\"\313v\"d\r\257}-\234\335G\214\373;|\037"
+	.ascii	"\2721bz\336\345\344\332\003\226\321\303\363>\207\233\356\325"
+	.ascii	"\035\322\2657L\034\030'rF=\315X\225\272\276\277\255Qg\360\361"
+	.ascii	"\257\337\230Y\307\363\270\316\035\316\001\030\341\032R}\317\370"
+	.ascii	"\360y~\007\332\274\"\323!0S\305\220\214]\235\023\341\334\345"
+	.ascii	"\3025\244:&\310\224\016)\373Z\rD\242\346\253\227Z\323\f\347\374"
+	.ascii	"\316\317\240\t\200\333\250\2010\245\0343\246hDD\222$\205t\220"
+	.ascii	"\002\221\241*\363\022\300uE&\245C#\244\260 \225\312>\333\001"
+	.ascii	"\206>M55T\f\376'1\267\367r\224\277\023\177YDd#\254\235\024\362"
+	.ascii	"\250g;\275\024\223r\371\351\033\270x\355\0320g\374-\016Z\321"
+	.ascii	"'Z\330'\212O)8#\235fF\3678*9\177\032\026\f,\261R\356Q\t\360>"
+	.ascii	"\nb\235\234\352\372\226\332Y\245\353h\363\2521S\356\367\336\252"
+	.ascii	"0\356eev-\245{#c\250v?\345/\2002\310\223f!G\242\211\307+\330"
+	.ascii	"^\320o,\211*tA\231\003\fh\224\203p:\344I\340n4\025pM\022\255"
+	.ascii	">\f$cUpTi5\203[\032\246]U\023\302\302w\271\256\324\346\262v\240"
+	.ascii	"\031:\263\207\355\032\3328\\\361SPA\224\311M\301\276\2723M\275"
+	.ascii	"O\235\222\242v\2241\363\325\376\237\360\373\276\177\256\315\026"
+	.ascii	"\006\225\027\251)U\007\305\2628b\373\311\271\222\342\267\222"
+	.ascii	")\370E\213R\201\272\003\253&\253\341^\\2KSA\252\243\251h\204"
+	.ascii	"m\263k\270\2505Z\257\032\325e\212\376\266\352\2325N\220X\260"
+	.ascii	"\321\375\216\261\302\337\225\371\356\b AB5\244\350\2072\002\r"
+	.ascii	"\005\256\f\016\030 \213#\b\237\031\243j\032wU\332.\233t|\316"
+	.ascii	"E\347Z\300>\337\360\323\304\213\366\262\001\025:j\335'\036\205"
+	.ascii	"\025\322C[s\356\b1\306\376\2741\3127}\324\304\270\033\371\363"
+	.ascii	"\300\375\343\243Q\300\037S\313D\035\236\306\n\037\254\234&\033"
+	.ascii	"\031\013>\321_`(\312H\365\303\214\202\215\353\340~\013\363\024"
+	.ascii	"\311R\003"
+	.text
+	.section	.gnu.lto_pgStore.14.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\252\005m\""
+	.string	"\246<\324H\220\332Qc"
+	.string	"\207yp\327\235"
+	.string	"!\0257_\034\n\026\261\355Q\327\353\216\355\007\023\350e\355EkCj2s\304K2}H\260v\2213U\247\025\300\365*\340)q*^n\375\252L(\330\203\212T\333\022\262\267\224)\005\270"
+	.string	"\276"
+	.string	"\277"
+	.ascii	"G\300\260\246\302\356\035\026]\t\317\256\335\254v\317\317r\315"
+	.ascii	"\264\312\331X#N%\025\347\325\225$\311{\357\202\233\006q\232R"
+	.ascii	"=>\275[\2218\316\375]i\332\260#g\353\221\230h\332\2753\272p\335"
+	.ascii	"{\031\030C\215\\5b/^\026\316\233\246\213\334\253}\252\027\351"
+	.ascii	"}\230\364\234{\241\262\270\356\0352\260\203\363\246\207\247m"
+	.ascii	"_\352S=\233X\016\243\202\247\201\005\254\n\273\367\342n\337\221"
+	.ascii	"\335,\017@v\323\332x\357\245\255=\377Y/\205\300\310\322\024T"
+	.ascii	"z\351t[*8\322\350b\023\\*\t\304\360r\272\361\025E\360W\353\354"
+	.ascii	"\347\336\353\332\024\\q\233\267]\301v\f\333\004\022\266\335\310"
+	.ascii	"_\253\251\246\271\325O\253\251>\217\344\237}\370\313lui\253m"
+	.ascii	"\255\272\332\352\003\230\2758\032\330\2727\305X\231\373e:\321"
+	.ascii	"\361\342o\337\267r$\321\221\026\004\373*~\021A1c\205\310\256"
+	.ascii	"\235\212]3\357R|/\0029\204L\251r\322r\022\231\302\3730I\300\360"
+	.ascii	"\256x\2253\3000a/\372Qnt\257\227>\211\377\344PL%\260\032\261"
+	.ascii	"\274O\327r\261\222\263\365D\367\370\244\267\"!\340\332/>\264"
+	.ascii	"L\205u%\2011\234u\345^\3375L\262'(Li%\235\244\276\326\233\314"
+	.ascii	"\2704\361\231|+=WQy\243~\242l%w\347M\234:\023\223\263\257\225"
+	.ascii	"~\211\210\237\337\211[\006\3003Tn\222\361:\355Xf\312\316\017"
+	.ascii	"\233}\361\021\204Ek\370\226\r\006\242l\366\346\006\325N\017\344"
+	.ascii	"i\037\3457?\313/&\343\313\3675\301\211V\362\3463\376\202\f$\224"
+	.ascii	"W\270\301%\006\346\236x\377\370\272~\243YkkU\275j\201,\355\261"
+	.ascii	"^D8\263\267\245ue\ns\332\333\003\317\370\352\330\237u\032\250"
+	.ascii	"!B\261$\202\261s\220\321\330\323\016 \002\237~\356p\260\242\363"
+	.ascii	"\336\245\007>\226\235\316\307\221$\273Ic_\265\205\312W\307|\344"
+	.ascii	"M03~<\3558&\305\02602\373\257\337|\225\214\353\025\013\344\255"
+	.ascii	"d\354\341\257\332\032\366\313{\357\265\205\262url\252ql\365\215"
+	.ascii	"\255\332\346\305\007\006\201\232\030\262 \204\356f(O\347\241"
+	.ascii	"D\211tHe\t\364\203\021\0054\304PP\272;\252AM\f\361\312\024\251"
+	.ascii	":\327\323\240\347A\220\317\007\236\002B\350\316\032\210\347h"
+	.ascii	"D\272\023\352\260C\221\320\"\335Nw\204\023\032\n2J\201pFC\272"
+	.ascii	"\"\034\320\216\207\343I\340\364\b\335\341\220\322t\207\253\r"
+	.ascii	"}/\257\205r\r\210\361\345\224\021\270UmV\307\242\260]Z\bB\237"
+	.ascii	"\375y\366\204\fP\253\325\2615k_\310P\337\344\232\220\311*\021"
+	.ascii	"\273\376\254\323\204Cv\210%\245\220:\366\3052\347\206cm6\307"
+	.ascii	"^\f\223\217\033\213c\355\355\215\265D&\036h\2207\021s\024Z\243"
+	.ascii	"2\033\353\341\210\327R\035\363\033/A\211P,Icm\354\201\252t\250"
+	.ascii	"q<\246\220Bh\206D\002\221\321\244Plp\"\0313\263\r\022\240\227"
+	.ascii	"\261\242Rfa\251e\377\r\341\225\246L\373\331\232\361\026\366\220"
+	.ascii	"\247\334\212G\366B\215p\2007\3459U\363\254\373\002\305u\252\276"
+	.ascii	"S\\O\022\207\035\344NX\344P\n8h\036\034N}[\232N70\254s\200*9"
+	.ascii	"o\273G\037\237];}{\251\303d\031\333\271\002\364&\031+\317:\343"
+	.ascii	"$\336\020\270\331\274\352\205\225\027n\253\241\300\340\364\r"
+	.ascii	"\211\244\351\024(\202HV\030\304\352\320\257FmL\305\247\302\362"
+	.ascii	"\241\f\341\024W\226\331\211\320R\210\274\271\311\023\235h\024"
+	.ascii	"\246\334x\016\316\332$\204\366\204\240\215k\260\320\267\207\030"
+	.ascii	"n\210=\366\246\253\300\030b\243\3533\254\371\234E\214\237\317"
+	.ascii	"\321\370-T\330\335\231\266\232y)S#\371\t\267\243\344\300\364"
+	.ascii	"\336\360RY\227\322Gok+JZG\352U\3732S\b\346\017"
+	.text
+	.section	.gnu.lto_pgResetAll.15.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`{\013\2358"
+	.ascii	"\352\\P\024G`ZR:\367\377\355\020\240\267Kcr\3265\251\334\305"
+	.ascii	"\322\270\204\375\210w2\327\361\022D\231s\206\277i\353\362\r\255"
+	.ascii	"\245\202v\243\022\312\363\203<:\005}{\213\027\304\242\t\340\020"
+	.ascii	"V\210\365?\220\337\366l\226\220\275\223\f)\001+\001/\001\367"
+	.ascii	"g\222\376D\302=\262J\206IK\341\253\nW\3547\373_j[\354\356\344"
+	.ascii	"\237Hj\266j\346*\036E\300\212\3302I\335'\243\324\027s\257\026"
+	.ascii	"~\375\271y\365\273>F\351\316\033j\316*\226\241i\207\330\257>"
+	.ascii	"\367W\247\330}1}0\017\243t.\035\305e\217\254r\301\361\332\252"
+	.ascii	"\313\271\031\364\265U\260_\273\311\376G\330\255\252\025\177\273"
+	.ascii	"\277\365.\311{ih\003s\306\202\002\226s\246\320\030\330\257\304"
+	.ascii	"\003\371\276\252\377\361}Mv\317y3+\237\253\354\251\253.\347,"
+	.ascii	"\204\231\374\366\366\366\366\330f\325\346;\210\223\027\006\201"
+	.ascii	"\354\317\267\252C|\223\375/\017@\267L+C\265t\341\220\257\345"
+	.ascii	"\r6XRuu\240\372k\222\212r\351\224\020\225\303]+\366\264\246\313"
+	.ascii	".\251\262\372/\310}*\2047I\344\360P=\251\b\214\264\001\362\267"
+	.ascii	"\337(*\247\273\216\335\201\225\327\226\035V\225\220\253WZ}\250"
+	.ascii	"\002\3311\261\271t\212\210*\301\t\217)\244b\272\370__\223\254"
+	.ascii	"\241\203Uu\365\373+\346\234\373BQU\275\001\274\373\006\272\333"
+	.ascii	"HwPK\0273\273?`\211\025gc%\335\004\200\206\267\007\374\366\317"
+	.ascii	"o\013\020\336\016\360\351\333'x\273'x\233\347\267\001<\372\036"
+	.ascii	"\no\013\203\300{\371\331\340\355\337\245\357\373\347\373\007"
+	.ascii	"Ng\225$\212\327\232Yj//\243\255bR"
+	.string	">\375\243\277\364\177^\355\376\334Q\016\001\224,f!\304\314\264\322\3231\372\234~\353\201\t\\\027\020628#5w\246}9\177c\353\267\335\255\211K\315,5\365`\255\rZS\353\303y\234\225j\256\211L\315L5%\202\253\254U\361\212\235\226\307.M\261O\256\263Vj\324-<\332\361\f\207\275\325\231\261[\314\216\177\"\031h\346\252\233\351=\315\325\2719>\332_s6-\354d2\304VT\351i\372j^FBL\362`5\210K>y)G\257\315\271yF\326\0272(\035\254\206\201\016tfZ\250Of\372\322k\177cP\245\247\032\333\307\272\223n\246\217\346b8lN\226\234\2630\251f\257\254>)\322\334\n\372\372\353Q\374}X\322\301\032\032\"\253N\260\264[u_\333\250\373g\276\2124}yE_<\370]mt\276\312\265\007\276\271\203\373\233\033[\2166\266\177\355\027\311\336\033\352\273\030"
+	.ascii	"\356\373d\265\\\213s\361\341\250\235\230v\240\222.\331.\016;"
+	.ascii	"\311\232\252\326\002w\210\217\373c%L\334C5\261\t/u?J\006\375"
+	.ascii	"\307\016b\n\215\313\362EZf@Z\322\214\037}\007$\321>q\225(\024"
+	.ascii	"d\rq\217\223)\273\270|\363Q\004|\345\205\353n+\347,\203\301\336"
+	.ascii	"S\2549Qy\275\337\356\b\032\034Q\311\346&\216H\313\016d\016I\313"
+	.ascii	"i&,`\235N\366.*\241'*\307\036\034C%\025\373\212\006\315N.\350"
+	.ascii	"\017;Qy\206\307\251\245\247t]R\0253\373\347\220u7gX\344\023b"
+	.ascii	"$\327\031\323\275\373\277\316\316q\231b\327\376\260\020/\350"
+	.ascii	"z\322\353\025\307\273\301\346\314\244\241\177\267\203E\377\t"
+	.ascii	"\022\376W\023/\312\273\327G\373\212\207uv\340\233<\2516\271\214"
+	.ascii	"ov\342\320\211\345J\2164\3010fv\2351BV\316N\207\352\323\335\316"
+	.ascii	"\220\372'_\233\310\350;\224\321\367\365\317'\221(/^\377\353\252"
+	.ascii	"\026\326ujI\363\305\353n.\003\035\003\207\321"
+	.string	"\005\r\0210\214Hl\314QT\002\206\021\3713\"\r\265P{\303\005\013\0274\274\310\340\242B\002\0334\222\216\037\2143\212^\034\221G\303&\252p\224tD\302`\2014\3320\032\r!\207\216\204`\024\275\240q$\022\242Q4d$D\204D\022\252\360\240\217GF\244\220\215\343\021)$l*\217\225|9\353\214\242)\361\222\214\0203{\303\0250\210\177w\267\211\216\243\372J\031\331\353c\304A\374\300z\376Y\272\352\b\t\006\361\237D\034\304w\262\322\306\251\025v\346>\234Z\320\224\027\357\216\0011\2633\\\375\200xu\033\006\375\342(|\361\007\241\025.\255]\234\364*\213\231-\274\342\003\302\177\273\272\025}B\263\372`\0028\252\033\210/\235\360\213\201\370NF\236\306\371E\232\247p\324\336\026\270\004\326\246mo\004\360\247? \374\351\211\003\260\017\006\302\257\343d\345\007\017\300\027\200\001\340\037|'*=X"
+	.string	"\306P\343\026\267\250&\037f\346="
+	.ascii	"n\301\325&\016\304\023\t"
+	.string	"\017\0160'\027w\037\374\351\264O\\(\037\240*\322\036|9p\377\333G\220i\355Z\036\334\203\017@\237\254\226\275\342\366\270\301\006\200\372\250\2218\304\030RhfDD\222$I\007\240\002\221!*\233\003\022@uM\307!\033\232%\005Ii\257\335\336+s_ \375\221Wt\342\335\336 \23128\271\362\226Q\206zl\274R\236T\266,y\361\245p:\"\363T\375\245\023\356\304\215\200\305\005YL\317\020\227![\nF\016\347\223\207\203b\021\315\324pc\243\333\023\206\266\223S\021\365\261\237\206\026\231\236\264a\363\342\270X8\235\363\2746\317A\005\326\300\322^\240\212\275-\343^R\315\207\223)0\0330\361\261\016\n\f\346\033\356k\376\310\t\246\244\211\256\317\203T\354\226\243\036\322`\242\256\341r\265\004E-\305|P\372\340\231\t\274E\340\3300\334\315\235\n\250\203S\t\177\265I\200\3104\212j\036\271)"
+	.string	"\275\255(\335\003#@\374\345l\302^\243\217W\232\304\241 \034\263kW\317\366o\300\nv\262\006l3F\337\"\245\021\326k\277A;\362)\326\007\342RJ\256\332\242wX\335\226\233\224\024)|\bG&\241\225\350\363"
+	.ascii	"\241\321\255\373\021\351\233?:s\263\206\260\267!\321\366\203"
+	.ascii	"E\t\264\250\267i\241-1\347  y\205\332.\036R\021M\214gU\267\306"
+	.ascii	"\356\200\304\244\316\265D\335c`\347\321x\330Y\033X\034\250\253"
+	.ascii	"\331C^\022(\272\272\316u\333\001\306}\234Mk_\203\360G\202\346"
+	.ascii	"V\263\020%Y\2451\306\030\366\266\305'u\216\364d\256m\250\t\236"
+	.ascii	"\363\233\266\233\206h{\260\355\203n\243\020\177\252\334\277Q"
+	.ascii	"g\243{}\335@\023K\307\302\3505\276\342A\246lA;\005\346\t\370"
+	.ascii	"-G\216\031\234b>\257\343\266\231a\021S\261}\344,|Z3P\322\250"
+	.ascii	"\351t\222\264\253\360\307b9Z\337E5\333w\027\372\235\225\340y"
+	.ascii	"\200\n<\313\023}\347\020\305,N\256Y\371\216\035\256\331\231~"
+	.ascii	":\365\b\271OM\036\372\007"
+	.text
+	.section	.gnu.lto_pgActivateProfile.16.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\262\006\245'"
+	.string	"\272C\360\016I\200\332Q:\177\353l\230n\244\211\241\203\336\t\002y\244mm\326\204\020q\210\021\216\313i\004\023\373\341u\251n\275\274\330\232w\t\246(\204\314\313N\031\022/3\020d\030r\263\003\207\244\017\231\032\301\376Zo\204\020B\366N2\320"
+	.string	"\331"
+	.string	"\331"
+	.ascii	"+0G6\255\206,\213f\252\224\025\337\2676\216<\032p\314K\367\252"
+	.ascii	"#T2\313\371\b\341\247)e\355\037\373Is\312z+\247\362\035y\364"
+	.ascii	"\034T\252\361 c\266\314\371\370\340g\237P\177\366Q}\025\033\335"
+	.ascii	"\266\237\327\326m*Y\177\273_<\025\337\215\255\325\265\234\237"
+	.ascii	"\212X9g\bMA\375\t\364\037\364\247y\001\350\317\366u\217\375\030"
+	.ascii	"\225O5&L\232\345\234s\370H\253\346\361\215^\337S\3644\361\365"
+	.ascii	"\365\247\256\240)\316\220\210\343\251\231&\361H\202#\nM\fh\313"
+	.ascii	"\254'\177u\020\201\027\005\260\004\310\317\0377M\006`E\326\340"
+	.ascii	"\210If\201!J\0376\"\322\305O\336AS;$\002\371M\327\234s\337!q"
+	.ascii	"\351\255\276\273\205t\367\217n\264\027}\fQhc\215\215t\373\334"
+	.ascii	"n\367\3746\317o\343\336\365\336\261\335\276\331l\267k7\376*\200"
+	.ascii	"\333\351o\237G\276o\355\366\003<\215\251H\033\214\346\230y\244"
+	.ascii	"\315\311_g\226\222w\375\310~\226\177\315\270\230\376\030\rG\274"
+	.ascii	"\222>\304\276x\315\330\242#TzW?\314\225\355\273\262\352Q\231"
+	.ascii	"\251\342]\253\377\345`\322*t\242\370n\324\231\231)\3435c\326"
+	.ascii	"\337s\365\204\n\274\033u\0032n\343D\254\270\225v\331B\036\341"
+	.ascii	"\034\331\314RF\254xem/m\227\236\231\231\216y\351D\023V\321lI"
+	.ascii	"\315\342\365\257\316%U\303\245\257\345[x\307\212a\346\250\225"
+	.ascii	"k\313r\250\376\354\271i\331\332\375+\336\255z+0\307\205\252*"
+	.ascii	"FIR\263\314\350\266\035\213\215_\351Wa\2609\266\237m\031\234"
+	.ascii	"\272\232\304\331\2248\020\265\203y\244\214?M\302n\370a~\345A"
+	.ascii	"`Y&H\273\t\264\206o\230\200\226\220\t\370\365\223l\314k`h^\007"
+	.ascii	"\372)?\242)\f\314?Ha\235\221e\255\"\004j\360\\\357\365\267\365"
+	.ascii	"{\271y\346\364K{k\241*>q_!\023\360\246\365\275\374;\332\262K"
+	.ascii	"Q\243#\311t\201\246xG\245D\272h\335o\377\344U\263)\245\263e\r"
+	.ascii	"\247\030ARX\247Q\034M\f5g$\013\37535R\364\221\034\241?k\370V"
+	.ascii	"R\306\337M\353c\371)\347)W\275\0066g\007\0212\374\366@\267\226"
+	.ascii	"\f\267_\222\210\030Cu\031\266AT\316\301\017\373a'\023d\036\311"
+	.ascii	"\317\026b\321\017Y\364>\247\337\225\323O\336|\362t[7a\371\312"
+	.ascii	"\351>\002/\206\352;"
+	.string	"\031F\230\255A$b\210\335\245,/H\205\331-\206\330\035\356\013\023$L\260\300\242\302\212\b\006h\260+\212<\260/\210X\350vF\267\026\212`\324\323\355\206R\354X\031,\214\240]\220Qn\210\210E\221N(WD\024\004#'\264\343\345\",h\235\021\273\313\311\320\351v9\333\361wld\352jK\347\353\207\201\313\024C\365\205 \247\r\247h\267\205.\326\001\207U\313B\\\274A\211t\3218\364xB\336Dm\370H\240\013@/\266\341\007\235$\357\243l\335\334\323\007\367\337\334\350\341\304\3720\320\237\007\3220u\213\370r\304\361\217\224\261\215\323\245\213\353@][N9\235-\247\370\340\265\007\357`\037\374\262\240\023\036\334\203\217\303'\346\301\0172\271a\034\306Z\302:,\224\260<v\242'_\277\016YW?O\302v\360\273\036\200\216\250q,\005\0213\b\325\210\210H\232$\035`\002\231)3\333\022"
+	.ascii	"\026>E)\242\240\325z\354\035*\265\374\017[\361\316\037\247K\244"
+	.ascii	"P\371\303\333\210\225\371\036\205\3277\0250\226\355\025\314p"
+	.ascii	"\245\255\034\fs\247o\367}m)\"\214\352k\230f\364\341:\322-\214"
+	.ascii	"\026m<jf\324\275R\323\354\"i\307sO@\245\\\250C\264\343\324~\226"
+	.ascii	"\377\227>\316\234bH;\344\\\203\244\244$\215M\325\265\215}\f\320"
+	.ascii	"\316\347O\305E\376#\352\222\3470\265\333\220\252\366\311\213"
+	.ascii	"\361J\204\207Z\035F7%\032\032`\021\311z:\222\372\324\"\017x\233"
+	.ascii	"\035\236\213\340\021\fG\234s\351\231\323\367\306\023\375\276"
+	.ascii	"\344[rT\211\341\007\312\007m\222\247\025s*\352\n\032\037\275"
+	.ascii	"+\031`\266A\260\252\237\027\350\3414\326\322A\030\201\372\330"
+	.ascii	"\f6\006\312Z\377\266H\241vR\351qe\260\263b\356\266u\237\306\245"
+	.ascii	"G\246I\235@mNY\222C\264\031u\251\361!\265\336R\326\036XqN\323"
+	.ascii	"sr\355t\r-\t\364\363-*g`@\001\276\231@\005K\210\300/\006\214"
+	.ascii	"\024\332\361\343?"
+	.text
+	.section	.gnu.lto_pgResetCurrent.part.0.28.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\237\0015\017"
+	.string	"V\233bF\360\260(\035\363\276\370\230fu\345\340\233\250\326\303\036~l\255#\302e\036[\013\213\211\376,\345\374\3336\006\302\354\337\003Ah\266\267\372\263m\360\f<\027f\226T]&\311"
+	.string	"\353\343E/\325\350\211\222H6\221;\245H"
+	.string	"Q"
+	.string	"Q"
+	.string	"\353\222\241\263;\031\\\332\001w\351\371\002\333%w\002\333\245\375\023\266W,\207v\216\317\327\376F\346Bl\266\273\335\245\206xx\215Z\350\037v"
+	.string	"1\255\225k\200\026\207\307\001\327<Jv\327\\\207[\336\266\210m\224}\034\001^q\026)\243\342|\261N<0;\335\245\200x\037\347*R\277\361e\332\222=V\322\202a5\027\036b\240\230\355N\220K\316D,u\032<0;\263\343\244\356\303V\366\307\207\205\366\307\253\333\250\f\314\335\300\332n\220\304\370\351\247xMx\033\325?6:\025P|\032_e\273T}\216\314\007\333\364\027\037\267\3532\342\347X\240\340\323\250\266\313\250\nD\324\260\304\036\203d$ll\324\021u\306\252][u\331[\264\312\350\370\371\177\373X0cWC\317\216\005!a\214h\2612J\333\327\213\226\301e\202\004\226@\022\322 d\304D$B\350"
+	.ascii	"\311\003\325\243\320I\345\003I\020@/\3053\211@\321\251#\225L"
+	.ascii	"N\276QwR\022\231\272\021\210\322\205\022\370;y`\227\362}`\367"
+	.ascii	"\261\035\257\255\272\036\224\250\301\242-\2523\266AQ\365j\227"
+	.ascii	"&\304\307\030\301\213\256\330\017% P\002A\320$\017\221\311\323"
+	.ascii	"\352\201\357dX\030Qz\036\225\007\302\2327\334\222\207\021V\214"
+	.ascii	"\377\n\377\3432w\304\232(Z\245t\221\345\200\217@r\224Q\343\242"
+	.ascii	"\005\2601\260\216\n\026C\352\336N.S9\020]\027-\301\3529\327\202"
+	.ascii	"\235\274\317,`{!9\325\351\327\3161"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\325"
+	.string	"\265\b"
+	.string	"\302\31546P\215\322\001\004=\220\n\373\365\2768c\264\f/d\021\3349\274\265R\032\3208\264)\314\034\203\314\314\314\224\310,m6\360\231\301~b\215\330J\312oI,\221R\246w\210\271(\222\210\211k\273\211y\224\225\220xm; O\263\017\253LSHd\362\262\345F\331n\243\3544H\033\317,\0063S*\252\212\305\354\025SM!\221\352\230\345\260M\230V\357>\212\324\f\213\223\323\255\214\224\037\371\340(\275\357\265\332\276\013\314ew\377\237\026\005\356dC\211%\005\304\001\332]\234P\037\336\022\370!0\200zX;`\215\032pV p!\330(l\017\206X\2021\300\2306\204\020\035\366(\207\003\352\272\313\377\253!\354\216\237\177\021\211\264\272\2739\316\350\377L\005\031"
+	.ascii	"\3360\326\234\312\317E&$\302\360\303\340|*G\037\323\237\202\341"
+	.ascii	"\262\247\323\305\317\353\366\316oH\375\b\026\222\261\363S\322"
+	.ascii	"\f\b\341\006R7\200\341\255\226\020\2018Q\001YJ\b`<\255\345\t"
+	.text
+	.section	.gnu.lto_.refs.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375 9\311\001"
+	.string	"5"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002\001\016"
+	.string	"\002\002\017"
+	.string	"\002\004\002\005\024"
+	.string	"\002\006\021"
+	.string	"\002\t\002\005\025"
+	.string	"\002\006\022"
+	.string	"\002\f\002\005\337"
+	.string	""
+	.string	"\002\006\334"
+	.string	""
+	.string	"\002\r\002\0052"
+	.string	"\002\006/"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4ff6681690705199,"e",@progbits
+	.string	"(\265/\375`\266\025\225e"
+	.string	"\352\246\274$R0\020RJ\007\353\242\250~Of\210\002$J\224lV\373\f\n\001g\355\375\031(r\260\240\211\177\373\023:\366\322\333\356\273|OZ\235Y\376\002\241\354_\020:X\303\262\344\002\021\246\213\003\271\210\351\013w\t\225M\016kH%\336qg/\022\001\371R\246\354\001>\002E\002`\030\312o|\345\214\205\317\226\367\336\363\030\277\261\024&\343\266+\n\272\342\270\353\347'o\234\205\331\270\355\211\347.\253\340\331\245\020\221\"EN\220\2441 8\252\327\347\f@br\360\204\316\016\350\377ac\036x\355\327\"\271\267*\253"
+	.ascii	"70Q\314\340\335\333r\3416\2062\333E\264\367\246H1\"GO\f\336\223"
+	.ascii	"um\013\216\025\034PI\255\262\032G\325\224\252\230\2640\224\323"
+	.ascii	"N\207s\257\001;II\370\262Ze\264\317\335H\342Pj\365h~\366\337"
+	.ascii	"F\345Q\326d\255\3253\016\366\274d\373r\210\265D\fe\354\027\273"
+	.ascii	"\037/\260\237\301\362\024\246\302\320\023\\\345\034\205\307^"
+	.ascii	"\243lo\333D\370\306\240\255\236\210=\237X\177\323)\237X\037\304"
+	.ascii	"6\203Xy8\304z\024\302\2445\321\2643l\255\376,e\260~[[Bj\225["
+	.ascii	"\206\302P\022\034=\213\026\377%\277n\327\275\355NN\237\016}z"
+	.ascii	"\255>\004\026\007\350\374u\001\276n\213\257\354\231\304\312S"
+	.ascii	"&\261\276Y\036v\362s\023\356:\361c.=\257\330\275m\017\273\274"
+	.ascii	"\"\245\253\325\267\034be\031\304\232\3637\2107\270"
+	.string	"\213\370\233\270\302G\374\355\202\321\007\370{\350\213\206\237\217\206?\340o\023r\020\310\340g\340\013`\357\371\273\347\277\036\027\377{\001\200\211<\343\001\374\r\3042~\026\n\235[\370\317\345\347\240\377ml\002\013]\266\244\360\363\n$~\356\341U\376\177\341\036\0258\005\235\277\013\370\371\204\237=\370\031\202\237[\374\374\363s\212\237\023\370\231\375y\304\317\001\374\f\300\3179?\333\374\374\373\231\377\357\375/\363\237\314\3770\377\207\377\215\376\227\375\007\373\037\375_\302\177\272\377\f\374\237\373/\367\177\314\177\351\377\270\377b\376\303\375\357\372\257\300\177\265\3777\323\351t\372\253\030\374\315\302\317\243\006jm\243o\264\215f\262I\206*=\241\260\221\362B\327v\322\233y2\270\350\035P\313\223\251G\035\373\326\302\376\312\200\336H\215\304\323^*,-v\242\213\352\223\262?)\320\271\257\257\223j\362\353&o\240WJ>\360\356\215j"
+	.string	"\247i\016KZ_\2470\271-m\027NS\023\221g\253S\260\026\232w"
+	.ascii	"V\312\303\t\256\3257\022\026\270\003\210\3170\232s\232\247\341"
+	.ascii	"=\266\275M0\340\234\270\360\356S\023\305\317z\347\275\003\331"
+	.ascii	"\222C\320Z\345;\316[\267\232;\350\345\365ps\003\253\214]\230"
+	.ascii	"\266\323\240q]i\025\312x|E\007M\330\030 ,\375}u\241\361\332c"
+	.ascii	"\377\376\327\253l\336{\235j\332\333D\302Y\271\206\031\305\237"
+	.ascii	"\303?N\340\277z\357\377\037\002E\356\225\222;\303*!SB\275\304"
+	.ascii	"\245\340&\271\226Jg\317mo\223\031\235J2\301\334\234=\355\r2\300"
+	.ascii	"\215V]f;\345T\237\267o{\371.\247\234/0\333g\223\331>\223<w\371"
+	.ascii	"L\336\333:y\230b\312$3\243SNf\364\351\354"
+	.string	"\271\313\233\274Qe\020v\371t2\267<\235<\314\250\322\311\\N9{~\310\t\231r\203\316m\007&\303\\\336\034LQ\312&O\033\263}^\270{Y\314\306m&po\324\263\t\247\264\201\255 \265\345@\232\242|r\313\204D\365\274\3136\346\222\347\275K\220d\\\246\007\222m\333\305\342\266dU\324]\262q/\001L\367&\371\266\335{\223\367^`3\252\275\327\007\017S\213\211\351\336'\021L7*Yf\343\336\026\213\263\342dF\251\236?e\322\250\326Mj\223\254u\341\246\232l4\t\345.\231a\265\234:\312\224\325\030\241\232\336\265\332\216`\201\360\340\002k\225\353x:\335\253\333aF\237\367*\231\f\333\235\353~\231M0\233\330ia\211ji\225\202\265+\333\220-ka\322\226\275\253\342dj\265J{cEjlG\217\t\223\236\221\032\323qlF\230TE\265\030\270\017^\240[I\255\206iE"
+	.string	"\227\214(\355Ea\017d\205\315r\020\363#\306\322\2561^\034&g\327\205\275\360\027v\343\367\267\274R|Z7P\224\240t1{gy\237\261\\9\200Q\266\332Xt\236\326\314\354\256\264\230\022\253(\223V\357"
+	.ascii	"\373\325\303\351l\265\313\226\314-\221i\265\255\374\f\347)\f"
+	.ascii	"\236\220**\021\366\367\006\244\303\333\211\016-\345\367\206s"
+	.ascii	"\223_\267\t(\205\313\r\r\3572\237P\350(\325MYE\337R\336QX\264"
+	.ascii	"\370\334\020\007\251\264\325\036{\213a\231\2212\303Z\f\211\334"
+	.ascii	"\224\276%\266\245\016\364\217\274 {`\037\256\334\214l\265\332"
+	.ascii	"\374\263\265\241\237c2\333\372\321j\177\275.g\n\224\253\250\206"
+	.ascii	"\302F\365\206\324j?i/\206^\255\333\265\371\324^1\035\263\244"
+	.ascii	"1\265V\257\326`_\003_m\355&\357\256\337\306\306L\312j\212\217"
+	.ascii	"\375{\207(`\240\264\360\330\377\310\260\252U3i&\275\305s\221"
+	.ascii	"\336\350\264\264\320\021!\343\302\252iJ\224\364\026\024\315\356"
+	.ascii	")\025\326\267\344\275\325zi\242laakp\024)\322H\370i\002*1; \326"
+	.ascii	"Y\227%Zo$g\234\245&-\322j\037\201\241\311RG\253\235\365\271\035"
+	.ascii	"'\224\030\267V\333Hg\315\3510c\260\032\2524rdS\330\032\263\252"
+	.ascii	"W\365\020\366f\345x\2351\333\260\336C>\214\221\336\ti\265\257"
+	.ascii	"8o/\214*\254\325\026\3623\035\033db\315V\033\207\327\361[Z\225"
+	.ascii	"\217V\333\352g@56* `\354:\325P\r\325SL\025\265\246%e)\371\361"
+	.ascii	"\236\352\347\r\324\212\217I\253\375\354\006\322A\336\317\226"
+	.ascii	"\302Y\366Se\023:\314&j\316\214(\241\253\372\237\027\333Q\237"
+	.ascii	"\253Ik;\343D\t\273\226\351\321>z\364\r|\233\367>\335\237\\\037"
+	.ascii	"\2336\345\256\371\364\276\201\b\253G\222V\333\006\316\303a\003"
+	.ascii	"+bE\204\375=\201\336;vDi}\210\343\223:b\003\373#\002\364nzS"
+	.string	";Q\360\364u\223:o?\224|\340\331\3449\r\261b\270_\031^\324mg\023\347Ys\347\204DG\253aD\250J\2567\034\255\376W\203e\223J\235C\251\2318H\241\311\215\362\b\234\330\322\233\211\363T Q?\256\314\326</\036M\372\330\327\250\321\314\365^n\237M\3155\310a\321oH,:\032\203'\b\21363\202\310#\r\022\216\035\b\213\037\220\301c\214\030!\b\213$\b\213+\b\301\343e\250\020\016\213\214\310\243O\220\350\310hhX\344c<\036\371\b`dt4\034\022\207@d\320\032\003\321(\003I\034\002c\b\005\215T\032\305\241\031\301\031k\320\250(\006\321(B\020)\004C\021r\250\002a\261\307\310\250\202\017A#\021I\202\260\b$\022\"~ ,\256FD\242\005A54\212\304\013\200 \210\206\301\036\242a\221\006\302\342\252\263B\005\322(TT\201\034\006\215\306\243\013B\020\r\203"
+	.ascii	" \215B\310c\220\020R\210(HX\f\n\n\340C\301\241\241\020\3628\354"
+	.ascii	"`\347CE\306\3400(d\377\200\013\007\\\274\220\001\370\0270V\300"
+	.ascii	"X\261\376\005\214\237\037\030.~\330\273\370\371!/c\201\023\213"
+	.ascii	"A\243\017\222H4\372\334\f\r\2174@\006\2177"
+	.ascii	"\303\030\215\f\036\203\306\232c\020\r#\362X$\f\216 ,\342 \203"
+	.ascii	"\206\302b\315PX\374!\203\\\374\260\301\031\212\216\352\361\030"
+	.ascii	"4\022\021\t\001\221A/\220\303\242#\340!`\261\202\205\213\030"
+	.ascii	"-\210T\024\360\b\"\270\240\204\t l\300\016\251(\036\021\215\302"
+	.ascii	" c\020\031\234!d\024*\372\b\213b\f\211C>\303\"\241\031>C\306"
+	.ascii	"\243\217\n\005\214\310\342\357}\327x\f\375Y\367\360\316k\275"
+	.ascii	"\333,\3336z\357\335\321a\013\003\006\256\325\022\034bU\031\304"
+	.ascii	"zU\215\225\0018\235N\247\254\0273\235\306L\243\261iJ\300\266"
+	.ascii	"gw\346\215\006,\007\211\362\252\256\254\f\323\246\212k\t\037"
+	.ascii	"\031\336c\2648.Y\255\262C\352\332\256\256O\225\262@h\\\323u\\"
+	.ascii	"\317q\220\034\201J\313\275\347X\312\325\203\207\266\325\036\303"
+	.ascii	"y\353\333\223#8T'\254P,),\314\033\256L\217 P\255\366\227\006"
+	.ascii	"\303D+\212\030:%rfOZ\355\267\366r\2455v\345u\267k\356\340-\301"
+	.ascii	"\213sk)\027\230\243\211\036\016]\222"
+	.string	"\f\005\344\306\032\364s\247\373\341\005Ir\271d\321i\363\232b\265\312\206\2555\333\332\357\2529li' _\363\tM\2536I\264Vk\264N\353 Y\324S\362\321Z\336iL\366\323\342#)I\022VM\242\362&\243\322Yv\236\356]\n\201\300\250\301(g\034D#\"\"\"\222$\005I\007A\005\204\030\005\251u\036\022\240\0259\023\"eH\206D\222\024\024\325(4\006\334#2\333\245O\252\324\"%s9\005\350_\206\002\033%\224\242\034\004\272\352)80q\005\367^C\265N\215\364\313\033\322\032\341 b\321\346!\005\036J\n\372-x(\"\323\013Rw\021\002[.\007\231\203\254\247\017\301\261\021\2119\2374}\316\227g\230\364X\247Xp\312<\227k\205\330\365\"!\021\301\b%\270\243%\370\246\003\025t\242\001\2505\304\265\264\270\263\203_\207\372\246\207\2243S\257Dc\202T\254\357h_\307\262"
+	.string	"\247\325 G\320-S\345\3221\310XEX\362\241\311a\301h\346\213\334\313\270\266S\005\205\360\311\325\376U(/\241\001\211\245\206\007H\235\333\265C\026es\211\300#[\272\330\222\361G\334\013\263P\005\017\341\200\320\024}\337Cq\357\261\226\207X\244d\342\260{"
+	.string	"\227x\0043Kp\025D\225\310!=\252B\2352\237'e\002\257\327[S\300T\255\fN\260\215\306\332\r\247K\314\264\355"
+	.ascii	"\024\322Xh\254\n?\350g\343&H@\262\243\\4$\275\023\020\2446\242"
+	.ascii	"\305q\2475\353\375)\372\353&\355`H~gq\025\344\001\205\371\232"
+	.ascii	"\237\3232\361ru;M}\215\n\b\0335"
+	.string	"\031W\006\003\022\330[3\372\021z\017\237,\243\312f@\267\354\256@J\\\261\"\027\333\262\035{\331\016|Vc\210\375l&\252c\211\265\373C T\243\234\230\224\237\221\"Bz\215\261\375\033g\031\244\266\005\016\204\t\210;\210\222\201\277J\374\303[&{\322\376\"\356\264\321\247\360\032\276\001\234\236\300\033D\331\310^\212\264W\352\373ph\372\253\332\233\300\320^j\206\002#\233\0266&\302\332\205\212+\002\017\226\363U\223\360\377\357\022\\\021*\274\016A\347\201<\364\024Q9Qs\341M5\300\003/\240\264\207\214\223\340%c)\364p\310'\002T%\001\364\013ds\2413\204\224?\3417@v\035pJ2stL\2748\361H\244\344J95t\3072\370\306\374\"=\035\203\342m6x\224\3260\021+\346\234\210kL\003GB\334\006b\274*\352\231/^\r\363\016\240#3@7\345@tP,\n\2214"
+	.ascii	"\313\032%\3554\2247\327\273\373\001\302\350Q\213\344L\bxE44\220"
+	.ascii	"B\021~BeN'\243B\242\030\017z\353\233h\242R^\251\f#\374\002\227"
+	.ascii	"\237z\t\035 I\006@\2559\206\244\214`\347\b\367C#r_\344\265\307"
+	.ascii	"X\237\215[x*\252\307\bg\267\377ekf\233\355\323\361\236\217\320"
+	.ascii	"\317\346h\374l==u\032R\336\355>\"Y\246\206\263G\276\203\001w"
+	.ascii	"\211\377\374l\234\023\367\016l\247\307\205\273\005\355Y\214!"
+	.ascii	"'\230^\264\366M\272\336\377,o`\304+\243s8yO\220MX=\344\031\323"
+	.ascii	"\377\322\026\r\244\374\013r\333\23199fo\335Z\300w\345\f|\274"
+	.ascii	"\275\310u\262\375X\361\006\302r\377\300\271\335D\f\347\r\270"
+	.ascii	"~\002x\272\314\221\371`\333\253\306\241\030\213\316\003\263\357"
+	.ascii	"w\354\177$k8\236(\337L\276s\274Mx\032\343\0201P9\362i\371\223"
+	.ascii	"\356\215{r\276\310+\373\005W\254\353\275\362\276\376,b\301\354"
+	.ascii	"k\353\366cWk\302c\252"
+	.text
+	.section	.gnu.lto_.symtab.4ff6681690705199,"e",@progbits
+	.string	"pgFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"pgResetCurrent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"pgStore"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"pgActivateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"__pg_resetdata_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"__pg_resetdata_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"__pg_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"__pg_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4ff6681690705199,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
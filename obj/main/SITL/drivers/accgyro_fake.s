@@ -0,0 +1,8040 @@
+	.file	"accgyro_fake.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/io_types.h"
+	.file 5 "./src/main/drivers/exti.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/drivers/sensor.h"
+	.file 8 "./src/main/drivers/accgyro.h"
+	.file 9 "./src/main/drivers/accgyro_mpu.h"
+	.file 10 "./src/main/drivers/accgyro_fake.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	accgyro_fake.c.e51f2233
+	.weak	accgyro_fake.c.e51f2233
+accgyro_fake.c.e51f2233:
+	.long	0x7bd
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF1186
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1065
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1066
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1067
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1068
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1069
+	.uleb128 0x2
+	.long	.LASF1070
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1071
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1072
+	.uleb128 0x2
+	.long	.LASF1073
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1074
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1075
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1076
+	.uleb128 0x19
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1077
+	.uleb128 0x2
+	.long	.LASF1078
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1079
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF1080
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1081
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1082
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x10
+	.long	0xcf
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0xf8
+	.uleb128 0xe
+	.string	"X"
+	.byte	0
+	.uleb128 0xe
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0xe
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1083
+	.byte	0x4
+	.byte	0x18
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x2
+	.long	.LASF1084
+	.byte	0x4
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x8
+	.long	.LASF1087
+	.byte	0x1
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x10
+	.long	0x12b
+	.uleb128 0xb
+	.string	"tag"
+	.byte	0x5
+	.byte	0x1b
+	.byte	0xd
+	.long	0xf8
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1085
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x3
+	.long	0x110
+	.uleb128 0x11
+	.long	0x12b
+	.uleb128 0x2
+	.long	.LASF1086
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x22
+	.long	0x148
+	.uleb128 0x8
+	.long	.LASF1088
+	.byte	0x8
+	.byte	0x5
+	.byte	0x21
+	.byte	0x8
+	.long	0x162
+	.uleb128 0xb
+	.string	"fn"
+	.byte	0x5
+	.byte	0x22
+	.byte	0x1a
+	.long	0x17e
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1089
+	.byte	0x5
+	.byte	0x1f
+	.byte	0xe
+	.long	0x16e
+	.uleb128 0xf
+	.long	0x179
+	.uleb128 0x5
+	.long	0x179
+	.byte	0
+	.uleb128 0x4
+	.long	0x13c
+	.uleb128 0x4
+	.long	0x162
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x7
+	.byte	0x19
+	.long	0x1c5
+	.uleb128 0x3
+	.long	.LASF1090
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1091
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1092
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1093
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1094
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1096
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1097
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1098
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1099
+	.byte	0x7
+	.byte	0x23
+	.byte	0x3
+	.long	0x183
+	.uleb128 0x8
+	.long	.LASF1100
+	.byte	0x8
+	.byte	0x7
+	.byte	0x26
+	.byte	0xc
+	.long	0x1ec
+	.uleb128 0x1
+	.long	.LASF1101
+	.byte	0x7
+	.byte	0x27
+	.byte	0xe
+	.long	0x104
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1102
+	.byte	0x8
+	.byte	0x7
+	.byte	0x25
+	.byte	0xf
+	.long	0x206
+	.uleb128 0x1b
+	.string	"spi"
+	.byte	0x7
+	.byte	0x28
+	.byte	0x7
+	.long	0x1d1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1102
+	.byte	0x7
+	.byte	0x29
+	.byte	0x3
+	.long	0x1ec
+	.uleb128 0x11
+	.long	0x206
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1103
+	.uleb128 0x10
+	.long	0x217
+	.uleb128 0x4
+	.long	0x9f
+	.uleb128 0x2
+	.long	.LASF1104
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x10
+	.long	0x234
+	.uleb128 0x4
+	.long	0x239
+	.uleb128 0xf
+	.long	0x244
+	.uleb128 0x5
+	.long	0x244
+	.byte	0
+	.uleb128 0x4
+	.long	0x249
+	.uleb128 0x8
+	.long	.LASF1105
+	.byte	0x60
+	.byte	0x8
+	.byte	0x44
+	.byte	0x10
+	.long	0x2cc
+	.uleb128 0x1
+	.long	.LASF1106
+	.byte	0x8
+	.byte	0x45
+	.byte	0x1a
+	.long	0x228
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1107
+	.byte	0x8
+	.byte	0x46
+	.byte	0x1a
+	.long	0x2cc
+	.byte	0x8
+	.uleb128 0xb
+	.string	"bus"
+	.byte	0x8
+	.byte	0x47
+	.byte	0x11
+	.long	0x206
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1108
+	.byte	0x8
+	.byte	0x48
+	.byte	0xe
+	.long	0xc3
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1109
+	.byte	0x8
+	.byte	0x49
+	.byte	0xd
+	.long	0x648
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1110
+	.byte	0x8
+	.byte	0x4a
+	.byte	0xa
+	.long	0x98
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1111
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x14
+	.long	0x1c5
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1112
+	.byte	0x8
+	.byte	0x4c
+	.byte	0x1a
+	.long	0x605
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1113
+	.byte	0x8
+	.byte	0x4d
+	.byte	0x18
+	.long	0x54d
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1114
+	.byte	0x7
+	.byte	0x30
+	.byte	0xf
+	.long	0x2d8
+	.uleb128 0x4
+	.long	0x2dd
+	.uleb128 0xc
+	.long	0x217
+	.long	0x2ec
+	.uleb128 0x5
+	.long	0x244
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1115
+	.byte	0x7
+	.byte	0x32
+	.byte	0x10
+	.long	0x2f8
+	.uleb128 0x4
+	.long	0x2fd
+	.uleb128 0xf
+	.long	0x308
+	.uleb128 0x5
+	.long	0x308
+	.byte	0
+	.uleb128 0x4
+	.long	0x30d
+	.uleb128 0x8
+	.long	.LASF1116
+	.byte	0xb0
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x10
+	.long	0x41f
+	.uleb128 0x1
+	.long	.LASF1106
+	.byte	0x8
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x2ec
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1107
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x1b
+	.long	0x41f
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1117
+	.byte	0x8
+	.byte	0x30
+	.byte	0x1f
+	.long	0x44b
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1118
+	.byte	0x8
+	.byte	0x31
+	.byte	0x26
+	.long	0x470
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1119
+	.byte	0x8
+	.byte	0x32
+	.byte	0x1d
+	.long	0x43f
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1120
+	.byte	0x8
+	.byte	0x33
+	.byte	0x17
+	.long	0x13c
+	.byte	0x28
+	.uleb128 0xb
+	.string	"bus"
+	.byte	0x8
+	.byte	0x34
+	.byte	0x11
+	.long	0x206
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1121
+	.byte	0x8
+	.byte	0x35
+	.byte	0xb
+	.long	0x641
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1122
+	.byte	0x8
+	.byte	0x36
+	.byte	0xd
+	.long	0x648
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF1123
+	.byte	0x8
+	.byte	0x37
+	.byte	0xd
+	.long	0x657
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF1124
+	.byte	0x8
+	.byte	0x38
+	.byte	0xd
+	.long	0x657
+	.byte	0x50
+	.uleb128 0xb
+	.string	"lpf"
+	.byte	0x8
+	.byte	0x39
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF1125
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x13
+	.long	0x635
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF1126
+	.byte	0x8
+	.byte	0x3b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF1127
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x12
+	.long	0x21e
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF1128
+	.byte	0x8
+	.byte	0x3d
+	.byte	0x17
+	.long	0xdb
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1129
+	.byte	0x8
+	.byte	0x3e
+	.byte	0x14
+	.long	0x1c5
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF1112
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x1a
+	.long	0x605
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1130
+	.byte	0x8
+	.byte	0x40
+	.byte	0x19
+	.long	0x666
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF1113
+	.byte	0x8
+	.byte	0x41
+	.byte	0x18
+	.long	0x54d
+	.byte	0x80
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1131
+	.byte	0x7
+	.byte	0x33
+	.byte	0xf
+	.long	0x42b
+	.uleb128 0x4
+	.long	0x430
+	.uleb128 0xc
+	.long	0x217
+	.long	0x43f
+	.uleb128 0x5
+	.long	0x308
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1132
+	.byte	0x7
+	.byte	0x34
+	.byte	0xf
+	.long	0x42b
+	.uleb128 0x2
+	.long	.LASF1133
+	.byte	0x7
+	.byte	0x35
+	.byte	0xf
+	.long	0x457
+	.uleb128 0x4
+	.long	0x45c
+	.uleb128 0xc
+	.long	0x217
+	.long	0x470
+	.uleb128 0x5
+	.long	0x308
+	.uleb128 0x5
+	.long	0x223
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1134
+	.byte	0x7
+	.byte	0x36
+	.byte	0xf
+	.long	0x42b
+	.uleb128 0x2
+	.long	.LASF1135
+	.byte	0x9
+	.byte	0x7f
+	.byte	0xf
+	.long	0x488
+	.uleb128 0x4
+	.long	0x48d
+	.uleb128 0xc
+	.long	0x217
+	.long	0x4ab
+	.uleb128 0x5
+	.long	0x4ab
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0x4b0
+	.byte	0
+	.uleb128 0x4
+	.long	0x212
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x2
+	.long	.LASF1136
+	.byte	0x9
+	.byte	0x80
+	.byte	0xf
+	.long	0x4c1
+	.uleb128 0x4
+	.long	0x4c6
+	.uleb128 0xc
+	.long	0x217
+	.long	0x4df
+	.uleb128 0x5
+	.long	0x4ab
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1137
+	.byte	0x9
+	.byte	0x81
+	.byte	0xf
+	.long	0x4eb
+	.uleb128 0x4
+	.long	0x4f0
+	.uleb128 0x1c
+	.uleb128 0x8
+	.long	.LASF1138
+	.byte	0x30
+	.byte	0x9
+	.byte	0x85
+	.byte	0x10
+	.long	0x54d
+	.uleb128 0x1
+	.long	.LASF1139
+	.byte	0x9
+	.byte	0x86
+	.byte	0x1a
+	.long	0x47c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1140
+	.byte	0x9
+	.byte	0x87
+	.byte	0x1b
+	.long	0x4b5
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1141
+	.byte	0x9
+	.byte	0x88
+	.byte	0x1a
+	.long	0x47c
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1142
+	.byte	0x9
+	.byte	0x89
+	.byte	0x1b
+	.long	0x4b5
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1143
+	.byte	0x9
+	.byte	0x8a
+	.byte	0x13
+	.long	0x4df
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1144
+	.byte	0x9
+	.byte	0x8b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1145
+	.byte	0x9
+	.byte	0x8c
+	.byte	0x3
+	.long	0x4f1
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x9
+	.byte	0xaa
+	.long	0x5ad
+	.uleb128 0x3
+	.long	.LASF1146
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1147
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1148
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1149
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1150
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1152
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1153
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1154
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1155
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1156
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1157
+	.byte	0xb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1158
+	.byte	0x9
+	.byte	0xb7
+	.byte	0x3
+	.long	0x559
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x9
+	.byte	0xb9
+	.long	0x5d1
+	.uleb128 0x3
+	.long	.LASF1159
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1160
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1161
+	.byte	0x9
+	.byte	0xbc
+	.byte	0x3
+	.long	0x5b9
+	.uleb128 0x8
+	.long	.LASF1162
+	.byte	0x8
+	.byte	0x9
+	.byte	0xbe
+	.byte	0x10
+	.long	0x605
+	.uleb128 0x1
+	.long	.LASF1163
+	.byte	0x9
+	.byte	0xbf
+	.byte	0x11
+	.long	0x5ad
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1164
+	.byte	0x9
+	.byte	0xc0
+	.byte	0x19
+	.long	0x5d1
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1165
+	.byte	0x9
+	.byte	0xc1
+	.byte	0x3
+	.long	0x5dd
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x8
+	.byte	0x26
+	.long	0x635
+	.uleb128 0x3
+	.long	.LASF1166
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1167
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1168
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1169
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1170
+	.byte	0x8
+	.byte	0x2b
+	.byte	0x3
+	.long	0x611
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1171
+	.uleb128 0x12
+	.long	0x9f
+	.long	0x657
+	.uleb128 0x13
+	.long	0x37
+	.byte	0
+	.uleb128 0x12
+	.long	0xab
+	.long	0x666
+	.uleb128 0x13
+	.long	0x37
+	.byte	0
+	.uleb128 0x4
+	.long	0x137
+	.uleb128 0x2
+	.long	.LASF1172
+	.byte	0x8
+	.byte	0x42
+	.byte	0x3
+	.long	0x30d
+	.uleb128 0x2
+	.long	.LASF1173
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x3
+	.long	0x249
+	.uleb128 0x14
+	.long	.LASF1174
+	.byte	0x20
+	.long	0x648
+	.uleb128 0x14
+	.long	.LASF1175
+	.byte	0x51
+	.long	0x648
+	.uleb128 0x15
+	.long	.LASF1176
+	.byte	0x67
+	.long	0x217
+	.long	0x6b1
+	.uleb128 0x7
+	.string	"acc"
+	.byte	0x67
+	.byte	0x1d
+	.long	0x6b1
+	.byte	0
+	.uleb128 0x4
+	.long	0x677
+	.uleb128 0xd
+	.long	.LASF1179
+	.byte	0x5f
+	.long	0x217
+	.long	0x6d0
+	.uleb128 0x7
+	.string	"acc"
+	.byte	0x5f
+	.byte	0x22
+	.long	0x6b1
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1184
+	.byte	0x58
+	.long	0x6f6
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x58
+	.byte	0x19
+	.long	0x9f
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x58
+	.byte	0x24
+	.long	0x9f
+	.uleb128 0x7
+	.string	"z"
+	.byte	0x58
+	.byte	0x2f
+	.long	0x9f
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1187
+	.byte	0xa
+	.byte	0x53
+	.byte	0xd
+	.long	0x70e
+	.uleb128 0x7
+	.string	"acc"
+	.byte	0x53
+	.byte	0x23
+	.long	0x6b1
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1177
+	.byte	0x43
+	.long	0x217
+	.long	0x728
+	.uleb128 0x9
+	.long	.LASF1178
+	.byte	0x43
+	.byte	0x1f
+	.long	0x728
+	.byte	0
+	.uleb128 0x4
+	.long	0x66b
+	.uleb128 0xd
+	.long	.LASF1180
+	.byte	0x3d
+	.long	0x217
+	.long	0x747
+	.uleb128 0x9
+	.long	.LASF1178
+	.byte	0x3d
+	.byte	0x2a
+	.long	0x728
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1181
+	.byte	0x36
+	.long	0x217
+	.long	0x76c
+	.uleb128 0x9
+	.long	.LASF1178
+	.byte	0x36
+	.byte	0x2f
+	.long	0x728
+	.uleb128 0x9
+	.long	.LASF1182
+	.byte	0x36
+	.byte	0x3e
+	.long	0x223
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1183
+	.byte	0x2e
+	.long	0x217
+	.long	0x786
+	.uleb128 0x9
+	.long	.LASF1178
+	.byte	0x2e
+	.byte	0x24
+	.long	0x728
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1185
+	.byte	0x27
+	.long	0x7ac
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x27
+	.byte	0x1a
+	.long	0x9f
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x27
+	.byte	0x25
+	.long	0x9f
+	.uleb128 0x7
+	.string	"z"
+	.byte	0x27
+	.byte	0x30
+	.long	0x9f
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1188
+	.byte	0xa
+	.byte	0x22
+	.byte	0xd
+	.uleb128 0x9
+	.long	.LASF1178
+	.byte	0x22
+	.byte	0x25
+	.long	0x728
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.file 14 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 27 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.file 28 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 29 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x1d
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 31 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x1f
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 32 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 33 "./src/main/drivers/accgyro_fake.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF807
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF768
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF908
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF944
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF965
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1055
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF1
+	.long	.LASF1189
+	.long	.LASF1190
+	.long	.LASF1191
+	.long	.LASF1192
+	.long	.LASF1193
+	.long	.LASF1194
+	.long	.LASF1195
+	.long	.LASF1196
+	.long	.LASF1197
+	.long	.LASF1198
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x22
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1199
+	.byte	0x6
+	.long	.LASF1200
+	.byte	0x6
+	.long	.LASF1201
+	.byte	0x6
+	.long	.LASF1202
+	.byte	0x2
+	.long	.LASF1203
+	.byte	0x2
+	.long	.LASF1204
+	.byte	0x1
+	.long	.LASF1205
+	.byte	0x2
+	.long	.LASF1206
+	.byte	0x2
+	.long	.LASF1207
+	.byte	0x2
+	.long	.LASF1208
+	.byte	0x2
+	.long	.LASF1209
+	.byte	0x9
+	.long	.LASF1210
+	.byte	0xa
+	.long	.LASF1211
+	.byte	0xa
+	.long	.LASF1211
+	.byte	0x9
+	.long	.LASF1212
+	.byte	0x6
+	.long	.LASF1213
+	.byte	0x9
+	.long	.LASF1214
+	.byte	0x9
+	.long	.LASF1215
+	.byte	0x6
+	.long	.LASF1216
+	.byte	0x6
+	.long	.LASF1217
+	.byte	0x8
+	.long	.LASF1218
+	.byte	0x6
+	.long	.LASF1219
+	.byte	0x7
+	.long	.LASF1220
+	.byte	0x7
+	.long	.LASF1221
+	.byte	0x6
+	.long	.LASF1222
+	.byte	0x6
+	.long	.LASF1223
+	.byte	0x6
+	.long	.LASF1224
+	.byte	0x5
+	.long	.LASF1225
+	.byte	0x4
+	.long	.LASF1226
+	.byte	0x3
+	.long	.LASF1227
+	.byte	0xa
+	.long	.LASF1228
+	.byte	0x4
+	.long	.LASF1229
+	.byte	0x1
+	.long	.LASF1230
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1135:
+	.string	"mpuReadRegisterFnPtr"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF783:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1050:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1010:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF860:
+	.string	"NULL ((void *)0)"
+.LASF1015:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1062:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF910:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1101:
+	.string	"csnPin"
+.LASF1011:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF1031:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1093:
+	.string	"CW180_DEG"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1116:
+	.string	"gyroDev_s"
+.LASF1172:
+	.string	"gyroDev_t"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1084:
+	.string	"IO_t"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF522:
+	.string	"__flexarr []"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1079:
+	.string	"int32_t"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF867:
+	.string	"U_ID_0 0"
+.LASF951:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1029:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF977:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1078:
+	.string	"int16_t"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF879:
+	.string	"USE_UART1 "
+.LASF985:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1090:
+	.string	"ALIGN_DEFAULT"
+.LASF862:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1139:
+	.string	"readFn"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF939:
+	.string	"__enable_irq() "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF885:
+	.string	"USE_UART7 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF932:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1127:
+	.string	"dataReady"
+.LASF925:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF823:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1185:
+	.string	"fakeGyroSet"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF975:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1159:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF779:
+	.string	"USE_SERIALRX_SUMD "
+.LASF858:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF807:
+	.string	"VTX_TRAMP "
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF816:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF837:
+	.string	"_GCC_SIZE_T "
+.LASF1012:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1110:
+	.string	"revisionCode"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF796:
+	.string	"TELEMETRY_MAVLINK "
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF827:
+	.string	"_T_SIZE "
+.LASF957:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1007:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF923:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1016:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1148:
+	.string	"MPU_60x0"
+.LASF1034:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1098:
+	.string	"CW270_DEG_FLIP"
+.LASF978:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF800:
+	.string	"USE_MSP_PUSH "
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF965:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1182:
+	.string	"temperatureData"
+.LASF868:
+	.string	"U_ID_1 1"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1120:
+	.string	"exti"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF944:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF806:
+	.string	"VTX_SMARTAUDIO "
+.LASF895:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF967:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1095:
+	.string	"CW0_DEG_FLIP"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF808:
+	.string	"_STDDEF_H "
+.LASF1179:
+	.string	"fakeAccRead"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF801:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1145:
+	.string	"mpuConfiguration_t"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF776:
+	.string	"USE_SERIALRX_IBUS "
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1099:
+	.string	"sensor_align_e"
+.LASF934:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF880:
+	.string	"USE_UART2 "
+.LASF1076:
+	.string	"long int"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF907:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1044:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1171:
+	.string	"float"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1036:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF815:
+	.string	"_PTRDIFF_T_ "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF987:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1066:
+	.string	"short unsigned int"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF911:
+	.string	"VTX_COMMON"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF909:
+	.string	"USE_DASHBOARD"
+.LASF1170:
+	.string	"gyroRateKHz_e"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1112:
+	.string	"mpuDetectionResult"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF784:
+	.string	"TELEMETRY "
+.LASF1143:
+	.string	"resetFn"
+.LASF1133:
+	.string	"sensorGyroReadDataFuncPtr"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF940:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1176:
+	.string	"fakeAccDetect"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1114:
+	.string	"sensorAccReadFuncPtr"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1042:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1069:
+	.string	"signed char"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1080:
+	.string	"uint8_t"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1038:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF886:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1043:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF763:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF799:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF905:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1121:
+	.string	"scale"
+.LASF1125:
+	.string	"gyroRateKHz"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF913:
+	.string	"VTX_SMARTAUDIO"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1065:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1022:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1087:
+	.string	"extiConfig_s"
+.LASF1085:
+	.string	"extiConfig_t"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF835:
+	.string	"__DEFINED_size_t "
+.LASF984:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1131:
+	.string	"sensorGyroReadFuncPtr"
+.LASF942:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF786:
+	.string	"TELEMETRY_HOTT "
+.LASF1119:
+	.string	"update"
+.LASF1105:
+	.string	"accDev_s"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1156:
+	.string	"ICM_20689_SPI"
+.LASF881:
+	.string	"USE_UART3 "
+.LASF988:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF960:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1103:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF509:
+	.string	"__P(args) args"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF831:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF859:
+	.string	"NULL"
+.LASF1091:
+	.string	"CW0_DEG"
+.LASF1045:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1013:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF778:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1152:
+	.string	"MPU_9250_SPI"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1161:
+	.string	"mpu6050Resolution_e"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1097:
+	.string	"CW180_DEG_FLIP"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1178:
+	.string	"gyro"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1144:
+	.string	"gyroReadXRegister"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1126:
+	.string	"mpuDividerDrops"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF982:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF899:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1024:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF919:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1073:
+	.string	"__uint16_t"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1001:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF805:
+	.string	"VTX_CONTROL "
+.LASF948:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF929:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF822:
+	.string	"__size_t__ "
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF962:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1149:
+	.string	"MPU_60x0_SPI"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1061:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF1168:
+	.string	"GYRO_RATE_8_kHz"
+.LASF1134:
+	.string	"sensorGyroInterruptStatusFuncPtr"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF912:
+	.string	"VTX_CONTROL"
+.LASF1089:
+	.string	"extiHandlerCallback"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF775:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF863:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF1088:
+	.string	"extiCallbackRec_s"
+.LASF1086:
+	.string	"extiCallbackRec_t"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF979:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1055:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF833:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF894:
+	.string	"USE_SERIALRX_SBUS"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF840:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF973:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF1174:
+	.string	"fakeGyroADC"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF943:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF928:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF400:
+	.string	"bool _Bool"
+.LASF950:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1070:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1049:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1169:
+	.string	"GYRO_RATE_32_kHz"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF766:
+	.string	"I2C1_OVERCLOCK true"
+.LASF866:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF958:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF896:
+	.string	"USE_SERIALRX_SUMD"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1130:
+	.string	"mpuIntExtiConfig"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1048:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF949:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1136:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF869:
+	.string	"U_ID_2 2"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF900:
+	.string	"LED_STRIP"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1100:
+	.string	"deviceSpi_s"
+.LASF1035:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1053:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1150:
+	.string	"MPU_65xx_I2C"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF980:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1147:
+	.string	"MPU_3050"
+.LASF1151:
+	.string	"MPU_65xx_SPI"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF803:
+	.string	"USE_SENSOR_NAMES "
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1166:
+	.string	"GYRO_RATE_1_kHz"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1028:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF1033:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1124:
+	.string	"gyroADC"
+.LASF1180:
+	.string	"fakeGyroInitStatus"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF935:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF826:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF933:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1047:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF770:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF818:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1132:
+	.string	"sensorGyroUpdateFuncPtr"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1154:
+	.string	"ICM_20602_SPI"
+.LASF29:
+	.string	"_LP64 1"
+.LASF947:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1128:
+	.string	"dataReadyAtUs"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF804:
+	.string	"VTX_COMMON "
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1096:
+	.string	"CW90_DEG_FLIP"
+.LASF802:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF969:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF850:
+	.string	"_WCHAR_T_DEFINED "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF870:
+	.string	"LED0_PIN NONE"
+.LASF963:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF945:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1094:
+	.string	"CW270_DEG"
+.LASF976:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF887:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF817:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1059:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF777:
+	.string	"USE_SERIALRX_SBUS "
+.LASF812:
+	.string	"_T_PTRDIFF_ "
+.LASF991:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1020:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF990:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF903:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1160:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF546:
+	.string	"__always_inline"
+.LASF1025:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF769:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF768:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF844:
+	.string	"_T_WCHAR_ "
+.LASF1157:
+	.string	"BMI_160_SPI"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF995:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1115:
+	.string	"sensorGyroInitFuncPtr"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1075:
+	.string	"__uint32_t"
+.LASF1138:
+	.string	"mpuConfiguration_s"
+.LASF829:
+	.string	"_SIZE_T_ "
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF891:
+	.string	"SERIAL_RX"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF825:
+	.string	"_SYS_SIZE_T_H "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF841:
+	.string	"__wchar_t__ "
+.LASF997:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1155:
+	.string	"ICM_20608_SPI"
+.LASF996:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF915:
+	.string	"BLACKBOX"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1021:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF772:
+	.string	"USE_PPM "
+.LASF846:
+	.string	"__WCHAR_T "
+.LASF1137:
+	.string	"mpuResetFnPtr"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF781:
+	.string	"USE_SERIALRX_XBUS "
+.LASF828:
+	.string	"__SIZE_T "
+.LASF1052:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF1030:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1106:
+	.string	"init"
+.LASF968:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF499:
+	.string	"__PMT"
+.LASF1014:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1083:
+	.string	"ioTag_t"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1109:
+	.string	"ADCRaw"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF810:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1057:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF789:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1107:
+	.string	"read"
+.LASF1108:
+	.string	"acc_1G"
+.LASF924:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1067:
+	.string	"unsigned int"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1058:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF1003:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF855:
+	.string	"_WCHAR_T_DECLARED "
+.LASF788:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1173:
+	.string	"accDev_t"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF813:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF956:
+	.string	"BIT(x) (1 << (x))"
+.LASF811:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1153:
+	.string	"ICM_20601_SPI"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF797:
+	.string	"TELEMETRY_SRXL "
+.LASF545:
+	.string	"__wur "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF901:
+	.string	"TELEMETRY_FRSKY"
+.LASF402:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF401:
+	.string	"true 1"
+.LASF819:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1026:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF998:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF873:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF992:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1027:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF888:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF836:
+	.string	"___int_size_t_h "
+.LASF1004:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF843:
+	.string	"_WCHAR_T "
+.LASF877:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1104:
+	.string	"sensorAccInitFuncPtr"
+.LASF971:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF876:
+	.string	"USE_FAKE_BARO "
+.LASF1146:
+	.string	"MPU_NONE"
+.LASF1158:
+	.string	"mpuSensor_e"
+.LASF937:
+	.string	"EEPROM_SIZE 32768"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF1123:
+	.string	"gyroZero"
+.LASF1077:
+	.string	"char"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF824:
+	.string	"_SIZE_T "
+.LASF851:
+	.string	"_WCHAR_T_H "
+.LASF1177:
+	.string	"fakeGyroDetect"
+.LASF970:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF914:
+	.string	"VTX_TRAMP"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1181:
+	.string	"fakeGyroReadTemperature"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1040:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF809:
+	.string	"_STDDEF_H_ "
+.LASF917:
+	.string	"USE_SERVOS"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF782:
+	.string	"BLACKBOX "
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF871:
+	.string	"GYRO "
+.LASF918:
+	.string	"USE_DSHOT"
+.LASF938:
+	.string	"__disable_irq() "
+.LASF993:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF893:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1186:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1122:
+	.string	"gyroADCRaw"
+.LASF1129:
+	.string	"gyroAlign"
+.LASF1187:
+	.string	"fakeAccInit"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF854:
+	.string	"_GCC_WCHAR_T "
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF946:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF936:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF974:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF999:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF794:
+	.string	"TELEMETRY_IBUS "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1113:
+	.string	"mpuConfiguration"
+.LASF875:
+	.string	"BARO "
+.LASF393:
+	.string	"SITL 1"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF832:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1081:
+	.string	"uint16_t"
+.LASF814:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1068:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF872:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF994:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF883:
+	.string	"USE_UART5 "
+.LASF989:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF892:
+	.string	"USE_SERIALRX_CRSF"
+.LASF941:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF839:
+	.string	"__size_t "
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1183:
+	.string	"fakeGyroRead"
+.LASF792:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF586:
+	.string	"__stub_stty "
+.LASF787:
+	.string	"TELEMETRY_LTM "
+.LASF798:
+	.string	"USE_DASHBOARD "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF830:
+	.string	"_BSD_SIZE_T_ "
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF966:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF861:
+	.string	"__need_NULL"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1006:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF845:
+	.string	"_T_WCHAR "
+.LASF1046:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF1039:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1018:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1071:
+	.string	"__int16_t"
+.LASF1117:
+	.string	"temperature"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1188:
+	.string	"fakeGyroInit"
+.LASF1041:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1051:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF848:
+	.string	"_BSD_WCHAR_T_ "
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF847:
+	.string	"_WCHAR_T_ "
+.LASF1142:
+	.string	"verifywriteFn"
+.LASF1063:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF961:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1002:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF849:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF765:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1019:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF773:
+	.string	"USE_PWM "
+.LASF838:
+	.string	"_SIZET_ "
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF884:
+	.string	"USE_UART6 "
+.LASF774:
+	.string	"SERIAL_RX "
+.LASF1000:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF791:
+	.string	"GPS "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF767:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF889:
+	.string	"USE_PPM"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1102:
+	.string	"busDevice_t"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1017:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1060:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1032:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF927:
+	.string	"USED_TIMERS 0"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1072:
+	.string	"short int"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF972:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1140:
+	.string	"writeFn"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF821:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF842:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1064:
+	.string	"GYRO_LPF_NONE 7"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF856:
+	.string	"__DEFINED_wchar_t "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF955:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF771:
+	.string	"USE_CLI "
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF793:
+	.string	"TELEMETRY_CRSF "
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1175:
+	.string	"fakeAccData"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF964:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF852:
+	.string	"___int_wchar_t_h "
+.LASF959:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF920:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1056:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF790:
+	.string	"USE_SERVOS "
+.LASF1111:
+	.string	"accAlign"
+.LASF834:
+	.string	"_SIZE_T_DECLARED "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1164:
+	.string	"resolution"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1162:
+	.string	"mpuDetectionResult_s"
+.LASF1165:
+	.string	"mpuDetectionResult_t"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF857:
+	.string	"_BSD_WCHAR_T_"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1082:
+	.string	"uint32_t"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF954:
+	.string	"UNUSED(x) (void)(x)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1184:
+	.string	"fakeAccSet"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF853:
+	.string	"__INT_WCHAR_T_H "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1163:
+	.string	"sensor"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1141:
+	.string	"slowreadFn"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1054:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF930:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF764:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF922:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF1023:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF952:
+	.string	"EXPAND_I(x) x"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF981:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF795:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF780:
+	.string	"USE_SERIALRX_SUMH "
+.LASF820:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1009:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF1074:
+	.string	"__int32_t"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1118:
+	.string	"intStatus"
+.LASF1167:
+	.string	"GYRO_RATE_3200_Hz"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF983:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF1008:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF902:
+	.string	"TELEMETRY_HOTT"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF882:
+	.string	"USE_UART4 "
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF953:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF890:
+	.string	"USE_PWM"
+.LASF931:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1005:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF785:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF986:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1092:
+	.string	"CW90_DEG"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF898:
+	.string	"USE_SERIALRX_XBUS"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1037:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF926:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF864:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF908:
+	.string	"TELEMETRY_IBUS"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF921:
+	.string	"USE_PROFILE "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1212:
+	.string	"libc-header-start.h"
+.LASF1207:
+	.string	"accgyro_mpu.h"
+.LASF1224:
+	.string	"platform.h"
+.LASF1197:
+	.string	"/usr/include"
+.LASF1200:
+	.string	"stdint-intn.h"
+.LASF0:
+	.string	"./src/main/drivers/accgyro_fake.c"
+.LASF1213:
+	.string	"features.h"
+.LASF1229:
+	.string	"utils.h"
+.LASF1192:
+	.string	"src/main/target"
+.LASF1205:
+	.string	"sensor.h"
+.LASF1230:
+	.string	"accgyro_fake.h"
+.LASF1216:
+	.string	"timesize.h"
+.LASF1201:
+	.string	"stdint-uintn.h"
+.LASF1196:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1225:
+	.string	"common.h"
+.LASF1223:
+	.string	"wchar.h"
+.LASF1211:
+	.string	"stdint.h"
+.LASF1215:
+	.string	"wordsize.h"
+.LASF1195:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1222:
+	.string	"time64.h"
+.LASF1190:
+	.string	"src/main/drivers"
+.LASF1206:
+	.string	"accgyro.h"
+.LASF1228:
+	.string	"common_post.h"
+.LASF1194:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1208:
+	.string	"accgyro_fake.c"
+.LASF1221:
+	.string	"typesizes.h"
+.LASF1219:
+	.string	"stubs.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1227:
+	.string	"stddef.h"
+.LASF1214:
+	.string	"features-time64.h"
+.LASF1220:
+	.string	"stubs-64.h"
+.LASF1202:
+	.string	"io_types.h"
+.LASF1226:
+	.string	"target.h"
+.LASF1217:
+	.string	"cdefs.h"
+.LASF1218:
+	.string	"long-double.h"
+.LASF1191:
+	.string	"src/main/target/SITL"
+.LASF1193:
+	.string	"src/main"
+.LASF1210:
+	.string	"stdbool.h"
+.LASF1189:
+	.string	"src/main/common"
+.LASF1204:
+	.string	"axis.h"
+.LASF1203:
+	.string	"exti.h"
+.LASF1209:
+	.string	"stdc-predef.h"
+.LASF1198:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1199:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375 \307\r\004"
+	.string	"T\006\273"
+	.string	"\f"
+	.string	"\354\301\314\336\005"
+	.string	"\001\311\360\273\246\f\f\002"
+	.string	"\002\001\002"
+	.string	"\002\002\240\342\234\212\n\003\264\222\201\340\r"
+	.string	"\004\330\370\241\354\t"
+	.string	"\005\006\316\226\232\307\013\003\007\b\265\200\315\263\f\006\001\t\240\373\206\024\n\002\004\002\002\002\005\006\002\002\002\007\002\002\n\013\356\257\331\214\t\006\002\b\002\003\002\t\002\003\002\n\002\003"
+	.string	"\013"
+	.ascii	"Py\276\313\004\366\"\225\326U;\240\003\344\013H\321\325\300\256"
+	.ascii	"\314\006\003,"
+	.text
+	.section	.gnu.lto_.ipa_sra.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375 hM\002"
+	.string	"4\003\\"
+	.string	"\n"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\001\001"
+	.string	"\003\003\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\020"
+	.string	"\007\003\004\005\003\005\001\001\006"
+	.string	"\003\b\003"
+	.string	""
+	.string	""
+	.string	"\001\t"
+	.string	"\003\n\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\b"
+	.ascii	"9e\034\305tWJ\200\341\230F\3244\245b\317\006\260"
+	.text
+	.section	.gnu.lto_.inline.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`v"
+	.string	"\315\003"
+	.string	"R\204\016\030\260%\351\fE\023PH\245`\330\210\032\206a\352\020B\030!m\313\235\002\013\207\016\372\304Q6\351\252\270\n\031\301\335Z1\300\267\301lO\362E[\300\363-\261m\357\317F\004\030"
+	.string	"#\013\005\\w\224c\226 \3627\007\310\006\325\305\370h\263G\023\306\326\340\270\002\334,\346h\327\231\030\222\001\2448J\236%\020v\324k7%\273\204\236yj\3232n\016\\"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375 h-\002"
+	.string	"\364\002\\"
+	.string	"\n"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\002\001\001\001\003\177\002\002\003\002"
+	.string	"\002\013\004\005\003\006\003\b\003\001\001\001?\177\002\f\t\002\n\013\001\001\003\177\002\003"
+	.string	"\b"
+	.ascii	"@bN\301t\323\207:Ti\214'\316e\216\265\001,"
+	.text
+	.section	.gnu.lto_.pureconst.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\200\004\001\232\004\003\200\004\004\200\004\005\200\004\006"
+	.ascii	"\232\004\b\230\004\t\232\004\n\230\004\013\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\325\004"
+	.string	"\202\006\025\037\240'\351?\366\342\342\372\377\207\367\377o\376b\233#\276\375\377\337m\366\277=}K\332\2262\005\177\274\021\352=c\321Z\031$_\357y\031\246\222\202\227\030\301t\350\351\364\322#\030m\306\206\215\0028H[\233\331R\21697\220P^(\377\300\203\274<\231\215! "
+	.ascii	"\243\032\272\001\003\221\347A\276;\226\035\242\3217&\357\364"
+	.ascii	"\224\355\256D\256\303\215\025\022s\201\017?6\243b\006\031\340"
+	.ascii	"k`\216\035\254Q\032H\301\236z1\366\021\334,\247\300\035\311\020"
+	.ascii	"j\250\362+\202\033"
+	.text
+	.section	.gnu.lto_.lto.d3a457ba0d88a8c2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroInit.3.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"u\007"
+	.string	"B\21645`o\032\003pH\b0\254\026zz\334\221I\321)\323)@\347\\\307\222Y\336\243\356\213j?\3336\t\020P\366\355\233\\5s\310\213_!\201,\221[\312\224\002\025\211B\241\021(!\263\n\252bV\026q\215\034\264y\001\201a\227,\315\314\2024\037\344\004\351\222\220\330,I\313\240\032E6e\205\246M\351\351\356\352\220kL\275d@\215~<`\376f\332\316\364\340G\353\352\377\013\271\366uZ\b\\~\216\032\232\277D\026\221\266\366\264\001#\n~\255I\\\262\331\004\303\002?\247\262\362w\b\005q\034\333\371\263q\344x`\343\330\255\215q\027\362\205\224\r\024\231\377\022\202x\363\333j\237\270sB\231\374"
+	.string	"\030\376\367\235P\035.t\333\203\266\rmS\001\t"
+	.string	"8E"
+	.ascii	"L\2062\253?o1\334\ns\301\344[\215\036wx\321N2"
+	.text
+	.section	.gnu.lto_fakeGyroSet.4.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"e\013"
+	.string	"\346SKD"
+	.string	"\351*\035"
+	.string	"3\2019]G\245S\002\375\340\222\335\343GC\316\2035\325\347JQ\222\356\251\250\344K\263H\253p\263\001U\326 \r\301`\375\257\231"
+	.string	"\277?\221Y1\362g9> \372!\022b\334h\357\224\0025"
+	.string	"7"
+	.string	"8"
+	.string	"\273#\227<\257\r\017u\257\363\016\335\253I\033\202(\205A\201\n-\302\356zt\346\344'\351\277\300\027^\260\326\247\202\305\356z\276`-7\275m\t\333\031\366O\002\273k\032\263?\373\273\227\177\347\262\177z>\265\220mw%7aq\225\301\215\355\177lP\314\354\001\206Ky\273\360\274\202XNs\332\037p\002\344e,\327]\030\001\0136\024\301\023\334\334\240\003\320\031\375\200\201\234ImO\334\306z\240\331\335\n\237\366\232\210o\363j\222q\376\365\352\217\335+D\315\213k\346\034\302q\260S\202]\266&\225\261\337\331&\037\357\323\311dJ\225(@\222\250\344\376H`\007*\245\021\212#\307\367\241\274\225\b\216\250\304\r\357C\205\362\360>q\345\221\"\034\202\200\242\027\022\206\242\367)\3674\346\032"
+	.string	"\347\242(\356\002\032"
+	.string	"RS\240\f\303\304\207\0037d5v\200qZ9\224,;`\0174\003\313\201X\246\342"
+	.ascii	"\366fV\r\212\013C<\f\005\206\201!`\016\004\006\214\200q/\324"
+	.ascii	"\224p\207\027\355$\003"
+	.text
+	.section	.gnu.lto_fakeGyroRead.5.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`k\001\375\f"
+	.string	"\226VSC\020q\224\016\360!\311\241\342\251V\004\304\2052\006\305\"\006\212\246\233\242\333\247\350\001E\001\206\227\310\214\037\333\326im\304\302\344\343\032I\""
+	.string	"\200"
+	.string	"\250"
+	.string	"\343\335o\315\354\024\004\264J\314\244\365=\267\2252\245>"
+	.string	"<"
+	.string	"B"
+	.string	"\033n\334\301<:|\206=b^"
+	.string	"{\264m\017he\360\341\006\017\221\213\016\021\032\273\241\246\032\016>A\377$\236\030@\304\220A\362\301z\002P\260\273\316\326\307\205[o[c{\201\375\031\001\333\302\262i\303\016Y\251\031\354_vw\255.\373!\177\324\264j:5\375"
+	.string	"\020:F\262\327\256\307\353\306\276\210(\036l\257\354\214=\240F(\323\276\210\217X=Du\002\273\256\222\223\r'\267\212J\252I\311\346$)2K\201q\0359\031X\261\351(\276\220\b\252\023\260\002\242\302\036\325\244\305b;\301O\2340\273+\362K\334\304\347\203<zB*\337z\364S\330\343U\303\001\205#_~\207\376|<\036R\007\304q\016\\\274q\270\007#\022\203\316\253\340`\333F\332\347q\024J^\003-Bid\3226\357\3238\b\334I\340<\r\325u\236\226\t\367\227U\227\017b\032\242\345\003\207Zp\326B\225E\312U|E! p\")\250\035\030\021"
+	.ascii	"\301p%W;d\207u\375v\201\364\3016\204\r\032L9\364v\327\350!a\341"
+	.ascii	"\272d\2073\215\025\0139\r<\303v\252\222\301\276\223[-W2\366\264"
+	.ascii	"\335X\304\3368\023\020\343\032\273\205d\007\242\033q^\227!\003"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.6.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"]\t"
+	.string	"\206\021B:@\217\322\001\203\355q\3738</\330\304HcA\273\030\f@\341\334\333\275\250Z\033\262>\365\210u\221\2551\274\211\rs1A\347;\365o\264\200\022W\343Hp\375H\b\331[\2460"
+	.string	"2"
+	.string	"/"
+	.string	"\377\377\t\251\036\362\365h)\270\260H`\272\357\224\035\034r\f\317<\302Q#\266\321b\342Zq\004X\350\356G\fW\006_\362\177\204\377\016\377O\0022-\343R`\377U\377\346\347\310D\362\242f\0324\314qTD1\376\034\3021\025\213\244X\240\373\265\202\322}\023\356\3210\367\313\004\035s\032\036\350\230\013\337g\347\346\377o\363\326\362u\016;\tB\373\260\220\027\347\227\031\013\303\2326\353\030\363\337U\224\034?o\335\335\227\257?\246X%\005\265\356V-\024\244\f\325R\200\324VS\251\202\001\007\201>\237\221'T;\006\333\275N\225\240\243\207\317\242\"<\217\316\223\255\025$\0131'H\2644={\232\235\203\177\246j'\030\f"
+	.ascii	"8E$\fC\351\357 \205\365U\020\263\3304\327<\213\t\b\024\202\313"
+	.ascii	"\036\241&\276\256\371\004"
+	.text
+	.section	.gnu.lto_fakeGyroInitStatus.7.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"%\b"
+	.string	"\322\217:90s\322\001|\177\331\214\231\b\344EQ<\366\274\234\006L\3660p\217\314\rQC\0220\376\215$\357b$A\300\"\013C\254}[\003\3232\210FC\373\333\020!d\357\224\002\036\215\266\255$\"y\232\301\345N\363$\270\322\303G1\"\272\216\233'\352]\230(\304\2440q\023\263\243\247\251\035\370\253\360\350\264\370>:C\266]\367\327J\226\037f\362d\247DCn8\363\250y\353f\007g#\217]QQ\206\330\277vw-Yv\224\034\251\227\202\234]\325O\317\322`2-\333\240\035\262\003P\026b\264\237r\025\360+\031\027\330e\315\304\354V\005\213@\307\\O\220\035\003} ;f\333\033\tt\370:\242b\360I\271\350\354\326)E\036>\206\376Y\216`\322\002b\003\263B=\0024\354\256c\307\352\343\226\267\235`\333\3016I\b"
+	.ascii	"8E$\f\303\326\357\300\204U,+\321\205\037\335\301\314\253\235"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.8.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`8\001\215\f"
+	.string	"V\026TB\360P6\035\370,\2623~\260\360\031\330t\232\375\326\321\210\223\265\244\247h\250\255\003\214\242P\232CL\001\310\2204\257\"B\b\241\364\236\201c\340<x\t\fh\020\320vPvj\302b\327\003}\262S\n="
+	.string	"@"
+	.string	"F"
+	.ascii	"\b|\361\316\371\374\244;"
+	.string	"\347}@w\316\2661\232\222\313\237,\324U\0322\240\265\335\363\333B\274|-\375\303^q\275P\321Z\244L\257\035\tv\327\365\224\332po\267}\300\266\002\373&\002'\016f\375\260\3045\363\260\261\365\206}\232\352\006\302>dw\327\333\312\376\353\257^\246U\253A\241\355\242>p\254\f.\306\b\333%;b\007\350\260\251\325>\212\247(\375E\272\200\335\025l\266{\006\256\030v\315\212\275\3400,\223\2445\022\f\032\024H9w\001\346p\205\240\tK<\013\017\372\341\003\"\220\206\216\216\225F\215y\230\021A4a\355\232?\331\023\276\242\202\267\273\033_\205\205\021\200T\3049\237\324\235\253h\316d0\230\316E#Z(\020\207\026\021\004v8#9\362\204!\370\211H\221\302\207t\360=\370\200\241/$E\237\305\200G\b\"\371I\030G\362\213\330\366\271\207\354\266\362\313n;\341\3212\267\013\256\261\022\262\007\032"
+	.string	"8E$\f\303\t\332!\213\226\312>D\274\005\033KPU\245\001\343\202A@F\200\036x\f\340\f2\002\364\300c"
+	.ascii	"g\220\021\253\022\346j\310]o\26426\3075Z\302C\304\3275\237"
+	.text
+	.section	.gnu.lto_fakeAccInit.10.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`\032"
+	.string	"\215\007"
+	.string	"\242\31655Pu\032\003"
+	.string	"`\244\365\300\200'\204\351c\312<\257=I\003Q\333\245\244\035\b\036\315\332\020\305\330\344&J\246\347,)\221l\003\331\322#ze\244\355nR\246\024\025\211B!\022h\244a\005Rf\260\022\323 2R\3036-\036\244\314\242ij\025\245\351\020%JYD\224\323\024\261\203n\023\332\214\024\3336\343\247\2739\207\253.\270\274\240 F\037\nK\314_M\333\235\036\364h\315\371\377\302U\373\256\026\030\003\231_\343\306\346/\326\212H[\177\332"
+	.string	"\324\310\257\365\210I8\227\\X\340_\245\250\374]BA\036[\355Lp\331\362x\340\262U\256\235q\007\362NGH\306\t\315\377\b?\314\371q\265M\f\220R\235\374:\n\377\373R\252\r\027\272-B[\206\266\034\001\b"
+	.ascii	"tS\240\fk\321[\034\267\002]0\371V\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_fakeAccSet.11.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`\001\001\215\013"
+	.string	"V\224LD"
+	.string	"\313*\035\300q\f\321\177\025\377\227\241\275\330\367\333\343\240\r\017\266\201s\324\022\311\367K\276C\353\307\310\"Wd5\fX\324\360\231\t\302U\325\177\201g\375\2472+Vj.\222\005\223~\225\377J6\331;\2455"
+	.string	":"
+	.string	":"
+	.string	"\3531h\363\n\361\211\356u>\242{5iWx\351\332\307\004\270\3100\354\256GiN~\222\376c\177X\261P\237\016\034\273\353\271b\301\334\364\2661l\203\330W\005\273k\332\262\017\373\273\227?\367\327?7\235\206\b\026\013v_n\033\266V\033\004\260}\216\335\241"
+	.string	"\203\3601\241\244yl^;\017Ds\332'\360\002\344_'\327]\231\001\fv\003\035\245]A\002;\3502p\236#8paR\333\0317p\222p\355\356\206/\373,\305\007\360\352\225q~\365\352\217\335+EMLj\336<g\026$\354\264\331%j\322\031\373\334\006-\037o\221(\024\"\2014\300O\005\313\375}@\222\021)$\024\307\221\357\033y&\021T)\211\"\236IiT\342}\242\311\373\\8<\001E\017%\fE\217S\356\271\245-w\330j)\252r\032"
+	.string	"RS\240\f\353C\272\030_\2445k@|[9\244,;\300\016\034\003\326\001C\250\342"
+	.ascii	"\354\252V\027\216k@<\f\005\206\201!`\016\004\006\214\200q/\324"
+	.ascii	"\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_fakeAccRead.12.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`o\001=\r"
+	.string	"F\327UC"
+	.string	"s\224\016p\004\356\340l1\274T\317\3709\rHD\003E\033\351g\215\367\247\372\237\214\241\006\007D\b\331\024y\215\304\316J\031J\022\260\252\352U%\350\335T\037\031\302)A\252\266\310\252\264\215\333J\231R@"
+	.string	"?"
+	.string	"D"
+	.ascii	"\273\240\307\240\315\243\301\027\270\0367'p="
+	.string	"\332vh\204\362wpu\2421Y\331\300\362\262\013b:\342\337\363\363\277\362\004&v\204\340\301B!yj \354\2563\205\322\341\326\333^`;\202}\037\001\035\024\034`\\6\201\330 I\252\b\373\231\335]\253\312\276\312\0375\255\232NM\037\300\203\326\313\217\003\341\356IL\220\305\021[H\330F\331\034[\200\213Q\246\375\024W\201\272\312\310\007\354\252X\255\367\215\353Q?\244\312\210\3419\013Ff\350!\3075<uV6\375\205\327\200%\204\013\260J\031\271\036SG\312\3056\203\2678mv\327\201\277\342,<?\345\321\030D\362\251G_\344z\274*\350\321R\2221\016\026\211B!\022h\264}\fhZ\246\326>[\205\214$\201\3534P\320\264\f\363\272-C\251\233\200Y(e&L\353<\354\203\300\334\205\255\303B8\256\3038\340>\263\252\362\277KO\300\224(Q\023g\bB\325F\215\3178\215V\037"
+	.ascii	"t#\320\205XG\320\035x\226r\261@\252\006\003C\332\240A\325\034"
+	.ascii	"\202\355\262\241\033\354-C\303\251\004\003C\312@\003p\006\266"
+	.ascii	"[C\2628>\313a\341\254\204`u\332\224\261\030{\345g\002*\343\032"
+	.ascii	"\225\205\345\032\220\360\020\347uM2"
+	.text
+	.section	.gnu.lto_fakeAccDetect.13.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"\025\013"
+	.string	"\326TND \251*\035\370\202\363\013\006\314Q\022"
+	.string	"'K\361E\326\2630\317z\201\277\204ak\002d\320\350\226\312\3370V\025IV\2621\252h'H>\200\254"
+	.string	"\3352]\377\305!g\256f\323N\320B\321 A{\247\0248"
+	.string	"8"
+	.string	"@"
+	.string	">/\361\335\303<\342\273g\333\235O\312\346OY\353/\007(\265\334\356\tV\226\233\247\246\377\004\277\0200\341%\241\201Ku\332"
+	.string	"\332]S\226K\345\256\267\215a\233\303>(\247\212\326\230\375\313\356\256+\314>\355\247\337\306-G\241\302\266\333\332aX\b\336\003"
+	.string	"\266o;eg\354\207\330\207R\373\b>K\235\206:\304.lv\333=3\314\301\334\013\253zbj3p\321g\217g \232\300Y 0\"\225^#\251m@\204\020\223\006\267\273:\313\036\371\202\022\314\356j\370\nLN\016\262\226{>\352\273\367\f\254\225\025\335Ys EWa\351\005;\366x:\235\020\3473n(D1\254\0267#)\fu\220\345I$\212!h*G\222Q\351\001~\214\302\022(\226&pca\022d,A\021\222,\301\214m\237\373\313V\230o~\265\200.@\016"
+	.ascii	"}#\220\363<\210m)1`\247\2524`\\00(\310\252\t\270\202\344\256"
+	.ascii	"2Z\231\220\177\227\211\257k>\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"e\003"
+	.string	"\244\004\020\001"
+	.string	""
+	.string	""
+	.string	"\002\003\177\027\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006\005\177\030\005\002\031\200\204\001"
+	.string	""
+	.string	"\003\002\006\177\032\007\177\033\002\n\177\034\f\177\035\005\t\036\004\177\037\272\200\202\002\b\177 \013\177!\r\177\""
+	.string	"\r"
+	.string	"\200\036\340\317N\002\300\215\227\t\b\234A\207l"
+	.ascii	"e\\U\023P\006 \324\037\350\240\203\351\004"
+	.text
+	.section	.gnu.lto_.refs.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375 Y\265\001"
+	.string	"\222\205\f\017\260\0254\007\f\303\340\2625\333\275\275I\222)*\263\207\005;4\205\346\264@X\261\263\025\331\035 \316S\236\277\n\2134\220NNXkX\337\205:\b"
+	.text
+	.section	.gnu.lto_.decls.d3a457ba0d88a8c2,"e",@progbits
+	.string	"(\265/\375`\246\036\275\207"
+	.string	"\n\332p0R@PJ\352\267z\362\r\334\250\021\037\251\232\3639W\261\355 p\024\317\277!n\fO\271\321\377L\034\363\260Bt\210L\320l9\276D$\212\240rek;\340\026\217\326.\334a\377\256\376a\305lu\372\037s\3303\222h\201\033 V\222\273m\231R\n\241\002\370\002\364\002\355\322\326\362F=\247\376\230\222d\304\f\367]\202\373~\341\276Z\270o\026\356\373\304}y\340\276N\270\241n\263\276P\367\377x\334+\177\246,\017(\351\325\267\361@.\355\263\017\242JCR\275\332\027\t\247\360\353\263\265/\016<s\225\270\313\334f\325\363\275\013\035\213\342\346Eo\016{\027\367\342\322\001\374\313Ez\325\320\350\025\321\263\202\333\007X}\317\007X\373\321\360\024(\023D\026\305\344U\277{\267s.\355w~C3\240\242g\222\231+g\250\337\2519\373\270\027"
+	.ascii	"t/\300wV\345\223dU\373\313p\377\027&\341 V\022N\007\223\204N"
+	.ascii	"k|J\255\312\027#\270\337\312\345\374\215\213\027!g\226O\302="
+	.ascii	"\235:\210\325\312M\315\221\016%\312W\373\221\270S@\361\265\333"
+	.ascii	"\305\304Kx\354\325\345\fm\207s\251Wq*\255Bs;Z7\216Wq6w\273]\314"
+	.ascii	"\234\224:2\340\207m,\r/gh\211\233\0224K\360\276$\255\352\324"
+	.ascii	"\333jnT\005\375@2\305\302\355;|\312\033I}\b\035a\217\342R\\\352"
+	.ascii	"j\216\326\252\2273Gs\206\322\\\237\2445\262W\333I\2545Nbm\307"
+	.ascii	"\201U\267YG\250\200\273\375\211\023_S\251\264\366*\rP\031\345"
+	.ascii	"RN\007K\335\314\313\272\363\r\360\212Y\224\252W;\210\233\003"
+	.ascii	"\334un\263\336\354 V\024y\211\207\031u@\301{\265\333\221@\275"
+	.ascii	"\313\301\334\231s2\347\034\300\317\350I\027\r\257\272\227'qi"
+	.ascii	"\b\377j?\342J\332\347\003\315P\267a\352\247\350\325\016\016b"
+	.ascii	"\355\027xf\201\356\266\361\311*\372\261\0139{\210\325\367\366"
+	.ascii	"<\304\212\302A\254\253\333\254~\004\247\035\211\315\312lBs\315"
+	.ascii	"-C\003\312{\365\215t\373\226s\205\270J\034\316\f\2263\324\303"
+	.ascii	"o\006\263\035=^m\250\203X\261\333\254\335"
+	.string	"N\325\355Cq\335\376\343J\267W\001\273/\220\264\347\217\264\266$Q\335\316\202\225nG\032\341\272\335\247J\267'\331>t_$Ln\367U\nS\273\357Q\267\247p\323v\335\035\323}m\200\320k\367\335\352\357\276-t\373[\267\267u;[\267\257u{Z\267\237u\273Y\2673\351\366\260n\217v\273W\267\037\351v\035\335\016\325\335\034t\273\004\335NA\267\253\350\366\027\335n\325\355A\335\r\326\335J\272\335\201n\317\352\366!\335\216\325\335\033t\273\220n\227\241\333\257\272\375\331\355\312\356\016\353n\256\356>\240\273\325\272[fooo\257\373Et\373*\350\276a\021~\346W|\n\206\201\335\336M\376\222\337\222\217F\\1\271~\331d>\005\363g\226\226\272\177\341\306\013\371\024L\325\242\363\3612x\251\241\016\r\317\363\2007g\030\276<]\354&\037\207\207\371tJ\325\232\253\313\341s\f\235s\213\333\3408"
+	.ascii	"\221\320L\024C\006mk\347jz*\031-\317\354Xn\322kp-E2D\323/xxq"
+	.ascii	"7\371>\236\347\323f\004Z]n\362\221|\227\210\037%\006\\\330\220"
+	.ascii	"7\371\311\027\002&\241\031\371\263\312_\360\360nJ\334\241)gX"
+	.ascii	"%\324:\255\245\253\037\025\266\362U\244CLL\236\354\0058\246g"
+	.ascii	"z,\037\347y\027\372\374)\341\321T\207\003\367R\244DO\347*{),"
+	.ascii	"\200\2300CpK/\004\313\253}\025\021?\312\254J\233CzDr\206j\371"
+	.ascii	"\271\317\3625\274\334\323\271\364\261\374\225v1o\3227\320\022"
+	.ascii	"7\300\244]\264\bP\355\237\022\356_\022\367\232\003\356\365\316"
+	.ascii	"\355\337\332\330\250\222@S\267n\233@\352\005j\332\337Vs\005E"
+	.ascii	"\351\365\352\263\375\231\334\230\227\362\325\247\342yPLZu\257"
+	.ascii	"\376\232\347\211Eq\031\231r\275\270\356\220Li\317\373\2675\034"
+	.ascii	"?g\037%\355\314\316J\027\022(i5sAL\356\320\372\323hj\240b\365"
+	.ascii	"|\365i\3703\240\rZ_]g\375\304\327u#+*\004\215\026d\030\224\223"
+	.ascii	"'\n\001\003\245DE\312\253o\346y1Y\350\324h\360<_\024\0279\262"
+	.ascii	"+\334\344\307\304\326\2538\252\275\250&bj\330\322TT\337\365\213"
+	.ascii	"\371\334\260\202,y\265\327&\334\353\013X&?\335f\375\257!sOv\322"
+	.ascii	"\216^\037uX\236I\372\243\310,L\256\370\3500\324\nfH\2160\271"
+	.ascii	"(\270}O\336\210c}\271\241L\213k\353\227\354\342EE\253\177\313"
+	.ascii	"\267\346\336px\365\213|\025~\022!m\020\201\331\002\3076E\244"
+	.ascii	"\035L\345q5\266\025\004\017y\243\246\350\013\257\266o\211\333"
+	.ascii	"\367\203;\270\315\372W/\332\232:\262\340\247\025\214\025\256"
+	.ascii	"1.A\372\255\272\031P\341w\367\016\206\036UU\335\r\343H\2329\310"
+	.ascii	"\276\nH\r\0245=\246W\201\374\217U\213\356\207\331\206[\225\202"
+	.ascii	"w\334\\%\311\"/\345\322\237z\247\251\327\361=\200a\3167\275\231"
+	.ascii	",\324\305L\355\301\303\207\206\352\224\257~\f0S\220rD\371\201"
+	.ascii	"\273\037\312\245\037\325s39\213 \361$\304\350\325\276k\230\227"
+	.ascii	"\202\243\363\362O\375NfV\262\364\352\216\337\\\221\233\327\322"
+	.ascii	"\303\360N\377\344S\245\350\325V\223p\253I\334w\017\217p\2335"
+	.ascii	"\204\257\210G\220\326\253\257\364\314O\362i\263CN\216A\251\313"
+	.ascii	"97]\372JOT\"\304\0335\231\202S\325\034.\375\244G\272I\321\215"
+	.ascii	"\323\237\364E\177\344\323&4\033E@\266\003\t/g\350M\t5k\311eE"
+	.ascii	"U\373\242\3417\332\230]}\275\b\020K\242\002#\205k\200,p\211\334"
+	.ascii	"\"}\265\272[\353\036\3019\347\037\325\223\217&^n\"\221\350\276"
+	.ascii	"F\372\036\211i.\277\214\\.|\004eB\272\\w\353\202A\315\2247\350"
+	.ascii	"\266a5\245\275\332\030\007\334\335\355k\366a\346\234\215|\320"
+	.ascii	"\314\374\231Y\273\275\335\347N\242\233\306\257\033\220s'\260"
+	.ascii	"\223\263\317\030\021;,\204\314\247iDn\337\224\251\214B!)\200"
+	.ascii	"*JB))\243P\031\231\f\202\364\300\314PHe4g\0179\231D\3468\263"
+	.ascii	"\007e4\027e\033nE\236\241P\310\234tf\0179\231}F(\223PE\312\250"
+	.ascii	"O\221\007e\024\252(G\241r\207\234\364a\n%3\323C\216Bm\311QgQ"
+	.ascii	"\007e\324Y\244\214BQy\020\241\036zFM\210\360`\362'e2\017-\235"
+	.ascii	"|\230\035\246J\2503\307\345\354`@\231i@\316NNf\234\217\222\227"
+	.ascii	"\375L\207~\304|\234\016]\376D9sr\252\304r\346\214\3653#/\033"
+	.ascii	"@B\247\231\312\247\310\030\2342\016\240\234\005X\346\214\364"
+	.ascii	"<\3159#s\316?\246\0234g\246\016\312\347r\231s\363f\231\235\220"
+	.ascii	"f@9?X\reE\312h\224\023\307\354+\372\314AP\244?s\034\024\023G"
+	.ascii	"\221]\031\307\r\370Ytd\303\2533\020Y\220\325\224%\313\351\313"
+	.ascii	"\262\270y\r\271O?\253'hgX\\@79-'B\236j\036\330[\022\031^\352"
+	.ascii	"s\"j[^\365s)\255\211\351U+\03269,N\302p\247\360\272Q\313\313"
+	.ascii	"\224\272E\036v\241e\027D-\341<\222\013\003\013\240!\251(\242"
+	.ascii	"+uo\\\242\257$LuW\352\032\335\244\013-\303AI\232W\352\276\340"
+	.ascii	"Z\230\3744\365"
+	.ascii	"\270<\356\324\365q\253.\325\375q\201\334 .\275RW\251\035\313"
+	.ascii	"\215AL\212\005\020\223\203\037\035uR\267\213\t3\224\304\251\316"
+	.ascii	"\367x,\233\037\324\365\351B9q\025\234\323"
+	.string	"\023\254\247\353\004\313qwG_\347Z\003\022\315\313\325\321\224\227df\265\343:\335\246o\202%$v\231\3726\315x\231B\005\351.\001\255\034!sr\227n\023\270t\313P\267y\225`\270\304\345\260\225\204\357\321Er)\0027\307\377\310!,\311\253\215\227\270\035\201\365\356\3559\002kc \334\277=\020\353]\336\241\276D\027G\276D\r8s\366\271D5y9\373\324\270\027\340^\200\252\025e\265dU\373\347\005\367O\013\356_\025\334}\205\372*c\270\256\272\336^\275A>\2664= Rp;\327\234\327\321\225\245\360z%T\352\364n\376\275\277\273@\217\303{y\274\267{\033>\357\273|\016\027\371\\\376\313\375\271>\177\303\265\341\322\233\374\037\375`\037&\004\353\263D\374(3p\302\"d\206?\242\027'6\364K1UP2\177\022\245\364\261\355\220m\331\034\232\226\375`8l\021\003l\331\017\206\303\026"
+	.string	"\200\020\200\213\234\0262\006\314\364\220hd\213\254\t\270\033X\261\300\n\026)\374\232\005\004( @\2616\013\bpp X\201\203{\005\316m\207\303\026\037.\300\t\016\207\302u5\ng\fU6\306\216\213\342\016\361H\254\301\032g\206C!n{\206\211\001\332\021<\034\203"
+	.ascii	"\254\277\342\013\024vt\2161F\266=\022M`a\210\320\303C\003D\361"
+	.ascii	"\005\333\022\215(\250 \203hdk\320\030[\017`\364\360\320\240)"
+	.ascii	"\276h\331#k\374\t\215=-\261\230AK,\022A\304\020\262FU\330\ns"
+	.ascii	"B\260\306\236Vhdyh\260\255\fO\217\321\310\266\305\fF\034{Za\373"
+	.string	"A[$\302\030[\017\206\305\236\027!\354\030U\270 \200c\260\006\233\303\266\302\030<=k\3170!\200\221\325\211Q\024b`\323\026e\37418da\2340\024\226\240\243#t\341A\355\031&D\034\203D\236\017b\310\264\301\0162P\213D\017\212\307\341J\3449\3366\310\016\2115\330\234cO\t2\307\236\022.\253#\034\036}(\ba\270\310i\021\263cdI\300.rZ\374d\360\350\\6H\263\002\006\032\260\255\020\206L\033d\361;\362\354\030s\214l\fb\rb\215\316\316N\005A\037L\033d E[$\366\340c\bm\013\025b\bY\030\302V\030\203\206\r\n\203\300\242\tD\235\0260m\3170\321\303Cc\207\2075\236hwv\214'd\330 \f\024*P\254\350\341\241a\323\243\263sd\2151\307\340\0076\370A\017\017\r\031\343\316\261\310\036\327V\247\347\310\302(\356\020\333!\333\2629=<4"
+	.string	"h\217Av\306\004\242\214\342\216\013b\233\202\005m1\203\036\036\032\035\332\340\n\234\266H\374u\212\024\f0 \003G\005k\342\246\037x\300\305\210\0208\270"
+	.string	"\017M\260'\be\004w\214*\2300\034\nO\034\215l\r\2421\306\211\"QH\343\304\320x<a\242"
+	.string	",g\330\316J\357)\316lf\016\251k\357\312\r\363\265\371PK\263r\275\036\251+k\013\334=B\325\274\312\257\322(\275\275\335\263\017E\266"
+	.string	"q,q\211\032\202i\312\332\332\356\332\315\f\310\231\"\317-[>0p\210\215\355z}\270\272\032\222\367\305\255\t\327"
+	.ascii	"E\211r\327<lK\223\004\315\264\213\230\215)}\327\336\226\316\222"
+	.ascii	"\257^5\007\213\346"
+	.string	"X\323\361\352\225\342`0]lK[\016\006|\332\001A\276\3321D\230f\271@\337\2644\017#\221\263\321\210!E1?\230&\313\211\223{\206b\206-\314'}\317\374\356o\034e;\0340\r\227&M\256\031rK\003C\256\312\372\232\251\310 N\320\310\274\226zvdc\036W\327e\312*FN\rn+\013\006V1ar\275\274\231/\235\231\217&\021\030(\030\250\344\353\353\206-\333\300\372\206\215I\253\004\275z\225\\.\265\213\026,5\030(\246\371Y\240oTz\243\036\366\320\214\214\021B2\263\002\r\203\205\201rP\350\365\n\202\207\250R\3018L\"\225B\246fDd$I\222\016\342\n\020\206\342i\236\306\262\003\022\200DAP:\251ff$IQ\262\354g\356*/Q\245\344\304<\266\"\240\227\030\345\225p\272u\2530\222\244yv\212!\024c\310\364\375\003\214\242\313\374\252\020\335\275\334\026l\r"
+	.ascii	"\323\273x\216U\205\320\017\0210R3DS\347mq\325\\\216\376iTf\026"
+	.ascii	"\234\2401\027\337\343\322\224\021\340w\241\2429\375^R\3373\364"
+	.ascii	"UG^\200\217\261L\004/\006\021\221P\216\022~\242\335\366\205&"
+	.ascii	".\334\2770\272"
+	.string	"\254<\017?EB\t\006\2450\005\361\271\023\320\316\237\342*\227\025nN?\2526\202\\\024\243\025\330\250\320\356\250\032\325\032\026\202a`v2\333\221\035\006\234E\027\225\231\225\260\374\376\233'\263\001u\375\215jb\220\214\213\325\200\326\301\262\216\023\370\351\261\002\316\023\301\004`\202\252%`\354\211Z\235a\356\b9\376\353\234jR\340\212\350\300\320\024\027\373\305\273/\271\213\250CE]v\341e\257\321\270\372o\272\3377pW\355\020#'\300Z\027\357\031\233\001\"P\300Sh\313\rh\372/\337}`k\347\375\220\211]\250\265N\234}|\3216\350I\016\302Y\264\345.\343\271I \244,\307\261\341\221\371}\310\357Y\001\250qO\227F\031E\265o\277O\027-\377_e\313S=)\303\004\016\202\234\365\301\231E\\(\231\213=6[\366\326\033\342=\034\314K\310t\325\346wjq4\265\341ci\323\211\2559\013"
+	.string	"@*D\266\215\304=\213[\332\3569\\Kb\326\364\334\334\024\021\267\303I\343\343\207\231\264\324\245\215iXp\207\341\233\037;s\262\302\2052\200\272t\020T\211J {\210\3714\023\030/p#\017%\251\366\274\272N\336\004\304\003V0\362\217\205\235\327.\270\357\275=\263V\362$t\275\\\334\345\341\nJ\325\021 \350\316\002\t\263Y\230\312L'!1"
+	.string	"\317\350\372\221S\020\003W\327\005\204m\371Z\037\217j\022'\221\241 4z\2203\324\212\370\376U-@\326\003b\177$\017^\313\214\327B[\247\202\\\261}\374x\201O\251\335<H\204d\004\212\021\376t>\231\300\334\331\311\330i*\203-\244\341AP6\256\024\335!\3151x\263\021@\340\0168\325\017\246'Z\021\376\305\027\270\031jx5\375QV \025\236k\316\351\242\367F\300\300(B|\004\337\213|r/l\330J\020\321\2546o\325']\004}\023\353\001\261\274\270\274.\002\025\320o\306s\203O\004\371\242^\370\276\317\342\035\300\022\205`\246e\204\216\202\001\241\200\201=q \227\234\177\216\242\246\235\215\361\313\270\363N\035B)\224\253\256\242?\277| D\177\001Y\321\356\342\304\205\024n+\212\330\365\337\335R\270\320O\333\355\370A]\213p"
+	.ascii	"Rp\267\301\017A\201\002\032\017\342\214t\234*\242va\362%\354"
+	.ascii	":4D \327_\177\205\007\362\203\232M4\212%\260\336\372\312D\021"
+	.ascii	"\223{\237\316\001u\220B\016k\0011\rT\362>H\024\377\004Z\235\307"
+	.ascii	"\314\232Dh\027\036\353\3125K\237\346 .\357\276\335\0225K\004"
+	.ascii	"\274CZxqM\025?\255|\026\\Q\020\350-r|e\260\n\026\360\344\360"
+	.ascii	"\356\346;\205\346OP"
+	.string	"\020I\315\376\r\314\232\017\354X\274\235P\243\312kH\226F\221\274\235\t\235\301\245Hv%Q\201n\213\007\226<\206\311K\200\357(\225\375\225\240W\220\232\226V.\367\345\271:\336)\021w\031'\237\334\352\220\214x\250\372#\234\327\345k\361\344\277\3360\344\375fZiMP\204\220\350\232\305\364b7\027\253\227\241\3752\032\326+Fs\351!\203Y\313}\241#4\b\272\001\331\210lF\301\212\211~\002\336\201v0\246\271I\217\252\334)\303\346u\255\361G<\267ZS\306\342f\243\363\020\366h\310gN{\274L.\034D\3459\026\003\340\223\200\330Ty\224\322\255\233\034\346\374LS\362\364\242\333\002c\3643\003\266}o\311\231\\\326C\306.\236"
+	.ascii	"\232 \202\333`\236\234\223\317\27271\356\002e\265\353=\360\332"
+	.ascii	"\351\335\366Y\204zs\240\347Y\210\370s\026\277\311\t\t,\250^\217"
+	.ascii	"7Z\026\255\324t\374\203z\306.\f2Ah\346d\317Q\201\303\036\227"
+	.ascii	"\022\177hF^\225a\027\035\375|\264u\244\363\330\016\271\006\330"
+	.ascii	"\374gPs\237\205:\3179\007\216'\264\357\201\026\334\214\007\177"
+	.ascii	"\250\307`s\307\022\204\317\013\225bm\256[\331\235\241\257\202"
+	.ascii	"m\303\323\340\252\177\325\034\346\246\332\327\365\236\337U:I"
+	.ascii	"|\\\233.h\005"
+	.text
+	.section	.gnu.lto_.symtab.d3a457ba0d88a8c2,"e",@progbits
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d3a457ba0d88a8c2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,14013 @@
+	.file	"block_device_mmap.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/fcntl.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.file 8 "./src/main/drivers/flash.h"
+	.file 9 "./src/main/drivers/sdcard.h"
+	.file 10 "./src/main/drivers/block_device_mmap.h"
+	.file 11 "./src/main/drivers/block_device_mmap.c"
+	.file 12 "/usr/include/x86_64-linux-gnu/sys/mman.h"
+	.file 13 "/usr/include/unistd.h"
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/stat.h"
+	.file 15 "/usr/include/string.h"
+	.file 16 "./src/main/drivers/system.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	block_device_mmap.c.6bc161f1
+	.weak	block_device_mmap.c.6bc161f1
+block_device_mmap.c.6bc161f1:
+	.long	0xbdd
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1d
+	.long	.LASF1939
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1760
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1761
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1762
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1763
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1764
+	.uleb128 0x3
+	.long	.LASF1766
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1765
+	.uleb128 0x3
+	.long	.LASF1767
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1768
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1769
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1770
+	.uleb128 0x3
+	.long	.LASF1771
+	.byte	0x1
+	.byte	0x91
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x3
+	.long	.LASF1772
+	.byte	0x1
+	.byte	0x92
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x3
+	.long	.LASF1773
+	.byte	0x1
+	.byte	0x93
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x3
+	.long	.LASF1774
+	.byte	0x1
+	.byte	0x94
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x3
+	.long	.LASF1775
+	.byte	0x1
+	.byte	0x96
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x3
+	.long	.LASF1776
+	.byte	0x1
+	.byte	0x97
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x3
+	.long	.LASF1777
+	.byte	0x1
+	.byte	0x98
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x3
+	.long	.LASF1778
+	.byte	0x1
+	.byte	0xa0
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x1f
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1779
+	.byte	0x1
+	.byte	0xaf
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x3
+	.long	.LASF1780
+	.byte	0x1
+	.byte	0xb4
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x3
+	.long	.LASF1781
+	.byte	0x1
+	.byte	0xc5
+	.byte	0x12
+	.long	0x83
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1782
+	.uleb128 0x9
+	.long	0x110
+	.uleb128 0x3
+	.long	.LASF1783
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x9
+	.long	0x11c
+	.uleb128 0x3
+	.long	.LASF1784
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x9
+	.long	0x12d
+	.uleb128 0x3
+	.long	.LASF1785
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x9
+	.long	0x13e
+	.uleb128 0x3
+	.long	.LASF1786
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x9
+	.long	0x14f
+	.uleb128 0x3
+	.long	.LASF1787
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x4
+	.long	0x117
+	.uleb128 0x3
+	.long	.LASF1788
+	.byte	0x5
+	.byte	0x38
+	.byte	0x11
+	.long	0xd2
+	.uleb128 0xa
+	.long	.LASF1791
+	.byte	0x10
+	.byte	0x6
+	.byte	0xb
+	.byte	0x8
+	.long	0x1a5
+	.uleb128 0x1
+	.long	.LASF1789
+	.byte	0x6
+	.byte	0x10
+	.byte	0xc
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1790
+	.byte	0x6
+	.byte	0x15
+	.byte	0x15
+	.long	0x104
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1792
+	.byte	0x90
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x8
+	.long	0x276
+	.uleb128 0x1
+	.long	.LASF1793
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xd
+	.long	0x8a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1794
+	.byte	0x7
+	.byte	0x24
+	.byte	0xd
+	.long	0xae
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1795
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xf
+	.long	0xc6
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1796
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xe
+	.long	0xba
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1797
+	.byte	0x7
+	.byte	0x2f
+	.byte	0xd
+	.long	0x96
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1798
+	.byte	0x7
+	.byte	0x30
+	.byte	0xd
+	.long	0xa2
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1799
+	.byte	0x7
+	.byte	0x32
+	.byte	0x9
+	.long	0x70
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1800
+	.byte	0x7
+	.byte	0x34
+	.byte	0xd
+	.long	0x8a
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1801
+	.byte	0x7
+	.byte	0x39
+	.byte	0xd
+	.long	0xd2
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1802
+	.byte	0x7
+	.byte	0x3d
+	.byte	0x11
+	.long	0xec
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1803
+	.byte	0x7
+	.byte	0x3f
+	.byte	0x10
+	.long	0xf8
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1804
+	.byte	0x7
+	.byte	0x4a
+	.byte	0x15
+	.long	0x17d
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1805
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x15
+	.long	0x17d
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1806
+	.byte	0x7
+	.byte	0x4c
+	.byte	0x15
+	.long	0x17d
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1807
+	.byte	0x7
+	.byte	0x59
+	.byte	0x17
+	.long	0x276
+	.byte	0x78
+	.byte	0
+	.uleb128 0x20
+	.long	0x104
+	.long	0x286
+	.uleb128 0x21
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1808
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1809
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1810
+	.uleb128 0x22
+	.uleb128 0xa
+	.long	.LASF1811
+	.byte	0x10
+	.byte	0x8
+	.byte	0x19
+	.byte	0x10
+	.long	0x2eb
+	.uleb128 0x1
+	.long	.LASF1812
+	.byte	0x8
+	.byte	0x1a
+	.byte	0xe
+	.long	0x13e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1813
+	.byte	0x8
+	.byte	0x1c
+	.byte	0xe
+	.long	0x13e
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1814
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x14
+	.long	0x14a
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0x8
+	.byte	0x1f
+	.byte	0xe
+	.long	0x14f
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1816
+	.byte	0x8
+	.byte	0x21
+	.byte	0xe
+	.long	0x14f
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1817
+	.byte	0x8
+	.byte	0x22
+	.byte	0x3
+	.long	0x29c
+	.uleb128 0x9
+	.long	0x2eb
+	.uleb128 0xa
+	.long	.LASF1818
+	.byte	0x58
+	.byte	0x8
+	.byte	0x28
+	.byte	0x10
+	.long	0x399
+	.uleb128 0x1
+	.long	.LASF1819
+	.byte	0x8
+	.byte	0x29
+	.byte	0xb
+	.long	0x3a5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1820
+	.byte	0x8
+	.byte	0x2a
+	.byte	0xb
+	.long	0x3b9
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1821
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xc
+	.long	0x3c9
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1822
+	.byte	0x8
+	.byte	0x2d
+	.byte	0xc
+	.long	0x3ce
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1823
+	.byte	0x8
+	.byte	0x2f
+	.byte	0xc
+	.long	0x3c9
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1824
+	.byte	0x8
+	.byte	0x30
+	.byte	0xc
+	.long	0x3e8
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1825
+	.byte	0x8
+	.byte	0x31
+	.byte	0xc
+	.long	0x3ce
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1826
+	.byte	0x8
+	.byte	0x32
+	.byte	0xc
+	.long	0x402
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1827
+	.byte	0x8
+	.byte	0x33
+	.byte	0xc
+	.long	0x402
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1828
+	.byte	0x8
+	.byte	0x35
+	.byte	0xb
+	.long	0x425
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1829
+	.byte	0x8
+	.byte	0x37
+	.byte	0x1e
+	.long	0x434
+	.byte	0x50
+	.byte	0
+	.uleb128 0x15
+	.long	0x39e
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1830
+	.uleb128 0x4
+	.long	0x399
+	.uleb128 0xe
+	.long	0x39e
+	.long	0x3b9
+	.uleb128 0x2
+	.long	0x14f
+	.byte	0
+	.uleb128 0x4
+	.long	0x3aa
+	.uleb128 0x10
+	.long	0x3c9
+	.uleb128 0x2
+	.long	0x14f
+	.byte	0
+	.uleb128 0x4
+	.long	0x3be
+	.uleb128 0x4
+	.long	0x29b
+	.uleb128 0x10
+	.long	0x3e3
+	.uleb128 0x2
+	.long	0x3e3
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x139
+	.uleb128 0x4
+	.long	0x3d3
+	.uleb128 0x10
+	.long	0x402
+	.uleb128 0x2
+	.long	0x14f
+	.uleb128 0x2
+	.long	0x3e3
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x3ed
+	.uleb128 0xe
+	.long	0x70
+	.long	0x420
+	.uleb128 0x2
+	.long	0x14f
+	.uleb128 0x2
+	.long	0x420
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x12d
+	.uleb128 0x4
+	.long	0x407
+	.uleb128 0x15
+	.long	0x42f
+	.uleb128 0x4
+	.long	0x2f7
+	.uleb128 0x4
+	.long	0x42a
+	.uleb128 0x3
+	.long	.LASF1831
+	.byte	0x8
+	.byte	0x38
+	.byte	0x3
+	.long	0x2fc
+	.uleb128 0x9
+	.long	0x439
+	.uleb128 0x16
+	.long	0x30
+	.byte	0x2b
+	.long	0x467
+	.uleb128 0xb
+	.long	.LASF1832
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1833
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF1834
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1835
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x3
+	.long	0x44a
+	.uleb128 0x16
+	.long	0x30
+	.byte	0x31
+	.long	0x496
+	.uleb128 0xb
+	.long	.LASF1836
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1837
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF1838
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF1839
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1840
+	.byte	0x9
+	.byte	0x36
+	.byte	0x3
+	.long	0x473
+	.uleb128 0x3
+	.long	.LASF1841
+	.byte	0x9
+	.byte	0x38
+	.byte	0xf
+	.long	0x4ae
+	.uleb128 0x4
+	.long	0x4b3
+	.uleb128 0x10
+	.long	0x4cd
+	.uleb128 0x2
+	.long	0x467
+	.uleb128 0x2
+	.long	0x14f
+	.uleb128 0x2
+	.long	0x420
+	.uleb128 0x2
+	.long	0x14f
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1842
+	.byte	0x20
+	.byte	0x9
+	.byte	0x3d
+	.byte	0x10
+	.long	0x50f
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xb
+	.long	0x3a5
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xb
+	.long	0x52d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0x9
+	.byte	0x40
+	.byte	0x1f
+	.long	0x546
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0x9
+	.byte	0x41
+	.byte	0x1f
+	.long	0x569
+	.byte	0x18
+	.byte	0
+	.uleb128 0xe
+	.long	0x39e
+	.long	0x52d
+	.uleb128 0x2
+	.long	0x14f
+	.uleb128 0x2
+	.long	0x420
+	.uleb128 0x2
+	.long	0x4a2
+	.uleb128 0x2
+	.long	0x14f
+	.byte	0
+	.uleb128 0x4
+	.long	0x50f
+	.uleb128 0xe
+	.long	0x496
+	.long	0x546
+	.uleb128 0x2
+	.long	0x14f
+	.uleb128 0x2
+	.long	0x14f
+	.byte	0
+	.uleb128 0x4
+	.long	0x532
+	.uleb128 0xe
+	.long	0x496
+	.long	0x569
+	.uleb128 0x2
+	.long	0x14f
+	.uleb128 0x2
+	.long	0x420
+	.uleb128 0x2
+	.long	0x4a2
+	.uleb128 0x2
+	.long	0x14f
+	.byte	0
+	.uleb128 0x4
+	.long	0x54b
+	.uleb128 0x3
+	.long	.LASF1847
+	.byte	0x9
+	.byte	0x42
+	.byte	0x3
+	.long	0x4cd
+	.uleb128 0x9
+	.long	0x56e
+	.uleb128 0xa
+	.long	.LASF1848
+	.byte	0x1c
+	.byte	0xa
+	.byte	0x21
+	.byte	0x10
+	.long	0x5e8
+	.uleb128 0x1
+	.long	.LASF1849
+	.byte	0xa
+	.byte	0x22
+	.byte	0xe
+	.long	0x14f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1850
+	.byte	0xa
+	.byte	0x23
+	.byte	0xe
+	.long	0x14f
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1851
+	.byte	0xa
+	.byte	0x24
+	.byte	0xe
+	.long	0x14f
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0xa
+	.byte	0x25
+	.byte	0xe
+	.long	0x14f
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0xa
+	.byte	0x26
+	.byte	0xe
+	.long	0x14f
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0xa
+	.byte	0x27
+	.byte	0xe
+	.long	0x14f
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0xa
+	.byte	0x28
+	.byte	0xe
+	.long	0x14f
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1856
+	.byte	0xa
+	.byte	0x29
+	.byte	0x3
+	.long	0x57f
+	.uleb128 0x9
+	.long	0x5e8
+	.uleb128 0xa
+	.long	.LASF1857
+	.byte	0x18
+	.byte	0xa
+	.byte	0x2b
+	.byte	0x10
+	.long	0x655
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0xa
+	.byte	0x2c
+	.byte	0xe
+	.long	0x14f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0xa
+	.byte	0x2d
+	.byte	0xe
+	.long	0x14f
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0xa
+	.byte	0x2e
+	.byte	0xe
+	.long	0x14f
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0xa
+	.byte	0x2f
+	.byte	0xe
+	.long	0x14f
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0xa
+	.byte	0x30
+	.byte	0xe
+	.long	0x14f
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0xa
+	.byte	0x31
+	.byte	0xe
+	.long	0x14f
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1864
+	.byte	0xa
+	.byte	0x32
+	.byte	0x3
+	.long	0x5f9
+	.uleb128 0x9
+	.long	0x655
+	.uleb128 0x17
+	.long	.LASF1865
+	.byte	0x3d
+	.byte	0x1c
+	.long	0x445
+	.uleb128 0x17
+	.long	.LASF1866
+	.byte	0x3e
+	.byte	0x1d
+	.long	0x57a
+	.uleb128 0x6
+	.long	.LASF1867
+	.byte	0x34
+	.byte	0x11
+	.long	0x420
+	.uleb128 0x6
+	.long	.LASF1868
+	.byte	0x35
+	.byte	0x11
+	.long	0x14f
+	.uleb128 0x6
+	.long	.LASF1869
+	.byte	0x36
+	.byte	0xc
+	.long	0x70
+	.uleb128 0x6
+	.long	.LASF1870
+	.byte	0x38
+	.byte	0x18
+	.long	0x2eb
+	.uleb128 0x6
+	.long	.LASF1871
+	.byte	0x3c
+	.byte	0x1c
+	.long	0x5e8
+	.uleb128 0x6
+	.long	.LASF1872
+	.byte	0x3d
+	.byte	0x1b
+	.long	0x655
+	.uleb128 0x6
+	.long	.LASF1873
+	.byte	0x3e
+	.byte	0x11
+	.long	0x14f
+	.uleb128 0x6
+	.long	.LASF1874
+	.byte	0x40
+	.byte	0x11
+	.long	0x14f
+	.uleb128 0x6
+	.long	.LASF1875
+	.byte	0x42
+	.byte	0x11
+	.long	0x14f
+	.uleb128 0x6
+	.long	.LASF1876
+	.byte	0x43
+	.byte	0xc
+	.long	0x39e
+	.uleb128 0x23
+	.byte	0x30
+	.byte	0xb
+	.byte	0x45
+	.byte	0x8
+	.long	0x769
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0xb
+	.byte	0x46
+	.byte	0x9
+	.long	0x39e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1878
+	.byte	0xb
+	.byte	0x47
+	.byte	0x9
+	.long	0x39e
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0xb
+	.byte	0x48
+	.byte	0x1c
+	.long	0x467
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0xb
+	.byte	0x49
+	.byte	0xe
+	.long	0x14f
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0xb
+	.byte	0x4a
+	.byte	0xe
+	.long	0x420
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0xb
+	.byte	0x4b
+	.byte	0x28
+	.long	0x4a2
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0xb
+	.byte	0x4c
+	.byte	0xe
+	.long	0x14f
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1884
+	.byte	0xb
+	.byte	0x4d
+	.byte	0xe
+	.long	0x14f
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1885
+	.byte	0xb
+	.byte	0x4e
+	.byte	0xe
+	.long	0x14f
+	.byte	0x28
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1886
+	.byte	0x4f
+	.byte	0x3
+	.long	0x6ea
+	.uleb128 0x6
+	.long	.LASF1887
+	.byte	0x51
+	.byte	0xc
+	.long	0x39e
+	.uleb128 0x6
+	.long	.LASF1888
+	.byte	0x52
+	.byte	0x11
+	.long	0x14f
+	.uleb128 0x6
+	.long	.LASF1889
+	.byte	0x53
+	.byte	0x11
+	.long	0x14f
+	.uleb128 0x24
+	.long	0x666
+	.byte	0xb
+	.byte	0xd6
+	.byte	0x15
+	.uleb128 0x25
+	.long	0x671
+	.byte	0xb
+	.value	0x159
+	.byte	0x16
+	.uleb128 0xc
+	.long	.LASF1890
+	.byte	0xc
+	.byte	0x4c
+	.byte	0xc
+	.long	0x70
+	.long	0x7c1
+	.uleb128 0x2
+	.long	0xea
+	.uleb128 0x2
+	.long	0x160
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1891
+	.byte	0xc
+	.byte	0x59
+	.byte	0xc
+	.long	0x70
+	.long	0x7e1
+	.uleb128 0x2
+	.long	0xea
+	.uleb128 0x2
+	.long	0x160
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1892
+	.byte	0xc
+	.byte	0x39
+	.byte	0xe
+	.long	0xea
+	.long	0x810
+	.uleb128 0x2
+	.long	0xea
+	.uleb128 0x2
+	.long	0x160
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xd2
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1893
+	.value	0x166
+	.long	0x70
+	.long	0x825
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1894
+	.value	0x419
+	.long	0x70
+	.long	0x83f
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0xd2
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1895
+	.byte	0xe
+	.byte	0xd2
+	.byte	0xc
+	.long	0x70
+	.long	0x85a
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0x85a
+	.byte	0
+	.uleb128 0x4
+	.long	0x1a5
+	.uleb128 0xc
+	.long	.LASF1896
+	.byte	0x5
+	.byte	0xb5
+	.byte	0xc
+	.long	0x70
+	.long	0x87b
+	.uleb128 0x2
+	.long	0x16c
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1897
+	.byte	0xf
+	.byte	0x3d
+	.byte	0xe
+	.long	0xea
+	.long	0x89b
+	.uleb128 0x2
+	.long	0xea
+	.uleb128 0x2
+	.long	0x70
+	.uleb128 0x2
+	.long	0x160
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1940
+	.byte	0x10
+	.byte	0x1b
+	.byte	0xa
+	.long	0x14f
+	.uleb128 0x28
+	.long	.LASF1903
+	.byte	0x10
+	.byte	0x18
+	.byte	0x6
+	.long	0x8b9
+	.uleb128 0x2
+	.long	0x14f
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1898
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xe
+	.long	0xea
+	.long	0x8d9
+	.uleb128 0x2
+	.long	0xea
+	.uleb128 0x2
+	.long	0x8d9
+	.uleb128 0x2
+	.long	0x160
+	.byte	0
+	.uleb128 0x4
+	.long	0x8de
+	.uleb128 0x29
+	.uleb128 0x19
+	.long	.LASF1901
+	.value	0x1c0
+	.uleb128 0x1a
+	.long	.LASF1899
+	.value	0x1bb
+	.byte	0x1b
+	.long	0x8f2
+	.uleb128 0x4
+	.long	0x661
+	.uleb128 0x1a
+	.long	.LASF1900
+	.value	0x1b6
+	.byte	0xa
+	.long	0x420
+	.uleb128 0x2a
+	.long	.LASF1941
+	.byte	0xb
+	.value	0x1b0
+	.byte	0x6
+	.long	0x91d
+	.uleb128 0x7
+	.long	.LASF1905
+	.value	0x1b0
+	.byte	0x3a
+	.long	0x91d
+	.byte	0
+	.uleb128 0x4
+	.long	0x5f4
+	.uleb128 0x19
+	.long	.LASF1902
+	.value	0x19e
+	.uleb128 0x2b
+	.long	.LASF1904
+	.byte	0xb
+	.value	0x16a
+	.byte	0x5
+	.long	0x39e
+	.long	0x979
+	.uleb128 0x7
+	.long	.LASF1906
+	.value	0x16a
+	.byte	0x25
+	.long	0x16c
+	.uleb128 0x7
+	.long	.LASF1907
+	.value	0x16a
+	.byte	0x38
+	.long	0x14f
+	.uleb128 0x7
+	.long	.LASF1908
+	.value	0x16a
+	.byte	0x47
+	.long	0x14f
+	.uleb128 0x13
+	.long	.LASF1909
+	.value	0x16e
+	.byte	0xb
+	.long	0xea
+	.uleb128 0x11
+	.uleb128 0x13
+	.long	.LASF1910
+	.value	0x176
+	.byte	0x15
+	.long	0x1a5
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1911
+	.value	0x13d
+	.byte	0x20
+	.long	0x496
+	.long	0x9ba
+	.uleb128 0x7
+	.long	.LASF1880
+	.value	0x13d
+	.byte	0x3a
+	.long	0x14f
+	.uleb128 0x7
+	.long	.LASF1881
+	.value	0x13d
+	.byte	0x4f
+	.long	0x420
+	.uleb128 0x7
+	.long	.LASF1882
+	.value	0x13d
+	.byte	0x7a
+	.long	0x4a2
+	.uleb128 0x7
+	.long	.LASF1883
+	.value	0x13d
+	.byte	0x8d
+	.long	0x14f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1912
+	.value	0x129
+	.byte	0x20
+	.long	0x496
+	.long	0x9e3
+	.uleb128 0x7
+	.long	.LASF1880
+	.value	0x129
+	.byte	0x40
+	.long	0x14f
+	.uleb128 0x7
+	.long	.LASF1913
+	.value	0x129
+	.byte	0x55
+	.long	0x14f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1914
+	.value	0x119
+	.byte	0xc
+	.long	0x39e
+	.long	0xa24
+	.uleb128 0x7
+	.long	.LASF1880
+	.value	0x119
+	.byte	0x25
+	.long	0x14f
+	.uleb128 0x7
+	.long	.LASF1881
+	.value	0x119
+	.byte	0x3a
+	.long	0x420
+	.uleb128 0x7
+	.long	.LASF1882
+	.value	0x119
+	.byte	0x65
+	.long	0x4a2
+	.uleb128 0x7
+	.long	.LASF1883
+	.value	0x119
+	.byte	0x78
+	.long	0x14f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1915
+	.value	0x101
+	.byte	0xc
+	.long	0x39e
+	.long	0xa43
+	.uleb128 0x11
+	.uleb128 0x13
+	.long	.LASF1916
+	.value	0x107
+	.byte	0x12
+	.long	0x420
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1923
+	.byte	0xf3
+	.long	0xa90
+	.uleb128 0x5
+	.long	.LASF1879
+	.byte	0xf3
+	.byte	0x39
+	.long	0x467
+	.uleb128 0x5
+	.long	.LASF1880
+	.byte	0xf3
+	.byte	0x4d
+	.long	0x14f
+	.uleb128 0x5
+	.long	.LASF1881
+	.byte	0xf3
+	.byte	0x62
+	.long	0x420
+	.uleb128 0x5
+	.long	.LASF1882
+	.byte	0xf4
+	.byte	0x28
+	.long	0x4a2
+	.uleb128 0x5
+	.long	.LASF1883
+	.byte	0xf4
+	.byte	0x3b
+	.long	0x14f
+	.uleb128 0x5
+	.long	.LASF1917
+	.byte	0xf4
+	.byte	0x52
+	.long	0x14f
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1926
+	.byte	0xed
+	.uleb128 0xf
+	.long	.LASF1918
+	.byte	0xe8
+	.byte	0xc
+	.long	0x39e
+	.uleb128 0xf
+	.long	.LASF1919
+	.byte	0xd1
+	.byte	0x1f
+	.long	0x42f
+	.uleb128 0x1b
+	.long	.LASF1920
+	.byte	0xbe
+	.long	0x70
+	.long	0xadc
+	.uleb128 0x5
+	.long	.LASF1921
+	.byte	0xbe
+	.byte	0x24
+	.long	0x14f
+	.uleb128 0x5
+	.long	.LASF1881
+	.byte	0xbe
+	.byte	0x36
+	.long	0x420
+	.uleb128 0x5
+	.long	.LASF1922
+	.byte	0xbe
+	.byte	0x42
+	.long	0x70
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1924
+	.byte	0xb7
+	.long	0xb08
+	.uleb128 0x5
+	.long	.LASF1921
+	.byte	0xb7
+	.byte	0x27
+	.long	0x14f
+	.uleb128 0x5
+	.long	.LASF1925
+	.byte	0xb7
+	.byte	0x3f
+	.long	0x3e3
+	.uleb128 0x5
+	.long	.LASF1922
+	.byte	0xb7
+	.byte	0x49
+	.long	0x70
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1927
+	.byte	0xb1
+	.uleb128 0xd
+	.long	.LASF1928
+	.byte	0xa0
+	.long	0xb47
+	.uleb128 0x5
+	.long	.LASF1925
+	.byte	0xa0
+	.byte	0x35
+	.long	0x3e3
+	.uleb128 0x5
+	.long	.LASF1922
+	.byte	0xa0
+	.byte	0x3f
+	.long	0x70
+	.uleb128 0x11
+	.uleb128 0x1c
+	.string	"i"
+	.byte	0xa2
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x11
+	.uleb128 0x6
+	.long	.LASF1921
+	.byte	0xa4
+	.byte	0x18
+	.long	0x15b
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1929
+	.byte	0x98
+	.long	0xb5d
+	.uleb128 0x5
+	.long	.LASF1921
+	.byte	0x98
+	.byte	0x2c
+	.long	0x14f
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1930
+	.byte	0x8f
+	.uleb128 0xd
+	.long	.LASF1931
+	.byte	0x84
+	.long	0xb79
+	.uleb128 0x5
+	.long	.LASF1921
+	.byte	0x84
+	.byte	0x27
+	.long	0x14f
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1932
+	.byte	0x76
+	.long	0x39e
+	.long	0xb9e
+	.uleb128 0x5
+	.long	.LASF1933
+	.byte	0x76
+	.byte	0x27
+	.long	0x14f
+	.uleb128 0x6
+	.long	.LASF1934
+	.byte	0x78
+	.byte	0x13
+	.long	0x128
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1935
+	.byte	0x71
+	.byte	0xc
+	.long	0x39e
+	.uleb128 0xf
+	.long	.LASF1936
+	.byte	0x64
+	.byte	0xc
+	.long	0x39e
+	.uleb128 0xd
+	.long	.LASF1937
+	.byte	0x5a
+	.long	0xbd5
+	.uleb128 0x2c
+	.string	"us"
+	.byte	0xb
+	.byte	0x5a
+	.byte	0x24
+	.long	0x14f
+	.uleb128 0x1c
+	.string	"now"
+	.byte	0x5c
+	.byte	0x14
+	.long	0x15b
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1938
+	.byte	0x55
+	.byte	0xc
+	.long	0x39e
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 17 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 19 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x13
+	.file 20 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 22 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 23 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 26 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 35 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 36 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x24
+	.file 37 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 38 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 39 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x27
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF949
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF950
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/fcntl.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x29
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 43 "/usr/include/linux/falloc.h"
+	.byte	0x3
+	.uleb128 0x162
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1103
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1112
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/stat.h"
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1113
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/mman.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1175
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/mman-map-flags-generic.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/mman-linux.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/mman-shared.h"
+	.byte	0x3
+	.uleb128 0x77
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1246
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/mman_ext.h"
+	.byte	0x3
+	.uleb128 0x96
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x65
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/statx.h"
+	.byte	0x3
+	.uleb128 0x1d1
+	.uleb128 0x35
+	.file 54 "/usr/include/linux/stat.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1273
+	.file 55 "/usr/include/linux/types.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1274
+	.file 56 "/usr/include/x86_64-linux-gnu/asm/types.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x38
+	.file 57 "/usr/include/asm-generic/types.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1275
+	.file 58 "/usr/include/asm-generic/int-ll64.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1276
+	.file 59 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 60 "/usr/include/asm-generic/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1279
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 61 "/usr/include/linux/posix_types.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1280
+	.file 62 "/usr/include/linux/stddef.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 63 "/usr/include/x86_64-linux-gnu/asm/posix_types.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x3f
+	.file 64 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 65 "/usr/include/asm-generic/posix_types.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1289
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/statx-generic.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x42
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/struct_statx_timestamp.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x43
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/types/struct_statx.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h"
+	.byte	0x3
+	.uleb128 0xca
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/environments.h"
+	.byte	0x3
+	.uleb128 0xce
+	.uleb128 0x46
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x3
+	.uleb128 0xe2
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.byte	0x3
+	.uleb128 0x276
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h"
+	.byte	0x3
+	.uleb128 0x387
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1732
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1733
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1734
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h"
+	.byte	0x3
+	.uleb128 0x4c2
+	.uleb128 0x4a
+	.file 75 "/usr/include/linux/close_range.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 76 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x8
+	.file 77 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1759
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.eede275f7c631e873798a342d248b8b6,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.e588860cdd2ffbd65f78e992f35d75dc,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF948
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntl.h.24.62c7e777a8b210e920ccbb92cfe8b9d8,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF954
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_iovec.h.20.64e3c6cefa401374951f8ea68dba2a0a,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntllinux.h.42.66fc3dd2eb9e548124f834f46a09c6d1,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1076
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.falloc.h.3.74001d56cdb3f986d217acbf397bd249,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1084
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntllinux.h.367.20dd1433251f22a4594b44d9ff5a02c1,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1097
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntl.h.40.13d716505369aaa80c46fffaf4998fe6,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1102
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1109
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1111
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_stat.h.24.58804b9fde232cb81d58c44500307576,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1120
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stat.h.29.cab33b67e546bcdba0ebb7d142404f85,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1139
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntl.h.80.34001020898245d8535bf89fc94e0aa0,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1173
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mman.h.20.0a69816f5023e7a796431872d8a791ee,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mmanmapflagsgeneric.h.29.e9996815dd608597ffd8554753980063,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1186
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mmanlinux.h.32.e3e4130c583298f987457be528e6ddd8,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1236
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mmanshared.h.25.3138308e830b109e361078932b8c0590,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1245
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stat.h.23.0c10ae81bb32828c6315808c13cf2e1c,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1254
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stat.h.104.75fb58194ba4379fc75175a5977edd6b,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1272
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitsperlong.h.3.81201f16c5ebf9ebeb0f369d7d7d8e27,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1278
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.3.65729c9f805bc1ab8e22fab65fee3ee6,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1284
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_types.h.22.ce27b629270cbb91230af7498cb5994b,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_types_64.h.3.c35937438f2f85070758d4696b933189,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.21.289d3f9188ccc1b4f5b3ba629527d096,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stat.h.142.90b051455f059d0cf10ec6c3e6ce5565,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1321
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.statx.h.33.790099d4164393bf7e0ab7a0f95e4477,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1323
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.23.e34f3a5c100123d9385c8b91a86a6783,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1340
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_opt.h.20.21a42956ee7763f6aa309b86c7756272,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1402
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.environments.h.56.c5802092ccc191baeb41f8d355bb878f,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1414
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.210.764cafdc86da480922697b081ef16bc1,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.256.c9c56fec92899d0d9e6a0c330e6cd984,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1425
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.confname.h.27.257966e7e49af2ab4cb41132b3606cbf,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1731
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.close_range.h.3.4d88cbc6c547d67820b4ac3b219a3d11,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1737
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1754
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1756
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.block_device_mmap.h.26.7c2192c34254090849ef963649d38919,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1758
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1942
+	.long	.LASF1943
+	.long	.LASF1944
+	.long	.LASF1945
+	.long	.LASF1946
+	.long	.LASF1947
+	.long	.LASF1948
+	.long	.LASF1949
+	.long	.LASF1950
+	.long	.LASF1951
+	.long	.LASF1952
+	.long	.LASF1953
+	.long	.LASF1954
+	.long	.LASF1955
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4e
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1956
+	.byte	0xa
+	.long	.LASF1957
+	.byte	0xa
+	.long	.LASF1958
+	.byte	0xa
+	.long	.LASF1959
+	.byte	0xe
+	.long	.LASF1960
+	.byte	0xd
+	.long	.LASF1961
+	.byte	0x9
+	.long	.LASF1962
+	.byte	0xa
+	.long	.LASF1963
+	.byte	0x2
+	.long	.LASF1964
+	.byte	0x2
+	.long	.LASF1965
+	.byte	0x2
+	.long	.LASF1966
+	.byte	0x2
+	.long	.LASF1967
+	.byte	0xc
+	.long	.LASF1968
+	.byte	0xd
+	.long	.LASF1969
+	.byte	0xc
+	.long	.LASF1970
+	.byte	0xd
+	.long	.LASF1971
+	.byte	0x2
+	.long	.LASF1972
+	.byte	0xd
+	.long	.LASF1973
+	.byte	0xe
+	.long	.LASF1974
+	.byte	0xe
+	.long	.LASF1974
+	.byte	0xd
+	.long	.LASF1975
+	.byte	0xa
+	.long	.LASF1976
+	.byte	0xd
+	.long	.LASF1977
+	.byte	0xd
+	.long	.LASF1978
+	.byte	0xa
+	.long	.LASF1979
+	.byte	0xa
+	.long	.LASF1980
+	.byte	0xc
+	.long	.LASF1981
+	.byte	0xa
+	.long	.LASF1982
+	.byte	0xb
+	.long	.LASF1983
+	.byte	0xb
+	.long	.LASF1984
+	.byte	0xa
+	.long	.LASF1985
+	.byte	0xa
+	.long	.LASF1986
+	.byte	0xa
+	.long	.LASF1987
+	.byte	0x9
+	.long	.LASF1988
+	.byte	0x9
+	.long	.LASF1989
+	.byte	0xd
+	.long	.LASF1990
+	.byte	0x5
+	.long	.LASF1991
+	.byte	0x4
+	.long	.LASF1992
+	.byte	0x3
+	.long	.LASF1993
+	.byte	0x4
+	.long	.LASF1960
+	.byte	0xa
+	.long	.LASF1994
+	.byte	0xa
+	.long	.LASF1995
+	.byte	0x9
+	.long	.LASF1996
+	.byte	0x7
+	.long	.LASF1997
+	.byte	0xa
+	.long	.LASF1998
+	.byte	0xa
+	.long	.LASF1999
+	.byte	0x9
+	.long	.LASF1969
+	.byte	0xa
+	.long	.LASF1967
+	.byte	0xa
+	.long	.LASF2000
+	.byte	0xa
+	.long	.LASF2001
+	.byte	0xa
+	.long	.LASF2002
+	.byte	0xa
+	.long	.LASF2003
+	.byte	0xa
+	.long	.LASF2004
+	.byte	0xa
+	.long	.LASF1969
+	.byte	0x7
+	.long	.LASF1956
+	.byte	0x7
+	.long	.LASF1956
+	.byte	0x8
+	.long	.LASF1956
+	.byte	0x6
+	.long	.LASF2005
+	.byte	0x6
+	.long	.LASF2006
+	.byte	0x8
+	.long	.LASF2006
+	.byte	0x6
+	.long	.LASF2007
+	.byte	0x7
+	.long	.LASF1959
+	.byte	0x7
+	.long	.LASF2007
+	.byte	0x8
+	.long	.LASF2008
+	.byte	0x8
+	.long	.LASF2007
+	.byte	0x6
+	.long	.LASF2009
+	.byte	0xa
+	.long	.LASF2010
+	.byte	0x9
+	.long	.LASF2011
+	.byte	0x9
+	.long	.LASF2012
+	.byte	0xa
+	.long	.LASF2013
+	.byte	0xa
+	.long	.LASF2014
+	.byte	0xa
+	.long	.LASF2015
+	.byte	0xa
+	.long	.LASF2016
+	.byte	0xa
+	.long	.LASF2017
+	.byte	0xa
+	.long	.LASF2018
+	.byte	0x7
+	.long	.LASF2019
+	.byte	0x1
+	.long	.LASF2020
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1289:
+	.string	"__ASM_GENERIC_POSIX_TYPES_H "
+.LASF1578:
+	.string	"_SC_XOPEN_LEGACY _SC_XOPEN_LEGACY"
+.LASF988:
+	.string	"O_DIRECT __O_DIRECT"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1357:
+	.string	"_POSIX_THREADS 200809L"
+.LASF1122:
+	.string	"__S_IFDIR 0040000"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF1745:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1409:
+	.string	"__ILP32_OFF32_CFLAGS \"-m32\""
+.LASF1098:
+	.string	"__OPEN_NEEDS_MODE(oflag) (((oflag) & O_CREAT) != 0 || ((oflag) & __O_TMPFILE) == __O_TMPFILE)"
+.LASF1234:
+	.string	"MCL_CURRENT 1"
+.LASF1721:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS"
+.LASF1664:
+	.string	"_SC_SIGSTKSZ _SC_SIGSTKSZ"
+.LASF1491:
+	.string	"_SC_LINE_MAX _SC_LINE_MAX"
+.LASF1539:
+	.string	"_SC_XOPEN_XCU_VERSION _SC_XOPEN_XCU_VERSION"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1311:
+	.string	"STATX__RESERVED 0x80000000U"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1184:
+	.string	"MAP_HUGETLB 0x40000"
+.LASF1111:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1418:
+	.string	"__ssize_t_defined "
+.LASF1915:
+	.string	"sdcardPoll"
+.LASF1652:
+	.string	"_SC_V7_ILP32_OFFBIG _SC_V7_ILP32_OFFBIG"
+.LASF1299:
+	.string	"STATX_UID 0x00000008U"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF1933:
+	.string	"timeoutMillis"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_PPM"
+.LASF1861:
+	.string	"erases"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1105:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1199:
+	.string	"MAP_ANONYMOUS 0x20"
+.LASF1028:
+	.string	"F_SHLCK 8"
+.LASF1335:
+	.string	"_XOPEN_XPG2 1"
+.LASF1577:
+	.string	"_SC_XBS5_LPBIG_OFFBIG _SC_XBS5_LPBIG_OFFBIG"
+.LASF1163:
+	.string	"R_OK 4"
+.LASF1102:
+	.string	"__pid_t_defined "
+.LASF1104:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1518:
+	.string	"_SC_GETGR_R_SIZE_MAX _SC_GETGR_R_SIZE_MAX"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1766:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1090:
+	.string	"AT_NO_AUTOMOUNT 0x800"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1916:
+	.string	"block"
+.LASF1786:
+	.string	"uint32_t"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1830:
+	.string	"_Bool"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF1478:
+	.string	"_SC_PAGE_SIZE _SC_PAGESIZE"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1380:
+	.string	"_POSIX_REGEXP 1"
+.LASF1689:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LINTFLAGS _CS_XBS5_ILP32_OFFBIG_LINTFLAGS"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1278:
+	.string	"__BITS_PER_LONG 64"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1053:
+	.string	"RWH_WRITE_LIFE_MEDIUM 3"
+.LASF1601:
+	.string	"_SC_NETWORKING _SC_NETWORKING"
+.LASF1346:
+	.string	"_POSIX_FSYNC 200809L"
+.LASF1759:
+	.string	"DEFAULT_TIMEOUT_MILLIS 1000"
+.LASF1479:
+	.string	"_SC_RTSIG_MAX _SC_RTSIG_MAX"
+.LASF1065:
+	.string	"POSIX_FADV_SEQUENTIAL 2"
+.LASF1189:
+	.string	"PROT_EXEC 0x4"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1396:
+	.string	"_POSIX_SPORADIC_SERVER -1"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1385:
+	.string	"_POSIX_SPAWN 200809L"
+.LASF1009:
+	.string	"F_SETOWN_EX __F_SETOWN_EX"
+.LASF1761:
+	.string	"short unsigned int"
+.LASF1281:
+	.string	"_LINUX_STDDEF_H "
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF939:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1232:
+	.string	"POSIX_MADV_WILLNEED 3"
+.LASF1039:
+	.string	"DN_CREATE 0x00000004"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1624:
+	.string	"_SC_2_PBS_CHECKPOINT _SC_2_PBS_CHECKPOINT"
+.LASF1293:
+	.string	"__aligned_s64 __s64 __attribute__((aligned(8)))"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1799:
+	.string	"__pad0"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF393:
+	.string	"SITL 1"
+.LASF1538:
+	.string	"_SC_XOPEN_VERSION _SC_XOPEN_VERSION"
+.LASF983:
+	.string	"F_OFD_SETLKW 38"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1785:
+	.string	"uint16_t"
+.LASF1356:
+	.string	"_XOPEN_SHM 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF985:
+	.string	"O_DIRECTORY __O_DIRECTORY"
+.LASF1797:
+	.string	"st_uid"
+.LASF1696:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LIBS _CS_XBS5_LPBIG_OFFBIG_LIBS"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF1506:
+	.string	"_SC_POLL _SC_POLL"
+.LASF1922:
+	.string	"length"
+.LASF1607:
+	.string	"_SC_SIGNALS _SC_SIGNALS"
+.LASF1888:
+	.string	"multiWriteNextBlock"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF1430:
+	.string	"_PC_PATH_MAX _PC_PATH_MAX"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1157:
+	.string	"S_IXGRP (S_IXUSR >> 3)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1073:
+	.string	"SPLICE_F_MOVE 1"
+.LASF1728:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LIBS _CS_POSIX_V7_LPBIG_OFFBIG_LIBS"
+.LASF1801:
+	.string	"st_size"
+.LASF1720:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LIBS _CS_POSIX_V7_ILP32_OFFBIG_LIBS"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1204:
+	.string	"MS_SYNC 4"
+.LASF1167:
+	.string	"SEEK_SET 0"
+.LASF1757:
+	.string	"BLOCK_DEVICE_MMAP_PAGE_SIZE 256"
+.LASF989:
+	.string	"O_NOATIME __O_NOATIME"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1433:
+	.string	"_PC_NO_TRUNC _PC_NO_TRUNC"
+.LASF1487:
+	.string	"_SC_BC_STRING_MAX _SC_BC_STRING_MAX"
+.LASF1394:
+	.string	"_POSIX_RAW_SOCKETS 200809L"
+.LASF1384:
+	.string	"_POSIX_SPIN_LOCKS 200809L"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1251:
+	.string	"__nlink_t_defined "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1382:
+	.string	"_POSIX_SHELL 1"
+.LASF1352:
+	.string	"_POSIX_VDISABLE '\\0'"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1135:
+	.string	"__S_IREAD 0400"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1363:
+	.string	"_POSIX_THREAD_PRIO_INHERIT 200809L"
+.LASF1559:
+	.string	"_SC_SSIZE_MAX _SC_SSIZE_MAX"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1404:
+	.string	"_POSIX_V6_LPBIG_OFFBIG -1"
+.LASF1746:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1373:
+	.string	"_LFS64_ASYNCHRONOUS_IO 1"
+.LASF1597:
+	.string	"_SC_FILE_SYSTEM _SC_FILE_SYSTEM"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF961:
+	.string	"O_EXCL 0200"
+.LASF1726:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS"
+.LASF1223:
+	.string	"MADV_COLD 20"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1668:
+	.string	"_CS_GNU_LIBC_VERSION _CS_GNU_LIBC_VERSION"
+.LASF1067:
+	.string	"POSIX_FADV_DONTNEED __POSIX_FADV_DONTNEED"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1323:
+	.string	"__statx_defined 1"
+.LASF1066:
+	.string	"POSIX_FADV_WILLNEED 3"
+.LASF1575:
+	.string	"_SC_XBS5_ILP32_OFFBIG _SC_XBS5_ILP32_OFFBIG"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1600:
+	.string	"_SC_SINGLE_PROCESS _SC_SINGLE_PROCESS"
+.LASF1698:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_CFLAGS _CS_POSIX_V6_ILP32_OFF32_CFLAGS"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF986:
+	.string	"O_NOFOLLOW __O_NOFOLLOW"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1738:
+	.string	"sq(x) ((x)*(x))"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1064:
+	.string	"POSIX_FADV_RANDOM 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1269:
+	.string	"ACCESSPERMS (S_IRWXU|S_IRWXG|S_IRWXO)"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1049:
+	.string	"RWH_WRITE_LIFE_NOT_SET 0"
+.LASF1932:
+	.string	"flashWaitForReady"
+.LASF1802:
+	.string	"st_blksize"
+.LASF1865:
+	.string	"blockDeviceMmapFlashVTable"
+.LASF1895:
+	.string	"fstat"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1185:
+	.string	"MAP_SYNC 0x80000"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1004:
+	.string	"__F_GETSIG 11"
+.LASF998:
+	.string	"F_SETFL 4"
+.LASF1398:
+	.string	"_POSIX_TRACE -1"
+.LASF1783:
+	.string	"int32_t"
+.LASF982:
+	.string	"F_OFD_SETLK 37"
+.LASF1848:
+	.string	"blockDeviceTiming_s"
+.LASF1856:
+	.string	"blockDeviceTiming_t"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1459:
+	.string	"_SC_ASYNCHRONOUS_IO _SC_ASYNCHRONOUS_IO"
+.LASF1741:
+	.string	"FAST_MATH "
+.LASF1297:
+	.string	"STATX_MODE 0x00000002U"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF997:
+	.string	"F_GETFL 3"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1423:
+	.string	"L_SET SEEK_SET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1219:
+	.string	"MADV_DONTDUMP 16"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1113:
+	.string	"_BITS_STAT_H 1"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF996:
+	.string	"F_SETFD 2"
+.LASF1429:
+	.string	"_PC_NAME_MAX _PC_NAME_MAX"
+.LASF1325:
+	.string	"_POSIX_VERSION 200809L"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1192:
+	.string	"PROT_GROWSUP 0x02000000"
+.LASF1161:
+	.string	"S_IXOTH (S_IXGRP >> 3)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1798:
+	.string	"st_gid"
+.LASF546:
+	.string	"__always_inline"
+.LASF1202:
+	.string	"MAP_HUGE_MASK 0x3f"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1159:
+	.string	"S_IROTH (S_IRGRP >> 3)"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1362:
+	.string	"_POSIX_THREAD_ATTR_STACKADDR 200809L"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF898:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1813:
+	.string	"pagesPerSector"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1034:
+	.string	"LOCK_READ 64"
+.LASF1344:
+	.string	"_POSIX_PRIORITY_SCHEDULING 200809L"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1909:
+	.string	"mapping"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1374:
+	.string	"_LFS_LARGEFILE 1"
+.LASF1162:
+	.string	"S_IRWXO (S_IRWXG >> 3)"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1781:
+	.string	"__syscall_slong_t"
+.LASF1516:
+	.string	"_SC_THREADS _SC_THREADS"
+.LASF1492:
+	.string	"_SC_RE_DUP_MAX _SC_RE_DUP_MAX"
+.LASF1735:
+	.string	"_LINUX_CLOSE_RANGE_H "
+.LASF1052:
+	.string	"RWH_WRITE_LIFE_SHORT 2"
+.LASF1569:
+	.string	"_SC_NL_LANGMAX _SC_NL_LANGMAX"
+.LASF1389:
+	.string	"_POSIX_THREAD_PROCESS_SHARED 200809L"
+.LASF1658:
+	.string	"_SC_TRACE_SYS_MAX _SC_TRACE_SYS_MAX"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1191:
+	.string	"PROT_GROWSDOWN 0x01000000"
+.LASF1003:
+	.string	"__F_SETSIG 10"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1795:
+	.string	"st_nlink"
+.LASF1521:
+	.string	"_SC_TTY_NAME_MAX _SC_TTY_NAME_MAX"
+.LASF1729:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1567:
+	.string	"_SC_USHRT_MAX _SC_USHRT_MAX"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1076:
+	.string	"SPLICE_F_GIFT 8"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF1654:
+	.string	"_SC_V7_LPBIG_OFFBIG _SC_V7_LPBIG_OFFBIG"
+.LASF1581:
+	.string	"_SC_ADVISORY_INFO _SC_ADVISORY_INFO"
+.LASF1075:
+	.string	"SPLICE_F_MORE 4"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF968:
+	.string	"O_FSYNC O_SYNC"
+.LASF1806:
+	.string	"st_ctim"
+.LASF1634:
+	.string	"_SC_LEVEL1_ICACHE_SIZE _SC_LEVEL1_ICACHE_SIZE"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1520:
+	.string	"_SC_LOGIN_NAME_MAX _SC_LOGIN_NAME_MAX"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1425:
+	.string	"L_XTND SEEK_END"
+.LASF1201:
+	.string	"MAP_HUGE_SHIFT 26"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF972:
+	.string	"__O_CLOEXEC 02000000"
+.LASF1085:
+	.string	"MAX_HANDLE_SZ 128"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1038:
+	.string	"DN_MODIFY 0x00000002"
+.LASF402:
+	.string	"false 0"
+.LASF1638:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC _SC_LEVEL1_DCACHE_ASSOC"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1186:
+	.string	"MAP_FIXED_NOREPLACE 0x100000"
+.LASF1177:
+	.string	"MAP_DENYWRITE 0x00800"
+.LASF1477:
+	.string	"_SC_PAGESIZE _SC_PAGESIZE"
+.LASF1029:
+	.string	"LOCK_SH 1"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1666:
+	.string	"_CS_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF1619:
+	.string	"_SC_2_PBS_LOCATE _SC_2_PBS_LOCATE"
+.LASF1117:
+	.string	"st_ctime st_ctim.tv_sec"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF942:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1072:
+	.string	"SYNC_FILE_RANGE_WRITE_AND_WAIT (SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WAIT_AFTER)"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1675:
+	.string	"_CS_LFS_LDFLAGS _CS_LFS_LDFLAGS"
+.LASF1206:
+	.string	"MADV_NORMAL 0"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1635:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC _SC_LEVEL1_ICACHE_ASSOC"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1252:
+	.string	"__uid_t_defined "
+.LASF1031:
+	.string	"LOCK_NB 4"
+.LASF1307:
+	.string	"STATX_BASIC_STATS 0x000007ffU"
+.LASF1898:
+	.string	"memcpy"
+.LASF1910:
+	.string	"fileStat"
+.LASF1840:
+	.string	"sdcardOperationStatus_e"
+.LASF1405:
+	.string	"_XBS5_LPBIG_OFFBIG -1"
+.LASF1876:
+	.string	"programFailed"
+.LASF1345:
+	.string	"_POSIX_SYNCHRONIZED_IO 200809L"
+.LASF1140:
+	.string	"S_IFMT __S_IFMT"
+.LASF1497:
+	.string	"_SC_2_FORT_DEV _SC_2_FORT_DEV"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1229:
+	.string	"POSIX_MADV_NORMAL 0"
+.LASF1908:
+	.string	"flashSectorSize"
+.LASF979:
+	.string	"F_SETLK F_SETLK64"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1614:
+	.string	"_SC_TYPED_MEMORY_OBJECTS _SC_TYPED_MEMORY_OBJECTS"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1243:
+	.string	"MLOCK_ONFAULT 1U"
+.LASF977:
+	.string	"__O_TMPFILE (020000000 | __O_DIRECTORY)"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1146:
+	.string	"S_IFLNK __S_IFLNK"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1804:
+	.string	"st_atim"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1703:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1239:
+	.string	"MREMAP_DONTUNMAP 4"
+.LASF881:
+	.string	"ACC "
+.LASF1327:
+	.string	"_POSIX2_VERSION __POSIX2_THIS_VERSION"
+.LASF1050:
+	.string	"RWF_WRITE_LIFE_NOT_SET RWH_WRITE_LIFE_NOT_SET"
+.LASF1834:
+	.string	"SDCARD_BLOCK_OPERATION_ERASE"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF803:
+	.string	"USE_PWM "
+.LASF1250:
+	.string	"__ino_t_defined "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1885:
+	.string	"busyAfterUs"
+.LASF1630:
+	.string	"_SC_TRACE _SC_TRACE"
+.LASF1081:
+	.string	"FALLOC_FL_COLLAPSE_RANGE 0x08"
+.LASF1014:
+	.string	"F_SETPIPE_SZ 1031"
+.LASF1386:
+	.string	"_POSIX_TIMERS 200809L"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1502:
+	.string	"_SC_PII_XTI _SC_PII_XTI"
+.LASF1130:
+	.string	"__S_TYPEISSEM(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF1213:
+	.string	"MADV_DONTFORK 10"
+.LASF1175:
+	.string	"MAP_32BIT 0x40"
+.LASF1623:
+	.string	"_SC_STREAMS _SC_STREAMS"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1170:
+	.string	"F_ULOCK 0"
+.LASF1284:
+	.string	"__DECLARE_FLEX_ARRAY(TYPE,NAME) struct { struct { } __empty_ ## NAME; TYPE NAME[]; }"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF951:
+	.string	"__O_LARGEFILE 0"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1870:
+	.string	"geometry"
+.LASF1114:
+	.string	"_BITS_STRUCT_STAT_H 1"
+.LASF1673:
+	.string	"_CS_POSIX_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1255:
+	.string	"__S_ISTYPE(mode,mask) (((mode) & __S_IFMT) == (mask))"
+.LASF1434:
+	.string	"_PC_VDISABLE _PC_VDISABLE"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1772:
+	.string	"__uid_t"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1706:
+	.string	"_CS_POSIX_V6_LP64_OFF64_CFLAGS _CS_POSIX_V6_LP64_OFF64_CFLAGS"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF980:
+	.string	"F_SETLKW F_SETLKW64"
+.LASF1767:
+	.string	"__uint16_t"
+.LASF1092:
+	.string	"AT_STATX_SYNC_TYPE 0x6000"
+.LASF1534:
+	.string	"_SC_PHYS_PAGES _SC_PHYS_PAGES"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1395:
+	.string	"_POSIX2_CHAR_TERM 200809L"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1530:
+	.string	"_SC_THREAD_PRIO_PROTECT _SC_THREAD_PRIO_PROTECT"
+.LASF1190:
+	.string	"PROT_NONE 0x0"
+.LASF938:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1324:
+	.string	"_UNISTD_H 1"
+.LASF1711:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS"
+.LASF1750:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF1337:
+	.string	"_XOPEN_XPG4 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1249:
+	.string	"__gid_t_defined "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1692:
+	.string	"_CS_XBS5_LP64_OFF64_LIBS _CS_XBS5_LP64_OFF64_LIBS"
+.LASF975:
+	.string	"__O_PATH 010000000"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF991:
+	.string	"O_TMPFILE __O_TMPFILE"
+.LASF990:
+	.string	"O_PATH __O_PATH"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1439:
+	.string	"_PC_FILESIZEBITS _PC_FILESIZEBITS"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1603:
+	.string	"_SC_SPIN_LOCKS _SC_SPIN_LOCKS"
+.LASF1220:
+	.string	"MADV_DODUMP 17"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF955:
+	.string	"__iovec_defined 1"
+.LASF1237:
+	.string	"MREMAP_MAYMOVE 1"
+.LASF1086:
+	.string	"AT_FDCWD -100"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1173:
+	.string	"F_TEST 3"
+.LASF1712:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LIBS _CS_POSIX_V6_LPBIG_OFFBIG_LIBS"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1704:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LIBS _CS_POSIX_V6_ILP32_OFFBIG_LIBS"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1235:
+	.string	"MCL_FUTURE 2"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1023:
+	.string	"FD_CLOEXEC 1"
+.LASF1099:
+	.string	"__mode_t_defined "
+.LASF959:
+	.string	"O_RDWR 02"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1563:
+	.string	"_SC_SHRT_MIN _SC_SHRT_MIN"
+.LASF1845:
+	.string	"beginWriteBlocks"
+.LASF1548:
+	.string	"_SC_XOPEN_XPG3 _SC_XOPEN_XPG3"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1525:
+	.string	"_SC_THREAD_THREADS_MAX _SC_THREAD_THREADS_MAX"
+.LASF1541:
+	.string	"_SC_XOPEN_CRYPT _SC_XOPEN_CRYPT"
+.LASF1571:
+	.string	"_SC_NL_NMAX _SC_NL_NMAX"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1148:
+	.string	"S_ISUID __S_ISUID"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1648:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE _SC_LEVEL4_CACHE_LINESIZE"
+.LASF1760:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1866:
+	.string	"blockDeviceMmapSdcardVTable"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1270:
+	.string	"ALLPERMS (S_ISUID|S_ISGID|S_ISVTX|S_IRWXU|S_IRWXG|S_IRWXO)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1241:
+	.string	"MFD_ALLOW_SEALING 2U"
+.LASF1756:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1475:
+	.string	"_SC_MQ_PRIO_MAX _SC_MQ_PRIO_MAX"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1780:
+	.string	"__blkcnt_t"
+.LASF1242:
+	.string	"MFD_HUGETLB 4U"
+.LASF1659:
+	.string	"_SC_TRACE_USER_EVENT_MAX _SC_TRACE_USER_EVENT_MAX"
+.LASF364:
+	.string	"__k8 1"
+.LASF1641:
+	.string	"_SC_LEVEL2_CACHE_ASSOC _SC_LEVEL2_CACHE_ASSOC"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1134:
+	.string	"__S_ISVTX 01000"
+.LASF1810:
+	.string	"float"
+.LASF962:
+	.string	"O_NOCTTY 0400"
+.LASF1120:
+	.string	"_STATBUF_ST_NSEC "
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1432:
+	.string	"_PC_CHOWN_RESTRICTED _PC_CHOWN_RESTRICTED"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1279:
+	.string	"__ASM_GENERIC_BITS_PER_LONG "
+.LASF1359:
+	.string	"_POSIX_THREAD_SAFE_FUNCTIONS 200809L"
+.LASF879:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1295:
+	.string	"__aligned_le64 __le64 __attribute__((aligned(8)))"
+.LASF1188:
+	.string	"PROT_WRITE 0x2"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1825:
+	.string	"pageProgramFinish"
+.LASF1928:
+	.string	"flashPageProgramContinue"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF1093:
+	.string	"AT_STATX_SYNC_AS_STAT 0x0000"
+.LASF1069:
+	.string	"SYNC_FILE_RANGE_WAIT_BEFORE 1"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1846:
+	.string	"writeBlock"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1560:
+	.string	"_SC_SCHAR_MAX _SC_SCHAR_MAX"
+.LASF1246:
+	.string	"MAP_FAILED ((void *) -1)"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1737:
+	.string	"CLOSE_RANGE_CLOEXEC (1U << 2)"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1045:
+	.string	"F_SEAL_SHRINK 0x0002"
+.LASF1022:
+	.string	"F_DUPFD_CLOEXEC 1030"
+.LASF1435:
+	.string	"_PC_SYNC_IO _PC_SYNC_IO"
+.LASF1788:
+	.string	"off_t"
+.LASF1341:
+	.string	"_BITS_POSIX_OPT_H 1"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1693:
+	.string	"_CS_XBS5_LP64_OFF64_LINTFLAGS _CS_XBS5_LP64_OFF64_LINTFLAGS"
+.LASF1683:
+	.string	"_CS_XBS5_ILP32_OFF32_LDFLAGS _CS_XBS5_ILP32_OFF32_LDFLAGS"
+.LASF1507:
+	.string	"_SC_SELECT _SC_SELECT"
+.LASF1753:
+	.string	"Q12 (1 << 12)"
+.LASF1833:
+	.string	"SDCARD_BLOCK_OPERATION_WRITE"
+.LASF813:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1078:
+	.string	"FALLOC_FL_KEEP_SIZE 0x01"
+.LASF1700:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LIBS _CS_POSIX_V6_ILP32_OFF32_LIBS"
+.LASF941:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1775:
+	.string	"__mode_t"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1379:
+	.string	"_POSIX_THREAD_CPUTIME 0"
+.LASF1523:
+	.string	"_SC_THREAD_KEYS_MAX _SC_THREAD_KEYS_MAX"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF967:
+	.string	"O_SYNC 04010000"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1611:
+	.string	"_SC_SYSTEM_DATABASE _SC_SYSTEM_DATABASE"
+.LASF1536:
+	.string	"_SC_ATEXIT_MAX _SC_ATEXIT_MAX"
+.LASF1407:
+	.string	"_POSIX_V6_LP64_OFF64 1"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1348:
+	.string	"_POSIX_MEMLOCK 200809L"
+.LASF1107:
+	.string	"__PDP_ENDIAN 3412"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1829:
+	.string	"getGeometry"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1328:
+	.string	"_POSIX2_C_VERSION __POSIX2_THIS_VERSION"
+.LASF1421:
+	.string	"SEEK_DATA 3"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1176:
+	.string	"MAP_GROWSDOWN 0x00100"
+.LASF1088:
+	.string	"AT_REMOVEDIR 0x200"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1831:
+	.string	"flashVTable_t"
+.LASF1317:
+	.string	"STATX_ATTR_ENCRYPTED 0x00000800"
+.LASF1695:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LDFLAGS _CS_XBS5_LPBIG_OFFBIG_LDFLAGS"
+.LASF1528:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING _SC_THREAD_PRIORITY_SCHEDULING"
+.LASF1274:
+	.string	"_LINUX_TYPES_H "
+.LASF1215:
+	.string	"MADV_MERGEABLE 12"
+.LASF1264:
+	.string	"S_TYPEISSEM(buf) __S_TYPEISSEM(buf)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1896:
+	.string	"open"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1183:
+	.string	"MAP_STACK 0x20000"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1504:
+	.string	"_SC_PII_INTERNET _SC_PII_INTERNET"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF1187:
+	.string	"PROT_READ 0x1"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1272:
+	.string	"S_BLKSIZE 512"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1197:
+	.string	"MAP_FIXED 0x10"
+.LASF1106:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1331:
+	.string	"_POSIX2_SW_DEV __POSIX2_THIS_VERSION"
+.LASF1557:
+	.string	"_SC_MB_LEN_MAX _SC_MB_LEN_MAX"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1318:
+	.string	"STATX_ATTR_AUTOMOUNT 0x00001000"
+.LASF1618:
+	.string	"_SC_2_PBS_ACCOUNTING _SC_2_PBS_ACCOUNTING"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1941:
+	.string	"blockDeviceMmapSetTiming"
+.LASF1854:
+	.string	"eraseUs"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1790:
+	.string	"tv_nsec"
+.LASF1437:
+	.string	"_PC_PRIO_IO _PC_PRIO_IO"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF945:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF1057:
+	.string	"FFSYNC O_FSYNC"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1934:
+	.string	"remainingUs"
+.LASF1315:
+	.string	"STATX_ATTR_APPEND 0x00000020"
+.LASF1907:
+	.string	"size"
+.LASF1056:
+	.string	"FAPPEND O_APPEND"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1383:
+	.string	"_POSIX_TIMEOUTS 200809L"
+.LASF1254:
+	.string	"__blksize_t_defined "
+.LASF1095:
+	.string	"AT_STATX_DONT_SYNC 0x4000"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1604:
+	.string	"_SC_REGEXP _SC_REGEXP"
+.LASF1890:
+	.string	"munmap"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1271:
+	.string	"DEFFILEMODE (S_IRUSR|S_IWUSR|S_IRGRP|S_IWGRP|S_IROTH|S_IWOTH)"
+.LASF1061:
+	.string	"__POSIX_FADV_DONTNEED 4"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1838:
+	.string	"SDCARD_OPERATION_SUCCESS"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1413:
+	.string	"__LP64_OFF64_CFLAGS \"-m64\""
+.LASF1415:
+	.string	"STDIN_FILENO 0"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1631:
+	.string	"_SC_TRACE_EVENT_FILTER _SC_TRACE_EVENT_FILTER"
+.LASF1573:
+	.string	"_SC_NL_TEXTMAX _SC_NL_TEXTMAX"
+.LASF1063:
+	.string	"POSIX_FADV_NORMAL 0"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF1021:
+	.string	"F_SET_FILE_RW_HINT 1038"
+.LASF1139:
+	.string	"UTIME_OMIT ((1l << 30) - 2l)"
+.LASF1308:
+	.string	"STATX_BTIME 0x00000800U"
+.LASF1905:
+	.string	"newTiming"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF1787:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1707:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LDFLAGS _CS_POSIX_V6_LP64_OFF64_LDFLAGS"
+.LASF969:
+	.string	"O_ASYNC 020000"
+.LASF1305:
+	.string	"STATX_SIZE 0x00000200U"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1784:
+	.string	"uint8_t"
+.LASF1125:
+	.string	"__S_IFREG 0100000"
+.LASF1446:
+	.string	"_PC_2_SYMLINKS _PC_2_SYMLINKS"
+.LASF1644:
+	.string	"_SC_LEVEL3_CACHE_ASSOC _SC_LEVEL3_CACHE_ASSOC"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1414:
+	.string	"__LP64_OFF64_LDFLAGS \"-m64\""
+.LASF1740:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF1486:
+	.string	"_SC_BC_SCALE_MAX _SC_BC_SCALE_MAX"
+.LASF1850:
+	.string	"transmitUs"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1852:
+	.string	"multiWriteUs"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1742:
+	.string	"VERY_FAST_MATH "
+.LASF1248:
+	.string	"__dev_t_defined "
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1084:
+	.string	"FALLOC_FL_UNSHARE_RANGE 0x40"
+.LASF1294:
+	.string	"__aligned_be64 __be64 __attribute__((aligned(8)))"
+.LASF883:
+	.string	"BARO "
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF1260:
+	.string	"S_ISFIFO(mode) __S_ISTYPE((mode), __S_IFIFO)"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1288:
+	.string	"__kernel_old_dev_t __kernel_old_dev_t"
+.LASF1513:
+	.string	"_SC_PII_OSI_CLTS _SC_PII_OSI_CLTS"
+.LASF1529:
+	.string	"_SC_THREAD_PRIO_INHERIT _SC_THREAD_PRIO_INHERIT"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF984:
+	.string	"O_LARGEFILE __O_LARGEFILE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1678:
+	.string	"_CS_LFS64_CFLAGS _CS_LFS64_CFLAGS"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1669:
+	.string	"_CS_GNU_LIBPTHREAD_VERSION _CS_GNU_LIBPTHREAD_VERSION"
+.LASF1714:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_CFLAGS _CS_POSIX_V7_ILP32_OFF32_CFLAGS"
+.LASF956:
+	.string	"O_ACCMODE 0003"
+.LASF1375:
+	.string	"_LFS64_LARGEFILE 1"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1226:
+	.string	"MADV_POPULATE_WRITE 23"
+.LASF1522:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS _SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF1617:
+	.string	"_SC_2_PBS _SC_2_PBS"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1758:
+	.string	"BLOCK_DEVICE_MMAP_BLOCK_SIZE 512"
+.LASF822:
+	.string	"CMS "
+.LASF1035:
+	.string	"LOCK_WRITE 128"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF1821:
+	.string	"eraseSector"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1071:
+	.string	"SYNC_FILE_RANGE_WAIT_AFTER 4"
+.LASF1514:
+	.string	"_SC_PII_OSI_M _SC_PII_OSI_M"
+.LASF1164:
+	.string	"W_OK 2"
+.LASF1482:
+	.string	"_SC_SIGQUEUE_MAX _SC_SIGQUEUE_MAX"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1667:
+	.string	"_CS_POSIX_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF1622:
+	.string	"_SC_SYMLOOP_MAX _SC_SYMLOOP_MAX"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1929:
+	.string	"flashPageProgramBegin"
+.LASF1853:
+	.string	"stopUs"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1697:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LINTFLAGS _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1138:
+	.string	"UTIME_NOW ((1l << 30) - 1l)"
+.LASF396:
+	.string	"__REVISION__ \"7b45b89\""
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1431:
+	.string	"_PC_PIPE_BUF _PC_PIPE_BUF"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1268:
+	.string	"S_IEXEC S_IXUSR"
+.LASF1296:
+	.string	"STATX_TYPE 0x00000001U"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1509:
+	.string	"_SC_IOV_MAX _SC_IOV_MAX"
+.LASF1033:
+	.string	"LOCK_MAND 32"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1776:
+	.string	"__nlink_t"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1796:
+	.string	"st_mode"
+.LASF1212:
+	.string	"MADV_REMOVE 9"
+.LASF994:
+	.string	"F_DUPFD 0"
+.LASF1319:
+	.string	"STATX_ATTR_MOUNT_ROOT 0x00002000"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1275:
+	.string	"_ASM_GENERIC_TYPES_H "
+.LASF1350:
+	.string	"_POSIX_MEMORY_PROTECTION 200809L"
+.LASF1200:
+	.string	"MAP_ANON MAP_ANONYMOUS"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1927:
+	.string	"flashPageProgramFinish"
+.LASF1576:
+	.string	"_SC_XBS5_LP64_OFF64 _SC_XBS5_LP64_OFF64"
+.LASF1629:
+	.string	"_SC_HOST_NAME_MAX _SC_HOST_NAME_MAX"
+.LASF1867:
+	.string	"image"
+.LASF1150:
+	.string	"S_ISVTX __S_ISVTX"
+.LASF1306:
+	.string	"STATX_BLOCKS 0x00000400U"
+.LASF1456:
+	.string	"_SC_REALTIME_SIGNALS _SC_REALTIME_SIGNALS"
+.LASF1682:
+	.string	"_CS_XBS5_ILP32_OFF32_CFLAGS _CS_XBS5_ILP32_OFF32_CFLAGS"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF1501:
+	.string	"_SC_PII _SC_PII"
+.LASF1826:
+	.string	"pageProgram"
+.LASF1470:
+	.string	"_SC_AIO_LISTIO_MAX _SC_AIO_LISTIO_MAX"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1283:
+	.string	"__struct_group(TAG,NAME,ATTRS,MEMBERS...) union { struct { MEMBERS } ATTRS; struct __struct_group_tag(TAG) { MEMBERS } ATTRS NAME; } ATTRS"
+.LASF1286:
+	.string	"_ASM_X86_POSIX_TYPES_64_H "
+.LASF1582:
+	.string	"_SC_BARRIERS _SC_BARRIERS"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1376:
+	.string	"_LFS64_STDIO 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1549:
+	.string	"_SC_XOPEN_XPG4 _SC_XOPEN_XPG4"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1024:
+	.string	"F_RDLCK 0"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1309:
+	.string	"STATX_MNT_ID 0x00001000U"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1671:
+	.string	"_CS_POSIX_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF1112:
+	.string	"__time_t_defined 1"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF1702:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_CFLAGS _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS"
+.LASF1472:
+	.string	"_SC_AIO_PRIO_DELTA_MAX _SC_AIO_PRIO_DELTA_MAX"
+.LASF1043:
+	.string	"DN_MULTISHOT 0x80000000"
+.LASF964:
+	.string	"O_APPEND 02000"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF1920:
+	.string	"flashReadBytes"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1902:
+	.string	"blockDeviceMmapClose"
+.LASF1912:
+	.string	"sdcardBeginWriteBlocks"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1209:
+	.string	"MADV_WILLNEED 3"
+.LASF1913:
+	.string	"blockCount"
+.LASF1672:
+	.string	"_CS_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF1894:
+	.string	"ftruncate"
+.LASF1665:
+	.string	"_CS_PATH _CS_PATH"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1874:
+	.string	"busyUntilUs"
+.LASF1503:
+	.string	"_SC_PII_SOCKET _SC_PII_SOCKET"
+.LASF1921:
+	.string	"address"
+.LASF1754:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1511:
+	.string	"_SC_PII_INTERNET_DGRAM _SC_PII_INTERNET_DGRAM"
+.LASF1847:
+	.string	"sdcardVTable_t"
+.LASF1147:
+	.string	"S_IFSOCK __S_IFSOCK"
+.LASF1143:
+	.string	"S_IFBLK __S_IFBLK"
+.LASF1292:
+	.string	"__aligned_u64 __u64 __attribute__((aligned(8)))"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1855:
+	.string	"failEvery"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1904:
+	.string	"blockDeviceMmapOpen"
+.LASF1875:
+	.string	"programAddress"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1633:
+	.string	"_SC_TRACE_LOG _SC_TRACE_LOG"
+.LASF1051:
+	.string	"RWH_WRITE_LIFE_NONE 1"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1166:
+	.string	"F_OK 0"
+.LASF785:
+	.string	"NULL"
+.LASF1333:
+	.string	"_XOPEN_VERSION 700"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1438:
+	.string	"_PC_SOCK_MAXBUF _PC_SOCK_MAXBUF"
+.LASF1751:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF1543:
+	.string	"_SC_XOPEN_SHM _SC_XOPEN_SHM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1048:
+	.string	"F_SEAL_FUTURE_WRITE 0x0010"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1367:
+	.string	"_POSIX_SEMAPHORES 200809L"
+.LASF499:
+	.string	"__PMT"
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1791:
+	.string	"timespec"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1917:
+	.string	"durationUs"
+.LASF1316:
+	.string	"STATX_ATTR_NODUMP 0x00000040"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1287:
+	.string	"__kernel_old_uid_t __kernel_old_uid_t"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1515:
+	.string	"_SC_T_IOV_MAX _SC_T_IOV_MAX"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1574:
+	.string	"_SC_XBS5_ILP32_OFF32 _SC_XBS5_ILP32_OFF32"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1583:
+	.string	"_SC_BASE _SC_BASE"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1198:
+	.string	"MAP_FILE 0"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1727:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS"
+.LASF1725:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LINTFLAGS _CS_POSIX_V7_LP64_OFF64_LINTFLAGS"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1124:
+	.string	"__S_IFBLK 0060000"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1553:
+	.string	"_SC_INT_MAX _SC_INT_MAX"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1025:
+	.string	"F_WRLCK 1"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF1709:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LINTFLAGS _CS_POSIX_V6_LP64_OFF64_LINTFLAGS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1739:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF936:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1445:
+	.string	"_PC_SYMLINK_MAX _PC_SYMLINK_MAX"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF1369:
+	.string	"_POSIX_ASYNCHRONOUS_IO 200809L"
+.LASF1441:
+	.string	"_PC_REC_MAX_XFER_SIZE _PC_REC_MAX_XFER_SIZE"
+.LASF1777:
+	.string	"__off_t"
+.LASF1651:
+	.string	"_SC_V7_ILP32_OFF32 _SC_V7_ILP32_OFF32"
+.LASF1256:
+	.string	"S_ISDIR(mode) __S_ISTYPE((mode), __S_IFDIR)"
+.LASF940:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1939:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1169:
+	.string	"SEEK_END 2"
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF1207:
+	.string	"MADV_RANDOM 1"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF1824:
+	.string	"pageProgramContinue"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1419:
+	.string	"__useconds_t_defined "
+.LASF1897:
+	.string	"memset"
+.LASF1730:
+	.string	"_CS_V6_ENV _CS_V6_ENV"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1724:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LIBS _CS_POSIX_V7_LP64_OFF64_LIBS"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1314:
+	.string	"STATX_ATTR_IMMUTABLE 0x00000010"
+.LASF1230:
+	.string	"POSIX_MADV_RANDOM 1"
+.LASF1485:
+	.string	"_SC_BC_DIM_MAX _SC_BC_DIM_MAX"
+.LASF1427:
+	.string	"_PC_MAX_CANON _PC_MAX_CANON"
+.LASF1217:
+	.string	"MADV_HUGEPAGE 14"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1258:
+	.string	"S_ISBLK(mode) __S_ISTYPE((mode), __S_IFBLK)"
+.LASF952:
+	.string	"F_GETLK64 5"
+.LASF1322:
+	.string	"__statx_timestamp_defined 1"
+.LASF1545:
+	.string	"_SC_2_C_VERSION _SC_2_C_VERSION"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF1285:
+	.string	"__FD_SETSIZE"
+.LASF1068:
+	.string	"POSIX_FADV_NOREUSE __POSIX_FADV_NOREUSE"
+.LASF1605:
+	.string	"_SC_REGEX_VERSION _SC_REGEX_VERSION"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1609:
+	.string	"_SC_SPORADIC_SERVER _SC_SPORADIC_SERVER"
+.LASF1935:
+	.string	"flashIsReady"
+.LASF1302:
+	.string	"STATX_MTIME 0x00000040U"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF1108:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1454:
+	.string	"_SC_JOB_CONTROL _SC_JOB_CONTROL"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1227:
+	.string	"MADV_DONTNEED_LOCKED 24"
+.LASF1392:
+	.string	"_POSIX_ADVISORY_INFO 200809L"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1267:
+	.string	"S_IWRITE S_IWUSR"
+.LASF1778:
+	.string	"__time_t"
+.LASF802:
+	.string	"USE_PPM "
+.LASF1343:
+	.string	"_POSIX_SAVED_IDS 1"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1180:
+	.string	"MAP_NORESERVE 0x04000"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1406:
+	.string	"_POSIX_V7_LP64_OFF64 1"
+.LASF1473:
+	.string	"_SC_DELAYTIMER_MAX _SC_DELAYTIMER_MAX"
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF935:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1488:
+	.string	"_SC_COLL_WEIGHTS_MAX _SC_COLL_WEIGHTS_MAX"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1532:
+	.string	"_SC_NPROCESSORS_CONF _SC_NPROCESSORS_CONF"
+.LASF992:
+	.string	"O_DSYNC __O_DSYNC"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF1809:
+	.string	"long long unsigned int"
+.LASF1749:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1661:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT _SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF1647:
+	.string	"_SC_LEVEL4_CACHE_ASSOC _SC_LEVEL4_CACHE_ASSOC"
+.LASF1734:
+	.string	"TEMP_FAILURE_RETRY(expression) (__extension__ ({ long int __result; do __result = (long int) (expression); while (__result == -1L && errno == EINTR); __result; }))"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1733:
+	.string	"_GETOPT_CORE_H 1"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1550:
+	.string	"_SC_CHAR_BIT _SC_CHAR_BIT"
+.LASF1371:
+	.string	"_LFS_ASYNCHRONOUS_IO 1"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1649:
+	.string	"_SC_IPV6 _SC_IPV6"
+.LASF1862:
+	.string	"failures"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1764:
+	.string	"signed char"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1589:
+	.string	"_SC_DEVICE_IO _SC_DEVICE_IO"
+.LASF1547:
+	.string	"_SC_XOPEN_XPG2 _SC_XOPEN_XPG2"
+.LASF1118:
+	.string	"_STATBUF_ST_BLKSIZE "
+.LASF1779:
+	.string	"__blksize_t"
+.LASF766:
+	.string	"__size_t__ "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1480:
+	.string	"_SC_SEM_NSEMS_MAX _SC_SEM_NSEMS_MAX"
+.LASF1639:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE _SC_LEVEL1_DCACHE_LINESIZE"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1637:
+	.string	"_SC_LEVEL1_DCACHE_SIZE _SC_LEVEL1_DCACHE_SIZE"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1816:
+	.string	"totalSize"
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF1059:
+	.string	"FNONBLOCK O_NONBLOCK"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1008:
+	.string	"F_GETSIG __F_GETSIG"
+.LASF1280:
+	.string	"_LINUX_POSIX_TYPES_H "
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1906:
+	.string	"filename"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1276:
+	.string	"_ASM_GENERIC_INT_LL64_H "
+.LASF1839:
+	.string	"SDCARD_OPERATION_FAILURE"
+.LASF1496:
+	.string	"_SC_2_C_DEV _SC_2_C_DEV"
+.LASF1585:
+	.string	"_SC_C_LANG_SUPPORT_R _SC_C_LANG_SUPPORT_R"
+.LASF1411:
+	.string	"__ILP32_OFFBIG_CFLAGS \"-m32 -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64\""
+.LASF1457:
+	.string	"_SC_PRIORITY_SCHEDULING _SC_PRIORITY_SCHEDULING"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1903:
+	.string	"delayMicroseconds"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF1401:
+	.string	"_POSIX_TRACE_LOG -1"
+.LASF1236:
+	.string	"MCL_ONFAULT 4"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1012:
+	.string	"F_GETLEASE 1025"
+.LASF1918:
+	.string	"sdcardIsReady"
+.LASF1443:
+	.string	"_PC_REC_XFER_ALIGN _PC_REC_XFER_ALIGN"
+.LASF1240:
+	.string	"MFD_CLOEXEC 1U"
+.LASF1499:
+	.string	"_SC_2_SW_DEV _SC_2_SW_DEV"
+.LASF1342:
+	.string	"_POSIX_JOB_CONTROL 1"
+.LASF1715:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LDFLAGS _CS_POSIX_V7_ILP32_OFF32_LDFLAGS"
+.LASF1089:
+	.string	"AT_SYMLINK_FOLLOW 0x400"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1131:
+	.string	"__S_TYPEISSHM(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF1017:
+	.string	"F_GET_SEALS 1034"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1142:
+	.string	"S_IFCHR __S_IFCHR"
+.LASF1517:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS _SC_THREAD_SAFE_FUNCTIONS"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1889:
+	.string	"multiWriteBlocksRemain"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1291:
+	.string	"__bitwise__ __bitwise"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1153:
+	.string	"S_IXUSR __S_IEXEC"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF1588:
+	.string	"_SC_THREAD_CPUTIME _SC_THREAD_CPUTIME"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF993:
+	.string	"O_RSYNC O_SYNC"
+.LASF1819:
+	.string	"isReady"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1171:
+	.string	"F_LOCK 1"
+.LASF1872:
+	.string	"stats"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF1705:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1911:
+	.string	"sdcardWriteBlock"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1868:
+	.string	"imageSize"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1119:
+	.string	"_STATBUF_ST_RDEV "
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1001:
+	.string	"F_SETOWN __F_SETOWN"
+.LASF1882:
+	.string	"callback"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1926:
+	.string	"sdcardEndMultiWrite"
+.LASF1815:
+	.string	"sectorSize"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1851:
+	.string	"writeUs"
+.LASF1151:
+	.string	"S_IRUSR __S_IREAD"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF957:
+	.string	"O_RDONLY 00"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1339:
+	.string	"_XOPEN_ENH_I18N 1"
+.LASF1097:
+	.string	"AT_EACCESS 0x200"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1564:
+	.string	"_SC_UCHAR_MAX _SC_UCHAR_MAX"
+.LASF1599:
+	.string	"_SC_MULTI_PROCESS _SC_MULTI_PROCESS"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1914:
+	.string	"sdcardReadBlock"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF965:
+	.string	"O_NONBLOCK 04000"
+.LASF1899:
+	.string	"blockDeviceMmapGetStats"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF1879:
+	.string	"operation"
+.LASF1224:
+	.string	"MADV_PAGEOUT 21"
+.LASF1505:
+	.string	"_SC_PII_OSI _SC_PII_OSI"
+.LASF1842:
+	.string	"sdcardVTable_s"
+.LASF1168:
+	.string	"SEEK_CUR 1"
+.LASF1096:
+	.string	"AT_RECURSIVE 0x8000"
+.LASF1837:
+	.string	"SDCARD_OPERATION_BUSY"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1273:
+	.string	"_LINUX_STAT_H "
+.LASF1126:
+	.string	"__S_IFIFO 0010000"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1857:
+	.string	"blockDeviceStats_s"
+.LASF1864:
+	.string	"blockDeviceStats_t"
+.LASF929:
+	.string	"USE_PROFILE "
+.LASF1181:
+	.string	"MAP_POPULATE 0x08000"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1670:
+	.string	"_CS_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF1893:
+	.string	"close"
+.LASF821:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1330:
+	.string	"_POSIX2_C_DEV __POSIX2_THIS_VERSION"
+.LASF974:
+	.string	"__O_NOATIME 01000000"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1195:
+	.string	"MAP_SHARED_VALIDATE 0x03"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1883:
+	.string	"callbackData"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1770:
+	.string	"long int"
+.LASF1463:
+	.string	"_SC_MAPPED_FILES _SC_MAPPED_FILES"
+.LASF1451:
+	.string	"_SC_OPEN_MAX _SC_OPEN_MAX"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1688:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LIBS _CS_XBS5_ILP32_OFFBIG_LIBS"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1156:
+	.string	"S_IWGRP (S_IWUSR >> 3)"
+.LASF1540:
+	.string	"_SC_XOPEN_UNIX _SC_XOPEN_UNIX"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1595:
+	.string	"_SC_FILE_ATTRIBUTES _SC_FILE_ATTRIBUTES"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1211:
+	.string	"MADV_FREE 8"
+.LASF1178:
+	.string	"MAP_EXECUTABLE 0x01000"
+.LASF1490:
+	.string	"_SC_EXPR_NEST_MAX _SC_EXPR_NEST_MAX"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1290:
+	.string	"__bitwise "
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF1402:
+	.string	"_POSIX_TYPED_MEMORY_OBJECTS -1"
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF1901:
+	.string	"blockDeviceMmapResetStats"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1612:
+	.string	"_SC_SYSTEM_DATABASE_R _SC_SYSTEM_DATABASE_R"
+.LASF1060:
+	.string	"FNDELAY O_NDELAY"
+.LASF1526:
+	.string	"_SC_THREAD_ATTR_STACKADDR _SC_THREAD_ATTR_STACKADDR"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF1304:
+	.string	"STATX_INO 0x00000100U"
+.LASF1103:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1884:
+	.string	"completeAtUs"
+.LASF1590:
+	.string	"_SC_DEVICE_SPECIFIC _SC_DEVICE_SPECIFIC"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1313:
+	.string	"STATX_ATTR_COMPRESSED 0x00000004"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1387:
+	.string	"_POSIX_BARRIERS 200809L"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1265:
+	.string	"S_TYPEISSHM(buf) __S_TYPEISSHM(buf)"
+.LASF1338:
+	.string	"_XOPEN_UNIX 1"
+.LASF1399:
+	.string	"_POSIX_TRACE_EVENT_FILTER -1"
+.LASF1621:
+	.string	"_SC_2_PBS_TRACK _SC_2_PBS_TRACK"
+.LASF1793:
+	.string	"st_dev"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1620:
+	.string	"_SC_2_PBS_MESSAGE _SC_2_PBS_MESSAGE"
+.LASF1238:
+	.string	"MREMAP_FIXED 2"
+.LASF995:
+	.string	"F_GETFD 1"
+.LASF999:
+	.string	"__F_SETOWN 8"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1127:
+	.string	"__S_IFLNK 0120000"
+.LASF1642:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE _SC_LEVEL2_CACHE_LINESIZE"
+.LASF1442:
+	.string	"_PC_REC_MIN_XFER_SIZE _PC_REC_MIN_XFER_SIZE"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1358:
+	.string	"_POSIX_REENTRANT_FUNCTIONS 1"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1533:
+	.string	"_SC_NPROCESSORS_ONLN _SC_NPROCESSORS_ONLN"
+.LASF1210:
+	.string	"MADV_DONTNEED 4"
+.LASF1747:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1400:
+	.string	"_POSIX_TRACE_INHERIT -1"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF522:
+	.string	"__flexarr []"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1172:
+	.string	"F_TLOCK 2"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1841:
+	.string	"sdcard_operationCompleteCallback_c"
+.LASF1149:
+	.string	"S_ISGID __S_ISGID"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1300:
+	.string	"STATX_GID 0x00000010U"
+.LASF1054:
+	.string	"RWH_WRITE_LIFE_LONG 4"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1261:
+	.string	"S_ISLNK(mode) __S_ISTYPE((mode), __S_IFLNK)"
+.LASF1836:
+	.string	"SDCARD_OPERATION_IN_PROGRESS"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1257:
+	.string	"S_ISCHR(mode) __S_ISTYPE((mode), __S_IFCHR)"
+.LASF1814:
+	.string	"pageSize"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1556:
+	.string	"_SC_WORD_BIT _SC_WORD_BIT"
+.LASF1561:
+	.string	"_SC_SCHAR_MIN _SC_SCHAR_MIN"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1691:
+	.string	"_CS_XBS5_LP64_OFF64_LDFLAGS _CS_XBS5_LP64_OFF64_LDFLAGS"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1449:
+	.string	"_SC_CLK_TCK _SC_CLK_TCK"
+.LASF1484:
+	.string	"_SC_BC_BASE_MAX _SC_BC_BASE_MAX"
+.LASF1332:
+	.string	"_POSIX2_LOCALEDEF __POSIX2_THIS_VERSION"
+.LASF1037:
+	.string	"DN_ACCESS 0x00000001"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1368:
+	.string	"_POSIX_REALTIME_SIGNALS 200809L"
+.LASF1245:
+	.string	"PKEY_DISABLE_WRITE 0x2"
+.LASF1495:
+	.string	"_SC_2_C_BIND _SC_2_C_BIND"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1820:
+	.string	"waitForReady"
+.LASF1440:
+	.string	"_PC_REC_INCR_XFER_SIZE _PC_REC_INCR_XFER_SIZE"
+.LASF1481:
+	.string	"_SC_SEM_VALUE_MAX _SC_SEM_VALUE_MAX"
+.LASF1782:
+	.string	"char"
+.LASF1141:
+	.string	"S_IFDIR __S_IFDIR"
+.LASF1680:
+	.string	"_CS_LFS64_LIBS _CS_LFS64_LIBS"
+.LASF1018:
+	.string	"F_GET_RW_HINT 1035"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1500:
+	.string	"_SC_2_LOCALEDEF _SC_2_LOCALEDEF"
+.LASF1182:
+	.string	"MAP_NONBLOCK 0x10000"
+.LASF1828:
+	.string	"readBytes"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF987:
+	.string	"O_CLOEXEC __O_CLOEXEC"
+.LASF1551:
+	.string	"_SC_CHAR_MAX _SC_CHAR_MAX"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF1923:
+	.string	"sdcardStartOperation"
+.LASF1743:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1334:
+	.string	"_XOPEN_XCU_VERSION 4"
+.LASF1040:
+	.string	"DN_DELETE 0x00000008"
+.LASF1489:
+	.string	"_SC_EQUIV_CLASS_MAX _SC_EQUIV_CLASS_MAX"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1835:
+	.string	"sdcardBlockOperation_e"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF1771:
+	.string	"__dev_t"
+.LASF1871:
+	.string	"timing"
+.LASF401:
+	.string	"true 1"
+.LASF1572:
+	.string	"_SC_NL_SETMAX _SC_NL_SETMAX"
+.LASF1807:
+	.string	"__glibc_reserved"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1393:
+	.string	"_POSIX_IPV6 200809L"
+.LASF1594:
+	.string	"_SC_PIPE _SC_PIPE"
+.LASF1717:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LINTFLAGS _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS"
+.LASF1417:
+	.string	"STDERR_FILENO 2"
+.LASF1080:
+	.string	"FALLOC_FL_NO_HIDE_STALE 0x04"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1087:
+	.string	"AT_SYMLINK_NOFOLLOW 0x100"
+.LASF1155:
+	.string	"S_IRGRP (S_IRUSR >> 3)"
+.LASF1216:
+	.string	"MADV_UNMERGEABLE 13"
+.LASF1493:
+	.string	"_SC_CHARCLASS_NAME_MAX _SC_CHARCLASS_NAME_MAX"
+.LASF1228:
+	.string	"MADV_HWPOISON 100"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1552:
+	.string	"_SC_CHAR_MIN _SC_CHAR_MIN"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF954:
+	.string	"F_SETLKW64 7"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF1002:
+	.string	"F_GETOWN __F_GETOWN"
+.LASF1718:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_CFLAGS _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS"
+.LASF1422:
+	.string	"SEEK_HOLE 4"
+.LASF1233:
+	.string	"POSIX_MADV_DONTNEED 4"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1032:
+	.string	"LOCK_UN 8"
+.LASF949:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1154:
+	.string	"S_IRWXU (__S_IREAD|__S_IWRITE|__S_IEXEC)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1465:
+	.string	"_SC_MEMLOCK_RANGE _SC_MEMLOCK_RANGE"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1070:
+	.string	"SYNC_FILE_RANGE_WRITE 2"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1584:
+	.string	"_SC_C_LANG_SUPPORT _SC_C_LANG_SUPPORT"
+.LASF1881:
+	.string	"buffer"
+.LASF1690:
+	.string	"_CS_XBS5_LP64_OFF64_CFLAGS _CS_XBS5_LP64_OFF64_CFLAGS"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1598:
+	.string	"_SC_MONOTONIC_CLOCK _SC_MONOTONIC_CLOCK"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1555:
+	.string	"_SC_LONG_BIT _SC_LONG_BIT"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1936:
+	.string	"operationFails"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1436:
+	.string	"_PC_ASYNC_IO _PC_ASYNC_IO"
+.LASF1822:
+	.string	"eraseCompletely"
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1452:
+	.string	"_SC_STREAM_MAX _SC_STREAM_MAX"
+.LASF1007:
+	.string	"F_SETSIG __F_SETSIG"
+.LASF1298:
+	.string	"STATX_NLINK 0x00000004U"
+.LASF1388:
+	.string	"_POSIX_MESSAGE_PASSING 200809L"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1326:
+	.string	"__POSIX2_THIS_VERSION 200809L"
+.LASF1873:
+	.string	"operationCount"
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF966:
+	.string	"O_NDELAY O_NONBLOCK"
+.LASF1755:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1100:
+	.string	"__off_t_defined "
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1145:
+	.string	"S_IFIFO __S_IFIFO"
+.LASF1656:
+	.string	"_SC_TRACE_EVENT_NAME_MAX _SC_TRACE_EVENT_NAME_MAX"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF545:
+	.string	"__wur "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF1812:
+	.string	"sectors"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1593:
+	.string	"_SC_FIFO _SC_FIFO"
+.LASF1723:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LDFLAGS _CS_POSIX_V7_LP64_OFF64_LDFLAGS"
+.LASF1544:
+	.string	"_SC_2_CHAR_TERM _SC_2_CHAR_TERM"
+.LASF948:
+	.string	"__enable_irq() "
+.LASF1606:
+	.string	"_SC_SHELL _SC_SHELL"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1615:
+	.string	"_SC_USER_GROUPS _SC_USER_GROUPS"
+.LASF1301:
+	.string	"STATX_ATIME 0x00000020U"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1467:
+	.string	"_SC_MESSAGE_PASSING _SC_MESSAGE_PASSING"
+.LASF1811:
+	.string	"flashGeometry_s"
+.LASF1817:
+	.string	"flashGeometry_t"
+.LASF1354:
+	.string	"_XOPEN_REALTIME 1"
+.LASF1542:
+	.string	"_SC_XOPEN_ENH_I18N _SC_XOPEN_ENH_I18N"
+.LASF1450:
+	.string	"_SC_NGROUPS_MAX _SC_NGROUPS_MAX"
+.LASF1042:
+	.string	"DN_ATTRIB 0x00000020"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1616:
+	.string	"_SC_USER_GROUPS_R _SC_USER_GROUPS_R"
+.LASF1123:
+	.string	"__S_IFCHR 0020000"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1310:
+	.string	"STATX_DIOALIGN 0x00002000U"
+.LASF1109:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1566:
+	.string	"_SC_ULONG_MAX _SC_ULONG_MAX"
+.LASF1391:
+	.string	"_POSIX_CLOCK_SELECTION 200809L"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1218:
+	.string	"MADV_NOHUGEPAGE 15"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1390:
+	.string	"_POSIX_MONOTONIC_CLOCK 0"
+.LASF1657:
+	.string	"_SC_TRACE_NAME_MAX _SC_TRACE_NAME_MAX"
+.LASF1360:
+	.string	"_POSIX_THREAD_PRIORITY_SCHEDULING 200809L"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1303:
+	.string	"STATX_CTIME 0x00000080U"
+.LASF1115:
+	.string	"st_atime st_atim.tv_sec"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1919:
+	.string	"flashGetGeometry"
+.LASF953:
+	.string	"F_SETLK64 6"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1412:
+	.string	"__ILP32_OFFBIG_LDFLAGS \"-m32\""
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1858:
+	.string	"reads"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1011:
+	.string	"F_SETLEASE 1024"
+.LASF1880:
+	.string	"blockIndex"
+.LASF1469:
+	.string	"_SC_SHARED_MEMORY_OBJECTS _SC_SHARED_MEMORY_OBJECTS"
+.LASF1591:
+	.string	"_SC_DEVICE_SPECIFIC_R _SC_DEVICE_SPECIFIC_R"
+.LASF1524:
+	.string	"_SC_THREAD_STACK_MIN _SC_THREAD_STACK_MIN"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1221:
+	.string	"MADV_WIPEONFORK 18"
+.LASF1527:
+	.string	"_SC_THREAD_ATTR_STACKSIZE _SC_THREAD_ATTR_STACKSIZE"
+.LASF1579:
+	.string	"_SC_XOPEN_REALTIME _SC_XOPEN_REALTIME"
+.LASF930:
+	.string	"USE_BLOCK_DEVICE_MMAP "
+.LASF1424:
+	.string	"L_INCR SEEK_CUR"
+.LASF1938:
+	.string	"deviceIsIdle"
+.LASF1800:
+	.string	"st_rdev"
+.LASF1719:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF1349:
+	.string	"_POSIX_MEMLOCK_RANGE 200809L"
+.LASF1869:
+	.string	"imageFd"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1110:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1713:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1020:
+	.string	"F_GET_FILE_RW_HINT 1037"
+.LASF1062:
+	.string	"__POSIX_FADV_NOREUSE 5"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1686:
+	.string	"_CS_XBS5_ILP32_OFFBIG_CFLAGS _CS_XBS5_ILP32_OFFBIG_CFLAGS"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1351:
+	.string	"_POSIX_CHOWN_RESTRICTED 0"
+.LASF1016:
+	.string	"F_ADD_SEALS 1033"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1748:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1568:
+	.string	"_SC_NL_ARGMAX _SC_NL_ARGMAX"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF944:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1625:
+	.string	"_SC_V6_ILP32_OFF32 _SC_V6_ILP32_OFF32"
+.LASF1613:
+	.string	"_SC_TIMEOUTS _SC_TIMEOUTS"
+.LASF1768:
+	.string	"__int32_t"
+.LASF1129:
+	.string	"__S_TYPEISMQ(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF1930:
+	.string	"flashEraseCompletely"
+.LASF1365:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_INHERIT 200809L"
+.LASF1769:
+	.string	"__uint32_t"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF958:
+	.string	"O_WRONLY 01"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1925:
+	.string	"data"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1546:
+	.string	"_SC_2_UPE _SC_2_UPE"
+.LASF1158:
+	.string	"S_IRWXG (S_IRWXU >> 3)"
+.LASF1474:
+	.string	"_SC_MQ_OPEN_MAX _SC_MQ_OPEN_MAX"
+.LASF801:
+	.string	"USE_CLI "
+.LASF1849:
+	.string	"readUs"
+.LASF963:
+	.string	"O_TRUNC 01000"
+.LASF1650:
+	.string	"_SC_RAW_SOCKETS _SC_RAW_SOCKETS"
+.LASF1586:
+	.string	"_SC_CLOCK_SELECTION _SC_CLOCK_SELECTION"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF1044:
+	.string	"F_SEAL_SEAL 0x0001"
+.LASF1471:
+	.string	"_SC_AIO_MAX _SC_AIO_MAX"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1133:
+	.string	"__S_ISGID 02000"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF976:
+	.string	"__O_DSYNC 010000"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1055:
+	.string	"RWH_WRITE_LIFE_EXTREME 5"
+.LASF1132:
+	.string	"__S_ISUID 04000"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1253:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1466:
+	.string	"_SC_MEMORY_PROTECTION _SC_MEMORY_PROTECTION"
+.LASF1843:
+	.string	"poll"
+.LASF1203:
+	.string	"MS_ASYNC 1"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1263:
+	.string	"S_TYPEISMQ(buf) __S_TYPEISMQ(buf)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1194:
+	.string	"MAP_PRIVATE 0x02"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF1165:
+	.string	"X_OK 1"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1082:
+	.string	"FALLOC_FL_ZERO_RANGE 0x10"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1410:
+	.string	"__ILP32_OFF32_LDFLAGS \"-m32\""
+.LASF1646:
+	.string	"_SC_LEVEL4_CACHE_SIZE _SC_LEVEL4_CACHE_SIZE"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1005:
+	.string	"__F_SETOWN_EX 15"
+.LASF1101:
+	.string	"__off64_t_defined "
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1823:
+	.string	"pageProgramBegin"
+.LASF1537:
+	.string	"_SC_PASS_MAX _SC_PASS_MAX"
+.LASF1886:
+	.string	"cardOperation"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1320:
+	.string	"STATX_ATTR_VERITY 0x00100000"
+.LASF1458:
+	.string	"_SC_TIMERS _SC_TIMERS"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1773:
+	.string	"__gid_t"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1046:
+	.string	"F_SEAL_GROW 0x0004"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1510:
+	.string	"_SC_PII_INTERNET_STREAM _SC_PII_INTERNET_STREAM"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1716:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LIBS _CS_POSIX_V7_ILP32_OFF32_LIBS"
+.LASF1083:
+	.string	"FALLOC_FL_INSERT_RANGE 0x20"
+.LASF1937:
+	.string	"deviceBusyFor"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1732:
+	.string	"_GETOPT_POSIX_H 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1006:
+	.string	"__F_GETOWN_EX 16"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1931:
+	.string	"flashEraseSector"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1789:
+	.string	"tv_sec"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF382:
+	.string	"unix 1"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF1366:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_PROTECT -1"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1222:
+	.string	"MADV_KEEPONFORK 19"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1570:
+	.string	"_SC_NL_MSGMAX _SC_NL_MSGMAX"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF1077:
+	.string	"_FALLOC_H_ "
+.LASF1643:
+	.string	"_SC_LEVEL3_CACHE_SIZE _SC_LEVEL3_CACHE_SIZE"
+.LASF1340:
+	.string	"_XOPEN_LEGACY 1"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1832:
+	.string	"SDCARD_BLOCK_OPERATION_READ"
+.LASF1460:
+	.string	"_SC_PRIORITIZED_IO _SC_PRIORITIZED_IO"
+.LASF1448:
+	.string	"_SC_CHILD_MAX _SC_CHILD_MAX"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1645:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE _SC_LEVEL3_CACHE_LINESIZE"
+.LASF1370:
+	.string	"_POSIX_ASYNC_IO 1"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1453:
+	.string	"_SC_TZNAME_MAX _SC_TZNAME_MAX"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1677:
+	.string	"_CS_LFS_LINTFLAGS _CS_LFS_LINTFLAGS"
+.LASF1803:
+	.string	"st_blocks"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF885:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF1608:
+	.string	"_SC_SPAWN _SC_SPAWN"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1565:
+	.string	"_SC_UINT_MAX _SC_UINT_MAX"
+.LASF1722:
+	.string	"_CS_POSIX_V7_LP64_OFF64_CFLAGS _CS_POSIX_V7_LP64_OFF64_CFLAGS"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF973:
+	.string	"__O_DIRECT 040000"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF947:
+	.string	"__disable_irq() "
+.LASF1259:
+	.string	"S_ISREG(mode) __S_ISTYPE((mode), __S_IFREG)"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1353:
+	.string	"_POSIX_NO_TRUNC 1"
+.LASF1860:
+	.string	"multiWrites"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1924:
+	.string	"flashPageProgram"
+.LASF1426:
+	.string	"_PC_LINK_MAX _PC_LINK_MAX"
+.LASF1878:
+	.string	"failed"
+.LASF1508:
+	.string	"_SC_UIO_MAXIOV _SC_UIO_MAXIOV"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF937:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1731:
+	.string	"_CS_V7_ENV _CS_V7_ENV"
+.LASF1596:
+	.string	"_SC_FILE_LOCKING _SC_FILE_LOCKING"
+.LASF1208:
+	.string	"MADV_SEQUENTIAL 2"
+.LASF1494:
+	.string	"_SC_2_VERSION _SC_2_VERSION"
+.LASF1679:
+	.string	"_CS_LFS64_LDFLAGS _CS_LFS64_LDFLAGS"
+.LASF1476:
+	.string	"_SC_VERSION _SC_VERSION"
+.LASF1372:
+	.string	"_POSIX_PRIORITIZED_IO 200809L"
+.LASF931:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1900:
+	.string	"blockDeviceMmapGetImage"
+.LASF1244:
+	.string	"PKEY_DISABLE_ACCESS 0x1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1091:
+	.string	"AT_EMPTY_PATH 0x1000"
+.LASF1026:
+	.string	"F_UNLCK 2"
+.LASF946:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1444:
+	.string	"_PC_ALLOC_SIZE_MIN _PC_ALLOC_SIZE_MIN"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF960:
+	.string	"O_CREAT 0100"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1628:
+	.string	"_SC_V6_LPBIG_OFFBIG _SC_V6_LPBIG_OFFBIG"
+.LASF1416:
+	.string	"STDOUT_FILENO 1"
+.LASF1403:
+	.string	"_POSIX_V7_LPBIG_OFFBIG -1"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1205:
+	.string	"MS_INVALIDATE 2"
+.LASF1626:
+	.string	"_SC_V6_ILP32_OFFBIG _SC_V6_ILP32_OFFBIG"
+.LASF1887:
+	.string	"multiWrite"
+.LASF1455:
+	.string	"_SC_SAVED_IDS _SC_SAVED_IDS"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1347:
+	.string	"_POSIX_MAPPED_FILES 200809L"
+.LASF1640:
+	.string	"_SC_LEVEL2_CACHE_SIZE _SC_LEVEL2_CACHE_SIZE"
+.LASF1152:
+	.string	"S_IWUSR __S_IWRITE"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1468:
+	.string	"_SC_SEMAPHORES _SC_SEMAPHORES"
+.LASF932:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1377:
+	.string	"_POSIX_SHARED_MEMORY_OBJECTS 200809L"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1592:
+	.string	"_SC_FD_MGMT _SC_FD_MGMT"
+.LASF1136:
+	.string	"__S_IWRITE 0200"
+.LASF1160:
+	.string	"S_IWOTH (S_IWGRP >> 3)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1655:
+	.string	"_SC_SS_REPL_MAX _SC_SS_REPL_MAX"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1019:
+	.string	"F_SET_RW_HINT 1036"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF1000:
+	.string	"__F_GETOWN 9"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1364:
+	.string	"_POSIX_THREAD_PRIO_PROTECT 200809L"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1336:
+	.string	"_XOPEN_XPG3 1"
+.LASF1844:
+	.string	"readBlock"
+.LASF1193:
+	.string	"MAP_SHARED 0x01"
+.LASF1266:
+	.string	"S_IREAD S_IRUSR"
+.LASF1662:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT _SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1859:
+	.string	"writes"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1808:
+	.string	"long long int"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1627:
+	.string	"_SC_V6_LP64_OFF64 _SC_V6_LP64_OFF64"
+.LASF1674:
+	.string	"_CS_LFS_CFLAGS _CS_LFS_CFLAGS"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1736:
+	.string	"CLOSE_RANGE_UNSHARE (1U << 1)"
+.LASF1708:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LIBS _CS_POSIX_V6_LP64_OFF64_LIBS"
+.LASF1015:
+	.string	"F_GETPIPE_SZ 1032"
+.LASF1519:
+	.string	"_SC_GETPW_R_SIZE_MAX _SC_GETPW_R_SIZE_MAX"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF1794:
+	.string	"st_ino"
+.LASF1036:
+	.string	"LOCK_RW 192"
+.LASF933:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1580:
+	.string	"_SC_XOPEN_REALTIME_THREADS _SC_XOPEN_REALTIME_THREADS"
+.LASF1558:
+	.string	"_SC_NZERO _SC_NZERO"
+.LASF1312:
+	.string	"STATX_ALL 0x00000fffU"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1610:
+	.string	"_SC_THREAD_SPORADIC_SERVER _SC_THREAD_SPORADIC_SERVER"
+.LASF1752:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1378:
+	.string	"_POSIX_CPUTIME 0"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1710:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS"
+.LASF1282:
+	.string	"__struct_group_tag(TAG) TAG"
+.LASF1047:
+	.string	"F_SEAL_WRITE 0x0008"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1094:
+	.string	"AT_STATX_FORCE_SYNC 0x2000"
+.LASF1863:
+	.string	"programErrors"
+.LASF1144:
+	.string	"S_IFREG __S_IFREG"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1074:
+	.string	"SPLICE_F_NONBLOCK 2"
+.LASF1013:
+	.string	"F_NOTIFY 1026"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1247:
+	.string	"_SYS_STAT_H 1"
+.LASF1562:
+	.string	"_SC_SHRT_MAX _SC_SHRT_MAX"
+.LASF1684:
+	.string	"_CS_XBS5_ILP32_OFF32_LIBS _CS_XBS5_ILP32_OFF32_LIBS"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1231:
+	.string	"POSIX_MADV_SEQUENTIAL 2"
+.LASF1774:
+	.string	"__ino_t"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1663:
+	.string	"_SC_MINSIGSTKSZ _SC_MINSIGSTKSZ"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1329:
+	.string	"_POSIX2_C_BIND __POSIX2_THIS_VERSION"
+.LASF1116:
+	.string	"st_mtime st_mtim.tv_sec"
+.LASF1602:
+	.string	"_SC_READER_WRITER_LOCKS _SC_READER_WRITER_LOCKS"
+.LASF1079:
+	.string	"FALLOC_FL_PUNCH_HOLE 0x02"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1535:
+	.string	"_SC_AVPHYS_PAGES _SC_AVPHYS_PAGES"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1636:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE _SC_LEVEL1_ICACHE_LINESIZE"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF934:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF1464:
+	.string	"_SC_MEMLOCK _SC_MEMLOCK"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1763:
+	.string	"long unsigned int"
+.LASF1137:
+	.string	"__S_IEXEC 0100"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF888:
+	.string	"USE_UART2 "
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1498:
+	.string	"_SC_2_FORT_RUN _SC_2_FORT_RUN"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1447:
+	.string	"_SC_ARG_MAX _SC_ARG_MAX"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1685:
+	.string	"_CS_XBS5_ILP32_OFF32_LINTFLAGS _CS_XBS5_ILP32_OFF32_LINTFLAGS"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1428:
+	.string	"_PC_MAX_INPUT _PC_MAX_INPUT"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1128:
+	.string	"__S_IFSOCK 0140000"
+.LASF1041:
+	.string	"DN_RENAME 0x00000010"
+.LASF1381:
+	.string	"_POSIX_READER_WRITER_LOCKS 200809L"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1827:
+	.string	"pageProgramStart"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF1681:
+	.string	"_CS_LFS64_LINTFLAGS _CS_LFS64_LINTFLAGS"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1818:
+	.string	"flashVTable_s"
+.LASF1462:
+	.string	"_SC_FSYNC _SC_FSYNC"
+.LASF1196:
+	.string	"MAP_TYPE 0x0f"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1408:
+	.string	"_XBS5_LP64_OFF64 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF1058:
+	.string	"FASYNC O_ASYNC"
+.LASF971:
+	.string	"__O_NOFOLLOW 0400000"
+.LASF1355:
+	.string	"_XOPEN_REALTIME_THREADS 1"
+.LASF1010:
+	.string	"F_GETOWN_EX __F_GETOWN_EX"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1676:
+	.string	"_CS_LFS_LIBS _CS_LFS_LIBS"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1512:
+	.string	"_SC_PII_OSI_COTS _SC_PII_OSI_COTS"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1554:
+	.string	"_SC_INT_MIN _SC_INT_MIN"
+.LASF1587:
+	.string	"_SC_CPUTIME _SC_CPUTIME"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1030:
+	.string	"LOCK_EX 2"
+.LASF1262:
+	.string	"S_ISSOCK(mode) __S_ISTYPE((mode), __S_IFSOCK)"
+.LASF1660:
+	.string	"_SC_XOPEN_STREAMS _SC_XOPEN_STREAMS"
+.LASF1744:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1179:
+	.string	"MAP_LOCKED 0x02000"
+.LASF1361:
+	.string	"_POSIX_THREAD_ATTR_STACKSIZE 200809L"
+.LASF1420:
+	.string	"__socklen_t_defined "
+.LASF1762:
+	.string	"unsigned int"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF1701:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LINTFLAGS _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS"
+.LASF1321:
+	.string	"STATX_ATTR_DAX 0x00200000"
+.LASF1694:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_CFLAGS _CS_XBS5_LPBIG_OFFBIG_CFLAGS"
+.LASF981:
+	.string	"F_OFD_GETLK 36"
+.LASF1121:
+	.string	"__S_IFMT 0170000"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1632:
+	.string	"_SC_TRACE_INHERIT _SC_TRACE_INHERIT"
+.LASF1225:
+	.string	"MADV_POPULATE_READ 22"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1483:
+	.string	"_SC_TIMER_MAX _SC_TIMER_MAX"
+.LASF1805:
+	.string	"st_mtim"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1397:
+	.string	"_POSIX_THREAD_SPORADIC_SERVER -1"
+.LASF978:
+	.string	"F_GETLK F_GETLK64"
+.LASF1765:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1174:
+	.string	"_SYS_MMAN_H 1"
+.LASF1877:
+	.string	"pending"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1531:
+	.string	"_SC_THREAD_PROCESS_SHARED _SC_THREAD_PROCESS_SHARED"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1699:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LDFLAGS _CS_POSIX_V6_ILP32_OFF32_LDFLAGS"
+.LASF1277:
+	.string	"__ASM_X86_BITSPERLONG_H "
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1653:
+	.string	"_SC_V7_LP64_OFF64 _SC_V7_LP64_OFF64"
+.LASF1892:
+	.string	"mmap"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF970:
+	.string	"__O_DIRECTORY 0200000"
+.LASF1461:
+	.string	"_SC_SYNCHRONIZED_IO _SC_SYNCHRONIZED_IO"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1940:
+	.string	"micros"
+.LASF943:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1027:
+	.string	"F_EXLCK 4"
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1687:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LDFLAGS _CS_XBS5_ILP32_OFFBIG_LDFLAGS"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1792:
+	.string	"stat"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1214:
+	.string	"MADV_DOFORK 11"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1891:
+	.string	"msync"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF950:
+	.string	"_FCNTL_H 1"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1967:
+	.string	"mman.h"
+.LASF1958:
+	.string	"stdint-uintn.h"
+.LASF2020:
+	.string	"io_types.h"
+.LASF1948:
+	.string	"/usr/include/linux"
+.LASF1981:
+	.string	"long-double.h"
+.LASF1988:
+	.string	"__locale_t.h"
+.LASF1968:
+	.string	"unistd.h"
+.LASF2006:
+	.string	"bitsperlong.h"
+.LASF1943:
+	.string	"src/main/drivers"
+.LASF2018:
+	.string	"close_range.h"
+.LASF1993:
+	.string	"common_post.h"
+.LASF1975:
+	.string	"libc-header-start.h"
+.LASF1953:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1997:
+	.string	"endian.h"
+.LASF1942:
+	.string	"src/main/common"
+.LASF1957:
+	.string	"stdint-intn.h"
+.LASF1992:
+	.string	"target.h"
+.LASF2009:
+	.string	"statx-generic.h"
+.LASF1952:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1955:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1982:
+	.string	"stubs.h"
+.LASF1996:
+	.string	"falloc.h"
+.LASF1944:
+	.string	"src/main/target/SITL"
+.LASF2002:
+	.string	"mman-shared.h"
+.LASF1979:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1980:
+	.string	"cdefs.h"
+.LASF1951:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1994:
+	.string	"fcntl-linux.h"
+.LASF2015:
+	.string	"getopt_posix.h"
+.LASF1989:
+	.string	"strings.h"
+.LASF1977:
+	.string	"features-time64.h"
+.LASF1956:
+	.string	"types.h"
+.LASF2003:
+	.string	"mman_ext.h"
+.LASF1971:
+	.string	"system.h"
+.LASF2007:
+	.string	"posix_types.h"
+.LASF1973:
+	.string	"stdbool.h"
+.LASF1954:
+	.string	"/usr/include"
+.LASF1961:
+	.string	"struct_timespec.h"
+.LASF1999:
+	.string	"time_t.h"
+.LASF2012:
+	.string	"posix_opt.h"
+.LASF1976:
+	.string	"features.h"
+.LASF1991:
+	.string	"common.h"
+.LASF1984:
+	.string	"typesizes.h"
+.LASF1962:
+	.string	"struct_stat.h"
+.LASF2017:
+	.string	"unistd_ext.h"
+.LASF1960:
+	.string	"fcntl.h"
+.LASF1985:
+	.string	"time64.h"
+.LASF1946:
+	.string	"src/main"
+.LASF1963:
+	.string	"flash.h"
+.LASF1945:
+	.string	"src/main/target"
+.LASF2016:
+	.string	"getopt_core.h"
+.LASF1964:
+	.string	"sdcard.h"
+.LASF1947:
+	.string	"/usr/include/asm-generic"
+.LASF2005:
+	.string	"int-ll64.h"
+.LASF2010:
+	.string	"struct_statx_timestamp.h"
+.LASF1969:
+	.string	"stat.h"
+.LASF1949:
+	.string	"/usr/include/x86_64-linux-gnu/asm"
+.LASF1978:
+	.string	"wordsize.h"
+.LASF1998:
+	.string	"endianness.h"
+.LASF2014:
+	.string	"confname.h"
+.LASF1986:
+	.string	"wchar.h"
+.LASF0:
+	.string	"./src/main/drivers/block_device_mmap.c"
+.LASF2011:
+	.string	"struct_statx.h"
+.LASF2019:
+	.string	"maths.h"
+.LASF2008:
+	.string	"posix_types_64.h"
+.LASF1970:
+	.string	"string.h"
+.LASF1950:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1987:
+	.string	"locale_t.h"
+.LASF1974:
+	.string	"stdint.h"
+.LASF1959:
+	.string	"stddef.h"
+.LASF1983:
+	.string	"stubs-64.h"
+.LASF1995:
+	.string	"struct_iovec.h"
+.LASF1966:
+	.string	"block_device_mmap.c"
+.LASF2000:
+	.string	"mman-map-flags-generic.h"
+.LASF2013:
+	.string	"environments.h"
+.LASF1965:
+	.string	"block_device_mmap.h"
+.LASF2001:
+	.string	"mman-linux.h"
+.LASF1990:
+	.string	"platform.h"
+.LASF1972:
+	.string	"stdc-predef.h"
+.LASF2004:
+	.string	"statx.h"
+	.text
+	.section	.gnu.lto_.profile.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\022"
+	.text
+	.section	.gnu.lto_.icf.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`{\002\275\016"
+	.string	"t\022o\003"
+	.string	"*"
+	.string	"\305\305\374\005\032\002"
+	.string	"\001\002\003\002\003\002\004\002\004\002"
+	.string	"\002\005\006\002\006"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\310\365\327\242\006\003\352\263\360\321\b\004\005\006\313\322\375\213\007"
+	.string	"\007\343\247\372\226\n\b\b\t\226\211\220K\006"
+	.string	"\002\007\n\013\303\366\340\271\001\002\f\305\273\313\374\b\r\245\375\324\254\t\022\002\006\002\007"
+	.string	"\016\017\020\021\022\301\244\305\261\f \b\t\002\b\002\002\n"
+	.string	"\002"
+	.string	"\023\237\260\257\213\001\f"
+	.string	"\002\007\002\013\002\001\024\236\350\335\275\005\025\242\253\331\324\004\002"
+	.string	"\026\027\226\312\377y\n"
+	.string	"\002\007\030\313\215\372\303\001\004\031\277\225\237\224\b\n\007\032\264\234\371\263\001\024"
+	.string	""
+	.string	"\002\b\033\034\342\322\367\341\013\035\221\375\355I\"\007\036\244\307\325\302\013\f\037\226\267\367\241\t \341\302\342\257\004\n!\212\217\332B\026\002\f\002\f\013\"\353\252\315\223\t#\210\345\375\204\t&\r\002\016\016\f"
+	.string	"\002"
+	.string	"$\352\224\342\340\002\006\002\007\002\007\002\017\002\017%\322\327\344\325\n\002&'\343\221\230\357\f"
+	.string	"(\246\204\351\314\017)\361\253\302\312\n"
+	.ascii	"V\250\261\251AF\260\244)\3142\006@\002e\252H=\020@\207\306\030"
+	.ascii	"\026s\376\"\377\"\331\022\350\205(\217\230\343%f\250\2743V\035"
+	.ascii	"2\321\200H*\264\227;\240\006A\330\232\270\344\217\252\240\020"
+	.ascii	"\b\265\215$\344\346\001\233\237An\315\306\004\243\367\377\210"
+	.ascii	"\1775\023\330n\be\205\306\\(\032[\317\001c\246\306,\245Qo\b2"
+	.ascii	"P\002\035z(\357\244\301\241=\236I\347\255\036{y,\276\005\317"
+	.ascii	"\007F\241%\312(\020\321GR\257TM\032\3705\016\214I>\f,\f|\373"
+	.ascii	"\270\376?\262}\335\355\223h\345\253I_8\326q\365\324\260bG\256"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_.ipa_sra.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\024\001m\006"
+	.ascii	"\362\307\025\032Po\322\001 333333\213\307\005\035\022?\306\277"
+	.ascii	"P\261\326\026\221;\245\356V&eNN\203\202\352%\253\345\271\b\344"
+	.ascii	"\307\016\307\255\264\324xd6\343\027L\364\324\265\212M8\246\313"
+	.ascii	"\3335BC\034\246a/\354\2230A9\003\372;\300\356\243\337Lf#\313"
+	.ascii	"\t4 `\002)\205\345\001\031)PZ\fa \tH\346\202j\006\240R\301\262"
+	.ascii	"\020,%\276\342\276\230\026+7\263\025\032\225k\230\214\223\302"
+	.ascii	"\003\326\024 ha\355\006\207\274\205\033\0366\202\f\352\305\245"
+	.ascii	"c{Z{\030\005`\030\326\305\3726\204c@\313\207`\204\332\013\333"
+	.ascii	"\233\200\252A\\)\006\207\345\3150=\340\272\2262w\270\025u\370"
+	.ascii	" \261;\260\005,\270\340C"
+	.text
+	.section	.gnu.lto_.inline.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\220\0055\026"
+	.string	"F\034gH\320\322(\215\001&V&\235\b16g\004\215\306\330%y$=E`\235\206\221\3524~\3707\203\374\036\"j\2648\340\007"
+	.string	"\314\230\321\344\310\\\215C\271*\007`W\263\334\341\r\325\036"
+	.string	"\246\033\205o_\330\222A\266\224)J"
+	.string	"S"
+	.string	"\\"
+	.string	"\t\023mlp9\253O\226\205y\nw\267\344\222\023\005#\020\035\211\244\025\214\326x\201\263\224\332\364\357\367\026v\267\366\3729\213\177/a\367r]g\272\273\034\276\227\211H\273\334\355E\177\024\315\314S&\356v\271[\313\253\374]\b\247|c\267\306\242E\037$\036\033\252\005\200\272\023\340S\026\376*F\217v\267u\253e\222\205\313\302\370\247\274}\374d\b\321@\327\320\342V\304`\3264\3451cfH\201\013\240\032#\327\251g\361\033\265w\004UA#B\2475\037\236\234\016T\374Y\232\347\0014X0x\330P\003\333@\r\304\022M\322K\211\330v\334\270^I\242\335U]`"
+	.string	"\337\f\216\305\221\024,\035\220V'v\354\225i\201\3130\030J\272\022/-\202C\351\207\353\327qEW\354n\312*+\210\212\2118\273\313\232\300^\0341"
+	.ascii	"\025\217\266#\241\237\230\252\006\031\t}\200\005\323\242\351"
+	.ascii	"\004\b4\036\370M\300\270\343b\222*\222\334\363\274\374>=\312"
+	.ascii	"\351\227!D\023A1z\350\017\006\025Gd\013\362\355\355\201\252s"
+	.ascii	"cD\310\353\225\026\365\354\206b_j\346dK)\244\203\257\245\025"
+	.ascii	"&9'\350\211!(r\f\224a\313\247,L\031K=\001\200\214\250\221\265"
+	.ascii	"RBR\264\244\250\224\016\200\002\031!\262\352\022@\224E\305\270"
+	.ascii	"A\306\020\321H\022\262\264\307\034\b\370\211\230f\233F\017\344"
+	.ascii	"_Z^\300\227\250]fs\317\\\353\214\0350wR\314\203\b\0251\336}\200"
+	.ascii	"\375\266\327\326\310\033\003\306\275\b\326\270y\006(\216\312"
+	.ascii	"\016\315\371ci\032\037G\354!\372\212\364\n\003U\221\035\275:"
+	.ascii	"\233m\310\2606\027\224\216I\260\342P\326\264\361\300E\007\344"
+	.ascii	"\244\264\255xu|\260e4\215\377\210x\277\310\226VT\343\341\300"
+	.ascii	"\377M\226\371}\rL4\2038p\201\020\rQ\316\312\t\324\037lPc5p\246"
+	.ascii	"\312\232=uN\377\250\005\002\037%'\030\017\241*\215\021\024<\365"
+	.ascii	"y;\266\344\334zW\341i\352\030\031\275T\242Yx\370h/k\022S\f\357"
+	.ascii	"?\217\n\2743\330(\344\261\377\370\003m\335V\212\240\350\253\242"
+	.ascii	"9p\375\224\005j\203\340\302\303-\345\255K\312\341\272\231\245"
+	.ascii	"hL\232\034\350a+\2133\277 \267\nWb\034I\367\1777\022>\266F \354"
+	.ascii	"~&\337kR\343\241\202U\0175\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`Z\006U\021"
+	.string	"\306\024@3P\215\322\001\210H\357\252e\261D\342\027#\200\232\373\235\231Y\2254bwZS\271f*-\243\254\346+\370b\350\027\252}\373\243\277~\0065\231\345N)\0050"
+	.string	"2"
+	.string	"0"
+	.ascii	"\367\207\017;\314\027\370<\266\275z\t\264\2654\305Z\031\003'"
+	.ascii	"\356\001\275dY\226\371P\365\241\334\276\005\350\365l\266\325"
+	.ascii	"\"\346y\317\213\375~jU\004\327\346\3314OPf\3744\363\3167\362"
+	.ascii	"t\252Q\3010\fkv\036\346\331\356\353\031a\273q\332j\332\001k\345"
+	.ascii	"\341\277.\n\336\3162\367\004\237\te\245\001~\272\204v\t\357\232"
+	.ascii	"\316y\303+\363\224@\270\346A\250mAm[Iw\030\264=//\257\265\005"
+	.ascii	"\336r\335\233\273\331\034W`\021;\304 &h\003.\261\211\303\320"
+	.ascii	".\264\n\227\267\331\tm\247vJ\245p\343*\225m\3427\033\\S`>X$j"
+	.ascii	"\0166\035\302\267\220H"
+	.string	"&\261G|7\343\2367l\247\363\326\243\200\210\250!E\313hHJR\3112\007p\002\221\252*z\022\300\221y\214E)f\230R\b)\222`\206\202\024$\365i\r\337\274/AD\325'\354l\037\374\352\036L\346\317C\024,\253=\227\356\363b\355\316\231\246\240\364>\037.\224\245$\271\223|\275tCyz\215*\212\207\003\241\213\214\001%\256\255\246\rl$\0069 \215\023\226\036Z\347\211\340F\357\304[\203\354\367\373\310oU4l\364\217\024\001\311?o\020\215\202gO\3725\224\004\334\b\316\210qw9\027\306\r3\366Y\340$(^\353^\257\2630\250s\007\2506ta\005\313\377p\030\350\355\rN\313\360Z&\334C\203k1\tHjL\254\006\314\3734\013\261a\0264-\206\021v \004:W\360\200\245\313\267\205\211\241\tw\372\206\244\016\331\274D\270X\300_&\360\352s\273\255\326\247\022\313&\206"
+	.string	"\345\336\260\f\253\240\224Bj\030T\220R#\233\203V%"
+	.ascii	"\377\205\312\365\327\2117\224u\314Q\316\202;f5\244\313\344\202"
+	.ascii	"\212\343\245\017\312k\r|\255V\363\t"
+	.text
+	.section	.gnu.lto_.pureconst.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375 S5\002"
+	.string	"2\205\020\032\200W\215\001\016\034;0\003=#1\035D\024}\377\275\377\336\270\337\267\311J\006>\260\t,\0044"
+	.string	"\374r\313+\247|r\311#g\016\371\343\2167\316\370\342\212'\216\370\341\206\0276\302\303\261\273#\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\002\003\r\013"
+	.string	"BL(.\200K2\034&\024\020\016\007y\020\210\001\036\025<\270\025\225\001\231\022P\356\210\003\234\016\2665\262\307\217\306\324\306\335\377\177\023\204\020\262\245L\001W\025\013\345\\QU\305BA?\227\035\032n\31403P2\034\361(.\316\\\030R\016Y\n\224'\317\351]\343\210y2\330\2361\001BC\242\342I\353\341\205\360L\302\213\216\207a\361\032!\216\327A#\023\363\032\245}\322\020D\023\357Mn\320\271:#\235\316\256\213\315z\233:\247r\327&\340\217~"
+	.ascii	"\251Uj\037\223\225\320\317\371\027t\311\002\2776\002Y\250\240"
+	.ascii	"R\221\264\220e\f\220\002\231\031+;\022\340s$\f\366\234SC49Z~"
+	.ascii	"\227\007\300\201p\324\200[\216\372\237@\352=\031c Jn\351\264"
+	.ascii	"4\024P\351\2506\360\335k\207\306\271l\n&\263\232;X\006\027\321"
+	.ascii	"\205\353\345V\253\363U\320\251\364\204\302rM\217\263\3673\214"
+	.ascii	"\303\233\302\301\210b\322\345jB'\321\232\016\333cJ\372\017\345"
+	.ascii	";[c1\022^8f\020\226l\020\007\206GM\337\347\323\374\231\272\n"
+	.ascii	"\345\325!5ZQp\340\250@\205\343FH\340%\220z\026\314u\276\311f"
+	.ascii	"\310\350]\020\324\342\035w\232\376m\033&\024y\347\177a\254\212"
+	.ascii	"x0M\246\276hlX\237R\336\002"
+	.text
+	.section	.gnu.lto_.lto.91491f9cfdf1120f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_geometry.5.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006'\001\200\002?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_deviceBusyFor.17.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\201\001\365\016"
+	.string	"\246\234eE"
+	.string	"\221(\035\377h\374\371\t\3445\244>\367\r\210F\340\251%a\364\241\271\332^\271\305\363\266\021:\006\375\2574\371\030\254S\"\037\373\243+\365\210"
+	.string	"\t\202\376\347\266\200P_4\364\350\310u-h\266\355-eJ\001Q"
+	.string	"K"
+	.string	"O"
+	.ascii	"\353A\005\213\335\217\201G\236\307\217\027\340<\302\017\340<"
+	.ascii	"\232e\323\370\027b;-&V`n\354.\247 \316:\324d\371\247}\363`\255"
+	.ascii	"\303\330\025\036\220\275\210\t\200\245@\0056-3N{^\200\2752;\r"
+	.ascii	"v"
+	.string	"\327\351\3014\334\361\266\035\330\206`\337E>\334\335\265~\260?\373?\377\356M\323Q\323\020\246U\323\251\351\007\350\304l\020\304\330\305P\333\2615\261\005\211\177\277\375\323\374\001\315\204\330\237\005O+\203\207\346\365Rc\367\003y\364\003\317\243\r\232\205<\355\277\374\004\3533\024o\0332\033U\027\203\\\225\204\002FJ\346p\252\352W\254\364\270n\232z\225\022\257\254\331Oq\030\024_\204Q]\336{\364;\316\343\025t\303\342\312\2323\206\307\246\377\376\341J\035\356\244\255Z\345\275MW\035^\332r\306\340\220\261\251\303\376Z\251.\016\025\272\022\265(\202h$*\221F\241\004\252U\272\0242\031A\241DL\245\323\211\211DDB\251\233@\342T)\323\311)E\302\225\234FP\\)\245\342B\013\334\231\230R\034\205\256Kq\237o\317\241\306\245/G\245\271g\343\243P\243^E6\003\225\200\314\006\270\251\214\201\033\026"
+	.string	"1\265\034\341\005\033"
+	.string	"\2703\241\314\2000\f\262\302:\020\301 `H\261\003\223\205\261\005,a\225\217\210eH3\222Q%\r\002\201\005\036S\355\030\230\342p\301"
+	.ascii	"\252\2006\352~\341\032\343\205+\205\243(\212;7U;S4\005\005"
+	.text
+	.section	.gnu.lto_operationFails.18.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`-\001\335\r"
+	.string	"\246\032^C"
+	.string	"\261&\035pW\347\362Z\344\273=g\2448\3072\217\f\373\004= s\031\240g\036\222l\357\344\325\2541\353\374g@\006\321\0018\004\214\031\310U\265\37638]\246\025\314\255\377\300\023\302i\262\367\2262\245N"
+	.string	"F"
+	.string	"I"
+	.string	"\037R\354\216\025|\244\030\364.\246T\215LX\030\221\263\333Y\312\341\240G\3704A>"
+	.string	".\364H\340\220#\303\337K\340\302\002\303\200\026\033`t\270\225\324"
+	.string	"\234\3123\260\273\247y\266p\243\314\ndw\235$\356\302]\335\366\003\333\037\366K\001 ^C\301\2279t\005\224<\351\320G\211\207W\001\247\032Q\246|\232;\360pS\003g\323\206\335\205Ra\354\277\325\027\333\351*\323\321\351\227i\315tf\372\035\ffrf\024\210\261[J\335\330\033h\323\301\366\355\0073Pa\2561(\031(\336\273G=\312t\272\252F\215)XlTI(\r\022\316\267\230\252z\026\227Q\246\354\213\270i\363e\374\311\262x\230z\340\244A\224\251\347\356\206\324[\274\216\230^\250$\312\266\204\207\3308vw\201\037\276<LD>\237\020\354\362\234`$!%W\006a\304\3324\354\304\243\221X\021<\"\037\353\3226\313\003\2013\023L\263&d\231fu\272\375[}i\340bE\211\023\317\007E\303\247\225\266\330\256\324 \"\035\305\216\264=%y\322S\325\220U\254\224\002\031"
+	.ascii	"i\204n\336\300;l\030{[\201dMu\215p\231\301@\236<\030j\312\020"
+	.ascii	"Xl)g\373h\243\023\374\303\226\026{G\303\254\343\302\230z\260"
+	.ascii	"\035\\#-\362\272\272\256\252\2215CnW\321\003"
+	.text
+	.section	.gnu.lto_flashIsReady.19.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"u\n"
+	.string	"\246\224J= M5\035#\260%\r\224\224\207TJ\005\200r\0220\351\022\tQu\035Q\342\220\315Y\300\206\351\336\263\303\002\315\220\217\302\220"
+	.string	"B"
+	.string	"\213\020>@\243\201\002\027+8\240x\322\233H\231R7"
+	.string	"7"
+	.string	"9"
+	.string	">\350b_\227\2671\366e\002\016\2143\027+p\254o\264\351pbN\021[\n\317\\3\376?\2472<\020\201\035\315\325*0\347\264\202\235\006\367\336v"
+	.string	"\333\016\373\026\001\030>\230L\\\021\246\236l\361\323\235`\237\232+\301\266\272\242\324r\325\324\252w\325\312\260B#.B\314\311\031QL\021\022\304\005\333\367A\017/\327\340\227Bs\316\3532\237\216\246V\356KlRx:.\265g\340\371t\264\277\341\034&\276\005o\234\036\344\252\313]"
+	.string	"#\007\236\216\266\324\017+\013\364\240\256\001\b\337j\374\360\025\036D$\246\236\030\244\316\032\024\310\266=\264Lb\321\"\217I\306!8\200U:\315\"\351\"X\002\td\303\262\256\2025\004\230\243h\035\246\200\343:\354\022\275\273\332\177\316 \201<&\222\267\237\007\\n\265\262\264\t\003\f"
+	.ascii	"2\003\302\260\220\354t\b3\234\214\231\306\202\301\024+]\023\303"
+	.ascii	"ab\027T\344p\227M\355$\003"
+	.text
+	.section	.gnu.lto_flashWaitForReady.20.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\376\001\355\022"
+	.string	"F\345\204I\300\020)\035:Tzq\207\370a\213\224x\235\002z\007\373\212\020Y\024\252~\3157\217\300?H\367\221m\236\371~\317N\330\225\355Tp\177T\024\204\342\334\202L\004\b2\275\270\240\316\326\304\350%X\272Z\377\215\220-eJ\001q"
+	.string	"g"
+	.string	"o"
+	.string	"B3\366\230\323\203\221\2129G\005.Y\035\034yHxP>@x\320\266\0270\240\361\355#\b\035U\256\006N\n\2509\307\327~\370\355\252\020\224\2537\237\265\303]%\3620\303A\220\304\216\245\030E;\r\227\022A\005\031\222\344\323\324\332\331\350\312\001<.0\200\354n\244\201$\237\246\367\2569\273\234\252\312d\316i\325\355v\356\325m\323l\317l\025\0206\030\275\356\240\017\023\036\374\272fl\250\321\237\337;\204\241\031\3654u\312\036q\272<\373\373\373\375~\336\037\373B\177\353\343\315\262\032\224j)\325+\325*\325\007y\320\003e\243\300oN\235_\216\211\004\256"
+	.string	"\372\370\3334~\317-\221\235\023{\224Y\341.\254\212\226\240\234\346\234\t\016\032\266\022\3019Q\265o\342A4\017*CNQO\367\001\265\220\002UR\037*\327\026W\364:\217\330,\316 \276(\303`q\202I.\317rwk*\031\237\t[+7<\272)\361\341\303\241\244\"t<H\273<_&d-\214\350\205\215JY}7\224X\373\361#5:\345]\326\352\021\316\016\335\357.H\343fDN\177\366P\233FA\257\323\375POnq\366\211\216b\306\017\341\266\b\023Z\304\0261e&\253\265L\"\201\244\204$\006+q\021\260\211,,\242\203\027\030\232l&\276"
+	.string	"p\314\345\2222\233\241\310bb\214L\005e%Fc\201\275l5Y\214XSy\265\210)\263W\254f{\271\016\230\346\"\253\275^h\264\332\2535\316\357\217C&\013>\243\360\277\205\357\275\301\222\016\237\221\364o!\2709\266\301\265I\315\346\344\234s\252\226\367\345\300\013\352\020~\350\006\033"
+	.ascii	"\203\321\214*\0230\252NA\343\"\310\330f\252\035SI\r^\221*\330"
+	.ascii	"\035.\303\2528\b\205\326\371U\004\2620\304\343\267\224a\341\031"
+	.ascii	"\202\215\3025gl\302|\024Y\b\252\210-\247o\3320\260\016\255Z\332"
+	.ascii	"\022&\024"
+	.text
+	.section	.gnu.lto_flashEraseSector.21.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\242\002\325\024"
+	.string	"v\347\210I\300\224Q:X\002A\0177\230\004}\376"
+	.string	"\351eK\035\347\023?\377\034\366'.\306\241\177\311gW\032\003?\352O\262\357\226\326\013=\372\366\247-"
+	.string	"`\020\225\267\301\277\243\006\352\355\363\017I\270nm\262\375O\032\331\233H)Sr"
+	.string	"g"
+	.string	"y"
+	.string	"\275$\221X\374\327\324\177\"\204\201\356\25744\b\247\276\333\307n\024F9\272\177\b\356:\251DQ\223\2512T\326Ty\334\337\244?\237\026{B\344"
+	.string	"\217tw\213S(Ne\310\213\273\212+#\257\227SIB\303\360"
+	.string	"\221##"
+	.ascii	"z8\241\211\316\n^\252w\263\234\352\341\204(\335\255B\272\"z\272"
+	.ascii	"]q\245\273\277\274\336\b\375\324\377\030\376\273\374\313\024"
+	.ascii	"\300\333\251\273]\327!\255\241\341\372\243\3623\231U\236\312"
+	.ascii	"\253\314T\251\274R\341\263\331\340Q@\343\212?\3646\177Z\207U"
+	.ascii	"\336Qn8\367%2\341\2437\311\377\313-\367\374\032vw\237y~\365\251"
+	.ascii	"\262v\277\222{\325\334\247\346\036\265\373q\356Or/\206\373\271"
+	.ascii	"{\271\373\220\367\274\373\335\275\236\240d0\031\030\322\255\023"
+	.ascii	"T\022;\240\221Q\2549KX<\262T\332!\261\370\304!P\223T\351\303"
+	.ascii	"\365\347\024ZZ\246J\221\307\022\222'kQ\316\022\233\n\212t$Y\215"
+	.ascii	"\200\370TD/\236\024\004\303'\344\036\026\207\254MC=~\013jT\244"
+	.ascii	"8.\270\274\274L\005\272\335\235\343\203\230\3141CAn\026\311\003"
+	.ascii	"\354\377\202\255\362\230\027\354\350Z,\337\270\255|l(\257\210"
+	.ascii	"\352m*/o\321\356\204n\203\377e\032W\311\240\342R\201\305\270"
+	.ascii	"R\006\330l\262Z,\366\022\017K\241y\315\314\300\310`\263\032Y"
+	.ascii	"\fF\006F\333\020\323\262\325d5\263Z\254\305a\366\232i\301j\266"
+	.ascii	"VJ\201\323hd\265\226\007\032\255\326J\375Z\303f\236G\230\261"
+	.ascii	"d\303\272\023\330\025\3778\241\006\277\003\345\241Cw<\200\300"
+	.ascii	"\3022U\256x\364-Q\f)`'kP\2574U\374K\230\220`g\307\271\247Xd\025"
+	.ascii	"\353\316\205\216O\234\342\020\030/ `\002\22112\037\r,\341\204"
+	.ascii	"\320\034\213\201\204\260\370Q4Bh7\360\204\311\265\254\201V^\021"
+	.ascii	"\312\002Z\254\273\210\303\b\206?|\244\2418\263G8\371\275\035"
+	.ascii	"\366m\016\276\220Rh\261\301 \345m\356`\351\036!\306\037\022\007"
+	.ascii	"k\354s\213o\t\337[\005k,\\\304\353\341LK\021\027\267\214\007"
+	.ascii	"\204\301?\b\357\254a\254\315\350\260K\032\360\355u\267K\351\001"
+	.text
+	.section	.gnu.lto_flashEraseCompletely.22.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`v\001U\016"
+	.string	"f\032^D"
+	.string	"\223\223\016\263B)\362\370fcd\036\241 \016\216\331RP\252\324\244dNz\375\211(\265\001\264-\207\247\230\321\262q\240\034\022\3555\262\261\255Y\"\255\332\020\302\215\241\260\355N\t\220\337\b!{\023)S\nE"
+	.string	"D"
+	.string	"P"
+	.ascii	"\216\232\206\231\266\236\326\247\363\351"
+	.string	"\217tn\344@@\263\373a\005dq\240M\t\333\017q\311\346q\025\314^/#Xf|\354\256\246$^z\226\374\237x\366\265\230\236\327\202\335u~- n\275\355\002\266\023\330\t +\333\030\236b\204\355\256\002\037\305U!_\346\320(]\376;\364\273xx\025\211I\235r\345\016\r,\257\035\037E\233\304!\377\231\200\00759kd\350\330\374a\253L\251/\366\255U\027\373\351\354i\314J_\3171$L()\211\207Q\005\344\330\b\220\226~u\337D\2506\205\n(5\331oq\027\035|\031[01\211\207P\263\020\252\226\222\260\0049}\316\202\346+@\033\307\305CU\0039\251\254\251\221:3\022\201Q\361\257\307?\212\327\324|\201\022\261\222\001\336<)\240\256\373p[H\205;\371\240l\242\f\0274\222\307\251\204\274\023MC\b\324i\233G\322<\007,J\341<m\203H\344i!\252\275\265\352\362"
+	.string	"\007\316IW< 3\265\0314\3004j\246$(\023\227bz\007\277\2010\343ROL\352\024\34160\036! \260\002\2311\243\007#B[H`\353{\253\033Kf\030^\222X\260P\022\026n\222\017\214\231\317\035f\337\001b7\240\341q\263b\341 \331\003\303\347\231\261\361\262q\276\210\357\305\225\361"
+	.ascii	"2\370\213p\346p\3561\300\351``\231\027\255 \003"
+	.text
+	.section	.gnu.lto_flashPageProgramBegin.23.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\025\013"
+	.string	"FUNA M5\035\030\255\023\006a.Kb\357x&^@c\004\241\202\276\340C\020\006\tP1\321t\316\002\035\350\350\351\232S\3552l\t`\241[4u\331p\243\273\271\240\365^tw\306f\2557\331;\2458"
+	.string	"8"
+	.string	">"
+	.string	"\036vK\rg \257\226[`\257\327+\260W\217\266\211\227\02063QH\220A\265\273\032}\360\361s\364\217z\204$\205>3\216\335\365$I\013nz\333\027\2665\366+\001$v\256\35424\251\311\376\265\273kZ\262\177\372\2579}\210\2045\"\243\303\256\202\026kS\025\304\004\333\267_\216\366\304\246|\330\370<\312\257p\013\343O Gv\035\204\b\247\276\206o8\360\341y\330\353\024A\236\230\366\007RM\203\321\352\242\376\205c"
+	.string	"\371\022<@\234'_}\021{\245D` \232-KTuf%\016\302\354\002\006\346I[\020\320\220'\007\024\001\306x`2\230\255\223\271TD\261\0139\216\223y\273x8\337\267\3516\357\323q\033"
+	.string	"\033\030\240\243\211a\367\361BN\023\340q>m\013E\355\202a\320\323\205\032\001\020\f\265I\271\277\226\226:R\244Dt\344\016"
+	.ascii	"\rT\302\231\320!\024\030\376]\005\266u\225\221\253~DW\032A\230"
+	.ascii	"\224:\362\317\226G\027\214\340\232[\b\363\t"
+	.text
+	.section	.gnu.lto_flashPageProgramContinue.24.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`W\005\205\""
+	.string	"Z@\310\rF\220\234M:%;\361\232\027\237`\316\035\002\033\302Vd\310{%$)\315e7\017\034\301\305z\240\266\277q\233\034$\315\304~\321\234\"\210 "
+	.string	"`\2555\200\2505i\252\351\300\24370\310\020k\226\020\262\267\334)\005\307"
+	.string	"\270"
+	.string	"\313"
+	.string	"\366\032aD\215X\200Y\340\324Z\037\234Z\304x\372\231m\373A$\177\257\302t+\366r\254V\252`\227Zk\004\177\030O\021L\233\217\350\322\276\224Oa:\326\213\373\324\n\304M\227Z\177\021<4\236\372\367Zx:\376'<5\223\375\346?\253*Vm\361\200tj\255\267\025b1\030\f\006?\177\267(\231\036\033\305\220\316\225L~\326\023\030\t>\365`<F\3535\311\021M\224\224\326\205\226D\371\244(S\242\343a\216\323Y;\363\243\r\255\3474\035\360 sc\326\223!\347\254"
+	.ascii	"&G\215s]\322\350\305\230\262\b\2338_\022%%\367Zwp\025\346\251"
+	.ascii	"\247\343R\264Pk\265|\352\331\270e\267]\305v\316\246B\001\376"
+	.ascii	"\225O$\311?\235\372I\341\351\227\002\033\337N\006}\256\177F\227"
+	.ascii	"\324\216\231\322\232\263~P\241\307N\202\371Z\237N\250d\027\016"
+	.ascii	"4U\202\331?\030r\253\354\017\351\020c\345\005b\013\035\353?\360"
+	.ascii	"\255;\350V~\003\007\336@"
+	.string	"S\232\300\224\266M\351\332(=@\224\376\021\245\005\210\322>S:\300\224\356\021\245i\2424\317\245\001\204\3223QZF\245c\241\364H\245\305)\035Ni:\245\347\224\336)-\247\364\025\314\260\316@\340Rk\215\240\235j\206~A\362\255\037h\203B\344c\361\271<\263E\331r\261E\206\0268\265\376F\214\247\266#D\376\025_\313\263S\033\022\"\033\030\317\205=\033`'\320\211\2077\274\314\230\223\341\320\301\203\207\360\264gkC\260h]N\344\221\033RT(myV\227\365\305\263\262\245-\005\362|MbH|x\021\236\362\314\366\300\002\230\355,\303\013\333\205A\001b\274\362Y\204\247\262=\324\324\270\342\306\366NM\202v\334\363\302v`\356\305\"DQQx*n\215\215\217\t\327\232 ^s\253\034\264\341\352\262\312\304\220ul\033\375Kn\254\265\016\371]\356\345\310\277:5\256D\211\3604\334\005C\260"
+	.ascii	"t\355@\023\264\337:\202\235\0043]\271A\273@\336\215\246\340s"
+	.ascii	"\341\\\272\005\356\360|\273\337\271w\342\001\264\273\005\274"
+	.ascii	"xa=\301`X}.\374\312=\317\327$\203\366\273\256%\027KK8\035\022"
+	.ascii	"\222\221\230\273\211\025%R\340P\204\236@b\302\320\204\243\021"
+	.ascii	"C\022\202\214V\030!M\037IPa\224\224T\204;\312\265\300!\025\235"
+	.ascii	"8RB1\342\266\244\303\265\310\351\220n)rFI\267#\335\322MB\003"
+	.string	"+\251\300\351n+\224\224t\267\231m\377\352\027\2101P1\263\333&\023\3306\266\255-\001\003k\373\252\255m\210o\227uY\327\024\"\261+\205\003VRe}=\315\325(e\320\240!<\035\260\f\326\215\217$t\306\2552O\226Ph\367K>8\320B\331\266\201\005\332\013db\310:\264G\005\264\026v\022\354\263\326ZE\241=\020\302\201VH\353\177\002\365\263=V\177\222#`}\366gW\300\356\035\250)\237\375\034\250\251(2\f\260gr5+3\177\222\263\013d\250q\034\247\234S\312\224\314((I\n\223\016\200\002\02113\036\021\220\301cTR\313\034@?\215\217\260=\230\231\324\234gzg\367_\303\370\273\007\212\275\320f3\226#\261\363\313\006\245\256\027`AH\377\322\017\201\007\333\260\202\212\201\377]y\220l\300'J\340\345\324X\343\370v\313\376\360N\344W\353\304\260\371\216`3O\2659\026"
+	.ascii	"2:Z3q\205\314\013/\260f\241\234c\335m!\214\031\260\036\340q\007"
+	.ascii	"\252\377\027\261E`\231/Q\272V\242v\244\252\267\022' \252\301"
+	.ascii	"H\024t\360d\270Z8W\313\373\347\347\272\364\2308\254Y\234d\270"
+	.ascii	"WuVN\"qc.\321O\342\031c\270h\371*\025H\023`\210\270\211o#\204"
+	.ascii	"\313\300\352 MV\013f\220H\225v\274\227\006"
+	.text
+	.section	.gnu.lto_flashPageProgramFinish.25.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"\345\t"
+	.string	"\266\022D<@\305j8"
+	.string	"\274^l\335\275\311-\r\030\335[9\240\252d&\0314\337\224\276\273\036\340N\276\340\370\312\301\221o\356[\246\335\335|f\006o\233S\233\230P:f\232#\334D\312\224\002."
+	.string	"2"
+	.string	"4"
+	.string	"\266o\377C\2645\026\355\001\177\265\026\303\022`\001+\260\273\233j\\|\212\376=\236\031U\247'faw\235\243\n\343\326\3336\260\235`\037!\232'L\371\361\232o\272\\\273n6\\\250\2349Mb\0016\r\330\257S*\313\276eue?\255O\347\323\307hT"
+	.string	"pb\273\027\263\003+\323P:\002\371\321\005\024z\262\rz\t\354$\037(\022]\256\251fRRGH\233\226\310G\002?\351rM\315\223\212\214T\316l\217\036B\"\330]\005\037\344.\t\237\343\001\3468!\317\367u:\316+u\237\016\210\003\037\032\266Q\330\225\274\360\263Ax\236o\343\302\321\30690\030\352\302-\002\004\303M\363\332[VW\f+2\224\246\274IU\333\301\013\020"
+	.ascii	"3\241[(p\002\364:@\b\f\374\206l\220\027\016\215\263Z\004\336"
+	.ascii	"\213U\006\001\0023.\2144\203\325\3402/\332I\006"
+	.text
+	.section	.gnu.lto_flashPageProgram.26.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\250\002\305\025"
+	.string	"Vh\216J\260\020V:x>\372%yg\360\3668\335Av\371AI\377\201A\301\331>W\351\035\356\301\027\370#\023\033\272Y\227\2746\237\202\313\255u\336\037\372\305\037\346{0}\334?\324|\314:\005kq2A\333/\264F\b\t\332;\245s"
+	.string	"t"
+	.string	"z"
+	.ascii	"\266\353$u\331/*Y\355\361\321\ndeJ\200 \332\335\021\323\316\223"
+	.ascii	"/(\031%~\205\357<\033\036`\367\246\252\302y\322\304\363UCvj?"
+	.ascii	"\305U\370>\354\231\265K\202\005\321.q\304\261\363\244\310_\345"
+	.ascii	"\311\325\007\224'\355\263o\234\230\263&\216S\207\242\324\356"
+	.ascii	"\302\252\211\373N}\376\213g\tm~\247\246\202\3355\025\332|\270"
+	.ascii	"\353m\037\260\255bW\001\001\2471B5m=\320E\200t\312\364\210\203"
+	.ascii	"i\351\224M\f\322\212c\177\265\273\353zc\233\324\254\222\372,"
+	.ascii	"\251\315\222\272|\317\277:\317_?\374)\210Kj\t\366\263\353\241"
+	.ascii	"\212j\225H\243\023\276\320\207^\356c\332\343\205\320\213\355"
+	.ascii	"\2721\346>~\220\004*\327I\333\007:\1775\347\017\216\323\323."
+	.ascii	"1\301\311\220\"\331\351\201b>\354\275\346D\232A\361t\322\377"
+	.ascii	"\211\t\273\033\363\223\016#\202\277s\322\023NN\312\223e\375\320"
+	.ascii	"\031~\350\255#\322i\216-\232\\;\b\320U\255\325\246\2002S\177"
+	.ascii	"v\345\370\213o\035q(\261\252\177t\027\032,\314f\345I*C\030\005"
+	.ascii	"\200\372\306\332\215^\310\252(#\202\365gj\234b\362\213n\324\363"
+	.ascii	"w\254\202\243\027\342\312\223!:!\200\264\312-\251\0265m\274W"
+	.ascii	"\372\306\234\216^h\021\231\372\363\215o\031u<\350\001\030\\T"
+	.ascii	"Xn+%\315\205f[\271\344BI\254\244\226\022#)\300\343\335v6\033"
+	.ascii	"\315t\215\244\205\226\313\315n5\034\314\3156\313P\323\255\244"
+	.ascii	"\300x\273\033\fng\203\261\340h9Xm\307\203\221 \260\256\345\266"
+	.ascii	"\203\271\350t;\230\213\b\374j\353\215_\374y\344\241\004\254A"
+	.ascii	"\033\240g\365\207\0260h\360\246\24539x`bR\236<+\213\036\223\314"
+	.ascii	"J\243\367\2213\343\302(\340{eY\315J\2078\210\b\032\302c\364\316"
+	.ascii	"5 `\002\231I\330\r\r$\241\274\320\026S\340L\340\256\021p\030"
+	.ascii	"\020\362\300\261\323\310\267Q#X\177\t\342\346\0262\260D\214\030"
+	.ascii	"\354)W\f\340\331b\021{Rk\375\326!\225\222u\200\033\005\3378x"
+	.ascii	"\001{\223\353\332\306\342\324\267\342?\276\021\256\245\306\272"
+	.ascii	"\357p{\355\tm\211\026:LS5\346\264\374\373\305o\256\314\366}W"
+	.ascii	"2(\314\307\325\030\376\333\024w\347D+0\222\027\027&\003"
+	.text
+	.section	.gnu.lto_flashReadBytes.27.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`m\003\245\031"
+	.string	"\366\360\251F\260\032Q:t\310A\235A\016\201\022;\213\034\312R\243\n\306\207\363\204\322\200.\3405\0375\231`\277\277\355\312\225\225e}\035\305\013m\235aO\244<\220\035I?\324\224\347\265\241\243?J\364\265\375\237\354\275\245\224)\226"
+	.string	"\210"
+	.string	"\227"
+	.ascii	"\275`\255\265\301e\251\235/\240\017\377V\tn\227\034m\200Z\231"
+	.ascii	"\312\200\370\245^F|\226\327w\273\252V\034R\202\265\376\032\274"
+	.ascii	"'\265\363\377\367\310\"\301\375P\362\267C\fUD%\001\327\324Zc"
+	.ascii	":\373\242;"
+	.string	"\345\n\240;[\307\3426\244S6\343\276\271\r#\024Q\323\023c,u\211<\226\270\343)\027(iy\341\022U\310\227\227\034dV\210;\226\251\030\333\022\001\223\r6,\021I\352d\351\222\264\300e\026\342\2169\224Pk=\367D\027\373\324\376?\372O\373\373\026\347\247\031\333\346\306\330Dv\323\266\217\033O\302\364S\320\355 &c\220\270\315W\034\212\331\033\375\211j\274\275m\bKH\235\373\002w\365$~\251\354\346\377\345\270\233\376\355q\034\3077\323\277Kv\t\254\323\036\266N\273\003\326\267\373j~\316\344\273\230\337\n\3718\314gQ\376j\362U\223\237\232\374p\362\251\344\317\311\227\223\337\222\277\006\\>/\261\261\326\026\343\233\332eR\361\361\037\367\263\376W\320\247\235\016%\001T\244\034\001\213\345\350\333\343\0326l\240;Y\255\222\001\353UoR\224.\b\254\327iut\354\346\252\206\365\202Iu\330\2526"
+	.ascii	"\344\245\031\320\251\226PIQ:\036\303\016\201\274\037; \017r\031"
+	.ascii	"B\203\276\232\366\216a\262\345\347\260PU\326J\007\017\037>\320"
+	.ascii	"\235\264\037l\023\f\"\272\331MNv\006\340\377\007\210\2677\333"
+	.ascii	"\301\322\256s\347\247\032\262\203\267\326\216)\333;\263{\243"
+	.ascii	"\335\262\031\310S\332\361\370_\266Rn\251Zk\317\027\312F\231}"
+	.ascii	"{\354|\b\332\374\322\272\305\303\247\3431\"L\204(1#Am\263\241"
+	.ascii	"\241\023A\364<C<=<\262\240\236\235\003FF3\233\220\020Px\331N"
+	.ascii	"\021\020\021\321\317LFC1\023\372\031!\253\221\b\212\031\331f"
+	.ascii	"(h6\241X\t\032\020QLf3\212\355(x\255hf\213\231\250\325l1\326"
+	.ascii	"\257n3\275\bM\031\n\353\005\256j\311\214R3\330\234^\361?\247"
+	.ascii	"/A\327;Yk\255\241\013I\002v\365\217K2A\347\247\260[\262\254\226"
+	.ascii	"\n\026.\\\240;]\255\362\271\210\024\340U\267\232@\377\0302\360"
+	.ascii	"\366\316Z\342u\3568\315\352V7\024O\310\016g\257\004= \220\"\231"
+	.ascii	"\312\362\r\224\360\207\001\307i^\001\257\374\3230\262\334r\342"
+	.ascii	".(\350\022R\311\300%\3076\034\362\366\360\344\232.\314\320z "
+	.ascii	"\222\033\033\327\230d\001`z;\274\322\031\034\355\006I0\024\223"
+	.ascii	"7X-!\r\2344\017\3325%\214\307@\0131\236\017g,\215\270\030\031"
+	.ascii	"\001\342Ri\363\334\313?\252|6\023`\367(k\313kL\3248\240\217\325"
+	.ascii	"\034~\303\036!\337E\252\351\361\273C\242\016\253\305\211S9;\373"
+	.ascii	"h\ft\017"
+	.text
+	.section	.gnu.lto_flashGetGeometry.28.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"M\007"
+	.string	"\302\21536Po\322\001\200\276\2325P7\262P\3719\nu\245\224I\245\266/\207\342\326P\303\\\370\3552\031q\336\335\266\232\231Y\354 \275\347\204\252\303\020\227\326\322n{\247\024\226\034\220\347\272:SZ\242\371\3510H\254a!\206\350\024Y\364\023\035,\317\025%\rE\216\2011\320\244\361\001\303h\254\352\276$\333\354\226\276\371$\257\020~\307\241#2\367\355\320\317\250C\004\213\322\223pu\261\356\305\256$\3672\354g\366a\330\016 \205%\001e\227\"\006fW\340\211\207\355\221]\371!\027\031Y#\250\033\247\200\026\216\t\023\227\335\032]?@\035n.@\035>\215kw\232\377\221g>@T6\023\351N\243\260\273v\233\351t\277\333.\260}`\273\"\t"
+	.ascii	"2\003\302p\023a\241\013\001\272\206W#\232\026\202\020w\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_blockDeviceMmapFlashVTable.29.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"E\006"
+	.string	"\324\n\304"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001\212\001\202\200\200\374\342\303\344\303\005\177}\270\344\243\005{y\370\337\223\007wu\270\337\303\005\370\336\243\007sq\270\336\303\007om\370\335\223\007ki\270\335\203\007sg\370\334\303\005ke\270\334\323\005ca\370\327\203\005_]"
+	.string	"?\202\210\200\330\001[Y\305\001W\304\001U\303\001S\302\001Q\301\001O\300\001M\277\001K\276\001I\275\001G\274\001E\273\001"
+	.string	"\013/root/repo"
+	.string	"'./src/main/drivers/block_device_mmap.c"
+	.string	"\013"
+	.string	"\200\024@\n \005\220\002H\001\244\200M"
+	.ascii	")1I1\223\324\001\300\001"
+	.text
+	.section	.gnu.lto_sdcardStartOperation.32.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\355\003\245\030"
+	.string	"6\355\236H\300VQ:\326pt\216Q\2016\b\031\020v\340\211\223_\213\3767\3257(7\217\251\274\303+\201\311\213[\374\r\330P\f\336\206\376\260\266i\215\263\271l\n)\002\004\244FNp\267\2654X\304G\321\277m{\023\271S\n\211"
+	.string	"\200"
+	.string	"\213"
+	.string	"(T+\204\262,\351H\201m\217\023\355\356\243\347"
+	.string	"\253\362\210\212j\251O\377R\255$0\371\323\205\254\312\223\341\342C\352\263E\004vi_\307w\354\316\203\204U\265\306"
+	.ascii	"\032\251\365\027\301\257\324'\203\313\320\317\360\005\350\247"
+	.ascii	"w\266\322\1775*\212\006\026\241\037`j\255\256\245\361\335g\270"
+	.ascii	"r\347\243`\252\236\317\3473\245\342a\211\225\217'w\200\017(d"
+	.ascii	"Pk\275\220K\023>\236\224(X\255\325\262\347Kq\323\333\336`\033"
+	.ascii	"\205\275\300@\353\343\326\323\322\237\243v\355F9\231\032\265"
+	.ascii	"\326\227O\344E"
+	.string	"p|\034\237\266\215\362\275O\177\244\2373IM?2\350\326\023\022\220\251J'\373\347#w\206\375\260\356\220\375\242\337\300\203\374\255\003\371\t\334\307\317:\217_\300\177\377\n%\215\242\322\224J\317)\035R\351\245\322rJ?\301n\t\314\026\tZj=\021\024S\221\346\221\034\266\277\262exE7\036\004\204\311 :'#=J\260\020\210\b\032\026.\310\367\346^\2054rj\255\215\341I\272*\r\200\004\326\316p*\"\246(\370\302Z[\303\243\364@\231\351\262Z\233\303\237\350\234,\260\301E\300\332\035\316\204\304\022\005VZH\243-Q\302\265=\\I\222=\3521\2416\334\013\215\371\221A:w\206\377\rw\310\253\335&\252\373\210\312\335}\320\030 \031\264\217\344G:\037\207mD\221~\312\375\020\033,~dP\312Z\253\317:G\277\322\013\321\025\236\f\343\001\322\246\201\330\036\030\001;\031nc\215G\304\345f"
+	.string	"D\036qB"
+	.string	"\034\231\030\313\311\021e)\034\355\346&\027\243#h\263\033\005"
+	.ascii	"\256\271\251y\325\310b/\232\231\333X\343\021q4\235Qe\031\215"
+	.ascii	"\216h\263\331\320d\265\020\264\231\r\216l\314\211\271vp\264\020"
+	.ascii	"5\334\314u\253\2116\227\f\267\343\242q\340Q\207\206s\361\214"
+	.ascii	"#\316\265\372\325\207u\207,\367\301e\323\323\230\020\302Qk\302"
+	.ascii	"B\020\351g\201\354\353\250M\341Z\224\222\232\236\350\332\025"
+	.ascii	"\236E\207%\374\321c2\260s\351\316&A/\020H;L\250\021\020\025c"
+	.ascii	"\b\031Hf\202\2210\n\n\3226\360\002\0211\242c\0210\271DDF\351"
+	.ascii	"\314\001\030Q`\267_\334\017\265*C\224\232O\365Tj^\332Q\2209!"
+	.ascii	"u\036m\270\004\022\223\224\206x\210A\210O\b\200y\222\220\220"
+	.ascii	"\2749M}Jv\214\266\254\023\372l;\373Ef\325\004\246\240\3515\267"
+	.ascii	"\327Z\240\254\275\036\315\274\346\2356\323\032]c\240V\215bC\005"
+	.ascii	"\306\3252pXu\210\315\314q7\343]\323M\351\237\\\034\322\240\336"
+	.ascii	"\254zA\301Zsj\2233\025"
+	.text
+	.section	.gnu.lto_sdcardPoll.33.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`)\0075("
+	.string	":Fl\017Ep\336\321p\357`\216f2>\270\241\260\030\004P\203\251n\254\275`\b|\332\017\260\021\001l\372i1\031\200k\235\226\024\313\202Xn\3200\305\322%\306]\357\b\214\232\301\341\300S\260\300\233k\263M\366\336R&\031\346"
+	.string	"\315"
+	.string	"\357"
+	.string	"\017\213:\327\252\346J\305\241\n\036.\005GwI=\272\315\003H\217\252\037J\377\005\343\315\275\240l\243\344\272\327\356\213s-\320\211\322j]\327\256\027\373(0vuGy7\306\256n\0314\210\261\3037\257p\334h\3200\206\341Y\327f\260\213|\370\037\336\316G\227\303\251\267\024=\233\207\373\255\237N\256\3349&\245\376s\"\220\363\316\236\322L\216\233!\225'\020\315\0208\307B\002\341\035\026R\351\365\203}\254\256\363\361\234\031\262\207\017\306\235C<\262\254\371\2025Y=\260\220<X5\272\335\036\b\241\252zj\324%\247\030=\026\262\352\374\255\353\312K\316\340\363\004>Y\013\323\023\233aD\006\367\231"
+	.string	"\255\213\235\213\335\310\fiu\002\300\201\344\370\255s\215d\221\371\366`]\327\345c\222\352\013\364\335\023\330\335\017\273)3h\237`\214l\335\334g\247q\246\224\024\271mwA|\013\223\226\356\213\001\361\256\210&\376\221\373O\202\024[\352\277ZC\343\322\303\364=\002\314\215\f^\333]\341\257\f\325u]\227\366Un\305\304\376\310\321u:\301?\236H\217\276\0050\273\210\334\266"
+	.string	"\222J\324\350\254\234g\267Y\344^\356\276\333\332\332\332\266\211\354./0\345EJy\217P\336\002(\257\021\312\373[\336\242\223\327\367\260o\357\344\035Ry\205P\336 \034/\320\311\373s\362\362T\336\335\362\352n\2749\224\027\207\362\252'\357\r\345MS^\024\345=Q\336Fy\217"
+	.ascii	"\310\245\264b\036\233Ms\305\321\246g-C\307\222<\354DL\034\354"
+	.ascii	"\271\366b\253#\322rp\260O\211\021w\242`,\257\224\\v|\215\343"
+	.ascii	"\001`jv\344\"4y\035\246\264\240\306yQ2^A\202\333J\201\206O\216"
+	.ascii	"6\334\222\003\324>f\027\365g\377\351\036\234\2507?\235\304\354"
+	.ascii	"\202r3\342s\375\320+\3555\257w!D\330\020dJ\302\331D\255\341\265"
+	.ascii	"\2013\242\261&AR\310PIO!\335\365\205\200\235Mx\032\nf\273.b\362"
+	.ascii	"\306\264\216fh\335@{\251k\250\n/\033\222\351\332w\326\3453\226"
+	.ascii	"\325\353\207\375G\344<\233\353[\367\232\301L1\301u\256od;\327"
+	.ascii	"3\245j\343\372vf\n\313\302\315\224Q;x\326E\274\230\217\211\332"
+	.ascii	"\037Y\f\0312\244Go\215\304\254\022R\232\005\340\264w;x\340\037"
+	.ascii	"\367'\243\245\016\206I\375\2226N\230\344r,\037\033\n\270\352"
+	.ascii	"R\324\246\316\305~\033c<\314V\354\350\306\352\354\245\202\243"
+	.ascii	"}60\262\263\003\253TBiI\251i\304R\222\017\335\246\244\025\"R"
+	.ascii	"\244\b!lrr!$\021\342D\323\023\212\021A\026PB\027NP$\202*\234"
+	.ascii	"D\244\b6A\261\b&\035\330\247\025B\250`\213\247'\250"
+	.string	"\240\256I\374\2716\221e\236\202\337\353\032\330\2201n\331-8\322\002\373[W\347\350(SC#vq\221\032\330\377\351\345\333\352\212\252\310;\352{\235h\214\235\257\2644d\005\372\250\257\306\310f\324\277.\320\237RRd)&2\r\227\f\263\206Y\351Q\243.:\253\372\327\257\231\366_\317\211\2215\257\242iqQK\333\0255#\271\327\n\3176\334St\257\347\266h\231\255\234GE\313\263\252\245m\275\203\21625:\347\272\256\253O/\227s\276f\334>*\035\352\032\273@\016\352\241V[\250\027\250\367gl\2515\n\252\232P\373\226D\224QN]\200\212\250A4c!3E#\"R\320\024\024\322\001p\002\021\0314\333\021p\251C\016N\220\256\031\216\033\024\242rB\250k\242u\020\376\253\0308\337\324G-\004?\360\243Iv\"x\227\006\274\327h!E\026\202\265\220#\214O\311\025\"\261\375UH\256"
+	.string	"\354X\0226;e\321'\316\345u~\034\t\376\337\344\226\025\374\375\305e3\344+\324\264|Z(\337\201\274\256\230\236\225|\330g\210?\344D\272\220q\243Q_= g}\343\f\005\266\270f\272$\203\213\266\365z\355\312"
+	.string	"DK\021H\b\002\bV\200\335\223u\f\027\271A"
+	.ascii	"\034\343\226 b\212v\236S\360\375A\276\231\367\005\350\262\270"
+	.ascii	"\215\365\027w\214\271\030\006\331\216Q\223\261s&\375F\"\002\247"
+	.ascii	"U:\3665\322\376\224zyd\343\303-\256\200\232\322\027\263~'T2\350"
+	.ascii	"\251\355@U\222\016\223\324c\326\023\263\257\024t`\314'x,)0\240"
+	.ascii	"\027\342W\210\250=\213\254q\215\235z\027\235\327\246\302\306"
+	.ascii	"\235\301\374?\tsV\216\007f\355\370k\270\315\004G\365\365\202"
+	.ascii	"\325"
+	.text
+	.section	.gnu.lto_sdcardReadBlock.34.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`A\004\245\036"
+	.string	"\3068\311H\220\230Nc\372\307\020\247\026\371e\226\343\202*\3239\204bd(0!\f|0vA2\357\204S\342]1\314l\252\333 [/\212dD\321\020KH$\270"
+	.string	""
+	.string	"<a\205;_P\217\322\377?CDh\223\275\267\224)\005\264"
+	.string	"\247"
+	.string	"\266"
+	.string	"\317\362\221?\262t\254\024\247\2717G\333O\372\323\310\324F\215\247\326\033\361\255^d\351WJ\316\335\213\243Ky/\362\201w\322\237\007\216\203\3764o\203\376\264m\b\021\226,<\222\n\n\307b\210S\222.\367\"{V\307\205\327\345R\034z\232\266\n}\235\221\351\272\234]\2632e\306e\224\361\364e.j "
+	.string	"\342\202F\305\275\311\306Q\223AT\030\214\235\321\311\304!\233:{rE=\323\0307M\001Qa0b\214D3\001\331\324\331\316\250\242Z\223\001\032\023.;#\321\304\201\252*\336\353\265\205qX+N\302\275\327\265h|q\357n\233\207m%\333\224\t\267\272\245hn\227M\355\311\367\314\370\301\226v\253\233\215\034V{\264o\227\313\345\3226\207\355\352\232\264\232&W-\223\253\216I\253a\322j^Z\275s\265\356Z\177\356H\376\364X?\356W?\352j\323\325\026\200\002\253\250\033;\210X3\344\205Z\276\335\261\023\314\207\355\373K\256D\372\2273Da\271\027\211oY\300\361\254\213\204\275\004\311>W\322\267\034\340\370\026eu\357\335\375\364\225$\331\273\237\325\337Z\262w\366\315\214\244\226\2229s\211S]\216\322\2377O<f}\022$'"
+	.string	"\314\\bV\227P\372\323f\311ckS\036&\364\360\341\003\372\323Z\336Xe\262\205L\nW\245\336\260\202\240\366\350j6\370\275\316\301L\212\323\227up\031\373$c\237<\rV\025\231Z\225\323\036ooP\275h2\355\321\r\036c\357\365\233(\\\216\250U\021\203\2611\366W\234\276\360\354\316\302\330\257\3701\254K\373P\036E\311\357a\020>>\350O\2365\220\205\306L\365\225\276_}qg}\244\206\226\311W^\247%\366\365\024M\210\222M\355TmhJk!\252\263\265*K\013\261\266\371^\006\336\2110\275\367\356\370`o\022\302\357\361\323CD\365E\"\364\247\316\022\330q\325T\227\276\327u_B\312\002\276\022\276\t<\242\237\017\250\250\310\367K\203@!\241$ \324:B:;:?\240\235\034\002(\200A\",\350\374\313\031\34132\372\001\376\206L"
+	.string	"\203~\210~GE@=\244 \320\304P0\250'b\310g\324\373\005\221z9\013|4\002\030\354\2258:\n\366v\310\246\233\271\232\nY\254\222_\350\237\334\264O\266Mk\tMvh\336\0025gS\213\263\250\265)T\250/\326X\234e\022\033\026\351\312\331c\362\351\225\032\003*\215\365\271.`\250/\372"
+	.string	"\3212\371\\\326\3602\245\261\223m\350\320\323\203\376\244\261\271\253\033/\227\312\r\325\032\327u_F\32257%\233\032\017l\351\264\264)\260\364\311\255\005\312zN\250\201\034\306\020\202H\221\231H$\022\252 \351p\"\231c\327\001\021\240\271\206\013\265g\323I\203\002\0131\r\354>\203\216\242\371\352\357J\322\373<H\221\003/\2230o\031\263\016\260\261lB\220\303\360D20\367\f\2679n#r,2LN\021!s@\f\271qsZ*\335\263mI\220\331^ 9\2455\326\036\324\311\374\203 \024\324\203RZ\211\016\033\305@\024\035Y\232L\251\"!\004\274b\243\026u\034p\235\266\354\2671H\244\336(H\346?\301\260\201e\343("
+	.ascii	"\305\026QO\2540\r]2\177_\376\345!\"\266\316\250\243P\003"
+	.text
+	.section	.gnu.lto_sdcardBeginWriteBlocks.35.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\251\004- "
+	.string	"V9\320HpZN:3}FE\027\330\002z\fD2\376L\305[Z\235b\330Z\202&hw\324\3533\033\005\255\237\232\2022\247\375#5\214\320(\026-\r7\320\3646`|\275\302\006\r \2022\276#\326\266)\261\204\020\271\223\f\277"
+	.string	"\257"
+	.string	"\273"
+	.string	"5\312\356]N\340\240\365)3\363\235\274+\006/\241\313\254$"
+	.ascii	"'-\310(u\367.\203"
+	.string	"\n\356\243>E\017T\237v\220/\375\347\353\335\254<5E\333.\361e\374G\301Y\326e\007$j\352\2763\317\3408\367\3456\226\334\361\336\r\352\240N\211\323\331\240z\240\002\220bin\004j\312\256h\200#ST\316\006\345\003}@\326v\344\314/0\002\305\303\362\316Du\025\205`\245&\345K\"Q\237\265+\2703i\330t\325q\024%`\245&\225\223<\242\f\326\256\340|\311\031\266Q\bqV\350|\311#\352\223c\310\323\233\2678\222M\326\362*\334{\331>%\243\3168gf4f.bF\205\001A|\262S)\342o=\345\024F\366OF\352\323_\037\320\362b\262O~\363=g\022\266k\357\326\270\273k'w\346\205|p\331\235\271\366\216y\331d[\311\374~>\237On,f\236e\340j\231g\265\274\303\263\254\303\263\234\303\263\214\243Z\376}\371\367\356\365\257l\031\345Yn\325\262\035\320"
+	.ascii	"\316\212J+\255\335\2267\307s\315\375\222\232\021\341"
+	.string	"\207}\314\305\305\270\203\325\030\253\2567\223\260\312\324IIb\016s\301|0\030\207\302-5\267\344\336\353{\312\377\202\301\354{j\231c0\373\230\201X\226B\204\353S\340\230\005k\357\245\204\356\334\343UQ\220\224]\271i%\257\335]\374z;Z5YD\b\273\rh\375\316\236|\213Y]\333\352\274\355\241\257\243\035\213q\004\t\022\352S\333\277/\326\312\334\332\017\236m2\205\310\226\332J\266h\204\277y\020niHgK8O\333\340\3513\317\003E\311\232\034\230\264\225o\252\254(&\264\225\034\341;\375\346{\264\3201\345\300x\321\351\235\276\030d\233\234\306i\235>\r\256&\373d\276\331\317\224\370[\\B(T\237\346t\2027\036:\226?6$\332?\341t\211\037M-\203?\366^\230\027\261\257qI\312\354\344\236\245&\256\254\331\250\376\332\016\371\"s\264j\370MF\361*\306\365\336\033,\216\222\220."
+	.string	"\235"
+	.ascii	"\n\002\032\016\005\375\034xA$:\312\320\343\341\317\n\023FFB\342"
+	.ascii	"\260\250\005\221H\230b\210\244b(h,\022[\024\025\211\202GE&\214"
+	.ascii	"\202\303\2421\370\323\200\221V\020\213A\026HH\305\240o\311\364"
+	.ascii	"\306\342\027\251\302qc\277\244\236y\rNjH\247\372/\251h\333`f"
+	.ascii	"\264\271\002S7\241\367\336\373\263gs\275nS\302 D\240Ee\206m\355"
+	.ascii	"0\006\336\250|\252\342nT\327\354\031\027\246\0032\206\211\257"
+	.ascii	"\225\314\257b\252\270\nX`\363\3016p\260\177b\005G0\366\360.J"
+	.ascii	"j\347\362!\204\220\220\372\024\3307^=lnZO\026\032\260\367\234"
+	.ascii	"+\232\2732;\271\337\031\032\333o0\241\310z\017\\\250q\034\210"
+	.ascii	"\025\201\204h$\210\224\244\005\311\001\220\"\2312\365\021\260"
+	.ascii	"\275u\233\264\035L\021\206$\026\332\303\021\304\251\004\205\b"
+	.ascii	"k\021\207\242\213\365+Q3;\001\020\272\370B\177\206B\365D\307"
+	.ascii	"7\270\227\243b(\031\300\343\207\025$REs\223{t\220\331\263\347"
+	.ascii	"\306\3121\245X\037\264{\001\0208\013\345a\301U\221\023\024\234"
+	.ascii	"\326\2013B1\246\031\204Z\327\357;)!i\027\3174\225\032\264\035"
+	.ascii	"$el\"\356)\354\013\352\201F\317<\032\371\b\032B\206BM\016\027"
+	.ascii	"4~\214\254\f*\331l\231\b\374\210\334\215\311\204\016\261T\206"
+	.ascii	"\222\223\013E!\320\313\313\225c'Qsq\3033\227\024\222R\335\250"
+	.ascii	"O\257\002"
+	.text
+	.section	.gnu.lto_sdcardWriteBlock.36.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\221\004\375\037"
+	.string	"\006\372\316K\220\026R:\004\303E=a\264\301\360\231\201\307\"M\272\034z\026\223\371|\222\244}\200\246\005?C\007\277\337l\376\361\342\200\232\367 H{\2737\311\200\346\203\233<\214H\200\204\006s\336f\3748J\206c4B \214\020\262e\222\001\272"
+	.string	"\254"
+	.string	"\274"
+	.ascii	"\266'\037\333\317\342\027\177D\351X'\002\334\\`\326\215\240\""
+	.ascii	"jS\341\323\375\253[\3658\275W\007\032\327\275E\007\334\203\336"
+	.ascii	"df\276\221W)\361RY\214\022\002PA\246)\211\230{\213\267\003\327"
+	.ascii	"9o\226\267\2357m\217/}USt\3464K\333K|U\310\364U5Qh\375\310\216"
+	.ascii	"B\030O\251\234d4\032\3464\343\306#\240r\202\352\231\373h\374"
+	.ascii	",\027\f\275^\254\302\246R\007lG\227\033S\264\211>\275,\007\f"
+	.ascii	"\275^\324\b\201e\002\260\035]V!\212\266\345\2022'aV!\260\324"
+	.ascii	"i\001$x\344\233\205\360\327=\363\340\336\313\035\024\2728\327"
+	.ascii	"\316\314Ef\3561\227\024\0029\276\217\233\254\363\320\017z8o\326"
+	.ascii	",\001)+_'\371\310\253[D\320\262\264{fv\343\325'\311\260\333i"
+	.ascii	"\314\305_[\""
+	.string	"\363m2\231$\303\226\007s\332l[\233q\326\346\233\264\331&m\256I\233i\320\346\332\265\376\365H~\365X\177z\253\037U\233On6\323\346F\233/\300A\325\260\206T\031KV\274-\222c.\026\263+\b\237\311\271\220\276\305\027\206Z\206UG\212\340\221l\"\202\231\t\022\363\217IW\302\366\351\2567\371K\222\230\327\233\315W\242\304\2742\333~\030\265z\345\315\005\022m\354r\370\224\375$HJ\020\2417\003\275\f@m\023HA\371:\371\207\r\361\025A\243\374V(\353V\356\265\333\360\363s\336\274\255m\201\272\361?S8\316\274\334Nk'`\300\2063\0273\326\365uZ\"w\311\340G^\003Y\225\246-\333\3408v\005\216\275\3618XW`fb\246%\336\326\210r\301TZ\"3\370\215=\3629T\302\0341\023\373\262\2617\366cMej,\215\265\261O!\344\327I\346O9\225\036\337\007s"
+	.string	"\002:o\326X\003[\240"
+	.string	"4\237\253CP?Hc;\340\370Y&>\327U\255\257\255\243eD\270\316\314\036\205V\266eyw\326l\003\311\342\002l4>\222q\207\262C\357\275=\374\256?\t\270\0218\b\265\0179\234\220\221\021.\207\362tDDIB'\363\020\361\364\360\344\204zv\b\230\320\r\201\230\240rn'\004\356\350(H\227+\"\241\033\n\372\220\333\031\t\335\220x:\022E\274\241\033\210\"\334\321-\307C\272\355(\340]\b\035\3576b\267\343\335V\366\275T\3174\307\024\213\363_:M\273\202\231M\313\017|\366\307\345\275\367\256\bz\265\252M-j\231\227\256|\372\301\323\316X\246\246\031?\206\252%\032\217\216M\025\013\264\315\362\217\021$\364\203|"
+	.ascii	"x\344\t\317\322\013\273X\005\013\0300\330\324*\207\314=\363r"
+	.ascii	";\rKN\324\227\343\325\255+\364K\032\327\231YMJ\2140>Z\031rS\324"
+	.ascii	"\266=\325\225\\\250\201$\246\220\262\204J$\022\t\222Zr\200\""
+	.ascii	"\0313\255\003\021\020.v\222a;\263t\203\272\030\342o(\375\t]L"
+	.ascii	"t/QA\f\260\364\"\330\226k\226gl\020\003\240\203\350X\367\252"
+	.ascii	"\336I\032\206\332y\240\273\230\200\221F\222\352\212\001\324\275"
+	.ascii	"Y\033\177#h\210\345\330\030(\304{\035Q1\3634\276c_\030\323\234"
+	.ascii	"k\201\254\001\273\fw\204\242p\031\274\335\024\375<\352\\b\316"
+	.ascii	"7\320Q\255\350\373\221\004r\343\350(\201R\343\340\363\t\221G"
+	.ascii	"\033+}\354\243\277!\316\307\271\021\336\370\016l\036.\204\214"
+	.ascii	"\001\020\302gHe(\217+\002?\322g]-\3508l8\347\227\317)\036D\242"
+	.ascii	"r\243:\242\n"
+	.text
+	.section	.gnu.lto_blockDeviceMmapSdcardVTable.37.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375 \215\345\003"
+	.string	"\364\006L"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	"\005\001\212\001\202\200\200\374\342\303\336\265\005\177}\270\336\225\007{y\370\335\245\005wu\270\335\325\003sq"
+	.string	"?\202\210\200 om\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"'./src/main/drivers/block_device_mmap.c"
+	.string	"\004"
+	.string	"\200\224\230\244\230I\352"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_blockDeviceMmapOpen.38.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`x\t\3555"
+	.string	"Z_"
+	.string	"\025C`\350\325\030\233EHu8V\245\365-X\220\034\001\213#"
+	.string	"4n9\241\224\035\344\022\274y\213R\331t\254\205\206\3547T)\033\216\305\215[d6\220Rxb\265\247K\033o\270v\227P6)eJ)\005@\001(\001C\001\274R\261B\204\254W\35602\230}\275:\263\025\367\223}\303\267&\3463\226\353Wk\311\323\262\3636\367\276N\245^\331\330\016\317x\251R\205/\322\310\016\250\266\327\341Y\323;\233\213Uw\251b\336\373~\371!\321\366z\244\016\2614\27137Y\227Y\265\026\032-\364\276`d\314\274\257s\0013\265\275\262\263\213\330^\333\036b{efv"
+	.ascii	"\301\212\335v\212\355h%m\311/~\336\327I\374#\355\266\2200(\b"
+	.ascii	"\374\371z\274v\307\256\352\273\313}\325BLv\274 i\241\252\205"
+	.ascii	"\016 2iPW\007U\004W\350\3244t\331\245\0168\313J\322Q\226D\034"
+	.ascii	"\250*`\206qk\350"
+	.string	"RL\035\232S\305H?\207\370\317\347H\272\207\364\305\005\244y\273\n\317F\372\342\022\322\355\0077i\310\244_\\\315\336\251\304%\232\023!\236)jlC\227L\365\350}_\337\226\226\257*\323\224c\226\340V\226\312C\013\364\305\267\225tUE\220\254k\022\334B\252\003\374\\\235\351\264F\212\262l\372\253C\3151p\r]\006Q\025\300I\001\322\317\366\033[X\356\273\n\357\373\262+\267\270\232\207\315\334J\314|dn\267\004NL\352G\210\323r\364i?\261\202D[\277\310\333L\247\201h\337\367e\0161\302[\371?\301+\353\2578\300\033\264X\366\246\323\316\222 \325\017c\245\3567\232\265)\226yI\243\375\334j\232\215\327\270\2270\tN\343\255\3444l\257NF\031=\372\224\205\376`\334\245y\2155\360\314OQ\336\312~\020^Zi\3358\330\320@\035NJS\355i\260\006\036\312\254\016\322\3518\200\231"
+	.string	"dP\2403\243\220\362V\362\021\326_q?\333C\026\2474\372\372\037f'V\253\357\2071\267\372>\030s{\351&\362\234\225\222\220\272K\267Qk\3516\300\316E}\326L\304s\036\3429\017y\316B=g!\3179\250\347\034\3449\003Y\347_\353\354k\235{\2543\217unY\347\035\353\314\356\234\327\235\263\312:?\353\334\024 \304!\"D\t\233\237\343|wL\001\275o\3263N\272L\367Y\017\3534q\203\341Nc\337\320NS\217i2V]\006\206\3722\235\357\225\210\26792?\357\273\234\321\366\312{{\331Cl\213a\366\261\214\006\023L\232\256*H\207\333OK]'\334Kze\027\212+E\n\333+\201,F\317\315\247\373TQq\307\306\330^\203\342\204x\333\030\224;\332z\334+n\026\267\314-c{\005\3061\213\320xI\243\215\246\216\333\035\341\257\255\013\03247"
+	.string	"\310/\330\326L\202\002\326\f\376\336h\346\006\351tr\277\007\240\366\204\337\244fP\200\037\306\375l\245i\362\351C\372Nk\rv\002%\323\332\244'\372\033n\263\034K\364PfqH\247S\363\222F\211\276\202G\211S\304\353\207\324p\275\324\007\026\264\017\311\367\356\326\317n\345l\231\033\003\367\304\367a\355K||\361\350\021\233\020\031\322d\202\274\301\341\301P\337\367\253i\256\213O9\351\373\254\217\216\376\207\217\234\333\211\345\275\202^\320\275'6\263\205\013\336\312\244W\337\346_\261\321\367\276\223uqx_\024\307,n1\323\374\201\005O\033d\343\263\324P"
+	.string	"t\366\004\210\026\360\366\2311d@\272i\237\307\f\262\345\20125\301\343c\267\373\037\335"
+	.ascii	"_\237}\346\r\034\274\225\273?j\303~\247\211c\036}\352\274F\310"
+	.ascii	"1\214\3750^_}\277c\364\353\013\370\222\254c\356\320i\001/\236"
+	.ascii	"^8\241`!\325\242\305\323\324\2568C\312\311H\365\"\252\350\224"
+	.ascii	"\302\305\323\212\023A\305\031R.Tnp\242\001S\203((\246\245\002"
+	.ascii	"\305\251'\026\305\025R'Z\216Zj\36145U\242\030%\025\243h\242\204"
+	.ascii	"\212(\252\025PD\027\306b\f)\243\t\"\013\251\247)b\224\321\005"
+	.ascii	"q)\211\251Z\024\215\304\027TTF\242\317yl\365}0\016\362D\023v"
+	.ascii	"\273,\367|G\027\025=W8>\226\020\333+\215\n@s \256\r\2467\335"
+	.ascii	"\254\244k\303\006+\246\305t\357\315G\210<\257T\217\267\271A\253"
+	.ascii	"\330\0367\3341\261=l\206\234\253*\207;\346\255\224\340\314\356"
+	.ascii	"\226\313\303[9\364 \274\260\376\212\213\326\332e\331s\270\016"
+	.ascii	"\327\207\373\343\007\333+\221\330\236#\333\003g\320\314\206U"
+	.ascii	"\352\006\343J\267+(\366\276\307V\262\327p\033n\220!nW\027"
+	.string	"\353\026q\215x\333\3320\314\263\252\034\371_\224Q\241\037\376\352\246\025\005\313\247\254\364B\337\317&Z\373\351\264\023\260\300Wz\366$SMx\304\257\374\rz\341\277\\\262\256%~\320\257\201\264\352\266\004\221t W\t\240VF\201\037|\347\223\254#\276\321\003\377\345\264\260`\225\021\237\331\r\200\266\250Q8\005\031S\306D$\210$I\222\341\240\"\221*c\035\021\200\271CF#i\2450\254\001?\216\374\036\264.n\210\241$9N:\300w\317\264\202\n\322\300\035\330\0307\230\304cy\361\310\3301\360\354NE\323\222\355\001\021\320}\226\214\0332~\352\274EO{34)\323}\362\222\343_p\032N\352)\227\340\026\375\357\261\262Z'\241&A1\227\225\274u!\275\310\233\024\272c\303\300\365\256\262\304\007\007\020\002M\322\370\322D\001P\021\376\372\215R\232\237Q\257\243\327\324\273\215\351\330\257_+`\376\335"
+	.ascii	"\277\004\204\324:UU\352\320\363\202\243S(\307\235\233\324\211"
+	.ascii	"\335K\251\330\204IvFH\364{\276y A\207e$\321\331F\022:\377\204"
+	.ascii	"-\315V\223E\310\024r\223\250\002\207\341H\242\b~\316\272\333"
+	.ascii	"\024?B\337\002rp\371Y\341^\021<\263\006\274\252\266z\005\354"
+	.ascii	"S\361\222\333\332\017\310t\315\037\226\006\212\240/\274\206\340"
+	.ascii	"T&\340=\360\023R\361H\327N\020Y\343\021B@$\031\037\250B~\313"
+	.ascii	"\373\321~\266^>K\307V&\340\326\260\236G\334\276\221\316\211l"
+	.ascii	"\210\227\250\315\325X\235\362\351_Be\\\270.e\352M\3179\273\354"
+	.ascii	"\276/\250{\331M\371\335\236h\025\\\317\214\315\361\366\252\375"
+	.ascii	"\336;\373\016\351F\362j8\212p\232\013\272\341bV$\300N.\257\n"
+	.text
+	.section	.gnu.lto_blockDeviceMmapClose.39.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\341\002\305\023"
+	.string	"\366\241zH\320\362&\035\242\030}0a\274\305w\306\264\003pJ\322\213\357\013\251#\221\017L\232\211i\022\205\225\232v&\375\376\022\327\204a\323\030+->\202k\342\274\270B7\310Qm(\376\226\227Q`\355\356\303[B6\331R\246\024f"
+	.string	"]"
+	.string	"h"
+	.ascii	"$l_\3045v\217\357\202\346c \351(Q\3159];\3425\017A\371\305\325"
+	.ascii	"\032\377Fg\341r\266\207\tD\354\350\016\036\252\203NG%\200\034"
+	.ascii	"\210\177<\217QA\221US+\207\023\013\264\300\021\022\311\335t#"
+	.ascii	"I\017\214\250V.'6\210\"\362\271\321uC\356F\025\2040\347\264\342"
+	.ascii	"r;7\353\266q\266\035\330{\022Lf\222\377tOFz\036\2404\212\250"
+	.ascii	"g\306\232F~]\222x\334\324\312\376\321\221h\374!\307\310\350q"
+	.ascii	"\377|\031\371\357;\262Cg\243W6q\232USS\203\330;\233.\220\375"
+	.ascii	"8\367\307Vux5\030\325r\325_T\307U\257\252\365\352\233\274\367"
+	.ascii	"D\365Cv5'\207+!\363\351\243\021k\363H\317\004S\t\241%0\\\227"
+	.ascii	"\245pK|\310\005Jq\031\002\244\200\030\360\201\232\032\304\003"
+	.ascii	"T.\270v\313\013gm/\300o\245\213oY:\230\323\256j\352\013\240\361"
+	.ascii	"\346\311\270_\333BL\2173\202\234\265y7\356u\206\370,\256$\233"
+	.ascii	"\321h\362\337.\253\325\343\371\007\336-D\\ 3\270n-I\207\212\257"
+	.ascii	"0/\203\003~\241\300\264\314f,\260Wl\006\366\302\"{\321.\270\270"
+	.ascii	"bj\260\231X\355\305\205!\3262s\275j1.\224\005\246\301\300j.\r"
+	.ascii	"4Z\315%\262\233\337\237\225\243'\233\275\361\233nGx\016\031\216"
+	.ascii	"\003F)\322\226\360\033)-\2519\347\003\337\306\235&\370C\377L"
+	.ascii	"AEE\376#\020T\344\313$O{(\240B\224\327(9A\242\341\332+\025n\001"
+	.ascii	"A\250QLd\231\2521e\227\231b\003\240\002\021),\017\0208\247l\266"
+	.ascii	"0\035S\200\372V\027Rb\253\004\025\331\201W\216\236\314\331#g"
+	.ascii	"m\200\340\233\217\3572\326\315\366\231f\252\016\024!)h\033\343"
+	.ascii	"{\262<=:\2450>\3019\205\266\0170)\335A\353}\234\244_C\274&#\306"
+	.ascii	"\346\320SM\037\203\220\013\"\31207fb\001P\252$\022\257\0257\316"
+	.ascii	"\360\2476\245\212\021\2741\023\257T\224\276\ni<`\223A\315).\242"
+	.ascii	"U"
+	.text
+	.section	.gnu.lto_blockDeviceMmapSetTiming.40.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\225\n"
+	.string	"\326\023KC\020\3118\035\007x\216X\t\347\366R\320\301\356\n["
+	.string	"p3k\006\220Z\243fu\204\364w\272Q\374\257\177\260\371\034T\277K]\246\bla\201\n"
+	.string	"\260\002\006\212\202\343\377l_^sa\200\215\356o;\2454"
+	.string	"7"
+	.string	"9"
+	.string	"\240\315\253\317Cl\257\233?l\257.\355\007?_{\001\016Hf\"\354.\247\255\274<-\375\277\234c\266V\247\013\241\33555[(\267v\333\024\2663lW\b\006\030,\235`\237+\252\251\330\327\354\356Zs\331\217\375\264J X\020\016\3305\231QXY-\300b\373\035\333\341$tj\277\345.\345c\2527\354\272$\020\330=-\034\253\271\214\221@\306\322F\354\213\233\017\340\001D\037f\017\222\336$\267\327\210\027\204\003\227\021\001ax\301|\325\006\363\030\224\017sH\212\336|\365S\333\353\033\224\244\260\350\314TA\376h|@\237\216\004\362Ll\204\037\370]\240\274\220\343\316c\032\201\240\310\353\276\223W\022qtb\007\211#G\357\364\215%.\374F \327\215$\347\251\260h\362F\356C\024G\256s\3565\001\r"
+	.ascii	"/TB\231\320\006\016<.\206Ra\301`\\\007\376L<\320\f:.C\177\253"
+	.ascii	"\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_blockDeviceMmapGetImage.41.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"e\007"
+	.string	"B\21646Po\322\001\200~\001\250\215*\340S\371yqQ@ \332\305c_\016\305\255\241\326\267\373W\0301\221\\$\332\273\2319\242t\320,t\215G\250g \262\311\226)\005\266.\234L\226a.\013\363\\\032L\203\24590\304\216\274<\230\324\304\r\226\311\242%;\361\222`\215s\311\370\240i2Vs?\355+\351;\020\275\b\373!\237\233\277a\210\217\236;\364?\324\241>\001\r\n\221v\256,VY\354\031\322wa\177\332W\262\255\326g\240r\262\351v'\272\2265\201%\034\266Av\345{\374\003\344\255`f\220(\022\024\t\221\225\335\031=O@\035\006|\200:|\030\337\256\233\177\220O\035)#\334(t\005X\330]+7\"\335\357\266\021l+\330\256\b\b"
+	.ascii	"2\241K\037\030\332\020\240k\370n\304\320Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_blockDeviceMmapGetStats.42.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"E\007"
+	.string	"\302M36`m\322\001"
+	.string	"\247\267\337\0343%P\221\340j\361\276\013\016~w7\\\360\315\242\226\207\255q\2037\370/\023\257\005\bB\303\n\357\316c\335\312\326{Cd\223\275S\n\226\227M\006\3030\226\274:\226\006\303 g\303B\344P\253sQMt\2702X\224\224\023/\007\236\033\213\306\2079i\254\352~$\263\354\202\276\371\"\257\020>\307\241#2\367\355\320\317\250\303\004\013\320\223pu\261\216d\327\217{\031\366\247}\030\266+(\235L\224]\212\225\322\232\300\222\016\333\036\273\362?\016\342\261FP7D\001)\244\t\022\225\335\032]?@\035Z.@\035>\215kw\232\377\220O\036\243\321\026\372\334\001(\354\256\335\026\022\335\357\266\rl#\330\256\b\t"
+	.ascii	"2\003\302p\023a\241\013\001\272\206W#\232\026\202\020w\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_blockDeviceMmapResetStats.43.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"}\007"
+	.string	"2\21766`o\032\003pH\b\200\244\001\257P\270\370A\0206w&_\001p@y\b\031j\027\244\277\204\366\207\306d\263Z\251aB\""
+	.string	"\2522\343@8\f\307\356&eJ\001\2756\237\216\246q\260+\013a\036N\303\26590H\320\304B\331\364\310\207\254\243\311k\202\344\346\240\333\007\233\022b\333\246\324|w\346\261\264\340\221\032E\213Zp\300M\261\020\354\223?N\300\364\217\354\325%6\211\250C\\U\202\203\366\\\325\234\345\252\245\250\200\366Zp\021E\205*\034,\207/\355'\202\361\243u\346\377\033Km$\350X\231@\375\03210OU(#m\335\372\324\265\232vm\213?\323\215\312\3008q\371/#\210;\303\2566\211\003<\222\310\020@\341\177\241G\332p\243\333\032\264Mh+\022\006"
+	.ascii	"3\241e\037\330\034\314=t\031\032\\\346E;\311"
+	.text
+	.section	.gnu.lto_operationFails.part.0.55.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\261"
+	.string	"\005\013"
+	.string	"F\224JA \251*\035\370\202\001#\031\314\036h`\001\365^ptT4\001\002\317\031\271\211\203\f\205\037\372\344\327\262\214k-Y\331@\002\245D@\020"
+	.string	"H\200\340\317+\350e\344\350"
+	.string	"d\\^\263\204\020)S\n7"
+	.string	"6"
+	.string	"9"
+	.string	"\2667\037\312\344e1\026Ee\340b\366`N\231wnAN~u#}]\265*\276/\237q\300\340cA\201\226\306\025\363\215\302\231s\272\262qs\267\335`\373\263\377\005)\255\371\345+\nJ\032@\240M\215\240\013\363n\337\346\276l\253w\325\272\352w\031\004\027\327\234\254\232\204\331\301\035\030\261_\236l\213_\242l\313\271\233x\363\2352\034\266\035X\034\004\346zXa"
+	.string	"I\002\335\331\350\022\023\360\025\355\243\356\253\253\023,\\*\255\331\026\037`T\231s2\370"
+	.string	".#\371\"\347La\322\257\316\371\246\356\334\367\022r\022\0065\"O(\324\tAP)\374t @1\342\301#\215a\t4~<\t\220'\344\201#\311\323,X\024\205\2437!\212\243g\3716\367\205\321\237\354v1l\357\232\223Z\225w\027\026\024"
+	.string	"W\213\221\264\201s,0(\233P\207hY\205\004\004\303*\035\002\004\021\001Q0\314\025n;D\2363"
+	.string	"\316"
+	.ascii	"k\216\240\316\360\222\232\242\346\375\327\2261"
+	.text
+	.section	.gnu.lto_sdcardWriteBlock.part.0.63.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\017\006\325 "
+	.string	"\346\367\303I\240\330M:\300\007\211\236\234\370\332\200\211\017(D1\335\0177p\023\177a\303\001\005\364\235\302\223\302\217\370\276(\352D\331\t\003\241\325t\236\034\343QG\257\210\024\236\362\223\370<\035 \027\3311\243\331[#k\226\020\"wJ\001\254"
+	.string	"\246"
+	.string	"\255"
+	.ascii	"\017C\262mB\202\324\020\022\344\034k*\323\225\213\340\017\243"
+	.ascii	"\030<\222\036\310\017\2431BG\304\252b\005o"
+	.string	"\244\007\363{\374\013\351>H\f\250\251L_/~\2104\037\335\353\034\211UG\367\304[z\342\275N\327j\2251\246H\255D\235\223\356\241\235\264\317u$e\333\327\372\026\222\207#\021k\352\346\311\214\023XY\255\304\335\311\234\007(O\216\327\225'w\306\207\237\225\344\270\2246\364\223>\303yiN\2618I\241\246X|l\262M1\321\305M\231\030sj\255\017;=1\265D\351\315i3\007\265V_\211\352\256\335\266\320\366\221]\n\b\364P\035\312\223\337Z\227\022-\372a\317pcL\fY\245d\350^yi\037\353Z\3316j\235I}cR\333\230\3245&u\316\244\306\231\3244&\365\315\244\266\231\324\246I]3\251i&\365\254F]^\310O\036\310?\036\354\337\023\177jR\377@\002\033\271\252Z\243\212e*\f\322\210\r&^\320\340\310\300\234$\"V\324\245\210`\331*\253L\304\004\013\032\004\rT"
+	.string	"\300\351\207\023\223\261\333\367\215\\I\210'q\205*,U[G\022\264*\036\t\332FB\330/R\364!\336\025`e'}\"E\324\017;\262m\016\305\237\345mi\312\270x\267\305\211Qi\3316\314\225\233k\333\377\313\301\234C/\036\257<i\256\201,*\036\265\265\037\334\313\211\323\345c\021$\370\370@\201\"S\232\360-Zj\253#\266\203\266Y\316\034\226\330\241\310~\226\263\245\355&i\252Z\242E\333\024n\205\312\253X\270\200\001Cyr\266\271\254\256\233\022\035{ZkM\332\275\262\r,\313\005\372\312\302D\307\330\217r)@\237\2063h\320P\236,\367&F%"
+	.string	"\307\024\035\375\222;\356.\335\177Cis\370\241\207\362X[l\222\355\336\237\234\264Zk\217\337\344N|>\215\223\376u\b=\021=\b7\017\276\036\020\021Q\317G\023\376\204\204\214\200J\363\b\361\364\360\370\200zv\n\224\370\005}\3601\355\333\001\321\003\002\177~\276\241\021\277\240\037\017\276 \021\320\256H\370\0331$\f\332}\030\352\001w>a\321n\007\201\203 ~\302\235\210`P\270\263\331\246\037\353Z\321\274\350\340R\372\303R\267'l\353\326\016\224vi\266\037\313\033\251\023'j\270\203\246\240(n\226L\261Y(\372T\2636K\267\360\240N'\2156\325$!s\224\351,@\227p[\333\334\216f\206Z4\211V\3342\310\3522\3121&\206\354S~\206"
+	.string	"\026\030\234\022\256\327Z\353x\2264\373@\214f\311T\311\025\213\305\200\212\250a@\351\230B2\024D\nR\320d9\240\"\241\252\352\006\02105\204\314\246i\346\363\017\215\2253vEf\352\231\026\006\256{G4\020\210\277\250\321\230"
+	.ascii	"\361\370\250R|\220\372F3\034*\342A\221\205Y\323\3160>\275O\035"
+	.ascii	"0$\f\204R\315D\003\332s`\205\b\203D\274\315\323\311 7\371B\347"
+	.ascii	"\277U\376\306B\307\250\251PG\202\034t#?+\006\304\f<\236\365*"
+	.ascii	"\325\312\025\210\250\020\341D\267\373\264\r\307\216a\2056\254"
+	.ascii	"\344i\252\362\367\002\370\272\300\\\3625\265X\006\177?\325=<"
+	.ascii	"3\022\247\035U1\252\fa\245\252\207\352\264f\245\016\370.P\220"
+	.ascii	"\337ot\243\025\255M3\235\343\351\302(\033;\023\200&,\311\310"
+	.ascii	"\210\332>\004&\331\234\270\355\241\342\0354\344]\207\334\301"
+	.ascii	"\266s\225\033\263\200s*p\252\277\355\t\243\207\2773fZ#\312,\""
+	.ascii	"s]flk\321i\027\002v\374s`EM'\312\350\367\007"
+	.text
+	.section	.gnu.lto_sdcardReadBlock.part.0.65.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\352\002\225\025"
+	.string	"\206g\213I\300RRc\200\353\250\243m\331\231\322N?!\2645\323\2126\006\024\237\305's\"-t\036\234\0338!8BK\213\236E\024\304\r|\032WnbR\004\320G\260\006\276\004\260\213\030\325@\312\"\341\345F\227m\262\345\2262\245r"
+	.string	"}"
+	.string	"o"
+	.ascii	"\002\356\035\362\021+o}\226\274\037\355\306\363\002\375\214\360"
+	.ascii	"h\251\364\247\337\342F\275\037\355\334\272wD\321\351\336\223"
+	.ascii	"\301\255a\345\355\311K\310\333\361#\344\255}\026VY\341\375\330"
+	.ascii	"\266\312J\317\276\237D>\254\r+x\204U\367\236\257\333J\342\276"
+	.ascii	"W:\372|\372\003\302y}\361\007RL"
+	.string	"\tM-\001u8\035\360\221\305r\357u\351\341\266\267\355\3006\317\256\t\002>WVW\204}:a\373Q'8\247\004 Q\251H\305\3359\027\340\354k@\3023\344\211\332q\377\3511f\016\303\021\2009\376\002w&\027\b\352\200\302\331O3\366\235tg2\201\240\025\260\350\336\353\272\365\233t\324/\362l\227_\354\331.\342\022\311\007\342\322n\024\271;BU\270a\rIO\213\245W\032\326\230\210\334\035\244b\215\367\244\033\223\363r\270j\031\351\205\276\213#\365\236t\363\276p\034R\277\021\223\231&y[k\213B\005I\321jc\027BT\343?\252\357\310WZ\251P\003P\207^\331\246\235\306\256\274\367\302|\031\237\201\3017qk\333\215\376w\353\337\310\333\327\220\022F9\364\312/~B\020\212\036T\227\376\2405\350:~\274u\3106uy\342\317\272\322O^\370\333\237\377\330\242\256-j\332\242>\210\202\246"
+	.ascii	"\300{\0032\032\331\003\220\233)\233\275\274\310\3142G\253\325"
+	.ascii	"jf\244Sj)\260\024s\006C1\220\201\346\022\003\001\200M\024\031"
+	.ascii	"\031\fL\214f\332lh.\261\233\211{\231\275t9\232\215-\347\362\212"
+	.ascii	"\261\311`^fN\367BA`\234\f-\367\242\301\341r/\327\307[\207(\210"
+	.ascii	"!\221\376>\262\254=\266\313j\226\234\252\343Zk\320\366H\210\022"
+	.ascii	"Z+\253\222\325\326\261\372\024H\273\202\005\372\237\307\033T"
+	.ascii	"q\354; \300\"1\253y\263\304\030LX\250\333\"\322\034\317\264\006"
+	.ascii	"\272-\206w\342\252.I\262\007~\223\006V\023\372\2133\213x/\256"
+	.ascii	"\234\003P\030\344\335\021\3561\330C\002\224\272\343\227r\020"
+	.ascii	"U\016\220\323\312\001kZ\203K\207i/!nd\2018\331B\312.\001\273"
+	.ascii	"^\322]\001\201\261].zq\301\002:L\0333C\314\033,/<\007K\246\322"
+	.ascii	"=$#\360\352\230\033\2408\214\272@\322\003\027\275\377\332>\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\273\005%\030"
+	.string	"&\245\214K\320\362\250\003\310zT\355B\366Q\004\200\214p\004\253\2217J$6\200\254\021g\321\237\216\302Z\260\335\335n\377\037\\\341\003\230Mp\205\231\231\231\021\352\350\356\022D\207a$\355A\221UHL\325\033\324\374q\334BP\356&I\246\024w"
+	.string	"w"
+	.string	"w"
+	.string	"F\t>w\324\371\026\004\317HE\016\274\213\201\327)\3602\002>\340o\002\276\226\363\263\337\007\2608"
+	.ascii	"n\036v\263\371\034[\363(\326\3678K\363\232q\365JH\032\t\311\373"
+	.ascii	"\323\356>\346\307\343\361\250\373\023\213\2262O\2631#dJ#\367"
+	.ascii	"&\226\225\246i\n\3636\373b\316\256\213=I\322\231{M[Zd\252\252"
+	.ascii	"5\212\230\237\371FO\377|z\004\341>\3052s9#\2344\242\n\350\302"
+	.ascii	"\274a\356\232\352&\201\324\303tK\274\\\273\203\256\2068\241%"
+	.ascii	"\336+\211\267\326n%\027RW:\323\357\260\231*\212\030Dgz\207v\324"
+	.ascii	"\364\236\272#\276\203^\327\3604\031\336\207\341k.\374\215\205"
+	.ascii	"\307\251\360?\no3\341g$\374.\302\363:MSf\026\b\337\353\007*$"
+	.ascii	"\203p\360B6x\035\203Gw^f\301\307X\340\303X\005,\222\231\255\232"
+	.ascii	"\006\304\346%\251\030\351]iBW|CM\305]\352\265\2719l~:*\n\342"
+	.ascii	"\331\274\2649\320\264\271iDk\336\252\254\346&\361\322\3742\315"
+	.ascii	"K!\315\333\244y\023e))\3562\352f\356Z\233\235~\310\370\331\365"
+	.ascii	"\225\212\243\222l\346@s\346\245\260y\207\210\022D'2o\tc^\032"
+	.ascii	"y1\007\2321G\201j\037\317\322\020\214U+\302\326\327\260M\210"
+	.ascii	"QJ;\230_a\007\274\223\363\017C\017\350\351\034\212\335:\252|"
+	.ascii	"\b\341\235>+v\356\3050\330;=\266v\007\231\250\210|\247\277\212"
+	.ascii	"\335A\037#+\337\371\033\262:\321;\275el\346\001\244\262"
+	.string	"\2509\273)Ih\2659\275oN\334\351f\261\373\211H\310\251\207\363klK\005#\210c\006\347e\261\333\004\324\232\202\006\327@B\034\331`\2711\021\"+r\334\233\227\267\032\213\277\324\266<?-P\250\254\270+f\250q\020\310\343.\220\200\024\024$%5\034\260\002!*\252\007\021\200\020'\025B\242\023\212\0042\304\003\277DM\bV\317\325m?\3353\017\353\260\376\247j\327~\026\361$\333\200d0G\315\250AJ\006\314\340rp\361\317J\323\300\263\240\361V0\345\265\316E\217\235w\243\257\033y\320^oj4~>^J\333)Ck\353\337;\250z\373\370\256Z\f\031$JmL\220`l\206\"8[M1/\314\222\332\262I\177\017Q\206\035\227\366\243pnYK\260n\242\345\322\332\017\240@\350\221\266\266Um1[\3604Y\277\255iy2\234\002=\271\024R\365\203\337K\001]}p\f\227\375"
+	.ascii	"\304\3606G\327N\275*\313\212\023\246\221Fd@\374\001"
+	.text
+	.section	.gnu.lto_.refs.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\255\001\335\f"
+	.string	"&\343W/`I\223t\020xA"
+	.string	" \002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\255\032\006\367\242\246\354P\240\001\322\206\327\337\276\337\376O\263\255\365\332\337\304\310od\267-SF"
+	.string	"F"
+	.string	"K"
+	.ascii	"\317\262\253\374\313\031\317\r\352\224\247O\234\036a\017qz\364"
+	.ascii	"\374\343|b=\346\213\304j\255\350\267n:\303\036\261\037\236X\316"
+	.ascii	"\325\025"
+	.string	"\353\331\352j\215\300\357\216\351\t\332\017\364+\352%\330#\370\317\362\213{\325_\177\017\002\021v\203}\204\035\302g\252#ZI\215P\035[\310\335\334#\260+\374\241f\034\035\035\177\354\306\002\340\316\373\005{\266\374\272g\260#\0361?\254G\220_\311w\310o\310o\371\013\371\222|)\337\221\377\344;\313+2CZ\217\332CK\317\351\327\364\252\375-\013h~8\245\250\031\366\302\262\304\376\341t\306\204\231!{cO\301>\301\006\324#\350\241\247;\317\n\354\013_9\001\240\037\354\035&a\236\262K\331\033\331\243\354Pv'\373\"{\223\235\231\0323\3678\351\244K\334\007\271\350$\327\234\342*\315\344\026G9\306\025@\207~x\004\332\320\217u\300}\005\274\247\340\350OX}\tN?\002\204\353\016\2567\270\316\340\372\202\251?,]A\353\006\332K\332K\255;\3323\332\257V\006\306\223\353\222\353\221\251\001\024"
+	.string	"\251\340\205\005\263q#?\201\033Q\335FX\233\240-\345\260n\004\335\265\002\001\313\254\227\205\365\t\021/\213\263\260\313Y\233Y+\266d-3\312\030\263"
+	.ascii	"\265\216\373!\214\024"
+	.text
+	.section	.gnu.lto_.decls.91491f9cfdf1120f,"e",@progbits
+	.string	"(\265/\375`\312=\365\371"
+	.ascii	"\312q\351QW JQ:\215\001>\321\203&\306\241r\033?<\362\177\026"
+	.ascii	"VU}\210k\366p\200\347R\307\314\317\361s\356P"
+	.string	"=#\241\372\276k\247\337\005\213\307\250\203f\021 (Z\212\252\244M\233\266i\222$\245\250k\272E\373\255\2521\313\"(\203\222\206KF,\ni[J)Sd\004\023\0058\005.\336~\\\033\277Q\347R\263\367\331\336\273\202\033<\2644\273\233/\215\013\005\206\f\315\311\315\367\3512\225X\2711\2715\236\213T\331\340d\r)Jn\2763\254\232\315\237\230\266\344\315W\206\245\253\361r\345\267o\376\236U\003\3161\365\211\271\371\230M\037\237\351c/}|\245/\260\033\200\367E\260\213\n\222\024d\333\037\022\277\030\306$9\343\213\263}J\216\256\321\205q\221n\214\353\342&Y\347}q\223\277D\267\350\276\270\373\310r\003\375\004Fr*'\333\n0\223>\366\323\277{\372\367\212\376\245\323\277r\372W\211\230h\320\f\356j\355f\033\275\026\214\rs\033\265_j\212l4\357\235\264\026\203\033k1H\337z$\215"
+	.string	"\363/\333\236\236\217\251\261 7_\231[Bm\236\305\263^l\027\313\305:\255\236\325r\273\305\336\025\355\275o\231X\244\330]YZ'U\260\b\2612eYB\317f\261j7E\314\f\242\310p\032\333\233\271\301\207\rh\224Q\27317\331~\270K\372\367H\377\"\365\355\236\276\345\242o\253\350[\031\364og\250\3030\320\274(a\236\32501\361\250\242B\2276\237x\231\273\371\267t\317['%\211\350f+\305\316Y\247\005v\312=\370\340\030Yd\237\331\214!\033\303\247D\337Z"
+	.string	"\264\177\326\202(\026N\314\b\030\264\233_\202\211]rV\006e\036\261J\354S\253\001qh\320\275\233\267B\210X\265\033\231\275\255\330\332,\234u\263Kn\322\275\253\316\226{3wn\341\354\232U\253"
+	.string	"io+*\034*{GpD\367f\312Y\031\354\023\033g\241X\247\205\263Mn\235\330\267g\346\336H\366\336\033|\270\271\322\226DU\223\355\266\034\2009\366I\3372\355\313\303\217\315\310\315\267[[$6\211u\202\2601\334\262\331\266\247I&\223I\343F\3056\343\346\277\240oA"
+	.string	"\361\337\237\005\001\274Q\347X\016\300\333\243m\021k\304:C\330\264\333!\226y\231\"\346n\356\315\304\221\261\323\233Z\273\371\032\3205<\377)\240\262?x\215\276\r\001\304\261!\200\277\372\002\313\001\230\237\226\003\360\267h\2775\263g!\360QR\325^\333\233\251c\023\306\216h\354\3463-\007\240\266\033\2004w~\035~\314\327\324\377\365\354.\333o\363\231\227\002\374\030\313\177(\236\n\376\271\304Z\036\241\223\377<\200\020\210\3402\177\266\340\003i\377E:\377\334.\303Mj\376w5\362_\031@\277\245\"r\261\376\353\343\267\177 6`d\300\237q\376\253\301\177\r\360\337\020\377-\300\1779\270\026\344\f\374\266\313%\200=\323\263\322\024\362\337\202\037#\177\313w\005 s\207\364\205\261\023X\n~\313\341\242\205\370q\323o\t\360\333\016\f\360[\r~\273\301o\013\360\333\020\277\005q"
+	.string	"\254\344\277#\374\367\204\377F\340\277\017\370/\004\376\233\302\177K\370/\n\377%\341\277\022\370\357\004\376\253\302=qK\334\035\021\376|e\315\376\247?N\201\206\f\354N\003p=j\\\020~\301\217\321f\362@\374\346\307\302\343\235\312\377)\025\260@\301\217G\200\371\372\023\003\200\270"
+	.ascii	"~L\303\002\257\320\017\270\377q\367+\311\271\204]\006\374\327"
+	.ascii	"\240\201g\360c\031~\273\025\302\262\205.\232\037w\340\267b\027"
+	.ascii	"\003\033\274\\\267\371\261\324\335\372\357\nZ \376\273\3433?"
+	.ascii	"F\361_\356\376\030\001\377\315\372/\216\377\316\370\257\322\177"
+	.ascii	"\223\377\005\301\177\207\376\333\201\377\252\370\357\005\376"
+	.ascii	"\313\302\177+\360\337\003\374w\202\377z\370\257\316\177o\376"
+	.ascii	"\033\374\257\375\355\337o\373~\353\367[\275\337z\371\255\226"
+	.ascii	"\337b\371\255\225\337\316\3756\356\267p\277M\362\333\030~\333"
+	.ascii	"\366\333\265\337\246\375\266\371\333\"\277e\376v\354\267@~\373"
+	.ascii	"\365[\257\337v\375\226\353\267Y\277\255\372-\325o\245~k\343\267"
+	.ascii	"O\377\335~\253\374\017\346\267\034\374v\351\267H\277\255\300"
+	.ascii	"o\225~\033\343\2670~[\301o=\374\366\305o\213\376\247\331\020"
+	.ascii	"\374V\004\277\375"
+	.string	"\300o=\370\277\302ow~K\342\267#~+\342\2675\377\303\374\367\362\277\356\377\363?\335\331\177\026\376C\371\037\200\277\277\277\277\277&\3772=~\rd\002c\232\271\231\026\240\204R\216\311|\201]%\355\351\016a\300\3000\020\022h\317\260c 6j\263\347|\n\251\3236Z<\326\211\2770S\b\346F\342017\007\227\211\242;\034\371\300K\037\330\313n\245\024\245ub\257\224J\230\2176\247\266a\3439\356\352\3322d\332C\230\226\026\346\022\253\332:\346\312uC\354\256\310\360\320\034rXY\341,=\236=\345\214\020\377\367\216\2630\026\360\316\355O\013\306\322!\303s\357a%s\347.@\220\250n\276\262M\272\234X\244\334|\231(m3\205\347\270\312:q\225\215~\330\310<\022_\313$]\323\307\203oXL\345\304T\226\356C\017\246\314\013}k\351\2006S<\226\314b)\353\304R\270)=\222"
+	.ascii	"4\n\365\3236Nx\216m8\261\r\253\366\200\235t\"\300W\225\222\311"
+	.ascii	"\3015\027\335a\211\007;a\031\3073\234x\006~\262&\3446\224\262"
+	.ascii	"\306\361\223\315\214\"(m7c\032v\206\277\346\3372\215%fR\336\364"
+	.ascii	"\201;\251\334{;\245\314\255$\252\271M\255\215\3056\203\215\377"
+	.ascii	"k0\201\275\223H\226^4\230\222\244\324\315\373\351Sy\324\264B"
+	.ascii	"6\300\252\251\310\352\351\250i"
+	.string	"\265\221E>\220:\312m\205<j\356\255\263\213\212\220$Tm\235\243\346n\332.\2504\331\315\264B\356\242\252\255\263\213v\362\202\243\"\253\246\243f\262I\347\250i\325\264\233V;g\027%\225HE[\251\263\233Vy\273Y\325\224s\324\254j:jZi\331-HWb\234\324\226XK\026yT\264\227\224n$\2259\317#f\325\276\262\267]{\261\225\031\354}\243Jy%\371d\335\210\236KDH\222U\226\271\367\236@\211\350\252j\027=\217\302\252\366\016#b\261\225L \231\317\275e\237H\0357v\322\213\275)P\332\033i\367s\357\215\334{\007\2257\230{G\345\034-\225\224\366\206\372\240\264o \227\274\330\373\256eqk:j^U\355,Ik.\267\021\023i\227\373\212\225R7\221Dv\222\236^6\311\350r3V\372x#\253q\363u\225\276Z\330d\350\270\371\006\013\317\261\222ub\245\333\365"
+	.ascii	"\346F\326\200A\353\346\242\332)\t\303P\203\303\262\272\331\006"
+	.ascii	"\214\347\370\310:\361\021\206\221\036m\020\313\272\271\270\255"
+	.ascii	"Tr\200\221>h-_\352\306\374\351\007\303\340\0277L\214\330\240"
+	.ascii	"t\321?v\201\213p\314fdu\311,\341\003B\343f\214\304\311c\"\274"
+	.ascii	"7&2Q\265w\022\023\341\364\355\235\304\261\026\003k1\310eW^m\300"
+	.ascii	"\374\340\335\337\035C\004\304I\336\315~\314\0178\212\310Z\030"
+	.ascii	"9\375\337><\022xOn\276Jr\225\314x\3553\2645>\252\350Z\333E\342"
+	.ascii	"\366\007=\233r\351\202G\342\326\330\264\204D\271sr\027J\331\025"
+	.ascii	"(\225;\203\220(x7\356o\366\271F\302\217"
+	.string	",\320*\327\312\rRgo\035;WvD\371\250\242\027\357\252\335f\362\207\t\260\261\273+\346B/\230\033\346\362].w\313\325\273{\367\313\215^/\267\313\315\263\316\213w\261\374f\271Z\334.\023\257\033\206w\201\\\263\n\210\216\366v\342\021\203\342\243\212\236\341\335&W\206`\2175>*\031\271\270,e\027d\031\253\fZ\351\007\245\354\322\254.\254\0302\364\203Iu\370\210\021e0\251\017\f\363\254A\303\241,\203\352\003\257H\271KIaSO}\240\334}\202\2410\236\214-\321\007\266\351\003\215\350\353\344\276Y\347\241\\\270'@I\026\233\231\376\b\354\241"
+	.string	"\017\004[\202#%K\213\013\036\372\300\253\030\202Y\332\216\234<\351\003\223\216\230\350\"\202u\363\201H\375\024\214~\212\247\317L\255\350\273\225\030r\211T@t\364\2001-\350uZ\347m\336\"\037\232W\310-\263O(\346v\242\301\212\323\022$\372a\003\253\304\263!\007\314O\2554\363\300\245\255\030G7?\265\241\237:\351\2470\364\323\244\3763\310-\253\251\362\220\241T[\230n\276bw\314:\037\345\222\275\006\r\306\036\024\250\036\301\376\243"
+	.string	"-\333\316o\220\r@%\024s\343`7\270\027}7?O\321\207\332\r\300G\3112"
+	.ascii	"!\202\374\001B\02759r\366%\005d.\021\223\344\346\032\251\221"
+	.ascii	"'eI\257w\325\330\310\203\342b*\255\232}\256\355d\023\b`nus\321"
+	.ascii	"\022V6j\237P\033\231G\200\257g\335\\\364\372\270;.\327\345q\263"
+	.ascii	"\356\326\325\272=\254\363\352\352\370\207\022T\226\316\310H\024"
+	.ascii	"\364\254\353:\335)\020^(ej\020IA\231U\027\n\023Qj%DP\320\017"
+	.ascii	"<\370\340v\335\0346\212\231\313`\332\025\023\264\351\006\216"
+	.ascii	"\234]te\343.\335\256\313\264\233J<\353\3466\300i\202\027\325"
+	.ascii	"C\202\214Id/\375\254\245\237\251\364\263\f\375\234to\330\265"
+	.ascii	" 2\232X\364\255\363J\335\250\033'\001S\032\207\310\2301i\262"
+	.ascii	"\216l)\005}~\245\310\247\311703\264/7\247\373wW\212z\022\303"
+	.ascii	"\315\371\017\033%\235\305!5<i\234,0\317a\300\344\276\022m^ec"
+	.ascii	"3x^\212\260\370\236\373\202G\342\246\210\371]\315\031\021\016"
+	.ascii	"\250\350\263\234\223\221\227\033\024\246+\027nv:G\251\367\353"
+	.ascii	"\345\275\017U\310\274\035\262,>\204D\323/vO\252xy\336\303\221"
+	.ascii	"\302j*b\3239|W\236\263\\\311y8P{'m\\\264\251\374\2264Db\020\241"
+	.ascii	"\273{\316{\206\216\005\261K\336\234\361n\240\2440\201r\311u`"
+	.ascii	"XM\261\233\337A\221\032MM7\347-awIy7g-\177\253\201\262\022\335"
+	.ascii	"\201\245\210\326!\213{\216\022\227\355p]\315F\026\331L\301#e"
+	.ascii	"<\202D\367\021T\210\233\030xVXw\312\263\335s\025\017>\370\235"
+	.ascii	"1+-\355\346<\303\355\226^\332\021\225\\\367\265\005\311\230+"
+	.ascii	"\235\351:\230\022\223\243\357\251E\245\007\220\233\257\375\033"
+	.ascii	"0\317\375N\211\t\220\251\233\263\224\343!!\242u\003\033\341\271"
+	.ascii	"\253:\242\233\363\223g(L\250\260\254\244\344~\231`\233\235\324"
+	.ascii	"\362\346\353\324\320\327a\322:;\340\3400\227\315"
+	.string	"a\022m\031\203\342D\0311\313\362\323:R<M\336$;\261E6\023P\355\307\016eto\250\0203IoNv8\261j8\213\330\323KN\343\320\360q\353\314>\362\022\023{\317\031\035Qr<nv\263\201\001\r\343;\242_\202yB.\006\\ti,\223]\021\222\207<\201\256\201\3450-\313\253 X\226gYL\312\362\nH\016\313\002\375\312?\356\232y-#\311l\371H\216!\247\345\266\354\314I\262\022\353\314j\231\310\263W^\376\303RY6\233\262D\313fQ\322\324r\221l\004\004x1\340h\232e\373\353\203\221\254\f\003j\224d\210~\316\227~\316\326\020 8W\252\260\222n~\316\r\375\034\245~\3166\343\312\315-a\374\360\310\236f\264 1q\002E\314+\263\331\320b\323\307A\013\233K\235\214\300]u\375\200\323PTr2\334|\034+\2352\343p\2144N\226\272uf\251\334%\223"
+	.ascii	"1\345\r\016j\234\314\200\356\335\314\303\016qK\332\212\352\333"
+	.ascii	"3\035\031\213\251\016\t\212#W\005\371\343\312;\362V\316\262\316"
+	.ascii	"\254\225\257~\227\362\215\251Lu\305\363\205\374\362%\232\265"
+	.ascii	"r\216l\005\304\243\373\362%\2123\203\307\227\326\f\226^\276\021"
+	.ascii	"\306\317\310M\377\206\210\325\230\b]\222\260\316\252\372h\212"
+	.ascii	"\340\216\200\371\241\377L\205\231Q\200\314\335\344\320w\337\270"
+	.ascii	"\320:S\262\215\034\225m`\257\005(9\222q1\303\322\251E\353\330"
+	.ascii	"\311\220\221\237n\fw|\320\ru#\0040K\227.zO\271F\225%6+5h\\\037"
+	.ascii	"Q\312\242\031\030\351:\021Rel\206\325b\267p\201[\322D\353\200"
+	.ascii	"Q>+s\223\206\275\323\222p\201\342,\341\302\265\345\346\334d\351"
+	.ascii	"f\232E\350\224fZ\003\021\022R^\232@\312\006*\265\210\324)=/1"
+	.ascii	"!\362\275\234t\245F^\222\234\224c \351X\273\342\247\227r\214"
+	.ascii	"M\3110n2\3752\323\223\263\322\032\2662Q&\312F\034\314\252h| "
+	.ascii	"\3510\273/\236\215\262\032\r7\243\233\263\013\354B\357\350r\267"
+	.ascii	"ts.\262Y\3226N<\"lFf\344\337\262\322\323\346\205\326`\365\367"
+	.ascii	"\207\275&\220\341\t\025\"-\222\267W\225\367\005\373}\301}\033"
+	.ascii	"\352\300`?0\270o\347I\311w\334g\24370f\350\213\272\031\213\t"
+	.ascii	"\023\245\323\257i\273\303^\356\260\236\2060\\\260\027.X\317n"
+	.ascii	"%\016\267.\307zNH\276$o\306yRb\\.n\306PK\247\266\026\365w3\306"
+	.ascii	"\273Sx\307H\016\251!\323\257\311\241;\324\361h\271\026\314e\367"
+	.ascii	"6\261\244F\251m\214x\216\261`\351\341V\363BK`\344\371\304VB\260"
+	.ascii	"\254\233\033\263;\266\302\204\026\267\274\031W\271P)\227\272"
+	.ascii	")\256\233\361\f3\310,p8n\306ub\310\266\266n\306T\356\324\315"
+	.ascii	"\324\334\220\347\315\230\216&Os\210\362\344\t\236\313\331DU\360"
+	.ascii	"\226R\216\347t\225.vi7\343(V\355>\233fT\335\214\241<u\0075\236"
+	.ascii	"8,\027\207\271\356\256\332{\031T\303\032\203\266i\016]L\230`"
+	.ascii	"8\022S\236o\307po5L|FN\254Z\230Y\031\333\315\270\211\245S\372"
+	.ascii	"J\252\321\230i\033!<\307nnV-3w\323\214\327\223\246K\037\t\216"
+	.ascii	"\001\t\036\003\356m\231ULJ\017[Ip\fI\360\230\335J\022dL\232)"
+	.ascii	"}\032#\335AJ[\033\3662\321\004\332EK\240cm\r\217\345\3554\315"
+	.ascii	"X\32180x\216\323\322\254Z\346\261t\3237\177<\307\315\246U\263"
+	.ascii	"J\335v\305\005=\3237^x\216\213\024\001\242\234\371\322\033\312"
+	.ascii	"\312\3120\323\013\006R\312\272\271(>;f\342!4b\226t!o\306Bn\262"
+	.ascii	",\351K\263\201\321\260\231U\223\251\213\312be&\251=P\211]\f\007"
+	.ascii	")\370\030K\330`\023$\376\370\240\240\242Ps\026\"~Vc\217\n\016"
+	.ascii	"F\242PP>\013\021*R\342:\3541\016\035W\0252\271\307\330B\0052"
+	.ascii	"\016\201\200F\250-T\r\204\206@\306!\237U-\032\207z\322\225\250"
+	.ascii	"\236\205\210\025\306\342qU;\374\374\f\031\215A\306\340\013AG"
+	.ascii	"\026k\2201\250bH\374\311-\204z\200\210@@\325\307\030\324CL\241"
+	.ascii	"\305\360\207\350\243s\026\"\200\210\253\332B\r:\366\024\201\200"
+	.ascii	"\353\n"
+	.string	"\032U\250\302\246\030|\241\206\206\210\263A\207F(\307\004\n\326\263\020Q\301\0133\252P\275\371\371\t\022\312G\231\0249\304\237\024C\026.\260\002"
+	.string	"T\242\005&PQX\211'xX\211+|0\022\205(\340cB\220\250\006\375\214 4\004JA\002\234\234\034\231\3658\\W\220 \207\203J\\[\210p\263\032\207\202F\270!!b=\016\205D\250\034Z\374\224 \301\317O\220\n3D\013\250\035V\030\210\023\3300C\024\252C\036Tcq\005QE\241\246\205\317\220h\201c\220\tkq\210\001\235\025\310B-\032\213&tPQ\374\024W#\212c\220\t-\324!\021lV\342\t9&\020W\f\201\212\351\n\255\252\304\243\217\217\003n\210C\306\342j\f\032A\005\342\212\241\n\037\336S<\022\215\304\025\372&Ntp\002\004\030\202\007!\004\022!\220"
+	.string	"\036\204\020vvB8\261\243\177b\007\2576k\272\n\201\307!\213\236\274\236\205\210\235u\270\252\331\005\242\2170\030d,\neZ0\026\177\214\302U\325\253P\250\211>A@CC\253P\030\364)\256\020\256*\220\204\317PH(\004\256Ba\320\005\242\317Q\205\212 \2410(\244!z\240\250\266\260\032{Z\370I!\024\316\250\302U\225\001*\256C\341\252\002\tWU\270\366\f\035Wu\204J\024j\261\216P\327b\212\021C\306\025\035\3000d,\376t`\342\204\360\004\b0\214 \372\f\375\364\030\213#\216\352\320\b\005\364\020\205T\275\n\211@\305U(\324=DU\350\302\n\354!\252F\241\013k\020\250\270\366\bW5\270\nW\030\203~T\241\332B\025\nu|\210.\034\211*\361(\354IQ\374Y!\024\346\274g\205\261\350c$\n\005}\210@\031\030\210>F\024f\216D\025*\206R"
+	.string	"{\204#\214\020$\314\200(4\006\025\327\341\221(D\001\021|\216\303\036\037\265\203\036\256C\022Z\350\031\246\370\371\031\256\016 \256\304\037!\240\240\236\032\025\305\221\270\252p@\013u(\005\215*\\a,\002\025Y\330\240\242"
+	.string	"\252(\326\"\220j\034\036\327\031\025EPEQ\243\242\020\nZU\240\212\"\330\342Ht\241\004\231\237\240 \021\204\351Y\200P\205\352:\\W A\203\3523$\036\323\027\200*q-\0361P\\\177\206\200hT\242:<\022\201*\3618\364S\034\252\320\3521\350x,\001hx\\\021t\024\262Y\205 \004\317B\004"
+	.ascii	"\036$D<\216X\203\202\216#hTa\213\343J\004\n\"\236\300B\035\376"
+	.ascii	"\250\300Q\203+\034\211*\2507\253\360\304\016q\305PH\037\203\326"
+	.ascii	"\036\242:\263\n=(\261\032\213C\372;*vN\354\364\2448!\302\202"
+	.ascii	"' \001#\\\200b\002'\350\036\021BC  !\261\247\350\002\321G\330"
+	.ascii	"BO\320O\212\021\352\221\350B\361\3503\302X\034\002\215\3509\252"
+	.ascii	"#D\030\200\350\201\342\n?\3035h\225i\303Vr\336\226\034Olk4\300"
+	.ascii	"\374\270\271F\213W^\230Z\356{Z\223\341\"MK\223lV~\316T\311b\341"
+	.ascii	"\023\262\324\314{5gE\276P\031\231\201\343\314\332b\245H\212\343"
+	.ascii	"nL\233\024\2214K\316M\313\227\2339(\323!)3\035\202\275vH\201"
+	.ascii	"Fi\0165\320R!h\037\330\033\222\316R\263\272\267\255%\023\t\360"
+	.ascii	"\013\232\337\223\354i\331s\225.5rH\335\234\212\245cb\3136,\316"
+	.ascii	"\337q\001\333\302D\310\315)\2204\210\326\222\255\311\315\207"
+	.ascii	"*\243a\321,av\301%3\276,\260\234\367\034\362\267\225\376\300"
+	.ascii	"M]?\332\310nN}\244^\326\371\267t\231\245m\312\336\315\337P\244"
+	.ascii	"a\bzxK\273\322\036i\027\036\323\310\017\3344\200\321\177\312"
+	.ascii	"\0033\311Puu\371qY56.\317\030[\331\t\022\025\027\276\233\231"
+	.ascii	"M\t\240\304\226n\316\231\222\343Os\244Y\034x\"\34646\026\225"
+	.ascii	"1w\3654\353)\226_\223R\026\035\251\025v\201\263\034\003\205q"
+	.ascii	"\363i\254\224\226\246\242\350\234!i\215\247Pi\215\024\307\020"
+	.ascii	"\027\230\023\033gFj7\236\342xJ\365\001\322\027\347T\256k\262"
+	.ascii	"\004\254J*\365\267`\022:\027an\376^\032\025\005I\364(*\265\021"
+	.ascii	"W\265\304\221\332\270X\202v{`\236\272t\016\026\323\323&\246t"
+	.ascii	"\306o\314<E\371\020rmPY\352\223\361t\306[f\032\r1\2739uRZi\034"
+	.string	":\236\242\247/\322\242T\311*\211\362*\213\006\215\346\274\260$=U\372\371\274\310\246\334\234\306\370\335\234\225S\227\233S\030\330\350F\232\200m\2719E\372\333]\030\217&7\247G\177\243\252\232[rsj\3647\250\036X\330eb\1770\233\034\2719u\241!\205C\250\263S\333H\254m1\346\034\232\021\231\2216I\007\203\024@@HP$ N\210Y\037\023@\022\350\343\231\034'\035B\016\311\214\210\210(H\222T\262\034V\214\2536\211\n\341`Y\022\311\317\314u\313\200Z\365!\305\361\246\232\320\203f\364\336n\221\022j!Oy\235b&6m-S\354\240W4c\031\204\200&\235b\243\311\355q s\261oR\364/q\274\217\021\232#\354d$ \034*\325,\360J\034\303S\200\341s\252\352\313\275\317\242\t\202\304\222\377@\365\332!\f\221\223\244\316\"\202\205f9\225X\034\300l\331\261t\267\270\333"
+	.string	"\017\265;QIg\362\334:\252\335\356\f8\b\027#\006\346\325a0m}\277<?/\023(K\261a\205\177\252\336\361\260\320Q\331\237\220=g*\006\305\016Fh<\261\024^\255\341 |\217Eg\346!\360`\023.\200\263lu7\374c\3449\300P\324\351T\013\217\305\235\201\033)x,\314-%\240\304`\334\314\304\236\246,\2505\223\230"
+	.string	"VTp\303\276\025\245\007\231\355q\306\276\211\224\221"
+	.ascii	"F\304\0217>\340\276H"
+	.string	"\362\277\241\371<\305G\304%\277\205\361\037<\016T\\ \275K\226O\317\375\244\t\272<\3153\020\370kVl\232\025\366\276w\273\225\260p\371\306_\216u2\370F\343\231)*I\275Q\254\030\025+\222U\273\21026\260\325\025\347\273\2100=\036\r\224\031~\256.\217xsh\331\022\233\006g\212\"\225\004/\260\362\022\007a'4\311\240\3237Ibw\222[\206\366\234\367G\254\342\227\370\275U]\377\274|\332T\245\0203U]_G\350\306e\004\210\311\265my\251\242\005p\300\362\3572\223\242\225\215\"\241\307q\255e%\356\302\353\335\306\310/\002\234\3313J\310LAz\375\313\267\374\020*$,\001\367\230D\370\304\341\032\215\353\306\2440.-\004rg\033\275\342\375|\267pP\324C\257\373\331\\\374`\007\212\245}\356p\257\226_\363\215\375\375\346\320\3545\234\274\031\337]\223Z7\310\231\215\256\343\275\243"
+	.string	"\371\245\343\237AZ\241XW\366:\317\35590\334\366^\227\030<<\334\351\346\003\332\221\020\334]e\331\204\276\004\030\023\275\2100Gv#\343C \232"
+	.ascii	"\247t\214\365\253p\340\370\227x\370l\317#\030\326\276\216A\325"
+	.ascii	"\223\277\366\002h=\236/\335\260\221\216\241\226\364\336X/qmb"
+	.ascii	"k\362DP\220\027a_\260\251\252p\273 \222\0066j\250^\201\222A\354"
+	.ascii	"UB\224\022\262{\303\312\032]\205\260@\242\364\005\223>\303\227"
+	.ascii	"\221\214\317s\300\347\247\367\237\201m\007\306\307\2748\213\374"
+	.ascii	"\344\033\r\265\355\364v\323i\332\355\276\243\371SS\300\367(\177"
+	.ascii	"\023\267u\013Na"
+	.string	"S\346(3h\226\310\271\340\337(\264\331\367!/\206\033\251\376\332\235\261\266k\377\356\221\361\3707\305\036\356\302\313+\324|\363\340\360A\242g1^\351\032\367\"\304l\344\267\363\003\004\231\0328D\334\335\004\214-C\372xl\213\206<\276\301\303\344\230\260$'\317^"
+	.string	"\027\241\247\211\037{(Kz\212\037OC\301 \251\214\306\313\326\304\306\237m\227\027\027G\231\241t\2479f\251\234R=\237\231\355\345\321\321\340U'\362\246\342\247\211(\344~\237&\037\320\265W\236\200\203Q\\Y\242\242\317\030\324\374\355\003\232\3368 \b\217\240\276\310\356=\020"
+	.string	"vUe\200\327\021Q\fc\257\005\021\215W\006\226\026\234Ap\340\276m\342\220\013q\224\337&}r\236\265\363\240\274A\364\206\271`#\346\365"
+	.string	"\266\247T\263\360g\245\030P\231l~\256\026ML\3026l\340\213z\235\207I\244\252\241\374\357\244d-D\271\264;'MUZ\003yO\017\217v\321\245\314\375WYM\030t\361\254(/\273(\312\337\242=?\030\250k\374\233?o \3150I\214\262\017\021\310\376\264`\004%F\263z\263\215\024\333B\234\223\232\210\316}\330\230\035i\332I\317\261-v\004v\345\255\320e\201J\315\347\332\205\337\237D\321\307\004\372W\217(\305;Dx\302\257\007\320PT\037\365\ri\316\206,Z 3\2763df\332X\346\2607\252\355\b>\216\270\221\256\270)\002\002RM0mj\032\024\002\300z\364\b\213\357V\304?S\265o\317\031\341hR\260\013\266\307\207K\264?s,\016B\252\222"
+	.string	"D\017\263\002\340L\277r\f\226J\264\271\031"
+	.ascii	".\314\255\0134\031\364\206\250bS\273\320!{q\201\255y\351\367"
+	.ascii	"\330i\030O\204h\316\314\362@\314\236\365\323>\220\t\324\037A"
+	.ascii	".\bg$\315Uj\271\301X\325\2400\376 Z\341\324oo\251\330u\266Z#"
+	.ascii	"10KnO3\005\261\031\210\301]Pa\214\252\177\356'SA\242\346\310"
+	.ascii	"qPG\3133\t\366\237\350t\350\177o\025\236\320\315\f\227!\270\304"
+	.ascii	"\027\324n\323\016\257\0048G\324\226\fa\356\377\237\263\205\004"
+	.ascii	"\210)H:H\372\341W^\223&\322\367[\013\366\033\246vd\036B6\334"
+	.ascii	"\337t\310)*\037\335B\344/\201"
+	.string	"\2529\210\310HTJ\037O\361\302\255\265\273\251\270\034\322[\017\253(\001\031\365\312\314k\310\334\344\230W\202\325L\343\366dc\301\317\037\357M\230\263\377\215_T8]X\351K\334<|\233\24006E\216a\214\344\254 \211f\274%\211\263\037\006E\003mj\232\362\267)\347\006LDdXh\232\342I\204\216\341\027\267\300jYI\377\022;m/\\\031\234\266e\260\201(\365XA\230%v/\373t\330\326x\251h\345C\016s[\243\255\355\261L\361\235a\261\354\264\345\002\326\016\2641\260u\215\032\001\221,\252\230\236\021\332t8\361\345s\272\304\366PF.-37d\311\037K\226X\364\347$\335\322\260\264\265\222\337\335\"\227\274\256\\k\270\247P\303\202\242\265WR\0133\327:6\300\nW\223'([\266w\245\275\372\023\265\246\213\241p\273b\230\324k`\243\005\336eG\2264X\245\321@\200\017\246Z"
+	.string	"pc\242u2\351\224\023\263\315\006*\2007\233.X\217~\352\234\332X!\374\235\b\372\230U\2212h\037\3016\306\375\201a\242\024\027(\356A\275\213\351\262\345\023k\347W(\363\b^*\003\3613=\307\230\323\275\n%\204>8\220\003\377\355\364\323\375a\361\227\022*\245\242\312\244H>L\273\026@\306\237\240\241>\002y?\216<\005\313\027\242.%@\341q\233\244\030\334\022c9\250G\021\360\252\304\234\305\216<\221\315\002\355\340\322\216["
+	.string	"*t\254\376\247\0055\337L\373\245Ax\361|s}\n\227\361;y"
+	.string	"P\272\203t\216\205\345Z\301;\244\022M?\221K@\274\036\331Ca9\345\237\344S\3319\220\013$\313\360\036bq\021\240,O\nO\204\203\261\247\301\207'\203\260!\004P\033\325\302&P\354\337[\210\254+\021\200O\365\201\333\212\300~%\017\363\016\337o\332\205R\355\030\303\226\266\022V\032{r\177\222J\005\356G\310\003R"
+	.string	"\326\223\347\362>\304\306\006\310B\232&\017\022\b\3602\274\275\340!\022\225\245\374?\277\336\367\177\201\001\313y\203Y\355g\346\261\270\341\262\2712\212E\376\r0YO\007\035\215\216x\351 \374\214>\007\330Nv\023$`\177\225\374\203\332Ff\n\327G\344\3053\204\314/\343\366$\353|\217~\374\202\264\205\215\364\027\316,\364\221\003Y\355\216C\307<\177\"\347#\004 2\220\207\037\"\232\002\302F\220\333%\376q\026\002_\341\340\340\020\253\3744B|\343#\333\374\217\314_\3175p\013\332\216\037\327X\230\255\360\004@1\004\361\305qJ\2761\377\366\003\201\017k\232\303\237`\036\b\267\013\306G\211\215]d\371g\353O\036\036jG\267\367\320t\344\262R\377$ \226\261\245P\037\2671y\007\325\270>S\021\321\237\367*\306\231\233Z\363\323$R\337\376xT\341\376+\352\274H\001K\355\244\303\r\273\240\327\305T"
+	.string	"\213h0(\330!r\270i\267sb\343\314O4\376V\237\022[D\262\266\327w\205/0\344\177\220\215\322b\033\263|\212\232\257\217Si\3376\354]<4\277bzw\266|K|!\212\2072\376\320r\332\210\363\321a\270H\277v\265\030\317\177\302\177D\321\025\270\255\034z\213\207\237\233\221\245\214\263\2207\310\357\260\336~h\035\020\267\361\370a\245\330\262\230\024L$\250\213\026\323\235)?~\247f\r\324\275O\230\002r\360\002g\020\354\013\305\301\303\247\0047\3570\273!\030:\361\344\307'\376B\216\300\340\003\220=b\304\007D\377\001o\375\331N0s\272\364/28*\335\212\325\273\311\367\327\247\220Q8\306\007 \335\341\230b^\350\030\215\231)a"
+	.ascii	"\373I\362\321vb\036V\027\275\213D\357\013\351\372`p\004B\370"
+	.ascii	"\177\361\324\374i\222v\230\313\003\025\261\332\205\0372\007\244"
+	.ascii	"\357\366\357"
+	.string	"R\271\303\372\305hV\302\370\343\272\025QVYY\tr+\302n\344#\005\017\035Gt\341\035\031\263\304?,3*\377_\303'3B\306\210\017`rc\025\225\277\353\33287\n\\,\303\200o\234Z\023i\363g?\271\234\215\303\377zW<\303\365\251H\177\316\233\025\177\315e7a?\217\237\250\214\331\0223\312n\300j\211\213l<9\302>O\036\302~\254\257\325_[\237r\177\021\177\230\362\247N\t\257\314\365\177\007\213\221Q\001]\300RO\210\243x\321\303\001\r\036@8\270\370\b\306\203\374\310\017\343%(\377\2426\260x\324(\362\036P\216\r\250z\035\376_n.\263\201g\317\232\213\354O\371\315\314\327{cOv\216!\337\031\332\017\351\204h\t\030/O\005\237\3130\243\274\270\315\304\326\275\336\333\352\377\356wl\256^?h\177e\177T\246\246\341\003\366\327e\3707\315\340\376<\f\253\"\370_\370\377"
+	.ascii	"\343\375\3227\361H\017h\366L&$\271\344\270\200x\200\364\367\237"
+	.ascii	"p\001z\301\316\003\230\355*<\251\356\\\257\226]\340-\254\017"
+	.ascii	"\267_Ut\251\337\302/6v\307<\360p\357^\362\225/~\025\366\3055"
+	.ascii	"Ysy4\177@\030h|\272'\035G\234\366V\360)\363W<\341\371\023\227"
+	.ascii	"\003|\377\256\304U\356"
+	.ascii	"\322\345\377\245\037c\273\004"
+	.text
+	.section	.gnu.lto_.symtab.91491f9cfdf1120f,"e",@progbits
+	.string	"blockDeviceMmapClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"blockDeviceMmapOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"blockDeviceMmapSetTiming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"blockDeviceMmapGetImage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"blockDeviceMmapGetStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"blockDeviceMmapResetStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"blockDeviceMmapSdcardVTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"blockDeviceMmapFlashVTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"munmap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"msync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"mmap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"ftruncate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"fstat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"open"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.91491f9cfdf1120f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
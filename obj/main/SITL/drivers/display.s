@@ -0,0 +1,6847 @@
+	.file	"display.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/display.h"
+	.file 5 "./src/main/drivers/display.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	display.c.e13b1c50
+	.weak	display.c.e13b1c50
+display.c.e13b1c50:
+	.long	0x425
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xd
+	.long	.LASF1012
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF960
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF961
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF962
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF963
+	.uleb128 0x5
+	.long	.LASF965
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF964
+	.uleb128 0x5
+	.long	.LASF966
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF967
+	.uleb128 0x5
+	.long	.LASF968
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF969
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF970
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF971
+	.uleb128 0xb
+	.long	0x8a
+	.uleb128 0x5
+	.long	.LASF972
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF973
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF974
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF975
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0xc
+	.long	.LASF982
+	.byte	0x10
+	.byte	0x15
+	.long	0x11a
+	.uleb128 0x1
+	.long	.LASF976
+	.byte	0x16
+	.byte	0x27
+	.long	0x1af
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF977
+	.byte	0x17
+	.byte	0xd
+	.long	0xa2
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF978
+	.byte	0x18
+	.byte	0xd
+	.long	0xa2
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF979
+	.byte	0x1b
+	.byte	0x9
+	.long	0x1b4
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF980
+	.byte	0x1c
+	.byte	0xc
+	.long	0x96
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF981
+	.byte	0x1d
+	.byte	0xc
+	.long	0x96
+	.byte	0xc
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF983
+	.byte	0x58
+	.byte	0x20
+	.long	0x1aa
+	.uleb128 0x1
+	.long	.LASF984
+	.byte	0x21
+	.byte	0xb
+	.long	0x1e0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF985
+	.byte	0x22
+	.byte	0xb
+	.long	0x1e0
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF986
+	.byte	0x23
+	.byte	0xb
+	.long	0x1e0
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF987
+	.byte	0x24
+	.byte	0xb
+	.long	0x1e0
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF988
+	.byte	0x25
+	.byte	0xb
+	.long	0x1f9
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF989
+	.byte	0x26
+	.byte	0xb
+	.long	0x221
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF990
+	.byte	0x27
+	.byte	0xb
+	.long	0x244
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF991
+	.byte	0x28
+	.byte	0xb
+	.long	0x258
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF992
+	.byte	0x29
+	.byte	0xb
+	.long	0x1e0
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF993
+	.byte	0x2a
+	.byte	0xc
+	.long	0x268
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF994
+	.byte	0x2b
+	.byte	0x10
+	.long	0x27c
+	.byte	0x50
+	.byte	0
+	.uleb128 0xb
+	.long	0x11a
+	.uleb128 0x4
+	.long	0x1aa
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF995
+	.uleb128 0x5
+	.long	.LASF996
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x3
+	.long	0xc6
+	.uleb128 0xb
+	.long	0x1bb
+	.uleb128 0x8
+	.long	0x70
+	.long	0x1db
+	.uleb128 0x3
+	.long	0x1db
+	.byte	0
+	.uleb128 0x4
+	.long	0x1bb
+	.uleb128 0x4
+	.long	0x1cc
+	.uleb128 0x8
+	.long	0x70
+	.long	0x1f4
+	.uleb128 0x3
+	.long	0x1f4
+	.byte	0
+	.uleb128 0x4
+	.long	0x1c7
+	.uleb128 0x4
+	.long	0x1e5
+	.uleb128 0x8
+	.long	0x70
+	.long	0x21c
+	.uleb128 0x3
+	.long	0x1db
+	.uleb128 0x3
+	.long	0xa2
+	.uleb128 0x3
+	.long	0xa2
+	.uleb128 0x3
+	.long	0x21c
+	.byte	0
+	.uleb128 0x4
+	.long	0x91
+	.uleb128 0x4
+	.long	0x1fe
+	.uleb128 0x8
+	.long	0x70
+	.long	0x244
+	.uleb128 0x3
+	.long	0x1db
+	.uleb128 0x3
+	.long	0xa2
+	.uleb128 0x3
+	.long	0xa2
+	.uleb128 0x3
+	.long	0xa2
+	.byte	0
+	.uleb128 0x4
+	.long	0x226
+	.uleb128 0x8
+	.long	0x1b4
+	.long	0x258
+	.uleb128 0x3
+	.long	0x1f4
+	.byte	0
+	.uleb128 0x4
+	.long	0x249
+	.uleb128 0xf
+	.long	0x268
+	.uleb128 0x3
+	.long	0x1db
+	.byte	0
+	.uleb128 0x4
+	.long	0x25d
+	.uleb128 0x8
+	.long	0xba
+	.long	0x27c
+	.uleb128 0x3
+	.long	0x1f4
+	.byte	0
+	.uleb128 0x4
+	.long	0x26d
+	.uleb128 0x5
+	.long	.LASF997
+	.byte	0x4
+	.byte	0x2c
+	.byte	0x3
+	.long	0x11a
+	.uleb128 0xb
+	.long	0x281
+	.uleb128 0x7
+	.long	.LASF999
+	.byte	0x63
+	.long	0x2b3
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x63
+	.byte	0x21
+	.long	0x1db
+	.uleb128 0x2
+	.long	.LASF976
+	.byte	0x63
+	.byte	0x46
+	.long	0x2b3
+	.byte	0
+	.uleb128 0x4
+	.long	0x28d
+	.uleb128 0x9
+	.long	.LASF1002
+	.byte	0x5e
+	.byte	0xa
+	.long	0xae
+	.long	0x2d3
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x5e
+	.byte	0x32
+	.long	0x1f4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1000
+	.byte	0x59
+	.long	0x2e9
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x59
+	.byte	0x23
+	.long	0x1db
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1001
+	.byte	0x54
+	.long	0x2ff
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x54
+	.byte	0x26
+	.long	0x1db
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1003
+	.byte	0x4f
+	.byte	0x5
+	.long	0x1b4
+	.long	0x31a
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x4f
+	.byte	0x36
+	.long	0x1f4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1004
+	.byte	0x4a
+	.byte	0x5
+	.long	0x70
+	.long	0x350
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x4a
+	.byte	0x25
+	.long	0x1db
+	.uleb128 0xa
+	.string	"x"
+	.byte	0x4a
+	.byte	0x37
+	.long	0xa2
+	.uleb128 0xa
+	.string	"y"
+	.byte	0x4a
+	.byte	0x42
+	.long	0xa2
+	.uleb128 0xa
+	.string	"c"
+	.byte	0x4a
+	.byte	0x4d
+	.long	0xa2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1005
+	.byte	0x45
+	.byte	0x5
+	.long	0x70
+	.long	0x386
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x45
+	.byte	0x21
+	.long	0x1db
+	.uleb128 0xa
+	.string	"x"
+	.byte	0x45
+	.byte	0x33
+	.long	0xa2
+	.uleb128 0xa
+	.string	"y"
+	.byte	0x45
+	.byte	0x3e
+	.long	0xa2
+	.uleb128 0xa
+	.string	"s"
+	.byte	0x45
+	.byte	0x4d
+	.long	0x21c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1006
+	.byte	0x3f
+	.byte	0x5
+	.long	0x1b4
+	.long	0x3a1
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x3f
+	.byte	0x2b
+	.long	0x1f4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1007
+	.byte	0x39
+	.long	0x3b7
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x39
+	.byte	0x27
+	.long	0x1db
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1008
+	.byte	0x33
+	.long	0x3cd
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x33
+	.byte	0x24
+	.long	0x1db
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1009
+	.byte	0x2c
+	.long	0x3e3
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x2c
+	.byte	0x21
+	.long	0x1db
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1010
+	.byte	0x27
+	.byte	0x5
+	.long	0x70
+	.long	0x3fe
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x27
+	.byte	0x2c
+	.long	0x1f4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1011
+	.byte	0x22
+	.long	0x414
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x22
+	.byte	0x27
+	.long	0x1db
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1013
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF998
+	.byte	0x1b
+	.byte	0x28
+	.long	0x1db
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 6 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x8
+	.file 9 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 22 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.file 23 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 24 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x18
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 26 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x1a
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x4
+	.file 27 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF807
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF768
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF908
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF1
+	.long	.LASF1014
+	.long	.LASF1015
+	.long	.LASF1016
+	.long	.LASF1017
+	.long	.LASF1018
+	.long	.LASF1019
+	.long	.LASF1020
+	.long	.LASF1021
+	.long	.LASF1022
+	.long	.LASF1023
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x1c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1024
+	.byte	0x6
+	.long	.LASF1025
+	.byte	0x6
+	.long	.LASF1026
+	.byte	0x6
+	.long	.LASF1027
+	.byte	0x2
+	.long	.LASF1028
+	.byte	0x2
+	.long	.LASF1029
+	.byte	0x9
+	.long	.LASF1030
+	.byte	0xa
+	.long	.LASF1031
+	.byte	0xa
+	.long	.LASF1031
+	.byte	0x9
+	.long	.LASF1032
+	.byte	0x6
+	.long	.LASF1033
+	.byte	0x9
+	.long	.LASF1034
+	.byte	0x9
+	.long	.LASF1035
+	.byte	0x6
+	.long	.LASF1036
+	.byte	0x6
+	.long	.LASF1037
+	.byte	0x8
+	.long	.LASF1038
+	.byte	0x6
+	.long	.LASF1039
+	.byte	0x7
+	.long	.LASF1040
+	.byte	0x7
+	.long	.LASF1041
+	.byte	0x6
+	.long	.LASF1042
+	.byte	0x6
+	.long	.LASF1043
+	.byte	0x6
+	.long	.LASF1044
+	.byte	0x5
+	.long	.LASF1045
+	.byte	0x4
+	.long	.LASF1046
+	.byte	0x3
+	.long	.LASF1047
+	.byte	0xa
+	.long	.LASF1048
+	.byte	0x4
+	.long	.LASF1049
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF972:
+	.string	"int8_t"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF783:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF903:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF860:
+	.string	"NULL ((void *)0)"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF982:
+	.string	"displayPort_s"
+.LASF996:
+	.string	"displayPort_t"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF763:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF522:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF867:
+	.string	"U_ID_0 0"
+.LASF978:
+	.string	"cols"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF879:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF998:
+	.string	"instance"
+.LASF862:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF989:
+	.string	"write"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF885:
+	.string	"USE_UART7 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF932:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF925:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF509:
+	.string	"__P(args) args"
+.LASF939:
+	.string	"__enable_irq() "
+.LASF823:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF779:
+	.string	"USE_SERIALRX_SUMD "
+.LASF858:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF807:
+	.string	"VTX_TRAMP "
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF816:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF837:
+	.string	"_GCC_SIZE_T "
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF796:
+	.string	"TELEMETRY_MAVLINK "
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF827:
+	.string	"_T_SIZE "
+.LASF953:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF923:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1007:
+	.string	"displayReleaseAll"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1000:
+	.string	"displayResync"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF806:
+	.string	"VTX_SMARTAUDIO "
+.LASF895:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF808:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF801:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF546:
+	.string	"__always_inline"
+.LASF825:
+	.string	"_SYS_SIZE_T_H "
+.LASF776:
+	.string	"USE_SERIALRX_IBUS "
+.LASF790:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF934:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF880:
+	.string	"USE_UART2 "
+.LASF970:
+	.string	"long int"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF907:
+	.string	"TELEMETRY_MAVLINK"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF815:
+	.string	"_PTRDIFF_T_ "
+.LASF822:
+	.string	"__size_t__ "
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF909:
+	.string	"USE_DASHBOARD"
+.LASF898:
+	.string	"USE_SERIALRX_XBUS"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF787:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF937:
+	.string	"EEPROM_SIZE 32768"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF784:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF999:
+	.string	"displayInit"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1013:
+	.string	"displayClearScreen"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF940:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF964:
+	.string	"signed char"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF973:
+	.string	"uint8_t"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF886:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF941:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF799:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF905:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF960:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF992:
+	.string	"heartbeat"
+.LASF1002:
+	.string	"displayTxBytesFree"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF786:
+	.string	"TELEMETRY_HOTT "
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF881:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF995:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF831:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF859:
+	.string	"NULL"
+.LASF778:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF981:
+	.string	"grabCount"
+.LASF899:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF919:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF968:
+	.string	"__uint16_t"
+.LASF947:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF924:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF805:
+	.string	"VTX_CONTROL "
+.LASF984:
+	.string	"grab"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF929:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF872:
+	.string	"USE_FAKE_GYRO "
+.LASF977:
+	.string	"rows"
+.LASF958:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF834:
+	.string	"_SIZE_T_DECLARED "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF775:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF863:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF853:
+	.string	"__INT_WCHAR_T_H "
+.LASF894:
+	.string	"USE_SERIALRX_SBUS"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF840:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF777:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF882:
+	.string	"USE_UART4 "
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF928:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF400:
+	.string	"bool _Bool"
+.LASF946:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF966:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF848:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF766:
+	.string	"I2C1_OVERCLOCK true"
+.LASF866:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF954:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF896:
+	.string	"USE_SERIALRX_SUMD"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF965:
+	.string	"__int8_t"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF945:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF869:
+	.string	"U_ID_2 2"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF900:
+	.string	"LED_STRIP"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF956:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF803:
+	.string	"USE_SENSOR_NAMES "
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF910:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF935:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF826:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF933:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF770:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF943:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF868:
+	.string	"U_ID_1 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF870:
+	.string	"LED0_PIN NONE"
+.LASF959:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF875:
+	.string	"BARO "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF887:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF817:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF812:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF835:
+	.string	"__DEFINED_size_t "
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1001:
+	.string	"displayHeartbeat"
+.LASF769:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF768:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF844:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF911:
+	.string	"VTX_COMMON"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF969:
+	.string	"__uint32_t"
+.LASF829:
+	.string	"_SIZE_T_ "
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF891:
+	.string	"SERIAL_RX"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF841:
+	.string	"__wchar_t__ "
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF915:
+	.string	"BLACKBOX"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF846:
+	.string	"__WCHAR_T "
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF781:
+	.string	"USE_SERIALRX_XBUS "
+.LASF828:
+	.string	"__SIZE_T "
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF499:
+	.string	"__PMT"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF979:
+	.string	"cleared"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF810:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF789:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF991:
+	.string	"isTransferInProgress"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF980:
+	.string	"cursorRow"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF962:
+	.string	"unsigned int"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF988:
+	.string	"screenSize"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF901:
+	.string	"TELEMETRY_FRSKY"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF855:
+	.string	"_WCHAR_T_DECLARED "
+.LASF788:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF813:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF952:
+	.string	"BIT(x) (1 << (x))"
+.LASF811:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF797:
+	.string	"TELEMETRY_SRXL "
+.LASF545:
+	.string	"__wur "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF985:
+	.string	"release"
+.LASF402:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF401:
+	.string	"true 1"
+.LASF819:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF873:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF986:
+	.string	"clearScreen"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF888:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1004:
+	.string	"displayWriteChar"
+.LASF1010:
+	.string	"displayScreenSize"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF836:
+	.string	"___int_size_t_h "
+.LASF843:
+	.string	"_WCHAR_T "
+.LASF877:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF876:
+	.string	"USE_FAKE_BARO "
+.LASF833:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1008:
+	.string	"displayRelease"
+.LASF818:
+	.string	"_GCC_PTRDIFF_T "
+.LASF583:
+	.string	"__stub_revoke "
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF971:
+	.string	"char"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF824:
+	.string	"_SIZE_T "
+.LASF851:
+	.string	"_WCHAR_T_H "
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF914:
+	.string	"VTX_TRAMP"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF961:
+	.string	"short unsigned int"
+.LASF917:
+	.string	"USE_SERVOS"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF782:
+	.string	"BLACKBOX "
+.LASF800:
+	.string	"USE_MSP_PUSH "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF871:
+	.string	"GYRO "
+.LASF918:
+	.string	"USE_DSHOT"
+.LASF938:
+	.string	"__disable_irq() "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF893:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1012:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF854:
+	.string	"_GCC_WCHAR_T "
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF942:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF936:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF794:
+	.string	"TELEMETRY_IBUS "
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF393:
+	.string	"SITL 1"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF832:
+	.string	"_SIZE_T_DEFINED "
+.LASF990:
+	.string	"writeChar"
+.LASF974:
+	.string	"uint16_t"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF814:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF912:
+	.string	"VTX_CONTROL"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1009:
+	.string	"displayGrab"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF883:
+	.string	"USE_UART5 "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF892:
+	.string	"USE_SERIALRX_CRSF"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF839:
+	.string	"__size_t "
+.LASF850:
+	.string	"_WCHAR_T_DEFINED "
+.LASF792:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF586:
+	.string	"__stub_stty "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF798:
+	.string	"USE_DASHBOARD "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF830:
+	.string	"_BSD_SIZE_T_ "
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF861:
+	.string	"__need_NULL"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF845:
+	.string	"_T_WCHAR "
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF772:
+	.string	"USE_PPM "
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF847:
+	.string	"_WCHAR_T_ "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF957:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF849:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF765:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1006:
+	.string	"displayIsGrabbed"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF773:
+	.string	"USE_PWM "
+.LASF838:
+	.string	"_SIZET_ "
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF884:
+	.string	"USE_UART6 "
+.LASF774:
+	.string	"SERIAL_RX "
+.LASF791:
+	.string	"GPS "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF767:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF889:
+	.string	"USE_PPM"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF804:
+	.string	"VTX_COMMON "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF927:
+	.string	"USED_TIMERS 0"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF944:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF967:
+	.string	"short int"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF987:
+	.string	"drawScreen"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF821:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF842:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF856:
+	.string	"__DEFINED_wchar_t "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF951:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF771:
+	.string	"USE_CLI "
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF793:
+	.string	"TELEMETRY_CRSF "
+.LASF983:
+	.string	"displayPortVTable_s"
+.LASF997:
+	.string	"displayPortVTable_t"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF852:
+	.string	"___int_wchar_t_h "
+.LASF955:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF920:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1003:
+	.string	"displayIsTransferInProgress"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1011:
+	.string	"displayDrawScreen"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF857:
+	.string	"_BSD_WCHAR_T_"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF975:
+	.string	"uint32_t"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF950:
+	.string	"UNUSED(x) (void)(x)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF922:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF930:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF764:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF913:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1005:
+	.string	"displayWrite"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF994:
+	.string	"txBytesFree"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF802:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF948:
+	.string	"EXPAND_I(x) x"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF795:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF780:
+	.string	"USE_SERIALRX_SUMH "
+.LASF820:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF902:
+	.string	"TELEMETRY_HOTT"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF809:
+	.string	"_STDDEF_H_ "
+.LASF949:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF976:
+	.string	"vTable"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF890:
+	.string	"USE_PWM"
+.LASF931:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF993:
+	.string	"resync"
+.LASF785:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF926:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF963:
+	.string	"long unsigned int"
+.LASF864:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF908:
+	.string	"TELEMETRY_IBUS"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF921:
+	.string	"USE_PROFILE "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1032:
+	.string	"libc-header-start.h"
+.LASF1040:
+	.string	"stubs-64.h"
+.LASF1022:
+	.string	"/usr/include"
+.LASF1025:
+	.string	"stdint-intn.h"
+.LASF0:
+	.string	"./src/main/drivers/display.c"
+.LASF1027:
+	.string	"display.h"
+.LASF1049:
+	.string	"utils.h"
+.LASF1017:
+	.string	"src/main/target"
+.LASF1043:
+	.string	"wchar.h"
+.LASF1044:
+	.string	"platform.h"
+.LASF1028:
+	.string	"display.c"
+.LASF1026:
+	.string	"stdint-uintn.h"
+.LASF1021:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1045:
+	.string	"common.h"
+.LASF1023:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1033:
+	.string	"features.h"
+.LASF1042:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1015:
+	.string	"src/main/drivers"
+.LASF1019:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1041:
+	.string	"typesizes.h"
+.LASF1039:
+	.string	"stubs.h"
+.LASF1020:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1047:
+	.string	"stddef.h"
+.LASF1034:
+	.string	"features-time64.h"
+.LASF1048:
+	.string	"common_post.h"
+.LASF1037:
+	.string	"cdefs.h"
+.LASF1046:
+	.string	"target.h"
+.LASF1036:
+	.string	"timesize.h"
+.LASF1038:
+	.string	"long-double.h"
+.LASF1016:
+	.string	"src/main/target/SITL"
+.LASF1018:
+	.string	"src/main"
+.LASF1030:
+	.string	"stdbool.h"
+.LASF1035:
+	.string	"wordsize.h"
+.LASF1014:
+	.string	"src/main/common"
+.LASF1029:
+	.string	"stdc-predef.h"
+.LASF1031:
+	.string	"stdint.h"
+.LASF1024:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	"\001"
+	.string	"\002"
+	.string	"\003"
+	.string	""
+	.string	"\004"
+	.string	"\005"
+	.string	"\007"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.text
+	.section	.gnu.lto_.icf.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\335\005"
+	.string	"bI$.`e\323\001\260\024*`E\022Y\257\303\003 \236\034\213\255\265\335M\005;\ne\004\b\202 \b\202 \b\202\t\242%\275i\023\271\267Lr\007p/O\243\300\201\370*\377z\327\315$+]|\353\033\360t\020\202\305\377\344\036\240\217\362\351\233+\231\207\251\370\325\027\343(\247\305\344\317\326<\303\210\352\313\177j\227\315\322M\0032\207\206\234,at\006Q^u\023)>\314\247\336\t"
+	.string	"/\022\251\020\251\323\354^~\037\317\377\367\360\263\232\n\234\fbpa\021"
+	.string	"fc"
+	.string	"\\\002\346\201=`|P\341!\234u\030\026\340\2463\003(\006\204q+$\004UI\346%\353,\256"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"U\003"
+	.string	"\202\005\016\024\2405\351`UUUU \207\304\233\231\265\204H\333[\246\024\256\372FA\fSZ\315\264\006\353\326/*\036\327*D\204Z\032\035\373\255%\370\2119\033\035\355\337\005x \023"
+	.string	"\370\300\331\002\020\002}84\013>-.\206\326"
+	.ascii	"\031\242~EB\223\036\261\"l\016\\a!\327\205\f\253\b\202\301\302"
+	.ascii	"I\031\346m\005p\003"
+	.text
+	.section	.gnu.lto_.inline.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\221\003\215\t"
+	.string	"\242\016,,pi\222\016\274}\r\006-\024\004\202\302\003q\215eX\004\020\212\367\227o\rN\303\277\365\377w\254\006S\364\375m\353fI#[\356\024W\030Yo\b\315$G#\242\004\361\324\263\004\243\376\201\207\306\333,'\315\210\254\246\333\264\027g\252\310T\023Zh2\0246\301\024\305\320\266\341\035"
+	.ascii	"\332\242}\301m\223\365 \002\204-&\330\302ZT\330\331*\347\240"
+	.ascii	"\311H</\306Ow\316]\264u\254\256\360\241-t\007\214h+\360A\034"
+	.ascii	"i\242m4\271~\342\246-\264-\301\330\037\240V\323\2006'\345\236"
+	.ascii	"\247\260m\225\372\373h\333faE\333\306?V\2277 \320\002!\t\250"
+	.ascii	"\346\001=\252\300v\210\211\005i\310\221\207\3369E\3319,\022<"
+	.ascii	"hp\330\005\327\275\300\034!\013\261\"\200\357\301@\244\254\373"
+	.ascii	"\312\3426P\003\n\202\013jcH_s`\r\002,^\327EE\307\005\306\340"
+	.ascii	"\020\252\022\272\272 \276\254\250U\213\205Y\233e\026\216\220"
+	.ascii	"[\020i\355i\220\274\002j\2215\026\226\262\366Q \214\272,\252"
+	.ascii	"p9%\227\271\270_ig\030Px\205\033\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\353"
+	.string	"\225\004"
+	.string	"\362\005\023\035\240'\351\377gU\340\003"
+	.string	""
+	.string	"O\252\252\352\371\337Cf\205\314\376\377\177\373\244\355-\223\f{\2418\321\303\263@x \b$=\354\202Pky\b\202\037\366\260\363\031\377\0050\346\243F\206\323\237t+K\331\245\274\327\342,\375\f\273\021\034"
+	.string	"v;\342`\331\212\302r \031\\\202\265\313%\331e\302p"
+	.string	"\200\031\200G\205\300\266\320\035\306l\375\003N\215`\312\200\342\252K\200<"
+	.ascii	"3\350\006uc%$\006\222E\001\026\220\007.\206\236\237\024\300\r"
+	.text
+	.section	.gnu.lto_.pureconst.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\232\004\001\231\004\002\231\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\205\004\007\231\004\b\231\004\t\231\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\202\001E\006"
+	.string	"\242\006\025\036\220)\351s\337\263\356\356n\277\277\273\273\273\273~\340\177\361+Nn\305\177\354\003}\"S\n\3528Kh\211\277/\220\303\303\300\\p\020\032\027\343\301\317\202\003"
+	.string	"\257\2622\344\316\262],%'UR\254r\242\330l\266\316l\023\363\361\321]\264m6\021.\0225 \340\"\231\262:G\222"
+	.string	"\365K`\013Ib\207\334\205\220\013)d-37\260\016\222\2420>\003c%\036m\344\207\2607\b\317\024\342\363pyY\316@\004\3779\312\025\347W11\304\3014\336"
+	.string	"\333n\2575\273\021\362+\301JP\366"
+	.string	"b\233\215M~\0226\304\371=\220\360\033\3403va\r"
+	.ascii	"+\024``\021\344\325 \335\323i\375,\254\321!"
+	.text
+	.section	.gnu.lto_.lto.bf6da6fd2bfdb140,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayClearScreen.2.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"\205\013"
+	.string	"\346UO= /\230t\200\362\r\211\330\266H#\307`\347X\371$0\366\001\333\017\210\tB6\210\020~y\3307\250'\335\360A\302)\002H\r\004\304\330XJ\322(\245N\340l\001[\223M\366N)<"
+	.string	";"
+	.string	"?"
+	.string	"\002vO)X\273\343\002+\250\247\036?@;\255\207h\247\026\355\026\0060\004"
+	.string	"AR\275\330\335m\242.^\212\376G\274Q2\205.\0018\330]\313\222I\303=o;\201\355\212\375\007\001\363\301\"%\222\031>\212\025{\255\204a\217!9;\330\317vw=O\366S\1776\245\245\224~\255\220V\220\025\273\0312bl\213\242\370`\373\016\273n\230\\\332\017q\021\342S\240\007\230\003.\230\213\330\353\317h\266\367U\346\341*\340\202}T4d6-\247\035\034F3d\373\273jB\335\035Q|\023\237\320\243\235\312I\300\246\360\022\236\272\273\024\237D\247B\365p\352\203\264\323\007f0\341$\020\032H\272\b\244\3434\026N\250\361\252\271\210\005K\204M\350]\266\020\354:\036x\3314\236E\302\306\201\341\026A\340o\323\201\033\347\373\300\3151\356\263\235'SSK4/X<F\263\273\237\b\022"
+	.ascii	"t\263\240Lh\331\013\f\027\004\250\311I\314\270\246\241{\261q"
+	.ascii	"\027rx5,\032\254\003\333T:\313\230\t.\\\006\374VS\302\035^\264"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_displayDrawScreen.3.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"\375\t"
+	.string	"\246\223G> \3458\035"
+	.string	",\004X\246\274\371\035\314\234\232\0277\017@8\030\323(\003\f\273o`\216\0207\024\001\377\352\037\344\365t\242\002\020\216\n\362<\177\017V\023\003\320pT7\2004m\262wJ\0013"
+	.string	"3"
+	.string	"7"
+	.string	"\f^\340^]\276\263\275r\347l\257&m"
+	.string	"\b\032\003,\033\261"
+	.string	"\273\333\321\221\223\237\244\177\224kZ.\325\247\300\303\356z\266\\\0367\275m\005\333\020\366g.U\223\212\330\327vwM_\366a\277F\247\347\234\376\246\2011\210\331\355\230\rXY})\261\375\215\315q\200>\355\233\374\204<,\365\202\335W\213\313n\031\232\251QO\352M\b\213\252l\207\217Qp\273\254\220\277\2021\242\266\327I\017\354\212\253\240\270\335\r\371)'\013\216\344\325Om\257\247\0043\260\325\234\271\363!\263S\200\003n"
+	.string	"y\237\b\207\317\347\341|\036Id\032I g\317s!\222(\215\340\250\033\305\357\004\212\243\216\004\212&:O\034;O\202\303\322'v\2460\024\273M\271\327\226\276\\Ad+\232\341\013"
+	.ascii	"t\263\240L\350\r\0076.<\260M\245\263p\231\340\300e\300o5%\334"
+	.ascii	"\341E;\311"
+	.text
+	.section	.gnu.lto_displayScreenSize.4.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"U\n"
+	.string	"\346\223H> \3458\035"
+	.string	",\004\b\002\306\225\322\336\200\310\003&[\225N\262(\n\b`\240\272\317;B\334\236\204\177\365/\307\215\323\211\n@(\035\305\203o\266l`\001\363\337\0174Y\375\324\310\336)\0055"
+	.string	"4"
+	.string	"8"
+	.string	"\366M~b\332/\240\fmD\246\001\013\260\273\037\347\033\356\233v\r\367\255\206\334<5\375\247\374"
+	.string	"&c\265R\247\231\207\3355e\2658\356z\333\b\266A\366\007\002.[\243\346~\376Z\245\246\224\372\031\017d\023\333\335\230\r\330\230\315\245\304\266i{v\006\300\347\324\376\353(\346O\324\005v]0-\273\247\202\023\272o>;;\246\225\253\016\035\253\232\262\035\361\330\210\345b\264\340\276\321j`O|\245\354vW\r\276\312\211\242#\371\346\243\270o\257\004\"/\025\235\331\363X*\300>S\264~\330\327\266\006^\370\200\036\b\006O\330\321\204 )d*Ibg\260S\021\222(\225\242\350+\311\360$\222\242\217$\206F\037H\226_\247\300c)$?\3238\222\237w\356m\256rT\025\303\036\325j\016"
+	.ascii	"t\263\240\314\2000L\204\t\031d\007\366\256t\326@\023\206k\342"
+	.ascii	"G\026\344\003\023\004\234\350Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_displayGrab.5.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`W\001\025\r"
+	.string	"\246XWB\020\221\223\016\340\023\350\313\363iD\251\202\001@\351X\211\021\310\315\340\201\200\322o\b\007\005\374\r\017\304\277F\310\202f\235\f$r"
+	.string	""
+	.string	"\200\002E\320\237\261h\203\002\244\271\005\204\240b\331&{\023)S\nB"
+	.string	"?"
+	.string	"F"
+	.string	"\366G\274\245\273\b\345\003vC/0\273\243\017#\210\177\036]\003\377\342=\340\237;[F\001\f\001\\|\\j\354\256\245 \336=;\377$\016"
+	.string	"\304\342yR\013v\327\tb\331p\353m\037\260\315\300>)W\216\030\242\224,Y\323\362b\323\206=\362\244~\260?\355\356ZC\366E\177fJ\307\227\246^\032N\351\247\351)\323\252\351\314\3649\004p\320\314\330\325P\272\261\244\267B\204\355W6\325\"\344\031J\3513tP\311\222\237B\375\370\304\\O\201=\355\200\231\034\374\245\2026\241\320\213\252\314\250S]yXQ\217m\bw!\211\273+\"\376\211\013\332\t\374K%`K\270\211\223\270\273\"~\211\007\\\f\361\347\243\300\277N\020r\2014P"
+	.string	"\202m<\260\253\3031\341:Y\364\265\261\300\211P\302e#\026\267a\024\262m\304\352d\034\022\353\3328kc\300Z\t\266Y&\232\266Y\325h?\255\206\374X\220RT\305QU`\0350\016\242Ai\324\177b>\001\302\033"
+	.string	"t\263\240L\350\020\032\030\017\204D\300|\333\270\217\034I\230Y1\215\001\214"
+	.ascii	"? \037\330\f\266\323BiD\021\002\334\201!1\240\246\031n\006{W"
+	.ascii	":\013\243\t\216\270\f\363\255F\207;\274h'\031"
+	.text
+	.section	.gnu.lto_displayRelease.6.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"=\f"
+	.string	"\226\027TA\020\221\232\016\340c\225\\N\247\273"
+	.string	"+\303\233\353\3336\001r3\340\254"
+	.string	"\364\033"
+	.string	"\353\216\2205\375\021^E\255o?(\250!\254\252\252^\351\312\007\0202\332\240"
+	.string	"i\034o\226j\377\333\356nR\246\024@"
+	.string	"="
+	.string	"B"
+	.string	"\377\260=\244\362\001\273\240\022&v9\020\037\210\177\346\356\001\377\342;\340\2377\033\006\001\n"
+	.string	"^x^f\354\356\244\033\276=7\377 \276\361i\341<3\nv\327\371i\271p\353m\033\260\275\300~'W\001.B\235\354\354\201b\305&\r\233\343\244j\260\037\355\356ZA\366C\177\214\322\360\245\337KGQZ5\235\231\276\024@\306\007\213]\013]\215\205y':\330\276dg\\D\236\366=\0041\335!\300H\237\276\002\206\225\354\254\032)\210'\246\372\210\022U\216\247\2202\252S-e`Q\216\355\006\1771\211\273,#\276\210\tX\n\374K\375\260\037<DJ\334\335\021\337\345\322\"\207?_\005\376\005F B\2050H\020Ri:*\352\332\240h\227\025Mi$l\034\234h\026\311\244eU\004+#\231.kc2Q\2316i\n\030;\251\262\t\005\303\262I\342\366\321*\310O\005LGW\f\225D\tG\213\177b<\205zO\024"
+	.string	"t\263\240L\350\345\013\214\007J\"`\223m\214D\016\2031\343\253\326"
+	.ascii	"#`\360\003\006k\206\353\3006\225\316\302g\202\003.\303|\253\321"
+	.ascii	"\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_displayReleaseAll.7.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"\365\n"
+	.string	"\266\324LC\020\213j:@\024ZI\251P\007aV\347\221\n\377\225E\002P\323T\357\b\300\344\261\\^hC'\355@h\264\232\232\376\026\004\222\b"
+	.string	"\240\002\b\204(\277\372\017F\210\016\312i\006\230\244\333\322&{\247\0247"
+	.string	"8"
+	.string	";"
+	.string	"\021v\313\214/\270W\227\307l\257\334/\333\253I\373\302D\211\203\006"
+	.string	"\256\330\356v\264\300\311O\322\377\202ST\253\323\347Dcw=U+\0017\275m\013\333\033\3663\001\306d\250\260Sf\227\247I\t\330\327vwMY\366[\277F\247\347\234\376\344a\202\004\205\335"
+	.string	"\263\r\373\252\022\020\330~\305\236\030\340|\332Op\005\344[\246C\354\262 \004\006\377"
+	.string	"d\201Q\3000<F\231\032\365\244\256\fH\321\223\355\360\256\017n7\325\361\035\214\214\245\355u\322\b\033\344\rJ\334\356v|\006\244\020\356\300\253o\332^O-\026Z\2509\013\306\340x\033\216\214\315\247\271|^\3103\032C gO#\342\351\020\215\340\247\033\305\217\004\212\237.\004z<:O\034;M\205C\321'v\2430\024\273J\271\327\226\262\\e/\024%\261\017\332\034\017"
+	.ascii	"t\263\240Lh\303\013\f\017\341\213\335\274\220\016\254i\206\226"
+	.ascii	"\001\334\225\342\302e\254\003\227\001\277\325\224p\207\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_displayIsGrabbed.8.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"\205\f"
+	.string	"&XXC\020\221\223\016s&\220\256\2661U\221\361_p!?*%\b\3410\b\031\324\277\221A\3065\3247\332\263\226\351\325\b92\312\261\205<\002"
+	.string	"("
+	.string	"\001}\325\210i>\332E:\271\031iN$\356\275\245L)H"
+	.string	"A"
+	.string	"E"
+	.string	"+\224\230\031\273\035\246 ^:|\232%\3770\1773\033X\244p%\207+\177O@\207\231\f\006h>\304\270\270\223\324\267aI\241\352\340N\217\243z\341p\230\247\ng\222\311\301`w\235)\034\206;\336\266\003\333\r\354\177\004\206O\375\372\322\251\351\307\250\201\306\003\305\356\205\225\215}\001W\204\260M\262/\233c\305\223i\177\304I\220\236\"9\200]T\013\231\335\356\2009\326\241\273\007\210\207\3267\361\320\266\023xH.y\234hMG\271a\312U\204\332\362\\bdd<Em\361.l\t7\261Y\273\247\005~\211\n\023,\227\303k\001\030)S\256\236\252\027\026\025j\222\250z\021'jNI\303\227\207\315\032vW\222\332b\377\355\356ZQ\2663F\340\311@\036("
+	.string	"\001u6\240L\364\031\331D!\313Y\307\302\007\202\310\026\n\3016\rD!\244\205`\242\320'\002\226i\033\326\031\340\221\bH\303FF#\r\273\272\375[E9\337\307S9OU\261\r\225\200IM\234\n5\021"
+	.ascii	"tS\320\301\320;1\274\032\027\001\327\200\034\260{\b[Nc\tX!\265"
+	.ascii	"{\n\226\221k`bY\034$\\zU\305\254`\356\001"
+	.text
+	.section	.gnu.lto_displayWrite.9.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`#\001U\r"
+	.string	"\366\331[C\020\223\222\016\345r\nh\024;@\n5\354\320G\260\214"
+	.string	"FhT\340\\&P\324n\036\3547\33450>\202\307\266\371\b\267\211\003"
+	.string	"\210(\200\200\035\374\366P39\3416V\322\024\215\335mo\"eJ\001F"
+	.string	"J"
+	.string	"F"
+	.string	"\017\260\033c3c\267C\340\003\361\317]\264\355\253\370\n\316\256Au$J\207\331@r\341cw\255\316\005\300?\352\"\360OG\234{r\376_\234J\341\341\364R\032=9\fv\327\371R\352p\353m\033\260\r\301>L4?\347\335\0175MiZa:_\372!\020\005\216\221\036\273\034N7{\343\3218a\233\263+\033\336\\T\215\205\021"
+	.string	"\353\322\342\303\003\0364&\007:.M[\301\305}\006\203u\027\304\216\006\361\017\332\270\236\366e\316\202{\307\022z\222\211\243\252\317A2e\227!!\356\272\224\37012\234\250\300\277\324\002\266\3500T\342\356\226\3706\032\205h\342\317g\201\177\327\001%dZ\362\344*\304\346\017\273\033\245\212\260O\255\306\330\232\256^\363\203|\346\217\017\333W~\341Npa$\021\026\220\200<\" ,\364I\331BY4\346Y\371L@\3312\023k\323@\0252\315\304\ne\237\023\013\3236\313C\300\"\024\220f\245\210D\232Uu{\273\322N\213jpH\202\250*\245P\235Zi\207\244#G\245\002\027"
+	.ascii	"t\263\240\314\2000\214$\023\304\252\020\203\241\3006\225\316"
+	.ascii	"zf\205\341\232\370\027\033\373k\241s\2410\030\006\202\200r`0"
+	.ascii	"0\002P!T\250!\340\304\223j\305$L2"
+	.text
+	.section	.gnu.lto_displayWriteChar.10.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`0\001u\r"
+	.string	"FZ\\C"
+	.string	"\223\223\016\240\210\n\372\277\007\250V\376I\365!x7D\270\312\246\262\031M\311P<F@\324\220\b^\256\020t\335\346\301\263\220\374\377\217\031\310U\305\206P\342\200\020i\335'^r\351\367ndo)S\nG"
+	.string	"I"
+	.string	"G"
+	.string	"+\027\260\3532Sc\267S\340\004\361\320]\264\355\263x\013\316\276\361\272\022\252\213\360\200\202\361cw1\317\007X\207\357\"\326\241\2228\367\344\374\307\370S\321\241GJuzn\034\354\2563\245\342p\353m#\260-\301>\212\253?\276\3737\232\206\232~\232V\230\316\227>"
+	.string	"k\205\216\0028v7\324\004\331\034\320\306\t\333\234}\331\326j\365!\202\013\031\225\007\330\226\035)\b)@\2326\003\020\367\030\025\353.\b\037\017\342\241\365\002z\332\207\371\013\356]O\217\242\211\252z\036(\032\n\2371\211\273\032H|\032\031J(\326a\352\001\333\302g\240\304\335%\361e\230\266h\342\320_\261\016\257\004^`X\262\306W\210M vwJ\035a\377\255\272\330\232\356<\346\017\271\314\317y\331S\216\341^"
+	.string	"\312F&4\030\021}DD\031)t\262\221F\321\331'%T\301\264\215J\260M\023]\030i%\030i\0242\3012m\303>\006\\2\2114\354\244T\322\260\253\333\333\035\365\260h\213\257T}\nu\243N\355\250\007\245'\207(\344h\030"
+	.ascii	"t\263\240\314\2000\f/\023\210\013m\253\002\007\206\002\333T:"
+	.ascii	"\353\232\025\206k\342\220\261\021\273&0(\f\f\001s 0P\"\030\001"
+	.ascii	"\250\020*\324\020p\342I\265b\022&\031"
+	.text
+	.section	.gnu.lto_displayIsTransferInProgress.11.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"-\n"
+	.string	"\006\024I? \3458\035"
+	.string	",\004X\002\016\007P\307\247\347JS\3561\"\250u\206B\034f\370\001>\037\b~\370(\324W\377r\3348\235\250"
+	.string	"\204\243\002\026\215m\021lJh\250*}\024\221\337\326\366N)5"
+	.string	"5"
+	.string	"7"
+	.string	"\005\365\033\367M\375f\333\017\036\224S/M\\\037\001\341\220\025\330-=Z\362\324g\312\177\3135\225\017\231\326K\365\251\231\330]\317\326\313\343\246\267\275`\233\302>\027\024f{\272>\366k\332\364\244\323\327\324"
+	.string	"\003\016bv]\263\003+`\003\220b\033ewv\355\360\314i\177\345,\250\307N'\330\205\021\230\331-\033\314\300}s\371\225J\204\260\250\312\266\305e!\030\r\321T\277M\232`c\374\205\344vY\021\276K)\203C\371\346\237\352\267S\203\223\330j\316\334\211\3544`\227\252II\354k\273\273\016v\360|\235\n\210\016\310\331\200\237\350C\"E!\347\217c\372\\\214\310\020\344\221#X\nG\220'\n?!\357\033I\217\203`q\004\216\036I\024G\257+\367\256TaE7\334M\215z\322\013"
+	.ascii	"t\263\240\314\2000,\204\271\031d\007\366\256t\3264\023\006\271"
+	.ascii	"fKw\210h\272\346\023"
+	.text
+	.section	.gnu.lto_displayHeartbeat.12.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"\035\n"
+	.string	"\366\223H? \3458\035"
+	.string	",\304\023x@P\036;"
+	.string	"\026\021\306\236\303\275"
+	.string	"\231\242\350"
+	.string	"\b\304\022\350\276\"\304\rE\300\277\372\007y=\235\250"
+	.string	"\204#\002\300<\177\017V\023\023\201\337\270\021\372\323&{\247\0243"
+	.string	"4"
+	.string	"7"
+	.string	"\013\334\253\313\033l\257\3349\333\253I[\300\313\220=\312k#V`w;\nr\362\223\364_r\r\253\225\372\314<\354\256'\253\325q\323\333V\260\035a?\023\251I?\354k\273\273\246.\373\260_\243\323sN\177\333^b\020\006\354r\314\016\254\254\266\210\330\376\306\256\004>\237\366GNB\036\206z\301\256k\205e\267dp\032\365\244\336x\254h\312v\370X\005\267\273\002\371)\031\343i{\235\364\300\266\370\311\211\333]\220ob\272\340^\257>j{=%\b"
+	.string	"S\315\231\247\212\013\200\235\006\3542n\370x\036\t\007\317\327\341|\336(T\032G g\257\203\021\232 \215\240\250\033\305\317\004\212\242n\004\206(:O\034\273N\202C\322'v\2450\024\273M\271\327\226\272\f\001#SQ\rkf\013"
+	.ascii	"t\263\240L\350\r\0076.<\260M\245\263\232\231\340\302e\300o5\005"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_displayResync.13.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"\035\n"
+	.string	"\366\223H? \3458\035"
+	.string	"<:6#0(\177\336\221\271B\3770&6"
+	.string	"8\357\242\t\210\342\001(\232\"\304\rE\300\277\372\007y=\235\250"
+	.string	"\204#\002\300<\177\017V\023\027^\001\r\330\023\242M\366N)3"
+	.string	"4"
+	.string	"7"
+	.string	"\013\334\253\313\033l\257\3349\333\253I{\300\313\220\275\n\311\006L\266\273\035\0059\371I\372?\271\206\325J}f\036v\327\223\325\352\270\351m+\330\216\260\237\t\251I?\354k\273\273\246.\373\257_\243\323sN\177\333d"
+	.string	"\020`v9f\0076V_Fl\177c\327\230\317\247\375\222\233\220\177\241^\260\353jq\331-\031\034\032\365\244\336x\254h\312vxX\005\267\273\002\371+\031\343i{\235\364\300\266x\312\211\333]\220\217b\272\340D^}\324\366zJ \340\245\2323O\026\002\001v\032\260\313n\370x\036\t\007\317\327\341|\336(T\032G g\257\203\021\232 \215\240\250\033\305\317\004\212\242n\004\206(:O\034\273N\202C\322'v\2450\024\273M\271\327\226\272\fQ \246\242\032\326\314\013"
+	.ascii	"t\263\240L\350\r\0076.<\260M\245\263\232\231\340\302e\300o5\005"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_displayTxBytesFree.14.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\265\n"
+	.string	"vTJ?@M\224\016\363:\037\263\355\242\002\346\371+\253\241o2\320\355\314\235}\027\220\316\264\325\253\357\350?\324\306\232\331E\316R\024\035\025\321\375\260\025\305\001<\364 \036\206\217\th(\204p[)S\n7"
+	.string	"5"
+	.string	"8"
+	.string	"\3669\274\203\307\237\214\027\"X)\324(\004\212\335\230]<\303:\314K\254C\265\360\317\363\343\377\303!\033$\250H%\320\363:\260\273NR\311t\353m\003\260\215\300\376GN_\217?\204i\205\244S\323\307.\223\211\215\325.\204\225\212-\001Ih\260\355\261#6TU2\355\243\356\301\363\3309\306\356\351\304\210\335(\300\001\260CG\314\016\t\325\251\252\006&\210\024d\233\273J\201\b\007\030\216v\330\335A0\300vE\005\374\324\346\3032\034\372\035\353\360\252\201\001\025\312\225#\0246S\330\021\224Z\301>d\365d\007\036P\321(\t\bP\266\211d\3232\226\315\227\3410k\023\216e\201\346\343.\331\347m\r8\357\222e8\013&\323\274/\233p\270\323l^\266\351:/\213\304\275/\365\b\351\003\253^\372\321\n\213\020"
+	.ascii	"t\263\240\314\2000\354\304\\\235\225\275 ;\245+\236\306\342J"
+	.ascii	"gm4a\270&Re\241_0A\300\t#\325\212I\230d"
+	.text
+	.section	.gnu.lto_displayInit.15.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`4\001E\r"
+	.string	"v\030ZE\360pj:\360vv^\034x\352\314\"s/\311\301>\213c\336\241L\257j\272Z\306\343\275o\332\376\217\b(T\320(\207\306#\227@\325\342\343\243\303\304\302\326\t4'\032\214\302\225\343\3021^\375i\223\275S\nB"
+	.string	"G"
+	.string	"G"
+	.string	"_A\376\225\272\200]\327\b\311n\251\300\t\266W\227'\240\275n\317h\257&m\033/C\354a04\270H\331]\216\206\234\374$\375\263xG\313C\365iq\260\273\236-\217\0167\275m\004\266#\330?\021\032\021\037\253\271\342\001(HTNv\342\260K\325\244 \354g\273\273\246.\373\345\237\375\365S:\375K\003\220\224\033\033\032\273\034VrlI\235A\302\3661v\r\361\314\022\203\201"
+	.string	"\313\202m\200\260\275\326\017\317\247}\025\001\217\361mb()V\345\344\0075{\302G@M\f\305\362\3412)\365\2511 ,\252\262=\272H\270\355\262>\376\013\024\205\355\244\275\236\026\250\361\232\"\036L2j\217oq\332v\367\343\303,T"
+	.string	"\020\033\361\352\247\264\327\237\b\324I@i^\340\361: \006\235\217\223\371<Rg\032I\340f\217s\241\023\225F0\304\215\342\207\002\305\020G\002\273\021\347\211#\3079\340\260\364\211\234)\fE\016S\356\263\245.?0Q\262\242\031Lv\227Q\302\304\3774\333\013\030"
+	.ascii	"t\263\240Lh\365\013\214\213\003\256yZ\001\306 \006\026\202\232"
+	.ascii	"\203c\2168\265P\032r|\r<\020\256\253\252\316TAP\r\306\324\004"
+	.ascii	"7\256\001\2650\f(\034\204\032\b\356\334\242\235O"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`\342"
+	.string	"\305\004"
+	.string	"\"F\027\"\240)\035?6\235:\031\2007|\r\362\377\377\177\306\332\377\366\277\375q\264\215\020B\b!\204\244-S\n\254\204\232\244\310\255 \367\362\270\025\207q\355fY\335\212~<\3408\240q\212\361iqI\361(q\b\361\347p\307\360\246p\206p\017\276\fr\023\362$%R\337\335\tnF\262\226\033"
+	.ascii	"`\b(\007\n\003%\203A\300 0.(\003d\003\346\001\315Z%G\255\001"
+	.ascii	"\003z\200o\200o\200o\200o\200o\200o\200o\200o\200o\200o\200o"
+	.ascii	"\200\037\2565\307"
+	.text
+	.section	.gnu.lto_.refs.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.bf6da6fd2bfdb140,"e",@progbits
+	.string	"(\265/\375`s\025\205]"
+	.string	"\232\227t!R0\022JJ\007\272=v$\243\313\034f,\312\356\352?\357y\307~\\\346\030\322&\363\224\320I\263n"
+	.string	"\302\211\030U\313\376\373\370s\353\276m\314\202\356\035:\316\363\334\rf\364\334]qW\205v\324\237\016!\033f\351\023\025\b\325\202b%O\"L\312\024\263\001"
+	.ascii	"\002\030\002\321\022"
+	.string	"\254\345\006IE\030\242\315\2236\274\304\236K\254\274\307%\326\263\222m\215E\243\246\305\253r^c\216\013\202\007\244VY\255\371\nc9\253\261\025\035e\313j\352\275I\346\023A\346\023>5\255$\330\252\376\006\366x\234\026\214KZ2\225\206\366\213\203\242\265\246\325\260\326\211\221\2524\255~\210]15[\245dL\364\312\316fj\024<\235\314\202\330\237\307\2448:\340\025a\323\303Y\372\263x\3611:\367~\335{It\225\271(_\255\036\357@\006\"&\244H\253?\213\375\354\305_\314\303\3152\351y\245\367\266<\302,\"rQ\255\206\005\255t\351\341\324\352G`\243\f\306Tn\317o\207\223\030&\255~\006\253\343sn/\202\312}q \373f\337\242\265<beY\304j\301w\376\346\362\263\357g\035\024?\257Ck\377{\370\231G:\004\333\t\232\362\037\313\317\2775\257\377q?\263r)p\375'\3633"
+	.string	"v\017\3617\023\366\357$\300\022\216"
+	.string	"i\020\371y\201 \037\177\367\263\260\306\3773\327\371[H\316q\376\236\372\231\201\237I\374\254\342e?\343\244\270\331\203\177G\375\\\374\271\205\237\207?\007\375\254\302\317)\374\214\302\317'\374\\\302\3174~\036\341\347\020~\376\340g\017~\336\340g\r~\316\340g\f~\236\361\363\005?\273\370\177\345g\021?\373\374l\301\377/?O\360_\313\317\022\374\037\340\347\b~\206\340g\031?\307\370\031\306\317\017\374\f\364\363\213\237[\374\314\342\347"
+	.string	"~\376\371y\305\317#\3767\360\337\355\277pooo\357\277a\373\033\353\027\322\005A\2027\367V}A\243\212t\220 \262\275L0\2424\235y\375\374\177\264\332\212\337\030N*\002(]vZ\215\325Y\\\265\325t\366"
+	.ascii	"\225\260\250\241\n\252\357)\3137+\007 \322\220\253d\360lI\031"
+	.ascii	"D\017\3415!\3324\221\023c\337Q\366\375\305^\332M\330\243\361"
+	.ascii	"\210\265\235=\305\321\236\246\022\262\334\321\022U\253o-\026"
+	.ascii	"\207\273\307=\353\033\213=\033\034\217X\377\206\352\2474X\246"
+	.ascii	"c\372\251\235\030\354\ti\332j\253$B\007}\372\342\302e|h:\363"
+	.ascii	"\244L\3411\022GK\016\272\332\354\244\220\3614K\323\331\265\305"
+	.ascii	"\f\343M\177\202\340)\320\330\337J\335lf/\233G\377\350\246Nj\037"
+	.ascii	"\335\243\2318\332K\274\346\254\307l\336\323\336\253\274\367F"
+	.ascii	"i\323;nS\004\267\2463/\215\031\232\2742\350\217\032\236\006\221"
+	.ascii	"<\367\016!\203\266\310\302s\f'\325*p\326tv\335\333\236\277~\366"
+	.ascii	"a\211\317\230\355\246Ur\357\220)\001\224bgwy\367\266\013\364"
+	.ascii	",\200\363V%/K\217\372\367\216FZ\227\302\204\251\332{#\265\216"
+	.ascii	"5M\013\221\244V\3736\222\243):\371>j\345\201\312\366\206\001"
+	.ascii	"\273\334\005\221\266j\202G\254\252\035{N\261r\212u\013\353ky"
+	.ascii	"\304z6Fc\317e\354\031\214=s\261g$\354\016\336\031\325-/J\232"
+	.ascii	"\273\363\231\240\322\2236\036\255\262U\031;\234\267\271-[\310"
+	.ascii	"\234\355\204LK\256VyL\3164+m\251U\026\023\354\241\255\313\252"
+	.ascii	"U\016\223\343\3454\306\005F\310\265\306G\0270_\274\234\262\220"
+	.ascii	"\264B`\332\032'O\255\262\027\246;\327q\227\313u.\236uB\275{\223"
+	.ascii	"B\346\023\314'T(XI\310V\365L\305\236\241X\023sr\301*h\313\255"
+	.ascii	"\270\263\334s\350\240\270\300\261\230\020\310\363G\264U\006\342"
+	.ascii	"\327T\342t\266\312?\340\200!\343V\345\315\207\205&\314Y\253\334"
+	.ascii	"\306n\034\354o\356\354\214\317\354\334\243/gv8W\302PQYa\177m"
+	.ascii	"\246S\226\262\355\001dSP]Bd\0137\215\262\254\223O\2175\331\273"
+	.ascii	"\354e,e)F3\005\305v\245\244R\340\364\030\003\215j\3657M\354\337"
+	.ascii	"\377z\223M\367\336\246\257\275MG:g\037\207\340\033N\340\277z"
+	.ascii	"\357\377\033\027_\367&\321;\30329KN\335\304\255\340\"\273\224"
+	.ascii	"I&\317mo\3232\354\n\271\344A\216\311\323^\253\001n\330\220\273"
+	.ascii	"l\257\230\352\363\366m/_\345\025\023\206e\373lZ\266O\344\316"
+	.ascii	"U>\221\367\266\314\235\2454\211\344e\330\025s\031\366d\362\\"
+	.ascii	"\345E\336\260\244\025\253|2\227Z\236\314\235eX\222\271T^1y\266"
+	.ascii	"\364\216\344\365H#\367\306J\226\312\273\244D\225l\332\201[\266"
+	.ascii	"\317Kw/K\221nS\002\367R=\233\350\222Q\214v\004\267td\226|r{\357"
+	.ascii	"%@\351\b\353y\225p\313&\317{\233\034\341\270J.\220-\3345\302"
+	.ascii	"p\310!T7\t\351\336\002n{\257\322\275H\276p\367^\344\275\367\327"
+	.ascii	"D\325\336\353\334YB\225\224\356\225\352Q\272T\3104\244{[\372"
+	.ascii	"\005\215\271\f\303z\376\244\211"
+	.string	"\205A\357\216\026\311\320Kw\325\304\206!\2437\351\216\2052\177\230i\234%.%R\306\244A&OYV\330\326t\366\266\310\242\264*w\267\\\302l\325\016GK\016<\330\264\332\n\277\314M\325Q\2116\357\230\212t\333LUd\246\254\261f\3552M\334Q\253\352Q\333\017\252\326\267E\0072\352\253w\340\260a\272+\363\032[\235Rj|@a\023\266My\262\365d\356\347\344\210YTW\031\235-\035^v\340\302S\2034u\370\330\301\211\257\n\017$^\255\031\257\221\231\2665\351\t\001F\357\355\007&j?/,X\322%<\365E\357\332t)\201\266Wcn\253a9ZohUBX\215\205\327\025\277\311Hr\244\221t\222\326\241\267\332\bG[\213\251\234\3214\0213) \035\307\241\242\016\216A@?5H\340\300\200\023N\320\271A\264a\354`\207\210\310\002\022\2026\206\305\rrh`\300s\241\031"
+	.ascii	"\\h\250H,\"\262\300\336\005\220\003@0f\370\035\206\214\0252V"
+	.ascii	"\254\207!\343\347G\006\320\017{\240\237\233\343\261(\006\243"
+	.ascii	"\031@\031Vc\016\243\242j$2\022Ro\020\177k\016#\022\212F\306b"
+	.ascii	"\fB\300\343(q\243\027\210E\237\243\221Q\321'\347\030\304\242"
+	.ascii	"\005K$\02650\022\2174\\0\3031\307\030D$\2621\254a\202\215a\221"
+	.ascii	"\005\225h\034\022\211\210\305_qH$\022\312\241\221cX\274\201C"
+	.ascii	"\254a\210F\021\221X\0242\342\024\2078\204T\3371\b\306\261h(\206"
+	.ascii	"_q\210c\006\3618T\314\001$22\272 \310g4\022\213,\030\025E(\352"
+	.ascii	"\240H\\\301X4,\3260\016\005p\034\022m\034\213C\"\016\340\321"
+	.ascii	"\030t,\032\211\020\342+^\b\375\330h\361CT!\3421b\3140Q\002\b"
+	.ascii	"\033\260B*h\030\022\275`\034\272\341c,\022e\030*\336\360)\032"
+	.ascii	"\032\272\340#T4\372\250 !TD\203\221X\\\337x\335g\032\315\033"
+	.ascii	"\357m\343!\240't\226\261-YU_S\214\2306S\306>\261\311\363\322"
+	.ascii	"e\336ft\276\202@Z\265\332v,\366k\233\2004\231*\250\021'd\306"
+	.ascii	"\004\333\264\252\242\272e\307\352\346\202\264z\237\024\353\353"
+	.ascii	"\232\233k0\r\375\211\201Ii\244'\322\035z\313\033\314\227\235"
+	.ascii	"\254\037s\2556\227\356\302Q\024\355\345M\327u\367%\333"
+	.string	"V\330G\330\214\201\265\272\343cb\317(\326\233\275=F\261\352\261>+qq,}rC\013\033\2541\254\257\016\b $"
+	.ascii	"Cb\367\333\352\262c\371\306\372\366\336\336x\215\347\204LAu\305"
+	.ascii	"\200\023\342\026eW\247\233\033\3139i\\IR\202\262+Z\226,l7\247"
+	.ascii	"\004\265\001H\362\b\213\375!\255\255\361\032\360\336|\331\233"
+	.ascii	"\202\312[\355\256hMi\262?+555PU\210\364\2070\255^\275\354\217"
+	.ascii	"\313\212\025\226\202\201\006\301\240\352\276\312\260\277iZ\032"
+	.ascii	"K\303h\021*\231\301\203\302%\201\313\250\301,\205\2344\"\"\""
+	.ascii	"\"\"I\222\244\003\241\005\204\030\306$\264\035\022`4-\227:\211"
+	.ascii	"\204d$IQI*m\006\266\006\212\226\361\246\2663J\020\302 \220\023"
+	.ascii	"J\214x\325\345\032\333\362\207aj\201D\224\374\013Q-\231\301r"
+	.ascii	"q y\207\216F\236\322/r?`L%[\310\364\330\340\016UF\024\304\005"
+	.ascii	"\252\346\206\001\220\211\020\005\346?u.s!,\213D\272\2717'IhV"
+	.ascii	"\222~\244\363K\rR{G\227\336\257\215r=\354t\t\373\230\227\253"
+	.ascii	"\022\n8q\213\202\022\240@pT\226!\226_\005*_D\357\302\340^\377"
+	.ascii	"\037\352\305\263e\246\006\300z&\320\350\262\240\f\334\365\267"
+	.ascii	"s\232\334\277bG\311\031\330\222\255\315\376\006\n\0328\306h\013"
+	.ascii	".C\224A7\230\250\365\035\215\r\0214\320\020{\337\005Ss\0014\n"
+	.ascii	"\211\244\313\240\275\033\034\327\217\217\030\340\b\325Pf\036"
+	.ascii	"f\003\262#\370Q6j\"\2209\027\224I|\244\226\022&\375HQ)\033\376"
+	.ascii	"'\023\353\224kBW3y\324\253\316\351\313\023\312Ig\312\275\031"
+	.ascii	"t(\001\257.1\277\325KG\216\244\032\247\002\362\301\367\f\264"
+	.ascii	"NR\251B\242\230\027\324i\200k\205\303p\372\233\fd\223\306f\245"
+	.ascii	"\354s\n\347\347\252:\303/X\221\217;\213\003<\227\365\321\223"
+	.ascii	"~\246\27092\330\376|b&.t\351U\257\022\034\ri[\253h\214\\%8\232"
+	.ascii	"\224V\022\016\325wG\200\345\207D%=nP)\201\357^\004Y\303\274\312"
+	.ascii	";\250'\374g+\300\001\024\311\316jfG9|q#\rL\340\242\247\230\006"
+	.ascii	"\320\226\341\214\034\241c\2066\223\241y\261p\343Uq=\274\205\337"
+	.ascii	"\340_\023\315\\-`\231S\364\330\003\2478\267c\024\\\002\037\322"
+	.ascii	"\027$?\361~,\355\217Bu;L\336\t\223<\003j\353\234\366\264i\001"
+	.ascii	"C\243\331\0260W\005*\333Q\215X\314\035\204\320\263L\303\333\r"
+	.ascii	"\364\217\365\007\360=\023B\001\300~\342\0055\302o\202\020\320"
+	.ascii	"6\233\210\314\336%>l\365\030\205O\031\360\r\227\362\360$Mb\246"
+	.ascii	"ns\325\251\351.o\t>\264\323\002\277\221\020\3721%\026w{\270n"
+	.ascii	"\324\033\321\251\240\232o\246\230\016\016\320^cc\035k\356\342"
+	.ascii	"@?\005\254M\356\177\315N\267!\211\320\253\233\023u\332x\330\330"
+	.ascii	"\234\030\t~\263J\206\334\250\253B\366\b\033g\253\217\025oU8\216"
+	.ascii	"\312\321k\257\352Q\245/\353\034\320\004u93>\213\370\336-&K\r"
+	.ascii	"\276l\210\236Zk\0208Z9\314\027\236\006\235\277i>Z\321m\343\307"
+	.ascii	"\320=yM\270d\t\214\033;\250`?Go\314_9\334\003\244g\nOx>/'\365"
+	.ascii	"w\237\327\034\334<\311\310%\200\021\232m\363\332C?$\355\330\340"
+	.ascii	"\370'\341>\243\026,\362\246ae\3208\360\007sO\314\336\216\221"
+	.ascii	"\373\003\357\372\267z\317\234\334\377\007(\033E\311\227\277\034"
+	.ascii	"\030\376\310\206\241\031\220\207\016\204\357\246\227k\347\237"
+	.ascii	"\205f\353\235m`\225|\371kK7\007\362\376\271\037~\3004~\346\213"
+	.ascii	"\027X\261zw\222\2014\370\037r\021N\264\374ErO\334\310v\024A:"
+	.ascii	"\320\303*"
+	.text
+	.section	.gnu.lto_.symtab.bf6da6fd2bfdb140,"e",@progbits
+	.string	"displayClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"displayDrawScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"displayScreenSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"displayGrab"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"displayRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"displayReleaseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"displayIsGrabbed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"displayIsTransferInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\001"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"displayResync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"displayTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bf6da6fd2bfdb140,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9491 @@
+	.file	"serial.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/drivers/serial.h"
+	.file 4 "./src/main/drivers/serial.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	serial.c.b34f6a85
+	.weak	serial.c.b34f6a85
+serial.c.b34f6a85:
+	.long	0x602
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x12
+	.long	.LASF1447
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1370
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1371
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1372
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1373
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1374
+	.uleb128 0x6
+	.long	.LASF1376
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1375
+	.uleb128 0x6
+	.long	.LASF1377
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	.LASF1378
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1379
+	.uleb128 0x14
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1380
+	.uleb128 0xc
+	.long	0x80
+	.uleb128 0x6
+	.long	.LASF1381
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xc
+	.long	0x8c
+	.uleb128 0x15
+	.long	0x8c
+	.uleb128 0x6
+	.long	.LASF1382
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x6
+	.long	.LASF1383
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1384
+	.uleb128 0x4
+	.long	0x87
+	.uleb128 0xe
+	.long	.LASF1388
+	.long	0x30
+	.byte	0x16
+	.long	0xe7
+	.uleb128 0x5
+	.long	.LASF1385
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1386
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1387
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1388
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x3
+	.long	0xc6
+	.uleb128 0xe
+	.long	.LASF1389
+	.long	0x30
+	.byte	0x1c
+	.long	0x13e
+	.uleb128 0x5
+	.long	.LASF1390
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1391
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1392
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1393
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1394
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1395
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF1396
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1397
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1398
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1399
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1389
+	.byte	0x3
+	.byte	0x2f
+	.byte	0x3
+	.long	0xf3
+	.uleb128 0x6
+	.long	.LASF1400
+	.byte	0x3
+	.byte	0x31
+	.byte	0x10
+	.long	0x156
+	.uleb128 0x4
+	.long	0x15b
+	.uleb128 0x8
+	.long	0x166
+	.uleb128 0x3
+	.long	0xa2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1401
+	.byte	0x3
+	.byte	0x32
+	.byte	0x10
+	.long	0x172
+	.uleb128 0x4
+	.long	0x177
+	.uleb128 0x8
+	.long	0x187
+	.uleb128 0x3
+	.long	0x187
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x98
+	.uleb128 0xf
+	.long	.LASF1417
+	.byte	0x50
+	.byte	0x34
+	.byte	0x10
+	.long	0x24d
+	.uleb128 0x1
+	.long	.LASF1402
+	.byte	0x36
+	.byte	0x24
+	.long	0x2ef
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1403
+	.byte	0x38
+	.byte	0xd
+	.long	0x8c
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1404
+	.byte	0x39
+	.byte	0x10
+	.long	0xe7
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1405
+	.byte	0x3a
+	.byte	0x13
+	.long	0x13e
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1406
+	.byte	0x3c
+	.byte	0xe
+	.long	0xae
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1407
+	.byte	0x3e
+	.byte	0xe
+	.long	0xae
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1408
+	.byte	0x3f
+	.byte	0xe
+	.long	0xae
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1409
+	.byte	0x40
+	.byte	0x17
+	.long	0x2f4
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1410
+	.byte	0x41
+	.byte	0x17
+	.long	0x2f4
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1411
+	.byte	0x42
+	.byte	0xe
+	.long	0xae
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1412
+	.byte	0x43
+	.byte	0xe
+	.long	0xae
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF1413
+	.byte	0x44
+	.byte	0xe
+	.long	0xae
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1414
+	.byte	0x45
+	.byte	0xe
+	.long	0xae
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF1415
+	.byte	0x47
+	.byte	0x1e
+	.long	0x14a
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1416
+	.byte	0x48
+	.byte	0x23
+	.long	0x166
+	.byte	0x48
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1418
+	.byte	0x60
+	.byte	0x5a
+	.byte	0x8
+	.long	0x2ea
+	.uleb128 0x1
+	.long	.LASF1419
+	.byte	0x5b
+	.byte	0xc
+	.long	0x31f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1420
+	.byte	0x5d
+	.byte	0x10
+	.long	0x338
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1421
+	.byte	0x5e
+	.byte	0x10
+	.long	0x338
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1422
+	.byte	0x60
+	.byte	0xf
+	.long	0x34c
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1423
+	.byte	0x63
+	.byte	0xc
+	.long	0x361
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1424
+	.byte	0x65
+	.byte	0xb
+	.long	0x37c
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1425
+	.byte	0x67
+	.byte	0xc
+	.long	0x391
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1426
+	.byte	0x69
+	.byte	0xc
+	.long	0x3b1
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1427
+	.byte	0x6b
+	.byte	0xc
+	.long	0x3c1
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1428
+	.byte	0x6c
+	.byte	0xc
+	.long	0x3c1
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1429
+	.byte	0x6f
+	.byte	0xb
+	.long	0x3e4
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x71
+	.byte	0xb
+	.long	0x3fd
+	.byte	0x58
+	.byte	0
+	.uleb128 0xc
+	.long	0x24d
+	.uleb128 0x4
+	.long	0x2ea
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x6
+	.long	.LASF1431
+	.byte	0x3
+	.byte	0x49
+	.byte	0x3
+	.long	0x18c
+	.uleb128 0xc
+	.long	0x2f9
+	.uleb128 0x8
+	.long	0x31a
+	.uleb128 0x3
+	.long	0x31a
+	.uleb128 0x3
+	.long	0x8c
+	.byte	0
+	.uleb128 0x4
+	.long	0x2f9
+	.uleb128 0x4
+	.long	0x30a
+	.uleb128 0xb
+	.long	0xae
+	.long	0x333
+	.uleb128 0x3
+	.long	0x333
+	.byte	0
+	.uleb128 0x4
+	.long	0x305
+	.uleb128 0x4
+	.long	0x324
+	.uleb128 0xb
+	.long	0x8c
+	.long	0x34c
+	.uleb128 0x3
+	.long	0x31a
+	.byte	0
+	.uleb128 0x4
+	.long	0x33d
+	.uleb128 0x8
+	.long	0x361
+	.uleb128 0x3
+	.long	0x31a
+	.uleb128 0x3
+	.long	0xae
+	.byte	0
+	.uleb128 0x4
+	.long	0x351
+	.uleb128 0xb
+	.long	0x375
+	.long	0x375
+	.uleb128 0x3
+	.long	0x333
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1432
+	.uleb128 0x4
+	.long	0x366
+	.uleb128 0x8
+	.long	0x391
+	.uleb128 0x3
+	.long	0x31a
+	.uleb128 0x3
+	.long	0xe7
+	.byte	0
+	.uleb128 0x4
+	.long	0x381
+	.uleb128 0x8
+	.long	0x3ab
+	.uleb128 0x3
+	.long	0x31a
+	.uleb128 0x3
+	.long	0x3ab
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x3b0
+	.uleb128 0x16
+	.uleb128 0x4
+	.long	0x396
+	.uleb128 0x8
+	.long	0x3c1
+	.uleb128 0x3
+	.long	0x31a
+	.byte	0
+	.uleb128 0x4
+	.long	0x3b6
+	.uleb128 0xb
+	.long	0x64
+	.long	0x3df
+	.uleb128 0x3
+	.long	0x31a
+	.uleb128 0x3
+	.long	0x3df
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0x4
+	.long	0x3c6
+	.uleb128 0xb
+	.long	0x375
+	.long	0x3fd
+	.uleb128 0x3
+	.long	0x31a
+	.uleb128 0x3
+	.long	0x166
+	.byte	0
+	.uleb128 0x4
+	.long	0x3e9
+	.uleb128 0x9
+	.long	.LASF1433
+	.byte	0x7e
+	.long	0x418
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x7e
+	.byte	0x23
+	.long	0x31a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1434
+	.byte	0x78
+	.long	0x42e
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x78
+	.byte	0x25
+	.long	0x31a
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1436
+	.byte	0x73
+	.long	0x45a
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x73
+	.byte	0x1f
+	.long	0x7e
+	.uleb128 0x2
+	.long	.LASF1437
+	.byte	0x73
+	.byte	0x38
+	.long	0x187
+	.uleb128 0x2
+	.long	.LASF1438
+	.byte	0x73
+	.byte	0x42
+	.long	0x64
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1439
+	.byte	0x6e
+	.long	0x47b
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x6e
+	.byte	0x22
+	.long	0x31a
+	.uleb128 0x2
+	.long	.LASF1404
+	.byte	0x6e
+	.byte	0x37
+	.long	0xe7
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1424
+	.byte	0x69
+	.byte	0x5
+	.long	0x375
+	.long	0x496
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x69
+	.byte	0x35
+	.long	0x333
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1423
+	.byte	0x64
+	.long	0x4b7
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x64
+	.byte	0x26
+	.long	0x31a
+	.uleb128 0x2
+	.long	.LASF1406
+	.byte	0x64
+	.byte	0x39
+	.long	0xae
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1440
+	.byte	0x5c
+	.byte	0x5
+	.long	0x375
+	.long	0x4dd
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x5c
+	.byte	0x2c
+	.long	0x31a
+	.uleb128 0x2
+	.long	.LASF1441
+	.byte	0x5c
+	.byte	0x54
+	.long	0x166
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1442
+	.byte	0x4c
+	.byte	0x5
+	.long	0x64
+	.long	0x519
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x4c
+	.byte	0x21
+	.long	0x31a
+	.uleb128 0x2
+	.long	.LASF1437
+	.byte	0x4c
+	.byte	0x34
+	.long	0x3df
+	.uleb128 0x2
+	.long	.LASF1438
+	.byte	0x4c
+	.byte	0x3e
+	.long	0x64
+	.uleb128 0x10
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x53
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1422
+	.byte	0x47
+	.byte	0x9
+	.long	0x8c
+	.long	0x534
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x47
+	.byte	0x22
+	.long	0x31a
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1443
+	.byte	0x42
+	.byte	0xa
+	.long	0xae
+	.long	0x54f
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x42
+	.byte	0x30
+	.long	0x333
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1444
+	.byte	0x3d
+	.byte	0xa
+	.long	0xae
+	.long	0x56a
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x3d
+	.byte	0x33
+	.long	0x333
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1445
+	.byte	0x2e
+	.long	0x5a1
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x2e
+	.byte	0x23
+	.long	0x31a
+	.uleb128 0x2
+	.long	.LASF1437
+	.byte	0x2e
+	.byte	0x3c
+	.long	0x187
+	.uleb128 0x2
+	.long	.LASF1438
+	.byte	0x2e
+	.byte	0x46
+	.long	0x64
+	.uleb128 0x10
+	.uleb128 0xd
+	.string	"p"
+	.byte	0x33
+	.byte	0x1d
+	.long	0x187
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1419
+	.byte	0x28
+	.long	0x5c1
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x28
+	.byte	0x20
+	.long	0x31a
+	.uleb128 0x11
+	.string	"ch"
+	.byte	0x28
+	.byte	0x32
+	.long	0x8c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1446
+	.byte	0x23
+	.byte	0xa
+	.long	0xae
+	.long	0x5dc
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x23
+	.byte	0x2a
+	.long	0x31a
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1448
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x1b
+	.byte	0x20
+	.long	0x31a
+	.uleb128 0x11
+	.string	"str"
+	.byte	0x1b
+	.byte	0x36
+	.long	0xc1
+	.uleb128 0xd
+	.string	"ch"
+	.byte	0x1d
+	.byte	0xd
+	.long	0x8c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x7
+	.file 8 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 22 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.file 23 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 24 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x18
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 26 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x1a
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x4
+	.file 27 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3
+	.file 28 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1c
+	.file 29 "./src/main/drivers/resource.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 30 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 31 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x1f
+	.file 32 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 33 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1369
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF807
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF768
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF908
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF961
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF969
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF988
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1000
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1368
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF1
+	.long	.LASF1449
+	.long	.LASF1450
+	.long	.LASF1451
+	.long	.LASF1452
+	.long	.LASF1453
+	.long	.LASF1454
+	.long	.LASF1455
+	.long	.LASF1456
+	.long	.LASF1457
+	.long	.LASF1458
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x22
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1459
+	.byte	0x6
+	.long	.LASF1460
+	.byte	0x6
+	.long	.LASF1461
+	.byte	0x2
+	.long	.LASF1462
+	.byte	0x2
+	.long	.LASF1463
+	.byte	0x9
+	.long	.LASF1464
+	.byte	0xa
+	.long	.LASF1465
+	.byte	0xa
+	.long	.LASF1465
+	.byte	0x9
+	.long	.LASF1466
+	.byte	0x6
+	.long	.LASF1467
+	.byte	0x9
+	.long	.LASF1468
+	.byte	0x9
+	.long	.LASF1469
+	.byte	0x6
+	.long	.LASF1470
+	.byte	0x6
+	.long	.LASF1471
+	.byte	0x8
+	.long	.LASF1472
+	.byte	0x6
+	.long	.LASF1473
+	.byte	0x7
+	.long	.LASF1474
+	.byte	0x7
+	.long	.LASF1475
+	.byte	0x6
+	.long	.LASF1476
+	.byte	0x6
+	.long	.LASF1477
+	.byte	0x6
+	.long	.LASF1478
+	.byte	0x6
+	.long	.LASF1479
+	.byte	0x5
+	.long	.LASF1480
+	.byte	0x4
+	.long	.LASF1481
+	.byte	0x3
+	.long	.LASF1482
+	.byte	0xa
+	.long	.LASF1483
+	.byte	0x4
+	.long	.LASF1484
+	.byte	0x1
+	.long	.LASF1485
+	.byte	0x2
+	.long	.LASF1486
+	.byte	0x2
+	.long	.LASF1487
+	.byte	0x2
+	.long	.LASF1488
+	.byte	0x2
+	.long	.LASF1489
+	.byte	0x1
+	.long	.LASF1490
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1410:
+	.string	"txBuffer"
+.LASF1400:
+	.string	"serialReceiveCallbackPtr"
+.LASF1283:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF793:
+	.string	"TELEMETRY_CRSF "
+.LASF1249:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF783:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1129:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1220:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1442:
+	.string	"serialReadBuf"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF860:
+	.string	"NULL ((void *)0)"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1403:
+	.string	"identifier"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1047:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1334:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF951:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF996:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1272:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1134:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF763:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1266:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1227:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF522:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1200:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1352:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF967:
+	.string	"IOCFG_IPD 0"
+.LASF867:
+	.string	"U_ID_0 0"
+.LASF1218:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1012:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1056:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1044:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1117:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF879:
+	.string	"USE_UART1 "
+.LASF1080:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1170:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1435:
+	.string	"instance"
+.LASF970:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF862:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1060:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1112:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1172:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1010:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF885:
+	.string	"USE_UART7 "
+.LASF1253:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1239:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1296:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF932:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1161:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1011:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF925:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1317:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF939:
+	.string	"__enable_irq() "
+.LASF823:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF986:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1407:
+	.string	"rxBufferSize"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1191:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1095:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF779:
+	.string	"USE_SERIALRX_SUMD "
+.LASF858:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF807:
+	.string	"VTX_TRAMP "
+.LASF1316:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1263:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1367:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF816:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF837:
+	.string	"_GCC_SIZE_T "
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1154:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1229:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1006:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF796:
+	.string	"TELEMETRY_MAVLINK "
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1092:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF827:
+	.string	"_T_SIZE "
+.LASF1270:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF982:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1235:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1441:
+	.string	"callback"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1443:
+	.string	"serialTxBytesFree"
+.LASF1149:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF923:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1008:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1100:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1096:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1298:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1241:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1113:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF868:
+	.string	"U_ID_1 1"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1159:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF806:
+	.string	"VTX_SMARTAUDIO "
+.LASF895:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1098:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1021:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF801:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF546:
+	.string	"__always_inline"
+.LASF825:
+	.string	"_SYS_SIZE_T_H "
+.LASF776:
+	.string	"USE_SERIALRX_IBUS "
+.LASF790:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1433:
+	.string	"serialEndWrite"
+.LASF880:
+	.string	"USE_UART2 "
+.LASF1379:
+	.string	"long int"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1293:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF907:
+	.string	"TELEMETRY_MAVLINK"
+.LASF942:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1224:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1076:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1361:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1384:
+	.string	"float"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF953:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF815:
+	.string	"_PTRDIFF_T_ "
+.LASF822:
+	.string	"__size_t__ "
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1281:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1101:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1196:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF911:
+	.string	"VTX_COMMON"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF909:
+	.string	"USE_DASHBOARD"
+.LASF898:
+	.string	"USE_SERIALRX_XBUS"
+.LASF947:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF787:
+	.string	"TELEMETRY_LTM "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1179:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF937:
+	.string	"EEPROM_SIZE 32768"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF784:
+	.string	"TELEMETRY "
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1024:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF956:
+	.string	"Q12 (1 << 12)"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF940:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF962:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1350:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1115:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1374:
+	.string	"signed char"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1381:
+	.string	"uint8_t"
+.LASF1152:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1030:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF886:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1110:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF799:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1094:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF905:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF913:
+	.string	"VTX_SMARTAUDIO"
+.LASF1181:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1370:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1295:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1036:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1007:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1430:
+	.string	"setRxFrameCallback"
+.LASF1284:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF835:
+	.string	"__DEFINED_size_t "
+.LASF1238:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1164:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1163:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1126:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF786:
+	.string	"TELEMETRY_HOTT "
+.LASF1308:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1093:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1135:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF881:
+	.string	"USE_UART3 "
+.LASF1315:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1070:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF985:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1184:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1390:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1277:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1432:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF968:
+	.string	"IOCFG_IPU 0"
+.LASF831:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF859:
+	.string	"NULL"
+.LASF1064:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF1035:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF778:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1212:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1262:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1142:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF1420:
+	.string	"serialTotalRxWaiting"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1399:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1013:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1341:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF899:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1428:
+	.string	"endWrite"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF919:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1377:
+	.string	"__uint16_t"
+.LASF976:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF924:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1084:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1073:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1116:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1130:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF805:
+	.string	"VTX_CONTROL "
+.LASF973:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF929:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF872:
+	.string	"USE_FAKE_GYRO "
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF987:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF1022:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1313:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1424:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF834:
+	.string	"_SIZE_T_DECLARED "
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1290:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1009:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1107:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1169:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1448:
+	.string	"serialPrint"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1415:
+	.string	"rxCallback"
+.LASF995:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF775:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1331:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF972:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF863:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF999:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF961:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1176:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1062:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF853:
+	.string	"__INT_WCHAR_T_H "
+.LASF894:
+	.string	"USE_SERIALRX_SBUS"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF840:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1197:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF971:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1108:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF777:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1414:
+	.string	"txBufferTail"
+.LASF1002:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1436:
+	.string	"serialWriteBufShim"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF928:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF1059:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF400:
+	.string	"bool _Bool"
+.LASF839:
+	.string	"__size_t "
+.LASF1362:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF975:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1376:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1347:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF848:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF766:
+	.string	"I2C1_OVERCLOCK true"
+.LASF866:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1396:
+	.string	"SERIAL_UNIDIR"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1250:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF896:
+	.string	"USE_SERIALRX_SUMD"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1133:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1054:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF974:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1051:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF869:
+	.string	"U_ID_2 2"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF900:
+	.string	"LED_STRIP"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1077:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1157:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1311:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1209:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1387:
+	.string	"MODE_RXTX"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF803:
+	.string	"USE_SENSOR_NAMES "
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF910:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1301:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1368:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1409:
+	.string	"rxBuffer"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1206:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1286:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF935:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1426:
+	.string	"writeBuf"
+.LASF1040:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF826:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF933:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF770:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF818:
+	.string	"_GCC_PTRDIFF_T "
+.LASF992:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF993:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1199:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1413:
+	.string	"txBufferHead"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1061:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1016:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF945:
+	.string	"VERY_FAST_MATH "
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF955:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1245:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1444:
+	.string	"serialRxBytesWaiting"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF870:
+	.string	"LED0_PIN NONE"
+.LASF988:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1322:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1089:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF875:
+	.string	"BARO "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1251:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF785:
+	.string	"TELEMETRY_FRSKY "
+.LASF1065:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF887:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF817:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1328:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF812:
+	.string	"_T_PTRDIFF_ "
+.LASF965:
+	.string	"IOCFG_AF_PP 0"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1369:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF903:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF957:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF808:
+	.string	"_STDDEF_H "
+.LASF1232:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF990:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1221:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF769:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF768:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF844:
+	.string	"_T_WCHAR_ "
+.LASF1412:
+	.string	"rxBufferTail"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1091:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1378:
+	.string	"__uint32_t"
+.LASF1145:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1307:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1185:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF829:
+	.string	"_SIZE_T_ "
+.LASF1171:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF891:
+	.string	"SERIAL_RX"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1114:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF991:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1365:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1421:
+	.string	"serialTotalTxFree"
+.LASF1103:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1049:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1043:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1401:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF915:
+	.string	"BLACKBOX"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1119:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1004:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1323:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1041:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1418:
+	.string	"serialPortVTable"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF781:
+	.string	"USE_SERIALRX_XBUS "
+.LASF828:
+	.string	"__SIZE_T "
+.LASF1182:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF998:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF1269:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1364:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1078:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1416:
+	.string	"rxFrameCallback"
+.LASF499:
+	.string	"__PMT"
+.LASF1045:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1329:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1188:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1052:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1388:
+	.string	"portMode_t"
+.LASF1003:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1123:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF952:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1292:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1079:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1032:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF966:
+	.string	"IOCFG_AF_OD 0"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF810:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1438:
+	.string	"count"
+.LASF948:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF789:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1265:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1372:
+	.string	"unsigned int"
+.LASF958:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1075:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF855:
+	.string	"_WCHAR_T_DECLARED "
+.LASF788:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1325:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1175:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1118:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1254:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF813:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF981:
+	.string	"BIT(x) (1 << (x))"
+.LASF811:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1001:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1125:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF1026:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1422:
+	.string	"serialRead"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF797:
+	.string	"TELEMETRY_SRXL "
+.LASF545:
+	.string	"__wur "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF901:
+	.string	"TELEMETRY_FRSKY"
+.LASF1187:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF402:
+	.string	"false 0"
+.LASF1058:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1446:
+	.string	"serialGetBaudRate"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF1190:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF401:
+	.string	"true 1"
+.LASF819:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF873:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF941:
+	.string	"sq(x) ((x)*(x))"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1287:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1090:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1031:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1131:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF888:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1244:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF943:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF1408:
+	.string	"txBufferSize"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF836:
+	.string	"___int_size_t_h "
+.LASF1340:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1233:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF843:
+	.string	"_WCHAR_T "
+.LASF1440:
+	.string	"serialSetRxFrameCallback"
+.LASF877:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1332:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1353:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1155:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF876:
+	.string	"USE_FAKE_BARO "
+.LASF833:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1139:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF800:
+	.string	"USE_MSP_PUSH "
+.LASF959:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1085:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1380:
+	.string	"char"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF824:
+	.string	"_SIZE_T "
+.LASF851:
+	.string	"_WCHAR_T_H "
+.LASF1310:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1193:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1071:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1074:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1203:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF1055:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF914:
+	.string	"VTX_TRAMP"
+.LASF1395:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1083:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1326:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1423:
+	.string	"serialSetBaudRate"
+.LASF1025:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1371:
+	.string	"short unsigned int"
+.LASF917:
+	.string	"USE_SERVOS"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF782:
+	.string	"BLACKBOX "
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF871:
+	.string	"GYRO "
+.LASF918:
+	.string	"USE_DSHOT"
+.LASF938:
+	.string	"__disable_irq() "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF893:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1132:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1447:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF1072:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1099:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1304:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1029:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF846:
+	.string	"__WCHAR_T "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF854:
+	.string	"_GCC_WCHAR_T "
+.LASF1398:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1086:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF936:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1088:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1053:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1033:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1048:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1034:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF794:
+	.string	"TELEMETRY_IBUS "
+.LASF983:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1005:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1081:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF393:
+	.string	"SITL 1"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1057:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1136:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF832:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1406:
+	.string	"baudRate"
+.LASF1382:
+	.string	"uint16_t"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF814:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1160:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1373:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1067:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1106:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1356:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF912:
+	.string	"VTX_CONTROL"
+.LASF1121:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1271:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1280:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF1037:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF1319:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF883:
+	.string	"USE_UART5 "
+.LASF1335:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1019:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF892:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1066:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1226:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1445:
+	.string	"serialWriteBuf"
+.LASF850:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1257:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF792:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF586:
+	.string	"__stub_stty "
+.LASF882:
+	.string	"USE_UART4 "
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF798:
+	.string	"USE_DASHBOARD "
+.LASF989:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1397:
+	.string	"SERIAL_BIDIR"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1259:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1068:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1417:
+	.string	"serialPort_s"
+.LASF1431:
+	.string	"serialPort_t"
+.LASF830:
+	.string	"_BSD_SIZE_T_ "
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF861:
+	.string	"__need_NULL"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF845:
+	.string	"_T_WCHAR "
+.LASF1419:
+	.string	"serialWrite"
+.LASF1338:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF772:
+	.string	"USE_PPM "
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1305:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1355:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF847:
+	.string	"_WCHAR_T_ "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF944:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF849:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF802:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF765:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1213:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF969:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1039:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1178:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1314:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1394:
+	.string	"SERIAL_PARITY_NO"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1122:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1268:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF773:
+	.string	"USE_PWM "
+.LASF838:
+	.string	"_SIZET_ "
+.LASF1017:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF884:
+	.string	"USE_UART6 "
+.LASF774:
+	.string	"SERIAL_RX "
+.LASF841:
+	.string	"__wchar_t__ "
+.LASF791:
+	.string	"GPS "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF767:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1278:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1344:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1215:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1275:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1082:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF889:
+	.string	"USE_PPM"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1434:
+	.string	"serialBeginWrite"
+.LASF804:
+	.string	"VTX_COMMON "
+.LASF1242:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1194:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1148:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1299:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1391:
+	.string	"SERIAL_INVERTED"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1127:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1124:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1050:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1427:
+	.string	"beginWrite"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1217:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF927:
+	.string	"USED_TIMERS 0"
+.LASF1173:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1375:
+	.string	"short int"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1087:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1404:
+	.string	"mode"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1248:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1358:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF954:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1385:
+	.string	"MODE_RX"
+.LASF1140:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1102:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1018:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1439:
+	.string	"serialSetMode"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF821:
+	.string	"__need_ptrdiff_t"
+.LASF1214:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1337:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF994:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1346:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1158:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1223:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF934:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF964:
+	.string	"IOCFG_OUT_OD 0"
+.LASF842:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1015:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF856:
+	.string	"__DEFINED_wchar_t "
+.LASF1389:
+	.string	"portOptions_t"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF980:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF771:
+	.string	"USE_CLI "
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1111:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1137:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1027:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1260:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF960:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF852:
+	.string	"___int_wchar_t_h "
+.LASF984:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF920:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF949:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1320:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1349:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1359:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1167:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1411:
+	.string	"rxBufferHead"
+.LASF1166:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1386:
+	.string	"MODE_TX"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1208:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF857:
+	.string	"_BSD_WCHAR_T_"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1383:
+	.string	"uint32_t"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF979:
+	.string	"UNUSED(x) (void)(x)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1143:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF963:
+	.string	"IOCFG_OUT_PP 0"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1230:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF930:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF764:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF946:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1205:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1425:
+	.string	"setMode"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1366:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF1429:
+	.string	"readBuf"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF922:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF977:
+	.string	"EXPAND_I(x) x"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1069:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1128:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1020:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1392:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1393:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1104:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF795:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF780:
+	.string	"USE_SERIALRX_SUMH "
+.LASF820:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1302:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF997:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF950:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1120:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1105:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1097:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1405:
+	.string	"options"
+.LASF1063:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1109:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF902:
+	.string	"TELEMETRY_HOTT"
+.LASF1141:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF809:
+	.string	"_STDDEF_H_ "
+.LASF1274:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF978:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1038:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1151:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1402:
+	.string	"vTable"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF890:
+	.string	"USE_PWM"
+.LASF931:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1256:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1042:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1437:
+	.string	"data"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1289:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1343:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1000:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1023:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1211:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1202:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF926:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF864:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1247:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF908:
+	.string	"TELEMETRY_IBUS"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF1028:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF921:
+	.string	"USE_PROFILE "
+.LASF1236:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1466:
+	.string	"libc-header-start.h"
+.LASF1474:
+	.string	"stubs-64.h"
+.LASF1479:
+	.string	"platform.h"
+.LASF1457:
+	.string	"/usr/include"
+.LASF1478:
+	.string	"stdint-intn.h"
+.LASF1489:
+	.string	"utils.h"
+.LASF1452:
+	.string	"src/main/target"
+.LASF1477:
+	.string	"wchar.h"
+.LASF1467:
+	.string	"features.h"
+.LASF1470:
+	.string	"timesize.h"
+.LASF1486:
+	.string	"resource.h"
+.LASF1460:
+	.string	"stdint-uintn.h"
+.LASF1456:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1458:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1484:
+	.string	"maths.h"
+.LASF0:
+	.string	"./src/main/drivers/serial.c"
+.LASF1476:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1450:
+	.string	"src/main/drivers"
+.LASF1488:
+	.string	"io_def.h"
+.LASF1462:
+	.string	"serial.c"
+.LASF1454:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1487:
+	.string	"io_types.h"
+.LASF1475:
+	.string	"typesizes.h"
+.LASF1461:
+	.string	"serial.h"
+.LASF1473:
+	.string	"stubs.h"
+.LASF1455:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1482:
+	.string	"stddef.h"
+.LASF1468:
+	.string	"features-time64.h"
+.LASF1483:
+	.string	"common_post.h"
+.LASF1480:
+	.string	"common.h"
+.LASF1481:
+	.string	"target.h"
+.LASF1471:
+	.string	"cdefs.h"
+.LASF1485:
+	.string	"io.h"
+.LASF1490:
+	.string	"io_def_generated.h"
+.LASF1472:
+	.string	"long-double.h"
+.LASF1451:
+	.string	"src/main/target/SITL"
+.LASF1453:
+	.string	"src/main"
+.LASF1464:
+	.string	"stdbool.h"
+.LASF1469:
+	.string	"wordsize.h"
+.LASF1449:
+	.string	"src/main/common"
+.LASF1463:
+	.string	"stdc-predef.h"
+.LASF1465:
+	.string	"stdint.h"
+.LASF1459:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\005"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\016"
+	.string	"\017"
+	.text
+	.section	.gnu.lto_.icf.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\245\006"
+	.string	"\362\n*1pM\322\0300j\374bXZ\2311?\030E\350CV\330\332\264\030\372\243F\336\\NL\352\377\377s\365\377\177x\204l\2627\331\233\354\275\267L{\007k\227\036\211\017\n\252\356\322N6\230,D@\013\"hT4t\217(G\007Ie\356u6+.\t\226g\207^\300\246\312\310\235\356 \nAAF\234\317w\271?Q-\241d\030\234]\356\232\345\004d\002\326\t\203\271\274\3260\246\r\312\355Q\301\240\ni"
+	.string	"\007\027#\353v>\212h\004\034\206\303\037\255(\213\r\333\337\356u\273\275?{-\343\300\003\204\307\212\026\243\001\021"
+	.ascii	"`<\244\302\002\343\203\n\007\306CB\374M\b\311\023P\230\033\240"
+	.ascii	"\023XEF\227\f\023\344U\326\236*l2\311+\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\322"
+	.string	"\025\005"
+	.ascii	"\022\007\023\031\260'\303\001\f\303p\366a\030\206\2013\213d\315"
+	.ascii	"\3106\262\t![\312\224\002\022~\200$\313;T,\324\t\224\004\036"
+	.ascii	"\240\t\221jy\317\235\017C3\350\013\325f4\216\362QMk3\214\262"
+	.ascii	"9\034\025\364Z\275\276\020\277j\324\251x\"& \260\"2\233\007("
+	.ascii	"\0249s\2018\032\213X\032\356l\261C\0042\260h\212\207\031\030"
+	.ascii	"\265\374\233p\227\030Cl,\317\020\354\224\354}\037A\202AB\b\003"
+	.ascii	"\243\0241\213\031\025\342I\344\270B\332\002\300\216\356\r`5\227"
+	.ascii	"\213\230\314\231(\027\016\202]T\270!"
+	.text
+	.section	.gnu.lto_.inline.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\311\003u\013"
+	.string	"fP97@\345&\215\001\317\226\314\203\b\017\037b\017D\347ZQ\b&\3018S6_\320\021\025\366\300?X\177c\216\013\206a\030]<\261hM\232\216\221'\333\b!dK)S("
+	.string	")"
+	.string	"'"
+	.ascii	"\2345R\340'g\375A\356\356\376\360<I\231BMxd\317\220'\b\325\352"
+	.ascii	"\223\377'1ql\320\020\325jd\340;?\222i\200\242\274\336awK\377"
+	.ascii	"\306\r\3353\212\364\235\217\240\0171 (\354I\032\261+\241-\350"
+	.ascii	"bt\004\340\214\207LkN\3621\037+\005g\212av\226\347:d\322\177"
+	.ascii	"{\"}\330\262[\342~!\023g\345\373A\211\370\272&\216\322dw7\353"
+	.ascii	"\277\003\013t.2J\\\2649\271\312\356bo\032\320i\272\311K\023\024"
+	.ascii	"\300\311\202e[\323a \016|\324\231T\205F\366#E\201y\221!P\320"
+	.ascii	"\024\221; \300\242\221\271\352\347\fI1\2717\030S\262c\351\001"
+	.ascii	"\272!\214Sf\234\\\340\363,\314\036kt2\245D\272@\2357\225d@\t"
+	.ascii	"e\013a\025\274\256`\036$T\237&\213m\273\025\360:'Q\222\311w\316"
+	.ascii	"\030\035\327\305\022b\b\274,\274.\341\221\301pqc\362<\016p\364"
+	.ascii	"7\204+\321\305\030f\231\300y\005\2309\t`\370:\212%\226k\2755"
+	.ascii	"\335\315xn\013\262\240\177\363\004\353\2309\2148\261\222\r\246"
+	.ascii	"\340n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\r\002%\006"
+	.string	"B\t\033\"\240%I\007\377\377\017VU\325\244\252\252@`\344x\362\361\277e\355\262\315\332\326\254\265\215\220Md\332\001\225\0306\036\300\005\n"
+	.string	"\310q\255$\245\224.\004\341j\013~\370\361\034\\\257DLp\ft\345\334\374\271VY\273\206V\230\3032\317\353i\005\275\202\270q\362\374Z\247\355ZU\332R\333rU\325\230`\215=\344\300o\352P\346$ \220B:\263\003\355\"\200[\356\346\r>\301b{\342\264\270\020-\214\270(\213\320\\`\\\367\337\200\211\200_\032\211\260\265T\024'\344b\245\344\272\3752x\021\324\\\304,lC\370\030\t\344X\221P\304\202p.\366G\273n'\210Y\016\320"
+	.ascii	"M\364\2120\004"
+	.text
+	.section	.gnu.lto_.pureconst.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\271\004\001\271\004\002\205\004\003\231\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\007\231\004\b\232\004\t\231\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\230\004\016\231\004\017\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\005\001e\005"
+	.string	"b\306\025\"\220)\351\377\377\237\303w\275\377\377\377\377\377?\216o\b|\003~,\262\301\036\350\267\326\032idK\231\002\377OF`\003\201$\020\001<\244|\036\016\237s\365\256q0\251q(g,\013\264\242<\321\333\355\353\255\305\311\234\033\312\021\345\217\032\253.\373\211\242\276\013\263\022( "
+	.ascii	"\003\231\231\362\254\204]\305Z\246\030\201a\220\003\005\3706"
+	.ascii	"\360\233\324\3421\n\004s\366p\034\007\326\254\211'a\212\310\n"
+	.ascii	"\tBh\013\320\nT\262A6\334\002\215\330\035,&v=X\r\242\314b\200"
+	.ascii	"\270\036\343j\001\354\335y\265\337\323W\234\342\016\001"
+	.text
+	.section	.gnu.lto_.lto.72a76237123f3bbc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.4.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\256\002\305\025"
+	.string	"vh\215J\260\022R:/\004\216B\3241\2050\377!\feE\017\361l\256\310\372\204\2374\350\017\216\342\001n\370.\366\227\255\263\315T\341_\0168\307Wv?\244\374P\273\243Z&\213N:\277g\244\365\321X\027G\24166\273\211\334)\005w"
+	.string	"u"
+	.string	"v"
+	.string	"&\253b\263\314\241\2020\236\222S\261O\3733~\224\373O\347\002j\025Zz\252\265\\\340\224\361\324\345\013\264N\307\233\264N\235\263\251Nx"
+	.ascii	"\214z\220\210\324Za\233\302\342\314\235\212;s\276X\243\347\333"
+	.ascii	"9\025]\274\037\026$>\236\3502\024B=\370\351\343\333M\261\351"
+	.ascii	"\223\004\217^\021\320\367\301'p1\244\347\003\372t\275\324Z={"
+	.ascii	">\021w\353\266clO\260gU\007\336\243\353\345O_\336\333\232\236"
+	.ascii	"t\372\001^%L|\324\372\223U\244FQ\250\026\007\376\366}\2447\331"
+	.ascii	"\244q\247\341+\235\351\300\tr\te\247\244\356\202\304\210\321"
+	.ascii	"\371%\257\260\340\016\3049y\200\303~\222X\203J*\217\223\021\271"
+	.ascii	"\"\366\371$\334\177:\013\"B\210\035\302S\037\tg\223\247\177\320"
+	.ascii	"$9\214\331\366\nK\356@\034\261\0069\220q$\254\265L9\265\204\373"
+	.ascii	"\362\017~\234\312\212\322\211\225d~_krM\242\340\355\016\355O"
+	.ascii	"\027\306ZyZ\374\033\031j6\255Sr\rX\303m\330\214\265\326\026\337"
+	.ascii	"If\306'\322i\235\216,\311\217\337\233N\001\306\231^\241\250G"
+	.ascii	"]\272_^\373\244\243\350\246\225\307\375\276\007K7\263\f\223\265"
+	.ascii	"J:x\276\265\007\002VRuZ\331\345n\356\220}\027\025C\241W\310\036"
+	.ascii	"\247I\327\364\310\177\377+\030f\323vs[\263\270\310Zbb\r,\250"
+	.ascii	"\f\240\315hd77\232\332\350\231\212\214\254f\243\335`7\033\215"
+	.ascii	"C\315\006\003\243\251\311f`3\333\r\246\202\3005\033h6\330MM\215"
+	.ascii	"\rF\226\272\257\220\351\210(\335\356\350\016)\030\256k-N\272"
+	.ascii	"\273>6Nk\334\013\t\002\341\231C\217{\340\334q'R\017\226\017\325"
+	.ascii	"Av\"?\247u:w\346\3601\341Ba\360]\327\316\253\017/v\301\277\204"
+	.ascii	"WR\0336 `\002\231\2722\017c&(\016\254\036Q\260\005M5\270\215"
+	.ascii	"JW\001PMt\343U=\264\3418c\260\263\230\032\004$\344H\023M\013"
+	.ascii	" \371\300\235\3549\305D#\261\340\204\256Y\352\316@\372P\304\312"
+	.ascii	"\213\365\222\212\2158d\025\332\277\212\177`u(\327\217\253\005"
+	.ascii	"\202\026\263\301B\340\\d\313\342+\344\201\302\027\246\201\331"
+	.ascii	"(\346&\354\3347pi\024\337\030\bq\273\3152H+\212\374\351\235\013"
+	.ascii	"?\001"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.5.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\375\b"
+	.string	"\026\321>8@s\322\001@$d\353Y\200\206\264\237\322\222\370J\206B\276\334\3472Hc\033\322\246\"m\353\261i;T\343\252\242Kqm\237\317]\250\2670Cu\342\240\332\b\331;\245."
+	.string	"."
+	.string	"-"
+	.string	"!(neCef\267N\316\r6\307\256\023l\216I\220\207\217\241\177\224wV2'T\351\021\300aw\035O\250\216[\336v\307\366\203\355\2260\0051\273\034\255\232}\301XHl\223l\315\326X\\\214\366U?!\275\216.\260\233ra\355V\005'd\307\\3\333~\311MH\016\257\032\222c\222\032\266/\276\n\263\335\365\370)\031\030\331\3101\177$\017DT\246\330\262\346\261\221\306\256\245(?\354_+S\266\243\345\353\037\257\200fh\350<\022\334\002\3046\340}@\235\b\004}\231?\333D\367Q\017\234 \365,>\0321A_G1?\024\234\033\202C\025\036\235\242P\210N\255\356-\003\f"
+	.ascii	"c\223\240\314\2000,)\016\343\314`\220\261\3005\361\215E\376\300"
+	.ascii	"\004\001'zT+\035a\222\001"
+	.text
+	.section	.gnu.lto_serialWrite.6.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"-\013"
+	.string	"\266VP>"
+	.string	"S\234\016\263\002\224\016\032"
+	.string	"B;\350\377\033\231\006X\320\234V\200\250R\205\b\003'z\345\002\f\255"
+	.string	"\312\334x\024Q\377\377\367+\201\356&\261\373\354\235\224V-\033\"\316\306\356/eJ\001="
+	.string	";"
+	.string	"?"
+	.string	"%\316\007\354\216f\324\330\375&^\020\017\375]B\035\306\027\240\016\355\331;\016|\002\334"
+	.string	"\301\340\261\273\226\222\270\367\364\374\233\016 $\352<A \354\2563$\nq\353m+\260-\301\276\203\366\277\237z\351\207\232V\230\316H\372\261\"Ih\354\202\b\361\261'h\343\204\355\333o\341\331\225]\221*\2327\231\201\305\373\307\301\272+BG\204xX\225\250<\317\302W\361\025\336\003\037\355\230R\325\t\350\307\205\313\300\304\335\017\027?F\207mC\035\246\032\2605\374\305&\356\356\305w\241\351\242\211C\237C\035^\005\344(y2\304\022\02486{\330_'u\204\375\310\356\256u\024\026\260\264\345\301u\251Pi0\201B \3032\227\246\313h\321\030\005\303\245qYgu\\\266A\343(X\031\355\302X\030\327Y\024\004\3362d\234\245\3316\316\252\276}dud\230\342\344Q\017\256R\025\252S\235 \f"
+	.ascii	"c\223\240L\350\023\007\026\027\0340\024\330\246\322Y\\M\360\313"
+	.ascii	"e\230\030jv\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.7.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\262\001\005\021"
+	.string	"\346awH\340\264&\035\330\013\201\335\223\240\ff.^\202\017\230\032\234\346\2014 \220n\b~yk~\035'\334\306\210\241\350Rm9j\366\\\372\375\2031\372\334?\004j(\326\034\004\203\340\343\251\3245\377Qd#\207\354-wJ\001`"
+	.string	"b"
+	.string	"`"
+	.ascii	"o\341\2578\013\360\265\232\023\330\335\031\"\332\rU\234\322}"
+	.ascii	":\274\211\373\354n\302}\032\264} \330\020 G\007\333\220\335\375"
+	.ascii	"\324\004\b*\370)5\202\376m'\315h6\237]\316e\211\226s\225&:2\214"
+	.ascii	"Hh2\231\300(\305\210\333\036qh\261\030\001\264\354\256\343\214"
+	.ascii	"\026\342\346n\333\305\266\004;>\236\377\271\345\214\2162\372"
+	.ascii	"\002\006\2500\335vA\334\212l\321\264\321\363\240\337\276\227"
+	.ascii	"s:\214\003y\236\210\223}\241 \232\226\230\207\007G=~\354\206"
+	.string	")\237v\351>\357\003\201\266g{\263\223\306\333\374\027\367\001\377c\034\262de%>\020\355\256\212!t\237(\262t;\305x\027!M\021\007\335g)\310\3511$\355\324Q\215\302Am\254\272QB\342\210\217*\217\037\303E}\361\341!\213G\266+\234FL\267+c\361ghh\315p\237QO\354\013\037\232\351v\227\305\217\301zu'>\375\032\356\363j`G\355&\336l\252\241c#\021;\214E\345\261\177@\307\b\020\353\216\375\237\277\364\360'\275\366w\017z2\207\2610\264R\023\005C\301H/`\200b\231pR\360\262R@\225b\241`/\326\252sj\305\002j\345R\275\276\227K\225a\345\202\371X+T\314\227r\275\276\225\023\267dT\256\017\326j\271>/\274\271\356\330\336@H\321\215\306\246\362\370B\217\200\242\026I:\025\3072\226T*\216Mb\025\205\370\2319\2659wt\353\221^,i\031"
+	.string	"c\223`\314\300=w\3508\370\321WFQ4A\274I\257\255\243\"i\353f\260w\245\263(Z\341M\313\031\226\215"
+	.ascii	"\0372\2401(\210\r\022Ac1\024nq-\357\024\262\251\3115.\005\005"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.8.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\215"
+	.string	"}\n"
+	.string	"VTJ? \3458\035\340,\304"
+	.string	"*\0018\022h\221\371\260G\026w\005\222\302\t\002"
+	.string	"\354 \334i\216\340\207GB\277\334\313q\213\031\033\200 0\004V\034\317!\364\004\020\202-\314a\300!\243F\366N)6"
+	.string	"6"
+	.string	"9"
+	.string	"\266}\227\277\240\234\322\252\212\013t`\204\206\300n\375<G\340\276i?\340\276\321\224\247>S\376cg\220\315Z.\325'\247bw=[\256\222\233\336v\203m\013\373\235\3664\367\372k\332\364\244\323\347@\210$\f\330%\231\031\330"
+	.string	"\333M\213\355\333\217A\331\236M"
+	.string	""
+	.string	"4\347c>\3540\250\327\323\013v_\002lv\353\203\035\272o\256]\236\224\243\024&,\252\262\255q\331\250\006d\374\340\276M\272`w|\246\354vY!_\306\344\321\261|\363O\334\267\323\316\nl5g\366Nv\026\260\253jR\024\373\332\322\227\003\226\230"
+	.string	"C\031\240\210\213\217A(\"\201\245\222$v\026}6@\221\f\313\257$C\223Hb|$\021\034}\"\262\374>\n\0369B\362+\215#\371yu\257-}q\324\263\242!\366\246F\003\r"
+	.ascii	"c\223\240L\350\r\003S~\301\201<\3006\225\316Zh\302pM\244J&\002"
+	.ascii	"\034\353QMw\204I\006"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.9.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"\245\n"
+	.string	"\206\224KB0\251(\035\300\3463!\315+\016u\260P\244?\353\352q\250P?GsDo\3243\352\327\264\325\257\216\327\370\3111\332#\005\343\254\320P\bIU\223\255\036\332\303\324\200\032\247\211R\004\261\233\354\275S\n7"
+	.string	"6"
+	.string	"9"
+	.string	"\366\r\374"
+	.string	"\311\245Y\003\250\250+\205\262\240\302n\3354\207\240\307\346\037\3501\t\340\245\307\222\377\326g\201\225\t)\225\351\021\263\261\273\216)\225\312-o\233\3026\207\375L\246\257\377\234\321QF\037CY$d \354\246\274.l\004\354\001\001\333\267\237\200dk6\203\213\023\343[>\353\bH\257\2437\354\256(8\330\255\026\256\310\216\271fvTj\264\240\244\3116\310\033|\030\230|%\364X\224\023\366\310\025\204\331.\252\343\273D$\331\200c\376\210\036\273\214\020\300:\305\2275\227\215\026\354j\212\362\305\376\\\271\262\035\003\306\310\340:\037\234\213\216\215C\347\001q\241\020\344e\366lB8\017\354\302-\004;\221\007zl \217\373l\0360\3346\022\376D:p\013}\037\270iu?W\256\250\324\234\344\211\2658\245\243\f\r"
+	.ascii	"c\223\240L\350\r\003c~\301\201<\3006\225\316\232h\302pM\254P"
+	.ascii	"&\002\0343RM\233\204I\006"
+	.text
+	.section	.gnu.lto_serialRead.10.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"M\n"
+	.string	"\366\024K>0\345(\035"
+	.string	"p\373\245P\220\177\220\023\203\314\353h/L\004\205\376Cc\364\267H\327\330^\377\365\267\321 \006\3435(\267\020\006\006$\310\263=\3040\006\311r\252\"'\355\344oB\366N)7"
+	.string	"7"
+	.string	"9"
+	.string	"\234\313\033\324s\335\013\3529\333~\370\240\234z\031s\325\021\227\007m\300n\351\321\222\247>S\376g\337T@dZ/\325\247fbw=[\257\217\233\3366\203m\n\373\233k\n\263=]/\373\267mz\322\351kj\212"
+	.string	"\004\230]W\255\300\006\340"
+	.string	"\240\330\276\375\022es\354M\3143\347g\376\312YP\227\235>\260\013\213\231\331-\035\334\320=T\"\204EU\266E\247\211\335.\013\344\277ph\230\352\271I\025l\362.\246nwA~Ki\243;9\347\237\352\271\323\003\023\331j\326\314\021\331I\300.U\223\222\330\337v7\376D|\240\013\017DE\207"
+	.string	"\f\215>\0229\n;\207:\030_8\202\244G\216`)\034-\274Q\370\211\274\320Hz\235\004\213\031\340\350\221Dq\3648\345~[\n\253taE;\274\231\033\365\2445\t"
+	.ascii	"c\223\240L\350\r\003\333\374\302\003\333T:k\233\t\203\3412\310"
+	.ascii	"tM2"
+	.text
+	.section	.gnu.lto_serialReadBuf.11.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\300\005\355#"
+	.string	"\332@\024\016F\200\234Nc\233\032\370\326m(\371\264\0210+1\017D\202\315wx\211\333\316\330\320*(\230\002\213\232\376\235\354?\376\212\371bD\364O\035\3274\034a\366\233P\225g\024\305 \f<\204\032\bnB\366\336{K\231R\307"
+	.string	"\305"
+	.string	"\324"
+	.string	"\276\022){w\323\332T\366\316\326\t\177\266~\314H\347\356\005\213;\336{\023\270\202\231_Mb\002L\204\364f\016\314\357\325\376\221#\241zq\352"
+	.ascii	"\356\265\261\344xo1\201\205\322\233.\246'\362\"T6\262,\346 \276"
+	.ascii	"\206\214,\2623\367^_\320w\316\233\345\003\2347-\016\243\311d"
+	.ascii	"2\371\262x\247\225\352\271\024=\315\322V*\277\352\271\022\275"
+	.ascii	"\342\352\361\266.\030e\321\233\033\332\317\262jZ\340\206\327"
+	.ascii	"\213\243?\273Yc\007\0310\257\027?\211.n\362\210Xe\320\275wG\274"
+	.ascii	"\252\245nH\203\f\230\027\214\333\222@V\\\017\036\321\2524p\246"
+	.ascii	"\n\355"
+	.string	"d\257Z\304a\255\250\321\275\3275\005\321\353\326\335\366\020\333\033lSG:^\216\bk\322';\204\"m\267\302\331\305a\265ah\206`c\2666l\233\352^M\365\017Z=`W\355\243\253\356A\253\005\354\252yt\325;\266Z'\347I~\034[}\363\261\237\367\342oc\253S[\215\376x\237\265\332\314U\227\266\332\246\325\025\255~\320y%\213\317\230{\271\222h.\233\211\346\343\307\337\276\377\344\310\340\321|5\363\007\224\264\251\034\277\327\247\005_\234:\273r^b\\:\025?\237\351V\374\354\243\221iUW\252Dl\207\333\275WC\372$h\357\314\234\240Y\204\316D\352F\177\311\202*\344\220\233eQFC\024\022j\310p\273\267(tSw\345g\326\227I\275\030eQH\200\222\306\355flBz\23076\265Z\266\320\177\274\203/\341\331K!`w-\265\037;\203/a\205+O\037{c}\310\312"
+	.string	"\250\365X\237\243k\3410\005\003R\217\0052\360Y.\260)ep\324yS\200\345a\262\244\3546\022\366X\030\031b\3320\236\265\266\246M\314\n\217\265\326\232e\305\275\311O\366\323\300B\262\361T\033\353\035\313c\033|Y\331*\337\314G\277\302\301;\026H\207\331\217\222mw\362\324\013\234\026\033\373&\017\022V8W#\262(\307\233[\031\240\362,\216\265\261\256V\307f\370\302\262U\2561\"\021\233\202C\315\332\303Y\355\007\261/V\365\315v\207S\361\220\336kE\344O9\201D\342\274Ym\317\006>\n\211\364\336K\344\257)%\245<\246\316\233\267\001L\207j\212rJ2\201P@\245\322\013\212\200D ~\n>\f\345,%5\001\241\202ML\251\223\206B"
+	.ascii	"\231\236\226\202\276\340\323R\t\246'%_\023\023P\204/\351)\350"
+	.ascii	"\033\352\331i\304\322\223\017\312\311\351\311\267+\nomx\204\020"
+	.ascii	"1ijO\366\334\027\2208\253cQ\253em$\264\303\234\rs.\006\232c\355"
+	.ascii	"\227S\350\247\325J\355i\037T\261\252oX\300N\373\343\313{\357"
+	.ascii	"Ms\354\217\b~\332\034{\254\031\007\214km=\353{\201\212\300\353"
+	.ascii	"\342\2330KQ&\355?\373[\030\245\374\374\330\036\205s\2610\001"
+	.ascii	"\351\307\002\031\370-\003\220\327\031\201\264]\265\177\313H#"
+	.ascii	"\355A\245\305\261\246=V\220aM\372\264\245}\230o\031\245X\253"
+	.ascii	"d\355\212\210\3320\327\222g\267\002r\250A(\006\235R\210\320\210"
+	.ascii	"\214\204\221\266\220\016p\002\0211B\333\021\220\271TV\223a\377"
+	.ascii	"\fcX\027W:\372<\226%\374)q\002\3231\005.\326\035\360B\034\366"
+	.ascii	"K\231'~\302U2\fM\326\\\247\354+d$<\b,\332t$c\352\003\037\fT\325"
+	.ascii	"5x\243\021\224\016\354n\250\260Bz&\002\353\026\3748\220U\350"
+	.ascii	"m\241\273:$o\001\371\271\316\263a\013\376\241\2056\300\027]P"
+	.ascii	"q\024\023\372\205,Q\343\256G\253_@\022<\0169D\277\272:\215v\030"
+	.ascii	"k\201\266B\016\271\356\316\276\211\264\212\276\257\275\2524\304"
+	.ascii	"-7\260?\032U\271\031\221\bU\b\206\n\364\261\035\274C)\362(\222"
+	.ascii	" [J\210\336\275\271\232\344m\240c \\\0342t\375\025\035\f\353"
+	.ascii	"\257b\327\304\003VQ\331\222\212E\366\212\250\0271I\017\256!\203"
+	.ascii	">\2044x\354\\\357yh\252\006"
+	.text
+	.section	.gnu.lto_serialSetRxFrameCallback.12.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`%\001\325\r"
+	.string	"\246\233bD\020q\224\016\177n\030i\022\236gp\2305P\351\322\254="
+	.string	"\256\335\211\027\2048\353"
+	.string	"\373\030>Z\375\215\200stF\373\216m\252\277\004\200\021e\034\324'+3\221\001\021\267\306\003\225!l\210\304\222M\244L)O"
+	.string	"L"
+	.string	"N"
+	.ascii	"\334\243\303\027\330\036\271\017\330\036m\233\301\310\311\250"
+	.ascii	"\207$X\036\342E%\205l7\364t\304Q\3274Q~\352ZL\301\200\321X\301"
+	.ascii	"\372p\325\020\250\364(\001\200\265\322\022\310R1\177=WX)\231"
+	.ascii	"\031"
+	.string	"\222\335ur`y\270\343mG\260-\301\276**\302\276\266\273km\331Nw\017\377\314]\377\346\264\306tj\351\177<h\221\3418pc\227e\266cc\304\030\023\266O\266\306\356\\p4\314` \300\256`.\020\270\307.\306\311\264\377\362\023\247\273P.`\267\365\242\305n\270\300\n\002\232\314\350\246N\355tB\313\006M\031$6K\020a\007\226z\264\245z`6V\231\303v\311aF\334\356\252\343\3074\224N\266\307T\021\373\302Q\234t|\030h\342v\367.\217>\312\366x%P\303\245\312\231\377\372G\214\207\214M\035v\230\312%\237\317#\022}\037\316#\016\276N\005N\003\317&\004\364!}&&R\210\363g#\372B \310\344\231@\020\206\020H\301#\205\276\221\367\001M\336F\304%\013 \3203)\225@O\023\356\265\325\226\267\031*`X\244\217\332\376z\210v\252\272b[\325$*M\321\002\021"
+	.ascii	"cC\320\304\3209}x\221\331k\251\306@K\017\273\277\214\035`o\245"
+	.ascii	"\246\254%\024w\315\306\231\320AaI\250q\250*\247\350R{"
+	.text
+	.section	.gnu.lto_serialSetBaudRate.13.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\205\013"
+	.string	"V\226QD\020mj:\260d\220^\003\226U\035\315\350o\357_\237&@\261\346z\320`@\232\fr6\276\351\202\353\tk\357\204\226R\032\351\252\303\200\250~\007\226\320\246\373,@_@\301\2119F\340\340\242\336d\357\224\002;"
+	.string	"="
+	.string	">"
+	.string	"\273)\020!vG\020\177\324S\217\337\310N\3535\262S\213\266\211\217\024\366\254\017\013Z(vw\233\023.^\212\376Y\327L'\322\345\244dw-M\247\006\367\274m\017\333"
+	.string	"\354\223\004\273\273\236)\373\253\237^\365c\230\264\234\322\237L\036\214\250\234\330e\360Z\261.*\342\202\355Sl\255\302E\216\327 ~e\300\332n\204\024\231z\332\201i\250\313\245}\f\317 ^5:Ftb\323r\232\202R0I\266;\367\360\325\335\004\030\277\303\201\002\242\354TN\016;\374\006Q\335]\214\337\n\201\252\205S\177\224\235~^\224P\225\344\313\222\203\003\022+U\330#IN\t\366\261\335\207\013\300\001q\232j\221\021\016#\340\022\242\261dt\033\017\367\t=^\365\3062\200\363\300.\334B\260\013y g\363x\\g\333\200\341f\251\370#\320\201\333\347\373\300\2152\356\261\235)g \270J\023\201-d\017"
+	.string	"c\223\240L\350\016\007\006.\024\260w\245\263\032\233\340\3145\240\031\306"
+	.ascii	"\341;5\n\216\361\251\246\301I^\\\223\f"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.14.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"=\n"
+	.string	"\366\223IA \3078\035"
+	.string	"\213"
+	.string	" a\341\006\234\200#\260}yf\f)\340\034/\020O\031@\303\355d\354\033\374#\203\372vF\033c\2101\001"
+	.string	"\006\302b\030\200\257\232\032\004\305D\245\007\030@\t\211\220-S\n5"
+	.string	"5"
+	.string	"7"
+	.string	"\013\3335\356\n\3335\333\246\350\224lz\331\262\272\212\201\022\330\202\335\322\233,7]M\376g\236\271N\016\250X\247\253\006cw\255*\226\311=o;\302v\206}.\263e[\275\375\365g\231Z\247\372\032\215+\201C\201\335U\254\301\"\320\b\300\330.\331\235}\240\342\250\332\217\271L\351/\322\021v[\n\006\354\226\023\226\340\256\271|\333\274@I\315\223\355\216\303@\002FD\221\355\232\316\007\033\344\001Hn7\345\361\001\214B\270\227k>i\273\366\311\340\362Bi\314]\312*\003\273<\351\\\261\237\355\356:\356X|\036\016N\205\306&\001\374\204>\021\031\n9\1776\036_8\202\244G\216\340(\0347\274P\370\201\274\317Hz\233\006\213\037\340\350\211Dq\364\272r\357mB\240&\211;\315\246u\006\013"
+	.ascii	"c\223\240\314\2000,\204\271\031d\007\366\256t\3264\023\006\271"
+	.ascii	"fKw\210h\272\346\023"
+	.text
+	.section	.gnu.lto_serialSetMode.15.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"u\013"
+	.string	"&\326PD \213*\035\300\022\b>\030\305\005"
+	.string	"\373\304\225\345\242\026\005"
+	.string	""
+	.string	"\007,Z\r\001l\321%Y\332\206\007\351\304hd\f\315\202\303\b\304\013\002\310\003$z\34008\207@1c\206v\b\317\326\336\226l\262wJ\001:"
+	.string	"<"
+	.string	">"
+	.string	"\233\252`aw\344\360F=\365\370\n\355\264\036\243\235Z\264=|\\\260ge \320\372\260\273\333Tp\361R\364\317\272\345\204*]VBv\327\362\2042p\317\333\326\260-b\037$\353\231\262\277\372\351U\177\226I\313)\375J\305\245\001#\266[ \026b_\324\325\300\366/v\205i\344x\b\342W)\266\354\"\200q\352iFv\f\007\315\245}\007\177 ^E\372\304\006\226\323\227\003\003f\311\366\347\024\276\272+`\343O"
+	.string	"p2\322N\345\264\260\303G\030\325\335\335\370-\021Jep\352\223\264\323O\211\016*\223\214YJ\270\260a%\b{,\311\231\300~\266\273\001\235\347\373d\366\370\3406$\232\216\221\fE\327\001q\241\020\344Uw2%\234\007v\341\026\202\235\310\003=\033\310\343>[\007\f\267\314\205?\223\016\334B\337\007n\227q\237\355L\231\203\341e\232\001\034!\351\314f\017"
+	.string	"c\223\240L\350\016\007\006.\024\260w\245\263\032\233\340\3145\240\031\306"
+	.ascii	"\341;5\372\251\033K\312\n\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.16.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\245\n"
+	.string	"6\324JA0\3076\035"
+	.string	";/U\365\232\357\373\025\377C}\253+\336\361\004\253\034Pp\276\013\003nAD\304x\333\200l\024Sj\246!\231"
+	.string	"\016\310\360\221\202\2150\244n\f\216,\361\205\242\t\333\250\221\275S\n4"
+	.string	"9"
+	.string	"8"
+	.string	"\216\310~\371|\003\366+\373\006\373\345\322f\360seoRP\202Z\355\256VU^\236\226\376QG0G\242\323\214\305\356\232\232\243\223\273\3366\204m\f\373\t\001\253\272\004\260\330\276\306\316\002l5\346\246\362'\017\260\024v\004\305L\355n\307\027\331/\216\365\215i\243'\310\352\223\375\312Z\266S\373.\177)_\362\202/\354\222`R\273g'\037\003\252\220*b\214Z\265VZ\355\320\007\275i\016I\025\231\002 \200`i\003\373\024\321\232b\337\332\335u%\331?\375\326\317\277\276\364S,S\340\300C\202]\223\007\016\002$\030\n\273\213#9\220\345\211\n\216Bc\223\310\3600x\035\310\221#\370e\356<\033\334'z\2436\212\236\307'\2024\360\3438\264N\0345\217\203\303\016O\324\3100\0245\315\271\267\266\222\034\016"
+	.ascii	"c\223\240Lh\t\032\030\270P\3065\366\301f\347D\214'\316%\301:"
+	.ascii	"\241\252\201+b\250\201\340\316-\332\371\004"
+	.text
+	.section	.gnu.lto_serialBeginWrite.17.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\335\013"
+	.string	"\266\326RA\020Q\234\016\360d\t\025o\306?\001it\251H<\326L\006\204p\031J&\321\3744d\347\324>\342F\301\312\332WD\273\321M#"
+	.string	"\2008Us\314\212\"\006\220\222\362\331:\303>!\332d\313\224\002?"
+	.string	"<"
+	.string	"@"
+	.ascii	"\323\240]\343"
+	.string	"\343\210\375\307j\003\310jw3)\342\340-\251\240\177\217OHb\350\326\207K\253RZ\241\n \206V\002\025\n\304=\256\034\304\221\252\344\301\356ZI\242\207{\336v\004\333\020\354;\b\276\265\273ki\262\237\372\247T\253\252/\221\254b\030h\261\333ad\307\212L\030%l\237bc!0W\373&~\002|\nt\001\273&\026.vG\005F\200}z|\201\353\023{\345z/\244<\331\356\\*5\0374B\315a\273;H\007\333\r3\276\n\r\337\347\372Ti\261/<\305\007\333\335\214\217\302\223\001#\361\351\203\256\317K\0023R\"\035\261\206\330\220\261\252\303\036C*O\016f\320@\313L\300,\320\\\006l\033\216\346\3718\034\346\315\205\202\306y\333\227}\336\206\201\363$d\034N\253\220m\274/\273X\334Y\330\274\314\323u^F\031\3678DDrdMtJ\253\364\201P\206\f \344\206\252P\245\021"
+	.ascii	"c\223\240\314\2000\354\263\260u\033tc\2269\332\300\035:\367\030"
+	.ascii	"\213\301\336\225\316\252f\202\013\227\001\277\325\024q\227\247"
+	.ascii	"jr\212\246\366"
+	.text
+	.section	.gnu.lto_serialEndWrite.18.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\r\f"
+	.string	"\026\227TC\020q\233\016s&\200r\344\374\tH\255S\022BA'\003j\251\350\325j\247L\245\301P+\b\221\351\221\202)\353\260\270\0332\261yUUc\035\2529\314\017\346\034"
+	.string	"U\312\307\326\231\037\237>m\"eJ\001A"
+	.string	"="
+	.string	"C"
+	.string	"\325\243=\333\306\303\022{\225\035\034Vn\354\356\245$\356\235\322\364\374\247\034C\002\216N\225\\)\215\211\013S"
+	.string	"\360\243\022\230PF<\345\331\001\034\311\274<\330]'\t\b\342\216\267\035\3016\004\373\016\002\251'\366\251\335]+\311~\351\217\232\316L\377\342Q\"\303\300i\367\303I\307\266\304\030'l?c[\036:O\373(\236\302{)\344\002vI-^\354\206\n\214\300zt\370\002\325\243uM,!\322\204b\002C\365\304\366G\225\372Q\251\361%\016\333\333W>\254\335\317\343\263\330\320\201T\217\251\033\033\303W\200X\273\353\361U\2104X&\036\375\220\352\361J\200FI$ON\026p\306f\016;\034\005f\320"
+	.string	"\363P\350,\370p\006d\240\020&\352B\232e\020\247\002\246qYwu\\\226A\343&\\!\r\263p\201\270\356\342l\274]\310\270K\264m\334\225\t\367\324*\311\022D\264\210\350\b\205\311\250N\365\201OG\006\020\020"
+	.ascii	"c\223\340L\350\307\213\3415\324\306\354u\264\255;\324\3571v\200"
+	.ascii	"\275+\235U\315\004\027.\003~\253)\342.O\325\344\024M\355\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.22.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`<\005u!"
+	.string	"\266\374\321J\220\330Q:$\242\206\235'L\0324\027\306\352z\247m\231\376\202\217\250\362\345;\344("
+	.string	"3_\276P\002\337\266\375\331\363\215\007\017\013\222\266-\242\201\336;TO\2722lM\205\222E"
+	.string	""
+	.string	"n\206\033\016\031\233%\204l\"w\222\001\267"
+	.string	"\301"
+	.string	"\271"
+	.string	"7J\230>\341\312z-~\223g\375\356\204\273\312\233\033\344\361\242x\357\265\200\336\352\224L|I\\\327c1\361\235\231\200\364\253\243\234\341\215!\254\215\301\325\372!_\311\227\374~ut"
+	.ascii	"\367N=)\336;Lp\313;\350-\017O\300\274E/\300\274e>\022fFb\016"
+	.ascii	"\363\241\217+\344\037s\230\234%\233XS\0233\367\336\333m\367\340"
+	.ascii	"\3463\231L&_\016\317f\377~\232\266\354\212\376\370'\236\366\024"
+	.ascii	"\225\364\263\tX\315\232\025\215\333\033+\031/\313s\tF\020\233"
+	.ascii	"\250\245\322\007y4\276\370\n\025\025\254-\340\025\347\350\371"
+	.ascii	"s\357\345\003k\234igf\035\314\354\201\331:\be\345\263\246\262"
+	.ascii	"im\225\313\264r\327*\327\017\377\0178\2023\367\302H\236\271R"
+	.ascii	"\326(\344[\027\343!\235\340\315S\260J\354x\203\303\035f.\342"
+	.ascii	"\241\013\0078ea=\335n\337\365f>\377\312\261\024\201%0b\346KW"
+	.ascii	"\303\302\241\365_E\277\322\231B\332\r\245\247+E\314\351\275z"
+	.ascii	"\237\302\247\362*\007\222\034\271\367\246H\347\342\351$\335\\"
+	.ascii	"\245/F\272xA\203\336\271x9\017\2708\240\306\362\326\270\271A"
+	.ascii	"(bG \306\336\257\216\332\251\202\320\312q\353O\370E\216\342\253"
+	.ascii	"\351\f\334\267N\344KIi\340\230/%\212\357G\311\211\002\322\313"
+	.ascii	"\361\336\341\316-k8\224^\345\023\221\230S>\361\307\2342\3220"
+	.ascii	"\267\207o\326\"\303Q\333\230y\275C\021\262[\345 \254\312\356"
+	.ascii	"\273\316?@\243\331g\037LS\032>\027\243\r\374*\276\317\2745\273"
+	.ascii	"\f\203\272\321\023\343\013\263\355\304k)\252\344!\263\354\017"
+	.ascii	"\3012\013V\344_<\255\b\330\030\260\2361\201\372\346\356\262\035"
+	.ascii	"H\005;\351\303\265\200(c\021\002\205y\333\215\200E<\313\b\364"
+	.ascii	"\336`\017\177\254E\216_\2453ok\343\374X\002\254I>\226\327\262"
+	.ascii	"l\220\201\375.\230f\224\335\376\327u\200V`/\036%\023Fv\353\031"
+	.ascii	"\367\313{\357\355\246\342\276\217\017\344\261\366\0247j\"\223"
+	.ascii	"B\270\247\230\217\365\333\\\353\257\261\245\327:\327l*\323j\225"
+	.ascii	"\321'\200\252\212\033\021\365t@6g\224+Qr\003\237\\\217\t\034"
+	.ascii	"\003\022<\001\202\200\210rF<\"!\224\201xR\344\204vA\274\033o"
+	.ascii	"\027\264BhW\342F$\224\033\272\001\355x7\036\003\254S\021\264"
+	.ascii	"\273\031\351t\273[\312\314\365=E\274\2042c\300V\342>\233\212"
+	.ascii	"\317/\324\246_\374\215hmm\033\212K\264\246k\2206\355ZC\355\274"
+	.ascii	"\326\021"
+	.string	"\304\202\025i\221\354\270\365\214k\265\236\261\355oA\340\201\314a6\0253\333\372[\nn\333\326\347\026&\"i_\213\347\265N\333D\303\204C\251&\271\267x\221\335\256\353\360\215\0273V\240\236\375fZs*\265\324I\027\376\005\003Q\bZ\343\230y\261\210wA\201\336\033q\250q,\307\224Q\306LI$33M\213\001\200\002!\2629\017\020`\251\250i\016g\263\266\301\302\355\313\220\244\234j\220\027\274\205\322\020Dk8i\347_h\341\241\364\324\r\016@\023\272\237c\210C\251lkY?`[.\\\344s\256\214\330\366\275\027\227\326\361\031\375:\306\265\343\246\220\"\033\\&\341\367\005t\217%\326\377X\334\346N\374\232\313Z\302\027\300s\307+\206\224\224=.\213\004\365Fz\245\300p\016\261\272\004\343\315\227)r\236\366\333\316\340\327{{\311\001\025\024E:\315E\270\242\201\242\372A\262:GF/\365\026"
+	.ascii	"F\202\026\203\236KE\342O\344i^\352\001\335\364\377\237\002\252"
+	.ascii	"\034\202\362\007\377\262\f\272\266\342*\306d|\337\305\266 \272"
+	.ascii	"\354\004\033<\376\370\025\351\254\264`\235\236+\217uL\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`I\001\035\b"
+	.string	"\004\013E\002"
+	.string	""
+	.string	""
+	.string	"\002\026\177&\257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 \004\177'\360\372\2508\272\200\202\005\177(\200\200\200\200\004\006\177)\007\177*\362\375\231\027\b\177+\t\177,\n\177-\013\177.\304\242\203\374"
+	.string	"\f\177/\r\1770\016\1771\017\1772\020\1773\021\1774\022\1775\004"
+	.string	"\265\013\004"
+	.string	"\225\006\004\001\221\205\327\307\003\001\365\006\004\003\265\001\003\004"
+	.string	"\242\006\004\004\303\376\236\020\001\325\001\004\005\225\001\004\006\007\b\324\247\332\303"
+	.string	"\b\225\007\004\b\270\275\224\034\b\265\023\004\t\221\215\300\227\002\n\013\f\003\r\004B\004\016\321\231\263\346\017"
+	.ascii	"$ \260\242\2514\007\225D\275k\3541\207\334\013;(\221\030\216"
+	.ascii	"d\256\373\340\262c\013\013\253\210Z\bp\363Qs\265{(\315C\316\272"
+	.ascii	"0\364\230\277q\2771\371\033~\3437\366\215\021\204\363\r\321o"
+	.ascii	"\370\r\tb\362g%\200N|\276\343d\346\200\216\001"
+	.text
+	.section	.gnu.lto_.refs.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.72a76237123f3bbc,"e",@progbits
+	.string	"(\265/\375`\034\034}w"
+	.ascii	"\372\277$*R0\022JJ\007\253\177?@C\315\316\256\274\030]\356\326"
+	.ascii	">r\323s\ns\325\036\253U\3142\207\305\321\025A\376\375\275\326"
+	.ascii	"k\277\027\346\216\354_\334\351c\023Y\304\300\301\024\365L\243"
+	.ascii	"\252*\206\200\312\216N\235\272kD\340\341}B\327-\253\305l\334"
+	.ascii	"D\312\024(\002\221\002\245\002k\344\274\254W\225\2555mY\f\217"
+	.ascii	"\341'\273q\364\374\003\223\271\035c^\350\275\316\036\237\254"
+	.ascii	"70\247\266$8D\317\262\323z>\321\373\231N\247S>\321;\027\301|"
+	.ascii	"\321\231\353jzz9\177\371\221K\243\345\325\226\273\360Y\016\024"
+	.ascii	" \306\266\314\345@\360\270\311c\332\265]Z"
+	.string	"%\250\261\376\314\266\346\343R\003\246\231\345\274\246\306\327\345\243\030\326\366n\370l'ZWW\326\366E\353\235g4,<M\242\321+W\316X\336\366\273W\204\316W\\\035^[\246\302g\352\327\031\247\24633\225\213\216/G\332Z\261=\314\330\272\264=\214\365\311U\270\314y\205~@\270z\300\265=\t+G\341)=Q=\030\251\264\375y\312\317`\034\306dj\022\212y\313\356u\006\265[\030\250c[v\262\024~\216`\350'\260\340jq\354\206\335\353\374\351\311s\222\367\246\355\211\326\337\320y\354\001\214]\013\356[\317#z<\345\021\275\273y\333\377\035\313C\r,L\333\367\3724'\207\350\255\034@\317'\201\325\200_\3559`\b\n\377\263\374,b\355\276_-\201\351:\277\032\302\377\267\237\021\200s\373\221\301\3775?\033p6>.\370o\3673\001\277\263\340g\005\204\016\004\005\303_\371\231\204\210\2338"
+	.string	"\377\261\274\370\210_\035\372\037\347\347\022y<\277\nA\002U\016\374\314?\027\320\f\374\214$\362\337\313\317\f\374\347Wy~\277Z\342g\030\317\371U\004~\206\341g\235\237\027P\201W\243\003\375\352"
+	.ascii	"?\017\371\231\353\347\255\237\177\374\354\343\347\036?c\375|"
+	.ascii	"\3653\217\237\253~\246\372\231\351g\345\317R??\375\334\364s\016"
+	.ascii	"?\343\360\363\r?\333\360\363\322\3175\374L\303\3177~n\341g\342"
+	.ascii	"\317J?7\360\363\013\377\217\376\273\375,\300\177\350\377\027"
+	.ascii	"?\017\377\273\371y\206\237m\374\234\3643\322\3175\376\223\375"
+	.ascii	"|\364\263\f?\307\360\263\360g\032?\313\370\031\370\363\317\317"
+	.ascii	"&~\216\361\263\013?\237\370\257\342\377\227\377A\323\351t\372"
+	.ascii	"\333\257_\r\376\002\320\0059\367mf\245W&eN\316*\201C\343\241"
+	.ascii	"\253t\216\036\0247\"^|Xo\217\254\267]\253\317\211\230\231iC\373"
+	.ascii	"\371D'\204L\333\333\345z\253\\oq\254W\361\326\253i\326\253e\304"
+	.ascii	":,\247\311\303X\232\350\317/\017\314-\310\227\365*\226\365\252"
+	.ascii	"\224\365\352\327zu\310\372(\207\350y\365\227\222\037%Pa`m\257"
+	.ascii	"\352\360R\222\323fV$\322\303[\211\032\306\210\027\264\031\305"
+	.ascii	"k\331\325\266\2174\022~\232\350\035\336I\232\207\347\030\235"
+	.ascii	"\327\331G\342Ty\266\005\342\020\275V\231\326\263\211\236:\235"
+	.ascii	"\262\211\336\033\257\b\221\2371]N\342\232\310\020\333\246<;k"
+	.ascii	"\353D\256a_\330\272\204ma0\"\216\311k\237]\254\360\232\244h\246"
+	.ascii	"v:\202Y\341\331\211uTc\235ys\241\274\201\303S\035\2672+<;1\206"
+	.ascii	"\302hMnc\264\204\3418\264\246\032\263qt\tt\221O0\315\277\205"
+	.ascii	"t\220\326\241\177tW3;\253{\264Vo\265\217\346\342g\003\351\034"
+	.ascii	"\357\247\206\272\220\363^\344\2757\215\333\230\r\307\361\213"
+	.ascii	"T\216\3518\272t^\252\236\333\025+<;\016\373S4\262\217+\232\224"
+	.ascii	";9\216b\322{\235\247\340\3473@\270\r\343\255hR^\344S\312\004"
+	.ascii	"f\304hY\263\273\327)\364\300\003\017<\340\003\242\244\207%\005"
+	.ascii	"`}\211\202\210\025U_\275\227\"L/\262m[\361\031KE\345\2124\217"
+	.ascii	"\257\270\035]m\273\212*\316\210\020\250\327z~\366\216\246B\343"
+	.ascii	"\224\205\255\247\336TU\310/V\332\266\216VN\361\246\320V\266\224"
+	.ascii	"\232C\254\r\2323\354'%u\204\331\226\271\366.\207\350=\332RN\235"
+	.ascii	"\364q\003\204IW\343x'W3vp\234\332vS\037a\273\362\"\313\331\252"
+	.ascii	"\233C;\256g5\353\337\3076.\343$\t\323\305\267\261\356\307\345"
+	.ascii	"\206d\253-\230i\336\004o\315\2508\347<&\253\3522\326\245\266"
+	.ascii	"\002\341\335\251J\220K&\273\363\235\216t\255JX[\016B\007M\214"
+	.ascii	"\227\271\272\236\030)8x'\330\315\016\322y\241;ot?\312\312\326"
+	.ascii	"\263\017tl\326\273\266\252\2734g6,\355I\2632\202\245-K\233\201"
+	.ascii	"\3405g)\253\371!Yj\35752\227\360a.\221\323\266\203\361\331\263"
+	.ascii	"\347\346z7<\367s\026\257\23294;l\346\320 \235>G\037\315!m\317"
+	.ascii	"U+\21188\036::\350\330\333\031.\247\214\324\026\220\266l\206"
+	.ascii	"\317|H:\264\036e~\340\004vw\271<ad6\346\251\"\2572u\335e\371"
+	.ascii	"\321V=\372\244\334\274y\265U\2159Q\353m\020\353\373\357]\243"
+	.ascii	"\362\336K\225\343\274\312\343\357\234\303=\254r\002\377\355U"
+	.ascii	"\177\002\222\356-bi\322f\365B3\3728\211\373\234\2502\t\325*r"
+	.ascii	"\2405\205\324\272JB\265n\021\231\244\030\244\274Z\305$\364\336"
+	.ascii	"\240\213D\026=`\336\240$\364N]&2S|\235Z\305\213d\336\240\213"
+	.ascii	"\274F\022I\244\326T\022j\234\nJB\265\246.T\353\002]\244Q\351"
+	.ascii	"\204\274\312\240\013\325Zs\241\314)\240$\2249\225\204jaq\222"
+	.ascii	"\344[\336\324\225&[=8H\022yuDe\031\225@\321\244\223y\343\356"
+	.ascii	"\345\262\246\253L\340\336,\2462\316x\305i\307\250\216\343\231"
+	.ascii	"\221\311\004D\035\267\230\027\031M~1\357\375:\322\270Q\025\024"
+	.ascii	"\235\321[\204\243E!Y\027\252\351\336\002\242\356-\362\215\336"
+	.ascii	"{\213\367^\035e\226\363\336\036@\311fT\324\275K\241\250\233U"
+	.ascii	"Tk\272\267\313\344\322\246\222\320-f\n\265)\320\346\305\341,"
+	.ascii	"r\363\306i)WhQ\312\205\272\3672\335\332\234\332\301\266\246*"
+	.ascii	"\311\2408\343\340|\256\240\ba\323V\007\212\325E\004\357\256\207"
+	.ascii	"\334a\007W\377\242\314\2200\321\260\374\204\351\250R\326V\031"
+	.ascii	"}\023\323\326j\235\235\231\266\325q\343\f\222l\353\224\226-\341"
+	.ascii	"Bd\210\223\247m-\211\221\r\263\205\371\321\266&.\214\021\n\226"
+	.ascii	"\224n\215Bf\035\001\202\361|\260\326\340\202P\323X\254\005.\013"
+	.ascii	",\rZ\317\325V\233\253\271\351\264\353\251\321\200\351-9\363\222"
+	.ascii	";\321s\367vlr\346q`U]H\356\317\216\332\233%<\332\266\231~{\303"
+	.ascii	"u\231\333p\0250\35756\334\017\234{\215?\314%\230K\330'[<X\351"
+	.ascii	"\331\333+nNbL\260+2?\374vH\303\204%\304kt\230ME\217sJ\270T\365"
+	.ascii	"\0301'\240\244Eik%\r\307\223i\333\267\017Q\246\322+\315\203\312"
+	.ascii	"m)%\343\344\251\331\004\252\311\204\353|\220@\027\271\025\325"
+	.ascii	"$#\005N\232\221^\"\365\224\202\322bOnI\251\223\353\302\362\244"
+	.ascii	"cM\246\005O\332jM\205\3118\272\324\340\211\235\264\254\315D\034"
+	.ascii	"\223#,\325H\301\364\226\356\322^\372K\2475\226\326\322a\272\255"
+	.ascii	"\2714[\243\365Zg\341g\253q\331Y\254\317\264<\341:U\212r\245\362"
+	.ascii	"\314!m\037Z\255\247p\031\216\226y\220v'=\243\326`-\306\343\346"
+	.ascii	"d\205\327\263K\213\343\204\204\275\025[\003A\242p\b\243\b\351"
+	.ascii	"\003\242\032B"
+	.string	"\032."
+	.string	"p\321#dt\203\250\347E\220R\220h\003\321R\213\020\202\210H\302a\n\237\341#\001\n\342\020h\003\205\321\r\242\020\237!\034\006\221\2020\254\257@E\004*V,\351|\005\013\tXH\320\373\n\026)R\260P\221b\275\212\024\352\020Hc\206\035\376\320\320\033\006\205FB\"R\260HX\303\022c\240\320\243\204\224$$\332H\322\221\261\006o\020\272X\211\353\360W\004\f\212p$\004\276X\"\376\206\304\024\204\2101T\244X\032\372NC\304\223l\004\207C\304\244\244\341\020\317\220\230B\220\006ap\306\b\031f"
+	.string	"e\034\035\001;\b\326"
+	.string	"\016AXjA\f*\001\020<\222\001|\301\002\020\017\fHB\242\020\bc\251\205"
+	.ascii	"\301\340\020"
+	.string	"\204\245\027G@b\322\213\"`\260\205\217\030c\002\n\326 \021\330\242\350\006\220\210\030t\021t\224\224D\024#\307\006\242\215\032\037\f\203FF7\210\210\302\032JH\300\341\013\027JB\003\2101\206I6|\301\242$\023\210A%\035\243\033D5\254HB\030\2022|A\242p\b\243\b)\270\022\225b\020\207I)\374\2101V\020\221\2047tn\301\n\240\n\243\n(\220\201\002\200c\200A\007$V8!\204u\006\212#\240p\030T\032R\032\006i\020\016\213\206\220\204\300\032C3\206JC(\f0\272AT\004\f\016u\212\250Leg<\202h\273\032\207\f\311\203\2322\326\265e]\227\\\\\274f\327\264M\2525E\246\254k\022\035\256\203\272\265^4M)\23174\255\253[:dQq\252\332\252A\236\346\247\205#\210\274\266*\323k]\275\374\370\301pO1\322_\330\323\0249\256u}#'\307l\004"
+	.ascii	"S\372\230Py\202\244\355\216\025\267\3416|'\344\304)ggg\335\250"
+	.ascii	"\332\250\264\335a\202u\254^\256\367\002\247\234]\023\233\246"
+	.ascii	"\344\bW\333\367\240\326\2350WW\214\2057\330\312\222\262\334\315"
+	.ascii	"r\312[}X\fG\265b8\234\327\227yoSg\312\226\324\322H\234\255\266"
+	.ascii	"\276/\265J\345\241V\265\321-G\263w\206K\224+s\253\017\215"
+	.string	"J\335A\325F\276\3128,\236U\260\266\254<A\232I\235j\246N\002\335\343\034\227u\253\352iK[\036)QQ\252\324\316R\203/3\251o\f\016\016\223\252\343\252T\335\316\220\267((\262\225\007L\362I\365i\275\367\252\367\002\001k\326@\366T$\307\325'\037\245\225\323J[\325\211\317~fT\246d\372\314\017\2237OoN\326\337\2532\365\356e'SJy\227\312\023>\271\241\316\353\351\325\242\332\244\026U\246\265xo\321y\245\330,*g\027\202R\250\222\351(G\003\031\"D3#\"I\222\244\003\022\013\020\006Cq\034\347\314\003\022 \004AR2\311\f\321\210(JIRR\312pM\024\342T\352\200e\n\375V\344%\327kp\226\024\214A\302\204\250\021\020\346\"\273f\ta\375\220+RB\177[\251~\335\035>u\264Q\020\025J\263q\347%K\270$\001\f]\205k\224\374\307'{;C\314"
+	.string	"o!d\020\024{_\205\201i\256\370\340\261:\350]\004\267\344\277[\244IT\370l\\\022$J\372y\022\n\324\327\263\205i \332\231\004\b\330\202\017\304\315^G\350\312\270\200\255\357\327=\273\024+\312\221w\222x\242I\343\344g"
+	.string	"C\354\212_r\2113f\225L\341\251.\362'\357\371\215\217\016\223n8\351"
+	.string	"j\307\214o\372\202\007\226ZH\365\301\263\"\224\2066\021\213\3369\250{\217\222\nW\244\277\372^\304\231\261f\t\004j\355D\232\006\300K+\013 \316\276Vo]\316\250\345\253&\246`\356\230*\375&\002F\321\354\302\031\246\001\261'\304q\322Q\206\tP;\271!S9\257\201\324\244\344N\360\237.\347q\350{\255\213S\370+k!\230\325x\023\342\t\n\375:\234\004L\345\027\304\311\\B\3172\234e\367\034\243-y\204_\n\262\001b\305\334\274\363\361\342\300\344!"
+	.string	"\242\177\3405\275\235\227\317\262\tIb\375\034.\342\034'\360C\020\250Iu\3175\202wG\337\001h\366(iy\200\262D\363\2574r\301\226\005\306\222\346$A\240\200r\270\240\337\200\244Ek:%\344\320\362\201\333\256\307\201\326 \353\251X\004\374\313\fn\244\313| \217\377\002N\006\024\340L\210\0038\354\224\257\002Y\017uG\020\347\261\335\3546"
+	.string	"\227X\203\266\215\3440\202\031T\305\243\231W\3040\373Y\f\273\037v\021\210\023\355sq)a?\013\350F\007\020\2349H\215\234\033%\355\362\302\2005=\321A\363d2\342J\n!\034\024\370\300\025\213r\215\351\357\353\300"
+	.string	"\034\203%\352-\207J\200\364^0\347\276"
+	.string	"ya\221Iy\017\b0/\341\230j\302\373<\374\372\336F\224\254\331j\006\032[\356J\300W3\224\372t<\310r\334;\312H^\356\205+1*\332\204\375\335\207D|\252\340\020i\226Tr\007\013\200\336\350\213\357E\001\224V\347L\261\341\005\022`S&"
+	.ascii	"\304k\230%H.\330\006\320\317\034\025\027\227~'U\025\305*\224"
+	.ascii	"_P\314\256\200p\022z\226i\0022\240\352_\032\2055\241\325\215"
+	.ascii	"U \033\352\207\343\253{U\340,\273\313\203\260\246\023\340\225"
+	.ascii	"\260t\001\315\300r\017\"U;\036c\nv\375G\277F\031\b\2331a\033"
+	.ascii	"8\034\265\244d\326;\300U\312\277\203=@\366\216G\353\211j\301"
+	.ascii	"\035Jq\347k\036\304\261\021#\306\337\013\247[\245\357A\236\033"
+	.ascii	"3\036p\217'r\031'\372K\211\314\002\024\342\355>w\3370\016\300"
+	.ascii	"\312\343\037C~4\363n+:9+\240\327\252\261\245\215$\037\217\357"
+	.ascii	"\rp<\3604\240\362\004\0316\277 F\377\303\321\250\365\313?\177"
+	.ascii	"\353H\327z\030\314\266\271\344[\034<\r9\300\201i\006)aq\303Y"
+	.ascii	".\033U\\\017\204D\311\227\216\005\006\333\034\030\373\tj\013"
+	.ascii	"UjZ\027\234kx\332\304\211A\0341{'\317\246\341\224\016*\345P\353"
+	.ascii	"\340\030.h\312\215\002\"L\247\217/\235ab\024s,\247\020\267\231"
+	.ascii	"\370\2265t\343\027\227\301\360\207\243>\226[\335\3420E\177\315"
+	.ascii	"\236\013gY\021c5P\036\326|\037X\374\030\377\032\031\274ks\021"
+	.ascii	"\260\243\360\210\327\370\334\306\365\361\310?x\351\263\304\033"
+	.ascii	"6\307\f.\370\026\343\326\306\033\t\203.\370323^J\017\240r\005"
+	.ascii	"m\315]\344\312\016\332\236\370\311\247\260+d\276\341\350\352"
+	.ascii	"\345Wwd\027\273\316n~h\316\304\372\332r\255\3373\317\254\271"
+	.ascii	"\333\037\f\362m\312@\320q\313\337\034_\323>\212\216\035w+\307"
+	.ascii	"\312\215\327\2154?\263\033\227\231\370H7w\301\356\204n\035\256"
+	.ascii	"\244o3]R\376\224\343\357M\353k{\346\237\240\017@d\354\364\244"
+	.ascii	"\302\b\330\334\346\324}~o\260O\377T\257\353\017\272\277\025"
+	.text
+	.section	.gnu.lto_.symtab.72a76237123f3bbc,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"serialReadBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"serialSetRxFrameCallback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.72a76237123f3bbc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
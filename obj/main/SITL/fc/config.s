@@ -0,0 +1,21949 @@
+	.file	"config.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/build/debug.h"
+	.file 5 "./src/main/common/color.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/flight/pid.h"
+	.file 8 "./src/main/config/feature.h"
+	.file 9 "./src/main/drivers/io_types.h"
+	.file 10 "./src/main/drivers/sensor.h"
+	.file 11 "./src/main/drivers/resource.h"
+	.file 12 "./src/main/drivers/light_led.h"
+	.file 13 "./src/main/drivers/pwm_output.h"
+	.file 14 "./src/main/drivers/serial.h"
+	.file 15 "./src/main/drivers/system.h"
+	.file 16 "./src/main/drivers/vcd.h"
+	.file 17 "./src/main/fc/config.h"
+	.file 18 "./src/main/fc/fc_core.h"
+	.file 19 "./src/main/fc/rc_controls.h"
+	.file 20 "./src/main/flight/mixer.h"
+	.file 21 "./src/main/flight/servos.h"
+	.file 22 "./src/main/io/beeper.h"
+	.file 23 "./src/main/io/ledstrip.h"
+	.file 24 "./src/main/io/osd.h"
+	.file 25 "./src/main/io/serial.h"
+	.file 26 "./src/main/sensors/sensors.h"
+	.file 27 "./src/main/sensors/acceleration.h"
+	.file 28 "./src/main/sensors/gyro.h"
+	.file 29 "./src/main/fc/config.c"
+	.file 30 "./src/main/config/config_eeprom.h"
+	.file 31 "./src/main/rx/rx.h"
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 33 "./src/main/flight/altitudehold.h"
+	.file 34 "./src/main/flight/imu.h"
+	.file 35 "./src/main/flight/failsafe.h"
+	.file 36 "./src/main/fc/rc_adjustments.h"
+	.file 37 "./src/main/fc/fc_rc.h"
+	.file 38 "./src/main/fc/controlrate_profile.h"
+	.file 39 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	config.c.578a7256
+	.weak	config.c.578a7256
+config.c.578a7256:
+	.long	0x174b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x26
+	.long	.LASF3022
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2517
+	.uleb128 0xf
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2518
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2519
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2520
+	.uleb128 0x3
+	.long	.LASF2522
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2521
+	.uleb128 0x3
+	.long	.LASF2523
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2524
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0xf
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2525
+	.uleb128 0x3
+	.long	.LASF2526
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2527
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2528
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2529
+	.uleb128 0x3
+	.long	.LASF2530
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x3
+	.long	.LASF2531
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF2532
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x8
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF2533
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2534
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2535
+	.uleb128 0x8
+	.long	0xe0
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2536
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x18b
+	.uleb128 0x1
+	.long	.LASF2537
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2538
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2539
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2540
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2541
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2543
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2544
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2545
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2546
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2547
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2548
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2549
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2550
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2551
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2552
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2553
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2554
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2555
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2556
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2557
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2558
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2559
+	.byte	0x16
+	.byte	0
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2560
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x15
+	.byte	0xe
+	.long	0x1b2
+	.uleb128 0x1
+	.long	.LASF2561
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2562
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2563
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2572
+	.byte	0x4
+	.byte	0x5
+	.byte	0x34
+	.long	0x1e0
+	.uleb128 0x11
+	.string	"h"
+	.byte	0x5
+	.byte	0x35
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x11
+	.string	"s"
+	.byte	0x5
+	.byte	0x36
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x11
+	.string	"v"
+	.byte	0x5
+	.byte	0x37
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2564
+	.byte	0x5
+	.byte	0x38
+	.byte	0x3
+	.long	0x1b2
+	.uleb128 0x3
+	.long	.LASF2565
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0xc8
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.byte	0xe
+	.long	0x228
+	.uleb128 0x10
+	.long	.LASF2566
+	.value	0xfff
+	.uleb128 0x10
+	.long	.LASF2567
+	.value	0xf000
+	.uleb128 0x10
+	.long	.LASF2568
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2569
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2570
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2571
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xf
+	.long	0x234
+	.uleb128 0x29
+	.long	0x244
+	.uleb128 0x7
+	.long	0x96
+	.uleb128 0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x6
+	.byte	0x35
+	.byte	0x5
+	.long	0x265
+	.uleb128 0x1a
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x36
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x1a
+	.string	"fn"
+	.byte	0x6
+	.byte	0x37
+	.byte	0x16
+	.long	0x265
+	.byte	0
+	.uleb128 0x4
+	.long	0x228
+	.uleb128 0x5
+	.long	.LASF2573
+	.byte	0x20
+	.byte	0x6
+	.byte	0x30
+	.long	0x2b8
+	.uleb128 0x11
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x31
+	.byte	0xb
+	.long	0x1ec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2574
+	.byte	0x6
+	.byte	0x32
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2575
+	.byte	0x6
+	.byte	0x33
+	.byte	0xe
+	.long	0x2b8
+	.byte	0x8
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x34
+	.byte	0xf
+	.long	0x2bd
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2576
+	.byte	0x6
+	.byte	0x38
+	.byte	0x7
+	.long	0x244
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0x2b8
+	.uleb128 0x3
+	.long	.LASF2577
+	.byte	0x6
+	.byte	0x39
+	.byte	0x3
+	.long	0x26a
+	.uleb128 0x8
+	.long	0x2c2
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x23
+	.byte	0xe
+	.long	0x323
+	.uleb128 0x1
+	.long	.LASF2578
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2579
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2580
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2581
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2582
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2584
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2585
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2586
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2587
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2588
+	.byte	0xa
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2589
+	.byte	0x4c
+	.byte	0x7
+	.byte	0x3c
+	.long	0x44b
+	.uleb128 0x11
+	.string	"P8"
+	.byte	0x7
+	.byte	0x3d
+	.byte	0xd
+	.long	0x44b
+	.byte	0
+	.uleb128 0x11
+	.string	"I8"
+	.byte	0x7
+	.byte	0x3e
+	.byte	0xd
+	.long	0x44b
+	.byte	0xa
+	.uleb128 0x11
+	.string	"D8"
+	.byte	0x7
+	.byte	0x3f
+	.byte	0xd
+	.long	0x44b
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2590
+	.byte	0x7
+	.byte	0x41
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2591
+	.byte	0x7
+	.byte	0x42
+	.byte	0xe
+	.long	0xc8
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2592
+	.byte	0x7
+	.byte	0x43
+	.byte	0xe
+	.long	0xc8
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2593
+	.byte	0x7
+	.byte	0x44
+	.byte	0xe
+	.long	0xc8
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2594
+	.byte	0x7
+	.byte	0x45
+	.byte	0xe
+	.long	0xc8
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2595
+	.byte	0x7
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2596
+	.byte	0x7
+	.byte	0x47
+	.byte	0xb
+	.long	0xe0
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2597
+	.byte	0x7
+	.byte	0x48
+	.byte	0xb
+	.long	0xe0
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2598
+	.byte	0x7
+	.byte	0x49
+	.byte	0xd
+	.long	0xb7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2599
+	.byte	0x7
+	.byte	0x4a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF2600
+	.byte	0x7
+	.byte	0x4b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2601
+	.byte	0x7
+	.byte	0x4c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF2602
+	.byte	0x7
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2603
+	.byte	0x7
+	.byte	0x50
+	.byte	0xe
+	.long	0xc8
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2604
+	.byte	0x7
+	.byte	0x51
+	.byte	0xb
+	.long	0xe0
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2605
+	.byte	0x7
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2606
+	.byte	0x7
+	.byte	0x53
+	.byte	0xd
+	.long	0xb7
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF2607
+	.byte	0x7
+	.byte	0x54
+	.byte	0xb
+	.long	0xe0
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2608
+	.byte	0x7
+	.byte	0x55
+	.byte	0xb
+	.long	0xe0
+	.byte	0x48
+	.byte	0
+	.uleb128 0xc
+	.long	0xb7
+	.long	0x45b
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2609
+	.byte	0x7
+	.byte	0x56
+	.byte	0x3
+	.long	0x323
+	.uleb128 0x8
+	.long	0x45b
+	.uleb128 0xc
+	.long	0x45b
+	.long	0x47c
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2614
+	.byte	0x7
+	.byte	0x5d
+	.byte	0x15
+	.long	0x46c
+	.uleb128 0x5
+	.long	.LASF2610
+	.byte	0x2
+	.byte	0x7
+	.byte	0x5f
+	.long	0x4af
+	.uleb128 0x2
+	.long	.LASF2611
+	.byte	0x7
+	.byte	0x60
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2612
+	.byte	0x7
+	.byte	0x61
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2613
+	.byte	0x7
+	.byte	0x62
+	.byte	0x3
+	.long	0x488
+	.uleb128 0x8
+	.long	0x4af
+	.uleb128 0x6
+	.long	.LASF2615
+	.byte	0x7
+	.byte	0x64
+	.byte	0x14
+	.long	0x4af
+	.uleb128 0x5
+	.long	.LASF2616
+	.byte	0x4
+	.byte	0x8
+	.byte	0x16
+	.long	0x4e6
+	.uleb128 0x2
+	.long	.LASF2617
+	.byte	0x8
+	.byte	0x17
+	.byte	0xe
+	.long	0xd4
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2618
+	.byte	0x8
+	.byte	0x18
+	.byte	0x3
+	.long	0x4cc
+	.uleb128 0x8
+	.long	0x4e6
+	.uleb128 0x6
+	.long	.LASF2619
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x18
+	.long	0x4e6
+	.uleb128 0x3
+	.long	.LASF2620
+	.byte	0x9
+	.byte	0x18
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x19
+	.byte	0xe
+	.long	0x553
+	.uleb128 0x1
+	.long	.LASF2621
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2622
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2623
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2624
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2625
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2626
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2627
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2628
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2629
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2630
+	.byte	0xa
+	.byte	0x23
+	.byte	0x3
+	.long	0x50f
+	.uleb128 0xc
+	.long	0xab
+	.long	0x56f
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x14
+	.byte	0xe
+	.long	0x697
+	.uleb128 0x1
+	.long	.LASF2631
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2632
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2633
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2634
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2635
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2636
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2637
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2638
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2639
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2640
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2641
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2642
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2643
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2644
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2645
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2646
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2647
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2648
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2649
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2650
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2651
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2652
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2653
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2654
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2655
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2656
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2657
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2658
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2659
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2660
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2661
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2662
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2663
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2664
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2665
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2666
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2667
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2668
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2669
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2670
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2671
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2672
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2673
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2674
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2675
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2676
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2677
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2678
+	.byte	0x4
+	.byte	0xc
+	.byte	0x19
+	.long	0x6be
+	.uleb128 0x2
+	.long	.LASF2679
+	.byte	0xc
+	.byte	0x1a
+	.byte	0xd
+	.long	0x6be
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2680
+	.byte	0xc
+	.byte	0x1b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	0x503
+	.long	0x6ce
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2681
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x3
+	.long	0x697
+	.uleb128 0x6
+	.long	.LASF2682
+	.byte	0xc
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x6ce
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x22
+	.byte	0xe
+	.long	0x718
+	.uleb128 0x1
+	.long	.LASF2683
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2684
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2685
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2686
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2687
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2688
+	.byte	0x5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2689
+	.byte	0x12
+	.byte	0xd
+	.byte	0x8d
+	.long	0x773
+	.uleb128 0x2
+	.long	.LASF2690
+	.byte	0xd
+	.byte	0x8e
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2691
+	.byte	0xd
+	.byte	0x8f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2692
+	.byte	0xd
+	.byte	0x90
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2693
+	.byte	0xd
+	.byte	0x91
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2694
+	.byte	0xd
+	.byte	0x92
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2695
+	.byte	0xd
+	.byte	0x93
+	.byte	0xd
+	.long	0x773
+	.byte	0x6
+	.byte	0
+	.uleb128 0xc
+	.long	0x503
+	.long	0x783
+	.uleb128 0xd
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2696
+	.byte	0xd
+	.byte	0x94
+	.byte	0x3
+	.long	0x718
+	.uleb128 0x5
+	.long	.LASF2697
+	.byte	0x14
+	.byte	0xe
+	.byte	0x55
+	.long	0x7b6
+	.uleb128 0x2
+	.long	.LASF2698
+	.byte	0xe
+	.byte	0x56
+	.byte	0xd
+	.long	0x7b6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2699
+	.byte	0xe
+	.byte	0x57
+	.byte	0xd
+	.long	0x7b6
+	.byte	0xa
+	.byte	0
+	.uleb128 0xc
+	.long	0x503
+	.long	0x7c6
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2700
+	.byte	0xe
+	.byte	0x58
+	.byte	0x3
+	.long	0x78f
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x1f
+	.byte	0xe
+	.long	0x80a
+	.uleb128 0x1
+	.long	.LASF2701
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2702
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2703
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2704
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2705
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2706
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2707
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2708
+	.byte	0xf
+	.byte	0x27
+	.byte	0x3
+	.long	0x7d2
+	.uleb128 0x5
+	.long	.LASF2709
+	.byte	0x3
+	.byte	0x10
+	.byte	0x16
+	.long	0x84a
+	.uleb128 0x2
+	.long	.LASF2710
+	.byte	0x10
+	.byte	0x17
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2711
+	.byte	0x10
+	.byte	0x18
+	.byte	0xc
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2712
+	.byte	0x10
+	.byte	0x19
+	.byte	0xc
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2713
+	.byte	0x10
+	.byte	0x1a
+	.byte	0x3
+	.long	0x816
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x23
+	.byte	0xe
+	.long	0x934
+	.uleb128 0x1
+	.long	.LASF2714
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2715
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2716
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2717
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2718
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2719
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2720
+	.byte	0x80
+	.uleb128 0x10
+	.long	.LASF2721
+	.value	0x100
+	.uleb128 0x10
+	.long	.LASF2722
+	.value	0x200
+	.uleb128 0x10
+	.long	.LASF2723
+	.value	0x400
+	.uleb128 0x10
+	.long	.LASF2724
+	.value	0x1000
+	.uleb128 0x10
+	.long	.LASF2725
+	.value	0x2000
+	.uleb128 0x10
+	.long	.LASF2726
+	.value	0x4000
+	.uleb128 0x10
+	.long	.LASF2727
+	.value	0x8000
+	.uleb128 0xe
+	.long	.LASF2728
+	.long	0x10000
+	.uleb128 0xe
+	.long	.LASF2729
+	.long	0x20000
+	.uleb128 0xe
+	.long	.LASF2730
+	.long	0x40000
+	.uleb128 0xe
+	.long	.LASF2731
+	.long	0x80000
+	.uleb128 0xe
+	.long	.LASF2732
+	.long	0x100000
+	.uleb128 0xe
+	.long	.LASF2733
+	.long	0x200000
+	.uleb128 0xe
+	.long	.LASF2734
+	.long	0x400000
+	.uleb128 0xe
+	.long	.LASF2735
+	.long	0x800000
+	.uleb128 0xe
+	.long	.LASF2736
+	.long	0x1000000
+	.uleb128 0xe
+	.long	.LASF2737
+	.long	0x2000000
+	.uleb128 0xe
+	.long	.LASF2738
+	.long	0x4000000
+	.uleb128 0xe
+	.long	.LASF2739
+	.long	0x8000000
+	.uleb128 0xe
+	.long	.LASF2740
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2741
+	.byte	0x15
+	.byte	0x11
+	.byte	0x43
+	.long	0x982
+	.uleb128 0x2
+	.long	.LASF2742
+	.byte	0x11
+	.byte	0x44
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2743
+	.byte	0x11
+	.byte	0x45
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2744
+	.byte	0x11
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2745
+	.byte	0x11
+	.byte	0x47
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2746
+	.byte	0x11
+	.byte	0x48
+	.byte	0xa
+	.long	0x982
+	.byte	0x4
+	.byte	0
+	.uleb128 0xc
+	.long	0x98
+	.long	0x992
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2747
+	.byte	0x11
+	.byte	0x49
+	.byte	0x3
+	.long	0x934
+	.uleb128 0x8
+	.long	0x992
+	.uleb128 0x6
+	.long	.LASF2748
+	.byte	0x11
+	.byte	0x4b
+	.byte	0x17
+	.long	0x992
+	.uleb128 0x6
+	.long	.LASF2749
+	.byte	0x11
+	.byte	0x51
+	.byte	0x15
+	.long	0x84a
+	.uleb128 0x6
+	.long	.LASF2750
+	.byte	0x11
+	.byte	0x53
+	.byte	0x1a
+	.long	0x7c6
+	.uleb128 0x6
+	.long	.LASF2751
+	.byte	0x11
+	.byte	0x56
+	.byte	0x1d
+	.long	0x9d3
+	.uleb128 0x4
+	.long	0x323
+	.uleb128 0x5
+	.long	.LASF2752
+	.byte	0x4
+	.byte	0x12
+	.byte	0x20
+	.long	0x9ff
+	.uleb128 0x2
+	.long	.LASF2753
+	.byte	0x12
+	.byte	0x21
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2754
+	.byte	0x12
+	.byte	0x22
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2755
+	.byte	0x12
+	.byte	0x23
+	.byte	0x3
+	.long	0x9d8
+	.uleb128 0x8
+	.long	0x9ff
+	.uleb128 0x6
+	.long	.LASF2756
+	.byte	0x12
+	.byte	0x25
+	.byte	0x23
+	.long	0x9ff
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x13
+	.byte	0x18
+	.byte	0xe
+	.long	0xaea
+	.uleb128 0x1
+	.long	.LASF2757
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2758
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2759
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2760
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2761
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2762
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2763
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2764
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2765
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2766
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2767
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2768
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2769
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2770
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2771
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2772
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2773
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2774
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2775
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2776
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2777
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2778
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2779
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2780
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2781
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2782
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2783
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2784
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2785
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2786
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2787
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2788
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2789
+	.byte	0x13
+	.byte	0x3a
+	.byte	0x3
+	.long	0xa1c
+	.uleb128 0x5
+	.long	.LASF2790
+	.byte	0x2
+	.byte	0x13
+	.byte	0x88
+	.long	0xb1d
+	.uleb128 0x2
+	.long	.LASF2791
+	.byte	0x13
+	.byte	0x89
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2792
+	.byte	0x13
+	.byte	0x8a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2793
+	.byte	0x13
+	.byte	0x8b
+	.byte	0x3
+	.long	0xaf6
+	.uleb128 0x5
+	.long	.LASF2794
+	.byte	0x8
+	.byte	0x13
+	.byte	0x8d
+	.long	0xb5d
+	.uleb128 0x2
+	.long	.LASF2795
+	.byte	0x13
+	.byte	0x8e
+	.byte	0xd
+	.long	0xaea
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2796
+	.byte	0x13
+	.byte	0x8f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2797
+	.byte	0x13
+	.byte	0x90
+	.byte	0x14
+	.long	0xb1d
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2798
+	.byte	0x13
+	.byte	0x91
+	.byte	0x3
+	.long	0xb29
+	.uleb128 0x8
+	.long	0xb5d
+	.uleb128 0xc
+	.long	0xb5d
+	.long	0xb7e
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2799
+	.byte	0x13
+	.byte	0x93
+	.byte	0x22
+	.long	0xb6e
+	.uleb128 0x5
+	.long	.LASF2800
+	.byte	0x20
+	.byte	0x14
+	.byte	0x6c
+	.long	0xbe5
+	.uleb128 0x11
+	.string	"dev"
+	.byte	0x14
+	.byte	0x6d
+	.byte	0x16
+	.long	0x783
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2801
+	.byte	0x14
+	.byte	0x6e
+	.byte	0xb
+	.long	0xe0
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2802
+	.byte	0x14
+	.byte	0x6f
+	.byte	0xe
+	.long	0xc8
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2803
+	.byte	0x14
+	.byte	0x70
+	.byte	0xe
+	.long	0xc8
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2804
+	.byte	0x14
+	.byte	0x71
+	.byte	0xe
+	.long	0xc8
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2805
+	.byte	0x14
+	.byte	0x72
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2806
+	.byte	0x14
+	.byte	0x73
+	.byte	0x3
+	.long	0xb8a
+	.uleb128 0x8
+	.long	0xbe5
+	.uleb128 0x6
+	.long	.LASF2807
+	.byte	0x14
+	.byte	0x75
+	.byte	0x16
+	.long	0xbe5
+	.uleb128 0xc
+	.long	0xab
+	.long	0xc12
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x15
+	.byte	0x19
+	.byte	0x6
+	.long	0xc7a
+	.uleb128 0x1
+	.long	.LASF2808
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2809
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2810
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2811
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2812
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2813
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2814
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2815
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2816
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2817
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2818
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2819
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2820
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2821
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2822
+	.byte	0xe
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2833
+	.byte	0x15
+	.byte	0x29
+	.byte	0x3
+	.long	0xc12
+	.uleb128 0x5
+	.long	.LASF2823
+	.byte	0x8
+	.byte	0x16
+	.byte	0x33
+	.long	0xcad
+	.uleb128 0x2
+	.long	.LASF2824
+	.byte	0x16
+	.byte	0x34
+	.byte	0xe
+	.long	0xd4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2825
+	.byte	0x16
+	.byte	0x35
+	.byte	0xe
+	.long	0xd4
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2826
+	.byte	0x16
+	.byte	0x36
+	.byte	0x3
+	.long	0xc86
+	.uleb128 0x8
+	.long	0xcad
+	.uleb128 0x6
+	.long	.LASF2827
+	.byte	0x16
+	.byte	0x38
+	.byte	0x17
+	.long	0xcad
+	.uleb128 0x5
+	.long	.LASF2828
+	.byte	0x6
+	.byte	0x17
+	.byte	0x7c
+	.long	0xce4
+	.uleb128 0x2
+	.long	.LASF2829
+	.byte	0x17
+	.byte	0x7d
+	.byte	0xd
+	.long	0xce4
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0xb7
+	.long	0xcf4
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2830
+	.byte	0x17
+	.byte	0x7e
+	.byte	0x3
+	.long	0xcca
+	.uleb128 0x8
+	.long	0xcf4
+	.uleb128 0x5
+	.long	.LASF2831
+	.byte	0xb
+	.byte	0x17
+	.byte	0x80
+	.long	0xd1f
+	.uleb128 0x2
+	.long	.LASF2829
+	.byte	0x17
+	.byte	0x81
+	.byte	0xd
+	.long	0xd1f
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0xb7
+	.long	0xd2f
+	.uleb128 0xd
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2832
+	.byte	0x17
+	.byte	0x82
+	.byte	0x3
+	.long	0xd05
+	.uleb128 0x1b
+	.long	.LASF2834
+	.byte	0x17
+	.byte	0x99
+	.byte	0xd
+	.long	0xd47
+	.uleb128 0x4
+	.long	0x1e0
+	.uleb128 0x1b
+	.long	.LASF2835
+	.byte	0x17
+	.byte	0x9a
+	.byte	0x1b
+	.long	0xd58
+	.uleb128 0x4
+	.long	0xd00
+	.uleb128 0x1b
+	.long	.LASF2836
+	.byte	0x17
+	.byte	0x9b
+	.byte	0x17
+	.long	0xd2f
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x18
+	.byte	0x1c
+	.byte	0xe
+	.long	0xe13
+	.uleb128 0x1
+	.long	.LASF2837
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2838
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2839
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2840
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2841
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2842
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2843
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2844
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2845
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2846
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2847
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2848
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2849
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2850
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2851
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2852
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2853
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2854
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2855
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2856
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2857
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2858
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2859
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2860
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2861
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2862
+	.byte	0x19
+	.byte	0
+	.uleb128 0xb
+	.byte	0x5
+	.long	0x7c
+	.byte	0x19
+	.byte	0x47
+	.byte	0xe
+	.long	0xe69
+	.uleb128 0x2b
+	.long	.LASF2863
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2864
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2865
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2866
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2867
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2868
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2869
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2870
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2871
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2872
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2873
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2874
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2875
+	.byte	0x19
+	.byte	0x54
+	.byte	0x3
+	.long	0xe13
+	.uleb128 0x8
+	.long	0xe69
+	.uleb128 0xc
+	.long	0xe75
+	.long	0xe8a
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	0xe7a
+	.uleb128 0x6
+	.long	.LASF2876
+	.byte	0x19
+	.byte	0x56
+	.byte	0x25
+	.long	0xe8a
+	.uleb128 0x5
+	.long	.LASF2877
+	.byte	0xc
+	.byte	0x19
+	.byte	0x69
+	.long	0xef6
+	.uleb128 0x2
+	.long	.LASF2878
+	.byte	0x19
+	.byte	0x6a
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2879
+	.byte	0x19
+	.byte	0x6b
+	.byte	0x1c
+	.long	0xe69
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2880
+	.byte	0x19
+	.byte	0x6c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2881
+	.byte	0x19
+	.byte	0x6d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2882
+	.byte	0x19
+	.byte	0x6e
+	.byte	0xd
+	.long	0xb7
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2883
+	.byte	0x19
+	.byte	0x6f
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2884
+	.byte	0x19
+	.byte	0x70
+	.byte	0x3
+	.long	0xe9b
+	.uleb128 0x5
+	.long	.LASF2885
+	.byte	0x64
+	.byte	0x19
+	.byte	0x72
+	.long	0xf36
+	.uleb128 0x2
+	.long	.LASF2886
+	.byte	0x19
+	.byte	0x73
+	.byte	0x18
+	.long	0xf36
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2887
+	.byte	0x19
+	.byte	0x74
+	.byte	0xe
+	.long	0xc8
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2888
+	.byte	0x19
+	.byte	0x75
+	.byte	0xd
+	.long	0xb7
+	.byte	0x62
+	.byte	0
+	.uleb128 0xc
+	.long	0xef6
+	.long	0xf46
+	.uleb128 0xd
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2889
+	.byte	0x19
+	.byte	0x76
+	.byte	0x3
+	.long	0xf02
+	.uleb128 0x8
+	.long	0xf46
+	.uleb128 0x6
+	.long	.LASF2890
+	.byte	0x19
+	.byte	0x78
+	.byte	0x17
+	.long	0xf46
+	.uleb128 0xb
+	.byte	0x7
+	.long	0x30
+	.byte	0x1a
+	.byte	0x14
+	.byte	0xe
+	.long	0xf8f
+	.uleb128 0x1
+	.long	.LASF2891
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2892
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2893
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2894
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2895
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2896
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x1e
+	.long	0xfc3
+	.uleb128 0x2
+	.long	.LASF2897
+	.byte	0x1a
+	.byte	0x1f
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2898
+	.byte	0x1a
+	.byte	0x20
+	.byte	0xd
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x11
+	.string	"yaw"
+	.byte	0x1a
+	.byte	0x21
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2899
+	.byte	0x1a
+	.byte	0x22
+	.byte	0x3
+	.long	0xf8f
+	.uleb128 0x1e
+	.long	.LASF2904
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x24
+	.long	0xff4
+	.uleb128 0x1a
+	.string	"raw"
+	.byte	0x1a
+	.byte	0x25
+	.byte	0xd
+	.long	0x55f
+	.uleb128 0x1f
+	.long	.LASF2900
+	.byte	0x1a
+	.byte	0x26
+	.byte	0x1f
+	.long	0xfc3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2901
+	.byte	0x1a
+	.byte	0x27
+	.byte	0x3
+	.long	0xfcf
+	.uleb128 0x5
+	.long	.LASF2902
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x35
+	.long	0x1027
+	.uleb128 0x2
+	.long	.LASF2897
+	.byte	0x1b
+	.byte	0x36
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2898
+	.byte	0x1b
+	.byte	0x37
+	.byte	0xd
+	.long	0xab
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2903
+	.byte	0x1b
+	.byte	0x38
+	.byte	0x3
+	.long	0x1000
+	.uleb128 0x1e
+	.long	.LASF2905
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x3a
+	.long	0x1058
+	.uleb128 0x1a
+	.string	"raw"
+	.byte	0x1b
+	.byte	0x3b
+	.byte	0xd
+	.long	0xc02
+	.uleb128 0x1f
+	.long	.LASF2900
+	.byte	0x1b
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x1027
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2906
+	.byte	0x1b
+	.byte	0x3d
+	.byte	0x3
+	.long	0x1033
+	.uleb128 0x5
+	.long	.LASF2907
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x40
+	.long	0x10b2
+	.uleb128 0x2
+	.long	.LASF2908
+	.byte	0x1b
+	.byte	0x41
+	.byte	0xe
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2909
+	.byte	0x1b
+	.byte	0x42
+	.byte	0x14
+	.long	0x553
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2910
+	.byte	0x1b
+	.byte	0x43
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2911
+	.byte	0x1b
+	.byte	0x44
+	.byte	0x1b
+	.long	0xff4
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2912
+	.byte	0x1b
+	.byte	0x45
+	.byte	0x19
+	.long	0x1058
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2913
+	.byte	0x1b
+	.byte	0x46
+	.byte	0x3
+	.long	0x1064
+	.uleb128 0x8
+	.long	0x10b2
+	.uleb128 0x6
+	.long	.LASF2914
+	.byte	0x1b
+	.byte	0x48
+	.byte	0x1e
+	.long	0x10b2
+	.uleb128 0x5
+	.long	.LASF2915
+	.byte	0x1c
+	.byte	0x1c
+	.byte	0x33
+	.long	0x11ac
+	.uleb128 0x2
+	.long	.LASF2916
+	.byte	0x1c
+	.byte	0x34
+	.byte	0x14
+	.long	0x553
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2917
+	.byte	0x1c
+	.byte	0x35
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2918
+	.byte	0x1c
+	.byte	0x36
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2919
+	.byte	0x1c
+	.byte	0x37
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2920
+	.byte	0x1c
+	.byte	0x38
+	.byte	0xd
+	.long	0xb7
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2921
+	.byte	0x1c
+	.byte	0x39
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2922
+	.byte	0x1c
+	.byte	0x3a
+	.byte	0xd
+	.long	0x18b
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2923
+	.byte	0x1c
+	.byte	0x3b
+	.byte	0xd
+	.long	0x18b
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2924
+	.byte	0x1c
+	.byte	0x3c
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2925
+	.byte	0x1c
+	.byte	0x3d
+	.byte	0xe
+	.long	0xc8
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2926
+	.byte	0x1c
+	.byte	0x3e
+	.byte	0xe
+	.long	0xc8
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2927
+	.byte	0x1c
+	.byte	0x3f
+	.byte	0xe
+	.long	0xc8
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2928
+	.byte	0x1c
+	.byte	0x40
+	.byte	0xe
+	.long	0xc8
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2929
+	.byte	0x1c
+	.byte	0x41
+	.byte	0xd
+	.long	0x18b
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2930
+	.byte	0x1c
+	.byte	0x42
+	.byte	0xe
+	.long	0xc8
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2931
+	.byte	0x1c
+	.byte	0x43
+	.byte	0xe
+	.long	0xc8
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2932
+	.byte	0x1c
+	.byte	0x44
+	.byte	0x3
+	.long	0x10cf
+	.uleb128 0x8
+	.long	0x11ac
+	.uleb128 0x6
+	.long	.LASF2933
+	.byte	0x1c
+	.byte	0x46
+	.byte	0x15
+	.long	0x11ac
+	.uleb128 0x16
+	.long	0x9c7
+	.byte	0x65
+	.byte	0xf
+	.uleb128 0x6
+	.long	.LASF2934
+	.byte	0x1d
+	.byte	0x71
+	.byte	0x1e
+	.long	0x4f2
+	.uleb128 0x16
+	.long	0x4f7
+	.byte	0x71
+	.byte	0x4d
+	.uleb128 0x6
+	.long	.LASF2935
+	.byte	0x1d
+	.byte	0x71
+	.byte	0x7d
+	.long	0x2ce
+	.uleb128 0x18
+	.long	0x11e3
+	.byte	0xa8
+	.uleb128 0x20
+	.long	0x11d0
+	.byte	0x73
+	.byte	0x17
+	.uleb128 0x6
+	.long	.LASF2936
+	.byte	0x1d
+	.byte	0x77
+	.byte	0x1d
+	.long	0x99e
+	.uleb128 0x16
+	.long	0x9a3
+	.byte	0x77
+	.byte	0x4a
+	.uleb128 0x6
+	.long	.LASF2937
+	.byte	0x1d
+	.byte	0x77
+	.byte	0x79
+	.long	0x2ce
+	.uleb128 0x18
+	.long	0x120f
+	.byte	0xa3
+	.uleb128 0x20
+	.long	0x11fc
+	.byte	0x79
+	.byte	0x16
+	.uleb128 0x16
+	.long	0x6da
+	.byte	0x8d
+	.byte	0x4f
+	.uleb128 0x6
+	.long	.LASF2938
+	.byte	0x1d
+	.byte	0x8d
+	.byte	0x81
+	.long	0x2ce
+	.uleb128 0x18
+	.long	0x122f
+	.byte	0xae
+	.uleb128 0x16
+	.long	0x9bb
+	.byte	0x8e
+	.byte	0x4f
+	.uleb128 0x6
+	.long	.LASF2939
+	.byte	0x1d
+	.byte	0x8e
+	.byte	0x81
+	.long	0x2ce
+	.uleb128 0x18
+	.long	0x1248
+	.byte	0xae
+	.uleb128 0x16
+	.long	0x9af
+	.byte	0xaa
+	.byte	0xe
+	.uleb128 0x6
+	.long	.LASF2940
+	.byte	0x1d
+	.byte	0xaa
+	.byte	0x3b
+	.long	0x2ce
+	.uleb128 0x18
+	.long	0x1261
+	.byte	0x63
+	.uleb128 0x9
+	.long	.LASF2943
+	.byte	0x16
+	.byte	0x3e
+	.long	0x1284
+	.uleb128 0x7
+	.long	0xb7
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2945
+	.byte	0x19
+	.long	0x18b
+	.uleb128 0x17
+	.long	.LASF2941
+	.byte	0x1e
+	.byte	0x1b
+	.uleb128 0x17
+	.long	.LASF2942
+	.byte	0x1f
+	.byte	0xb3
+	.uleb128 0x9
+	.long	.LASF2944
+	.byte	0xf
+	.byte	0x2a
+	.long	0x12ad
+	.uleb128 0x7
+	.long	0x80a
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2946
+	.byte	0x1a
+	.long	0x18b
+	.uleb128 0x17
+	.long	.LASF2947
+	.byte	0x1f
+	.byte	0xb2
+	.uleb128 0x2c
+	.long	.LASF2949
+	.byte	0x20
+	.value	0x13d
+	.byte	0x11
+	.long	0x8f
+	.long	0x12d5
+	.uleb128 0x7
+	.long	0xe0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2948
+	.byte	0x19
+	.byte	0x8c
+	.long	0x12e6
+	.uleb128 0x7
+	.long	0x12e6
+	.byte	0
+	.uleb128 0x4
+	.long	0xf46
+	.uleb128 0x22
+	.long	.LASF2950
+	.byte	0x19
+	.byte	0x83
+	.long	0x18b
+	.long	0x1300
+	.uleb128 0x7
+	.long	0x1300
+	.byte	0
+	.uleb128 0x4
+	.long	0xf52
+	.uleb128 0x9
+	.long	.LASF2951
+	.byte	0x8
+	.byte	0x20
+	.long	0x1316
+	.uleb128 0x7
+	.long	0xd4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2952
+	.byte	0x8
+	.byte	0x1f
+	.long	0x1327
+	.uleb128 0x7
+	.long	0xd4
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2953
+	.byte	0x8
+	.byte	0x1d
+	.long	0x18b
+	.long	0x133c
+	.uleb128 0x7
+	.long	0xd4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2954
+	.byte	0x21
+	.byte	0x22
+	.long	0x134d
+	.uleb128 0x7
+	.long	0x9d3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2955
+	.byte	0x22
+	.byte	0x43
+	.long	0x135e
+	.uleb128 0x7
+	.long	0xc8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2956
+	.byte	0x1b
+	.byte	0x51
+	.long	0x136f
+	.uleb128 0x7
+	.long	0xc8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2957
+	.byte	0x1b
+	.byte	0x50
+	.long	0x1380
+	.uleb128 0x7
+	.long	0x1380
+	.byte	0
+	.uleb128 0x4
+	.long	0xfcf
+	.uleb128 0x17
+	.long	.LASF2958
+	.byte	0x23
+	.byte	0x4e
+	.uleb128 0x9
+	.long	.LASF2959
+	.byte	0x24
+	.byte	0x69
+	.long	0x139d
+	.uleb128 0x7
+	.long	0x9d3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2960
+	.byte	0x13
+	.byte	0xc8
+	.long	0x13b3
+	.uleb128 0x7
+	.long	0x13b3
+	.uleb128 0x7
+	.long	0x9d3
+	.byte	0
+	.uleb128 0x4
+	.long	0xb69
+	.uleb128 0x17
+	.long	.LASF2961
+	.byte	0x24
+	.byte	0x64
+	.uleb128 0x17
+	.long	.LASF2962
+	.byte	0x25
+	.byte	0x1b
+	.uleb128 0x9
+	.long	.LASF2963
+	.byte	0x7
+	.byte	0x76
+	.long	0x13d7
+	.uleb128 0x7
+	.long	0x13d7
+	.byte	0
+	.uleb128 0x4
+	.long	0x467
+	.uleb128 0x9
+	.long	.LASF2964
+	.byte	0x26
+	.byte	0x30
+	.long	0x13ed
+	.uleb128 0x7
+	.long	0xb7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2965
+	.byte	0x6
+	.byte	0xf4
+	.long	0x13fe
+	.uleb128 0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2966
+	.byte	0x6
+	.byte	0xf0
+	.long	0x140f
+	.uleb128 0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2968
+	.value	0x444
+	.long	0x1427
+	.uleb128 0x13
+	.long	.LASF2970
+	.value	0x444
+	.byte	0x29
+	.long	0xd4
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2967
+	.value	0x43f
+	.byte	0xa
+	.long	0xd4
+	.uleb128 0x12
+	.long	.LASF2969
+	.value	0x43a
+	.long	0x144b
+	.uleb128 0x13
+	.long	.LASF2970
+	.value	0x43a
+	.byte	0x20
+	.long	0xd4
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2971
+	.value	0x435
+	.byte	0xa
+	.long	0xd4
+	.uleb128 0x14
+	.long	.LASF2977
+	.value	0x430
+	.uleb128 0x12
+	.long	.LASF2972
+	.value	0x42b
+	.long	0x1476
+	.uleb128 0x13
+	.long	.LASF2970
+	.value	0x42b
+	.byte	0x1e
+	.long	0xd4
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2973
+	.value	0x426
+	.long	0x148e
+	.uleb128 0x13
+	.long	.LASF2974
+	.value	0x426
+	.byte	0x1e
+	.long	0xb7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2975
+	.value	0x421
+	.long	0x14a6
+	.uleb128 0x13
+	.long	.LASF2970
+	.value	0x421
+	.byte	0x1c
+	.long	0xd4
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2976
+	.value	0x417
+	.long	0x14be
+	.uleb128 0x13
+	.long	.LASF2742
+	.value	0x417
+	.byte	0x1f
+	.long	0xb7
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2978
+	.value	0x410
+	.uleb128 0x14
+	.long	.LASF2979
+	.value	0x408
+	.uleb128 0x14
+	.long	.LASF2980
+	.value	0x402
+	.uleb128 0x14
+	.long	.LASF2981
+	.value	0x3f9
+	.uleb128 0x14
+	.long	.LASF2982
+	.value	0x3e0
+	.uleb128 0x12
+	.long	.LASF2983
+	.value	0x394
+	.long	0x1531
+	.uleb128 0x15
+	.long	.LASF2984
+	.value	0x39e
+	.byte	0xb
+	.long	0xe0
+	.uleb128 0x15
+	.long	.LASF2985
+	.value	0x3ba
+	.byte	0x11
+	.long	0xe7
+	.uleb128 0x15
+	.long	.LASF2986
+	.value	0x3bb
+	.byte	0xb
+	.long	0xe0
+	.uleb128 0x23
+	.long	0x1522
+	.uleb128 0x15
+	.long	.LASF2987
+	.value	0x3d3
+	.byte	0x17
+	.long	0xc3
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.long	.LASF2988
+	.value	0x3d9
+	.byte	0x12
+	.long	0xd4
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2989
+	.value	0x341
+	.uleb128 0x14
+	.long	.LASF2990
+	.value	0x32b
+	.uleb128 0x14
+	.long	.LASF2991
+	.value	0x316
+	.uleb128 0x19
+	.long	.LASF2992
+	.value	0x1d5
+	.byte	0xa
+	.long	0xc8
+	.uleb128 0x19
+	.long	.LASF2993
+	.value	0x1d0
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0x2d
+	.long	.LASF3019
+	.byte	0x1d
+	.value	0x1c7
+	.byte	0xd
+	.long	0x1578
+	.uleb128 0x13
+	.long	.LASF2742
+	.value	0x1c7
+	.byte	0x23
+	.long	0xb7
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2994
+	.value	0x1c2
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0x12
+	.long	.LASF2995
+	.value	0x1a5
+	.long	0x15a9
+	.uleb128 0x13
+	.long	.LASF2996
+	.value	0x1a5
+	.byte	0x33
+	.long	0x15a9
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.string	"i"
+	.byte	0x1d
+	.value	0x1a7
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x6ce
+	.uleb128 0x12
+	.long	.LASF2997
+	.value	0x150
+	.long	0x15e6
+	.uleb128 0x13
+	.long	.LASF2998
+	.value	0x150
+	.byte	0x33
+	.long	0x15e6
+	.uleb128 0x23
+	.long	0x15d7
+	.uleb128 0x15
+	.long	.LASF2999
+	.value	0x152
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.long	.LASF3000
+	.value	0x157
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x7c6
+	.uleb128 0xa
+	.long	.LASF3001
+	.byte	0x1c
+	.byte	0x46
+	.byte	0x96
+	.long	0x15f7
+	.uleb128 0x4
+	.long	0x11ac
+	.uleb128 0xa
+	.long	.LASF3002
+	.byte	0x1c
+	.byte	0x46
+	.byte	0x4a
+	.long	0x1608
+	.uleb128 0x4
+	.long	0x11b8
+	.uleb128 0xa
+	.long	.LASF3003
+	.byte	0x1b
+	.byte	0x48
+	.byte	0xcc
+	.long	0x1619
+	.uleb128 0x4
+	.long	0x10b2
+	.uleb128 0xa
+	.long	.LASF3004
+	.byte	0x1b
+	.byte	0x48
+	.byte	0x65
+	.long	0x162a
+	.uleb128 0x4
+	.long	0x10be
+	.uleb128 0xa
+	.long	.LASF3005
+	.byte	0x19
+	.byte	0x78
+	.byte	0xa2
+	.long	0x12e6
+	.uleb128 0xa
+	.long	.LASF3006
+	.byte	0x19
+	.byte	0x78
+	.byte	0x50
+	.long	0x1300
+	.uleb128 0xa
+	.long	.LASF3007
+	.byte	0x16
+	.byte	0x38
+	.byte	0xa2
+	.long	0x1653
+	.uleb128 0x4
+	.long	0xcad
+	.uleb128 0xa
+	.long	.LASF3008
+	.byte	0x16
+	.byte	0x38
+	.byte	0x50
+	.long	0x1664
+	.uleb128 0x4
+	.long	0xcb9
+	.uleb128 0xa
+	.long	.LASF3009
+	.byte	0x14
+	.byte	0x75
+	.byte	0x9c
+	.long	0x1675
+	.uleb128 0x4
+	.long	0xbe5
+	.uleb128 0xa
+	.long	.LASF3010
+	.byte	0x14
+	.byte	0x75
+	.byte	0x4d
+	.long	0x1686
+	.uleb128 0x4
+	.long	0xbf1
+	.uleb128 0x24
+	.long	.LASF3017
+	.byte	0x13
+	.byte	0x93
+	.byte	0x7b
+	.long	0x13b3
+	.long	0x16a8
+	.uleb128 0x1d
+	.long	.LASF3011
+	.byte	0x13
+	.byte	0x93
+	.byte	0x98
+	.long	0x7c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF3012
+	.byte	0x12
+	.byte	0x25
+	.byte	0x74
+	.long	0x16b4
+	.uleb128 0x4
+	.long	0xa0b
+	.uleb128 0xa
+	.long	.LASF3013
+	.byte	0x11
+	.byte	0x4b
+	.byte	0xa2
+	.long	0x16c5
+	.uleb128 0x4
+	.long	0x992
+	.uleb128 0xa
+	.long	.LASF3014
+	.byte	0x11
+	.byte	0x4b
+	.byte	0x50
+	.long	0x16d6
+	.uleb128 0x4
+	.long	0x99e
+	.uleb128 0xa
+	.long	.LASF3015
+	.byte	0x7
+	.byte	0x64
+	.byte	0x90
+	.long	0x16e7
+	.uleb128 0x4
+	.long	0x4af
+	.uleb128 0xa
+	.long	.LASF3016
+	.byte	0x7
+	.byte	0x64
+	.byte	0x47
+	.long	0x16f8
+	.uleb128 0x4
+	.long	0x4bb
+	.uleb128 0x24
+	.long	.LASF3018
+	.byte	0x7
+	.byte	0x5d
+	.byte	0xb4
+	.long	0x171a
+	.long	0x171a
+	.uleb128 0x1d
+	.long	.LASF3011
+	.byte	0x7
+	.byte	0x5d
+	.byte	0xcb
+	.long	0x7c
+	.byte	0
+	.uleb128 0x4
+	.long	0x45b
+	.uleb128 0x2f
+	.long	.LASF3020
+	.byte	0x27
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x25
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x25
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0x1d
+	.long	.LASF3021
+	.byte	0x27
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 39
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 40 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 41 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 42 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2a
+	.file 43 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 45 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 46 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x2e
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x30
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 49 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 51 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x33
+	.file 52 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x30
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 56 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 57 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 60 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 61 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3e
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1181
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1221
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 72 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x48
+	.file 73 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 74 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x4a
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 75 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x4b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0x4
+	.file 76 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 77 "./src/main/blackbox/blackbox_io.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 78 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4e
+	.file 79 "./src/main/drivers/display.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4f
+	.byte	0x4
+	.file 80 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1622
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 81 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 82 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1635
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1652
+	.byte	0x4
+	.file 83 "./src/main/config/config_profile.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x53
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x8
+	.byte	0x4
+	.file 84 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 85 "./src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x55
+	.file 86 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x56
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa
+	.byte	0x4
+	.file 87 "./src/main/drivers/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 88 "./src/main/drivers/compass.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1869
+	.byte	0x4
+	.file 89 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x59
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 90 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x5a
+	.file 91 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.file 92 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.file 93 "./src/main/drivers/light_ws2811strip.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.file 94 "./src/main/drivers/max7456.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 95 "./src/main/drivers/pwm_esc_detect.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0xd
+	.file 96 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x60
+	.file 97 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x61
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 98 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.file 99 "./src/main/drivers/rx_spi.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x63
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2312
+	.byte	0x4
+	.file 100 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2313
+	.byte	0x4
+	.file 101 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.file 102 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x11
+	.file 103 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x67
+	.byte	0x4
+	.file 104 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x68
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2321
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2322
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.file 105 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.file 106 "./src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x6a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x16
+	.byte	0x4
+	.file 107 "./src/main/io/gimbal.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x6b
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2389
+	.byte	0x4
+	.file 108 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.file 109 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0x6d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2447
+	.byte	0x4
+	.file 110 "./src/main/io/servos.h"
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0x6e
+	.byte	0x4
+	.file 111 "./src/main/io/vtx.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x6f
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x58
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.file 112 "./src/main/rx/rx_spi.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5b
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x4
+	.file 113 "./src/main/sensors/barometer.h"
+	.byte	0x3
+	.uleb128 0x5c
+	.uleb128 0x71
+	.file 114 "./src/main/drivers/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x72
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2490
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2491
+	.byte	0x4
+	.file 115 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x73
+	.file 116 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x74
+	.file 117 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x75
+	.byte	0x4
+	.byte	0x4
+	.file 118 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x76
+	.file 119 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x77
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x4
+	.byte	0x4
+	.file 120 "./src/main/sensors/boardalignment.h"
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x78
+	.byte	0x4
+	.file 121 "./src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x79
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x1c
+	.byte	0x4
+	.file 122 "./src/main/telemetry/telemetry.h"
+	.byte	0x3
+	.uleb128 0x63
+	.uleb128 0x7a
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2496
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF2516
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1143
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1147
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1159
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1171
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1173
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1290
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1293
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1299
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1303
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1308
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1335
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1496
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1509
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1526
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1527
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1530
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1457
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1567
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1575
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1580
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1583
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1585
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_io.h.30.a114963d091db95615e5092df395f98f,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1621
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.18.bfa4ba22e867d998ef89fe9a1289a151,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1634
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1651
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1685
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1769
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1859
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1868
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1871
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1879
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1897
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1909
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2277
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.23.95742be8daec10c1d662dd67b9ee58de,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2287
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_ws2811strip.h.22.476ac9f83a5063ff7f13d2eeb489b6c4,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2294
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.max7456.h.21.59264cd1e20507bb3a63ba829e3208aa,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2309
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2311
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2317
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2348
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.83.ab548d0b7b32a9305f216da5287d33d8,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2351
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2360
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2368
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.8362794d947c339e17997ec0162d97db,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2377
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.66.6f7d1d067dff5370bea805da42b83f88,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2388
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.25.44d42bc8a2509f001b7da5aa9bee7ce3,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2442
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.23.dfeea95d53f02f32dbd532b1d756929b,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2446
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx.h.22.12f28c2beccab569593ab27679518da5,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2480
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_spi.h.64.fd2df210de894f8eb89a02c524951c8f,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2486
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2489
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2495
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x16
+	.long	.LASF1
+	.long	.LASF3023
+	.long	.LASF3024
+	.long	.LASF3025
+	.long	.LASF3026
+	.long	.LASF3027
+	.long	.LASF3028
+	.long	.LASF3029
+	.long	.LASF3030
+	.long	.LASF3031
+	.long	.LASF3032
+	.long	.LASF3033
+	.long	.LASF3034
+	.long	.LASF3035
+	.long	.LASF3036
+	.long	.LASF3037
+	.long	.LASF3038
+	.long	.LASF3039
+	.long	.LASF3040
+	.long	.LASF3041
+	.long	.LASF3042
+	.long	.LASF3043
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x7b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3044
+	.byte	0x11
+	.long	.LASF3045
+	.byte	0x11
+	.long	.LASF3046
+	.byte	0x11
+	.long	.LASF3047
+	.byte	0x2
+	.long	.LASF3048
+	.byte	0x4
+	.long	.LASF3049
+	.byte	0x5
+	.long	.LASF3050
+	.byte	0x8
+	.long	.LASF3051
+	.byte	0x5
+	.long	.LASF3052
+	.byte	0x6
+	.long	.LASF3053
+	.byte	0x6
+	.long	.LASF3054
+	.byte	0x6
+	.long	.LASF3055
+	.byte	0x6
+	.long	.LASF3056
+	.byte	0x6
+	.long	.LASF3057
+	.byte	0x6
+	.long	.LASF3058
+	.byte	0x6
+	.long	.LASF3059
+	.byte	0x6
+	.long	.LASF3060
+	.byte	0x7
+	.long	.LASF3061
+	.byte	0x7
+	.long	.LASF3062
+	.byte	0x7
+	.long	.LASF3063
+	.byte	0x8
+	.long	.LASF3064
+	.byte	0x8
+	.long	.LASF3065
+	.byte	0x9
+	.long	.LASF3066
+	.byte	0x9
+	.long	.LASF3067
+	.byte	0x9
+	.long	.LASF3057
+	.byte	0x9
+	.long	.LASF3068
+	.byte	0xb
+	.long	.LASF3069
+	.byte	0xb
+	.long	.LASF3070
+	.byte	0xb
+	.long	.LASF3071
+	.byte	0x7
+	.long	.LASF3072
+	.byte	0x5
+	.long	.LASF3073
+	.byte	0xa
+	.long	.LASF3074
+	.byte	0x11
+	.long	.LASF3075
+	.byte	0x8
+	.long	.LASF3076
+	.byte	0x8
+	.long	.LASF3077
+	.byte	0x8
+	.long	.LASF3078
+	.byte	0x7
+	.long	.LASF3079
+	.byte	0x7
+	.long	.LASF3080
+	.byte	0x7
+	.long	.LASF3081
+	.byte	0x4
+	.long	.LASF3082
+	.byte	0x14
+	.long	.LASF3083
+	.byte	0x15
+	.long	.LASF3084
+	.byte	0x15
+	.long	.LASF3084
+	.byte	0x14
+	.long	.LASF3085
+	.byte	0x11
+	.long	.LASF3086
+	.byte	0x14
+	.long	.LASF3087
+	.byte	0x14
+	.long	.LASF3088
+	.byte	0x11
+	.long	.LASF3089
+	.byte	0x11
+	.long	.LASF3090
+	.byte	0x13
+	.long	.LASF3091
+	.byte	0x11
+	.long	.LASF3092
+	.byte	0x12
+	.long	.LASF3093
+	.byte	0x12
+	.long	.LASF3094
+	.byte	0x11
+	.long	.LASF3095
+	.byte	0x11
+	.long	.LASF3096
+	.byte	0x11
+	.long	.LASF3097
+	.byte	0x14
+	.long	.LASF3098
+	.byte	0x15
+	.long	.LASF3099
+	.byte	0x10
+	.long	.LASF3100
+	.byte	0x10
+	.long	.LASF3101
+	.byte	0x14
+	.long	.LASF3102
+	.byte	0x14
+	.long	.LASF3103
+	.byte	0x11
+	.long	.LASF3104
+	.byte	0x11
+	.long	.LASF3105
+	.byte	0x11
+	.long	.LASF3106
+	.byte	0x11
+	.long	.LASF3107
+	.byte	0x11
+	.long	.LASF3108
+	.byte	0x11
+	.long	.LASF3109
+	.byte	0x11
+	.long	.LASF3110
+	.byte	0x11
+	.long	.LASF3111
+	.byte	0x11
+	.long	.LASF3112
+	.byte	0x11
+	.long	.LASF3113
+	.byte	0xf
+	.long	.LASF3114
+	.byte	0xd
+	.long	.LASF3115
+	.byte	0xc
+	.long	.LASF3116
+	.byte	0xd
+	.long	.LASF3117
+	.byte	0x2
+	.long	.LASF3118
+	.byte	0x1
+	.long	.LASF3119
+	.byte	0x3
+	.long	.LASF3120
+	.byte	0x6
+	.long	.LASF3121
+	.byte	0x4
+	.long	.LASF3122
+	.byte	0x4
+	.long	.LASF3123
+	.byte	0x4
+	.long	.LASF3124
+	.byte	0x5
+	.long	.LASF3125
+	.byte	0x5
+	.long	.LASF3126
+	.byte	0x6
+	.long	.LASF3127
+	.byte	0x6
+	.long	.LASF3128
+	.byte	0x6
+	.long	.LASF3129
+	.byte	0x6
+	.long	.LASF3130
+	.byte	0x6
+	.long	.LASF3131
+	.byte	0x6
+	.long	.LASF3132
+	.byte	0x4
+	.long	.LASF3133
+	.byte	0x6
+	.long	.LASF3134
+	.byte	0x6
+	.long	.LASF3135
+	.byte	0x6
+	.long	.LASF3136
+	.byte	0x6
+	.long	.LASF3137
+	.byte	0x6
+	.long	.LASF3138
+	.byte	0x6
+	.long	.LASF3139
+	.byte	0x6
+	.long	.LASF3140
+	.byte	0x6
+	.long	.LASF3141
+	.byte	0x6
+	.long	.LASF3142
+	.byte	0x6
+	.long	.LASF3143
+	.byte	0x6
+	.long	.LASF3144
+	.byte	0x6
+	.long	.LASF3145
+	.byte	0x6
+	.long	.LASF3146
+	.byte	0x7
+	.long	.LASF3147
+	.byte	0x8
+	.long	.LASF3148
+	.byte	0x9
+	.long	.LASF3149
+	.byte	0x9
+	.long	.LASF3150
+	.byte	0x9
+	.long	.LASF3064
+	.byte	0x9
+	.long	.LASF3151
+	.byte	0x9
+	.long	.LASF3140
+	.byte	0xa
+	.long	.LASF3152
+	.byte	0xb
+	.long	.LASF3152
+	.byte	0x6
+	.long	.LASF3153
+	.byte	0xb
+	.long	.LASF3154
+	.byte	0xb
+	.long	.LASF3155
+	.byte	0xb
+	.long	.LASF3156
+	.byte	0xb
+	.long	.LASF3157
+	.byte	0xb
+	.long	.LASF3158
+	.byte	0xb
+	.long	.LASF3129
+	.byte	0xb
+	.long	.LASF3159
+	.byte	0xe
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2033:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2269:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1155:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2368:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF2329:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF2939:
+	.string	"serialPinConfig_Registry"
+.LASF2952:
+	.string	"featureSet"
+.LASF2341:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1206:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF826:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1408:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1388:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF2104:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1207:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF1082:
+	.string	"__DECL_SIMD_exp"
+.LASF1484:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1334:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF2562:
+	.string	"RGB_GREEN"
+.LASF1101:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF2499:
+	.string	"UART1_RX_PIN NONE"
+.LASF3016:
+	.string	"pidConfig"
+.LASF2579:
+	.string	"PIDPITCH"
+.LASF1520:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2823:
+	.string	"beeperConfig_s"
+.LASF2826:
+	.string	"beeperConfig_t"
+.LASF2389:
+	.string	"GIMBAL_MODE_MAX (GIMBAL_MODE_MIXTILT)"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1603:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF935:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF2733:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1358:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2288:
+	.string	"WS2811_LED_STRIP_LENGTH 32"
+.LASF2123:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1255:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1485:
+	.string	"TELEMETRY_MAVLINK "
+.LASF2888:
+	.string	"reboot_character"
+.LASF2855:
+	.string	"OSD_YAW_PIDS"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1556:
+	.string	"USE_PPM"
+.LASF2010:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF2828:
+	.string	"modeColorIndexes_s"
+.LASF2830:
+	.string	"modeColorIndexes_t"
+.LASF2714:
+	.string	"FEATURE_RX_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF2273:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1620:
+	.string	"BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256"
+.LASF1464:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF2067:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1914:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1679:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF999:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF979:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF836:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1434:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1144:
+	.string	"__DECL_SIMD_log1pf"
+.LASF2293:
+	.string	"WS2811_TIMER_MHZ 24"
+.LASF1622:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1653:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF939:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1210:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1402:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF879:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF2924:
+	.string	"gyro_to_use"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2523:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1124:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1741:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF2345:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1409:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF2560:
+	.string	"_Bool"
+.LASF1730:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF2961:
+	.string	"resetAdjustmentStates"
+.LASF794:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1963:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2369:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1536:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1267:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1234:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF845:
+	.string	"__DECL_SIMD_pow "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2639:
+	.string	"OWNER_ADC_CURR"
+.LASF931:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF983:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF764:
+	.string	"__need_size_t "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF2260:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF2133:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2125:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2233:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2578:
+	.string	"PIDROLL"
+.LASF2344:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF2610:
+	.string	"pidConfig_s"
+.LASF2613:
+	.string	"pidConfig_t"
+.LASF2996:
+	.string	"statusLedConfig"
+.LASF1890:
+	.string	"BIT(x) (1 << (x))"
+.LASF1339:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1865:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF1863:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1659:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF2627:
+	.string	"CW90_DEG_FLIP"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2559:
+	.string	"DEBUG_COUNT"
+.LASF1912:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2478:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2196:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2508:
+	.string	"UART5_TX_PIN NONE"
+.LASF2142:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2189:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1806:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2629:
+	.string	"CW270_DEG_FLIP"
+.LASF2006:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2355:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF840:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1512:
+	.string	"__WCHAR_T__ "
+.LASF1994:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2056:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1492:
+	.string	"USE_SENSOR_NAMES "
+.LASF2504:
+	.string	"UART3_TX_PIN NONE"
+.LASF2300:
+	.string	"VIDEO_LINES_NTSC 13"
+.LASF2265:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1646:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1525:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1248:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1237:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1261:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1006:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF811:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1371:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF1961:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2585:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1238:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF937:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1851:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF2212:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1208:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1687:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2297:
+	.string	"BWBRIGHTNESS ((BLACKBRIGHTNESS << 2) | WHITEBRIGHTNESS)"
+.LASF2636:
+	.string	"OWNER_LED"
+.LASF799:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1936:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2241:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2214:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2723:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2082:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF2563:
+	.string	"RGB_BLUE"
+.LASF2533:
+	.string	"uint16_t"
+.LASF837:
+	.string	"__DECL_SIMD_expl "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2275:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF2977:
+	.string	"beeperOffClearAll"
+.LASF1117:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF2304:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF2912:
+	.string	"accelerometerTrims"
+.LASF1160:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2204:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2095:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2458:
+	.string	"PWM_PULSE_MIN 750"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2415:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF2183:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1475:
+	.string	"TELEMETRY_HOTT "
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1126:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2207:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1665:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF1325:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2818:
+	.string	"INPUT_RC_AUX3"
+.LASF2296:
+	.string	"BLACKBRIGHTNESS 0x00"
+.LASF1600:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF2084:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1972:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1308:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF1869:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1898:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2210:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1839:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1977:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1727:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF807:
+	.string	"__DECL_SIMD_sinl "
+.LASF2085:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1776:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1719:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1691:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1073:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF2051:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1365:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF2313:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2807:
+	.string	"motorConfig_System"
+.LASF2225:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2957:
+	.string	"setAccelerationTrims"
+.LASF2242:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF2811:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF2206:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2970:
+	.string	"mask"
+.LASF2299:
+	.string	"VIDEO_BUFFER_CHARS_PAL 480"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2886:
+	.string	"portConfigs"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF2975:
+	.string	"beeperOffSet"
+.LASF1704:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1788:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF2038:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1868:
+	.string	"GYRO_LPF_NONE 7"
+.LASF2409:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2820:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF1390:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1412:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1843:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF828:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2108:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2423:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF3002:
+	.string	"gyroConfig"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2096:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1946:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF1711:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2641:
+	.string	"OWNER_ADC_RSSI"
+.LASF1383:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF2228:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1643:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2291:
+	.string	"WS2811_DATA_BUFFER_SIZE (WS2811_BITS_PER_LED * WS2811_LED_STRIP_LENGTH)"
+.LASF2778:
+	.string	"BOXSONAR"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF2105:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2587:
+	.string	"PIDVEL"
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1198:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF2964:
+	.string	"setControlRateProfile"
+.LASF2088:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1441:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1414:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF1820:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1814:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF884:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2236:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2749:
+	.string	"vcdProfile_System"
+.LASF1288:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1967:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF2192:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF827:
+	.string	"__DECL_SIMD_logl "
+.LASF2407:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF1395:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF2643:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2663:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1333:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF816:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1172:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1158:
+	.string	"__DECL_SIMD_tanh"
+.LASF1501:
+	.string	"_T_PTRDIFF_ "
+.LASF2958:
+	.string	"failsafeReset"
+.LASF1064:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1932:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2322:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1879:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2682:
+	.string	"statusLedConfig_System"
+.LASF2557:
+	.string	"DEBUG_GYRO_TO_MOTOR"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1423:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF2668:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2310:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1099:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1658:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1940:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1586:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF2889:
+	.string	"serialConfig_t"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1170:
+	.string	"__DECL_SIMD_tan"
+.LASF910:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1249:
+	.string	"_Mdouble_"
+.LASF1393:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1896:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1176:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2878:
+	.string	"functionMask"
+.LASF1337:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1387:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF2215:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1639:
+	.string	"FAST_MATH "
+.LASF1542:
+	.string	"BARO "
+.LASF1323:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF2790:
+	.string	"channelRange_s"
+.LASF2793:
+	.string	"channelRange_t"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1146:
+	.string	"__DECL_SIMD_atanh"
+.LASF1019:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1832:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1260:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1824:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1110:
+	.string	"__DECL_SIMD_exp10"
+.LASF2240:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2186:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF2611:
+	.string	"pid_process_denom"
+.LASF1532:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF2007:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2944:
+	.string	"failureMode"
+.LASF1184:
+	.string	"__HAVE_FLOAT64 1"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2354:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1581:
+	.string	"VTX_TRAMP"
+.LASF1229:
+	.string	"FP_INT_UPWARD 0"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2665:
+	.string	"OWNER_BARO_EXTI"
+.LASF1090:
+	.string	"__DECL_SIMD_acos"
+.LASF2442:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF1084:
+	.string	"__DECL_SIMD_expf"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2316:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF546:
+	.string	"__always_inline"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1020:
+	.string	"__DECL_SIMD_erff64 "
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2511:
+	.string	"UART7_RX_PIN NONE"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1227:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF2268:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2900:
+	.string	"values"
+.LASF2943:
+	.string	"beeperConfirmationBeeps"
+.LASF2406:
+	.string	"LED_POS_OFFSET 0"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2023:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2642:
+	.string	"OWNER_SERIAL_TX"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2761:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1724:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF2496:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF1250:
+	.string	"__MATH_PRECNAME"
+.LASF970:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF2947:
+	.string	"suspendRxSignal"
+.LASF3001:
+	.string	"gyroConfigMutable"
+.LASF1134:
+	.string	"__DECL_SIMD_log10"
+.LASF2568:
+	.string	"PGR_SIZE_MASK"
+.LASF2797:
+	.string	"range"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1118:
+	.string	"__DECL_SIMD_expm1"
+.LASF1310:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF902:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1311:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1103:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1253:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1807:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF2298:
+	.string	"VIDEO_BUFFER_CHARS_NTSC 390"
+.LASF1036:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1381:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1220:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF2709:
+	.string	"vcdProfile_s"
+.LASF2713:
+	.string	"vcdProfile_t"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1488:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1420:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2704:
+	.string	"FAILURE_ACC_INCOMPATIBLE"
+.LASF2020:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF2987:
+	.string	"maxPidProcessDenom"
+.LASF2180:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2619:
+	.string	"featureConfig_System"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF2126:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1142:
+	.string	"__DECL_SIMD_log1p"
+.LASF1007:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1314:
+	.string	"__MATHCALL_NARROW"
+.LASF2547:
+	.string	"DEBUG_VELOCITY"
+.LASF2721:
+	.string	"FEATURE_FAILSAFE"
+.LASF1044:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1980:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF863:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF2679:
+	.string	"ledTags"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1291:
+	.string	"_Mret_ _Float32"
+.LASF1810:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF793:
+	.string	"_MATH_H 1"
+.LASF2953:
+	.string	"featureConfigured"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1786:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1271:
+	.string	"__MATHDECL_1"
+.LASF1143:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF2771:
+	.string	"BOXLEDLOW"
+.LASF2586:
+	.string	"PIDMAG"
+.LASF1127:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2666:
+	.string	"OWNER_USB"
+.LASF3000:
+	.string	"index"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2978:
+	.string	"saveConfigAndNotify"
+.LASF2462:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1755:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF2677:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2179:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1773:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1057:
+	.string	"__DECL_SIMD_tanl "
+.LASF2349:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1875:
+	.string	"IOCFG_AF_PP 0"
+.LASF2759:
+	.string	"BOXHORIZON"
+.LASF3014:
+	.string	"systemConfig"
+.LASF2792:
+	.string	"endStep"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2993:
+	.string	"getCurrentControlRateProfileIndex"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1779:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF2202:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2393:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF2383:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF1669:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2596:
+	.string	"pidSumLimit"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f"
+.LASF929:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF2626:
+	.string	"CW0_DEG_FLIP"
+.LASF883:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2353:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF895:
+	.string	"__DECL_SIMD_exp2 "
+.LASF2805:
+	.string	"motorPoleCount"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF2350:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF2379:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_THROTTLE"
+.LASF2801:
+	.string	"digitalIdleOffsetPercent"
+.LASF913:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2138:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1862:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1457:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF2739:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1699:
+	.string	"PG_PID_PROFILE 14"
+.LASF2591:
+	.string	"dterm_lpf_hz"
+.LASF1280:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1245:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF2699:
+	.string	"ioTagRx"
+.LASF2392:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2725:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2362:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2581:
+	.string	"PIDALT"
+.LASF2043:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2272:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2211:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2772:
+	.string	"BOXLLIGHTS"
+.LASF1178:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1886:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2647:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1572:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1364:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF2059:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1389:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF2722:
+	.string	"FEATURE_SONAR"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2827:
+	.string	"beeperConfig_System"
+.LASF851:
+	.string	"__DECL_SIMD_powf128 "
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1716:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1759:
+	.string	"PG_VTX_CONFIG 515"
+.LASF2908:
+	.string	"acc_lpf_hz"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1398:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF2635:
+	.string	"OWNER_SERVO"
+.LASF2342:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1892:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1181:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1392:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF2983:
+	.string	"validateAndFixGyroConfig"
+.LASF1069:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2583:
+	.string	"PIDPOSR"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2230:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1483:
+	.string	"TELEMETRY_IBUS "
+.LASF1462:
+	.string	"USE_PWM "
+.LASF920:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1858:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF3006:
+	.string	"serialConfig"
+.LASF1860:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF996:
+	.string	"__DECL_SIMD_atanhf "
+.LASF2305:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF2312:
+	.string	"RX_SPI_MAX_PAYLOAD_SIZE 32"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1163:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1652:
+	.string	"EEPROM_CONF_VERSION 159"
+.LASF1108:
+	.string	"__DECL_SIMD_exp2f"
+.LASF1930:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1714:
+	.string	"PG_GPS_CONFIG 30"
+.LASF2109:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF941:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1625:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF2540:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1964:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF854:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1723:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF2257:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1933:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2103:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1304:
+	.string	"_Mret_ _Float64"
+.LASF2119:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2160:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2232:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2556:
+	.string	"DEBUG_DYN_NOTCH"
+.LASF2622:
+	.string	"CW0_DEG"
+.LASF1431:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF2897:
+	.string	"roll"
+.LASF1507:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1671:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1938:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1426:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1498:
+	.string	"_STDDEF_H_ "
+.LASF2899:
+	.string	"flightDynamicsTrims_def_t"
+.LASF2453:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2524:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2164:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2594:
+	.string	"dterm_notch_cutoff"
+.LASF2698:
+	.string	"ioTagTx"
+.LASF2545:
+	.string	"DEBUG_NOTCH"
+.LASF2526:
+	.string	"__uint16_t"
+.LASF1201:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2337:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF1285:
+	.string	"_Marg_"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2634:
+	.string	"OWNER_MOTOR"
+.LASF921:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1599:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF2022:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1596:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2027:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1335:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF2205:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1647:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF1847:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2662:
+	.string	"OWNER_RX_SPI_CS"
+.LASF2824:
+	.string	"beeper_off_flags"
+.LASF966:
+	.string	"__DECL_SIMD_log10f "
+.LASF2625:
+	.string	"CW270_DEG"
+.LASF2919:
+	.string	"gyro_lpf"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2055:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1830:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF891:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1063:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF2127:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1344:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF2308:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF1910:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1805:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF2387:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1305:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF959:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2734:
+	.string	"FEATURE_AIRMODE"
+.LASF2800:
+	.string	"motorConfig_s"
+.LASF2806:
+	.string	"motorConfig_t"
+.LASF2448:
+	.string	"VTX_BAND_MIN 1"
+.LASF922:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1128:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF2157:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1941:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1870:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF1018:
+	.string	"__DECL_SIMD_erff16 "
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1966:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1674:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1637:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF823:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2703:
+	.string	"FAILURE_ACC_INIT"
+.LASF892:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF2302:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF3011:
+	.string	"_index"
+.LASF2893:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1328:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2892:
+	.string	"SENSOR_INDEX_ACC"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1298:
+	.string	"_Marg_ _Float128"
+.LASF1197:
+	.string	"__f32x(x) x ##f32x"
+.LASF2411:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1231:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2239:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2430:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF1351:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF2447:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF2058:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2372:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2444:
+	.string	"VISIBLE(x) (x & VISIBLE_FLAG)"
+.LASF1884:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1312:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1760:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1633:
+	.string	"HSV_VALUE_MAX 255"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2065:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1918:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1915:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2517:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1301:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1931:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1283:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2717:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2143:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2716:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1766:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1769:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1508:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1799:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1762:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1867:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF2856:
+	.string	"OSD_POWER"
+.LASF1743:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2252:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2440:
+	.string	"LO(name) LED_FLAG_OVERLAY(LED_OVERLAY_ ## name)"
+.LASF1717:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF887:
+	.string	"__DECL_SIMD_hypotl "
+.LASF364:
+	.string	"__k8 1"
+.LASF2290:
+	.string	"WS2811_DELAY_BUFFER_LENGTH 42"
+.LASF1700:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF2971:
+	.string	"getBeeperOffMask"
+.LASF2317:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF2691:
+	.string	"motorPwmProtocol"
+.LASF2535:
+	.string	"float"
+.LASF1421:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1695:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1661:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF2506:
+	.string	"UART4_TX_PIN NONE"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF2751:
+	.string	"currentPidProfile"
+.LASF2229:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1811:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1522:
+	.string	"___int_wchar_t_h "
+.LASF1790:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF3008:
+	.string	"beeperConfig"
+.LASF1273:
+	.string	"__MATHDECL"
+.LASF1538:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1489:
+	.string	"USE_MSP_PUSH "
+.LASF2498:
+	.string	"RX_SPI_DEFAULT_PROTOCOL 0"
+.LASF1017:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2315:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF2000:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1557:
+	.string	"USE_PWM"
+.LASF1382:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF2482:
+	.string	"RC_CHANNEL_FLIP RC_SPI_AUX2"
+.LASF1962:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF878:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1500:
+	.string	"_PTRDIFF_T "
+.LASF2773:
+	.string	"BOXCALIB"
+.LASF2573:
+	.string	"pgRegistry_s"
+.LASF2577:
+	.string	"pgRegistry_t"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1067:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1979:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF2719:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1747:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1609:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1947:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF2047:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1145:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF974:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF899:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1794:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1775:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF2621:
+	.string	"ALIGN_DEFAULT"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1627:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF943:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2769:
+	.string	"BOXBEEPERON"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1793:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF1479:
+	.string	"USE_SERVOS "
+.LASF2688:
+	.string	"PWM_TYPE_MAX"
+.LASF2361:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1777:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF380:
+	.string	"__unix 1"
+.LASF2570:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1942:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2245:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2481:
+	.string	"RC_CHANNEL_RATE RC_SPI_AUX1"
+.LASF2307:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF2674:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF2469:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1472:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2182:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1096:
+	.string	"__DECL_SIMD_atanf"
+.LASF1740:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1834:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2147:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2377:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF868:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1329:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2045:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1702:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF3021:
+	.string	"high"
+.LASF1257:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1307:
+	.string	"_Mret_ _Float64x"
+.LASF1539:
+	.string	"USE_FAKE_GYRO "
+.LASF1322:
+	.string	"FP_NORMAL 4"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1519:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2050:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1803:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1543:
+	.string	"USE_FAKE_BARO "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2118:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2121:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1406:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF2686:
+	.string	"PWM_TYPE_MULTISHOT"
+.LASF2656:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF2831:
+	.string	"specialColorIndexes_s"
+.LASF2832:
+	.string	"specialColorIndexes_t"
+.LASF1770:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1372:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2968:
+	.string	"setPreferredBeeperOffMask"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF925:
+	.string	"__DECL_SIMD_expm1 "
+.LASF2024:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF997:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1014:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF2016:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1425:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1368:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF1190:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1971:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1791:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF2400:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF1934:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF817:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF2736:
+	.string	"FEATURE_VTX"
+.LASF2318:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF894:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2161:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1317:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1644:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF2549:
+	.string	"DEBUG_ANGLERATE"
+.LASF1102:
+	.string	"__DECL_SIMD_hypot"
+.LASF1634:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF2053:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2853:
+	.string	"OSD_ROLL_PIDS"
+.LASF2789:
+	.string	"boxId_e"
+.LASF2566:
+	.string	"PGR_PGN_MASK"
+.LASF2072:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2779:
+	.string	"BOXSERVO1"
+.LASF2780:
+	.string	"BOXSERVO2"
+.LASF2781:
+	.string	"BOXSERVO3"
+.LASF1831:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1187:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1244:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1247:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2737:
+	.string	"FEATURE_RX_SPI"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF3005:
+	.string	"serialConfigMutable"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2129:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2321:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF2741:
+	.string	"systemConfig_s"
+.LASF2747:
+	.string	"systemConfig_t"
+.LASF2255:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2184:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1722:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF804:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1459:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF1872:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF2690:
+	.string	"motorPwmRate"
+.LASF1094:
+	.string	"__DECL_SIMD_atan"
+.LASF1070:
+	.string	"__DECL_SIMD_sin"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1449:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2267:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF2942:
+	.string	"resumeRxSignal"
+.LASF2881:
+	.string	"gps_baudrateIndex"
+.LASF1232:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF2702:
+	.string	"FAILURE_MISSING_ACC"
+.LASF844:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1921:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2327:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1168:
+	.string	"__DECL_SIMD_erfcf"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1592:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2580:
+	.string	"PIDYAW"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2390:
+	.string	"LAT 0"
+.LASF2422:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF1189:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF795:
+	.string	"__DECL_SIMD_cos "
+.LASF1066:
+	.string	"__DECL_SIMD_cos"
+.LASF2426:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF2959:
+	.string	"useAdjustmentConfig"
+.LASF1428:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1772:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1853:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF2437:
+	.string	"LED_XY_MASK 0x0F"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF954:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2473:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2667:
+	.string	"OWNER_USB_DETECT"
+.LASF973:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2216:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2106:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1950:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF876:
+	.string	"__DECL_SIMD_asinf "
+.LASF2248:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1826:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1871:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1813:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2574:
+	.string	"size"
+.LASF1461:
+	.string	"USE_PPM "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF2070:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF2141:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2326:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1742:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1614:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2261:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1854:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1531:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1068:
+	.string	"__DECL_SIMD_cosf"
+.LASF2986:
+	.string	"motorUpdateRestriction"
+.LASF1114:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1905:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF2075:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1113:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF2845:
+	.string	"OSD_CRAFT_NAME"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF2080:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1159:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2259:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF940:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2729:
+	.string	"FEATURE_DASHBOARD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1655:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1350:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1944:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2552:
+	.string	"DEBUG_STACK"
+.LASF2671:
+	.string	"OWNER_INVERTER"
+.LASF1347:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2384:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2376:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF2651:
+	.string	"OWNER_SPI_MOSI"
+.LASF2035:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2238:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2571:
+	.string	"pgResetFunc"
+.LASF2879:
+	.string	"identifier"
+.LASF821:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2532:
+	.string	"uint8_t"
+.LASF1433:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhf "
+.LASF3018:
+	.string	"pidProfilesMutable"
+.LASF2859:
+	.string	"OSD_AVG_CELL_VOLTAGE"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF2841:
+	.string	"OSD_HORIZON_SIDEBARS"
+.LASF1213:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF2558:
+	.string	"DEBUG_DSHOT_RPM_TELEMETRY"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1638:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF2920:
+	.string	"gyro_soft_lpf_type"
+.LASF1251:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2087:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF873:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1467:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2894:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1450:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF1473:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF861:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1394:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1149:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1373:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1167:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF2785:
+	.string	"BOX3DDISABLESWITCH"
+.LASF927:
+	.string	"__DECL_SIMD_expm1l "
+.LASF2111:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1640:
+	.string	"VERY_FAST_MATH "
+.LASF1303:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2974:
+	.string	"beeperCount"
+.LASF2514:
+	.string	"UART8_TX_PIN NONE"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1524:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2294:
+	.string	"WS2811_CARRIER_HZ 800000"
+.LASF1809:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF1812:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1570:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1764:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1630:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1354:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF862:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2289:
+	.string	"WS2811_BITS_PER_LED 24"
+.LASF382:
+	.string	"unix 1"
+.LASF1319:
+	.string	"FP_INFINITE 1"
+.LASF1309:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF915:
+	.string	"__DECL_SIMD_cosh "
+.LASF796:
+	.string	"__DECL_SIMD_cosf "
+.LASF2715:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF805:
+	.string	"__DECL_SIMD_sin "
+.LASF1537:
+	.string	"LED0_PIN NONE"
+.LASF1982:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF2231:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1571:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1527:
+	.string	"_BSD_WCHAR_T_"
+.LASF1386:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1166:
+	.string	"__DECL_SIMD_erfc"
+.LASF2989:
+	.string	"validateAndFixConfig"
+.LASF2001:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1180:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF2965:
+	.string	"pgActivateProfile"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2100:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF2664:
+	.string	"OWNER_MPU_EXTI"
+.LASF2334:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1681:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF1904:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF2954:
+	.string	"configureAltitudeHold"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1171:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2633:
+	.string	"OWNER_PPMINPUT"
+.LASF2620:
+	.string	"ioTag_t"
+.LASF2821:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF1877:
+	.string	"IOCFG_IPD 0"
+.LASF1510:
+	.string	"__need_ptrdiff_t"
+.LASF848:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2509:
+	.string	"UART6_RX_PIN NONE"
+.LASF2601:
+	.string	"levelAngleLimit"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1205:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1453:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2303:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1608:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2251:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1252:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1265:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1720:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF2683:
+	.string	"PWM_TYPE_STANDARD"
+.LASF2194:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF2815:
+	.string	"INPUT_RC_THROTTLE"
+.LASF1116:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1122:
+	.string	"__DECL_SIMD_sinh"
+.LASF2037:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1827:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF1680:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF801:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF2191:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1191:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1437:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF833:
+	.string	"__DECL_SIMD_logf64x "
+.LASF2391:
+	.string	"LON 1"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF2454:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF2131:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF2220:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1848:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1745:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1254:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1999:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1710:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1598:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF2410:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF1296:
+	.string	"_Marg_ _Float64x"
+.LASF1664:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1577:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1514:
+	.string	"_T_WCHAR_ "
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1715:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF2960:
+	.string	"useRcControlsConfig"
+.LASF2325:
+	.string	"AIRMODEDEADBAND 12"
+.LASF2949:
+	.string	"lrintf"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1973:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF2465:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2079:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF2692:
+	.string	"motorPwmInversion"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF2137:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2019:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF928:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1215:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF2412:
+	.string	"LED_POS_BITCNT 8"
+.LASF1439:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1997:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2367:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF2787:
+	.string	"BOXBLACKBOXERASE"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF1970:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2187:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1092:
+	.string	"__DECL_SIMD_acosf"
+.LASF2991:
+	.string	"resetConfigs"
+.LASF1567:
+	.string	"LED_STRIP"
+.LASF2168:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2480:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1133:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1873:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1179:
+	.string	"__f128(x) x ##f128"
+.LASF3003:
+	.string	"accelerometerConfigMutable"
+.LASF1256:
+	.string	"_Mdouble_ long double"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1975:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF2213:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1969:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2743:
+	.string	"activeRateProfile"
+.LASF2542:
+	.string	"DEBUG_MIXER"
+.LASF1370:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1953:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1075:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2044:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1563:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1656:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2732:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF2333:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF2374:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2955:
+	.string	"imuConfigure"
+.LASF2399:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF1621:
+	.string	"BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64"
+.LASF2936:
+	.string	"pgResetTemplate_systemConfig"
+.LASF2309:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF890:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2030:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2813:
+	.string	"INPUT_RC_PITCH"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1474:
+	.string	"TELEMETRY_FRSKY "
+.LASF1908:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1491:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1056:
+	.string	"__DECL_SIMD_tanf "
+.LASF2155:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1774:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1616:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1318:
+	.string	"FP_NAN 0"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2646:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2575:
+	.string	"address"
+.LASF1663:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1651:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1378:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF1405:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF2066:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2153:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF2060:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2697:
+	.string	"serialPinConfig_s"
+.LASF2700:
+	.string	"serialPinConfig_t"
+.LASF1331:
+	.string	"math_errhandling 0"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1562:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1292:
+	.string	"_Marg_ _Float32x"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1785:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF2835:
+	.string	"modeColors"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2417:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF1956:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1878:
+	.string	"IOCFG_IPU 0"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF2757:
+	.string	"BOXARM"
+.LASF2840:
+	.string	"OSD_ARTIFICIAL_HORIZON"
+.LASF1239:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1673:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1989:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF2099:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2809:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF1677:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF3010:
+	.string	"motorConfig"
+.LASF957:
+	.string	"__DECL_SIMD_atan2l "
+.LASF2735:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF2712:
+	.string	"v_offset"
+.LASF2227:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2898:
+	.string	"pitch"
+.LASF1203:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1731:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF2648:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2419:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1511:
+	.string	"__wchar_t__ "
+.LASF2934:
+	.string	"pgResetTemplate_featureConfig"
+.LASF1216:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1218:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1348:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF499:
+	.string	"__PMT"
+.LASF2882:
+	.string	"blackbox_baudrateIndex"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF2608:
+	.string	"rateAccelLimit"
+.LASF1584:
+	.string	"USE_SERVOS"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2502:
+	.string	"UART2_TX_PIN NONE"
+.LASF2589:
+	.string	"pidProfile_s"
+.LASF2609:
+	.string	"pidProfile_t"
+.LASF2054:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1795:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2956:
+	.string	"setAccelerationFilter"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1734:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF2516:
+	.string	"SECOND_PORT_INDEX 1"
+.LASF2015:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1456:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1749:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1343:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF976:
+	.string	"__DECL_SIMD_log2f "
+.LASF2754:
+	.string	"throttle_correction_value"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1391:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF2116:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2842:
+	.string	"OSD_ONTIME"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1401:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF1025:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2332:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1246:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1465:
+	.string	"USE_SERIALRX_IBUS "
+.LASF2795:
+	.string	"modeId"
+.LASF1983:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1505:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF2569:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF2397:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1321:
+	.string	"FP_SUBNORMAL 3"
+.LASF2420:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1177:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2199:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1692:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF2247:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1981:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2758:
+	.string	"BOXANGLE"
+.LASF2858:
+	.string	"OSD_MAIN_BATT_WARNING"
+.LASF1533:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1685:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1569:
+	.string	"TELEMETRY_HOTT"
+.LASF1400:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF866:
+	.string	"__DECL_SIMD_atanf "
+.LASF1336:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2486:
+	.string	"RC_CHANNEL_RTH RC_SPI_AUX6"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2025:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1635:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF2371:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1513:
+	.string	"_WCHAR_T "
+.LASF2539:
+	.string	"DEBUG_BATTERY"
+.LASF2846:
+	.string	"OSD_THROTTLE_POS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2687:
+	.string	"PWM_TYPE_BRUSHED"
+.LASF1612:
+	.string	"UNIT_TESTED "
+.LASF2439:
+	.string	"LF(name) LED_FUNCTION_ ## name"
+.LASF2695:
+	.string	"ioTags"
+.LASF1874:
+	.string	"IOCFG_OUT_OD 0"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2102:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2438:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2136:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1594:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF874:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF2738:
+	.string	"FEATURE_SOFTSPI"
+.LASF2041:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1080:
+	.string	"__DECL_SIMD_logf"
+.LASF1836:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2450:
+	.string	"VTX_CHANNEL_MIN 1"
+.LASF2306:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF1093:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF2063:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1675:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF2851:
+	.string	"OSD_GPS_SATS"
+.LASF919:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF2115:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF3022:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF2339:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1193:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1686:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF2278:
+	.string	"LED_NUMBER 3"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1660:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF2992:
+	.string	"getCurrentMinthrottle"
+.LASF1452:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF2901:
+	.string	"flightDynamicsTrims_t"
+.LASF2904:
+	.string	"flightDynamicsTrims_u"
+.LASF1948:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1264:
+	.string	"_Mdouble_ _Float128"
+.LASF1065:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF1976:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1374:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF1212:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF2144:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2598:
+	.string	"dterm_average_count"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1419:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF2680:
+	.string	"polarity"
+.LASF1422:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF2941:
+	.string	"writeConfigToEEPROM"
+.LASF2937:
+	.string	"systemConfig_Registry"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2746:
+	.string	"name"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1136:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2223:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2295:
+	.string	"WHITEBRIGHTNESS 0x01"
+.LASF1756:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF2493:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF2530:
+	.string	"int8_t"
+.LASF2046:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2124:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1726:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF2398:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2156:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2253:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1438:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF1920:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1353:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF2414:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF2599:
+	.string	"vbatPidCompensation"
+.LASF1949:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF987:
+	.string	"__DECL_SIMD_log1pl "
+.LASF869:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2950:
+	.string	"isSerialConfigValid"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2802:
+	.string	"minthrottle"
+.LASF3004:
+	.string	"accelerometerConfig"
+.LASF914:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1926:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF819:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF992:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1951:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1313:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1417:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF1266:
+	.string	"_Mdouble_ _Float32x"
+.LASF1626:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF2413:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF2774:
+	.string	"BOXGOV"
+.LASF936:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1221:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2263:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF881:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1927:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF849:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF980:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2429:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF1566:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF865:
+	.string	"__DECL_SIMD_atan "
+.LASF2365:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1846:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1819:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1593:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF2101:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1272:
+	.string	"__MATHDECL_ALIAS"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1295:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1481:
+	.string	"CMS "
+.LASF2576:
+	.string	"reset"
+.LASF1130:
+	.string	"__DECL_SIMD_atan2"
+.LASF1885:
+	.string	"STR_HELPER(x) #x"
+.LASF2753:
+	.string	"throttle_correction_angle"
+.LASF2843:
+	.string	"OSD_FLYTIME"
+.LASF1693:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF2034:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF888:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF2012:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF2984:
+	.string	"samplingTime"
+.LASF1281:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1404:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF882:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2654:
+	.string	"OWNER_SDCARD"
+.LASF2916:
+	.string	"gyro_align"
+.LASF1286:
+	.string	"__MATHCALL_NAME"
+.LASF1089:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF985:
+	.string	"__DECL_SIMD_log1p "
+.LASF1332:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF2810:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF2170:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF2816:
+	.string	"INPUT_RC_AUX1"
+.LASF2817:
+	.string	"INPUT_RC_AUX2"
+.LASF2803:
+	.string	"maxthrottle"
+.LASF2819:
+	.string	"INPUT_RC_AUX4"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1330:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1733:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1859:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1617:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF785:
+	.string	"NULL"
+.LASF2531:
+	.string	"int16_t"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF2839:
+	.string	"OSD_CROSSHAIRS"
+.LASF1623:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1384:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF2518:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1602:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2064:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1045:
+	.string	"__DECL_SIMD_erfc "
+.LASF2521:
+	.string	"signed char"
+.LASF1194:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1654:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF813:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2004:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2537:
+	.string	"DEBUG_NONE"
+.LASF2185:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1487:
+	.string	"USE_DASHBOARD "
+.LASF2794:
+	.string	"modeActivationCondition_s"
+.LASF2798:
+	.string	"modeActivationCondition_t"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1316:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1478:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1535:
+	.string	"U_ID_1 1"
+.LASF1960:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF934:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1209:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1164:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1555:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1521:
+	.string	"_WCHAR_T_H "
+.LASF2077:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1701:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF2347:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF2911:
+	.string	"accZero"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF2727:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1619:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1636:
+	.string	"sq(x) ((x)*(x))"
+.LASF809:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1289:
+	.string	"_Mret_ double"
+.LASF2513:
+	.string	"UART8_RX_PIN NONE"
+.LASF2421:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF1111:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1894:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1998:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2162:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2081:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2352:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF2003:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1095:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1196:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF3015:
+	.string	"pidConfigMutable"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1219:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF2279:
+	.string	"LED0_TOGGLE do {} while(0)"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1411:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF1476:
+	.string	"TELEMETRY_LTM "
+.LASF2256:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2922:
+	.string	"gyro_isr_update"
+.LASF1446:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF2461:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1913:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF2764:
+	.string	"BOXCAMSTAB"
+.LASF2475:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2744:
+	.string	"debug_mode"
+.LASF977:
+	.string	"__DECL_SIMD_log2l "
+.LASF1833:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF2319:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1138:
+	.string	"__DECL_SIMD_log2"
+.LASF2331:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1965:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1709:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1078:
+	.string	"__DECL_SIMD_log"
+.LASF1821:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2873:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2874:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF396:
+	.string	"__REVISION__ \"669c324\""
+.LASF2159:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2676:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2784:
+	.string	"BOXAIRMODE"
+.LASF2907:
+	.string	"accelerometerConfig_s"
+.LASF2913:
+	.string	"accelerometerConfig_t"
+.LASF1597:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1713:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1258:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1993:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF2424:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF2990:
+	.string	"activateConfig"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2979:
+	.string	"ensureEEPROMContainsValidData"
+.LASF2612:
+	.string	"pid_in_gyro_isr"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2930:
+	.string	"gyro_dyn_notch_q"
+.LASF1471:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF2401:
+	.string	"LED_MODE_COUNT 6"
+.LASF1499:
+	.string	"_ANSI_STDDEF_H "
+.LASF2890:
+	.string	"serialConfig_System"
+.LASF2997:
+	.string	"pgResetFn_serialPinConfig"
+.LASF1763:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2669:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1396:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF870:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1937:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2171:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2254:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2567:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF831:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2804:
+	.string	"mincommand"
+.LASF2172:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1718:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF2844:
+	.string	"OSD_FLYMODE"
+.LASF1825:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1802:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1751:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2762:
+	.string	"BOXHEADFREE"
+.LASF2927:
+	.string	"gyro_soft_notch_hz_2"
+.LASF2708:
+	.string	"failureMode_e"
+.LASF1346:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1922:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2358:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1211:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1587:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF846:
+	.string	"__DECL_SIMD_powf "
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF843:
+	.string	"__DECL_SIMD_expf64x "
+.LASF1996:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1902:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF822:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF942:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF981:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF1631:
+	.string	"HSV_HUE_MAX 359"
+.LASF825:
+	.string	"__DECL_SIMD_log "
+.LASF1195:
+	.string	"__f32(x) x ##f32"
+.LASF2328:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1684:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1628:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1657:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2604:
+	.string	"itermAcceleratorGain"
+.LASF1175:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1320:
+	.string	"FP_ZERO 2"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1876:
+	.string	"IOCFG_AF_OD 0"
+.LASF2197:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2057:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF839:
+	.string	"__DECL_SIMD_expf32 "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1945:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF838:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2348:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1928:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF2086:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2872:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1838:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF2209:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF2128:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2730:
+	.string	"FEATURE_OSD"
+.LASF2490:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1738:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF982:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1480:
+	.string	"GPS "
+.LASF2491:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1119:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF2114:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1696:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF2113:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2864:
+	.string	"SERIAL_PORT_USART1"
+.LASF2865:
+	.string	"SERIAL_PORT_USART2"
+.LASF2866:
+	.string	"SERIAL_PORT_USART3"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1139:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF2869:
+	.string	"SERIAL_PORT_USART6"
+.LASF2870:
+	.string	"SERIAL_PORT_USART7"
+.LASF2871:
+	.string	"SERIAL_PORT_USART8"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2284:
+	.string	"LED1_ON do {} while(0)"
+.LASF1233:
+	.string	"FP_INT_TONEAREST 4"
+.LASF1909:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1712:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF908:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1380:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF2528:
+	.string	"long int"
+.LASF2336:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF829:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1705:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1072:
+	.string	"__DECL_SIMD_sinf"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1683:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF978:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF814:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2148:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF2083:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF2425:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF1648:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1866:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2644:
+	.string	"OWNER_PINDEBUG"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF916:
+	.string	"__DECL_SIMD_coshf "
+.LASF2243:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2617:
+	.string	"enabledFeatures"
+.LASF2366:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF2483:
+	.string	"RC_CHANNEL_PICTURE RC_SPI_AUX3"
+.LASF2775:
+	.string	"BOXOSD"
+.LASF2356:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF2909:
+	.string	"acc_align"
+.LASF1135:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1482:
+	.string	"TELEMETRY_CRSF "
+.LASF2551:
+	.string	"DEBUG_SCHEDULER"
+.LASF1504:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1889:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2783:
+	.string	"BOXFAILSAFE"
+.LASF2140:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1503:
+	.string	"__PTRDIFF_T "
+.LASF2396:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF1495:
+	.string	"VTX_SMARTAUDIO "
+.LASF1955:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF820:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2076:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2002:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1240:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1540:
+	.string	"ACC "
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2777:
+	.string	"BOXGTUNE"
+.LASF1583:
+	.string	"USE_RESOURCE_MGMT"
+.LASF2203:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2501:
+	.string	"UART2_RX_PIN NONE"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2402:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF2431:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF945:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2684:
+	.string	"PWM_TYPE_ONESHOT125"
+.LASF1887:
+	.string	"EXPAND_I(x) x"
+.LASF2052:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2219:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2896:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF2463:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1959:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1864:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF2910:
+	.string	"acc_hardware"
+.LASF860:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF967:
+	.string	"__DECL_SIMD_log10l "
+.LASF2825:
+	.string	"preferred_beeper_off_flags"
+.LASF2091:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2534:
+	.string	"uint32_t"
+.LASF1857:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF2861:
+	.string	"OSD_GPS_LAT"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1300:
+	.string	"_Mret_ _Float32x"
+.LASF2849:
+	.string	"OSD_MAH_DRAWN"
+.LASF877:
+	.string	"__DECL_SIMD_asinl "
+.LASF1891:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1534:
+	.string	"U_ID_0 0"
+.LASF1147:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1157:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF1954:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1199:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1349:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2181:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF975:
+	.string	"__DECL_SIMD_log2 "
+.LASF2998:
+	.string	"serialPinConfig"
+.LASF1974:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2742:
+	.string	"pidProfileIndex"
+.LASF1222:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1529:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2443:
+	.string	"VISIBLE_FLAG 0x0800"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF963:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2226:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF994:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1911:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF1435:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF2638:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2767:
+	.string	"BOXGPSHOLD"
+.LASF1200:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1004:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1903:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1917:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1641:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1748:
+	.string	"PG_PID_CONFIG 504"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2346:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF2701:
+	.string	"FAILURE_DEVELOPER"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1202:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF2782:
+	.string	"BOXBLACKBOX"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF2850:
+	.string	"OSD_GPS_SPEED"
+.LASF2520:
+	.string	"long unsigned int"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1345:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2763:
+	.string	"BOXHEADADJ"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF2925:
+	.string	"gyro_soft_notch_hz_1"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1728:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1672:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1091:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF2981:
+	.string	"writeEEPROM"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1430:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1992:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF988:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1601:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF2264:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2915:
+	.string	"gyroConfig_s"
+.LASF2932:
+	.string	"gyroConfig_t"
+.LASF1399:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF969:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF2766:
+	.string	"BOXGPSHOME"
+.LASF2597:
+	.string	"pidSumLimitYaw"
+.LASF2645:
+	.string	"OWNER_TIMER"
+.LASF1780:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1729:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF2694:
+	.string	"useDshotTelemetry"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2222:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1978:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2175:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2515:
+	.string	"FIRST_PORT_INDEX 0"
+.LASF2606:
+	.string	"dtermSetpointWeight"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF2151:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"USE_FAKE_MAG "
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1919:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1088:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF2836:
+	.string	"specialColors"
+.LASF2434:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF1582:
+	.string	"BLACKBOX"
+.LASF2529:
+	.string	"char"
+.LASF1278:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1835:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF2582:
+	.string	"PIDPOS"
+.LASF971:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2048:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2134:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1585:
+	.string	"USE_DSHOT"
+.LASF2405:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1526:
+	.string	"__DEFINED_wchar_t "
+.LASF1188:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1985:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1427:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF2132:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2857:
+	.string	"OSD_PIDRATE_PROFILE"
+.LASF968:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2286:
+	.string	"LED2_OFF do {} while(0)"
+.LASF2572:
+	.string	"hsvColor_s"
+.LASF2564:
+	.string	"hsvColor_t"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1560:
+	.string	"USE_SERIALRX_IBUS"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF885:
+	.string	"__DECL_SIMD_hypot "
+.LASF1223:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2914:
+	.string	"accelerometerConfig_System"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2770:
+	.string	"BOXLEDMAX"
+.LASF1445:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF841:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1306:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2685:
+	.string	"PWM_TYPE_ONESHOT42"
+.LASF906:
+	.string	"__DECL_SIMD_exp10f "
+.LASF800:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF972:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF864:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1784:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF2173:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1767:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2863:
+	.string	"SERIAL_PORT_NONE"
+.LASF2320:
+	.string	"BEEP_ON do {} while(0)"
+.LASF2602:
+	.string	"levelSensitivity"
+.LASF2657:
+	.string	"OWNER_FLASH_CS"
+.LASF2120:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1228:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF1565:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1490:
+	.string	"USE_RX_MSP "
+.LASF1883:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2094:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF1575:
+	.string	"TELEMETRY_IBUS"
+.LASF401:
+	.string	"true 1"
+.LASF2829:
+	.string	"color"
+.LASF802:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2404:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF2382:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF2343:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2452:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF2282:
+	.string	"LED1_TOGGLE do {} while(0)"
+.LASF1645:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF856:
+	.string	"__DECL_SIMD_acosf "
+.LASF2281:
+	.string	"LED0_ON do {} while(0)"
+.LASF2760:
+	.string	"BOXBARO"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF2474:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2988:
+	.string	"maxEscRate"
+.LASF2488:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF842:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2544:
+	.string	"DEBUG_PIDLOOP"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1104:
+	.string	"__DECL_SIMD_hypotf"
+.LASF2555:
+	.string	"DEBUG_FFT"
+.LASF797:
+	.string	"__DECL_SIMD_cosl "
+.LASF2464:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1792:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2292:
+	.string	"WS2811_DMA_BUFFER_SIZE (WS2811_DATA_BUFFER_SIZE + WS2811_DELAY_BUFFER_LENGTH)"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1183:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF998:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF944:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1115:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1455:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1558:
+	.string	"SERIAL_RX"
+.LASF1801:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1235:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1607:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1618:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1121:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1721:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF880:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2097:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2628:
+	.string	"CW180_DEG_FLIP"
+.LASF2276:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF2748:
+	.string	"systemConfig_System"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1588:
+	.string	"USE_PROFILE "
+.LASF1568:
+	.string	"TELEMETRY_FRSKY"
+.LASF2428:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF2718:
+	.string	"FEATURE_SERVO_TILT"
+.LASF2962:
+	.string	"generateRcCurves"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1443:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1580:
+	.string	"VTX_SMARTAUDIO"
+.LASF1466:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2649:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2013:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1610:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1137:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2724:
+	.string	"FEATURE_3D"
+.LASF2966:
+	.string	"pgResetAll"
+.LASF1561:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1226:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1105:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF810:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF818:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1284:
+	.string	"_Mret_"
+.LASF2359:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2808:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF2029:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2449:
+	.string	"VTX_BAND_MAX 5"
+.LASF1528:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1900:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1502:
+	.string	"_T_PTRDIFF "
+.LASF2847:
+	.string	"OSD_VTX_CHANNEL"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1062:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1097:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1005:
+	.string	"__DECL_SIMD_acosh "
+.LASF2487:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1169:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF2814:
+	.string	"INPUT_RC_YAW"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF2477:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1429:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1541:
+	.string	"USE_FAKE_ACC "
+.LASF2208:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2822:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF1367:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF1984:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1315:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1750:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2503:
+	.string	"UART3_RX_PIN NONE"
+.LASF2154:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1447:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF2752:
+	.string	"throttleCorrectionConfig_s"
+.LASF2755:
+	.string	"throttleCorrectionConfig_t"
+.LASF2351:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 15"
+.LASF2867:
+	.string	"SERIAL_PORT_UART4"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2868:
+	.string	"SERIAL_PORT_UART5"
+.LASF2117:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2756:
+	.string	"throttleCorrectionConfig_System"
+.LASF2466:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF2548:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2249:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF918:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1015:
+	.string	"__DECL_SIMD_erf "
+.LASF1342:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF2445:
+	.string	"OSD_POS_MAX 0x3FF"
+.LASF1107:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2069:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2623:
+	.string	"CW90_DEG"
+.LASF2177:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2877:
+	.string	"serialPortConfig_s"
+.LASF2884:
+	.string	"serialPortConfig_t"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1829:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2852:
+	.string	"OSD_ALTITUDE"
+.LASF2456:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF2630:
+	.string	"sensor_align_e"
+.LASF2195:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2500:
+	.string	"UART1_TX_PIN NONE"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1152:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1355:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF2110:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2271:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2903:
+	.string	"rollAndPitchTrims_t_def"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1131:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2360:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2178:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2301:
+	.string	"VIDEO_LINES_PAL 16"
+.LASF1703:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2068:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1991:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1079:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2543:
+	.string	"DEBUG_AIRMODE"
+.LASF2967:
+	.string	"getPreferredBeeperOffMask"
+.LASF1077:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1424:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1230:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF855:
+	.string	"__DECL_SIMD_acos "
+.LASF2776:
+	.string	"BOXTELEMETRY"
+.LASF1217:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF2385:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2330:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1852:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2340:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1662:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF832:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1739:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1666:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1895:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2427:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF2089:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2538:
+	.string	"DEBUG_CYCLETIME"
+.LASF2553:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF1340:
+	.string	"M_E 2.7182818284590452354"
+.LASF1458:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1204:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1454:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1444:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1667:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF2616:
+	.string	"featureConfig_s"
+.LASF2618:
+	.string	"featureConfig_t"
+.LASF1468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2973:
+	.string	"beeperOffSetAll"
+.LASF2165:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2536:
+	.string	"double"
+.LASF2287:
+	.string	"LED2_ON do {} while(0)"
+.LASF2923:
+	.string	"gyro_use_32khz"
+.LASF2021:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1798:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF858:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1761:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF2246:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2364:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1818:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF955:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2948:
+	.string	"pgResetFn_serialConfig"
+.LASF2373:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1397:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF2652:
+	.string	"OWNER_I2C_SCL"
+.LASF2650:
+	.string	"OWNER_SPI_MISO"
+.LASF1150:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2675:
+	.string	"OWNER_COMPASS_CS"
+.LASF1517:
+	.string	"_WCHAR_T_ "
+.LASF2363:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1085:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1828:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF2285:
+	.string	"LED2_TOGGLE do {} while(0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2791:
+	.string	"startStep"
+.LASF1670:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2740:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF1689:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2726:
+	.string	"FEATURE_RX_MSP"
+.LASF1757:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2593:
+	.string	"dterm_notch_hz"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF2042:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1518:
+	.string	"_BSD_WCHAR_T_ "
+.LASF903:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2049:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2092:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2720:
+	.string	"FEATURE_GPS"
+.LASF2595:
+	.string	"itermWindupPointPercent"
+.LASF1497:
+	.string	"_STDDEF_H "
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1783:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1477:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2032:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF2678:
+	.string	"statusLedConfig_s"
+.LASF2681:
+	.string	"statusLedConfig_t"
+.LASF2217:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2788:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1797:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1224:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2653:
+	.string	"OWNER_I2C_SDA"
+.LASF2479:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2527:
+	.string	"__uint32_t"
+.LASF2935:
+	.string	"featureConfig_Registry"
+.LASF2837:
+	.string	"OSD_RSSI_VALUE"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2951:
+	.string	"featureClear"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1758:
+	.string	"PG_VCD_CONFIG 514"
+.LASF2112:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF1804:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF2311:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2728:
+	.string	"FEATURE_LED_STRIP"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1706:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1650:
+	.string	"Q12 (1 << 12)"
+.LASF2921:
+	.string	"gyro_soft_lpf_hz"
+.LASF2375:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1442:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1624:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF1460:
+	.string	"USE_CLI "
+.LASF2090:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1214:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF1156:
+	.string	"__DECL_SIMD_erff"
+.LASF1530:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1968:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1837:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2221:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2489:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF2658:
+	.string	"OWNER_FLASH"
+.LASF857:
+	.string	"__DECL_SIMD_acosl "
+.LASF2416:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF1293:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1735:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF1083:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2875:
+	.string	"serialPortIdentifier_e"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1935:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1578:
+	.string	"VTX_COMMON"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1109:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF1035:
+	.string	"__DECL_SIMD_asinh "
+.LASF2834:
+	.string	"colors"
+.LASF2745:
+	.string	"task_statistics"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1153:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1241:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2880:
+	.string	"msp_baudrateIndex"
+.LASF2476:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1243:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1515:
+	.string	"_T_WCHAR "
+.LASF2188:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF852:
+	.string	"__DECL_SIMD_powf32x "
+.LASF782:
+	.string	"_SIZET_ "
+.LASF2258:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF2169:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF2472:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF2963:
+	.string	"pidInit"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2011:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1376:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF2036:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1432:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF1907:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2436:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF875:
+	.string	"__DECL_SIMD_asin "
+.LASF2274:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1943:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF2198:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2028:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF2497:
+	.string	"DEFAULT_FEATURES 0"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1274:
+	.string	"__MATHCALL"
+.LASF3009:
+	.string	"motorConfigMutable"
+.LASF1881:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2152:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2693:
+	.string	"useUnsyncedPwm"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1576:
+	.string	"USE_DASHBOARD"
+.LASF917:
+	.string	"__DECL_SIMD_coshl "
+.LASF1987:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2887:
+	.string	"serial_update_rate_hz"
+.LASF2237:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2061:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1338:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1448:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2885:
+	.string	"serialConfig_s"
+.LASF2670:
+	.string	"OWNER_RX_BIND"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1022:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1494:
+	.string	"VTX_CONTROL "
+.LASF995:
+	.string	"__DECL_SIMD_atanh "
+.LASF808:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2163:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2673:
+	.string	"OWNER_TRANSPONDER"
+.LASF2945:
+	.string	"isEEPROMContentValid"
+.LASF1225:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2615:
+	.string	"pidConfig_System"
+.LASF1823:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1856:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF907:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2149:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF3019:
+	.string	"setPidProfile"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF984:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2014:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2605:
+	.string	"setpointRelaxRatio"
+.LASF1642:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2218:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2005:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1415:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1173:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1100:
+	.string	"__DECL_SIMD_asinf"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1162:
+	.string	"__DECL_SIMD_asinh"
+.LASF2135:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2323:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF2471:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2786:
+	.string	"BOXFPVANGLEMIX"
+.LASF1986:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2441:
+	.string	"LD(name) LED_FLAG_DIRECTION(LED_DIRECTION_ ## name)"
+.LASF924:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2073:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF886:
+	.string	"__DECL_SIMD_hypotf "
+.LASF2862:
+	.string	"OSD_ITEM_COUNT"
+.LASF2017:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2324:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF2370:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF871:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1297:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2270:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1324:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1268:
+	.string	"_Mdouble_ _Float64x"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1360:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1023:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1148:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF2280:
+	.string	"LED0_OFF do {} while(0)"
+.LASF964:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF2917:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF2314:
+	.string	"SONAR_GPIO GPIOB"
+.LASF1796:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF850:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1678:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1363:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF1151:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2660:
+	.string	"OWNER_MPU_CS"
+.LASF2565:
+	.string	"pgn_t"
+.LASF1753:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2145:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1688:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1564:
+	.string	"USE_SERIALRX_SUMH"
+.LASF2455:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1299:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF1732:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1781:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF872:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2357:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1782:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2277:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF2546:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1544:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF896:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF812:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1768:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1112:
+	.string	"__DECL_SIMD_exp10f"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2510:
+	.string	"UART6_TX_PIN NONE"
+.LASF2902:
+	.string	"rollAndPitchTrims_s"
+.LASF2906:
+	.string	"rollAndPitchTrims_t"
+.LASF2905:
+	.string	"rollAndPitchTrims_u"
+.LASF1174:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1552:
+	.string	"USE_UART7 "
+.LASF1888:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2600:
+	.string	"pidAtMinThrottle"
+.LASF2224:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF2931:
+	.string	"gyro_dyn_notch_min_hz"
+.LASF2485:
+	.string	"RC_CHANNEL_HEADLESS RC_SPI_AUX5"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1916:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1595:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1259:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2918:
+	.string	"gyro_sync_denom"
+.LASF1925:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1690:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2200:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF2062:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF986:
+	.string	"__DECL_SIMD_log1pf "
+.LASF522:
+	.string	"__flexarr []"
+.LASF2166:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1369:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1071:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1589:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF2494:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF2994:
+	.string	"getCurrentPidProfileIndex"
+.LASF1897:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2796:
+	.string	"auxChannelIndex"
+.LASF923:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF930:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2470:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF2150:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1375:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF1615:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1746:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1034:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2631:
+	.string	"OWNER_FREE"
+.LASF2860:
+	.string	"OSD_GPS_LON"
+.LASF905:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1604:
+	.string	"EEPROM_SIZE 32768"
+.LASF1185:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1817:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2707:
+	.string	"FAILURE_GYRO_INIT_FAILED"
+.LASF2590:
+	.string	"dterm_filter_type"
+.LASF893:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1451:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF2799:
+	.string	"modeActivationConditions_SystemArray"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2710:
+	.string	"video_system"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF2550:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1939:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF2561:
+	.string	"RGB_RED"
+.LASF1629:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF2201:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2008:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF1058:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1789:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1924:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1436:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF2976:
+	.string	"changePidProfile"
+.LASF1958:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1765:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2632:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1192:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1074:
+	.string	"__DECL_SIMD_sincos"
+.LASF1861:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1076:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1771:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF2614:
+	.string	"pidProfiles_SystemArray"
+.LASF2495:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF2122:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF2074:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF853:
+	.string	"__DECL_SIMD_powf64x "
+.LASF803:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2338:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1800:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF1611:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1590:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF3013:
+	.string	"systemConfigMutable"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF867:
+	.string	"__DECL_SIMD_atanl "
+.LASF1553:
+	.string	"USE_UART8 "
+.LASF2378:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_FLAPS"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2395:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1294:
+	.string	"_Marg_ _Float64"
+.LASF1046:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1840:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1282:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1506:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF965:
+	.string	"__DECL_SIMD_log10 "
+.LASF1778:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF911:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF2446:
+	.string	"OSD_POSCFG_MAX (VISIBLE_FLAG|0x3FF)"
+.LASF1021:
+	.string	"__DECL_SIMD_erff128 "
+.LASF904:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2484:
+	.string	"RC_CHANNEL_VIDEO RC_SPI_AUX4"
+.LASF2938:
+	.string	"statusLedConfig_Registry"
+.LASF2235:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF938:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2969:
+	.string	"setBeeperOffMask"
+.LASF2929:
+	.string	"gyro_dyn_notch"
+.LASF2139:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2262:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF859:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1356:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1361:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1302:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1410:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF2492:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1123:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF2335:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF847:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2018:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1287:
+	.string	"_Marg_ long double"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF2999:
+	.string	"port"
+.LASF824:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1385:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF2541:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2854:
+	.string	"OSD_PITCH_PIDS"
+.LASF1523:
+	.string	"__INT_WCHAR_T_H "
+.LASF1952:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF2467:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF2946:
+	.string	"loadEEPROM"
+.LASF1694:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2655:
+	.string	"OWNER_SDCARD_CS"
+.LASF1591:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1262:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1841:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF2980:
+	.string	"resetEEPROM"
+.LASF2705:
+	.string	"FAILURE_INVALID_EEPROM_CONTENTS"
+.LASF2554:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF2098:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1377:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1613:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1957:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1649:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF3017:
+	.string	"modeActivationConditions"
+.LASF2848:
+	.string	"OSD_CURRENT_DRAW"
+.LASF2167:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2386:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF1269:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1923:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1906:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1559:
+	.string	"USE_SERIALRX_CRSF"
+.LASF926:
+	.string	"__DECL_SIMD_expm1f "
+.LASF2689:
+	.string	"motorDevConfig_s"
+.LASF2696:
+	.string	"motorDevConfig_t"
+.LASF1546:
+	.string	"USE_UART1 "
+.LASF2926:
+	.string	"gyro_soft_notch_cutoff_1"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2928:
+	.string	"gyro_soft_notch_cutoff_2"
+.LASF1844:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF2244:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF3007:
+	.string	"beeperConfigMutable"
+.LASF1816:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF2130:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2190:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2039:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF2584:
+	.string	"PIDNAVR"
+.LASF1808:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1995:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2750:
+	.string	"serialPinConfig_System"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF1016:
+	.string	"__DECL_SIMD_erff "
+.LASF1416:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1822:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1327:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2459:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1290:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF1754:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1352:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2283:
+	.string	"LED1_OFF do {} while(0)"
+.LASF2972:
+	.string	"beeperOffClear"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2388:
+	.string	"MAX_SERVO_BOXES 3"
+.LASF2711:
+	.string	"h_offset"
+.LASF1403:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2026:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1554:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF798:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF2394:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2838:
+	.string	"OSD_MAIN_BATT_VOLTAGE"
+.LASF1463:
+	.string	"SERIAL_RX "
+.LASF1899:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2672:
+	.string	"OWNER_LED_STRIP"
+.LASF2158:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1547:
+	.string	"USE_UART2 "
+.LASF1493:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1496:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF2031:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF2468:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1605:
+	.string	"__disable_irq() "
+.LASF2588:
+	.string	"PID_ITEM_COUNT"
+.LASF1154:
+	.string	"__DECL_SIMD_erf"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF806:
+	.string	"__DECL_SIMD_sinf "
+.LASF1326:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1407:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1579:
+	.string	"VTX_CONTROL"
+.LASF1440:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2107:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF2266:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1787:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF1024:
+	.string	"__DECL_SIMD_erff128x "
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF2895:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2174:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1486:
+	.string	"TELEMETRY_SRXL "
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2093:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1359:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF1698:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1413:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2460:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1098:
+	.string	"__DECL_SIMD_asin"
+.LASF1725:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1815:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF2607:
+	.string	"yawRateAccelLimit"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2380:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF2071:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1929:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF897:
+	.string	"__DECL_SIMD_exp2l "
+.LASF834:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1362:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1548:
+	.string	"USE_UART3 "
+.LASF1242:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1842:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF2146:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1736:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1845:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF2451:
+	.string	"VTX_CHANNEL_MAX 8"
+.LASF2522:
+	.string	"__int8_t"
+.LASF1516:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1357:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF2592:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1132:
+	.string	"__DECL_SIMD_atan2f"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF2505:
+	.string	"UART4_RX_PIN NONE"
+.LASF1086:
+	.string	"__DECL_SIMD_pow"
+.LASF2883:
+	.string	"telemetry_baudrateIndex"
+.LASF2457:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1850:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1855:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF2381:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2659:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2985:
+	.string	"pidLooptime"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1737:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF2812:
+	.string	"INPUT_RC_ROLL"
+.LASF2982:
+	.string	"readEEPROM"
+.LASF1744:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1988:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1893:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1632:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF2418:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF1055:
+	.string	"__DECL_SIMD_tan "
+.LASF1606:
+	.string	"__enable_irq() "
+.LASF2433:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF2519:
+	.string	"unsigned int"
+.LASF2891:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1549:
+	.string	"USE_UART4 "
+.LASF1697:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF889:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2403:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF1054:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2078:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1236:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2933:
+	.string	"gyroConfig_System"
+.LASF1574:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1901:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2435:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF1186:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1882:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2995:
+	.string	"pgResetFn_statusLedConfig"
+.LASF1849:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF956:
+	.string	"__DECL_SIMD_atan2f "
+.LASF815:
+	.string	"__DECL_SIMD_sincos "
+.LASF1676:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2432:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF2768:
+	.string	"BOXPASSTHRU"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1752:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1087:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1707:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1366:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF2637:
+	.string	"OWNER_ADC"
+.LASF2525:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2833:
+	.string	"inputSource_e"
+.LASF1081:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF958:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2009:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2603:
+	.string	"itermThrottleThreshold"
+.LASF1379:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF2765:
+	.string	"BOXCAMTRIG"
+.LASF2176:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1550:
+	.string	"USE_UART5 "
+.LASF2193:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF835:
+	.string	"__DECL_SIMD_exp "
+.LASF1120:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2731:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF1270:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1880:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF1573:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2640:
+	.string	"OWNER_ADC_EXT"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2408:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF1341:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2940:
+	.string	"vcdProfile_Registry"
+.LASF1682:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1990:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF2624:
+	.string	"CW180_DEG"
+.LASF912:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2507:
+	.string	"UART5_RX_PIN NONE"
+.LASF1182:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2661:
+	.string	"OWNER_OSD_CS"
+.LASF3020:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2234:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1668:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF3012:
+	.string	"throttleCorrectionConfig"
+.LASF2876:
+	.string	"serialPortIdentifiers"
+.LASF1708:
+	.string	"PG_RX_CONFIG 24"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF830:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1106:
+	.string	"__DECL_SIMD_exp2"
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1418:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF2512:
+	.string	"UART7_TX_PIN NONE"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2250:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1551:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF2706:
+	.string	"FAILURE_FLASH_WRITE_FAILED"
+.LASF2040:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3139:
+	.string	"rx_pwm.h"
+.LASF3056:
+	.string	"pwm_output.h"
+.LASF3104:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3042:
+	.string	"/usr/include"
+.LASF3047:
+	.string	"debug.h"
+.LASF3106:
+	.string	"floatn-common.h"
+.LASF3084:
+	.string	"stdint.h"
+.LASF3024:
+	.string	"src/main/build"
+.LASF3039:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3152:
+	.string	"barometer.h"
+.LASF3083:
+	.string	"stdbool.h"
+.LASF3145:
+	.string	"flash.h"
+.LASF3112:
+	.string	"iscanonical.h"
+.LASF3121:
+	.string	"time.h"
+.LASF3088:
+	.string	"wordsize.h"
+.LASF3048:
+	.string	"color.h"
+.LASF3147:
+	.string	"navigation.h"
+.LASF3034:
+	.string	"src/main/target/SITL"
+.LASF3074:
+	.string	"mathcalls.h"
+.LASF3149:
+	.string	"gps.h"
+.LASF3061:
+	.string	"fc_core.h"
+.LASF3143:
+	.string	"sound_beeper.h"
+.LASF3116:
+	.string	"common_post.h"
+.LASF3158:
+	.string	"boardalignment.h"
+.LASF3125:
+	.string	"parameter_group_ids.h"
+.LASF3054:
+	.string	"resource.h"
+.LASF3085:
+	.string	"libc-header-start.h"
+.LASF3077:
+	.string	"failsafe.h"
+.LASF3079:
+	.string	"fc_rc.h"
+.LASF3113:
+	.string	"platform.h"
+.LASF3043:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3157:
+	.string	"voltage_ids.h"
+.LASF3023:
+	.string	"src/main/blackbox"
+.LASF3064:
+	.string	"servos.h"
+.LASF3030:
+	.string	"src/main/flight"
+.LASF3140:
+	.string	"rx_spi.h"
+.LASF3076:
+	.string	"imu.h"
+.LASF3055:
+	.string	"light_led.h"
+.LASF3082:
+	.string	"stdc-predef.h"
+.LASF3126:
+	.string	"accgyro.h"
+.LASF3078:
+	.string	"rc_adjustments.h"
+.LASF3102:
+	.string	"math.h"
+.LASF3038:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3123:
+	.string	"filter.h"
+.LASF3110:
+	.string	"mathcalls-helper-functions.h"
+.LASF3137:
+	.string	"timer.h"
+.LASF3086:
+	.string	"features.h"
+.LASF3037:
+	.string	"src/main"
+.LASF3031:
+	.string	"src/main/io"
+.LASF3095:
+	.string	"time64.h"
+.LASF3124:
+	.string	"config_profile.h"
+.LASF3075:
+	.string	"altitudehold.h"
+.LASF3087:
+	.string	"features-time64.h"
+.LASF3101:
+	.string	"strings.h"
+.LASF3051:
+	.string	"feature.h"
+.LASF3071:
+	.string	"config.c"
+.LASF3127:
+	.string	"exti.h"
+.LASF3065:
+	.string	"beeper.h"
+.LASF3146:
+	.string	"runtime_config.h"
+.LASF3060:
+	.string	"config.h"
+.LASF3092:
+	.string	"stubs.h"
+.LASF3070:
+	.string	"gyro.h"
+.LASF3097:
+	.string	"string.h"
+.LASF3115:
+	.string	"target.h"
+.LASF3131:
+	.string	"io_def.h"
+.LASF3081:
+	.string	"maths.h"
+.LASF3029:
+	.string	"src/main/fc"
+.LASF3096:
+	.string	"wchar.h"
+.LASF3089:
+	.string	"timesize.h"
+.LASF3026:
+	.string	"src/main/common"
+.LASF3135:
+	.string	"max7456.h"
+.LASF3156:
+	.string	"voltage.h"
+.LASF3073:
+	.string	"rx.h"
+.LASF3154:
+	.string	"current.h"
+.LASF3041:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3138:
+	.string	"rcc_types.h"
+.LASF3129:
+	.string	"compass.h"
+.LASF3134:
+	.string	"light_ws2811strip.h"
+.LASF3069:
+	.string	"acceleration.h"
+.LASF3098:
+	.string	"stddef.h"
+.LASF3109:
+	.string	"fp-fast.h"
+.LASF3105:
+	.string	"floatn.h"
+.LASF3066:
+	.string	"ledstrip.h"
+.LASF3114:
+	.string	"common.h"
+.LASF3122:
+	.string	"axis.h"
+.LASF3093:
+	.string	"stubs-64.h"
+.LASF3141:
+	.string	"sdcard.h"
+.LASF3049:
+	.string	"parameter_group.h"
+.LASF3080:
+	.string	"controlrate_profile.h"
+.LASF3050:
+	.string	"pid.h"
+.LASF3120:
+	.string	"display.h"
+.LASF3155:
+	.string	"current_ids.h"
+.LASF0:
+	.string	"./src/main/fc/config.c"
+.LASF3118:
+	.string	"blackbox_io.h"
+.LASF3132:
+	.string	"utils.h"
+.LASF3063:
+	.string	"mixer.h"
+.LASF3068:
+	.string	"sensors.h"
+.LASF3059:
+	.string	"vcd.h"
+.LASF3128:
+	.string	"accgyro_mpu.h"
+.LASF3103:
+	.string	"math-vector.h"
+.LASF3159:
+	.string	"telemetry.h"
+.LASF3130:
+	.string	"io.h"
+.LASF3046:
+	.string	"stdint-uintn.h"
+.LASF3119:
+	.string	"cms.h"
+.LASF3108:
+	.string	"fp-logb.h"
+.LASF3136:
+	.string	"pwm_esc_detect.h"
+.LASF3144:
+	.string	"adc.h"
+.LASF3091:
+	.string	"long-double.h"
+.LASF3062:
+	.string	"rc_controls.h"
+.LASF3153:
+	.string	"battery.h"
+.LASF3090:
+	.string	"cdefs.h"
+.LASF3107:
+	.string	"flt-eval-method.h"
+.LASF3032:
+	.string	"src/main/rx"
+.LASF3094:
+	.string	"typesizes.h"
+.LASF3027:
+	.string	"src/main/config"
+.LASF3151:
+	.string	"vtx.h"
+.LASF3142:
+	.string	"sonar_hcsr04.h"
+.LASF3099:
+	.string	"locale_t.h"
+.LASF3035:
+	.string	"src/main/target"
+.LASF3053:
+	.string	"sensor.h"
+.LASF3058:
+	.string	"system.h"
+.LASF3028:
+	.string	"src/main/drivers"
+.LASF3057:
+	.string	"serial.h"
+.LASF3067:
+	.string	"osd.h"
+.LASF3025:
+	.string	"src/main/cms"
+.LASF3117:
+	.string	"build_config.h"
+.LASF3148:
+	.string	"gimbal.h"
+.LASF3033:
+	.string	"src/main/sensors"
+.LASF3045:
+	.string	"stdint-intn.h"
+.LASF3111:
+	.string	"mathcalls-narrow.h"
+.LASF3072:
+	.string	"config_eeprom.h"
+.LASF3150:
+	.string	"motors.h"
+.LASF3100:
+	.string	"__locale_t.h"
+.LASF3044:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3036:
+	.string	"src/main/telemetry"
+.LASF3133:
+	.string	"io_def_generated.h"
+.LASF3052:
+	.string	"io_types.h"
+.LASF3040:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`Z\001\205\013"
+	.string	"\244\021N\002"
+	.string	"*"
+	.string	"\202\232\340\237\003&\002"
+	.string	"\002\001\002\002\003\361\205\234\331\002\004\002"
+	.string	"\003\374\307\212\272\b\005\002\006\002\006\004\240\342\234\212\n\006\007\321\211\300\200\002\002\002"
+	.string	"\002\005\b\350\223\272\372\005\t\317\254\243\202\016\002\002\007\002\b\013\251\376\263\313\007"
+	.string	"\f\244\271\375\207\007\n\007\002\t\002\007\002\020\360\352\263\211\b(\002\007\002\013"
+	.string	"\f\r"
+	.string	"\b\002\016\002\017\007\023\273\203\325\342\t\024\267\334\371\265\r\022\007\007\002\020\026\270\357\263\342\017\005\027\304\225\207\302\002"
+	.string	"\030\257\323\300\356\004"
+	.string	"\031\336\310\256\264\f"
+	.string	"\032\335\350\233\312\r"
+	.string	"\033\316\323\201\371\t\034\331\323\244\315\b\004\002\021\002\022\036\305\254\336\360\002\002\037\260\312\361\310\016\004 \233\304\365\321!\207\312\266\244\016\002\"\256\330\276\211\r#\320\374\270\356\001$\324\235\311\260\007%\267\303\222\312\013&'\315\324\246\272\003()\373\247\270\225\017*+\255\234\260\234\r,\322\221\346\363\b-\272\227\316\326\f.\224\273\270\303\t/0123\240\342\234\212\n"
+	.ascii	"* \220\002\224\333\034\210p\227i\254\246\340o\277\232!T\214W"
+	.ascii	"l\305H\321`\232\321\"\024\306\207\331\202\027I\305\377t\017X"
+	.ascii	"y\3754\266\302\322\027\262\375av\257\337\302\274lL\326\335-\273"
+	.ascii	"\177N\rBY\t\005n\016\244\246n\301\261\350g=u\327\250\306\335"
+	.text
+	.section	.gnu.lto_.ipa_sra.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 \362\265\003"
+	.string	"\264\003\346"
+	.string	"\030"
+	.string	"\001\001\002\003\001\001\007"
+	.string	"\003\b"
+	.string	"\003\t"
+	.string	"\003\013"
+	.string	"\001\f\020\024"
+	.string	""
+	.string	"\026\027\030"
+	.string	"\001\031"
+	.string	"\032"
+	.string	"\001\033\034\036\037 "
+	.string	"\001!"
+	.string	"\003\"#"
+	.string	"\003$\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\032"
+	.string	"7\207\201q*\203\261\214\310\004\360p\0305\027\2036,\357h>F\212\031\0208\003\203\354\022@"
+	.string	"\bW\223\f\301\226"
+	.string	"\016,\344\312\321\203\300\300\020*\203_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`Y\004\005\r"
+	.string	"\202\01645@o\323\030\246\377\326]\304\366e\254\013\362\307\210\214_\203\037\356\335\367\233\251\306q\357!2Z>?\225\306c$|\206j\304\032\030\317\234\337o}BD\312\235\002?840,d\251Tg\323U\3102A\251-C\317\244\337A\247\036\006O\340\006\212Ku\301\350\"\370x2\005C\003\004\341\001\352959\031}P\214\210\300t\274r\247K\025\021)\344\345k\2271\"R(\342"
+	.ascii	"\354{\216n\342c\337\226a\205\202v\367\232s\334\342\273|\331]"
+	.ascii	"kKSe\251\351\231\261/\376VjK\2756\345/\220\361x\374(\313\356"
+	.ascii	"f\326\355\242z.ww7\\\206\273\2539\363\3442\244D\002^\357%\bz"
+	.ascii	"\311\220\310\217^\266\224\2248 \376\032`\"]\250\261\335\")H\222"
+	.ascii	"\2559\220\242\231\"\353\001\022@T)\211b\2120B\bD\025H \"\201"
+	.ascii	"\004\2212\3363\270pY8|\321\337\215\"B\002\212jzJ&8\273(m9\275"
+	.ascii	"\323\346\032qh B'8K\212^kXp\177\037\300\036\001)\246G\324\306"
+	.ascii	"}fuQ$za\320\023m\222\226\251\254\2536x\326\330\375\240\n@\274"
+	.ascii	"\220F\3428\345$W\032\0355\202{>_\2035X\177\265\205Uc}\315\274"
+	.ascii	"\263\305\326\027\261#\336s\200\232D)\247B\277B\3006G>\320\265"
+	.ascii	"_\236\326F`}6\002T:jp\034\370\005T\322>9\213_\230?\202\364\224"
+	.ascii	":\242\240\025\352\006@\005\370A\207v\033\317\332\360\374g\245"
+	.ascii	"a\333\352\024>"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`B\002}\n"
+	.ascii	"RN-/`M\222\01609\004AH`\032\036\013\210 \210\334\317,\233\205"
+	.ascii	" \b`\211\006\025\240\210\351\200\001/\035\013\017\030U\027a\350"
+	.ascii	"\233&\226\354-S\257c\330B\374\303r\370\206gX\013\027\205\225"
+	.ascii	"\200\325\250V\243\256\330\314\246\b\007c6\370\224Z\241\256Q/"
+	.ascii	" A\251IIO\332vtdf6\350yZ'3\333\240\266LK'\241o\255\033\3522\207"
+	.ascii	"\367\257\267\260\216\264\"\375\215\305\305\024\230\236\035+G"
+	.ascii	"\265\034u\235\343R\273\2024\004\343~\234\241q\365hE\240\247\250"
+	.ascii	"V\020\243\250O\200\022\215\350\335\017|\300?\017\360\354R\273"
+	.ascii	"\251\365\357\202\351z\f\3331\343DJ\250!E\316f\024$\245\225\351"
+	.ascii	"\200\002\241;\323\006\022\300\362Y\026\304P)\250\231Jk\326\317"
+	.ascii	"\247(k\003\3603pi\220\356\032(\216\203\347x\315\355\321\321\017"
+	.ascii	")\334\026i\336\2338)\2347\325\332\333C\265\022)(3/\357\035\354"
+	.ascii	"\034E\350\312{\335\355\314\250A\270\240\353R@~\276\241]b\237"
+	.ascii	"\350\365Cw\217\301\231u\234 ')\363f\"\230\354kH=\213P!\007#\345"
+	.ascii	"|\272\b.\273)!\367\243F\005\222\301\024\020\307e\227S\023[\376"
+	.ascii	"\251\233\224q\206\n\n"
+	.text
+	.section	.gnu.lto_.pureconst.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 M\025\002"
+	.string	"\322\204\017\031\220U\215\001\347@ww\02773\346\020B@\331\267\357S\"E\216hC\006N\360\006.\360\002\016\360\311%\217\034\362\307\035W\3368\343Z\\\361\304\021\357\360\f\257p\3025\270L\231Y!"
+	.text
+	.section	.gnu.lto_.ipa_modref.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\025\006"
+	.string	"\302\006\026 \220)\351\377\377W\375\377\277\375\377\377\377\263\260G\250\265\3266i\006\364\264a\270U05\210\224)7\314\362\020\345nlU\376P$F|xm(|\035=\325(\347u2:\233\236\304t\351!\f\224\362\023 \006Ry\352l\355\347\217\365#\210\317\027\345"
+	.string	"\t_s\0221 \300\002!3zf\361|\317f\324\262\013f/fWh\023\204\354\2259H6,\325"
+	.ascii	"\323*\036X`\267\f\214\340#\230\"X\021\3028fK\322\236B\201\004"
+	.ascii	"r\377\031/\262\331\322\021\327\003\022]\026\356\323\306\207\003"
+	.ascii	"\227'\026\021B\007\262w\034\372\201\3059\241\001W\\\203M\016"
+	.ascii	"*\335\304f\\\373\300\342\026\026\300\r"
+	.text
+	.section	.gnu.lto_.lto.3ce16b97d0fcef2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureConfig_Registry.137.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\324\006P"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\364\301\027\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\345\005us"
+	.string	"\005\001\006'\001\004\023(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	"K\205\220r5E5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_featureConfig.139.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\021"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001\200\202\001?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.142.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\324\006P"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\367\301\025\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\336\005us"
+	.string	"\005\001\006'\001\025\022(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	"K\205\220r5E5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.144.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\002\177\005\001\006\035\001\001\005\001\006\035\001"
+	.string	"?\202\210\200(}{\275\001y\275\001w\275\001u\274\001s\273\001"
+	.string	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_statusLedConfig_Registry.147.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 \202\315\003"
+	.string	"\264\006Q"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\303\316\362\033\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\357\005us"
+	.string	"\005\001\006'\001\004\371\003(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	"L\005N\271)E\2217\200\""
+	.text
+	.section	.gnu.lto_serialPinConfig_Registry.150.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 \202\315\003"
+	.string	"\264\006Q"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\203\317\362\033\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\357\005us"
+	.string	"\005\001\006'\001\024\375\003(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	"L\005N\271)E\2217\200\""
+	.text
+	.section	.gnu.lto_vcdProfile_Registry.153.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 t\241\003"
+	.string	"C"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\355\222\027\004yw"
+	.string	"\005\001\006'\001\003\005\001\006'\001\202\004?\202\210\200(us\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.text
+	.section	.gnu.lto_pgResetFn_serialPinConfig.154.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`K\n\315&"
+	.string	"\266<\333J\200\224R:+\215\277\024\367\031\004x\350\3171\306\001Qb\276\306:\253\035\"Zj\265h&&\263Q\355\370\260/\356\207\256\274\337\321\301\234R\275E\314i\252\335\021\304\252\352\334\005Hr\211u\327\212\210R|-\322\b!{'\031\304"
+	.string	"\276"
+	.string	"\303"
+	.string	")n\2233\326\233\222\234\235=\255\303^m\347\005\254W\331\007X\257v\033u\303\335\331\314'k*\211}\3119\0131\r\226eiZ\346\251\363\235b\243\327\320"
+	.ascii	"g~>\231\030\266\267\2526)\276F\375\257'xKC*\215\257I{LI\266\257"
+	.ascii	"%\233)P\234\026\251?U\\\032\0043\226U\007B\315\314 \177w>8\231"
+	.ascii	"\266\230(\3533\302u\265d\276\367<\205\033^qWK\346W\252)\251("
+	.ascii	"(%\031eR\214\265\307D\325\365\253$3F\375\261\3526\251\332f\366"
+	.ascii	"\374Z\262F\n\341\tG\327\303~\227\224G7\345j:~\330\031D[\244\262"
+	.ascii	"\351\267'!\347\334\027\251\\\276\001\274\373\307\356\306\320"
+	.ascii	"\035\323!\027\343\340'1\217n^\363\030y\022\021G\202\366\342\332"
+	.ascii	"\335(NVT\320\226s\006\352&\361\"%\330\234\363\017\021\242\023"
+	.ascii	"8M\034W\373)\326\253<\315\271\343\315\353\037\264\305x\211\217"
+	.ascii	")Dp\007#X\035\257]?\354\351\216\253\013=[\313\327\256\333i\274"
+	.ascii	"8\253\373>bT=\032cu\343\334\334\353g?\366\306\007{\337{\373\006"
+	.ascii	"\nx\221\222!I\316/\362\356\262\232Z\246\365\261\037,\330>\333"
+	.ascii	"\027l2\326g9H5\031\351\206\326\226\005\366jP\354\247\357\354"
+	.ascii	"\207\265"
+	.string	"/X\344\347B>\304\350`}\306\032\223\354\223\314\306\226\234s\360jW`\257\346\244\327\327\035\354\372\371\355>\220\0071\272W`\352Z\247\236\323yiaD\377\203\346\365\200P\274\271\242\216\\\035\317\343\212:[\016\\+ms@(]\373\001\\\324\214\027oGK\256\312\212\263:K\037\256\347b\311\255\377\266\342Y\351\267\251Z\250\364\253\244W\244\364\327\260\223(\375\264{\304I\377\311\277\266\262U\223>Z\303\2619\033\317\354sX\257\366E\346\245\256\255\234\363\316\241}&\333\314\311\354\314;\253\216,u\303tw\2338\223!\2333\022P\277\354f\036R\020\304\365H\342z\365xA\215\262?\377\026\320\270;\247\265\\\241\342\254\276\r\306j\237\024\306\301\330\355\006\177\361R\237\255\027OpC\272`\360\260\204\343\265{\232s\316)N\016\317\003&\2064\020\r\325\021E\304\020i\3778h\360 \b\350\201\003\037"
+	.ascii	"\023\210\206\027>\004\r\213\206\2124-\344\303a\270\201\210($"
+	.ascii	"\024\332 $\032\006\201\020\n\025\025\205>\004\232\030b\250H8"
+	.ascii	"\202H,\022\372\234\371\353_g\243tjG|\364U\203\263\332\347\003"
+	.ascii	"x\203\261\233M\360\230\305\317\253J\214?\206\257\346r<in\360"
+	.ascii	"\3070\276\351\201\246\235\375\027\3572\001\271d\\Ec\\\346\265"
+	.ascii	"\272U\275\350\024\226\377\242O3Q'\252\251\250\362\351FA\255y"
+	.ascii	"W\376k\355~uNM]\222w\251T\345\330\376k\323|P\230\\\240]\026w"
+	.ascii	"\351\"\323v\312\177\255\231\314\022\245\244 >\027\351\036\261"
+	.ascii	"5\177\250\375\327\362\210\331q\2157s\375\356a\360\252\240\374"
+	.ascii	"\327N\261mT\200\314\250A`\250\230\032\021\021Q\220$\005I\007"
+	.ascii	"\360\002\221!\225\352\021\300$\251\034)'%)iA\n;\007}\013n\227"
+	.ascii	"\"j\221p\310\226\374m\303\025\001\034\024\n-L\nL`\334,\023\234"
+	.ascii	"\220V\\eGJ\363\335\016P\340\332 })\306\256Fz\375\027gU\210\344"
+	.ascii	"\246U\230\302F\240\371\276\243wp\251\037MQ\036\211\310\020\246"
+	.ascii	"\207@\210FP~\037\321\235\331\375%\374\325\370\022:\004!r5\032"
+	.ascii	"<\336v\363\016\317*\3374\343\341 ) F\243\327~\241\211\212ts\316"
+	.ascii	"\315s8\206)\345\016\224\321\325\250\347\331\316P\340\226\222"
+	.ascii	"T\223\220Q6-B\370\342[\306\233\257&$\346\227\275\206\013\211"
+	.ascii	"p\331F\273\n\263\313\353\027\356\233\255(\303\3050\362\342\224"
+	.ascii	"|5\213\2748%_\315\"/\356\210^\351T\030\277YZ\034JB\246\355F\317"
+	.ascii	"$\360H\2670s\377\202D\354\243\027v\324\203\324\335&\205w\207"
+	.ascii	"\307\202\345A\326\022\242\372\303\354n\327\273\276:b<\036\036"
+	.ascii	"2\316\310\230\334\277G\253\363&\345\370\\6\337\\\007\271\322"
+	.ascii	"|\361]\236\217x\321\177\252\f&\270h\304F%\212\255\222=\214\270"
+	.ascii	"9\244\224\221\223\356/0\217\345i\fM\\S\037\324\200\314 e\237"
+	.ascii	"\\\332L\005\3462\214\2277\202Y\230>),\364\307\246S\234?"
+	.text
+	.section	.gnu.lto_pgResetFn_statusLedConfig.155.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\273\001\325\020"
+	.string	"\246\037pH\320TQ:\220$\310d\204T\375 C\ty\372\206p\371X\342\312\223\262;\230\352\315\311\245\374S\233\357d\255\236\221\023\377\265M\263\300\260\236AR\306f\224e\023R\304\005`#\266\334\346\316n\370\217\216\023B\366\336;\245X"
+	.string	"V"
+	.string	"^"
+	.ascii	"\337\253\305\227t\257\337\rt\257v\331B.\336\354k5\0214\204v7"
+	.ascii	"\234,<O\305\233J\327+\235\322\345{%\235K\023\264\230\215G\366"
+	.ascii	"z\245\003v7\200\f\004u #\213I\212C\363y\332\345\016\333h\343"
+	.ascii	"\221\321\\z\245\335\265\034!+qw\267\rc[\202\375!\001\377\356"
+	.ascii	"\256\347\314\366\236\363\323\217\367\277\343V\bw\301\310\356"
+	.ascii	"\314P\222\005Rs\270\370\370\333\007O\220|\321\247Y\004\242 \331"
+	.ascii	"\366e|\206\353\243u|/\022\337N\r\307mw\301WG\370^M\350E68C\272"
+	.ascii	"\264\017\3431\\\317\2119\201\335Y\220\236]\021\305'\001%\230"
+	.ascii	"\314\235Ro~\274I\203\177z\363!R\304\344\220\025\370\250\370y"
+	.ascii	"\253\263\355\3416Z\f\200vw\305\336\360\035\016\337\356\222j\300"
+	.ascii	"tHp\323\342\325\217\351^O\200\212\300\344\220\001\370\340\374"
+	.ascii	"\254\314\315\271\273\257i\360\037\017a\005L\346|\332\351\213"
+	.ascii	"\232\022\036\267#DV\346l\361%\247\215\035\250\233\224\362@\305"
+	.ascii	"\264\242\2222*\300R\241e\302\252\3052\261V\002|\032Y@\271\274"
+	.ascii	"\244N\341\311%|A\2310\204'\325*\034!p*C\213*d\245R\252P$\356"
+	.ascii	"\277s\346\212\333#7\330\214\331_u\266\206\337X\035Xp\235S\360"
+	.ascii	"\321S\247\215\275\036\323\2333H\202\377\224A\371'K\320\007\211"
+	.ascii	"\344G\315\316$ `\002)V\325\003-\211\033\257\214\366\2565W\303"
+	.ascii	"l\345\266\022\322\212\334\231C\311\375^\021\332\t\255\347\302"
+	.ascii	"\336`WY\366\301\0222\245\234\031\353\2307B\354\341\026\3030\b"
+	.ascii	"\336,c)g\300\324\"~\f\247\211oK\351\356eC\3047\300\212f~!\224"
+	.ascii	"_\327z\002"
+	.text
+	.section	.gnu.lto_getCurrentPidProfileIndex.156.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 \366\335\006"
+	.string	"\002M05@o\222\016@!=\320\242\217\247\224\273cH\342d\034l\352r>o\271\320v\232\177\320&\312i\201\027Ta\212\242\270V\340\360\246\030\334\246\262\304\321\332'[\246_\031\207\215\206\203]\357\322<\316\206\341\341]Y\347e\004\306 \032\262\027\201a\331\263\266P]iW\020r\242\277S\022\211\200\314\013\205;\322\323\304\riu\205\007\253\265\272\036L+t\003 \247\020\246\2668\022Y~\023\241\353\370^\322\225~\034\035\201F\n\305I\346(\325\222(\225\211\351\377\2745B\302gP\267\217\021\306\244a\224\2402\267\347<\n*\202nEzYA\251h$\213\"\300Bf\216\032)\243\273\376\007\277\301\277\021\b"
+	.string	"\t\013\270\211!|\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_getCurrentControlRateProfileIndex.158.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 \366\325\006"
+	.string	"B\21505@o\222\016"
+	.string	"\301\256\276\230G\310\030\343F1\362eC\316\255\034\230@\242\200\333\330\354g\231\251h\201\027Ta\212\242\270V\340\360\246"
+	.string	"S\350\200o\242\333 [\246[\230\007MfsY\317\312\274\215\246\001\342Y\230\304\303\f|E8`o\342\272\260WmZ\335hW\2409\317O\321\220L 3\027.HM\025\327\243\324\026\034\354\247\324\345\\J\2413H1ix\272\332Hd\371\315\203\216\343\013\220\231\271\033\3758:\202\022\224\213\221L\320\251%O(\222\322\337\371\352\004\205\316Y7\022\350R\"e\210\250dn\317u4+f\267\037\245D+&\237\020F1\200!3\307OH\324]\177\204\377\340\327\b\007"
+	.string	"\t\013\270\211!|\205"
+	.ascii	"\357\232\267\204 \341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_getCurrentMinthrottle.159.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"=\007"
+	.string	"\302\21525PU\322\001\200``7:\006\323\202a- t\261\203P\246).\355\264\021\2134\247;l\004#\261\345\277\211\252\352F5\353M;\354\261A\205\r\262\211\224)\005\206\233\207\016\307c\301\0079\317\323i\200x\360\372\274M\201\255\b\207\353IX\326\365\252\230}Z%Y\0212\025\331\376\034e\"`\027c\301?y\244\360C\356\\\001\312kw>H\r\\L\262\334\\ul\322\330Q\224\352a\177Z%\331N\247\036\274\264X\304\354jl5\313\342VDl\207\354\312\0379I\310XF\220\rJ\245\224\221\"\263\033\237\300\t\250\273\374"
+	.string	"u\247\037\307\236\230\377\222O03\2336\272x\0020\354\256S\033q\334z\333\n\266\023l\227\002\t"
+	.ascii	"\t\013\035\263\030\277\"\3365\204\345\032~\0331\262\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_resetConfigs.160.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\333"
+	.string	"%\f"
+	.string	"\326\325QA"
+	.string	"O6\035"
+	.string	"\017\256\307\255\n\350}U\277\2541\006\300\001\t\270\0063O\373\327zU\034\3419l\303\003\240\335=\300\001\250B\201\377\327\375\204~y\002\261\302\025 \224\022\211\257\341h\305\200\240\275S\n:"
+	.string	">"
+	.string	"A"
+	.string	"'\353\3345'\337|"
+	.string	"\362\315o\211\354\356\333;\217\366\212\233\036\266"
+	.string	"\t\020\030L\234\273\353\325\016\037OG\377\253\003(M\344i\306\202\3355-M\247\273\336\266\001\333\r\354k\002\366\035\273\273\256)\373\021`\304\007\323c\033\273\245\215\030+\333N\204\360[\207\331\235Eg\371&\267!E\367\315\366xW(B\226\210\321$\337\022\250\270T\372\227+\026\321]\241\233[:\352\f\377\352\f4\2108i\334a\235\220\276\264\243\222>\354\034\n\325\315C\\\260\240\301\250=\364\370\353\221\021\3250\b%\271-\001tz\320\311m\n\025\350KG.T\322\bZ\274\230-\325\260M\022\255\034\002\276X*\230\214\002\214\2052\300\302F\343q\260\211"
+	.string	"rB\361\201\006\374\b\360G\201"
+	.string	"r<\341\347}\034\317\003f:\336'\202<\n\001\207\237\215\350M\bC\321\353\314\321\035[S\206\324T\262Q%\231\003\303\f\263W\027"
+	.ascii	"\325\223\240Lh4\032\030\027\b.>\303\306\\\rb\025\327W\021\266"
+	.ascii	"\236|\204\366\201\323;!\206\247pr\231\007h\2047\004\024\352 "
+	.ascii	"0\007A\265\375\"\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_activateConfig.161.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\240\002%\024"
+	.string	"&\343~I\300\324M:\020WO\307\213\372\204\357\022\275\"6\321\306\177A\264R\264}&#1K\263\363'n\320Nml\033\275\370}\002\302\200\354\320B\304\364\376W\370a\366\3775\274\3740l\324L\212O(v\361\365\337\222M\266L)e"
+	.string	"b"
+	.string	"o"
+	.string	"J?\266y\220_\344*Q\365\262M\306te\345\275F\022SP\312\251\n\t\b\273/}\241\017\331\234\310K_Yy.\251\026M4TNm\240\3444v\030x\372="
+	.string	"x\372\227I\333\310\313\025u\300\214\0378GV\265\326p\2528\371%\375\367n\262\343\341\276\255\005\265V\357\2167\342\236\267\215b\373\202=a\001/\035\024/\372s\242\226`\034\241J\371\313\307r\213e\377\3506@\370>\336@\263\337\235\3724\340\351\247\311Nn\263|S\032oC\255\265o\036\366;\307n&\316\007\250zPu\261\354\362fg\n\373_\235=\366\\\267v\r~k\272\353\357[\317\271\336\271\376\t"
+	.ascii	"\242(\336\223\206\324\232\223\205\244>\321YDobPR\253\216\305"
+	.ascii	"\367q\246\006/\340\351\234\nX\fU\025X\177\311\301y\274\307\203"
+	.ascii	"\b/\256\273\210\204\t\272)\nRP\260\335iW\260\240\233\270\035"
+	.ascii	"\273H<'\256\246N\366\363F\327\201a\243\210\324\232\373\356F6"
+	.ascii	"\202\347\200i\231\320\361q\n\252\265\272\3348\216\030\337\347"
+	.ascii	"\324\342l\006\236\3323\264\020\023g\277\374{w!\361\210\270\222"
+	.ascii	"\nfYI\320\022\343\322\262\";\261\006\331\215\303h\253\251\215"
+	.ascii	"\"\214h#\360a\226\241F\203\001-\312fh2\265Q\fE\231\260F\213\241"
+	.ascii	"\tE\333-\224\t\360\330af\013k\306\321\026\276\312\334\277:{J"
+	.ascii	"\250\262\236r\363\306\260m\271\020\322\232&;H\300\037:\301\027"
+	.ascii	"\017\002\344Nd\fR\006\tD\002\201\247t\312\254P\366\2336\331#"
+	.ascii	"\205\346\374\246\nN\222\334\006: \200\002\2212\263\rQ\242R@\364"
+	.ascii	"\020\277\214\262\232;\311d\024\310\310weL\264\313\231K\030\307"
+	.ascii	"\342\320\370\364\0021\321#\263\222Y\267>\253\"@d\253n\353\367"
+	.ascii	"!Kv\002j\027\362\322\240#\266\332\310'\301\035K\254\260\\w\f"
+	.ascii	"\337\203\263\177C{!svj\302\2313bZz9c\277\r\304\327\205\333\227"
+	.ascii	"x\025h\221^\254\2326\f\214\202\215m\243\365\260%\345-\032\212"
+	.ascii	"\300\334{\214\217\333\2058\267\020\314\023"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.162.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\022\t\225'"
+	.string	"\266>\342H\200XR\007\177\225\370i.'NE\2161<\364\376?\246\n\300\037\261\315\207\325\377\257\237\274\214\246"
+	.string	"\343Zu\004\f\3525\326\245#V\362\341(\327?c\260!\312{\253\361\315#\274s\267\373\217\255\031\331Z\273\367N)\245\320"
+	.string	"\275"
+	.string	"\325"
+	.string	"#z\312=NaqL\242\247\374O7+\247\251\3738\311L\245\251\321K#MB\n\213\273\367\026\377F'\033\347\306\246\206fF&\006\346\305\2058\024\006\201?_\217\267\323\265\354\372\236\344\326-\3405\237\312\306\231\366\315T\3526\\]\303\265\303i\266zf\253\312e\250:\206*\207\303L\365\313\024\016w\221j\242T\224\017\243-LsF\261\2343<\350\324@\031\376\213\341>\030\336Ks\276p\336J\200m\354\255\261\234Nk\314\022U\263\245\r \315\331\344;"
+	.ascii	"P*\230Z\207\344m\232\223\311\204\263-z\335"
+	.string	"\271\367\372\236L\377\225\200\223\023\026\301g\2115\006\255\306\224\226\266\243x\036\271\353\026\334{\331\233O\025\3159\315\354BfV\300\254\343\no3\322\330\207\252\265\261\025b\324Q\273\367\0061\020uk oMi\327\261\260\222\022KV\253.J\037[\377\237\024X\331O\3778\356\302\374\233\254\251\232Ng\377\320\265\207\332~\035\2605\246\3171sP\367\030\312Qc&j\036\032f\242\3672\021|5\225\003\367T\263\214\374\340\335l\226\373C\333l\177\316\232\327\322\253\354bWVrW\256ca\246\036\371C\231\373\253\325j\225\337\006\363\352L\\\235\207\255\263\220u\016\262\316@\326\371\307:\373X\347\036\353\314c\235w\254\263\216unYg\226u^W\347_\235\375\235\273G\207\354\b\212\017i\363\243P\357R5\313=c\215T1ss\335JO_\313\035m.6f%w\205\206\251:\351S\334M\202{\316"
+	.string	"\227"
+	.ascii	"\2532r1?\264\037\034\214\322\312\213\257\314g\346r\251IL\210"
+	.ascii	"=\263\236\222\341PI=\001aL\310{\240&\315\373\003_\353\255\361"
+	.ascii	"6k\346\b\022\274\233\274#b\313o\327\n\340\356\205\206\367\336"
+	.ascii	"\335\373\264\3266\351\005\215\237\356a\250\356\325}O\306\273"
+	.ascii	"d\265\310\362\265\017\244\262k\277\325\342\t\316\252d\365\036"
+	.ascii	"\312\204\253\331\357\266\216\316\261\025\341\205h\327\007\002"
+	.ascii	"\223\"\343L\275=\241e\246P\301\273\271~\202'\346+y\300\233\326"
+	.ascii	"\356\241\306\226\314( z\357Eb\241\331#=W}\357\275\272?\353c\373"
+	.ascii	"\377\303\002{r\241\213\034\273,JDC'Q\033\362\337eQ-\003\201\255"
+	.ascii	"\r\b\234\201g\303\017QQ\220Q\021It\344\031\"\022\352\200<\026"
+	.ascii	"\217B\305\016D?\034\212\307\"\243\"\317\f#=\004\025\025A \221"
+	.ascii	"EE\037u\331\353}\033\2739\262\263\345\037q\001\034\311\034Gs"
+	.ascii	"R\234\207\032[\0239Q\003jnK\257\352\270Wy\363P&\376\360"
+	.string	"\201\300\314\230>W\345L\342w\330\225/\215;WbHf\355\246\214\332f\207\317\363\342\336\322U#\356)N\352Hj%\265\332f\205\237\023\305t\304i\023\300\273\253\263\370\350\224\260pR\232\354J!6F\365i\231v\273\2106\220\271\246\232\340\323,A\241\265A\331\361\366\3528\237w\262t6dz\357\262\233\334o\r\307\240\201\217w\323\247m\226\331\301\003\357f\360[\332\255\2044f%\307\006\003\252\273\002\200\305\250aHf\231\232\021\021)(J\222t\340\002\021\241\3426\021\340\244S\f2\0221\005I\007\333L\232\364@l\236\271\370\235L\201m\250\360\213\017\362Q\372\316m\310\244T\300\314-\337\355f\220=\3009\311|\371\2507\341X\311\272L2\002\230\346\3247#, \317\366\365\0267\276\376\262\331-\237h\177N8\250q\327\320M\216\221=\247,oR8\005;\022\t\317\007\237\235\252\251{\033"
+	.string	"A:u\312\026\210.\3701\203\353\217=\203.\b\376&\360\362\021M\316\373 \001\334\354\226\260\217;\001t\360o\253\314\341\nm2\t\361@\216\244\3518\222\224\371\\$Ni\313\021\300\344\326\222\265\037l>\342C \206\264<&b\214;qM\247\220\314\222\341`\214-"
+	.string	"\374\372\007\273\207\310\300\270\361\177\352\007\344\004\362\364\b\226\356\240\b\241\026G\235i\227q%\322)\"V\241-\023\342f\304\236\344fM\203\344\222\230\374\034\"\261\344N\035\r\f\025F\245/\314%\224\024|"
+	.ascii	"VL\327\007g\335<GG/\220jy\177mQ%\311\033ltQ\007\262(\243up\340"
+	.ascii	"Zr\023\031>\366\022\0212p\0049\030R\006\034!\007#b\312_hl\035"
+	.ascii	"L\227\366\245\037\027O\255\206Z\272\361I\024\256n\316t!kB+\213"
+	.ascii	"\310j"
+	.text
+	.section	.gnu.lto_validateAndFixGyroConfig.163.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\n\r\365<"
+	.string	"jb\300\025AP\346Q\0076\307\214\230X\262\352\313Hm\020\343$\236\376\360\232\376\337\2330bl'\020\020\300[\037\\w>7N\364\366\323D4\311\215WF"
+	.string	"\372\021\343R\371\005=(Lw\215\220\275\367N2\245N\0016\001K\001\376\246\373\355\031~\246]\215\263q7\357\030;\263$ar\316o\233\2661m\332\244\340\224\260\255\341\302\266\346I\352e<g\323\220\271\024\320\233\220\312\204\025{\232\031\216\246\335\326h&\003:\251\212\215-p\266i\214Mh/\323\276f\025\244\201\203\245\253y\005\277\242\271\307\013G\215\036y\316\266\233\231\321\375:\213]\214\217qi\277\t\004\221\t$\027\206\021\n\236\263\t\030Ekx\366\221\261\236'hT\271\017<g\255\232\023<\214\243-=\255\333\202\315h6k\341\n\311\ts\345l\033\3409\033t\247\326\331\325\231Zg{\331M\310\243\320\f"
+	.string	"\315\314i\206Q\316y\370Q|\351NML\300%\245$\244\243\337\353\353\361\334\226]\037/\333]\254\236\030\331\227;\235y\323Y\22613\314D\005\003\247\340\2455\350\346U\323\2613)X\t\352IP%\030\351\b'\361\037p\f\311\032\fN\307\216\340\327\305j\342\243\314}eUY\306\214\340^U\023\037E\234\267:\351q\"\310*\211\035 \236e\214\bv\247cE\234\270\025\342l\230\r\274\002\361G\"k\256\301\234\263K\035\347 \003\303\330\305\31297\026#\363\341\375\344\335.\326\335U\272_\265\316\016\353~8\224*\327\206\347b.R@MLu\335\253e\177\205\024\020\t\037\344%\210\255#\233\2669\030\216\262\267\334\024\356\356\342\23293\t8\031\207\260\204\211\353\032\001\325\256\375\347\233\377\211[\304\256\377%\274\017\237\325\204\303M\037\0015\321t\375g\237h\363\234\020"
+	.ascii	"\3159\343q\020\207\310\317P\rMq\316\371\353\377\331\370\375W"
+	.ascii	"H\36341\265\273S\270\235:\370)t\253\3609D^\316\315\007\355q\\"
+	.ascii	"N\261\335\314\3316fa\027\313j\235\365\177\372\223\306\304w\215"
+	.ascii	"\327\334\344\350\3462\256\353\216\202\371\232\377\331\355k\376"
+	.ascii	"'\335C\207\343-t5o\005\036\365\276ZqW\271\270\251\246\0028\031"
+	.ascii	"o\251\026w\324\213\033@\213\033\312\207\373\251\207\333\311\305"
+	.ascii	"\335\264\342f\352\341\006z\232\367\222\213[\311\305\235\324\303"
+	.ascii	"\215\264\342>rq\377z\270\337\036n\337\212\273\347\342\346\361"
+	.ascii	"p\273+\356\326\305\315\266\270\327\026\367\267\270q\213\333\031"
+	.ascii	"\f\310\003\006W\006\355\354\375Ds\217\273F\371\215}c\305\341"
+	.ascii	"\270\253\271\247\271G\335\311\270U\023\267~\255\234\300\201\341"
+	.ascii	"8\240b\276\310=\tJ\336n\255\267Q\340\316\306\364\236\006\370"
+	.ascii	"Lx\336\237z\340G\r\n\243\343k\276t\246\032g\232\364[\372^\217"
+	.ascii	"\206?\3659\256~\352WH\361\270\324}k\211\226\320\315M\275\247"
+	.ascii	"9\306uH\027\260\220n\353\b\215\201\340 K,\253\226\345\226v\271"
+	.ascii	"\245uv\370\376\306\217\366,\275\f&\276\303b9Ac}a\273\366\337"
+	.ascii	"?\333\013\232\034g\233\017g\357\236\324\007\300N\325R\375\337"
+	.ascii	"Iz\252o,6\307\304w]0\017\257\001\320^~\301;\226`\246\342\234"
+	.ascii	"m\234\003\353X\242-\305T\250\320:\233\364\003"
+	.string	"\244\2441\232\346\272E\323\253\367\250\007\221\376\375\253\307lG\217\364Q\277?\332\200q\340\033\277w;\177\322\002\274\357\337\367\260,`\370\256{\357{\226O\230\034\357{\357\316\252\006\034\346e\203\367\023\244\344Y\322m\001\203%\2470s\001t\206\2358\001\336=u\262\357\237\335: w/hk\234m<o\344/\320\322\234m\256\003r\251\317Q\347\356\035\206\252\353Rwh\235\022\251\307b\366\b\245\370\255\315\211\322\315y\262\355\316\340\324$\2350n\b\"\357\326\340\213:(\032B\203\270wh\2737\370\241\016Tq\206|\316\003\b\021\"\332F%1D\261\013\203\f\"\322\347\"\353\350b\215\221|\361\355B\330\345BID\016\265\222Hd\262(\245D\022\037\231\3242^\350\3522\026\223\\\037X\034?\310 \"\201F\344qD\226\326\361\305\026\222\330\3653\"\217\312\255d\222\003\213\343\326\333\017\0344\200@\214"
+	.string	"\301\201\020\250\225<*\213G.e\2271\204QId\261E\202+\251L\"\237\272(\314:\266\320J\026\207\305\026C\255#\0219,ru\r\205P\235\3342r\r\225\311$\327\360\2152\375\237\334\250\332\2751\037\314)\352\251\2348"
+	.ascii	"\3159OY>\013Hq\261\271\247\217\372\226\217\263\032W\245k\372"
+	.ascii	"g\013\037\300kI\361@=\200(8\n\021\312\023j\221\360\035\316\323"
+	.ascii	"\013\037\2739\253W\330\351\273\227T\226g\255\213=}\260\371_="
+	.ascii	"\365\335\346\330\351\337\316\355PGs\316LI\2174\315\356\325&="
+	.ascii	"&$\275\323\304\324\245\177\022\362\246_a\005/\361\242\212S\262"
+	.ascii	"\004\003\005M\322\364TUCJJ\177\244\314\312\037\"\n\376\367J\337"
+	.ascii	"\370Lu\3164\277\253\265\257\340\261\235\263\312\304wl\356k\356"
+	.ascii	"U\234\211\256\320\311U}\373\215\303\024\201\025q\246\257z\t\320"
+	.ascii	"8a\210\336\270/\r\331\324\335\270\007Yk\004\204\311\241\201\027"
+	.ascii	"\250\221,&\031BD#\"A\222$)4\006Q\005\304\030F!<\017\021 \255"
+	.ascii	"dj\210D\024\024$\205\016[+T&t\225\376A2\340\202\276t\336\224"
+	.ascii	"\032n\374}'\323\036F\304\315\356_\225m&\341N\260@x\333\210\346"
+	.ascii	"\211\033EE\266\207\260f\305y\206\3222\245\262\017\223\300\272"
+	.ascii	"&\0234\345\214\356\232A\032#\"p\310\177?\263\264\321\254\002"
+	.ascii	"p3\3168.\325\354A\276&\f\303\263\005"
+	.string	"\220\f\301\236\006\352*r\355\035\347\255\261\241\351Y\302\326u\004\025\032\n\311\030\370\223@G\372\037R.\023\267\234\320\305c\201\352$\343Z\343\201\314\017~\261\212\362\013\235\241\023\006\330\374\233\366.\r\267#@\225\027jk\355\367\331?\027?\313\300\252h\275\021$\273.,j\020\375\033\302\3628\030\236\326\327\353^w\"\252\362\032\341\374\362\230\3478\b\307SX\023\275\345\300\022\321PD\372\316\003)\312\371\032\355<J\241\233!O\206\020;\034\232\334M\335\364\322\321\016\037\236\256\353\013\007\303fD\3069MaQx\276L\020a\352\177\324l\263a\256\264\326\"\345\313\374\232\210)X\305KVa\220\btc\234\357\016\307C7\356h\370VQ\342\316U\343\305R\344\n*\346\\\036\260d\212\352\006\374\004\213\376V`'J\314d\033(>\034\265F\205$I{\375kv9\321e\333\032\335.\035\312\273-l\036"
+	.ascii	"Z\237\240\352\255:\267A\334\336\361\375\276}\001\354T\210jn?"
+	.ascii	"\232\333\203\2739JQ\244F\035\360SYhJ\274\023s7\344\273\310\004"
+	.ascii	"k\340wl\251I/\375\016\323N\354a\330A\023\022\3027\360\00410r"
+	.ascii	"\0067\006&\344\005\247$uY3\224\301/ \t\207\322N\356\362\344\324"
+	.ascii	"#\016C\375\304/F9#\237\023\333\370\312\333\234\t\236\036\347"
+	.ascii	"\f\024\244a\n\210\03246*W<\201\315\247\246\313\003`\3024\275"
+	.ascii	"\211\033\005\376r\343\224\261W\252\347r\244\027K\242\0378\032"
+	.ascii	"\337:\272\322\2207\273S7\327\240$&\033r\374\001"
+	.text
+	.section	.gnu.lto_readEEPROM.164.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\306\003]\027"
+	.string	"6\250\220I\300\226Qc\252\200\n\357\r\376\314\025\022J\021\320\204\360v\016$\366j\266Wp\016\344\264\24699\264\003#\251\016\265\252\223\247\023\350\247\332\025\263\230r\337\rI\231\242\n7\366\f^\026\362:\001|\227Y\262\367\226[\312\224\002y"
+	.string	"s"
+	.string	"~"
+	.string	"\327l\271\265\201\362\326g\n\262W\267_\271f\033\271\351\273\003~NB,\236\356\275\255Z\342\265\253R%9Z\261\322\232O\312(=\245\343\331\256:z\352\302\335\021\360*)v h\251B\202\310\350\244pg$D\307\242["
+	.ascii	"\274\rb\312\275\227\003O\003\025=\274\212,\303\032KV\274\234"
+	.ascii	"(`\350\204\356J\247\035x8JI\231{\257\251\216Gt\257n[\205m"
+	.string	"\006ve\n^Q\233B\017\275\356\3255\242vTR\333\002\020\275\316)\270j\363\312\371Ax)\224m\342h\355\331\027\357\275\327\025\311\256\324\244\245\036-\265\255\324\242\245\256\226\232\212\324g\241@\025\341=j\306\275Cg\324\rbm\240\360\231\016\f\372\222o\252D$Y\335\332\256\275\211\226b\013F\231\007nY\210\300T\372\237_\\Ao\242\335\274C/zzZz\272\001\2657\343;t$\370\221\265g\030\2674\317\201\303\326\226XT\2546\204\232Z\305\332\"\364\344FO\0335jE\260b\254=\332(\203F\300w\357\215\341\362%\271\321S\005\275\367\332,\275\315HkN\360\207\035\341/l\312{s0\276\323]H\360M\334z\302\215\365o\306[ZYB\232n\364\364\312\231$\242P\361\257\321\206\361\344\252\315w:C\334\327dH\243\032\303\370\232\023\034\222\243M\002\206q\275\304\340(\210q\271\004\310"
+	.ascii	"\323\361\231\201U\210\355\310f\017tb?(~\271\360\304v|d\257\326"
+	.ascii	"k\247\345\023\303\351i\275f@-\027\226e?\260Y\353\202L6k\255\314"
+	.ascii	"\333+Ry\002\tr\253\270\005=f\200t4\250\345\360\177\277\322U-"
+	.ascii	"\234\354\230\fo*\026%\253\017tPC\257\263Xm)\3328\326\234\240"
+	.ascii	"\217\003\257\372\221$\274\371R\311\221!\023$\367\277[\346F\241"
+	.ascii	"<V\222\346=x\214\265\300\2152Q\2501Lf\215a\250f\202\202\202\224"
+	.ascii	"\026\306\240\002\231\241\263\r\020@jDjR\034\325[\315\362\n@\037"
+	.ascii	"\377\211H\346qT\031i)!jJ\322G\027\303a\352\326\256 \230\313A"
+	.ascii	"|\361\003Zr\337\021\341R4\255\035\343y\340r$R\266\021L\327\\"
+	.ascii	"\360\240a\n1\306[\274\320\347{%Ul\264u\305@*2C\352\314OD\232"
+	.ascii	"a\233\027\200\264\253\272\237\346\360\2421Jh\004\210\217\222"
+	.ascii	"<*\tu\367\025\250 \221_\177\204e-\004\321\233\200\231\375\200"
+	.ascii	"c\306`\245#0\265@\007\232\375\"\351\034\302b\n\203j"
+	.text
+	.section	.gnu.lto_writeEEPROM.165.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"}\006"
+	.string	"\242\213+2pM\322\030"
+	.string	"\202g\341P\330\007q\212\016\t\325\225\266\2371\265\225\265Eb\336\332:\342/\243\001\321\370\377\177u\317\355\016\3228\254!\r\023\"\267L\001;\214\202&\263y\256\271L\333h\020\026\232\233\032\032&\340\307\22005\207\367\246v\2616\241U\217\324\211\237\t\345<\254@@\024e\037!\301\262z\200\243\324\006W\311\310\262\224\267(\246\030\237\320\252\347#\200NE\314Kd\327\342R\331O\024\262\361\347\247\007\374\313\360I\322\322X\201\217\023\n\020\223\335m\232\2210\031<\263#\245*R\311,\007\273;\253\342E\256\371\023\374\005?G\f"
+	.ascii	"3\241k\037Xa\316@;\020\031\320\"\347bu\266\341\302(.X\002.\363"
+	.ascii	"\242\235d"
+	.text
+	.section	.gnu.lto_resetEEPROM.166.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`Z"
+	.string	"%\b"
+	.string	"\322\21536Po\322\001\203\213\250W\215\375\312\245J\023\300Z\r\325\n\310\231\017\300Uy\240\3116k\247\031\305\217\021\252C'\252\252\032\261\202n\245 T\201.Zk\204\354\235R\236\033\206\016\307C\247\234\034\351\351(4\310i}\344f\300\324a\301\222\020\224Z2r\242\227~\213L\343$\202\327C\314\247\272|\213\370\366k\035\313A\272\225\224g\031\324\263%&\3361\027\\0d\204\f\003e\337\213\315]\017v\330\247\026r\330\031\201\r\022\322+Nv/:\230=U&\037\266\357\233\276\201\036\342"
+	.string	"m$\276\362M ;\276zt\265U\316iKP\202Q\210\264\354\256\204\036\257\177\325\177\351"
+	.string	"\330(\364\247I\330]?lD\272\341m\033\330>\260\237\t\025"
+	.ascii	"2\003\3020\310\302\312L@0\016\030\006\266\320\271\361TdH\265"
+	.ascii	"\346\324\200\027L\257\330Pg\033.\214\357\301\262P\266=e\377\322"
+	.ascii	"\0308\227\027\302$\003"
+	.text
+	.section	.gnu.lto_ensureEEPROMContainsValidData.167.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"%\b"
+	.string	"\022O77@\217\322\001@\216V\237/t5B\312 +^\3079\206\362\330\205\001h\2205.\242\t\344f\304\224\3403\235\305\017\303@\216?\360\266~\022$\t\262Z\263mK\231R\276>\r\242\320\b\273\342\025\212#\221\202C\2742R\374\f\030{`\310\"\004\206e\261\263\332\203*\224\203\234\264I\021\371\316\036N7\037\240\276\267:fJ\324\024\233\353\302HK)[\206iKL\344\273+\002\007\247\233\377\375 (\021\226\315\030{\265\245z\330\207\273\273\326\224\375\3647\002*\223\323-Nv1fd\226\245Q\t\261\375\2165\333\345\253\217%H\3210\221\274\354nT\325\265CM\315\007\360\266\303\214+,Hm\300\004x\034\364\254\260L\377\236\027^)\223\003\332]g\347\235n\315m'\3306\260\215\022\016"
+	.ascii	"2\003\302\260\301\204\365\032\210\f{%\325\002P\350\325\304\274"
+	.ascii	"`\213\\\206~\031B\\\272\247\232\236\242)("
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.168.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`r"
+	.string	"}\b"
+	.string	"\"\21765Po3\006\203\213\250W\315w\225\210w\024\253%\371\335\307\371&\250M\257.\b\262\235r(O|,\267:\314\252\252j\304\020\330"
+	.string	"q\376\020\035\333\354\366\2262\245\3156\f\035\316G\313f\306\231\237\216\202gf\033hn\002\2525,l\363A\323\266\211\241F\266.M\315|%\252\221\354\252\211\bn=\332\304GR\207o\004\364\002\301\261X\261\016#$\242\275\022tRT\2076\270R\361\306*\345\344\340K\231<\266\264\250.J\213\326\326\377W\232Z\f"
+	.string	"FF\311\036\310_\261r\271\352\022\321h\353\372\3440d\217j\300\024\307\177\314W}\n\265\230/c\345Z\024\243\300\013\204\200\024\037+\377\247\2740\347\310\325\356p\306#\211\0341\t\377\033=R\311\225n[\320\326\240\365@\025"
+	.string	"2\241Eh\340\270XpW\307\342\005\023\364\331\240~\026\301f\300\b\330W\347\342?\273o\026\034x\365\312\362s\301\202P\206_\232"
+	.ascii	"\347\334B\230O"
+	.text
+	.section	.gnu.lto_changePidProfile.169.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\351\001\205\022"
+	.string	"\306b{H\320\016)\035n\321~\331\217+\007\"|\b<3a\250(\031Y\300-\214\362'\313\301\252YbZ\365}\207\304o#\022\017\311\035?\346\257k\271\302hqR\301Q\301\347\002\023\342\354\177\034\202k\370Q\257\321\270\255\224)\005a"
+	.string	"a"
+	.string	"j"
+	.string	"3\347\340\021\t\2468\201\243\004\320\315\310\343\322$\030\227\255\017\370.S\017\360]\372A36\353\362,\273#\303K\325\376"
+	.ascii	"\251]G\363\316\271\023d4\347\316\303\034\030\227\256\331)\276"
+	.ascii	"\313\315\215\243\037\033\236\323\234\023\\\f\257]k\376\201\236"
+	.ascii	"1\342\320\\U#sN\353\210\223s\357m\033\260\255b+\203\253\275\356"
+	.ascii	"\036\021\265g=\355K\355j\317\273\261\260i\224;pLKS{\366\316\246"
+	.ascii	"{\301~j.\217\235R\257\244Zu\335\237R\365\246\324\252\352\263"
+	.ascii	"\004\374\234\310y\204\016sJ\210r1\225$\322\217\037t\336\3145"
+	.ascii	"\370C\263\\\022\353\322v\255U\263\2338\347\215N\272\003\227\256"
+	.ascii	"\233\227\352\205\374\3357\0042\276\217M`\372\021\366]*\324\270"
+	.ascii	"\302\027\272\016Q\005\243'\025\242\366D\310lRn\204\360\020\261"
+	.ascii	"m\022\001\361\242\224pe\345\273T-\002\023#\005\336\025\220\300"
+	.ascii	"\r]\243\351\326\342\306\002\323\367Bo\211\273E6/\304\236\335"
+	.ascii	"r\"Z\201\334\234\363\345{\370\007\231\357si\0070\372\361\322"
+	.ascii	"\207\371.]=:\242F\371@\177\017\356)Vq\235\204/`\214JJ\310\262"
+	.ascii	"\021\226|~\201|\204\230\210\204\200\2704\036\304N\\Hb,!\212l"
+	.ascii	"\266\340$|\001`\230+%Dq\221\301@\030\n\350\022\232\264\200\260"
+	.ascii	"\031\f\350\"`\331Kl\006\306\310d3\220\265\023\237\232\313\223"
+	.ascii	"\201\213R\022\327f\r\335\265\033\224\350G\267j\226\306\272\273"
+	.ascii	"\0366/N\373V\253+Q\334vlPK\252\365\217\216\024& @\002B\024\204"
+	.ascii	"\346\001\305X\260\375\325\"8\n]@\201\321\"\367\036h\251\005\301"
+	.ascii	"\037\304\n\020\234\320 6\342\020\020J\315`\025\006d\025\3020"
+	.ascii	"\020\006VOt\262\351PN8\230\250)\320\367N7\241\215i\317\214\374"
+	.ascii	"\005X\001\333\26319\322BR\024\rE6g\2079\260\334\036T\334\342"
+	.ascii	"\nO"
+	.text
+	.section	.gnu.lto_beeperOffSet.170.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\r\n"
+	.string	"F\223G@ \307*\035"
+	.string	"\213\200\004\022P+\220\215\316"
+	.string	"\030\037\307\220\030\020ITR\253\005\3276=\b\034\374Gl\301\264<\3110\320j\232\020\002\220\354\347n\321C\323~\246K\374\274L\3276\310&[\246\0242"
+	.string	"3"
+	.string	"4"
+	.string	"\237\017g\350>\271+t\237\016\355\004\037e\353@@\300\252\266`w=Y\362\360\032\372_9Fl}\\\017.v\327*\266\\\267\274m\b\333\026\366\021\002\334\356\256e\314>\355\347T\255\252~\267\220\302r\235e`\027\344\326`m\263"
+	.string	"\212\355g\354\315K\342j\177v\225\3604\2241\273#\263\001\273\343\204#.\001\n8y\251r\"X\205\250\364f\333t"
+	.string	"\250\313\356z|\226\267t\370'\237\3668\351\305O\377\324}^jLh)\275y\003\0239\260\312\300\036U*I\354\007\366t(>\240\212O\207\223\240a\002\2158\177\234\fQ\210\004~\336\027\362H\"\320\310\373J&\217\323`p\003\243\344q\200`\311\313\214\251s+c\306\300^\266\224TYe"
+	.string	"\224FV\273\030\f"
+	.ascii	"\002Td\342Q\320h\270\230W\205\004\004\263J\234\341\025\213\343"
+	.ascii	"\202\241\265\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_beeperOffSetAll.171.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\035\n"
+	.string	"\346\223G<0M\225\016\003\373\024q\300\221\222\326\032r\031y?\213\036\331\222\371'\215?0\262\200\032\372\212\332r\200\334a\311\t\341`@L\037\343\023\036\360\376\364\303\216M\025\355\361o\"eJ\0015"
+	.string	"3"
+	.string	"5"
+	.string	"\017\254\273\245\f\036vA\003&\300x\264g\2178\210\332\307\207\016\"\016%v7\323\t\367\236\236\177\fo|#\317\223\002\301\356:\277\021\351\326\333\036`[\201}F\246\n!6M\330 (U\202\375k\365d_\365GM_\231\326Lg\246\317"
+	.string	"p!E:\204p7B\330ZV\004A\301\366\0356\304\023\311\264#\022\357\252\33478\020\200\332\335\211\257\341\240\306O=\232\323\311\177\217~g\361\030E|$T/=\366T\325\307*T\272\026x\352C-P\206\216z]\254D'>\031\032\022\236H\"\224\312\001\212\004\253\330`8\\\202n\313l\333\002\2075\214\301\305\202\341\264L\263d\230K\245A\246u\232\f\013`.\263u\331\206\343\272\314\001~~\255\236\032&\013\254\217\202|\251\035\f"
+	.ascii	"\221\223\340Lh\006\n<\343w\320\305j\245\006\021fx\256\341o\230"
+	.ascii	"P\300\324\020p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_beeperOffClear.172.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\214"
+	.string	"m\n"
+	.string	"\006\024JB \213*\035\300\022H\030*\324\324\001\270%\260\025\017\t\331\b\220\006\372\353%\345\002\323\324\261\005>\303\026\020|(1\312cb6\001\022"
+	.string	"9\342f\3723\207y8|\t\257X,\003k\033\331D\312\224\0024"
+	.string	"4"
+	.string	"7"
+	.string	"\316\240<b^\241=f\237\320\036\355\331\037\036\266\366\002\203\006\324+\304\356n\252\340\336\323\363\037\341\225/5\3409\t\331]\347\227R\335z\333\030\266A\354c\002~\266\273ke\331\007\377\230i\315tf\372\023\n\007\026T'\300a\267@l\304\302b\206\006\266o\2615:p<\355C\270\313;Xre\027\001xa7\354\bW\325\350\001e\340\2241GM\325^\250\003\366\350\024J\224\335\335\370\022>!\200\317\340\321\002H\371\357\321'i\217\327\313\002\320\2241o\254\036l\330\024a\207\247\324\004\016\336h<8\235\017\216&#A2\352\2002s\231\221\217'\324q\033\347\331B\237\016h\343D\243-c\341\256DD\264\001\350:\321f\tM\317VY\256\254\\0\223\236\254Z\241ti\275\376\201H\r\r"
+	.ascii	"\002Td\342\221\320hx\314!\204\004\202\tA\234\236,\020\252\265"
+	.ascii	"\317\005ok5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_beeperOffClearAll.173.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 \371\335\006"
+	.string	"\"\31506@o\222\016@\355$0\253\211$^\370\316 `h\200\207l~\356\236\270\003\364\rm>\267k\025-\360\202*LQ\024\327\302\013\036\314\313\215$\260_T\323\204\310\024_V\203&\263\301\256xe\342F\263\340\020\257\f\"Z\003c\017\fY\214\300\260,b\272\255Pt\t\231\2246\350\371r\252\227(\b\247\200\224\231\t\327\243\037\023W\243\324\024\235W\256\324\355T\245,\223\312\366N#\204JN\362\261|\347yp\364\005\310\314\034\212\036\np\240\200z!\222\211qj\311\022E\262\361\027\263\366)\355HI0b\262\bY\311\314\b3\252\365i\267\035\275p\237\212\276"
+	.string	"\205\314\374q\037P\207\375\r\376\203\177\024\007"
+	.ascii	"3\001S83\370\370\032\273\f\3622\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_getBeeperOffMask.174.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"M\007"
+	.string	"\"\31636@o\323\001@\375\304t\306\013\317\361\324\270\314\\\337\317a\347"
+	.string	"\357\363\217\307d\020{\326\t\271\262k\031\303E\201\206\303\316N\2439\263e\024\3706\177\332D\312\224\002\2760\017\232\314\006\273\342\225\211\033M\003D\2742N\304\020\030\213p\310\242\004\206e\261\362\266O\253\"\253\265\351\3076\347%\023"
+	.string	"\273\027\t>\311=\n\037\344\320\025\235<w\350w\250\303\324\202\017\322\226\237+\216M\026\333\373\244v\330\237VE\266\323\251\002$\215\320A*\273\033_\313\242\300\223\221m\217]\371!\027\361X[\300\330:\004\223\224\214\322\312\256\027\255\017P\207\323\003\250C\365\270\366\324\374\217\234\241\004\372\270\316\342yQ\330]'\327\205n\275\355\003\333\006\266G\001\b"
+	.string	"\013\013=\263\030|\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_setBeeperOffMask.175.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\335\b"
+	.string	"6Q@:0\221\322\001"
+	.string	"\343'\212\023\257\0035\205\236\201\327zh\347\354\346\343\304u>N\233\307\266\230\251^\261\274\254G\204\202\202\002\225\252\333338\241\"/\345h\0031\262\311\336)\005-"
+	.string	"/"
+	.string	"."
+	.string	"\333\007\270S\213v\314\307\327\036\254\320t\240\310\354n\235!\027/E\377\262w\251\025\307%\300\304\356Z\246V\254{\336\266\202m\t\333-\001\366c\277\334\bd0\326U.\273\252Z\315\316(\213\210\355ol\206\230\303\245\375\221\223\210\217\231\334\355~\244\250\354\216\017^\b8Mx\001w\032v\306OL\b\257\335\355\370%7\321\360a\247\336(\311\247N\375\022w\352\301x\234d\315\r\255\231\227\2254{D\311\tb\177\333\335\365t\005\356p <_\204\207\343\tX\220\276\320f\320\253"
+	.string	"}D!X\301O\025\201\276P\005G\244\352\0318\274\240\030U\2140\034\325\315x\372t\271k\321f\247\211\262\234\001\b"
+	.ascii	"\002TdB\223\3608\001\027\342\\F\261V\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_getPreferredBeeperOffMask.176.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"M\007"
+	.string	"\"\31636@o\323\001@\265*@\032\235Pe\312\020\221B\352|\016[1\200\302?\036\223A\354Y'\344\312\256e\f\027\005\032\016;;\215\346\314\226Q\340\333\374i\023)S\n\2762\017\033\r\007\273\342\245\211\234M\003D\274\262N\314\020\030\213p\310\242\004\206e\261\362\266O\253#\253\265)\310v\347%\023"
+	.string	"\273\027\t>\311=\n\377\343\320\025\236<w\350{\250\303\324\002\217\221-?W\033\233.\266\007J\345\260?\255\216l\247S\005XNB\027\231\354j|/\273\002UH\266?v\345\203<\344cm\001c\353\020R\276\214R\313\256\027\255\017P\207\323\003\250C\355\270\366\324\374\213\234\241$B\341:\213'Faw\235\\\027\272\365\266\017l\033\330&\005\b"
+	.string	"\013\013=\263\030|\205"
+	.ascii	"]\303{#\\\026\202\fw\305\324N2"
+	.text
+	.section	.gnu.lto_setPreferredBeeperOffMask.177.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\365\b"
+	.string	"V\021A< \005)\035"
+	.string	",\t\034\r,u\230\214$l\230\313B\260\335\252\217y\304`\303]\326\355\30061\203\317\221}\253Ot"
+	.string	"`\240\b|\344\336\235\351\371x}\210\211\232 F6\331;\245-"
+	.string	"1"
+	.string	"."
+	.string	"t;\001wj\321\316\371\030[\204\331\207G\314\316\356\326\211r\361R\364\337\362\216\325\352\270\f\240\330]KV\313u\317\333^\260=a{\026\363e_\366\313\255\300\006\307\365\020\235]\220Z\200\245\321\031\025\333\367\330\r\"\017\227\366W\316\"^\226r\267kB#\263;B\230A\340T\341\006\334\003\226\323\3268L*!\266\273 \337\345/\033~\312\2519P\362\254S\037\305\235~7#*Y\263\003\214\244f%"
+	.string	"{\\\311yb\177\333\335u\006}\"\276\220\304\367\361\006.N!\322f\320\263\030\211J!XAQ-\215B\244\n\232N\325;p\210Qa\252\031ah\252\236Q\365m\347\313\035\254\204\246\232\253\b"
+	.ascii	"\002Td\342]_4\001\027\342\\F\261V\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_setPidProfile.part.0.216.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\260\002U\025"
+	.string	"\346e\210J\260\022R:*\206Z\027\300\206\020\276\023\001I\210~\240e\016\300\220\001F\254\325N\251\257CL\330\343\276-u\203?\312\302\326\327\356\2131\177\352\217\261\366\025\322\314\017\322Lp/\210\235\003s\3107\300\347\326\321g\277\344\357\235Rh"
+	.string	"w"
+	.string	"w"
+	.string	"?\233'\271j\2002\261\2733\352\237@{\346\237A{f\340\2157?\267\307\347\200\215\223J\217d\223[\360\306\033\327\335\240\247\250\335\023\301I\223\310N\332Ga\033\350\343\240\215\343gqcF=;K[\273[\236\254 \036|\245\257\240\377\363"
+	.ascii	"\210?8\257\001~\200Ni\177\305\024\354\256e\030n\362\266o\266"
+	.ascii	"\327\2469\002Cv\214\272Vjz\244\377\262\021\0032v{\272~\254\007"
+	.ascii	"R\312\210\005\357g\236J\216q\030\005\005\264\357\265\033\316"
+	.ascii	"\342\005\235\263\304O_ac_\255@A(d\242\304aG\304\326\356Y\236"
+	.ascii	"\364)\243\366}\245;\375\236\3447\305\250\240\2005\235s\177\022"
+	.ascii	"lm\035\225\234\264\3610\371)\276\364\273\nO-X!\020I\r\3430jE"
+	.ascii	"v\262\366\001\260\223\257\213\300N\372J\001=t\b)\027\f^=\026"
+	.ascii	"\211\023N\225\253Z)S\177\241{1M\330\311ZU\256\210\031\356t\006"
+	.ascii	"UBM\247i\r}\360|\310\242\365L\257\ti\2557v\202\204\034KXU;\302"
+	.ascii	"]\334\024(\356\356\211\337\342R2~\321I\357|\364\304\223\276\017"
+	.ascii	"v\362\347)\326\021V\220\261\203\220vy\006D\350I\247]\rIX\270"
+	.ascii	"\312\n9\216\260Z"
+	.string	"\312E+\221\353\353\257\335]\327\206\201\261\265\2304e\r\314\213\031C\300d\201\371\344f\202\202KA\271\331h\022t-3+\272\030\323e\327k\320b\322\bp\316\366b\272\314\354re\316\245\2341q2e\256\347+m#\336\321\350ze\315n\327+g\266\351_[\207\f\301HCXs\\k%\262-Bk\265\035<\240'\272\246Sq\034r<aU\253\037\343U<\277\310,8\334\f\342\016\237\351<\262B\004< p\002\031\263\235\003\336\332\2133\233\375\334\021\254m`T8\353\310\214\216\005-\357\324F\365\215t\3128\201L\013%c\200\032dk\302\264\344\201\325&\212Zy\365\351\272\314-\005@\220\373\036\f24X\023\321\031f#HA\226]\352\260\320m\006\210\335\276\035\023$!\330\240\211\330\344\f\026'\b\2607\200y\263C4m6c\320\006\264\265\354\360\f\355 \364y\300\332bM\331g"
+	.ascii	"\250\27509\215\323\257\rc"
+	.text
+	.section	.gnu.lto_CSWTCH.35.242.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375 |\235\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\346\377\377?"
+	.string	""
+	.string	"\200\340\305\333\321\001\317"
+	.string	"\005\001\006\035\001\002\354\233\211\203\001\360\240\242\304\210"
+	.string	"?\202\210\200\030\177\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\b"
+	.string	"\200\020\330\0072\003\304\001#\b\225\037\260j"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`*\bm\031"
+	.string	"\306\247\220I\200ZN:P\270\317a\212\355\316\324\252\277DC\327CQt\213>\305\323\350D$\337\317R\301f\203A\210v\320\345\227\265;\031\344\r\242S`\035\270\235\317\361\026\333G\217\226\317\243\350h\022\322U\375I\202i\021(I\332\001|"
+	.string	"\203"
+	.string	"x"
+	.string	"[\016\372J\216\372I\214\372H\306\242>;\346\034\215T\271X,\026\211\372\301Q\035z\032\241\257\221AW#\201\372G\306\237\267dz1\322\367\241O_\253\247od\3449\027\331\240_\204A\237\310\250~-\350g\215\n\216\203L\360\256\2576v\276\203T\201@\325\013"
+	.string	"\202\276\333xUU\325\003\375!\003\f\234\ny\357\035\201\302\257{\373^6\253\357\214eu\025\350c\215\367\336"
+	.ascii	"\004\002`,\372[\226\372\\V\364\205J\3750\025\375*)\372VP\364"
+	.ascii	"\257\\U\325{uN\364\261\334\304\035+q\307\220\270dF\\7\021\317"
+	.ascii	"\021\342U \256\343\303y\220\367.\375\226\232~NT\036n\325\341"
+	.ascii	"=8\374j\303}h8\0202\303\203\220\367\326\230\372QA=9M)=I\355\334"
+	.ascii	"\25770\\\310\205\376\024\013})\025\372Q(\364\241L\350?\221\320"
+	.ascii	"w\022\241\337$\351bH\b}&H\375%\017\372\001\\"
+	.string	"9\366\337zC\323\206#\236\357\030\312Q\354\2570\314\206u,\320\3115A'\233\255\320\311\271v\350\344\334Jt2\256-:\271$\032\235G\347\025\236\214[{L.\203l\362W\037\223\223~L\306\265<\314\277~\030\252>\230\251\376\027\032}6\251~\227\031\375\266\250\276\027\031}\262\030\3751\030\375\262\027}3\250\376\231\213~\332S\337\253E\377\313\251\237\245\251\257\205\251\0377\307\256\3450n]\363q9L}\\\256>~\353\343\257>~\360\177\323*\232\365p\324p\270\354q\331c$\263\307oyi<\036\337\254e)\357\206g\312; \232\262.\310)\347R\276Y\312_\317R\264\224\231\314\330\240\254\323\016Q\026 \206r\016K\364\255\2746%\246\354M{\263\356X\035\261EY\267\326\264\037U\260\253K\206\262I|Y\205\245e\262\337q\375 \376\247\314\231\200\217\250A\f\007\302\234$)Hi\031\003"
+	.ascii	"\003\231\251J\007\021\240\220\305\024b$\220@\302\031\fz`\226"
+	.ascii	"\251P\224F_F\001\321fd\254\254\001\206\0310L\342\tO\210J:p\017"
+	.ascii	"tX\334Y\215\222>\363\256}\006`\235\027\025\362e'r\321B\342\242"
+	.ascii	"-\262\365\273\207\353\265\263\354\375\347\222!M9|\"d\233\250"
+	.ascii	"\263\"\213\217\3025\363\206\275\336\024\350\023\275\360\271J"
+	.ascii	"\364\340\247\242\026\265\250E-jQ\213Z\324\242\026\265X\375U\347"
+	.ascii	"\221\261\365\3100\262\330\301\270\312\320W\210\235\3145\027\216"
+	.ascii	",\033`M\222\210>^\3461\202\247\307\244#\316\002\233\260\353\f"
+	.ascii	"\376r\007\345\271\373\313\334\2656]0\262\3272%\273\221]\032\374"
+	.ascii	";\013\f7\3379\345\2533\334}\332\003:P\271\302,\001{\035t\305"
+	.ascii	"\005\"\222M\032V\254\002"
+	.text
+	.section	.gnu.lto_.refs.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`>"
+	.string	"\035\007"
+	.string	"\266\0201,`k\222\016\220a\006A"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\005\260\211\346\321|\036E\321\370\3674\374n\261g\372\277=\275\375\244\355&e\n$"
+	.string	"!"
+	.string	"$"
+	.string	"\367d\372\242\336\002\360\223\344%I\217\250\207D\272RG\215\273~8x\355\006\217\024_P7\343\363<yN\004o!\361N\300K\254\347H\277\271\327\034\317\334[\216W\216O\022\237\334G\307\037\367\216{u\374\271o\002\366\024\343\222\275\304>2\376\260+\352+\324SPz\207\322#\213\257\365\215\305m=9>c\3611.\326\001?4\242\020u\250\225\323\266\241\f\275\233.TS\205\004\204\003\003\026p\210\240+\f3\3340\274\230/\034\002u\3108\360\034\013"
+	.ascii	"@\004\334\27546SD\317\240\317\314\n\264\017\323\207\350\026%"
+	.ascii	"\016)\207\265\\\026"
+	.text
+	.section	.gnu.lto_.decls.3ce16b97d0fcef2,"e",@progbits
+	.string	"(\265/\375`\\\\E\210\001j\215^\217U JY:\215\001\276ol\3346]!\346g>\274\360\300\2109b\020\242\033=Zng\301\210V\242z`\310$^\202hX\333<h\320\003\304\253K\234\240h\333\266\t\301>\357\263\376;\366\337\341\256*\244\247U^\303,\313\363\211\215\251\252\332\312\275\267\224R\246\304\007\342\bO\t\250\375\373\263\031\320\020\214~\323\240cVp\264\271\371\232\210\276\306\241\377\333\264\033\321\002,\357\346\3332)\027F\217\323\317\206z\362\"\026\205L\263\356\226\271h\356\335=s\315X\346\265\273d\364\354\256[\\s\357mw\237\230i^\273[\345\216\301K\267\007,\351b\365\354.\224\013\303\312}m\247&\020J\256\270\264\366\366^\022\355"
+	.ascii	"\261\202\373\322\223\237\356i1'\233\262\251&7?\035\243o\261\\"
+	.ascii	"\341\361\337/\327\313\rs\351\356\334\225\263\314\013\346n\371"
+	.ascii	"\235r\251\374b\t\363\225%\314\r1\243\013\346\302\3358\274\024"
+	.ascii	"k\200\027\030\230\253\205\211\r\255\337\b\314}\233\300\326\033"
+	.ascii	"\255\241l\327\367EJO\376o\227\337\270\377Z\271V:n\336\240\320"
+	.ascii	"n\276\\\214~\273\2342\340p\200\335\254c\203\320\247g\372i\230"
+	.ascii	"~\212C?U\352\243o\364\321;}\264\213\336\321\242\255\322\n\241"
+	.ascii	"\027l\020zt\251\217\022\321G\277\364\321\032\372h\225\376\257"
+	.ascii	"\023\016\032\252\212\223\26266[\326\304.\355\346\377\262\335"
+	.ascii	"\265m\226\327us\023\035\252\032ve7\037m\322\267Xl\310\370@\005"
+	.ascii	"\326\274J\254\257\346\325\361[\275\035RM\345\215\254f\226\f-"
+	.ascii	"1\313\005GU\323k\305U\322\240qYT\365\0203\373\215z\274iN\371"
+	.ascii	"\360\313\301\242\271\367\322r\331\262j\202]\036=xo'?\261\253"
+	.ascii	"Uc\306\235\301e\365\356\220\373uyX\271\254\234\344\257\271\367"
+	.ascii	"V^\361h\006\271d\227\311Ur\211\\\265+v\321\256\331=r\2317\355"
+	.ascii	"\"\271\313k\344\n\271I\356\331]r\213\334\262;f\231w\310\365\361"
+	.ascii	"\373\343\206=/-\227\337!\267\353\302\300K7\255b\311T\263\354"
+	.ascii	"\016\271@.\005\243)%HA\367\243\271\367\276-\373\257r\310\215"
+	.ascii	"a\353z\232\226\333J\004\267;\261\261\275\227DDDzKL3\254(\377"
+	.ascii	"\324\242\363\023\033\204\376|\242\177\262\351\237\314\313\243"
+	.ascii	"\356\214W\233\227\233\177.\321?\203\3507\255\020\3723\207\376"
+	.ascii	")C\377\\\241\237\331\350g/\372\271\212~V\323\317b\372YKw\310"
+	.ascii	",4\bn4\b3\372\266\270.,\223\303}q\033\306\372\375tZ\356\345\336"
+	.ascii	"K\237\013\346\307\266\344\346\343/\372\226\003\212\377\376,\007"
+	.ascii	"\364\270M\037\027\321 \330 \364rV\b=\346\322\307U\372\267O\177"
+	.ascii	"yW\\(\236\271\026sWn\276\bwO\315\365Y\211\371\275\261u=M?\373"
+	.ascii	"\211\256\352\303\205\262\177\266\016/\305\322&]T\315\275\227"
+	.ascii	"\267X~\243\013e\325X7=M\313\335\204.\311\212\221uQ\334\250\253"
+	.ascii	"\342\246\270R\226y\241n\323\257\323}\"\"\"\032\302"
+	.string	"V\252X0w\262\375\262B\250\320\233\376e\242\177\207\350\337/\375c\205\320\337,\375\3335\267n~\233g\323X\276\r\310\0311\"\346f\273g\333\334\362Y6\333\362\215\260\265\267\223\345\363\351\333\333\311\307\332\f\254\315 '\351\002\322\206\346\337\026\332\352\031\335\256\311\211\322$\263\272\371\247J\333(+\204\002\3415\235\362\244n\334|w\311\306\224U7\337\366\351\377\326\316\236\261L\213\306\2221\372C\370`\321\3302\266\256\007\357m\203Ll\357%\032\013\306\216\351iZ\336$U{c{\357!\"\"m\266\202\b\034j\206\347\r\2227V\364\255\023}\213D\377V\214\245\263s\270\257\256L\230\233m\030\243[1\330\355J\212\276\233\257\rBo\203hl\203\320!+\364E\016G\211\021\030n7\377\026\216\213\355b\275\334\255\23670iJ\033g\325\232\360ps\363\355\f}\267\025B1\260A\250\335bt\013\007"
+	.string	"(oSnNm\220\226,\371\355\312\016\357fk\305\276Y\246\315\362\333+\026\313s\332\326V\333{\363\350x\271\2559\335\214\201\025B\263\rBM\354\275\267\375\033\232\376\375\375\375\331\277\241\277\255b\251\334?/0\\\334<e\310\207\210\027\033\337\315\267Q\372\326\f\212e\353i\372\331\273\013\210\330\336\373\"\374FQ\354\322\262\341\245\330\336]S>@\263c\376\355\355\275\377[7+\3052m\024\333v\353\304>\271]\022\021\r\335\2529<\031h~\005\264\335\262B(\006\033\204~\001\372\267i\366\314\232\331\265\r\354\r\265\367\236\300GH\214\255\266\233\355\022\253f\231\026\330&\017\341\303qS\332.\333{\351\223at\361\n\273\371\006\320;D\267L~\201k\177x\216\276\265"
+	.string	"\265\177\326\002\324\242\031\335\246\005\241\312\254\345^\333{\373\350@\271h\013\273\031\307\006\241\277:\307\006\241w\263B\350o\225\374\226\314\226Y\200\243\246\266\366\332\336K \237%\f\252\0347\177i\205Pm\203\320\333?\273\3711\na\256\006\360\016\f&\003\307\360\347#\277=\263\025\342\267gl\030\340\267f\264\bpC\3301\037n\f\017/>\260c\216\363\237\034~k\346\277&\340\270\377\034\256\325\005\266\001\377\r\342.\277\325\366\004.\017\372\317\t\272n\223T\320E\201g\274]\025>\270\306\365\300Eq\352\334\270Ogz\223\031\270"
+	.ascii	"\020\354\003\307\370\257\bW~<\343\355\277K\226\310-\370O\214"
+	.ascii	"\255T\371\355\360\267s\377\r\201\r\262\375\230\312o\235\374\266"
+	.ascii	"\355\267^\016\200\247\374\026\312o\335~\033\345\311o\251\224"
+	.ascii	"\200\335\376s\370\237\201\377\021\370-\221w\300\002\226\362c"
+	.ascii	"\266\027\375\371\356\266`\215~\373\341\267!<5\371\261\324\177"
+	.ascii	"\201.0o\025\223\037[\375v\214\332o\217~\013\264I6h\211?^\362"
+	.ascii	"\n~\234\366\343\263\007\340\317\177?\256\200\005\373o\001p\331"
+	.ascii	"\2171@\366[\256\377\202\300$~\234\004\t\005\306~l\374\361\021"
+	.ascii	"\001`#E,\nw\211\310\377\016~{\002\036r\242?\217\271\027\300@"
+	.ascii	"$\020\366\237\205\213\201\357\374\231\356\267F\374\303\ni\371"
+	.ascii	"\355I<\372\347*\330\307\177?\334L\226\362\377\314\1773u\377\305"
+	.ascii	"4\257\377\f\366?\356\277\020\370o\n\030\354\177\224\377M\376"
+	.ascii	"K\371\277v,\327\001\371\005\356q\235\377\224q*\230\007\333\233"
+	.ascii	"i\370\353\354\362\333\374\333\364\267\350o\317\337\352"
+	.string	"\377\366\375\347\373\237\376\247\033\274\003\353\320\371\361\317\217/\374\277?\312\341\277j\377m\362\337\265\3772\371/\333\177\235x\375W\310\177\227\374\027-\307\177\236\037\035\300\217\273~\214\343\3077~\\\343\3074~\234\365c\027?\306\372\261\362\307S?^\361c\250\037\207\340\307\311\037{\340\307\307\037#\375X\375\261\360\307\032\370q\006~\\\201\037\253\360\343\021?\206\300\217\035\360c\021?6\341\307\"\374\270\303\217\001\360c\n~\034\364\343\363\277~\377m\376\027\315\177\305\374\027\314\177\271\374\367\311\177\267\376k\343\277Z\377\235\361\337\030\377}\361\337\026\377\275\372\257\325\177Y\374W\352\277*\376\213\342\277O\377m\372\357\b\376\033\202\377\202\340\277'\376\333\302\177\231\376\233\374\257\007\376k\374o\361\277\304\377\"\375w\370_\022\377\325\300\1773\360\337\t\3747\002\377u\300\177C\374\327\204\337\206\360[\241\377\036\340\277%\374\267"
+	.ascii	"\277\275\373/\210\377\016\340\277\037\376"
+	.ascii	"\337\375\237\362_\021\376\013\302\177\213\376\313\341\277\027"
+	.ascii	"~\033\343\267y\277m\376v\314\1773\277\265\373-\230\337\236\360"
+	.ascii	"[\272\377)\374\366\313o\345~\253\345\267a\277\335\361\333\343"
+	.ascii	"o\035\360[\024~\213\363\277\371_\356\177\226\377T\376\227\375"
+	.ascii	"g\372\017\367?\203\277\277\277\277\037\307\002?\006\r?\002\266"
+	.ascii	"\004xv\357\275\263J@\002\347\303\345I\334\334\315\237\200\210"
+	.ascii	"&:k63\236]\223\276\230\353\021\343\206U\30323\336\034\221\260"
+	.ascii	"\266\233?\301\016=\301\032\242g4h\362\030\026\b%S\270\264\224"
+	.ascii	"\200\245q\335\374\t\\h\"f]]>sa\357\275\305R\246\224\037M\234"
+	.ascii	"%[\330\335\231\013#\007\f-\005\2167\232\210J\231\227\311cN\330"
+	.ascii	"{7\375\354\247\273/\261\235\225\325\201\347E\031/\260\233/\001"
+	.ascii	"\027M\264'\346b\362\030\234\2759\300\343\312Pugt\350=\217\261"
+	.ascii	"u:e\256\306\224\334|\t\322\364\006lD\317`\230\031\314e\323OQ"
+	.ascii	"\333\tG\tH\250d\371\200\347\252\217-\357\346K \246u\037\321\263"
+	.ascii	"\027\313\314^\362\334\bG\334\356\304N\036l6\316\344\271?\313"
+	.ascii	"\345/w\355n\r\261a\345\346\036+A\226\336\020E\364\334\345\226"
+	.ascii	"\231\273d#\372io'\031\035\224\344\231\311\333\333\312\254\017"
+	.ascii	"v\216\314\230\001w\363%\200\322\307\202%oA\367\266\313-+\345"
+	.ascii	"\316Rv \212\313\222\341\262\344-v+\367\316\332Mx\037\360\362"
+	.ascii	"\224\035\376\254\3052\363\226\223\214\3122\306\315\327\263u\377"
+	.ascii	"q\316\2565g\244\334|\2415\372B_\364\007Pnn\371M\013\025\355\306"
+	.ascii	"\315\2126V\236\337\320\035Fd\370\250\202N%\021\243\244\n\025"
+	.ascii	"\035\260\026WY\356|h\250PBe\212%\223\343B\313\030\363\346\013"
+	.ascii	"5\321\026X\021=?a\346'9\212\213\021\212\314i}\240\275\304b03"
+	.ascii	"\224\005L\201\325X\246hwnVn\276P\020\375A\030Q^\222\325\236\231"
+	.ascii	"\234In\323{\357\246\345\266\312P\304\311L\336\336\316\312\352"
+	.ascii	"\240S\246F\324\026\266\347\266\243\331\331\025\3442#L27_/\257"
+	.ascii	"\375\307\301b\244\224jkMv\212\3349\035\231\222\362\361p\nb\231"
+	.ascii	"\231i\333\376\337\312\324\235\232\233\217\341O\377v;)\367\336"
+	.ascii	"X\347r+\237v\320\337\336\236\326v\370y,\266\032\374\317\370\277"
+	.ascii	"@\013{\243\210\262\267\367\266j\364\020)N40\330\247\2342J\215"
+	.ascii	"\253\311\004\256+(\256\030Qj\\W@Qj\\\273\t*\254\tH\271\271\232"
+	.ascii	"\242\324\366\006\202\202jR\300\326U\224\232\323\006\212R\333"
+	.ascii	"W\033\305\334\225\335K\256\246\r\265\265\2016\324v\332j[W\030"
+	.ascii	"DAq]E\2519]\001E\251q]m5\256\375\263\241\234\224RP[\t\264\325"
+	.ascii	"\270\360\266\332\326\325O\224\332\326U\224\032\227\026k\266b"
+	.ascii	"\214\215"
+	.string	"\027P\366\300hX\034QP\273\212J\313I\371#\027\265\334\332d\366\266k)\266r\313\355\255\301\336Z[J2N1\254\333\223\\\325\323\023\247-\273\334{g\240z\352\332\332PrMv\313E\021\331\332\233\310S\322\246\332{\357\021\232\226r\233\207\225k\312\241\265\247R\354\255a/\367\246\332\273\311n\271\275w\323\336;Uj-\367\236\361\023%FE\265w\326\020\325\326j\232\222b\357\273f\306\355*J\255k\313h\nSMl\253X6\331\250\251\255-\266\311p)\265Z\023\332\236\332{\3334Z\354\252E\336\315K\fYG\252n\316K\024sa5n>\006':\233-}\244q\303w\3631\234\351\\\226\206A\221\303\310\315\307 D\347$8c?Z\354\270\371\030b,u\334l\260\271\2709\037\261\202\244E\326\315\307 \245s\221\254\242\255J\307\315\017\342\023\222\207\344\264\215qav\363\203\316\b\001"
+	.ascii	"\026\242g\261[f\026\313XX%\2349\201]\311)\302c\357\306\315\017"
+	.ascii	"\312\242%xC\364\314\30323\217\034f\233\224vo*L\300\232{g}`\315"
+	.ascii	"\254\230yr\363\237\177<\207\375\271G\006\313_\036x\223\344\312"
+	.ascii	"\315\331\207\321\363\017\035'p~@n\016\262Ah\316\266B\250\335"
+	.ascii	"\262A\350\203\206\350\035\3151\264\256\233\037$C_\004\257\374"
+	.ascii	"\"g\365@\375l(/\033\271+\347\310:,3{e\031k^\331\205\327\215\246"
+	.ascii	"W\236\221\271\360RL\263@\361\325$\322w5\210\254\320\031\307\016"
+	.ascii	"\2144<\0307?h\305\215l\3032\363V\326\372\207\0323\304\2662\215"
+	.ascii	"*XG\222\234K\306Z\374\241\371\027\302\350_\270\242\177\341\211"
+	.ascii	"\376\005\246\376\005\0379\006\316\326\214%N7\377B\216\f\343B"
+	.ascii	"\r\375\013T\372\317-2\326VZ\037\212\233\257,\2148.\276\233\017"
+	.ascii	"\364F[a69\n\243)#\360T\327\314T\271*+-3[e\251\347\025\231\005"
+	.ascii	"Vc\205\365\3164\261\032\253<e\327$\3121C\307\247C\347\003\331"
+	.ascii	"it\313\n\241\007c\203\320\003\305\351\034\365c5xMV\301\201\227"
+	.ascii	"\037\233\233s\nT\213\2629\346\346\0039\321\377\363Sv\312\033"
+	.ascii	"\377e\250\334d\231\031\005\366\313(\260\033\353\005\243)\265"
+	.ascii	"\224'8L\366\306\213\230\335\213k\356\275\314(p\337\226&6k\323"
+	.ascii	"%\243\300|Mx#\220\245\201]\331\333{9\344#\206\315\232\226\236"
+	.ascii	"| \032\372@Q\372?n\364\177\232\372?q\372?O\364\177\212\350\377"
+	.ascii	"\360\320\350\266B\350\177Z\350\313\331 4\203%D\307y\267L\234"
+	.ascii	"\207\233&\254m\355\026 \2064e}\220r9\263\301\334|\237=\274f\026"
+	.ascii	"\0163$7\337y\200\255\354\357\346\373\314\2419S\006F\253\351\346"
+	.ascii	"[,b0\231\036\234\275\271\354\354p\235e\3423\330\314\363r\237"
+	.ascii	"\301e0\231\024\n\332\033\"{>_\256\352\272\320|\0372}\237\036"
+	.ascii	"\035\360\030\034\250\245\017\216\23045\326n\276\017\016}\237"
+	.ascii	"\024\372\307a:\264\021\3634\006\206\316\214JF\324\315t\227r\257"
+	.ascii	"\027<\033{sER\262+]k7\377\370K\\O\213!e\244n\276\b\\\326\342"
+	.ascii	"0\234\255#\200\362Nl\314\013\226\263L\034\207\273\330\345\336"
+	.ascii	"K\035f\204\313\0324\277\207O\277\207\214~O\026\375\343-\230\312"
+	.ascii	"\336\226&p7\013\301E\214\256\322\360\215\335,\264=15;\261\245"
+	.ascii	"\255\273*\023\013\222\206o\017\223\225\365\031!\2710\336\340"
+	.ascii	"7\314\206\265`)x\n\256\202\241`+\370\tn\303Wp\026\034\005;\301"
+	.ascii	"X\260\233eb*\230y\334\004\257\215I\021\201\nf\202o\364@-\367"
+	.ascii	"\225\016\025Z\032\276\275#Mi\266\356\007\236\325o\224\304\204"
+	.ascii	"2?%\270\310]\220\253\265dc\273/i\370\306\366^\036\233\375F\230"
+	.ascii	"\n>\303ER 8\322\360\355a*8H\020\034i\370\366\366^\3528(\035["
+	.ascii	"4\310V\316\n\241\025\330 \364=b\372=^\372=P\372<j\364y\352\364"
+	.ascii	"y\262\350\3634\321\3479\242\277\366\245\317\243\245\237\305\n"
+	.ascii	"\241\347Q\241\277\203F\177G\213\376\316R\343\"\027\023\301F\216"
+	.ascii	"\213\340!\017\341\303w\240p\221\274\267\223\265\031\364X\233"
+	.ascii	"\301\371\366\303i\t\232\277\223D\177\007L\177g\206\376\016\224"
+	.ascii	"\3761\020\034\326\345\254L\217\233\177`\037\226\211\3030\230"
+	.ascii	"_\030\346a\353\254\\V\tI\332\232{/\303p\217\013\203\355\352\314"
+	.ascii	"\310\336\336\313!\"\242\235?!eM\320|\0357}\035#\372:Z\372\307"
+	.ascii	"_X\007\216\033OXX\275\213\207U\340\245\233\216\322E\265\003\347"
+	.ascii	"\300^\230\013wY&\326\201q\344\345\336"
+	.string	"PFX\007\226\301\242\251\003K\341,\274t\213"
+	.string	"\335T\023\353\300[R:\360\f|\303\312\255m',\020\202\340\330\241foGL\033\2532;\371:)\364s\334`\033\226n\r\237\324\315\3179\2431\r\254e\231\270\306\227<\330\tF\027)7\337v@}:\240\317\231\323\317y\32312\240aa\370\336n~\316\231\346\303-\254\334W~\023\245\t\003\273\260L\374\002\263\300/n\036^\321s\356\355\004El\357M\224\201H\347F\216+)4cA\341=-nNn~\216\327\232\030\246bS\342+\\e\231\330\nOAa\253\035xBl\354\021\235k\232m\360t~\316\223>\316\030}\234)Qw\306ecS,+hTn>\016\233Fm\020\212Sd\330\201\023\323\266o>N\021\r\205\237,\023\243\270m\370\260\223\225\373R"
+	.ascii	"_\037Fq\363\356^\317\2717\227\033\261\275w\006\"\242\234\274"
+	.ascii	"\0363\320\214\233\206xvl\025\271q\363qj\350[?\277\313\246\347"
+	.ascii	"\334{\353N\f\357\373\3062\357\337\355\273\313\275\325\376\256"
+	.ascii	"\233\313\246\307i\271\225\351\217/;\324\354\355\275\211\206\210"
+	.ascii	"p\033\265.M4_\253\321\327r\372\032N_[\321\327K\375\3374\277{"
+	.ascii	"l\354\326\336j-\344\312\310\270\371\252\271z\226\231\341\256"
+	.ascii	"\331>6\357\353\351\352\346\3531-\202\275m\206\226\310\324\235"
+	.ascii	"\206)\261\2654\306\323,\035,L\254\322\210\214\271\362Av\3639"
+	.ascii	"\030\2439x\221\272H]d<\235+Sh\256\020\227k\330\324t\0070\260"
+	.ascii	"\260\232\244\261pf\364\252\220\350\016vTU\245J\273\243J\232>"
+	.ascii	"\035\345\0314,VO\225<zL\344\3148\330\241;@\221N\245S\247\025"
+	.ascii	"\333S\232\276\275)DV8\335|\016fh\016\352\210\376\247)\236\"]"
+	.ascii	"a\323\266\025\206)B\300\256\354Y\021\361\302\226J=]\201\213\234"
+	.ascii	"N\264T\211\222F\335\272\273\030`\322\250T\005\030/5\312\364\027"
+	.ascii	"\021+\0317\237\203\024\232\203\267\277\277\024\252J\032\330\225"
+	.ascii	"\275\236\276$ih\322\247\247P\030l\205\222\251\233\257\227:\341"
+	.ascii	"\320P\326\201I\235\322\246\242Z3\313\325\326Q^j\262\322\235\245"
+	.ascii	"x`\244H\322\344\346o\270\323\034\230\351\035u\203\352\241~\251"
+	.ascii	"\225\241\375\004\265m\360\br3E\367foGiu@\322q\203\013\332w\324"
+	.ascii	"\217\313\037\0237\256\233\257\207c\213D"
+	.string	"A\322v3\332\346(\337\217\223\216\t\003\227v\3637\034\321(\233\243{?\316I\243E\035\221\233\277A\210\376\3215?\316\316\027\227\270\274\233\277\301\207\376\006/\315\341,M\232\022Sse[\244\204\321\272\371\033\370i\016cxx\031/\315\232\"\273\242\023f\214\311\215\233\277\301\030\315\241F\231\227A\357l\332\266J:\035I2\346\243c\315\033\025\232\243w\351\214e[\226\233Q3\250\035O\025\023o\316\356\214\235\321\304H\333\016\353\205E\005V]\226a\225lZ\204\331\240\212\34605fL*d\212\354J\316\f\034v\033\334\320\034P\204\t\223\361\312\246\222`\2353\224]\312\244\321\035\334y\361\202\322\331\237\345\023\335\227\330\013\036c>\346\216\322\345>\036ZP\276\244H\320(y|\221k\336)Y\312a\026\031R,9,*n\276\006q\272\203\270.]P\270\017W;\324\244N\266\325\326\315\327`Mw"
+	.ascii	"E\213\026\024\316\246m+\024\306\324\020\263\261\275\263:\350"
+	.ascii	"\364\270\212s\261\345(\034\356\322c\210\332\315\327\2730\316"
+	.ascii	"\206d\351\270\371\032p\351\016\312\254XA\261X\027SB\224c;A\224"
+	.ascii	"`Y\256\034\305\262C\006\013"
+	.string	"J\2157:e\227>\364\re\366\320\263\0223\2439\274\241B\345\311L\251\333\326\244x\342Es\260\213\022\005u\263i\333*\004K\314\224cg\033\263!RR\216\272\375\272Y\323V\004\212\346\300\345\311\223\274\305\272M\201\211\215\221E\021\302\346\346g\200\24590\211\376\243L\316\004m\263i\333jH\211\\\007\234\267\305+\007\312v\024\347\207\336^\017T'n\006\026\2315\264\t\231\027UaM\206P\260S\202\005e^\037x\313\217,in~\006+\364\020\037\321\321\2644tI\206Z\356+\036!S;\312z\330\336\330P\271\031]\202\201\234\326@Ft\264H\021tiB\326rcU\240\305\033\2541\266\"T{y\226\243\202\312\205\221\233\315.nrE\210\233\233\217\301\233\276\235Cr\347\207&A\215\240I\320#\004\3302\325\245F\tZ\206\222Y&\232\004\035\313\315\25235:\037\2031}\f~\350c"
+	.string	"\246\217\001\017}\f\270\264\206'DG{\240=\320!?)\2248Ua\2224\2672\313\0078y.`\240CP!J4ts7\007\271;\372\322\276n>\006V\372\"\240@P.4\f/\305\032\320\345\327D\305,\023\005\202\202\r\355\350\325h\242\361\343h\230\255\303\251Qc\356\351f\324\207\321\321\037d\256\246\274\270\371\264A\350/\350\323\277"
+	.string	"Ok\350Btt\213\211n\241_v\213= \fYs+\263>\350i\023%J\354\346\035=E\270`\211\273\371\027\300\351\377\250\227e\242:P\034P\250\016\224\013\315a\345\262\366\276\032aJ\2137X{;uRH\332r\376\321\256\2439\376\313\005\223\331\272\021m\204\224\335l\317\214\216vE\271Ir\363/ \323\277\300K\377\202\030z\003.DGk\2405P\033\031\352gCu\325\300)\343\003\210\226\214\372\030B6v\363/p\322\033\334\241/\216\322@_\030y*\223\272"
+	.string	"#\265\346fT\006:#+\006\f"
+	.string	"\324\351\r\364\210,\022\213\2528J\205\252@[\234\220\345\204U\202\022!i\222\024\314\274\233\261\226j0\276\374\3404\252D\255\230\244I\323\207^Y&\252D\253\324x\272\266\244\332r>"
+	.string	"\302\364\001`C\243,\320)t\005*\205F\001`\353\r4\376\216\242\370\023Bw\247\327<\001\363v3\372\204B\241N\3506\2437\340\310\373\331w\346\235~\035\2626\026\2103,3y{zYp\234\271\031\307+\352L\352\346\263\315\351\006\247\312\024\235\326\315?\371\376\343\344|\315\375(r\363\335K\313\224Pl7\377d\203\375\270T\221\272\371\347\232\3778#\250\303\201\344\346SO\247\260"
+	.string	"\216\003\216\2314;\2604?\365\376S\315\325a\37160E#\353\356\346\036\033\204\2369\214~\246\271@\326\340\340n\276\005fz\303\027\321\317\346\331\264M\215f\244\007\327\315\267`\207\336@F\346'\0322\347\023\022)p\2160\251\321\354i*s\262r\363y\346\264\2533S\306\202*\275\001\215\350\247\230S\214\245\222o\270me\326\007>NqQhn~\005l\364\006+q?\301\304\375"
+	.string	"Qe\216G\352\310\023\264\233\317\271\223\356\374r\312\235^*\210\323\033\266\020\375\214\302<\243\234\\L\310\332\373\n\004\034W\216\026\212&Zn\206\033cQ\025v\363+\230\242o\375\256\234U\254\\V\tcH\232V\2004O,\247\224\263J\217\212'\272\270\275}n9\263\234Z,\363\304r\276\ri2Tpjt~\005a\372\025\340\320\257\300\205>\335\316)\2269tR\231{\252\322\272\371\025P\351\021l;\204\376\317\016\241\257"
+	.string	"J\237\202<\275\301\216\310\"\261'\327O\261\223\353|b\364\264\235\264\002"
+	.ascii	"\307\245\365\201\3252\326\346f'K\250\251\037,\372n>\005a\364"
+	.ascii	"E0r\216\031)cD\344\024R"
+	.ascii	"\301S\324\teu\315 \347\2203M&\347\332\311v2\3176\313<\233\234"
+	.ascii	"H\206\374\316&g\0213M\275&g\2223\315\312e\375l\250({\315\275"
+	.ascii	"7\017\016\025l7vr\220\333U\360\024u\202\031\232\264\223\354D"
+	.ascii	"\263rY\313\215\245\003%\215\231r\357\\r\252Y\346\231\366\241"
+	.ascii	"\345&\"\312\300\343\246\314\236\031\232\377\023\355\\\272\255"
+	.ascii	"\240\241\342\346\363\314\252\301\261\310q\363) \242\377S\211"
+	.ascii	"e\236f>*\204\370\205\335|\226\335N\252i\005\213\233\257\367\267"
+	.ascii	"\3778\371\305\024\262.7\237\202 \372\024\200\351S`\343<\242\303"
+	.ascii	"4k\304\335|\n\262\364)p\241O\201\225>\005*\364\177\0169\205\234"
+	.ascii	"j[\324\304\t\261ut]\246\236n>\005O\372\364q\206\235@~\034\237"
+	.ascii	"$n:\234\334|\rn\364\317\037\377q\"\320\303\213\223\233\263\375"
+	.ascii	"\033z\366\370\t\366\343\\8 bT7_\303\032\375\363\353\344\361\343"
+	.ascii	"\364\220\tcC\273\371\032\320\350\237;\234\374\251\221q\363\251"
+	.ascii	"C\247\320 \307!\247F\224\0334\272~\352\370\317\034\247\227\345"
+	.ascii	"\333\300\007\376\310X!\224\307\006\241\327\212\321\317\256\270"
+	.ascii	"+\315\263'\272\203\325\326V\225\251f\023\252KS\210\356\260\303"
+	.ascii	"\206\215\277f\227\332\226\227\233\257!Kw\030rj\235Z\247\325\315"
+	.ascii	"2\205\257\271\263\262:<`K\024\"7_\203\n\335\301\211\f\031\347"
+	.ascii	"\214\273\265\367N\261M\220\231b\227\231\314\330_\347\fL\006\233"
+	.ascii	"9\"\007d\215\356\200%F\214\214G\006g!\263\341\007Fw\210{\361"
+	.ascii	"\002N\f\207\310r\305\332\315\317\360\246;\2549[\234-\362\226"
+	.ascii	"\034\031sf\362\366\216x\001#\273\371\031\230\350\ffD?\257\316"
+	.ascii	"\253\214\226\241\3226\226\316]\323\033\"N\340\240T\005\321\036"
+	.ascii	"TQQ\235Vlb;YT\210\031sV\375\264\312tgb\310`2qV}|9\264\007:X\260"
+	.ascii	"\310[\200\244QM,\200\334\374\f-\264\007fRR\001x\323\207\343O"
+	.ascii	"{\300D\205\212,\261\025m\234\234n\376\320\027\355\301\223\023"
+	.ascii	"\305\211b\312\n17R\364|\334\374\2417\355A\225\363\351\204:\237"
+	.ascii	"2^\tgm\304X\354\031\221\273\371Cl\332\203-g\323\331\224\361\322"
+	.ascii	"6Nf\362\306vVV\007t\233Y\361\270\371Cf\232(\310\337_\020,\313"
+	.ascii	"\005&H\216\233?\304C\337\"\261\331\217\231\3750\035\216B\261"
+	.ascii	"_\244^\322R|\360\241\033\032gI\364\354\346\226\231\335\3443\023"
+	.ascii	"\262\266\234\234@@\262\274\023\333]\370`\334\374\241*\275\201"
+	.ascii	"\022\242\3476\267\314\334&+\t\362%\r\337\236\024&ZU\372\264\007"
+	.ascii	"_\330\260yK;#\243\323\273\371\023\320i\fJ\242g=\313\314z\231"
+	.ascii	",;\245\355\253\013e\246\234\031\311hF\214\314X\242\211\306\322"
+	.ascii	"\244\311\001j\221DpeJ\341\302\223\212\222IkP\311H\f\"q\326\340"
+	.ascii	"\261xt\356\250E\022\301\225)\205\241\344\222\252&@\t9\301jT\223"
+	.ascii	"D\fG\026\206Fu)\311\224\364yR\221\322\021\271\244\252@\r\216"
+	.ascii	"\305\234'\025\351<\251\310\004\322\203\tdP1hD\"\256`B\005U\211"
+	.ascii	")\251\"{Vu\205\234\341\316\nIb\220\004\305\2400i\r*yH\256D\022"
+	.ascii	"\036\230\214H\0020\301d$\026\0050\002\t@\022@\230\360\240\016"
+	.ascii	"\231\212B#\321\0032\311\344\301C\013Gd\322z4\246"
+	.string	"GA\265\230\327\244\361(<\217V#\021YD\237T$D\002\205GI\265\004\222I\204P\005u\r\376$\3255\270\256 \224\024\252\220\f\256I&\016\fC\250I\246\240'\025\251G\301$\006\006\030\217\304UeR\"\212`R\"\026\217IA\017\031\f\213\307\023\324!\323J\\\213!T$\223P\261\030\"\007i\t\350IEK\305#r\025Z\211F\024\206\304\245\364IE\311c\t\244\232\364@\201\nT\205H\246\343\n+\323\222\221\310\263>\251\310\203\361\250\244t\024\226\260I`\211dRN\222M\332$\272^P\207G\245\234\365IEKD\344\232\034\252E\017G\"\362X<\n\317$0\251\n%\221\307\342QD1H\024\252KI\036\f\022\254O*J2`\250\026I\004\215\252O\022\350\203dZ\203\352\221\005B\017\256\301\341\252&{\200\352\032,.)\251,T04\264>\251h(,\221\241\204N\356"
+	.string	"\217\352\220Xb\007=\002\2234\320\272\304tD\"\001\203\310\340\222\207\rB#\223\216\361\350\236I \322\322\316\n4\"-\235F\244%\254~\200\230\314\311\244\212\034\016\203)r]\302C5\035\252I\246\234L\217\004\"-\025\361\234@\256I\"\222\252\002PX\"(9bU\2212$\177:\220\f\246\220\200UE\372)\026C"
+	.string	"!\203jQDO\261\030\302g\205\240U]\341\350H\002;*\2221\230$\3749qD\\\217\021\030\032C\224\b&\203\202kP\001Cb1H\201\244\221\030\\\215G\021H\246\244Q\265@]\211\310\026tR\220\200\n#\026\260\200aPE\346`\370 B\321\t\"X\250\300\n\"p~\200\032`\202\310\200\2411\204\272\006\207\304b\260\304\320\005\352\032\354Q\223*r\347B\nB\"2\020\261\252H\031\214*\022\311$\004\232 \210\007\204\242\025\031\\*\032\261\252I\fI\241\013\201F\006\254jRU\001i)\303\205D\244jT\221\364G A"
+	.string	"$\2000\221\036D\001@("
+	.string	"\b\350A\024\300\310\250"
+	.ascii	"$\030\351\223`\204\327u]W\025\250\016\217)\250H\246\"1x\304\023"
+	.ascii	"t\"\210D\206HnX\327'\025%\213G\344j<\n\201B\244\007\341\321\222"
+	.ascii	"\272"
+	.string	"\25604\252i\022\250\"\031\203*\b{\226\324u\205\025\031\\\2238*\2221\210<\223\304\241\361(\242\004q\025\206P\207G\245\f*p\210\202\211#\211t\210\202:<*\241E\325h\f&\2110\301\024\364Y\221\352*\f\"\203IB\340z<\222P\221?=+\360\302z\241\003\311`\nF\246\243\035b\316RR)\271\204\004\264\006\221C\246 \t\240\211#\211\016\b\203E\022\022$W\344qI\347\003I@u\r\"\201B+hX\237T\344\341H\354\371Y\201!\210\220D\n\026\217\200GGG R]RU\022\300\241\212D\252G*rI\003qI'\231T\205G\344\022pH\\\002\002\032\211\300!q\311\347IEG\344\t$\rG\344\t\244\235\034$\tb1(b5\252Jj\211c\n\030(\035\215\352\020(4\236H\036-\025\265\272tb\275\360\243\256\301\341\022\023\020\231$\372| \251\003!\210"
+	.string	"T\223Lj\222\tx\\u\214\214B"
+	.string	"~ \tC\b\300\365\350\230\034*\036\217\t"
+	.ascii	"\236=\036\370\371@\022\320HT2\236\030\002\217\310\023HBO*R\221"
+	.ascii	"G!Px\344A(B\203ZD2\006\201\306#q\025\252H\344Q\b\314 $\024\006"
+	.ascii	"sT`\217\021\211X\f\002\205\302 \216\212\f\2660D\006\223\200B"
+	.ascii	"apg]\201G\3520\303\223\212,h!x\002')H\n\211JA\343\t\005\b\035"
+	.ascii	"\221*\006\204\302`\272\036\251C\340:\301\223\212\214Gb\320C\022"
+	.ascii	"yL\032\325\244\006I\302\225\270t&\213\305#2'U\246b\260\004\312"
+	.ascii	"\004L\022\256\304\021Cc\210b\361\210\fJ[\b\"qR\211\210d\001\251"
+	.ascii	"\256\252\3221x\341IEH\325\004QI\003\317\372\244\242\225iie:\002"
+	.ascii	"\225ZX\302 \211\226P\025\240\256A\025v\212"
+	.ascii	"G\341q=\"G\374\030\217\304$R-aDA\251\005 \245\026"
+	.string	"F\fU\241\361D\3228\0015\311\324s\002\271\252JjQea=&%\025\240&\231\200J\250C\254&\217\216$\240\026\207(\024\203+\021\2118\0342\022\225tV\023A%\235\2411\250\244t\024\032\211J9\253\221\351(B-\036G \217\353Q\251g%.y\030B\366$\201; F\\\020(\\\020\n\270\352\322\211\025\210T\327\"\361\bh\347\003I\300\243\245\"\260\205\340\211\234\017$\365\034\035\035W&!0I\270\036\215\300\013\253Q\025\"\325\021\253\221x\034\261\30444\022+0\201N\013\301\013(1\2550$.\365\254F\246\243\020\250\"\005\221j\211 \320x$\256\301\244Q]R:\212\030\022G\254A\022%\202\214\304\024\326\020C\342\322\217ZD2\206\3609\261\022K\020Wb\322\250\256PTK\250\305\237\025H\202\321j$2\351a\361\230\224T\221I,\250\305u=\"\223X\220\300H\f6"
+	.string	"y\\\203HU\t\251\256D\fG\342\032T\301D\260\250\252\220\274\260&!\021\325\n\254F\342qiUWPB\252\3530h%*\021!PT\205\302\020\352\032T\241\205\340\t\240'M\240\244\256\311\023\311\036\023\352\320\210\302\220\270\344\243\026\211GG\344\bu\r\252\240\226 \256\302 \220:<*\001\221\230H\250\303\234\244\220\270&\211kpM\002;\220\f\256>\310`\2220\253JAc^\207j\021\270&!\021\213\027\254@\020\253\221\310\224\236X\211\310`\361\270\244\207*\004\222LkpM\002%\221\202,\f\325b\252\002\221*\361\210\270\032\325!\n+\3628B\202\365IE\036\222H\265\004\0219\254\340\307%\025\351a=\036\221\036tL\250\220\004\2120\022G\024\203D\244\232\004Z\201$|\ba"
+	.ascii	"A\020\003\370Pt\341\004 \200\b\f&\020\201\006ha\021\022\361\310"
+	.ascii	"x\024z\020\036y0\022\203J\036\204\310\244\207\"\tL\260\200\024"
+	.ascii	"d\341HL\377\247b\320\266kC\r\337\336\315\002@\"\227\206I\345"
+	.ascii	"R"
+	.string	"0V\251\314\013a\t\215\030Y{`\350x\320\312b$\241K\347\322\260\314\374r\021\2359\245\330\225\364\313m\302\001\022'\244\356\346wP\241\377\324\013\032\016\226\023\024*\342\346\254\025\227X\231\233\005\340\227%\355\222%\345\022\006\302\021\267;1-O\271\244pTx\374\225I\341\322-9-\3120y;y\270i\361D\r\2264\353\254\233#\013r%\245\221\200\274)\257%\221&cbR+~\314\275(X7/\313\366^\366\240F|\250\230B%\237\241R0\372\372\246(\271[\306\254\350\335\\t\303I\352\346$\225\002\226\366M\275\311\213\362T\312\337R\234Q3ws\nE\273a;\003ss\372\344opq]7\244\350\3372/%eC\023\333{\377\354\230Q\003e\355\346s`\323\177\272\226B\341/}_sM\322\025h\2133uW\230\247\225\332\2316~LR%\231-\257\251\233c\274\215\301rs"
+	.string	"\310\320\322%hi\032N\323\336_nii\024\034\331\222\315\315\347P\246\003"
+	.ascii	"\304,]\232\245g>:\2349\201]9K\235X\34022\345\346s\370\322\177"
+	.ascii	"\252$\223\355\264YqcU\006w\2769i\372\"\303YY\211\024\2772IP:"
+	.ascii	"\2376:73$(\226*/\314\306\276N\2523TgGr\030\317\337\0275[F\320"
+	.ascii	"\273\277\025Zdn\276e\246E2\036\233\214\257\256\233\005\300\""
+	.ascii	"\r\222\022I\203\244C~\301i\357\247\275m\334\b\300\233\220"
+	.string	"#I\366v\226\213\016\177*\344\351\020\324.\347\352,\317\n\007+}\313L\305\266\364\354m\t#\005\004u\343\001\322\344\206\227\26010+\261\272\273\334\261\262\002\333\362\221\243X6XJ\314\300N.\027\216\f\032\024=\332\3205M8\246\360x;\203\374\305\335\370\312Fl\030\2526(;N\277;\0256\310\350@m\254xB\025\303\013m\201\245\370\265i\273yC\232\256\256\274E\312\2277D|p\354*m\330h\016\240p\340\310\303\021\323\323\242\272\371\035\314i\016\252\322\033\351\215\2745cV-\313\313\313\315\357 \212\346\340H\215\032\031oh\253i\215\216\225)48qcv<\271\371\035\230i\016~\314\230\221\322\300\240f*o\r\026\031k|)\215 C\272\246n~\007J\315\201\026\f\030iV\206f\2503\262SrP\252\245 \216c\214)\304\020\r\211\323\030s\025@ XD$\224\213\227\315=\023"
+	.string	"\004\214\013\205i\246&!d23\222$I\366\231\003\006)pV\250oX\020E\207\322TW\340\256\344tLA\276s\273\224\220Nv4\330:"
+	.string	"VZQ\211\"\211p,\310G\343U\371\243\200\313Y\325v\376\201\210_\350\003wJ\360\307\341\033\231\373\272\312\210\220\320a\\\257\033\325D\274i\263\330\024Q6\2777_\210\366\006\035G\352\007\022\316\024\227m\023\374\301\376\355\\\247\236\033y\2114\t\365\252\r\2371\211\340\247n\034\"*>\354c\240:A\212/\217\344\263\314\016\215\2324\312\223\034N\236l\343\321\006\310\337\244V\256\360\367<2\243-^\322d\342\304t\276z\321\357v\025\360\t\r\022nu]\034\310\3641\262C~\265\243\274+\3335\303\332\240\001\310\247y\242\252\233\325\334v\345\020],-\372\256\f\2214\236\305\203\226C@q\217\200vY\340\341\211'"
+	.string	"N\352\352\201mR\347SD\022\243\335K\215I\001*\f\t\367\307\372-\311\346c\033(\325\214\373>\217\026\354\216\330h\273\306F\002/~\032n\211\035\311\235\220\323\251m\272\200Z\0042F3\302\333)\317\276j\021Rmj\326\212\316\234\313\0066\227\220\026N*\347\024^\346,\025"
+	.string	"\f\334\251\234+\371\203\021\016\304\346\301\266\336\377\306\ftF\316Q\304ed\341\037?\221\3731\243:\215\225gV\2422}U9\235\354\340\216\361\224\3722~hw\242\215\302\221f\350L\324\354\340\204g\370\266\331\276.{\302\333\244\204\272z\301!\377\325\035\347\277\302.\334\222\323\033\231\257\257\274\261\205"
+	.string	"vG(?\240\211-\03650\370\002\211\206\325\323\b2\363\235\030;\362Z\260\250\241\021\262\350\022Nv\221\016\031F\020\b\344I\223F\226I\301\254\244\304G\247\220\025D\305\021\356U\240\2732\2340\325\215.\214\316\276&\375\005\031\260\223\244\227\021?\021\244\270\374|\341P\266\242\001\fou\"L#\030\202\355gX\2259\305\200Zd\374\031]c\334\363\346E\023\352\231\350\013\234\2571]\006\276]\350J4\317\375\333\227\324\003\003HS\265C\023E\246n\022\341\341H\354\353\025\313\337\302\212\27410@U\211w\\\336\323w\224\357\275\303\223X\002"
+	.string	"\264kQ<*({\2032'\036\002\204\362\354\177G]\374<5\350\3546v.\002F\244Z\1772p\r\346-\t\323f2%l\313\376\n\215&\251L-\243Y\013\033("
+	.ascii	"\002U\344!1\213\332\336\027\203\030\201\314\\>\256\354:\261\204"
+	.ascii	"i(\224\3034\347\003\033`\r\274v'<\035\310\020P*\013\216\253!"
+	.ascii	"\024R\357ADE\222&\034\005\217\306+<\302\305\302h\363bA\200;\t"
+	.ascii	"Y\327B\360lG\227\247>^T\361\345\r\370v\016\202\206;\364\177W"
+	.ascii	"\\\254\242V\033\364\275\rh0=\221\215\0073i\004\360\021\352\254"
+	.ascii	"\364\203\016;"
+	.string	"\002\246\020\022\226\306e\322,8\211!]\221-\322+\316T\210\354\352nD\300\255\232\027=<\353\026\373\225\254F\265sR\006\322%fQ\271\276}5\211k,\036\\\003Jf\031(\354*\265\251s=]\204\230{is\003<\360\321"
+	.string	"\003e\353\277\255\352YA\002\257\327\245\377\260\346m\fl\305\314:\347gA78i\301i\203y?\002l\362VGK\030\240\374\232>n3\035\001\307\247\326\b0\035\217V\273\311\224L\021\261\370\233\255\362\271\235\252%o\363\0318\315\303\257RV\343\355\232\374f\303\377R\372\b\227\021\301\202/Om\256\343\035 F\323N\317\362\201\202\314\005L9C\267\263\2460"
+	.string	"^Z\212\017\246\317a\317\266T<\257g+\206\317\214iOV\313\234C\316\007(\354nf\314\325\346~\b\304\005\363O\364\223Od\331\375\243V\316\001\216\005\243\264\3575\372\034\024\2777a\220W\227\235l ^puak\333\260{!\f\277\236\002"
+	.ascii	"\354\252\026J\352\205\270\231\374\366\bY-\255\276r{\305cs\315"
+	.ascii	"`\341\232\216\314\331x\307\0166(\022j5\241\223\333\374\035\013"
+	.ascii	"\272QA\255\310\021\"nX\0056"
+	.string	"\267\204DU\355\225\354\373]\314\314T\217\355\023\206W\3605\027U\224P\210\326\362<\030E\251i\026\216\206\300\037R\344\352*c\"\320\022\f5\237XB,\231PV\346\222\206\332Q\006\230\255\247+\nKy\003O}\324B\270\\u\235\312U2\312\347 \207\212\331`\333\2520y[\305i\351\226\370d\311\370\274d\024\342r\251\235\346`i.\361\006\310\215\237\242\344\320'\017\213\227|\0076\323[\267xHUV\210x\320\203\256HUB`\020\242|\242\033Bz\351\246\235\311\035\b\376R\315t\306>7\201@\220/\211C\311\376\354-\230X\006\322\206\314&\3750V\345\305\331\210\3036\257\206\247\004\006\030VL`J\233Y<\263A\346b\210/\272\272\370L\351\360\372c\002\364$\210\017\342)\323X\003\310\210\365\330\360\020\362:\224\203I\255\2714\266\204-\324I0\002;\244$.\017`\224\351`\244\377]"
+	.string	"\320\357n\262\342\306\352\323\310D4\024\323\313=\013\2075\367z\365\333\334\024\301\314\377\247aY\311\325\274\326Z\327\337\203\3104\362\007\024\303,\311/4\316\376\235rsj\241\364\343\2533VO\354\002\3272L\032g\254\375\177\250\320D\274\236\265\2249\255\017\233c\r/18\266Dj\213\265:9\266\263\215\200\371\2357\257@-\324\363\240\201o\311\n`\353D\026\224y\205\207\230h\264\037P\034\b\017P\003v;5\251uIH\nZ#\223\277:\0029s\235@g4Cdk>\004\034\005p\300\017a\330\231yL\303|\017}(`\254\361\341\305\333p,\353\272\005\343\303JL\250u\302\263-\356\200\270n\327\316`\317\340\336\021\326K\273Ri,.\335\025\346\001U"
+	.string	"h\364@\2327\031\216\342\245\005\2667bw'\200B\344D\226K\344\271\306\251\013\017{\372Y\356V\344\233\351\337\025\232\307\312_-\365>\024#\203x\037\376\260~\331,7\327\252\344\241\246\276\350`\205.\314\0054J$\027\252/9\264\367\361{\251\\\013>\002&,\203\345"
+	.string	"1\003]\373\203\357\276~\311\361\307j\207\320a\275O\264l5\250P\307\235\261\367*\304\307/;\333c5\031\372\006\216\270#\2147\r\353^\262Z\235\2740\2440cq\033\322\312GK\362%SX\275\301\336\006!\363\2372L(\nh\220f\354\344\211d\230&:\355\276D"
+	.string	"\203\"\223\233\305\026\303\246\001Wi@\233\347\356\232\301\017\177\367\212\020\244\004\301\244X\326\005\305\363\231\204\035\330\270\316\203g\370M1\321\307]P\355HP\220\"d/O\216q\235\215\202\220A\274C\345D\004\021D\200!\341j\265\bh\256\336\222J\340c\217\341KG'\317\021\370\tv\332~\203]M\316\bP\3442\\n\365)T\264(j\373\354\323a\333\262_\013\003\034\246\341Ck\242\251\203o\3743\266\307mP\b\371\204I\362&\237\035\364\036>\254\002\347 \301M\036\256\370z\363\346;\235e\247S0"
+	.string	"yi\rU\013\334(\214\332\004PDY\303\257E\202\370Z\336\022\365\343\006Y \322.\355\300\317\022\004\255\341\254\264\034\037\026\262\207U=\376\017\315\007\267\033\"\3177\036N\021@V\310\232\241K\002\213/!\355\321G\357J"
+	.ascii	"@\2149u\210\003_s0\377,\221@\276/\023\270\247d\037p\274w\251"
+	.ascii	"U\250'JR\312\rB=\314r\025V\271\251\245B%\316\262\t32\361\300"
+	.ascii	"\357\377d[\020P\202\362\321@\250td<fe\026UT?\030\244\030\227"
+	.ascii	"\004\341\330:\f%\bX\364@\226\375Kx/\233\342\036\027\207<y_q\220"
+	.ascii	"B\343\377\363\367\352\265z\222\252e>$\324\370\313@\242\243\033"
+	.ascii	"\256m\034\321\246\2546\202q\033N\357\265*\330\273\364\265\326"
+	.ascii	"&\004\342\226}J\242\030Q\316\322\377*\200~-^\324\2129\210\252"
+	.ascii	"*\004\327\220\3353}\353T\262tS\"2c\3116\347\005\026\367-\331"
+	.ascii	"(\221Rc\020~G\021\n>G2\002xq\243qxw\335\272\274\t.w1\246\314"
+	.ascii	"\222\375sK\300l!,\203\221"
+	.string	"M\214\350\270\317\221R{\351\320\017\203\t\343\274\224k\310\371\275{c\257\006\371b?^\276]\336\3769\"\005Yp\332T\nv\b\234\3062~\326=ja\313P\373\022\360]\205~R\003\275\247\366\303/\315va\007\377\\\353\316\225\377\023\023k\205\0239^\330?\244\003\016\365\022`\250\221\211\254\342\273\022\252\031*\210\373:l8\267j*\234\\7,\204\223\242\205t\210\\\265\241q\274\002\273\357\275\267\352,|\247\376\223\242-3\217b\212Fp'\n\214\254\373 \377\246x\270\342p\324o9\317 c\216+drOpI$\277\336\257_\221\032\245n\264\267d\347\3321\350~\314\300J\342B&\221^E+~@\321\335\"\023\217p\227ul\007}]\372GA\314V-\364\013D\037\370+FZ\314~b\177\333\370\215\207+\314\313\235|\317\304i`\253*\006L\366\276\350\001\\\330\304\260r\277\306\203\361"
+	.string	"\254X\220\340 m\320\200\334\214x)\340\351("
+	.ascii	"\244\310G\320\023\017\317\322\377\215-\354\035\255\346\fO\357"
+	.ascii	"*\230\267\246\274\371F-\316\332\211g\026g\222Fy\367)\317\355"
+	.ascii	"^B\354\033\365\034\336\272\333\273\210oW]\310q\313d\216@\306"
+	.ascii	"\234\314\236r\253\020/\036\252\256<\034\244\237*\f\0013Q\215"
+	.ascii	"%\346H\353\334\035\345\370a\335\305\355\350V\357\217\310\006"
+	.ascii	"9>|i\316\372#\r\322rKj5u*\334\264\236\325\245\022V\204\323\311"
+	.ascii	"\001P\253\242\257\215\217g'\353\377\207h\330c\231z@A\227O\226"
+	.ascii	"\205\243\035\312\2358i\177\362Y\034\367\375b\024q\275Q\345\340"
+	.ascii	"\rf;d0`J\350\3714\"\321\372Fd\256BI\354\2351\315\265\234\253"
+	.ascii	"\201I\035\006W\206Mi\314\236\031\224\277\256f\210\001P\033{\374"
+	.ascii	"Av\242-\317\031\226HKmI\f5\301\033=9\231\007Pf\254!u\331\260"
+	.ascii	"5\375\021\221\177\317_\240\200\342\001=\030\343\333\337\t\267"
+	.ascii	"\002\330l\337\360p\004\225\234\312\253V\375\323hnG\257\3077\257"
+	.ascii	"K8r\244\335\00268r9zA$\220OTX\007\265\213_\222\337\242\314\r"
+	.ascii	"z"
+	.string	"K2\371\334;\355$\005\205\013s\2709pj\036~\236V\300\340\030\2509\345;\254\275\356\036t\262\321z\376B\263A\365\335\326\357\206U\343?\034@\301\331\204\314\273\316\347P\360\\\310\032\360+\037H\227{\237\377\027\025\361\333\340\230\363\247r_\230\240\255\222\344\234\217\034\374\3426\350c\202V\2158\305*8{\366\374\fvv\351<\"\236\216\232\346\320\223t\213\347\346\263U\332\007%*\206\f\311wo\375\362\r\202\243[\2323\304\350\330PA/\312\251\346\376\275\335\344\240\313\322\177\270\337\360!\3120[X\370\205\333"
+	.ascii	"\203H\265\034\201\024\232[\017\3034bS\320F\330C\356\262\310\265"
+	.ascii	"\255\020o\004\255\214\025\020Y,\21435\004[K\003\355U\376\375"
+	.ascii	"Y\032::i\213\016|~\033\242An9\036\247?\314|^\365\272\303\277"
+	.ascii	"\211\355\330^,\377\354zd9\024C\n\347\021\355\003\335\216\362"
+	.ascii	"\301\016\360p\365\264\277\f?\256\274Y8\331\311\370U\245V\351"
+	.ascii	"v\3309w\004\327\036_|{\256\313\275.?\244Y\3632y\357\366\023\302"
+	.ascii	"\177\363\3579\207\260#\354\246\356\373\350\311\362\023v\214\033"
+	.ascii	"\360Y\373w\346\327\227\2719G\300c\245\235n\272>\034\331m#\256"
+	.ascii	"\355\016_\261\272\324\341!f\365\267\310\267y\274\f\213]\016\334"
+	.ascii	"Is\314\255o\255\340\204V\253\254\337O\300\377\rD\377\364|\321"
+	.ascii	":\303\377[)\237y^-'\317\362\336%\360\303D\200v\310\350G\252\236"
+	.ascii	"\313\273'f6\331\351Y\273,\340\305A'9?S\302\267\250\031\261\030"
+	.ascii	"\306\246fz\330\357\332\326\321\315\227\320\317\324\257p\344K"
+	.ascii	"\fM\3148h\333\276\277\013\366, q\215\370\350\365a\262s+\332\025"
+	.ascii	"\310X\340_\206\346\036\254\262\3764\307\363\210\227\345\274\025"
+	.ascii	"\335\230\356b:\207\034\235$\316\005\177\004\244\263\305mV\352"
+	.ascii	"\246\324\3163\020b8W\205W\020\237\231\334\374\365\212\260\331"
+	.ascii	"\276\253\323)\226\343\032\335Gk\004\344o\352<\177M\356\013\276"
+	.ascii	"\361\334\243\361\343\260H\217\336\271\231\347\241E\237/.\177"
+	.ascii	"\002\233\326\025"
+	.text
+	.section	.gnu.lto_.symtab.3ce16b97d0fcef2,"e",@progbits
+	.string	"pgResetFn_serialPinConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"pgResetFn_statusLedConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"getCurrentMinthrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"resetConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"activateConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"validateAndFixConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"ensureEEPROMContainsValidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"beeperOffSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"beeperOffSetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"beeperOffClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"beeperOffClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"getBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"setBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"getPreferredBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"setPreferredBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"vcdProfile_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"vcdProfile_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"serialPinConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"serialPinConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"statusLedConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"statusLedConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"pgResetTemplate_featureConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"featureConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\003"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"beeperConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"setControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"pgActivateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"configureAltitudeHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"setAccelerationFilter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"useAdjustmentConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\003"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.string	"generateRcCurves"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\003"
+	.string	""
+	.string	"featureConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\003"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"resumeRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"suspendRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"isEEPROMContentValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3ce16b97d0fcef2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10212 @@
+	.file	"controlrate_profile.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/axis.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/fc/config.h"
+	.file 8 "./src/main/fc/controlrate_profile.h"
+	.file 9 "./src/main/fc/controlrate_profile.c"
+	.file 10 "./src/main/fc/fc_rc.h"
+	.file 11 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	controlrate_profile.c.ffd8b9f2
+	.weak	controlrate_profile.c.ffd8b9f2
+controlrate_profile.c.ffd8b9f2:
+	.long	0x50c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x14
+	.long	.LASF1596
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1488
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1489
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1490
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1491
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1492
+	.uleb128 0x3
+	.long	.LASF1494
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1493
+	.uleb128 0x3
+	.long	.LASF1495
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1496
+	.uleb128 0x16
+	.byte	0x8
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1497
+	.uleb128 0x3
+	.long	.LASF1498
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1499
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x3
+	.long	.LASF1500
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x1d
+	.long	0xbd
+	.uleb128 0x1
+	.long	.LASF1501
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1502
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1503
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1504
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0x87
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0xf7
+	.uleb128 0x8
+	.long	.LASF1505
+	.value	0xfff
+	.uleb128 0x8
+	.long	.LASF1506
+	.value	0xf000
+	.uleb128 0x8
+	.long	.LASF1507
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1508
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1509
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1510
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xf
+	.long	0x103
+	.uleb128 0x17
+	.long	0x113
+	.uleb128 0x6
+	.long	0x72
+	.uleb128 0x6
+	.long	0x64
+	.byte	0
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x4
+	.byte	0x35
+	.byte	0x5
+	.long	0x132
+	.uleb128 0xf
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x72
+	.uleb128 0xf
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x132
+	.byte	0
+	.uleb128 0x5
+	.long	0xf7
+	.uleb128 0xa
+	.long	.LASF1563
+	.byte	0x20
+	.byte	0x4
+	.byte	0x30
+	.long	0x183
+	.uleb128 0x10
+	.string	"pgn"
+	.byte	0x31
+	.byte	0xb
+	.long	0xbd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1511
+	.byte	0x4
+	.byte	0x32
+	.byte	0xe
+	.long	0x87
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1512
+	.byte	0x4
+	.byte	0x33
+	.byte	0xe
+	.long	0x183
+	.byte	0x8
+	.uleb128 0x10
+	.string	"ptr"
+	.byte	0x34
+	.byte	0xf
+	.long	0x188
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1513
+	.byte	0x4
+	.byte	0x38
+	.byte	0x7
+	.long	0x113
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	0x7b
+	.uleb128 0x5
+	.long	0x183
+	.uleb128 0x3
+	.long	.LASF1514
+	.byte	0x4
+	.byte	0x39
+	.byte	0x3
+	.long	0x137
+	.uleb128 0x11
+	.long	0x18d
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1515
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x2cb
+	.uleb128 0x1
+	.long	.LASF1516
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1517
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1518
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1519
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1520
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1522
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1523
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1524
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1525
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1526
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1528
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1534
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1535
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1536
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1537
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1538
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1541
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1542
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1543
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1544
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1545
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1546
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1547
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x2d0
+	.uleb128 0x19
+	.uleb128 0xa
+	.long	.LASF1564
+	.byte	0x15
+	.byte	0x7
+	.byte	0x43
+	.long	0x31f
+	.uleb128 0x2
+	.long	.LASF1565
+	.byte	0x7
+	.byte	0x44
+	.byte	0xd
+	.long	0x7b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1566
+	.byte	0x7
+	.byte	0x45
+	.byte	0xd
+	.long	0x7b
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1567
+	.byte	0x7
+	.byte	0x46
+	.byte	0xd
+	.long	0x7b
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1568
+	.byte	0x7
+	.byte	0x47
+	.byte	0xd
+	.long	0x7b
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1569
+	.byte	0x7
+	.byte	0x48
+	.byte	0xa
+	.long	0x31f
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	0x74
+	.long	0x32f
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1570
+	.byte	0x7
+	.byte	0x49
+	.byte	0x3
+	.long	0x2d1
+	.uleb128 0x9
+	.long	.LASF1585
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x17
+	.long	0x32f
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x19
+	.long	0x35f
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1573
+	.byte	0xe
+	.byte	0x8
+	.byte	0x1e
+	.long	0x3ee
+	.uleb128 0x2
+	.long	.LASF1574
+	.byte	0x8
+	.byte	0x1f
+	.byte	0xd
+	.long	0x7b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1575
+	.byte	0x8
+	.byte	0x20
+	.byte	0xd
+	.long	0x7b
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1576
+	.byte	0x8
+	.byte	0x21
+	.byte	0xd
+	.long	0x7b
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1577
+	.byte	0x8
+	.byte	0x22
+	.byte	0xd
+	.long	0x7b
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1578
+	.byte	0x8
+	.byte	0x23
+	.byte	0xd
+	.long	0x7b
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1579
+	.byte	0x8
+	.byte	0x24
+	.byte	0xd
+	.long	0x3ee
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1580
+	.byte	0x8
+	.byte	0x25
+	.byte	0xd
+	.long	0x7b
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1581
+	.byte	0x8
+	.byte	0x26
+	.byte	0xd
+	.long	0x7b
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1582
+	.byte	0x8
+	.byte	0x27
+	.byte	0xe
+	.long	0x87
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1583
+	.byte	0x8
+	.byte	0x28
+	.byte	0xd
+	.long	0x7b
+	.byte	0xc
+	.byte	0
+	.uleb128 0xb
+	.long	0x7b
+	.long	0x3fe
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1584
+	.byte	0x8
+	.byte	0x29
+	.byte	0x3
+	.long	0x35f
+	.uleb128 0x11
+	.long	0x3fe
+	.uleb128 0xb
+	.long	0x3fe
+	.long	0x41f
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1586
+	.byte	0x8
+	.byte	0x2c
+	.byte	0x1c
+	.long	0x40f
+	.uleb128 0x9
+	.long	.LASF1587
+	.byte	0x8
+	.byte	0x2e
+	.byte	0x1d
+	.long	0x437
+	.uleb128 0x5
+	.long	0x3fe
+	.uleb128 0x12
+	.long	0x42b
+	.byte	0x22
+	.byte	0x16
+	.uleb128 0x12
+	.long	0x41f
+	.byte	0x25
+	.byte	0x57
+	.uleb128 0x9
+	.long	.LASF1588
+	.byte	0x9
+	.byte	0x25
+	.byte	0x95
+	.long	0x199
+	.uleb128 0x1a
+	.long	0x44a
+	.byte	0xc6
+	.uleb128 0x1b
+	.long	.LASF1597
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x6
+	.uleb128 0x1c
+	.long	.LASF1598
+	.byte	0xb
+	.byte	0x2b
+	.byte	0xe
+	.long	0x72
+	.long	0x484
+	.uleb128 0x6
+	.long	0x72
+	.uleb128 0x6
+	.long	0x2cb
+	.uleb128 0x6
+	.long	0x93
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1589
+	.byte	0x43
+	.long	0x49a
+	.uleb128 0xe
+	.long	.LASF1591
+	.byte	0x43
+	.byte	0x27
+	.long	0x7b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1590
+	.byte	0x3b
+	.long	0x4b0
+	.uleb128 0xe
+	.long	.LASF1591
+	.byte	0x3b
+	.byte	0x24
+	.long	0x7b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1592
+	.byte	0x27
+	.long	0x4e0
+	.uleb128 0xe
+	.long	.LASF1593
+	.byte	0x27
+	.byte	0x39
+	.long	0x437
+	.uleb128 0x13
+	.uleb128 0x1d
+	.string	"i"
+	.byte	0x9
+	.byte	0x29
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x13
+	.uleb128 0x1e
+	.long	.LASF1594
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x30
+	.long	0x40a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1599
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xe1
+	.long	0x437
+	.long	0x4fe
+	.uleb128 0x20
+	.long	.LASF1595
+	.byte	0x8
+	.byte	0x2c
+	.value	0x100
+	.long	0x64
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1600
+	.byte	0x7
+	.byte	0x4b
+	.byte	0xa2
+	.long	0x50a
+	.uleb128 0x5
+	.long	0x32f
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 31 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 32 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x20
+	.file 33 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 34 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 35 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x23
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 36 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.file 37 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 38 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x7
+	.file 39 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x27
+	.file 40 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.file 41 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x29
+	.byte	0x4
+	.file 42 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 43 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2b
+	.byte	0x4
+	.file 44 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2c
+	.file 45 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 46 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x2e
+	.file 47 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 48 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1482
+	.byte	0x4
+	.file 49 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 50 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1486
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1487
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF952
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF964
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1069
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1071
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1073
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1083
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1101
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1485
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1601
+	.long	.LASF1602
+	.long	.LASF1603
+	.long	.LASF1604
+	.long	.LASF1605
+	.long	.LASF1606
+	.long	.LASF1607
+	.long	.LASF1608
+	.long	.LASF1609
+	.long	.LASF1610
+	.long	.LASF1611
+	.long	.LASF1612
+	.long	.LASF1613
+	.long	.LASF1614
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x33
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1615
+	.byte	0xa
+	.long	.LASF1616
+	.byte	0xa
+	.long	.LASF1617
+	.byte	0xe
+	.long	.LASF1618
+	.byte	0x3
+	.long	.LASF1619
+	.byte	0x2
+	.long	.LASF1620
+	.byte	0x4
+	.long	.LASF1621
+	.byte	0x5
+	.long	.LASF1622
+	.byte	0x5
+	.long	.LASF1623
+	.byte	0x5
+	.long	.LASF1624
+	.byte	0x5
+	.long	.LASF1625
+	.byte	0xd
+	.long	.LASF1626
+	.byte	0xd
+	.long	.LASF1627
+	.byte	0xe
+	.long	.LASF1628
+	.byte	0xe
+	.long	.LASF1628
+	.byte	0xd
+	.long	.LASF1629
+	.byte	0xa
+	.long	.LASF1630
+	.byte	0xd
+	.long	.LASF1631
+	.byte	0xd
+	.long	.LASF1632
+	.byte	0xa
+	.long	.LASF1633
+	.byte	0xa
+	.long	.LASF1634
+	.byte	0xc
+	.long	.LASF1635
+	.byte	0xa
+	.long	.LASF1636
+	.byte	0xb
+	.long	.LASF1637
+	.byte	0xb
+	.long	.LASF1638
+	.byte	0xa
+	.long	.LASF1639
+	.byte	0xa
+	.long	.LASF1640
+	.byte	0xa
+	.long	.LASF1641
+	.byte	0xa
+	.long	.LASF1642
+	.byte	0x9
+	.long	.LASF1643
+	.byte	0x9
+	.long	.LASF1644
+	.byte	0xd
+	.long	.LASF1645
+	.byte	0x8
+	.long	.LASF1646
+	.byte	0x7
+	.long	.LASF1647
+	.byte	0x6
+	.long	.LASF1648
+	.byte	0x7
+	.long	.LASF1649
+	.byte	0x3
+	.long	.LASF1650
+	.byte	0x1
+	.long	.LASF1651
+	.byte	0x3
+	.long	.LASF1652
+	.byte	0x4
+	.long	.LASF1653
+	.byte	0x4
+	.long	.LASF1654
+	.byte	0x4
+	.long	.LASF1655
+	.byte	0x4
+	.long	.LASF1656
+	.byte	0x4
+	.long	.LASF1657
+	.byte	0x4
+	.long	.LASF1658
+	.byte	0x4
+	.long	.LASF1659
+	.byte	0x4
+	.long	.LASF1660
+	.byte	0x2
+	.long	.LASF1661
+	.byte	0x4
+	.long	.LASF1662
+	.byte	0x4
+	.long	.LASF1663
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1473:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1109:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF966:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF801:
+	.string	"USE_CLI "
+.LASF1229:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1327:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_PPM"
+.LASF1247:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1477:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1376:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF965:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1115:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1494:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1515:
+	.string	"_Bool"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1076:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1524:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1464:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1589:
+	.string	"changeControlRateProfile"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF971:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1166:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1116:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1400:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF987:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1105:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF1469:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1025:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1441:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1179:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1387:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1521:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1476:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1499:
+	.string	"uint16_t"
+.LASF1169:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1479:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1010:
+	.string	"PG_RX_CONFIG 24"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF1508:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF977:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1375:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1133:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1102:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF1414:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1289:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1021:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1255:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1097:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1325:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF975:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1584:
+	.string	"controlRateConfig_t"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1128:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1236:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1432:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1158:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1590:
+	.string	"setControlRateProfile"
+.LASF1292:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1029:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1468:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1528:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1548:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1136:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1487:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1083:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1094:
+	.string	"BIT(x) (1 << (x))"
+.LASF1553:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1072:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF970:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1144:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1295:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF883:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF1444:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1390:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1107:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1211:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1550:
+	.string	"OWNER_BARO_EXTI"
+.LASF1006:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF546:
+	.string	"__always_inline"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF898:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1527:
+	.string	"OWNER_SERIAL_TX"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1090:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1026:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1039:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1040:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1507:
+	.string	"PGR_SIZE_MASK"
+.LASF1214:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1207:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1578:
+	.string	"thrExpo8"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1330:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1370:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1443:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1551:
+	.string	"OWNER_USB"
+.LASF1175:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1057:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF1562:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1287:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1135:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1598:
+	.string	"memcpy"
+.LASF1352:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1159:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1532:
+	.string	"OWNER_SONAR_ECHO"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1393:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF1339:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1018:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1061:
+	.string	"PG_VTX_CONFIG 515"
+.LASF968:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1520:
+	.string	"OWNER_SERVO"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF881:
+	.string	"ACC "
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF803:
+	.string	"USE_PWM "
+.LASF1423:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF1486:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1219:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF967:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1461:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1137:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1142:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1495:
+	.string	"__uint16_t"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1519:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1226:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1547:
+	.string	"OWNER_RX_SPI_CS"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF954:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1259:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1201:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1114:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1145:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1436:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1583:
+	.string	"ratesType"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF964:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF949:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1262:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1088:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1267:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1454:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1488:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1068:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1071:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF969:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1581:
+	.string	"rcYawExpo8"
+.LASF1396:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1456:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1019:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1342:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1002:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1049:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF997:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF973:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1433:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1415:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1231:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF879:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1276:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1073:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF1563:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1183:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF959:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1151:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF950:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1509:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1449:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1559:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1418:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1249:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1254:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1343:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1333:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1322:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1541:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1439:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1385:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1228:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1304:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1220:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1593:
+	.string	"controlRateConfig"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1138:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1190:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1505:
+	.string	"PGR_PGN_MASK"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1582:
+	.string	"tpa_breakpoint"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1564:
+	.string	"systemConfig_s"
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1459:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1345:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1388:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1024:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1471:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1034:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1059:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1125:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1430:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1193:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1216:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1552:
+	.string	"OWNER_USB_DETECT"
+.LASF1310:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1452:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1078:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1075:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1511:
+	.string	"size"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1044:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1279:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1284:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1599:
+	.string	"controlRateProfilesMutable"
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1463:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1148:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1556:
+	.string	"OWNER_INVERTER"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF1500:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1288:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1536:
+	.string	"OWNER_SPI_MOSI"
+.LASF1442:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1510:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1498:
+	.string	"uint8_t"
+.LASF1187:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF1092:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF955:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF1038:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1294:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1465:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1070:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1066:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1381:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1408:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1300:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1572:
+	.string	"RATES_TYPE_ACTUAL"
+.LASF1435:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF822:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1108:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1518:
+	.string	"OWNER_PPMINPUT"
+.LASF1502:
+	.string	"FD_PITCH"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF958:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1455:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1210:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1139:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1238:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1004:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1096:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1036:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1012:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF986:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF976:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1154:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1577:
+	.string	"thrMid8"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1177:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1223:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF1391:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1337:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF1372:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1354:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1417:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1566:
+	.string	"activeRateProfile"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1157:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1283:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF1112:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1058:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1420:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1531:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1512:
+	.string	"address"
+.LASF1411:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1357:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1264:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1160:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1082:
+	.string	"IOCFG_IPU 0"
+.LASF985:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1303:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1282:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1575:
+	.string	"rcYawRate8"
+.LASF1533:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF974:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF499:
+	.string	"__PMT"
+.LASF1592:
+	.string	"pgResetFn_controlRateProfiles"
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1398:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1110:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1309:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1516:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1274:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF994:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1315:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1186:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1149:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1156:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1258:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF962:
+	.string	"UNIT_TESTED "
+.LASF993:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1340:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF1119:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1319:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1596:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF972:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1152:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1140:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1286:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1118:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1429:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1569:
+	.string	"name"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1202:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1360:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF1045:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1587:
+	.string	"currentControlRateProfile"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF988:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1402:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1161:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1150:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF802:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1131:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1240:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1205:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1513:
+	.string	"reset"
+.LASF1192:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF995:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1085:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1539:
+	.string	"OWNER_SDCARD"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1595:
+	.string	"_index"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1460:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1035:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1307:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1489:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1492:
+	.string	"signed char"
+.LASF1570:
+	.string	"systemConfig_t"
+.LASF1594:
+	.string	"_reset_template_42"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1208:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1171:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1457:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF1403:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1003:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1032:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF787:
+	.string	"__need_NULL"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1042:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1366:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1285:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF1184:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1384:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1117:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1567:
+	.string	"debug_mode"
+.LASF1122:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1484:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1501:
+	.string	"FD_ROLL"
+.LASF1011:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1363:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1015:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1197:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF1065:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1554:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1458:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1506:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1165:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1424:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1020:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1074:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1053:
+	.string	"PG_PPM_CONFIG 507"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1126:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1163:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1200:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1106:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1141:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF1099:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1270:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1017:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1080:
+	.string	"IOCFG_AF_OD 0"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1132:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1250:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF929:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF982:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF821:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1318:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF1174:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1113:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1014:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1406:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1503:
+	.string	"FD_YAW"
+.LASF1496:
+	.string	"long int"
+.LASF1235:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1007:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1253:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1529:
+	.string	"OWNER_PINDEBUG"
+.LASF1180:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1447:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1280:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF998:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1091:
+	.string	"EXPAND_I(x) x"
+.LASF1256:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1213:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1591:
+	.string	"controlRateProfileIndex"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1565:
+	.string	"pidProfileIndex"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1033:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1050:
+	.string	"PG_PID_CONFIG 504"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF1573:
+	.string	"controlRateConfig_s"
+.LASF522:
+	.string	"__flexarr []"
+.LASF813:
+	.string	"LED_STRIP "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF963:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1030:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF984:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF990:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1196:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1060:
+	.string	"PG_VCD_CONFIG 514"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1245:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1271:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1530:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1031:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1379:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1409:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1355:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF1123:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1497:
+	.string	"char"
+.LASF1252:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1576:
+	.string	"rcExpo8"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1189:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1336:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1079:
+	.string	"IOCFG_AF_PP 0"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1316:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF888:
+	.string	"USE_UART2 "
+.LASF1579:
+	.string	"rates"
+.LASF981:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1069:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF989:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1324:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF1087:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1298:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1472:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF951:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1167:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1023:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1301:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1480:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1542:
+	.string	"OWNER_FLASH_CS"
+.LASF1585:
+	.string	"systemConfig_System"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1089:
+	.string	"STR_HELPER(x) #x"
+.LASF1597:
+	.string	"generateRcCurves"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1028:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF1534:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1217:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1067:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1526:
+	.string	"OWNER_ADC_RSSI"
+.LASF960:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1378:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1195:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1233:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF983:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1170:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1586:
+	.string	"controlRateProfiles_SystemArray"
+.LASF1052:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1358:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1321:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1237:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1278:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1453:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1399:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1475:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF1181:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1041:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF978:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1043:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF979:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1051:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1369:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1225:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1063:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1537:
+	.string	"OWNER_I2C_SCL"
+.LASF1535:
+	.string	"OWNER_SPI_MISO"
+.LASF1130:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1560:
+	.string	"OWNER_COMPASS_CS"
+.LASF1098:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1153:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF991:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1234:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1421:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1273:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1538:
+	.string	"OWNER_I2C_SDA"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF953:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1382:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1008:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1580:
+	.string	"dynThrPID"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1427:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1172:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1543:
+	.string	"OWNER_FLASH"
+.LASF1462:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1037:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1016:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1081:
+	.string	"IOCFG_IPD 0"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1361:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1568:
+	.string	"task_statistics"
+.LASF957:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF1392:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1373:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF1111:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1129:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1478:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1147:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1232:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1348:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1124:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1013:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1191:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1265:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1331:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1555:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF1367:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1558:
+	.string	"OWNER_TRANSPONDER"
+.LASF1009:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF956:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1277:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1164:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1134:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1095:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1588:
+	.string	"controlRateProfiles_Registry"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1545:
+	.string	"OWNER_MPU_CS"
+.LASF1504:
+	.string	"pgn_t"
+.LASF1055:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1168:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1426:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF885:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1364:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1100:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1005:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF1571:
+	.string	"RATES_TYPE_BETAFLIGHT"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1445:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1291:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF992:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1101:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1048:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1523:
+	.string	"OWNER_ADC_BATT"
+.LASF1022:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF1268:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1297:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1143:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF952:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1405:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1351:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1162:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1517:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1246:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1467:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1574:
+	.string	"rcRate8"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF961:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1600:
+	.string	"systemConfigMutable"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1328:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1146:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1093:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1466:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1120:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1450:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1222:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1077:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1485:
+	.string	"BEEP_ON do {} while(0)"
+.LASF996:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1540:
+	.string	"OWNER_SDCARD_CS"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1127:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1313:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1448:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1334:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1394:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1243:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1199:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1056:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1491:
+	.string	"long unsigned int"
+.LASF1103:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1557:
+	.string	"OWNER_LED_STRIP"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1084:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1483:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1470:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1000:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF1027:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1121:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1306:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1104:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1178:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1544:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1046:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1204:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1490:
+	.string	"unsigned int"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF1312:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1474:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1086:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1412:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1062:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1054:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1349:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1522:
+	.string	"OWNER_ADC"
+.LASF1493:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1549:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1514:
+	.string	"pgRegistry_t"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1434:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1482:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1241:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1451:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1397:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF999:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1001:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1525:
+	.string	"OWNER_ADC_EXT"
+.LASF1047:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1194:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1546:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1438:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF980:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1064:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1481:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1244:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1653:
+	.string	"io_types.h"
+.LASF1635:
+	.string	"long-double.h"
+.LASF1643:
+	.string	"__locale_t.h"
+.LASF1645:
+	.string	"platform.h"
+.LASF1604:
+	.string	"src/main/drivers"
+.LASF1655:
+	.string	"rx_pwm.h"
+.LASF1629:
+	.string	"libc-header-start.h"
+.LASF1612:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1644:
+	.string	"strings.h"
+.LASF1602:
+	.string	"src/main/common"
+.LASF1641:
+	.string	"stdint-intn.h"
+.LASF1647:
+	.string	"target.h"
+.LASF1619:
+	.string	"axis.h"
+.LASF1611:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1614:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1636:
+	.string	"stubs.h"
+.LASF1606:
+	.string	"src/main/target/SITL"
+.LASF1633:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1622:
+	.string	"controlrate_profile.h"
+.LASF1610:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1621:
+	.string	"config.h"
+.LASF1624:
+	.string	"fc_rc.h"
+.LASF1631:
+	.string	"features-time64.h"
+.LASF0:
+	.string	"./src/main/fc/controlrate_profile.c"
+.LASF1662:
+	.string	"sound_beeper.h"
+.LASF1615:
+	.string	"types.h"
+.LASF1627:
+	.string	"stdbool.h"
+.LASF1613:
+	.string	"/usr/include"
+.LASF1601:
+	.string	"src/main/build"
+.LASF1623:
+	.string	"controlrate_profile.c"
+.LASF1630:
+	.string	"features.h"
+.LASF1646:
+	.string	"common.h"
+.LASF1638:
+	.string	"typesizes.h"
+.LASF1642:
+	.string	"locale_t.h"
+.LASF1657:
+	.string	"serial.h"
+.LASF1603:
+	.string	"src/main/config"
+.LASF1654:
+	.string	"flash.h"
+.LASF1639:
+	.string	"time64.h"
+.LASF1616:
+	.string	"stdint-uintn.h"
+.LASF1607:
+	.string	"src/main/target"
+.LASF1660:
+	.string	"utils.h"
+.LASF1663:
+	.string	"vcd.h"
+.LASF1608:
+	.string	"src/main"
+.LASF1620:
+	.string	"resource.h"
+.LASF1649:
+	.string	"config_reset.h"
+.LASF1640:
+	.string	"wchar.h"
+.LASF1659:
+	.string	"io_def.h"
+.LASF1605:
+	.string	"src/main/fc"
+.LASF1658:
+	.string	"io.h"
+.LASF1609:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1625:
+	.string	"string.h"
+.LASF1634:
+	.string	"cdefs.h"
+.LASF1656:
+	.string	"sdcard.h"
+.LASF1628:
+	.string	"stdint.h"
+.LASF1650:
+	.string	"build_config.h"
+.LASF1617:
+	.string	"stddef.h"
+.LASF1637:
+	.string	"stubs-64.h"
+.LASF1632:
+	.string	"wordsize.h"
+.LASF1661:
+	.string	"io_def_generated.h"
+.LASF1648:
+	.string	"common_post.h"
+.LASF1652:
+	.string	"adc.h"
+.LASF1618:
+	.string	"parameter_group.h"
+.LASF1626:
+	.string	"stdc-predef.h"
+.LASF1651:
+	.string	"parameter_group_ids.h"
+	.text
+	.section	.gnu.lto_.profile.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375 K\375\001"
+	.string	"4\003?"
+	.string	"\007"
+	.string	"\367\371\352\363\002"
+	.string	"\001\311\224\262\301\003\002\276\230\226\205\004\004\002"
+	.string	"\002\001\002\002\002\002\004\240\342\234\212\n\005\006\304\242\217\252\r\007\255\254\266\265\001"
+	.string	"\003"
+	.ascii	">\2530\345\276\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375 3\025\001"
+	.string	"\260'"
+	.string	"\003"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001"
+	.string	""
+	.string	"\001\002\001\006\001"
+	.string	"\001"
+	.string	"\004"
+	.ascii	"@F\314Kl\026\264\001,"
+	.text
+	.section	.gnu.lto_.inline.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375 \304\235\003"
+	.string	"\302\306\023\034\240'\351\017\276x\253\352Y\204\245\242\345\326\354\377\340PUU^\266\227%yo)S\377'SH{\006z\230/\345\324\200k\321\366<qS\030bb\276\002\033m\221\371\373\301B?A\375s\022\330\266\346\017\\\332&\374!\310\321\236\300\323\214\r"
+	.string	"X\215\200\353"
+	.ascii	"\217\247\344\016\221\245\t=\226.\326b)\024\030+\302\355\246b"
+	.ascii	"\n\244\202\331@\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375 []\002"
+	.string	"\244\003O"
+	.string	"\003"
+	.string	"\001\001\003\177\002\004\006"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\003\002\005x"
+	.string	"\001\002\006s\001\001\006s\001\177\002\006\333"
+	.string	"\001\016\016"
+	.string	"\002\003\006\001\001\003\177\002\003"
+	.string	""
+	.string	"\005"
+	.ascii	"A\020\024*\030\237\327&\263\340\r\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\230\004\002\230\004\006\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375 S\325\001"
+	.string	"\324\002?"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\003"
+	.string	"\001\274\006"
+	.string	"\260\204\200\370\267\004\002"
+	.string	"\002\002\007\001"
+	.string	"\002\004"
+	.string	"\001\002\004\001"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\0071cO313"
+	.string	"\004"
+	.ascii	"r\376\002\215\003\\\006P\004"
+	.text
+	.section	.gnu.lto_.lto.6c67322de0b3e074,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_controlRateProfiles_Registry.31.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375 \216=\004"
+	.string	"\264\007P"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\303\246\273\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\324\006us"
+	.string	"\005\001\006'\001*\214 ?\202\210\200(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/fc/controlrate_profile.c"
+	.string	"\003"
+	.ascii	")\"\201(\362\006P\004"
+	.text
+	.section	.gnu.lto_pgResetFn_controlRateProfiles.32.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375`\377\001\035\022"
+	.string	"\226czG\320\322(\035B\313\246\003Y$:j\333j\225\025\203\370\023\f\216^\025l]V\300h\261\301\234\272p\002|\253\223\330\373W\270"
+	.string	"\233\262=\002\242\037j\024\253em\035\303=\034\033C\020fe\215\246\021\233%{K\231Rc"
+	.string	"a"
+	.string	"e"
+	.string	"\250\247\375\235\247\210\235\247\303Evm\214\204vq'VPz4\356$\336c\351#\336\243c\366\216\001/\001`\300\350|\354\356IEX\017q7\314\330#\324\214\371=\027\331\221=B\001\273\033r{\201\b2\346FKXb\346z\237\223\340\344t\004\335f\236\244\224\335u\332n n\357\266a\266Wv\022\b\rhf>\207:5'!c\324csg\343d\2517\366\277\273k\265\261\277\363\374\244\347n\370\264j:5}"
+	.ascii	"\033`\200H\200v?\034\001\331\0331FN\346s\237\020\312\327\331"
+	.ascii	"\246O\207\362q\276\217M\217\337\017\312\266\257\342+b\317y\b"
+	.ascii	".\013\007;2\212v\327\344\321\252\322c\t\274\311\376P\004\271"
+	.ascii	"\363\201C\375\364\265\020\264<z\340\275(*\345\177\376\237\273"
+	.ascii	"x\305\032#vk\267\371-\036\204\001\036\347\321\034^\336m\217\376"
+	.ascii	"\313{T\2653h\310\333<\302\203\246\2462\247\222T5\202\256v\"\344"
+	.ascii	"\246\341]S_3A\313#C\275J\030\202\t2\313#\217\360\250Y\335K9t"
+	.ascii	"pl\356TwW\2466\371s\017\254;\301\212\001\205\005\025V+\224\002"
+	.ascii	"\026X\253\226\226\212\n\266\002A\304)\024\025\013k\325r\271L"
+	.ascii	"P\301V\\,-\027\254\245\225:\245V\247\026\326\312\205S\312\365"
+	.ascii	":\241\030p\313E\345:\301Z-\327\311\204\333\177\325\306\3579\314"
+	.ascii	"\2211*\232)-\352\215I3\364S%J\223C\215\261\355\223CU!\362\220"
+	.ascii	"?l\324@M\231\345\356\020~\372\334Kf\001$ `\0021v\263\r\354\357"
+	.ascii	"E\223p\250\351(\331he\275 [W\356\306I,.\330\252\227\215Y\202"
+	.ascii	"\355\322\252\306\305\210\3000\006\252c0\006A\214N\024\3108-4"
+	.ascii	"\037\0227k\375(\211\345vM0\344~\177\305m\226a\021\356\305!\354"
+	.ascii	"\341wG\001\0231]\375\t"
+	.text
+	.section	.gnu.lto_setControlRateProfile.33.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375`\373\001\245\021"
+	.string	"\226\337rH\340\360&\035\312\035\324\023]\304\272\366\013\300c\326I\262\022\345\270\310"
+	.string	"\215\261M\004\2053k\037\216\306\2306\320(\304X!\202\334W\360\246[/a\035q\0179\317Dhn\r&C\271zt\230\216Ck\355\223\275\367N)X"
+	.string	"\\"
+	.string	"c"
+	.string	"2\266\352\365\276Ph\253\354\324\316\003)\037d\222\222\360@3\236\273:F+v\307\021#@\275:\264e\f\300"
+	.string	"\340vSdcw\273\t\342\341\351\224\241\357q\222\022k4\247\035>\003\324l\350jw\037t\231\241V#\245\307\311\356Z\212\265\rw\275m\006\266sl\371\0218\fr\203\261\362f\2175r\362\330\247;wl*\315\035\350\237R\372\250\0039!L\2738O9v\251\"\375\370C/\222\271\220O\004aH\365j;\\\331\214\004\230\\"
+	.string	"\031xM9\331\374\361$d^\302-\350\270\265\017\r/n\222F^\315\202z]\035\204{\245\027\300\275\372C\001\362\246\"\206&5\211\027\236b\002\255\321\264\273&F?\202\261\304b\334+7\035\034\2119/:\212\210\017D\277\016\317\b\234\036\032\237\267}E\373\2441nv<\315i\177G1#\022bw\023\370&~\242\202\357\363\352\027\030y\021\206{-\351\361@\223O\366t\310\335\245\231\223G~\206\233S\305\246d#\003\246"
+	.ascii	"K\341L\362R\240b\262\362z\261D,x+\262\006\021\274Y\013%\304."
+	.ascii	"\226\327\002{}\240K\2127k\201-\0378\223}\256\316\365\352d\260"
+	.ascii	"V\254s\201/\035\253\200?\027\017\354f\337\007v\252\221v\272s"
+	.ascii	"g\001\207%\332\254\241\334\364Y\034)\306\367\261\313\223\027"
+	.ascii	"=%q\206o\373\203.\341\307\351\206\023-* 0\002b\230\204;\316\t"
+	.ascii	"P\256_\372KnhQ%\234Lw0l@\253\211\205\267{\331\337\270\205\305"
+	.ascii	"@\025\225p<\360\206\020 \274a \017\234:\221\271\225\270\017\300"
+	.ascii	"2\246\024\376\356\035\267\303u}D\312\267\2775\0239*j\3573=c\034"
+	.ascii	"\234-\362\n\315\020MC0.\270h&\274e0,Rn\273\212\036"
+	.text
+	.section	.gnu.lto_changeControlRateProfile.34.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375`?\002e\023"
+	.string	"\006#~I\300RN:\212\206\t;a\255\255\376\320f\2309\305cH9~\033\244\"(K\360\331\210#cn\027\234\317li5\240\252\251\306Y\013Y\272M$"
+	.string	"\275\320\217n\2032\362i5\375\357@I\033Deo\303\237\311&{\247\024c"
+	.string	"h"
+	.string	"k"
+	.string	"I\337\366\240\350rv\273%\202W\326\217\312\234Or\211I\315s5\021\224\036\336\256\254\361\221l\354\326\353[6\253\203\312\234v\211\211\355\271\232\351\256\017\024\213\3352\201\025\200\274\332f\343x\031\264\327\345\340(\355\330\335\220\216\270\355\323\346\377\350,r\347\346\023@\312\356z\222;\037nz\333\006l\363\330SC\364J\034\256p\263\347\271\004\202j'\317.q\223\002\331\377\226\376\330\34048\247k\235\376\236\373\317\002K\324\020\251\332\325\351\365\330\251\032E\344#\335\311\346(\374&\bH;l\256\re\201*\031\271\035\223\257\364%\233\247\360\213\257\334\035\001\036f\340H\271\200\274\272>"
+	.string	"|\375\036\002^g\327\334\204\177B\202\n\243\335m=\023\210v<v\267\311\223\242\371\244\254\310;\331\264\273\200}WV\273{\322\342Q\342\005\231\f|\005\351\203'\222\307\351+E\"\336\364\373"
+	.ascii	"\031\351\b\351\250\364Lw\335*\375n\340\374\020{\037\275\316."
+	.ascii	"\207"
+	.string	"\252\215\004\355\356\002\377\351+`\374\241W\2173\363\344\f\370j\"\024\3426{\276\356 6|<w\247\334&\317\3635\360\364\013\306 c\001]\022c`\341\244%\026#\031\311 \266\3048\210 \322^+\004\f#\021_d\261q&\303\"\322^\263\227qF\213\031a!,\026\306\310^0!lF\023\222\034\360(#\316B\3328\316\302Vy\373\267\364\247A\321\324\215\342\0342m\n\025\346I\273p\364\306?z\200%\022T \365a<\006\215?d\226\327<\371\242A\346\360\231~\335\003/ @\002B\034\324m\316\tP\257_\376Knh\321\022\216\246Qd\270*\265\373\263\373a/\343\356 h+\301\366\311\320\002\233\225a\254\232\350T\353p\021x\031[J.0>\273\367fv\261\210\361\314\303\313\264xo\241\217\204cW\300\274\0023\322\006\354B\335X\226\001 \246\036\232\030\326o\025\030Q\371\270\r"
+	.ascii	"\303dC`B\036tn\321\276'"
+	.text
+	.section	.gnu.lto__reset_template_42.0.36.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375 \\\225\002"
+	.string	"4\004K"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\005\001\006\035\001'\001\362\f\n\005\001'\002\002\1772\344"
+	.string	"?\202\210\200\320\001}{\300\001y\300\001w\273\001u\277\001s\273\001q\276\001o\275\001m\273\001k\274\001i\273\001"
+	.string	"\003FFF\005"
+	.ascii	")\"^\316\300l\222\2624\006\212"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375 \321u\004"
+	.string	"\324\006\315"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002 \177\b\200\200\200\200\001\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005$\005\200\204\001"
+	.string	""
+	.string	"\003\002!\177\t\004\200%\n \035\013\201"
+	.string	"\005\034\f\002\"\177\r\037\016\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\001#\177\017\377\037"
+	.string	""
+	.string	"\200\200\200\001&\177\020\003"
+	.string	"\b\201\200\200\200\003\001\244\006\003\006\344\007"
+	.string	"\f"
+	.ascii	"!\223}\237\"$25<\301\302e\230\252\237Y\206\200\030K\205\001\343"
+	.ascii	"@1\221@\351\001"
+	.text
+	.section	.gnu.lto_.refs.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375 -i\001"
+	.string	")"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\t"
+	.string	"\003\002\001\003\004"
+	.string	"\002\004\n"
+	.string	"\001\005\f"
+	.string	"\003\006\001\003\005"
+	.string	"\002\004\013"
+	.string	"\001\005\r"
+	.string	"\002\007\002\004\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6c67322de0b3e074,"e",@progbits
+	.string	"(\265/\375`\300\022\225`"
+	.string	"*\251"
+	.string	"%T0RBJ\007\252\206\272N\001\031q\300l\002\346\325\352\363Pb\204"
+	.string	"\032\221pJ5+\002\257/\266h\302Q\332\350\252\370/\177?\356\224\231\355\316E\215Z\305\277\373\231\377\177\3144\310\f\321"
+	.ascii	" \312\264\244pV\254\252,\255HL\2658D\367[\311\2272\005\360\001"
+	.ascii	"A\002F\0029\354\373\311\276\217\366\314\345g'x\214\233\303 T"
+	.ascii	"`\2152\023@\3476\\\323\311R\2313\026\307;"
+	.string	"\272\026\f\306\236\263\330\213\261q\023\314|\200\253\234\231`\264\347\214\353]\033\b3cJ\032=;\355\371\001\035\356\355\215\037\320\235\321l7\235k\374\304\206\n\016T\2344z\t\222p\032#\213Z\242\245q\363\246\230s\225\330\240\2261`\304\340'\214\0047q\353r\027\226\365\364\274w=w\375@O\330\213\305p\353\362\336\254+\007\214e\312\266\334\356\275PX\n\253q\024\236\302L~\302M\316NX\211\363\352\242\007\227\004T\023X\r\312Z\314\243\343\341\036\366\feO\203\375\0136\207yt\\\306f\314\\\301g+\216\315\231#g\3104z\240\255\t:3y\r\343\215q\025\366\274B\307o\274B\367\032\333\303b?\037\301+\207\261p\357\361\336;\300\215\223\b\021+\215\362\022\006;\207\361\327a\3048\256\230\344r\335{9l\002\345\275F\016\303)s\257\021\2079\001\346\004P$YA\310t\350w\226\223"
+	.string	"\235\225\354\350\222S\353\305I\301|nE5\232\323\226\221\314\243\323\341\035\035\013\346\321\375l\304\317[\314\265\002\207tR^\261{W\035\234U\307\223\217F\2772\217\316\362\216\356\377\230\377o\377\313\3747\363\377\314\1772?\363\377(\376\213\371\357\366s\333\377\232\277\033\370\031h\343*\036\300\337A\214\373\031\201C\221\201c\370\177\302q\376\226\340g\342\317:G\377W8\357o\004~\006\341\347\021~&\341\347\020~.\341g\032F?W\360s\320\317\037\270\360\337\346\357\036~n\341g\242\237M\370\231\201\237\025\370\231\305\317\006\374L\300\3178?\363\374\274\3633"
+	.ascii	"?\243\377\317~\316\375\237\362\237\353\277\316\177\265\377\272"
+	.ascii	"\267\267\267\267\237\235~\034\363\277I!:\354h*\276I2\350Y\023"
+	.ascii	"\256\252\2517\325V\332\272\203\233YPl9\373a;\007\312D\006\365"
+	.ascii	"cG\0168\254\033\216\256FyhA|\204\233\351\235l\251\306\201\201"
+	.ascii	"\0222\327\214\362\274\311\034^\254\307\235&\2249\032=z\264\274"
+	.ascii	"eP#\373\206\367\215\337\350(\236\272\270-g=\316\270\335\251\251"
+	.ascii	"\02647P\255\231\201zG\235K\315U\221c\3422\023\322\350\303\364"
+	.ascii	"S\356\t\255\246\344\223\023W\001aZj%\032\033\216_\2544\312\354"
+	.ascii	"&\006\223\242\013\210 Cx\331\277\177\3355&\357\2758r\353M*\325"
+	.ascii	"\234s\314-~\033\306\261\002\377Q\034\005\316{\213(\301X!gF\036"
+	.ascii	"\315\342bp\213F\216F)\235\273\336$\362\013\253\210\\BEJg\275"
+	.ascii	"W\003\334/\037\027\271bI\241\312\333w\275|\217XR/ We\022\271"
+	.ascii	"*\2139\367\250,\336\273J\345 \305\214EF~aI!\277\224R:\367x\213"
+	.ascii	"\367\313xe\217J)\244\024\245T\016\362\313(\205<bI\351\020Q\002"
+	.ascii	"\201\322D\204\321\t\366B\036/\324S\2251\231\343D\256\312\213"
+	.ascii	"\345^\026"
+	.string	"[\272I\005\356\255R&\261\030wpS\311\t\245dfT\362z\357%\340I)Ky\217N\344\020\345\275C\224\212\356\323\004\305\325y}`g\321G\325uZ\272\267\200\247{\213|\235\367\336\342\275w\227\254Z\357\325!\007\271|z\272w\252\347\351V\025\321\226\356m1-M)\344W\226\022\b\r\354ky\231\326\"//\026\254\244\375*z]\247/v)\205\203\227F\217c\262\177/\331\200\352@.\361j\364o\033\372h&\2107\246F[\251\007gkL\016\263F\337_\354y\354\311MvN]\200\204\214L_6\303g\370\215\313\264\221\307\260\033G\301\314.2\230s\030\206\342\275\336{tv\221\251\260\025vja\300u\366\324\362\003u\221\2670\027\243\331\222\271\2620\271\202\205\331\325\245l\t1O\236\030\223\340\0137op\367\3668\242\213\354e=@L\007\227\221{W\027=.x7n\2249!"
+	.string	"\372\376\262\1772\217\356fi\337Z\366me\337\001eF\304Dq\273\310\251\0267M]\260xh\347\373\312\333\n\214\030o\013\376"
+	.ascii	"\003k\264\253\234}\370\002\206d\353&\206\330bv\246\3156\025\b"
+	.ascii	"\254\306\\\225a\"\205\026\025 E4\332K\274\355OiEX5\332k\357b"
+	.ascii	"c\346\245U\325SpkYlJ\215v\224Vc\346\325Z\312o\322\230\306\324"
+	.ascii	"\254\330\327\300W\323\265\022\357'?\217\227\326\203\007\2545"
+	.ascii	"'?oGf\205\307\022\212\275.\315Z'?\336E0\263\1774\022=^k\361\246"
+	.ascii	"\252\352\205\355au\241\032M[wN@\232\312,\261\227\300\210>\202"
+	.ascii	"H\026\240\255>\302\345\304\323H#\331\3624\353\263n6\223Fcf3{"
+	.ascii	"}\023\351\"\357Ac6\227\026N\302l\257\036c\347T\316=2\335\236"
+	.ascii	"\367^\027.l\256\230\306v\250A\215\274M\205\022\362\203..\317"
+	.ascii	"\261N\322b\354\234Z/\016\032&\317/I\267&\3532f\366\330{\326{"
+	.ascii	"\305\b\260!\223\305\255K'\026V\323\274\301\203\251\321\006\343"
+	.ascii	"/\265&\0379|1\263\227\3400\021aF\210F[\311\333n(\336hz\0234\007"
+	.ascii	"\332\326\224F\257\223\262\3275\331\347\316\330\356\262U\236V"
+	.ascii	"kn\36690\366\271.\366\271+H\372H\356+\n\230\265#\334l\266)"
+	.string	"NJl\266/\363\350X\f\321Bz\310\317\303A\322\374Q\246f\337D\214\360\303\022e\215\242\374&\272\016\362^\376\274V\013\262|rb\337@Z\210\237w\203E\2101/\246}\007Q\366\006\206\252\321\006\302.\345\326\007RX1wh \376\366\241\177\340\260\031\336\314\210i\364X\230Gg\303;\272\356\001\350\255E\263\346\344yD\2435\271,\313;\372\360\321Tv\275Q\254\244\311\346\312+\b\253F\237\273a-W\320\033\213\331Xm\203UB~ \205\354y\223O^\340(-\303P=\255U\022\364\266bf[\265\022\003\255\365\026ukL\222S/\272\210\220 X\032m\345\337=z\207>\262\022gI\314\007\022\215v\223yt.\320\246\325m\005\275y\234\231\315\243u\240\305$\267H\303\306\243\311\213\333\275S/vWSFt\341\262<\035vt\251Q\r\237\232$B\001/\362\371\r{\277\241\237\337\220"
+	.string	"\304\024\206a\222\006?\032\251\352\313\t\002\207*\361'\025J2\372\005\201?Cb\322\217"
+	.string	"FFI\301 Rp\247\366t1 \r\213T\244\340n\310\227\032\2416\204\277\243\364H\247\276\310G\230\2044$\352\rS5=\362\r}\302\237\337/\230D\023\034\352\034\261W\243\366\202D\302\\\220H\210Kg"
+	.string	"\022Q\"1\035\n\t\371vCU\210\023J\203D@#\337N(%&\241A$\240\372K\211\273\017{DB\037\033\033C\225\b$Ji\250H\211\202\276\242_O0\035\016\223~\004\330\360\r\207\031\020M\330\321@M\211<*"
+	.string	"\377\021{\301\016h\020\tW\374\007\034\246\301\224\310~\002\031\020\310\230!\303\3563,\210\300\202\bt\237a\001\020\220\0052\200\354e"
+	.ascii	"\341\"\360\2011\201\221\360"
+	.string	"(U{jJL\207\275"
+	.string	"\324\0271\220\nm\234\300\333\371\rw3\204\200\"\f\213\324\335\260H\265\304\334\006A%\f\213N\b\332\020\342\315@\022\312\300A\f>\025~\303\024jO\006\220U\203@$\241\013\276tX\243\347\023\2527/\362!\002\016\rp$a:\374Q\221\220\206?4\304\036\021p(\210\244\301Q\252\022m\020odH\205\202AB@!N\t\251\352\243\221\302"
+	.ascii	"T\177>\235T\b\351\250G\224T#\025J\241\366f\250A`\322\3560\206"
+	.ascii	"*\2501Chh\310\007\201WP\201\006,P\030\301\003\373\363I\215\200"
+	.ascii	"CHCa/U}C#\244\241\032D\372\375\374\206~\202@\337\321\317oH\374"
+	.ascii	"\361Y\200\370\003\252D\240\352S\211=\027\210>\025g\350+\372\241"
+	.ascii	"\351\221/\210\216\321"
+	.string	"\202\216QieE\241\203\253<\2211i\224\347\f\323naZ\f\257\210\203C\212\016.\267;\225C\213\277\241x\213y\272\371\241\310\016\261\335\220/o0^t\\\361h\264\237h/E\226dY\230o\343\"dKZW\243\335\245\237\327Z\216!\361.\177&\335\206\270i\341re\007\265E\346G\233\222F\21163\313-QD\304T}i\324J\311\362gi-\234\344Fq\330r\314\030\267{\247Z\340\242\234U\251z\230\267\026*C\204 k\364;'k\233\350&o(M\372\n\216\255\346\026\223\334\250]\201L\250\201<\206\2243\"3#\"2\222$\351\001\005\204(\b%\274\033\022`E5\221!\211ff\002MR\247\2603\007\024\337;\240\3365I\344+R:\246\251R\257\"\275DTr+\345\033\376\304|@\2002*\304*K\035\215]\031\243\335\334\234\330\360Q\300\257>\tA\231\360o\371\002\t"
+	.ascii	"hQPE\272\310\266O\352\375O\226\2420\264_\3037\030\261\244b\315"
+	.ascii	"AHQ\337\214AX\314\350\224{\bc\006\273-\224\373\364\303)\240\360"
+	.ascii	"d\200/\2234?\"Rs\360\227\340\371v\301\330\220Ci~bk\2765\244\361"
+	.ascii	"s\334\231\300\003\202YRO\301\371\343eu%\233\222Q{\263\266`X\230"
+	.ascii	"]\317O\212)+\273C\235+\226\002\fLv\257s\274P\\\261=\213o\201"
+	.ascii	"M%r\255\247f\266a|\026\256\345\2168e\2308\237\244\333\305\225"
+	.ascii	"C\233\320\206\032\036\024\307vH@\2178\227D9\365Q\302\312\356"
+	.ascii	"\004XG\224W\322S>JPl\343\315\2676F\031\030\206!\243k\022\340"
+	.ascii	"\244\f_}\336|\304@"
+	.string	"*h\005\035\352\007\365p2ZP\2003?c\227\345i\247\334\316g/\345g\337P\305\037p\217\220\ne\034\350m.R\256\n\3311\2169%\033HRx\236\023\266\362\310@\366\307\326\343\tj\220\365\033\335\215\025\214\376\036\200\306Jr\t\206\364\"x'\302\f\245\205_\3077\302\234\214uT\"\251\355\352>\231\374\r\035\222\fS\362n\215\201>6^}\236\301\f\350wq\230\020\003\317\363Wn\367k\032\360\\\335\013:P\373xB\371\264+\254\252\254\371\364\260\345\243\034\210\215\2329\032H\254\307>,=\376\3509?,g)2\344\005\217\254\006\345\343\2346\363\326{\266iB\0062\b\371a\317`\007:\247`\033P\312\211\204\213P\005*\344\232\363T\351\177!\324S37x\023\314\203>\342\fuN\020O\004'\233R\0363\266&\002P\265$\251\005\035\200|\346\247\250\256\360\013\364j\377\003UMi"
+	.string	"9\300\242\247g\n\303\003\224T\024\240\243\233-\357\343\253\357\264\366\006\f)\356 +\264\251w\203\333\307\313\223=k\030\020\326bfc\3321;\f\023\244J\027"
+	.string	"\035H\227h}-f\nI\217\363\303\016\270\314\026C\021y\032\322+#n\343"
+	.ascii	"}y\376EI\337$'\254\261-vNX\0339\275i\371\350\257e4\\\357pg\321"
+	.ascii	"y\237T\376y1\263A\357\003\001\246\3535\332i\372\207}\265\225"
+	.ascii	"w\340\235\377y\270h\320!\206c\355\257\026\343J\367\237\204S\\"
+	.ascii	"n\242/Q\230\210,D\217e\366\273\200c\272q3\235\217\244\n"
+	.text
+	.section	.gnu.lto_.symtab.6c67322de0b3e074,"e",@progbits
+	.string	"pgResetFn_controlRateProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"setControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"controlRateProfiles_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"*"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"controlRateProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"generateRcCurves"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6c67322de0b3e074,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,18677 @@
+	.file	"fc_core.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/build/debug.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/scheduler/scheduler.h"
+	.file 7 "./src/main/build/profile.h"
+	.file 8 "./src/main/config/parameter_group.h"
+	.file 9 "./src/main/flight/pid.h"
+	.file 10 "./src/main/drivers/sensor.h"
+	.file 11 "./src/main/sensors/sensors.h"
+	.file 12 "./src/main/sensors/acceleration.h"
+	.file 13 "./src/main/sensors/gyro.h"
+	.file 14 "./src/main/fc/cli.h"
+	.file 15 "./src/main/drivers/resource.h"
+	.file 16 "./src/main/fc/config.h"
+	.file 17 "./src/main/fc/controlrate_profile.h"
+	.file 18 "./src/main/fc/fc_core.h"
+	.file 19 "./src/main/fc/rc_controls.h"
+	.file 20 "./src/main/fc/runtime_config.h"
+	.file 21 "./src/main/io/beeper.h"
+	.file 22 "./src/main/rx/rx.h"
+	.file 23 "./src/main/telemetry/telemetry.h"
+	.file 24 "./src/main/flight/imu.h"
+	.file 25 "./src/main/flight/mixer.h"
+	.file 26 "./src/main/flight/servos.h"
+	.file 27 "./src/main/fc/fc_core.c"
+	.file 28 "./src/main/drivers/system.h"
+	.file 29 "./src/main/fc/fc_rc.h"
+	.file 30 "./src/main/flight/altitudehold.h"
+	.file 31 "./src/main/msp/msp_serial.h"
+	.file 32 "./src/main/flight/failsafe.h"
+	.file 33 "./src/main/fc/rc_adjustments.h"
+	.file 34 "./src/main/config/feature.h"
+	.file 35 "./src/main/io/statusindicator.h"
+	.file 36 "./src/main/sensors/barometer.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_core.c.993c4460
+	.weak	fc_core.c.993c4460
+fc_core.c.993c4460:
+	.long	0x1aeb
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x27
+	.long	.LASF2401
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1784
+	.uleb128 0xf
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1785
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1786
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1787
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1788
+	.uleb128 0x3
+	.long	.LASF1789
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1790
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xf
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1791
+	.uleb128 0x3
+	.long	.LASF1792
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1793
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1794
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1795
+	.uleb128 0x3
+	.long	.LASF1796
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x29
+	.byte	0x8
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1797
+	.uleb128 0x3
+	.long	.LASF1798
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1799
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1800
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xa
+	.long	0xc3
+	.uleb128 0x3
+	.long	.LASF1801
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1802
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xa
+	.long	0xe0
+	.uleb128 0x3
+	.long	.LASF1803
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x12
+	.long	0xab
+	.long	0x10d
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1804
+	.byte	0x4
+	.byte	0x15
+	.byte	0x10
+	.long	0xfd
+	.uleb128 0x4
+	.long	.LASF1805
+	.byte	0x4
+	.byte	0x16
+	.byte	0x10
+	.long	0xc3
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1bc
+	.uleb128 0x1
+	.long	.LASF1806
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1807
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1808
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1809
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1810
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1812
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1813
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1814
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1816
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1817
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1818
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1819
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1820
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1821
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1822
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1823
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1824
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1825
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1826
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1827
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1828
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1829
+	.byte	0x5
+	.byte	0x19
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0xa
+	.long	0x1bc
+	.uleb128 0x3
+	.long	.LASF1830
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0xe0
+	.uleb128 0xa
+	.long	0x1cd
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1831
+	.uleb128 0x2a
+	.long	0x1de
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x3c
+	.byte	0xe
+	.long	0x263
+	.uleb128 0x1
+	.long	.LASF1832
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1833
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1834
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1836
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1840
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1841
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1848
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1849
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1850
+	.byte	0x6
+	.byte	0x8b
+	.byte	0x3
+	.long	0x1ea
+	.uleb128 0x4
+	.long	.LASF1851
+	.byte	0x6
+	.byte	0xaf
+	.byte	0x11
+	.long	0xd4
+	.uleb128 0x3
+	.long	.LASF1852
+	.byte	0x7
+	.byte	0x23
+	.byte	0x12
+	.long	0xe0
+	.uleb128 0xa
+	.long	0x27b
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x25
+	.byte	0xe
+	.long	0x2c9
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1861
+	.byte	0x7
+	.byte	0x2e
+	.byte	0x3
+	.long	0x28c
+	.uleb128 0xb
+	.long	.LASF1875
+	.byte	0x10
+	.byte	0x7
+	.byte	0x32
+	.long	0x309
+	.uleb128 0x2
+	.long	.LASF1862
+	.byte	0x7
+	.byte	0x33
+	.byte	0xe
+	.long	0xe0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1863
+	.byte	0x7
+	.byte	0x34
+	.byte	0x14
+	.long	0x27b
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1864
+	.byte	0x7
+	.byte	0x35
+	.byte	0xe
+	.long	0xf1
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1865
+	.byte	0x7
+	.byte	0x36
+	.byte	0x3
+	.long	0x2d5
+	.uleb128 0x12
+	.long	0x309
+	.long	0x325
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x14
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1866
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x17
+	.long	0x315
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1867
+	.uleb128 0x3
+	.long	.LASF1868
+	.byte	0x8
+	.byte	0x19
+	.byte	0x12
+	.long	0xd4
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x21
+	.byte	0xe
+	.long	0x373
+	.uleb128 0xc
+	.long	.LASF1869
+	.value	0xfff
+	.uleb128 0xc
+	.long	.LASF1870
+	.value	0xf000
+	.uleb128 0xc
+	.long	.LASF1871
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1873
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1874
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xf
+	.long	0x37f
+	.uleb128 0x2b
+	.long	0x38f
+	.uleb128 0x9
+	.long	0xa2
+	.uleb128 0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x8
+	.byte	0x35
+	.byte	0x5
+	.long	0x3b0
+	.uleb128 0x17
+	.string	"ptr"
+	.byte	0x8
+	.byte	0x36
+	.byte	0xf
+	.long	0xa2
+	.uleb128 0x17
+	.string	"fn"
+	.byte	0x8
+	.byte	0x37
+	.byte	0x16
+	.long	0x3b0
+	.byte	0
+	.uleb128 0x8
+	.long	0x373
+	.uleb128 0xb
+	.long	.LASF1876
+	.byte	0x20
+	.byte	0x8
+	.byte	0x30
+	.long	0x403
+	.uleb128 0x14
+	.string	"pgn"
+	.byte	0x8
+	.byte	0x31
+	.byte	0xb
+	.long	0x338
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1877
+	.byte	0x8
+	.byte	0x32
+	.byte	0xe
+	.long	0xd4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1878
+	.byte	0x8
+	.byte	0x33
+	.byte	0xe
+	.long	0x403
+	.byte	0x8
+	.uleb128 0x14
+	.string	"ptr"
+	.byte	0x8
+	.byte	0x34
+	.byte	0xf
+	.long	0x408
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1879
+	.byte	0x8
+	.byte	0x38
+	.byte	0x7
+	.long	0x38f
+	.byte	0x18
+	.byte	0
+	.uleb128 0x8
+	.long	0xc3
+	.uleb128 0x8
+	.long	0x403
+	.uleb128 0x3
+	.long	.LASF1880
+	.byte	0x8
+	.byte	0x39
+	.byte	0x3
+	.long	0x3b5
+	.uleb128 0xa
+	.long	0x40d
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x23
+	.byte	0xe
+	.long	0x46d
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1884
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1885
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1887
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1890
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1891
+	.byte	0xa
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x37
+	.byte	0xe
+	.long	0x486
+	.uleb128 0x1
+	.long	.LASF1892
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1893
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1894
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x3
+	.long	0x46d
+	.uleb128 0xb
+	.long	.LASF1895
+	.byte	0x4c
+	.byte	0x9
+	.byte	0x3c
+	.long	0x5ba
+	.uleb128 0x14
+	.string	"P8"
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xd
+	.long	0x5ba
+	.byte	0
+	.uleb128 0x14
+	.string	"I8"
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xd
+	.long	0x5ba
+	.byte	0xa
+	.uleb128 0x14
+	.string	"D8"
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xd
+	.long	0x5ba
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1896
+	.byte	0x9
+	.byte	0x41
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1897
+	.byte	0x9
+	.byte	0x42
+	.byte	0xe
+	.long	0xd4
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1898
+	.byte	0x9
+	.byte	0x43
+	.byte	0xe
+	.long	0xd4
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1899
+	.byte	0x9
+	.byte	0x44
+	.byte	0xe
+	.long	0xd4
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1900
+	.byte	0x9
+	.byte	0x45
+	.byte	0xe
+	.long	0xd4
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1901
+	.byte	0x9
+	.byte	0x46
+	.byte	0xd
+	.long	0xc3
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1902
+	.byte	0x9
+	.byte	0x47
+	.byte	0xb
+	.long	0x331
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF1903
+	.byte	0x9
+	.byte	0x48
+	.byte	0xb
+	.long	0x331
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1904
+	.byte	0x9
+	.byte	0x49
+	.byte	0xd
+	.long	0xc3
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF1905
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xd
+	.long	0xc3
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF1906
+	.byte	0x9
+	.byte	0x4b
+	.byte	0xd
+	.long	0xc3
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF1907
+	.byte	0x9
+	.byte	0x4c
+	.byte	0xd
+	.long	0xc3
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF1908
+	.byte	0x9
+	.byte	0x4d
+	.byte	0xd
+	.long	0xc3
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1909
+	.byte	0x9
+	.byte	0x50
+	.byte	0xe
+	.long	0xd4
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF1910
+	.byte	0x9
+	.byte	0x51
+	.byte	0xb
+	.long	0x331
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1911
+	.byte	0x9
+	.byte	0x52
+	.byte	0xd
+	.long	0xc3
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1912
+	.byte	0x9
+	.byte	0x53
+	.byte	0xd
+	.long	0xc3
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF1913
+	.byte	0x9
+	.byte	0x54
+	.byte	0xb
+	.long	0x331
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF1914
+	.byte	0x9
+	.byte	0x55
+	.byte	0xb
+	.long	0x331
+	.byte	0x48
+	.byte	0
+	.uleb128 0x12
+	.long	0xc3
+	.long	0x5ca
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1915
+	.byte	0x9
+	.byte	0x56
+	.byte	0x3
+	.long	0x492
+	.uleb128 0xa
+	.long	0x5ca
+	.uleb128 0xb
+	.long	.LASF1916
+	.byte	0x2
+	.byte	0x9
+	.byte	0x5f
+	.long	0x602
+	.uleb128 0x2
+	.long	.LASF1917
+	.byte	0x9
+	.byte	0x60
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1918
+	.byte	0x9
+	.byte	0x61
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1919
+	.byte	0x9
+	.byte	0x62
+	.byte	0x3
+	.long	0x5db
+	.uleb128 0xa
+	.long	0x602
+	.uleb128 0x4
+	.long	.LASF1920
+	.byte	0x9
+	.byte	0x64
+	.byte	0x14
+	.long	0x602
+	.uleb128 0x4
+	.long	.LASF1921
+	.byte	0x9
+	.byte	0x6b
+	.byte	0x11
+	.long	0xe0
+	.uleb128 0x12
+	.long	0xc3
+	.long	0x63b
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x19
+	.byte	0xe
+	.long	0x67e
+	.uleb128 0x1
+	.long	.LASF1922
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1923
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1924
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1925
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1926
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1928
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1929
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1930
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1931
+	.byte	0xa
+	.byte	0x23
+	.byte	0x3
+	.long	0x63b
+	.uleb128 0x12
+	.long	0xab
+	.long	0x69a
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x14
+	.byte	0xe
+	.long	0x6c5
+	.uleb128 0x1
+	.long	.LASF1932
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1933
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1934
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1935
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1936
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1937
+	.byte	0x6
+	.byte	0xb
+	.byte	0x1e
+	.long	0x6f9
+	.uleb128 0x2
+	.long	.LASF1938
+	.byte	0xb
+	.byte	0x1f
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1939
+	.byte	0xb
+	.byte	0x20
+	.byte	0xd
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x14
+	.string	"yaw"
+	.byte	0xb
+	.byte	0x21
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1940
+	.byte	0xb
+	.byte	0x22
+	.byte	0x3
+	.long	0x6c5
+	.uleb128 0x21
+	.long	.LASF1952
+	.byte	0x6
+	.byte	0xb
+	.byte	0x24
+	.long	0x72a
+	.uleb128 0x17
+	.string	"raw"
+	.byte	0xb
+	.byte	0x25
+	.byte	0xd
+	.long	0x68a
+	.uleb128 0x1d
+	.long	.LASF1941
+	.byte	0xb
+	.byte	0x26
+	.byte	0x1f
+	.long	0x6f9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1942
+	.byte	0xb
+	.byte	0x27
+	.byte	0x3
+	.long	0x705
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x2d
+	.byte	0xe
+	.long	0x76d
+	.uleb128 0x1
+	.long	.LASF1943
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1944
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1945
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1946
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1947
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1948
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0x40
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1950
+	.byte	0x4
+	.byte	0xc
+	.byte	0x35
+	.long	0x794
+	.uleb128 0x2
+	.long	.LASF1938
+	.byte	0xc
+	.byte	0x36
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1939
+	.byte	0xc
+	.byte	0x37
+	.byte	0xd
+	.long	0xab
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1951
+	.byte	0xc
+	.byte	0x38
+	.byte	0x3
+	.long	0x76d
+	.uleb128 0x21
+	.long	.LASF1953
+	.byte	0x4
+	.byte	0xc
+	.byte	0x3a
+	.long	0x7c5
+	.uleb128 0x17
+	.string	"raw"
+	.byte	0xc
+	.byte	0x3b
+	.byte	0xd
+	.long	0x7ca
+	.uleb128 0x1d
+	.long	.LASF1941
+	.byte	0xc
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x794
+	.byte	0
+	.uleb128 0xa
+	.long	0x7a0
+	.uleb128 0x12
+	.long	0xab
+	.long	0x7da
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1954
+	.byte	0xc
+	.byte	0x3d
+	.byte	0x3
+	.long	0x7a0
+	.uleb128 0xb
+	.long	.LASF1955
+	.byte	0x14
+	.byte	0xc
+	.byte	0x40
+	.long	0x834
+	.uleb128 0x2
+	.long	.LASF1956
+	.byte	0xc
+	.byte	0x41
+	.byte	0xe
+	.long	0xd4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1957
+	.byte	0xc
+	.byte	0x42
+	.byte	0x14
+	.long	0x67e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1958
+	.byte	0xc
+	.byte	0x43
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1959
+	.byte	0xc
+	.byte	0x44
+	.byte	0x1b
+	.long	0x72a
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1960
+	.byte	0xc
+	.byte	0x45
+	.byte	0x19
+	.long	0x7da
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1961
+	.byte	0xc
+	.byte	0x46
+	.byte	0x3
+	.long	0x7e6
+	.uleb128 0xa
+	.long	0x834
+	.uleb128 0x4
+	.long	.LASF1962
+	.byte	0xc
+	.byte	0x48
+	.byte	0x1e
+	.long	0x834
+	.uleb128 0xb
+	.long	.LASF1963
+	.byte	0x1c
+	.byte	0xd
+	.byte	0x33
+	.long	0x92e
+	.uleb128 0x2
+	.long	.LASF1964
+	.byte	0xd
+	.byte	0x34
+	.byte	0x14
+	.long	0x67e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1965
+	.byte	0xd
+	.byte	0x35
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1966
+	.byte	0xd
+	.byte	0x36
+	.byte	0xd
+	.long	0xc3
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1967
+	.byte	0xd
+	.byte	0x37
+	.byte	0xd
+	.long	0xc3
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1968
+	.byte	0xd
+	.byte	0x38
+	.byte	0xd
+	.long	0xc3
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1969
+	.byte	0xd
+	.byte	0x39
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1970
+	.byte	0xd
+	.byte	0x3a
+	.byte	0xd
+	.long	0x1de
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1971
+	.byte	0xd
+	.byte	0x3b
+	.byte	0xd
+	.long	0x1de
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1972
+	.byte	0xd
+	.byte	0x3c
+	.byte	0xd
+	.long	0xc3
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1973
+	.byte	0xd
+	.byte	0x3d
+	.byte	0xe
+	.long	0xd4
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1974
+	.byte	0xd
+	.byte	0x3e
+	.byte	0xe
+	.long	0xd4
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1975
+	.byte	0xd
+	.byte	0x3f
+	.byte	0xe
+	.long	0xd4
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1976
+	.byte	0xd
+	.byte	0x40
+	.byte	0xe
+	.long	0xd4
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1977
+	.byte	0xd
+	.byte	0x41
+	.byte	0xd
+	.long	0x1de
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1978
+	.byte	0xd
+	.byte	0x42
+	.byte	0xe
+	.long	0xd4
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1979
+	.byte	0xd
+	.byte	0x43
+	.byte	0xe
+	.long	0xd4
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1980
+	.byte	0xd
+	.byte	0x44
+	.byte	0x3
+	.long	0x851
+	.uleb128 0xa
+	.long	0x92e
+	.uleb128 0x4
+	.long	.LASF1981
+	.byte	0xd
+	.byte	0x46
+	.byte	0x15
+	.long	0x92e
+	.uleb128 0x4
+	.long	.LASF1982
+	.byte	0xe
+	.byte	0x14
+	.byte	0x10
+	.long	0xc3
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x14
+	.byte	0xe
+	.long	0xa7e
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2022
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2023
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2026
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2027
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x23
+	.byte	0xe
+	.long	0xb5b
+	.uleb128 0x1
+	.long	.LASF2030
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2031
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2032
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2033
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2034
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2035
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2036
+	.byte	0x80
+	.uleb128 0xc
+	.long	.LASF2037
+	.value	0x100
+	.uleb128 0xc
+	.long	.LASF2038
+	.value	0x200
+	.uleb128 0xc
+	.long	.LASF2039
+	.value	0x400
+	.uleb128 0xc
+	.long	.LASF2040
+	.value	0x1000
+	.uleb128 0xc
+	.long	.LASF2041
+	.value	0x2000
+	.uleb128 0xc
+	.long	.LASF2042
+	.value	0x4000
+	.uleb128 0xc
+	.long	.LASF2043
+	.value	0x8000
+	.uleb128 0xd
+	.long	.LASF2044
+	.long	0x10000
+	.uleb128 0xd
+	.long	.LASF2045
+	.long	0x20000
+	.uleb128 0xd
+	.long	.LASF2046
+	.long	0x40000
+	.uleb128 0xd
+	.long	.LASF2047
+	.long	0x80000
+	.uleb128 0xd
+	.long	.LASF2048
+	.long	0x100000
+	.uleb128 0xd
+	.long	.LASF2049
+	.long	0x200000
+	.uleb128 0xd
+	.long	.LASF2050
+	.long	0x400000
+	.uleb128 0xd
+	.long	.LASF2051
+	.long	0x800000
+	.uleb128 0xd
+	.long	.LASF2052
+	.long	0x1000000
+	.uleb128 0xd
+	.long	.LASF2053
+	.long	0x2000000
+	.uleb128 0xd
+	.long	.LASF2054
+	.long	0x4000000
+	.uleb128 0xd
+	.long	.LASF2055
+	.long	0x8000000
+	.uleb128 0xd
+	.long	.LASF2056
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2057
+	.byte	0x10
+	.byte	0x56
+	.byte	0x1d
+	.long	0xb67
+	.uleb128 0x8
+	.long	0x492
+	.uleb128 0xb
+	.long	.LASF2058
+	.byte	0xe
+	.byte	0x11
+	.byte	0x1e
+	.long	0xbfb
+	.uleb128 0x2
+	.long	.LASF2059
+	.byte	0x11
+	.byte	0x1f
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2060
+	.byte	0x11
+	.byte	0x20
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2061
+	.byte	0x11
+	.byte	0x21
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2062
+	.byte	0x11
+	.byte	0x22
+	.byte	0xd
+	.long	0xc3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2063
+	.byte	0x11
+	.byte	0x23
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2064
+	.byte	0x11
+	.byte	0x24
+	.byte	0xd
+	.long	0x62b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2065
+	.byte	0x11
+	.byte	0x25
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2066
+	.byte	0x11
+	.byte	0x26
+	.byte	0xd
+	.long	0xc3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2067
+	.byte	0x11
+	.byte	0x27
+	.byte	0xe
+	.long	0xd4
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2068
+	.byte	0x11
+	.byte	0x28
+	.byte	0xd
+	.long	0xc3
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2069
+	.byte	0x11
+	.byte	0x29
+	.byte	0x3
+	.long	0xb6c
+	.uleb128 0x4
+	.long	.LASF2070
+	.byte	0x11
+	.byte	0x2e
+	.byte	0x1d
+	.long	0xc13
+	.uleb128 0x8
+	.long	0xbfb
+	.uleb128 0x4
+	.long	.LASF2071
+	.byte	0x12
+	.byte	0x18
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x4
+	.long	.LASF2072
+	.byte	0x12
+	.byte	0x1b
+	.byte	0xc
+	.long	0x1de
+	.uleb128 0x4
+	.long	.LASF2073
+	.byte	0x12
+	.byte	0x1c
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x4
+	.long	.LASF2074
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x10
+	.long	0xc3
+	.uleb128 0xb
+	.long	.LASF2075
+	.byte	0x4
+	.byte	0x12
+	.byte	0x20
+	.long	0xc6f
+	.uleb128 0x2
+	.long	.LASF2076
+	.byte	0x12
+	.byte	0x21
+	.byte	0xe
+	.long	0xd4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2077
+	.byte	0x12
+	.byte	0x22
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2078
+	.byte	0x12
+	.byte	0x23
+	.byte	0x3
+	.long	0xc48
+	.uleb128 0xa
+	.long	0xc6f
+	.uleb128 0x4
+	.long	.LASF2079
+	.byte	0x12
+	.byte	0x25
+	.byte	0x23
+	.long	0xc6f
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x13
+	.byte	0x18
+	.byte	0xe
+	.long	0xd59
+	.uleb128 0x1
+	.long	.LASF2080
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2081
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2082
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2083
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2084
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2086
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2087
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2088
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2089
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2090
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2091
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2092
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2093
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2094
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2095
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2106
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2112
+	.byte	0x13
+	.byte	0x3c
+	.byte	0x11
+	.long	0xe0
+	.uleb128 0x22
+	.long	.LASF2241
+	.long	0x30
+	.byte	0x13
+	.byte	0x41
+	.long	0xdbd
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0x1
+	.uleb128 0x2c
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2116
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2119
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2120
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2121
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0xb
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x13
+	.byte	0x50
+	.byte	0xe
+	.long	0xdd6
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2126
+	.byte	0x13
+	.byte	0x53
+	.byte	0x3
+	.long	0xdbd
+	.uleb128 0xa
+	.long	0xdd6
+	.uleb128 0x4
+	.long	.LASF2127
+	.byte	0x13
+	.byte	0x9b
+	.byte	0x10
+	.long	0xfd
+	.uleb128 0xb
+	.long	.LASF2128
+	.byte	0x5
+	.byte	0x13
+	.byte	0x9d
+	.long	0xe41
+	.uleb128 0x2
+	.long	.LASF2129
+	.byte	0x13
+	.byte	0x9e
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2130
+	.byte	0x13
+	.byte	0x9f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2131
+	.byte	0x13
+	.byte	0xa0
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2132
+	.byte	0x13
+	.byte	0xa1
+	.byte	0xd
+	.long	0xc3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2133
+	.byte	0x13
+	.byte	0xa2
+	.byte	0x9
+	.long	0x1de
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2134
+	.byte	0x13
+	.byte	0xa3
+	.byte	0x3
+	.long	0xdf3
+	.uleb128 0xa
+	.long	0xe41
+	.uleb128 0x4
+	.long	.LASF2135
+	.byte	0x13
+	.byte	0xa5
+	.byte	0x1b
+	.long	0xe41
+	.uleb128 0xb
+	.long	.LASF2136
+	.byte	0x3
+	.byte	0x13
+	.byte	0xb0
+	.long	0xe92
+	.uleb128 0x2
+	.long	.LASF2137
+	.byte	0x13
+	.byte	0xb1
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2138
+	.byte	0x13
+	.byte	0xb2
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2139
+	.byte	0x13
+	.byte	0xb3
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2140
+	.byte	0x13
+	.byte	0xb4
+	.byte	0x3
+	.long	0xe5e
+	.uleb128 0xa
+	.long	0xe92
+	.uleb128 0x4
+	.long	.LASF2141
+	.byte	0x13
+	.byte	0xb6
+	.byte	0x17
+	.long	0xe92
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x14
+	.byte	0x15
+	.byte	0xe
+	.long	0xed4
+	.uleb128 0x1
+	.long	.LASF2142
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2143
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2144
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2145
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2146
+	.byte	0x14
+	.byte	0x1c
+	.byte	0x10
+	.long	0xc3
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x14
+	.byte	0x22
+	.byte	0xe
+	.long	0xf32
+	.uleb128 0x1
+	.long	.LASF2147
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2148
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2149
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2150
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2151
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2152
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2153
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2154
+	.byte	0x80
+	.uleb128 0xc
+	.long	.LASF2155
+	.value	0x100
+	.uleb128 0xc
+	.long	.LASF2156
+	.value	0x200
+	.uleb128 0xc
+	.long	.LASF2157
+	.value	0x400
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2158
+	.byte	0x14
+	.byte	0x2e
+	.byte	0x3
+	.long	0xee0
+	.uleb128 0x4
+	.long	.LASF2159
+	.byte	0x14
+	.byte	0x30
+	.byte	0x11
+	.long	0xd4
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x14
+	.byte	0x36
+	.byte	0xe
+	.long	0xf75
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2162
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2163
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2164
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2165
+	.byte	0x14
+	.byte	0x42
+	.byte	0x10
+	.long	0xc3
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x15
+	.byte	0x17
+	.byte	0xe
+	.long	0x1012
+	.uleb128 0x1
+	.long	.LASF2166
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2167
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2169
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2170
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2188
+	.byte	0x15
+	.byte	0x31
+	.byte	0x3
+	.long	0xf81
+	.uleb128 0x12
+	.long	0xab
+	.long	0x102e
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2189
+	.byte	0x16
+	.byte	0x50
+	.byte	0x10
+	.long	0x101e
+	.uleb128 0xb
+	.long	.LASF2190
+	.byte	0x2c
+	.byte	0x16
+	.byte	0x76
+	.long	0x118c
+	.uleb128 0x2
+	.long	.LASF2191
+	.byte	0x16
+	.byte	0x77
+	.byte	0xd
+	.long	0x118c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2192
+	.byte	0x16
+	.byte	0x78
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2193
+	.byte	0x16
+	.byte	0x79
+	.byte	0xd
+	.long	0xc3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2194
+	.byte	0x16
+	.byte	0x7a
+	.byte	0xd
+	.long	0xc3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2195
+	.byte	0x16
+	.byte	0x7b
+	.byte	0xd
+	.long	0xc3
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2196
+	.byte	0x16
+	.byte	0x7c
+	.byte	0xe
+	.long	0xe0
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2197
+	.byte	0x16
+	.byte	0x7d
+	.byte	0xd
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2198
+	.byte	0x16
+	.byte	0x7e
+	.byte	0xd
+	.long	0xc3
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2199
+	.byte	0x16
+	.byte	0x7f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2200
+	.byte	0x16
+	.byte	0x80
+	.byte	0xd
+	.long	0xc3
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2201
+	.byte	0x16
+	.byte	0x81
+	.byte	0xd
+	.long	0xc3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2202
+	.byte	0x16
+	.byte	0x82
+	.byte	0xd
+	.long	0xc3
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2203
+	.byte	0x16
+	.byte	0x83
+	.byte	0xe
+	.long	0xd4
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2204
+	.byte	0x16
+	.byte	0x84
+	.byte	0xe
+	.long	0xd4
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2205
+	.byte	0x16
+	.byte	0x85
+	.byte	0xe
+	.long	0xd4
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2206
+	.byte	0x16
+	.byte	0x86
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2207
+	.byte	0x16
+	.byte	0x87
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF2208
+	.byte	0x16
+	.byte	0x88
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2209
+	.byte	0x16
+	.byte	0x89
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2210
+	.byte	0x16
+	.byte	0x8a
+	.byte	0xd
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2211
+	.byte	0x16
+	.byte	0x8b
+	.byte	0xd
+	.long	0xc3
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2212
+	.byte	0x16
+	.byte	0x8c
+	.byte	0xd
+	.long	0xc3
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2213
+	.byte	0x16
+	.byte	0x8d
+	.byte	0xe
+	.long	0xd4
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2214
+	.byte	0x16
+	.byte	0x8f
+	.byte	0xe
+	.long	0xd4
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2215
+	.byte	0x16
+	.byte	0x90
+	.byte	0xe
+	.long	0xd4
+	.byte	0x28
+	.byte	0
+	.uleb128 0x12
+	.long	0xc3
+	.long	0x119c
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2216
+	.byte	0x16
+	.byte	0x91
+	.byte	0x3
+	.long	0x103a
+	.uleb128 0xa
+	.long	0x119c
+	.uleb128 0x4
+	.long	.LASF2217
+	.byte	0x16
+	.byte	0x93
+	.byte	0x13
+	.long	0x119c
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x17
+	.byte	0x1e
+	.byte	0xe
+	.long	0x11d2
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2220
+	.byte	0x17
+	.byte	0x21
+	.byte	0x3
+	.long	0x11b9
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x17
+	.byte	0x23
+	.byte	0xe
+	.long	0x11f7
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2222
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2223
+	.byte	0x17
+	.byte	0x26
+	.byte	0x3
+	.long	0x11de
+	.uleb128 0xb
+	.long	.LASF2224
+	.byte	0x1c
+	.byte	0x17
+	.byte	0x28
+	.long	0x12ac
+	.uleb128 0x2
+	.long	.LASF2225
+	.byte	0x17
+	.byte	0x29
+	.byte	0xb
+	.long	0x331
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2226
+	.byte	0x17
+	.byte	0x2a
+	.byte	0xb
+	.long	0x331
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2227
+	.byte	0x17
+	.byte	0x2b
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2228
+	.byte	0x17
+	.byte	0x2c
+	.byte	0xd
+	.long	0xc3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2229
+	.byte	0x17
+	.byte	0x2d
+	.byte	0xd
+	.long	0xc3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2230
+	.byte	0x17
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x11d2
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2231
+	.byte	0x17
+	.byte	0x2f
+	.byte	0x11
+	.long	0x11f7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2232
+	.byte	0x17
+	.byte	0x30
+	.byte	0xd
+	.long	0xc3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2233
+	.byte	0x17
+	.byte	0x31
+	.byte	0xd
+	.long	0xc3
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2234
+	.byte	0x17
+	.byte	0x32
+	.byte	0xd
+	.long	0xc3
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2235
+	.byte	0x17
+	.byte	0x33
+	.byte	0xd
+	.long	0xc3
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2236
+	.byte	0x17
+	.byte	0x34
+	.byte	0xd
+	.long	0xc3
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2237
+	.byte	0x17
+	.byte	0x35
+	.byte	0x3
+	.long	0x1203
+	.uleb128 0xa
+	.long	0x12ac
+	.uleb128 0x4
+	.long	.LASF2238
+	.byte	0x17
+	.byte	0x37
+	.byte	0x1a
+	.long	0x12ac
+	.uleb128 0x2d
+	.byte	0x6
+	.byte	0x18
+	.byte	0x22
+	.byte	0x5
+	.long	0x12fa
+	.uleb128 0x2
+	.long	.LASF1938
+	.byte	0x18
+	.byte	0x24
+	.byte	0x11
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1939
+	.byte	0x18
+	.byte	0x25
+	.byte	0x11
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x14
+	.string	"yaw"
+	.byte	0x18
+	.byte	0x26
+	.byte	0x11
+	.long	0xab
+	.byte	0x4
+	.byte	0
+	.uleb128 0x20
+	.byte	0x6
+	.byte	0x18
+	.byte	0x20
+	.byte	0x9
+	.long	0x131c
+	.uleb128 0x17
+	.string	"raw"
+	.byte	0x18
+	.byte	0x21
+	.byte	0xd
+	.long	0x68a
+	.uleb128 0x1d
+	.long	.LASF1941
+	.byte	0x18
+	.byte	0x27
+	.byte	0x7
+	.long	0x12c9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2239
+	.byte	0x18
+	.byte	0x28
+	.byte	0x3
+	.long	0x12fa
+	.uleb128 0x4
+	.long	.LASF2240
+	.byte	0x18
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x131c
+	.uleb128 0x22
+	.long	.LASF2242
+	.long	0x30
+	.byte	0x19
+	.byte	0x36
+	.long	0x13e0
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2245
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0x1a
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2269
+	.byte	0x2
+	.byte	0x19
+	.byte	0x65
+	.long	0x1407
+	.uleb128 0x2
+	.long	.LASF2242
+	.byte	0x19
+	.byte	0x66
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2270
+	.byte	0x19
+	.byte	0x67
+	.byte	0x9
+	.long	0x1de
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2271
+	.byte	0x19
+	.byte	0x68
+	.byte	0x3
+	.long	0x13e0
+	.uleb128 0xa
+	.long	0x1407
+	.uleb128 0x4
+	.long	.LASF2272
+	.byte	0x19
+	.byte	0x6a
+	.byte	0x16
+	.long	0x1407
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x1a
+	.byte	0x19
+	.byte	0x6
+	.long	0x148b
+	.uleb128 0x1
+	.long	.LASF2273
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2282
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2283
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2284
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0xe
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2292
+	.byte	0x1a
+	.byte	0x29
+	.byte	0x3
+	.long	0x1424
+	.uleb128 0x18
+	.long	0xc18
+	.byte	0x64
+	.byte	0x9
+	.uleb128 0x18
+	.long	0xc30
+	.byte	0x67
+	.byte	0x9
+	.uleb128 0x18
+	.long	0xc3c
+	.byte	0x69
+	.byte	0x9
+	.uleb128 0x1a
+	.long	.LASF2288
+	.byte	0x1b
+	.byte	0x6b
+	.byte	0x11
+	.long	0xe0
+	.uleb128 0x18
+	.long	0xc24
+	.byte	0x6d
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2289
+	.byte	0x1b
+	.byte	0x6e
+	.byte	0xc
+	.long	0x1de
+	.uleb128 0x4
+	.long	.LASF2290
+	.byte	0x1b
+	.byte	0x70
+	.byte	0x29
+	.long	0xc7b
+	.uleb128 0x18
+	.long	0xc80
+	.byte	0x70
+	.byte	0x6e
+	.uleb128 0x4
+	.long	.LASF2291
+	.byte	0x1b
+	.byte	0x70
+	.byte	0xa9
+	.long	0x419
+	.uleb128 0x2e
+	.long	0x14de
+	.byte	0xdf
+	.uleb128 0x2f
+	.long	0x14cb
+	.byte	0x72
+	.byte	0x22
+	.uleb128 0x15
+	.long	.LASF2293
+	.byte	0x1b
+	.byte	0xe7
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0x15
+	.long	.LASF2294
+	.byte	0x1b
+	.byte	0xe8
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0x15
+	.long	.LASF2295
+	.byte	0x1b
+	.byte	0xe9
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0x15
+	.long	.LASF2296
+	.byte	0x1b
+	.byte	0xea
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0x15
+	.long	.LASF2297
+	.byte	0x1b
+	.byte	0xeb
+	.byte	0xa
+	.long	0xd4
+	.uleb128 0x5
+	.long	.LASF2298
+	.value	0x289
+	.byte	0x15
+	.long	0x1e5
+	.uleb128 0x5
+	.long	.LASF2299
+	.value	0x28a
+	.byte	0x10
+	.long	0xc3
+	.uleb128 0xe
+	.long	.LASF2302
+	.byte	0xd
+	.byte	0x50
+	.byte	0xa
+	.long	0x1cd
+	.uleb128 0x6
+	.long	.LASF2305
+	.byte	0x19
+	.byte	0x8d
+	.uleb128 0x10
+	.long	.LASF2300
+	.byte	0x19
+	.byte	0x8b
+	.long	0x156f
+	.uleb128 0x9
+	.long	0xb67
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2301
+	.byte	0x9
+	.byte	0x67
+	.long	0x1585
+	.uleb128 0x9
+	.long	0x1585
+	.uleb128 0x9
+	.long	0x158a
+	.byte	0
+	.uleb128 0x8
+	.long	0x5d6
+	.uleb128 0x8
+	.long	0x7c5
+	.uleb128 0xe
+	.long	.LASF2303
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0xa
+	.long	0xe0
+	.uleb128 0x10
+	.long	.LASF2304
+	.byte	0xd
+	.byte	0x4e
+	.long	0x15ac
+	.uleb128 0x9
+	.long	0xc3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2306
+	.byte	0x1d
+	.byte	0x13
+	.uleb128 0x16
+	.long	.LASF2314
+	.byte	0x18
+	.byte	0x48
+	.byte	0x9
+	.long	0xab
+	.long	0x15c9
+	.uleb128 0x9
+	.long	0xc3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2307
+	.byte	0x1d
+	.byte	0x1a
+	.uleb128 0xe
+	.long	.LASF2308
+	.byte	0xd
+	.byte	0x4d
+	.byte	0x9
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF2309
+	.byte	0x1e
+	.byte	0x24
+	.uleb128 0x6
+	.long	.LASF2310
+	.byte	0x1d
+	.byte	0x19
+	.uleb128 0x6
+	.long	.LASF2311
+	.byte	0xd
+	.byte	0x58
+	.uleb128 0x6
+	.long	.LASF2312
+	.byte	0xd
+	.byte	0x4a
+	.uleb128 0xe
+	.long	.LASF2313
+	.byte	0x7
+	.byte	0x3a
+	.byte	0x10
+	.long	0x27b
+	.uleb128 0x16
+	.long	.LASF2315
+	.byte	0x6
+	.byte	0xb5
+	.byte	0xd
+	.long	0x1bc
+	.long	0x161a
+	.uleb128 0x9
+	.long	0x263
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2316
+	.byte	0x1f
+	.byte	0x88
+	.uleb128 0x6
+	.long	.LASF2317
+	.byte	0x17
+	.byte	0x40
+	.uleb128 0x6
+	.long	.LASF2318
+	.byte	0x17
+	.byte	0x45
+	.uleb128 0x16
+	.long	.LASF2319
+	.byte	0x14
+	.byte	0x45
+	.byte	0xa
+	.long	0xd4
+	.long	0x1645
+	.uleb128 0x9
+	.long	0xf32
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2320
+	.byte	0x14
+	.byte	0x44
+	.byte	0xa
+	.long	0xd4
+	.long	0x165b
+	.uleb128 0x9
+	.long	0xf32
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2321
+	.byte	0x20
+	.byte	0x55
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0x10
+	.long	.LASF2322
+	.byte	0x21
+	.byte	0x67
+	.long	0x1678
+	.uleb128 0x9
+	.long	0x1678
+	.byte	0
+	.uleb128 0x8
+	.long	0xb6c
+	.uleb128 0x6
+	.long	.LASF2323
+	.byte	0x21
+	.byte	0x65
+	.uleb128 0x6
+	.long	.LASF2324
+	.byte	0x13
+	.byte	0xbf
+	.uleb128 0x10
+	.long	.LASF2325
+	.byte	0x13
+	.byte	0xbc
+	.long	0x169c
+	.uleb128 0x9
+	.long	0xdd6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2326
+	.byte	0x15
+	.byte	0x3c
+	.uleb128 0xe
+	.long	.LASF2327
+	.byte	0x13
+	.byte	0xc3
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0x10
+	.long	.LASF2328
+	.byte	0x9
+	.byte	0x71
+	.long	0x16c0
+	.uleb128 0x9
+	.long	0x486
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2329
+	.byte	0x9
+	.byte	0x70
+	.uleb128 0xe
+	.long	.LASF2330
+	.byte	0x13
+	.byte	0xc1
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0xe
+	.long	.LASF2331
+	.byte	0x13
+	.byte	0xbb
+	.byte	0x12
+	.long	0xdd6
+	.uleb128 0x6
+	.long	.LASF2332
+	.byte	0x20
+	.byte	0x51
+	.uleb128 0x6
+	.long	.LASF2333
+	.byte	0x20
+	.byte	0x50
+	.uleb128 0xe
+	.long	.LASF2334
+	.byte	0x20
+	.byte	0x54
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0x10
+	.long	.LASF2335
+	.byte	0x16
+	.byte	0xae
+	.long	0x170a
+	.uleb128 0x9
+	.long	0x1cd
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2336
+	.byte	0x22
+	.byte	0x1e
+	.byte	0x5
+	.long	0x1de
+	.long	0x1720
+	.uleb128 0x9
+	.long	0xe0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2337
+	.byte	0x16
+	.byte	0xaa
+	.long	0x1731
+	.uleb128 0x9
+	.long	0x1cd
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2338
+	.byte	0x15
+	.byte	0x3e
+	.long	0x1742
+	.uleb128 0x9
+	.long	0xc3
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2339
+	.byte	0x1c
+	.byte	0x1d
+	.byte	0xa
+	.long	0xe0
+	.uleb128 0x6
+	.long	.LASF2340
+	.byte	0xd
+	.byte	0x56
+	.uleb128 0x10
+	.long	.LASF2341
+	.byte	0x15
+	.byte	0x3b
+	.long	0x1766
+	.uleb128 0x9
+	.long	0x1012
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2342
+	.byte	0x23
+	.byte	0x17
+	.uleb128 0x6
+	.long	.LASF2343
+	.byte	0x23
+	.byte	0x15
+	.uleb128 0x6
+	.long	.LASF2344
+	.byte	0x23
+	.byte	0x18
+	.uleb128 0xe
+	.long	.LASF2345
+	.byte	0xd
+	.byte	0x57
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0xe
+	.long	.LASF2346
+	.byte	0xc
+	.byte	0x4b
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0xe
+	.long	.LASF2347
+	.byte	0x24
+	.byte	0x34
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0x16
+	.long	.LASF2348
+	.byte	0x14
+	.byte	0x47
+	.byte	0x5
+	.long	0x1de
+	.long	0x17b5
+	.uleb128 0x9
+	.long	0xe0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2349
+	.byte	0x10
+	.byte	0x67
+	.uleb128 0x1e
+	.long	.LASF2370
+	.value	0x2ad
+	.long	0x17ec
+	.uleb128 0x1b
+	.long	.LASF2355
+	.value	0x2ad
+	.byte	0x1f
+	.long	0x1cd
+	.uleb128 0x5
+	.long	.LASF2350
+	.value	0x2ca
+	.byte	0x1a
+	.long	0x287
+	.uleb128 0x5
+	.long	.LASF2351
+	.value	0x2cc
+	.byte	0x1a
+	.long	0x287
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF2377
+	.byte	0x1b
+	.value	0x2a4
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF2353
+	.value	0x27a
+	.long	0x180d
+	.uleb128 0x5
+	.long	.LASF2352
+	.value	0x27c
+	.byte	0xe
+	.long	0x1cd
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2354
+	.value	0x263
+	.long	0x186d
+	.uleb128 0x1b
+	.long	.LASF2352
+	.value	0x263
+	.byte	0x2e
+	.long	0x1cd
+	.uleb128 0x5
+	.long	.LASF2356
+	.value	0x265
+	.byte	0x15
+	.long	0x1cd
+	.uleb128 0x5
+	.long	.LASF2357
+	.value	0x266
+	.byte	0x15
+	.long	0x1cd
+	.uleb128 0x5
+	.long	.LASF2358
+	.value	0x267
+	.byte	0x18
+	.long	0x1bc
+	.uleb128 0x5
+	.long	.LASF2355
+	.value	0x269
+	.byte	0x14
+	.long	0x1d9
+	.uleb128 0x5
+	.long	.LASF2359
+	.value	0x26a
+	.byte	0x14
+	.long	0x1d9
+	.uleb128 0x5
+	.long	.LASF2360
+	.value	0x26b
+	.byte	0x17
+	.long	0x1c8
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF2361
+	.byte	0x1b
+	.value	0x255
+	.byte	0x9
+	.long	0xc3
+	.uleb128 0x19
+	.long	.LASF2362
+	.value	0x239
+	.long	0x18b8
+	.uleb128 0x5
+	.long	.LASF2350
+	.value	0x244
+	.byte	0x1a
+	.long	0x287
+	.uleb128 0x23
+	.uleb128 0x5
+	.long	.LASF2363
+	.value	0x23c
+	.byte	0x18
+	.long	0xec
+	.uleb128 0x5
+	.long	.LASF2364
+	.value	0x23d
+	.byte	0x19
+	.long	0xe0
+	.uleb128 0x5
+	.long	.LASF2365
+	.value	0x23e
+	.byte	0x18
+	.long	0xec
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2366
+	.value	0x1e9
+	.long	0x18e8
+	.uleb128 0x1b
+	.long	.LASF2355
+	.value	0x1e9
+	.byte	0x2e
+	.long	0x1cd
+	.uleb128 0x5
+	.long	.LASF2350
+	.value	0x1eb
+	.byte	0x1a
+	.long	0x287
+	.uleb128 0x5
+	.long	.LASF2367
+	.value	0x203
+	.byte	0x13
+	.long	0xcf
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2368
+	.value	0x1e0
+	.long	0x190c
+	.uleb128 0x5
+	.long	.LASF2350
+	.value	0x1e2
+	.byte	0x1a
+	.long	0x287
+	.uleb128 0x5
+	.long	.LASF2369
+	.value	0x1e5
+	.byte	0x1a
+	.long	0x287
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2371
+	.value	0x11f
+	.long	0x1954
+	.uleb128 0x1b
+	.long	.LASF2355
+	.value	0x11f
+	.byte	0x19
+	.long	0x1cd
+	.uleb128 0x5
+	.long	.LASF2372
+	.value	0x121
+	.byte	0x10
+	.long	0x1de
+	.uleb128 0x5
+	.long	.LASF2373
+	.value	0x122
+	.byte	0x10
+	.long	0x1de
+	.uleb128 0x5
+	.long	.LASF2374
+	.value	0x137
+	.byte	0x1c
+	.long	0xde2
+	.uleb128 0x5
+	.long	.LASF2375
+	.value	0x186
+	.byte	0x9
+	.long	0x1de
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2376
+	.value	0x10e
+	.long	0x196f
+	.uleb128 0x23
+	.uleb128 0x32
+	.string	"dif"
+	.byte	0x1b
+	.value	0x111
+	.byte	0x11
+	.long	0xab
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF2402
+	.byte	0x1b
+	.byte	0xfd
+	.byte	0xd
+	.uleb128 0x1f
+	.long	.LASF2378
+	.byte	0xed
+	.uleb128 0x24
+	.long	.LASF2379
+	.byte	0xb9
+	.long	0x1994
+	.uleb128 0x1a
+	.long	.LASF2380
+	.byte	0x1b
+	.byte	0xbb
+	.byte	0x10
+	.long	0x1de
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2381
+	.byte	0xa8
+	.uleb128 0x1f
+	.long	.LASF2382
+	.byte	0x8c
+	.uleb128 0x34
+	.long	.LASF2383
+	.byte	0x1b
+	.byte	0x7f
+	.byte	0x5
+	.long	0x1de
+	.uleb128 0x24
+	.long	.LASF2384
+	.byte	0x77
+	.long	0x19c3
+	.uleb128 0x1c
+	.long	.LASF2385
+	.byte	0x1b
+	.byte	0x77
+	.byte	0x3f
+	.long	0x19c3
+	.byte	0
+	.uleb128 0x8
+	.long	0x7da
+	.uleb128 0x11
+	.long	.LASF2386
+	.byte	0x19
+	.byte	0x6a
+	.byte	0x4d
+	.long	0x19d4
+	.uleb128 0x8
+	.long	0x1413
+	.uleb128 0x11
+	.long	.LASF2387
+	.byte	0x17
+	.byte	0x37
+	.byte	0x59
+	.long	0x19e5
+	.uleb128 0x8
+	.long	0x12b8
+	.uleb128 0x11
+	.long	.LASF2388
+	.byte	0x16
+	.byte	0x93
+	.byte	0x44
+	.long	0x19f6
+	.uleb128 0x8
+	.long	0x11a8
+	.uleb128 0x11
+	.long	.LASF2389
+	.byte	0x13
+	.byte	0xb6
+	.byte	0x50
+	.long	0x1a07
+	.uleb128 0x8
+	.long	0xe9e
+	.uleb128 0x11
+	.long	.LASF2390
+	.byte	0x13
+	.byte	0xa5
+	.byte	0x5c
+	.long	0x1a18
+	.uleb128 0x8
+	.long	0xe4d
+	.uleb128 0x11
+	.long	.LASF2391
+	.byte	0x12
+	.byte	0x25
+	.byte	0x74
+	.long	0x1a29
+	.uleb128 0x8
+	.long	0xc7b
+	.uleb128 0x11
+	.long	.LASF2392
+	.byte	0xd
+	.byte	0x46
+	.byte	0x4a
+	.long	0x1a3a
+	.uleb128 0x8
+	.long	0x93a
+	.uleb128 0x11
+	.long	.LASF2393
+	.byte	0xc
+	.byte	0x48
+	.byte	0xcc
+	.long	0x1a4b
+	.uleb128 0x8
+	.long	0x834
+	.uleb128 0x11
+	.long	.LASF2394
+	.byte	0xc
+	.byte	0x48
+	.byte	0x65
+	.long	0x1a5c
+	.uleb128 0x8
+	.long	0x840
+	.uleb128 0x11
+	.long	.LASF2395
+	.byte	0x9
+	.byte	0x64
+	.byte	0x47
+	.long	0x1a6d
+	.uleb128 0x8
+	.long	0x60e
+	.uleb128 0x25
+	.long	.LASF2397
+	.byte	0x5f
+	.byte	0x18
+	.long	0xe0
+	.long	0x1a8e
+	.uleb128 0x1c
+	.long	.LASF2396
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x38
+	.long	0x27b
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2398
+	.byte	0x4f
+	.byte	0x1e
+	.long	0x27b
+	.long	0x1acc
+	.uleb128 0x1c
+	.long	.LASF2399
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x3b
+	.long	0x2c9
+	.uleb128 0x1c
+	.long	.LASF2350
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x51
+	.long	0x27b
+	.uleb128 0x1a
+	.long	.LASF2396
+	.byte	0x7
+	.byte	0x51
+	.byte	0x1a
+	.long	0x287
+	.uleb128 0x35
+	.string	"p"
+	.byte	0x7
+	.byte	0x53
+	.byte	0x15
+	.long	0x1acc
+	.byte	0
+	.uleb128 0x8
+	.long	0x309
+	.uleb128 0x36
+	.long	.LASF2400
+	.byte	0x5
+	.byte	0x25
+	.byte	0x1b
+	.long	0x1bc
+	.uleb128 0x26
+	.string	"a"
+	.byte	0x2e
+	.long	0x1cd
+	.uleb128 0x26
+	.string	"b"
+	.byte	0x3a
+	.long	0x1cd
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 37
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 37 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 38 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x27
+	.file 40 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x29
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 42 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 43 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x2b
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 46 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 48 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x30
+	.file 49 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 53 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x35
+	.file 54 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 55 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x37
+	.file 56 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 57 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x39
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF946
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 58 "./src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3a
+	.file 59 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF953
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.file 60 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 61 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 62 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF988
+	.byte	0x4
+	.file 63 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 64 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x40
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 65 "./src/main/config/config_profile.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x41
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x22
+	.byte	0x4
+	.file 66 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 67 "./src/main/drivers/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x43
+	.file 68 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x44
+	.file 69 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 70 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1c
+	.byte	0x4
+	.file 71 "./src/main/drivers/gyro_sync.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x47
+	.file 72 "./src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x24
+	.file 73 "./src/main/drivers/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1230
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1231
+	.byte	0x4
+	.file 74 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x4a
+	.file 75 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4b
+	.file 76 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x4
+	.file 77 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4d
+	.file 78 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 79 "./src/main/sensors/boardalignment.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x4f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1236
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x10
+	.file 80 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x50
+	.byte	0x4
+	.file 81 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x51
+	.byte	0x4
+	.file 82 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 83 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x53
+	.byte	0x4
+	.file 84 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x54
+	.file 85 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x55
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 86 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 87 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1629
+	.byte	0x4
+	.file 88 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 89 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x59
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1633
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1634
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x1f
+	.file 90 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5a
+	.file 91 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 92 "./src/main/io/asyncfatfs/asyncfatfs.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x5c
+	.file 93 "./src/main/io/asyncfatfs/fat_standard.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x15
+	.byte	0x4
+	.file 94 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 95 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x5f
+	.byte	0x4
+	.file 96 "./src/main/io/servos.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x60
+	.byte	0x4
+	.file 97 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1711
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x23
+	.byte	0x4
+	.file 98 "./src/main/io/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x62
+	.byte	0x4
+	.file 99 "./src/main/io/vtx.h"
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1745
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x19
+	.file 100 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x64
+	.file 101 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x65
+	.file 102 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x66
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 103 "./src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1783
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF807
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF768
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF908
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF945
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.50.10d0067a73777b2d14d79db5df156f88,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF950
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.profile.h.48.b5d3bdbbb4f3d375ccee68ec649323aa,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF952
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF960
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF983
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1005
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1023
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1033
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1115
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1117
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.23.95742be8daec10c1d662dd67b9ee58de,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1217
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1226
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1229
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1238
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1240
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.83.ab548d0b7b32a9305f216da5287d33d8,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1663
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1672
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.27.07521096acbd1fc23b5da89615487a6f,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1680
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fat_standard.h.23.98e613171bbc330acb6e09557ea95570,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1710
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx.h.22.12f28c2beccab569593ab27679518da5,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1744
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1753
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.8362794d947c339e17997ec0162d97db,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.66.6f7d1d067dff5370bea805da42b83f88,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1781
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x17
+	.long	.LASF1
+	.long	.LASF2403
+	.long	.LASF2404
+	.long	.LASF2405
+	.long	.LASF2406
+	.long	.LASF2407
+	.long	.LASF2408
+	.long	.LASF2409
+	.long	.LASF2410
+	.long	.LASF2411
+	.long	.LASF2412
+	.long	.LASF2413
+	.long	.LASF2414
+	.long	.LASF2415
+	.long	.LASF2416
+	.long	.LASF2417
+	.long	.LASF2418
+	.long	.LASF2419
+	.long	.LASF2420
+	.long	.LASF2421
+	.long	.LASF2422
+	.long	.LASF2423
+	.long	.LASF2424
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x68
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2425
+	.byte	0x12
+	.long	.LASF2426
+	.byte	0x12
+	.long	.LASF2427
+	.byte	0x12
+	.long	.LASF2428
+	.byte	0x2
+	.long	.LASF2429
+	.byte	0x3
+	.long	.LASF2430
+	.byte	0xc
+	.long	.LASF2431
+	.byte	0x2
+	.long	.LASF2432
+	.byte	0x4
+	.long	.LASF2433
+	.byte	0x7
+	.long	.LASF2434
+	.byte	0x5
+	.long	.LASF2435
+	.byte	0xd
+	.long	.LASF2436
+	.byte	0xd
+	.long	.LASF2437
+	.byte	0xd
+	.long	.LASF2438
+	.byte	0x6
+	.long	.LASF2439
+	.byte	0x5
+	.long	.LASF2440
+	.byte	0x6
+	.long	.LASF2441
+	.byte	0x6
+	.long	.LASF2442
+	.byte	0x6
+	.long	.LASF2443
+	.byte	0x6
+	.long	.LASF2444
+	.byte	0x6
+	.long	.LASF2445
+	.byte	0x9
+	.long	.LASF2446
+	.byte	0xb
+	.long	.LASF2447
+	.byte	0x10
+	.long	.LASF2448
+	.byte	0x7
+	.long	.LASF2449
+	.byte	0x7
+	.long	.LASF2450
+	.byte	0x7
+	.long	.LASF2451
+	.byte	0x6
+	.long	.LASF2452
+	.byte	0x5
+	.long	.LASF2453
+	.byte	0x6
+	.long	.LASF2454
+	.byte	0x7
+	.long	.LASF2455
+	.byte	0xa
+	.long	.LASF2456
+	.byte	0x7
+	.long	.LASF2457
+	.byte	0x6
+	.long	.LASF2458
+	.byte	0x4
+	.long	.LASF2459
+	.byte	0x9
+	.long	.LASF2460
+	.byte	0xd
+	.long	.LASF2461
+	.byte	0x15
+	.long	.LASF2462
+	.byte	0x16
+	.long	.LASF2463
+	.byte	0x16
+	.long	.LASF2463
+	.byte	0x15
+	.long	.LASF2464
+	.byte	0x12
+	.long	.LASF2465
+	.byte	0x15
+	.long	.LASF2466
+	.byte	0x15
+	.long	.LASF2467
+	.byte	0x12
+	.long	.LASF2468
+	.byte	0x12
+	.long	.LASF2469
+	.byte	0x14
+	.long	.LASF2470
+	.byte	0x12
+	.long	.LASF2471
+	.byte	0x13
+	.long	.LASF2472
+	.byte	0x13
+	.long	.LASF2473
+	.byte	0x12
+	.long	.LASF2474
+	.byte	0x12
+	.long	.LASF2475
+	.byte	0x12
+	.long	.LASF2476
+	.byte	0x11
+	.long	.LASF2477
+	.byte	0xf
+	.long	.LASF2478
+	.byte	0xe
+	.long	.LASF2479
+	.byte	0x16
+	.long	.LASF2480
+	.byte	0xf
+	.long	.LASF2481
+	.byte	0x1
+	.long	.LASF2482
+	.byte	0x1
+	.long	.LASF2483
+	.byte	0x2
+	.long	.LASF2484
+	.byte	0x3
+	.long	.LASF2485
+	.byte	0x3
+	.long	.LASF2486
+	.byte	0x3
+	.long	.LASF2487
+	.byte	0x3
+	.long	.LASF2488
+	.byte	0x4
+	.long	.LASF2489
+	.byte	0x4
+	.long	.LASF2490
+	.byte	0x5
+	.long	.LASF2491
+	.byte	0x5
+	.long	.LASF2492
+	.byte	0x5
+	.long	.LASF2493
+	.byte	0x5
+	.long	.LASF2494
+	.byte	0x5
+	.long	.LASF2495
+	.byte	0x5
+	.long	.LASF2460
+	.byte	0x5
+	.long	.LASF2496
+	.byte	0xd
+	.long	.LASF2497
+	.byte	0xd
+	.long	.LASF2498
+	.byte	0xd
+	.long	.LASF2499
+	.byte	0xd
+	.long	.LASF2500
+	.byte	0xd
+	.long	.LASF2501
+	.byte	0xd
+	.long	.LASF2502
+	.byte	0x5
+	.long	.LASF2503
+	.byte	0x5
+	.long	.LASF2504
+	.byte	0x5
+	.long	.LASF2505
+	.byte	0x5
+	.long	.LASF2506
+	.byte	0x5
+	.long	.LASF2507
+	.byte	0x5
+	.long	.LASF2508
+	.byte	0x5
+	.long	.LASF2509
+	.byte	0x5
+	.long	.LASF2510
+	.byte	0x5
+	.long	.LASF2511
+	.byte	0x5
+	.long	.LASF2512
+	.byte	0xa
+	.long	.LASF2513
+	.byte	0x3
+	.long	.LASF2514
+	.byte	0x8
+	.long	.LASF2515
+	.byte	0x8
+	.long	.LASF2516
+	.byte	0x9
+	.long	.LASF2517
+	.byte	0x9
+	.long	.LASF2450
+	.byte	0x9
+	.long	.LASF2506
+	.byte	0x9
+	.long	.LASF2518
+	.byte	0x9
+	.long	.LASF2519
+	.byte	0x9
+	.long	.LASF2520
+	.byte	0x5
+	.long	.LASF2521
+	.byte	0x5
+	.long	.LASF2522
+	.byte	0x5
+	.long	.LASF2523
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1620:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1458:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF2351:
+	.string	"gyroTicks"
+.LASF2139:
+	.string	"auto_disarm_delay"
+.LASF1641:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1653:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1256:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1339:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1254:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF876:
+	.string	"USE_FAKE_BARO "
+.LASF996:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1863:
+	.string	"maxTicks"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2395:
+	.string	"pidConfig"
+.LASF1882:
+	.string	"PIDPITCH"
+.LASF850:
+	.string	"_WCHAR_T_DEFINED "
+.LASF802:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1113:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF2049:
+	.string	"FEATURE_TRANSPONDER"
+.LASF994:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1474:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF885:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2154:
+	.string	"UNUSED_MODE"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF1683:
+	.string	"MBR_PARTITION_TYPE_FAT32_LBA 0x0C"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF889:
+	.string	"USE_PPM"
+.LASF1394:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2030:
+	.string	"FEATURE_RX_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1624:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF775:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1418:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1265:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1523:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1351:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1147:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF961:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1747:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1262:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF2397:
+	.string	"profileTicksToUs"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1972:
+	.string	"gyro_to_use"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1789:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1089:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1657:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1524:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1831:
+	.string	"_Bool"
+.LASF2198:
+	.string	"spektrum_sat_bind"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1629:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1762:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF869:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2355:
+	.string	"currentTimeUs"
+.LASF1697:
+	.string	"FAT_FILE_ATTRIBUTE_ARCHIVE 0x20"
+.LASF797:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1991:
+	.string	"OWNER_ADC_CURR"
+.LASF788:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1611:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1484:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1476:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1584:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1881:
+	.string	"PIDROLL"
+.LASF1656:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1916:
+	.string	"pidConfig_s"
+.LASF1919:
+	.string	"pidConfig_t"
+.LASF2175:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1016:
+	.string	"BIT(x) (1 << (x))"
+.LASF1411:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1223:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF967:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1928:
+	.string	"CW90_DEG_FLIP"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1828:
+	.string	"DEBUG_COUNT"
+.LASF1263:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF2247:
+	.string	"MIXER_GIMBAL"
+.LASF1547:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2328:
+	.string	"pidStabilisationState"
+.LASF2138:
+	.string	"disarm_kill_switch"
+.LASF2217:
+	.string	"rxConfig_System"
+.LASF948:
+	.string	"SCHEDULER_TRACE_SIZE 64"
+.LASF1154:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1930:
+	.string	"CW270_DEG_FLIP"
+.LASF1357:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1667:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1252:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF842:
+	.string	"__WCHAR_T__ "
+.LASF2202:
+	.string	"rssi_invert"
+.LASF930:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1616:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1025:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1071:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1888:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1588:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1839:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF2261:
+	.string	"MIXER_PPM_TO_SERVO"
+.LASF1563:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1460:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1035:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1988:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1623:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1592:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1565:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1268:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2039:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1433:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1801:
+	.string	"uint16_t"
+.LASF1316:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1626:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF2194:
+	.string	"halfDuplex"
+.LASF1960:
+	.string	"accelerometerTrims"
+.LASF1853:
+	.string	"PROFILE_GYRO_UPDATE"
+.LASF1212:
+	.string	"LED1_TOGGLE do {} while(0)"
+.LASF2299:
+	.string	"pidUpdateCountdown"
+.LASF1215:
+	.string	"LED2_TOGGLE do {} while(0)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2308:
+	.string	"gyroIsrHold"
+.LASF1534:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"TELEMETRY_HOTT "
+.LASF1203:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1558:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF973:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF832:
+	.string	"_SIZE_T_DEFINED "
+.LASF2317:
+	.string	"telemetryCheckState"
+.LASF933:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1249:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2314:
+	.string	"calculateThrottleAngleCorrection"
+.LASF1561:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1187:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1726:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1436:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1124:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1067:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1675:
+	.string	"MSP_PORT_OUTBUF_SIZE 256"
+.LASF1149:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF1402:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1856:
+	.string	"PROFILE_HANDLE_BLACKBOX"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2130:
+	.string	"yaw_deadband"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF2276:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2372:
+	.string	"armedBeeperOn"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2285:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF2162:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF841:
+	.string	"__wchar_t__ "
+.LASF2058:
+	.string	"controlRateConfig_s"
+.LASF2069:
+	.string	"controlRateConfig_t"
+.LASF1459:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1109:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF2392:
+	.string	"gyroConfig"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1467:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1993:
+	.string	"OWNER_ADC_RSSI"
+.LASF1637:
+	.string	"AIRMODEDEADBAND 12"
+.LASF396:
+	.string	"__REVISION__ \"6ef8c27\""
+.LASF997:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1739:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2101:
+	.string	"BOXSONAR"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1456:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1890:
+	.string	"PIDVEL"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1439:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1075:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1168:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1162:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1633:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1587:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF2367:
+	.string	"gyroIsrHeld"
+.LASF1615:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1995:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2015:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1723:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF812:
+	.string	"_T_PTRDIFF_ "
+.LASF1283:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1634:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1826:
+	.string	"DEBUG_GYRO_TO_MOTOR"
+.LASF833:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF2020:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1237:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1779:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF1228:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF966:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF2257:
+	.string	"MIXER_HELI_120_CCPM"
+.LASF2213:
+	.string	"airModeActivateThreshold"
+.LASF919:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF2305:
+	.string	"writeMotors"
+.LASF897:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1074:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1799:
+	.string	"int32_t"
+.LASF1442:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1566:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF992:
+	.string	"FAST_MATH "
+.LASF875:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF945:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1760:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF1180:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF1630:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF852:
+	.string	"___int_wchar_t_h "
+.LASF1591:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1199:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF943:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1537:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1917:
+	.string	"pid_process_denom"
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1358:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1666:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF914:
+	.string	"VTX_TRAMP"
+.LASF1123:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2017:
+	.string	"OWNER_BARO_EXTI"
+.LASF1052:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1218:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2272:
+	.string	"mixerConfig_System"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2334:
+	.string	"failsafeIsMonitoring"
+.LASF890:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF2315:
+	.string	"getTaskDeltaTime"
+.LASF1619:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1941:
+	.string	"values"
+.LASF2338:
+	.string	"beeperConfirmationBeeps"
+.LASF1269:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1994:
+	.string	"OWNER_SERIAL_TX"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2084:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1072:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1745:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF803:
+	.string	"USE_SENSOR_NAMES "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1085:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1086:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1871:
+	.string	"PGR_SIZE_MASK"
+.LASF1921:
+	.string	"targetPidLooptime"
+.LASF1361:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1553:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1306:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2249:
+	.string	"MIXER_HEX6"
+.LASF1291:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF799:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1354:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF826:
+	.string	"_T_SIZE_ "
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2063:
+	.string	"thrExpo8"
+.LASF1753:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1477:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1692:
+	.string	"FAT_FILE_ATTRIBUTE_READ_ONLY 0x01"
+.LASF1012:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1816:
+	.string	"DEBUG_VELOCITY"
+.LASF2037:
+	.string	"FEATURE_FAILSAFE"
+.LASF1331:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF798:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1158:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1031:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1684:
+	.string	"MBR_PARTITION_TYPE_FAT16_LBA 0x0E"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF2187:
+	.string	"BEEPER_PREFERENCE"
+.LASF2094:
+	.string	"BOXLEDLOW"
+.LASF1889:
+	.string	"PIDMAG"
+.LASF2216:
+	.string	"rxConfig_t"
+.LASF2018:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF959:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2349:
+	.string	"saveConfigAndNotify"
+.LASF1103:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF2029:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1530:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF837:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1434:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1121:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1638:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1661:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF2082:
+	.string	"BOXHORIZON"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2147:
+	.string	"ANGLE_MODE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF952:
+	.string	"PROFILE_TICKS_PER_US 1000"
+.LASF1210:
+	.string	"LED0_OFF do {} while(0)"
+.LASF1705:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1776:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF977:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1902:
+	.string	"pidSumLimit"
+.LASF2302:
+	.string	"gyroDataReadyAtUs"
+.LASF1829:
+	.string	"timeDelta_t"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1665:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2200:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF1772:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_THROTTLE"
+.LASF1489:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1220:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1851:
+	.string	"averageSystemLoadPercent"
+.LASF1499:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2055:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1897:
+	.string	"dterm_lpf_hz"
+.LASF2197:
+	.string	"rx_spi_rf_channel_count"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF2304:
+	.string	"gyroIsrRelease"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2041:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF1945:
+	.string	"SENSOR_BARO"
+.LASF1884:
+	.string	"PIDALT"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1562:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2095:
+	.string	"BOXLLIGHTS"
+.LASF1280:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1999:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1860:
+	.string	"PROFILE_PROBE_COUNT"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1830:
+	.string	"timeUs_t"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF1540:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1604:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2038:
+	.string	"FEATURE_SONAR"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1733:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2212:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1064:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF910:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1107:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1956:
+	.string	"acc_lpf_hz"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2323:
+	.string	"updateAdjustmentStates"
+.LASF1987:
+	.string	"OWNER_SERVO"
+.LASF1654:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1018:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1054:
+	.string	"PG_IMU_CONFIG 22"
+.LASF873:
+	.string	"ACC "
+.LASF1886:
+	.string	"PIDPOSR"
+.LASF2341:
+	.string	"beeper"
+.LASF2158:
+	.string	"flightModeFlags_e"
+.LASF1581:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF794:
+	.string	"TELEMETRY_IBUS "
+.LASF773:
+	.string	"USE_PWM "
+.LASF2167:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF1570:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1206:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2177:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1590:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1757:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1366:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2193:
+	.string	"sbus_inversion"
+.LASF1809:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF963:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1608:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1396:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1284:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1455:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1136:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF2345:
+	.string	"isGyroCalibrationComplete"
+.LASF2264:
+	.string	"MIXER_ATAIL4"
+.LASF2256:
+	.string	"MIXER_AIRPLANE"
+.LASF1825:
+	.string	"DEBUG_DYN_NOTCH"
+.LASF1923:
+	.string	"CW0_DEG"
+.LASF1938:
+	.string	"roll"
+.LASF2300:
+	.string	"mixTable"
+.LASF818:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2203:
+	.string	"midrc"
+.LASF1289:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1229:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1940:
+	.string	"flightDynamicsTrims_def_t"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF1790:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2399:
+	.string	"probe"
+.LASF1900:
+	.string	"dterm_notch_cutoff"
+.LASF1814:
+	.string	"DEBUG_NOTCH"
+.LASF1792:
+	.string	"__uint16_t"
+.LASF1649:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1986:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF932:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1373:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF929:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1378:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1771:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_FLAPS"
+.LASF1001:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF1195:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF2014:
+	.string	"OWNER_RX_SPI_CS"
+.LASF853:
+	.string	"__INT_WCHAR_T_H "
+.LASF1926:
+	.string	"CW270_DEG"
+.LASF1967:
+	.string	"gyro_lpf"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1406:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1178:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2225:
+	.string	"gpsNoFixLatitude"
+.LASF1478:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2333:
+	.string	"failsafeStartMonitoring"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1153:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2319:
+	.string	"disableFlightMode"
+.LASF2050:
+	.string	"FEATURE_AIRMODE"
+.LASF2195:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1712:
+	.string	"VTX_BAND_MIN 1"
+.LASF936:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF1292:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1239:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF1583:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2068:
+	.string	"ratesType"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF2220:
+	.string	"frskyGpsCoordFormat_e"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF990:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1198:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF2124:
+	.string	"THROTTLE_LOW"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1934:
+	.string	"SENSOR_INDEX_BARO"
+.LASF960:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1933:
+	.string	"SENSOR_INDEX_ACC"
+.LASF1948:
+	.string	"SENSOR_GPS"
+.LASF984:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF950:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF2234:
+	.string	"hottAlarmSoundInterval"
+.LASF1711:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1409:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1765:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1010:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF2223:
+	.string	"frskyUnit_e"
+.LASF1108:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF2148:
+	.string	"HORIZON_MODE"
+.LASF1575:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1266:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1784:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1282:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2033:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2290:
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+.LASF2032:
+	.string	"FEATURE_RX_SERIAL"
+.LASF2402:
+	.string	"updateInflightCalibrationState"
+.LASF1117:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF819:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2066:
+	.string	"rcYawExpo8"
+.LASF1543:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1603:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1065:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2180:
+	.string	"BEEPER_READY_BEEP"
+.LASF364:
+	.string	"__k8 1"
+.LASF2196:
+	.string	"rx_spi_id"
+.LASF1048:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1644:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1867:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1322:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1043:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF2389:
+	.string	"armingConfig"
+.LASF969:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF2057:
+	.string	"currentPidProfile"
+.LASF1580:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1159:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF2211:
+	.string	"fpvCamAngleDegrees"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1138:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2157:
+	.string	"FAILSAFE_MODE"
+.LASF871:
+	.string	"GYRO "
+.LASF2204:
+	.string	"mincheck"
+.LASF800:
+	.string	"USE_MSP_PUSH "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2301:
+	.string	"pidController"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF911:
+	.string	"VTX_COMMON"
+.LASF1243:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1313:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF795:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF811:
+	.string	"_PTRDIFF_T "
+.LASF2096:
+	.string	"BOXCALIB"
+.LASF1876:
+	.string	"pgRegistry_s"
+.LASF1880:
+	.string	"pgRegistry_t"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1330:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF2035:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF955:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1298:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1142:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1922:
+	.string	"ALIGN_DEFAULT"
+.LASF985:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1080:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF2092:
+	.string	"BOXBEEPERON"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1141:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF790:
+	.string	"USE_SERVOS "
+.LASF1125:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF380:
+	.string	"__unix 1"
+.LASF1873:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF2074:
+	.string	"motorControlEnable"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1596:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1759:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF2026:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF783:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1669:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1849:
+	.string	"TASK_SELF"
+.LASF1088:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1182:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1498:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2116:
+	.string	"AUX1"
+.LASF2117:
+	.string	"AUX2"
+.LASF2118:
+	.string	"AUX3"
+.LASF2119:
+	.string	"AUX4"
+.LASF2120:
+	.string	"AUX5"
+.LASF2121:
+	.string	"AUX6"
+.LASF1803:
+	.string	"uint64_t"
+.LASF2123:
+	.string	"AUX8"
+.LASF1050:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1700:
+	.string	"FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1569:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2205:
+	.string	"maxcheck"
+.LASF2176:
+	.string	"BEEPER_RX_SET"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2172:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1151:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF2133:
+	.string	"yaw_control_reversed"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1469:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1472:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF2265:
+	.string	"MIXER_CUSTOM"
+.LASF2008:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF2347:
+	.string	"isBaroCalibrationComplete"
+.LASF1586:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1532:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2365:
+	.string	"currentDeltaTime"
+.LASF2352:
+	.string	"pidStartTimeUs"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF2166:
+	.string	"BEEPER_SILENCE"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1841:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2185:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1375:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1078:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1451:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1367:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1729:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1285:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2052:
+	.string	"FEATURE_VTX"
+.LASF1512:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF998:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1818:
+	.string	"DEBUG_ANGLERATE"
+.LASF1337:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1869:
+	.string	"PGR_PGN_MASK"
+.LASF1423:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2102:
+	.string	"BOXSERVO1"
+.LASF2103:
+	.string	"BOXSERVO2"
+.LASF2104:
+	.string	"BOXSERVO3"
+.LASF1191:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1135:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2053:
+	.string	"FEATURE_RX_SPI"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1480:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF522:
+	.string	"__flexarr []"
+.LASF863:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1227:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1606:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF2294:
+	.string	"AccInflightCalibrationMeasurementDone"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1535:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1070:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF770:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF1241:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF1804:
+	.string	"debug"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1618:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2224:
+	.string	"telemetryConfig_s"
+.LASF2237:
+	.string	"telemetryConfig_t"
+.LASF1105:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1221:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1211:
+	.string	"LED0_ON do {} while(0)"
+.LASF1639:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF925:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1883:
+	.string	"PIDYAW"
+.LASF1363:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1850:
+	.string	"cfTaskId_e"
+.LASF1782:
+	.string	"GYRO_WATCHDOG_DELAY 80"
+.LASF2363:
+	.string	"startTime"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1756:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2149:
+	.string	"MAG_MODE"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1120:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1157:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF1737:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF2126:
+	.string	"throttleStatus_e"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1589:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2318:
+	.string	"releaseSharedTelemetryPorts"
+.LASF2019:
+	.string	"OWNER_USB_DETECT"
+.LASF1286:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1457:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF947:
+	.string	"SCHEDULER_HISTOGRAM_BUCKETS 16"
+.LASF1599:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1174:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1240:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1161:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF1877:
+	.string	"size"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1421:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF824:
+	.string	"_SIZE_T "
+.LASF2199:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1090:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF2190:
+	.string	"rxConfig_s"
+.LASF2150:
+	.string	"BARO_MODE"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2215:
+	.string	"rx_max_usec"
+.LASF1612:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2188:
+	.string	"beeperMode_e"
+.LASF1132:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF864:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1183:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF2073:
+	.string	"headFreeModeHold"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF2233:
+	.string	"frsky_vfas_cell_voltage"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1426:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2236:
+	.string	"report_cell_voltage"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2263:
+	.string	"MIXER_SINGLECOPTER"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2072:
+	.string	"isRXDataNew"
+.LASF1610:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2045:
+	.string	"FEATURE_DASHBOARD"
+.LASF1127:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF836:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1742:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1295:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1821:
+	.string	"DEBUG_STACK"
+.LASF2023:
+	.string	"OWNER_INVERTER"
+.LASF908:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1435:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1777:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2003:
+	.string	"OWNER_SPI_MOSI"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2289:
+	.string	"armingCalibrationWasInitialised"
+.LASF1874:
+	.string	"pgResetFunc"
+.LASF1976:
+	.string	"gyro_soft_notch_cutoff_2"
+.LASF1800:
+	.string	"uint8_t"
+.LASF1334:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF2221:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1827:
+	.string	"DEBUG_DSHOT_RPM_TELEMETRY"
+.LASF2235:
+	.string	"pidValuesAsTelemetry"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF991:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1968:
+	.string	"gyro_soft_lpf_type"
+.LASF918:
+	.string	"USE_DSHOT"
+.LASF1438:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF1014:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1935:
+	.string	"SENSOR_INDEX_MAG"
+.LASF2321:
+	.string	"failsafeIsActive"
+.LASF784:
+	.string	"TELEMETRY "
+.LASF2144:
+	.string	"ARMED"
+.LASF1084:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1866:
+	.string	"profileProbes"
+.LASF1441:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2108:
+	.string	"BOX3DDISABLESWITCH"
+.LASF2114:
+	.string	"PITCH"
+.LASF993:
+	.string	"VERY_FAST_MATH "
+.LASF2253:
+	.string	"MIXER_OCTOX8"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1834:
+	.string	"TASK_ACCEL"
+.LASF2232:
+	.string	"frsky_vfas_precision"
+.LASF854:
+	.string	"_GCC_WCHAR_T "
+.LASF849:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1518:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2293:
+	.string	"AccInflightCalibrationArmed"
+.LASF1680:
+	.string	"MSP_PUSH_MAX_RATE_HZ 200"
+.LASF1160:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF903:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1112:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1528:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2400:
+	.string	"cmpTimeUs"
+.LASF2112:
+	.string	"rcModeActivationMask"
+.LASF2031:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF2179:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1333:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1582:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF857:
+	.string	"_BSD_WCHAR_T_"
+.LASF1449:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF2383:
+	.string	"isCalibrating"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1352:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF792:
+	.string	"CMS "
+.LASF2342:
+	.string	"warningLedUpdate"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF829:
+	.string	"_SIZE_T_ "
+.LASF2016:
+	.string	"OWNER_MPU_EXTI"
+.LASF1646:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2270:
+	.string	"yaw_motors_reversed"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1255:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF840:
+	.string	"__need_size_t"
+.LASF2306:
+	.string	"processRcCommand"
+.LASF1985:
+	.string	"OWNER_PPMINPUT"
+.LASF866:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF2286:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF821:
+	.string	"__need_ptrdiff_t"
+.LASF2267:
+	.string	"MIXER_CUSTOM_TRI"
+.LASF1907:
+	.string	"levelAngleLimit"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF764:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1114:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1755:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF954:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1602:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1714:
+	.string	"VTX_CHANNEL_MIN 1"
+.LASF1068:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF808:
+	.string	"_STDDEF_H "
+.LASF1545:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF2280:
+	.string	"INPUT_RC_THROTTLE"
+.LASF2189:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1226:
+	.string	"GYRO_LPF_NONE 7"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1892:
+	.string	"PID_STABILISATION_OFF"
+.LASF1028:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1542:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1560:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2288:
+	.string	"disarmAt"
+.LASF2244:
+	.string	"MIXER_QUADP"
+.LASF1385:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1681:
+	.string	"MBR_PARTITION_TYPE_FAT16 0x06"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF2245:
+	.string	"MIXER_QUADX"
+.LASF1703:
+	.string	"LON 1"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1718:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1482:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1571:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2346:
+	.string	"isAccelerationCalibrationComplete"
+.LASF2357:
+	.string	"maxLatencyResetAtUs"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2201:
+	.string	"rssi_scale"
+.LASF1058:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF982:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF2375:
+	.string	"canUseHorizonMode"
+.LASF972:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1301:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2062:
+	.string	"thrMid8"
+.LASF1063:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF1744:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1324:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF1430:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1342:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2310:
+	.string	"updateRcCommands"
+.LASF834:
+	.string	"_SIZE_T_DECLARED "
+.LASF2219:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1370:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF2209:
+	.string	"rcSmoothingFilterType"
+.LASF2110:
+	.string	"BOXBLACKBOXERASE"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF915:
+	.string	"BLACKBOX"
+.LASF1526:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1852:
+	.string	"profileTicks_t"
+.LASF2243:
+	.string	"MIXER_TRI"
+.LASF900:
+	.string	"LED_STRIP"
+.LASF1519:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1501:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2393:
+	.string	"accelerometerConfigMutable"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1564:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2206:
+	.string	"rcInterpolation"
+.LASF1811:
+	.string	"DEBUG_MIXER"
+.LASF1304:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF896:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF964:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1796:
+	.string	"__uint64_t"
+.LASF2048:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1645:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1767:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1225:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2326:
+	.string	"beeperSilence"
+.LASF2087:
+	.string	"BOXCAMSTAB"
+.LASF1761:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF1381:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2278:
+	.string	"INPUT_RC_PITCH"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF785:
+	.string	"TELEMETRY_FRSKY "
+.LASF1171:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF1259:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1506:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1122:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1104:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1944:
+	.string	"SENSOR_ACC"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1567:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1998:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1878:
+	.string	"address"
+.LASF971:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1005:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1420:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2368:
+	.string	"subTaskPidController"
+.LASF1417:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1504:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1408:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2360:
+	.string	"latencyUs"
+.LASF1642:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF895:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1473:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1133:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF1937:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1307:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2309:
+	.string	"applyAltHold"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF2080:
+	.string	"BOXARM"
+.LASF1685:
+	.string	"FAT_VOLUME_ID_SIGNATURE_1 0x55"
+.LASF981:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1340:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1450:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2274:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF953:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2160:
+	.string	"GPS_FIX_HOME"
+.LASF2051:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF2060:
+	.string	"rcYawRate8"
+.LASF1939:
+	.string	"pitch"
+.LASF2000:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF2085:
+	.string	"BOXHEADFREE"
+.LASF499:
+	.string	"__PMT"
+.LASF2156:
+	.string	"SONAR_MODE"
+.LASF2307:
+	.string	"resetYawAxis"
+.LASF855:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2207:
+	.string	"rcInterpolationChannels"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1914:
+	.string	"rateAccelLimit"
+.LASF917:
+	.string	"USE_SERVOS"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1895:
+	.string	"pidProfile_s"
+.LASF1915:
+	.string	"pidProfile_t"
+.LASF1405:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1143:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF1593:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1082:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF767:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2331:
+	.string	"calculateThrottleStatus"
+.LASF2135:
+	.string	"rcControlsConfig_System"
+.LASF2077:
+	.string	"throttle_correction_value"
+.LASF1857:
+	.string	"PROFILE_CHECK_FUNC"
+.LASF2146:
+	.string	"armingFlags"
+.LASF1556:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1488:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1872:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1709:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1040:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1598:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2081:
+	.string	"BOXANGLE"
+.LASF1668:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1462:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF902:
+	.string	"TELEMETRY_HOTT"
+.LASF1186:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1679:
+	.string	"MSP_PUSH_MAX_COMMANDS 8"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1376:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF988:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1764:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF843:
+	.string	"_WCHAR_T "
+.LASF1808:
+	.string	"DEBUG_BATTERY"
+.LASF1128:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF958:
+	.string	"UNIT_TESTED "
+.LASF2336:
+	.string	"feature"
+.LASF1039:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1453:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1487:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF927:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF2054:
+	.string	"FEATURE_SOFTSPI"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1682:
+	.string	"MBR_PARTITION_TYPE_FAT32 0x0B"
+.LASF1184:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1758:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF2182:
+	.string	"BEEPER_ARMED"
+.LASF1414:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF983:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF931:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1466:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2401:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1651:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1034:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1208:
+	.string	"LED_NUMBER 3"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF968:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF763:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF825:
+	.string	"_SYS_SIZE_T_H "
+.LASF1942:
+	.string	"flightDynamicsTrims_t"
+.LASF1952:
+	.string	"flightDynamicsTrims_u"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1033:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1287:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1110:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2295:
+	.string	"AccInflightCalibrationSavetoEEProm"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1904:
+	.string	"dterm_average_count"
+.LASF2296:
+	.string	"AccInflightCalibrationActive"
+.LASF881:
+	.string	"USE_UART3 "
+.LASF928:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1576:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2376:
+	.string	"updateMagHold"
+.LASF1894:
+	.string	"pidStabilisationState_e"
+.LASF1029:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF1677:
+	.string	"MSP_PORT_MAX_HEADER_SIZE 8"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1982:
+	.string	"cliMode"
+.LASF2228:
+	.string	"telemetry_inversion"
+.LASF1233:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF778:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2382:
+	.string	"updateLEDs"
+.LASF1397:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1349:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2371:
+	.string	"processRx"
+.LASF1507:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF1905:
+	.string	"vbatPidCompensation"
+.LASF1300:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF2070:
+	.string	"currentControlRateProfile"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF2394:
+	.string	"accelerometerConfig"
+.LASF2161:
+	.string	"GPS_FIX"
+.LASF1832:
+	.string	"TASK_SYSTEM"
+.LASF1549:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF861:
+	.string	"__need_NULL"
+.LASF862:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF2127:
+	.string	"rcCommand"
+.LASF1835:
+	.string	"TASK_ATTITUDE"
+.LASF1297:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF2097:
+	.string	"BOXGOV"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF2186:
+	.string	"BEEPER_ALL"
+.LASF772:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1278:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2343:
+	.string	"warningLedDisable"
+.LASF899:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF2152:
+	.string	"GPS_HOLD_MODE"
+.LASF1750:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1194:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1167:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF926:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1452:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF2387:
+	.string	"telemetryConfig"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2145:
+	.string	"WAS_EVER_ARMED"
+.LASF1879:
+	.string	"reset"
+.LASF2259:
+	.string	"MIXER_VTAIL4"
+.LASF1011:
+	.string	"STR_HELPER(x) #x"
+.LASF2076:
+	.string	"throttle_correction_angle"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1041:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1000:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF2174:
+	.string	"BEEPER_BAT_LOW"
+.LASF1007:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2153:
+	.string	"HEADFREE_MODE"
+.LASF2006:
+	.string	"OWNER_SDCARD"
+.LASF1964:
+	.string	"gyro_align"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1635:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF2275:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF1521:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF2281:
+	.string	"INPUT_RC_AUX1"
+.LASF2282:
+	.string	"INPUT_RC_AUX2"
+.LASF2283:
+	.string	"INPUT_RC_AUX3"
+.LASF2284:
+	.string	"INPUT_RC_AUX4"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1081:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1207:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF2364:
+	.string	"previousMotorUpdateTime"
+.LASF1272:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2320:
+	.string	"enableFlightMode"
+.LASF859:
+	.string	"NULL"
+.LASF1798:
+	.string	"int16_t"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1454:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1785:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1415:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1788:
+	.string	"signed char"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF962:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1483:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1355:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1806:
+	.string	"DEBUG_NONE"
+.LASF1536:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1717:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF822:
+	.string	"__size_t__ "
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1607:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF789:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1318:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF2269:
+	.string	"mixerConfig_s"
+.LASF888:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF2271:
+	.string	"mixerConfig_t"
+.LASF851:
+	.string	"_WCHAR_T_H "
+.LASF1428:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1049:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF1959:
+	.string	"accZero"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1833:
+	.string	"TASK_GYROPID"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF2043:
+	.string	"FEATURE_RSSI_ADC"
+.LASF2163:
+	.string	"SMALL_ANGLE"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF989:
+	.string	"sq(x) ((x)*(x))"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1862:
+	.string	"count"
+.LASF1020:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1513:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1432:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1664:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF905:
+	.string	"TELEMETRY_SRXL"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2170:
+	.string	"BEEPER_DISARMING"
+.LASF830:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1327:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1209:
+	.string	"LED0_TOGGLE do {} while(0)"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2210:
+	.string	"rcSmoothingCutoffHz"
+.LASF787:
+	.string	"TELEMETRY_LTM "
+.LASF1970:
+	.string	"gyro_isr_update"
+.LASF1725:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1264:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1379:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1864:
+	.string	"totalTicks"
+.LASF1281:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1248:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1181:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1631:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF2184:
+	.string	"BEEPER_USB"
+.LASF1643:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1057:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1515:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1946:
+	.string	"SENSOR_MAG"
+.LASF1169:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1713:
+	.string	"VTX_BAND_MAX 5"
+.LASF2246:
+	.string	"MIXER_BICOPTER"
+.LASF2028:
+	.string	"OWNER_CROS_EC"
+.LASF2373:
+	.string	"airmodeIsActivated"
+.LASF2107:
+	.string	"BOXAIRMODE"
+.LASF1955:
+	.string	"accelerometerConfig_s"
+.LASF1961:
+	.string	"accelerometerConfig_t"
+.LASF2192:
+	.string	"serialrx_provider"
+.LASF1061:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1687:
+	.string	"FAT_DIRECTORY_ENTRY_SIZE 32"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF2384:
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2071:
+	.string	"magHold"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF980:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1918:
+	.string	"pid_in_gyro_isr"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1978:
+	.string	"gyro_dyn_notch_q"
+.LASF782:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF2379:
+	.string	"mwArm"
+.LASF810:
+	.string	"_ANSI_STDDEF_H "
+.LASF1111:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2021:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1491:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1522:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1605:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1870:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1047:
+	.string	"PG_PID_PROFILE 14"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1066:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1173:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1099:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1973:
+	.string	"gyro_soft_notch_hz_1"
+.LASF1975:
+	.string	"gyro_soft_notch_hz_2"
+.LASF1303:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1273:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1670:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1444:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF920:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1310:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2374:
+	.string	"throttleStatus"
+.LASF776:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1347:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1253:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF2142:
+	.string	"OK_TO_ARM"
+.LASF1288:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF2251:
+	.string	"MIXER_Y4"
+.LASF2248:
+	.string	"MIXER_Y6"
+.LASF1640:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1032:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF986:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1910:
+	.string	"itermAcceleratorGain"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1245:
+	.string	"IOCFG_AF_OD 0"
+.LASF1548:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2325:
+	.string	"processRcStickPositions"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF942:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF1660:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1279:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF949:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF921:
+	.string	"USE_PROFILE "
+.LASF1344:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1479:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2046:
+	.string	"FEATURE_OSD"
+.LASF1230:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1720:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF978:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF791:
+	.string	"GPS "
+.LASF1231:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1465:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1044:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1464:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1022:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1321:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF2165:
+	.string	"stateFlags"
+.LASF2377:
+	.string	"taskMainPidLoopInit"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1214:
+	.string	"LED1_ON do {} while(0)"
+.LASF1260:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1688:
+	.string	"FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2"
+.LASF1060:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1686:
+	.string	"FAT_VOLUME_ID_SIGNATURE_2 0xAA"
+.LASF1795:
+	.string	"long int"
+.LASF1470:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1382:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1053:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1348:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF2250:
+	.string	"MIXER_FLYING_WING"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2298:
+	.string	"runTaskMainSubprocesses"
+.LASF2258:
+	.string	"MIXER_HELI_90_DEG"
+.LASF1002:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1224:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF1996:
+	.string	"OWNER_PINDEBUG"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2254:
+	.string	"MIXER_OCTOFLATP"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1594:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2255:
+	.string	"MIXER_OCTOFLATX"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1751:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF2098:
+	.string	"BOXOSD"
+.LASF2230:
+	.string	"frsky_coordinate_format"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1957:
+	.string	"acc_align"
+.LASF793:
+	.string	"TELEMETRY_CRSF "
+.LASF1820:
+	.string	"DEBUG_SCHEDULER"
+.LASF815:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF2313:
+	.string	"profileTicks"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1949:
+	.string	"SENSOR_GPSMAG"
+.LASF1673:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF2353:
+	.string	"subTaskPidAndMotorUpdate"
+.LASF814:
+	.string	"__PTRDIFF_T "
+.LASF2396:
+	.string	"ticks"
+.LASF806:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF831:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1427:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1749:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2100:
+	.string	"BOXGTUNE"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1493:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1837:
+	.string	"TASK_SERIAL"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1144:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1013:
+	.string	"EXPAND_I(x) x"
+.LASF1403:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2324:
+	.string	"updateActivatedModes"
+.LASF1727:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1222:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1958:
+	.string	"acc_hardware"
+.LASF907:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2312:
+	.string	"gyroUpdate"
+.LASF1802:
+	.string	"uint32_t"
+.LASF1205:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF828:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF868:
+	.string	"U_ID_1 1"
+.LASF1659:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1746:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF2143:
+	.string	"PREVENT_ARMING"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1325:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF2141:
+	.string	"armingConfig_System"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1708:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF1577:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1527:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF2339:
+	.string	"millis"
+.LASF1990:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2090:
+	.string	"BOXGPSHOLD"
+.LASF1079:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF2136:
+	.string	"armingConfig_s"
+.LASF2140:
+	.string	"armingConfig_t"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1096:
+	.string	"PG_PID_CONFIG 504"
+.LASF856:
+	.string	"__DEFINED_wchar_t "
+.LASF1538:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2322:
+	.string	"processRcAdjustments"
+.LASF1658:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2105:
+	.string	"BOXBLACKBOX"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF901:
+	.string	"TELEMETRY_FRSKY"
+.LASF1787:
+	.string	"long unsigned int"
+.LASF2106:
+	.string	"BOXFAILSAFE"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF2086:
+	.string	"BOXHEADADJ"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1076:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1805:
+	.string	"debugMode"
+.LASF844:
+	.string	"_T_WCHAR_ "
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1036:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1343:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1106:
+	.string	"PG_VCD_CONFIG 514"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1836:
+	.string	"TASK_RX"
+.LASF1963:
+	.string	"gyroConfig_s"
+.LASF1980:
+	.string	"gyroConfig_t"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1858:
+	.string	"PROFILE_SCHEDULER"
+.LASF1903:
+	.string	"pidSumLimitYaw"
+.LASF1997:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1077:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1752:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1573:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1847:
+	.string	"TASK_COUNT"
+.LASF1912:
+	.string	"dtermSetpointWeight"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1502:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1270:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1702:
+	.string	"LAT 0"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1797:
+	.string	"char"
+.LASF1885:
+	.string	"PIDPOS"
+.LASF1722:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1399:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2061:
+	.string	"rcExpo8"
+.LASF1485:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1336:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1597:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF979:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1244:
+	.string	"IOCFG_AF_PP 0"
+.LASF1648:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF870:
+	.string	"LED0_PIN NONE"
+.LASF1216:
+	.string	"LED2_OFF do {} while(0)"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF2358:
+	.string	"maxLatencyUs"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1962:
+	.string	"accelerometerConfig_System"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2093:
+	.string	"BOXLEDMAX"
+.LASF2064:
+	.string	"rates"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1557:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1139:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1115:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1632:
+	.string	"BEEP_ON do {} while(0)"
+.LASF1908:
+	.string	"levelSensitivity"
+.LASF2009:
+	.string	"OWNER_FLASH_CS"
+.LASF1471:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF898:
+	.string	"USE_SERIALRX_XBUS"
+.LASF801:
+	.string	"USE_RX_MSP "
+.LASF1009:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1445:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1166:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1628:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF1655:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1716:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF2348:
+	.string	"sensors"
+.LASF1175:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF2083:
+	.string	"BOXBARO"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2226:
+	.string	"gpsNoFixLongitude"
+.LASF1855:
+	.string	"PROFILE_MIX_TABLE"
+.LASF1234:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1813:
+	.string	"DEBUG_PIDLOOP"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF946:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1824:
+	.string	"DEBUG_FFT"
+.LASF1728:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1140:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF2113:
+	.string	"ROLL"
+.LASF839:
+	.string	"__size_t "
+.LASF2316:
+	.string	"mspSerialAllocatePorts"
+.LASF1859:
+	.string	"PROFILE_TASK_FIRST"
+.LASF766:
+	.string	"I2C1_OVERCLOCK true"
+.LASF891:
+	.string	"SERIAL_RX"
+.LASF2381:
+	.string	"mwDisarm"
+.LASF944:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF976:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1069:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2238:
+	.string	"telemetryConfig_System"
+.LASF1448:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF860:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1929:
+	.string	"CW180_DEG_FLIP"
+.LASF1627:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF2386:
+	.string	"mixerConfig"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF892:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2151:
+	.string	"GPS_HOME_MODE"
+.LASF1662:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF2034:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1674:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF2327:
+	.string	"isUsingSticksForArming"
+.LASF913:
+	.string	"VTX_SMARTAUDIO"
+.LASF777:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2001:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1364:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF956:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2040:
+	.string	"FEATURE_3D"
+.LASF1517:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF894:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1842:
+	.string	"TASK_COMPASS"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1671:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2273:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF858:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1838:
+	.string	"TASK_DISPATCH"
+.LASF1116:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF813:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF2183:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF2279:
+	.string	"INPUT_RC_YAW"
+.LASF2329:
+	.string	"pidResetErrorGyroState"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1741:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF2287:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1098:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1505:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2168:
+	.string	"BEEPER_RX_LOST"
+.LASF1179:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF2075:
+	.string	"throttleCorrectionConfig_s"
+.LASF2078:
+	.string	"throttleCorrectionConfig_t"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF2222:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1468:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1531:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2079:
+	.string	"throttleCorrectionConfig_System"
+.LASF1817:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF1345:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1690:
+	.string	"FAT12_MAX_CLUSTERS 4084"
+.LASF1384:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2268:
+	.string	"MIXER_QUADX_1234"
+.LASF1924:
+	.string	"CW90_DEG"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1600:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1579:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1931:
+	.string	"sensor_align_e"
+.LASF1546:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2297:
+	.string	"InflightcalibratingA"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1533:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1461:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1622:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1951:
+	.string	"rollAndPitchTrims_t_def"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1672:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1529:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2361:
+	.string	"setPidUpdateCountDown"
+.LASF1051:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2115:
+	.string	"THROTTLE"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1812:
+	.string	"DEBUG_AIRMODE"
+.LASF1134:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF2262:
+	.string	"MIXER_DUALCOPTER"
+.LASF1721:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1328:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2099:
+	.string	"BOXTELEMETRY"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1778:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1015:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1652:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF970:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1087:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF974:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1021:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1807:
+	.string	"DEBUG_CYCLETIME"
+.LASF1822:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF1734:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF769:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF765:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF975:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1097:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1516:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1217:
+	.string	"LED2_ON do {} while(0)"
+.LASF1971:
+	.string	"gyro_use_32khz"
+.LASF1372:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1146:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2218:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF1017:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1766:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2004:
+	.string	"OWNER_I2C_SCL"
+.LASF2002:
+	.string	"OWNER_SPI_MISO"
+.LASF1277:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2311:
+	.string	"gyroReadTemperature"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2027:
+	.string	"OWNER_COMPASS_CS"
+.LASF847:
+	.string	"_WCHAR_T_ "
+.LASF1748:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF872:
+	.string	"USE_FAKE_GYRO "
+.LASF1176:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1550:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2056:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF1037:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2042:
+	.string	"FEATURE_RX_MSP"
+.LASF1840:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF1899:
+	.string	"dterm_notch_hz"
+.LASF1738:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2208:
+	.string	"rcInterpolationInterval"
+.LASF848:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2241:
+	.string	"rc_alias"
+.LASF1400:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2036:
+	.string	"FEATURE_GPS"
+.LASF1901:
+	.string	"itermWindupPointPercent"
+.LASF2089:
+	.string	"BOXGPSHOME"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1131:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF935:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2128:
+	.string	"rcControlsConfig_s"
+.LASF2134:
+	.string	"rcControlsConfig_t"
+.LASF1568:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2111:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1793:
+	.string	"__int32_t"
+.LASF2388:
+	.string	"rxConfig"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2005:
+	.string	"OWNER_I2C_SDA"
+.LASF1743:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1794:
+	.string	"__uint32_t"
+.LASF2131:
+	.string	"alt_hold_deadband"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1494:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1172:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1152:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF1238:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2044:
+	.string	"FEATURE_LED_STRIP"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2266:
+	.string	"MIXER_CUSTOM_AIRPLANE"
+.LASF1843:
+	.string	"TASK_BARO"
+.LASF1004:
+	.string	"Q12 (1 << 12)"
+.LASF1969:
+	.string	"gyro_soft_lpf_hz"
+.LASF1768:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2359:
+	.string	"dataReadyAtUs"
+.LASF1701:
+	.string	"FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))"
+.LASF771:
+	.string	"USE_CLI "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF2065:
+	.string	"dynThrPID"
+.LASF1574:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1185:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF1572:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2010:
+	.string	"OWNER_FLASH"
+.LASF1056:
+	.string	"PG_RX_CONFIG 24"
+.LASF1083:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2366:
+	.string	"subTaskMainSubprocesses"
+.LASF2164:
+	.string	"FIXED_WING"
+.LASF1508:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2340:
+	.string	"gyroSetCalibrationCycles"
+.LASF1219:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2370:
+	.string	"taskMainPidLoop"
+.LASF1740:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1763:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF845:
+	.string	"_T_WCHAR "
+.LASF1539:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1236:
+	.string	"CLI_SETTING_NOT_FOUND -1"
+.LASF838:
+	.string	"_SIZET_ "
+.LASF1609:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1520:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1736:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1844:
+	.string	"TASK_ALTITUDE"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1861:
+	.string	"profileProbe_e"
+.LASF1387:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF809:
+	.string	"_STDDEF_H_ "
+.LASF1258:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1276:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1625:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1294:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1875:
+	.string	"profileProbe_s"
+.LASF1865:
+	.string	"profileProbe_t"
+.LASF1495:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1724:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1271:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1503:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1693:
+	.string	"FAT_FILE_ATTRIBUTE_HIDDEN 0x02"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2173:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF909:
+	.string	"USE_DASHBOARD"
+.LASF1059:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1312:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1927:
+	.string	"CW0_DEG_FLIP"
+.LASF1412:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1676:
+	.string	"MSP_PORT_STREAM_LIMIT 0xffff"
+.LASF1093:
+	.string	"PG_OSD_CONFIG 501"
+.LASF2022:
+	.string	"OWNER_RX_BIND"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF805:
+	.string	"VTX_CONTROL "
+.LASF1514:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2025:
+	.string	"OWNER_TRANSPONDER"
+.LASF1055:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1920:
+	.string	"pidConfig_System"
+.LASF2122:
+	.string	"AUX7"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1204:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1754:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1500:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2344:
+	.string	"warningLedFlash"
+.LASF1163:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF2159:
+	.string	"flightModeFlags"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF1696:
+	.string	"FAT_FILE_ATTRIBUTE_DIRECTORY 0x10"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1911:
+	.string	"setpointRelaxRatio"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF816:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF846:
+	.string	"__WCHAR_T "
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1694:
+	.string	"FAT_FILE_ATTRIBUTE_SYSTEM 0x04"
+.LASF1486:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2067:
+	.string	"tpa_breakpoint"
+.LASF2242:
+	.string	"mixerMode"
+.LASF2109:
+	.string	"BOXFPVANGLEMIX"
+.LASF1196:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1424:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1636:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1846:
+	.string	"TASK_MSP_PUSH"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1621:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF867:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1177:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF1965:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1026:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1510:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2012:
+	.string	"OWNER_MPU_CS"
+.LASF1868:
+	.string	"pgn_t"
+.LASF1101:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1315:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1719:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2291:
+	.string	"throttleCorrectionConfig_Registry"
+.LASF1150:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1129:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF1130:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2380:
+	.string	"firstArmingCalibrationWasCompleted"
+.LASF1815:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF2178:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF877:
+	.string	"MAG "
+.LASF2169:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF1689:
+	.string	"FAT_MAXIMUM_FILESIZE 0xFFFFFFFF"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1893:
+	.string	"PID_STABILISATION_ON"
+.LASF1511:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1950:
+	.string	"rollAndPitchTrims_s"
+.LASF1954:
+	.string	"rollAndPitchTrims_t"
+.LASF1953:
+	.string	"rollAndPitchTrims_u"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2390:
+	.string	"rcControlsConfig"
+.LASF1906:
+	.string	"pidAtMinThrottle"
+.LASF2231:
+	.string	"frsky_unit"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF827:
+	.string	"_T_SIZE "
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1979:
+	.string	"gyro_dyn_notch_min_hz"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2260:
+	.string	"MIXER_HEX6H"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1966:
+	.string	"gyro_sync_denom"
+.LASF1038:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1551:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF2252:
+	.string	"MIXER_HEX6X"
+.LASF922:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF999:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1023:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF779:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1261:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF1848:
+	.string	"TASK_NONE"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2378:
+	.string	"handleInflightCalibrationStickPosition"
+.LASF941:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1094:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1983:
+	.string	"OWNER_FREE"
+.LASF2362:
+	.string	"subTaskMotorUpdate"
+.LASF937:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1165:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1896:
+	.string	"dterm_filter_type"
+.LASF1770:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1819:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF987:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1552:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2214:
+	.string	"rx_min_usec"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1137:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1275:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1554:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1309:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1984:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2337:
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2369:
+	.string	"pidTicks"
+.LASF1393:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1119:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1614:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1235:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF2059:
+	.string	"rcRate8"
+.LASF1769:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF1650:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1148:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF1145:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF957:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF923:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1475:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF886:
+	.string	"USE_UART8 "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1707:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1691:
+	.string	"FAT16_MAX_CLUSTERS 65524"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1188:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF817:
+	.string	"___int_ptrdiff_t_h "
+.LASF1463:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1126:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1559:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1977:
+	.string	"gyro_dyn_notch"
+.LASF1490:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1613:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF780:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1062:
+	.string	"PG_GPS_CONFIG 30"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1267:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1699:
+	.string	"FAT_DELETED_FILE_MARKER 0xE5"
+.LASF1232:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1947:
+	.string	"SENSOR_SONAR"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF893:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1647:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF796:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1369:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1242:
+	.string	"IOCFG_OUT_PP 0"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1810:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF1775:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF1731:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1042:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2007:
+	.string	"OWNER_SDCARD_CS"
+.LASF924:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1189:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1823:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF2350:
+	.string	"startTicks"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1003:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2240:
+	.string	"attitude"
+.LASF1190:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF2191:
+	.string	"rcmap"
+.LASF1943:
+	.string	"SENSOR_GYRO"
+.LASF1555:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF835:
+	.string	"__DEFINED_size_t "
+.LASF1274:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1257:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF2181:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF879:
+	.string	"USE_UART1 "
+.LASF1974:
+	.string	"gyro_soft_notch_cutoff_1"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1192:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1595:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1164:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF1481:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1541:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1390:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1695:
+	.string	"FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1200:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF1887:
+	.string	"PIDNAVR"
+.LASF1156:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1346:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF2332:
+	.string	"failsafeUpdateState"
+.LASF1170:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF2132:
+	.string	"alt_hold_fast_change"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1102:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1027:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1213:
+	.string	"LED1_OFF do {} while(0)"
+.LASF1492:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1781:
+	.string	"MAX_SERVO_BOXES 3"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF887:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF2125:
+	.string	"THROTTLE_HIGH"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1706:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2239:
+	.string	"attitudeEulerAngles_t"
+.LASF1250:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2024:
+	.string	"OWNER_LED_STRIP"
+.LASF1509:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF880:
+	.string	"USE_UART2 "
+.LASF804:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF807:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1704:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1732:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF938:
+	.string	"__disable_irq() "
+.LASF1891:
+	.string	"PID_ITEM_COUNT"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1678:
+	.string	"MSP_SERIAL_PROCESS_TIME_US 250"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF912:
+	.string	"VTX_CONTROL"
+.LASF2227:
+	.string	"telemetry_switch"
+.LASF965:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1617:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2354:
+	.string	"debugGyroToMotorLatency"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1936:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF2398:
+	.string	"profileRecord"
+.LASF1525:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1046:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1073:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1913:
+	.string	"yawRateAccelLimit"
+.LASF2229:
+	.string	"sportHalfDuplex"
+.LASF1773:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1730:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF1447:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF774:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF940:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1497:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1193:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1715:
+	.string	"VTX_CHANNEL_MAX 8"
+.LASF2356:
+	.string	"previousDataReadyAtUs"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2137:
+	.string	"gyro_cal_on_first_arm"
+.LASF1898:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1783:
+	.string	"AIRMODE_THOTTLE_THRESHOLD 1350"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF823:
+	.string	"__SIZE_T__ "
+.LASF1698:
+	.string	"FAT_FILENAME_LENGTH 11"
+.LASF1251:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1710:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1845:
+	.string	"TASK_TELEMETRY"
+.LASF1774:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2011:
+	.string	"OWNER_BARO_CS"
+.LASF2171:
+	.string	"BEEPER_ARMING"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF2277:
+	.string	"INPUT_RC_ROLL"
+.LASF1092:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1019:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF995:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF2330:
+	.string	"isAirmodeActive"
+.LASF1854:
+	.string	"PROFILE_PID_CONTROLLER"
+.LASF939:
+	.string	"__enable_irq() "
+.LASF1786:
+	.string	"unsigned int"
+.LASF1932:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF882:
+	.string	"USE_UART4 "
+.LASF1095:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF781:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1429:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1780:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF1981:
+	.string	"gyroConfig_System"
+.LASF1735:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2385:
+	.string	"rollAndPitchTrimsDelta"
+.LASF1008:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1155:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1197:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1202:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1024:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1201:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2091:
+	.string	"BOXPASSTHRU"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1100:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1496:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1989:
+	.string	"OWNER_ADC"
+.LASF1791:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2129:
+	.string	"deadband"
+.LASF2292:
+	.string	"inputSource_e"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1360:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1909:
+	.string	"itermThrottleThreshold"
+.LASF1388:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2088:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF883:
+	.string	"USE_UART5 "
+.LASF1544:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1045:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF2047:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF2155:
+	.string	"PASSTHRU_MODE"
+.LASF1006:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF2335:
+	.string	"updateRSSI"
+.LASF1992:
+	.string	"OWNER_ADC_EXT"
+.LASF1663:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 15"
+.LASF1091:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1030:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1925:
+	.string	"CW180_DEG"
+.LASF2303:
+	.string	"micros"
+.LASF934:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2013:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1585:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF820:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF951:
+	.string	"PROFILE_TASK(taskId) ((profileProbe_e)(PROFILE_TASK_FIRST + (taskId)))"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF2391:
+	.string	"throttleCorrectionConfig"
+.LASF1247:
+	.string	"IOCFG_IPU 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1578:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1246:
+	.string	"IOCFG_IPD 0"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1601:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF884:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1391:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2504:
+	.string	"rx_pwm.h"
+.LASF2520:
+	.string	"pwm_output.h"
+.LASF2423:
+	.string	"/usr/include"
+.LASF2428:
+	.string	"debug.h"
+.LASF2500:
+	.string	"voltage_ids.h"
+.LASF2463:
+	.string	"stdint.h"
+.LASF2404:
+	.string	"src/main/build"
+.LASF2420:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2460:
+	.string	"barometer.h"
+.LASF2462:
+	.string	"stdbool.h"
+.LASF2503:
+	.string	"flash.h"
+.LASF2429:
+	.string	"time.h"
+.LASF2467:
+	.string	"wordsize.h"
+.LASF2451:
+	.string	"fc_core.c"
+.LASF2416:
+	.string	"src/main/target/SITL"
+.LASF2442:
+	.string	"fc_core.h"
+.LASF2510:
+	.string	"sound_beeper.h"
+.LASF2461:
+	.string	"stdc-predef.h"
+.LASF2431:
+	.string	"profile.h"
+.LASF2480:
+	.string	"common_post.h"
+.LASF2501:
+	.string	"boardalignment.h"
+.LASF2489:
+	.string	"parameter_group_ids.h"
+.LASF2517:
+	.string	"motors.h"
+.LASF2464:
+	.string	"libc-header-start.h"
+.LASF2456:
+	.string	"failsafe.h"
+.LASF2453:
+	.string	"fc_rc.h"
+.LASF2476:
+	.string	"platform.h"
+.LASF2424:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF0:
+	.string	"./src/main/fc/fc_core.c"
+.LASF2481:
+	.string	"blackbox.h"
+.LASF2439:
+	.string	"resource.h"
+.LASF2514:
+	.string	"asyncfatfs.h"
+.LASF2450:
+	.string	"servos.h"
+.LASF2409:
+	.string	"src/main/flight"
+.LASF2448:
+	.string	"imu.h"
+.LASF2410:
+	.string	"src/main/io/asyncfatfs"
+.LASF2493:
+	.string	"light_led.h"
+.LASF2509:
+	.string	"io_def_generated.h"
+.LASF2438:
+	.string	"cli.h"
+.LASF2495:
+	.string	"accgyro.h"
+.LASF2457:
+	.string	"rc_adjustments.h"
+.LASF2491:
+	.string	"exti.h"
+.LASF2508:
+	.string	"io_def.h"
+.LASF2412:
+	.string	"src/main/msp"
+.LASF2459:
+	.string	"statusindicator.h"
+.LASF2465:
+	.string	"features.h"
+.LASF2419:
+	.string	"src/main"
+.LASF2411:
+	.string	"src/main/io"
+.LASF2474:
+	.string	"time64.h"
+.LASF2488:
+	.string	"config_profile.h"
+.LASF2454:
+	.string	"altitudehold.h"
+.LASF2513:
+	.string	"streambuf.h"
+.LASF2466:
+	.string	"features-time64.h"
+.LASF2518:
+	.string	"transponder_ir.h"
+.LASF2458:
+	.string	"feature.h"
+.LASF2523:
+	.string	"navigation.h"
+.LASF2445:
+	.string	"beeper.h"
+.LASF2444:
+	.string	"runtime_config.h"
+.LASF2440:
+	.string	"config.h"
+.LASF2471:
+	.string	"stubs.h"
+.LASF2437:
+	.string	"gyro.h"
+.LASF2478:
+	.string	"target.h"
+.LASF2447:
+	.string	"telemetry.h"
+.LASF2486:
+	.string	"maths.h"
+.LASF2455:
+	.string	"msp_serial.h"
+.LASF2475:
+	.string	"wchar.h"
+.LASF2468:
+	.string	"timesize.h"
+.LASF2405:
+	.string	"src/main/common"
+.LASF2499:
+	.string	"voltage.h"
+.LASF2446:
+	.string	"rx.h"
+.LASF2497:
+	.string	"current.h"
+.LASF2422:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2522:
+	.string	"rcc_types.h"
+.LASF2519:
+	.string	"vtx.h"
+.LASF2516:
+	.string	"gps.h"
+.LASF2436:
+	.string	"acceleration.h"
+.LASF2479:
+	.string	"stddef.h"
+.LASF2485:
+	.string	"filter.h"
+.LASF2408:
+	.string	"src/main/fc"
+.LASF2477:
+	.string	"common.h"
+.LASF2521:
+	.string	"timer.h"
+.LASF2472:
+	.string	"stubs-64.h"
+.LASF2505:
+	.string	"sdcard.h"
+.LASF2432:
+	.string	"parameter_group.h"
+.LASF2441:
+	.string	"controlrate_profile.h"
+.LASF2433:
+	.string	"pid.h"
+.LASF2414:
+	.string	"src/main/scheduler"
+.LASF2498:
+	.string	"current_ids.h"
+.LASF2449:
+	.string	"mixer.h"
+.LASF2435:
+	.string	"sensors.h"
+.LASF2511:
+	.string	"vcd.h"
+.LASF2490:
+	.string	"accgyro_mpu.h"
+.LASF2515:
+	.string	"fat_standard.h"
+.LASF2507:
+	.string	"io.h"
+.LASF2427:
+	.string	"stdint-uintn.h"
+.LASF2430:
+	.string	"scheduler.h"
+.LASF2502:
+	.string	"adc.h"
+.LASF2470:
+	.string	"long-double.h"
+.LASF2443:
+	.string	"rc_controls.h"
+.LASF2496:
+	.string	"battery.h"
+.LASF2469:
+	.string	"cdefs.h"
+.LASF2413:
+	.string	"src/main/rx"
+.LASF2473:
+	.string	"typesizes.h"
+.LASF2403:
+	.string	"src/main/blackbox"
+.LASF2512:
+	.string	"msp.h"
+.LASF2434:
+	.string	"sensor.h"
+.LASF2417:
+	.string	"src/main/target"
+.LASF2484:
+	.string	"axis.h"
+.LASF2452:
+	.string	"system.h"
+.LASF2407:
+	.string	"src/main/drivers"
+.LASF2506:
+	.string	"serial.h"
+.LASF2487:
+	.string	"utils.h"
+.LASF2483:
+	.string	"build_config.h"
+.LASF2415:
+	.string	"src/main/sensors"
+.LASF2426:
+	.string	"stdint-intn.h"
+.LASF2406:
+	.string	"src/main/config"
+.LASF2425:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2494:
+	.string	"gyro_sync.h"
+.LASF2418:
+	.string	"src/main/telemetry"
+.LASF2482:
+	.string	"blackbox_fielddefs.h"
+.LASF2492:
+	.string	"io_types.h"
+.LASF2421:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\302\002u\017"
+	.string	"t\022\266\003"
+	.string	"-"
+	.string	"\256\252\227\232\006 \002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\002\004\002\005\002\006\002\006\002\004\002\004\001\352\263\360\321\b\006\007\b\t\n\272\372\225\224\006\f\002\007\f\360\266\215\242\006\006\002\b\002\b\t\021\263\223\364\342\003\024\002\002\t\002\002\t\022\240\342\234\212\n\024\025\202\257\234\346\003\026\n\026\027\030\031\264\223\357\320\003\004\001\002\001\032\203\245\313\265\t\016\013\002\013\002\001\002\f\034\036\037\363\364\341\332\005"
+	.string	" \373\360\244\327\005\r\002\001\002"
+	.string	"\002"
+	.string	"#%\234\276\301\203\013\f\002\017\002\020\002\021\002\021&\231\357\210\200\005"
+	.string	"'\322\313\322\241\013\016*\256\315\205\301\t\b\001\002\001+,\332\304\225\275\006-\261\332\203\215\f\f"
+	.string	"\002"
+	.string	"./\245\254\200\255\013\n0\205\316\271\205\017\026"
+	.string	"\002\022\02335\213\372\353\242\013\024\001\002\025\002\002\t78\221\367\222\352\017V\026\002\026\0279:\352\263\360\321\b>\322\331\330\236\006\004?\274\205\242\255\006"
+	.string	"@\341\231\301\240\001\001\002\001A\202\321\330\342\013B\251\377\314\275\006CD\240\342\234\212\n"
+	.string	"c\250\361-\241\n\304$I\222v\003P\202A\252\312<\021\020M\244\244\013\243B\273\001\300k\212\275Yv\026%\013\366A\337\237\303\373\352\323\210\004\273\247\373)\0172\245\362]\222\227\266\324\321C)\340\032K\016\274z\302\362\267)\301\205\314.^\354\206\304`\212=&~\267!&\002\357.\326?\036\203\226\344\264}`5\244\276ie\333\\\314\235\331\204\231\032{-t\220\216\312i?1\2061\354y\032^l\270\302\206\276\3455\260:+\305\026\360\273\262\316\210D\"\2018\022w\"\027X\016\314\361\025'\214\364\3612\356\202\310\200ts\336"
+	.ascii	"A&B\222\016\210O\255\272\024\350\"\330M\025s.:\344k\214=\225"
+	.ascii	"T\362"
+	.text
+	.section	.gnu.lto_.ipa_sra.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375``"
+	.string	"\245\004"
+	.string	"\342\304\016\025P\2055\0060S\201\361*u\214\264\326*n\304\365\266eJ\001/\330"
+	.string	"\023\360\227\272\326VKMR\004=\373 \030\337}\266K\356v\032fQ9\324m\272\2052\217X\021\037\004* \200\2029Y;\221\020Il\335\247\300k\022\200\bXr0\215\200\212\300\234\301b\301\303\341\272\273\241\251\200G\267{p\304,\362\302 e\304q\021\214#\030\016q"
+	.ascii	"\035\344B\n`\201\324@\0307\017\fA\335\204\035.\333\261:A\352"
+	.ascii	"0f$d\365\331\024|\b"
+	.text
+	.section	.gnu.lto_.inline.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\304\005\315\024"
+	.string	"6\030[F\340\264&\215\001\030+z\236>?\3615^\006\013\025\244\215\265+v\214\203\252\222\370\365\003\r\025\230\320\200{L4\025a\214\251\356f\345\2061\306f\001h\035wM\376\366\260-\rB\301\212\207\243\3206A\362\336R\246?"
+	.string	"I"
+	.string	"O"
+	.ascii	"#\023\213\203\233X\037 \236\264E\354\006\b\327As`\256$\003\346"
+	.ascii	"D\032?\351\316\356r(\205\177I\363<S\260\307\356\236\034\322U"
+	.ascii	"Eww\265O\351\210\335\335\240\237)\225\331\335\006\177\262\006"
+	.ascii	"\013\3075ES\333\004^@s\255YA\211h\004\237\"vW\365(v\027\300\007"
+	.ascii	">ibB\202&\240\240O\217L\013\345n\270+<r`\b\270\004\343Bb\304"
+	.ascii	"\333\341r\203F7\201\f%\n\356\220\025G\030@\034/\260 (\007\262"
+	.ascii	"\0228\246\017\232b"
+	.string	"\245\263\353\230\202kw3\300\236\335\365\226@\202\355\252L\216\240\222\361\275ZH\272M\353'6\032\202\022\211\321q)Q\237\326\217\r\367\203n\264\203\027\226o\306+\302\323\0022\360\202\027,\337\213\024\224\343{\225\366\266m\215\001\177\372\330!q\003\024\003\346G\2021\250\300/\204Np\333B\214yF\016\212#\343\211\211o\247\300\331l6\213+\355=\250\213\0232\033J\023\377Ns\306DMj\320:\r\261\236 \264\206\212\031,\264\345\n\254/W\340*\200\211\250\021\"CBb\222Zi\rP\"BU\327\r\022@\303P\205\204\b1\244\f\242\023\232\244R\031\266\003#\246\210D\271\370sP)\215\0010\n\271t~\225\220e\264\031\027\267f{f\366\234\352\224\343\276$\240lm\230\241\t\376\204\001F\371\261/\362\277\277\370\n\240\025ne,\027\002 T\303\326d\223%\257\321Q+\207\251\032\"+\321\345"
+	.ascii	"%2\251jdT&B\307\331\270\371`\f\237-J\006\236i\002L{G\252]\247"
+	.ascii	"M\360\024\205\257\021\252\246\201\003t^\366\245\032(Y\314\207"
+	.ascii	"\276\234\026tX\006t\304U\351\363w\217\314\266\037\270%(\232@"
+	.ascii	"\244\355b|v\240\003\351\3577\201\271\340Y\345w\262(]]\034b\374"
+	.ascii	"\365\335\f\337\221|\t\321 \210\3133\367In\375\2160c\256\240\270"
+	.ascii	"\307\265xc\242\220\272\351\220r\3321\211\r4\205{\274\3031\260"
+	.ascii	"\261+7,\307\213\247\241\f8\035\224/\230\004\024!d\374>\030\002"
+	.ascii	"\274\310\333'\003y\330\f\252=\232,@\231S\274<{\304d\334\021F"
+	.ascii	"\225\377a\216\"\001="
+	.text
+	.section	.gnu.lto_.jmpfuncs.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\217\003\345\f"
+	.string	"\266\22040`m2\03409\004\241\224"
+	.string	"/\r\254h\336K\262\202 h\240}ZA\020$\225\002\335\025v\277\033\315h\243`>\331\365\346\235\315l\262\211\224)'"
+	.string	"$"
+	.string	"("
+	.string	"\021\023c\211\211\362\202R\343+\214R\364\256\353LUU\025\027\305Eq\222\202u\375\345\201\272M]\206,\300/\360\262\b\232\036\221\005\177\347r!\360\260\225$\272\016\326\376\323\377\346\247\272\210\f\370\266\232\035?\214\374\260\362\nr\020\024}S\024\335\006kC\032\336\263X\226\007\333\3268\214\344\260\222\234\372$\303/\214\301(\234\260\226\347G\370\017\326r \203\003\031\254\375\251,\t\361\017\357\220\342\326\tU\370\032\354\243\363:\257\241\264v\333\220\tY\3226d\001aK\302Vd\204}\001r\250Am(\223$I1\333\001\340\002\221\"\242\007\021\200<\314\244\241\031I\222\024Z\003\031DE\252\371\0020\236\357T\234P\017n\232"
+	.string	"\352\361\241\272-Dv\211\201}\235M\326f;1\3523\255\236n\033\214\237\277\242\345'\206)#R\320?\222\354\205\261:\213_\215\026\017\224\032M\213\270\f8+\314\021^?0e\261\334\224\345\036\340\361\346\242\226`"
+	.ascii	"l|\201\365\336\2631\365a\360\021\"\305\212\367\273\264v\030\347"
+	.ascii	"\327ru}n\204\203;\263\336\366\343sk\263\016\023\036\244}\032"
+	.ascii	"\n\256\327r\377\3621\230DG\323\331\260Ks\206s^\341\244\300>\023"
+	.ascii	"\222\3074\325\360\204PA-\025e9\361\3062\370P=\224\017"
+	.text
+	.section	.gnu.lto_.pureconst.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375 G\365\001"
+	.string	"r\204\016\027\200e\032\003\017\330!EQ\024\333u\203\t\2756s)7\252\304\\d6K@e\200\222M.\311\"\207\374q\307\033g|\221)\266\304\021?\334p\302\007\027l\201_qwW"
+	.text
+	.section	.gnu.lto_.ipa_modref.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"\r\006"
+	.string	"B\310\030#\220E\031\016\377\377\377\340\273S\356\356\356\356\312z\345\357\177\326>\233\315"
+	.ascii	"\002N\n*\306\235*7$\311\024*\235\002\030e\262H|\221\006\342\303"
+	.ascii	"9~2\322\371\020\234v\323\263Q\330Rc\354\026\377\210P\017\213"
+	.ascii	"NzJ;\347\351\274\001zB\3174O\305\300%\236j `A\364\214v\353\271"
+	.ascii	"^\307\270J( `\202a\216\254\003\320A\017\200jwL\210\314\033\034"
+	.ascii	"B\240\033\271\261\006\334 4.\023\027l\204u\307\300\202@\213M"
+	.ascii	"ak\314\255\241\035!n\245\374\035[&m\235\377\227\017\013\263\366"
+	.ascii	"\310\370\236\267\260\206!9\004\243P&\307\260\307\227ay\0016\230"
+	.ascii	"-\233\212\315\362V\024`\b"
+	.text
+	.section	.gnu.lto_.lto.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_profileRecord.1.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`u\003\315\026"
+	.string	"\346\350\221J\300VQ:P\224{\n\233\t5\016\271D\270\002=\224\024j}n\317*J\001\b\253\270\347!\261\325\355\307\267\372\n2l\026\216M\327\307\206y\016\262\372\377\262\215\212\343^\310\317\024\372\327\026\"'dQ\326\277md\023\271\223\f{"
+	.string	"u"
+	.string	"~"
+	.ascii	"@\252\037\242\023O\272M\005\257;c\246\276\"\276\374^k\336B\002"
+	.ascii	"\335C\364s\220z}\021\361\242\364I\033V\325M\302)G\267\271`\023"
+	.ascii	"\244^ww\337\342.x\366\026\232&z\003\200#|d4u\233c\353,\342k\370"
+	.ascii	"\025\361\225K\374\366\220\351m\217\222\t\221B,\341\365p\017="
+	.ascii	"\234\005\364z\302Vw_\351\364\247\247\243\024%\323\335Ky\275\240"
+	.ascii	"o\375\356>\330\335r\227U\004\255\034u"
+	.string	"\332\025\237Y\314=v*t\364iUt\267\304@\317;\377\203O\307\270\245'\017\246\246N\273&\216\262\321\356\303\346\242\335'\375\001~~Y7\377U\245\213\022\351\212\"\335*\322\r+]\256ti\245\373\002\342\224#\007\224\272;<Qi#uG\212\237\377\356w\227g/\343J\273zY\361\332=5\244p@)\034\300\037\204\027/\030\007\362<\206\355\275\013,\362Y\\\231\016\361\251\222\243\271\220\t\260\245\246 @\302 \314>\202K\347E\371a\"e\346;\331\t\355\326\234\007\f\266\204\324\3350;H\025\224\036M9\256\303&\276R\346_R\216>-=\17705\215?\306[\237q\034\266\026&\335}\336\356\336\374\0069\303\341H\310Ew7\250q\033\261\375\321\353R\220\325\275L|\335\234\265\245|A!\013\024;\"M\335\375\242\361\3213\310\342\237\017;\2228\006ju\366\235\034R\026\241F\203\325v"
+	.ascii	"\354\013\306\305\205d\020\023\343\"]1ZI\326\2208+1\233\2226\253"
+	.ascii	"[\301\025\323\221\341\224\264\331x\243#\313`3^\220\301,\214$"
+	.ascii	"mgt!\330r\026\243\215\265\262\244\215+\263\0376\027m\214/\307"
+	.ascii	"\272\245\247\224\220\215\230\334x(\270DIK\023\020\271\263\b\355"
+	.ascii	"n\034\263\021\213Ql\003\024\322C\247\354\256\204'\271\325\241"
+	.ascii	" \022\022&\024\263\f\021\331H\021\"\225\303? \220\242\031J\333"
+	.ascii	"\3302\314\330E\3738b\361\016$\234\240K\312Q\372\225X\260\240"
+	.ascii	"ol\235\250WH\f\031\006\221\312\377\3228\355\350\030\322\361\004"
+	.ascii	"F\301\203\251\202]0w\002\203o6\230\363\340Z\305\325\261c)\025"
+	.ascii	"\303\253O\320\200uH\335]\2261\315\t\322\365\253D\231\030\254"
+	.ascii	"\304`\002Rid+\350\343\021=m\330\352pU\345n\377D\353\211\020\355"
+	.ascii	"\2233\323\245\b\f\314\r(\023hM\006\0279\315\205\214+\336\331"
+	.ascii	"\240\rY\250\334va="
+	.text
+	.section	.gnu.lto_throttleCorrectionConfig_Registry.127.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375 \202\345\003"
+	.string	"\344\006P"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\364\301\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\364\006us"
+	.string	"\005\001\006'\001\004'(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/fc/fc_core.c"
+	.string	"\004"
+	.ascii	"K\205\220r5E5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_throttleCorrectionConfig.129.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\240\006?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_applyAndSaveAccelerometerTrimsDelta.130.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`R\002\205\020"
+	.string	"\346\335iE"
+	.string	"\2234\034\363\257]G\r\351\374\t\354\211\2507C\323\230Q< \245\324\244\016w\227\230G\026\215\02102\2067\036u\201\303\252\020\026\023@\035P\325\023\377F\2508\002s\035$\355ZE\262u\333\335D\312\224\002Q"
+	.string	"K"
+	.string	"^"
+	.string	"D\326\206\263\211\260\375\220M2\302\364\264O\342%Z\237\255\\\300n\3546\263K[`\005\3369\323N\240;\347}\244;\347\226\275\3434\331>\206G\213\f\220\335\3754\304[\317\226\177\023\377\300\\X\236\236\006\273\353\204\271x\270\365\266\021\330\226`\247-(V>\3149oP\311\303\316\371*\335\271\253\351e\346\312\233\263\346#\307\346\020\233\366J\005a\277\263\273k\215\331\237\375"
+	.string	"2-\322tH\323\240L\1774\355e\332\223\351N\323\234\246;\231VMg\246?\300#\004\207\201\332n\207[:\252\371(HFx\034\031\315\r\331G\217\3632\363\250\207z\f\033\214\031\317\217N_\270h\301\342\260\036\234v\035M\345tD\303\341\303+oV\355\254\b\177\223\243B\345\325*\244\274&\007f\245;\247\372\033\035\263k\352[\212\330\027.\023\232dv\206\247P\225,>&%A\316\356\226N<fP*)\001ILLH#'V\n\365`\245\n\307\t\030@V\030\301\002\212\203TJ\034\013\030$\241F\021\244"
+	.ascii	"\236|\340\311\207\022\236T\0378\256>\322\310\242\006\324\370"
+	.ascii	"\261Dq\374B4\327;\2531C\030b\343\322\227\003\244}\002\3630\037"
+	.ascii	"x)\213\263\026D\2446j\320\230\021R\021H=\r\005. \320\002\231"
+	.ascii	"\222\353]ZP24\252\f,\214Q\367\265\264\025\306u0\207\370\017\020"
+	.ascii	"^g\030A\\\021L\262\325\333\241\265\334\rtc\3518\017\026%\005"
+	.ascii	"\340\r(x`\rq\034\016\326Z\\\314\005\363\202c\376\fF\276\033V"
+	.ascii	"2*Fq\215\td\3034\f\336\b&B~\346\241d^#~\327)\300\313\2136\223"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_isCalibrating.131.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\266\001U\017"
+	.string	"f[bE\020\221\223\016sg\220\237\353\274}\275\321\n\3462\224"
+	.string	"z\334\021\036\032\372\354F\023\324\026\017\371\327\326\361l\315\222\334b<\307\002\013\2668\030\2004\200\n\310\"\313\272\373c@Pr\257\324=\032!\233l)S\nQ"
+	.string	"K"
+	.string	"O"
+	.string	"\327d\230\274\342j\347{\327`\235,fe\232\031abzv\020\312\261\023%\224O%\311\247\327\006$\371\2401\"\020\001s\262\001Eq\300\214\024\033\247Q2\351\n"
+	.string	"E\261\300\234\363\252+\t\f\251b\2359\247u\004\232\334"
+	.ascii	"n\033e\333\200\375\030\001_\006'\321z\276\352\021^N:pL\335a\207"
+	.ascii	"\236.\312~\234\253b[\315Quf5f\265\264\372\262:\252\377\001\341"
+	.ascii	"\224c\346@\313\234%-\036S\306\325\302\204\355\021{\343\005\r"
+	.ascii	"F\334=L\225<\245\365\255r\314\031jK\342]1(0)\"W\252\210\312\002"
+	.ascii	"s\262\"\257\335\022z\355a\374/VR\244\256\270\001d*\304u\340\017"
+	.ascii	"\027\245M\261n\274\304\263\\\367,\215\332\\\006\375H\367!N\241"
+	.ascii	"\365\356\320\273\3169\275\335N~)\254\220\021)\313R\3439H\273"
+	.ascii	"\203\007\375(\336@B>\334&a\363h\233G\273 2\301\202\266}4h \004"
+	.ascii	"\314a\b\371h\0338\356\243m\302\371U\261ge\372\\2\316^\365\007"
+	.ascii	"5H-.\373w\0223\266\356\2006\244Y\224U&\270b\n\236-\311\316\226"
+	.ascii	"\263\377z\200\264\225e\213\272\202`\021) \200\202)\261\363\020"
+	.ascii	"\t\330\351\f\223!\002\244\235Y\225\023\024\226\215u\342L\220"
+	.ascii	"y\334B\271\336\004\271\237-y\264K[\330\324\336m\033\034\226\344"
+	.ascii	"\007\024\212\262i\312\370S\001\3367\024s\"\220\216\274N(\327"
+	.ascii	"2A{\fk-?\220\313\320\225\306h\317\323\313\267\317\261\267\001"
+	.ascii	"\310\265M0e"
+	.text
+	.section	.gnu.lto_updateLEDs.132.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`u\001m\r"
+	.string	"\206\330T? \217\232\016"
+	.string	"\013\320\034l\213%4\216\366L~\272\274_\202\216\1771\341\371V\032\301E\264\"\263\315\r\236{\204\246\024\260f\363\200 \005\347g"
+	.string	"'v\005\2708\005\300\026\245\332\275\367\2262\245A"
+	.string	">"
+	.string	"D"
+	.string	"\266\354\024\3376\354UL0\025\026\273\033\251\206[\217\3609M\313\217\034"
+	.ascii	"2\355z\3148\274\360'\301\221@Z\204\324\214\306q\003v\367(\317"
+	.ascii	"\t\032\226\0319v\327\231i\025n\314mC\260M\300~\211~ \222\317"
+	.ascii	"\376|\021\370w\315\340P\262\311\217\323\223\322\262\351\302\336"
+	.ascii	"\256\324\f\366\335\352\211\3754\364t\3244\314\364\313\264{\372"
+	.ascii	"\030\220\t\212\002*v)|^,\3133\341\301\366\355\177\260l(\276\210"
+	.ascii	"\217\030\361\370\370\200\177P\r\270\374n\202O\253\216\313?A\247"
+	.ascii	"O\037\342\235\211\002\001\201\177N\005`xN\344\356^j\r\b\351Q"
+	.ascii	"\216i\351\274\220d\013\273k\300+\244N\254\204\223\037\373)\007"
+	.ascii	"\021\342w\b\22664\025%%\220:\"\251#b\340\241`\212\244*$\332\b"
+	.ascii	"`\252\201\246\212\034PT\025A\333\336\255\236 \300\300\262Q\216"
+	.ascii	"\213\231\2645\013\362\231U\257\205QI<[\261\311\217\037UW0\013"
+	.ascii	"\031\317\312\266\273o\004B=\360\022) \360\002\031\221t\fsB\223"
+	.ascii	"(p\376j__,P\374\n[\035\326bw\034\321\360\251\345\357b\277\032"
+	.ascii	"P\225`\024\001\237\f5v\023Y\366b\225\341\016'\221\001\313\346"
+	.ascii	"\030Tu\217S\036\022\2163\021\2132\354!\023\007F\\\227,\216,\241"
+	.ascii	"\\]\262B{\233\220\365"
+	.text
+	.section	.gnu.lto_mwDisarm.133.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"\215\013"
+	.string	"fUN@ O\225\016"
+	.string	"\2268\214\031>I\264\234X\243&9y\301\003\326\030\300'\3265\001\216E\242\025t\3677\327\006\224\225VFBQ\324\214\026\020\200\005 \003\234\220B\225\026M\001\314\222F\310\2262\245;"
+	.string	":"
+	.string	"="
+	.string	"\3278a\322\370\330]M1<\364\250\031\362#\230\335=x\211\367\211\036+\\c\001V\211\027\031_)\0068m\360\016>'|\244\314\bfw\235\336G\341\276n\373\200m\213\375\004\001\277|\020\366\313\222\242\305([\006\300a\001\206\307f\210\035\212R/\330\217\273\273\326\224\375t\366t>}\211\002\326\007\013\003#vO\255\030\333q\231\340`\373\023\207\354\025\017U\033\034\354\232\232.(\033\340\352*\020\026\tu\005\313\364\340\263U\b\025\245\004q|\005\273f\3524\241H\331\262\377\341 8\035\217\007\373u\025\220\001\025\376\203\371\035\356\341\343k\260\004P\336\013\336.\231\216\333\026l\032m\323h\017\0320\330h[\327\321.\003\314A\310tZ\004\216\353\264I\270\217\253)#@\3211RR\234d\274\003\314\336py\317\004J*2e\203c\225*\342\236\307C\036\025"
+	.ascii	"3\241\301(\306\215\241\314\2777\030\335xf\021Vf\006\273\214\261"
+	.ascii	"\263\253\221\201*aq\0133\361@\300P\345\003\343\326\251\\\302"
+	.ascii	"e\354\227!\210\313eJ\241\366"
+	.text
+	.section	.gnu.lto_mwArm.134.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\202\001\035\017"
+	.string	"\266\332aE\360\262&\035\270F\202\001\221\310\370\251\262\364\254\366J\\n\223?\216\013\271\3050\032?{\246j\230\272ok\306\b\352\304\250\017)\211\303\316P\213\305\"\233\3639\226\345\205\233\031\002RA\003CX[#dK\231RP"
+	.string	"J"
+	.string	"L"
+	.ascii	"\273\251\207\237\376\311\260\250y\362\001|\250\177@\030\236E"
+	.ascii	"\022\r1,h\237\204(\242\323\341"
+	.string	"\006\205\017&\261\013\217\221$GN\017\355{\211\"1 \274\220o\225\032\362\275\304\221\335=\315s\302\247\312\374\230\354\256\323\373*\334\240\333\216`\273\200}\030\001\307\374\226\354\330u@\r\233T\206>a\361:\315\021\310\020\301\243c\363\207\335R\245\202\3665\f\303\320*ck:j:3\375\220\251\365rm/vcB ;\003k\021\342i\237\304\311\326|\262q\274\305\332\343\360\300\340\274v\003Z\317N(m\025\006y\317#*E9\264\"\310\216]\324\214`E\005}S\226\232=7\361\033\223?c\027\022);\226Z\362!C*\303_\025\364W\262\253\202\033\033\253\364a\273{\211\025\320\356\352\200_s\033\026\177\346\230!\264\344\275\346D\243R\307\235p)\033\227\2625PA!m\\\211e\023\021p\347`T\332\036t]i\323Z\251\307U\031\233\244T\025ww?\tTQ\231\303CgC\246\340\211\307"
+	.ascii	"i\243py/j\t\007\001.L\301\024W\341\"b-p-\317M\031\212\221\001"
+	.ascii	"\032;\002' \260\202\031\031<\007\"B\307\310\030\226#u],H\256"
+	.ascii	"\247\033\247\033\037\017\347\323\217G\200\035\3041\033h\260W"
+	.ascii	"\314`\224K\236\314\210\3732L\343V\204\313Z\260!Hrwp\366\034\362"
+	.ascii	"3&n\2313\326\240\223\2507\215\266C\fM\022\336\336+\002\266\357"
+	.ascii	"\315\272\333E\365"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.140.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`j\001\215\r"
+	.string	"\226\326RB\020\2176\035\214p\340\201\267\274\235\004tF\350U\371 Z\006\r@\037\205\355;\377\312Bf{\252\036\021\241\226\3758\342\200b\222\363\037/\002@"
+	.string	"\024\257*\275\007\225\240\256\220\302\256\244\366\335\310\2262\245>"
+	.string	"<"
+	.string	"F"
+	.ascii	"$T\204\210`\331\335\250\030\276\275\242&\250\271\371U'\323y\334"
+	.ascii	"+\312\030\221O\022,/BB\rO\344\252\361Dp\263\273\347\360\234\340"
+	.ascii	"\201dV\235\335uv^\205\033s\333\034\266\007\3307\021\223\357A"
+	.ascii	"}\272^,F>\362\305\001\\`\264\2246]\354\217K\035\331\207\253$"
+	.ascii	"\366\323\360\351|\372\326\266\201%\205\300\312.\205\027\031{"
+	.ascii	"2\235\320`\373\366;l\266\345\315~\361\257d\037:\202\252]\244"
+	.ascii	"\024(PK@\027])\025\352C,\214p\220\232\031\371ZJPG\017Q&\0178"
+	.ascii	"%*\tf\\8\210\207\210+T.\022\n\224\334]N\035\242\256\bLZ\2102"
+	.ascii	"\206}\017\377\020\3623\030\202G\276{\3068\036-\303\f`\237\210"
+	.ascii	"}\"\007\350\300F\304\264\216\310\021\340l\201G\213\r\262L\213"
+	.ascii	"\326\267\207W\022\027X9\371P\020X]\t\340 \312V\260\261\021)g"
+	.ascii	"\r)e)L\332\f:\362\235U\271O\001/ \260\002\231\271\036#Hq\220"
+	.ascii	"\320(\3572\326\320=]\346\n\200\025#\327\2360\370p\017;\3110\220"
+	.ascii	"\r\371\005\"`\2079\233\314x\003vk\f\217\363m\030Z7\272b\306\355"
+	.ascii	"\262s\034\301\265\2163\020\001<\022\226@\245\030\367\342\b\320"
+	.ascii	"\r\257\255C\031f\222<`\242D]}Iv\2667@\336vu="
+	.text
+	.section	.gnu.lto_updateInflightCalibrationState.141.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\326\004=\032"
+	.string	"&\253\227J\300\224U\007\350hAg\241@Z0?\031 \341B\204\371\221\024vF\275\374#\005s\001\254\265\206\005\256nk\333\006wu\253w\177\006\245\275\211\200\270\320\302Q\314f\3577\3403I\2279\034\324\036\220\233l\377\357-\345N)\245\206"
+	.string	"t"
+	.string	"\203"
+	.ascii	"\354\355\334\002:\007$\344\207\202 \367\332\f\213\334\033\025"
+	.ascii	"\030\202\231\273\344\031\346\244\366\361\356\350c\344\226B\310"
+	.ascii	"\275\027}\237\236\351\324\2112\313\223\211\034m\025\337g\270"
+	.ascii	"M5)M\247N\020\216\332\321qsL1\341\271\331\351\322\204\347&\247"
+	.ascii	"O\036\334\024\204\313\301q\022\t\367\301$\b\247\363\261C\333"
+	.ascii	"\r^5\270X\2466\3773\275\211\005\356\275-\324\316!\255\271\217"
+	.ascii	")\367^\366\232\364\246\031@37\t3\2370\2136\001%V\365-\324\247"
+	.ascii	"\021b\227X\177\325\263\337t5\0372\367"
+	.string	"\211F\021#\363z\331\256\376(\355\367^\232\347\231\355\247\360\353a\363!\314]\242\207f\334?\f\213y\327t\345\216\331\256\375fPG\363!\253\206JK@\256\023a\366\325\374w\314-\336\357avg\225;\247\332\371lgT;\233\326\271\264\316'\353l\262\316\244\350<Vg\353\316Ut\026\337\371\335\003)\320\370;\023M\343\204G\016A\253X\356\030-C\305\301\312\212\355J\200'4\201)\322u\"l\233eM\177&\375\202\335,K\276\351\333E\277`=`a\261]\311w\242\336\263\357\336[\177\307\343\213o\362\374\216l>\204\355\217\020\332(\002y\257\r\205\233E\267\2200\241\245\305v\265\3379zC\377\342\367\355\b\215y\325+\\\310{o\002n\025]\324\342\376\351\312.\030\030\333\365\277\215\202@\232\017\275\305\334Z\271d\260VK\353\005m\275\240\025b\\^hKv\001]\005`\230\005\227\f\305"
+	.string	"\203\311\320\322G\353\357\2519\240%%\332\327R\277\303\341c\301\212't\345pA\224\207\210\363wD]K\022\277N}\335\021#\363J}\027\005Q\347g\320q\276\252\247\213\245JK@\314\236Y\244\003<\241N\371\273\031}\303"
+	.ascii	"Ox\002sN\250\367\244#\006\250G{m2_fc\326 f\376\031\324\341\220"
+	.ascii	"\277\203\321\245xo\263\354\351\313\032\247\037\320#\tu\250aD"
+	.ascii	"\310M\221\f)JQ*\035\240\002\021!;\036\020Pe4Z\2304\006\323\271"
+	.ascii	"\213?\027\025\2415y'\"\207k,\366d\001\n\265\240qa\2149;\233="
+	.ascii	"\311QH\375\275\311 \267>\230\006U\213\242x{J\321o\324m\262\264"
+	.ascii	"\223j\367s\326\326\375\242\204\324\325t7\3261\356\376\375\260"
+	.ascii	"Ck\376\340X\351\t(\362[\020\221\222S\276\324\260>\360b\017\204"
+	.ascii	"7\326\346U\325\313\332^\210+\266i\261\211F\360\3159\306\004\216"
+	.ascii	"\243$\274p\322\003\036(!\315h\022sf\340\362Z\226\352\255\243"
+	.ascii	"\317\277gG_\324\324|dMQ:\227\0037\3259E\2361\273\006\263\270"
+	.ascii	"\222\3403!\224\205\327PQ\335\350\n\327OP\370\310\342y\235iM\361"
+	.ascii	"\377PL\354p=\322\310\355\223\002\270f#\252|\220[\235\317f\314"
+	.ascii	"\037"
+	.text
+	.section	.gnu.lto_updateMagHold.142.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\203\006\035%"
+	.string	"\212A\340\rE\220\334I:\001b\216\317&:%\030\031\300\361^\317\007\263\3622k\256\252+\310\363H\350\007\006C\2437\013\221o\222\265\247\002"
+	.string	"Y]\326\020\241\342\220Y\203\307/O\210\226]\252\2601\326~#d\023\222d\222\001\301"
+	.string	"\273"
+	.string	"\316"
+	.string	"_\305}\365\006\256\366|\325\366\325qW\305\257\312]\rw\025\004W\377\325\335UC\005\3151\203amN\035kx\346YH\226\304a\266\252\025\224\201RCQ\377\364\246\340\f\312Q,e\3470\3358\267\214Z__n\346\234P\01657:\004\362"
+	.ascii	"\351p-$\035\372\246;\3254\377\274\246\257\f\351U\2513\347\224"
+	.ascii	"\372\021\357\354\203\273\365\330FQ\206\340w\247\026\247"
+	.string	"lZ[6\354#N\341\204\370&\004\310\366\374\260\315\307\322\222\035?v\\*\302\303g\321\367\353\255\354\341\360g+\353wc\301\333\026\326\376\314\216 \240\322\234\323`^\034[W\273\342\324\234SWk\213\207\365\307\252\232\246\252\023Te\206$J\2300!\035\202\317\241I\361\317\316A\326\305`N\366\334`v\0168bl@\347\344\337s\335\236\357j\327Tm\305W\250\324H4\305\212\025\322\341o4_>\336\256y\347\2346\376.\3751\r\271?!f\206\265v\324\337\313\262,;\274]\233\342*\272q\316\371@-f*,\324H\034j\013\027k-\207j\027Zv\004hd\274]\323%\343rf\356\035\325\337\325\276K\325\340\274\021\325'\271\232sjb\022W\227\224\034fM\332U\244]=\332U\243\257\032\370j\001q\265H\\%\022W\207\344*\201qu\200\270*\340\253Br5\350\253\001\276\n\364U"
+	.string	"\341\352\317W}\002\177\002:\200\007\270\263\226(\035h\351"
+	.ascii	"\036\001\013\035\260\347]k\273\021[\027\027\031\321\351\n\312"
+	.ascii	"\244+\035\207\316\220?w\02116\252\030<&\3038'V\003u\030\213\321"
+	.ascii	"\260\201\003\007\351\360\347NfJ\243\223\317\235\236\307g\032"
+	.ascii	"\022w\237;\35181\342\273\324\\M\302\246\273\213k\b\310\364\244"
+	.ascii	"\343`b\235L\272\225\030\031\254\265\003&\351S<\331t{\323\256"
+	.ascii	"1\ri\373\355;\2265\344\207\354\213\376\346\234a\2151\353$\323"
+	.ascii	"\255\304\306\340\310\312\230\3560+\361\366\216\332\316\364\035"
+	.ascii	"\353\251\215\227\267\335YJ\304\217]\354E\347\001\304Z\013\204"
+	.ascii	"t(\336\346\013/\357\236Z\217\213$\370\360\311U\bo\321\345\326"
+	.ascii	"\250\212\260\226\021L^s\316\006c\316\022\232\240\001\003\006"
+	.ascii	"T\013 @\210\022R\301\002\305\225**\205U\025U\t*\025RT*\244^\260"
+	.ascii	"0\341B\212\312*\206T\024\221V\301Ha%%\243\252\312J\352\366\343"
+	.ascii	"\031\2347\242\035\350\234\361~\345\203\3648\346\342\243#}\307"
+	.ascii	"\340\350\232\336\214@rs\364&4)`r\2163z\232n\310\253\215\265\340"
+	.ascii	"\030\270Q\201\013\335@\321\013\374izj'\210^t\"\263\254'C\027"
+	.ascii	"p\242\203f\004>\244\306l*H\360\322\235\023\243\355\300\3065\037"
+	.ascii	"vQ\034\030I"
+	.string	"\225t8Z\313\244C\002\227\360E\206\306i\252va\024(H\207\003\356\340\313\367t\001\007\315zj\027\372\312\351\251\361\336\334\336\245k\213\262\211p\245\215\007\274t$s\367\317\343\350#\031\364\\\031\237U\260p\341\202t\030t#4\037\216\254\314S\200\200\217\250a0f\2212d$\")L\n\031\326\220\002\231\231\262z\021\200\271cw\222a3\002*\324v,\006gP(\271\036zs\367\034h\364\333Lie\235\253\253D\027\274\325\"\331@\n@!\b\330\036\f\242\271@\002\"\305\336\030\241\256\302\024\222\366\245\214\246\033O\352\361l\271$\312i$P\032=\212[r`\023)=\340v\351\222\3068\017nE\026\031\021m\003\201\335\313\231M\216\b6\200=mM\027:.[\312\316\242\262\324`( \004W\"@\216\217\275\2773\210\341\211\345K\364I D\037KI\353KF5\3060\245N\300E\252\311"
+	.string	"\365\346x\341\013D\300\214\310&T\325\347\322h)\336\361\360\206\274V \2477[\270\270\242\221\265\217?\034\267\223ss{\214\031\217\030E"
+	.ascii	"\r\004\375o\376:\201\374O\244\367\357^_\037B\007R{t\317\321\334"
+	.ascii	"\215\236\333\224G\274\001\306\342\023-3\202U\301J\272i\"\300"
+	.ascii	":\314d\344\376aS\244\b=H1\332&\337\262\002\254\236\263\023\b"
+	.ascii	"j\262\242\2212#\363\324"
+	.text
+	.section	.gnu.lto_processRx.143.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`n\035\225v"
+	.string	"\n\264\034(M \320\322\351z:ZO\305\340C\330q\240\213\024\216\023.\024\230y\235<,\312\221\005d)\256\004\206tz\232\355\355\020U\"\225}"
+	.string	"\f-d!0"
+	.string	" L\367y\340\001g\211\035\221\316=\f}\"\331\316\216\207A\"BBZJ)\005v\002!\002\205\002\316Fw.\2723\321\235\207\327\371\257\263\273s\367s\205\233\2665\250\225/\023m\315\2529\264c\210]\226t\264\033\257\211>\364!s\367\224\226r\316\224\235\0253\036\bJ\261h\213\366\301\0267\\\306&NU\261\232\262b;\232C\t\026m\315\246"
+	.string	"\321@q\323\266Q\247&2\rc\023\231\247N\260jgn(\035\205\355;\021\370\330\266\316\272\027\3326\372\304L\306&*\033\3506q\330>\267\211\3142\237\351(\\\333W\244\220Qq\323\266m\324\033i\266\271\013\347\361\013\314\205\267\260\026v\201\2630\026\276\302V\270\n\267\300T\230\005\2262\036O\341h\013\026+Th\245\310\302BqeUE5uB*\n\352\311\204SS\t\022L#\226D\204"
+	.ascii	"\241\244LB:2*\372@4$\024\004\364\343\343\241\207\247CrG'\007"
+	.ascii	"y4\026/q\370\316r\027\267@\024\342\320D\003k\356\222W\\r\204"
+	.ascii	"\214\213\017'\221#\315/@\271@\203\234\314!\316[\340\234\265\264"
+	.ascii	"\0059\231l\316.\034Ys\316\"\244\031\313\260\251-\214\017#'S\310"
+	.ascii	"\020\210\f\221\032\202\256\f\251\306\334\254\0319\231jC\2357"
+	.ascii	"d2\004q\266R%\255\271\0053\036\316TJhf\201\004g\351\017\336\320"
+	.ascii	"\207\223\310\216\346)FN\346\216 '\263\3149j\344d6\245=\004\342"
+	.ascii	"d\216\340-XT{E\025\216\253\210\223\203k\0319\231%\f\225)\336"
+	.ascii	"\024z\026\026a\243 \274\301\257\334\234q+76xU\rM\3455\364\224"
+	.ascii	"`\237\020\ft)@\2172\003e\306\317\237\304\374\271\2110\355\024"
+	.ascii	"\246\317\233\246]b\n\306I0q\361\021K[\264\270\210\020|Y\034\004"
+	.ascii	"\226V\302r\305\225I\305- }|P\b\235=\370\032i\030\2657f\306\003"
+	.ascii	"\367&M79\273\363#)Q\334\310\n\024/r\301\316?\254\340D|u>\324"
+	.ascii	"\344\354\211\013\361-\361 >%\016\364\343\023\327\036\220\034"
+	.ascii	"\361\236$P\347I\002\347\035\222Czg\b\233\35349[\363\2346\245"
+	.ascii	"&gB\034Y\334r\366\b\322G%g\017\26566i\352Y\232\027\233z\246F"
+	.ascii	"\346\227z\026D\207\023\177\364p\330\204&\257\r\220\231\222f\016"
+	.ascii	"\232\230\177\022ml\250l\333\266\245\355;\320\230\356\305\255"
+	.ascii	"\266m\331\233h=\232\027h\346\373\201\231m0\013\375"
+	.string	"\005\354\333\333mb\373\001\256\271t\316\326\013;\332\266\355\316?y\347\221\277\224\376\375\016K\244c`\237\306\266\025\273\342&\323T\326\b\224E\202\3446Q\347\243\240w\307G~\223\305\t\363*T\377\261q\306\266m\261\270\305\264\037\273\204;I\023\231\225c\347\346n\023\217/\004\355\302\206\253\325jU\347\350\366\333\267\264\217g\206}t\215\337o\317\316\327`X:\326\t[\307\326\335&\032\377\251s\212_\203\265+>\225\033S\315\215o\274V\206y!+93+\305\205w\363\306\267\235\033\363\017\tCG\017\3141\206^\021\032'S#\361=\216T\320\310\231i\f\340\335$~\357\2711\037\254\213.\007$\332\"\\\t~)\365\323\321\313\273\377\254\322C\037B)\300\365\352\250\304!gN`\001\346\203qRo\216a\210\362\304\310\220\353\376/\245\201\335\\\327\377\277\311\322\230^e\356+\215\205\213;\t7\340"
+	.ascii	"\221\333\201\333D\377\244\300\2640\257\262\216\236\034\265\253"
+	.ascii	"\325j\234\357\034\267\277\206TP\314\337\260\217+\333\346\272"
+	.ascii	"\314\017D\340\335\354\247r\363i\243vp\t\236\271\313\313\273\311"
+	.ascii	"J\261\007\343V\213\266\232\233\033 \2653\302\301\326\013\231"
+	.ascii	"\243L\377's\177\265Z\205\303_\204\371\255\350\334nH\347fC:\367"
+	.ascii	"Z\321\271\313\032\257\371F\337uK\320\321f\032\327y\306u\226Q"
+	.ascii	"t\016\240\350\034\303\235\001(:\303\270\316/\256\263\013\243"
+	.ascii	"\363\226\321\271\305ufq\235W \235U\\g\255\353\234\302\350\234"
+	.ascii	"et\306B:\243\270\316W\327\331\312\235\253\334\231\n\351<u\235"
+	.ascii	"O\\g)"
+	.string	"\244s\224;C\271\363\223;\233\270\316N\327\271I\307\271D\321\231\204;3\271\363\bw^\272\316\"\256s\210\2433\210\243\263R\321Yy\235\223\212\316HH\347\243\243\263\321u.\272\316\037\2563Q\321y\b\351,\344\316A\356\f\344\316?Eg\037w\366Pt\356):\363\3448wp\347\344\321y\007\351\254St\3169:#\215\316\307b\315\274\352A}Q\312\320\217\264\2051!\352\351w\224\254^\236\376\212qc>\330C\231\370W\341\2056\361\255\306M\354\301\374\351\237.\264\2237\327mz'w\322\364H\201@z-a\231\356h\377\031!\223\236<@\302A\023\fx\t0k\037\373\234\247`\201\230\365\317\273\271\376\335&\226\370#\0202\323\037N\377\\\323$\270\371\234\tK\027\003[G\342u\002\323z\314\340{Uj\323Zf\217\220\332za\t\246\2571dz*7\2416\003\370\215g^\315\2546"
+	.string	"I9#\034$\001M\342\333kz\223\206i\304\367\235T\020\205\021o\004M\223\213\342\326a'\024\031Q$I\250\213\237\365\317^^\324\354\271\324\201\035\032\302A\021oB)\2547\314\205Xj\373\240\300\264=9*\b\021\277\366l\232\203!>\351E<Q\213\2166\020\037\242\b\330\354\345*=\210'\262AG\023\345+\251\245)_E\340]X\3227\232\333\236\020\252\222\254\213\322\b\215\364\303G?\353\230\020\016*\313\364\210#\303yzUs\231W6+\016tN\306\020\016\222\221!\311y\344\360\200}[\002\\\323&\201\2405:rQ\244\177:\265\321\267\n\3220Eo\364O\205,\316\207'\372\242'\212\321\301\004\2063\257\205+\034\357\346\207\276\342M\256\265\352"
+	.string	"\321\347\320\355\021J]\351r\304\274C\337M\300\234\214e\372\230\353`\307\310\330\262\262\333\304\241_\n\274\373\371\"\206\214\tE\214\376\311-\3307\276\235\322\300\344\227\276\306C\301JQ\320/w\004\275\226\033\223OL\013\332\007\240\257"
+	.ascii	"\350\223_\274\214a>\330Q"
+	.string	"\r\313\224\350\247[\350\237O~\321\033j7\032\244\201<}t}\276\335\252%\370|\361\007\fuB\036\276\002\036\017\237\004\"e\214\330\2035\334\0334\\\202\372:\307H\225\nN\273\347s\n{^\b\232\346_\242P\201\332\264\230\034\225\307\fq\250?\034\264\346\203\345\335,\332efM`\177$\277\250aii\267x\370'7Kwy~yB\253a\351\256\270\007%`\325\214Il\334&\362\374\361.\354\206FcC\b\313\306v\233\330\341\223\240iA@\206\206|\371A\3454A\300\326z\222\357T\251`\rI\337\0333S\302\003\302\275\3615\244\201@rg\204\203\035\376\031\210\004\3475$J8\350\311\177v\216\313=C\323\220\243\203\034t\200c\002\034\013xa\200\003\307\327\362\002\034I/\n\276\n\320\340+\004\033\313\257\031^\0344\240\301\004]=,uUU\325E\225\225\005\345\303A\003^\031\330`"
+	.ascii	"\207\006^\313e\007];\334\005\345\265\374\352\212\240\253\202"
+	.ascii	"\250\256\n\2424\2601A\006"
+	.string	"Q]K\016\242\240\206\370k\003\257e\024\216\257\257eTN4\254\207\355\027a\b\340\214\t{\246\002B\302\260!M\367\306\314\022\030\222\364\363\322\302\275I\203\300\214\377\025Z\031?\343\313d\274\025\031\fu\234\307\206z\200N\034\251`\033P\226\243$\200\357\262'\013\340\233J\027\020\343\227o?\366\314\027[\211<W#Fn\023c\274\b\350\235\237\024o\333\026\214"
+	.string	""
+	.string	"\276F\373"
+	.string	""
+	.string	"~Q\206m\333\266\003"
+	.string	"\322\365 \024\032Z\020 \371wiK\246\214\241a\204\261B=\2077^\270\"\211[\227,\271M\204\361B\320;\2779\352\f\034\220\326d\264~j\325"
+	.string	"\376\311/x\332\346\272.\376\205\257q\001\224\206\t\341`\214\255A\271\225\316\273\351a\272\305o\375\263A\303\306U\301\335\260\332\231"
+	.string	"<\323\342\253\240wi\332\013\031\"f"
+	.ascii	"`\301uW<\0133+~\t\372\007\003\260\357\005G\275\270\020\342h3"
+	.ascii	"]\025/4\203\n\275-\255_J\005\225\315uS\274\0265\305/\005\346"
+	.ascii	"\265\370\322g\327%4\237\264a\221\365\354~\376\307\306\315\255"
+	.ascii	"t+]s\020\331D\027\353\263\376\265\350X\201W'\336\307\306=\001"
+	.ascii	"\362Z\347\323\325n\004\\\333\266WMd\347s0k\224U\312:e\312m\""
+	.ascii	"\326?\005\336\025\245\360\200\017\373\346\250~R\037k+\326\234"
+	.ascii	"\322@\246\213\342{M\017\305/%\373\344\332\236\360 \243\342\237"
+	.ascii	"|\365\313\206\323V\177\225g\245\3237\344\221\340U\331\323\252"
+	.ascii	"\372ncl\256[\365\215\326)\250\276\006U\237\020j\226S\313\331"
+	.ascii	"\366\231\340S8\325\254,S\034\260<\315R\334\264E\341\321n6o\246"
+	.ascii	";\365\315fe\352\223\002\375\304\246}WW\315\0212jb\260\372'\337"
+	.ascii	"8\036d\\\250\272L'm\bB\306e\252\2534\215\337q\"IK\375\t*R-m\344"
+	.ascii	"t\217J\343;\332\274\025V\345x\3225\3134\217*\210&o\r\325?\247"
+	.ascii	"\036\360\356\265\312\2255Krjw\"\210`\363\004\323=\032d\272Q"
+	.string	"\177\344Q\374n\325\302e\315\313\273M\214\372$/\275h\025\017\334t\246t\375\303LI\231\024\324'\317<\t\202|\250\362\b%\227\222\022\241\022\021\021\221$)H:\322\n\020\206\"a \310\330\003\022@C-\311\264\330\271\242I\322\001\304\020\032\b\302E\351\365\216\263&\003\254IP\177\334\300A%\001\375s\351\235\003\314\260\001\235D\017\310\0060h\260\225\242Hyc[\234\370\311\361bL\n\256\333hN\300\027Q\332\360\022I\365\013\357\330FCf\267Ta\211\272\201\257\331\034\363I\013\225\024\277LB\220\252\031\242F5#BM\343g\241\326\2522<--\376\261F\272\223\367r\242\225\277\227N\310_\341\017\3732D\231\242\007G\374\353\332\325]\017\317\342\203\"\215\322\200\344po\312\255\001\232M\233xi\022\353\244fu\037$\371\271~\210L\256\247(N\367AY@\203,\222\3466\300\261!\364lO"
+	.string	"s/\253\210\215\034R\025\0045`\336\255\351\324\310\377\367.\227\211\2428\002\326\253H\335\265\234A7\224\343\277\335\233\002\236\275\201\216\231\337\360?bu\rT\r W<\032\227T\"H\003\305\372\252\266H\340\234k>\232\367a\316\262gC\f\305oh%l\005\266\304*\306V\030\303\024\221\241\220\266\225\006\245\023\330)[\330\221\20256\373c#\326\214Q\310\224\r\302\013\274T\224\305\314{\350\346"
+	.string	"\305\341\301\026\365\313Y\354 wRC\364\313[#\342I\r\233\2202&4t\372\t>9\246!\213\360\355\177\301j_2\002\013\265y\364\2013(\003\314_F\255S\272\320\335K'v\037\250O\371\034\377\202EF@\003\352\265L\354`\026\241\270\304\347r\2061\360-E\033\2771r\2154?'\300\031\246x\265\335\r\2147\260\301\t\243\323\024q`\377\343\213\353;9\210z\306.\370\027Gx\364\177\204]\375\376\262\330\326Ht2{\355\364\2508b\342\277D\222!L\212d\360\262\260*7\252xR\203\344|_\274s\003y=Y\350\376Y0\376K\271\356\237\275\n\016\261\214\2661\270\314\375\257y\342\232\206z[\266\271\"\204\253%\305a\024\204D\330\004"
+	.string	"pU\262\235\374\343\226~bP\364\330\223\370\024\322\177\373\001\025\350\272\200hc`5kP\256C\200\261\032\265h\351y\374\316=\006\211J\177\213\372\002\n9\243X\030\035\347@O\335\372\224{v\301\257N\206\347\363v\367a\332\347n"
+	.string	"V\376V\241?\tz\\#\265<~\241\214\312\035\367l\024\263\274\320\2728a`gG\300\265\025\253\265\261\207\024&Y\2151\333x\205\240/\2151\233d\037h\242\361\236\266k1C\230\205f\207\002\250\370\312\255\217\247"
+	.string	"J\035\251cDt)\375\252\f\265D\036\352\304rK@\325\346b\224\023LU\304x\356\260FGDE,\216Jx\205(\013\242;\273\267\001f\00206\bcvq\211B^\272 Lf\261\032s\241\f\264\r\327\200\255\n\377F\244L\354&\267\204,fp\002\2717W\207Wv\021\3276m\245\365<\205p\215L{\2421\331\346Z\301\254\350\257\364\307\254\213k-Y\273\377\3022\341\271\250\367\246,,\207\205\274\232\210\3248\201\234R>U\327\213\0266\271\r6\310\2064\200\\\033fh\243\346p'"
+	.string	"\336\307\363\"\327\037\021\236V\311\265\205\2705\263"
+	.ascii	"\220`e\177&\331c\025%\373\224\"\331\357\317\320\334\210\231<"
+	.ascii	"(\317'\213-\034T\265}\345ZE\370q\262\254\316\375^\221\322\373"
+	.ascii	"\024\360\312\242\215:\023\334\224a\203\226\332\210,-\352\323"
+	.ascii	"\350\336\374\321\007\356^\332Vyq\2378\263RJ\020\312c\337\035"
+	.ascii	"\304\213\200\232}6(s\207(\003\226\270\205\327\217\370\366\026"
+	.ascii	";\264E\240\240Kg_x\t\002i~\b@\323\016Q\023\003\br\237\027\371"
+	.ascii	"a\233 \b(\324\240Q#\321\202\323\212\031\315@\235_X\310\212\007"
+	.ascii	"\266\225\274Z\317\346\321\025\323l\r\213\262lI\2528\031\026\036"
+	.ascii	"\275b\231\004l\361)\243\305\202\353\377h\332<b\210\264\303\242"
+	.ascii	"\257\274\270\324\230O\036\263\211\377R\\\n\375\024k\016\\OFW"
+	.ascii	"\340\252M<d\242I|4\361,\254W\n\034\247\343\016\250\330\202\204"
+	.ascii	"\233h\315\333k\245\231\217\345V\034\347\204D\337!\306&~K\002"
+	.ascii	"L@\337lk[\361\n\303?C\001Q\034\213\317\323\320\271&'\300\370"
+	.ascii	"\025\244\030-\307:\226\2066\371lh\335u\303\324\216\221\214\370"
+	.ascii	"\276y\253\266m\033?Z\t\342\f\277\206\213\354\265\233\255\026"
+	.ascii	"\214\221\263\205\221\203\3211\260{`<\247\316x\371%\2142\3003"
+	.ascii	"\276\337\327*{\204my\t\007"
+	.text
+	.section	.gnu.lto_subTaskPidController.144.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\217\002\345\025"
+	.string	"\206\251\223I\240VRc\210\225\277\322_\274\304\355\265\204\303\344$\324\317\013\241\362\232\240\274\216\034\310\234\026d\343EJl3\021\361x\203-c\355a \342I\270mX\036\334\363B\001\237\351(\366"
+	.string	"g\277\340/\375\317:\354\336{K\231R|"
+	.string	"x"
+	.string	"~"
+	.ascii	"'}(\037\373<\371;\375\311'\214\222\364g\026T\271\301\245\252"
+	.ascii	"\031\020b'a\212/gzS\357\304\237\230\257D\314\352\212\307\327"
+	.ascii	"\275)\202\2236\020;9;Kyr\374Jy\322=\033\311\323\244k.\345\b\222"
+	.ascii	"\002\273\367\242\026\306{\037m\355\371\177:\212p\350\373(t;\036"
+	.ascii	"\030\n\"\004`\030\034Y\272^\030\371\323\253\210!\260V\323\301"
+	.ascii	"\275\327U84q\223\267=c[g\327\035\001\226U{'W/4\355\211\212\200"
+	.ascii	"\326\347\272\205\302\353\3260;\005V\213d\177\274\367^\333#\333"
+	.ascii	"\254>O\274eOo\263\254\266du\035\253\237\3222\324\005\342\352"
+	.ascii	"^\022E'\227\213\364\261t\342\237\276\332\367\241Ne\237\3669\016"
+	.ascii	"\177*e\311\020\033\367\336\363\244TT\317"
+	.string	",\230\336a\003')\023\230\002\337\213\255\227\362yT\317\230\336a\001\240\023P\026\330\275\251\313I\333\304\002\265\350S]Fu\302\353N\375-\200\236\214\250\241D\3524\214.C8\304e-\222\315\327\224\325\336\240\212\004k\023\373?\216U#\301\306\246<Ym\200\030\226\310\205\314\236(\240\232\366\237P\332\025,\324\013e\366,\212ZV\254T\277\307\205[\375\n\203\257t\32278*\367\021\273f\253\027z\026\302\372\354W]\307\007_\311\032p\365B\\y\362\026%\305\257\026]\267T\230\366\351g\277\032\026\336@\263\351\340n\271\235\016\315\321\301y\310@\200G\362v8<\036\231_\026\304\304\324\022\310\310\320Vx8\324p\024rp\272\230k4\333.W\273\251\335\320\332\r\355\200\303\331Ak;\036\2246\3009\235m\207\362r\271\035z\246\277\217\327\036\371\206\210\353g\201.\265\214n\r\263\243\265\266]\256\365"
+	.ascii	"M\272\3672\360\201<+\302\f\r\2150\311i\255-\205\004=\371\325"
+	.ascii	"\342\377\364\263\211\t\027\223/\223\310{J\231=m\305\002\272\001"
+	.ascii	"\f, P\2021\263\3126J\023\250\300\004\334\365\303*\202\343I\313"
+	.ascii	"h\231P\013Wb\246\227\3159\020\222i\210\265\253\315Q\255w\317"
+	.ascii	"\306\336\312f\241=\306\333\210\203\301\036\260\001\311\333\006"
+	.ascii	"\202(8\214/0\307\025\206}e#$\212c&\352\217\\\322\271\t\200\003"
+	.ascii	"\333\222\351\236\331\353ro\214\345\032T\244\371s\373\204t\223"
+	.ascii	"v\246h\013\n"
+	.text
+	.section	.gnu.lto_subTaskMainSubprocesses.145.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\017\t\3750"
+	.ascii	"\312U\320\022D`\346Q\007gy\272\233K\223M\223\255\213\273\343"
+	.ascii	"\276\246);J\256\304\\\034\335{\325\362\325\276\266\330s\002%"
+	.ascii	"\036\3054g_\224\013\271\276b\376\317\232\207\237V&\3670\240\033"
+	.ascii	"(\230\225\326\270\333\336;\245"
+	.string	"\224\002\034\001\003\001\031\001k.\272\313\025\312\274^\003\222Z\224`q\2352\211Vs\301\354\353\264{K7\331\267@\314\023s\332\213U\253k\r#\206\355\303\332\351\002\266\247\246'\266\231X}\271\356\0133\264\032p\3672\025t\312\031\326N\231\0274\237\332\231\373Jca;K\f\346\335[\304\315\230{\231J\234\264vJ\354\241\332)\332B\265Sf\231\3634\223\354\356\316\324(\325\342\356\275\305O\322l\027\t\211\206\204\202\202\300\237\257\307[wj\212\276\263\334\273\t\274\245\227V\027\231\265\020u\222\021\007\326\316.3\3647\247\214\263\304\211\224\364\220\2222\027RB\346Ab\035D\211lnJ\002G\304\344\372IW\230\003\321\341\033#w\022\204\261\331\321O\272\204\370O\f\314}bA\274W\240H\016 \315{\322\365\303Wg\027\020\224x\357\355]\320K\331\315.\360\244\353\313\325\036\235r\311ptG?\232"
+	.string	"\216\f\240\240\327\026:\304\321d\331\315\366\032^I\367\335\204{/\373\322+G\363\260\231\033\0063k1\257j\350\367\234\020\372\255\243w\217>\001@\316\353\317\r\177T\016j\322\037\003\323\336\301\3218Q#g\376"
+	.ascii	"\302{\311\304_\233\026g\223\315\301\205y\256R\373\241\232v\266"
+	.ascii	"|\216\205\276\336\016\2412\213\030\341\275\354w\032\262\365Z"
+	.ascii	"\354mX\234H\337iMD\372\223\203\234\331\030\345\275D\372\026\033"
+	.ascii	"\222|-\036>\235\310\361\271\376df&\375\307\230\373\333\266}\362"
+	.ascii	"\037a\3769;X\235\233v\316L\315lV\352\264f\244\3259\300\317\371"
+	.ascii	"\350\347\f\240\347l\304s\036\256\316E>g\241\317\231\310\347<"
+	.ascii	"\264:\013\361\234\203v\316\301\2363\260\347\374\3439\373v\316"
+	.ascii	"\275\2353\217\347\274\256\316;\325Y\3359\247\2523\252:\277\352"
+	.ascii	"\354\252sC\350\265+a`gk\236\016\363\342h\003]\267\264\314Y3\273"
+	.ascii	"\323\270\325\372\013\263\217]4\027n/\300=kS\302\256\334{}\275"
+	.ascii	"\326\345\212\270\305\274^\021\350\274\\\211{\322zJ\275\003e\036"
+	.ascii	"x\3203\263^\254\016\357e\323\023\201\037\364\250Z\033\262\241"
+	.ascii	"\037ck\236\257\356;I\r>\317O\360{N\331W+\204\245\002\037\212"
+	.ascii	"G\357\321\323p\254\217\037l\220 j\247\3007\360v\300\311\326\006"
+	.ascii	"\261B\332\213\363\f\202\26107\270r\2413\203eJ\022\340\217q\260"
+	.ascii	"\261\324\3377\022\261\266\203U\247\337X\"F\330\2611\265\323\337"
+	.ascii	"w\216/1T\270m\333\366\347\373\365]I\263M\357}l\222\236\303\226"
+	.ascii	"\255\367n5\340\216\323r\330%L\330\2633\265\323\336\267\332[\226"
+	.ascii	"\335\257\337\312:\244\267K\355d\321\326{\357\003n\267~\303B\341"
+	.ascii	"6\353\224\331(\254\024V\212\332\351\356\225\336\312 \275\355"
+	.ascii	"n\333\266\316\247\"93k\205\305\342\275T\337\t\212\3227"
+	.string	"\223\350\314\024*x/\225\0168}\320\365,\004\333\2366\226S\376\360\222T\246\357f\257|\320\031\235\244\246\317\364\354\312\257\244\267\314\235\246\325\\\3406\343\f\032\274\227\032\324N\323_z\373Bz\313\2776\271_\222\266ff\r\214b)J\305\224\024\325\261E\321\204\212\251+(\001ViU\n\343\224\007\253c\t\253\252\236\t\025Q\030\216U\031\250\216/N\370\230\251\001\003\006F'\b\020\226\204U\037\242VLy\260b\021u<^\031\201l\\\212:R\031G\030\245\212F\251\"\213\251\022+\212\306cUq\351\210\251ZD\035\213VTT\307\242\217\211l\364\376\021^\341\264\271!?\311;\264/\n\340J\247\301\242\025\311|F\226\034k\303\233\317\250\016>\300\253r\224u\310\265\356f\267\224.B\334\344\340vu\372J=z\007\357g\270\252$\277toM\207\263\275t\203q\325\335\240\322\347\350{\255\211H"
+	.string	"\177\364*\035\227\223\244\267"
+	.string	"^E\033\002\245\310\365g\323\031\223e\210p\327YO\325\350\245\232o\256\345\310\254g\026]V\233\325\252\235\032\275Q\331\027\023\2346NU\310\215\343#\301\207IV\306\326k\261\322\017\241"
+	.string	")\373\240\367\336KT\364t,\332\220,P/\371\b\277\210\350\207^\370\217\207+\254\351\211\036US\326\t\375\320\\\\\313\2614j\2606l\250\235\n\375\260,\200\263\250a(E\025c\206\210DA\222\222\202\244\003\240\002\021!+\326\001\020H\206\210j\322\001\333AXLR\342\316O/\301H\374%\003\202\006@\2122dX\325\277\004\021\330$t\350\n\341\274Z:\255\034\325\374\265\361/\331\274\2278L\360\262E\304\021\316\312\253\224\267\232\024<\315\320\360K\316B\232\024\3578\200%\232/\"\0317\344"
+	.string	"]\206X0t\031\331e`E\263\253@\330\\C\220.\210\372\002(pF\016\335\230Hs\253,\342\223 \205\021\334~F\373B\224\346e\226\002\303}\2206\220\300\343\231m`\243LS\230%\315\267\252\223\260$W\337sh*f\270\236\240_k\f\316\357\003\030a\347\017\314\343\314\316\340\320\335O\200\033\233h\343\340g#t\202\265\302:J\207\307\235\356\327\200J\216"
+	.ascii	")\240\331 [\264W\bd0Ei\340\260[5*\261d\032\230\325\0306d\237"
+	.ascii	"\177\321J|t\034\214oc4x6\t3D*\363S\250\336\344<&Z\"\341\253!"
+	.ascii	"0\005\242\242Fv\252\204\243+?\274\305\217^\216[\244\317\252\365"
+	.ascii	"2\020s\004\n\022w\216'\243\002\343'q'p\352\2433\223\242\346D"
+	.ascii	"\021\220\312~u\276\035(55O\203\224H(S\220\353\255[\005hF\266"
+	.ascii	"\237\252\374\b\364\317\315n\n\242\177"
+	.text
+	.section	.gnu.lto_subTaskMotorUpdate.146.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`b\005\025\""
+	.string	"\026\275\326I\220\330Q:\204mO\266C\217\257\327\311a\304\n\247>\346A<g\314\247\321=\321\331\3741\367\204.\217\366\373\277d\213\325L\026\341\231\241W\211dI\027@/\022\005W\036\275\330\007\265\315\200\310\341\225\266}B\b!R&\031\301"
+	.string	"\265"
+	.string	"\300"
+	.ascii	"{&6dP\244pX\325Zo7\263\226 \351(!\253\021\335\341\304ee&A\330"
+	.ascii	"\323\374\254\244/A*\221\325x\200\210\305d\304\254V\344\203\233"
+	.ascii	"\233!\275\271W\222\264{\273\311\307\332\033\317R\317\255\236"
+	.ascii	"$\370\253\026\257O\365.\276T\301H\326\212tps\027\2447u\236;o"
+	.ascii	"\226\037p\336\334\340\356\230\002KU\350Cu\326\244eVk\325\265"
+	.ascii	"\217\007\237\242\247Y6\007\367\307z\255h\024>E\240\343\351x\364"
+	.ascii	"a2\216M|\326\270Y6Hz\225\301\031\231\312\234\223\220\342\022"
+	.ascii	"\2274\336e\204%3(\234Q\251\2541\323\304\345X\347\027F\"3j\241"
+	.ascii	"\326\272\\4>}k\337]\031\273;\3345\177\002\305\233\276\215(b\013"
+	.ascii	"\367N.\200k\313Y\330z\211r\025\325\347\235o\241\2541%6\263"
+	.string	"\373'\207\302\333\007\331\023>~\321w\336|\347\306\216CN[n\222c\352\254\2542\332.\222\310\335c\367em\036\273(o\316\257\2768\337\372\346\336\365\275Iyq(\257\r\312[s\362\336N^\233\215\267\226\362\2465^\264\306{\242\274f\215\267Ly\033\345\345\223\367\bzT\234b\030\357\004V\253S\332\231\232\305\2242\344[7\371]\377\325\313\335\363\030{\226\353N\366\306\363\324\305\242\254\\?Tg\246\220\322\233<@zvw\213\005\216\350\224\\\024\327\332\275m\322\221\001>[\327\214\035\317\252\244YY\002\306i~\020\311\271\033L\022\304Zj\341\366\240r\270\326\273\0270\360\213\253\243\324\302\335kyX\n\r\0336\2347k];2\020\273\201\323\277\302\341]\016\035\370E\234~\016\254_J\314FXy\323X\024\214\035g\244;\277b\205\277\212eh\247\375\263\313F\373f\237\375\2464\303*$<"
+	.string	"\231];\226]\212\0213vO9\330\007"
+	.string	"R\265V\n\373\257S\t\261\017rsE\214\030q\356W\261,\327\335\374\325\224f\310ii\271\376\026\367M\347\272\265\230\246\210\234\266{\257K!q\004\004t\336\344\236\260;s\256-ha7\375\256\353\f\031m\003\360n\320\216\037<\242\032\217\310\007\"\b8\304\373\001\252\340\375~G\273"
+	.string	"\213b\2077\344\353\025\375V\350L\f\371\216\204\f"
+	.ascii	"\315\2050\301\307g\027\241B\205\235\001F)v>\020\300_\020\320"
+	.ascii	"\310\266\273\035\336\257hWb\327\323\355z:\025\276 \"\335\356"
+	.ascii	"g\244\333)\260E+x?\035\260\250\350\247\273!\207/k\363\330T\f"
+	.ascii	",\313\260\211\213Ru\212#\373\240K\3464\256\317.Y/\322\204H\324"
+	.ascii	"Y\022\375r\244\323\246s\232\277\230\216\0209m\257u\333\326\f"
+	.ascii	"&?\024S\032\030ddl\372Y\327\031\326\264M\237hj\372\244\212\252"
+	.ascii	"\322Q\031\355(z\336y\353^\230[\023\370\001A\354\353\\\300\273"
+	.ascii	"\301\252 \021b\013\275.e&\031\305\354\036\313;m-\224\005\306"
+	.ascii	"\013/X$k\250A(\3121\245\230\031\021\221 \005ia:p\002\221\031"
+	.ascii	",\363\020H\310h\223t\252\034\f\016\241?\242\310W\347\035N\305"
+	.ascii	"cJG\243HAWWu\376\004\340\232\"\371f R|\231\267\205H\361\372\336"
+	.ascii	"\260X\241\333\005(\264*\210|\034\340\306\2268\025\027v\243\315"
+	.ascii	"7\211\343:\243\305\036X\260\334\302x\305\266\004|\370\202\336"
+	.ascii	"\216\230a\224w\204\377\2438&6\263\241\222\026\236\r\372\271\201"
+	.ascii	"\036Uw\f\355?\237\370\237S\327\200;\203V\252\374\027d\007\233"
+	.ascii	"\274\317\242\003\f\274-uY!\304\n\367\260\034M,Z\371\371r\021"
+	.ascii	"e\002\316C\216X\0228&M\251\032\323\351\251\031xq\231N\247\204"
+	.ascii	"P\271\364\213\204\200 \372\272#h\2233\230,\367\f\2441\321\344"
+	.ascii	"\013%\305,\"\210\320c\275\224qy\311S\276Q\003"
+	.text
+	.section	.gnu.lto_setPidUpdateCountDown.147.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"\r\013"
+	.string	"\006\225LC \215(\035\334\303\200ML\2553\f\004i\247x\262[K\b~\203/\376\305\330.8\227\346\326g\263\330QC\304R\007Y\354\334D\321\007\b0\002C\241\\8E\002\335\346\031\324v\230NDd\023)S\n;"
+	.string	"7"
+	.string	":"
+	.string	"!!{\230"
+	.string	"\242\227\007\204\006\002.\214\330ei\252\340\3361M\317\027\035\333\360\200"
+	.string	"\203\t4p\275"
+	.string	"IX\307\356^\365<\201_&\205fw\235&\260\300\035o\233\304\366\207\375\221W\215\017\253Q\206\276\352_\340\332\320a\263\204\315\372RS\366\261U\224\355ttZ3\235\231~f\021b"
+	.string	"\370\003\"v\t\204&\226C\324\360\300\366\355K\b\331\027\203\004\032O\224\022|\031\332\356\334B\205\267P<\034\227=\246rdp\275rwE\352Ov=i\201 %\t\333+\247\360\251\330%\211\370\023\276j\361\031<\032"
+	.string	"(oz\364A\331c\3362\233\216\333J6\216\266q\264\224\216\211G\333\272\217\226\301\230S\331t\032\013\307u\332\2055:\266\212rF)\202\203\374\275\354\252chT\325\223mUkF\372a\232\n\357e\2511\021"
+	.ascii	"\023\013\r\262\r\017f;r\3012@\b\030\030\262\271B\036P\245E\334"
+	.ascii	"a0\341\270&\312\303\304\036w\363T\345\216:\271\265E\017"
+	.text
+	.section	.gnu.lto_debugGyroToMotorLatency.148.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\374\006\025#"
+	.string	"\226;\325J\200VR:\301zh\020\030\350\024\237@\246\356\327\347\216\267\341\003\256\322\t\334\270\003\207\224B\352%O\016\303\337\212\322=\324\357\032\376e\367\303tC\320B\215\270(2H\210.\006\315\213\034A\262\233\310\033M\366l\226\020\271\223\f\273"
+	.string	"\267"
+	.string	"\301"
+	.ascii	"w\271\2331u\206\025u\300\244\347\366^H\357:\246\314\273<V\230"
+	.ascii	"\023Y\364*\033\235"
+	.string	"\b\0223\314\325\364B>\344M\206\331\351\332JJo\027\005+\264* 2\255\244*\2534\350\275\314\r\353\325\235\265\036ff\211\337\026\367(\260\254\224@\357\275\t\256\262\205\365*\363NT\317-\363\261\236\245t G\346\335+\243\211\363^\346\002F\260^\375\235\200\356jz\001\272\253\254\304\354Fc\342.\361X}95\243\367^`\333\270\322\323\266J\3747\317S.\227\236B\275S\033\252%P\001\226L\351\001'3\252\274y\233b\231\264v'\341\336\313V\271lqV\317\314\025\230Y\005\363\256@\267\277\365\037\322n\341\236e\026\032\262W\366\372R1\222\275\304B<\250\204\246r\2360\330\256\335\302\314L\332\256\301\374\364\336{\271i0\257\226qV\3137\253e\233\003\371kx\226gV\3132<\3131\327:\373\276u\356\275X\346\275X^W\313\273\027\313\272\027\313*\317r\312\263\334\253e\273Z\276\001"
+	.ascii	"]\236\226\237z\336\273b\216\313]S\305v\\\353\337\372\316\352"
+	.ascii	"\254jU\346\247\235\035\215\201\224[4\t\331\313\356B\252-*\346"
+	.ascii	"<\222\013RY~0\213\023pV_\320\033a\206a\244s\361\213<\354\202"
+	.ascii	"\024\226\350\275\027\006\354\013\n\330"
+	.string	"\027\334\237\326{u\035\177L\314\317q\225}8pP\276\311\264\332\217s\352b\2266\025[\246|\213\351\356\264\337\204EJ\367\233ci\202\363\241<\212\207\021\035:\350\256\316\334\200C\006a\263\375\244\333\224o\021\230\230?\352zm[mk\242Jv=\263\254\016%\225\223f\017\272\231\006\032\242\306d\2650\377\314\354\211\353\312i\3233\357^\333\244\241\275\177f\326\344jG~\016>\372\261W\376\350\256\276\001L\211\312y^\261\335>\363c\177\363\257\301uU%\007\225\351\230\246\211s\352\202\264s\354\353^\313\264M\\SU\322\316\361\223\\\235\223\361\262\363\332^\254\300q\205\354?\344\330\177H\037\276\276V\214e\016\n\355\225\276\234g\017\266@\347\020:C\242!#\260\210HDD\024\326\004_4,\026I\b{G>\306\tIA\301a\206\2401\030\324;\362I\022\026\r\215A\021<\336\351\341\341\0216\200"
+	.string	"AG\300\221\317\220hh\203\261\0304j\b\0322\n\300B\235a\221(\374 \004\001\024\202"
+	.ascii	"\026\r\005\211\200\302\342\021P\207\206\211F\303\"\320H$\026"
+	.ascii	"\2010L\344\323\3334x}ZYCv\222}\315\345f\212\032O\347Z\344n\232"
+	.ascii	"\347<\262&\007E\326\364\215\030\022gM\377\b\023\266\265\343\236"
+	.ascii	"\005\213=\227\341\364\352\005\325\224\345\224\203\"}\215c$l\327"
+	.ascii	"\007\373\017\351u"
+	.string	"\345H\342g\327\003pD)\321-\270\025h\332:4\265\231Y\301\3350\364n\334{\037\360\253\274M\003\007\200\212\250aP\347\030\022\032\222\202\244\250 \351\320\002\021\251\2629\022\340T9\212jFY`P\311\376\177\006\347\250\244\237\373\253\305j\004\213\234\016u\331`^\244\236U\303\250\037\335\335\2065\345\004\242xuCV#<(\237k\342\337\006Im\027_\361\217\217\371\257\232\030\371(h}\200\334d\223\221#\356\271\320\323\023\2153\032\002\250\351\234-#\344\301F\240\237wh\032\310qS\346e\354\\\321}/\273\240\312\234p\361\326\237\274(2\032KI\242\026E^]\3045\013\336~1\265 d\362a\272\004\356\252|\005\357\351\306t\360\314_\36781\304\202\037\364@8\315\254\3705\311w\340\212\356\3069\276SKXh\201\336\232\324;\3614\b\336\313\302\002\353$\323\365o\034Cf\033H\242_G"
+	.string	"\002'\350\332\002"
+	.ascii	"\272\037\217p\232C\237\307\353\032}:\300Ro\0010S\240\203`\334"
+	.ascii	"\373A\\\3165\"\322\261\022&\315P4%\340\325"
+	.text
+	.section	.gnu.lto_subTaskPidAndMotorUpdate.149.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\267\001}\017"
+	.string	"\366\033eE\020\257h8\030H\0358\024\200\322\177"
+	.string	"\032\024\370\326r\333\236\001!\333I\371\037\313\211/uw_Z\211a\2355d\365p\0230@\272_\0040\240\242$\323\303\352\241\374\030D\006\364\256\237+{\377\275\267\224)\005P"
+	.string	"M"
+	.string	"P"
+	.string	"\335\347\035\336;\356\034\336;\253l\033\217\327\256B28,\"nv\027T\rW\335\3538M\225\377\361"
+	.string	"b\262\325\275\n\357`\257\344^\256\\\310\353\346\202\206\314\305e\340\260\250\370\370l\221\26521Hv\327\031\223\271\334\030\267\215b\373\200\375\026\001+\336\305\033\230\2612\307\0376\027)6s\354\332*\225f\237\333\335\265f\260\277\213\267f:3\375\214"
+	.ascii	"\030V\310\036\203bw\302\216\316\322t':\\\374\355\177\264\007"
+	.ascii	"dE\356\341\037T\027W\276.{\t72:,vk\005\336\231\300\367'0\016"
+	.ascii	"N^<i\243\220\3621\177\306\177\303\215\202\232\204\305}z\361\237"
+	.ascii	"/m\b\247|\354\323\324\254\245+\177\204\355\205m&\304\231*\315"
+	.ascii	"\002\236\362\256\ffj\\\211c\037\304gR>\007GP\311\307\336\371"
+	.ascii	"*\336\273kG\r\f+w\374a\313y\006\021\t\205\302\220\221\021\020"
+	.ascii	"\307I\201\2104J\2002\225\240\0204\030\245h8\004\211L\245pAh\002"
+	.ascii	"\206&\340\203Q\t\t\fM'\020\344\341R\212\310\004\242J%\023\350"
+	.ascii	"\251\355o14,my\033\251j\207\"\327\315B\2474\017\200\2156\372"
+	.ascii	"\351\006l,\221\257]\265%\304\223D\006$ p\002\031#\353\001\325"
+	.ascii	"\026\224\006\254a\265\302>\013\205k\357\332\306\001\t\353j\204"
+	.ascii	"(\205S\202\233\223\230\374\336F\260\302\262\333\374m\022\013"
+	.ascii	"\344p\242\263&\362|\255]\302]\314[\017\204`a\264\3218f\035\305"
+	.ascii	"\013\352L\242\260\005(Iu\223j\307,j\306\224\002B\001"
+	.text
+	.section	.gnu.lto_taskMainPidLoopInit.152.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375 \3045\005"
+	.string	"\222I#*pm:\200\206\017C\200\226\027d\315\r\251\264\177c\330\222\351\346W\237\360Rab\276\252*\250\210V\2524\364o\240(\356\235R\236\326U\351TLLNL:\030\213\206\234\025\"\255\312\364qU\031\241\264J\312\333\307\256 \211\023\033\026\226lO\203\361b\037\260\261\263!\241\363q\327\214v+'\323\206\002\240\215\355S\316l\321\275\314V\234\217\362!\355\256\214\230g\207\231\177\317\007\033\247\035\n\022\273k\270q\226;\336\366\3016\3026\r\b"
+	.string	"3\003\366\231\001\301\367\273\206\273\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.153.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`z\005\325\""
+	.string	"V\376\334H\200\332Q:I\004E\247\004\336G$=\fl\343\3545\n\235\2101k\212rx\244#\016\252\200\265\007\372\255\233\321\265\016\355)zW\217\221\232\236V=c\203\243\377j\216\002\021\317\341\211\342\244\271\031\327\366\177B\b\3312\311\307"
+	.string	"\271"
+	.string	"\313"
+	.ascii	"\027\254B\221\032A\214l?U.D\314o\262\256\320E\255\327\250\223"
+	.ascii	"<R\246\004\355\336\225\301O\316`S\225D\357w\361\225|\t\360LX"
+	.ascii	"\360\355\336\253\256\260{W"
+	.string	"\007\254\300\366Sw\036\364\247\371\035\364'3\233}\315\272\005\270\310\210O\320\356\275\252\345q\340s\270\233-EO\3236\220\237\026\335\212\306\340s|\241\215\343\322\242\253*\033\277-\251j\230\272{\357\223\007\032BE\243m@WU\307\247\346\002\2531\031_R\035M\236.:\316\020\033\235\361\323\\p&\346F\3078e\362\300\370Q\224jS\306\255\371@\n\355\206\2161\312\314yC\374\362\344\333\205q\330\235\026\335{\271\213\306\252s\316\231yef \363\251\006bK\026\023\306\004i\317Co\223\222d\242\372\r\363\243\\\n\217\277\305%z\375b\017\375y\313C\346(\3545\356/-gijn\2531\257\303\266X\3147\257\335\301\214k\376\371z\366\271\327\271\347L\376\235\2639w6\337\322f\333\331\234\336\232\321\264\371\2645\233i\263E\233\373l>\002\003W\206^\234pm\261b\326\013c\r\316-;\247"
+	.string	"\371\372{\275\231\317\177r(\3149\206\272\023>\030\2004cl\254\224\334{sW~==\351c\fQ\220\310\354+\241\376\365d\256\327x`\330E<\242\375d\021\266\237\374'P\314\271\237\347;\001\362\233<\3119\225J\322k\205\031\351yhj\225\302\244\226\200\326q\310,\211\217\375\032\324=\226\017\024\2022\003\211"
+	.string	"\271\372E\037{\034H)\033d&#\t\216"
+	.string	"\223\004\231\025\351\261\367\272N\330j\f\324\314\300.\n\375b\217}\016\344\320\006\271\277\326 \323\324\240\026\213\354e\t\306\26091v\240w,\263\005\f\375\"\353\264<\353\315Y\330i\261x\tEmR\262\214\226\217e\320}\2135l\330\200\376Dm\016\231\243W\257q\220\231,K\363t\360,XL{\332\023\343\360\253\334\n\207\016FF\226G\213\312\322Zfnp*G\001\262\356\275\022\370b\237\362\201\277\365\223A\204\bQT\323\326\332\256B\2143\240\005|\004\312\214\264\353\027\333\202@F\331 \037\314LlB\210\207\242\247\344\373\245PI\240\350\251H2\340t:\375\220\234\232pM'v=\017\276\037T\211\033\017E\200"
+	.string	"a\367`\302\004\241\235\246#\336R\317\203\023\023\357\367S\261\003\300;!\336\317\267\033\261SRwJ*S\017iI\335\375\232T\241\002\354K\301\373\251N>\337O\315\255\302\233\327\356\340\013m\312\322\316\204v\230\263X<\200Z\326\006y\307\366`\026\335\"\ny\357\035\352V\343\306\345l\232\265\234\265dSV\303^\343\203\231\211\365\2757x\343\24174@\0377\241Y\027Jvu[\315\332lf\216\3242?\326fQ0\312?\371\027\371Z\023\226v\226\216\371\023\352c\177lW\231B2\204r\2342\306\362\202\3757\246\342\274\020\262Fy\"W\377Q\264*K\003k\250a,G\211Q\312\214\210\310\310\004i\223\016\220\242\231\262\352\006\021\260)ud\322\354\031\331%2\266\376\232\210\255\032sy\212\037\367\260"
+	.ascii	"\361\230v\263\317I\3543\33445\324\343\341E\252\002gk\324\334"
+	.ascii	"\026\330\223\351i\231\241\274\215\331\032o\330v\017,\355D\233"
+	.ascii	"\353b\373\375D\273\026hS.o\263\301\333C\205\342\246Y\365\312"
+	.ascii	"\277\002\272@\366\315*\204\027\266\033\017\272\211xo\033?R \242"
+	.ascii	"1\263V#\262\306\223\241%\0348j`o\007\370\272.\017q\201t\177\275"
+	.ascii	"4\220\277\346\337p\203\034\2152\220>\np\274#\341\344S\007\017"
+	.ascii	"\303\217C\023\313\207\2253m\317\247\337\261\021\233J\031T#\256"
+	.ascii	"\200\261ua$\334x.\"2\351\272\245\375\243\364\317\273\0214\f8"
+	.ascii	"\377A^<\365\250@\330\321nJ/\324"
+	.text
+	.section	.gnu.lto_updateLEDs.part.0.241.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\372\002}\023"
+	.string	"6\341tG\340\322&\035\252\246\232JD\222\231\272co\224(n\244\032\3556\t\273.\233\362\264\274\261\003\301\262\311\007x\365\3349\fr\212\361\346\3538\3032\214s\344\263\205@\324%\243`f\231\277:X\265\204\020B6\331R\246\024d"
+	.string	"V"
+	.string	"`"
+	.string	"s\202\327\226\303Y\377\274\216\333\244\026WM,\177K\031\350\321\341\202\271\374\313p\257@\267\245\270\243\227\215\210W\215n[J\346s#\307\002\206\313\231\017&\243ZD`\343D\322\t\026\023Ch>\270d4\252\013v\341{\202\301D\2219\347c\327\n\260\226*\310M[j\316\351\277\334\334"
+	.string	"n[\310\366\001{cw]\363Y\344\265/\212\247\346E\227l\232\2558\232\252\244\273\3435=\316\325\261U\355\251\272S5\247\352-\252\345\2525UGU\257\252U\325\017\001I\300bN\232\245\036\023G+\002a?\326b\177~\214e\177\327\356c\273\345e\226]\343?\035\346e73\262\0353\241\224\373\244 \027>\321K\204&((\362\232\334\005)bhBh\024\244\266\253\240\031\237\332\020R\364.m\025\340\264\326\305\246\031\216\030w\350.\244\377\270\212\334\215{!\325\236f-t\316\351\262\273c\033%u\037;\207\024$\003Fy\230;J~u\25535-]\262O\342?*~\217WX4\016GLV\252\220$<\001\303\0230\302\203\222\0240\\\255\200#\003\254\222`\262\002'\250T+\360\263\255\217su\030hx\361\262\255\257\001\221\215\367\275:\007\002f>\214\002\306\006\032\334\356"
+	.string	"\335\353r~\224\354\326[\253Q\267\004\224\356\001hH\305\306\025\311\276-\2677\261yI\001\324&)\321\273,r\232\3450\212\215\340\2211\036L\250\201HF\005\244\210\002ZfR)t\220\002\031*Z\017\021`\261e'\nNs\024\003\tY\323s\346@\320\260\336\3335\311\230<\355\b\342q\217\035\202\022s\216\230\362\003)v\363\270.\221\223q\334\352\315\335\365\236\335\303\222\271\311V\313\364\334\002\3615l\206\261\211^Z\035\361R\345\21463WL,\274\005\263\353t\005%\013\233\367\206\351/"
+	.ascii	"\274\rT[\251\331\243\256X\267]\270\004\376\223\031\2242I\264"
+	.ascii	"\263)\262\320\bX\375\330\355\233\253\271(\325,\207\241L1T"
+	.text
+	.section	.gnu.lto_mwArm.part.0.244.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\250\004-\036"
+	.string	"&u\273G\220\234Q\007p\033\350\217\274\0137\001T\361\214:\242?n\340%\347\256p\265\321\260\024b\221\370\215\326\n\272!g\353\202V\325\274\343E)BOA\022Al\3338\362\304\346\r\330\276$\320\001v\354\222\264-\245L)\245\246"
+	.string	"\234"
+	.string	"\255"
+	.string	"\316\334=7\3200\214\246b\240%'`\360\336[:\267p\210\271\344\026\236\314e\327\236b\346!\037\237\314dz\bu\273\312\213Wu\274\367\322\272~\217>\273\224\305`\244\255\364\335<\271e?\242.\017\310(\0033S\324t\321\247Dw\216\200\364:\312\227\303c\024\266\202R0\372\240\350\250\303\374\342}\351(_\222\223d\216!\226g\344u\302\221c\320\253\211\206RS\312"
+	.string	"\230\005i\366+\242;^x\210)\177;\377\242\017\0075p\357ma\273\214\237\316\035@\233\344\317\275\227;\247\243\031\247\231\331\212\231-0S_E&av\376\305\335\005l\277?;/I\347o\230\273I;A\301\375\203U\334\274{]\271o\266k\377"
+	.ascii	"\037I9\177\303-\354\016\\X^]\327\331\370?\361\233M\357;1Sg\235"
+	.ascii	"\352\234S\235g\2443\016\351lR\347\262:\313\254s\314:\303\250"
+	.ascii	"3I"
+	.string	"\235mu\256\325\231R\347\247\316N\235\273g\301U\016\360\336\2437m.S\245\022\304}L\206\370\305\217.F\021\275\n\362$x\274\273a\003%\275\004\006\277\340\031B\321\260X@\270\200\307{\207\264\256<\354\035\333\025\326\001l\3273\230\264\024\205gz\234Y\303\006\357\236\354[0\351\236\210g\304\254\330sc\351, 8x\360\356y\260\262\356\261\260\217\375\2471B\302\037\372\n\b\bP\314!\332\212\b\007[\367\336\bZ]e\004\367\217\256L\242V{\b>\250r\304$\344gu\257+G\376k\361\220f\301\031qJ\200\325\315\202Y\243[).\243d\013\030\262\210\004\251\237\321\332l}\234\315\322\257\337W\035\305f\"(\310v\245\237\300\230\224#\322P_f\260*}r\277\211g\304\035l\245\350H\b\375'\253\376.\372&q\251\350\367^\242\377'f.`\375[\330\260|\302\307E\212\033Nh\005\216"
+	.string	"\327|l\270[mD\255\004\255V\202\266\"\210\204\nZ\r\347\202\346\303\3037\0266\034M\350v\303\321Jf\366\246\367\235\370'\367:\376\246W\201;h\346\263\310i\304\224b\203+\f\221*\231\216\021J\367\353\270\224\032~\345\270\005)\366UD\340\265\317)\313|\n\317$\336=6\260{\"\026Z\303\344\325\225\363_l\025\202<M\257k\366\262\317y\032\305\b\210\3633r\253Y\313\232\217\363<c\214\242\3127\277ynr\026\332\313\005\330\275\273\b\334\\\272\013\206\f@@\266k\371\306%'\240\220\212Tjj\252\356g\250Q<\007\021cd\204d\202\244\240\240i\f\200\002\231\252*n\020X\211JS\350"
+	.string	"B\331\022\036\201\366\262\325\b\271\201\022m\\\026\b\366?\032\252s\231b\027\214R\232\037\013\351\017\374\267\247M\311\3176\007\343\315@K\207\376T\262&\311\327\274\230A\\\30436\204\327\274\351\326\3464\376\304\355\364\353\344\300\255\243\370\233\231\265\032N\023pL\254/\204\230Q\200\370\256P\214\217\026\025\256T}\300q\204ks\303V2y=\326\255-\302\353\273\005\363\333xU\025\315\364 \rvw\253\3657#E\313+\237\001\306\337D\303\231Z\245\256\233\336\022\331\243\347\376kt8R+3\270\206"
+	.ascii	"DmR$j\333)_\305\030\327\2020;\002\220\203\330r*?\304\350K\003"
+	.text
+	.section	.gnu.lto_handleInflightCalibrationStickPosition.part.0.245.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"-\007"
+	.string	"\"M/4PO\222\016"
+	.string	"\234\213]\353>5\224hi\304\2650"
+	.string	"W\2440\315\265\367\310\354\326C\027\303\317Q\230\335#\223\256F\222RV\253\263X"
+	.string	"\270g\250\221Md\nS\232\215UQ\016\024\347Q\234'\001\361\020\361(\213\342i\016\256&6\326\253\250*\353M\177\253K\004\335"
+	.string	"\323\222\201\032\210\241_j\003\265"
+	.string	"\370\013\214Vl\204\r\364L\260\"r\3116j\030\032]]\"\350QaT\020\222\3311#\223\"\022K\3117\353\374t\263\353\247J=\371;\036_\377R\024\222\254\212\210#%&3_%\034\351Ul\356\272\330\307Sl\326\206}>\332\f\352\002\0302s\001\220.\365_\370\023~\223\017"
+	.ascii	"@\023\030\027\f\226\"\017\020\005\303\\\3416L\3309\003\350\f"
+	.ascii	"\320f\312N\003\300\265\347\202:f;O(c"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.part.0.256.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\357\003m\033"
+	.string	"\226q\256G\240\232Qcd\017u\212i\257q\271+\352\233\243\004\214D\267\034\233\017\222\031\355\016,\245\335\3706\3701Q5\364\315\260\355\356\326\354\344\314\f\0302*\317\031#\214\231\250\3660=\252r\276=e3|\213[n)S\n\222"
+	.string	"\236"
+	.string	"\227"
+	.string	"2\373A&-b\275\363\372r\202G\256\224h\335{2\270u\006\327\255]8\210\306\350!\335{\035\220N2J\177\372K\316\244;0\3108\367\362"
+	.ascii	"R\335{6\360"
+	.string	"\002\327m\354\004\306[\361\003\306[j\373Il\347j\330\036\363\363wu\212l\031j\322\272\367\222\267\365\307u\267b\245\243\316\207z\002\243\252\335-%\362\335\270xC\201I\207\026\036V\224\317\306k\216\257'\306\356\275\227:\225\341\343Q*\340\343\r\205{\257]8\356\233\333.m\353l\361\001KA\002\034\335[4ds\221l\024!\177\372\235^\305?\261\336\371\363\371G<\177\276\034r\212\037\310r6c\273\363W\364 \220\336\311\340\201\fg\363\347\257h\354\261#\213\274\275\360\376\223G\261=\312\207\002\240\214\0264GJ\250\246X\310v\262\033z*\333\247X\210\347\365!\340\001\207rh\335\232\204\353\211\315\276\224\r3\356Q~aD\305\310\275\027\346\004g\352\013s\276\323\237\016e\230sg\356\300\240\007\201d]\250\363\203o2\354\226\224\322\324\244\205x\237,,\355\030\322\301uKZ\005\377b\372J\376"
+	.string	"\002\304x{\250\213ZFTxXQf\204\350P\254I\303\233#\255\265\33260\216xt\030\342W\\n%b\004\017O=\360\004\246L\027z\357\335\325r|-\021\024\323\243k|)\367<K\351\272\267'\301\277r,3_\351\326'h\364D\264\361\366\265@\030&!:\364\245\376\037\030\253.\227n](B\245u\346B\3753\204i\220\324\230\271\264&U\375\302S\272\345\003\357\nBt\313u\254I\366\305[}\330/j\361E]_\324\364E}\0341F\2613SA\3631k+H\023*h\270\022\006n\366V\353\271\331^\266\024%\315\203Ysq\002\307\016$D\210PB\2300ag\200\355\303\354\207\346\341\0064\253\325p%"
+	.ascii	"\227;\263\232Y\362\224>d\351C\002\321z~\310\262f#wtl\256\230"
+	.ascii	"\325\310\233i\326H\230m\372\352\303%Ls\245\206\214P\345\331\232"
+	.ascii	"dR\270D\243\326z\251\343 \021A24E\177s\024\253\f\373\3070\372"
+	.ascii	"X\317\312\020\273\2225l\3300\336*\310B\303\204\016\rdE\207\332"
+	.ascii	"\034:\320\0239\306\253;\377iL\225X}/\001O\250\321\034r\312\030"
+	.ascii	"dfdfFKT\314\001\200\002\221\2523\017\020Xe\265IZ\003\331\020"
+	.ascii	"\031\260F\373\310\275~g\362V\t\207#\345\013n\271e\267\206[u5"
+	.ascii	"\322\241\355\t\305Po\313\327q=,\225r\317\020\200\035\242\216"
+	.ascii	"{2\265\b3'B\235\026~AJ0&4\247\337\252\007D\360\004\026\314\005"
+	.ascii	"\340\353\206\211\366\022\215*I\272ZcW\257\363\246\325\032\034"
+	.ascii	"^2H(\202\2551k\004J[\317\213\356\"\264_o\242q9y\2530\246Y\242"
+	.ascii	"\023K\023\332D\n8&\220\224\301\024PK\315\177\375\341\340\247"
+	.ascii	"\020\353{\324\243m\357\004<\217\342)"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\337\r\035."
+	.string	"zI\354\01770\350I:\3401g\353\b\215\001m\350~\212\227y"
+	.string	"\025\237F&\201\361\005\235\304\246=F\025\274\353\272\256\013\317\257p\t\276\373\3317\352}:\0367\003-1\222\244\035\357"
+	.string	"\345"
+	.string	"\364"
+	.ascii	"l\226\364\327\230J\372g\314$\257C\362\344\2213:\215<\321)vC\256"
+	.ascii	"\212\364\321L\"\327\325\220\323\261\022\322/c\006\271\037 7\325"
+	.ascii	"\217\3639}|\317\331\243?\206G?\314\216\267\235\274\\.\227:\372"
+	.ascii	"\\\314\034}3\023\307mu\336\350\257\246\215\263\325\370\221F\237"
+	.ascii	"pF\177\213iT\r\311\350\033\3155\306\323\2340\256\346\305\355"
+	.ascii	"\\\\y\266hS5Y\364O\231\254\256\270\205*\256\347LqU\241\370\035"
+	.ascii	"\325h\\O\364M\231&\372h\314\022\377D\342\236F\034PD?\315\fqW"
+	.ascii	"\201x\247\223\325\017\357\363\3207cv\370\035\207O:\021\274\315"
+	.ascii	"\271\341}4\364\311\230\031\316\tC\337L\377\345\302\275X\370\031"
+	.ascii	"z0\025.\207\302\345&|\356K\302\343|-\213\360.\347\275w\250\032"
+	.ascii	"\215j\241{\373^:2\007\240\252\252\n\241/\306\274\367f\345\005"
+	.ascii	"[\254\005i\213\263\330->\373\013\250L\024\347\306m\361\320X\304"
+	.ascii	"\342'\035a\361\210\003P\341\212\314\366)\261\365-\035\373\177"
+	.ascii	"\344\364\003\305\351\013\202\323\037\364\246O\310M\337m\255\177"
+	.ascii	"\250M\037\221Z\277\020\233\276\2425}\244\232\376\2424\375Fh\372"
+	.ascii	"pi}Gg\372\217\314\364!\225\351\307\221\351GB\353K\032\323\007"
+	.ascii	"$\246\177)L\037\023\230~\246\263>\336\227\376\233\227~^\227\276"
+	.ascii	"\036\227\276&\263\376\246\265ogK\237\216\261?\347e}\366j\337"
+	.ascii	"M\367\337h\351\257e\351\303\301\322W\273\322\317c\245_\247J\037"
+	.ascii	"\017\225\376\337\224\376\236"
+	.string	"\224~\033\245\357G\326\347\273\252\252\367z\215\365+\035\312\025|rY\235\367V\201B6vD\314\311]\236\367\002!\0032\204\214\310\030\021(>\304\234<\270_\315\232\274\354d\322\017\307:\rR~r/\345\233JY\310\352\225\274\204r\202\026\023\312]m&\224\013$\277`\016\235z\361P\326j\363P\326Z]]=\224\263\222\277\2303\267SW\023\312\305\266\310\022\333M(\023\217\021P\036&\225(\017W\272\313\t\345\263{(\217\270p(\027\327\037\302\275 p\321x\323\356\024\037\234.\007LL\236o\235\203k\311\001\017[\271\006f\030\003\036\202\2051\261\275y\367\346f'\213\275\013\343\254\366\267\022\037[\250K)\254R\030\017\333\233\211\364\322\336n\035\030\017\331\377\356\315\255\355*\301\270\255p\320\356\332\201\361\327\227\335I`J0.&\351\024p}\311y\261\326*\251\213\007$_ N\245t\345\272\330"
+	.string	"\373K\030\b\b\356\316uq\261\217"
+	.string	"\027\023\031mq1\321\210\305\305o\271x\270F\"\300\217#\300\005\006\254\177[\341\240\362>\332b\255\276\327"
+	.ascii	"\243\233_\027\311Y\307S\027\311\002\326\213\344\242\021\275H"
+	.ascii	"T\027\311&\333\312\227\374]^2C\273})\233\307\266B\302\333\251"
+	.ascii	"="
+	.string	"\200B\366'\205\350\317Q\213\212\375\005\005\001[T\177\354\357\246Fik\327O\321\252L\036Z\257@\017\236J(\t\210\275\0318hg\352\266)\377O{\tj\201g\327/y\363\316\033\2753W\231\362\367\254\177)\037\317^\013\230\362\353\254\236>\245|\266\34310\345^\317\240\220\360\n\373\213D\2333\245\005\225\362\330\372\257.M\330\337;\276\366\312\245\314\344x,?\310\006)'Y\037!n\322\225\224\262\330z^\347\312\334\274\224\213\260\017\300&\022\236\2206H\262\316\213=\217\361{\325\327&`\237\316\251tWTJ\250V\266v\005\323P\351\250t\271\\\276\272\203)g\255?0H\b\357\022\246,\200\275\244R.\262\304R)\023\003\200\365\250q\030%=5\"\"\")H\2224\006\260\002!\"\"u\021\320(H\025\031\021\221H\"\021\021z\350P\333H\001B\254\260\335\315FV\251\310\3041\243\241\n"
+	.string	"Q\306\255Ad\206k\313K\027"
+	.string	"@\270\307\"\236E\3173-N*K\333-\001poX\340\030\231kiP\226\222\255\b\251\"2faR\220\325i\235\205@- [\255\f"
+	.string	"\254\007[\220\020 \3148\372\302\206e\242\002Q\315\272\355\020\334\242\366\260\214\337\327&&\340|S`\246E)4p9\316\322@\177\034\251\271\243e\237\"\331h)\3222\007Z\234oA1\335\224\020\236\306\347\216\263\037V\243s]3]\251\001\t\356\346\205!_\360\203\375\bN\321\321\2627\324m\265)\241u\032\352Y)\374\274\302{b\275vH-~c*-\313G\t\237\032\0333\215=xr\342\277\007j\246\342nE\245\327\353\250t\326\327\244hq&\3120e\037\023\370\310\024\305\252BS\024\253\nMQ\254*4E\261\252\320\024\305\252BS\024\253\nMQ\214Z\020\344e\340"
+	.ascii	"\026\236\n\367J\364)\354,\355!s\307gKaW>\262\343\202\327\240"
+	.ascii	"\r\371\017u\2569x?\247y\030+\366\b\t\343\261\314\272O!Z\370\345"
+	.ascii	"\020\037\262\200\3530\375\272\350\216\314\b8\270\300\334\263"
+	.ascii	"\373\376\031 \016\024m\023\363\265\021G\301\3554;\260\316r\253"
+	.ascii	"gp*\003u\200\240\352\022\357\244\363\306\0265\346\212\232@e,"
+	.ascii	"\030\b\260\327\306/\236CY\376\264T\023\331S\322\347\254b\341"
+	.ascii	"\207B\b\364I\236\r9\335\255\030'\313\r\274p\316\361\272\254\371"
+	.ascii	"\355f\303\233\3017\350j"
+	.text
+	.section	.gnu.lto_.refs.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"(\265/\375`\333\001\215\017"
+	.string	"6(oC\020\2138\351\242\377\313\305o\374\021TTU\n\376\224,\003\200\021!0\002\214F#"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\027V\226b\312)\361\2721~\213\030F\257W\342?\017\340u(haffff\026m\231\002W"
+	.string	"Y"
+	.string	"\\"
+	.ascii	"\232\315\032\356S\354\030\337\203\023\377\361\236\223\351\232"
+	.ascii	"\3301\022\177\211]\313|~c\266'b\347\276\277.\271\345\335Uk\270"
+	.ascii	"\236\341>r\335\343\236\343\272\306\275]gh}\224\3650\037\314\336"
+	.ascii	"\002\353\240\253Sd\337\301~\302\372L{\274zg\275V=f\371*?\373"
+	.ascii	"\361\223B{\331\265\322_\032\325\232|\211\354\230\374.\343\263"
+	.ascii	"\354W~\222\036a\307K\337.\237]"
+	.string	"z^\026U\307P\357\302\256]\374\005\036\240:T\321-@O\361\351\035\317o\262s\326gN\201\035\277\257\276\001\344\247t\372\rb'\211\275\243\363\033\261k\304>\342t\021\347CN\0077=\277\221\352\245T\037U/:=\230\257Y\223h<\204\330G\371>u\352 \247\347@\275i\3441D>\254\036\264\374\006u\310\366\311G7\361|\311\251\243\2747\221>\004\371\356\3435\317[\250\317\323\036\333\\\273\326\307\264ne=\263;\254;\216\276\225\272\305\361\026\320\033\325Z\266T\223%\217\222#i 7\205\235\024\276(\366\317\367\231P\367B\317e<\026[`\333\272\370\004?\311+\002D~=\f\370r\020\371f\300\360\351]\2610A%\302G\357\003\317\327\001\n\203\005\nP\337\004\326\027\201\311\367\200\200\177D\210\017\0356\224\374\032*\372\031V.T(\351K\250\370U@\177\n\351\t\344\207x\357\221\n\025"
+	.string	">D\024:DTP\005"
+	.ascii	"\001y\206\2008\020,\250\230 \004\304\201`[\342\202\020\231q("
+	.ascii	"\301x\306D\t\271\031W\207\n\322\321\016\005g\034\302\024"
+	.text
+	.section	.gnu.lto_.decls.c4ada9fcc3e8c36e,"e",@progbits
+	.ascii	"(\265/\375`\232i%"
+	.string	"\302\001\272\343\n\243R Ja+\215\001?\270\314\225\316\376\375\264H\365S\376\023\037!\321\217\324\326\323\364\277\201\366\371g\037z>\345\373\016\331n^4\004{@}#\335\347\373\276\357\217<\357\362.;<\223\340\305\266?\212\342\264\320D\026\032\345\364\367\3771$\331[J)S\302\b@\n\257\nRX\no\fe\347\276\362\025/y{\357\020\034B\3444?\2573g\376\361\3231\224\2240k\214\02617[0I\307O\270\215\214\r\300\233\257\233\350\333\265<`\300\002\357\340\005\264jW\360\277w\254\231_<\226M\310\334\233k\rL\360\376Y6!\250\345\276\362aAK\027\234\337\336;\204Q\210\020*\031\222?\235\257\255\3645\016}]C_(\250\317>\276\030ZZd{\277|hB<\270\204\005\271\371\332I\372\335#\300\222#Wn\306zu\200\266\304\212\374\250#\347\303\227\206\205\265\233o\343\272"
+	.ascii	"\351 \313\222\274[\246\345+\217\rG^\031\232\326\335r6\004l\357"
+	.ascii	"e\332\216\2745.uB\356\025\262:%o\202y{\357{e\214I\336\032\030"
+	.ascii	"\035y{/\255\233\027\253\274\2757\231;F\b\357\r\025\bV\247\005"
+	.ascii	"/\265*kw\345n\230;\306\316i\345+\203y{\357[\266d\341\277q\327"
+	.ascii	"\356\322\271mn\232;\347\236\271p\256\233Kw\363n\234[w\337\334"
+	.ascii	"\271\213\346\262\271xW\316Us\357\356\032\253v\345n\231_\270k"
+	.ascii	"F\356~\331B\225w\257\310],g\303Z\256\036\260Q\327\344\226\311"
+	.ascii	"]3Kg\347\264\366S\035\016\244\264\r\006\361\333{\251\271\356"
+	.ascii	"\362\234 \345\374\005N_\370\246/\024\243\377\353\326f\345H\r"
+	.ascii	"\305A\222\246\346\346+&\351\327\355GJ\2054'7\367\260i\037[t^"
+	.ascii	"\230E_\b\246/D\242/\364\241/\214\322?\341\350\237j\364\3176\375"
+	.ascii	"sL\377\374\322?\177\350\23774\n\253\341\274\331\247o\252\321"
+	.ascii	"7\323t\t[t\336\264\242oz\351\233X\372&\224\376\362\212\205\231"
+	.ascii	"\\G\276\262\334l\305\b\237\251\332a\345\346g;\372\377\235r\245"
+	.ascii	"\\*V\355V\271Ln\355n\223\033-\367\376\262\367\376\211%VP\250"
+	.ascii	"g\357.8U\256\223\033\245C\324\224\bcr\362\252\334\257\253DHj"
+	.ascii	"\271\261~\252\226wi\374\366^\032\205\b\021\002H\nX\2315\235\357"
+	.ascii	"\223\013f\325\036w\241|9\344s\344\314\030;7?\257\351\333\307"
+	.ascii	"\235\035\260\217;\237\267h\273\255\206\363y\212~v\242/\013zO"
+	.ascii	"\254\r\233\233\237\267\364\263\017\375\337$ \202\360\334E\205"
+	.ascii	"\335\374\337\025\200\322DQ\2739\3517\210\315c\005\261\226+\335"
+	.ascii	"e\013`\236\233\225\263\033\342V\027\304.\317\302\tA]\330R5t\320"
+	.ascii	"\241\312\203\363[;\033\307n\307\205\372\223n\024\036\260\023"
+	.ascii	"~\201`m\334h\201\261\271\003\022g\007\307\177w\\\037\027\353"
+	.ascii	"\036\271<\256\327\035r\211\334\252\313u\201\\#\267\353\376\270"
+	.ascii	"B\256\326U\341\366\270E.\222{u\263\356\326\245\272VV\355\006"
+	.ascii	"\2718~s\\\035\317\313[9\277\265\233S\225\267\3077\005V\307\352"
+	.ascii	"!\311\221g\346\314V\336\035A\260\265\337\332\365\325\rv\360["
+	.ascii	"\2675B\300\344<Y:\274\004\023v\361\312\023\207\206\310\340\237"
+	.ascii	"tw\335\337\211?\351\006\2715\356\024^\202\365\334\360\242\223"
+	.ascii	"\267\367\266n\277A\354\030\013\207\227m\372\006\227\257\274\275"
+	.ascii	"\227v\366\215\245\023z\272\260\243\354\254\300\366^&\375&:\270"
+	.ascii	"A\256\224\245Cac\357\261+[\036\264\270l\311\371\355\275\fa\024"
+	.ascii	"\002F\2367]\034\344;g5\234\033\300\321\377\275\361;Eg\201\275"
+	.ascii	"A(ep\207\336\315\327F\322\357\215\t\300\274\205\271Yh\213\316"
+	.ascii	"c;}\354\246\217\317\364\321\254\206\363XL\037\263\240\017g5\234"
+	.ascii	"\366\317\002Z5\0206\360\026\217\215{\217\324r\237\355\275\034"
+	.ascii	"\352\271\263C\004\355\346c.}\013\342\034\032\034\034\034\264"
+	.ascii	" \316c\037:\333\242\363WP\377\306\321\277m\372w\2136\n\323\277"
+	.ascii	"L4\210\025\364/\021\375\253\202~\333\225\322\237\213\243\357"
+	.ascii	"f\214~\036\231\276`\213\316\373Y\r\347\255\022}\373C\3334V\215"
+	.ascii	"U\223\300\316\335D\007\307OfCA\202b\202\1777\337Z\351[\tN;h%"
+	.ascii	"8\337\001\375\027\332\203\325p>\002\272\204\325p\3327K\306\252"
+	.ascii	"i`\313,\207\356\222@/[n>\003\364\255\006'\036\034\264\032\234"
+	.ascii	"\377@{\020\243\201\226rS\033\013\323f\227\\b\2017\377\226\313"
+	.ascii	"m\333o[\260],\233\345\332[j\357\275\301\326\230S\225\347f\213"
+	.ascii	"f\275X5\016\366\313-\030\273v\023j\271\227{\357!\253\367\025"
+	.ascii	"\205u\363\005\253\341\274\266\350|\0014\320\321\177\fP\273\203"
+	.ascii	"k\315\201\275-\207\323\016\016Z\016\347\345\262\032\316\017\266"
+	.ascii	"\350\264gI\267\\\212\316+\255\345F\333{\017\ta\211qI\273\231"
+	.ascii	"\310n\341 \264\022fk\0053\t\206\226>\252\216\334\214\305\216"
+	.ascii	"\3312<E\305\265\321\366^\022\t\261\220\361B\273\331\226]Kf\227"
+	.ascii	"\267e6\313Mtp \251=\266\367\322\226\345\275\241\254\255@\310"
+	.ascii	"\332\n\314\267&P[\316\374\253\277\264\032Nm\213\316\377dw\t\337"
+	.ascii	"\341\244\317\005=M\213\004\277\0315v\376&\215\037;\345\363k\017"
+	.ascii	"l\221=\374y\202&&\005\356\322\335\035\223\215\376\313\364\f\340"
+	.ascii	"\244\374w\2317\334.X\317K~\340\177\031L\007\243\301r\177\326"
+	.ascii	"\240A\207\020\216\364\233\035\270\375O\n\356\026\217\033\302"
+	.ascii	"/\374&\n9C.\3721\214\037\037\377\214\301H\203L\364g\240?\377"
+	.ascii	"l\231\006\370\355\330\177]d\237\337F\261@\356\371\337\341sg\004"
+	.ascii	"\030\025\222f}\265\002\361\222\237m\312\302\203\370M\r\376\213"
+	.ascii	"\205\235\362\371c+\234\365c\036\1776\361\364\370\001\224\363"
+	.ascii	"\217\205\020\371\357\335]\272\303v-N\026\302W\374\246\335j\235"
+	.ascii	"\254.T\306?\256@\276\032\330\246l\177\234\346\024\374\346\006"
+	.ascii	"$\327\203\037\367\004\376\366\357\277|\030\360\277S\224\374\267"
+	.ascii	"\305\037\356\300\224<?>\261\0251\\\206\347\307fx\311\317R\341"
+	.ascii	"\037]\376\353\200;\277U\302i\027\276\364\205q{\373\357\022\276"
+	.ascii	"3r\213\360\375\327\303o\233\356 \336\013\341\312\337\304\363"
+	.ascii	"[\364\267,~;\001\213\2018\313\367c;\377\245\203\365p\235\337"
+	.ascii	"j\340\267R\277\335\300\177\241\340\2747v\265No\361\f\276\366"
+	.ascii	"\017\277\t\346e0\035\353\341\307s\376\253b9g{\333\227\031\334"
+	.ascii	"\350d\237\340\317nc0\276\304b\312\300)\270Y\272\263:~\034\347"
+	.ascii	"\277E\f\247\3031\374\246\004~\214\201\3772\340\r\335\226k\346"
+	.ascii	"\252\t\304x\377\347p\322\177\262w\370\320oB\371q\006Rp\363c\016"
+	.ascii	"\374\017l\363\277\305\177\337\200~s\311\177\227\356~\253\345"
+	.ascii	"\267e\026\355\267[~\333\006\333\3757\372-\336\211~\323\353\277"
+	.ascii	"\370\277\367\307\026\374\307\377\031\302\217W\3748\204\037\213"
+	.ascii	"\360\343\017~<\302\217\023\200\327\374\330\304\217U\3748\005"
+	.ascii	"\246\373\037\364\237@~k\342\267'~\233\364[\016\376\007\336)<"
+	.ascii	"\367?\355\307,\324\374\217\300\177\r~\234\346~`\217\376g\370"
+	.ascii	"M\341\217\345~l\346\307e~\374\366c\267\037\207\3711\333\217\301"
+	.ascii	"\3748\355\307h?>\373\261\331\217\227?\026\373\261\225\037S\371"
+	.ascii	"\361\223\0377\371\361\222\037'\3711\222\037{\375\330\310\217"
+	.ascii	"\267~L\344\307B~\f\344\307?~\334\343\307<~l\365\343\252"
+	.ascii	"\037\353\3701\216\037\337\370q\215\037G\375\370\351\307\035\370"
+	.ascii	"q\006~<\343\3071~\254\376\030\371\343\343\217\215?~\361c\364"
+	.ascii	"\307\303\037\267\3701\003~\254\200\037\223\360\343\013\376[\366"
+	.ascii	"\343\241\037\007\375\330\347\307\347\217\363\217\357\177\007"
+	.ascii	"\377\013\370\337<\377\355\373\257\336\177\363\376\033\347\277"
+	.ascii	"o\376\353\346\277w\377\305\362_6\377m\362_\272\377\252\371/\334"
+	.ascii	"\177\345\376\033\367_3\377}\373o\230\377\246\375\267\313\177"
+	.string	"\271\374w\313\177\265\374w\354\277a\377\255\362\337)\377\215\362_'\377U\362\337\257\377\"\371o\327\177\267\376+\344\277Z\377\365\361_\036\377\305\372\257\325\177\253\376\253\343\2778\376\033\365_\016\374W\003\377M\341\2773\376\353\364_\345\177\223\377e\372/\214\377\032\377[\374-\230\377\216\360_\027\377\265\300\177+\360\333\365\267\001\370O\366\277\314\177#\360_\007\374\267\305\377\300\3772\340\277\n\370o\t\377%\341\277\b\370\355\321\177C\370\357\007\377\327\376{\200\377V\360_\363\267\202\277m\372\355\235\337\342\375\326\315o\323~\233\345\267U~\273\343\2675\376\263\370\255\323o1\360[\024\277\315\340\267\030\374\017\363\277\355\277\331\177-\377\227\377\221\374\217\373\317appp\360\0172\3417B\361\177p\003}\372\210\311\321\315\2600+(\302\206\312\372\200%\312\0352\277\016r\264\004^G7\253\250\231U\262\235\007Z\\;\213"
+	.ascii	"rtI\3722^\033\032\236\233\337\301\214"
+	.string	">*rts\2129\305\262y\360\265\241\236>\210\351i\211\320N\346\270\205\271\371\035\320t\006_G7\301\324L03\312\220\232\221.8\213\246\357\207\325\315&\024\03765-\254\233\337!\212~\007\026\364\2310\311x\347\336v\311eu\265\265\256@\230\blb:i\222\361\364\323\336O\313me\244&K\013\304Y\245\210\216:7\277\203\227~\007\037\232\004\237\022%\031\317\303\336\333\306\236\261'%O^\004\201\272\304\221\243\233I\276\300\264\321\217\200M\227\030;\272y\004IV3'\205-o_m\021\217\300L?\002)\272\004\330\321M#\\fWF\233\"e-\202-\375\bp\350\022UD\210\230[bQ\314\"V\315\334\022\032{\313\303s\363\3712\332\377\236\341\233\022\277\233\017A\035}\204\344\310\004bM!B,\235\321~\252\363\001K\026\220\217 vIn>\004i\350N\240\255\243\233Z\246\226\025\364"
+	.ascii	"\215\013*\353\003\026\260\301 ?dr\244\306n>\004_tR\221\243\233"
+	.ascii	"=L\025L\037V\320\356\254mq\260\201\022\230\267\257\226\"\016"
+	.ascii	"\301\024}\b\202\350\022yx\360\310x\277\260\367\216\332\273\b"
+	.ascii	"\221s+\013\202\033\372V\035\335\304\302\272|\331\224\332G\232"
+	.ascii	"\200\371\220\225\225\001s\363!x\322\027\310\321M+\323\252F\335"
+	.ascii	"\223\"@x\264\340\301\273\371\034\344\364\003qG7\253\324\314\252"
+	.ascii	"[GGMqAyq@\245\316I\020\237@\2512\261\233\317A\212Nrc\3520ut\200"
+	.ascii	"\007\212C\021}\"9\272Y\303\252\2315L\034\027l\250\325\t\271b"
+	.ascii	"qy+\230S7q\374\246\r"
+	.string	"\363\306\r\003\322K\226\2008n\306tI7\247\264 \231\035,\334\254a[\r\347m\263E\3479\\\351\016v\230\333\334f\224\275\262\203BJ\336]\032\023\352f\324UB\307o\255\352f\363)\267\360\277g\235\243#r\363\371zL\025\314\254\205\271\371\034\240t\b+A\301\254;dag\222(05:D\024 `\006\240\356\220\205!\261C\225\346\346\033\211\351\020B\362\344\371\353\352Q\342\003\016\330\3157\032\242C$9\312}6\373Y\265\354g\341@l\250'\020\177QL\255\036_b7\337\350\206\276\265p'\004f\216\236\371\3242\237\025\314Rf\033\313\347\211\226$}y\007\2362jn\376\006=}A\223\243\347:\267j\271N\266c\237\256\354\336ivK\362\366\326\022\361CgNp\357\346\254\027&k\315\221\233\277\241\215\376\2062\332\203\223\243g:j\231\216m\313Pf\373\251\203\275F\205\260\275\265D"
+	.ascii	"=\331\b\024r\3637\264i\t\306\034=\313\221c\351\362\223\331\266"
+	.ascii	"\362\271a\366\327\346\2677\234\b\334\243M\013\332\315\337pD\037"
+	.ascii	"\3359\262e6\303\371Mt`\3252\034[f\227\333*\003\036\275;d~\373"
+	.ascii	"\nN\304\317\235 rr7\177\303\2246A\347(\337\3456\317n\324\262"
+	.ascii	"\233\214g\367\336{P\314\0352\277\255u\005\342?\237U\313x\277"
+	.ascii	"\211\016>\007h\357\261\275w\007s\315\024'i7\377\2016\375\333"
+	.ascii	"\337\377\334PW{\357,s\271\257\242\200\316\337\336\232\326\202"
+	.ascii	"\370\203,\266\026\374\317\247@\b\313]\243\r\340\336\333\356i"
+	.ascii	")lPB<ls\356j\352\254\353\311\203.,\251\256\037Sg]XDSg]\373I\312"
+	.ascii	"\311\023\321\325\356z\232:\333\233HJ\352i\005\027\326\324\031"
+	.ascii	"\324&\232:\333X\273\306\032,\273\227]O[\212k\023m\251\r\265\317"
+	.ascii	"\270\260<LIuaM\235Aa\021M\235ua\355\263\256}aKA]\341\220\332"
+	.ascii	"WD\373\254\253\316>\343\302\2720u\306\2055u\326\205\306\252\311"
+	.ascii	"a'\257\307\035\340\0220\026\312\224\324\336Q5\004\352\352\302"
+	.ascii	"\334\324\222k\273\331\333\242\331\330W{no\013\366\036\302u\345"
+	.ascii	"\006\352\207m\213\232\333\021\365\005\212\313.\367\336\034\252"
+	.ascii	"\242\274\270\266\324\334\223\335sSS\270\366\236\022\265\264\253"
+	.ascii	"\366\336\233\203\247\345\334f\301\316=\035\031\262\251l\354\r"
+	.ascii	"\301^\356]\265\367\223\335s{\357\247\275\267\360j\310r\357 \027"
+	.ascii	"\246\300\252\252\366\3262\252\332C\236\302\330\330\373\242\275"
+	.ascii	"i\303\232:\363\342J\n\323\302\031\330\276\261|\262ST\\\033l\273"
+	.ascii	"\351\272\322gOZ6\325\336\333\332\321`X<\364n\316l\354\03207\272"
+	.ascii	"\233\377\300\020\235\327\030]&v\376\362\334\374\007\256t\236"
+	.ascii	"\023\332\3258R\345\346?\020"
+	.string	"\2453\232,g\325\376\226\323\354\241\2412|[m7_\303\035=c\357\275\355\337N\341\337\316|F\206\236\2223q\314\220\311e.\030\037vac\310\270\3451@Uf\272\330\231\271\265\3450\367\207\216(Y7_\003\225\266\314\226\327\354\242\332\334\274\304pe\232P\335|\201\313\321\363\227[\265\374%\247y\200\306\265y\240\220\362T\227\306oo-\021B4q6\233\233\257!\210Z\232\226\0212\261\233\263\027\fx\031\033\274\371\032\244r\027 (\037kt7?\303\337Y\346\022DE\354F\216\233\237!\316\331\226L\266\203\t\025%7\377\304\0243yQ\342\300\314 y\003\226\304\315\225\214%/\363X.\313Yr\225\034\226\255d-Y,\233Y\265L\226\251|\345%v\016m\205\0305+\340\201\035\201c\347\025'N\312\331\354\034\232\005\253r&\017L\216,CA\223\227\3112\223\374D\b\316\232\273)!B"
+	.ascii	"\375\235U9\203 ?C\230~\206$\372\031z\350g\220\322/\312\323/\232"
+	.ascii	"\313Nr\0352':n~QZn\022%+\361\t\214\022\243u\363\213V\310,\024"
+	.ascii	"\t\321/\262\241\217a\216>\2062\372\030\314\36418\3512\342c\212"
+	.ascii	"\213\226\233\377l$s\0052\031\274q\363\226\321\020\226<=\276\334"
+	.ascii	"|\fA\364\355^U\376\221\207d 9H\026\222\265r\221\354#\253\220"
+	.ascii	"{X\265L$c=g\3316\277\231H\276\301\226\227\211\344\034Y\307\027"
+	.ascii	"0\034`\300\246\326\342\250\324\300x\300\355\360r\342\252"
+	.string	",\023\311V\226\016\017\352\311\231\260\236\0349\324\340<\220O\004G\013\331\242\363De\364\211\330\364\211\316\364\211\306\364\211\246\350\023-\321Y\307\325'@Z\270\371DH\364\211\204\350\023]\351\023=\351?\333\3105\262\\\031\236\222,\225\243\254Z\256\221\241r\215\274\323\362r\215\374\344%+\t\030\320`\224\261.g\376\0050\372\027\244\350_"
+	.string	"2(x\344\317j\353\346@\fh\325\260 \376{\007x\304\352\f\002\372\t\342<bt\203\200B,n\250(9\363\207\362\364\207\356\364\207\304\370\335\371\341\202e\211]\037\346\303v\360\036\326\263j\370\016\316;\256c\353\334\302\261e\037\314\030I\322\347\027\307\316\313\23429hw0\2352tI\372\204iU\332\030\001\312\246-:?T\246?TE\177\210\005\375\241\037\372CP\372Br\336\254\361\261\361r\346\346\037\343\2651\262\365E\307\315v_\360\032^\266\3515\257*7\330\016\337\341:\314\306\252\3416x\356\230\016\257y^\356-\225\204\333`9\035m0\033F\203\227m\n\250\243\312\303m\260\032\034ymp\032\334e\347\3206TV\t(F\352B"
+	.ascii	"\335\341\261\302\003\312\226\313j83\330\242\363Be\364\205\276"
+	.ascii	"\350\013\231\351\013Q\321q\034N'vy\336n\276\320\226\276~\270"
+	.ascii	"\214\235\373\312\202kg0\234U\303fp\233\031!so(0`?[G\260p\234"
+	.ascii	"\231\214\024\3663\323\246v\363\205j\270\241\201\341\3612\006"
+	.ascii	"\277a1V\r\273\3410\330M\230\244\016\235\"~!\314\276<<ut~\220"
+	.ascii	"\232~\020\025\375\240&\032\f\007\240\270\273\264}\363\203\200"
+	.ascii	"\350\007\331PK{\013\204\023s\263\027\214f\325p\032\356r\375\360"
+	.ascii	"\231\235\373Z\221\0070o\357\235\2067nA\310\334\273\353\017l\357"
+	.ascii	"\315!D\b\037=%A\316| =\375c.\307-\334\262Y\256\r?<\346\360\200"
+	.ascii	"\334l\"\351\230\313\0316\306\b\236\233\267\030\005%\341\242\262"
+	.ascii	"u\363\201\316\320\0013\303K\253\206\265\340\2623-\367\317\262"
+	.ascii	"\331\271\257\235\253\350\352\322\204a<gryg>\220\027\031\026!"
+	.ascii	"\036R\360p\334\374\023bhIXp\230\245\023\300\325`\220\2601\234"
+	.ascii	"\305\252a,\370\312\322H;\251\202\246\357\314\007\372\241\017"
+	.ascii	"TC\377\207\317\312\223\353w\246K\334\315Y\266,\t\213l/\354n\021"
+	.ascii	"\342\007\026W\304\322\t\341\275\213\310\001\033\013\362\004k"
+	.ascii	"\354\n\n\331\236\337\340\017\002\\\001L\352a\341\004\301\242"
+	.ascii	"\340\025p\025\314\004;\301`X\t\206\202Y\300I\260\024L\005/\301"
+	.ascii	"_x\nnb\325\360\023\354u|\004#y>\241\202\205\023\262\325!\333"
+	.ascii	"\363\303O\360\026\356\322\262\306\343\211l\317o\210\245kR\207"
+	.ascii	"l\317/\311\207\007c\201yr\264l\031\035(d{aD\260\034:\262\275"
+	.ascii	"\260'\030\210-\023zZn+\341\023#d{~\370\t\306\262pv\356kC=\241"
+	.ascii	"\200b\204l\317o\357\245N#\265\302\031\013\262\235\263\032\316"
+	.ascii	"\016\266\350\374\017\030l\304\326\365\345\301q\363\177\3104\346"
+	.ascii	"z6\343\n\302P>\344\330n\376\217\024\375\237,\375\037(}\037<\372"
+	.ascii	">w\372>o\372>\\\364}\252\350\373(\321\367\351\241\337\003\250"
+	.ascii	"\337\323F\277gM\277\247L\277\307\211~\217\226\225\216+k\256D"
+	.ascii	"\271\371\035L\331\275\271a\007\007\353\3008\344\260\222\364\371"
+	.ascii	"\341*\274\003SY5\254\003\347\370\265c\367n\227!B\2040\372\261"
+	.ascii	"\022$\312\223\316\327q\3645\031}\275E_C\321?\266\201\245~\322"
+	.ascii	"\300\354\254\335|\375\256\240\020\324\205\275\235\260\341\032"
+	.ascii	"8\312\252\341\203\203g\0266]\204uf\236\2641\177VkN/&k\334t\t"
+	.ascii	"\351L\034lVP\001j\356\034C\345\005\007\357\346\245\020\030\261"
+	.ascii	"5z7o \025\027'\2243\342z\252\303\201\234\333\037\231\"h\356\332"
+	.ascii	"\240\271P.\253\371)R\347d,\356\177\317\206\301%7n>\211;-\242"
+	.ascii	"\216\0313'\214\244\231\273\343w\363I\304i$\2562e\314-\2733m\342"
+	.ascii	"\304\312\334|\022U\364\b<oo\346V\334\334\032\025\374\212\250"
+	.ascii	"q\233r\363I,\321#\344\270\271\301U\335\t\372E\031\343&\344\346"
+	.ascii	"\223\360\241G\334\205\t\363\005&\264g\006\005\312\315G\022\324"
+	.ascii	"#\324\260\261\235b\252\356\004\375\206\210\360\020\303\345\346"
+	.ascii	"#\275\321#\334\276|\021\2021\342z\322\003\241\006J\222>\277\036"
+	.ascii	"2i\250X\020\202\021\222\371\b\001\373\202\345\346#\211\321#\226"
+	.ascii	"iin\300\362Z\231\330\220\233\217\204E\217x\322B\013B\264,W\203"
+	.ascii	"A.U\224]\\\227\013\321\202l|9\203\222\341\264|!!\321#\272\234"
+	.ascii	"\235a%\351\2033\304\311\315G\352\241G\f13\313x~Ty\322\204\265"
+	.ascii	"\360G\246\312\315G\272\241G\350\300\202E\270\324\222\244/L\210"
+	.ascii	"\t\027/\200e\027.s\226\2657Td\377{\264\031\016)\2027\013\263"
+	.ascii	"\f\266\251+\273\371#\372\264plD\032=BJLlX'I_\030f\2632F\315\315"
+	.ascii	"\037\341Eo\020h\305J\306\003\003\206\307\370\325@s\363GD\321"
+	.ascii	"\033\264\021B\021B\021R1\342z\352\023\026\251z3Fge\331Y\302)"
+	.ascii	"\027R\361\331\361G\205\313\315\347\023Jy+\253\023J\021F9\265"
+	.ascii	"\210UA\273Y\030%c\371\220-y\002%Po\020\367\344\311\371g\304\365"
+	.ascii	"\304w\236\251\272\023\364\273q;\330\302\254\351\r\2704i\"\\b"
+	.ascii	"/,\243\352\250\300\362\0352Jzd\321\033<a\201\005\341\022#.\\"
+	.ascii	"\327\365\327\006'd#\002V\245\344\302%pW\311\033\333\\\006\202"
+	.ascii	"\323\245c\315\315\337`\211\336\340+I\222\214\227$\346n\312\031"
+	.ascii	"fH\327\327\315\337\300Jo`D\210D\210$\343A\335M\t\303Y\244\312"
+	.ascii	"|\271\371\"\376\364\006A\274\2742\236\021\327S\237\017X\025\031"
+	.ascii	" .\373\253+r\363Et\321H9\214\0309\007\001\253\260L\361\013R\223"
+	.ascii	"\305\206\325\245E\274\331\332\n\300\023\331^\330\2308+Y7_\304"
+	.ascii	"\016-\242\216\b\021\265\352\311\2200\255\346L\3402P\213@#D\b"
+	.ascii	"\007\255\252*}>Z\250\354\234\254i\021m@\200\234Ua\310\366\272"
+	.ascii	"\2341I\273\371!\314\364\b/\341\017\341\217:P\222\364\371Y-_t"
+	.ascii	"\326n~\210%Z\204\227\036=\366\252\236\f\361\323\"G\267o~\210"
+	.ascii	"\""
+	.string	"Z\204\024!\226\020K\310\303\210\353\251\316\007)O]pBlbgl7\377\302\254\013yX6\260;\036F\216\002\265\b&B+\241U\003\252\236\fyK\253\301\346\346\037\275i\021B\204U\302\252\263\357\004\035\331\t\306J\034+7\377\250\005\215\264&\324!\324\221\361\350\310\366\302\206\310\306\210\331i\242\221\356p\340x\002v*\211Zz\335\374\243!\032I\216\360\206\360F\306k\002\226\251\3001\233\273\371G94\322^\215\032\031\317(\257*I\024\277\333\202^\334\227\031M\202GT\224\205\253\362\322\023z\001\312E\335|\020[\232\304\r\341\223\360\351\374;\001\245.M\331\017&F\0025\211\255\300\300s\320\232m\253$\275\277\2660|\005\307\335\326)\370s0\210\217\313\034\231\340\377\2363\215\025`\236\233\257\001\237F\372\313\223\347\374\313@\245\016\331\236\356r\205\345\312_\017\024)^Tq\232\004\025?\277,"
+	.ascii	";N\202d,m\252\330\272h$({{g\337\261\324.\"\b6dd\273\341\341\263"
+	.ascii	"jg\037\0261\313\0377\237\317\322y\365\305a\273\371"
+	.string	"\032<\321Hoyy\247\036\207>\252<in\020;i\224\324\371\251\347#h\243\216\232\230\377=%\336,qr\245\221\314\346\3149\361R\240\352\323\212\033#s\3635\300\241C\250\301\201s\306\261f\333\252\203'\262\275\260\037\035g\252\200\211\223\321r\0342\203\200w\264\b+7nN<#\256\247: \372\250\372\366|\250\336\306$\301\263\202o\254\314=q\323!\322\324\325\235wP\006\001\303r\027%h_v?\357\200\334d\201!\302\246\356J\016\220\315yF\t\237\025X\232\016Q\206\356']\306\263f\333\212E\230A\300\260\275\265@"
+	.string	"\375\260\241\245\b\231\016A\207\f\231S\215\221X\336`\220 +(4ui~\252\221\322&K\333\315\247\231Sn\250\211\2231L\344\320\270\351\261\303\311\315g\234\321\br\262\224\271\371\031@\321\347\231[\346L\0238;7\237\357\204\373\337#\004bu'u\302\235e\322<\311\255\341p\275,\251\342\272\371\031xi\021~G\377O7\267s\2145\333V>V\\w N#Q\340 \271J\2300y\272\371\031\370\320G:\216~\266\235mg\230,\265\334XAQ\250\350\354yy\273#\346\3463\f\006q\364Q\330\321\317\2655[\226\261\210\021:3$\016\336\315\307`N\037\275A\362\363\211u;\301\254\332\211\344\374\222\024\265\241\260\020 \013T\020 \222*t7\253-\251\232\350"
+	.string	"\274\371\030\270\351\237\250r\206\331\271/\017\252\340\345M9\243\214\301\201rJ\211\223\307\345D;\275\234-\234iV\355\354r\212\335\272\235`7Z;\273\234T\336\344u9\257\234fvN\353\302\226Z\363\313\333{\007\031\271\341e\013(C\271\234\016QS\"\220\315\311;\315N,\247\226\016QS\033\252K"
+	.ascii	"i\250\340\214\371\235[\3163\253v\232\241q\b\372\303\363#;\363"
+	.ascii	"\177j9\227m9\204\334\270\371,\263gq:\216\334|\f\272\364\177f"
+	.ascii	"\261j'Y\224@'7\237c\227\203\343)\207\216\233\317\367\267\377"
+	.ascii	"=\271G\030,r7\037\203-}\f\200\350c@\245O+\332.\217H\232\233\217"
+	.ascii	"\201\r}\f\240\364?\004\352\177\340\323\377)\345\214rvf/M\224"
+	.ascii	":9\252\250\233\377\241\216\276\333j8O&\247\223\241+m+\250\335"
+	.ascii	"\374\263\311\377\036\005(Q\243vs^r\343\236\200U\335\374S\211"
+	.ascii	"\220\033'^\264\334\374\223\005\265\301= 7\237_\332\306\207:\r"
+	.ascii	"|\210\254m\tI\362\363\353?\263,^\n\203\201wn>WH\372\231$\r\231"
+	.ascii	"\274\262\233\201l\321\371\017Z\364Q\336\221\025\263'\326\317"
+	.ascii	"\256\023\353\364\002\241\005\245\002\210,]CD\344\034o\240\216"
+	.ascii	"\270\201m]\335|\0269\271N#\177O\217\033U\335\220\233\377AL\377"
+	.ascii	"\334\372\337\343\363\265\246\t\225\233\257\375\333y\016\371I"
+	.ascii	"\344\357\021\216]Iy\271\371\037\246\350\237AN!\177\017\016D\343"
+	.ascii	"\206\343\346\177`\242\337\323\0018F\304n>\265\264\215\017D4\350"
+	.ascii	"yc&g\311\315\377\311\343\247\326\317\037\227J\210\026\235\233"
+	.ascii	"\317\036\247\217\237?N\025\366\371\203\003\256\275\241\316\037"
+	.ascii	"C\200{C\rY[\201\265\025\344+^O\322\316\374\017Z\372\314J\372"
+	.ascii	"\311\343>A\213\213\2739\310\026\235\277\200\216&\021\347\264"
+	.ascii	":\2552^\337i\306l\b\210\323\257\215\216\357\346_\020\247K\310"
+	.ascii	"9\251\316\035'\325Yu{\005\005\344\244\"\006P\212\022'|?\253\350"
+	.ascii	"~\360\260\302\262\334\374\013\270h\f\262\034\375\234:\247\316"
+	.ascii	"\034Y\312l?\t\201\321\273\233\242\241\306Zx\272\371\304q\203"
+	.ascii	"\311\225\215\233\177\201\024\375\013\206h\243\033G?m\2346\262"
+	.ascii	"\021\017\264\314v\326\320\2225O\316\004-\273\006\363\334\374"
+	.ascii	"\013\2404\006\265\243\237R\247\324\003\250\254\\\t\333\033N\204"
+	.ascii	"\020\220)S\306n\276\005v\332\204\327\221-\263\347\323\te\313"
+	.ascii	"<<-\267\225\005\222u\207,\254\214\276\005]\264\211'G7\005\003"
+	.ascii	"\315\301\n\200tY0E\337\202-m\202\n\360\200\346\226\336\034~\350"
+	.ascii	"\365\350r\247u\363-\350\241\217\312\034\335\364\3633\363\350"
+	.ascii	"\032{w\021A\221\005\n\277}\001r\306\304\323\023\326\204G\222"
+	.ascii	"\233_A\036\375\n\316h\020ZG7\367\366\314>\024X\214\f\002\002"
+	.ascii	"\345\221\031\362\305\344\373\211\273;\242\344\346W\360E\277\002"
+	.ascii	"1\235\024\246\247gn\375eU`Dw\020sts\316\255\2329\307\314\363"
+	.ascii	"@\213k\363\330\300L\230$}XsJ\300L:~F\212\214\271\371\025\354"
+	.ascii	"\320\367\320\247\217~\034\335\214\023\307\314\\\001\211\224\273"
+	.ascii	"\233\357a\216\236\200\354\350\346\2337\026.C\231\355+\237&P\227"
+	.ascii	"\312\2253&7\337C\032\035A\233\243\233n\334\\>\017\276\270\240"
+	.ascii	"\272<\224\201bbA\343W\345\346{\030\243M\214\271\373]\306\323"
+	.ascii	"\233\003\2175\1777\360\020\271\371\036Z\320'n\034\335\254\373"
+	.ascii	"Mt`:1\331\330\262\274\265\366\223\236\0075Q<x\351S \250O\250"
+	.ascii	"@w\272\214\247w\034TV\303\363Z\302\247\217\312\216n\252Qc\313"
+	.ascii	"\214\366S\235\022X\326P\360\2463\235\243\233rr\026\316\203/."
+	.ascii	"(\250\017qv\376\310\230uy\"\344\346S\020DO\300wt3.\316\322y\240"
+	.ascii	"\305\365\244\347\001J\327_\233\331\325wG\354\346S`U\3064S\346"
+	.ascii	"D\0208\323\f\\\306\323OFnfBN\350||\271\371\024H\351O\240\247"
+	.ascii	"Op\271\271\231o\031\3124\324\0335-\037?\2549;7\307\3302\334G"
+	.ascii	"\246\b\340\315\237\200\215>\301\344\313\277\230a\364\316\242"
+	.ascii	"w\223,\351S\323v3\314\320\215\276\253\265\233\317g\262\375\357"
+	.ascii	"\261P\\v\344\231&\t]\314\330\001\003D\005gM\236\233\301\340."
+	.ascii	"\377O\205\007\032\033K\035B\312\321M/^\314\264s\323\230B\005"
+	.ascii	"H\336\276\242\0231'\364s\203\315K\355\346O\360\245C\224\035\335"
+	.ascii	"\354\322\305\322\341\275\213|\235n]\023\364\320@<\216nr\341\222"
+	.ascii	"\353<\320\342\202\202*!\266\034\f\262\345\362\370\270\371\023"
+	.ascii	"Hi\feG7\267\334\252\231[2\235\007h\\;\213\003(td{l\\\206\270"
+	.ascii	"\335|\t\364\310\314%\231\251\305\324Bb\254\314\\\226\231[g\234"
+	.ascii	"\230;da[K\013\304\320\227/[\316n\276\004k\364%P\273"
+	.string	"b\216]\271\203\305\034\303\362'\306\332aa\220\355\346KpD\277C@_BJ\231\214+\td\222\211)Il\321\304D\354Q\242\220l\301dl\001C\211\266XS\245\013  S\3148\341\303\b,X\234\240\034!\203\022\322\250&W#2Y\302\252\242+\213\242\rI\225F\bjRU?(\032\233\036\320\220\246P\032\207R\"2=\032Y\004\245C\026\027\224\033\224i1YB\006\345\003_BB\225+2eZ\225N\027(\246\310\360%\244\364\005\252<\032\321\027\310\364\002\bE\242b\252\242K,\324\b`\020\323%\025_B\0326)\231H4)\231V5iB\272\242\304\344\361\230\202E\223\222\351\201/!\245/\204\251\352\264\242j\332\304\224\266(\242\351\tI\225\206R\221\362\302\227\220\212\307\344\322\021-\036\223\"\254G\240\3421)\202\252\034AM\202\240TB\032\225((\215\017(\2153R\310@!"
+	.ascii	"tt\"\036Q\242\207/!\021\325\007.\244J4=\246'\250\312\021\224"
+	.ascii	"\351\221HCE\312\"\251\322P2\272\220\036]\240J\343\n\242/!\251"
+	.ascii	"\311\025%\032\213H\243\322iEW%\211\244\321"
+	.string	"\303\222\022=\202PLIPB\032\221**c\350KH\250\013\364"
+	.string	"J#\007d\322\2504V D&\223*\215\020\224F\0164^\030\327\244\002\212\310\0241Pe\221\262)M\017\300\244n\370\022\022\211\244\321\305\2514\036\217F\246\363KHJ\022J5\215aT\213I\225hd:\323\243\013\264\305\f#\223V\246\253Q\225\361\2636\005)\2231\324TI\"\035\246D\325)\311bujB\032\203d\244\n@Wt\305\003NP\032\177\326/!59%U\245!\252\242M$\210H'\020~\220/\256\251\034*5\001\255C\244R\223\211Tj\302i\nFeV*S\265XD\205\352\332\204\037DC]\225F\245\364\204a\005\305TXL\225NY)<\272\242\305\241R\023\222\220\212.\021\3630]\321c\023S\332B\251\t\304jD\216P\204\224\221\\\241\324\260>\240\202\303\227\220\214G\"\t\342\213\fi1Y\202\361H\024\006q\200\204\\\300\001\212)\223\212\016a\350"
+	.string	"\251\250\034!-&\231T#\232a\306\t=+\005+\206\r\353\006&\341P\021\21121%U\020\325\236\3421)\202\022ZB\220\005"
+	.ascii	"@*\246kzlbJ\252H\361a\205\f&]L\225\306#j\\\215\310\021\224\250"
+	.ascii	"\003\220I\n\276\204\244\246G\247b\272DT\026\321$\tF+\272*}|\224"
+	.ascii	"+> \201H\t\2514\006\305@Y\024\221)h\034\233\232\320\013\224\251"
+	.ascii	"\013'\026-\220N\352\006\244\214dqE:%U\024\215M\030.\020\r!\215"
+	.ascii	"h\t0\224\350\372@\006Fe\322\004\030D\343\312\002\231T\221\036"
+	.ascii	"\213Hti\304\232B\027\025\217"
+	.string	"I\021\322b\262\2044UA(\242\351\322\205u\250T\323\243\323\007\032VT\233%\220V\025mBbRS\310`\002*\"S\030i(A\243\210\246'\240+\272\002(\tI\211\202P\221\t$%\nk\2125U\246'\314@\2314\320 \"\323\025%!\331\"\251\322\baCzt\201\"?\300\2202\031\327\246d\222\204\242\321\2045UR\321\225h\303\t\244\224\311\330B\351\2244\306H\325&\016(\250\3115Y\002\006\363KH\034\322b\262\004%'\027i\261\307\204\025\231\252\252\023\221HM\2170\224h\013\027N\312\f\312\242\232$\246'\0041%U\023>\370 \271\2461P\026\026\244\310\344\n\325I\211\246%`\220\3060\256\304\016)\224\220\304\f0\224h\t\310\244\221\250fX\207\320\025]AT\317/!\021\207)\223qE:\251\024\374\024S&5\005\221\230\"\202\023\221#Lp\242QM\221\251\222>\007"
+	.string	"\030\001"
+	.string	"\0243\204G1\200\022\003(q\036\305"
+	.string	"\222\222\006"
+	.string	"\200$}"
+	.string	"$\341u]\327!\272\036\323\025)\223q\375I\207\305\021`(\321\026/\210>\3510]\321\225\205\361ht\201\256,\212\306\246\r\351P\251\204\036AH\213\311\022\210\322aS\232\272"
+	.ascii	"bJW%\r\026\020\254\353P\211B\312d\\uZ\001\321\212^H\213N\253"
+	.ascii	"Q\t\231$a\206\021\204\244\002\224MJD\027\326\"\021V5\331\244"
+	.ascii	"\034J\207 \024\325dR\205\262)\004\r+\312\244&_\f\323\025E\032"
+	.ascii	"\213j2IL\207\253\021\211\302\317jD:\371 \223F\245\221\230\252"
+	.ascii	"MJ\364E\214!\r\030J\365E\021\351\224d\301\244\242\307\024\353"
+	.ascii	"\232\\z\200\206\272\246L\3511m\241L\321\200\242\261)C\252\204"
+	.ascii	"\256\307d\214\341\361\230\022\207\253\232lJ\325\242u\230\256"
+	.ascii	"\250J\202\370!m\242\321\242']\321\023\212\210\252\020E\272\242"
+	.ascii	"'\020U!\212\242\261\004ui\025\252K\253V\246+\252\232+F0A]j\201"
+	.ascii	"\244Q\354A\221l\232\361\201\f\024\002D\325\007\006\232\252.\206"
+	.ascii	"h\323*\364%#\025\020\244G%$:D&\215+1U\325$q\270r\370\022\022"
+	.ascii	"\211\240t\206\221\251G\251&\327$S\221R\005Q\305\240e\2404\200"
+	.ascii	"\212H\324E\021M\213D\251\322\252D_\f\213\307\344\322p=\242\031"
+	.ascii	"\212\251RMc\244\352P\006J#\203\006\"\021\365!\022\321\236TEe"
+	.ascii	"\024UtiH$\242@\353:|\221\0269|\tI\002e\004NC%\321\310\204\"i"
+	.ascii	"\254\320\220T\323\b\020\211\250pU\3235eJbpz\221\026\207\353\206"
+	.ascii	"/!!\223F\324\002\345P\311dT[,\021W\243\tEd\212\3431\251\026\025"
+	.ascii	"\215M?JeJL\252M\303\242\261\211HU\032\207H\343\260hl\032\372"
+	.ascii	"\022RR\245\241DB\tAR\245\241\004\224\016\325\244\022\231*\205"
+	.ascii	"\220J\306#\352\243\2720\036Q\025+2eJc$K\360\300\224D\246\305"
+	.ascii	"!\021IC\371\242\351\250\323&\032+\206\013\351\212\026\233\234"
+	.ascii	"\206\252\3228\224\302\022\f\023'\206\251\322)U:\r\223\353OR\222"
+	.ascii	"\211a\nK\031L\f\327\027I\245\221\020\006.\244\2604D\032\231\220"
+	.ascii	"4\212_BR\036\223\352\212L\022\207D\225\004\261\203\022\322\310"
+	.ascii	"\244\242BL*:\\\225\252\361\305\020\231\034\036Q\3420\251\322"
+	.ascii	"P\322\260D\\\2152\224\303\343\321\b\003\003\r\364"
+	.string	"\230\026\207L*\2524\026\207\311\325\t%\222\201\252\370KHNL\306\3431\251\346%\342jl2e\2404\2602u:\2421\316/!\025\215M$\326%%\343\361\205\221rhB\321\330\004\204\302\204\213b\204\213b\305M\233h\254\303\027D@),\r_4\035\2072P\032>),\t\021\207K\3045\211\034bX\221)QMMX\221\306\244\tMNE\244\321\001\033~d\240\020`rbQ46\t\245J\250\232\306@\207Jd\332\304\224TQ4\232\260\242.b\024!\215%\254)\212\306\246\013C4Vc\f\343jT\"S\026\3074Fz\274p\\\327\244\272\324\342\001\244\021\rAM\256\250\2322\251\351j\314\2204\256\350\t3\320cz\202\022\303\272\244dL\035\260\"\215\311\2465e\301\244\246k\261\350\004\031(\r\242\325\310d$\341\230\022\211)\322\025U\205\326/!\221(\036\215N.\"X\207\034"
+	.string	"\340\210\256\311\325G9L]$U\023\314u\230\036\215/\222j\223\220\022\006\321\330b\006\312\244\277\2044C%1C-z\262)UI\254\311\244J\342G9T2\276@&U\314P}\232P&\242j\252i\321\030#\2516\rg\250G\324\250\246J\"d\322\250T:\271P\n\315H\217MN+^\034\321%\237c\222\230\\\223j\323\320:4q\242h\354Y\221NI\342\360\205:46)\2073\324\rDk\252L\325\344\352\204\016\213H\243\213\341\212*\207LN\352\n#mRF"
+	.string	"\224\036Q\242\322gU\323\030H\343\320\250T\252?D\265hd2\221F&\r\203\230.\021g\240LzH\251\342\210\306@&\215+zL6\251\351\212\034\201\250nH\233h\264P\323\365h\004AC\n\"\274x\221\\\235T(!\215Kk2\311\304\202\250\026)\323TUJW\244G%d\n&TE\214\246\027\030\326!\212\025it\022\036S$\022]\"\016g8\241\303\031(\323P\361\230\\R\246\352R\213tEc\030Wb\212\264\230,A5\242FH\243\223&\246J\247\341\f\224i8C\375Y\207"
+	.string	"HZ\221F\341K"
+	.string	"\200\003\016\210'\004 "
+	.string	"\244\242\013@"
+	.ascii	"*<\240\240\200\0204\021)U\223\304!\361\005\t\342\013\022H#\312"
+	.ascii	"D\202\250*I m8&\223\007\030\232\377\265\021\315\345\205\005/"
+	.ascii	"!CK\252\260U\335|\342/\210\336\n\242\213\034C\020\017rtI\372"
+	.ascii	"t\021M\304\210\035A0D\364\020\275\256\271\277\314&\250F\032\025"
+	.ascii	"$Z\b\316!\214b\007N\357\346\227`\242\177\r\344\255'\215\315\234"
+	.ascii	"2-S\213\376a\246\341@3\350C(\227\271\024\3112\247GVc\237\356"
+	.ascii	"\316\226\250\220\321\320\230\001\222\341\021\307\315\0211\035"
+	.ascii	"7w\020F\357\320Yz\207\306\032\021dG\327\230\253k\254\2417I\336"
+	.ascii	"\316\334\254\255\360\032\301&wJL\215\275\355\270y)\354\252\322"
+	.ascii	"\225\245\243\356\304\341\003\0200G\246;\0236\206O\3438\357\270"
+	.ascii	"\334z\220\335\234A\313\312\216\033g\237\337\031;\034\332\206"
+	.ascii	"\220\307\317\020\266':t\215\263\352\307\311RL\r-eF\255\351\230"
+	.ascii	"\302\242\243N5o\362\020\311q3\007z\302A\r%\034\324O\366\352\312"
+	.ascii	"\203\225\274\2734~[K\005\020\277\336\327O\202*dQ\222G\342\216"
+	.ascii	"\376\205\202g\0167<\276\344\b4\373\326\352\342\314\001\\\"\344"
+	.ascii	"\203\310\\\217?*B\2651s\336\362\b\227z\311\n_B\360\234xC8\212"
+	.ascii	"\314\371\363C\3531S%o\355\336\021\202\331t\310\262\372"
+	.string	"\314-A=.a\226m\177;\274\334,tVar#\214\320\216\231\267\246H\2359=$P\326\260\3241\243\204\360[\301,\317\302\375\250\361\247v\363\362\247\255\210\027\025\204s\262\235,\2747=n^\216YY-\341\212cg\243\t\03378z>-X\201\203\366\306\nj/s\346t\340\375\035@\217\n\211\320\3159\350\206\013\t\325\315\267j\3026\031/{\001\362\345u\263\220\215\320\356\302\273\013\357\256\360\016\007\207\177\2503\302\223jL(\305 \020T\214!cjf6\311pc\025@0h8 \023\213\346\335=\023@\204\013l\205q\236\346\030cffDD\024\024\024$\005Is\326\351\252\313\340`\262[\220s\243d\370%\tA\360\r+\262sh&%\t\222m\361\235\316*\0303\\\371m\016\317\327+{\206\205\357\004\245\253X*p\203D'y\224\212FI\313\276\237\374[K\212\322\305\205U\267"
+	.string	"4HvU\023\\M\360VV\275\306\251\031\034ZCho.\372\270\272I\323\303A\033{\007\2343\311\033d\354uG5M\200D\"MXE<\037U\341\035\b|\205\220\300\362P\344\246?\177\365\315\277\325\234\002y\211\325^5\247:\345\372\354M&;\266\032u#\\\344\006\030\332I\025\230zE\024\036\032\326J\273"
+	.string	"O\374GI\242\0039\r`\233E\262qx\343O\276\300\31582\336\356\207\352\177\243\244s\315lq\257W`\2321\302|\336\261\226o\257\337L\264\370\323*\366\213\314\217(\260\313\265\r\317N\020W\025\032\004~\265\3718\322\275\323\372\211\b\267\2051\347A\334v\343ik\270\016q\240\245X\037\202\332\240EUm\203M\241J\241\240\233\303Z\351-4o\360d\203yw\374\372j"
+	.string	"_O\360\203\027vI\310\202\024\2045\372\202$M\204\036\013#`\370i\305\0260\363\320`~\237\310s\240\200\266\247\rirP[\0327\252\227\203\033Ri\312\362\211@\235/\370\213gf`\241Bd\017 1\246\nC\374\r\251\301\3050\243\302\370\262\356\214A\322\300+\rLu\201\364\245h\204|\246Y\344=\024}\364X\350se\214x8\306\233\370c\353\327\246\260u\327\f\371[(\267(`\031;\254d\245W\227\260\337e(3\310z2$\355\226N\202\t\240\031\231D\340\"Qr\037M\343s\371>U\302\202\222!\\\005\307\376\004\235\223\204|\370\361"
+	.string	"k\021L\242\b\352@;c\263\312f\361\376\0130\200\3475\033b:\302\213\232E\262\036^Z\\\272\365\3063\021\345\272\350l4\367+m\341/F\275P\033\233\323\022\344\205\331\\\235U\\\327I\355\201\205\035\020\315\001L\020\243\034\033Q+\200/\002\276\344\021\343\211v7\312\222\204\377J2\016@\356]\020\r\347\347b\307\255\345?\236kF\221\367p\210;HIt\013\203\264s\323.\034h*$\212\030\303p\2013B\342\005\006;\253\273\374\024\217\315\211[\304:a^\3251-\3244?\347a\316b\376\233\324\212\007\210\022\013#\261E\336\266(\003\\N\205\203\377\342G\203\351L*\373\202^\362\032\230\250\203\216[\354\021d\266\261x\334d-D)R)\331\334@\217\252\370\275U\252G\234Tl\b\357D\215c\"\277\3211m\304\034\243\32312\006:fkc\265\244\260\2657\20520\216\023\237\001\374"
+	.string	"\322O<\342\371\277\275\026~\003\247/;h\254\323\277g\321\001-.\002\322\005S\214\256\315&\326\242VC\257\227\b\271\254mX\344\345a\247\"\316\266\345\317?R\026\314\314\022\031e\245\026sR\364\261\356R@\277\346\233\337h`@\372/\3000\313\024q\324\314$\224\223<\025\343"
+	.ascii	"\320\242G\005\214bq\262\004\365\201{\r\321\3101\353\305"
+	.string	"~\330\3676]\351\2619W1\376\315\355\277TE\351a\212\346\223Wn\274\230\202\372\325q\036\020\335\242\301h\240'\323+\022\337\\\333\365KE\003\215\321\240n\375\335\r+\035\003=\300S\301\r\"\214{Qq\002`K\366\3521$\352\310904\263\351\301Fl\224\230K\210\340\225[\256\215\200W\306\346b\005c\261\257\354\r!\032b\002\201\321?\365\237t6pb\221R\232a\241\221@\203'=R\342\021\265\260\372\013=)N,\360\255\024Zj\257\200\360\237\035\356\324\020xe\261\006\301L*\333D\005\016\375,9<t\363\316\026&\251g\234\261\376\036\230\034Xd\264;u\305{r\202#\352e\220\225X\317(\367\304t`\315w*k\273\216\272K\367\007T\347\004[\021z\366\257\023\324\021\007\214y%\264\274\277F\035,\210&d\371\322\271\343\013R\345\351\337`\372\343\314\2420\260\340!@\244\330\265"
+	.string	"\001z\300H\343G\370\3779\250\261\334O\230gR\356\001L\021\352\230\211)\by_-\312@\217\267E\373#I\372\3048\364\325\033\024\220,\263\327\177\304\301P\324\363a\223\216\006\352\345\200\0237\255B\346\354\001\b\356\235\034!S/H\346"
+	.string	"\234.\340\344\272\321M\344\377M{2\273\252\03358\302\365\331\221\236]&IL\230\227\302\262B7\213\252\233\360\344$9\223b\321\344q\366\316\230@\232"
+	.string	"\325\236*\275401yi\315u\250\243\035\370\331c=\034\273\31448\361p\254\034\276\315\313C\254I"
+	.string	"\260<6\036\363\2013\026\020X\325\330\335l\264\356\257\313\252\363\006F3L\201CHI\223\240\240\360\205\263\003M.\306!%\322Q\373C\n\260\301\266^\002\347\260\025\035\fM\277\217\323I\201\227#f\357\353\266O\210 \030\022\022\304\336!t\357\007_\3460^\216R\235\320\2063A\340\316\314\302\274\211{\346c\363Q\022\275<\002y\024\204?_\022\253\335|x\366\357\305\2735>\215\200\006]{OQ\222\177\330p\215\006\327\263t\225\245\020\nU\253>)N\224\244am\r\333\352\005m\253\315a\242\270\016\200\304\254\302-"
+	.string	"\322\263\n;"
+	.string	"\004B\214\377"
+	.ascii	"\177c\341\246X\340\257\026\247RzO\332]\352ho\026S^XHBC\"\203"
+	.ascii	"\032\352\263\355\337\365\213>\2545.\211\271y\203K\324\347\021"
+	.ascii	"|\314\316\244\314D$\211\221\272X'/\033jP\260M\211\217\322"
+	.string	"5\251q\203\323'\241\357\236\366\351o\311\324\311X\332x\235\3021\263h\301c^4.\322\002\001x\003\t\024\021\211t\356\326p\ri\310"
+	.ascii	"\303 \361d\346\242."
+	.string	"f\377\224\023\222z\205\301\315f\332\353\241\202\\\246r`\323\343(\347\312\336*kO\rV\200\340\rf\302\206CN\342\352+Wi\3121\021\304\311\205\371\206A\\%RkP)\360\335a\273\340\025\204\350\035\177\"\201%\371\035\312\034\027\242\346\350\036\206A\345\022\246\357U\253\016\207\220\374N\264\314\244k\225\344\331\300\254\221/\026\307,\342\353\277\342\013\266Y\232\2344\216>`^\330\025y\177, \364}\2611\310N\274\304\316Z\024\f\265,\013\237\271\210\263\007d\222',\335i\311q\312\217A\326v$-\274\357\265l&P\350\356\336\327\260\315\031z\021\247Ab\037\007\236(\376\257\024\\\367\374*]F\023\244S\353PBNw\236\262\316\033c/k9uS\034\216\211\253\300MQ\223\034 \364R\227\002\006K\311\307@\222\216m\373\377\271\307t\322@anKt;\307W\007#A\215q\017p\3611J"
+	.string	"\321\357+{Dv\f\206\367\247\342\033\267E\372\334\340\211II\245\365\262}=\2464l\364b\265\360%\205x_\344%^\300d\234p1\007\353\226\260\304\022\206\023\023\356\342\213\202K\240a\203+\254\331\304\226#\311\321\235\300.+G\234\373\330}\205\2679'9\t\365\nO%\005\263\215\224\375\247Kb\034Q\313\352\322'cx!\006\034l\024\325]W\\NS\314\303\3408\272\377\365\365k\322\366\231f\213-4O1F/\320\312`\260"
+	.string	".\231\202|R\246Z\253\202\b\254\036\004e\346\325o:\253\215\256\345\017\367g\212\037\303%\227\275\354\222\230#\342\300E\306\2407sy\004\b\272\270\221\247\357n%N\307\347\374\322O.7s\262o&r\323\202\225X\r(R\210\315x\220\305\2414\314\231\374\013\272fz\355\230\2318\312\033\3655\321#\022\"\013w\r\322"
+	.ascii	"\222\2370x\177\313\316vO|F4tq\027:\206\005v\324\203\260E\246"
+	.ascii	"\017\235\341\207^\257\240\237!\347\235a\373J\243{ \247\035>\231"
+	.ascii	" \227\221\310U/\335S\346\364\030\226\3572&;\006\f\372m\263\343"
+	.ascii	".?qy\36227qG\036\3263\361\266|\223\b?B*\024\246z\344\236.\231"
+	.ascii	"2i\210\203-\226\231XG\220\202%P\360\302\223X\224\344\t\f\341"
+	.ascii	"}\034v*\377\273\203);\226_gp)}\236eCi\257\244\217\233\201\201"
+	.ascii	"\205\204\344\2627\033x\316\244\345`S\215_\316  \030\256\025n"
+	.ascii	"\265\354\025\231\013Z\033\267\351\241\304\307v\3210\234$P\315"
+	.ascii	"N\302y\207\225\210\033\266g\025\346\261\t\235\r\252\013I0t\031"
+	.ascii	"\020\021\202\253(b1\307E\032v\233\206\367\252\n\261Yh\361\377"
+	.ascii	"\030y\233\2210\013\b/\220\226\033\bM \307uJ\206\235*\366 \335"
+	.ascii	"\265\206o\262\272~\007\026\256\274\357\"\275\303\025l\025F\250"
+	.ascii	"u4\274\303\211\307@+\361\001)\241\224\345\242\331\244\370_b\306"
+	.ascii	"C\205\344o\250\031-\n\360\264\023S\337\334ZX1\3458\337\\\313"
+	.ascii	"\373\001\277\353\346\315\272\033\371XR\023\212:\262R\207,\272"
+	.ascii	"\344\313t\240\221\310\nc\352yG\326\031\f\2545r \210m\216\211"
+	.ascii	"\261\007\247\231-\352\221\323\254\303\3323)\367\210P?\344\353"
+	.ascii	"?\371\034A\214P\331F$Q\331\326\f\252\276\312\236\300u\214\215"
+	.ascii	"\004Ktq\021f\330\2624\025\312\260\216\344#\fpF\031~\322\234&"
+	.ascii	"}\332\345\265e0H\375&P\274\362T\216m\320t\236m\002\250\273|\f"
+	.ascii	"Z\324_D\233\352\0307\2548\247\036g\345#O$<\313\350\330\361\325"
+	.ascii	"\267\316\266\352\345[\330\223\003\317\374\216\263-\321\251\374"
+	.ascii	"\0225\001\006\024\342\214\254G`\272m6a\311\247D\266Fq}B\214\230"
+	.ascii	"\211#\243\372\024.\332\226\360\212\366n^mz|`J\265\177T\366J;"
+	.ascii	"\201\254\026b\305\003\271\233\232C\356T\025\330\2531s3Y\364\006"
+	.ascii	"\302n\260W\365\003\234\327\036\361^2\202\272\025\\\031Av\267"
+	.ascii	"\260\023\321H?\n\224\2267\313\321\027\262\026\232\002K)Z\241"
+	.ascii	"$d3\217\336jQ\233\320G\255\033\307R\036\002}\362\354\025\031"
+	.ascii	"b\337(45\306\320\3477'\372\017\\\006\320\372\330\204\201\257"
+	.ascii	",\225,\332\231v\004\220\273v\357\205L\332\313E\001L\004\3408"
+	.ascii	"\274\036\022\001\305\364W\333\016\212\031\330\266\356MB\266x"
+	.ascii	"\237W\234\325\237P@\002\267\334\342\021\345 \t\315\224\n\365"
+	.ascii	"\360\225s\003@M\037)\207\307\374(%\002r)B-\321m\234b\331\343"
+	.ascii	"\243?2t\300\255`\004\275\355.Cd\345\263\321P`\256_\300\221\332"
+	.ascii	"\301f\3629\366\223\261\250{\030\251\341\301\341\250\303d%\306"
+	.ascii	"\306S\310@\223\224%D\034\210f;\204\3549\346\253\217U\241R7\226"
+	.ascii	"q\230\253\267\365Ls}\232\327\3242H}\360t\372\357A\003\366pCe"
+	.ascii	"\231-/\212\3222\254m!\250\035\227\324,\342\255\322\034E\255\241"
+	.ascii	"(G\252\232ax\266\310\222D\227\r\341\031T"
+	.string	"Y{\205\367!\3512p'\232\256+\374M1\242\233\2512\263\340\364>\032\225I\237\360R\352\003\200\273A:1\300\002\306\374\027\361C\007\023\016\0055\215\233~\376\235\221\351a\351\354\0267\023\006+\311\261\267\345\266\253\355\242t$\276_\256\225Wl\t\333\224\023\224\361\332\350\215$\300\346\267\274\355\324\224t\227E\037\345\265\024\"\244\307S\243\336\231\214\270\363k\210#\303~C\177\227\334\254\nI\273_f\326\200I\344\326\2020\375|\365\340\204\272i\223$\251^\355\255d\024\335\031X~&\037\241\235y\206Ls\350\354\357\233\313\022\215hD\214\252#\226pd\375cr\342J_E\030\317\006\033\361\0210r-)\224\224\323\036EKO\2725\234\3036\030\231\310\034\3013%Y\251\276?\302\2441t\266\221\273@Mj#\220\312j\227\372wLl\304\373\204\373\251\303\344Z\210\360\311\267\fE`\371\022\262\355\274"
+	.string	"\304\031\342\303\202r\241\335=\022\221$\222\247P\356\t0\024\364\210?\344\261\370+\205\351\307\250\021\005\207\231[\177\265\347\203\341\254\213(\230\247c\022\2146\316\026\030\035\370\375\034\264\021\315\231\003\217\374'\211\322\373w>.\nN\317\265\266\332\220?y\027\317\211\350\023\b\355G>\3058\204tB&d@\317\216\201\340\001\313\206J\377)\364\227\256t^p\035\026}\027\233"
+	.string	"\301 Z\324\t\013\252|\347rq=\273\034\257\222\036F\277-Q#\216f\376\316\311\361\033\264\322\345\307PE\352\013\357\004\334\255\365\321\362\315C;N\311\330\371*tvMoA\251C\270\021\352O@\220\367TyDN\275\362\341?\214\344\377\200\315\204'\023\341z0\367\342\035\221q\326\214,2\003\375\342/9Gu\354/\r{1Wn\345\034Ut\275]h\f\301\263\374"
+	.ascii	"\036\234\375\237\224\207\231\300\025(\372P\367\337\321=\372\177"
+	.ascii	"Da\234\207d<\266d\213\317\317\001\214K\372\333\032\274\353\177"
+	.ascii	"\240\307\255P\3432om4\376\373\027\361\f\277\362\215q8= \373\017"
+	.ascii	"\200\007\274\n\230\027\360K\331\334\007\326|Fm\263\345\022\316"
+	.ascii	"nAJ\314\275?\023D6\262}\223\211\333\320\007\177}A\207_\362\256"
+	.ascii	"\266z\002\215\013\321\337\007\267\337\340\354T\314t\253\277"
+	.ascii	"-\3073NG\021\352'\252\334D;\266\313OqK\264\277\236\377\255\262"
+	.ascii	"\203\213\207Q\347\316\024\372\235C_\201\377Ur(Dz\023\343}\371"
+	.ascii	"\277P\252sPM\333\177\215\231\256\340z\337\3247T\301~\026\330"
+	.ascii	"\277n\372M\271\377\f\356\241\337]\272\016\200^\204u\232\251o"
+	.ascii	"`\377\204\341}aPNj>9\214x\252\377]\347\0032\226o\333\302\351"
+	.ascii	"1\370\035\344\274\2245g\271\376!\031s\335oi?6;\223\321J\376m"
+	.ascii	"\306G|}\f\334:9f\376\315,\375/v<W\236\305\215\234\322y\"}~T}"
+	.ascii	"R\225\236\t\370:\214i\275\356*\360,F\234\217\f\377\255\006\333"
+	.ascii	"q\033\361_\210\223\217s\357\320~\234\241\323\356\377\322[\322"
+	.ascii	"j\226\306p\b\376C\222\273\375\355\2408/H|E5\3070\177\2446\316"
+	.ascii	"<\224\357 t\001^\367\013\327\003_\237\352\267\003\223\213\034"
+	.ascii	"{\217:\265\0310\274\204\233\361\273E\324\226M\231\202\3038\253"
+	.ascii	"\373FIW\210P'x\275Q\351;\301\376\017y\322\b\023\357\037\230l"
+	.ascii	";m\317h\037\203\037yh\277D\321\237\034?D\377\243\324\f\371\r"
+	.ascii	"3\227\306\036\323\274 j{\030p7@\036?\376k\216\302Z{\366\210\375"
+	.ascii	"E\2041\215\256\001\363R\307\020\322\333\366\266\204vX\334x4\034"
+	.ascii	"t\255\354\3176\237\356\027\033\273\215Ph\r\347/{\315B\302\252"
+	.ascii	"\362\3732\344\344\016\023S\361\252\206\316\321p\262O\247\367"
+	.ascii	"\374\323\037\rv\340\177\036\265\347X\217\322\f\272~\r\006\273"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.symtab.c4ada9fcc3e8c36e,"e",@progbits
+	.string	"AccInflightCalibrationArmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"motorControlEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"headFreeModeHold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"isCalibrating"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"updateLEDs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"mwDisarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"mwArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"updateMagHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"throttleCorrectionConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"setPidUpdateCountDown"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"taskMainPidLoopInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"pgResetTemplate_throttleCorrectionConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"throttleCorrectionConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"profileProbes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"profileTicks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"gyroDataReadyAtUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\003"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"isAccelerationCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"gyroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"gyroIsrRelease"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"calculateThrottleAngleCorrection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"gyroIsrHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"applyAltHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"releaseSharedTelemetryPorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\003"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\003"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\003"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\003"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\003"
+	.string	""
+	.string	"pidResetErrorGyroState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\003"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\003"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c4ada9fcc3e8c36e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
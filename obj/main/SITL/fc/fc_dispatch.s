@@ -0,0 +1,7743 @@
+	.file	"fc_dispatch.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/fc/fc_dispatch.h"
+	.file 5 "./src/main/fc/fc_dispatch.c"
+	.file 6 "./src/main/common/utils.h"
+	.file 7 "./src/main/drivers/system.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_dispatch.c.f85df9cd
+	.weak	fc_dispatch.c.f85df9cd
+fc_dispatch.c.f85df9cd:
+	.long	0x1c4
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xb
+	.long	.LASF1162
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1134
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1135
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1136
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1137
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1138
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1139
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1140
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1141
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1142
+	.uleb128 0x2
+	.long	.LASF1143
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1144
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x53
+	.uleb128 0x2
+	.long	.LASF1145
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x68
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1146
+	.uleb128 0x2
+	.long	.LASF1147
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x74
+	.uleb128 0x2
+	.long	.LASF1148
+	.byte	0x4
+	.byte	0x15
+	.byte	0xe
+	.long	0xab
+	.uleb128 0xd
+	.long	0xb6
+	.uleb128 0xe
+	.long	0xb6
+	.byte	0
+	.uleb128 0x3
+	.long	0xbb
+	.uleb128 0xf
+	.long	.LASF1163
+	.byte	0x18
+	.byte	0x4
+	.byte	0x17
+	.byte	0x10
+	.long	0xed
+	.uleb128 0x5
+	.long	.LASF1149
+	.byte	0x18
+	.byte	0x13
+	.long	0xed
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1150
+	.byte	0x19
+	.byte	0xe
+	.long	0x93
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1151
+	.byte	0x1a
+	.byte	0x1d
+	.long	0xb6
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	0x9f
+	.uleb128 0x2
+	.long	.LASF1152
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x3
+	.long	0xbb
+	.uleb128 0x4
+	.long	.LASF1153
+	.byte	0x1d
+	.byte	0x19
+	.long	0x109
+	.uleb128 0x3
+	.long	0xf2
+	.uleb128 0x4
+	.long	.LASF1154
+	.byte	0x1e
+	.byte	0xc
+	.long	0x119
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1155
+	.uleb128 0x10
+	.long	.LASF1164
+	.byte	0x7
+	.byte	0x1b
+	.byte	0xa
+	.long	0x93
+	.uleb128 0x7
+	.long	.LASF1158
+	.byte	0x36
+	.long	0x161
+	.uleb128 0x6
+	.long	.LASF1156
+	.byte	0x36
+	.byte	0x23
+	.long	0x109
+	.uleb128 0x6
+	.long	.LASF1157
+	.byte	0x36
+	.byte	0x2e
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF1150
+	.byte	0x38
+	.byte	0xe
+	.long	0x93
+	.uleb128 0x8
+	.string	"p"
+	.byte	0x3a
+	.byte	0x17
+	.long	0x161
+	.byte	0
+	.uleb128 0x3
+	.long	0x109
+	.uleb128 0x7
+	.long	.LASF1159
+	.byte	0x2a
+	.long	0x194
+	.uleb128 0x6
+	.long	.LASF1160
+	.byte	0x2a
+	.byte	0x1f
+	.long	0x93
+	.uleb128 0x9
+	.uleb128 0x8
+	.string	"p"
+	.byte	0x2c
+	.byte	0x1b
+	.long	0x161
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF1161
+	.byte	0x30
+	.byte	0x1a
+	.long	0x109
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1165
+	.byte	0x5
+	.byte	0x25
+	.byte	0x6
+	.uleb128 0x12
+	.long	.LASF1166
+	.byte	0x5
+	.byte	0x20
+	.byte	0x5
+	.long	0x119
+	.uleb128 0x13
+	.long	.LASF1167
+	.byte	0x6
+	.byte	0x4c
+	.byte	0x17
+	.long	0x80
+	.uleb128 0xa
+	.string	"a"
+	.byte	0x4c
+	.byte	0x26
+	.long	0x93
+	.uleb128 0xa
+	.string	"b"
+	.byte	0x4c
+	.byte	0x32
+	.long	0x93
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 10 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF404
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF405
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF484
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF559
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF577
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF643
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF679
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF559
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x111
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF707
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF708
+	.byte	0x4
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF709
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF710
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF484
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF770
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF786
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF787
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF788
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF792
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF793
+	.file 34 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF794
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF811
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF824
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF829
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF832
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF833
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF849
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF850
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF851
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF863
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF870
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF871
+	.byte	0x4
+	.byte	0x4
+	.file 51 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF875
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x34
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x4
+	.file 54 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x36
+	.file 55 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF880
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF976
+	.byte	0x4
+	.file 57 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x39
+	.file 58 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 59 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 60 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x3c
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1114
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF478
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF480
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF483
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF496
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF497
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF544
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF558
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF576
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF595
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF597
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF599
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF602
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF620
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF637
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF638
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF639
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF641
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF642
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF652
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF678
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF706
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF725
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF769
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.40.18f72bab8242c2bb4c532a2aa95b5f00,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF785
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.135.9eeb6b52c2522ad7aff16ad95342972e,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF621
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF642
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF798
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF800
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF802
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF806
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF810
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF823
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF828
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.52.4f882364bb7424384ae71496b52638dc,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF848
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF866
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF869
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF874
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF404
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF595
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF597
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF599
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF879
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1021
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1034
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF621
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF639
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF641
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1036
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF982
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1082
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1088
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1090
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF1168
+	.long	.LASF1169
+	.long	.LASF1170
+	.long	.LASF1171
+	.long	.LASF1172
+	.long	.LASF1173
+	.long	.LASF1174
+	.long	.LASF1175
+	.long	.LASF1176
+	.long	.LASF1177
+	.long	.LASF1178
+	.long	.LASF1179
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1180
+	.byte	0x8
+	.long	.LASF1181
+	.byte	0x8
+	.long	.LASF1182
+	.byte	0x8
+	.long	.LASF1183
+	.byte	0x3
+	.long	.LASF1184
+	.byte	0x3
+	.long	.LASF1185
+	.byte	0x1
+	.long	.LASF1186
+	.byte	0x2
+	.long	.LASF1187
+	.byte	0xb
+	.long	.LASF1188
+	.byte	0xc
+	.long	.LASF1189
+	.byte	0xb
+	.long	.LASF1190
+	.byte	0x8
+	.long	.LASF1191
+	.byte	0xb
+	.long	.LASF1192
+	.byte	0xb
+	.long	.LASF1193
+	.byte	0x8
+	.long	.LASF1194
+	.byte	0x8
+	.long	.LASF1195
+	.byte	0xa
+	.long	.LASF1196
+	.byte	0x8
+	.long	.LASF1197
+	.byte	0x9
+	.long	.LASF1198
+	.byte	0x9
+	.long	.LASF1199
+	.byte	0xc
+	.long	.LASF1200
+	.byte	0x8
+	.long	.LASF1201
+	.byte	0x8
+	.long	.LASF1202
+	.byte	0x8
+	.long	.LASF1203
+	.byte	0x8
+	.long	.LASF1204
+	.byte	0x7
+	.long	.LASF1205
+	.byte	0x7
+	.long	.LASF1180
+	.byte	0xa
+	.long	.LASF1206
+	.byte	0x8
+	.long	.LASF1207
+	.byte	0x8
+	.long	.LASF1208
+	.byte	0x7
+	.long	.LASF1209
+	.byte	0x7
+	.long	.LASF1210
+	.byte	0x7
+	.long	.LASF1211
+	.byte	0x7
+	.long	.LASF1212
+	.byte	0xb
+	.long	.LASF1212
+	.byte	0x8
+	.long	.LASF1213
+	.byte	0x8
+	.long	.LASF1214
+	.byte	0x8
+	.long	.LASF1215
+	.byte	0x8
+	.long	.LASF1216
+	.byte	0xa
+	.long	.LASF1216
+	.byte	0x8
+	.long	.LASF1217
+	.byte	0x7
+	.long	.LASF1218
+	.byte	0x7
+	.long	.LASF1219
+	.byte	0x7
+	.long	.LASF1220
+	.byte	0x7
+	.long	.LASF1221
+	.byte	0x8
+	.long	.LASF1222
+	.byte	0x8
+	.long	.LASF1223
+	.byte	0x8
+	.long	.LASF1224
+	.byte	0x8
+	.long	.LASF1225
+	.byte	0x8
+	.long	.LASF1226
+	.byte	0x8
+	.long	.LASF1227
+	.byte	0xb
+	.long	.LASF1228
+	.byte	0x8
+	.long	.LASF1229
+	.byte	0x8
+	.long	.LASF1230
+	.byte	0xc
+	.long	.LASF1230
+	.byte	0xb
+	.long	.LASF1231
+	.byte	0x8
+	.long	.LASF1232
+	.byte	0x6
+	.long	.LASF1233
+	.byte	0x5
+	.long	.LASF1234
+	.byte	0x4
+	.long	.LASF1235
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF777:
+	.string	"__nlink_t_defined "
+.LASF888:
+	.string	"INT32_MAX (2147483647)"
+.LASF862:
+	.string	"__ONCE_ALIGNMENT "
+.LASF452:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF725:
+	.string	"__STD_TYPE typedef"
+.LASF848:
+	.string	"__fsfilcnt_t_defined "
+.LASF482:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF674:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF997:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF682:
+	.string	"__HAVE_FLOAT64 1"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF763:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF687:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF815:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF694:
+	.string	"__f64(x) x ##f64"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF707:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1084:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1150:
+	.string	"delayedUntil"
+.LASF584:
+	.string	"__stub_sigreturn "
+.LASF421:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1159:
+	.string	"dispatchProcess"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF546:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF818:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF560:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF787:
+	.string	"__clockid_t_defined 1"
+.LASF521:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF758:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF934:
+	.string	"INT16_C(c) c"
+.LASF1145:
+	.string	"int32_t"
+.LASF965:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF492:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF827:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1041:
+	.string	"U_ID_0 0"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF488:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF954:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF924:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1053:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1036:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF646:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1166:
+	.string	"dispatchIsEnabled"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF1059:
+	.string	"USE_UART7 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF958:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1106:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF655:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF903:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF947:
+	.string	"INT32_WIDTH 32"
+.LASF949:
+	.string	"INT64_WIDTH 64"
+.LASF535:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF745:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF836:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF770:
+	.string	"__STD_TYPE"
+.LASF791:
+	.string	"__suseconds_t_defined "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF756:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF830:
+	.string	"____sigset_t_defined "
+.LASF508:
+	.string	"__P(args) args"
+.LASF793:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1113:
+	.string	"__enable_irq() "
+.LASF857:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF604:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF738:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF784:
+	.string	"__daddr_t_defined "
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF993:
+	.string	"USE_SERIALRX_SUMD "
+.LASF639:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1021:
+	.string	"VTX_TRAMP "
+.LASF696:
+	.string	"__f64x(x) x ##f64x"
+.LASF839:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF673:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1030:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF681:
+	.string	"__HAVE_FLOAT32 1"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF938:
+	.string	"UINT16_C(c) c"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF620:
+	.string	"__size_t "
+.LASF882:
+	.string	"INT8_MIN (-128)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF722:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF496:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF913:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF441:
+	.string	"_ISOC99_SOURCE 1"
+.LASF523:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF608:
+	.string	"_T_SIZE "
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1127:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1095:
+	.string	"USE_PROFILE "
+.LASF891:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF912:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF804:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF1097:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF424:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF868:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF411:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1014:
+	.string	"USE_MSP_PUSH "
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF640:
+	.string	"NULL"
+.LASF1042:
+	.string	"U_ID_1 1"
+.LASF518:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF752:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1020:
+	.string	"VTX_SMARTAUDIO "
+.LASF1069:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1149:
+	.string	"dispatch"
+.LASF929:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF580:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF864:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF747:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF670:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF435:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF415:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF420:
+	.string	"__USE_XOPEN2K8"
+.LASF1015:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF545:
+	.string	"__always_inline"
+.LASF606:
+	.string	"_SYS_SIZE_T_H "
+.LASF990:
+	.string	"USE_SERIALRX_IBUS "
+.LASF795:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF853:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF494:
+	.string	"__GLIBC__ 2"
+.LASF442:
+	.string	"_ISOC11_SOURCE"
+.LASF688:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1135:
+	.string	"long int"
+.LASF484:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF809:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF829:
+	.string	"__sigset_t_defined 1"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF436:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF471:
+	.string	"__USE_XOPEN2K8 1"
+.LASF753:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1029:
+	.string	"_PTRDIFF_T_ "
+.LASF432:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF825:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF767:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF780:
+	.string	"__off64_t_defined "
+.LASF798:
+	.string	"__PDP_ENDIAN 3412"
+.LASF644:
+	.string	"WNOHANG 1"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF919:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1137:
+	.string	"short unsigned int"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF542:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF543:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF615:
+	.string	"_SIZE_T_DECLARED "
+.LASF510:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF658:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1083:
+	.string	"USE_DASHBOARD"
+.LASF1072:
+	.string	"USE_SERIALRX_XBUS"
+.LASF566:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1153:
+	.string	"head"
+.LASF1111:
+	.string	"EEPROM_SIZE 32768"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF972:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF531:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF926:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF998:
+	.string	"TELEMETRY "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF692:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF404:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1114:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1164:
+	.string	"micros"
+.LASF641:
+	.string	"NULL ((void *)0)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF863:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF501:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF948:
+	.string	"UINT32_WIDTH 32"
+.LASF700:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF950:
+	.string	"UINT64_WIDTH 64"
+.LASF603:
+	.string	"__size_t__ "
+.LASF807:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF712:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF512:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1060:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF727:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF559:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1048:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF977:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1013:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF743:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1079:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF771:
+	.string	"__u_char_defined "
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF614:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF617:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF464:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF509:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF683:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF904:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF616:
+	.string	"__DEFINED_size_t "
+.LASF835:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1065:
+	.string	"SERIAL_RX"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF479:
+	.string	"__USE_LARGEFILE 1"
+.LASF1000:
+	.string	"TELEMETRY_HOTT "
+.LASF855:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF944:
+	.string	"UINT8_WIDTH 8"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF837:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1055:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF781:
+	.string	"__pid_t_defined "
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF883:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF843:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1155:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF553:
+	.string	"__restrict_arr __restrict"
+.LASF578:
+	.string	"__stub___compat_bdflush "
+.LASF982:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF907:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF612:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF979:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF992:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF651:
+	.string	"__WALL 0x40000000"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF490:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF899:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF975:
+	.string	"WINT_WIDTH 32"
+.LASF869:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF532:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF897:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF678:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF601:
+	.string	"__need_wchar_t "
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF966:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF583:
+	.string	"__stub_setlogin "
+.LASF959:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF600:
+	.string	"__need_size_t "
+.LASF1073:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF715:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF565:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF550:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF664:
+	.string	"__WCOREFLAG 0x80"
+.LASF1093:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF976:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1121:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1098:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF418:
+	.string	"__USE_XOPEN2K"
+.LASF832:
+	.string	"__timeval_defined 1"
+.LASF769:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF650:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF419:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF702:
+	.string	"__lldiv_t_defined 1"
+.LASF1118:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF548:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF451:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF865:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1046:
+	.string	"USE_FAKE_GYRO "
+.LASF468:
+	.string	"__USE_POSIX199309 1"
+.LASF1132:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF910:
+	.string	"INT_FAST8_MAX (127)"
+.LASF898:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF928:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF971:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1051:
+	.string	"MAG "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF939:
+	.string	"UINT32_C(c) c ## U"
+.LASF669:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF918:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF413:
+	.string	"__USE_POSIX199309"
+.LASF889:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF698:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF697:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF663:
+	.string	"__W_CONTINUED 0xffff"
+.LASF772:
+	.string	"__ino_t_defined "
+.LASF908:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1086:
+	.string	"VTX_CONTROL"
+.LASF1161:
+	.string	"current"
+.LASF495:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF417:
+	.string	"__USE_UNIX98"
+.LASF989:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF852:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF434:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1037:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF768:
+	.string	"_BITS_TIME64_H 1"
+.LASF731:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF634:
+	.string	"__INT_WCHAR_T_H "
+.LASF1068:
+	.string	"USE_SERIALRX_SBUS"
+.LASF716:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF761:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1116:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF833:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF991:
+	.string	"USE_SERIALRX_SBUS "
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF858:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF517:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF444:
+	.string	"_ISOC2X_SOURCE"
+.LASF1102:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF786:
+	.string	"__clock_t_defined 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF400:
+	.string	"bool _Bool"
+.LASF705:
+	.string	"EXIT_SUCCESS 0"
+.LASF1120:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF629:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF860:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF703:
+	.string	"RAND_MAX 2147483647"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF915:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF980:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1040:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF530:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF778:
+	.string	"__uid_t_defined "
+.LASF524:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1070:
+	.string	"USE_SERIALRX_SUMD"
+.LASF916:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF742:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF816:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1090:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1119:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1043:
+	.string	"U_ID_2 2"
+.LASF540:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1074:
+	.string	"LED_STRIP"
+.LASF642:
+	.string	"__need_NULL"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF706:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF974:
+	.string	"WCHAR_WIDTH 32"
+.LASF941:
+	.string	"INTMAX_C(c) c ## L"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF458:
+	.string	"_ATFILE_SOURCE"
+.LASF790:
+	.string	"__useconds_t_defined "
+.LASF721:
+	.string	"__SLONG32_TYPE int"
+.LASF931:
+	.string	"WINT_MIN (0u)"
+.LASF814:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF686:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1130:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF407:
+	.string	"__USE_ISOC11"
+.LASF483:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1017:
+	.string	"USE_SENSOR_NAMES "
+.LASF834:
+	.string	"__NFDBITS"
+.LASF879:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF952:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF880:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF840:
+	.string	"NFDBITS __NFDBITS"
+.LASF588:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF671:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF645:
+	.string	"WUNTRACED 2"
+.LASF754:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF480:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF922:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF744:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF961:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF710:
+	.string	"_BITS_TYPES_H 1"
+.LASF890:
+	.string	"UINT8_MAX (255)"
+.LASF856:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF927:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF937:
+	.string	"UINT8_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF446:
+	.string	"_POSIX_SOURCE"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1144:
+	.string	"__uint32_t"
+.LASF1158:
+	.string	"dispatchAdd"
+.LASF465:
+	.string	"__USE_ISOC95 1"
+.LASF569:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF582:
+	.string	"__stub_revoke "
+.LASF1148:
+	.string	"dispatchFunc"
+.LASF607:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF822:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF962:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1107:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF984:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF522:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1032:
+	.string	"_GCC_PTRDIFF_T "
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF438:
+	.string	"_ISOC95_SOURCE"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1117:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF504:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF602:
+	.string	"__need_NULL "
+.LASF406:
+	.string	"_FEATURES_H 1"
+.LASF457:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF647:
+	.string	"WEXITED 4"
+.LASF1022:
+	.string	"_STDDEF_H "
+.LASF502:
+	.string	"__LEAF , __leaf__"
+.LASF422:
+	.string	"__USE_LARGEFILE"
+.LASF1016:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF534:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF963:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF748:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1044:
+	.string	"LED0_PIN NONE"
+.LASF1133:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF773:
+	.string	"__ino64_t_defined "
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF726:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1115:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF820:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1089:
+	.string	"BLACKBOX"
+.LASF1061:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1031:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF877:
+	.string	"_BITS_WCHAR_H 1"
+.LASF699:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF762:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF475:
+	.string	"_LARGEFILE_SOURCE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1026:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF426:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1077:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF454:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF473:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF983:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF668:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF824:
+	.string	"_SYS_SELECT_H 1"
+.LASF625:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF562:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1103:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF412:
+	.string	"__USE_POSIX2"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1085:
+	.string	"VTX_COMMON"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF870:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF621:
+	.string	"__need_size_t"
+.LASF610:
+	.string	"_SIZE_T_ "
+.LASF487:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF785:
+	.string	"__key_t_defined "
+.LASF1136:
+	.string	"long long int"
+.LASF1099:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF622:
+	.string	"__wchar_t__ "
+.LASF571:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF576:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF637:
+	.string	"__DEFINED_wchar_t "
+.LASF876:
+	.string	"_STDINT_H 1"
+.LASF808:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF691:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF921:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF557:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF627:
+	.string	"__WCHAR_T "
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF995:
+	.string	"USE_SERIALRX_XBUS "
+.LASF507:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF450:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF951:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF538:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF556:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF803:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF498:
+	.string	"__PMT"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF819:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF677:
+	.string	"__f128(x) x ##f128"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF657:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF909:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF459:
+	.string	"_ATFILE_SOURCE 1"
+.LASF717:
+	.string	"__SQUAD_TYPE long int"
+.LASF1071:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF943:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF932:
+	.string	"WINT_MAX (4294967295u)"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1152:
+	.string	"dispatchEntry_t"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF429:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF573:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1024:
+	.string	"_ANSI_STDDEF_H "
+.LASF821:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF968:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1003:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF568:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF660:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1140:
+	.string	"unsigned int"
+.LASF871:
+	.string	"__have_pthread_attr_t 1"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF946:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF499:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF425:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF636:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1002:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF854:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF470:
+	.string	"__USE_XOPEN2K 1"
+.LASF463:
+	.string	"__USE_ISOC11 1"
+.LASF755:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF714:
+	.string	"__U32_TYPE unsigned int"
+.LASF1027:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF529:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1126:
+	.string	"BIT(x) (1 << (x))"
+.LASF1025:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF533:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF873:
+	.string	"alloca"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF555:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF581:
+	.string	"__stub_gtty "
+.LASF623:
+	.string	"__WCHAR_T__ "
+.LASF901:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF751:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF894:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1011:
+	.string	"TELEMETRY_SRXL "
+.LASF544:
+	.string	"__wur "
+.LASF477:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1075:
+	.string	"TELEMETRY_FRSKY"
+.LASF823:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF402:
+	.string	"false 0"
+.LASF782:
+	.string	"__id_t_defined "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF828:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF933:
+	.string	"INT8_C(c) c"
+.LASF401:
+	.string	"true 1"
+.LASF1033:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF720:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF766:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF493:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF730:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1047:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF737:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF654:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF505:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF561:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF653:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1165:
+	.string	"dispatchEnable"
+.LASF1139:
+	.string	"unsigned char"
+.LASF1062:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF558:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF690:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF838:
+	.string	"__FDS_BITS(set) ((set)->fds_bits)"
+.LASF667:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF764:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF796:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF511:
+	.string	"__STRING(x) #x"
+.LASF624:
+	.string	"_WCHAR_T "
+.LASF684:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1050:
+	.string	"USE_FAKE_BARO "
+.LASF1081:
+	.string	"TELEMETRY_MAVLINK"
+.LASF960:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1138:
+	.string	"char"
+.LASF506:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF567:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF605:
+	.string	"_SIZE_T "
+.LASF632:
+	.string	"_WCHAR_T_H "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF896:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF810:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1052:
+	.string	"USE_FAKE_MAG "
+.LASF1088:
+	.string	"VTX_TRAMP"
+.LASF526:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF474:
+	.string	"__USE_UNIX98 1"
+.LASF739:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1023:
+	.string	"_STDDEF_H_ "
+.LASF1091:
+	.string	"USE_SERVOS"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF609:
+	.string	"__SIZE_T "
+.LASF996:
+	.string	"BLACKBOX "
+.LASF794:
+	.string	"_ENDIAN_H 1"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1045:
+	.string	"GYRO "
+.LASF1092:
+	.string	"USE_DSHOT"
+.LASF1112:
+	.string	"__disable_irq() "
+.LASF826:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1067:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF409:
+	.string	"__USE_ISOC95"
+.LASF1162:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF408:
+	.string	"__USE_ISOC99"
+.LASF1156:
+	.string	"entry"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF416:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF665:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1080:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF513:
+	.string	"__BEGIN_DECLS "
+.LASF635:
+	.string	"_GCC_WCHAR_T "
+.LASF905:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF911:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1110:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF541:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF648:
+	.string	"WCONTINUED 8"
+.LASF469:
+	.string	"__USE_POSIX199506 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF831:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF881:
+	.string	"__intptr_t_defined "
+.LASF472:
+	.string	"__USE_XOPEN 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF746:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1008:
+	.string	"TELEMETRY_IBUS "
+.LASF1128:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1146:
+	.string	"long long unsigned int"
+.LASF1049:
+	.string	"BARO "
+.LASF393:
+	.string	"SITL 1"
+.LASF689:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF439:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF410:
+	.string	"__USE_ISOCXX11"
+.LASF613:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF783:
+	.string	"__ssize_t_defined "
+.LASF1028:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF902:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1134:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF789:
+	.string	"__timer_t_defined 1"
+.LASF449:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF659:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF774:
+	.string	"__dev_t_defined "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1010:
+	.string	"TELEMETRY_MAVLINK "
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF537:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF414:
+	.string	"__USE_POSIX199506"
+.LASF797:
+	.string	"__BIG_ENDIAN 4321"
+.LASF935:
+	.string	"INT32_C(c) c"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF940:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1057:
+	.string	"USE_UART5 "
+.LASF867:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF643:
+	.string	"_STDLIB_H 1"
+.LASF1066:
+	.string	"USE_SERIALRX_CRSF"
+.LASF481:
+	.string	"__WORDSIZE 64"
+.LASF1019:
+	.string	"VTX_CONTROL "
+.LASF842:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF631:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1006:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF585:
+	.string	"__stub_stty "
+.LASF1001:
+	.string	"TELEMETRY_LTM "
+.LASF1012:
+	.string	"USE_DASHBOARD "
+.LASF1157:
+	.string	"delayUs"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF519:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1109:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF572:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF812:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF611:
+	.string	"_BSD_SIZE_T_ "
+.LASF516:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF628:
+	.string	"_WCHAR_T_ "
+.LASF875:
+	.string	"__COMPAR_FN_T "
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF851:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF626:
+	.string	"_T_WCHAR "
+.LASF713:
+	.string	"__S32_TYPE int"
+.LASF892:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF652:
+	.string	"__WCLONE 0x80000000"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF740:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF930:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF850:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF936:
+	.string	"INT64_C(c) c ## L"
+.LASF844:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF811:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF486:
+	.string	"__USE_ATFILE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF672:
+	.string	"_BITS_FLOATN_H "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF942:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF779:
+	.string	"__off_t_defined "
+.LASF1018:
+	.string	"VTX_COMMON "
+.LASF973:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1131:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF884:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF861:
+	.string	"__LOCK_ALIGNMENT "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF675:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF956:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF579:
+	.string	"__stub_chflags "
+.LASF1039:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF428:
+	.string	"__USE_GNU"
+.LASF987:
+	.string	"USE_PWM "
+.LASF619:
+	.string	"_SIZET_ "
+.LASF757:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1058:
+	.string	"USE_UART6 "
+.LASF988:
+	.string	"SERIAL_RX "
+.LASF1005:
+	.string	"GPS "
+.LASF460:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF981:
+	.string	"I2C2_OVERCLOCK true"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF806:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF750:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF728:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF679:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1063:
+	.string	"USE_PPM"
+.LASF549:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF427:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF878:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF693:
+	.string	"__f32(x) x ##f32"
+.LASF539:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF662:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF914:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF514:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF649:
+	.string	"WNOWAIT 0x01000000"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF485:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF885:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1101:
+	.string	"USED_TIMERS 0"
+.LASF955:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1142:
+	.string	"short int"
+.LASF497:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF799:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF437:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF552:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF846:
+	.string	"__blkcnt_t_defined "
+.LASF886:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF817:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF527:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF845:
+	.string	"__blksize_t_defined "
+.LASF957:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1167:
+	.string	"cmp32"
+.LASF564:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF718:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF685:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1035:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF575:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF709:
+	.string	"_SYS_TYPES_H 1"
+.LASF525:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF735:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1160:
+	.string	"currentTime"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF528:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF719:
+	.string	"__SWORD_TYPE long int"
+.LASF985:
+	.string	"USE_CLI "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF536:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF732:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF466:
+	.string	"__USE_POSIX 1"
+.LASF923:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF920:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF724:
+	.string	"__U64_TYPE unsigned long int"
+.LASF574:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF695:
+	.string	"__f32x(x) x ##f32x"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1125:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF1141:
+	.string	"signed char"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF666:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF711:
+	.string	"__S16_TYPE short int"
+.LASF866:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF788:
+	.string	"__time_t_defined 1"
+.LASF1007:
+	.string	"TELEMETRY_CRSF "
+.LASF893:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF859:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF813:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF630:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF547:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF633:
+	.string	"___int_wchar_t_h "
+.LASF1129:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF805:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1094:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1004:
+	.string	"USE_SERVOS "
+.LASF563:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF749:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF551:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF680:
+	.string	"__HAVE_FLOAT16 0"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF701:
+	.string	"__ldiv_t_defined 1"
+.LASF456:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1054:
+	.string	"USE_UART2 "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF986:
+	.string	"USE_PPM "
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF638:
+	.string	"_BSD_WCHAR_T_"
+.LASF900:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF970:
+	.string	"UINTMAX_WIDTH 64"
+.LASF800:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1147:
+	.string	"uint32_t"
+.LASF462:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF729:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF895:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1124:
+	.string	"UNUSED(x) (void)(x)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF445:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF520:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF515:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF802:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF355:
+	.string	"__amd64 1"
+.LASF447:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF467:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF741:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF661:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF570:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF969:
+	.string	"INTMAX_WIDTH 64"
+.LASF887:
+	.string	"INT16_MAX (32767)"
+.LASF953:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF733:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF478:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF734:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1104:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF978:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1087:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF500:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF443:
+	.string	"_ISOC11_SOURCE 1"
+.LASF792:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF872:
+	.string	"_ALLOCA_H 1"
+.LASF1096:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF489:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF964:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF723:
+	.string	"__S64_TYPE long int"
+.LASF1122:
+	.string	"EXPAND_I(x) x"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF760:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF776:
+	.string	"__mode_t_defined "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF967:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF656:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1009:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF994:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1034:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF775:
+	.string	"__gid_t_defined "
+.LASF1108:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1143:
+	.string	"__int32_t"
+.LASF577:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF704:
+	.string	"EXIT_FAILURE 1"
+.LASF503:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1076:
+	.string	"TELEMETRY_HOTT"
+.LASF736:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1056:
+	.string	"USE_UART4 "
+.LASF430:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1123:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF423:
+	.string	"__USE_LARGEFILE64"
+.LASF676:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF708:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1064:
+	.string	"USE_PWM"
+.LASF1105:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF849:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1154:
+	.string	"dispatchEnabled"
+.LASF801:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF377:
+	.string	"__linux 1"
+.LASF1151:
+	.string	"next"
+.LASF999:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF440:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF841:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF586:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF874:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF917:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF765:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF925:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1163:
+	.string	"dispatchEntry_s"
+.LASF448:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF759:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1100:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF906:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1038:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF618:
+	.string	"_GCC_SIZE_T "
+.LASF554:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1082:
+	.string	"TELEMETRY_IBUS"
+.LASF1078:
+	.string	"TELEMETRY_CRSF"
+.LASF945:
+	.string	"INT16_WIDTH 16"
+.LASF847:
+	.string	"__fsblkcnt_t_defined "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1218:
+	.string	"__sigset_t.h"
+.LASF1225:
+	.string	"struct_mutex.h"
+.LASF1235:
+	.string	"common_post.h"
+.LASF1196:
+	.string	"long-double.h"
+.LASF1205:
+	.string	"__locale_t.h"
+.LASF1232:
+	.string	"platform.h"
+.LASF1169:
+	.string	"src/main/drivers"
+.LASF1222:
+	.string	"thread-shared-types.h"
+.LASF1190:
+	.string	"libc-header-start.h"
+.LASF1188:
+	.string	"stdbool.h"
+.LASF1177:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1212:
+	.string	"endian.h"
+.LASF1168:
+	.string	"src/main/common"
+.LASF1181:
+	.string	"stdint-intn.h"
+.LASF1234:
+	.string	"target.h"
+.LASF1176:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1179:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1197:
+	.string	"stubs.h"
+.LASF1171:
+	.string	"src/main/target/SITL"
+.LASF1224:
+	.string	"atomic_wide_counter.h"
+.LASF1194:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1195:
+	.string	"cdefs.h"
+.LASF1175:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1189:
+	.string	"stdlib.h"
+.LASF1192:
+	.string	"features-time64.h"
+.LASF1184:
+	.string	"fc_dispatch.c"
+.LASF1180:
+	.string	"types.h"
+.LASF1183:
+	.string	"fc_dispatch.h"
+.LASF1186:
+	.string	"system.h"
+.LASF1202:
+	.string	"floatn.h"
+.LASF1208:
+	.string	"clock_t.h"
+.LASF1178:
+	.string	"/usr/include"
+.LASF1220:
+	.string	"struct_timespec.h"
+.LASF1210:
+	.string	"time_t.h"
+.LASF1217:
+	.string	"sigset_t.h"
+.LASF1203:
+	.string	"floatn-common.h"
+.LASF1233:
+	.string	"common.h"
+.LASF1206:
+	.string	"typesizes.h"
+.LASF1221:
+	.string	"pthreadtypes.h"
+.LASF1200:
+	.string	"waitflags.h"
+.LASF1209:
+	.string	"clockid_t.h"
+.LASF1191:
+	.string	"features.h"
+.LASF1216:
+	.string	"select.h"
+.LASF1207:
+	.string	"time64.h"
+.LASF1182:
+	.string	"stdint-uintn.h"
+.LASF1214:
+	.string	"byteswap.h"
+.LASF1172:
+	.string	"src/main/target"
+.LASF1185:
+	.string	"utils.h"
+.LASF1211:
+	.string	"timer_t.h"
+.LASF1227:
+	.string	"alloca.h"
+.LASF1223:
+	.string	"pthreadtypes-arch.h"
+.LASF1201:
+	.string	"waitstatus.h"
+.LASF1173:
+	.string	"src/main"
+.LASF1231:
+	.string	"wchar.h"
+.LASF1228:
+	.string	"stdlib-bsearch.h"
+.LASF1170:
+	.string	"src/main/fc"
+.LASF0:
+	.string	"./src/main/fc/fc_dispatch.c"
+.LASF1226:
+	.string	"struct_rwlock.h"
+.LASF1174:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1204:
+	.string	"locale_t.h"
+.LASF1230:
+	.string	"stdint.h"
+.LASF1199:
+	.string	"stddef.h"
+.LASF1198:
+	.string	"stubs-64.h"
+.LASF1193:
+	.string	"wordsize.h"
+.LASF1215:
+	.string	"uintn-identity.h"
+.LASF1219:
+	.string	"struct_timeval.h"
+.LASF1213:
+	.string	"endianness.h"
+.LASF1187:
+	.string	"stdc-predef.h"
+.LASF1229:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.text
+	.section	.gnu.lto_.icf.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375 e]\002"
+	.string	"d\003Y"
+	.string	"\006"
+	.string	"\350\300\306\254\005\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\236\376\250\313\b\003\373\353\216\267\005\n\002\001\002\002\002\003\002\002\002\004\002\004\002\005\004\005\306\345\3114"
+	.string	"\007"
+	.ascii	"K\031\374\f`\250\321\247.\2732\027\232\027o\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375 *\365"
+	.string	""
+	.string	"\240\036"
+	.string	"\004"
+	.string	""
+	.string	"\003\002"
+	.string	"\001\003\001\001"
+	.string	"\001\005\002\001"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	">I\327\fg\003X"
+	.text
+	.section	.gnu.lto_.inline.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375 \264m\003"
+	.string	"\242\205\024!\240'\351\243\017\276K\303#\377\241\016\221\b\374w\242\354X\032\202"
+	.string	""
+	.string	"\034G\034\3126H#D\356\024\377+-$\006\307\332\250\2108\256.\034ki\344\300\001\037\323!\240_m\274\347"
+	.string	"\f\214\342\301H,\233\376\367*\364\202\266\217\312df\236?#\002\n"
+	.ascii	"\220`b\032\203%^\265\016\300\023X\322QD\262\310\353\022\352\006"
+	.ascii	"\332"
+	.text
+	.section	.gnu.lto_.jmpfuncs.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375 7\245\001"
+	.string	"\324\002+"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\003\001\001\003\177\002\007\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\177 \005\002\001\001\017\177\002\002\177\002\006"
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\230\004\003\271\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375 \243\245\002"
+	.string	"\202\304\013\022\340\031\326 \270\324"
+	.string	"0$\376\226r\313\275\267L)\005\235\216\205\2621\235\314\306\033\371\252\300e\276}\022\316r\216Ed\301A\321\0166@\206\016"
+	.ascii	"@\013XBi.\247_5\250j\221\231\217\273\005\244\354\340\271\346"
+	.ascii	"\233\2100\217\355\314\001\3336\320\006"
+	.text
+	.section	.gnu.lto_.lto.32924b03ffe2df8b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_dispatchIsEnabled.15.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375 \352\205\006"
+	.string	"\202L.3Po\322\030\200\276f\020\205\266\252\233\340bJ<T\307b\267\372\036\365\315Z\343\334m\022q{h\266\fdf\210@\2359\300\244\031\365\ni\204\f)e\n\273J\302u0\033\216\006\342\301e\232\3134\n\rf\242\271\213\323\252\203\255M\304\325:\226u5*[TR*BH-\036G\220\344\215\037Wx\0221\234FO"
+	.string	"N\251\004\036\032\241,Mml\272|\006J\345x\004\330\335]I\177\236:\020R\200\262+*\275\354\312\224\002\362\177\236\232\241\341\3633\270P\226\023\f\223\226\335\254i\007>\3147\242\b&\224\250`#\020\246\200\303\356\236\330(\003W\374\025\376\205_\024\007"
+	.ascii	"2\001/8\003X\034\240]\363\220\020d\334\215N;\311"
+	.text
+	.section	.gnu.lto_dispatchEnable.16.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375 \354\245\006"
+	.string	"\022\214.6@o\222\016\200\363\345p\307t\025\200\346\315\301\275\022\020\311\216\217S\3716\361\267\233\217\334\254v\016\330\241\007q\206f\230\230b\356f\207\230X\020D\023\3254!2\005\307\013\"r.\232M\306\241!b`\304@\211\314%\002\306l\003\257\2031\315C\0069\030\226A\213\224}#\2054\225@\217\342\266S\335\217\202t.\307\023\036\327\255\324\365T\245\nLR@\356t7J&\224t,O\372\270\227\361\005\3107\372\307\020\022!P\311\2648\265d\tE\322\361\327Z\373\023\203\212\201\221P\310Jf\302\247Q\255N\273\365\250\300&\372\324\005,d\346n\023]\364\327\037\341O\3701\002\b"
+	.ascii	"3\001\0378\303^|\241k8V\b\343e\210p9\026\355$\003"
+	.text
+	.section	.gnu.lto_dispatchProcess.17.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375`\225\003e\031"
+	.string	"F\354\236K\260\226Q:(\0044\260\273\273\342\365\302\024\254\003X!\237\330H\260y1\336A\"\331{\357"
+	.string	"1<\342<4\241\353\363u\243\237\330\207L\266\005\2161\003\206\376\217\323\270\3671>0\341\206\240\232\263\027N\304r'\204l\"w\222\001\201"
+	.string	"\212"
+	.string	"\216"
+	.ascii	"\267\214a\274\345t<\020\034f\362\366$s\245z\2752\377\307\203"
+	.ascii	"v\027\3221\200{y\206~\367\246\r\230\301x\333:+\274\005? \274"
+	.ascii	"\345\035\263\225\002%`\232\230"
+	.string	"0\252\272\367\226-\203m\335=\264`\327\035\177\350\225\205\024\037J\342\241\f\332\323Ay\325\352\3309\bJ\b\3521\343I\257)\320\034\260\211\220\224\220h\257\366\215^\235\244\370\320\235Wq\302\275\227\253\017]q\026\317\314:f\3161\367N\234\362j\3730\377A\224\023\032\334=\314ce\322V\036/\364\213`eP\254\334a\345j+\037&\346\210\005\345^\025W^.\2245\202\203\017\344?\234\013\341\0179\021\0047\310&\246\240&\246\003#\306\333%%]+'U \365\373Q\325<^\257_\302\271\222\016L/:\240\350EoK\325-o\030o\273\304\213\177\304O\352\036R.\313T\206\361\266Z\275\370)\337\250zy\235\350E\273\007\271\231\300;qa\313\023\325\275)\203\260#Q`\037\35161`E\204\300\350Y\002z\b\311\246\025=\345\324.\177\322-\350\374\270P\215M\266\250\305\304\227\263\305\036\333"
+	.string	"S/\007\357w\013\205\207\310\337\342\250\007\212*Xn\277\351-\261\277\364\326\311\262+\321\311\374\334{\037\360\223\214"
+	.string	"\261`\312F\256ef\b\235\365\212\237\364Q\312GG\241B\244\324\355\303Hn\022L\335{\336\3077\362#9\276\215[\236\335\324\373n\302\333\007y.\306Y\255\370F\007w\360\260\200\242n\265\342\035\316\037\\\267\0202\234MI\253\315f5\363\300\314\305\2323\215\031!F\343"
+	.string	"B\314E"
+	.string	"6\223i\300\321`6\233\215I\262\351\372`\342fjn2\032\016f\2544c%M63+M\333\255t!\340Z\r\314V\342j5[I\246\347\273g\350\025\230@\235\315\253\021\266\217\323\301\2460\005\n\354\353\2708\353U"
+	.string	" \240\203\367\336k\005T\260\271\233[9M\202\231\315?\021\021\363\303\372\351\216q\252\375t)\337\025f\330\233\334\306\361\336[\233\025R\250a4\306\2202\310\220E3AS\230\344\200\002\021*;\017\020xG\223$\255\001\320\t%!c~\032\305q\331\207\334m\346!\005\277\205\241\227\203?ZBC\265{\236\361\300~\210\241\001\016B\264lDS\302\300\273\375>\r\341N\006btE\213\346\231ln\204\234y\370\215\361\263\303\212\271\025F\007\003=\031\302\247\212\326\2062\017\310\262\006\344\277\265-\034\331\242\212"
+	.ascii	" \024!\333y\242\351|\331\331\021\337\300\220\300\361\177%D\347"
+	.ascii	"}z\277\023C\231\250M\273c\255\260\006\300\2435\370\270\350\324"
+	.ascii	"]*\212t\267\303\024WV}\352\234G\005"
+	.text
+	.section	.gnu.lto_dispatchAdd.18.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375`J\004\335\035"
+	.string	"Fu\274I\240VN:\f\307"
+	.string	"\312\326\236\223\227\323@\271\0179\227g\f\3526\274\220[\240\275\224c-\346\037P\202T\326\371Z\321gy\037\312\177\333\231\327\002\236\234'F\21388k$G\274\022>\307\3265\231fmkd\023\271S\n\242"
+	.string	"\235"
+	.string	"\252"
+	.ascii	"d%b\001\212\214C\355tz\331\330T>\234\340\212\013O\314\304j-:"
+	.ascii	"8\365\006O!6\263x!F\227r\022\003\250\325\306\223\255Z\353\003"
+	.ascii	"c\250\235\322\2203\210\315\247}\250\023\215\036\365\273\200Z"
+	.ascii	"\233\260\266j->\260\203\332\251\213\307\225\247\265\317\224\247"
+	.ascii	"6\262\255\030Pq\263\2224\204\254\326\232[\034&\247\321KJ\356"
+	.ascii	"4\362\013\034\205\303\024/m\303\340\244\344J\031\275\002\f\221"
+	.ascii	"\310\n\304'\247\033?\225"
+	.string	"\206*&\371c\351{\343\031\340\370\022\016\227>i8\265VO\341\320\305M\273m\"\333(lRCG\333v.9\226\364\0058\217\0060\355\336\210y\341\367\004SpS\030\207\005\254\3163\273\030\234{\303\376\r\030\023\035\336&{N\317\310\224\3231\217\372a^u\337.\365\333h\345t\371i\372i\362T\367\226\323\263\234\376\200\230-\004\216\265\2668v\251P(W\217S\375U\276\325\267l\233\211N\304/r#\r\2106\255,\242V\026\202\237\217uUDsT\\ E\f\212l\201\330\220\363XD\277*\"\213u835#i\211\354\324\036nEd\333N\377!7\3326\213\330\330UE\001\307:\315W\321\200\260Z\353\215\202\260r\033\020\313\242\200\363\370(U\244\256\350\336pyEke\226\232M\203\360Q >\321V\311\\'\327\304\024\225\243if\277\013\350W#\367N\224d\334\370Z\031\027\332\342"
+	.ascii	"\311Zk%e\366T\217\300\004d\242\023 Lh\353\276\204w\204\204\b"
+	.ascii	"\234\314\336\211\360\005\257l\255h4)Y\343\270\\\211OAX\255\300"
+	.ascii	"\013\375\256{\375\f\3027/\364\225\247\247z\016\023n\314\3469"
+	.ascii	"\222\242Z\255\365\306?\262\023\001\223\203\307\257<M0%\006N\313"
+	.ascii	"m_u\032\340<\363\334\357m?\206T#8\003\037\356\0205B=<CD\271\237"
+	.ascii	"\236\217OO\207@\347=<C?\035v\274\033\320\205:\370tzx;\232w\272"
+	.ascii	"\t;;\b\022vj\n\370\202\206~x\324\272\232\020\272!\035 !\236]"
+	.ascii	"\216n'\247\333\311\375\360\350\370\344tAB\271\232\004\356\001"
+	.ascii	"\361\202rC\275^P\316V\004\3568\245\255I\222\266\273J\223\222"
+	.ascii	"[^\211\"\317u\272J\364\b\005\270A\303\254\337U\3427\303nN3\274"
+	.ascii	"\200\321\005\343\315,a\226\263\035eN9\263&\246\232\034M\263\337"
+	.ascii	"\370\f=|\224\211\305\354\314\322\306\222\276\334\266\334\230"
+	.ascii	"=\220\205\344#\270u\372e\343F~\030UO,\234\264h\225\033X\250Q"
+	.ascii	"$i\224Q\b!4\201H@4-h\003`\002\221)\274\016\020Xjh\222\264\006"
+	.ascii	"\227\300\255\n\t\030\313l\206\224H\007\230[5\266\246\003\324"
+	.ascii	"S\203\036\227\"\252\200\271\315\020d\242J\320\375\211#\f\326"
+	.ascii	"\212TR|f\252\177\034f\3478\262=Yy\220\306\310\216[\326\315\013"
+	.ascii	"\316\036\031\201A\030?\372SD-\255\322S\177\320\246D\354n`\355"
+	.ascii	"\230\217x\200\302\255\272\241Wt\fo\247\005\203\036I3\200\342"
+	.ascii	"e\265\335\207\377\337jU\264\2014e\272\302d\202\315\242\007\211"
+	.ascii	"\007\213\\$\234i \316\232\214\231ew\241@f\270\265\216?\216\201"
+	.ascii	"\210]\032\003\201\257\307/_%N\360\234\036\362\254\013e\036\357"
+	.ascii	":\031\247\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375 \244e\003"
+	.string	"d\005\240"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\017\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\016\r\200\204\001"
+	.string	""
+	.string	"\003\002\020\177\016\002\021\177\017\252\333\3426\r\020\022\177\021\001\023\177\022\377\037"
+	.string	""
+	.string	"\200\200\200\004\003\330\244\235\311\003\001\325\013\003\005\006\252\333\3426\001D"
+	.string	"\007"
+	.ascii	"v\b\375\3522\\\366\206J\016dm+$\212\320J\017"
+	.text
+	.section	.gnu.lto_.refs.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\002"
+	.string	"\001\002\001\001\002"
+	.string	"\002\003\001\004\023"
+	.string	""
+	.string	"\004\030"
+	.string	"\001\005\002\004\016"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.32924b03ffe2df8b,"e",@progbits
+	.string	"(\265/\375`\372\bE2"
+	.string	"zY\234\023F`\336U\007\245\016\367v\016|\235\275\221Z\344b\264\tg.08A\210\255q&~\367v\213\364\267\305\360\rh\354\037"
+	.string	"\220z\352\b5\221\206=Xy\240H']\300U\310,\340[#\216H\037g\323\377\3762\245\t\001)\001%\001.u.M\346\363_\004@\016\222\"S\314\366\231O\273;\227B\206\233<\355r\253\330T\nf\245\336\345\\\371\211z\2164\334)\314\266\257\355\021\255_\361\250Ku\236\245\035\352U:\207\314\017\375\317A91\263\033Q\3146\210\326\207\327\216\245\013`}R\013h\333u\270 \327\341\272m\023\270"
+	.ascii	"\034\353\001pBSt?u\304\216L\260\224n\327\362'\376\264\275T\316"
+	.ascii	"\217\376\347!\036\255/YQ\314\372\023{\024\317\355O\207\322HI"
+	.ascii	"\355\203\374'\377\331\237\354\277\321]\001\220\273\202\033u\210"
+	.ascii	"\221\n\216m\334vv\001\270\326\003\340\322\234g\250\333\317\272"
+	.ascii	"\273Kw\207\351n\257ng\0318N\250\333\313\214\211a\273\275\253"
+	.ascii	"\273\325\272\033\255\273\315\272\273\254\273\307\272{Mw\247\351"
+	.ascii	"n/\335\035\326\335`\335\035\245\273\263tw\210\356\266vw\231\356"
+	.ascii	"\256v7\231\356\226\322\335\271\273\003t\367\230\356\276\255\255"
+	.ascii	"\255\255u{Q\267\347\350\346\331\005:Z\244\223\371~9\231B/\324"
+	.ascii	"\310|\221X\314\241\246\220\036\315)\253\265\210\303y\221\017"
+	.ascii	"#\3314.\205\252ov\276\232\177\217J\375r\301\177\323\271Tc\254"
+	.ascii	"\341\323c\025\306q\313\350\364\374\377\004\222\307,\347#\253"
+	.ascii	"\257\022\347\277\222\343\323'%\270\271\372?\274\352\356h>\225"
+	.ascii	"\324\177\201\317\377\311\177\327\277\372\377\356\377\363,\233"
+	.ascii	"\371\377J\3505\222L\376[\021%\277\351n\221\372\307Q6S\346\013"
+	.ascii	"\315r\036m\261\0025\362-\262\353F^\r\326\262\205\272R\236\352"
+	.ascii	"\377\335\2545\302\224\021\307\f\025\350\271\034\311\326\260\034"
+	.ascii	"SY\005S\246\352V\300\304hU{\332T\r\271\206\221\251a\006\204\007"
+	.ascii	"f\301\210nB\256h^\244m\177\342^n\305\267\274\032\305\360\244"
+	.ascii	"\211S\t\343\323\242\343\313\001\315I\331\177\036\343_.\306\245"
+	.ascii	"\356\345\\\355_\034L\023\345\177\344\377w\204\356#/\327\342T"
+	.ascii	"[>\362\277#\b\220\221\352\342\306\365?7h@\324\300\026\247\r\220"
+	.ascii	"\267e\333\335\326\211\250^\200\336T\r\361\201Y\357\342p\304\250"
+	.ascii	"/0\333\305\266\333\267\004Mk\235v\264\037.&]\3260\353s\374\332"
+	.ascii	"\262Hs2\275\322\001*K\032\245\300\250\326\272\\4\225\235\261"
+	.ascii	"E\013\354J\353wx\016\307\335L\352f\036F\224"
+	.string	"?\306\020\312\324A\343)m\273\207\341\260\030\031\231\227\265\031\201\227\362\213\211\217\230\256\027\357\233\3662\326\314SL\315\026\216\2142\r\r\263\215\221\264\266\2526m|\314\307\264\374\334\310S3\\\352c7\253\022\"R\3146\316j1\f\236?\335\327H}\215?=\277r)\3122;h,\243\2655y~\306\321\264\213\265\230\247\311Y\275\215MT\371u}++\035\313\305uF\344\254=M7R\222?sG\222dQ\235i\273q7\356\215\313\377\217q\313\277<\372\264\337\334u\335?n\363\005o;0\366\177C\210\2346I\227\321\006f\273;\301wwSx\227\t\322\310\034\372\374\313\027\212\345\276U\254\314\241\374:\006<t\307\277\031\213\311:\037\177~\177$\026\363\304\233\235\3137;]\241G:\335\377\314\024z\243F\327_(\026\363\205:\231C\217|\367\241\306\375dD\204\002\026Q\354\202\302\250(a\257"
+	.ascii	"\017R\004\023Q\275[?\031E\375\212\304\025\304\035q\370K\001\034"
+	.ascii	"\372\210\302a"
+	.string	"\017\030\205\363\371*\364\370\232~O,\221\370\353\t\207\037\200z\276\037\024\211\246`\006b\207\241\356\001\207\277\340\257D\333\022\224\036(-\251\340\351%\036\004\036\004\\/\361\216\216xJGm+\035\331\212\375T\324B\023\277\341\256(\024\016w=E\025\277 \333\013\242\320\340CdZ1,\0063\004\265E&\244\b\305 \020E\333\276\336\004'_\322\222\223\321\200\2360\341B\002\021\0366\264=\243\247^\261\311\004\021\350c\3529\355zN\273 \260)j\327\033\022wF\006\240\200\305\240\b\337oE\023\324\317\347\003%\024Z`\272u7~\325\202\246p\220\331\301\254\315\307\032n\261\206\245r\356+{\3144\257\256\256oU\245\353\306nc)\314\002#\261Xa\301,6\342\243K\233\212\221\037\344?\300\270?\324Z\025<M\305\341\367\255\234\231+6i\350\264\330\311KKs5\237\362J\tZ4\344\\\377\255t"
+	.string	"\250\250^z\250\371\226\215\315\222j\221.-\026rv\346hd\312\257\253\355\032#\200\251\250\3010d\024DFdD&\020\231IR8\200\002\221\2513n\021\200\245\242Lj\322\224\266\016N\"h\251\361\247\243\306C\023\257@\314\002)\334\203(q\272\310\343>\344\220\222\001F\2471\020\342\031n\035u}\237\316\260(d\217=w\215\005\021\344\235Qr\007s\334\271"
+	.string	"k\342h\017\223g\003"
+	.string	"\327v\320g\006\013\363\264y\357\250\224\342\314\355*,\017\242o\365\311,\236w\224\233\323&S\035\325\200\351L\225\022\205\363\222\271T\261\345\234\3337\025\235\371\374\201\260\250\237\257\214\232\2718[6\312S\212j\301\b\216\365\376\236A>W+\311\275W\226\032\255u~\236L\266p2f\205\b\335q4\265\020Q<a\221\034R"
+	.string	"8\336I"
+	.ascii	"VK\234\332\326N\023I]\264\026$\246A}\366\201:\354\006\240N\220"
+	.ascii	"\n\344=\376\364a\322t\351K\246\334\005]\205\200\207\346\275q"
+	.ascii	"eh\273\351W\247%E\274q\371\177\303\233E8\341\323\017\226}\350"
+	.ascii	"\363'\202\262\363\256\304.\n\201\027s\377\242\021Oi\333\354\200"
+	.ascii	"\177\035\030\"\372O\033\360\317\237\3646y]^*\361\004<\311.r\261"
+	.ascii	"g\3717\342\"c\207.\376\n~\361\236\036w\030\244\276\213\245\261"
+	.ascii	"\335\341\231\\\337s>|\021\256\275\016U\003"
+	.text
+	.section	.gnu.lto_.symtab.32924b03ffe2df8b,"e",@progbits
+	.string	"dispatchIsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347"
+	.string	""
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.32924b03ffe2df8b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
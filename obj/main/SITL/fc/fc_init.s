@@ -0,0 +1,16739 @@
+	.file	"fc_init.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/color.h"
+	.file 5 "./src/main/flight/pid.h"
+	.file 6 "./src/main/drivers/io_types.h"
+	.file 7 "./src/main/drivers/system.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/drivers/light_led.h"
+	.file 10 "./src/main/drivers/pwm_output.h"
+	.file 11 "./src/main/fc/config.h"
+	.file 12 "./src/main/fc/fc_init.h"
+	.file 13 "./src/main/fc/rc_controls.h"
+	.file 14 "./src/main/fc/runtime_config.h"
+	.file 15 "./src/main/io/beeper.h"
+	.file 16 "./src/main/io/serial.h"
+	.file 17 "./src/main/io/ledstrip.h"
+	.file 18 "./src/main/io/osd.h"
+	.file 19 "./src/main/scheduler/scheduler.h"
+	.file 20 "./src/main/sensors/sensors.h"
+	.file 21 "./src/main/sensors/boardalignment.h"
+	.file 22 "./src/main/flight/mixer.h"
+	.file 23 "./src/main/flight/servos.h"
+	.file 24 "./src/main/build/debug.h"
+	.file 25 "./src/main/build/profile.h"
+	.file 26 "./src/main/fc/fc_init.c"
+	.file 27 "./src/main/fc/fc_tasks.h"
+	.file 28 "./src/main/sensors/battery.h"
+	.file 29 "./src/main/drivers/timer.h"
+	.file 30 "./src/main/sensors/gyro.h"
+	.file 31 "./src/main/sensors/barometer.h"
+	.file 32 "./src/main/sensors/acceleration.h"
+	.file 33 "./src/main/telemetry/telemetry.h"
+	.file 34 "./src/main/rx/rx.h"
+	.file 35 "./src/main/flight/failsafe.h"
+	.file 36 "./src/main/fc/cli.h"
+	.file 37 "./src/main/msp/msp_serial.h"
+	.file 38 "./src/main/fc/fc_msp.h"
+	.file 39 "./src/main/flight/imu.h"
+	.file 40 "./src/main/sensors/initialisation.h"
+	.file 41 "./src/main/config/feature.h"
+	.file 42 "./src/main/drivers/io.h"
+	.file 43 "./src/main/common/printf.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_init.c.51049c99
+	.weak	fc_init.c.51049c99
+fc_init.c.51049c99:
+	.long	0x104f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x15
+	.long	.LASF2392
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1980
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1981
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1982
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1983
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1984
+	.uleb128 0x3
+	.long	.LASF1986
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1985
+	.uleb128 0x3
+	.long	.LASF1987
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1988
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1989
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1990
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1991
+	.uleb128 0x3
+	.long	.LASF1992
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1993
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1994
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x3
+	.long	.LASF1995
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1996
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1997
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x15
+	.byte	0xe
+	.long	0xef
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2013
+	.byte	0x4
+	.byte	0x4
+	.byte	0x34
+	.long	0x11d
+	.uleb128 0xe
+	.string	"h"
+	.byte	0x4
+	.byte	0x35
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0xe
+	.string	"s"
+	.byte	0x4
+	.byte	0x36
+	.byte	0xd
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0xe
+	.string	"v"
+	.byte	0x4
+	.byte	0x37
+	.byte	0xd
+	.long	0x9d
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2001
+	.byte	0x4
+	.byte	0x38
+	.byte	0x3
+	.long	0xef
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x23
+	.byte	0xe
+	.long	0x179
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0xa
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2014
+	.byte	0x4c
+	.byte	0x5
+	.byte	0x3c
+	.long	0x2a1
+	.uleb128 0xe
+	.string	"P8"
+	.byte	0x5
+	.byte	0x3d
+	.byte	0xd
+	.long	0x2a1
+	.byte	0
+	.uleb128 0xe
+	.string	"I8"
+	.byte	0x5
+	.byte	0x3e
+	.byte	0xd
+	.long	0x2a1
+	.byte	0xa
+	.uleb128 0xe
+	.string	"D8"
+	.byte	0x5
+	.byte	0x3f
+	.byte	0xd
+	.long	0x2a1
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2015
+	.byte	0x5
+	.byte	0x41
+	.byte	0xd
+	.long	0x9d
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2016
+	.byte	0x5
+	.byte	0x42
+	.byte	0xe
+	.long	0xa9
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2017
+	.byte	0x5
+	.byte	0x43
+	.byte	0xe
+	.long	0xa9
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2018
+	.byte	0x5
+	.byte	0x44
+	.byte	0xe
+	.long	0xa9
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2019
+	.byte	0x5
+	.byte	0x45
+	.byte	0xe
+	.long	0xa9
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2020
+	.byte	0x5
+	.byte	0x46
+	.byte	0xd
+	.long	0x9d
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2021
+	.byte	0x5
+	.byte	0x47
+	.byte	0xb
+	.long	0xc8
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2022
+	.byte	0x5
+	.byte	0x48
+	.byte	0xb
+	.long	0xc8
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2023
+	.byte	0x5
+	.byte	0x49
+	.byte	0xd
+	.long	0x9d
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2024
+	.byte	0x5
+	.byte	0x4a
+	.byte	0xd
+	.long	0x9d
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF2025
+	.byte	0x5
+	.byte	0x4b
+	.byte	0xd
+	.long	0x9d
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2026
+	.byte	0x5
+	.byte	0x4c
+	.byte	0xd
+	.long	0x9d
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF2027
+	.byte	0x5
+	.byte	0x4d
+	.byte	0xd
+	.long	0x9d
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2028
+	.byte	0x5
+	.byte	0x50
+	.byte	0xe
+	.long	0xa9
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2029
+	.byte	0x5
+	.byte	0x51
+	.byte	0xb
+	.long	0xc8
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2030
+	.byte	0x5
+	.byte	0x52
+	.byte	0xd
+	.long	0x9d
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2031
+	.byte	0x5
+	.byte	0x53
+	.byte	0xd
+	.long	0x9d
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF2032
+	.byte	0x5
+	.byte	0x54
+	.byte	0xb
+	.long	0xc8
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2033
+	.byte	0x5
+	.byte	0x55
+	.byte	0xb
+	.long	0xc8
+	.byte	0x48
+	.byte	0
+	.uleb128 0xf
+	.long	0x9d
+	.long	0x2b1
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2034
+	.byte	0x5
+	.byte	0x56
+	.byte	0x3
+	.long	0x179
+	.uleb128 0xc
+	.long	0x2b1
+	.uleb128 0x3
+	.long	.LASF2035
+	.byte	0x6
+	.byte	0x18
+	.byte	0x11
+	.long	0x9d
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xe
+	.long	0x306
+	.uleb128 0x1
+	.long	.LASF2036
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2037
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2038
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2039
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2040
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2042
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2043
+	.byte	0x7
+	.byte	0x27
+	.byte	0x3
+	.long	0x2ce
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x14
+	.byte	0xe
+	.long	0x43a
+	.uleb128 0x1
+	.long	.LASF2044
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2045
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2046
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2047
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2048
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2050
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2051
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2052
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2053
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2054
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2055
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2056
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2057
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2058
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2059
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2060
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2061
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2062
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2063
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2064
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2065
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2066
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2067
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2068
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2069
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2070
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2071
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2072
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2073
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2075
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2079
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2080
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2081
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2082
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2083
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2084
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2085
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2086
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2087
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2088
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2089
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2090
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2091
+	.byte	0x4
+	.byte	0x9
+	.byte	0x19
+	.long	0x461
+	.uleb128 0x2
+	.long	.LASF2092
+	.byte	0x9
+	.byte	0x1a
+	.byte	0xd
+	.long	0x461
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2093
+	.byte	0x9
+	.byte	0x1b
+	.byte	0xd
+	.long	0x9d
+	.byte	0x3
+	.byte	0
+	.uleb128 0xf
+	.long	0x2c2
+	.long	0x471
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2094
+	.byte	0x9
+	.byte	0x1c
+	.byte	0x3
+	.long	0x43a
+	.uleb128 0xc
+	.long	0x471
+	.uleb128 0x8
+	.long	.LASF2143
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x471
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x22
+	.byte	0xe
+	.long	0x4c0
+	.uleb128 0x1
+	.long	.LASF2095
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0x5
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2101
+	.byte	0x12
+	.byte	0xa
+	.byte	0x8d
+	.long	0x51b
+	.uleb128 0x2
+	.long	.LASF2102
+	.byte	0xa
+	.byte	0x8e
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2103
+	.byte	0xa
+	.byte	0x8f
+	.byte	0xd
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2104
+	.byte	0xa
+	.byte	0x90
+	.byte	0xd
+	.long	0x9d
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2105
+	.byte	0xa
+	.byte	0x91
+	.byte	0xd
+	.long	0x9d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2106
+	.byte	0xa
+	.byte	0x92
+	.byte	0xd
+	.long	0x9d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2107
+	.byte	0xa
+	.byte	0x93
+	.byte	0xd
+	.long	0x51b
+	.byte	0x6
+	.byte	0
+	.uleb128 0xf
+	.long	0x2c2
+	.long	0x52b
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2108
+	.byte	0xa
+	.byte	0x94
+	.byte	0x3
+	.long	0x4c0
+	.uleb128 0xc
+	.long	0x52b
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x23
+	.byte	0xe
+	.long	0x61a
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0x80
+	.uleb128 0x11
+	.long	.LASF2116
+	.value	0x100
+	.uleb128 0x11
+	.long	.LASF2117
+	.value	0x200
+	.uleb128 0x11
+	.long	.LASF2118
+	.value	0x400
+	.uleb128 0x11
+	.long	.LASF2119
+	.value	0x1000
+	.uleb128 0x11
+	.long	.LASF2120
+	.value	0x2000
+	.uleb128 0x11
+	.long	.LASF2121
+	.value	0x4000
+	.uleb128 0x11
+	.long	.LASF2122
+	.value	0x8000
+	.uleb128 0x9
+	.long	.LASF2123
+	.long	0x10000
+	.uleb128 0x9
+	.long	.LASF2124
+	.long	0x20000
+	.uleb128 0x9
+	.long	.LASF2125
+	.long	0x40000
+	.uleb128 0x9
+	.long	.LASF2126
+	.long	0x80000
+	.uleb128 0x9
+	.long	.LASF2127
+	.long	0x100000
+	.uleb128 0x9
+	.long	.LASF2128
+	.long	0x200000
+	.uleb128 0x9
+	.long	.LASF2129
+	.long	0x400000
+	.uleb128 0x9
+	.long	.LASF2130
+	.long	0x800000
+	.uleb128 0x9
+	.long	.LASF2131
+	.long	0x1000000
+	.uleb128 0x9
+	.long	.LASF2132
+	.long	0x2000000
+	.uleb128 0x9
+	.long	.LASF2133
+	.long	0x4000000
+	.uleb128 0x9
+	.long	.LASF2134
+	.long	0x8000000
+	.uleb128 0x9
+	.long	.LASF2135
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2136
+	.byte	0x15
+	.byte	0xb
+	.byte	0x43
+	.long	0x668
+	.uleb128 0x2
+	.long	.LASF2137
+	.byte	0xb
+	.byte	0x44
+	.byte	0xd
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2138
+	.byte	0xb
+	.byte	0x45
+	.byte	0xd
+	.long	0x9d
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2139
+	.byte	0xb
+	.byte	0x46
+	.byte	0xd
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2140
+	.byte	0xb
+	.byte	0x47
+	.byte	0xd
+	.long	0x9d
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2141
+	.byte	0xb
+	.byte	0x48
+	.byte	0xa
+	.long	0x668
+	.byte	0x4
+	.byte	0
+	.uleb128 0xf
+	.long	0x8a
+	.long	0x678
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2142
+	.byte	0xb
+	.byte	0x49
+	.byte	0x3
+	.long	0x61a
+	.uleb128 0xc
+	.long	0x678
+	.uleb128 0x8
+	.long	.LASF2144
+	.byte	0xb
+	.byte	0x4b
+	.byte	0x17
+	.long	0x678
+	.uleb128 0x8
+	.long	.LASF2145
+	.byte	0xb
+	.byte	0x56
+	.byte	0x1d
+	.long	0x6a1
+	.uleb128 0xa
+	.long	0x179
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x14
+	.byte	0xe
+	.long	0x6d8
+	.uleb128 0x1
+	.long	.LASF2146
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2147
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2148
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2149
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2150
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2151
+	.byte	0x80
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2152
+	.byte	0xc
+	.byte	0x1d
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x7
+	.long	.LASF2153
+	.byte	0x8
+	.byte	0xd
+	.byte	0xa7
+	.long	0x725
+	.uleb128 0x2
+	.long	.LASF2154
+	.byte	0xd
+	.byte	0xa8
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2155
+	.byte	0xd
+	.byte	0xa9
+	.byte	0xe
+	.long	0xa9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2156
+	.byte	0xd
+	.byte	0xaa
+	.byte	0xe
+	.long	0xa9
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2157
+	.byte	0xd
+	.byte	0xab
+	.byte	0xe
+	.long	0xa9
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2158
+	.byte	0xd
+	.byte	0xac
+	.byte	0x3
+	.long	0x6e4
+	.uleb128 0xc
+	.long	0x725
+	.uleb128 0x8
+	.long	.LASF2159
+	.byte	0xd
+	.byte	0xae
+	.byte	0x19
+	.long	0x725
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x15
+	.byte	0xe
+	.long	0x768
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2162
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2163
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2164
+	.byte	0xe
+	.byte	0x1c
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x36
+	.byte	0xe
+	.long	0x7a0
+	.uleb128 0x1
+	.long	.LASF2165
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2166
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2167
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2169
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2170
+	.byte	0xe
+	.byte	0x42
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x17
+	.byte	0xe
+	.long	0x83e
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2188
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2189
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2190
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0x15
+	.byte	0
+	.uleb128 0x5
+	.byte	0x5
+	.long	0x70
+	.byte	0x10
+	.byte	0x47
+	.byte	0xe
+	.long	0x894
+	.uleb128 0x17
+	.long	.LASF2193
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2203
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2204
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2205
+	.byte	0x10
+	.byte	0x54
+	.byte	0x3
+	.long	0x83e
+	.uleb128 0x7
+	.long	.LASF2206
+	.byte	0xc
+	.byte	0x10
+	.byte	0x69
+	.long	0x8fb
+	.uleb128 0x2
+	.long	.LASF2207
+	.byte	0x10
+	.byte	0x6a
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2208
+	.byte	0x10
+	.byte	0x6b
+	.byte	0x1c
+	.long	0x894
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2209
+	.byte	0x10
+	.byte	0x6c
+	.byte	0xd
+	.long	0x9d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2210
+	.byte	0x10
+	.byte	0x6d
+	.byte	0xd
+	.long	0x9d
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2211
+	.byte	0x10
+	.byte	0x6e
+	.byte	0xd
+	.long	0x9d
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2212
+	.byte	0x10
+	.byte	0x6f
+	.byte	0xd
+	.long	0x9d
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2213
+	.byte	0x10
+	.byte	0x70
+	.byte	0x3
+	.long	0x8a0
+	.uleb128 0x7
+	.long	.LASF2214
+	.byte	0x64
+	.byte	0x10
+	.byte	0x72
+	.long	0x93b
+	.uleb128 0x2
+	.long	.LASF2215
+	.byte	0x10
+	.byte	0x73
+	.byte	0x18
+	.long	0x940
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2216
+	.byte	0x10
+	.byte	0x74
+	.byte	0xe
+	.long	0xa9
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2217
+	.byte	0x10
+	.byte	0x75
+	.byte	0xd
+	.long	0x9d
+	.byte	0x62
+	.byte	0
+	.uleb128 0xc
+	.long	0x907
+	.uleb128 0xf
+	.long	0x8fb
+	.long	0x950
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2218
+	.byte	0x10
+	.byte	0x76
+	.byte	0x3
+	.long	0x907
+	.uleb128 0xc
+	.long	0x950
+	.uleb128 0x8
+	.long	.LASF2219
+	.byte	0x10
+	.byte	0x78
+	.byte	0x17
+	.long	0x950
+	.uleb128 0x7
+	.long	.LASF2220
+	.byte	0x6
+	.byte	0x11
+	.byte	0x7c
+	.long	0x987
+	.uleb128 0x2
+	.long	.LASF2221
+	.byte	0x11
+	.byte	0x7d
+	.byte	0xd
+	.long	0x987
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x9d
+	.long	0x997
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2222
+	.byte	0x11
+	.byte	0x7e
+	.byte	0x3
+	.long	0x96d
+	.uleb128 0xc
+	.long	0x997
+	.uleb128 0x7
+	.long	.LASF2223
+	.byte	0xb
+	.byte	0x11
+	.byte	0x80
+	.long	0x9c2
+	.uleb128 0x2
+	.long	.LASF2221
+	.byte	0x11
+	.byte	0x81
+	.byte	0xd
+	.long	0x9c2
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x9d
+	.long	0x9d2
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2224
+	.byte	0x11
+	.byte	0x82
+	.byte	0x3
+	.long	0x9a8
+	.uleb128 0x13
+	.long	.LASF2225
+	.byte	0x11
+	.byte	0x99
+	.byte	0xd
+	.long	0x9ea
+	.uleb128 0xa
+	.long	0x11d
+	.uleb128 0x13
+	.long	.LASF2226
+	.byte	0x11
+	.byte	0x9a
+	.byte	0x1b
+	.long	0x9fb
+	.uleb128 0xa
+	.long	0x9a3
+	.uleb128 0x13
+	.long	.LASF2227
+	.byte	0x11
+	.byte	0x9b
+	.byte	0x17
+	.long	0x9d2
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0x12
+	.byte	0x1c
+	.byte	0xe
+	.long	0xab6
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2230
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2231
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2242
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2245
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x19
+	.byte	0
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0x13
+	.byte	0x3c
+	.byte	0xe
+	.long	0xb30
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2269
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2270
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2271
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0x14
+	.byte	0x14
+	.byte	0xe
+	.long	0xb5c
+	.uleb128 0x1
+	.long	.LASF2272
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2273
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2277
+	.byte	0xc
+	.byte	0x15
+	.byte	0x16
+	.long	0xb90
+	.uleb128 0x2
+	.long	.LASF2278
+	.byte	0x15
+	.byte	0x17
+	.byte	0xd
+	.long	0x91
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2279
+	.byte	0x15
+	.byte	0x18
+	.byte	0xd
+	.long	0x91
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2280
+	.byte	0x15
+	.byte	0x19
+	.byte	0xd
+	.long	0x91
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2281
+	.byte	0x15
+	.byte	0x1a
+	.byte	0x3
+	.long	0xb5c
+	.uleb128 0xc
+	.long	0xb90
+	.uleb128 0x8
+	.long	.LASF2282
+	.byte	0x15
+	.byte	0x1c
+	.byte	0x19
+	.long	0xb90
+	.uleb128 0x18
+	.long	.LASF2311
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x16
+	.byte	0x36
+	.byte	0xe
+	.long	0xc5c
+	.uleb128 0x1
+	.long	.LASF2283
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2284
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2295
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2296
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2300
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2309
+	.byte	0x16
+	.byte	0x52
+	.byte	0x3
+	.long	0xbad
+	.uleb128 0x7
+	.long	.LASF2310
+	.byte	0x2
+	.byte	0x16
+	.byte	0x65
+	.long	0xc8f
+	.uleb128 0x2
+	.long	.LASF2311
+	.byte	0x16
+	.byte	0x66
+	.byte	0xd
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2312
+	.byte	0x16
+	.byte	0x67
+	.byte	0x9
+	.long	0xc1
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2313
+	.byte	0x16
+	.byte	0x68
+	.byte	0x3
+	.long	0xc68
+	.uleb128 0xc
+	.long	0xc8f
+	.uleb128 0x8
+	.long	.LASF2314
+	.byte	0x16
+	.byte	0x6a
+	.byte	0x16
+	.long	0xc8f
+	.uleb128 0x7
+	.long	.LASF2315
+	.byte	0x20
+	.byte	0x16
+	.byte	0x6c
+	.long	0xd07
+	.uleb128 0xe
+	.string	"dev"
+	.byte	0x16
+	.byte	0x6d
+	.byte	0x16
+	.long	0x52b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2316
+	.byte	0x16
+	.byte	0x6e
+	.byte	0xb
+	.long	0xc8
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2317
+	.byte	0x16
+	.byte	0x6f
+	.byte	0xe
+	.long	0xa9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2318
+	.byte	0x16
+	.byte	0x70
+	.byte	0xe
+	.long	0xa9
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2319
+	.byte	0x16
+	.byte	0x71
+	.byte	0xe
+	.long	0xa9
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2320
+	.byte	0x16
+	.byte	0x72
+	.byte	0xd
+	.long	0x9d
+	.byte	0x1e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2321
+	.byte	0x16
+	.byte	0x73
+	.byte	0x3
+	.long	0xcac
+	.uleb128 0xc
+	.long	0xd07
+	.uleb128 0x8
+	.long	.LASF2322
+	.byte	0x16
+	.byte	0x75
+	.byte	0x16
+	.long	0xd07
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0x17
+	.byte	0x19
+	.byte	0x6
+	.long	0xd8c
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0xe
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2338
+	.byte	0x17
+	.byte	0x29
+	.byte	0x3
+	.long	0xd24
+	.uleb128 0x8
+	.long	.LASF2339
+	.byte	0x18
+	.byte	0x16
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x5
+	.byte	0x7
+	.long	0x30
+	.byte	0x19
+	.byte	0x25
+	.byte	0xe
+	.long	0xde2
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0x15
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2348
+	.byte	0x1a
+	.byte	0x8b
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x19
+	.long	0x6d8
+	.byte	0x1a
+	.byte	0x91
+	.byte	0x9
+	.uleb128 0x4
+	.long	.LASF2349
+	.byte	0x1b
+	.byte	0x16
+	.uleb128 0x4
+	.long	.LASF2350
+	.byte	0x1c
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF2351
+	.byte	0x1d
+	.byte	0xb3
+	.uleb128 0xb
+	.long	.LASF2353
+	.byte	0x1f
+	.byte	0x35
+	.long	0xe1c
+	.uleb128 0x6
+	.long	0xa9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2352
+	.byte	0x1e
+	.byte	0x56
+	.uleb128 0xb
+	.long	.LASF2354
+	.byte	0x20
+	.byte	0x4c
+	.long	0xe34
+	.uleb128 0x6
+	.long	0xa9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2355
+	.byte	0x21
+	.byte	0x3d
+	.uleb128 0x4
+	.long	.LASF2356
+	.byte	0x22
+	.byte	0xa6
+	.uleb128 0x4
+	.long	.LASF2357
+	.byte	0x23
+	.byte	0x4d
+	.uleb128 0xb
+	.long	.LASF2358
+	.byte	0x24
+	.byte	0x17
+	.long	0xe5a
+	.uleb128 0x6
+	.long	0xe5a
+	.byte	0
+	.uleb128 0xa
+	.long	0x93b
+	.uleb128 0x4
+	.long	.LASF2359
+	.byte	0x25
+	.byte	0x86
+	.uleb128 0x4
+	.long	.LASF2360
+	.byte	0x26
+	.byte	0x16
+	.uleb128 0x4
+	.long	.LASF2361
+	.byte	0x27
+	.byte	0x4b
+	.uleb128 0xb
+	.long	.LASF2362
+	.byte	0x5
+	.byte	0x76
+	.long	0xe85
+	.uleb128 0x6
+	.long	0xe85
+	.byte	0
+	.uleb128 0xa
+	.long	0x2bd
+	.uleb128 0x14
+	.long	.LASF2364
+	.byte	0xb
+	.byte	0x5c
+	.byte	0xa
+	.long	0xb5
+	.uleb128 0xb
+	.long	.LASF2363
+	.byte	0x7
+	.byte	0x2a
+	.long	0xea7
+	.uleb128 0x6
+	.long	0x306
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2365
+	.byte	0x28
+	.byte	0x14
+	.byte	0x5
+	.long	0xc1
+	.uleb128 0xb
+	.long	.LASF2366
+	.byte	0x15
+	.byte	0x1f
+	.long	0xec4
+	.uleb128 0x6
+	.long	0xec4
+	.byte	0
+	.uleb128 0xa
+	.long	0xb9c
+	.uleb128 0xb
+	.long	.LASF2367
+	.byte	0xa
+	.byte	0x96
+	.long	0xee4
+	.uleb128 0x6
+	.long	0xee4
+	.uleb128 0x6
+	.long	0xa9
+	.uleb128 0x6
+	.long	0x9d
+	.byte	0
+	.uleb128 0xa
+	.long	0x537
+	.uleb128 0x1a
+	.long	.LASF2368
+	.byte	0x16
+	.byte	0x7e
+	.byte	0x9
+	.long	0x9d
+	.long	0xefb
+	.uleb128 0x1b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2369
+	.byte	0x16
+	.byte	0x87
+	.uleb128 0xb
+	.long	.LASF2370
+	.byte	0x29
+	.byte	0x20
+	.long	0xf13
+	.uleb128 0x6
+	.long	0xb5
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2371
+	.byte	0x16
+	.byte	0x85
+	.long	0xf24
+	.uleb128 0x6
+	.long	0xc5c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2372
+	.byte	0x10
+	.byte	0x7f
+	.long	0xf3a
+	.uleb128 0x6
+	.long	0xc1
+	.uleb128 0x6
+	.long	0x894
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2393
+	.byte	0x29
+	.byte	0x1e
+	.byte	0x5
+	.long	0xc1
+	.long	0xf50
+	.uleb128 0x6
+	.long	0xb5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2373
+	.byte	0x1d
+	.byte	0xb2
+	.uleb128 0xb
+	.long	.LASF2374
+	.byte	0x7
+	.byte	0x19
+	.long	0xf68
+	.uleb128 0x6
+	.long	0xb5
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2375
+	.byte	0x9
+	.byte	0x3f
+	.long	0xf79
+	.uleb128 0x6
+	.long	0xf79
+	.byte	0
+	.uleb128 0xa
+	.long	0x47d
+	.uleb128 0x4
+	.long	.LASF2376
+	.byte	0x29
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF2377
+	.byte	0xb
+	.byte	0x63
+	.uleb128 0x4
+	.long	.LASF2378
+	.byte	0xb
+	.byte	0x65
+	.uleb128 0x4
+	.long	.LASF2379
+	.byte	0xb
+	.byte	0x61
+	.uleb128 0x4
+	.long	.LASF2380
+	.byte	0x2a
+	.byte	0x72
+	.uleb128 0x4
+	.long	.LASF2381
+	.byte	0x19
+	.byte	0x64
+	.uleb128 0x4
+	.long	.LASF2382
+	.byte	0x7
+	.byte	0x17
+	.uleb128 0x4
+	.long	.LASF2383
+	.byte	0x2b
+	.byte	0x79
+	.uleb128 0x1d
+	.long	.LASF2394
+	.byte	0x1a
+	.byte	0xa0
+	.byte	0x6
+	.long	0xfdd
+	.uleb128 0x1e
+	.long	.LASF2384
+	.byte	0x1a
+	.value	0x117
+	.byte	0xe
+	.long	0xa9
+	.uleb128 0x1f
+	.uleb128 0x20
+	.string	"i"
+	.byte	0x1a
+	.value	0x1a2
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2395
+	.byte	0x1a
+	.byte	0x93
+	.byte	0x6
+	.uleb128 0x12
+	.long	.LASF2385
+	.byte	0x16
+	.byte	0x75
+	.byte	0x4d
+	.long	0xff1
+	.uleb128 0xa
+	.long	0xd13
+	.uleb128 0x12
+	.long	.LASF2386
+	.byte	0x16
+	.byte	0x6a
+	.byte	0x4d
+	.long	0x1002
+	.uleb128 0xa
+	.long	0xc9b
+	.uleb128 0x12
+	.long	.LASF2387
+	.byte	0x15
+	.byte	0x1c
+	.byte	0x56
+	.long	0xec4
+	.uleb128 0x12
+	.long	.LASF2388
+	.byte	0x10
+	.byte	0x78
+	.byte	0x50
+	.long	0x101f
+	.uleb128 0xa
+	.long	0x95c
+	.uleb128 0x12
+	.long	.LASF2389
+	.byte	0xd
+	.byte	0xae
+	.byte	0x56
+	.long	0x1030
+	.uleb128 0xa
+	.long	0x731
+	.uleb128 0x12
+	.long	.LASF2390
+	.byte	0xb
+	.byte	0x4b
+	.byte	0x50
+	.long	0x1041
+	.uleb128 0xa
+	.long	0x684
+	.uleb128 0x12
+	.long	.LASF2391
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x59
+	.long	0xf79
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 44 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 45 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 46 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2e
+	.file 47 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x30
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 49 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 50 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x32
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 53 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 55 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x37
+	.file 56 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 60 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 61 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 64 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 65 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x41
+	.file 66 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 67 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x43
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 68 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x44
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.file 69 "./src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x45
+	.file 70 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF949
+	.byte	0x4
+	.file 71 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF950
+	.byte	0x4
+	.file 72 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x48
+	.file 73 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.file 74 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 75 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2b
+	.file 76 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x6b
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 77 "./src/main/config/config_eeprom.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1023
+	.byte	0x4
+	.file 78 "./src/main/config/config_profile.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x29
+	.byte	0x4
+	.file 79 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 80 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x50
+	.file 81 "./src/main/drivers/display.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 82 "./src/main/cms/cms_types.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 83 "./src/main/drivers/nvic.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 84 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x54
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x7
+	.byte	0x4
+	.file 85 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x55
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.file 86 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x56
+	.file 87 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x57
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 88 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 89 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x1d
+	.file 90 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x4
+	.file 91 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1611
+	.byte	0x4
+	.file 92 "./src/main/drivers/serial_softserial.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1612
+	.byte	0x4
+	.file 93 "./src/main/drivers/serial_uart.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 94 "./src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x5e
+	.file 95 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5f
+	.byte	0x4
+	.file 96 "./src/main/drivers/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 97 "./src/main/drivers/compass.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1729
+	.byte	0x4
+	.file 98 "./src/main/drivers/pwm_esc_detect.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x62
+	.byte	0x4
+	.file 99 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 100 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x64
+	.byte	0x4
+	.file 101 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 102 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x66
+	.byte	0x4
+	.file 103 "./src/main/drivers/inverter.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x67
+	.byte	0x4
+	.file 104 "./src/main/drivers/flash_m25p16.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x68
+	.file 105 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x69
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1744
+	.byte	0x4
+	.file 106 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x6a
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 107 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x6b
+	.byte	0x4
+	.file 108 "./src/main/drivers/usb_io.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x6c
+	.byte	0x4
+	.file 109 "./src/main/drivers/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x6d
+	.byte	0x4
+	.file 110 "./src/main/drivers/vtx_soft_spi_rtc6705.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 111 "./src/main/drivers/cros_ec.h"
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x6f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0xb
+	.file 112 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x70
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1758
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x26
+	.file 113 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x71
+	.file 114 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x72
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1759
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1795
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 115 "./src/main/rx/spektrum.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0xf
+	.byte	0x4
+	.file 116 "./src/main/io/displayport_max7456.h"
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1837
+	.byte	0x4
+	.file 117 "./src/main/io/flashfs.h"
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0x75
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 118 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x76
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 119 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x57
+	.uleb128 0x77
+	.byte	0x4
+	.file 120 "./src/main/io/servos.h"
+	.byte	0x3
+	.uleb128 0x58
+	.uleb128 0x78
+	.byte	0x4
+	.file 121 "./src/main/io/gimbal.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x79
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1850
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5a
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 122 "./src/main/io/dashboard.h"
+	.byte	0x3
+	.uleb128 0x5b
+	.uleb128 0x7a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1895
+	.byte	0x4
+	.file 123 "./src/main/io/asyncfatfs/asyncfatfs.h"
+	.byte	0x3
+	.uleb128 0x5c
+	.uleb128 0x7b
+	.file 124 "./src/main/io/asyncfatfs/fat_standard.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7c
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x4
+	.file 125 "./src/main/io/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x5d
+	.uleb128 0x7d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 126 "./src/main/io/displayport_msp.h"
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x7e
+	.byte	0x4
+	.file 127 "./src/main/io/vtx.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x7f
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 128 "./src/main/io/vtx_smartaudio.h"
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x80
+	.byte	0x4
+	.file 129 "./src/main/io/vtx_tramp.h"
+	.byte	0x3
+	.uleb128 0x62
+	.uleb128 0x81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x64
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x66
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x67
+	.uleb128 0x1f
+	.file 130 "./src/main/drivers/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x82
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1933
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1934
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x68
+	.uleb128 0x1c
+	.file 131 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x83
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1935
+	.byte	0x4
+	.file 132 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x84
+	.file 133 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x85
+	.byte	0x4
+	.byte	0x4
+	.file 134 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x86
+	.file 135 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x87
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x69
+	.uleb128 0x15
+	.byte	0x4
+	.file 136 "./src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x6a
+	.uleb128 0x88
+	.byte	0x4
+	.file 137 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x6b
+	.uleb128 0x89
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6c
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6d
+	.uleb128 0x28
+	.byte	0x4
+	.file 138 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x6f
+	.uleb128 0x8a
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1943
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x71
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1944
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x73
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x74
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x75
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 139 "./src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x76
+	.uleb128 0x8b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF980
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF984
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF989
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1006
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1008
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1020
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.printf.h.116.a753cec148ebcb8ed2875a05d6351970,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1033
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1115
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.18.bfa4ba22e867d998ef89fe9a1289a151,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.66.d76eedfe5c71cf0694c9c8244006861c,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1130
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.nvic.h.6.efba2b2d501cb542ce721628ece555cb,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1176
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1178
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.113.4d5d0c05ce1a76c3b97be0da5de43ba3,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1191
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1199
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1217
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1229
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1597
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.23.95742be8daec10c1d662dd67b9ee58de,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1607
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1610
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_uart.h.26.d7df672ceb076edc577f28d9952e617b,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1719
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1728
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1731
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.20.3fbc07651975e7da62790503f08b4fe9,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1748
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_soft_spi_rtc6705.h.20.0fe44a751d263858d589f70b71f94368,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1757
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1785
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1794
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.27.07521096acbd1fc23b5da89615487a6f,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1803
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.spektrum.h.20.7eabd3dc96720430f10f642c53b6edaf,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1836
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.25.359084437f17de36ca02cf51c97a94fa,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1840
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1849
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.25.44d42bc8a2509f001b7da5aa9bee7ce3,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fat_standard.h.23.98e613171bbc330acb6e09557ea95570,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1916
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.23.dfeea95d53f02f32dbd532b1d756929b,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx.h.22.12f28c2beccab569593ab27679518da5,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.50.10d0067a73777b2d14d79db5df156f88,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1929
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1932
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.31.3b5d682359a370a2ebd4f23a79bccb6b,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1942
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1952
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.8362794d947c339e17997ec0162d97db,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1961
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.66.6f7d1d067dff5370bea805da42b83f88,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1972
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1977
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.profile.h.48.b5d3bdbbb4f3d375ccee68ec649323aa,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1979
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x19
+	.long	.LASF1
+	.long	.LASF2396
+	.long	.LASF2397
+	.long	.LASF2398
+	.long	.LASF2399
+	.long	.LASF2400
+	.long	.LASF2401
+	.long	.LASF2402
+	.long	.LASF2403
+	.long	.LASF2404
+	.long	.LASF2405
+	.long	.LASF2406
+	.long	.LASF2407
+	.long	.LASF2408
+	.long	.LASF2409
+	.long	.LASF2410
+	.long	.LASF2411
+	.long	.LASF2412
+	.long	.LASF2413
+	.long	.LASF2414
+	.long	.LASF2415
+	.long	.LASF2416
+	.long	.LASF2417
+	.long	.LASF2418
+	.long	.LASF2419
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x8c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2420
+	.byte	0x14
+	.long	.LASF2421
+	.byte	0x14
+	.long	.LASF2422
+	.byte	0x14
+	.long	.LASF2423
+	.byte	0x4
+	.long	.LASF2424
+	.byte	0x8
+	.long	.LASF2425
+	.byte	0x6
+	.long	.LASF2426
+	.byte	0x6
+	.long	.LASF2427
+	.byte	0x6
+	.long	.LASF2428
+	.byte	0x6
+	.long	.LASF2429
+	.byte	0x6
+	.long	.LASF2430
+	.byte	0x7
+	.long	.LASF2431
+	.byte	0x7
+	.long	.LASF2432
+	.byte	0x7
+	.long	.LASF2433
+	.byte	0x7
+	.long	.LASF2434
+	.byte	0xa
+	.long	.LASF2435
+	.byte	0xa
+	.long	.LASF2436
+	.byte	0xa
+	.long	.LASF2437
+	.byte	0xa
+	.long	.LASF2438
+	.byte	0xd
+	.long	.LASF2439
+	.byte	0xe
+	.long	.LASF2440
+	.byte	0xe
+	.long	.LASF2441
+	.byte	0x8
+	.long	.LASF2442
+	.byte	0x8
+	.long	.LASF2443
+	.byte	0x2
+	.long	.LASF2444
+	.byte	0x2
+	.long	.LASF2445
+	.byte	0x7
+	.long	.LASF2446
+	.byte	0x7
+	.long	.LASF2447
+	.byte	0xe
+	.long	.LASF2448
+	.byte	0x6
+	.long	.LASF2449
+	.byte	0xe
+	.long	.LASF2450
+	.byte	0xe
+	.long	.LASF2451
+	.byte	0xe
+	.long	.LASF2452
+	.byte	0x11
+	.long	.LASF2453
+	.byte	0xc
+	.long	.LASF2454
+	.byte	0x8
+	.long	.LASF2455
+	.byte	0x7
+	.long	.LASF2456
+	.byte	0xb
+	.long	.LASF2457
+	.byte	0x7
+	.long	.LASF2458
+	.byte	0x8
+	.long	.LASF2459
+	.byte	0xe
+	.long	.LASF2460
+	.byte	0x5
+	.long	.LASF2461
+	.byte	0x6
+	.long	.LASF2462
+	.byte	0x4
+	.long	.LASF2463
+	.byte	0x17
+	.long	.LASF2464
+	.byte	0x18
+	.long	.LASF2465
+	.byte	0x18
+	.long	.LASF2465
+	.byte	0x17
+	.long	.LASF2466
+	.byte	0x14
+	.long	.LASF2467
+	.byte	0x17
+	.long	.LASF2468
+	.byte	0x17
+	.long	.LASF2469
+	.byte	0x14
+	.long	.LASF2470
+	.byte	0x14
+	.long	.LASF2471
+	.byte	0x16
+	.long	.LASF2472
+	.byte	0x14
+	.long	.LASF2473
+	.byte	0x15
+	.long	.LASF2474
+	.byte	0x15
+	.long	.LASF2475
+	.byte	0x14
+	.long	.LASF2476
+	.byte	0x14
+	.long	.LASF2477
+	.byte	0x14
+	.long	.LASF2478
+	.byte	0x17
+	.long	.LASF2479
+	.byte	0x18
+	.long	.LASF2480
+	.byte	0x13
+	.long	.LASF2481
+	.byte	0x13
+	.long	.LASF2482
+	.byte	0x17
+	.long	.LASF2483
+	.byte	0x12
+	.long	.LASF2484
+	.byte	0x10
+	.long	.LASF2485
+	.byte	0xf
+	.long	.LASF2486
+	.byte	0x10
+	.long	.LASF2487
+	.byte	0x1
+	.long	.LASF2488
+	.byte	0x1
+	.long	.LASF2489
+	.byte	0x4
+	.long	.LASF2490
+	.byte	0x5
+	.long	.LASF2491
+	.byte	0x2
+	.long	.LASF2492
+	.byte	0x4
+	.long	.LASF2493
+	.byte	0x4
+	.long	.LASF2494
+	.byte	0x18
+	.long	.LASF2495
+	.byte	0x5
+	.long	.LASF2496
+	.byte	0x5
+	.long	.LASF2497
+	.byte	0x5
+	.long	.LASF2498
+	.byte	0x3
+	.long	.LASF2499
+	.byte	0x6
+	.long	.LASF2500
+	.byte	0x3
+	.long	.LASF2501
+	.byte	0x6
+	.long	.LASF2502
+	.byte	0x6
+	.long	.LASF2503
+	.byte	0x6
+	.long	.LASF2504
+	.byte	0x6
+	.long	.LASF2505
+	.byte	0x4
+	.long	.LASF2506
+	.byte	0x6
+	.long	.LASF2507
+	.byte	0x6
+	.long	.LASF2508
+	.byte	0x6
+	.long	.LASF2435
+	.byte	0x6
+	.long	.LASF2509
+	.byte	0x6
+	.long	.LASF2510
+	.byte	0x6
+	.long	.LASF2511
+	.byte	0x6
+	.long	.LASF2512
+	.byte	0x6
+	.long	.LASF2513
+	.byte	0x6
+	.long	.LASF2514
+	.byte	0x6
+	.long	.LASF2515
+	.byte	0x6
+	.long	.LASF2516
+	.byte	0x6
+	.long	.LASF2517
+	.byte	0x6
+	.long	.LASF2518
+	.byte	0x6
+	.long	.LASF2519
+	.byte	0x6
+	.long	.LASF2520
+	.byte	0x6
+	.long	.LASF2521
+	.byte	0x6
+	.long	.LASF2522
+	.byte	0x6
+	.long	.LASF2523
+	.byte	0x6
+	.long	.LASF2524
+	.byte	0x6
+	.long	.LASF2525
+	.byte	0x6
+	.long	.LASF2526
+	.byte	0x6
+	.long	.LASF2527
+	.byte	0x6
+	.long	.LASF2528
+	.byte	0x6
+	.long	.LASF2529
+	.byte	0x6
+	.long	.LASF2530
+	.byte	0xb
+	.long	.LASF2531
+	.byte	0x4
+	.long	.LASF2532
+	.byte	0xc
+	.long	.LASF2533
+	.byte	0xa
+	.long	.LASF2534
+	.byte	0xa
+	.long	.LASF2535
+	.byte	0xa
+	.long	.LASF2536
+	.byte	0xa
+	.long	.LASF2442
+	.byte	0xa
+	.long	.LASF2537
+	.byte	0xa
+	.long	.LASF2538
+	.byte	0xa
+	.long	.LASF2539
+	.byte	0x9
+	.long	.LASF2540
+	.byte	0x9
+	.long	.LASF2526
+	.byte	0xa
+	.long	.LASF2541
+	.byte	0xa
+	.long	.LASF2542
+	.byte	0xa
+	.long	.LASF2543
+	.byte	0xa
+	.long	.LASF2544
+	.byte	0xa
+	.long	.LASF2450
+	.byte	0x6
+	.long	.LASF2545
+	.byte	0x4
+	.long	.LASF2546
+	.byte	0xe
+	.long	.LASF2547
+	.byte	0xe
+	.long	.LASF2548
+	.byte	0xe
+	.long	.LASF2549
+	.byte	0xe
+	.long	.LASF2514
+	.byte	0xe
+	.long	.LASF2550
+	.byte	0xe
+	.long	.LASF2551
+	.byte	0xe
+	.long	.LASF2552
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1589:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1726:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF1766:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1778:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF988:
+	.string	"HSV_VALUE_MAX 255"
+.LASF1308:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1223:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF997:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1932:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1862:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF1999:
+	.string	"RGB_GREEN"
+.LASF2003:
+	.string	"PIDPITCH"
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1850:
+	.string	"GIMBAL_MODE_MAX (GIMBAL_MODE_MIXTILT)"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1113:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF2128:
+	.string	"FEATURE_TRANSPONDER"
+.LASF995:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1443:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF2217:
+	.string	"reboot_character"
+.LASF2246:
+	.string	"OSD_YAW_PIDS"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF1417:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_PPM"
+.LASF1363:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2220:
+	.string	"modeColorIndexes_s"
+.LASF2222:
+	.string	"modeColorIndexes_t"
+.LASF2109:
+	.string	"FEATURE_RX_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1593:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2361:
+	.string	"imuInit"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1387:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1492:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1320:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1612:
+	.string	"SOFTSERIAL_BUFFER_SIZE 256"
+.LASF1659:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1861:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF958:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1161:
+	.string	"NVIC_PRIO_SERIALUART8_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1986:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2277:
+	.string	"boardAlignment_s"
+.LASF1143:
+	.string	"NVIC_PRIO_SERIALUART2_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF1782:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1493:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1996:
+	.string	"_Bool"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1611:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1953:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1926:
+	.string	"SCHEDULER_HISTOGRAM_BUCKETS 16"
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1192:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1912:
+	.string	"FAT_FILE_ATTRIBUTE_ARCHIVE 0x20"
+.LASF2150:
+	.string	"SYSTEM_STATE_TRANSPONDER_ENABLED"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2052:
+	.string	"OWNER_ADC_CURR"
+.LASF764:
+	.string	"__need_size_t "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1580:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1453:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1445:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2389:
+	.string	"flight3DConfig"
+.LASF2002:
+	.string	"PIDROLL"
+.LASF1140:
+	.string	"NVIC_PRIO_SERIALUART1_TXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF1781:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF2149:
+	.string	"SYSTEM_STATE_MOTORS_READY"
+.LASF2180:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1007:
+	.string	"_STDARG_H "
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1725:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF1723:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF2350:
+	.string	"batteryInit"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1282:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1232:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF2287:
+	.string	"MIXER_GIMBAL"
+.LASF1516:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1462:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1481:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1666:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1789:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1221:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF1585:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2157:
+	.string	"deadband3d_throttle"
+.LASF2280:
+	.string	"yawDegrees"
+.LASF2395:
+	.string	"processLoopback"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1867:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF1071:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1281:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2009:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1557:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2261:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF2301:
+	.string	"MIXER_PPM_TO_SERVO"
+.LASF1532:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1429:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1035:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1620:
+	.string	"UART4_TX_BUFFER_SIZE 256"
+.LASF2049:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1256:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1561:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1534:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2118:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1402:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF2000:
+	.string	"RGB_BLUE"
+.LASF1994:
+	.string	"uint16_t"
+.LASF1285:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1595:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1734:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF1056:
+	.string	"PG_RX_CONFIG 24"
+.LASF2340:
+	.string	"PROFILE_GYRO_UPDATE"
+.LASF1355:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1524:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1415:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1125:
+	.string	"CLR_PRINTVALUE(p) { (p)->flags &= ~PRINT_VALUE; }"
+.LASF1503:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1624:
+	.string	"UART6_TX_BUFFER_SIZE 256"
+.LASF2331:
+	.string	"INPUT_RC_AUX1"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2333:
+	.string	"INPUT_RC_AUX3"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1614:
+	.string	"UART1_TX_BUFFER_SIZE 256"
+.LASF1404:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1292:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1133:
+	.string	"NVIC_PRIO_BARO_EXTI NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF1530:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1699:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1813:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1405:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1467:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1067:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1798:
+	.string	"MSP_PORT_OUTBUF_SIZE 256"
+.LASF1039:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1371:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2343:
+	.string	"PROFILE_HANDLE_BLACKBOX"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2322:
+	.string	"motorConfig_System"
+.LASF2326:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2215:
+	.string	"portConfigs"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1358:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1836:
+	.string	"SRXL_FRAME_SIZE_MAX (SPEK_FRAME_SIZE + SRXL_FRAME_OVERHEAD)"
+.LASF1018:
+	.string	"_VA_LIST_DEFINED "
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2335:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF2167:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2185:
+	.string	"BEEPER_READY_BEEP"
+.LASF1428:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF1352:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1619:
+	.string	"UART4_RX_BUFFER_SIZE 256"
+.LASF1436:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2054:
+	.string	"OWNER_ADC_RSSI"
+.LASF1762:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1548:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF998:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1826:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2011:
+	.string	"PIDVEL"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1408:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1628:
+	.string	"UART8_TX_BUFFER_SIZE 256"
+.LASF1075:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1680:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1755:
+	.string	"PA_CONTROL_DEFAULT 0x4FBD"
+.LASF1674:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1556:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1877:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1859:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF1584:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2056:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1810:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1629:
+	.string	"UART_RX_FRAME_CHUNK_SIZE 64"
+.LASF1252:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2143:
+	.string	"statusLedConfig_System"
+.LASF2386:
+	.string	"mixerConfig"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF2081:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1730:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2353:
+	.string	"baroSetCalibrationCycles"
+.LASF963:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF2297:
+	.string	"MIXER_HELI_120_CCPM"
+.LASF1260:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF2218:
+	.string	"serialConfig_t"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1992:
+	.string	"int32_t"
+.LASF2207:
+	.string	"functionMask"
+.LASF1411:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1535:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF993:
+	.string	"FAST_MATH "
+.LASF883:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1455:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1977:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1738:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF1692:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF1560:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1711:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1506:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1205:
+	.string	"STR_HELPER(x) #x"
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1327:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2363:
+	.string	"failureMode"
+.LASF1225:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF1835:
+	.string	"SRXL_FRAME_OVERHEAD 5"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2078:
+	.string	"OWNER_BARO_EXTI"
+.LASF1052:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1020:
+	.string	"__va_list__ "
+.LASF1720:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1747:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF546:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF2314:
+	.string	"mixerConfig_System"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF898:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1153:
+	.string	"NVIC_PRIO_SERIALUART5_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1858:
+	.string	"LED_POS_OFFSET 0"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1343:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2055:
+	.string	"OWNER_SERIAL_TX"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1072:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF2375:
+	.string	"ledInit"
+.LASF1085:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1086:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1330:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1166:
+	.string	"NVIC_PRIO_USB NVIC_BUILD_PRIORITY(2, 0)"
+.LASF1146:
+	.string	"NVIC_PRIO_SERIALUART3_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1275:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2289:
+	.string	"MIXER_HEX6"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2039:
+	.string	"FAILURE_ACC_INCOMPATIBLE"
+.LASF1543:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF1500:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1952:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1446:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1743:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1120:
+	.string	"PRINT_LABEL 0x02"
+.LASF1206:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1328:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2116:
+	.string	"FEATURE_FAILSAFE"
+.LASF1300:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2092:
+	.string	"ledTags"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1670:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1031:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1646:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF2192:
+	.string	"BEEPER_PREFERENCE"
+.LASF1772:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2010:
+	.string	"PIDMAG"
+.LASF1559:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2079:
+	.string	"OWNER_USB"
+.LASF1976:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1103:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF2090:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1499:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1403:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1633:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1195:
+	.string	"IOCFG_AF_PP 0"
+.LASF2390:
+	.string	"systemConfig"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1639:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1844:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1967:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF974:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2021:
+	.string	"pidSumLimit"
+.LASF2359:
+	.string	"mspSerialInit"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1787:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2320:
+	.string	"motorPoleCount"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF1963:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_THROTTLE"
+.LASF2316:
+	.string	"digitalIdleOffsetPercent"
+.LASF1458:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1722:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1468:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2134:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF2016:
+	.string	"dterm_lpf_hz"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2120:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2156:
+	.string	"neutral3d"
+.LASF2005:
+	.string	"PIDALT"
+.LASF1872:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1249:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1715:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF2060:
+	.string	"OWNER_SONAR_ECHO"
+.LASF2347:
+	.string	"PROFILE_PROBE_COUNT"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1649:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1509:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1379:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2117:
+	.string	"FEATURE_SONAR"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1820:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1064:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1422:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1107:
+	.string	"PG_VTX_CONFIG 515"
+.LASF961:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2048:
+	.string	"OWNER_SERVO"
+.LASF1212:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1054:
+	.string	"PG_IMU_CONFIG 22"
+.LASF881:
+	.string	"ACC "
+.LASF2007:
+	.string	"PIDPOSR"
+.LASF1891:
+	.string	"LF(name) LED_FUNCTION_ ## name"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1550:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF803:
+	.string	"USE_PWM "
+.LASF2172:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF1539:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1718:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2182:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1758:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1735:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF1895:
+	.string	"ENABLE_DEBUG_DASHBOARD_PAGE "
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1023:
+	.string	"EEPROM_CONF_VERSION 159"
+.LASF1250:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1335:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1118:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF1653:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF960:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1577:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1253:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1423:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1648:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1439:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2304:
+	.string	"MIXER_ATAIL4"
+.LASF2296:
+	.string	"MIXER_AIRPLANE"
+.LASF968:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1833:
+	.string	"SPEKTRUM_SAT_BIND_MAX 10"
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF976:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1258:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1514:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1325:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1804:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1398:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1484:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2019:
+	.string	"dterm_notch_cutoff"
+.LASF1987:
+	.string	"__uint16_t"
+.LASF1774:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2047:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1342:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1962:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_FLAPS"
+.LASF1002:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF1707:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2075:
+	.string	"OWNER_RX_SPI_CS"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1763:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1375:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1880:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1230:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF2357:
+	.string	"failsafeInit"
+.LASF1326:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2129:
+	.string	"FEATURE_AIRMODE"
+.LASF2315:
+	.string	"motorConfig_s"
+.LASF2321:
+	.string	"motorConfig_t"
+.LASF1921:
+	.string	"VTX_BAND_MIN 1"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF2360:
+	.string	"mspFcInit"
+.LASF1261:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1179:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF1552:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1144:
+	.string	"NVIC_PRIO_SERIALUART2_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF979:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF991:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2038:
+	.string	"FAILURE_ACC_INIT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2274:
+	.string	"SENSOR_INDEX_BARO"
+.LASF957:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2273:
+	.string	"SENSOR_INDEX_ACC"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF981:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1863:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1929:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF1882:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF1837:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1378:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1956:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1204:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1014:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1108:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1295:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF355:
+	.string	"__amd64 1"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF1238:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1235:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1980:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1251:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2112:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2111:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1114:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1178:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF772:
+	.string	"__SIZE_T "
+.LASF2247:
+	.string	"OSD_POWER"
+.LASF1512:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1572:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1892:
+	.string	"LO(name) LED_FLAG_OVERLAY(LED_OVERLAY_ ## name)"
+.LASF1065:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1041:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF364:
+	.string	"__k8 1"
+.LASF1048:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF2364:
+	.string	"getBeeperOffMask"
+.LASF1748:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF2103:
+	.string	"motorPwmProtocol"
+.LASF1997:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1291:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1043:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF966:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF2145:
+	.string	"currentPidProfile"
+.LASF1549:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1531:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1347:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF879:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF1724:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1930:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1746:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1194:
+	.string	"IOCFG_OUT_OD 0"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2305:
+	.string	"MIXER_CUSTOM"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1661:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1299:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF2114:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF952:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1267:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1367:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1729:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1679:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF1654:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1183:
+	.string	"DMA_OUTPUT_INDEX 0"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF982:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1508:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1304:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF2100:
+	.string	"PWM_TYPE_MAX"
+.LASF1637:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF380:
+	.string	"__unix 1"
+.LASF2348:
+	.string	"motorControlEnable"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1130:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF1565:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1737:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF2087:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF813:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1791:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2271:
+	.string	"TASK_SELF"
+.LASF1088:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1694:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1505:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1365:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1050:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1915:
+	.string	"FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))"
+.LASF1939:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF1538:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1913:
+	.string	"FAT_FILENAME_LENGTH 11"
+.LASF1750:
+	.string	"PA5G_BS_MASK 0x0E00"
+.LASF1392:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1938:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF2181:
+	.string	"BEEPER_RX_SET"
+.LASF1744:
+	.string	"M25P16_PAGESIZE 256"
+.LASF2394:
+	.string	"init"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2177:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF1370:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1663:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1459:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1438:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1441:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1313:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF2098:
+	.string	"PWM_TYPE_MULTISHOT"
+.LASF2069:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF2223:
+	.string	"specialColorIndexes_s"
+.LASF2224:
+	.string	"specialColorIndexes_t"
+.LASF1169:
+	.string	"NVIC_PRIO_MPU_DATA_READY NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF1630:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1501:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1793:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2171:
+	.string	"BEEPER_SILENCE"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2263:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2190:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1344:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1198:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1420:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1015:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1816:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1623:
+	.string	"UART6_RX_BUFFER_SIZE 256"
+.LASF1254:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2131:
+	.string	"FEATURE_VTX"
+.LASF999:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF2306:
+	.string	"MIXER_CUSTOM_AIRPLANE"
+.LASF989:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1373:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2244:
+	.string	"OSD_ROLL_PIDS"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1454:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1703:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1779:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1946:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1592:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2132:
+	.string	"FEATURE_RX_SPI"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1449:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2384:
+	.string	"idlePulse"
+.LASF2136:
+	.string	"systemConfig_s"
+.LASF2142:
+	.string	"systemConfig_t"
+.LASF1575:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1504:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1008:
+	.string	"_ANSI_STDARG_H_ "
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1070:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF2102:
+	.string	"motorPwmRate"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1587:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1515:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1080:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF2210:
+	.string	"gps_baudrateIndex"
+.LASF1105:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2037:
+	.string	"FAILURE_MISSING_ACC"
+.LASF1601:
+	.string	"LED0_ON do {} while(0)"
+.LASF1764:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1016:
+	.string	"_VA_LIST_ "
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2004:
+	.string	"PIDYAW"
+.LASF1332:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1874:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF1150:
+	.string	"NVIC_PRIO_SERIALUART4_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1131:
+	.string	"NVIC_PRIO_MAX NVIC_BUILD_PRIORITY(0, 1)"
+.LASF1878:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1151:
+	.string	"NVIC_PRIO_SERIALUART4 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1632:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF1896:
+	.string	"MBR_PARTITION_TYPE_FAT16 0x06"
+.LASF2366:
+	.string	"initBoardAlignment"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1340:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1889:
+	.string	"LED_XY_MASK 0x0F"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1669:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF1824:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2080:
+	.string	"OWNER_USB_DETECT"
+.LASF1544:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1426:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1568:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1686:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1180:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1673:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1390:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF1149:
+	.string	"NVIC_PRIO_SERIALUART4_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1090:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1581:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1644:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1695:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF1147:
+	.string	"NVIC_PRIO_SERIALUART3_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1395:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1769:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2236:
+	.string	"OSD_CRAFT_NAME"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2303:
+	.string	"MIXER_SINGLECOPTER"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1579:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2124:
+	.string	"FEATURE_DASHBOARD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1605:
+	.string	"LED2_TOGGLE do {} while(0)"
+.LASF1829:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1264:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2084:
+	.string	"OWNER_INVERTER"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1875:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF1210:
+	.string	"BIT(x) (1 << (x))"
+.LASF2064:
+	.string	"OWNER_SPI_MOSI"
+.LASF1558:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2208:
+	.string	"identifier"
+.LASF2376:
+	.string	"latchActiveFeatures"
+.LASF1993:
+	.string	"uint8_t"
+.LASF1303:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2250:
+	.string	"OSD_AVG_CELL_VOLTAGE"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF2232:
+	.string	"OSD_HORIZON_SIDEBARS"
+.LASF1025:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1124:
+	.string	"SET_PRINTVALUE(p) { (p)->flags |= PRINT_VALUE; }"
+.LASF1893:
+	.string	"LD(name) LED_FLAG_DIRECTION(LED_DIRECTION_ ## name)"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF992:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1943:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF1216:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF1407:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1208:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2275:
+	.string	"SENSOR_INDEX_MAG"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF1627:
+	.string	"UART8_RX_BUFFER_SIZE 256"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF2162:
+	.string	"ARMED"
+.LASF1084:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1671:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1165:
+	.string	"NVIC_PRIO_I2C_EV NVIC_BUILD_PRIORITY(0, 0)"
+.LASF1186:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF1410:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1135:
+	.string	"NVIC_PRIO_TRANSPONDER_DMA NVIC_BUILD_PRIORITY(3, 0)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1927:
+	.string	"SCHEDULER_TRACE_SIZE 64"
+.LASF994:
+	.string	"VERY_FAST_MATH "
+.LASF2293:
+	.string	"MIXER_OCTOX8"
+.LASF2354:
+	.string	"accSetCalibrationCycles"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2256:
+	.string	"TASK_ACCEL"
+.LASF964:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1625:
+	.string	"UART7_RX_BUFFER_SIZE 256"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1803:
+	.string	"MSP_PUSH_MAX_RATE_HZ 200"
+.LASF1672:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1112:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1497:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1970:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF1011:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1416:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF985:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF2110:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF2184:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1302:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1551:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1418:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF2383:
+	.string	"printfSupportInit"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1321:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF970:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF822:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2201:
+	.string	"SERIAL_PORT_USART8"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF2077:
+	.string	"OWNER_MPU_EXTI"
+.LASF1771:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1224:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF2046:
+	.string	"OWNER_PPMINPUT"
+.LASF2035:
+	.string	"ioTag_t"
+.LASF2336:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF1197:
+	.string	"IOCFG_IPD 0"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF2307:
+	.string	"MIXER_CUSTOM_TRI"
+.LASF2026:
+	.string	"levelAngleLimit"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1733:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF951:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1571:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1923:
+	.string	"VTX_CHANNEL_MIN 1"
+.LASF1068:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF2095:
+	.string	"PWM_TYPE_STANDARD"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF2330:
+	.string	"INPUT_RC_THROTTLE"
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1728:
+	.string	"GYRO_LPF_NONE 7"
+.LASF1255:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1028:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1511:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1529:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2284:
+	.string	"MIXER_QUADP"
+.LASF1354:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1752:
+	.string	"PD_Q5G_MASK 0x0040"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF2285:
+	.string	"MIXER_QUADX"
+.LASF1842:
+	.string	"LON 1"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1805:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1451:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1540:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1708:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1093:
+	.string	"PG_OSD_CONFIG 501"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1058:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1366:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF969:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1270:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1063:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1831:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1293:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1022:
+	.string	"sprintf tfp_sprintf"
+.LASF2104:
+	.string	"motorPwmInversion"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1339:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1317:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1951:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF1495:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1106:
+	.string	"PG_VCD_CONFIG 514"
+.LASF2283:
+	.string	"MIXER_TRI"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF1488:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1470:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1808:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1869:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF1533:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1289:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2138:
+	.string	"activeRateProfile"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1273:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1364:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1940:
+	.string	"ESC_DATA_INVALID 255"
+.LASF2127:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1770:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1636:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1958:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1727:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1851:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF1399:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1739:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1350:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2328:
+	.string	"INPUT_RC_PITCH"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF1228:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1979:
+	.string	"PROFILE_TICKS_PER_US 1000"
+.LASF1475:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1634:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1141:
+	.string	"NVIC_PRIO_SERIALUART1_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1536:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2059:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1486:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1006:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1527:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1386:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1473:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1377:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1380:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1157:
+	.string	"NVIC_PRIO_SERIALUART6 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF2241:
+	.string	"OSD_GPS_SPEED"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1442:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1645:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF2226:
+	.string	"modeColors"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1276:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1168:
+	.string	"NVIC_PRIO_SONAR_ECHO NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF1944:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF2231:
+	.string	"OSD_ARTIFICIAL_HORIZON"
+.LASF1900:
+	.string	"FAT_VOLUME_ID_SIGNATURE_1 0x55"
+.LASF978:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1309:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1419:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2324:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF949:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2385:
+	.string	"motorConfig"
+.LASF2165:
+	.string	"GPS_FIX_HOME"
+.LASF2130:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1547:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2061:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1665:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF499:
+	.string	"__PMT"
+.LASF2211:
+	.string	"blackbox_baudrateIndex"
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF2033:
+	.string	"rateAccelLimit"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2014:
+	.string	"pidProfile_s"
+.LASF2034:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1425:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1562:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1082:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF2344:
+	.string	"PROFILE_CHECK_FUNC"
+.LASF2164:
+	.string	"armingFlags"
+.LASF1525:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2233:
+	.string	"OSD_ONTIME"
+.LASF2356:
+	.string	"rxInit"
+.LASF1457:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1376:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1374:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1848:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1754:
+	.string	"PA_BS_MASK 0x0007"
+.LASF1600:
+	.string	"LED0_OFF do {} while(0)"
+.LASF1040:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1173:
+	.string	"NVIC_PRIORITY_GROUPING NVIC_PriorityGroup_2"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2249:
+	.string	"OSD_MAIN_BATT_WARNING"
+.LASF1431:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1033:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1865:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF2278:
+	.string	"rollDegrees"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1802:
+	.string	"MSP_PUSH_MAX_COMMANDS 8"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1345:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1935:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1955:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF1126:
+	.string	"IS_PRINTLABEL(p) ((p)->flags & PRINT_LABEL)"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF2237:
+	.string	"OSD_THROTTLE_POS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2099:
+	.string	"PWM_TYPE_BRUSHED"
+.LASF955:
+	.string	"UNIT_TESTED "
+.LASF2393:
+	.string	"feature"
+.LASF2107:
+	.string	"ioTags"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2380:
+	.string	"IOInitGlobal"
+.LASF1890:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1456:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF2133:
+	.string	"FEATURE_SOFTSPI"
+.LASF1897:
+	.string	"MBR_PARTITION_TYPE_FAT32 0x0B"
+.LASF1696:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1736:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF2187:
+	.string	"BEEPER_ARMED"
+.LASF1383:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF980:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF2242:
+	.string	"OSD_GPS_SATS"
+.LASF1435:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2392:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1776:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1034:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1598:
+	.string	"LED_NUMBER 3"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF965:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1268:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1132:
+	.string	"NVIC_PRIO_TIMER NVIC_BUILD_PRIORITY(1, 1)"
+.LASF1908:
+	.string	"FAT_FILE_ATTRIBUTE_HIDDEN 0x02"
+.LASF1296:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1110:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2023:
+	.string	"dterm_average_count"
+.LASF1941:
+	.string	"ESC_BATTERY_AGE_MAX 10"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1234:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF2093:
+	.string	"polarity"
+.LASF1545:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1128:
+	.string	"CLR_PRINTLABEL(p) { (p)->flags &= ~PRINT_LABEL; }"
+.LASF1171:
+	.string	"NVIC_PRIO_CALLBACK NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF1029:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF1800:
+	.string	"MSP_PORT_MAX_HEADER_SIZE 8"
+.LASF2141:
+	.string	"name"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1104:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1937:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2351:
+	.string	"timerStart"
+.LASF1318:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1849:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1476:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1931:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF1139:
+	.string	"NVIC_PRIO_WS2811_DMA NVIC_BUILD_PRIORITY(1, 2)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF2024:
+	.string	"vbatPidCompensation"
+.LASF1688:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF1918:
+	.string	"VISIBLE(x) (x & VISIBLE_FLAG)"
+.LASF1713:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2317:
+	.string	"minthrottle"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2166:
+	.string	"GPS_FIX"
+.LASF2254:
+	.string	"TASK_SYSTEM"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1271:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF2257:
+	.string	"TASK_ATTITUDE"
+.LASF1266:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2159:
+	.string	"flight3DConfig_System"
+.LASF1184:
+	.string	"DMA_OUTPUT_STRING \"DMA%d Channel %d:\""
+.LASF986:
+	.string	"HSV_HUE_MAX 359"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF1626:
+	.string	"UART7_TX_BUFFER_SIZE 256"
+.LASF1517:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF2191:
+	.string	"BEEPER_ALL"
+.LASF802:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1247:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1706:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1356:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2163:
+	.string	"WAS_EVER_ARMED"
+.LASF1788:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF2299:
+	.string	"MIXER_VTAIL4"
+.LASF1156:
+	.string	"NVIC_PRIO_SERIALUART6_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF2234:
+	.string	"OSD_FLYTIME"
+.LASF2382:
+	.string	"systemInit"
+.LASF1852:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF1001:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF2179:
+	.string	"BEEPER_BAT_LOW"
+.LASF1201:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2067:
+	.string	"OWNER_SDCARD"
+.LASF1337:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1868:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF2325:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1490:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF2309:
+	.string	"mixerMode_e"
+.LASF2332:
+	.string	"INPUT_RC_AUX2"
+.LASF2318:
+	.string	"maxthrottle"
+.LASF2334:
+	.string	"INPUT_RC_AUX4"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1081:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1719:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1975:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF785:
+	.string	"NULL"
+.LASF1274:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1116:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1981:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1384:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1616:
+	.string	"UART2_TX_BUFFER_SIZE 256"
+.LASF1984:
+	.string	"signed char"
+.LASF959:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1324:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF1461:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF766:
+	.string	"__size_t__ "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1576:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF1287:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1573:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF1397:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1049:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF1784:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1078:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2255:
+	.string	"TASK_GYROPID"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF2122:
+	.string	"FEATURE_RSSI_ADC"
+.LASF2168:
+	.string	"SMALL_ANGLE"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF990:
+	.string	"sq(x) ((x)*(x))"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1170:
+	.string	"NVIC_PRIO_MAG_DATA_READY NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF1873:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF1214:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1482:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1401:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1786:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2175:
+	.string	"BEEPER_DISARMING"
+.LASF2281:
+	.string	"boardAlignment_t"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1163:
+	.string	"NVIC_PRIO_SERIALUART8 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF1599:
+	.string	"LED0_TOGGLE do {} while(0)"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF1812:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1233:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF2358:
+	.string	"cliInit"
+.LASF2139:
+	.string	"debug_mode"
+.LASF2391:
+	.string	"statusLedConfig"
+.LASF1199:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1655:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF1609:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF2368:
+	.string	"getMotorCount"
+.LASF2189:
+	.string	"BEEPER_USB"
+.LASF1768:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2373:
+	.string	"timerInit"
+.LASF1681:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2203:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2204:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF396:
+	.string	"__REVISION__ \"669c324\""
+.LASF2286:
+	.string	"MIXER_BICOPTER"
+.LASF2089:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1061:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1902:
+	.string	"FAT_DIRECTORY_ENTRY_SIZE 32"
+.LASF1164:
+	.string	"NVIC_PRIO_I2C_ER NVIC_BUILD_PRIORITY(0, 0)"
+.LASF1876:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1615:
+	.string	"UART2_RX_BUFFER_SIZE 256"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF2152:
+	.string	"systemState"
+.LASF977:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2378:
+	.string	"ensureEEPROMContainsValidData"
+.LASF2290:
+	.string	"MIXER_FLYING_WING"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1520:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1853:
+	.string	"LED_MODE_COUNT 6"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF2219:
+	.string	"serialConfig_System"
+.LASF2146:
+	.string	"SYSTEM_STATE_INITIALISING"
+.LASF1111:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2082:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF2365:
+	.string	"sensorsAutodetect"
+.LASF1460:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1491:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1574:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1047:
+	.string	"PG_PID_PROFILE 14"
+.LASF2319:
+	.string	"mincommand"
+.LASF1066:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1323:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF2235:
+	.string	"OSD_FLYMODE"
+.LASF1685:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1662:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1099:
+	.string	"PG_PPM_CONFIG 507"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2043:
+	.string	"failureMode_e"
+.LASF1242:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1792:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1413:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1279:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1175:
+	.string	"NVIC_PRIORITY_BASE(prio) (((prio)>>(4-(7-(NVIC_PRIORITY_GROUPING>>8))))>>4)"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1316:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1222:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1635:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF2160:
+	.string	"OK_TO_ARM"
+.LASF1257:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF2291:
+	.string	"MIXER_Y4"
+.LASF2288:
+	.string	"MIXER_Y6"
+.LASF1765:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1032:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF983:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2029:
+	.string	"itermAcceleratorGain"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1196:
+	.string	"IOCFG_AF_OD 0"
+.LASF1189:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF1866:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1265:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2377:
+	.string	"readEEPROM"
+.LASF1785:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1248:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1928:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2202:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1698:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF1920:
+	.string	"OSD_POSCFG_MAX (VISIBLE_FLAG|0x3FF)"
+.LASF1162:
+	.string	"NVIC_PRIO_SERIALUART8_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1448:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2125:
+	.string	"FEATURE_OSD"
+.LASF1933:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1807:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF975:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF821:
+	.string	"GPS "
+.LASF1934:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1434:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1433:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2194:
+	.string	"SERIAL_PORT_USART1"
+.LASF2195:
+	.string	"SERIAL_PORT_USART2"
+.LASF2196:
+	.string	"SERIAL_PORT_USART3"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1290:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2199:
+	.string	"SERIAL_PORT_USART6"
+.LASF2200:
+	.string	"SERIAL_PORT_USART7"
+.LASF2170:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1319:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1604:
+	.string	"LED1_ON do {} while(0)"
+.LASF1229:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1903:
+	.string	"FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2"
+.LASF1060:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1522:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1901:
+	.string	"FAT_VOLUME_ID_SIGNATURE_2 0xAA"
+.LASF1990:
+	.string	"long int"
+.LASF1155:
+	.string	"NVIC_PRIO_SERIALUART6_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF1351:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1053:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1925:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF1176:
+	.string	"NVIC_PRIORITY_SUB(prio) (((prio)&(0x0f>>(7-(NVIC_PRIORITY_GROUPING>>8))))>>4)"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1187:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF1843:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2298:
+	.string	"MIXER_HELI_90_DEG"
+.LASF1003:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1369:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2057:
+	.string	"OWNER_PINDEBUG"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2294:
+	.string	"MIXER_OCTOFLATP"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1563:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2295:
+	.string	"MIXER_OCTOFLATX"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1950:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1942:
+	.string	"ESC_SENSOR_COMBINED 255"
+.LASF1618:
+	.string	"UART3_TX_BUFFER_SIZE 256"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1796:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1209:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1622:
+	.string	"UART5_TX_BUFFER_SIZE 256"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF1847:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1396:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1322:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1948:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1044:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1523:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2259:
+	.string	"TASK_SERIAL"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF2381:
+	.string	"profileInit"
+.LASF1854:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1883:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF2096:
+	.string	"PWM_TYPE_ONESHOT125"
+.LASF1207:
+	.string	"EXPAND_I(x) x"
+.LASF1372:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1814:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1463:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1329:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1995:
+	.string	"uint32_t"
+.LASF1717:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF2252:
+	.string	"OSD_GPS_LAT"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF2240:
+	.string	"OSD_MAH_DRAWN"
+.LASF1134:
+	.string	"NVIC_PRIO_SONAR_EXTI NVIC_BUILD_PRIORITY(2, 0)"
+.LASF1945:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF2161:
+	.string	"PREVENT_ARMING"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1294:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2137:
+	.string	"pidProfileIndex"
+.LASF1145:
+	.string	"NVIC_PRIO_SERIALUART2 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1057:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1740:
+	.string	"I2C_SHORT_TIMEOUT ((uint32_t)0x1000)"
+.LASF1917:
+	.string	"VISIBLE_FLAG 0x0800"
+.LASF1546:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1496:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1231:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF2051:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1554:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1079:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2387:
+	.string	"boardAlignment"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1096:
+	.string	"PG_PID_CONFIG 504"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF1507:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1965:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1783:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF2036:
+	.string	"FAILURE_DEVELOPER"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF1983:
+	.string	"long unsigned int"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1870:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF956:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1076:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2339:
+	.string	"debugMode"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1036:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1312:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1690:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1361:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF2258:
+	.string	"TASK_RX"
+.LASF1864:
+	.string	"LED_POS_BITCNT 8"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF2345:
+	.string	"PROFILE_SCHEDULER"
+.LASF2022:
+	.string	"pidSumLimitYaw"
+.LASF2058:
+	.string	"OWNER_TIMER"
+.LASF1640:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF2369:
+	.string	"mixerConfigureOutput"
+.LASF1907:
+	.string	"FAT_FILE_ATTRIBUTE_READ_ONLY 0x01"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1077:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF2106:
+	.string	"useDshotTelemetry"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1298:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2269:
+	.string	"TASK_COUNT"
+.LASF2031:
+	.string	"dtermSetpointWeight"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1471:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1239:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1841:
+	.string	"LAT 0"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF2227:
+	.string	"specialColors"
+.LASF1991:
+	.string	"char"
+.LASF2006:
+	.string	"PIDPOS"
+.LASF1809:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1368:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1759:
+	.string	"LOOPTIME_SUSPEND_TIME 3"
+.LASF1857:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1305:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1566:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1452:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2248:
+	.string	"OSD_PIDRATE_PROFILE"
+.LASF1773:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF1606:
+	.string	"LED2_OFF do {} while(0)"
+.LASF2013:
+	.string	"hsvColor_s"
+.LASF2001:
+	.string	"hsvColor_t"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1881:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1301:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1010:
+	.string	"__GNUC_VA_LIST "
+.LASF1432:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1012:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF1218:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2097:
+	.string	"PWM_TYPE_ONESHOT42"
+.LASF1272:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1526:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1651:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1115:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2193:
+	.string	"SERIAL_PORT_NONE"
+.LASF1610:
+	.string	"BEEP_ON do {} while(0)"
+.LASF2027:
+	.string	"levelSensitivity"
+.LASF2070:
+	.string	"OWNER_FLASH_CS"
+.LASF1440:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF1203:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1414:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF2221:
+	.string	"color"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1856:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF1780:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1687:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1825:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1664:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF2342:
+	.string	"PROFILE_MIX_TABLE"
+.LASF1588:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2230:
+	.string	"OSD_CROSSHAIRS"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF950:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1815:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1652:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1954:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1886:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF2346:
+	.string	"PROFILE_TASK_FIRST"
+.LASF1742:
+	.string	"I2C_DEFAULT_TIMEOUT I2C_SHORT_TIMEOUT"
+.LASF1608:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF2355:
+	.string	"telemetryInit"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1283:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1069:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1122:
+	.string	"OPTSTRING 0x08"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1596:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF2144:
+	.string	"systemConfig_System"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF929:
+	.string	"USE_PROFILE "
+.LASF2113:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2388:
+	.string	"serialConfig"
+.LASF1797:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF1074:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2062:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1333:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF953:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1494:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2264:
+	.string	"TASK_COMPASS"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1158:
+	.string	"NVIC_PRIO_SERIALUART7_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF1182:
+	.string	"DMA_MOD_OFFSET 1"
+.LASF1286:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1127:
+	.string	"SET_PRINTLABEL(p) { (p)->flags |= PRINT_LABEL; }"
+.LASF2323:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF1349:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1894:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF2260:
+	.string	"TASK_DISPATCH"
+.LASF1177:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF2238:
+	.string	"OSD_VTX_CHANNEL"
+.LASF1751:
+	.string	"PA5G_PW_MASK 0x0180"
+.LASF1756:
+	.string	"CHANNELS_PER_BAND 8"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1013:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF2188:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF2329:
+	.string	"INPUT_RC_YAW"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1828:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1510:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF2337:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF1009:
+	.string	"__need___va_list"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1098:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1474:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2173:
+	.string	"BEEPER_RX_LOST"
+.LASF1691:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2197:
+	.string	"SERIAL_PORT_UART4"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2198:
+	.string	"SERIAL_PORT_UART5"
+.LASF1437:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2312:
+	.string	"yaw_motors_reversed"
+.LASF1185:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f,i,r) {.dma = d, .ref = c, .irqHandlerCallback = NULL, .flagsShift = f, .irqN = i, .rcc = r, .userParam = 0, .owner = 0, .resourceIndex = 0 }"
+.LASF1741:
+	.string	"I2C_LONG_TIMEOUT ((uint32_t)(10 * I2C_SHORT_TIMEOUT))"
+.LASF1569:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1905:
+	.string	"FAT12_MAX_CLUSTERS 4084"
+.LASF1353:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1919:
+	.string	"OSD_POS_MAX 0x3FF"
+.LASF2308:
+	.string	"MIXER_QUADX_1234"
+.LASF1172:
+	.string	"NVIC_PRIO_MAX7456_DMA NVIC_BUILD_PRIORITY(3, 0)"
+.LASF2206:
+	.string	"serialPortConfig_s"
+.LASF2213:
+	.string	"serialPortConfig_t"
+.LASF1638:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF1394:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2243:
+	.string	"OSD_ALTITUDE"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1502:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1430:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1591:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1794:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1051:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1388:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1311:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1469:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2302:
+	.string	"MIXER_DUALCOPTER"
+.LASF1297:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1969:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1767:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1974:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF1777:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF967:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1087:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF971:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1215:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2279:
+	.string	"pitchDegrees"
+.LASF1879:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF1409:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1089:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF972:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1097:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1485:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1607:
+	.string	"LED2_ON do {} while(0)"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1341:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1658:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1109:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1678:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1030:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF1957:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2065:
+	.string	"OWNER_I2C_SCL"
+.LASF2063:
+	.string	"OWNER_SPI_MISO"
+.LASF1246:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2088:
+	.string	"OWNER_COMPASS_CS"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF1947:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF1269:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF1682:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1519:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2135:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF1037:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2121:
+	.string	"FEATURE_RX_MSP"
+.LASF2262:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF2018:
+	.string	"dterm_notch_hz"
+.LASF1160:
+	.string	"NVIC_PRIO_SERIALUART7 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1000:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2115:
+	.string	"FEATURE_GPS"
+.LASF2020:
+	.string	"itermWindupPointPercent"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1643:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2091:
+	.string	"statusLedConfig_s"
+.LASF2094:
+	.string	"statusLedConfig_t"
+.LASF1537:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1385:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1988:
+	.string	"__int32_t"
+.LASF1389:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2066:
+	.string	"OWNER_I2C_SDA"
+.LASF1830:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1989:
+	.string	"__uint32_t"
+.LASF2228:
+	.string	"OSD_RSSI_VALUE"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2370:
+	.string	"featureClear"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1684:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1498:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1731:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2123:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2265:
+	.string	"TASK_BARO"
+.LASF1005:
+	.string	"Q12 (1 << 12)"
+.LASF1978:
+	.string	"PROFILE_TASK(taskId) ((profileProbe_e)(PROFILE_TASK_FIRST + (taskId)))"
+.LASF1959:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1916:
+	.string	"FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))"
+.LASF1117:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF801:
+	.string	"USE_CLI "
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1288:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1424:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1541:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2071:
+	.string	"OWNER_FLASH"
+.LASF1871:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF1578:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1083:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF1922:
+	.string	"VTX_BAND_MAX 5"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2205:
+	.string	"serialPortIdentifier_e"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2169:
+	.string	"FIXED_WING"
+.LASF1477:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2225:
+	.string	"colors"
+.LASF2140:
+	.string	"task_statistics"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1721:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2209:
+	.string	"msp_baudrateIndex"
+.LASF1827:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF1136:
+	.string	"NVIC_PRIO_MPU_INT_EXTI NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF1795:
+	.string	"CLI_SETTING_NOT_FOUND -1"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF2148:
+	.string	"SYSTEM_STATE_SENSORS_READY"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1489:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1823:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF2362:
+	.string	"pidInit"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2266:
+	.string	"TASK_ALTITUDE"
+.LASF1331:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1697:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF1227:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1123:
+	.string	"IS_PRINTVALUE(p) ((p)->flags & PRINT_VALUE)"
+.LASF1888:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1594:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1263:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1518:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1464:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1757:
+	.string	"BANDS_NUMBER 5"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1811:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1240:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1472:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF2105:
+	.string	"useUnsyncedPwm"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2178:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1059:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1307:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2216:
+	.string	"serial_update_rate_hz"
+.LASF1381:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1799:
+	.string	"MSP_PORT_STREAM_LIMIT 0xffff"
+.LASF1447:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2214:
+	.string	"serialConfig_s"
+.LASF2083:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF1154:
+	.string	"NVIC_PRIO_SERIALUART5 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF1483:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2086:
+	.string	"OWNER_TRANSPONDER"
+.LASF1055:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1119:
+	.string	"PRINT_VALUE 0x01"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1683:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1716:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF1732:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1675:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF1911:
+	.string	"FAT_FILE_ATTRIBUTE_DIRECTORY 0x10"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1334:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2030:
+	.string	"setpointRelaxRatio"
+.LASF2379:
+	.string	"initEEPROM"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1909:
+	.string	"FAT_FILE_ATTRIBUTE_SYSTEM 0x04"
+.LASF996:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF2311:
+	.string	"mixerMode"
+.LASF1642:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF1393:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2253:
+	.string	"OSD_ITEM_COUNT"
+.LASF1832:
+	.string	"SPEKTRUM_SAT_BIND_DISABLED 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1761:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF2268:
+	.string	"TASK_MSP_PUSH"
+.LASF1280:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2155:
+	.string	"deadband3d_high"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF1211:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1689:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1745:
+	.string	"SONAR_GPIO GPIOB"
+.LASF1656:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1026:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1479:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2073:
+	.string	"OWNER_MPU_CS"
+.LASF2076:
+	.string	"OWNER_SPI_CS"
+.LASF1101:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2282:
+	.string	"boardAlignment_System"
+.LASF1284:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1806:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1542:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1641:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1597:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF2183:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF885:
+	.string	"MAG "
+.LASF2174:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF1904:
+	.string	"FAT_MAXIMUM_FILESIZE 0xFFFFFFFF"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1480:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF2352:
+	.string	"gyroSetCalibrationCycles"
+.LASF2310:
+	.string	"mixerConfig_s"
+.LASF2313:
+	.string	"mixerConfig_t"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1528:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2025:
+	.string	"pidAtMinThrottle"
+.LASF1142:
+	.string	"NVIC_PRIO_SERIALUART1 NVIC_BUILD_PRIORITY(1, 1)"
+.LASF1017:
+	.string	"_VA_LIST "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1949:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1839:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2300:
+	.string	"MIXER_HEX6H"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1245:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1038:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1382:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF522:
+	.string	"__flexarr []"
+.LASF2292:
+	.string	"MIXER_HEX6X"
+.LASF1749:
+	.string	"DP_5G_MASK 0x7000"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1217:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1821:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF2270:
+	.string	"TASK_NONE"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1973:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1094:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF2044:
+	.string	"OWNER_FREE"
+.LASF2251:
+	.string	"OSD_GPS_LON"
+.LASF1174:
+	.string	"NVIC_BUILD_PRIORITY(base,sub) (((((base)<<(4-(7-(NVIC_PRIORITY_GROUPING>>8))))|((sub)&(0x0f>>(7-(NVIC_PRIORITY_GROUPING>>8)))))<<4)&0xf0)"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1677:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2042:
+	.string	"FAILURE_GYRO_INIT_FAILED"
+.LASF2015:
+	.string	"dterm_filter_type"
+.LASF1961:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF1019:
+	.string	"_VA_LIST_T_H "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1259:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1998:
+	.string	"RGB_RED"
+.LASF984:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1521:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF2153:
+	.string	"flight3DConfig_s"
+.LASF2158:
+	.string	"flight3DConfig_t"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1244:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1964:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF1278:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1621:
+	.string	"UART5_RX_BUFFER_SIZE 256"
+.LASF1617:
+	.string	"UART3_RX_BUFFER_SIZE 256"
+.LASF2045:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1760:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1362:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1631:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1583:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1840:
+	.string	"FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64"
+.LASF1960:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF1775:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1660:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF1121:
+	.string	"DYNAMIC 0x04"
+.LASF1657:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF954:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1444:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF1846:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1613:
+	.string	"UART1_RX_BUFFER_SIZE 256"
+.LASF1906:
+	.string	"FAT16_MAX_CLUSTERS 65524"
+.LASF1899:
+	.string	"MBR_PARTITION_TYPE_FAT16_LBA 0x0E"
+.LASF2371:
+	.string	"mixerInit"
+.LASF1700:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1181:
+	.string	"DMA_MOD_VALUE 7"
+.LASF1262:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1555:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1790:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1582:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1062:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1693:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1236:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1914:
+	.string	"FAT_DELETED_FILE_MARKER 0xE5"
+.LASF1936:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1338:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1193:
+	.string	"IOCFG_OUT_PP 0"
+.LASF2119:
+	.string	"FEATURE_3D"
+.LASF2245:
+	.string	"OSD_PITCH_PIDS"
+.LASF1966:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF1818:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1042:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2068:
+	.string	"OWNER_SDCARD_CS"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1701:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF2040:
+	.string	"FAILURE_INVALID_EEPROM_CONTENTS"
+.LASF1277:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1004:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2239:
+	.string	"OSD_CURRENT_DRAW"
+.LASF1487:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1838:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE 128"
+.LASF1243:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1241:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1226:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF2186:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF2101:
+	.string	"motorDevConfig_s"
+.LASF2108:
+	.string	"motorDevConfig_t"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1704:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1564:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1676:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF1450:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2147:
+	.string	"SYSTEM_STATE_CONFIG_LOADED"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1359:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1910:
+	.string	"FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08"
+.LASF1712:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2008:
+	.string	"PIDNAVR"
+.LASF1668:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1315:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1159:
+	.string	"NVIC_PRIO_SERIALUART7_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1102:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1027:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1603:
+	.string	"LED1_OFF do {} while(0)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1972:
+	.string	"MAX_SERVO_BOXES 3"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1346:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1753:
+	.string	"QI_5G_MASK 0x0038"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1845:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2229:
+	.string	"OSD_MAIN_BATT_VOLTAGE"
+.LASF1219:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2085:
+	.string	"OWNER_LED_STRIP"
+.LASF1478:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF888:
+	.string	"USE_UART2 "
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1819:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF2012:
+	.string	"PID_ITEM_COUNT"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1801:
+	.string	"MSP_SERIAL_PROCESS_TIME_US 250"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF962:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1586:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1647:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF2276:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1602:
+	.string	"LED1_TOGGLE do {} while(0)"
+.LASF1046:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1073:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2032:
+	.string	"yawRateAccelLimit"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1391:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1817:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1702:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1466:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1705:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1924:
+	.string	"VTX_CHANNEL_MAX 8"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1237:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF2017:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1190:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF2367:
+	.string	"motorDevInit"
+.LASF1220:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF2212:
+	.string	"telemetry_baudrateIndex"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1710:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2267:
+	.string	"TASK_TELEMETRY"
+.LASF1138:
+	.string	"NVIC_PRIO_MAG_INT_EXTI NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF2072:
+	.string	"OWNER_BARO_CS"
+.LASF1137:
+	.string	"NVIC_PRIO_MPU_INT_EXTI_PID NVIC_BUILD_PRIORITY(2, 0)"
+.LASF2176:
+	.string	"BEEPER_ARMING"
+.LASF2374:
+	.string	"delay"
+.LASF2327:
+	.string	"INPUT_RC_ROLL"
+.LASF2154:
+	.string	"deadband3d_low"
+.LASF1092:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1213:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF987:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1898:
+	.string	"MBR_PARTITION_TYPE_FAT32_LBA 0x0C"
+.LASF2341:
+	.string	"PROFILE_PID_CONTROLLER"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF1885:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF1982:
+	.string	"unsigned int"
+.LASF2272:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF1095:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1855:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1590:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1971:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF1822:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1887:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF1129:
+	.string	"IS_DYNAMIC(p) ((p)->flags & DYNAMIC)"
+.LASF1202:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1667:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1709:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1834:
+	.string	"SPEK_FRAME_SIZE 16"
+.LASF1714:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1024:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1314:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1884:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1100:
+	.string	"PG_PWM_CONFIG 508"
+.LASF2372:
+	.string	"serialInit"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1465:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2050:
+	.string	"OWNER_ADC"
+.LASF1985:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1336:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2338:
+	.string	"inputSource_e"
+.LASF1152:
+	.string	"NVIC_PRIO_SERIALUART5_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF1191:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1427:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF2028:
+	.string	"itermThrottleThreshold"
+.LASF1357:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1567:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1513:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1045:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF2126:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF1553:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1200:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2053:
+	.string	"OWNER_ADC_EXT"
+.LASF1148:
+	.string	"NVIC_PRIO_SERIALUART3 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF2349:
+	.string	"fcTasksInit"
+.LASF1860:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF1091:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1306:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1310:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1650:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF1021:
+	.string	"printf tfp_printf"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2074:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1167:
+	.string	"NVIC_PRIO_USB_WUP NVIC_BUILD_PRIORITY(1, 0)"
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF973:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF2151:
+	.string	"SYSTEM_STATE_READY"
+.LASF1188:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1570:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1968:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2041:
+	.string	"FAILURE_FLASH_WRITE_FAILED"
+.LASF1360:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2516:
+	.string	"rx_pwm.h"
+.LASF2429:
+	.string	"pwm_output.h"
+.LASF2528:
+	.string	"cros_ec.h"
+.LASF2408:
+	.string	"src/main/scheduler"
+.LASF2418:
+	.string	"/usr/include"
+.LASF2443:
+	.string	"debug.h"
+.LASF2541:
+	.string	"displayport_msp.h"
+.LASF2465:
+	.string	"stdint.h"
+.LASF2457:
+	.string	"fc_msp.h"
+.LASF2550:
+	.string	"esc_sensor.h"
+.LASF2397:
+	.string	"src/main/build"
+.LASF2415:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2450:
+	.string	"barometer.h"
+.LASF2464:
+	.string	"stdbool.h"
+.LASF2522:
+	.string	"flash.h"
+.LASF2533:
+	.string	"displayport_max7456.h"
+.LASF2489:
+	.string	"time.h"
+.LASF2469:
+	.string	"wordsize.h"
+.LASF2423:
+	.string	"color.h"
+.LASF2446:
+	.string	"fc_tasks.h"
+.LASF2520:
+	.string	"inverter.h"
+.LASF2410:
+	.string	"src/main/target/SITL"
+.LASF2532:
+	.string	"spektrum.h"
+.LASF2535:
+	.string	"gps.h"
+.LASF2507:
+	.string	"sound_beeper.h"
+.LASF2444:
+	.string	"profile.h"
+.LASF2486:
+	.string	"common_post.h"
+.LASF2440:
+	.string	"boardalignment.h"
+.LASF2497:
+	.string	"parameter_group_ids.h"
+.LASF2536:
+	.string	"motors.h"
+.LASF2466:
+	.string	"libc-header-start.h"
+.LASF2454:
+	.string	"failsafe.h"
+.LASF2483:
+	.string	"platform.h"
+.LASF2419:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2526:
+	.string	"transponder_ir.h"
+.LASF2463:
+	.string	"stdc-predef.h"
+.LASF2487:
+	.string	"blackbox.h"
+.LASF2427:
+	.string	"resource.h"
+.LASF2539:
+	.string	"asyncfatfs.h"
+.LASF2442:
+	.string	"servos.h"
+.LASF2403:
+	.string	"src/main/flight"
+.LASF2458:
+	.string	"imu.h"
+.LASF2404:
+	.string	"src/main/io/asyncfatfs"
+.LASF2428:
+	.string	"light_led.h"
+.LASF2506:
+	.string	"io_def_generated.h"
+.LASF2455:
+	.string	"cli.h"
+.LASF2511:
+	.string	"accgyro.h"
+.LASF2500:
+	.string	"cms_types.h"
+.LASF2414:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2512:
+	.string	"exti.h"
+.LASF2504:
+	.string	"io_def.h"
+.LASF2406:
+	.string	"src/main/msp"
+.LASF2527:
+	.string	"vtx_soft_spi_rtc6705.h"
+.LASF2467:
+	.string	"features.h"
+.LASF2413:
+	.string	"src/main"
+.LASF2405:
+	.string	"src/main/io"
+.LASF2476:
+	.string	"time64.h"
+.LASF2496:
+	.string	"config_profile.h"
+.LASF2400:
+	.string	"src/main/config"
+.LASF2531:
+	.string	"streambuf.h"
+.LASF2468:
+	.string	"features-time64.h"
+.LASF2482:
+	.string	"strings.h"
+.LASF2460:
+	.string	"feature.h"
+.LASF2552:
+	.string	"navigation.h"
+.LASF2434:
+	.string	"beeper.h"
+.LASF2433:
+	.string	"runtime_config.h"
+.LASF2430:
+	.string	"config.h"
+.LASF2473:
+	.string	"stubs.h"
+.LASF2449:
+	.string	"gyro.h"
+.LASF2478:
+	.string	"string.h"
+.LASF2485:
+	.string	"target.h"
+.LASF2525:
+	.string	"usb_io.h"
+.LASF2452:
+	.string	"telemetry.h"
+.LASF2543:
+	.string	"vtx_smartaudio.h"
+.LASF2519:
+	.string	"bus_spi.h"
+.LASF2493:
+	.string	"maths.h"
+.LASF2456:
+	.string	"msp_serial.h"
+.LASF2477:
+	.string	"wchar.h"
+.LASF2470:
+	.string	"timesize.h"
+.LASF2399:
+	.string	"src/main/common"
+.LASF2538:
+	.string	"dashboard.h"
+.LASF2548:
+	.string	"voltage.h"
+.LASF2453:
+	.string	"rx.h"
+.LASF2546:
+	.string	"current.h"
+.LASF2417:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2459:
+	.string	"initialisation.h"
+.LASF2508:
+	.string	"rcc_types.h"
+.LASF2542:
+	.string	"vtx.h"
+.LASF2514:
+	.string	"compass.h"
+.LASF2451:
+	.string	"acceleration.h"
+.LASF2479:
+	.string	"stddef.h"
+.LASF2545:
+	.string	"filter.h"
+.LASF2521:
+	.string	"flash_m25p16.h"
+.LASF2402:
+	.string	"src/main/fc"
+.LASF2510:
+	.string	"serial_uart.h"
+.LASF2518:
+	.string	"bus_i2c.h"
+.LASF2436:
+	.string	"ledstrip.h"
+.LASF2484:
+	.string	"common.h"
+.LASF2448:
+	.string	"timer.h"
+.LASF2474:
+	.string	"stubs-64.h"
+.LASF2509:
+	.string	"serial_softserial.h"
+.LASF2490:
+	.string	"parameter_group.h"
+.LASF2424:
+	.string	"pid.h"
+.LASF2534:
+	.string	"flashfs.h"
+.LASF2445:
+	.string	"fc_init.c"
+.LASF2547:
+	.string	"current_ids.h"
+.LASF2505:
+	.string	"utils.h"
+.LASF2431:
+	.string	"fc_init.h"
+.LASF2441:
+	.string	"mixer.h"
+.LASF2439:
+	.string	"sensors.h"
+.LASF2499:
+	.string	"display.h"
+.LASF2529:
+	.string	"vcd.h"
+.LASF2513:
+	.string	"accgyro_mpu.h"
+.LASF2540:
+	.string	"fat_standard.h"
+.LASF2461:
+	.string	"io.h"
+.LASF2422:
+	.string	"stdint-uintn.h"
+.LASF2498:
+	.string	"cms.h"
+.LASF2438:
+	.string	"scheduler.h"
+.LASF2515:
+	.string	"pwm_esc_detect.h"
+.LASF2517:
+	.string	"adc.h"
+.LASF2472:
+	.string	"long-double.h"
+.LASF0:
+	.string	"./src/main/fc/fc_init.c"
+.LASF2447:
+	.string	"battery.h"
+.LASF2471:
+	.string	"cdefs.h"
+.LASF2494:
+	.string	"stdarg.h"
+.LASF2407:
+	.string	"src/main/rx"
+.LASF2475:
+	.string	"typesizes.h"
+.LASF2396:
+	.string	"src/main/blackbox"
+.LASF2530:
+	.string	"msp.h"
+.LASF2480:
+	.string	"locale_t.h"
+.LASF2502:
+	.string	"sensor.h"
+.LASF2523:
+	.string	"sonar_hcsr04.h"
+.LASF2432:
+	.string	"rc_controls.h"
+.LASF2462:
+	.string	"printf.h"
+.LASF2411:
+	.string	"src/main/target"
+.LASF2492:
+	.string	"axis.h"
+.LASF2426:
+	.string	"system.h"
+.LASF2401:
+	.string	"src/main/drivers"
+.LASF2435:
+	.string	"serial.h"
+.LASF2549:
+	.string	"voltage_ids.h"
+.LASF2437:
+	.string	"osd.h"
+.LASF2398:
+	.string	"src/main/cms"
+.LASF2491:
+	.string	"build_config.h"
+.LASF2503:
+	.string	"dma.h"
+.LASF2537:
+	.string	"gimbal.h"
+.LASF2409:
+	.string	"src/main/sensors"
+.LASF2421:
+	.string	"stdint-intn.h"
+.LASF2551:
+	.string	"sonar.h"
+.LASF2495:
+	.string	"config_eeprom.h"
+.LASF2501:
+	.string	"nvic.h"
+.LASF2544:
+	.string	"vtx_tramp.h"
+.LASF2481:
+	.string	"__locale_t.h"
+.LASF2420:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2412:
+	.string	"src/main/telemetry"
+.LASF2488:
+	.string	"blackbox_fielddefs.h"
+.LASF2524:
+	.string	"sdcard.h"
+.LASF2425:
+	.string	"io_types.h"
+.LASF2416:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375 \216\245\002"
+	.string	"\304\003\202"
+	.string	"\007"
+	.string	"\274\205\242\255\006"
+	.string	"\001\330\345\316\261\t*\002"
+	.string	"\001\002\002\003\002\004\002\003\002\005\002"
+	.string	"\002\004\006\002\006\002"
+	.string	"\002\002\352\263\360\321\b\017\240\342\234\212\n\020\021\022\240\342\234\212\n"
+	.string	"\t"
+	.ascii	"@D\312\225@\0069\273\001\002\004U~%\263\271\0026\320\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375 f\r\001"
+	.string	"`Z"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"\300\001\264\003\302\300\225\235\003\300"
+	.ascii	"5\347\233\363e\003X"
+	.text
+	.section	.gnu.lto_.inline.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"e\004"
+	.ascii	"\202D\020\034\2405\351\343T\364\177\307\376w\253\005\205\226"
+	.ascii	"\356\370\342\255\376\377\257\255\021]\032\221;\005\277\032W\373"
+	.ascii	"\364\027\301)\276\032\221\024\007\204\f{\032\203\177\t\003\021"
+	.ascii	"\300\031\372\236\302/m\331\035l\333\364\374\224  P\0021\330\335"
+	.ascii	"\257$\200\342\360\215\200\212\004\037\022-@\374\002\b\021\300"
+	.ascii	"\222\360\024\201X\214-03\b\021<\300;\353\026&\254~\r1\301A\021"
+	.ascii	"\r\3460\310h\036\320\255\030g8\t7b\332\262{#\2074\257\201!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375`\255"
+	.string	"U\006"
+	.ascii	"\342H\034&\2205I\007\377\271\216Nqg\213^\032\264\250\201\247"
+	.ascii	"\252\260\216|;\366\177\377\377\271%Z@\247\373\206\373\023\"\223"
+	.ascii	"\f$I\222uPUI\332acc\354\302\225\257\247\231\343\314u\200\333"
+	.ascii	"e\241\232\246\tG\f\274\301\003\242/\016\250\373\361\216\005\237"
+	.ascii	"\270v\310\212\262\303\310n\356\233\353Tt5V\225\311\223<;\nRP"
+	.ascii	"\364j\363h\006\\K\262\234\021) \300\"I\352\001\267\fN\"\324\270"
+	.ascii	"'3\333\0018l#\327\025Xx?\232\331\303y\341@@@\304\241\367|\370"
+	.ascii	"Y0\277\021\002\243W%\320\033dm\215\273P\304\36764i&\205n}s\325"
+	.ascii	"\256Q&\331\202rd\rf^\242\360\027\261V\200\202\0223)\324\020"
+	.text
+	.section	.gnu.lto_.pureconst.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\200\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.832f2e19e6c5b7e3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_processLoopback.137.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375 \303M\005"
+	.string	"\202\t$-pU\323\001"
+	.string	"\240\371\272\345\370\275\202\253\027s\005\226\252\3021b\0025\237\022\032R.D\363\365\252\036 @\314c\322\002V\f\373\367N)\236\022FU\224cN:'\255\250GD\3475Q\311`K\002\271\024\263\254K#o/\273\003EV\214\330\030`{Z\224\031\373\202\225\235\035\033`\b\260"
+	.string	"\355^\006\004\026\034|:\266\0379\263C\3676\373\217c\371\302\335U\251y\366\230\371\367\274\260q\332#\201\261\273\216\033\207\271\345m'l+lW\001\b"
+	.string	"3\003\366\231\341\300\367\273\206\247\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_init.138.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375`\330\reA"
+	.string	"\252g@\027B@\244N\0073\302\025\022\021c\260\334z\003%\n\004&\343\317\354w\347\246\325&\235b\212\314\356\013}\365\340^\260"
+	.ascii	"\361C\203\027\002.\004\\$\340+\266\342\016:\200c\310E\271\211"
+	.ascii	"\210\220\275\267L)\005P\001V\001h\001\337D\354\367\020\373-D"
+	.ascii	"\374N\022\277\221\354\367\221\3756\266\337\305\3427\221\375n"
+	.ascii	"\211\337l\373\275\262\337\231\375~\366\333Sx\230&mkQ/\231\216"
+	.ascii	"\024\026r(\b\016d\375\240\270\236\273\235\177\2673\221\211\320"
+	.ascii	".m\337k$\023\037\027\317{]\257\377\232\274\2440\364\002\036>"
+	.ascii	"\270C\321\331\2465\207K{)\260mM\207K\233\255\262\244w\270\264"
+	.ascii	"\227su\332\350`\030F\256~\327H\246-\021\234\316\353^\267\343"
+	.ascii	"\321\304%\205\237\027\276P\351\2500,m\340l+(:[\344\312\326\331"
+	.ascii	"\367\243\326\331~\273\365\270t\t\354y]\300\362\2500\f3\263\222"
+	.ascii	">\372*\365>\376\353DCBI\344\321X$\266\354\232\377m'j8\220\226"
+	.ascii	"\207G\347\013t\313\211\334|\310\343\247[\333\013\261y2~\262\255"
+	.ascii	"=re\353\224\331\363\370\251\266V8kr\305\367\334\300\224g\332"
+	.ascii	"\037\223\f)\342F\242\206=g\200\207\217\256\n7\244\210\027\r\300"
+	.ascii	"\rAs\342\312`\260\357\217Oy\242\255J!O\302\202@\301\276%\342"
+	.ascii	"\354*\341\213\2726\004\355\261&\003\201\305\371\372\265\314\363"
+	.ascii	"\020\324km\202a\330\357\374\305\240]\377D\r0\f\367\207A\207x"
+	.ascii	"\027y\267;u\367\221\356da|\236\262\3339\2067\256/\024\363\301"
+	.ascii	"wLA\035=\276\347\025\002}\311\310Zg\2372Q\233\tO<{\323\332LT"
+	.ascii	"\363;\202n\347es{\215\274FZg\333\\ \316\316\310\214\323\277\376"
+	.ascii	"F[6w\277J"
+	.string	"\336\270\257\274\325kf\363\0030C\006\337R'/\224\367\2605\233xs\262A\352\364\225bD$N\360\035\307_\271\266\373\235{\257(\241\317\3524\202\0048$\302guz\340\035\317\0037d\252[\227\020:\030\346j\343n\336\272\367n\303\206\346\320\301\357\034\005!\\\035\364\312[M,\003\347[\334\307\342\b\002RG8\024\345\303\2171\313k@\f\n\233r\265\bO3\242\b\303^P\355g\034\r\211\366&\316\266\211\023'Zgsf\022\264{0\207\237\315x\330\324}\331z\376\354`e]\177\330\355|\336\027\325\336\244\245T\274\2079\333\256\242u\3263\222 \032\327\0376\362\017\213i\213\301\330E\213@\352t\312\n\325\224&2J\234\374n\347\214\367\260n\352\312[\215\244&\260:\205\277\260[\332\3659\232\267f\2453\222n)\250'\327\363^.\271\235\267\022\373M\200\375\036\300~\013`\277\223\330\357"
+	.string	"\354\267\222\375Fj\277\217\214\337F\3547"
+	.string	"\366\273\250\rp\313\354z\277\3020\f\037\263\353y\223\003_f\251\354=\332\230\324\314\242<\232\273\305T\344Z6\270\025b\\2\031\224\326\006"
+	.string	"\252\245\305\024,\300\001\236\305\271\017\013\034/\306\006\356z\216\341\215k\317W93@\350a\374k\006\305"
+	.ascii	"\210\274/\333\242\f\200\254\350\327Tc\270(\365\356n\231\266\333"
+	.ascii	"\375s\3214\321<\253S\"'||\020s4\204\240\035\030\031\326\r\275"
+	.ascii	"\327U)/e1B':\001\350\262y\017#\312\023\224\177\203\325i\211\367"
+	.ascii	"-\037\304\225\223\361\264u\221y ?\346\276q\341\270r\\9-\035W"
+	.ascii	"0\252\357-\213\026\3671+\324 u\204\312\276\267\352t\350\177\254"
+	.ascii	"\276l\205\362\320\367\020b\223R\247!\036\231\223\271\337\313"
+	.ascii	"\315\003\341\273\336-w\217\313\247G\336\352\245\234\314~\314"
+	.ascii	"H\017~\\@\357a\307\354\177oGe\261[-C\266\324\346(\217\326H\220"
+	.ascii	"O\275\333-|\257$\375\n\215rm\252l\216\266;9k\313PY\207\231\341"
+	.ascii	"?e\245,\266\372\210\326\230_\340\tv\273\203\274p\304\262\335"
+	.ascii	"C\017\364n%-q\266j\314\313\243_U)k\340Z\241\244\272\034\320;"
+	.ascii	"\226\300\217\377y\277\300\336\037?Zg\241\262R0\351G\030'\301"
+	.ascii	"\215Y\313Zm1\277\300\263\343\365\201\232\3017\301\305,\341\315"
+	.ascii	"\313/]\345d5\345\314jj"
+	.string	"1\261\234I]\345d\343\252I\343J\206\323j\nF\326\024\326\013\246V\026\226\326US\013AW9\301hZ\271\260Q%\303i\305\324\312j\342pf\301`rzS\240@E\341\tB\204\tNGM-\253\033%\232V0\234\306\246r\262\341\274r\272\240\212\301\244\212\301\274rN\321`Rei1\235\0044V\215f\026\323\006\026V\026\023)\345\362\214\244\213s\316\002\271rW\023\310``_\266\0032\201\3572 FYL&\345Y\235zT\313\305L\305\322\222>\206n\201\324\351\231\236\232\264:\025\220\245\203<\252M\312\002\262\203\241\325\245%ee\334\0028dq\200\234\245\350\313V\231\003X\211RSR=\331\332\263@\352\364\352\275\213\333\013,F\026\304s1\321\325\347\247\367_\324U\342]b*C9\332\254\217h\221\036\312?A\312Iqvzdpu*\024\227ls\030's\264\217\212\360Q\226"
+	.string	"(\220:eb\350D\351\206\257:\255z\327\362J\\9W\322\"\350k-\372I\\)T\\9\2719\367J\224\233758\227:"
+	.ascii	"3`\203e|\b\373d9Sg&v\357\224\370b\027o\224\273]<7\257\237\355"
+	.ascii	"\333h\270{\256\027/\255\263F\331\210\006X\0078\007(\027\303\310"
+	.ascii	"\034m\242\035\243T\316v\212\r|\231\305\216\336\177\3552sp\023"
+	.ascii	"\2010\250a0I\031#33\"I\n\nRh\fQ\005\304 %!T\017\021\020\261s"
+	.ascii	"LQQ\n\351\242\214\364H\361y\212\004\330H&\360C\006\366ra+\337"
+	.ascii	"\372\231$\256\003U\b\240\001\027\257\2310RC\245\246\317\314\350"
+	.ascii	"st\225L\027\320\261W\365\332\274\224E.\254\030\275\254\306)\331"
+	.ascii	"\017\257\b\211\243\311o\327\313\032\317\260x\207 \232\200\003"
+	.ascii	"\231\001\322\371\204\216\267G\005;\245\370O\331\304mP\231\376"
+	.ascii	"\354\255Z\216\265=}\341\255\003\334\332\005\353\373\201d\277"
+	.ascii	"]\234~\227>N\314\312,\256\366\302h\233\240\220\346\245.\232\374"
+	.ascii	"-\201l\375f\214d\203B/u\252\250\002\200s\357\312`\266[\346\t"
+	.ascii	"\220&\2366EZ\031\246\311\026\022geP\345\ty\254P\303\3571\025"
+	.ascii	"8K\2740\355\352\203\313@\270\262\375]P\3674T\304Ni~f\035I\332"
+	.ascii	"\330\342\033\336\177\236S[\350\226\253\344\234A:\315\275\204"
+	.ascii	"v'|4\346\314O8\3055){\350\273\036\027\271&T\314'{\242\372\272"
+	.ascii	"r\037a\225\227\255\367n\270b\257\r\265\0209\2566c\375i\026\013"
+	.ascii	"wH\350\213\0320D\343\235\244\334F\"i0\331\364%\340tm\003\330"
+	.ascii	"\204U\300-j \351|O \374\227\3470.\3110\033\220\203\033\212\277"
+	.ascii	"\375\3221\013\214\212X\370\234\n3\306\026e9\031\002-^\204\360"
+	.ascii	"M\017i\267\n\035\354\252\tWLq\037\271\372M\353Q\005J&\266#\336"
+	.ascii	"<x 24\242\271%uU\030\003\013;\213\236W\n\201\031!HmqG\207\344"
+	.ascii	"\324\245\377IF\344\352\037\336<\334k\200_\030:\224\1777\335%"
+	.ascii	"\332*j\212\364\3226-\330\276\211z\223[\342\201\273\246\335F\267"
+	.ascii	"\277B\353D\351\344k\342z42\240\026-\326\024J\025=\t-?\235\022"
+	.ascii	"\367\243\250\216\261\222\250\003"
+	.ascii	"S/\261&e\023\016\211\332W\322a%$\251\244\016Y%\341%%\316\371"
+	.ascii	"<\225\255\3130\341S\n\262Q\336I*\376Mre6dX%y\006B\305\364\331"
+	.ascii	"\345\334\312\252qd,\024Xd$\373\307f8\270\302A\323\246\370SB\342"
+	.ascii	"\201\3206| (\330TVm\244\340I\027}R\313\211\210\317 \305\027\331"
+	.ascii	"\216\343\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375`e\0055\020"
+	.string	"\266\233bI\260\324M\322\001|(}\330\177!J?;{}\375\325\250O\027T\300\303B\207'\001'\301\270\244\221\026P\234|\326\370\177@\345\356\225\037\364\037\364\177E\013\200\007\tq\037$\260\2361\177pg\354196v\343\361f\211\004U"
+	.string	"M"
+	.string	"L"
+	.ascii	"\335\304]\327\275\027K\"\353<\216\275\b{U0\017\310\313C\362:"
+	.ascii	"\312e\035-C\001\370\007\3134R\246r\355C\300S\255m\005\226Z\271"
+	.ascii	"\204L\345\036'\357\275\341\006\356\243\023ZU\022\025\253{(\341"
+	.ascii	"\320\331\336\353{B\2206\351\272\2563\320;\224\274\367V\025\002"
+	.ascii	"\223`\320O,\350)\024\364\025\t:\013\004\275\305\201\356\202\250"
+	.ascii	"'\r\365\027B\035FP\217\001\324e\374\364\031>\035EOW\242\365\032"
+	.ascii	"O\257\261\323\227t:SN\267\201\323o\334t\0256\275\251\246;\321"
+	.ascii	"t\0343\375i\326s\310\364\0351\001Y\004sNX<\200\024\221#:\247"
+	.ascii	"\353\326\3329\271\310sr\360u\262\"\355d\301\3319\240\347L\271"
+	.ascii	"\251\234(\321\347D\201?\347*\002\235+\030t\036\205\316\341\320"
+	.ascii	"I\201\350\234\320?H\350 \"\364\020\020\272\210\007}\204\203\216"
+	.ascii	"\324\240\001o\033\027\237\202+\261u\036\005],\347P\260\345\346"
+	.ascii	"r\356\004_\361\345\274\t\302\2343\301b\354|\t\312b\314\271\022"
+	.ascii	"\22495\3242\300\231\023C<\207\330\212\004\231\235\027\342\004"
+	.ascii	"\236\214\034\321\234F\267\232\323\250fsZ\250\335\234E\021\347"
+	.ascii	"e\250!$b\321Z\303\326f`\203H\322\214\001\021pl\205\210\304I<"
+	.ascii	"\362\001X\034\257\250\364\226=\310\352x`\2665)v4C\024c\223\273"
+	.ascii	"\276\305V\353X\2306@\3718h{\316\021]R\203\202\236\220\255d\300"
+	.ascii	"\252Z\253J\224M\2220\243\033\335\344&\037\371\350F7\271\311G"
+	.ascii	">4\377\217\344\206l\243!\0348\277Q\244\255\177\366\217\371\261"
+	.ascii	"\036\313\026-u\377\3743\360\253"
+	.text
+	.section	.gnu.lto_.refs.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375 {\025\003"
+	.string	"2\007\026\037\200M\2411*\244\314\0253\002\b\320T\0060!\023\322\302\307\240\300"
+	.string	""
+	.string	"\243@"
+	.string	"Gq\313\024\357S;O\275\216b\307I\3546\211\247A\3542\210\207\031\274\313\241\316bx\2114*\324\242\332\241:h\252\224\351\ta\311td0DP\035\201m"
+	.string	"f\324.\352\036\257\004\002"
+	.ascii	" \004K0\241"
+	.text
+	.section	.gnu.lto_.decls.832f2e19e6c5b7e3,"e",@progbits
+	.string	"(\265/\375`A4=\352"
+	.ascii	"*l\265QU \fIJ\035]ML\252&$@\321\360\374\256\323\265\210fF\363"
+	.ascii	"xWK\276j*t\376x7\371\322xzU\213\350\031\230\376\013<:\253l\325"
+	.ascii	"\205\367\032?Gv\346v\n|\002\335\321\325\217]h(\346\362\034\207"
+	.ascii	"]\002v\353\342%\233\371\365\242\204H)e\n\210\004\367\004K\005"
+	.ascii	"V,\210\2612L\256\330\220\344\235\317v>\367p\211\256`\343\312"
+	.ascii	"\233%\215\267\254\340\340\277\202\305\177\305\005\377\025%\376"
+	.ascii	"E*\374\213z\374\213r\374\213j\374\213_\374\213T\376E)\177\342"
+	.ascii	"!\347\200\b\310\237(\307\237x\3063 v\361'J\361'\036\361\337\204"
+	.ascii	"\374\255\270&\353\312H#G\264j\256\214J\367\342\204\021\031yF"
+	.ascii	"\216\221\261\3605_e\253\253\f\203\003\323=\302\260\342\017'~"
+	.ascii	"Q-\373w\033\377\275\203\377\336\342\277\255\370o)U\226\n\321"
+	.ascii	"\244\025\230\367c\262(3=J\204\004\013B\351"
+	.string	"\321\227m\221Y\344\251\354\"Ge(|\315Ry\305g\247\374\364\273L\n.\313Rx\360\337\264\331\224\202\"=;&Y\n\377)\311f)L%7i+v\002=\352\262\200R\270\t~\022\003\265\366\351J\017?)\030\207\233\227.\251\021\274\230\235;\266)j\330O\316tC\224B\206\224\226\345\217\313zVV\221\227\2624+e$|\315\323\034}<\005\023~\266\366\036\305kO\254j\220\fM\362\242\332\273ug\232O\344\024\332Z\r\341J+\333!O3\021~\242\255X\216\302\007U\3260O\361!\306\256\\\321\240*\343p\303a\377\025\342\275\305l\\\005\003\346#\027*qQ\263\274\263\321~\252\273\342\312\373u\032\317E;\237Q\020[\030\201\241\225\267\213\266\362\327]\374u\025\177\275\304?\037\362\317Y\376\331\216o\3006\305\027\\S\314\200\216\343)\266)R0\343\033\007\377\234\305\037\233\305N\360\225"
+	.string	"8\220\b\265vk\326\252\262\326#\357\317T\376\230"
+	.string	"E}x\210\tP\374\354\304\377.\027\361\317.!"
+	.ascii	"\217\n\001B\206\225\370\305\240\"}\221w\037\346\303W\354\207"
+	.ascii	"\223<\336\303A\254\032 \301y1Ok\227\026\255\336\244`\203\035"
+	.ascii	"\374\360\t\030\213\357\240\272\326\273J\301\302z\267\336p\340"
+	.ascii	"\2602\326\207\203Fq\347:\376X\b\307y\031\343a\275\307y\370\356"
+	.ascii	"%\212\3636\276 \006\343\013\210q[\320\036\305\375\330\215?\026"
+	.ascii	"\343\377\330\016\317\301\3445\345\021\311\373;\fAZc\223\342 "
+	.ascii	"p\030\033\363\234\351DzJU\r\020\240\001\236\303B0V[\253+iVI\331"
+	.ascii	"\336\255;s\330\f\253ik\265w+\030"
+	.string	"\003\200\236\300fd\260\367^\004\037\301F0\035\256\303W<\207\343\036\023\301r\217\255\034n\364\020%\025?^6\306\3026E\033\\\304\177\004\377$\177\r\360\031lS\304@p\033\276^\300oV\031\030C1C*y\277\005\370\013\317\277\333[\200v\r\036\207?\276P\304\207\370B\361_\370M\017\036\330\212\323>\320{\264\367^!\346\016\fl/o\354\003\377x\234\206\321\036\001\032\274~\236u\262\336;N\363@\355\035\212\323d\n{\207\312`|\001\306\027l\035V]l\305\375+\034\237\355<\356QS\234BY\273L\3135;&\315{&sl\204m\2124\270\246\250\001\333\024\377\361\016LvA\033!Q\273Z\357V\032\031\353SR\214\274\337\212m\212\034\327\024\211+,\370\307J\377\270\211i\303R\326\231\376\347\016\322\377\274\201\322\177\346\371\307Z9\t\351?G\340?\253H\361\237A\034a\230\177\\a"
+	.ascii	"\377\030H6\372\307\024\374g\024\377\230+\227P\364\377{\3778-"
+	.ascii	"\237\370\317\032\210\376g\031\"\003@\377s\317?\216z>\335\177"
+	.ascii	"\356\377\330,\227\340\377\3372\t\376"
+	.string	"s\353\006\341\260\021\374\343\017\374\347\020\377_\302\377\343\375?\316\177\026\301\1776\361\237G\374\177\340\223\370\327$\036\377k\347\177\006\301\177f\376\347\240\377l\302\177v\377\363\317\177n\3773\362?w\340?o\340?_\340?W\340?S\340?K\340?\207\360\237\033\360\237\023\360\237=\374\347\f\376\363\001\376s\001\376\363\005\3779\303\177\276\360\237-\374\347\t\3763\205\377<\363\237_\376s\313\177\346\377\271\370\237\363\177\376\177l\370\217\013\3771\341?\376\373\307x\377X\356\037\017\371\307p\377\030\373\217\257\377\270\355\037\253\375c\264\177|\366\217\313\376\361\330?\026\373\307_\377\330\304?\366\372\3076\376q\327?\256\361\217\251\376\261\324?\226\376\343\366\037\037\377\361\206\177|\341\377\225\374\277\337\377\327\375?\331\377\203\360\377F\376_\037\036\036\036\376\353\227\377\027!\377\002 !\304\252(R\3248\214\023\317\353\3535\343y"
+	.string	"u\326\231d\254\270T0\265T\211\362\020\003\3431`<\257\331\256\232M\267y\200E\205Z\005\300\310\335\036!Q\353\311\213(o\r\244%\212\\[\327\025\377\030)\257\200\312\363\372\007\276\352\037Zm\352\322\203N\n\366\222%2\325\246\323n\\\214\354\305\240\221\367\307<\371\303"
+	.string	"r\013hh\030+m9\201\00787\330\373\034\006/S\314\246\370\261q\230#\236\327\326\307Wm\325g\373\251'\245\202\t\006\324\216&yk\263\215\202MI\306\030\177\230\031\334\002 \217&\303\272\f_u\031\306\336\364\247\223"
+	.string	"\304-M\3470x\331#\202\243L\212?\306\330b\006\260\2611\r<\371\b\303:\024\324\006}\344I\335V\336\017\363\3043\324\361h0\235\343u\330\277\016\323b\274\367~\023g\203\217p\260CMmXY\033B\255\001\005_\265\330\003\276t\034b\336\027\027\333\037\377\377\307\305\016\235\366\336\231\210\326>%z)b\"\206\301\032\003\340\377w\357\377\337\201O\357DnYA~\343\r*\225\367\377k\350O\274\233\032\241U==\250Z\212V\2610B\253\352\317(\327\223f\332\253\236Fh\275\323\364h\364\t\002\265\323\030\241\365\245~\"o\twk\325\263G\251\235\246G;T\203Q\264j\311\b\r\272Dc\204V\265\324\321\252\372L\217B\247G\321>\245\351hUN:\032ui\306\b\215\272d\204V%\206\247\216\366\350\232\332\2623Z\340\247Q\264+%MA\2473wFVj\357\353\035\253\025\365)"
+	.ascii	"z\237\242N\373\240,0\226\350N\211\250\rJ\355\025$\021YQ{\364"
+	.ascii	"\316\350\213\332\373\027\021PO\362\360\264\336\365,|\367\214"
+	.ascii	"1\325\221\212z\267 \251\367'\356w\275\367g\357}e:e\355=j\306"
+	.ascii	"\250\232\224\324;\324MR\237z\006)\352=\253)\301.\031\241YQw\202"
+	.ascii	"\374@\253v\024\326'\256\366\276\252)G{\232u\244'\274\272\324"
+	.ascii	"\024\2307\013\224\347\365\327\343\253\376\322R\373y\326\2371"
+	.ascii	"ix`T{\006\221\365\205\r\316d]a\021\307'\227\267\005P<\257m<\276"
+	.ascii	"j\033\272kG\317\372\323\245\307\237\024lpe\207\326Y\025U\265"
+	.ascii	"\253\250%\255.\311[s\r\021k\202\312\373_\246\274\002\f\236\327"
+	.ascii	"\324\307WM\3255<P\343=\032HV\224\212:\001\230\267\226\314\023"
+	.ascii	"# }\207Xz\206\316\302WMC_\305\350\"\223\241\255bXz\257\022\253"
+	.ascii	"\322\3200\264\025\276S\353{\306\263L0\254\367.&Xg\306\367\273"
+	.ascii	"\274\361w)\343\357\342\365q\272\ng\311=\263\362~\027\032\374"
+	.ascii	"]\\\360wA\241\251Z\330\370V\224M\321.\336\n\243\241O"
+	.ascii	"uozJKmh\340\321\213\274\243\362X\330T\211\217Ci\026\370\252["
+	.ascii	"h'\334B?a,\325XU\267\320Lz\305se\006\f0\252A\016\034xY\212/#"
+	.ascii	"\305\375-e\374[j\360\327+\376\365\022^\313G\272p\211_\222\274"
+	.ascii	"\361\336\316\353&\215%RT\030\203k\\S\244\200\307\363\231\357"
+	.ascii	"\3615\363i)~Nq\357@\364\006\263\275Ca\320\202#k\360E\336J\370"
+	.ascii	"\311\256\2120\357oq\342H\371O\243\320f\323\n\020-I\241U\350$"
+	.ascii	"|\325H\332\350s_\366\353\200\224\2270\311j$}\364\327\242D"
+	.string	"\217P\006\337\337\022\345\317\002\205\277F\361\237\225d&\272(S\005pUEJ\336\372D\261\3104\313\227\367\263\344q\250~\346\303l\250\211t\307W\035\315\205\277wt4C\311\204\332l\312\337\210\214d\2538\261\323\321L\205.\233\003\237\324U\311t4\013b\354\002\314\270\276d\366\244\250\025\211\331\317\342\305\237\345\005\177\026\246<\005\243\245eq*<G\311R\3605\017\376>\243v\030\227+\254\0324\357\022+\037W|\236\345\317\355\370\3636\376j8\370\317a\233b\006\334\371\334\004\203[\\\220\274Wx\026/v\336TS,RO8\344Y/\237\200\257\033r\222g\211Z;\032\313\336\023\027jy\377J\024\376xCQ\006o\310\303{y!F\305\"\343\271\265@\261\313\272\226\345h\241\301\226V\326\006\026\023\036G\331\2560\250|\343k\252\352\244C)[\226\002\207T\225\213\306\216\017\303l\215\032Av\250"
+	.string	"\024\223\376\310h1\272wh\225\252!XTv,\273e\263\214\206\357\240\266\216C\300j\026\220\034\227\221d\271|\315v\231-\033\311s9H\276\313G\262\220L\227\261\271-\017\311Er]~\313D2\034\276f\267\234\366Y-\257e'\267L\206D\303-km\345\256\354\226\275\236N<\334\300\032\022r\352^\226+g\357\2736,\377\0257\376+l\3743\332\177\016\233ppO\301\323i\357\030\244\231\225\tN!{\321j!\210\004\007\327\320\264\237l)Ov\224\247"
+	.ascii	"\355\235\250w\252(\r<\236\\_\203\035j\305\206(\033\212\2211\253"
+	.ascii	"\024([\360\004$.\310\2248\326\227\264E\336_\001\026\317\320\345"
+	.ascii	"\304\211\026k\242\021\266\242v\255\241E\3103`5i\242\305\232\004"
+	.ascii	"\022\275\344\240fMx\006\030\177\177Z\254\203\0362\210\204\345"
+	.ascii	">k\3365\215g\210Z\262D\213YY\221\205\261\360\345\330\342\202"
+	.ascii	"\30134\371\371\255U5\2155\302\233'\236\001\211\217O\213\341\031"
+	.ascii	"+\221\236[\325\305KNnp\220g8\261\223\354$z@T0\301Ew \371\343"
+	.ascii	"\030\372\354\354\266\236\0230\252\225\272\247S\217\274\337z."
+	.ascii	"SjM\016\361`\376\310\334\016\361\356d\210,Y\341\242X\230^\270"
+	.ascii	"\240\201D;\265\254(\022\366#\t\307\200=r\304\003U^po\2022\346"
+	.ascii	"\214p\f1\344\3446\235\003\234p}\275\210\002\243\310o\272\267"
+	.ascii	"\2602\271\274\367\034\316ck{\201FHs\342\331\205\345\030\232\260"
+	.ascii	"\330\035\227$\005\013\333{s\200nC~\307\025\013\255TIB\f\253$"
+	.ascii	"\251\345\275\341d\276\2441\212\240\355 \370\204\342\220.!e:8"
+	.ascii	"\006\350\365\352\007\3252\f{\t\362\225\002\272\305/P\341i\373"
+	.ascii	"6-v\303\373\016\037\322lX?\003\204\342\027\374\326\3266[\321"
+	.ascii	"\312P\nfuC\312\206\265\252BQ!\005\277\260f\265\3564.\252\262"
+	.ascii	"\260\254\367\024\202\344\307\357\264\226\266;\264\303\274\367"
+	.ascii	"\331\366\321\362\026e\265\341\003\315e\b\\\030\021S\214\013'"
+	.ascii	"7x\364\310Q\026iUj0\357m\206\237\304\270X\013s\302X\242U\024"
+	.ascii	"&oU\370\205\033bb\273,\315I\231\340 \323\364\306\216\337e2O|"
+	.ascii	"N8\3108\326\323)\b\331\330J\033S\030\227\026L\031\220\270\264"
+	.ascii	"\274u\350\253&\256\271\034J\370\205\031``;\007\276:\213\022\245"
+	.ascii	"a@yK\312a\343\206\025\322\r~\341\311\313k\177a UM\002-@\252\252"
+	.ascii	"\335\370\375\345\"\347Cz\246_h\276\245\032c3\370\205\024]]\273"
+	.ascii	"Z\354A\246\202i\260\205\312\306\322\341\357j\336S\222\343\256"
+	.ascii	"+\357\247\340\211c\220\333Z[ko15\t\254@\224\253\032\277\267\266"
+	.ascii	"\036\217\275>\233'\034G\320\352\255v\026>\353R\236;CB\035Hw\025"
+	.ascii	"\003\353w\026\313\026\224A\0323\\\354\242\230\372f\310 \3669"
+	.ascii	")q\305\330W \376v\310\355\361\0309M\323m\315=\261\3438\1770`"
+	.ascii	"x\001\256\240*L\261\203\343\354\275x\241\305\362\226D\031me\307"
+	.ascii	"\362~\033)\216\203\304\205\013\013\344\361\025B\335p\030e9\316"
+	.ascii	"\332\323\323\226\272\241\352$\201{Qp\0251+\277\250\337R\315\300"
+	.ascii	"/\272\335\002\316(\210\335n\261\241dd\231A1q*"
+	.string	"\233\312\233\2056\372\377\016\363T\244#M\b\3079[\261B\213\301\351\321\205\255(a\203Zaq\2341&&-vS$/oN\217H\211S\022\307\240c+m\245=\235\221\247e8\b\203\204\351mI\372{\212\363`\240\370\270+\313{E;i\341\004'8\316\027\022\022\034\217'\035%x\024\307q\254R\244\330E\035\316\306\206P\200^U\363\376\232(\2163ed\244A^\016C\231\262!bO\3668\216\212ht\027\335P\365\037\034\330\024\221\205\017\026[\373\304\357\"]G\343\006Z\336\017\005?\371\177\226\315\343\006\224\214-\216\023\335\320\r\365\200\227\027\\\261H\016Aj\336O\241\210[\250\302\263{\023hW5\246\354\n\270\344\b\307`hh\250\305n\250\232\357L\3130\314\205\272u\344H\213[\210\302SX\250\305\360Y\227b\037y4\34064@j\t\213\274\237\346\004\257\261\343y\335\244\211&\364"
+	.ascii	"\312\332\2312\260t8\025\266\206#\251kB=\005E\322\n\260\274\007"
+	.ascii	"u\032\021/*\204\374\361\332\223&U-\250\263\f\320\001\230\325"
+	.ascii	"\202\332\211\033\234\fC):\212\026\324\201;\253\304C\220\357\237"
+	.ascii	"\251\343?\003\307\177\006\313\177\346\312\177&\215\3274\341y"
+	.ascii	"\255\247\247\377f\212\246,JItdY\002W<\r\346?&,S@\275\274\274"
+	.ascii	"\227X\363\214\3023\254/\376\035\264\2376\242\373\254\252(\301"
+	.ascii	"W\355\247\223p\270y\201\342\342)\265\367\353\276\177}\002.\304"
+	.ascii	"X\026\027.\362\210\362\326|}KA\234\362&\302\340\305\231'>A\347"
+	.ascii	"y]\344\252\213h<\334\253\023H2\226\355S(\fb\246\\\215\252y\337"
+	.ascii	"\305\3408\"g\227\367\317tn\207\257\032\211\246{\254\221h#\272"
+	.ascii	"\256/y\b\262t8\365\262\344H\214m\357\327u\377\271(g16\304\024"
+	.ascii	"/\262\274\263u\347\365\221b\230\021\025\035w\374e\330\370\313"
+	.ascii	"\220q\013H<\257\211\020\321r;j\355K&,Q\231\306\254\305I\201\313"
+	.ascii	"[N\206\211[\310\343y=d\210\b\033|\204a\230\312\021\024\324!\217"
+	.ascii	"\351\343y\r\007\207\261[G;\025YU;a\315\324\236p\031,\026c=\200"
+	.ascii	"\242>\0035\330\200\021\205H21BC\"|\336\245\333\024\242q\205\\"
+	.ascii	"\\\345\261\207\251\fa\004\020/-\307\367\bB\322U\0361\340\\\272"
+	.ascii	"\307w\311\374\3206\207\234\313\366\202\b#\220\020\002\002\020"
+	.ascii	"H\036\333f\013\213\263\2455\2724\217\255\362\303\313\bmsh\002"
+	.ascii	"\021\336\366\007\346\345\001\024\234\256\362\350\276\310\366"
+	.ascii	"m\223\314w\350\003\032\027\037\237\021\232\255P\333>\340m"
+	.string	"\177L\034\225m\222\370&]\241\241 \367f(\310]q\006U@F@\310\031\304b\024r\006\341\210\020r\006\271J\244\016r\002W\211l}\216\316\227\007\312)\321\324)\321\254)\321,\256<P\316\0050\017\224\263d\272G"
+	.string	" \221\307\n\017\224c\201\211\237\267\rb6[%\322\304\207f\217\253<~x[\021\314\346\261\347\346\201r\336\346\361\025\321\274`\242\331\276\357\261\307G\247m\016\275\3076\002\037"
+	.string	"!\337\243\262\346u\227 \234&8\217% }\\\336\007\312\321Y2G`\247q\204\023\250\005\b;\261\263\370~hy\037(G\310m\276\316d\253\324a\272H\242\323\350lm\234M\246\022\331\n9a\230#,\264\306\026\331\034b\212x\207\204\226.L\253\3549.!\360\263t\203\232G\227\007\312\tr\337\345\220\363\347\250\214@\333\262l\233\315!$\315k\363\352$\225\356PO\005,oM\373\036_\021.\373M@\036{\204\230L\n8\235-\222\331\024\222y\244\333l\227\355\017\177\017\033\034`\003\016J\254<\007\n\310@\001\031\024\237\003\005\354\354(`\203\035\376\033\354h\n(\274G\035g\223\351\\\266\316"
+	.ascii	"8g\224Jf\323e\305\331\266\315\237\026\004 \344\353\n\275\274"
+	.ascii	"\3136h\371\343*?H6\217\314\036\233\326\3306\207\224\356\321\007"
+	.ascii	"\346m\225\306\f&^\267yT2\205x\262\245\200s\210&\331*W\336f\373"
+	.ascii	"\"\217\306\227\311\354i\2333\316\230\367\201rt\230\356[\201\202"
+	.ascii	"\t\316\243\bK\246\373\"\227C>/\255\021\304\333d\206\240\240\331"
+	.ascii	"\272>\356\273l\223n\213\2203\310)\364C\223\034:\366\030K0{L@"
+	.ascii	"\036\225=\0248\337&S\310%\004@Fc\373\036\223BCF\033\021\312\243"
+	.ascii	"\333l\2355\257\021\001\035\036('\351\n\3358\215/\034\204\310"
+	.ascii	"\034\200\310\034\200\220[!\023\257\261\331\276J\327\207\346%"
+	.ascii	"\004@F\037!eK\b\200b||\230\357\020\322\b\204|\231K#\205\020B"
+	.ascii	"C\311\245\233\201\n.$\216\032\b\032\022\221t\205b\220\306\366"
+	.ascii	"\347\330lG\034\215K\347\262\025\nb~H\272!\336c\317\210\232\245"
+	.ascii	"+\302\373A\322\025\232i\225?\313\017dL\274\356\b\367u\235\313"
+	.ascii	"V\204\262\035\321*g\222J&\220\263m\002\225P\002\005K\367\030"
+	.ascii	"B\223\371\036\233\255;\001\323}\217$\2248*[\022\234\024\332\f"
+	.ascii	"\274K\227)\364\266\"\202\232\355\233\254!\201\304\321\004\315"
+	.ascii	"\353\006\271\024P\266H\344\007\355{l:\225\314\346\273d\"\215"
+	.ascii	"\310\246\016\322\007\007\204\0163$\230\312\030\240\037\027H&"
+	.ascii	"\331Ayl\276C\355\222\305\230\354\220\\\036{\222\3076Y\003\363"
+	.ascii	">P\316;$\364\0161\215A$\204t\334fR\303k\\q\376\034K`\272\305"
+	.ascii	"\021-\b/J&\222\3712\233!f\226Lw\t\"\210\004M\020\211\020\311"
+	.ascii	"\026\2714\341\\^\240u\016\305\230h\276mP\253lKx\231@N\020Z\347"
+	.ascii	"\020\315\2106\251\337e\213l\266!\336\326\351\3433B\253L\202P"
+	.ascii	"\036_\367\307M\336,\335 \227V\371\276\314&\320[\342\030\344\362"
+	.ascii	"\0327\330\341\311\3451(\210\211\\\272A-\357r\210\371\241U2C\304"
+	.ascii	"<P\216\316\013\364\343*-\200i\223L\021\232m\t7\210E\311d>\300"
+	.ascii	"HL\266\316f;\242m\032\235M\346\313\f"
+	.string	"2\2228\232\250y\240\034\3443\205\332\246\316\313d6u\\\234\306\037\327g\311\374\020\324\276N\023\316\230\022mr\t\"\351\n\311\264J\327\207\331\f\321\276G\022\332\021\356\213<\322\264If\220\361g\250\247M\266\274F\016\336\245;\264\362\035t\200\354\300C\006;\032\344\324|\007\035|\320p\201\n\204\300\2219\257\273t\215H\037\035\244\217\316\322=\006\351 \233N\235\234\nN\244\373:\335\367\370:\215&8\217\257L\363\b\204\334m\320q\271\337\251\210\030\007\344\211\265BK\251g\205'\232\266\024L\007\254Q%2\355,*A\302\301\245]\2259\242\002\244B\234\356/\342\222\2741\033Di\216\007\004\"])\325(v\355p\312K*\273b\n\222\004I\337h\241\232\302\203H\305N\363\340\243\206\223\024l:/\206\027\216\243\266\273\254\036R\336V\253\013\226jm\005\212\035\307\002%\027\246U\244\325b\256zL"
+	.ascii	"O\320\341&\031,\246\321\251L\037\365\n\211ho\2411\231R\205\b"
+	.ascii	"\325\263{3<\314\333J\366\"\225jQ\211]\237\341$Iln\207\030\233"
+	.ascii	"\365\352\220\210\3626\324bk-\260\254\362\326\360\203\312\256"
+	.ascii	"Be\027\346\314\300\003\243*\304\203\371;\361\246\205\3065\240"
+	.ascii	"\030\f\204\177\250\263\302\223\211d\272\3440\305\224Bh\214\244"
+	.ascii	"I\2321\003\025@@Hd(\031\017\210\255\007\023@\323\313\363\241"
+	.ascii	"\222\226\316\325l\2224\006\226\222#W\235X\336;(\352\224\005\003"
+	.ascii	"\223\346\325\320\205\022\025\271\031 [,\320\220`\335\026\005"
+	.ascii	"\241\350Y\302\n\214\323\310\330f\363iy\240y\251q\240\224\201"
+	.ascii	"\023\233D\244t\205\bX\023\351\365\333a\253.W\253\235\016\347"
+	.ascii	"\211\232\304\324PN\346\201\f\026\310\364+\327\213\222\023\023"
+	.ascii	"\275\230`\007n\221\224W\027\233#,J\255\321\023T\220]\357\210"
+	.ascii	"\375\355e\034\227\300q\005\345S\2611)\260\350\013g\246R\330\361"
+	.ascii	"\346\354\256U\2209\254\252\007\314\363\324\036A(\342\306\024"
+	.ascii	"v\240\232*\213\345z*\372\033\023\327\231\307\340\241\374\271"
+	.ascii	"\205I\324\001\257\317G\013\257\350!\023\243-\205\033m\270,\373"
+	.ascii	"\037\370\240[x\265y\212C\327(U{x\020wE\244Q\003\215\211\355%"
+	.ascii	"\035\230\f/[\346-<\201R\356E&f/\034\301]\225_\247\265\305U\313"
+	.ascii	"\343\356\373\230?VY\023\f\216\253\030\330VJt\025\272'#\236sQ"
+	.ascii	"\201\017\350\230\374}\202Gp\304EU\273\005$0\254\207\3423\262"
+	.ascii	"x2\204_\305\r|*T\362\021H\017\3744t)\313\f\007\277\0167T\247"
+	.ascii	"\2730\246?O<:\211\202B\237\017\242\242\003\245\325R\250\2413"
+	.ascii	"\362p\244i\333\366$2`\370\205M:\222y\320^\243H\327\224\336d\021"
+	.ascii	"B\n \374\260\240\020y\022hUI\312\3142;\357\325\300o\255\177\247"
+	.ascii	"\023l\261\333F\327\256\022\003\275S6\335\347{W\002`\200G\251"
+	.ascii	"G\301\321\036\220\021\377A9)_\"7\312\310/\317\002\342\277\311"
+	.ascii	"~\352\027K\247\351(4\204\345\265#\0074\252/9p\020q\270@\246:"
+	.ascii	"\366\221\023\2034\355\244\263Q\250G1\006\201\031v\275[\001\""
+	.ascii	"Mk=7\002iy\306\004H\250\357\f\371(\276\362(\204v\033\3328C\204"
+	.ascii	"\026\205\236\254\204[d\002\232E\210\370\201ab\205C\371\312\307"
+	.ascii	"\327y\211\334\035\226#\303D\"e}\313y/\202\373.\037E\362'\342"
+	.ascii	"\334'\246_\355\353\314[k\026\2606\302w\250\004I<Uu\306/\362y"
+	.ascii	"@\323\271\375/M\237\311\350\240K\363\222,?\003\235f\024\202\007"
+	.ascii	"B\245k\f\333\245-_\206a\325\2079q?\221Q\362\347\007xEhX\220>"
+	.ascii	"\275c\217x\213d\371\337N\222\251Q\216\335\277.\262\013\270\f"
+	.ascii	"\267\363o\324c9\356E\205BWb\316A\325\351\357\036\274\201\310"
+	.ascii	"\205\253\222\344\253d\360\203k\032\253\240\341\222\334\257\226"
+	.ascii	"{\020\321\325\021\212\356D\"\224+\304\301gB\276\235\b\326{\377"
+	.ascii	"l\342\033\263\333\210&\276\272\3147\272\215%\r\323J\325\206\004"
+	.ascii	"\363n\270\036\334\257\032f\202\2009\024\3064"
+	.string	"<\206\305"
+	.string	"\235\362\277A\001i[\305\271\032$\302O\362\262\003\372\3436o^\233"
+	.string	"\250gi\332\265:\300bx\233\256\206\032S.1\3403A\324YOtv\360\242>\034\337\3337t\031\347\232W~:\350\244\226\216o\302\210\232\006\016\240\210\307\354\236&\267e\270F\302\377\330\233\005\f\3236-\355\311\022\3200\345Y\202\261.\237\257\307\362\271\fe\260\365\202~\247\333\225\b\245\020\363\331Ki\217\266\206<+\370gyHq\036m\364\245\206\312\332\352X\022N&/\273\216\252\337Y\330J\237v\246A\322\317D\254Y\312a\206\004\202\025\234D):\037\001\314\250\334\340r\266/H\007\246\025\213\375\031\254Z\344#"
+	.ascii	"vb`\fB\261H\325!\020@f \247-\270\316\307\312\367| \367\347q\354"
+	.ascii	"l\276\321\204\355\367\t\030\343\002N\201X\254#k\305\200\306:"
+	.ascii	"\207fD\360\323\001\262\236\227m\320\247\362KT\320\023\333.2\226"
+	.ascii	"B\013B\320.n\371U\367_\353\\\206\274Co\320]\030\265\030$\024"
+	.ascii	"I\244\342\332\0222&U\274\375\230\302\355O+O[n\222\343N\n\307"
+	.ascii	"\326\321.\213\313~S\177*UwA\326\005\356\f\002\350\215\331\310"
+	.ascii	"u1y\bf\243Y@`\274\367\377\257"
+	.string	"-wA/W\3416f\bq\305\225z\351\205\3215\327\364$\374v\003t\373\01362/\232\2407lq&\013\204\237\005\206\032\272\270a\325\260\362*\004\344\363\355l\325\303\257\201Uk0\366|\036\371\234\337\263\0177K\273\324\271/-\302\312p\357\374\257\3337\237(\006\t:\305\330\374\345D\236\254\375\f.\311\037I\250\261*I\247\243H\036\370\352\016*\216n\020D_\212\027\256Q\243\306-\341\305\255\204]D\245\2173\004\253\312\tQY\207\340\201)\320W9_\017\223\362\203\"\272\210=Q\351\256\030\0357\242>S6\002\347\016Z_k\305\377q\305\002\301\021R\023D\f\326\031\256\204\300\347\320\224\331\217gv\310\204\214z;j\204\233X*\213-\0324\373\360\365\311\217\243m[)\001-\351L\340\320\f\013+\265\007\320\304\276MO\320u\226-\261Y\213x\210\246\210\006?\257\344\034YW\314U\022:"
+	.string	"\254\201\260h\013O\223i\" &\032=c\251\337l`\354\304\017\217\257\361\027\t\372XC\362\340 \247\246\337\306\2776\022\016L\253\013\024\255y\353<\320\026\272\327\026\262\312\342\323f\350u\320\023\351\320vO\242\232\350@F\203 ;\t\033\301\027\2434J\311"
+	.ascii	"\226!\214\242\3478:Rbi\371\t\r\323\275\231\240\031\333E\332\007"
+	.ascii	"\024\250\253=\304c\346E;IF\233\235\317\0247\277\266\2057\037"
+	.ascii	"l QDn\351\312q\fRr3k?\303\353\321\221;Vg\241-\240\230\230~\003"
+	.ascii	"M\211\353\251\n\tw\336G\341\207\213i3\345\317\036V\366\335\024"
+	.ascii	"\3306\034\220<U\311\f\231\246\025\367I\026i3,\n\371f\267(\264"
+	.ascii	"\372\020\251Ra\\\365*L\215\261\320AhP\017?\340\"{c\360|d\235"
+	.ascii	"\265\203\f\201%\r\355t\374\227\"_\262d\352`\013TQJ\312 \341\225"
+	.ascii	"WA\256\002\274\003\2021\023DLH\007Z\353\201\274\204\276^#\333"
+	.ascii	"\363,\235\230\237N\236did?\357\364?\276V5\024u\3774\021\253\206"
+	.ascii	"\234p\030\251\2326d2u\321\344F\255C2\212\006\331\316d?\241\242"
+	.ascii	"=D:\210K\222`\003\377lx@^C\356\203\264\271\221G\320-*\210\340"
+	.ascii	"\3301[\313\270\364=\366\370\366\262\351\322\353\333q5jv\037\363"
+	.ascii	"\257\241g\335\242\273\001\360\\\357\374\306\221\266\362 \035"
+	.ascii	"k`\243\362\215\236`\026\311g\225\352\273\311iy\030,\221\245p"
+	.ascii	"\013`\256\324\326\b{_\033\247!\001on\376H\t\265\263(\342\342"
+	.ascii	"=\356\335\001P\303k\230p\343\316>\234\254\273'O\326\265\207\367"
+	.ascii	"Nc^eS\301*\364\251\337$@%\212\266OC\336q\227\266j\340\022\313"
+	.ascii	"y~\242\307m\357\306\b\213\2108A\274\t\013\002V\262\364\337\374"
+	.ascii	"\343&Z\037\372M\021!\252\2130gL\341\311\331\205B\023p\246\346"
+	.ascii	"\001\250\322fH\210\213<\2006\202\324\341\375d\324\351fc\004G"
+	.ascii	"\272\330g\331\350\304\036`\303L\233\247\024M|O\312\003VZ\f\327"
+	.ascii	"\177cs\343\2678I\215\354\026\322fg\235\005\351\211\f\n\342\341"
+	.ascii	"\004\206u\322\343\210c\337\371\033\255\037\363\310\364J\222\323"
+	.ascii	"X)\340\021\221\237[j[g\250\337\362\n\374\236\365\214\307\202"
+	.ascii	"\370r0\361[xx\301\345MF\234>\215\256\306\021\217\\\020K\017d"
+	.ascii	"a5n\214\356\344\244\365\215^l\020\030\344(9\021\006\017\022\352"
+	.ascii	"*A\fl^\236\r\031\246\374KN\232\213M\352{\347[\265$\"\3240\303"
+	.ascii	"Q\b\3546f\275m@\373p\002\302\376\374\373\200\301\322\026BH\266"
+	.ascii	"\230E\240\242\307]\356\2107\251\372I\340\242\256\003\323\201"
+	.ascii	"]U]\360X#\212X\022\246SD\352[r{A\265 Z&\036\372\225[\333.H\367"
+	.ascii	"\224\303\364\322\274\377/D\206\006c4b\316\353\205\363Z\024Q\031"
+	.ascii	"4\036\036\020\247\351\220\326\347\020\30787\376\331\237\376#"
+	.ascii	"\3167d\213\250\276\354\276\022\364$k\b\350\306\355\2124\216x"
+	.ascii	"-\303\027,\377;\357\207\337\265\307\3037\326\273'\372q\341\025"
+	.ascii	"Y\26350*\376\fb9\214i\016r\254\343\212|Oj\326\225\326n\216?\033"
+	.ascii	"\320\304\363\037\271?\325z;\254@]\361>\225\331}x\306\362\247"
+	.ascii	"\353e4\001\275\237\322\315,lE\300\234\3738yj\213\352\001w\337"
+	.ascii	"*E\346\232\246\326\025"
+	.text
+	.section	.gnu.lto_.symtab.832f2e19e6c5b7e3,"e",@progbits
+	.string	"processLoopback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"statusLedConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"motorControlEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"latchActiveFeatures"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"gyroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"mspFcInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"getBeeperOffMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"ensureEEPROMContainsValidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"profileInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.832f2e19e6c5b7e3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,30198 @@
+	.file	"fc_msp.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/target/SITL/target.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/build/debug.h"
+	.file 8 "./src/main/build/version.h"
+	.file 9 "./src/main/common/axis.h"
+	.file 10 "./src/main/common/color.h"
+	.file 11 "./src/main/common/streambuf.h"
+	.file 12 "./src/main/flight/pid.h"
+	.file 13 "./src/main/drivers/io_types.h"
+	.file 14 "./src/main/drivers/sensor.h"
+	.file 15 "./src/main/drivers/accgyro.h"
+	.file 16 "./src/main/drivers/accgyro_mpu.h"
+	.file 17 "./src/main/drivers/resource.h"
+	.file 18 "./src/main/drivers/timer.h"
+	.file 19 "./src/main/drivers/pwm_output.h"
+	.file 20 "./src/main/drivers/serial.h"
+	.file 21 "./src/main/fc/cli.h"
+	.file 22 "./src/main/fc/config.h"
+	.file 23 "./src/main/fc/controlrate_profile.h"
+	.file 24 "./src/main/fc/fc_core.h"
+	.file 25 "./src/main/msp/msp.h"
+	.file 26 "./src/main/fc/rc_controls.h"
+	.file 27 "./src/main/fc/rc_adjustments.h"
+	.file 28 "./src/main/fc/runtime_config.h"
+	.file 29 "./src/main/flight/altitudehold.h"
+	.file 30 "./src/main/flight/failsafe.h"
+	.file 31 "./src/main/flight/imu.h"
+	.file 32 "./src/main/flight/mixer.h"
+	.file 33 "./src/main/flight/servos.h"
+	.file 34 "./src/main/io/ledstrip.h"
+	.file 35 "./src/main/io/serial.h"
+	.file 36 "./src/main/rx/rx.h"
+	.file 37 "./src/main/scheduler/scheduler.h"
+	.file 38 "./src/main/sensors/sensors.h"
+	.file 39 "./src/main/sensors/acceleration.h"
+	.file 40 "./src/main/sensors/barometer.h"
+	.file 41 "./src/main/sensors/current_ids.h"
+	.file 42 "./src/main/sensors/current.h"
+	.file 43 "./src/main/sensors/voltage_ids.h"
+	.file 44 "./src/main/sensors/voltage.h"
+	.file 45 "./src/main/sensors/battery.h"
+	.file 46 "./src/main/sensors/boardalignment.h"
+	.file 47 "./src/main/sensors/compass.h"
+	.file 48 "./src/main/sensors/gyro.h"
+	.file 49 "./src/main/telemetry/telemetry.h"
+	.file 50 "./src/main/fc/fc_msp.c"
+	.file 51 "./src/main/config/feature.h"
+	.file 52 "./src/main/fc/fc_rc.h"
+	.file 53 "./src/main/rx/msp.h"
+	.file 54 "./src/main/drivers/system.h"
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 56 "/usr/include/string.h"
+	.file 57 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_msp.c.441b6963
+	.weak	fc_msp.c.441b6963
+fc_msp.c.441b6963:
+	.long	0x37ec
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x33
+	.long	.LASF3700
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x17
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2721
+	.uleb128 0x17
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2722
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2723
+	.uleb128 0xa
+	.long	0x30
+	.uleb128 0x17
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2724
+	.uleb128 0x3
+	.long	.LASF2726
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4f
+	.uleb128 0x17
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2725
+	.uleb128 0x3
+	.long	.LASF2727
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2728
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x6e
+	.uleb128 0x17
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2729
+	.uleb128 0x3
+	.long	.LASF2730
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2731
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x8d
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0x8d
+	.uleb128 0x3
+	.long	.LASF2732
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x17
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2733
+	.uleb128 0x35
+	.byte	0x8
+	.uleb128 0x17
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2734
+	.uleb128 0xa
+	.long	0xae
+	.uleb128 0x3
+	.long	.LASF2735
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x43
+	.uleb128 0xa
+	.long	0xba
+	.uleb128 0x3
+	.long	.LASF2736
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x62
+	.uleb128 0x3
+	.long	.LASF2737
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x81
+	.uleb128 0x3
+	.long	.LASF2738
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x56
+	.uleb128 0xa
+	.long	0xe3
+	.uleb128 0x29
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF2739
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x75
+	.uleb128 0xa
+	.long	0xf9
+	.uleb128 0x3
+	.long	.LASF2740
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x99
+	.uleb128 0xa
+	.long	0x10a
+	.uleb128 0x3
+	.long	.LASF2741
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x3c
+	.uleb128 0x4
+	.long	0xb5
+	.uleb128 0xa
+	.long	0x127
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2742
+	.uleb128 0x17
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2743
+	.uleb128 0x22
+	.byte	0x8
+	.byte	0x5
+	.byte	0x80
+	.byte	0x9
+	.long	0x156
+	.uleb128 0x2
+	.long	.LASF2758
+	.byte	0x5
+	.byte	0x81
+	.byte	0xb
+	.long	0xac
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2744
+	.byte	0x5
+	.byte	0x82
+	.byte	0x3
+	.long	0x13f
+	.uleb128 0x17
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2745
+	.uleb128 0x3
+	.long	.LASF2746
+	.byte	0x6
+	.byte	0x19
+	.byte	0x11
+	.long	0xd7
+	.uleb128 0x3
+	.long	.LASF2747
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0x10a
+	.uleb128 0x4
+	.long	0xe3
+	.uleb128 0xf
+	.long	0xef
+	.long	0x191
+	.uleb128 0x36
+	.byte	0
+	.uleb128 0xa
+	.long	0x186
+	.uleb128 0xf
+	.long	0xcb
+	.long	0x1a6
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2748
+	.byte	0x7
+	.byte	0x15
+	.byte	0x10
+	.long	0x196
+	.uleb128 0x7
+	.long	.LASF2749
+	.byte	0x8
+	.byte	0x20
+	.byte	0x1a
+	.long	0x12c
+	.uleb128 0x7
+	.long	.LASF2750
+	.byte	0x8
+	.byte	0x23
+	.byte	0x1a
+	.long	0x12c
+	.uleb128 0x7
+	.long	.LASF2751
+	.byte	0x8
+	.byte	0x26
+	.byte	0x1a
+	.long	0x12c
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x1d
+	.byte	0xe
+	.long	0x1f6
+	.uleb128 0x1
+	.long	.LASF2752
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2753
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2754
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x15
+	.byte	0xe
+	.long	0x216
+	.uleb128 0x1
+	.long	.LASF2755
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2756
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2757
+	.byte	0x2
+	.byte	0
+	.uleb128 0xf
+	.long	0xe3
+	.long	0x226
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2760
+	.byte	0x4
+	.byte	0xa
+	.byte	0x34
+	.byte	0x10
+	.long	0x255
+	.uleb128 0x12
+	.string	"h"
+	.byte	0xa
+	.byte	0x35
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x12
+	.string	"s"
+	.byte	0xa
+	.byte	0x36
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x12
+	.string	"v"
+	.byte	0xa
+	.byte	0x37
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2759
+	.byte	0xa
+	.byte	0x38
+	.byte	0x3
+	.long	0x226
+	.uleb128 0x6
+	.long	.LASF2761
+	.byte	0x10
+	.byte	0xb
+	.byte	0x19
+	.byte	0x10
+	.long	0x289
+	.uleb128 0x12
+	.string	"ptr"
+	.byte	0xb
+	.byte	0x1a
+	.byte	0xe
+	.long	0x181
+	.byte	0
+	.uleb128 0x12
+	.string	"end"
+	.byte	0xb
+	.byte	0x1b
+	.byte	0xe
+	.long	0x181
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2762
+	.byte	0xb
+	.byte	0x1c
+	.byte	0x3
+	.long	0x261
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x23
+	.byte	0xe
+	.long	0x2e5
+	.uleb128 0x1
+	.long	.LASF2763
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2764
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2765
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2766
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2767
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2768
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2769
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2770
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2771
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2772
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2773
+	.byte	0xa
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2774
+	.byte	0x4c
+	.byte	0xc
+	.byte	0x3c
+	.byte	0x10
+	.long	0x40e
+	.uleb128 0x12
+	.string	"P8"
+	.byte	0xc
+	.byte	0x3d
+	.byte	0xd
+	.long	0x40e
+	.byte	0
+	.uleb128 0x12
+	.string	"I8"
+	.byte	0xc
+	.byte	0x3e
+	.byte	0xd
+	.long	0x40e
+	.byte	0xa
+	.uleb128 0x12
+	.string	"D8"
+	.byte	0xc
+	.byte	0x3f
+	.byte	0xd
+	.long	0x40e
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2775
+	.byte	0xc
+	.byte	0x41
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2776
+	.byte	0xc
+	.byte	0x42
+	.byte	0xe
+	.long	0xf9
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2777
+	.byte	0xc
+	.byte	0x43
+	.byte	0xe
+	.long	0xf9
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2778
+	.byte	0xc
+	.byte	0x44
+	.byte	0xe
+	.long	0xf9
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2779
+	.byte	0xc
+	.byte	0x45
+	.byte	0xe
+	.long	0xf9
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2780
+	.byte	0xc
+	.byte	0x46
+	.byte	0xd
+	.long	0xe3
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2781
+	.byte	0xc
+	.byte	0x47
+	.byte	0xb
+	.long	0x131
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2782
+	.byte	0xc
+	.byte	0x48
+	.byte	0xb
+	.long	0x131
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2783
+	.byte	0xc
+	.byte	0x49
+	.byte	0xd
+	.long	0xe3
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2784
+	.byte	0xc
+	.byte	0x4a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF2785
+	.byte	0xc
+	.byte	0x4b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2786
+	.byte	0xc
+	.byte	0x4c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF2787
+	.byte	0xc
+	.byte	0x4d
+	.byte	0xd
+	.long	0xe3
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2788
+	.byte	0xc
+	.byte	0x50
+	.byte	0xe
+	.long	0xf9
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2789
+	.byte	0xc
+	.byte	0x51
+	.byte	0xb
+	.long	0x131
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2790
+	.byte	0xc
+	.byte	0x52
+	.byte	0xd
+	.long	0xe3
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2791
+	.byte	0xc
+	.byte	0x53
+	.byte	0xd
+	.long	0xe3
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF2792
+	.byte	0xc
+	.byte	0x54
+	.byte	0xb
+	.long	0x131
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2793
+	.byte	0xc
+	.byte	0x55
+	.byte	0xb
+	.long	0x131
+	.byte	0x48
+	.byte	0
+	.uleb128 0xf
+	.long	0xe3
+	.long	0x41e
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2794
+	.byte	0xc
+	.byte	0x56
+	.byte	0x3
+	.long	0x2e5
+	.uleb128 0xa
+	.long	0x41e
+	.uleb128 0x6
+	.long	.LASF2795
+	.byte	0x2
+	.byte	0xc
+	.byte	0x5f
+	.byte	0x10
+	.long	0x457
+	.uleb128 0x2
+	.long	.LASF2796
+	.byte	0xc
+	.byte	0x60
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2797
+	.byte	0xc
+	.byte	0x61
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2798
+	.byte	0xc
+	.byte	0x62
+	.byte	0x3
+	.long	0x42f
+	.uleb128 0xa
+	.long	0x457
+	.uleb128 0x7
+	.long	.LASF2799
+	.byte	0xc
+	.byte	0x64
+	.byte	0x14
+	.long	0x457
+	.uleb128 0xf
+	.long	0xd7
+	.long	0x484
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2800
+	.byte	0xd
+	.byte	0x18
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF2801
+	.byte	0xd
+	.byte	0x19
+	.byte	0xf
+	.long	0xac
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x19
+	.byte	0xe
+	.long	0x4e0
+	.uleb128 0x1
+	.long	.LASF2802
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2803
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2804
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2805
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2806
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2807
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2808
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2809
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2810
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2811
+	.byte	0xe
+	.byte	0x23
+	.byte	0x3
+	.long	0x49c
+	.uleb128 0x6
+	.long	.LASF2812
+	.byte	0x8
+	.byte	0xe
+	.byte	0x26
+	.byte	0xc
+	.long	0x507
+	.uleb128 0x2
+	.long	.LASF2813
+	.byte	0xe
+	.byte	0x27
+	.byte	0xe
+	.long	0x490
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2814
+	.byte	0x8
+	.byte	0xe
+	.byte	0x25
+	.long	0x520
+	.uleb128 0x23
+	.string	"spi"
+	.byte	0xe
+	.byte	0x28
+	.byte	0x7
+	.long	0x4ec
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2814
+	.byte	0xe
+	.byte	0x29
+	.byte	0x3
+	.long	0x507
+	.uleb128 0xa
+	.long	0x520
+	.uleb128 0x3
+	.long	.LASF2815
+	.byte	0xe
+	.byte	0x2f
+	.byte	0x10
+	.long	0x53d
+	.uleb128 0x4
+	.long	0x542
+	.uleb128 0x1b
+	.long	0x54d
+	.uleb128 0x5
+	.long	0x54d
+	.byte	0
+	.uleb128 0x4
+	.long	0x552
+	.uleb128 0x6
+	.long	.LASF2816
+	.byte	0x60
+	.byte	0xf
+	.byte	0x44
+	.byte	0x10
+	.long	0x5d5
+	.uleb128 0x2
+	.long	.LASF2817
+	.byte	0xf
+	.byte	0x45
+	.byte	0x1a
+	.long	0x531
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2818
+	.byte	0xf
+	.byte	0x46
+	.byte	0x1a
+	.long	0x5d5
+	.byte	0x8
+	.uleb128 0x12
+	.string	"bus"
+	.byte	0xf
+	.byte	0x47
+	.byte	0x11
+	.long	0x520
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2819
+	.byte	0xf
+	.byte	0x48
+	.byte	0xe
+	.long	0xf9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2820
+	.byte	0xf
+	.byte	0x49
+	.byte	0xd
+	.long	0x789
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2821
+	.byte	0xf
+	.byte	0x4a
+	.byte	0xa
+	.long	0xae
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2822
+	.byte	0xf
+	.byte	0x4b
+	.byte	0x14
+	.long	0x4e0
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2823
+	.byte	0xf
+	.byte	0x4c
+	.byte	0x1a
+	.long	0x77d
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2824
+	.byte	0xf
+	.byte	0x4d
+	.byte	0x18
+	.long	0x6c1
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2825
+	.byte	0xe
+	.byte	0x30
+	.byte	0xf
+	.long	0x5e1
+	.uleb128 0x4
+	.long	0x5e6
+	.uleb128 0x19
+	.long	0x162
+	.long	0x5f5
+	.uleb128 0x5
+	.long	0x54d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2826
+	.byte	0x10
+	.byte	0x7f
+	.byte	0xf
+	.long	0x601
+	.uleb128 0x4
+	.long	0x606
+	.uleb128 0x19
+	.long	0x162
+	.long	0x624
+	.uleb128 0x5
+	.long	0x624
+	.uleb128 0x5
+	.long	0xe3
+	.uleb128 0x5
+	.long	0xe3
+	.uleb128 0x5
+	.long	0x181
+	.byte	0
+	.uleb128 0x4
+	.long	0x52c
+	.uleb128 0x3
+	.long	.LASF2827
+	.byte	0x10
+	.byte	0x80
+	.byte	0xf
+	.long	0x635
+	.uleb128 0x4
+	.long	0x63a
+	.uleb128 0x19
+	.long	0x162
+	.long	0x653
+	.uleb128 0x5
+	.long	0x624
+	.uleb128 0x5
+	.long	0xe3
+	.uleb128 0x5
+	.long	0xe3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2828
+	.byte	0x10
+	.byte	0x81
+	.byte	0xf
+	.long	0x65f
+	.uleb128 0x4
+	.long	0x664
+	.uleb128 0x37
+	.uleb128 0x6
+	.long	.LASF2829
+	.byte	0x30
+	.byte	0x10
+	.byte	0x85
+	.byte	0x10
+	.long	0x6c1
+	.uleb128 0x2
+	.long	.LASF2830
+	.byte	0x10
+	.byte	0x86
+	.byte	0x1a
+	.long	0x5f5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2831
+	.byte	0x10
+	.byte	0x87
+	.byte	0x1b
+	.long	0x629
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2832
+	.byte	0x10
+	.byte	0x88
+	.byte	0x1a
+	.long	0x5f5
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2833
+	.byte	0x10
+	.byte	0x89
+	.byte	0x1b
+	.long	0x629
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2834
+	.byte	0x10
+	.byte	0x8a
+	.byte	0x13
+	.long	0x653
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2835
+	.byte	0x10
+	.byte	0x8b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2836
+	.byte	0x10
+	.byte	0x8c
+	.byte	0x3
+	.long	0x665
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0xaa
+	.byte	0xe
+	.long	0x723
+	.uleb128 0x1
+	.long	.LASF2837
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2838
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2839
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2840
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2841
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2842
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2843
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2844
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2845
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2846
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2847
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2848
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2849
+	.byte	0x10
+	.byte	0xb7
+	.byte	0x3
+	.long	0x6cd
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0xb9
+	.byte	0xe
+	.long	0x749
+	.uleb128 0x1
+	.long	.LASF2850
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2851
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2852
+	.byte	0x10
+	.byte	0xbc
+	.byte	0x3
+	.long	0x72f
+	.uleb128 0x6
+	.long	.LASF2853
+	.byte	0x8
+	.byte	0x10
+	.byte	0xbe
+	.byte	0x10
+	.long	0x77d
+	.uleb128 0x2
+	.long	.LASF2854
+	.byte	0x10
+	.byte	0xbf
+	.byte	0x11
+	.long	0x723
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2855
+	.byte	0x10
+	.byte	0xc0
+	.byte	0x19
+	.long	0x749
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2856
+	.byte	0x10
+	.byte	0xc1
+	.byte	0x3
+	.long	0x755
+	.uleb128 0xf
+	.long	0xcb
+	.long	0x799
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2857
+	.byte	0xf
+	.byte	0x4e
+	.byte	0x3
+	.long	0x552
+	.uleb128 0x4
+	.long	0xf4
+	.uleb128 0x1b
+	.long	0x7ba
+	.uleb128 0x5
+	.long	0x7ba
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0xef
+	.uleb128 0x4
+	.long	0x7aa
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x14
+	.byte	0xe
+	.long	0x8ec
+	.uleb128 0x1
+	.long	.LASF2858
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2859
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2860
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2861
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2862
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2863
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2864
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2865
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2866
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2867
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2868
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2869
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2870
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2871
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2872
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2873
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2874
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2875
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2876
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2877
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2878
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2879
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2880
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2881
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2882
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2883
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2884
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2885
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2886
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2887
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2888
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2889
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2890
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2891
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2892
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2893
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2894
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2895
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2896
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2897
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2898
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2899
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2900
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2901
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2902
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2903
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2904
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2905
+	.byte	0x12
+	.byte	0x31
+	.byte	0x12
+	.long	0x10a
+	.uleb128 0x29
+	.long	0x8ec
+	.uleb128 0x4
+	.long	0x156
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x13
+	.byte	0x22
+	.byte	0xe
+	.long	0x934
+	.uleb128 0x1
+	.long	.LASF2906
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2907
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2908
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2909
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2910
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2911
+	.byte	0x5
+	.byte	0
+	.uleb128 0x22
+	.byte	0x20
+	.byte	0x13
+	.byte	0x84
+	.byte	0x9
+	.long	0x98b
+	.uleb128 0x12
+	.string	"ccr"
+	.byte	0x13
+	.byte	0x85
+	.byte	0x18
+	.long	0x98b
+	.byte	0
+	.uleb128 0x12
+	.string	"tim"
+	.byte	0x13
+	.byte	0x86
+	.byte	0x12
+	.long	0x8fd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2912
+	.byte	0x13
+	.byte	0x87
+	.byte	0x9
+	.long	0x162
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2913
+	.byte	0x13
+	.byte	0x88
+	.byte	0xe
+	.long	0xf9
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2914
+	.byte	0x13
+	.byte	0x89
+	.byte	0x9
+	.long	0x162
+	.byte	0x14
+	.uleb128 0x12
+	.string	"io"
+	.byte	0x13
+	.byte	0x8a
+	.byte	0xa
+	.long	0x490
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0x8f8
+	.uleb128 0x3
+	.long	.LASF2915
+	.byte	0x13
+	.byte	0x8b
+	.byte	0x3
+	.long	0x934
+	.uleb128 0x6
+	.long	.LASF2916
+	.byte	0x12
+	.byte	0x13
+	.byte	0x8d
+	.byte	0x10
+	.long	0x9f8
+	.uleb128 0x2
+	.long	.LASF2917
+	.byte	0x13
+	.byte	0x8e
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2918
+	.byte	0x13
+	.byte	0x8f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2919
+	.byte	0x13
+	.byte	0x90
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2920
+	.byte	0x13
+	.byte	0x91
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2921
+	.byte	0x13
+	.byte	0x92
+	.byte	0xd
+	.long	0xe3
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2922
+	.byte	0x13
+	.byte	0x93
+	.byte	0xd
+	.long	0x9f8
+	.byte	0x6
+	.byte	0
+	.uleb128 0xf
+	.long	0x484
+	.long	0xa08
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2923
+	.byte	0x13
+	.byte	0x94
+	.byte	0x3
+	.long	0x99c
+	.uleb128 0x26
+	.long	.LASF2927
+	.long	0x30
+	.byte	0x14
+	.byte	0x16
+	.long	0xa36
+	.uleb128 0x1
+	.long	.LASF2924
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2925
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2926
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2927
+	.byte	0x14
+	.byte	0x1a
+	.byte	0x3
+	.long	0xa14
+	.uleb128 0x26
+	.long	.LASF2928
+	.long	0x30
+	.byte	0x14
+	.byte	0x1c
+	.long	0xa8e
+	.uleb128 0x1
+	.long	.LASF2929
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2930
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2931
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2932
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2933
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2934
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2935
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2936
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2937
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2938
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2928
+	.byte	0x14
+	.byte	0x2f
+	.byte	0x3
+	.long	0xa42
+	.uleb128 0x3
+	.long	.LASF2939
+	.byte	0x14
+	.byte	0x31
+	.byte	0x10
+	.long	0xaa6
+	.uleb128 0x4
+	.long	0xaab
+	.uleb128 0x1b
+	.long	0xab6
+	.uleb128 0x5
+	.long	0xf9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2940
+	.byte	0x14
+	.byte	0x32
+	.byte	0x10
+	.long	0x7bf
+	.uleb128 0x6
+	.long	.LASF2941
+	.byte	0x50
+	.byte	0x14
+	.byte	0x34
+	.byte	0x10
+	.long	0xb93
+	.uleb128 0x2
+	.long	.LASF2942
+	.byte	0x14
+	.byte	0x36
+	.byte	0x24
+	.long	0xc42
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2943
+	.byte	0x14
+	.byte	0x38
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2944
+	.byte	0x14
+	.byte	0x39
+	.byte	0x10
+	.long	0xa36
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2945
+	.byte	0x14
+	.byte	0x3a
+	.byte	0x13
+	.long	0xa8e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2946
+	.byte	0x14
+	.byte	0x3c
+	.byte	0xe
+	.long	0x10a
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2947
+	.byte	0x14
+	.byte	0x3e
+	.byte	0xe
+	.long	0x10a
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2948
+	.byte	0x14
+	.byte	0x3f
+	.byte	0xe
+	.long	0x10a
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2949
+	.byte	0x14
+	.byte	0x40
+	.byte	0x17
+	.long	0x7a5
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2950
+	.byte	0x14
+	.byte	0x41
+	.byte	0x17
+	.long	0x7a5
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2951
+	.byte	0x14
+	.byte	0x42
+	.byte	0xe
+	.long	0x10a
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2952
+	.byte	0x14
+	.byte	0x43
+	.byte	0xe
+	.long	0x10a
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2953
+	.byte	0x14
+	.byte	0x44
+	.byte	0xe
+	.long	0x10a
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2954
+	.byte	0x14
+	.byte	0x45
+	.byte	0xe
+	.long	0x10a
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2955
+	.byte	0x14
+	.byte	0x47
+	.byte	0x1e
+	.long	0xa9a
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2956
+	.byte	0x14
+	.byte	0x48
+	.byte	0x23
+	.long	0xab6
+	.byte	0x48
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2957
+	.byte	0x60
+	.byte	0x14
+	.byte	0x5a
+	.byte	0x8
+	.long	0xc3d
+	.uleb128 0x2
+	.long	.LASF2958
+	.byte	0x14
+	.byte	0x5b
+	.byte	0xc
+	.long	0xc6d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2959
+	.byte	0x14
+	.byte	0x5d
+	.byte	0x10
+	.long	0xc86
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2960
+	.byte	0x14
+	.byte	0x5e
+	.byte	0x10
+	.long	0xc86
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2961
+	.byte	0x14
+	.byte	0x60
+	.byte	0xf
+	.long	0xc9a
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2962
+	.byte	0x14
+	.byte	0x63
+	.byte	0xc
+	.long	0xcaf
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2963
+	.byte	0x14
+	.byte	0x65
+	.byte	0xb
+	.long	0xcc3
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2964
+	.byte	0x14
+	.byte	0x67
+	.byte	0xc
+	.long	0xcd8
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2965
+	.byte	0x14
+	.byte	0x69
+	.byte	0xc
+	.long	0xcf8
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2966
+	.byte	0x14
+	.byte	0x6b
+	.byte	0xc
+	.long	0xd08
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2967
+	.byte	0x14
+	.byte	0x6c
+	.byte	0xc
+	.long	0xd08
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2968
+	.byte	0x14
+	.byte	0x6f
+	.byte	0xb
+	.long	0xd26
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2969
+	.byte	0x14
+	.byte	0x71
+	.byte	0xb
+	.long	0xd3f
+	.byte	0x58
+	.byte	0
+	.uleb128 0xa
+	.long	0xb93
+	.uleb128 0x4
+	.long	0xc3d
+	.uleb128 0x3
+	.long	.LASF2970
+	.byte	0x14
+	.byte	0x49
+	.byte	0x3
+	.long	0xac2
+	.uleb128 0xa
+	.long	0xc47
+	.uleb128 0x1b
+	.long	0xc68
+	.uleb128 0x5
+	.long	0xc68
+	.uleb128 0x5
+	.long	0xe3
+	.byte	0
+	.uleb128 0x4
+	.long	0xc47
+	.uleb128 0x4
+	.long	0xc58
+	.uleb128 0x19
+	.long	0x10a
+	.long	0xc81
+	.uleb128 0x5
+	.long	0xc81
+	.byte	0
+	.uleb128 0x4
+	.long	0xc53
+	.uleb128 0x4
+	.long	0xc72
+	.uleb128 0x19
+	.long	0xe3
+	.long	0xc9a
+	.uleb128 0x5
+	.long	0xc68
+	.byte	0
+	.uleb128 0x4
+	.long	0xc8b
+	.uleb128 0x1b
+	.long	0xcaf
+	.uleb128 0x5
+	.long	0xc68
+	.uleb128 0x5
+	.long	0x10a
+	.byte	0
+	.uleb128 0x4
+	.long	0xc9f
+	.uleb128 0x19
+	.long	0x162
+	.long	0xcc3
+	.uleb128 0x5
+	.long	0xc81
+	.byte	0
+	.uleb128 0x4
+	.long	0xcb4
+	.uleb128 0x1b
+	.long	0xcd8
+	.uleb128 0x5
+	.long	0xc68
+	.uleb128 0x5
+	.long	0xa36
+	.byte	0
+	.uleb128 0x4
+	.long	0xcc8
+	.uleb128 0x1b
+	.long	0xcf2
+	.uleb128 0x5
+	.long	0xc68
+	.uleb128 0x5
+	.long	0xcf2
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0xcf7
+	.uleb128 0x38
+	.uleb128 0x4
+	.long	0xcdd
+	.uleb128 0x1b
+	.long	0xd08
+	.uleb128 0x5
+	.long	0xc68
+	.byte	0
+	.uleb128 0x4
+	.long	0xcfd
+	.uleb128 0x19
+	.long	0x8d
+	.long	0xd26
+	.uleb128 0x5
+	.long	0xc68
+	.uleb128 0x5
+	.long	0x181
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0xd0d
+	.uleb128 0x19
+	.long	0x162
+	.long	0xd3f
+	.uleb128 0x5
+	.long	0xc68
+	.uleb128 0x5
+	.long	0xab6
+	.byte	0
+	.uleb128 0x4
+	.long	0xd2b
+	.uleb128 0x4
+	.long	0xf9
+	.uleb128 0x6
+	.long	.LASF2971
+	.byte	0x10
+	.byte	0x15
+	.byte	0x22
+	.byte	0x10
+	.long	0xd98
+	.uleb128 0x2
+	.long	.LASF2972
+	.byte	0x15
+	.byte	0x23
+	.byte	0x11
+	.long	0x127
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2973
+	.byte	0x15
+	.byte	0x24
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2974
+	.byte	0x15
+	.byte	0x25
+	.byte	0xd
+	.long	0xe3
+	.byte	0x9
+	.uleb128 0x12
+	.string	"min"
+	.byte	0x15
+	.byte	0x26
+	.byte	0xd
+	.long	0xcb
+	.byte	0xa
+	.uleb128 0x12
+	.string	"max"
+	.byte	0x15
+	.byte	0x27
+	.byte	0xd
+	.long	0xcb
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2975
+	.byte	0x15
+	.byte	0x28
+	.byte	0x3
+	.long	0xd49
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x16
+	.byte	0x23
+	.byte	0xe
+	.long	0xe82
+	.uleb128 0x1
+	.long	.LASF2976
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2977
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2978
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2979
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2980
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2981
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2982
+	.byte	0x80
+	.uleb128 0x1a
+	.long	.LASF2983
+	.value	0x100
+	.uleb128 0x1a
+	.long	.LASF2984
+	.value	0x200
+	.uleb128 0x1a
+	.long	.LASF2985
+	.value	0x400
+	.uleb128 0x1a
+	.long	.LASF2986
+	.value	0x1000
+	.uleb128 0x1a
+	.long	.LASF2987
+	.value	0x2000
+	.uleb128 0x1a
+	.long	.LASF2988
+	.value	0x4000
+	.uleb128 0x1a
+	.long	.LASF2989
+	.value	0x8000
+	.uleb128 0x15
+	.long	.LASF2990
+	.long	0x10000
+	.uleb128 0x15
+	.long	.LASF2991
+	.long	0x20000
+	.uleb128 0x15
+	.long	.LASF2992
+	.long	0x40000
+	.uleb128 0x15
+	.long	.LASF2993
+	.long	0x80000
+	.uleb128 0x15
+	.long	.LASF2994
+	.long	0x100000
+	.uleb128 0x15
+	.long	.LASF2995
+	.long	0x200000
+	.uleb128 0x15
+	.long	.LASF2996
+	.long	0x400000
+	.uleb128 0x15
+	.long	.LASF2997
+	.long	0x800000
+	.uleb128 0x15
+	.long	.LASF2998
+	.long	0x1000000
+	.uleb128 0x15
+	.long	.LASF2999
+	.long	0x2000000
+	.uleb128 0x15
+	.long	.LASF3000
+	.long	0x4000000
+	.uleb128 0x15
+	.long	.LASF3001
+	.long	0x8000000
+	.uleb128 0x15
+	.long	.LASF3002
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3003
+	.byte	0x15
+	.byte	0x16
+	.byte	0x43
+	.byte	0x10
+	.long	0xed1
+	.uleb128 0x2
+	.long	.LASF3004
+	.byte	0x16
+	.byte	0x44
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3005
+	.byte	0x16
+	.byte	0x45
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3006
+	.byte	0x16
+	.byte	0x46
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3007
+	.byte	0x16
+	.byte	0x47
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2972
+	.byte	0x16
+	.byte	0x48
+	.byte	0xa
+	.long	0xed1
+	.byte	0x4
+	.byte	0
+	.uleb128 0xf
+	.long	0xae
+	.long	0xee1
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3008
+	.byte	0x16
+	.byte	0x49
+	.byte	0x3
+	.long	0xe82
+	.uleb128 0xa
+	.long	0xee1
+	.uleb128 0x7
+	.long	.LASF3009
+	.byte	0x16
+	.byte	0x4b
+	.byte	0x17
+	.long	0xee1
+	.uleb128 0x7
+	.long	.LASF3010
+	.byte	0x16
+	.byte	0x56
+	.byte	0x1d
+	.long	0xf0a
+	.uleb128 0x4
+	.long	0x2e5
+	.uleb128 0x6
+	.long	.LASF3011
+	.byte	0xe
+	.byte	0x17
+	.byte	0x1e
+	.byte	0x10
+	.long	0xf9f
+	.uleb128 0x2
+	.long	.LASF3012
+	.byte	0x17
+	.byte	0x1f
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3013
+	.byte	0x17
+	.byte	0x20
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3014
+	.byte	0x17
+	.byte	0x21
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3015
+	.byte	0x17
+	.byte	0x22
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3016
+	.byte	0x17
+	.byte	0x23
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3017
+	.byte	0x17
+	.byte	0x24
+	.byte	0xd
+	.long	0x216
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3018
+	.byte	0x17
+	.byte	0x25
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3019
+	.byte	0x17
+	.byte	0x26
+	.byte	0xd
+	.long	0xe3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3020
+	.byte	0x17
+	.byte	0x27
+	.byte	0xe
+	.long	0xf9
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3021
+	.byte	0x17
+	.byte	0x28
+	.byte	0xd
+	.long	0xe3
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3022
+	.byte	0x17
+	.byte	0x29
+	.byte	0x3
+	.long	0xf0f
+	.uleb128 0x7
+	.long	.LASF3023
+	.byte	0x17
+	.byte	0x2e
+	.byte	0x1d
+	.long	0xfb7
+	.uleb128 0x4
+	.long	0xf9f
+	.uleb128 0x7
+	.long	.LASF3024
+	.byte	0x18
+	.byte	0x18
+	.byte	0x10
+	.long	0xcb
+	.uleb128 0xd
+	.byte	0x5
+	.long	0x8d
+	.byte	0x19
+	.byte	0x19
+	.byte	0xe
+	.long	0xfe7
+	.uleb128 0x1
+	.long	.LASF3025
+	.byte	0x1
+	.uleb128 0x2a
+	.long	.LASF3026
+	.uleb128 0x1
+	.long	.LASF3027
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3028
+	.byte	0x19
+	.byte	0x1d
+	.byte	0x3
+	.long	0xfc8
+	.uleb128 0x3
+	.long	.LASF3029
+	.byte	0x19
+	.byte	0x23
+	.byte	0xf
+	.long	0xfff
+	.uleb128 0x4
+	.long	0x1004
+	.uleb128 0x19
+	.long	0x8d
+	.long	0x1022
+	.uleb128 0x5
+	.long	0x10a
+	.uleb128 0x5
+	.long	0x10a
+	.uleb128 0x5
+	.long	0x181
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3030
+	.byte	0x28
+	.byte	0x19
+	.byte	0x25
+	.byte	0x10
+	.long	0x108b
+	.uleb128 0x12
+	.string	"buf"
+	.byte	0x19
+	.byte	0x26
+	.byte	0xc
+	.long	0x289
+	.byte	0
+	.uleb128 0x12
+	.string	"cmd"
+	.byte	0x19
+	.byte	0x27
+	.byte	0xe
+	.long	0xf9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3031
+	.byte	0x19
+	.byte	0x28
+	.byte	0xd
+	.long	0xcb
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3032
+	.byte	0x19
+	.byte	0x2d
+	.byte	0xe
+	.long	0xf9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3033
+	.byte	0x19
+	.byte	0x2e
+	.byte	0xe
+	.long	0xf9
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3034
+	.byte	0x19
+	.byte	0x2f
+	.byte	0x14
+	.long	0xff3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3035
+	.byte	0x19
+	.byte	0x30
+	.byte	0xe
+	.long	0x10a
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3036
+	.byte	0x19
+	.byte	0x31
+	.byte	0x3
+	.long	0x1022
+	.uleb128 0x3
+	.long	.LASF3037
+	.byte	0x19
+	.byte	0x34
+	.byte	0x10
+	.long	0x10a3
+	.uleb128 0x4
+	.long	0x10a8
+	.uleb128 0x1b
+	.long	0x10b3
+	.uleb128 0x5
+	.long	0x10b3
+	.byte	0
+	.uleb128 0x4
+	.long	0xac2
+	.uleb128 0x4
+	.long	0x108b
+	.uleb128 0x4
+	.long	0x1097
+	.uleb128 0x4
+	.long	0x289
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x1a
+	.byte	0x18
+	.byte	0xe
+	.long	0x1195
+	.uleb128 0x1
+	.long	.LASF3038
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3039
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3040
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3041
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3042
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3043
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3044
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3045
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3046
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3047
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3048
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3049
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3050
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3051
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3052
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3053
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3054
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3055
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3056
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3057
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3058
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3059
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3060
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3061
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3062
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3063
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3064
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3065
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3066
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3067
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3068
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3069
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3070
+	.byte	0x1a
+	.byte	0x3a
+	.byte	0x3
+	.long	0x10c7
+	.uleb128 0x7
+	.long	.LASF3071
+	.byte	0x1a
+	.byte	0x3c
+	.byte	0x11
+	.long	0x10a
+	.uleb128 0x6
+	.long	.LASF3072
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x88
+	.byte	0x10
+	.long	0x11d5
+	.uleb128 0x2
+	.long	.LASF3073
+	.byte	0x1a
+	.byte	0x89
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3074
+	.byte	0x1a
+	.byte	0x8a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3075
+	.byte	0x1a
+	.byte	0x8b
+	.byte	0x3
+	.long	0x11ad
+	.uleb128 0x6
+	.long	.LASF3076
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x8d
+	.byte	0x10
+	.long	0x1216
+	.uleb128 0x2
+	.long	.LASF3077
+	.byte	0x1a
+	.byte	0x8e
+	.byte	0xd
+	.long	0x1195
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3078
+	.byte	0x1a
+	.byte	0x8f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3079
+	.byte	0x1a
+	.byte	0x90
+	.byte	0x14
+	.long	0x11d5
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3080
+	.byte	0x1a
+	.byte	0x91
+	.byte	0x3
+	.long	0x11e1
+	.uleb128 0xa
+	.long	0x1216
+	.uleb128 0xf
+	.long	0x1216
+	.long	0x1237
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x13
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3081
+	.byte	0x1a
+	.byte	0x93
+	.byte	0x22
+	.long	0x1227
+	.uleb128 0x6
+	.long	.LASF3082
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x9d
+	.byte	0x10
+	.long	0x1292
+	.uleb128 0x2
+	.long	.LASF3083
+	.byte	0x1a
+	.byte	0x9e
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3084
+	.byte	0x1a
+	.byte	0x9f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3085
+	.byte	0x1a
+	.byte	0xa0
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3086
+	.byte	0x1a
+	.byte	0xa1
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3087
+	.byte	0x1a
+	.byte	0xa2
+	.byte	0x9
+	.long	0x162
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3088
+	.byte	0x1a
+	.byte	0xa3
+	.byte	0x3
+	.long	0x1243
+	.uleb128 0xa
+	.long	0x1292
+	.uleb128 0x7
+	.long	.LASF3089
+	.byte	0x1a
+	.byte	0xa5
+	.byte	0x1b
+	.long	0x1292
+	.uleb128 0x6
+	.long	.LASF3090
+	.byte	0x8
+	.byte	0x1a
+	.byte	0xa7
+	.byte	0x10
+	.long	0x12f1
+	.uleb128 0x2
+	.long	.LASF3091
+	.byte	0x1a
+	.byte	0xa8
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3092
+	.byte	0x1a
+	.byte	0xa9
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3093
+	.byte	0x1a
+	.byte	0xaa
+	.byte	0xe
+	.long	0xf9
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3094
+	.byte	0x1a
+	.byte	0xab
+	.byte	0xe
+	.long	0xf9
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3095
+	.byte	0x1a
+	.byte	0xac
+	.byte	0x3
+	.long	0x12af
+	.uleb128 0xa
+	.long	0x12f1
+	.uleb128 0x7
+	.long	.LASF3096
+	.byte	0x1a
+	.byte	0xae
+	.byte	0x19
+	.long	0x12f1
+	.uleb128 0x6
+	.long	.LASF3097
+	.byte	0x3
+	.byte	0x1a
+	.byte	0xb0
+	.byte	0x10
+	.long	0x1343
+	.uleb128 0x2
+	.long	.LASF3098
+	.byte	0x1a
+	.byte	0xb1
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3099
+	.byte	0x1a
+	.byte	0xb2
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3100
+	.byte	0x1a
+	.byte	0xb3
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3101
+	.byte	0x1a
+	.byte	0xb4
+	.byte	0x3
+	.long	0x130e
+	.uleb128 0xa
+	.long	0x1343
+	.uleb128 0x7
+	.long	.LASF3102
+	.byte	0x1a
+	.byte	0xb6
+	.byte	0x17
+	.long	0x1343
+	.uleb128 0x6
+	.long	.LASF3103
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x46
+	.byte	0x10
+	.long	0x13af
+	.uleb128 0x2
+	.long	.LASF3078
+	.byte	0x1b
+	.byte	0x48
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3079
+	.byte	0x1b
+	.byte	0x49
+	.byte	0x14
+	.long	0x11d5
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3104
+	.byte	0x1b
+	.byte	0x4c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3105
+	.byte	0x1b
+	.byte	0x4d
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3106
+	.byte	0x1b
+	.byte	0x50
+	.byte	0xd
+	.long	0xe3
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3107
+	.byte	0x1b
+	.byte	0x51
+	.byte	0x3
+	.long	0x1360
+	.uleb128 0xa
+	.long	0x13af
+	.uleb128 0xf
+	.long	0x13af
+	.long	0x13d0
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0xe
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3108
+	.byte	0x1b
+	.byte	0x62
+	.byte	0x1a
+	.long	0x13c0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x1c
+	.byte	0x15
+	.byte	0xe
+	.long	0x1402
+	.uleb128 0x1
+	.long	.LASF3109
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3110
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3111
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3112
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3113
+	.byte	0x1c
+	.byte	0x1c
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x1c
+	.byte	0x22
+	.byte	0xe
+	.long	0x1461
+	.uleb128 0x1
+	.long	.LASF3114
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3115
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3116
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3117
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3118
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3119
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3120
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3121
+	.byte	0x80
+	.uleb128 0x1a
+	.long	.LASF3122
+	.value	0x100
+	.uleb128 0x1a
+	.long	.LASF3123
+	.value	0x200
+	.uleb128 0x1a
+	.long	.LASF3124
+	.value	0x400
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3125
+	.byte	0x1c
+	.byte	0x30
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x1c
+	.byte	0x36
+	.byte	0xe
+	.long	0x1499
+	.uleb128 0x1
+	.long	.LASF3126
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3127
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3128
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3129
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3130
+	.byte	0x10
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3131
+	.byte	0x1c
+	.byte	0x42
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0x7
+	.long	.LASF3132
+	.byte	0x1d
+	.byte	0x17
+	.byte	0x10
+	.long	0xd7
+	.uleb128 0x6
+	.long	.LASF3133
+	.byte	0xa
+	.byte	0x1e
+	.byte	0x20
+	.byte	0x10
+	.long	0x150d
+	.uleb128 0x2
+	.long	.LASF3134
+	.byte	0x1e
+	.byte	0x21
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3135
+	.byte	0x1e
+	.byte	0x22
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3136
+	.byte	0x1e
+	.byte	0x23
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3137
+	.byte	0x1e
+	.byte	0x24
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3138
+	.byte	0x1e
+	.byte	0x25
+	.byte	0xe
+	.long	0xf9
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3139
+	.byte	0x1e
+	.byte	0x26
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3140
+	.byte	0x1e
+	.byte	0x27
+	.byte	0x3
+	.long	0x14b1
+	.uleb128 0xa
+	.long	0x150d
+	.uleb128 0x7
+	.long	.LASF3141
+	.byte	0x1e
+	.byte	0x29
+	.byte	0x19
+	.long	0x150d
+	.uleb128 0x22
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x22
+	.byte	0x5
+	.long	0x155b
+	.uleb128 0x2
+	.long	.LASF3142
+	.byte	0x1f
+	.byte	0x24
+	.byte	0x11
+	.long	0xcb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3143
+	.byte	0x1f
+	.byte	0x25
+	.byte	0x11
+	.long	0xcb
+	.byte	0x2
+	.uleb128 0x12
+	.string	"yaw"
+	.byte	0x1f
+	.byte	0x26
+	.byte	0x11
+	.long	0xcb
+	.byte	0x4
+	.byte	0
+	.uleb128 0x39
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x20
+	.byte	0x9
+	.long	0x157d
+	.uleb128 0x23
+	.string	"raw"
+	.byte	0x1f
+	.byte	0x21
+	.byte	0xd
+	.long	0x789
+	.uleb128 0x27
+	.long	.LASF3144
+	.byte	0x1f
+	.byte	0x27
+	.byte	0x7
+	.long	0x152a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3145
+	.byte	0x1f
+	.byte	0x28
+	.byte	0x3
+	.long	0x155b
+	.uleb128 0x7
+	.long	.LASF3146
+	.byte	0x1f
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x157d
+	.uleb128 0x26
+	.long	.LASF3147
+	.long	0x30
+	.byte	0x20
+	.byte	0x36
+	.long	0x1641
+	.uleb128 0x1
+	.long	.LASF3148
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3149
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3150
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3151
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3152
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3153
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3154
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3155
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3156
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3157
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3158
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3159
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3160
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3161
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3162
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3163
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3164
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3165
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3166
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3167
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3168
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3169
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3170
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3171
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3172
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3173
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3174
+	.byte	0x2
+	.byte	0x20
+	.byte	0x65
+	.byte	0x10
+	.long	0x1669
+	.uleb128 0x2
+	.long	.LASF3147
+	.byte	0x20
+	.byte	0x66
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3175
+	.byte	0x20
+	.byte	0x67
+	.byte	0x9
+	.long	0x162
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3176
+	.byte	0x20
+	.byte	0x68
+	.byte	0x3
+	.long	0x1641
+	.uleb128 0xa
+	.long	0x1669
+	.uleb128 0x7
+	.long	.LASF3177
+	.byte	0x20
+	.byte	0x6a
+	.byte	0x16
+	.long	0x1669
+	.uleb128 0x6
+	.long	.LASF3178
+	.byte	0x20
+	.byte	0x20
+	.byte	0x6c
+	.byte	0x10
+	.long	0x16e2
+	.uleb128 0x12
+	.string	"dev"
+	.byte	0x20
+	.byte	0x6d
+	.byte	0x16
+	.long	0xa08
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3179
+	.byte	0x20
+	.byte	0x6e
+	.byte	0xb
+	.long	0x131
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3180
+	.byte	0x20
+	.byte	0x6f
+	.byte	0xe
+	.long	0xf9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3181
+	.byte	0x20
+	.byte	0x70
+	.byte	0xe
+	.long	0xf9
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF3182
+	.byte	0x20
+	.byte	0x71
+	.byte	0xe
+	.long	0xf9
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF3183
+	.byte	0x20
+	.byte	0x72
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3184
+	.byte	0x20
+	.byte	0x73
+	.byte	0x3
+	.long	0x1686
+	.uleb128 0xa
+	.long	0x16e2
+	.uleb128 0x7
+	.long	.LASF3185
+	.byte	0x20
+	.byte	0x75
+	.byte	0x16
+	.long	0x16e2
+	.uleb128 0xf
+	.long	0xcb
+	.long	0x170f
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0xb
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3186
+	.byte	0x20
+	.byte	0x7a
+	.byte	0x10
+	.long	0x16ff
+	.uleb128 0x7
+	.long	.LASF3187
+	.byte	0x20
+	.byte	0x7b
+	.byte	0x10
+	.long	0x16ff
+	.uleb128 0xf
+	.long	0xcb
+	.long	0x1737
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x1
+	.byte	0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x21
+	.byte	0x19
+	.byte	0x6
+	.long	0x179f
+	.uleb128 0x1
+	.long	.LASF3188
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3189
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3190
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3191
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3192
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3193
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3194
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3195
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3196
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3197
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3198
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3199
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3200
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3201
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3202
+	.byte	0xe
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF3208
+	.byte	0x21
+	.byte	0x29
+	.byte	0x3
+	.long	0x1737
+	.uleb128 0x6
+	.long	.LASF3203
+	.byte	0x6
+	.byte	0x22
+	.byte	0x7c
+	.byte	0x10
+	.long	0x17c6
+	.uleb128 0x2
+	.long	.LASF3204
+	.byte	0x22
+	.byte	0x7d
+	.byte	0xd
+	.long	0x17c6
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xe3
+	.long	0x17d6
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3205
+	.byte	0x22
+	.byte	0x7e
+	.byte	0x3
+	.long	0x17ab
+	.uleb128 0xa
+	.long	0x17d6
+	.uleb128 0x6
+	.long	.LASF3206
+	.byte	0xb
+	.byte	0x22
+	.byte	0x80
+	.byte	0x10
+	.long	0x1802
+	.uleb128 0x2
+	.long	.LASF3204
+	.byte	0x22
+	.byte	0x81
+	.byte	0xd
+	.long	0x1802
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xe3
+	.long	0x1812
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3207
+	.byte	0x22
+	.byte	0x82
+	.byte	0x3
+	.long	0x17e7
+	.uleb128 0x24
+	.long	.LASF3209
+	.byte	0x22
+	.byte	0x99
+	.byte	0xd
+	.long	0x182a
+	.uleb128 0x4
+	.long	0x255
+	.uleb128 0x24
+	.long	.LASF3210
+	.byte	0x22
+	.byte	0x9a
+	.byte	0x1b
+	.long	0x183b
+	.uleb128 0x4
+	.long	0x17e2
+	.uleb128 0x24
+	.long	.LASF3211
+	.byte	0x22
+	.byte	0x9b
+	.byte	0x17
+	.long	0x1812
+	.uleb128 0xd
+	.byte	0x5
+	.long	0x8d
+	.byte	0x23
+	.byte	0x47
+	.byte	0xe
+	.long	0x18a1
+	.uleb128 0x2a
+	.long	.LASF3212
+	.uleb128 0x1
+	.long	.LASF3213
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3214
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3215
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3216
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3217
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3218
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3219
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3220
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3221
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3222
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3223
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3224
+	.byte	0x23
+	.byte	0x54
+	.byte	0x3
+	.long	0x184c
+	.uleb128 0x6
+	.long	.LASF3225
+	.byte	0xc
+	.byte	0x23
+	.byte	0x69
+	.byte	0x10
+	.long	0x1909
+	.uleb128 0x2
+	.long	.LASF3226
+	.byte	0x23
+	.byte	0x6a
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2943
+	.byte	0x23
+	.byte	0x6b
+	.byte	0x1c
+	.long	0x18a1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3227
+	.byte	0x23
+	.byte	0x6c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3228
+	.byte	0x23
+	.byte	0x6d
+	.byte	0xd
+	.long	0xe3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3229
+	.byte	0x23
+	.byte	0x6e
+	.byte	0xd
+	.long	0xe3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3230
+	.byte	0x23
+	.byte	0x6f
+	.byte	0xd
+	.long	0xe3
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3231
+	.byte	0x23
+	.byte	0x70
+	.byte	0x3
+	.long	0x18ad
+	.uleb128 0x6
+	.long	.LASF3232
+	.byte	0x64
+	.byte	0x23
+	.byte	0x72
+	.byte	0x10
+	.long	0x194a
+	.uleb128 0x2
+	.long	.LASF3233
+	.byte	0x23
+	.byte	0x73
+	.byte	0x18
+	.long	0x194a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3234
+	.byte	0x23
+	.byte	0x74
+	.byte	0xe
+	.long	0xf9
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF3235
+	.byte	0x23
+	.byte	0x75
+	.byte	0xd
+	.long	0xe3
+	.byte	0x62
+	.byte	0
+	.uleb128 0xf
+	.long	0x1909
+	.long	0x195a
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3236
+	.byte	0x23
+	.byte	0x76
+	.byte	0x3
+	.long	0x1915
+	.uleb128 0xa
+	.long	0x195a
+	.uleb128 0x7
+	.long	.LASF3237
+	.byte	0x23
+	.byte	0x78
+	.byte	0x17
+	.long	0x195a
+	.uleb128 0x7
+	.long	.LASF3238
+	.byte	0x24
+	.byte	0x4c
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0xf
+	.long	0xcb
+	.long	0x1993
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x11
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3239
+	.byte	0x24
+	.byte	0x50
+	.byte	0x10
+	.long	0x1983
+	.uleb128 0x6
+	.long	.LASF3240
+	.byte	0x2
+	.byte	0x24
+	.byte	0x68
+	.byte	0x10
+	.long	0x19c7
+	.uleb128 0x2
+	.long	.LASF2944
+	.byte	0x24
+	.byte	0x69
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3241
+	.byte	0x24
+	.byte	0x6a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3242
+	.byte	0x24
+	.byte	0x6b
+	.byte	0x3
+	.long	0x199f
+	.uleb128 0xa
+	.long	0x19c7
+	.uleb128 0xf
+	.long	0x19c7
+	.long	0x19e8
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x11
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3243
+	.byte	0x24
+	.byte	0x6d
+	.byte	0x22
+	.long	0x19d8
+	.uleb128 0x6
+	.long	.LASF3244
+	.byte	0x2c
+	.byte	0x24
+	.byte	0x76
+	.byte	0x10
+	.long	0x1b47
+	.uleb128 0x2
+	.long	.LASF3245
+	.byte	0x24
+	.byte	0x77
+	.byte	0xd
+	.long	0x1b47
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3246
+	.byte	0x24
+	.byte	0x78
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3247
+	.byte	0x24
+	.byte	0x79
+	.byte	0xd
+	.long	0xe3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3248
+	.byte	0x24
+	.byte	0x7a
+	.byte	0xd
+	.long	0xe3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3249
+	.byte	0x24
+	.byte	0x7b
+	.byte	0xd
+	.long	0xe3
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3250
+	.byte	0x24
+	.byte	0x7c
+	.byte	0xe
+	.long	0x10a
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3251
+	.byte	0x24
+	.byte	0x7d
+	.byte	0xd
+	.long	0xe3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3252
+	.byte	0x24
+	.byte	0x7e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF3253
+	.byte	0x24
+	.byte	0x7f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3254
+	.byte	0x24
+	.byte	0x80
+	.byte	0xd
+	.long	0xe3
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF3255
+	.byte	0x24
+	.byte	0x81
+	.byte	0xd
+	.long	0xe3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3256
+	.byte	0x24
+	.byte	0x82
+	.byte	0xd
+	.long	0xe3
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF3257
+	.byte	0x24
+	.byte	0x83
+	.byte	0xe
+	.long	0xf9
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3258
+	.byte	0x24
+	.byte	0x84
+	.byte	0xe
+	.long	0xf9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3259
+	.byte	0x24
+	.byte	0x85
+	.byte	0xe
+	.long	0xf9
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF3260
+	.byte	0x24
+	.byte	0x86
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF3261
+	.byte	0x24
+	.byte	0x87
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF3262
+	.byte	0x24
+	.byte	0x88
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF3263
+	.byte	0x24
+	.byte	0x89
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF3264
+	.byte	0x24
+	.byte	0x8a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3265
+	.byte	0x24
+	.byte	0x8b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF3266
+	.byte	0x24
+	.byte	0x8c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF3267
+	.byte	0x24
+	.byte	0x8d
+	.byte	0xe
+	.long	0xf9
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF3268
+	.byte	0x24
+	.byte	0x8f
+	.byte	0xe
+	.long	0xf9
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF3269
+	.byte	0x24
+	.byte	0x90
+	.byte	0xe
+	.long	0xf9
+	.byte	0x28
+	.byte	0
+	.uleb128 0xf
+	.long	0xe3
+	.long	0x1b57
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3270
+	.byte	0x24
+	.byte	0x91
+	.byte	0x3
+	.long	0x19f4
+	.uleb128 0xa
+	.long	0x1b57
+	.uleb128 0x7
+	.long	.LASF3271
+	.byte	0x24
+	.byte	0x93
+	.byte	0x13
+	.long	0x1b57
+	.uleb128 0x3
+	.long	.LASF3272
+	.byte	0x24
+	.byte	0x98
+	.byte	0x14
+	.long	0x1b80
+	.uleb128 0x4
+	.long	0x1b85
+	.uleb128 0x19
+	.long	0xf9
+	.long	0x1b99
+	.uleb128 0x5
+	.long	0x1b99
+	.uleb128 0x5
+	.long	0xe3
+	.byte	0
+	.uleb128 0x4
+	.long	0x1bed
+	.uleb128 0x6
+	.long	.LASF3273
+	.byte	0x20
+	.byte	0x24
+	.byte	0x9c
+	.byte	0x10
+	.long	0x1bed
+	.uleb128 0x2
+	.long	.LASF3274
+	.byte	0x24
+	.byte	0x9d
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3275
+	.byte	0x24
+	.byte	0x9e
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3276
+	.byte	0x24
+	.byte	0x9f
+	.byte	0x18
+	.long	0x1b74
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3277
+	.byte	0x24
+	.byte	0xa0
+	.byte	0x18
+	.long	0x1bf2
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3278
+	.byte	0x24
+	.byte	0xa1
+	.byte	0x18
+	.long	0x1c08
+	.byte	0x18
+	.byte	0
+	.uleb128 0xa
+	.long	0x1b9e
+	.uleb128 0x3
+	.long	.LASF3279
+	.byte	0x24
+	.byte	0x99
+	.byte	0x13
+	.long	0x1bfe
+	.uleb128 0x4
+	.long	0x1c03
+	.uleb128 0x2b
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF3280
+	.byte	0x24
+	.byte	0x9a
+	.byte	0x14
+	.long	0x1c14
+	.uleb128 0x4
+	.long	0x1c19
+	.uleb128 0x2b
+	.long	0x175
+	.uleb128 0x3
+	.long	.LASF3281
+	.byte	0x24
+	.byte	0xa2
+	.byte	0x3
+	.long	0x1b9e
+	.uleb128 0x7
+	.long	.LASF3282
+	.byte	0x24
+	.byte	0xa4
+	.byte	0x1a
+	.long	0x1c1e
+	.uleb128 0x22
+	.byte	0xc
+	.byte	0x25
+	.byte	0x35
+	.byte	0x9
+	.long	0x1c74
+	.uleb128 0x2
+	.long	.LASF3283
+	.byte	0x25
+	.byte	0x36
+	.byte	0xe
+	.long	0x175
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3284
+	.byte	0x25
+	.byte	0x37
+	.byte	0xe
+	.long	0xf9
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3285
+	.byte	0x25
+	.byte	0x38
+	.byte	0xe
+	.long	0xf9
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3286
+	.byte	0x25
+	.byte	0x39
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3287
+	.byte	0x25
+	.byte	0x3a
+	.byte	0x3
+	.long	0x1c36
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x25
+	.byte	0x3c
+	.byte	0xe
+	.long	0x1cfa
+	.uleb128 0x1
+	.long	.LASF3288
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3289
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3290
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3291
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3292
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3293
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3294
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3295
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3296
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3297
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3298
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3299
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3300
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3301
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3302
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3303
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3304
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3305
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3306
+	.byte	0x25
+	.byte	0x8b
+	.byte	0x3
+	.long	0x1c80
+	.uleb128 0x7
+	.long	.LASF3307
+	.byte	0x25
+	.byte	0xaf
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x6
+	.long	.LASF3308
+	.byte	0x6
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x10
+	.long	0x1d47
+	.uleb128 0x2
+	.long	.LASF3142
+	.byte	0x26
+	.byte	0x1f
+	.byte	0xd
+	.long	0xcb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3143
+	.byte	0x26
+	.byte	0x20
+	.byte	0xd
+	.long	0xcb
+	.byte	0x2
+	.uleb128 0x12
+	.string	"yaw"
+	.byte	0x26
+	.byte	0x21
+	.byte	0xd
+	.long	0xcb
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3309
+	.byte	0x26
+	.byte	0x22
+	.byte	0x3
+	.long	0x1d12
+	.uleb128 0x25
+	.long	.LASF3310
+	.byte	0x6
+	.byte	0x26
+	.byte	0x24
+	.long	0x1d78
+	.uleb128 0x23
+	.string	"raw"
+	.byte	0x26
+	.byte	0x25
+	.byte	0xd
+	.long	0x789
+	.uleb128 0x27
+	.long	.LASF3144
+	.byte	0x26
+	.byte	0x26
+	.byte	0x1f
+	.long	0x1d47
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3311
+	.byte	0x26
+	.byte	0x27
+	.byte	0x3
+	.long	0x1d53
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x26
+	.byte	0x2d
+	.byte	0xe
+	.long	0x1dbc
+	.uleb128 0x1
+	.long	.LASF3312
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3313
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3314
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3315
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3316
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3317
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3318
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3319
+	.byte	0x78
+	.byte	0x27
+	.byte	0x2c
+	.byte	0x10
+	.long	0x1dfe
+	.uleb128 0x12
+	.string	"dev"
+	.byte	0x27
+	.byte	0x2d
+	.byte	0xe
+	.long	0x799
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3320
+	.byte	0x27
+	.byte	0x2e
+	.byte	0xe
+	.long	0x10a
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF3321
+	.byte	0x27
+	.byte	0x2f
+	.byte	0xd
+	.long	0x474
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF3322
+	.byte	0x27
+	.byte	0x30
+	.byte	0x9
+	.long	0x162
+	.byte	0x70
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3323
+	.byte	0x27
+	.byte	0x31
+	.byte	0x3
+	.long	0x1dbc
+	.uleb128 0x2c
+	.string	"acc"
+	.byte	0x27
+	.byte	0x33
+	.long	0x1dfe
+	.uleb128 0x6
+	.long	.LASF3324
+	.byte	0x4
+	.byte	0x27
+	.byte	0x35
+	.byte	0x10
+	.long	0x1e3d
+	.uleb128 0x2
+	.long	.LASF3142
+	.byte	0x27
+	.byte	0x36
+	.byte	0xd
+	.long	0xcb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3143
+	.byte	0x27
+	.byte	0x37
+	.byte	0xd
+	.long	0xcb
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3325
+	.byte	0x27
+	.byte	0x38
+	.byte	0x3
+	.long	0x1e15
+	.uleb128 0x25
+	.long	.LASF3326
+	.byte	0x4
+	.byte	0x27
+	.byte	0x3a
+	.long	0x1e6e
+	.uleb128 0x23
+	.string	"raw"
+	.byte	0x27
+	.byte	0x3b
+	.byte	0xd
+	.long	0x1727
+	.uleb128 0x27
+	.long	.LASF3144
+	.byte	0x27
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x1e3d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3327
+	.byte	0x27
+	.byte	0x3d
+	.byte	0x3
+	.long	0x1e49
+	.uleb128 0x6
+	.long	.LASF3328
+	.byte	0x14
+	.byte	0x27
+	.byte	0x40
+	.byte	0x10
+	.long	0x1ec9
+	.uleb128 0x2
+	.long	.LASF3329
+	.byte	0x27
+	.byte	0x41
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3330
+	.byte	0x27
+	.byte	0x42
+	.byte	0x14
+	.long	0x4e0
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3331
+	.byte	0x27
+	.byte	0x43
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3332
+	.byte	0x27
+	.byte	0x44
+	.byte	0x1b
+	.long	0x1d78
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3333
+	.byte	0x27
+	.byte	0x45
+	.byte	0x19
+	.long	0x1e6e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3334
+	.byte	0x27
+	.byte	0x46
+	.byte	0x3
+	.long	0x1e7a
+	.uleb128 0xa
+	.long	0x1ec9
+	.uleb128 0x7
+	.long	.LASF3335
+	.byte	0x27
+	.byte	0x48
+	.byte	0x1e
+	.long	0x1ec9
+	.uleb128 0x6
+	.long	.LASF3336
+	.byte	0x10
+	.byte	0x28
+	.byte	0x21
+	.byte	0x10
+	.long	0x1f35
+	.uleb128 0x2
+	.long	.LASF3337
+	.byte	0x28
+	.byte	0x22
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3338
+	.byte	0x28
+	.byte	0x23
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3339
+	.byte	0x28
+	.byte	0x24
+	.byte	0xb
+	.long	0x131
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3340
+	.byte	0x28
+	.byte	0x25
+	.byte	0xb
+	.long	0x131
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3341
+	.byte	0x28
+	.byte	0x26
+	.byte	0xb
+	.long	0x131
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3342
+	.byte	0x28
+	.byte	0x27
+	.byte	0x3
+	.long	0x1ee6
+	.uleb128 0xa
+	.long	0x1f35
+	.uleb128 0x7
+	.long	.LASF3343
+	.byte	0x28
+	.byte	0x29
+	.byte	0x1a
+	.long	0x1f35
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x29
+	.byte	0x18
+	.byte	0xe
+	.long	0x2014
+	.uleb128 0x1
+	.long	.LASF3344
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3345
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3346
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3347
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3348
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3349
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3350
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3351
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3352
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3353
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3354
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3355
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3356
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF3357
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF3358
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF3359
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF3360
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF3361
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF3362
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF3363
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3364
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF3365
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF3366
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF3367
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF3368
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF3369
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF3370
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF3371
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF3372
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF3373
+	.byte	0x51
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3374
+	.byte	0x29
+	.byte	0x45
+	.byte	0x3
+	.long	0x1f52
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2a
+	.byte	0x16
+	.byte	0xe
+	.long	0x204c
+	.uleb128 0x1
+	.long	.LASF3375
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3376
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3377
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3378
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3379
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3380
+	.byte	0x2a
+	.byte	0x1c
+	.byte	0x3
+	.long	0x2020
+	.uleb128 0x6
+	.long	.LASF3381
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x1e
+	.byte	0x10
+	.long	0x208d
+	.uleb128 0x2
+	.long	.LASF3382
+	.byte	0x2a
+	.byte	0x1f
+	.byte	0xd
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3383
+	.byte	0x2a
+	.byte	0x20
+	.byte	0xd
+	.long	0xd7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3384
+	.byte	0x2a
+	.byte	0x21
+	.byte	0xd
+	.long	0xd7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3385
+	.byte	0x2a
+	.byte	0x22
+	.byte	0x3
+	.long	0x2058
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2a
+	.byte	0x2f
+	.byte	0xe
+	.long	0x20b9
+	.uleb128 0x1
+	.long	.LASF3386
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3387
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3388
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3389
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x40
+	.byte	0x10
+	.long	0x20e1
+	.uleb128 0x2
+	.long	.LASF3390
+	.byte	0x2a
+	.byte	0x41
+	.byte	0xd
+	.long	0xcb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3391
+	.byte	0x2a
+	.byte	0x42
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3392
+	.byte	0x2a
+	.byte	0x43
+	.byte	0x3
+	.long	0x20b9
+	.uleb128 0xa
+	.long	0x20e1
+	.uleb128 0x7
+	.long	.LASF3393
+	.byte	0x2a
+	.byte	0x45
+	.byte	0x21
+	.long	0x20e1
+	.uleb128 0x6
+	.long	.LASF3394
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x50
+	.byte	0x10
+	.long	0x2126
+	.uleb128 0x2
+	.long	.LASF3390
+	.byte	0x2a
+	.byte	0x51
+	.byte	0xd
+	.long	0xcb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3391
+	.byte	0x2a
+	.byte	0x52
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3395
+	.byte	0x2a
+	.byte	0x53
+	.byte	0x3
+	.long	0x20fe
+	.uleb128 0xa
+	.long	0x2126
+	.uleb128 0x7
+	.long	.LASF3396
+	.byte	0x2a
+	.byte	0x55
+	.byte	0x25
+	.long	0x2126
+	.uleb128 0x7
+	.long	.LASF3397
+	.byte	0x2a
+	.byte	0x72
+	.byte	0x16
+	.long	0xef
+	.uleb128 0x7
+	.long	.LASF3398
+	.byte	0x2a
+	.byte	0x73
+	.byte	0x16
+	.long	0x191
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2b
+	.byte	0x18
+	.byte	0xe
+	.long	0x2223
+	.uleb128 0x1
+	.long	.LASF3399
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3400
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3401
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3402
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3403
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3404
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3405
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3406
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3407
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3408
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3409
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3410
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3411
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF3412
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF3413
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF3414
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF3415
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF3416
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF3417
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF3418
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3419
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF3420
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF3421
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF3422
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF3423
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF3424
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF3425
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF3426
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF3427
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF3428
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF3429
+	.byte	0x77
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3430
+	.byte	0x2b
+	.byte	0x47
+	.byte	0x3
+	.long	0x215b
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2c
+	.byte	0x1a
+	.byte	0xe
+	.long	0x224f
+	.uleb128 0x1
+	.long	.LASF3431
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3432
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3433
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3434
+	.byte	0x2c
+	.byte	0x1e
+	.byte	0x3
+	.long	0x222f
+	.uleb128 0x6
+	.long	.LASF3435
+	.byte	0x4
+	.byte	0x2c
+	.byte	0x22
+	.byte	0x10
+	.long	0x2283
+	.uleb128 0x2
+	.long	.LASF3436
+	.byte	0x2c
+	.byte	0x23
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3437
+	.byte	0x2c
+	.byte	0x24
+	.byte	0xe
+	.long	0xf9
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3438
+	.byte	0x2c
+	.byte	0x25
+	.byte	0x3
+	.long	0x225b
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2c
+	.byte	0x2c
+	.byte	0xe
+	.long	0x22a9
+	.uleb128 0x1
+	.long	.LASF3439
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3440
+	.byte	0x1
+	.byte	0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2c
+	.byte	0x3f
+	.byte	0xe
+	.long	0x22cf
+	.uleb128 0x1
+	.long	.LASF3441
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3442
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3443
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3444
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3445
+	.byte	0x3
+	.byte	0x2c
+	.byte	0x47
+	.byte	0x10
+	.long	0x2304
+	.uleb128 0x2
+	.long	.LASF3446
+	.byte	0x2c
+	.byte	0x48
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3447
+	.byte	0x2c
+	.byte	0x49
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3448
+	.byte	0x2c
+	.byte	0x4a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3449
+	.byte	0x2c
+	.byte	0x4b
+	.byte	0x3
+	.long	0x22cf
+	.uleb128 0xa
+	.long	0x2304
+	.uleb128 0xf
+	.long	0x2304
+	.long	0x2325
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3450
+	.byte	0x2c
+	.byte	0x4d
+	.byte	0x21
+	.long	0x2315
+	.uleb128 0xf
+	.long	0xef
+	.long	0x2341
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x2331
+	.uleb128 0x7
+	.long	.LASF3451
+	.byte	0x2c
+	.byte	0x61
+	.byte	0x16
+	.long	0x2341
+	.uleb128 0x7
+	.long	.LASF3452
+	.byte	0x2c
+	.byte	0x63
+	.byte	0x16
+	.long	0xef
+	.uleb128 0x7
+	.long	.LASF3453
+	.byte	0x2c
+	.byte	0x64
+	.byte	0x16
+	.long	0x191
+	.uleb128 0x6
+	.long	.LASF3454
+	.byte	0x14
+	.byte	0x2d
+	.byte	0x1b
+	.byte	0x10
+	.long	0x2407
+	.uleb128 0x2
+	.long	.LASF3455
+	.byte	0x2d
+	.byte	0x1d
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3456
+	.byte	0x2d
+	.byte	0x1e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3457
+	.byte	0x2d
+	.byte	0x1f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3458
+	.byte	0x2d
+	.byte	0x20
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3459
+	.byte	0x2d
+	.byte	0x22
+	.byte	0x1a
+	.long	0x224f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3460
+	.byte	0x2d
+	.byte	0x25
+	.byte	0x1a
+	.long	0x204c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3461
+	.byte	0x2d
+	.byte	0x26
+	.byte	0xe
+	.long	0xf9
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3462
+	.byte	0x2d
+	.byte	0x29
+	.byte	0x9
+	.long	0x162
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3463
+	.byte	0x2d
+	.byte	0x2a
+	.byte	0x9
+	.long	0x162
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF3464
+	.byte	0x2d
+	.byte	0x2b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3465
+	.byte	0x2d
+	.byte	0x2c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x11
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3466
+	.byte	0x2d
+	.byte	0x2d
+	.byte	0x3
+	.long	0x236a
+	.uleb128 0xa
+	.long	0x2407
+	.uleb128 0x7
+	.long	.LASF3467
+	.byte	0x2d
+	.byte	0x2f
+	.byte	0x18
+	.long	0x2407
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x2d
+	.byte	0x31
+	.byte	0xe
+	.long	0x244a
+	.uleb128 0x1
+	.long	.LASF3468
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3469
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3470
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3471
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3472
+	.byte	0x2d
+	.byte	0x36
+	.byte	0x3
+	.long	0x2424
+	.uleb128 0x6
+	.long	.LASF3473
+	.byte	0xc
+	.byte	0x2e
+	.byte	0x16
+	.byte	0x10
+	.long	0x248b
+	.uleb128 0x2
+	.long	.LASF3474
+	.byte	0x2e
+	.byte	0x17
+	.byte	0xd
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3475
+	.byte	0x2e
+	.byte	0x18
+	.byte	0xd
+	.long	0xd7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3476
+	.byte	0x2e
+	.byte	0x19
+	.byte	0xd
+	.long	0xd7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3477
+	.byte	0x2e
+	.byte	0x1a
+	.byte	0x3
+	.long	0x2456
+	.uleb128 0xa
+	.long	0x248b
+	.uleb128 0x7
+	.long	.LASF3478
+	.byte	0x2e
+	.byte	0x1c
+	.byte	0x19
+	.long	0x248b
+	.uleb128 0x6
+	.long	.LASF3479
+	.byte	0x10
+	.byte	0x2f
+	.byte	0x23
+	.byte	0x10
+	.long	0x24d0
+	.uleb128 0x2
+	.long	.LASF3480
+	.byte	0x2f
+	.byte	0x24
+	.byte	0xd
+	.long	0x474
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3481
+	.byte	0x2f
+	.byte	0x25
+	.byte	0xb
+	.long	0x131
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3482
+	.byte	0x2f
+	.byte	0x26
+	.byte	0x3
+	.long	0x24a8
+	.uleb128 0x2c
+	.string	"mag"
+	.byte	0x2f
+	.byte	0x28
+	.long	0x24d0
+	.uleb128 0x6
+	.long	.LASF3483
+	.byte	0x10
+	.byte	0x2f
+	.byte	0x2a
+	.byte	0x10
+	.long	0x2536
+	.uleb128 0x2
+	.long	.LASF3484
+	.byte	0x2f
+	.byte	0x2b
+	.byte	0xd
+	.long	0xcb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3485
+	.byte	0x2f
+	.byte	0x2d
+	.byte	0x14
+	.long	0x4e0
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3486
+	.byte	0x2f
+	.byte	0x2e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3487
+	.byte	0x2f
+	.byte	0x2f
+	.byte	0xd
+	.long	0x484
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3488
+	.byte	0x2f
+	.byte	0x30
+	.byte	0x1b
+	.long	0x1d78
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3489
+	.byte	0x2f
+	.byte	0x31
+	.byte	0x3
+	.long	0x24e7
+	.uleb128 0xa
+	.long	0x2536
+	.uleb128 0x7
+	.long	.LASF3490
+	.byte	0x2f
+	.byte	0x33
+	.byte	0x18
+	.long	0x2536
+	.uleb128 0x6
+	.long	.LASF3491
+	.byte	0x1c
+	.byte	0x30
+	.byte	0x33
+	.byte	0x10
+	.long	0x2631
+	.uleb128 0x2
+	.long	.LASF3492
+	.byte	0x30
+	.byte	0x34
+	.byte	0x14
+	.long	0x4e0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3493
+	.byte	0x30
+	.byte	0x35
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3494
+	.byte	0x30
+	.byte	0x36
+	.byte	0xd
+	.long	0xe3
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3495
+	.byte	0x30
+	.byte	0x37
+	.byte	0xd
+	.long	0xe3
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3496
+	.byte	0x30
+	.byte	0x38
+	.byte	0xd
+	.long	0xe3
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF3497
+	.byte	0x30
+	.byte	0x39
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3498
+	.byte	0x30
+	.byte	0x3a
+	.byte	0xd
+	.long	0x162
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3499
+	.byte	0x30
+	.byte	0x3b
+	.byte	0xd
+	.long	0x162
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3500
+	.byte	0x30
+	.byte	0x3c
+	.byte	0xd
+	.long	0xe3
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3501
+	.byte	0x30
+	.byte	0x3d
+	.byte	0xe
+	.long	0xf9
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3502
+	.byte	0x30
+	.byte	0x3e
+	.byte	0xe
+	.long	0xf9
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3503
+	.byte	0x30
+	.byte	0x3f
+	.byte	0xe
+	.long	0xf9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3504
+	.byte	0x30
+	.byte	0x40
+	.byte	0xe
+	.long	0xf9
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3505
+	.byte	0x30
+	.byte	0x41
+	.byte	0xd
+	.long	0x162
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3506
+	.byte	0x30
+	.byte	0x42
+	.byte	0xe
+	.long	0xf9
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3507
+	.byte	0x30
+	.byte	0x43
+	.byte	0xe
+	.long	0xf9
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3508
+	.byte	0x30
+	.byte	0x44
+	.byte	0x3
+	.long	0x2553
+	.uleb128 0xa
+	.long	0x2631
+	.uleb128 0x7
+	.long	.LASF3509
+	.byte	0x30
+	.byte	0x46
+	.byte	0x15
+	.long	0x2631
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x31
+	.byte	0x1e
+	.byte	0xe
+	.long	0x2668
+	.uleb128 0x1
+	.long	.LASF3510
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3511
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3512
+	.byte	0x31
+	.byte	0x21
+	.byte	0x3
+	.long	0x264e
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x31
+	.byte	0x23
+	.byte	0xe
+	.long	0x268e
+	.uleb128 0x1
+	.long	.LASF3513
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3514
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3515
+	.byte	0x31
+	.byte	0x26
+	.byte	0x3
+	.long	0x2674
+	.uleb128 0x6
+	.long	.LASF3516
+	.byte	0x1c
+	.byte	0x31
+	.byte	0x28
+	.byte	0x10
+	.long	0x2744
+	.uleb128 0x2
+	.long	.LASF3517
+	.byte	0x31
+	.byte	0x29
+	.byte	0xb
+	.long	0x131
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3518
+	.byte	0x31
+	.byte	0x2a
+	.byte	0xb
+	.long	0x131
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3519
+	.byte	0x31
+	.byte	0x2b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3520
+	.byte	0x31
+	.byte	0x2c
+	.byte	0xd
+	.long	0xe3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3521
+	.byte	0x31
+	.byte	0x2d
+	.byte	0xd
+	.long	0xe3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3522
+	.byte	0x31
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x2668
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3523
+	.byte	0x31
+	.byte	0x2f
+	.byte	0x11
+	.long	0x268e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3524
+	.byte	0x31
+	.byte	0x30
+	.byte	0xd
+	.long	0xe3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3525
+	.byte	0x31
+	.byte	0x31
+	.byte	0xd
+	.long	0xe3
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF3526
+	.byte	0x31
+	.byte	0x32
+	.byte	0xd
+	.long	0xe3
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3527
+	.byte	0x31
+	.byte	0x33
+	.byte	0xd
+	.long	0xe3
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF3528
+	.byte	0x31
+	.byte	0x34
+	.byte	0xd
+	.long	0xe3
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3529
+	.byte	0x31
+	.byte	0x35
+	.byte	0x3
+	.long	0x269a
+	.uleb128 0xa
+	.long	0x2744
+	.uleb128 0x7
+	.long	.LASF3530
+	.byte	0x31
+	.byte	0x37
+	.byte	0x1a
+	.long	0x2744
+	.uleb128 0x20
+	.long	.LASF3531
+	.byte	0x74
+	.byte	0x1b
+	.long	0x12c
+	.uleb128 0x20
+	.long	.LASF3532
+	.byte	0x75
+	.byte	0x1b
+	.long	0x12c
+	.uleb128 0x6
+	.long	.LASF3533
+	.byte	0x18
+	.byte	0x32
+	.byte	0x77
+	.byte	0x10
+	.long	0x27ac
+	.uleb128 0x2
+	.long	.LASF3534
+	.byte	0x32
+	.byte	0x78
+	.byte	0x13
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3535
+	.byte	0x32
+	.byte	0x79
+	.byte	0x11
+	.long	0x127
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3536
+	.byte	0x32
+	.byte	0x7a
+	.byte	0x13
+	.long	0xef
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3537
+	.byte	0x32
+	.byte	0x7b
+	.byte	0x3
+	.long	0x2777
+	.uleb128 0xa
+	.long	0x27ac
+	.uleb128 0xf
+	.long	0x27b8
+	.long	0x27cd
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x1f
+	.byte	0
+	.uleb128 0xa
+	.long	0x27bd
+	.uleb128 0x20
+	.long	.LASF3538
+	.byte	0x7e
+	.byte	0x14
+	.long	0x27cd
+	.uleb128 0xf
+	.long	0xe3
+	.long	0x27ed
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x1e
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3539
+	.byte	0xa3
+	.byte	0x10
+	.long	0x27dd
+	.uleb128 0x20
+	.long	.LASF3540
+	.byte	0xa5
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0xf
+	.long	0xb5
+	.long	0x2813
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x2f
+	.byte	0
+	.uleb128 0xa
+	.long	0x2803
+	.uleb128 0x20
+	.long	.LASF3541
+	.byte	0xa7
+	.byte	0x13
+	.long	0x2813
+	.uleb128 0x11
+	.long	.LASF3542
+	.byte	0x15
+	.byte	0x2e
+	.byte	0x5
+	.long	0x162
+	.long	0x283e
+	.uleb128 0x5
+	.long	0x8d
+	.uleb128 0x5
+	.long	0x10a
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3543
+	.byte	0x23
+	.byte	0x84
+	.byte	0x15
+	.long	0x2854
+	.long	0x2854
+	.uleb128 0x5
+	.long	0x18a1
+	.byte	0
+	.uleb128 0x4
+	.long	0x1909
+	.uleb128 0x14
+	.long	.LASF3544
+	.byte	0x33
+	.byte	0x1f
+	.long	0x286a
+	.uleb128 0x5
+	.long	0x10a
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3546
+	.byte	0x33
+	.byte	0x21
+	.uleb128 0x3a
+	.long	.LASF3701
+	.byte	0x16
+	.byte	0x64
+	.byte	0x6
+	.long	0x287f
+	.uleb128 0x2d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3545
+	.byte	0x27
+	.byte	0x4c
+	.long	0x2890
+	.uleb128 0x5
+	.long	0xf9
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3547
+	.byte	0x16
+	.byte	0x63
+	.uleb128 0x1d
+	.long	.LASF3548
+	.byte	0x16
+	.byte	0x62
+	.uleb128 0x14
+	.long	.LASF3549
+	.byte	0xc
+	.byte	0x74
+	.long	0x28af
+	.uleb128 0x5
+	.long	0x28af
+	.byte	0
+	.uleb128 0x4
+	.long	0x42a
+	.uleb128 0x1d
+	.long	.LASF3550
+	.byte	0x30
+	.byte	0x49
+	.uleb128 0x1d
+	.long	.LASF3551
+	.byte	0x16
+	.byte	0x69
+	.uleb128 0x14
+	.long	.LASF3552
+	.byte	0x16
+	.byte	0x6f
+	.long	0x28d3
+	.uleb128 0x5
+	.long	0xf0a
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF3553
+	.byte	0x20
+	.byte	0x7e
+	.byte	0x9
+	.long	0xe3
+	.long	0x28e5
+	.uleb128 0x2d
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3554
+	.byte	0x20
+	.byte	0x92
+	.byte	0xa
+	.long	0xf9
+	.long	0x28fb
+	.uleb128 0x5
+	.long	0xf9
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3555
+	.byte	0x34
+	.byte	0x1b
+	.uleb128 0x14
+	.long	.LASF3556
+	.byte	0x1a
+	.byte	0xc8
+	.long	0x2918
+	.uleb128 0x5
+	.long	0x2918
+	.uleb128 0x5
+	.long	0xf0a
+	.byte	0
+	.uleb128 0x4
+	.long	0x1222
+	.uleb128 0x14
+	.long	.LASF3557
+	.byte	0xc
+	.byte	0x75
+	.long	0x292e
+	.uleb128 0x5
+	.long	0x28af
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3558
+	.byte	0x35
+	.byte	0x17
+	.long	0x2944
+	.uleb128 0x5
+	.long	0xd44
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3559
+	.byte	0x17
+	.byte	0x31
+	.long	0x2955
+	.uleb128 0x5
+	.long	0xe3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3560
+	.byte	0x16
+	.byte	0x6d
+	.long	0x2966
+	.uleb128 0x5
+	.long	0xe3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3561
+	.byte	0x25
+	.byte	0xbc
+	.byte	0x5
+	.long	0x8d
+	.long	0x2986
+	.uleb128 0x5
+	.long	0x2986
+	.uleb128 0x5
+	.long	0x298b
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x10a
+	.uleb128 0x4
+	.long	0x1c74
+	.uleb128 0x16
+	.long	.LASF3570
+	.byte	0x25
+	.byte	0xbb
+	.byte	0xa
+	.long	0x10a
+	.uleb128 0x11
+	.long	.LASF3562
+	.byte	0xb
+	.byte	0x28
+	.byte	0xa
+	.long	0x10a
+	.long	0x29b2
+	.uleb128 0x5
+	.long	0x10c2
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3563
+	.byte	0x25
+	.byte	0xba
+	.byte	0x11
+	.long	0x29c8
+	.long	0x29c8
+	.uleb128 0x5
+	.long	0x1cfa
+	.byte	0
+	.uleb128 0x4
+	.long	0x105
+	.uleb128 0x11
+	.long	.LASF3564
+	.byte	0x25
+	.byte	0xb9
+	.byte	0x11
+	.long	0x29c8
+	.long	0x29e3
+	.uleb128 0x5
+	.long	0x1cfa
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3565
+	.byte	0xb
+	.byte	0x26
+	.byte	0x9
+	.long	0xe3
+	.long	0x29f9
+	.uleb128 0x5
+	.long	0x10c2
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3566
+	.byte	0x15
+	.byte	0x2b
+	.byte	0x5
+	.long	0x8d
+	.long	0x2a14
+	.uleb128 0x5
+	.long	0x127
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3567
+	.byte	0x15
+	.byte	0x2d
+	.byte	0xa
+	.long	0x10a
+	.long	0x2a2a
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3568
+	.byte	0xb
+	.byte	0x2c
+	.byte	0xa
+	.long	0x181
+	.long	0x2a40
+	.uleb128 0x5
+	.long	0x10c2
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3569
+	.byte	0x15
+	.byte	0x2c
+	.byte	0x5
+	.long	0x162
+	.long	0x2a5b
+	.uleb128 0x5
+	.long	0x8d
+	.uleb128 0x5
+	.long	0x2a5b
+	.byte	0
+	.uleb128 0x4
+	.long	0xd98
+	.uleb128 0x16
+	.long	.LASF3571
+	.byte	0x15
+	.byte	0x2a
+	.byte	0x5
+	.long	0x8d
+	.uleb128 0x11
+	.long	.LASF3572
+	.byte	0xb
+	.byte	0x27
+	.byte	0xa
+	.long	0xf9
+	.long	0x2a82
+	.uleb128 0x5
+	.long	0x10c2
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3573
+	.byte	0xb
+	.byte	0x2b
+	.byte	0x5
+	.long	0x8d
+	.long	0x2a98
+	.uleb128 0x5
+	.long	0x10c2
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3574
+	.byte	0x36
+	.byte	0x2d
+	.uleb128 0x1d
+	.long	.LASF3575
+	.byte	0x20
+	.byte	0x8f
+	.uleb128 0x2e
+	.long	.LASF3576
+	.byte	0x37
+	.value	0x13d
+	.byte	0x11
+	.long	0xa5
+	.long	0x2abd
+	.uleb128 0x5
+	.long	0x131
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3577
+	.byte	0x23
+	.byte	0x82
+	.byte	0x5
+	.long	0x162
+	.long	0x2ad3
+	.uleb128 0x5
+	.long	0x18a1
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3578
+	.byte	0x2a
+	.byte	0x74
+	.long	0x2ae9
+	.uleb128 0x5
+	.long	0x2014
+	.uleb128 0x5
+	.long	0x2ae9
+	.byte	0
+	.uleb128 0x4
+	.long	0x208d
+	.uleb128 0x14
+	.long	.LASF3579
+	.byte	0x2c
+	.byte	0x65
+	.long	0x2b04
+	.uleb128 0x5
+	.long	0x2223
+	.uleb128 0x5
+	.long	0x2b04
+	.byte	0
+	.uleb128 0x4
+	.long	0x2283
+	.uleb128 0x16
+	.long	.LASF3580
+	.byte	0x2d
+	.byte	0x3c
+	.byte	0x10
+	.long	0x244a
+	.uleb128 0x16
+	.long	.LASF3581
+	.byte	0x2d
+	.byte	0x48
+	.byte	0x9
+	.long	0xe3
+	.uleb128 0x16
+	.long	.LASF3582
+	.byte	0x33
+	.byte	0x22
+	.byte	0xa
+	.long	0x10a
+	.uleb128 0x16
+	.long	.LASF3583
+	.byte	0x2d
+	.byte	0x4a
+	.byte	0x9
+	.long	0xd7
+	.uleb128 0x16
+	.long	.LASF3584
+	.byte	0x2d
+	.byte	0x4c
+	.byte	0x9
+	.long	0xd7
+	.uleb128 0x16
+	.long	.LASF3585
+	.byte	0x2d
+	.byte	0x46
+	.byte	0xa
+	.long	0xf9
+	.uleb128 0x16
+	.long	.LASF3586
+	.byte	0x1d
+	.byte	0x28
+	.byte	0x9
+	.long	0xd7
+	.uleb128 0x11
+	.long	.LASF3587
+	.byte	0x20
+	.byte	0x93
+	.byte	0xa
+	.long	0xf9
+	.long	0x2b73
+	.uleb128 0x5
+	.long	0xf9
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3588
+	.byte	0x13
+	.byte	0xb5
+	.byte	0x12
+	.long	0x2b7f
+	.uleb128 0x4
+	.long	0x990
+	.uleb128 0x11
+	.long	.LASF3589
+	.byte	0x30
+	.byte	0x5a
+	.byte	0x9
+	.long	0xcb
+	.long	0x2b9a
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3590
+	.byte	0x38
+	.value	0x197
+	.byte	0xf
+	.long	0x11b
+	.long	0x2bb1
+	.uleb128 0x5
+	.long	0x127
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3591
+	.byte	0x16
+	.byte	0x71
+	.byte	0x9
+	.long	0xe3
+	.uleb128 0x16
+	.long	.LASF3592
+	.byte	0x16
+	.byte	0x6c
+	.byte	0x9
+	.long	0xe3
+	.uleb128 0x14
+	.long	.LASF3593
+	.byte	0xb
+	.byte	0x20
+	.long	0x2bdf
+	.uleb128 0x5
+	.long	0x10c2
+	.uleb128 0x5
+	.long	0x10a
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3594
+	.byte	0x25
+	.byte	0xb5
+	.byte	0xd
+	.long	0x169
+	.long	0x2bf5
+	.uleb128 0x5
+	.long	0x1cfa
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3595
+	.byte	0xb
+	.byte	0x1f
+	.long	0x2c0b
+	.uleb128 0x5
+	.long	0x10c2
+	.uleb128 0x5
+	.long	0xf9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3596
+	.byte	0xb
+	.byte	0x23
+	.long	0x2c26
+	.uleb128 0x5
+	.long	0x10c2
+	.uleb128 0x5
+	.long	0xcf2
+	.uleb128 0x5
+	.long	0x8d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3597
+	.byte	0xb
+	.byte	0x1e
+	.long	0x2c3c
+	.uleb128 0x5
+	.long	0x10c2
+	.uleb128 0x5
+	.long	0xe3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3598
+	.byte	0x1c
+	.byte	0x47
+	.byte	0x5
+	.long	0x162
+	.long	0x2c52
+	.uleb128 0x5
+	.long	0x10a
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3599
+	.byte	0x33
+	.byte	0x1e
+	.byte	0x5
+	.long	0x162
+	.long	0x2c68
+	.uleb128 0x5
+	.long	0x10a
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3600
+	.byte	0x38
+	.byte	0x3d
+	.byte	0xe
+	.long	0xac
+	.long	0x2c88
+	.uleb128 0x5
+	.long	0xac
+	.uleb128 0x5
+	.long	0x8d
+	.uleb128 0x5
+	.long	0x11b
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF3642
+	.value	0x964
+	.uleb128 0x30
+	.long	.LASF3601
+	.value	0x928
+	.byte	0xd
+	.long	0xfe7
+	.long	0x2cf4
+	.uleb128 0x13
+	.string	"cmd"
+	.value	0x928
+	.byte	0x2e
+	.long	0x10b8
+	.uleb128 0x18
+	.long	.LASF3602
+	.value	0x928
+	.byte	0x40
+	.long	0x10b8
+	.uleb128 0x18
+	.long	.LASF3603
+	.value	0x928
+	.byte	0x5c
+	.long	0x10bd
+	.uleb128 0x8
+	.string	"ret"
+	.value	0x92a
+	.byte	0x9
+	.long	0x8d
+	.uleb128 0x8
+	.string	"dst"
+	.value	0x92b
+	.byte	0xd
+	.long	0x10c2
+	.uleb128 0x8
+	.string	"src"
+	.value	0x92c
+	.byte	0xd
+	.long	0x10c2
+	.uleb128 0x9
+	.long	.LASF3604
+	.value	0x92d
+	.byte	0x14
+	.long	0x105
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF3605
+	.value	0x920
+	.byte	0x5
+	.long	0x162
+	.long	0x2d1d
+	.uleb128 0x18
+	.long	.LASF3604
+	.value	0x920
+	.byte	0x26
+	.long	0xf9
+	.uleb128 0x13
+	.string	"dst"
+	.value	0x920
+	.byte	0x36
+	.long	0x10c2
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3614
+	.value	0x654
+	.byte	0x14
+	.long	0xfe7
+	.long	0x2e76
+	.uleb128 0x18
+	.long	.LASF3604
+	.value	0x654
+	.byte	0x33
+	.long	0xf9
+	.uleb128 0x13
+	.string	"src"
+	.value	0x654
+	.byte	0x43
+	.long	0x10c2
+	.uleb128 0x8
+	.string	"i"
+	.value	0x656
+	.byte	0xe
+	.long	0x10a
+	.uleb128 0x9
+	.long	.LASF3606
+	.value	0x657
+	.byte	0xd
+	.long	0xe3
+	.uleb128 0x9
+	.long	.LASF3607
+	.value	0x658
+	.byte	0x18
+	.long	0x37
+	.uleb128 0xc
+	.long	0x2d93
+	.uleb128 0x9
+	.long	.LASF3274
+	.value	0x67a
+	.byte	0x15
+	.long	0xe3
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3608
+	.value	0x67e
+	.byte	0x1a
+	.long	0x2e76
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"i"
+	.value	0x67f
+	.byte	0x1a
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x2da3
+	.uleb128 0x8
+	.string	"i"
+	.value	0x694
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x2dc1
+	.uleb128 0x8
+	.string	"mac"
+	.value	0x69f
+	.byte	0x28
+	.long	0x2e86
+	.uleb128 0x8
+	.string	"box"
+	.value	0x6a1
+	.byte	0x1a
+	.long	0x2e8b
+	.byte	0
+	.uleb128 0xc
+	.long	0x2dd3
+	.uleb128 0x9
+	.long	.LASF3609
+	.value	0x6b4
+	.byte	0x20
+	.long	0x2e90
+	.byte	0
+	.uleb128 0xc
+	.long	0x2de3
+	.uleb128 0x8
+	.string	"i"
+	.value	0x6c9
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x2df3
+	.uleb128 0x8
+	.string	"i"
+	.value	0x6f2
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x2e10
+	.uleb128 0x8
+	.string	"id"
+	.value	0x84c
+	.byte	0xd
+	.long	0x8d
+	.uleb128 0x9
+	.long	.LASF3610
+	.value	0x851
+	.byte	0xd
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x2e21
+	.uleb128 0x8
+	.string	"id"
+	.value	0x864
+	.byte	0xd
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x2e31
+	.uleb128 0x8
+	.string	"i"
+	.value	0x8b9
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x2e69
+	.uleb128 0x9
+	.long	.LASF3611
+	.value	0x8d3
+	.byte	0x15
+	.long	0xe3
+	.uleb128 0x9
+	.long	.LASF3612
+	.value	0x8d9
+	.byte	0x15
+	.long	0xe3
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF2943
+	.value	0x8dc
+	.byte	0x19
+	.long	0xe3
+	.uleb128 0x9
+	.long	.LASF3613
+	.value	0x8de
+	.byte	0x25
+	.long	0x2854
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"i"
+	.value	0x911
+	.byte	0x1b
+	.long	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xf9
+	.long	0x2e86
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	0x1216
+	.uleb128 0x4
+	.long	0x27b8
+	.uleb128 0x4
+	.long	0x13af
+	.uleb128 0x1c
+	.long	.LASF3615
+	.value	0x642
+	.byte	0x14
+	.long	0xfe7
+	.long	0x2ed8
+	.uleb128 0x13
+	.string	"src"
+	.value	0x642
+	.byte	0x39
+	.long	0x10c2
+	.uleb128 0x9
+	.long	.LASF3031
+	.value	0x644
+	.byte	0x11
+	.long	0xfe7
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3616
+	.value	0x646
+	.byte	0x18
+	.long	0x105
+	.uleb128 0x9
+	.long	.LASF3617
+	.value	0x647
+	.byte	0x1a
+	.long	0xd98
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3618
+	.value	0x634
+	.byte	0x14
+	.long	0xfe7
+	.long	0x2f0d
+	.uleb128 0x13
+	.string	"dst"
+	.value	0x634
+	.byte	0x34
+	.long	0x10c2
+	.uleb128 0x13
+	.string	"src"
+	.value	0x634
+	.byte	0x41
+	.long	0x10c2
+	.uleb128 0x9
+	.long	.LASF3616
+	.value	0x636
+	.byte	0xf
+	.long	0x94
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF3622
+	.value	0x61d
+	.long	0x2f6d
+	.uleb128 0x13
+	.string	"dst"
+	.value	0x61d
+	.byte	0x2f
+	.long	0x10c2
+	.uleb128 0x13
+	.string	"src"
+	.value	0x61d
+	.byte	0x3c
+	.long	0x10c2
+	.uleb128 0x9
+	.long	.LASF3616
+	.value	0x61f
+	.byte	0x14
+	.long	0x105
+	.uleb128 0x9
+	.long	.LASF3619
+	.value	0x620
+	.byte	0xe
+	.long	0xf9
+	.uleb128 0x9
+	.long	.LASF3620
+	.value	0x626
+	.byte	0xe
+	.long	0x181
+	.uleb128 0x9
+	.long	.LASF3621
+	.value	0x629
+	.byte	0xe
+	.long	0xf9
+	.uleb128 0x9
+	.long	.LASF3617
+	.value	0x62a
+	.byte	0x16
+	.long	0xd98
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF3623
+	.value	0x5fe
+	.long	0x2fb7
+	.uleb128 0x13
+	.string	"dst"
+	.value	0x5fe
+	.byte	0x2d
+	.long	0x10c2
+	.uleb128 0x13
+	.string	"src"
+	.value	0x5fe
+	.byte	0x3a
+	.long	0x10c2
+	.uleb128 0x9
+	.long	.LASF3616
+	.value	0x600
+	.byte	0xe
+	.long	0xf9
+	.uleb128 0x9
+	.long	.LASF3617
+	.value	0x608
+	.byte	0x16
+	.long	0xd98
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3624
+	.value	0x60a
+	.byte	0x13
+	.long	0x94
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3625
+	.value	0x5ed
+	.byte	0x11
+	.long	0x10a
+	.long	0x2fe0
+	.uleb128 0x13
+	.string	"src"
+	.value	0x5ed
+	.byte	0x2f
+	.long	0x10c2
+	.uleb128 0x18
+	.long	.LASF2974
+	.value	0x5ed
+	.byte	0x3c
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF3626
+	.value	0x5de
+	.long	0x3010
+	.uleb128 0x13
+	.string	"dst"
+	.value	0x5de
+	.byte	0x2c
+	.long	0x10c2
+	.uleb128 0x18
+	.long	.LASF2974
+	.value	0x5de
+	.byte	0x39
+	.long	0xe3
+	.uleb128 0x18
+	.long	.LASF3606
+	.value	0x5de
+	.byte	0x48
+	.long	0x10a
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF3627
+	.value	0x5c5
+	.long	0x3064
+	.uleb128 0x13
+	.string	"dst"
+	.value	0x5c5
+	.byte	0x30
+	.long	0x10c2
+	.uleb128 0x13
+	.string	"src"
+	.value	0x5c5
+	.byte	0x3d
+	.long	0x10c2
+	.uleb128 0x9
+	.long	.LASF3628
+	.value	0x5c7
+	.byte	0xe
+	.long	0x10a
+	.uleb128 0x9
+	.long	.LASF3629
+	.value	0x5ce
+	.byte	0x1b
+	.long	0x3064
+	.uleb128 0x9
+	.long	.LASF3619
+	.value	0x5cf
+	.byte	0xf
+	.long	0x94
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"i"
+	.value	0x5d4
+	.byte	0xe
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x1c74
+	.long	0x3074
+	.uleb128 0x10
+	.long	0x3c
+	.byte	0x17
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3630
+	.value	0x5a8
+	.byte	0x14
+	.long	0xfe7
+	.long	0x30dd
+	.uleb128 0x13
+	.string	"dst"
+	.value	0x5a8
+	.byte	0x36
+	.long	0x10c2
+	.uleb128 0x13
+	.string	"src"
+	.value	0x5a8
+	.byte	0x43
+	.long	0x10c2
+	.uleb128 0x9
+	.long	.LASF3286
+	.value	0x5ad
+	.byte	0x13
+	.long	0xef
+	.uleb128 0x9
+	.long	.LASF3631
+	.value	0x5b4
+	.byte	0x15
+	.long	0x29c8
+	.uleb128 0x9
+	.long	.LASF3632
+	.value	0x5b8
+	.byte	0x15
+	.long	0x29c8
+	.uleb128 0xc
+	.long	0x30d0
+	.uleb128 0x8
+	.string	"i"
+	.value	0x5b5
+	.byte	0xe
+	.long	0x8d
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"i"
+	.value	0x5b9
+	.byte	0xe
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3633
+	.value	0x279
+	.byte	0xc
+	.long	0x162
+	.long	0x32de
+	.uleb128 0x18
+	.long	.LASF3604
+	.value	0x279
+	.byte	0x2c
+	.long	0xf9
+	.uleb128 0x13
+	.string	"dst"
+	.value	0x279
+	.byte	0x3c
+	.long	0x10c2
+	.uleb128 0x18
+	.long	.LASF3603
+	.value	0x279
+	.byte	0x56
+	.long	0x10bd
+	.uleb128 0xc
+	.long	0x312f
+	.uleb128 0x9
+	.long	.LASF3634
+	.value	0x2ac
+	.byte	0x17
+	.long	0x94
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"i"
+	.value	0x2ad
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x316d
+	.uleb128 0x9
+	.long	.LASF3390
+	.value	0x2c4
+	.byte	0x1b
+	.long	0xef
+	.uleb128 0xc
+	.long	0x3150
+	.uleb128 0x8
+	.string	"i"
+	.value	0x2c5
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x3160
+	.uleb128 0x8
+	.string	"i"
+	.value	0x2c8
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"i"
+	.value	0x2cb
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x317d
+	.uleb128 0x8
+	.string	"i"
+	.value	0x2ef
+	.byte	0x17
+	.long	0x30
+	.byte	0
+	.uleb128 0xc
+	.long	0x318d
+	.uleb128 0x8
+	.string	"i"
+	.value	0x304
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x319d
+	.uleb128 0x8
+	.string	"i"
+	.value	0x32f
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x31ad
+	.uleb128 0x8
+	.string	"i"
+	.value	0x33b
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x31bd
+	.uleb128 0x8
+	.string	"c"
+	.value	0x343
+	.byte	0x1a
+	.long	0x127
+	.byte	0
+	.uleb128 0xc
+	.long	0x31e7
+	.uleb128 0x8
+	.string	"i"
+	.value	0x34d
+	.byte	0x12
+	.long	0x8d
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"mac"
+	.value	0x34e
+	.byte	0x2e
+	.long	0x2918
+	.uleb128 0x8
+	.string	"box"
+	.value	0x34f
+	.byte	0x1a
+	.long	0x2e8b
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x3205
+	.uleb128 0x8
+	.string	"i"
+	.value	0x358
+	.byte	0x12
+	.long	0x8d
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3609
+	.value	0x359
+	.byte	0x26
+	.long	0x32de
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x3223
+	.uleb128 0x8
+	.string	"i"
+	.value	0x368
+	.byte	0x12
+	.long	0x8d
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"box"
+	.value	0x369
+	.byte	0x1a
+	.long	0x2e8b
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x3233
+	.uleb128 0x8
+	.string	"i"
+	.value	0x3a2
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xc
+	.long	0x325c
+	.uleb128 0x8
+	.string	"i"
+	.value	0x3cc
+	.byte	0x12
+	.long	0x8d
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3635
+	.value	0x3ce
+	.byte	0x1c
+	.long	0x2283
+	.uleb128 0x8
+	.string	"id"
+	.value	0x3cf
+	.byte	0x15
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x3285
+	.uleb128 0x8
+	.string	"i"
+	.value	0x3d9
+	.byte	0x12
+	.long	0x8d
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3635
+	.value	0x3db
+	.byte	0x1c
+	.long	0x208d
+	.uleb128 0x8
+	.string	"id"
+	.value	0x3dc
+	.byte	0x15
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x32a3
+	.uleb128 0x8
+	.string	"i"
+	.value	0x3eb
+	.byte	0x12
+	.long	0x8d
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3636
+	.value	0x3ec
+	.byte	0x1b
+	.long	0xef
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	0x32c1
+	.uleb128 0x9
+	.long	.LASF3636
+	.value	0x400
+	.byte	0x17
+	.long	0xef
+	.uleb128 0x9
+	.long	.LASF3637
+	.value	0x407
+	.byte	0x16
+	.long	0xc6
+	.byte	0
+	.uleb128 0xc
+	.long	0x32d1
+	.uleb128 0x8
+	.string	"i"
+	.value	0x439
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"i"
+	.value	0x457
+	.byte	0x12
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x13bb
+	.uleb128 0x1e
+	.long	.LASF3638
+	.value	0x1fc
+	.long	0x32fb
+	.uleb128 0x13
+	.string	"dst"
+	.value	0x1fc
+	.byte	0x34
+	.long	0x10c2
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF3639
+	.value	0x1ca
+	.long	0x3313
+	.uleb128 0x13
+	.string	"dst"
+	.value	0x1ca
+	.byte	0x31
+	.long	0x10c2
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3640
+	.value	0x19f
+	.byte	0x11
+	.long	0x10a
+	.long	0x3356
+	.uleb128 0x8
+	.string	"tmp"
+	.value	0x1a4
+	.byte	0x14
+	.long	0x116
+	.uleb128 0x8
+	.string	"ret"
+	.value	0x1c0
+	.byte	0xe
+	.long	0x10a
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"i"
+	.value	0x1c1
+	.byte	0xe
+	.long	0x8d
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3641
+	.value	0x1c2
+	.byte	0x18
+	.long	0x116
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF3643
+	.value	0x13b
+	.uleb128 0x1e
+	.long	.LASF3644
+	.value	0x11d
+	.long	0x33d4
+	.uleb128 0x13
+	.string	"dst"
+	.value	0x11d
+	.byte	0x2c
+	.long	0x10c2
+	.uleb128 0x9
+	.long	.LASF3641
+	.value	0x11f
+	.byte	0x9
+	.long	0x8d
+	.uleb128 0x9
+	.long	.LASF3619
+	.value	0x11f
+	.byte	0x13
+	.long	0x8d
+	.uleb128 0x3c
+	.long	.LASF3702
+	.byte	0x32
+	.value	0x121
+	.byte	0x1
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"i"
+	.value	0x124
+	.byte	0xe
+	.long	0x8d
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3645
+	.value	0x125
+	.byte	0x13
+	.long	0x94
+	.uleb128 0x8
+	.string	"box"
+	.value	0x126
+	.byte	0x16
+	.long	0x2e8b
+	.uleb128 0x8
+	.string	"len"
+	.value	0x12b
+	.byte	0x13
+	.long	0x94
+	.uleb128 0xe
+	.uleb128 0x8
+	.string	"j"
+	.value	0x12f
+	.byte	0x16
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3646
+	.value	0x112
+	.byte	0x15
+	.long	0x2e8b
+	.long	0x340d
+	.uleb128 0x18
+	.long	.LASF3647
+	.value	0x112
+	.byte	0x32
+	.long	0xe3
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3648
+	.value	0x114
+	.byte	0x12
+	.long	0xe3
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3649
+	.value	0x115
+	.byte	0x16
+	.long	0x2e8b
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3650
+	.value	0x107
+	.byte	0x15
+	.long	0x2e8b
+	.long	0x3446
+	.uleb128 0x18
+	.long	.LASF3645
+	.value	0x107
+	.byte	0x32
+	.long	0xe3
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3648
+	.value	0x109
+	.byte	0x12
+	.long	0xe3
+	.uleb128 0xe
+	.uleb128 0x9
+	.long	.LASF3649
+	.value	0x10a
+	.byte	0x16
+	.long	0x2e8b
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.long	.LASF3651
+	.byte	0x32
+	.byte	0xfc
+	.byte	0xd
+	.long	0x345f
+	.uleb128 0x1f
+	.long	.LASF3652
+	.byte	0x32
+	.byte	0xfc
+	.byte	0x27
+	.long	0xc68
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3653
+	.byte	0x31
+	.byte	0x37
+	.byte	0x59
+	.long	0x346b
+	.uleb128 0x4
+	.long	0x2750
+	.uleb128 0xb
+	.long	.LASF3654
+	.byte	0x30
+	.byte	0x46
+	.byte	0x96
+	.long	0x347c
+	.uleb128 0x4
+	.long	0x2631
+	.uleb128 0xb
+	.long	.LASF3655
+	.byte	0x30
+	.byte	0x46
+	.byte	0x4a
+	.long	0x348d
+	.uleb128 0x4
+	.long	0x263d
+	.uleb128 0xb
+	.long	.LASF3656
+	.byte	0x2f
+	.byte	0x33
+	.byte	0xa8
+	.long	0x349e
+	.uleb128 0x4
+	.long	0x2536
+	.uleb128 0xb
+	.long	.LASF3657
+	.byte	0x2f
+	.byte	0x33
+	.byte	0x53
+	.long	0x34af
+	.uleb128 0x4
+	.long	0x2542
+	.uleb128 0xb
+	.long	.LASF3658
+	.byte	0x2e
+	.byte	0x1c
+	.byte	0xae
+	.long	0x34c0
+	.uleb128 0x4
+	.long	0x248b
+	.uleb128 0xb
+	.long	.LASF3659
+	.byte	0x2e
+	.byte	0x1c
+	.byte	0x56
+	.long	0x34d1
+	.uleb128 0x4
+	.long	0x2497
+	.uleb128 0xb
+	.long	.LASF3660
+	.byte	0x2d
+	.byte	0x2f
+	.byte	0xa8
+	.long	0x34e2
+	.uleb128 0x4
+	.long	0x2407
+	.uleb128 0xb
+	.long	.LASF3661
+	.byte	0x2d
+	.byte	0x2f
+	.byte	0x53
+	.long	0x34f3
+	.uleb128 0x4
+	.long	0x2413
+	.uleb128 0x21
+	.long	.LASF3662
+	.byte	0x2c
+	.byte	0x4d
+	.byte	0xf9
+	.long	0x3516
+	.long	0x3516
+	.uleb128 0x28
+	.long	.LASF3663
+	.byte	0x2c
+	.byte	0x4d
+	.value	0x11b
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x2304
+	.uleb128 0x21
+	.long	.LASF3664
+	.byte	0x2c
+	.byte	0x4d
+	.byte	0x76
+	.long	0x3538
+	.long	0x3538
+	.uleb128 0x1f
+	.long	.LASF3663
+	.byte	0x2c
+	.byte	0x4d
+	.byte	0x91
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x2310
+	.uleb128 0xb
+	.long	.LASF3665
+	.byte	0x2a
+	.byte	0x55
+	.byte	0xf6
+	.long	0x3549
+	.uleb128 0x4
+	.long	0x2126
+	.uleb128 0xb
+	.long	.LASF3666
+	.byte	0x2a
+	.byte	0x55
+	.byte	0x7a
+	.long	0x355a
+	.uleb128 0x4
+	.long	0x2132
+	.uleb128 0xb
+	.long	.LASF3667
+	.byte	0x2a
+	.byte	0x45
+	.byte	0xde
+	.long	0x356b
+	.uleb128 0x4
+	.long	0x20e1
+	.uleb128 0xb
+	.long	.LASF3668
+	.byte	0x2a
+	.byte	0x45
+	.byte	0x6e
+	.long	0x357c
+	.uleb128 0x4
+	.long	0x20ed
+	.uleb128 0xb
+	.long	.LASF3669
+	.byte	0x28
+	.byte	0x29
+	.byte	0xb4
+	.long	0x358d
+	.uleb128 0x4
+	.long	0x1f35
+	.uleb128 0xb
+	.long	.LASF3670
+	.byte	0x28
+	.byte	0x29
+	.byte	0x59
+	.long	0x359e
+	.uleb128 0x4
+	.long	0x1f41
+	.uleb128 0xb
+	.long	.LASF3671
+	.byte	0x27
+	.byte	0x48
+	.byte	0xcc
+	.long	0x35af
+	.uleb128 0x4
+	.long	0x1ec9
+	.uleb128 0xb
+	.long	.LASF3672
+	.byte	0x27
+	.byte	0x48
+	.byte	0x65
+	.long	0x35c0
+	.uleb128 0x4
+	.long	0x1ed5
+	.uleb128 0xb
+	.long	.LASF3673
+	.byte	0x24
+	.byte	0x93
+	.byte	0x8a
+	.long	0x35d1
+	.uleb128 0x4
+	.long	0x1b57
+	.uleb128 0xb
+	.long	.LASF3674
+	.byte	0x24
+	.byte	0x93
+	.byte	0x44
+	.long	0x35e2
+	.uleb128 0x4
+	.long	0x1b63
+	.uleb128 0x31
+	.long	.LASF3675
+	.byte	0x24
+	.byte	0x6d
+	.long	0x3604
+	.long	0x3604
+	.uleb128 0x28
+	.long	.LASF3663
+	.byte	0x24
+	.byte	0x6d
+	.value	0x127
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x19c7
+	.uleb128 0x21
+	.long	.LASF3676
+	.byte	0x24
+	.byte	0x6d
+	.byte	0x7b
+	.long	0x3626
+	.long	0x3626
+	.uleb128 0x1f
+	.long	.LASF3663
+	.byte	0x24
+	.byte	0x6d
+	.byte	0x98
+	.long	0x8d
+	.byte	0
+	.uleb128 0x4
+	.long	0x19d3
+	.uleb128 0xb
+	.long	.LASF3677
+	.byte	0x23
+	.byte	0x78
+	.byte	0x50
+	.long	0x3637
+	.uleb128 0x4
+	.long	0x1966
+	.uleb128 0xb
+	.long	.LASF3678
+	.byte	0x20
+	.byte	0x75
+	.byte	0x9c
+	.long	0x3648
+	.uleb128 0x4
+	.long	0x16e2
+	.uleb128 0xb
+	.long	.LASF3679
+	.byte	0x20
+	.byte	0x75
+	.byte	0x4d
+	.long	0x3659
+	.uleb128 0x4
+	.long	0x16ee
+	.uleb128 0xb
+	.long	.LASF3680
+	.byte	0x20
+	.byte	0x6a
+	.byte	0x9c
+	.long	0x366a
+	.uleb128 0x4
+	.long	0x1669
+	.uleb128 0xb
+	.long	.LASF3681
+	.byte	0x20
+	.byte	0x6a
+	.byte	0x4d
+	.long	0x367b
+	.uleb128 0x4
+	.long	0x1675
+	.uleb128 0xb
+	.long	.LASF3682
+	.byte	0x1e
+	.byte	0x29
+	.byte	0xae
+	.long	0x368c
+	.uleb128 0x4
+	.long	0x150d
+	.uleb128 0xb
+	.long	.LASF3683
+	.byte	0x1e
+	.byte	0x29
+	.byte	0x56
+	.long	0x369d
+	.uleb128 0x4
+	.long	0x1519
+	.uleb128 0x21
+	.long	.LASF3684
+	.byte	0x1b
+	.byte	0x62
+	.byte	0xd3
+	.long	0x2e90
+	.long	0x36bf
+	.uleb128 0x1f
+	.long	.LASF3663
+	.byte	0x1b
+	.byte	0x62
+	.byte	0xef
+	.long	0x8d
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3685
+	.byte	0x1b
+	.byte	0x62
+	.byte	0x63
+	.long	0x32de
+	.long	0x36dc
+	.uleb128 0x1f
+	.long	.LASF3663
+	.byte	0x1b
+	.byte	0x62
+	.byte	0x78
+	.long	0x8d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3686
+	.byte	0x1a
+	.byte	0xb6
+	.byte	0xa2
+	.long	0x36e8
+	.uleb128 0x4
+	.long	0x1343
+	.uleb128 0xb
+	.long	.LASF3687
+	.byte	0x1a
+	.byte	0xb6
+	.byte	0x50
+	.long	0x36f9
+	.uleb128 0x4
+	.long	0x134f
+	.uleb128 0xb
+	.long	.LASF3688
+	.byte	0x1a
+	.byte	0xae
+	.byte	0xae
+	.long	0x370a
+	.uleb128 0x4
+	.long	0x12f1
+	.uleb128 0xb
+	.long	.LASF3689
+	.byte	0x1a
+	.byte	0xae
+	.byte	0x56
+	.long	0x371b
+	.uleb128 0x4
+	.long	0x12fd
+	.uleb128 0xb
+	.long	.LASF3690
+	.byte	0x1a
+	.byte	0xa5
+	.byte	0xba
+	.long	0x372c
+	.uleb128 0x4
+	.long	0x1292
+	.uleb128 0xb
+	.long	.LASF3691
+	.byte	0x1a
+	.byte	0xa5
+	.byte	0x5c
+	.long	0x373d
+	.uleb128 0x4
+	.long	0x129e
+	.uleb128 0x31
+	.long	.LASF3692
+	.byte	0x1a
+	.byte	0x93
+	.long	0x2e86
+	.long	0x375f
+	.uleb128 0x28
+	.long	.LASF3663
+	.byte	0x1a
+	.byte	0x93
+	.value	0x127
+	.long	0x8d
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3693
+	.byte	0x1a
+	.byte	0x93
+	.byte	0x7b
+	.long	0x2918
+	.long	0x377c
+	.uleb128 0x1f
+	.long	.LASF3663
+	.byte	0x1a
+	.byte	0x93
+	.byte	0x98
+	.long	0x8d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3694
+	.byte	0x16
+	.byte	0x4b
+	.byte	0xa2
+	.long	0x3788
+	.uleb128 0x4
+	.long	0xee1
+	.uleb128 0xb
+	.long	.LASF3695
+	.byte	0x16
+	.byte	0x4b
+	.byte	0x50
+	.long	0x3799
+	.uleb128 0x4
+	.long	0xeed
+	.uleb128 0xb
+	.long	.LASF3696
+	.byte	0xc
+	.byte	0x64
+	.byte	0x90
+	.long	0x37aa
+	.uleb128 0x4
+	.long	0x457
+	.uleb128 0xb
+	.long	.LASF3697
+	.byte	0xc
+	.byte	0x64
+	.byte	0x47
+	.long	0x37bb
+	.uleb128 0x4
+	.long	0x463
+	.uleb128 0x3e
+	.long	.LASF3698
+	.byte	0x39
+	.byte	0x7e
+	.byte	0x13
+	.long	0x8d
+	.uleb128 0x32
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x8d
+	.uleb128 0x32
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x8d
+	.uleb128 0x1f
+	.long	.LASF3699
+	.byte	0x39
+	.byte	0x7e
+	.byte	0x33
+	.long	0x8d
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 50
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 50
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 50
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 50
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 50
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 50
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 50
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 50
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 50
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 259
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 57
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 58 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 59 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 60 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x3c
+	.file 61 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3e
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 63 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 64 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x40
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 67 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 69 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x45
+	.file 70 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 76 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 77 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x4e
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1181
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1221
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 88 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x58
+	.file 89 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 90 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x5a
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0x4
+	.file 91 "./src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5b
+	.file 92 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1608
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1609
+	.byte	0x4
+	.file 93 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5d
+	.file 94 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 95 "./src/main/common/huffman.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x4
+	.file 96 "./src/main/config/config_eeprom.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x60
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1683
+	.byte	0x4
+	.file 97 "./src/main/config/config_profile.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x61
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x33
+	.byte	0x4
+	.file 98 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xf
+	.file 99 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x63
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 100 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.file 101 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x65
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1880
+	.byte	0x4
+	.file 102 "./src/main/drivers/compass.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x66
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1881
+	.byte	0x4
+	.file 103 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x67
+	.byte	0x4
+	.file 104 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x68
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.file 105 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x69
+	.file 106 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6a
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.file 107 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 108 "./src/main/drivers/max7456.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 109 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x6d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2303
+	.byte	0x4
+	.file 110 "./src/main/drivers/serial_escserial.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x36
+	.byte	0x4
+	.file 111 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x6f
+	.byte	0x4
+	.file 112 "./src/main/drivers/vtx_common.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x70
+	.byte	0x4
+	.file 113 "./src/main/drivers/vtx_soft_spi_rtc6705.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x71
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2315
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x16
+	.file 114 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x72
+	.byte	0x4
+	.file 115 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.file 116 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2321
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2322
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x18
+	.byte	0x4
+	.file 117 "./src/main/fc/fc_msp.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x75
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.file 118 "./src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.file 119 "./src/main/io/asyncfatfs/asyncfatfs.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x77
+	.file 120 "./src/main/io/asyncfatfs/fat_standard.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x78
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.byte	0x4
+	.file 121 "./src/main/io/beeper.h"
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x79
+	.byte	0x4
+	.file 122 "./src/main/io/flashfs.h"
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x7a
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.file 123 "./src/main/io/gimbal.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x7b
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2413
+	.byte	0x4
+	.file 124 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x7c
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.file 125 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0x7d
+	.byte	0x4
+	.file 126 "./src/main/io/osd.h"
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x7e
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2471
+	.byte	0x4
+	.file 127 "./src/main/io/serial_4way.h"
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0x7f
+	.file 128 "./src/main/io/serial_4way_impl.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x80
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.file 129 "./src/main/io/servos.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x81
+	.byte	0x4
+	.file 130 "./src/main/io/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x57
+	.uleb128 0x82
+	.byte	0x4
+	.file 131 "./src/main/io/vtx.h"
+	.byte	0x3
+	.uleb128 0x58
+	.uleb128 0x83
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x4
+	.file 132 "./src/main/msp/msp_protocol.h"
+	.byte	0x3
+	.uleb128 0x5b
+	.uleb128 0x84
+	.byte	0x7
+	.long	.Ldebug_macro98
+	.byte	0x4
+	.file 133 "./src/main/msp/msp_serial.h"
+	.byte	0x3
+	.uleb128 0x5c
+	.uleb128 0x85
+	.byte	0x7
+	.long	.Ldebug_macro99
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro100
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro101
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x63
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro102
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x64
+	.uleb128 0x28
+	.file 134 "./src/main/drivers/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x86
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2705
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2706
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x65
+	.uleb128 0x2d
+	.file 135 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x87
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2707
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2c
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro103
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x66
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x67
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x68
+	.uleb128 0x30
+	.byte	0x4
+	.file 136 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x6a
+	.uleb128 0x88
+	.file 137 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x89
+	.byte	0x7
+	.long	.Ldebug_macro104
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2716
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6c
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2717
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2718
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF2719
+	.byte	0x5
+	.uleb128 0x5a6
+	.long	.LASF2720
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1143
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1147
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1159
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1171
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1173
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1290
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1293
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1299
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1303
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1308
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1335
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1496
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1509
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1526
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1527
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1530
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1457
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1567
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1575
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1580
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1583
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1585
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1639
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1644
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.ab1ea5032441cd47c4f3251c83c3755e,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.huffman.h.22.39ca510718758a6c386740950620a041,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1666
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1682
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1693
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1775
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1777
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1867
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus_i2c.h.20.811afd21f5c414d17a32d0a4900984d7,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1879
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1883
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1891
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1919
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2287
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.max7456.h.21.59264cd1e20507bb3a63ba829e3208aa,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2294
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_escserial.h.20.7ffef3a1a3649b8436885bf6ed6f6f7f,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_soft_spi_rtc6705.h.20.0fe44a751d263858d589f70b71f94368,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2314
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2317
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2348
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.83.ab548d0b7b32a9305f216da5287d33d8,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2351
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2360
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2368
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.8362794d947c339e17997ec0162d97db,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2377
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.66.6f7d1d067dff5370bea805da42b83f88,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2388
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fat_standard.h.23.98e613171bbc330acb6e09557ea95570,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.25.359084437f17de36ca02cf51c97a94fa,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2412
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2422
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.25.44d42bc8a2509f001b7da5aa9bee7ce3,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.23.dfeea95d53f02f32dbd532b1d756929b,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2470
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_4way_impl.h.35.bea0096e583bd744c4600d9fb7b88c62,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2477
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_4way.h.23.82bb5777ad9c20646d24d214710a260b,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2483
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx.h.22.12f28c2beccab569593ab27679518da5,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2488
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol.h.59.90a37f358cf6019dfa5d9b9aacc74c56,comdat
+.Ldebug_macro98:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2519
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2532
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2536
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2537
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2541
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2546
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2547
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2550
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2552
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2553
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2554
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2555
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2557
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2558
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2559
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2560
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2561
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2562
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2563
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2565
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2566
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2567
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2568
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2569
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2572
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2573
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2574
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2576
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2577
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2578
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2579
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2581
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2584
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF2587
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2588
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF2589
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2590
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2591
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2592
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2593
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2594
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF2595
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF2596
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF2597
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2598
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2600
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF2601
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF2602
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2603
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2604
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2605
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2606
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF2607
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF2608
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2609
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF2610
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF2611
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2612
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2613
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2614
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF2615
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF2616
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF2617
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF2618
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF2620
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2621
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF2623
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF2624
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF2625
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2626
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2627
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2628
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2629
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF2630
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2631
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF2632
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2633
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2634
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2635
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2636
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF2637
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2638
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF2639
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2640
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF2641
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF2642
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2643
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2644
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2645
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2646
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2647
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2648
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2649
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2650
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2651
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2652
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF2653
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF2654
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2655
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2656
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2657
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF2659
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF2660
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2661
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.27.07521096acbd1fc23b5da89615487a6f,comdat
+.Ldebug_macro99:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2662
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2663
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2664
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2665
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2666
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2667
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2668
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2669
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro100:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2670
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2671
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2672
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2673
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2674
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2675
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2676
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2677
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2678
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2679
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2680
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2681
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2682
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2683
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2684
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2685
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2686
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2687
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2688
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2689
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2691
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2692
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2694
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2695
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2696
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.50.10d0067a73777b2d14d79db5df156f88,comdat
+.Ldebug_macro101:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2698
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2699
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2700
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro102:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2702
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2703
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2704
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro103:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2708
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2709
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2710
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2711
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro104:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2712
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2713
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2714
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2715
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x18
+	.long	.LASF1
+	.long	.LASF3703
+	.long	.LASF3704
+	.long	.LASF3705
+	.long	.LASF3706
+	.long	.LASF3707
+	.long	.LASF3708
+	.long	.LASF3709
+	.long	.LASF3710
+	.long	.LASF3711
+	.long	.LASF3712
+	.long	.LASF3713
+	.long	.LASF3714
+	.long	.LASF3715
+	.long	.LASF3716
+	.long	.LASF3717
+	.long	.LASF3718
+	.long	.LASF3719
+	.long	.LASF3720
+	.long	.LASF3721
+	.long	.LASF3722
+	.long	.LASF3723
+	.long	.LASF3724
+	.long	.LASF3725
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x8a
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3726
+	.byte	0x13
+	.long	.LASF3727
+	.byte	0x13
+	.long	.LASF3728
+	.byte	0x13
+	.long	.LASF3729
+	.byte	0x17
+	.long	.LASF3730
+	.byte	0xe
+	.long	.LASF3731
+	.byte	0x3
+	.long	.LASF3732
+	.byte	0x2
+	.long	.LASF3733
+	.byte	0x2
+	.long	.LASF3734
+	.byte	0x3
+	.long	.LASF3735
+	.byte	0x3
+	.long	.LASF3736
+	.byte	0x3
+	.long	.LASF3737
+	.byte	0x7
+	.long	.LASF3738
+	.byte	0x5
+	.long	.LASF3739
+	.byte	0x5
+	.long	.LASF3740
+	.byte	0x5
+	.long	.LASF3741
+	.byte	0x5
+	.long	.LASF3742
+	.byte	0x5
+	.long	.LASF3743
+	.byte	0x5
+	.long	.LASF3744
+	.byte	0x5
+	.long	.LASF3745
+	.byte	0x5
+	.long	.LASF3746
+	.byte	0x6
+	.long	.LASF3747
+	.byte	0x6
+	.long	.LASF3748
+	.byte	0x6
+	.long	.LASF3749
+	.byte	0x6
+	.long	.LASF3750
+	.byte	0xa
+	.long	.LASF3751
+	.byte	0x6
+	.long	.LASF3752
+	.byte	0x6
+	.long	.LASF3753
+	.byte	0x6
+	.long	.LASF3754
+	.byte	0x7
+	.long	.LASF3755
+	.byte	0x7
+	.long	.LASF3756
+	.byte	0x7
+	.long	.LASF3757
+	.byte	0x7
+	.long	.LASF3758
+	.byte	0x7
+	.long	.LASF3759
+	.byte	0x9
+	.long	.LASF3745
+	.byte	0x9
+	.long	.LASF3760
+	.byte	0xb
+	.long	.LASF3761
+	.byte	0xc
+	.long	.LASF3762
+	.byte	0xd
+	.long	.LASF3763
+	.byte	0xd
+	.long	.LASF3764
+	.byte	0xd
+	.long	.LASF3765
+	.byte	0xd
+	.long	.LASF3766
+	.byte	0xd
+	.long	.LASF3767
+	.byte	0xd
+	.long	.LASF3768
+	.byte	0xd
+	.long	.LASF3769
+	.byte	0xd
+	.long	.LASF3770
+	.byte	0xd
+	.long	.LASF3771
+	.byte	0xd
+	.long	.LASF3772
+	.byte	0xd
+	.long	.LASF3773
+	.byte	0x10
+	.long	.LASF3774
+	.byte	0x6
+	.long	.LASF3775
+	.byte	0x4
+	.long	.LASF3776
+	.byte	0x6
+	.long	.LASF3750
+	.byte	0xb
+	.long	.LASF3777
+	.byte	0x5
+	.long	.LASF3778
+	.byte	0x13
+	.long	.LASF3779
+	.byte	0x16
+	.long	.LASF3780
+	.byte	0x3
+	.long	.LASF3781
+	.byte	0x16
+	.long	.LASF3782
+	.byte	0x17
+	.long	.LASF3783
+	.byte	0x17
+	.long	.LASF3783
+	.byte	0x16
+	.long	.LASF3784
+	.byte	0x13
+	.long	.LASF3785
+	.byte	0x16
+	.long	.LASF3786
+	.byte	0x16
+	.long	.LASF3787
+	.byte	0x13
+	.long	.LASF3788
+	.byte	0x13
+	.long	.LASF3789
+	.byte	0x15
+	.long	.LASF3790
+	.byte	0x13
+	.long	.LASF3791
+	.byte	0x14
+	.long	.LASF3792
+	.byte	0x14
+	.long	.LASF3793
+	.byte	0x13
+	.long	.LASF3794
+	.byte	0x13
+	.long	.LASF3795
+	.byte	0x13
+	.long	.LASF3796
+	.byte	0x12
+	.long	.LASF3797
+	.byte	0x12
+	.long	.LASF3798
+	.byte	0x16
+	.long	.LASF3799
+	.byte	0x16
+	.long	.LASF3800
+	.byte	0x13
+	.long	.LASF3801
+	.byte	0x13
+	.long	.LASF3802
+	.byte	0x13
+	.long	.LASF3803
+	.byte	0x13
+	.long	.LASF3804
+	.byte	0x13
+	.long	.LASF3805
+	.byte	0x13
+	.long	.LASF3806
+	.byte	0x13
+	.long	.LASF3807
+	.byte	0x13
+	.long	.LASF3808
+	.byte	0x13
+	.long	.LASF3809
+	.byte	0x13
+	.long	.LASF3810
+	.byte	0x11
+	.long	.LASF3811
+	.byte	0xf
+	.long	.LASF3812
+	.byte	0xf
+	.long	.LASF3813
+	.byte	0x1
+	.long	.LASF3814
+	.byte	0x1
+	.long	.LASF3815
+	.byte	0x4
+	.long	.LASF3816
+	.byte	0x2
+	.long	.LASF3817
+	.byte	0x3
+	.long	.LASF3818
+	.byte	0x4
+	.long	.LASF3819
+	.byte	0x4
+	.long	.LASF3820
+	.byte	0x4
+	.long	.LASF3821
+	.byte	0x5
+	.long	.LASF3822
+	.byte	0x5
+	.long	.LASF3823
+	.byte	0x5
+	.long	.LASF3771
+	.byte	0x5
+	.long	.LASF3824
+	.byte	0x5
+	.long	.LASF3825
+	.byte	0x5
+	.long	.LASF3826
+	.byte	0x5
+	.long	.LASF3827
+	.byte	0x3
+	.long	.LASF3828
+	.byte	0x5
+	.long	.LASF3829
+	.byte	0x5
+	.long	.LASF3830
+	.byte	0x5
+	.long	.LASF3831
+	.byte	0x5
+	.long	.LASF3832
+	.byte	0x5
+	.long	.LASF3833
+	.byte	0x5
+	.long	.LASF3834
+	.byte	0x5
+	.long	.LASF3835
+	.byte	0x5
+	.long	.LASF3836
+	.byte	0x5
+	.long	.LASF3837
+	.byte	0x5
+	.long	.LASF3838
+	.byte	0x6
+	.long	.LASF3839
+	.byte	0x7
+	.long	.LASF3840
+	.byte	0x8
+	.long	.LASF3841
+	.byte	0x8
+	.long	.LASF3842
+	.byte	0x9
+	.long	.LASF3843
+	.byte	0x9
+	.long	.LASF3844
+	.byte	0x9
+	.long	.LASF3845
+	.byte	0x9
+	.long	.LASF3846
+	.byte	0x9
+	.long	.LASF3847
+	.byte	0x9
+	.long	.LASF3848
+	.byte	0x9
+	.long	.LASF3849
+	.byte	0x9
+	.long	.LASF3758
+	.byte	0x9
+	.long	.LASF3850
+	.byte	0x9
+	.long	.LASF3851
+	.byte	0x9
+	.long	.LASF3852
+	.byte	0xa
+	.long	.LASF3853
+	.byte	0xa
+	.long	.LASF3764
+	.byte	0x5
+	.long	.LASF3854
+	.byte	0x3
+	.long	.LASF3855
+	.byte	0xd
+	.long	.LASF3856
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1404:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF3042:
+	.string	"BOXMAG"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF3054:
+	.string	"BOXCALIB"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF907:
+	.string	"__DECL_SIMD_exp10l "
+.LASF3517:
+	.string	"gpsNoFixLatitude"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2447:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1505:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF2951:
+	.string	"rxBufferHead"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF3545:
+	.string	"accSetCalibrationCycles"
+.LASF2568:
+	.string	"MSP_SET_TRANSPONDER_CONFIG 83"
+.LASF3613:
+	.string	"portConfig"
+.LASF2473:
+	.string	"ESC_IS_LO isEscLo(selected_esc)"
+.LASF1185:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2238:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2534:
+	.string	"MSP_SET_RX_CONFIG 45"
+.LASF1946:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1284:
+	.string	"_Mret_"
+.LASF902:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF2695:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2378:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_FLAPS"
+.LASF1515:
+	.string	"_T_WCHAR "
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF2914:
+	.string	"enabled"
+.LASF1232:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF2270:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF2189:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF3048:
+	.string	"BOXGPSHOLD"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF971:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2522:
+	.string	"MSP_SET_BATTERY_CONFIG 33"
+.LASF3133:
+	.string	"failsafeConfig_s"
+.LASF2818:
+	.string	"read"
+.LASF2493:
+	.string	"MULTIWII_IDENTIFIER \"MWII\";"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF807:
+	.string	"__DECL_SIMD_sinl "
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF2623:
+	.string	"MSP_SET_RAW_RC 200"
+.LASF2400:
+	.string	"FAT_FILE_ATTRIBUTE_READ_ONLY 0x01"
+.LASF1591:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2756:
+	.string	"RGB_GREEN"
+.LASF1387:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF3478:
+	.string	"boardAlignment_System"
+.LASF1424:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF2829:
+	.string	"mpuConfiguration_s"
+.LASF2836:
+	.string	"mpuConfiguration_t"
+.LASF3247:
+	.string	"sbus_inversion"
+.LASF2724:
+	.string	"long unsigned int"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1511:
+	.string	"__wchar_t__ "
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF808:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1538:
+	.string	"GYRO "
+.LASF3120:
+	.string	"HEADFREE_MODE"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2135:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF3047:
+	.string	"BOXGPSHOME"
+.LASF2151:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2988:
+	.string	"FEATURE_RX_MSP"
+.LASF2143:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF856:
+	.string	"__DECL_SIMD_acosf "
+.LASF2755:
+	.string	"RGB_RED"
+.LASF1779:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF3681:
+	.string	"mixerConfig"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2762:
+	.string	"sbuf_t"
+.LASF2634:
+	.string	"MSP_SET_MOTOR 214"
+.LASF2074:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1815:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF3157:
+	.string	"MIXER_HEX6X"
+.LASF2315:
+	.string	"CLI_SETTING_NOT_FOUND -1"
+.LASF1857:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF2782:
+	.string	"pidSumLimitYaw"
+.LASF861:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF893:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1101:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1674:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2115:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF3287:
+	.string	"schedulerTraceEntry_t"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1078:
+	.string	"__DECL_SIMD_log"
+.LASF798:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1354:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF2373:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF380:
+	.string	"__unix 1"
+.LASF2466:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF1623:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF1579:
+	.string	"VTX_CONTROL"
+.LASF2750:
+	.string	"buildDate"
+.LASF3018:
+	.string	"dynThrPID"
+.LASF2183:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF3086:
+	.string	"alt_hold_fast_change"
+.LASF1429:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF3225:
+	.string	"serialPortConfig_s"
+.LASF3231:
+	.string	"serialPortConfig_t"
+.LASF2481:
+	.string	"imSIL_BLB 1"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF944:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1557:
+	.string	"USE_PWM"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF3088:
+	.string	"rcControlsConfig_t"
+.LASF884:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF3252:
+	.string	"spektrum_sat_bind"
+.LASF3600:
+	.string	"memset"
+.LASF2451:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2377:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF1308:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF2598:
+	.string	"MSP_BOXNAMES 116"
+.LASF3165:
+	.string	"MIXER_HEX6H"
+.LASF3119:
+	.string	"GPS_HOLD_MODE"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF2679:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF865:
+	.string	"__DECL_SIMD_atan "
+.LASF1286:
+	.string	"__MATHCALL_NAME"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1826:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1484:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1130:
+	.string	"__DECL_SIMD_atan2"
+.LASF2448:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF2185:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2553:
+	.string	"MSP_SET_RX_MAP 65"
+.LASF2357:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF2772:
+	.string	"PIDVEL"
+.LASF1313:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1586:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF3410:
+	.string	"VOLTAGE_METER_ID_12V_2"
+.LASF1152:
+	.string	"__DECL_SIMD_acoshf"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF3206:
+	.string	"specialColorIndexes_s"
+.LASF3207:
+	.string	"specialColorIndexes_t"
+.LASF1327:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF3482:
+	.string	"mag_t"
+.LASF1800:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF3112:
+	.string	"WAS_EVER_ARMED"
+.LASF1684:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF2581:
+	.string	"MSP_SENSOR_CONFIG 96"
+.LASF3476:
+	.string	"yawDegrees"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1096:
+	.string	"__DECL_SIMD_atanf"
+.LASF1146:
+	.string	"__DECL_SIMD_atanh"
+.LASF2399:
+	.string	"FAT16_MAX_CLUSTERS 65524"
+.LASF1317:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1393:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF2685:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2177:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF3675:
+	.string	"rxFailsafeChannelConfigsMutable"
+.LASF2972:
+	.string	"name"
+.LASF1341:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF3049:
+	.string	"BOXPASSTHRU"
+.LASF3202:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF3428:
+	.string	"VOLTAGE_METER_ID_CELL_2"
+.LASF1832:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF3353:
+	.string	"CURRENT_METER_ID_9V_10"
+.LASF2791:
+	.string	"dtermSetpointWeight"
+.LASF1906:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF2291:
+	.string	"VIDEO_BUFFER_CHARS_NTSC 390"
+.LASF2702:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF2034:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1234:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1803:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2155:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1700:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF2591:
+	.string	"MSP_RAW_GPS 106"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1169:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF3560:
+	.string	"changePidProfile"
+.LASF854:
+	.string	"__DECL_SIMD_powf128x "
+.LASF3031:
+	.string	"result"
+.LASF2255:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2627:
+	.string	"MSP_ACC_CALIBRATION 205"
+.LASF1678:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1577:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1069:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1034:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1908:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2124:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2375:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1672:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1729:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1847:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF874:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF2650:
+	.string	"MSP_DEBUGMSG 253"
+.LASF1477:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1367:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1298:
+	.string	"_Marg_ _Float128"
+.LASF2444:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF2111:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF3527:
+	.string	"pidValuesAsTelemetry"
+.LASF1576:
+	.string	"USE_DASHBOARD"
+.LASF2090:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF3668:
+	.string	"currentSensorADCConfig"
+.LASF857:
+	.string	"__DECL_SIMD_acosl "
+.LASF2815:
+	.string	"sensorAccInitFuncPtr"
+.LASF1145:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF2713:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF1280:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF2624:
+	.string	"MSP_SET_RAW_GPS 201"
+.LASF3134:
+	.string	"failsafe_delay"
+.LASF1371:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF1219:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF1610:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2099:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF3308:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2262:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2446:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF3239:
+	.string	"rcData"
+.LASF3281:
+	.string	"rxRuntimeConfig_t"
+.LASF3414:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_1"
+.LASF2528:
+	.string	"MSP_SET_BOARD_ALIGNMENT_CONFIG 39"
+.LASF3699:
+	.string	"high"
+.LASF3166:
+	.string	"MIXER_PPM_TO_SERVO"
+.LASF2873:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF866:
+	.string	"__DECL_SIMD_atanf "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF3074:
+	.string	"endStep"
+.LASF1910:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2016:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3425:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_12"
+.LASF1127:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2771:
+	.string	"PIDMAG"
+.LASF2023:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF2217:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF809:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF3551:
+	.string	"validateAndFixGyroConfig"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF2340:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2411:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF3470:
+	.string	"BATTERY_CRITICAL"
+.LASF3652:
+	.string	"serialPort"
+.LASF3253:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF2268:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2393:
+	.string	"FAT_VOLUME_ID_SIGNATURE_1 0x55"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2086:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2180:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1698:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1954:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2850:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF3125:
+	.string	"flightModeFlags"
+.LASF1221:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1812:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF2065:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF3170:
+	.string	"MIXER_CUSTOM"
+.LASF2348:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF2659:
+	.string	"MSP_SERVO_MIX_RULES 241"
+.LASF799:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF2670:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF912:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2645:
+	.string	"MSP_SET_SETTING_VALUES 226"
+.LASF2395:
+	.string	"FAT_DIRECTORY_ENTRY_SIZE 32"
+.LASF1507:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1071:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF1425:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF1418:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF2061:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1195:
+	.string	"__f32(x) x ##f32"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1854:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF3599:
+	.string	"feature"
+.LASF2167:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1094:
+	.string	"__DECL_SIMD_atan"
+.LASF3141:
+	.string	"failsafeConfig_System"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2289:
+	.string	"BLACKBRIGHTNESS 0x00"
+.LASF2537:
+	.string	"MSP_LED_STRIP_CONFIG 48"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1066:
+	.string	"__DECL_SIMD_cos"
+.LASF1996:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF3596:
+	.string	"sbufWriteData"
+.LASF1732:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1900:
+	.string	"BIT(x) (1 << (x))"
+.LASF1983:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF1593:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF3581:
+	.string	"getBatteryCellCount"
+.LASF2408:
+	.string	"FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))"
+.LASF2941:
+	.string	"serialPort_s"
+.LASF968:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2970:
+	.string	"serialPort_t"
+.LASF2307:
+	.string	"PA5G_BS_MASK 0x0E00"
+.LASF896:
+	.string	"__DECL_SIMD_exp2f "
+.LASF805:
+	.string	"__DECL_SIMD_sin "
+.LASF1486:
+	.string	"TELEMETRY_SRXL "
+.LASF3190:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1236:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1233:
+	.string	"FP_INT_TONEAREST 4"
+.LASF3274:
+	.string	"channelCount"
+.LASF2654:
+	.string	"MSP_UID 160"
+.LASF2194:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1295:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF3145:
+	.string	"attitudeEulerAngles_t"
+.LASF975:
+	.string	"__DECL_SIMD_log2 "
+.LASF832:
+	.string	"__DECL_SIMD_logf32x "
+.LASF2229:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1793:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF804:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1462:
+	.string	"USE_PWM "
+.LASF3541:
+	.string	"pidnames"
+.LASF2760:
+	.string	"hsvColor_s"
+.LASF2759:
+	.string	"hsvColor_t"
+.LASF3575:
+	.string	"stopPwmAllMotors"
+.LASF2317:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2352:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF3044:
+	.string	"BOXHEADADJ"
+.LASF2369:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF3688:
+	.string	"flight3DConfigMutable"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1072:
+	.string	"__DECL_SIMD_sinf"
+.LASF3320:
+	.string	"accSamplingInterval"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF3669:
+	.string	"barometerConfigMutable"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2290:
+	.string	"BWBRIGHTNESS ((BLACKBRIGHTNESS << 2) | WHITEBRIGHTNESS)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1414:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF2550:
+	.string	"MSP_ARMING_CONFIG 61"
+.LASF2310:
+	.string	"QI_5G_MASK 0x0038"
+.LASF1350:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF3175:
+	.string	"yaw_motors_reversed"
+.LASF3158:
+	.string	"MIXER_OCTOX8"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1015:
+	.string	"__DECL_SIMD_erf "
+.LASF3256:
+	.string	"rssi_invert"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2293:
+	.string	"VIDEO_LINES_NTSC 13"
+.LASF2208:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1559:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2266:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF3278:
+	.string	"rcFrameTimeUsFn"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1205:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF2175:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2867:
+	.string	"OWNER_ADC_EXT"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1708:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF964:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF2181:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1663:
+	.string	"HSV_VALUE_MAX 255"
+.LASF2564:
+	.string	"MSP_SDCARD_SUMMARY 79"
+.LASF545:
+	.string	"__wur "
+.LASF2360:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1737:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF905:
+	.string	"__DECL_SIMD_exp10 "
+.LASF3504:
+	.string	"gyro_soft_notch_cutoff_2"
+.LASF2926:
+	.string	"MODE_RXTX"
+.LASF1889:
+	.string	"IOCFG_IPD 0"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1776:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF1455:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1314:
+	.string	"__MATHCALL_NARROW"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1287:
+	.string	"_Marg_ long double"
+.LASF2604:
+	.string	"MSP_NAV_CONFIG 122"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1475:
+	.string	"TELEMETRY_HOTT "
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1796:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF2228:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1830:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1179:
+	.string	"__f128(x) x ##f128"
+.LASF1379:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF1547:
+	.string	"USE_UART2 "
+.LASF2313:
+	.string	"CHANNELS_PER_BAND 8"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF2283:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1859:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF3396:
+	.string	"currentSensorVirtualConfig_System"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2974:
+	.string	"size"
+.LASF846:
+	.string	"__DECL_SIMD_powf "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1166:
+	.string	"__DECL_SIMD_erfc"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF3279:
+	.string	"rcFrameStatusFnPtr"
+.LASF1767:
+	.string	"PG_VTX_CONFIG 515"
+.LASF2139:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF911:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF3572:
+	.string	"sbufReadU16"
+.LASF1899:
+	.string	"UNUSED(x) (void)(x)"
+.LASF3106:
+	.string	"adjustmentIndex"
+.LASF1340:
+	.string	"M_E 2.7182818284590452354"
+.LASF3565:
+	.string	"sbufReadU8"
+.LASF3183:
+	.string	"motorPoleCount"
+.LASF3570:
+	.string	"schedulerTraceSequence"
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1991:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2711:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF3020:
+	.string	"tpa_breakpoint"
+.LASF3102:
+	.string	"armingConfig_System"
+.LASF3117:
+	.string	"BARO_MODE"
+.LASF1745:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2573:
+	.string	"MSP_VTX_CONFIG 88"
+.LASF2017:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF988:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1759:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1761:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2350:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF830:
+	.string	"__DECL_SIMD_logf64 "
+.LASF2450:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF1590:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1884:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2950:
+	.string	"txBuffer"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2662:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF1487:
+	.string	"USE_DASHBOARD "
+.LASF2891:
+	.string	"OWNER_MPU_EXTI"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF831:
+	.string	"__DECL_SIMD_logf128 "
+.LASF586:
+	.string	"__stub_stty "
+.LASF795:
+	.string	"__DECL_SIMD_cos "
+.LASF3105:
+	.string	"auxSwitchChannelIndex"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF3696:
+	.string	"pidConfigMutable"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF2556:
+	.string	"MSP_REBOOT 68"
+.LASF2551:
+	.string	"MSP_SET_ARMING_CONFIG 62"
+.LASF2741:
+	.string	"size_t"
+.LASF3210:
+	.string	"modeColors"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF3458:
+	.string	"batteryNotPresentLevel"
+.LASF3562:
+	.string	"sbufReadU32"
+.LASF2199:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF3259:
+	.string	"maxcheck"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1856:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF2324:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF2095:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF785:
+	.string	"NULL"
+.LASF2834:
+	.string	"resetFn"
+.LASF1765:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1979:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2699:
+	.string	"SCHEDULER_TRACE_SIZE 64"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF2094:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF2861:
+	.string	"OWNER_MOTOR"
+.LASF1809:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF3409:
+	.string	"VOLTAGE_METER_ID_12V_1"
+.LASF1869:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1383:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF3195:
+	.string	"INPUT_RC_THROTTLE"
+.LASF982:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1816:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF2966:
+	.string	"beginWrite"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF787:
+	.string	"__need_NULL"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF2042:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF984:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF3403:
+	.string	"VOLTAGE_METER_ID_5V_1"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF3255:
+	.string	"rssi_scale"
+.LASF1703:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF2841:
+	.string	"MPU_65xx_I2C"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF820:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2243:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2866:
+	.string	"OWNER_ADC_CURR"
+.LASF1852:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF3462:
+	.string	"useVBatAlerts"
+.LASF2605:
+	.string	"MSP_MOTOR_3D_CONFIG 124"
+.LASF3467:
+	.string	"batteryConfig_System"
+.LASF2566:
+	.string	"MSP_SET_BLACKBOX_CONFIG 81"
+.LASF1549:
+	.string	"USE_UART4 "
+.LASF1727:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF3115:
+	.string	"HORIZON_MODE"
+.LASF878:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF509:
+	.string	"__P(args) args"
+.LASF3114:
+	.string	"ANGLE_MODE"
+.LASF1716:
+	.string	"PG_RX_CONFIG 24"
+.LASF3187:
+	.string	"motor_disarmed"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1191:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1645:
+	.string	"FC_FIRMWARE_NAME \"Betaflight\""
+.LASF3530:
+	.string	"telemetryConfig_System"
+.LASF1970:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1093:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1829:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF3060:
+	.string	"BOXSERVO1"
+.LASF1928:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3062:
+	.string	"BOXSERVO3"
+.LASF3499:
+	.string	"gyro_use_32khz"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2440:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF2784:
+	.string	"vbatPidCompensation"
+.LASF998:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF2468:
+	.string	"VISIBLE(x) (x & VISIBLE_FLAG)"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF2038:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF2852:
+	.string	"mpu6050Resolution_e"
+.LASF3036:
+	.string	"mspPacket_t"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2674:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1074:
+	.string	"__DECL_SIMD_sincos"
+.LASF1921:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF2913:
+	.string	"period"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1398:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF3548:
+	.string	"resetEEPROM"
+.LASF3615:
+	.string	"mspFcSetSettingValuesCommand"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF2359:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF858:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2128:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2249:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2582:
+	.string	"MSP_SET_SENSOR_CONFIG 97"
+.LASF3584:
+	.string	"getMAhDrawn"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2715:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF1694:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1292:
+	.string	"_Marg_ _Float32x"
+.LASF1381:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF2232:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF977:
+	.string	"__DECL_SIMD_log2l "
+.LASF1112:
+	.string	"__DECL_SIMD_exp10f"
+.LASF3632:
+	.string	"executionHistogram"
+.LASF2871:
+	.string	"OWNER_PINDEBUG"
+.LASF1923:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1355:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF1199:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1055:
+	.string	"__DECL_SIMD_tan "
+.LASF1364:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF3457:
+	.string	"vbatwarningcellvoltage"
+.LASF1740:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF2860:
+	.string	"OWNER_PPMINPUT"
+.LASF3486:
+	.string	"mag_hardware"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF3412:
+	.string	"VOLTAGE_METER_ID_ESC_COMBINED_1"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2117:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF3163:
+	.string	"MIXER_HELI_90_DEG"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1348:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF3559:
+	.string	"changeControlRateProfile"
+.LASF1742:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF2572:
+	.string	"MSP_OSD_CHAR_WRITE 87"
+.LASF2919:
+	.string	"motorPwmInversion"
+.LASF2054:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1968:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF2453:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF1755:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF2720:
+	.string	"MSP_SCHEDULER_TRACE_MAX_ENTRIES 24"
+.LASF1246:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2965:
+	.string	"writeBuf"
+.LASF2245:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1227:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2237:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF3174:
+	.string	"mixerConfig_s"
+.LASF3176:
+	.string	"mixerConfig_t"
+.LASF969:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1883:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1966:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF3347:
+	.string	"CURRENT_METER_ID_BATTERY_10"
+.LASF2166:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2647:
+	.string	"MSP_EEPROM_WRITE 250"
+.LASF3240:
+	.string	"rxFailsafeChannelConfig_s"
+.LASF3684:
+	.string	"adjustmentRangesMutable"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1493:
+	.string	"VTX_COMMON "
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2112:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1441:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF2308:
+	.string	"PA5G_PW_MASK 0x0180"
+.LASF2218:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2692:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2070:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2096:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF2279:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF3375:
+	.string	"CURRENT_METER_NONE"
+.LASF1862:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF3138:
+	.string	"failsafe_throttle_low_delay"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3261:
+	.string	"rcInterpolationChannels"
+.LASF2763:
+	.string	"PIDROLL"
+.LASF1177:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF3687:
+	.string	"armingConfig"
+.LASF2193:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1036:
+	.string	"__DECL_SIMD_asinhf "
+.LASF2158:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF852:
+	.string	"__DECL_SIMD_powf32x "
+.LASF822:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF3528:
+	.string	"report_cell_voltage"
+.LASF2514:
+	.string	"MSP_API_VERSION 1"
+.LASF1917:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF2748:
+	.string	"debug"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2485:
+	.string	"VTX_BAND_MAX 5"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1728:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF3523:
+	.string	"frsky_unit"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF3405:
+	.string	"VOLTAGE_METER_ID_5V_10"
+.LASF3379:
+	.string	"CURRENT_METER_MAX"
+.LASF1842:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1931:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF3066:
+	.string	"BOX3DDISABLESWITCH"
+.LASF1399:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF2962:
+	.string	"serialSetBaudRate"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF2309:
+	.string	"PD_Q5G_MASK 0x0040"
+.LASF3152:
+	.string	"MIXER_GIMBAL"
+.LASF2529:
+	.string	"MSP_CURRENT_METER_CONFIG 40"
+.LASF1081:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF2727:
+	.string	"__uint8_t"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2008:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1875:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF2660:
+	.string	"MSP_SET_SERVO_MIX_RULE 242"
+.LASF2323:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF838:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2119:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF3077:
+	.string	"modeId"
+.LASF2588:
+	.string	"MSP_SERVO 103"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF2037:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2334:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1530:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF3685:
+	.string	"adjustmentRanges"
+.LASF2362:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1083:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2774:
+	.string	"pidProfile_s"
+.LASF2794:
+	.string	"pidProfile_t"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2764:
+	.string	"PIDPITCH"
+.LASF382:
+	.string	"unix 1"
+.LASF1937:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1864:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF3459:
+	.string	"voltageMeterSource"
+.LASF3172:
+	.string	"MIXER_CUSTOM_TRI"
+.LASF3549:
+	.string	"pidInitFilters"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF3024:
+	.string	"magHold"
+.LASF2050:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1338:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF2934:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF2900:
+	.string	"OWNER_TRANSPONDER"
+.LASF1881:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF2606:
+	.string	"MSP_RC_DEADBAND 125"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF3127:
+	.string	"GPS_FIX"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2980:
+	.string	"FEATURE_SERVO_TILT"
+.LASF1154:
+	.string	"__DECL_SIMD_erf"
+.LASF3032:
+	.string	"streamLimit"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF2463:
+	.string	"LF(name) LED_FUNCTION_ ## name"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1268:
+	.string	"_Mdouble_ _Float64x"
+.LASF1866:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF3041:
+	.string	"BOXBARO"
+.LASF842:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1229:
+	.string	"FP_INT_UPWARD 0"
+.LASF2013:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF1454:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1956:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2797:
+	.string	"pid_in_gyro_isr"
+.LASF2301:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF1750:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF2433:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF1086:
+	.string	"__DECL_SIMD_pow"
+.LASF938:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1868:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF879:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF2840:
+	.string	"MPU_60x0_SPI"
+.LASF2367:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF1411:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1240:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF2202:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1553:
+	.string	"USE_UART8 "
+.LASF2894:
+	.string	"OWNER_USB_DETECT"
+.LASF2288:
+	.string	"WHITEBRIGHTNESS 0x01"
+.LASF2153:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2365:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1524:
+	.string	"_GCC_WCHAR_T "
+.LASF973:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2516:
+	.string	"MSP_FC_VERSION 3"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF978:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF999:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2409:
+	.string	"FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))"
+.LASF2456:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF3475:
+	.string	"pitchDegrees"
+.LASF3228:
+	.string	"gps_baudrateIndex"
+.LASF3576:
+	.string	"lrintf"
+.LASF2638:
+	.string	"MSP_SET_RESET_CURR_PID 219"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2881:
+	.string	"OWNER_SDCARD"
+.LASF2292:
+	.string	"VIDEO_BUFFER_CHARS_PAL 480"
+.LASF1416:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF1569:
+	.string	"TELEMETRY_HOTT"
+.LASF3040:
+	.string	"BOXHORIZON"
+.LASF1994:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF859:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF2899:
+	.string	"OWNER_LED_STRIP"
+.LASF2936:
+	.string	"SERIAL_BIDIR"
+.LASF851:
+	.string	"__DECL_SIMD_powf128 "
+.LASF821:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF3641:
+	.string	"flag"
+.LASF1436:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF2565:
+	.string	"MSP_BLACKBOX_CONFIG 80"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF3027:
+	.string	"MSP_RESULT_NO_REPLY"
+.LASF1139:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF2991:
+	.string	"FEATURE_DASHBOARD"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2182:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF1888:
+	.string	"IOCFG_AF_OD 0"
+.LASF2849:
+	.string	"mpuSensor_e"
+.LASF3100:
+	.string	"auto_disarm_delay"
+.LASF3151:
+	.string	"MIXER_BICOPTER"
+.LASF3701:
+	.string	"writeEEPROM"
+.LASF1665:
+	.string	"HUFFMAN_TABLE_SIZE 256"
+.LASF2260:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF885:
+	.string	"__DECL_SIMD_hypot "
+.LASF2084:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF2459:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF3067:
+	.string	"BOXFPVANGLEMIX"
+.LASF3201:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF3433:
+	.string	"VOLTAGE_METER_ESC"
+.LASF2186:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1720:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF863:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1693:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF3014:
+	.string	"rcExpo8"
+.LASF2475:
+	.string	"ESC_SET_LO setEscLo(selected_esc)"
+.LASF2457:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2264:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1848:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF2953:
+	.string	"txBufferHead"
+.LASF924:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF3578:
+	.string	"currentMeterRead"
+.LASF2827:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1374:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF2687:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhl "
+.LASF986:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1464:
+	.string	"USE_SERIALRX_CRSF "
+.LASF2939:
+	.string	"serialReceiveCallbackPtr"
+.LASF1132:
+	.string	"__DECL_SIMD_atan2f"
+.LASF1926:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1754:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2210:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF3333:
+	.string	"accelerometerTrims"
+.LASF1104:
+	.string	"__DECL_SIMD_hypotf"
+.LASF1155:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2747:
+	.string	"timeUs_t"
+.LASF2596:
+	.string	"MSP_RC_TUNING 111"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2080:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF3111:
+	.string	"ARMED"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF3056:
+	.string	"BOXOSD"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1397:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF1641:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF2295:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF2677:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1253:
+	.string	"_Mdouble_ float"
+.LASF1109:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF3189:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF918:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF947:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF3058:
+	.string	"BOXGTUNE"
+.LASF2858:
+	.string	"OWNER_FREE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF2263:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF2709:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF3577:
+	.string	"serialIsPortAvailable"
+.LASF2414:
+	.string	"LAT 0"
+.LASF2416:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2506:
+	.string	"CAP_NAVI_VERSION_BIT_4_MSB ((uint32_t)1 << 31)"
+.LASF1385:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF2069:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1992:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1143:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF850:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2562:
+	.string	"MSP_RXFAIL_CONFIG 77"
+.LASF2312:
+	.string	"PA_CONTROL_DEFAULT 0x4FBD"
+.LASF1110:
+	.string	"__DECL_SIMD_exp10"
+.LASF1452:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1501:
+	.string	"_T_PTRDIFF_ "
+.LASF841:
+	.string	"__DECL_SIMD_expf128 "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2593:
+	.string	"MSP_ATTITUDE 108"
+.LASF3288:
+	.string	"TASK_SYSTEM"
+.LASF1843:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF1905:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF2691:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF2465:
+	.string	"LD(name) LED_FLAG_DIRECTION(LED_DIRECTION_ ## name)"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF2417:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF3272:
+	.string	"rcReadRawDataFnPtr"
+.LASF2284:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2161:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1876:
+	.string	"GYRO_LPF_NONE 7"
+.LASF895:
+	.string	"__DECL_SIMD_exp2 "
+.LASF3400:
+	.string	"VOLTAGE_METER_ID_BATTERY_1"
+.LASF2967:
+	.string	"endWrite"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF903:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1903:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF3345:
+	.string	"CURRENT_METER_ID_BATTERY_1"
+.LASF3346:
+	.string	"CURRENT_METER_ID_BATTERY_2"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF3626:
+	.string	"mspFcWriteSettingValue"
+.LASF888:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1302:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1249:
+	.string	"_Mdouble_"
+.LASF3331:
+	.string	"acc_hardware"
+.LASF1082:
+	.string	"__DECL_SIMD_exp"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF2209:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1585:
+	.string	"USE_DSHOT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1495:
+	.string	"VTX_SMARTAUDIO "
+.LASF2786:
+	.string	"levelAngleLimit"
+.LASF839:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1531:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF2388:
+	.string	"MAX_SERVO_BOXES 3"
+.LASF1941:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF3479:
+	.string	"mag_s"
+.LASF1461:
+	.string	"USE_PPM "
+.LASF2024:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2559:
+	.string	"MSP_DATAFLASH_ERASE 72"
+.LASF3118:
+	.string	"GPS_HOME_MODE"
+.LASF3590:
+	.string	"strlen"
+.LASF3447:
+	.string	"vbatresdivval"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1534:
+	.string	"U_ID_0 0"
+.LASF2875:
+	.string	"OWNER_SYSTEM"
+.LASF1108:
+	.string	"__DECL_SIMD_exp2f"
+.LASF2746:
+	.string	"timeDelta_t"
+.LASF3683:
+	.string	"failsafeConfig"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1722:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1571:
+	.string	"TELEMETRY_CRSF"
+.LASF1989:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF3522:
+	.string	"frsky_coordinate_format"
+.LASF904:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF3384:
+	.string	"mAhDrawn"
+.LASF1583:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1627:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF3654:
+	.string	"gyroConfigMutable"
+.LASF1780:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF3271:
+	.string	"rxConfig_System"
+.LASF3456:
+	.string	"vbatmincellvoltage"
+.LASF2673:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1817:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1532:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF996:
+	.string	"__DECL_SIMD_atanhf "
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF2302:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF1106:
+	.string	"__DECL_SIMD_exp2"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF3084:
+	.string	"yaw_deadband"
+.LASF2267:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF3552:
+	.string	"resetPidProfile"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2648:
+	.string	"MSP_RESERVE_1 251"
+.LASF3009:
+	.string	"systemConfig_System"
+.LASF1473:
+	.string	"TELEMETRY "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1433:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF3637:
+	.string	"virtualSensorSubframeLength"
+.LASF2530:
+	.string	"MSP_SET_CURRENT_METER_CONFIG 41"
+.LASF3564:
+	.string	"getTaskLatenessHistogram"
+.LASF1270:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1774:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF2236:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2690:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF1084:
+	.string	"__DECL_SIMD_expf"
+.LASF2254:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2999:
+	.string	"FEATURE_RX_SPI"
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1909:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2107:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF3162:
+	.string	"MIXER_HELI_120_CCPM"
+.LASF3136:
+	.string	"failsafe_throttle"
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2497:
+	.string	"INAV_IDENTIFIER \"INAV\""
+.LASF1907:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF3591:
+	.string	"getCurrentControlRateProfileIndex"
+.LASF1839:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1432:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF3531:
+	.string	"flightControllerIdentifier"
+.LASF1472:
+	.string	"LED_STRIP "
+.LASF1932:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF2862:
+	.string	"OWNER_SERVO"
+.LASF3341:
+	.string	"baro_cf_alt"
+.LASF1771:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF3260:
+	.string	"rcInterpolation"
+.LASF1451:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF3213:
+	.string	"SERIAL_PORT_USART1"
+.LASF3214:
+	.string	"SERIAL_PORT_USART2"
+.LASF3215:
+	.string	"SERIAL_PORT_USART3"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1255:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1247:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF3220:
+	.string	"SERIAL_PORT_USART8"
+.LASF2535:
+	.string	"MSP_LED_COLORS 46"
+.LASF1904:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF3536:
+	.string	"permanentId"
+.LASF892:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF987:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2492:
+	.string	"API_VERSION_LENGTH 2"
+.LASF3610:
+	.string	"voltageSensorADCIndex"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF3611:
+	.string	"portConfigSize"
+.LASF1997:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2982:
+	.string	"FEATURE_GPS"
+.LASF1632:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2383:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF1520:
+	.string	"_WCHAR_T_DEFINED "
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2590:
+	.string	"MSP_RC 105"
+.LASF3657:
+	.string	"compassConfig"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF3322:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF1170:
+	.string	"__DECL_SIMD_tan"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF3146:
+	.string	"attitude"
+.LASF2462:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF2079:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1412:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF1691:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF2020:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF3173:
+	.string	"MIXER_QUADX_1234"
+.LASF825:
+	.string	"__DECL_SIMD_log "
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2498:
+	.string	"RACEFLIGHT_IDENTIFIER \"RCFL\""
+.LASF3337:
+	.string	"baro_hardware"
+.LASF2281:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2242:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1138:
+	.string	"__DECL_SIMD_log2"
+.LASF3464:
+	.string	"consumptionWarningPercentage"
+.LASF2693:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF3513:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1137:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2933:
+	.string	"SERIAL_PARITY_NO"
+.LASF3140:
+	.string	"failsafeConfig_t"
+.LASF1352:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF3045:
+	.string	"BOXCAMSTAB"
+.LASF3402:
+	.string	"VOLTAGE_METER_ID_BATTERY_10"
+.LASF2171:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF3286:
+	.string	"taskId"
+.LASF870:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1730:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1503:
+	.string	"__PTRDIFF_T "
+.LASF845:
+	.string	"__DECL_SIMD_pow "
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2504:
+	.string	"CAP_PLATFORM_32BIT ((uint32_t)1 << 31)"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2294:
+	.string	"VIDEO_LINES_PAL 16"
+.LASF1834:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF2927:
+	.string	"portMode_t"
+.LASF2178:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1080:
+	.string	"__DECL_SIMD_logf"
+.LASF1714:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1536:
+	.string	"U_ID_2 2"
+.LASF2062:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF3053:
+	.string	"BOXLLIGHTS"
+.LASF2286:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2947:
+	.string	"rxBufferSize"
+.LASF2822:
+	.string	"accAlign"
+.LASF1351:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF806:
+	.string	"__DECL_SIMD_sinf "
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1806:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF1459:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF3680:
+	.string	"mixerConfigMutable"
+.LASF3229:
+	.string	"blackbox_baudrateIndex"
+.LASF2201:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1369:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1609:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF919:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1818:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF3169:
+	.string	"MIXER_ATAIL4"
+.LASF2036:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2600:
+	.string	"MSP_WP 118"
+.LASF1088:
+	.string	"__DECL_SIMD_powf"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2917:
+	.string	"motorPwmRate"
+.LASF2271:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF931:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF3567:
+	.string	"cliSettingGetValue"
+.LASF922:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF2753:
+	.string	"FD_PITCH"
+.LASF2892:
+	.string	"OWNER_BARO_EXTI"
+.LASF2609:
+	.string	"MSP_VOLTAGE_METERS 128"
+.LASF3635:
+	.string	"meter"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF3650:
+	.string	"findBoxByActiveBoxId"
+.LASF3489:
+	.string	"compassConfig_t"
+.LASF2809:
+	.string	"CW180_DEG_FLIP"
+.LASF2126:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF3651:
+	.string	"mspRebootFn"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2730:
+	.string	"__uint16_t"
+.LASF2743:
+	.string	"double"
+.LASF2141:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF2576:
+	.string	"MSP_SET_ADVANCED_CONFIG 91"
+.LASF940:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF3091:
+	.string	"deadband3d_low"
+.LASF1718:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF2382:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF1644:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1457:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF2884:
+	.string	"OWNER_FLASH_CS"
+.LASF1749:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF3437:
+	.string	"unfiltered"
+.LASF1217:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF1300:
+	.string	"_Mret_ _Float32x"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1955:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1209:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF997:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1492:
+	.string	"USE_SENSOR_NAMES "
+.LASF2174:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1178:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1849:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1770:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1673:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2157:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF3455:
+	.string	"vbatmaxcellvoltage"
+.LASF2430:
+	.string	"LED_POS_OFFSET 0"
+.LASF2888:
+	.string	"OWNER_OSD_CS"
+.LASF889:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF871:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF2644:
+	.string	"MSP_DATAFLASH_LOG_ERASE 225"
+.LASF3227:
+	.string	"msp_baudrateIndex"
+.LASF2455:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF1380:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF891:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF2848:
+	.string	"BMI_160_SPI"
+.LASF1546:
+	.string	"USE_UART1 "
+.LASF1297:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF3491:
+	.string	"gyroConfig_s"
+.LASF2032:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF3122:
+	.string	"PASSTHRU_MODE"
+.LASF2326:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF882:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2280:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2775:
+	.string	"dterm_filter_type"
+.LASF2804:
+	.string	"CW90_DEG"
+.LASF3628:
+	.string	"sequence"
+.LASF2252:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1597:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF3647:
+	.string	"permenantId"
+.LASF2198:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF3276:
+	.string	"rcReadRawFn"
+.LASF2122:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF2527:
+	.string	"MSP_BOARD_ALIGNMENT_CONFIG 38"
+.LASF2714:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF2116:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF2525:
+	.string	"MSP_FEATURE_CONFIG 36"
+.LASF3258:
+	.string	"mincheck"
+.LASF3303:
+	.string	"TASK_COUNT"
+.LASF1541:
+	.string	"USE_FAKE_ACC "
+.LASF2052:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2615:
+	.string	"MSP_TASK_HISTOGRAM 134"
+.LASF1924:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1359:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF1778:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1447:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF815:
+	.string	"__DECL_SIMD_sincos "
+.LASF2356:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1701:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1709:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF2168:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2942:
+	.string	"vTable"
+.LASF784:
+	.string	"__need_size_t"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1850:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF913:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1046:
+	.string	"__DECL_SIMD_erfcf "
+.LASF355:
+	.string	"__amd64 1"
+.LASF916:
+	.string	"__DECL_SIMD_coshf "
+.LASF2959:
+	.string	"serialTotalRxWaiting"
+.LASF2642:
+	.string	"MSP_SET_GPS_CONFIG 223"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1555:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF3321:
+	.string	"accSmooth"
+.LASF1639:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1548:
+	.string	"USE_UART3 "
+.LASF2745:
+	.string	"_Bool"
+.LASF2837:
+	.string	"MPU_NONE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1076:
+	.string	"__DECL_SIMD_sincosf"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2757:
+	.string	"RGB_BLUE"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF3230:
+	.string	"telemetry_baudrateIndex"
+.LASF2703:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2109:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2420:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF2374:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2336:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1500:
+	.string	"_PTRDIFF_T "
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF3098:
+	.string	"gyro_cal_on_first_arm"
+.LASF2507:
+	.string	"CAP_NAVI_VERSION_BIT_3 ((uint32_t)1 << 30)"
+.LASF1517:
+	.string	"_WCHAR_T_ "
+.LASF3096:
+	.string	"flight3DConfig_System"
+.LASF3092:
+	.string	"deadband3d_high"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF3622:
+	.string	"mspFcSettingValuesCommand"
+.LASF1206:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF3107:
+	.string	"adjustmentRange_t"
+.LASF921:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1794:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF1871:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF3318:
+	.string	"SENSOR_GPSMAG"
+.LASF3670:
+	.string	"barometerConfig"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1568:
+	.string	"TELEMETRY_FRSKY"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1251:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1638:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF2010:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF3069:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1877:
+	.string	"I2C_SHORT_TIMEOUT ((uint32_t)0x1000)"
+.LASF3129:
+	.string	"SMALL_ANGLE"
+.LASF1690:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF2503:
+	.string	"BOARD_HARDWARE_REVISION_LENGTH 2"
+.LASF2956:
+	.string	"rxFrameCallback"
+.LASF1886:
+	.string	"IOCFG_OUT_OD 0"
+.LASF2491:
+	.string	"API_VERSION_MINOR 33"
+.LASF1725:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2040:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2697:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF2059:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2454:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF1646:
+	.string	"FC_VERSION_MAJOR 3"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2616:
+	.string	"MSP_SCHEDULER_TRACE 135"
+.LASF2631:
+	.string	"MSP_SELECT_SETTING 210"
+.LASF3636:
+	.string	"adcSensorSubframeLength"
+.LASF2779:
+	.string	"dterm_notch_cutoff"
+.LASF2344:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF546:
+	.string	"__always_inline"
+.LASF1550:
+	.string	"USE_UART5 "
+.LASF2165:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF826:
+	.string	"__DECL_SIMD_logf "
+.LASF3561:
+	.string	"schedulerTraceRead"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1490:
+	.string	"USE_RX_MSP "
+.LASF1943:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF3388:
+	.string	"CURRENT_SENSOR_ESC"
+.LASF1920:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF1915:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF3449:
+	.string	"voltageSensorADCConfig_t"
+.LASF3137:
+	.string	"failsafe_kill_switch"
+.LASF2200:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2621:
+	.string	"MSP_SETTING_FIND 140"
+.LASF2055:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1835:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF3521:
+	.string	"sportHalfDuplex"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2207:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1223:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2705:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1056:
+	.string	"__DECL_SIMD_tanf "
+.LASF2826:
+	.string	"mpuReadRegisterFnPtr"
+.LASF2476:
+	.string	"ESC_INPUT setEscInput(selected_esc)"
+.LASF3181:
+	.string	"maxthrottle"
+.LASF3302:
+	.string	"TASK_MSP_PUSH"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF3676:
+	.string	"rxFailsafeChannelConfigs"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1333:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF402:
+	.string	"false 0"
+.LASF3221:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF2583:
+	.string	"MSP_OSD_VIDEO_CONFIG 180"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1434:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2520:
+	.string	"MSP_SET_NAME 11"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2663:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF2265:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1427:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF2538:
+	.string	"MSP_SET_LED_STRIP_CONFIG 49"
+.LASF802:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF2855:
+	.string	"resolution"
+.LASF3633:
+	.string	"mspFcProcessOutCommand"
+.LASF3363:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_5"
+.LASF3364:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_6"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1077:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1552:
+	.string	"USE_UART7 "
+.LASF1696:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2192:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF2364:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1967:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF3313:
+	.string	"SENSOR_ACC"
+.LASF1225:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2744:
+	.string	"TIM_TypeDef"
+.LASF1305:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1282:
+	.string	"_Marg_ double"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2937:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1738:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF2148:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1423:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF2579:
+	.string	"MSP_PID_ADVANCED 94"
+.LASF3700:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF2578:
+	.string	"MSP_SET_FILTER_CONFIG 93"
+.LASF1025:
+	.string	"__DECL_SIMD_tanh "
+.LASF2162:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2012:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF2618:
+	.string	"MSP_DATAFLASH_LOG_READ 137"
+.LASF3005:
+	.string	"activeRateProfile"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF980:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1925:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2225:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF2009:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1527:
+	.string	"_BSD_WCHAR_T_"
+.LASF1347:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2253:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2140:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1902:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF917:
+	.string	"__DECL_SIMD_coshl "
+.LASF2700:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF3354:
+	.string	"CURRENT_METER_ID_12V_1"
+.LASF3355:
+	.string	"CURRENT_METER_ID_12V_2"
+.LASF1918:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF3436:
+	.string	"filtered"
+.LASF1160:
+	.string	"__DECL_SIMD_tanhf"
+.LASF3492:
+	.string	"gyro_align"
+.LASF364:
+	.string	"__k8 1"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF2683:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1316:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF3693:
+	.string	"modeActivationConditions"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2460:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF1563:
+	.string	"USE_SERIALRX_SUMD"
+.LASF1192:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1677:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF3293:
+	.string	"TASK_SERIAL"
+.LASF1564:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1988:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF3063:
+	.string	"BOXBLACKBOX"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2574:
+	.string	"MSP_SET_VTX_CONFIG 89"
+.LASF814:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF3282:
+	.string	"rxRuntimeConfig"
+.LASF2523:
+	.string	"MSP_MODE_RANGES 34"
+.LASF3616:
+	.string	"index"
+.LASF3607:
+	.string	"dataSize"
+.LASF2419:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF914:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1880:
+	.string	"I2C_DEVICE I2CINVALID"
+.LASF1686:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2331:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2078:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1977:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF2651:
+	.string	"MSP_DEBUG 254"
+.LASF1660:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF983:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF2548:
+	.string	"MSP_PID_CONTROLLER 59"
+.LASF1670:
+	.string	"FAST_MATH "
+.LASF1625:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF981:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF2256:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2928:
+	.string	"portOptions_t"
+.LASF1945:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF2051:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF29:
+	.string	"_LP64 1"
+.LASF3465:
+	.string	"vbathysteresis"
+.LASF2509:
+	.string	"CAP_NAVI_VERSION_BIT_1_LSB ((uint32_t)1 << 28)"
+.LASF1466:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1218:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF3543:
+	.string	"serialFindPortConfiguration"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1163:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF3336:
+	.string	"barometerConfig_s"
+.LASF3342:
+	.string	"barometerConfig_t"
+.LASF955:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2524:
+	.string	"MSP_SET_MODE_RANGE 35"
+.LASF1721:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1963:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1357:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF827:
+	.string	"__DECL_SIMD_logl "
+.LASF1523:
+	.string	"__INT_WCHAR_T_H "
+.LASF2285:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF801:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1202:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1203:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1510:
+	.string	"__need_ptrdiff_t"
+.LASF2479:
+	.string	"USE_SERIAL_4WAY_SK_BOOTLOADER "
+.LASF1384:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF2592:
+	.string	"MSP_COMP_GPS 107"
+.LASF828:
+	.string	"__DECL_SIMD_logf16 "
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2874:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1176:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1984:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2137:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2093:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1786:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF1736:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1057:
+	.string	"__DECL_SIMD_tanl "
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2305:
+	.string	"ALL_ESCS 255"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2438:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF2656:
+	.string	"MSP_GPSSTATISTICS 166"
+.LASF2179:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2688:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2005:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF3692:
+	.string	"modeActivationConditionsMutable"
+.LASF2259:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2995:
+	.string	"FEATURE_TRANSPONDER"
+.LASF833:
+	.string	"__DECL_SIMD_logf64x "
+.LASF3450:
+	.string	"voltageSensorADCConfig_SystemArray"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1819:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2777:
+	.string	"yaw_lpf_hz"
+.LASF2546:
+	.string	"MSP_SET_VOLTAGE_METER_CONFIG 57"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF3520:
+	.string	"telemetry_inversion"
+.LASF1174:
+	.string	"_BITS_FLOATN_H "
+.LASF2244:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1772:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF2120:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1332:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF1391:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF934:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1529:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF2132:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1173:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF2363:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF2269:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2230:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2541:
+	.string	"MSP_ADJUSTMENT_RANGES 52"
+.LASF1912:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF2240:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF3480:
+	.string	"magADC"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1267:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF2689:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1439:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF876:
+	.string	"__DECL_SIMD_asinf "
+.LASF1058:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF818:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF2963:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF3001:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF2985:
+	.string	"FEATURE_TELEMETRY"
+.LASF2649:
+	.string	"MSP_RESERVE_2 252"
+.LASF1655:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF1572:
+	.string	"TELEMETRY_SRXL"
+.LASF3000:
+	.string	"FEATURE_SOFTSPI"
+.LASF1344:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF3149:
+	.string	"MIXER_QUADP"
+.LASF1710:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2196:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF3150:
+	.string	"MIXER_QUADX"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF2325:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1783:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF2150:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2872:
+	.string	"OWNER_TIMER"
+.LASF1220:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1890:
+	.string	"IOCFG_IPU 0"
+.LASF3052:
+	.string	"BOXLEDLOW"
+.LASF3390:
+	.string	"scale"
+.LASF3511:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1895:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2047:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF3350:
+	.string	"CURRENT_METER_ID_5V_10"
+.LASF3497:
+	.string	"gyro_soft_lpf_hz"
+.LASF2806:
+	.string	"CW270_DEG"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1131:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1595:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF2940:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1965:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1172:
+	.string	"__DECL_SIMD_tanf"
+.LASF3625:
+	.string	"mspFcReadSettingValue"
+.LASF1158:
+	.string	"__DECL_SIMD_tanh"
+.LASF1167:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF2449:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF1782:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1785:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF2316:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1867:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF853:
+	.string	"__DECL_SIMD_powf64x "
+.LASF823:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1323:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF2251:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1115:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF3168:
+	.string	"MIXER_SINGLECOPTER"
+.LASF793:
+	.string	"_MATH_H 1"
+.LASF1175:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2558:
+	.string	"MSP_DATAFLASH_READ 71"
+.LASF1508:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2997:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF2404:
+	.string	"FAT_FILE_ATTRIBUTE_DIRECTORY 0x10"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF3658:
+	.string	"boardAlignmentMutable"
+.LASF2085:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3064:
+	.string	"BOXFAILSAFE"
+.LASF3368:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_10"
+.LASF3369:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_11"
+.LASF3370:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_12"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF2969:
+	.string	"setRxFrameCallback"
+.LASF2839:
+	.string	"MPU_60x0"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1802:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF1377:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF3469:
+	.string	"BATTERY_WARNING"
+.LASF1259:
+	.string	"_Mdouble_ _Float32"
+.LASF2722:
+	.string	"short unsigned int"
+.LASF1264:
+	.string	"_Mdouble_ _Float128"
+.LASF1210:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1995:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2106:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2250:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1640:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF894:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF3292:
+	.string	"TASK_RX"
+.LASF2064:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1540:
+	.string	"ACC "
+.LASF3587:
+	.string	"convertMotorToExternal"
+.LASF3116:
+	.string	"MAG_MODE"
+.LASF1164:
+	.string	"__DECL_SIMD_asinhf"
+.LASF3424:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_11"
+.LASF3037:
+	.string	"mspPostProcessFnPtr"
+.LASF3371:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_20"
+.LASF972:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2164:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2945:
+	.string	"options"
+.LASF2726:
+	.string	"__int8_t"
+.LASF3004:
+	.string	"pidProfileIndex"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2977:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF2658:
+	.string	"MSP_SET_ACC_TRIM 239"
+.LASF2728:
+	.string	"__int16_t"
+.LASF2902:
+	.string	"OWNER_COMPASS_CS"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF3659:
+	.string	"boardAlignment"
+.LASF3277:
+	.string	"rcFrameStatusFn"
+.LASF2442:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF2824:
+	.string	"mpuConfiguration"
+.LASF3413:
+	.string	"VOLTAGE_METER_ID_ESC_COMBINED_10"
+.LASF2355:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF3503:
+	.string	"gyro_soft_notch_hz_2"
+.LASF1833:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2671:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2276:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2195:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2851:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF3312:
+	.string	"SENSOR_GYRO"
+.LASF1751:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2499:
+	.string	"FLIGHT_CONTROLLER_IDENTIFIER_LENGTH 4"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1361:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF985:
+	.string	"__DECL_SIMD_log1p "
+.LASF2686:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF3109:
+	.string	"OK_TO_ARM"
+.LASF3601:
+	.string	"mspFcProcessCommand"
+.LASF2494:
+	.string	"BASEFLIGHT_IDENTIFIER \"BAFL\";"
+.LASF2205:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1788:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF843:
+	.string	"__DECL_SIMD_expf64x "
+.LASF3594:
+	.string	"getTaskDeltaTime"
+.LASF2790:
+	.string	"setpointRelaxRatio"
+.LASF1647:
+	.string	"FC_VERSION_MINOR 2"
+.LASF2986:
+	.string	"FEATURE_3D"
+.LASF1319:
+	.string	"FP_INFINITE 1"
+.LASF1213:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF1615:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2964:
+	.string	"setMode"
+.LASF1226:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF1483:
+	.string	"TELEMETRY_IBUS "
+.LASF1450:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF3248:
+	.string	"halfDuplex"
+.LASF1704:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1637:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1144:
+	.string	"__DECL_SIMD_log1pf"
+.LASF3343:
+	.string	"barometerConfig_System"
+.LASF1044:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1262:
+	.string	"_Mdouble_ _Float64"
+.LASF3275:
+	.string	"rxRefreshRate"
+.LASF1769:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1879:
+	.string	"I2C_DEFAULT_TIMEOUT I2C_SHORT_TIMEOUT"
+.LASF1544:
+	.string	"MAG "
+.LASF2800:
+	.string	"ioTag_t"
+.LASF2512:
+	.string	"CAP_NAVCAP ((uint32_t)1 << 4)"
+.LASF3101:
+	.string	"armingConfig_t"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF829:
+	.string	"__DECL_SIMD_logf32 "
+.LASF2793:
+	.string	"rateAccelLimit"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2738:
+	.string	"uint8_t"
+.LASF1386:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF1474:
+	.string	"TELEMETRY_FRSKY "
+.LASF2441:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF1183:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1290:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF2617:
+	.string	"MSP_DATAFLASH_LOG_LIST 136"
+.LASF2030:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1953:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF2857:
+	.string	"accDev_t"
+.LASF1601:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF3592:
+	.string	"getCurrentPidProfileIndex"
+.LASF1079:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF2801:
+	.string	"IO_t"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1480:
+	.string	"GPS "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF3672:
+	.string	"accelerometerConfig"
+.LASF3525:
+	.string	"frsky_vfas_cell_voltage"
+.LASF1193:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2597:
+	.string	"MSP_PID 112"
+.LASF3110:
+	.string	"PREVENT_ARMING"
+.LASF1339:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF2526:
+	.string	"MSP_SET_FEATURE_CONFIG 37"
+.LASF1458:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF3453:
+	.string	"voltageMeterIds"
+.LASF1133:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF2575:
+	.string	"MSP_ADVANCED_CONFIG 90"
+.LASF2712:
+	.string	"SONAR_GPIO GPIOB"
+.LASF3439:
+	.string	"VOLTAGE_SENSOR_TYPE_ADC_RESISTOR_DIVIDER"
+.LASF1870:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF400:
+	.string	"bool _Bool"
+.LASF2619:
+	.string	"MSP_SETTING_INFO 138"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2908:
+	.string	"PWM_TYPE_ONESHOT42"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF3093:
+	.string	"neutral3d"
+.LASF2000:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2628:
+	.string	"MSP_MAG_CALIBRATION 206"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1598:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF2865:
+	.string	"OWNER_ADC_BATT"
+.LASF2802:
+	.string	"ALIGN_DEFAULT"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhl "
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1059:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF819:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF3033:
+	.string	"streamLength"
+.LASF2021:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1768:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1635:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2742:
+	.string	"float"
+.LASF3542:
+	.string	"cliSettingSetValue"
+.LASF3301:
+	.string	"TASK_TELEMETRY"
+.LASF1702:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2136:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2808:
+	.string	"CW90_DEG_FLIP"
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF3408:
+	.string	"VOLTAGE_METER_ID_9V_10"
+.LASF2704:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF2721:
+	.string	"unsigned char"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2394:
+	.string	"FAT_VOLUME_ID_SIGNATURE_2 0xAA"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF1303:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF3130:
+	.string	"FIXED_WING"
+.LASF2773:
+	.string	"PID_ITEM_COUNT"
+.LASF1807:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF2332:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1630:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF2089:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF3630:
+	.string	"mspFcTaskHistogramCommand"
+.LASF1952:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF3566:
+	.string	"cliSettingFind"
+.LASF3434:
+	.string	"voltageMeterSource_e"
+.LASF2799:
+	.string	"pidConfig_System"
+.LASF1273:
+	.string	"__MATHDECL"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF970:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1863:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1004:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2952:
+	.string	"rxBufferTail"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1365:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF2007:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2557:
+	.string	"MSP_DATAFLASH_SUMMARY 70"
+.LASF1980:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1844:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2922:
+	.string	"ioTags"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF2319:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF1828:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF2043:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1975:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF3667:
+	.string	"currentSensorADCConfigMutable"
+.LASF1120:
+	.string	"__DECL_SIMD_expm1f"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF3013:
+	.string	"rcYawRate8"
+.LASF2226:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF764:
+	.string	"__need_size_t "
+.LASF3415:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_2"
+.LASF3416:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_3"
+.LASF3417:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_4"
+.LASF3418:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_5"
+.LASF3419:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_6"
+.LASF3420:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_7"
+.LASF3421:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_8"
+.LASF3422:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_9"
+.LASF2401:
+	.string	"FAT_FILE_ATTRIBUTE_HIDDEN 0x02"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF2261:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2345:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF2667:
+	.string	"MSP_SERIAL_PROCESS_TIME_US 250"
+.LASF379:
+	.string	"linux 1"
+.LASF3514:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF2990:
+	.string	"FEATURE_LED_STRIP"
+.LASF2987:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF1624:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF3178:
+	.string	"motorConfig_s"
+.LASF3184:
+	.string	"motorConfig_t"
+.LASF2847:
+	.string	"ICM_20689_SPI"
+.LASF1020:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1675:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF2532:
+	.string	"MSP_SET_MIXER_CONFIG 43"
+.LASF3588:
+	.string	"pwmGetMotors"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1428:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF1157:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF1525:
+	.string	"_WCHAR_T_DECLARED "
+.LASF3678:
+	.string	"motorConfigMutable"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1463:
+	.string	"SERIAL_RX "
+.LASF3217:
+	.string	"SERIAL_PORT_UART5"
+.LASF2354:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF2886:
+	.string	"OWNER_BARO_CS"
+.LASF1715:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2105:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2480:
+	.string	"imC2 0"
+.LASF2387:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF3468:
+	.string	"BATTERY_OK"
+.LASF2144:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1855:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF3595:
+	.string	"sbufWriteU16"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1401:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF3627:
+	.string	"mspFcSchedulerTraceCommand"
+.LASF2482:
+	.string	"imATM_BLB 2"
+.LASF3605:
+	.string	"mspFcProcessPushCommand"
+.LASF3645:
+	.string	"activeBoxId"
+.LASF2978:
+	.string	"FEATURE_RX_SERIAL"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF3257:
+	.string	"midrc"
+.LASF2682:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2372:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF3205:
+	.string	"modeColorIndexes_t"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2901:
+	.string	"OWNER_VTX"
+.LASF1588:
+	.string	"USE_PROFILE "
+.LASF1887:
+	.string	"IOCFG_AF_PP 0"
+.LASF2299:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF3519:
+	.string	"telemetry_switch"
+.LASF848:
+	.string	"__DECL_SIMD_powf16 "
+.LASF3702:
+	.string	"reset"
+.LASF2407:
+	.string	"FAT_DELETED_FILE_MARKER 0xE5"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF1617:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2114:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF2958:
+	.string	"serialWrite"
+.LASF2594:
+	.string	"MSP_ALTITUDE 109"
+.LASF3500:
+	.string	"gyro_to_use"
+.LASF3398:
+	.string	"currentMeterIds"
+.LASF2333:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1682:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2973:
+	.string	"type"
+.LASF1948:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF3081:
+	.string	"modeActivationConditions_SystemArray"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF855:
+	.string	"__DECL_SIMD_acos "
+.LASF3544:
+	.string	"featureSet"
+.LASF1840:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF2835:
+	.string	"gyroReadXRegister"
+.LASF1073:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF3639:
+	.string	"serializeSDCardSummaryReply"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2215:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1766:
+	.string	"PG_VCD_CONFIG 514"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2819:
+	.string	"acc_1G"
+.LASF1825:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2637:
+	.string	"MSP_SET_RC_DEADBAND 218"
+.LASF1896:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1567:
+	.string	"LED_STRIP"
+.LASF3690:
+	.string	"rcControlsConfigMutable"
+.LASF1336:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF873:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF3624:
+	.string	"nameLength"
+.LASF2948:
+	.string	"txBufferSize"
+.LASF3609:
+	.string	"adjRange"
+.LASF2484:
+	.string	"VTX_BAND_MIN 1"
+.LASF3406:
+	.string	"VOLTAGE_METER_ID_9V_1"
+.LASF3407:
+	.string	"VOLTAGE_METER_ID_9V_2"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1570:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1760:
+	.string	"PG_PWM_CONFIG 508"
+.LASF1865:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF1092:
+	.string	"__DECL_SIMD_acosf"
+.LASF1231:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF2101:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2216:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1882:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF2429:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF2681:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF1252:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2998:
+	.string	"FEATURE_VTX"
+.LASF2501:
+	.string	"FLIGHT_CONTROLLER_VERSION_MASK 0xFFF"
+.LASF2163:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1497:
+	.string	"_STDDEF_H "
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1713:
+	.string	"PG_SERVO_MIXER 21"
+.LASF3671:
+	.string	"accelerometerConfigMutable"
+.LASF3463:
+	.string	"useConsumptionAlerts"
+.LASF1443:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF2471:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF2898:
+	.string	"OWNER_INVERTER"
+.LASF3597:
+	.string	"sbufWriteU8"
+.LASF2445:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF2889:
+	.string	"OWNER_RX_SPI_CS"
+.LASF2560:
+	.string	"MSP_FAILSAFE_CONFIG 75"
+.LASF2817:
+	.string	"init"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2073:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1190:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF3269:
+	.string	"rx_max_usec"
+.LASF1614:
+	.string	"UNIT_TESTED "
+.LASF1801:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF796:
+	.string	"__DECL_SIMD_cosf "
+.LASF930:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF3617:
+	.string	"info"
+.LASF1362:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF2413:
+	.string	"GIMBAL_MODE_MAX (GIMBAL_MODE_MIXTILT)"
+.LASF1266:
+	.string	"_Mdouble_ _Float32x"
+.LASF1113:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF1938:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF3583:
+	.string	"getAmperage"
+.LASF1947:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF3638:
+	.string	"serializeDataflashSummaryReply"
+.LASF1244:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF2920:
+	.string	"useUnsyncedPwm"
+.LASF1545:
+	.string	"USE_FAKE_MAG "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1322:
+	.string	"FP_NORMAL 4"
+.LASF3444:
+	.string	"VOLTAGE_SENSOR_ADC_5V"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF3196:
+	.string	"INPUT_RC_AUX1"
+.LASF1402:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF1922:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF3199:
+	.string	"INPUT_RC_AUX4"
+.LASF3451:
+	.string	"voltageMeterADCtoIDMap"
+.LASF1186:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF3059:
+	.string	"BOXSONAR"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1153:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1257:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1705:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF2732:
+	.string	"__uint32_t"
+.LASF2897:
+	.string	"OWNER_RX_BIND"
+.LASF2190:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF3606:
+	.string	"value"
+.LASF3666:
+	.string	"currentSensorVirtualConfig"
+.LASF1250:
+	.string	"__MATH_PRECNAME"
+.LASF2814:
+	.string	"busDevice_t"
+.LASF1448:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1147:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF2781:
+	.string	"pidSumLimit"
+.LASF2877:
+	.string	"OWNER_SPI_MISO"
+.LASF1982:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1299:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1437:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF3487:
+	.string	"interruptTag"
+.LASF3038:
+	.string	"BOXARM"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1845:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF3295:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF2500:
+	.string	"FLIGHT_CONTROLLER_VERSION_LENGTH 3"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF2539:
+	.string	"MSP_RSSI_CONFIG 50"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF3306:
+	.string	"cfTaskId_e"
+.LASF915:
+	.string	"__DECL_SIMD_cosh "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1733:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2415:
+	.string	"LON 1"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1927:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1260:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF3534:
+	.string	"boxId"
+.LASF1330:
+	.string	"MATH_ERREXCEPT 2"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF3546:
+	.string	"featureClearAll"
+.LASF1440:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF3550:
+	.string	"gyroInitFilters"
+.LASF1521:
+	.string	"_WCHAR_T_H "
+.LASF3673:
+	.string	"rxConfigMutable"
+.LASF2614:
+	.string	"MSP_COMPASS_CONFIG 133"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1978:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2761:
+	.string	"sbuf_s"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2234:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF3161:
+	.string	"MIXER_AIRPLANE"
+.LASF2540:
+	.string	"MSP_SET_RSSI_CONFIG 51"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1121:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1378:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF1723:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1116:
+	.string	"__DECL_SIMD_coshf"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1278:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2304:
+	.string	"ESCSERIAL_BUFFER_SIZE 1024"
+.LASF2859:
+	.string	"OWNER_PWMINPUT"
+.LASF2041:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF868:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2632:
+	.string	"MSP_SET_HEADING 211"
+.LASF1105:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF3266:
+	.string	"max_aux_channel"
+.LASF2935:
+	.string	"SERIAL_UNIDIR"
+.LASF992:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1182:
+	.string	"__HAVE_FLOAT16 0"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1430:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF2461:
+	.string	"LED_XY_MASK 0x0F"
+.LASF2545:
+	.string	"MSP_VOLTAGE_METER_CONFIG 56"
+.LASF2421:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF3142:
+	.string	"roll"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2131:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1356:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1820:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF883:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF3619:
+	.string	"count"
+.LASF3381:
+	.string	"currentMeter_s"
+.LASF3385:
+	.string	"currentMeter_t"
+.LASF2495:
+	.string	"BETAFLIGHT_IDENTIFIER \"BTFL\""
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1599:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1911:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF2341:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF3235:
+	.string	"reboot_character"
+.LASF2825:
+	.string	"sensorAccReadFuncPtr"
+.LASF1469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF3640:
+	.string	"packFlightModeFlags"
+.LASF1573:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF3338:
+	.string	"baro_sample_count"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1410:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF3072:
+	.string	"channelRange_s"
+.LASF3075:
+	.string	"channelRange_t"
+.LASF1420:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF2636:
+	.string	"MSP_SET_MOTOR_3D_CONFIG 217"
+.LASF3443:
+	.string	"VOLTAGE_SENSOR_ADC_9V"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF849:
+	.string	"__DECL_SIMD_powf32 "
+.LASF3212:
+	.string	"SERIAL_PORT_NONE"
+.LASF1363:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF2766:
+	.string	"PIDALT"
+.LASF1775:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF3299:
+	.string	"TASK_BARO"
+.LASF3090:
+	.string	"flight3DConfig_s"
+.LASF3095:
+	.string	"flight3DConfig_t"
+.LASF3697:
+	.string	"pidConfig"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1212:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1485:
+	.string	"TELEMETRY_MAVLINK "
+.LASF2949:
+	.string	"rxBuffer"
+.LASF3028:
+	.string	"mspResult_e"
+.LASF2091:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3689:
+	.string	"flight3DConfig"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF3518:
+	.string	"gpsNoFixLongitude"
+.LASF2758:
+	.string	"test"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF3188:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF2424:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF3291:
+	.string	"TASK_ATTITUDE"
+.LASF1821:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF1150:
+	.string	"__DECL_SIMD_acosh"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF3139:
+	.string	"failsafe_procedure"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF3192:
+	.string	"INPUT_RC_ROLL"
+.LASF3554:
+	.string	"convertExternalToMotor"
+.LASF3185:
+	.string	"motorConfig_System"
+.LASF2984:
+	.string	"FEATURE_SONAR"
+.LASF3016:
+	.string	"thrExpo8"
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF3300:
+	.string	"TASK_ALTITUDE"
+.LASF797:
+	.string	"__DECL_SIMD_cosl "
+.LASF3124:
+	.string	"FAILSAFE_MODE"
+.LASF1652:
+	.string	"MW_VERSION 231"
+.LASF2322:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1370:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF3211:
+	.string	"specialColors"
+.LASF3180:
+	.string	"minthrottle"
+.LASF1914:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF3374:
+	.string	"currentMeterId_e"
+.LASF2585:
+	.string	"MSP_DISPLAYPORT 182"
+.LASF2916:
+	.string	"motorDevConfig_s"
+.LASF2923:
+	.string	"motorDevConfig_t"
+.LASF3144:
+	.string	"values"
+.LASF2176:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF3571:
+	.string	"cliSettingCount"
+.LASF2437:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF3156:
+	.string	"MIXER_Y4"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF3153:
+	.string	"MIXER_Y6"
+.LASF2487:
+	.string	"VTX_CHANNEL_MAX 8"
+.LASF1578:
+	.string	"VTX_COMMON"
+.LASF2698:
+	.string	"SCHEDULER_HISTOGRAM_BUCKETS 16"
+.LASF3501:
+	.string	"gyro_soft_notch_hz_1"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1964:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF2910:
+	.string	"PWM_TYPE_BRUSHED"
+.LASF1064:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1242:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF942:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1491:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF3586:
+	.string	"altitudeHoldGetEstimatedAltitude"
+.LASF1098:
+	.string	"__DECL_SIMD_asin"
+.LASF1499:
+	.string	"_ANSI_STDDEF_H "
+.LASF3108:
+	.string	"adjustmentRanges_SystemArray"
+.LASF1022:
+	.string	"__DECL_SIMD_erff32x "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF3472:
+	.string	"batteryState_e"
+.LASF824:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF2342:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF2589:
+	.string	"MSP_MOTOR 104"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF3484:
+	.string	"mag_declination"
+.LASF3431:
+	.string	"VOLTAGE_METER_NONE"
+.LASF1604:
+	.string	"EEPROM_SIZE 32768"
+.LASF1662:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF3307:
+	.string	"averageSystemLoadPercent"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF3440:
+	.string	"VOLTAGE_SENSOR_TYPE_ESC"
+.LASF3580:
+	.string	"getBatteryState"
+.LASF1836:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF1306:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF3502:
+	.string	"gyro_soft_notch_cutoff_1"
+.LASF3113:
+	.string	"armingFlags"
+.LASF2006:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2385:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF2227:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1444:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF3311:
+	.string	"flightDynamicsTrims_t"
+.LASF3310:
+	.string	"flightDynamicsTrims_u"
+.LASF2810:
+	.string	"CW270_DEG_FLIP"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF2213:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1661:
+	.string	"HSV_HUE_MAX 359"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1194:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF3380:
+	.string	"currentMeterSource_e"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2780:
+	.string	"itermWindupPointPercent"
+.LASF3695:
+	.string	"systemConfig"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF2719:
+	.string	"IS_ENABLED(mask) (mask == 0 ? 0 : 1)"
+.LASF3547:
+	.string	"readEEPROM"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1692:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1342:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1935:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF2996:
+	.string	"FEATURE_AIRMODE"
+.LASF2536:
+	.string	"MSP_SET_LED_COLORS 47"
+.LASF1607:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF2384:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2620:
+	.string	"MSP_SETTING_VALUES 139"
+.LASF1913:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF3273:
+	.string	"rxRuntimeConfig_s"
+.LASF2903:
+	.string	"OWNER_CROS_EC"
+.LASF2104:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF803:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF926:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1272:
+	.string	"__MATHDECL_ALIAS"
+.LASF1494:
+	.string	"VTX_CONTROL "
+.LASF2048:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2795:
+	.string	"pidConfig_s"
+.LASF2798:
+	.string	"pidConfig_t"
+.LASF3558:
+	.string	"rxMspFrameReceive"
+.LASF2082:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1294:
+	.string	"_Marg_ _Float64"
+.LASF3065:
+	.string	"BOXAIRMODE"
+.LASF1346:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2214:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1456:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2664:
+	.string	"MSP_PORT_OUTBUF_SIZE 256"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1874:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1897:
+	.string	"EXPAND_I(x) x"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1651:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1858:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF2278:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2049:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1376:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF3254:
+	.string	"rssi_channel"
+.LASF1799:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1067:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1797:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF3232:
+	.string	"serialConfig_s"
+.LASF3236:
+	.string	"serialConfig_t"
+.LASF2960:
+	.string	"serialTotalTxFree"
+.LASF3143:
+	.string	"pitch"
+.LASF3289:
+	.string	"TASK_GYROPID"
+.LASF927:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1518:
+	.string	"_BSD_WCHAR_T_ "
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF3359:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_1"
+.LASF3360:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_2"
+.LASF3361:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_3"
+.LASF3362:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_4"
+.LASF3516:
+	.string	"telemetryConfig_s"
+.LASF3529:
+	.string	"telemetryConfig_t"
+.LASF3365:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_7"
+.LASF3366:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_8"
+.LASF3367:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_9"
+.LASF2813:
+	.string	"csnPin"
+.LASF2428:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF1753:
+	.string	"PG_OSD_CONFIG 501"
+.LASF3078:
+	.string	"auxChannelIndex"
+.LASF1605:
+	.string	"__disable_irq() "
+.LASF1254:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF1960:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF2976:
+	.string	"FEATURE_RX_PPM"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF2752:
+	.string	"FD_ROLL"
+.LASF3509:
+	.string	"gyroConfig_System"
+.LASF2968:
+	.string	"readBuf"
+.LASF2071:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF2599:
+	.string	"MSP_PIDNAMES 117"
+.LASF2204:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF3376:
+	.string	"CURRENT_METER_ADC"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF3442:
+	.string	"VOLTAGE_SENSOR_ADC_12V"
+.LASF869:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1122:
+	.string	"__DECL_SIMD_sinh"
+.LASF1353:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2912:
+	.string	"forceOverflow"
+.LASF2004:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3283:
+	.string	"startedAt"
+.LASF844:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1343:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1479:
+	.string	"USE_SERVOS "
+.LASF3263:
+	.string	"rcSmoothingFilterType"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF3209:
+	.string	"colors"
+.LASF3324:
+	.string	"rollAndPitchTrims_s"
+.LASF3327:
+	.string	"rollAndPitchTrims_t"
+.LASF3326:
+	.string	"rollAndPitchTrims_u"
+.LASF2002:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1551:
+	.string	"USE_UART6 "
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF897:
+	.string	"__DECL_SIMD_exp2l "
+.LASF954:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF941:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1498:
+	.string	"_STDDEF_H_ "
+.LASF1621:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2113:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1021:
+	.string	"__DECL_SIMD_erff128 "
+.LASF2749:
+	.string	"shortGitRevision"
+.LASF2370:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF2087:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2787:
+	.string	"levelSensitivity"
+.LASF3593:
+	.string	"sbufWriteU32"
+.LASF1519:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2142:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1318:
+	.string	"FP_NAN 0"
+.LASF3498:
+	.string	"gyro_isr_update"
+.LASF2452:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF3634:
+	.string	"nameLen"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2277:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1315:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1395:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF1885:
+	.string	"IOCFG_OUT_PP 0"
+.LASF847:
+	.string	"__DECL_SIMD_powl "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF2146:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1860:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF3264:
+	.string	"rcSmoothingCutoffHz"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2765:
+	.string	"PIDYAW"
+.LASF2643:
+	.string	"MSP_SET_COMPASS_CONFIG 224"
+.LASF3446:
+	.string	"vbatscale"
+.LASF2044:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF881:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1827:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF939:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF3249:
+	.string	"rx_spi_protocol"
+.LASF3397:
+	.string	"supportedCurrentMeterCount"
+.LASF1811:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2386:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF3204:
+	.string	"color"
+.LASF1756:
+	.string	"PG_PID_CONFIG 504"
+.LASF3399:
+	.string	"VOLTAGE_METER_ID_NONE"
+.LASF1091:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF2486:
+	.string	"VTX_CHANNEL_MIN 1"
+.LASF3250:
+	.string	"rx_spi_id"
+.LASF3389:
+	.string	"currentSensorADCConfig_s"
+.LASF3392:
+	.string	"currentSensorADCConfig_t"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1974:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF1334:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF2103:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF3328:
+	.string	"accelerometerConfig_s"
+.LASF3334:
+	.string	"accelerometerConfig_t"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1993:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1366:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF3319:
+	.string	"acc_s"
+.LASF3323:
+	.string	"acc_t"
+.LASF2729:
+	.string	"short int"
+.LASF1274:
+	.string	"__MATHCALL"
+.LASF3025:
+	.string	"MSP_RESULT_ACK"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF3404:
+	.string	"VOLTAGE_METER_ID_5V_2"
+.LASF1600:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF966:
+	.string	"__DECL_SIMD_log10f "
+.LASF3194:
+	.string	"INPUT_RC_YAW"
+.LASF1375:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF2083:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1293:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF3177:
+	.string	"mixerConfig_System"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF3244:
+	.string	"rxConfig_s"
+.LASF3270:
+	.string	"rxConfig_t"
+.LASF2222:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1288:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF3147:
+	.string	"mixerMode"
+.LASF3573:
+	.string	"sbufBytesRemaining"
+.LASF910:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1584:
+	.string	"USE_SERVOS"
+.LASF3123:
+	.string	"SONAR_MODE"
+.LASF3618:
+	.string	"mspFcSettingFindCommand"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1929:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF2823:
+	.string	"mpuDetectionResult"
+.LASF1892:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2570:
+	.string	"MSP_SET_OSD_CONFIG 85"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1403:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF2666:
+	.string	"MSP_PORT_MAX_HEADER_SIZE 8"
+.LASF1560:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1933:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2159:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1837:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2231:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2601:
+	.string	"MSP_BOXIDS 119"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF3471:
+	.string	"BATTERY_NOT_PRESENT"
+.LASF1636:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2477:
+	.string	"ESC_OUTPUT setEscOutput(selected_esc)"
+.LASF1345:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2172:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2630:
+	.string	"MSP_SET_WP 209"
+.LASF1580:
+	.string	"VTX_SMARTAUDIO"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF956:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1301:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF3507:
+	.string	"gyro_dyn_notch_min_hz"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1626:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF2489:
+	.string	"MSP_PROTOCOL_VERSION 0"
+.LASF1712:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF3677:
+	.string	"serialConfig"
+.LASF1930:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1103:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF2474:
+	.string	"ESC_SET_HI setEscHi(selected_esc)"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1065:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF2358:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1449:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1642:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2549:
+	.string	"MSP_SET_PID_CONTROLLER 60"
+.LASF3394:
+	.string	"currentSensorVirtualConfig_s"
+.LASF3395:
+	.string	"currentSensorVirtualConfig_t"
+.LASF1201:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF836:
+	.string	"__DECL_SIMD_expf "
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2943:
+	.string	"identifier"
+.LASF1085:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF2392:
+	.string	"MBR_PARTITION_TYPE_FAT16_LBA 0x0E"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1679:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF1986:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF1075:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF3208:
+	.string	"inputSource_e"
+.LASF1422:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2130:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2219:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF3002:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2544:
+	.string	"MSP_SET_CF_SERIAL_CONFIG 55"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1594:
+	.string	"USED_TIMERS 0"
+.LASF2223:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1699:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1442:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF393:
+	.string	"SITL 1"
+.LASF2707:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF3237:
+	.string	"serialConfig_System"
+.LASF1198:
+	.string	"__f64x(x) x ##f64x"
+.LASF2675:
+	.string	"PWM_PULSE_MIN 750"
+.LASF3553:
+	.string	"getMotorCount"
+.LASF1658:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF1603:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF2946:
+	.string	"baudRate"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1516:
+	.string	"__WCHAR_T "
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF3057:
+	.string	"BOXTELEMETRY"
+.LASF3604:
+	.string	"cmdMSP"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF2330:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1460:
+	.string	"USE_CLI "
+.LASF3050:
+	.string	"BOXBEEPERON"
+.LASF3330:
+	.string	"acc_align"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1894:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF2992:
+	.string	"FEATURE_OSD"
+.LASF1421:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2733:
+	.string	"long int"
+.LASF3490:
+	.string	"compassConfig_System"
+.LASF1188:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1239:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF3532:
+	.string	"boardIdentifier"
+.LASF1962:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF2838:
+	.string	"MPU_3050"
+.LASF3357:
+	.string	"CURRENT_METER_ID_ESC_COMBINED_1"
+.LASF3648:
+	.string	"boxIndex"
+.LASF2807:
+	.string	"CW0_DEG_FLIP"
+.LASF2870:
+	.string	"OWNER_SERIAL_RX"
+.LASF2904:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF2731:
+	.string	"__int32_t"
+.LASF2274:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF3094:
+	.string	"deadband3d_throttle"
+.LASF3010:
+	.string	"currentPidProfile"
+.LASF1976:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF875:
+	.string	"__DECL_SIMD_asin "
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1489:
+	.string	"USE_MSP_PUSH "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF2297:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF2328:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF2854:
+	.string	"sensor"
+.LASF2554:
+	.string	"MSP_BF_CONFIG 66"
+.LASF2994:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2233:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2890:
+	.string	"OWNER_SPI_CS"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1181:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF3224:
+	.string	"serialPortIdentifier_e"
+.LASF2778:
+	.string	"dterm_notch_hz"
+.LASF1446:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF2622:
+	.string	"MSP_MOTOR_TELEMETRY 141"
+.LASF1237:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF3372:
+	.string	"CURRENT_METER_ID_VIRTUAL_1"
+.LASF3496:
+	.string	"gyro_soft_lpf_type"
+.LASF3614:
+	.string	"mspFcProcessInCommand"
+.LASF1328:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF3506:
+	.string	"gyro_dyn_notch_q"
+.LASF2563:
+	.string	"MSP_SET_RXFAIL_CONFIG 78"
+.LASF1100:
+	.string	"__DECL_SIMD_asinf"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1162:
+	.string	"__DECL_SIMD_asinh"
+.LASF1006:
+	.string	"__DECL_SIMD_acoshf "
+.LASF2306:
+	.string	"DP_5G_MASK 0x7000"
+.LASF3351:
+	.string	"CURRENT_METER_ID_9V_1"
+.LASF3226:
+	.string	"functionMask"
+.LASF1419:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1512:
+	.string	"__WCHAR_T__ "
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1734:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF3488:
+	.string	"magZero"
+.LASF3661:
+	.string	"batteryConfig"
+.LASF3377:
+	.string	"CURRENT_METER_VIRTUAL"
+.LASF2257:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF3314:
+	.string	"SENSOR_BARO"
+.LASF3126:
+	.string	"GPS_FIX_HOME"
+.LASF2102:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1271:
+	.string	"__MATHDECL_1"
+.LASF3070:
+	.string	"boxId_e"
+.LASF1107:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2938:
+	.string	"SERIAL_BIDIR_PP"
+.LASF2931:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2932:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1574:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2869:
+	.string	"OWNER_SERIAL_TX"
+.LASF1790:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF1631:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1757:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF2298:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF812:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1619:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF3015:
+	.string	"thrMid8"
+.LASF3034:
+	.string	"streamFn"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF2018:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF3643:
+	.string	"initActiveBoxIds"
+.LASF3121:
+	.string	"UNUSED_MODE"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF3569:
+	.string	"cliSettingGetInfo"
+.LASF2694:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1415:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1681:
+	.string	"Q12 (1 << 12)"
+.LASF1746:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1335:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF2971:
+	.string	"cliSettingInfo_s"
+.LASF2975:
+	.string	"cliSettingInfo_t"
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF3698:
+	.string	"constrain"
+.LASF1951:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1087:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF979:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF401:
+	.string	"true 1"
+.LASF2929:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2792:
+	.string	"yawRateAccelLimit"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF2058:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2039:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF3473:
+	.string	"boardAlignment_s"
+.LASF3477:
+	.string	"boardAlignment_t"
+.LASF2149:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF957:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1949:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1822:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF2025:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1184:
+	.string	"__HAVE_FLOAT64 1"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1326:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1321:
+	.string	"FP_SUBNORMAL 3"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2060:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF2129:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1200:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF3387:
+	.string	"CURRENT_SENSOR_ADC"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF3556:
+	.string	"useRcControlsConfig"
+.LASF794:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF3682:
+	.string	"failsafeConfigMutable"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1400:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF837:
+	.string	"__DECL_SIMD_expl "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2470:
+	.string	"OSD_POSCFG_MAX (VISIBLE_FLAG|0x3FF)"
+.LASF1972:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2197:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2736:
+	.string	"int16_t"
+.LASF2273:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2187:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2954:
+	.string	"txBufferTail"
+.LASF2380:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF3284:
+	.string	"executionTime"
+.LASF2320:
+	.string	"BEEP_ON do {} while(0)"
+.LASF864:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1791:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1606:
+	.string	"__enable_irq() "
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF2521:
+	.string	"MSP_BATTERY_CONFIG 32"
+.LASF2396:
+	.string	"FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2"
+.LASF810:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1950:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF2518:
+	.string	"MSP_BUILD_INFO 5"
+.LASF2612:
+	.string	"MSP_MOTOR_CONFIG 131"
+.LASF2641:
+	.string	"MSP_SET_MOTOR_CONFIG 222"
+.LASF1789:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1893:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF3191:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF2915:
+	.string	"pwmOutputPort_t"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1005:
+	.string	"__DECL_SIMD_acosh "
+.LASF1810:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1289:
+	.string	"_Mret_ double"
+.LASF3435:
+	.string	"voltageMeter_s"
+.LASF3438:
+	.string	"voltageMeter_t"
+.LASF2853:
+	.string	"mpuDetectionResult_s"
+.LASF1118:
+	.string	"__DECL_SIMD_expm1"
+.LASF2488:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF2014:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2876:
+	.string	"OWNER_SPI_SCK"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2035:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF3222:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF3223:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1851:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF2343:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2957:
+	.string	"serialPortVTable"
+.LASF3332:
+	.string	"accZero"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2856:
+	.string	"mpuDetectionResult_t"
+.LASF800:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF3268:
+	.string	"rx_min_usec"
+.LASF1248:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1261:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2125:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1368:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF2672:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1795:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF867:
+	.string	"__DECL_SIMD_atanl "
+.LASF1453:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1438:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF1431:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF2678:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1265:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF3132:
+	.string	"vario"
+.LASF1940:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2335:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1496:
+	.string	"VTX_TRAMP "
+.LASF2608:
+	.string	"MSP_LED_STRIP_MODECOLOR 127"
+.LASF1558:
+	.string	"SERIAL_RX"
+.LASF765:
+	.string	"__need_NULL "
+.LASF1207:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF3104:
+	.string	"adjustmentFunction"
+.LASF1196:
+	.string	"__f64(x) x ##f64"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1478:
+	.string	"USE_RESOURCE_MGMT "
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3411:
+	.string	"VOLTAGE_METER_ID_12V_10"
+.LASF1535:
+	.string	"U_ID_1 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF811:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF2391:
+	.string	"MBR_PARTITION_TYPE_FAT32_LBA 0x0C"
+.LASF2458:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF3674:
+	.string	"rxConfig"
+.LASF2505:
+	.string	"CAP_BASEFLIGHT_CONFIG ((uint32_t)1 << 30)"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF2629:
+	.string	"MSP_RESET_CONF 208"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF2056:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1007:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1669:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF1758:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1111:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1622:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF1467:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF967:
+	.string	"__DECL_SIMD_log10l "
+.LASF1707:
+	.string	"PG_PID_PROFILE 14"
+.LASF2684:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1687:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF2610:
+	.string	"MSP_CURRENT_METERS 129"
+.LASF1426:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF3665:
+	.string	"currentSensorVirtualConfigMutable"
+.LASF3686:
+	.string	"armingConfigMutable"
+.LASF2513:
+	.string	"CAP_EXTAUX ((uint32_t)1 << 5)"
+.LASF1488:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2930:
+	.string	"SERIAL_INVERTED"
+.LASF3085:
+	.string	"alt_hold_deadband"
+.LASF3589:
+	.string	"gyroRateDps"
+.LASF834:
+	.string	"__DECL_SIMD_logf128x "
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1035:
+	.string	"__DECL_SIMD_asinh "
+.LASF3245:
+	.string	"rcmap"
+.LASF2147:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF3691:
+	.string	"rcControlsConfig"
+.LASF3280:
+	.string	"rcFrameTimeUsFnPtr"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2431:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF3073:
+	.string	"startStep"
+.LASF1777:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF2098:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1089:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF3325:
+	.string	"rollAndPitchTrims_t_def"
+.LASF2425:
+	.string	"LED_MODE_COUNT 6"
+.LASF2361:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF2584:
+	.string	"MSP_SET_OSD_VIDEO_CONFIG 181"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF2669:
+	.string	"MSP_PUSH_MAX_RATE_HZ 200"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF3663:
+	.string	"_index"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF945:
+	.string	"__DECL_SIMD_cbrt "
+.LASF3317:
+	.string	"SENSOR_GPS"
+.LASF2776:
+	.string	"dterm_lpf_hz"
+.LASF1320:
+	.string	"FP_ZERO 2"
+.LASF1706:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF3197:
+	.string	"INPUT_RC_AUX2"
+.LASF3198:
+	.string	"INPUT_RC_AUX3"
+.LASF3391:
+	.string	"offset"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1476:
+	.string	"TELEMETRY_LTM "
+.LASF2339:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF3653:
+	.string	"telemetryConfig"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF3460:
+	.string	"currentMeterSource"
+.LASF2555:
+	.string	"MSP_SET_BF_CONFIG 67"
+.LASF3535:
+	.string	"boxName"
+.LASF2108:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF2311:
+	.string	"PA_BS_MASK 0x0007"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1128:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF3352:
+	.string	"CURRENT_METER_ID_9V_2"
+.LASF2258:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF2001:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3179:
+	.string	"digitalIdleOffsetPercent"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF2121:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2376:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1417:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF3649:
+	.string	"candidate"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2022:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3508:
+	.string	"gyroConfig_t"
+.LASF2844:
+	.string	"ICM_20601_SPI"
+.LASF2154:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF3660:
+	.string	"batteryConfigMutable"
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1018:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1014:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF3629:
+	.string	"entries"
+.LASF3612:
+	.string	"remainingPortsInPacket"
+.LASF3234:
+	.string	"serial_update_rate_hz"
+.LASF3246:
+	.string	"serialrx_provider"
+.LASF2443:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2543:
+	.string	"MSP_CF_SERIAL_CONFIG 54"
+.LASF2173:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1936:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2725:
+	.string	"signed char"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF3448:
+	.string	"vbatresdivmultiplier"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF3526:
+	.string	"hottAlarmSoundInterval"
+.LASF3623:
+	.string	"mspFcSettingInfoCommand"
+.LASF1407:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF3296:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1634:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1214:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF1916:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1813:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF3193:
+	.string	"INPUT_RC_PITCH"
+.LASF1062:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF2924:
+	.string	"MODE_RX"
+.LASF3568:
+	.string	"sbufPtr"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF3039:
+	.string	"BOXANGLE"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1831:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF2831:
+	.string	"writeFn"
+.LASF994:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF3316:
+	.string	"SENSOR_SONAR"
+.LASF1762:
+	.string	"PG_ADC_CONFIG 510"
+.LASF1388:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF3445:
+	.string	"voltageSensorADCConfig_s"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1358:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1126:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2366:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF2490:
+	.string	"API_VERSION_MAJOR 1"
+.LASF2418:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF1861:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF2587:
+	.string	"MSP_RAW_IMU 102"
+.LASF872:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2907:
+	.string	"PWM_TYPE_ONESHOT125"
+.LASF2224:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1285:
+	.string	"_Marg_"
+.LASF3186:
+	.string	"motor"
+.LASF862:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1846:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF1159:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2496:
+	.string	"CLEANFLIGHT_IDENTIFIER \"CLFL\""
+.LASF2768:
+	.string	"PIDPOSR"
+.LASF3512:
+	.string	"frskyGpsCoordFormat_e"
+.LASF2467:
+	.string	"VISIBLE_FLAG 0x0800"
+.LASF1805:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF3493:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF2639:
+	.string	"MSP_SET_SENSOR_ALIGNMENT 220"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF2789:
+	.string	"itermAcceleratorGain"
+.LASF1697:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1070:
+	.string	"__DECL_SIMD_sin"
+.LASF1197:
+	.string	"__f32x(x) x ##f32x"
+.LASF2533:
+	.string	"MSP_RX_CONFIG 44"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF2708:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1942:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2248:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1283:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF2925:
+	.string	"MODE_TX"
+.LASF2432:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF2735:
+	.string	"int8_t"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2081:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1739:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF3012:
+	.string	"rcRate8"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1587:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF2983:
+	.string	"FEATURE_FAILSAFE"
+.LASF2895:
+	.string	"OWNER_BEEPER"
+.LASF3243:
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+.LASF2169:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1611:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF936:
+	.string	"__DECL_SIMD_sinhf "
+.LASF3340:
+	.string	"baro_cf_vel"
+.LASF2275:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF3242:
+	.string	"rxFailsafeChannelConfig_t"
+.LASF3099:
+	.string	"disarm_kill_switch"
+.LASF2519:
+	.string	"MSP_NAME 10"
+.LASF3030:
+	.string	"mspPacket_s"
+.LASF2145:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1533:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF3329:
+	.string	"acc_lpf_hz"
+.LASF2706:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF1656:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF2701:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1312:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF2067:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2100:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2435:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF1752:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF3664:
+	.string	"voltageSensorADCConfig"
+.LASF3429:
+	.string	"VOLTAGE_METER_ID_CELL_40"
+.LASF1961:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1566:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF3233:
+	.string	"portConfigs"
+.LASF2879:
+	.string	"OWNER_I2C_SCL"
+.LASF2077:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF2770:
+	.string	"PIDLEVEL"
+.LASF1241:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF2661:
+	.string	"MSP_SET_4WAY_IF 245"
+.LASF1898:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF928:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2472:
+	.string	"ESC_IS_HI isEscHi(selected_esc)"
+.LASF1296:
+	.string	"_Marg_ _Float64x"
+.LASF2338:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1804:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1228:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF3055:
+	.string	"BOXGOV"
+.LASF2739:
+	.string	"uint16_t"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF3621:
+	.string	"returned"
+.LASF1575:
+	.string	"TELEMETRY_IBUS"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF3238:
+	.string	"rssi"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1748:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1187:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1648:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF3423:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_10"
+.LASF1620:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF2427:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF1215:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF2483:
+	.string	"imSK 3"
+.LASF2436:
+	.string	"LED_POS_BITCNT 8"
+.LASF2188:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF3035:
+	.string	"streamContext"
+.LASF877:
+	.string	"__DECL_SIMD_asinl "
+.LASF3557:
+	.string	"pidInitConfig"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2833:
+	.string	"verifywriteFn"
+.LASF2906:
+	.string	"PWM_TYPE_STANDARD"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2092:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF2805:
+	.string	"CW180_DEG"
+.LASF2351:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 15"
+.LASF2767:
+	.string	"PIDPOS"
+.LASF3644:
+	.string	"serializeBoxNamesReply"
+.LASF1235:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2696:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1230:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF3454:
+	.string	"batteryConfig_s"
+.LASF3466:
+	.string	"batteryConfig_t"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1389:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF1281:
+	.string	"_Mret_ float"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF2652:
+	.string	"MSP_RESERVE_3 255"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF886:
+	.string	"__DECL_SIMD_hypotf "
+.LASF2880:
+	.string	"OWNER_I2C_SDA"
+.LASF1372:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF3426:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_20"
+.LASF2989:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1269:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1582:
+	.string	"BLACKBOX"
+.LASF3510:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF1504:
+	.string	"_PTRDIFF_T_ "
+.LASF1392:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF1987:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2003:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF1482:
+	.string	"TELEMETRY_CRSF "
+.LASF2422:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2287:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF2740:
+	.string	"uint32_t"
+.LASF2868:
+	.string	"OWNER_ADC_RSSI"
+.LASF3068:
+	.string	"BOXBLACKBOXERASE"
+.LASF3430:
+	.string	"voltageMeterId_e"
+.LASF1204:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF958:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF3087:
+	.string	"yaw_control_reversed"
+.LASF2327:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF963:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1764:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF995:
+	.string	"__DECL_SIMD_atanh "
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF835:
+	.string	"__DECL_SIMD_exp "
+.LASF2878:
+	.string	"OWNER_SPI_MOSI"
+.LASF1309:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1310:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1311:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF2918:
+	.string	"motorPwmProtocol"
+.LASF3461:
+	.string	"batteryCapacity"
+.LASF1349:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3540:
+	.string	"activeBoxIdCount"
+.LASF1592:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF2803:
+	.string	"CW0_DEG"
+.LASF2045:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1019:
+	.string	"__DECL_SIMD_erff32 "
+.LASF3021:
+	.string	"ratesType"
+.LASF1149:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF2751:
+	.string	"buildTime"
+.LASF2347:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2511:
+	.string	"CAP_FLAPS ((uint32_t)1 << 3)"
+.LASF2613:
+	.string	"MSP_GPS_CONFIG 132"
+.LASF1024:
+	.string	"__DECL_SIMD_erff128x "
+.LASF816:
+	.string	"__DECL_SIMD_sincosf "
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF3304:
+	.string	"TASK_NONE"
+.LASF2241:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1957:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF2063:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1148:
+	.string	"__DECL_SIMD_atanhf"
+.LASF1735:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF3131:
+	.string	"stateFlags"
+.LASF2068:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2811:
+	.string	"sensor_align_e"
+.LASF2716:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF3017:
+	.string	"rates"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF2561:
+	.string	"MSP_SET_FAILSAFE_CONFIG 76"
+.LASF943:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2508:
+	.string	"CAP_NAVI_VERSION_BIT_2 ((uint32_t)1 << 29)"
+.LASF1561:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1211:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1589:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1023:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2118:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1238:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1763:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF3026:
+	.string	"MSP_RESULT_ERROR"
+.LASF3679:
+	.string	"motorConfig"
+.LASF1958:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1180:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF3481:
+	.string	"magneticDeclination"
+.LASF2846:
+	.string	"ICM_20608_SPI"
+.LASF1999:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF3393:
+	.string	"currentSensorADCConfig_System"
+.LASF1465:
+	.string	"USE_SERIALRX_IBUS "
+.LASF3427:
+	.string	"VOLTAGE_METER_ID_CELL_1"
+.LASF1045:
+	.string	"__DECL_SIMD_erfc "
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF937:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2710:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF2602:
+	.string	"MSP_SERVO_CONFIGURATIONS 120"
+.LASF2567:
+	.string	"MSP_TRANSPONDER_CONFIG 82"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF3051:
+	.string	"BOXLEDMAX"
+.LASF1659:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1396:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF3007:
+	.string	"task_statistics"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF2816:
+	.string	"accDev_s"
+.LASF1685:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF3164:
+	.string	"MIXER_VTAIL4"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF3441:
+	.string	"VOLTAGE_SENSOR_ADC_VBAT"
+.LASF1683:
+	.string	"EEPROM_CONF_VERSION 159"
+.LASF1872:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1695:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF3029:
+	.string	"mspStreamFnPtr"
+.LASF1990:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2410:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE 128"
+.LASF923:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF3656:
+	.string	"compassConfigMutable"
+.LASF2127:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1119:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1168:
+	.string	"__DECL_SIMD_erfcf"
+.LASF2887:
+	.string	"OWNER_MPU_CS"
+.LASF2110:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF2398:
+	.string	"FAT12_MAX_CLUSTERS 4084"
+.LASF2379:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_THROTTLE"
+.LASF3356:
+	.string	"CURRENT_METER_ID_12V_10"
+.LASF3071:
+	.string	"rcModeActivationMask"
+.LASF1676:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF3061:
+	.string	"BOXSERVO2"
+.LASF1099:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF2353:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2368:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF3579:
+	.string	"voltageMeterRead"
+.LASF1522:
+	.string	"___int_wchar_t_h "
+.LASF2515:
+	.string	"MSP_FC_VARIANT 2"
+.LASF2842:
+	.string	"MPU_65xx_SPI"
+.LASF2246:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF2220:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF880:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2955:
+	.string	"rxCallback"
+.LASF1743:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1680:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2981:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1798:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2402:
+	.string	"FAT_FILE_ATTRIBUTE_SYSTEM 0x04"
+.LASF2657:
+	.string	"MSP_ACC_TRIM 240"
+.LASF2734:
+	.string	"char"
+.LASF2314:
+	.string	"BANDS_NUMBER 5"
+.LASF1719:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2830:
+	.string	"readFn"
+.LASF2864:
+	.string	"OWNER_ADC"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF2547:
+	.string	"MSP_SONAR_ALTITUDE 58"
+.LASF1596:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1243:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1650:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2026:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1513:
+	.string	"_WCHAR_T "
+.LASF2676:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF1649:
+	.string	"STR_HELPER(x) #x"
+.LASF2883:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1256:
+	.string	"_Mdouble_ long double"
+.LASF1878:
+	.string	"I2C_LONG_TIMEOUT ((uint32_t)(10 * I2C_SHORT_TIMEOUT))"
+.LASF3083:
+	.string	"deadband"
+.LASF1394:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF3076:
+	.string	"modeActivationCondition_s"
+.LASF3080:
+	.string	"modeActivationCondition_t"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF860:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF887:
+	.string	"__DECL_SIMD_hypotl "
+.LASF3043:
+	.string	"BOXHEADFREE"
+.LASF1090:
+	.string	"__DECL_SIMD_acos"
+.LASF2905:
+	.string	"timCCR_t"
+.LASF1054:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1689:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF1824:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF1016:
+	.string	"__DECL_SIMD_erff "
+.LASF929:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF3495:
+	.string	"gyro_lpf"
+.LASF2603:
+	.string	"MSP_NAV_STATUS 121"
+.LASF1258:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1409:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2296:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF3662:
+	.string	"voltageSensorADCConfigMutable"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2033:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF3373:
+	.string	"CURRENT_METER_ID_VIRTUAL_2"
+.LASF3023:
+	.string	"currentControlRateProfile"
+.LASF1724:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF3585:
+	.string	"getBatteryVoltage"
+.LASF3148:
+	.string	"MIXER_TRI"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1360:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF2031:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2961:
+	.string	"serialRead"
+.LASF3358:
+	.string	"CURRENT_METER_ID_ESC_COMBINED_10"
+.LASF2426:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF2123:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF1633:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2212:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF1628:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2993:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF3298:
+	.string	"TASK_COMPASS"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF1528:
+	.string	"__need_wchar_t"
+.LASF3386:
+	.string	"CURRENT_SENSOR_VIRTUAL"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF3265:
+	.string	"fpvCamAngleDegrees"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF2346:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF2611:
+	.string	"MSP_BATTERY_STATE 130"
+.LASF2066:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF3344:
+	.string	"CURRENT_METER_ID_NONE"
+.LASF1405:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF3089:
+	.string	"rcControlsConfig_System"
+.LASF3539:
+	.string	"activeBoxIds"
+.LASF817:
+	.string	"__DECL_SIMD_sincosl "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF3216:
+	.string	"SERIAL_PORT_UART4"
+.LASF1618:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1408:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF925:
+	.string	"__DECL_SIMD_expm1 "
+.LASF3335:
+	.string	"accelerometerConfig_System"
+.LASF2239:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1939:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF3655:
+	.string	"gyroConfig"
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF2718:
+	.string	"RATEPROFILE_MASK (1 << 7)"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1502:
+	.string	"_T_PTRDIFF "
+.LASF3694:
+	.string	"systemConfigMutable"
+.LASF3348:
+	.string	"CURRENT_METER_ID_5V_1"
+.LASF3349:
+	.string	"CURRENT_METER_ID_5V_2"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1747:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1944:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1373:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF3267:
+	.string	"airModeActivateThreshold"
+.LASF3285:
+	.string	"lateness"
+.LASF1156:
+	.string	"__DECL_SIMD_erff"
+.LASF3003:
+	.string	"systemConfig_s"
+.LASF3008:
+	.string	"systemConfig_t"
+.LASF959:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2717:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF2783:
+	.string	"dterm_average_count"
+.LASF2517:
+	.string	"MSP_BOARD_INFO 4"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF2337:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF3646:
+	.string	"findBoxByPermenantId"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2029:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF3167:
+	.string	"MIXER_DUALCOPTER"
+.LASF1097:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF2282:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2133:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1216:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1654:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF2577:
+	.string	"MSP_FILTER_CONFIG 92"
+.LASF1171:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2046:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2820:
+	.string	"ADCRaw"
+.LASF1971:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF3135:
+	.string	"failsafe_off_delay"
+.LASF499:
+	.string	"__PMT"
+.LASF1668:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF974:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2653:
+	.string	"MSP_STATUS_EX 150"
+.LASF1602:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2552:
+	.string	"MSP_RX_MAP 64"
+.LASF2160:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2381:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF3128:
+	.string	"CALIBRATE_MAG"
+.LASF2152:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF2406:
+	.string	"FAT_FILENAME_LENGTH 11"
+.LASF3294:
+	.string	"TASK_DISPATCH"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF2478:
+	.string	"USE_SERIAL_4WAY_BLHELI_BOOTLOADER "
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF3432:
+	.string	"VOLTAGE_METER_ADC"
+.LASF2668:
+	.string	"MSP_PUSH_MAX_COMMANDS 8"
+.LASF1406:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF2863:
+	.string	"OWNER_LED"
+.LASF3608:
+	.string	"frame"
+.LASF3200:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF1543:
+	.string	"USE_FAKE_BARO "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1331:
+	.string	"math_errhandling 0"
+.LASF1838:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF1934:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2028:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF2397:
+	.string	"FAT_MAXIMUM_FILESIZE 0xFFFFFFFF"
+.LASF840:
+	.string	"__DECL_SIMD_expf64 "
+.LASF2184:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1612:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF3019:
+	.string	"rcYawExpo8"
+.LASF2655:
+	.string	"MSP_GPSSVINFO 164"
+.LASF2390:
+	.string	"MBR_PARTITION_TYPE_FAT32 0x0B"
+.LASF3079:
+	.string	"range"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF2640:
+	.string	"MSP_SET_LED_STRIP_MODECOLOR 221"
+.LASF3474:
+	.string	"rollDegrees"
+.LASF1537:
+	.string	"LED0_PIN NONE"
+.LASF1616:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1324:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF3452:
+	.string	"supportedVoltageMeterCount"
+.LASF1134:
+	.string	"__DECL_SIMD_log10"
+.LASF2944:
+	.string	"mode"
+.LASF3339:
+	.string	"baro_noise_lpf"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2586:
+	.string	"MSP_STATUS 101"
+.LASF3382:
+	.string	"amperage"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF2796:
+	.string	"pid_process_denom"
+.LASF2403:
+	.string	"FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08"
+.LASF1435:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF1973:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1208:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF3505:
+	.string	"gyro_dyn_notch"
+.LASF1151:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1998:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1382:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF1539:
+	.string	"USE_FAKE_GYRO "
+.LASF2921:
+	.string	"useDshotTelemetry"
+.LASF2635:
+	.string	"MSP_SET_NAV_CONFIG 215"
+.LASF1565:
+	.string	"USE_SERIALRX_XBUS"
+.LASF2769:
+	.string	"PIDNAVR"
+.LASF3515:
+	.string	"frskyUnit_e"
+.LASF3218:
+	.string	"SERIAL_PORT_USART6"
+.LASF3219:
+	.string	"SERIAL_PORT_USART7"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1063:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1068:
+	.string	"__DECL_SIMD_cosf"
+.LASF1114:
+	.string	"__DECL_SIMD_cosh"
+.LASF2019:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2828:
+	.string	"mpuResetFnPtr"
+.LASF3006:
+	.string	"debug_mode"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1741:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1744:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF2300:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF1142:
+	.string	"__DECL_SIMD_log1p"
+.LASF3603:
+	.string	"mspPostProcessFn"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1291:
+	.string	"_Mret_ _Float32"
+.LASF1919:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2235:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2389:
+	.string	"MBR_PARTITION_TYPE_FAT16 0x06"
+.LASF1781:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF3315:
+	.string	"SENSOR_MAG"
+.LASF2531:
+	.string	"MSP_MIXER_CONFIG 42"
+.LASF1664:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF3574:
+	.string	"systemReset"
+.LASF1017:
+	.string	"__DECL_SIMD_erfl "
+.LASF2015:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF965:
+	.string	"__DECL_SIMD_log10 "
+.LASF3082:
+	.string	"rcControlsConfig_s"
+.LASF1784:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF3620:
+	.string	"countPtr"
+.LASF3602:
+	.string	"reply"
+.LASF2845:
+	.string	"ICM_20602_SPI"
+.LASF1873:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF3483:
+	.string	"compassConfig_s"
+.LASF3171:
+	.string	"MIXER_CUSTOM_AIRPLANE"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f"
+.LASF976:
+	.string	"__DECL_SIMD_log2f "
+.LASF1841:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1506:
+	.string	"___int_ptrdiff_t_h "
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1581:
+	.string	"VTX_TRAMP"
+.LASF1671:
+	.string	"VERY_FAST_MATH "
+.LASF908:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF3631:
+	.string	"latenessHistogram"
+.LASF1711:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2571:
+	.string	"MSP_OSD_CHAR_READ 86"
+.LASF3494:
+	.string	"gyro_sync_denom"
+.LASF2510:
+	.string	"CAP_DYNBALANCE ((uint32_t)1 << 2)"
+.LASF1653:
+	.string	"GIT_SHORT_REVISION_LENGTH 7"
+.LASF2156:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1102:
+	.string	"__DECL_SIMD_hypot"
+.LASF2405:
+	.string	"FAT_FILE_ATTRIBUTE_ARCHIVE 0x20"
+.LASF3533:
+	.string	"box_e"
+.LASF1136:
+	.string	"__DECL_SIMD_log10f"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2076:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1224:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2423:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF1095:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF3537:
+	.string	"box_t"
+.LASF2626:
+	.string	"MSP_SET_RC_TUNING 204"
+.LASF1792:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF2882:
+	.string	"OWNER_SDCARD_CS"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF2439:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF1390:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF2569:
+	.string	"MSP_OSD_CONFIG 84"
+.LASF3305:
+	.string	"TASK_SELF"
+.LASF1643:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF906:
+	.string	"__DECL_SIMD_exp10f "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF3378:
+	.string	"CURRENT_METER_ESC"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF2469:
+	.string	"OSD_POS_MAX 0x3FF"
+.LASF1562:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF2680:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2057:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF3383:
+	.string	"amperageLatest"
+.LASF1526:
+	.string	"__DEFINED_wchar_t "
+.LASF2464:
+	.string	"LO(name) LED_FLAG_OVERLAY(LED_OVERLAY_ ## name)"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1608:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1471:
+	.string	"BLACKBOX "
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2088:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2843:
+	.string	"MPU_9250_SPI"
+.LASF1969:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2318:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF1304:
+	.string	"_Mret_ _Float64"
+.LASF1481:
+	.string	"CMS "
+.LASF1959:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF1773:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1325:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF2580:
+	.string	"MSP_SET_PID_ADVANCED 95"
+.LASF2896:
+	.string	"OWNER_OSD"
+.LASF1556:
+	.string	"USE_PPM"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2329:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1514:
+	.string	"_T_WCHAR_ "
+.LASF3582:
+	.string	"featureMask"
+.LASF2812:
+	.string	"deviceSpi_s"
+.LASF2272:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2303:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1117:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF2893:
+	.string	"OWNER_USB"
+.LASF2247:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6ef8c27\""
+.LASF3485:
+	.string	"mag_align"
+.LASF2785:
+	.string	"pidAtMinThrottle"
+.LASF1814:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2832:
+	.string	"slowreadFn"
+.LASF1509:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF2412:
+	.string	"FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64"
+.LASF2665:
+	.string	"MSP_PORT_STREAM_LIMIT 0xffff"
+.LASF1823:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF920:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF783:
+	.string	"__size_t "
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF3262:
+	.string	"rcInterpolationInterval"
+.LASF1189:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2646:
+	.string	"MSP_SET_PUSH_SUBSCRIPTION 227"
+.LASF1726:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF2011:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF813:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1787:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2885:
+	.string	"OWNER_FLASH"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF3401:
+	.string	"VOLTAGE_METER_ID_BATTERY_2"
+.LASF1413:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF1731:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF3524:
+	.string	"frsky_vfas_precision"
+.LASF1657:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF3598:
+	.string	"sensors"
+.LASF1445:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF3642:
+	.string	"mspFcInit"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1613:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2979:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2075:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF3103:
+	.string	"adjustmentRange_s"
+.LASF1337:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1667:
+	.string	"sq(x) ((x)*(x))"
+.LASF1554:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF3203:
+	.string	"modeColorIndexes_s"
+.LASF2754:
+	.string	"FD_YAW"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2542:
+	.string	"MSP_SET_ADJUSTMENT_RANGE 53"
+.LASF2502:
+	.string	"BOARD_IDENTIFIER_LENGTH 4"
+.LASF935:
+	.string	"__DECL_SIMD_sinh "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2788:
+	.string	"itermThrottleThreshold"
+.LASF3290:
+	.string	"TASK_ACCEL"
+.LASF1985:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2737:
+	.string	"int32_t"
+.LASF2138:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1307:
+	.string	"_Mret_ _Float64x"
+.LASF2053:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2349:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF1666:
+	.string	"HUFFMAN_MAX_CODE_LEN 12"
+.LASF1853:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF3182:
+	.string	"mincommand"
+.LASF3297:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF3097:
+	.string	"armingConfig_s"
+.LASF1329:
+	.string	"MATH_ERRNO 1"
+.LASF2371:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF3555:
+	.string	"generateRcCurves"
+.LASF2170:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF3241:
+	.string	"step"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF2027:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF3251:
+	.string	"rx_spi_rf_channel_count"
+.LASF2911:
+	.string	"PWM_TYPE_MAX"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF890:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2097:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF3309:
+	.string	"flightDynamicsTrims_def_t"
+.LASF2434:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF1717:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1124:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF2206:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1222:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2625:
+	.string	"MSP_SET_PID 202"
+.LASF1135:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2595:
+	.string	"MSP_ANALOG 110"
+.LASF3046:
+	.string	"BOXCAMTRIG"
+.LASF2072:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF2191:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF3154:
+	.string	"MIXER_HEX6"
+.LASF1808:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF3563:
+	.string	"getTaskExecutionHistogram"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2909:
+	.string	"PWM_TYPE_MULTISHOT"
+.LASF2321:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF2821:
+	.string	"revisionCode"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF3155:
+	.string	"MIXER_FLYING_WING"
+.LASF3159:
+	.string	"MIXER_OCTOFLATP"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1629:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF3160:
+	.string	"MIXER_OCTOFLATX"
+.LASF2607:
+	.string	"MSP_SENSOR_ALIGNMENT 126"
+.LASF2633:
+	.string	"MSP_SET_SERVO_CONFIGURATION 212"
+.LASF2723:
+	.string	"unsigned int"
+.LASF2221:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1688:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF1542:
+	.string	"BARO "
+.LASF1981:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1245:
+	.string	"_Mdouble_ double"
+.LASF2134:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2211:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF2203:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1891:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF3011:
+	.string	"controlRateConfig_s"
+.LASF3022:
+	.string	"controlRateConfig_t"
+.LASF3538:
+	.string	"boxes"
+.LASF1901:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3836:
+	.string	"rx_pwm.h"
+.LASF3744:
+	.string	"pwm_output.h"
+.LASF3813:
+	.string	"blackbox.h"
+.LASF3801:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3724:
+	.string	"/usr/include"
+.LASF3807:
+	.string	"mathcalls-helper-functions.h"
+.LASF3774:
+	.string	"fc_msp.c"
+.LASF3805:
+	.string	"fp-logb.h"
+.LASF3803:
+	.string	"floatn-common.h"
+.LASF3783:
+	.string	"stdint.h"
+.LASF3838:
+	.string	"fc_msp.h"
+.LASF3704:
+	.string	"src/main/build"
+.LASF3721:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3764:
+	.string	"barometer.h"
+.LASF3782:
+	.string	"stdbool.h"
+.LASF3824:
+	.string	"flash.h"
+.LASF3809:
+	.string	"iscanonical.h"
+.LASF3731:
+	.string	"time.h"
+.LASF3787:
+	.string	"wordsize.h"
+.LASF3735:
+	.string	"color.h"
+.LASF3839:
+	.string	"navigation.h"
+.LASF3716:
+	.string	"src/main/target/SITL"
+.LASF3778:
+	.string	"mathcalls.h"
+.LASF3848:
+	.string	"serial_4way.h"
+.LASF3845:
+	.string	"gps.h"
+.LASF3749:
+	.string	"fc_core.h"
+.LASF3837:
+	.string	"sound_beeper.h"
+.LASF3781:
+	.string	"stdc-predef.h"
+.LASF3812:
+	.string	"common_post.h"
+.LASF3770:
+	.string	"boardalignment.h"
+.LASF3820:
+	.string	"parameter_group_ids.h"
+.LASF3733:
+	.string	"version.h"
+.LASF3784:
+	.string	"libc-header-start.h"
+.LASF3755:
+	.string	"failsafe.h"
+.LASF3810:
+	.string	"platform.h"
+.LASF3725:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3850:
+	.string	"transponder_ir.h"
+.LASF3767:
+	.string	"voltage_ids.h"
+.LASF3854:
+	.string	"filter.h"
+.LASF3790:
+	.string	"long-double.h"
+.LASF3742:
+	.string	"resource.h"
+.LASF3840:
+	.string	"asyncfatfs.h"
+.LASF3758:
+	.string	"servos.h"
+.LASF3709:
+	.string	"src/main/flight"
+.LASF3756:
+	.string	"imu.h"
+.LASF3817:
+	.string	"huffman.h"
+.LASF3710:
+	.string	"src/main/io/asyncfatfs"
+.LASF3732:
+	.string	"debug.h"
+.LASF3828:
+	.string	"io_def_generated.h"
+.LASF3746:
+	.string	"cli.h"
+.LASF3740:
+	.string	"accgyro.h"
+.LASF3752:
+	.string	"rc_adjustments.h"
+.LASF3799:
+	.string	"math.h"
+.LASF3720:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3821:
+	.string	"exti.h"
+.LASF3826:
+	.string	"io_def.h"
+.LASF3712:
+	.string	"src/main/msp"
+.LASF3834:
+	.string	"vtx_soft_spi_rtc6705.h"
+.LASF3785:
+	.string	"features.h"
+.LASF3719:
+	.string	"src/main"
+.LASF3711:
+	.string	"src/main/io"
+.LASF3794:
+	.string	"time64.h"
+.LASF3819:
+	.string	"config_profile.h"
+.LASF3754:
+	.string	"altitudehold.h"
+.LASF3736:
+	.string	"streambuf.h"
+.LASF3786:
+	.string	"features-time64.h"
+.LASF3798:
+	.string	"strings.h"
+.LASF3771:
+	.string	"compass.h"
+.LASF3842:
+	.string	"beeper.h"
+.LASF3753:
+	.string	"runtime_config.h"
+.LASF3747:
+	.string	"config.h"
+.LASF3791:
+	.string	"stubs.h"
+.LASF3772:
+	.string	"gyro.h"
+.LASF3779:
+	.string	"string.h"
+.LASF3730:
+	.string	"target.h"
+.LASF3773:
+	.string	"telemetry.h"
+.LASF3852:
+	.string	"msp_protocol.h"
+.LASF3780:
+	.string	"maths.h"
+.LASF3708:
+	.string	"src/main/fc"
+.LASF3795:
+	.string	"wchar.h"
+.LASF3788:
+	.string	"timesize.h"
+.LASF3705:
+	.string	"src/main/common"
+.LASF3829:
+	.string	"max7456.h"
+.LASF3768:
+	.string	"voltage.h"
+.LASF3760:
+	.string	"rx.h"
+.LASF3766:
+	.string	"current.h"
+.LASF3723:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3823:
+	.string	"rcc_types.h"
+.LASF3849:
+	.string	"serial_4way_impl.h"
+.LASF3851:
+	.string	"vtx.h"
+.LASF3831:
+	.string	"serial_escserial.h"
+.LASF3763:
+	.string	"acceleration.h"
+.LASF3729:
+	.string	"stddef.h"
+.LASF3806:
+	.string	"fp-fast.h"
+.LASF3765:
+	.string	"current_ids.h"
+.LASF3843:
+	.string	"flashfs.h"
+.LASF3802:
+	.string	"floatn.h"
+.LASF3822:
+	.string	"bus_i2c.h"
+.LASF3759:
+	.string	"ledstrip.h"
+.LASF3811:
+	.string	"common.h"
+.LASF3743:
+	.string	"timer.h"
+.LASF3792:
+	.string	"stubs-64.h"
+.LASF3830:
+	.string	"sdcard.h"
+.LASF3815:
+	.string	"parameter_group.h"
+.LASF3748:
+	.string	"controlrate_profile.h"
+.LASF3737:
+	.string	"pid.h"
+.LASF3714:
+	.string	"src/main/scheduler"
+.LASF3775:
+	.string	"feature.h"
+.LASF3833:
+	.string	"vtx_common.h"
+.LASF3757:
+	.string	"mixer.h"
+.LASF3762:
+	.string	"sensors.h"
+.LASF3832:
+	.string	"vcd.h"
+.LASF3741:
+	.string	"accgyro_mpu.h"
+.LASF3841:
+	.string	"fat_standard.h"
+.LASF3800:
+	.string	"math-vector.h"
+.LASF3825:
+	.string	"io.h"
+.LASF3728:
+	.string	"stdint-uintn.h"
+.LASF3761:
+	.string	"scheduler.h"
+.LASF3835:
+	.string	"adc.h"
+.LASF3776:
+	.string	"fc_rc.h"
+.LASF3751:
+	.string	"rc_controls.h"
+.LASF3769:
+	.string	"battery.h"
+.LASF3789:
+	.string	"cdefs.h"
+.LASF3804:
+	.string	"flt-eval-method.h"
+.LASF3713:
+	.string	"src/main/rx"
+.LASF3793:
+	.string	"typesizes.h"
+.LASF3703:
+	.string	"src/main/blackbox"
+.LASF3750:
+	.string	"msp.h"
+.LASF3853:
+	.string	"msp_serial.h"
+.LASF3739:
+	.string	"sensor.h"
+.LASF3856:
+	.string	"sonar_hcsr04.h"
+.LASF3796:
+	.string	"locale_t.h"
+.LASF3717:
+	.string	"src/main/target"
+.LASF3734:
+	.string	"axis.h"
+.LASF3777:
+	.string	"system.h"
+.LASF3707:
+	.string	"src/main/drivers"
+.LASF3797:
+	.string	"__locale_t.h"
+.LASF3745:
+	.string	"serial.h"
+.LASF3847:
+	.string	"osd.h"
+.LASF3827:
+	.string	"utils.h"
+.LASF3816:
+	.string	"build_config.h"
+.LASF3844:
+	.string	"gimbal.h"
+.LASF3715:
+	.string	"src/main/sensors"
+.LASF3727:
+	.string	"stdint-intn.h"
+.LASF3855:
+	.string	"sonar.h"
+.LASF3808:
+	.string	"mathcalls-narrow.h"
+.LASF3818:
+	.string	"config_eeprom.h"
+.LASF3846:
+	.string	"motors.h"
+.LASF3706:
+	.string	"src/main/config"
+.LASF3726:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3718:
+	.string	"src/main/telemetry"
+.LASF3814:
+	.string	"blackbox_fielddefs.h"
+.LASF0:
+	.string	"./src/main/fc/fc_msp.c"
+.LASF3738:
+	.string	"io_types.h"
+.LASF3722:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`f\006\225\024"
+	.string	"\026]cH\320\224i\032\003Hk\302\320!E\367YE\336\016i\256\202\021\004\024\212\260n\351+\246\001\001\224Q\204\001=\214\336\fr\265\020_Ph\005\270\037)\016<V\024ad6\300\323jA\335U\001v\274\330\310Z7\021\241DdT"
+	.string	"B"
+	.string	"R"
+	.string	"4\345"
+	.ascii	"?\200\353\250\353(\203\177\364\323\353\335m\277\364!\0315)\371"
+	.ascii	"8\"\327\031D\271\271mm\355\354\007\177\322s\264\343\264X\323"
+	.ascii	"\b\025N\274\375x\254\020R\352\026k\001\304G\211\363|$\231\261"
+	.ascii	"\264Q\327\317\t\244ecc\357;\365\020\3034\262\341v \002\357\313"
+	.ascii	"\2742G\200\260\017\036{w\360\3074X5\003\325\257\336W\327a\336"
+	.ascii	"a\256\013~Y\301t\227\023\274\273\374\252\027\3014\365\201\r\\"
+	.ascii	"\027\257\341\273\366\005Zn\231e\026\002\377\312+\357\200_e\025"
+	.ascii	"\001\177F0n\226\016!r\202Ii\263\266b!\302\205\315\216\303\207"
+	.ascii	"\351\254!'k\350&\204\351\365\203$'\353\223oW\324\020\r3Gkk\215"
+	.ascii	" \263\210\3063m\274\220\210\255[\213?\315\237\372\231\307wG\360"
+	.ascii	"\360\231\360\2470\376\342\254S\263\036gMx\t\001K]?'P\007\016"
+	.ascii	"\0334\354&\324\323\344\225\201\347\312\363\316\201&^\224@\201"
+	.ascii	"a?\222\221\224\342\302N\314g\331\007\224#7z \355xw\257\363\256"
+	.ascii	"c\241\302/\217\332\034\234\265\277y\257\327\2132\022A\212\f\345"
+	.ascii	"\220s!\226\230I8\345\345^\216]~\n\247\203(\200\210\250\30199"
+	.ascii	"R\201\202\244$\311\316\001\240\00244\223<\022 \3239\236\345\214"
+	.ascii	"t\242C2\2424\305E5\n\323\030`9\177)\307\344\271\001\305Mv\357"
+	.ascii	"\334\260\342l\244U\030\226\357}\312\037\013\230\334\337\320Z"
+	.ascii	"\270O\336\037\264u\372|\277\266x\217ZF\320Cv\177\225\377\026"
+	.ascii	"\355\377\250fH\263\311\3730\225\035\300\327'\352>\232\235\202"
+	.ascii	"\267\3510%6\023\322\352\031:'<e\323|\240\340T\315G\216\245\023"
+	.ascii	"\201\032\225I\334\232\304,J\214\376\370\306K\260\b\335ae%o1\276"
+	.ascii	"Y\006P\313z-\272u`\307\366\243z}\2664\314>\361!\2228#`\213\354"
+	.ascii	"\350\365\2413\260\245\351\324TGc\270\0305\034?\245!q\301S\356"
+	.ascii	"\n}\302\353\322R\322\310\215X\230\036\311\317\351^\005\330\222"
+	.ascii	"`T\0256N\353n8\217\276\312Y\367z]\236z\341\223\337\262\273\306"
+	.ascii	"x\246\227\003\233\313_\031D6-8\017"
+	.text
+	.section	.gnu.lto_.ipa_sra.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\035\021e\021"
+	.string	"b\212\031\034`\207\223\016\3770\f\303T\315,VU\340\177"
+	.string	""
+	.string	"X\037\333\366mr\004\273w\222\001s\316\340@]\201R\004\016\250\333T\225\264H\300\225\001E"
+	.ascii	"\312C\007UCb\234mi\224aDj\264pN\361Ee\235w\327\335?\356\372\356"
+	.ascii	"\265\373\357\356\215TU\3607\322mu^\222\227!\214d2\303$\324\226"
+	.ascii	"\030\342\020\200\371\2501ZJ2\354\031\320\002\031\242\332t\022"
+	.ascii	"\200\221h\212\"y\022\344\b1\210\030\202\2101DFD\002\021\021\021"
+	.ascii	"\021"
+	.string	"\031j:G\303\246\203#\273|\255K\265G\265\016\035\230\373\023i\241\240L\r \326k\304j\342TL\334(\245I\216\005\327\003\236\373\246\356\030\210?\240\307\353IR\361Q\322\356\303X~?\223\377\220\006\303\310G\263\306\350Ct.2\241\204\302{\370\241\206\371N\333\025s\307\250\372T\331\020CA0\232J\275\022\331\336\177\262k\026\005\342\212_rJl)\254\307\032\220\341\031\304\355\024J,o\363/c\216\3252\035\314v3\f\266!\236L\201\303\305\340\240\307\213u]u\242\251]\017\205t\317\210vn\313\013\315\260\210O\326\374\202b-,\276\2440B@\033\004\3068C0.\"\006|_}\225y\304\256\3027a\352]\355\245pV\212f\247DC\221-\007\203\377$}\be\264 \ns/\3669\026\245\315\367\325\005S\246\340\374\311}*\350\177\001\371\fW\246Z~\322+\243\253i\303\221\315:\254"
+	.ascii	"\031{ !p#\251\027V\310c=\032\216K\266\266\377\3423\335x\353e"
+	.ascii	"\342`\027\356\252\002\350\367\025n\261 @\321\347\231\331\231"
+	.ascii	"\030\217\263\372\222\220ka\2053\013mt\240\330e\326Z\350\037\241"
+	.ascii	"o\320\3736;/\305I\207[\255*\214\363\036mk\026%[\\\035\251Y\254"
+	.ascii	"To\314\232\324\237\340\024\350T\375\336)\021\241\334\r\315\354"
+	.ascii	"\255\214\331\b^N\262\342\203\211\216\300X\033\004\264\315\013"
+	.ascii	"\f\003~\320X\232\200\r\34257\032\250\330Yp\364\022\351\211\266"
+	.ascii	",Nq\321\240\325\245\370\001"
+	.text
+	.section	.gnu.lto_.inline.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\320\037\245="
+	.string	"\266|\323H\220XN:\300{\311c\327\240\353\223\330]Ik\016\312em\307\037\230\215oc\320;\313K\333\006\336\2056\265\033\221\bB\353\023\376\241\214k\026\001!\001\302\031\320T:\035\271\361\237D"
+	.string	"k\262N\304\262\222%m\023)S\266"
+	.string	"\263"
+	.string	"\332"
+	.string	"e\272\262\362Ob\253./\341\r\207\356\177\024(N\232\020\225\240\235\021\271\331O\007\016\0332\364X\220"
+	.ascii	"\201\247\301\216\002\024w\253$\213)\205\330\351\273\223K\334"
+	.ascii	"DJ\030\360f\354\3049O\310R\370'\177\303\362GAr]U\301\352i\342"
+	.ascii	"\026E2S\026\374\246\232<a\205\272\375jn\3374b\243\016\243\017"
+	.ascii	"~\372\\\324\355\277\b\336 \336!\033\304Mc\033\304L\373\363\277"
+	.ascii	"\373d\246\fb\247-\277HLe\324qEw\223\255\273u\016`\177\236\220"
+	.ascii	"\377\347\310\247\356\376\375I\244\260\273\005"
+	.string	"\274\344\263\217\273\273\313\177\211\305\272\201{\305\377.\261\220n\340\211?\201\243g\001L\334\2038\225\246\347\364Ysm\177\303\203\314\251\377\245\312_\211\334Q\006\205\265C\301W\277*/?\347\206j\326\335\365\032\266\232G\323\357\366\323Zk\255uw\3156\177\236\347y\242_\364i\363\311sN}=yq\270\232\351S\"\251\362[\202\331~\024\303p\347>W\023,#\007\f\256\003?\373'\3323\237\366\323-\"\273\2501\236!8w\223\340W\037\271F\246\006\266;\"\323\276\236l\361\374\354\376\231\373.T}\255\335]\304XT\322D\235g\036AFi9\323\2657\273\233\210\321n\340@s;\332\335=\222\206\221 \301\334\323\356>\3425\252\032\001\272\247[\206O\274\354\030q\325\213\251\265\235\263\0219\364\372\242\306\363\332\343/+gf\345M\363I\326\0166\235\226\342\352:\2605\203\b\030\320\256\213\264(\302"
+	.ascii	"g\356\231bU\304\234\024\270\331M\202\254b\022l\266R\376'x\214"
+	.ascii	"\027\326\327j\331\375[\204\342\204\tqI\022$Y\260\244]a\262\244"
+	.ascii	"\310\020\310\203\217\006\f\027&Dx\340\200\301\202\0048Jd\232"
+	.ascii	"\025\321\253\324\262\363\341f\331\2255\325h\355\021y<\036\317"
+	.ascii	"\240\251e\255\320!\177f\302\262(8\201\366\001n\305b\261\310$"
+	.ascii	"\260;\270\2235e\253\315\207m\374T\322\351\366E\322\271"
+	.string	"\207\177\200\026'\221\306\033jFP\322\212M\f\226\b\357\300\023\372\270\370B\rU\251B\t\331\217\3009\254\226YF\211\333\214.|\354\002\377\177\334\236 [\350<\341\231\342tN\377\276\237\201s\332\347\022\273\306<\036\217\307\262^(\004\357\256I\323\266C\334\204f\207\230i\205\n\252)r\203\373\024\246\034b\247\347\276Hd\361xlC\341\"\366\027\342E2\037\364\037\310\002\211\225\252E\262\206\013\217\024\033<\210j\236{\366\371m\264\323\335\335\335\335\335\306\361\204h\312\365<Q\024Ek}=\342\341\232\220-w\363\346\371\323\307\\m\325\006\241\327c\342O\252u\265\210<\003k!D\302\315\276y\032\221@\254&d\350Q\037\213\001Ac\263{j\3045\240\306\222\350\210jp\313K\f\034\231\341\0213\\\356(\230+\"j\001\202;\250\262;\313\030\032\032\222&I\2451\222\n\020\224EQ\230\204\322\371\022"
+	.string	"\3428\f\006q\030S\212\020c\b\021\021\221\021\021\221@\002\021I\322\244\003u\240"
+	.string	"\b?\021 t\362e\021/\002\257\032\344[\017\242\312\236aZ\373h\323>\344\007\330\345\371P\177\225\\Q\020z\346\025\303\243\242\323\r\0135}\314I\007\313\2609\243\276\336*\312\322n\270\212\254<f\017\316\301\3437`g\276\007j\177~\017\372\375\335\306m\356\n\336\004k6\036v\35544\373\177J\336\375"
+	.string	"\354\0073l\262\226\214?\002 H\366\246\212\307\336\352\313\317\036\233\304+\207\354\273\031\222\355\217\302?I\266;F\324\352*<\b\357\034Z6\214\006\027\2553\312\215]+KQ\240\227\313\215\013*&w\257j\377H\226\031U\222N\217\261\256\023W\366m:\3777\275\301\23013\224\345p\240q\037\304\254\265v\343k\022\214 \b\001\320\022FDaB"
+	.ascii	"z\220\030b\262\025\245j\203{\234\333\022I\020A\235\315\204\324"
+	.ascii	"L\t\252\207\021\004\027\364\026\252\202\345k\267\263?\205\346"
+	.ascii	")\355\"i\267\221\207\243P\003\256\304/\234\304\246+&\313Mw\202"
+	.ascii	"\013U\336\004!\351\006\336N@I\244"
+	.string	"\"^8\370a\\\264\250\333\365\304\253n\317k\203|\2013\313\304\364\214\323\025\300\tr~\362\025<\\\273eg\035\260\372\354R\320\210@!v\261\325\305\220\212\365\210\244+M\\k\022\356\240\273\250^[DcP\2212M\215\356B\300\250\365\2338\215\212E\356\350d\362\240\245\222\367E\362?JJI\201\033\206\334c\227d\216\261\264T\022,\2152>qS\3224\234H\256\261\021\336\204D~\244\022\272\321c\0017I\251A\373B\265A^\326\256\340\362%T\210l\336h\352\211\"\375h\322\033\245\275I\2567\261br\313\272\b\261\236\250\306\233?>\032\346I.\204'\253\255O\362pN\235\303\233#x@\3110\342[/\262\232\345h\256\315)\233\253\304\321\312\317\"wF\337o\246\261\266\300Q2\234G=\216\313\327\332\220\302\313A\221\002Tr9{%\231\302\235\036\n\324\030`d\230'\305\320E\"\030"
+	.string	"1G\234\356\234^\205\205\233Ttf\022\032\301\253\370\206\315S\336\347\340n\353Hv5(\006\201\304\335\363G\234\241\216}7iIfG\267\016\016`\364^\222\353\222o\331\224\207\023xD\274\205\205\b\023B\372\021Z\241\354\036\240A\003\325\"\361(\270\237KU\274\373\016i\331\322k\274\321\230\217\310\237\004\263\ft\305\247T>o\337\261\t\370\322\2171\243\376\340\201\235\003:\352>\f\204\201\r\251)|\n\335\324\035\353\265\b\377O\007\215\323KK\314\323V*\202\034^\273V\t\346\031\325\375-w\274\363\266\277V\272\032,_\033T\001\003\306Z\364\371\270\225Y\npz~Y\245"
+	.string	"\035\306A)!\376[\303>\025\355\253\235=tr\330\001u7\003\220D\3072\307q,\250\257\016\034\227\352\003\232\313\201C\201{,\250l%{E\364H[\365b\314\352\220\3624N-Z\t1V\004c1\204?C]\330\017\f\235H*e38\003aJ\236\234\202\204g;\230\314\222]\023\370\332}\024C\352\334\024\025\374\004[\346\021df=T\3300I\200\222"
+	.string	"\261\312!#~v\316\311#\215\211\235\270faY\363\237j\267\275\260K\221\311\2569\216\016}\036\005\353\341\235s\200\230\201\213\3752\317\322\307\264\305HM\005\031\277\356R\325\255Qw\3119\271\r\2158nh\035\264\230*\357]\376]0\207\355\337\370\257`\312#\030.\240\355o\272{t?d\272z9/J\217<\244\342\250\310\361\253\207\211\317\r\235"
+	.ascii	"\362=2n\\\377\001\271/\220\330\b\205\364\337\013z3&`J\222\314"
+	.ascii	"\245t\222W\214N(\324\243\033TL\275\004\233\232.\370#\016n0\300"
+	.ascii	"\350\302\223*\375\322\302'Y\375\222\245/=\261*\231\270\273\223"
+	.ascii	"\247\0324\301\255\003{a\311\007\270\022\216\214\\cY\302\001V"
+	.ascii	"\023\003&B\346\3645\230ex\235N\036OFmB\332\325d\027NV!\235}\016"
+	.ascii	"i\005\340_"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`'0\0350"
+	.string	"\006\344i@\020\261$\303\001\nP|\034\326\217K\376@j\301\251\307P\376\362\"@\021"
+	.string	""
+	.string	"`\r\343N\264d\204\025"
+	.string	""
+	.string	"\250\260Q\220\304\273\311\031h\264\265\035\377=9\356Z\265\265y\335\037I\333do\231dL"
+	.string	"R"
+	.string	"^"
+	.string	"\234\235\223\242f\311\365\224\373\2238N\342\372s\222]\234_\277\326F\233\220\351c\001\361\373\035\234\021\344\272\256\353\276\026\323\007\323W\225\265\374\214\232S\377\203\362\027&\337\302\341J\276\266\033\336n&\371Z\253\332\372\216\244"
+	.ascii	"\002 \013\200\004\213\3348\367\220\213E\216\213.\225Q\356\214"
+	.ascii	"?\257I\334\031\376\277%\273,\020\377a\016\177\363\211\343'\256"
+	.ascii	"7\3764\261\375\016\327\303\343\024\347\230\223\303_)-r\323\215"
+	.ascii	"E\256\273\274\206\373\376Ep\235\020J\340\rV\fn\201\326\f\213"
+	.ascii	"F\237\360\304\034\177\007m,\177\200\354\025\177\256\034\237\353"
+	.ascii	"\272UeU'\003\344s\017zUm\325\016\217\357\210dP\362W61I\361\207"
+	.ascii	"\251\354\241\265\366j\251\240$,b\r\004r\237\217+]\342\226\304"
+	.ascii	"\353\334\206\214\270=g\021\2173S\271;\237\260zXX-\332\264\341"
+	.ascii	"\236X_\270\206\2705\212*)\t\ti(\234\211\241Q0q\206\246j0\311"
+	.ascii	"\360\221j\344\243F\375\245\357\245o@\fYC\301\265\3520\241\320"
+	.ascii	"\344\271d\334\232:(s$RK\"\225\350\220H\013\256q\003\244X%k\207"
+	.ascii	"#\326l\230\315,q\212\210L\036\007\303B\301\\\005\231>\320\327"
+	.ascii	"\245\355\271\265<2\342H\362\223\240\037_\004\037\030X\374\361"
+	.ascii	"\211\0039\201\374\250\361\311\031\021I\222\202B\2419!\205\304"
+	.ascii	"8\351\240*\363\022@\3018\006#)\fd0\204\242(C\b2\204\020B\fR\206"
+	.ascii	"\314\214\214\b\225\246\305F@\220[_E\2331\034\030 \022R\r\t~C"
+	.ascii	"+\f_\3370\036\023\216\353D=\342\024\217\311\277\2157P\364\246"
+	.ascii	"\037q\262\313\027\215\372b\340"
+	.string	"B\243\021BY\212K\265(\224\210\262i\320\316#d\316\"~\346\236+\265\t\213\037\025P\273Qx\227\"\262\245\376\333\247\240\211\226\210z\202!\364\266\300\322de\201\205\226%\334v\330\361\tNX\312\236Z\257\\\301#R\022\300,\232\301\302\235\213\016\227I\021\345[\357\224\356\220<\205\006\213vf\347w\242]\n2-\270\336D\327\327h\356'\255. m\357q\366\332\020\341,p\2200p\325\264\374\372\211\023C\306\034\2144\207\255\343-\243z_\234,\366\214\310x\330\357i\322jj\b\273\257\020\373\247\304\215\214\241\024\343q^a\005'\004\204\361f1\355b;\327\271|\206\277\226\361\365)\023\035'\036\034\356\276\342t\354\213\32373\222\351\325F>\302^u\251g=\215\250\007DWz6\266\223\231\253\247\017\321\242\017M\352\354\341\202\202\313\334J\227C\027).\363\200\312(\202\240\"^C\262\230\237"
+	.string	"U\356\337\036,k\013\351\225\367E\242XK^\005\016\342xe|T"
+	.string	"\002\312b\244e\"\260'\344\006\006\b\305H\006\374\023\f\214\360J\220\271J\366<\001\220bU\244`GM\304\200&p\027\217\200t\307\006\244\020J\206)^\270;Jui\034\224\373\346\343\034u\306\342\346\343\030\027 gl\354\305\270/\244e\201>\320\023W@c5\"A<"
+	.ascii	"\214\032\026<\\\227\361*,\275\364\0170k*7\272\372\322]CL\034"
+	.ascii	"\265~&\302E\025\362\212^/\333\334\332\314rc|Q\377\366\205\304"
+	.ascii	"\235\216afh\263\204Y\350\3668\221\272{u\261\034\344J\036\332"
+	.ascii	"\306\021\325\177\371P[\243\341\253D\324\002\242\272<i?;\bKl\261"
+	.ascii	"\226\272U\333\344\352\226`\304\tU\275\322\312P\340)"
+	.string	"\370\024\302\276/\343\002\212I\315\343\276\267N\310\272|I\016xh\347\250]\n\336\241\337\037\252\243,\361u\331\237\3511\020\\%\360\020CR\"D)\206\023\202b\225C\377Y2\276%q\262\007gV\310\225\244\267\313\261\2051\tCQI\320\0010\301\002\331\266\371j\201\232\016\302P\367\276\212\303\316\302n\331fY\016\037\361\201i\232\367`\t\ncef&\330,\202\213\326=]\020\007A\333\275\373Y2\345\027J,\020.!\207L\305Q\337\253?\375/\016\001\326\354\360J\215\350\226\347<\254A\327\254 \021\037\373hq\357\357G\202c\254L\235X(X\0057%\016\231\326\260\001\203\036U\273\005\255\b\351\022\t7\200N\315r+V\246Q\307;\242\270\254\347\235\023\352S\006\270%Q\347\211\032'\334 q\217\324\003\272\300\351D\324\375s\036\205c\361\222\342W}\r\222\031\352\301,N\311\020\017\030e\213"
+	.string	"\222\023d\345\205\021MI\365%\313\330\\k\017\342\211\201\017*\366\013\034"
+	.string	"\022\257me\224\f\256Z\215h\216\0227}\362\374\b\036\305H\200\271zV\362\250\222\205+\320&\347\036M\321)\265\204\013\274N\362"
+	.ascii	"@v\306\001\303u\3638\021U\\\022\373XA\004<fS:\354\007\314 Q\370"
+	.ascii	"\230\223\004f\0035nY\f\275\212'\3457\\{IK\\\213\312\335\2152"
+	.ascii	"\267%\251\177\003d\\D\bX|D\032\271V\366\004\355\346\021-\354"
+	.ascii	"\330\307\206\301\226Wz\026 \037!\230\327(h!-\334K\371\006R\361"
+	.ascii	"/\216\354,=\324\177\002\240\212.6}\264\\\223\217;\021\215\260"
+	.ascii	"\371\222\342\307\305Kk\\hn\215\276b\003\017x\252\373\210:e\b"
+	.ascii	"d\245%\r\300\017\351\301:\257\375D\252\0259\020\nT\030P\005#"
+	.ascii	"\302\231%\343F\252\332&!\335\200o\327\035\244Z\027\276\025\245"
+	.ascii	"d8r\200\362W6cX\fBrD\005\242\312\202p\232\321\261P#\254\360\361"
+	.ascii	"2d\354\202vO\311U\0358\003"
+	.text
+	.section	.gnu.lto_.pureconst.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\204\004\006\230\004\007\230\004\b\230\004\t\271\004\013\232"
+	.ascii	"\0047\264\0048\270\0049\232\004:\230\004;\231\004<\230\004=\230"
+	.ascii	"\004>\270\004?\232\004C\230\004E\230\004F\232\004G\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"5\005"
+	.ascii	"\342\306\027$\200K\322\001\230\004M\220\021\022\027\031\023m"
+	.ascii	"s2\307\025S\245\317\250\261m\003@k\254;\303\242\211V\210\224"
+	.ascii	")\027$\026\303\363\214\230\316E\323\356\230\251\224\275c\233"
+	.ascii	"sVN)9\237 \377\250\343\3063>R.V$^\320\210\362\320\372\321\321"
+	.ascii	"sR\252\315\247\301\202\370\013\016\254\376\006<\t\001! \320\002"
+	.ascii	"\262\352\006\023\221Q\022p\032`\007\261\027\r[\b\024\267\224"
+	.ascii	"Z#c\021\314d,\247\303\300\332X,\366'.\027v\274\261\341;\034\372"
+	.ascii	"1\344\n\342\003\t\364\311Y9ds\253\364\260o\350\273\230)\002"
+	.text
+	.section	.gnu.lto_.lto.cbc1029dbbd0a88a,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.140.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`;\007\315#"
+	.string	":A\220\016?PlM\007\003\300"
+	.string	"\224\312\360\035\221\360\017\254@ \020R\255"
+	.string	"a-\254L\302]\211\367\271\277\013\214j\310\315\357o&\220X\177\036\334\347\327!8"
+	.string	"C\267[Xr\230K\026\342\265\025WJ2\331"
+	.string	"\323"
+	.string	"\324"
+	.ascii	"\332'm\247t@\022\330\307\261U\262c+E\332\035m\177d\325\b\354"
+	.ascii	"\343\332\021\344\352M\262c\004\205\264'\332\256\b\001\"\343\313"
+	.ascii	"\261F\262\343+@"
+	.string	"\332\tm/t5\310\370rm\217\354\030\213\217\366?\333\001a\3711\376\034[\202\\\275Fv\234 N\373\236\355|\022\3509\376\\\373\";VpG;\334\3668\005o\307\357\303\206e\307\013\326\264\333\331~g\201\333\361\373\264'\310\225Dv\314 M\273\332\3665\006uP\274\0376\214\\\275\262\343\2548\332\321\266\247e\235\211\275\237v\005\271^\310\216\033\260\321\016g{\234\006o\306vZ\"\225\245\341DF\266\372\016\307.\310\365\263\225\032\355k\266\263\201\021\003\213,\007\r\f\216\035\270\f\235c\377\344Y:\307\327O\334\253C\013\373\321\350\314\024?\215\375\222\035G}\321/f\377\230\2500\305Ok_\213~/\373\277\220]\212\277\306~Yv,UE\177\226\375Z\244\260\034\177\255\025\222\035\357\240\350\247\262\277\312n\312\361\331\330_\263\343\251/\323\377d?\224)'\307g\333\224\035\007@\242\177\311\376\262"
+	.ascii	"J\214\337\306J\312\216\005\f\321\177d?\022\001F\214\337\326&"
+	.ascii	"\312\216\007\274\017\375B\366"
+	.string	"\017\031\360A\214\357\006(;\246\372\034\372{\354\367A\365<\212\357\326~ W\217\313\216\t|\r\3758\366\347 \360+\330\277\261m\331q\001O\372i\354\257Q\340g\034\377\315\345d\307\0062i\357\264\335\223\001N\306\207c\323d\307U\224\264c\332\236\251\352R\210\207kE\220\253w\311\216\017<\n\020\306$h]x\300;U3=y\036P\237\206-S\350\273\272\336\306\335\270\0347\3639N\307\331\274\315\361x\036\227\363\326\347\274\217\007rAn\310\017\371\"g\344\220<\222WrK\256\3117\371\247'{\033\177\343u\374\216\377\361@\236\310\027y\366\223<\223o\362Q^\312[\371+\277\345\271<\030\013O\346\313|\232W\363n\376\315\233\375\331\323\371:\337\366n\237\247\302\313i\r\241\336\374\233\376\270\375op\252\177j\t\345,;\372\361\354\267s\007\354\315~.;v\317R\323\317\266_m\255\370fx"
+	.ascii	"<\232\3769\373\321\322\320?\333@\256\257\226\035\003\200j\243"
+	.ascii	"?\316~9Pp\324Gc9\220\353\237e\307\030\215~6\373\333\3405\307"
+	.ascii	"Gkuc\364\237\t\267\034\246&\276e\324-\275P\020\301\024\355\222"
+	.ascii	"\272%\232\232>\335-\201\346\020\337"
+	.string	"\362<S\256\335-3\374\314\237yv\231D\025\030L\211CsK\352\226\347\360'D\273x\352\027\207\264\213\250\252\346\327\356\226\351\371u\236>sXD\205\277SH\336R%v\001\203B\241\324-}A\241\271\205z\245g\007\024\270\273\245\212\222\267\374\220\022\317\341)<\211S\267<\2758\020\201Q\267LM/T\215\272\345\004\nZh\207\364T\311[r\231\2520hr\355ny\376\320!/\r\232\273[vm\021\203E\225\367\323\342\235B\237\251\006\177U\267\364\020\034\362N!\320\313\344u\370\342\242\272\306\b*\306\302\300\214&zF\023\275\024'F\204\365\214,\306z\021\256\256\230\212\022,z-\304\304X\364\246n\031\200\223\250Q<B\f7\230\221\202\242\202B\232\003`\223Di\016\020(\343\244\234<v\220\375\035F;[\334\361\036\317\033\366\276l5\340J\255xT(\247b\217\203In\031\320=Z\242"
+	.string	"T\035\313\263\311W\234W\366\266\343"
+	.ascii	"i\335\276\301\035R\b[\330ag\035K^4\344e\031\022\027\203\035s"
+	.ascii	"\260\227\201i\370\215S\302\275,g?%\377\035_\210\bJX']hC\301\367"
+	.ascii	"\334\n\352\264;\226\363\212kj\0046\313\323\3256\371qT\35593~"
+	.ascii	"\310\367\2563\b\201;3\223\371_\22114\201\344o\327\257\245\206"
+	.ascii	"\276\355\372T\324\322\267\365m|x\374\355\234\261\r\257\313\r"
+	.ascii	"\\+=z'F\207\031\203\326c\302\243\205\377R\355\033 |\240O\226"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_pidnames.143.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375 C\031\002"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"0ROLL;PITCH;YAW;ALT;Pos;PosR;NavR;LEVEL;MAG;VEL;"
+	.text
+	.section	.gnu.lto_mspRebootFn.144.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"m\t"
+	.string	"v\321@90\257\322\001"
+	.string	"\304L\265\233t\244\002*\2339\355pBy\007M\022\275/:\252\316b\237\220\315\013\205TA\023\375\240$4\244\331\352\262\031\2608X\3045\007Q\322\310\336;\245,"
+	.string	"1"
+	.string	"1"
+	.string	"\016m\225\217 \333\271l\030'\264\335\255\323\345)\303\323)C\277\323:\345\370\314\254Z\227\035hw-U+\326\315\3356\310\366\202\355\224\246_\275h+\n\263]\215\233mc\034,\304\36656\004\254si_\344#\341I,\016\260+\242\274vG\003\027`\316y\274\300\345\034\346\001\227s\001t\212\266\021<6\035\262\225\265\323\335\3359\301\242\322\246\250\220W\231\340b\246\274\331\220\275\344\r\267X\013\313\312\232=\246\344\374\260\317e\314L<E\007>\370$|\036:\036\017g\203\002?\206\210\020\t\024\2352\3668\246S\311\301\033UoT%H\241R\365\300S\345\f\3703\211\300\212\372>\260jl\273\363\247\350\007\020"
+	.ascii	"\213\223\300\237\303\237\206Q\"*\t\001\340\0360&\347\331/V\333"
+	.ascii	"\322\310\267B\035\264\213\203\323\246\310 \307m\213\023"
+	.text
+	.section	.gnu.lto_serializeBoxNamesReply.147.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\026\nm:"
+	.string	"Je(\026A@bN:\353\355\351I\354b\017\277\231\375\231\177\231V\223\257\307\263\373\203\366\271%\024~l,\205\233\036}\256Hw\241]\020\242\003\020\rj\240\2523\351]F.\3164\252\376\266f\304\022B\366N2O\001<\001W\001?\272\217_\357\315\\\356t}\244\n4\327{\312b\316lgy'\332\257\314\274\374\231\307q\035M\357\265]c\255\232\3012L_\373\251\375\252T\231D\226\027\363?\233\360\021\352\ns\316\021\276\366\207\246\302\263\374\355\376\333\311p\035.\310\215r\216\342\227\227\363sB?h\277\366\363H\354\327\366G\354W\256n\302?\251db\033\03109\303\234\263\023\236\242$\022\247\323\351\264h\351\352\363\r\240\361\312u\001F\001"
+	.string	"$\213\220GGc\261%\262\253\212/W\377\342\341\205\221u]\200\0056\323\260-f7\222\216UQ\225tm7"
+	.ascii	"\025=\257\013`\201\2242'O\252\304!F\262\\:\206\246n8,\204~N\223"
+	.ascii	"[$\245,\355\310\264\037\251FP\364\304]:fEm\362;BF\355\036\337"
+	.ascii	"T\273\261\303\335\363\255\020[\031\332\213*\206=dh\227\2161Q"
+	.ascii	"\217f\204v\376\346\354\266\352\r\231\360\271tl\211\n\002\214"
+	.ascii	"\216\331\001\177\305\310\206\\\342\026%gU\017d\302\264%\311\276"
+	.ascii	"T|\206\216\357\202_\300el\311]\001?\300.n\216\0322%W\257\367"
+	.ascii	"\265\315\316\017[\231\223c#\231\331/1D\316\271o\030Y\331{\300"
+	.ascii	"\273\037\245\273\265\272[\302H\374\271\337\243y\207\370\363,"
+	.ascii	"\314\004\273.\242\325\t\306\0177\323\217\346/$\\Xk^C}\241Si\276"
+	.ascii	"\206\272\237B.vv\377B\373\2604\216\322\255\336^R@\274\235\340"
+	.ascii	"\201o\004\354\355\003\377{+%\0318"
+	.string	"\334O\340\3217\322\245\357\344\363\336E\237{#\331\333G\342m#{\273H\274\335\036o\023\333\333\254\361\366\332\336V\213\267q{\373\022o_y\364G\016\nB9\033\231\036\312\202+T\313\377\376\300_\372G\377\274\177\356l\367\231r\313\236\323G\346\234\224\301\235\341\233\217\026\357\201}\301>6\227\335\377\372\200\\\367\353\376q8\375>\"\232;ar\316\307\346:_\2075xj\244-\331\3738|[\177f#o\223\306\360\315\360+sm\331\207\366\333\334\315\337<\341\343q\207\003\313\262{\217Ma\316O\246\230(\217\276\250\366+\023\311\262\237\246\257\307L\222\327{J\257g&\363`'\370\006\005fy\274\333\365\331\270\261\371\361;\037\317_cE\261:\264\302\027\355\327\032m\313\333\275\256\277\246F\225e\367\327\264\205\f?\256fK\331\365\314FZ\324\245y3\314\371\231\342u\001\205!b\\\354`0\352\326"
+	.string	"\313^\332\361F]lnF\354\224v9\244\2261[+\210I.\364'_C'\216\261\362\245\210\235$\006\235\320\341\021\337\347\027<\212:40\274\025\001^\302b\357\363%d\324\311\022\376\336_\340\225\3158\377\233\027\375\234\t\026*l\352\265\330\331\031\252\260\n\360ZE\375\340\225\260\330S\036\257{\270vaS\302\377Ss\316\231\250"
+	.ascii	"\377\357\312o\261JX\001\376\227\232\220;5\332+\353\262\227d\252"
+	.ascii	"\205\305\316N\200\217\257\342\006\275\356a\337\257_\034\020\214"
+	.ascii	"\225\316\235a\316^\032\376\3048z\335\205)\274\237\373\371`\277"
+	.ascii	"&\300\005\332\340\220P7\004\370\201\227\261\326$\364\341\340"
+	.ascii	"a&\316'\206\004*9{m\320\363=2\324\031P,\024\373\025\001\276\202"
+	.ascii	"\302\222(\341"
+	.string	"\003x\225\003K$\370\023\201~\301\205pO\226\254\330\331[\354\377\356\002\320\357Fh\027i\337\213_\310\n\013\001\302\217\023M\223f8@x\264_\347\373\013\251\337\331js\316\033\372un'\252\177\345kO1\357\303\230\354\327\343\246Ah\363N\373o~\"Q&\313\301\234\247bgo\245\021\0321\375to\353(It%\034\211\305\272\231>\2545\365\256~a\313t7F\317\0027.uB\313j\304T\017\033YQPG-+\032\270j*\007\266\361\251,()\033RUPQE\255)\251\252\023ZV4Z&T\016*5\253\212\207U\324\2325\2055u\265\366\005\r\0344\320\250\200\001C\223\200,,)\334QM;\260t\314\210\242r\212\242r\252\262\001\245\303)\352\n\313\251\251@[\355\230\272r\312\262\262\272r:>\233Z\016H\260\211\205\bP\353\220\321@\246\017k\177Z\214\260\223F\\\337_"
+	.string	"\354\354\243\232d\022\306y0\323\213\212\360\021?\001\032\361qz\363V\377J\213x\272O\354W#..i\336i [.\302\317\243P\304\r\013\200$\374\274\"\234\364,fg\322\214$:F\260y\r]h\022;\273x\2104\200\327<GLOb1$\234\304O~^\367P\235&\361\245o7t\304\030\026\031\300\227^\231\304\006 D\313$\270EL"
+	.string	"w\2278q\037\326\312!\270\253[\\\304\367\216\210[|\260D\375CW(\372.\330\257D|1\264\025\253\230\305\377\362\222\304+^\005\035\252\370\301 \\s\316\177$\252\207\373N\355\314 \344\213r\204\232G\030\211\257\342\362\210A\302\217b\214\204\357\037X\242\244{q\267\212\025\367a\030c\255y\341\256\356fqB.\332~\200\327\250\201 \345\024c\310\320\210\210\310H\242a\fP\0021\246\312l\033\021\260\2714F\233\2151\201\032\271\220L\323\013\217I\022\350\024E\251\013\177c\225\244\177lNV\355c\270)\300f\316\221\314a# h\227\033o\331y\274!\246-\004\"\213JVhd"
+	.string	"\n\246\312,\234\377S\317\017\"-\212\3658b\207\366-\035\022\330\351\366\211\264J"
+	.string	"\202\253@\274\007\244_\250p\203\333\315\275u;\251\003\t8\351+B\347\275\376\303\031\371w7\270\225yEC\322?\216\300\f;\304\234\333z\251e\375K\237\032\234y\350F \350\305\030VS\202\262\372M$?F\216\257\027\264\034#\347$G\357\336\033\335\245it&"
+	.ascii	"\237C\tFa\001/\214P\253?\274Y\343!\351\312\354\356\nD)\310\n"
+	.ascii	"\034\242\324\200\253%\350N\244,\037IW\321\237\306\312\241\201"
+	.ascii	"\272\020\2441VX\200\331\260,~\231M^\200\025\251\024\203\226\352"
+	.ascii	"\203\2416\346\017\324;\026(0\300\001UCo\365}\265\300i\263\264"
+	.ascii	"\252_\2619\030`i!jd\360\t\"/\271\246\324\217\241\276\372\363"
+	.ascii	"\352L\275zI\260(e\311M\317\317\337B\303[\246\204\315B\356\263"
+	.ascii	"\201o\320A\220\032\342@\212\214\007\262\007&X\215\342\326\322"
+	.ascii	"\031\330\316\333,\347\026\272\3059\034Y\226\253y\275V&\255\370"
+	.ascii	"\265\3576\b&\260\031]L\265\261fWin\242=\332Z\324YbSu\024\027"
+	.ascii	"$\364\353\377\021L\365\265^\220A\255\026>\001\032\031\366P}\231"
+	.ascii	"\356\207K\032\345\306\344\304\036lb\305\001\313}\364\3642\250"
+	.ascii	"\342&\371\347\2156\252\004Q\274\337O\375\001"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.148.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`}\re,"
+	.string	":H\204\017D`^N:3I\030\265\001\323I\212`6 \274\270\230vd\356\270\342v\006\256[6p\352\343\301\227\360\006oONq\026E\234\2226\256\221\205\332\361\357\3640|P=t\265e\177\033\373\3336B\210LR\006\335"
+	.string	"\301"
+	.string	"\364"
+	.string	"_\243\376\026\375K\364\257\220\277C\375\r\376\013\354\257\320\277\277\376\372\376\355\375\233\362\027\355\357\371o\377{\376r\t\256k\363\223g\302\233Zm4\003\325;T\314\222\335e\340\302\330\265\303rk\225\267"
+	.ascii	"\022\303\342\247\326\212\354\"\f\203\221\216G\306\"qhTD$\034"
+	.ascii	"\n\002\205~\276^\212\236}\030\313=\007?\3452\006#E\341\243\333"
+	.ascii	"\330\222\037EQrc\022.&Ar\342\021\036\0361r#6."
+	.string	"b[;\021\032\013\321\206\316\251348\2309\366\3434\256\021B\347\354A\037\f\364\321\343Bf\3743{r\033\343q\337S\020\2622\3561\307\312\304\236\352`T\270\f\233\261\224\361\023\0077p\tv:\325ZY\n\277\306\362\353\3579\250\265\356\225K2\336$\336e*\273\013\265\033\264\021\311\"\234Z+\003-Qkz\230\223\351\362\025\306\222\\F\262#J\224H\031=\351\224x^o\356\021\331\313,\231\2777\361\236I\271\311K\227\362\024\226\353\022\256\325\352\305\312e8\216\343ZF\302\350\246\350:+\031]\356J\031\335e\341\342\254\\\247\260\216\261F\264\273<\274z@\273r_o\265]\356f\263)h{\310n\177\027\374\253\365o\326\277\n\370\213\325\337\004\377\"\370\367\252\277\310\177\255\376\255\342/U\177\017\374;\365\257\024\177\r\3647\352\337\002\377B\361\227@\177\007\374+\240\277O\377:\375\333\324\337"
+	.string	"\3772\375\273\364\257R\177\001\374\233\364/\022\177\217\375=\372\327\330\337\342\277\304\177\207\034\017\263g\315\331\220\217/\244J\rb.\316\256\205\323\270\340\253\025Lk\257\374\214\f\0326lH\031U\352#\033\\\035\224 "
+	.ascii	"\b\027{\030R\003H:\030R'\335\013\251\016x\334:\032\337\360\344"
+	.ascii	"\341\t\245\025XP b\037\031\377\f\333\230\346\304\300}\370\f\273"
+	.ascii	"8l\242\236\341\231\237\221\317\310\214\257\325\326t`<w\204]D"
+	.ascii	"TG\330Ds\204q\275\241s\210J\212\212`7m~\035\004\262i\340\223"
+	.ascii	"4$\370NM\257\205\316\3114\355_\237{\302\316\276\232p\026\336"
+	.ascii	"\335\023\214\346L\332\276\264{fR&h\253ya\224\003\332Xh\314S\251"
+	.ascii	"\005\223I\036\215\251Z\323\363>\233\305\006u\207a%^\026~ws\330"
+	.ascii	"\331\327\233\373\345\035\305V\026,\303\203\311\315fsP\357\213"
+	.ascii	"\224\033\304\234\034\260\377\251\265\362\207tw+Dg\245\201u\214"
+	.ascii	"}\231\035\314]*\336\022\273e\205\242\313\204\207-\021\310-\021"
+	.ascii	"\310\023#>\230@n\251\350BZ\035\227\013E\b\025\310\025\\\\*\220"
+	.ascii	"@9/>k][\036\036\257\376:\221\210c\247;\231\254^\240u1Y\255u0"
+	.ascii	"Yvaj\255\365\330j\313\027R\005}\26799\021\356\205\313\273H\230"
+	.ascii	"@\201B\312\250\202n\320<\302\252Xq\314\241\331\263$\213X\242"
+	.ascii	"\256:\001\202\271\253FP\345\312\356\315X\224v8*U\215\264\222"
+	.ascii	"R\325VoUM\212T\034\207\251\230\020{k\177\342D\252\017L\271I\365"
+	.ascii	"T\233T\217\241\001\003<\232FKm?b\004\252\243\n\254Au\001\"Pv"
+	.ascii	"7\232E\004\234\352\026\001\273%\223)\312\201$\213O\213r\352"
+	.string	"\001\002~\326\324\002\372\244\013;\373\212\273\313\303\013r2\235\362\036\311\342\315\242\232\372\251\251\235^\326\324PleqM\"\340\203\3478\216\245\016\300t\262\245f\372\330R\335[Z +nBa\303\005\201\035\250aX\347\311\210\210H\222\244V\032\003\241\006\"2cT\017\021\320$c\2141V\242\222\312\003\222\003\232\252D\333*\256\213\030\203\311>\227\336,\230\223\023:f\221?|`R\235\211\202\230\221\022\305n\346\324\240\226*U\361\360\302\344RLbb\\\315n\013\270\203\341|\306\335cn\300\337\177h{Ae\335\007\203\fs\362\361\340\341|\225U\274d\257\303\344fsG\352\324\264\352\247\261\277i\t\255\213\212\306u\0232\232\236\306xU[Y2\354\001\300\360\267!x\2552\236PR\317G\032\376V4\332Hk\240\021\260\3513b\0049)^\247K?0\325\377\027B\304\215c\233\031\212\264 \360"
+	.string	""
+	.string	"\354p~<\344\311\327G2\023\221\301\202v?\240L\215\276_\331\r\363q\316\367\0372\2653:\324\020<o=\212\366\310\276\375)+\213\013\357!_\362\005\261\361\346\354W\005\332\313p2\031\371\316E\002`)g\230O\275\273"
+	.string	"\323\361\265\356\301\350$JC\037\260\223jW\300\214\231T5\204x\240\376\370\337 Fv\020W\276\325\310&\223\301\227\3104\365\241\251\263j\2400\257k)a\324\202\0254\261\330eE\207\035\307\265\032\216\\\037\2119D\203\316\335\ff\336\335\023Pxj \202\202"
+	.ascii	"\356,\023\325\217\f\331\224\321=\315\251/K\331\252\200\035tG"
+	.ascii	"\004\342\377\370F\274\360rY$\201\300#FpK\302\031\304P\353\226"
+	.ascii	"\325\200\315Y\\\216\245\335\301\021\002'1\254H\260\253\005\203"
+	.ascii	"\b\212ZW\023\312\323p+\034*"
+	.text
+	.section	.gnu.lto_packFlightModeFlags.149.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\022\nE5"
+	.string	"\332d\340\024<P\350I:=\214F\021\361\243^I\205\221\251\372\346v\256\3121p\224`\337[\222\321\263@a"
+	.ascii	"h}\006$\020B\021\001\031`\013\031\301\310~mjF\305\302\022B\255"
+	.ascii	"\221-\223\22420\001\033\001]\001\254\021\232\025B\263\n\233\365"
+	.ascii	"A\263:h\326\252fm\320\254\f\232uA\263*h\326\004\315\212\240Y"
+	.ascii	"\0174\253\201f-\320\254\004\232u@\263\nhV\252f\r0Y\247\232\025"
+	.ascii	"@\263J5kT\263B5\353S\263\006\233\025\330\254\344\316\255\316"
+	.ascii	"f\355f}\263\362Y\267\314A\233FC\212eY\345\370W2\232\204\330\354"
+	.ascii	"\236\335\272\335\271]\272m\325E\333c\245\253G\267\250Qh\305="
+	.ascii	"\202\252\274\205\321\261\322\305\243\233G\243v\242\325\251SC"
+	.ascii	"P\372\312\262$\021\334\271\252Jt\355\354\035\215B\033C\227\344"
+	.ascii	"\317\024@_\301\235hl\254vn-\310\304J\260h\367\244\257,\351\256"
+	.ascii	"vj\205\340N]:[G\211\2565\335\0318(5v\210z2\225%\335P\270\006"
+	.ascii	"\310\235\275\004\310\2357\243\017\266\351VI^[ 9\373\274\246\013"
+	.ascii	"\004\273\263='\323\361\r\216\311\002\033\350\244\312\232)8bw"
+	.ascii	"m\352#\264y\332\230\204r\243eg\226\355)8'-,.G\201k\302\337<k"
+	.ascii	"\225\311\356\rN\3132\020\254,K\3457\270+\253\301UU8U\035S\205"
+	.ascii	"\312\nR\337\250o\246\275\242[\247\247\003\017uR\213\236\0371"
+	.ascii	"\216*\370\247/\363\203_<\275\243\333\337\373\300\223o\364\214"
+	.ascii	"\304\270\024'\277wv\366\351\371\005\327\002\271Oqer\325\020\371"
+	.ascii	"\367\027\\\"\312a-\377_\267\2776>\352\236\277\304N\272}\326\217"
+	.ascii	"\020\3354J$\215\367m\247n\032\271s\277\201\320\310\261\361QY"
+	.ascii	"\021\027G%sR\245c\302/\243\272]g6\365\351\311\250NV\037\223\225"
+	.ascii	"l\262\366\230\254<&\353\216\311\252\203d\3151YqL\326\033\223"
+	.ascii	"\325\306d\2551YiL\326\031\223U\306d\2151YaL\326\027\223\325E"
+	.ascii	"\013\026\273gu\305dUq\326\024K\267\212b\353V\307\304vn\365D\263"
+	.ascii	"\232 Y\303&k\211f%1Y\301\232uD\263\212 Y\277\2325D\263\202h\326"
+	.ascii	"\017\315\352\325\254]\315\352\241Y\271\232\265C\263n\001Y9\220"
+	.ascii	"\254\033\232U\253Y54\353\260Y\263\2325C\263b5\353U\263Z5+\206"
+	.ascii	"f\275\320\254\026\232\265B\263Rh\326\t\315*\241\003\235\214\213"
+	.ascii	"\210qm\037\016b\005-\377\3037\2231\317\355\257\353\036\356u2"
+	.ascii	"\221q\307\273\344\030wp\275\303=|-\031\355t\234\313\213\361\256"
+	.ascii	"\324"
+	.string	"\261u\255w8\331\305X$\306q\370V\025\231\343\034\016\350!\026j\333*r\303s@\332\2742\263\2633r\347\206OL\177\232\3444<\353ZGb\\\333\360\032\244\206_J\306\242\333_\206c=\353$\036\237\037\216g8\342\270\272\325\261\2147~\365\205\317Ox\003\303/\334\352\244\034\276<\033\307`$vb\263a\341\025~\341\344\034\337\242\032\267p\205//X\203\302'\274\302\311C|w4NA\013\337\242\246!\341\021>\301n\306%t\341\273\343\031\020.|\204\223\204\370\2122\016\301N\306\203;\270\360d\242\275c\214?\220\343+\306\250z\203;\360\203\361*/{G!\f\006W\360\006F\252\005g\360%\312eX\376\002?\267\277\004Gp\005'\341\354\345\005\023\030\017\274\300\021,\352\322\300\017L\003yn\177\004>\340\005\356^\234\300\"~!\340T\037p\362\320\236\235\213\013\020\353\262w\267\245\213"
+	.string	"\007p\252\223r\366\212*\036\340\211\330\211\215n/\220SW1h\t\255\001\t\022\204\3349u\255Cz\232\344\244\016u"
+	.ascii	"'\257\350\035\205Q\017@\312\206\240u\2205B\004\311\225\003\227"
+	.ascii	"\027\327\017\255\255\255\254\001H\316\324\256fYF\216\020!3C\033"
+	.ascii	"\232\241\r\213\004)#24S;2\314B\240iF\316\324\206H\322\322\324"
+	.ascii	"\206Q\252\333\244\330\347\274W\030\266\267\351\336Y(<0\300\227"
+	.ascii	"\321(?\263\3057\317\316IZ\370j\307\036E{\236\bj\232D\205\327"
+	.ascii	"\270b\2172v\023\017\303\013\273\tLe8\316\302\376$\307\266\005"
+	.ascii	"\017\213\243\222\231\223\216}\353\226|\031\335\342>\225\231$"
+	.ascii	"\250Y\\\373b?\361(\252-\276uX;\366\026_\267/m|\3345_\260\234"
+	.ascii	"8\030\033s\342\311\342;'\366\022gq\016D\214#\361\022c\307Z\022"
+	.ascii	"\347Kn"
+	.string	"\177Sx\\\366\221$<|\372e\222\220+\256V\027\251\toR)\274-+\276{V\310\006\366\025\277\036\242\334\210\203\2118\326\216\370\f\344\366\367u\021\252K\372\266RY\260,\313.\335IKI\207n\232\235\312\203\214\214\334\371\365\020h\bmqW\n^\226\027\357\234\300]\257v\3536\317v\0341%\226]\373\n\303xp(\276t+dcN\352\343=\216\342\210\364\362\210d\347q\037\007\306\2058\331\201=\016\224k\343\001\342^\017q2\200\320\250a,\204\021$3b#RP\220$\031\306\340\002\221\241!j\003\020P\347h\324\030\013\310\247\221}\245.1\t/\251\272e>\017\233\371 \276\311\224\225\243\340\300b\211\232\270M\370\207P\317\225\366k\"\001\"x\372\211xFO\371\261\210\261\032B\373{\237\210\274\006\177\007\204\350\334\"\221&u\304\234\t\3468\221\205\264\372\244\225\ft\360\337\226\372\266"
+	.string	"\342\002\004s\262\005V\274V\231\307\257}\037AJ]\366\303@\037Fdq\2565\036.\020|{_\371\356\037N!\271\210}v1\325-t4-\003\246\276l"
+	.string	"\033\220\210]>lg\255\272\357\004\205\222\326\266\235\206\352\033n"
+	.ascii	"\334\025\245\025?\024\321i\177'\211X\323Pv\333.m\205i\267\261"
+	.ascii	"\232\362\035\335b\313\354\213X\243\241v\033]\366\203V\202T\374"
+	.ascii	"j\344%R\341y\020\021\001L\243\370\301\215\021/.-;\340\017g\317"
+	.ascii	"\251\337\324\243t\321\223\215k\272a\2156\365r\300\006\177I\227"
+	.ascii	"\253\257\317\267\264\274<\337T\245\004\346`\253}E\214q\220\207"
+	.ascii	"\317*\027\341\374l3\245\200\307\324\2640\344\032/C\224\234 C"
+	.ascii	"I\016\377UK_<\340\023%\234]\222\032\0038\301i4\322^\302@gV_\n"
+	.ascii	"#\322\023\237\310\212\020\002\025\211u>\227\352\351\223X\300"
+	.ascii	"\235\216\310T"
+	.text
+	.section	.gnu.lto_serializeSDCardSummaryReply.150.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"%\t"
+	.string	"\266P>90\221\322\001\200\360\3068\321l\234(>S\217\230\257t\206\362\016\203\215o\264\372\206\254\004V\236\305|\220\n\351gD\2444\312\212\030f\020JEN\262\371\031\261\204\220-S\n+"
+	.string	"."
+	.string	","
+	.string	"\003\3335\2136\315G\223\355\260D>V`\273;e\311\305\253\350?\345"
+	.string	")\025\352\332\201\330]kJ\025r\313\333\376\330~\260\377\tW\356\261\021\230\315\311\265\013\022\313\331\227\326\302\262}\217\375y$\\\355\237\034E|K\343\001\273\253\031\226\335q\301\b\3345\217'\330\256q\017\234^\3455\234\372\027[\210\021\003c\360\222\251\302U\332\247\f}\312\007\035\022eu\271\310\254\342\330#J%\211\375lw\327re\277\365n\b9\204$\030@\240N\300\024NH{\035)\034\211\274oz\337\264\250\210\030M\257\024\316\256\300 \211\2424M X\232\236q\237\255\\Yt\363\332\220\034\016\020"
+	.ascii	"\211IE&\336\t\215\026\027\376\347\b\330;\205.`!\200\031XDO\200"
+	.ascii	"\365)\334\\F\371V\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_serializeDataflashSummaryReply.151.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`v"
+	.string	"\025\t"
+	.string	"\206P>;0\3456\035"
+	.string	"\370>\322\033\316\274\214\301@\221\313\223|\200\257(\277\031\f\233J\244Pc\216\020_\253\333\361\361OT\341`\340\202\333\370\354\007B\205\204\372\300\rD7\021\262wJ\001)"
+	.string	"."
+	.string	","
+	.string	"\330/\207v\352\365d\263\322\n\004F\265\273t\232<\274\f\375\273<`\034\211\227\231\304\356Z\216#\221{\3366\202\355\b\373[\0316RU5!\315nH\200\325\236.\231\222\355o\266'\265pi\237\345-\341M\034\027\330%\315\304\354\326\006'h\277\\_\200\375\322N\020*\177y\212&}\f\f\314\350\240X\222\341r\332\032\033\362\243\017>\246h\005\024\tj%"
+	.string	"\273\212r\226\330\267vw=I\366M\277\f~\340@p:\016\233\r7 \002+\246;.\004\202&\272\017\355>\364\302\202\002D\273\017\244\234\201\275\220\347\243\"\317\373\350V\367\326N\2225\324\312\251cz\004\017"
+	.string	"\211IE&\336\003\215\206\013\"P\302g6"
+	.ascii	"\357\317+\300\342\236\205\365y\335\\F\371V\243\301]^\264\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_mspFcProcessOutCommand.152.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`}\230\275\337\001\n\034\243\250O\020(\006\265\f\007Ca\243\243\330\312n\252J\323Y\224\016M\245\r\\\234p\321\317\352\367\021\004\351:\357\214o\2042\222\324\022r\177\217\002"
+	.string	""
+	.string	"p\030\005"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\207\026!\200\027-\035K)\361\211\302\371`K|\211\250!q\357\235"
+	.ascii	"\244\224\001X\nN\t\366\n\357\345\277\367\262_L/Ky/\367\305\364"
+	.ascii	"2\337{y\357\275\254\327\354\345(\357\345\274\3672\224\3672\236"
+	.ascii	"\006\275|\367^\266\213\351\345:\020\275L\367^\236{/\313\305\364"
+	.ascii	"r\034\210^\206{/\277\275\227\237\304\364\262\033\210^n{/\263"
+	.ascii	"\305\364\362\032\210^V\003\321\313i\357e\264\367\262\223\230"
+	.ascii	"^>{/7y/3\211\351e\263\367r\331{\231,\246\227\307H\364\262\330"
+	.ascii	"{9\254"
+	.string	"\331\313K\336\313`\315^\376z/{5{Y\311{9I\263\227\273\336\313\\\315^\336z/#i\366\262\326{9\253\331\313G\336\313X\315^\276z/[5{\271\352\275\374l\3662\325{\331H\263\227\247\336\313R\315^.\362^\216j\3662\324\210^&\302A/?\275\227\235\232\275\334\364^\036\322\354e&\021\275,\344\275\274\324\354e%\021\275\234\364^Fj\366r\020\021\275|\364^\006\322\354e\243\020\275\\\364^&j\366\362P\210^\376\361^\366\021\323\313B!z\271\307{\231G\263\227\203B\3642\320{yG\263\227\177B\364\262\317{\271\247\331\313<!zy\347\275\254\323\354\345\234\020\275\274\276WG\263\327\031\242\027\347\2757\315^\233\020\2755\357\315\321\354\305\361\336\035\232\275:\2747\207\367\336x\257\215\230\336\032\357\r\301{A\360^\232\230^\032\357\235\241A/\016\357\275\341\2756\304\364\326"
+	.string	"\242\227\006\020\2753\274\367\0031\2752@\364\306x/\214\230\336\027 z]\274\327\003\315\336\026\357\355@L/\007@\364n\340\275\032\210\351\315\300{1\020\323{\001\020\275\026xo\005\266W\206\016z)\260A\357\0046\350\225@\007\275\021x/\004\336\373\200\230^\007\200\350m\300{\031\360\336\005\274W\001\357M@L/\002\336{\200\230^\003\274\267"
+	.string	"\315^\002h\320\033\303{\007\360\241W"
+	.string	"\037zax\357\013\357ua{[\370\320\313\302\207\336"
+	.ascii	"\274w\205\367\002`{U\370\320\233\302\207^\024\336{\302{Yl\257"
+	.ascii	"\t\037zK\370\320K\302{Gx\357\212\355U\361\241wf{S\274\027\305"
+	.ascii	"{Eh\366\236\340\240Wf\203^\023\357-\321\354\r\341\275 \274\367"
+	.ascii	"\203\230^\017\336K\242\331;B\203^\021\357\r\361\336\016>\364"
+	.ascii	"\202\370\320\313\301{7xo\314\3666?\364j\360\241\367\303{3x/\006"
+	.ascii	"\333{\301\207^\013>\364zxo\005\357\245`{'\370\320+\301\207\336"
+	.ascii	"\b\336\013\363\336\227\355e~\350]n\257\313{\325\367\246\314^"
+	.ascii	"\224\331{fo\253AR4\356Pq\302\265\345\201f\353\217J\311\365/\245"
+	.ascii	"\313\352'n(\356;n8n2\356,\356-n,\356'\267\025\367\024w\021n$"
+	.ascii	"\356\035\314\223\314\221\314\217\314Z\230\033\231\027\231\025"
+	.ascii	"\231\021\231\r\231\003\231\253p\314.\313\230\303[\030\031tuY"
+	.ascii	"\212v0[j\206s2\264\3346\235\013\240\232\340\034\016"
+	.string	"Js2\250\330\351\013\"\311$.m\016RF\324\223~[\030\031Tbs;dt\271Y\340k\356\207b\223%\233\313\224J-5\227)\225WN0\320g\333h.S*\251\234\330`\345\004\003E\"D\r1\222\001df\333l\273\311\021\023\032\3032\276\036KNe\364\224\311\b\332S\034[\322a-\006CDY\244\277\272k;I+i/\030\"\312\24799\270\267\030\2053\333Y\333Z\315\025\303\260\221\364\026N[i\200\327\242\225\251X\026\366\027A\214G1\276#1\246\224\201)6\231\331\246\332\256\352\253\205\211q\326V\034\3405he \305\262&\305u\035\362Yr\032#\256\237-\272\312\234v\226\234\306\3402\362U\306\024#\252\245\026&\006\225\241\\#5\324v\324\302,\016\220~\332&\202\323N.Z\310v\0233\007\261\nN3\271\3548\3210d\346\335C\230Z\260\331\372\203\355\326\034\227\234\306"
+	.ascii	"2\263\255\264\275t\024%FO\322\302p\032#\250\317\214\006%3\215"
+	.ascii	"\324@\266\203x"
+	.string	"\315\354v\020\027}t\003\257>CL\036lK\212\207KNix\3164\220&\3326Z\030Ni\250\232\331m\243-\341\004\027]\324bD\216\331\372\203\002lkb\217U\226\234n\023\271X\030-\264\375C\002\242\303*>f\304\371\200A\344\302N\233\217$\030Zf\266\203\266{8\362\220Q\364\025\006\026\026\330@\206_34\317\366\217\004L\f\037w\267}\272\207F\342\314\273}f\350\236\275C\300\252S\244\242\307*H\222\221\226\234\302x2\263\\\271\235\323;o:5\024=\2065\031-9\205\021\245\327\033\234~,9\2051F\2710\234\302hB\0256D\021Kra`l\315\354F\316\250`\005\\\231H0\214\207\320\222S\030C \027\006\006T$\f!\307\205\201Q\004\346\2475\231ea`\350\274\234\255\2758d\\\230\027\213\2012c\217b\217\353j\366\207ea^L\021\"\227\2700/\356\320u\215"
+	.string	"^IZf3\313\206\313\207\013\363\002\315K\350EVa\327\f\023\322\360\352\263\3460\364\352\241\270\256f?KN_@\315,_Y\026\\\230\027Q\201{\307k\321\312@_I\372\024{\226\234\276 \232YN[\266\2620\234\276\b2\263\273UB"
+	.string	"C\005\353\017g\t\350\307\177<\205\311\344\212V\237\036\3571\037s\356\nU\336\035\3431\024&\023I\2559\271\035Z\327\025\005\327\355\302\254\rN[~\302qL\307\234\223\274j\022[\327\025fN\016pNn\003*8\340\336\240\300\275}8\273\261\304\341\266\275\033\301c\266\022\271\3548\255\211=\256\353\212\202S\232'3ov[^c6\033\334\266w\250\331JdA\024\245\317\342\343\272\2563\234\256\fKNG\240\254fc\027\206S\016vqvav_\364\314\244NrhV\260\362\234\035!\300\222S\027\2203\250\0313\301\341&;\260\207u-\"\t\303\222\3235[\2728\234y\357\262\030\217\3410\231\315\246\353\372\304'\267\256f3[b\311i\005\234\201\312i\363\005*\247\273\273%\234\200\263:\232=9XF\340\202\374A{\\W\263\02572b\004\013\017\036\"\300"
+	.string	"\003\ff(\240\200\202\025\233\267\314&\367\341\030\334\202\345r\311\201\005\026t\360?\204\027\231\335\025A\004\243f,\002"
+	.string	"Nv\271r\323\026e\324\214\267\005\ft\360\022\356\340\nn\340^Y+[e\251,\340N\331\277\365[)\333\267|\273\267z\033e\363\026\312\342\355\335\332m\335\322\355\334\312m\334\302\355\333>Y\267m[\266][\265M[\264u\262g\333d\231\254\331\013.\264\300B"
+	.string	"V"
+	.ascii	"\200\n)\240p\002\013\023J a\204\025*fR\240\020\341\204\214\211"
+	.ascii	"\022!\200\360\201\007$F\210\b\321\001\b\0166\210ij\360!\203M"
+	.ascii	"\304\340\202U\264\300C\005\024L A\0040/\314\245\213\232\242\337"
+	.ascii	"\3025\334\303E\\,\273\270\214\333\270YV\313:\356c\353X&\312\341"
+	.ascii	"%\034\234\200\250\347\003\324N\224^\301\310\3005\267+dgV\304"
+	.ascii	"\250T\241\202\001T\324\023^@t\204[[\357\224%u\177"
+	.string	"`T\374\276\n\203\244\210PyF\245\017\313\215\317\212q\317\252N\257\nng\2434\336Uo\036`\324\027/\024<\f\332\274\232\200@Ee\361\336}\200\3329\202\307(\023\324\016V\257\335\022\225\272\244B\272$\267\2718\247^9*\3368\037\214pB\205o)\017*OB\340q\346\366\306!"
+	.string	"E\266\241#F$\365\262)\361\256\225\361\001\"\225"
+	.string	"\201\212R\342U;\"\324\233\346\203\027\315\b\243A\240vx\364:Y\024\b`T\017\3363\310\263&\211uL\020\327\f\361\354\205n:\334\241\322Ft\304.\240\021\\\341Z\232\200\250\0075A\351\311\225\226\222\354\026&\231\005\277"
+	.string	"HI\\\241\223\006\033"
+	.string	"\220\254\302#\247\320\227'\006\tU\364\310(\240)\256p-1\340P\"z\201\322\223+\275\304$\266\206\020\373\004\224\037\205\0342\340\320!\352\302O\025\243&B\330,\f\331\004\224\205\261\257'\003\016\025\242o\242\006\245\243\230\304\326\320a\227@\204E`[\023\203\204*2d\022\370F@\321u]\327um )\275\302\217U\240\357ydba\313O\025\246\344\353\231>N\021\005\205d\224\026A\217O\240\251`\235\332\004D=\350\nHW`\f\031\3272yl\"\256\004Z\001\034:\302\223\016\341\215Apd\024\314\017\tT\321\033\177\360V\347\301\223\302 \242#&\341\306\030Dt\304#\332\030E0\301\235\205\310\"\326\035\2141\b\324\305\307\320\025,\211K\314\230\325\034\204\361\006K8\346%\212LN\f\022\252h\t7Q\021\024\347\264\360\326\020\030\232\301\217#A\314\310$"
+	.string	"\207\276Z\203\t\210z\260`\365\207#\234\301\021\336D\277D&\2615d\325\030L\025]\361\005\254s\305\253\210V\260\256+\b\250\035At\204g[P\305\036\016y\331\350%\204\005\252\250\212+\200*\242b\n"
+	.string	"\207\234\320\021\353\272r!\223\330\032\242\352\t\f\020\225U\031Dt\304\022\240.=?\216L@\324\203\252\260E\221\216\005\231\304\326\220\220\216\200\304T\021\023\303\b\362\2621I\037\026\250\"&~\301:\013\":b\246\225[\020\321\021/\253\366\\>x\326\005\021\035\261ZA\224\036\247\247\242\022Dt\304(\2431\272\265\344d'\260\215\350\210\337\307[\330~\274\206_\274\207\037P\361\"\206\361b\031\343]\314\343e\324\343mlH\336,=x\265|\340\203\327\261'y\037\037)+\225\"\267\004%\"\256\225\221\035\032\n\026\272\261\225\221\021\0166\r\211\203{c\033\023[\022&\245\t,\317\252\252mo\355G\037\337s\b\323\022\320\216=!K\f5\224\364\343\303\363B\264\243r\220\341\030\006P;z\001h\027\030\326u\335\016\"*\342\315\301\2730X\273\214\263\333\343"
+	.string	"\001,\\"
+	.string	"/\034\006\027\376\302Q\274\265p\027\266\270\205"
+	.string	"<\205\263\260\302\003"
+	.string	"\200\257p\021VT8"
+	.ascii	"\264X\005\024^\302S8\341(\260\370\t\007\361f\302Y\034a\023H\370"
+	.ascii	"\314K\030\341$\254\370\b*\276\342\212U\244\370L\025\247hT\344"
+	.ascii	")\350\024\2438OA\245\030Ea\024\3002f4f\252B(\022\\ja\226\300"
+	.ascii	"\250@O\t_P\360\317\316cwW\375\371\317\036\003\037Oo\251\204:"
+	.ascii	";\007\362\302\240\323\221<\202\017/\250\bT\240s`\n\376\331U\240"
+	.ascii	"\263O\323NWn\232W\030&\302O\\\204\367\233\314O\354\342xD\237"
+	.ascii	"8\347R\240ZW\036\025v\235u\250\233s\217\005\325\272\362\240\300"
+	.ascii	"\351\242lh\233\363\316O\345T\346)<\351t\272r{\255p\fp\355H\021"
+	.ascii	"\006\3274\030\024\314\201\314\201'\035F\357\240\326\216\\\026"
+	.ascii	",\fS\177\316UL\\\375yO"
+	.string	"R\240\027UsFi\016Z\024\rMs\356-_q\272\316>\247_\363\036:\2478\2514\007\2318\033\261\025\366 X\b\326\202\2740\274\334\240U\"\204\227\260\022B\023\023\003Lx\352\031\023\343E\303\230\321\370\002\224\214?8\003\276\355\323\270\323\225\273Ux\357\32499\024\f\367\366\274B!\177:\035\271\037|w\331\255m\207\"\327\b\235\216\\\017\376\301\242`\350\022\233\345\253u\006:\007\3339\250r\352\301;\030\274a\211\304G\234\204\002z\327y\350Ll\016\032\361\034\236\222\016\320\"\234\214\316,\004\350]'\2443\2629H\304G\354\004\tq\020\017q~\343\340\032\034\304\006\347\3402o>8\346\033\034\305[\3631\0254\377\202\364\341\026\\\203\f\376\341 \262\3140\006\317\340\"\254\\p\fF\\p\027$\036.\301-\250\340\036\036\323\207\0221\005\257\340 \336&8\005\313\t\256\206E\360\345%8\377"
+	.string	"\331\351\312\205y\004O'S\360\313a\336\314\342#\271\323\225\313\374\013\312<\327\271|y\376\241\324\351\312\025@7;+st\3544\007\271\334"
+	.ascii	"\344\206!\364yFc\224\353\251\3479\373\312J\336;5=\372\374\366"
+	.ascii	"O\322NWn\013\315\254\343G\335\325\001\244\203GsP\372\035\236"
+	.ascii	"x \037\3112\204\216\314E\027\224\210\020\252\270\374\220\037"
+	.ascii	"\267A\n \f\357\235\332_4\tU\322A\204\362\325\3520\322q\244r\020"
+	.ascii	"\247\313:\216TN\373\314$\235\256\354\263\3022\204{K<\026J:\204"
+	.ascii	"D\220v7\344\2039\r=\322\341\304\201\037]\217a\200,C\b\346\322"
+	.ascii	"\265\325\274w\252\rZ3=N~,C8De\356\255-V\360\322\b\322\346\314"
+	.ascii	"Hh\224\367N\3454TH\207\023\216\037>\034\244\203\310\322\247\027"
+	.ascii	"Mp\032\245C\312\207\020\211\217e\b\217\376P\033\206H\360\336"
+	.ascii	"\251\224)f\220L\321(\370\213\337\325\361\324a\325\034\264#z\236"
+	.ascii	"\263\274\026\030\t\270v\344v\024f46@\231\331\243bNO\356\232\355"
+	.ascii	"\274\021o\330\301\301gF\021\032h!X\253\001\305F\337\215\277\034"
+	.ascii	"\fux\"\363\016\227\332]\224\207\027\206\234\236\\\346TJ\t\037"
+	.ascii	"\216K\365,\352\263\210!\374\222(Q\235Ew\0261D`\036+V.\272>\035"
+	.ascii	"\376\211}I\356'9\210U\236\330\027\344~\313\"v \231\324\243e\357"
+	.ascii	"\270\210\234X\244\211\211w\030\367\215\2543&\251\265>)\356\261"
+	.ascii	","
+	.string	"\242\b(y\234s\270G\\D\226\024lb\342\225p_\270\210(\342\222(\003\367\202\213\210B-o\262\312\336\312\"6_\221&&\311){\300E\354 0\317Q\312\336o\021;@\313\262\267\347k\fs\313\333GYD\020\223I\212w{\274D>\272}\035\342Z\334^\356\320Ik}z\262\1773\004S\322b\333\267-\"W\271jb\032L\333\253-\"Kylb\022<\333;\271\342\005\244\265>\231\355\231X\371\221\274\261=\331\"\246@\313\373[\262\017\223\002\205P\313k\377\265\210(\002\223\370\272\366I\026\261\373\264\364\220\354\267\354\366\216\354\263\350\326\264\254\366WrwMZT\373g\234\325\237\324~j\021e$\223\336\240\366Q\213\330i\222nN\373\247\264\247\234\330\327\231\366C\326IO\312\266&\366\245\264_Z\304\023jyM\202\354\221\026\261\237\\51\255\331\215\366@\026\021D`^\013C{\242"
+	.ascii	"\204%i\255O\027\332\373X\301\315L\354k}z\320\236\207\noZ\353"
+	.ascii	"\323\317~\307\"\366\333\027\n<\373\236E\344C\261&&\026\317\331"
+	.ascii	"\353,\242Le^\t\224\333\225\213(\343\227\224\"r[r\021e\372Dx\334"
+	.ascii	"\206\224)\203\324Z\237\262lkY\304\020\216%\026\267\031A\3509"
+	.ascii	"\242\234"
+	.ascii	"\330\327\372\224\270\255\270\210l\250\350\201\341\366\341\"6"
+	.ascii	"Z\221&\246\021\203\333\204\213\270\301a\322K\007\255\353\272"
+	.ascii	"^\331\016L\261\250lWA\231\376\266\247\334G\337\266\224f~Z\223"
+	.ascii	"\004i\255O\353\tNw[o{o\021\227\353\232\303M\3146*\2478\273\210"
+	.ascii	"\334s\247?\261\257u]Op\272\333y\273\213\330W\024\233\230\326"
+	.ascii	"5\207\233vwwqv\021;h]\327u=\301\351\023\217\256\222M\271\214"
+	.ascii	"\306/ieZ\220\213kG\356\232\355p\177=\t\021\354K\355r\177=\t\021"
+	.ascii	"\334\027\331\345@^\025\210\253\360\252?<\311\253\256\357M\367"
+	.ascii	"z\007o\252\327w\274i\335{\3239\017z\323\270\367\246OH\364\246"
+	.ascii	"m$z\323\265\367\246i&zS\260\367\246]\357M\221\2747\305b'\314"
+	.ascii	"\251U\303\361\246Q%z\323\247~\342M\221\336\233\0365\024oj\324"
+	.ascii	"\354M\211\372\2117\375\361\322\233\n\261!/\372\307\210\274\250"
+	.ascii	"\024V\344E\367x\221\027\215\302\215\274\250\035k\341E\321\370"
+	.ascii	"\221\027\r\343H^TI#\361\242]\357E\237=\305\213\032\351'/\n\025"
+	.ascii	"B/J\244\261x\321\247\316\342E\227\336\213*u\021\3367r\023\346"
+	.ascii	"/\276\367\212L\306\374\304\367~o{\217\267\354\375]\337\361\336"
+	.ascii	"\256\341x_\327d\274\247k,\336\317\365\024\357\345\272\b\357\343"
+	.ascii	"\032\211\367p\275\203\367o<\311\373'\034\311{7~\344}\033k\341"
+	.ascii	"=\0337\362~\215\027y\257\306\212\274OcD\336\243\261!\357\235"
+	.ascii	"p \357\317\336\373&\315\3363y\357\315\232\275/{\357\311\232\275"
+	.ascii	"\037{\357\305\232\275\017\023\321\373%\357=X\263\367_\"z\357"
+	.ascii	"\365\336+\211\351}\222\023\275\357\222\351=\227L\357\267D\364"
+	.ascii	"\036\311{\257\025\323\373\254\023\275?\"\323{,\231\336_\211\350"
+	.ascii	"\275\325{_\325\354\375SD\357\251\336{#\315\336O\211\350\275\324"
+	.ascii	"{_\244\331\373(\021\275\207z\357\211\304\364\376\351\275w\212"
+	.ascii	"\351}\323{?$\246\367L\"z/\344\275_\212\351\275\222\210\336'\275"
+	.ascii	"\367H1\275\017\362\336\037\305\364\036\310{o\024\323\373\"\021"
+	.ascii	"\275'z\357\207bz\377CD\357}\274\367B\315\336\367x\357y4{\037"
+	.ascii	"\364\336\003m\357w\274\367?1\275\3679\321\373\036\231\336\363"
+	.ascii	"\310\364~\347\275\327\211\351}\316{\2776{\273\362\275M\331\354"
+	.ascii	"\355\311\367\266d\263\267#\337\333[\232\275\r\331\354\355\307"
+	.ascii	"\367\266\343{[\013\211\336\316\362\336n|o3\222\350\355\305\367"
+	.ascii	"6\226\367\266\"\211\336N|o#\306\364\366\341{\333\260\331\333"
+	.ascii	"\205\357m\302fo\017\276\267\005\233\275\035\370\336\276\022\323"
+	.ascii	"\333V\336\333Ubz\233\312{\0330\246\267\247\274\267\377\232\275"
+	.ascii	"\355\367\336\226\322\354\355\276\3676_\263\267\367\336\333z\315"
+	.ascii	"\336\216\362\336\316\213\351m(&z\033o{\373\316Do\333\275\267"
+	.ascii	"\353\336\333t\357\355\271\367\266\\\263\267\3434\350m\270\367"
+	.ascii	"\366[\263\267\237\274\267\335\232\275\335\366\336fk\366\366\332"
+	.ascii	"{[-\246\267\323bz\033-\246\267\2354{\373\354\275\335\244\331"
+	.ascii	"\333L\336\333f\315\336.{o\223\305\364\366\330{[\254\331\333a"
+	.ascii	"\357\355%1\275\r\366\336\376j\366\266\327{[I\263\267\223\274"
+	.ascii	"\267\273\232\275\315\365\336\336j\3666\022\rz[\353\275\235\325"
+	.ascii	"\354\355#\357m\254\230\336\276zo[5{\273\352\275\375l\3666\325"
+	.ascii	"{\333HLoO\275\267\245bz\273\310{;\252\331\333P\357m\"1\275\375"
+	.ascii	"\364\336v\212\351\355\246\367\366\220\230\336fzo\013i\366\366"
+	.ascii	"\322{[\251\331\333I\357m\244\022\275\035\344\275}\024Bo\003y"
+	.ascii	"o\033\305\364v\321{\233\250\331\333C\357\355\037\315\336\366"
+	.ascii	"\361\336\026j\366v\217\3676\217\230\336\016zo\003\305\364\366"
+	.ascii	"\016\020\275\375\363\336\366\211\351\355\236\3676OLo\357\200"
+	.ascii	"\350m\235\367vN\263\267"
+	.string	"\327\367re\263\227)\337\313\223\315^\226|/G6{y\313{\031\262\331\313\217\357e\307\367\262\226\367r\226\367r\343{\231\361\275\274\370^\306\362^V\004\241\227\023\337\313\210\315^>|/\033\306\364r\341{\231\360\203^\036|/\013\276\227\003=\350\345+\357e+\357\345*\357e*\357e\300\367\362\224\214gG\376;3\326\321\315\301\361\337\331\215\377\234A\256\330\212\277\242K\231\013\231\313\030\226'\366{+by\362\223r\366c)\3470'\220>\276s\237\020\227%._.`7C\234n\210\020Q9e\276\317<m(\365\356\222\244\313\205\213CP\363\373\363\373\203T\324\343(g\275\243}7Q\316\304\346 \2162\271\3102\221\220\177\003hd-yg-R.ZYy\213\351\036\224\247{F\\\256\254\240\330(.2\336y\361\351Buc5\345b\344\006+\353\006\t\022\274\317\fFJi\344\205A"
+	.string	"yw7\\|\367\021;P\032\013\313D\336\301 \207V1\031\263\263R\025K\25382\214\222e\"\301\376^\260\351\262\253;\333\321\235\353\222\270\fa\022\262Dw~\033\264\331\222\213;\313\301\235\343\316^.H7q\374\006\346\022\344&\214\323\366f\314\345\350\246\314\305\310\005\310\r\223\263\03344\225S\206;\277\rF\"As\\\270\3242\227Xx\343\323*\034(\370q\347\341\203\037\327Rq\357\"\033\204\021\271\265\360\306w\221\270\277q-\362\350\211\333\371I\333\331\355\317\345\207\213\220\213\217\0335\266\03377\225Sn{\211gKE\321Jd\241\221\355\314\306j\347\265\224\bs\332Y\355\315%\350&\316e\207\013\320\315\\\335\315\335\235\312)\247}\306q\3611"
+	.string	"zN\316\316N\240\270\364\360\234\34511;3\211\342\222\343\262\232=\305\223l\007<\262\2613\331\371mO\235\274\351\213T%o\374\246\334P\241\242r\312cO\361$s\274\003\314\302\013\303\n\227Z\t\202T@\273\236V\345\200\202\017w\270s\330c\220\262\344\034\246>\252\220-\226\257\366\306\312M`\240\312)/93I\007u\204{#a\001"
+	.string	"\355z#\301\035\355J\342\017f\216H"
+	.string	"\327\216l:\025.\265\013\366u\006k\244Y\252P9T\301AZ~\035\204A2\307\260\016$\365|R\360\241\205\257\227\230\201\250\205iE`8\345\206\302\245\266\235\330"
+	.string	"\203Njq,T\"\334Q\274"
+	.string	"\266\245\237\270\022R\243\247BD8\025:C\235\r:&\001\024z+=A\r\341^b.\362\0236\004\251\2503w\302\245\366\204*\023\322\037O\253HP\0059E:\017\"\234rA!\275\237xa\320A\327u]Y\244?\336O-\324\024\351\351\217\263O\323\016\021\366pW\304u\027\2442\313\204KmJtV\362\032g\203N{3\250*\322\244U\336\036\023q\220`x\336\276\020q\224P\276\342\264\235R\242k\020\001\235Wj\364\206b\016<9\251\2067\204\320N\2739\330\251\2058H)\250\bS\243w\226\240 :]\271)\322\323\243\247h?\224Q\314=\350\222\\\221\214\210R\t\227j\241\366\023\313\360D\204\321$PN\374B\307\005\330\304\314$D\212C"
+	.ascii	"\325\300\026K\325\212z\345\246\360\346\360&\361&Q\345\224\225"
+	.ascii	"\234\235\f.\261\007AG.9\022vX\002T\353\033\306\233,<\216Jz\216"
+	.ascii	"H#\250H\365\236V\341\200\202\377F\301[\003\355\260\303+,[\221"
+	.ascii	"\352\275w\274=\325k \306@N\013\226$]\347$\216\252\237\244\224"
+	.ascii	"\276\256\233xRrm\235\271 U\275"
+	.ascii	"\307(y[\222H\264\316H\356\354\032\353\350\264\256bpK\326\221"
+	.ascii	"sV\034\215\n\301\233H\025\016\207\2109\345P\361\355\311\221\253"
+	.ascii	"\030|\304\272:cM\252l\206kjW7\361\324bUu\266\272\251T\235\320"
+	.ascii	"0\247\034\n\2361Q\233\310\250\272\211,K\270y\370\340\356\301"
+	.ascii	"\334\245\3465T\206\003\324O\206vqTQ\311pr:f\212\225\237\036b"
+	.string	"\352\030\316N\017\316\317\017\220\002^~\260\007+j@\230\220\274\275}\364`\214C\322EEE\nu}Zu\003\n\376\023\f\236P\362d\"\322\235\336\214\272\236'\237\\]\231\2221\220\323\022\366\244:?y\250J\222\\uqQ\341\031\231:\033\021R\265hRP\341\374P\263p\210\230D\207TMbG\260\246\236\342i'U\344,e\244V\3210\211\016\213<\251\212\034\204A\035\350\242\016u\216:\037\036\251R4\\4\304\356k]yP(\202\203\304LC\342\036\241\324\250\033\240\016\302\340\034\240*\204{\345Q\237n\350\200j]y8HLu\302AbN\031\2426\341(\241Bp\206\250Cn\310\341iq\234\324%\034\"0D\f%\233\304\326\225\007\005%$5\251\006\225S&\"\250\245l\210[\207G\264\017\367\016\263\222\037\256?HE\365\b\007\253\r\005\327u\345\240\336\261\213\343\212\n\004'\352\027"
+	.string	"\336\241\221\211\255\353\252\002\247\253\026\251F8RFp\236O\034\253\305\301Z>\025\235\340{\034a\027\300\005s\004\365\303\036&\333\360\216 \031\237\274}z\207=\bj\031\333\301\305&\312\024:ti\341\372\241\005\t\212K-\214\336\tT\311]\252n,N\026\016\022\021Tw;\017\347\234\312O\217\201P\355\201C\3209\267\\\236\241r\312Og\036K)\022\267s\244\bJ\316\221$\360\335\216*I\005\265 95\235\235\370\351\334\364g\371\241\224d\017\202Z\224"
+	.string	"O\\ja\bM\240aO\253l\240\340\267\275\264A\266\235\037W`\002\253\222A\303\316\217mG\303\024\031\035\2070\235\207\250=\\*\317\032\223\252#DrI\351\274T\231$\245\204\303\t[!\250$\231dc\013R\2203\022a\n\331\342\004A\257\364\021\007\314\021\307\016'l\205\240"
+	.ascii	"TN9\310O\030\244kL\263\b`\f\247\254L\345\224\217\276\002\222"
+	.ascii	"=\b2\236\205\243\016\234\tE Fg LR,zF\211ER\210\206\316Dg\251"
+	.ascii	"\341\337\020\341\217\2370\310\307>\204\316>\320\322@\233+BVz"
+	.ascii	"\034\205\247\036\217\2403\017\265\024\3200\350\017(o\307\317"
+	.ascii	"y\007[\332\267\370\263\347\203\327\303s\356qK\363p\036q\356\226"
+	.ascii	"<g\222\341\355\374\204\301$\017k\214w%.\265\314*\020P\264\247"
+	.ascii	"U\037\240\340\263\261A\262\235\265\204\200\242\235\265\260\035"
+	.ascii	"E\223c,\323\341\234\263\316\371\3200\255k\361\002\325\342\274"
+	.ascii	"\245t8qK5\034J\234\273\0248\347/<\351\344x}\n\203I\214s ha\031"
+	.ascii	"\236\034\031\035\263A\246\303y\035s\351\033\217\323\r\347'\f"
+	.ascii	"&\211\335\330\374\346\374\206S\227\256\2519\203p\356\2261\250"
+	.ascii	"\234\332\234I\226:I\321b\200\202\023\005'\212\312i\315O\030L"
+	.ascii	"b\f\263c\031F\260\277\017\272r\340x\216\275\224\211\031\216\247"
+	.ascii	"x\222\331\330\332A\207\357p~\353K\307h\226\353\312\203\302\246"
+	.ascii	"a\251\030\216\037\316\024\034*TTNux\212'\031\032/\031\265\212"
+	.ascii	"xa\360\300\306\0227i-\347&\374\307~,e\352G\311\314\213\233\361"
+	.ascii	"\255%\375\342\033oF\300)\\Y\371\347\\W\277\033g)Vn\234\225\222"
+	.ascii	"l\324\270\215\264\013\247\306\231IA\322@\3604\215\367X\217\243"
+	.ascii	"L\251)=\261\327A\360m\037-S\034\202\263\327W\240\202\322\307"
+	.ascii	"/mD\200|\314Gj\222BV\030\327\216\\t\212y\217G\260^\b\316Q\006"
+	.ascii	"Cp\026b\003\b\227=\207s\331\267\203\026u\216`\245WRi\026\323"
+	.ascii	"<\007\236\223C\301po!\250)\rA*\352t\344\322\234\306i"
+	.string	"\216\366\005\365.\316!Nbs\020\215s\330\323\016\243\321\034\3130\022\221\220\\vV\252\220=Xf\021\313\b\276\264\253g<\355\332t*5\342,[\276Z\034,8\2148\214*\2473\316L\322\303\341\206\343\300=\275\213\343\210\003\331\034t\303wx\332Y\254\003\204c\231\3052\0215\226\330P\303m8\323\360\032^8F\235\3414\234\337|\226\354D\246ON\247\031A'\347N\t\252\246\031>3\370\365\001\031\377@\214\313\230L\205,)\305\250\241\004\306\213\303p\361\0278\225i\020\247\323\fUNz\344\334\tA05J\2018{~\234@@*\247.>\363$[L\342\266\310\365\227\323\223\033\342RKA\033\b\324\356iU\r\024\374\265\363\330{\240\305=\340\344\221\022\265X\246?\322!\247\320\017'\021\221\312i\213\253x\222\241\216k\347\306\016\354\316\215kG\355\\\376\026\225:\300\201w\340|\270\201s"
+	.ascii	"1\345\221\002\245AN\243#'\022\222\312\351\006^\"\013\263\017"
+	.ascii	"5\"\271\203\270\3242\t7@\243<\335\022\202\345\301\310)\021\224"
+	.ascii	"\332y\221\273#w\305\334\2222\016\320(\347Ef\031\365jG\243(&\226"
+	.ascii	"\001n\300\242"
+	.string	"5\360\f\\\003\347C\033\215\201\357:\2058\2074\007e\340#x\236\263\0278\006\376I\013\374\002g\3054\307\351\264D+\323\325I$\312)%\245rj\201\267 \230\270\007\270v\344\202\310J\322\027##\264\205\251i=\324\322\330\365Zb\235\004\222p>\315K\351Pe8_9#4\202F\352XA\205nq\3429\2373\202\353\272r\001TNe\370\212\347\004\036\201S\340\354\323\265\323\225;\202wO\225\300'p\366\331R\273\004\236\366\331\200\345\314j\016\212\300m\230\221\331G\332\344\332W;T4\270\3242\3652@\367\236\022\322\240\340\247\245aI;+~\330;+\246\035\335\363\332\303\302h\035\004\316{\213h\026g\231\nA$h\243\363\314\004\325\"\312\350\344J\342\364\362R9\205\300U\fb\001\313\200\346\002T\312SB\020\240\340\243\241%\242\235\0211\220rFD;*\005\311\003\356\200?\240\001w"
+	.string	"\214>\332w\235a\316\261\346\240\006\234\221\022\271.\270\3242\b^d\231z\036\320\277\247\204\025\240\340;\231\341;y\f\204\207N\316\206\031\034\351)Z\200\376\235\r\235\034\375C\005\021\205\244H\016\031\255[\300S$\nx\002\276\200\263\317\222\235\256\334\337]\001W\255hA\017\235e,\250\326uUa\327\311\0045t\236\231\240*L\300Y<\351\016\331\2025\304!\200kG~\315v\230\002\305\"@<\\j\233\002f\032\225\013\231\207\244a\201\233"
+	.string	"e\032\365w\347ax\210(\344\356L\310#t:\022\255\340R\275f;\334t{G(x\221\225mT\004\234\021\317\244\360\364\226\335u\242\241Wlfv\235j\250\025'\233\t\301u]\251\240U\234no\316\2708\225S\004|f\220L\247+\227\013\331\203 \242\322\233\260\f\242\321\0047PJV\300OJ_\344\001^\001\224\214##\017`\200\037\200\317"
+	.string	"[\n@\200\027\200"
+	.string	"\2171\304\240e"
+	.string	"\002\370"
+	.string	"`x\313"
+	.string	"\n$`\002\3512\300"
+	.ascii	"\024\030@\2724\250\300Qc\005\216\032\027\340\340\"\207\0335j"
+	.ascii	"\320\201\203\245A\205\214\031\\\334\300\201F\207\0256lt@\303"
+	.ascii	"\215\031j|\340E\016\023\250Ac\203\206\214"
+	.string	"\t\300\210\341B\203\0322n\310\230\221\306\250\241c$"
+	.string	"\007\315"
+	.string	"d\350P\303\r\030.`d\334p\021\243\206\0304\\\300`\342\220\021\203F\002p\320\274\270AC\306\214\0336r\260!\206\013\0212f\240\341B\0026\304p\261\\\032T\330\300\201\246\306\r\03240Z\300\250\261\002\306\007@\340\220\021\203F\r-T\030.f\034\007\315\213\303`\0318\270\200a#\255\201i\310`\200\214\031.h\270\3200C\r4\240;\320\340\360\245A\205\r\032n\270\230\261\202\006\315\214\031406\2701\303\305i\030\300\206\r\0310hj@\340\206\r\032\b\200\300\306\214\nn\330\210\3615\001\005"
+	.string	"\240\360\202\004\026,TX"
+	.ascii	"\201\t4 \306\f\030\352\302P\001\002\0333Z\300\370\300\n\030\037"
+	.ascii	"XA\243\006\0273V\300\250ac\205\n\r\226\006\0042j\254\270ACSc"
+	.ascii	"\005\314\356\256\231\016\277\310\342\020\305O-.e\326\2412\032"
+	.ascii	"/%\243\364\251\3055*\311\307;\336\373;\333P\276\236\230\266l"
+	.ascii	"\330\034g9\320@\020\\W\035\016Z\230\255\034\250r\250M \370\311"
+	.ascii	"\240 [^\327S2\253!\0075\265b\266\255$B\370\304\026\327\037\r"
+	.ascii	"MM\230\374M\330`"
+	.string	"\262h`\216\234\311S0\231\225\375fn0V40O\230\252\034o9\342r\314\345\230S9}\331g\006\311\226\310\306~\262:\230)\032\030\251\261\257\030\334J\022\233a\253H,\354\027\273\203\201\n\n{Z\2625\004\366\257\037\f\n\314\220\026C_B\274>C\251$\311\257\244\353O\302\325\265\365sE\201\t\262qL[0@\220\334\205\301$I\255\254_\353\310\237\205u\344iy\365c\345\330\203\371\261qTWBVwa\313\243\226\306\252\347_\325\007\363s\344\331C\265hd\3527\342\007\243\3235\005\263J)\026y\324_d\312\313d\213%Q\221P\237\031\344\323\313\312\313\202\002\306'\262\356\376> G\344\351'B\345\245\221\361\351&\006\311\310\234\232~'+/\212\211M71H&6\204\351\037\022\370b\270\306D(\344*\236IK\226\224\376\245\301\227@8%+IW\361L\372B\n\362#\025\276"
+	.ascii	"N\tr\023\203dJ\216\200\374G\207/Rn\372\372\200\334\304 Y\227"
+	.ascii	"Q\321o\224\370\242\307W\224Gt\025\317\244\254\255\241\037\377"
+	.ascii	"\320\371-\007\226\227;\033\307\034\2008a\377q&\331K\235\217\253"
+	.ascii	"x&i\t\365\370\205\030_\344h\342z\334DV\223\022\031YI\347\361"
+	.ascii	"\240\237G\216,/O\334\332\036"
+	.string	"\224\025\344@;~\240\034\216/j9 \323\276\343&\236YC\377\271\317\377\363\236\337\347\357\273N\237\347\2739&sT\252\034\364\236o\034\257\255\273\023\360\254\253\316\007\337\371y\216\036\372l\345\2740\251\3311\373\316Y\270\316\237\363\353\364\274\214\335\364\251\020\024\253\021JA\025\366\234\253\030\224\374Z\371\257?/_^J*\267PN\276)\201^\270hT\324\360x\331\252\0212!\250F\276 \231d;\022\343R\273\222\221o\311\363\341\217\227#W/X5DF5G]\023\371\024\203\215[ \337[\316\207H/O*\310\317,\302\270\324\256\024\324\211\007\217\364\275\240Q\373\3615j\224^\242h\240\036\017bP\217\313\205\235c\272\366v\314\362t\255F\310\213S\r\221\227\246,OA\327\215,\366n|A\342^<\213\ry\021\342b\364\262\370\025rX\332\336X\316h\354\341mL\355\304\247mN/Aj\210"
+	.ascii	"y9\252\211\222\2521b$\361&\310\006=\360\205x\370F|\276\020\275"
+	.ascii	"\f\035~fP\211a\341\333\320\352E\250Ga\027\341\340\233\020\353"
+	.ascii	"\005h\307\340\221-\301\007\276\005\263^zh^v^xj\220p\325$I\022"
+	.ascii	"x\025O\255+-\216,]\271\342\365\262VZI\252B\345]\005\214)\031"
+	.ascii	"I\345H\220\006\354)o\300\2320\346#S\013\323\261f\254\254\206"
+	.ascii	"\t\023\225\323\236\362\231#@\250\360\302\320\001\3126?9\310E"
+	.ascii	"->a\345\305\001\253\255\036+',>aE\264\001\311\232\263\233,<\221"
+	.ascii	"F\370D\025\244\006\032\025\245\360\365\354U\361\211\252\261\277"
+	.ascii	"\fT}\325\240\261Uy51\243\361K[\335\023\244\"\006.\265\314%\013"
+	.ascii	"\244uO\253f\240\340\333\235\207\023\337\256\361\030u\264{\337"
+	.ascii	"] \255{\337\331=\255c\233\362k\013\\j\367\317\357\375\247\306"
+	.ascii	"$\034\024\f\36432$\245\357-\205\215Y\205\n\340\224>J\276\275"
+	.ascii	"7\237\033SJ\037\337\336\236\244^\224\267\336\371\360\215\231"
+	.ascii	"G\343\002\025\224\232=\026\004\361j\374TP\335E\271\013[\362\240"
+	.ascii	"\274\363\316\207?\224:qL\272\233>\027\004\347j\366Z\240\222\253"
+	.ascii	"\361S!\030\007\345.L=\246`xH\324\306{\n\346V\023\305\205\266"
+	.ascii	"\232=\026\330j\374T\254\341\335\205\347\340\224#\340:\225\245"
+	.ascii	"\002@\020\231\330\246\030\001\327 9Xd\270\324\242\222\334wg\250"
+	.ascii	"3B(\335v\337\255\251\253\271k\016\352\273\313\360\304S\003\205"
+	.ascii	"\211V\023\205\325\250vq\3401\235\324\3541\232\340\272\362\250"
+	.ascii	"\300\351nM\037\363\254\306\017\005&\314&5S\250\324X\261\242r"
+	.ascii	"\332vg5<\36608\205e)\220\207g\207*\325\035U\222b\212\205\325"
+	.ascii	"\311q"
+	.string	"\025\272s\025#\314//:2\254\236{\212\365dv1\271\346\246\304\344\342\336rO\246\0263+n\352\253\341\032\356#v\272\336\236\274\337\230U\314\347\223\233\320J\232\300\022\352\304\3134R\023\330\034\264#0\247j\006\247\222\216$0U\344\326\366v\253)dB1\211\264\275\304\223m\212\bp\345\205!\002\017H\243\236V\321@\301\257c\353\2657\033\323\211\331\264\326qp\020H\243\336puO\243\246D1\252u\332[-Ed\033\265\321\336i1l\243\266\2237Z\237\275\235\034\265r\310L\242a\017\200j\206wHA\316\316j\317:\2546'-\273:\036\021\245\245\2334\223w\223\232D\246\021\r\005Ej\202u\2738\362\230E5X~\301\024D72\346\020\223\250\206\261&K\215c\r\244\312i39\013s\334q\314NANO\220\212t\354aRm\t\026$c\335{\216G\350\304\261\207\301\250,\373"
+	.ascii	">\263\262\267Y$S\250G\231\036\331\330\233\254f\222\t\264c,OL"
+	.ascii	"\254\246\222\331\303\344\t\373\314\023o\t\330{I\0163\347\246"
+	.ascii	"\217\271\202}f\320\356\313\353\375\265\263\234\224\364\372\f"
+	.ascii	"\235\022%=KH\307\345\243\315\017\220\r\017\036*\247\235\3443"
+	.ascii	"\317(\271\023q@\324\222.\256w\227\320\262\221\206\221\353%\236"
+	.ascii	"_[H\336[?\226\212\211H\224\264\326\211\226\2066F\205Z]YG\336"
+	.ascii	"YGKA\232\300#/\361\334\302\272zc!-\253P\271\322\262\252z[)-\377"
+	.ascii	"h\374\252^\342\331\364\244z?\205,\371\366\250\230\214L\275\215"
+	.ascii	"\fY\346A\231Z\222*\362\226rZ\332\325\025y\211\250\244(\250w\024"
+	.ascii	"\221\245\034M\034\324K<\203\020yz\023\211Z>q{\002\342\324\364"
+	.ascii	"v\222Z\256\2515\365\020\246\367\020#K'7}gL/1\0305$d\351-\344"
+	.ascii	"\2714#[\226\331Xa\331de-\275\304\223r\262\001\217JIo%$\3130\032"
+	.ascii	"\260\345\022\033\256$6^^*\247\235t\023Z\2660@\021)}z#q\251\035"
+	.ascii	"\344\351\023\3302\211MXW\020)}\204\022y\037%Q\033\310Q\"6cK-"
+	.ascii	"\233\262, |m\324Eo"
+	.ascii	"\243\345\325M\237U\321g\236zDCo\"&K*#Cy?|\274\177\234-\213D\371"
+	.ascii	"x\n<\241\367x\013\235\337\320\226O4K\247\036O\301\204\262+\344"
+	.ascii	"\205a\001\fE\306#\350\315\343\374\246\266d\272\351\023\022\364"
+	.ascii	"\024\276\200v\274\201~\336;\330\226IA\226H6no6qq*\247\375\363"
+	.ascii	"\024\224\254\034\357\235\272\344a$\026P\333\r\252\311\247\347"
+	.ascii	"\355s~\233[\372\270\351\023\352Yj\236\336y\363\264\316{\347\374"
+	.ascii	"C\251cS\267\\\356X\002\331\334A\261\211\022E\345\264u~\302 \031"
+	.ascii	"TR\020u\007\003Qy\357T6(#\246Q\373\t\267x\202\032B\211\370\215"
+	.ascii	"=\254UN\266c%\243\002.\265\022lA@\nN\253\016\300cO\367\030\006"
+	.ascii	"\3138\255\203:\335\233\354\245\355\360+\001)\270\311x\304\207"
+	.ascii	"\307J\257\316\351\365\235\263\347R\251\325F9\331\353\232\031"
+	.ascii	"\333Z^%\345\271\262\317e\313\325\032\344#e\232\226Z\032\336\244"
+	.ascii	"\344y\322\306\317%\013\215\004X*\251\232\304\322vS\2704\332L"
+	.ascii	"\271\20798\266'.\213.\2146T\326\212\215\315\240\312)K>\205A2"
+	.ascii	"'\334M\230\235~&\237 \025\035\241\320\330\203\243\317\222)$\214"
+	.ascii	"\253\023\036\241c\207B.\362[\316\221\347\303\024.\2104KC\227"
+	.ascii	"C\233B\324\346\320&"
+	.string	"Q\265\331r\024\236td)\357\235*X\031\006\3104j3\341\035\232\260\007\301J0\0044Y\227\351P\242\243k\255\022\250R\310\001\n\200>=\255\332\001\005\177n\356\f\371x\206\274b\203\345fG}<2\367\3062\300\323\033k\356\350\323\021F\rl\261\350\364\211\372\364I\330\022\260\241\357]\315\362\357\215\211\205-\311\362\006Sw07\236\263<}\363\331\332\351J\306\306\263\360,\342\346b4\f\204s+\351$\335\305\315\305|\245\006\271vp\020\260\274\203\376j\257V\322I\030\313{m\2624\227\263\f\313S\f\352\030RT\244\004\\\273\273\232\313\0062\361\2736\2216\223K\347\304\310\245w\026\237\313\236\336\315\017\324\246\362\306H]z\344r,\300\245\226\202\252\030P#O\253t@\301\227\223;#\036\236\021]\240\270\344\321\24097;\352\316\241\021\271\367\024\024\001\214\274\247\344\216\0321\302\032\310Q\202q"
+	.string	"]W\250\027\332\212Y\261IWn\212f\264\276b4\214\001\317htsr\334W\314F\324\262h\031\236\001M\250e\3212,<\033\036\235\274\351\351+\033.|\nO2<BB\247\235d7V_\335"
+	.string	"-y\360\2737<n\204P\250\363\240 \345\034 \n\365~\262\006\236\244\270\270\321\234\340\302\346\322v\363\003%\2721R\215TNQ\250\177\030t\222]\261\007A\312\261\030\234Z\202i\334Y\360\214\306\036*YG\230\312W\236\306\365\356\r\322\215\322\2253R\323\033\007\236\337\360\356\354\260\260\225s S9[\311\203\222~1\343\361\b\276\243r\266\263B\305\231\224\316\261\343\323\271987,Z\001\212\267\250\304b\027\215K\35749\312:\207\fL\ra\020\202\004\223\031"
+	.string	"\fD\322<\217\303\226z\024\200\nI\214l\226d@\230\017c \003\261,S\001"
+	.string	"\2001! "
+	.string	"\021t"
+	.string	"@\004\272\301\243\033\307M\022\373\210zv\213AOw\351)\342\254\027\235\r\364\n\271\365\312\033\373\373\261\270\340\254\335R\346\265\250\273\2126\210\302+\016_\3405V\325zoh\02273\230s\\w`(\263\346q\002\365h+\304\203>|\302\304/\262\207;\317\251D\217\335\2610\tPfF\322\241\0333\337h\242\3021\210\217z\263(\207\005hD\352\317\262\020\225\334\272\034\206\203\241\227\201\311\215Y[\343\221\321\330$5\253\021n?\006\230\234+\222z\007UY\033\277\037\311\211\334f\344\311\313=\275\032+\003f\256\244{\026\313\217)S\302x\237I\022N#\315O3\314f\353\037\305\320\253\030\350'zKb2.\362\373\253\365\177\300\352\243\347\354BI|\274\035\335\331b\354\322\352\347(G}\244]rS1\216m\311\035\373|\206\315W+\241\322\213\006\333T\327]\3402H\275\204\006\233\256\357\241\023\314"
+	.ascii	"\256\024\274\016\311\230f\223\320\035\345\341\261\001\322\203"
+	.ascii	"O84^y\252\217\314`[\022\255\354\037\326\307\215Sz\013\272\374"
+	.ascii	"\301\314\271&Wx\273\352\221\353\025\217_Mv\244$\037\341w\021"
+	.ascii	"\270\n\247\237\242O\3312\355\301/\"-\270\fEK\244Tf<-\354\257"
+	.ascii	"C8\263\363\355\324\t\n\255\317P\330\332\305\373d\020\300\367"
+	.ascii	"\251\300\272\266\364+\323\207\352\216\204\\o[\313\270\032\001"
+	.ascii	"\211u\332\264\021\213Q@+M\027\030\321a\264\377&\"\004\365\235"
+	.ascii	"\370\266\321\255A$AYn\310R\266\250\202{Hq\2239\206\317.\252\342"
+	.ascii	"\002\331b"
+	.string	"m\260\206r\200\232#M\205-9\374O\r\3716\203<\321m\312\350\nb%\356\311\235\352\306K6\261je\212dMi\317#w\305\201|\033s]\237\306a\233\232\314s\356\335\026!g\2066\300\211L\344\273i\026n\235x\267I\306\204\313-x'\240\255\317\201\031\326s:@\364\325F\271\337mG@\016\231\036*<\254D\260u\202<\367\304}^\254\214X\267\002\003\321\247\016\234\025\3039\001\242l\200kr\003\226\344c\316)\034t\213\021\271\036\361h?\262\222k\237r\b\371\\\231\365d\354\b\262\305\334\311\207\303\216\323v\214]/\254\030\264\267\030\335\327U\031\rw<N.\020.\034c\003\317\256\301\035Y\313\301\311\\\240!\216^\211u\246\327Xli\236<\356\370\212,>\021\364|\021\352A,\301*4\226\267d\352\246\253\325\276\264\037Fc\211\372_}\214[$5\317\312\034\376K\201\234\253\233"
+	.ascii	"tL\271\n\377\327P\361>c0\372\023%m\365\337\016U\256\263=:\233"
+	.ascii	"\336\021[k\300\343\367\216/P\345(\240\032\373\245\376|\\i\253"
+	.ascii	"\213\252\002\306\336C\306\032!/\007\277\371C\026b#\005t,\327"
+	.ascii	"u\033\211Cs\240\335\232\231\200"
+	.string	"`R\276\032}\252\376\021\270N\324\247\270\331m\033\342\322\275\242\247L\351\257T\001\364\265\260\274\013c9\303\0036d(\020\346\204\226@\310\365\2428h\024\f\0235\241L\327\200N\034t3\322\243\341\343\212\220M\0277p\214\373\2561\334\245\023\212\027\020\267\301\037bc\371\033H\344\347\355'\363\025)\177>JY!s\223w\201i\314\027\376\217\t\323:\256@K_\205\231\371\253e,=Y\002\0052G-\231U\360\372cca\032\301\273\253\025\202\225n\305\001W\304\002\020\327\327\001lT\343\340tX\244\300@T\323\361?.\314\251\245\260\246=\2106\360\"\302\257\245\230\035\263\261}\370\r\025\354(r.mgq\217a+\"\201\277\256\214_\n\347\002\374\266\223\025\305\364\310\311o\335`5<\351\322 \005\017\245\232aU\002&\200\336\2273\273G@(M\264,\347\032\265^\n\205\231\243\275\006\211\306H\026"
+	.ascii	"\002\023\360\301\261\261M\035I+\343]\353e\356\212`\244\241\234"
+	.ascii	"j\317\363h\315\344\tr\211\300\\)\327\335uM\036p\304\027.h\222"
+	.ascii	"\tQ1~\235%qs\360\225Q\207\337T\n\350\214NLo\212\312\363\355\356"
+	.ascii	"\232\253\263\037\022[\033<\334w\\h\2347/|\333q1\307\360\375f"
+	.ascii	"\255\202\251fY6\234\203\032\033na\256KW\005\317@\317m\013?\373"
+	.ascii	"\020\362\234|p-"
+	.string	"e\213j\300\347\026\306\346\3237\267\321\356\274\033\025\237\023h\264e\306\273\365wW\360\201)\242p{\225\277\201W,\264\002\231\276\326\022\003\335\300t\232"
+	.string	"\235\202\337Va\311\345\257\306\235\313'u \377R\021\360\020s\226an#\270\226\007\246,%\226\232\373\221\244\216~i\312\016;-\263J\332\235\371\370\303\030\256\277#\314"
+	.string	"\312[D\324\3573er\203\365\301\347L\201\034\027\366\266\305\\(\350\206\206\2158\353\020:\341\0370\rZ\2101\266\303\034\304\354\3365\273\211\357\251\202\325\265\037h\nX\205\r\272\264'\366\024\211A\244z\031\316\350\256#\250\237l\350p\214S\324\247\271Q\304\350T\214\320Uw\354(\226Z\334\363\223\367/\342\2340*\300m\214|\023[\331\217\"7\322\231\247\326\035\347\310\301\300\347\305\222<\240\262\217\367h\037\r|\n\215\267\321|\364\206J\342_\343\362\f\356\303\350\243\230\210(\351\222\307\270\206\017FN\245%)\203\030H)\343\030,L\376#\t\331'I\347\320\006\227<o\r40\353a\177\022+.\232\316\311\333\305\354\313\301b\216\372{\210\327\271"
+	.ascii	"R\367\321gD\310d&\026\251DO<\267\247`_\232\246\327&0E\036\345"
+	.ascii	"\340&0\377\031\367\270j\024\237\f\037\254f\201x;\375U\342\344"
+	.ascii	"\242(L$\020s\n\2652W\024\206\364\210\342\007\277\215\207\222"
+	.ascii	"F\360\372\251\305\032\004\272j\256\353\013\343\344\227\226B\206"
+	.ascii	"\b\374j2\343\342\242No5\264g\353\215n1\2333\353Y\261e\225\372"
+	.ascii	"\234\332\222f\365\376D\321\024`0\336\243\372\376\272|\356\312"
+	.ascii	"r_\344\007MK\340]onN\266I\265\372\312\233@\365\202\222\240\341"
+	.ascii	"\262Yq\254\346\344\031\242\306\237\246$t\273\356\211\304G]\347"
+	.ascii	"\022\235\333D\342d~\002{L)\356KQ$E\275\271\326J\340[S\300\013"
+	.ascii	"\235\275\034\013\360f*\b&\377\036\311\223\251\364\367\275\205"
+	.ascii	"\b\263\365\373\314\244\252\276\357\307M7\333rs\023\276L\320\356"
+	.ascii	"\341\276g\022\376\253%\\\006_x-\221rX\242\036A4\265^l4\bZ$\242"
+	.ascii	"A?(\207k\323\017\246\333\372\007\004n\353\311\364\255\376\266"
+	.ascii	"\275\360\024[\261\267-\220\006!\216}\272\033\200\372;\002\034"
+	.ascii	"\\\177\253o#y~\216\261q\036\224\n\b4o\b\235\264\017!\003$\327"
+	.ascii	"\365\342\224\330"
+	.string	"\334\222\220\216U\302\t\303Pl,C \303B|\001\033\351\n\200\363\274\354\201\357$\021\337\252\373A\016\024\260\nBl3\223\212c\222s4\254\344a\303\026\276Z \253\355\231\264\301\227\3526\016|p\025%D\306\304\013\024hY\371 d\216\232\372\274C?\337Td\274\311\302\322[\235[\301\247\301G\f\244\215\342\016#|\252\177+\371w\205\343\254\273\366\357\243ga\365eD\307\350\250\f\302\263\233\007\"Q\362\036\253\264\n\027\n\370n\300\337s\t\005\210\223\004\314\314\"g\034z\3758\336\274\214p\337\307D\305\357\240\207dj\331\ts$69\317\322J\271\034b$\201\374a\363\026\016\203\312\003\350\236\265`\366\032\2210\270X\246\001\036\320OG~\203\026\206}\t\313\265R\022\354\340\237\361F5^\033\332\341\250\326@\005EQ\255r+\272\276\210L|AFjMG\024Q\306\350@\307f\332=\214\226"
+	.string	"\220k\310\252\030\327*\324\311\236]\323U"
+	.ascii	"q\032\036-\366\365\017\364\305\212B\310w\272\222y,\016)e\242"
+	.ascii	"=\2236o&\364\321\256n\372H\231\263Y\216\245\314\034\275\271\222"
+	.ascii	"\002`\rJ0B\335Aux\330N\311\276\210PX\0343m\035\211\247\371\005"
+	.ascii	"\n\0320l\270~\255a\315!\354\3153\\\310!\030\251!Bd%\235\250\310"
+	.ascii	"\\\356\262A\322\200G\003ks\346\265\2373\212\213\243\244\312\272"
+	.ascii	"+\324\"\035K\376\032EO\226I!<\214\251\323\373\357\235\037\343"
+	.ascii	"f=/\245\035\206\200\250T\356\247\3155\335\334Y\034\231\320\223"
+	.ascii	"4m\213\254\226\225\367\347\304\230\t3$\236\035v\362\250\263B"
+	.ascii	"\336Z\3167\253z\356Nx*\372\256\301\337\314wFG\241@~\362k:G\344"
+	.ascii	"u^u\236\035tJ\235\346\316=\3049~\033j^5E"
+	.string	"\215\322Ju\345\375~J\230\227\312w2\177\215\261!a\361I\337=\230\225m\323\031\233\244\0071\305\371\333v\234C\tu\230\017\205\345\241!\365AU\217\25296\225=\317\030\007\216n2.\244\355\246\212\276\221\004W`\200\274?\254\326\025^Q\n\032hz\223\246/\016-\236\003\n\216m}\373\365A\032!h\004xt\025\316\207y\315\353\026\\z\213\217\257\203{q.\021\246r\017U\274i4\372\244{\253\002q4\314L1\ba\214\202\243vJ\334hN\256\260\017\245\200\241\034\350F\345\rsYb\354T\235\253\366\212E\317\2569CL\r\376\224\211\177R3B\251)\230\016\007\317\234\235#NT\021\262\002\222k\354\026I\250]\3132\2558\254\356j\025#^\265\326Lm\323\223EWWt\317@:\243\365#\231\302\337\206V\312j\375\343\215\217\207\210\206*\360<K{n\223aS\004r\347e\213j"
+	.string	"\313\327/7l\236\260\326GR\360\375:\312\243y\032\204b\205\347U\363ZF#\b\243\262\225\252(\320\202\032\305Sp\332,\034\364@\336yVfk\t3\355\224!&\036\337<\325$\252qPx\235G\371\264\353t/D\260_\351!\210y\330\300\311\335\204\230\237\333\021\237\345\307\253\b\255\033\231\311\256h\215\317P\367"
+	.string	"\326Pm_\315#"
+	.string	"\036\027\337\252\2147Th\\Z\246\334+\342i7\267\234\232\334[s\301\237?\355"
+	.string	"\251[\0079\200A\"\340\004^\0300\375\333\252D"
+	.string	"\210@%\256\226\006\037k\013\270\220\007:r\006\251\325:`C9PR\244\310O\363J\215\251\nz\"\256\205"
+	.string	"\201\2066\260\315\262\232\205<\340^\236/*k\353\256}1\3240\037.\227\227K\330\255\244j\006E\244\302I\301\276n\246\232\335\271;\021\335&MM\370\322\"Q\016\206\362\251\321\246\177W\272\236\363TQ\375R\232\361\253"
+	.string	"\350\341\277\350\022\035\3101m\372\0047d\363}\024\326\2727\311yv\t\220\251\217dXN\241N\234\002K\340UJa~\222\355\237pQ\300C\264#\205\272\240%\003\205G[\246\177\215<d\352\323\r\356\244\324^\3432$\306\327"
+	.string	"-\025e)h\307z\347F\244\024\006\310\005\230f\326(h#\310\3010\224\316\200<\312\351\333Q\220\244\300H\301%\033\246\237ox\256\372\374\2476\225i\003\246\235V\351\201\026i\201\247ot\241=[\377\332o\234WTm\267\367\312\3110t\371a\257\310PL\271\343\347\250\326;F\233Y\233\025\321U$\204\303J\263\3402\343\006\301J\201-c\300/Qp\205?\311\030\2142W\230Lqd\3275o\253k\t\372:\347\017\352\311\350Mp\321\207\320\310O\260\354'\274V\367\225\205{\357\203\352\304GB"
+	.string	".\353\033\003\277\202\377\372P\200\331\205\236\317\351\2512\213qQ~\235\220^0\322 p\260\221P\323\330\003\204\353"
+	.ascii	"\213\323\337(=\345\321\033|\373(\354\335\312#\274=X\334]\312"
+	.ascii	"'\2238.\374mX^\206\305\034\033qD\304=\355\376\307D\324\334\344"
+	.ascii	"\037\003b\325\2466r\215A6\252L\020\025\002\353\030\343y\230\265"
+	.ascii	"\311\226\260\233\037}_p\377%L\256\357^?\343\315Qo"
+	.string	"\363]\003\305\273i.\227\314fB\303\313r\022z\253\361BF4z\247H\3243Xi\310\366fzb\334\245\030\357\247D\333\250\251\024\3231X\005u;\024\365\022\343\250t;^F\254\2153\352]Z\007\242\373\313\227aa\023+$\n\353\005H\264C9l(\340h\250?!\361*\234\250\213V\360\026\330'\254(\366\264\r\f\223\024\212\301\327)\324\365F\236\302"
+	.string	"!\252\\\035%zH0\256 G\325\307Q\357\333\277\036\016p\221i\246\370\315\032\311.<r\301\003+F\317\300q\327\314\231\217N8\361\245\325\231\333\017\330s\260]\336\375\252Xd<\316D\325\007Z\224\350hi\032\316\017\325\377/\321A\246N\365~^\315\203\222\234\262\226t\374\350@)\226?l\216fp\036\276\253>\272\201\271J\374z\254|<\340\347\027\020\246\232\367\367\\\362d7?\350\n\022V\337R\332$Cl\006\246$i\340\371\0031z\227\343F\312\212\272\b'l6@\251\3318A\277Z#)hw[x\210~\b\200\207\340\323\t<\240\277\037\203\376\201\034(\375XL\t \354\2711\350\025\026\342\347z\332\370u\022\017\005\223\256\340l;\265\346\226\314\234\245\203\324h1\301u\214\363\324\245\341"
+	.string	"\273\020Zc8oa\004\026\213\017\305\205\334D-\021\334\302\361S\276\263q\366\377\033\351\235\314\206\210\177\215\232\226\235\227\344\025\022\342\336\221\005H\370\330u\233@<\300\362h\035\253\260\353\206a\037V1t\245\271y\262\212\264\323\364\366/\tA\202\323\354\261x\250\200\217S(\324Y\262\263SL\210{\305-a8Ks\025\b\226\225\2213\035\225\246\036\233YK\3704\252\351\355\005\257ep\327(\346\005PV\241\321+P\361\216o\027yn\346"
+	.ascii	"\360\311M\234x{\333l"
+	.string	"\366^#iY\032\005'\200\333\017\3609\271\327\005\266\317\t\235\310\315l\335\020\274@\262\362\267\322\004\243\177-NT\351\2039p\030c\345\274\211\037\266$r\036\244\016\221x\036\273\252\327\332N\330No\242\232\215\233^\216\324Ld\321d\332@7(2\273\245\276\334\343\353zm!\342\305\221}\341\220\002\204c\273\340A\263gZ]T-\312H\335\315g\306`fYbD~\036\312 \356\227\037\302\004\255\017B\303\226\323\3711\231\236S\0013\237~\320\006\217w\037\350+Zv\303\276\034\004\t2\017\346\td\036\362\b\013\256\247N\274\272\177d\026\034s\022\247\251\254\013\\\376m\321\313%\261\304\336\214\265\241`\323`\320\034~3\nlvr0'\206\016\b\222\271.\220\226\202\321 \177\277^\220\314\364\201>\214uG\\l\030W\301\247M\310\360M\316\002\352$^\013\354?\302b\001\017\372\214\f\024\225\261\022"
+	.string	"\226q\364\351\201\256\252\346\223\206O\341\205\033\034MsB\233\274\323\231\340\355'\334\233\f\215Q\302\177\255\321\035~\307\247\325\222\301\377\374"
+	.string	"N+g4w\324\322\333(X\251 \353T\361c`Sk\337Pn\252\025S?\337\027p/8\357\360\256\021\301\345a6\tK`\340\350\027r?=h\357\253\225\253\3408pO\312dwb4\252\363\274U\264\246\335|\330\266Q\320o\277\241\244\270\215i\300\217\220\332J\007\024v\255w\245u\373^\216\364\373\264/\211s\262(@\022g\312\226HT]G\213\201\350J\260\241\213\020\244K6\373^\234{\322\204\262o\206//D!\\\262\237\301\246\334\334\370\241\032`\037\357L.\221\304\374\2702\207 \357\030\013\203\003y5\240\363\271\262\324\032\0359\244\3352.\017<\202\230\177\260\026`)e\307>\340\3718\006\227h\310\201\302\373nP\347Ej6k\310\261\316\177\236\367\200\2549\351\026N*\025\003\025\2050\232\315\024\316!\274\026S~1\001\225\252%1\363\302r\325\211\020$\003\226\310\202p5\026\204~"
+	.string	"J\205\360\331;\337\307\342\365\336\367\320\177\340[\265\215\366\207' \023=b\311\232\310\227ny\f\222\230d\225B)\246gA\326dK\200X\004\270\351\013\371\007\376\003QHsy4\001\274=\341-\332\235B\201\367)\337\3074\037\203,&#\032.\026 \254\363\337>\3231\002\320@1\261u\2030,\016\3619\252\016\212\203\337bk"
+	.ascii	"\376_\304\267^\215.\362\351J\f\344\315\2510\210\202\363@\315"
+	.ascii	"R\255\221;\013\226v\320\333\241\2006\202\275`\304v\362\021\203"
+	.ascii	"\354\004],x\375a\2324\352[o\360z\236H\307\300\350t\335\365\244"
+	.ascii	"\337\230\325\374m\310\203l\001#\306\203\021\351\370\325\373\213"
+	.ascii	"\303\216j\363cr;\210\324\201:\2335\373\327\006\016\036\321\346"
+	.ascii	"\241`\356\271\375\006t\314\353\216\367:@;0\246\007&/\003\337"
+	.ascii	"\202\273 \266\337\346s\266'\367Q\3114\330OM\367\340\301\312{"
+	.ascii	"\236\303%\227Q\273\251!Z\211\270j\305\224\373\336\205\273\222"
+	.ascii	"\374\017\277\357\351\244\374\374\263\023\343\350\326\016K\233"
+	.ascii	"x\016\233H\336\305:T\364\352\033L\242y0#z\t+\003\214Ec3\326\370"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mspFcTaskHistogramCommand.153.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\265\005=\""
+	.string	"&\277\333K\220\026R:\201\313Y\003\227\0010:\377\221\261}\336\203\341\246nC\022\033\323\337r\214\367`\247?\034\272\265\215\026woN[i\350\305x\313\221 "
+	.string	"O$\223\212\257\331\004\236\340\321\232}\271\262\340@\267\377\246\365\204\020B\344N2\313"
+	.string	"\275"
+	.string	"\303"
+	.ascii	"H\250f\331\330\275K\233\243la\355%E\2550\220\273E\251#\316z\264"
+	.ascii	"W\254\261\226\371CND\350\313\025\327\335\333\024e\353\336%\003"
+	.ascii	"V\260\036\345\345z\345\203\b\361P\247\210\230l\320\354:\242*"
+	.ascii	"\273\367\362v\037\220\036=\037 =\3327j\234\373\271<\253=\274"
+	.ascii	"\255\306\262\252)z\266\035\362\207n\223\241u\004?\222b\330\032"
+	.ascii	"\002\033I\245\263h\375l\232\371`J*}=\373\253\213\351`I"
+	.string	"0\316\n4n0y\226\221U}\274x\372\254\243NQ\244\030\221/\216\236\007\232j\230\335\220E\347\316\313\311\321y\242\214\367\231\340\bm\307\rY<a\312\206\222\374\352\366\210$\262V\315\271\367\2625\"\223\347\2263\263\0313\3770\243\027\002P`\327\2361/\207l;1\237\303t\030\371\342nb\236\221\371\324y\367\252s\314\227?\314\255\316/\217\372\t\260e\335\231\347\334\261\3168\324\362m\265\354\322\226[T\3136\325r\r\265\274\256\226\325\266\234\252\226Q\325\362\231Zn\324\262E-?A\001\"O\311\213\035\271\267E\332\225\353\004M\302\343\314\037\353\237\372\253~\253\367\266\264\330\326Cr^\253\fM\263\036\275e\r\337\b?\213m=\252\232c1\327o\362\036\251\254)6v\357\365Y\217Zf!>\325\213\374\212m\275\031\017$\b\335*\305\257\321\rzj6\307xpT\005\345\020!\3514\241\364\360"
+	.string	"U\303<\025\224\273`\367\001}#\032M\246\364\0023`\327\346\320A\355\265\317<B\343w\001?\254O\374\240\364\250\332?*\241\035\323i\337\b\312\236\275\322\263\321\276\321\017\"\233\306\270>\033}r\245lv\177M\021B\226\266\023\316\322\263~\002a\242Qz\305\364\253\004\330nf\020!\354\2151\275+v\243\314+\273rg\256\364\312%:k\033\246\231E\364\354\215\274+\352!~i\333?B#\3324\246Qr\305\260\210JBoO\221\276\364\216\024\023\032\245\220\227\276\325wD{\306\267\037\t{\343K\007\321(\2258X[0\316v:g-!!\351vb\233\277w\244\232Ek\205m\226@3\227\360\2617\276!,\025{\210\177u\026e=\037\241\241D\260'L\203\301\337\317O\3303\241\363\351\001I"
+	.string	"\t\203=:?@=B\024\276\237\212\037"
+	.string	"\0370\330\fa\002\205\t;\016\"D\270\001 \f\216h\366\335\234\b\372\210\360\361\360|<\274\237\236\236\017\317\007\f\362n\n0\320\211\037\220'\004\002\002\362l\314\314\313\373n\342\333\261\211V\355\037\246.\216^Cz\370a\252\3235\347\020\233\310\306\"\323\035\266\332<\227\323\312\365\2315\231>3\3272Tn.}\343q\261\365\256[\276\344\265\266\345\272\326\250X\025\026\246\026\225]\177jC\b{\343\256\017\3449\224dk;\261\032\226\316t\207\2416\307\365\221\225\034\327\030\302\212\326J\023&\034\347\020\355\331\317{\357Ug\372X\337-8\256g\002g\250!@\004\031b\206JDD$I\n\323\001\300\002\221)\253\007\021`-TRm\222\264\035*\311\377\020~\372\"\034\0316\221\037\314*ni,\364\312\212\017\223\"\250\331E\031\315\233\213\273\253\274\210"
+	.ascii	"D!\216\204\221\376\202\3544\275\255k\231fB;\270\036\353T\302"
+	.ascii	"3\3419E\212I\234\266\254\211\247\005!\363h\211V\032u`\3269\302"
+	.ascii	"\371\276\241v\335_n\304A\302\001\0169:\n\034r,\337O\234\235\232"
+	.ascii	"Zi\\\261?\334\276\303\206\206'A\243\317 \256\313\374L\276h\361"
+	.ascii	"\305\032}\255\273.\020w\t~\371K\245\350\31320\223O\247\373)\021"
+	.ascii	"B\320g\307\250\340\245,\032\230\240,\273:=\\\301\236Kv\363e "
+	.ascii	"~\353\377/\342ky\337A\021\020\252\001"
+	.text
+	.section	.gnu.lto_mspFcSchedulerTraceCommand.154.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`8\005\005 "
+	.string	"\026\272\311I\240VN:\f\207\363i\013\374\251\353MC\302\372C\216m\253\365+\274\216\312\216\273+\212\366\332\243\207P\311\316M\203\277j\030\237\247\335\030U^K\243\321\213d|\3571\271O\036e\013\006\257G\b\343\3727B\310&R&\031\261"
+	.string	"\252"
+	.string	"\267"
+	.string	"\346iMe\241\316K\347CN\304w\255\023\257S\365)\276\220\311 \326ZwN7\202y\2323\352h\f\301<0Ou1t\316\273\017\362,\337O\024\247\251\325\312\fI\255C\006\2133Owx\001\344\251\371"
+	.ascii	"\344\351\372v\267\330<U&\037\262\025QE\316j\255\271\246\2616"
+	.ascii	"\037\207\337\222}7K\222\216\315\276}\0314^\245\215\001"
+	.string	"\203L7\307\362I\352\306\247\260\240\032\201\320\210I\036\006\305\245\216\027'\313\240\260\323+4+\300\340\213S\027\037c\202.\336\267\240\323\230Sk\275\327YE\260\211\271\f\252\265.\003\203S\337\332wW\270\273B\273\264'hk\343\232\336\025a\304\007\276{\204N\315\264?s(8eL\251\234\266;d\342\276\332=\020\026\032q\333j\027Gyq~\376\005\256\365\275\371\360\2579\330\367FygL^\031\312k3ycH\336\032\3455K\336\222\344%I^J\362\216$o\223\274Ly\237\200\300\226\257\251\237y\251U\252\370\245\226\321$8\016\366k\375[\177\327\307\335\353\306t\366_\373\260\265\351\232\200\255\330X\267&\220\331\310Qk\345`\236~\327\267/r\256{\255M\267\243k\351\214L\212X+\022\fB\214\374\210\357[&jY\310\252\210\265\262\250\020av#<\212\004\034V\255\365gw\211\316E\341"
+	.string	"\320i\331\270\032\347\217\213O\272\217\214=\005\311\235\037\354\017\204\277\260\217<f\374lb\200q,\\\020\026\177\202\274i\234^\216\242\372\311\204$;\247i\t\323.\320\273\0302\360\201\233\363\324u\3325*\005\247\222\233\276\326\207\204?N\333\001l\363\025#\377u.\r?f\377\272\327\006\023\270+\324\201\017\274\351!!\324\231EG"
+	.ascii	"\305bq\370%\262{l\252\005\252\252\211\213K\303\273C\036\370\300"
+	.ascii	"n!aS\217\221\373]g1 \227\037\027\367\306\013\301\007r\013q\235"
+	.ascii	";\f\264\310\362\321}\265\f\376&\"\"\305\211\003E\347\355\216"
+	.ascii	"x%H\360zf\217W\224\244t\304+\225\216J \355\350."
+	.string	"\251\327\333\363\343\340\207\250\201\217\017O\215R\357C\357\216gD\317hh\007\"\267\003\221;*\362`\224\333%\365r<\004\026i\004/)\247\204\204\224\224\263\r\353\333jkg\227\262_7\255\211\245\261\326\031\020\336\365{\235\2068\204\213f_m\r\006\211\353\306Bw~k\0257}k\tP\234\030\215\354\326A?N\373Xk\255%\256\017\366\234\005\2775\256\017U5r\235NfdzF\307\253\3104\356\n\021\3076\037\017_\217\230\266\3758\025\037\020\\L\343\256\234?)\265\254\227\371\204\310\230!\300\252u\355\374A1\3136\373`Q\001g\250Q@\005\021b\206&\030\021\221$I\322\001\240\002\031)\263\016\021pMcB\242\024*\303\032\t\352\013K\216Tr\226\320f^\016\026]i#)\001j\202\027\267\370\322\023\310\265\304>\321\212\325\364\372\003\277%\252\006B\211\210\235\003\311\325P\242\340\3753\353"
+	.ascii	"\222\013]s\315\2662os\277\204\365I'\242\260\247\326\360\312\275"
+	.ascii	"\243\257\204\361Y\264\347\rj\247A\233\247\362\203\336\2012\\"
+	.ascii	"\330\t\005';\247\352\276\256\200\316m\211\270Z\032%A\313_&\246"
+	.ascii	"\003\311e\316\333ks\0075\017\bIg@5\235\3742\252C\210R\250\205"
+	.ascii	"\022\333\033]0\3638ET\261\003\361\200\230\330/\252\241J\316\265"
+	.ascii	"\013Bj.\360\265\240O\231\346\f[\200\211\345f\337\306\261\206"
+	.ascii	"[c\376"
+	.text
+	.section	.gnu.lto_mspFcWriteSettingValue.155.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`R\002\305\021"
+	.string	"\006\340rG\320\362&\035\016V\365\201\204\254\255\200C\262\337\307U"
+	.string	"\200\271\021\216\226\355\331P\220L\034A\300\020Qe\310\212-\020@\225\347\241\255\251\347\"W3\330\234U\262\303\251r'\t\032\237\026\364\347r\300 \226l\"eJ\001^"
+	.string	"Y"
+	.string	"["
+	.string	"C\037N`\367g\007\216]\231\002'\340\036-\373\310\366\310\335\300\366\350\317^:\200\263.\224\331PN\221\220\335\365\024\305\277oQ\323\374|\004O3X\314\365\355\351(F\247\037\332\213>\001\310i\006\213\355\\o^\333HPR\n"
+	.ascii	"1\034MT\204\335u\302b:7\352\266]lS\2603D\3665\fC&\353\217\035"
+	.ascii	"\323\251\230\356>\364\243N\364\307\313~M\323\251\351\007 \001"
+	.ascii	"\342C\347M\341."
+	.string	"\210\320i\225b\016\025\266\337\331\025^&\032\214\307\370ND\243\r\330\233\023<\022\270\307\022M%\210\211\246\315\300\301wY\215u\267\207\t\002\367\250\322\303\344i\337\305_|\017\255<\314%8\352rJ\257/\272H\316\020\233\3604[\324\224:sx^\031\372F\240\210\323\370A\035%W>=()H\207\"\3716\022Ih}\214\374\032\177\315\366h$\264k\177\206\355%n\327\365\236\337gg7\204\326gU\217\232\226\334\344\020\253\300\030\217\315&[\346J\005\n,\016\031V:D\226\207\226\226\346\006)\017R,,@A9)0\323\272\240^\235\304\264^TV,\336\212\305\323\320\262\362\342\255dZ\336\t\211abX2\336\f\f\214\214\327\311\366\332\352\217E\300\026J6\372\322vw7\026\0022\2620\254\220q\025h\"\226\3502]^:M\r;\022GW\201#4\005\002w\270\274\242\324\336\0203 "
+	.ascii	"\003\021\252:\006\211S\221\032oX\212\306\210\\(\3056\"0@!\334"
+	.ascii	"\203\226\254\023e\274xe\204\r\032X.>h\2602\3042\254\2478\344"
+	.ascii	"\301R\016\265\313#\013\264\026}o)ys\304}\213\232@\263j\272\334"
+	.ascii	"^\030\206\031p\266\005\3413\243>\226i\263 \030n\260\021D4-!\240"
+	.ascii	"n\350v\335\226\302\335\316\205O"
+	.text
+	.section	.gnu.lto_mspFcReadSettingValue.156.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\n\002\245\020"
+	.string	"\326\037oF\360\320&\035\355\235\201\336\244<d;\266\347\357\232\027\303\332"
+	.string	"c\375\315s\275\2675\371\325\177\365\201\243\310\220hM\245\035cP\255\205\374\300\305\240\034\021\\\361\217B\030m\260:&*1\364h\221\267md\023)S\n^"
+	.string	"U"
+	.string	"["
+	.string	"'\260+\003\264\263\033&0\002\322\243C\222m\337\304O\274\214\022\201%\345\345"
+	.string	"\220\214\026\034\034\273\241\367\361\016\356q\273\001\356QC\034\345\\\3344Q|\3309\0331\322~\266\337\\\002\013\315E\314\005\346\272\242\302u\320\364\214"
+	.ascii	"\340\302\2429\032\331]g\314\345\345\036\3356\006\333\020\354"
+	.ascii	"\254\020\277\b\020\234\261Id\207\260\324\031\373Z\253\325rXe"
+	.ascii	"l\247MNwN\227\036\376\243\333\374\321i\345\322\031\323\027\340"
+	.ascii	"A$\364\362\331\215]\020\265\242\r\212/H\330~\331\235\235\342"
+	.ascii	"\001\331\322^\320\340u\233\023\353nL\321\003\322c*\007$\323>"
+	.ascii	"\212\203\257\207\036\002\001V\031\362\261\204\241\363\023\330"
+	.ascii	"\263\351\214;}\013-%k.\345Hm\326\206|\354JA\266\2420_\007\344"
+	.ascii	"\271\212\037\334\t\202\345\3544=4>\312\302o\2215jV\226\343\257"
+	.ascii	"\370O\270G\0325\273{:\216\355!\322.\3541\266\207~\331\002\t\325"
+	.ascii	"\254lO\217Q?V\222\346\337\004\252\016+\327f\006\"\016D.(\b\t"
+	.ascii	"A\025\370Z.\365\2072q\225\244>\022\357#\3614\254,\224x_\313\345"
+	.ascii	"\241<\3142Q\265<\016,V\313\353l;\334o\2532\356f>\321\244\335"
+	.ascii	"\254\304V\322\337|\302\fF;U\375`[\325#)\252\262\355\356r\003"
+	.ascii	">U>f\372I\361\023\030#\246\226\002' \360\242\031\243c\022\207"
+	.ascii	"`\003\215\347+\375v\213\272\257AKF8H\274u_\r\232\270\020\210"
+	.ascii	"\305^\253\240]\211j \314\022\342\236\222\267#NoA\355\302[[\271"
+	.ascii	"\377 \20731\263\302\2500d'\004\261Aj=\363\312\030\\;z\t\247\310"
+	.ascii	"\310\267\313\304\023"
+	.text
+	.section	.gnu.lto_mspFcSettingInfoCommand.157.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\272\005U\""
+	.string	"\246\376\327F\200\232J:=\352:\3610\004\004\376\366\301Ol'\352\2359\235\003\252\353\306G}\020\265\302\277n\277\035(3_\276\017_\244Uf\0239\206\201a\\\003\026\342~\363\0172\t#\314\2152\253\3156\322\310&R&\031\304"
+	.string	"\263"
+	.string	"\304"
+	.string	"I\314\307a\275\n\353k\0311)\356j%R(Ou88\343\350mw3\377vB\247\236\3650\210\210!\273\253U\f\351t#\224\247\257:A.\242\031\007\345\351\2072G\347\335\037\371\232y6\024\377\325jf\327\244Vb\2025P\236.\361>\344iy\036\362t\315\3350A]5k\tK\232/\2702\265V`\343X\036\233/y$\035\233\315\275\221\220\214p\230\365\362\024#\353b\036\220\027'\307\006kD\320^w\016\033z\215\335\226d\312\203\210\2211\275\334)pQ\301D8|\361\261\305{,P\304\214\024\234!\327\b"
+	.string	"I\227\216\313\235\301\206[\314<\b\265\326e\341p\354\333\373\356\332\330]\016\273T-\373$\202/|+\225qu\326\0368Y\034\213|\334\035\224i\361\231=p\016\317\312gv\211Y\334g\273g:\253\350\3306\333\005\236\356kt\266\277\210\350\304_"
+	.string	"\345\025\nz\334\027\310\307\373Cy}H\336\036\312\313S\362\356P\336_\r\257N\2177\207\362\342\324\360\336\364xm(\257\257\344\255\241\274\275\222\267\244\274<\312K\362x)\311;R\336\246\274Ly\257@(m\311\330\213\305ZW\024\321\324,\364\211\217\323\375o\177\334{\367\301\034G\373\271}\335\372\202hJ\276\304<]\211\327\261z\025;\304\304\270\253\265^(O\207\306\037\356r\353\013\212!y\022\312\356\365\351v'\034\256B\331\003\320\330\264\326\344h\230Q!yMv\225\033\226\"^3(#\215\232\354\021\214W\215-.\252\031\365\351h\0335\333\005\340\261w-`\340\013i\017\355f8\234UYke\032\233"
+	.ascii	"\032[\335\177r\347\220\336\362\245m\216\366\331\366\324\r{4Q"
+	.ascii	"\347\204\r\303\370L\016\324`\273?\203\374\374\321C@\335\375\257"
+	.ascii	"4Z\\\334\2373X\250\213zW\303\006\276\020\251\254\253\263\266"
+	.ascii	"\213\305o\024\222[\250\227\277\310\266\270\270=\274\333\301\003"
+	.ascii	"_\310\035,\333\372\321N\031@\rAk$\352\307}\350\027l\342\013\211"
+	.ascii	"Z\303\345N\027?V\272\234t\237-\202\277A\270]\341b"
+	.string	"3\213\303\002z\003#\256DL=]x\222j\232\2521\361\024b*\212RAME\215NUV\275JL\013\230@(XZJ\332\271\262\n\321\353\224D\302J*\350\004\005t\202\002NE5I\001\235\252\254\200I@KE\342\251\nxEEU\005\364\021\353\333l{\247]\026\255\336\332\023c\2557\036\374\355wm\\L+\373\354+\302\\\324\221\300\336q\004\352\240\006{\024\371\323\022\274 \361\347\016g\246\225B\037\036\246\017\276\360\247\203\332\247\377\323r\n\t\032k\255\225\007<\026\031\324\300\376\030\257\032[T\330\250{L!\346\020\276p\225\312\274z\232\200\024\236\235\346\241\275\003\345\247\323\277\234\326Q\313y\202s\32386}\323/r8\323\210M\017\350\322\304W\323>s\255\346d\033\342^\204s\250a4\345\230R\204Df\002\221\t\2234\215\001\240\002\021)\253n\020@\312h\324f\211\316K\215\026\177"
+	.string	"\236\311.\246B\265h\371\021g\273%\334\"\273?5\271=k\324%\267- \364\\U\333\002\204lh\376\316\375\252&\225|\331\022\250\022\200-\372\376\244\3471>\321\317\265\025"
+	.string	".h\376\304\2552\240}\330"
+	.string	"\2100\026\031\217t?q\217\036\346iF"
+	.string	"\334o/\"\234\001$J\2738R\205\343,\f\251\252\242\\\321\220\004\334\233\020\214{f\217\273"
+	.ascii	"\303\304\377\320$\3716o\224\262\017y\026<\032\220E(\013\340\337"
+	.ascii	"-q\005\2166\352\264\221\002\2734v\320\032\243t\313\350>\n\270"
+	.ascii	"\n\302\330zz\277\312\344\236sb`\272\375\260\261\240\207\004\370"
+	.ascii	"\202hu\206\236\037\312\231R\200\256\234\301\217/\237\226\bM!"
+	.ascii	"T\r"
+	.text
+	.section	.gnu.lto_mspFcSettingValuesCommand.158.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\250\005\355#"
+	.string	"\272@\024\016H\200XN:\261!\017\345\3317\256\005\007\376_\267\243\322\001\267\\\005_\002\240\343\022\204>\352\037\344P\305\230M\f4\236+\246M\303\262\363_\242\321\212v?\r\255\226\342\322\377\202W\331U{i\252\312\264\021K\b\221;\311\313"
+	.string	"\304"
+	.string	"\316"
+	.string	"WR\374\322\352w\275\277d\232tw\367*'\250G\201v\t\013\321\221|\255\370$W\300kw\377e\244I\345\356\336.\005G\031\202z\364\027\270$\246<\223\244\036]\212At\313\374\263\243\025\237v\3429\367\212\3251\271W\271\200\021\250GY\371"
+	.ascii	"\351Q\365:\351Q.2\177\031\240u\215GM4$\033\231{\257\260sp\347"
+	.ascii	"\345\375T\236S[\274O\355\245\350\331\266\310O\3005\267&\215\367"
+	.ascii	"\375\222ZV\025\322\025\303\366N\333\203K\363v]_g\022\024\257"
+	.ascii	"\025H\233\006\361:\372\271O\320\242\242nMz\375t\361>\017\224"
+	.ascii	"\225\221r\223\314:\t\264i\361\370\334\355V\362hmO\351\336\313"
+	.ascii	"vM\2628\323\234\231\323\230y\310\214^\005\3750H<,\233\307@\313"
+	.ascii	"\034bh\277\276?\204\035\231I\236\276\334\201\260\254\031\266"
+	.ascii	"\261;\315<\342\311~\345i\253\260\2546\362\220]\236\335\265f\230"
+	.ascii	"\225F\333c\314G\202A\307\203[\214Y\350o\347\240\247\375?>\207"
+	.ascii	";\367\\\356\314s\345\277\023<\3349G\265\f\244\261\214\243Z\276"
+	.ascii	"I-\333\250\226kR\313?\237e\232\324\262/\265\254~y\356\245\226"
+	.ascii	"S\3252\332\263|\246\226;\265lS\313/*`\346\243\305\267\306\334"
+	.ascii	"\273\"\357\314\305\202:\001\362$\377\362\177\373\341~\271\237"
+	.ascii	"\355n_\362\270\317\361o\211L\256\312H\326T\273[:\203\263:\257"
+	.ascii	"\016\245\346\262\303\222\210\371\255\204\3221\005\205\246\034"
+	.ascii	"\331\005(m\001dz`WP\241\306\341\002\243q~\312\203\275\025\354"
+	.ascii	"\234\216\360E\307,\022\354/\317{\357M\205\372\313\003\335*\r"
+	.ascii	"\266P\3338\0244\216L3\003\366\354\264\213j\020P\264\221\321N"
+	.ascii	"\373qH<\346\bg\223\240\336{\221\320.\342\222V\300\372\232\271"
+	.ascii	"\202\005\373\365l\240\262v\333\202c\n\332c\f@\356\353G\3734\016"
+	.ascii	"\327\027\227\355\351\234\336b>\223\310\020s\310\255\322/\237"
+	.ascii	"\024\306\024\242\3405\202\372o\007\302\262\0272\330\257A=\305"
+	.ascii	"\234!\300v\3774\363\006\016\366+\003i\265\221y\272\373\237\373"
+	.ascii	"w0\301rZ\t\353\364\351\303\371\264\206\2731_\b8\023c\245{\214"
+	.ascii	"\213n[\304\332\225,[\206u<|\260_m7\b\313j\321\323\207{\367\004"
+	.ascii	"&\232\230\242\236P\224H\205\201*\252Jj\25025E\021\253\250\232"
+	.ascii	"\210\252\224S\324\3239$N57@r\200$\202\301\321\221Q\220j\212\251"
+	.ascii	"yhDb\n\n\304\320I8t\022F=\205\200\022\016\211SB\243\035\226\""
+	.ascii	"\321D\024RII\021\205?\345\275\032l\356\005\233\3174\330\275\336"
+	.ascii	"\3621\237`\301\352#_\235\367\336xp\207\304\3461\260\371Y\216"
+	.ascii	"\323@\365\034%\3555\016\336\261\311M\363\355\212f\022n\266\370"
+	.ascii	"\340\227H\217"
+	.string	"~\005\323\353\233\266qH\274!\246\232\335\365\365\030\333\364\257k\276\254\325\325\264M\277\246\377\205K\232\216\375\371u\212f\253\310h\023\243\036*\245\351\213Y\353r\300\236\311\331\212E\324\325WV<b\277\322\264\332\335\276~\260\325\016\"U\324\335\213\r\262p\2501,\310\0303\206\231\221\tFF\222$\035p\002\0211\273n\020H\213f\222\024\032\003f\020*\001^\034\216\355\274\271\0067\374\345\204\305!\351`\306\246\376\363\331\251~!\355_xdx\027\353$Y.\313\343E\302\027\007\031\204~\223|+\302\006.&\3531\271I\262z\3648\357?D@F\200\222\\i]\246M\230\3219\376\307\003\n3\370\260M\305\375\237\360!t\314\255u\350\220\f\002\371\b\216\177n\002/\231\3227{\224A\330YF\016;:X\275\232A\343\274f\357\004\204\313\025D|5Y\342Xx\203\267\322\002/\331\316N\224\343\224"
+	.string	"z\376\006o\350\005\372<#-\f+\210,M7w\001V\244#\343\254d\002\362\370\205 C8\371\354"
+	.ascii	"\343\366%\006CjY\351\031\210Qs\003j\254\352h\031\327\360\256"
+	.ascii	"\037\244\005p\203\201\254\002\232\362\273\032"
+	.text
+	.section	.gnu.lto_mspFcSettingFindCommand.159.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`~\001\275\017"
+	.string	"v\036lE\360\320h8(u8\242\3374WmqI>\016C\037\315H\226\311\347\245\270\373&qx\363\232\344(m\263\340u\rLX\360\377\225c\253\2608\\\375\316\312\017\345|\335uP\261\211\rOkc[\334{K\231RX"
+	.string	"W"
+	.string	"V"
+	.string	">$vG\005F\020\272\3471d\333\307y\210\227\303\t-\261\230\005?>.\267\031\273\013v|\300w\257\273\200\357\236zx\370N3\364a\3576\\`z\304\232\314\2653\211\250q+\325d\035\001\0201\234\337\236/\265Y\346F\310\356:\305Z\314\355\335\266\004\333\021\354\253\bv\227&}\374G\267\335\242\357\374\237\323\352\245\263K\277t@g\003\207\323\\\354\302\344\202\026\205W\342\303m\277\375\362o\036QX\217\333V\2761\373\fA?-^\354n\202{\206\020\022\201\261\303b"
+	.string	"\300\316x4<\b\335\023Y\341\221i?\347:\257\217,\347\330\255\t\352t\351 \313\234M\270\0309\242\307\347F\325\306\341W>\221\222\360\260\230%\r\233p=\"\275\355\035\261\004r)\257\251\266\252B^\024)\212\246Ea\036YX\345\305\324\233\b\345\247\366\005W^\274\242hf\n\363o\377\r\356D\212M {\204\245\332\330\357Vk\002\030T%('^\252\345R7"
+	.string	"q"
+	.string	"B\302\340\343\343\024@\305U\242N\235R\\+T\312\004L\231\200('#+0\325r\201\247\002f\245\250Z\240\n\213\325\002G\343^k\\\242\315\344\350\037~2\264\031Z\206\017?\325\027\333\252\016\211\251\254S\033\234\f\216$\351Hm\324H^\264\346r\244\032"
+	.ascii	"\211\241\262x\241\245:\237\324B\033\332\216\3015L\213V\340]@"
+	.ascii	"\f20\275\177\017\305\343\261P\205{7\333\221M\361\\\303\367c\003"
+	.ascii	"\256-\034qT\203B\300\300\360\n5\017\356\002R\rN\245#O\253\240"
+	.text
+	.section	.gnu.lto_mspFcSetSettingValuesCommand.160.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\235\003\265\032"
+	.string	"\226\261\255G\240\232\321p\270_R\017\343\317\274+\351\223o\275S\324\357\324\257\201\203I\320\273d\305\245\247\205<s\200\207f\322\343\270[_\304\357#D\227\270\036\204<8/\336\244\331"
+	.string	"\301\216@\316\351\346\212+l\223\275\267\224I\006\231"
+	.string	"\217"
+	.string	"\232"
+	.ascii	"\243V(mM7\273\252\177:\024\335\2032>\353f:S\325\035\204\240\f"
+	.ascii	"\312\217\032,\337\344Nt\272\333\340\353\001#p\231ER\314tw\215"
+	.ascii	"\366\002\344G\361\003\310\217<D\313\335=V\302\310Q\344\335\351"
+	.ascii	"aE;\242\314\037\357\261\254\243\244\013\2774~B[\016\277@\b\020"
+	.ascii	"\351\260\005K\300\244\223E5?\242\035k~>\331\217hE\321\202\017"
+	.ascii	"\253\034\262\337\220x\254 b>\374\032\375\210\226/|)\206\313\306"
+	.ascii	"\230% \322\027\206\241\273u\315\037\360\n\340\252\352\244\252"
+	.ascii	"\036T\371(\353\245\032\344-7\251^\307\327V\312L\252\247\272\316"
+	.ascii	"\036\374k\016u\215\215\253%\271\n+W\311qu\204\255\212\343*\223"
+	.ascii	"\253;\256\376@"
+	.string	"\002\255\"8\216\344\245\373\306\027\232\276\032\261\034y\324O\365C\235Uo{r\243\217\242\227\372Pe\266\247\251S\321\235\352\305\333\354\363\256\270\214\266\272\203\034\312\2176k\243\"\345St\217\212a\323Y\375$0\\7\266\272\2172\224\037\3376W\325\351\205*\263%\2719\324\356\r\354\317`\342\252\261\325\335\017\036X^\344\253\016c\027B-\004Kr\207\017{\023\3064\003;2\210\020{\223\344\235:\235\256|\314\333Bf\210f\344\246\221\231\267Kh%\362\310/J\243*\342R#\312\356\326\021\371W\302<\t\260\221\330\233\314\317\362/=L'1G.\343\204ZC\333\245\001\366U.u+M\036\024{s\231\346c\036\277LQ\232\336~\351O$\237:\177\314\370T\247\311\266\206US\374\354\315\031\377\2474\304<\375\360\263\251\263\007\217)\203\005\204\325\301\311\003\007\204Ro\275\324\301\231\224\325\0010xN"
+	.ascii	"\371\214A=@>\"\013\025-r<8R'\350\354\350\230\220@\201B\216\200"
+	.ascii	"\033.\307z\313Y\221\373!q\353\251\335zj@>%~j7\\\256\226c@\203"
+	.ascii	"V\360\340j,\202\202p5Y\260\317L9\254$\261R\342\374\303_\207\221"
+	.ascii	"\223\021\362Z\036c\032\252\032\343\035\245\036\013\351\317*\005"
+	.ascii	"\253\252\201\303\336T\232\320\211\234Pb\214\241\307%\306M\212"
+	.ascii	"\363\222W\211\260\313\320v\225\274#<\001\254\223\207\330\335"
+	.ascii	"]~\252\353K\b,\206\330\275t\341Q\217mA\2059\231\354\276#\017"
+	.ascii	"\365\021J\275sI\203\256H\250Q\034\245\024cF!2\025\t\311h\241"
+	.ascii	"\306p\002\2219,\017\020`\254$\031\306\211\3238.\232\345w\222"
+	.ascii	"\260('c\036\b\317\356\216.1\036 \025O\222\250,Y\306\320R\004"
+	.ascii	"\013\032\320a\200\232y\236{\2104\006\363|\302c\237c\306\320\352"
+	.ascii	"\226\254\2727\316\274*\220\3745R\360\353g\211?\344A\016\007\302"
+	.ascii	"gL\f\275\240`+e\266\355W\256\357lS%\231\005EJg,}Y\364\314H\322"
+	.ascii	":\361\377\007\t\314\255B\360\315\263\006U-'\027\260\255\361G"
+	.ascii	"\333\315\364u^\376\245\001"
+	.text
+	.section	.gnu.lto_mspFcProcessInCommand.161.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\200l\355w\001\212]r\203P\020 G\255\f\007'E\236\001x\336\327_\257\266U\3051\001\013\035\315e\315S\320\243\026s\215\364x\"m\356\210\230y.D\370Xu7.\320\326\030wW'\234P=se'k+\005\352\277\2155\266\243\264M\007\332z\026\"d\357-e\222\001(\bX\007j\bG\336\245\016\257\217\016\257\022\311\273\003\222\367\002H^\035tx-\200\344\255\200\016o\016H\336\037H\336$\222\327\207\016/\005\220\2748\350\360\3668\362\3628\362\356h\336\033$\340\265\341\310;\201\346\325\261\303\233c\207\027G\363\326\200\344\275\321\2746\220\2745\216\274\022h\336\236#o\004\216\2744\034y!p\344\235\341\004/\215#\357\214\023\2742\034y\037p\202\327\001G\336\006\350\3602"
+	.string	"\311\033\303\221w\001G^\030\216\274/ y\025\200\344u\001\311\233\200\346E\300\221\367"
+	.string	"$x\r\200\344m\241yY@\362\256@\202\267"
+	.string	"%x\t\020\001\357"
+	.string	"\220\274\002@\362\252\200\344M\001\311\033\200#/"
+	.string	"L\360\3128\362\242`\202\367\004$\257\t&xK8\362\222`\202w\204#\257\b\315\033\302\221\027\004\023\274\037\034y=0\301\333A\363r\320\274\033\034y50\301\233\301\2217\206\t^\030G^\236#\357\213#\257\213#/\006G\336\026G\336\013\232\327\202#o\005:\274,\216\274+\216\274\024\034y'\200\200W\305\2217\305\221\027E\363Jp\344\335\321\341=q\344\215@\207\327\304\221\027\002\035^\235#o\t\035^\022G^\344\221\367H\202w\304\221W\004\2227\004\t^\020G\336\007\220\274\0164o\003H^\006J\360\346\220\340\375\200\344\305i^c\363\026\233Wm\336\364\310\213\216\340\355\346=\372\305"
+	.ascii	"\31614]\002\243\364\235\330J\344\371f\245K\305H\371\340Ox\236"
+	.ascii	":C\235\243\316Lg\245\363\320\031\350\177\376e\376\270\377\355"
+	.ascii	"o\373\275\374e\007\261{\032yT\233CC\357\002\007\362\316\312h"
+	.ascii	"\250\361,?-\033a\251\315\241\261\026e\347\024\346\367f|JC\216"
+	.ascii	"\241ft9eI\333jb\247\315yJ\243J\017It}2\301\351\211V\026\343S"
+	.ascii	"\032\\\230\351\002]N_\274\304\370\224\306\021^\332\034\032J\232"
+	.ascii	"4\031\322HJ\332\034\032M`\264\206\364\230\2645AzL\032\336\f\314"
+	.ascii	"\303\362Q\217IKC\025\306@&\300\003O3\003\231\201\t\006\232\251"
+	.ascii	"%\256@\"6*\344\"\001\024\221\322\342\"\343S\032B<\273\313C\305"
+	.ascii	"&F\312\214Og\240\t\332\234\031x<\273{\366\341K\22603\332x\335"
+	.ascii	"\234\031oV\b\241\374h\370\233}\342\253\\i\203\270\203\013\221"
+	.ascii	"\206\" \2409\033\022f\313\241\0277=\350\372$\266.\2110\312\372"
+	.ascii	"\342w\302}\341\346\354\222\357\203\3736K\275\013\3268\232}\340"
+	.ascii	"\223\256\244)\\\3275\347\200\177FFp\244\341i>\340_2\203b\234"
+	.ascii	"\231\023\0360D\236\373\235o\317&\221g\367lj\274\317\206\257E"
+	.ascii	"I8HfQ\374\266\214Oq\370\361\234\357z\3735\233\363\024\307\037"
+	.ascii	"\317\356\327\354\006\036\324\370\336\002\316\350\302\n\231\030"
+	.ascii	"\237\356\365j\354\346<\335\033G\263\307{\330\225\271\302;\036"
+	.ascii	"lw7\354\236\034"
+	.string	"U\301q4{\273\027\256\254\261\222\206\007\23348\226`\020=9\2522\003\t\335\3536\347\351\f&gt,\321\rj12>\235A\205gw\316\006\020k\335z%\274A\263\013\031\237\316(\342\334\234\031OL\006\241\370\315 \342\331\307\355\3456gF\3216\321\265L\205\300\247\226\f\205<\373\346\036\316\220\207\314\335\226\177\333\361\365h\305\301\013L\364[\327$\027Owi|\312V+\356x\366`\366c6\347\251\fk\332\222)\200\304V\"9K\252\302\204\025\342`d\3531d\n\267\307\301\354\327z\f\031A\252\260u]sv\367ji\333L1$\266*\345\030\031\241\013+\\\327\325\305S\033\332\3604_\255\307\323\266Y\2005\210\211\0034\316\242\302\302u]y\236n\f\306\247!v\227\373/7;\332\346\310@vF\001\036\n\003\263`0>\225a\215gww\003\017\226/K~-Zu\020\f\224r"
+	.string	"\343S\031\344x\356%\207\257K\353\201\320\005Z\361[W1\027OW\005\343\323]\031\276xP.\037[\276\213\005t@\254CcH2\214OW\314(C\024\236\346\335g\271\226\345\305\224\233\256\253\325^\230u\025\343\331\n\214OA0\330\303\226\373S"
+	.string	"\242\240\245\f\002\241\030\221\025\256\353\032#\305\221\352S\364#\324\247\275$\305Q\261\247\210 D\210\274\375\363\251\346W3\032\215K'B\004\210\017\037> w\273\202e\340\250\330\027\306\207\237\257\336\346-\336\336\255\232\265\3334\213f\353\366\314\322\355\334\232Y\347\226Y\271\215[\270}[\267%\263\315\035\263m+f\3316\314\256\255\332\262\331\264\005\263h{\266f[\266_\326\313\222m\227\035[.\273e\305P8\301\204\022H\030A\204\020@\370\300\203\0168\330@\203\fb\300\340y\341\002\203\026\027XP\001\213\025\024L\240\"\005\n\tvND`\002\002\235\022$\220\307\021\"B\200x\300\201]\323"
+	.ascii	"\0039\037p\214E5E{\367\226o\373\370g\017\364\325\243z\343\315"
+	.ascii	"\203\373\342Q=\004\013\250&p\337;v\002\303\253F\355k\227\306"
+	.ascii	"Ri\220b\b\2630]!Q\373\242ACc\200zb\247:\247\252\2553hqH\222\232"
+	.ascii	"\020\376"
+	.string	"\330\030\341%-\274t(S\035\222\262\357\\\237\231&='\026\3362i\323\333\226\\\334\025^\270/\3367+\274nRx\3114\r\331j\332\025I\374\033cf\253-\3518XE\342\376\304<9^\t9Q\221N\232OV\305U\022U/[Y\030\022WBLx\327N\\\tU\241)\246x\325\250\276lN\\\t\315\221\270\022\252\342M3\372\013]J\230\256\220P}\301\024\201\332BS\233<\275\205\031\236\251P\3122Zc\272B\022\3675[F\331*;q%\364\204\266_\274\f\341%\353r\264\243=\\\t\005\341\035[.R$\256\204\216x\267(\337\254X\037\n\317\237\360Ld\023\016Kxs\022\336p%\035\362\bo\334\260\b!H\0252\bl\376\001\212\201\037[\233\327%\261A\221D\262\216\372\330\003\276w\200\262\370rC\346uI|\250\t/DN\316\225\264\2069\320\333\300\271\245\301\005\3402\260"
+	.string	"L\230\260\257\030R\034\344d\030f\316S\304\342\027\366u\265$\365\027\0268saLC\030\366w\265$u\f\342\336\202+\t\216/@S\310\321\031\275.)\016E\221\244\312\360\215-@A\254\241\031\240q\005jg\221\366\025\250\006kV\210\257K\002\203:\2405't\256\2444\246`\275Q\220\020\352\357jI\355\023\234\261\212\024\207W\301\225T\306(\264\260\004*\256\226\244\276\203\262\340\205\b\205\256\257\303\327]\005W\022\026>\201\2760\212\357uIa\350\tFi\212\274\315\027G"
+	.ascii	"v\023h\tX\2544y]\322\025\264\271|q{\341Up%\2051\004`\327A\377"
+	.ascii	"$\252\352uIT\350\tc\322\2349W\222\025.q\205\004\232\342\265}"
+	.ascii	"y]R\026:\202\023\224\257;\257\202+\t\n#\225,E\371\221jD\016F"
+	.ascii	"D\240\203C\266\256\226\244\036\002-\022\021\311z]R\0234\0047"
+	.ascii	"~b.w\025\\IU\fB\311\022\223?\020w\007"
+	.string	"\036\304\344\273\006E\301\211\032\274\023WBe\320\030\240\236>\346*\270\222\250\270\001\020H\342\316@Q\306"
+	.ascii	"\226P\321\205\031^-I=\347\203\212\253%#\3071\202v\025\\IPl\374"
+	.ascii	"\325\222\324\213NW\035P2*\342\364uIRh\212u]s\224\210\030EMP\225"
+	.ascii	"az]\322\023\312\342\f\2225G;#)\rqSP\366\335\213\362\345c3\337"
+	.ascii	">'Pe\344\364\362\360\346\314\020\211\372\240$\004D\b\222\231"
+	.ascii	"s\212\007D\303\275003\271'RRgY\262dEi\022eD\n\224\343\225\320"
+	.ascii	"\232\372/wB\277J\242j\301E\031\353\272.\037)-}q\370\356\007\002"
+	.ascii	"\354\376h\267\007I\022t:h\224X\367\020yz\317\251!\"\235\306\332"
+	.ascii	"\021\337Qw\332\307\230\323L\017\261\016\214\n\0240\256\353\372"
+	.ascii	"\242\237\035\004\253 >\334i\022\364\016\231\274\205\236!\035"
+	.ascii	"\020"
+	.string	"#\226\320\023t\201O\364.\363\f\023M\335\211\306y\n\342g`\335\312\207$\032ks\364\216\f\327\251\223\035.\3765\215\364\341\333T\277\246S\320s\036%\274Z\323/s\346\303=\020-4*$\\\277\314\232f\270\364O\017.\0023v\355d!\2028\023s\020\274\335\265\033\002 \030\223\247\347,\241\244\305$Y\3542\363\232\215\271g\f\363\002\223\357\tP\237\242\203%\372[\333`:-\001{(\313d\303\374\373S\237\222h\024M\236\234\017\221\247'\367\006\260H\321\261\261v\261 \003\373\314Lu\"\373r`\307\336e\016\266\227$\212\356\322dLB\246!\363\220y\250>U\233\307>\034\332q\364\254\324\255_\031#\032k\267k\004bo\021\323\222Eg0D\217\b\321\352\326\024\020\275\313|6\330\217\323\2730Y\327\365\203\335\037\240\276\362#T\302\376\020\365\327\217Q\005x\353\272~\360t\333\253\255\374"
+	.ascii	"\331Cy\272?H?B\204\250Ou\020\035h\020}\243D\007Z\235\242\267"
+	.ascii	"\325=\350U\211h\254\275\334\217\245\246%\021D\003\035B#\255\231"
+	.ascii	"\336\324\016t]\257P\370\333\357\307\205\237\033\002\207\320\217"
+	.ascii	";\334\217\022\013\274u]\177\264\373S\344\247\211\250\201\366"
+	.ascii	"p\027a\246\327\024\242\261\266\201\263\007x\256\213Nnp\361\357"
+	.ascii	"5\322^7\320)\020\240\033\350\313\035\347\371\013\324\234&\300"
+	.ascii	"\345\236:]\355\365\343\356\007E)\016\304\\?\356\305\277\327<"
+	.ascii	"\327/\242\022\342\347\252g\356\236\f\364\356\37209\234r\207\311"
+	.ascii	"\272\256!\364\340\021 \003}%+\271\213\310\323\353\025\023\372"
+	.ascii	"\242Il\222\365\200\225\316\032/D\007\032k\177\006\242\340A\271"
+	.ascii	"\241\223$U\216#\214\353\267\3454\307\2758\023uN3_Q\242\020?\367"
+	.ascii	"c\036\"\357n0\315\233\334\315\3215\340\245\343\232D"
+	.string	"\310\030\270\331\035\334\207\336\206\322Q~\234\240~\242\242\324\247\234v\004\030\304\317\305\351\017}\r\252~\216\360\217p\272\001VC\r\344f\370\026wM\272\234\306\332\022j`YpZ\311\221j`C\214\334\325\3273\"\321kc\210\274;0\275\017\255\344/;\rfw^\374\305\215\b\007\353\334\325\277z\336]W\327>\271\253\331i\364$\264\225\022\311:26\326\356\250}eQ[\311\035\360j\2232\225~^#\355\362p\261w\177\226\3744\341\037m\212\274.\366\215\022\321.\302\354.\352y\375\262\257\214\240bc%\325\227\335\002VA|\270\234w\347\364\275\272.*?\2512\225>\327\230\031\263\273\246v#3Jw\324\007\372h\307\271\032\313\033b7\213~GE\373\201^6z\022\342\347n\037\351\253\344\036\312\376<\371\211\302?z\272\377\211\242>E\033E\336S\336]\221\272\225\017\213R\216\206\240\215\265\373"
+	.string	"\265\333\307\330\334\020\273Y\246\322\335\350\315\356\224\250\364\313\236\"\210\017\367\202\255\237)\374#\246\3220\230\251y\266\371\321\216"
+	.ascii	"/\272B? F\334\025\023j06\334\375;\032kw9\361+\003\210\021\367"
+	.ascii	"g \213\225'\036\215%\265=\345&\257\260\215l_\247\361\003\274"
+	.ascii	"Rm\247\355'6L\n\303\2544\323vS\035\316Q+m/\321a\351!\333D\266"
+	.ascii	"\257\235\2057\203\264\035\244\214\031\255\325jm\321<l\003\221"
+	.ascii	"3\224k\242\355\242\355+A\315S\\\007m\013m_\333\025RI\035\356"
+	.ascii	"\271\275n\037\t\202od\020\267\257\347\302\250\244\306\\\251\272"
+	.ascii	"Y>l"
+	.string	"\013\324#\\.\024\023\345\027fEpy\360a\022\265\376\226\001\325\020\215h\255V}\313l\322\360\360\302\254\254V{\313k\016\206P\210\026\336r\336\366\215\320|\373\231\335\262\232\227Q\025\206Y\251[F\263}&\274y:3\267L7\267\036\202\321*\263\354\334>\023\326\336\234p\313q\333\327wZTRrd\226\335\266\317\250\326\024\247\265Z\265-\217\331>\026\322\274\201\t\263\314\266},<\237\306\322\226\325\266\017u\243\333r\266\214\266}#\244\275\235\360e\271l\373\272iE%UB\227e2\021\242\266,s\001\341JY\230\225,\313Z<(f\225\201-\207m\037\013m\2368\260\262\374\265},\200y\342\351Z\256\262},tyr\301\265<\245\005\232\224e-\013n\005TD\210\026\224\345(,p\236\304\232,;\331>#\005'*>\241\013\263\262Z)Y^\262}\350Z\030\225\224\n$\313I\266\317"
+	.ascii	"ko\353\nt\252\234+\325\335]\356\366\361\321\272\256\353\332\342"
+	.ascii	"\351.\037\331\335>\324\316\n\225\324\272\002\235jwww\271\333"
+	.ascii	"\307G\353\272\256k\213\247\\\324\350Z\206\023\267\205\232\303"
+	.ascii	"\272\225\017\227\211\372^\236\"\210\017\367\315D\335dF\211A\374"
+	.ascii	"\\\026\314B\275\373\343\365\363\305?z\337\311j\250\201\366j\374"
+	.ascii	"\352V>\334\2531S\267\362\341\036\355\037\324\272\350\f\001W>"
+	.ascii	"\334\025\023:\272\256\353\312\215\265{t]\327u;\311.O}Q/\037\374"
+	.ascii	"\242\\\216\274h\323\221\027]:\362\242Dx\350\213\006a\250o;9\352"
+	.ascii	"\333r\314\364m8f\372\366\033+}\033L\363\266\227\023~{\354\310"
+	.ascii	"\333b\037\374v\330\007\336\256\362\270/\317\275\355\313q/\363"
+	.ascii	"e\270?\277\314\366\262/\257\275\354\313[^\366\345\256\227}\231"
+	.ascii	"\n\003}9ky9\310\305~.\272\227/\023\275\313\317B\315{\301\345"
+	.ascii	"} O}\017\310L\337\377\261\322\367~<\364=\033\006\372\276\357"
+	.ascii	"\317\357\371^\346\3735\217\373~\357e\337\353\275\354\373\274"
+	.ascii	"\022\274\307\233\200\367wG\336\2539\362\336\356\310\3734G\336"
+	.ascii	"\2439\362\276\016\311\3733*xOW\202\367s%xo\246y\357D\362\276"
+	.ascii	"L\363^\016\311\373\270\346=\034\222\367oG\336\273\225\340=\231"
+	.ascii	"#\357\233G\336\2179\362\276\355\310{1\315{\266\346}\230\346\375"
+	.ascii	"\032\222\367jG\336\2475\357\301\034y\217v\344\375\031\222\367"
+	.ascii	"fG\336\227!y\377\345\310{/G\336\223\035y\337\345\310\373\261"
+	.ascii	"\022\274\347r\344\375\026$\357\305\216\274\327r\344}\026$\357"
+	.ascii	"\261 y\037v\344=\030\222\367W\220\274\377B\362\336\312\221\367"
+	.ascii	"^G\336WI\301\373\256#\357\251\240\340\375\224#\357\271\220\274"
+	.ascii	"\337:\362^\353\310{)G\336g!y\037\205\004\357\241 y\377\004\311"
+	.ascii	"{'$x\337\004\311{&G\336/9\362^\311\221\367XG\336'9\362\036\311"
+	.ascii	"\221\367W\315\373#H\336[5\357\253\220\274\247j\336O!y/U\202\367"
+	.ascii	"QG\336C\035y\377t\344\275\323\221\367=\034y\337\324\274g:\362"
+	.ascii	"\276\310"
+	.ascii	"\221\367KG\336+\035y\237\244\303{\"G\336\017\321\341\275\220"
+	.ascii	"#\357\203\354\360\036I\207\367G;\274\007\322\274\347\001\311"
+	.ascii	"{\243\035\336\027\351\360\236h\207\367C\315{!$\357\203\216\274"
+	.ascii	"\007\322\341\375z\344\375\321\341e\006I\275\353\223\247\302%"
+	.ascii	"\3257\273\244\276\223\020\360\314W\206\2142'2\206H\343\2400d"
+	.ascii	"O\025\223\206\311\207\"mH\337mM\b\241[\220\336\365\341S\323\222"
+	.ascii	"(\202\364\233\204\315\023B\264!\261Q\315\364\006\201\364\221"
+	.ascii	"Z'\315\313\021\017} \255\223f\324\347\301\250\317f\305V\324\273"
+	.ascii	">\177\352\330\256-\005\235`\324L\261r\363\241~Q\027\007\305\210"
+	.ascii	"\204\372C]\034,\362\013\352\013\365\037\324\007\263\312\022v"
+	.ascii	"\345\013(P\275\262Ld\362\355\034\250\337\264R\275\276z\375\364"
+	.ascii	"\256\317\240\332\225\fb\362\355\374\364\333\270\230\204]\313"
+	.ascii	"\336\365!T\265\222EL\276\235e\277\031\305\207\220\253n\325\242"
+	.ascii	"\"\224\252[\371\2200\312\314[\020B\231@\310\244\354]\037C&\032"
+	.ascii	"U\211\222p\311\3470\261M\t;\364\256\017\242zud\007\302\013\364"
+	.ascii	"\256\317S\245\232\272\300\340\263x8$\241\201@\035\200T\250$&"
+	.ascii	"\037\n\325\251C_\256\007\0134\212\2746s\025\020R\231\230\230"
+	.ascii	"|(\020+\320oS\225rh\024\316\037D*\221!E\347\217\376\241\\\322"
+	.ascii	"HER\256P\217T\304d?\020n\204\324\315\007\020\265H\nE\364\321"
+	.ascii	"\237\242\nQ\240\211C\357.\221T e\207aZ1\371vp\350{\245\211=z"
+	.ascii	"\247\215\207\220\364MR\202C\036\3756\2636lr\027a\007\221"
+	.string	"\2640i\001\341\362\310\2126iG\200A;\372\204^!\334pC\033*K\245-\020l(\222\376\245\260\302\257\223|\002mC\337h\214\320\004\372nm\232P\"Yx\370@G\373\030\323\323\321$\264\361 G\357.\233\3225\273\266b\257hw\004\270v${\\\304vQx>\005\207\3265\210\002\034\235\243_\304%\304\317\255\241q4\004\210E~A\374\334\033]C\337(\361F\037\321j(\360\231:\r1u\360\3426\332\207\215&\001\261\206S\252Fi\227\206\254F\277y(\001\250\364\f\335\334\231Z\002\255\332\031%\246e\340R2^\251\363=}\246^.\022\3746\3252rue\344L\240)\202{s\203{#1\326A\306\247 \020\251\322\352\351\335M\311\244\315\036`x\232S2Qis\233\250\330\252$\002I\242\023\025\2431>\215@\367\264:h\224\030\201V\225\bi\230J\305\354\262*e[\036\221"
+	.ascii	"/L\223\206>\334\034\004\220\244i\311\035<\264\024\314\022k\311"
+	.ascii	"\262I\023\365i\212x\004\b\201~\233s\206\336]>I\313\222_f\350"
+	.ascii	"\263\305\275}ep\020\330\244\021%\355\262\23426\243i\314\350\203"
+	.ascii	"\265\311\320\273K)\251\330rJ\005x^\251\026\365\001-\303\003\372"
+	.ascii	"nl\016\350\335\345V\032\266\234\"\301\225\024l\331\345\265\374"
+	.ascii	"\372R\237\246i\rh\007\364\215\022\033\320\367\262\032j -Go"
+	.string	"\021\210e\203+W\314\200\336]bYjI\2530\300,\360\313\350-\002\275\3504h\254\335)1lI\251L\211ak\001c\251\226\224\301\005\364\377\252` K\241<\201\241\3576\365\302\227\224I\222\205\222t\311\322\fm\231\226\246>M\371^\350k\t4R7\364\225\221A\223\002\326R$W\251\235\002\372X\212\270\300\226VQ\251M\027\372p\201\thK\243\224+\230\244P\251\221e\323m\t\007\247>U\323\022\320w{\2205'?C@\240\257\214\030\215\2659nx8\253S'<\\\374}}\215\200~\337\001\032\001K\274\273t.\347\370G\007h\245\225P_3\320\337\330\22120\262\232\201\372\232\263RC6M\003\\\245L?N;\351RZdy\006\315\322\316N}\332\210-\264\001\2020\013\275\273\314[\356\361\217Z\350\025\232\205F\323\214\022W\350\377\005=D\036\0337\273\241\274.<\215\265\213\245"
+	.string	"\275\273\344K\207\3748\241\300K\203\244B\226l\226\177\313\300e\240\372\364\003\350\002|\370\n\252"
+	.string	"z"
+	.string	"\255\246\025q\t\t\240\357\006\226tV;\0243\364{\321X\273M*\f\246<\0305U\350\177\025I\2010\035J\205R\350\203\261Q\n@\357.\r\323U)\001^\"\372\\\036.\021\227\317\3453"
+	.string	"}\260\276D!_\031.\372\f\177x\227)\304$\022\372\303"
+	.string	""
+	.string	"F\250\033f\""
+	.string	"\be8y\260\315\226\0269r("
+	.ascii	"A\005\203\230Q<\210(\364\003\377Nh\236&O}n\351\233D\256\013>"
+	.ascii	"4M@B\373\224E\210G\200&\364\003\367Jh#A\b\232w\224FB\337\315"
+	.ascii	"j\250\201\324\214\320\026\260\211@\004MC&B\277i5\324@Z@PB\317"
+	.ascii	",\245yR\345-\rBC\200h\346\003,[\266\364\f\253\241\006\352\003"
+	.ascii	"\263\240\261\026'\216\005\263u\2527\201\213\237\217\347\347\353"
+	.ascii	"\024\364\326\2170\354\233R\307\327\177f \230\324C\005\215\265"
+	.ascii	"\274b\323\220Q\013\314B\301\237\202\215\264\313l\375'_3\033\232"
+	.ascii	"\3277\305\203$(\\\262\003\274\"\350\033\263\311\330\0033\212"
+	.ascii	"\347\034\264\007\255\362\221\351\240y\004{\203\346\240_$(\304"
+	.ascii	"\317\345\265\336\240O\f\242,\032\213WL\350'\254\b\201[\321I\226"
+	.ascii	"\371\272\201*cy}^k\274\326\311\276\025nA\222(p\361??\303z\264"
+	.ascii	"y\265\362\341\024\r\234P1T\314(\0134X\313`+F\3572\241\320\264"
+	.ascii	"\244\021\005\363s\305\214\262\240\005\365\251J\026\243\337D\313"
+	.ascii	"P\263\026\246\230UU\352S\030mA_\325\004\215\2658\317Ae\242\366"
+	.ascii	"1f\246o\212\365\372\242\350T\360\034A\311\374\272\214\251i<}"
+	.ascii	"7\303\027\275\313D\202\212%\213E\334\326h\3112\370\242\317F\350"
+	.ascii	"\002\354\n\336\227\2254\315E\337k\020\203\256\344\n&X(\025\246"
+	.ascii	"\226b\021\2674S\2700\bl\261\004\225B\227\025%u\266\350"
+	.string	"\203\375]\320\273\314&\250\223d\261\210[X\223%(\223\036\365i\352<\002\234\253\313y\323\004I\212\306\332\357\250\0278\235uo~\262.\220C\247~7\210\377\341\037E\315)\206^\365\240]\236\273?Z\350\021\346\023\264\004\233\235\021\023\264\n\265bF\221\302\334\332\352yA\351\201\300\304\217h~a\232:bA\037\261\202\266\240S\347\341C\344\355\301\241p\340;j\005{n?\\\025\3545\261\374h\377\240\346L2\364\223\240\006f\321W\203B\351\3405x\353\032\364\243\253\331}\201>1\233=\242.\017uZf\027\323k\237\346r\253\241_N\223\335C \272\370\323\240L,\266V|\241KJV\222\210\330\255\350OMQ\320\273L04Hr\007\217\211\005EbjI\307\310P\241\n;\002BA\324\004\275\313\334\202\026%\32312Z(Q\":4\001\233\355A\251\350]\346\030\n\304$K\307\310@\371"
+	.ascii	"]\023\373\251C}\332|)Z\305.\363K\277a\242\031\327u\350\203\355"
+	.ascii	"\301\013,1\323\214)\232\005\223\032\234\226!\340:\304.\310Nc"
+	.ascii	"\355\005?\200\274+_\326\"h\301\277\360-\230E1Z\203\240\307\272"
+	.ascii	"\2534\222\340\273\212\336^S\225\376\334 !`\222!pI\206~AE'\032"
+	.ascii	"k=pb\242\303:u\242\323J\216ri\2446O\247\240\\\372\203_\031AK"
+	.ascii	"Oo\372\"\b\353\017>\305\223*\312\245;\254_D%\324\346!\232KpD"
+	.ascii	"\207\205x&\304\032"
+	.string	"E\373\030\313\023\\\246Y\0272\321\3224nV\326u\350\003BfZ\316\020\231\302u\035\032\3546\3145\364P\236^\320\006\365i\213u\211&Y\202\370\271\f\210q\216\365\t?\203\225`\007\332\300\202\311\272\016\375\350\202\273:"
+	.string	"6 3\355\005\223u\035\362\353?\346\032\312\306lS\333\324\247=\326<x\324C\020?\027\345\322\355\245\323\302?\210\0309!g\336\200A\020x\234\256&+C\024}\300\257\214\240\275\"hd\240\200\242a\310\333S\272\373\317<\305\357\376\272_\312\0207?C\277^\243\003}\303\344y\273\001\350=f3-!\246I\026\025\266\256k\bO\267\363Z\217\351\006\307\224\223S\2372\235\253\303h\265\324\242La\006\013\303\337\210\266+\274\037\311\316\3100\361\005\256|\270\022\364\357v:9p\350\310\201Z\240\307\r\2759`$s\374\350\331\021\203G\217\035;z\3240\361cGO\373\270\241\243\006\035?x\334\260\241\343\303\207\033;\350\200\001\207\216\032x\364H\341\207\217\03688\360\343\206\r5z\\\340\261B\362\207\217\036.\340\340\241\203\207\216\236\0357|\220\330\0340b$\223;6tp\n*"
+	.ascii	"\300G\217$\217\0330\334\300\321\363\343\206\036\025@n\016\030"
+	.ascii	"\311\037<n\354\370\221\314a\0026zP\334\300\301\243\347\205\t"
+	.ascii	"\330\3501\332X\341\007\217\036\0367v\370\270\201C\316\215\037"
+	.ascii	"=6t\330\340\321S\003G\207\0336x\254\240C\017\t\0307\007\214\344"
+	.ascii	"\r=|\374\340\321\243\006\r5|\304\250Q\303\211\032=;Z\207\036"
+	.ascii	"\022\350\033;z|\324\220\376\340\221C\217\024n\270\301\203GO\216"
+	.ascii	"\032\fl\016\030:\370\210\241\203\217\021:\334\260\301C\007\r"
+	.ascii	"\252\216\337\310\341\206\236\n\2447v\320\001C\317\217\036\033"
+	.ascii	"\306\032>\222\275\034| \302\007\022\320\240\203\016`\210p\001"
+	.ascii	"\206\003\330\330QC\335\0320pH\356\240\241F\r1j\324\020\203\207"
+	.ascii	"\216\236\0351j\370H\306\200Qb{\340p\303G\214\037=z\370\210\221"
+	.ascii	"\263\273+\026\364N\262\024\200\272b\264\306\300\377\243\036\355"
+	.ascii	"8G\224\262\214\326V\340 \3751\307\241\013|c\264\346\300\317\177"
+	.ascii	"\324\0076\322\356>\260\271\205\372\371|\306M\240\261\326\203"
+	.ascii	"\243\034\250\227.^\301aT\363\0036\322\366\361\232\271\214\353"
+	.ascii	"\231\250\217\327:dE\202TO\241\016\330<\245\003\365\322<u\201"
+	.ascii	"z\300F\275\230\340\302\325vg\004\307\350\007\354\005\223\035"
+	.ascii	"\002q\212v8d\2013\204C\264\303\340\016O\365i\252\246\177\327"
+	.ascii	"7JT\303\325\314aTs\236\272\005\250\216b\271\342\022S\327\205"
+	.ascii	"C|\345T\027_\234u\007C\376\321\032\023\215\317\035\016w@\334"
+	.ascii	"\341\371\345S\002)\205\212\332\232VC\300\253\257\f\034\215\265"
+	.ascii	"<K\204Yn4\\\223\020CHU\243\337\372\177\215\264\177}\2561=\270"
+	.ascii	"\347\223\352\377\272\341:m\026Q9]D]\026\341_3\323WFP \0274M5"
+	.ascii	"\330\021\031\335\330\331\365\235[i\214\214\204*_\232\376\\\025"
+	.ascii	"\032 FA4Su\275\253D2\376%\353\372mQgzW)\304\330\247l\236\351"
+	.ascii	"\177I\201\"b\334S*\031\365t\350\242,\262\203Gv\004(\305\351\216"
+	.ascii	"\311M\336\215\306\332\375\f\265\235}\256\261\274\263\254\247"
+	.ascii	"\263\031\352)\202\370t\275\253tRB\361\217\332\331-\327\247k\265"
+	.ascii	"\311gY\210r\315Q-\327\237\222\272\210\263,C\276&1$6\262\b\337"
+	.ascii	"\232\231>\327\375\326\314g\264\373\\\253\210EW\002k4\326\356"
+	.ascii	"/Po\246\370\013T&\352\233\351n\026\211\021\312\222{R\345\036"
+	.ascii	">\303\351!\364\262\334\304\216AV\033\235\004\262\204\2019\237"
+	.ascii	"\030\317\320\361\225\351;\313\364\265|\311E1:\215e\020\343\372"
+	.ascii	"rq\375\266,/8)F8\343\333[\037\256\377\226\325\345\326\273J9c"
+	.ascii	"3\2713\306-K\213\f\231,\251\254\250\246Q\315\230\326\354{e5}"
+	.ascii	"e\3644\326\342\030\241\241\301t\352\304\006\027\277_#\371-\371"
+	.ascii	"5+M\331R\023\201\306\332U\362\353\006s\366$p\f\225\261,Y\301"
+	.ascii	"*\243\214_\224S(\230x\031\323\367Zz\b\275'\203\213F\320P\215"
+	.ascii	"\006g[\225q,\271\303%\255\255\357\365$\356\312W\006\004\232b"
+	.ascii	"\216\030\265\024\212\311\202\205\255/\346a\350\330\302\234\004"
+	.ascii	"\b\302\364\331z\207\254\350\212\020?w\207\245oSU\373a\372DZ\021"
+	.ascii	"\225\220\321\212\261\212\261\013\213\321\353i\253\255\266\021"
+	.ascii	"\342\347\032\277\376\265NC\234\225\221K\373\276M\025\356\315"
+	.ascii	"\204%9:C\277\240&\323T\353\257u\261i\224\250\326*\324\023,ui"
+	.ascii	"\275\253Db\234\222\314\021$#\030f\327G\215\221K\211\225\226`"
+	.ascii	"\353\033\0133j\031\267\224K\232(\237DQ\323\372\177VCjC\304\310"
+	.ascii	"\2051\364[\373\221\354\313\025!\177\201}5\264>\030\275'`3\354"
+	.ascii	"\250G;{\362\345\203\207\326$x5\217\301\223.:\032\215\265\273"
+	.ascii	"u&\305\350\244\t\337Y\177\256\312l\313\250\004\2538h\326\252"
+	.string	"\322T\331\024\343U\362\bbY?0\352K\227\221J9\365\245\357\204\362\342e4\002\305\347\245?\367\304\211\354\313\330Cr\005\023#\223\261I\t\206E\251EK\032Y\337\355I\223\230\257\214\031]\266\030\225\222\234]\372r\207\"\334L\221\201\204\341\330\2301\210\021il\220\013\231\221\007\n\030\215\322&\227\376W\340\226/\306!\243\220\272\245\337\374\023\301J\231\007\200\230\0233+>\225\211ib}B9-h\305C7E-\375A\270,iE\302$\2126Y\372M7\0070\320\304\262V\004\374\303\302\026\306V\354S\242\340\263\013\353c\321s\242\245\001F,`m\305\274$\036X\237\r\354J\263h\227\206\357J\277\352\353\313\255x\206\256\371\325\207\362\262\002Wt*\313\240|G\200V\372UVC\r\324\345%W\204K\3560q+\276)\235s\3123g\006\275\372l\\^\fp2\365*\275\253DS\034\223\224"
+	.ascii	"\257(\246\330\246\264S\336)\363\224yU\372^\037\2340Q\211\241"
+	.ascii	"\261v\021\273\366\212kJ>5*\375\256\276Q\"\225\303)\275\253dS"
+	.ascii	"DS\376\235q\365\247\364\215\022\271\372N\303\255\300\342\027"
+	.ascii	"\245\227\264\255\276\033\241\326`q\214K\221L\253?8(\205\260\250"
+	.ascii	"%\213\224\276sI`V\357*\r\213`I\024x_\305+\312C%\242\362\251|"
+	.ascii	"\252OU\273\254\276\363l\311\037\326\002\260D\351]\037\240b\025"
+	.ascii	"e\027_\224\376\023\f\212P\221\353\307\351\003\255\342\226\017"
+	.ascii	"\221\221\017\020 vO\372P\236\364\021\277\256~\275%^0\234-\351"
+	.ascii	"r\322\273>H\305(J(N\372\204S\232\b)6\371q\352\240\270\244\310"
+	.ascii	"\304\207\210\222O\221\"\352\323\"\331\021 \223~\023&\375\301"
+	.ascii	"\263%[\305\252\363\022*: Fd\302\343\341\205\"\222-&\t\363\035"
+	.ascii	"\271\242\325\026\217|\370\316\232\326\bf\202V\2264\312\211\373"
+	.ascii	"\263%SJK-\"K\222\036\342l\tT\335\226\223%N\nX\242\244\244\251"
+	.ascii	"\030\265\206\210\021\250\b\310\224\264:(Dk\210\020B,\247b\017"
+	.ascii	"xB\232\230\322\260ZuC\262\n\302HO\021\244d0I\357\372@\025\225"
+	.ascii	"\222\017\301\224\226\206\221v_\024\223|\242\322\021\177jfP\305"
+	.ascii	"!E\">SU>G\220\250O!\340K\322\252\026\253!\006r6\372\207\210\361"
+	.ascii	"J\032\021\305G\037\361\306\313\225$vh\220f zJ\002]h\254]\004"
+	.ascii	"\274\370\242"
+	.string	"\007pq4\b\032\344L\311_\335\312\207\th\254\005\301H\217\027\30793"
+	.ascii	"\322\262\351\024\362\214^\302\215\222f\035\233\346\241\022d\242"
+	.ascii	"\306  \307\tMX\217"
+	.string	"N\262H\372W\375\253\"R\b[\004R<\362\301B\227\3704Q\233\250O\217\244a\344\211\271\236\022\267=!z\007h,\036\372\241\224\214\251[\371\260\215\207\345\225mr\321I\260\n\342\303\253\216\301\312\350!\316\224|\215\035\003%^\006h\254\335)G\236\024\211\206\370\254\372G\254\372Z\266\252\242\024\201\212+\"U\277\212\252\337V5\325\273>RTD\237\255\025L\016\3257>S\272|\274\274T\251\376\224T\3261P\322\202\222\036\370Q\275\353\003\346\203\205n\213\317\030\377\350Q\235B\t\023\231\222\"\374\344,fke\241\214\217\231\017\032\377\210\203\264\002\316\256\234E\316b\232\302\030\372\255\340\346\r\216w}\326|\330\314\334\270\025\240I\017\252\321&@\250\336i\302\326Qo\341F\013\001\236\332\317\251\377\3247b\352\363is\352\023yOA\374\374R\253\244\202\f@D\017-bM\017n\274\374\336\302M\227"
+	.string	"\232\334I\337\246\272\353\343\346\0037T\245\002\221\246F\211\3405\271\231\342{\0137Qt@\214\230Bc\355\312\271q\272Q\n@cm'9\272\324G\273\021\260\221\374E\032]R\323\274H\357\344=\003\337\202\020\221\016"
+	.string	"\204\206_\352]\2379\265.\251\236\031\\\352\263\021\022^\251w}\316\250f\222+\360\3242\252\323\007\215\217\235\317\235\317\235\372TMS\352\273\021\016>\207\357\250\223\301u\261\200\232\006\231ShFd$I\222a\rS\030 \030\030\024\0214E\216\251\017\023"
+	.ascii	"F\f\312\342\231\224d1\245\fs\250JD\202\264 I\2451B\027\\\022"
+	.ascii	"\237\3642\2009\302\251\3021\033]\0241\364\202\262c\364#\227h"
+	.ascii	"!\337\205m\337\307w\211\336/[\255\305\265\324\265'\320wG\331"
+	.ascii	"\304J\361\204\264\206\252;\023\034\354\254\263L\"\215V.\263\312"
+	.ascii	"\373#\317+y%O\001\007\262va]\026C$\031W:~g\017\264\007\226\247"
+	.ascii	"6\272\214\240\330&\233\256\343\\?\016\026Y\212\242\247\246YY"
+	.ascii	"9Iw\251\356\310\247Ha\322\326\177\330A\205\300\310h\267<%\324"
+	.ascii	"\232\356\026Tm`\327=~]\302KJH\b\003t\356\217\246/\221\213\205"
+	.ascii	"\304\260\264\r\202\364"
+	.string	"q\261\n&Ij\227@\031ES:\021\341i\362\034<\004\241\352h\177\216\017\330\\\220J=\353\001\367}%\177\377\356t\013\315\373\234\n/MedW\263\334\205\250g=.\310\213d\022L\227\204Z\264\326\224\013\277\f\306\327\237-4]\205\267F\353\257\374-\341\231n\f\016pK,bDJD\023BK\033k\250\252 \262\334\022\035K@l\316\272\222Q\241;J\315\344Z\242\\4D+\224\n\314\026`\320\306X\2513W\330\320.]2\302\b{\215.\3358F\3003\206M\336\202Gn4\020f\320\220\243+\272zyA\327\2445\265\314\212\020\326!\341\320sU\222\350\252D\033!U\302\333\336J\tT.\254\270\352\340\252H\037\177]\236\003\224,\253\305S\244gc\221\321$\316m\255\336p\220>\314\244\202\336\353A_\265\240`\202lm?\r\0042U\355\306\371\005DI\270.E\334p\212\267G"
+	.string	"g\273k,\201\353Z7\226\r\2343b<\024\f\323\236w\256\310^op$X\207\306\203\205\234\350\253:4\301\256\330\224zl\217\215\375,\032b\236\244|1\232\013\220&[\024\020:\350\360g\331\2703{\326\257.\313\242^\\\253U\315%,\005'\260.\030\247z\365\2006[EwY\0314\255C\370=vs\312G#?\374 r7\317~\222\256\366\333"
+	.string	"4Q\317)\300k\240%*8l\234\211\203\327\0072B;\352\2039tS\237\341\243\031\235\331\256\362\353E\027\334\rp\342\326\340\345\214\2370\313\020\344\314\3045\356\306\257\232m\264\244\250\333c[\360-\272\365\005\277\013\220X\322A\315RKf\343\242\321:\032\311\376\270N\204Dn\345\277O\362z.\262\033V\2141\222\277\n\022\241i%\254r\232\231\334\330\277\352\177A/7&\206\264\017\373\362\037N\026\224f\240\207)'\210\367\006\177"
+	.ascii	"DQ\037@\217\001<\374A"
+	.string	"\234d\212_ 9'\020E\361\003\036\2760o\260\r\324\355_x\217E\314\005\304\213yGD-\017\2170\005,\211\n=\370\377\032S\233\n\216c\177\325\360\232\3205\275\206V\f\245\004\n3\310\355\232J(\362\335\022\266&\250G\372\356\332m\324\311-\3123\274\246\214\"\350\374D\242\322\235\270\270#t}\017\207\207/Q\232Q\312r\234ob\235\232\262+opu\313>\202\021\255Y\240bO\0061F\272\355\241\325$\344y\031\346\324\323xs\353R\356\340\215\252\373\321\274r\234,]\330\322@\254~\246\t\240\264g\211\235\260\366\213_s\017\3752\262\260\333\206\t\266\002J\007N\353 \242\327\013\236/\021\006\002\211uoPg\257l\221\351\343@ a5\217e\341\354\336\203\336\303|\t\226n\363\215\003\211p\003\333\263\210\017\210Yv\020\331\220)R\310\020\023\211\353\252\003r0\301\225\213\224\344\177\237\305\033"
+	.string	"\267\245\315\253\221\320\"~\341N+q\261o\321\007WO\305\033\357\356\362|\007\305\300\037Y\0374\371BF\3264\f\3126\030pC1\n\2528}\241.\373\340\033uz\"K\032\333\b\321\317Y\230X\017\205\220\016\216y>\237sM\026\342!\020P\347\272-\202\211S[qJ\265r\202\024@M\237\215Y\242&\273\226#\032\025\213|\023\0322Sl\020\r\255l\177\321\006n}\3368zY\302\331\367\263\361\355\266\335F\347*KP\301\324~\023B\347/\016\220 <\021\003\016t\277\315\315\250\263\331\262_\204[\221\244\357v\236(\274\035\331\251\356\261\307\034\217\262&\260\032g\334\211\245\311[\017\217\234)7\317#!>y\031\371\247\274\006\\t,\362\024@W\352\371z'\002\315 \264\223\342\307\356@\323\233\263\363\206\303\f/\242"
+	.string	"\217\365\313\314\316\353\242\342\3751\024\257<\322\022\213\243"
+	.ascii	"/s\312\304p\363\315V\215\206\016\336\241x\024\315\355\320\355"
+	.ascii	"{\375\025\352H@\224D\316\3247\336~h\273|\336\201uf\025\f\203"
+	.ascii	"\2663\276QB\243q@\002\032\246-\300\317E\342Zw"
+	.string	"\221\310\266b\220\222\023Z\237=9\330\025\251R7@\222\003@U[\360m\217\21082'\364$\202\216\b\277NN\034\027).\347\370\024\024\017\373\2231\274\016[\344\034\372\372G\203\312K\267\236G*/\334\225b\203V7\347R\201V6]\032NlI\370\263g\343\004-(_?!\n_?\231\026d\304@\373$\251\223\004\030zQ\2442\261\2451\237\300\241\f\312p)B\332\250\001t\217\f\243O\b7\"tti\243\n\213\271\177\n\302\241-\260\243\224\\\202\036\316AC\f{\b\242\330p\013\362\273K\253do\333N\337\226>\250u\363,\023IAr\264HV:{:cV\032:\203N\307\205L\2662\2709\253\264\265n\216\243\316\244TC+[\346P\304^\035\017i\307\336\357\331\264!\325\b\307A3\251\271\"h\224\344\252\303\322\233\326f\263\374\356\020\216\2673\246\357\270x\314YN\304)\220"
+	.ascii	"\337l\0333\203\223\033\240\336\311@y"
+	.ascii	"\020\224\222\334\214L\265\036\261\346\347\262\330\316\364\240"
+	.ascii	"<q\225$\216kIs3\220\\\236\031\260\"?\b\024}?S\035n!\200\370\353"
+	.ascii	"\227:\002MP>\206h\013\324\346^\361\202\267\226\023o\262#\n\245"
+	.ascii	"\210c\264\347\270\251\034\255TF\377\354\202w\320\302\324GO\305"
+	.ascii	"\227,\321\022\262\322U\332\343\032\216C\026m\223\"\356\350\321"
+	.ascii	"\333l\244\2763|q\326#!\276\334F\2475k\365\261\262\265\343d\003"
+	.ascii	"G?\201NT\237~,)\371,a{\235\006\270\347v8-\321\267\233y6\335\370"
+	.ascii	"\305^*\211\203v\224\306s=W\332*\264\207vLh=;7c\326!\246\323\315"
+	.ascii	"\300\360\027|e\346\226\2339:\361\246\273\354\026\331\264\231"
+	.ascii	"X\247\211\213\335\301\234\253\301\217?\246\025[7tf\340\033\234"
+	.ascii	"\210,!\222\032\214:D\b\036\271\322+\331w\r=\221\357\320 \016"
+	.ascii	"\203{v\204~W\213\f\333W\t}.\244\220\356\203p\200\206\210\021"
+	.ascii	"B\342\252\212\0346f\272\004\033\264\340\023\275\305?\314jf\202"
+	.ascii	"@\334\232M\245\2261\r\264J\"\357{\254\351-\224\326Z\317\222$"
+	.ascii	"\350C\313\f&\354Q1\237\373\236\n}:\367W\312\3576\323YA\030\272"
+	.ascii	":SVK\337\334\265t\274\025AK\272\370\273\023\266\205\304\211\312"
+	.ascii	"\032 \251\301*\f\022H!\340z\322\361\374b~\025@\315He\220`1\340"
+	.ascii	"!\247A\267\222\257\277(5\203\251\337d\374\205)\036R\227~q|\272"
+	.ascii	"\374\036\334\317\236\025-M\356\344\243\202\r`\246\341Rc1\346"
+	.ascii	"\260\262\307J\256\312\036\333\020\020k`\206\036L\037\332@\003"
+	.ascii	"\237\303\263\331Jpl\255\224\3242\240\033\317\030oM\215T2\321"
+	.ascii	"\356-.\215\317\317\037\017\020\243\276D\352J\304\246a\241\262"
+	.ascii	"#\274x<5@\337\230\376\321d\364\034'x\224@d\035<\004\017\026m"
+	.ascii	"\337.\304\306\346\303\007^\023\343\003\261@g7\034\357\255~\267"
+	.ascii	"\344.\356\321\304\002\235\307\006\322\344\301\b\215\344\335\340"
+	.ascii	"\216p\007f\235\202#=se\245g\210\375+c\2032\211\003OQ\346,\177"
+	.ascii	"o\3037\347Q\261v\302!\"\333\260G\334\367\350^\271[\242\306\210"
+	.ascii	"Ud,\201\253\032\365G\327\264\216\244\tU\031~\247m\004\340\330"
+	.ascii	"A\007U\274\351\375\364\303\241\345\221\342UY\303pq\257~\236\362"
+	.ascii	"\355\260\321\305\036G\002\352t\025\234\325\2507\001\255\210\026"
+	.ascii	"\363[\2009X\263@\006C>3\351Wb\321?\2018\342\337\277\225V0\221"
+	.ascii	"\315\007t\343\031\035\241\313E\225f%\274\222\026\334\033v\223"
+	.ascii	"\221\210\005\240\317\031@MV\234\300\213'\354:\306X(\002\254\243"
+	.ascii	"\020\235R8\267\"\233D\374E@\037nO0\367\264\262\314\340kfR\310"
+	.ascii	"\274\245l\264\034\006\310wE~j4:\360<\004\211\232\2314\342\242"
+	.ascii	"Vt\253\n\254\360\364\267\347\315\345#\217^\345\004\321\336\355"
+	.ascii	"\307\367\034-?{,\313n\330(\021\3514\265\231IS@\\\035\207\332"
+	.ascii	"\223u\023\313v\374.E\305?\261\312F\212\230\215\242\361o'\240"
+	.ascii	"\250\217\n\244;Z4C'\345\313v\330$\310\301\217[\223\024A\336\375"
+	.ascii	"\367\030\377\017x\305\215\370G[+\242\b//\303\204\271\200\274"
+	.ascii	"\343_\216D\312\334\335\353\332\324\314X\256S\300\205\221\357"
+	.ascii	"\264D\017\226\3670`\347o\253\0133\266\300\234\001\212\350\036"
+	.ascii	"\314\322\347(3C\376\001\333\201SZ\372N\361D\030\t\312G\331\036"
+	.ascii	"\205\205\261@\223\256\251\254\373\342@"
+	.string	"g\360\n%\031Gw\351\0028\001\305\005D#.\224\220\356\325\235@\361\202\006x\323\201\002\n\241E\353B\236\320\247g\356\205\356\317N=Y>\312{\244s\315!\220\216\022\366\3729\373\013\234$Lw0\016\n\341\277\313\246\by\344\206\277\270.4\256\323\204V\353\305qNh\262q\353B\"\274\242\032E\226\274\214\260?\207\177\327B$\301\034\031\261\2134K\275\362[\342\237\361\234\220\377u\367\272\210\201h\017G\232\202\017s\215\364>\337\3658\247\020@\316\034y\374\224\242\351,\334b&\375\016D\274Uz\302\355c\261mMyg6M`\254\312{\262S\030Q\206[\305 \327\016\3734\"[\364\271\370\245\013\312nZ\270UM\370\022\363\316%\314H4E\027\274ik\252%\f9\337\036\217K\324w\210\201\0218;\034\231\231\240\237\321\016Ml\231\315\232\204(\032\001}?\234\372Y\275\016LU\340\326I"
+	.ascii	"\322\222\364\337\271\023WX\2365Id\031h\272\2700tF\352t\220r-"
+	.ascii	"M\300\246\347\222\261|\003\004=\316\3037\312\177;\255\273\204"
+	.ascii	"\300\2063\fj`\300\354\251\277\366\243~\220\305\213\244\205\t"
+	.ascii	"\206\357f%\bE\347\340\023){\353\274@H\327\203\216\362\260X\362"
+	.ascii	"\033b\273\022 \033A'\362[GR\325\210\032\323\242!\250\212\354"
+	.ascii	"\347H\245\331\273^\200U\020+\313:\236\201\243\263\335\301\203"
+	.ascii	"\357`b\302\350z\325\356\341upP8k(\2422p\252\347k0R ={6CJ\334"
+	.ascii	"\030\361\271)o\220\320`Aw,\364\b\216=A\234\343\225\244\301\266"
+	.ascii	"%\313\330\351+\250\324X}\t=\320\322x\236\016)\360\02009\201\215"
+	.ascii	"B\005Q\222X0\241\372\020\372\324:\266\256\265t\277\345#\361\242"
+	.ascii	"dh\177\245\023G\211\226\007\026\350#\314\250\301B\272\025\333"
+	.ascii	"P\221\271\337/\323\346\263\307\247\311\2062 G\307\224\027g\251"
+	.ascii	"GOr\350M>\261\243_\247|\274(\346\353v\246}\205\227\301:\n\365"
+	.ascii	"\310\253\312\323\275\033\203\253\026\370\202\266\267\242Ha\354"
+	.ascii	"\2247\337\031eLz\244\240Xh\357\276\271a~f\342\177U\023\bZ\221"
+	.ascii	"\345\216\203\017\020\257\320h\005\b\336*b\341\271 .\261\267\270"
+	.ascii	"kI\202\244\006\024\363\267\230\267\221z-\210\"\351\027,Z\260"
+	.ascii	"U<7\240\320W\252\033\007\r\013\317\277U@<\226x?`\222\204\220"
+	.ascii	"\265\364\231}9\207\375\034\215N,:_\350{\313\204\004w\303E\376"
+	.ascii	"*W\033$\"\034\241\327\003.\252[1\241~\365Z\2763\303;\226=X\322"
+	.ascii	"<\372\234\351b\3507ID\376\"\"Y\353\314;\333\037\327o\036\241"
+	.ascii	"\217\301\241\356\240\254T\227&\016\332]r\254\370\345\bMjL\274"
+	.ascii	"\214\342\274\304a\017\211\016\272\316\344\307\246\305\212\f\004"
+	.ascii	"\350\256\275@"
+	.string	"\201\341\370\025d\322\367\342\016\2410\364\177\177G\336M>9W\216rK\b\225\235\350\252\331I\305O\306\016\251\017\205\006>z\235\333\241\242\377\265+7\310\306\371W\217b\377\345\002\f\340\363q]\232y:\334[\234(1\315\255\022\362\370\024\374\322f\2620\233H\211\314\027|\02273\261\320i\326\210\222Q\352Z\367\326\241\245\332\360\251\263\016\265\373\233\252\250\201\035\n~&\240\227-h\214\245\2319\263_\237\314\263XK\341!\253\275\222\224\223E9\231sE\370T\206i\372D\037N\371F\212\201\321\307k\243\363I\341\024\2243a\336\336\206\373\344\212\300\255#\235\f\006#\300a*!\t'\240\352\020\024\263F\360\202>\363A\271\266U\2715\201}[\241!\234\001X\344$R\004j\232\n\376\3215\004Z`~*\205\2614u\023x+\002\311\223\310\272>\213\361@\210\212O\314\336\005sD\300u]\336\2048"
+	.ascii	"\253\212\204\216\346\224=E\3211\336\330v\036O\236\240\335\220"
+	.ascii	"\204\350\224T\355\333~\263\223v\2663U\251x\004*\324_!\"<-\243"
+	.ascii	"\021\215\022\373\236&\312\017\334\362C\024%"
+	.ascii	"\361\320\003\263jw\334\341:r\312\201\260\276b\233\t\311\316\267"
+	.ascii	"<?\204\005\007\332\325`\207\213\277\3430\343\032a\314+]"
+	.text
+	.section	.gnu.lto_mspFcProcessPushCommand.162.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`v"
+	.string	"E\n"
+	.string	"\306\323IA\020\347*\035\007\327&P\340\0016\0018\270\217\036\3416\207AbD \036\2040,\352N]c[\265\234_4\256\335\213\020C\227\n2\023\020-\242\224\214\225\3050* \314i\313G\032!d\313\224\0025"
+	.string	"8"
+	.string	"3"
+	.string	"\236>\341\273g\333\016\020\244Y/Yd\235\223\032\030\r\202\3352\234+g]Y\376g\336\275\334p/\003"
+	.string	"f\255\353f\264\273\326\330\214\344\236\267\315`[\302v.\273\262\234\202-\340\021h\261M\332\034\2334\362\351\312\313\220\267y\374`\227v`\004\336s\t\222@>S\355\303<\206|\355\303\336.J\200\001\273\345\307\013\340=\203w\276\007\366\330\241\217}\323\0232[\326\371y\034l\201Ks\346\244\254&\260\313\226N\025\373\335\356\256'\315\266\372\273\355\357^\373u\252\277Q\027\023\231H\311o\002\002\253\2614\375 \212\020a4\204B \004\212\212\211\322I\374,\202R\343\311B4\205\242)\334\320\2708\205\242j\fA\nF\2452T\341\n\205R\205\234r\357oz\\\363eP}\216\257\233\237\001\013"
+	.ascii	"\244IEfh0\242\236pa\272\006\222L  \374\247\246\300\335\342T;"
+	.ascii	"0a\352\001"
+	.text
+	.section	.gnu.lto_mspFcProcessCommand.163.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`a\006\265 "
+	.string	"\3267\307I\200\234Q:\273\022.a\026\020 \256dk\253|7\201\216b\342\024\267`\201\217\201\216J\017\200i\213`\373\310#\272\300\307eE}_(\325\275BP\244Rz\226\371\247\2464.\245/\347V\344~\3740\001\371$V\356$\003\260"
+	.string	"\255"
+	.string	"\260"
+	.string	"\353}qH\022l\354\336\345\202\237\374!\375i\263CT\272n\342\"I\205\037L\220\006\330\356\322\025\023\205\364\347P\016\235\265\314\267\372\022\342\227H\277\335\033\265e\312\275\313\006\234 \375\311\313\224\231\371UOB\344\244\f/\214\310\bI,G'm\356\275\273\334\005\240?g\347A\1776\217'\275\246\346\2444\364\234\265M\342c\210\361\305fE\026_;\240\346\2444\236\016'\250\323T\344\323Q\032oE>\375,@`"
+	.string	"\rEU/)\257\023\235\335\b\365\336A.\315r\367\3363o\233\220J\326\322x\367^\266+\322\351\254sfF\302\314E\314h\204+3\212WI\221\336{\201\250\004\177\006\310"
+	.ascii	"\371\311G\352\243Yo\030m\223uD\250\302\030<P\032-\031\333.(\245"
+	.ascii	"\0335\327\2221/\213\266w0\177v\357\275\334Q\314\270\236\333\233"
+	.ascii	"\374;\307\312:\253_\3769\327:\247g\362\323\316u>S\3133\232\345"
+	.ascii	"F-\333\002v\252\214\306\f\033\337b\336K\243\t\347v9\253\0049"
+	.ascii	"\326\237\365k\375\\\2371\023\371Q.\345[grm\350Jw.\366\372u\272"
+	.ascii	"g\n"
+	.string	"\223\3142v\357\3551\265\216xJL\032\222_BH|\351\230\263\216l7\354\276\306\232\244\026\021ctO\016\205x\254\026\277\001\366+\256\203\224]fhV!\224\234\314\231WD'L\031\341\261j\247\315,b\204\375\312\271\027]\3443\177\313\232\242z\230\337\306\321yIY9\317\360\321\310(\303\027k\022\303\037\263~\341\2039v\341{9\214\267@\177~\0133\247\371q03\247\261\353U\300\274\243-\343\235'\"\366\336[\234\365\216\333f\263\031\247Y\240\335&\256\304\226\354\033\266\331\235N\3336s\211\236\375\332\235\203\321E\326i\333\337:\226ue\001`\235\254j\226\350\364\261>\304\276c9\201\240\207N\343|XU\251\375\254+^*~>\352\221\264\257\365\tJ\343\273\216\004\004F>a\033\r\211\272'\034\266\220\007\016D\277\036\272\342\302p\350\353\001\205BFC\240Pp\370\263\271P\021\364\tO~"
+	.string	"$\001\310\204\003\b\020~\002\020\375z\315\275\237\340\360G\242W\264\353\025\355V\240(\361\333\365\204\303\335\217\017\003\203>\341\316\b\b\024\356j\313\373\216b\236\"7h\270\346)r%\355i\"T\325\221\251\336\372()vd6\203\237\335\304\314gKP\032[\211uSqf\315\\\341k,|Us\366\254-\330\261\314h\233\227\232\";\233g\264d\335l6\335\324n\006\254\252a\203\375z\353 %\0330u\214\003\227\260\234\236\016=\035\244\374\342\222\342\372\\\317\371x"
+	.string	"\021\200\205\250Q`d\234B3\024D\n\222\222$\035\340\242\221\252q\003\021\020A\213f\206\2440i\366\r\211\374\327\330\2238\234*\272\374\224\353\2379#\261\213\020\356\250\202\331\240\250\232\213\031\274@\220\2124\343:Z\342\030\250\302\307%|\247\003\265P\242]\036O\002\235)K\230=\333uZq\207\370g%\n\327\2071/hm`\202"
+	.string	"\250C\004#\202!\002\246.H\217*\256\325\225x\367\354\273~r(\223e-\223)\023\271\246\006^F\347#\235<\250\\\017\260\022>\307"
+	.string	"\033\245\242\2007*qz\"\343+\005C`1l\316^$\003\300\356\320\022a\372V|\023\027*\3666 t\004Y\253|\226\276\301\270\260%\347\237\376\207}\301\343`\234c:\316W\354{"
+	.ascii	"\212\221\246\037\250\302\030|\310I)z+\306\031\247\271\265~\263"
+	.ascii	"\211\223\2574!\302\222(#\367\270\321\342\017"
+	.text
+	.section	.gnu.lto_mspFcInit.164.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375 \330\r\006"
+	.string	"\322\312)3pU\323\001"
+	.string	"\240\\)O\033\257\202\356\355\035\231\317\315\205[\200q}\272\221&:\022\342&H\304N\350h\276\376\377\325\2031~\241@ '\346\026\311-S\257\226\306a\223z\321z\321\213\205\202\321\272q\324Z<\323*\033\305d\331F+\262\227E\3058*7\374\235\347\237\321\314\005\337\370\330{d\024\r\364L\370Io2\351_C\263\3703\344\200"
+	.string	"\264\002\006\335\236\005\205.\017\001\247\377[\275\373\013\22645#\004\320I!t7\345\322v;\273\357\2426\001\206\336N\204\244\273?\301\360\263\347\375\357\370\377\370\317\t\b"
+	.ascii	"3\003\236:C]\270\3175\334-\204\3612\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\253!\275["
+	.string	"z\207P\035W`PV\245\003\313F\247\001Qm}\345\357<\227\316\232\230\251\b\b\351L&_\001'm\332\276\375\035\215\214\337\"l/.ww\254\215\327\257T\237A\265\365}\016J\365\217V\361I\322\361\027\267"
+	.string	"\370\234^)\303_d>m\367A\3537\205i\007T\020h\253\222\244\035\302\001\270\001\310\001%\217\244Z\366H\242\226>\232\324\377\300\244\2265 QK\032K\352\221H\365e\224\3243\201\353\311\034\325\033\215\352\217G\324\217IR_,\252w\332\325\023\221\324\2071\242~\250\253\027\223\253\237RD=\025\242\372!\206\352\203\300\325\013\021Qo\033\242~\350V_\204\255^'D}Q\020\365Lj\365G\320\352\215\216\324c#\365Mf\365I\262z'E\352g@\324#!T\037%\250^\312\017\365D\334z#\261z\331].\027\245\005$\017\253\027\342D\250\022\037h\225\036\350R\212\322\370\020j%%\244\376\362P\037+w\250\207\225:\274H\371r\345\232x\016\365@e\220R\007\220\262\006\016o\"\365\243\236\310\217\213\351@\365>\224\277\241^\207\333P\317\003\r\036i\322\3455\324\347p\037\365="
+	.ascii	"\271\"{\217\372!%\003\275,\262\363\250\027R\322x%!J\341 \342"
+	.ascii	"\357\250\367Q\352\370\0224\274)\307\2033\374\207\343\300\033"
+	.ascii	"\367b\343\275\237wy\340>{ j|\313\353J\320\270\226\273\016\245"
+	.ascii	"\376\211\f\347\305p%"
+	.string	"\030\236\304\013\347\342\302s\013\027\262\360%+\034\314\214\177Q\341L\021<K*\205\367\220q$\024\256\344\204c1\341G%<I\214\357H8\222\021n\004\214\347D8Q\b\307A\360* \374\366\301k\036\234\326\301\217\244J\"\037vhzQ\037\204\203\353H\225Q\262\034\331\240\376\206N&\223e4\250\337!\203z\034\312\023.\227\313\205A=\220\362\202\363H5\245\267.\t\276\303\202_\251\340V\f\240\340K)J\251\312\365z\271\212\240\264R\312\363q\035 \220a&\250\377QRJ\017\020\n\305K\034\n3\017\007-\360\207{\273\034\356\336l\271f\205.+\211YH{\274S\314f\rY@K\305l\226\317\366n\025\263YE9\227Y\271\313\272]\226-\263h\2275\223\261\202\260\230\315\212\261`\311\314\273QQ\314^=Y\214\264\253\243u\312\303{\234\037X\210\301\237\257\227W:{\002\240\260\330\220\301"
+	.string	"0{\025[\301\222QOH|\352D\210!|\304\2410\230O\277\024\207D\365t\031\227o\270m\367\013\034_\274\246\345\236\265\354\266\220\355Xn\330\023>b\343-\022\361\320\002\355\222\331\345\317\267\263bv\271\263\345\320\025\263K\334\r\333pi\263Y\314.k\345\254\224\335\022\366d\221\370\003\324\210\320B\231\314\2761\237\005\305\263\341d\257\200\221\032>\252\305\354\017s\020x\2250\373>\373\2320\027Hgs\230\367\333\335\222\215n\2634<\2732\233\203.\227\034;,\313p\257\300\027\027\322\n\331\211\3313f\364\314\226\221e\334\0308\206\335b6\f\234d6\f\230\331\"\344\017\256\007v\203\214\013\260\\\314^\201WX\001\272\230\035"
+	.string	"\316*l\212\3143;\205\315\3155-)f\2337\323\334\247~\3001Q%\263W\334S\245!FF\252\004@\253\270G\340\b\025!\324\t"
+	.string	"M\223\204\242g.\017E?\3772*\262*T\tE\253p\322L\037\337\272P\232i\225\305\267I\252v\361\023.%Uk\251\017b\252\177\312R\017\205\245>\352J-]Vj\371Z\252\245\255R\313\037*\265\2641\245\2267\244\324\022G\224\372$\224Z\316\360\244\22648\251\345\016^-s(\325\251\036\264\034\3779\227\224\334\270\215s\265#\nB\207g\337\236]\203\263\320\242O\267.\315\245N>M\363zW\031\223\004\325\302\247\263\220\0347\372\363i\025\366\342\323b\310t!B\233|:'\005\257\247mpRO/Y\372\251\241\245\324\323\3465-MRO\317`1=\255\272az\006"
+	.ascii	"BBD\211=\375\202\376zz\206\330\242UM-\372w\330\242U\244\260K"
+	.ascii	"\360t)\"\021Cy<Mc\301\360\364\314U\345\257\330a\344\203*\361"
+	.ascii	"\364$\361$\b\035\362\264\013\372\343i\025~\231\264e\211\"\224"
+	.ascii	"\307B\310\242_\004Y\374Xt\026\035\220\2149\370\r\206H\020LP/"
+	.ascii	";m\363B\261\3235\367\315\244)h\211~\331i3\2336\270\3234\230\267"
+	.ascii	"\3233\3669F\030\231T\277\235\376\005\356\264\013\332\264\323"
+	.ascii	"\005\\/:-\300"
+	.string	"\225\242\323\001`\0258\347\246\260\261o&B\256\025\252\244\323\255l\342\267Oh\324\204:\321i\232\213y:=\003\324\311a\372\201B\233t\372\226\376t\372\327\327@\277\240\271\201\316\321\345\206\354\r\333n\2156\2639\262\233#dq\220\215\341\034\330M\332\247\233\221G\243\323-\332\2410\230\201\370w{Ey\227w\366\211\3318:\233\2638C\026w\263\331\032\246\3152\216\fG\350\342\3040\016,\031\205\237\220G\353T\304D\243\031<\264Xh\203/\225\3317\276^\321N\227\273\307\301\201\206\030\334\205b\366\315\355f[\215v3\273\262\033\331\215\020\276\t\26271\373tk\214\270\246H\034^\341\r\002\257\257\227\213rM\321N\227\033\302\335l5\232\255\231Y!\\\023dk`I\034\205\2370\022\037\255\321\026s\324\201#\272\244U\300N\212\3249=\024\251S\360P\244\266y\261\240H\335\352\355P\2446\215\256"
+	.ascii	"\025\331\024\035\212\3244/\244\336\300\244J\372\005,#\227\200"
+	.ascii	"a\334\344\212\234l\203i.\027z\324*{\203\036\265\013:\206\036"
+	.ascii	"u\253\330\"\3321g\006\332\337\365\341S \020\362K\021\231\263"
+	.ascii	"[\273|\n\346G\222\330\320\305\335l\271U\243\341\026\355\346\326"
+	.ascii	"\254\0254\246\f\257\025\263G\326\321\0261\361\016\261Ph\203\027"
+	.ascii	"\210\177\3706\310\233\357\3660\361\334!b\332\341\246\254\263"
+	.ascii	"\303\314\032\262\371fm\267\206iy\206e,!\313\n\272\254\030\316"
+	.ascii	",\230\215z\312\310#\376\t\240&\034F[\314D+\\\365\356j\247\313"
+	.ascii	"5e#&\236\275\032\262\307\263W8\230\317\331\253\333\265\3452g"
+	.ascii	"\257d\031y\366J\3102q\366*\b?"
+	.string	"\235\275\202\335\250\374\224\033y\314N8\023o\036^a\020\210\363\357f_\3576\021uv\027\355\256\016\3774\034O\271!\334\265\325\232\326\263+\303\262\344y\242\307\016G\007\335\374\024\020\013\3240[&/\362\036q6\332\241\020\337uv\031\264\300[\372r\331\303\271\310\352\362\251\230#\"L\247qv9t\377:\273\304\345S/\366\013\276\335\332\245\025\317.e\371%\031\343\021B\367)\250([\031+a\311\034\345\204\237\300\222\016\037E\242\025\336 \316@\373\2737\241\212\304zXws\257q\366q8\337\354W<\274\350\240\303s%\304\376\310\360\202\205:{\206\f\024\354)T\361\006\0339\206\025\341\003\017\356WG\232\214\334\236\324\027U\204\246\242\351\354\234\374\202\306\250\302\330\214\244\207\212D\223$i3b\f\210'%tU\352\022\240qy\016\202\271\346\004\022\211H \"z\351H#\004>\324k\211\215\353\361"
+	.ascii	"q\256i\026\002\366\306\346\020\215q\220\352\347\355\243\234\267"
+	.ascii	"\226\3017fne\344\221/\n T\302\206\251hd<t\260\274\253\024\320"
+	.ascii	"\222\307\214Bo\266\356\ty/\200\2240\342i\354\304\3659"
+	.ascii	"\301\254v\376z\016\276\264a\203\376F\373)\034\3447Vo\323\023"
+	.ascii	"c\342\374\334o\3416\370\005\240\253\347k^g\254\316W,\005\342"
+	.ascii	"\261>\f\232\270+\310}\214Q\271\322\273B\231\375\222\004\227\303"
+	.ascii	"?n\245\253\311D\025ng}!\316wR8\275\n<g\263\372\200_\203B9D\274"
+	.ascii	";\227\273\272\254\357o\274`\221\270\366SM\031\275\335\b\312\205"
+	.ascii	"\361\363\334\374\006\274\327\002\373@N\330\271\t\3208\n q\211"
+	.ascii	"\224\260\317/ \177\035\371\013\244<W\316\263\364\353\334\237"
+	.ascii	"?\013\343\223\350v\036\3225D\357_y\025<y\033\374Ye\335\021\373"
+	.ascii	"\033\235\024\315\262o)n\212*Y\277\355'\203\350\304Bi\260\252"
+	.ascii	"P\360k\217\377\341\201\231\005\2146P<#z\243\027\342=Hf\351u\272"
+	.ascii	"\005\222\226\264\205\223z\021c>H\013\374\030G\337ld\375\002\031"
+	.ascii	"W;\312\217$H\352'\250Wr\337\031\361\256^\032T\201y\035\fFhnC"
+	.ascii	"\250\"\003T]\034bkkfc\315m\373\240\260j\200\303\177"
+	.string	".Ss&\276\276s\353\305P\320\312\301\026\242A6\313\200\364@\006\200\351_\204%Y\344D\275\366\270\306\2059\327\020UH\362\252\322\272\370^.\035r\226d\206\310\272\264\037/q\235\036\356\355\371}\023\211\374m\004\306:\032\215f\225\246\373'+63\203\206\353\025I\307wMF\002\312\221I\036m\202\216k4U\252\222\271&\376\036^\327\355GW\313\023\322\2134'\0335\227\375\223ci\021\263p\027\275\267\230.\323\027\315\303\026\236\264\223\344\371l\215\307yRW\245\312\315OL\304y\354\346\001D\220}\"\301~$\363\3046n_\264\252\307\212\346\216\3710W\206\257\247\223}\307I\023\232\362\346\314\367\333\237\017\235\347[\tn-U~\371K\342\326\020\336\374\222w\327\206\024>m\353\337%f+\277\f\357\352he\232\3117=\347?\376\036\236\350\327\311?\020^\177\b@&\365\320#\216\024\2049\007"
+	.ascii	"\307\341\342\272E\360c\204\353,\215K\274%\360\271\221\234\235"
+	.ascii	"\303B'\365>\217O\233\344\352lD\237\316<40A\370<\177\304\205\351"
+	.ascii	"\314\376\020B\300\371\023v\025<\351\3049\034\024_\301\276\216"
+	.ascii	"\313\035C\220pb\020\006\276\200\227\002\236\231?/_ x\3722\035"
+	.ascii	"\306\306\341\337\024\350j\316m\007\204w\373\323,\253\366\032"
+	.ascii	"\365&\276\310\364\347\366\006\334\312c\370[\032/D\227\211\343"
+	.ascii	"\365\216\245!k\r\353\202v\323\274\353N \372\223\235\322d\262"
+	.ascii	"\311W\250\033\343(\223K\262\240P\232\n\306\374x\"\026\321T6\205"
+	.ascii	"e?\245$yN$;\366q\245\241\027\006S\016\370+x`\272\022\213\342"
+	.ascii	"8\222\362\375Ei-\232\276,jv\256\033\306\346\236*\331\260\364"
+	.ascii	"\f\027\f\241.v\f\237\365\032S\357\344\236\352\306\203\\)\006"
+	.ascii	"\201Q\257\371!X\210#\366Pl\370\205;\003\t\375J=\017\202~0M\243"
+	.ascii	"b\337YF\021Ho\326\331x\220/\305\020\032\365\233?\005\212q \002"
+	.ascii	"\3402\272&)\251\202o\\ \204\023\210\344k\265\335\232\223\033"
+	.ascii	"\223\370\263\252\372\323\037`\300\222\251\342\301\220\340d\032"
+	.ascii	"p\364\314!;9y\316\262'\264b<G\342{\317\005i\323\333\245O\325"
+	.ascii	"\255]\373\370xxP0\274$3\325 \373\222\030\231v\2725\022\205\367"
+	.ascii	"\314=`\263\376\205\252?!Ac\372\2126\026jY\357_i\375g\206\210"
+	.ascii	"\376x\201\004\246}\016@\237\007\207P\324\225\336\332\344\347"
+	.ascii	"\246\253V"
+	.text
+	.section	.gnu.lto_.refs.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\225\0055\033"
+	.string	"\326\371\271I\240\222N\032\003\3765\002\316;\274;1#\274\207\377+\341\"Z\333\205d<\357\377h\357,\034\355I\255\323U\234\302x9^\216\227\343\345x9^\216\007_\013\213\370\351\274\371\377\256\017\356\306\375\375\331\215\2725\2627\3312\005\227"
+	.string	"\261"
+	.string	"\253"
+	.ascii	"\277\247hg\276\247b\f\236v\365\236\362\300\262\212yj\243>M*\237"
+	.ascii	"\036\225s\032\202>\345\201y\252\003\347\326V\204\371\221l\030"
+	.ascii	"\366U\376\310\365\362\343\324\202\371\310\204\002\211\367#\211"
+	.ascii	"! \037\227\037y\246\2601I\342\362\263\b\261\345\247\226\202\237"
+	.ascii	")\022\374$1\004\204\340\247\317\201_),\277j\006~\207\005~\253"
+	.ascii	"h\020\370e\241\362CY\371\325V\346\023U\276f\300\013\005\374L"
+	.ascii	"\200\001l\321\367\250\337R>\202r\036\200\276\243_\254\377\220"
+	.ascii	"~\316\370*\363\347~}\022D_:\341|\331\344\373\022\005\022\021"
+	.ascii	"\020\357\313\rR\2420Qr\204l\030\346\265\305\373]\226\025\325"
+	.ascii	"\f(\247\246\230\337\251\250\360;%\243\020\275\337\005\371~\367"
+	.ascii	"\341\346w<6\277\323\201s\243\360\272\265'i6\257\273\3021\025"
+	.ascii	"\025\343\211\251\346uIF#~\257\033\022\276N\347A8\327\355\304"
+	.ascii	"\035\370\\q\t\315\347\312\306\202\200umM\370\034\226\325\r\251"
+	.ascii	"\031PNM*\224\220\212\210\204\204\237\373\t~\256\007\3709\035"
+	.ascii	"8\267\266\"\360\3114$\022\236\034\002\231y\022G\324S\204'\227"
+	.ascii	"d\236$\202\360\025\355\301\3273\007_\265\032|\025\001\374\332"
+	.ascii	"\363\373\252!.\323,\231\247T5d\374v\2324\236c\247E\347xJ\024"
+	.ascii	"\304a|\272\323\333\307)8\373\b\347\333G(khG\302\276\270\252\244"
+	.ascii	"\242`\270hZa\342\210\367c\021Q\314>\002\335\354c\007)"
+	.string	"ojM*\354\023\355\254\210o\237\304\233}\206\361~~\371\330\322\242\260\317\253**\233}>m\265O\246\336>O \031\305\354S\350\207\303\316\233\223\2621\227_10/\256\036Y0\373B\275\314\367\005\357\267\005\323\222\322\313\276A\345\357O9\237M\211Y\031\357'\016[\366\201\370\366\275|;\315U;\313x\316n\270\224\2620/\241z\001\377\224\2707\267u\374mk\305'M\322\220\230\031!\016\021\002\366\345c\213\007\335\317\252\373XV\301\317\241;\206\272_\250\217C\367\233\272\327\320]X_\206\356\017\352\336\240~\217\3560u\347\321=\001\335Y\352\253\320]@\335\001\324'\351^\353>\351\314\020\2344[\331I\342\312\234d\261t\342\267\223%D\004w\322\247G\270\223:Nh\366JdLH\330\217\256\t{\335\332qU5EC\006\214\027LKJIG\302\275\216\b\356U\b\350C\007\036\340^5"
+	.string	"w\n\027E\302N\331\2123;=#\023\213\260\001\200\276\244\021\240\306(\211d\024\031\024\244\320\001PSQ2\034\001\240 _\246\031] \2072\310\347M\006G\230D\346\246S\215\335\37362\n\206\231\033 \231C\005@y(\001\230?\354\272\230\031\211M"
+	.string	"\021\352Y\207{\232xJD\332C\3005\224 (\017\025"
+	.ascii	"\311\205T1\n\245\003v\245\366Y>\202\021\025\266\355-\024\231"
+	.ascii	"\021\021\360\352|&p\\\303J\231b\330\006\350\264\302\250\002"
+	.text
+	.section	.gnu.lto_.decls.cbc1029dbbd0a88a,"e",@progbits
+	.string	"(\265/\375`\336\315\245N\003\376A\005\250\022S\020(e\3514\006\277\370P\246\206\304\226\345\032/\237x\223c\004!\003\220\231\254\260\036\030\032\037\"\021\353`5\363k\351\207\313\200a\0138\\{T\002"
+	.string	""
+	.ascii	"\f\267\212\004x\274V\207Q\241\261g\234\tG]CR\025\225B\022\240"
+	.ascii	"&\"B\344\336[n\271S?\020\245\022\221\023i\326\351\212F\225\256"
+	.ascii	"g\3262_\315\250xW\207_T^D[\257*N{a\232}\341\226}a\224}\241\222"
+	.ascii	"\375\257c\354\326\240ymY\307\255_\214E\027\342x\213\212\2305"
+	.ascii	"\214*]\355V\273\025L\366R\351\210\350&j\323\016zm\017\213K\253"
+	.ascii	"/\204\356\253f\344\246@\351\326\272\325\213*]\277<\207\351\222"
+	.ascii	"\273\214l\034[\265A\277\254s\271\313X\024\215\235\204E\314\274"
+	.ascii	"\346\366:8\235\b\351\333\372B\250}\241\322\2760i_H\264\377\225"
+	.ascii	"\013\026h\322\224\232\254W,\253\025\262\351\331\032eF\332t\305"
+	.ascii	"\262\276Aq2\275\262jY\341\326,\353\026U\272bY\325\244k\2252h"
+	.ascii	"\034G\261\254b\253\331\226'\256&\"\364\340\272\"\352\007\351"
+	.ascii	"\366\203oTV\2676-2H\\\262~\260\214J\333\017\\RZ\326k[\376b\252"
+	.ascii	"\233\223\312zM[\331\376\007]\256*\26116)\\\324\326\302tZ+\277"
+	.ascii	"\2736k\253\232\266\002\245KX\326\017\"\331A h+\224'[L\n\214."
+	.ascii	"\353\007\231\320\236\f\267\242o3\236\250jC2O`d\200k\264\311\227"
+	.ascii	"\227\032Y\177\227\331W\245k\331\352$H\330\215\257NV2m\006K\240"
+	.ascii	"_\326\353\030\261(G\333\227\254\277\353\366\367\333\376\327&"
+	.ascii	"aQ\253\260?&_\303\376\365k\005Sg\240Y\342\313:[\2519m\006*N\253"
+	.ascii	"\332\201\370\312\304\370\024\006em\211\222\277#\350\233\254W"
+	.ascii	"%_\345\234\312\314\310z\365\002\3615\t\273#\016\210\221\254\207"
+	.ascii	"kW\004_U~dAW.\266XNM\326\353\226;\265\007\210#\353\357\263\235"
+	.ascii	"\225\311\200p\260\002\204G\0255XP{@\326 X\027T\251\202\005\205"
+	.ascii	"d\035\262\026Y\217\254DV#\252t\325\3723\216U\210\231Uk\245\312"
+	.ascii	"_*\035\221\270\210h\204\025\242\261Uk\355\261ZQ`\224\024\027"
+	.ascii	"]q\250\362\005\013jo\325Zw\250\200*\335TL\244&\003+OXP{q\034"
+	.ascii	"\355\340\352Pr\346\305\250\277\253v\216\327 +\226\224)\277\033"
+	.ascii	"Y\257WtGV\b\024 {Y\177\343\330\337O\373_\255\326\037T\312\244"
+	.ascii	"\340\262^\253\206J]V\236\262\376\236\261W\037W\231\272f\304e"
+	.ascii	"\375M\264\357\346\355\273f\366\3350\373_\247\256\002\212a\301"
+	.ascii	"J\313\372_u|\305\241G%N*\353\347\242\025\307\352t**]\232\ne2"
+	.ascii	"e\315\261J\251\322\025\307\nu\225m\215\272\006\201c}\2129\210"
+	.ascii	"\002\366\320\351\320&\325X\302\325j5Vs\332\273\321}7l\337\025"
+	.ascii	"\262\377\265\351\253\2151`fxd\035\2576\262Q\276\241\322\245\351"
+	.ascii	"&^\246\361j#+e'c0\216\257\346\240q\034]md\250\225\006\221+\305"
+	.ascii	"\215Oj/\216c\276?\004\021\253\r\265O\0054\022E\343\246\026I\314"
+	.ascii	"\267\336X\231\326\245UI\225\2566V\244\257Ik\215\353\350\fmLm"
+	.ascii	"\234\021j7\252\346\264\337"
+	.string	"Sq\332\267~{\235\021{1C\306J\326o\363\366CL\311o*\333_F\222\275\326\250\333\tX;@\240e\266'L`\371\tV\323\364/\027Q\253\254Q\250\033\345\tU\376\313I\362\327\032u\333HO\2462\216\277,$\023\221b\304\303/\367e\3005^\215r\340J\264\026\255G\2524\377e(\317q~\212z\376\313V2\337\b\032N\f0\362\241\216\375\345\0349\210\361(\032C\205\210\266\341\002\026\307q\207\016\035\324@!KS\032\364\233x\330dG\227\215\254\337\236\245\311g\2400e\034W\262\226\0214\234\2026\354\2502\216\274&\253\021\302c\n\002M\006\003elK\0063\202\206S\220\311n\3074\216\243kr\230|\306\be\212\207\324^\233\354&\353\345\274\314&\357\251\322\274&O\237\243\262\324u\214GzhaF\375\026\272\337\372\330os\354\267Le\262\031</E\216h\274)\223\361\022"
+	.string	"\205\357\212\3143\336\261KK\322Y\326\371.\317\261f\332\316\222\262\316c\366\025U\223i\326Y\214\312\2065Ff\367?\270\236\215\261)\263S\325\344\224\214\320|\311ut.\234\236\0303-_2\035\032$)l\262\316tE\2749.h\3269.\317\255i\022\305lN\2165\273\301\004+Z<C\244\326%\207E\020\274\3221\307%\353\314EX&M\334\233\252\306b\2651Ce\rK\316\002\327v\335\025\t\314\372\354\030\0268\255\266\203\b\026\033U\232\341\330:%[kY\237U\262\317b\271\345*T6\022\273\036W\262>\313\344F\005LZ|\227u\246r4-\036\021\026>\266F\226\242\346\227\243\nW\326\327z\373\2524\257\251\345)Jj\260e\235\325"
+	.ascii	"\2111\005D\276.sRY\237M\226\376\017\032\3058\241b%\353\034\305"
+	.ascii	"\270T\027_e\375_\225\346(\031J4\326\t\266\271\373\023\313\372"
+	.ascii	"\272\314\276\026\263#`\237\204 5\311:\233\345&9\252\322M]\210"
+	.ascii	"\217\332\264L\3438>S\245\331,\207u\210 CM!b\247\365\377\\\246"
+	.ascii	"Js4;\321\t\221\243Y,\223\251tS\321\030\312U\233\212\361\332\213"
+	.ascii	"\343\250N\007\315diL\214\326\327d\373\252\364g\362\330\321h#"
+	.ascii	"]r\220e}\r\266\257\273\3665\222}\rd_\373\330YI^\242J7\310L\242"
+	.ascii	"\307l\344O\355I\326\327R\373\352\006\355\032\030\250n\320^/y"
+	.ascii	"\375\331H>\222\273T+\250+foY\347\255\314\245J#\310\320\347#\325"
+	.ascii	"\314\331\242h\034]C\304\350)\353\353\031\333\003q\254F\320\252"
+	.ascii	"\201\201j\004\355W\300\r\202\232\323\266*N{75\247\375\252fg\345"
+	.ascii	"!*\2306|5\352\262\266l,\235c\224\017iR\326_\321\366C\350\310"
+	.ascii	"T\253\231\323^\023\0228\315V\371J\225f \231\307u4\316@r\217\374"
+	.ascii	"\303x\024\215\237\214C\222xH\355\305q\264\203N\207\342\332^_"
+	.ascii	"\216V\373\310U\307\033H\220\214d\375\225\311\307j\264\237\321"
+	.ascii	"\344\035\031\n\212V\215\254\237\353v\236\272>\263*\256E9\344"
+	.ascii	"\250d\375\034\267\237\323\366\005*N\273\306jN\013\202\212\323"
+	.ascii	">\243\3556Vs\332\274\224\231T)\207\334\024=\006\305\344\371H"
+	.ascii	"\313\372Yl_\345\320\0369\264\317C\366\237g\020\345\242l#[\021"
+	.ascii	"\335\374h\344\310:\323\310H\252\364p9\351\271\206\032\346\301"
+	.ascii	"\243h\214\246\026\311BT$k\375c\307\210\3438V\017\327\272\201"
+	.ascii	"\201\201\201\352\341\332|\004\342y\306\352\206\205\206_\326Y"
+	.ascii	"\305i\237q\354\323\2519-Q\305iO\247\342\264*`V\377\324\300\253"
+	.ascii	"\200\252\337C\020q\342\221\n\250\343\270HU10\252*\006,\034\222"
+	.ascii	"\242'\255~n\332W\331\354O\337\344\325E\325a\311\372!\322(\341"
+	.ascii	"\225i\202\2329\243\2521A\3438z\021y*\032Um\215B])\326\3224\216"
+	.ascii	"\243W\303\374 \362\3241*\031#Q4&j\237L1\361\355\305q\374_\325"
+	.ascii	"S\335\250mT6\352\236*U\363\324\351U5\352\232\253\035:\350\254"
+	.ascii	"W\230nD!j\225\210\232\323\346\2508\355\325\266}\325\311\276z"
+	.ascii	"d_\005\262/<m"
+	.ascii	"\0355\247\375\325\273\253d~\325N\025\243V1\3221a\"&k\225\r\304"
+	.ascii	"\325;a\333T\254)\353\253J[MRsZ\f*N{\201\232\323^\225\252`\252"
+	.ascii	"\230\300\204G\031+o\321\341T"
+	.string	"\322\024'_\254\250wP\037]\350\274\254R\316\334\252d=\027=\212\343X\247\310g\204\317(\353\2534\366C\374 \256\250pF\242\013\261\021\230=h\034\243=\304\257\262\375!\210P\271\250[T\2705\nu\327\300\360M\343\030\r\004\027u\212je\004\r\247\370\b\312\023\002\200\244A\302\261\027\307\321\377j\0275N\225S\245*\027\025\313\325,\252\226\353D;t\350\240#\204\276\311\261\266\365Y\330jT\315iuT\234\366*v\224\330\324d\304*\353+`\377\252\22571\251\254#\321\2618\216\217\301*}Kpd\255RQ\335\256VQ\333b\265\212\bVq\\\244V9\372\305q\321QU1PU\ft\023,\256\265V\337\204\375\003\354\013R\324\265\026\312$y\231]]\373\3253\365\211\252v\2018>\212\343\030\002\227\356\306\221\251\254U4\025\212*\255@M{\b\"\276\022\235\305cq\034=\026\001\303"
+	.string	"\373\262\276\210M\334\271\032\345\306\253X\304\363\276ZA\253\006\252\025\264\352\236\232\323Z\240\342\264j\024\304U3\234\326i*\032\247\305q|\034\376\261\255)\312\032"
+	.string	"*N\373\253e\025\034\2439\226\2028\341P|#\306\b,\353_%\373U1ul\2035I\311*N\213\343(\206}dE\312X\326\217\2529\355VqZ\226\007\313\365!\362\327.\240\\\261\237\265\021\273M^\270a\277\036\203\254\300\257\037p\235\026k\033\026\211\005\377p\002\277\036\363\257m\\\260 \377\377\206)\334\257\377w\353\214\177}\372[!.\223\177]\300\277\236\320\026\344\270\354\345\317et\005j\260\210\273\204]r\225\374-\324M\362\263;~\275\001\315\201%f\253\024wC>R7h\245\256W\273\346v\375j\022U\311\224\234\325^q\241\231\205?C \247\360\277\313\225v\314\345\312\320\334\244\345\362k\b\334\255_\005\301E2\347\036qc\200k\344\317F\035w\210+\344w\177\270;~W\207\216@o\370\335\247_=\336`\243\324\023\376\341\006Mm\224[\343g\221\334\244\r\376\334\230\t"
+	.ascii	"\377\260\002\247\213\324\342\003\303Ugqi\374+`\273tg\374m\220"
+	.ascii	"{\364\307#C\230\367\267\022\370]\243\277\235\300\357\026\375"
+	.ascii	"\255\253\377\257\201+\340\372\307\346\255~I\227\350\032P\340"
+	.ascii	"\306\277\366\271\007\2770\315\353"
+	.string	"~\340\024\260I\027\376!\206\r\322~\374\203]\277\306`,\376\352\330\257qZ\245\326\206\353\201\326(v;\2405h\237s\370\2079\177\013\243}\341r\240\345\200\273\201\277\265\200\253\201\377\032h\346\025\355\363\201\241\353\312\310X\377J\346g[\370Y\240\337\215\361g(\177\376\360g\022\177&\300\237A\370\363\211?\033\340\317#\374k\333\277\272\375Y\304\237A\374\353\333\277\262\375\231\204?#\340_\341\376\034\377\253\224\337\205\361\273/\334\241?\327\370]\370\317\035\370\363\007\376\\\364g\244\337u\376\253\227\237\365q3\360\257k\377:\345\317@\376|\366\257T~W\350g\225n\363_\257\376u\353_\271\376\025\311\317\"\177\366\002\277\313\374W\254\177\265\372\327 ?;\0017hU\372\327\245\177\265\361\2575\376\365\306\317\006\336\005\372W\246\337m\341w\227\377\272\343w1\360\263\017p\177~\327gm\361\257/\376u\350\327"
+	.string	"\370Y\026?\333\342w{\232\377\032\364\257@\377\332\302\277b\340_\205~V\205\373\376k\003\376U\002\377\232\\S\370W\025\3765\002\377J\201\177U\300\277\256\370W\007\374k\005\376\325\002\377\272\302\277\242\360\353\345\032\200l\367\273<\177F\363\273\312?\233\371\363\231?\247\371\327\t\376U\202\237E\341gS\374\256\213\177\205\340_s~\366\204\233\374\327\341\277\032\377\265\370k\n~\226\204{\001\366"
+	.string	"?\213\200\337E\256\371_\325\277\305\371]\013\374\255\206\337\255\200\246\372\263\233\277\265\340w)\340N\340gEp%\360\267\002p#\360\3472?\013\302\205@n\373\363\224?S\371\335\007\374\354\007?\353\341wY\310G\376\274\365\347%\277\273\302\237\245\277\333\342g9pY\374\271\310\317j\220\365\273+~6"
+	.string	"\256\003\376L\343\3177\376\254\304Z\340\252x\027M\305m\300\237\225\177v\361g\237?\367\374\371\375\265\004?;\201\313\200\314\342\317+\376\374\200\337U\341\317\020\370\037\227%\360\273)h0w\001\377\243\374:\002W\001\177\026\341\317\005\370\363"
+	.string	"\376\314\301\237C\370\331\013\352\237\333?\007\377\314\376y\370g\367\317\373W\335\374y\375s\376s\361g\323\374*\232\237\035\376,\361wS\374-\007?\273?pQpO\370[\016.\212_\365\362\253_~u\356W\355~\225\356gW\327\204_\325\362\353@\367\304\257\202\375\332\257\025\341\232P\223\374\232/\353W\267\376\266"
+	.string	"\177k\200\337-\341W\243~\355\306-\361\267\tpI\374j\360W\227~U\370\253\036\370\325\033\277:\343\327yn\002\236\367k\247\213"
+	.string	"=U\317\324'?\233E\227\271\007@\321.\340\327B\256\001\376\305-\300\317~\371\331\272\337%\300\337\272.\t\023\370\317\200\177\335\300\237\267\374Y\356o\217\177;\301\337\356\374\252"
+	.string	"\376\254"
+	.string	"\343u\376\273i\340\216\360\273\"~\327\303\357v\370\335"
+	.string	"\374\356\216\213\201+\201\227+\356\206\177m\363\026w\352\217?X\305\r\310\317f\371\325\243{A\373<\370\007\205\374Z-M\345im\374\352\b\255\226\377\177\033\\\203\337=\376:\252\341\017\022\375:\001?[\345\032\3775"
+	.ascii	"l\nn\321\204_=\272\304\377im\225;\374\337\342\357\023\374\303"
+	.ascii	"\001\374Z\215\355\342\n\377W\371\331<7\370\345\212\376\342\356"
+	.ascii	"\377j\277\026s\373\237\341\277\004N\301\377\026\277\353\376\367"
+	.ascii	"\342\262\277\366\371\005\177p\311\337\252\370\325\026\352\n\277"
+	.ascii	"\366z\373\013\355~6\347\277\372\013?\370\365\227\277\005\374"
+	.ascii	"\333\277\277\365k\373\376\226\357o\367\376\326\315\337\266\371"
+	.ascii	"[6\177\233\367\267k\376V\315\337N\3776\315\337\242\371\3332\177"
+	.ascii	"\213\367\267w\177;\206\313\377.\377\347"
+	.string	".\301\037\204\362\267`\376\366\313\337z\371\333\270\277\205\373\333)\177+\345o\323\376\366\311\337\232\375m\331\337\222\375\355\222\277M\362\267]\177\273\365\267G\376V\353o\263\376\366\307\337J\375m\323\337.\375\255\321\337\022\375m\007\376V\306\337\302\370\333\347\3372\377\026\003\177\333\363\267.\376\026\371\267\023\370\333\025\177\253\342o\031\360\267)\374-\212\277-\341oI\374\255\001\376v\204\277\r\341oA\370[\017\177\333\301\337r\360\267\032\374\355\005\177\253\341o\367\337\346\277\375\317\372\375\254\336\317\326\375\254\334\317j\371Y+?\353\366\263O~6\354g\271~\026\311\317\006\371\331\037?\313\343gw\374\254\216\237\305\361\263Q?\313\364\2636~6\351g\215~\226\350ge\374,\214\237u\376,\320\317\376\374,\317\317^\340g)\360\263\020\370\331\026?\353\200\237U\341gS\374\254\t?[\342g\021\360\263\005\370Y\022~v"
+	.ascii	"?+\342gC\370Y\017?\333\341g5\370\331\f~\366\202\237\245\340g"
+	.ascii	"7\374\354\205\2375\376,\361g\367\317\266?\253\177\366\277\366"
+	.ascii	"\3735\337\257\367~\255\367\353\351\257\321\374\332\314\257\361"
+	.ascii	"~}\367"
+	.string	"\353\272_s\371\265\226_\277\375\332\355\327j\277\216\362k\264_\237\375:\372\253 \374\372\375W6\277\026\373u\330\257u\376\337\375\332\353\3271~\375\342\327C\277~\376Z\350\327A\277\006\3725\006~\355\363\353\365WG\370\325\343\377\264_\367\374\272\304\257/\370\265\005\277\256\340\327\023\374:\202_C\360\353\234_\353_\345\371u\376\3276\377z\346\277\n\377J\367\257[\376U\311\277&\371W!\377J\365\257\034\370W\r\374k\006\376\325\305\277j\360\257\026\374+"
+	.string	"\376\265\202\177\325\371W\f\377\332\376\353\372g\276?\347\375Y\315\237\253\3749\355\317_\177\326\372\363\220?/\375\031\003\177\256\300\377\267?\243\370\363\t\1776\376\371\370\253\323_\025\363\253[~5\354W\225\374*\364W\271~U\307\257\346\370\317\342W\231\376\357\375\257\373\377\345?\335\177/\377\327\376;\371O\366\177\354\377\334\377\270\377\033\002\003\003\003\377\r\373\337"
+	.string	""
+	.ascii	"\377\023\221\361\321\023\330\321\225\225\232tt\345\344t\024\023"
+	.ascii	"a\210\321\256\234\222\342\253\247\0131Z\254#\t\255\210HM:\212"
+	.ascii	"\237\342\370*\276\020'\025=\305hQ'\fIhWNIhWO\030\222\320\212"
+	.ascii	"\236\222b\253\370BR4\210S\034\275\"\302p\003\255\350)F\263z\302"
+	.ascii	"\020\243]=%\255\251\362\205\202+~Xk\322\2430\"*\220\244\243\230"
+	.ascii	"i\251G\221\323\005\272\244\250U|\027\307j\032\215\330)\246\213"
+	.ascii	"\343\2358\356a\345tW\244Cu3\242c2b+\262R\243q\034G\260d\204e"
+	.ascii	"\025\037\321\021\2511]\222\022\2538Vb\364\023/\305q\034\213@"
+	.ascii	"\024\245\213\213\250tDAz\304J4\342X\2028\032\307KqL\244\306t"
+	.ascii	"q\034\023\305q\354:\365\210\3061\325\205$\350\322R\034O\351,"
+	.ascii	"\305=\210\252\320\210\343\234\206\347\366\224\204\206e\005\242"
+	.ascii	"J\0244h\214\024%R\223\224\254bh|w\345\264\321\210\314b\2458\216"
+	.ascii	"\325\274\r}\212Z\223u\003\316\354<(&\r\212\251k\034\2421\221"
+	.ascii	"p\206\024\244\261\275\330\311\251\203\203\300fg\360\265\363\240"
+	.ascii	"\022U\032T\022\f#\221f\025Kq\200\353\372\362S\235\\\301c\013"
+	.ascii	"\202=\030\366\007\227\004\231\354\0359\003\200M\260d\035\374"
+	.ascii	"\002\361 \230\224\270?\256\254qT\234V\030\2539\255j\245\342\264"
+	.ascii	"\007\301m\377\301$A/$gf\354\310:\330\245\252a\222\362\224\365"
+	.ascii	"Ax\262\237\213\222\002w\004\255F\320p\nB\201\231\232\206)\"R"
+	.ascii	"\202\346\2508;a-A\303\330\360\233n\276\035\330\364\244\t)Hc\004"
+	.ascii	"\r\247\340\r0I\323\032\200\323\033A&\225.\355\004\026\276i0\210"
+	.ascii	"{\264\007\025\314A\201QR\212)4A\256\240V\360H\020Ip+\210\025"
+	.ascii	"\004\022,\022\204\006\211\004\215\004\207\004\257\202YA!\252"
+	.ascii	"4\030"
+	.string	"\304M\363\240\216\340T\320\310F0H\233\027|R\351\322N\270\275\231\006\203\004\217\2024Z(&\254\036\355\236\333_\330\005:\370c\275\323\n\202\226\365AH\nV\005}\b\313\324x\273\022\354\361\240\217\242\324Q\334Z\326A\252 \217@\276@\264\254\377 \017\033dzT>\354m\326-\230#\210#\315\314\f\236\366\032C\205+(\025\214j\235\200!\302%\353\177\030\263\377\201n\353$jXj\234\202M=\304\210\325\310\372\037\340v\030\231]`\326\301\245\240\222\361F^\220\272\254\377A\272\377\241l\377\003\223\375\017E\366?\364\330\377\020\265\377 \215\340\f(\327\331\031\272#\021P\f\f\220\254\377\301\306\276\207\277}\017\323}\017`\366=`\371\333\200~G/\2451\261\254\357\201\354\317\217\205\223BD\244\357\333\017\315*\247\225\004\355\253,\311TV\326\367\340\265\377\275\367\375\346j\225\013\264\311A\311\312:\327"
+	.string	"\361\275\247\203\264i\362\312\372\355\002?\330L\231\311\272\2025;\337l\256J7\233\235\247\211\316b\242!\030\036L|.\220)\017U\373\337z;\317nimJ\326{\215FZc\312j\332S\030k\264\270d}\017Gi\340P\360\210\262\222\365\bw;\337f\256J\267\231\215G\"\315*\206\362"
+	.string	"\256\213\253\311^\034Ou0LC\007\250\247W\006\017\212\f\036\216\2547\231*PuA\262\376\007d\366\277\357\264 Irf4F\314\335\237]\223\254\355\202SOHrY\377\003\271\375\020\273nw\311N*]\332\211\261\273i[\356R\351\210\220h\242e\207\331^\266\334\376\262\301l\272=\247Jw\335\336\362\315e\307]g\212\034\224J\335~\262\245P`\224\204\202\026/\273n\273m-\024\030%\245"
+	.string	"\3266\215\343x\327m\266\374\245\216-\241\251\002\3530T\213\241@.\350\177\020\266sT\315i9\2508\355?@\222\245\316\312_\326\377 k\377\337p\373\212*\335X\366\233\216\225lg$\302\020\307A\304\240\033\313\256\222\355F\350-\341U\355i\243'd\272\264\372\037\030\355{\340\267\357\301\336\276\007z\373\036L\367= \263\357\201\334\276\007n{-\255\312\020\")Y\337\003\263}U\272\325v\032\327\225)\243-\375N\203S\377\364\302\302\262\336Q\262S+\247\206M/\353\r%;i%bM\324\262\336h\305\245\256\"i\326gs\270\377A\215\243\212\230\\\326\367"
+	.string	"l\377\373l\2231\035Y\242\225\365C$\3312\355\212\203\006\301\013\223u\027\266\233\354\262-\266\235\354\261\275d\177m&;\272\301\266\231*\335d[\311\220\255\245\322\245\235x\3632]\333\b!\003U\331\260\312\\\231\361\3422\345\222\203n\262\r\355B\266\215\354\255\250\017\306\226\352\272\354\305q\224\330\207\306\004M\002}\017\216\366;\310\333\357\340\313~\007n\373\035\214\355wpd#\321j\234l\335\310\372\035\344\330G"
+	.string	"w\021\341\237\321\333T\326\357\260f\023\3510f\277\303\333~\207&\373\035\260\366;0\355s\300\267\377\r\304\205\242Z\343\303l[\355\037\353\022\2465x\303\031B\320\352\252|\370\034\361\342\206\bF\206\345\256\307\346!\034\022\004.\255\003C\310\322P\355\035\354\222\231\2452\342\024\314\fkj\353\310i\354"
+	.ascii	"ol\035_*\313E\016\013\336\316\261q\260qcZ\202\364\215\343\337"
+	.ascii	"I\273\306\226\n2\031\342g\226\365\216\312nmge\262>\007a\366\363"
+	.ascii	"\021\033{\323\355\264\241v\323fR\245\373\351c\373i/\275\231\356"
+	.ascii	"\247}#\177\355\247\255\264\222=\221\320eiKjo\004\2426(\241>\007"
+	.ascii	"b\373\034t\355s\200\265\317\001\325\316`\245\342\264\233\006"
+	.ascii	"\210o\244m\305\344\013+k\b\366\214}\004m\232\202%\353h4\216\243"
+	.ascii	"\307\241[\225\232T\326\3776\022\332\341\360\353\332D;v\003]@"
+	.ascii	"\367O\225\356\"\327\217\255h/wQ\201\356\"\367M\033\337\330.r"
+	.ascii	"\373v\221:F\265\262bI\213JKp\211\313H\212\250\317Ao\237C\232"
+	.ascii	"}\016x\373\034\304\354s\250\333\277\353\246MV\226ZZ\326.\033"
+	.ascii	"\246?\032Y\262>\207\266}U\352\352\345\251P\345\226\267\346n\036"
+	.ascii	"\231\0315\242\262>\033W\315\377\240P\f^\037\235\232\273\323\031"
+	.ascii	"|\\\320\334\251\233\206X%\204jL\326\347`\266\177\027\r\2319\243"
+	.ascii	"=\264\254/\302N\312\264\356T\214\3018\326\322\006\r\023\206m"
+	.ascii	"\352\222q\305\254\271f\334;\267\214{\306\305S\245.\031w\f\233"
+	.ascii	"K\306\005\023\3170\373\200j)^\277 \221\n$\352sh\332\347@\264"
+	.ascii	"\277A\232\375\r\350\366"
+	.string	"7\270\262\277A\332\376\335/\356\\T\02225\262~\210.`\322\346\3348U\215\204\247>&`^\\:U\352\316\271r{\213I\2276\255\376\006c\373\033h\355o@\265\177\227\213\373\266\307E\032\2275\030\224\222\033@0\275\303l\017\355\f4\272f\214I\0162?\020b\200p\256\232\273\305\245\342Vq\255\270S\334+.\233\273\346bq\265\270m\256\0247\213\353\246J\33577\312]\251\233\306\326\204\004\300\020o.\224LD\245K\213\213\240@h\ts:\233Sr\003\270\007b\354o\352D\005l\323\346\211\332E\311\r \330\233[&BO\311\r\340\236\373\346~\345/\nf\304\261UU+\245\344\006p/\216\243{\356(\213\313\216V\351\324\234\226\002\025\247\275\006k\3665\030\263\257A\224}\r\230\354k\200d_\003\252}\rj\354\013\340\315\276"
+	.string	"\360\366\0050\267/"
+	.string	"\265}\001@\367\005\300c_"
+	.string	"E\373\031\344\355gP\267\237\001\333\376\335%9\313U\342&\031B\0213b\347z\271].\227\013u\267T\251\233\304=r\027\311\332\346\352\220-@\276\374\366\210\250A\265\312\240E\322\240n\022\327H\226/_~{\356\032\2231@\210\232Uq\332g\020\266\237\001t?\003\254\375\f\236\366\003\340\267\037\2001YWH\255\257\243\254\037\342\207\026\250\017.\320\036q.\226\033\304\005\342\nQ\245\356\225k\225\346^\271UqO_~{m\0245d\250\204\372\001\300\262\037"
+	.string	"\351~"
+	.string	"\276\366\003\200d?"
+	.string	";\366\357\362pw\344@\373\353\312\332\335\341\306n\324j\346\304"
+	.string	"\2432SW\207;\345R\251Rw\207+u\027\207\233\343hG\033h&\336\321\002\236\231v\020\342\201\341\313\332\272\265Rs\332\207\t\200\r7\312\205\312\002\020\362\347&\353\247v\213\323tL\326\337q\263\377\273L\356\222{\303\265\3416\271J\252\324ur\223\\'\367\310\245\261\2329m*Fq-Y\r0^\210\346\246\256\223\213\304eZ$\007u\235\\#0%&\200b\334\244m1\352\357H\367w\224\354\357\f\331\356\f\025MZ\244/\353\3578\355\357\314\330\307 o\037\203/\373\030\254\355c\340d\037\003\"\373\030\350\370\363\203{:\243\246\365+\016\205\270\245\365\361\201\321\025\345e\375&\032\345\2326\021\311\372\027\374m7m\033U\332\356\265zl\300pi\367\332<U\255"
+	.string	"O\\M\300\216@\274\354p\264\372\027\354\355_0\267\177\301\226\375\267k\3324K\\Bpd\375\020d\306\302\264M[4\355\231\326L[\246U\243J\3334-\336\363\021\273)S1l\3236M;FJ\232\366N\204\224\022V\233#\031 \227(\243\376\005Z\373\027\360\330\277 i\337\2026\373\026|\331\267"
+	.string	"\312\276\005^\373o\301\314yI\311\322\216e\247\325\314iK\237\370M3\016#v=B \021\262d\306\r%J^L\3217\320\020b\177P\256)\350\326\016\350W\r)\255\225\266\255\375\322\272\265t\355\226\226K\273\326\312\265X\332\271\326K{\245\325\322\302\265U\332\2676\256\255k\247\264T\332.\255Z\313\246J\333,m\224\267\3226-\311\322Te\003K\202\256m\230\330\230\026\3711m\002\250\262\205\005f\034Gx@\263V\031\237\226\217iK\346\244\017\332fi\317Z(k\024\032D\302J\203\243\315\322\022!\322B\177\225\255+KkVF\304\325\244C\013|xW\"\350L\247\346\264\036\f\331\177\213\366\026JZ\222@\2465Y\267O@\274E\003\300\024\270*Y\273*N{\013\200\354[\320\264oA\274\017"
+	.string	"6\373"
+	.string	"\260\333\327\242\346\264\007@\334>"
+	.string	"\236\354\003\240k\037"
+	.string	"8\366\001\220\264_\301\337~\005j\366+(\263_A\335~\005[\366+P\333\257\240k\377N\315i_\301\216\375\n\214\366)H\263OA\227}\n\330\366)H\262O\301\220}\nx\354\277\035\222u\f\322\327\364CH\033D\225\266Y-\026\220\2605bT{mV{\025V'F\265\347\212\335-\321j\365)X\332\247\300h\177\2024\373o\255\270\374`\347\330'\\\232\024U\265>\212g\276\354\262\332\036-\017U\332\372h\251|hM[\037\255T\356\302*2u\003\275f\200i\365'x\333\177\273\243\325!\364\361\006&\032\325N\2659Ti\253\243\305\321\352h\245r\027\210\250$N\366\224I\351\253\325\237 l\177\202$\373\023\034\331\177\013\325>\315\030[s\227\265S\360F\216\276\277\254?A\324\276\210\244\032\255R\333\3242\251\322v\251\265\321.\2657\260\270\240\300\200\320\266\200l}\t"
+	.ascii	"\367%\260\333\227 n_\202)\373o\221Z\032LV\312\254\314xK\343\017"
+	.ascii	"A\304\330\021.^\023\2275\b\020og\250e}fY\262\376\333\2436\016"
+	.ascii	"F\351\234\232\262~\b\3002?\2656f\377\212\030%q\262\327\026\265"
+	.ascii	"D\255\221*mc6PWM\271jl}\t\254\366%\320\261/A\322~\004\201\373"
+	.ascii	"g\373\3307irYT\262\276j\206M\376b\343c\367T)\373\206u\363\206"
+	.ascii	"m\223\204\313x\006\215\026]\253\037\301\333~\004j\373\0218\321"
+	.ascii	"\313\313U\230\256\326\234\315S\273\200\323\216\202\003\352\216"
+	.ascii	"]\303\2229*\323\023\222\365u\234%\312\210\323\036\030'\3230r"
+	.ascii	",\235J\227vBo-\fY\235\252V6%\303j\311_j`X8,F\260\2148\355}12"
+	.ascii	"\342\004v\307\216a\313\260jX3\254\0306\r\213\307\236a\247,\032"
+	.ascii	"U\312\222a\355DX\351\002e\311\260W\\#I\2148\261d\330-l\0275+"
+	.ascii	"F\234\366\3428\312B\341\302\003\207\216~\004N\373:\177\373:x"
+	.ascii	"\373:V\366u\306\346X/E:\035d\326\262\276\316\2209\035)6N]\322"
+	.string	"\023\302$\353C\020\310r\201\300\314>\004]\366!h\333\207 l\177O\315i\017A\217}\b\226\336\252\2547\314b4*l\033\353\246J\331*\354\224k6\256\261\265l#\fZ\205\225\222m\270C\212\334@\367\3428\016\323\2233\333\372\033\262\354o\220\262\277\301\311\376\206$\373g\325\244@~\260\335\310:\214\025[\243n\273\rk)\215\205\302Fa\237\260h\252\224\225\262\321\263f\354\331\265\224%\273!e\307\330\036k\324\215\001`\224\244lY\rV\312:\2611%\212y\323D\206\250U+5\247\325\240\342\264\337\340c\177\003\324\376\206\244\375\234\276\375\234\274\335$\002b\234\230\2658\353\347x\331\317a\333?\013v\366\013\356O\313\033\023v\211*e\277X%ql\227JG\344\004\237\337\364k\005\303&1\262q|\325\007\215\3438\202\016\035\204k\264\250Z\375\034\260\375\263^g\223\034-\212\216\314\216\254C"
+	.ascii	"q\326\253\005\273\002\344M\326\320!VK~d\375\034\253}\325\214"
+	.ascii	"\\\032.\026\211*e\267\330#h[\353\\\356R\351\210\304z\211\216"
+	.ascii	"O\nl}\203&7m\365s\224\366\317\032\321z15\345\244\310Y\2554c\024"
+	.ascii	"\0240\252\254W3 \316\032\300H\220&Y\377,\021\026\313\n\321\024"
+	.ascii	"!Y?\004\026k\025\007]\363|\350>/S,\266\211\355\241\322\021\321"
+	.ascii	"m\356\246,\026[5'\204\315b\203\260W\354\020U\312b\261@X,\366"
+	.ascii	"G&b<\212\306O\303\033n\200=\336\356|\340\021\3655\370\355k0\263"
+	.ascii	"\257\241n_\003\334\276\206\264\315#\202v\313\216\017.\353k\360"
+	.ascii	"\332q\254\016\225\216\210\006l"
+	.string	"\233R\261S\252\224\335\301:\261;\214l\034\027M\201\016\177\004y\252\321\352\034\353\336\0267)Y_\303T\032T\r\312J\2618X(U\312F\261Ol\224;dM\231\336\236N\007\266\315\364\215\232\255\2173\267\217\223\266\217\023\335?\313\304\336P\021edM\326W\307\322\344/c\321\205\370\310\310\013\024\315\035[\203Eb\225\330%\326\006\233\244J\331\033,\r\366\206\236\316M\3438foh3xS\366F\206bg\254Q\267\005<\221\233\346\"\366\206>C\006%FE\344j\212\373b\324\307\321\261\331#\326\315\230\2224\353\343\320\330W\303\350\331\025\t\324\177\254\021K\304\306\032P\225\262Ez\357Z\215^\363\214\307\206H\233\037P\266H\277\321~k\024z\202\020#l\221vS\305\026\351<8 XP{\372\214\337\027*F\355\247\373\206}pGf\232O\347\220\023\262\225\3653"
+	.ascii	"\356gp\263\237A\314~\206-\373\031\322\36630\331\3170d?\003\216"
+	.ascii	"\255:\2519m\006\025\247=\006\277}\f\323}\fa\3661l\331\307\260"
+	.ascii	"\266\177]\006oG\215+[Y\223\321j>\216\336\262>\006\260}\021vF"
+	.ascii	";\246jS\320:\"bt\030\rF\337\3511\252T\333\351/\252\027\037v\232"
+	.ascii	"\356Lk\nF\204Rf\206\017\242>\206\244\375\013m\366/\200\331\277"
+	.ascii	"0e\377zN\313)i\252\262\221u\227hZ\034\307:B<\244\246\246\254"
+	.ascii	"\177!\311~\b\315E\257\351)\306\243\013\361\221\220*\250\026\275"
+	.ascii	"E\307\251R\315E\267i.Z\355\307\264\r\027MEgY\243\320"
+	.string	"}c\006\221\351N\343C\211\215\255\261\350\020s\234\251\311\221\365/\004\331\377\365\025mE\225j8]E\215\306\027\361F\005\247\335X<}\371\201u`\237\200E\005\266\372\027z\354_X\332\277`\264\177\374\333?\202\321lA+\252'EY\377\030\247\245\034\257\354\037\321\366\257\323\244\304\037aU:\244I\204l\346\212\264e}5\214\217\035\"\244\214Ls\224\016\"S\035\377*\233\220\032QUSz\007U\017\250\025\3234\210\215(\036<\364\023\016-(\b#\200S\375\024ud\212uc\032\307Q\034?\232\246G\264\326\037tm\323\203jz\004\310\322Te\323I\364\020\255\245\322M\351&\201\3238\216\243r\024\321]ZLC\321dZ\211F\323Pm\246\235\350/\035E\237\3510\035\325L\264\227n\242\313\364\023\275D\217i0U\252\223h$\327[\232\353Z'\321WJS\375\244\223h\250SY\315\2346\320"
+	.ascii	"\203d\232\243t\022=\245\252\205\250\322\307\004,\216\243\035"
+	.ascii	"\266\225\230\351\226\007\255\351\324\234\366lU\373G\036\373\307"
+	.ascii	"\251\375\353\"\327Z\277\316\312ZG3B\326\274d\255\211\200\270"
+	.ascii	".r$\265\266\225u\020\307\026\2528\355\217F\373\3066\373\3062"
+	.ascii	"\373\306.\373F\265}c\327\276Q\310\2761\307\276\261h\277\210f"
+	.ascii	"\277(\267_\234\262G\2509\355\213c\373E!\373E\247}\342\337>\221"
+	.ascii	"\314>1\313>1m?\252\235tS\216$(fY\377\272I3\375\035\tD\312Z/\035"
+	.ascii	"\305\370p\260e}\242\222}\025\217OUS\351\246\f\320dm\252gh\033"
+	.ascii	"\032I'\351\032\232\206V\322G\272H\033\251R}c\005\374\032\250"
+	.ascii	"\343\254\365\203\3207\3265$\306\250L\3438\nB\337X\335\254{\306"
+	.ascii	"5\216\213\330\240l\246\254y\253^\033t}#%\027i\"-}j!\376T5\343"
+	.ascii	"\032\307Ue\"\364\215\325o%CT\347\004\254C\320\206\r)e6\350\023"
+	.ascii	"g\354O\325\234\326\250\342\264\037\252\331\037\222\331\037\316"
+	.ascii	"\355\017\261\354\017\333\366\207P\326\275\253jN\256\035Q\262"
+	.ascii	"\376\260lsX\262?\324\332OSs\332\017y\354\177Us\246I]\023\257"
+	.ascii	"\254/\202\f\036\364\316\256\f4\216\243gV<UM\004\271\247/\277"
+	.ascii	"58\342+\032Y\253SjN\253\325\200x\361LP\215/+\213\231b\031,'2"
+	.ascii	"B\212e\376\"\036\013\027\267\005L_\326G\025\247\375\213d\212"
+	.ascii	"wTe\262()\212y\361\356\3374\212c\324*ZRmn\262V\301\324\234\266"
+	.ascii	"h\007\342E1D\2160\241\222\365\006\025\247\205\300\033\0300\304"
+	.ascii	"(\352Y\334\244\301O\352\013\313^\321\013\024\225'.{\005\334\227"
+	.ascii	"/`\344\230\370\300h`-\231R\333+\320\344\344\212^t\254\3263Ou"
+	.ascii	"N\300\250\234Yq\233S\245E/boQ\035\013\200\356\025[\305,\305,"
+	.ascii	"E\013\340h\322\006\354\212\224\032E./\306\241\311h\244\214\t"
+	.ascii	"\313\272\250\245\270%\251\311_\224\342\226\374\245cF\237\224"
+	.ascii	"\005\324\330+\212\250P)\302\345\021}\371\355\035\263\332\300"
+	.ascii	"-]y\021\316\245\212\256i\311\272\350V\264Rd\212\242\246\316J"
+	.ascii	"\361\215J\312d\255\213*$\013\022T\025\335\346\344&\312N\001l"
+	.ascii	"\266\003\354\212S\212S\256\304\250\366t\032\267\250\036s\333"
+	.ascii	"\001V\326\326\212Rt\254\210\324dPV'F\265\267b%i\302!\005\353"
+	.ascii	"\n),\353+\300m;\340\f\n\224b\232\027\2500\320\214\230+\351\213"
+	.ascii	"i\304;\250)>\242\200q\222\363\213\362\"\030\233&h\326W@t;@\354"
+	.ascii	"\311\223-L|`R\244\310\216d}\005\f\331\016Pbf\226\341Z/%7\200"
+	.ascii	"`p}`]Y_\001:\266\003\252\212e\305\262\"\231\031\245\032\"yY_"
+	.ascii	"\001I{\205\217\342W\361\253HV\245\217\t\030\224?-Ec/\222!a\263"
+	.ascii	"\247U\024\233\243\202\272+\212\025\233\340`\332\002+\206\245"
+	.ascii	"8C\226%\353\247\350\333`\032\311\312\005\211\226\2743\333\001"
+	.ascii	":\226,Yc\342\003;2Be\366e\253\bL\222d\373\251gqS\210(\237T\206"
+	.ascii	"\"!P\265\255B\r\024Z\354R/D\215\300\260Au\225\215\370\351\305"
+	.ascii	"\256:(21\331v\200\323\326V\206\323\261Z\301Ha\342\003{;\"\363"
+	.ascii	"\342\265U\340\0359\222\341\324\240Ve7\256\262~\212\253\255b\013"
+	.ascii	"\021\"E-@\251/,{j\034\036\033\246b\221\027\265\300\224\211\271"
+	.ascii	"K\241c\253pR\004R\004R\314B\"\234Rb\002\270\247\317\234\251a"
+	.ascii	"S\274z1\253(\004\032d\017IH1\210\356\302v\303\356I\b\340\226"
+	.ascii	"4Xn\322\004g\222\246\364m\b\334\345xq*G"
+	.string	"\361\307*F\215\306SVDjH\350\033\232\3350\373\302\343\305\037/V\205 \342g\300\230\210)\312\272\350\243\330\243H\3653J\316(\251\311\272\270\20385fo\3100o\235\303\002c\224uQG\360\255J\310U\326w\327\304\360\200f}\024\364\266\n\254\342S\361\251(5F|\223e\211Y1\352E\251#\324\030,i\326E\250\\\344\027G\364e;\240\257\251)\303\351\264\301\221\245d\217\013\025\273\036a{\205\230\031\237Q\\\322\3311\231\020\277\251\272U&VWTzq\311\005\225\323\230\254\2136\2127\272\316\332\024od'54t7\262.\322(\326\370\037t\231\344\301])\326(&\025yK\023dG\201\371\221\225%\353\"\022\nY\233\205S\321\250h\024\214\252gq\323\260\315\322\226\024\230\026\031\024\2326\213\036\201\201E\"\235\035\217)\3212\305\022\343$-\306/\022\025\215\244\355UA\301h\263"
+	.ascii	"\323\327G\374\323\261\"R#\200\036KxU\303'?\036R\374N\374S\325"
+	.ascii	"\330(2KC\3666\213)o\336\020\335\250\027\242Fvo\240j\030\325\022"
+	.ascii	"Y\326?\301\313f\341\305\206\r\321M\221\241\336"
+	.string	"\322\226\224\346\0132C\013\261\315\211n\366\214\034>\244Y\237"
+	.ascii	"e\263x3\235\022\363r\230,iQ\3517JKrkN\314\203;\272q2\n\2225Q"
+	.ascii	"\215j\305\356L\216\215\311n\241e\306\f\021\r\330\022^\025XP."
+	.ascii	"\f\033\331\231\023\321\330\271gzwD[\273\205\324\335\035\021\257"
+	.ascii	"\311\222\026\025\230J\244\025\305\212H\346D<'!@\224\3248\201"
+	.ascii	"\307na&\314\303\020\305\350X\021\251\341\240j\t\257j\357\330"
+	.ascii	"e\b\227\023\321\356D1Eh\220\272\266\023\232v\013\272/_\210uJ"
+	.ascii	"\226\264\250\300\212=f\350"
+	.string	"\330Q\247\227\340\221ue}\024\201{\205\"99\242\027&KxU`j\226\223-$s'z9\234\025\020\244=\024fv\213\350\225+\3048\365,n\312\001[\322\242b\375\364\310\240\270\234\030g<\202Cj\2245q\313\341\334\242\354\320\362?8A\027\327\020-\304,LD_\240dM\304\022\215\322c/\353\243\210\333p\256\237\320\013\215\324L\326G\241\266W\370\361\366\226\341X\254\021\2432\253\013\233f}\024`{\205)7\267\f\327DjM\233=#.~_Y\037E\323~@W[\333\372D=\213\233Z,2L|{eT\304X\235\331\017\360\222\226Fd\3631\344\262\264%\225\253\272\210\031\243v\"\033QJ\025\230\2551\342\3321\013\233\037nY\337\204/\373l\266\232\377A\b\002\215 e}\023\3346\004\306\210hD4b\224\266\212i\213\311\332\244\206\230\037D('Fa\003\205\316I\332~"
+	.string	"\331\331\331\372D\307j\005\323\205\211\017,\216\2478\f\313`\251\341%\353\233\260\265\037pDtBtB\214\356h\365\224\334"
+	.ascii	"\022\321\264\370\255!\226\235\030\315]\025\270\021\205\303\204"
+	.ascii	"\253\315B\036\330\301\210c:VDk8\310U\301\202\3323>\331\312b3"
+	.ascii	"F\024\303\261\301$%vb\0236c\220\304e\035\266n\025\261\344\210"
+	.ascii	"2\313\232\030f\002\216\315\202\234\022%D&:VDj8\300y\211Q\355"
+	.ascii	"\t\177\220\361`B\\r\"\023\027\n\256m\007\340f\241\212\227\027"
+	.ascii	"\261\210z\0267\251P\2461T`\371k.\311\032\271\315\002\016(t}2"
+	.ascii	"5]\213\344\376\212\250m\026\240 AB\334z\3024\365\261\266\243"
+	.ascii	"\312\226\0213\032@\2766\013aF\214\020\213\250\027\242S\034\202"
+	.ascii	"eVcYF6\013H\210\020!\026\001A\215\221\242`QM\343x\212C\007\276"
+	.ascii	"t|)\222m\314pB$,\353\237\370\261Y\250A\274\"^\021\263\324\263"
+	.ascii	"\270I\330\364\304\210\023\227\227\222Z\326\304,\242\020+}r9\260"
+	.ascii	"\210A\206qoJ\002\263\376\t'\254\023\361^\001M\216\034D+\022\254"
+	.ascii	"pA\351\"\2470@~\234h\225\341\204\030\211\312\232\310\203X\265"
+	.ascii	"\337\244\240\344z\020}\254G\240\322 \245\351A\265\332\350\252"
+	.ascii	"\022\204jGq\255\352\t\214\016\342\224Vr\345\212\215N\007\353"
+	.ascii	"F-\257/\215\312^\301\212\215\333 J\251gq\323\001\236$q\002v\\"
+	.ascii	"\343\024GF\214:Q\252\225\262GD.kb\023\021*\b\032\032\244\254"
+	.ascii	"\211O,\036W\221$Y\337\204\223MtbCd\302\212\032\321\021\231\210"
+	.ascii	"K\\c\352\304\262&*\005\262a\002\227\365Mpm\342\r6p\013\331\217"
+	.ascii	"\272\254o\242jC\340\006\361\210xDL\312\261\204W\265\267\352\305"
+	.ascii	"\335\021\221NLR\327~\270\031\311\232H\243\235BfJ\223\254\211"
+	.ascii	"3\236\206\r\240\325\236\t\247\315\002\020b\021\261(\030\325\261"
+	.ascii	"\"R\303\201\224\324\027\226u\353\314\224\267\254_\302\230\275"
+	.ascii	"\002\031  1\326\261\"b#\224Rb\002\230w\264\035\341\005\236\030"
+	.ascii	"\243\205ABD\343\177\020\303\f\"\256\254_B\225\275BV\233\017\371"
+	.ascii	"\332\f\375\334+:Ep\372\244\222@\355\305I=8\370d\375\350\322\367"
+	.ascii	"\241\337\273\004Bq\273:\025uI[\330Z\326\3037\356\030\273\270"
+	.ascii	"\263\254\207{,\217\2502J\334\374A\"\221.sk\262~\t<\366K\220\332"
+	.ascii	"\017\240\n\363!^\230\241\3361M\215\343\251\330\350(\256\372!"
+	.ascii	"\201\027).\276\2758i\212Cq\nU\230U\231\017\365>L\023\202\210"
+	.ascii	"a\036\023\334U\233\254\207\323\241\032U\372\270\341\232G\217"
+	.ascii	"\3067$\265\270\254_\242"
+	.string	"\315\276\372\270\366\003\352\343\332!\232\033\247\344\336\246Y\177hfx\346\017\n\223\bA\373\312\372%\320\354\177\260\317r<=Y\371\037<~\365\335\020\223\365\360\356C2\177p\350\004\216\006\230\254_B\314\036\212\371p\314\037T\263\230\350\352\262~\211/\373\037\332\375A\242\232#9\264\262~\211.\373%\340\366\003\330x\3612\254+\033\006\221\202\326\346\313\207u[o\246\320e=\244\013\2661!\023\205*mC \213\013\227\241\334\327\243\270\312\tT]s\025V\243\313\207r\256\2219!PY\017\343J\214\355\007\250\355\374\037\302\301\r\265\250gqS\004NS\034v\314\303\357.\313\207Z\202\200{u|Y\017\261\004\333\324\031=\264\314\224\340\332\037~\354|\3706|\033Z\321G\321\370\251\350%\245\205e/v\322\322\201Q\r\316\315[\326C+%fl\020\252v>\204\002e\350Fb*\032C\t\3274\005\366"
+	.ascii	"S[\262\024\273\r\251 -I1\311\272M\212\305\253/\353\223\340\333"
+	.ascii	"W\361\324\322@\315\f\327\206Q\320\f"
+	.string	"\327\206R.RY\200{\303)C\266\241\024U:\\\033\246M\231\312\364\266>\t\271}\022o\373$\334\366I\264\355\223\220n\020\270v>\024\033\212\r\237\\h2\215\235\264t\020\\#\225c\357\311\207gNh\300\324em\226\207\370\235\021\311\372$\224\354\207\030\226\r\223\f\235\254Q\350\tX\177\303\250*\035\226\r\307t\210l|\020\361 \373\320\211\232\017\037uFY\273H@|Hv\367T\005G\326'\001d\237D\216\rBt\347\303.\351\260k\030\246\306\320\005\330\211Mc\247\251\016\214o\332\222\240Y\203-\351\222e.\353\223\210\367\377!\023U:\374\032z\035\r\277\206I\206K(0\212\343\"\037B\250\246\300\036\30425\302\326\264\376\207J>\\\362\257^-\231\2127^cY\353,\020\037*I\352k\222\365\023@\267\237\200\265\375\004\214\355\b$\r\271\206\\\031.\002\036l\332(\253\006\223\254\237"
+	.ascii	"\257\035\201\246a\3260k\210D\304\016-\027(Q\212r\344C$Fh\235"
+	.ascii	"\2224\353\241\221\241\026W\327\024\246\254\207C\206Zn\177sZZ"
+	.ascii	"\303\"aqz=\3540\200UFnHdo\331Pa\342\244\004T\355\b\350\001\001"
+	.ascii	"2\f\222\263#\215\250vFe\210\365a\220\326\316\314\237X\326\303"
+	.ascii	"\253\004\320\330\f\200\333\371\320\307\320\307\360\007\007sK"
+	.ascii	"u]\212\306\242\020e=\254B:\342D#\353#@o\037\001r\273\007\313"
+	.ascii	"\220\307\220G\206S\325\372\2468\260t6\312\236d}\004\260m\016"
+	.ascii	"v\354|\270c\270CUk\245\330\2536n\302\262>\002\314\266\007\036"
+	.ascii	";\037\352\030\352X\225$\300K\214\n\314\f\312O)\353#\300k[0\266"
+	.ascii	"\363!\216!\216\334u\301\264i\315\232\250#xg\262>\002\236\266"
+	.ascii	"\004|89\r\243\362\216@\241>\214\312]Fb\234d=|\312_uW~V}\273\002"
+	.ascii	"8\206JC\245!S\236\215\341\322\207L\201>\274\350\0160\267/\340"
+	.ascii	"4\2641\264!t\023C\317\313\322\364\311F~\rg\fg\f\223\202x\221"
+	.ascii	"\233\016\221>L\332Dc\262\324d=\244"
+	.string	"\021l\233\221\304\317*\353\003 \331\027\320\033\032\r\215\206DrZ\240\007\210\332\025\320\322\3277$\272 \216c\032\261\f\250\0323\323\277\017\211\206\261\003\244tfY\013\003\215Sf\244y\223\365\017\200\264\205\200B\2774\333\002K\3027\3027B7\006PC\0065"
+	.string	"\334\266\300\031\241\236PO\350\006P\330\346B7~8\276\254d-d\023l\323!d\332f"
+	.string	"\262\375\023E\210F\210F\270f\273C\374\240\034~\241\232\013\327\b\263x\020\215\t\247A\2726m\322\204Sa\232U\013S\234\221`\027\225\224+[\262\276\001\2726\002\242\354\\\210\207'4C\"\315\252(\t\007^KXPK\3120\371\222\265\260\314F\232\242\346\225\365\r\360c\337"
+	.string	"I{\337\355\\(F\214\360\016\2040\263>&\261\034_\216\254\205c\362\221\274>\276\254_"
+	.string	"\277\375\002\224\331)\234\355\\XwU*\254\023\206A\322\366Pr\003\270G\005J\017+Y\013\301\334\225\272v3\2020\311\372\005\230\333/"
+	.string	"\333\026"
+	.string	"\326\316\205sR\341\234\220\256\315n\312\364\211N\013*\364\262\007\244\352J\326/@\330~\001\200l\r\212v.\344\302E\330\205\004\021\253\"\254\f\342X#9\274\214\262\026\306ea\233,l\\Y\277"
+	.string	"N\373\004\340\333!\224\331\271\020\313U\251\020\213P\313\256q\024\027q\271S%&\200K\212\354\375\310Z\230%\307\334\025_\326'@\231}\002d\331!\356v.\264\"\264\"\274Bb\312*\226\342 V\205\253\311^\027\033\023\225\360\312\376q\2014HP1Y\237"
+	.string	"^\273C\325\316\205T\244B*\302*$\210X\305Q\002\360R\302j\223\315\020\261\213\222\265\320\315x\024\217\361\310\372\004"
+	.string	"\262O\200\033\333\003\276\235\013\245H\021N!1eUT4B\2148\305\322\203M\3106\214\023\023D\353o\237\004\274]\302\327\316\205R\251PM\215\335\3248\311\n\026\222-Uj\330\204i+\031\300#i\326'a\312>\tFv\2115;\027>y\"\204\242\213\316\342'\020V\2228\001\223\322\206\207%k!\032\313td\313X\326'\001j\177\204\336F!d\347\302hTh\246\306P5\216\337\260|L\267d\231\002\223\365\337\316\270\320l\373\020\242I\341QU\331(\242\354\\HF&t\242\211\316\342&\022\242\270\240\300\342\270G\007\333\212W\327\017\270\013\304\361\030\222\\\037\216&\273\204';\027\212\211\341\031\327d\305tY\177\304\217]\002\225\235\013\303\302\204K\016\220$\211\023\260&nd\354\262\376\210\246\215\342m\347\302/\341\227\n\247\211.D\215\300Hi\301\334\370\354\262\376"
+	.string	"\3646\212\271\235\013\225\b\225\b\227\214\b{\302\005\265\027\307=:\310O\264\224"
+	.string	"\302AI\315t\311\372\003\b\263Q\230\332\271\020\n\025z\335\3103\342t\344\t\232\244\254\205]\273\256\007\330"
+	.string	"\256\354\017\240l\247\350\261s\341\221\253R\341\021\341\326\22037\320\226\007\325\f4B$yIR\356\262\376"
+	.string	"\266\366\0070\265\017\300e\347B\"W\245B\"B\255\250\021Ib>\251.f\3420Y\013\213d@m,0\353\017\240h\177\2041{\315\332\2710+\213\325\"A\304\252\350\352\002.Lm\232\b\235\224e\231\222\365G\220n\005Hw.\274\022^\t\203\350\243\263\230\310\270\004\005\354Q\001\r\262\277\254\205XE8\2556]Y\177\204\257\375\021\256\366\007y;\027V\t\253\204V#\310\336\304\250\310\214\234]e-\374\241\257\204EMe\375\021\244\366G \332\033\270\355\\8\245J\205S\302\036$\246\254\342(\016aWZS45\306\270\360\270\260\307/\334!\244\332<\214x\241\t\222\365\032\b\342B\036\201\201V\212d\315r\t\263UL\355\250a\252\020J*\204\022\346\020\332Qy\333\200U\376\362\262\376\205R\027\342P\253\\\340\255\006S\215\254\205Q .\224\312@\020\253\"Y\177Pq\332\213\210\333\025"
+	.string	"\356\\\350\344\244\245\333(\311J?\331b\342\003\023\376\035\225\205e}\021j\333\002#;\0272\t\231t\023\211\251\263\030\352h\344K\235\223b\364*\220/\353\213\340\332\032\\\331\271\320\306U\251\320\206P\211\304\224U\fe"
+	.ascii	"\271/_~\232\214[\332\233\254\2057\324:\250\225/Y_\204\325\276"
+	.ascii	"\b\245\035\202\233\235\013\223\204I\371\213\004\021\253\242\242"
+	.ascii	"\f\222\230q5\311~T9\354\262\276\b\244\315\201\220\235\013i\b"
+	.ascii	"id\033$\322\254\212\240.\230c\032\023\234\022\250\006\227\365"
+	.ascii	"E\360\262;\250\261sa\321U\251\260Hxt\224\002\304kn\257K\033\035"
+	.ascii	"MY\013\215\204T\244L=e}\021\324\366E\210\356\021Z;\017\002^\225"
+	.ascii	"\006\001\205\361\005\032Nj\034\267Aa\233\306\361T\007G2\036I"
+	.ascii	"\246d\035\f\324!\201\343\t/\353\213\260\265/B\325\016\021\265"
+	.ascii	"\363\240\237*\r\372\255a\272\350,&\022A\304\325\004,\216\247"
+	.ascii	": \022\321\370\343\221\365E\320\261=4\355<\310wU\032\344[\225"
+	.ascii	"\220 b\025C]Pv%F\265"
+	.string	"k\264\241#\313\372\"<\355\024]v\036lsU\032l\023\334#\221f\325A\f\330\003\f\220\306\225!Y\007\335(\025\r9\312\372\"\334\330\027\001i\033\300\306\316\203k\256J\203k\202z$\246\316b\"w\n\224O\312\312.\212\230\254\203yqh\246\270\262\276\bD\373!\3766\001h\354<8\235\346\257=\343(\266*2t\262\264%u&\345\342\021f\257^;\017\242A\223\266n\221b\241\261\262\327\265\235\007\315\230Q\3534\021\206\2438H\0334\216\273t\220\265\324\361]e\375\020j{u\262\363 \2364\210\247\326m\243$\253\",\016r0\2115\331\213\343.\035\260;\264\332\272\262~\b\254\235\f\023&xG\244\006\204$o\306<x\307&)\302\246$\353\240\230\374u\0245\005,\353\240]\260mj\024F\215\033,f\260<\311\372!\224v\003\336v\32405\330E\032\354\022\254C!\032\023\r\215"
+	.string	"\245:P\275\020\255\316"
+	.string	"\001\004\022\364\362\340\227?(\027\234\013\322\021\277\354\222\364\304\240\341\322%k\365\f\304\203^\212Z\206L\263\006!Vs\3326Vq\332\207\240\261{\344\270p!C\226f#\351\256\\\tj\331H'Hc`Y\036\3242\254\022$kL\326A,\3016<\300-@\262\016\302\r\237\270\355\305Y\237\315\\\223\037_\326\017A\313~\373\336\376\026tS\3438\216\247\3425\r\025\322\030X\bc\373\005#EJ\320m\273\\~A*\017\272\035\315^\224\271\267\254\317&\330\366?\330\302\016\317K[p\n\224*\357/K\354\3460\342\313\302\266\337|@\035)\313\372!\370\330\r\330\333\tJ\325\240\232\232\252\246\023\257vS\220\306\300b\247h\007\017Ai_U\325Z\016E;\017F\221\006\243\250j$\246\254\210\326\\\260\307\264\305d/\216\265t\260\342p3K\313\372!\304;"
+	.ascii	"@v\036DS\245A\264\354D\"\315Js\231}\371i\2467Y\274d}\020e6\207"
+	.ascii	"/;\017\236\251\322\340Y\376\322Eg\261\223\352\306\264\305\004"
+	.ascii	",\216\265t\220\2274A;\222\365A\210\355\236\250\235 Y\320\311"
+	.ascii	"\203e/\013FQ\210\343\230(\0327\t\221\224!\215\355\305SN\034\202"
+	.ascii	"\321\354\204\367E\307\225\365A\f\331\277\372\374\267q\221S\034"
+	.ascii	"\307Pl4v2\"\266\277z\225UU\016\177Q]\325\235\377\372"
+	.string	"$\030\021\212\343\036p`q\034\253z;\t\225\"\036\027\304\377\257\343\030\2028z\365\224t\024\023\251IhWOIhWN\030\222\272\\=\005/\220\213$<\244B\005\020\360\244\200\231I\346\033\344|UX\360\002\271H\302C*X"
+	.string	"3\227\027\360\274L\237\345\2239D\204\223M\240\036V\007F\216\200\231\313\366\202\316\177<<\177\340d\020s\231t\006a\346r\225QB\214f\t<\314e\217\006\367\202N\f\247\006\241\247\n1\234\030V\274\317!\234f\013\237\342\361\204\030K\024<\314\022/\234\344Y\002%_\350<\227\314\024<K\241\342\360\371\002)e\230xY(\225I\b\206*4`\205\n\023L\340I\276N!\020P\tg\362\0052q\204_\026B\025<\314%\n\370}\006\275A-\213\377xP:\237\357\013\347\220\t\345\212\027N^\340I\276+2\274J\346;\224\201\227\305\206\020B\214\020\246\240cB\004<\314%\n\243\023V\3213\344\342\351\302\357\t\031F"
+	.string	"\261\002O\362]q\364a.\231\313d\320\273\342\371\3022J\350\031r\361\314"
+	.string	"7{\230)\340\367\004\fO \240\022A0T\b5\341\347\205\377x\030b"
+	.string	"#\337\240%<|\203\226-\2220\320{\242\205g\262\005\374\372\\pM\300\257O\004O\241\023/\234\\\361|O\b\202!D\004J2\235/\034\303\204f\013g\023n\252\320Tn\bZ\302O\023\340\367\004\036\240&\n\027"
+	.string	"\275&p0\250"
+	.string	"\277>\303\022\360\3533|\221.\214/\234\204Y\224"
+	.string	"\277>\307\027\311\223\002F^x\221<)`\236\344\273\342B\022N\236(\376\307\303\207\026\236I\025^\347\020\234|{\206/\220\213$\3202\371\242\004\354l\252x\246"
+	.string	"J*\177\340d\320\207'\274t\361a\210\351\363A\214!\346\022\350\003\021F@\2160\"\306\007\370\311l*\331\036\230\271t\002\265\377\361\340\303\\:\341\347\207\227g\bH\311\\~p>\207>l\200\221\257\006\226\317\026\bh\210\311l2]\030M\347\017\334d\272=\311\027H\277\316!!\315|\201\234\360\263\035\001\304\210a\b!V\350\031r\361l\276p\276\317\017HxH\210\271,\302\377\361\360B}\"_<\177\204?\352S}\266p\206\227\247\031$\204\205\226N\370\311\363\002}h.\235M\240\246\222}\"\237o\316\323\331\004j\232"
+	.ascii	"J.\225\257\320\263\b/\231)p~\236C* \2007<K\300K\346\362\002\234"
+	.ascii	"\204\237B\236\367?\036^gS\311\003\324D\301'\031\3442S\344P \001"
+	.ascii	"O\362]\221\023\224t\3724\341\347\022\205\026\236\311\026/R\350"
+	.ascii	"i\202\207\271D\001\301"
+	.string	"3\002\b\230(Vl\2001\300\020\3008\031\3009p\006\230\002\f`\235\nv\204\222*\234H\321\204M\234(\261\301\304\221\005\236\027v6\205\204\206\236\022<yR\034a\rp\016\234#\301\177<D\300\302\032\340\f\024<\337\240$\223g)\264U`0\021\001\214\263|>y\200\232?@\311\017\315\2453\371\202\205\221O\347\0134dB\016\234\334\3601\t'O(\235-\013\373$\203VX\251L\256<\311f\n:+\340\345\t\260\263\371\363\274\360\006-[\374\307\303\207\t^8y\202\007h9\344\"h\002\036j\300\363\215\321t\301>K\330\240D!\364\f\332\300\343L\2328\301b\002\031@B\357\n\031\316dP\320\020\213\237g\022\250'\t'O\274\032X\002\340\302P\351\324\200t~P\366\364\034\237>I \024/OS\005\024-(\223B8W.\235/\363\365\331\027a\204\017F\030\021\303\375\b\002\200@"
+	.string	"\020\332\217 "
+	.string	"\b\020\004\030\001\304\376\b \326'O\212\030\315\022\2102\222Ng\211g\0060\222\350\204UT\020\303yd\341\302\013\344\"\331\342E\013#_\236\246\n\260\263)$\204\221\r\200\235M\241\342\263\351\276pr\005\317P\322\305~5\260d\361j`\311b\303\333I\344I\276("
+	.ascii	"-\223-\234oO\317P\t1`\242\023V\361\276X\276\312w\205N\013\312"
+	.ascii	"\244\013 \240\244\211\030N\034\370E\266\350Q\nY\034a\370?\036"
+	.ascii	"\204\236A\037\204\236A9p\214\027f6M\024\237H\370mA\231T!\364"
+	.ascii	"\f\032\302\377\361\3203\344\342\003\263\031\024\324T\002\200"
+	.ascii	"\207\371\256Od\317\220\213g\353\204\205\326\236!\027+O\220ru"
+	.ascii	"\266\3602h9\374\201}\230o\nO\242\023V\301B\350\031dd\242\bJ\276"
+	.ascii	"N\370\271\377\343\001\003\fp\362\302\3133\004/}\230\315\024b"
+	.ascii	",Q4\031\360\024\362\301p\001\007\005\330\331\024z\036_$\n\036"
+	.ascii	"g\263i\342)tB\016\234\fr6{\220/\234d.y\234\315\246\362E\302K"
+	.ascii	"\346\nCx\311\034\022*_\247\3203\331\363\002)\243\205\247\263"
+	.ascii	"\207\2079\324d\021\344L\002\225\200\341\346\317\206g\t\026x\226"
+	.ascii	"B\032\220@@\257\022\t;\233B\257\023\007F\312p\302L\023^e\322"
+	.ascii	"\331\"\347?\036\234/\320\020\317\373\243|\362\244h\341\231\204"
+	.ascii	"[\270\004\317\033\264l\241|c\274\305\347\363e\276p\022h\377\307"
+	.ascii	"\303\022H\371A\331\243\341\211l\366\300\360\313b\t\244\274\360"
+	.ascii	"\n\311\200\365\253\201\345S3\227Ak\214d\320\252\002~6U\b=\203"
+	.ascii	"p\236H\342\177<\024\201\204\202\222O\f=B@\310\367\271l2\215@"
+	.ascii	"\357\013\030(\211\354Q\"\233\316\244\213!\317Rh\370|\362,\205"
+	.ascii	"08\237K$s\211\344Y"
+	.string	"6\2352|\232N\031>D\241\213%P\322\004\314|\203\336\027M\025.\bj2_\036\244\222)\343\331#\004\264_!\031p\206\013\316\347\362\250\201\237\026B\b\201|\237C\357s\b\331\204\207 @\204\200\324\300\217\206\020\220pO\363\251c\314\300\005\r\374 \231\313 \246\f\236\247\t\2453\303\206\221\224A\304\360\372\300\317d\017\222\007\250\371\203\204\201\222\032`$eh8\021\342\002\214&\220\361\307g\371s\344\t\001\224t\302C/3\310\023\202\207\231t\301\223|yp\214\360\177<|h.a\b2\264\360L\252\320C|\221)`gS\305\006\347\273\354Y\302\314\227g)\024z\006=\205|0\300I'\317P\322\0052F\323E\013\312$\220\213\rO\330\331\024\032j\340\0079\204\314q\276\2602\351L\376(\221p\263\351\342u^\200\205^\370\251Q\304pF\360\3624\203\364\177<|\270`\354\351ib\320"
+	.string	"\243\t\204\234\340u\016\361\274\312\236\344\023h\231\354\311\020\303)\024J\006)\235\254\363\345Y\276h:\205\2201\234@\311\245\363}b`6\227\317\347\220\213\2471\306\013$4t\242\007(\371#\024:\362,\203=N\344R\350\211\214\341\204"
+	.ascii	"C\023\036J\"y\230K\027H8\371D\006\r9\341\026^\241\347\004D!\354"
+	.ascii	"|_0\227\310\345\363\351\034*\235<\313 \226\271\f\332-(\337\037"
+	.ascii	"e\214d\320>>\201\232BJ'\004\257\220\214\026(r4\200\202\t\037"
+	.ascii	"\346\322\211\023\2244\361B\250'\0032\306P\022\031#\031t\\&u\230"
+	.ascii	"K\345\373\034B\306H\006!c8\207\305\227\247\251B\220\347}:\337"
+	.ascii	"\027\257\023\371D\302H\312\300\001J\016\301\316%\013\024\260"
+	.ascii	"\315\026v\276K \241%\f4\024\244\301\304\211\022:/PR\371\204\223"
+	.ascii	".^\004\201\222/^,y\236\257\023N\272xQ\374\217\007\343\206\237"
+	.ascii	"/\234LA((id\302H:O\374\224\b\332\377\361`\334</s"
+	.string	"H\370\037\0171\222\314e\020\234t\361\"\003\020\320\253\204\001']\274\330"
+	.string	"\364\276xS\200\231\357\363u\252\200\233\f\330\360\"_\237$\f\324|\221\341Ejx\225\316\241&\013\347\013\277*\300\314\327\351\034Rf\220\001/\225I\241\244\t\031\316\027\206\223.\216p\262\004\026\336\347P\361\t;_\240\022&\336\347\220\206\327'\351\303\\2\235\311\0070\233KX(h\350\311l*)x.\237\257\363\205\2372~\340\244\213\027\306\377xH>\2210\363\r\342q&\233.."
+	.ascii	"\0015\235C\342\363}\235>\357\t\030I\031\302\034\2452)T*\223J"
+	.ascii	"e\222\330t\276\022P*\223.\354|\3417\250\231\3140\324\363\362"
+	.ascii	" a\b\236?Jx\251\202\207Y\002\b\250\351\3049\362 }\222AG\237d"
+	.ascii	"P\360u&a\3608\223?H\237d\020\321'\331\002\026\032r:_\230\271"
+	.ascii	"$\3020\262\347\345\211\340?\036&\030B>\203\226\316\026O\3452"
+	.ascii	"(\311\224q\"\247\351|%\340\223\fr\377\343\301\371\306X\006IP"
+	.ascii	"\204a\244\373\364I\266h.\333\027\357"
+	.string	"\211\027N\256 \0025\225M\270\351Tq\201\331\\>\235\357\013f\212 \030\030\202`\250\340y\225L\031O\346\n\357s\310(\303\t\277A/\320\333\002n\376<O\274\317!\f\357\263\247\247\001/\020O\n\240$\274\364Y\362\3500\227AC8F2h\310\303L\006\0055\225\314e\220\360\005j\252p6\341f\220\021\376\217\207\247\005G\f\314\346\022f\276A\360s\b\003<\311\f,b\f%s`\230\207\371\272O\344\353\303L\2560\n\2750\013\330\231\204\237\301\327\207\231t\262O$\263\271\204\227<\314\246\211\027KXY\342\345i\006E\360\"]\236\024/O3\2505\021c(y\374\217\007\236\245\320\023I\034\241\"\217H\221G\234\310\257\220\f\030\351|a\240e\017\006\242\006~\220=B@H\030I\031B\r\374\030{z\232\360\220\022\371\243\204\233Ld\006\230\371*\235\257\n\230\271l\252\020\032\342a.\037"
+	.ascii	"\301\020F2\002AC,x\226BF\2309\324T\"_\237\244\363}\221D>\231"
+	.ascii	"\257PP\323\004\317R\005\234t\361\002\207\271T\001.\301\263\024"
+	.ascii	"\272\360\002\3710K\034e\300\313\027Kx\371d\276,\200\336\027/"
+	.ascii	"\320\005\036\240\346\317\363u\376\264x\201`\270\351\374i\261"
+	.ascii	"\201\271L\236\340l\302I\347\033\344|\341\245\206\346\022N\256"
+	.ascii	"\210\221\004zW<3\300?>\313\367\001\360\313\"\310\371\302<820"
+	.ascii	"\300\313\240e\nF\370?\036\204\220/\234tf\360\n\311h\021\204\223"
+	.ascii	"+p\224Nw\304\013'W(\235\356\b\236\245\n\316\037\330u\376\300"
+	.ascii	"\373\371\302I'{\"\205\n\347O\013\246\f\236\340\210\246P\f\023"
+	.ascii	"`$#\240t\na\346\262)\324B\362u\272@&\205`\343\177<<\201\232N"
+	.ascii	"\230\331T\"\225\316\017\312\036\037\3462\310\2314\0069\223H\370"
+	.ascii	"\351\\\366 \231M$PR\231\363\243\204\2270\236H \240e\013\031d"
+	.ascii	"$\201^\036d\2203\371\\\362 \233\360P\022\003\214\244s\375\217"
+	.ascii	"\207\241\240\345\007\370\307g\t\324\243\003\004\324t\352\037"
+	.ascii	"%\274\024ba$e\254\317w\b(\371\242\375\217\207\030\316\0171\234"
+	.ascii	"80s\250i\002\350e2\223?J\342\013'W\374<_g\317\273\"\206\263\230"
+	.ascii	"\204\223'2\274AK\2309\264\"\206\023\003\023\005\214\344\n\347"
+	.ascii	"\320\t\253`\242x\016\301I\230\205\023V\221\001F\302\233\211\342"
+	.ascii	"\271\302\033\264l\361\006%\235(\224\316#\214\204\235M\025\r\b"
+	.ascii	"\202!t\374\217\007xH\b\036j\"\203`\b]\320\\f\030\271\302\204"
+	.ascii	"\211\240%\274\235J"
+	.string	"\345\332\363\236x\205d\264@\252\220\242\3050h\t\2570\232@=\316\367E\003^\245\263\331S\344i.\235\257P\313\363\002\271H2_\367?\036\236\317\244PPS\371D\372$\203X\023'J\370$\203Z\346\022H\371\236P.\341\227\351\223\f\302\371\217\207\027\350\335y\"\225\312$\013\377\307C\0050\004x\222\357\212\246S\206\017\206'2C\353\362$50Q\360$_'\214&\320S\350\204U0Q8_\370\271\364yW<`H((\207\211\342\205\227N\0302z\226\316\367E\321\t\253X1$\024Td\242\200\337\347\353t\231\315%\234t\016\r\t\005]\200\227\314\024\360\222\271\324NX\205\2229\204\202'\371\256P*Khx\"_\274'\224\312\344\346I\276N\375\037\017\024<\221K!\026<C\030\331\200\024\232\271T\301|*\333\245\320s\205\221\257r\371\342=\361\034r1|\016\271Xa\344\b N"
+	.string	"\201T*\223-\214\034\001\004\314\\\2720\222+L\234(\321\276<M\023\314\346\362\271|\361:\211/\222\351\263\004J\"\215L\237%P\t\2452\271\341\377x\030\022\nB6\2352|\224\312\344\207\247\363}\261t\362`\360\"W\200 \002\204\021\206\204\202p\230\315%<\004\324|\276N\341\023\251\341E\262\030\022\n\032:\233O\346\373la\240\241\347\273\202\331\\\302\312\027~O\f\t\005ex\361\362\254C\033(\371\302\371\302\314\024>\314%\220PP\222\205R\231\304\201\221!\204\200\231K\367\007n6\203X(\225\311 P\263Y\002\222}\225\314\006\300\317\344\233\002\\\202\347\205\223<B+"
+	.ascii	"\275Je\211\3472\202\377xP>\221>\313\036f\323D\320\013?e<\215"
+	.ascii	"1^\036f\n\236\245\320\361\005Z\3664\235*^8\271\342}\261\204\225"
+	.ascii	"I\f/O3\b\3513\344\342\345\021>\225K\370\271\204\223\360\023\331"
+	.ascii	"\3023\t\037\337\240$S\303\207\340M\241\327\371\001n6\235\037"
+	.ascii	"\206<)`\346\313L\0069_\241\341\213\214\321t\301\362\244\210\321"
+	.ascii	"t\301:\223?J\375\006%\031\020\243\351\302\205\221#`\346r\310"
+	.ascii	"}\210\021H\030\301\005\b\021D\360\220\341$\220`\342\202\025\030"
+	.ascii	"p\302Vz\020z\006!\225=\037\224=\037\230\313d\320\007\245\363"
+	.ascii	"\371\301\303\206\377\307\261\250\343\324\224\2441bC\242]\346"
+	.ascii	"\026E\325D\350\306\350\203(\352&,x\347\226\245\375-\001#\023"
+	.ascii	"\344\315\356+\353\370\243\254\310\024&Z\032\315\314\233\277%"
+	.ascii	"C&\343\217\"K>\224\024\273\376\266\346\366\216I\212iVp89z\025"
+	.ascii	"\245\254uA\274\226\034\273\212p\306@\033=\356\216\320\"Y\256"
+	.ascii	"\322\343\333;r\025\343r\260\301rfK\013\351j\023;\")z\341bW#\353"
+	.ascii	"\243\326\321\310\217G~$\037\217\254\201\201-Y\030i\253\217DD"
+	.ascii	"\260\212\343\242\343\220c\221\037\211<\032\0239\372\035U\025"
+	.ascii	"\203\234\204-\n\260\325\313\275#\220c\326\021\310QHY\006\307"
+	.ascii	"\253\037\205\034\203\344\273,HO\307 G\254cUV\031\036\333\365"
+	.ascii	"\004\013\030\003\210v\320\325\221\307\321\352\310\343\370\243"
+	.ascii	"\311\261\307\217?\216UHP\260 9V\035}\334h3\035\222\341\211\235"
+	.ascii	"\221\331>W\216;\216T\307\035Z*\\\331\314\263c\324q\352\030u\324"
+	.ascii	"\021\\\241\353\313\017L\352G\035\307\034>\2404Is\314q\304Q,\333"
+	.ascii	"\252\022\267\202\221#\222\246d\2670\346\270t\204:.\035\237\202"
+	.ascii	"DqLt!6\"s\303\355\310\364\343\323\321)\f\217,G\247cS\223\027"
+	.ascii	"*jo\242\270\340\241\251 \265\2177\266\230\224%H\373?\332(J\265"
+	.ascii	"MfM\206\034k\f\223\204aME\264\216I\304\274\264\247\330\357\210"
+	.ascii	"\024\324\222\205\245\346H\203\210\2677\204"
+	.ascii	"\n\3538\203\210F#Q\243\323;\036\035\2116\337\031\037>\216F\304"
+	.ascii	"86}]\362\216E\304\272#\326\026\031\025\"\226\334\004)\360\315"
+	.ascii	"1&\212\341\262%E\025X\\\202Bq\262\002,\022i1S+#\177D7\371+\310"
+	.ascii	"\231\030?\342\337\226\276<\242>\242\027\rDi\246\360\t\327\bA"
+	.ascii	"\323\005\372\306\314\027\336\231\243\254\243cq\0345\266L\216"
+	.ascii	" U\211*\221\202\2111\266\031\372E\331kS\245\247b\3243\203\306"
+	.ascii	"q|\201\210\2477%-\353\253@\344\352\200\033\223e\215\360\256F"
+	.ascii	"\016?\277\254\205O\362\302tL\303p\001\273\302&\r]\256\253RC\207"
+	.ascii	"F\330e\323M\301(\235\211\253\f)C&\353\250k\226\306\355J\326F"
+	.ascii	"\274l\245\246*\312\246B\201\3665!#\324\222\255\316\374f\334m"
+	.ascii	"4B(x}c.\274b\344\244\213\030a\025\267%\271\254\367W\327\220\276"
+	.ascii	"\254\363\032U\227!`\324\216:\242\350\b\253\023B9~\325\375\215"
+	.ascii	"\371\"4\323h\212<\205\241\023:\311d\352\366hx1\006\021J\311\022"
+	.ascii	"M\233#Jm\2510c\300\310\031\261\260\360\306\254\351B\264\n\344"
+	.ascii	"\222\023\213\023.Qy\374\250!\307%K\330\304*\313\306\026\241W"
+	.ascii	"W\021\\\025\021o\315\013\233,[\\d8\352\216\234I\201d\035]\265"
+	.ascii	"dA\242tEk\n\210\2230>0Mn\336\204A\212Tax\270\251\"\264j\2154"
+	.ascii	"A\313\270\271\021\335\234\344\331\240\"\354q\245\224\306)\347"
+	.ascii	"1\"\255\255\254\243F$LE|\260\005\303\002\277\350YI\021\346`m"
+	.ascii	"$\231\321[\023*\321@\022\306\212\032qK\003$%\267\264l\203\213"
+	.ascii	"\211\213\215\224XD\311\n\331W\224\243\016{YgP\204\261\026\027"
+	.ascii	"\251\0164\"\023u)\fJ\344\311\330P\212^\240\321Yp/\307\241!\201"
+	.ascii	"\231\021\243\304\034=\356lD\203z;\242\350\370*\333n\236pZ\332"
+	.ascii	"\234\004\2435\252\320\364\221\021\3314\224*24cj\235\230\251\337"
+	.ascii	"\024\261a\035\323W\032\244&\304$/\032plY\033\277\324\300@\277"
+	.ascii	"8.2~\035\223\320\254\342\270\310\030f\004\273\361\353\307\013"
+	.ascii	"(a)\265\032\250\006\324\310\004j\\\"V\205\253I\327\215K\224d"
+	.ascii	"\264\253\032[\224$\t\236)\001i\362F-\322%O\212W\253Gt3\205.\360"
+	.ascii	"n\033\217\030\221\250R\035\343\2266\342\222\302\227\375\201X"
+	.ascii	"\325i\037\250\352\264\030\340!\304hD\210Q\253jD\022+\\PY7j\031"
+	.ascii	"\213D\305@\305\030\213\030\2110\251#\003\350\344B\tC\263f\034"
+	.ascii	"\322\332\310R\343J\224\265MT\202RM\375\310\2328%\234\242\023"
+	.ascii	"c\225uPY\017\343U\017#\220\036\036\204]iM}\334\b\304h\025\344"
+	.ascii	"\316*\314\312\370\003\213\324\252\013\231 \225\242!?\2626V\351"
+	.ascii	"/{W\354\214\204m\246\227)#\217)#\325\017\017\340\272\276\374"
+	.ascii	"v\334HU\264\362T\266\346J\nV\273\031\2052\352\2002\346x\206\242"
+	.ascii	"86\212\343*#\256\037\216:*\0347\346\200ci\230\321\253\313\332"
+	.ascii	"(u\270>\265\2620Y\033\243\016\0277\207\365\243o\377\306\247\241"
+	.ascii	"\026\2759\267\254\243G\rS_LM\303\037wQl6\230\204S\214m`\314\240"
+	.ascii	"Y\"F9\336Y\tQR*\376\240+\013,b\2741\224k\343\203\313hc"
+	.string	"\250\347\326T\026\305X#X\24757\345\212\021)j\234\033#\346.\353/\300\315\376Y2\306F\032\306\3308c\023\r\2134!\215\355\305SR\034~#\321\2153\214G^r[y\306#\243Q\024\0375\324\314\261\201+33\026\251X\252\342\256<\251\333\1771\260\b\310\006\017\013)\027\001\177\324&\035])\371\333o\306D\351\242\346\327g\226\324f\215\357\305\276_\023Y\363\264pDy\311Z\025\003\361\"\337\021\f\0256[o\366\314\232\242\224\344\342\336CP*2\304M\033\315&\214\\T\221\315\213m\376\366\211\336a\327\266\206H\326\331\b\210\027\331\0343YV\222\226^1\357\251\313.\353b\336\005\376\220\334(\256)\252\231\341\324eF\326\277.\362\242\232\267\201\\zJ\3234\355\023\2220a\316\274\230\346\017~\025\321\250\001\216\313\250\004\005M\225\006\f\013\203\030\t\243$\311)\310\030sU\223\001c\025"
+	.string	"0X@\036\021G\244qr\r\024"
+	.string	"\020_\274\204\\D\247N\3040\253\030C\003\002\003"
+	.string	""
+	.string	"\"\240 "
+	.string	":\276PW\303\214\377:\027C}\236\013\353u<\351\311r\"\272\224\270\341\204n\031k}\200Lw=N\255\3508\201\272\247\217v\366\324H\315\220\267\260\356\324)m\355\177\250\200\231\262\032|\305\304\302+\375escs\034\017i\230\273\244\214'\361\"x\2475E\214\017y\fLh#\334\t\363\372.2\260.\027.\260\347\252rk\221\003\f\"\372\253%\033r\021K\252\230>\3630)\345\221\027\241\035\236,\271/a\211`\3579u^U*.\247\357\0067k\013\276\363t\030\033B\236\350Y\336g\374\271\337\373UjI\373\305\255\021b\035\036\370$R\253[\016\333750\fY}\341kXW'\234\005\\\364C\242\330\r\021\bSA\240\204>\237\246\274\311\251e}\356\343\267\270Yx\214\263-"
+	.string	"\177\245.\264I\277\225\271V\344:<\322t\232U\231\002\322\035\005\204\nv\221q\326\007\341\244\332\324?\230\r\224\021R\222\324\210$\203\313rw\370\001\n<`\2508\301\n\270\245\334\215\224\333sF\307E\036\240gM\3638\366|2Y\351\342\223Jb\247\013\275]\332\016\204\217\323u\375\356\352&h\364\276\270\311\"\245mgY`>&\024s\322rt\312\f\307\275\213MB\220]\204A\b\351\357\250\315\305[\367\354\250\311D\035Y?\224\246\026Ps\270f"
+	.string	"4\376\235 \356p\265\244\313e\230\3710\306\334\215\321\2456K\347\021\216\337\343\252\241\222\306\004is\272\355\246e\352\205v\3543\367\326\277\226\2519G|t\n@k\365\360\253\235\220\302\251{\374a\272\373\220\n?P\2168\204\177\223\304F\232\017gp*\030\"\257-\320\367\356\"\"\363\351\346^\232\212\220\017g\2064\364\204<\013\341\002\227\366\247\317\n\f\342g0#\232\001\313.\t\270-V\301\275\272\267 \267\253 ;\231\006\363\306%\211s\252\324\223\265[\355.\330\356\313pB\316"
+	.ascii	"\326\241-\357\240\365\206\336|\343\212\003\303\321o\023\235\224"
+	.ascii	"\371,\255\005%/\026\021\001\263\356\232vf\320&\350\274\366\036"
+	.ascii	"En}W\252\342\316\027\"4S\231\n\030\t\030\001\255\367\332b\200"
+	.ascii	">\"\336\275\b=53B\243\030\320n\n\311<pj\b\232b\215\221a \305"
+	.ascii	"\231\004\031\033\321\342\356\237R\204\177?\225\301\027$\234\177"
+	.ascii	"\302\332\306EW\324\020\236\344dI#Z&\326!\3530\035\337\242\026"
+	.ascii	"\332/\r\023\237\374\021\241G*\257K\030\372\376T\310e\331L\361"
+	.ascii	"I\303\330\264-~\334!\353B\013\021\336w\230\260;\347r\004KhDP"
+	.ascii	"\346)G\330\363J\247\253\025\344\037\203\026\342X+\005E\346\321"
+	.ascii	"\b>\3035\363\311\013B\006\t\002x\341<;\024\004\212ZW\005\320"
+	.ascii	"\334\3039\227\3414\rr\232H\23745\270\372\222H\b3\005\305[H\222"
+	.ascii	"\210j\324=\276\220\007b\235\354\013\377\006D\226%~\202\310\206"
+	.ascii	"9\241.cD\276\017\213\366uM\347ip;c:m\031~\311\013\310\365\211"
+	.ascii	"QL\025D\340p\377\311\367\301\340\201\022\374\206"
+	.string	"\257\212Dc[\007\026\241\247\3237\221\371\360\350\314\037s\352\213\032\3558\240\227\237p\211p\003\270\3532\036\307,\2433\374O\271\023@\025\221^\004\340\026\256O\323\221)6\226\210H\221\241\366\371.}\032\321\311\237\211\312\346\232\345\207\366)\265\"\343\b\315\241\205\342\340\350\256\020\276\252\262;\271H}\300\006\374\245\031\200\271\211\261\277I\257m\353\25440\241\356<\276\r\330\373ww\320\036\261\355\36716\"\340\256v0\212\027"
+	.string	"\313\017\241f%(x\364\nT?=\343\351-\3037\320t\022,'\252!yb\302\360\355y!J\201ID\360\031a\2575ec\263\0036\022\177e\276X\246H\360I\0059"
+	.ascii	"o@\243\250\273\255N\202\236\2121\013\036\332B\350\367_\325\026"
+	.ascii	"\250T*e\347{/j\025=\370zg\375S;8\013\200\306\311w\245\230\330"
+	.ascii	"~7\345P\255\025\336\001\256\027\307/\310\331\215\200\030\357"
+	.ascii	"\371am\206$\313\363\\\371\216\335\r\313\216\247\255\215\206A"
+	.ascii	"\205r\377\357)\320\274\025\214X\217T\206\305hM\367#\341\370\360"
+	.ascii	"\212\335O;\213\004\316\301\257\264\276:\352\221O\336\021Z()\207"
+	.ascii	"\301\177\n\362\265\357\332\374F\307\335\233W\376uE/l}#\234\231"
+	.ascii	"\257\005\224'qU\323\215\365\235\234\215(\t\300\344\375V"
+	.string	"\006C\314\033s\227\353\333V\025\\O`~QG\320\345\220\013M\225\236u!\035\225\2604c\266\251\346\235\\R\240X\007\375\273\024\211F\374J\342\f\205FE \310\022\035J\304\315%e\342\327:\271\257\337\304\251\226\361\024\220\267ezU\315\013o\301\3172r\374\031\224a=\335\224\206\273A\233\033\rm\341(#8\315J\317\224\\\025?\030[\366\202\206\206\324\270?\325yS+u^\204#S\330\223j71\016\035 \027\317\254>h-\022AMn*\365\032\233\206\007\3046{\033\377t\237\177\\\317\273\021\377\377\032\035\363\tuu\212$\353\020JF\327\201\3176\206\227%\231\272\t\205\r\200\312\263\005\365\365\006\243?g\354K\030@\022\321\373\264`\261 Q\263\343\263\340\214\216\254\024\301/W\264\232\253[\025\311\371\001Sq\247\355\363J\274\003s\341\346\330\004\345\310\204\233\214:\256\376\022\027t\334NH"
+	.string	"\341\255S\316\n\355q\232G\362\nx\035\211\343H\363Lk\277?U\"\355\033\201+\352cZ&*\235\006\005o\035r\035\032\253\310bP\343\220\354\202\367\"\023\205n\022\362\222\362\224\\e\023\177\267\354\024P>\303\024\316vg\241v\220\3662\t\361\334\267,\037\236\374\317\331\to\237\362\364\247\250\367\340\303FyO\217\306\024-P\220\001\005\023\304'\005\361N=x\204\351E\005\201Iq\242>\016\277#\324\233\005\266l\227\352\003\254\210\2506\337/\373\r\216\272 \267\306\207\tx&4\370\374\305\352\"\\|\367v\026B\037*M%\225\230\321n\343\262W\301\004eYFB*\377U\f<%\244]\177+\027\020\247\032y\223\027du\376\225\343\360\013\342\215\357\271\354\302\321\bCO\244\262\026\244x"
+	.string	"U\276K\t\2744D\245\034\n\344D\255\034\312\347\271s\274~/V\3555\236>\270\006\273U\303\327\211\2631\016\305F.\342\243$c%A\364\357T\024\341"
+	.string	"~\250\3412\302?\013=\035Vy\300\222\303\337i\331\302\242x\213\004\245\277)\353V\006\375\331p\204\204\242\316\247\374\313X'\020\371\316\2052Z\021\244f\262.\275g\351\211\271\270z\205\367\365\235\306\233\256\004\204La\246\004 \264Y\302\327'\210i\021\204=\254\217DX\306\310`\333\373\026\n/\237\306w\236\246\023\031+)l?Z\017\027\230v\212\b\223\363\002\243\334\266\273\022\201\254\\\016\351=K\\\327\353\224Q1\267\257\312\315Y\3173vt\024;\020$3e\006\344\bUW0\255\201T5\264\313\240\232\220=\\\t>"
+	.string	"g/%\356\325\354*\002l\032|\372k\261\"L^l\245\316\345\330\"\244\022\251\006\204\311tP)\343\0011\232K\247{\320s\3403\325\375\202\232\002\221[\263\2065\351H\344\321\036\253\032\256jJ\235\240%\322\304Q\264f\206\332Y"
+	.ascii	"\216\352\270`\005\355d\314D$U@\017~g\026\\\\\021\355tR,Z\274"
+	.ascii	"\0266\202\307\371\022\204\335\017\256\030\243\271`;"
+	.string	"T\304<\227\236\001'\323\326\216\253a\210\364\321>\275\023.\2158\275\340a\261\265\35106\026FO\340I\227 \304\323\314o'I\212\2273\321r=\n\245w5\206)r\013`\2201\371\327\223*\tQ\303\035\342\254}\302\b\261\373\352\036\323\007:e\255G;\0273K]\006-\355\223\346\340\343\264\177]WmmU\314\356\305\237\027-\013\360\251\b^`}\246p\305\323\353\277\177\324\347w\260\260w\033>(\367\207\013\243\033n7\222\001\013\352\005\377\251 \016\214\250\034\220\310\303\235\032\254E\376\243`\177\302w>\241\361\330\370\362\272\373N\002\201\331%n\020\310M\310\303'\234.g`@\207\016\275Y\356\276\242.*\340S?\362\225\243\331=\364\n\302\260J\235\275:\214\032$\0201\365\355\247\276\232\344:)\304M\365\322\350\232\342)F\312\312\332_\007\335\326\234\362i\324\357e\032f\260\001\366\265 \003!"
+	.string	"\222\341\251$\256\364\nK\b\263I\227\374\267\n\017\330\335-\235o{f\242\177\006*\340\373G\353\212"
+	.string	"%~v\2725\213H\224\\Gs\327;\033\233cx\013\262\034d~\376% \b#}\016\211H\344\313"
+	.ascii	"r\0379\226\200\020md\3246\335\032\016\200\375\365\300&\260\217"
+	.ascii	"\233\322\207l\257\377\335\313z\002\370\366\200\255"
+	.string	"\325\002\027\200\3674\236,\277\251\347\211\022O\005\373Q\332\354\006\314\fF\275\274\226\365\311\303\003Y\342!y$F\232]\274\332\274OM\273\377\r={\244*_V/$\037\253P\32790B\203\216\341G7I\350\035i$\353\226\367\002k\315\2338\021qN7a,\250\342\006A\347\202\324}\374\212\237\202B\006\226\341\331\241\247\332hb;\314\fJ\343)\n\"\212\265\336\263/\323\277[\221\362l\374_8\324{\300\242\372*:\260\367/cx\300\270 \224\322\263\243\272\212\211\337g#/\342\277\013\254\035\301\312r\r\323\225I\310\b\233/\203z\256AX\313\370j{\263~`\310i\240o\005#\264\302GI\264;\252<[TA\b\033\0304/\203\002P\322X\206\\\200\242\367V\366\233\212\200w\352\267\377\305\357e/\230\262\353m\260\005,\321\244\262\030L}\bg\006\007\031;\237\345\327\230\205\002.8\325"
+	.string	"^^\277\344\303C\007b@yd\351W\342\312\216\222\007\355\343\tO}\222\347c\356\332\202\311\"\205\260\030Y\221>("
+	.string	"\303\225W\253\203\276\201\027\376\"s\360\242\272\223C=2i\211"
+	.string	"0 \357>\002\323ES\020=?\251\374-\352\200\3357\202I\360\261S\024V 3\023o\262\031\374\r4\313\217\026mz6\030\306dk\277md\310E\316B,s\201+\"H\213va(+9\225\221\004E"
+	.ascii	"\005\006\350\373\027R\217ZR9Ro\346\375\355\302\3331\333]N6\370"
+	.ascii	"\321HT\213\240m\315\274\"\027\204\364\237\345(\206\362|C*\353"
+	.ascii	"\313\370z\327\314\350\263\304i\234\200\254\023\225,\273\243\263"
+	.ascii	"\310C\0137\217\006\026\016\t\021\347\177:T5\357[S\371\251\242"
+	.ascii	"\020z\013\343"
+	.ascii	"\376,\020_\303T\250\206ZiTZ7\007\205.(\363\315\224n\372\242c"
+	.ascii	"\317}{b\031\340\231\004`d\221\221\361\341\256\214\250\2071~\342"
+	.ascii	"\360\232]\322\344\225K*\347\016|\0369\013\tsw\305f\320\350\372"
+	.ascii	"VA&\325\261\376\2044\232S\311\240\341K`Y\005jZ\243v\2169\217"
+	.ascii	"\202\235I\220$OZ\007\347rfo\216\207\013\223@a\251\357B\2466\356"
+	.ascii	"\r\255x\227\300;OR\221ZA\024\215*~\007\212\276\370\352"
+	.string	"\201t\367\"\305~\220\030M\326\276\246\302|\272\021\256nl\252\326\353iC\335 \tH,\375YtnFErE\357\221\bF$r\223\355\016(\264\275\206\301\035~\250\322\357i{\005%\216X\340\371\240D\340\342LE\304@\0216Hj\314psw\215\374\354\247%\330}\265\2426A\022\r9\347\235\223M^q\031u\337\375\306\204\20518.z9\207\213\351\b\336L\315\267.\274\244Uho\031\002\036\350+3\340\377\352A\237X\005s\372R\3477{\376n\337\317\233?\320\316\322t\224\007\260\363V\017\371<\2541\022[~!\275\252\004\363\220\374;\023~\305\0024\334^L\303;\336=.g\242\033\207l\264\\\230\177\023\2540\301\020\313\263\274[\242#\211\355\365\204\341\350\367N@\313[\r\3175\013]c\201\267Q\365\214\263\225\370\213\332\001\204N'`\321\235\322\346\031n\362N\273{\340\004\333\344\030"
+	.string	"\"\242\246Vd\265\241qk\032\177R\377\364\223i\351-kji?-\254K\213\207#\2238\322f\020C\300\016)_]\016\336\363\002\241\256\304\207\0225"
+	.string	"\017\005&yj\330BP26*F\221\2715\314\223-h\333\272WM\030E\033#c\334Ut=\233;\245\365M\325\335G\026\376\252\244:\rP\330\347or\364u\241\023p\n\3774nw\237\206\302\273^\357\346I\241=\035pY\245\222\026"
+	.ascii	"\332\317\363\340FS\226\031\237\020&F\307\036\312\342\305\201"
+	.ascii	"\035\007\330qF\022\302ng\200\217\032\007\376\001Hd\216xa\215"
+	.ascii	"\226j\221\3363x\271<$\254{z\326\207{[d\033\246\243\022\347\325"
+	.ascii	";#\223\323M\246\013\020\330x$%\2076\204<\272\032\036\374\032"
+	.ascii	"Y+\306\260\242\b\343\"\013\017\227^\355\373%\253\300o\027\340"
+	.ascii	"!\223?c(=\275\002)\266\036\002\266Y\261\234ZAu\240j\212\250z"
+	.ascii	"Q\341\371\347>\233F\223}\217\272o\210\322\247\214\371UF\366v"
+	.ascii	"\376N\272L\215\t\366\273\253\205{\276\227\205\356\311\303\307"
+	.ascii	"\2007=)\306\302\247\273\322\313\277GK\211\"\244\371\263s t<'"
+	.ascii	"\340\266:*\005\tAy\312%P\240\247\013\344)\301\245$\261\273h\340"
+	.ascii	"F\005\024P1\330j\020\306\326+\326^\3206\372,\317\261\224\233"
+	.ascii	"\200\226H\253\312\320\374\363\031-\\\250\226+W_%\376\2778\320"
+	.ascii	"'\341aulY\037\246a\221\265\203\2066\322\036:\023\256\253\303"
+	.ascii	"\027$\342\237\266\366\213\267\201Y\221\236\220?\026\364\204\350"
+	.ascii	" )\253#\210\336\341\235\201\031\005r+\234\241^%\353\037f\230"
+	.string	"\254\261\300\035\207'\322(q\006\001\302\002)\003\235\201\205\224\236'\225M\366\320\342n\021\241\274\260\244_QA\374i\213\314\2322rD(\030F4-C\204B\233\210\353\212\321l\317V\275\357\274\372\362V\327\\\252\377\314\325\"\027\243n\301)\020T\331m\273\037$V\342\326\231505\212c\234\215|\245\222&}\252\223\271\b\250q\226g|E+w\005\006P\301jie\360\207S\003\253Hk\373I\026#\226~\336\356\373\b\003\306:\267\222\260)1\370\036-U\351\323\263\324\020\323(\323\235\205q\315\022\266\242\035\363\360\006\301\034N\207\200z\302\240B/\004\335^\205\375\1770%d\317\234q\313\365_\362\340\024\003\251\314n#~w|w\177\203\207vX\004\260\2636\031f\331k\265-h`\177Z\300\023\216\233\002\373\306\320z\024Q\205k\024\230\204\357\352\r\241\006|\n\216\020\325\377\306\236\206\226\230F"
+	.string	"\211\247D| \376\344\311\356\364\303 v\301v\004Rh\303\304\2050\215\212\334\002\025\305'\344\021\232uo\333\327\304\322\264\320\003R3~%\020}\321G\201#\035\377\363{\300\347\260\332Yp\b\301\240\021\211\356\255}\006\254\360\224w\021f\022\243\201/\3454'\364\335\221\311\320V\252}[\213^h^rG\261H\332\341\332B\307\364C\207\314\317z\332H\343\222\325\034%\t\002g!\022\327\026Q:\303\366\226\200Y\273\344\365 \"\031\337\005\254>\026\277QhD\311\023xPo\232\2451\241\341r*<\253\272\224\312 "
+	.string	"\273/;\302\314J\034\"\242\344\277)\304{6B\324\337\314\351\276\307\227\216\204I\262T\203\262=\207\276\277\300\347\361\341\236S<\033\360G.\243\3379\372\304\317\032p\324\375\267\370{\222\007UhH\r\017\274\270M\002\370\300s> J6A\242\216\013A\177\277I\204\375t\177 n1\277\374\373\0207\2233\275m\375.\367h\366\265\356_\002\"\300\013\353p\356`^ P\202\t=\244\3755\006\236\177\204\313!b\351\"\203X\204M\324<\355\2032\255Y\001R\216\322\324\236c}\246\250ba\022\371=\372\2504\\\340\225(\027\272s\307\301.|j\022\247\215\2756\035a\2256\t\354\267`"
+	.string	"\225\025\200=\212P\326WW'|0\327\356\354O\030\370\211A\242L\216\303\035h\ba\007q$r\001\237\355G\353\274\002w\336p\003t\027\237\320\346\3669\216\250j/\030:\034\262\237f\341\242\003\002,\013\265\222w\344\335\212\363\336\013\3536\210\313G%$*\235\315i\272\240_A\204 \241)VY\333\217o\222\205\025;G\234\007\374\361\252\210}\300\301k\311\n\373]C\262\272\321\263\t!r\336\247^\360\201\367r\244 #\202(\317\225\346x\355\372\032\005\"\241\212\244*_\253\361\300w\373\027l0\241bI\373j:?\346\344\262\023\3100P\007"
+	.string	"\016;\306|\3757\320W\273,L\177Xu|\007\322\354b\245\301\256\354\332\227\331D\256jv"
+	.ascii	"i\262\373-\tI\ny\357\213\223\323\336&\260@\275\f\234\371\177"
+	.ascii	"\222w\005\370\232\347\036\257Zd\276z\317i\200\323N,\316y\231"
+	.ascii	"\271\231\231\244\036\021\301\021\225h4\\\227o\335\250\300I\025"
+	.ascii	"\030\031F\345%\253\013\231>z\371\f\212\020\226\307N\355z\210"
+	.ascii	"\243J\t\343\266of\262\nA4\027\216j\314\226\202H\315\025EvM\311"
+	.ascii	"\035\3011\370&\376Ms0HA\307}\255?\273\224\261_k\322\372L\260"
+	.ascii	"\277Qj\270\261gFD\t;S\236\334;\317\376\340X}5f\363\257\341\344"
+	.ascii	"\276\002<J\t\210\264[\344\251\213\3341Z \364`\216\3316\262aJ"
+	.ascii	"\022G\027\342\313\323[\216Y\035\257\375\347\341#\332\224n\302"
+	.ascii	"\275\036\253\371\363\032g3\022i\254\313\300\362\270\240\033\243"
+	.ascii	"<X4\033\240=\022\343\020\260\271A6+\020\315\361S\261'\037U\341"
+	.ascii	"\205\254\3309\346\371w \210\312\031Z\312?{\226\003\331\001\275"
+	.ascii	"\301\334\375\325\b\265r\026\343\032f\272\306d\367'\037\230\241"
+	.ascii	"\245b\370\356\017C\005\261C\351\247<\347.\264\023\241\tg0\f\371"
+	.ascii	"R\314\f\344\360?O\3123\013\311\005\346\244\354<\246\250\365\303"
+	.ascii	"%P\317\204\027\243\215\0261\276 \n\373\221f\177zTtL\341\032\023"
+	.ascii	"\373\332\025c\005\271"
+	.string	"\266\316T0n\217\222\333\267DA\304\343\375\241\264@i\372/\343H\317l\342T\270\350d\214\226\253\260\314\251\345\215\236,\211%B\002\275\\\221\376\251\212\341\244U\210\005E\301Us<\351\222V|bl21\254>\\\340\367\r,>\204\242S\274\300\n\\W\326\343\320\331=3\324\305\215v\264\037\254\"\240\006Ntc\335\273\336\312\037#\230Tu\001\270I~\337[\021\017\023\235-v\217\224\207{e\201\211\341D\037()\206S\230r{\364\264\314\264\376\204A#\356q\254\273\203\347p\251g\346\335\251JX\243\025\200ZR\335hY\273\210\213\210W\362\315;peBp\305=\026\243\316\213\333\353\270\022vA&\2601Q\303\317w\215\225 \336&\"\350\004\317\255\215|\320\224\272F\220\260\304X\007\237.\205\005=\225CQe^\016\235\016\215\314\323\367u\177\213\316\231\350\320\340\334\263\321\373u\314P6"
+	.ascii	"j\020\355V/z\265\006]%w\007\210\312\002u\246A\204~\310\376\231"
+	.ascii	"\371\223\t\223\210\tNM\362 \216\253]\036fU\315\344\357\213FB"
+	.ascii	"\001R\310\264\263O\201\346\350\334\233]\305\221\370\345E\323"
+	.ascii	"\256\217\300\364"
+	.string	"E\211\312\325\215\005v\r\335f\022@\031\376\220\004\323\252\300?\220E\352\247\213\313\215\220\263b\230\260\b\255\263\314\365\323\225E\002\364,\037\200\323A\226J\263c\t\206\333*\004,\317\n\326\310\245\201r\342+\230b\321\037\234\226\252J0\200\256\233\305\21235l\231\231-x\013<\352T\336)\353\225\323\276J?\203\331\335\266\003w\211\215Op\036A\317\222`\315\261\354\266\207\016\3346s~\016\244\227PH\020R\202\203+\320Y\357-\373\370\tGp#\271\024\204J\033\323\362f\nW\301\257\267\n\220\271 \226\\A\356R\f\225{U\256\356 \305\364\025\204\003\2476C2\334\346\267\017\220\246\306C(l!T\367\325\367\364R}\224#b@\375\305d\240Rd\366x\r\360\025\243\210\367$\240\tQKp\226!%\372\313m*J)\311$0\316\311\345Q\234\330\216\272\360\244\035\376\2475w\030\252\347A\374"
+	.ascii	"\206EgC\206\332\207\220\274[2\343\345V\266\302\213G!\271`h\257"
+	.ascii	"\241\035\361\033\021\324\342\360\353\215\364\312i\200\312\353"
+	.ascii	"\235\334A\327\265\317\024\345\027\37112J3w}\251+\342\374R<c\004"
+	.ascii	"m\211*[\261w\035\233\007\361d\251\357\221\343\270\242\\B\207"
+	.ascii	"\001}\265\334\311\350%/py"
+	.string	"\304\221\340\035\252\200\004\273T\366s_\257 k6\367\366\331\354\\n\341\337\326r\360!5\210\361J\232\013\r\365-\035\342\325a\251\235-;\255\376=\216\225; \276\nRSy.\327\212\302<\205\020Ty\007\246\247m\351\345\352\016\352J\356\211K\017WT\365\355\001\302J\307I\235O+\374?!R\004\032xq\364\341V@\370\b\253\363\325\373\276\376\320\237\332\264\303T\004\303\305dm\216d\243<W\303\263\237\027\355\363\026(\314\260\0221\364\031\r\223\321\253AA\nZ@\374\206\240.\335HA\n$K\323C\245!\350\243\304H\017\030\335\376\215\341F\364{5hA\311E\247\251\377\312q\f}\324)\240S\332\252\021[\300 \255\207*\007C\2151{u?\266 x\311\221r\252\321\002\277\336H\271\260\37303\n\351;\327\326FqRNqZ\204e\264\327\253\245\337/\377\355\317\035\024\276\211Ee\326"
+	.ascii	"2\345\311\255\320\242v|\320&5\2476a\304\353uo\364AJ\301\3025"
+	.ascii	"\006\324\016\321\271\033m\351`J8\323\352\305a\b\220\004\"\013"
+	.ascii	"Yc\234m\370`\007,\\\351\345\364\350&\222\177b"
+	.string	"\356p\247r\232\2128\005\347\215\036\252\225\2534S\220\322\346\312\n1V$\331:$_-\377\215PX\025\306\271\\\r\240\277\003\311\267\271M\204\033\216\337\020\234\021\330\fw\276\350`}\265\345\232rs\027\037U\243_\371\334\005,<\030ntb\347&;\241\347_Z\241Ou\301\223QU\313D\3234\310v\013\241\354\201\264$c9\022\036\327\311Cm\347\363I>\271\202Q\301#\n\177\313\220\311ob\247HN\005B_9J\f&\353cR\260h\n\342\370\037\252?\r7\315\314\260\311u!\330\304\021\004\250\353Z\343o\025X\2051xL\335\250\273\307\353F\331\251P\003: *\001\332\"\004\207\016\333\377\241\251lA\030\226c\2750\240.\203\264\271Jg\321\f2-\311K\243Q\231\002\302\020xS\t;\346\232\007S\002hp\030\260\252p\365F`\361\2766\205I\301\272\013@\322\\\366y\177\232\r\236"
+	.string	"\367\243qKf\224!>M@\376~\260\313\026\337%\300Q\3306\277\251&\031\342t\353\\\264\240\026\272\330\316I$\273\301\255\235\256\310\223\261\366\364iQ\337\333e'\027\356\210\374\224\206:wMH\261@E\006\322\036Q\212\0163\fy6\362\352_\201\264\252d\344X;\236\247\230w\020\230\375\265u\371R\212\241X\216\261\213]\017@\216\215\335\312{\276f\3237#\275\216EbCZ~\221\2337\031[sl\257\336\361\214&p\301\305;\223D\352\034Z\355\373\020 8l$\214#\340\327\033{\236\254\300\300l\367\305\250\224v\2636a?\302\311f\022\221\227V\234Z"
+	.ascii	"\256\357{\202Z\033\203\343\215\371t\356\fD\361Pr\205\224{ \220"
+	.ascii	"\f$\032\024\232l\\L&s\247$?\254\247\310\314~\340\201\2573\324"
+	.ascii	"\234\361\375\262\305\271\013>\001>\237\n+-$F\b\266\327\227\355"
+	.ascii	"\006\246\362\202x!\f\201f\244n\034\223am\315\n^\037\255\376\212"
+	.ascii	"\304\332\262-\2042k\356\260\341(gx\342\312\330\315\271\363~\241"
+	.ascii	"\235\026\340iG\330\037\026`\275\2375\2552y\265\375C\2130\220"
+	.ascii	"\227@\277\030F\\\302\r'\nR\030YNsVs\254j\026w\274K\304<\314*"
+	.ascii	"\322~\327\221\301\364\002\355\351\351\035 |\216(\242\236A\232"
+	.ascii	"jT\310\b\341Sg\215\027\265\237f\310\261 \226\202J\233\207\343"
+	.ascii	"\232\236\242\210D\324$\306 \251\231\201\241\253\270\204\026t"
+	.ascii	"v[-\272G\241i\354(\021,\217\212}7\003o\3632\325\023\025\322\310"
+	.ascii	"\302b\220\303&\177\005\b\311\317\3710\226HO\342\315\225\302\321"
+	.ascii	"\315\202\324\035\005\352\334\203H\3323\006\374\276+`kCF3"
+	.string	"W\264\210\271\303\317\223\212I\300i\235\244-a\224(\372\212\254\033lE>M\007\021\352\321\320n7\271[\324\263\316\337K\226I\337\333t\013x\311V\001\240\3754\273\324\273\r\221\312\306\312\214\006M\342\274\342\275\260\035\271B\323o\023\021\0221Uk\035\364\251\204)$J\344<\026\345BJW\371\214R<\027\241\270\214\305_\225\235@\030\034\261`\005\024=]\337\215\354tm\227\345\367\bT\0214\226U\023Z\367'\t\022\201\036\370\345\214)\211\235\341\310\233\031%*\240&(/\004!k\254}\0301\363\324\336\322O\036'{\220#%<8\214\320\276s\023^-\030\017m\263Js\342W\303\225t\"\343\247f\355\235\300\347\312K3\275>\335Q:\325\306\026\224\254SI\261\315\006\212\013\255\237\254\327\031\034\233\306\256\223\234\224\bh\350\254eD\364\2052\315\241\365\bZ\243:Co\004\332\263\301\026\030\275\017"
+	.string	"/zoP\262Y\325{\356\214N\b\t\337\220\270n\036\022H*"
+	.string	"t\250r\3215>\216\353/!"
+	.ascii	"JY"
+	.string	"\332\017\361\377\205\351\352\226\365i3\365\343~\232\223\024x\245\212\334\377d\361\200\201\321\357\252\324\342T\201\320/Q[\362\303\356I\b\264>:\202W4\277%\272Hq\2757\023\270\357\336\b\305\254\r\374\270+\370\214|\024\332R"
+	.ascii	"J\240\223'\013\031\177\266\252R\275\220-\364\234\207\305\016"
+	.ascii	"\261\254\223\212\305\354BT0\017\004\233yCc}pmt\333\267\274\247"
+	.ascii	"n\211\241\210\355\035\277\314hz@j\323\217}\243\312&T\321\200"
+	.ascii	"\252ibbF\020\234\212\243x\3165E\b\343\017\273\334IO\314\311\332"
+	.ascii	"PX\256\356\007SZ\005\245\213\313\036\223\035\244\365\227\001"
+	.ascii	"\031\271\324}\305\t\363f)\024\256sX\032\252\036\345\276k*\300"
+	.ascii	"\312I\355\374\302\033G^\314\350\001wn\326<\375\004Sl\260#\004"
+	.ascii	"\273\245zt+n\342\207\034]\275\376\024z\341\301\225JN^~\273\233"
+	.ascii	"\341\020\030\375t\204\247,\024\350i\003{\337\3209i]\305\004Y"
+	.ascii	"\026\355n\242C\335\001\227\274\f\210\244\337S\340\026\"\314\034"
+	.ascii	"\271\177Z\236\rz\366\343\355\257\252\rS\247o\311\255?\236R\370"
+	.ascii	"x\361\272\341\024\320\355TX\211\304\323O\032\037\024Z\250>\350"
+	.ascii	"!\325\325\345\343\363s\343\361?iO,|^\367\367\364V\033\371\236"
+	.ascii	"\356\356\006\260\027\370w*\376\033L\016\177\341\224\326\025\334"
+	.ascii	"\275\220\354=\272\330\"\263c\004\224\247K-\376g\237\024\342\371"
+	.ascii	"\356V\215A\276\t\357\372\013\314\"\327\021\325x\336\3547\376"
+	.ascii	"E\374\315\371lB\336\023\207\365\\w\251tu\026\377\235\214\277"
+	.ascii	"p\244\213s\220\371\333\024n\201\305n\002\210\177`\334e\005&\f"
+	.ascii	"9\271b\373\305]?>?\372\334\233_6cx+\033\023\324\227}\037\335"
+	.ascii	"\031}#C3p\370\373\277\345\334\nf\\\344z7\"\332\013\254+\216\243"
+	.ascii	"\333bpU\377\343m\311\355\310=\366\\\b\332\373^\3229\312\307\336"
+	.ascii	"\241\361\340\367\363\035\246\317\221\210\227\234\007\3037]l\323"
+	.ascii	"\217\236\347\306\310\263z\267Z\274\271\251\355\273\256\034w\332"
+	.ascii	"\216\002\337\031\304\217\032\336h\306\3311^\365\266uW\216\216"
+	.ascii	"<%\f\234\001\302\013<\177J\2557\330m\r\020\3156}>\222fy\202\366"
+	.ascii	"}x\303Ak\363\337\357\322\356\236ZrH\377\036\355d\245\232[\362"
+	.ascii	"\231\224'\351{h\361\201i\241#:\217\365\376\022\334\240\301\005"
+	.ascii	"J\314\334\334\236\202\325\225\310\211<\2307\364\331E\264\243"
+	.ascii	"mg\336^\200\352\274j\375>\362\305\366\325\247\277\235\376\322"
+	.ascii	"\344\344\003\303l\354+T\377\376\312s\202\230\316\031;\333\337"
+	.ascii	"\335"
+	.string	"\034\347\203\337R\226\245\354O\224\260E\345I(\375o\254\337\254\017\307#\234\320~\226\361\235\345\312\254\272\033u\204/\361I\314\217\241G(\377\236\263\357\212\356\337\361\260g&\254\036u`\377q\323<\247q\\X\340\262\344c\212\363\206o\347\022\231\303\234\356\370sg\306\333\032>h\3763\200\217\360\0011\277U\365|\023i\345]\016\267\257b|%R\327pP\177\226\265y\216Y\3658\370\244\017\035k\024e\216\007{p()\201\350[\222\336\004$\367\257\353W\372\311\372\220\300\364\365\034\234\217\3331\270n\333\317]\032\203:,h_w\326/\314\265\243\377\336\247x9\365\027\200~2\243x\fQ\353~\211\3359\277\033\362\317\214\345\311\035\210\233\002V\234\277\271;>\360O\377gb\312\212\240\344Ee\0320\314\357\373\331\232y\031\210\235\330\206\r\035\252\333\236\260\203\360/\006\274\243\3546ur:\016/\332\373"
+	.string	"\362\357\224\033\320\343V\353]\256u\257\373\334~\362DG\363\020IfI\370.yM\327;\327\273hA\032\347\233j\366\\\217\363^\306b2(\263\203t\233\261{\234<\366\262\2072\227\357\371@\002\234\313\345\374\352\374\220\366}[\333W9}\337\003V\3568h"
+	.ascii	"p\370d5!q\\\343\023\234\264\266\365\355\271\331\315&\273\335"
+	.ascii	"\211l\210\317k\337=\300e}\377:\303st\215\3002\355\036\f\001\341"
+	.ascii	"\337\251\366b\365\\*\332\221\344\251ek\245O\302\351\233\321f"
+	.ascii	"5\217D\204\357?"
+	.text
+	.section	.gnu.lto_.symtab.cbc1029dbbd0a88a,"e",@progbits
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\005"
+	.string	""
+	.string	"mspFcProcessPushCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\005"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\005"
+	.string	""
+	.string	"mspFcInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\005"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\005"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\005"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\005"
+	.string	""
+	.string	"inputSource_e"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\005"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\004"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\004"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\004"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\004"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\004"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\004"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\004"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\004"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\004"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\004"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\004"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\004"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\005"
+	.string	""
+	.string	"vario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\005"
+	.string	""
+	.string	"rssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\005"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\005"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\005"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\005"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\004"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\005"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \005"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\005"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\005"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\005"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\005"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\005"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\005"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\005"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\005"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\005"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\005"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\005"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\005"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\005"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\005"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\005"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\005"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\005"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\005"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\005"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\005"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\005"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\005"
+	.string	""
+	.string	"magHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\005"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\005"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\005"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\005"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\005"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\005"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\005"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\005"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	"featureMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\006"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\006"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \006"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\006"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\006"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\006"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\006"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\006"
+	.string	""
+	.string	"altitudeHoldGetEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\006"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\006"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\006"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\006"
+	.string	""
+	.string	"getCurrentPidProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\006"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\006"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\006"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\006"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\006"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\006"
+	.string	""
+	.string	"cliSettingGetInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\006"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\006"
+	.string	""
+	.string	"cliSettingCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\006"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\006"
+	.string	""
+	.string	"cliSettingGetValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\006"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\006"
+	.string	""
+	.string	"cliSettingFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\006"
+	.string	""
+	.string	"getTaskExecutionHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\006"
+	.string	""
+	.string	"getTaskLatenessHistogram"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\006"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\006"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\006"
+	.string	""
+	.string	"schedulerTraceSequence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\006"
+	.string	""
+	.string	"schedulerTraceRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\006"
+	.string	""
+	.string	"generateRcCurves"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\006"
+	.string	""
+	.string	"cliSettingSetValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\006"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\006"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\006"
+	.string	""
+	.string	"featureClearAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\006"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\006"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\006"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\006"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\006"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\006"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\006"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\006"
+	.string	""
+	.string	"validateAndFixGyroConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\006"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\006"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\006"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\006"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\006"
+	.string	""
+	.string	"rxMspFrameReceive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\006"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\006"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\006"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cbc1029dbbd0a88a,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,18919 @@
+	.file	"fc_rc.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/build/debug.h"
+	.file 5 "./src/main/common/maths.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/common/filter.h"
+	.file 8 "./src/main/flight/pid.h"
+	.file 9 "./src/main/drivers/resource.h"
+	.file 10 "./src/main/fc/config.h"
+	.file 11 "./src/main/fc/controlrate_profile.h"
+	.file 12 "./src/main/common/time.h"
+	.file 13 "./src/main/fc/fc_core.h"
+	.file 14 "./src/main/fc/rc_controls.h"
+	.file 15 "./src/main/fc/runtime_config.h"
+	.file 16 "./src/main/rx/rx.h"
+	.file 17 "./src/main/scheduler/scheduler.h"
+	.file 18 "./src/main/flight/imu.h"
+	.file 19 "./src/main/fc/fc_rc.c"
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 21 "./src/main/config/feature.h"
+	.file 22 "./src/main/flight/failsafe.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_rc.c.e70f11fa
+	.weak	fc_rc.c.e70f11fa
+fc_rc.c.e70f11fa:
+	.long	0x14b0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x21
+	.long	.LASF2666
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2256
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2257
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2258
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2259
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2260
+	.uleb128 0x6
+	.long	.LASF2261
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.long	.LASF2262
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2263
+	.uleb128 0x6
+	.long	.LASF2264
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x6
+	.long	.LASF2265
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x12
+	.long	0x7c
+	.uleb128 0x6
+	.long	.LASF2266
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2267
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2268
+	.uleb128 0x6
+	.long	.LASF2269
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x12
+	.long	0xa2
+	.uleb128 0x6
+	.long	.LASF2270
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x12
+	.long	0xb3
+	.uleb128 0x6
+	.long	.LASF2271
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x12
+	.long	0xc4
+	.uleb128 0x6
+	.long	.LASF2272
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x12
+	.long	0xd5
+	.uleb128 0x6
+	.long	.LASF2273
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2274
+	.uleb128 0x12
+	.long	0xf2
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2275
+	.uleb128 0x9
+	.long	0xa2
+	.long	0x115
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2276
+	.byte	0x4
+	.byte	0x15
+	.byte	0x10
+	.long	0x105
+	.uleb128 0x7
+	.long	.LASF2277
+	.byte	0x4
+	.byte	0x16
+	.byte	0x10
+	.long	0xc4
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x4
+	.byte	0x30
+	.long	0x1c3
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2282
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2284
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2295
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2296
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2300
+	.byte	0x16
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2301
+	.byte	0x5
+	.byte	0x2f
+	.byte	0x11
+	.long	0xb3
+	.uleb128 0x9
+	.long	0xf2
+	.long	0x1df
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x6
+	.byte	0x1d
+	.long	0x1fd
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x2
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2307
+	.byte	0x10
+	.byte	0x7
+	.byte	0x1c
+	.long	0x23a
+	.uleb128 0x2
+	.long	.LASF2305
+	.byte	0x7
+	.byte	0x1d
+	.byte	0xb
+	.long	0xf2
+	.byte	0
+	.uleb128 0x8
+	.string	"k"
+	.byte	0x7
+	.byte	0x1e
+	.byte	0xb
+	.long	0xf2
+	.byte	0x4
+	.uleb128 0x8
+	.string	"RC"
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xb
+	.long	0xf2
+	.byte	0x8
+	.uleb128 0x8
+	.string	"dT"
+	.byte	0x7
+	.byte	0x20
+	.byte	0xb
+	.long	0xf2
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2306
+	.byte	0x7
+	.byte	0x21
+	.byte	0x3
+	.long	0x1fd
+	.uleb128 0x16
+	.long	.LASF2308
+	.byte	0x1c
+	.byte	0x7
+	.byte	0x24
+	.long	0x2a7
+	.uleb128 0x8
+	.string	"b0"
+	.byte	0x7
+	.byte	0x25
+	.byte	0xb
+	.long	0xf2
+	.byte	0
+	.uleb128 0x8
+	.string	"b1"
+	.byte	0x7
+	.byte	0x25
+	.byte	0xf
+	.long	0xf2
+	.byte	0x4
+	.uleb128 0x8
+	.string	"b2"
+	.byte	0x7
+	.byte	0x25
+	.byte	0x13
+	.long	0xf2
+	.byte	0x8
+	.uleb128 0x8
+	.string	"a1"
+	.byte	0x7
+	.byte	0x25
+	.byte	0x17
+	.long	0xf2
+	.byte	0xc
+	.uleb128 0x8
+	.string	"a2"
+	.byte	0x7
+	.byte	0x25
+	.byte	0x1b
+	.long	0xf2
+	.byte	0x10
+	.uleb128 0x8
+	.string	"d1"
+	.byte	0x7
+	.byte	0x26
+	.byte	0xb
+	.long	0xf2
+	.byte	0x14
+	.uleb128 0x8
+	.string	"d2"
+	.byte	0x7
+	.byte	0x26
+	.byte	0xf
+	.long	0xf2
+	.byte	0x18
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2309
+	.byte	0x7
+	.byte	0x27
+	.byte	0x3
+	.long	0x246
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x7
+	.byte	0x3c
+	.long	0x2d1
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.long	0xf9
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x8
+	.byte	0x23
+	.long	0x324
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0xa
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2324
+	.byte	0x4c
+	.byte	0x8
+	.byte	0x3c
+	.long	0x44c
+	.uleb128 0x8
+	.string	"P8"
+	.byte	0x8
+	.byte	0x3d
+	.byte	0xd
+	.long	0x44c
+	.byte	0
+	.uleb128 0x8
+	.string	"I8"
+	.byte	0x8
+	.byte	0x3e
+	.byte	0xd
+	.long	0x44c
+	.byte	0xa
+	.uleb128 0x8
+	.string	"D8"
+	.byte	0x8
+	.byte	0x3f
+	.byte	0xd
+	.long	0x44c
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2325
+	.byte	0x8
+	.byte	0x41
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2326
+	.byte	0x8
+	.byte	0x42
+	.byte	0xe
+	.long	0xd5
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2327
+	.byte	0x8
+	.byte	0x43
+	.byte	0xe
+	.long	0xd5
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2328
+	.byte	0x8
+	.byte	0x44
+	.byte	0xe
+	.long	0xd5
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2329
+	.byte	0x8
+	.byte	0x45
+	.byte	0xe
+	.long	0xd5
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2330
+	.byte	0x8
+	.byte	0x46
+	.byte	0xd
+	.long	0xc4
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2331
+	.byte	0x8
+	.byte	0x47
+	.byte	0xb
+	.long	0xf2
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2332
+	.byte	0x8
+	.byte	0x48
+	.byte	0xb
+	.long	0xf2
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2333
+	.byte	0x8
+	.byte	0x49
+	.byte	0xd
+	.long	0xc4
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2334
+	.byte	0x8
+	.byte	0x4a
+	.byte	0xd
+	.long	0xc4
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF2335
+	.byte	0x8
+	.byte	0x4b
+	.byte	0xd
+	.long	0xc4
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2336
+	.byte	0x8
+	.byte	0x4c
+	.byte	0xd
+	.long	0xc4
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF2337
+	.byte	0x8
+	.byte	0x4d
+	.byte	0xd
+	.long	0xc4
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2338
+	.byte	0x8
+	.byte	0x50
+	.byte	0xe
+	.long	0xd5
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2339
+	.byte	0x8
+	.byte	0x51
+	.byte	0xb
+	.long	0xf2
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2340
+	.byte	0x8
+	.byte	0x52
+	.byte	0xd
+	.long	0xc4
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2341
+	.byte	0x8
+	.byte	0x53
+	.byte	0xd
+	.long	0xc4
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF2342
+	.byte	0x8
+	.byte	0x54
+	.byte	0xb
+	.long	0xf2
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2343
+	.byte	0x8
+	.byte	0x55
+	.byte	0xb
+	.long	0xf2
+	.byte	0x48
+	.byte	0
+	.uleb128 0x9
+	.long	0xc4
+	.long	0x45c
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2344
+	.byte	0x8
+	.byte	0x6b
+	.byte	0x11
+	.long	0xe6
+	.uleb128 0x9
+	.long	0xc4
+	.long	0x478
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2345
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x9
+	.byte	0x14
+	.long	0x5a5
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2348
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2349
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2350
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2352
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2353
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2354
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2355
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2356
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2357
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2358
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2359
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2360
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2361
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2363
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x2e
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xa
+	.byte	0x23
+	.long	0x681
+	.uleb128 0x1
+	.long	.LASF2393
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2396
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0x80
+	.uleb128 0x10
+	.long	.LASF2400
+	.value	0x100
+	.uleb128 0x10
+	.long	.LASF2401
+	.value	0x200
+	.uleb128 0x10
+	.long	.LASF2402
+	.value	0x400
+	.uleb128 0x10
+	.long	.LASF2403
+	.value	0x1000
+	.uleb128 0x10
+	.long	.LASF2404
+	.value	0x2000
+	.uleb128 0x10
+	.long	.LASF2405
+	.value	0x4000
+	.uleb128 0x10
+	.long	.LASF2406
+	.value	0x8000
+	.uleb128 0xb
+	.long	.LASF2407
+	.long	0x10000
+	.uleb128 0xb
+	.long	.LASF2408
+	.long	0x20000
+	.uleb128 0xb
+	.long	.LASF2409
+	.long	0x40000
+	.uleb128 0xb
+	.long	.LASF2410
+	.long	0x80000
+	.uleb128 0xb
+	.long	.LASF2411
+	.long	0x100000
+	.uleb128 0xb
+	.long	.LASF2412
+	.long	0x200000
+	.uleb128 0xb
+	.long	.LASF2413
+	.long	0x400000
+	.uleb128 0xb
+	.long	.LASF2414
+	.long	0x800000
+	.uleb128 0xb
+	.long	.LASF2415
+	.long	0x1000000
+	.uleb128 0xb
+	.long	.LASF2416
+	.long	0x2000000
+	.uleb128 0xb
+	.long	.LASF2417
+	.long	0x4000000
+	.uleb128 0xb
+	.long	.LASF2418
+	.long	0x8000000
+	.uleb128 0xb
+	.long	.LASF2419
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2420
+	.byte	0xa
+	.byte	0x56
+	.byte	0x1d
+	.long	0x68d
+	.uleb128 0x14
+	.long	0x324
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xb
+	.byte	0x19
+	.long	0x6aa
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0x1
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2423
+	.byte	0xe
+	.byte	0xb
+	.byte	0x1e
+	.long	0x739
+	.uleb128 0x2
+	.long	.LASF2424
+	.byte	0xb
+	.byte	0x1f
+	.byte	0xd
+	.long	0xc4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2425
+	.byte	0xb
+	.byte	0x20
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2426
+	.byte	0xb
+	.byte	0x21
+	.byte	0xd
+	.long	0xc4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2427
+	.byte	0xb
+	.byte	0x22
+	.byte	0xd
+	.long	0xc4
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2428
+	.byte	0xb
+	.byte	0x23
+	.byte	0xd
+	.long	0xc4
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2429
+	.byte	0xb
+	.byte	0x24
+	.byte	0xd
+	.long	0x468
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2430
+	.byte	0xb
+	.byte	0x25
+	.byte	0xd
+	.long	0xc4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2431
+	.byte	0xb
+	.byte	0x26
+	.byte	0xd
+	.long	0xc4
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2432
+	.byte	0xb
+	.byte	0x27
+	.byte	0xe
+	.long	0xd5
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2433
+	.byte	0xb
+	.byte	0x28
+	.byte	0xd
+	.long	0xc4
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2434
+	.byte	0xb
+	.byte	0x29
+	.byte	0x3
+	.long	0x6aa
+	.uleb128 0x7
+	.long	.LASF2435
+	.byte	0xb
+	.byte	0x2e
+	.byte	0x1d
+	.long	0x751
+	.uleb128 0x14
+	.long	0x739
+	.uleb128 0x6
+	.long	.LASF2436
+	.byte	0xc
+	.byte	0x19
+	.byte	0x11
+	.long	0xb3
+	.uleb128 0x12
+	.long	0x756
+	.uleb128 0x6
+	.long	.LASF2437
+	.byte	0xc
+	.byte	0x21
+	.byte	0x12
+	.long	0xe6
+	.uleb128 0x7
+	.long	.LASF2438
+	.byte	0xd
+	.byte	0x1b
+	.byte	0xc
+	.long	0x478
+	.uleb128 0x7
+	.long	.LASF2439
+	.byte	0xd
+	.byte	0x1c
+	.byte	0x10
+	.long	0xa2
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xe
+	.byte	0x18
+	.long	0x857
+	.uleb128 0x1
+	.long	.LASF2440
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2441
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2442
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2443
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2444
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2446
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2447
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2448
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2449
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2450
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2451
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2452
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2453
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2454
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2455
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2456
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2457
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2458
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2459
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2460
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2461
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2462
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2463
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2464
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2465
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2466
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2467
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2468
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2469
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2470
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2471
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2472
+	.byte	0xe
+	.byte	0x3c
+	.byte	0x11
+	.long	0xe6
+	.uleb128 0x23
+	.long	.LASF2667
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0xe
+	.byte	0x41
+	.byte	0xe
+	.long	0x8be
+	.uleb128 0x1
+	.long	.LASF2473
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0x1
+	.uleb128 0x24
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2478
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2479
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2480
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2481
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2482
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2483
+	.byte	0xb
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xe
+	.byte	0x5c
+	.long	0x8e8
+	.uleb128 0x1
+	.long	.LASF2484
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2485
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2486
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2487
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2488
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2489
+	.byte	0xe
+	.byte	0x9b
+	.byte	0x10
+	.long	0x105
+	.uleb128 0x16
+	.long	.LASF2490
+	.byte	0x5
+	.byte	0xe
+	.byte	0x9d
+	.long	0x942
+	.uleb128 0x2
+	.long	.LASF2491
+	.byte	0xe
+	.byte	0x9e
+	.byte	0xd
+	.long	0xc4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2492
+	.byte	0xe
+	.byte	0x9f
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2493
+	.byte	0xe
+	.byte	0xa0
+	.byte	0xd
+	.long	0xc4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2494
+	.byte	0xe
+	.byte	0xa1
+	.byte	0xd
+	.long	0xc4
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2495
+	.byte	0xe
+	.byte	0xa2
+	.byte	0x9
+	.long	0x478
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2496
+	.byte	0xe
+	.byte	0xa3
+	.byte	0x3
+	.long	0x8f4
+	.uleb128 0x12
+	.long	0x942
+	.uleb128 0x7
+	.long	.LASF2497
+	.byte	0xe
+	.byte	0xa5
+	.byte	0x1b
+	.long	0x942
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xf
+	.byte	0x22
+	.long	0x9b0
+	.uleb128 0x1
+	.long	.LASF2498
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2499
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0x80
+	.uleb128 0x10
+	.long	.LASF2506
+	.value	0x100
+	.uleb128 0x10
+	.long	.LASF2507
+	.value	0x200
+	.uleb128 0x10
+	.long	.LASF2508
+	.value	0x400
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2509
+	.byte	0xf
+	.byte	0x30
+	.byte	0x11
+	.long	0xd5
+	.uleb128 0x9
+	.long	0xa2
+	.long	0x9cc
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2510
+	.byte	0x10
+	.byte	0x50
+	.byte	0x10
+	.long	0x9bc
+	.uleb128 0x16
+	.long	.LASF2511
+	.byte	0x2c
+	.byte	0x10
+	.byte	0x76
+	.long	0xb2a
+	.uleb128 0x2
+	.long	.LASF2512
+	.byte	0x10
+	.byte	0x77
+	.byte	0xd
+	.long	0xb2a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2513
+	.byte	0x10
+	.byte	0x78
+	.byte	0xd
+	.long	0xc4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2514
+	.byte	0x10
+	.byte	0x79
+	.byte	0xd
+	.long	0xc4
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2515
+	.byte	0x10
+	.byte	0x7a
+	.byte	0xd
+	.long	0xc4
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2516
+	.byte	0x10
+	.byte	0x7b
+	.byte	0xd
+	.long	0xc4
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2517
+	.byte	0x10
+	.byte	0x7c
+	.byte	0xe
+	.long	0xe6
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2518
+	.byte	0x10
+	.byte	0x7d
+	.byte	0xd
+	.long	0xc4
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2519
+	.byte	0x10
+	.byte	0x7e
+	.byte	0xd
+	.long	0xc4
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2520
+	.byte	0x10
+	.byte	0x7f
+	.byte	0xd
+	.long	0xc4
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2521
+	.byte	0x10
+	.byte	0x80
+	.byte	0xd
+	.long	0xc4
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2522
+	.byte	0x10
+	.byte	0x81
+	.byte	0xd
+	.long	0xc4
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2523
+	.byte	0x10
+	.byte	0x82
+	.byte	0xd
+	.long	0xc4
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2524
+	.byte	0x10
+	.byte	0x83
+	.byte	0xe
+	.long	0xd5
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2525
+	.byte	0x10
+	.byte	0x84
+	.byte	0xe
+	.long	0xd5
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2526
+	.byte	0x10
+	.byte	0x85
+	.byte	0xe
+	.long	0xd5
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2527
+	.byte	0x10
+	.byte	0x86
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2528
+	.byte	0x10
+	.byte	0x87
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF2529
+	.byte	0x10
+	.byte	0x88
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2530
+	.byte	0x10
+	.byte	0x89
+	.byte	0xd
+	.long	0xc4
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2531
+	.byte	0x10
+	.byte	0x8a
+	.byte	0xd
+	.long	0xc4
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2532
+	.byte	0x10
+	.byte	0x8b
+	.byte	0xd
+	.long	0xc4
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2533
+	.byte	0x10
+	.byte	0x8c
+	.byte	0xd
+	.long	0xc4
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2534
+	.byte	0x10
+	.byte	0x8d
+	.byte	0xe
+	.long	0xd5
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2535
+	.byte	0x10
+	.byte	0x8f
+	.byte	0xe
+	.long	0xd5
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2536
+	.byte	0x10
+	.byte	0x90
+	.byte	0xe
+	.long	0xd5
+	.byte	0x28
+	.byte	0
+	.uleb128 0x9
+	.long	0xc4
+	.long	0xb3a
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2537
+	.byte	0x10
+	.byte	0x91
+	.byte	0x3
+	.long	0x9d8
+	.uleb128 0x12
+	.long	0xb3a
+	.uleb128 0x7
+	.long	.LASF2538
+	.byte	0x10
+	.byte	0x93
+	.byte	0x13
+	.long	0xb3a
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x11
+	.byte	0x3c
+	.long	0xbcf
+	.uleb128 0x1
+	.long	.LASF2539
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2540
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2541
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2542
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2543
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2545
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2546
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2547
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2548
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2549
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2550
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2551
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2552
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2553
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2554
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2555
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2556
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2557
+	.byte	0x11
+	.byte	0x8b
+	.byte	0x3
+	.long	0xb57
+	.uleb128 0x25
+	.byte	0x6
+	.byte	0x12
+	.byte	0x22
+	.byte	0x5
+	.long	0xc0c
+	.uleb128 0x2
+	.long	.LASF2558
+	.byte	0x12
+	.byte	0x24
+	.byte	0x11
+	.long	0xa2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2559
+	.byte	0x12
+	.byte	0x25
+	.byte	0x11
+	.long	0xa2
+	.byte	0x2
+	.uleb128 0x8
+	.string	"yaw"
+	.byte	0x12
+	.byte	0x26
+	.byte	0x11
+	.long	0xa2
+	.byte	0x4
+	.byte	0
+	.uleb128 0x26
+	.byte	0x6
+	.byte	0x12
+	.byte	0x20
+	.byte	0x9
+	.long	0xc2e
+	.uleb128 0x27
+	.string	"raw"
+	.byte	0x12
+	.byte	0x21
+	.byte	0xd
+	.long	0xc2e
+	.uleb128 0x28
+	.long	.LASF2560
+	.byte	0x12
+	.byte	0x27
+	.byte	0x7
+	.long	0xbdb
+	.byte	0
+	.uleb128 0x9
+	.long	0xa2
+	.long	0xc3e
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2561
+	.byte	0x12
+	.byte	0x28
+	.byte	0x3
+	.long	0xc0c
+	.uleb128 0x7
+	.long	.LASF2562
+	.byte	0x12
+	.byte	0x2a
+	.byte	0x1e
+	.long	0xc3e
+	.uleb128 0x4
+	.long	.LASF2563
+	.byte	0x33
+	.byte	0xe
+	.long	0x1cf
+	.uleb128 0x4
+	.long	.LASF2564
+	.byte	0x33
+	.byte	0x1f
+	.long	0x1cf
+	.uleb128 0x4
+	.long	.LASF2565
+	.byte	0x33
+	.byte	0x30
+	.long	0x1cf
+	.uleb128 0x4
+	.long	.LASF2566
+	.byte	0x34
+	.byte	0xe
+	.long	0xf2
+	.uleb128 0x9
+	.long	0xa2
+	.long	0xc92
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x65
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2567
+	.byte	0x49
+	.byte	0x10
+	.long	0xc82
+	.uleb128 0x9
+	.long	0xf2
+	.long	0xcb4
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x2
+	.uleb128 0x29
+	.long	0x37
+	.value	0x100
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2568
+	.byte	0x69
+	.byte	0xe
+	.long	0xc9d
+	.uleb128 0x3
+	.long	.LASF2569
+	.value	0x103
+	.byte	0x11
+	.long	0xd5
+	.uleb128 0x3
+	.long	.LASF2570
+	.value	0x133
+	.byte	0xc
+	.long	0x478
+	.uleb128 0x13
+	.long	.LASF2571
+	.byte	0x5
+	.byte	0x57
+	.byte	0x7
+	.long	0xf2
+	.long	0xced
+	.uleb128 0x5
+	.long	0xa2
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2572
+	.byte	0x5
+	.byte	0x7b
+	.byte	0x9
+	.long	0xa2
+	.long	0xd08
+	.uleb128 0x5
+	.long	0x1c3
+	.uleb128 0x5
+	.long	0xa2
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2573
+	.byte	0x5
+	.byte	0x7c
+	.byte	0x9
+	.long	0x1c3
+	.long	0xd23
+	.uleb128 0x5
+	.long	0xa2
+	.uleb128 0x5
+	.long	0xa2
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2584
+	.byte	0x16
+	.byte	0x55
+	.byte	0x5
+	.long	0x478
+	.uleb128 0x13
+	.long	.LASF2574
+	.byte	0x5
+	.byte	0x6b
+	.byte	0x7
+	.long	0xf2
+	.long	0xd45
+	.uleb128 0x5
+	.long	0xf2
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2575
+	.byte	0x5
+	.byte	0x6c
+	.byte	0x7
+	.long	0xf2
+	.long	0xd5b
+	.uleb128 0x5
+	.long	0xf2
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2576
+	.byte	0x14
+	.value	0x13d
+	.byte	0x11
+	.long	0x94
+	.long	0xd72
+	.uleb128 0x5
+	.long	0xf2
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2577
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x7
+	.long	0xf2
+	.long	0xd8d
+	.uleb128 0x5
+	.long	0xd8d
+	.uleb128 0x5
+	.long	0xf2
+	.byte	0
+	.uleb128 0x14
+	.long	0x23a
+	.uleb128 0x13
+	.long	.LASF2578
+	.byte	0x7
+	.byte	0x5b
+	.byte	0x7
+	.long	0xf2
+	.long	0xdad
+	.uleb128 0x5
+	.long	0xdad
+	.uleb128 0x5
+	.long	0xf2
+	.byte	0
+	.uleb128 0x14
+	.long	0x2a7
+	.uleb128 0x19
+	.long	.LASF2579
+	.byte	0x7
+	.byte	0x59
+	.long	0xdcd
+	.uleb128 0x5
+	.long	0xdad
+	.uleb128 0x5
+	.long	0xf2
+	.uleb128 0x5
+	.long	0xe6
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2580
+	.byte	0x7
+	.byte	0x57
+	.long	0xde8
+	.uleb128 0x5
+	.long	0xdad
+	.uleb128 0x5
+	.long	0xf2
+	.uleb128 0x5
+	.long	0xe6
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2581
+	.byte	0x7
+	.byte	0x5e
+	.long	0xe03
+	.uleb128 0x5
+	.long	0xd8d
+	.uleb128 0x5
+	.long	0xc4
+	.uleb128 0x5
+	.long	0xf2
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2582
+	.byte	0x8
+	.byte	0x73
+	.long	0xe14
+	.uleb128 0x5
+	.long	0xf2
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2583
+	.byte	0x15
+	.byte	0x1e
+	.byte	0x5
+	.long	0x478
+	.long	0xe2a
+	.uleb128 0x5
+	.long	0xe6
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2585
+	.byte	0x10
+	.byte	0xb5
+	.byte	0xa
+	.long	0xd5
+	.uleb128 0x13
+	.long	.LASF2586
+	.byte	0x11
+	.byte	0xb5
+	.byte	0xd
+	.long	0x756
+	.long	0xe4c
+	.uleb128 0x5
+	.long	0xbcf
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2587
+	.byte	0x10
+	.byte	0xb6
+	.byte	0xa
+	.long	0x767
+	.uleb128 0x2b
+	.long	.LASF2640
+	.byte	0x13
+	.value	0x214
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF2595
+	.value	0x1d2
+	.long	0xee9
+	.uleb128 0x3
+	.long	.LASF2588
+	.value	0x1d5
+	.byte	0xd
+	.long	0xb3
+	.uleb128 0x1e
+	.string	"tmp"
+	.value	0x1fa
+	.byte	0xd
+	.long	0xb3
+	.uleb128 0x11
+	.long	0xea4
+	.uleb128 0x3
+	.long	.LASF2589
+	.value	0x1e2
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xc
+	.uleb128 0x1e
+	.string	"tmp"
+	.value	0x1e5
+	.byte	0x11
+	.long	0xb3
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xeb6
+	.uleb128 0x3
+	.long	.LASF2590
+	.value	0x206
+	.byte	0x11
+	.long	0x1c3
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x3
+	.long	.LASF2591
+	.value	0x20b
+	.byte	0x15
+	.long	0xf9
+	.uleb128 0x3
+	.long	.LASF2592
+	.value	0x20c
+	.byte	0x15
+	.long	0xf9
+	.uleb128 0x3
+	.long	.LASF2593
+	.value	0x20d
+	.byte	0x15
+	.long	0xf9
+	.uleb128 0x3
+	.long	.LASF2594
+	.value	0x20e
+	.byte	0x17
+	.long	0xae
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2596
+	.value	0x17c
+	.long	0xfa5
+	.uleb128 0x3
+	.long	.LASF2597
+	.value	0x17e
+	.byte	0x14
+	.long	0x105
+	.uleb128 0x3
+	.long	.LASF2598
+	.value	0x17f
+	.byte	0x14
+	.long	0x105
+	.uleb128 0x3
+	.long	.LASF2599
+	.value	0x180
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x3
+	.long	.LASF2600
+	.value	0x180
+	.byte	0x1c
+	.long	0xa2
+	.uleb128 0x3
+	.long	.LASF2601
+	.value	0x181
+	.byte	0x15
+	.long	0xd5
+	.uleb128 0x3
+	.long	.LASF2602
+	.value	0x182
+	.byte	0x13
+	.long	0xd0
+	.uleb128 0x3
+	.long	.LASF2603
+	.value	0x183
+	.byte	0xe
+	.long	0xd5
+	.uleb128 0x3
+	.long	.LASF2604
+	.value	0x184
+	.byte	0x9
+	.long	0x478
+	.uleb128 0x3
+	.long	.LASF2605
+	.value	0x185
+	.byte	0xd
+	.long	0xc4
+	.uleb128 0x11
+	.long	0xf72
+	.uleb128 0x3
+	.long	.LASF2589
+	.value	0x1a7
+	.byte	0x19
+	.long	0x7c
+	.byte	0
+	.uleb128 0x11
+	.long	0xf84
+	.uleb128 0x3
+	.long	.LASF2606
+	.value	0x1ab
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.uleb128 0x11
+	.long	0xf96
+	.uleb128 0x3
+	.long	.LASF2606
+	.value	0x1b7
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x3
+	.long	.LASF2589
+	.value	0x1c7
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2618
+	.value	0x13a
+	.long	0x1083
+	.uleb128 0x3
+	.long	.LASF2607
+	.value	0x13c
+	.byte	0x18
+	.long	0x1083
+	.uleb128 0x3
+	.long	.LASF2608
+	.value	0x13d
+	.byte	0x1b
+	.long	0x1093
+	.uleb128 0x3
+	.long	.LASF2609
+	.value	0x13e
+	.byte	0x12
+	.long	0x10a3
+	.uleb128 0x3
+	.long	.LASF2610
+	.value	0x13f
+	.byte	0x15
+	.long	0xd5
+	.uleb128 0x3
+	.long	.LASF2611
+	.value	0x140
+	.byte	0x15
+	.long	0xe6
+	.uleb128 0x3
+	.long	.LASF2612
+	.value	0x141
+	.byte	0x14
+	.long	0xc4
+	.uleb128 0x3
+	.long	.LASF2613
+	.value	0x142
+	.byte	0x13
+	.long	0xd0
+	.uleb128 0x3
+	.long	.LASF2614
+	.value	0x155
+	.byte	0x14
+	.long	0xe1
+	.uleb128 0x11
+	.long	0x1022
+	.uleb128 0x3
+	.long	.LASF2589
+	.value	0x145
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.uleb128 0x11
+	.long	0x1034
+	.uleb128 0x3
+	.long	.LASF2589
+	.value	0x14c
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.uleb128 0x11
+	.long	0x1054
+	.uleb128 0x3
+	.long	.LASF2606
+	.value	0x158
+	.byte	0x12
+	.long	0x7c
+	.uleb128 0xc
+	.uleb128 0x3
+	.long	.LASF2615
+	.value	0x15b
+	.byte	0x1d
+	.long	0xdad
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x1066
+	.uleb128 0x3
+	.long	.LASF2606
+	.value	0x163
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x3
+	.long	.LASF2606
+	.value	0x16b
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xc
+	.uleb128 0x3
+	.long	.LASF2616
+	.value	0x16c
+	.byte	0x15
+	.long	0xf9
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x23a
+	.long	0x1093
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	0x2a7
+	.long	0x10a3
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	0xf2
+	.long	0x10b3
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF2531
+	.byte	0x13
+	.value	0x128
+	.byte	0x11
+	.long	0xd5
+	.long	0x10df
+	.uleb128 0x3
+	.long	.LASF2614
+	.value	0x12a
+	.byte	0xe
+	.long	0xd5
+	.uleb128 0xc
+	.uleb128 0x3
+	.long	.LASF2617
+	.value	0x12c
+	.byte	0x18
+	.long	0xe1
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2619
+	.value	0x10e
+	.long	0x111c
+	.uleb128 0x2d
+	.long	.LASF2623
+	.byte	0x13
+	.value	0x10e
+	.byte	0x2c
+	.long	0x767
+	.uleb128 0x3
+	.long	.LASF2620
+	.value	0x110
+	.byte	0x15
+	.long	0x767
+	.uleb128 0x3
+	.long	.LASF2621
+	.value	0x111
+	.byte	0x14
+	.long	0xc4
+	.uleb128 0x3
+	.long	.LASF2617
+	.value	0x113
+	.byte	0x17
+	.long	0x762
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2655
+	.byte	0x13
+	.value	0x105
+	.byte	0xa
+	.long	0xd5
+	.uleb128 0x17
+	.long	.LASF2622
+	.byte	0xe7
+	.byte	0xe
+	.long	0x1183
+	.uleb128 0xf
+	.long	.LASF2603
+	.byte	0x13
+	.byte	0xe7
+	.byte	0x37
+	.long	0xd5
+	.uleb128 0x4
+	.long	.LASF2624
+	.byte	0xe8
+	.byte	0x10
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF2625
+	.byte	0xe9
+	.byte	0x14
+	.long	0x1183
+	.uleb128 0x4
+	.long	.LASF2626
+	.byte	0xea
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF2627
+	.byte	0xeb
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF2628
+	.byte	0xec
+	.byte	0x13
+	.long	0xae
+	.uleb128 0x4
+	.long	.LASF2629
+	.byte	0xf2
+	.byte	0x13
+	.long	0xae
+	.byte	0
+	.uleb128 0x9
+	.long	0xa2
+	.long	0x1193
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2630
+	.byte	0xd2
+	.byte	0xd
+	.long	0x11d6
+	.uleb128 0x4
+	.long	.LASF2631
+	.byte	0xd4
+	.byte	0x14
+	.long	0xc4
+	.uleb128 0x4
+	.long	.LASF2632
+	.byte	0xd5
+	.byte	0x12
+	.long	0xf2
+	.uleb128 0x4
+	.long	.LASF2633
+	.byte	0xd6
+	.byte	0x12
+	.long	0xf2
+	.uleb128 0x4
+	.long	.LASF2558
+	.byte	0xde
+	.byte	0xb
+	.long	0xf2
+	.uleb128 0x18
+	.string	"yaw"
+	.byte	0xdf
+	.byte	0xb
+	.long	0xf2
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2634
+	.byte	0xbe
+	.byte	0xd
+	.long	0x1230
+	.uleb128 0xf
+	.long	.LASF2589
+	.byte	0x13
+	.byte	0xbe
+	.byte	0x27
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF2635
+	.byte	0xc0
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x4
+	.long	.LASF2636
+	.byte	0xc2
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x4
+	.long	.LASF2637
+	.byte	0xc5
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x4
+	.long	.LASF2624
+	.byte	0xc6
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF2638
+	.byte	0xc7
+	.byte	0x12
+	.long	0x2d1
+	.uleb128 0x4
+	.long	.LASF2639
+	.byte	0xc8
+	.byte	0xb
+	.long	0xf2
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2641
+	.byte	0x13
+	.byte	0xb8
+	.byte	0x6
+	.uleb128 0x17
+	.long	.LASF2642
+	.byte	0xa0
+	.byte	0xd
+	.long	0x1274
+	.uleb128 0xc
+	.uleb128 0x4
+	.long	.LASF2589
+	.byte	0xa2
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xc
+	.uleb128 0x18
+	.string	"i"
+	.byte	0xa3
+	.byte	0x12
+	.long	0x7c
+	.uleb128 0xc
+	.uleb128 0x4
+	.long	.LASF2635
+	.byte	0xa4
+	.byte	0x19
+	.long	0xf9
+	.uleb128 0x4
+	.long	.LASF2639
+	.byte	0xa5
+	.byte	0x13
+	.long	0xf2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2643
+	.byte	0x13
+	.byte	0x8d
+	.byte	0xe
+	.long	0xf2
+	.long	0x12df
+	.uleb128 0xf
+	.long	.LASF2589
+	.byte	0x13
+	.byte	0x8d
+	.byte	0x26
+	.long	0x7c
+	.uleb128 0xf
+	.long	.LASF2635
+	.byte	0x13
+	.byte	0x8d
+	.byte	0x32
+	.long	0xf2
+	.uleb128 0x4
+	.long	.LASF2644
+	.byte	0x8f
+	.byte	0xd
+	.long	0xc4
+	.uleb128 0x4
+	.long	.LASF2645
+	.byte	0x90
+	.byte	0xd
+	.long	0xc4
+	.uleb128 0x4
+	.long	.LASF2646
+	.byte	0x99
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x4
+	.long	.LASF2647
+	.byte	0x9a
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x4
+	.long	.LASF2648
+	.byte	0x9b
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x4
+	.long	.LASF2649
+	.byte	0x9c
+	.byte	0x11
+	.long	0xf9
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2650
+	.byte	0x13
+	.byte	0x6c
+	.byte	0xe
+	.long	0xf2
+	.long	0x1352
+	.uleb128 0xf
+	.long	.LASF2589
+	.byte	0x13
+	.byte	0x6c
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0xf
+	.long	.LASF2636
+	.byte	0x13
+	.byte	0x6c
+	.byte	0x36
+	.long	0xf2
+	.uleb128 0x4
+	.long	.LASF2644
+	.byte	0x6e
+	.byte	0xd
+	.long	0xc4
+	.uleb128 0x4
+	.long	.LASF2645
+	.byte	0x6f
+	.byte	0xb
+	.long	0xf2
+	.uleb128 0x4
+	.long	.LASF2635
+	.byte	0x7b
+	.byte	0xb
+	.long	0xf2
+	.uleb128 0x4
+	.long	.LASF2639
+	.byte	0x81
+	.byte	0xb
+	.long	0xf2
+	.uleb128 0x11
+	.long	0x1344
+	.uleb128 0x4
+	.long	.LASF2646
+	.byte	0x7d
+	.byte	0x15
+	.long	0xf9
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x4
+	.long	.LASF2651
+	.byte	0x83
+	.byte	0x15
+	.long	0xf9
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2652
+	.byte	0x59
+	.byte	0x9
+	.long	0xa2
+	.long	0x1379
+	.uleb128 0x15
+	.string	"tmp"
+	.byte	0x13
+	.byte	0x59
+	.byte	0x22
+	.long	0xb3
+	.uleb128 0x4
+	.long	.LASF2653
+	.byte	0x5b
+	.byte	0x13
+	.long	0xbf
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2654
+	.byte	0x4b
+	.byte	0xd
+	.long	0x13a6
+	.uleb128 0xc
+	.uleb128 0x18
+	.string	"i"
+	.byte	0x4d
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xc
+	.uleb128 0x18
+	.string	"tmp"
+	.byte	0x4e
+	.byte	0x17
+	.long	0xae
+	.uleb128 0x18
+	.string	"y"
+	.byte	0x4f
+	.byte	0x11
+	.long	0xc4
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF2656
+	.byte	0x13
+	.byte	0x42
+	.byte	0x7
+	.long	0xf2
+	.uleb128 0x1b
+	.long	.LASF2657
+	.byte	0x3e
+	.byte	0x7
+	.long	0xf2
+	.long	0x13ce
+	.uleb128 0xf
+	.long	.LASF2589
+	.byte	0x13
+	.byte	0x3e
+	.byte	0x1e
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2658
+	.byte	0x3a
+	.byte	0x7
+	.long	0xf2
+	.long	0x13ea
+	.uleb128 0xf
+	.long	.LASF2589
+	.byte	0x13
+	.byte	0x3a
+	.byte	0x1b
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2659
+	.byte	0x36
+	.byte	0x7
+	.long	0xf2
+	.long	0x1406
+	.uleb128 0xf
+	.long	.LASF2589
+	.byte	0x13
+	.byte	0x36
+	.byte	0x1b
+	.long	0x7c
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2660
+	.byte	0x10
+	.byte	0x93
+	.byte	0x44
+	.long	0x1412
+	.uleb128 0x14
+	.long	0xb46
+	.uleb128 0x20
+	.long	.LASF2661
+	.byte	0xe
+	.byte	0xa5
+	.byte	0x5c
+	.long	0x1423
+	.uleb128 0x14
+	.long	0x94e
+	.uleb128 0x1a
+	.long	.LASF2662
+	.byte	0xc
+	.byte	0x25
+	.byte	0x1b
+	.long	0x756
+	.long	0x144d
+	.uleb128 0x15
+	.string	"a"
+	.byte	0xc
+	.byte	0x25
+	.byte	0x2e
+	.long	0x767
+	.uleb128 0x15
+	.string	"b"
+	.byte	0xc
+	.byte	0x25
+	.byte	0x3a
+	.long	0x767
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2663
+	.byte	0x5
+	.byte	0x88
+	.byte	0x15
+	.long	0xf2
+	.long	0x1482
+	.uleb128 0x15
+	.string	"amt"
+	.byte	0x5
+	.byte	0x88
+	.byte	0x26
+	.long	0xf2
+	.uleb128 0x15
+	.string	"low"
+	.byte	0x5
+	.byte	0x88
+	.byte	0x31
+	.long	0xf2
+	.uleb128 0xf
+	.long	.LASF2664
+	.byte	0x5
+	.byte	0x88
+	.byte	0x3c
+	.long	0xf2
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF2665
+	.byte	0x5
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x15
+	.string	"amt"
+	.byte	0x5
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x15
+	.string	"low"
+	.byte	0x5
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0xf
+	.long	.LASF2664
+	.byte	0x5
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 23 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.file 26 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 28 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 29 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 39 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1151
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1191
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 50 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x32
+	.file 51 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 52 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x34
+	.file 53 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 54 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x36
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1599
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 55 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x37
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1644
+	.byte	0x4
+	.file 56 "./src/main/config/config_profile.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x38
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.file 57 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x39
+	.file 58 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x15
+	.byte	0x4
+	.file 59 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xa
+	.file 60 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3c
+	.file 61 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x4
+	.file 62 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3e
+	.byte	0x4
+	.file 63 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 64 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x40
+	.byte	0x4
+	.file 65 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x41
+	.file 66 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.file 67 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.file 68 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2160
+	.byte	0x4
+	.file 69 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 70 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2164
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2165
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2166
+	.byte	0x4
+	.byte	0x4
+	.file 71 "./src/main/fc/fc_rc.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2255
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1150
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1172
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1190
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1193
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1198
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1222
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1240
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1241
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1242
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1243
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1253
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1263
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1265
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1267
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1269
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1271
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1272
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1273
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1275
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1276
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1278
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1256
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1421
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1498
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1515
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1519
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1522
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1427
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1547
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1548
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1549
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1550
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1551
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1552
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1553
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1554
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1567
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1575
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1598
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1604
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1643
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1650
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1673
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1683
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1769
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1771
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1779
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2159
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2163
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2192
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2201
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2229
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.50.10d0067a73777b2d14d79db5df156f88,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2233
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2241
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF2668
+	.long	.LASF2669
+	.long	.LASF2670
+	.long	.LASF2671
+	.long	.LASF2672
+	.long	.LASF2673
+	.long	.LASF2674
+	.long	.LASF2675
+	.long	.LASF2676
+	.long	.LASF2677
+	.long	.LASF2678
+	.long	.LASF2679
+	.long	.LASF2680
+	.long	.LASF2681
+	.long	.LASF2682
+	.long	.LASF2683
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x48
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2684
+	.byte	0xc
+	.long	.LASF2685
+	.byte	0xc
+	.long	.LASF2686
+	.byte	0xc
+	.long	.LASF2687
+	.byte	0x1
+	.long	.LASF2688
+	.byte	0x2
+	.long	.LASF2689
+	.byte	0x2
+	.long	.LASF2690
+	.byte	0x2
+	.long	.LASF2691
+	.byte	0x6
+	.long	.LASF2692
+	.byte	0x4
+	.long	.LASF2693
+	.byte	0x5
+	.long	.LASF2694
+	.byte	0x5
+	.long	.LASF2695
+	.byte	0x2
+	.long	.LASF2696
+	.byte	0x5
+	.long	.LASF2697
+	.byte	0x5
+	.long	.LASF2698
+	.byte	0x5
+	.long	.LASF2699
+	.byte	0x7
+	.long	.LASF2700
+	.byte	0x8
+	.long	.LASF2701
+	.byte	0x6
+	.long	.LASF2702
+	.byte	0x5
+	.long	.LASF2703
+	.byte	0xc
+	.long	.LASF2704
+	.byte	0x3
+	.long	.LASF2705
+	.byte	0x6
+	.long	.LASF2706
+	.byte	0xf
+	.long	.LASF2707
+	.byte	0x10
+	.long	.LASF2708
+	.byte	0x10
+	.long	.LASF2708
+	.byte	0xf
+	.long	.LASF2709
+	.byte	0xc
+	.long	.LASF2710
+	.byte	0xf
+	.long	.LASF2711
+	.byte	0xf
+	.long	.LASF2712
+	.byte	0xc
+	.long	.LASF2713
+	.byte	0xc
+	.long	.LASF2714
+	.byte	0xe
+	.long	.LASF2715
+	.byte	0xc
+	.long	.LASF2716
+	.byte	0xd
+	.long	.LASF2717
+	.byte	0xd
+	.long	.LASF2718
+	.byte	0xc
+	.long	.LASF2719
+	.byte	0xc
+	.long	.LASF2720
+	.byte	0xc
+	.long	.LASF2721
+	.byte	0xf
+	.long	.LASF2722
+	.byte	0xc
+	.long	.LASF2723
+	.byte	0xc
+	.long	.LASF2724
+	.byte	0xc
+	.long	.LASF2725
+	.byte	0xc
+	.long	.LASF2726
+	.byte	0xc
+	.long	.LASF2727
+	.byte	0xc
+	.long	.LASF2728
+	.byte	0xc
+	.long	.LASF2729
+	.byte	0xc
+	.long	.LASF2730
+	.byte	0xc
+	.long	.LASF2731
+	.byte	0xc
+	.long	.LASF2732
+	.byte	0xb
+	.long	.LASF2733
+	.byte	0xa
+	.long	.LASF2734
+	.byte	0x9
+	.long	.LASF2735
+	.byte	0x10
+	.long	.LASF2736
+	.byte	0xa
+	.long	.LASF2737
+	.byte	0x2
+	.long	.LASF2738
+	.byte	0x3
+	.long	.LASF2739
+	.byte	0x3
+	.long	.LASF2740
+	.byte	0x1
+	.long	.LASF2741
+	.byte	0x3
+	.long	.LASF2742
+	.byte	0x4
+	.long	.LASF2743
+	.byte	0x4
+	.long	.LASF2744
+	.byte	0x4
+	.long	.LASF2745
+	.byte	0x4
+	.long	.LASF2746
+	.byte	0x4
+	.long	.LASF2747
+	.byte	0x4
+	.long	.LASF2748
+	.byte	0x4
+	.long	.LASF2749
+	.byte	0x4
+	.long	.LASF2750
+	.byte	0x4
+	.long	.LASF2751
+	.byte	0x4
+	.long	.LASF2752
+	.byte	0x4
+	.long	.LASF2753
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1915:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2151:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1989:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1125:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2173:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF2185:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1176:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF796:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2231:
+	.string	"SCHEDULER_TRACE_SIZE 64"
+.LASF1001:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1029:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1362:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF1052:
+	.string	"__DECL_SIMD_exp"
+.LASF1454:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1304:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1071:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF2528:
+	.string	"rcInterpolationChannels"
+.LASF2314:
+	.string	"PIDPITCH"
+.LASF1509:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1461:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1595:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF905:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF2412:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1328:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2005:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1455:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF833:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1548:
+	.string	"USE_PPM"
+.LASF1925:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2393:
+	.string	"FEATURE_RX_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF2155:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1434:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1949:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1796:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF2054:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF969:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF949:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF806:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1114:
+	.string	"__DECL_SIMD_log1pf"
+.LASF2166:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1651:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF909:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1793:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1372:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF1322:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1010:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2261:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2653:
+	.string	"tmp2"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1094:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1739:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1069:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1379:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF2345:
+	.string	"_Bool"
+.LASF2519:
+	.string	"spektrum_sat_bind"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF2612:
+	.string	"filterType"
+.LASF764:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1845:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2598:
+	.string	"deltaRC"
+.LASF1528:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1237:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1204:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF973:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1456:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2354:
+	.string	"OWNER_ADC_CURR"
+.LASF901:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1668:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1129:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2253:
+	.string	"RC_SMOOTHING_CUTOFF_MIN_HZ 5"
+.LASF1805:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2007:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2115:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2313:
+	.string	"PIDROLL"
+.LASF2644:
+	.string	"rcExpo"
+.LASF2188:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF2584:
+	.string	"failsafeIsActive"
+.LASF1636:
+	.string	"BIT(x) (1 << (x))"
+.LASF1309:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1657:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1378:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF988:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2300:
+	.string	"DEBUG_COUNT"
+.LASF1794:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF870:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2227:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2078:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1933:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2538:
+	.string	"rxConfig_System"
+.LASF2071:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2646:
+	.string	"expof"
+.LASF2087:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2196:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF902:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF810:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1501:
+	.string	"__WCHAR_T__ "
+.LASF1876:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2523:
+	.string	"rssi_invert"
+.LASF1589:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2147:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1218:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1207:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1729:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF2604:
+	.string	"readyToCalculateRate"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF781:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1341:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF2320:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2119:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF907:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2094:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1178:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1685:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2351:
+	.string	"OWNER_LED"
+.LASF769:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1524:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1818:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2096:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2306:
+	.string	"pt1Filter_t"
+.LASF923:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1276:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF2402:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1964:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF2272:
+	.string	"uint16_t"
+.LASF807:
+	.string	"__DECL_SIMD_expl "
+.LASF981:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF2157:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF2515:
+	.string	"halfDuplex"
+.LASF1087:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1757:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1205:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1130:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2086:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1977:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF2245:
+	.string	"RC_RATE_INCREMENTAL 14.54f"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2658:
+	.string	"getRcDeflection"
+.LASF2065:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1445:
+	.string	"TELEMETRY_HOTT "
+.LASF788:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF927:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1096:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2089:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1663:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1295:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF763:
+	.string	"_MATH_H 1"
+.LASF2018:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1592:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1854:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1278:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1780:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1471:
+	.string	"_T_PTRDIFF_ "
+.LASF2092:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1859:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1725:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF777:
+	.string	"__DECL_SIMD_sinl "
+.LASF1967:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1351:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF1717:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF779:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1645:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1030:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF2160:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2492:
+	.string	"yaw_deadband"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2198:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2124:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF835:
+	.string	"__DECL_SIMD_atan "
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1702:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2420:
+	.string	"currentPidProfile"
+.LASF1920:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1786:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1025:
+	.string	"__DECL_SIMD_tan "
+.LASF1639:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF377:
+	.string	"__linux 1"
+.LASF2629:
+	.string	"rcCommandSpeed"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1382:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2434:
+	.string	"controlRateConfig_t"
+.LASF798:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1990:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2591:
+	.string	"radDiff"
+.LASF1806:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1914:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1978:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1828:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF1709:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1353:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF2110:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2224:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2461:
+	.string	"BOXSONAR"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2322:
+	.string	"PIDVEL"
+.LASF1168:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1911:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1411:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1384:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF854:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2118:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1258:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF1892:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF797:
+	.string	"__DECL_SIMD_logl "
+.LASF1365:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF2358:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1303:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2570:
+	.string	"rcSmoothingFilterInitialised"
+.LASF1142:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1128:
+	.string	"__DECL_SIMD_tanh"
+.LASF2632:
+	.string	"cosFactor"
+.LASF2085:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1034:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1814:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2165:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1779:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1101:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF929:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1393:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF2383:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1768:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1677:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1656:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF805:
+	.string	"__DECL_SIMD_exp "
+.LASF1822:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1578:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1015:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1140:
+	.string	"__DECL_SIMD_tan"
+.LASF880:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF897:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1219:
+	.string	"_Mdouble_"
+.LASF2270:
+	.string	"int32_t"
+.LASF1363:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1146:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2190:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1375:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1357:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF2097:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1608:
+	.string	"FAST_MATH "
+.LASF1534:
+	.string	"BARO "
+.LASF1293:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1055:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1385:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1116:
+	.string	"__DECL_SIMD_atanh"
+.LASF989:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2128:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1842:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2132:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1511:
+	.string	"___int_wchar_t_h "
+.LASF2122:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2068:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1630:
+	.string	"STR_HELPER(x) #x"
+.LASF2414:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF2603:
+	.string	"rxRefreshRate"
+.LASF1889:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1744:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1154:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1067:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF2195:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1573:
+	.string	"VTX_TRAMP"
+.LASF2088:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1199:
+	.string	"FP_INT_UPWARD 0"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2380:
+	.string	"OWNER_BARO_EXTI"
+.LASF1060:
+	.string	"__DECL_SIMD_acos"
+.LASF1530:
+	.string	"GYRO "
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF546:
+	.string	"__always_inline"
+.LASF871:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1730:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF990:
+	.string	"__DECL_SIMD_erff64 "
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2312:
+	.string	"FILTER_FIR"
+.LASF904:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1312:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1549:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF2586:
+	.string	"getTaskDeltaTime"
+.LASF2150:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2560:
+	.string	"values"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1800:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1899:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2357:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2444:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1722:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF2344:
+	.string	"targetPidLooptime"
+.LASF940:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2400:
+	.string	"FEATURE_FAILSAFE"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF2592:
+	.string	"cosDiff"
+.LASF1307:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF2657:
+	.string	"getRcDeflectionAbs"
+.LASF1230:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1088:
+	.string	"__DECL_SIMD_expm1"
+.LASF1280:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF872:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1281:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1073:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1223:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2254:
+	.string	"RC_SMOOTHING_CUTOFF_MAX_HZ 255"
+.LASF2084:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2588:
+	.string	"prop"
+.LASF2587:
+	.string	"rxFrameTimeUs"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1190:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1837:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1040:
+	.string	"__DECL_SIMD_sin"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1099:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1458:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1390:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2645:
+	.string	"rcRate"
+.LASF2105:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1485:
+	.string	"_T_SIZE_ "
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2428:
+	.string	"thrExpo8"
+.LASF2241:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2008:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1112:
+	.string	"__DECL_SIMD_log1p"
+.LASF977:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1284:
+	.string	"__MATHCALL_NARROW"
+.LASF2288:
+	.string	"DEBUG_VELOCITY"
+.LASF963:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1862:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1457:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1261:
+	.string	"_Mret_ _Float32"
+.LASF2206:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1681:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1241:
+	.string	"__MATHDECL_1"
+.LASF1113:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF2179:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2321:
+	.string	"PIDMAG"
+.LASF2537:
+	.string	"rxConfig_t"
+.LASF2381:
+	.string	"OWNER_USB"
+.LASF2624:
+	.string	"index"
+.LASF1080:
+	.string	"__DECL_SIMD_exp10"
+.LASF1607:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF1753:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF982:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2392:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF1131:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2061:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1177:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1965:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF865:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1588:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF2442:
+	.string	"BOXHORIZON"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1631:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1811:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1667:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2331:
+	.string	"pidSumLimit"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF958:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2251:
+	.string	"RC_FRAME_INTERVAL_OUTLIER_COUNT 10"
+.LASF2194:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2521:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF883:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2020:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2030:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2418:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1697:
+	.string	"PG_PID_PROFILE 14"
+.LASF2326:
+	.string	"dterm_lpf_hz"
+.LASF1220:
+	.string	"__MATH_PRECNAME"
+.LASF1250:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1215:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2404:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2316:
+	.string	"PIDALT"
+.LASF994:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2154:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2455:
+	.string	"BOXLLIGHTS"
+.LASF1148:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2362:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1564:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2437:
+	.string	"timeUs_t"
+.LASF1334:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF1941:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1359:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF2401:
+	.string	"FEATURE_SONAR"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2218:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2533:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF2581:
+	.string	"pt1FilterInit"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1491:
+	.string	"_SIZE_T_DEFINED "
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2443:
+	.string	"BOXBARO"
+.LASF1078:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1368:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF2350:
+	.string	"OWNER_SERVO"
+.LASF2186:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1638:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1704:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1532:
+	.string	"ACC "
+.LASF1039:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2318:
+	.string	"PIDPOSR"
+.LASF1696:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1453:
+	.string	"TELEMETRY_IBUS "
+.LASF1432:
+	.string	"USE_PWM "
+.LASF890:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2488:
+	.string	"RC_SMOOTHING_FILTER"
+.LASF966:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1133:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1812:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1841:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1712:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1991:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2514:
+	.string	"sbus_inversion"
+.LASF2281:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1846:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF824:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1721:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF2139:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1927:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1815:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1274:
+	.string	"_Mret_ _Float64"
+.LASF2001:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2042:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2297:
+	.string	"DEBUG_DYN_NOTCH"
+.LASF1661:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF2635:
+	.string	"rcCommandf"
+.LASF2558:
+	.string	"roll"
+.LASF1477:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2524:
+	.string	"midrc"
+.LASF1820:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1396:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF2602:
+	.string	"interpolationChannels"
+.LASF1887:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2202:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2262:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2329:
+	.string	"dterm_notch_cutoff"
+.LASF2286:
+	.string	"DEBUG_NOTCH"
+.LASF2264:
+	.string	"__uint16_t"
+.LASF1171:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2181:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2349:
+	.string	"OWNER_MOTOR"
+.LASF891:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1591:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1904:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF858:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2282:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF364:
+	.string	"__k8 1"
+.LASF1616:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF2377:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1512:
+	.string	"__INT_WCHAR_T_H "
+.LASF936:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1301:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1937:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1848:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF861:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2009:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1314:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1792:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1888:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF830:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1275:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF1462:
+	.string	"USE_SENSOR_NAMES "
+.LASF2413:
+	.string	"FEATURE_AIRMODE"
+.LASF2516:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1825:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF892:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1098:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF2039:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1823:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1770:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF2114:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2433:
+	.string	"ratesType"
+.LASF2590:
+	.string	"throttleScaler"
+.LASF1000:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1606:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF2546:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF793:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF821:
+	.string	"__DECL_SIMD_powf128 "
+.LASF862:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1298:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1197:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF2073:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1268:
+	.string	"_Marg_ _Float128"
+.LASF1167:
+	.string	"__f32x(x) x ##f32x"
+.LASF879:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1201:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2233:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF1321:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1222:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1629:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1246:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1282:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1758:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1857:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2600:
+	.string	"rcInterpolationFactor"
+.LASF355:
+	.string	"__amd64 1"
+.LASF2499:
+	.string	"HORIZON_MODE"
+.LASF1797:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2256:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1271:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1813:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1253:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF822:
+	.string	"__DECL_SIMD_powf32x "
+.LASF953:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2395:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1764:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1767:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1655:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1135:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1478:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1049:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF2431:
+	.string	"rcYawExpo8"
+.LASF2074:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2134:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2626:
+	.string	"rxRefreshRateMs"
+.LASF1715:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2308:
+	.string	"biquadFilter_s"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2517:
+	.string	"rx_spi_id"
+.LASF2266:
+	.string	"__uint32_t"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF2176:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2618:
+	.string	"processRcSmoothingFilter"
+.LASF2274:
+	.string	"float"
+.LASF1391:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1693:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1659:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF2440:
+	.string	"BOXARM"
+.LASF2111:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2093:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2532:
+	.string	"fpvCamAngleDegrees"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1909:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2508:
+	.string	"FAILSAFE_MODE"
+.LASF1243:
+	.string	"__MATHDECL"
+.LASF2336:
+	.string	"levelAngleLimit"
+.LASF2525:
+	.string	"mincheck"
+.LASF1459:
+	.string	"USE_MSP_PUSH "
+.LASF987:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1570:
+	.string	"VTX_COMMON"
+.LASF1352:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF848:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1470:
+	.string	"_PTRDIFF_T "
+.LASF2456:
+	.string	"BOXCALIB"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2396:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1037:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1861:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF2398:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1745:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF881:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1829:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1929:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1115:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF944:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2310:
+	.string	"FILTER_PT1"
+.LASF2578:
+	.string	"biquadFilterApply"
+.LASF1622:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF913:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2452:
+	.string	"BOXBEEPERON"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1866:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2628:
+	.string	"throttleVelocityThreshold"
+.LASF1350:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2127:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2577:
+	.string	"pt1FilterApply"
+.LASF2252:
+	.string	"RC_SMOOTHING_AUTO_CUTOFF_DIVIDER 4"
+.LASF2389:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1442:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2064:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF2556:
+	.string	"TASK_SELF"
+.LASF1738:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2029:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2476:
+	.string	"AUX1"
+.LASF2477:
+	.string	"AUX2"
+.LASF838:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2479:
+	.string	"AUX4"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2481:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2483:
+	.string	"AUX8"
+.LASF1700:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2664:
+	.string	"high"
+.LASF2638:
+	.string	"curve"
+.LASF2526:
+	.string	"maxcheck"
+.LASF1277:
+	.string	"_Mret_ _Float64x"
+.LASF1292:
+	.string	"FP_NORMAL 4"
+.LASF2473:
+	.string	"ROLL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1535:
+	.string	"USE_FAKE_BARO "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1440:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2000:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2003:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1376:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF2371:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1447:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF2117:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1342:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2548:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF886:
+	.string	"__DECL_SIMD_coshf "
+.LASF1182:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1906:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF967:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1982:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1898:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1395:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF959:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1160:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1853:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1970:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1816:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2002:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1018:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF864:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2290:
+	.string	"DEBUG_ANGLERATE"
+.LASF1868:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1935:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1954:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2462:
+	.string	"BOXSERVO1"
+.LASF2463:
+	.string	"BOXSERVO2"
+.LASF2464:
+	.string	"BOXSERVO3"
+.LASF1157:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2235:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1214:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1217:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF2639:
+	.string	"angleRate"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF918:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1839:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2164:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF2575:
+	.string	"cos_approx"
+.LASF2137:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2066:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2616:
+	.string	"value"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF774:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1429:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF1772:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF937:
+	.string	"__DECL_SIMD_log10l "
+.LASF2276:
+	.string	"debug"
+.LASF402:
+	.string	"false 0"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1419:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2149:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2077:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF814:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2171:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1138:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1584:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF2108:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2315:
+	.string	"PIDYAW"
+.LASF1894:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2557:
+	.string	"cfTaskId_e"
+.LASF2004:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1159:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2601:
+	.string	"currentRxRefreshRate"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF765:
+	.string	"__DECL_SIMD_cos "
+.LASF1097:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF1036:
+	.string	"__DECL_SIMD_cos"
+.LASF1299:
+	.string	"MATH_ERRNO 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1398:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1111:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1343:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1902:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF924:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2222:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2382:
+	.string	"OWNER_USB_DETECT"
+.LASF943:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2098:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2011:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1832:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF846:
+	.string	"__DECL_SIMD_asinf "
+.LASF2130:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1774:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1431:
+	.string	"USE_PPM "
+.LASF2643:
+	.string	"calculateRateActual"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1952:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF2026:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1483:
+	.string	"_SIZE_T "
+.LASF2520:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1740:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF2501:
+	.string	"BARO_MODE"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2536:
+	.string	"rx_max_usec"
+.LASF1650:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2143:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1247:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1523:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1038:
+	.string	"__DECL_SIMD_cosf"
+.LASF1231:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1084:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF813:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1957:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF970:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1083:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF766:
+	.string	"__DECL_SIMD_cosf "
+.LASF2422:
+	.string	"RATES_TYPE_ACTUAL"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1962:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2438:
+	.string	"isRXDataNew"
+.LASF1798:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF910:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2408:
+	.string	"FEATURE_DASHBOARD"
+.LASF799:
+	.string	"__DECL_SIMD_logf32 "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1653:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1320:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1826:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2293:
+	.string	"DEBUG_STACK"
+.LASF2386:
+	.string	"OWNER_INVERTER"
+.LASF1317:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1966:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2366:
+	.string	"OWNER_SPI_MOSI"
+.LASF1917:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2120:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2500:
+	.string	"MAG_MODE"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2271:
+	.string	"uint8_t"
+.LASF1403:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF1206:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1865:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1623:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1183:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF2365:
+	.string	"OWNER_SPI_MISO"
+.LASF2299:
+	.string	"DEBUG_DSHOT_RPM_TELEMETRY"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2607:
+	.string	"pt1Filter"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2080:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1221:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1969:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1633:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2585:
+	.string	"rxGetRefreshRate"
+.LASF1443:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF831:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1364:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1119:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF786:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2248:
+	.string	"THROTTLE_DELTA_MS 100"
+.LASF1137:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1023:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1005:
+	.string	"__DECL_SIMD_asinh "
+.LASF2474:
+	.string	"PITCH"
+.LASF1404:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1609:
+	.string	"VERY_FAST_MATH "
+.LASF1273:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2541:
+	.string	"TASK_ACCEL"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1513:
+	.string	"_GCC_WCHAR_T "
+.LASF1508:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2459:
+	.string	"BOXTELEMETRY"
+.LASF2243:
+	.string	"THROTTLE_LOOKUP_LENGTH (1000 / THROTTLE_LOOKUP_STEP + 2)"
+.LASF1495:
+	.string	"___int_size_t_h "
+.LASF1033:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1562:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1762:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1184:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1324:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF832:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1438:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2594:
+	.string	"rcCommand_PITCH"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF2472:
+	.string	"rcModeActivationMask"
+.LASF2311:
+	.string	"FILTER_BIQUAD"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF775:
+	.string	"__DECL_SIMD_sin "
+.LASF1529:
+	.string	"LED0_PIN NONE"
+.LASF1864:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF2113:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1563:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1516:
+	.string	"_BSD_WCHAR_T_"
+.LASF1356:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF1043:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF971:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1136:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1883:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1150:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2032:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1488:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2178:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1059:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1679:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF2609:
+	.string	"rcTarget"
+.LASF1499:
+	.string	"__need_size_t"
+.LASF1141:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2596:
+	.string	"processRcCommand"
+.LASF2348:
+	.string	"OWNER_PPMINPUT"
+.LASF1525:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1777:
+	.string	"IOCFG_IPD 0"
+.LASF1480:
+	.string	"__need_ptrdiff_t"
+.LASF818:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2303:
+	.string	"FD_PITCH"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF849:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1175:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1423:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2614:
+	.string	"cutoffHz"
+.LASF1635:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2133:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2589:
+	.string	"axis"
+.LASF1235:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1718:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1467:
+	.string	"_STDDEF_H "
+.LASF2076:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF972:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2510:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1042:
+	.string	"__DECL_SIMD_sinf"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF2014:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1817:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1678:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF2572:
+	.string	"qMultiply"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF868:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1161:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1012:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1407:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF803:
+	.string	"__DECL_SIMD_logf64x "
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF2203:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF2013:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1743:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1224:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2522:
+	.string	"rssi_scale"
+.LASF1708:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1590:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1662:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1569:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2427:
+	.string	"thrMid8"
+.LASF1713:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF921:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2169:
+	.string	"AIRMODEDEADBAND 12"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1855:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF2214:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2220:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2636:
+	.string	"rcCommandfAbs"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1873:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2595:
+	.string	"updateRcCommands"
+.LASF1493:
+	.string	"_SIZE_T_DECLARED "
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF2019:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1901:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF898:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2229:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1185:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1409:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF2530:
+	.string	"rcSmoothingFilterType"
+.LASF2240:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF2470:
+	.string	"BOXBLACKBOXERASE"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1940:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1227:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2613:
+	.string	"smoothingChannels"
+.LASF1852:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2057:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2296:
+	.string	"DEBUG_FFT"
+.LASF1756:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1559:
+	.string	"LED_STRIP"
+.LASF2050:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF922:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF2647:
+	.string	"expoCommandf"
+.LASF1773:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1149:
+	.string	"__f128(x) x ##f128"
+.LASF978:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1226:
+	.string	"_Mdouble_ long double"
+.LASF778:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF2095:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1851:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2527:
+	.string	"rcInterpolation"
+.LASF2283:
+	.string	"DEBUG_MIXER"
+.LASF1340:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1835:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1045:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1926:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1555:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1654:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1019:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2411:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF2177:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF2230:
+	.string	"SCHEDULER_HISTOGRAM_BUCKETS 16"
+.LASF1961:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF930:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF860:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1912:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1061:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF847:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1444:
+	.string	"TELEMETRY_FRSKY "
+.LASF1790:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1026:
+	.string	"__DECL_SIMD_tanf "
+.LASF2037:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1754:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1601:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF919:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2361:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1751:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2048:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1620:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1233:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF2649:
+	.string	"stickMovement"
+.LASF1948:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2035:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1939:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1942:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1771:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1593:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1554:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1262:
+	.string	"_Marg_ _Float32x"
+.LASF767:
+	.string	"__DECL_SIMD_cosl "
+.LASF885:
+	.string	"__DECL_SIMD_cosh "
+.LASF1180:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1746:
+	.string	"PG_PID_CONFIG 504"
+.LASF1838:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1778:
+	.string	"IOCFG_IPU 0"
+.LASF1186:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1209:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1671:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1871:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1981:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1675:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2416:
+	.string	"FEATURE_RX_SPI"
+.LASF2425:
+	.string	"rcYawRate8"
+.LASF2559:
+	.string	"pitch"
+.LASF2337:
+	.string	"levelSensitivity"
+.LASF2363:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2606:
+	.string	"channel"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1500:
+	.string	"__wchar_t__ "
+.LASF1660:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1581:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1188:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1318:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF499:
+	.string	"__PMT"
+.LASF2507:
+	.string	"SONAR_MODE"
+.LASF2640:
+	.string	"resetYawAxis"
+.LASF1514:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF2487:
+	.string	"RC_SMOOTHING_MANUAL"
+.LASF1576:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2324:
+	.string	"pidProfile_s"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1987:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2622:
+	.string	"checkForThrottleErrorResetState"
+.LASF993:
+	.string	"__DECL_SIMD_erff64x "
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1732:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1426:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1313:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2611:
+	.string	"filterLooptime"
+.LASF2497:
+	.string	"rcControlsConfig_System"
+.LASF946:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1998:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1913:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1238:
+	.string	"_Mdouble_ _Float64x"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1371:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF995:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2201:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1938:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1435:
+	.string	"USE_SERIALRX_IBUS "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1475:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1936:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1291:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1147:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2081:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1690:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF2129:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1194:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1108:
+	.string	"__DECL_SIMD_log2"
+.LASF1993:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1683:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1561:
+	.string	"TELEMETRY_HOTT"
+.LASF1370:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF836:
+	.string	"__DECL_SIMD_atanf "
+.LASF2656:
+	.string	"getThrottlePIDAttenuation"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1907:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1644:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1086:
+	.string	"__DECL_SIMD_coshf"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1502:
+	.string	"_WCHAR_T "
+.LASF2280:
+	.string	"DEBUG_BATTERY"
+.LASF1556:
+	.string	"USE_SERIALRX_SUMH"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1208:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1648:
+	.string	"UNIT_TESTED "
+.LASF2583:
+	.string	"feature"
+.LASF1689:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF2485:
+	.string	"RC_SMOOTHING_DEFAULT"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1984:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1698:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1586:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF844:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF2417:
+	.string	"FEATURE_SOFTSPI"
+.LASF2059:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1050:
+	.string	"__DECL_SIMD_logf"
+.LASF1063:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1945:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1673:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF843:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1997:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2666:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF2183:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1163:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1684:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1658:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1422:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1484:
+	.string	"_SYS_SIZE_T_H "
+.LASF895:
+	.string	"__DECL_SIMD_expm1 "
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1830:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1283:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1234:
+	.string	"_Mdouble_ _Float128"
+.LASF1344:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF2582:
+	.string	"pidSetItermAccelerator"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2333:
+	.string	"dterm_average_count"
+.LASF1014:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1389:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1587:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF2631:
+	.string	"lastFpvCamAngleDegrees"
+.LASF2107:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2219:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF961:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1402:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF1106:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1437:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1928:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2006:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1880:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2038:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2135:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1408:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1323:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF2334:
+	.string	"vbatPidCompensation"
+.LASF957:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2563:
+	.string	"setpointRate"
+.LASF2435:
+	.string	"currentControlRateProfile"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF1755:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF795:
+	.string	"__DECL_SIMD_log "
+.LASF884:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2539:
+	.string	"TASK_SYSTEM"
+.LASF789:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF2564:
+	.string	"rcDeflection"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1520:
+	.string	"__need_NULL"
+.LASF962:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1833:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF2489:
+	.string	"rcCommand"
+.LASF2542:
+	.string	"TASK_ATTITUDE"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1387:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF1236:
+	.string	"_Mdouble_ _Float32x"
+.LASF1621:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF1249:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF906:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1191:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF851:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1809:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF819:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF950:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1558:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF2503:
+	.string	"GPS_HOLD_MODE"
+.LASF2511:
+	.string	"rxConfig_s"
+.LASF2189:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1918:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1585:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1983:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1242:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2621:
+	.string	"outlierCount"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1265:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1451:
+	.string	"CMS "
+.LASF1567:
+	.string	"TELEMETRY_IBUS"
+.LASF1100:
+	.string	"__DECL_SIMD_atan2"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1691:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1916:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF869:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF2161:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF1251:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2504:
+	.string	"HEADFREE_MODE"
+.LASF852:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2369:
+	.string	"OWNER_SDCARD"
+.LASF2608:
+	.string	"biquadFilter"
+.LASF1256:
+	.string	"__MATHCALL_NAME"
+.LASF1706:
+	.string	"PG_RX_CONFIG 24"
+.LASF955:
+	.string	"__DECL_SIMD_log1p "
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF2468:
+	.string	"BOX3DDISABLESWITCH"
+.LASF1346:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF2052:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1027:
+	.string	"__DECL_SIMD_tanl "
+.LASF882:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2138:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1300:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1731:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1602:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1518:
+	.string	"NULL"
+.LASF2269:
+	.string	"int16_t"
+.LASF1728:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1985:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1354:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF2257:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1946:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2260:
+	.string	"signed char"
+.LASF1164:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1652:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF800:
+	.string	"__DECL_SIMD_logf64 "
+.LASF783:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1886:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2278:
+	.string	"DEBUG_NONE"
+.LASF2067:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF899:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF1481:
+	.string	"__size_t__ "
+.LASF1002:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1286:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1448:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1527:
+	.string	"U_ID_1 1"
+.LASF1849:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1179:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1134:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1547:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1510:
+	.string	"_WCHAR_T_H "
+.LASF1959:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1699:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2191:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1103:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2540:
+	.string	"TASK_GYROPID"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1091:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF2406:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1604:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF979:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1605:
+	.string	"sq(x) ((x)*(x))"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF951:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1259:
+	.string	"_Mret_ double"
+.LASF1081:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1640:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2044:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1963:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2193:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1065:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1166:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1489:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1189:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2531:
+	.string	"rcSmoothingCutoffHz"
+.LASF1446:
+	.string	"TELEMETRY_LTM "
+.LASF2210:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF2650:
+	.string	"calculateRateBetaflight"
+.LASF1795:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1958:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2447:
+	.string	"BOXCAMSTAB"
+.LASF1416:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF947:
+	.string	"__DECL_SIMD_log2l "
+.LASF2207:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1492:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2175:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2302:
+	.string	"FD_ROLL"
+.LASF1707:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1048:
+	.string	"__DECL_SIMD_log"
+.LASF2655:
+	.string	"getRcFrameIntervalUs"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2273:
+	.string	"uint32_t"
+.LASF1155:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2041:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2391:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2467:
+	.string	"BOXAIRMODE"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2513:
+	.string	"serialrx_provider"
+.LASF1711:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1228:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1875:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2305:
+	.string	"state"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF1670:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1255:
+	.string	"_Marg_"
+.LASF1006:
+	.string	"__DECL_SIMD_asinhf "
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2082:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1441:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1008:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF2255:
+	.string	"RC_SMOOTHING_CHANNEL_COUNT 4"
+.LASF1469:
+	.string	"_ANSI_STDDEF_H "
+.LASF1694:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1761:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2384:
+	.string	"OWNER_OSD"
+.LASF791:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1366:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF2623:
+	.string	"frameTimeUs"
+.LASF1819:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2053:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2136:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF801:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2102:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1054:
+	.string	"__DECL_SIMD_expf"
+.LASF1885:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1749:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2445:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1834:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1316:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1804:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2199:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1181:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1579:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF2615:
+	.string	"filter"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1381:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1269:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF1878:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1784:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF792:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1225:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2484:
+	.string	"RC_SMOOTHING_OFF"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF1919:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1165:
+	.string	"__f32(x) x ##f32"
+.LASF2172:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1682:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2339:
+	.string	"itermAcceleratorGain"
+.LASF1290:
+	.string	"FP_ZERO 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF954:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1776:
+	.string	"IOCFG_AF_OD 0"
+.LASF2079:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF809:
+	.string	"__DECL_SIMD_expf32 "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1827:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1545:
+	.string	"USE_UART8 "
+.LASF808:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2192:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1810:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1968:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1580:
+	.string	"USE_PROFILE "
+.LASF2091:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF2010:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2409:
+	.string	"FEATURE_OSD"
+.LASF1736:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF952:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1450:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1089:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1996:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1995:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2146:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1109:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF839:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1203:
+	.string	"FP_INT_TONEAREST 4"
+.LASF1791:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1710:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1240:
+	.string	"__MATHDECL_1_IMPL"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF2304:
+	.string	"FD_YAW"
+.LASF2267:
+	.string	"long int"
+.LASF1714:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF1072:
+	.string	"__DECL_SIMD_hypot"
+.LASF2627:
+	.string	"indexMax"
+.LASF1879:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF948:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1747:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1617:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF984:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF911:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1931:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2359:
+	.string	"OWNER_PINDEBUG"
+.LASF1858:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF960:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2125:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1104:
+	.string	"__DECL_SIMD_log10"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2239:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF2458:
+	.string	"BOXOSD"
+.LASF2197:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF2579:
+	.string	"biquadFilterUpdateLPF"
+.LASF1105:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1452:
+	.string	"TELEMETRY_CRSF "
+.LASF2292:
+	.string	"DEBUG_SCHEDULER"
+.LASF1474:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF1202:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1634:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1392:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF2576:
+	.string	"lrintf"
+.LASF2022:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1473:
+	.string	"__PTRDIFF_T "
+.LASF1465:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF912:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2593:
+	.string	"sinDiff"
+.LASF1884:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1210:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF2237:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1575:
+	.string	"USE_RESOURCE_MGMT"
+.LASF2024:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2544:
+	.string	"TASK_SERIAL"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF915:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1632:
+	.string	"EXPAND_I(x) x"
+.LASF1934:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2212:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF2634:
+	.string	"calculateSetpointRate"
+.LASF2025:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2347:
+	.string	"OWNER_PWMINPUT"
+.LASF1891:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1216:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1973:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1374:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF1487:
+	.string	"__SIZE_T "
+.LASF1612:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1270:
+	.string	"_Mret_ _Float32x"
+.LASF1044:
+	.string	"__DECL_SIMD_sincos"
+.LASF1808:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1637:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2099:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1526:
+	.string	"U_ID_0 0"
+.LASF1117:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1127:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1169:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1319:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2063:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF945:
+	.string	"__DECL_SIMD_log2 "
+.LASF1856:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1521:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2208:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF933:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF964:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1405:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF2353:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2662:
+	.string	"cmpTimeUs"
+.LASF1170:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1245:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF974:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1799:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1613:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF2637:
+	.string	"position"
+.LASF1003:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF2069:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2423:
+	.string	"controlRateConfig_s"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1335:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF2015:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1172:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF815:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1560:
+	.string	"TELEMETRY_FRSKY"
+.LASF2259:
+	.string	"long unsigned int"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1302:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1315:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2446:
+	.string	"BOXHEADADJ"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1726:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2277:
+	.string	"debugMode"
+.LASF1503:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1400:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1874:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1923:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF2543:
+	.string	"TASK_RX"
+.LASF784:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1369:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF2439:
+	.string	"headFreeModeHold"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF2449:
+	.string	"BOXGPSHOME"
+.LASF2332:
+	.string	"pidSumLimitYaw"
+.LASF2360:
+	.string	"OWNER_TIMER"
+.LASF1289:
+	.string	"FP_INFINITE 1"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1727:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1427:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1860:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2554:
+	.string	"TASK_COUNT"
+.LASF2341:
+	.string	"dtermSetpointWeight"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF2033:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1537:
+	.string	"USE_FAKE_MAG "
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1801:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1058:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF976:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1574:
+	.string	"BLACKBOX"
+.LASF2268:
+	.string	"char"
+.LASF1248:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2317:
+	.string	"PIDPOS"
+.LASF941:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1930:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2426:
+	.string	"rcExpo8"
+.LASF1110:
+	.string	"__DECL_SIMD_log2f"
+.LASF2016:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF2597:
+	.string	"lastCommand"
+.LASF1577:
+	.string	"USE_DSHOT"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF2142:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1515:
+	.string	"__DEFINED_wchar_t "
+.LASF1158:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1867:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1669:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF771:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1775:
+	.string	"IOCFG_AF_PP 0"
+.LASF2180:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF938:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1552:
+	.string	"USE_SERIALRX_IBUS"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF855:
+	.string	"__DECL_SIMD_hypot "
+.LASF1863:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1193:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1994:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF903:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2453:
+	.string	"BOXLEDMAX"
+.LASF2465:
+	.string	"BOXBLACKBOX"
+.LASF1415:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF811:
+	.string	"__DECL_SIMD_expf128 "
+.LASF2429:
+	.string	"rates"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF770:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF942:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF834:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF2055:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1765:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2163:
+	.string	"BEEP_ON do {} while(0)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2372:
+	.string	"OWNER_FLASH_CS"
+.LASF1947:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1198:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF2466:
+	.string	"BOXFAILSAFE"
+.LASF1557:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1460:
+	.string	"USE_RX_MSP "
+.LASF1628:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1976:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF2028:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF772:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2187:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF826:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF2223:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1496:
+	.string	"_GCC_SIZE_T "
+.LASF812:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1009:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2285:
+	.string	"DEBUG_PIDLOOP"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1074:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1881:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2213:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1153:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1498:
+	.string	"__size_t "
+.LASF914:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1085:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1425:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1550:
+	.string	"SERIAL_RX"
+.LASF1802:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1599:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1603:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2325:
+	.string	"dterm_filter_type"
+.LASF2460:
+	.string	"BOXGTUNE"
+.LASF1331:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1021:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF850:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1979:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1519:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1719:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2158:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF2121:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1551:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2502:
+	.string	"GPS_HOME_MODE"
+.LASF2565:
+	.string	"rcDeflectionAbs"
+.LASF2397:
+	.string	"FEATURE_SERVO_TILT"
+.LASF2641:
+	.string	"generateRcCurves"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1413:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1572:
+	.string	"VTX_SMARTAUDIO"
+.LASF1436:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2364:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1895:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2356:
+	.string	"OWNER_ADC_RSSI"
+.LASF1646:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1107:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2056:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1553:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2549:
+	.string	"TASK_COMPASS"
+.LASF1338:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1075:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1022:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF780:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF876:
+	.string	"__DECL_SIMD_exp10f "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1254:
+	.string	"_Mret_"
+.LASF2200:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2441:
+	.string	"BOXANGLE"
+.LASF2498:
+	.string	"ANGLE_MODE"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1517:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1782:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF2545:
+	.string	"TASK_DISPATCH"
+.LASF931:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1472:
+	.string	"_T_PTRDIFF "
+.LASF840:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1360:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF1032:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF975:
+	.string	"__DECL_SIMD_acosh "
+.LASF1139:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1988:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1031:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2410:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF2226:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1399:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1533:
+	.string	"USE_FAKE_ACC "
+.LASF1337:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF2309:
+	.string	"biquadFilter_t"
+.LASF1285:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1748:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2036:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1417:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1196:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1288:
+	.string	"FP_NAN 0"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1999:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2062:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1703:
+	.string	"PG_SERVO_MIXER 21"
+.LASF2215:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF2289:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF932:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF888:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF985:
+	.string	"__DECL_SIMD_erf "
+.LASF2573:
+	.string	"qConstruct"
+.LASF2633:
+	.string	"sinFactor"
+.LASF1077:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1951:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2049:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1192:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2415:
+	.string	"FEATURE_VTX"
+.LASF2567:
+	.string	"lookupThrottleRC"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1956:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2131:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2205:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1571:
+	.string	"VTX_CONTROL"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1122:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1325:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF2450:
+	.string	"BOXGPSHOLD"
+.LASF1992:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2153:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1020:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF2568:
+	.string	"setpointRateCurve"
+.LASF2250:
+	.string	"RC_FRAME_INTERVAL_MAX_US 50000"
+.LASF1701:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1950:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2475:
+	.string	"THROTTLE"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2284:
+	.string	"DEBUG_AIRMODE"
+.LASF1047:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1394:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1200:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF825:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1187:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF2651:
+	.string	"rcSuperfactor"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2174:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2184:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF802:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1737:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1664:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1641:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2388:
+	.string	"OWNER_TRANSPONDER"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2279:
+	.string	"DEBUG_CYCLETIME"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF2294:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF1428:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1174:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1424:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1266:
+	.string	"_Marg_ _Float64x"
+.LASF1414:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1665:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1057:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF2620:
+	.string	"lastFrameTimeUs"
+.LASF2047:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2648:
+	.string	"centreSensitivity"
+.LASF2275:
+	.string	"double"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1903:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF828:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1759:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1785:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF925:
+	.string	"__DECL_SIMD_atan2 "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1367:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF2367:
+	.string	"OWNER_I2C_SCL"
+.LASF1062:
+	.string	"__DECL_SIMD_acosf"
+.LASF1120:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2390:
+	.string	"OWNER_COMPASS_CS"
+.LASF1506:
+	.string	"_WCHAR_T_ "
+.LASF2236:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1531:
+	.string	"USE_FAKE_GYRO "
+.LASF1831:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF998:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2419:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF2659:
+	.string	"getSetpointRate"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2405:
+	.string	"FEATURE_RX_MSP"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2547:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF2328:
+	.string	"dterm_notch_hz"
+.LASF2619:
+	.string	"updateRcFrameInterval"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2529:
+	.string	"rcInterpolationInterval"
+.LASF1507:
+	.string	"_BSD_WCHAR_T_ "
+.LASF873:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1974:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2399:
+	.string	"FEATURE_GPS"
+.LASF2330:
+	.string	"itermWindupPointPercent"
+.LASF1787:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1844:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1594:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2490:
+	.string	"rcControlsConfig_s"
+.LASF2496:
+	.string	"rcControlsConfig_t"
+.LASF1311:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2307:
+	.string	"pt1Filter_s"
+.LASF2471:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2265:
+	.string	"__int32_t"
+.LASF2660:
+	.string	"rxConfig"
+.LASF1297:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2368:
+	.string	"OWNER_I2C_SDA"
+.LASF2228:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2457:
+	.string	"BOXGOV"
+.LASF2493:
+	.string	"alt_hold_deadband"
+.LASF1615:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1013:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF2060:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1769:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2407:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2550:
+	.string	"TASK_BARO"
+.LASF1619:
+	.string	"Q12 (1 << 12)"
+.LASF1687:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1412:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1430:
+	.string	"USE_CLI "
+.LASF1972:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2430:
+	.string	"dynThrPID"
+.LASF1126:
+	.string	"__DECL_SIMD_erff"
+.LASF1522:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1850:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1986:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF2103:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2436:
+	.string	"timeDelta_t"
+.LASF1361:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF2373:
+	.string	"OWNER_FLASH"
+.LASF827:
+	.string	"__DECL_SIMD_acosl "
+.LASF1263:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1733:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1420:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF1053:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2234:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF2232:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1079:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF1151:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1123:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1211:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF2652:
+	.string	"rcLookupThrottle"
+.LASF816:
+	.string	"__DECL_SIMD_powf "
+.LASF2225:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1213:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1504:
+	.string	"_T_WCHAR "
+.LASF2070:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1905:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1497:
+	.string	"_SIZET_ "
+.LASF2140:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF2051:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF2221:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2551:
+	.string	"TASK_ALTITUDE"
+.LASF1893:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF2043:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF853:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1468:
+	.string	"_STDDEF_H_ "
+.LASF1789:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1064:
+	.string	"__DECL_SIMD_atan"
+.LASF1479:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF845:
+	.string	"__DECL_SIMD_asin "
+.LASF2156:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1910:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1035:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1244:
+	.string	"__MATHCALL"
+.LASF939:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1626:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2034:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1007:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1358:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1568:
+	.string	"USE_DASHBOARD"
+.LASF887:
+	.string	"__DECL_SIMD_coshl "
+.LASF1869:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1843:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1943:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1308:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1418:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1305:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF2385:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF992:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1464:
+	.string	"VTX_CONTROL "
+.LASF965:
+	.string	"__DECL_SIMD_atanh "
+.LASF2478:
+	.string	"AUX3"
+.LASF2045:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2454:
+	.string	"BOXLEDLOW"
+.LASF1705:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2480:
+	.string	"AUX5"
+.LASF1195:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF2482:
+	.string	"AUX7"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF877:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2031:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF2509:
+	.string	"flightModeFlags"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1896:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2340:
+	.string	"setpointRelaxRatio"
+.LASF1611:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2100:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2667:
+	.string	"rc_alias"
+.LASF2566:
+	.string	"throttlePIDAttenuation"
+.LASF1143:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1070:
+	.string	"__DECL_SIMD_asinf"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1132:
+	.string	"__DECL_SIMD_asinh"
+.LASF2017:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2432:
+	.string	"tpa_breakpoint"
+.LASF1092:
+	.string	"__DECL_SIMD_sinh"
+.LASF1401:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF2469:
+	.string	"BOXFPVANGLEMIX"
+.LASF1897:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF894:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1955:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF856:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1095:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF790:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1449:
+	.string	"USE_SERVOS "
+.LASF2168:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF2553:
+	.string	"TASK_MSP_PUSH"
+.LASF841:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1267:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2152:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1294:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF382:
+	.string	"unix 1"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1306:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1330:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1118:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF934:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2654:
+	.string	"generateThrottleCurve"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF820:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1676:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1333:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF1121:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2375:
+	.string	"OWNER_MPU_CS"
+.LASF2378:
+	.string	"OWNER_SPI_CS"
+.LASF2605:
+	.string	"readyToCalculateRateAxisCnt"
+.LASF2298:
+	.string	"DEBUG_GYRO_TO_MOTOR"
+.LASF2027:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1145:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2249:
+	.string	"RC_FRAME_INTERVAL_MIN_US 1000"
+.LASF1686:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2580:
+	.string	"biquadFilterInitLPF"
+.LASF2204:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2238:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF2104:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF842:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2211:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF2495:
+	.string	"yaw_control_reversed"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1536:
+	.string	"MAG "
+.LASF2287:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF866:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF782:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1766:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF1642:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1082:
+	.string	"__DECL_SIMD_exp10f"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1173:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF2421:
+	.string	"RATES_TYPE_BETAFLIGHT"
+.LASF2046:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1144:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1544:
+	.string	"USE_UART7 "
+.LASF2123:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2335:
+	.string	"pidAtMinThrottle"
+.LASF2106:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1486:
+	.string	"_T_SIZE "
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF983:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF920:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2661:
+	.string	"rcControlsConfig"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1066:
+	.string	"__DECL_SIMD_atanf"
+.LASF1229:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1807:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1688:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2247:
+	.string	"THROTTLE_BUFFER_MAX 20"
+.LASF956:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1672:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1339:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1041:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1614:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1643:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF893:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF900:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1836:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF2569:
+	.string	"rcFrameIntervalUs"
+.LASF2555:
+	.string	"TASK_NONE"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1345:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF1600:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1004:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2346:
+	.string	"OWNER_FREE"
+.LASF875:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1596:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF2244:
+	.string	"SETPOINT_RATE_LIMIT 1998.0f"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF889:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF863:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1421:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF980:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF2291:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1821:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1624:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF996:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2083:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1890:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2535:
+	.string	"rx_min_usec"
+.LASF1028:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2574:
+	.string	"sin_approx"
+.LASF1406:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF1840:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1763:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2518:
+	.string	"rx_spi_rf_channel_count"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1162:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2141:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2167:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1924:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2145:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2424:
+	.string	"rcRate8"
+.LASF823:
+	.string	"__DECL_SIMD_powf64x "
+.LASF773:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2182:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF2571:
+	.string	"degreesToRadians"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1647:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1582:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF837:
+	.string	"__DECL_SIMD_atanl "
+.LASF1397:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF1264:
+	.string	"_Marg_ _Float64"
+.LASF1016:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1252:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1476:
+	.string	"___int_ptrdiff_t_h "
+.LASF1383:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF935:
+	.string	"__DECL_SIMD_log10 "
+.LASF1824:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF968:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2090:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"__DECL_SIMD_erff128 "
+.LASF874:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF908:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1847:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF2021:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2144:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1971:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF829:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1326:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1272:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1380:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF916:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1093:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1720:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF817:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1900:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1257:
+	.string	"_Marg_ long double"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF794:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1355:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF2403:
+	.string	"FEATURE_3D"
+.LASF999:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2216:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1692:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2370:
+	.string	"OWNER_SDCARD_CS"
+.LASF1583:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1232:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2295:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF1980:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1347:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1649:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1490:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1618:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2562:
+	.string	"attitude"
+.LASF2512:
+	.string	"rcmap"
+.LASF1239:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1494:
+	.string	"__DEFINED_size_t "
+.LASF1433:
+	.string	"SERIAL_RX "
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1803:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1788:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2101:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1724:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1538:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF2126:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2599:
+	.string	"factor"
+.LASF2012:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2072:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1921:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2319:
+	.string	"PIDNAVR"
+.LASF1877:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1944:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF986:
+	.string	"__DECL_SIMD_erff "
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF2170:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF2494:
+	.string	"alt_hold_fast_change"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1752:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2343:
+	.string	"rateAccelLimit"
+.LASF2023:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1373:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1908:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1546:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF857:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF768:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1439:
+	.string	"USE_SERIALRX_SUMH "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2642:
+	.string	"generateSetpointRateCurves"
+.LASF2561:
+	.string	"attitudeEulerAngles_t"
+.LASF1781:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2387:
+	.string	"OWNER_LED_STRIP"
+.LASF2040:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1539:
+	.string	"USE_UART2 "
+.LASF1463:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1466:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF2217:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1597:
+	.string	"__disable_irq() "
+.LASF2323:
+	.string	"PID_ITEM_COUNT"
+.LASF1124:
+	.string	"__DECL_SIMD_erf"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1296:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1377:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2505:
+	.string	"UNUSED_MODE"
+.LASF1410:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF787:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1260:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF2148:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1348:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1975:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1329:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF2263:
+	.string	"short int"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF2209:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1068:
+	.string	"__DECL_SIMD_asin"
+.LASF1723:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2342:
+	.string	"yawRateAccelLimit"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1932:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1953:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF2610:
+	.string	"filterCutoffHz"
+.LASF867:
+	.string	"__DECL_SIMD_exp2l "
+.LASF804:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1332:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1540:
+	.string	"USE_UART3 "
+.LASF1212:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1734:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1505:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1327:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF2327:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1102:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1482:
+	.string	"__SIZE_T__ "
+.LASF2617:
+	.string	"intervalUs"
+.LASF1056:
+	.string	"__DECL_SIMD_pow"
+.LASF2162:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF2394:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2552:
+	.string	"TASK_TELEMETRY"
+.LASF2374:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1735:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF2301:
+	.string	"fix12_t"
+.LASF1742:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1870:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1882:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1610:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF1386:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF2534:
+	.string	"airModeActivateThreshold"
+.LASF1598:
+	.string	"__enable_irq() "
+.LASF2258:
+	.string	"unsigned int"
+.LASF1541:
+	.string	"USE_UART4 "
+.LASF859:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2625:
+	.string	"rcCommandThrottlePrevious"
+.LASF1024:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2242:
+	.string	"THROTTLE_LOOKUP_STEP 10"
+.LASF1960:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1287:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF1566:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1783:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1156:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1627:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF926:
+	.string	"__DECL_SIMD_atan2f "
+.LASF2246:
+	.string	"SETPOINT_RATE_CURVE_LENGTH 256"
+.LASF785:
+	.string	"__DECL_SIMD_sincos "
+.LASF1716:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1674:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF997:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2451:
+	.string	"BOXPASSTHRU"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1750:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1336:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF2352:
+	.string	"OWNER_ADC"
+.LASF878:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2379:
+	.string	"OWNER_MPU_EXTI"
+.LASF2491:
+	.string	"deadband"
+.LASF776:
+	.string	"__DECL_SIMD_sinf "
+.LASF1051:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF928:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2112:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2338:
+	.string	"itermThrottleThreshold"
+.LASF1349:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF2448:
+	.string	"BOXCAMTRIG"
+.LASF2058:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1542:
+	.string	"USE_UART5 "
+.LASF2075:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1695:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1090:
+	.string	"__DECL_SIMD_expm1f"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF2506:
+	.string	"PASSTHRU_MODE"
+.LASF1625:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1565:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2355:
+	.string	"OWNER_ADC_EXT"
+.LASF1017:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1741:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1680:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1872:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1046:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1152:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2376:
+	.string	"OWNER_OSD_CS"
+.LASF2665:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2116:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2630:
+	.string	"scaleRcCommandToFpvCamAngle"
+.LASF1666:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1760:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1310:
+	.string	"M_E 2.7182818284590452354"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2109:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1076:
+	.string	"__DECL_SIMD_exp2"
+.LASF1011:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2663:
+	.string	"constrainf"
+.LASF1388:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF2486:
+	.string	"RC_SMOOTHING_AUTO"
+.LASF2159:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF1543:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF917:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1922:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2743:
+	.string	"io_types.h"
+.LASF2729:
+	.string	"mathcalls-helper-functions.h"
+.LASF2721:
+	.string	"math.h"
+.LASF2715:
+	.string	"long-double.h"
+.LASF2732:
+	.string	"platform.h"
+.LASF2703:
+	.string	"mathcalls.h"
+.LASF2671:
+	.string	"src/main/drivers"
+.LASF2723:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2709:
+	.string	"libc-header-start.h"
+.LASF2714:
+	.string	"cdefs.h"
+.LASF2681:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2722:
+	.string	"math-vector.h"
+.LASF2685:
+	.string	"stdint-intn.h"
+.LASF2697:
+	.string	"rc_controls.h"
+.LASF2736:
+	.string	"common_post.h"
+.LASF2680:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2683:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2716:
+	.string	"stubs.h"
+.LASF2712:
+	.string	"wordsize.h"
+.LASF2676:
+	.string	"src/main/target/SITL"
+.LASF2734:
+	.string	"target.h"
+.LASF2689:
+	.string	"axis.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2691:
+	.string	"pid.h"
+.LASF2679:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2705:
+	.string	"failsafe.h"
+.LASF2693:
+	.string	"config.h"
+.LASF2701:
+	.string	"imu.h"
+.LASF2730:
+	.string	"mathcalls-narrow.h"
+.LASF2711:
+	.string	"features-time64.h"
+.LASF2752:
+	.string	"vcd.h"
+.LASF2751:
+	.string	"sound_beeper.h"
+.LASF2684:
+	.string	"types.h"
+.LASF2725:
+	.string	"floatn-common.h"
+.LASF2738:
+	.string	"config_profile.h"
+.LASF2724:
+	.string	"floatn.h"
+.LASF2698:
+	.string	"runtime_config.h"
+.LASF2707:
+	.string	"stdbool.h"
+.LASF2682:
+	.string	"/usr/include"
+.LASF0:
+	.string	"./src/main/fc/fc_rc.c"
+.LASF2668:
+	.string	"src/main/build"
+.LASF2704:
+	.string	"feature.h"
+.LASF2710:
+	.string	"features.h"
+.LASF2673:
+	.string	"src/main/flight"
+.LASF2718:
+	.string	"typesizes.h"
+.LASF2748:
+	.string	"io.h"
+.LASF2747:
+	.string	"serial.h"
+.LASF2744:
+	.string	"flash.h"
+.LASF2700:
+	.string	"scheduler.h"
+.LASF2702:
+	.string	"fc_rc.c"
+.LASF2713:
+	.string	"timesize.h"
+.LASF2719:
+	.string	"time64.h"
+.LASF2731:
+	.string	"iscanonical.h"
+.LASF2686:
+	.string	"stdint-uintn.h"
+.LASF2677:
+	.string	"src/main/target"
+.LASF2737:
+	.string	"utils.h"
+.LASF2753:
+	.string	"fc_rc.h"
+.LASF2678:
+	.string	"src/main"
+.LASF2670:
+	.string	"src/main/config"
+.LASF2746:
+	.string	"sdcard.h"
+.LASF2726:
+	.string	"flt-eval-method.h"
+.LASF2692:
+	.string	"resource.h"
+.LASF2696:
+	.string	"fc_core.h"
+.LASF2695:
+	.string	"time.h"
+.LASF2741:
+	.string	"parameter_group_ids.h"
+.LASF2687:
+	.string	"debug.h"
+.LASF2699:
+	.string	"rx.h"
+.LASF2728:
+	.string	"fp-fast.h"
+.LASF2749:
+	.string	"io_def.h"
+.LASF2672:
+	.string	"src/main/fc"
+.LASF2733:
+	.string	"common.h"
+.LASF2745:
+	.string	"rx_pwm.h"
+.LASF2688:
+	.string	"maths.h"
+.LASF2727:
+	.string	"fp-logb.h"
+.LASF2669:
+	.string	"src/main/common"
+.LASF2674:
+	.string	"src/main/rx"
+.LASF2708:
+	.string	"stdint.h"
+.LASF2740:
+	.string	"build_config.h"
+.LASF2720:
+	.string	"wchar.h"
+.LASF2717:
+	.string	"stubs-64.h"
+.LASF2694:
+	.string	"controlrate_profile.h"
+.LASF2735:
+	.string	"stddef.h"
+.LASF2750:
+	.string	"io_def_generated.h"
+.LASF2675:
+	.string	"src/main/scheduler"
+.LASF2742:
+	.string	"adc.h"
+.LASF2739:
+	.string	"parameter_group.h"
+.LASF2706:
+	.string	"stdc-predef.h"
+.LASF2690:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`U\003\365\017"
+	.string	"\364\021I\004"
+	.string	"."
+	.string	"\315\341\214\354\003\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\002\004\002\240\342\234\212\n\003\274\330\257\340\017\020\004\321\337\300\235\004\005\264\334\336\350\006\006\005\002\006\006\007\201\251\353\235\017\020\002\003\002\007\002\005\002\b\t\001\002\001\t\n\r\016\354\271\223\f\024\002\n\013\002\013\013\002\013\017\020\021\022\253\231\361\237\004\b\002\001\002\f\n\002\n\025\323\225\310\362\003\032\002\r\002\r\002\013\002\016\017\003\002\020\020\005\002\016\027\030\031\320\212\353\303\016\030\005\002\005\032\352\263\360\321\b\033\315\343\301\244\013\034\035\223\365\246\215\002`\021\002\021\022\005\002\022\005\002\023\024\003\002\007!\"#$%&'(\377\341\234\356\013\002)*+\354\206\342\366\006\005,-\322\315\213\315\007\004\003\002\004.\253\304\372\354\016"
+	.string	"/\347\273\234\355\f\0020\313\243\257\242\013P\005\002\016\003\002\003\003\007\007\021\002\021123\341\320\334\331\b456\212\210\305\325\002B\002\003\002\025\013\002\005\013\026\001\002\026\002\021\007\013\002\027\002\027\007;\226\355\236\304\n\004"
+	.string	"w\250\301A1\022)%\005\2056p\002bT\325\r\021"
+	.ascii	"M\205 #MI\212\365\317\377r\023\332\336\330\247\307\316\370\374"
+	.ascii	"0\370\331c8,\236\356/T\233^\362\376i\303;SN\244\316\342\360\347"
+	.ascii	"\2071\037\245\375,\370\351\320\306\013\323J\331R\334\365\265"
+	.ascii	"\021\026\245\372\365I\322+t./\277dGK&|\325W@'r.\344d\312`+l\311"
+	.ascii	"\361>k@\233M\215\356y\362\237\\I\373\347=\331\024\343i\244\264"
+	.ascii	"\245\374\302 \002\245<\363\324\267gc<.\324\303|\371G\204\355"
+	.ascii	"q\277&4u\224\231rP;t\367\263\017(\215\2350\314\372\r\354p\313"
+	.ascii	"\244\256\036.Q\214Q\251\342\277\307\275\300F\374x\237%\363j;"
+	.ascii	"Nx\314B\246D/\244R\373\262W\255|*\001\2502\342\313R\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375 \304-\003"
+	.string	"\344\002\270"
+	.string	"\024"
+	.string	""
+	.string	"\001\003\002"
+	.string	"\003\004\005"
+	.string	"\001\007\001\016\022"
+	.string	"\003\025"
+	.string	"\031\035\001(\003)*+"
+	.string	"\003-."
+	.string	"\001/"
+	.string	"\0030"
+	.string	"6;"
+	.string	"\001"
+	.string	"\027"
+	.string	" "
+	.ascii	"-\016\313p\205\254\270\216\262\227\346 0\256\312\240T\307-\326"
+	.ascii	"\202\"\214\313\2462\030S\323\271k1\207\r\025\234\312\264\224"
+	.ascii	"\023\300\016\227\215A6\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`B\004\355\022"
+	.string	"\306\031_G\320TQ\032\003\344\353N[\251\270I\230K\037\256\337\026S\034`.q\237\350\351\223\034\002y\030\213\370\306\3756\322\022\217~\224{\262\366y\200/\346\200k=\212?\303\360\275\370\321{]\227Ah\373\365o\177\"\245L\001F"
+	.string	"M"
+	.string	"O"
+	.string	"\246K\227T\252\023\363\0312=\340\225\356{W\336z\200h`\336\177\222\210J\374\261\005\242R\003~\343\241r\303\334j!c7B1Z\326<W\271\273\266\367/-1\204\226\343\222\217/\225\211\240\345\244|\201I/\001\2632\304\216\033 &%\332\3019\252\240\230b\007\307\310\312"
+	.ascii	"\024D\252\033}\362\323\204\373_\312S\333 \t\3625\203\376\310"
+	.ascii	"V\b\312$VI\245\267\241\237\242\22746\263\356\311vw\201K\203v"
+	.ascii	"W\301\234\312\252\23177\267\322\023:1Z\271\002\306\007\"h\303"
+	.ascii	"\220.r\334\214\220\304\bNu\217D\006O\321\204\\E\227\304\306\340"
+	.ascii	"\223\223\236\352\260\245/k\273\353\202\242\265]\231\006\033("
+	.ascii	"\311\177\326\003T\303\2427\233\031,e\0022\357[Z\303\306\021\021"
+	.ascii	"\214+=\3748b\244r\200\177.\2578\n\377\302`&lXD\007\212\0311\034"
+	.ascii	"\361\313wx\177AmB,z\240\217\230\2441\303\003\007\326\334\202"
+	.ascii	"\0228|P\004\226\236Xz:\200-}\261\273\002\206\360\257\224\373"
+	.ascii	"\001\313\212*YI\332AI\232p\325Tg\302\341I\217\tf\250\001I\250"
+	.ascii	"\0044$#IJ\222\341\200\"\"*\353\006\022 \024M\210\263\b!V%\345"
+	.ascii	"\024\244\234\324s\250\316.H\177o\351\370-\236\276\253\231\031"
+	.ascii	"Z1Z\244B\226\311\bD.\320\022\226L\352\204L\331\241\026\200\210"
+	.ascii	"\306N\231ah\322|\272\274\030%\252#\270\317$m\240\270qRno\321"
+	.ascii	"G\340\033\310\303\370\022\206\376X#8_\367\315IP+-\033\353r^\240"
+	.ascii	"\227=\220\373\363\262\n\204\245\273B\035y\332?\b\263\325\223"
+	.ascii	"\266T\240\310\342\3338\265l\274\360\013\013\212\001-\267\251"
+	.ascii	"\363\262\211'\206\244\017>\337\277c@F0s\345~\216xT{v\304O\321"
+	.ascii	"\220\360\260\343\032j\377\330\367\333\3043\2160b\372k\355\216"
+	.ascii	"\001\320\\\360\233\275\261\241\352\003+\201\322d\024\323T\230"
+	.ascii	"W\210\342\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`\237\001\205\b"
+	.string	"\262\312#*\220\265\351\377\340\307\213\227\216\243g\334j\337(B}\313\312\335\035\255\375\226G\373\255d\226-\204\377\177\346\037\025\352W\366&)\245m+.\360_\227\271\354\357Q\332\232-\371{\200\300R\272\314R\336\216\261q\023\322MZIDA\265\023\344\3618.\313\2111\306\364\201m\340\273\327s\225v\225w\255\237\0015\202\021\364%\177\004\303\366\001\020\0024\376\004\302\260(<\177\214\355(O\276\0317\254n\230\333\3266\r\372{\376\034\373L\333C/\0206 P\0021\314Yy\224\031\264\303\005u\303\373\202\t\004\314\351FG\006\313\020.\242\020`O\215\013\262\342\351\300\216\273l\267M\177Z\300"
+	.string	"K~\3130Y\020\214+\r\002\365r[\331x(\314\277"
+	.ascii	"\251\006\232P\200\026n\\\222#R\003t\r\030\227\215\3533[\030."
+	.ascii	"\267\"\216\356\007\227\031\234%\013\274\204\343\006\266x\246"
+	.ascii	"H\203!\026\206_~r\231\004\226.\3164\324\033\030k\257\242\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375 A\335\001"
+	.string	"\022\304\r\026\220+\035V\206\341\356\356n\203\202\337U\013\316$\240\372\370/\334\001_t\241\373L\347k&3\227\251\314d\"O\307g\334\342\033>\341\006\027x\375R\327\b3\223\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`+\001M\007"
+	.ascii	"\222\312\034\"\220\267\225\003\360\335\335\355\375\377\377\207"
+	.ascii	"w9D$$\"B\302n\352v@\r\214\231\307\273\275\315&\231\002\007\272"
+	.ascii	"\326\323Z`W=\243\251\021\006\n\355\246\347T0\002\007tV\363*j"
+	.ascii	"\3325I\245\245\231'\263k6`\267<\227\023\365\2200\206>\317g\347"
+	.ascii	"<\235]\244\002\340\310t1\245yB\236\211AU\020\224\353\202:\350"
+	.ascii	"\371x:\307\356\347o\302\033\0011 @\002#0\310\354\035\030h\\B"
+	.ascii	"\337@\273\235.\001\301\023<r\327=\201\032\021\260\215\200\211"
+	.ascii	"\rI\303\3014C\032\246x\002j\036W\016AP\002(\342(D\364\351\022"
+	.ascii	"0\230\310\330\304\200\b\0273?a\306@\005\347\204]\244P\200\301"
+	.ascii	"\351R-(\203\365\212\270\316\370\361\036\307n\265k\325\026\030"
+	.ascii	"&Ak\0301`\345`Og\334/\344\222\343\300\260\346\206"
+	.text
+	.section	.gnu.lto_.lto.1a0d73834549a848,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_getSetpointRate.65.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\275\b"
+	.string	"\246P=8@\217\322\001\200B\217\221\326$p,\335W\352 i2\026f\334O\200\247P`?\035\"`\204\206\236\362O\342\243hH\2247\264u\nk\3162)a 6\332&[\246\024,"
+	.string	","
+	.string	"+"
+	.string	"\0340\033)\256\335\235\234\023h.\261\017h.#\310\301+\350\277\344\036\215Wh\"]\001\032v\327\032\232<\356x\333\035\333\f\266Y\002WL]\177Q\331\355x\315\254\213l\215\330\006\355\314\366\304\034\\\257r\213\003vO\251\225\335Epgsi\333O\235\004\264Y\016\031YG1k\263\273\013\276\311O(|\221KW\214\364\341\245?\212\006!\255\222\276\234\235Ve\354\025I\343\207}l#\312Vu\274\352\001\336\272\317\247KP"
+	.string	"i\002\242\220\305\206\231\323\270\357\201\353&\327\315\210\320\0061\271O4\265\002{\022\240oNx\3367\263\325\036\333\210\212\221S\212\030\027\001\013"
+	.string	"\211\231E\306\336\365Yk\031\004\306\214\254\030\013\\\023\203\230\310\243\n\032"
+	.ascii	"\225\246\323N2"
+	.text
+	.section	.gnu.lto_getRcDeflection.66.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\315\b"
+	.string	"\246\320=:0\345(\035"
+	.string	"\226\2334\312\344I \361\223\300j\265\035\325\345a*\005H\253j\003\333g\230T\240\334\260t\247\021\310\300\240\0254\312i\307"
+	.string	"\353\341N\256#@\371\3216\3312\245,"
+	.string	","
+	.string	"+"
+	.string	"\033"
+	.string	"J(1\273;7/\310\\b'\310\\\306\217\203W\320?\311;%\227\3204\272\0068\354\25654u\334\361\2669\266\033l\257\004WL]\207I\331\345x\271\366E\266Dl\203vfwZ\020\256W\231\305\002\273\247\224\312\356&\230\243\271\264\355\247>\002\332\254\007\215,?1K\263\273\f~\311M*\374\220K[\210\364\341\245/\212\007 -\222\276\234\235V\003\330\253\221F\017\373\330F\224\255\352x\325\003\336:\217\247SX\370h\003!\320\305\206\231\323\270\017\202\353&\327M\t\320\0261\271/45\003{\023\237oRx\3367\263\325\036\333\210\212qC\212\031\030\001\013"
+	.string	"\211\231E\306\336\365Yk\031\004\306\214\254\030\013\\\023\203\230\310\243\n\032"
+	.ascii	"\225\246\323N2"
+	.text
+	.section	.gnu.lto_getRcDeflectionAbs.67.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\275\b"
+	.string	"\246P=80\221\322\001\203@\223\265\027J>c\224M\323\271\233\220S\253G\275+(\316\254eH\323k\f\304\205\373\0040\0308A@\346\033\033\242:O\337\b\275\004\253m\223-S\n,"
+	.string	"-"
+	.string	"*"
+	.string	"\0355\033*2\273;;'\330\\b\037\330\\\306\220\203W\320\377\311?$\257\360T\272\0028\354\2565<}\334\361\266=\266\033l\263\004W\354\200\343/0\273\036/\232u\221\256\021\333\240\235\331\037\026\302\365*\2678`\027\245Z\331\335\004{8\227\266\375\222\233\200v\353A#\013Oq\213\263\273\f>\353(\025\276\310\245-H\372\360\322'E\203\030\227I_\316P\2533\366\252\244\021\304>\2661e\253:^\365\336:\020\250SX\bi\002#\321\305\206\231\323\270\017\202\353&\327M\t\321\0261\271o4\265\002{\023\241oRx\3367\263\325\036\333\230\212\261c\212\031\030\001\013"
+	.string	"\211\231E\306\336\365Yk\031\004\306\214\254\030\013\\\023\203\230\310\243\n\032"
+	.ascii	"\225\246\323N2"
+	.text
+	.section	.gnu.lto_getThrottlePIDAttenuation.68.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375 \372\305\006"
+	.string	"B\215/4`M\222\016\f\255\340\265\003u\005\250\313*XV\244\224\332\342"
+	.string	"\312\252U\232a\355R\026\333/\235\025u\330\242`\b\024\002h\r\362\303\271 lk\215l\231\002W\230\352B\2502\257\312\274\206\205\004\206W]\017\0173\260\345\240p=\b\313\272\036\265e\235\206\356\262q\022\337\220n\203\256\347\210?\330\254\322\3753UB\007\260\321\331`h\352\"1\3457\r:\214o\224N\373\342\350\b(z\262\222Y\021R\311\022i\204\343\307\236\272\036\375\300\036\024m\032\236\232d\023\"(\231\371.\025\230*E\r\230*\271\214bE\354\026\244QG\207$\343h\212\226\203\314\0343\216Ew\375\r\376\202_\013\b"
+	.ascii	"2\001\0178c`\034\240k\370n\304\320Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_generateThrottleCurve.70.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`\353\004\215 "
+	.string	"v|\316H\240VN:\247\347\004=\032l\323\205\261\307\213\336R}\214\372\326\361\3410\247\347\307x\373}\t\345\265\353\353~\364m\354>.L\211/\307\313)M\216O3\216\003m\037\245\225\340\240\260\252\377\301Z\263j\t!\204\244\235d\301"
+	.string	"\254"
+	.string	"\274"
+	.string	"\037\314Z\304\204\242R\325\300\364hCy*\016 \370\031l\311\2548\312 W-\276\324:d`z\344=\361\326;\326\303\265y\344\205\340\271\313^?\177\355\230\311T\302\f\353\301\342K\2555\310\343\n0=\002y\207\364(:\207\364h\333\376v\273x\030\243\226W+\202?\306\324Z{\207q\305\342\320k\322\237kfI\216\342\351o\315\345"
+	.ascii	"*\322\204"
+	.string	"RL\256\211\024\304L1Y\211\024\"\004\033\302\026\036:Q\363\305\024\225K\024&qRA \035OX\024\001T91\201\223\n!\n\230r\305\305a\246PRO\364\036z\274b\001\306\305\024\225i\031\241\326\272T(5\345\235\361\356v\355\356\203]\261JA:\254i\354\021\022\265\320\343\032\351>eP\365\334\037\305\202hM4m\035f\2178\273n\366\305\310\230o\220\003\253&Jf=\264\250\345\202\236\\d\225\222\331\0352\321g\355z\214\262\001\334c\355\376\370\370\364\356t\006\363\346\374\345\355)\351\362\234\356\316\351\352\234n\016I\027\207\244{C\322\265!\351\326\220tq$]\032\222\356\215\244k#\351\316\220tk#]\223\244[\236.y\272\343\351\212#\335\213t\351\351\032\210\2042E\207\245\326\250\2642U\312x\344\206\301\354\323\376\362w\315#\301[\363X\367p\330\332xQ>\374\343\34735\357\375"
+	.string	"n\321\234\346\270[w\232\367\312\202h\266\327~;\201\261\362\345m\027\022\253\355\0309s"
+	.ascii	"V\314\327.\030\211y{\321\342"
+	.string	"\265{y]Y\020m\306J\244x\362\2713`\016'\232\266DG\313C\260\302\235ILDK\220\f\371\254\005\241U%\372\334X:\320\356!\316\035\212\210\235<Q\263\261\334#4\215>7\230\201\376\255\342%\322\347>\303\235H\350\214 \2203\361\003\271{R\017(O\324lo\247\021\262\352%\322`\256`u;\277\310v\367i\240\361\273\323\263 \232\370Q\f\210\303\211\246\355/\336A\2645\262\330R\202\265\020\017\030\314Z\253it =\3765\2575\020\007\032\2168\\\311;Td\300@Q\001\005DB7F^\237\220/\311\202\257\250\347+\352e0\032:\352\371\2226\364\204x\026I\003QR\217\003\022RR\3176\254>\026\227\3153\212\224\246;\211\250=km[\345\317\277\205\006\271\347P{\245\347\022\266<Q3\024'\327\227\305Zk5\237\265\016\263YF\313\213\374W\034s\327\035j\367\347\3762\320"
+	.ascii	"\367\374\347v\215\223\213\347\273;\301L,\354\262\324Z\027\254"
+	.ascii	"\225x\311\320\256\217\210ZHT&\f\263s\2362\213\225H\235\357\\"
+	.ascii	"\264r;\233\344\234\274\316\r\254\302y\316sg7\307\371\202'\300"
+	.ascii	"-\233\227\277\271\256\f\230\243\3463\267\371\317\030\260\352"
+	.ascii	"\267\007d\250Q(&\rb\210\031\031\tDF\324BkP\002A\312\254:\021"
+	.ascii	"\3609\2441\205v\003v~\330\271\215;J\3754\233\362\257\301\346"
+	.ascii	"\222\256a\353\322Z\0266\334\372\205\215S\021h\323\022\327\373"
+	.ascii	"\036S\277$@\tr4H@\204\264\306\035\300|\26269\255\277\241\223"
+	.ascii	"\230\200\317Vz\366Dk\217J=\220\241\226\342-\336%\237\252\246"
+	.ascii	"\034,\034\bp\265\225^\256\356\322\025\365\230\004\324n\376i\200"
+	.ascii	"\374?+\324gT5\365-S\005H\347\200\357\252S;\013\335\356\032\347"
+	.ascii	"\244\244\264+h ;0E\377(o\315)\034\204\275\271l\206m\225\372\201"
+	.ascii	"\265\362\016\r\024\352\353_\270\334\364\024L\351q\fL\303\321"
+	.ascii	"\2324K\234\006J\303\013g\233\334\277\024o\2624eb\360\037"
+	.text
+	.section	.gnu.lto_rcLookupThrottle.71.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`\236\001%\020"
+	.string	"\246\337mE\360\260(\035\357\345\210?\231\214\301\016s\025\376?\226eI\366v\201\314E\026\360?\372\002\335\f\240\322W\345\334p\373QOw\320S-\262\211l\354L\271P\237\356\2574\210\227\005\177L\265o\377\223\2667\2212\245X"
+	.string	"T"
+	.string	"Z"
+	.string	"\273\253\340\320\020\272\024\216G\346W\370)\256Bv\233\006\203v?\314\300\330\335\017'\350\016Q\234m\337\345(d\236\245m\304I\004q\242\026\203cw="
+	.ascii	"\037\020\017\363\002\342\241\212\370\3549\363\377r\330\301C\r"
+	.ascii	"\023\024\222\347G\302\356:MP8\334z\333)\333\021\354\374\b\233"
+	.ascii	":\266\215$5\204}nU\305v\372\364\333m\272\355/\301"
+	.string	"4\t\246G1-\212\351PL\203b\272\213\351\017\227\2161\rc\232\213i\205\351\344\322\017\020s\340\024\210\261\273\241'\307\312\2005%~\273}\030\231(\225\343a\377\345\226\241#9\351fh\270\330\b<Q?\261\277p\021\3654+5\013nR\250\0351%U\345\024\332|)\030L\252\032i>\226k\352k<\264\354\261m\no1\353v\367\201/s\026-\237\304\241]#y\223C\177$\036^\021\254\324\320tL\372\333Q\264\324q\350\266\211%5i\336|-%\331\343\224\2711#\r^\255\030\347\020\026\b\b\213\201\003\021\325\351\325\212\251W\252\025l\302\212\345\255X\236\205\n!-o\005\273\340\251\b\330\365\022\201y1\227\013\346\211l{nU\345\244(\232\226\230\244\247\221\246\222\364_\212HG\312\335\324xh0\017\251H\017\354|- \3454\244q\347c\351\364\243 \355\310\371Ltj`\247\026\036"
+	.ascii	"\200\231E\246\275\030b\215j\266\377\f\035\246q6&\020\b\024\023"
+	.ascii	"\020\214\247\\\025\0060\003\333%\203\224\255\030\217\211H\323"
+	.ascii	".\030\267/\030\200\306l\224 \256\211\031\300\212\250\013\315"
+	.ascii	"\022x\2442$*#\240\t#%\305tM2"
+	.text
+	.section	.gnu.lto_calculateRateBetaflight.73.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`\345\n\2055"
+	.string	"\232Y\240\023F`\\R\007;\226o:\030i*|\206V\255n\257\231\230\331\225q\243vU\035\024\250\2256\324H=>an\265\253\317\223\016\336\371\335\304\323\277,p\220bq\200\230\026"
+	.ascii	"*\325wpQdk\355\336{\357\224R\n,\001\n\001'\001l\230\262\030\335"
+	.ascii	"\033ND\277\3350\2364\033Z8\330\240@kK\213\222P\261U\325RD0\003"
+	.ascii	"[-\0321rC\271\2410\260\210\344\t\211-/8\312\266Ug\276\342>\353"
+	.ascii	"\264^k'\f,f\031\r\034\270j6\023\355\025c\327\274\264\340\335"
+	.ascii	"[6\005CmK\206\035h\034=J\241s\267\232zb\027\332V\213`Ff3\216"
+	.ascii	"\266(^\3708\273\254\300\273\367:\265\312\023\210zF/\343h\025"
+	.ascii	"2\f\332V\211e\214\355M\306q\354\273\327\307\225\266{/\024\023"
+	.ascii	"\333V\231\231[I/\271b\216\246e`a\354\031\226\25446\367\336\343"
+	.ascii	"Q\367\254\255\246\315\263\266\372A\372\252\207\302 \360\347k"
+	.ascii	"\331UM\337\257\270\331"
+	.string	"\007IfkM/P.\024=|\266P\005\017-\034m|\300\330\321A\035@\273\0279zn\207\377\2368\3347\300\007\214\033\335\332\275\2701`\354\205\rgk\364:\344\312J\217\356\275NWgt\372\343\232\321\237\366\324y\211\031r\245H\215O,2\332I\373\026W\323\235}p\357e\327\342\202\321\234\323\314\355\314\f\306\374;\006]X\334\241\355L\264\367^\004\334u'<@}\271\367vX\325\332\252\322\007\020B\306\255\245\267Tq\207\261r\351\255\265\\[\355\207\272\263\201\345{\034\\\203s\267\274\272\036\377_\354\315q\353\321k8\003\223\302\3350\333\306\222\371\032\023\273\353z\314eM\377/\346N\357\377`\206\352h\363\223;;\031\233\372I3S\227u/\025\211JIHM\326}\324f\315F\215\326\\D\324j\315C\315\326,\344\316A\356\f\344\316?\356,\240\235}X\347\236\3259\200;\363\2703"
+	.string	"w\336qg\035w\316q\347\241;\013\3359\330\316@w\376\271\263\317\235\333vfY\347uuV\3359m\347g\235}u\356\250\337\263\216\250\314\275.\366\336\\:\365\215HG\273\237t\233u\243u\253u\263\365\312\334\334Rz\216\031\310\"\332\215{JS\351+\3007\240\225*yV\252\030\251\370!\027w'\027\027\364\325\325\266\n\367Vv\303\030\354\240[\022\334u\030<\020\301z\376\351\356-/\300\023\205\330\200\3160~\233\261\351\360\274\361\273\350\211\236\347S8\320\030E\337h\276\246#"
+	.ascii	"\257\363M\357]\234\317\235\007\360Dq\3161\337y\242<\247\030\323"
+	.ascii	"\347\274\316\007\215\031~\316\247Q\206\377\223e\351\227^\370"
+	.ascii	"k\026\347\030\034\246\357'\301gz\037\343\034\003~\360\333\211"
+	.ascii	"'\364\300O\273d\305i(\335"
+	.string	",\326\364\332\377\362u5i\261\026\237Su\350\211~\253M\254B\276\326f\351\033\255\023\254!b\213\277/>\233\276\367\305-\217\256\365\375\357?\316\367i\027\247X\323\314\275\027\305\372_\334@.M\372\006@\236\370C\277\325@-E\372\356b\362|\245\027\372-fN\207^\303\231\226v\322\277\265-B\356z<\364\017\260\324\244\366\223\330o\237M[\237Mv\030\253u\016I\252\357\254\220\274\250Vz\210\326\223.%~\253\365Q\264\275\302\230\225]v\260\267\227&\305\275XI\351\023\337\323\234cM\337\343\377\364\3271N<\377\377\316\212\303\034\232K\353\017uG\026\247\364\315\326\024\002T\034:P\245$\226\037\236\251\242\252\250\254\220\312#\210\245R\271L\006Y)\221\317\\Z%\221SL\251\020\",$\231\302\251e\210\022R\3522D\t\tI\346\232d\256?)+d\005\251\017\034@ }U\032 Lm"
+	.ascii	"\201T*\227\021\222L!#\247\n\024\230\"\220@*j\247\252C\td\312"
+	.ascii	"\311\250$3Cr\352\230\234:\202\350\200T\036\223\314\252c\224\017"
+	.ascii	"/CH1\217V\313%\363\b,\303\352\364\376\017_\230\233\024!\324\177"
+	.ascii	"p{\372\214od\364\013\272\260\276y\301\215\256\315\031\243o\263"
+	.ascii	"\341\177\261\0055\301\240\267 \007\3547\335s\355\353\202+\342"
+	.ascii	"E\344\327z\355\004e|\250w\350\215\247\357\250\323?]i\372\236"
+	.ascii	"\\w[\377\322\270\211\265\301\303\022\006\241Mx\n\023$`\301$\240"
+	.ascii	"\037q\206E\250\225\004\314\r^\033\360\277Xm\3703\327?\350\021"
+	.ascii	"\273\276\322M\003*&\343\b\232\266\322rA\337p@A\257\216\371y\240"
+	.ascii	"o\001\377\363\355\363\002\036(\257\347}\276(J[7\013h\215\337"
+	.ascii	"\177\371\304\232\220i\233\376C\0232v\351\213~\013\257{\256\310"
+	.ascii	"\232\215\211'\005\314\031z\r\262\325\200\342\250a<\346\030b\206"
+	.ascii	"d$\211$)H\322"
+	.string	"\001\240\002\021)\252\362\021\3608\311T\321LPP\222\024\262\261\006\320OY\375\220m\3374\321h\340s,\346N@\3177\264\314\252Y\301n\025\301Y\304\233\321\270\262F{S\222\"\260|,\345\315\267\323\320I\240\205\333\300\352=+\241\f\n\016I\205-\005\2664:Q\260\226\254-b\243\316R#\332\376\\0\342\357\257\221c\031\177\256m\030\265\223\352Ca\307\371{\347p\234\321\222\206\326E?\241I\272\026\303Gn\253\221VA$\377\007\350\216,2y\b\346\330<3(/,\237\t\352&\304\311\320\f\002$\327\212\310E\302d\232\347C\n\246(\270.\236;ctm\232\312x\334\200\036\342\266^j11\363\375\233\302\227\226+\222\325\r#\256\030>\350\020\016\351\210\0264\334\036\266\246\177o\nv\307N\340\333\220\2413\030\006\221\017w\320\262\024\256G\3423\2618.0\363\n\343A\003m\335N\025\241"
+	.ascii	"0,\275\b\336\2450Dg\beT\245\267\322h\271\213-\251_\360/\311\357"
+	.ascii	"\210\253hX\304\203G\350:DM\016\032\353$\237\2240\201D\222\025"
+	.ascii	"\231\216\031\205\2756\347`\300\351\241\356\326\023\266.\326\004"
+	.ascii	"\261\344\202\037\f\232\310\355\353\231\212zI\366\216\373\222"
+	.ascii	"\215\212\004\222\350e`@\374\270\235,G2WE.\314\3506m\236cl\206"
+	.ascii	"\341\313E\267\023\261\250)\372h\033>]\202\215'\354\251q\320\020"
+	.ascii	"\221I\206\"\267\013\030\004\251<DP\004\024\205\030l\210&S\201"
+	.ascii	"\321\341\btZ\220\242|\240\277\226~\314\020\211\276\305)0\261"
+	.ascii	"d\345|!\361\364W\203\023\177"
+	.text
+	.section	.gnu.lto_calculateRateActual.74.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`\331\005\235\""
+	.string	"&\177\334I\220XN:\300\265\362\201\352\315\013\204\236\217\241\214\374\016\203\354\\$\231\025X\200\223\033\025\270\310Pjm\271]\312\273\313\3528\242lZ\337\210d,\n0\200W\202Q\001eO\t\n\371\031\372C\251\017\325\323\255\021\"wJ\001\314"
+	.string	"\257"
+	.string	"\316"
+	.ascii	"\366\226\357\343\310\3778\220\007\371\3225L(\224W=\256\234\332"
+	.ascii	"%EEY\255\307s\301h:\200`\353\311\253]-\323\375 \213\001W\353"
+	.ascii	"Q\313l\r\007\221\207Z\216\rkiY=\257\234\032\026BG\031\224\221"
+	.ascii	"&\033-k\3075\342\007\214l\007\\\255\225\300OG`\032\321D\217f"
+	.ascii	"Sb\205\301\356'\223W\323"
+	.string	"\351\317\334f\232Z[\b\031Rku2\323\356\247m_\307wl\331l\3461\006\r\0352\305\0272L\255\325\327\273O\356\247y\236\334\317\205\361\255\237\346\322-\377\313\2377fh\001\023\343\372i\342&O\314\304\327\364ys\201\005G\314\313l\032kR\342\313\3230\261.Ju\016j\255\246`b$\356\334mC\331\376\262\317-\001'\342\301\247aa\007z\260\016\271\237_\247*'\2124\3166\3116J\304\313\033\213]2\323\273-'\264\031|X\361\242c\314+\302\033B\223=\236TJ\306>r\321%\263o\326}aS\352\245\243\335JO\273\223\256v#\375\370\367\276v\037\031\025\021\r\375\354\027z\362\016\272\362\006\242\324?\224\332\207R\367Pj\036J\275sj\235\034u\316I\r\200R\343\234\372\206R\333P\352\032J\315\243\3244\224zG\251u\224:G\251OJm\236zOjzR\237\211W\346m"
+	.string	"\230ZE\304\225\251N\316\"6\216\366\247\375j\377\332\237\374\225\317\331wE\336"
+	.ascii	"\354\2212N\024\305$\355\323V\354p6\351f"
+	.string	"q\202\366fO)_g\212`\220\366j\275\265Y\244\245\313\232\245Y\233=Z\032\307x[\263\002\274\030\315\314v\312\333\001n\306\262\243\335-\315\032-u\273[\242\266\334\3526@\226\334\n!{\333\333sun4\351\345h\277\366\036\333]\\A;V7\210\213\353\342UkQ\311\334\243\245K\243Y\027\215\363\256\2717\302\001\355\256\211\374:\363\345yI.@\224\222q\320:(\236D\3007\321\"r\033\332+7|\211\326\220\022\312\3445\300\306\234\230F\373d\360H\214\266G\306Y\222\242\275\362\024V\024\315\341G\256v\265\326\004\276\021\020SNTj\255\247\341!\367\263h{d\234\371C\002\302*,\b\277a\016H\214\252\360\033\346\244Na\025\026\320&\213\030\374\020$\006\255\250\200\026\200C\"\025\360\247C\244\002N\001?\b'p\370\005\211V7R\032\250\242\246\246\204\017~C\236\243\244\f\030\220*\240"
+	.ascii	"\370\244c\025\304\2122\375{\372\r/\374\244|?)\037U0j\312\367"
+	.ascii	"\033Z\371\236~,\254\002\016}D\241p\350\2539\326\233u_\030j\212"
+	.ascii	"I\264P7\326h\2036\f\n\2119\264_\321Vc\213\026h\303l/m\257\270"
+	.ascii	"]\376Y\237]\332\323\3158\246\264H\373\323[\237\245f\214f]d\224"
+	.ascii	"\366hJ=\253\364%iy\266g\207\220;\313\2637\232\351\354\316\006"
+	.ascii	"@\032\341rVg/\341Q\256\256\244Rk]`G\035\312\317\b\206\251#c\344"
+	.ascii	"\354\225U\002s\250Q<\304\230a\306\220\210H\220QP\2204\007\300"
+	.ascii	"\002\031)\262\016\021@\275S\354h\355q \b\205'\251\204\244\245"
+	.ascii	"Z\207\253\177(\332\326\262\360\320\221;\f=\343?\222COK?\253A"
+	.ascii	"\005\243\354Q\033lE\227\035\237\304P\245f~o-\312#\243#7b\274"
+	.ascii	"j|'\343\361\241\237\222\310q\260M<\316\241\341|x\036\364)\005"
+	.ascii	"b\027#\340C4\336Q\275\202\275\305\226\333|8\216#\332\326\n\267"
+	.ascii	"\2516\371\376\032\336\311Z\364\343/\n\367Nq\374P\235\211\206"
+	.ascii	"\353<\030\024\357\233 F\b\241\366\214\317QU\007\203O\016)Z\343"
+	.ascii	"-\327;\031,3\276@\271\030\211T\221\r\305\305\2465\325m\311\346"
+	.ascii	"\213k\315f=Wo\030J\363\2208\226.\200\373l\036\204nd\025\\\354"
+	.ascii	"=T\303;T"
+	.text
+	.section	.gnu.lto_generateSetpointRateCurves.75.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`\235\004]\036"
+	.string	"f\366\276I\220\232Q:|\205\265\316\200\020\006\205\252\275\264\tlP\007\\\2539\231\361@!\233\024/\255\214\017V[\037\332\372\031\240\303n\r`\334\236DbF\\\207\274\252\216\030\235\270\377b\020m\264Nf\032\371\313o\244\221\275\345N2\253"
+	.string	"\243"
+	.string	"\256"
+	.string	"L\245\354\005K+#\026\327\2757\347\226\031\224\2677/@\336\326\017 oo\n1\217y\361\351\302\206W0\214h\356\275\266\356\301\314\264\007\343~-\236c-t\231\031+a\244\255M\205\3700\236\251+\210\342\362\023\366.+\221n\326"
+	.ascii	"[A\033\025B\002\"\301\0334\226\200\307\221\322\313\332\341\214"
+	.ascii	"\326\267\202I\025C\324O\307\253N\201\302!\n\033\202t\362A\030"
+	.ascii	"{\365:%\310\361'\254\361Z\013h\355\020"
+	.string	"c\n\211jmi\313\f\246F\302\027\264_\274\035b\221i:R:\205\361\334{\231\376\204G\347\331\231\271\f3{`\256\034\002o\263\373I\021\221!\372\305\266\337\365L\021\227\217~\361\257~\243S\251\273\270\244\244i\316\261\300\344\243^\374\342\253T\023=il]\352\305\\\354\321\0362\377Y\216\fq;1\333\320f\267:\233\262\033\317\344\251\316\366\304s\255\224\273)SJ\371\001\314*Z:\307{e|\251\271Yv\212\220\033\177\253\237\352'\2762\037\007K\215\317\204\337\344Wl\342d\261ra4t\242\241\213\221\217e/h\340\327\345\311\205c\215\277\204_\025\205\n\313xV(oq\252j|$\374\"\233\2678LjOr%B'\006KCU\337P\203\231\203\216\205\217\r\2309\305\257\200@\360t\357\245P\345VB\360\rG\377\303\221\267:>\222\244\220\315\343\243^\324\213\234\242\345hF\230\256\003"
+	.string	"\247\024\205b\3041e\t\234E\266n\337\370\233\0315\2736s\017\t\372\337\254[0\275\350\036\0238\207\224O7x\357u`.e\365\350\232C\001\221\"\326\003dw\212\252/D\264\213\231}~\334I\340Caq\242\274\367\036j\005y\333\035S\302?\357d\005\037\212\201P\320\377n\371(\310[\3326\037I&\016"
+	.string	"\347\215-\263o\365\033\337\361\227\031\303\327W\031\242{}\013\002:\021?7\037\237]\006\034O\226\013\272y\310\225\030\361s\213\365\234o\272\b\021t\020&\344v\004"
+	.string	"\365\250\270U\306\355\340x!p:\033Ng\373\351\271\371\330p< \333\216\001\336\231\310\361lA\273\035\317f\026\357\333\211?\365\362\264\222\345\353!Y\017\371f;1\355G)\353\006Cs^\033\370\340\025\251\251\366\211\344\027/\300\230\254O\254-\273\024\220\006\2652\242b\224=\344\030\026i\323\366\207\231s\333@\246B\332\316"
+	.string	"\206\210v=\307\211D\365z\357\275\260\036\362\207&\226\326\277z\314\214\026\243:k\262\201\3146}*\235\333\266\351\027\005`\250a<\210\030cD\204DDR\2204\215\001`\002!dF\335\021\3601##\321\306\032\t\223\334\361\362\025`\317\rb\230:{1\364Hmrpo\027\236\031kO\022\201\325\314\032\215\305)2-A\232\210\372\0376H\210"
+	.string	"\331\237F\360m*\316\252\303\263u\241\270\220\341\037u\277I8\273%\251\365\b\374M\242\313R\267\013\337\321.*!\013\355"
+	.ascii	"\315\226\f\371\n\357\"{\214}1\022\360\030\303e\364DaO\265\266"
+	.ascii	"<\026\372\226\235r\202\020-\233U\203p\257\320,rnA\266A\330Z\006"
+	.ascii	"r\006\367<\236\231>m\n\032K\371\360\231`\2079$g\037\310<EH\337"
+	.ascii	"? R*\007\237\203\302\311h\217f\310\357Q\2222-\346\017"
+	.text
+	.section	.gnu.lto_generateRcCurves.76.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375 \352\005\006"
+	.string	"\362\212(0`M\323\001@\234\236\202\377W\240\036\207s\203!\361$G\340\311m\177\302\317\377W\351\222\306\023\tR\002*\001>X\202\002p\273\265`\233\2242\005v\215{\004\316Y\347l\302A\001\302\272\267\260\215\305\217\202\301[\206\347y\333\254\243V\003\"\030\204J\r-D\323vxH\234|\2214rj\200x<Gl+J\255\260\221\371\177ke3-\353\330\215_\242\204\344\330\204\003\30366C\366\007Z\027\307+\213\270\262\377\253\026\baBF\314\300\312DE\230\024\201\377\316\211\232@+\332\006\260\035`\233\"\n"
+	.ascii	"3\001O8\003\306W\240\335\234\020\253S\f\272\f\3622\004\270t\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_calculateSetpointRate.77.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`C\007\355("
+	.string	"JG\240\017Gp\\N:\377\352\360\2633zZ_U\353l\206,\327\274\235@E<aRi\204\345\235\231\bQ\336\260\263\330\244\313\2047X\357\017\210t\275$\353O>\315M^\355\275\311P\365\316\f\365\036C5\214\330M\210\334I\006\342"
+	.string	"\324"
+	.string	"\344"
+	.ascii	"\306\377\354O\373\325\376\265\237\355\226\371\237r\264[\371\225"
+	.ascii	"c\371\221{\232\326\260\301\240B\1776\315\255m\365\272\202\356"
+	.ascii	"\227W\021\211\b\242\332V\221\210\214\016`i,P\0274P+h\3000\240"
+	.ascii	"?\t\354\240\362*\\?k\361\233\322\330\025\255\314P\336k\244`D"
+	.ascii	"\t\fqb62\022uA\303(E#\246\274\367\"\370\311\017\320\237\314M"
+	.ascii	"oN"
+	.string	"\257\314\177r(\\\217\302n\274\2737\b2\313\2757\001\027@\177\366\316\263?\315\023\331\237\314\305\314\346\306\262\253#\273\343\2056w\357\3655\221s\335\236fW.\376\217\337\025\303\\\334\346\370i:\215\205\271\001\024\226\232\2747!j^T\363\306\333,\360&D\rPX\227)`,\314\215\037_\277\302\210\265\352\"\334{\271\026\303j\234ug\346*f\356\301\254\203\n=\220\2760\322\250\314\313\210$81\035H\375\265\367\206Hs8\2720\262(\r\227\273\221\370\001\201\366\347\200\"b6\216\372l\357\r\221'\306\350\221\274\fa\271Tv\335;l\252}\324\365\230*!\326%\277k\237oR\345\260.5\\K\020\275\3676\340#\237E\212oVU_\374\311\257\262?\337\006\340\266\f\353\222k[X\231[\3510\033\211\265\311\230o\336\036\302\314\324\373\331y\351ig\245\253\235\223\276vF:\333\371\350Q\376"
+	.string	"7\236yg\345\242]e\"[y\310V\026\262\225\203le"
+	.string	"\2652\020Z\371\007\255\354c+\367\330\312<\266\362\316VFke\235\256\262\325U>_\331\264\225\333V\256g\345\023"
+	.string	"\312\362\346[\336;cY\347&\317-G\036rF\232\251O\310\201\325^\363\372\313\347\031,QGU\201\343\2479\\\006\276\031o\340\300\301\376$j\243\"b\303\343{\300\234\360:\302\320db\352*&\215\363ikr-o\336\2004\222\231k\323Q\227\250\022\246\253\316\341\332\266\244\3277\0165\332\275\276\230tL\250yz\250uG\264\001\264P\037\255I\221\020K"
+	.string	"\370\351\245\006\272\223\373\364\017\324\317\366\351"
+	.string	"\307tl\327I\315\323O\221\354\332\242\245J\276\031\024[\250\031\277E\377\213\207\355\245\326\365S&\346\031\214=\333\366S%J}v\237\361\272\223d\251\177\366\017@\376\346!\251\254\230\374\220 \315\230\223\001\021B\204\b\373s\251\253[1\307\017\245~\332\227g7k\266R\337N\352&\251\315\356c:\306GR_m\250;i\353\025\251\273\217\320R7\304SRTS\346\226\360D\363\324S\326\224\326\317\312w%\264\262\022\002\005hY\375\232'\253\204\204(\023W?++\341\004 \326\317\225\220J\213*K\210\002]\0214qEu\006U`\245"
+	.string	"\236A\255_\207\340\t\251\253\337\216\177QPPQ\n\030\004\237\204\262\250V\374L\006>\001\261H"
+	.string	"\243|\300(\337\025\325\317\312\007\304\312\362=\031\261\020E\020\313\247%\024b\371z\214\303kI\016\233\310At\346\220\250"
+	.ascii	"l4\271\367\224\377\361\367\001&%\351\346=\035\324\026\016q\356"
+	.ascii	"\274\356i\256]q\340\274\211\003g\351\205\0169I\243!rqprq\002"
+	.ascii	"\310n\003\375Y\333\244$\207\\\275.\3435spD\371d\356\200\030'"
+	.ascii	"[\257\264\3606\2144\215\327\214\bM\314K9\367\223\265\320\237"
+	.ascii	"\265M"
+	.string	"\212]\022\344V:m\213zMpA\231\032\251\013U/\306\361\272hL\2026'7R\034K\236M\3067\013\200\240\250a@\250\224Aj\210DA\222\222\202\244\003\320\002\021\031#z\020P\310h\222L\007m\302\240\353\237\020R,\207.\225\202G\\\035\310\341\340d\343\222\207\213\361r\177\227\313n\313`\261\375\2612\345~\343[\226\303na\3649\244\330\353@\227}\274\226\317`\030\025\026PY\343\336\tH\f\226\036\345I5b9\267Zz\02195Cq\374e^\t\226{\357\276n\331\326\250/\026Pb?@\320Aq\b\262H\f\231\323\211q\213\366hB\230\312\001`\342\376x\311\250\205\220\r\006P<\306\003TF\263t\364\374\365Ex\016\360\332\250t\233d\245\f\023kl\207F\236AA=U\361V\225{\271\020\005~\2370\237\311\017k\220\3112\203\fh6\357\270\201\020\355+\376\215:dz\320"
+	.ascii	"\265v\257\013\236r\n\207\n\031\317\204;Anh\311\215[\360\340d"
+	.ascii	"\230\334\034}'\260\227\242\354\023\034\276\2227\r\331\302\022"
+	.ascii	"k\f\\\021\231\201\212\367oT\241z\t\203\003\230J\002\254H`\305"
+	.ascii	"\335\267g 3\345\306\020(\243\002\236\252\024\262\021\3307\305"
+	.ascii	"\302?"
+	.text
+	.section	.gnu.lto_scaleRcCommandToFpvCamAngle.78.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`A\006\325 "
+	.string	"6\271\305I\260\326M:\024\334x\301\323dJ\210\033\334~'\346V\013c\312\261f\212\023\272\354,VY\013\026H\243\266\372\037\315\204Y\241\217\035\376\276f\224\357\224\177\250w\220\363*\306`X\357\364i~\374H+.\304\326\310&r\247\024\246"
+	.string	"\245"
+	.string	"\267"
+	.string	"\3444\3148\375B\247gtZF\247Ir\232\322\351\221N\3578=\307\351\357\274\210i)y@\244\326\024\305-\225H\261l<\370\013\277s\316Oj\377U\267r\314N\225\320%\256W\253&~\301\033\020f\247;?\016<\307u$=\350r\246\244\302\346\343\252\n\253\265\"8u\201\331)\3569\344\351\370\033\362\324I6\224\013iTYT\215\337\325\225Zkn\243\236\364qg\222\177\253\277"
+	.string	"\231\224>\262\370\2168$\304\037\215\2517\336\236b`\271\325\247\t&\336\234\262\t\265VO \323\212\233\3366\005\333A6\371\013(\270\234\220Q-\241X\254\322\253ui\207\\\331\336G\305\233E\323%w>\361\205}\351\322\254_\227\261\357\217\361\n(&3\234\362,3\212>v\241<\367\313a\207\223\336\314b\277\307}\374\370S&\021\024D\236\316% \345d\017\375\252\303\254\326\036\003\177\307y\024\371S\247\336\201\230\007\236\372 \310\323o\217Wpi\026M\013\323\242\035\231C#K\352\324b\013ys\241\354\217u\237\354\007o\334\205\367\215N\353\320i\033\235\316\241\3238t\372\206N\333\320\351\032:]\243\3234t\232F\247g\350\264\f\235\216\t\266\247..\257.."
+	.string	"P\033f\247\002R0\021m\326v\022\256'\254S\017p\004\311q\305\300\326\001:\337\304\302\231\270\034\205u\352\346\312\311\347\304s\352\t5K\2636\273Y\276\033\270\255m\315\022\244\332F\270-mi\210\264\345\221r*\231p\373\340\265\236\304\345\200\256\255yg\221\247\270\342m/|\003\031KSK\202\037qy\243Qku\340\027\271\221\013\0302d Oo;\343\2055\207\\\306\231!H\036\316\003e\326\3260\023\26320\033\363\2620\373_\027,!/\313#\025\2642[\177\370\322\345\b\017=\334\002\212\325\246lm\037\335<p\266\270\336*\331\345\003BACB\243\210\035\321Z\250'\204\320\221OQ\316\303\256\250h\247\003pT\344\263DD;\243\321>@\013\026"
+	.ascii	")h\360\323S#\302\007i\255\353\321\031m\320\001\345t@"
+	.string	"9\017C>E9\235Q\210\\\217\315\273\017?F\271\243\335\316(\027#\\\372X\367\311\025Z\020\227\226\347q\257X\231\\\250\210IqQ6M\371\3568v\235\335\036\330W\027W\200\262\211\250\263f\362\213\252\021VkE\200\263-\316\352\354\002\361\301\340\325\326\266\262-\037\025mq\226^\371\250xeS\316\206\271\304\211\262W]\307\275\311o\365\277\360\372\315\346,Y\205\367\3446{\263\236>*\274Y\354\201}\215\201}\335J\350\260\020k\r\200\202\250q<\307\f#S5\023\244\240 I1c\300\002\021\241\242z\0210)\224nf\026\030\264\036s\2628\002\254\177\226\321h\252\330\365\021U\356\273\231:\266\370\302\340sQF\302]\253\026e+\016`!\020\fE\004\311\007S\246\022\354\213x\276\f\346\225x\210\025W\3013ps\363\0072_GKJ\337\235\375\362j\022D\321\367\271\216\246`\311Z\370\264\210"
+	.string	"\007<\322\367\320g\266l\313a\r\364\263\371.'\344~.\343\262\251t\027\007\233\356.\266,\263\360\265\302B\327\372)x\025L\221\021 \004\344?>1\236\307\316\275\242\241k-X]\277\037T\006$\252"
+	.string	"\205\246%E\0015\3164\344\302\373\301\004\335\215\354w\375\240q\214\332\246\035\216\237=\236'a\204\267\304i\201\323\266\007\307\241&\362\263\311M\205\207\214"
+	.string	"\211r\216\202\315\363\205\221\25129Jn"
+	.ascii	"\f(\366K;\247|9\005\202j"
+	.text
+	.section	.gnu.lto_checkForThrottleErrorResetState.79.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`o\007\245)"
+	.string	":I\360\017Gp\236Q:{\334\200\340L\345\205z/\347n\301\025\252\267\f7d\300\372\2021\277\200\0328h!\330^a|\317\307i?\177\177\302,\20500\352vi8\200\221n\025\203\177\260\02282x\260o\215\020B\310\226I\006\354"
+	.string	"\327"
+	.string	"\352"
+	.ascii	"V\273b\362\")@A\203\202\206 \206\203\356\203\255\370\026^\232"
+	.ascii	"\311\213\034\352\241vd\262"
+	.string	"\300x-+\230q?\177*\347\272\327\2610n\351\313W\325\256\030t\213A\304T\245\261\362.\253_\251R\257f\250^m\306L\251?w\346\322\233*.vk\320-\032\311 \371\240\376\\\312\343\2009\351B\275a\352\261\215\0339\367\336\004?\371\202\372\223yi\211\203n\346Cy\024\253Ky\301\347\275;\342\204\335\233\\\300\005\324\237A\007\200\376\354\023\241?\331\212\031\316\223Bn\352\2454v\241\335{y6\310\255~\263\251)z\232\266\255\370i\005\333\021y\365\033\001[Z\201\007\r\034W\311f\334 \240d\306V\2476\216\032\263\372\324\272yCj\335\002!\213\346\356\336{,o\030H\254\356\264\302\275\227\373\210\244q\306\235\231\2030\263\021\346\024(dw\354\327\362\342S\343\254N\321\275(\370\303\276[\355\301\276[y\315y\211\266\265\313V6\031`\377\365\335\332i|;\300\276\217Qm\3555N\313~"
+	.ascii	"E\262\267g\237\254'X\275\306\272%:%\255LBv;\2159\211\325\366"
+	.ascii	"\007\363\315k}0?yf\262\315J\2669\351_\347\001\227\362#\331\346"
+	.ascii	"\243\237f\243[3\200n.\352f\242\\\363P\256Y(\327\034\204k\326"
+	.ascii	"u3P\256\371\247\233s\270f\\7\337\272\331\2466\253\267\346TmF"
+	.ascii	"\325\346\363\326l\332\232m7\267\332|\003\327\241\206+\006\205"
+	.ascii	"\265{e\254\361\271hN\261#O\376_O\033m\223\371|-_2\343x\305\263"
+	.ascii	"\360\271\274\313\307\322\036g8/b@\274\210!\251!\022\246\304\021"
+	.ascii	"\2464\342\002\242\006]P\373\203\333L\262/\222\306\305*\331#\013"
+	.ascii	"#go\326\004\327\231VN\301Yf\226:\035'%!r>'\203\n\r\375\243\206"
+	.ascii	"\256#\235\265\327\232\016\307i\002\377\315\31760s\360\340\001"
+	.ascii	"\375\211\263\020\314\304n\326\315\217tl\366f\237\225\003\253"
+	.ascii	"\315\313xI\305c\375#\217\241?m\326\300\220\2555\312\221}\025"
+	.ascii	"\363Tm\222\3552F\265\225M\nUMj{K\233\250U\2627\252)\370iQ\333"
+	.ascii	"e\262\324\260\030\304\323\274P\357\275\021\370hX\210P\213\240"
+	.ascii	"@\177\236\326&\205_\346fP\360\213\360\b\022\375\343O>\t{2C\266"
+	.ascii	"\326^{\337"
+	.string	"{\257,\007Qko\204\313M\261\367\260P\357\356K\240\314=_\377h\355\273\354(\332+n\245\023\262\234\375\025\346\203\275,\r\211\0369+\230\267\315\331\237e\331\3719j-\177\313\202\f\300\023Q@\263J(e\031\330D\005$\366\202\274)a0(\364!\021\203=K\345\244k\321sj\361{\232\212R\237\244\204\300\017.\210Q>\241\324/\304O\212H\024\016\201D\001O\277_\n\017OS\275`Ph\3017\004\342\036T\203\006P\f$\374\232\204~\304^\007 \325o\b\365\353\320b\370\303\276&\337\260\204\017\212\347\203\342ME\365\202<\337\220\212\327d\304\302\024\277!\217(\024\016y\270\344z\363Z\037\274a\016\232\325b\361\215\225\347.\336\2732\351\314\330\224\332\3102[\270\320?\362\216\031\303\373\2602W\366A\304\203\262{\257\221\315\231\245\001\260\017\314\266\306\250\366\007\027Y\"\233\304e\346\310\026\331"
+	.string	"w\206,\021\223\035\262(X\326\2360L\366I!\313\024d\177\254\220M\273\262\220\330 {\023\327\343\244\242\351\254M\f\017\220\375\322l\013g\177\354yfT[\246\tnGWf'\247\f\200\233\250A<\345\030R\n\321\214\244 )J:p\002\0311\253z\021p\261t\310\302&7\003\200\321\246J\022\377\"%\372\376s\0230\317\021F\332\235/%j"
+	.ascii	"F\272V&\323@\334|2\223WZ\032\367\254q\330\023y\340\022\200\016"
+	.ascii	"J\330\207\035_h\203\361RP\344p\207`\337\226\224iKi\252\230Q2"
+	.ascii	"\034\005\004l\212\224\017\242\361\235]\270\207\304\005\363\366"
+	.ascii	"m\363\254+\200m\235\344\275\212\370\032\b2\3418=\343\022f\225"
+	.ascii	"\301h\025\234\003\255\037\214\254\306\2531\302\345\273%\266\343"
+	.ascii	"B\r\244\202x\267\375(+\3055\303\334\264>\026&\236\033y\332\355"
+	.ascii	"HZS@<!\036\020\340;\016\250,@{.\223`A\t\255V\310\rN\255\004\323"
+	.ascii	"g\327\371\334\266r~\374\b\361=\347\216\254\177\223\346H\244H"
+	.ascii	"\250=l\030\313[\237\250\347\311\220\216u W\331\234\245{\244\202"
+	.ascii	"\274\3066\361+r\272\217\264\033\225\361\240\225\037\r\230\227"
+	.ascii	"\224V\341SF\034X\263\355\323<\026\215n@S\350\220pLUc\362\364"
+	.ascii	"\207\006\316\025\264\354U,\225e^\377\351\036\235\275\311\230"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_getRcFrameIntervalUs.81.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375 \366\305\006"
+	.string	"\002\215/3`O\322\001p\001\f,5\244*\364\241\235i{\252|\035\n\271\320\r~kv\333\341\270\002\320\344_\264\006F\223\340\332\372J\231\037\334\235m\357&eJ\001v\034\367\026\\\247\271N\203p`xh\356I4N\201\247\210\206\327&\246\3515)\356u\224j\020\322\n\373)\217\320\0271\205'O}\371\036\366\225\n\020\262\021\312\312R\307\246\214\035A\251\036\3665\253#\333\351T\001\222\027\005\230]\214jf]V\313\210\355\217-\371&?\371\030f\004\311`,\027\026*1\273\261\005\234\200}\345\007\330\227~\034>\241\177\224kJV*J\004zn\022v\327I\2114n\275m\004\333\007\2669\002\b"
+	.ascii	"2\001\0038\003Z\034\240k\370m\304\310B\344\341\256\230\332I\006"
+	.text
+	.section	.gnu.lto_updateRcFrameInterval.82.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`1\005\305\037"
+	.string	"\006w\303J\240\330M:\301\035\3114q<I\227\335\367)\0164\244Y\250\241 \265s@jg\021##\027I\252\262\207\234\367\363*:\027\251\305^\217_\013\330\341\303\327"
+	.string	"\227\026<\354\210\225\3249b\311\352\206o\326\b!\204\220M\344N2\251"
+	.string	"\245"
+	.string	"\260"
+	.ascii	"\300?\021\371Y\ro\231\302\243~\230\321\333\037\212\321\003%l"
+	.ascii	"\230\203!J\021F\345\020\260\031a\367^\006\267,\241\274e\246\211"
+	.ascii	"b\363\312\374\247\367\b\272\017 6\357]jbuo\320\001#(ogN\033o"
+	.ascii	"\305\007\030o9\210\231\312\203M\227\224\241D$\034\336{o\035\343"
+	.ascii	"A?\315\222\034\255\3305\210\177\002E\374\2441\311\233%\023I/"
+	.ascii	"\275\214\220\216*\271\342\343\317\216\250\342\fH$\316\334{Q\340"
+	.ascii	"Pmq\201R\023\0243\240O\244u\275\220r\250\323\3400J\252\225\274"
+	.ascii	"\271\367r-\002\2328\243g\346\032\314\254\201\331\312\002|\032"
+	.ascii	"\fbW_\264\033o\337\td\034\t\325\224\001 \001pu\250\237WF\274"
+	.ascii	"n\335\302\034\364\325fb~\247i\232r\303`6+\333\306\312\265\373"
+	.ascii	"\370iee\231\262rLY\031\306\254<3+\277\230\225eee\364\254|\236"
+	.ascii	"\225M\263rYV&\315\312\243"
+	.string	"Y\331\232\225\305\262r\223\225\353X\371\006\002\260\350\232\220\336[\"\345r\271\354\225\r[\305\312\217\272\020f\224\177\376\203\017\344T\246T\326p*\310\217\251 X2\224\027J\001\315\f\005/0\002U\330\323\360\336 \203[\005;l^/\374\271\024\220\030\274\001\374$W\202\343\001\207\033o\315\236\311\256\304\370H\217\035M\266\231\312\036\373T\242\266\310.\373Dc\r\336Mv\003\341o\314\366\330\005\272\374\206b\333\332\366\177N\335b\023\310\372\233\264\204Y\211\271\261;'*\n\037\353Gr\272\013\027\306\333n\031\330\321\225jD\254\253E7\023\327\261\257w\030k\347Dm\rU-\f\223\246\303\243w\030k]\273\265~J>&^\267H\r\214E\275Zb\353\007\247\204\277\221\302)KX\255m-@\214hL\250i]k\002b?'_M\371Bn\323%\252\233S\222H\270\270\322\237\242\365\205\237\021z\325\211"
+	.string	"\0059g\f5:\336\316\347\266\303\303\343\361\344\006\340\336ca\003\356CO\347\263\263;\031\247cc\243\363"
+	.ascii	"\202\256F\246\307\202\216\267\253\240\343\341z:(\347jr=\234\234"
+	.ascii	"\316-\247s\333\331\341x\267\\\257\347VSc\036\016\272\336"
+	.string	"\315\207\207\247wC\203Bo\030\3147B\355\023\257\314W\255e\272\265\220\314\230\206Rd\005\246\321\216\2315L\267Vy\316\032_z\326d\227\037\017_\333\372\005mY\333,\2421\031V\212'UU\251(Q'(\326\t\257\2133r\321\232\260\244:\220\216h\220\315\224\365-\333\027\226-\020\270\252\344\030\315\343\214gK\320:\233\311\237\024Y9\316h\366\331\377)\005s\250a@\b\021RT\2448\005)\024\206\003\220\002\031\"\253:\021\220\265dE\322B\226\003\024\033\n\220J\326\251\265\273F\2226\t(\231\004&P\275\271\311=\242*\316\"\203#\023\204\303\301`\246\363\232\323\022\306\367\230N$yb]\313m\376\241\021\371\3021\321|\300\275DD\003p.\025\210\335\212\023Y\3137\001\0134\246\260\323\206\204\230&\373\323K\342\220\362\271\247\207p\025\334E\342\377\372\245\223\260B\203\3222\314\237\0348\234\367"
+	.string	"\331\f\330\027\031\002\322r\006*J\314\211z\274-\333>\200\353s4v\207\266\005#\353\t\207\336\311\\\315^Bk{U\f\311X\022\217<G\323\031gt\2344\\\031Is \215\370\206\343\221\"\341\344*\202}\312\225\342f\352\217h\020fv\237\373"
+	.ascii	"V\003\272\272\025]\351-O\r"
+	.text
+	.section	.gnu.lto_rcSmoothingCutoffHz.83.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`\326\005\r$"
+	.string	"\272A0\016F\220\234M:I\262A\226Iz\335\336x%"
+	.string	"\221\331\261\002\200\366D\003@\254\322\013\n\371G!b\361S\363.\327\003\277\306\026 H\301O1\327\215:\243/w\0071\363\361\377\223n\253A\324\2104B\b!r\247\024\316"
+	.string	"\303"
+	.string	"\317"
+	.string	"K\277\345Sy\026\212kY,\fV`"
+	.string	"\037fS4\352\324Z\027\\\364Qy\261(\364\247\240\260\317\213\324N\341c\3714\322\272\375\212W\326\257\322w%\214\233Z\203\n.\372@y\321\207\362()\314\243A!?s\310\027\337V\235Z\2038"
+	.ascii	"\267\215\027\351\005\214\0277\310y\257\235&\255$G1\\\312\363"
+	.ascii	"\311\243\260\311\026.* \324k8~\206\tt\210\211q\262\337\215\320"
+	.ascii	"6\346\243\315\273n\224\344\207\203\232F=`\3308\215<\352\001\243"
+	.ascii	"\306\313'\371\321\240d\215/\037\035g\\4\2013\036\206\266\027"
+	.ascii	"F\250|\200*\302\004n\300\350\374K\212.\331\317FXTk=\326i\025"
+	.ascii	"0\212R\362\250\326jJ\005\204q\367\334\266\027\333N\266\b\025"
+	.ascii	"E=\212\307_\333~\216\317\314Vz\227\016e\255R\016|.\017k\362\213"
+	.ascii	"\\\264\007\035=\225n\274\370=Pv\325\243g\246aJ\310*\305c\007"
+	.ascii	"\243\350Z\331\017k\255\325\373\3036u\201\245&\032\n"
+	.string	"\251\205Jj\002%u\220m\251\201J\352\237\220\332\347Ww\317R\327\226\372$\251M\222\232FR\227KM.\365\270\324\342H\035\216\324;RS\221\372\006\004p\031\253\340U\353\213\263<\325\214\310\345\310\257~\373F_7\177\3714\002\3632\341b\205\030\246\362]\366i\024\017\372U~\345ZVKN\223Z\353\231\005\013\220,X\204\316\344\254p\331\260\3025 kC\212\"\251`\005^\350\nFQp\021\201\213[#m?\365$\352g\216\006\tC\206\f\343\305r\035\f\301\272\031\006\326\263G=s\255\214t\247\024Z:\222knb\374\330\215-d\270>[e\017\221;\264t\\\tRAr7\315\324\223\360\026\033\305\035\367SI|V\\Q\314gV\013\203\342\263\367\272\210\035=\212\247F\023Z\263\fY\206ec\264\304\223ke*\006-\204'!\201\375\331\252\335\370\263'\013\307\265\002\363\335\240%\032\343"
+	.ascii	"\324\326\260\201\236jw\304\332\021\265P\324]\2444\021\"\222k"
+	.ascii	"\316\033\351\022\330\373\242D\321\263\237\b\025\256/\341\305"
+	.ascii	"N\327\307H\026\033\337\313\277\360\374\"N\312\3456B\031\215\177"
+	.ascii	"\375,\302\234\320Z+\324\2327\332\226CV\231\024\275c\032\306\304"
+	.ascii	"\266\277z#\220>$\225pRz"
+	.string	"\002\321d2uhb\nM\354>\254\231n#\230\236\222t8\020;\235n\227\023z\322%\255\223\226\0324Xb\360@\351\006t\202\302\322\322\356\211D\256t\356\226s\332\220[\302\345\226p \232\222t\270\234\323\b\334m\200w!\224\234pO\273\235\023\356\264\355`\357a\335\037\266\260\344\004\332w\235\266\003\354w\346\205y5'*\260E\275\2152\321\026\260\375\255\037\353\345\233\034\325\216\233\332\271\265\005Z\323\267\240\212\301\002\t\034\2609c<\316\265\242\r\271A\2066\264\307\372\204+a|^\324\266=[U\346\265\345\2205F\212\336\361\273nb\001\222U-\277\f\256<,\220\3049\367Y\304[\251\355\267^\324\253\355\315=\367i|fg\346\nuM\311)\367\207\307\357H\001t\250QL\245\fR\206FDDDf\232B\007p\002\221!\273z\021\2601tU\232v\003\331\030Y=U\217\305\264\020\270\344"
+	.string	"\3714\022\317\031*\226\330\216r`\f\332\236\255\025\303P38k\006A\260\2021\322\253\267\367\t\246h]\200w\030b\210y0\333q\034\247\306\002\006\223\310\213\344\200O\236h+\333\nf\006\001\221\363\244\322QA\004\017"
+	.string	"\201ja\201+\253wi\243&\026\0236\273+O\257p\327\200\r\016\342;<1\2479\365rJ\007D,0\271\236l$8 \222P-\221\016t\f\310\267\341\354\t,\212\363g\302\345\273\275\243+\333k\2315\275\330\223\375R\211\217\265\306\256-r\332\240\311\306\335ZHx\b\006\273\"E\330\271\365 z\304`:\234j\251\020\243\367\210\342\345"
+	.ascii	"\223\354\020\261e\226|\307\033\252\247\t*\3767\346\341\017"
+	.text
+	.section	.gnu.lto_processRcSmoothingFilter.85.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`\260\027}h"
+	.string	"\372\245\270$L N\323\032\003\277%\244\276v7xUp\357\206/t\377{UziJ\346\200\311\333.\230\220)4\376~\025\221`\0306:5iL\345\007]\350\350\255\004\006b=\362\301\207/\245\220\353\362\273HE\214dQR\354&R\312\224R\n:\002"
+	.ascii	"\002=\002\301.\323\f\frf\213\316k\321Y\035:?\321\331\207\316"
+	.ascii	"\255\201T\336\223&\317\276\257\003}\301\376\374\274)\254sZZM"
+	.ascii	"\267\\w\264\373\255\273L\267[\367Z7\264\201\\\350A\007:\353\253"
+	.ascii	"\0071w2O\0247\035\267\224\207I=u\032\004\265\232\310\257+p\364"
+	.ascii	"\256\350\254\251\363V\006\356\215\336\2329\036&\333\274a\r\300"
+	.ascii	"a\223\306\347\026\305\035\307\235\206\207I2g\032\215\333\321"
+	.ascii	" \375z5\205`W\304\350\335\b\366\312\320`\362\013\034\017{M\242"
+	.ascii	"\275A\233\336@\323\300@Pf\206\207\311*\311.\343\333u\245\311"
+	.ascii	"\226d3\212\333\004n2<L&i\353\023\334vc\272\240V3\370\006\007"
+	.ascii	"\202\336\373\276\f\250k\263\365\030\036.\361\2218\3416THR\013"
+	.ascii	"\372\202=\300&\rU\260\327dWT\247\265\232\333k\035$\267\240o\223"
+	.ascii	"\206\233\2744\276\367\205*{e\247`\257\306.b{\365\036b{u\231]"
+	.ascii	"h\250\331\013|\366!\342\306\367\276\257\324Wa&!UU\217\206\374"
+	.ascii	"\255B\233U\326\355\016\034\232\230\222K\0334(%e@:2B\026\021\r"
+	.ascii	"\t\035\215mP\2218\004\022\006\201\354\252\276\223\273\334aZ\335"
+	.ascii	"!\2569\304\215\201\363\246\2675a\234\t\205N.\231\351\rlk\256"
+	.ascii	"A\251LL\255\223\360\232iR1\236aM\203\260c\203B#\241\315i\361"
+	.ascii	"#0m4\327LxM4do\201\351\242,#8\321\f8\024\360\224\211\241\365"
+	.ascii	"\220J\244\343%\204\306k^QK\220\305\321i\270\247\013\211 f\245"
+	.ascii	"\217@*\270V\273\274\201\246\361)\023\263\322F,f\336viB1\363 "
+	.ascii	"\025\304\0238H\272K\363\211Z\244\302\224\026\032\257\031\347"
+	.ascii	"E U\231\330\223&\252\306&\252\b3!\370\020H%\202\030\223\006r"
+	.ascii	"&-d*\023#\353\240\nBOnO\021X\026fwi\2169p\030F\304Y259\306\313"
+	.ascii	"W\325\370\276oP\330\020U\004\231\366\2570.W\201\270 \351\017"
+	.ascii	"\"i'\274\246\0235\371\276o\217i\246.\3153\356@\252\367}\331\231"
+	.ascii	"ab\315\036\232\371\211"
+	.string	"\314\\\001s\021T\314\356\231[\002\327kqP\335\031\036\333\264c\027|b%x#emSh?\261\354K\360\354-\364\035\027\315\025\343\252\271jl\257\354\367\236\251\013\275Q\341\002\\\337\367\332\374}\337\267]6V\375\365\233\310X\327\351<\227\255EU\325w\334sl\313\377\332\t\211\0319\354;\205\260\377>\030F\257 \347\337\250\213\324y\301[\337\311E;_\343W+N\312v\361_\314\314P\355\342\253V(e.\236j\313\373\332\237T\310,Q\337\311\3145\276\335B\264\213\257\361\235B\t\023%w\361\314\006\034\340\315\344d\327kq\223\3516R\347\344\343\364}\221\373wr7\277=\303\3108\351`\375'h\263\323\345}\230;N\337\351\340\306\302\b$\220\300\023\247c^G6\343\033\332\311-\357co!l\377\214w;\257'\\\376\307\314\013\364\033!\301\367\355B\301\335\246\335\314\340\306\322+;"
+	.string	"\2017\263Wn\b\330^\373ML\327\266\374\217\221H\304\220\315?~\206\372\340\365\230^\241@\371\366^\357c\206r\371;\231\273\221\314M\371\342\247\302\f\244u\316j\235{\364[3VG\233\255\202\234%\270\321k\3156\332\255\271\006\215\2066\317h\235e\264\232\346\0300\372\255\371E\227i\256j\267f\027F\347\026A\316TFg\026Fg\002\206\234\247Z\347\025F\347\001\206\234\005h\235\003\030:\2538:\2470:\243\030r>!\344l\242u.\361\316$Z\347\021Cg\021Eg\251w\216j\235\241\212\316!\204\234\225Gg\020C\347\017\2553"
+	.ascii	"\255\363S\321\331C\321\331\251\350\334!\310\231C\353\334\324"
+	.ascii	":3\265\316\311\326y\251u\336\320:kh\235\225Z\347\244\3269C\321"
+	.ascii	"\031\251u>\022r6::#\207\316E\2553Q\353<Tt\026\032:\037\207\316"
+	.ascii	"\306\241sKt.\266\\3\221\350<l\235\201\214\316\302\3269V\214\312"
+	.ascii	"~\361_L\307\276\200{\361\375\246\na}\277\275x\254\357>\253\303"
+	.ascii	"\323t\307M\340\033\003e\372\244oJ\376\3223=\220\356\005_\343"
+	.ascii	"\350\b\347\035\237ZZ\022\217\207\341h\221\356\216\017\r\314\322"
+	.ascii	"\243\230\256\375m\310\343$pt=;\373\362n\314=\r\237\364\033~\235"
+	.ascii	"\343\325E\3519\332\256\341\3313^[\270\374\017\006\347\302\321"
+	.ascii	"6\311\035\230-K\277\342\231\035_\026\327\022\204\355U\351WL\327"
+	.ascii	"\260\\Iz'?/\034\3513\274\3253/\371,\373l|\0063\244\027\216\361"
+	.ascii	"\261\372\216\266\220([.B\220'3\347\322\357\304\024\247\262\374"
+	.ascii	"\313r\265\264\330^\255\376\3570\225\304p\304\345R8\272\224\367"
+	.ascii	"\276/\212(\356\227\221\031\024\025\006\346\236\023\216\006\275"
+	.ascii	"\311\321\233x\316!\365\340M9\321#\337\350\231]\"\356\007^\257"
+	.ascii	"\305\354d\021\004\3451\367\370\230\373\345!\257Wv%\276\304\005"
+	.ascii	"!\003\027\f\214\355\325\350\233\251\244\350\2216\276\350\233"
+	.ascii	"\310\237h{1y!\312\313\314\342\357\317M\327\373nq\030z\242o\257"
+	.ascii	".B?\364\355\245\267\345G\\67\254J\350\205c\235&\317?Y\034\235"
+	.ascii	"-G\245\003Q\266\340ZU+#\326\3419~\230\317a\356\201\0319~\207"
+	.ascii	"\347\332\035\035/di\214\357d\343\267\357kmv\374\313\213\270G"
+	.ascii	"*p\223\270I\330^\215\217b\272\304?p\017\332o\267\347\2244\217"
+	.ascii	"\264-\376\004^E;\033\337k%\230\270N\274\2316\336\215\342uo\360"
+	.ascii	"\372\264\324\311\0224\374\245s\351\200\222\300\360\211\236c="
+	.ascii	"\316\232|\366\212\357L\241\271\343\270\0262O\017\261N\016\350"
+	.ascii	"\3778J\364\247\205\017\364?"
+	.string	"\307K/\252\375\270R\372t\237;\305\351V\251\302\366*\374\247\351\034\033\361\235Pv\200h<\253B\340WU\231\251\372.\323C\032\337e\252\236\006Z\360\3718\212\314\333\3231\270\317\036\356\225+l\257?\207\271\267\345\177K\276\326\303\321\340\373\276*\270\367:\217;\202\253\305\345\302\345\241\236sAub\200\336\311\036T\266\257\312v\240\262\333L\013\237^\320\260\312\006\376\027\267\320\203\007V\031X\200\003\310\352\303\352\207\005XWl\016`\026\326\0068\324,\013\254v\354\300AA\225\216\035X\024\374\340\301\343\202\254#\343\270\0321\342JD\n\253\250#\007\005\\]\361\370\221A\216 \347\210\312\341\343F\216+\251\034WR;\260p\\ \225\303G\226T\024\222y``\345C\352\007\017\036>\244\206\314\314\320\255\246\332z\256\"\035Z|\022$T\337\342\305\\45\256\032\325\027=\307\360\260x#\337\004cqG"
+	.ascii	"\324\027\371\232z\002VLy\300\321\340\023Ya7\300\017q\245\264"
+	.ascii	"\337\265\244\023\340\007x\247\013@\200\017\361Z\377\006\360\310"
+	.ascii	"\347\234\364\r\336\007>L\3228\bU\374\004mS?\367\310R\352&Q\361"
+	.ascii	"E\3236M\357\344\021V\222@\376\355 );F\214O\361Uqf|\212\325I\214"
+	.ascii	"o5\177\207\315\t\032\023\220o51\036\310\321m\211'e|\037G\225"
+	.string	"\362\274\317tL*\267\204\342\235\317\225bd\3461\234x\024\257\236!\362g\206\313x\263\264c\233y\342{I\224.\251\332\206w2\013+J=\376\357\210A\223\224\3652b\274\017\242T\214\214\357\272\216@\325\240\200\227x\023*,\345x3{|rH\236\b\332\317l\317\375r\272<<&^p\241\304\267\337\323[\317\0249uJ\b\370\210'Qg9\365ff}r\b\013A\246\354,\375\332nJb\317\353\320\031\361S\3239?\026\346\276$\265{\204\025\361-^\333T\216\210\017\361\034\223\242\261\357\201\221\360\225AMO\255i\365\254\354\225\226 \365*\334I=\362)\365b\207|\216\001I\271 \275\023*\214\321\215g\265\210\3700\376\313\333\032\306\034\214o9\206sg\205\356\350\306\267\034\214\277qB\272$\304C}\024\013\313>7A\332,\375L\230\261\211\202\372\366\322\253\013\361\3021\243\020"
+	.string	"x\020\257T\243\307\347\344\224\037\036\304\207\247\007\300\303?\241\3610\327mDJ\366od\036\264\0319}\207w\027\342\\\266\013\234^8\366\326\341{L\037Ox6\260\211g\004\211T6\253D\312&j\265\020\2312\261\242w\262\215\347\320\202\233q\321x\270j\034^i\212\026\205\317\036\221\2373q\210\336\331:X\267'3=\322#Ca\216X\277\006\202\007\250\342\020%\023\343\n!\"\021\021\221$I\322\030\022\013\020\206!y \266\330\003\022\200tI\212;\247H*Pj\264\035\213\244\341\251\344k\302\246\017-T\323\370\264\363u\321\007\302\032=\3231hk\372\203\036"
+	.ascii	"9\005Sn\246\221+\335\n\002\363.IG\342\355\026\347\\\204\027\241"
+	.ascii	"\250\356aO]\367.$d\313\r"
+	.string	"E;\365\340\004D\327\034l\b\004\3643\336%\013I\347\026\356X|\220\017\346\357\314}\2216\217\375\207\253o\036\277\363\0172\306k%\271\212\235\225\274s\211\276G(pXv\263\340\261\323)\247'\231\275?\362Q\006E{\347\207\236\375\001>\241\343\3235rk\034}c\027\256\275\306\016\232\310\245_\213\350p>2<\337\212\247\267\f\277\245\206\241:\t\027\370\343\261\354\206y\004\356\343\305\037\244[\327\205\006\223\t\376\"\204\310{\350\374W\244\311\254p9\243=\001\276j\345\030\360\030\325\264\"\321vw\346\303 \235>\200\277x\345\0309>=\210\254\346m:\361\203p\212U!\352it\3408vf\316D\327\337\331\240\305s\021Rx\247_\037E4\314\263\324\320z\b\314\225\206R\322\030\225\327\275\251\032\230\244(\\\231\254e\2575\f\253\221\353\"G\225\237T\266\355\021\004\331\034M\202\222\324\246j|\262~"
+	.string	"y\344\001\237\271t\355BO\007}\3007\272)9\235\016\340\005\017J\021u+>\315\351pw1\213*\033\204\035'\246/\3623\216\354\254o8\267Tw\017\344f\203\325-F\331l\320\225\037\216\222\337)$\312S\307\256\017[\226\031\276\372\273?\0309^\276\365<\276\226\331w\204y2Z<G\005\225N1\217H\246F\b\002F\301\317_P'\224\215\027\201\022;F\304\245\376}\266\326\342\360\254\006\017\247\032\307\262\301\036\374:9\333\253\\\207\350\321C\244C\200s\261\201\201{\340a\300X@\327Y\237\026\322\323I2\300\246\037\255\004\365\331\271z~r\255\2111\250\265U\302\377CB\023\222a'A\203'\346\r"
+	.string	"(\307\202\"\343\341\253Lj\354\355\033\030\017\t\275\246\257\002\033\275n\2262\0246\344?\334\226\013\273\177\005\271\342I\225x\025\374\242\t\\\327o\2059\221\204,\207B\262\002\376\033Z\210\311\346\360\234\206\317Z\002\213\340\373\325H\2101\312\352bs\206U\321\3339\325\215\277\334-\353\\\262\030\300\316c\311A\375fo<,J2\226cN\266\260\366z\005\3013\007\002\237\350\223\n??"
+	.string	"\024\026[\2116\333XK\265d\266\035\212#\225=I\262q\026\0210\261\256\216}\026e\254\312\f&\324JFY\250\255\333\373b+W\333\242>U\222!\340\373\030\263-4\305\234\207F\023\262\204\004K\0312\255#\310\031\\eS\022_\314\253fyy-i\fqW\341\\:\346\304\316\301!\301'\347\0201?\305\231\361\321]$<\t\t\006\360b\3228I\".\204\360z\271\354\262\333\341\260\365\276_t\301\240"
+	.string	"p\264\316\374\233F\306!B\214(\212\322\255\025\013\327\246>iV!qF.\272\007}\023\267\264#\347\030\267x\344\327\202\254j,3\314\376\003\201\270\r"
+	.ascii	"\177V\376\027\24509\205$\2622\332g\352y\366\3169\023\326_\334"
+	.ascii	"\304\002\355M\300t\034c!\356B$\240\237\354\201\200\265XX\263"
+	.ascii	"\\gQPM+\314\366\226\303\033\274q\222\034\033\363M\360\214\371"
+	.ascii	"\027\276\363 \301G9\203\022\313\362\302\025=\234\236!mp\032."
+	.ascii	"\b[\t\245\322\ba\245\235\3131\335\271\300\352!\222\252\230g\233"
+	.ascii	"h;\206T\210d!\t\3644K\260\317\271\230\t\n\377\230\263\321\002"
+	.text
+	.section	.gnu.lto_processRcCommand.86.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`6\031ex"
+	.ascii	"j\277l*L \020\333\031\003\017\365\325\3557v\205\271\0256b\263"
+	.ascii	"\025V\017(\312<\377\001y\232\021\314\307\317%\271\2432B\220\266"
+	.ascii	"\020\326\362\204Xl\3623\020\026\201T\314'\"~\327\213\013?\256"
+	.ascii	"\247<\277"
+	.string	"\213\b\030x`\322\363\024\331R\312\224R\n\235\002\\\002\223\002;\316\357\316~t\356&S\241\226\226\304\255\360g\250{\205\034\346\360\376\261zN\232\257{\257[L\367\264[\332M\327]\245\373J\033]\307s\274\350D\337a\356$\021\372\330\230T\304\201\301A\351`\022\031\225\215I\037\364\274do7\300!\t\216a#\022\016bxZ\024\203\026\267\334Q\325\314\375Y1\0306\"\231\261b\346)O\231du\357\331\027\232A)T\n\305\376\302l\344\r\032\0137\227\306k=\005R\220!M\372\276\2571\317\213\ty^\210\3128\351rw\244\313\035\220\0257\367\315\362\256M\310\374\275P\315:\005\261j\275\267pg\351\0276h-<]\353\3363%\t\206N/Q?\212\3152Wn\0276`66\313\366\224\246\322V\332\216\215HpWv\024_8\242\026\033\234jtH\273\256[p\273\n\017f\263\356\205\016"
+	.string	"(\246F\261\331\236^\266\315z\373\264\315\"e\241\3531\002\360\257\201b\263H0X\215\240r[\n\306\024\253{\205\244"
+	.ascii	"\004\224\016\276o\035T\263\334Tl\326eN\323uloo\311\301\314n\360"
+	.ascii	"}\337\251?\201e=\030\255k\020{\257u\315>\254\333!\240\236\234"
+	.ascii	"@|\360\320\324\201iI\211\231\204tdT\024E4$\024\004\264\374\361"
+	.ascii	"QJ%{x\220;G\243NN\221\330\262\353\273\313-\326!\210UP\324~\242"
+	.ascii	"\312A\367\334\211:\306AP\305\370\207Ugz\207\267R\365\335\271"
+	.ascii	"\007\023\206t\351\246\276^\345\006\007\273t\007.\315\304e\213"
+	.ascii	"/\361)\275\2602\26583\351\205F\242\353\243,T\026\334H\332E\322"
+	.ascii	"\216Z\211\246\254Mv}N4\244\2646d\205\026Z\217g\236\034\351*T"
+	.ascii	"\205\225\204\021.gz\f\n\036\344\244\201\334I/\337\372g]2\221"
+	.ascii	"\213\353*\264\311\3724\275\303k0L\334\207Xe\302\020\267Vv\323"
+	.ascii	"\255\245\326\2474>\020\272\n}[\2271\220\200\246\345\240~\236"
+	.ascii	"\234k\363\036\236\035i\034\222Xe\327\253^\rY\330z'\255\327\240"
+	.ascii	"J\332%\223\251\033+\255A\227\374\221\212\261\nE\2622\337\367"
+	.ascii	"m9h\022\327\031AC\235\224pm\b_\347\254(\356^\274\256B\217\254"
+	.ascii	"D\271\303\270\266k%9\250\021/*\255\rAk\342\3324\007\007\f\021"
+	.ascii	"\026\037L\314\274\025\241Y\2353\021zE\236\3710\236\221\371\257"
+	.ascii	"Oj\362\336t\025\212\266.\205\240\340l\273\366\347\331\230;\261"
+	.ascii	"\352}_v\347\331\220\346\251f~0f\256c^\332\020\377d\274f'{\337"
+	.ascii	"&S\361\277\254\370\2219\034'M\310x\305\367}Mp\017j\340\306\025"
+	.ascii	"\233d\265\315\026?\207\316M\277\311z\342Bq\241\264\315\022?\251"
+	.ascii	"\r\355\270\007\245}6[\355\024\224\361\355\277\233.\315ln\351"
+	.ascii	"\266k\235\021\276@\t\3254\325\264\004/\343\331\313\336\254\351"
+	.ascii	"\030/\301\247`\013S\326\246\277\264\216\226\263\326\353\016\301"
+	.ascii	"\205\034B\030\201M\022\265<\"`\363\264\355.\355\036\207c|oi\256"
+	.ascii	"jz\234\265\355\340k\273s-\263\313\202;\305\333y\301\267S5\262"
+	.ascii	"\027\363$\2221/\354G_\353\333\314\260\351\207\2754\b\350\266"
+	.ascii	"6\217v}_\253\241"
+	.string	"\321\360p\251XY=\001mhrH\376\317\214\300\no'3\311^\214\213\234\231E\013o\347?s\354\305\370\270\027W-A\244\2068_\246\375-\260B\003\231\303a\3563=C\017\356&\374\002\013\353\217\201h\276\267\244\n\326\266\264\005P[\346y\351\036\017%\204K\346e!\024|\367\212T\360}\245\231M\217\303\336;\332\376\n\336\373\312\322\306\374\220\231\033\350\030v\024\337\227\314\0047\231\376{\200\273I\263,\003\002o'\004m\263\375&\002\351\232~\310D \f!\202\006\031V\333\256\037\240\362G(\370z\034\346\2721\377(sw\232\017\032\234\374%0w3\f\254\003\0357\274\272\220\316\\\255s\006[\255\263V\353|A_i\256\240u\226\240u\226\321:\307h\276f\254\336k\206\361\242\247\315.Z0\300\242\2534/\200t^\261\343\234\300\2163\002G\347\003Z\347+w6\300\235\255Z\347\252\326\271"
+	.string	"\2453\001Ig\025I\347\001Zg\001Z\347\024J\347"
+	.ascii	"Zg\024\255\363\211\326\331\204\322\231*\351\\B\351LB\351<B\351"
+	.ascii	",\"\351\f@\322yJ\351,\245t\216j\235C(\235\241\222\316OIg\247"
+	.ascii	"\2443\b\245\363\207\244\263\207\326\271\251u\356\320:3\265\316"
+	.ascii	"KJg\245\326\231\251tNJ:#)\235\217\224\316FJ\347\242\2433\221"
+	.ascii	"\322y(\351,\224t\016\332q\006\332q^\3568\377\270\263\017\322"
+	.ascii	"YytN\"\235{ZL3\017\322\031yt>\032[g\235\2266\347\3648\027y\234"
+	.ascii	"\211H\347\266\351\232Y\244\363\032!\376\312\257\202\0171\367"
+	.ascii	"\342[L\267\2279\203T\t\352\340[\314\213\357\240\013\022)GS\334"
+	.ascii	"'\222\364\206\033\247 \013U\250_\301}\032\261\315\255S\247\340"
+	.ascii	"\323C9=\322?\201x\017\357\364ma\031\334\207\007!%\312\215\017"
+	.ascii	"\337X\002\365\232\336\303\267\035\236\351\233\206\276\303\037"
+	.ascii	"\365-=\363\231\224~)\005.\027\210\322\267\2316\264\244g\312\271"
+	.ascii	"\317b\234W\3227_\233\336\321#\375\271\023\024\216^*P\217:\327"
+	.ascii	"y0\2549\004JBu\217i\226\032\345\007\252y\376\311\2754zf\226\362"
+	.ascii	"&\3563\310\315\350\177jf\b\0025\356\347\243\274sD\251\343\211"
+	.ascii	"G\244\240\332\305?\275y\332\272\370+6\316\305\367\264\251\244"
+	.ascii	"O?\037\035\337\323\020\355\342u\254\025=\233\373T\301vB\330\241"
+	.ascii	"\353C\350.\254\352Q\367\211\202\235\004/\301\025s\307\\\037>"
+	.ascii	"\332f\213\276\273\264\351\201\351\216B]\362LzpPP~\224\273\223"
+	.ascii	"\201gpR_\002\3474XK\364\275f%\320\227\270\032\230\231\373\301"
+	.ascii	"\007m\263D\177\024\210\246d\350\331\223\270\022\367\231\201\013"
+	.ascii	"\004H\237SP\350\207z\2026\350\205\276\313\322\200>\350\205\n"
+	.ascii	"\315\f\227\377\363@\337e+\2149\232\033q\205\234\271D\210\264"
+	.ascii	"\315.?\007m\201\377\371\266\017I5\002%I\225\344G\331\243c\202"
+	.ascii	"\360\334\370\016\023\005\331\365]\030&\310\216\327/\360O\237"
+	.ascii	"\377r\021|\036\031\210\326?\250E\026\370\256B\326s\203\252\210"
+	.ascii	"k\304\333y\343\233\210\332\017\365\254\372\2265r/\316\037\017"
+	.ascii	"a\027\264\225\337\365]&\227|\345\177!\022'\342C\222O\325\026"
+	.ascii	"\301\233gs\025\362g\217M\325\353\273J3\233<\332\236\367\372/"
+	.ascii	"\024\322\363'\332\320~\366\326T=h\"\277?1/\344&;\037\375\301"
+	.ascii	"\016\204\323\264}h\357|\337\017\330\235\234\246\350}\3246\313"
+	.ascii	"\356|\2018\201{\337\327\311\315\2309MKF\314\373\212u\232\377"
+	.ascii	"\274foS\324\274j\257\023\223\314\r\371\270\327\307\2004\3145"
+	.ascii	"\21764\362\257\334\007\017%V\310\367\020\330l\267\306K\030\343"
+	.ascii	"Gy9\255\343>\343\315\036K\260\232\330\332L\253\3172#\274\351"
+	.ascii	"\020y\231rf\227\0047JE\271\226\245/\347\243\314\275\243=\276"
+	.ascii	"\005V\002Oh\303\302\343/\003\351\246T\213P\256\363\314\256\233"
+	.ascii	"\373\226\301\353|\333"
+	.string	"uN\006\317\356\024D\356IY\346\235\265!~\224\251\230\260\027\274\217\360%m\325\372\030\0016\264\272\272\262j\314 \342\330\342 k\255\201\301V\215u\207\227\215\347\032R8j\344\310\342\232\352\362\342\342\362\232A\224\203+\353q\330\320\352\352\312\252q\325\345\265\225#\313\206\227\006_Z9\272\266\2265ph}\321\320\212\301\301\327\316\017g\321\020!\202\006"
+	.string	"'\264\244\2229\272\256plq`\245\225#+\206V\216,\033\033\314\260\221u\345\345"
+	.string	"\217\013\262\264\276\212x\206\324\214/\nf\320\230\232Ac\252k+\213kj\306\027\216)) \366\322@\353k*\207\227\327\327\224\261\256\331U\315\037\373\021\342\2435"
+	.ascii	"\001N\201\nc\203\364\233\253\022}\230 \345\351C\313\365u\375"
+	.ascii	"\241]\361\\\317n\2066\346\207gV|\277\tt7$iN\t\274\013\372\353"
+	.ascii	"\ni\021\370\004\276\315\320\252\256\22007.\021\004\276\2714\210"
+	.ascii	"\261>\340\277\254\340\340\177N\346\200\017\n\244\363\223R}?|"
+	.ascii	"\224E\3545u\363Y&\035\240\032\353\237X\177\365WdZ\374\3257Kd"
+	.ascii	"\r\353\233o\365\360\321\3467\037\326w\023\213\337\222\352\225"
+	.ascii	"c=sX\234\260\302\356\213{&_\2108\233>jf\215\037\223\3635\257"
+	.ascii	"K[\337\002\252\233\257\037\230\342\267\244E\207\217\202\265O"
+	.ascii	"\324\232\036\307\017I\025L\024)\223\222\361\267\f\240\032\240"
+	.ascii	"\265\246\216Pp\332\004\315\340\322G\031\251eh^\2319o\264\372"
+	.ascii	"+\037c\365K\332\320\240\001L\243d\304\300\347\374\223W#\026\317"
+	.ascii	"\262l\3163\303\374\260\265\361;\253"
+	.string	"&}\224\371\356\r\334\033\222_\221\352[\306e\350*w\241\247@lm\212n\310x!\024|*\314\322<\372(\223\320R\024\366=\327g\030\005\3250d\274\021\232\341\025\201}\333\365\2127 24\003\377lj7p\007\307\f\257\310\277$\360\366\303\f/\252\3134\013\030_UEe\361M\307\300\267\024\306\367\236CQ\203\362\032\205}\357\301\37002\325\356\321*Q\373\241\272\001\373\226\026\360`\317\332`f\330\3260\276\200'\272+{3\306\206\200\327s\237Glyf\234\202*\236\200\357\001\276\304\253\370.\203\023\340\007xb_\212G\361\002\004\360)\360\002\370\016\323\206v\342M<\212\021\177\342\207\334\230\031R\275\211;.T\337X\332\364H|\t?\327\342>\213/\220\370\022\201z\32458<\261RX\244\002\315\232f\324\227\300\356\263\035\201e\304\003Q\373\252/\221\210\277\002\300\213\370\303\303\236\240\235z"
+	.ascii	"\244~\252\005\251_N\207\242\236\212\233q\n6\243\2365\023\204"
+	.ascii	"\232'4\246\327'Z\200:x^\227<\377\342\237/>\2028\250\002\351,"
+	.ascii	"\023\243\320(T#\"2\222$\205\016\"\n\020\212Cy\236&\325\007\022"
+	.ascii	"@\2459H\246\241\022C\245\375\357\027\332\375\371\023\221\024"
+	.ascii	"\n C\005[-\013\216C4s\357|\235\221\341m\034M\330\351m\370\346"
+	.ascii	"d\322\363\333\232\030\"E>>o\270\\!\242\240\267{\272/)\222\001"
+	.ascii	"\306\334]!)\2316\"ba\214\025\221\"\341\216\300;\021\261\261\330"
+	.ascii	"\237\336\231W\214\200U\222\023\033 \330\320f\252\362S\257Jf\334"
+	.ascii	"+\273Y\037\316\322\347\326\036v\232\362\255HZ\2040\320\273##"
+	.ascii	"\216X\242\350\232D\203\361\3635\354M<\301\253\326"
+	.string	"T\024\2610\305\250k\203\313\241\335\2677\274\205h@48\314\024\237\304\235\353\353~\0219s\b\371\003\345W\207\325\3746\236\230\244\007q\335E)(~\254j\210\317\342k(\310S\016\353a\211\341DD'\027\375\362aN\224u\223dJ\255\206O$\003Jo,\262s\226\247\321\274\307\213\306{\265\213I_\261\035g\233(k\324a\303\320\355&\\~?\263_\"DH\357P\326(\223nM;\244*')R\300a\020\021\242G\323,\024 \257w\224\226\3267\231\226K\\\226ZQ\262\345\037\306\251\314\317l\020\331\023T\214znP\265\240%\230!\3237?\356\371\367!2\206qk`\035p\374\333\006\357(?\314}\025\025<\214\317'\r\322T\270\243\225\223/\033h\321\n1\016\030!\302K\367Z\2537&+\0025\354w\035\344\2375\210.\342\364\360\334\272\276\200\330\tt$\206\344\242A\\\317\343\215"
+	.string	"\371\2469R\327\246\305:_=\236\354 W\201\327\214\315\365\302\262\036pZ\356-1\343\f\333\375I\253\361[\224^B\332NW\271A`\361y\226\t\255\327\321B\316\334%:\346\267$d\223\202B\305&\312\350s\240\226p\322\210p\304\352\034\005(=\303x\224\340vw\220\236\220\026\005u\211\037N\3070\337\257\303\242G\310\252\273\004\225\221>JA2\037q\202\345[\027PM\353\322\310\0324\222\371\230\253\200\270C\336\3269\313\213\335\205\327F\324\b\327W\335X\336\372$0\235\222\313\355\200\372#\265P\267\261\237\354h]\"\2229K\342})U\222\377\034\225\377{\313\370\337\237\307\26429y\022\"\234\226\227\344(\003/G\026a\n\031\030l\356\326U9\372\013\004\026I\271&\031D\235\370\276\017\362\375\250K\3405\254&\360[+k\"\322|g\203\027\372\205n\310\310<A2dbN"
+	.ascii	"Oa\025\001&\004|W\255\021P\326\247\330\203'\264\351A\023f:\225"
+	.ascii	"\002u\034\312\304\017\242\377\275X\201\212J _v\302\221\r\261"
+	.ascii	"\305\367\275\021\376\203<\310\223)\272\211K\"\365%\372I$\271"
+	.ascii	"\364HSJ\r\f=\001H\211<<\2463\206\337\003<\231\343L\206E\"\365"
+	.ascii	"\371\324\374\366A\317\t97=\006\013\230n\326\240\\o\025\347\236"
+	.ascii	";\201\212\202\233\331\241e\220\242h\230\247g\320\361@\364\377"
+	.ascii	"\224\310`M\247\370D\313\354\321Ru\026(\274\316\256\326\031J\001"
+	.ascii	"E\331Uj\030\316bg\372\216K\362de\267\360\201\367n-\342\364\323"
+	.ascii	"(\274#6q\233\304\034a1\"[,\202\b\325;}\257\342%/%\312\341U+J"
+	.ascii	"\264h\016\235&2\\\350+\370?\307\277H\343\b\221\370v&o\206\301"
+	.ascii	"H\367\262\006\n\250\001\303_\243\314)\302\326IKA*C7S0cm\210a"
+	.ascii	"\210\352\273R\007\245\325\215\225\036_H{\320V\005\351\257L3\335"
+	.ascii	"c\0360\"\331-\235\273\343\301@H\304\017P\261l\204\031k\272\344"
+	.ascii	"\252\264\215U\021V\365Q\037:\347T=\275E\260%\215ST\343\204t8"
+	.ascii	"\004h\322j>\3173?TI[J\314(\250`?.\024)\250K B\031O\263\016Zw"
+	.ascii	"\234\224\020#\301\002&\032m9\242\343\304\241u\342\030\264\223"
+	.ascii	"\260\245\252(\205\360\001\376\r.*\301\334}\272\226\b\373%\034"
+	.ascii	"\365>\f\341\n\3136\033\255H.w\203\276\202\321\360\347+\356\203"
+	.ascii	"m\246\213\222Sql\327m*`#m\306\372 x\314\016\232\342Z\347\256"
+	.ascii	"\364\237$\031\354\246K\r\230\325\t\213,\257\334\177\264\002\r"
+	.ascii	"\207"
+	.text
+	.section	.gnu.lto_updateRcCommands.87.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`\203\032-z"
+	.ascii	"\372\310\250+G\020PJg8\262\302\275\242\t\232\207<\375\235}F\260"
+	.ascii	"\260\356(\2741\375s&\322\2017:z>\2350\2218S\270\245\336&\374"
+	.ascii	"\032\347\213\225\327$\370J\277G\240-ev\347P\002`\262)\235&\245"
+	.ascii	"\215\275\267\224I\006\243\002p\002\265\002I\336\245$\257\022"
+	.ascii	"\311\253\224\362&\375\360\"\025y\217R^\243\037^\024@\274E)/Q"
+	.ascii	"\312;\224\362\n\031yO\244\274AE\336\344\221\027y\344\005Jy\217"
+	.ascii	"?\274?)\2571\345\365Iy\213)/1\345\355\371\341US\336\324\310\213"
+	.ascii	"\372\360v\312\313E\336\177\005\016~\3603\241o]\243\0346\261\302"
+	.ascii	"I\361\332^\367\373\375q~9\177\021\277\336\377\346o\363\307\375"
+	.ascii	"r\367\331\275\322\206\347\2078\0217b\215\3120EXiaN\016\027\272"
+	.ascii	"\326\335\355\013\013nU\356\342p}\225\262\262_\r_\256\240\t\021"
+	.ascii	"\265}\207\263\274\237\b_\313\326\207\221\371\202\345a\304\247"
+	.ascii	"IVn\331[\243\222M\317\013]\353\026\370\002\245\213\370T\231\026"
+	.ascii	"\265\177\263\017b\215\312\024vh\263\013T\216E\255\033e\2236\233"
+	.ascii	"w\267\303\326\363v\215;\202\232\263\371\017}\347\320\007<\030"
+	.ascii	"|\300C\212Sd\315\335\nk\356\212\346: .\243\240D\245|\273\021"
+	.ascii	"\336\303\346\241r+\332\211\027\3624\337\360\344 \3620\302\256"
+	.ascii	"\361u{\035\326\270\313\022\216\303>M\0225\343S:t\255[\321.\204"
+	.ascii	"k\236\374\242\316\247\213C\341gD\27491.\236\356\321\224`|\372"
+	.ascii	"\004\030\265\373\034J\370\234\222\2461\271\025\315\002+n\310"
+	.ascii	"\340\271A|\232\336\314\317\254Q\t\t9\024\232\306\222\353X\233"
+	.ascii	"\027\267\032\304\247Jx\242N\346e\226\217C\201\030vFL\323F\030"
+	.ascii	"\270\256\353\324\323eA|\332t\"\365)z!\365\351.w\223\270\334\332"
+	.ascii	"\372;.dh\360\254\353Z\3251l\037\225\373&\361\362-\236X8\255P"
+	.ascii	"\221\242\211iI\251\224\204td\204\242\210hH\350DP\022\tt\3741"
+	.ascii	"\372\024\211=j\2126/\367=7\212ehaoq\367\247;5\314\302\356No\317"
+	.ascii	"\263\036x\005*\025\310\306\016Q\224\031\312\376v\306\003\253"
+	.ascii	"\260\333\201S4\325\235\t\2252\203\022\345\325\361\222\016W\306"
+	.ascii	"\235)\303Jh\222\f\n\303M\025N\202A\312\230#\301\375\bN\f\033"
+	.ascii	"\241h{\321\fmL\344\345C^\272\260\320\r?\301\345A\\\336\316\330"
+	.ascii	"8\211\002\271\365\211\375y&\003\032\343N\213\341\032#\263\034"
+	.ascii	"\b\313\333Y\026>>\317\262\\\341\037#\013\367A\221\260\350Q\371"
+	.ascii	"\363\314\n\312\302\357\005$\036\304S\274\235\255\300Eb\212\236"
+	.ascii	"\236\033.HQ\273J\326\344\364\3141G}\320\250\274\201\320\226\240"
+	.ascii	"M\353\272\376\314\331\fM\214\271\347\306\272\256\313ehR\276P"
+	.ascii	"\337e0\273\273\266k\204\024c3\226\227psi&\001\0348\324\247'z"
+	.ascii	"\006[\\\262\203\300z`1f&\333\351"
+	.string	"\017/\210\337I\237\225^\3275\254\330\316\375\035 z\264\372lw\342\324\017\032\2036\333E\366^\220W\024M\031\035&\037\276p\004\016r\b\034\0362\001\324\310~\363\r\203\006j\324\260\031\310\344\303C\f\372\006\223\250u\324j\356c\337\360\247e\024\366|\320\227{\223\261_\347\0374\373t\261\215\035\225\327\204C\256\361i\251\274\246\033\261{\272\330Gv\31571>$v\022`\323M\214\017W\355\236\356\274\034'l@\355\003\376\342\200\370\3564\255\353\252\266s\221w\267R\337]s{cL\270?\363;\341\023L\333\271\334S\277\233\023\007\007g N]F\233\355\321v\336}yl]\231+\366\202\267\263w:V\r\277l\325\250O\235\326\360\374\360-1\3047O\275\334mhar\341\376\360\365\255\334\272\256\335\316M\233\233\2039\2751&\\\264S\bNg\307\214\375\022$L@\354\002B\027\343\236\304\225"
+	.string	"a\337e{\370\360\241>\355\236\361\247\366\346>Y\236\335}q$\254\210\353\272\016\260\237\363#.\330wy\272?\200\360\313\200\250O\337\310?<&\037\356\222\036\363\t\361\\\271pWN\214\333\271\373\257\275e\367UTH\2432\005\355gQ\240<Iy\357$\311{\263\262&H\3363\271\337\367K\036\347\373\261\313\371\236\371\"\276_S\336\023\256\367U\362\272o\022$)\357\227W\221\267+\311+B\312{$\345\3452\362\032\371\340r_\255\224wH\312\213\225\362n\220\344\275B\362j\220\362\ny\3347\b\220\277\371f\360\343r_\f\212\274\027\034y-8\362Z\035y+8\362\3728\362Rp\344\355Q\344\345q\344\235\340\310+A\221wG\312\033A\221\027\202$\357\003I^\035E^\007\222\274\r\024y\031(\362\3460\362\342(\362*\220\344M \311{\243\310\213@\312{@\221\327F\222\327"
+	.string	"#o\215\224\267\200\"/\001I\336\001\222\2744\212\2743\336\346+\003\311+@\020o"
+	.string	"A\274"
+	.string	" yc\004\361\302\b\342\255Jy_\004\361\272\b\342\245Jy\247R^\251\"oT\312\013e\344m\221\362>\025yY y\235\212\274+\222\274*\222\274)\212\274ME^\246\257\363\t\322I\232\367\256\303}\350\356<\3274'\016\021\346l\260\016\335\233\230thn\203t\202\364\343R\264s{\330\3004\244\237\367\242\0266gD\264-A\365\t^0\332\253\017X\325.\032F\367"
+	.ascii	"6\341^tU\377\205\177\321F\200P*U\273hU\260\3716\325TP}BOu\013"
+	.ascii	"6\335\352\236h'\354\336\356?s\242\341a\340` \263I\252\207\034"
+	.ascii	"\313\322\244\260\350Qaj\347J5Ts0\307\367\274\373\354\200\366"
+	.ascii	"\374\341OK\323\204\0239uV.\274\017P\3755R}\273G\265\024\230\032"
+	.ascii	"\242Z4T\337\320\n\277}i\3213\376\342\016\227\220\220\240\266"
+	.ascii	"A#\351\0036\261\210\025n\320\217\233\241\313\233\230,\303\243"
+	.ascii	"x9Vo\320\252\235\247\306\352\345&\023\205\367\001\257\307\210"
+	.ascii	"5w\310\276A8O\235\343\216K\340\272\256S,\372\251o\310\\\330X"
+	.ascii	"4\323\037\336\340sU\266s\235\232\203\271\030\334\264~\231E\335"
+	.ascii	"]\266\260|\201_\346\324\001h\031\353\260e\262\343\323'\250\324"
+	.ascii	"\316\2509H\257\322\213\2422\372G\233\271\370\217\306\201\026"
+	.ascii	"\272\360\243\337\346?\232\324\206\352?\372U\372M,w\363\307\220"
+	.ascii	"%\215\221V\264s\213\212^\221\242Ut\0036\3514u\n\027\254\210-"
+	.ascii	"45\325\037\336\336Q;\273\346\364~\372\2040*\352\303\303_\251"
+	.ascii	"=A\020\375W\352\025\023[\341+,l\336R3]\265\262\227\200\264\262"
+	.ascii	"M\310\323\207\242h'\027\365\226\275a\nBy\206~\326@\332\214\233"
+	.ascii	"\\\251o\307\311U\2261\250)\265\r\266\2706@\210\316\222\316\314"
+	.ascii	"LI\271\322d(\t\251\223\3308\2054\2442\013\304\0268)B\2050$\247"
+	.ascii	"~0\205P\202\236\326\031\034\365\024+\024k\214\306R\2262xY\266"
+	.ascii	"\265e\320G\335\200dy\240\364\211\311\240\377\346D;\323\372o\214"
+	.ascii	"ZH?\255\031p\250\357\013\025\300\347\235\240v\256\2206\352\273"
+	.ascii	"0\247\207\242\215\276p\224%\rO\030\312\022\3142\314R\314R\214"
+	.ascii	"\372\024ES\365ea6!\320(\221l\347\2260\3478\324\2372\347\247\231"
+	.ascii	"X\0223\310\007t'-\244\315\370YjQw\315\315\371\321E}W\204\364"
+	.ascii	"\337\334\307\017\362N\372M\267U\243G\205\f\320\022\\\372\243"
+	.ascii	"\361L\332\307"
+	.string	"\034\2377i\r\332l\261T\r\332\211pn\316\030\023\242?\314\344D}&\035%H\006\027\324BM\324\312+7\254\3411\266\263\316P\277I\237\fN\214\017\377g\2326L|\332\271S\037\352!\3029>\241\016\352\241N\3214\335N\264\320r\f\223-\313\020\3275D\210h-\320\001V\227\027WV\017\021\"Z\013\204\240\345\325\343"
+	.ascii	"\216\nt\360\270\352 \004\254\255-.\034Y]\310\256!F\260\262|\f"
+	.ascii	"1\362\365\305\325U\344\013\310K\213\004,\264\210\007ZE\320\021"
+	.ascii	"\270\214\364\026y\341U\344\013k\253*\004\256\255-\256,\244\257"
+	.ascii	"-\254\006\340\310\326\027z\204\253\353\b\272XDb\304 \002\203"
+	.ascii	"\306\220\027AG\266\276z\263^du]e\021\251\312\""
+	.string	"R\025\202\026\326VUV\227W\325\213\242\345:2\244\253\352\213\213\253\253\312(\307|oa\362\314\203\303l\261\026u\350\260\271\240\003\255\210\326\224\260\240/\350\266\263\352\n\332\202V\001\233n\022\264U\037\241i\276\211\365\350\n:\3353\263\244\357\347\243\277\244\331\260\311GAO\320>\332HN\217\246\200G\367h$A*\006\264\"\"\301\243\177\367'AO\260\243%\350\236\274f\240\013\236\363\267\243e\224\031\353\307\331\033\033\303\354\313\341\301_\375\300\3420{)\346k\277\210\035\034A\357\202\025\001\366\267v\023\004\035A\267!Y\236\007\032\002\035\335@?\340@\353\210\303CX\035\001\006\b\250>u\240\213j\ft\003>?Rs4\003}\264\247\004\303\261z\016k\013\266\004\367\201\3251\300\210\247\313{\314\007&\bv\007lpP}\232\243\237\003[\234\021a\236Z\250F\372\271ro\241\342h#\275\354\206\337\354"
+	.string	"+\0043\0043T\237\342h%\233\332\332\023\314se\241"
+	.string	"\020VDy\200et\022h\005\272F'\320*\002}\343\006\037\320J\302\226b\3742\004l\364\001\255\356\031\3206j4r\315\257T\003\032)\257\351&\306fM\215\246\372\213cfQ\322\327\263\301\354\345\005\364\356\222l\331\204_\246\244\233\226t\330\022\320\0054\2327@\023\320x\324~\245\322\350\001\332\310\256\211eF\323\350\367`E\344aF\323`\303\333{P\335\363\212\332\304\023;N\002\364\321\206\002xw\371d\031\205_&@\253u\264\210u\030\257h\347\006"
+	.string	"@\007\320'Sc4L\267\314\262D[N\231\242>\005\240O\250F7\250\306\344\303\253h\347\252h\315&\257Fr\310\247D\322A\332,\006\307\360\030PO+\317\265\254q\260B\236i\2732:utW\002\231O\372ef-B\377\311\224\276Y\243{dy\302\374T\372SZi\330\204\023\203\322\\}*\255\0326\337\304\242@i$\300\246\333\243\264\222!Y\036\264\024\330L\334U\350\333\261\341Q=I\1775\022\232#\035\244\271:\315kbI\222\244\217\264j\327|\353j\021v\301\244\360\030+\242\030\206[\246\251\260\254RE}\332\325KlxLW\230\244\003\2029\250\342\360 \224\222\216AT#2\"I\222\2441\202\n\020\212\242q\036\350\324\003\022"
+	.string	"UAJ[f\243I\223\016\310,\332\274\263\035\200@!h2BL+\206\007\216w\235\223\211\224bL\320qE\273\250D\301\265]-8\275\325\221L\354_\003\201:<\364\002`\243@\206n\274@\026F\350\222\\\026\223`\365\034a\021\231\3433\016N\020\251[B\023\257\247\006p\341\243\267nW\036\\N\013f\007\004\277mP\315\006#4oM\271\224\226!2%\013_\377Jd1\030N3\254\273\210\241gm\237\364 \250A{\270\264\236D\241));Ip\200\253\311\217\3629\354tu/\322\363\036\351\353HaQ\2069\271\315\336\021\222\272]\222\234"
+	.string	"r\022\203\317K.\022b\214\323\025\345\377|b\273k\205\311\004d\320\370\372\253`C\351H+\030\315\025\337\321\"'\302\204\006\352\304\376\356\244\211E\027X[\243}M=\255\243\260\365\343\346MN\222\306\226\266u\\h\217$\355\247z\177\217\235\350\346cv\021W\231\242L\252,\256\021O\253\252\375\343\007\215\261\277\210\3156\370\303\257i\203\263\246\226\325s\024\211\177\302\354\347L\377A\231\365+\343\251\3411\327z\303\313\270@\247\214r:\262{\r\304\037\235\032\3659\232\221!\001\337S+T\004\241\262\034T\211U\316H}\302\351\243\343\202F\331\324(\207\024\321\377\361\374\273a\357\343\323\002\003"
+	.string	"\241\323\206\264\365\356\024\217\200P\006\326\211\236\020<^\022D\374\020:\370\337\321\2018"
+	.string	""
+	.string	"\036\035\260\210\203\275\025\257\025\363\"\256-\252\234\002\253\373B\231\360\312\352\330\374\256x\252\263\227\221i(:\204\234\342eg\001Y):E\030pu\275\032\236\365\360\343r&z\307\007\031\305X\323\240\b[P\177\350\351%c\313\346\t\321\316F\361.0\031kk$\202-<\037\301$\226%G(\263\327\325\036\370\024\366\343\237m=\260\221G\241\213$s\346\316\361\023\353\017\245\265\257e\270\374\244\311x~\206\302\003\t\200\305b\365\371T\375(\001Q\356\034\b\274\2637\025\351\2421R\031`ht\006\211\217\002\206<j\021{k\300\304e\r\001&J\343\f\b\211\272i\220+\031x\366]\320\335\365\220\03132\001\032\214?\236\023R\325\203\272\035\270\001.0KNfM\263E\233\024\253\302\376\313\344!*=\250L\200+\363\215\213\243\234\340#9.\2361\357h\363\017@\266\341\341"
+	.string	"S\024\276\233\222"
+	.string	"\020\265\263:\253\322\322\317\350\245\245\206\034\276/\274\345\253\274/\034\364c\266g\t\2657k\005\317\260\311N-\225;\177\216L\030\232\177\bF\036C\205\336\236\037J\211k\222\374A\341\252\033\363\212,<\325lf\322X\244\021\321\250\353i~\250\004\346@\274\275\337\312\313\222\216\272\005\313\242S\201x\026\007\030\"\\\316z4\276n\327\266\213\177t\311\273\215z\0246\3034\306\351\337\265\270F\b\300O\034"
+	.ascii	" \031\362.\223E\262\221YiH\261\261\334Y\250R#\n\237\036\032_"
+	.ascii	"*\311$\370\334^\234XZ*I"
+	.string	"\355\252\222\372\234\211-\004\377\211\303*n/\336\233Eq4\034\343\266\240\016_\377O\312\033\177\025\363\355\360k\263 ^i\266H\275\352g\005\261$\006\303\276\225\215\003\354\2032\302\2650\203\216:#\210\233\022\004\202V\310\214h\t\234![\300G\271o\331\203\366ek2\216=\204\266\267p\211\267\231\021jV\210\375\335\244\365{\336\2230\332P  \302\263\265\325\304\253\321\266lj*\035>D\262\2024\223(\205\214\232\320q\0018\300\351\273\005\240\321!\227s>\257rXf\271\337\222\277\327\006\233\004\005I(u$\331\253/\351t\030\302a\027\245R\205\375\202\3606\301\272Ts\004\274\003\017\305\027/o\201\t\366\272\031\002\257\030\220\030\214\031*\345+?R\352\233@GF\310\365\212\2076\032\007\325|\005\355\224\177\263\255\227\346\351:+kQ\004\200\026gU`\223\321,\\F\341\364\355\237\335\246\013\3020"
+	.ascii	"o\b\200\334\006\351\3703\322\225[\302C\013"
+	.text
+	.section	.gnu.lto_resetYawAxis.88.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`>"
+	.string	"\r\b"
+	.string	"\302\01667@\217\322\001@\221\376@\030LLc\234\004\254\020\266!\333Q\336\302Ot\267_\365\033\362\371m<(\364z\264\274\243(\256GW\321\367\255\207\210J\214\036d\223-S\n\236\231\251-L\215\234\032\t\341\300\360 \247\266\221\231\213\263\210\006MNd\231&1oo-\024\005|'(\020\264\260O\266\025c\362\211 \005\362\020\211\r\207s=\026\244T&\357\\\035\367:\003\335\356&\370\036\377\240\360G\217\256\360\350\271G\337s=\352Mr=^\272\025\220\256\214\360\225|\253,\266\367Q\250a\337Z(\262-\253D:\212\310.\306\252eQq\204d\373\2307[\345^\267\006\245\321\205I\265\273\022n|\273n\3769.\300\205>W"
+	.string	"\205\335\265r\241\214\033\3366\306\366\201\355\224\017"
+	.ascii	"3\241\337\037\030\321\334\352\325x`d0pW\331`\\\"f\260\032\002"
+	.ascii	"t\rO\013a\274\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_deltaRC.15.102.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375 3}\001"
+	.string	"D\002&"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\003\002?\202\210\200 \1773\273\0014\273\001\275\001\273\001\274\001\273\001"
+	.string	"\003"
+	.ascii	"@FJ\320\003(\002"
+	.text
+	.section	.gnu.lto_lastCommand.13.104.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375 3}\001"
+	.string	"D\002&"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\003\002?\202\210\200 \1773\273\0014\273\001\275\001\273\001\274\001\273\001"
+	.string	"\003"
+	.ascii	"@FJ\320\003(\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`\023\006\235\031"
+	.string	"f\352\233E`\234J:\273*\323\245N2\233(\333E\255\335\316j\221\274\n( \215\371W)\270\261\016V\034\217\324\211\315\322B\003\275\t\371\003\\\fpq\340LgA\007\232'm|\005\203!\275\332M\323in\275\211L\001\205"
+	.string	"\205"
+	.string	"\215"
+	.string	"h\356\207\327Q\305e5\361\320\377\202v\340%\016\177\336\r?\324\320wC3\334\357b\270\232\013\307\263\320\367\202\032\335L\205\033^\n}9\264\350}\227\350ow\350N\373|>\237B\3758t\302\220\204\237\211\360<\bE\367\001\021\362\315\353\240\337%\350i\227\353\300\230\032\364\331\030\364\327\320\034UU\325\005}5\324\376\274\252\307\233\031Pp1\367\277\216\232L\252X\376\376\335\244\370Fq9\001\365\317\320\377D"
+	.ascii	"\001\267\033\322\177\243\324\377\023\322\027\f\322\037\004\322"
+	.ascii	"'\374\321/\364\321\217\323\243Y\345\321O\223\324_\303\252\252"
+	.ascii	"\376?\317\035\3752\254\243\037\006\315\301K\220\330\351\210\231"
+	.ascii	"\340\340\344\345\033}0\250\215\363\325\370\036\215\353\3158\363"
+	.ascii	"\312\370\335\275jrB\305\350\323\2410\372p/\372m.\372hh\213\213"
+	.ascii	"]\026\375\345\212~\231\212>\031\232T\301R\364\307P\024\207s\342"
+	.ascii	"\201&\016X\342nH\274\315\035\3619\021g\023\342d@<'K-k\255\374"
+	.ascii	"\303\2768\257\227\245\266\233\313\324*Y\362\327\252\236\312\222"
+	.ascii	"\226g\251EZ\331V\265\351U\271Yj\t0\371\205]{\\\305\324\026\261"
+	.ascii	"XG\312y\347\223\342\025z\301\021S\313\243,\362\261\304%3a\224"
+	.ascii	"g\332\305|\354\317Z`\311KCF\313\243$2\332\035%'\270\262\243\022"
+	.ascii	"*Z\235&\177N\313\225)BE\313\223d\324\315\fJ\230\275\226\310d"
+	.ascii	"\336\322\262\302%\347\332$\315LH\232\327#\315M"
+	.string	"F\232\237\212\364\307\020\351g\277\265\bi\271O)\206\264\354\\^\ri\231\271\256!-oQ\262\216\241\223\300\263!-\203)\331\030\305\005\3656\244\345\257UI\311\214\264\374\227db\223\224/\237\243e'\026[*rSP\304\243=j\362\001A\276-\241\243\035@\306E\254\264\273\364h\005`\261\021\356\t\240\361h{V\016`\305\364v\264\243\335a\366\034\355\316\222\203\246\372\n\237v\264\234\274@\326\350@\226\303\326\257&#\030\264\312\322\245\034k2\003f\345\321\005e\250!\f\004d\035\211\214\224\221\222\2441\300\0029\032r\003\021p,m\005#\221\004\022\210\310\220\320\003\212\360\334\256\267#\377\306\320A\320\374\212-\200\225\314\320\001\001\fk\337*\360\364)\264<\330\323o\362\031g\237\"\201\364\356\020\243\b6\315\363L\306eX\216\311\270\331w*\327\336S\2252\272\256\224\276\034\361\263S\033\361fZQ"
+	.ascii	"\272\037?\n\217,\250Q\2501\034\373\231\221\276\f\314u\353\221"
+	.ascii	" 5W\273\307\346\363\t\225\2150\332\026\262\270\222\233\351\016"
+	.ascii	"\232\256\236t\275\335t\350>6B_k\222*\240\024\334\305v\2603\266"
+	.ascii	"\354M3;OY\301=\261C\245\303\313\354%=\241\322\347\202\363\007"
+	.text
+	.section	.gnu.lto_.refs.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`l\002e\022"
+	.string	"\026-}A\340VIZ\003\004\016Fs\307\bNT\f]\2253\036u\004\306!\302\340x\031\214\2141\306\030\343\t2\3140\303\f\313\361p\361\276\177\320\366\377mb\353<\261X;q\2408\330\320B\303\321n\231\002k"
+	.string	"j"
+	.string	"k"
+	.string	"\273d\007\230&\245N`sP\315\006j.\313\346\256\256}j.O\3158\251kR\005\224\346\240\2369}\235n\331"
+	.string	"-\211NW\350t\177N\257hn\317\351\352\320\334\034\232Q\247gfn\313L"
+	.string	"\245\021\260kd\272C2\247^ZS\351\302\304\334v\205\201y\363rK\327\245Mpc-,%\334\247\313\302R\250\335\227\273\3152!W\252LY\265\241<\001\272\023\324\231\374\\I\317m\204\310\220 \254\373\007\353>x\240\256\203\325\306\261\272o\360\274\306\252-\003u\027>w\213l\b>?\310n\320s\253\347\"\325U\300s\205\256Y<w\205\235\263\363\215\3166\331&\325W6g\301$\354\"\300\356\016\201U8\343`\333`\247\b\\\232\354\031\234\033ss_n\002M\214\276$\211\311t\017\271\016D\346?\212n\0369T\217\221\035\201\350\244\235\217z\356P6Pj\026\321\025\240\372%\253"
+	.ascii	"h;\035\272\245\266mA\021\334Vz\340\266\230\006n\303\026\270\307"
+	.ascii	"B\305\351Ka\272w\242\004\366\2210\335\033!B\346\003\201\335\373"
+	.ascii	"p\335\343\260jo\203\006V{\031x>\f>\237\005\240{\025P\037\205"
+	.ascii	"\237;\267`\267]\347\240=%I\206\\6\032|4\030|2b\\\367Vd\237\211"
+	.ascii	"\353\033\021\342j\237\207\206t)\331\221 \365\330q\3356b$\375"
+	.ascii	"\305u\223\222\006\312f!\355\023tMA\327\345fA\272@\365\216\250"
+	.ascii	"\356\025\331\371\204\350|@\262o\006\f\325\207\242\325\352P\364"
+	.ascii	"m0:j}\027Z\255\326m\345\350\246btG9\272\223\326\003% `\"TC{\210"
+	.ascii	"\020\341@JG\b\017o\257X,\003\247%\212e\341\274\"\212\270\243"
+	.ascii	"\243\364\001\3210\354\341N\306~\\G\021\3278\302\311\201\355\013"
+	.ascii	"\246\244\342)^\004\300wY\233\235\315\214\335\333\226\035\232"
+	.ascii	"\300\312\332X\264\203\306*\233Mnv\306\2034xK"
+	.text
+	.section	.gnu.lto_.decls.1a0d73834549a848,"e",@progbits
+	.string	"(\265/\375`\366Du0\001j\f\006rU JQ9\351\025(\036\246\027\206\004W<q5\n\324\017q`\037\337\226^|\023\327o\336\260\"\367\315\037\373=N0Do\250yd\361\254O\272\331\343\361\276\357=\027I\n\2010\204]\336[T5Y\242UB\037U1NQ\217\377\231\373j\333\022\262\267\334)\374\005\n\007g\007y\312.k\314\254\331z\254\302\001E)s\026\0032\033&MrV~0:\201\316\0320\016n\323\325\242s"
+	.string	"_\270\311\3408\360S\322'\003\257o'Iz+\001"
+	.ascii	"\334\334\225\276\277Jt\336\304\201oZ\341\3379\370\327\r\376\025"
+	.ascii	"\203\337\245\026\235-\244\207\3245\017\255\002\220J\231\325r"
+	.ascii	"V\006\001\317\264\220\302\224\276\277s\370\325\303\031\324\327"
+	.ascii	"\327\327W=\234\277n\370W\t\376\355\201\177[\340\333=|\333\006"
+	.ascii	"\337\222\301\267_\360-\026|K\005\337:\301\267=\360\323\324\242"
+	.ascii	"\363\366\n\277[\300B\225\350\374\336\030\374"
+	.string	"~\303o3\374\016\303o\0338X\213\3167\f\334A\206\006\230*\213\233\031\226\207\2379g\246\232\304\200\301s\203F\013\270\265\307\365\325\373E\235\373M\373B\033\3139\013\371\254\211\0037\245\357\255D\347\273\005\376\333\252\352\027\005\353\206\225\213\n\345q=\006\316\216\275\276>\335\202J\205\227W\224\2517\225\006\240\031kMp\364\255rI\357\251\004\210\371x\322R\035U\355\276\316\352\372v\324_\351\324:\235}\272\230\364e\351\333\371\257|\265\357q\375KK2U\244\357\225_\265\350\304Tv\222^\357\374\354\344-_};W\242\263*\351j\321i\024c\316\036\206[\301\212\016\316\353\336_\361j\013U\257~\331\026t\270h\351[\343\324\274\272vT\345\344\240\212'dj\253\357\353\035,\202\234\353\321Y\373\372\352\321\351CW\213\316\372V\211\316\272Lz\205c\245E\246\246\357\355*\321\371\3277G\277\025\256\360"
+	.string	"\342f\202 e\r,\037m\356n\r\2535\264\276\177\275\253l\254U\214\257<%g\345P\320\035\"}U}\327\030\005\225\321\241\361\326\367U\r~\275\302\245\302U:\257\004<\251\262\314Y\371\277\326U4\325L\265\253gj\231\252\246\222\251c*]]\253i\352\227W05\314[\2313U\224?\3515ME\253m\225N\310\007fq\313\270?)M\305R\265H\275\215\345\234_\315\254\300M\241ben\213\033\0241]\252\262\013\225\002\260P\341\200l\316;\316\306rV\276\203?\351\017\321AMS\275T8\016S9\357H\341\302\024\033\f8{9+?\030}"
+	.string	"\276x\341\306&\303}5\202\277\254E'P%:_q\340W.\374Z\205?\002|\024\360\215\270C-:\377\232\345U\313_\345\352\225\n\307\201\234\251r\316\032\220Gn\260\365\255gI\257Y\376ZV\315\210N-/e\236\222s\016\262r[\\\330\351\373&lT\213N[\211N\017\265\350\374\006p\255R\335\352\332\004\365\355!:\270\215J\313f9+\203~\370\234\360\325\351{\n\340\327\t\316\332W'8\017\001\374)\265\350\254iUJ]\323\240\262\275\236U\345M)eV\346\254\fj\261;T\244\364}\003\260O\360U\355Du\271\203\017\341W\rN\333\327W58\337X\250\026\235]\211\316\313\325\242\363t\265\350\274\262\026\235\270\022\235f\317_\377\333\207\341\3707/\3509k\301\337Y\\\376*\346\257]\376\272\264\0254\030\333\341o2\177\327\375\226\202\277\315\374m\367["
+	.string	"\324\bT+\277\235\340\257oU\334X\016\177%\361\327;3\377\337\316\374g\253h5M\215\005\262i\026\236n\3427\203D\270`%\250#4\211\006T\b\374-"
+	.ascii	"\273\341\257*\254\374U\215=\322`\215\376\276b5\250\271:\207\020"
+	.ascii	"\264\350;\333\333\037\360\3376\177O`3\330\242\277\223X\f\177"
+	.ascii	"?\261D\225\354\257J\376\332\344\257N\376\312\344o\245\275\360"
+	.ascii	"\327\262\277-\360\333\241\277\202\375\315f\205\376\372\343\257"
+	.ascii	"@:\203\007\374]\201\375\371\233\204\215\277z\3258x#|\260@?\033"
+	.ascii	"\364w\b\"2\360W\243\f\352\214.\001\201jv\367\n\374\267\305_-"
+	.ascii	"\320\337\025\330\237Z\202\006\347\360\023\026\374gs\300\331\254"
+	.ascii	"\317\t\013\374\257\301\337\035,\376\255m\243\233d\373\357\364"
+	.ascii	"\376W\315\3375l\375\253\n\255\352\242\007\3208:\307_B\275z\006"
+	.ascii	"}}\206\355\035\376;\201\277\227;\346\374\177\253\013\370{\357"
+	.ascii	"\257l\364\376\237\340\360\f\377%.\377&\347\357\274\006\272\234"
+	.ascii	"\3469\207c\300\250\343\374\304'\370\357P\215\323x7\377k\367\277"
+	.ascii	"\257\3574\234\377d\376\277U\236_\370\257Yy.\364\337\372\337\356"
+	.ascii	"\177\226\377b\376\227\371?\346?\335\362\257<\377\337\370\356"
+	.ascii	"\264\232^\323O<\377%S\347\324\375O\243gt\016\255\346\3573\377"
+	.ascii	"\337>\364[6/\341\366\277s@)\342|P\267\277\236\365\327\303\377"
+	.ascii	"\347\177\333\376\266\373\273\356\3570\177o\371\033\313\337q\177"
+	.ascii	"S\371\273\355o\264\277\313\376V\362\267\330\337=\376\346\361"
+	.ascii	"w\216\277m\374=\343\357\255\277\263\376\306\372\033\306\337W"
+	.ascii	"\177W\375\335\342o\251\277G\360w\b\376f\361\267\212\277\323\277"
+	.ascii	"\221\177?\375]\374\273\003\177\247\370\033\375{\370\267\322\337"
+	.ascii	"\032\370\373\002\177\233\360w\211\277I\374\r\201\277G\370[\204"
+	.ascii	"\277C\370\273\001\177\177\360w\002\376\026\3617\007\177\207\370"
+	.ascii	"\033\304\337\003\370\373\303\337\031\374\215\301\337\026\374"
+	.ascii	"\335\341\357\t\376\226\340o\243\2771\374}\341o\241\277\201\376"
+	.ascii	"\366\371\233\347o\374\367\375\273\377\376_\371\376:\347\257z"
+	.ascii	"\177\315\373\353\362\257n\376z\367W\264\277\316\370k\326_\241"
+	.ascii	"\376\312\346\257\366\257\347_\377_\316\177\275\377k\376\252\346"
+	.ascii	"\257g\376\372\341\257v\177-\363\237\355\177\t\377O\374u\314_"
+	.ascii	"\345\376\232\366W\263\277\006\371\253\327_i\374U\353\277\t\177"
+	.ascii	"\275\372\353\213\277J\340\257?\177\365\371k\317_\177\177\275"
+	.ascii	"\177\255\377I\374\337\373\357\346?\233\377m\376\337\375\007\301"
+	.ascii	"\377/\3775\364\365\365\365\375<\036\376\037\026?\222\003\002"
+	.ascii	"hs\324\364\375\217\025lt\027\374\225!\243\253\352P\316Ri\344"
+	.ascii	"\242`#2\301\337\030u\355\306\350*#e\216\nj\203\344\007\t\036"
+	.ascii	"J\023\374}q_4\325\007B\276\244\300:pA\342\265\201Y\006f\217I"
+	.ascii	"\337\377\004\301\027l\271.\256\213k\325?\370n\325\257\225\233"
+	.ascii	"\256#\247\312\222\276\317\2734\256\224\205\351\373\237-|D\026"
+	.ascii	"\374\245\252k\227\252\243.h=@\212\227e\037\306\240\311\225\272"
+	.ascii	"R6\257\177LY\232\301\030\304\271\371f\3137B\3169\2051\0379\034"
+	.ascii	"\2001u\352X\276\0139\347<\366k\223\002fi\371\342\354\217(\035"
+	.ascii	"q\372Z;\237\373\017\004Zs\306\004\255\357\363\036\367\037X\227"
+	.ascii	"XqR\245\357}\232\340#\256\340\355\2345;\247\356\001\255r\346"
+	.ascii	"\352\240d\353\f\314^\326\322\332\340>A0\320Z\360Vo\315\352\325"
+	.ascii	"\273\017\274\3222\327\007\304\310\360\332\313\271\313\006?J\260"
+	.ascii	">:}\357\203\2053\230\023\264x\266\205\3338k6\216\315\253H\316"
+	.ascii	"\300\354e/-\017\377\363n\363\376\020\035\334\215O\316f9g\016"
+	.ascii	"f\035\231\221*}\337C\207\377\372\376\317,\245\225s\3462\225Y"
+	.ascii	"k\312\247\232\265z\370\177\252\255\026\374\2779\037D\005\224"
+	.ascii	"Y\312\216\235\234s\215\203\225\304I\345\350\220M:-+5\260\250"
+	.ascii	"\017\300\266\250\300lX\251"
+	.ascii	"\201m\rY\251\201\345(*#QCZ\031,\312J-\347!*\252\250\020\276\266"
+	.ascii	"\254\324\244\362\220\225Z\336\312-\352\266jV\202Ee\252\257<\224"
+	.ascii	"\251\262TV\373\332\352`E\005\266e\245&\2655d\245\006\266\225"
+	.ascii	"\325\300\262P\246\222\322\272\242\312ZCY\r\fNV\373\332\022\262"
+	.ascii	"R\373\332\262R\0033R\373\256\242\214q\351\331\371\361\246\"\261"
+	.ascii	"\242\3122\260tHi\t\321Y)\277r\232\234\353\024\027Y+\323\345l"
+	.ascii	"A\316:\276\264\322H\331\250rSt2\246\336\244\276\2522\347|\204"
+	.ascii	"5\025\366\225\251\350\242j\246\263\"\373\312\231l\252)c\345\234"
+	.ascii	"3\007QJ\272<\244\322E\371\320\221c\270\310yCV\346\214\225sT\315"
+	.ascii	"t9\347\250\234\363OK\2072g\034BVcXX9{\031ae\035QW\\\344\334S"
+	.ascii	"\326\310mY\251\205}%]aS\033\313U\312\250j\025\343+\217\3454`"
+	.ascii	"ZX-\n-\307\3109\327\026\360\330\326\f\274\276vy\304\023\347\346"
+	.ascii	"\265\325\367=?\260\233\237\275\036;\264\364}\017\027V\366\310"
+	.ascii	"\355\240\322\325\327\262\371]\341\252\363\321\367=UV\r\nx*\260"
+	.ascii	"\320\367<v\260M\363\037+U#L\034\032 mE\266\345\252\257\265\363"
+	.ascii	"\221\252a\205L\337\363\264\200-\031[W\327>g\313\f\341\0225\244"
+	.ascii	"\357y\330\340\0259\347\\?w\376>G'\246\312X\013V\372f\261^\200"
+	.ascii	"\244\204r6\0227\306\206\251kV\214\025c\277X0\225N\310}B\345\350"
+	.ascii	"\303\255\262\027\306\302i\301T\275\312\245\005\rK\337\363\240"
+	.ascii	"\301\257\3129\270.\226\005\313\245\256Y/\277\305\322[o-U\017"
+	.ascii	"\310\314\371\313\312\230\365b\267T= )e\326\342\031\202\306\304"
+	.ascii	"\314\350\303\007d\224\037u\360=\017\025|\036)\370<g\370<M\360"
+	.ascii	"yEn\255L\314\256\357\177\033g\255\3307\013g\335\352\232"
+	.string	"\225\263Tn\253\324\270W5\333\205\201\227\036I\344\354]Y\263\243\322v6\246d\263\233b\345\354\024.d\222\3101\372Ua\202\246\207\3175+\321y\036+|`\037>\020\017\037H\207\017t\303\0072\221\222V\225_N\356\234\335\246\375Vi\321j\0137Xt\372\366W-:1\210\222t{\006\264\345d\255J\337\241J\004\305\314\274\233\022\245\243o\031\036\331[U\337\003\203\340!V\226ID\304\344\304\216\310\031a\002\267\\b\237X2\333\304:\261J\354\nu\3152\261Gn\307,\022*\257$V\332K\2052\2719&\266\310\343*\335\224:\026\005n\231s\016\352K\202%\013\335\003}\340JW\213N\016\225\350<\220\006>\220\013\037\230\205\017\214\201\017\274\302\007\272\300\007N\341\337\n\t\322\003\307H\035\026\202\374\235\305\342\260@\272'\252o*\367\375a\364C\346$\312\223\276\307z\370uNG\224\002\244"
+	.ascii	"e\314\366\260_\326\207\r\253k\026\314\356\270\312\234\337\240"
+	.ascii	"\360x\034\0200\347.S\306,\230\315\3618 *e&r\242\201\003D\316"
+	.ascii	"^\316\371\303\007\243\017\037N\265,7\322\360\334\343.\370\370"
+	.ascii	"\r\037\263\341c5|\214\206\357\r\257\263\212\207\332\030\353\365"
+	.ascii	"\267\227\265\361\270\376\312\371-\347\254\001_\345\335\241\323"
+	.ascii	"\267f[\303v\225m\t\233\322\327v\265\235ai\334vY\256\207\350\340"
+	.ascii	">T\266\353\346,Uk\005@\265V`\316\025\221\222r\336\3432\374\333"
+	.ascii	"-\253u\251\254\361\310\026\353V\353\2672lV\325\253V|6h\364me"
+	.ascii	"-:=T\242\323\306H\272\305r\373r\347H_\"\013\303\276\360\341\341"
+	.ascii	"d\207\r\373BN\236\230!V\372\276\316\321\335\350`\213\330\262"
+	.ascii	"\273\260 d\231\346j\331\205\214W\203\t\243c\314\254\214\214%"
+	.ascii	"\232\027b\312\344\310\302\245\214\nn\370\226Y\346\210,\225g`"
+	.ascii	",sVf\325e-s\316o\272\315\235\261\2701a8\314`-[N\257\3516\225"
+	.string	"\316\353>\351[\346\234\273\213\227!\313\234\363\377\216\323|\326\312\346\326\263U\335\202\245\262QM\307^\331\026m\307N\365\234\316\353;V\312\272\350\275\356\353:u\255\345\364\362\r\247\361\346\376\316\222\323vRb,\263\310i-\217\263hZ\031\\\224)\322\245\345\364\227\034\005\207\003%W\302\272\366rV\342\2573K#H\367\276\321\300\307\\\3708\353\356\335\346o55\nU\320\335\217*c\3726\233\244\367]\017UW\025#}\201\225\350<\216\201y*\321\371\037\035\374_\033\374_\035\376/\013\376O\211\377\023\202\377\323\201\377\303\302?\347\340\237v\370\247\026\374S\r\213\250E\347O%\370\247\016\374\263\n\007\343\340\233t\370\246\025|\363\f_\211\305GL\022\267\276\257P\376\2447[\007i1\213\246\205\333\244\330Yfu\331\351\310\252\201\303\353\253\266\001I\te\252\0260\332\213G\214%\224\024d\034\2313V"
+	.ascii	" w\306\302\340\360\032k\0337n\314\201]\365\223Nk(-\327g\035\327"
+	.ascii	"S\232J;\351\267^k\270\266\322R\272\255\325Z\331h]\245\257\264"
+	.ascii	"YGi\267n\322eu\255\331z\311\233I\257\360\333^;\260\352\2250\253"
+	.ascii	"\261\366\352\361\343\305\026\027\217\345\017\276\366\362\321"
+	.ascii	"\327Y4rD1R\341\254r\354\327\026Fg9#\005\"\177R\2212u\330\032"
+	.ascii	"I\223Y\345\030\260*\354\315\262\263\232\255\265j\233U\312\341"
+	.ascii	"\2525!\313\234\225^:*\034P\224P7\327\334\\\323\346\032\333\327"
+	.ascii	"g'g\251\240Z+\250\265\202\023\212\231\266\223N\231,\275\276\033"
+	.ascii	"\302\314\2301\355jZ\316\302\260$K\022\276\376\"#\356\212\035"
+	.ascii	"\022%a1\372~\203\f\274\301j\314\030\263\316\316X\317\027\226"
+	.ascii	"\256;27\353\314/\277#y\3124}M: \332\230\033e}7L\341\2436]\272"
+	.ascii	"\230a\214\276\242\340`p\366{c\004\006\022\023\314\3150l\340\224"
+	.ascii	"\225\351kz1\277\214\351\361\205\b\013\326\216F\227\222\276?\252"
+	.ascii	"\203\341\340#.Z\264\230[8,\301\343#3\227=\356~\314\335\334\022"
+	.ascii	"Wi\264I\301E\325\003\032\213C$\252"
+	.string	"\357\217\3500\207\267+WL,tl\230\234gL\264\352L,\366\314\275\333\322g\247\357\217\260`\016L\334\334\3148\243\257(8\034\204\311\"&\267\327;\300\234A\363v3\316\264\262\243\214\021\263\276&\\\020\227<\036r}\177\344\003?\317\256\371\017\324\320'V\325\367G3\260\004pT\250\230hG\332\252\350\310\321\207%H#E\212\331\026e\254\222\0012D\b\333\31567=TR\312\316\3645\327~vad\320\3645\325*\334\177`\337P^-\341`\t\222@9\024\023\315\bg(R\234,s\366\362\320T\003/\206\362&\232\233\240\264\030,\314\351k\236q\271:\273\323\327\214\362\270.ipK\243/X\002\256%K\314\262\2621\0374\3136h\236\334,\363\261\222\312\203\322\327db:\t\n\243\242\246\206\023\263\311\025\037B\244\312|\354\344\300C\263\202=b\311\300\236\320Q\301\033\360\212\0241\225\254"
+	.string	"\007\210\034 >5_r\222\233J\326\354\374\270\353k\0321\221\374\007\372\314\350\261g\"1\307,\222\"2l\374\310+s3\325\367G\354\016\245Q\267\221\361\306\216\321\023\274\341K\330\315!a\246X\315\253\312\354\365\025\205\027"
+	.string	"\036_\300\310\366\262\225\016\017)\200\360"
+	.ascii	"\243\302M10g\337\232\034\230\031\344\246\220\037\370Cc\367%\255"
+	.ascii	"\357\215\244\260\371\343&\220\037h\346\230\301\206\254\3575\334"
+	.ascii	"\301\277\351\343"
+	.string	"\007\372\b\001#\006\257\3575\350\341kX\342\rk=z\230<\252\220r\252\f\230\261\234\275<\340(\264.2;\274\341H\n)\230<8\224%\341#\273@\232\021\274\0357y\304\325\2665d\262\234a\016]7n\2309j\220\272:?c\270\342\266p\334\314a\273~\362\326\350\242\264\330)&\313\016\035\034\230\303\024\r\032\246\215\232\226\263\214\240 \t\353\362y\361\346N\230\276\277Y\343\246\r353X\032\2460\007\025\202\377\315\0313.\230\321W\024\034\017a\344<\3309pdW}\237\001\017s\350bn\231[rN\032h.\226D\240\364}\006;\f\324\027\274\231efU\275+\225\226\265x\252\322\304~\306\234q\231\351\373\fZ\260Q\225\340M\2545\023\313\302\271Ri9*\310\255\007\02330rld\365}\0067|!K\360&\214\3275\023\206}\363\201\327W\2361"
+	.string	"/W\222\310\251[t*\214\365}\006%\230\350-x\363j\315\274\262i\037\b\371\312\\\035\226d\237(\027wr\364}\006\"\230\003\031\263\312\254\262y\370(\257G\320\226%fv\372>C\016<A\034\223\312l\321T7{\te*7\276\261\fY\370\0312\006@\214\340\315(S\252\352u\220\022\312TXVcs\360\213\336`"
+	.string	"\344`uR/\337\325\273}MU\263\013- \f\030}Eh\360\213\300`"
+	.string	"x\005\177\353\330\251z8\313\341,,\253\"6\374\242\"\030"
+	.string	">\202\277{zwN\221\253\"/\374\242\214'P#G\216\315\303Gghg`\366~\202\330\230\313\361\006[\240#\316\343\\\260\0139S\301ZV\321\301e\327\367\030X\300\030\214]\274\213\247\200\265\275e\366\362\362\340\343\202\217kI\337c\240\2023\300\342\346\302qs\227\027\362W\316c?\2660'\313\037\033,:T\336\374.\253\036P\313\03461\254\231S\rY\217\252\276\307\320\004\033\351\005\177\357\356\0367B\0353\273[b\350\2015"
+	.string	"\242F\315]S\346\205\t\304j\254M\3375@/1\255\276\307P\2055H\202\006\r\037\226a\244\206T\034\254\201\025;;\233\363\016:c\331\313\313CO\027\226\031\257\276'2\2035XC\206\314-\243\314Y\265\r\031/\017\370\216L\230%}\377[\367[&\316\247\n\224\276.DZ0\005t\301_1R\356\230\026\353@%\224\251\304\254\306\326\360\211\3100\005Z\202\277_\256\224\013\246\266\341,\207a\f\351#\372\201O\324\205)0\013\376\316])\267\313\365\242\346\316\365\362\337-\227\2135\353\237\264&9d\364=Q\025\376\345Zt~Y\211\316_\330\303\024\214\005\177\261\\)7\213\rR3\227V\tWv\226n\360/\324a\n\356\202\277qR\256\034\214+.\370\027\252\340#\267\340/\034\234\355\n\376\332\256\330\\(\202)\230\022\374\255r\245\\7\353\365A\013\253,\225D"
+	.ascii	"<\310\\\360\201\177\341\006&\032\013\376N\231R\333>\020\362u"
+	.ascii	"\261\244\216\3405\311\271\313\006\275\344\211\032\221\276\037"
+	.ascii	"R\203\205\270\004\177\331\330Z\354R\245\345-\236#hI\344\\\031"
+	.ascii	"s\270\214\351\373!-\030\250\205\340\257\232\232\355\372U%\021"
+	.ascii	"\223\363{\0026\207\256\357\207\216`\n~\334\264\233\326\001\217"
+	.ascii	"\036C5\360\005d"
+	.string	"\301\013\245\3363\345\343:P\te\030UF\306\206b\340\017e\334\027\3240zWj\372^0$x\235\324[\266\344\232=\016Giex\321Vd)$\007_h\r~\\m\252\234\245.\b\372\001%\r\215\276\027\354\b\336%\365\256\260\3446\251\"\"\224\005_\350\t~\255p\347\0053\310\310l^\020\025\204v`\013\334\202\277H\256\330Mb\265j\346\322\202@\225\227\245\020\025~P\032l\2012\370kD\354\036\371\334\315S\262\024W\207:Qy\203\007\325\341\007y\301?Q\301_\"D\354\013<e\365%\025\306\301\0222|\\<w\250\316\234\364}\320\021l\301\220+\344\n\271*\210\230\003\347\f\314\336\220_\025l\030\025\224\250\325\2663%^@\372>(\013c0\301_ u\355\002i\261\017\246|IqaP\206$\254\253'J\033*\263\276\007\272\2033\270\005\177}\274\256]\037\366\356\203)_\231k"
+	.ascii	"scl\230\364\274\241\343\213\323\367@mp\005J\272k\\\260*C\272"
+	.ascii	",/Xm\343\021Cs\321\243\257\005S\301_\036\177\210\016\356\215"
+	.ascii	"\373U\341p\036\373\271]\r\241\303\007\222\303Gg\301\337\024\326"
+	.ascii	"n\n\265\255\004~1\004F\024\\\201^\360\027\307\275qs\33038J\013"
+	.ascii	"\273\r\021\262\314Z\312\r\016d\004\037(\007\256\340\326\2705"
+	.ascii	"\256W\017\331qm\374z\271\0012\233[\316\351\373<{\346?PiN\205"
+	.ascii	"\275\276\007j\201\215\266\004\177\273\272~p{\270i\004\177\271"
+	.ascii	"\270\232\352\232T\331G\221\261\234\2756\340\211r\306\005\256"
+	.ascii	"\357\177\360p\367\b\376j\255]\255\nw\243\322r\026O\0132n\226"
+	.ascii	">s\002oBB\235\210\351\223\323\020\bL\215D\313d$\n\221i\322\b"
+	.ascii	"b\0024I\002\312$L\026\211B&\241t\b\205L\223\306\343\b\017\360"
+	.ascii	"\244J!\222V\020\231~,\212O\304\264\bE\302\003\300\244QH\\\022"
+	.ascii	"\2328\236X\022Z\201\374y\023\022\022-B-\241M\303d\005\251\022"
+	.ascii	"\352DL{P'\342\taZDC8!)<\221\242"
+	.string	")\204D(\021\201\224h$\201(%\032I\370\021\241D\004&P4\304\242\370\364\004\002PQ8L\246D\024 \240\214)\b\260\002\312H,\022\200\003\017\224<\020\261\002\004\272\004U\034\032\211 \220I(\020 P8\"\233\322\243\361\307$D\2137M\032\217C\223)5\022\221\3053y\034\362\274\t)\331\224\n\2356\2548\"\237\236\204JFb\222\347MH P$T*D\231~$\244\250\tK\304\247\f)\372\200\025H\241$q\005\b(\b/\340\263T<\216\200.\035I\240(R\204%!\332$\2045\bSa\bC\344\231\024\352)@\022R\232\024\026\201N\016\230\200\277\016\222\220F\230\020\246Et\211\247\310\003#\f\006HBBS\241\211\246$\212dBM\2540\241A\b\303\320\204P\004\206H\2414\003\224\021MS\020B !ES\034%Q\200p\301D\212\246\bJ\321\024A@\005@\002\342"
+	.string	"I\310\247\003$\240\007H<\006@b\362YB\223\304\242\220\230\022\215$p\300\"\220N\f\221<J\250\02315B!)H\246\020\026E@\227\216$\202NH\nI\030\217\304!\022\303\233\220P\344q\210\002Z\2020\025\206`\001\023Ib\217\211d\022\035\036\221OF\300\240\221\230\354\001&!!\217\351P(B\3628\354\311\020\002\311H\204\243\t\t\216\016\200\224\204:\022U\240\310\022\022\230\301$\244\025\350\222\221\210\337\2044\0041d\322Pb\bM\205\251\t)\232DM \217H\244\003\220G\021(@\235\210\351\323\361\030\201%b\211\024M\201\024\246CNh\232daB\220OR\022Rj\204:\216@\242\304b\nu\fJN"
+	.ascii	"9\024\024\"\t\351D\232\024\026/\240NB\244\bC\023h*\\z\202*\362"
+	.ascii	"1\337\204\224\002\n\005\272\004b\251H\204Bq\204.\035I\244\200"
+	.ascii	"B\201.\001\223(@\b2\036\211\351\020-2\241!\f\221>KF\241\223\323"
+	.ascii	"q\304\020\t,\032J\242*\220P\033\212B\250t\b\002\2210E\033\200"
+	.ascii	"\246B\023h*,"
+	.string	"B\r\213\302\241\206\021&\236\240N8\036\213B#R#\212DB\r\217\236\001U\201\204\032Q\364!\021\211\032\321\024\370\034x@"
+	.string	"\017D\254\370]\004\002\202\b\b\236\027\201\200\244$\004x\220\204\357A\222M\225\222H\264\b\345"
+	.ascii	"t\t*%\246\251\260(MQ\245%\022NH\nO0\ryR\245\344\004P'b\212\177"
+	.ascii	"(\b\221\366MHPN\304b\361\210\274M\303\224\370d\242 da\223(TQ"
+	.ascii	"\250\342|\023Rr\210"
+	.string	"\0041d\342\220\0341D^\300(\bY\370,\031\205(\226\204\350\322\020\232\"M\n\231\224\226\212\307&\245\264(\304\260\204&\221\250\n\024\251\244\204\202\220\005\2064\304\222\020\312\003D\024@A\024\235\204\242C\240\350$a\207\020v\322R\247oB\002a<:9\035\207\022\234X\352\244\bI\351S\017\232\n\323\244yB\035a\242\213\307c\003\224\3147!-\021\237@\244M)\210E&\243\244R\211%\342\223\217\210\022-\202\204\026\021B\243O,R%\246!\237\0174)1=\025\225P\020\262\340\371@\023\320P\251i\230\036\215J\027R#:D\242%R#\361X\342\tj\311H\254\200\206\036\024\204\027p\2022a\211\370\004\204\246\020\"Q\025B\245\244\021}r:\216X\"\226H\205(T\020\031\211$R\020\226\210OBA,R\242\nbJL\032Q\023\212\250\n\264(TL\323#\262\351D\006#Q\370"
+	.ascii	"\3441\025\"Q'$\232\0221\034\211\251\320\304\na\0215\221\274\220"
+	.ascii	"6\245 \242\025HQ\023\234\220h\272D\304b(%:\021#PD\207C\020\320"
+	.ascii	"T\210\004z\023\322\n$\210\025H\242\025H\236'\241\323\020i\"\321"
+	.ascii	"%\242\212#\362Ii\005\262($\"\321\344\220\361HL&\241P$\201V"
+	.string	"\240\305'\250\020\230\212\302&\236\342qxL\217\310\247\240T)D\001\226\210\300\324\bu\034*1!\225\210OI\245\025H\rC)\232D\221\307\024J\250\264d$\242PJ\205I%'(dz\002\372\224\224\300\007-\n\207I\236\024\211\2520\022\225\210\311$\262g\210\\\":\231F\242\023>a\2106\rW\b\235pPrDQ\250\302x$\246\302\342\361\t\211\246F\022\206H\r\350\023\213\023H4-\022E(\372\300\bLL\307\024jD\n#\261)=\036\235L\030\"\211\222(\212L\201\206\200\026S\030Ap\022\216P\361\304t\241\210\032\215\302\246\241\322\n(\241\322\n\241S\320R\361\330\224D\221M'\320T\250\202\230\016A@\227\216$\220D\241\221\2218D\223PJ+\204NJ+\220=\251\360Xd2\177\351\233\220\320\"\221\351\210|RBS!\022\203\037\237P$\210\364xD\202\350A\237X\234"
+	.ascii	"&\225R\020\231\214\307\021h*4Q<\"S\343qH4D\376D\240\251\320\304"
+	.ascii	"\020\371\023\261D$\201lJ\221M)N\242\251\020i\206@B\td\323\t#"
+	.ascii	"\213%`\252$\"5\022\241~\"\216O+\034\200\202\360\002C$O\252\344"
+	.ascii	"ARj$B\341\013\231\222\222\230\202\006@\221\206~\200\003\214\350"
+	.ascii	"0\201\022\036\200\207HC\244\322\220\t\304\220\t\204\221(t\002"
+	.ascii	"1D&A \025\245F\342\361\351\004!\212D\241$|J\201\376\237a[z"
+	.string	"\255\213\233=0\013\347\303\036\220\264\036f\230\237\235\23567\276\314\272\252\207c+\214\207]\003\360b\374\350\013t2!Ru%\005\373\246\353v\300\241\323q\177 \261R\226\343\252`\316\271E\t\301\021\267\266\003\212\233\033^|xkW\372\276\256\235^&\2264>\234\300P\222\26559SC\354\307\266g\205\213\206\222\240\267\036Yv]e8H\0221;f\230h\227\255\316\205\023\256\353\345\004\373\022%l\313lK\303{\322\345\324\272VG\332x\214\311\022\243\342\206\016\206\214\013\226AU\f9\2543`\322\354l\351{\276\260#\350\353;_\364\031\343\204\361\363\305\203~i\232XI\235\327\203\220\263\305yu\2668\255\200Q@j\262\254\240uV\375\264\nZ\023d\216\205\276\247\013[\307WDo\303\026\f\367\003c\002\3065U\333N\033-\352\270I\2316\202|x\325\241rF\2319\202\322|\375\210\321W"
+	.ascii	"Ru\316l\3261"
+	.string	"\373\372\353\253\f\337\222\357f\337\234\351\342.N]_\363\016\256C\345\314L_\323\316\347\276\210\t\343\261\341\r\377&\035\223\007\225>8w}\225fYYb_{\366\356\207K\315\032\032z]&L\214)SN\2562vf\327\327\214\003$\006\315\2314}\277a\n\376\315\026\362n\b\t\303\343krEG\233\276\036\340\356L8w\346\262ji\341q\220E\212\217l/{uy\370\31577\227q\230\211\2246W\372\232n\036g\242\375\270R\327\327l\363\270 +hi\3046@Q\372\254\2512&\257\257\231\306T\023\204\276\250\203A\264Z<,\245(\f\244\030T\310\241\021\"m\322\001\223\025@Ph4 \025K\350\265\036\023@\203\214\254\225\201\246v\b\231\020IR\222\302\326n\b\261\302\242\214\343\230&d\360\255\355\206A\"\246-\317C\021\277\240\214\353\031\334\262\232K6\323\274\267\250\231\263\366\327\257\262"
+	.string	"j]F\276X\315\317\\\024\234\324\233\272\217\222x\2717\",[\235c\250\034@QN\200B\004\365\270\334\251)'R\343\213\256\370H\032\033\341+\003\374)\020\036^\331P!\375\225\343T\030+)\340\276\007\fU\367\230\332\263u\260p\037Y\244\276\351\326{d\364z\254\005,\227v\326\252\220\221\303D\fN\261Dv\240iV\324\361F\021\017\215\202\336\177\006"
+	.string	""
+	.string	"\rL0<5\333\343\231\347\016\346\007\270\367\374h\364\016\273L}\250\353\033\nz=\330\301\250\210>;%d!\031pS!\264\234\201\247\272L\026\271\027\022\323\253\367\301\347\367"
+	.ascii	"\236r\311\024\226\027\301\314\373\020\335\251'\n\345\fn\313\335"
+	.ascii	"\331\bI\027\275\322\252l3d\275\315\235\236bx.q\333\2664\024-"
+	.ascii	"*\327e\366\245u>\265L\232\244\314\037\b\250\314Q!BV\326K\216"
+	.ascii	"\313Zg\272\342Bs\230\326\335\301>,-52\n(\325\245\226B\257?W@"
+	.ascii	"*k\317\245|\027\346h6Z\320\200p\250\263[\214.2\371\342\235\272"
+	.ascii	"4sN\312H\250\020\2355\260\262\210J\375\004\340\372\004\\\275"
+	.ascii	"\023\037\240\346\024\007,F\334\244\232\344\242\350Qf\317\247"
+	.ascii	"B\233\235\200\007\272\326-\220\313$\340\030\3741F\310\334 ]T"
+	.ascii	"\304\007\207\354\306\0210\2379\341\0377\220\216\320\347]\250"
+	.ascii	"Qt\032\2276\202\353\360\n\352\220D\253\036\025\003(\211\330\214"
+	.ascii	"\266e\026\026\371\036\"\277:X\217=\317\3468\376\377\330\201q"
+	.ascii	"w1\275\221\320v\200\021.\346\242\353\354\b\335M\217\275uI\312"
+	.ascii	"m\335\320\306\313'Q\333\321\361\365=\277\275\022R\224\250\023"
+	.ascii	"\232\030\3663ks\016\240k\224\264\371\265zR\275\024\177pR\327"
+	.ascii	"\251\257\025C\246\300$\305|l\033\334A\n&\036@@:c\261\222\275"
+	.ascii	"\242\334`\232\023&\314Y\274\314U\f\247Z\007\370\223F/\357@\265"
+	.ascii	"\363c\227\035\372x\241\030\317\321\250t=\2136u\036\201\327E\357"
+	.ascii	"q\321\371\360\n\034eJ\370\367\033A\021)\235\270.\244\323\372"
+	.ascii	"\007\007<A\235V\207\024~;\310\234\304\363!;\035U\340\362#\373"
+	.ascii	"\274\343\306\306|\340s\234p\321Y~\226\217\351\023\331Nqv\343"
+	.ascii	"E\217"
+	.string	"\372\336\364\333\016&\215a3\273\325\033\005\264"
+	.string	"\336\341fh\301&Z\262\222\372\324\352*$\242\027\333\364\204=s\262\267O\216;\242$\377\325c\301\267\036H\252\0206*6@\035\324&\2618\241\356NK\351\212"
+	.string	"*\360\"\257\221\323yz\221[v\t\275\213\300#\253,\276;\263\333\2512\342\025\342\f\200\310\312\266\341^\245\033r_J\351\254a|O\032F@&\360\204\027\261\336-_\336\304\261:\277~\246\024\222\217"
+	.string	"\307Z\254|t\250\320o\b\021d\204R<U\334X\306U'\017\305v\345e\264\344\327\317\352\2627&P<t\005]\373\260\352\264l\024\206\246&\300\342`od\361\300\202\032\275l\b\027n\376n\271F6Q\2036\270uK}\326\237\260\212\004\020=?\267<\271RL:BQ\234\007\200\n\323@8\272q\221\235@P\302U\377B\252\025M\226\036+\266\343\216\237\3132\216Y \037\345\\9\356\254^<\300pQ\0355\201\025%x\220\266h\303H\314\016\313\316\002\202\005\035\342\323\026\277\201{P\016\242\230b\f\201 \357\2666\002r\003\251\370l$\237\243R\344G~`?\375\007]\226\233J\315Y\250\346[,\205%\340%\327\373\177\366\306X\323\224\361LE\030\346\250\330\004Rf\325\225\270\351\242\246*>8\206mP\343\312d"
+	.ascii	"\225R\336Qr{\257\210\"\261\025\273\353\3300\021\3627\037\207"
+	.ascii	"\240\264J\340\231dr\225\032p2\251VC\315\331\037\326\036\341$"
+	.ascii	"\275\226\247\276\017\360\344\233\231\236\300\211\231 \321\344"
+	.ascii	"\264M\373K\037\236\004F{\t\bD\335~zRJq\300\006\370F\246\251\244"
+	.ascii	"Ze\317d\330\272\271H\232\353r2\036p\316\301_.R"
+	.string	"\304\254q\224\247:xlo\201])LT\363\215\205AI\336\274@\373\027\3341\037\256)\367Jt\200\263\351\200Z\376\222\324\264\375P\221\220\305\024\224@s\305\317c\300\307W\003\330\246\213\375#8\2227\257\374\364\331\021\nn\0179\203u\024+\262\254B\237\212\254\003w\262\205\3479^\261\036\2170y8\226&r\360}w\213B+:k\302\234\235-\315\345\275\233\264\275\023:r\217S\255Q\307d\331\212)\237\270\355\343\2359,l\322c\312\365V\340SD\013\005I\237\255\326\337\354Qk\034\320L\253\r\350,\310z\034\001\332\313q\340\"\030\274\334\212\005T\304\334b\234\211\211\337/~\\+6\367K\376\002w\363]\3215\031\267\220\310-\234\342\035\261\333I\n\023\313\205\227\"\013n\251\317\t\020\212\224i\327C\272\200\034\007C:U\022\374\2332\341\275\017\3420\217\272\234.\307\304\272$\357\220\002\367?"
+	.string	"\007\220\355\226\270\n\211/\357,\371##\266\350t\321\207\230\035>"
+	.string	"\312\331X\313\007d+!3\344\336\025=m\303Z\276\3555,\2377\367\243K\360\005C6=\213\234n\022\022\322\\\035Z\333\264\214ir\341\265\2730\226\\\235Av\232\357\276\223\351jx#\257\312\244$&\241KW\316=N\277;\361\301\350D+\rR\204)@:c+Z\301\263|\225\345\343\273k(\304\272\300w\212m\305\341^\177\002C\325\367i\273\257\256t\234a(\270\363P\273|\356W\361T\250\252\222b$C\240\273\353\341 \264T\336`\200\036e_o\236\321K\275\334`\214\177\260\275lZ&M\037\350\021n\237\340\264\305\321\366\235KP\302-\224Zu\032\341\236\376\306t\251\300M\354\214`\300\317\273\257\340\353\202{H\377yw\276'6k7\036\241"
+	.string	"\210\027U\254\210\210.h\272"
+	.ascii	"a\032\226\f\210o\022\2001\271{\352\022\266g_\227)\324\355\036"
+	.ascii	"0\355\322\275I\342|&\016##\322\317\226M\325\253g"
+	.string	"\3172\320N\210\3602\234\032\352\223\361\312y\207\275\007\237d\362\323#tJ!\202R\354+\030\361\002\337Tnx\366:\351\373c&&W\352\375B\240\350\037\214\200?\216\210t\371\354\230dJ\216\342\250\374\227J\213,\"\224\271p\020\214\033\377a \375\266@\037\261\313H\b\341\232\f\251\200\020\1772\323\324OW\022\340\367M\321\223\004,^\020`x\373x\260\337L\226\274\350@\276>\246s\335\3313\005\363\237\243#\267\370\277\243\305:\216\312\270FZ=\351\207\204^\351\240\274\320\177\025\364\227\253\326h\261\024\256\\\207\221p\263\315\276kaQ\261\263\301EP>\317\333\236\270u\020`\233\323\032\232\005\200di\213\241\226\036I\217\033/\024'\362dqd\357\364[\34633p\225\376\324Qv\006Z\233\334\273%#\354L\322\302{\363\351\020<\242M\226\337\261:\374n\2166\001\203\374\002\034<C1%IL"
+	.string	"/,\035\252\370J\335\235\230j\033M\035GL3\210\222\213\225\320s\265\320\242\0302\371_\321\230-1\3009%\337\027_\017\n\220U\001\275w[a%\250\3153\342\204\324\201\216!=\325\302mq\013,;\030\342\372j\271\320\241\351c\"_\220\304{-\224V\376\016\030\016\251~\b\327|\023\337\327g\363,\275\013\240ea\006\235\035\235u\0073i6p\305\177\366Tn\354\350\361\356;\213\232S\t\1774\302\311\373\323\303c\345\337\013q\005\363_\260\207\311\ryn\236Y\2763rp\305\365A5\300\005\267\260\341\203\322\323\263\262)b\243\255m\027\001\264\225"
+	.string	"\377\350:\221\347'\235\035\022\017\310\321c\331\343}\177O\370\f79\253\216\250\347\301\377/}\367q\277.l\277\300{~y\263\032-\306\261\027/\366V\206\266\324\t\315\344\032\265\032S\210\343d\232\352\264\305\003`\016\203u\355{y\272j\361>\342\245\302\025k\n\343\323\026\253\327\021\227Bg\203~\263`\233\353+,\217-<\316z\367<^\302\320e\343u\265\260&y\b\235h\321\270\355iU\017>\207\220\001\3075*\302\037\363{\262\356\303\350\213o\215\343\313\343\332#e\304\303\300\035\036\327\024{\204GVZV\310\036\202\316\361\364\370r\311\226\267\t\320*\356<r\347\310\3404\344o\360\276\371=\n^\033\357l\300\330\374\346\027\363\037\351?\353`\356|\372&\242\001v\007\312\226c41\356\021i\355\254[2/\265l\326_'\361{(1(\266\204\363\352(}I\225'\311$\3525"
+	.ascii	"vM4\371\321\340\003\323E\350\177\215\272\355<u\207\316){^\020"
+	.ascii	":\202\317#\356\004\206ED.{\315\311\361l\360}\330\347\177`H7\215"
+	.ascii	"q\f\260AN\223\260\271\337\323\025"
+	.text
+	.section	.gnu.lto_.symtab.1a0d73834549a848,"e",@progbits
+	.string	"getSetpointRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"rcLookupThrottle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"generateRcCurves"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"getRcFrameIntervalUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"processRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"updateRcCommands"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"resetYawAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"headFreeModeHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"biquadFilterUpdateLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"rxFrameTimeUs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"qMultiply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"qConstruct"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1a0d73834549a848,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
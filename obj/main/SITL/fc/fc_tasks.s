@@ -0,0 +1,18497 @@
+	.file	"fc_tasks.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/common/color.h"
+	.file 6 "./src/main/flight/pid.h"
+	.file 7 "./src/main/drivers/io_types.h"
+	.file 8 "./src/main/drivers/sensor.h"
+	.file 9 "./src/main/drivers/accgyro.h"
+	.file 10 "./src/main/drivers/accgyro_mpu.h"
+	.file 11 "./src/main/drivers/resource.h"
+	.file 12 "./src/main/drivers/serial.h"
+	.file 13 "./src/main/fc/config.h"
+	.file 14 "./src/main/common/streambuf.h"
+	.file 15 "./src/main/msp/msp.h"
+	.file 16 "./src/main/fc/runtime_config.h"
+	.file 17 "./src/main/fc/fc_core.h"
+	.file 18 "./src/main/fc/cli.h"
+	.file 19 "./src/main/io/ledstrip.h"
+	.file 20 "./src/main/io/osd.h"
+	.file 21 "./src/main/io/serial.h"
+	.file 22 "./src/main/msp/msp_serial.h"
+	.file 23 "./src/main/rx/rx.h"
+	.file 24 "./src/main/sensors/sensors.h"
+	.file 25 "./src/main/sensors/acceleration.h"
+	.file 26 "./src/main/sensors/current.h"
+	.file 27 "./src/main/sensors/voltage.h"
+	.file 28 "./src/main/sensors/battery.h"
+	.file 29 "./src/main/sensors/compass.h"
+	.file 30 "./src/main/sensors/gyro.h"
+	.file 31 "./src/main/scheduler/scheduler.h"
+	.file 32 "./src/main/flight/altitudehold.h"
+	.file 33 "./src/main/sensors/barometer.h"
+	.file 34 "./src/main/flight/imu.h"
+	.file 35 "./src/main/telemetry/telemetry.h"
+	.file 36 "./src/main/fc/fc_msp.h"
+	.file 37 "./src/main/fc/fc_dispatch.h"
+	.file 38 "./src/main/config/feature.h"
+	.file 39 "./src/main/fc/fc_tasks.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_tasks.c.e590a7d8
+	.weak	fc_tasks.c.e590a7d8
+fc_tasks.c.e590a7d8:
+	.long	0x1a1f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF2503
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1981
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1982
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1983
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1984
+	.uleb128 0x5
+	.long	0x51
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1985
+	.uleb128 0xc
+	.long	0x4a
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1986
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1987
+	.uleb128 0x4
+	.long	.LASF1989
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x70
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1988
+	.uleb128 0x4
+	.long	.LASF1990
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x4
+	.long	.LASF1991
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x8f
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1992
+	.uleb128 0x4
+	.long	.LASF1993
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x3e
+	.uleb128 0x4
+	.long	.LASF1994
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF1995
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5d
+	.uleb128 0x24
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1996
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF1997
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF1998
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0xa2
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1999
+	.uleb128 0x5
+	.long	0xec
+	.uleb128 0x25
+	.uleb128 0x4
+	.long	.LASF2000
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x77
+	.uleb128 0xc
+	.long	0xed
+	.uleb128 0x26
+	.long	0xed
+	.uleb128 0x4
+	.long	.LASF2001
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x4
+	.long	.LASF2002
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0xae
+	.uleb128 0xc
+	.long	0x10f
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2003
+	.uleb128 0x4
+	.long	.LASF2004
+	.byte	0x4
+	.byte	0x19
+	.byte	0x11
+	.long	0xd4
+	.uleb128 0xc
+	.long	0x127
+	.uleb128 0x4
+	.long	.LASF2005
+	.byte	0x4
+	.byte	0x21
+	.byte	0x12
+	.long	0x10f
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x5
+	.byte	0x15
+	.long	0x163
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2034
+	.byte	0x4
+	.byte	0x5
+	.byte	0x34
+	.byte	0x10
+	.long	0x192
+	.uleb128 0xd
+	.string	"h"
+	.byte	0x5
+	.byte	0x35
+	.byte	0xe
+	.long	0x103
+	.byte	0
+	.uleb128 0xd
+	.string	"s"
+	.byte	0x5
+	.byte	0x36
+	.byte	0xd
+	.long	0xed
+	.byte	0x2
+	.uleb128 0xd
+	.string	"v"
+	.byte	0x5
+	.byte	0x37
+	.byte	0xd
+	.long	0xed
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2009
+	.byte	0x5
+	.byte	0x38
+	.byte	0x3
+	.long	0x163
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2010
+	.uleb128 0xe
+	.long	0x19e
+	.long	0x1b5
+	.uleb128 0xf
+	.long	0x22
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	0xed
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x6
+	.byte	0x23
+	.long	0x209
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0xa
+	.byte	0
+	.uleb128 0xe
+	.long	0xd4
+	.long	0x219
+	.uleb128 0xf
+	.long	0x22
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2022
+	.byte	0x7
+	.byte	0x18
+	.byte	0x11
+	.long	0xed
+	.uleb128 0x4
+	.long	.LASF2023
+	.byte	0x7
+	.byte	0x19
+	.byte	0xf
+	.long	0xba
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x8
+	.byte	0x19
+	.long	0x274
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2026
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2027
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2030
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2031
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2032
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2033
+	.byte	0x8
+	.byte	0x23
+	.byte	0x3
+	.long	0x231
+	.uleb128 0x6
+	.long	.LASF2035
+	.byte	0x8
+	.byte	0x8
+	.byte	0x26
+	.byte	0xc
+	.long	0x29b
+	.uleb128 0x2
+	.long	.LASF2036
+	.byte	0x8
+	.byte	0x27
+	.byte	0xe
+	.long	0x225
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2037
+	.byte	0x8
+	.byte	0x8
+	.byte	0x25
+	.long	0x2b4
+	.uleb128 0x1b
+	.string	"spi"
+	.byte	0x8
+	.byte	0x28
+	.byte	0x7
+	.long	0x280
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2037
+	.byte	0x8
+	.byte	0x29
+	.byte	0x3
+	.long	0x29b
+	.uleb128 0xc
+	.long	0x2b4
+	.uleb128 0x4
+	.long	.LASF2038
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x10
+	.long	0x2d1
+	.uleb128 0x5
+	.long	0x2d6
+	.uleb128 0x10
+	.long	0x2e1
+	.uleb128 0x3
+	.long	0x2e1
+	.byte	0
+	.uleb128 0x5
+	.long	0x2e6
+	.uleb128 0x6
+	.long	.LASF2039
+	.byte	0x60
+	.byte	0x9
+	.byte	0x44
+	.byte	0x10
+	.long	0x369
+	.uleb128 0x2
+	.long	.LASF2040
+	.byte	0x9
+	.byte	0x45
+	.byte	0x1a
+	.long	0x2c5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2041
+	.byte	0x9
+	.byte	0x46
+	.byte	0x1a
+	.long	0x369
+	.byte	0x8
+	.uleb128 0xd
+	.string	"bus"
+	.byte	0x9
+	.byte	0x47
+	.byte	0x11
+	.long	0x2b4
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2042
+	.byte	0x9
+	.byte	0x48
+	.byte	0xe
+	.long	0x103
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2043
+	.byte	0x9
+	.byte	0x49
+	.byte	0xd
+	.long	0x51b
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2044
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xa
+	.long	0x4a
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2045
+	.byte	0x9
+	.byte	0x4b
+	.byte	0x14
+	.long	0x274
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2046
+	.byte	0x9
+	.byte	0x4c
+	.byte	0x1a
+	.long	0x50f
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2047
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x18
+	.long	0x455
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2048
+	.byte	0x8
+	.byte	0x30
+	.byte	0xf
+	.long	0x375
+	.uleb128 0x5
+	.long	0x37a
+	.uleb128 0xb
+	.long	0x120
+	.long	0x389
+	.uleb128 0x3
+	.long	0x2e1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2049
+	.byte	0xa
+	.byte	0x7f
+	.byte	0xf
+	.long	0x395
+	.uleb128 0x5
+	.long	0x39a
+	.uleb128 0xb
+	.long	0x120
+	.long	0x3b8
+	.uleb128 0x3
+	.long	0x3b8
+	.uleb128 0x3
+	.long	0xed
+	.uleb128 0x3
+	.long	0xed
+	.uleb128 0x3
+	.long	0x1b5
+	.byte	0
+	.uleb128 0x5
+	.long	0x2c0
+	.uleb128 0x4
+	.long	.LASF2050
+	.byte	0xa
+	.byte	0x80
+	.byte	0xf
+	.long	0x3c9
+	.uleb128 0x5
+	.long	0x3ce
+	.uleb128 0xb
+	.long	0x120
+	.long	0x3e7
+	.uleb128 0x3
+	.long	0x3b8
+	.uleb128 0x3
+	.long	0xed
+	.uleb128 0x3
+	.long	0xed
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2051
+	.byte	0xa
+	.byte	0x81
+	.byte	0xf
+	.long	0x3f3
+	.uleb128 0x5
+	.long	0x3f8
+	.uleb128 0x27
+	.uleb128 0x6
+	.long	.LASF2052
+	.byte	0x30
+	.byte	0xa
+	.byte	0x85
+	.byte	0x10
+	.long	0x455
+	.uleb128 0x2
+	.long	.LASF2053
+	.byte	0xa
+	.byte	0x86
+	.byte	0x1a
+	.long	0x389
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2054
+	.byte	0xa
+	.byte	0x87
+	.byte	0x1b
+	.long	0x3bd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2055
+	.byte	0xa
+	.byte	0x88
+	.byte	0x1a
+	.long	0x389
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2056
+	.byte	0xa
+	.byte	0x89
+	.byte	0x1b
+	.long	0x3bd
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2057
+	.byte	0xa
+	.byte	0x8a
+	.byte	0x13
+	.long	0x3e7
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2058
+	.byte	0xa
+	.byte	0x8b
+	.byte	0xd
+	.long	0xed
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2059
+	.byte	0xa
+	.byte	0x8c
+	.byte	0x3
+	.long	0x3f9
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0xa
+	.byte	0xaa
+	.long	0x4b6
+	.uleb128 0x1
+	.long	.LASF2060
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2061
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2062
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2063
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2064
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2066
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2067
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2068
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2069
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2070
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2071
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2072
+	.byte	0xa
+	.byte	0xb7
+	.byte	0x3
+	.long	0x461
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0xa
+	.byte	0xb9
+	.long	0x4db
+	.uleb128 0x1
+	.long	.LASF2073
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2075
+	.byte	0xa
+	.byte	0xbc
+	.byte	0x3
+	.long	0x4c2
+	.uleb128 0x6
+	.long	.LASF2076
+	.byte	0x8
+	.byte	0xa
+	.byte	0xbe
+	.byte	0x10
+	.long	0x50f
+	.uleb128 0x2
+	.long	.LASF2077
+	.byte	0xa
+	.byte	0xbf
+	.byte	0x11
+	.long	0x4b6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2078
+	.byte	0xa
+	.byte	0xc0
+	.byte	0x19
+	.long	0x4db
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2079
+	.byte	0xa
+	.byte	0xc1
+	.byte	0x3
+	.long	0x4e7
+	.uleb128 0xe
+	.long	0xc8
+	.long	0x52b
+	.uleb128 0xf
+	.long	0x22
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2080
+	.byte	0x9
+	.byte	0x4e
+	.byte	0x3
+	.long	0x2e6
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0xb
+	.byte	0x14
+	.long	0x65e
+	.uleb128 0x1
+	.long	.LASF2081
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2082
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2083
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2084
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2085
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2087
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2088
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2089
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2090
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2091
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2092
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2093
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2094
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2095
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2106
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2116
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2119
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2120
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2121
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2131
+	.long	0x5d
+	.byte	0x16
+	.long	0x67f
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2131
+	.byte	0xc
+	.byte	0x1a
+	.byte	0x3
+	.long	0x65e
+	.uleb128 0x1d
+	.long	.LASF2132
+	.long	0x5d
+	.byte	0x1c
+	.long	0x6d6
+	.uleb128 0x1
+	.long	.LASF2133
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2134
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2135
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2136
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2137
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2138
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2139
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2140
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2141
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2142
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2132
+	.byte	0xc
+	.byte	0x2f
+	.byte	0x3
+	.long	0x68b
+	.uleb128 0x4
+	.long	.LASF2143
+	.byte	0xc
+	.byte	0x31
+	.byte	0x10
+	.long	0x6ee
+	.uleb128 0x5
+	.long	0x6f3
+	.uleb128 0x10
+	.long	0x6fe
+	.uleb128 0x3
+	.long	0x103
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2144
+	.byte	0xc
+	.byte	0x32
+	.byte	0x10
+	.long	0x70a
+	.uleb128 0x5
+	.long	0x70f
+	.uleb128 0x10
+	.long	0x71f
+	.uleb128 0x3
+	.long	0x71f
+	.uleb128 0x3
+	.long	0x29
+	.byte	0
+	.uleb128 0x5
+	.long	0xf9
+	.uleb128 0x6
+	.long	.LASF2145
+	.byte	0x50
+	.byte	0xc
+	.byte	0x34
+	.byte	0x10
+	.long	0x7f5
+	.uleb128 0x2
+	.long	.LASF2146
+	.byte	0xc
+	.byte	0x36
+	.byte	0x24
+	.long	0x8a4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2147
+	.byte	0xc
+	.byte	0x38
+	.byte	0xd
+	.long	0xed
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2148
+	.byte	0xc
+	.byte	0x39
+	.byte	0x10
+	.long	0x67f
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2149
+	.byte	0xc
+	.byte	0x3a
+	.byte	0x13
+	.long	0x6d6
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2150
+	.byte	0xc
+	.byte	0x3c
+	.byte	0xe
+	.long	0x10f
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2151
+	.byte	0xc
+	.byte	0x3e
+	.byte	0xe
+	.long	0x10f
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2152
+	.byte	0xc
+	.byte	0x3f
+	.byte	0xe
+	.long	0x10f
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2153
+	.byte	0xc
+	.byte	0x40
+	.byte	0x17
+	.long	0x8a9
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2154
+	.byte	0xc
+	.byte	0x41
+	.byte	0x17
+	.long	0x8a9
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2155
+	.byte	0xc
+	.byte	0x42
+	.byte	0xe
+	.long	0x10f
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2156
+	.byte	0xc
+	.byte	0x43
+	.byte	0xe
+	.long	0x10f
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2157
+	.byte	0xc
+	.byte	0x44
+	.byte	0xe
+	.long	0x10f
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2158
+	.byte	0xc
+	.byte	0x45
+	.byte	0xe
+	.long	0x10f
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2159
+	.byte	0xc
+	.byte	0x47
+	.byte	0x1e
+	.long	0x6e2
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2160
+	.byte	0xc
+	.byte	0x48
+	.byte	0x23
+	.long	0x6fe
+	.byte	0x48
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2161
+	.byte	0x60
+	.byte	0xc
+	.byte	0x5a
+	.byte	0x8
+	.long	0x89f
+	.uleb128 0x2
+	.long	.LASF2162
+	.byte	0xc
+	.byte	0x5b
+	.byte	0xc
+	.long	0x8d4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2163
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x10
+	.long	0x8ed
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2164
+	.byte	0xc
+	.byte	0x5e
+	.byte	0x10
+	.long	0x8ed
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2165
+	.byte	0xc
+	.byte	0x60
+	.byte	0xf
+	.long	0x901
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2166
+	.byte	0xc
+	.byte	0x63
+	.byte	0xc
+	.long	0x916
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2167
+	.byte	0xc
+	.byte	0x65
+	.byte	0xb
+	.long	0x92a
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2168
+	.byte	0xc
+	.byte	0x67
+	.byte	0xc
+	.long	0x93f
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2169
+	.byte	0xc
+	.byte	0x69
+	.byte	0xc
+	.long	0x959
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2170
+	.byte	0xc
+	.byte	0x6b
+	.byte	0xc
+	.long	0x969
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2171
+	.byte	0xc
+	.byte	0x6c
+	.byte	0xc
+	.long	0x969
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2172
+	.byte	0xc
+	.byte	0x6f
+	.byte	0xb
+	.long	0x987
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2173
+	.byte	0xc
+	.byte	0x71
+	.byte	0xb
+	.long	0x9a0
+	.byte	0x58
+	.byte	0
+	.uleb128 0xc
+	.long	0x7f5
+	.uleb128 0x5
+	.long	0x89f
+	.uleb128 0x5
+	.long	0xfe
+	.uleb128 0x4
+	.long	.LASF2174
+	.byte	0xc
+	.byte	0x49
+	.byte	0x3
+	.long	0x724
+	.uleb128 0xc
+	.long	0x8ae
+	.uleb128 0x10
+	.long	0x8cf
+	.uleb128 0x3
+	.long	0x8cf
+	.uleb128 0x3
+	.long	0xed
+	.byte	0
+	.uleb128 0x5
+	.long	0x8ae
+	.uleb128 0x5
+	.long	0x8bf
+	.uleb128 0xb
+	.long	0x10f
+	.long	0x8e8
+	.uleb128 0x3
+	.long	0x8e8
+	.byte	0
+	.uleb128 0x5
+	.long	0x8ba
+	.uleb128 0x5
+	.long	0x8d9
+	.uleb128 0xb
+	.long	0xed
+	.long	0x901
+	.uleb128 0x3
+	.long	0x8cf
+	.byte	0
+	.uleb128 0x5
+	.long	0x8f2
+	.uleb128 0x10
+	.long	0x916
+	.uleb128 0x3
+	.long	0x8cf
+	.uleb128 0x3
+	.long	0x10f
+	.byte	0
+	.uleb128 0x5
+	.long	0x906
+	.uleb128 0xb
+	.long	0x120
+	.long	0x92a
+	.uleb128 0x3
+	.long	0x8e8
+	.byte	0
+	.uleb128 0x5
+	.long	0x91b
+	.uleb128 0x10
+	.long	0x93f
+	.uleb128 0x3
+	.long	0x8cf
+	.uleb128 0x3
+	.long	0x67f
+	.byte	0
+	.uleb128 0x5
+	.long	0x92f
+	.uleb128 0x10
+	.long	0x959
+	.uleb128 0x3
+	.long	0x8cf
+	.uleb128 0x3
+	.long	0xe7
+	.uleb128 0x3
+	.long	0x29
+	.byte	0
+	.uleb128 0x5
+	.long	0x944
+	.uleb128 0x10
+	.long	0x969
+	.uleb128 0x3
+	.long	0x8cf
+	.byte	0
+	.uleb128 0x5
+	.long	0x95e
+	.uleb128 0xb
+	.long	0x29
+	.long	0x987
+	.uleb128 0x3
+	.long	0x8cf
+	.uleb128 0x3
+	.long	0x1b5
+	.uleb128 0x3
+	.long	0x29
+	.byte	0
+	.uleb128 0x5
+	.long	0x96e
+	.uleb128 0xb
+	.long	0x120
+	.long	0x9a0
+	.uleb128 0x3
+	.long	0x8cf
+	.uleb128 0x3
+	.long	0x6fe
+	.byte	0
+	.uleb128 0x5
+	.long	0x98c
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0xd
+	.byte	0x23
+	.long	0xa82
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0x80
+	.uleb128 0x15
+	.long	.LASF2182
+	.value	0x100
+	.uleb128 0x15
+	.long	.LASF2183
+	.value	0x200
+	.uleb128 0x15
+	.long	.LASF2184
+	.value	0x400
+	.uleb128 0x15
+	.long	.LASF2185
+	.value	0x1000
+	.uleb128 0x15
+	.long	.LASF2186
+	.value	0x2000
+	.uleb128 0x15
+	.long	.LASF2187
+	.value	0x4000
+	.uleb128 0x15
+	.long	.LASF2188
+	.value	0x8000
+	.uleb128 0x9
+	.long	.LASF2189
+	.long	0x10000
+	.uleb128 0x9
+	.long	.LASF2190
+	.long	0x20000
+	.uleb128 0x9
+	.long	.LASF2191
+	.long	0x40000
+	.uleb128 0x9
+	.long	.LASF2192
+	.long	0x80000
+	.uleb128 0x9
+	.long	.LASF2193
+	.long	0x100000
+	.uleb128 0x9
+	.long	.LASF2194
+	.long	0x200000
+	.uleb128 0x9
+	.long	.LASF2195
+	.long	0x400000
+	.uleb128 0x9
+	.long	.LASF2196
+	.long	0x800000
+	.uleb128 0x9
+	.long	.LASF2197
+	.long	0x1000000
+	.uleb128 0x9
+	.long	.LASF2198
+	.long	0x2000000
+	.uleb128 0x9
+	.long	.LASF2199
+	.long	0x4000000
+	.uleb128 0x9
+	.long	.LASF2200
+	.long	0x8000000
+	.uleb128 0x9
+	.long	.LASF2201
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2202
+	.byte	0x10
+	.byte	0xe
+	.byte	0x19
+	.byte	0x10
+	.long	0xaaa
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0xe
+	.byte	0x1a
+	.byte	0xe
+	.long	0x1b5
+	.byte	0
+	.uleb128 0xd
+	.string	"end"
+	.byte	0xe
+	.byte	0x1b
+	.byte	0xe
+	.long	0x1b5
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2203
+	.byte	0xe
+	.byte	0x1c
+	.byte	0x3
+	.long	0xa82
+	.uleb128 0x7
+	.byte	0x5
+	.long	0x29
+	.byte	0xf
+	.byte	0x19
+	.long	0xad4
+	.uleb128 0x1
+	.long	.LASF2204
+	.byte	0x1
+	.uleb128 0x1e
+	.long	.LASF2205
+	.uleb128 0x1
+	.long	.LASF2206
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2207
+	.byte	0xf
+	.byte	0x1d
+	.byte	0x3
+	.long	0xab6
+	.uleb128 0x4
+	.long	.LASF2208
+	.byte	0xf
+	.byte	0x23
+	.byte	0xf
+	.long	0xaec
+	.uleb128 0x5
+	.long	0xaf1
+	.uleb128 0xb
+	.long	0x29
+	.long	0xb0f
+	.uleb128 0x3
+	.long	0x10f
+	.uleb128 0x3
+	.long	0x10f
+	.uleb128 0x3
+	.long	0x1b5
+	.uleb128 0x3
+	.long	0x29
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2209
+	.byte	0x28
+	.byte	0xf
+	.byte	0x25
+	.byte	0x10
+	.long	0xb78
+	.uleb128 0xd
+	.string	"buf"
+	.byte	0xf
+	.byte	0x26
+	.byte	0xc
+	.long	0xaaa
+	.byte	0
+	.uleb128 0xd
+	.string	"cmd"
+	.byte	0xf
+	.byte	0x27
+	.byte	0xe
+	.long	0x103
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2210
+	.byte	0xf
+	.byte	0x28
+	.byte	0xd
+	.long	0xc8
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2211
+	.byte	0xf
+	.byte	0x2d
+	.byte	0xe
+	.long	0x103
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2212
+	.byte	0xf
+	.byte	0x2e
+	.byte	0xe
+	.long	0x103
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2213
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x14
+	.long	0xae0
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2214
+	.byte	0xf
+	.byte	0x30
+	.byte	0xe
+	.long	0x10f
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2215
+	.byte	0xf
+	.byte	0x31
+	.byte	0x3
+	.long	0xb0f
+	.uleb128 0x4
+	.long	.LASF2216
+	.byte	0xf
+	.byte	0x34
+	.byte	0x10
+	.long	0xb90
+	.uleb128 0x5
+	.long	0xb95
+	.uleb128 0x10
+	.long	0xba0
+	.uleb128 0x3
+	.long	0xba0
+	.byte	0
+	.uleb128 0x5
+	.long	0x724
+	.uleb128 0x4
+	.long	.LASF2217
+	.byte	0xf
+	.byte	0x35
+	.byte	0x17
+	.long	0xbb1
+	.uleb128 0x5
+	.long	0xbb6
+	.uleb128 0xb
+	.long	0xad4
+	.long	0xbcf
+	.uleb128 0x3
+	.long	0xbcf
+	.uleb128 0x3
+	.long	0xbcf
+	.uleb128 0x3
+	.long	0xbd4
+	.byte	0
+	.uleb128 0x5
+	.long	0xb78
+	.uleb128 0x5
+	.long	0xb84
+	.uleb128 0x4
+	.long	.LASF2218
+	.byte	0xf
+	.byte	0x37
+	.byte	0xf
+	.long	0xbe5
+	.uleb128 0x5
+	.long	0xbea
+	.uleb128 0xb
+	.long	0x120
+	.long	0xbfe
+	.uleb128 0x3
+	.long	0x103
+	.uleb128 0x3
+	.long	0xbfe
+	.byte	0
+	.uleb128 0x5
+	.long	0xaaa
+	.uleb128 0x11
+	.long	.LASF2223
+	.byte	0x11
+	.byte	0x1b
+	.byte	0xc
+	.long	0x120
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x10
+	.byte	0x15
+	.long	0xc34
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2222
+	.byte	0x8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2224
+	.byte	0x10
+	.byte	0x1c
+	.byte	0x10
+	.long	0xed
+	.uleb128 0x11
+	.long	.LASF2225
+	.byte	0x12
+	.byte	0x14
+	.byte	0x10
+	.long	0xed
+	.uleb128 0x6
+	.long	.LASF2226
+	.byte	0x6
+	.byte	0x13
+	.byte	0x7c
+	.byte	0x10
+	.long	0xc67
+	.uleb128 0x2
+	.long	.LASF2227
+	.byte	0x13
+	.byte	0x7d
+	.byte	0xd
+	.long	0xc67
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xed
+	.long	0xc77
+	.uleb128 0xf
+	.long	0x22
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2228
+	.byte	0x13
+	.byte	0x7e
+	.byte	0x3
+	.long	0xc4c
+	.uleb128 0xc
+	.long	0xc77
+	.uleb128 0x6
+	.long	.LASF2229
+	.byte	0xb
+	.byte	0x13
+	.byte	0x80
+	.byte	0x10
+	.long	0xca3
+	.uleb128 0x2
+	.long	.LASF2227
+	.byte	0x13
+	.byte	0x81
+	.byte	0xd
+	.long	0xca3
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xed
+	.long	0xcb3
+	.uleb128 0xf
+	.long	0x22
+	.byte	0xa
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2230
+	.byte	0x13
+	.byte	0x82
+	.byte	0x3
+	.long	0xc88
+	.uleb128 0x1c
+	.long	.LASF2231
+	.byte	0x99
+	.byte	0xd
+	.long	0xcca
+	.uleb128 0x5
+	.long	0x192
+	.uleb128 0x1c
+	.long	.LASF2232
+	.byte	0x9a
+	.byte	0x1b
+	.long	0xcda
+	.uleb128 0x5
+	.long	0xc83
+	.uleb128 0x1c
+	.long	.LASF2233
+	.byte	0x9b
+	.byte	0x17
+	.long	0xcb3
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x14
+	.byte	0x1c
+	.long	0xd93
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2242
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2245
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x19
+	.byte	0
+	.uleb128 0x7
+	.byte	0x5
+	.long	0x29
+	.byte	0x15
+	.byte	0x47
+	.long	0xde7
+	.uleb128 0x1e
+	.long	.LASF2260
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2269
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2270
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2271
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2272
+	.byte	0x15
+	.byte	0x54
+	.byte	0x3
+	.long	0xd93
+	.uleb128 0x6
+	.long	.LASF2273
+	.byte	0xc
+	.byte	0x15
+	.byte	0x69
+	.byte	0x10
+	.long	0xe4f
+	.uleb128 0x2
+	.long	.LASF2274
+	.byte	0x15
+	.byte	0x6a
+	.byte	0xe
+	.long	0x103
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2147
+	.byte	0x15
+	.byte	0x6b
+	.byte	0x1c
+	.long	0xde7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2275
+	.byte	0x15
+	.byte	0x6c
+	.byte	0xd
+	.long	0xed
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2276
+	.byte	0x15
+	.byte	0x6d
+	.byte	0xd
+	.long	0xed
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2277
+	.byte	0x15
+	.byte	0x6e
+	.byte	0xd
+	.long	0xed
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2278
+	.byte	0x15
+	.byte	0x6f
+	.byte	0xd
+	.long	0xed
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2279
+	.byte	0x15
+	.byte	0x70
+	.byte	0x3
+	.long	0xdf3
+	.uleb128 0x6
+	.long	.LASF2280
+	.byte	0x64
+	.byte	0x15
+	.byte	0x72
+	.byte	0x10
+	.long	0xe90
+	.uleb128 0x2
+	.long	.LASF2281
+	.byte	0x15
+	.byte	0x73
+	.byte	0x18
+	.long	0xe90
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2282
+	.byte	0x15
+	.byte	0x74
+	.byte	0xe
+	.long	0x103
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2283
+	.byte	0x15
+	.byte	0x75
+	.byte	0xd
+	.long	0xed
+	.byte	0x62
+	.byte	0
+	.uleb128 0xe
+	.long	0xe4f
+	.long	0xea0
+	.uleb128 0xf
+	.long	0x22
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2284
+	.byte	0x15
+	.byte	0x76
+	.byte	0x3
+	.long	0xe5b
+	.uleb128 0xc
+	.long	0xea0
+	.uleb128 0x11
+	.long	.LASF2285
+	.byte	0x15
+	.byte	0x78
+	.byte	0x17
+	.long	0xea0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x16
+	.byte	0x37
+	.long	0xed6
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2288
+	.byte	0x16
+	.byte	0x3a
+	.byte	0x3
+	.long	0xebd
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x17
+	.byte	0x31
+	.long	0xf31
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2295
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2296
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0xa
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2300
+	.byte	0x2c
+	.byte	0x17
+	.byte	0x76
+	.byte	0x10
+	.long	0x1084
+	.uleb128 0x2
+	.long	.LASF2301
+	.byte	0x17
+	.byte	0x77
+	.byte	0xd
+	.long	0x1084
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2302
+	.byte	0x17
+	.byte	0x78
+	.byte	0xd
+	.long	0xed
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2303
+	.byte	0x17
+	.byte	0x79
+	.byte	0xd
+	.long	0xed
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2304
+	.byte	0x17
+	.byte	0x7a
+	.byte	0xd
+	.long	0xed
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2305
+	.byte	0x17
+	.byte	0x7b
+	.byte	0xd
+	.long	0xed
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2306
+	.byte	0x17
+	.byte	0x7c
+	.byte	0xe
+	.long	0x10f
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2307
+	.byte	0x17
+	.byte	0x7d
+	.byte	0xd
+	.long	0xed
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2308
+	.byte	0x17
+	.byte	0x7e
+	.byte	0xd
+	.long	0xed
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2309
+	.byte	0x17
+	.byte	0x7f
+	.byte	0xd
+	.long	0xed
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2310
+	.byte	0x17
+	.byte	0x80
+	.byte	0xd
+	.long	0xed
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2311
+	.byte	0x17
+	.byte	0x81
+	.byte	0xd
+	.long	0xed
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2312
+	.byte	0x17
+	.byte	0x82
+	.byte	0xd
+	.long	0xed
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2313
+	.byte	0x17
+	.byte	0x83
+	.byte	0xe
+	.long	0x103
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2314
+	.byte	0x17
+	.byte	0x84
+	.byte	0xe
+	.long	0x103
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2315
+	.byte	0x17
+	.byte	0x85
+	.byte	0xe
+	.long	0x103
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2316
+	.byte	0x17
+	.byte	0x86
+	.byte	0xd
+	.long	0xed
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2317
+	.byte	0x17
+	.byte	0x87
+	.byte	0xd
+	.long	0xed
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF2318
+	.byte	0x17
+	.byte	0x88
+	.byte	0xd
+	.long	0xed
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2319
+	.byte	0x17
+	.byte	0x89
+	.byte	0xd
+	.long	0xed
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2320
+	.byte	0x17
+	.byte	0x8a
+	.byte	0xd
+	.long	0xed
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2321
+	.byte	0x17
+	.byte	0x8b
+	.byte	0xd
+	.long	0xed
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2322
+	.byte	0x17
+	.byte	0x8c
+	.byte	0xd
+	.long	0xed
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2323
+	.byte	0x17
+	.byte	0x8d
+	.byte	0xe
+	.long	0x103
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2324
+	.byte	0x17
+	.byte	0x8f
+	.byte	0xe
+	.long	0x103
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2325
+	.byte	0x17
+	.byte	0x90
+	.byte	0xe
+	.long	0x103
+	.byte	0x28
+	.byte	0
+	.uleb128 0xe
+	.long	0xed
+	.long	0x1094
+	.uleb128 0xf
+	.long	0x22
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2326
+	.byte	0x17
+	.byte	0x91
+	.byte	0x3
+	.long	0xf31
+	.uleb128 0xc
+	.long	0x1094
+	.uleb128 0x11
+	.long	.LASF2327
+	.byte	0x17
+	.byte	0x93
+	.byte	0x13
+	.long	0x1094
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x18
+	.byte	0x14
+	.long	0x10dc
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2333
+	.byte	0x6
+	.byte	0x18
+	.byte	0x1e
+	.byte	0x10
+	.long	0x1111
+	.uleb128 0x2
+	.long	.LASF2334
+	.byte	0x18
+	.byte	0x1f
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2335
+	.byte	0x18
+	.byte	0x20
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0xd
+	.string	"yaw"
+	.byte	0x18
+	.byte	0x21
+	.byte	0xd
+	.long	0xc8
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2336
+	.byte	0x18
+	.byte	0x22
+	.byte	0x3
+	.long	0x10dc
+	.uleb128 0x1a
+	.long	.LASF2337
+	.byte	0x6
+	.byte	0x18
+	.byte	0x24
+	.long	0x1142
+	.uleb128 0x1b
+	.string	"raw"
+	.byte	0x18
+	.byte	0x25
+	.byte	0xd
+	.long	0x51b
+	.uleb128 0x1f
+	.long	.LASF2338
+	.byte	0x18
+	.byte	0x26
+	.byte	0x1f
+	.long	0x1111
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2339
+	.byte	0x18
+	.byte	0x27
+	.byte	0x3
+	.long	0x111d
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x18
+	.byte	0x2d
+	.long	0x1185
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2347
+	.byte	0x78
+	.byte	0x19
+	.byte	0x2c
+	.byte	0x10
+	.long	0x11c7
+	.uleb128 0xd
+	.string	"dev"
+	.byte	0x19
+	.byte	0x2d
+	.byte	0xe
+	.long	0x52b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2348
+	.byte	0x19
+	.byte	0x2e
+	.byte	0xe
+	.long	0x10f
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0x19
+	.byte	0x2f
+	.byte	0xd
+	.long	0x209
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0x19
+	.byte	0x30
+	.byte	0x9
+	.long	0x120
+	.byte	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2351
+	.byte	0x19
+	.byte	0x31
+	.byte	0x3
+	.long	0x1185
+	.uleb128 0x28
+	.string	"acc"
+	.byte	0x19
+	.byte	0x33
+	.byte	0xe
+	.long	0x11c7
+	.uleb128 0x6
+	.long	.LASF2352
+	.byte	0x4
+	.byte	0x19
+	.byte	0x35
+	.byte	0x10
+	.long	0x1207
+	.uleb128 0x2
+	.long	.LASF2334
+	.byte	0x19
+	.byte	0x36
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2335
+	.byte	0x19
+	.byte	0x37
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2353
+	.byte	0x19
+	.byte	0x38
+	.byte	0x3
+	.long	0x11df
+	.uleb128 0x1a
+	.long	.LASF2354
+	.byte	0x4
+	.byte	0x19
+	.byte	0x3a
+	.long	0x1238
+	.uleb128 0x1b
+	.string	"raw"
+	.byte	0x19
+	.byte	0x3b
+	.byte	0xd
+	.long	0x1238
+	.uleb128 0x1f
+	.long	.LASF2338
+	.byte	0x19
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x1207
+	.byte	0
+	.uleb128 0xe
+	.long	0xc8
+	.long	0x1248
+	.uleb128 0xf
+	.long	0x22
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2355
+	.byte	0x19
+	.byte	0x3d
+	.byte	0x3
+	.long	0x1213
+	.uleb128 0x6
+	.long	.LASF2356
+	.byte	0x14
+	.byte	0x19
+	.byte	0x40
+	.byte	0x10
+	.long	0x12a3
+	.uleb128 0x2
+	.long	.LASF2357
+	.byte	0x19
+	.byte	0x41
+	.byte	0xe
+	.long	0x103
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2358
+	.byte	0x19
+	.byte	0x42
+	.byte	0x14
+	.long	0x274
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2359
+	.byte	0x19
+	.byte	0x43
+	.byte	0xd
+	.long	0xed
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2360
+	.byte	0x19
+	.byte	0x44
+	.byte	0x1b
+	.long	0x1142
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2361
+	.byte	0x19
+	.byte	0x45
+	.byte	0x19
+	.long	0x1248
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2362
+	.byte	0x19
+	.byte	0x46
+	.byte	0x3
+	.long	0x1254
+	.uleb128 0x11
+	.long	.LASF2363
+	.byte	0x19
+	.byte	0x48
+	.byte	0x1e
+	.long	0x12a3
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x1a
+	.byte	0x16
+	.long	0x12e6
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2369
+	.byte	0x1a
+	.byte	0x1c
+	.byte	0x3
+	.long	0x12bb
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x1b
+	.byte	0x1a
+	.long	0x1311
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2373
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x3
+	.long	0x12f2
+	.uleb128 0x6
+	.long	.LASF2374
+	.byte	0x14
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x10
+	.long	0x13ba
+	.uleb128 0x2
+	.long	.LASF2375
+	.byte	0x1c
+	.byte	0x1d
+	.byte	0xd
+	.long	0xed
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2376
+	.byte	0x1c
+	.byte	0x1e
+	.byte	0xd
+	.long	0xed
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2377
+	.byte	0x1c
+	.byte	0x1f
+	.byte	0xd
+	.long	0xed
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2378
+	.byte	0x1c
+	.byte	0x20
+	.byte	0xd
+	.long	0xed
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2379
+	.byte	0x1c
+	.byte	0x22
+	.byte	0x1a
+	.long	0x1311
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2380
+	.byte	0x1c
+	.byte	0x25
+	.byte	0x1a
+	.long	0x12e6
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2381
+	.byte	0x1c
+	.byte	0x26
+	.byte	0xe
+	.long	0x103
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2382
+	.byte	0x1c
+	.byte	0x29
+	.byte	0x9
+	.long	0x120
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2383
+	.byte	0x1c
+	.byte	0x2a
+	.byte	0x9
+	.long	0x120
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF2384
+	.byte	0x1c
+	.byte	0x2b
+	.byte	0xd
+	.long	0xed
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2385
+	.byte	0x1c
+	.byte	0x2c
+	.byte	0xd
+	.long	0xed
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2386
+	.byte	0x1c
+	.byte	0x2d
+	.byte	0x3
+	.long	0x131d
+	.uleb128 0xc
+	.long	0x13ba
+	.uleb128 0x11
+	.long	.LASF2387
+	.byte	0x1c
+	.byte	0x2f
+	.byte	0x18
+	.long	0x13ba
+	.uleb128 0x6
+	.long	.LASF2388
+	.byte	0x10
+	.byte	0x1d
+	.byte	0x2a
+	.byte	0x10
+	.long	0x1426
+	.uleb128 0x2
+	.long	.LASF2389
+	.byte	0x1d
+	.byte	0x2b
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2390
+	.byte	0x1d
+	.byte	0x2d
+	.byte	0x14
+	.long	0x274
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2391
+	.byte	0x1d
+	.byte	0x2e
+	.byte	0xd
+	.long	0xed
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2392
+	.byte	0x1d
+	.byte	0x2f
+	.byte	0xd
+	.long	0x219
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2393
+	.byte	0x1d
+	.byte	0x30
+	.byte	0x1b
+	.long	0x1142
+	.byte	0xa
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2394
+	.byte	0x1d
+	.byte	0x31
+	.byte	0x3
+	.long	0x13d7
+	.uleb128 0x11
+	.long	.LASF2395
+	.byte	0x1d
+	.byte	0x33
+	.byte	0x18
+	.long	0x1426
+	.uleb128 0x6
+	.long	.LASF2396
+	.byte	0x10
+	.byte	0x1e
+	.byte	0x2c
+	.byte	0x10
+	.long	0x1466
+	.uleb128 0x2
+	.long	.LASF2397
+	.byte	0x1e
+	.byte	0x2d
+	.byte	0xe
+	.long	0x10f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2398
+	.byte	0x1e
+	.byte	0x2e
+	.byte	0xb
+	.long	0x1a5
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2399
+	.byte	0x1e
+	.byte	0x2f
+	.byte	0x3
+	.long	0x143e
+	.uleb128 0x11
+	.long	.LASF2400
+	.byte	0x1e
+	.byte	0x31
+	.byte	0xf
+	.long	0x1466
+	.uleb128 0x10
+	.long	0x1489
+	.uleb128 0x3
+	.long	0x138
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x1f
+	.byte	0x16
+	.long	0x14c0
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2406
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2407
+	.byte	0xff
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x5d
+	.byte	0x1f
+	.byte	0x3c
+	.long	0x1539
+	.uleb128 0x1
+	.long	.LASF2408
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2409
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2410
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2411
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2412
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2419
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2426
+	.byte	0x1f
+	.byte	0x8b
+	.byte	0x3
+	.long	0x14c0
+	.uleb128 0x29
+	.byte	0x90
+	.byte	0x1f
+	.byte	0x8d
+	.byte	0x9
+	.long	0x1646
+	.uleb128 0x2
+	.long	.LASF2427
+	.byte	0x1f
+	.byte	0x8f
+	.byte	0x12
+	.long	0x45
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2428
+	.byte	0x1f
+	.byte	0x90
+	.byte	0x12
+	.long	0x45
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2429
+	.byte	0x1f
+	.byte	0x91
+	.byte	0xb
+	.long	0x165a
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2430
+	.byte	0x1f
+	.byte	0x92
+	.byte	0xc
+	.long	0x165f
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2431
+	.byte	0x1f
+	.byte	0x93
+	.byte	0x11
+	.long	0x127
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2432
+	.byte	0x1f
+	.byte	0x94
+	.byte	0x13
+	.long	0xf9
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2433
+	.byte	0x1f
+	.byte	0x97
+	.byte	0xe
+	.long	0x103
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2434
+	.byte	0x1f
+	.byte	0x98
+	.byte	0xe
+	.long	0x103
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2435
+	.byte	0x1f
+	.byte	0x99
+	.byte	0x11
+	.long	0x127
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2436
+	.byte	0x1f
+	.byte	0x9a
+	.byte	0xe
+	.long	0x138
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2437
+	.byte	0x1f
+	.byte	0x9b
+	.byte	0xe
+	.long	0x138
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2438
+	.byte	0x1f
+	.byte	0x9d
+	.byte	0xe
+	.long	0x138
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2439
+	.byte	0x1f
+	.byte	0x9e
+	.byte	0xc
+	.long	0xbc
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2440
+	.byte	0x1f
+	.byte	0x9f
+	.byte	0xd
+	.long	0xed
+	.byte	0x3d
+	.uleb128 0x2
+	.long	.LASF2441
+	.byte	0x1f
+	.byte	0xa4
+	.byte	0xe
+	.long	0x138
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2442
+	.byte	0x1f
+	.byte	0xa5
+	.byte	0xe
+	.long	0x138
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2443
+	.byte	0x1f
+	.byte	0xa6
+	.byte	0xe
+	.long	0x138
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2444
+	.byte	0x1f
+	.byte	0xa8
+	.byte	0xe
+	.long	0x1664
+	.byte	0x4c
+	.uleb128 0x2
+	.long	.LASF2445
+	.byte	0x1f
+	.byte	0xa9
+	.byte	0xe
+	.long	0x1664
+	.byte	0x6c
+	.byte	0
+	.uleb128 0xb
+	.long	0x120
+	.long	0x165a
+	.uleb128 0x3
+	.long	0x138
+	.uleb128 0x3
+	.long	0x127
+	.byte	0
+	.uleb128 0x5
+	.long	0x1646
+	.uleb128 0x5
+	.long	0x147e
+	.uleb128 0xe
+	.long	0x103
+	.long	0x1674
+	.uleb128 0xf
+	.long	0x22
+	.byte	0xf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2446
+	.byte	0x1f
+	.byte	0xac
+	.byte	0x3
+	.long	0x1545
+	.uleb128 0xe
+	.long	0x1674
+	.long	0x1690
+	.uleb128 0xf
+	.long	0x22
+	.byte	0xe
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2447
+	.byte	0x1f
+	.byte	0xae
+	.byte	0x11
+	.long	0x1680
+	.uleb128 0x2a
+	.long	0x1690
+	.byte	0x27
+	.value	0x159
+	.byte	0xa
+	.uleb128 0x8
+	.long	.LASF2450
+	.byte	0x19
+	.byte	0x4e
+	.long	0x16b6
+	.uleb128 0x3
+	.long	0x16b6
+	.byte	0
+	.uleb128 0x5
+	.long	0x1248
+	.uleb128 0x12
+	.long	.LASF2448
+	.byte	0x20
+	.byte	0x25
+	.uleb128 0x12
+	.long	.LASF2449
+	.byte	0x11
+	.byte	0x2f
+	.uleb128 0x8
+	.long	.LASF2451
+	.byte	0x11
+	.byte	0x2e
+	.long	0x16da
+	.uleb128 0x3
+	.long	0x138
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2455
+	.byte	0x16
+	.byte	0x8d
+	.byte	0xd
+	.long	0x127
+	.uleb128 0x16
+	.long	.LASF2461
+	.byte	0x24
+	.byte	0x17
+	.byte	0xd
+	.long	0xad4
+	.long	0x1706
+	.uleb128 0x3
+	.long	0xbcf
+	.uleb128 0x3
+	.long	0xbcf
+	.uleb128 0x3
+	.long	0xbd4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2452
+	.byte	0x16
+	.byte	0x87
+	.long	0x171c
+	.uleb128 0x3
+	.long	0xed6
+	.uleb128 0x3
+	.long	0xba5
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2453
+	.byte	0x12
+	.byte	0x18
+	.uleb128 0x8
+	.long	.LASF2454
+	.byte	0x1d
+	.byte	0x37
+	.long	0x1739
+	.uleb128 0x3
+	.long	0x10f
+	.uleb128 0x3
+	.long	0x1739
+	.byte	0
+	.uleb128 0x5
+	.long	0x111d
+	.uleb128 0x18
+	.long	.LASF2456
+	.byte	0x21
+	.byte	0x36
+	.byte	0xa
+	.long	0x10f
+	.uleb128 0x8
+	.long	.LASF2457
+	.byte	0x22
+	.byte	0x46
+	.long	0x175b
+	.uleb128 0x3
+	.long	0x138
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2458
+	.byte	0x21
+	.byte	0x37
+	.byte	0x5
+	.long	0x120
+	.uleb128 0x8
+	.long	.LASF2459
+	.byte	0x23
+	.byte	0x41
+	.long	0x1778
+	.uleb128 0x3
+	.long	0x10f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2460
+	.byte	0x23
+	.byte	0x40
+	.uleb128 0x16
+	.long	.LASF2462
+	.byte	0x24
+	.byte	0x18
+	.byte	0x5
+	.long	0x120
+	.long	0x179a
+	.uleb128 0x3
+	.long	0x103
+	.uleb128 0x3
+	.long	0xbfe
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2463
+	.byte	0x16
+	.byte	0x8e
+	.long	0x17b0
+	.uleb128 0x3
+	.long	0x138
+	.uleb128 0x3
+	.long	0xbd9
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2464
+	.byte	0x1c
+	.byte	0x4e
+	.long	0x17c1
+	.uleb128 0x3
+	.long	0x138
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2465
+	.byte	0x1c
+	.byte	0x39
+	.long	0x17d2
+	.uleb128 0x3
+	.long	0x138
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2466
+	.byte	0x25
+	.byte	0x1f
+	.long	0x17e3
+	.uleb128 0x3
+	.long	0x10f
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2467
+	.byte	0x17
+	.byte	0xa7
+	.byte	0x5
+	.long	0x120
+	.long	0x17fe
+	.uleb128 0x3
+	.long	0x138
+	.uleb128 0x3
+	.long	0x127
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2468
+	.byte	0x22
+	.byte	0x47
+	.long	0x180f
+	.uleb128 0x3
+	.long	0x138
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2469
+	.byte	0x11
+	.byte	0x33
+	.long	0x1820
+	.uleb128 0x3
+	.long	0x138
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2470
+	.byte	0x1f
+	.byte	0xc1
+	.long	0x1831
+	.uleb128 0x3
+	.long	0x138
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2471
+	.byte	0x25
+	.byte	0x1d
+	.byte	0x5
+	.long	0x120
+	.uleb128 0x16
+	.long	.LASF2472
+	.byte	0x26
+	.byte	0x1e
+	.byte	0x5
+	.long	0x120
+	.long	0x1853
+	.uleb128 0x3
+	.long	0x10f
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2473
+	.byte	0x10
+	.byte	0x47
+	.byte	0x5
+	.long	0x120
+	.long	0x1869
+	.uleb128 0x3
+	.long	0x10f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2474
+	.byte	0x11
+	.byte	0x32
+	.uleb128 0x8
+	.long	.LASF2475
+	.byte	0x1f
+	.byte	0xb4
+	.long	0x1886
+	.uleb128 0x3
+	.long	0x1539
+	.uleb128 0x3
+	.long	0x120
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2476
+	.byte	0x1f
+	.byte	0xb3
+	.long	0x189c
+	.uleb128 0x3
+	.long	0x1539
+	.uleb128 0x3
+	.long	0x10f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2477
+	.byte	0x1f
+	.byte	0xbf
+	.uleb128 0x12
+	.long	.LASF2478
+	.byte	0x1c
+	.byte	0x40
+	.uleb128 0x12
+	.long	.LASF2479
+	.byte	0x1c
+	.byte	0x3f
+	.uleb128 0x12
+	.long	.LASF2480
+	.byte	0x1c
+	.byte	0x3a
+	.uleb128 0x20
+	.long	.LASF2491
+	.byte	0xef
+	.long	0x18e4
+	.uleb128 0x19
+	.long	.LASF2481
+	.byte	0xff
+	.byte	0x9
+	.long	0x120
+	.uleb128 0x21
+	.long	.LASF2482
+	.value	0x101
+	.long	0x120
+	.uleb128 0x21
+	.long	.LASF2483
+	.value	0x104
+	.long	0x120
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2484
+	.byte	0xd8
+	.long	0x18fa
+	.uleb128 0x13
+	.long	.LASF2486
+	.byte	0xd8
+	.byte	0x24
+	.long	0x138
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2485
+	.byte	0xc9
+	.long	0x1910
+	.uleb128 0x13
+	.long	.LASF2486
+	.byte	0xc9
+	.byte	0x2c
+	.long	0x138
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2487
+	.byte	0xbb
+	.long	0x1933
+	.uleb128 0x13
+	.long	.LASF2486
+	.byte	0xbb
+	.byte	0x25
+	.long	0x138
+	.uleb128 0x2b
+	.uleb128 0x19
+	.long	.LASF2488
+	.byte	0xc0
+	.byte	0x18
+	.long	0x11b
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2489
+	.byte	0xb2
+	.long	0x1949
+	.uleb128 0x13
+	.long	.LASF2486
+	.byte	0xb2
+	.byte	0x28
+	.long	0x138
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2490
+	.byte	0x99
+	.long	0x195f
+	.uleb128 0x13
+	.long	.LASF2486
+	.byte	0x99
+	.byte	0x27
+	.long	0x138
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2492
+	.byte	0x8c
+	.long	0x1975
+	.uleb128 0x13
+	.long	.LASF2486
+	.byte	0x8c
+	.byte	0x21
+	.long	0x138
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2493
+	.byte	0x81
+	.long	0x198b
+	.uleb128 0x13
+	.long	.LASF2486
+	.byte	0x81
+	.byte	0x22
+	.long	0x138
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2494
+	.byte	0x66
+	.long	0x19b7
+	.uleb128 0x13
+	.long	.LASF2486
+	.byte	0x66
+	.byte	0x27
+	.long	0x138
+	.uleb128 0x19
+	.long	.LASF2495
+	.byte	0x74
+	.byte	0x18
+	.long	0x127
+	.uleb128 0x19
+	.long	.LASF2496
+	.byte	0x75
+	.byte	0x17
+	.long	0x133
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2497
+	.byte	0x5f
+	.long	0x19cd
+	.uleb128 0x13
+	.long	.LASF2486
+	.byte	0x5f
+	.byte	0x2e
+	.long	0x138
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2498
+	.byte	0x1d
+	.byte	0x33
+	.byte	0xa8
+	.long	0x19d9
+	.uleb128 0x5
+	.long	0x1426
+	.uleb128 0x17
+	.long	.LASF2499
+	.byte	0x1c
+	.byte	0x2f
+	.byte	0x53
+	.long	0x19ea
+	.uleb128 0x5
+	.long	0x13c6
+	.uleb128 0x17
+	.long	.LASF2500
+	.byte	0x19
+	.byte	0x48
+	.byte	0xcc
+	.long	0x19fb
+	.uleb128 0x5
+	.long	0x12a3
+	.uleb128 0x17
+	.long	.LASF2501
+	.byte	0x17
+	.byte	0x93
+	.byte	0x44
+	.long	0x1a0c
+	.uleb128 0x5
+	.long	0x10a0
+	.uleb128 0x17
+	.long	.LASF2502
+	.byte	0x15
+	.byte	0x78
+	.byte	0x50
+	.long	0x1a1d
+	.uleb128 0x5
+	.long	0xeac
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 39
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 39
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 39
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 39
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 39
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 40 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 41 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 42 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF404
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF405
+	.file 44 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 45 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x2d
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF484
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 48 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF559
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF577
+	.file 50 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x32
+	.file 51 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 52 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF643
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF679
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF559
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x111
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF707
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF708
+	.byte	0x4
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF709
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF710
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF484
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF770
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF786
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF787
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF788
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF792
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF793
+	.file 66 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF794
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF811
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF824
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF829
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF832
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF833
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF849
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF850
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF851
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF863
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF870
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF871
+	.byte	0x4
+	.byte	0x4
+	.file 83 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF875
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x54
+	.byte	0x4
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x4
+	.file 86 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x56
+	.file 87 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF880
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF976
+	.byte	0x4
+	.file 89 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x59
+	.file 90 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 91 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x5b
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 92 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x5c
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1114
+	.byte	0x4
+	.byte	0x4
+	.file 93 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5d
+	.file 94 "./src/main/drivers/display.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1115
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 95 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 96 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x60
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 97 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1147
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x26
+	.file 98 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x62
+	.file 99 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.file 100 "./src/main/config/config_profile.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x64
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x4
+	.file 101 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 102 "./src/main/cros/host_command.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x66
+	.file 103 "./src/main/cros/ec_command.h"
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x9
+	.file 104 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 105 "./src/main/drivers/compass.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x69
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1399
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xc
+	.file 106 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6a
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.file 107 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.file 108 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1790
+	.byte	0x4
+	.file 109 "./src/main/drivers/stack_check.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x6d
+	.byte	0x4
+	.file 110 "./src/main/drivers/vtx_common.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x6e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xd
+	.file 111 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6f
+	.byte	0x4
+	.file 112 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x70
+	.byte	0x4
+	.file 113 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x71
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 114 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x72
+	.byte	0x4
+	.file 115 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 116 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x74
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1796
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 117 "./src/main/fc/fc_tasks.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x75
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1797
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x11
+	.byte	0x4
+	.file 118 "./src/main/fc/rc_controls.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x76
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1833
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x22
+	.byte	0x4
+	.file 119 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x77
+	.file 120 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x78
+	.file 121 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x79
+	.file 122 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7a
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 123 "./src/main/io/beeper.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x7b
+	.byte	0x4
+	.file 124 "./src/main/io/dashboard.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x7c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1851
+	.byte	0x4
+	.file 125 "./src/main/io/flashfs.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x7d
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 126 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x7e
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1912
+	.byte	0x4
+	.file 127 "./src/main/io/transponder_ir.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x7f
+	.byte	0x4
+	.file 128 "./src/main/io/vtx_tramp.h"
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x80
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x21
+	.file 129 "./src/main/drivers/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x81
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1952
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1953
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1a
+	.file 130 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x82
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1b
+	.file 131 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x83
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x1e
+	.byte	0x4
+	.file 132 "./src/main/sensors/gyroanalyse.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x84
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.file 133 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x85
+	.file 134 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x86
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1969
+	.byte	0x4
+	.file 135 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x87
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1977
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1980
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF478
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF480
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF483
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF496
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF497
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF544
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF558
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF576
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF595
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF597
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF599
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF602
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF620
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF637
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF638
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF639
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF641
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF642
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF652
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF678
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF706
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF725
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF769
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.40.18f72bab8242c2bb4c532a2aa95b5f00,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF785
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.135.9eeb6b52c2522ad7aff16ad95342972e,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF621
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF642
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF798
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF800
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF802
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF806
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF810
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF823
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF828
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.52.4f882364bb7424384ae71496b52638dc,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF848
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF866
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF869
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF874
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF404
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF595
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF597
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF599
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF879
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1021
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1034
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF621
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF639
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF641
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1036
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF982
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1082
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1088
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1090
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.18.bfa4ba22e867d998ef89fe9a1289a151,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1122
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1127
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1153
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1176
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1186
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1268
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ec_command.h.5.0731ae63676de75b10de0f911f363ef4,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1294
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.host_command.h.173.eb2197f886738bcac57f41af347f24d4,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1299
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1389
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1421
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1795
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1823
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1832
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.8362794d947c339e17997ec0162d97db,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.25.359084437f17de36ca02cf51c97a94fa,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1854
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1863
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.25.44d42bc8a2509f001b7da5aa9bee7ce3,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.23.dfeea95d53f02f32dbd532b1d756929b,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1911
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.27.07521096acbd1fc23b5da89615487a6f,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1948
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1951
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyroanalyse.h.23.0b1f88510c8181f9938f950155cd183e,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1964
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1968
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.31.3b5d682359a370a2ebd4f23a79bccb6b,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1972
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.50.10d0067a73777b2d14d79db5df156f88,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1976
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x18
+	.long	.LASF1
+	.long	.LASF2504
+	.long	.LASF2505
+	.long	.LASF2506
+	.long	.LASF2507
+	.long	.LASF2508
+	.long	.LASF2509
+	.long	.LASF2510
+	.long	.LASF2511
+	.long	.LASF2512
+	.long	.LASF2513
+	.long	.LASF2514
+	.long	.LASF2515
+	.long	.LASF2516
+	.long	.LASF2517
+	.long	.LASF2518
+	.long	.LASF2519
+	.long	.LASF2520
+	.long	.LASF2521
+	.long	.LASF2522
+	.long	.LASF2523
+	.long	.LASF2524
+	.long	.LASF2525
+	.long	.LASF2526
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x88
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2527
+	.byte	0x13
+	.long	.LASF2528
+	.byte	0x13
+	.long	.LASF2529
+	.byte	0x13
+	.long	.LASF2530
+	.byte	0x3
+	.long	.LASF2531
+	.byte	0x3
+	.long	.LASF2532
+	.byte	0x8
+	.long	.LASF2533
+	.byte	0x6
+	.long	.LASF2534
+	.byte	0x6
+	.long	.LASF2535
+	.byte	0x6
+	.long	.LASF2536
+	.byte	0x6
+	.long	.LASF2537
+	.byte	0x6
+	.long	.LASF2538
+	.byte	0x6
+	.long	.LASF2539
+	.byte	0x7
+	.long	.LASF2540
+	.byte	0x3
+	.long	.LASF2541
+	.byte	0xa
+	.long	.LASF2542
+	.byte	0x7
+	.long	.LASF2543
+	.byte	0x7
+	.long	.LASF2544
+	.byte	0x7
+	.long	.LASF2545
+	.byte	0x9
+	.long	.LASF2546
+	.byte	0x9
+	.long	.LASF2538
+	.byte	0x9
+	.long	.LASF2547
+	.byte	0xa
+	.long	.LASF2548
+	.byte	0xb
+	.long	.LASF2549
+	.byte	0xd
+	.long	.LASF2550
+	.byte	0xd
+	.long	.LASF2551
+	.byte	0xd
+	.long	.LASF2552
+	.byte	0xd
+	.long	.LASF2553
+	.byte	0xd
+	.long	.LASF2554
+	.byte	0xd
+	.long	.LASF2555
+	.byte	0xd
+	.long	.LASF2556
+	.byte	0xc
+	.long	.LASF2557
+	.byte	0x8
+	.long	.LASF2558
+	.byte	0xd
+	.long	.LASF2559
+	.byte	0x8
+	.long	.LASF2560
+	.byte	0x10
+	.long	.LASF2561
+	.byte	0x7
+	.long	.LASF2562
+	.byte	0x7
+	.long	.LASF2563
+	.byte	0x4
+	.long	.LASF2564
+	.byte	0x7
+	.long	.LASF2565
+	.byte	0x16
+	.long	.LASF2566
+	.byte	0x17
+	.long	.LASF2567
+	.byte	0x16
+	.long	.LASF2568
+	.byte	0x13
+	.long	.LASF2569
+	.byte	0x16
+	.long	.LASF2570
+	.byte	0x16
+	.long	.LASF2571
+	.byte	0x13
+	.long	.LASF2572
+	.byte	0x13
+	.long	.LASF2573
+	.byte	0x15
+	.long	.LASF2574
+	.byte	0x13
+	.long	.LASF2575
+	.byte	0x14
+	.long	.LASF2576
+	.byte	0x14
+	.long	.LASF2577
+	.byte	0x17
+	.long	.LASF2578
+	.byte	0x13
+	.long	.LASF2579
+	.byte	0x13
+	.long	.LASF2580
+	.byte	0x13
+	.long	.LASF2581
+	.byte	0x13
+	.long	.LASF2582
+	.byte	0x12
+	.long	.LASF2583
+	.byte	0x12
+	.long	.LASF2527
+	.byte	0x15
+	.long	.LASF2584
+	.byte	0x13
+	.long	.LASF2585
+	.byte	0x13
+	.long	.LASF2586
+	.byte	0x12
+	.long	.LASF2587
+	.byte	0x12
+	.long	.LASF2588
+	.byte	0x12
+	.long	.LASF2589
+	.byte	0x12
+	.long	.LASF2590
+	.byte	0x16
+	.long	.LASF2590
+	.byte	0x13
+	.long	.LASF2591
+	.byte	0x13
+	.long	.LASF2592
+	.byte	0x13
+	.long	.LASF2593
+	.byte	0x13
+	.long	.LASF2594
+	.byte	0x15
+	.long	.LASF2594
+	.byte	0x13
+	.long	.LASF2595
+	.byte	0x12
+	.long	.LASF2596
+	.byte	0x12
+	.long	.LASF2597
+	.byte	0x12
+	.long	.LASF2598
+	.byte	0x12
+	.long	.LASF2599
+	.byte	0x13
+	.long	.LASF2600
+	.byte	0x13
+	.long	.LASF2601
+	.byte	0x13
+	.long	.LASF2602
+	.byte	0x13
+	.long	.LASF2603
+	.byte	0x13
+	.long	.LASF2604
+	.byte	0x13
+	.long	.LASF2605
+	.byte	0x16
+	.long	.LASF2606
+	.byte	0x13
+	.long	.LASF2607
+	.byte	0x13
+	.long	.LASF2608
+	.byte	0x17
+	.long	.LASF2608
+	.byte	0x16
+	.long	.LASF2609
+	.byte	0x13
+	.long	.LASF2610
+	.byte	0x11
+	.long	.LASF2611
+	.byte	0xf
+	.long	.LASF2612
+	.byte	0xe
+	.long	.LASF2613
+	.byte	0xf
+	.long	.LASF2614
+	.byte	0x2
+	.long	.LASF2615
+	.byte	0x6
+	.long	.LASF2616
+	.byte	0x3
+	.long	.LASF2617
+	.byte	0x3
+	.long	.LASF2618
+	.byte	0x3
+	.long	.LASF2619
+	.byte	0x4
+	.long	.LASF2620
+	.byte	0x1
+	.long	.LASF2621
+	.byte	0x4
+	.long	.LASF2622
+	.byte	0x4
+	.long	.LASF2623
+	.byte	0x5
+	.long	.LASF2624
+	.byte	0x5
+	.long	.LASF2625
+	.byte	0x6
+	.long	.LASF2554
+	.byte	0x6
+	.long	.LASF2626
+	.byte	0x6
+	.long	.LASF2627
+	.byte	0x6
+	.long	.LASF2628
+	.byte	0x6
+	.long	.LASF2629
+	.byte	0x6
+	.long	.LASF2630
+	.byte	0x6
+	.long	.LASF2631
+	.byte	0x6
+	.long	.LASF2632
+	.byte	0x6
+	.long	.LASF2633
+	.byte	0x6
+	.long	.LASF2634
+	.byte	0x6
+	.long	.LASF2635
+	.byte	0x6
+	.long	.LASF2636
+	.byte	0x6
+	.long	.LASF2637
+	.byte	0x7
+	.long	.LASF2638
+	.byte	0x7
+	.long	.LASF2639
+	.byte	0x8
+	.long	.LASF2640
+	.byte	0x6
+	.long	.LASF2641
+	.byte	0x6
+	.long	.LASF2642
+	.byte	0x6
+	.long	.LASF2643
+	.byte	0x9
+	.long	.LASF2644
+	.byte	0x9
+	.long	.LASF2645
+	.byte	0x9
+	.long	.LASF2646
+	.byte	0x9
+	.long	.LASF2647
+	.byte	0x9
+	.long	.LASF2648
+	.byte	0x9
+	.long	.LASF2558
+	.byte	0x6
+	.long	.LASF2649
+	.byte	0xd
+	.long	.LASF2650
+	.byte	0xd
+	.long	.LASF2651
+	.byte	0xd
+	.long	.LASF2652
+	.byte	0xd
+	.long	.LASF2653
+	.byte	0x6
+	.long	.LASF2654
+	.byte	0xd
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1781:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF701:
+	.string	"__ldiv_t_defined 1"
+.LASF953:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1816:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1126:
+	.string	"HSV_VALUE_MAX 255"
+.LASF1500:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2052:
+	.string	"mpuConfiguration_s"
+.LASF2059:
+	.string	"mpuConfiguration_t"
+.LASF1415:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF873:
+	.string	"alloca"
+.LASF2216:
+	.string	"mspPostProcessFnPtr"
+.LASF1050:
+	.string	"USE_FAKE_BARO "
+.LASF858:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1009:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1875:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF2007:
+	.string	"RGB_GREEN"
+.LASF1678:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2317:
+	.string	"rcInterpolationChannels"
+.LASF2012:
+	.string	"PIDPITCH"
+.LASF631:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1016:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF961:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF499:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF802:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF2194:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1635:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF526:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1059:
+	.string	"USE_UART7 "
+.LASF2283:
+	.string	"reboot_character"
+.LASF2252:
+	.string	"OSD_YAW_PIDS"
+.LASF404:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF945:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF717:
+	.string	"__SQUAD_TYPE long int"
+.LASF1063:
+	.string	"USE_PPM"
+.LASF1555:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2226:
+	.string	"modeColorIndexes_s"
+.LASF2168:
+	.string	"setMode"
+.LASF2068:
+	.string	"ICM_20602_SPI"
+.LASF485:
+	.string	"__USE_MISC 1"
+.LASF796:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF989:
+	.string	"USE_SERIALRX_CRSF "
+.LASF958:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1684:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1162:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF781:
+	.string	"__pid_t_defined "
+.LASF2391:
+	.string	"mag_hardware"
+.LASF1154:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1423:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF550:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1481:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1990:
+	.string	"__uint8_t"
+.LASF877:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2146:
+	.string	"vTable"
+.LASF1820:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1685:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2003:
+	.string	"_Bool"
+.LASF2308:
+	.string	"spektrum_sat_bind"
+.LASF1790:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF561:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1842:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1973:
+	.string	"SCHEDULER_HISTOGRAM_BUCKETS 16"
+.LASF1043:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2486:
+	.string	"currentTimeUs"
+.LASF840:
+	.string	"NFDBITS __NFDBITS"
+.LASF1011:
+	.string	"TELEMETRY_SRXL "
+.LASF503:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2089:
+	.string	"OWNER_ADC_CURR"
+.LASF1002:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF600:
+	.string	"__need_size_t "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF543:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1772:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1536:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1645:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1637:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1745:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2011:
+	.string	"PIDROLL"
+.LASF1819:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1139:
+	.string	"BIT(x) (1 << (x))"
+.LASF490:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1395:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF1160:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF2133:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2030:
+	.string	"CW90_DEG_FLIP"
+.LASF1287:
+	.string	"EC_CMD_HELLO 0x0001"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1474:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2469:
+	.string	"taskMainPidLoop"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1946:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1313:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1654:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2327:
+	.string	"rxConfig_System"
+.LASF1673:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2206:
+	.string	"MSP_RESULT_NO_REPLY"
+.LASF2032:
+	.string	"CW270_DEG_FLIP"
+.LASF1518:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1827:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF649:
+	.string	"WNOWAIT 0x01000000"
+.LASF623:
+	.string	"__WCHAR_T__ "
+.LASF1506:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2312:
+	.string	"rssi_invert"
+.LASF643:
+	.string	"_STDLIB_H 1"
+.LASF1104:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1777:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2462:
+	.string	"mspFcProcessPushCommand"
+.LASF1232:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1880:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF1224:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1473:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2018:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2041:
+	.string	"read"
+.LASF2415:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF1381:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1724:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1621:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1188:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2086:
+	.string	"OWNER_LED"
+.LASF1189:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF524:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1784:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1961:
+	.string	"FFT_MIN_FREQ 100"
+.LASF2184:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2057:
+	.string	"resetFn"
+.LASF2008:
+	.string	"RGB_BLUE"
+.LASF2001:
+	.string	"uint16_t"
+.LASF1477:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1960:
+	.string	"FFT_SAMPLING_RATE 1000"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1787:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF767:
+	.string	"__FD_SETSIZE 1024"
+.LASF2304:
+	.string	"halfDuplex"
+.LASF1836:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF2361:
+	.string	"accelerometerTrims"
+.LASF1978:
+	.string	"TASK_PERIOD_HZ(hz) (1000000 / (hz))"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1372:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1607:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF505:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1695:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"TELEMETRY_HOTT "
+.LASF762:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1719:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1166:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF613:
+	.string	"_SIZE_T_DEFINED "
+.LASF2460:
+	.string	"telemetryCheckState"
+.LASF1648:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1107:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1484:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF438:
+	.string	"_ISOC95_SOURCE"
+.LASF1410:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF778:
+	.string	"__uid_t_defined "
+.LASF1722:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1369:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF884:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1958:
+	.string	"FFT_WINDOW_SIZE 32"
+.LASF714:
+	.string	"__U32_TYPE unsigned int"
+.LASF1930:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1597:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1306:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1220:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1915:
+	.string	"MSP_PORT_OUTBUF_SIZE 256"
+.LASF1563:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2495:
+	.string	"pushPeriodUs"
+.LASF929:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1754:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1901:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2281:
+	.string	"portConfigs"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1550:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1874:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF777:
+	.string	"__nlink_t_defined "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1142:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1633:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF2481:
+	.string	"useBatteryVoltage"
+.LASF622:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1620:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2497:
+	.string	"taskUpdateAccelerometer"
+.LASF1436:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1544:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF416:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1212:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2091:
+	.string	"OWNER_ADC_RSSI"
+.LASF2440:
+	.string	"taskQueuePos"
+.LASF1800:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1740:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2211:
+	.string	"streamLimit"
+.LASF1943:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF887:
+	.string	"INT16_MAX (32767)"
+.LASF562:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1617:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF734:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1859:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF2020:
+	.string	"PIDVEL"
+.LASF696:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1600:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1228:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1006:
+	.string	"CMS "
+.LASF1344:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1796:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1748:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF2212:
+	.string	"streamLength"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1479:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1704:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1872:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF1776:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2093:
+	.string	"OWNER_SERIAL_RX"
+.LASF763:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2213:
+	.string	"streamFn"
+.LASF1927:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF522:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1026:
+	.string	"_T_PTRDIFF_ "
+.LASF668:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1444:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2490:
+	.string	"taskUpdateRxMain"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF614:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF966:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF2118:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1791:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2155:
+	.string	"rxBufferHead"
+.LASF914:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1452:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF2284:
+	.string	"serialConfig_t"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1071:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1661:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF824:
+	.string	"_SYS_SELECT_H 1"
+.LASF1998:
+	.string	"int32_t"
+.LASF1145:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF674:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2274:
+	.string	"functionMask"
+.LASF1601:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF501:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF835:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1727:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1049:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2395:
+	.string	"compassConfig_System"
+.LASF2170:
+	.string	"beginWrite"
+.LASF1110:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF1840:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF1362:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF621:
+	.string	"__need_size_t"
+.LASF1354:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF633:
+	.string	"___int_wchar_t_h "
+.LASF1752:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1698:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF407:
+	.string	"__USE_ISOC11"
+.LASF1133:
+	.string	"STR_HELPER(x) #x"
+.LASF1039:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1519:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1826:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF809:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF702:
+	.string	"__lldiv_t_defined 1"
+.LASF572:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2115:
+	.string	"OWNER_BARO_EXTI"
+.LASF1205:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1968:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF1390:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF913:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2055:
+	.string	"slowreadFn"
+.LASF545:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF969:
+	.string	"INTMAX_WIDTH 64"
+.LASF680:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1804:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF2128:
+	.string	"MODE_RX"
+.LASF480:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1281:
+	.string	"__ec_align2 __packed __aligned(2)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1064:
+	.string	"USE_PWM"
+.LASF970:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1424:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2338:
+	.string	"values"
+.LASF2431:
+	.string	"desiredPeriod"
+.LASF1871:
+	.string	"LED_POS_OFFSET 0"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1535:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2092:
+	.string	"OWNER_SERIAL_TX"
+.LASF578:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2295:
+	.string	"SERIALRX_XBUS_MODE_B_RJ01"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1225:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1017:
+	.string	"USE_SENSOR_NAMES "
+.LASF878:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1303:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1914:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1238:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1239:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1747:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1522:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF2398:
+	.string	"gyroADCf"
+.LASF855:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2173:
+	.string	"setRxFrameCallback"
+.LASF906:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1467:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF744:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1013:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF656:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF528:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1515:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1735:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"_T_SIZE_ "
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1962:
+	.string	"FFT_UPDATE_RATE_HZ 300"
+.LASF820:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1278:
+	.string	"__packed __attribute__((packed))"
+.LASF2347:
+	.string	"acc_s"
+.LASF2351:
+	.string	"acc_t"
+.LASF828:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2182:
+	.string	"FEATURE_FAILSAFE"
+.LASF2373:
+	.string	"voltageMeterSource_e"
+.LASF558:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1012:
+	.string	"USE_DASHBOARD "
+.LASF474:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1340:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1184:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1725:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF579:
+	.string	"__stub_chflags "
+.LASF1810:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2019:
+	.string	"PIDMAG"
+.LASF2326:
+	.string	"rxConfig_t"
+.LASF2116:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2043:
+	.string	"ADCRaw"
+.LASF1256:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF2127:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF933:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1691:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF618:
+	.string	"_GCC_SIZE_T "
+.LASF583:
+	.string	"__stub_setlogin "
+.LASF2209:
+	.string	"mspPacket_s"
+.LASF2129:
+	.string	"MODE_TX"
+.LASF684:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF440:
+	.string	"_ISOC99_SOURCE"
+.LASF1405:
+	.string	"IOCFG_AF_PP 0"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF585:
+	.string	"__stub_stty "
+.LASF1134:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1858:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF916:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1726:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF755:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2004:
+	.string	"timeDelta_t"
+.LASF1312:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF2296:
+	.string	"SERIALRX_IBUS"
+.LASF1825:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2310:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF935:
+	.string	"INT32_C(c) c"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1279:
+	.string	"__aligned(x) __attribute__((aligned(x)))"
+.LASF1392:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1660:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2200:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF2307:
+	.string	"rx_spi_rf_channel_count"
+.LASF2048:
+	.string	"sensorAccReadFuncPtr"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF657:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF1274:
+	.string	"EC_SPI_PROCESSING 0xfa"
+.LASF427:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2186:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2342:
+	.string	"SENSOR_BARO"
+.LASF2014:
+	.string	"PIDALT"
+.LASF1885:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2378:
+	.string	"batteryNotPresentLevel"
+.LASF2097:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1079:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2005:
+	.string	"timeUs_t"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF1701:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1571:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2183:
+	.string	"FEATURE_SONAR"
+.LASF489:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1937:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2322:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1530:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1186:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF726:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1260:
+	.string	"PG_VTX_CONFIG 515"
+.LASF2357:
+	.string	"acc_lpf_hz"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2085:
+	.string	"OWNER_SERVO"
+.LASF1817:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1141:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1207:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1047:
+	.string	"ACC "
+.LASF2075:
+	.string	"mpu6050Resolution_e"
+.LASF2016:
+	.string	"PIDPOSR"
+.LASF1904:
+	.string	"LF(name) LED_FUNCTION_ ## name"
+.LASF538:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1742:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1008:
+	.string	"TELEMETRY_IBUS "
+.LASF987:
+	.string	"USE_PWM "
+.LASF772:
+	.string	"__ino_t_defined "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF806:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1388:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2502:
+	.string	"serialConfig"
+.LASF1751:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1837:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF838:
+	.string	"__FDS_BITS(set) ((set)->fds_bits)"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1442:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1527:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2303:
+	.string	"sbus_inversion"
+.LASF1323:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1476:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF1156:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF799:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1445:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1280:
+	.string	"__ec_align1 __packed"
+.LASF1318:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1631:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF706:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF2025:
+	.string	"CW0_DEG"
+.LASF832:
+	.string	"__timeval_defined 1"
+.LASF2334:
+	.string	"roll"
+.LASF1032:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2313:
+	.string	"midrc"
+.LASF1450:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF915:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1517:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2336:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1921:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1991:
+	.string	"__int16_t"
+.LASF932:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1676:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF521:
+	.string	"__flexarr []"
+.LASF1486:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1993:
+	.string	"__uint16_t"
+.LASF699:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1812:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF2151:
+	.string	"rxBufferSize"
+.LASF2084:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1963:
+	.string	"FFT_STEPS_PER_AXIS 3"
+.LASF1534:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1103:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1539:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1300:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF466:
+	.string	"__USE_POSIX 1"
+.LASF1377:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF411:
+	.string	"__USE_POSIX"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2112:
+	.string	"OWNER_RX_SPI_CS"
+.LASF634:
+	.string	"__INT_WCHAR_T_H "
+.LASF775:
+	.string	"__gid_t_defined "
+.LASF2028:
+	.string	"CW270_DEG"
+.LASF1801:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1567:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1893:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1422:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF569:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1335:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF825:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF446:
+	.string	"_POSIX_SOURCE"
+.LASF2442:
+	.string	"maxExecutionTime"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2157:
+	.string	"txBufferHead"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2195:
+	.string	"FEATURE_AIRMODE"
+.LASF2305:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2148:
+	.string	"mode"
+.LASF819:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1669:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1453:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1400:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF1744:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF797:
+	.string	"__BIG_ENDIAN 4321"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1478:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF670:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1380:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF588:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF555:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2330:
+	.string	"SENSOR_INDEX_BARO"
+.LASF2389:
+	.string	"mag_declination"
+.LASF2329:
+	.string	"SENSOR_INDEX_ACC"
+.LASF1879:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF2345:
+	.string	"SENSOR_GPS"
+.LASF695:
+	.string	"__f32x(x) x ##f32x"
+.LASF2476:
+	.string	"rescheduleTask"
+.LASF1559:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1976:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF1302:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF1570:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1845:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF2407:
+	.string	"TASK_PRIORITY_MAX"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1829:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1261:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF518:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1487:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2035:
+	.string	"deviceSpi_s"
+.LASF1499:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1430:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1275:
+	.string	"EC_SPI_RX_BAD_DATA 0xfb"
+.LASF1427:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1986:
+	.string	"unsigned char"
+.LASF880:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1105:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1443:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF907:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2178:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF570:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2177:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1267:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1299:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF911:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1033:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF949:
+	.string	"INT64_WIDTH 64"
+.LASF776:
+	.string	"__mode_t_defined "
+.LASF609:
+	.string	"__SIZE_T "
+.LASF2253:
+	.string	"OSD_POWER"
+.LASF944:
+	.string	"UINT8_WIDTH 8"
+.LASF1244:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2494:
+	.string	"taskHandleSerial"
+.LASF1905:
+	.string	"LO(name) LED_FLAG_OVERLAY(LED_OVERLAY_ ## name)"
+.LASF1218:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1650:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF2306:
+	.string	"rx_spi_id"
+.LASF1201:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1807:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1366:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2010:
+	.string	"float"
+.LASF2459:
+	.string	"telemetryProcess"
+.LASF1483:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1196:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF409:
+	.string	"__USE_ISOC95"
+.LASF2375:
+	.string	"vbatmaxcellvoltage"
+.LASF408:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1741:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1723:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2321:
+	.string	"fpvCamAngleDegrees"
+.LASF934:
+	.string	"INT16_C(c) c"
+.LASF1320:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2169:
+	.string	"writeBuf"
+.LASF1876:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF2385:
+	.string	"vbathysteresis"
+.LASF2314:
+	.string	"mincheck"
+.LASF1014:
+	.string	"USE_MSP_PUSH "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1966:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1980:
+	.string	"TASK_PERIOD_US(us) (us)"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1085:
+	.string	"VTX_COMMON"
+.LASF1404:
+	.string	"IOCFG_OUT_OD 0"
+.LASF792:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF815:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF1025:
+	.string	"_PTRDIFF_T "
+.LASF1093:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1331:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF566:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2381:
+	.string	"batteryCapacity"
+.LASF804:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF418:
+	.string	"__USE_XOPEN2K"
+.LASF1491:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF2180:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1148:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2171:
+	.string	"endWrite"
+.LASF1376:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF1399:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF506:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1975:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF1324:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF2024:
+	.string	"ALIGN_DEFAULT"
+.LASF1120:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1233:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF456:
+	.string	"_DEFAULT_SOURCE"
+.LASF1496:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1004:
+	.string	"USE_SERVOS "
+.LASF1307:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF380:
+	.string	"__unix 1"
+.LASF1454:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1168:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF902:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1757:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1839:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF2124:
+	.string	"OWNER_VTX"
+.LASF544:
+	.string	"__wur "
+.LASF851:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF997:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2072:
+	.string	"mpuSensor_e"
+.LASF2425:
+	.string	"TASK_SELF"
+.LASF1241:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF507:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1364:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1659:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF659:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1697:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1557:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1979:
+	.string	"TASK_PERIOD_MS(ms) ((ms) * 1000)"
+.LASF1203:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1957:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF2371:
+	.string	"VOLTAGE_METER_ADC"
+.LASF2315:
+	.string	"maxcheck"
+.LASF1956:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF2040:
+	.string	"init"
+.LASF2444:
+	.string	"latenessHistogram"
+.LASF2367:
+	.string	"CURRENT_METER_ESC"
+.LASF630:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1562:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1333:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF2447:
+	.string	"cfTasks"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2062:
+	.string	"MPU_60x0"
+.LASF1630:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2106:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF954:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF2229:
+	.string	"specialColorIndexes_s"
+.LASF2230:
+	.string	"specialColorIndexes_t"
+.LASF834:
+	.string	"__NFDBITS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1913:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF881:
+	.string	"__intptr_t_defined "
+.LASF959:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF889:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF900:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2417:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF560:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF662:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1231:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF517:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1612:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1528:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1933:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF688:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF718:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2046:
+	.string	"mpuDetectionResult"
+.LASF2404:
+	.string	"TASK_PRIORITY_MEDIUM_HIGH"
+.LASF1835:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF1321:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1446:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1382:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2197:
+	.string	"FEATURE_VTX"
+.LASF2369:
+	.string	"currentMeterSource_e"
+.LASF1458:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF789:
+	.string	"__timer_t_defined 1"
+.LASF1967:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF2063:
+	.string	"MPU_60x0_SPI"
+.LASF917:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1565:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2250:
+	.string	"OSD_ROLL_PIDS"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1584:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1646:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF487:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF685:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF910:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1911:
+	.string	"OSD_POSCFG_MAX (VISIBLE_FLAG|0x3FF)"
+.LASF484:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF918:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF2166:
+	.string	"serialSetBaudRate"
+.LASF760:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2382:
+	.string	"useVBatAlerts"
+.LASF2165:
+	.string	"serialRead"
+.LASF794:
+	.string	"_ENDIAN_H 1"
+.LASF1767:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF568:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1696:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1223:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF984:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF1402:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF939:
+	.string	"UINT32_C(c) c ## U"
+.LASF2379:
+	.string	"voltageMeterSource"
+.LASF2159:
+	.string	"rxCallback"
+.LASF428:
+	.string	"__USE_GNU"
+.LASF1779:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF893:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1284:
+	.string	"EC_COMMAND_PROTOCOL_3 0xda"
+.LASF725:
+	.string	"__STD_TYPE typedef"
+.LASF2276:
+	.string	"gps_baudrateIndex"
+.LASF1258:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1393:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1433:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1802:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF879:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2288:
+	.string	"mspEvaluateNonMspData_e"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2013:
+	.string	"PIDYAW"
+.LASF2153:
+	.string	"rxBuffer"
+.LASF2426:
+	.string	"cfTaskId_e"
+.LASF1887:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF687:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2152:
+	.string	"txBufferSize"
+.LASF2137:
+	.string	"SERIAL_PARITY_NO"
+.LASF1891:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF813:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF430:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF875:
+	.string	"__COMPAR_FN_T "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF724:
+	.string	"__U64_TYPE unsigned long int"
+.LASF2038:
+	.string	"sensorAccInitFuncPtr"
+.LASF768:
+	.string	"_BITS_TIME64_H 1"
+.LASF862:
+	.string	"__ONCE_ALIGNMENT "
+.LASF912:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1532:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1902:
+	.string	"LED_XY_MASK 0x0F"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1339:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF1941:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF748:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF530:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2117:
+	.string	"OWNER_USB_DETECT"
+.LASF1447:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1641:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1618:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF653:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1760:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1356:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1401:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1343:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF1799:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF423:
+	.string	"__USE_LARGEFILE64"
+.LASF1582:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF845:
+	.string	"__blksize_t_defined "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF793:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF2309:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF546:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1243:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF2300:
+	.string	"rxConfig_s"
+.LASF712:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2325:
+	.string	"rx_max_usec"
+.LASF2054:
+	.string	"writeFn"
+.LASF541:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2370:
+	.string	"VOLTAGE_METER_NONE"
+.LASF1629:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1038:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1365:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF575:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF531:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF421:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1587:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2242:
+	.string	"OSD_CRAFT_NAME"
+.LASF1932:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1592:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF434:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2223:
+	.string	"isRXDataNew"
+.LASF1771:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2190:
+	.string	"FEATURE_DASHBOARD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF617:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1573:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF2428:
+	.string	"subTaskName"
+.LASF612:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2121:
+	.string	"OWNER_INVERTER"
+.LASF1082:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1596:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF805:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1888:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF2101:
+	.string	"OWNER_SPI_MOSI"
+.LASF1547:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1750:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2147:
+	.string	"identifier"
+.LASF2000:
+	.string	"uint8_t"
+.LASF1495:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2256:
+	.string	"OSD_AVG_CELL_VOLTAGE"
+.LASF580:
+	.string	"__stub_fchflags "
+.LASF2238:
+	.string	"OSD_HORIZON_SIDEBARS"
+.LASF1178:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1906:
+	.string	"LD(name) LED_FLAG_DIRECTION(LED_DIRECTION_ ## name)"
+.LASF716:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1739:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1969:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF2499:
+	.string	"batteryConfig"
+.LASF1092:
+	.string	"USE_DSHOT"
+.LASF1599:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2464:
+	.string	"batteryUpdateCurrentMeter"
+.LASF863:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1136:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2331:
+	.string	"SENSOR_INDEX_MAG"
+.LASF998:
+	.string	"TELEMETRY "
+.LASF2484:
+	.string	"taskTelemetry"
+.LASF2221:
+	.string	"ARMED"
+.LASF1237:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1341:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1602:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF919:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF437:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1286:
+	.string	"EC_HOST_RESPONSE_VERSION 3"
+.LASF1974:
+	.string	"SCHEDULER_TRACE_SIZE 64"
+.LASF1773:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF774:
+	.string	"__dev_t_defined "
+.LASF2493:
+	.string	"taskMspPush"
+.LASF2410:
+	.string	"TASK_ACCEL"
+.LASF573:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF635:
+	.string	"_GCC_WCHAR_T "
+.LASF2402:
+	.string	"TASK_PRIORITY_LOW"
+.LASF1679:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1920:
+	.string	"MSP_PUSH_MAX_RATE_HZ 200"
+.LASF1342:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF729:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1077:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1964:
+	.string	"FFT_AXIS_UPDATE_HZ ((float)FFT_UPDATE_RATE_HZ / (FFT_STEPS_PER_AXIS * XYZ_AXIS_COUNT))"
+.LASF816:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF664:
+	.string	"__WCOREFLAG 0x80"
+.LASF655:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF565:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1689:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2037:
+	.string	"busDevice_t"
+.LASF382:
+	.string	"unix 1"
+.LASF1608:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1123:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF2176:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF2485:
+	.string	"taskCalculateAltitude"
+.LASF1024:
+	.string	"_ANSI_STDDEF_H "
+.LASF864:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1494:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1743:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1078:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF464:
+	.string	"__USE_ISOC99 1"
+.LASF638:
+	.string	"_BSD_WCHAR_T_"
+.LASF1610:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF2348:
+	.string	"accSamplingInterval"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1513:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF678:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF564:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF610:
+	.string	"_SIZE_T_ "
+.LASF2114:
+	.string	"OWNER_MPU_EXTI"
+.LASF1809:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF2393:
+	.string	"magZero"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1416:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF2437:
+	.string	"lastSignaledAt"
+.LASF2083:
+	.string	"OWNER_PPMINPUT"
+.LASF2022:
+	.string	"ioTag_t"
+.LASF1035:
+	.string	"__need_ptrdiff_t"
+.LASF808:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF477:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF965:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF978:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2406:
+	.string	"TASK_PRIORITY_REALTIME"
+.LASF548:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1138:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1763:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1221:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1022:
+	.string	"_STDDEF_H "
+.LASF1706:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1052:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1713:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF927:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF441:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1398:
+	.string	"GYRO_LPF_NONE 7"
+.LASF740:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1357:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF1181:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1703:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF689:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF2492:
+	.string	"taskBatteryAlerts"
+.LASF2387:
+	.string	"batteryConfig_System"
+.LASF1546:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1613:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF942:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF417:
+	.string	"__USE_UNIX98"
+.LASF1951:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1856:
+	.string	"LON 1"
+.LASF727:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1922:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1643:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF478:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1118:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF1378:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1246:
+	.string	"PG_OSD_CONFIG 501"
+.LASF510:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2311:
+	.string	"rssi_scale"
+.LASF1211:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1558:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1165:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1084:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1462:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF2070:
+	.string	"ICM_20689_SPI"
+.LASF581:
+	.string	"__stub_gtty "
+.LASF1216:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF974:
+	.string	"WCHAR_WIDTH 32"
+.LASF1948:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF722:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF2134:
+	.string	"SERIAL_INVERTED"
+.LASF1485:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF831:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF615:
+	.string	"_SIZE_T_DECLARED "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1531:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF2489:
+	.string	"taskUpdateCompass"
+.LASF975:
+	.string	"WINT_WIDTH 32"
+.LASF2319:
+	.string	"rcSmoothingFilterType"
+.LASF894:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2289:
+	.string	"SERIALRX_SPEKTRUM1024"
+.LASF764:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF549:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1687:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1785:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1229:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1259:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1074:
+	.string	"LED_STRIP"
+.LASF1680:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF982:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF940:
+	.string	"UINT64_C(c) c ## UL"
+.LASF677:
+	.string	"__f128(x) x ##f128"
+.LASF2500:
+	.string	"accelerometerConfigMutable"
+.LASF847:
+	.string	"__fsblkcnt_t_defined "
+.LASF406:
+	.string	"_FEATURES_H 1"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF895:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF962:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1882:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF1525:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2457:
+	.string	"calculateEstimatedAltitude"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF803:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF2316:
+	.string	"rcInterpolation"
+.LASF2344:
+	.string	"SENSOR_SONAR"
+.LASF1847:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1465:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1556:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF488:
+	.string	"__USE_GNU 1"
+.LASF2214:
+	.string	"streamContext"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1157:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1970:
+	.string	"ESC_DATA_INVALID 255"
+.LASF2193:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF848:
+	.string	"__fsfilcnt_t_defined "
+.LASF788:
+	.string	"__time_t_defined 1"
+.LASF644:
+	.string	"WNOHANG 1"
+.LASF1397:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1864:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF1591:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF2397:
+	.string	"targetLooptime"
+.LASF1841:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF1040:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1290:
+	.string	"EC_CMD_GET_FEATURES 0x000D"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF999:
+	.string	"TELEMETRY_FRSKY "
+.LASF1420:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1291:
+	.string	"EC_FEATURE_MASK_0(event_code) (1UL << (event_code % 32))"
+.LASF1667:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1456:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF492:
+	.string	"__GNU_LIBRARY__"
+.LASF1304:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2341:
+	.string	"SENSOR_ACC"
+.LASF486:
+	.string	"__USE_ATFILE 1"
+.LASF1728:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2096:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1164:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1581:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1578:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1665:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF891:
+	.string	"UINT16_MAX (65535)"
+.LASF1572:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2247:
+	.string	"OSD_GPS_SPEED"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1806:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF1069:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1292:
+	.string	"EC_FEATURE_MASK_1(event_code) (1UL << (event_code - 32))"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF955:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF2232:
+	.string	"modeColors"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2384:
+	.string	"consumptionWarningPercentage"
+.LASF1468:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF525:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1408:
+	.string	"IOCFG_IPU 0"
+.LASF465:
+	.string	"__USE_ISOC95 1"
+.LASF1977:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF2237:
+	.string	"OSD_ARTIFICIAL_HORIZON"
+.LASF1153:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1174:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1501:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF646:
+	.string	"WSTOPPED 2"
+.LASF1611:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF2405:
+	.string	"TASK_PRIORITY_HIGH"
+.LASF2196:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF750:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2198:
+	.string	"FEATURE_RX_SPI"
+.LASF871:
+	.string	"__have_pthread_attr_t 1"
+.LASF2335:
+	.string	"pitch"
+.LASF1217:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF647:
+	.string	"WEXITED 4"
+.LASF2098:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1884:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF741:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF784:
+	.string	"__daddr_t_defined "
+.LASF504:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF498:
+	.string	"__PMT"
+.LASF2277:
+	.string	"blackbox_baudrateIndex"
+.LASF636:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF861:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2278:
+	.string	"telemetry_baudrateIndex"
+.LASF1091:
+	.string	"USE_SERVOS"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1128:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1325:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2064:
+	.string	"MPU_65xx_I2C"
+.LASF1959:
+	.string	"FFT_BIN_COUNT (FFT_WINDOW_SIZE / 2)"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1235:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1764:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF981:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2390:
+	.string	"mag_align"
+.LASF786:
+	.string	"__clock_t_defined 1"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2224:
+	.string	"armingFlags"
+.LASF1628:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2239:
+	.string	"OSD_ONTIME"
+.LASF941:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1649:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF534:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1568:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1167:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1566:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1862:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF675:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1711:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1193:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1493:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2255:
+	.string	"OSD_MAIN_BATT_WARNING"
+.LASF1623:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF779:
+	.string	"__off_t_defined "
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF551:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1457:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1127:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1919:
+	.string	"MSP_PUSH_MAX_COMMANDS 8"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1537:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1147:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1844:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF624:
+	.string	"_WCHAR_T "
+.LASF2243:
+	.string	"OSD_THROTTLE_POS"
+.LASF715:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1151:
+	.string	"UNIT_TESTED "
+.LASF2472:
+	.string	"feature"
+.LASF1192:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF2501:
+	.string	"rxConfig"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1614:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1903:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF921:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1315:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF2349:
+	.string	"accSmooth"
+.LASF1101:
+	.string	"USED_TIMERS 0"
+.LASF2477:
+	.string	"schedulerInit"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF888:
+	.string	"INT32_MAX (2147483647)"
+.LASF2199:
+	.string	"FEATURE_SOFTSPI"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2051:
+	.string	"mpuResetFnPtr"
+.LASF856:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1838:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF1575:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1176:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF2248:
+	.string	"OSD_GPS_SATS"
+.LASF1627:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2503:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF508:
+	.string	"__P(args) args"
+.LASF1814:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF691:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF920:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1161:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF898:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF977:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF606:
+	.string	"_SYS_SIZE_T_H "
+.LASF2339:
+	.string	"flightDynamicsTrims_t"
+.LASF2337:
+	.string	"flightDynamicsTrims_u"
+.LASF1460:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF790:
+	.string	"__useconds_t_defined "
+.LASF1448:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1426:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1102:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF2210:
+	.string	"result"
+.LASF1737:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1861:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF860:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1182:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF1917:
+	.string	"MSP_PORT_MAX_HEADER_SIZE 8"
+.LASF429:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2225:
+	.string	"cliMode"
+.LASF1257:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1955:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1996:
+	.string	"int8_t"
+.LASF2449:
+	.string	"updateLEDs"
+.LASF800:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1510:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2451:
+	.string	"processRx"
+.LASF791:
+	.string	"__suseconds_t_defined "
+.LASF1950:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF751:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF2443:
+	.string	"totalExecutionTime"
+.LASF886:
+	.string	"INT8_MAX (127)"
+.LASF850:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1461:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF842:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1909:
+	.string	"VISIBLE(x) (x & VISIBLE_FLAG)"
+.LASF787:
+	.string	"__clockid_t_defined 1"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF420:
+	.string	"__USE_XOPEN2K8"
+.LASF928:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1187:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1269:
+	.string	"EC_VER_MASK(version) (1UL << (version))"
+.LASF2408:
+	.string	"TASK_SYSTEM"
+.LASF1710:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF752:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF642:
+	.string	"__need_NULL"
+.LASF1036:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1463:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF2411:
+	.string	"TASK_ATTITUDE"
+.LASF1289:
+	.string	"EC_CMD_GET_COMMS_STATUS 0x0009"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF857:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1119:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF483:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF414:
+	.string	"__USE_POSIX199506"
+.LASF422:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF719:
+	.string	"__SWORD_TYPE long int"
+.LASF986:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1439:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF2365:
+	.string	"CURRENT_METER_ADC"
+.LASF2130:
+	.string	"MODE_RXTX"
+.LASF1073:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1066:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2207:
+	.string	"mspResult_e"
+.LASF468:
+	.string	"__USE_POSIX199309 1"
+.LASF930:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1100:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF769:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2222:
+	.string	"WAS_EVER_ARMED"
+.LASF2049:
+	.string	"mpuReadRegisterFnPtr"
+.LASF1076:
+	.string	"TELEMETRY_HOTT"
+.LASF904:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF2240:
+	.string	"OSD_FLYTIME"
+.LASF1194:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1865:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF1788:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF442:
+	.string	"_ISOC11_SOURCE"
+.LASF1524:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF514:
+	.string	"__END_DECLS "
+.LASF1793:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF1129:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2401:
+	.string	"TASK_PRIORITY_IDLE"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2104:
+	.string	"OWNER_SDCARD"
+.LASF2400:
+	.string	"gyro"
+.LASF1529:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1881:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF1350:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1682:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF676:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1768:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1234:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1389:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1179:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF640:
+	.string	"NULL"
+.LASF1997:
+	.string	"int16_t"
+.LASF1466:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1116:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1663:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1984:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1576:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1988:
+	.string	"signed char"
+.LASF692:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1155:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1644:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1516:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2217:
+	.string	"mspProcessCommandFnPtr"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF603:
+	.string	"__size_t__ "
+.LASF976:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF470:
+	.string	"__USE_XOPEN2K 1"
+.LASF1003:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1042:
+	.string	"U_ID_1 1"
+.LASF1124:
+	.string	"HSV_HUE_MAX 359"
+.LASF2471:
+	.string	"dispatchIsEnabled"
+.LASF1765:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1062:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF632:
+	.string	"_WCHAR_T_H "
+.LASF2050:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1202:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF443:
+	.string	"_ISOC11_SOURCE 1"
+.LASF2360:
+	.string	"accZero"
+.LASF2053:
+	.string	"readFn"
+.LASF2409:
+	.string	"TASK_GYROPID"
+.LASF452:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF818:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF810:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF2188:
+	.string	"FEATURE_RSSI_ADC"
+.LASF761:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF922:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF576:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF807:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1886:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF1143:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1674:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1593:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1088:
+	.string	"VTX_TRAMP"
+.LASF1824:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF870:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1730:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2465:
+	.string	"batteryUpdateVoltage"
+.LASF694:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF611:
+	.string	"_BSD_SIZE_T_ "
+.LASF552:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1692:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1878:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF536:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2320:
+	.string	"rcSmoothingCutoffHz"
+.LASF1001:
+	.string	"TELEMETRY_LTM "
+.LASF1855:
+	.string	"LAT 0"
+.LASF482:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1929:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF849:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1708:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1409:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1794:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1270:
+	.string	"EC_SPI_FRAME_START 0xec"
+.LASF577:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF844:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1210:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2044:
+	.string	"revisionCode"
+.LASF1351:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF738:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2270:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2271:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF396:
+	.string	"__REVISION__ \"669c324\""
+.LASF1671:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2126:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2356:
+	.string	"accelerometerConfig_s"
+.LASF2362:
+	.string	"accelerometerConfig_t"
+.LASF2302:
+	.string	"serialrx_provider"
+.LASF1214:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1505:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1293:
+	.string	"EC_CMD_REBOOT 0x00D1"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF936:
+	.string	"INT64_C(c) c ## L"
+.LASF451:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF730:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF996:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1866:
+	.string	"LED_MODE_COUNT 6"
+.LASF2482:
+	.string	"useBatteryCurrent"
+.LASF2285:
+	.string	"serialConfig_System"
+.LASF1264:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2119:
+	.string	"OWNER_OSD"
+.LASF502:
+	.string	"__LEAF , __leaf__"
+.LASF2479:
+	.string	"batteryUpdateStates"
+.LASF2439:
+	.string	"deadlineQueuePos"
+.LASF1652:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1683:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1766:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1200:
+	.string	"PG_PID_PROFILE 14"
+.LASF1732:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1219:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF2218:
+	.string	"mspPushCommandFnPtr"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF2241:
+	.string	"OSD_FLYMODE"
+.LASF1355:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2066:
+	.string	"MPU_9250_SPI"
+.LASF967:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1464:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1638:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1434:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1830:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1616:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1094:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1471:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF567:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF909:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2299:
+	.string	"SERIALRX_SRXL"
+.LASF990:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1508:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1414:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1266:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2219:
+	.string	"OK_TO_ARM"
+.LASF1449:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF444:
+	.string	"_ISOC2X_SOURCE"
+.LASF693:
+	.string	"__f32(x) x ##f32"
+.LASF1803:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1185:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1121:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF732:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF874:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF2167:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF2403:
+	.string	"TASK_PRIORITY_MEDIUM"
+.LASF1371:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF731:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1406:
+	.string	"IOCFG_AF_OD 0"
+.LASF2140:
+	.string	"SERIAL_BIDIR"
+.LASF1569:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1170:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1440:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1598:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF571:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2269:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1368:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF1721:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF512:
+	.string	"__ptr_t void *"
+.LASF1640:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2191:
+	.string	"FEATURE_OSD"
+.LASF1952:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF2435:
+	.string	"taskLatestDeltaTime"
+.LASF1924:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1171:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1005:
+	.string	"GPS "
+.LASF1953:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF721:
+	.string	"__SLONG32_TYPE int"
+.LASF1626:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1625:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2261:
+	.string	"SERIAL_PORT_USART1"
+.LASF2262:
+	.string	"SERIAL_PORT_USART2"
+.LASF2263:
+	.string	"SERIAL_PORT_USART3"
+.LASF892:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1482:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2266:
+	.string	"SERIAL_PORT_USART6"
+.LASF2267:
+	.string	"SERIAL_PORT_USART7"
+.LASF2268:
+	.string	"SERIAL_PORT_USART8"
+.LASF2474:
+	.string	"taskMainPidLoopInit"
+.LASF2163:
+	.string	"serialTotalRxWaiting"
+.LASF1421:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2294:
+	.string	"SERIALRX_XBUS_MODE_B"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF410:
+	.string	"__USE_ISOCXX11"
+.LASF1714:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1843:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF1272:
+	.string	"EC_SPI_RX_READY 0xf8"
+.LASF1982:
+	.string	"long int"
+.LASF1811:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1543:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1206:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1509:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF436:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1336:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1595:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1890:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF882:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF890:
+	.string	"UINT8_MAX (255)"
+.LASF1396:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2094:
+	.string	"OWNER_PINDEBUG"
+.LASF1488:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1755:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF885:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF963:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF854:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1828:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF509:
+	.string	"__PMT(args) args"
+.LASF2358:
+	.string	"acc_align"
+.LASF1007:
+	.string	"TELEMETRY_CRSF "
+.LASF1029:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF497:
+	.string	"_SYS_CDEFS_H 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1137:
+	.string	"UNUSED(x) (void)(x)"
+.LASF899:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2346:
+	.string	"SENSOR_GPSMAG"
+.LASF1594:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1028:
+	.string	"__PTRDIFF_T "
+.LASF827:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF833:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF950:
+	.string	"UINT64_WIDTH 64"
+.LASF705:
+	.string	"EXIT_SUCCESS 0"
+.LASF1588:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1514:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1589:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF747:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF754:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1197:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF697:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1715:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2413:
+	.string	"TASK_SERIAL"
+.LASF2374:
+	.string	"batteryConfig_s"
+.LASF2386:
+	.string	"batteryConfig_t"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1867:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF2368:
+	.string	"CURRENT_METER_MAX"
+.LASF1896:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF515:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1326:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1135:
+	.string	"EXPAND_I(x) x"
+.LASF1564:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1709:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2333:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF1931:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1394:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF2359:
+	.string	"acc_hardware"
+.LASF1081:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1521:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1603:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2002:
+	.string	"uint32_t"
+.LASF1387:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF2258:
+	.string	"OSD_GPS_LAT"
+.LASF759:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF2246:
+	.string	"OSD_MAH_DRAWN"
+.LASF1822:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1418:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1041:
+	.string	"U_ID_0 0"
+.LASF2156:
+	.string	"rxBufferTail"
+.LASF2220:
+	.string	"PREVENT_ARMING"
+.LASF1252:
+	.string	"PG_PPM_CONFIG 507"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2478:
+	.string	"batteryUpdateAlarms"
+.LASF2287:
+	.string	"MSP_SKIP_NON_MSP_DATA"
+.LASF947:
+	.string	"INT32_WIDTH 32"
+.LASF742:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF758:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1908:
+	.string	"VISIBLE_FLAG 0x0800"
+.LASF1738:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1688:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF2088:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF698:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF836:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF540:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1204:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2139:
+	.string	"SERIAL_UNIDIR"
+.LASF1429:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF2483:
+	.string	"useBatteryAlerts"
+.LASF1249:
+	.string	"PG_PID_CONFIG 504"
+.LASF637:
+	.string	"__DEFINED_wchar_t "
+.LASF1699:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1821:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF700:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF435:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF527:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2454:
+	.string	"compassUpdate"
+.LASF1075:
+	.string	"TELEMETRY_FRSKY"
+.LASF1981:
+	.string	"long unsigned int"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF903:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1883:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF960:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1305:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF1152:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF415:
+	.string	"__USE_XOPEN"
+.LASF523:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF2392:
+	.string	"interruptTag"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1173:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF625:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF463:
+	.string	"__USE_ISOC11 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF2376:
+	.string	"vbatmincellvoltage"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1504:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1360:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF896:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1553:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF448:
+	.string	"_POSIX_C_SOURCE"
+.LASF2412:
+	.string	"TASK_RX"
+.LASF1020:
+	.string	"VTX_SMARTAUDIO "
+.LASF1877:
+	.string	"LED_POS_BITCNT 8"
+.LASF703:
+	.string	"RAND_MAX 2147483647"
+.LASF1579:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2095:
+	.string	"OWNER_TIMER"
+.LASF2039:
+	.string	"accDev_s"
+.LASF2080:
+	.string	"accDev_t"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1230:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF2042:
+	.string	"acc_1G"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1734:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1490:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2423:
+	.string	"TASK_COUNT"
+.LASF1717:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF473:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1282:
+	.string	"__ec_align4 __packed __aligned(4)"
+.LASF2456:
+	.string	"baroUpdate"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF908:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1271:
+	.string	"EC_SPI_PAST_END 0xed"
+.LASF956:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF2233:
+	.string	"specialColors"
+.LASF1089:
+	.string	"BLACKBOX"
+.LASF1985:
+	.string	"char"
+.LASF2215:
+	.string	"mspPacket_t"
+.LASF2015:
+	.string	"PIDPOS"
+.LASF1926:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1560:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1296:
+	.string	"HC_EXP_STR(off,cmd) \"__host_cmd_\"#off#cmd"
+.LASF648:
+	.string	"WCONTINUED 8"
+.LASF1297:
+	.string	"DECLARE_HOST_COMMAND(command,routine,version_mask) const struct host_command __keep HC_EXP(0x0000, command) __attribute__((section(\".rodata.hcmds.\"HC_EXP_STR(0x0000, command)))) = {routine, command, version_mask}"
+.LASF733:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1870:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF584:
+	.string	"__stub_sigreturn "
+.LASF686:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1497:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF669:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1172:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF713:
+	.string	"__S32_TYPE int"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2254:
+	.string	"OSD_PIDRATE_PROFILE"
+.LASF1044:
+	.string	"LED0_PIN NONE"
+.LASF2034:
+	.string	"hsvColor_s"
+.LASF2009:
+	.string	"hsvColor_t"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1894:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF711:
+	.string	"__S16_TYPE short int"
+.LASF2023:
+	.string	"IO_t"
+.LASF1316:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF2363:
+	.string	"accelerometerConfig_System"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF605:
+	.string	"_SIZE_T "
+.LASF645:
+	.string	"WUNTRACED 2"
+.LASF821:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF457:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1718:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1314:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1268:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2260:
+	.string	"SERIAL_PORT_NONE"
+.LASF1795:
+	.string	"BEEP_ON do {} while(0)"
+.LASF2432:
+	.string	"staticPriority"
+.LASF2107:
+	.string	"OWNER_FLASH_CS"
+.LASF1577:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1072:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1015:
+	.string	"USE_RX_MSP "
+.LASF1131:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1606:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF2292:
+	.string	"SERIALRX_SUMD"
+.LASF2227:
+	.string	"color"
+.LASF2293:
+	.string	"SERIALRX_SUMH"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1869:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF1818:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2473:
+	.string	"sensors"
+.LASF1385:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF745:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF445:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1942:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2343:
+	.string	"SENSOR_MAG"
+.LASF1334:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF1780:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2236:
+	.string	"OSD_CROSSHAIRS"
+.LASF2458:
+	.string	"isBaroReady"
+.LASF883:
+	.string	"INT16_MIN (-32767-1)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF770:
+	.string	"__STD_TYPE"
+.LASF1115:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF756:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1511:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2067:
+	.string	"ICM_20601_SPI"
+.LASF905:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1322:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF728:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF529:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF681:
+	.string	"__HAVE_FLOAT32 1"
+.LASF2204:
+	.string	"MSP_RESULT_ACK"
+.LASF1899:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF620:
+	.string	"__size_t "
+.LASF602:
+	.string	"__need_NULL "
+.LASF1132:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF736:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2138:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1370:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF980:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1065:
+	.string	"SERIAL_RX"
+.LASF1114:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1475:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1099:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1222:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2047:
+	.string	"mpuConfiguration"
+.LASF1609:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF641:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2031:
+	.string	"CW180_DEG_FLIP"
+.LASF1283:
+	.string	"__keep __attribute__((used)) __attribute__((externally_visible))"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF951:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF822:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1095:
+	.string	"USE_PROFILE "
+.LASF869:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF2179:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1213:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF1227:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1087:
+	.string	"VTX_SMARTAUDIO"
+.LASF991:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2099:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1294:
+	.string	"EC_CMD_RESEND_RESPONSE 0x00DB"
+.LASF533:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1149:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF401:
+	.string	"true 1"
+.LASF1068:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2418:
+	.string	"TASK_COMPASS"
+.LASF2468:
+	.string	"imuUpdateAttitude"
+.LASF829:
+	.string	"__sigset_t_defined 1"
+.LASF563:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1831:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1503:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1541:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1590:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1823:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF639:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2297:
+	.string	"SERIALRX_JETIEXBUS"
+.LASF1907:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF2414:
+	.string	"TASK_DISPATCH"
+.LASF1298:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF1027:
+	.string	"_T_PTRDIFF "
+.LASF2244:
+	.string	"OSD_VTX_CHANNEL"
+.LASF1542:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1949:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1895:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF2450:
+	.string	"accUpdate"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1945:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF710:
+	.string	"_BITS_TYPES_H 1"
+.LASF1048:
+	.string	"USE_FAKE_ACC "
+.LASF454:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1251:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1857:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1666:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF496:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1361:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2264:
+	.string	"SERIAL_PORT_UART4"
+.LASF574:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2265:
+	.string	"SERIAL_PORT_UART5"
+.LASF1295:
+	.string	"HC_EXP(off,cmd) __host_cmd_ ##off ##cmd"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF782:
+	.string	"__id_t_defined "
+.LASF1934:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF1060:
+	.string	"USE_UART8 "
+.LASF1761:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2061:
+	.string	"MPU_3050"
+.LASF1910:
+	.string	"OSD_POS_MAX 0x3FF"
+.LASF1263:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF867:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF661:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF2026:
+	.string	"CW90_DEG"
+.LASF2273:
+	.string	"serialPortConfig_s"
+.LASF2279:
+	.string	"serialPortConfig_t"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1586:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2249:
+	.string	"OSD_ALTITUDE"
+.LASF2033:
+	.string	"sensor_align_e"
+.LASF1707:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1492:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF866:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1694:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1769:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1622:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1783:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2353:
+	.string	"rollAndPitchTrims_t_def"
+.LASF2135:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2136:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1832:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1690:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF651:
+	.string	"__WALL 0x40000000"
+.LASF1580:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2445:
+	.string	"executionHistogram"
+.LASF516:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2463:
+	.string	"mspSerialPushSubscriptions"
+.LASF2158:
+	.string	"txBufferTail"
+.LASF814:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF1925:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1489:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF432:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2056:
+	.string	"verifywriteFn"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1805:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF475:
+	.string	"_LARGEFILE_SOURCE"
+.LASF720:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1815:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1163:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1240:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF852:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1144:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF424:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1892:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF663:
+	.string	"__W_CONTINUED 0xffff"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1242:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF983:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF979:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1250:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1677:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF709:
+	.string	"_SYS_TYPES_H 1"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF450:
+	.string	"_XOPEN_SOURCE"
+.LASF1533:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1328:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1262:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF817:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1348:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1183:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF1846:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF743:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF708:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2102:
+	.string	"OWNER_I2C_SCL"
+.LASF2100:
+	.string	"OWNER_SPI_MISO"
+.LASF1438:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2125:
+	.string	"OWNER_COMPASS_CS"
+.LASF628:
+	.string	"_WCHAR_T_ "
+.LASF1046:
+	.string	"USE_FAKE_GYRO "
+.LASF1358:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF1851:
+	.string	"ENABLE_DEBUG_DASHBOARD_PAGE "
+.LASF2205:
+	.string	"MSP_RESULT_ERROR"
+.LASF801:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1277:
+	.string	"EC_SPI_OLD_READY 0xfd"
+.LASF2201:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF1190:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF753:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2187:
+	.string	"FEATURE_RX_MSP"
+.LASF2416:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF1146:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2318:
+	.string	"rcInterpolationInterval"
+.LASF629:
+	.string	"_BSD_WCHAR_T_ "
+.LASF971:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1561:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1604:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2181:
+	.string	"FEATURE_GPS"
+.LASF1417:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF901:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2496:
+	.string	"periodUs"
+.LASF1109:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF535:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1729:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF859:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1994:
+	.string	"__int32_t"
+.LASF2446:
+	.string	"cfTask_t"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2103:
+	.string	"OWNER_I2C_SDA"
+.LASF1947:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1995:
+	.string	"__uint32_t"
+.LASF2298:
+	.string	"SERIALRX_CRSF"
+.LASF2234:
+	.string	"OSD_RSSI_VALUE"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1520:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF658:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF412:
+	.string	"__USE_POSIX2"
+.LASF773:
+	.string	"__ino64_t_defined "
+.LASF1624:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF2434:
+	.string	"taskAgeCycles"
+.LASF1792:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2189:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1070:
+	.string	"USE_SERIALRX_SUMD"
+.LASF2419:
+	.string	"TASK_BARO"
+.LASF2060:
+	.string	"MPU_NONE"
+.LASF1848:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2377:
+	.string	"vbatwarningcellvoltage"
+.LASF1117:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF985:
+	.string	"USE_CLI "
+.LASF2071:
+	.string	"BMI_160_SPI"
+.LASF1037:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1480:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2436:
+	.string	"lastExecutedAt"
+.LASF1733:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2388:
+	.string	"compassConfig_s"
+.LASF2394:
+	.string	"compassConfig_t"
+.LASF532:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2108:
+	.string	"OWNER_FLASH"
+.LASF2150:
+	.string	"baudRate"
+.LASF1209:
+	.string	"PG_RX_CONFIG 24"
+.LASF1236:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF425:
+	.string	"__USE_MISC"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2272:
+	.string	"serialPortIdentifier_e"
+.LASF2132:
+	.string	"portOptions_t"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1756:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF419:
+	.string	"__USE_XOPEN2KXSI"
+.LASF679:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2231:
+	.string	"colors"
+.LASF2480:
+	.string	"batteryUpdatePresence"
+.LASF1090:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1391:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF846:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2275:
+	.string	"msp_baudrateIndex"
+.LASF650:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF2154:
+	.string	"txBuffer"
+.LASF626:
+	.string	"_T_WCHAR "
+.LASF1700:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1833:
+	.string	"CLI_SETTING_NOT_FOUND -1"
+.LASF619:
+	.string	"_SIZET_ "
+.LASF1770:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF957:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1681:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF547:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1940:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2420:
+	.string	"TASK_ALTITUDE"
+.LASF1523:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF660:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1548:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF798:
+	.string	"__PDP_ENDIAN 3412"
+.LASF2441:
+	.string	"movingSumExecutionTime"
+.LASF1023:
+	.string	"_STDDEF_H_ "
+.LASF1419:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF459:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1034:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1437:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1786:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1455:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF2466:
+	.string	"dispatchProcess"
+.LASF1540:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1656:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2380:
+	.string	"currentMeterSource"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1928:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1432:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1664:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF780:
+	.string	"__off64_t_defined "
+.LASF765:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF938:
+	.string	"UINT16_C(c) c"
+.LASF1083:
+	.string	"USE_DASHBOARD"
+.LASF853:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF2427:
+	.string	"taskName"
+.LASF872:
+	.string	"_ALLOCA_H 1"
+.LASF2282:
+	.string	"serial_update_rate_hz"
+.LASF1265:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF2029:
+	.string	"CW0_DEG_FLIP"
+.LASF652:
+	.string	"__WCLONE 0x80000000"
+.LASF924:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1916:
+	.string	"MSP_PORT_STREAM_LIMIT 0xffff"
+.LASF1639:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2280:
+	.string	"serialConfig_s"
+.LASF2120:
+	.string	"OWNER_RX_BIND"
+.LASF439:
+	.string	"_ISOC95_SOURCE 1"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1019:
+	.string	"VTX_CONTROL "
+.LASF1675:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2123:
+	.string	"OWNER_TRANSPONDER"
+.LASF1208:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF413:
+	.string	"__USE_POSIX199309"
+.LASF1353:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF926:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1386:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF1834:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1345:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF946:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1526:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1030:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF627:
+	.string	"__WCHAR_T "
+.LASF2074:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1647:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF771:
+	.string	"__u_char_defined "
+.LASF2161:
+	.string	"serialPortVTable"
+.LASF1585:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2259:
+	.string	"OSD_ITEM_COUNT"
+.LASF2350:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1367:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF837:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1273:
+	.string	"EC_SPI_RECEIVING 0xf9"
+.LASF2422:
+	.string	"TASK_MSP_PUSH"
+.LASF601:
+	.string	"__need_wchar_t "
+.LASF1472:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1782:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2131:
+	.string	"portMode_t"
+.LASF1140:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF462:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1045:
+	.string	"GYRO "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2448:
+	.string	"updateAltHoldState"
+.LASF1999:
+	.string	"long long unsigned int"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF2364:
+	.string	"CURRENT_METER_NONE"
+.LASF1359:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF766:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1965:
+	.string	"SONAR_GPIO GPIOB"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2461:
+	.string	"mspFcProcessCommand"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2110:
+	.string	"OWNER_MPU_CS"
+.LASF2113:
+	.string	"OWNER_SPI_CS"
+.LASF1254:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2202:
+	.string	"sbuf_s"
+.LASF2203:
+	.string	"sbuf_t"
+.LASF673:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1923:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1332:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1311:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1789:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1051:
+	.string	"MAG "
+.LASF513:
+	.string	"__BEGIN_DECLS "
+.LASF2498:
+	.string	"compassConfigMutable"
+.LASF553:
+	.string	"__restrict_arr __restrict"
+.LASF1672:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"UINT8_C(c) c"
+.LASF876:
+	.string	"_STDINT_H 1"
+.LASF1285:
+	.string	"EC_HOST_REQUEST_VERSION 3"
+.LASF2352:
+	.string	"rollAndPitchTrims_s"
+.LASF2355:
+	.string	"rollAndPitchTrims_t"
+.LASF2354:
+	.string	"rollAndPitchTrims_u"
+.LASF672:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2143:
+	.string	"serialReceiveCallbackPtr"
+.LASF1753:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1736:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF608:
+	.string	"_T_SIZE "
+.LASF469:
+	.string	"__USE_POSIX199506 1"
+.LASF2078:
+	.string	"resolution"
+.LASF1853:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF723:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF557:
+	.string	"__attribute_copy__"
+.LASF582:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF554:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1191:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1712:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF2453:
+	.string	"cliProcess"
+.LASF654:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1175:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1310:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF1096:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF471:
+	.string	"__USE_XOPEN2K8 1"
+.LASF667:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF520:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF993:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1938:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF2424:
+	.string	"TASK_NONE"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2141:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1247:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF2081:
+	.string	"OWNER_FREE"
+.LASF2257:
+	.string	"OSD_GPS_LON"
+.LASF2175:
+	.string	"FEATURE_RX_PPM"
+.LASF1111:
+	.string	"EEPROM_SIZE 32768"
+.LASF683:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2366:
+	.string	"CURRENT_METER_VIRTUAL"
+.LASF481:
+	.string	"__WORDSIZE 64"
+.LASF1347:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF671:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF2383:
+	.string	"useConsumptionAlerts"
+.LASF1605:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2036:
+	.string	"csnPin"
+.LASF2172:
+	.string	"readBuf"
+.LASF1850:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF783:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF458:
+	.string	"_ATFILE_SOURCE"
+.LASF1451:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF2006:
+	.string	"RGB_RED"
+.LASF1122:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF968:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1431:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF2324:
+	.string	"rx_min_usec"
+.LASF1319:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1276:
+	.string	"EC_SPI_NOT_READY 0xfc"
+.LASF843:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1470:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF2145:
+	.string	"serialPort_s"
+.LASF2174:
+	.string	"serialPort_t"
+.LASF2082:
+	.string	"OWNER_PWMINPUT"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF690:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1798:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1554:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1301:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1775:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1854:
+	.string	"FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64"
+.LASF1634:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF2164:
+	.string	"serialTotalTxFree"
+.LASF1849:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF1813:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1330:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF1327:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1150:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1097:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF447:
+	.string	"_POSIX_SOURCE 1"
+.LASF1636:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2142:
+	.string	"SERIAL_BIDIR_PP"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1808:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF2470:
+	.string	"taskSystem"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2475:
+	.string	"setTaskEnabled"
+.LASF923:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF972:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1031:
+	.string	"___int_ptrdiff_t_h "
+.LASF2429:
+	.string	"checkFunc"
+.LASF2144:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF1308:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF556:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF757:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1720:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1349:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF1774:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2396:
+	.string	"gyro_s"
+.LASF2399:
+	.string	"gyro_t"
+.LASF1651:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF841:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF2069:
+	.string	"ICM_20608_SPI"
+.LASF1215:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1363:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1428:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1972:
+	.string	"ESC_SENSOR_COMBINED 255"
+.LASF1954:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF812:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF2058:
+	.string	"gyroReadXRegister"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1067:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1758:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1010:
+	.string	"TELEMETRY_MAVLINK "
+.LASF493:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF785:
+	.string	"__key_t_defined "
+.LASF1983:
+	.string	"long long int"
+.LASF1662:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF494:
+	.string	"__GLIBC__ 2"
+.LASF931:
+	.string	"WINT_MIN (0u)"
+.LASF460:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1403:
+	.string	"IOCFG_OUT_PP 0"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1944:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF2185:
+	.string	"FEATURE_3D"
+.LASF1632:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2251:
+	.string	"OSD_PITCH_PIDS"
+.LASF704:
+	.string	"EXIT_FAILURE 1"
+.LASF1935:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1195:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2105:
+	.string	"OWNER_SDCARD_CS"
+.LASF665:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1098:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2452:
+	.string	"mspSerialProcess"
+.LASF2430:
+	.string	"taskFunc"
+.LASF1288:
+	.string	"EC_CMD_GET_CMD_VERSIONS 0x0008"
+.LASF1469:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1329:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2245:
+	.string	"OSD_CURRENT_DRAW"
+.LASF2301:
+	.string	"rcmap"
+.LASF2340:
+	.string	"SENSOR_GYRO"
+.LASF1716:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF616:
+	.string	"__DEFINED_size_t "
+.LASF467:
+	.string	"__USE_POSIX2 1"
+.LASF1852:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE 128"
+.LASF1435:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1373:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF2372:
+	.string	"VOLTAGE_METER_ESC"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1731:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF865:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1860:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1053:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1374:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF795:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1346:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF1642:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1702:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1551:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2065:
+	.string	"MPU_65xx_SPI"
+.LASF2160:
+	.string	"rxFrameCallback"
+.LASF2017:
+	.string	"PIDNAVR"
+.LASF1338:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1507:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1574:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1352:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1106:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF426:
+	.string	"__USE_ATFILE"
+.LASF1255:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1180:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF2077:
+	.string	"sensor"
+.LASF1653:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1538:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1061:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF868:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF559:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF994:
+	.string	"USE_SERIALRX_SUMH "
+.LASF666:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF539:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2235:
+	.string	"OSD_MAIN_BATT_VOLTAGE"
+.LASF992:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1411:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2122:
+	.string	"OWNER_LED_STRIP"
+.LASF1670:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2290:
+	.string	"SERIALRX_SPEKTRUM2048"
+.LASF1054:
+	.string	"USE_UART2 "
+.LASF1018:
+	.string	"VTX_COMMON "
+.LASF431:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1021:
+	.string	"VTX_TRAMP "
+.LASF2076:
+	.string	"mpuDetectionResult_s"
+.LASF2079:
+	.string	"mpuDetectionResult_t"
+.LASF925:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF500:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1936:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1112:
+	.string	"__disable_irq() "
+.LASF2021:
+	.string	"PID_ITEM_COUNT"
+.LASF1749:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF749:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF811:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF1668:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2487:
+	.string	"taskUpdateBaro"
+.LASF973:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1918:
+	.string	"MSP_SERIAL_PROCESS_TIME_US 250"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1086:
+	.string	"VTX_CONTROL"
+.LASF1797:
+	.string	"LOOPTIME_SUSPEND_TIME 3"
+.LASF1158:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF707:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1655:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1778:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1317:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF746:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF952:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF2332:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1686:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1199:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF2162:
+	.string	"serialWrite"
+.LASF1226:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2467:
+	.string	"rxUpdateCheck"
+.LASF739:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1583:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1441:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1159:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF1055:
+	.string	"USE_UART3 "
+.LASF988:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF2455:
+	.string	"mspSerialPushPeriod"
+.LASF1658:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1375:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1989:
+	.string	"__int8_t"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2073:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1971:
+	.string	"ESC_BATTERY_AGE_MAX 10"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF604:
+	.string	"__SIZE_T__ "
+.LASF830:
+	.string	"____sigset_t_defined "
+.LASF1412:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1863:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF948:
+	.string	"UINT32_WIDTH 32"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF735:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2421:
+	.string	"TASK_TELEMETRY"
+.LASF2109:
+	.string	"OWNER_BARO_CS"
+.LASF519:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF511:
+	.string	"__STRING(x) #x"
+.LASF1245:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1889:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF1512:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1125:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF472:
+	.string	"__USE_XOPEN 1"
+.LASF964:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF2323:
+	.string	"airModeActivateThreshold"
+.LASF1113:
+	.string	"__enable_irq() "
+.LASF1898:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF1987:
+	.string	"unsigned int"
+.LASF2328:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1056:
+	.string	"USE_UART4 "
+.LASF1248:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF823:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1868:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF995:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2286:
+	.string	"MSP_EVALUATE_NON_MSP_DATA"
+.LASF1693:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1939:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1413:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1900:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF1130:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF542:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1337:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF2438:
+	.string	"nextExecuteAt"
+.LASF1384:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1177:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1383:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1897:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF479:
+	.string	"__USE_LARGEFILE 1"
+.LASF495:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1253:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF2208:
+	.string	"mspStreamFnPtr"
+.LASF1657:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2087:
+	.string	"OWNER_ADC"
+.LASF1992:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF897:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2045:
+	.string	"accAlign"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1619:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1615:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1549:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1759:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1057:
+	.string	"USE_UART5 "
+.LASF1705:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF2488:
+	.string	"newDeadline"
+.LASF2192:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF839:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1309:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1912:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1080:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2090:
+	.string	"OWNER_ADC_EXT"
+.LASF2491:
+	.string	"fcTasksInit"
+.LASF1459:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1873:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF737:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1498:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1502:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF943:
+	.string	"INT8_WIDTH 8"
+.LASF2027:
+	.string	"CW180_DEG"
+.LASF2149:
+	.string	"options"
+.LASF1425:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1108:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2111:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1746:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2291:
+	.string	"SERIALRX_SBUS"
+.LASF1169:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2433:
+	.string	"dynamicPriority"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1379:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1407:
+	.string	"IOCFG_IPD 0"
+.LASF2228:
+	.string	"modeColorIndexes_t"
+.LASF586:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1762:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1058:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1552:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2633:
+	.string	"rx_pwm.h"
+.LASF2600:
+	.string	"thread-shared-types.h"
+.LASF2640:
+	.string	"pwm_output.h"
+.LASF2523:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2525:
+	.string	"/usr/include"
+.LASF2650:
+	.string	"voltage_ids.h"
+.LASF2581:
+	.string	"floatn-common.h"
+.LASF2608:
+	.string	"stdint.h"
+.LASF2561:
+	.string	"fc_msp.h"
+.LASF2654:
+	.string	"esc_sensor.h"
+.LASF2504:
+	.string	"src/main/build"
+.LASF2522:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2558:
+	.string	"barometer.h"
+.LASF2566:
+	.string	"stdbool.h"
+.LASF2632:
+	.string	"flash.h"
+.LASF2564:
+	.string	"fc_tasks.c"
+.LASF2594:
+	.string	"select.h"
+.LASF2531:
+	.string	"color.h"
+.LASF2637:
+	.string	"fc_tasks.h"
+.LASF2562:
+	.string	"fc_dispatch.h"
+.LASF2517:
+	.string	"src/main/target/SITL"
+.LASF2543:
+	.string	"fc_core.h"
+.LASF2530:
+	.string	"time.h"
+.LASF2635:
+	.string	"sound_beeper.h"
+.LASF2624:
+	.string	"ec_command.h"
+.LASF2613:
+	.string	"common_post.h"
+.LASF2622:
+	.string	"parameter_group_ids.h"
+.LASF2521:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2568:
+	.string	"libc-header-start.h"
+.LASF2589:
+	.string	"timer_t.h"
+.LASF2652:
+	.string	"sonar.h"
+.LASF2610:
+	.string	"platform.h"
+.LASF2526:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2565:
+	.string	"stdc-predef.h"
+.LASF2537:
+	.string	"resource.h"
+.LASF2602:
+	.string	"atomic_wide_counter.h"
+.LASF2511:
+	.string	"src/main/flight"
+.LASF2559:
+	.string	"imu.h"
+.LASF2636:
+	.string	"vcd.h"
+.LASF2620:
+	.string	"build_config.h"
+.LASF2544:
+	.string	"cli.h"
+.LASF2634:
+	.string	"sdcard.h"
+.LASF2590:
+	.string	"endian.h"
+.LASF2618:
+	.string	"filter.h"
+.LASF2627:
+	.string	"io_def.h"
+.LASF2513:
+	.string	"src/main/msp"
+.LASF2569:
+	.string	"features.h"
+.LASF2520:
+	.string	"src/main"
+.LASF2512:
+	.string	"src/main/io"
+.LASF2585:
+	.string	"time64.h"
+.LASF2621:
+	.string	"config_profile.h"
+.LASF2571:
+	.string	"wordsize.h"
+.LASF2557:
+	.string	"altitudehold.h"
+.LASF2540:
+	.string	"streambuf.h"
+.LASF2570:
+	.string	"features-time64.h"
+.LASF2616:
+	.string	"axis.h"
+.LASF2554:
+	.string	"compass.h"
+.LASF2625:
+	.string	"exti.h"
+.LASF2643:
+	.string	"beeper.h"
+.LASF2604:
+	.string	"struct_rwlock.h"
+.LASF2567:
+	.string	"stdlib.h"
+.LASF2539:
+	.string	"config.h"
+.LASF2575:
+	.string	"stubs.h"
+.LASF2555:
+	.string	"gyro.h"
+.LASF2578:
+	.string	"waitflags.h"
+.LASF2535:
+	.string	"accgyro.h"
+.LASF2599:
+	.string	"pthreadtypes.h"
+.LASF2560:
+	.string	"telemetry.h"
+.LASF2612:
+	.string	"target.h"
+.LASF2579:
+	.string	"waitstatus.h"
+.LASF2547:
+	.string	"msp_serial.h"
+.LASF2609:
+	.string	"wchar.h"
+.LASF2572:
+	.string	"timesize.h"
+.LASF2506:
+	.string	"src/main/common"
+.LASF2649:
+	.string	"current_ids.h"
+.LASF2552:
+	.string	"voltage.h"
+.LASF2548:
+	.string	"rx.h"
+.LASF2524:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2508:
+	.string	"src/main/cros"
+.LASF2592:
+	.string	"byteswap.h"
+.LASF2642:
+	.string	"rcc_types.h"
+.LASF2646:
+	.string	"gps.h"
+.LASF2588:
+	.string	"time_t.h"
+.LASF2550:
+	.string	"acceleration.h"
+.LASF2577:
+	.string	"stddef.h"
+.LASF2532:
+	.string	"pid.h"
+.LASF2623:
+	.string	"host_command.h"
+.LASF2510:
+	.string	"src/main/fc"
+.LASF2580:
+	.string	"floatn.h"
+.LASF2545:
+	.string	"ledstrip.h"
+.LASF2611:
+	.string	"common.h"
+.LASF2641:
+	.string	"timer.h"
+.LASF2576:
+	.string	"stubs-64.h"
+.LASF2626:
+	.string	"io.h"
+.LASF2619:
+	.string	"parameter_group.h"
+.LASF2551:
+	.string	"current.h"
+.LASF2645:
+	.string	"flashfs.h"
+.LASF2515:
+	.string	"src/main/scheduler"
+.LASF2563:
+	.string	"feature.h"
+.LASF2630:
+	.string	"vtx_common.h"
+.LASF2617:
+	.string	"utils.h"
+.LASF2593:
+	.string	"uintn-identity.h"
+.LASF2639:
+	.string	"mixer.h"
+.LASF2549:
+	.string	"sensors.h"
+.LASF2615:
+	.string	"display.h"
+.LASF2587:
+	.string	"clockid_t.h"
+.LASF2536:
+	.string	"accgyro_mpu.h"
+.LASF2591:
+	.string	"endianness.h"
+.LASF2529:
+	.string	"stdint-uintn.h"
+.LASF2614:
+	.string	"cms.h"
+.LASF2586:
+	.string	"clock_t.h"
+.LASF2556:
+	.string	"scheduler.h"
+.LASF2631:
+	.string	"adc.h"
+.LASF2574:
+	.string	"long-double.h"
+.LASF2638:
+	.string	"rc_controls.h"
+.LASF2553:
+	.string	"battery.h"
+.LASF2573:
+	.string	"cdefs.h"
+.LASF2514:
+	.string	"src/main/rx"
+.LASF2584:
+	.string	"typesizes.h"
+.LASF2507:
+	.string	"src/main/config"
+.LASF2541:
+	.string	"msp.h"
+.LASF2647:
+	.string	"transponder_ir.h"
+.LASF2653:
+	.string	"sonar_hcsr04.h"
+.LASF2629:
+	.string	"stack_check.h"
+.LASF2582:
+	.string	"locale_t.h"
+.LASF2518:
+	.string	"src/main/target"
+.LASF2534:
+	.string	"sensor.h"
+.LASF2651:
+	.string	"gyroanalyse.h"
+.LASF0:
+	.string	"./src/main/fc/fc_tasks.c"
+.LASF2509:
+	.string	"src/main/drivers"
+.LASF2595:
+	.string	"sigset_t.h"
+.LASF2538:
+	.string	"serial.h"
+.LASF2607:
+	.string	"stdlib-float.h"
+.LASF2542:
+	.string	"runtime_config.h"
+.LASF2546:
+	.string	"osd.h"
+.LASF2505:
+	.string	"src/main/cms"
+.LASF2598:
+	.string	"struct_timespec.h"
+.LASF2597:
+	.string	"struct_timeval.h"
+.LASF2644:
+	.string	"dashboard.h"
+.LASF2516:
+	.string	"src/main/sensors"
+.LASF2528:
+	.string	"stdint-intn.h"
+.LASF2605:
+	.string	"alloca.h"
+.LASF2648:
+	.string	"vtx_tramp.h"
+.LASF2583:
+	.string	"__locale_t.h"
+.LASF2527:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2603:
+	.string	"struct_mutex.h"
+.LASF2606:
+	.string	"stdlib-bsearch.h"
+.LASF2519:
+	.string	"src/main/telemetry"
+.LASF2628:
+	.string	"io_def_generated.h"
+.LASF2601:
+	.string	"pthreadtypes-arch.h"
+.LASF2533:
+	.string	"io_types.h"
+.LASF2596:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375 \333\025\006"
+	.string	"\244\n\317"
+	.string	"\025"
+	.string	"\202\306\220\274\013\002\002"
+	.string	"\002"
+	.string	"\002\351\375\235\234\013\002\002\001\002\001\004\366\371\266\316\016"
+	.string	"\006\322\372\260\261\016"
+	.string	"\b\271\215\321\262\b\n\326\355\327\313\007"
+	.string	"\013\240\202\241\324\017\f\307\222\370\260\013"
+	.string	"\r\210\331\325\364\005"
+	.string	"\016\351\367\306\351\b"
+	.string	"\017\376\376\316\323\004"
+	.string	"\020\214\361\272\261\003"
+	.string	"\022\213\313\376\226\r"
+	.string	"\023\363\352\320\371\017\006\025\352\263\360\321\b\026\305\352\265q\027\201\266\207\375\b\020\002\003\002\004\002\003\002\005\002\006\002\007\002\b\002\t\002\n\002\t\002\001"
+	.string	"\002\013\035\371\267\265\273\004%\240\342\234\212\n&'\240\342\234\212\n"
+	.string	"\b"
+	.ascii	"R\304jO\007\205\346\270\013\341\006\201j\336\337Q\255\300\240"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"\225\003"
+	.string	"\244\002\f\001"
+	.string	"\020"
+	.string	"\001\001"
+	.string	"\002\004\006\002\001\b\001\001\n\013\f\r"
+	.string	"\016\017"
+	.string	""
+	.string	"\020\022"
+	.string	""
+	.string	"\023"
+	.string	"\001\026\001\027"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.ascii	"# \300\202)\234\007\020r\004\3373\302\003\272\033&\241\276\303"
+	.ascii	"\013gt*\006\260\254\201\273\257\321\264\215\334\303\001\361`"
+	.ascii	"\341\"\235\f\027\210'Yd\0010H`\364h\300\2100\343,\361\317\264"
+	.ascii	"\r\210\272\365\006\264\270xC"
+	.text
+	.section	.gnu.lto_.inline.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`b\003}\n"
+	.string	"b\213*2`k\222\016\022\370\330\305\003\206e\033\240\230\0358|\347\006\265\316\375:c\343\270\310\020\362wG\314\210\026\254a\0306\240\2004\206\375O\266 \226\020IR\267eJ\211TL\b\013\355\330d\\\217l\240q \231\r\317\005R7\030\026\021\004Y\b\347\341\340\001\001\3137\212\f\253\240\003\216\250\35751Yq\200J\037\305A\211\311\352@O\036\246\027\223\325\211G\251\033\016\327\307\363\363GT9\360\0312S\363\222\203\310L\311\357\210\232\264\375\024wq0S\r\254\342\250\334\330z/\360\025\232\231\371\364\033\306ydX\025\337\362K\bE\250\0016\232\t\3044\205\f\233\001\220\"\232\243\333\022 \242`\002\020\305PL\240\febJ0\321\004\226\233-4\006\360\242\024\201\003\371"
+	.string	"\310d\260\3353\310\257\020W\357&qt\2325u\356\245:\257\305\310"
+	.string	"\262\344\244\300\250\031Aa,T\310Z\263-\364i\307\344Llqj\253[\356'%3\306\371\372\301x\231\222\234\304\340N<~\270\031"
+	.ascii	"\274v\363%\341\316r(\031\336\031\345oy\b\n\027\326\200\017\224"
+	.ascii	"Z\301'\303\226\206\236\203\021\301\243\240\311\203\207\241\303"
+	.ascii	"\221G>\340c\037\b\216\365\250\312"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`X\004\365\r"
+	.string	"\026R:6Pi\232t0\213H\232\234\360=C\023\321Y;5_e\314\314 \366U\307\310\314\207\210\321\371\373\030\326f\213Ua\266k"
+	.string	"f\300\203\2655\373\366\326\210m+\223\f'"
+	.string	"."
+	.string	"+"
+	.string	"\026\\"
+	.ascii	"/0z\200\031jV`3K\217Sk\255}\027I\312}\327}\327\2743XK\250\367"
+	.ascii	"K\022*\371\244\310H\004\037x\003W\301\013&(*\036j\242\250#\254"
+	.ascii	"GRz\300m\004\361\341X\216\365\324\241,a/\331\200t9Fy\302~\302"
+	.ascii	":5:\201\013\004\024\005AGX\202[\b7zp\217Se\252DQ\003\311\300"
+	.ascii	"%\007\367\232\212\335\340\336H\322\b\376\332\241\313W\214W\254"
+	.ascii	"\177\344\002$$\247\326Z\233\302\275\227p\373\204\333\266\313"
+	.ascii	"\302D\270\007\001\340\272bSDk\f\3234\216cY\226\345p\374p\357"
+	.ascii	"\030s\030<\317\343\021v\250\021mU5IA*;c\360B\241\252:\021@X\255"
+	.ascii	"\310\220H \"\024JRnV\2100\220&\266k~\232\303\313\341AI\241j\312"
+	.ascii	"\273\223\330\362\331\321\350F\013\236h(\0137/\233:h\301\n\023"
+	.ascii	"\0367\276V\212\035g\255\b\320\001\356\3323\362\341\304\032<\347"
+	.ascii	"\022\360R\267\206\276\331l}\020\274\200\227\376WN\2419\200\f"
+	.ascii	"\321qHQs\235}#p\016\2425\2102\226iH\025D\301\005-\016\310H\354"
+	.ascii	"\335\254\336\027\003\331\006M\341\367\2500\257\320,l\232\332"
+	.ascii	"w\342\036\344\321X\367\301\032\310^z\310n\200\202A]\251\205N"
+	.ascii	"\377N/\377c\214\177jOh\330\007^\332\035\351\377\235\n\254\215"
+	.ascii	"\243lx\372\374\233\237\272!\"\321L5P\216)\003"
+	.text
+	.section	.gnu.lto_.pureconst.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\230\004\002\230\004\004\230\004\006\230\004\b\230\004\n\230"
+	.ascii	"\004\013\230\004\f\230\004\r\230\004\016\230\004\017\230\004"
+	.ascii	"\020\230\004\022\230\004\023\230\004\026\230\004\027\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375 \360\315\003"
+	.string	"\002\205\020\033\220+\035\377\377\377\377\377\377\377\377\377\017"
+	.string	"m\333\266Lmb\303\272E\337\276\224)\304:\257N\253\263*0\3259\225KQ\347\225C\025\032\346)\227\225\226\214|\207\361\027\023\017\317\300)\357\374\362v\026\027"
+	.string	"f\201\214\225\234`Ed{h\260\260\333\241\204\201,\204A\021T\330\030\020d!\f\024q\263\020\030\227*2X\310"
+	.ascii	"\2117-\354l\200\306`q\030`\001"
+	.text
+	.section	.gnu.lto_.lto.e0aebde21754a391,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskUpdateAccelerometer.120.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"5\t"
+	.string	"6QA: \223\322\0010\001\f\"\343`\355"
+	.string	"\004Q\311\033HEX5T\253o0\253n\255\341\267\303Z\370M\371\362\004+L\007\210\254\200\312\310uz\343\215.\303\374oO\272\377\336)\005,"
+	.string	"0"
+	.string	"0"
+	.string	"\241\013\210N\035\332=\037W\226C\251\201\324\370\354n\235*\017/C\377\265\223\304\031\354\222\213\330]Kq&r\317\333>\260=a\033'\273\273\2364{r%:\006\266\335\220 \240\275\321\233\026\333/\331\0131\r\227\366]\376\022\036\306\303\244\335\223\034\233\3351\301\b\243S\323\tD\247\001\223f\t\223[l\312<\222>\215\306e>\003\372,\247~m\310\213\247\0017\017G\207\274h\323\307\204\231#\221\266\221\235\225?\366(\2233\305~(~\270p@)@0x\247\001\260\302[\251(\\,\357\373^\035\200\273\023\210\001\242\\\026]\252v\251\312R\241V\265\373\300z*p+\303\373\252\253\325\372ji\214=\264\001\013"
+	.string	"\325s\241\214i\3543\fg\nQk"
+	.ascii	"\246\375\025\341\3512\236\265\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_taskHandleSerial.121.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\"\001\035\016"
+	.string	"\246ZbF\340\2644\035@k"
+	.string	"\374\036@\250\032c^Er\242[\372;\022!\024\200\273\305\335\016P=\252\224M7\306D\202Z\275P\214<\207$\304\301\233\2009\362\214\373\361\257\"b\201m\250d\016B\372\1777\262\367\336)\005L"
+	.string	"M"
+	.string	"O"
+	.string	"O\251^\351\003T\257\366\354 \027K\254\265S\343\302\214\"\273\213M\022\367^\351\224\236_\022~\257\327\3514\301\007!`x\372\244\006ttt"
+	.ascii	"\020\232hJj\347\307Q\227\031\302\222\224\226"
+	.string	"\313\356Z\202!\207\273\272\355\007\266!\330'\005\3438\216\236<\366{~:\245oYA)\002\343\256\2061h\201j\216\024\266o?\206g\302b\242\305>J\264p}\033.\032<\200\f\331\335\003\257vp\275\332,\247\226\313\303\360]\374\205\367\036\034\223\354\212\260qcWD\340\002\327\253J\030L!vwEJ\034DR \250\325\202D\332[\005y\320*\245\371\371\344\207\305Q\200:@\323]\3659\301\307\207I\032\261\357s\031\235\177\30267\362\340\253\177S\275~\236\364\360\220#G[+\216z\311\217\212\035+\217\330\342'\347\b\3733\335\013\3146\342\264\232\313\f`\026\210V\032(\320B\002\272\027mf\024\201D\243q\234M\206\342,\324\311t\"\222\204,\006\313b0\232\221h\006\313\270\016\013\r\360V\243q\030i\3338\314D\334O\036\273\344\314\022\335\335\255(\322\2460\232\3633\235\2261\216\f\026"
+	.ascii	"\325s\241L\213u\016a\352\bh\305*)]\303<!$\220\005j\303\324 \002"
+	.ascii	"\024\234\"D\355\020%\270J\\\006\262\004\036\220\3123\256\345"
+	.ascii	"\233\342A5\031\315\245\240"
+	.text
+	.section	.gnu.lto_taskMspPush.122.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"-\013"
+	.string	"\006UOE\020\253*\035\300\217&\306\3418h\275\177\035d\341|=\001\006\30697\\\257\203\316\201\246\302Y\267a\033>\221k\226\334\240\270\026\b\t\t$\006B\220\034\211$KE\276\024\302\203\242\271\300\021ek\204\354\275S\n;"
+	.string	"9"
+	.string	":"
+	.string	"\336p\022\301b`-\255\b\034v\267\243\007.\276\322)\372\2321\365\232\tpZ1^\004:L\214\253\312\261@k]\366\3512\262\346\304|v\327\3235\002\270\267\333\016\261-b\037\023?\235\323\3474\013.t*\354\276\224\037\226\266QP`\373\366I\321\336\330\033e\307\347e>\2037\020\037c1\304\256\201\331\204]2\303\235\3147\316-\270o\365\024\3347\213\0164\365Z\201R\002\365\211;5\201\240\2015k\366\035\374\301\311O\340\025\324\274\353\233\217\342\276\235Fd\020\240\232\245/\273f6"
+	.string	"\303N\0176\231\232\024f\277\356\356\232\276\354\307\002\3768\361"
+	.string	"i\200p|\236\212\220\344\033\211FL\244\017\004O\236\204=O\210\022\202L%^\250\363B\035I\004\032u\036\030v\236\013\227R>\2603\225J`\267!\367\037\025]\325\314\244\324V\t\347]\256\001\016"
+	.ascii	"\325s\241L\2130\3340a\257\006Z\303^B\265\n\002\231\b\221o\b0"
+	.ascii	"\272\314\021w\271\251\366h`j\017"
+	.text
+	.section	.gnu.lto_taskBatteryAlerts.123.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\356"
+	.string	"M\f"
+	.string	"\206VTD"
+	.string	"q\234\016p\023!&\356\216b\3315\205G\204\023\271aX\322u\270y\006m\177\"i\211\253\216\352\227\217\030\314\252\n\036>8%\211\312\005moZ|6X\351\030M\001\370\263\030?\f\221\210\220\275eJ\001>"
+	.string	">"
+	.string	"@"
+	.string	"\376l\033\037K\366' DNr\354\256&I\374\373\224\372\371?\335\022\212\246\317\017\227\023\201\212\013\034\001\304\220\231\0311\021\376t\355 \202\252X\204\335\265\206\242\207\333\272m\t\266'\330\247\020*G\330\237\273\273\226\"lUc\252~v\231Q\343\300\215\335\221\325\216E\261^\234\260}\214\275@\325\340j\037\305M\276\247\340`\313n\210\026\251\3351\201\rd\2676\317\\\267\346\005\\\267\002\2404\331\003\005\343%+*)i\315\205\311\237\236\245\260P\205\350\212\3475\327%&\255\"$\240\256\354\253\370\212\222_\302\033>\364\341-\377\343\272uI@E\002\242+_R\2122IY\325a\217\246~\200\301AG\001\004\006\034g\200g\201\013}*\220D\\\327\2256"
+	.string	"\3368\036\310\353\220.l\036m\363h\242O'\244m\235\247q\nx\224\201\3534\322h\324i\230qO\003\005D\202\240\213\214\220\242b\314Lm\r\236>\364&\025"
+	.ascii	"\325s\241L\2130\254\265\260\217+\024\\\226\263\035zf\240\261"
+	.ascii	"\244\260S\030)$%\002\024$#$0\2300+w\322ehk5Z\334\345\251\232"
+	.ascii	"\234\242\251="
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.124.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\365\f"
+	.string	"\206WXE\360\2226\035 \305\233\2074%W#\300\253\234\236\307\307N\213\366|\207\251\313\267\3423+\363\350\233\031z\301\234\276\254\230\244\352r;\n\353~\007r4\203\345R\233\340\310'l=\362j\r\330?~\262\367\226)\005A"
+	.string	"A"
+	.string	"E"
+	.string	"\002\254O{6\217\207,\273Yy1b\306jw\257\250\342\336eT\317?\352\234\017,]\232x\224\005T6~\210\200'9\202\302\342;\352J\0024\251n \354\256\365\003K\334\363\266#\330\226`\337B\n\304\016K\032W\354\313\335]G\025\373-\277T\365;\027T\253\036\006`vQj\202l\314\274\321\302\366=v\002\034\f\256\366a<\206\367\026\021\346\354\246\250\361\262\033\0360\201\220O\222\217X\237\362\001\031\\v\234\224\306\"*\257Y\366\206PT\220\3429\221\352\250-\332L9Rfd~\222\345\313\270\013\311_a\017\235\376\373\364;\353\363\243\303\307\211\326\270\263JM\225\321\006\021B\377\231\344\024K\376\300\270\230\221\331v\240\241\001\206\340\301\002\r\364\351*h\242\020\205\221\211\306q\037\262"
+	.string	"\316@\035\207\016\033a\310J\256\254\3442\ta\242+\343\272\0134\300[\007\215\273F\333\306]\236p/7\252x\002*\346$\232$\006\200\006\212\324YhT/\321$\3531\027"
+	.ascii	"\325s\341\214i0\262\001\240-\337\333K\312\002\332\245\002$\360"
+	.ascii	"\205\261\275yfY\327\035\\\330\261s\025\3105B\2202\025\257\236"
+	.ascii	"\301\331e\024k5Z\334\345\251\232\234\242\251="
+	.text
+	.section	.gnu.lto_taskUpdateCompass.125.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\355\n"
+	.string	"\266\324MA\020O5\035@9\222( e\343\247I\331\313wk\342U\247\211\374\034\001\252g\004&\305\343\253\03774\002w\016\332ib"
+	.string	"m\200\256\201\320K\227r\322\252\021\030\301\b\376\2141=\376\337\332\3362\245:"
+	.string	":"
+	.string	"8"
+	.string	"\033\031\2550\214p\261\273\232\364p\360S*\350\377\364I(v>%\033.'\b\253D\013\r\0214+\241\017\341O\327\f\342G5\202`w\255\241\250\341\276n;\201m\005\266[\001\217PR\250\310R\273\241\0300Vu\231"
+	.string	"a\373\366G\320\246\330\001J\004\256?\371!^\002o\272\340\311n\207\023\250\3351\304\037\222_\036\257`\277\3467\260_\006m\026\037I\001\335\004}\350);'\265X(i\013\330\345\003\021+\220\266\214\251\344\034\314\246PA\037^\n\340"
+	.string	"\222\035+\t\024+V_\330\343G\345\310\376\334\335\265\024\3317\375\230\252\0036"
+	.string	"\241\200\005\300\201\001\\\306\3615\3402\030\006\033\r\347y\234-\303[\366E\370,\033\007\333E\333.\232\006c\311h\233\367iY\207;\t\234\247m\272\316\323(\243\347R\344\005)\225G~\346D1i\007\r"
+	.ascii	"\325s\341L\213w\016\311\032\252\013{\t\325*\020\3505\304\302"
+	.ascii	"\020\312\3502Q\334\271\230\355\320\300\024\024"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.126.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\005\r"
+	.string	"\006\031\\E"
+	.string	"\2216\035\303%\244\2649Q\242\376\375\335\244\237\"{\r\200\016\033'"
+	.string	"h\t6,\n8\215\256\243Qc\004\240\251\312\376\021a4\304\262\354!\342\017\265\362C\350\003\234q\201\240\365:h\250(5!{\313\224\002E"
+	.string	"I"
+	.string	"D"
+	.ascii	"\017`\275\262g\323x\370\262\227)\225\242\302\306\356\316H\342"
+	.ascii	"\336eT\317\377\351\035`\351\273\304@<J\003(\0275"
+	.string	"\036s\355P\"\311\217\225\022\340OW\016%\024\325\313\301\356Z\301\322\207\273\272\355\007\266)\330\017\t2vWr\334X\232\352\205\t\333\347\230:\227y\230qFt\354\307\244\320\200}\036\260\026)*\250\335\360\300+C\300^\335\017=;\2639,\235\353O\376\211\243\360\016s\342\216]\021,fvC\004.\200\275\"\360\017\353\225\f\361\263\214\026\371DUH-\273\013\242\177\251A\315Dg\260\036-\310\314 i\215/\225\357,\273\304D\017>&h!\305\317\031\016]\221\212\261\232\262\303O\243\311\276\334\335ut\261\017\363\313\250\376\005\200\005\306\f[\350sA\304\263\205\230l\241\314\fD\026x@\032(\3306\002\272\t\033\350#a\024\3328\256D\363\260\266\351H:\317\250\20262\265\221\031\372x@S\343\272\271\031`\021\206\215\233#\221\210\233Y\270\227\033]\"\204\240\331\020Qd\2466\tH\017:\006\021"
+	.ascii	"\325s\341\214i%j\330i+<\300\333*YB\205\004YE\330\025\032\354"
+	.ascii	"\2554O.\bY,/P\345\021\327rL!\361\fj\017"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.127.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"M\013"
+	.string	"V\025PC m\234\016P\005\327\201\013\201\364\214,\222\317B\345*\036\200\346\030\241\035@0\353\002J\003\346\033\235V@\243\376\365\334\211N\013`\002\n\003@\202\021\\\035mK\244/\202y\306\243\0251\217H\310\336;\245<"
+	.string	"<"
+	.string	"<"
+	.string	"'O;1Ip\260A\305\356f\324\364\357\225\316\317\177\352\025q\004_)\021N\253G\311!\005\306\030V\f\251\202\370\324\347\203q4\347\004\300\356z\212#\204\373\272\355"
+	.string	"\266\005\330\307\002uN\177\242\201\202d\231\320x\330%\265`\261 \256\016\026l\337>\371\331\026;$\034\371|\312\307\360\f\337Q\f\\\331\235\360A\265K~\270\203\362\213\343\030\354W}\006\366\313\237]\"\b\346EW\n\376\324*U\324\013\260\323k\030\021b%\202D8[\306f\275\b\263\023(\230\027OA+\025\253\f)\350\313\352\002\353\304\316\0256\tNJ\301~\335\3355-\331G\375\001.1@\262\001\321\210l\231\213G`\363t\006\204>[\327\211\264\013k\031\357\200\267\t\025\3208\231\306\311>\235\215'\323:/\313l\230\003m]\026\342\270.\263\220\373\272\264\344\262\001\035\325\312\254\324\346\002\016"
+	.ascii	"\325s\341\214i\006j\263\325@\304,\225a/\241Z\005\201F\204\230"
+	.ascii	"5\004(]\346\210\273\034\263I\032\230\332\003"
+	.text
+	.section	.gnu.lto_taskTelemetry.128.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"\235\013"
+	.string	"\246\226RB\020Q\234\016s\306\351X\\\240h]"
+	.string	"R]-8\274\363\266\n\360,m$P0\357\nej\206\032=5\203\300d\013\271i\310\004\304C!*c)\2263\270\025@\323\034fQ\305\377Q\333{\313\224\002>"
+	.string	"="
+	.string	">"
+	.string	"\356l\221\207\250\235\234R|hA\262\273W<\275\273\214\332\371W\275\362\201\336%E\304\24340\022\303\306\005$IL\351\304w\325\025\0048R\235@\330]\353\007\206\270\347mG\260-\301>\201\273\353h\262\237\372\245\252?\271\344\230\361"
+	.string	"\306ni\205cA\246\f\024\266o?\354l\213\235@d\301\365*_\305WtOype\227\204\213\217\335\360\200\013P>3\307X\237\362\001\254\317\226\321\373Q%#\037\321\232\365x\301#\204\244%\366Y\334C\363MX\003\247\377>}\316\372|\354\b\031!\322\225/$Sm\016\035\364\2373\243\350Y_\324\240\261z\303\016=\215%\354\313\rn\200\201\301\006\201\003\005\231F"
+	.string	"W!\373t(\204@\331\266m\300"
+	.string	"\030\323p\036n\023\262\200q.\214s\201:\233\317\205m\334\245\031`-C\266]!M\333.K\270\227\033M\236\260\002\021\305\221\264\250\214\266\347\243\377\002\016"
+	.ascii	"\325s\341\214\351\020j#\253-?\354%T/\330\372bo\005f\025u\n<\272"
+	.ascii	"L\024w.f;40\005\005"
+	.text
+	.section	.gnu.lto_fcTasksInit.129.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\250\t\245."
+	.string	"jO4\021Hp\334Q:\177\\\324f\214\020\274\213\310\370\024\223E\"\005t\367Hu%\361Z\2003\306\240\t\022uP\205\005\3169\004\001{?\242$\3621\236u.9\336\312\277\350\004\366\301_0\252\320?\372\337\376/\371\204\020\271\223\f\001\001\346"
+	.ascii	"\001\001|\353\313k_\266\241\227\325\276\234\3762z/\367/\337{"
+	.ascii	"\371\030\022\210i\351\370\261\246\325,[\032kuZ3\351\026\"\037"
+	.ascii	"\373\227\277\314\177\223\223\275\214sFN\226d\317\021W\306\204"
+	.ascii	"\314\314\304\222lX\237\032\201\211\300\240\001{1'\341\323\262"
+	.ascii	"\245\301\300\314\214\330\263m\227CO\331\300\372\224Y\3467_z\265"
+	.ascii	"\237R\346\030\345\331\266mQ\3778{\340\217\307\327\343\355t9\334"
+	.ascii	"m\265\251)\332\227\345\333&\334\250\222O\007\376\300\200\\\036"
+	.ascii	"\333\204\036V`\367\241C\251\247\2163\221_\250N\355\230\346aH"
+	.ascii	"\257\333\003\333\272<\255\357\264tL\244\216\227\275@\030r\307"
+	.ascii	"\315\025\350a\225u\\\326\275\345\bC\342\270+\023y\303v\250\033"
+	.ascii	"Wy\311c.9uS^R\n\025\266m;uQ\033o\024AS\213\034^\322\210\366\320"
+	.ascii	"\030B\365\262\337\252d\324\275\266\tm\333\362\245JZ\235\203g"
+	.ascii	"\376\bf~\301\274V\tOf\332\215v\332\t\216w\202\356\255\034\355"
+	.ascii	"c\335\2639L\024x\273\177v\013\347\242\345[\216.d\310\240>m\266"
+	.ascii	"\275GRuge\230\367Rkf\351;\251\267I<ac\274j\034t\357\225Tf\r\034"
+	.ascii	"\356\251n\017\225\3061\035\234\226O\247\317%\372\315\316\354"
+	.ascii	"\001D\357\013\360\276\177$\2259\204\b\251~b\346\244KQZ\333\266"
+	.ascii	"u\300\207\362(D~\220\247|\002\305=\325S>\n\365\351\3736\006u"
+	.ascii	"\327\270\327\205\211\273\314,\226\356\251X\030\325O\034\264\203"
+	.ascii	"Ls\266\227\016\3632\352v\027\363\321\266\271\230\323\313G\037"
+	.ascii	";\017\277<\033\365ea_&\320\227\205l\227\007\374\262\200\276\034"
+	.ascii	"\340\227\203~\031\350\227\001\364\345\237_\366\351\313=\277\034"
+	.ascii	"\354\313\300_\376\375\262\357\227{\277\314\353\313;\365\262\256"
+	.ascii	"/\347\322\313\270{\003\312\327@\242?-&\201\276\035I\315)\245"
+	.ascii	"\372I\315u\027\332\270\346\342\241\013u\003\341B\362[w\361\265"
+	.ascii	"\r\235W$\211E%\272PW\245\371Q\277\354\237\001D\327\270>j\276"
+	.ascii	"G\033QYwR\301im\333\366S\027\373P\tu\351\254\253\257ya\276\266"
+	.ascii	"e}\370\332\266\205r\227&I\274l\335\365\366r\306\207\033\265\327"
+	.ascii	"\375\246\353N\366+N\257\217\005\355\266m\373\224\376\312y\315"
+	.ascii	"\013\373q8\354\327\033^\3376f\273^\207\275\273\032\366\307\204"
+	.ascii	"\250\272\036\202\035\215\025\262F\307\223\274\221\226k\233Q\347"
+	.ascii	"\356\226$\323\250\277\274\020\352l\021\025\327F\375+\307.QD\216"
+	.ascii	"\206-r\346L\326\310\021\026\t\213D}\212\353\333\324\0222\346"
+	.ascii	"[{\2469o\3750_\373fk\t\306\345\331\213\272v\352ejI\324]c\265"
+	.ascii	"m}%'"
+	.string	"\3032Y\333\326\350\200/\346c\330&,\031\005\n\352S\265%\240eI\217\244\006\304\023IM+\226>4\265 \026\2130,\3600\204\022\017\222\026Dh@T\020dj*\022WP\210Q$65%U 2\301\360\261\222\002&\025LIM\"\224L\024)\231(j\201\"\211E\221R\221\251H\001\020/\271 \026\213\232\226\226\212E\271%\324\233\213\323#\315\264&TG1\360^\235\354\300W\323\307\357\366!\301\032Ln\005\313L\223\247\227\345J\352\235\301\343\242\2049\\\263\205\364u\027\257g\257\324\001]|\202f\274j5\256\025{u\2217\311b\341`\263\262\324\247\003\372\007m\214\230\245Ls\366tC\027\222Av<\333\021](\240IT]@\017\201a\001z\027\324\001\202\3728\262\332\247S\330:\036\230\223)av@\335L\240n7X\315\264\246\261\237\256\0167\364\024Tf\034\317nD'\320U"
+	.string	"\272\231P"
+	.string	"\372Xw~:\347\323?\250O\263J\243\263\247q\301\356Y\203\375+\245\361J\371t\002[\3755\320\3502\263[,\217{\252_\037+\200\305\250q,d%D3\"\222\024\244$\205\306\260\002\021!#v\021\360\240\204L2I\322\264gE\002%\305\211`\245\206\336\315\224\203L\337\255\305\227\002\275\213\330\303\345\372SS\227\252y\"x\331\352\340v\023P\367\367\302R\262G\020\312o\006P\024I-\2269p\347Y\320\024\2148\264)FL^\005C'\204"
+	.ascii	"HzV\266\201A\232<4(\350\325\215 \210\241"
+	.string	"`}\307\031I~\240l\023h\022\363\237\3616X\236;\275\206VH\001\324I\271D\235Sm1\027$?\344.\206\206\347\255\024\002!\334\020\021Q\234\024P\027\373F\302:\363\035\202W\316\271DN\330\261\326\221\214_\262\302\221c\346r\326\241\033M\247\372\005g`\3369R\237C%0\361\312\322\302x\374O\005!\263\275\241\271(\254\247\377\217\320m\235>jh\271\365\300\3612\314o\245I~\237\364L+9Y\bgGw\214E\2308\004T\310\355\320~\f\231\001\316\202W\0206$t\tx\211\3154\220\r\306\220Anb\364/\355an\365r\334S0\270\211\236!`4`-z\324\037?\247=\317\032\013A\232\342\244\276t\311\375\276\332\305\252\273\211s\341\2307\215\365\226t\371\020H\217\373\231\343\217\377U\225\bw&\257Sg}BN\016\205\342H\245\305Z\344\267\r\207C\341}Ts\333\257\216v"
+	.ascii	"v\371_\373\262\357\362~o\212\223\325"
+	.text
+	.section	.gnu.lto_cfTasks.130.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`H\004\335\031"
+	.string	"Fj\243K\200\332U\007)t\0011Q\322z\241\310\017m\016J\r\353\363\021\353\317\252E\021\022\360\230.:\363\022\241\fVk\2234.\326{u\357\237\270\"\331\317\363\200\316r\374&\210\342):Nj\"\224Z\034\221\177^B\337\277\374R&\031\220"
+	.string	"\217"
+	.string	"\220"
+	.string	"\023Nw\007\354\233\t\366\312\226\244h\262\332\327\342/$HP'\311\bO\027\007\324k0^\355\006\251\331\321>\017\376>z\030\265\223\326\273\200B\257UI\375\325\024\200\033\355_\361\307\201%\244\235\302\336\241\323\335!\3525+-QT\307#\322\001\251"
+	.ascii	"o3c\370T\355W\361\267\"\026o\216IH\f~\343\247a\334y\312R\036"
+	.ascii	"\217\356\321\351\346\340\374\306\027z.\360\224u\345\244y<\"\275"
+	.ascii	"\322o\234\305\364x)\373\375o@\366\033\333\3008v\024\374\337\016"
+	.ascii	"\343\305\020\2139az\f\215l\366\031\247\373P\275\252[m\257\346"
+	.ascii	"\213\366\275\f\333\\\370{\351r\323I\254\364t\277\t\3277\023\313"
+	.ascii	"\312\360\257\264\377\305?\013\026\243N\352\370\244\\\203\315"
+	.ascii	"\3741\233\262go#\213\302\177\212\024\236N2\213\273\276\231F\224"
+	.ascii	"M\332w\302\037\312\023\236Nr\275\017N7h\355\233\331\245$A\333"
+	.ascii	"\032~\222\366\225\360\357\342\362\351\244\026\204\323\375\371"
+	.ascii	"\365\232\213f\024U\rT\r=S\244\375%\177#L\t:\t\246\f5\336\306"
+	.ascii	"\347x\035\377\343\201\374\220'\362G\036"
+	.string	"\311/y&\357\245\340\251|\225\327\362[\376\313\203\375\230o\346c\306\2207d7/%\310M\bz\211\1773\210\034\202g\021\231\351\246\221\\\257\f\023}/\273b\034\222xV\352'\362\007b1\307CG\261\275F\2448\335\177\201\323!\250\221^\277BE\337\313(\312\274\225\221x\326@,\336\344\f}\205F~\2618\335\237\352-\372^~\275[a\374\313\2201j\244\227\250\027}/\277(cM\332\007\023x\227\262\353o\235\341\236\\/\206y\352\017\267\261.\275\335P\031\213\322p\004Uc\035\232S\323u\206}n,\332[s=4\234\342PV\307\373a\035\244\252\352\273\r\300+\253\246:\024\370SS\226Ey\004\340uE{;\336\355\304<\025\345\3318\355\361\2619V\207\322\360Oe\323]\252K\331\031\354\263\372z\300\336\272\243a\241\016\037\342A#\2400\310&\f\262U\020\n\022\331\204E\334\246C"
+	.string	"\017-"
+	.string	"\025\331\214\206\303\"\033\r\376^\250A<\204\034\246Pa*\265\232\003"
+	.string	"C\021#z\020@Td$\017!\207\020\345\367\243\311T\0019\325\336\366\345+\026\357\337\224\225-\341\245\350\227P\013l\334\302\303\307o\263\337\303\031\033\310&\362\361\276c\324{\350%\342\025)\211\222\204K\204\313\370+\223Z\201O\027C\262\235"
+	.ascii	"\177\331HO\267\321[c\361\327\262\216(<\347\231P/\261Z}\303<\306"
+	.ascii	"\230\277s\241,Q\314\177\253\314\317N\242ch\2318'\t9\264v!\204"
+	.ascii	"\022\302p@,s\"\210\311\022_\270\313\214\b\302\213W\352C\301\330"
+	.ascii	"\334\303\303\363\177W\206\223\001"
+	.text
+	.section	.gnu.lto_taskMspPush.part.0.175.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\005\n"
+	.string	"\306\222D= \345*\035"
+	.string	",\004X\002\005\204\005\214\253\276\250\016@\214H\217\001\020&\322\363\334|\2131F4\204\024\352\227#\030tkW\t\241+ \201yE\313\004\t\241\321\020hm\333{\357\224\002/"
+	.string	"1"
+	.string	"2"
+	.string	"~\212m\225\313\240\r\340\241\311jb\037\036.\001v\267\236\312\222\203\227q\202\376\352\222\363\ny\354|j@\273\353\215\310Mo\233\301\366\204\375-\376Leo\376\f\264\267S\333\252\313R3\334\227\253\241\366\020\343C\177\345,\340e)\013\354\222\320^vC\205S'lN=7\310\234\316\023dN\035\266&\276\345CmvYo]\332\032\033\361-{:\344\312\237\235CC\211\331( \312\230\345\234+a\366\303\377\263\203\240\262\013R\033\260#\024\346\304\366\035\216\270\200\b-H8t\237\202\257\242#\215(N\245\316\363P\334\200\271\317\207\361\205N\026\234\250r\242Z\032\205H\225\363\276\3729\260)\243\363\352\311d\362\352v\t3\210%9\244\2149\021"
+	.string	"\325\263\200y6\340\234\201\273zV\221\002\310\003#\\\207\0375\266\360,i>\303\266\231\262\323"
+	.ascii	"p\355\0017ZD\277\253\214\001"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.176.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"\r\f"
+	.string	"\226VRB \217\232\016@\204\n\b4L\221\001L"
+	.string	"\363\233"
+	.string	"J\t\2648\206}a\024\025/\031\215\034\003\221\026r\0206u\302\267\035B\372\201\204\202\002\20380;c\316\200d\025@\266\343\335\"\263\326\366\2262\245?"
+	.string	";"
+	.string	">"
+	.string	"\\\312N(&8\254\220\261\273\361PQ\236\375i\302\314\177\367\215\266\215\374\245\266y\270>\004/-b\b\330Fo\243\204\204\366\356\331a#\311\034p8A\330]k>\334\322mK\260\035\301~G\267\337\211l\216\337e6\347\320\266\350*\"\217\333\315d\201K\203\314s>\212\247\310\256\"\342\315n\b\026,\273\\\202C\037\320\034r|C:|\357H\207\366O\330\026\2318\263]\036/6c\254\177\n\314\013\213\352\211m\r\322\365#T\300\030%\214\247\324\3541\311\016\311\220\327\256\005Vf\264\214t$\365\304\n\337\252\b\373\334\237\232\376\324\2112\273%32\013\002\272(a;\356\260\340\340\243\340\001\203\312C"
+	.string	"\243P\201>&\204@\252\353\n\241\002\230\362`\027\260O\250\002\345\021)\217\b\362\361\001E\352\302\242\307\200-\f\325\025C\226uE\316gZ6(\211\365id\252\r\262\362\2329"
+	.string	"\254\304\004\025"
+	.string	"\325\263P|6`Na\021\3666\030\035\346Jz?\020\306F\006\373"
+	.ascii	"Q0\314um\220\306n\236%\315g\3306Sv\032\b\256\275\230\342\320"
+	.ascii	"\324\270w\2251"
+	.text
+	.section	.gnu.lto_taskCalculateAltitude.part.0.177.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\035\f"
+	.string	"\346\326SC\020q\233\016p\tC!\n\034\204\243\202\022\305\270\003\300\0024H\032\237\220*\260\253\021\215\211\307\330\353\266:\203O\\\224\240?\0041\001\361P\bD\360\230\376.g+Ai\177_\317l\337~\333[\312\224\002?"
+	.string	";"
+	.string	"B"
+	.string	"\367V6\243B\002\204\013\035\273K=\252\312\265C\315\250\371\377\276\341:\322ar\235\210+T"
+	.string	"\023#\207\200n\203\035\223\024\334\277g\210\256\224I\3401#aw\255\031qO\267M\301\366\004\373\240\366\355\177#\233\343\177\232\315y\264=z\013\t\364\266;i\2609\310\274\347\2578\013\355-$\336\354\236\250\341\262\353-xt\002\315\243\347\235\351\021\276\300\364h\237\305\366\350\304\232\215#\233\222\f"
+	.string	"\306\f\033\233;\254\377J\f\214\213j\212m\017\323\025C\213\033[\306xJ{\244C\236\273\"(ay)))5\305\032\341*\212}\357OM?\363\027(\006\224\3305\351\301cMD\031*\034\206\220\341A\210A\004\220\3651\220Y\260B@*\210D,\f\033\251\002\270\372d\032\262\220\350B\365AU\037\224\bH(\204\252\260\214\372\034\360\265\301\302(\321ua\024\347p\025\305ZB\343\345\203\226\340&S\355\213C\236\263'\023"
+	.string	"\325\263P\3706|\226\215\257\326\260@\327I\357\005\006\353"
+	.ascii	"Q0\314u\255\224\306n\236%\315g\3306Sv\032\b\256\275\230\342\320"
+	.ascii	"\324\270w\2251"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.178.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\230\001\245\017"
+	.string	"\366\034hG\360\220*\035\340\022p3\311\237\202\207q\223\035\300\271\\o\365@\375#\353\346\252p\020a\352\3252\007\327w\356\005W\233\020\2658!H\242\305\232\001q`9a\363\200 \246\343"
+	.string	"\202\301\264\263\272b\211|\262\311\336)\005P"
+	.string	"R"
+	.string	"P"
+	.string	"\257\335=\274\327i\373'l\233X>\3313\016cY\214+g2\253\261\273\341+%\361\323;:\353\311\277\354\034\253\022\365n\256\312\017\247\035\002\234\013\032\035\245\252\373@)\261\272\355\223C\231\232s\300+\346\301\356\372K\271\275\333\236`\333\202\375\030\001\006U\260-Y\033\027\347\265\307|\332f\004\307>mF\372P\254\357fr\202\223\360\275\336\217\231|\2313\266M\177\225@\225\004\257~\354dg^5\2704OT\255\335\005\331\200\340\314y\230\237\342*N\177\225\314\261+\242E\313.L\201\017|\257\340?\274\270\026J\362NI\231\f\325|1\200\233\007\227\245\257\035\304L[D2\277:\275J+EQ\276\355\357p+]v\372,f\316\177\335\020Jf\316\264R\227\375n\351\212}\317\303"
+	.ascii	"\212]\224\0336\266U_\230x\355\217}\332\367k_\341\333h3R#\310"
+	.ascii	"\203!\2443F \215\240\214\033\2040\350\2008X0j\b\210*\214\037"
+	.ascii	"\017\205\021h$I\0221\200E\215hD\324\031]\020EBQ$\004y:\237P$"
+	.ascii	"E\241\246\200C\031F2\034\205Bd8OWd\377n!`\224\320T\227\231\247"
+	.ascii	"\002>\342\331\237\320\374\312\340\006\212r\307-\345,/\001\" "
+	.ascii	"p\002\231\272\335\324\266@\020\313\372\341\020\0362\005\t\032"
+	.ascii	"\356\220\360\330\013\323\002\241}G-L\020s6\240\021J\224\220q"
+	.ascii	"\f\247)\206B\3027\356\371d\r\242\b\206$\243\315y\225:c\231\321"
+	.ascii	"\240z\013\253\363\366e\203\344\305\367\320|\334\273\360\030"
+	.text
+	.section	.gnu.lto_taskUpdateCompass.part.0.179.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`7\001E\016"
+	.string	"\206\331^F\360\224\223\016\320+.\35066\245\226\235&Ny\001\232\377\260\226\220\n\236\211\023\245=\017\275\025\021\035FD}\324\377m\326 \365\214\013Iz\221\302.\017\277_\251\244\265\262\271\356\337\315\017\004R\267\377\357\275wJ\001D"
+	.string	"K"
+	.string	"M"
+	.ascii	"\013.\235\340s\211\340\004L.\343\005\230\\\332\217a\0335\343"
+	.ascii	"\316&\362\312\332\223\225\220\020:\257\335\235\227p\305\273\303"
+	.ascii	"\027;\377\255\203R*\231\303"
+	.string	"\220\252\304_\312\343\t\205\335\365\307\304-o[\3056\213\375\021\001qQT\026\215\204\026.\031\257\365P\025\\\3474`|*PY4\330\213! `\274v\353\274t\375\3340\3171\310\b\022\354~\013ec~\253\2631\243\216\023\023\353\252f\032\3348x\357\325\277\371\214\35681\006\355\326\350p\355\326\376\r\222\215\357l>\213Ko8\275\247.C7\017\264\351\313{\312o\375\023\204\207+I\221\017P\306\001R\324<\347?\361#\207\b\236#(;;\200\354S\362\340\3120\306\2056\366\353\377\2302\241g\227\304\222\236U!q\270\250\201\362)f\021Q:r!m\331\244\334FK\032=`\b\031\036\214\030DP\321D\003\350\005\215\324b\301T\3228\356%\003\340LD5\320\221\tC\2662\263\225Yj\031\221f\306\321)2\340\315E\343\246i\333\270\211=.\264q\205\036>8\300\016\020\256l\207^\036"
+	.string	"@0\276z\026n\220\rKj\030\267\346\f\224\032=\026\314\330\210i}\305\032@\024\fs]k\262L"
+	.string	"eBO\207Roa\020a#"
+	.ascii	"\324\3428X\254\022\302\345Y\307|\006\260\231\274\323,p\355\305"
+	.ascii	"\224\323r\372\265e\f"
+	.text
+	.section	.gnu.lto_taskHandleSerial.part.0.180.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`\350\0025\026"
+	.string	"\266i\221J\260\324Q:0\024M\320\254\373\336\340<!\203\301\242S\246o<\330)\3315\277[\226O\201d\224xhe\377_\237\035\206\177\036\226z\254\362\300\266;V<\221u\367V\203\356\016\207\272o\374\303c\251\017\350\377\204\354M\244\224)|"
+	.string	"u"
+	.string	"y"
+	.ascii	"\274\302o\214\225\261[\245\236\267jEq\343\251V!\313\023\220;"
+	.ascii	"WV\205\356\024\027\205\356\344\377\373\342\277.\350\273\237\310"
+	.ascii	"\nU\324\261\310\3517LRk\215\355\354\024\273[:\305\346q\367\345"
+	.ascii	"-u\005I\354d`PhE\021A\322\225\024,\370#\022h\372Y\361\n\372p"
+	.ascii	"\213*TEB`A Q\201\211\251\021\333\264\f\"\350c\016\260\343\030"
+	.ascii	"Sk=YbO\356\177\016\377g\376>\020X_\245\335\036c\275\307>\372"
+	.ascii	"W\254\265"
+	.string	"\326\267\321O\371\256\026\277E\362I\312\037w\270\247#\177R\276H\371M\371<\371\213r\022a\252V\021YJ*\321\304\341b\207\273L\313\377\376\313\244\373\016\267\351\257\353\204\272U\352)\213\234\254j\025.\323\356\265\363\205\005\314\277K3xH^\020i\003\310\020\253Z\353\202\235\227!wzx\017\177\360!\252\265\272\274\b\301p\255a)\210\017_\375\373\264P\026fd2\272sl\025\244\241^\331\203\366\016w%\205\177\f\031x\201\264W\210\310\327\274\217<\306\035U\225\261~\302[\322\314\310Z{\013\234\375\323j\274\300\257\3744\357b\317fa\260\335b\357o\310\307Y\347\275\016\312\335\275@K|\315\275\277%_\032[c\303\267\305m7\274\300\033\272s{K\244\241\036g}\233\326UBUU\356\243\222\0039Y\315\315\206\253\351\220\177P\343`\346\002\241A\255%%'\253\341\330.\354\344\324p\270\0164"
+	.string	"\247\265\344nr\263\035\032\232M\214f\023\313\261\315pb4\\.\3262\3407\235\032.\266s\273\341b\257\377\274m\364\230^\373\250\001v\365J\355/aB\253]\033\265\264[\275?\030>$\263"
+	.string	"\223\r[\031\372S\250@\233\204\225F6\204PT\222\270<\2246n\311\207IY$\207"
+	.ascii	"\223\362GUe\250#T'\272\217>6\r6 `\002!s\351\001\331\266!:\304"
+	.ascii	"\361\227L\245[t\275\021e8\211\274\213\371\263\300li\334:\013"
+	.ascii	"1\200\035g%5\220\361c;\347\t\264\256\317Y\201\3630\322E\314l"
+	.ascii	"\266\215\316\216\332\260Y\027L.v)\236+3\336\001\223D\225v\020"
+	.ascii	"\322u\250M\314j\213\330Pyn\230\013A:\240(\273\by\030\246\030"
+	.ascii	"6\240\266\344\240\322f\354]\326,0F\274\226#\270i\177\300\362"
+	.ascii	"\332\200\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375`c\007e\027"
+	.string	"6\343\177H\260\226J:\244\324~wv\276\304\263\2636\352\r\341\372\2571+^\305&\017\350`\221+\034\207\311\021\210^gggf\337-\023\024\236\202\025\236\224\006\331\303\226\374S>\351\030\234Ks\235\0138\326l\253,\2020\271\223\fi"
+	.string	"j"
+	.string	"k"
+	.ascii	"\373\261\006}\353\003\320'r\240\376\223\371\323\353e\346\256"
+	.ascii	"\365\371\364\235\350z\277\364\364\233\360\364\236%\3503\231\b"
+	.ascii	"\372u\356\364\227\350\334GN\257\331\254au\327\346\254\246\017"
+	.ascii	"\344U\024\353\027N_\t\356]\007z\265\030\270\021\260\212b\230"
+	.ascii	"W\201\336.\003\b\234\305\267\273S\f\003\333\355\335)T\207\251"
+	.ascii	"\265\326\233^.swe\226\002\036\372B:\364\2578\364\203l\350[i\350"
+	.ascii	"\323\310\320\377\201\241\237\344B\237\313B\377\310k\205\376T"
+	.ascii	"\245\320GR'\364\307*\241\337\242F\350\2738\204\035{\260Q>\007"
+	.ascii	"+\345S\352\367h\320\347\301\240\277cA_\207\202~\325\223\3729"
+	.ascii	"\216\324\307\361\215:\272h\364\033\274\333(:\325G\364\031\337"
+	.ascii	"\320aT\260]?\212\205z\267L\336J5C4|\261\033\216\235p\374Q\350"
+	.ascii	"\306 \271\273\361E\333\314\316\f\220-\310\306\027\243\325~j|"
+	.ascii	"\243\243\361G\037\032_\374\315\260\316\306@\231\036\220\235x"
+	.ascii	"`\030\324\231\f\216\223\337\233\2544\031,\227Ar\371\345\277e"
+	.ascii	"VF%gy\251\377\342D_\206\211~\215\022}\222D_jD\277\210\210\376"
+	.ascii	"\220\020\375,\020\375\030\037\372X\001\273\242<\016W\231\326"
+	.ascii	"\216\262\212\362?X\256\250v\224S@\225P\244\216\362S\3714\242"
+	.ascii	"hj\032\231"
+	.string	"zL\243M\357\210\262\315(\240\027\200\374\222A\361\332\322Q\316\205#\256V\326H\032\215rL\217Gw(\022\345\227<\312'i\022e0\353*\314\275K\312\312\212Q\216(\344\230\261(\344Z\371OU\221}\355B\276\225\237U\262\\\301\342\205|\221\246\206\003\200\210\250a\034I\301\230\224\221\302\306\030\360\002\021)\352\034\021p\024\215!\251D\025H01R\017\251<=@\303&\021\341l\211\312<\315\027\362\013\365\203\004A\0337d\307kst\316\245\330:y\213\342\303;!\243CD\203\320LR\344\232\362\264+vX{d\230;q\254\306\b#\216\354\320\240f\3644\002\002y\220\250\331`7!\021}\240\022^\2434\353I^g\t\311[\007*\350\265 5E\326\222\226\024YK\251G\321#\234s\211\br\351C\334\2028\247I\3640\217\372I\017ie&'o5\004\260\247\267\242\364q\321\321\246\260"
+	.string	"P\243\363\233\346r^8\307\357\341\255\205\"\007o\355Hb\364\301"
+	.ascii	"{\216='3\244Cn\260q\367\314k\013\340c\350T\304\301\022_\002\222"
+	.ascii	"\311A\357\204\201\335a\332\275\036\271X\025"
+	.text
+	.section	.gnu.lto_.refs.e0aebde21754a391,"e",@progbits
+	.string	"(\265/\375 \214u\003"
+	.string	"\302\210\032#\200EI\00730\0033p3!\0232!o\\\354\r\350\213\377\004\375\277\375\337P\377\366H\263h\023)S\253.%\224i\323+i\244\220>m\037u\364\032\265Q\006\373\200\305W\332S\332O\332G\355!\3053\350/1B\235\326\017o\034\3168\277\016\375\270\341\276B\031\277\365\302\273V\274\203\nx\n\364\370%\226'>\177\200"
+	.text
+	.section	.gnu.lto_.decls.e0aebde21754a391,"e",@progbits
+	.ascii	"(\265/\375`MR\225g\001\n^\016\205T \fa:\215\001\3041\371U\037"
+	.ascii	"\3438n\327g\324I~\274\023}gO\260\034\227\365]\037\362\f\373\327"
+	.ascii	"\317\242k\232\346\253 \273\306\272Q\254eo_t\305t\372.{#Ut\205"
+	.ascii	"\345n\0273\243\205\336x\037\317\300\nl\307b]\207\322*\333\336"
+	.ascii	"RJ\231\002l\0077\b\244\bh\236zV\224uuwb\344\354\030\233\034z"
+	.ascii	"J\356\254\223\310\256\253[s\333\\6w\316*\257\334\215\373Ms\325"
+	.ascii	"\034\001\275X\276\200\363\223{Ikt\376\316\026\235?e\350\023\204"
+	.ascii	"\316\274a\303\345\346\237/\364C\210]!X\313\275\223\266\313\333"
+	.ascii	"\225\272/pR9\2010\033I^\267\307\224.o\367xq\204e-\337l\236\273"
+	.ascii	"q\022\331\2432\345\306}\2730n\026N*\265\213)]\313\275\223v\356"
+	.ascii	"\276\331;\213\207\317\216\332J\024\216e\230\013\346\212\271d"
+	.ascii	"\356\231;\346\226\271f.\234U\336\267\233\343\226\214M\363#+\367"
+	.ascii	"\373v\307\356\027\017\250\216#D\345X\232\275Y6\326\316\220Tr"
+	.ascii	"o\205H\306!#\333{{\360\340\301\346\211au]\310^\216\200\312l\034"
+	.ascii	"yq\363\3157m\345\266\251\305\230\033r\221\036P\035}^\250\271"
+	.ascii	"a\347\376\r8\270Y.\226\273\004'\221\27551\034\313\244*W\212Z"
+	.ascii	"\026r\357\344\255\331\221+\305\003\252\243O\f56B\374\266K\226"
+	.ascii	"\233\274mCj]2\310\356\256\333\345r\225W\313\335r\273X\345\315"
+	.ascii	"r\257\334\312\3315?\362p4$E'\315\311P\276\271\246o*\3217\211"
+	.ascii	"\350\233bk\227\215J\357L\020)\252\233o\036\327\250@@\r\017\230"
+	.ascii	"\332/\025\242#a\252\320n\276i\267\354M\026\264\252\233\357\024"
+	.ascii	"\rv\243ly\363E\263W\302\314\240\234a43;)gK\312\\E\335|s\n\312"
+	.ascii	"\215b\326\363BG\356,\016\0243\":\027V\354\236\374\232\t\2651"
+	.ascii	"c\004y\363mr\313\352\312\250\234\22591\317`0\tK\n\301yj#\273"
+	.ascii	"Z\031|\300j\230\021s\363e\362\343&\316\030\267%\377}\314\260"
+	.ascii	":o\264\334|\221\334$V\311\341*I\022\t\355q\262\007\357\346\347"
+	.ascii	"5\372\226\303i\363,\207\363\371\255\310"
+	.string	"5B\344<2\027$\317J\021\"\271\315\006\220\260\333\375\0221\321()R\345\346\347)\372\031\t\220\033\344\207&\242\306\253K\016 ?\342\330\366\234\217\337\037\247;\333<}\301\323u\303x\344\341\332b\344\346\347(}\253\274`<.\026%VW\2766\340\300&\203\366\206 <d\314\314\270\371vw\307\177\237!\271(Z\270\334|u\fa\241\331`7\377\267\312\253\343\346H\356#\237:sz\236\334|\214G\037\333\351\f\246\226\230\213\262\233\257\215\273u\273,\\\027\205-\225%\314r\357}\303*\257\215\253\345!\303\335\302\002DM\316\377o\r\253\274]\227\353(\2717\333\355\2722.\r\013\327\225\334[\r\320\242cy\267w\362\310Cf\202e&\227\363\361\025}\253<\234;\343ty\214\f\027\224\233\217\327\364qR\037\233\351c\244>\036\242\357\325\305\262\312\002\334\030I\242;\246\247m\312\315\307a\372\266"
+	.ascii	"'\316\313\263\0058\217\275\356\213\377B\335\250ke{[]\316\334"
+	.ascii	"n\276S\227\312*3\\\027\267l\267\352&Tr'\353\200Di\335L\301\032"
+	.ascii	"\235\3073\264\t\366\266\031N\233\227g3\234\307X\032\2045:O[t"
+	.ascii	"^i\215N\273\307\346\375n\253\347\033pp\374\204\266\315\366\336"
+	.ascii	"w#\340ko\250\273\211\362\354\rEd\355\005\326^\220\313\302\214"
+	.ascii	"T9\363q\225\376\305\323w,\036\033W\007\217\325\233;q\272\316"
+	.ascii	"\021\221\214\034kU7\377f\321\017\321\306\302\301gG]E,o\271w\362"
+	.ascii	"\277\235c"
+	.string	"\355\254\322\322\261t\317\311}\233F\307\306\261uCR\311\2555\364\243J\006\231P\225;<\2563/\255\034\"\030D\\\214\335\374\333\265\274X\372\366\316\276\271[jB\254n\276}c\335<\243}\ta(\2562Zn\276U\243o\335\264\005\266\350\304\333\032\235 \262\350s[\243\363\266L\243\261'\004)\363Pq\335l\315\3303Vy/\026n\023\331 `\236\202\334|\213D\263\330{o{/g\357^\316[ \372p\266\350\274\215\241\277|\003\0034\306\215\233#7\337\246\375I\026\214]\263U,\034[fbf\271\367\376o\303\330/Vi\301X.\267]\254\227\347\344C\374I\267`\354\025\353\266\301jo0\035\030x\330\255\355\270\333;\351\341\310\003\256:a\312\2213\333m\215N\n\266\350|\t\332b\261Y\254\262\203\335rk\305\246\335G*\271\323\366N\022\371\310\315\311\301v\3635\240\203\224n\265<"
+	.string	"`\233\203[\240o;\234Dyyyy\266\303\371\n:\333\242\363\267m\267U~\253f\251\\\313\375\332[j\357\215\341\236\221\243\343\356f\313\226t\333Vt\036\273\222\233m\357M\204\225_\250\362\334|m\321y\255\017g\215\316 [tZ`\215\316\337N\351 tG.\212\354\346\337\242\331d\357\311\2270\266\233m\362Z)\366\3546i\243|\003\016\036$\265\315\366N\332d\336\033\312\332\013\206\254\275\300\364B\004j\312\231\177\365o\241\374\366\2115\343\200\253\256\2766\333\336\311\nDI.\254\0367?i\215Nm\213\316\353\001,\366c_\217\037{@)\254(\005o\340\377\211\031\025\374\246\001~L\302\1771"
+	.string	"\303<bT\200?\300q-00\220\300\"H@%\364_9X\fx2\315\037{\200C\334(\301\365\237\357\374W\r\230\037\333\370q\027\346\3721\215\377\262\370\362\343\031?\226\261\206\265~|\374\357\026\306\302W?\206\201_\374\330\nW\375\330\005\246\372\361\024\216\3721T\230\377n\371\257\333\177\313\3747\315\217\367\217O\360_\022\374\303ob\371m\227\377J\371o\bp\t~,\202\004v\310o\221\330\037\026\211G\360[\030\270\305o\233\376[\002f\361\343\001,\231\360\343\n\374W\002+\376{\271 \300F\241\215\337f\375'\300\377\023\377\013\360_\312\023\360\233!\376KD\203\3007<a\252)\240\377\276\300\353\177-X\375\355\362A\277Y\364_\"\332\177~\223\303"
+	.string	"\376o)v\270+.\361\242\331\345)\374\231\315\2177\330\003X\r\212\007\372\363\t\377%\242\221\300\316\177e`\021\374\327\362\333\003X\r~\213"
+	.string	"\033\201\377\033~\354\364\333\345\207~s"
+	.ascii	"?\006\361c\342\360\267\313\373\374Y\316\217\205?V\361c\340\217"
+	.ascii	"\231~\234\376\270\204\037\177\340\307&~\034\302\217'\360c\022"
+	.ascii	"?V\3721\004~\354\200\0373\340\307\n\370q\322\217=\374\270\303"
+	.ascii	"\217\t\360c\f~l\301\217\003\360\343\r?\326\360c\241\037\337\377"
+	.ascii	"\326\371/\235\377\326\375\227\356\277o\376\333\346\277s\377\225"
+	.ascii	"\373o\330\177y\374w\307\177s\374\027\307\177m\374w\353\2775\376"
+	.ascii	";\343\2771\376\233\365_\253\377\302\370\357\324\177\251\376\373"
+	.ascii	"\364_\250\377\232\340\277$\370o\t\376\313\342\277+\376\273\376"
+	.ascii	"\267\370_\247\377\206\340\277M\377e\372o\212\377\246\377\375"
+	.ascii	"\375\027\305\177K\370/\b\376\353\201\377R\376\333\201\377\342"
+	.ascii	"\377n\340\277\031\370\257\004\376\253\364\337\003\374\027\203"
+	.ascii	"\377R\360\337\013\376[\301\377-\277]\376\226\356\267J~\233\344"
+	.ascii	"\267\307\337\306\370\255\212\337\206\340\177\230\377h\377M\374"
+	.ascii	"?\373o\366\277\204\377c\376[\310\313\313\313\373\317\031\177"
+	.ascii	"\005"
+	.string	"\257\237\001B\001\035n\024C\037)Qz\256\3737\340\300*s\335]\222\237\320v\326\217\013\2645fw{\207\311"
+	.string	"\323P\236\261\335\374\013h\364\006g\224\362\233\f\347\231\216./\365\336\373)\271\263\216\270\240\311!\357vWW\007\037\030Tgq\342Xe^\232yY\336\271\371vX\316\177\037\237\027!w7\377\002\023\375\337\376\376\347\206:\356\275\267\314\344>F\005\235\277\2755\255\355\360\013Yl1\370\237\377\r\f\223{\212\212\222\275\267\245\243\223h\201\302a\3016\341\216Ui`O\021"
+	.ascii	"\323\222\002\253Q\225\006\246U\241*\rl?I\025y\252p\334`OUi{W"
+	.ascii	"\220\222z\"\361\245U\225\006\265+T\245m\255=\205F\313\356$\330"
+	.ascii	"\323\226\372\332\025\266\324\206\332i_Z\026TI\201iU\245AiU\250"
+	.ascii	"J\003\323\332i`\233\302\226\202:ZI\355c\205\235\006&g\247}iQ"
+	.ascii	"\250J\373\322\252J\003\013c\211\274@\223\207\206\232\222\261"
+	.ascii	"\027V\253Jj\307\300\362\202:R\200\253J~\355\271\275-\033\325"
+	.ascii	">n\270\2751\330\333\353\3538"
+	.string	"\007U\303*\243\340bD]\201\372\262\311\275w\006\254\250\260\257-\005\367d7\\\225\222\257\275\225D5m\254\275\367F\300S\022n\007\261pO=\274\366\025\325\336\032vro\254\275\237\354\206\333{?\355\275{G\257\344\3367(T!\261\260\366\356:\302\332^O[\250\366\276lm\224ZUia_I[\250\244!\267\213\344\223\255\272\372\332\310=\007v\324iOg\373j\357m\347h\244\226\214\272\233s\233\336\226-4=n\376\005*\2354\333;9t2\031\342b\313\315\272\311\221\037x7'\253\334 \363\343\346\254F\243\361\"\243\273\371Eu\222@J\035m3n\316h,\227\0310<7\277h\215\316pDc\350\272\214\334\374\242\023t63\324\343\212N\313\315/\022\2433\031\"0v;\2247\277(\213\326@N\214\230\214\326\023\253\303@\220\240\265\271\371Ee\272\003\022\245\3470\267\312\034&\177\211"
+	.ascii	"\233\336RK7\034\250\240\350\271\371Eb\372\317`\276\334H\203\303"
+	.ascii	"\316\315^\274\b\251s\344\346\027\321\320\017\221\225\371\312"
+	.ascii	"\030\344\245\263\226\333\316(s\226,e\341\200\344:s\313\254\314"
+	.ascii	"U\314,\263[\346\222\267d-\271\213Ufe\306\222\226\225\331\212"
+	.ascii	"\305\003\202\341\326\304\314\335\336I\323m.G\233\240|\013q\364"
+	.ascii	"-\234\321\267\240E\337\202\232\276\0052\235\3312W\031\261\"7"
+	.ascii	"\337\002R\337BXV3"
+	.string	"\241N\210\230\233o\241+\247)\363\224\214\346U\247F\224g\264|6\204Ds\265vsN\016a\231\212s\347\346[\270\312R2\224lf\344\b\226\0307\347&\331\314G\251\307\214\020\263'N\306\320\361\272\271,\004an\312\334|\013[;\311dz+\315\256\272\371\025\350\350\333e&\275/o\276La\262\304\207\2176\266\233\263\222\030z\250\340\364\2552'A\"\202\016\345\234#\317HN\227\331LY\311@\312\265\301\203C\032\351M\341\021\223f$\027\t\322!vc\315\315\257\300E#\345)\375\317=\336#\017\261h;\313\376\200\032\253s\267wW\007\0136FH\231<\366<D\315\033=On\316Bn\326\177\237\214\006,\317\327\315\267\313A\376\373\234P\323\346\314\315\177\016\222\201 o\314\321s\363\217\036W\024\03607\277\202\022\235}d1\233ck\210\224\233_\201\210~\005\032aRP\264\350as\363"
+	.ascii	"\214(=\363\270Uf\036y\207}:\332\275\265te\320#\363f\247\271\371"
+	.ascii	"\024"
+	.string	"\360\350?\177\345\035]<\2428\271Y\207\b\332\314\362n>\2054\332*\327\300I\245\316\022\206\225#\337\3108rW\266a\225\331+We\257<\005c\351\205\353\262\024N*G\210\273Z\356\275\263Wva\225\224\2752\325\213 \271;Yl\2022W\206\2401rU\366\315\247\240\3243\262\f\253\3144\362\225]\336\262p@H\340\311\263\3144\360\234\fc\310\334\033\f\017\271\367\316\340\301\303O\235\220\033g\326J\023\372\361\265d\307\315\247@\026\007y\3141\2542ge\254\264\234E\004\256\256\356n\357\355\341\310\003\276\223Vfy\346S\350\241O\341\250\377\374\342\031\206\225\375\332\030\200d\300\261\261q\363\006I\317/N\262.<\356\334|\"=\372Dk\364\211\310\350\023\271\351\023\251\351\034\225\341,\242\006\217\227\233OdD\333\341<\013\007$\357\311\222\241\362\266\312\374\204\351\344'<\347\276\0302\367\206\302\202\364"
+	.ascii	"\264\243\207\226\325\231\367\340\2737\245\225\233ODC\377V\325"
+	.ascii	"aC\336\271VC\346\336_m\310<X\017\306c\225\030\017\337\375\342"
+	.ascii	"a;\327\352\207\034;f\356\216<\230u\226w\344\350\374\2419\372"
+	.ascii	"C`\364\207\334\364\207\256\350\017\251\351\017\031\321\037\032"
+	.ascii	"\323\037\n\303\313 (\256,'\334\374\241\033\372\307q\342\202\314"
+	.ascii	" \261r\363-\2258l\305\272\341\263\243^\233\222g9\347\304\013"
+	.ascii	"\371\344F\227)7k\b\212\302\226\232\202\201v\225\214\201\314r"
+	.ascii	"\007\031\242\212\036$\027\224.\344\f3\033\226\212\325\022\f>"
+	.ascii	"\203\305`8\230\f~\203\325`9\374\005\263\301hp\033\354\006\303"
+	.ascii	"\3414\370\004\\\006\233\301k0\035~\303c\360\034\366\202\303X"
+	.ascii	"%\216\303n\307\\p\2273\254\245\355\262V\205L\373m\0275\261\027"
+	.ascii	"7\252\311\216e\333\036d\027\266<\244\235+\303\201|\302\202\207"
+	.ascii	",\307\362\326]\301C\356\235\304qX\211\267\340$\322\307EX\234"
+	.ascii	"\2718\314D\r\3102\312o\273HQ\023\207\265<\311A\200\224\247:/"
+	.ascii	"\017*\360\264\001C@\276p\326\350<\200\020\336\226\022\366fK\222"
+	.ascii	"\027\243\356\346\013\331\351\013\305\351\013u\321\027j\323\027"
+	.ascii	"r\242/dD_\250\206\276\320\224~\020\033\375 2\372A[\364\203\324"
+	.ascii	"t\007kt>H\212~\020\023\375 \"\372A9\364\203\246\364\347\254\321"
+	.ascii	"y 8\372@`\364\201\246\350\003!\365\201\276\364\201\\\350\377"
+	.ascii	"\340\351\377\304YrC\311\330\217\224\024:b7\037s\325\320\342 "
+	.ascii	",\3122-\007\336a\341\330H\320\251\322\003\n\022\254\001eR\226"
+	.ascii	"T\306p\327\315\032\202J\356c\257\355\204$\0326y\216\361\300_"
+	.ascii	"\177\022\217\273\304\302um\314\346\211\211\033\031\026\202\203"
+	.ascii	"`\"8\t.\202\201\340#x\b6\202\221`\244U\3421,v\354\003\377\340"
+	.ascii	"`\353.\031\302{\353 \203\034\3032zcG\230\270\335\3411l\003{\265"
+	.ascii	"ma\342\346\301T\023\203\203\306Q\266_\326\350\274`\213\316\377"
+	.ascii	"\234\351\377\024\321\377\301\241\377#\245\357\003G\037Y\243\363"
+	.ascii	"\210u\b\301\325`S\345\346\373\204\321\367Q\3038\260\350\2101"
+	.ascii	"\271\371>H}\303'\207\276\017\226\276\316\323_\266\321\277\263"
+	.ascii	"F\3475\026}\035E\377X\013\037\247\210)\203\272\031\037\217\263"
+	.ascii	"0\026W\232\236#7c\254\033\007\273\300g\307\021\242\334`\030\370"
+	.ascii	"\n\307\260J\214\205\253\216\255\360\013\254K\367\246\352\267"
+	.ascii	"d\260.\0348K\017?m\342\360\370\320\371\374\262F\347\323\030\321"
+	.ascii	"\330\005\246\272\003\020\323c\347f<u\276\035\227kn\276\366\322"
+	.ascii	"\3771\024~\272yw\017\216\302\333*\261\324\315#\205\245\256\235"
+	.ascii	"\213\007\237\035\265\226\2501\267N\317\031\344\323\23403IX\352"
+	.ascii	"\342\211Y^:vw\311\320\023\205\035\025W\006\211\245n\235\273\204"
+	.ascii	"\001g`]d{'\217\210\344\354\260\275\r\345\367\336\350\367\336"
+	.ascii	"\364"
+	.string	"{W\356\035\233\266\026\004\357\346\367\226\350{\367-\004$\246d\203\272\371=!\372\275.\375\036\225>\2335:\177\306\321\017c\215\316\273L\372\225\023"
+	.ascii	",^\266\334\334\213\323?\261\350\237f\372\277o\n \305\305\212"
+	.ascii	"\231\233\313\255!{\203\343f2W\316\226\261h,\034[.;\263$#g\343"
+	.ascii	"\254\333\220\317\336`f\220{'\257\234Us\003\275\375\237y\227\316"
+	.ascii	"\335%\b\241!\343\314\315>\266\350\264O\222~\356!\212\323bWDO"
+	.ascii	"v\263\305\246\r\2153\317\211\246Tw%\206\227\345\206\216@y\321"
+	.ascii	"\201\347q_hy\246\356"
+	.string	"\344\023lP\251\321\344N\315\217\2229F\356\3309\257t]\3511\246N>\203\0016(_\354`$/t5\2111\307\307\334\227\330U\2359#\331\003c\002\266u.k\330\245i\023\023\347<\322\204N\255\311\315I^p\340\370\346\224m\221\351\345\030+\373\346c\200G\203`\343\306\215\305\002\346\206\2119G-\315\222\233\217\201\234\006q\344ds\2629\321\270\240QV!\253\324\270\371\030t\321H^k\326\254\201\252\343\"\333\273\253\303P\230\222;d7\037\2036\rb\211\006\315\251fJ\331\326\235\215\223\004\317[\232\237j~\326\250)\302v\363\031\227\251\344\021\261\302a\223/\266\270\350\270\371\030\224i\r\304\2349s\302\201\260\333\305\232X\216\245\275Z\342%\f\\.c\261\334\332n>\006>4\022\225\027/g\231\013\314!\342rB\325\222\314\3172^o\332\b\271\371\fs\216\371\357\343\200;%[n>\305"
+	.string	"y4Is\3631\210q\276\201\371\357\023\004Fk\352\353\3742\204*\n\314\315\277\300\216\376\005r\032),K\226\223\313\321\027\206S\327\304L\266\273\323\246\345\366\223\3135\363\264\366\345\346s\213u\373\211!e\252L\351\204\356\030DyjY\306\201\222\324\202\351\364\266\340\300\270\270\371\027\204\321ITmm\347\2252I\312\266\356zU\226gaV~^9\325\216\334\350r\363Y%Sq\002\207\315X\233F\212B\205\312\271v\364\365$\307"
+	.ascii	"d\260\231\265\034d\326\334p\233&pFn\376\005Q4R\225\264\264\274"
+	.ascii	"\214\213Rw\267C\t\232\326\315\277 L#\2159;;\321,\332\31622s%"
+	.ascii	"\204\353\356J\\\2202'\232\317\221$aW7\337\002;\032\351\356\224"
+	.ascii	"rJ\271D\2520\024)0\026\304i\2445P\240\230uG_Ou\316\255+\037["
+	.ascii	"\275\037aWa7\337\002\244\006\001\345\311\223<W`_\356\316l"
+	.string	"i\321\272\371\026\300\320\037n$Ir:\261h;\313D\\\236\031\231P\217\033T\\'\331O'A7\254\244\350\271\371l\202\345\354A\223zcR&\346\211\234\233\317%N\306\304\334n~\005b\364\255\362T2DM)W&Ek 6\344C\316#\026mg\205\200\253\253#\003\022\243\241\354\202\374y\304E\235c\226\233ow\032\201R\213\2614R$\204\265\2679\\;\350\312\r\032<'\221|\205\227\310 Cu\363+X\2425h\023\"$/\315 \271\220\240]\271\371\025\214i\r\320N '\220K\304J\235\033&wu\362\344\342\334\374\n\2764\b.g\217\263\307\351\343\302\221\2725feVr;N\261\237>\204\354\324\340\242T\320\2455x\002\006v\211\034}a6\\\354\220!\35351\353\322&N'\035\371\372\302c\305\256\226@\301\242\223\204\350\320q\211\034Km\035y\310^ZW\031\255\233\037"
+	.string	"':)\354\364:\275.\221\243#OL\334\210\236@\221\231q\363\003 \2463HQ\372\231\225u\336\210@Wroi@F\033/\262\266%X\373\274q\332p\2015\203\311\315]ik_\220\340\335\374"
+	.ascii	"\334\320\307_2\342\2343\316\343]B\267<g\234ZX\270\304\331sw\326"
+	.ascii	"8\271N\032Vy\3168\267\216\3622\206\024::\237\203\036}\016u\372"
+	.ascii	"\034\226\372\034\350\3649\254\321\031\264(\375\224\262\312S\352"
+	.ascii	"\304\242P\266\334\3070\031\370\324\315\340\272\273\371?\261\316"
+	.ascii	"+\237#]\034\232\233a$\217\356\217<h@n>\207.\247\225\211wV\341"
+	.ascii	"$r\002az\316\027VyZ\235SRAv9\236p\344\374\237.~V\371\344\310"
+	.ascii	"\201&\352\346\223*\351\247\013<\247\265\205\306\315\346"
+	.string	"\231>\007&:\303\031\245\233w\267J\363\356\204\262\033Y\0015O\226\373\330\225\301\320\235,U\310\233\317\247%d\300\230\271\371\034\276\364\1773\317*\317m\342\271=\267\211g\356\261p]{k!`\213\2146^w{\357#\017An\254\234T\311\3717\365\334\334\363\233wn\235T\211;H\314n6\363$\335\324S\205Wv\363\217-:\317a\353oh\243\201l\321\371\rd\364\007d\235:yi)$\243\342t }\340\242\304\310\270\371\033\320\364\2073:t\342h1q;sPy\311\273\371\033\210\350\017n\313\245Yg\327\346\240Q\352\274,Y\242L97\353\342\244\310\315\335|;\353\366\337\3474\223\225\007\317\315\337\260\365\2078::s\315\242\355\254\013or\352\274\356\316\256847\352\364\207=o\336$\315\211R\007\264\305\362\346\3264\210\2546m\362\362\350\013\303A\342\206\t\031T\022\256'7\037"
+	.string	"M4\210/s\316\234\313\313#92\312\266~\210\2709!\352\346\003`\210\326\300K\311:\261\246\230U\232b\246\234O\325\336Z\006h\262%\207\274\333\307\256\f|\322lDy\021\344\246\334o\3720\177\230j\202t\223\260\255\343\315f\232(;w\330\334|"
+	.string	"\204\351[3(d\346\030\222+fN\240 \255\\\331\023\271'`\302\256p\231S\266u\247\304$\233\212\262\334{\317\231c\314(FL/f\027Si~1\321\230b\3142\346\t&\234y\306\334b\306\231d\3147\323\315\344b\2021\303\230f\254\322\034\363\233X\314,rI\244\230cL)f\262\356"
+	.string	"^\246\224m\335\355\235\326fZ\331\020U\265\241\300:x\211*\333\272K3\331<\240:\372P\251\tb\216\035\301r\260 \367NZ2ZL#CP\024\366\026{3\307\3141\346\020\323\bN*'\240\026\306\034c\242\231S<\240:\372\270\230\022\262<\313e\206\244(l)\2611$\225\337\316\231\3452N\314\2611&\022\313\261pl\033J\313\203\267\270\262\255\t\334\300a\247C\276\006:\355\263\255\321i\217\266\350\274\0065\3727\255\230U\236\314\3601\344\346M\344\263\005o\t\21576s\315\236\360e\215\312\244rs\215\003T\222\324\335l\252a9W`n:n\276].\263\244\307\230\222\233\257A\213\376\315)y\271\247Nm\313\315\327@E_\003\231N\232ee\215}\335|\rA\3645\330\320\327"
+	.string	"C?\203\035\375\fs\372\031\336\3643X\321\346\022\223\211U\036\231M\320D\305\360\272\371\031\322\364\t\266=:\237g\217\316gH\242\237\301\207~\206,\375\243=\372Gn\364o\026\271i\344\267s\246\220\233e\355Y\220487\233D\222n\026\331s\007\006\333\315Do\372I[t\336m\215N\023H\322\315 :/\217K\220\233\207l\321i],m\321\371\243-\372\0021\245\233a\267J3,\2739\200\227#u^@q\340\366\320\271\371Gg\272"
+	.string	"V\224n\232<\262\334\020\f9L\334\316!S\350\252n\376\321\020\315\341\210\322\315\035\267JsG\216\213"
+	.ascii	"\333\327\336j\200\224'\260\256\237%"
+	.string	"A\356v\334\374\243.-"
+	.string	".J7s\334*\315\034\371\204\bt\241\355\247\036\026d]]\006\366K\r\025\271\233\1774Cw\250S\272\211\303\304\221\317d)\264\375\364"
+	.ascii	"6.\276\334\355\335\225\201\217\334\2168t7\377("
+	.string	"K'\221\2316L\033\227\b^\035\334\016\273\0327\377(J\207\370R\312\300\232\\\246\f\263F.\243\237\216:K\324\233\345>\356\f\216\241\216>\2065Z\246\f-s\306\214\0200\266L\031[\n@\203\341\213>\206(&\226\231eb%\211af\305h3D\037\203\214*\363E\225\t\343\277\235U\232068\232V\346\013\323\n\017\211AJ\237\002:)\223J\n\217\322\224IeN\345\245~R\267\344\220da\364)xbn\023\312\334Ii\224\314'\023\312|:\332\201\242\200\210>\005]\372(\251\364\274g\317\024Z\035\327\220\r%J\314n\276\021\236>\036<yy\356m\223_Y\307\335u\354\260\201\035^\316\203\227\227\372io+d\034}#2:D\223\273\273&ui\372(J\351\271N\035\233\354\271@\342\206I\257\f\354\016\334\3157\332\2417h\243C'/\355\336{\203\331:\006i\020\005\272\032E"
+	.ascii	"\016A(\n\255\300!\bE*\b\025\200\301\337\317R\032D\201\016%\240"
+	.ascii	"BEO\254\251:T\224\372\320\025%\341\244\2120$\216\220\256\250"
+	.ascii	"1\210\256\220\200\223*\304\340\244\n)\240 \244BEO\244\305!b\021"
+	.ascii	"E\361#\004\256\252\004~\032\336\204\324\002UR\201@EoB\272\340"
+	.ascii	"CZ4\256h\232\242\347sR\205\037\234T!\260\370SQ\030M4\251\306"
+	.ascii	"\022N\252P\303\357\207\372\260 \301\311G%!\201\020~zoBZ\n\022"
+	.ascii	"\233\320\245 \221\002kP\204\205\364g\244\246+\272\232P\205E4"
+	.ascii	"(\242h}\023\322\207!Q($\376VX\325\267Bm\372i\262\252U\317\325"
+	.ascii	"B\272D\024\376\254oBr\002\026Wu)\r~ \002\213\304 \361g\252>5"
+	.ascii	"5R\213\304 qD\020\005\376R'UhD\206\f\274\t\251\351\267\242N*"
+	.ascii	"p\211H\305/m\032\301\242(\364&$\243\020\370a\025a\024\002+8\021"
+	.ascii	"\211!,\001K\f\201(\221\n\025]\177V\237~\023R1\r"
+	.string	"\032\227\322\246\237\232ZH\205\350\b\251\020\035A\205\212\236@aT\201~C\343\007>\277\241\361\003\025*\272\352\245\264\bT\323%\241\025]\325\241\026+\260H\004\026K,\021\251i\360\327bD\312$\"\025\002O\254j\272\242!\250P\321\265h\025\261\264\224\006\321!\023\320\304\252\242\301\241UD\272\262H\207Bg:\004\006\227\320t\211\202J,\221\032S\343\005T\250\350\032$4\232`\032\002W\020\205\024\260@\205\024R!\360\304/e!\201 \272\022W\013B\264\310D\\U \005T5\035\246+\032\254\240\366\210.\024\375~(&\026[0\345\0258\004AU\241\242'~)\200\202@ \251\030X\"\002\213i\211&\325\3504D\301D\032\\\032\242\024\2500\342\210XD\225\206\210ET\311\310(]2\256\3005(\"]\321\240\361\027DG\250P\321u\203\320\t\025*\272^x\023\0220\370\273\220.\021E"
+	.string	"\006\177= \020Hk\021uBjR\215%\234T\021T\250\350jA\004\2067!\245E\342\317\204t\004tEIl\200\004\025\b4\004\242\"\260 A\205\212\256\024\336\204\364\363\245B\340:4\026+P\231\320\340\007LC\240\260\210\002=\203\222\n\025]+\374\007,\246\303\224I\037\001\035h\320\201\007,z\367`\001 \026"
+	.string	"\342\274\007\013HJZ@\007I\372\035$\341u]\3215\230\222H\205\300\025\250\350\302\372&$b1\355"
+	.ascii	"\023*\354\251*\352$$\376\210\206\300\340/]\3621\241B\"&T\310"
+	.ascii	"\204\n\203V\037\023z\202\b\3541\241'V'c\261\230\256C`P\352[\002"
+	.ascii	"A\205\212\236H\361\373I}\253\352[S\025?\264\204\223*\004ZUb\t"
+	.ascii	"'UX\244\372\202\336\204\344\244\nW\325\227\302\210B=\227\206"
+	.ascii	"\250PH\034\321\244\032K\250j\372#\026K\374>pR\205\030\204\351"
+	.ascii	"\252\2660\241a]S\244K\276\025\203j\3645\375V`\211\245\241\210"
+	.ascii	"`\220X,\262PL\327TH4\032A\223/\205S\320\367\373\241?E\324\204"
+	.ascii	"\245\"\332\344\373\375\320\240u\365\245H\2272\274\t\311\004\264"
+	.ascii	"\005V\001"
+	.string	"\020\f\022\213\271\351\267\002\235L55\006\321\025\247\321\247\n\201\305\023\352\017(D\207-H\254ML\300`\n#\023\320\"&\026\323\016\374~ho\365\251\030H\205\300U\277\t\211E\361\003\213b\021\213\342\217\023*\374\025\315b\272\004\\A,:\371X\024+\f\211@U5\242P\207X\244A'#\211\024A\264\351'H\374\021Wb\321\211h\t\350\263\016\215\304\237/E\321\007tR},\212\030*\020W#\352[\032\002Q\370VT\365\t\215\305UE\352\244\002 (\r\242?\365g-\246+\206@\037PU\213@\277\342\022Ph\016\201B\255\342\2276\375X\240BM\244\216\b\022\235~E\f\251S\213\023\305t\r\002?0\032\001\005R\244 \256\306\021LC`\261HM\323\"SJ\"\r2\rE\b\321\021+\234RX\b\246\303!\332\364\363\2610\242>\026\250\220h)HlR\323b\323\211tEW"
+	.ascii	"\327\237\210t\211(B\021\210\036\r\201\277T5\372X\240B\037\213"
+	.ascii	"\"\320\233\220T\037\013t\b\024\256(\212\025\026\202\301\364g"
+	.ascii	"\302\212\242XAA0]\221\206\260\016S5-\226X\211#P\220\372R&t\r"
+	.ascii	"\022WXH}\027\322_\321H4QL\327T\204u\230\026\213\306\237\205\026"
+	.ascii	"+\360\207"
+	.string	":\241#Z\024\323uEQ\020\255\250R\006R\325(\244\256\3054(bD\252\032/\244L\350:L\177\305\264\004\323\0208,\242\032\030\022\201\253\223\320\250\016\211\277\r*PM\213\351\252\266hZQ\024+\206\206\3267!} \0021\264(\256\2510\r\246+\006\325gA\205\212\21204\246\bJ} \254Eb\t\n\212)0\005p\035\246K\300\037'U\250:1U`\221.\rAHW\264\270dDQ\370X\020Q\250\370\241A\024\024\250k\221\350\0044\202&_\272\242E\237\321\027D\201\305T5*\246\353\017-\242M?\337J$\242H\213\024\336\204\224\006\323\337\017\305@\365\375~\250\271\276\t\211\303\272\201%4%\201Xl\301TA\365Y8{K\350\205\341\007KhZ4\201\030T\177\212k\211\341\007\305tU\201L)\t\351\n,j\300\350$4Z}\036\254C\240\2617\374 ]\201E\023Z\244"
+	.string	"\026\323\025B\305\265\004\tF'\241\320\360\2035U\323boH\004\256h\321\310\004L1$\2160:\t)\254\300!\b+p\b\314\305\265\304oh\374`\tMI\370\375D\\P}+R\022\277\037\252\227\320\264\230\337\204\264A\365\001\235L,\001\255>\013\200\220\207\300\022C\365w\002\235T\274\372\322\037pEJB5\242"
+	.string	"R\215(\360\352\353 i\002I\276\337\017=W_\007I\353\020\3303\001%a\004\t\021g\021m\372\345t\2118bH\004\252\300\025i1(\365\r\231\200A\32474d\002\006E\374~\250^\337\204dt\022\376~\350\007\265\230\256"
+	.string	"\026\227.H}$\200\340"
+	.ascii	"D\007F'a\321\220\b\\\215A\242\232\026\177T\337\205\324g\302\350"
+	.ascii	"$\004:"
+	.ascii	"\327\240QMI\030\022\201\353/]S\022F'\241"
+	.string	"\205\025\351\022\016\242+\212\351:\004\201i\b\f:\tQ\023\277\037Z\324kZ\211D\241\211\337\017\365I\177C\013\254*\232\206\260\212XJWt\311\t\003\301\364\367\023\241\0023\274\t\211Xl\301\364A-\022\325a\252j8\321)-~X\211\304\342\007 \325G,\266`:W\337\006!\326!\320\250\357\301R\002P\020\n\340 E\272p\005(`\204\005\030\030a\002\372\207\244\252P\321\325\367K\361\341\227\342\303\020\210\n?\374\212\352\007\244\243T\b\\\235\210\304\020\326\224\251\210\256C)F\220\020A,\266`\322A\"Q\311g\376\357\371\310e\354\223\\\332\230\030\334\030\334\025T\217\263L\025#[8\302N.j>\316\322\334\034\002\213R/G\017\254\227\243\307\303\036\217u\035`!ib\346nw\315\350\320\343\321\3732\237\344\250S~\275\267\303\310\0256)/B]W\242\320z:2\026:\270\032t7_"
+	.ascii	"U\372\357y\235kV:\350\360p\234N\202\226X\241\315\271a\343\006"
+	.ascii	"\017\261\027]\357\331xZ\026 B\226"
+	.string	"7\367d$\275\327\325\200\261\036e\275\032=.\2736a.n\217\353UR`Jz4z3\232\234\365\240\272\2717\343\357\311\300_YLG\233\0357c[t\376\275-\255l\227\246\214\214^\326{Z\377]\366\216j\262\324\001\271\331\003kt^\250\244\367\262.\024\037UBb\230uio\356\350\351a\365\256\344|D1ss\357\352\312\216\0318\320\364`\364^\204\035\331\210\365^\374&\021<C*h\314[\034\236U\225O\353\210\232\233{Uw\227\2601\f\351!\002\343\214\013\2525T\310\264M\275G\365\237T8-(K\0315\0377[+I\357M\345\036u\262\220HE\001M\035\311L\365\240\336\213\372\315<\367\351\3143B\347\352\3463/\351=( \251\031U\212\364\236z\273\252N\225=\017\205\260\250#\3423rH\250\245(\212\304\230TH\321Li\2331\243\025@0PT&\222*\253\346;\023"
+	.string	"\204\rKU=\317\203N1B4\222$\251\024\366\030\003\346O++\222l\017\200"
+	.string	"\233\366u%M\236T\300\r\223#\202\373\f\037\354\351\321\013\025\261\301%\233\227\022'\303\006R`\314\345"
+	.ascii	"\206VJyWpP\263\276b\350qmE\021\364\325"
+	.string	"\231\323\320\347\325\231\307\b>\220\206\032\201Z*-n\377v\266aE%\243\374\204,\274\365\306\237!\366\033i\006\307\262?w\036\222H\261J`\303\021\270?\004\036\240.\304G\371V\241\022\024i&*\300\2068\2263Kw+2mP<\372k<R\352&b\031.\357\310\221\321lo\316(R\020[\347\2136#t\023\315\315a{\274h?\bB`d\344\373rI\331!.\220\004d\r\004G>\021\323k\321J)\022X\306\257\323\310\2502\221\246\036\205En\031a*{s\004\2023\236\353\253\240]8\360\274L\206\273I\2469\220\r\223|u\353\227\222\316\220\251V\257\251R\004\252l\227x\2028\330|\030\031]\232C\344:P\0024(\260H/\267i\206\355\020\277\276\247\357\305{\265\227X\013\354\206\302\312\3135}x\265\310\004\270\325)\234\366\341p\301\200\200\314l\253\260]I1\333\256H\251\363K"
+	.string	"G\351N"
+	.string	"\215\343O\233\231D\314+\212\223*\244o\262)\217y\016\r .R\337mP\264\315\263/!I6\263D!\345\306\344\221\325\334\276b\003\376@\035n\224\265T\303\330\216\n\032\254\331\306>\276\234>\006\245z\272l\351\t\326ui\252\252B\260\360g\375\003*\262w\216\312\202\003\304J\202Z\367dez\031\371\"\245\231;\265\334v="
+	.string	"\321\335\277b\210e\245\200\377F\375\3050\316V\\\232\320\262\031\334\202\b$%\347\272\230\205\213|g\3759\355\017\261yj\204\235\317\336\031\241\033\265\320\357Rz\207\242S\324\336\211l\311\233vf\241w\324\233N\036\225n\372\0351G\303\302b\344o'\231\257\330\003/\345\235!{D\f\247_\005\201\245Q\2270J\304\020f5\036t\362\006,x\252n\n\336w\372\357\312\307y>\035\211\314m\245\306c\336\324\270\324t\255\204\215K\376\030\251\342\031\344\200\2111\303n\365\002sFe\204?\262\205\362\331\225\370\367\200\346\026\321q\241\255.\362\233Va-\n\206\b/\236\2749\240\341I\244\0259<Y~)\017"
+	.string	"\217\203Qe6\2515\032\032P\225G\251\323\240\337\342\266h\334\351\360\244*\276E\361\200\363u\2534\271\240 \247\306\374\265w\3208\224\263uTGul\355\224<\366\017?\203\300\005\254a\034\360i\357\376Z\374\363e\206=\255\365\317\210\017\336\354S5>\253\365\240\b[\275}S\0160e\035"
+	.string	"\263hJ\244\375\024\365\355w,@k\027\360\021\206#\026\202x@kul\2200\002\026rf1\313\336\375\001\302\375\273\276(\272\363\325\200)&\247_8\365\243\364\277\027Q}q\270\037\214\226\307%\201\366\037\301\353\326ar\222\022\244r\246\255\311\276\263j\232\354\201\323\367~\265<\001o2\370z|\330\017\356K\034\254\326\316;\\(O\206\305*\277]\335'\005\241[\207\204\027\361f\232\224Q\300\033\323e\244\315&F\005LU\360zp"
+	.string	"\361\207\357v\264 \232\372\024X? R\372L\2203\231\313~\342a\353%F\331V\342)\217\252Z\320U\340E\364<\343\363\334\277\013\262\b3\256\307T\031\326I\022\315\336\223\364a\314\223\205\326\324\003\362D\365+Q\034@\"\310\001\363\325\260xF\354\325\343\360t\211\256\371\316\363\275\343\022D\322RS\335q\271\257(\277\306\036\031\364\277\376"
+	.string	"\372\206\301\253\031\345\261w\201v\223\b\006K\300!"
+	.string	"\206\210(\240)\307*\274(x\216\247\026\241\265\224-L\227\250\264\224^I<\236\263\242\265&\351\261i3\200\004O\273\224)l_h\035\036M\264-\266\027T$\036\274\212"
+	.ascii	"\332\\3\2609\b\221o\200\312\\\260.\344\216o&\275u\320\372\351"
+	.ascii	"\323ad\005\016=\374\321\312yt\235\356\341\251\332\217n\016~\370"
+	.ascii	"\361\357+W\250\027\372\3217z\213p\357\016`H\316z\372\246\333"
+	.ascii	"C\215\325S\372\200W\372\206\340\007'\345t\237|\003\207\240\352"
+	.ascii	"\244\260\254\343\341E\244\361\007M\336\177\\\373\340R\t\022\320"
+	.ascii	"\230\371\277(N\004i\372W\244\315\311\253t^\b\277Aq\022\b\b\320"
+	.ascii	"J;&\233V\f.\353i\361\207\241\r\365\017\204\314\346\\\234T\335"
+	.ascii	"\320\235\317~\"\200\326Vp\341rtj\270~sg\r\326\352\212\365\246"
+	.ascii	"\252\203,\232!\321\247c\226Y\270L{.\2674\307\253A\035\333\273"
+	.ascii	"o}\"!B\025\311\224\253\203\275\266\364M\375\2323\361\260*\204"
+	.ascii	"\006\201A\217\346\216\210\267j\333\205\331\315\244\355BX\307"
+	.ascii	"\372\237\217I)22\273\315\336H\224\003\365!\275\307\347\336\252"
+	.ascii	"\212\256=\327\223\373\\\211\344\254\316sp\331|[\312\3771\032"
+	.ascii	"\235\365|k\366|\227\265~2\217\374\236\003\216\030B&\276\374P"
+	.ascii	"U\f d~\241\210\214\254\304\007\274\221\3306\357s\241\274\310"
+	.ascii	"\252\336Y5\006\311z\2414\350\033\231\177\202V\346\375\370\n\257"
+	.ascii	"\264\r\300\017#\367\233b3\322I3\225\036\236\035\212a@\024\343"
+	.ascii	")\250O\242\214Y\274\342FR\312\213\022\271\260\320`\213\266t\304"
+	.ascii	"5e/K\367"
+	.string	"\357\332f\272\214e.\354\3551\266\262\233\f\\Hg\270\361y\370Q\261\177\020\333\377\201>\203\275\241\361:\337\366\224\272\367\210\017\236\3225\025h}\334\312\261\335\r=x\317\b@\036\016\246\365\332\247GC\374\336K\370\311&dE4\312WA\250\340\345LaK\225\2108\266\366s\005G)\214)\371\201\370+\321\371\036\356\245l\001*\236a\353ST\221\321Sn\241\300j\371@<\250\035\317\223\375\236\313\245\220\r\001\307\357k\343\023\372\262qrf\022\016|\316I\023'\316\352\314`\226\222\216\311!\271\035\215r\303\214yw\246\261\nv\377\341\364B.\177\306\362\316\312\252Vc\215\205\343\352\222]\260\001\354\366\372m'\3600=\210\311\230\250\204V\026\324\355x\363\212\030465wx\362=\356\243\202Kw<+"
+	.string	"vV\313\231$\254n\263\240\2073\002gr\201\250\177\360\334\257"
+	.string	"\027\212\307Q\374\223\303\026<\304]\")r\213mC>\f\321\f\241r-\213u\301\240\353\220\373\303\306%\336\372k\360 \252\007\317\234%s\233\203\220>\3705\302J}\362\334\2559\276"
+	.ascii	"\256v\026\250\255\303\275%\223n&'\007\317C\301\3148\201\227\322"
+	.ascii	"\304\032r+\273\023$\237 %\375t%rN95Q\003(\273p\007\261\200\025"
+	.ascii	"\356\301\343q`\0049Kb;\251\312\207\2660a\032\024\360h\346Y:\211"
+	.ascii	"u\005m4F\245\223i\021\263\t\263\313\2411 F\022\232\266`\254\237"
+	.ascii	"\312\212\017\273\037NqR\333\036\312C\2114%\232\220\247\331\223"
+	.ascii	"m\213\253A\222v\321\035f5D\302\036\304\200\"d\020\317h>\024\024"
+	.ascii	"lH\372;p\013Q\233\332\235\276\234k#\223\2654\326\223\027\366"
+	.ascii	"/{\354\002ClZ\347\352\371\360\031\013\201\2025 \340\357\377\335"
+	.ascii	"\315\274\3730 {\004\3117\224Ar\212X\212\271\324fm3<\2043I\333"
+	.ascii	"\025E\b\217k\257w\355(\036\361V\312V!Yu\240\214\344\321+\337"
+	.ascii	"\351EfqB\372\021\246\355\303\231@d\365\215\203\307\307{H>\205"
+	.ascii	"\323\3339 \232p;\321\232\375\361h\313DX\033\177;\263\033<\237"
+	.ascii	"\361`\027 -\351\240\232\276\300v{(8S\210\301\023\252|2Y\200\240"
+	.ascii	"\253\n\241?\377\266\326\nV@\033\"\353\230\337\237\2778\350\005"
+	.ascii	"\373\324xv\013\375\265h\222\263\353aJ\206~\020\3463f\360\250"
+	.ascii	"$W\364\320\323\2218\276~t\356\250s!%\260\237V\231\3726\271\341"
+	.ascii	"\373\341\203\326p\001.\227\022s\332\034J\211\365\336\230^\220"
+	.ascii	"#\n}\256\250\377\316i@\001_\247\247\342\270\030\321\234\r\260"
+	.ascii	"7\017\373\322\026\377`Y\206\223\301\237\322y^42\254,V$z\333d"
+	.ascii	"8\006m\025\355\210\032\353R\372\213\347lI\013\202\220\270U_N"
+	.ascii	"\361w\025\233G\331\033\004\241%8)\345py:L"
+	.string	"`bY\210\234FZ\305d\305\223\231b\266\242):\306\3747W\221\234U\376\351%\2750q\315\274\\\272*vP\034\333\r\211\375\n]k\031\017_\214\376\332\007b\254\035`\205\365\264t\245\2056!Rl\256\0311nu\027ET\177%D\206\255u\351\230\271\331\351\202\237$\243Cc\245\265\204G\021:{\213lLt\273\001\324_\245\001\326\352\335\215\275\201\337\"\225ma\226\377c:>\005\265RK\346\305t\230\353\215o\356\244G\032\372\f\310\325\033\027\321]\374`\315\226\372\277,\2161\rS\306\200G\330\372rY\274,\035\017y\256\226#\006\005\272\025I\243)X2td\002\235@.\b\212up\242\260\243\235\212\037\0330xa\261\322\303\371\341\310U/\207\020a\r\272\253]\222\032+p\017\372\300\220Z\235\305\2112\374\344\254\033\252\352\307\211\0139\321O\311r\202\240%\340\307\270\030\361\271T\236Q"
+	.string	"T\""
+	.string	"\f\320\364\300\177\337\215G\217Bp\316\2678KO\234\204\315\205\267\257\240"
+	.string	"\335\273\253\022\207\022"
+	.ascii	"f\222-\343;\n\370\342\005w\350!\352\027\217wA\302\003\364V\026"
+	.ascii	"\276\205J\352se\274\205\300^\326C\005\224b\342\225\257IXM\271"
+	.ascii	":\024\310\373\311=h\364\004^\003!\324\231\301Z\206\372\003\033"
+	.ascii	"\262*]\021tUu^\"46G\322\226\267sY\270M\272\340\264\356f[\003"
+	.ascii	"H\266\303\216\235\005\204\263E\b\370\301\270\255\244(\242\301"
+	.ascii	"U1JD \355\220\0060\004=\3449\257Q\247\377\256\360\036\260(\371"
+	.ascii	"\001\350(\251\200O\266tg\004\327hi\276\3157Q~'\226\343\245\221"
+	.ascii	"1\351\021\260k>$g\353\263J4\006\201\226\332\232\356wM_\355\374"
+	.ascii	"\263\\(5\236\2217c\307\024\271\020\024\210R\336mm \253\207\377"
+	.ascii	"\032@w\263\275hB}\220\n\266:>\256Z\003\214\206\001\305WW'3m\036"
+	.ascii	"\210\357\005\217\223\262\236#\335.\302\214\001\2237:\266P\362"
+	.ascii	"\263\262I\360^\246%32\335\217\005_p\033c\3777\336\371\357k\365"
+	.ascii	"/a\177b\335\200\237\233\371\233\201\033\320,\370\324\205sS?\032"
+	.ascii	"{\216\346<\275\311\370{\243\364\036\300\276\375\350q\376?}\242"
+	.ascii	"\367\240\337&\242\325\35073\362\237\234\337\207v\3468\021\245"
+	.ascii	"\341Xao\236\245\236]\3634\016\364d\"\217\341Z\314\375\305\244"
+	.ascii	"\376~\362\340L\366\201\362\344e\212P\352_y\237\273\371\327\257"
+	.ascii	"\204\360\201\264I\270W\217\267\330Q\374\264F\021\375\365\255"
+	.ascii	"\371\337\330\233y\221[0\373\236\376\264\222\276\320?-\302\031"
+	.ascii	"\217\253\213\364I\326\032h/9\367\233\355\367u\004\360\013.\004"
+	.ascii	"^{'K\277\371O\177V\363;\365\0138\234/\364\243f\277$8\206d\263"
+	.ascii	"\203\213\256o`\273\002"
+	.text
+	.section	.gnu.lto_.symtab.e0aebde21754a391,"e",@progbits
+	.string	"taskBatteryAlerts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\003"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"isRXDataNew"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"mspFcProcessPushCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"taskSystem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"dispatchProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"updateAltHoldState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"updateLEDs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"mspSerialPushSubscriptions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"mspSerialPushPeriod"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"dispatchIsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"taskMainPidLoopInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e0aebde21754a391,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,16734 @@
+	.file	"rc_adjustments.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/flight/pid.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/fc/controlrate_profile.h"
+	.file 10 "./src/main/fc/rc_controls.h"
+	.file 11 "./src/main/fc/rc_adjustments.h"
+	.file 12 "./src/main/rx/rx.h"
+	.file 13 "./src/main/fc/rc_adjustments.c"
+	.file 14 "/usr/include/string.h"
+	.file 15 "./src/main/io/beeper.h"
+	.file 16 "./src/main/fc/config.h"
+	.file 17 "./src/main/drivers/system.h"
+	.file 18 "./src/main/common/maths.h"
+	.file 19 "./src/main/fc/fc_rc.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rc_adjustments.c.63b1f953
+	.weak	rc_adjustments.c.63b1f953
+rc_adjustments.c.63b1f953:
+	.long	0xca9
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF2479
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2232
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2233
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2234
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2235
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2236
+	.uleb128 0x3
+	.long	.LASF2237
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2238
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2239
+	.uleb128 0x3
+	.long	.LASF2240
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2241
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2242
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2243
+	.uleb128 0x1e
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2244
+	.uleb128 0x3
+	.long	.LASF2245
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF2246
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x5
+	.long	0xab
+	.uleb128 0x3
+	.long	.LASF2247
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x5
+	.long	0xbc
+	.uleb128 0x3
+	.long	.LASF2248
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	0xcd
+	.uleb128 0x3
+	.long	.LASF2249
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x5
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF2250
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2251
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2252
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2253
+	.uleb128 0x5
+	.long	0x109
+	.uleb128 0x3
+	.long	.LASF2254
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xcd
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x14f
+	.uleb128 0x11
+	.long	.LASF2255
+	.value	0xfff
+	.uleb128 0x11
+	.long	.LASF2256
+	.value	0xf000
+	.uleb128 0x11
+	.long	.LASF2257
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2259
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2260
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xf
+	.long	0x15b
+	.uleb128 0x1f
+	.long	0x16b
+	.uleb128 0x8
+	.long	0x96
+	.uleb128 0x8
+	.long	0x7c
+	.byte	0
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x5
+	.byte	0x35
+	.byte	0x5
+	.long	0x18a
+	.uleb128 0x18
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x18
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x18a
+	.byte	0
+	.uleb128 0x7
+	.long	0x14f
+	.uleb128 0xa
+	.long	.LASF2279
+	.byte	0x20
+	.byte	0x5
+	.byte	0x30
+	.long	0x1dd
+	.uleb128 0x10
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x31
+	.byte	0xb
+	.long	0x115
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2261
+	.byte	0x5
+	.byte	0x32
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2262
+	.byte	0x5
+	.byte	0x33
+	.byte	0xe
+	.long	0x1dd
+	.byte	0x8
+	.uleb128 0x10
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x34
+	.byte	0xf
+	.long	0x1e2
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2263
+	.byte	0x5
+	.byte	0x38
+	.byte	0x7
+	.long	0x16b
+	.byte	0x18
+	.byte	0
+	.uleb128 0x7
+	.long	0xbc
+	.uleb128 0x7
+	.long	0x1dd
+	.uleb128 0x3
+	.long	.LASF2264
+	.byte	0x5
+	.byte	0x39
+	.byte	0x3
+	.long	0x18f
+	.uleb128 0x5
+	.long	0x1e7
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x6
+	.byte	0x1d
+	.long	0x216
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x7
+	.byte	0x23
+	.long	0x264
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2269
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2270
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2271
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2272
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0xa
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2280
+	.byte	0x4c
+	.byte	0x7
+	.byte	0x3c
+	.long	0x38c
+	.uleb128 0x10
+	.string	"P8"
+	.byte	0x7
+	.byte	0x3d
+	.byte	0xd
+	.long	0x38c
+	.byte	0
+	.uleb128 0x10
+	.string	"I8"
+	.byte	0x7
+	.byte	0x3e
+	.byte	0xd
+	.long	0x38c
+	.byte	0xa
+	.uleb128 0x10
+	.string	"D8"
+	.byte	0x7
+	.byte	0x3f
+	.byte	0xd
+	.long	0x38c
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2281
+	.byte	0x7
+	.byte	0x41
+	.byte	0xd
+	.long	0xbc
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2282
+	.byte	0x7
+	.byte	0x42
+	.byte	0xe
+	.long	0xcd
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2283
+	.byte	0x7
+	.byte	0x43
+	.byte	0xe
+	.long	0xcd
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2284
+	.byte	0x7
+	.byte	0x44
+	.byte	0xe
+	.long	0xcd
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2285
+	.byte	0x7
+	.byte	0x45
+	.byte	0xe
+	.long	0xcd
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2286
+	.byte	0x7
+	.byte	0x46
+	.byte	0xd
+	.long	0xbc
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2287
+	.byte	0x7
+	.byte	0x47
+	.byte	0xb
+	.long	0xfb
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2288
+	.byte	0x7
+	.byte	0x48
+	.byte	0xb
+	.long	0xfb
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2289
+	.byte	0x7
+	.byte	0x49
+	.byte	0xd
+	.long	0xbc
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2290
+	.byte	0x7
+	.byte	0x4a
+	.byte	0xd
+	.long	0xbc
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF2291
+	.byte	0x7
+	.byte	0x4b
+	.byte	0xd
+	.long	0xbc
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2292
+	.byte	0x7
+	.byte	0x4c
+	.byte	0xd
+	.long	0xbc
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF2293
+	.byte	0x7
+	.byte	0x4d
+	.byte	0xd
+	.long	0xbc
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2294
+	.byte	0x7
+	.byte	0x50
+	.byte	0xe
+	.long	0xcd
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2295
+	.byte	0x7
+	.byte	0x51
+	.byte	0xb
+	.long	0xfb
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2296
+	.byte	0x7
+	.byte	0x52
+	.byte	0xd
+	.long	0xbc
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2297
+	.byte	0x7
+	.byte	0x53
+	.byte	0xd
+	.long	0xbc
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF2298
+	.byte	0x7
+	.byte	0x54
+	.byte	0xb
+	.long	0xfb
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2299
+	.byte	0x7
+	.byte	0x55
+	.byte	0xb
+	.long	0xfb
+	.byte	0x48
+	.byte	0
+	.uleb128 0xb
+	.long	0xbc
+	.long	0x39c
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2300
+	.byte	0x7
+	.byte	0x56
+	.byte	0x3
+	.long	0x264
+	.uleb128 0x5
+	.long	0x39c
+	.uleb128 0xb
+	.long	0xbc
+	.long	0x3bd
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x8
+	.byte	0x14
+	.long	0x4e3
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2338
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0x2e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2348
+	.byte	0xe
+	.byte	0x9
+	.byte	0x1e
+	.long	0x572
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0x9
+	.byte	0x1f
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0x9
+	.byte	0x20
+	.byte	0xd
+	.long	0xbc
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2351
+	.byte	0x9
+	.byte	0x21
+	.byte	0xd
+	.long	0xbc
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2352
+	.byte	0x9
+	.byte	0x22
+	.byte	0xd
+	.long	0xbc
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2353
+	.byte	0x9
+	.byte	0x23
+	.byte	0xd
+	.long	0xbc
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2354
+	.byte	0x9
+	.byte	0x24
+	.byte	0xd
+	.long	0x3ad
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2355
+	.byte	0x9
+	.byte	0x25
+	.byte	0xd
+	.long	0xbc
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2356
+	.byte	0x9
+	.byte	0x26
+	.byte	0xd
+	.long	0xbc
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2357
+	.byte	0x9
+	.byte	0x27
+	.byte	0xe
+	.long	0xcd
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2358
+	.byte	0x9
+	.byte	0x28
+	.byte	0xd
+	.long	0xbc
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2359
+	.byte	0x9
+	.byte	0x29
+	.byte	0x3
+	.long	0x4e3
+	.uleb128 0x7
+	.long	0x572
+	.uleb128 0xa
+	.long	.LASF2360
+	.byte	0x2
+	.byte	0xa
+	.byte	0x88
+	.long	0x5aa
+	.uleb128 0x2
+	.long	.LASF2361
+	.byte	0xa
+	.byte	0x89
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2362
+	.byte	0xa
+	.byte	0x8a
+	.byte	0xd
+	.long	0xbc
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2363
+	.byte	0xa
+	.byte	0x8b
+	.byte	0x3
+	.long	0x583
+	.uleb128 0x5
+	.long	0x5aa
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xb
+	.byte	0x18
+	.long	0x663
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0x19
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2390
+	.byte	0xb
+	.byte	0x33
+	.byte	0x3
+	.long	0x5bb
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xb
+	.byte	0x36
+	.long	0x687
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x1
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2480
+	.byte	0x1
+	.byte	0xb
+	.byte	0x3b
+	.byte	0xf
+	.long	0x6a9
+	.uleb128 0x19
+	.long	.LASF2393
+	.byte	0x3c
+	.long	0xbc
+	.uleb128 0x19
+	.long	.LASF2394
+	.byte	0x3d
+	.long	0xbc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2395
+	.byte	0xb
+	.byte	0x3e
+	.byte	0x3
+	.long	0x687
+	.uleb128 0xa
+	.long	.LASF2396
+	.byte	0x3
+	.byte	0xb
+	.byte	0x40
+	.long	0x6e9
+	.uleb128 0x2
+	.long	.LASF2397
+	.byte	0xb
+	.byte	0x41
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2398
+	.byte	0xb
+	.byte	0x42
+	.byte	0xd
+	.long	0xbc
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2399
+	.byte	0xb
+	.byte	0x43
+	.byte	0x16
+	.long	0x6a9
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2400
+	.byte	0xb
+	.byte	0x44
+	.byte	0x3
+	.long	0x6b5
+	.uleb128 0x5
+	.long	0x6e9
+	.uleb128 0xa
+	.long	.LASF2401
+	.byte	0x6
+	.byte	0xb
+	.byte	0x46
+	.long	0x748
+	.uleb128 0x2
+	.long	.LASF2402
+	.byte	0xb
+	.byte	0x48
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2403
+	.byte	0xb
+	.byte	0x49
+	.byte	0x14
+	.long	0x5aa
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2397
+	.byte	0xb
+	.byte	0x4c
+	.byte	0xd
+	.long	0xbc
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2404
+	.byte	0xb
+	.byte	0x4d
+	.byte	0xd
+	.long	0xbc
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2405
+	.byte	0xb
+	.byte	0x50
+	.byte	0xd
+	.long	0xbc
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2406
+	.byte	0xb
+	.byte	0x51
+	.byte	0x3
+	.long	0x6fa
+	.uleb128 0x5
+	.long	0x748
+	.uleb128 0xa
+	.long	.LASF2407
+	.byte	0x18
+	.byte	0xb
+	.byte	0x55
+	.long	0x78d
+	.uleb128 0x2
+	.long	.LASF2402
+	.byte	0xb
+	.byte	0x56
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2408
+	.byte	0xb
+	.byte	0x57
+	.byte	0x1f
+	.long	0x78d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2409
+	.byte	0xb
+	.byte	0x58
+	.byte	0xe
+	.long	0xde
+	.byte	0x10
+	.byte	0
+	.uleb128 0x7
+	.long	0x6f5
+	.uleb128 0x3
+	.long	.LASF2410
+	.byte	0xb
+	.byte	0x59
+	.byte	0x3
+	.long	0x759
+	.uleb128 0xb
+	.long	0x748
+	.long	0x7ae
+	.uleb128 0xc
+	.long	0x37
+	.byte	0xe
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2411
+	.byte	0xb
+	.byte	0x62
+	.byte	0x1a
+	.long	0x79e
+	.uleb128 0xb
+	.long	0x9f
+	.long	0x7ca
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2412
+	.byte	0xc
+	.byte	0x50
+	.byte	0x10
+	.long	0x7ba
+	.uleb128 0xa
+	.long	.LASF2413
+	.byte	0x2c
+	.byte	0xc
+	.byte	0x76
+	.long	0x928
+	.uleb128 0x2
+	.long	.LASF2414
+	.byte	0xc
+	.byte	0x77
+	.byte	0xd
+	.long	0x928
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2415
+	.byte	0xc
+	.byte	0x78
+	.byte	0xd
+	.long	0xbc
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2416
+	.byte	0xc
+	.byte	0x79
+	.byte	0xd
+	.long	0xbc
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2417
+	.byte	0xc
+	.byte	0x7a
+	.byte	0xd
+	.long	0xbc
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2418
+	.byte	0xc
+	.byte	0x7b
+	.byte	0xd
+	.long	0xbc
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2419
+	.byte	0xc
+	.byte	0x7c
+	.byte	0xe
+	.long	0xde
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2420
+	.byte	0xc
+	.byte	0x7d
+	.byte	0xd
+	.long	0xbc
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2421
+	.byte	0xc
+	.byte	0x7e
+	.byte	0xd
+	.long	0xbc
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2422
+	.byte	0xc
+	.byte	0x7f
+	.byte	0xd
+	.long	0xbc
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2423
+	.byte	0xc
+	.byte	0x80
+	.byte	0xd
+	.long	0xbc
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2424
+	.byte	0xc
+	.byte	0x81
+	.byte	0xd
+	.long	0xbc
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2425
+	.byte	0xc
+	.byte	0x82
+	.byte	0xd
+	.long	0xbc
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2426
+	.byte	0xc
+	.byte	0x83
+	.byte	0xe
+	.long	0xcd
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2427
+	.byte	0xc
+	.byte	0x84
+	.byte	0xe
+	.long	0xcd
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2428
+	.byte	0xc
+	.byte	0x85
+	.byte	0xe
+	.long	0xcd
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2429
+	.byte	0xc
+	.byte	0x86
+	.byte	0xd
+	.long	0xbc
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2430
+	.byte	0xc
+	.byte	0x87
+	.byte	0xd
+	.long	0xbc
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF2431
+	.byte	0xc
+	.byte	0x88
+	.byte	0xd
+	.long	0xbc
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2432
+	.byte	0xc
+	.byte	0x89
+	.byte	0xd
+	.long	0xbc
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2433
+	.byte	0xc
+	.byte	0x8a
+	.byte	0xd
+	.long	0xbc
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2434
+	.byte	0xc
+	.byte	0x8b
+	.byte	0xd
+	.long	0xbc
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2435
+	.byte	0xc
+	.byte	0x8c
+	.byte	0xd
+	.long	0xbc
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2436
+	.byte	0xc
+	.byte	0x8d
+	.byte	0xe
+	.long	0xcd
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2437
+	.byte	0xc
+	.byte	0x8f
+	.byte	0xe
+	.long	0xcd
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2438
+	.byte	0xc
+	.byte	0x90
+	.byte	0xe
+	.long	0xcd
+	.byte	0x28
+	.byte	0
+	.uleb128 0xb
+	.long	0xbc
+	.long	0x938
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2439
+	.byte	0xc
+	.byte	0x91
+	.byte	0x3
+	.long	0x7d6
+	.uleb128 0x5
+	.long	0x938
+	.uleb128 0x12
+	.long	.LASF2440
+	.byte	0xc
+	.byte	0x93
+	.byte	0x13
+	.long	0x938
+	.uleb128 0x22
+	.long	0x7ae
+	.byte	0xd
+	.byte	0x35
+	.byte	0x13
+	.uleb128 0x12
+	.long	.LASF2441
+	.byte	0xd
+	.byte	0x35
+	.byte	0x4f
+	.long	0x1f3
+	.uleb128 0x23
+	.long	0x95d
+	.byte	0x7d
+	.uleb128 0xf
+	.long	.LASF2442
+	.byte	0x37
+	.byte	0x16
+	.long	0x97a
+	.uleb128 0x7
+	.long	0x39c
+	.uleb128 0xf
+	.long	.LASF2443
+	.byte	0x5b
+	.byte	0x10
+	.long	0xbc
+	.uleb128 0xb
+	.long	0x6f5
+	.long	0x99a
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x17
+	.byte	0
+	.uleb128 0x5
+	.long	0x98a
+	.uleb128 0xf
+	.long	.LASF2444
+	.byte	0x63
+	.byte	0x21
+	.long	0x99a
+	.uleb128 0xb
+	.long	0x792
+	.long	0x9ba
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2445
+	.byte	0xca
+	.byte	0x1a
+	.long	0x9aa
+	.uleb128 0x1a
+	.long	.LASF2446
+	.byte	0xa
+	.byte	0xbe
+	.byte	0x5
+	.long	0x109
+	.long	0x9e0
+	.uleb128 0x8
+	.long	0xbc
+	.uleb128 0x8
+	.long	0x9e0
+	.byte	0
+	.uleb128 0x7
+	.long	0x5b6
+	.uleb128 0x1a
+	.long	.LASF2447
+	.byte	0xe
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0xa05
+	.uleb128 0x8
+	.long	0x96
+	.uleb128 0x8
+	.long	0x7c
+	.uleb128 0x8
+	.long	0xef
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2448
+	.byte	0x9
+	.byte	0x31
+	.long	0xa16
+	.uleb128 0x8
+	.long	0xbc
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2451
+	.byte	0x10
+	.byte	0x71
+	.byte	0x9
+	.long	0xbc
+	.uleb128 0x24
+	.long	.LASF2481
+	.byte	0x13
+	.byte	0x1b
+	.byte	0x6
+	.uleb128 0x14
+	.long	.LASF2449
+	.byte	0xf
+	.byte	0x3e
+	.long	0xa3b
+	.uleb128 0x8
+	.long	0xbc
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2450
+	.byte	0x7
+	.byte	0x75
+	.long	0xa4c
+	.uleb128 0x8
+	.long	0xa4c
+	.byte	0
+	.uleb128 0x7
+	.long	0x3a8
+	.uleb128 0x15
+	.long	.LASF2452
+	.byte	0xc
+	.byte	0xa8
+	.byte	0x5
+	.long	0x109
+	.uleb128 0x15
+	.long	.LASF2453
+	.byte	0x11
+	.byte	0x1d
+	.byte	0xa
+	.long	0xde
+	.uleb128 0x16
+	.long	.LASF2454
+	.value	0x1c4
+	.long	0xa81
+	.uleb128 0x13
+	.long	.LASF2460
+	.value	0x1c4
+	.byte	0x28
+	.long	0x97a
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2455
+	.value	0x1b9
+	.long	0xab7
+	.uleb128 0xd
+	.uleb128 0x4
+	.long	.LASF2456
+	.value	0x1bb
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xd
+	.uleb128 0x4
+	.long	.LASF2457
+	.value	0x1bc
+	.byte	0x29
+	.long	0xabc
+	.uleb128 0xd
+	.uleb128 0x4
+	.long	.LASF2458
+	.value	0x1be
+	.byte	0x27
+	.long	0x78d
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x754
+	.uleb128 0x5
+	.long	0xab7
+	.uleb128 0x25
+	.long	.LASF2482
+	.byte	0xd
+	.value	0x1b4
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF2459
+	.value	0x17a
+	.long	0xb73
+	.uleb128 0x13
+	.long	.LASF2461
+	.value	0x17a
+	.byte	0x30
+	.long	0x57e
+	.uleb128 0x26
+	.string	"now"
+	.byte	0xd
+	.value	0x17c
+	.byte	0x14
+	.long	0xea
+	.uleb128 0x4
+	.long	.LASF2462
+	.value	0x17e
+	.byte	0xf
+	.long	0x110
+	.uleb128 0xd
+	.uleb128 0x4
+	.long	.LASF2405
+	.value	0x180
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xd
+	.uleb128 0x4
+	.long	.LASF2463
+	.value	0x181
+	.byte	0x1c
+	.long	0xb73
+	.uleb128 0x4
+	.long	.LASF2397
+	.value	0x186
+	.byte	0x17
+	.long	0xc8
+	.uleb128 0x4
+	.long	.LASF2464
+	.value	0x18b
+	.byte	0x17
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF2465
+	.value	0x18c
+	.byte	0x13
+	.long	0x110
+	.uleb128 0x4
+	.long	.LASF2466
+	.value	0x197
+	.byte	0x17
+	.long	0xc8
+	.uleb128 0x27
+	.long	0xb56
+	.uleb128 0x4
+	.long	.LASF2467
+	.value	0x19a
+	.byte	0x11
+	.long	0x7c
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.long	.LASF2468
+	.value	0x1ac
+	.byte	0x1c
+	.long	0xd9
+	.uleb128 0x4
+	.long	.LASF2469
+	.value	0x1ad
+	.byte	0x1b
+	.long	0xc8
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0x792
+	.uleb128 0x28
+	.long	.LASF2472
+	.byte	0xd
+	.value	0x158
+	.byte	0xd
+	.long	0xbb8
+	.uleb128 0x13
+	.long	.LASF2397
+	.value	0x158
+	.byte	0x2b
+	.long	0xbc
+	.uleb128 0x13
+	.long	.LASF2469
+	.value	0x158
+	.byte	0x47
+	.long	0xbc
+	.uleb128 0x4
+	.long	.LASF2470
+	.value	0x15a
+	.byte	0xd
+	.long	0xbc
+	.uleb128 0xd
+	.uleb128 0x4
+	.long	.LASF2471
+	.value	0x168
+	.byte	0x15
+	.long	0xbc
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2473
+	.byte	0xdb
+	.long	0xbf2
+	.uleb128 0x9
+	.long	.LASF2461
+	.byte	0xd
+	.byte	0xdb
+	.byte	0x36
+	.long	0x57e
+	.uleb128 0x9
+	.long	.LASF2397
+	.byte	0xd
+	.byte	0xdb
+	.byte	0x51
+	.long	0xbc
+	.uleb128 0x9
+	.long	.LASF2467
+	.byte	0xd
+	.byte	0xdb
+	.byte	0x69
+	.long	0x7c
+	.uleb128 0xf
+	.long	.LASF2471
+	.byte	0xdf
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2474
+	.byte	0xcc
+	.long	0xc2c
+	.uleb128 0x9
+	.long	.LASF2456
+	.byte	0xd
+	.byte	0xcc
+	.byte	0x29
+	.long	0xbc
+	.uleb128 0x9
+	.long	.LASF2404
+	.byte	0xd
+	.byte	0xcc
+	.byte	0x38
+	.long	0xbc
+	.uleb128 0x9
+	.long	.LASF2458
+	.byte	0xd
+	.byte	0xcc
+	.byte	0x69
+	.long	0x78d
+	.uleb128 0xf
+	.long	.LASF2463
+	.byte	0xce
+	.byte	0x18
+	.long	0xb73
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2475
+	.byte	0x39
+	.long	0xc4f
+	.uleb128 0x9
+	.long	.LASF2397
+	.byte	0xd
+	.byte	0x39
+	.byte	0x45
+	.long	0x663
+	.uleb128 0x9
+	.long	.LASF2471
+	.byte	0xd
+	.byte	0x39
+	.byte	0x61
+	.long	0xab
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2483
+	.byte	0xc
+	.byte	0x93
+	.byte	0x44
+	.long	0xc5b
+	.uleb128 0x7
+	.long	0x944
+	.uleb128 0x2a
+	.long	.LASF2484
+	.byte	0xb
+	.byte	0x62
+	.byte	0x63
+	.long	0xab7
+	.long	0xc7d
+	.uleb128 0x9
+	.long	.LASF2476
+	.byte	0xb
+	.byte	0x62
+	.byte	0x78
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2477
+	.byte	0x12
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x1b
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x1b
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0x9
+	.long	.LASF2478
+	.byte	0x12
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 20 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.file 23 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 25 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 26 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 29 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 38 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 39 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1181
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1221
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x2f
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 51 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x33
+	.file 52 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 53 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x35
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 54 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x36
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0x4
+	.file 55 "./src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x37
+	.file 56 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1608
+	.byte	0x4
+	.file 57 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1609
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.file 58 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 59 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x4
+	.file 60 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 61 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xf
+	.byte	0x4
+	.file 62 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x10
+	.file 63 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3f
+	.file 64 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x4
+	.file 65 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x41
+	.byte	0x4
+	.file 66 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 67 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x43
+	.byte	0x4
+	.file 68 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x44
+	.file 69 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x45
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.file 70 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.file 71 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2164
+	.byte	0x4
+	.file 72 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 73 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2168
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2169
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF2231
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1143
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1147
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1159
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1171
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1173
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1290
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1293
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1299
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1303
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1308
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1335
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1496
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1509
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1526
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1527
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1530
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1457
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1567
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1575
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1580
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1583
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1585
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1639
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1643
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1677
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1759
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1769
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1771
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1773
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1775
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1783
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1795
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2163
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2167
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2195
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.83.ab548d0b7b32a9305f216da5287d33d8,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2198
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2226
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF2485
+	.long	.LASF2486
+	.long	.LASF2487
+	.long	.LASF2488
+	.long	.LASF2489
+	.long	.LASF2490
+	.long	.LASF2491
+	.long	.LASF2492
+	.long	.LASF2493
+	.long	.LASF2494
+	.long	.LASF2495
+	.long	.LASF2496
+	.long	.LASF2497
+	.long	.LASF2498
+	.long	.LASF2499
+	.long	.LASF2500
+	.long	.LASF2501
+	.long	.LASF2502
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4a
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2503
+	.byte	0xe
+	.long	.LASF2504
+	.byte	0xe
+	.long	.LASF2505
+	.byte	0xe
+	.long	.LASF2506
+	.byte	0x12
+	.long	.LASF2507
+	.byte	0x4
+	.long	.LASF2508
+	.byte	0x3
+	.long	.LASF2509
+	.byte	0x7
+	.long	.LASF2510
+	.byte	0x5
+	.long	.LASF2511
+	.byte	0x6
+	.long	.LASF2512
+	.byte	0x6
+	.long	.LASF2513
+	.byte	0x6
+	.long	.LASF2514
+	.byte	0x9
+	.long	.LASF2515
+	.byte	0x6
+	.long	.LASF2516
+	.byte	0x11
+	.long	.LASF2517
+	.byte	0x8
+	.long	.LASF2518
+	.byte	0x6
+	.long	.LASF2519
+	.byte	0x5
+	.long	.LASF2520
+	.byte	0x3
+	.long	.LASF2521
+	.byte	0x6
+	.long	.LASF2522
+	.byte	0x11
+	.long	.LASF2523
+	.byte	0x12
+	.long	.LASF2524
+	.byte	0x12
+	.long	.LASF2524
+	.byte	0x11
+	.long	.LASF2525
+	.byte	0xe
+	.long	.LASF2526
+	.byte	0x11
+	.long	.LASF2527
+	.byte	0x11
+	.long	.LASF2528
+	.byte	0xe
+	.long	.LASF2529
+	.byte	0xe
+	.long	.LASF2530
+	.byte	0x10
+	.long	.LASF2531
+	.byte	0xe
+	.long	.LASF2532
+	.byte	0xf
+	.long	.LASF2533
+	.byte	0xf
+	.long	.LASF2534
+	.byte	0xe
+	.long	.LASF2535
+	.byte	0xe
+	.long	.LASF2536
+	.byte	0xe
+	.long	.LASF2537
+	.byte	0xd
+	.long	.LASF2538
+	.byte	0xd
+	.long	.LASF2539
+	.byte	0x11
+	.long	.LASF2540
+	.byte	0x11
+	.long	.LASF2541
+	.byte	0xe
+	.long	.LASF2542
+	.byte	0xe
+	.long	.LASF2543
+	.byte	0xe
+	.long	.LASF2544
+	.byte	0xe
+	.long	.LASF2545
+	.byte	0xe
+	.long	.LASF2546
+	.byte	0xe
+	.long	.LASF2547
+	.byte	0xe
+	.long	.LASF2548
+	.byte	0xe
+	.long	.LASF2549
+	.byte	0xe
+	.long	.LASF2550
+	.byte	0xe
+	.long	.LASF2551
+	.byte	0xe
+	.long	.LASF2552
+	.byte	0xc
+	.long	.LASF2553
+	.byte	0xb
+	.long	.LASF2554
+	.byte	0xa
+	.long	.LASF2555
+	.byte	0xb
+	.long	.LASF2556
+	.byte	0x1
+	.long	.LASF2557
+	.byte	0x1
+	.long	.LASF2558
+	.byte	0x3
+	.long	.LASF2559
+	.byte	0x2
+	.long	.LASF2560
+	.byte	0x3
+	.long	.LASF2561
+	.byte	0x4
+	.long	.LASF2562
+	.byte	0x4
+	.long	.LASF2563
+	.byte	0x8
+	.long	.LASF2564
+	.byte	0x5
+	.long	.LASF2565
+	.byte	0x5
+	.long	.LASF2566
+	.byte	0x5
+	.long	.LASF2567
+	.byte	0x5
+	.long	.LASF2568
+	.byte	0x5
+	.long	.LASF2569
+	.byte	0x5
+	.long	.LASF2570
+	.byte	0x5
+	.long	.LASF2571
+	.byte	0x5
+	.long	.LASF2572
+	.byte	0x5
+	.long	.LASF2573
+	.byte	0x5
+	.long	.LASF2574
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1919:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2155:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1993:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1155:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2176:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF2188:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1791:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF826:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1239:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2407:
+	.string	"adjustmentState_s"
+.LASF2410:
+	.string	"adjustmentState_t"
+.LASF1151:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1484:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1334:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF2430:
+	.string	"rcInterpolationChannels"
+.LASF2340:
+	.string	"OWNER_RX_BIND"
+.LASF2269:
+	.string	"PIDPITCH"
+.LASF1520:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1491:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1603:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF935:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1232:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF1358:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2009:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1937:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1485:
+	.string	"TELEMETRY_MAVLINK "
+.LASF2382:
+	.string	"ADJUSTMENT_ROLL_P"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1556:
+	.string	"USE_PPM"
+.LASF1896:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF2159:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1464:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1953:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1800:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF2058:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF999:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF979:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF836:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1434:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1609:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1617:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF939:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1797:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1402:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF879:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2237:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1124:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1099:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1409:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF2253:
+	.string	"_Bool"
+.LASF2411:
+	.string	"adjustmentRanges_SystemArray"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2482:
+	.string	"resetAdjustmentStates"
+.LASF794:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1536:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1776:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1234:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1486:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2309:
+	.string	"OWNER_ADC_CURR"
+.LASF931:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1634:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1738:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1809:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2011:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2119:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2268:
+	.string	"PIDROLL"
+.LASF2191:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1339:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1623:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1408:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF1018:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1513:
+	.string	"_WCHAR_T "
+.LASF1798:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF2224:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2082:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2233:
+	.string	"short unsigned int"
+.LASF2440:
+	.string	"rxConfig_System"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF840:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1512:
+	.string	"__WCHAR_T__ "
+.LASF1880:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2425:
+	.string	"rssi_invert"
+.LASF1597:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2151:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1723:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1006:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF811:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1371:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF2275:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2123:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2098:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1208:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1679:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2393:
+	.string	"step"
+.LASF799:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1822:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2127:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2100:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1306:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF824:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF2248:
+	.string	"uint16_t"
+.LASF1851:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2161:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1117:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1700:
+	.string	"PG_RX_CONFIG 24"
+.LASF1160:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2090:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1981:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF2390:
+	.string	"adjustmentFunction_e"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2069:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1475:
+	.string	"TELEMETRY_HOTT "
+.LASF818:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF957:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1126:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1629:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1325:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF793:
+	.string	"_MATH_H 1"
+.LASF1600:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1858:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1308:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1784:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1501:
+	.string	"_T_PTRDIFF_ "
+.LASF2096:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1863:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1719:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF807:
+	.string	"__DECL_SIMD_sinl "
+.LASF1971:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF2033:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1711:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF809:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1611:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1683:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1348:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF2164:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1351:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF2092:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2230:
+	.string	"ADJUSTMENT_FUNCTION_CONFIG_INDEX_OFFSET 1"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1696:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1924:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1055:
+	.string	"__DECL_SIMD_tan "
+.LASF1673:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1390:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1412:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2359:
+	.string	"controlRateConfig_t"
+.LASF828:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1994:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2202:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1810:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2378:
+	.string	"ADJUSTMENT_ROLL_RATE"
+.LASF1832:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF1703:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1383:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF2114:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1651:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2221:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2277:
+	.string	"PIDVEL"
+.LASF1198:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1974:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1441:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1414:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF1922:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF884:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2122:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1706:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1288:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1853:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF827:
+	.string	"__DECL_SIMD_logl "
+.LASF1395:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF2313:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2333:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1333:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF816:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1172:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1158:
+	.string	"__DECL_SIMD_tanh"
+.LASF2089:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1064:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1818:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2169:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1783:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1423:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1670:
+	.string	"BIT(x) (1 << (x))"
+.LASF2338:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1772:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1763:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1575:
+	.string	"TELEMETRY_IBUS"
+.LASF2394:
+	.string	"switchPositions"
+.LASF835:
+	.string	"__DECL_SIMD_exp "
+.LASF1826:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1586:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1045:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1170:
+	.string	"__DECL_SIMD_tan"
+.LASF910:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF927:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1249:
+	.string	"_Mdouble_"
+.LASF2246:
+	.string	"int32_t"
+.LASF1393:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1176:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2193:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1405:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF1106:
+	.string	"__DECL_SIMD_exp2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1387:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF2101:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1647:
+	.string	"FAST_MATH "
+.LASF1542:
+	.string	"BARO "
+.LASF1323:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2363:
+	.string	"channelRange_t"
+.LASF1415:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1146:
+	.string	"__DECL_SIMD_atanh"
+.LASF1019:
+	.string	"__DECL_SIMD_erff32 "
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1846:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2136:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1522:
+	.string	"___int_wchar_t_h "
+.LASF2126:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF837:
+	.string	"__DECL_SIMD_expl "
+.LASF2072:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1665:
+	.string	"STR_HELPER(x) #x"
+.LASF1532:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1893:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1184:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1097:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1581:
+	.string	"VTX_TRAMP"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2335:
+	.string	"OWNER_BARO_EXTI"
+.LASF1090:
+	.string	"__DECL_SIMD_acos"
+.LASF1084:
+	.string	"__DECL_SIMD_expf"
+.LASF546:
+	.string	"__always_inline"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1020:
+	.string	"__DECL_SIMD_erff64 "
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1227:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2449:
+	.string	"beeperConfirmationBeeps"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1903:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2312:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1716:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1250:
+	.string	"__MATH_PRECNAME"
+.LASF970:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1337:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1134:
+	.string	"__DECL_SIMD_log10"
+.LASF2257:
+	.string	"PGR_SIZE_MASK"
+.LASF2403:
+	.string	"range"
+.LASF1260:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1909:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1118:
+	.string	"__DECL_SIMD_expm1"
+.LASF1310:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF902:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1917:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1103:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1253:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2088:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1761:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1381:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1220:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1578:
+	.string	"VTX_COMMON"
+.LASF1070:
+	.string	"__DECL_SIMD_sin"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1237:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1488:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1420:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1889:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF2066:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1243:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF2353:
+	.string	"thrExpo8"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2012:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF812:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1007:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1314:
+	.string	"__MATHCALL_NARROW"
+.LASF1894:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1866:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF863:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1487:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1291:
+	.string	"_Mret_ _Float32"
+.LASF2203:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1767:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF1235:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1142:
+	.string	"__DECL_SIMD_log1p"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1271:
+	.string	"__MATHDECL_1"
+.LASF1143:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF895:
+	.string	"__DECL_SIMD_exp2 "
+.LASF2276:
+	.string	"PIDMAG"
+.LASF1127:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2336:
+	.string	"OWNER_USB"
+.LASF2456:
+	.string	"index"
+.LASF1110:
+	.string	"__DECL_SIMD_exp10"
+.LASF1747:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF2347:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2065:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1969:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1186:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2196:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1454:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF959:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2448:
+	.string	"changeControlRateProfile"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1666:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1633:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2287:
+	.string	"pidSumLimit"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f"
+.LASF988:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2423:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2452:
+	.string	"rxIsReceivingSignal"
+.LASF913:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2034:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1691:
+	.string	"PG_PID_PROFILE 14"
+.LASF2282:
+	.string	"dterm_lpf_hz"
+.LASF1280:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1245:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1841:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2271:
+	.string	"PIDALT"
+.LASF1929:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1024:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2158:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1178:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2317:
+	.string	"OWNER_SONAR_ECHO"
+.LASF2454:
+	.string	"useAdjustmentConfig"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1364:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF1945:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1389:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2215:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2435:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1708:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1751:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1108:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2455:
+	.string	"updateAdjustmentStates"
+.LASF1398:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF2305:
+	.string	"OWNER_SERVO"
+.LASF2189:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1672:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1392:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF1069:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2375:
+	.string	"ADJUSTMENT_YAW_D"
+.LASF2273:
+	.string	"PIDPOSR"
+.LASF2374:
+	.string	"ADJUSTMENT_YAW_I"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2385:
+	.string	"ADJUSTMENT_RC_RATE_YAW"
+.LASF1483:
+	.string	"TELEMETRY_IBUS "
+.LASF1462:
+	.string	"USE_PWM "
+.LASF2373:
+	.string	"ADJUSTMENT_YAW_P"
+.LASF920:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF996:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1163:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1816:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1901:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1995:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1435:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF2416:
+	.string	"sbus_inversion"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1850:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF854:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1715:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF2143:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1819:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1304:
+	.string	"_Mret_ _Float64"
+.LASF2005:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2053:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2046:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1627:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1431:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF1507:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2426:
+	.string	"midrc"
+.LASF1824:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1426:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1891:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2199:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2238:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2285:
+	.string	"dterm_notch_cutoff"
+.LASF2206:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF2240:
+	.string	"__uint16_t"
+.LASF1201:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2184:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2304:
+	.string	"OWNER_MOTOR"
+.LASF921:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1908:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF888:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1596:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1655:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF2332:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1523:
+	.string	"__INT_WCHAR_T_H "
+.LASF966:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF864:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1941:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF891:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2013:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1344:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1796:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1892:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF860:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1305:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF1492:
+	.string	"USE_SENSOR_NAMES "
+.LASF1724:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF2418:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1829:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF922:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1128:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1827:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1774:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF2118:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2358:
+	.string	"ratesType"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1852:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1645:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF823:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1135:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1328:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2216:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF2077:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1298:
+	.string	"_Marg_ _Float128"
+.LASF1197:
+	.string	"__f32x(x) x ##f32x"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF2306:
+	.string	"OWNER_LED"
+.LASF1231:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2441:
+	.string	"adjustmentRanges_Registry"
+.LASF1944:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1664:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF2372:
+	.string	"ADJUSTMENT_PITCH_ROLL_D"
+.LASF1752:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1861:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1951:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF2232:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1301:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1817:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1283:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF983:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2417:
+	.string	"halfDuplex"
+.LASF1758:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1771:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1508:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2401:
+	.string	"adjustmentRange_s"
+.LASF2406:
+	.string	"adjustmentRange_t"
+.LASF1079:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF2356:
+	.string	"rcYawExpo8"
+.LASF2078:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2138:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1709:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2024:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF2419:
+	.string	"rx_spi_id"
+.LASF1692:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1210:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF2179:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2251:
+	.string	"float"
+.LASF1421:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1687:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1625:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2115:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2097:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2434:
+	.string	"fpvCamAngleDegrees"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1913:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2091:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1273:
+	.string	"__MATHDECL"
+.LASF2292:
+	.string	"levelAngleLimit"
+.LASF2427:
+	.string	"mincheck"
+.LASF1489:
+	.string	"USE_MSP_PUSH "
+.LASF1017:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1557:
+	.string	"USE_PWM"
+.LASF1382:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF878:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1500:
+	.string	"_PTRDIFF_T "
+.LASF2446:
+	.string	"isRangeActive"
+.LASF2279:
+	.string	"pgRegistry_s"
+.LASF2264:
+	.string	"pgRegistry_t"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1067:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2467:
+	.string	"delta"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF911:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF2475:
+	.string	"blackboxLogInflightAdjustmentEvent"
+.LASF1833:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1933:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1145:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF974:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF2397:
+	.string	"adjustmentFunction"
+.LASF2080:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1641:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF943:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1870:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1479:
+	.string	"USE_SERVOS "
+.LASF1380:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF2259:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2131:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2344:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1472:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2068:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1096:
+	.string	"__DECL_SIMD_atanf"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF868:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1329:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1931:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1694:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2478:
+	.string	"high"
+.LASF1257:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1307:
+	.string	"_Mret_ _Float64x"
+.LASF2386:
+	.string	"ADJUSTMENT_D_SETPOINT"
+.LASF1322:
+	.string	"FP_NORMAL 4"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1519:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1936:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1543:
+	.string	"USE_FAKE_BARO "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2004:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2007:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1794:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF1406:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF2326:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF2121:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1372:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2464:
+	.string	"signedDiff"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF916:
+	.string	"__DECL_SIMD_coshf "
+.LASF1212:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1910:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF997:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1986:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF382:
+	.string	"unix 1"
+.LASF1425:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2461:
+	.string	"controlRateConfig"
+.LASF2364:
+	.string	"ADJUSTMENT_NONE"
+.LASF1857:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1820:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF894:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2047:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1267:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1872:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1939:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2255:
+	.string	"PGR_PGN_MASK"
+.LASF1958:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2020:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1404:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF1187:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1244:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1247:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2357:
+	.string	"tpa_breakpoint"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2015:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1530:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2141:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2070:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1714:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF804:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1459:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF967:
+	.string	"__DECL_SIMD_log10l "
+.LASF1094:
+	.string	"__DECL_SIMD_atan"
+.LASF402:
+	.string	"false 0"
+.LASF1449:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2153:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1370:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF2445:
+	.string	"adjustmentStates"
+.LASF1749:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF844:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2174:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1168:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1592:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF2112:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2270:
+	.string	"PIDYAW"
+.LASF1898:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2008:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1189:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF795:
+	.string	"__DECL_SIMD_cos "
+.LASF1066:
+	.string	"__DECL_SIMD_cos"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1428:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1906:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF954:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2219:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2337:
+	.string	"OWNER_USB_DETECT"
+.LASF973:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2102:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1992:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF876:
+	.string	"__DECL_SIMD_asinf "
+.LASF2134:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1778:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1775:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2261:
+	.string	"size"
+.LASF1461:
+	.string	"USE_PPM "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1956:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2422:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1734:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2438:
+	.string	"rx_max_usec"
+.LASF2371:
+	.string	"ADJUSTMENT_PITCH_ROLL_I"
+.LASF2147:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1531:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF2370:
+	.string	"ADJUSTMENT_PITCH_ROLL_P"
+.LASF1248:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1261:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1114:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF843:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1961:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1113:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF796:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1966:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1159:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1802:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF940:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1620:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF2460:
+	.string	"pidProfileToUse"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF1972:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1619:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1350:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1830:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2341:
+	.string	"OWNER_INVERTER"
+.LASF1347:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2250:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2228:
+	.string	"MARK_ADJUSTMENT_FUNCTION_AS_READY(adjustmentIndex) adjustmentStateMask &= ~(1 << adjustmentIndex)"
+.LASF2321:
+	.string	"OWNER_SPI_MOSI"
+.LASF2010:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1921:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2124:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2260:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2247:
+	.string	"uint8_t"
+.LASF1433:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1869:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2450:
+	.string	"pidInitConfig"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1213:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF2320:
+	.string	"OWNER_SPI_MISO"
+.LASF1927:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1646:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2084:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1251:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1973:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1668:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1473:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF861:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1394:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1149:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1373:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1167:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1035:
+	.string	"__DECL_SIMD_asinh "
+.LASF1648:
+	.string	"VERY_FAST_MATH "
+.LASF1303:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1770:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1524:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2293:
+	.string	"levelSensitivity"
+.LASF1063:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1570:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF2391:
+	.string	"ADJUSTMENT_MODE_STEP"
+.LASF1756:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1214:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1354:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF862:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1982:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1319:
+	.string	"FP_INFINITE 1"
+.LASF1309:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF915:
+	.string	"__DECL_SIMD_cosh "
+.LASF1311:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF805:
+	.string	"__DECL_SIMD_sin "
+.LASF1537:
+	.string	"LED0_PIN NONE"
+.LASF1868:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF2117:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1571:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1527:
+	.string	"_BSD_WCHAR_T_"
+.LASF2476:
+	.string	"_index"
+.LASF1073:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1166:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1887:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1164:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1180:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1388:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2036:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2181:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1089:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2398:
+	.string	"mode"
+.LASF1790:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1171:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2303:
+	.string	"OWNER_PPMINPUT"
+.LASF1533:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1781:
+	.string	"IOCFG_IPD 0"
+.LASF1510:
+	.string	"__need_ptrdiff_t"
+.LASF848:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2266:
+	.string	"FD_PITCH"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1205:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1453:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1610:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2137:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1265:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1712:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF2484:
+	.string	"adjustmentRanges"
+.LASF1558:
+	.string	"SERIAL_RX"
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2412:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF2018:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1821:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1764:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF801:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2367:
+	.string	"ADJUSTMENT_THROTTLE_EXPO"
+.LASF2095:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1437:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF833:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1269:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF2200:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF2017:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1229:
+	.string	"FP_INT_UPWARD 0"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1737:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1254:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2424:
+	.string	"rssi_scale"
+.LASF1865:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1702:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF2021:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1598:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1628:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1577:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1836:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2352:
+	.string	"thrMid8"
+.LASF1707:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2226:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1859:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF2211:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF2023:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1181:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1905:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF928:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1215:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1439:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF2432:
+	.string	"rcSmoothingFilterType"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1582:
+	.string	"BLACKBOX"
+.LASF1856:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2073:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1750:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1567:
+	.string	"LED_STRIP"
+.LASF2054:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1133:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF2172:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1179:
+	.string	"__f128(x) x ##f128"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1256:
+	.string	"_Mdouble_ long double"
+.LASF808:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF2099:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1855:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2429:
+	.string	"rcInterpolation"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1839:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1075:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1930:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1563:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1564:
+	.string	"USE_SERIALRX_SUMH"
+.LASF2180:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF2457:
+	.string	"adjustmentRange"
+.LASF1965:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF890:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1916:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1091:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1474:
+	.string	"TELEMETRY_FRSKY "
+.LASF2360:
+	.string	"channelRange_s"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1056:
+	.string	"__DECL_SIMD_tanf "
+.LASF2041:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2377:
+	.string	"ADJUSTMENT_PITCH_RATE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1748:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2316:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1312:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF2262:
+	.string	"address"
+.LASF2052:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1659:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1955:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1378:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF2389:
+	.string	"ADJUSTMENT_FUNCTION_COUNT"
+.LASF1952:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2039:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1943:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1946:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2177:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1331:
+	.string	"math_errhandling 0"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1562:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1292:
+	.string	"_Marg_ _Float32x"
+.LASF797:
+	.string	"__DECL_SIMD_cosl "
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1842:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1216:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1616:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1875:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1985:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1608:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF1637:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2384:
+	.string	"ADJUSTMENT_ROLL_D"
+.LASF2369:
+	.string	"ADJUSTMENT_YAW_RATE"
+.LASF2383:
+	.string	"ADJUSTMENT_ROLL_I"
+.LASF2350:
+	.string	"rcYawRate8"
+.LASF783:
+	.string	"__size_t "
+.LASF2318:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1511:
+	.string	"__wchar_t__ "
+.LASF1626:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1589:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1218:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1440:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF499:
+	.string	"__PMT"
+.LASF1804:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1525:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF2299:
+	.string	"rateAccelLimit"
+.LASF1584:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2280:
+	.string	"pidProfile_s"
+.LASF2300:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1991:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2128:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1726:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1456:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1343:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1583:
+	.string	"USE_RESOURCE_MGMT"
+.LASF976:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1391:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF2002:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1401:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF1025:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1942:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1465:
+	.string	"USE_SERIALRX_IBUS "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2258:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1321:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1177:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2085:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1684:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1224:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1138:
+	.string	"__DECL_SIMD_log2"
+.LASF1997:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1769:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1569:
+	.string	"TELEMETRY_HOTT"
+.LASF1400:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF2075:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2466:
+	.string	"channelIndex"
+.LASF1336:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2308:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1911:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1116:
+	.string	"__DECL_SIMD_coshf"
+.LASF1153:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1396:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF1940:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1238:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1614:
+	.string	"UNIT_TESTED "
+.LASF829:
+	.string	"__DECL_SIMD_logf32 "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1988:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF2022:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF965:
+	.string	"__DECL_SIMD_log10 "
+.LASF1594:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF874:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1517:
+	.string	"_WCHAR_T_ "
+.LASF1080:
+	.string	"__DECL_SIMD_logf"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1093:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1949:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1639:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF873:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2001:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2479:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF2186:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1193:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1678:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF2231:
+	.string	"RESET_FREQUENCY_2HZ (1000 / 2)"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1624:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1452:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF925:
+	.string	"__DECL_SIMD_expm1 "
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1834:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1313:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2447:
+	.string	"memset"
+.LASF1264:
+	.string	"_Mdouble_ _Float128"
+.LASF1374:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF1754:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2030:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2289:
+	.string	"dterm_average_count"
+.LASF1044:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1419:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1740:
+	.string	"PG_PID_CONFIG 504"
+.LASF1422:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF2111:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1970:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1432:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF1136:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1467:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2366:
+	.string	"ADJUSTMENT_RC_EXPO"
+.LASF1932:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1801:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1884:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2380:
+	.string	"ADJUSTMENT_PITCH_I"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1438:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1353:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF2290:
+	.string	"vbatPidCompensation"
+.LASF987:
+	.string	"__DECL_SIMD_log1pl "
+.LASF869:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF914:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1812:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF819:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF992:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1837:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1417:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF1266:
+	.string	"_Mdouble_ _Float32x"
+.LASF1640:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF936:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1221:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF881:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1813:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF849:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF980:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1566:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF865:
+	.string	"__DECL_SIMD_atan "
+.LASF2413:
+	.string	"rxConfig_s"
+.LASF2192:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF2439:
+	.string	"rxConfig_t"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1593:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1987:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1272:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1068:
+	.string	"__DECL_SIMD_cosf"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1295:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1481:
+	.string	"CMS "
+.LASF2263:
+	.string	"reset"
+.LASF1130:
+	.string	"__DECL_SIMD_atan2"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1685:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1920:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF2165:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF1281:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF882:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2324:
+	.string	"OWNER_SDCARD"
+.LASF1539:
+	.string	"USE_FAKE_GYRO "
+.LASF1286:
+	.string	"__MATHCALL_NAME"
+.LASF985:
+	.string	"__DECL_SIMD_log1p "
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF2056:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1057:
+	.string	"__DECL_SIMD_tanl "
+.LASF912:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2142:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1330:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1725:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF2245:
+	.string	"int16_t"
+.LASF1722:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1989:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1384:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1950:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2236:
+	.string	"signed char"
+.LASF1194:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1618:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF813:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1890:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2071:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF929:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1477:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1316:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1478:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1535:
+	.string	"U_ID_1 1"
+.LASF934:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1209:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF2139:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1555:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1521:
+	.string	"_WCHAR_T_H "
+.LASF1963:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1693:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2194:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1144:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1732:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1739:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1644:
+	.string	"sq(x) ((x)*(x))"
+.LASF825:
+	.string	"__DECL_SIMD_log "
+.LASF981:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1289:
+	.string	"_Mret_ double"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1674:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2048:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1967:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1095:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1196:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1219:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF2055:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2433:
+	.string	"rcSmoothingCutoffHz"
+.LASF1476:
+	.string	"TELEMETRY_LTM "
+.LASF1446:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1386:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1799:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF2063:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF977:
+	.string	"__DECL_SIMD_log2l "
+.LASF2204:
+	.string	"PWM_PULSE_MIN 750"
+.LASF2154:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2178:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2265:
+	.string	"FD_ROLL"
+.LASF1701:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1078:
+	.string	"__DECL_SIMD_log"
+.LASF2093:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2249:
+	.string	"uint32_t"
+.LASF1185:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2045:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2346:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2415:
+	.string	"serialrx_provider"
+.LASF1705:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1258:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1879:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1285:
+	.string	"_Marg_"
+.LASF1036:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1241:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF2086:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1471:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1499:
+	.string	"_ANSI_STDDEF_H "
+.LASF1755:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2339:
+	.string	"OWNER_OSD"
+.LASF821:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2026:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2057:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2140:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2256:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF831:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2106:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1710:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1743:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1207:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1838:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1346:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1808:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1236:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1587:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1845:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1411:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1299:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF1882:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1788:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF822:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1255:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF1923:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1195:
+	.string	"__f32(x) x ##f32"
+.LASF2175:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1768:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1642:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1621:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2295:
+	.string	"itermAcceleratorGain"
+.LASF1320:
+	.string	"FP_ZERO 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1780:
+	.string	"IOCFG_AF_OD 0"
+.LASF2083:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF839:
+	.string	"__DECL_SIMD_expf32 "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1831:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF838:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2195:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1814:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF2014:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1098:
+	.string	"__DECL_SIMD_asin"
+.LASF1730:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF982:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1480:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1119:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF2000:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1999:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1206:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1233:
+	.string	"FP_INT_TONEAREST 4"
+.LASF1795:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1704:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF2396:
+	.string	"adjustmentConfig_s"
+.LASF2400:
+	.string	"adjustmentConfig_t"
+.LASF2480:
+	.string	"adjustmentConfig_u"
+.LASF2267:
+	.string	"FD_YAW"
+.LASF2243:
+	.string	"long int"
+.LASF2183:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1102:
+	.string	"__DECL_SIMD_hypot"
+.LASF1697:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1072:
+	.string	"__DECL_SIMD_sinf"
+.LASF1883:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF978:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1741:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1656:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF1014:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF941:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1935:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2314:
+	.string	"OWNER_PINDEBUG"
+.LASF1862:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2129:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2444:
+	.string	"defaultAdjustmentConfigs"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF2197:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF2388:
+	.string	"ADJUSTMENT_HORIZON_STRENGTH"
+.LASF1482:
+	.string	"TELEMETRY_CRSF "
+.LASF1504:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF2395:
+	.string	"adjustmentData_t"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1669:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1503:
+	.string	"__PTRDIFF_T "
+.LASF1495:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF942:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1962:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1888:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1240:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1540:
+	.string	"ACC "
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1688:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF2028:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF945:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1667:
+	.string	"EXPAND_I(x) x"
+.LASF1938:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2105:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2209:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF2029:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2302:
+	.string	"OWNER_PWMINPUT"
+.LASF1895:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1246:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1977:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1074:
+	.string	"__DECL_SIMD_sincos"
+.LASF877:
+	.string	"__DECL_SIMD_asinl "
+.LASF1671:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1534:
+	.string	"U_ID_0 0"
+.LASF1147:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1157:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1199:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1349:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1765:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF2067:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF975:
+	.string	"__DECL_SIMD_log2 "
+.LASF1860:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1529:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2205:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF963:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2368:
+	.string	"ADJUSTMENT_PITCH_ROLL_RATE"
+.LASF994:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2453:
+	.string	"millis"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1443:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1200:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1004:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1803:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1652:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF2469:
+	.string	"position"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF2459:
+	.string	"processRcAdjustments"
+.LASF2348:
+	.string	"controlRateConfig_s"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1365:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF2019:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1202:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF845:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1568:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1332:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1345:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1615:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1720:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1636:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1514:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1430:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1878:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1601:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF2150:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1399:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF2465:
+	.string	"canResetReadyStates"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF2288:
+	.string	"pidSumLimitYaw"
+.LASF2315:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1721:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1457:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1864:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2061:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1572:
+	.string	"TELEMETRY_SRXL"
+.LASF2297:
+	.string	"dtermSetpointWeight"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF2037:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"USE_FAKE_MAG "
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1805:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1088:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1101:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1278:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2272:
+	.string	"PIDPOS"
+.LASF971:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1934:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2351:
+	.string	"rcExpo8"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1585:
+	.string	"USE_DSHOT"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF2146:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1188:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1871:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1635:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1779:
+	.string	"IOCFG_AF_PP 0"
+.LASF968:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1690:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1560:
+	.string	"USE_SERIALRX_IBUS"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF885:
+	.string	"__DECL_SIMD_hypot "
+.LASF1867:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1223:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2362:
+	.string	"endStep"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF1445:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF841:
+	.string	"__DECL_SIMD_expf128 "
+.LASF2354:
+	.string	"rates"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF800:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF972:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2059:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1759:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2167:
+	.string	"BEEP_ON do {} while(0)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2327:
+	.string	"OWNER_FLASH_CS"
+.LASF2006:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1228:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF2471:
+	.string	"newValue"
+.LASF1565:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1490:
+	.string	"USE_RX_MSP "
+.LASF1663:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1526:
+	.string	"__DEFINED_wchar_t "
+.LASF401:
+	.string	"true 1"
+.LASF2032:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF802:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2190:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2227:
+	.string	"MARK_ADJUSTMENT_FUNCTION_AS_BUSY(adjustmentIndex) adjustmentStateMask |= (1 << adjustmentIndex)"
+.LASF1653:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF856:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF2220:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2207:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF842:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1104:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1885:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2210:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1183:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF851:
+	.string	"__DECL_SIMD_powf128 "
+.LASF765:
+	.string	"__need_NULL "
+.LASF944:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1115:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1455:
+	.string	"I2C1_OVERCLOCK true"
+.LASF2462:
+	.string	"canUseRxData"
+.LASF1806:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1607:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1849:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2281:
+	.string	"dterm_filter_type"
+.LASF1121:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1361:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF880:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2468:
+	.string	"rangeWidth"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1983:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF1713:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2162:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF2125:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1588:
+	.string	"USE_PROFILE "
+.LASF2481:
+	.string	"generateRcCurves"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1718:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1580:
+	.string	"VTX_SMARTAUDIO"
+.LASF1466:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2319:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1899:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2311:
+	.string	"OWNER_ADC_RSSI"
+.LASF1612:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1137:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2060:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1368:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1105:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF906:
+	.string	"__DECL_SIMD_exp10f "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1284:
+	.string	"_Mret_"
+.LASF1877:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1915:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2381:
+	.string	"ADJUSTMENT_PITCH_D"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1528:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1786:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1204:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1502:
+	.string	"_T_PTRDIFF "
+.LASF870:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1062:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1005:
+	.string	"__DECL_SIMD_acosh "
+.LASF1169:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2379:
+	.string	"ADJUSTMENT_PITCH_P"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF2223:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1429:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1541:
+	.string	"USE_FAKE_ACC "
+.LASF1367:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1315:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1742:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2040:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1447:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1226:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2198:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 15"
+.LASF1318:
+	.string	"FP_NAN 0"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1191:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF2003:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1111:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2212:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF2428:
+	.string	"maxcheck"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2135:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF918:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1015:
+	.string	"__DECL_SIMD_erf "
+.LASF1342:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1107:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2387:
+	.string	"ADJUSTMENT_D_SETPOINT_TRANSITION"
+.LASF2408:
+	.string	"config"
+.LASF1222:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1960:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1757:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF2081:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2376:
+	.string	"ADJUSTMENT_RATE_PROFILE"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1152:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1355:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF1996:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2157:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1131:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1695:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1954:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1077:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1424:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1230:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF855:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1217:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2187:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF832:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1139:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF1630:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1675:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1975:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1733:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1458:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1296:
+	.string	"_Marg_ _Float64x"
+.LASF1444:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1631:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1087:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2051:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2252:
+	.string	"double"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1907:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF858:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1753:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF2132:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2409:
+	.string	"timeoutAt"
+.LASF1789:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF955:
+	.string	"__DECL_SIMD_atan2 "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1397:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF2322:
+	.string	"OWNER_I2C_SCL"
+.LASF1092:
+	.string	"__DECL_SIMD_acosf"
+.LASF1150:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2345:
+	.string	"OWNER_COMPASS_CS"
+.LASF2458:
+	.string	"adjustmentConfig"
+.LASF1085:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1835:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2361:
+	.string	"startStep"
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1681:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1968:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF2284:
+	.string	"dterm_notch_hz"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2431:
+	.string	"rcInterpolationInterval"
+.LASF1518:
+	.string	"_BSD_WCHAR_T_ "
+.LASF903:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1978:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2286:
+	.string	"itermWindupPointPercent"
+.LASF1497:
+	.string	"_STDDEF_H "
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1848:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1602:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1341:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2103:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2241:
+	.string	"__int32_t"
+.LASF2483:
+	.string	"rxConfig"
+.LASF1327:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1622:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF2323:
+	.string	"OWNER_I2C_SDA"
+.LASF2225:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2242:
+	.string	"__uint32_t"
+.LASF866:
+	.string	"__DECL_SIMD_atanf "
+.LASF1654:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF2399:
+	.string	"data"
+.LASF2064:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1773:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1698:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1658:
+	.string	"Q12 (1 << 12)"
+.LASF1442:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1460:
+	.string	"USE_CLI "
+.LASF1976:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2355:
+	.string	"dynThrPID"
+.LASF1156:
+	.string	"__DECL_SIMD_erff"
+.LASF2109:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1854:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1990:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF2107:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2328:
+	.string	"OWNER_FLASH"
+.LASF857:
+	.string	"__DECL_SIMD_acosl "
+.LASF1293:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1727:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1450:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF1083:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1109:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF2043:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2168:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF846:
+	.string	"__DECL_SIMD_powf "
+.LASF2222:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1338:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1515:
+	.string	"_T_WCHAR "
+.LASF2074:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF852:
+	.string	"__DECL_SIMD_powf32x "
+.LASF782:
+	.string	"_SIZET_ "
+.LASF2421:
+	.string	"spektrum_sat_bind"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF2218:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1897:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1376:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF883:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1498:
+	.string	"_STDDEF_H_ "
+.LASF1793:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF875:
+	.string	"__DECL_SIMD_asin "
+.LASF2160:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1914:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1065:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1274:
+	.string	"__MATHCALL"
+.LASF969:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1661:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2038:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2473:
+	.string	"applyStepAdjustment"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1576:
+	.string	"USE_DASHBOARD"
+.LASF917:
+	.string	"__DECL_SIMD_coshl "
+.LASF1873:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1847:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1947:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1427:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF1448:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1335:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF1022:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1494:
+	.string	"VTX_CONTROL "
+.LASF995:
+	.string	"__DECL_SIMD_atanh "
+.LASF2049:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2343:
+	.string	"OWNER_TRANSPONDER"
+.LASF1699:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF907:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2035:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF984:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1900:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2296:
+	.string	"setpointRelaxRatio"
+.LASF1650:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2104:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2144:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1505:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1173:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1100:
+	.string	"__DECL_SIMD_asinf"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1162:
+	.string	"__DECL_SIMD_asinh"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF2217:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1122:
+	.string	"__DECL_SIMD_sinh"
+.LASF924:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1959:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF886:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF820:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2171:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF871:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1297:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2156:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1190:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1324:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1268:
+	.string	"_Mdouble_ _Float64x"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1538:
+	.string	"GYRO "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1360:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1023:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1148:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF964:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF850:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1762:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1363:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2330:
+	.string	"OWNER_MPU_CS"
+.LASF2254:
+	.string	"pgn_t"
+.LASF1745:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2031:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1175:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1680:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2201:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2108:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF872:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2208:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1544:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF896:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF2244:
+	.string	"char"
+.LASF1676:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1112:
+	.string	"__DECL_SIMD_exp10f"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1203:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF2050:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1174:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1552:
+	.string	"USE_UART7 "
+.LASF2094:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2291:
+	.string	"pidAtMinThrottle"
+.LASF2110:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1595:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1259:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1811:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1682:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF986:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1638:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1369:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1071:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1677:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2402:
+	.string	"auxChannelIndex"
+.LASF923:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF930:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1840:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1375:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1034:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2301:
+	.string	"OWNER_FREE"
+.LASF905:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1604:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF919:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF893:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1451:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF810:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1825:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1643:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF2087:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2437:
+	.string	"rx_min_usec"
+.LASF1058:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1436:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF1844:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1357:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF2420:
+	.string	"rx_spi_rf_channel_count"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1192:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2145:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2170:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1928:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2149:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2349:
+	.string	"rcRate8"
+.LASF853:
+	.string	"__DECL_SIMD_powf64x "
+.LASF803:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2185:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF2405:
+	.string	"adjustmentIndex"
+.LASF1613:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1590:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF867:
+	.string	"__DECL_SIMD_atanl "
+.LASF1553:
+	.string	"USE_UART8 "
+.LASF1294:
+	.string	"_Marg_ _Float64"
+.LASF1046:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1282:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1506:
+	.string	"___int_ptrdiff_t_h "
+.LASF1413:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF1998:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1828:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF998:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1021:
+	.string	"__DECL_SIMD_erff128 "
+.LASF904:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF938:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2025:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2148:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF859:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1356:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1302:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1410:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF2404:
+	.string	"auxSwitchChannelIndex"
+.LASF2470:
+	.string	"beeps"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1123:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF2182:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2474:
+	.string	"configureAdjustment"
+.LASF847:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1904:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1287:
+	.string	"_Marg_ long double"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1777:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1385:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2213:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1686:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2325:
+	.string	"OWNER_SDCARD_CS"
+.LASF1591:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1262:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1731:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1984:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1377:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1843:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2463:
+	.string	"adjustmentState"
+.LASF1657:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2414:
+	.string	"rcmap"
+.LASF2443:
+	.string	"adjustmentStateMask"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1463:
+	.string	"SERIAL_RX "
+.LASF1807:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1792:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1559:
+	.string	"USE_SERIALRX_CRSF"
+.LASF926:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1823:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1546:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF2130:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2016:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2076:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1925:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2274:
+	.string	"PIDNAVR"
+.LASF1881:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2442:
+	.string	"pidProfile"
+.LASF1948:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF1016:
+	.string	"__DECL_SIMD_erff "
+.LASF1416:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF2173:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1599:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1290:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF1746:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1352:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2027:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1403:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1912:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1554:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF887:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF798:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2235:
+	.string	"long unsigned int"
+.LASF1785:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2342:
+	.string	"OWNER_LED_STRIP"
+.LASF2044:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1547:
+	.string	"USE_UART2 "
+.LASF1493:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1496:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2214:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1605:
+	.string	"__disable_irq() "
+.LASF2278:
+	.string	"PID_ITEM_COUNT"
+.LASF1154:
+	.string	"__DECL_SIMD_erf"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2042:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1326:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1407:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1579:
+	.string	"VTX_CONTROL"
+.LASF817:
+	.string	"__DECL_SIMD_sincosl "
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2152:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2392:
+	.string	"ADJUSTMENT_MODE_SELECT"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1211:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1980:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1979:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1359:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF2239:
+	.string	"short int"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF2472:
+	.string	"applySelectAdjustment"
+.LASF1717:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2298:
+	.string	"yawRateAccelLimit"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1957:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1815:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF897:
+	.string	"__DECL_SIMD_exp2l "
+.LASF834:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1362:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1548:
+	.string	"USE_UART3 "
+.LASF1242:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1728:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2451:
+	.string	"getCurrentControlRateProfileIndex"
+.LASF1516:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF2283:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1132:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1086:
+	.string	"__DECL_SIMD_pow"
+.LASF2166:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2329:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1729:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1300:
+	.string	"_Mret_ _Float32x"
+.LASF1736:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1874:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1886:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1649:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF2365:
+	.string	"ADJUSTMENT_RC_RATE"
+.LASF2436:
+	.string	"airModeActivateThreshold"
+.LASF1606:
+	.string	"__enable_irq() "
+.LASF2234:
+	.string	"unsigned int"
+.LASF1549:
+	.string	"USE_UART4 "
+.LASF889:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1054:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1964:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1317:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF1574:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1787:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1662:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF1252:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF956:
+	.string	"__DECL_SIMD_atan2f "
+.LASF815:
+	.string	"__DECL_SIMD_sincos "
+.LASF1760:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1082:
+	.string	"__DECL_SIMD_exp"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1744:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1366:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF2307:
+	.string	"OWNER_ADC"
+.LASF908:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2334:
+	.string	"OWNER_MPU_EXTI"
+.LASF1902:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF806:
+	.string	"__DECL_SIMD_sinf "
+.LASF1081:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF958:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2116:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2294:
+	.string	"itermThrottleThreshold"
+.LASF1379:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF2133:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2062:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1550:
+	.string	"USE_UART5 "
+.LASF2079:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1689:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1120:
+	.string	"__DECL_SIMD_expm1f"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1270:
+	.string	"__MATHDECL_1_IMPL"
+.LASF2229:
+	.string	"IS_ADJUSTMENT_FUNCTION_BUSY(adjustmentIndex) (adjustmentStateMask & (1 << adjustmentIndex))"
+.LASF1660:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1573:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1225:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2310:
+	.string	"OWNER_ADC_EXT"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1735:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1918:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1766:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1876:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1076:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1182:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2331:
+	.string	"OWNER_OSD_CS"
+.LASF2477:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2120:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1632:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1340:
+	.string	"M_E 2.7182818284590452354"
+.LASF1782:
+	.string	"IOCFG_IPU 0"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2113:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF830:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1418:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2163:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF1551:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1926:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2572:
+	.string	"io_def_generated.h"
+.LASF2565:
+	.string	"io_types.h"
+.LASF2548:
+	.string	"mathcalls-helper-functions.h"
+.LASF2540:
+	.string	"math.h"
+.LASF2531:
+	.string	"long-double.h"
+.LASF2538:
+	.string	"__locale_t.h"
+.LASF2552:
+	.string	"platform.h"
+.LASF2493:
+	.string	"src/main/rx"
+.LASF2489:
+	.string	"src/main/drivers"
+.LASF2542:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2525:
+	.string	"libc-header-start.h"
+.LASF2500:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2539:
+	.string	"strings.h"
+.LASF2504:
+	.string	"stdint-intn.h"
+.LASF2512:
+	.string	"rc_controls.h"
+.LASF2508:
+	.string	"axis.h"
+.LASF2499:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2502:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2532:
+	.string	"stubs.h"
+.LASF2536:
+	.string	"wchar.h"
+.LASF2485:
+	.string	"src/main/blackbox"
+.LASF2494:
+	.string	"src/main/target/SITL"
+.LASF2517:
+	.string	"beeper.h"
+.LASF2554:
+	.string	"target.h"
+.LASF2492:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF2509:
+	.string	"pid.h"
+.LASF2498:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2518:
+	.string	"config.h"
+.LASF2521:
+	.string	"fc_rc.h"
+.LASF2527:
+	.string	"features-time64.h"
+.LASF2574:
+	.string	"vcd.h"
+.LASF2573:
+	.string	"sound_beeper.h"
+.LASF2503:
+	.string	"types.h"
+.LASF2541:
+	.string	"math-vector.h"
+.LASF2544:
+	.string	"floatn-common.h"
+.LASF2519:
+	.string	"system.h"
+.LASF2543:
+	.string	"floatn.h"
+.LASF2529:
+	.string	"timesize.h"
+.LASF2523:
+	.string	"stdbool.h"
+.LASF2501:
+	.string	"/usr/include"
+.LASF2486:
+	.string	"src/main/build"
+.LASF2562:
+	.string	"feature.h"
+.LASF2526:
+	.string	"features.h"
+.LASF2491:
+	.string	"src/main/flight"
+.LASF2534:
+	.string	"typesizes.h"
+.LASF2487:
+	.string	"src/main/common"
+.LASF2569:
+	.string	"serial.h"
+.LASF2556:
+	.string	"blackbox.h"
+.LASF2488:
+	.string	"src/main/config"
+.LASF2563:
+	.string	"motors.h"
+.LASF2566:
+	.string	"flash.h"
+.LASF2535:
+	.string	"time64.h"
+.LASF2551:
+	.string	"iscanonical.h"
+.LASF2505:
+	.string	"stdint-uintn.h"
+.LASF2495:
+	.string	"src/main/target"
+.LASF2560:
+	.string	"utils.h"
+.LASF2550:
+	.string	"mathcalls-narrow.h"
+.LASF2496:
+	.string	"src/main"
+.LASF2567:
+	.string	"rx_pwm.h"
+.LASF2549:
+	.string	"mathcalls.h"
+.LASF2568:
+	.string	"sdcard.h"
+.LASF2558:
+	.string	"time.h"
+.LASF2545:
+	.string	"flt-eval-method.h"
+.LASF2510:
+	.string	"resource.h"
+.LASF2528:
+	.string	"wordsize.h"
+.LASF2530:
+	.string	"cdefs.h"
+.LASF2561:
+	.string	"parameter_group_ids.h"
+.LASF0:
+	.string	"./src/main/fc/rc_adjustments.c"
+.LASF2515:
+	.string	"rc_adjustments.c"
+.LASF2514:
+	.string	"rx.h"
+.LASF2547:
+	.string	"fp-fast.h"
+.LASF2571:
+	.string	"io_def.h"
+.LASF2513:
+	.string	"rc_adjustments.h"
+.LASF2553:
+	.string	"common.h"
+.LASF2520:
+	.string	"maths.h"
+.LASF2546:
+	.string	"fp-logb.h"
+.LASF2516:
+	.string	"string.h"
+.LASF2497:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2537:
+	.string	"locale_t.h"
+.LASF2524:
+	.string	"stdint.h"
+.LASF2559:
+	.string	"build_config.h"
+.LASF2506:
+	.string	"stddef.h"
+.LASF2533:
+	.string	"stubs-64.h"
+.LASF2557:
+	.string	"blackbox_fielddefs.h"
+.LASF2511:
+	.string	"controlrate_profile.h"
+.LASF2570:
+	.string	"io.h"
+.LASF2490:
+	.string	"src/main/fc"
+.LASF2555:
+	.string	"common_post.h"
+.LASF2564:
+	.string	"adc.h"
+.LASF2507:
+	.string	"parameter_group.h"
+.LASF2522:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"U\005"
+	.string	"\324\006\226\001"
+	.string	"\f"
+	.string	"\367\337\232\224\f^\002"
+	.string	"\002\001"
+	.string	"\002\003\001\240\342\234\212\n\002\227\246\265\253\004\006"
+	.string	"\002\003\003\212\343\252\357\016*\002\004\002\004\002"
+	.string	"\002\005\005\002\006\002\007\002\b\002\t\002\n\002\005"
+	.string	""
+	.string	"\002"
+	.string	"\004\005\352\263\360\321\b\b\307\206\334\021"
+	.string	"\t\265\310\273\263\b\024\002\013\004"
+	.string	"\n\013\353\366\243\226\t\f\226\266\306,\r\344\223\353\343\003"
+	.string	"\032"
+	.string	"i\210\023\34120\b\350\356\274\331\035\232\300\302R\013v\004*\034\334P2\330\211\007#r\003^\006X]`L[\260\376\03256\346\205|\031"
+	.ascii	"\006v=`\005\356L\322\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375 y5\002"
+	.string	"\324\002m"
+	.string	"\006"
+	.string	"\003"
+	.string	"\001\002\002"
+	.string	""
+	.string	"\001"
+	.string	"\003\001"
+	.string	"\020"
+	.string	"\007\001\001\001\003\001\200\004\b\b"
+	.string	"\001"
+	.string	"\001\t"
+	.string	"\001"
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\n"
+	.string	"7\003\200\001 \224%0\235\033A\023"
+	.ascii	"\243\034\272\300\220\r`\001"
+	.text
+	.section	.gnu.lto_.inline.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`\020\004\305\021"
+	.string	"\246\331U@\020\221\223\306O\021d+\327\241\267?\226=\207 s]\3236\353\036\275(.%\216<\304ec\233"
+	.string	"\330\025\214\177\346f\200\t \032\301h\004"
+	.string	"\205\303\334\205\267\271>6h\213~\203|\271\245L\001E"
+	.string	"C"
+	.string	"E"
+	.string	"\347\351\311\335\rQ\217aw?\257\340\257\022\361o\211\371\330\322\202\305\nVy\001\037\301\001\003\005\b\f\020\340\002"
+	.ascii	"\2502! \354\203\362\320\225\210\021\250*-\340/\300\226\025Rd"
+	.ascii	"\224\220\243\025:J8\342\251=4\270\343\211\217\200\366\245(h\005"
+	.ascii	"\335 \264\232\023\013\315B#I\264\370\331\335N\216N\274\2744%"
+	.ascii	"\321\235\310\355\356\355O\263k\262\204\003;3\037,\225\222iC\256"
+	.ascii	"\312\330\356rR\205J)D[7q\360\253\001\351\362bG\212\\\327\216"
+	.ascii	"z\322$\"\005\205\233\275\031'aH\300\230\310]c\t\326\321d\311"
+	.ascii	"\210\341\342B\344|C\312\3443\367\220\315\330\311\334\316\235"
+	.ascii	"\356\375\336\3718,l\355\311\201vI\262\306\r\323J\342\236N\247"
+	.ascii	"C\310\364\254v\222\037\224\230\021\203\223\305\202\022\323ad"
+	.ascii	"\220_\372o>cw?f\277\036+}Cz\323\326\257\201\372\t\231\343CK\t"
+	.ascii	"$Q\310O\006\0328\206\361Z?\323n\235%\362`\003\204\256o-\t\200"
+	.ascii	"\202\250!U\245jD\302\004I\n\n\205\306\320\002!\233Q\007\021`"
+	.ascii	"\2412\022\336\032\303\030s\367*{\260Z\224\207\223\305\362So\200"
+	.ascii	"\374a\005\317\324\312\326\357\350\342\356\007\321\315\357\"\237"
+	.ascii	"\021a\357\026\005:2\260\233\251\245d\345[\322\331\312\277\260"
+	.ascii	"-\226S\225\224\275h\207dJAr/\2779\235Y\256\252\251\374%\363H"
+	.ascii	"\222\360/`U\\\230\305L\224\321\373\372p\371\367y\300\364\231"
+	.ascii	"X\003\302\314\020\274\202\230lA\001\246F\030\276\302\310\025"
+	.ascii	"\315A\302\267gj\001hao\340vq\030a\272]#\314\bn/\f L7\210 \254"
+	.ascii	"\214\013\317gQ\035RG\357\207\362\213(\001nC\341\302\325\001\215"
+	.ascii	"\\\032\222\361\222\273\270C\273\334\345\375\371\300\030\036:"
+	.ascii	"\007''p.\031\037X\31664/d"
+	.text
+	.section	.gnu.lto_.jmpfuncs.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`K"
+	.string	"\325\004"
+	.string	"\322\210\030 \240%I\007\377sT\f\2603\377"
+	.string	""
+	.string	"\370\037\247\202q"
+	.string	"8`\341\005;\337\346\314\356E\210L)\232\225y\342\344\017\336jPE\331\004\232\036\360j\204\036\241\255\300\0163\244\005}\031 X\004\332e\035\322\232\033|\236\321\227\202\367K\001\360\3336\350\r\332\346\223\370I\326I\254\212\325\253\3437\222\037\001\025"
+	.string	"\r;\300\314N\343\026\230\030\206\264\223"
+	.ascii	"\254h\246\002\031\302_\230\205\245yx\253\215\335d\207\252\265"
+	.ascii	"9y\370\264\206\316\303 \024Qv_\352\216`\200\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\002\232\004\003\232\004\b\230\004\t\232\004\f\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375 \235\345\002"
+	.string	"2\004\016\030\260'\035\f\303\340\021\333\244\220B\262\352"
+	.string	"\350@\2460\276\005\t[\312\024\037\211b\234\237\007\205\r\315-w|\204\305\273\320Y\345\325diNX\237\243\326\250>\003?\023\016"
+	.string	"Y\221"
+	.string	"78\003M\231\321\312V\317\341\240\272\200\022\3033"
+	.ascii	"\242\b\350\311\001e#X\017\003p"
+	.text
+	.section	.gnu.lto_.lto.17d2ed4a57d336e1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.64.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375 {\275\003"
+	.string	"\264\006B"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\266\214\013yw"
+	.string	"\005\001\006'\001\332%(us\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\003"
+	.ascii	"N\005a\225\361\006P\004"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.68.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`,\003\205\n"
+	.string	"\344\016\037\004"
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\377\001\005\001?\202\210\200\b\177}\273\001\030\030{y\276\001w\275\001u\274\025\001\027\b\177s\275\027\303\001w\302\001u\301\026\026\307\306\025\025\313\312\024\024\317\316\023\023\323\322\022\022\327\326\021\021\333\332\020\020\337\336\017\017\343\342\016\016\347\346\r\r\353\352\f\003\356\f\360\357\013\013\364\363\n\n\370\367\t\t\374\373\b\377\376\007\007\203\002\202\002\006\006\207\002\206\005\005\213\212\004\004\217\216\003\356\001\222\002\002\226\225\275\230\002\300\003q3\231\0024\227\002\224\002\223\002\221\002\220\002\215\002\214\002\211\002\210\002\205\002\204\002\201\002\200\0025\375\001\372\001\371\001\366\001\365\001\362\001\361\001\355\001\354\001\351\001\350\001\345\001\344\001\341\001\340\001\335\001\334\001\331\001\330\001\325\001\324\001\321\001\320\001\315\001\314\001\311\001\310\001\305\001\304\001\300\001\277\001"
+	.ascii	"c\250A\330\224B\226\355\220\2234\305\006\020\020\b\211`\224\302"
+	.ascii	"\001\022U\310A\271\\'>\320g|m\226\267\236\305\314wx\241\250&"
+	.ascii	"G\302$>\3226\344\006\322\267e>\336%\231\267\353%\362\357&\364"
+	.ascii	"B.jC\023\267\240\033Z\221\033\2215\243\303\330\346\204\264\326"
+	.ascii	"\251\347\037\350W\202\266T+\252\250"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.71.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`s.\305t"
+	.string	"\212\262L'J \322RI\007\037\272\216\016Ky\030\202\241\017\033\246\252\374\367\271pw\203\032\343\214\200\n?s\264,\312\312\362\220M\206i\230f\355\202\265b\256\212'\362\246\273\273x\342\274\013\3243\0219\356\356\354n\367g\324j\333$I)\003O\002\027\002~\002\265\227D\261wD\355-\340\275\004\274w\200\367\nP{\003(\366\212\250\275"
+	.ascii	"\2747\304{\217\265\027\252\366>\275\327\351\275M"
+	.string	"\265\227\251\366.\275W\351\275I\265\027\251\366\202x\357\321{\215joQ\355%z\257\361\275C\265\267X{\353{\321\367\276\366\366{\231\323\240\370\356\304\330\223\246,$\376\220\372U\346\230\266/\r\246\303T8\300.l\315\245[\250p~\326\320:\255\325*\334\0377\263,]\326Z*\034a\341\230\262\305\032K\205Kd\241J[\351+5n\316\355\313\253\2474\225\032GW\030\245\223\315\325]5\316\331\351!#rb\215\353+T\310\206L\250\306\001\022\016r \026T\343\374\370\360\344?,X\343\002\271\371\341\303}\230\207\032GX\270'\017\003\262\236\032w\350\366g\207\375\370N\215K,\354\243\303{\314W\345\346\364\362\330\311r\252\034\235\033\336\335\206\301q\023f\215 7w\215\266\t\277Y\336\201\355\230Y\345\354\214\360\356\266\340\335\211\300\303VG7VG\007\005\307iF\255\021]\313T\tc\215\036\233B"
+	.ascii	"\250P\275Y\207&\fg\363\320e\252d\352\202\370%V\310uW\340\034"
+	.ascii	"\232\354\032qeb7kt\324C\265;\267y\306\2550\343\\\030\033\004"
+	.ascii	"\3234=\301u\263\366H\207\35280\234\026\307m\036\252\224vu\231"
+	.ascii	"s\227\246i\212\2752r\035\201\036\353\250\336\273\r\264\320\342"
+	.ascii	"%\222\225R.<.\3740r=\342@\305\275\313l\270\215\026\277\255\300"
+	.ascii	"Ki\352\345y\227\246\313\024\033e\344\272K~*r5rS\221\353j\355"
+	.ascii	">y\331\226\016\205Y\343%W\230\246\251\324\303\260\026\037\241"
+	.ascii	"\236\234\232\230\226\224\222\220@\034\031\025\021\031\207\212"
+	.ascii	"\025}k-\273a\242/\345\026\037\241\236\234\232\230\226\224\332"
+	.ascii	"\222\220\326@\034\245\031\025\221 B\031X\343\033\343\27703\364"
+	.ascii	"\211\304\fac\3328T\344\026\304\306p\225!\0061mkif0\274\340\302"
+	.ascii	"\0265\2643-^R\212\224Q\212\0373\206\306-\204\215iB\307\370\250"
+	.ascii	"\2105\2761$%\027\212\300\235.~\330\r7\230\262\253{\210*M\323"
+	.ascii	"\355/\245\030o\b\336e\304\335\365\262\213B.'\270\277\240o/<\""
+	.ascii	"\331\205\266\310\177\364\r(e\215\253\023\267\377_\220\027\342"
+	.ascii	"\356\221\356\001iL\323\324\305\266\037(k&\030\305\254P\344\332"
+	.ascii	"w\341\302[\262\023\367\310\216\254\305p\222\230\337V\037\256"
+	.ascii	"\bC.z\365_\266\217\202\233\350\351\346\315+\212p\260\016\334"
+	.ascii	"\346s\\\003\334\326\003eF\346o\033\317\023\030\030\031;\333~"
+	.ascii	"\373D\3778\361m\367\355\023\315\3234g\233\316>\321<&9\373D\367"
+	.ascii	",1\262\230\267O\224OO\211\221\305\346>Q\272$F\026\357\266\361"
+	.ascii	"\366yD=\244\272}\236P\013\bF\026u\330\336\301\b\361\315v\016"
+	.ascii	"E\206r\333sD~p\330\2063\326\331\260\275\034rc\263\335\246h\246"
+	.ascii	"f\273\206J\005\f\315v\032\224\0073\3334\274\217\314v\231\266"
+	.ascii	"#\223\262\305\260-\303>\215\314\310\"\327\355\257\324+\0072\r"
+	.ascii	"\303\356>k\236^\232n\361Z\177\245&\270\232p4uk\304M\nCB$j\021"
+	.ascii	"\276\213\245\244\371kGt}\013E\377\245\031O\320\035\265\337\313"
+	.ascii	"\t.r\033u\272\232\320v\335\341_\332\205v\227\\\375/\273\374\304"
+	.ascii	"\304D\303\275\227]21\345\025\260\257)^Q\272\222\357\345\255\367"
+	.ascii	"j\275\027\312{Ux\357\223\367:yo\n\357\315z\257\022~c>\341\275"
+	.ascii	"W\357E\302Kf\023\336k\365^#\034\307\\\344\275\"\324^!\357\r\362"
+	.ascii	"^ \357\r\241\366\376(\366\202P{?x\257\007"
+	.string	"\357\365\361\336\036\265\267\203b/\007\265\227\307{w\274w\203\332\253A\355\325\361\336\034\357\305\361\336\fj/\006\305\336\013j\257\005\357\255\340\2757\336KA\355\235\240\330+A\355\265\361\336\032\357\245\361^\252\332\033A\261\027\202\332;\343\2752\336\033\343\2750j\357\213b\357\003\265\327\201\367\272xo\213\367N\325^\026\305\336\006j\357\212\367\252x\257\324{\243jo\212b/\212\332{\342\275\f\274\327\304{\027\250\275\n\024{\023\250\275\b\274\267\304{\017x\257\001\001fMM\263\025\317\341\r\230\253\2578J\327,\2732,\034d\006\345WR\207\302\205\b\261!\027J\235\007E]*\305\243\346\344\300\244\200C\321$\333C\212C\350/5\374K\177\003\362\270|\nT\362\023G\007)9\317!\362!\377P\306\366u%&\316_)#\362\241\211\363\017\013\334\204\002_\340\315\202\267\231A\2015\t0\005\275q3}"
+	.string	"\221\305\354c\352C\340h\220\3073YG\340(\335^\026Wr\213l9\345Y\007\234\247D\351j\256\344\226\001?\200\304\r0\203\234\232A\353\215\004\231\021\3149zGL\246\267\277\224\271\246\200\313\200<\306\360\024\230\302\0138\252&\205)^R\260\220\361z\n0\360"
+	.string	"g\257/*o\246xI\021\340\003\004p\001^@Nap\027p\274\355\002\035Q\201L\212\\\003\370\024\037\346\277\034\f\223e1\273\001\217\346/\036E\256\"\036\305GK\2325\334L3FN\266\32455"
+	.ascii	"\276e\315\311\001x\315c\2429\261R\005\254\214r\331u'O\343\020"
+	.ascii	"\347.\026\256$Z\251\002v|\b\250\037\233\207\243\235A1\315\334"
+	.ascii	"\270\231eEO\230X\220\230\304\230O\037\303\362\344O\257}\211O"
+	.ascii	"\304\224a\211~W\376\304\351|e\f\213\2302\254\351NLoBqe\030\323"
+	.ascii	"\341\237\0353\212><nDtl\302\227\300\361I\002\364\227\n\332Y\272"
+	.ascii	"\025d\211**|\351\025\260O\205\262,d\207w`WA\351\ff\246\245,\013"
+	.ascii	"Y\322\225\220\236\264)\376\205\234\021\230\246\351\003\273\035"
+	.ascii	"\234\212\017\256.\332\220>\203\017s\357\f\267\235\034\343\277"
+	.ascii	"4\317\304\003q.\255\2038\332\203\rZihg\205\374\310\256ut&[S\353"
+	.ascii	"4\2643\243\037\025\335\350\203o\025\265\231\201\333n\315P\362"
+	.ascii	"\310.M\2439\363BDf\222\\\330\266\024J\305\316IC6\236\305\272"
+	.ascii	"\264\260y\270\260m\031\272\261\370\241\037]X,3\206\333nK\221"
+	.ascii	"\020H\b\034\250\226\272\t\347\200\274({\303\346\310\016\315/"
+	.ascii	"\311U\305\301e\325\362D\b4TI\335\203BxY\265B\316\0336\205\\G"
+	.ascii	"$\235\365.\021#\\\337\332#;\263z\301\001\332\370\013P\262\023"
+	.ascii	"\353Q@/\3042\236\003\263\355\205\311\030\262\031\n\262\362\034"
+	.ascii	"\345\333R\b\237\214\236\225\207\321&GJ\2406.\202\243\f\303L\346"
+	.ascii	"\346\207\261/\203L\250\301\004VF\216X\241M\260\220|\255\242\230"
+	.ascii	"XeU%\221\272\302J\222\004k\210\210\254$U'\202\002\222\252\036"
+	.ascii	"M\210\\\031\253\262\220\020!\241^a\035\311\032r\205\002\005L"
+	.ascii	"\313\242\305\213\"+F`\341\"J\204\221#E\256\260l\020\311\252\332"
+	.ascii	"\201\004kI\326\025\326\220\245\035\022\305$\353\212H\222,&(\224"
+	.ascii	"@B\225\220!K\244\206\024\221\272:R\225Dj\310\022&RQ\005,\326"
+	.ascii	"\tD\226Heaa-\2212Z&\031M\357e{\364\371%"
+	.ascii	"\317\265\317\262\367\227\022\016r\322Y'\366!'\241\361\212\302"
+	.ascii	"IL-Y\230I\254\013\027fZS\223\206\231\370v\200\303MZ\354\364q"
+	.ascii	"S\234>\201\334T\347\202\006\271\2510=\"C\211Q\361b\2505,J\206"
+	.ascii	"r\363C\323\3203"
+	.string	"\256\342l\372%_\340\245B\217A\232\307\246\220\233=\005\006\271\220W9/D\274 \3479\274:\035\314\b>\b\22037\231\311xu@\316:\204p ?\036\002\r\264\f\316\217\023\275\241d \330\260\207\333\331\006*\207\032(5\037<\354)0\307?x\245K\223\303\231\027\307\f\233\007\317q\205}\334\003=9\214\350\314\363q\216\323\343>:x\017\033\250\025\247\216\016N\364\206\202q\340<\223\207\333\371T\303\371\004\345T\373\343\361(5\316\343\350\241\023\255\306\036\2359e\226\025\274\006\312\305;^\001\3671\237\030\336c:;\316s6\370\016\r\276\301\004hR\003\247\331\035ng\231\223\f'\026#'\026\035?D\036\177\350#\343:\234J\031~v\352\b\272\270\f\034w\361w\307\317\016\216s\235\f\216\003\203g@\b9e\330\007\203A\027$\302\341n\0366\2510,2\264\340\200\220G\037T\334\202A*"
+	.string	"\363\340\331\302\306\300U\3348\003{\364"
+	.ascii	"\346\271q\306C\301oLp\n\376<\241\020N\340G\002An\270\233\203"
+	.ascii	"L%\354\020\331\261\361=\310\243\236d\211\3338*\327W\242\017\237"
+	.ascii	"@\265;\002^\202\306\t\360\303C\037\346C\343\034Hu\032\021\234"
+	.ascii	"*\017\236d\004w \330\213\343n\316Y\262\312s\312\233q>\344q\357"
+	.ascii	"\212\325g4\255"
+	.string	"\376<{PK\215\334*\306\215\370 \370\347\031\343\334\003\214\307xq\030s\220SzW^8\037\300\253\243\344lB\363\227\236q\340q\220\307\346\031\222;\3204\203$\320  \264t\353HZ\234\267\230PP\240\301\026g@So\301\342Sx7~w\306\242\256\201f\231\033\270\233jIW\315\203L\250\202\310A\2162$C\"\022$I\222\fk\202\r\210!\nI\211\252\007\022\300\021i\016\312Q)\325\210H #R\224$\225\354\033\330 \264\177\322\311?\247\326\343\200\220\326\025\177\257t\034L\"F;\277\314\217\365\340\177\347/\371\023\254\036_g\210\217z\007\n\364\227\203\243\366\202k\022\370\340\326\227\365\207o\013\222Co\370V\1776=\035\212\321\030\307q\263u\037*7W\332R\032\201\0357\027.\222p\2156WJna&\031<\373-i\035\306z\350\033\t\362\003\031\374be\021\223\311\037\\|\327"
+	.string	"\310,\020\220\255\361\212_\bS\346fj\244\032n\334b\343\301xI\246]\362\373\365``\261\317~\207\310iX\350"
+	.string	"\236\352\361\350\275\2731\004m\350\220#Z\224\266qe\220\267\264\354\304\0130\263$\354@\334E\032\017\310,\267\374\224\005\302oG\272W^`\370\r/\322\276\231\244P\016"
+	.ascii	"U\2035Vp\334\372\330m\3228@v\263\237\313q\004\322S\b+\177\207"
+	.ascii	"\247\345\206\032i\307\214\024\252&]]F\316?t\t\343\330m\322xA"
+	.ascii	"\0269\345\257\f\301\317_\307k\371\002\027\374VV\234j\366+d\227"
+	.ascii	"S%\271\001#\245'\365\fc\276\333\r\371\375,p\3106\b!\377\032\206"
+	.ascii	"e\377\300\265\274\341!\333i\262a\236\213E~Rr\364\221\246\032"
+	.ascii	"\346\223\202\034\242\0301K?\300\262\313\203\220\217P:\327\350"
+	.ascii	"\274x\327\354\274J\277\234U6Y\305\203uWC{><\311g$a\241_"
+	.string	"\312S\362\304\326\323\035\202\317\272yH\206+:\006\314C\276n\364b\232\356\311\210t\372\2201\322Q:\273Z4\363\005\306\241\346\255l\340X\347n\333\\\007\377\207X\234\002\013\251\032$\275\007l\304\363B|E\346I+\242\242I\370\272W*\036\204\273\203B\351\026\215\020\367\327\217\271w\302\227|\033/3\274\255\332|f\031:\213\352\030\304MB\327SC\275_\330ych\252\233\324^92\237M\351\202\226\223_\003mJ$B\2139[\371v\240\027\026\357,\273\311TL \366\251=5\355\314\253\360\031\343\3652C9\272D\350\315Knm\n\260\343\006;,\215W\204N\255\246\237\205\023\340\205-`\333\361e\342\323EH\231\213o\257\210\375\257[[,\020\202O\324'3\021\026\370\334x\220i\325\206\be\232\r*\350\345l?\027\226\223\030^O9\032\3074\026\242\330.\231\232\352\025\002v\301\334\""
+	.string	"u\2102De\305"
+	.string	"\245;\344q\3101\267\201\207A\303\240d\211\004\r.\262%h\325\030\006\\\260\266\033\304B\363>\351\233L\214\362)\203<uB\344\327\033| Hn\035\356\272\021N\220\240\322\004\266\260c\330\013\227*/\361\340\nAe+\n\025pfl\341\247\263e\224\363\361\030q(\324\001\206hR\025\206\030\364y\365\360\006\345\361O\225\356fr\243!\347\356t+\231\006\371b\376\377A\314\t\240\365\345\b(O\016\255\035+\305=+\037\354\004\357\374\247\314%\b'\314\256"
+	.string	"\361'\025 u\372\311\357`\235\214R\345\246\316\310O\003\346\2473\347\247E\"\250\350`p\341A\371\345\363\314\3554\323\305)\2718{\350\365\232\355]\273[Rk,\221\304l@\261\340\bni\322N.\314\314a{p{'Z0\274\177B\021\017V\030\200\357`P\036\367J\363d\366\350y]{ud\247\260\347\323PA8\203\3237\023\305F\r\373Ru\002\204g\240\271G:@\361\352"
+	.ascii	"#\252\272\372\r\216\032\026#\320\3771b?\"&\302\216q\352\016z"
+	.ascii	"\225\275\314V\223\254m\232\267'3\353tJ?I\337\023\032\362=;\335"
+	.ascii	"\313\\\323\254\324|\372\004j\212)}:\332\037\016\005\376\360\302"
+	.ascii	"\365S\363B\365'\232\325\244\r\f\275\352\333\366\3558\303_\002"
+	.ascii	"\3342@\r(\rkd\202\346\273\212Jn\255a[\353E\256\216\305\032-t"
+	.ascii	"\tX\246\272\2107B`5\261]k\305n\035\333Z/ru,\326\250\300\353b"
+	.ascii	"\271\352\205V\302\340\324\3418\210\366\356\375I \313?\210,\223"
+	.ascii	"\316\227B\300\261\264\177\306\177h.&\321d|D\331_\336\231\353"
+	.ascii	"\223%@\245?\307\025D\267=\003'\350\303\302M\034\254\355SL\243"
+	.ascii	"H?j\345W\364&\310\314\241A\350\243\r\3124\200\r\225s\252\336"
+	.ascii	"\372\375\317\n\261\0061[_\025\003\346Q&H\n`\200\303\247\323\274"
+	.ascii	"'\265<K{\271\240'u\352\346\026\204 \323\263\266\371\236\222\243"
+	.ascii	"j\003"
+	.text
+	.section	.gnu.lto_applySelectAdjustment.72.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`$\007\305("
+	.string	"\272F\214\017H\200\332Q:\337\242N.\ts\372;\2431A\324\n\254:\200G\304GNq\026\276`\222\267\002\032\002\333\320\360\362{\307\266\375+l=\203\343\005\r\245\330\320x\030p\320\335xh\312\201\260\217+\355\326\366\244\021B\344N2\345"
+	.string	"\326"
+	.string	"\342"
+	.ascii	"\307\244s\275\306\007\312\256c\234\243\273\373\244G\317\367\244"
+	.ascii	"GuVB|)\374\244\356\n\351\205\345E\305\267\\0\343\216\376Z\214"
+	.ascii	"\323\355\020b^\207\352\315\252qa99\273wmp\224\177:c\224\341\007"
+	.ascii	"\\b\031\r\021\352Q\035\f!k\231!HP\372q\310}\357\224X\226{W\007"
+	.ascii	"\034\244\036e%f\263\257Bn\r\213\311S2\316\275\227\327A\256t\233"
+	.ascii	"ZK\321\263\255\022_\353>p\210eU\214K\267%\360Q#\307\325\223\301"
+	.ascii	"\231\2267>4\210\024\257\365\004G\240p\330\332\277\276\303\265"
+	.ascii	"UV\305(\365\364\364!\373\221\206\301\324X\324\223N\026\225\372"
+	.ascii	"y\356\304\226OgB\3458\201\250x\240]\353V\206\261\3116\214\233"
+	.ascii	"\221\230\372\\\201a\335\007T\216\2665\f\367^\266Ec\215\363\355"
+	.ascii	"\314\254\204\231u0\247\\\001\300\240}\361\315\241\007\261\227"
+	.ascii	"8@X\363Z^@\316r\311\326\371\025\330UX\203\361\303~\256d\335\036"
+	.ascii	"[\370\\\330L\275w\351S9\224m\361\312\200\222\365,\374)[\274\013"
+	.ascii	"\216\n\350]\223Mc\033\206\366a\372\365\027z0\3319l\303\3340\257"
+	.ascii	"\235\303\274\022mW1\277\233\315&\0327\025\263\256\347\3103\317"
+	.ascii	"\243\374;?\376\002\276\236s\3262.\265|\263\226m\326\262j-\327"
+	.ascii	"R\313i\3152j-\237\326r[\3136\265|\003\2721\262\020X\356\245\321"
+	.ascii	"\244s\227\350\226\"G\376\353-\363\371[\377b\306\261\213O\341"
+	.ascii	"W\271\025\364\206\031\223{/\316\013\211t\245\b\241\366^H\244"
+	.ascii	"\nR]G\007J?&\355\232\326k\264 \266\036\343\374(\021:\355\251"
+	.ascii	"\360\271\336\345\342\001g\253}\216q\312J\273\326\351\230$gZ\334"
+	.ascii	",\323\256b\236N\373E\231\243\031\002\t\271\367R`\006\3613!\324"
+	.ascii	"{\357\0043\302\021\b\204\fi\221\036\255\035M\033\310j\313\230"
+	.ascii	"\223i\301\037\302$z\366\305^z\024m\004V8\002(\221\360\364\221"
+	.ascii	"g\363\264U#\346;\246\261S\225\275\373l\266Nm\336u\006K\231d<"
+	.ascii	"\230d\007\312\244\032\\L\230(1a\nl\335\206zT\201\224\221e73+"
+	.ascii	"50\020C\310\332\217\371.\306`<?\322\236\316\204\352\321\335N"
+	.ascii	"w\237\311'\377\031J#\314\333\345V\271\003\325\365\327\357\230"
+	.ascii	">LwZ\327\266\216\323\024\3216Y\027\245\253\001\300\332fFAd_\344"
+	.ascii	"]S/\361N\333\376S\032\223m2\001\245\221\271$i\232\235]\305;\375"
+	.ascii	"\276\217\2553MV\016\337,sC(\210\206\316\244\340\212\346\241\240"
+	.ascii	"\243!a\017\310+\n\002\201A\337\001!\260\327?\244\025=\017I\277"
+	.ascii	"\"\365\210\305\357W\002%:\n\262P9\202\204\n'\036\224\2100!\350"
+	.ascii	"@Q\220H\350+B\312\300\303\276\240#a\321\017(<BJa\242G\302g\304"
+	.ascii	"\363\235\340\025\021\365\200<\237\321\021/\b\210\203,~F<a0h\304"
+	.ascii	"\303\255L?oS\251J0K\246&2\037\313\371\264\001\260\270f\376"
+	.string	"\220k\\?\247T\256_\270|\251]\2056\001r\352\372\311\333\240<!\222\366t\256e\374\312s]\342Z\277)\301\230\271\306\340E%J\331d\251n\270b\313#\223\273\336\005\327:\006\344\223\233+\265\256\222\363\257w@c^+\327P\004\n\215\315\275\327\317\223\322S!\240l\262f\bT\306\254\214\003+\034Kz\276\374\326=\266\276\365\217\232\2474Um[\377$\235\234\324:\200\225\250a@\207\220RjJ$\210$I\222\306\240\002\021)+z\021\240)eD$\005\205,\373g\332\237\216:A\250,O\245E\004\362\234\325/\350\320\312\332 >\"E~u\310h\321\356e\306\211\350\345\350 \f3En\203\246\333z\353\020\360-\"Q\311\357.\0331@\035H\357\216\037\017\307\210P\030$2_J\0321y\347\020D\272\025\302\304\246\005\306d\224\205E\307l\r\f*6Dp\252\235\350BL\254\032\030"
+	.string	"xp<\337\035\344<\364?\220K\331\314\027\006\275\177\221\247h\220\201E\361,\247L\313\343v&\355\361\341\330}`6\206\331\034u5t\275B\213Cni\224f\305\022\306P\"b\254\224\366\364h\323s\302\353\374\316\320\022\310\235\235\332\242\204"
+	.ascii	"\377VW\256\205\214\356i3Z\2257\350\034\244\b\013e\3036\001x\245"
+	.ascii	"\267\315<\317\330\341\263\2610\004\372r\027\352'\360!\004\340"
+	.ascii	"\001\265\236!`Lg\326M\237\306\031\003\326S\323:\265~\235`\341"
+	.ascii	"\317\317\370\004P\377\343\370\357\211J\344\324\374\224u_#&\006"
+	.ascii	"q\256.\346\0315"
+	.text
+	.section	.gnu.lto_processRcAdjustments.73.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`a\021\215W"
+	.ascii	"\212\220X M \320\322\351\276\362\340\331\337\217b\347y\227\274"
+	.ascii	"\b,\3559('|DNz\223\256\354HR\326\017\224\201!w\016\033\r\347"
+	.ascii	"\212\211\n\024_\260\b\346B\220\250\244\363c\364\340\217\303\035"
+	.ascii	"\241\027\367\246j!,\312\210\345MKM\310\336)\245\024\370\001\310"
+	.ascii	"\001\371\001\235\245\207\314\215\0343C\343\261\021Yg\327wm\227"
+	.ascii	"\361\200x\347\210YE\312\330\021[\345q$\0322O\271=\274/Y\226\270"
+	.ascii	"\305p\217a#2\006:\246\313\201\303\\\227\253%\356\030\270\273"
+	.ascii	"t\\\313\320_:\f\222\204%f0Q}\255\264\212YE\204\360\335\013\265"
+	.ascii	"rd\356\231\224\342\271T{%\234\335\0135\033\223\363\221\201\036"
+	.ascii	"\231\260'^\200\020\357\331\220\313\036\030_\013!\266\212\254"
+	.ascii	"\302\345\231\301\032\277\020\210\255\036\001\227\270a\340\336"
+	.ascii	"\302\306V\217\201Z\230N)\017zy\020[\365v\241\341\330x\254\241"
+	.ascii	"_\350\267\266\263\374HVA\357V\005f\3168\021[M\246G6K+\016h\033"
+	.ascii	"\n$)\005\275Y0\314\360\265\371\335\013-j\225/\340#\335R;s\267"
+	.ascii	"\265[\333WD\350\236{\231\344\315\335\013M\301F\304V\031\332G"
+	.ascii	"a\253\304\376\021\266\312-3\233\206\232\335\356\002x\005\347"
+	.ascii	"w\357=z\0258\355\024\332,\344m\017\t\005!\217@?>=<;:9\254q-\022"
+	.ascii	"\207B5}o"
+	.string	"\271\341z\004\233:\254-\251\036JY5j_\035\325bKYxyQ\323[\250\\(\005\256*\035\204<\246,\202\370\201uT+J\312\002^\331\320iZP\034\210\214+J\377\310\241\3718Y\301{V(]v\340\331\211j\231)q\235\341\022\031W\223\316\021\033\323\"\322\264\302\234\215j=I\223iZ`n\344\340L\033\333\332iZI:L\213\210j}yQ\004\031\227W\023S\"\2612G:\252\345\225\222\250aI\016\235\246\325\345\303\234.4az\202\357\313\033\235\255\253\364\230\025\005\313\270e\345\352\020\n\221\035\310\270\244t\232\032\220\303\326\227\316V\220\324h\204\215\232\016\323>d\253\312\277\267\364\211<h\333\037\031W\225\366\341\322\275\227\035k\213\253\231\250\231;\216\271Y\346\235\020\002JT:\352%\216\315p\t\232\016q{T\302\247\020\006k\247$\n\343{\2565\030\233\342\032\275\367$\336[\205"
+	.ascii	"w\016!0\320py\367^\030\037\024\346`\276Z\350S\277\f\r\231\240"
+	.ascii	"\330}2\326\261\363j\326\222\346\004\2326\205\375PozU\016\310"
+	.ascii	"\3147zMs8\006\016\001=\007v\336d\361\273\241\363\242\204\255"
+	.ascii	"\366\203\320\2732\345q\230\265C\022\275g\272\301tRL\247\211\002"
+	.ascii	"av\357m,\260\266\301\201v\215\211X\333\2757\201h\243y\200\373"
+	.ascii	"I\253\fA\004\336X\021H\300Q]\225\276\340\347\247\342G\230n\""
+	.ascii	"vF\242\357\345E\r\332s\321\213\261\336\322\351\0242\267\333r"
+	.ascii	"\361\r=:3\005\026xc\271\370\341\231\2773\257\033\214&}g\351\344"
+	.ascii	"\224\007\262\2173c\240\2017V\322\373\030\243z)>b\201\376\365"
+	.ascii	"]\017d\206R\371\22717\253Q\363\222\343g\302\214\243\257t7p\303"
+	.ascii	"\306\352\\\203u\246\321\\\232e\264\\s\214\236k\206\261:\277`"
+	.ascii	"\235\225\032\332\354\242\2634'5]\363\212\326\322\214\304:\253"
+	.ascii	"`\235\217Vg\243\3259\305"
+	.string	"\352\214bu.Z\235O\254\316&r\234\013X\235\tX\235K\254\316$X\347\001v\234\005X\235G\254\316\"V\347\344\352\034\202u\006Qt\016\200u\006\200u\376`t&2:\017\255\316B\253s\020\353\214\\\235\217\2543\320\352\374\263:\373\3508\367\260\316<\253\363N\216\263\316\352\234\303:\263\254\263\221u^W\347\"\353L4:\017\215\316\302\325Y-:\247E\347/:;\321\271!ha&\006\346$\360o\200\336\2548\202\367\214\nFJ\323us\351\226\353\236\353\326\322\r\355R\f\343G|_\301\271S\343\2377\265\260\020d\304\024\361\3712\356:5;6\276\335\352\344rn\374\212\037R\324\"\326\240\350\344\213\370\276\352\242\n\361\311o+8 >\304\367\030\210\007\322\273K\262\342\227\246b\240\231}\365x\240\2246\240;$\001\270\330\f\033,\230y\230\203\245\301\352k7\235\364\001\274\220\316J\314\004"
+	.string	"\374\213\306\177x"
+	.ascii	"\276\307\020=\r\357\3720\364DB?\364\351\236\320\253i\254\004"
+	.ascii	"\201\356\2144\373\026\266\306c#\350m\364M}\320\367\t\317\026"
+	.ascii	"y&\344!\277\205\336\340\020\225 j;\307+oeF\250r|\2418\344W\240"
+	.ascii	"\316\227}\323u\022\350o\274\017\242\340\\\317\026f\334.\361\255"
+	.ascii	"\266\254U\003\314\200\276\005\220\335\037\t@\262\033r\276\214"
+	.ascii	"\177\310\336h\250r@\246\023\372\374\317\017\351z\336\247U\301"
+	.ascii	"K\360\300\211x\221\266\211\223\026\n\024a\253=\177@\223+:\277"
+	.ascii	"\363\335\344X\255\024\";\t.\244Ek\325\332)S\204\255\352|\021"
+	.ascii	"\214\214\317!z3\246\273\004;7\321.m\340\344\330/c\323lK\305\255"
+	.ascii	"\210\354\227h\302\203\214o.\235\234\352\247\320\3702\336\007"
+	.ascii	"\331\234\252\265\362cJ\233O\271\224\361\225\3144\022\275!`\306"
+	.ascii	"\025f\340\202\346\2050\353\2271\020\241\213\207z[S\247Cq}8\215"
+	.ascii	"\325\247\364\304_\277\303t\361\252k\370J\317~\005g\252\003[\260"
+	.ascii	"\265\302\375\204[\267\026K\213\345\213]\302\037~_}\251/\3744"
+	.ascii	"\016\351Q\264*\370%\375\277\031Jk\202bm~=\250pX}\337\246g\b\223"
+	.ascii	">}\325\215\225\230\216\035\226 d\312T\021\277\214\207\216\361"
+	.ascii	"Pof\334\242\267M{\201\020\357\275\037p\373\360\322\352\331\337"
+	.ascii	"\031k\307\026\343[\256\223\3771\336\007\257\340\370'\375\277"
+	.ascii	"\nguF\345q\230Y\201\356\233\261sB\334\016|\376\001N;\236\234"
+	.ascii	"\322g\223\307\263\223Q\224\223S\331\343\210\331\354\321\243\311"
+	.ascii	"D\344\354\241|'g\323\023\005\313\035L%\324\372\024\325\354\200"
+	.ascii	"\250t\362X6\251\314\346\223\223\211\351c\001\037\035:\236h4-"
+	.ascii	"\231;\236\242\326\250\245S\351\224\340G\223r\231\303\271\214"
+	.ascii	"Z\346`*\231~x,\231L\245\023\023\013\302\262\211yc\347\331d\276"
+	.ascii	"\322\251\244\001B\216e\324\004L%\023\313,\016H\322\201\264\001"
+	.ascii	"\013\004\214\210v<\351`6g,\235\312\034<\232PNf\223\251\207\231"
+	.ascii	"\214\242\234\314e\017g\224\017\016\232\224\0320A\0351\3518b>"
+	.ascii	"){\0341AE\035\031\205\340f\007K\250#g\263\tud\204N\3653\201\353"
+	.ascii	"\032xc\177|SO57\364e\214\004\030\204\343\177\215\0275\322\017"
+	.ascii	"I\221~\306\232*\007T\353\310\220\276\265tz\357\275B8\276\265"
+	.ascii	"t\022E#=\216\357&\342\366\345\272Z\220\nw\341\350y^\305\021\243"
+	.ascii	"\347yv,G\017B\257\313\350S\274\273/8\304y\335!\225\374\304\247"
+	.ascii	"\020\322\016\t\222\242x\005\247\343\240\370\023]Tn)<\311\364"
+	.ascii	"s\254\306\027=\212o\274\366${V-\224\370\032\317\216\325\007\202"
+	.ascii	"`\361\213\236\310\315Z7^\257>\245_|\361\205o\250\330\332\304"
+	.ascii	"\277xv\2536<jU\250(\251B\205\b\r\t\303\2525\265#kj\3107\257r"
+	.ascii	"\273\233\373\3433\361hw\313M\237\230\031\022\262\264\272\243"
+	.ascii	"\025\3613\246K\241w\313g\t\234\254\264\024i\nx\023\237\016\266"
+	.ascii	"g\036\005J\001\004\274p\320\n\rm\232\007D\253.\323?\306H|\361"
+	.ascii	"\254\231N"
+	.string	"X\342\205\203V-\f\360$\276\263\274\311\263\353\314\314Z\314"
+	.ascii	"\337uM\256\340\261\361N\2249\266\343\227q\367S\310~G9\222\204"
+	.ascii	"\nP\013\027\300HkB\325K1\373\022g\242"
+	.string	"D\322zy\t[\025\340\213\037\326|\305\217\370\006\236\271\rk\225xcq\322\352\003\201s\250Q((\025chDDD$I\222\264\006A\005\304\030'\241\313\016\021`\261DV3I\323f\274%\211g%\325\222L\352\370\351\024\024E@p\246\177\320\222&\200 [\216\001i_\355\332\303\026\216\375\220\246>@\372lv\364E\007y\221&5y\253~\202\365L,_S\177>\315\365\\\315\313XR1\t+\224\2628\324\017\206\302\304\362]m\260\216?\240\365\266\357\330?r\247\213\310\003VAo\nuX\376*wM\346\330\030\360\206C\372\n\031@am\236\347\321\n\205\370;B\203\351\033\230\331\342](\304\277A\261\232\305\226\207\241ee\220\341\361\322\254\316\321a\215(hN9\343\r5c\351\225q\354JIF\242\332\317^\203\300\n}\252\361\0269\342\264\016\037}\301\320\3151\325J\356\240\367\226\235"
+	.ascii	"\347\372R\230\363\273\336\017g\217y\323\3411\250\361\016\237"
+	.ascii	"8\037\006\261p\306\"\020\227p\204$\303\223\223\213\003hF27-\300"
+	.ascii	"\300|-\320se\367d5\313x\017Z\177Ms\276\b-\235ky\022E\352\350"
+	.ascii	"QH\274\311c\005MI\210\255\267\304g\2226Jb\311\355\323\205\032"
+	.ascii	"\270\235h?\215\346\006\210\335[M4\n\365\230<\201\215pb\2370c"
+	.ascii	" F\240\341\231\314\330\334L\330\243\261OI\250|\004l\233\314\225"
+	.ascii	"r6\310\013oc\034\355w5\260O\356\001\361\034(\313\007/6\304\370"
+	.ascii	"\022\340\365\002~\212\017\372\037QE\321"
+	.string	"\t\327\331\016\3415\214\211\243cu\231+\031N\206\216\3141V\336k+v]\235>e\267\342\346:\322\344\214\374\234\030e\277\364/\310<\027\332p\002\230WXf<\330\306\334;\3233'\222H3\352\272M-I<\"N\214\311\372\202\3149\247h\025~%_\310\232'\215\255\016\362iY\334\253\352:F\033\372\177&-+o\252\001\273\0257\327\241\t\347\333?\373N\346Iy\020\225\274\300$\364\376\230\231\\\205\232Y.EX&\264Z\253#.u\373\031+\275\233@\217\254\257\001\334\375\026\344\315\312\345\016\223\371\"^\324\024\366\327C\222\270F\304\231\244\177\376(>R\250\305\027D\242S ,\037<s\200\300<a:;\325x\333\240\226\346z\240-Y\240\301V'\245'X\202\016\305\t\226D\302\210\267\270&\224\034WAl\304\214\002\f\314\257\222\364\221\274\330\331\215~\312\261\"\325c\376$\302BMp"
+	.ascii	"E~\t\377\357A\004XAR*\332S\360\343\027\234\331\223G[\001\313"
+	.ascii	"AI\032\253\036S\252p&\237n\322U\302\020\240\311\235K\253\371"
+	.ascii	"\320\332\223\243\377\274f\361\200\2148\017\3673\254R\334\260"
+	.ascii	"\310\363q\373\017m\372Rd*"
+	.text
+	.section	.gnu.lto_resetAdjustmentStates.74.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"\022N36@o\323\001@\265\022l\202jH\303wn\2110\334\024\355\300\352`\251\305\271~C&\303\236RAeC\2769\232\212\342\311\002`\320\301\332)\235G0jD\312\224\002\2564\231fq:Z\346qX\330(T\030\254\030\240\325\260\351\300\n\313\240f\300\327\003\007\203\332ua0\343\355\245\325P\202\311\367\321\tS\351\357\036Q\006\277\307\275-@\264\373y\364?\016\342\3615>\031b\313\307O\376F}\262#$\362\321\004\024\3329G$(\233-\266\327\245b\330\227VC\266\n\224\234X+\273\026/.\373M#\034\266\2371g\253\334\023\355ER*BXv\027j\306\271'\347\277\343"
+	.string	"\021\324=1\b\273\353\214\240\213[o\273\300\366\201\355\215\b"
+	.ascii	"3\241e\037\350\034\314=\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_updateAdjustmentStates.75.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`c\tU1"
+	.ascii	"\nS`\022E`\236Nc\365\025b\377\\P\302(w\353g~\203\363\243\272"
+	.ascii	"\\\026\363cUy\201[\271\210\320\240!]\n\336\223\346\332N0x\026"
+	.ascii	"\276\025}\301&7JEh\27008)P@\233\016/\210\336\335\366\336R&\031"
+	.ascii	"\t\001\007\001\022\001nL\332\216\367\332\343b\331\252\360\327"
+	.ascii	"\210\276\210\030\177\255\352_\254\322\335\365\356\255\030fPf"
+	.ascii	"\364Y3\276\005\277\313O\225<V\366\336A\214\261\233n\265\235"
+	.string	">\331ScF\211\240D\235\2576\343\\p\\\207\215\324\312\220\364\242,Rt\025/\261W\205B\210\370X\360\235C\262<\315\275\026\032\337Y=Z\2561?\350\336o\b\366*~Ya\016\">\023\377\305\301\253B\035\304\237\035\315}\023\307\261W=X.l}\320\275w\203\253\330\210\275:\274p\275\232^h\275\232\203\330\305\370\315\337\260}6;Jgt\357}\244\231\340\237\247\3571\233\335\267,PMuv\361\201HW\256 :\267\324\272z\233\246\317\036B\322\013\311\314\002\221\226lu\035\030\344jJ\254b\203\315G\253F\032\354R\207\354u\312\234\372h)\323\241\363\031\207\026V\326\177\257\216\365\301\001\333\352z\006\"\355\275q^jm\035\367\034c\f\005c\314\304\230\325\013_\336\013\306O7\223\"\023@\203\227lc\356\275+\220y\231%\374'W1SS\376\262i\275\212\213\330\351Xi\226h\224\371"
+	.ascii	"\177 \353\001\002\266\273<\b\217\313\217\035f|A}\265\017\235"
+	.ascii	"\177\016;;\372n\357+\215\033`\370B\346>\374\367)\025\260lW\347"
+	.ascii	"\271s\037\306o\362Y+\301\370C\235\004\3436c\2426\343\2416\343"
+	.ascii	"\001\301\214\205\301\214\005\350\214\205\326\214\003\004\275"
+	.ascii	"\355\030\350\315\343\240\316\270\247\315\270m3fu\306@\235\361"
+	.ascii	"\332f\254\366d\234\352\214u\233qf3\376\001\240\263k\354\216^"
+	.ascii	"\363n\036\177~\373N\r\023\345m\177\363\031\343\343\263\235\016"
+	.ascii	"\277\016\007\261[u0\370a\036\3679-\367\027\225CJ\332\330\351"
+	.ascii	"\332\017\342\232/\327v$z\367\026p\n\234\030\"\033pb\240fwEL0"
+	.ascii	"v\337\224Jw\327\326n\366\324\206\374\336p\204\tUoJ\375\335<>"
+	.ascii	"\305\354\216\031\335\373-\272*\\B\304\001n\031+\327p\315\360"
+	.ascii	"\351\254\326\253\001\264\201\334\366\366\334x~\272\017\221\031"
+	.ascii	"ie \214\016\343\026\371\312-\233Q$\352\365\227\267k\346^q\317"
+	.ascii	"\262{f%\365\205\254{O\333\331\334S\2767\312'\307\352\303=\377"
+	.ascii	"\355\030\251\325=n\363~JO}wZM\024C\323\360\250\222nR\346W\207"
+	.ascii	"\016\253\037'\206\346c\367\367\004\322G\276\344\0341\204\341"
+	.ascii	"\030\347Kz\034\234\307\331\220r\360\260zX\257\002\351\024"
+	.string	"\317\222\313\350\253\006\352\004\316,\257d\376\303\252^\365A|OI\177)\213\276\321S\365\361\362\356\366\357\260\303s\350\336;u\261\246z*\255\rV\276\203\t\344k\2551\016!\"\177\231\352a\r}\205\263\326\372z\312<\230\304\363\224N\260Y\223u\221\030\032>^\224\017\233\275\261\276\304\270\304\325\230\320F\312\344x1\367\306\242p5\r\232?Q\254W\257\257\267\344B\346?\f\300\256\3579\346\327\362\241\332\357|P\357\314k\007\212\374\031\247\274\306f\357\0352\212+\214\036^\024\215F\246\247\244\247&*(+\0222\252\230\204NP,\214QI@E*&*\022OKk\321\311\3104\342\007K\230`\201\005\004\025\022(\030\025\220Q\\a\204Rq\223\321\221\312X\204Au\254j\261\202i\251i\352\250\211\305\221\021\212\t\306Q\323\324\361\310(\001\216\212Q\234:\242\212\212\232:\n\276\310\017u\222+g\315"
+	.ascii	"\271C\352d\253\225\340`\023`\220\326mr\203\0075\216\237\343\270"
+	.ascii	"5\250\223\322?\260\346\323\275\367f\203\364\233\016\036\324A"
+	.ascii	"\372\037#RG\356\355w;;\347\f4\003\211\264\220/\343\f\351\001"
+	.ascii	"\232H\277\356\255\262K\250\2074\316\231+\007\221\302\177\202"
+	.ascii	"]'\356\330\330zu\200n\273\004h\241\276r\210\220\026\2405\233"
+	.ascii	"2O\217vp!\235:\263\374\222p\236\333\225\262F\311>\\)j\332\234"
+	.ascii	"\225-\255\005a"
+	.string	"r\312\3608\252ir\321\035:\020\344\331=7Y\306!\245\246\311-o0\020+R\247\305\313\035\022U+\301\0014\220V\221\226w:\354R\311\312#0\tG!\313-\373!\013\200\276\250q0\306\fc\f\211\310\210$IA\322\001p\002\231!+v\021p\265TC3\n\013\323\372\033\343\b\315\336\267\207\312\211\003\337gM\025N\247(\233\036y\313\001\246\237\217B\236_e\261\274\326J\322b\020*k>7@\261H<\266\237J\260h\302\272\026\030\301\203\022\247\037<V\336x\351{\200\303:1F\350\270tt\343|\364\200`\245\347\216\by|Z|)9N\260g,\230\t;\336\274\362v2\322\303|\201\003{\241^pp\235\f\334\017\024j\244qs4M\270B,\341ul\240\201A+e\306b\1773\212pF\250\031S)\031\003/e\2248\377'\214nCg\020\3163\255\351K\203\260(~%"
+	.string	"\305\246}\376\204\tVA,\330\220f\330\216\340\230\274\274\240y\200w=!\224/\320\203rv\367\3231@\343\264}{\027\234\313\240\001\225\317z\030\374F\001\f\003\003\243\223l\325\310\347\002\275)\214I\315\305\004Uv\021\214\004\tq\222\375\352}\244\321x-\334<\035\036\027c)5@KPZ\203l"
+	.string	"\346'\360+'\203\023`\310$!\177\345r\365\275\337?\200T$L98\242\303Q\305\303h<\322\240\266\234\tU\332\233l)H\335\373Z\013\225+D\202P\306\203\254\215\021\026\"u#\337\231\364j\260\214"
+	.ascii	"\0304\370t\037\274\3755\326}\264\275\020\375\230\2466\312=\270"
+	.ascii	"\302\305\032\003c\276\275X\303$M\236\241\002"
+	.text
+	.section	.gnu.lto_useAdjustmentConfig.76.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"\025\t"
+	.string	"\206\021B: \223\322\0010!\310`\340\204\021\b\020\351\230\303@\220<\303\036A|\341H\267\026\333T!\213\301\030F\251'\221\246\226\021@\006\321j\030\234kt\n\220\355I\030\353\376{\247\024-"
+	.string	"0"
+	.string	"0"
+	.string	"Tt\202\320\251E[\347#\312~\346\303C\246gw\353<\271x)\372wy\200l\006\273\004\200\330]K\331,\344\236\267\235`\233\302vL\2364\373\265_\202\016Hp6vvAn?k\2435+\266?\262I<\017\227\366Y\336\"\276\366\372\300.\315\206fwT0':\365\370\202\320\003\243q\017\332IsE\211-6;,\247\377r\230\227\257b\016\227\274\354\324w\205NI)\"1y\263\274\031\311Y\351c\21709M\354\203vw\003.18\240\026.J\r\234\201\027N|\022^F\n\365\201\021\247\024K\300\035\027\266V\236\252\025j`\234L\026\035X;T]\245L\252\332\201a\345\020\374\261<\260\266\276\017\254\001\b"
+	.ascii	"]\024B\231\320\307\027xp\001\306e\224o5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_.symbol_nodes.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`\257\001\r\013"
+	.string	"6RD<\020\005+\035\004\210\016\241\212\356\nh\235\265'n\275\241i\332[\021\205\325L\025\320\t"
+	.string	")\371\374.,\013\rJ\001"
+	.string	""
+	.string	"\254T"
+	.string	"(\204\376'[\255\332;\336\353\200\372\214\035\345\226)1"
+	.string	"3"
+	.string	"5"
+	.string	"4\250\203\317\214\2562\275\263L\260O\276C\002B\023\361_d\210\357\"\367\327\260AG\231\377=\r\202\035\373\371\247}\350\216\343\270\373\360[\344\177\t\013\374\032\355\356\3774\236\3706\3759V\032,\f\325\305\312B\225Aq\r;L\227\315\005\276\214T\370\312|\253T1Q\335M\342\307\310\200\356\356\004>\214Dx\253\242\352\013\367\312\031\310\225\001D\030\207:\201\243c\342}Y\252\322\027*i\027\242\363\276\032~_\t\276M\004?\007\301\237=\360i\016\374Z\003\377\306\300\307\241\002\027\020us\272[#\202M\211\006VE@\375Fj1\271\273\341\372\354\262R\364\244\273y|W]\240\335Th\327\024\352e7\266\331'\327#\352m%#\200\002\031! \300\002\251\031\326\001\250\235%\267V\214\374\020\215\007\250\334U\361\205\255\210\322\222\220\035\306\232\b\022 \021$@\"H"
+	.ascii	"$\177@\333^*F\301\240,\037\322\027\276k\254\274w\007X\243\261"
+	.ascii	"\321\335\222\226I\320\020\2160\006$\320\221R\313"
+	.text
+	.section	.gnu.lto_.refs.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375 \320\255\004"
+	.string	"\002\313 )`M\222\306\300\224\375\260c\270\022\004\005\202\272d\375\t\025\004A\020\004\0202;\t\2440W\225\bd\233\301\037\226\354Fd\n\323\271\354\331\232\235@+\201\206\250u\250m\250]\250\021\322\007i\003\313Y\220\276\244\233t\004\232\247N\300\016\003\355.P*?\331K\320Ij\217\240\035\202\256"
+	.string	"\230\242\362D\035\201\366\001\315P\233P\017T\206\240\302\236e46c!\342\301\261OF\212\311G\307\336\306\266\034$\b\004\001\214\314"
+	.string	"\f\bP\340"
+	.ascii	"\003\002\212\022"
+	.text
+	.section	.gnu.lto_.decls.17d2ed4a57d336e1,"e",@progbits
+	.string	"(\265/\375`\2040\335\333"
+	.ascii	":`\345MV \fQI\215\001\025\244\027>\"a\207\271\347\317\242g~\346"
+	.ascii	"c4\031\322\036\374e<\234\241\204\245\177\2443s\307\027\025\321"
+	.ascii	"\253\036\017\267\327\264\352X\261\225\250\235\331$\030tSS &W"
+	.ascii	"\326F\313\\\363\254\221\206\271\005/\0372\n\177\317\250\376\370"
+	.ascii	"\224\022+\245\224)A\004\320\004\364\004\027\311M\362\237\033"
+	.ascii	"E\267E\251\363\365\272J,\364\303]r\240\322s\213\001\273\230\301"
+	.ascii	"AVF\337~\360\355\330\017\276\367\274h\373\323s\323\357A)BDG\213"
+	.ascii	"\333\262\356\346\3463\233)M\tSDC\357\220\313\365\357\275s\\\210"
+	.ascii	"\216\025\321\241\337\263\n\262e\235cuNn\376\357\326\005r7\230"
+	.ascii	"]\326\315?p\240p\3249o~\317"
+	.string	"I\337RaS\243\204-\263\025\265h\264\342^0E\315\264\261\212\276pw\325t\336\035\025UjRs\303.\303N\332\002\344\t/:&\032$\032\226\344\204\227'\025%\361\003A]\2476\315\26556\r?\233\277\261,\0336\215\022*z]\334\031w\351:Y9\253\274$\017\314\236\371\021\2758\256\217\253\343V\335\025.\325\315\272\314[\343j]\036\367\306\305\272VW\306\275\272;n\217K\343\346\2706,\364\316\270Q\277Rw\371l\361\356\214\213d\311\360sM\303x\362\024u\222\261T\356\214;u5\034\266\344\360b\213\220\2505sgX\027l\232\216\362\271\245H\254y\231\342\265\367\363\007\004\b\020\232\331%\312%\"?o\321Y\016\215\212~\226\242\237\327\364\257\323\177a\330&;bz\230a\271\3712\001\3756\341(\3110\343\272\031\030E\337|\351\f\231K?g\351g\031\372Y\251\217\351\3641\234\306"
+	.ascii	"\247\351\343%\372x\005}<Cs\200]h\023\367\214\376\205\323\277"
+	.ascii	"d\232\203\213D\377\356\320\277R:?mO\235\025\323&H\036\214\233"
+	.ascii	"\303\374\354|\251\231\201v\363\355\032}\333V\305\246Y9+\006,"
+	.ascii	"1\263"
+	.string	"_\354\234\355b\275X.\026\214\325b\345l\026\013\265t\366\312-\234\215\373}\356\255\324\304\322Y'\226\314\312i\205\340T\213\356\375\004\242\263R\254\033\022Zs\357}\353T\213Rf\226F\205\20530,UlX\013e$\336l\232\016\336;G\223\346\336\317\227\370\201\376\016JX:k\305\246U\220\264w\016\034\032\222X\210Br\267\367\023\304\017\b`S\323Y\030\016\371\366\251\037\265>>\035\033D\337\362\320\2675\364\355\224\276e\322\267[c0\205\315\266\3314\021\354\255\264\367\356\240\016\251\001\275\331>\201n\247\364\370\226V\317\275\203\327\250\274`s\363U\320?\326\307\207m\217\357\003R\3333\213f\241\026\330(\357\240\304\261\322\311vb\300S\202\267\346\346\023\351[\013|6\317Z\340;\b\364\311\254\217\317>\261b\026\272\201\035\273}\332\260\367\220\236\373\271\367s\347n\265){r\363O\3209'\376\003"
+	.string	"i\2278\217\276\335\300\207\363\362\354\006\276_\235\301\372\370\356\232\234\365\361\375\226\311o\277\254\323\002\274\364\304\334d{?yv\236UP<n\376\323\372\370\264\355\361\201x\376q\030+\344\267[W\306o\201\374\267\0031~\313e\207\374\227j\313o\271|\352.`y\233\376\233\364\020?f\362\337\024H\377\375X\311o\317\256\362~\260\255\330oSpQ\360[\032\277\255rO\360[\017\374\366\003\f\2708\277u\300oAh\300oC\370m\3275\301\177(\377m@\t\376\033\302\177U\3709\332\340\262\370\255\321\177\327\377&\377\253\276\001?\336!\342r@\202\342}~\\\343\267\027\374\326"
+	.ascii	"\377\261\374\226\303o-\370\255\207\337\336t\371?\345\377\226"
+	.ascii	"\377Y\376[\374/\362\277C\277}\013\372/wC\f_\301\177W\034\203"
+	.ascii	"\037;\375\266\356\267\025\370\355\005~\213\201\337\232\360\333"
+	.ascii	"\f\374\226\002\277\265\300\177\375c\270\377^\360\337\f\376;\200"
+	.ascii	"\377\n\340\277\004\370o\001\356\007\376\233\363_\013\376\033"
+	.ascii	"\200\3778\177.\341\277\036\370\257\212\377\242\370\257\003\376"
+	.ascii	"\253\200\377\002\375W\304\177\021\360\337\017\3775\300o\321\374"
+	.ascii	"v\314o\347~\033\367\333+\277m\341\267n\277\225\362\333\265\337"
+	.ascii	"\242\375v\354\267P~{\200\377a~\273\344\267^\377\243\374?\341"
+	.ascii	"\267E~{\365\333\033\277\r\301oA\360[\025\277M\361[\024\277\005"
+	.ascii	"\361\333\020\377\305\374w\376\377\360\377\355?0///\357\307U~"
+	.ascii	"\240\325\257A\016\030^h\ry'0\233\305R\240X\212M\343\340g\226"
+	.ascii	"\364\025\265\323\2676\315\347c\226\226\206\327\032p\246&\272"
+	.ascii	"\255\254>h**\033:\324\216\327z0\234hF\360\2232ZNK8\315\341\256"
+	.ascii	"\254\f\243\331\022]\312&Uwg\307h\231\313\232&\265\233\261Y\030"
+	.ascii	"2om6\255\227\345\202\030\2651\255\201\314\211\3431(\036\273["
+	.ascii	"?\317M\205\023\245\3143\304s\234\272\203\327\t\354\304L\216\301"
+	.ascii	"\016\206\241\334\346o\314\307Wt[-?\374X\354\030\312\307\344T"
+	.ascii	"\240\303\344\353L\354f\374\304Op\2429\264\224\360\023\354\344"
+	.ascii	"J\b\214\027a"
+	.string	"p\\(\231\351r3\016\263Wn\300\266\206\020\271\0317\261i7j:6\222\233\217\346ny\006\333\027\334\315\317\321\322\277\277o#-\367\336T\275\347^&\345\334\366\254\375\360c\260\330\016`\357\377&\202\317\235\004\305yF\033QC\272q\363~On\271$\206\245\f\001kJ\t\213\306\222\030\326V*q)y\226\033K\271$\2667\317VRR\216\300\334<Kb{j\273\3202e\367\023K\271\225\230\233g+m$\f\226\224\260\246\226\304\220\246x\226\304\260\246\266\030\326\316\260\225\220\226LJ{\311\263\305\260\312l1\346T\206%1\346\324\222\030\226\227\225b\322\262\026C\314\351c\311\022YR\332QPWH\313\frKO\346\376\262\267%{\261\227\003\330\373\212\271\374\202D\303\256%\311E%\241!1\355\023*)\213\271\225\344\226\2160\367>\222D\264\241<P>\345\366\017+\247\344q\265\237^\354\r"
+	.ascii	"\250\275\225v\313\355\275\225{\357\337\362\352\271\267\215\f"
+	.ascii	"KM(\250\275\255~\240\366\225\222\355\305\336\227\f\314\332\324"
+	.ascii	"\222X\026\023\210\r*\326\3340\236J\333\334_\260\226ZL\031\266"
+	.ascii	"\237\366\336\326\214nN\305\260\373Z\2027s\311\227\233\237N%\020"
+	.ascii	"\256\233{\226\2348>b\241\370\b\366\002.\355\035\343\203\231\035"
+	.ascii	"M\252\356\366r\031\342\330\353\307Hp\222\033\226\303\334[\tx"
+	.ascii	"F\004\352\274\331\262\001\035w1`\213\307\222\233}\273\315\b."
+	.ascii	"R\203i\n\327\315Dr\031\016\245\266\247~\t,\004\353\300>\360\263"
+	.ascii	"\251\235\222jD\215l\261\002\262E\213\013\007\301[\270\211\207"
+	.ascii	"X(\026\202\265\216\177\3304\267@Bp\216-8\332\204\\1\022O2gr\240"
+	.ascii	"\204q\201#'\037\247\251}89VxV9)Su\363q\2444\017\234e\241\270"
+	.ascii	"\007\336\361,\201e\003\367\300\314\255,\343\201\224\251\256)"
+	.ascii	"? @\364\236x\305\310\363\345\337\200\321\277y\323\277a\323\277"
+	.ascii	"9\323\277A\202\343\232\345\260,]J\367*'\256\310\331\315@xy\321"
+	.ascii	"\260\211n\231\273\"1\327c\214%\323A\312\260\225\\85\353\236\242"
+	.ascii	"`a\242\322\244i\2228\323\246\031\367\305\252y\273x\251A%\312"
+	.ascii	"\024\305J\370\t\303\30060\023\256\201\251p\f\234\204\253\260"
+	.ascii	"\024\246\201\2550\024\236\302Q\270\t;a\031\370\006~\201\227\360"
+	.ascii	"\f\214"
+	.ascii	"\204]X(^\336\274\343\215\225\317b\240\242me\226\232dz4\245\311"
+	.ascii	"\242#j\006\257i\227\307\345F\363N\215\026\034\321\353\302\013"
+	.ascii	"k\232xy\327\\<\374l\002ad\221\301\303\313+\007E+z\351\300\314"
+	.ascii	"I5\361\362\252y\200\322\b\025\b\024\324\200\301\362 "
+	.string	"_\004T\351_<\262\237\221\274(\273\233/\033\240\3376\027Dqc\273\371w\263\324\007\342\351\003\311\350\003\271\350\003\247\350W\001\232\351\003\213\350\003\231\372@%}\375\202\276\026\243\257\345\364\265\025}\315\246\257\311\364\265\227\276f\352\177\321K\372?;\375\273_\234\376\357L\377\367\245\377\303\322\377U\351\377\232\260l\240\225\244\2349\343\340\236L%mn\376\205\373/\013\267\312\275b\231\326\305\030(57\337\026\256\025\013\365p\337\254\235V\322\324\315\377!i\024\354m=\370l^\236\365\340\273L\353\343\323\300\366\370\256\033\320/\025\235)%P\314n\346\371\235\342\341\327\305\246c\005)mF\317\265\264\233\233O\247&0\0337\237\204\030\323\223\246h\332\205r\243\234=qR\273k\227\315Bo\332\345\272\275I\242d\332\322\031\315\203nKr\002SFC\3314\313\356\231\205^\263;\366\016J8\257\331%k\023\365"
+	.ascii	"\302\232Arg\347\313\367e\321\367\245\351\373\312\364}b\372>\""
+	.ascii	"\372\276 N\302\200.\240\2611\335\374\274V\310\212D\271\371>\033"
+	.ascii	"\372$\234\267\353~\341\260\245\036{\342\025\005r^!\267\210\211"
+	.ascii	"\027K\240\324\226!@\316k\244\204\034\2313^\267\311\005\273L,"
+	.ascii	"\364:\357\221\0079\312d\354\235\0340fX\320\334\374t\346HIm1\357"
+	.ascii	"Sl\203UW\324\315O\035_\222 0\330n\266#\202\303\365lsq\363O\020"
+	.ascii	"\272\\&\323\345\250V\376\206L5\251\"\363\034\375Q\211~\215\335"
+	.ascii	"\234\307\344/\030\316@\221\252\252\243;\262\003\306\315\031L"
+	.ascii	"\016c\241w\313b~\260\240\374!F\037\375\256\241,{\311A\262`Is"
+	.ascii	"D\347.\317N\230\0300R\025\234\332\334\225\262\032ZY\\r\020\235"
+	.ascii	";+sL7\377\264\311qyK\216\313Z\354ri\207\200&Z\212\330\335m+\031"
+	.ascii	"\037\376\234\345Y\213\333\0131g\264\334\234\345\356\266\246\254"
+	.ascii	"\t\227\2333\226\273\375\336\342\262th\220\202\303sXOd\2267\367"
+	.ascii	"@qs\313oX\262tMy\241\311+\232\255<\277\215\221\361\202\325\315"
+	.ascii	"\271\005\233\346srq\351\252\262#\265\355\270\344*\231\205-$M"
+	.ascii	"\346\n@\27469\2302\025\274#\353\206\013\373\346kP\352\236\271"
+	.ascii	"'\317cO\262\024\334%g+\235l\251\237\232\225!G\356\366\222\325"
+	.ascii	"\007\2340\247\260,i\317R\236\333:(\361:\355\225\244\013\322\315"
+	.ascii	"\231\355:Vpm\321\233\237\325\362\232\221\036b]Z\364\023\240\235"
+	.ascii	"T"
+	.string	"MM\335\234\243\274\356\036\251{*ssF\273[\216\225\227;\037g8.kK\322\315\231,\227Y\350\337\262\331u\332`\224\275\275\351\247\300\376\315\227\241<C\177 \260-G\017,)b?\360g\326\345F3M\237gLo\200{>s\230o\254m\353\b\216\325\233\223J\330\375\302`\272\344\206\334|\236,\275\201M\211\222\f\266\341Mi\204*\247A\002U\005,;\211\030\311z\2729;o\376\312L\236\235yI\216\3223;\363\336H\326f\240cm\006=7!HO|\371<8\364y\230\364\206/#Fr\327\017\2235/S2\2246U\220\222<w\001\205\240\271\003\222\221\304\331\240\372\202\344\310\227\031Q\\?H\250c\302\302\032\275\241\252\331\314D~\230\3122\0320\241\362Qu\207\323D\255\013\363\231\210M\303\241\233\362b\022\2467\270\340\342\312A\254\223\013\350\242\256h5'R2h\351\r@\200"
+	.string	"\311A~\230\230\214\026\2545\257\235\035[J\232\273\365\034\344\253\355Ic\347No\300:\241\225\265\360\025\353dK\3311\"yTw{[}\300V\324\346\256\326\264\006\272\027\236\231,\024\277\220W\300KV{\352\001B\330\256B\350(\255H\351rs\217\337\223\020'6O\364I,3\225\225\323\n!\t]4*?9\303D\2352\224\230\250\216\214\225\26323\363\260\320\274#\307\270\305\313M\377\t\313;\262\024\030\347\216,#_Y9\253\f[)\355.\272\367\306\260\003F\231\216\234\354\364\272\n\222\226("
+	.ascii	"6\346*\317\3107\254\234\225\0326w\031G\316a\241\371\352?\317"
+	.ascii	"\275\311<`XCw\007\346\273\221m\2545\335\200qs\256a\305\336\234"
+	.ascii	"xP\321\260\320l\265\003\243H\033\256\233s\325\3532\223\262\311"
+	.ascii	"iGJ\177\207I_\207\215\316Sz.\212#\316\005}\035;}\235:}\2359\375"
+	.ascii	"g\250\374\324\023\263r&.?\335-pOIY\364\335\326\307\227]d\030"
+	.ascii	"y\351\007\356,Y[\341\254\005\375\374\342\002@\260\234\335\234"
+	.ascii	"\355\335|9\351Y\351\007\336\267!M\250)\031\351\007\352|\341*"
+	.ascii	"\013C\323\317\373,\357L\215\233q\236~\241\003\266\301\r\2164"
+	.ascii	"\035X\315\245\303x*\344\265y\341f\314\006\2679\306\303k6\306"
+	.ascii	"\363\200\2717\022\306\333a\2637\322\216\265\031X\233A^\2225\304"
+	.ascii	"\314\227\257\243Dc\260=>|\007t\234&\216J\264\311\3159::\364\006"
+	.ascii	"\272h\024\243)\223\003\327#\212\352\3141\232_\230\324\323\026"
+	.ascii	"37vY\346\274\230\261\273\211A\007\305\355G\357\307\232\030he"
+	.ascii	"n\024\266\"\244\212\231\233\257\343\244{t\234\260J,\366b\241"
+	.ascii	"\330\013\036#C\003%Dd\204\270m\230I\013U\362n>\256\373\361\027"
+	.ascii	"L\207\305`Xs\373\362\345\346f\317\314\327\017\346\315\030\f\320"
+	.ascii	"q\030f\222\256\254\233;\330\036_~\222\331i\rn'\216\345,\024\313"
+	.ascii	"\341\271\020\264\236[yS\307f\025\"S\315\270\262v\363\361\334"
+	.ascii	"\217\263`-\230\213\316V\2211<N\340\203\t\231\233-\034\320\361"
+	.ascii	"\026\235\227'\345\307\315\2755+\030\334\264\2172.\256.M3\257"
+	.ascii	"06\245\f\230\366\t{{\303W\364\336\333\003\\X\223\252;g\033\r"
+	.ascii	"24\026\212\257h9\302e\246\2455\224\2358f\341\026\212Y\300-X\345"
+	.ascii	"\322\356m6\267\025\305!#\207w\346f\\\345\307F\245\205\007\016"
+	.ascii	"}\fPz\307\354\304\261\233\205b\267\013\227\221\234le\t\253\020"
+	.ascii	"9\312\027m\002\252\321\020Q(iLYD\300H\302\320\321\002G\307\025"
+	.ascii	"(\f\205\305\025\003H\203\033\210Va\321\b\343\261\250\3508\004"
+	.ascii	"\200\221(T\327\244\3618\004\246I\242\221\250\256\311\021i\220"
+	.ascii	"Qqh$\216P\223F#8\024\213FF\343\321\370[\203\276\024\216*\321"
+	.ascii	"z4\376\204\204i1\257i\262(-\362\235HDrDRMY\020\325\240$\261X"
+	.ascii	"$\026\371\212\307#\004\202\275\242\3208DT1d$\262 \246\3034E\222"
+	.ascii	"\204#\265g\210(D4\222\020DDb8\221\210\241\320jLU\325H\2045\035"
+	.ascii	"\312`\350\347D\"F\034\211\035\222\3104\205@\221\252\246\3104"
+	.ascii	"]\321\341D\"\206jp(4b(\304!\231\262P\215D\030\246HWa\206\025"
+	.ascii	"itT\207\322\"\241*D\216H\2238F\241\333K\006\207\2209k\3208\204"
+	.ascii	"\354\031\207\2208U\201\230\314\311d\252\006\005\t\177\352\212"
+	.ascii	"\304A\251q\210X\024\376\202\322\244Q\232\374]\r\016!E`P\205D"
+	.ascii	"\303\334B]\223\304\2414\205\207\244QO\262h$\024J\203~Z\bU\025"
+	.ascii	"E\262\202 \244\021\207\244\317Z"
+	.string	"\224\256\311\026*v\206\252\017\205\244\260\204\236\3440E2\231\016\217*r\303:L\213\251\317\r\212\026E$R\330\363!QM\215\351\220\276\007\037$\340\003\023G\277\233"
+	.string	"\201\003\0208\360\335\004\b@@ |"
+	.ascii	"\244\377\001\020\3760\231a\335YO$\"YA\2201\375%\203)t\220\351"
+	.ascii	"\252bU\205k\022"
+	.string	"\230\016\031\205jO\305\221\221\320\347D\"\216\324\021Gj\317\221z\203\024\026\r\325\236\232\006\021Y\034\251E!QM\223<\306#1\2314Z\221\3249J\213H\243\021\204\212B\242\233\342qx\\\217*r'\210\b\024R\203Dd2x\244v\340Y\323d\252\036W#a0\310H\\\021\\\205\311`\221\221\272\242\220\"\223\001\310I\213\302a\362fUS\026Fb\220\230L\2528C5\210X\3243\022\2134\n\303\224hx$,\322;\311\242\220E\361\210T\323\325H\302P\355 \001\037\025( \302\220\221H\264\036\217E*\206jO2M\325\241t\204\"\241\b,\220B\032\206\301##\341\316*dA\\\207(\322\240c\t*Q\370c$\016\323\244Q\360HX\024<Rq~kP\270\nG\310\2204\036\217&\020\rWb\n\311\035#d\272&\263p\025\006e\343\221\270\016\215F\022H\203\216Ey=\221"
+	.ascii	"\326`\007$V\024\253\3211-\"\256\300d0]\205\253\n\236\2434\310"
+	.ascii	"HB15\032\205D\"\034\031\twV\rC\337z\"\021AD\344\210\342\217\252"
+	.ascii	"\223\f\232\020DD\346\2300\341\232 \341\232\030\341\246\310\026"
+	.ascii	"kPM\327\"Q\210'G\005\242\240\020\262\030L"
+	.string	"A\330\342F\005\"\035!\241\343j4\f\022\r\327\2431\250a5\246C55\301\004\244Q\220\221\270\201\0168)\b9Pd\244\"\210\210\324Y\215F\307a0\035\022\252)\013a\320\2304\246\310\242\243\bAD\023V\341\n\026=Fb\t+\212 \"2CZ\0342\242\330i\261\022Y\020Wb\322\230\252(\246,\322b\206\240\342\221(\231\252D'\244\305u=\252D'p0\022\205\023P\217\253PM\211\033\216\304U\230\342HXLS$5\254DC\304t\003k\252\242HM\327\240\236\225XD\264@1\035\016Q\264\340YO$\"-\022\205\216*2\250\301\217\310T\035\261\036\217\352\b\234\024\331\342\004`28D\0242\036E(\036\325\325x\034\366\244\2530\305P\375\231\b\"\226\240\022\255*\321\252\223\351*T{#\220`\202Jt\202\261E\020p\r\232\370\2318\"\217\"\220\202\220\003C\365f\r~"
+	.string	"\264\032\211F\372$J\234\020\002ZA\342\003\021"
+	.ascii	"\370\211\023\"`\240\201\013L@\017E$WcZ\264&\215F\020$\f\016\325"
+	.ascii	"\021C\241\021F\242\260h\304PM\216\020q\301j$\036\221(\bSuEP\210"
+	.ascii	"\\u\376\367f\214Q\303{\202\351\311\310o\276\030X\\\224\354\320"
+	.ascii	"i6y\321\350Qq\361\301\303\215\354\346\016vO\275\251\336Soi\367"
+	.ascii	"\322\0033a=\251\367\226=$O\271\261\233{Q6\r\347\210\222U\223"
+	.ascii	"\233{P6-\n\016\251$\267\210\217/-q7\277\307\205\376\221\353\271"
+	.ascii	"\3509\271\3505]\003\322\336W\bP\302$s\246\367\342\275\246\036"
+	.ascii	"\023\006\036_\230J\230zKT\306\230W\210<\201jH>t\364``\255\273"
+	.ascii	")s[g\236\031\013\324\f-)K\321\221k\222\367\003\t\243\001\315"
+	.ascii	"D\201\275\365\224\271+\307\0315w\275\r\305\247$\317)\355:\263"
+	.ascii	"U\227\323\020\274\0260P\321\201\231\321\306\2139#\n\306\006\f"
+	.ascii	"\002vO=\326\344\260\035\246\034c\326\334\234\323\344\273\254"
+	.ascii	"\3469\rV>s\232\0356\327\bZ\f<_~>q\326\002\203\344\250R\001=F"
+	.ascii	"\262J!\204\020\215\310\214$I:B\n\020\206cY\034\0072\365\022`"
+	.ascii	"dA\320*\351\206&I\3523\354g\203\302\215h\366\251W:\275\317\264"
+	.ascii	"\266\267/J2\341\3261\006.\306\340\013j\004OV\020\313\356\004"
+	.ascii	"\217^\202;\210k[[\031\233;\307P\367Z\376\r\013\336\024\332\030"
+	.ascii	"\200<\336\235\013_\352m\r\264\\&B&\377\330\207\2324D\301\210"
+	.ascii	"H\253\242\222e's\324\025%E\254\274l\032a\254\232\013!\273\030"
+	.ascii	"\212\2344\301Z^{\267\t\017C\277q\360\216\001*\220Sh\fM\315X\240"
+	.ascii	"\301\306\026\245G\245P\024!*\024[\322\333\rb\371\2213\212\223"
+	.ascii	"\372D\220\274\024\ti''.\263j\207\201\035\024\200\026\226\027"
+	.ascii	"\241v\247\227*$\221\352\220\b\273S-\"\272\007S\312\206\272\016"
+	.ascii	"g\261\337\311\023\177\3325T\274\301r\274\361%P$+v9l\344\177\331"
+	.ascii	"\225O5I\037\2267\325\315\306}\326\002\331\320\033H\315\374v\345"
+	.ascii	"\006G\206\271\007u\375\3350\316\310\371\236UI\343\374\316\261"
+	.ascii	"sQ\3426+\235V0q\333\240\b\236Q\366D\002\277O\020\204!p\214\035"
+	.ascii	"\234Z\374.(F\2161\266\f\203z\273\200\020'W5\343\233\024\317>"
+	.ascii	"\323>\252\363\036[X@\210\305t\231#\013\217\361\234\354\214\036"
+	.ascii	"_L\234Bd\035g{h\222\355{\2715\370H>Dw\255Y\312@\0045\206x\357"
+	.ascii	"&z\226\034\273'{\370!\222\361\244\375\241\334\306\272\005\365"
+	.ascii	";5\210\270\244A\177x\340\350nS\005&\023K\300\314\222\256D\302"
+	.ascii	"@\355\001u$\251\211\317L\332\353\001\0370\275\345\342\245i\350"
+	.ascii	"\304\314\323t\245d\364\314n\b\376\327\205\364\230\316\006\303"
+	.ascii	"\323\301\221\205j\263Hw\253\234\331P\317\210\0338[\325\004\n"
+	.ascii	"\240\337:\345\006#\227\311\272\265\"p\031\342Q\253E\350f\013"
+	.ascii	"$\235!\001Te\277\033T\210g\376z|t\022\357\376\304\300V\347\240"
+	.ascii	"\310g( \227\n:&h\r\377F\tP\200|\332\376C8\214\002z!\022t\222"
+	.ascii	"\307\354\321\206V\335\343l\301\343}F-\263\215\220\305p\307N8"
+	.ascii	"\362\037Ayt\255\326>\340)$m\030\362\351\025H7L\213\306\217\320"
+	.ascii	"0\276\232k\341I3\f\363\350\006\313}\037\002\265\202\34361\235"
+	.ascii	"(\233\301(*\220\277>$\267\26179 n@\220v\203\2606\201\212\341"
+	.ascii	"\3472\216a\005b\313\257\244\276\0068\375o{4\035\020/\210\004"
+	.ascii	"\006\330x\003y\246F\032\255\344cu\0171\254K\314\215\013\362\364"
+	.ascii	"C)\242\3529\254\250e\3176\361U\033\334\"5\216\252\343\300\030"
+	.ascii	"\321\017\222>\340\257\020/ \310\216V\036m\362Aa\322*\2524\353"
+	.ascii	"sZ\200"
+	.string	"\bk\230\257\\\247\345y\334\265n>hU\022K\030s\\\346\343\023\022Fn):\037\344\324p\223Y\365%O\367 \224\202`\235\255h8\366\265\316\340/\340}\354\021\256\367l\026\262\264\210\277\266\230\031\204\276F%\030\350r8\313\3125\376uq\223\257\200\324\177\317 \3401\t\006\346*\"\242\356zJ\3606zn7\360\027\217|^A\303\324ux\340CN\0230\245\352\350\013k\\\317 7\276\244\247\307P^j\277A\220\r\t\260\350gR\374\0329\263C\203S\025\205rs\213\275\242u\211\275 6\337\251\363o\354\315Zi\202\357\356\204\247\323TE3x\215\210Y\254\272\227\301\340\271*\212i\314\2006/\361PGNuz\022\233\321\314\333\251\212W\367\250B\324>\223;\004\312D\257\t\270\246\350\361\313\210\335\254'N\246\356\007\223\327'\224^\n0\353<\246\002\0231h\3670_\315\373K.\330"
+	.ascii	"\321\212'J&\247:\230D/\351"
+	.string	"CC\006;\263\221\r\243\324(\027W\312\023\255\305\265\375\212(\365\362i\255V-J^\327\301F(O\200\244\323dQ\"\235\002\340\206\326\355\035\311\262S\333s\230\362\323\376\022\340\370\340\315\215\302ug\260\361\201\245\201\020I\246\030\202\020\tM\374\216\220\227fS\261f\266\007\t\200c\246\365n\002\305\3303\317h^\237\206\267\n\202~\350\375uw\312`\202\"*k0\300!\251\226\026\027$\201iU\365\260\234\242\310\030\002~\363\326\353\304\236x\226\230}\272\252\303\024\256\2051y*K\312@\343\215\323\020\367\244"
+	.ascii	"\032{-\371\016$\236,\203sw\317\261\264$\275f\202\236\246(\313"
+	.ascii	"\310&\023J\376\320\034np|W\305\305E=\315\307b4uUh4Y\333\200~"
+	.ascii	"\254$0@\003\204j'D\250_A\b\220\253T\016\2666'\222r\353\r}@\215"
+	.ascii	"\nF\343\t?\232&:\00182\256*\266\224(\314\0312\213Y\224?7\305"
+	.ascii	"\216\023\n\265x\251\217\331.P\3608\213\002\223\326r\026!\353"
+	.ascii	"\2267\026\b\240\221@\016\363\372\272\0271\350\245\021\310Xt\215"
+	.ascii	"\\\270e\202m\266\250\303\036\223\265\357\007\3134\240*\372\276"
+	.ascii	"d\332\262\266\210d\354\334W\345\221\020\013\355v\325\325\266"
+	.ascii	"\007\236Zw\232\021z\t\222\007\355\003\201F#\230\251\021y\366"
+	.ascii	"\317V\314\266\022\027V\032\226\225\201\274\252\352\307\336\230"
+	.ascii	"Z\347$i\245\207!\035\246k\007\231\331a\207\337\310Q\221\303\273"
+	.ascii	"\333\251?\204\037\266\362`\217:\247\212\326\372\357\367\314\302"
+	.ascii	"4\272\321*.\350\376\211\023Xt\003\344\027"
+	.string	"8\\\276D\236\343\3425\326\255\211\342\003\275\326\007\025V\207\"\263\217\354Ab\301\236g\334\033\037d\342Q$\232\267\211\340\311\245F\251\225\300\320\001\371g\341\211aG\337\177{p\237H\265\027\305\311\004e\323\303\0314om\237PR\n\322\310x\347\266j\262\301o\222\235\305w\032;\251\247uz\t\314\314\205\033X\350\247\313\200B\367\235\321X'\002\026\227U\214\214#\320\263\021\266\2329k\220\236wf\026\013\237Jh\212W\003k\256\346\034/\304\252R\260\230bw\017p\005m\335\372H\214I-\372\262@b@\212\327\212\037\232\270-0\362\331>\345vJ\364\024\3210\260\326\214\205d\360\350\315\374~\26531\020\257\264A\224\355\2040\002+\246\022\360\033\017\021\374+i\344\200S\371\305\017 \362\342\353\375\277Y\202\003\0229,'!y\306\\FD\0360\311\306\216,\f\206s]\302!\210\240\305%\034^"
+	.ascii	"\365y/rZ\212\233\346?\263\273\354I]\252\361\220\364\267\376\031"
+	.ascii	"\034L\r\323\376\357\231\b+\t\227}\215&\023\270\244\250\301[\006"
+	.ascii	"\230\333;(&-\212\375\\S\214\013L|\020 \220x\td\r!\277S<+\";\022"
+	.ascii	"\323\265\207\207\264\3308\317\274\256o8\277\251Bl\032\006\nQ"
+	.ascii	"\256\336\033n\260\316\027\020\035\005sx\334\227\217w\257\217"
+	.ascii	"GI\373v\215\245\330\031\326N7\202\223\252\346hP*;`L\t\362=\363"
+	.ascii	"\267s\377\272\275^p\237\026E\276l\3419\340M\340e8\334\261\f'"
+	.ascii	"K4\337v\343\313K\244\221\bQ\027c9bf\230\205,s\244\"\261V\004"
+	.ascii	"\233EW\323>9\362\265\036\020\231\030\302R6\373\350\377R\340\222"
+	.ascii	" \377\303\372\224x\350\373\013=|\006\332\263$'U}\224\235p0\242"
+	.ascii	"\275@\371\256\370\206\003\335\250\347\301\342F\325\351\313\215"
+	.ascii	"+i\037\244\325\022s!\301\365\243\033a|'\277\202ev\2203*N\260"
+	.ascii	"\306\324y\374\031\357\376\002Ny\027\346\t:\274j~3.\374N\373o"
+	.ascii	"\255\277x\367\220\177k8\343\315%\346\253\364)\330\357\316\260"
+	.ascii	"\341\314|v\223\260\222\352\007\351\353|}9\230\231\3729\031\351"
+	.ascii	"\270\220(\272:\375\233\344\035\367Th\023\245qr\373}\200\347\215"
+	.ascii	"\337\222V\3720\004\255"
+	.text
+	.section	.gnu.lto_.symtab.17d2ed4a57d336e1,"e",@progbits
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"Z"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"useAdjustmentConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"generateRcCurves"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"changeControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"getCurrentControlRateProfileIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.17d2ed4a57d336e1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,18746 @@
+	.file	"rc_controls.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/fc/config.h"
+	.file 8 "./src/main/flight/pid.h"
+	.file 9 "./src/main/fc/rc_controls.h"
+	.file 10 "./src/main/fc/runtime_config.h"
+	.file 11 "./src/main/io/beeper.h"
+	.file 12 "./src/main/sensors/sensors.h"
+	.file 13 "./src/main/sensors/acceleration.h"
+	.file 14 "./src/main/rx/rx.h"
+	.file 15 "./src/main/fc/rc_controls.c"
+	.file 16 "./src/main/fc/fc_core.h"
+	.file 17 "./src/main/sensors/barometer.h"
+	.file 18 "/usr/include/string.h"
+	.file 19 "./src/main/sensors/gyro.h"
+	.file 20 "./src/main/flight/failsafe.h"
+	.file 21 "./src/main/config/feature.h"
+	.file 22 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rc_controls.c.44197c47
+	.weak	rc_controls.c.44197c47
+rc_controls.c.44197c47:
+	.long	0xfb6
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF2716
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2364
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2365
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2366
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2367
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2368
+	.uleb128 0x3
+	.long	.LASF2369
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2370
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2371
+	.uleb128 0x3
+	.long	.LASF2372
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2373
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2374
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2375
+	.uleb128 0x24
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2376
+	.uleb128 0x3
+	.long	.LASF2377
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF2378
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2379
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF2380
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xc
+	.long	0xc3
+	.uleb128 0x3
+	.long	.LASF2381
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x3
+	.long	.LASF2382
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2383
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2384
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2385
+	.uleb128 0x3
+	.long	.LASF2386
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xc3
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x13b
+	.uleb128 0x9
+	.long	.LASF2387
+	.value	0xfff
+	.uleb128 0x9
+	.long	.LASF2388
+	.value	0xf000
+	.uleb128 0x9
+	.long	.LASF2389
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2391
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2392
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xf
+	.long	0x147
+	.uleb128 0x25
+	.long	0x157
+	.uleb128 0x6
+	.long	0x96
+	.uleb128 0x6
+	.long	0x7c
+	.byte	0
+	.uleb128 0x26
+	.byte	0x8
+	.byte	0x5
+	.byte	0x35
+	.byte	0x5
+	.long	0x178
+	.uleb128 0x17
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x36
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x17
+	.string	"fn"
+	.byte	0x5
+	.byte	0x37
+	.byte	0x16
+	.long	0x178
+	.byte	0
+	.uleb128 0xa
+	.long	0x13b
+	.uleb128 0xb
+	.long	.LASF2471
+	.byte	0x20
+	.byte	0x5
+	.byte	0x30
+	.long	0x1cb
+	.uleb128 0x12
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x31
+	.byte	0xb
+	.long	0x101
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2393
+	.byte	0x5
+	.byte	0x32
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2394
+	.byte	0x5
+	.byte	0x33
+	.byte	0xe
+	.long	0x1cb
+	.byte	0x8
+	.uleb128 0x12
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x34
+	.byte	0xf
+	.long	0x1d0
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2395
+	.byte	0x5
+	.byte	0x38
+	.byte	0x7
+	.long	0x157
+	.byte	0x18
+	.byte	0
+	.uleb128 0xa
+	.long	0xb7
+	.uleb128 0xa
+	.long	0x1cb
+	.uleb128 0x3
+	.long	.LASF2396
+	.byte	0x5
+	.byte	0x39
+	.byte	0x3
+	.long	0x17d
+	.uleb128 0xc
+	.long	0x1d5
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x30c
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2400
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2406
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2407
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2408
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2409
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2410
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2411
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2412
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2419
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2426
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2428
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2439
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2440
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2441
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2442
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2443
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x7
+	.byte	0x23
+	.long	0x3e8
+	.uleb128 0x1
+	.long	.LASF2444
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2445
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2446
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2447
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2448
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2449
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2450
+	.byte	0x80
+	.uleb128 0x9
+	.long	.LASF2451
+	.value	0x100
+	.uleb128 0x9
+	.long	.LASF2452
+	.value	0x200
+	.uleb128 0x9
+	.long	.LASF2453
+	.value	0x400
+	.uleb128 0x9
+	.long	.LASF2454
+	.value	0x1000
+	.uleb128 0x9
+	.long	.LASF2455
+	.value	0x2000
+	.uleb128 0x9
+	.long	.LASF2456
+	.value	0x4000
+	.uleb128 0x9
+	.long	.LASF2457
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF2458
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF2459
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF2460
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF2461
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF2462
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF2463
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF2464
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF2465
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF2466
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF2467
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF2468
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF2469
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF2470
+	.long	0x10000000
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2472
+	.byte	0x4c
+	.byte	0x8
+	.byte	0x3c
+	.long	0x510
+	.uleb128 0x12
+	.string	"P8"
+	.byte	0x8
+	.byte	0x3d
+	.byte	0xd
+	.long	0xc02
+	.byte	0
+	.uleb128 0x12
+	.string	"I8"
+	.byte	0x8
+	.byte	0x3e
+	.byte	0xd
+	.long	0xc02
+	.byte	0xa
+	.uleb128 0x12
+	.string	"D8"
+	.byte	0x8
+	.byte	0x3f
+	.byte	0xd
+	.long	0xc02
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2473
+	.byte	0x8
+	.byte	0x41
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2474
+	.byte	0x8
+	.byte	0x42
+	.byte	0xe
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2475
+	.byte	0x8
+	.byte	0x43
+	.byte	0xe
+	.long	0xc3
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2476
+	.byte	0x8
+	.byte	0x44
+	.byte	0xe
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2477
+	.byte	0x8
+	.byte	0x45
+	.byte	0xe
+	.long	0xc3
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2478
+	.byte	0x8
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2479
+	.byte	0x8
+	.byte	0x47
+	.byte	0xb
+	.long	0xec
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2480
+	.byte	0x8
+	.byte	0x48
+	.byte	0xb
+	.long	0xec
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2481
+	.byte	0x8
+	.byte	0x49
+	.byte	0xd
+	.long	0xb7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2482
+	.byte	0x8
+	.byte	0x4a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF2483
+	.byte	0x8
+	.byte	0x4b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2484
+	.byte	0x8
+	.byte	0x4c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF2485
+	.byte	0x8
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0x8
+	.byte	0x50
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2487
+	.byte	0x8
+	.byte	0x51
+	.byte	0xb
+	.long	0xec
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2488
+	.byte	0x8
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2489
+	.byte	0x8
+	.byte	0x53
+	.byte	0xd
+	.long	0xb7
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF2490
+	.byte	0x8
+	.byte	0x54
+	.byte	0xb
+	.long	0xec
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2491
+	.byte	0x8
+	.byte	0x55
+	.byte	0xb
+	.long	0xec
+	.byte	0x48
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x9
+	.byte	0x18
+	.long	0x5dc
+	.uleb128 0x1
+	.long	.LASF2492
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2494
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2495
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2496
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2498
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2499
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2506
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2507
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2508
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2509
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2510
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2511
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2512
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2514
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2515
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2516
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2517
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2518
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2519
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2520
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2521
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2522
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2523
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2524
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x3
+	.long	0x510
+	.uleb128 0x4
+	.long	.LASF2548
+	.byte	0x9
+	.byte	0x3c
+	.byte	0x11
+	.long	0xd4
+	.uleb128 0x27
+	.long	.LASF2717
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x9
+	.byte	0x41
+	.byte	0xe
+	.long	0x64f
+	.uleb128 0x1
+	.long	.LASF2525
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2526
+	.byte	0x1
+	.uleb128 0x28
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2527
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2528
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2530
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2531
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2532
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2533
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2534
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2535
+	.byte	0xb
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x9
+	.byte	0x50
+	.long	0x667
+	.uleb128 0x1
+	.long	.LASF2536
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2537
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2538
+	.byte	0x9
+	.byte	0x53
+	.byte	0x3
+	.long	0x64f
+	.uleb128 0xb
+	.long	.LASF2539
+	.byte	0x2
+	.byte	0x9
+	.byte	0x88
+	.long	0x69a
+	.uleb128 0x2
+	.long	.LASF2540
+	.byte	0x9
+	.byte	0x89
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2541
+	.byte	0x9
+	.byte	0x8a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2542
+	.byte	0x9
+	.byte	0x8b
+	.byte	0x3
+	.long	0x673
+	.uleb128 0xc
+	.long	0x69a
+	.uleb128 0xb
+	.long	.LASF2543
+	.byte	0x8
+	.byte	0x9
+	.byte	0x8d
+	.long	0x6df
+	.uleb128 0x2
+	.long	.LASF2544
+	.byte	0x9
+	.byte	0x8e
+	.byte	0xd
+	.long	0x5dc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2545
+	.byte	0x9
+	.byte	0x8f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2546
+	.byte	0x9
+	.byte	0x90
+	.byte	0x14
+	.long	0x69a
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2547
+	.byte	0x9
+	.byte	0x91
+	.byte	0x3
+	.long	0x6ab
+	.uleb128 0xc
+	.long	0x6df
+	.uleb128 0xf
+	.long	0x6df
+	.long	0x700
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2549
+	.byte	0x9
+	.byte	0x93
+	.byte	0x22
+	.long	0x6f0
+	.uleb128 0xf
+	.long	0x9f
+	.long	0x71c
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2550
+	.byte	0x9
+	.byte	0x9b
+	.byte	0x10
+	.long	0x70c
+	.uleb128 0xb
+	.long	.LASF2551
+	.byte	0x5
+	.byte	0x9
+	.byte	0x9d
+	.long	0x776
+	.uleb128 0x2
+	.long	.LASF2552
+	.byte	0x9
+	.byte	0x9e
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2553
+	.byte	0x9
+	.byte	0x9f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2554
+	.byte	0x9
+	.byte	0xa0
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2555
+	.byte	0x9
+	.byte	0xa1
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2556
+	.byte	0x9
+	.byte	0xa2
+	.byte	0x9
+	.long	0xfa
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2557
+	.byte	0x9
+	.byte	0xa3
+	.byte	0x3
+	.long	0x728
+	.uleb128 0xc
+	.long	0x776
+	.uleb128 0x4
+	.long	.LASF2558
+	.byte	0x9
+	.byte	0xa5
+	.byte	0x1b
+	.long	0x776
+	.uleb128 0xb
+	.long	.LASF2559
+	.byte	0x8
+	.byte	0x9
+	.byte	0xa7
+	.long	0x7d4
+	.uleb128 0x2
+	.long	.LASF2560
+	.byte	0x9
+	.byte	0xa8
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2561
+	.byte	0x9
+	.byte	0xa9
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2562
+	.byte	0x9
+	.byte	0xaa
+	.byte	0xe
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2563
+	.byte	0x9
+	.byte	0xab
+	.byte	0xe
+	.long	0xc3
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2564
+	.byte	0x9
+	.byte	0xac
+	.byte	0x3
+	.long	0x793
+	.uleb128 0xc
+	.long	0x7d4
+	.uleb128 0x4
+	.long	.LASF2565
+	.byte	0x9
+	.byte	0xae
+	.byte	0x19
+	.long	0x7d4
+	.uleb128 0xb
+	.long	.LASF2566
+	.byte	0x3
+	.byte	0x9
+	.byte	0xb0
+	.long	0x825
+	.uleb128 0x2
+	.long	.LASF2567
+	.byte	0x9
+	.byte	0xb1
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2568
+	.byte	0x9
+	.byte	0xb2
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2569
+	.byte	0x9
+	.byte	0xb3
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2570
+	.byte	0x9
+	.byte	0xb4
+	.byte	0x3
+	.long	0x7f1
+	.uleb128 0xc
+	.long	0x825
+	.uleb128 0x4
+	.long	.LASF2571
+	.byte	0x9
+	.byte	0xb6
+	.byte	0x17
+	.long	0x825
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xa
+	.byte	0x15
+	.long	0x866
+	.uleb128 0x1
+	.long	.LASF2572
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2573
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2574
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2575
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2576
+	.byte	0xa
+	.byte	0x1c
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xa
+	.byte	0x36
+	.long	0x89c
+	.uleb128 0x1
+	.long	.LASF2577
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2578
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2579
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2580
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2581
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2582
+	.byte	0xa
+	.byte	0x42
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xb
+	.byte	0x17
+	.long	0x938
+	.uleb128 0x1
+	.long	.LASF2583
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2584
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2585
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2586
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2587
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2588
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2589
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2590
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2591
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2592
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2593
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2594
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2595
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2596
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2597
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2598
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2599
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2600
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2601
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2602
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2603
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2604
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2605
+	.byte	0xb
+	.byte	0x31
+	.byte	0x3
+	.long	0x8a8
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xc
+	.byte	0x14
+	.long	0x96e
+	.uleb128 0x1
+	.long	.LASF2606
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2607
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2608
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2609
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2610
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xc
+	.byte	0x2d
+	.long	0x9a4
+	.uleb128 0x1
+	.long	.LASF2611
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2612
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2613
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2614
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2615
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2616
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2617
+	.byte	0x40
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2618
+	.byte	0x4
+	.byte	0xd
+	.byte	0x35
+	.long	0x9cb
+	.uleb128 0x2
+	.long	.LASF2619
+	.byte	0xd
+	.byte	0x36
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2620
+	.byte	0xd
+	.byte	0x37
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2621
+	.byte	0xd
+	.byte	0x38
+	.byte	0x3
+	.long	0x9a4
+	.uleb128 0x29
+	.long	.LASF2718
+	.byte	0x4
+	.byte	0xd
+	.byte	0x3a
+	.byte	0xf
+	.long	0x9fd
+	.uleb128 0x17
+	.string	"raw"
+	.byte	0xd
+	.byte	0x3b
+	.byte	0xd
+	.long	0x9fd
+	.uleb128 0x2a
+	.long	.LASF2622
+	.byte	0xd
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x9cb
+	.byte	0
+	.uleb128 0xf
+	.long	0x9f
+	.long	0xa0d
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2623
+	.byte	0xd
+	.byte	0x3d
+	.byte	0x3
+	.long	0x9d7
+	.uleb128 0xf
+	.long	0x9f
+	.long	0xa29
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2624
+	.byte	0xe
+	.byte	0x50
+	.byte	0x10
+	.long	0xa19
+	.uleb128 0xb
+	.long	.LASF2625
+	.byte	0x2c
+	.byte	0xe
+	.byte	0x76
+	.long	0xb87
+	.uleb128 0x2
+	.long	.LASF2626
+	.byte	0xe
+	.byte	0x77
+	.byte	0xd
+	.long	0xb87
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2627
+	.byte	0xe
+	.byte	0x78
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2628
+	.byte	0xe
+	.byte	0x79
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2629
+	.byte	0xe
+	.byte	0x7a
+	.byte	0xd
+	.long	0xb7
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2630
+	.byte	0xe
+	.byte	0x7b
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2631
+	.byte	0xe
+	.byte	0x7c
+	.byte	0xe
+	.long	0xd4
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2632
+	.byte	0xe
+	.byte	0x7d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2633
+	.byte	0xe
+	.byte	0x7e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2634
+	.byte	0xe
+	.byte	0x7f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2635
+	.byte	0xe
+	.byte	0x80
+	.byte	0xd
+	.long	0xb7
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2636
+	.byte	0xe
+	.byte	0x81
+	.byte	0xd
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2637
+	.byte	0xe
+	.byte	0x82
+	.byte	0xd
+	.long	0xb7
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2638
+	.byte	0xe
+	.byte	0x83
+	.byte	0xe
+	.long	0xc3
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2639
+	.byte	0xe
+	.byte	0x84
+	.byte	0xe
+	.long	0xc3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2640
+	.byte	0xe
+	.byte	0x85
+	.byte	0xe
+	.long	0xc3
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2641
+	.byte	0xe
+	.byte	0x86
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2642
+	.byte	0xe
+	.byte	0x87
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF2643
+	.byte	0xe
+	.byte	0x88
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2644
+	.byte	0xe
+	.byte	0x89
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2645
+	.byte	0xe
+	.byte	0x8a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2646
+	.byte	0xe
+	.byte	0x8b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2647
+	.byte	0xe
+	.byte	0x8c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2648
+	.byte	0xe
+	.byte	0x8d
+	.byte	0xe
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2649
+	.byte	0xe
+	.byte	0x8f
+	.byte	0xe
+	.long	0xc3
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2650
+	.byte	0xe
+	.byte	0x90
+	.byte	0xe
+	.long	0xc3
+	.byte	0x28
+	.byte	0
+	.uleb128 0xf
+	.long	0xb7
+	.long	0xb97
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2651
+	.byte	0xe
+	.byte	0x91
+	.byte	0x3
+	.long	0xa35
+	.uleb128 0xc
+	.long	0xb97
+	.uleb128 0x4
+	.long	.LASF2652
+	.byte	0xe
+	.byte	0x93
+	.byte	0x13
+	.long	0xb97
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x8
+	.byte	0x23
+	.long	0xc02
+	.uleb128 0x1
+	.long	.LASF2653
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2654
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2655
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2656
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2657
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2659
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2660
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2661
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2662
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2663
+	.byte	0xa
+	.byte	0
+	.uleb128 0xf
+	.long	0xb7
+	.long	0xc12
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2664
+	.byte	0x8
+	.byte	0x56
+	.byte	0x3
+	.long	0x3e8
+	.uleb128 0x11
+	.long	.LASF2665
+	.byte	0x40
+	.byte	0x16
+	.long	0xc29
+	.uleb128 0xa
+	.long	0xc12
+	.uleb128 0x11
+	.long	.LASF2666
+	.byte	0x43
+	.byte	0xc
+	.long	0xfa
+	.uleb128 0x13
+	.long	0x71c
+	.byte	0x45
+	.byte	0x9
+	.uleb128 0x13
+	.long	0x5e8
+	.byte	0x47
+	.byte	0xa
+	.uleb128 0x4
+	.long	.LASF2667
+	.byte	0xf
+	.byte	0x49
+	.byte	0x21
+	.long	0x782
+	.uleb128 0x13
+	.long	0x787
+	.byte	0x49
+	.byte	0x56
+	.uleb128 0x4
+	.long	.LASF2668
+	.byte	0xf
+	.byte	0x49
+	.byte	0x89
+	.long	0x1e1
+	.uleb128 0x18
+	.long	0xc5a
+	.byte	0xb7
+	.uleb128 0x1e
+	.long	0xc47
+	.byte	0x4b
+	.byte	0x1a
+	.uleb128 0x4
+	.long	.LASF2669
+	.byte	0xf
+	.byte	0x53
+	.byte	0x1d
+	.long	0x831
+	.uleb128 0x13
+	.long	0x836
+	.byte	0x53
+	.byte	0x4a
+	.uleb128 0x4
+	.long	.LASF2670
+	.byte	0xf
+	.byte	0x53
+	.byte	0x79
+	.long	0x1e1
+	.uleb128 0x18
+	.long	0xc86
+	.byte	0xa3
+	.uleb128 0x1e
+	.long	0xc73
+	.byte	0x55
+	.byte	0x16
+	.uleb128 0x13
+	.long	0x700
+	.byte	0x5b
+	.byte	0x1b
+	.uleb128 0x4
+	.long	.LASF2671
+	.byte	0xf
+	.byte	0x5b
+	.byte	0x5f
+	.long	0x1e1
+	.uleb128 0x18
+	.long	0xca6
+	.byte	0x95
+	.uleb128 0x14
+	.long	.LASF2672
+	.byte	0x10
+	.byte	0x28
+	.long	0xcc9
+	.uleb128 0x6
+	.long	0xcc9
+	.byte	0
+	.uleb128 0xa
+	.long	0x9d7
+	.uleb128 0x19
+	.long	.LASF2676
+	.byte	0x12
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0xcee
+	.uleb128 0x6
+	.long	0x96
+	.uleb128 0x6
+	.long	0x7c
+	.uleb128 0x6
+	.long	0xe0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2673
+	.byte	0xd
+	.byte	0x4c
+	.long	0xcff
+	.uleb128 0x6
+	.long	0xc3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2678
+	.byte	0x7
+	.byte	0x67
+	.uleb128 0x14
+	.long	.LASF2674
+	.byte	0x7
+	.byte	0x6d
+	.long	0xd17
+	.uleb128 0x6
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2686
+	.byte	0x10
+	.byte	0x29
+	.byte	0x6
+	.long	0xd25
+	.uleb128 0x2c
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2675
+	.byte	0x11
+	.byte	0x35
+	.long	0xd36
+	.uleb128 0x6
+	.long	0xc3
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2677
+	.byte	0xa
+	.byte	0x47
+	.byte	0x5
+	.long	0xfa
+	.long	0xd4c
+	.uleb128 0x6
+	.long	0xd4
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2679
+	.byte	0x13
+	.byte	0x56
+	.uleb128 0x14
+	.long	.LASF2680
+	.byte	0xb
+	.byte	0x3b
+	.long	0xd64
+	.uleb128 0x6
+	.long	0x938
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2681
+	.byte	0xa
+	.byte	0x4c
+	.uleb128 0x1f
+	.long	.LASF2682
+	.byte	0x14
+	.byte	0x55
+	.long	0xfa
+	.uleb128 0x1f
+	.long	.LASF2683
+	.byte	0xe
+	.byte	0xa8
+	.long	0xfa
+	.uleb128 0x15
+	.long	.LASF2684
+	.byte	0x10
+	.byte	0x2c
+	.uleb128 0x19
+	.long	.LASF2685
+	.byte	0x15
+	.byte	0x1e
+	.byte	0x5
+	.long	0xfa
+	.long	0xd9e
+	.uleb128 0x6
+	.long	0xd4
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2687
+	.value	0x160
+	.long	0xdc2
+	.uleb128 0xd
+	.long	.LASF2688
+	.value	0x160
+	.byte	0x3b
+	.long	0xdc2
+	.uleb128 0xd
+	.long	.LASF2689
+	.value	0x160
+	.byte	0x63
+	.long	0xc29
+	.byte	0
+	.uleb128 0xa
+	.long	0x6eb
+	.uleb128 0x1a
+	.long	.LASF2690
+	.value	0x15c
+	.byte	0x9
+	.long	0xab
+	.long	0xdf0
+	.uleb128 0xd
+	.long	.LASF2691
+	.value	0x15c
+	.byte	0x26
+	.long	0xab
+	.uleb128 0xd
+	.long	.LASF2638
+	.value	0x15c
+	.byte	0x35
+	.long	0xc3
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2692
+	.value	0x14f
+	.long	0xe18
+	.uleb128 0x1b
+	.uleb128 0xe
+	.long	.LASF2693
+	.value	0x153
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x1b
+	.uleb128 0xe
+	.long	.LASF2694
+	.value	0x154
+	.byte	0x2a
+	.long	0xdc2
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2695
+	.value	0x145
+	.byte	0x5
+	.long	0xfa
+	.long	0xe4d
+	.uleb128 0xd
+	.long	.LASF2545
+	.value	0x145
+	.byte	0x1b
+	.long	0xb7
+	.uleb128 0xd
+	.long	.LASF2546
+	.value	0x145
+	.byte	0x42
+	.long	0xe4d
+	.uleb128 0xe
+	.long	.LASF2696
+	.value	0x14a
+	.byte	0x14
+	.long	0xcf
+	.byte	0
+	.uleb128 0xa
+	.long	0x6a6
+	.uleb128 0x1a
+	.long	.LASF2697
+	.value	0x136
+	.byte	0x5
+	.long	0xfa
+	.long	0xe95
+	.uleb128 0xd
+	.long	.LASF2688
+	.value	0x136
+	.byte	0x47
+	.long	0xdc2
+	.uleb128 0xd
+	.long	.LASF2544
+	.value	0x136
+	.byte	0x69
+	.long	0x5dc
+	.uleb128 0xe
+	.long	.LASF2693
+	.value	0x138
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x1b
+	.uleb128 0xe
+	.long	.LASF2694
+	.value	0x13b
+	.byte	0x2a
+	.long	0xdc2
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2698
+	.byte	0xf
+	.byte	0x78
+	.byte	0x6
+	.long	0xefc
+	.uleb128 0x16
+	.long	.LASF2699
+	.byte	0xf
+	.byte	0x78
+	.byte	0x2f
+	.long	0x667
+	.uleb128 0x11
+	.long	.LASF2700
+	.byte	0x7a
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2701
+	.byte	0x7b
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2702
+	.byte	0x7c
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2703
+	.byte	0x7d
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x2e
+	.string	"i"
+	.byte	0xf
+	.byte	0x7e
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0xe
+	.long	.LASF2704
+	.value	0x104
+	.byte	0x19
+	.long	0xa0d
+	.uleb128 0xe
+	.long	.LASF2705
+	.value	0x107
+	.byte	0x9
+	.long	0xfa
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2706
+	.byte	0x6b
+	.byte	0x12
+	.long	0x667
+	.uleb128 0x2f
+	.long	.LASF2707
+	.byte	0xf
+	.byte	0x66
+	.byte	0x5
+	.long	0xfa
+	.long	0xf24
+	.uleb128 0x16
+	.long	.LASF2708
+	.byte	0xf
+	.byte	0x66
+	.byte	0x28
+	.long	0xc3
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2709
+	.byte	0x61
+	.byte	0x5
+	.long	0xfa
+	.uleb128 0x1c
+	.long	.LASF2710
+	.byte	0x5d
+	.byte	0x5
+	.long	0xfa
+	.uleb128 0x1d
+	.long	.LASF2711
+	.byte	0xe
+	.byte	0x93
+	.byte	0x44
+	.long	0xf46
+	.uleb128 0xa
+	.long	0xba3
+	.uleb128 0x1d
+	.long	.LASF2712
+	.byte	0x9
+	.byte	0xb6
+	.byte	0x50
+	.long	0xf57
+	.uleb128 0xa
+	.long	0x831
+	.uleb128 0x1d
+	.long	.LASF2713
+	.byte	0x9
+	.byte	0xae
+	.byte	0x56
+	.long	0xf68
+	.uleb128 0xa
+	.long	0x7e0
+	.uleb128 0x30
+	.long	.LASF2688
+	.byte	0x9
+	.byte	0x93
+	.byte	0x7b
+	.long	0xdc2
+	.long	0xf8a
+	.uleb128 0x16
+	.long	.LASF2714
+	.byte	0x9
+	.byte	0x93
+	.byte	0x98
+	.long	0x7c
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF2719
+	.byte	0x16
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x21
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x21
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0x16
+	.long	.LASF2715
+	.byte	0x16
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 23 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.file 26 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 28 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 29 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 41 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 42 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2b
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1181
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1221
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x32
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 54 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x36
+	.file 55 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 56 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x38
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 57 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x39
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0x4
+	.file 58 "./src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3a
+	.file 59 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1608
+	.byte	0x4
+	.file 60 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1609
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.file 61 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x4
+	.file 62 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x4
+	.file 63 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 64 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x7
+	.file 65 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x41
+	.file 66 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x4
+	.file 67 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x43
+	.byte	0x4
+	.file 68 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 69 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x45
+	.byte	0x4
+	.file 70 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x46
+	.file 71 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x47
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.file 72 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x48
+	.file 73 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x49
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.file 74 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2154
+	.byte	0x4
+	.file 75 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 76 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2158
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 77 "./src/main/fc/fc_rc.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x4d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 78 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x4
+	.file 79 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x4f
+	.byte	0x4
+	.file 80 "./src/main/io/vtx.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.file 81 "./src/main/io/dashboard.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2208
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x11
+	.file 82 "./src/main/drivers/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2209
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2210
+	.byte	0x4
+	.file 83 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x53
+	.file 84 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2211
+	.byte	0x4
+	.file 85 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x55
+	.file 86 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x56
+	.byte	0x4
+	.byte	0x4
+	.file 87 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x57
+	.file 88 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x13
+	.file 89 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x59
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0xd
+	.file 90 "./src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5a
+	.file 91 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5b
+	.byte	0x4
+	.file 92 "./src/main/drivers/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.file 93 "./src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x5d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1143
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1147
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1159
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1171
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1173
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1290
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1293
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1299
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1303
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1308
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1335
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1496
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1509
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1526
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1527
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1530
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1457
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1567
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1575
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1580
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1583
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1585
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1639
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1643
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1745
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1747
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1755
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1773
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1785
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2153
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2157
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2184
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2193
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx.h.22.12f28c2beccab569593ab27679518da5,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2215
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2308
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2317
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2345
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2355
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2363
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF2720
+	.long	.LASF2721
+	.long	.LASF2722
+	.long	.LASF2723
+	.long	.LASF2724
+	.long	.LASF2725
+	.long	.LASF2726
+	.long	.LASF2727
+	.long	.LASF2728
+	.long	.LASF2729
+	.long	.LASF2730
+	.long	.LASF2731
+	.long	.LASF2732
+	.long	.LASF2733
+	.long	.LASF2734
+	.long	.LASF2735
+	.long	.LASF2736
+	.long	.LASF2737
+	.long	.LASF2738
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x5e
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2739
+	.byte	0xf
+	.long	.LASF2740
+	.byte	0xf
+	.long	.LASF2741
+	.byte	0xf
+	.long	.LASF2742
+	.byte	0x13
+	.long	.LASF2743
+	.byte	0x4
+	.long	.LASF2744
+	.byte	0x5
+	.long	.LASF2745
+	.byte	0x6
+	.long	.LASF2746
+	.byte	0x7
+	.long	.LASF2747
+	.byte	0x6
+	.long	.LASF2748
+	.byte	0x6
+	.long	.LASF2749
+	.byte	0x8
+	.long	.LASF2750
+	.byte	0xa
+	.long	.LASF2751
+	.byte	0xa
+	.long	.LASF2752
+	.byte	0x9
+	.long	.LASF2753
+	.byte	0x6
+	.long	.LASF2754
+	.byte	0x6
+	.long	.LASF2755
+	.byte	0xa
+	.long	.LASF2756
+	.byte	0x12
+	.long	.LASF2757
+	.byte	0xa
+	.long	.LASF2758
+	.byte	0x7
+	.long	.LASF2759
+	.byte	0x4
+	.long	.LASF2760
+	.byte	0x3
+	.long	.LASF2761
+	.byte	0x12
+	.long	.LASF2762
+	.byte	0x13
+	.long	.LASF2763
+	.byte	0x13
+	.long	.LASF2763
+	.byte	0x12
+	.long	.LASF2764
+	.byte	0xf
+	.long	.LASF2765
+	.byte	0x12
+	.long	.LASF2766
+	.byte	0x12
+	.long	.LASF2767
+	.byte	0xf
+	.long	.LASF2768
+	.byte	0xf
+	.long	.LASF2769
+	.byte	0x11
+	.long	.LASF2770
+	.byte	0xf
+	.long	.LASF2771
+	.byte	0x10
+	.long	.LASF2772
+	.byte	0x10
+	.long	.LASF2773
+	.byte	0xf
+	.long	.LASF2774
+	.byte	0xf
+	.long	.LASF2775
+	.byte	0xf
+	.long	.LASF2776
+	.byte	0xe
+	.long	.LASF2777
+	.byte	0xe
+	.long	.LASF2778
+	.byte	0x12
+	.long	.LASF2779
+	.byte	0x12
+	.long	.LASF2780
+	.byte	0xf
+	.long	.LASF2781
+	.byte	0xf
+	.long	.LASF2782
+	.byte	0xf
+	.long	.LASF2783
+	.byte	0xf
+	.long	.LASF2784
+	.byte	0xf
+	.long	.LASF2785
+	.byte	0xf
+	.long	.LASF2786
+	.byte	0xf
+	.long	.LASF2787
+	.byte	0xf
+	.long	.LASF2788
+	.byte	0xf
+	.long	.LASF2789
+	.byte	0xf
+	.long	.LASF2790
+	.byte	0xf
+	.long	.LASF2791
+	.byte	0xd
+	.long	.LASF2792
+	.byte	0xc
+	.long	.LASF2793
+	.byte	0xb
+	.long	.LASF2794
+	.byte	0xc
+	.long	.LASF2795
+	.byte	0x1
+	.long	.LASF2796
+	.byte	0x1
+	.long	.LASF2797
+	.byte	0x3
+	.long	.LASF2798
+	.byte	0x2
+	.long	.LASF2799
+	.byte	0x3
+	.long	.LASF2800
+	.byte	0x4
+	.long	.LASF2801
+	.byte	0x5
+	.long	.LASF2802
+	.byte	0x5
+	.long	.LASF2803
+	.byte	0x5
+	.long	.LASF2804
+	.byte	0x5
+	.long	.LASF2805
+	.byte	0x5
+	.long	.LASF2806
+	.byte	0x5
+	.long	.LASF2807
+	.byte	0x5
+	.long	.LASF2808
+	.byte	0x5
+	.long	.LASF2809
+	.byte	0x5
+	.long	.LASF2810
+	.byte	0x3
+	.long	.LASF2811
+	.byte	0x5
+	.long	.LASF2812
+	.byte	0x5
+	.long	.LASF2813
+	.byte	0x5
+	.long	.LASF2814
+	.byte	0x6
+	.long	.LASF2815
+	.byte	0x8
+	.long	.LASF2816
+	.byte	0x8
+	.long	.LASF2817
+	.byte	0x8
+	.long	.LASF2818
+	.byte	0x8
+	.long	.LASF2755
+	.byte	0x5
+	.long	.LASF2819
+	.byte	0xa
+	.long	.LASF2820
+	.byte	0x3
+	.long	.LASF2821
+	.byte	0xa
+	.long	.LASF2822
+	.byte	0xa
+	.long	.LASF2823
+	.byte	0xa
+	.long	.LASF2824
+	.byte	0xa
+	.long	.LASF2825
+	.byte	0x5
+	.long	.LASF2826
+	.byte	0x5
+	.long	.LASF2827
+	.byte	0x5
+	.long	.LASF2828
+	.byte	0x5
+	.long	.LASF2829
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1909:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2145:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1983:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1155:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2569:
+	.string	"auto_disarm_delay"
+.LASF2165:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF2177:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1206:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF826:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1207:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF1151:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1484:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1334:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF2642:
+	.string	"rcInterpolationChannels"
+.LASF2654:
+	.string	"PIDPITCH"
+.LASF1520:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1491:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2258:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1603:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF935:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF2463:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1358:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1999:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1927:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1485:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF863:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1556:
+	.string	"USE_PPM"
+.LASF2230:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1886:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF2268:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF2444:
+	.string	"FEATURE_RX_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF2149:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1464:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1943:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1790:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF2048:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF999:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF979:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF836:
+	.string	"__DECL_SIMD_expf "
+.LASF1539:
+	.string	"USE_FAKE_GYRO "
+.LASF1434:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF2248:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1609:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1617:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF939:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1787:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1402:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2702:
+	.string	"rcDisarmTicks"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2369:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1124:
+	.string	"__DECL_SIMD_sinhf"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1409:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF2385:
+	.string	"_Bool"
+.LASF2633:
+	.string	"spektrum_sat_bind"
+.LASF2154:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF794:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1536:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1748:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1234:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1486:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2405:
+	.string	"OWNER_ADC_CURR"
+.LASF931:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1634:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1720:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1799:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2001:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2713:
+	.string	"flight3DConfig"
+.LASF2653:
+	.string	"PIDROLL"
+.LASF2598:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF2592:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1339:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF2314:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF1623:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1408:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF1018:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1838:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1788:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2343:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2072:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2568:
+	.string	"disarm_kill_switch"
+.LASF2652:
+	.string	"rxConfig_System"
+.LASF2065:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2255:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2188:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF840:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1512:
+	.string	"__WCHAR_T__ "
+.LASF1870:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2637:
+	.string	"rssi_invert"
+.LASF1597:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2141:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2563:
+	.string	"deadband3d_throttle"
+.LASF1248:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1705:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1006:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF811:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1371:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF2660:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2113:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2300:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF2088:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1208:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1661:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2402:
+	.string	"OWNER_LED"
+.LASF799:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1812:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2090:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF2453:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1327:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1958:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF2380:
+	.string	"uint16_t"
+.LASF1841:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2151:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF2365:
+	.string	"short unsigned int"
+.LASF1117:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1733:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1235:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1160:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2080:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1971:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2323:
+	.string	"PWM_PULSE_MIN 750"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2059:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1475:
+	.string	"TELEMETRY_HOTT "
+.LASF818:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF957:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1126:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2690:
+	.string	"getRcStickDeflection"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1325:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF793:
+	.string	"_MATH_H 1"
+.LASF2012:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1600:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1848:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1308:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1774:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1501:
+	.string	"_T_PTRDIFF_ "
+.LASF2710:
+	.string	"isAirmodeActive"
+.LASF2086:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2288:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1853:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1701:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF807:
+	.string	"__DECL_SIMD_sinl "
+.LASF1961:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1381:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF1693:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1611:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1665:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF2250:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1348:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2553:
+	.string	"yaw_deadband"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2190:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2082:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1678:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2237:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1914:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2317:
+	.string	"GYRO_LPF_NONE 7"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1055:
+	.string	"__DECL_SIMD_tan "
+.LASF1769:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2579:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1412:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2597:
+	.string	"BEEPER_READY_BEEP"
+.LASF828:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1984:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2321:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1800:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1908:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1972:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1822:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF1685:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1383:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF2104:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2340:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2513:
+	.string	"BOXSONAR"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2662:
+	.string	"PIDVEL"
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1198:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1964:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1441:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1414:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF2269:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF2263:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF884:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2112:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1688:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1288:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF1843:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF827:
+	.string	"__DECL_SIMD_logl "
+.LASF1395:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF2409:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2429:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1333:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF816:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1172:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1158:
+	.string	"__DECL_SIMD_tanh"
+.LASF2079:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1064:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1808:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1755:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1423:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1766:
+	.string	"BIT(x) (1 << (x))"
+.LASF2434:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1744:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2675:
+	.string	"baroSetCalibrationCycles"
+.LASF1575:
+	.string	"TELEMETRY_IBUS"
+.LASF1622:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF835:
+	.string	"__DECL_SIMD_exp "
+.LASF1816:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1586:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1045:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1170:
+	.string	"__DECL_SIMD_tan"
+.LASF910:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1249:
+	.string	"_Mdouble_"
+.LASF2378:
+	.string	"int32_t"
+.LASF1393:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1176:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1243:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1405:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF1106:
+	.string	"__DECL_SIMD_exp2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1387:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF2091:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1647:
+	.string	"FAST_MATH "
+.LASF1542:
+	.string	"BARO "
+.LASF1323:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2542:
+	.string	"channelRange_t"
+.LASF1415:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1146:
+	.string	"__DECL_SIMD_atanh"
+.LASF1019:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1123:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1836:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF914:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2116:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF837:
+	.string	"__DECL_SIMD_expl "
+.LASF1857:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2346:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1761:
+	.string	"STR_HELPER(x) #x"
+.LASF2465:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1532:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1883:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1184:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1097:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF2187:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1581:
+	.string	"VTX_TRAMP"
+.LASF1229:
+	.string	"FP_INT_UPWARD 0"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2431:
+	.string	"OWNER_BARO_EXTI"
+.LASF1090:
+	.string	"__DECL_SIMD_acos"
+.LASF1084:
+	.string	"__DECL_SIMD_expf"
+.LASF1305:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF546:
+	.string	"__always_inline"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1706:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1020:
+	.string	"__DECL_SIMD_erff64 "
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1557:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1227:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF2144:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2622:
+	.string	"values"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1893:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2408:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2496:
+	.string	"BOXMAG"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1698:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1250:
+	.string	"__MATH_PRECNAME"
+.LASF970:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1110:
+	.string	"__DECL_SIMD_exp10"
+.LASF1337:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1134:
+	.string	"__DECL_SIMD_log10"
+.LASF2389:
+	.string	"PGR_SIZE_MASK"
+.LASF2546:
+	.string	"range"
+.LASF1260:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1118:
+	.string	"__DECL_SIMD_expm1"
+.LASF1310:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF902:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1907:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1103:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1583:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1253:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2347:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2451:
+	.string	"FEATURE_FAILSAFE"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1220:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1831:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1070:
+	.string	"__DECL_SIMD_sin"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1237:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1488:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1420:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2099:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF2056:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2363:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2002:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF812:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1007:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1314:
+	.string	"__MATHCALL_NARROW"
+.LASF1884:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1856:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1487:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1291:
+	.string	"_Mret_ _Float32"
+.LASF2704:
+	.string	"accelerometerTrimsDelta"
+.LASF2042:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1142:
+	.string	"__DECL_SIMD_log1p"
+.LASF2235:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1271:
+	.string	"__MATHDECL_1"
+.LASF2604:
+	.string	"BEEPER_PREFERENCE"
+.LASF1591:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2506:
+	.string	"BOXLEDLOW"
+.LASF2661:
+	.string	"PIDMAG"
+.LASF1127:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2432:
+	.string	"OWNER_USB"
+.LASF2693:
+	.string	"index"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2705:
+	.string	"shouldApplyRollAndPitchTrimDelta"
+.LASF2678:
+	.string	"saveConfigAndNotify"
+.LASF2562:
+	.string	"neutral3d"
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2443:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2055:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1959:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF2222:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF895:
+	.string	"__DECL_SIMD_exp2 "
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF2494:
+	.string	"BOXHORIZON"
+.LASF959:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1762:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2197:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1633:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2479:
+	.string	"pidSumLimit"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f"
+.LASF988:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2186:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2635:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2683:
+	.string	"rxIsReceivingSignal"
+.LASF2360:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF913:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2311:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF2024:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2469:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1673:
+	.string	"PG_PID_PROFILE 14"
+.LASF2474:
+	.string	"dterm_lpf_hz"
+.LASF1280:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1245:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2455:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2613:
+	.string	"SENSOR_BARO"
+.LASF2656:
+	.string	"PIDALT"
+.LASF1919:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1024:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2148:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1400:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF2507:
+	.string	"BOXLLIGHTS"
+.LASF1178:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2413:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1572:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2238:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1364:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF1935:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1389:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF2452:
+	.string	"FEATURE_SONAR"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2334:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2647:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1690:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2495:
+	.string	"BOXBARO"
+.LASF1108:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1398:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF2401:
+	.string	"OWNER_SERVO"
+.LASF2178:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1768:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1099:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1069:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2658:
+	.string	"PIDPOSR"
+.LASF2680:
+	.string	"beeper"
+.LASF1672:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1483:
+	.string	"TELEMETRY_IBUS "
+.LASF1462:
+	.string	"USE_PWM "
+.LASF2584:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF920:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2307:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2594:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF2309:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF2565:
+	.string	"flight3DConfig_System"
+.LASF996:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF2208:
+	.string	"ENABLE_DEBUG_DASHBOARD_PAGE "
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1163:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1806:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1891:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1985:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1236:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2628:
+	.string	"sbus_inversion"
+.LASF2242:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1840:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF854:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1697:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF2703:
+	.string	"stTmp"
+.LASF1921:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1809:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1980:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1304:
+	.string	"_Mret_ _Float64"
+.LASF1995:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2036:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2108:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1627:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1431:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF2619:
+	.string	"roll"
+.LASF1507:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2681:
+	.string	"mwDisarm"
+.LASF1814:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1426:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1881:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2318:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2370:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2040:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2477:
+	.string	"dterm_notch_cutoff"
+.LASF2372:
+	.string	"__uint16_t"
+.LASF1201:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2173:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF2670:
+	.string	"armingConfig_Registry"
+.LASF2274:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2400:
+	.string	"OWNER_MOTOR"
+.LASF921:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1599:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1898:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF888:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1596:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2276:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF364:
+	.string	"__k8 1"
+.LASF1655:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF2296:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF2428:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1523:
+	.string	"__INT_WCHAR_T_H "
+.LASF966:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1331:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1931:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF891:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2003:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1344:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1786:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1882:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF860:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1492:
+	.string	"USE_SENSOR_NAMES "
+.LASF2464:
+	.string	"FEATURE_AIRMODE"
+.LASF2630:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1819:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF922:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1128:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF2033:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1817:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1746:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF1169:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1842:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1645:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF2299:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF2536:
+	.string	"THROTTLE_LOW"
+.LASF823:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1073:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1135:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1328:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2607:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2067:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF2616:
+	.string	"SENSOR_GPS"
+.LASF1298:
+	.string	"_Marg_ _Float128"
+.LASF1197:
+	.string	"__f32x(x) x ##f32x"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1270:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1231:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1351:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1252:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1760:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1312:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1734:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1851:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1941:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1791:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2364:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1301:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1807:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1283:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF852:
+	.string	"__DECL_SIMD_powf32x "
+.LASF983:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2629:
+	.string	"halfDuplex"
+.LASF1740:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF2590:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1508:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1079:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF2068:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2128:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2446:
+	.string	"FEATURE_RX_SERIAL"
+.LASF2014:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2631:
+	.string	"rx_spi_id"
+.LASF2374:
+	.string	"__uint32_t"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF2180:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF2168:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2383:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1421:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1669:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF2712:
+	.string	"armingConfig"
+.LASF1625:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF2492:
+	.string	"BOXARM"
+.LASF2105:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2087:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF379:
+	.string	"linux 1"
+.LASF2646:
+	.string	"fpvCamAngleDegrees"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1522:
+	.string	"___int_wchar_t_h "
+.LASF1903:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2081:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1273:
+	.string	"__MATHDECL"
+.LASF2484:
+	.string	"levelAngleLimit"
+.LASF2639:
+	.string	"mincheck"
+.LASF1489:
+	.string	"USE_MSP_PUSH "
+.LASF2313:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1017:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1578:
+	.string	"VTX_COMMON"
+.LASF1382:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF878:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1500:
+	.string	"_PTRDIFF_T "
+.LASF2695:
+	.string	"isRangeActive"
+.LASF2471:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2447:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1067:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1855:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF2449:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1721:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF911:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1823:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1923:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1145:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF974:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2243:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF2224:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF2146:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1641:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF943:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2504:
+	.string	"BOXBEEPERON"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1860:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1479:
+	.string	"USE_SERVOS "
+.LASF1380:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF2391:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2121:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2440:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1472:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2058:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1096:
+	.string	"__DECL_SIMD_atanf"
+.LASF1714:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2283:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2023:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2528:
+	.string	"AUX1"
+.LASF2529:
+	.string	"AUX2"
+.LASF868:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2531:
+	.string	"AUX4"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2533:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2535:
+	.string	"AUX8"
+.LASF1676:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1637:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2715:
+	.string	"high"
+.LASF1375:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF2640:
+	.string	"maxcheck"
+.LASF1307:
+	.string	"_Mret_ _Float64x"
+.LASF2593:
+	.string	"BEEPER_RX_SET"
+.LASF1322:
+	.string	"FP_NORMAL 4"
+.LASF2525:
+	.string	"ROLL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2589:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF1926:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2252:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1543:
+	.string	"USE_FAKE_BARO "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1994:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1997:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1784:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF1406:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF2422:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1477:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF2111:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF2219:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1372:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2701:
+	.string	"rcSticks"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2602:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF916:
+	.string	"__DECL_SIMD_coshf "
+.LASF1212:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1900:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF997:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1976:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1892:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1425:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1190:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1847:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF2240:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1810:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF2155:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF894:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2037:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1317:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1652:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1267:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1862:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1929:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2387:
+	.string	"PGR_PGN_MASK"
+.LASF1948:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2514:
+	.string	"BOXSERVO1"
+.LASF2515:
+	.string	"BOXSERVO2"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF2280:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1187:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2045:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1244:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1247:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2467:
+	.string	"FEATURE_RX_SPI"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2005:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2327:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1530:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2216:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF2131:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2060:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1743:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1696:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF804:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1459:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF967:
+	.string	"__DECL_SIMD_log10l "
+.LASF1094:
+	.string	"__DECL_SIMD_atan"
+.LASF402:
+	.string	"false 0"
+.LASF1449:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2143:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1370:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1232:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF2312:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF844:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2357:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2163:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1168:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1592:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF2102:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2655:
+	.string	"PIDYAW"
+.LASF1888:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1189:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF795:
+	.string	"__DECL_SIMD_cos "
+.LASF1585:
+	.string	"USE_DSHOT"
+.LASF1066:
+	.string	"__DECL_SIMD_cos"
+.LASF1329:
+	.string	"MATH_ERRNO 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1428:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF2221:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1896:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF954:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2338:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2433:
+	.string	"OWNER_USB_DETECT"
+.LASF973:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2092:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1826:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF876:
+	.string	"__DECL_SIMD_asinf "
+.LASF2124:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1750:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1747:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2262:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2393:
+	.string	"size"
+.LASF1461:
+	.string	"USE_PPM "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1946:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2608:
+	.string	"SENSOR_INDEX_BARO"
+.LASF2634:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1716:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF2651:
+	.string	"rxConfig_t"
+.LASF2650:
+	.string	"rx_max_usec"
+.LASF1616:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2137:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2605:
+	.string	"beeperMode_e"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2303:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1531:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1068:
+	.string	"__DECL_SIMD_cosf"
+.LASF1261:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1114:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF843:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1951:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1113:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF796:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1956:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1159:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1792:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF940:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2459:
+	.string	"FEATURE_DASHBOARD"
+.LASF2689:
+	.string	"pidProfileToUse"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1619:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1350:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1820:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2437:
+	.string	"OWNER_INVERTER"
+.LASF1347:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2382:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2417:
+	.string	"OWNER_SPI_MOSI"
+.LASF1911:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2114:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2392:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2109:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2379:
+	.string	"uint8_t"
+.LASF1433:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1859:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1213:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF2416:
+	.string	"OWNER_SPI_MISO"
+.LASF1793:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1646:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2074:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1251:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1963:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1764:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2609:
+	.string	"SENSOR_INDEX_MAG"
+.LASF2682:
+	.string	"failsafeIsActive"
+.LASF1473:
+	.string	"TELEMETRY "
+.LASF2574:
+	.string	"ARMED"
+.LASF861:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1394:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1149:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1373:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1167:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1035:
+	.string	"__DECL_SIMD_asinh "
+.LASF2526:
+	.string	"PITCH"
+.LASF1648:
+	.string	"VERY_FAST_MATH "
+.LASF1303:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF2673:
+	.string	"accSetCalibrationCycles"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1742:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1524:
+	.string	"_GCC_WCHAR_T "
+.LASF1519:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2511:
+	.string	"BOXTELEMETRY"
+.LASF2261:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF1063:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1570:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1738:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1392:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1354:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF862:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2524:
+	.string	"boxId_e"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1319:
+	.string	"FP_INFINITE 1"
+.LASF1309:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF2548:
+	.string	"rcModeActivationMask"
+.LASF1311:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF2445:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF805:
+	.string	"__DECL_SIMD_sin "
+.LASF2596:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1537:
+	.string	"LED0_PIN NONE"
+.LASF1858:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF2107:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1571:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1527:
+	.string	"_BSD_WCHAR_T_"
+.LASF2714:
+	.string	"_index"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1166:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1877:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1629:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1180:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2026:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2170:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1089:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2351:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF1780:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1171:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2399:
+	.string	"OWNER_PPMINPUT"
+.LASF1533:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1753:
+	.string	"IOCFG_IPD 0"
+.LASF1510:
+	.string	"__need_ptrdiff_t"
+.LASF848:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2275:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF879:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1205:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1453:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1610:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2127:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2691:
+	.string	"axis"
+.LASF1265:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1694:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1497:
+	.string	"_STDDEF_H "
+.LASF2070:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2624:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1072:
+	.string	"__DECL_SIMD_sinf"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1122:
+	.string	"__DECL_SIMD_sinh"
+.LASF2008:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1811:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF2350:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF801:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1191:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1437:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF833:
+	.string	"__DECL_SIMD_logf64x "
+.LASF2195:
+	.string	"LON 1"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF2319:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF2007:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF2297:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1719:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1254:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2636:
+	.string	"rssi_scale"
+.LASF1684:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1598:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1729:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1628:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1577:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF869:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1689:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF2687:
+	.string	"useRcControlsConfig"
+.LASF2161:
+	.string	"AIRMODEDEADBAND 12"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1849:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF2330:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1867:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF2013:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF2571:
+	.string	"armingConfig_System"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1895:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF928:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2345:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1215:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1439:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF2644:
+	.string	"rcSmoothingFilterType"
+.LASF2362:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF2522:
+	.string	"BOXBLACKBOXERASE"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1934:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1257:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1846:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2063:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1732:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1567:
+	.string	"LED_STRIP"
+.LASF2044:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1133:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1749:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1179:
+	.string	"__f128(x) x ##f128"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1256:
+	.string	"_Mdouble_ long double"
+.LASF808:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2260:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF2089:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1845:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2641:
+	.string	"rcInterpolation"
+.LASF2615:
+	.string	"SENSOR_SONAR"
+.LASF1829:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1075:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1691:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1920:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1563:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1620:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2462:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF2169:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF2225:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF2316:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1955:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF890:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1906:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1091:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1474:
+	.string	"TELEMETRY_FRSKY "
+.LASF1443:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF2539:
+	.string	"channelRange_s"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1056:
+	.string	"__DECL_SIMD_tanf "
+.LASF2031:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF2223:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1730:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF2612:
+	.string	"SENSOR_ACC"
+.LASF2203:
+	.string	"VTX_BAND_MIN 1"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2412:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2394:
+	.string	"address"
+.LASF1659:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1378:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF1942:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2029:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1933:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1936:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2166:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1601:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF2697:
+	.string	"isModeActivationConditionPresent"
+.LASF1562:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1292:
+	.string	"_Marg_ _Float32x"
+.LASF797:
+	.string	"__DECL_SIMD_cosl "
+.LASF915:
+	.string	"__DECL_SIMD_cosh "
+.LASF1210:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1832:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1216:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1239:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1865:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1975:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1608:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2577:
+	.string	"GPS_FIX_HOME"
+.LASF2259:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF2103:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2620:
+	.string	"pitch"
+.LASF2485:
+	.string	"levelSensitivity"
+.LASF2414:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2254:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1511:
+	.string	"__wchar_t__ "
+.LASF1626:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1589:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1218:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1440:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF499:
+	.string	"__PMT"
+.LASF1794:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1525:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF2599:
+	.string	"BEEPER_ARMED"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF2491:
+	.string	"rateAccelLimit"
+.LASF1584:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2472:
+	.string	"pidProfile_s"
+.LASF2664:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1981:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2118:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1708:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1456:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2706:
+	.string	"calculateThrottleStatus"
+.LASF1343:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2558:
+	.string	"rcControlsConfig_System"
+.LASF976:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2576:
+	.string	"armingFlags"
+.LASF1992:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1268:
+	.string	"_Mdouble_ _Float64x"
+.LASF2516:
+	.string	"BOXSERVO3"
+.LASF1401:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF1025:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2193:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1932:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1465:
+	.string	"USE_SERIALRX_IBUS "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2390:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1321:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1177:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2075:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1666:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF2123:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1224:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2666:
+	.string	"isUsingSticksToArm"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1138:
+	.string	"__DECL_SIMD_log2"
+.LASF1987:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2355:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1569:
+	.string	"TELEMETRY_HOTT"
+.LASF2649:
+	.string	"rx_min_usec"
+.LASF866:
+	.string	"__DECL_SIMD_atanf "
+.LASF1336:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2404:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1901:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF2211:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1116:
+	.string	"__DECL_SIMD_coshf"
+.LASF2667:
+	.string	"pgResetTemplate_rcControlsConfig"
+.LASF1513:
+	.string	"_WCHAR_T "
+.LASF1396:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF1930:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1238:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1614:
+	.string	"UNIT_TESTED "
+.LASF2685:
+	.string	"feature"
+.LASF829:
+	.string	"__DECL_SIMD_logf32 "
+.LASF2292:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1978:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1674:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF965:
+	.string	"__DECL_SIMD_log10 "
+.LASF1594:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF874:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF2468:
+	.string	"FEATURE_SOFTSPI"
+.LASF2053:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1080:
+	.string	"__DECL_SIMD_logf"
+.LASF2285:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1093:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1939:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1639:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF873:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1991:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2716:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF2175:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1193:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1660:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1624:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1452:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF925:
+	.string	"__DECL_SIMD_expm1 "
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1824:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1313:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2638:
+	.string	"midrc"
+.LASF1264:
+	.string	"_Mdouble_ _Float128"
+.LASF1374:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF1736:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2020:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2481:
+	.string	"dterm_average_count"
+.LASF1044:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1419:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1422:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF2101:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2335:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1960:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1432:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF1136:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2213:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1467:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1922:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2000:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1874:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2202:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2032:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1438:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF2217:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1353:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF2482:
+	.string	"vbatPidCompensation"
+.LASF2277:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF987:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2158:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF2302:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF2295:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF2707:
+	.string	"areSticksInApModePosition"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF825:
+	.string	"__DECL_SIMD_log "
+.LASF2578:
+	.string	"GPS_FIX"
+.LASF1802:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF819:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF992:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1827:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF2550:
+	.string	"rcCommand"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1417:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF941:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1266:
+	.string	"_Mdouble_ _Float32x"
+.LASF1640:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF936:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2603:
+	.string	"BEEPER_ALL"
+.LASF1221:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2583:
+	.string	"BEEPER_SILENCE"
+.LASF881:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1803:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF849:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2669:
+	.string	"pgResetTemplate_armingConfig"
+.LASF980:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1566:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF865:
+	.string	"__DECL_SIMD_atan "
+.LASF2625:
+	.string	"rxConfig_s"
+.LASF2181:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1912:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1593:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1977:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1272:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2575:
+	.string	"WAS_EVER_ARMED"
+.LASF1481:
+	.string	"CMS "
+.LASF2395:
+	.string	"reset"
+.LASF1130:
+	.string	"__DECL_SIMD_atan2"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1667:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1910:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF2591:
+	.string	"BEEPER_BAT_LOW"
+.LASF1281:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1404:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF882:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2420:
+	.string	"OWNER_SDCARD"
+.LASF1286:
+	.string	"__MATHCALL_NAME"
+.LASF1682:
+	.string	"PG_RX_CONFIG 24"
+.LASF985:
+	.string	"__DECL_SIMD_log1p "
+.LASF2520:
+	.string	"BOX3DDISABLESWITCH"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF2046:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF2226:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF1057:
+	.string	"__DECL_SIMD_tanl "
+.LASF912:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2132:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1330:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1707:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF2308:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF2377:
+	.string	"int16_t"
+.LASF1704:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1979:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1384:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1940:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2368:
+	.string	"signed char"
+.LASF1194:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1618:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF830:
+	.string	"__DECL_SIMD_logf64 "
+.LASF813:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1880:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2061:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2543:
+	.string	"modeActivationCondition_s"
+.LASF2547:
+	.string	"modeActivationCondition_t"
+.LASF1915:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1316:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1478:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1535:
+	.string	"U_ID_1 1"
+.LASF934:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1209:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1164:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1555:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1521:
+	.string	"_WCHAR_T_H "
+.LASF1953:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1675:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2183:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1144:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF2457:
+	.string	"FEATURE_RSSI_ADC"
+.LASF2580:
+	.string	"SMALL_ANGLE"
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1644:
+	.string	"sq(x) ((x)*(x))"
+.LASF809:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF981:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1289:
+	.string	"_Mret_ double"
+.LASF1111:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1770:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2038:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1957:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2185:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1095:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1196:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2587:
+	.string	"BEEPER_DISARMING"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1219:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2645:
+	.string	"rcSmoothingCutoffHz"
+.LASF1476:
+	.string	"TELEMETRY_LTM "
+.LASF2194:
+	.string	"LAT 0"
+.LASF1446:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1386:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1789:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF2499:
+	.string	"BOXCAMSTAB"
+.LASF2234:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF977:
+	.string	"__DECL_SIMD_log2l "
+.LASF2244:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2156:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2167:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1683:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1078:
+	.string	"__DECL_SIMD_log"
+.LASF2614:
+	.string	"SENSOR_MAG"
+.LASF2083:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2381:
+	.string	"uint32_t"
+.LASF1185:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2204:
+	.string	"VTX_BAND_MAX 5"
+.LASF2035:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2442:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2519:
+	.string	"BOXAIRMODE"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2627:
+	.string	"serialrx_provider"
+.LASF1687:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1258:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2182:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1869:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF2672:
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1285:
+	.string	"_Marg_"
+.LASF1036:
+	.string	"__DECL_SIMD_asinhf "
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2076:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1471:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1499:
+	.string	"_ANSI_STDDEF_H "
+.LASF1670:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1737:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2435:
+	.string	"OWNER_OSD"
+.LASF821:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1813:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2047:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2130:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2388:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF831:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2096:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1692:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1879:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2062:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2251:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1725:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2497:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1828:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1346:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1798:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2191:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1211:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1587:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1835:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1411:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2699:
+	.string	"throttleStatus"
+.LASF1299:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF1872:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1778:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF822:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1255:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2572:
+	.string	"OK_TO_ARM"
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF1913:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2668:
+	.string	"rcControlsConfig_Registry"
+.LASF1195:
+	.string	"__f32(x) x ##f32"
+.LASF2164:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF2354:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1642:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1621:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2487:
+	.string	"itermAcceleratorGain"
+.LASF1320:
+	.string	"FP_ZERO 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1752:
+	.string	"IOCFG_AF_OD 0"
+.LASF2073:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2698:
+	.string	"processRcStickPositions"
+.LASF839:
+	.string	"__DECL_SIMD_expf32 "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1821:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF838:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2184:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1804:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1962:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2287:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF2085:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF2004:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2460:
+	.string	"FEATURE_OSD"
+.LASF2209:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1711:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1712:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF982:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2544:
+	.string	"modeId"
+.LASF2210:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1119:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1990:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1989:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1139:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF2582:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1233:
+	.string	"FP_INT_TONEAREST 4"
+.LASF1785:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1686:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF2078:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2375:
+	.string	"long int"
+.LASF2172:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1102:
+	.string	"__DECL_SIMD_hypot"
+.LASF1679:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1873:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF2353:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF978:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1723:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2196:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1656:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF1014:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1925:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2410:
+	.string	"OWNER_PINDEBUG"
+.LASF1852:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2119:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF927:
+	.string	"__DECL_SIMD_expm1l "
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2361:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF2510:
+	.string	"BOXOSD"
+.LASF2189:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF2201:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1482:
+	.string	"TELEMETRY_CRSF "
+.LASF1924:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1504:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1765:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2617:
+	.string	"SENSOR_GPSMAG"
+.LASF2016:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1503:
+	.string	"__PTRDIFF_T "
+.LASF1495:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF942:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1952:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1878:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1240:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1540:
+	.string	"ACC "
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2512:
+	.string	"BOXGTUNE"
+.LASF1199:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF2018:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF945:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2245:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1763:
+	.string	"EXPAND_I(x) x"
+.LASF1928:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2692:
+	.string	"updateActivatedModes"
+.LASF2328:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF2019:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2398:
+	.string	"OWNER_PWMINPUT"
+.LASF1885:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1246:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1967:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF2306:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF1651:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1074:
+	.string	"__DECL_SIMD_sincos"
+.LASF877:
+	.string	"__DECL_SIMD_asinl "
+.LASF1767:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1534:
+	.string	"U_ID_0 0"
+.LASF1147:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1143:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1157:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2573:
+	.string	"PREVENT_ARMING"
+.LASF1349:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2057:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF975:
+	.string	"__DECL_SIMD_log2 "
+.LASF1850:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1529:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2324:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF963:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2272:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF994:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1435:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2502:
+	.string	"BOXGPSHOLD"
+.LASF1200:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1004:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2566:
+	.string	"armingConfig_s"
+.LASF2570:
+	.string	"armingConfig_t"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1722:
+	.string	"PG_PID_CONFIG 504"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2508:
+	.string	"BOXCALIB"
+.LASF2009:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1202:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF845:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1568:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1332:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1345:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2498:
+	.string	"BOXHEADADJ"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1702:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1636:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1514:
+	.string	"_T_WCHAR_ "
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1430:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1868:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF2279:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1917:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF2140:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1399:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF2501:
+	.string	"BOXGPSHOME"
+.LASF2480:
+	.string	"pidSumLimitYaw"
+.LASF2411:
+	.string	"OWNER_TIMER"
+.LASF2229:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1703:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1457:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2688:
+	.string	"modeActivationConditions"
+.LASF1854:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2051:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2489:
+	.string	"dtermSetpointWeight"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1783:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF2027:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"USE_FAKE_MAG "
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1795:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1088:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1582:
+	.string	"BLACKBOX"
+.LASF1101:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1278:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2284:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF2657:
+	.string	"PIDPOS"
+.LASF971:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF783:
+	.string	"__size_t "
+.LASF2010:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1480:
+	.string	"GPS "
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF2136:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1526:
+	.string	"__DEFINED_wchar_t "
+.LASF1188:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1861:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1427:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF1635:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1751:
+	.string	"IOCFG_AF_PP 0"
+.LASF968:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1560:
+	.string	"USE_SERIALRX_IBUS"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF885:
+	.string	"__DECL_SIMD_hypot "
+.LASF2537:
+	.string	"THROTTLE_HIGH"
+.LASF1223:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2541:
+	.string	"endStep"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2505:
+	.string	"BOXLEDMAX"
+.LASF2517:
+	.string	"BOXBLACKBOX"
+.LASF1445:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF841:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1306:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF800:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF972:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF864:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF2233:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF2049:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1741:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2157:
+	.string	"BEEP_ON do {} while(0)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2423:
+	.string	"OWNER_FLASH_CS"
+.LASF1996:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1228:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF2396:
+	.string	"pgRegistry_t"
+.LASF1565:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1490:
+	.string	"USE_RX_MSP "
+.LASF1759:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1970:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF2022:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF802:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2153:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF2179:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2207:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF2677:
+	.string	"sensors"
+.LASF1653:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF856:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF2339:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2253:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF2326:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF842:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1104:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1875:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2329:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2241:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1183:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF851:
+	.string	"__DECL_SIMD_powf128 "
+.LASF765:
+	.string	"__need_NULL "
+.LASF944:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1115:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1455:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1558:
+	.string	"SERIAL_RX"
+.LASF1796:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1607:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1839:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2473:
+	.string	"dterm_filter_type"
+.LASF1121:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1361:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF880:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2684:
+	.string	"mwArm"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1973:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF1695:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2152:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF2115:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1559:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1588:
+	.string	"USE_PROFILE "
+.LASF2214:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF2448:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2709:
+	.string	"isUsingSticksForArming"
+.LASF1580:
+	.string	"VTX_SMARTAUDIO"
+.LASF1466:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2415:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1889:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2407:
+	.string	"OWNER_ADC_RSSI"
+.LASF1612:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1137:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2239:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2050:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1368:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1105:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF906:
+	.string	"__DECL_SIMD_exp10f "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1284:
+	.string	"_Mret_"
+.LASF2192:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2493:
+	.string	"BOXANGLE"
+.LASF1905:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1528:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1776:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1502:
+	.string	"_T_PTRDIFF "
+.LASF870:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1390:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF1062:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1005:
+	.string	"__DECL_SIMD_acosh "
+.LASF2600:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1982:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2461:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF2342:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1429:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1541:
+	.string	"USE_FAKE_ACC "
+.LASF1367:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1315:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1724:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2030:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2585:
+	.string	"BEEPER_RX_LOST"
+.LASF1447:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1226:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1318:
+	.string	"FP_NAN 0"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1993:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2331:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2125:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF918:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1015:
+	.string	"__DECL_SIMD_erf "
+.LASF1342:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1107:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1945:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2043:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1222:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2466:
+	.string	"FEATURE_VTX"
+.LASF2227:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1950:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1739:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF2071:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2349:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1152:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1355:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF1986:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2147:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2621:
+	.string	"rollAndPitchTrims_t_def"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1131:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2679:
+	.string	"gyroSetCalibrationCycles"
+.LASF1677:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1944:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2527:
+	.string	"THROTTLE"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2708:
+	.string	"ap_mode"
+.LASF1077:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1424:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1230:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF855:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1217:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF2305:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2176:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF832:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1713:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1630:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1771:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2518:
+	.string	"BOXFAILSAFE"
+.LASF1965:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1715:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1458:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1204:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1454:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1296:
+	.string	"_Marg_ _Float64x"
+.LASF2315:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF1444:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1631:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1087:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2041:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2384:
+	.string	"double"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1897:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2247:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF858:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1735:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF2122:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2359:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1779:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF955:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1203:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1397:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF2418:
+	.string	"OWNER_I2C_SCL"
+.LASF1092:
+	.string	"__DECL_SIMD_acosf"
+.LASF1150:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2441:
+	.string	"OWNER_COMPASS_CS"
+.LASF1517:
+	.string	"_WCHAR_T_ "
+.LASF2358:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1085:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1825:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF2271:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2540:
+	.string	"startStep"
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2470:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF1663:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2456:
+	.string	"FEATURE_RX_MSP"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1731:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2476:
+	.string	"dterm_notch_hz"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2643:
+	.string	"rcInterpolationInterval"
+.LASF1518:
+	.string	"_BSD_WCHAR_T_ "
+.LASF903:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1968:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2450:
+	.string	"FEATURE_GPS"
+.LASF2478:
+	.string	"itermWindupPointPercent"
+.LASF1781:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2232:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1602:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2551:
+	.string	"rcControlsConfig_s"
+.LASF2557:
+	.string	"rcControlsConfig_t"
+.LASF1341:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2093:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2523:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2373:
+	.string	"__int32_t"
+.LASF2711:
+	.string	"rxConfig"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2419:
+	.string	"OWNER_I2C_SDA"
+.LASF2344:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2509:
+	.string	"BOXGOV"
+.LASF2554:
+	.string	"alt_hold_deadband"
+.LASF1654:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1988:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF2054:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1745:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2458:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1680:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1658:
+	.string	"Q12 (1 << 12)"
+.LASF2278:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF1442:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1460:
+	.string	"USE_CLI "
+.LASF1966:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1214:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF1156:
+	.string	"__DECL_SIMD_erff"
+.LASF1564:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1844:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF929:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF2097:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1391:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF2424:
+	.string	"OWNER_FLASH"
+.LASF857:
+	.string	"__DECL_SIMD_acosl "
+.LASF1293:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1709:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1450:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF1083:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2356:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1109:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF2581:
+	.string	"FIXED_WING"
+.LASF1181:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1153:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1241:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF846:
+	.string	"__DECL_SIMD_powf "
+.LASF2341:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1515:
+	.string	"_T_WCHAR "
+.LASF2064:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1899:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF2134:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF2337:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1887:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1376:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF883:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2267:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1498:
+	.string	"_STDDEF_H_ "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF875:
+	.string	"__DECL_SIMD_asin "
+.LASF2150:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1904:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1065:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1274:
+	.string	"__MATHCALL"
+.LASF969:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1757:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2028:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1388:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1576:
+	.string	"USE_DASHBOARD"
+.LASF917:
+	.string	"__DECL_SIMD_coshl "
+.LASF1863:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1837:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1937:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1338:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1448:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1335:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF2436:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF1022:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1494:
+	.string	"VTX_CONTROL "
+.LASF995:
+	.string	"__DECL_SIMD_atanh "
+.LASF2530:
+	.string	"AUX3"
+.LASF2039:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2439:
+	.string	"OWNER_TRANSPONDER"
+.LASF1681:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2532:
+	.string	"AUX5"
+.LASF1225:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF2534:
+	.string	"AUX7"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF2129:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF907:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2025:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2538:
+	.string	"throttleStatus_e"
+.LASF984:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1890:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2488:
+	.string	"setpointRelaxRatio"
+.LASF1650:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2094:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2717:
+	.string	"rc_alias"
+.LASF1505:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1173:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1100:
+	.string	"__DECL_SIMD_asinf"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1162:
+	.string	"__DECL_SIMD_asinh"
+.LASF2011:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2336:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF2521:
+	.string	"BOXFPVANGLEMIX"
+.LASF924:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1949:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF886:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF820:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2160:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF871:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1297:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2561:
+	.string	"deadband3d_high"
+.LASF1324:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF382:
+	.string	"unix 1"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1538:
+	.string	"GYRO "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1360:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1023:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1148:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF964:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF850:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2348:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1363:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2426:
+	.string	"OWNER_MPU_CS"
+.LASF2386:
+	.string	"pgn_t"
+.LASF1727:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2021:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1175:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1662:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2133:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2320:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2286:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2098:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF872:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2601:
+	.string	"BEEPER_USB"
+.LASF2231:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF2556:
+	.string	"yaw_control_reversed"
+.LASF2595:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1544:
+	.string	"MAG "
+.LASF2586:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF896:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF2376:
+	.string	"char"
+.LASF1772:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1112:
+	.string	"__DECL_SIMD_exp10f"
+.LASF2618:
+	.string	"rollAndPitchTrims_s"
+.LASF2623:
+	.string	"rollAndPitchTrims_t"
+.LASF2718:
+	.string	"rollAndPitchTrims_u"
+.LASF1174:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1552:
+	.string	"USE_UART7 "
+.LASF2117:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2483:
+	.string	"pidAtMinThrottle"
+.LASF2100:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1595:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1259:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1801:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1664:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF986:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1638:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1369:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1071:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1773:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2545:
+	.string	"auxChannelIndex"
+.LASF923:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF930:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1830:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2686:
+	.string	"handleInflightCalibrationStickPosition"
+.LASF2205:
+	.string	"VTX_CHANNEL_MIN 1"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1034:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2397:
+	.string	"OWNER_FREE"
+.LASF905:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1604:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF2266:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF919:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF893:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1451:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF2549:
+	.string	"modeActivationConditions_SystemArray"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF810:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1815:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1643:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF2077:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1058:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF2559:
+	.string	"flight3DConfig_s"
+.LASF2564:
+	.string	"flight3DConfig_t"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1436:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF2674:
+	.string	"changePidProfile"
+.LASF1834:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1357:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF2632:
+	.string	"rx_spi_rf_channel_count"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1192:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2135:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2159:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF2310:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1918:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2220:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF2139:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2215:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF1998:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF853:
+	.string	"__DECL_SIMD_powf64x "
+.LASF803:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2174:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF2249:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF2246:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1613:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1590:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF867:
+	.string	"__DECL_SIMD_atanl "
+.LASF1553:
+	.string	"USE_UART8 "
+.LASF2199:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1294:
+	.string	"_Marg_ _Float64"
+.LASF1046:
+	.string	"__DECL_SIMD_erfcf "
+.LASF2282:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2289:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1282:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1506:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1818:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF998:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1021:
+	.string	"__DECL_SIMD_erff128 "
+.LASF904:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF938:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2015:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2138:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF859:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1356:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1302:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1410:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF2212:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2171:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF847:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1894:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1287:
+	.string	"_Marg_ long double"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF824:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1385:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF2454:
+	.string	"FEATURE_3D"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2264:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF2332:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1668:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2421:
+	.string	"OWNER_SDCARD_CS"
+.LASF2700:
+	.string	"rcDelayCommand"
+.LASF1262:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2290:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1974:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1377:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1615:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1833:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1657:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2200:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF2626:
+	.string	"rcmap"
+.LASF2611:
+	.string	"SENSOR_GYRO"
+.LASF1269:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1463:
+	.string	"SERIAL_RX "
+.LASF2270:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1797:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1782:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2676:
+	.string	"memset"
+.LASF2095:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF926:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1700:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1546:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF2293:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF2120:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2265:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF2006:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2066:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2671:
+	.string	"modeActivationConditions_Registry"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2301:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2659:
+	.string	"PIDNAVR"
+.LASF2257:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1871:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2665:
+	.string	"pidProfile"
+.LASF1938:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF1016:
+	.string	"__DECL_SIMD_erff "
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF2162:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF2555:
+	.string	"alt_hold_fast_change"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1290:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF1728:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1352:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2017:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1403:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1902:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1554:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF887:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF798:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF2198:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2367:
+	.string	"long unsigned int"
+.LASF1775:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2438:
+	.string	"OWNER_LED_STRIP"
+.LASF2034:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1547:
+	.string	"USE_UART2 "
+.LASF1493:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1496:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF2333:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1605:
+	.string	"__disable_irq() "
+.LASF2663:
+	.string	"PID_ITEM_COUNT"
+.LASF1154:
+	.string	"__DECL_SIMD_erf"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1326:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1407:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1579:
+	.string	"VTX_CONTROL"
+.LASF817:
+	.string	"__DECL_SIMD_sincosl "
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2142:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2236:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF2610:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1969:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1359:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF2371:
+	.string	"short int"
+.LASF1413:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF2325:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1098:
+	.string	"__DECL_SIMD_asin"
+.LASF1699:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2490:
+	.string	"yawRateAccelLimit"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2694:
+	.string	"modeActivationCondition"
+.LASF1947:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1805:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF897:
+	.string	"__DECL_SIMD_exp2l "
+.LASF834:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1362:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1548:
+	.string	"USE_UART3 "
+.LASF1242:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF2291:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1710:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2294:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF2206:
+	.string	"VTX_CHANNEL_MAX 8"
+.LASF1516:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2567:
+	.string	"gyro_cal_on_first_arm"
+.LASF2475:
+	.string	"yaw_lpf_hz"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1132:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1086:
+	.string	"__DECL_SIMD_pow"
+.LASF2322:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2304:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF2425:
+	.string	"OWNER_BARO_CS"
+.LASF2588:
+	.string	"BEEPER_ARMING"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1300:
+	.string	"_Mret_ _Float32x"
+.LASF2560:
+	.string	"deadband3d_low"
+.LASF1718:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1864:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2281:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF1876:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1649:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF1416:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF2648:
+	.string	"airModeActivateThreshold"
+.LASF1606:
+	.string	"__enable_irq() "
+.LASF2366:
+	.string	"unsigned int"
+.LASF2606:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1549:
+	.string	"USE_UART4 "
+.LASF889:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1054:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2273:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1954:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2696:
+	.string	"channelValue"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF1574:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1777:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1186:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1758:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2256:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF2298:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF956:
+	.string	"__DECL_SIMD_atan2f "
+.LASF815:
+	.string	"__DECL_SIMD_sincos "
+.LASF2084:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2503:
+	.string	"BOXPASSTHRU"
+.LASF1082:
+	.string	"__DECL_SIMD_exp"
+.LASF1365:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1726:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1366:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF2403:
+	.string	"OWNER_ADC"
+.LASF908:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2430:
+	.string	"OWNER_MPU_EXTI"
+.LASF2552:
+	.string	"deadband"
+.LASF806:
+	.string	"__DECL_SIMD_sinf "
+.LASF1081:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF958:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2106:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2486:
+	.string	"itermThrottleThreshold"
+.LASF1379:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF2500:
+	.string	"BOXCAMTRIG"
+.LASF2052:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1550:
+	.string	"USE_UART5 "
+.LASF2069:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1671:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1120:
+	.string	"__DECL_SIMD_expm1f"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF2228:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF1756:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1573:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2406:
+	.string	"OWNER_ADC_EXT"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1717:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2352:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1866:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1076:
+	.string	"__DECL_SIMD_sincosf"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2218:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1182:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2427:
+	.string	"OWNER_OSD_CS"
+.LASF2719:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2110:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1632:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1340:
+	.string	"M_E 2.7182818284590452354"
+.LASF1754:
+	.string	"IOCFG_IPU 0"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1295:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1418:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2126:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1551:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1916:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2805:
+	.string	"rx_pwm.h"
+.LASF2781:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2737:
+	.string	"/usr/include"
+.LASF2787:
+	.string	"mathcalls-helper-functions.h"
+.LASF2783:
+	.string	"floatn-common.h"
+.LASF2763:
+	.string	"stdint.h"
+.LASF2721:
+	.string	"src/main/build"
+.LASF2734:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2755:
+	.string	"barometer.h"
+.LASF2762:
+	.string	"stdbool.h"
+.LASF2804:
+	.string	"flash.h"
+.LASF2790:
+	.string	"iscanonical.h"
+.LASF2797:
+	.string	"time.h"
+.LASF2767:
+	.string	"wordsize.h"
+.LASF2829:
+	.string	"navigation.h"
+.LASF2730:
+	.string	"src/main/target/SITL"
+.LASF2788:
+	.string	"mathcalls.h"
+.LASF2826:
+	.string	"accgyro.h"
+.LASF2754:
+	.string	"fc_core.h"
+.LASF2812:
+	.string	"sound_beeper.h"
+.LASF2794:
+	.string	"common_post.h"
+.LASF2816:
+	.string	"motors.h"
+.LASF2764:
+	.string	"libc-header-start.h"
+.LASF2814:
+	.string	"fc_rc.h"
+.LASF2791:
+	.string	"platform.h"
+.LASF2738:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2824:
+	.string	"voltage_ids.h"
+.LASF2795:
+	.string	"blackbox.h"
+.LASF2744:
+	.string	"resource.h"
+.LASF2726:
+	.string	"src/main/flight"
+.LASF2761:
+	.string	"stdc-predef.h"
+.LASF2806:
+	.string	"sdcard.h"
+.LASF2779:
+	.string	"math.h"
+.LASF2733:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2820:
+	.string	"filter.h"
+.LASF2765:
+	.string	"features.h"
+.LASF2732:
+	.string	"src/main"
+.LASF2727:
+	.string	"src/main/io"
+.LASF2780:
+	.string	"math-vector.h"
+.LASF2723:
+	.string	"src/main/config"
+.LASF2766:
+	.string	"features-time64.h"
+.LASF2778:
+	.string	"strings.h"
+.LASF2759:
+	.string	"feature.h"
+.LASF2827:
+	.string	"exti.h"
+.LASF2749:
+	.string	"beeper.h"
+.LASF2748:
+	.string	"runtime_config.h"
+.LASF2745:
+	.string	"config.h"
+.LASF2785:
+	.string	"fp-logb.h"
+.LASF2757:
+	.string	"gyro.h"
+.LASF2774:
+	.string	"time64.h"
+.LASF2756:
+	.string	"string.h"
+.LASF2793:
+	.string	"target.h"
+.LASF2809:
+	.string	"io_def.h"
+.LASF2760:
+	.string	"maths.h"
+.LASF2800:
+	.string	"parameter_group_ids.h"
+.LASF2775:
+	.string	"wchar.h"
+.LASF2768:
+	.string	"timesize.h"
+.LASF2722:
+	.string	"src/main/common"
+.LASF2823:
+	.string	"voltage.h"
+.LASF2752:
+	.string	"rx.h"
+.LASF2821:
+	.string	"current.h"
+.LASF2758:
+	.string	"failsafe.h"
+.LASF2815:
+	.string	"gps.h"
+.LASF2751:
+	.string	"acceleration.h"
+.LASF2742:
+	.string	"stddef.h"
+.LASF2786:
+	.string	"fp-fast.h"
+.LASF2725:
+	.string	"src/main/fc"
+.LASF2782:
+	.string	"floatn.h"
+.LASF2792:
+	.string	"common.h"
+.LASF2772:
+	.string	"stubs-64.h"
+.LASF2771:
+	.string	"stubs.h"
+.LASF2743:
+	.string	"parameter_group.h"
+.LASF2746:
+	.string	"pid.h"
+.LASF2811:
+	.string	"io_def_generated.h"
+.LASF2822:
+	.string	"current_ids.h"
+.LASF2750:
+	.string	"sensors.h"
+.LASF2813:
+	.string	"vcd.h"
+.LASF2828:
+	.string	"accgyro_mpu.h"
+.LASF2808:
+	.string	"io.h"
+.LASF2741:
+	.string	"stdint-uintn.h"
+.LASF2753:
+	.string	"rc_controls.c"
+.LASF2769:
+	.string	"cdefs.h"
+.LASF2802:
+	.string	"adc.h"
+.LASF2770:
+	.string	"long-double.h"
+.LASF2747:
+	.string	"rc_controls.h"
+.LASF2819:
+	.string	"battery.h"
+.LASF0:
+	.string	"./src/main/fc/rc_controls.c"
+.LASF2784:
+	.string	"flt-eval-method.h"
+.LASF2728:
+	.string	"src/main/rx"
+.LASF2773:
+	.string	"typesizes.h"
+.LASF2720:
+	.string	"src/main/blackbox"
+.LASF2817:
+	.string	"vtx.h"
+.LASF2825:
+	.string	"sensor.h"
+.LASF2776:
+	.string	"locale_t.h"
+.LASF2731:
+	.string	"src/main/target"
+.LASF2799:
+	.string	"axis.h"
+.LASF2736:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2801:
+	.string	"system.h"
+.LASF2724:
+	.string	"src/main/drivers"
+.LASF2807:
+	.string	"serial.h"
+.LASF2810:
+	.string	"utils.h"
+.LASF2798:
+	.string	"build_config.h"
+.LASF2818:
+	.string	"dashboard.h"
+.LASF2729:
+	.string	"src/main/sensors"
+.LASF2740:
+	.string	"stdint-intn.h"
+.LASF2789:
+	.string	"mathcalls-narrow.h"
+.LASF2777:
+	.string	"__locale_t.h"
+.LASF2739:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2796:
+	.string	"blackbox_fielddefs.h"
+.LASF2803:
+	.string	"io_types.h"
+.LASF2735:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"e\b"
+	.string	"\304\013\264\001"
+	.string	"\032"
+	.string	"\305\262\227\241\001\006\002"
+	.string	"\002\001\002\002\002\003\002\002\002\004\004\237\254\373\212\007\002\002\005\002\005\005\240\342\234\212\n\006\350\300\306\254\005\002\002\006\002\006\007\242\302\263\302\013\b\372\241\252\265\017\004\002"
+	.string	"\002\007\t\n\265\274\305\340\003\006\013\266\371\324\246\bJ\b\006\002\t\n\n\002\n\f\r\016\020\022\331\374\375\316\004\006\002\013\002\f\002\b\023\226\336\200\374\r"
+	.string	"\002\001\024\213\304\374\314\002\020\f\002\f\002\r\005\002\005\025\026\345\230\223\317\b\002\027\311\220\216\317\b\n\002\016\002\016\030\031\236\226\331\300\016\032\237\375\370\351\b\033\254\261\340\027\034\353\227\221\315\013\035\211\232\357\222\n\036\240\342\234\212\n"
+	.ascii	"# \200\002#e\345\001o\021\260\003P\212=\240\0311M\320.\314ZH"
+	.ascii	"\312\002\345\364\333\202{7\260\246=\376\215]\221\360\356\255"
+	.ascii	"\246\255\220\311\r+\001\205\020\216\r\3207Z\243\365@w\300\234"
+	.ascii	"L\342Z\031\261(\004\364a\311w\301\333SL7"
+	.text
+	.section	.gnu.lto_.ipa_sra.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375 \217M\002"
+	.string	"\022\204\013\023\260'\215\001\f\3030\f0\0133$`#)\264\275e\n\367\310\261F\025\032\266m\r\tDE%b{gZ\203\372\231Z\256@}&\001\n"
+	.ascii	"@\b\245\326\253\030wi\0308\341V\220\363\230\\\337c\266\001\203"
+	.ascii	"6"
+	.text
+	.section	.gnu.lto_.inline.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`\312\001\215\f"
+	.string	"\326\322C>@\211(\215\001\355\326\030\266\251rV\366a\214\227\030\237l\376\324\337\225\263\213\340\327\003EFy\r\017$\0168\330\324\372\0215\214\031S\340\242(\336\035\016\200_\252\025iB\356!mo)S1"
+	.string	"4"
+	.string	"1"
+	.string	"[a\316M\2665\271\226\332\356\006\343\325\353\217\301\005"
+	.string	"\322\240\303\024D\030P"
+	.string	";\276\333\3169g\365\026\320\301\2343\333\327\313\006\230sb\177\275\002\002\037#\005\207\265\245/D]\343\321\262r\271e9\013\030\200$fG\031\b<\372 \376\223U\255\250&\213\361\256\230\245\340A\300\200~\342u-\034\315\271\251\\\004\221W\3065HB\231@\2217\276\272\301\224G\232\300 \377\006\371p\311\252\302\365\002C\241\224\204\312\224\215\3523\333\361q\036\304\276f\366\343\343<\311Yw>\316\213\370|\234\227\375"
+	.ascii	"\341\300IDY\315V\337\356$\362X;\374\032\310\351J\235\t\r\324"
+	.ascii	"\350J\035\211+\257-\te\n\211co+\3276\224\362\022\0046 @B\305"
+	.ascii	"\\\225\007x-\340\261\302v!F\"@\2224\271\245\007\304V\257kEg\317"
+	.ascii	"\210\024\210\224\302\227\356H2[\341\030\256>\227{\205k\034\330"
+	.ascii	"\234\342)[K\031\024\r\300\177iE\364\0058\207)\001w\002\016\020"
+	.ascii	" e\\/\003\264y\256h\003\220\013\355\276pgZ\021\313Cz\325Pp\373"
+	.ascii	"q\315\003\217\025\370rM\356\033`\b\343\035\321\005{\210\366\025"
+	.ascii	"L'<\301\r\367\36647\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\215\005"
+	.string	"\322\210\033#\200EI\007lFZr\206\031"
+	.string	"\221;\272&\244\243\n\243\205\313E\200\027\336\243\366c\377\263\335\217\020\231dL,J[\202 \017\203\322\240,m\2026\3027al\306\221\333\265:s\234\271\236\230\240\004M\200\253R3\340J\256\270C\376\361\265\235{\347:\035U\021\331\002k\032.\245-}\200<r\025\251h\366y\236\033\327\222\212$\343\213\033"
+	.string	"G\025\035sp\227\221\270\001p\027\364\\\265@QQ\277\n\003\342\222 <\320\231\341W\213\375\020\226\251\3006\257\201\2714\357\311I\234:\345\302)\023\324\035Q\215\031\205E\244ha\271\254"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.pureconst.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\230\004\004\230\004\006\204\004\b\204\004\n\230\004\013\230"
+	.ascii	"\004\022\205\004\023\205\004\024\231\004\026\204\004\027\231"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"m\005"
+	.ascii	"\202\307\027\037\2209\303\001\320\377\377\317\272\203\330f\377"
+	.ascii	"\262\325j\266\300?\"\311V_\216\304i\323&[\312\024; \221\306\232"
+	.ascii	"O\371\323N-@\022\273\022\242\316V\336\2328\201\345IF\355\277"
+	.ascii	"\216]\007\214\366\266\256\202\001\322s\2762\261Q\314\202\035"
+	.ascii	"\027EI\247L\022\235\210\362C\247\241\034\252\272Yy>\002\" `\002"
+	.ascii	"STw}\214S\254\003{\363\260\357NC\23311\204\200\335\206U\343\300"
+	.ascii	"8\f!S2l$;\be@\265Z\222\f\264\254\024\212m:\007\023l\311\260T"
+	.ascii	"7\313\t/\f\260\201\033w\304\240q\016\3416\201\320\206\013\007"
+	.text
+	.section	.gnu.lto_.lto.a40cbe370fcd07f8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.87.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375 \206\005\004"
+	.string	"$\007P"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\314\301\035\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\374\005us"
+	.string	"\005\001\006'\001\005\031(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	"K\205\220r5E5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.89.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375 :\255\001"
+	.string	"\244\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\001("
+	.string	"?\202\210\200(}{\276\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\003"
+	.ascii	"@D\312M\003(\002"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.92.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375 \206\005\004"
+	.string	"$\007P"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\303\325\301\025\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\336\005us"
+	.string	"\005\001\006'\001\003\020(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	"K\205\220r5E5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.94.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375 .E\001"
+	.string	"\360!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005\001"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.97.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375 y\311\003"
+	.string	"C"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\335\301\033\005yw"
+	.string	"\005\001\006'\001\240\001\005\001\006'\001)?\202\210\200(us\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.text
+	.section	.gnu.lto_isAirmodeActive.98.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`\300"
+	.string	"M\013"
+	.string	"f\326N>\020Q\234\016\203\263u\025\345\024p*\205\374\204\301\003\207\005\320\344D\031y\025\320\255k\326U'\354\353\347\f`\024\373DO0\020"
+	.string	""
+	.string	"@\021\312\240\215\027'\031\021a\\\202T\264\266\245L)>"
+	.string	";"
+	.string	"<"
+	.string	"Q;\\\273\00455\377\242K02\310\340:\314%"
+	.string	"\030\016!\235\005\030\331\335\252\333R\241\200N\b\016\322i\240\244CE\214\213\236\234n\313\334P\260\273N\256\273pO\267\275\300\266\304~\f\371\271\332\260\371a{\230T\220}\270\273k\375\330NS\232\206Nk\2463\323\017@\200\304_\264\330\355|4\326\205\264B\204\355\213]\031A\202\213\265{\241\3169\2146'f\354z\001P\233\224\312\264/\nyN\365\037\0326\305\344C\036\035)TA\266\263)U9Lpl\351a{\331tM\375\306\243\311\317\376\350#2\037\204+X\362\334%\3372]\272\026\360\340\311\004\266&Y\204\013\253P.\213\201\205E\353A\244@h !ZX\026'\003|Mp\200\305\312ua\261\362\366\372q\252\201'<p\250\034\333\224F2\2521TJ\277\251\221\311o\222\024t\375P\002\005\213\020"
+	.string	"N\b\230P\307\003Y\215%\004\003\312\330\252\fZgm\021^\302BY\312\004x\256\201"
+	.ascii	"\023\004\370=#\264T\025\222^[\240"
+	.text
+	.section	.gnu.lto_isUsingSticksForArming.99.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375 \356\245\006"
+	.string	"\202\214.4Pm\222\016\260&3\b\021\213\253\326\005\030"
+	.string	" \270\305 \220Q\376\265u\303\376\335\016;\273sj@E\210\235\231E\024\321w\200\007l\032Ld\247Y\262e\n?\214\246\241\2626\231\352!<\313\275\005\227aHpp\317\3228\314\345\352A\301r\233\252\262\034\225e\033\t\233\300\247E|=\372q]\215!8X\254\323\345"
+	.string	"t\302\026\2201\372`i\212\"\021\3453\0176\213o%\033\351\307\261YF&\227\221LP)%K&\221\215\277\363\324\005\006\235\257f\030\240V\204H\200\234df\256]\364*^\267\035\255pL\220`!O\321r\220\231#\026\022\365\326\177\340'\370E\001\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.100.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`5\001\r\r"
+	.string	"&ZZB\020\221\223\016\377e"
+	.string	"(\302\317\221\335\n}\004\203\324\001`n\347\252A\242e\311\035\356\001@l\255w\r!\351\203\350|\037\007\020"
+	.string	"\240RR\264B(\243i\201L\271)\206\n>y$\204\310-eJ\001H"
+	.string	"C"
+	.string	"F"
+	.ascii	"W\374\200\351j\333\t\026x\3749\027\342\345\037Z\264\304\324\330"
+	.ascii	"\345\256\004\361\317\365%~|\212\304A\f"
+	.string	"\016,D\033\350\252\341\317\332.`\006\330X\336\307\356\036\305\321e[A\244Hv\327(\3322\334\323mC\260\375\300~(\230$\373ow\3279\262\215\256^\372\251D\253\242\337C\247\242\361\241\337A\225\230\341\321\355\276t7V\206\312\220\260\355\261-\333\300\006\005\211\366M\374\204\347%\013\326\335\016/\\\354r\"\006\251\256\002N`\n/_\216^\346\313\003\"_\021\223\371N\304qwA\231$S\211\t\240\004\003\203\005g\374\304\234p`\230\261\035r\030N\265\273\f\374\024W\221\371#\256\256\320\301\213\256~g\272>/\0322!\354lyX\264as\240\036\331`#\r\020l6\232\002'\0212NI\212\teL\323\241\220i*(\031V\202i\027&\341B\231`\302\2710\255si<\234\245\234h\227J\226i\227\305\355\337\346\310\370@\216\031rM\027\333U~\204r\305\232U\276%G\b\273I\223\024\025"
+	.ascii	"\242s\360\363\241\227\270\341\375L\021\210\013\302\200|A\321"
+	.ascii	"`\017l\267\nQ-\230\201a%\237{/\252\265\001\027\206\3252\366h"
+	.ascii	"5\344U\205\253yo\273\212\036"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.101.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`\310\001\275\020"
+	.string	"\346\037nE"
+	.string	"\261&\035sD$\341$\271#7\202\003\307\330TN9G|m,0Y\003S\313\n,\233t\267F\254\223;APd8\212~\t\250\177N\330\365\237\265\301\310\004\344\035\237\203\001\263n\221m\204\354\275\245L)\\"
+	.string	"T"
+	.string	"Y"
+	.string	"\231\177\363\022.\036A\225\210\017\264\202q:\221cN\225\006\362\017\371\b/@>n\210\217~\311\bWG>\351\027\004\031\035\324\007s\tCdv<\204\276\023\374\340\001aC\203F\f\3460\373L\272\241/\003\004\231s>u}\371J\252\327\310\234\323\212\372:\334\330m\267\330\016\261u@\332\272\3169I\353\026\371\245\260\252aR\035\316\024d^$\355\024N\217\372\036\370`Z\222\237:\210u3c\352\016[U\322\245\261\017\347\316\330VgR\r\272\324\037\251\306\242\372\202j\271\352]\265\252\372\241k\207\247"
+	.string	"\21599\264xL\0311g\204}\034\027;\362\361\263\006jp\256\305\366\247\036\236\266D\256\342\0016\347L\340\243x\212\b\276\315\243%\224\224\310\307k?zr<m\031"
+	.string	"\313\305\306"
+	.string	"j\233lz\224\334]\222\017\227\306\027\311\335\343X\365|\212\244\356\356O1%m\3317\361\225\310\267\361\tJ\364Q\344\243\256\202\232\030/\336DV.p\035\213\n\267M\330:m\253\240\251X0I\321\266nE\023!`\016\303I\247\261p\\\247e*\357pg\260\033\251\030\361\037IC(\367\251\177H\334\364\220\376Hf\373b;[\217x[\272B\254\027\036Kg\203\\\032\203\026\333n\265\363Y\320\202\267`\200\315iB\340\2578\213\006\016HH\002& p\002!\242\264\003\342\202\200\310\341\373\305\276\327\356U{0_\300\026r\nfr\260\303\316\256\035\215/\245\261\276\3246\273re5p\257\305\316K=D\225 \334\241f8+m"
+	.string	"b"
+	.ascii	"\203\302&\0160[\334D\214Yl1\021\001\357&)\027\303\275\030\256"
+	.ascii	"n\310\325\247\267+\224\001"
+	.text
+	.section	.gnu.lto_processRcStickPositions.102.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`\334\026}a"
+	.string	"j\226(\"M0N\352\031\003/\200\245f\036\306\251\301\301\\\002\250\234\201/\212\013\230\235\310\246\226\036\322\346\337'\350ZM\324\236eux@\277\360\203K\274\324u4;\317\322\361\370B\0304\005T\005\377\312p\304\210#\342z\226*c6I\"SJ)\031\002\325\001\024\002\257\021\344\335\007\213\210\357K\335 \320\216\001\233^\324w\314\311\007\342\333a+\214`&\241F\223\213\372\2169\361\250D\261\222}db\031\341\004\002\332T\033\315-\352+\346\204\227\270$\361}\251I}\344\005\222}df\376\030\321\316\334K\232\t\264\3510`\230\367e#\354{_\352\022'%\373\330l\234\266\217l\333\264}d(\363\225\246\266\275]M\374j\222\370\276o\323\007a\266Yjs\322\241\315T)\001\002(Ab\204\210\020QP ><9y"
+	.string	"\240\211iI)\t\351\310\250\250\003\321\220P\020P\363\307\207\331\303\201gg\203N\016\316\215M\r\215\206\231\245\214\322\215\201I\"\333#\373\016\345\216\031\333j\246J\035@]\"'"
+	.ascii	"\031\333\0079:\200\022\213_\234\304\b/]\\D\b\305D\217bl(,W\034"
+	.ascii	"\004#\334\007\366(o\261I_\2430\2609\"p\315\3654\372\202?\265"
+	.ascii	"A\2608Y\251\342\036\202\030f\001\340\320\320\233\016\t\235i\260"
+	.ascii	"\227\364\224\330\247\033\211=\372\032\035d\225]\276X\350iT\320"
+	.ascii	"\223\244 E9\n\234\342F\310$pEl\210'/\037r\332\b\327\323(\237"
+	.ascii	"wHa\317\211\330\251\222\306\036\322k!\275<\017b\235\254c{}\215"
+	.ascii	">ae\342\256L{\032\265:P\t\315\037\274\366\251\243s&\023\357\301"
+	.ascii	"[\342\034\346\032\235gG\211\234o@N\351$)\3429J\2108\316\020\277"
+	.ascii	"ys\233iT\210\327(i\032\026\t\321o\006\0341\"`=\215\272\271\006"
+	.ascii	"%m>\023\202\017_*\001\272F\325\\\0069\245\004b\323\221\326\356"
+	.ascii	"5\232\3066\247Q\017<\206ER\233B\326\327h\017\026G\205\017^\350"
+	.ascii	"i\224\207\303\260\312\302#<\372\032Ec\237\320\364\n\273<\211"
+	.ascii	"\234\002A\307Y#\315\272\375b\233\0366\206\303\217e\315.\307n"
+	.ascii	"\260\315\367}\3351/\377\276k\244\266\276%\212l:\316\332\221S"
+	.ascii	"\357\373\262\203\215\351h6\321\314\254\021f\326\301\\\303AX)"
+	.ascii	"R\264}L\376\314\341\231[\217\\a^\312H\036\310\026\337w\235D\364"
+	.ascii	"#\342I\275\364a\314\"\223>\253n\320\033\257\225>l\351OT\361\362"
+	.ascii	".\006\220)\271{\341\245o\273f\337\367}\223/\205y\363clY<\263"
+	.ascii	"G\244O\3720\346\026\337vJ\275\364-\276q\250u\365\260\226%9\222"
+	.ascii	"E3[\244g\341\243})\367\233\337 \273\342/\360\243{\025\217\364"
+	.ascii	"a\310)\355#\031h\300\023\332\273n\r\254iH?\305u\\\321o3[\025"
+	.ascii	"\277\342]\360\213li\365\240\365\n\217\234\261/}\177gu\320\313"
+	.ascii	"\273\360?\353@\373=\220|_/(n\276\356\203`E\213\026m\037\377\211"
+	.ascii	"\016\351\372\375\373\213\221\313\033\201\364\023\027\311\367"
+	.ascii	"}Cp\347\265\336\013\356\267>2U\2257XU\333\307~\234\303?.4\025"
+	.ascii	"\337N\272\311\325\f\330*\275\212\357E\034\214]\336\310J\253\331"
+	.ascii	"\365\321\364\n\341\236\223D\304\220\371\335\342\265\237m;i\022"
+	.ascii	"k\\]\022\2213\\\373\256\033\250[S\324\362\272\027fj\227\277\264"
+	.ascii	"\360\bZ\037?\020\346\026,V\250h\272n)\3279\312u\206ZRJj'\315"
+	.ascii	"H\256\363\221\353l\344:\027\271\316\035\334\231\b\306y\310u\026"
+	.ascii	"r\235\203\\g \327\271\351\316?\356\354\343:3]\347\036\327\231"
+	.ascii	"\203"
+	.string	"\353\314\343\316;\256\363\006\327Y\307u\316q\235q\\\347\033w\266q\347\032\327\231\306u\326\240t\236Q:/\335Y\306uV\272\316n;i\216q\235a\\\347$\21432\306\271m\273\346#\2143\033\343\3740\316\236tn\027\235FM\314\362\303\367\276b\215_^*\307\277\"MB\267]\267\223Fz\353Go\231\273G\350j7\351;v\231{N\236\311_\242e\206t\220\243\303\317\303\360\264f\206\356\370\371\2475\337\223\302\023\345M\214h\017p\b\204\3074\003\232A\321\226{u.\304mK\310\307\311\331F\221\006\365\341\r\346\363$\326\260\250$\376P\356y\200\f\363\342\n\202\322\317\226\3710\320\260\230\217\263g6\263\346{;\200Z02\006\204\223\274\366<\216\233\365\274\216\033\227f\331P\333\026w\n\223\273\r\225\266\314\320 P7\257\337b7\312\317M\036\024v\310W\007>nbsx\327\243\034\362"
+	.string	"\223Q8\020\302|)\023\366\263\345y\247o\200\305\363:\312<\023zv<l'\257\216\303K\371\246\237\355\206\207\34196|O\036\022\0364\233)\204;\210-\365\315X=\364\t3#q\025\334"
+	.ascii	"\025\322\223W\306L\302\246\003-\322\352|_\207x\027\264\210o9"
+	.ascii	"\027\024\016z\004\032\007\215k\373\250\363E\207t9y;\002y4\346"
+	.ascii	"\274\224\277\237m\316\367\264:x\2237\226\303Hc\260o>\347\013"
+	.ascii	"\215\233\377i\354i\034#\216\315+C@b\363m\232;\013V\276\334\030"
+	.ascii	"v\315{\241\2203C\347\240L\274\301j\276\345\326\272~\253\223r"
+	.ascii	"o^6/\335\322Pll3[\232\207\342B\263X\323tf\023'\274\301\270\331"
+	.ascii	"\365[\234c\315\302\366@\201\213\206\331F\375\224\331j\370\250"
+	.ascii	"g\377:\323B\200\206'r;\273\261\022j\300\240\225\372f[Z\005\261"
+	.ascii	"<i\244`\032n\341\n\334\321+\024a\006E;\363\316j\243h\227?\363"
+	.ascii	"\375u\326\325U\332\n\212\002\0168\240\355\343\362\177\334\316"
+	.ascii	"\240"
+	.string	"<\241\351\031.m\2642\017\243Z\245\260]\260\201@\002\t\264}\224y\245\t\327\367Y\230qc\"\363R\274\276\366\264m\231\273V\255T\330\224\312\247\322`ZZ\371/\210C\r\t\215\b=\240\270/\345V\354g\013\363\316\252\340\224\nR\300\274\217\333Y\\\220\241\034\221\0306\251\3641\037\026\363\311\207Q=\344\016\354(O\3567\0163d4\220\205u\214\321X\316\252\254*\031W\316*\253**\252\027:/\262\254\252\006\220\021\303\331\300\004TY1\024\210\200\002\023VVW\013\324\260\2321\303D\004V\025\\M\200\325\344\250\017TQ\"<|\370\300\244\203UA\326\213,\006\252\254\262\262\256\234\023d-\231\212\t\313\352\312\231E\301\025\225\013*g\023\225\004M\024\304x!\243\211\312\211\325\304\324\303W3\252\234MYWW\316&\227\312\325\017\204\247\270\276\253\247r\020\325\322z\216\b\240\324_\026?\201\320"
+	.string	"g2\204A\013\313\237 \233\267\207(@\r\366}\331\244\020I\360Ffs.U\274\004"
+	.ascii	"\245\004>\300\025\246\030\226`R\026})w+\220\360\273\3325\263"
+	.ascii	"V\026\327c2\254cF3\030F\320Qa\003\t\373Dx\223\236\323\302\223"
+	.ascii	"\363\001\330\027\002\211\026\215\035F\024\265\034\025\343\326"
+	.ascii	"\242^z\327\016\224\365\265\215\266\251\315S\312\277\270\353\353"
+	.ascii	"\242e\326\212\301\253.\212\f\231\265d\350\252\026\227!\250>6"
+	.ascii	"\265m\371;\322V\257<\2509\234\035\257bS\373\243\212Fh\306\022"
+	.ascii	"\025\265\234p\266YJ\233\324\215\327U-/\313\266\367}\033\214Y"
+	.ascii	"kQ\253\021\307oq\r\217\353\373\207\206\254\312Y\001\301\267x"
+	.ascii	"\364L\214\376\350\373\213l\016\272e\3649\207^\330\257\255\037"
+	.ascii	"\037\2028"
+	.string	"\037\027\327:\267\301\323 \b\377h3`\027\024\315K\260G\270nqj\263~\266EqE|\2012\032\250\275\036f\372\256&\226|u\\X%\r"
+	.string	",\375l;\300u\340\233k\025\355\304\232\210\212\020\361!\271\276L7N\360\301\031\202Y\227^\3125:@Z\352'\nFJm\305\205\361\250K\350\343\314Y\t\037zfh\006\3200\241\037\372~\362\305\330\215\375l\203^\350\370A\377-|1\362\231\261\373#pO\t\205\031\265\030\2762\231\030r\250%\r\212\215\321\344Eo I\261\240z(\303\301b\316Z\022+G\202\375l\201@"
+	.string	"R\334!S\301\212\321\022\361*B\f:F\330\304\n\244\350\245\034\245\237m\363\375\n[3\202\001\250\322\0209\324i\305\324\220\210\210\202&I\241\003B\013\020\bBi\036\310\314\003\022\300s9\307\364\020\031-)Ia\217\003\213\034\244.=d0\275\2409]\025e5_H\361\301\020`p9D\362\344\302D\016\246yI\362\b\345\211\216\005\214h{Z\347\305ca\246\035Zoa\215\212h\314m\032\023P\351\241o\230\223\370!\004\036\032f\303\2053\3709$P|7\017\007\242\323\301y\244-\021(\230(qP\\\222Z\376*\201\313\322\235\245\216\261\221\263a\013\306\352\225\273y\370\314\211P\234\331T\032_\370i\3033!\031\034\233.\305\231\274\n\377C\373\f\221\020\260D\b\243\236"
+	.string	"q\377\355\266\235\243\224\272)\331\212\016\327\363N\004\021[.\277!\3668\005\212\216\tO\226\351S\247\017\317\023\213\323\263o\310~^\332\375P\311rXn'\354=\213\203\024M\037\177\236N\203WuV\024\215?\341&\033\357\375;Z\024uQ\202\306\323\353\033\204\304BM\213\270\317\255\3475\201;\317@\335Ia\312\223\256\323\351\030\306\207\026t\241\365M#,\251\317O\201\036\362\237\177O"
+	.string	"U\341\030"
+	.string	"\301\222eS\202\312\240\031\374 q\317\366\367\226J\275>\3406\304\005PD\2124\246\367\245\265Vp0|O\365\347\250UPP\005-\237?\034r\314\250\022\322\243\224\"\243hEw2\024FaR\004=\343LH\205(\2412\234\346"
+	.ascii	"p\323(\261\2227o_\017\220m%\243\363\216Be\225\314\304\bA\033"
+	.ascii	"J\352\275\212v\360\236\200\255\304\373\020\365t\370\314\205\007"
+	.ascii	"\337A\233\371\233\255\241a\366|\024x\364\355\340\022\335gZ\243"
+	.ascii	"\324M9j\233\006\2069\2438o\252XP\033n\303\3660\\e5\221\003#k"
+	.ascii	"\2638\306\200/\236\354\023z\017\351\305\256\n<o\304N\250t\250"
+	.ascii	"\016u8\320\353U\223S7b/\352\275g(L\314\2210\234\270a\005\207"
+	.ascii	"5\202M#\312\\ \301\311\247\313\024K\277\031\026\303\031\177\326"
+	.ascii	"p\222\270D\376\237I\f\272\356]T\220x\270T\\\237\300\326\200\214"
+	.ascii	"\023\334\271\026\032o\007\240\346\211\371_\321\312\376I1,\310"
+	.ascii	"\270\303\021\322\016\334i\025m\363\341XO\304\027\031\032\233"
+	.ascii	"\271p\021\007\217\317\247E\2068aik\232\245\367\361/\013\211*"
+	.ascii	"\263\311\375\275\345\332RL\212g@\332[\356\270\334\253\327H\361"
+	.ascii	"\256Xq\007\257\300\003\2508\204\007L\016\353\335\273TA0x\340"
+	.ascii	"\270Lc, f+S\266^Yw\035,\230\305\303c\005\301\223\273\177J\322"
+	.ascii	"\315\210E\250\231\262\353w1\247w\364L\257\365BSIi5\307\327\273"
+	.ascii	"\030J\317\353\031=\207[;\032\304\311\304\366\356\345\003P\322"
+	.ascii	"\255'\n\335z\276v7S(!\323\256\n\005}\344{Ig*\215\004yT\373\004"
+	.ascii	"\244'7\030\335n\312\023\2009O9\371Z>+Q)\324\242\2426\266\310"
+	.ascii	"\356Y\313\317S\030\320\233\201\325\307\3672\230+,%\016pv\320"
+	.ascii	"K\231\226A\371?\312%\310P\312e\274\236<\272\222'i\331\022\201"
+	.ascii	"oi\016\234B\313\336E\220K\341\214\247\342\304\330A\301-oK\370"
+	.ascii	"\\@\223\027\221H\275\226\270Rq\026;\350M85\025l'W<\251\366g\355"
+	.ascii	"O\262\256)\034\264\377H\237\363\006\216X\362\026\343\013\022"
+	.ascii	"W\256`\335\217\265\220\f\356\350\276\327\272\325\313\3609=\253"
+	.ascii	"\t\247)b\315\226\300yJ\235\223\325\336\222\257\313\236\026"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.103.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`9\003\345\030"
+	.string	"\306\356\243I\300VQ:\024\325`c\310\342\021\356\303\240\220v'x\325DL\3104\004\344\236\212K \006\250\"\245Dc\377ta\252|\b\237&\345?\344W\377\033\324\221u\303\327\267\230No\003\030\261\320.\314|\006\032!{\023)\223\f\221"
+	.string	"\211"
+	.string	"\212"
+	.string	"\240\n\n\213\371A\366?\016\244\347:\036\003\002*m\350\007\251\326\262\3012\020?\267|\001\372)~"
+	.string	"\375|"
+	.ascii	"\241gc/\203~\236\313b\3431\325Z\256\372\306\0228X~)\307\036\322"
+	.ascii	"\t6\307\366'\036\202\215\202\351E\200\233\r\244\320d\213r\336"
+	.ascii	"\214\351\016\240O\220\002\020\037\271\026\352)A\335l\f\202\013"
+	.ascii	"`4q\021\340\206\002,\360\204\306\225\023\235S\334h\334\347\235"
+	.ascii	"\217\200\231M!r\003:\2075\265\326e\237\033\213\257"
+	.string	"\370\335\005\332\335\272\3331\001\\\316;\007-P*\373v\313\023\334\270\335'\320-\271\262]c7u\241\037\365\336\367t\335/.o\370\335\227\206\2743\344\005)oO^\236\274\007\360\035:\230\266h\370\325\372\363\373R\235L#9\336\373w\347\335#\250\261^\364!(\0046\242\036\317km\305\t\250\310\347\022?\277\037\322\203R5\261v\317\373nG\254:\302^\216IK\255%\203\317\035EU\026V\363\207\366\345\205\364\\\310\004(\240\322h,\351 ~\312\004\263q;\033\354\326\r5\261y\222\021\027\033Qa\036\225\331l\264\264;\036\351fA\374\310u\245\240\317'\t\002\373J9\235\214\177?N\212\221\020\330\270Eu7lh\211\306M\273\033\342F8b\255\264\b\373\"\"H\261\326z\034\237{\036\372\331\255 \247K%\371N\375\336e\270\305>\365DR\3531\343\037\023\372\346~\215\307\214\177K\373}"
+	.string	"\213-\214\214\177{\242_E\222\227\236\202\244\223\321\273\337\241\337}C\f\031\373v@1%nZ/\327la\240+\201f\2240\301\001\r\315LL\216\253\365\"-\274H\227\216\r\t\227\316X\341\246E\342\030\330q&G\004\t\323y\221\243\207\021\266\032?\254^.\033\234\325\b\313Y\315\250\226\034q\003[\351\220$l\205*\353\273\306\005+>\275#\272\217\321\023=\303R\230\336\021\370\307h\030\366\326\310z\206%l\334\236\252\314TO\037~\321i\247\260P\345\274\203^f\320\256\221\261\017\254\265V\232\352\357.#\373\016\245\235\352\327`\314x\377\215\026]XI\210\r\027\001; `\002!\203H\017\301u\350\254_;\334\304\200\271\002_nP\331\006R\333c\345\013g\211\355\034N\325\n\004\rK\312H[\321\231\230'\3023\312q#v\334\226\027>\206\267\306\f{\352\234V\244\220\0276<\334F"
+	.ascii	"G\216\337\343F[>\313\301\026\270\032\361\361\241\360 U\274\304"
+	.ascii	"\342\373\212]\241\375Fb'j]\200\016\271\376\303\226\333Y\306k"
+	.ascii	"\265\027T\033+$\321\373\205\313\244\210Z\260\242\366b]\"\222"
+	.ascii	"{\344\327e\310"
+	.text
+	.section	.gnu.lto_isRangeActive.104.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`k\004\235\035"
+	.string	"F\367\277G\240\330M:\300\007\271L\\cJ\036~,\237\r\240\273\324\370Pr\031\302\025\323(?a\373h^\323\262\317\245\\\342!\263\3478\273\276\340\235)\306\303\367\360\002C&\270\247\221\327\266\236w\377\3573\351[K\b\2212\245\252"
+	.string	"\231"
+	.string	"\261"
+	.string	"E\230l>\304!\373E\177\310\271\230ND\351\307\2118Uh\030\363\332\002:\351\r\265\2237=O\351\263ch\324\013\361\201<\b\323\211K\003n\363\211+\352\002\361\270\362d\355<\345I\037\254\241\325\377\370V\t\357\234T>\274\346$.0P\355\244m7p\300\344\246\023\261\246^C\n\252x6'1\2672\336tZI\216\253M\276\211\323^<If\314,j\350\342e\213\223B\035u\206'\306\2379\247m\370\244;&\240*c\2413\f\216\270)1\270\274xM1\204R\245M\230sZ\243\206+\356\332m3\331\226\262G\f\001\343^H\025\3245\346\331\335\001V\240\324\340\264\252t\311\230)0v\257\254\373\365\300e\366\244fl\027\035\211.\002-v\210\037\361\325\346|z\340\033\341"
+	.string	"\254e\235\364\227\312\223_\334\f N\272\306/\036C\016)e\302L=c\023\203\272W\366\307\271V\366\252qV\367|\353\3479\361\007\260\352\233\325;\253\326Yu\316\252qVm[\365\315\252mV][5m\325%MM\256z\\\365\226j-\325\017\240cY\266\316\256\324\220Z,\3049\265\006\315\224B~\335\260}\373\001{\263/\336\346\205\253\314\266\270\265F\205\241\005m\366f\027LHE\240\2666[v\021\352\330\332\222I4\214\007\225Y\244\247$<\221o\250\"\023\373\217\337\344/\376\346NN[\333\226d\202e/\227\266V\241\230\233\026\331\223,\262'\005\252\240\240=\211\205\301\020\013\013\300\365\023\265\223jC\253\252\f\230rm3\315#s\244\341$\313\026\320\201\026C\253o\342/\371W\20731\330H\234C"
+	.ascii	"1\324@\3558\233s.8i\020\265\223?\343\217\223\2361\271\345\216"
+	.ascii	"PF\274KW\233sF\360\223\\\311\316<\"}\024Qy\222\\\007Z\276\306"
+	.ascii	"\033\254\334\r=\242\242\336\270\0044Z\367\202\220zI:_\356\007"
+	.ascii	"\364\371\200\273\002I>\335\362\224\214t\031v8<\242\237\356\210"
+	.ascii	"4\004\241\035\004\t\f\204\204\202\004\220\340}\370Y0\342\375"
+	.ascii	"~\272\036\005\022J\272\035\357\202\220\214\200GI?\340\256\303"
+	.ascii	"\356(\267\003\221\373\025\351|\271\335\021R.\310\307@\021\274"
+	.ascii	"\243\\\022\020x\224\263\021\235>\316\265\262\201-/\240\272\312"
+	.ascii	"\236\n[\246\214t\251\337T\356xg=\301i\203\264\275\262\222@\327"
+	.ascii	"Q\301o\233\302\276m\317\276,\367jL\323\003\353\214\\+\235-\221"
+	.ascii	"\365\205\313\354f\317Y\235G9\316\346l\t&\324\021\\\234=\2161"
+	.ascii	",?\226\0310^\343^\031\027P\2501@\305\2142\306\231\241\tg\302"
+	.ascii	"\026\244\r\200\002\231\251\\\007\021\260\261cS\223\026\212\305"
+	.ascii	"\337\360qjR\205i=4\202\220\027\300\354\272\002\326j\354\201M"
+	.ascii	"N*4h\237\bx\335l\246\260\205\0254\323\332\210 'IP\322\375>G4"
+	.ascii	"\237\316F\345\320\367\007C#\237\220\333\346{\323\374\227\020"
+	.ascii	"\n\373\\\207L\301\2619\327e\314@{\366e%%\307\246\251l`\300\032"
+	.ascii	"\210\217?\313\242\033,c\200)\2772~\346\333\023Ag\017'\034'\312"
+	.ascii	"W2\n\031-}\f\215\330U\271\251c'\221@\001\324\272t\260\333\017"
+	.ascii	"z\327TK4B5\263g\343?"
+	.text
+	.section	.gnu.lto_updateActivatedModes.105.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`O\t\2152"
+	.ascii	"\212V\f\023DP\234R\0076\211\224M\003\023\003U4\351\313\247A~"
+	.ascii	"k D]\t\302\264\210l\013\"\303V\203\364J\307B\224tn\324\"`B\001"
+	.ascii	" T\n$\351\\\344\206\003G\30450^\271\367\221\306\266{\357$S\n"
+	.ascii	"\026\001\020\001(\001\2059O\025\204\275Z\232\355Y\246\310n\317"
+	.ascii	"\322^\347X\232n\007\343\315w\257\227\327\017\347z\275\005\302"
+	.ascii	"-\303\253\264[A\312U\331\272\333\311f\272\314\246\345\025\266"
+	.ascii	"\025\016\250\203|\354t2|\256\251\032\3623\254\211\013M\252D\201"
+	.ascii	"\267\235|\275U\242\201l\227\322.\247Tc\212\3079\235\312\f\317"
+	.ascii	"\321\257\035\036ui\2039O\237^o{\372&\031\"\333\333\332\247]\364"
+	.ascii	"6\211\016\322\335\374\315\351pM}\265\276\336\271:\264\301\234"
+	.ascii	"3\223\267\315\364z\273\344F\327[\326\205\\oq\261\235\335j|z\226"
+	.ascii	"\275.\210T\2560\347||#=\344\354\324\373\305N\337y\211n\313>v"
+	.ascii	"\266G\361\002`\254]`Z\276\303>W!\020\367\373\362\301R\230#%\343"
+	.ascii	"S(~\213\204\2119\261\207\273Q\334\372\200I\331\245\234s\021\214"
+	.ascii	"\013\263,\2021=\035>`[\254\261o\210\240[\035{\201I"
+	.string	"\361\373\324[446eab\216\211\026r\316\215\273\300\302\274y\274\273\335\272[K\367\373$I,\370\227s\366.\277\322\275t\276\021/\344G\215\303k\3139G\b\343bH\264\247y\333&P\240H\321I\337b\247\350\375\265-\350\rk\305\035e\331\212\007\250s\245\212\243\317\315\373N\347Kr\3566\252y\177\346\356M\3107\223;\234W {b\303\366\251\263N\312p\325\352J\267=\317\277(\333\323\032*\n{W\224\353\255\2003\302'>l\\\355\342\227\261a\367\024\212\337\254\333\215\222H\341\353'\322\375\270\223\0367\322\343>z\334F\217\273\350q\023=n\343\343\036z\334BE\334A\217;\300\213\033\350\347\305\335\343p\336/\017n\"\017n\227\007w\373\270\331\035\334\377\270\361\213\333\225\210\b\373J\314\345\234\343\220N\346k\271$q8\367no\327\342\325vk\027\333\331\344\342\324\247Z\275t\261\262"
+	.string	"\245\221Y,M\220D\354^\232\336\305\312h\232\303\\\035e\335N\277\303b\263X~A\245\263-\315\300A\323\357\260|\232s\274\300\373k\013Eo\364O\215\216\035\021}\321\273i\242Lz\236\350[;\351\365\t\036\b\030o\324\253N\202\354\211\r\017\335\255\316\203\241>\364\306w\341@\245.\364C\3378J\b\264\026\345J\213r!\215\251#nu7~b-!\310\307\370\211\265\210\342\346^o\261\332\032\231\234A\241?l\372\025\t\336\037\001\036\207\027\374\332Tv\232\301\202\206\\\275\330\374,\350\205\236\335\223^\373\204\323qz\333\347\270!\206\fOO\256\267A\357"
+	.string	"\220\013\353Mu\361\007x\2432\3211(>l\343\032\231\2346XJ\340\240\030\366\315\032\350{^E\234\230-<g\203\307\361\320\001\316\033B\240?"
+	.string	"Xm\016\336\306\003\20246\203j|\215\225\353m\317\033\255.\002\210\037\325C,\271\223\343&\373\271{q\354[\274-<\037\277\247\221^\273;\270\240\207\026h\002\375\035\034y\363*\376g\345\363\227\363\226wu\177\3603!\336M\215m\254-\347\255\007\336\232!\343efX\271g:4\273\301\td"
+	.string	"\252{~z\356T|\211\316\2278\231\312\031|\366\005RQSR,\f&\325\267T\023\226TV\262\352\270dVU1\225HYU\311\207\212Z&\257\332'\247\030\315\344\017T\223*)\202\nj\271LJ)\001\264T\nwj\305\222\351\264dNe%_Le)/@\255`V\0255\204\006J\b\022\220\r\0324\025\305\200Z\261\234j[\331\204E\305\274\312Z2\225)\224WG%\213\343r*YuT^a\035\233\224\232\351\002\352\352\230\305d^\035\213\323\247?\221\366(\376V\337\360=\037\272\363f]DB\374\371\017\304L\376\276\327\373N\201[x\316a\331\373\016\347l\3169\277?\357p\t\374\375\237wW\343a\365\301D\342\207yW\033\367\333'\276Ku@=\017\177\271o"
+	.string	"P\354\333w\351\365?\201\263\337\332E\351@\235n\030\207\023\356\275\324\332\360\r2\330\306\277\313\001\276\021\205\331\3428\252{|Ol\330wP\364\304\3347\353\2447\276\214\2645q{\270\313\221>\251\206\037=\322\273\324(\223?zW\222wFz}\342C'{\303\226\244}\2636z\343\277\232\2700Dh\200\275\250q0\251\220q\206\246D\202\202$I\322\001p\002\231\231+r\003\021p\265T4\"#i\322\236\001\207D\357_c\210\035\004\335\033\022\215\024\360\223\330\355\276\342\302\354]\334\326!b\311>@n\223\tx\205\220\206\254,\337\315\006\244\001\215M8S\027*\234\232\244Ra)\242\275\366\022\235\262bJ\234'\024+0<\323\205>\201\310\232fY\2505\352T\276m"
+	.ascii	"\253f\n\331\2439\275\312H\237y\267\274\325<\236\3645<\337!\235"
+	.ascii	"y\202\244\016{X\2717\\\241\315\025\357\277\311VvxY\211\3317\371"
+	.ascii	"d\241D\002\372\204\f\262\b\254\247.\267\271\372\n?\206\320\261"
+	.ascii	"\223\257s.\201\322\223g\304\250\371|4\202=\255\214\037\345\035"
+	.ascii	"\311\t\227\260S^\017\216\260iB\314Q|\234\263\252\360WkT\016\314"
+	.ascii	"s\323\202\247Z8\307\373#|\350\031pl\374\211\223\361f\f\007Bi"
+	.ascii	"\215\221\360\013e\261\310\005sF\244\364\333\356\346\3173{\017"
+	.ascii	"~]a M0>5\007#\203\017\215\005Y\203\005\025\001\376\376wZR)\263"
+	.ascii	"\027a\240k\207\326\372\336\005>}C\025a!\233 d4uC\225'\325:~9"
+	.ascii	"\222<\013\261\007\262\020\344\001\361\016]\021\0174>\n\202uV"
+	.ascii	"\026\365&\343\202\262\003-a \204\205\221z\224\345LzI$50\233\\"
+	.ascii	"\277\227\202\273\037\215-\007\332\020\021AU\314\021\245f\240"
+	.ascii	"\2459\365\323[\2102)\206\n"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.106.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`D\001}\016"
+	.string	"6]eE"
+	.string	"\261&\035\177J\214V\330\210\323\251\020\260r\214c\341V\217&\335+\274\344\277\251\270\211\271!\267\332*ca\204(*)y\361\212\350.\275[\203\327\266l}\202 \242S\303&c\206(\032\262\204\354-eJ\001S"
+	.string	"M"
+	.string	"O"
+	.string	";b\021\317\243m\237\304gL>A\327\207\017\0031\323b\263\263\273[\310\t`\217\360\003\260G\365\360\323\241\346\311\327p\260\250\261\372V\016?\237\206+,\300zA\021\340c\201\007ntX\257y\272|\251\314\214\301\356:W_\206;\336v\003\333\017\354w\bNk\247\371?o\375\037Ng1\215\305t\3244\324\264j:a\372"
+	.string	"DZ\217\001c\027\303k\307\272\2109\"l\233l\315\006\275 \321\264\357z\t\323i.8\356r\230\201\263\353\032\261\003\317\243\200\004\255 q\276u\362\307.L\n\234\335\nB\243\246\005K\346\260\332\270\n\026\025\323\2536@\215\n\342\241P\257\032\221\312\227?\252\232\251\270\246\276\245\207\355\223\237 yvW\201os\023\235\037\342\321\025J\371\325\243_\302\036\257\td\344\240\362e\rfS\207\355ZI\225\261\017Wc\354\234\027aD\212.\021q%\013\020\210D!\220\322\310\202\t4\027*\235t^\nJ\307A\340\274\215\233\260\241\214LH\033\347\225\266\220\001w\024$x[J\327y\233\346\332k\2143\365\306OX\252\246\231\272h\bJS\020B\325\364\252\035T\276\2367:\254\027U\031g:W\301\260\025"
+	.ascii	"\277\271\"\341\320 5\266j\2001S\242\347\374\345\355\\\005\033"
+	.ascii	"\300\200\247\227\312[\300\005\367Ee\241k\270\363-`\266\020\005"
+	.ascii	"N\034\241\351\360\323\235\230\"k\\j\017"
+	.text
+	.section	.gnu.lto_useRcControlsConfig.107.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`\337\004\255 "
+	.string	"6;\321K\220\026R:\004\203\347\305\020\316$\236\341j\240\335\007\207\fFT\r\354\006\3631\370x\301Wq}H5F\277m\377\303QM\347\312\275\240\372\307q-N\032\311\311X\b\202$\203\305$0\222+\273\364\216\327EO\332\336d\357$\003\271"
+	.string	"\264"
+	.string	"\276"
+	.string	"RD9.\322,c\302V\372\204\226s\272\340\267\177\320\337\343\272o\216\354j\332\302"
+	.string	"\200l\224\302\n\201\376\3364\355^\273\377t%\303/\213\036 \347%5f\316)\203^\200\376vz\002\370\027\275"
+	.ascii	"\374\333\303n.O\203\344cU\035\247\320r\316:\313\324\003~\246"
+	.ascii	"o\\\207\267\341{\332:\354C\275\332\030\223\"\273J\272\270\355"
+	.ascii	"\264/\320\224r\311\343I!\355x\345\\\305\212\211$\375\236\024"
+	.ascii	"\224 i\262QT^\270\344\261\236\247\202\035_5r\311\027'\201*?\266"
+	.ascii	"\274\353\365(i\254\366\\\257N\310\024\311\256\222I\2576\236\234"
+	.ascii	"sWdr\306\033}w+u7R\367\311\024j\335i\261Ze\367\021,\245li\273"
+	.ascii	"\324\215k\333\344n\265kn\265i\320\332\2707\3373\266\3327[m\364"
+	.ascii	"\3147\376\362\277O\177\213k\037\300\035\213\"\304\312\222\245"
+	.ascii	"Y\306\332\230\034v\233C\316\374\233\375\2527\373]\215\353\341"
+	.ascii	"\231}\256\036\016=\252\177\365-\333\2211$9g\3340W\345\323\211"
+	.ascii	"\313\356\326k\365\261\336d\350Y*\3164'mE\264\316\236\320\220"
+	.ascii	"\350o\316y+\236\"\214|6\371\302\021\333\275\336jYD\"\037\311"
+	.ascii	"J\031\227\263\337\003F\273W}\252Ou\340H5t&E\317FH\267$+\265\263"
+	.ascii	"\340\247\206p\2778i\273\356/i\007\017\206\0369{\243\035\305\272"
+	.ascii	"v&\032`\300\240\200\324\270V\3315\226\306\332\245\324\227\261"
+	.ascii	"\246}\270X\225\032[\263\312@\234\212\bf\2178\230\317/\215=\330"
+	.ascii	"\225X\262\242N\253l\257\343lP\252\314X\323\372\314\346\375\313"
+	.ascii	"\207\346l\204\320\237r\302D\337\251\b\377\342l\202\246%M\227"
+	.ascii	"\332\214}\36397{\355\214\275O\214\214\024\353\332\024\214\332"
+	.ascii	"\233\275Q\221b]klQ{cv,\363\256?FW\030K\306\\\366\260V\331D\370"
+	.ascii	"\314o\340!\340\013\3279\234}\353WG\030\232\227\253\300\327\272"
+	.ascii	"\366V\317!V\265\256^7\254\355?9\224\026}\247\376\241\250G\242"
+	.ascii	"\300\277\003\232\224\210u\255\253\227\r\261\\\003=\f\276\036"
+	.ascii	"\020\b\027`\341\353\005\375\256O\350\001\330\301\367\363+\001"
+	.ascii	"\fj\350\375R\330t\204\035^\004\t\rvvt\n\b\177\275 \240\205 \340"
+	.ascii	"O\310g\305O\210W\301\327\003\002\031h\236\216\360\007\030\024"
+	.ascii	"\n\002\362F\360\202:^\t]\320\317\007H\307\013\nu:8\rL\341\013"
+	.ascii	"\352\204\200\300\240\016\227\022o\227\372\\\277\240\005I\265"
+	.ascii	"\205\373B\374\256g(+C\265u\376Blc\217zr\204\021m\261o\373c'\023"
+	.ascii	"z\350\251G\366\340_;\205\354bco\031\034q\364\231M\255\037\352"
+	.ascii	"7\263$\251\2303\242\231\315*\373\226\345\346\354E\326G9\266G"
+	.ascii	"\026\262\030k\332\031\306\007\266<\3043\347\234q\316\236\371"
+	.ascii	"\023al\003Z\250a(\247\0243\n\221\214\214\210&I\013\007`\002!"
+	.ascii	"Rwu\021\240\305*\252)\250\024\2065QTq9\270\251\372\276\344!\224"
+	.ascii	"\031e\024\n\234\231v\270M\034\373T\230\335\202\222\322%\276\275"
+	.ascii	"\rH\326\247@\274`\252{\022\275\335y^K\324l\247\301\216\375\312"
+	.ascii	"W\366\023+\212\235:\377\236\200\260\200\244\300\254q\316\fL\304"
+	.ascii	"\363_\017\274UU\314h\025\r\243\020\220\3774\331~\013\262\325"
+	.ascii	"I\036\277\302\274\346\004R\347\"\211\b\245\006N\253t\367\003"
+	.ascii	">\270\027D\235\320\277\347\t\372\260\370\232\252G\262\001\027"
+	.ascii	"\2569\253\310w\360o\361\351sJ\024\244d\276\344H\017W~+i\361\340"
+	.ascii	"k@\f5\0200\341H\244?\340\227 \023u\276\244W\362\376"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.part.0.135.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`,\003E\025"
+	.string	"f\345\205I\260\022R:+\255\200\032\306\377\023\212W\317\201\326\036R@P\365\267q\254T\343\254\307\343.\311\302b\325oZV?\353\027\243*\033X\260\352pY\2079\361O\351]r\200\023\273\037\377\340g\017C\247\266\361I#\204H\231Rl"
+	.string	"s"
+	.string	"s"
+	.ascii	"<\204sN\330\350\373hl\230\357\253\261a\037{4?\266\375\244+\325"
+	.ascii	"\370&\376v\272\020\240UN\013\341\234?\331\307\222\223\220\037"
+	.ascii	"\305\217\220\037W\304o\037\305U\362\346\253\216\316\346\343\204"
+	.ascii	"\241\241\216\316\303E\021\001Q0\210\004+\304\r\230.\247+\242"
+	.ascii	"\303\021K\346\234\367]wt8U\001']&sN\227\037n\327m[\260\215b\357"
+	.ascii	"J\367\375<M\275\254\251?t\217\274\344\305\271Fv\210\372U\252"
+	.ascii	"\313R\355*\325\344K=\226j\361\245\336R\255.\365a\001\032\004"
+	.ascii	"\347\364\031\002\231 \306\250\023O\266'[\214mA\023:\266\364\307"
+	.ascii	"\211\3060\342\024\372\355\200\"\fQ)\tg\356\227\200\351M3\206"
+	.ascii	"!\360\333\001\221B$\252R\370W\216\366\027\354\016\354b\376\263"
+	.ascii	"\272\3309X\322B\362\314\177~\331\004{d\327\352\326\200W9\365"
+	.ascii	"ar\305u-Y\203\003\017\247C\217K>x\325\324\251 H891\320\343Jb"
+	.ascii	"\361w@\262\242\021dW\244p)\224r\316\234\002?\306eTHQQ\331\373"
+	.ascii	"\256\301\036!QO\005iU\004\374yxR(p\354\370\352>g\313v\354P\263"
+	.ascii	"r\316\311\300\177q\030+~\211\217\306\320\242\327\371\350\267"
+	.ascii	"\220\037\277\003FD\335\350\320\001fa\211\311\324d2\265\021\317"
+	.ascii	"b\266\f\264\332\213\013m\2262\253\311f\027d.-*\032d\263\232M"
+	.ascii	"\026+`\332\206\225\232\354\205F\253\311`\266\365\342\\#\237\227"
+	.ascii	"\264%\3727R\3673~\337\313\034\275+\375o\344kwl\277\326&7\213"
+	.ascii	"\033aANs\213,\322\344\313\362\024\216\017O\334#\227\253\013\240"
+	.ascii	"\0070X\212PXZ8\033LD\270\025K\3279\247\315\006C\250qD\310\024"
+	.ascii	"\221\231\222\t$\214\224\264\240\003\320\"12n\021@=t\252\210\241"
+	.ascii	"^\323\001\2245\001\274\252D\347\346\250x\216\261\356b\210\333"
+	.ascii	"\220\256\262\007\212\351\246\251m\375\b\"\025&*%\326\025\244"
+	.ascii	"z\354\364(\333\253\327`\017\354O \204\r\2771\036\262&c\243\206"
+	.ascii	"*5U\333<\376xI\322w\346 X4\231\002N\322\0133\375\320\356\016"
+	.ascii	"\2368\211$\rS\327\323$w\234WX5\213^l\342UeF\203[T\310S\351q\024"
+	.ascii	"\r"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`\223\003E\021"
+	.string	"\226\335mG\300\230I:\022^\352\234\2312\304\364 2V\234\254\246{k\033P\223\003P\305x8"
+	.string	"a\216\021\343\202\344\222\266n7\330I@\246\322\325u\025\005\256\255\024\033\t\305\306G\001"
+	.string	"H\213\254\017\233\025\360\354+B\344N)W"
+	.string	"^"
+	.string	"\\"
+	.string	"V\f\326P\342\202\317N\201\235\022\330\n\002W9`*\235N\003\306\262T\022\215\246\236\265T\344Y?\211\236\355\330\bl\035F\235:.\222\263v\362o\206\343#\321\233@n\326Q\321\306W5\236Bc)\235m\231\351y\037\315^\333&\343\334\234s\276\366D\3216W\024]:\254\275pXgmX\177\361\331\3174\354\275\333\216sN\333\365%\303\332\352\030\214\344\202\225X\360\255\202\237:\373G\366\223B\006$D\301K:\333E\220LHE\f(\350D\254E\217\377\275\230\340&\022L\244\213\260\256\202\260\246\212\017\f\325\t@Zb\342`\035%6XO\305\031\245[C\340\271\036D3`RY\324\036\340\t\n&uE\355\004~\030\301\244\306j\217a\325\326\216\324\330w"
+	.string	"\264\243\217G*\212\360\\\215$\336K\352\243\3769\347\3141\352\343\212\321\203\277\016-\254&\027\247&\326WJ\254\261\220Xg\031\261\326\"b\275%\304Z\013\304\232\313\207\365\226\207u\376Uxn\210\rKF\352\225\276\303\004\241U\315H\275\017\360_\212\312* \365I\341-Ee\343\025>N\301`\242\221z\244\357\362\306\315V#\3659\300_\b\023h#\3658\276\017p:*rI\275\021\370\310c\307\354F\352\326p\244\356w\230\030\237\227#u(\324\221\0324 \360\002\031*:\006g\001\335\325\244\271EebJM\200\004\220\004I\220"
+	.string	"I\220"
+	.ascii	"\t \t\222 \001\222\203\304\033\350w\213\213r\301\031\206d\234"
+	.ascii	"\016\244\006\324\367/\277G\215Y~\235\020\037_{\030\bew\334\245"
+	.ascii	"\365\364}\352\226\224\236Au\007\346\321R\303R\201\004\340\020"
+	.ascii	"\b\225,\361\005\213\344\211\231\0252\213\330\247\305\330\033"
+	.ascii	"\\\013\237"
+	.text
+	.section	.gnu.lto_.refs.a40cbe370fcd07f8,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\005\006"
+	.string	"\022\217*,`m\322\032"
+	.string	"cDDQ7\363%\272\230\353\001\260+"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"@\225\261\365m\370<C7Y4\337f\326.\366\326\210\255\265R\246\r"
+	.ascii	"\016\341\016\356s\233+\270\351\b\254Bd\317c\003\327\261!eA\352"
+	.ascii	"\206\351\217\335\231\236\2465\323\247L\300\322b\003\254y,k\030"
+	.ascii	"\034k\027\234\315\242\202\"\332&\244M\242\204dd\331\"!\322A\242"
+	.ascii	"\177\254wl\316\221\26172\327\320<CsD\306B\250\037\242C\222\005"
+	.ascii	"-\353\260,\303zA\332sk\356e1\t1\367\305\246(u\371.-\367\242\025"
+	.ascii	"{*\305\002L\256\334gO\266\025\b\004\001\3746\200\302Z&\212\334"
+	.ascii	"\274-\365\031e\316\223\f"
+	.text
+	.section	.gnu.lto_.decls.a40cbe370fcd07f8,"e",@progbits
+	.ascii	"(\265/\375`\037=\335\b\001\252\233\271[U \fQ:\035\024\364o\206"
+	.ascii	"\2678\027\347Zx\004\317\353\351\001\303\274\352\017F`\330~\212"
+	.ascii	"\201\307R\355\370;\325V\345\210]\305\330\333\351\210 \311l\333"
+	.ascii	"\260\263\301o\227\200\210\221Y\006\351\351g\277]\324n\225{\034"
+	.ascii	"\2436\272\026\252a\326\230U\261\244\265-\245\224)$\005\270\005"
+	.ascii	"\331\005Pd\344\335\301\317\3477\341X\021\032Zvp6\035\232\033"
+	.ascii	"O\036Uy\277p\212?nS\303n5j\357O*_y\rGs4\247\255q\210fiV\337J"
+	.ascii	"R*\201c:\032h-kK\246U\370\253L\370\253v\374U: \331\254,\257L"
+	.ascii	"G\336\357al\317Ol/\212Y&\203\342#\377\310g8\232\315r\331g\035"
+	.ascii	"\370\357\261\214X\224\016&\337\257\256\361W\273\370\253R\374"
+	.ascii	"\325\025<\203\r\024J\251F\336;J8\235?\362\376\274\243\346):\026"
+	.ascii	"\225w\326\361\3639\214\001[5\312\362\326\031,{\231\031\271j\313"
+	.ascii	";{\345\334\225\277>{e\256\031\243\354\265{ob\214A\r\306\030\250"
+	.ascii	"u\\M5\341~\265(\307\006\032-|Ecy\337 \342\0203\312\3739\324@"
+	.ascii	"Rge\367E\343\356++ke\033\031\007\216\346\033\031\3533\264\377"
+	.ascii	"\334\310W\320\316\364\001\246\276\251\261\336\241\302 \200P\242"
+	.ascii	"b\366\357:\376;\b\377\335\203\377\316\301\177;\2373x:\340\366"
+	.ascii	"\362\013l\005\013j4&\316\246\326e:\344\310\336\024\207%QS:?L"
+	.ascii	"\244\246y\323\215R\264\370:\203\2224\335\343\333s\201\273\374"
+	.ascii	"\377x\321\362\305!\320\313W\223<\347\027\236TF\335\224\025\323"
+	.ascii	"\377\214\224\231r\213L\225\225\362\214\f\225cd\0259*?e\251<\225"
+	.ascii	"\2332\214\354\224]\344\245\354\314U\231EN\3122\362Q^\201\243"
+	.ascii	"\371E.\372l\224S\374\206\366n\324\367D\351\217\312\036R\024)"
+	.ascii	"X,\350\212TM\001\277|\265M\365\006=(\221\352\343\202\3574\364"
+	.ascii	"k\310v\265\245\316\310\f-\377?[\364\270p\370\377\311/\360`nj"
+	.ascii	"\350\027\214\212+*\323\336\373\343\263\374\002\237\200\211h\250"
+	.ascii	"\034W\021\315\232\352\375c&N\360]\r\363\246\027\355-}\365\016"
+	.ascii	"\375\371\357\300C~\201\277\340\273\017G\275\237\225Uip\006\251"
+	.ascii	"\002\024\354\035\252\201\216\006%l\361\263\352\260\263\024[\020"
+	.ascii	"\032`"
+	.string	"\n\377\334\274\013A\357m\303\260A\027\201y\347\376\363\231y\301\220\272\271\274\207}\374u\035\177\035\204\177\2336\343\257\267\370#\271\202\261\340\350\006\234\345q\025\\\3670F\320\276\006\303WeF[\336\257\255\370\343\rB\033\274A\370\332\311\267\356\374\363\037\377L\204\177\216r\2352\376\271\213o\310\342\237\253\370g(\376r\371\210\277\364\217\377\023#\374\247P~#\210s\360\30728F\202\223\340h\006l\367\035xx\315L\353g4_\310\276p\311\373q\023\177\234A\210\007q\006\341c&\177!\256\001[\020>\b8\007\330\202\020\307a9\034\345\301sP\233\274\345\305M-\357'\301\037\363\b\365\340 \346\021\376\004\270\006!<\334\210\016\356,o\374\206\241O2/y?~\303h\330\r?{7\352\275_\300)\376\224\266\344\215\323\260\032\216\356\340 \217\331p\333\253Mh\207\342\300\254\242\246\274o\260\005a~"
+	.ascii	"\237\261I\353\036>s\023\364\216w\204xp\020\357\b\363\023[\020"
+	.ascii	"f\200s\204\370\307\317c 9B&'\264\333\3244\221E\337\362\306\301"
+	.ascii	"9B3|\266\243\221\222\236\275\255w(\316Pl\256\312F\336\017\305"
+	.ascii	"\026\204\034\347\b\3771\017\224\177\\\001V~\362\237\235\374g"
+	.ascii	"<]\202\247\340\177c\220\215l\2345\327\375g\374\237\363\257\375"
+	.ascii	"\347\":;2\335\007\340_g\371\317qA\202\377\032\360\037\203\340"
+	.ascii	"\037\177 \004E<\342\377=p\363\257\233\374\347\242\020\3778\002"
+	.ascii	"\377\330\002\377x\002\377\031F\033\r\266\377\\#\210\214\250V"
+	.ascii	"\327?^\333\303A\324\376\361\226\264\274\341\037Sx\013\244\\O"
+	.ascii	"\201\177\355\365\2171d4(>\313P\002`\254\307\360\257I\220\201"
+	.ascii	"\374\277\316\225\216\361\237Kp\226\315\376\177\204\377\347\211"
+	.ascii	"\371\327K\271\354e\376\267\212\177\314\200\177\334\200\177\214"
+	.ascii	"\201\377\337\377\233"
+	.string	"F&\033+\341?\213\340?\013\375\347\343\177\016\372\317\311\037\376o&\377y\001\377\331\001\377\371\001\377\231\001\377\371\203\377\f\001\261\377\\\200\377\254\200\377\374\241\307\377\323\374o*\377\231\307\177\016\373\317`\377\331\353?o\375g\255\377|\343?c\375g\253\377L\365\237\247\376s\324\177\206\372\317F\377\331\004\377\331\204\377l\342?+\3773\007\376\363\210\377\034\342?S\370\3177\377\231\377g\375\217\271\374c\301\177<\375\307O\3761\337?\316\373\307\322\177\274\344\037\037\371\307>\3761\335?\036\362\217\341\3761\333?^\373\307i\377\030\372\217\177\374\343\240\177,\366\217\331\177\314\341\037\367\374\343\036\377x\307?\016\373\377\266\377w\373\307V\377X\003\377\030\354\037w\375\177\226\377\237\373\307[\377o\367\217o\374\343\032\377\370\352\037\013\375c\240\177\234\201\177\214\201\177\354\200\177\354\341\037w\370\307\034\374\343\r\376\261\006\377\030"
+	.ascii	"\377\017\367\377o\377\177\366\377\031\370\377\273\377\307\031"
+	.ascii	"\034\034\034\374\027.\377g&\360\277\001\007\002\370Nx\326\345"
+	.ascii	"D\354\212\315R\017tr\305\312\026\217\257'\023\230/^\250VT\311"
+	.ascii	"v\352\225\024\226\256\203[@\304O\003\372\351)\bL\0133\360\021"
+	.ascii	"\331[\024*\257\2476\2018\266\314\310[G\321\177Y*e\362\3627%\212"
+	.ascii	"\255\307\333\036\024\353\210\n\247\274\245\344\316\224\345i/"
+	.ascii	"\033\241\031\233\262'\243\211\343L\361\274~\362\004\337}\340"
+	.ascii	"|2\0035\200\321P\255\260d!\313\373m\216\270\316 \317k'\217\243"
+	.string	"\332\211\346\343E\2757el\340\001\326\024\306g\225\267\336\303y_tM\262\360\257\321\3437|<\257\363\362\360\335f\246\365\245\030\025hX\240\004{G\262\201\206!\207V#\3063\250\361\274f\"\355\242\305\277F\006\317\300\305\363Z\311\022|\247a\313W\r\013\3764Zx\2061\236\327I\220h;|\307\373\327\020\256\210\313t\312\237f\217g\200QW\247\217p\035 L\231'#\252>#\257\217\374\337\366q\202_\222\316\342i+\302\276\f\341:d<\257\351\350\362\216\017\262z\223F\006`s\316\rh\202$\201{\252\361\013T\304\305\3519\020\310\232\f\335\356^\270\320r\257\347\204TX8\365\345\375W0\221\377\207\331@\302\2344Z\\\247\213'sa=\004G\365\220\354\245\323\231\200\034\200\201A7x\032(~A\r88\315\006\002Y\223\314\231\233\237\222A\256\003\345y\355\026\325nX\360\203\266\336l\332"
+	.ascii	"\006\310\204d\003!\017\267\247$~\374\002\257 \037D\263\361\336"
+	.ascii	"{\005\2619^$\n\f\216-{\301\200\205]%\331q\233=\236\327kQ\275"
+	.ascii	"\246\305>\310z6\2572\270\223\366M\t\252[P:\212\326\370\205,\236"
+	.ascii	"\327i\217\243:M\357\300L&\334\373\333\336\326T\206\212\364\213"
+	.ascii	"\225\035\274\202\026\317khTC\361\333\007Y\317\356\244\201G\317"
+	.ascii	"s\n\366\356\334`\206y\344e\206\213\277\231\231\366!\354\035C"
+	.ascii	"\237KL\335\311\264!C\027\036M\246\313^\237\351\037Q}\246}\340"
+	.ascii	"\316\324\273\2633\0037\230\201\345\311\tv\247s\003^\201\307b"
+	.ascii	"\355\312k\037Y3\275[\020#\365%\304L\220\277L\022\376\371_"
+	.ascii	"\330\233L\275w'\025\332\231\212f\036\253\030o\370\247\301\032"
+	.ascii	"\007\340\377}F\350\275\331Ej\205\207\3055\2454tU\312\204\264"
+	.ascii	"f\305\374\300\252\311\310*\006\322\232Ug\032u1q\230\272\025\023"
+	.ascii	"i\255w\234nd\304\024\361\3548Hk\275\251\247\310k\302\035j\305"
+	.ascii	"\354F\317\216\323\215zS\003\222\221U\023\322Z\263\t\007i\315"
+	.ascii	"\252\251\257Y\365\233n\324dZa\324\231p\372\232\025`_{6\335 \255"
+	.ascii	"=\233\220\326\254\272\260\340\212\037NNY\244X\177\030\r\311\250"
+	.ascii	"\273P\232j2\335H\221\240\317\376\244w\334v\324\231\002\320\373"
+	.ascii	"\324\223\351I3\006\226+\222\272(\022\322|b\250R\321\325\263\033"
+	.ascii	"I\221v<{\337Q$\324\225:0\241\322\256\205\245\314\032S=\351\250"
+	.ascii	"w\fJ\2753q\227\366\336\231\275\367!\323\024\264\367\250\033\244"
+	.ascii	"/%\245\336\235:J}\2129w\324{n\363\223kBZ\273z\376\314\005Y\373"
+	.ascii	"\352*\240L\374\325\237X1\3615&ZO\252\302\277\232\236\002\363"
+	.ascii	"\206\326p\271\320\232\221\267\356\021\203\345\210\020\257+\016"
+	.ascii	"\205\312\310Q\271\275\310[\207\r\347\234\362j8\371\227\006\313"
+	.ascii	"1Z\350p\312\373eZp\375\245\275t\327\360\212\0237;\315\2653s\307"
+	.ascii	"\367\326\263p\255\245q\340\350\327\351-\255#L-*\374\304\360\353"
+	.ascii	"\204\372\306\314`\237\036\020<\256m@\317f\226\226\266\236\272"
+	.ascii	"\206\276:c\233\222\226\267\266\312\375G\340U\3364td\224fL\211"
+	.ascii	"\231\343\217\353\260\310\360 ek\232\377\246YM\276\254\230\376"
+	.ascii	"eq\346\300*S_gZ\\L\275X\321\223\232\242\207\303\350\3134J\216"
+	.ascii	"i\027\265\026C\004\227R\350\242\032\335{\323\313W\224+W[\324"
+	.ascii	"\224\352\264\222\356\272\bK\235\273lp\332{\317\177\231\212\326"
+	.ascii	"T\267\3200t\225\216\241]h*\315BKi\247n\322O=\245\237t\224f\322"
+	.ascii	"I\372\205\226\241g\350%\r\245\235pT+\351\243\327*4\222V\312\\"
+	.ascii	"\324\222\246\331O+\351\025\037\247\321\230(8\322\343\312\177"
+	.ascii	"Z)\003B\373\022\207\271\260)\177\362M\273z\366\307h\361-\025"
+	.ascii	"2\305?F\006\377\030(\376\272\350?\017\342>#\033)XoL\362\326\314"
+	.ascii	"\237\327M\031\243\027o]y\303<\361\230\030&\177\030+\374a\240"
+	.ascii	"\360\207\261\343\017\303\306\037\306\213?\314\025\177\230\027"
+	.ascii	"\374a:\177.\205?\277\343\317\341\370\007^\306\237_\361\347.8"
+	.ascii	"\007C.\374\207}\374\207u\374\2418G\370\244?\313\236dh>c\342\350"
+	.ascii	"\352\343\323;\226\250X\344\275\007m\213\361S\261\264d\306\365"
+	.ascii	"r\221l\244\306\350\246\033aQ5\311y\331\t\216f\275|dC\3652]\325"
+	.ascii	"T/#\311R\r\375\342-RdM5\340Tf\354`\3017\023\235\031\2504@\250"
+	.ascii	"\274\177\230\203/\311Jp4\343e;\354\341.\n/'\301wX\352\354L\300"
+	.ascii	"\016tL}S:\032h\240\252\215=\r\n\367\017k\360\037\302\340?l\301"
+	.ascii	"\177\230\202\2770\n\317u0\317(\265\246\036\177\241\022\376B!"
+	.ascii	"D\346T5\273\262f\336y\356w\332\023J\243\233PK\342"
+	.string	"\344\342\352\274 !\222\367\ty\b\216\346\270,\004\232\333\2604K\304\226.\323\270\354\226\341\254\372\216\006\032\304\004\342\210\022\356\027\216\361\317p\177A\346I\032@\006\265\332\254j\004\355\366V\260ay\351\302\023\f\242F\325\3011\263\324\250\352\025D,J\333\032\033\004\002\223\260\362V\343\342&#\353*M\357\240q\202\342\007\003M\373\350T~8\345\255\376P\201\274\n}\025\232U\250\036\034\024\372p\302&\364\261\277\330<yb%\235aA\356\366'ma\266\213h\006\233Xy\226i\276}\304\345\204\216LN\350\246u%5\266%\347Q\001JU\261M%\206\333\231]\336\030\260\360\340\241\331>\320\363\234c[\013\017%$x\034C\224\2600\315\306\203\310\027&\301|\347\"n\316\213cp\002\006\246\271p@\303\002\205\345\340\214\360\260\3011\320qq\251^:OME\307\226\263\034U\005\017G\327\253^_\216"
+	.string	"\341tp\340\267uA\005\307 dkKs\321\341\221\227e\314\346G\021\262*t\034C\017-\255\375\245\002\030 \026(A]\266\202\257\n\216c\300\272qC\215\322y\352)D\252\364PcDcp\345\375\0248q\f1j\324P\261\234\2043"
+	.string	"\225\234\220\367c\3459A\351Q8\206\243\347S\265\3027\320\"\275%_GW<\2344^\265R\315\210@c\334]a\221\022g\307w\006\251\2504\227\004\004\376\2750\353S\212\353\342\0250\247\376\2474\027\235\247\216\222\246\267elC=\305]\311\342;\177N\247\032\245\023\006\245\022H\241\211\365%\343\325(\275\004G\330\232\005&\276s\302\321\253,\216T(\3157\323\207qv}\201\202\035\311\271A\006\255\005Z\223\246W\241^\205\321\201\207\237\302\307z\3605\363V_\274\372\344\\Bd\232\367\253N\352S\030\326\232\030 \377\003@55\345\2552\375\224\3371%\t0ou\351\353\234}\2027\\<\336\225^Q\336j\0135\tG\377NU\372\032\"*\334\356\374\370\237"
+	.string	"\377\235PEzu\005\021*,\253<\376\257\252x\343\223\372Z\302\277\202\021\2763\246v\265\253FpM\275-6P\272\271g\321\253FU\266"
+	.string	"\007\325\246p\212FSPm\252L\247\271.+*3\013\331\321<\236\224\034\345\375\025d\360\n\220x\272|\227\375\005\247\365%|#\017\210\340\006\032&NqM\333\313\357/4W\242\322\037\202xK]\266X\341:t<\277\265\374k\331[6\363\246\367\253.9!/\214\222h\004iP\025Q\302u\370"
+	.string	"\177g\0014\323\223\221\251`4\243\344\275\257l,V\252\004\346\244q\035)v\277\2458\272\3556\225\r\316\376\264!,\363\tJ\241\222\367\037\315\036\226\276h\336\237\343\305\245\354(\033\312\366\333OptO\331|\277\233\340(\217\353\372\262W\006I\236}S\202yn\036\234"
+	.ascii	"\321k\333S\366\336\021\351\360\255G\037\215\231\3759Q\374sT\360"
+	.ascii	"\247\360\205?\005@\376\024\230\360\247\360\306U\274\315d/QrG"
+	.ascii	"A\213\3578\021\371\215\204\310V#\341\bF\207\336\326\326Re\033"
+	.ascii	"\331G\352v\221MG\341\211\3578\243\277\343vt\313\215\bA\207S\343"
+	.ascii	"\232j-oz@l\266z\304)\345\275\205\354\023`\350\222\364\246\206"
+	.ascii	"d\345q\361\310;\303\r\317\230\214\334\336\264\027%t+\362\376"
+	.ascii	"\355v\202(4\310\362\336m\374\210\202\021\017\214_\332\224\255"
+	.ascii	"\274\177\267\375o6\334$'I9\251\344]\023\343\347w\220\354\325"
+	.ascii	"vw\327\307wt\360`2\274_\374\266\201\243\373\305V\373)\352M\034"
+	.ascii	"\035\2466\020\200\215\252*y\247A\223\270Zt\261\343\317\201k{"
+	.ascii	"\365\2002\335\332ZgQ\2626\016)\323\263\rdC\267\217\215\206\243"
+	.ascii	"\373\307\376z<d\337x\235\266\375c\347\300D\2604\353\2033\277"
+	.ascii	")\223\037\033l\223a\251\363\246\033\235 HCC\205[\325\314\316"
+	.ascii	"\372)\026\024!\201\360\343o\272\311\266\216=fA\021R\337C\002"
+	.ascii	"\267\354\312\266\031\216n\262\327\331\241\341\002E\360\207pl"
+	.ascii	"\213\311\261\220R\221\367\356\201\327\356Z\324\320\332\201\243"
+	.ascii	"\233\207\n\035^\272\362\336a?e\005\223E\213\257\2031g\266\304"
+	.ascii	"\006\177\234'\177\234\247\335\325\371\336t\006\216\022\177\234"
+	.ascii	"\025\374q\214\370\337t\341\377\033\307\326Z\263\263\202"
+	.string	"\247\245\267$\251H\220\347\216-\b\267\325\256\261\261\312\344l\300M\371\357\253\013\340`\002\227\367\336\317\3374\356\274\276\224\242\360\337T\273\352\037\246\346I\227\033\232\036\377=C\205\033\264\"#\357=\305\217n\352xbf\234P\265\247\376w\f\254\267\245L\030\364\222%\357-cG\375\226\332\316\276\245:<{on)\233.\2757m0\306"
+	.string	"c\fv\331\225\327\233p\377\215\034\247\3019\302\r\343\3477\024\236\221)\220\274gn\272\270\016\025\317o\247\355\244\2574RoZ}"
+	.ascii	"c\336\\\361\n\250X\260\330L\270\001pmS\230'\264\272\037K\277"
+	.ascii	"\231h\330\216\024\311\313{\273\320\1776\\\300\302\240\266RL`"
+	.ascii	"\223\275\276\255\264\223b\236\240D\353htU\213\313\223\220\335"
+	.ascii	"B\037i;.$U\362\376\233%^\001\333N\261Sl$\230\001\210\241\345"
+	.ascii	"\311\t\3220\261\245\305\310{#\351\0344bWd`y\357#\235c\246\252"
+	.ascii	"\t\2161\233-|\247\212\347\265\027\034\325^v\021O\201\324\373"
+	.ascii	"\223\001\304T\277\266gX\336\277\213\376\365\027=\270\233y\004"
+	.ascii	"_\312\214\344\2757\035C\273\312{"
+	.string	"\367\237\337L\270;/^y\347\340\034aL\177\332\324\361\n\246[\266h.;a\200:\311\023\217\nG5\0275oG\327\033\224[\340\f\324Z\002\265 \bL\f6\227'7\246*\351\202d*o-X\363\367\"\2133o\215%5\\\347\205z\\\241w\035\362I*\207\206\224\305\344qm_7\251,\302 \327d\320\261\304\221-\262\"\270!\234h}2\270!\260@\253\213<\256@7&\206\370\013\365\370(\217\302\027\352\301\240#\324\243lW\022t\222!\260Hcr\025\"\300\b6\350\346\002\n\240\343\253\274\2001\t\202-\261\2729C-\b\023C\252\313\"\213(B\220pD\256!^\226D\261\270^H\036\333\327\365a\215D\310b\362\350\323\272D>\024 \221D\311\24429|\211B\023\312V\350U&\207@+\213\334/\353\016\261CB \237\342\372\"Y\021\312\226-\261\2220&A\240@.\227\253"
+	.string	"^\250\207m\211\336\225\005\032^\330yY\267eK\260-\261X\301%R\34038l\320\353\256@D\342\213\\+\264\032\210\026~}W\343\313\2725\304\345\020;\302\313\272\026\274K\"e\033\304\016\255\355\272\364\311\240\230$\222\300\313\2722I\240\034\264\234y\211\311\240\245\232\fZj\326\204\243\273]\227m\215\306u\330\276Kmd\223AG\344:4\262.\321v\207\337\022\203\226=4\355*T\334(\332\327=\006\261\"`\020\023\242(\002\353\022\345\024Y$\020+\342e\203*\240X\333\026\204\233\201k4.\211*\260\356\221\346M\216p\217\032\330w}\335\230w\350\370&\211"
+	.string	"\340\006\255H\t\310\320p\3203\202\210bkS\363\323#\242\330\336\360\016z\3346\306-\212\340\272lQ\331./\030\223\353\320\2202D\261\205I*\225#\226 \222!\260\355\2723\324\202P\216@\001D\253\224\200[B\361\370\222\bJ\036]\r\270G\nJpW\013$\225\307b[\201m\217 \334\243\215\205!\366uQ\220\260Y\337UD\261\025~\361\002\007=o\273.{\220DE\344Z\274\340\213\307\226M\262A\374;xp"
+	.string	"\017>\234\030\376\007\005p\240"
+	.string	"\016\204\377A\001??\n\360\340\207\277\007?\372}Y\"\273dY\022f\336!Kt\211\336\365%q\363\276P\217\361\270\364\321ik\\\"\213<\002)\333\021\306\343r\346\303\210\374!\204\374ADf\227(^\"\020\316\214\tBD\240%\222hbE\021c\202PM\221(T|\225I\"\2057\311\026[v\304\210%\2211y\334\300\005\031\023k\007\206\210H\030\217\313\0326hm\331\022+1\351&\331\345\2202\204\3618\342]I(\221\223<Z\340\005a<.olP\274\307\022\307\367\350&Y\022H\266\004\213\274\031\201\202\344q\235@\253\004q\254 \302\211\025\311\212\340R`7\360&\217\312\345\313\222\030j\331\327\230\363\036\207\216\025"
+	.ascii	"\301\276\253\b&V\0248\357kL\262C\227(B\315\222}I\274\355\372"
+	.ascii	"\2720lPrmU\227x4&\225!\222\312\343\320\016K4\206pBI\302\320\030"
+	.ascii	"\002kT\016\tO\260\306d\b'\210V\033\"\023k\253\201X#\361\275\360"
+	.ascii	"B=-\213d\213\305\325\307m\225n\222u\003\260T]\242;tlG\030aL\202"
+	.ascii	"\310A\"\225\355vY\"\344ZB8\324\2565C\355J|\335\366\bDL*\211\310"
+	.ascii	"\265HT\266(\202,\b\025\337\243\t\227\210D\036K\240\200bE\262"
+	.ascii	"F\342P\273\272G#\021\007\251TB\200\250\276\220\005\"8\274BAG"
+	.ascii	"$\320\215\t%\262F(\350(dc\344\200\\\333\227\210M\302\260\310"
+	.ascii	"\367U\266B/\321\310\301\230\\I0\256\2541\347\205zN\264>'\332"
+	.ascii	"\234W.\331\326\347U*[\037\031\227\030t\004J*C\234hc\226\353P"
+	.ascii	"\261U[\326x,q\242E\256\307\226uq\222\312\243\353\022\221\340"
+	.ascii	"\326\234`\221K\"\021@\310U(\006\251,*_e\273\264y\211\035p0\036"
+	.ascii	"a\336$\221\262H\004j\211\307\245K<\321^\300yY\227m\225/\321J"
+	.ascii	"4&\217$\020\337\325%\016\021\265o\t\354\322\255`\206E\256E7\346"
+	.ascii	"m\331\022\311#\361\350\272\255L\2615\036\207\324\344q\210\227"
+	.ascii	"Pd\205\212'\326!n\343\206@\256%\222\312\343\273\"\225\313\226"
+	.ascii	"}\223!\024\333\013\354\022\305\b-\373\"\217\022\260`\002\b@@"
+	.ascii	"\312\227(DP\362(\364*\225C$\212m\216\313\262m\020+\202E\006%"
+	.ascii	"A\f\255!J,\201(\274\304\017C$\233L\256BE\342\t\242\325\306\210"
+	.ascii	"T\n\271l+4\002\373\256%\216o\021\004kTZ\240=\256:"
+	.string	"\311#\021/\262.\021\361\304:D<\321\312\274D\017~\336\344q\370\b\350PD@\002~:t\350\271\360\tH@\b\r\032\270\300\004x\261\307E*\3337\251,\022\213\255O\021\310'y\\\207|\212\255\353\323S\201\237\026\223N\365\222T(\352\023\037S4(\264\215\314\213\211\251\217oo\320\306\f\230&R\254`\311\373\002%RuO\252:\211\372\340D/?\255%\261\241\227\027\005n\310\r\335\303\007X'S\233d\254?\"R`d\374\2022;\225\211j\247\342\3010\177\240yN$*\236\272\344,\207\224\324\022U\211\230X\023=\035\246\223\026F\245\336\345\242\231\347\023+O\276\270zD\237\240K\357M\365HV\223\250H^=\3626\303'cHM\241]\315\027\213\261\030u\273\251$E\tH\336\027L\231S\213\314\251tO\241\331{Q\357TU\006\250\373\352\233\"\362*\235n\002\022XD'\006\007"
+	.string	"\013\025N\225S\341\3248\314d"
+	.ascii	" y\203\202\202\335\371b\303\277z\302\253qu\352\221\024+yy\253"
+	.ascii	"C\276\216\213\033\020'y\253B\276nx\207wUu!\220\377\253oFr9\264"
+	.ascii	"l\270A\325H\003\204\356\250\323\322\363a\\0$A\306\230b\204h\244"
+	.ascii	"i\322\001s\024@@hL.\035\214\227U\037\023@\022\352\003\252\222"
+	.ascii	"\205\225cHfDI\222\244T\331\031\003\370\255\374\027\332\004{\027"
+	.ascii	"\363\2449\321\322\361\343\244a\262E\276\026\242\001X\rH\270#"
+	.ascii	"x<\331\364_\342U\255\271@\354\241\342Th\261\016\203\021\341q"
+	.ascii	"^\003\\]\237\2402\360o\f9\231\251Z\226"
+	.string	",\001VDzIz?\202\210\204\232\211:3>\345\202y\026\247C\017\\\301G\002E\210e\245S\224E\002\373L\325Z+\371y\357\255"
+	.string	"\231\377\372\223\255P6\236\003\353\264Q\267\254\222\214\304\302\225\001\364\"YJ~\360\342m\364\250\253\241\215\250\234\350\342\333\261\"\377ve\3000x\323\305G0\244\"\017c\213\214\033S{Ju\3552\311\316z\217.\216\213\222\364+l\254?\300\035Um\257\364\206&"
+	.string	"\223O\t\200\2451\240\3306l7\217\330\177\324\0321N2Mo\274\301\221\221\233\256\360\351\251\300$\262*[8\201\314G\224I\247\"\377p\344\fG\265\331\313\016Zl\310o\231\220"
+	.string	"\002\004\220\227\222\006\373\342}\021\004\210\024\243U\365\331\250\001O\351\276:;s\276\276\004\222~\247Ne\220\205DU\177dxkw)\302\352\001z\357?]\267"
+	.string	"HTw\\3]J\364\253\2203>\367\262O:\027\246\214\267\217\220\245\250QU\377`&\002x\214\232R,\361>\320\341x\2173\363\3219\313\341\310\027\376\255\3410\b\375\333\374\313\233\t\355\b"
+	.ascii	"\261\303\233'\002\246\202\277\n\224U\031yL\313\277,\312\376i"
+	.ascii	"\3124\211\206\322\264\"tR\210\263\001\316@H\252\\\017"
+	.string	"\342\302e\240\2626f\3342\021`*X\254\030\362\342F-\020F\203%P\202{\206\216\345\305\033+\376\264\375=@\\+`\271w\373\331d\321\362\226\362\242\235|\t\300J\321s#b\226]\017\374]\0341\245{z_)\332\353(4D\337it\200\312\325\355%\242\300\357]V.\271\345\233\362e\003\255\216\364F\bq>W\236\204\340\272\372\024\006gD~z\0377*\262\276\264d}0\265\273A\341\253\305\254\240\\\004.aPt\253\306M\020.\r5C\306\026\027Q\201\310\265\226\355\251(\245W\0268\331X\177\225\242)'`\253\363\005u\276\326\347\235\256\277\243\323\2312\377\276\331\306\333La\264\306\213\361Y\220l7\324\360\024N+\225\340:\223\251\306\223\252\235~\267\251/\013\240\302&\032Kn\004z-\236o9y\004b\374\370\343\215\022\215?\220(\020\200\241\225\215\365'\020E\204\3024p\305\177"
+	.string	"\230\334\225\001Y\354\020\231q\200\024\"\307rn;\\\215s\347\037\352q\034\346\332\f\007\273\362n\245\2214\250z\347\035b\365\270Nt\365\237\365\037S\223\\s_\261\311BX;\343\177Vw\002\206G\035\231\202\344\342\253\276y\200\275A]_\262f4\335\346\364\322\334\301P6\006\222\260\244\200\\\025#Dt\250\336\003M\322J\215r\005\200\035\353i^e\230\341(\371G\232X._\353P\365cm\223\005\260&h\314\355\306\300\315\034\343T\031\351\325\205\234\242\317\227`\022\206\001n\363\227\201M\371s\257\001\365f\222"
+	.string	"X\310\350\211{V\266\027=~x\243\331\333\222\220V\216v~N\364\003\374\bPQE\321\007@.7N\300u\271\307S31\311\332\271\235\362\331\tH}n@\354\326\333`k\231O\313"
+	.ascii	"8\341wfiw\246\251%l4\241\n\227V\354\203Q\233\\Y\031\230\352\302"
+	.ascii	"9\356)%\330\324\342\211\252 V\016\206\322\322l\337\235&\302\232"
+	.ascii	"\352\300\202\242\260i\362\273;\016\343\016\316\354t\323\256;"
+	.ascii	"\256\261$\320\325\215@\344C\205/W$\fz#\\\036Q\203\345\205\021"
+	.ascii	"\252\"b\304gv\234\361\0132\006\217\347\310\276\226mW\355&\376"
+	.ascii	"\337\304\342\3035\274\027Y\b\230\346\333!\023\250<\373\331\302"
+	.ascii	"\321\302mY\210\361w\230&\244\2278)z#\377\3033/^I\363\322\341"
+	.ascii	"h\317\267\341\037N\254w\353`4g\026\334:\230\262\342\013\325\251"
+	.ascii	"1\305\277\214X\0378\205v\033\034\212W%=\035\203\003?\233 \330"
+	.ascii	"\321\016\263\t\355\033\276I\202\330\236\273\277.&J<\240\347\325"
+	.ascii	"$\215\234k|\232F\325\347XfJ\243L\371\030\002\021Z\313\241\332"
+	.ascii	"%\253\311l!|.\032\367\261\213XE\224]\321\323\020PP\372G`\244"
+	.ascii	"\247\216\f\367\035<%\270\016\365\374\362\246wi\341\007hvc\352"
+	.ascii	"g9\222{\n7r\273v\302[\226\226\221eW\224<\275\356]\201&+\331\355"
+	.ascii	"c.i\260\330\250l\217t\316HT\311\032\327\243\031\207\301\003\326"
+	.ascii	"\r-\354\211C\353\244\005j\332\317&|\203\254\001\3746\307\375"
+	.ascii	"mY\304S\332X>[4\351\004`\304\355\250\301a\200\331a\021\274\347"
+	.ascii	"A\260\327\234X\264\372\325\374\253a\024)tI\037\n0;yP0\346\314"
+	.ascii	"X{\034c\246\003T\230\312\252\231\261\363\221\333a\033\314\255"
+	.ascii	"b\340\244\345\200\340\206l,\246\240T\022\205\274\343\2701\203"
+	.ascii	"\245\311\034|C\327-\362&\030\234K\177\f\365:8.\261\325\341\337"
+	.ascii	"Rf\017\rl\034\025\235J\315Q\346k\267=\013\375x\262\370S\211'"
+	.ascii	"\344y\327@\365G\264\3003:\023\252\253D\374\260\363\376\027\253"
+	.ascii	"\271\231\316\257~\301\240\027\224e\265C\221\341sg32G_\330\004"
+	.ascii	"\003rU\"\265\n\rj6v\363\001f\035%\324G\207\003\027\327\022'\250"
+	.ascii	"\222\374m\244\215xO\225\323\317\223^\273\2078\320e\355\tG#\024"
+	.ascii	"\\\347\344u\332\200\226\302\344\376\210?\001E1\255\275q)d@$\346"
+	.ascii	"\265\375\353\325\306\323\237\271\003\021\260\251[|K2$'8\215%"
+	.ascii	"\213\312\213\"4\027\321\006I0\253\t8\364\347\034]\022\365\201"
+	.ascii	"\333\275\245\370vA\247\332\206;\025\232\271w?\345M \022\"l\221"
+	.ascii	"Gv\216\272\271\366\373\347E\r\364Sw\315=z\"k\226:\366\244o\247"
+	.ascii	"\001\227\335*0\027{,f}\315\360\356\314\310\203Aq\373\321\231"
+	.ascii	"'\360\270`\035(\230\254\003%0\f\211\\\213\234z$\321\275\330\242"
+	.ascii	"\314\372\217\356\250\3239\022\3158`\f\240\t2\335rr\034\303C\272"
+	.ascii	"y\320\240F\227\211\231\306\207ojR?\003\363\024\241\301\237\225"
+	.ascii	"D[9l\246Z^\265'`\237\253\270 \031\\I\024.\r\274\350\037\333\315"
+	.ascii	"0\370\022\016\352P\200'H\217\024\234\246,\370#\245\316\265\255"
+	.ascii	"\256c;\034\022p\0020-&oM\231\370N\356Z>\037>\004n\232\001\334"
+	.ascii	"\037&h[m\213\200\300\tuu\b\237\0163-\253\252\220\220\364c\340"
+	.ascii	"#\022\267\030\211\311\230\233/\207x\311\377\211&\006q\376'\232"
+	.ascii	"\343\366g\210\367\370$\356\330Y[\223\202\203\\s\201\262\350\231"
+	.ascii	"\331\330_\030\246\320j\364N1\021~&\346\245md\276hBv\271E3U\302"
+	.ascii	"f\205\277b\370Slq\007(\306K\315\352\006_\\\004\246\326\\\325"
+	.ascii	"O&\326#\023\231\020\204\337\2236!\241P\312A\205}\316\254\363"
+	.ascii	"c\350\357\005\"\001\204:\370,\375!\341\233\341NHH0ZR\301\031"
+	.ascii	"c\020\363p\3628\267\023O\202G.\371d\206\357\345=J,\220j\341\375"
+	.ascii	"0\321l\261\250\f\035\344\214\334\224\234\354}\t\326,\260\363"
+	.ascii	"\031\312\301*\220\276\340#L\033\273\203\342\237\376\0175\247"
+	.ascii	"\374Z\260\022\345\336\036\320\351\202\007\237\311\324\023$\355"
+	.ascii	"\305>\240Aw4\374\204.p;\343R\376>rIi@\034\316$P\305\322\324\272"
+	.ascii	"\356\342g\225\253X\031\264\016\333\323Z\276\207\177$\0065g\027"
+	.ascii	"}\312\323\341\205\276\245\005\002\346t3\345+\350\335[\263\255"
+	.ascii	"U\342\301A\330Wgm\266\230\265\352\330\352/\027\025\363e\035\305"
+	.ascii	"\367j>z>\301\247\035\323\350\2377\312\212+\3469\004\353\031D"
+	.ascii	"\302\277\223"
+	.string	"S\035\004\227\302v\337p0/>\017\340|\3757\250\217h\034\021\240/\f&s\372\373\307\215Y\324=\226E\233\204\325\260L\035\305\367\031\227\253\201\327\376\3670d\270A\317\037\017\212\013g\222iU\007\267'\360\306\306D\226g9\217\004\306\2375\303\216\b\371DeO\022\357P\350\006\031!+C``\017\330P(\226\274}\261c\303\023`\237W\315\311D\326\b\212\352\n=\277\275D\342\360x\2622\030\370\3650\240G\177"
+	.ascii	"M\327!u\317\376\357\006\030>\r\021\333 \253E\345)\007#\344\364"
+	.ascii	"\225\344\324[<\002?\243\005\370\020\252aUD]\327\365\250\335\214"
+	.ascii	"\006Cy}n\231+\242'\217\336Jh^t\017\226{\266x\016\337ei\306\235"
+	.ascii	"(~\325\306\004\247\336\236\212\016/\373\027\206\352\207\365\276"
+	.ascii	"\373K\f_\032;\364b\036\030g\276^\3547T\004\277\250\363\221\344"
+	.ascii	"\246-\016\027G\221W\330\326\326\017\324\032\363I\006,@\221\357"
+	.ascii	"M\333\256\336\037\\+~py\007a|S\343\316\202\243`.o\356\0173_\n"
+	.ascii	"O\206o\036\003@\257\3007\030q>\334\270\351\263\237y\323\311N"
+	.ascii	"\024,\005\037xz\257\303:\306m\213F\213\217y}\036\243^\245x\023"
+	.ascii	"\322\243\217i\034\203a\346\267\317\341\300\231m\203\320e\367"
+	.ascii	"\273H+\263n\242\023;\326}!\331\177\271g<\207\330:\231\331z\313"
+	.ascii	"\316\031\367\237\314\316!\346\022M\3574\372\202x\263\037d\027"
+	.ascii	"-\373\343\374\223n\374\177\233\346\377\245y\323\264\203g\304"
+	.ascii	"\316zU\367X\\\342\035v\327\020Y\276\226\017Wp\217\207\337v\375"
+	.ascii	"s\236 \3773\337*\300'\325\257\252r9\023R\353s\355L\275Y\357\227"
+	.ascii	"\"\364\253\030\233\273/\376\357\204t\031\363-\310Uw;\220\343"
+	.ascii	"t\230\373G\302]\001"
+	.text
+	.section	.gnu.lto_.symtab.a40cbe370fcd07f8,"e",@progbits
+	.string	"isAirmodeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\240"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"useRcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\002"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\002"
+	.string	""
+	.string	"applyAndSaveAccelerometerTrimsDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"mwArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"changePidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"handleInflightCalibrationStickPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"gyroSetCalibrationCycles"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"mwDisarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a40cbe370fcd07f8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,15836 @@
+	.file	"altitudehold.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/fc/rc_controls.h"
+	.file 6 "./src/main/fc/runtime_config.h"
+	.file 7 "./src/main/common/time.h"
+	.file 8 "./src/main/flight/altitudehold.h"
+	.file 9 "./src/main/flight/imu.h"
+	.file 10 "./src/main/flight/pid.h"
+	.file 11 "./src/main/rx/rx.h"
+	.file 12 "./src/main/drivers/barometer.h"
+	.file 13 "./src/main/sensors/barometer.h"
+	.file 14 "./src/main/flight/altitudehold.c"
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 16 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	altitudehold.c.1b382c1b
+	.weak	altitudehold.c.1b382c1b
+altitudehold.c.1b382c1b:
+	.long	0xb27
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF2198
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1972
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1973
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1974
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1975
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1976
+	.uleb128 0x3
+	.long	.LASF1977
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1978
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1979
+	.uleb128 0x3
+	.long	.LASF1980
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1981
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1982
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1983
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1984
+	.uleb128 0x3
+	.long	.LASF1985
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1986
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1987
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1988
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1989
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1990
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1991
+	.uleb128 0x7
+	.long	0xab
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1992
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1993
+	.uleb128 0xd
+	.long	0x9f
+	.long	0x10c
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1994
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xc3
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x146
+	.uleb128 0x9
+	.long	.LASF1995
+	.value	0xfff
+	.uleb128 0x9
+	.long	.LASF1996
+	.value	0xf000
+	.uleb128 0x9
+	.long	.LASF1997
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1999
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2000
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xf
+	.long	0x152
+	.uleb128 0x17
+	.long	0x162
+	.uleb128 0x8
+	.long	0x96
+	.uleb128 0x8
+	.long	0x7c
+	.byte	0
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x4
+	.byte	0x35
+	.byte	0x5
+	.long	0x183
+	.uleb128 0x12
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x36
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x12
+	.string	"fn"
+	.byte	0x4
+	.byte	0x37
+	.byte	0x16
+	.long	0x183
+	.byte	0
+	.uleb128 0x7
+	.long	0x146
+	.uleb128 0xa
+	.long	.LASF2050
+	.byte	0x20
+	.byte	0x4
+	.byte	0x30
+	.long	0x1d6
+	.uleb128 0xb
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xb
+	.long	0x10c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2001
+	.byte	0x4
+	.byte	0x32
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2002
+	.byte	0x4
+	.byte	0x33
+	.byte	0xe
+	.long	0x1d6
+	.byte	0x8
+	.uleb128 0xb
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x34
+	.byte	0xf
+	.long	0x1db
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2003
+	.byte	0x4
+	.byte	0x38
+	.byte	0x7
+	.long	0x162
+	.byte	0x18
+	.byte	0
+	.uleb128 0x7
+	.long	0xb7
+	.uleb128 0x7
+	.long	0x1d6
+	.uleb128 0x3
+	.long	.LASF2004
+	.byte	0x4
+	.byte	0x39
+	.byte	0x3
+	.long	0x188
+	.uleb128 0x10
+	.long	0x1e0
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x5
+	.byte	0x18
+	.long	0x2bd
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2022
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2023
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2026
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2027
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2030
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2031
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2032
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2033
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2034
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2035
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2036
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2048
+	.byte	0x5
+	.byte	0x3c
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0x22
+	.long	.LASF2199
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x5
+	.byte	0x41
+	.byte	0xe
+	.long	0x324
+	.uleb128 0x1
+	.long	.LASF2037
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2038
+	.byte	0x1
+	.uleb128 0x23
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2039
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2040
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2042
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2043
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2044
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2045
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2046
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2047
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2049
+	.byte	0x5
+	.byte	0x9b
+	.byte	0x10
+	.long	0xfc
+	.uleb128 0xa
+	.long	.LASF2051
+	.byte	0x5
+	.byte	0x5
+	.byte	0x9d
+	.long	0x37e
+	.uleb128 0x2
+	.long	.LASF2052
+	.byte	0x5
+	.byte	0x9e
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2053
+	.byte	0x5
+	.byte	0x9f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2054
+	.byte	0x5
+	.byte	0xa0
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2055
+	.byte	0x5
+	.byte	0xa1
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2056
+	.byte	0x5
+	.byte	0xa2
+	.byte	0x9
+	.long	0x37e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2057
+	.uleb128 0x3
+	.long	.LASF2058
+	.byte	0x5
+	.byte	0xa3
+	.byte	0x3
+	.long	0x330
+	.uleb128 0x10
+	.long	0x385
+	.uleb128 0x4
+	.long	.LASF2059
+	.byte	0x5
+	.byte	0xa5
+	.byte	0x1b
+	.long	0x385
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x6
+	.byte	0x22
+	.long	0x3f3
+	.uleb128 0x1
+	.long	.LASF2060
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2061
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2062
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2063
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2064
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2065
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2066
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2067
+	.byte	0x80
+	.uleb128 0x9
+	.long	.LASF2068
+	.value	0x100
+	.uleb128 0x9
+	.long	.LASF2069
+	.value	0x200
+	.uleb128 0x9
+	.long	.LASF2070
+	.value	0x400
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2071
+	.byte	0x6
+	.byte	0x2e
+	.byte	0x3
+	.long	0x3a2
+	.uleb128 0x4
+	.long	.LASF2072
+	.byte	0x6
+	.byte	0x30
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x6
+	.byte	0x36
+	.long	0x435
+	.uleb128 0x1
+	.long	.LASF2073
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2075
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2078
+	.byte	0x6
+	.byte	0x42
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF2079
+	.byte	0x7
+	.byte	0x21
+	.byte	0x12
+	.long	0xcf
+	.uleb128 0x4
+	.long	.LASF2080
+	.byte	0x8
+	.byte	0x16
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x4
+	.long	.LASF2081
+	.byte	0x8
+	.byte	0x17
+	.byte	0x10
+	.long	0xab
+	.uleb128 0xa
+	.long	.LASF2082
+	.byte	0x1
+	.byte	0x8
+	.byte	0x19
+	.long	0x47f
+	.uleb128 0x2
+	.long	.LASF2083
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x9
+	.long	0x37e
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2084
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x3
+	.long	0x465
+	.uleb128 0x10
+	.long	0x47f
+	.uleb128 0x4
+	.long	.LASF2085
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x19
+	.long	0x47f
+	.uleb128 0x4
+	.long	.LASF2086
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0x4
+	.long	.LASF2087
+	.byte	0x9
+	.byte	0x1b
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF2088
+	.byte	0x9
+	.byte	0x1c
+	.byte	0xe
+	.long	0xee
+	.uleb128 0xd
+	.long	0xab
+	.long	0x4d0
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2089
+	.byte	0x9
+	.byte	0x1d
+	.byte	0x10
+	.long	0x4c0
+	.uleb128 0x24
+	.byte	0x6
+	.byte	0x9
+	.byte	0x22
+	.byte	0x5
+	.long	0x50d
+	.uleb128 0x2
+	.long	.LASF2090
+	.byte	0x9
+	.byte	0x24
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2091
+	.byte	0x9
+	.byte	0x25
+	.byte	0x11
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0xb
+	.string	"yaw"
+	.byte	0x9
+	.byte	0x26
+	.byte	0x11
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x18
+	.byte	0x6
+	.byte	0x9
+	.byte	0x20
+	.byte	0x9
+	.long	0x52f
+	.uleb128 0x12
+	.string	"raw"
+	.byte	0x9
+	.byte	0x21
+	.byte	0xd
+	.long	0x52f
+	.uleb128 0x25
+	.long	.LASF2092
+	.byte	0x9
+	.byte	0x27
+	.byte	0x7
+	.long	0x4dc
+	.byte	0
+	.uleb128 0xd
+	.long	0x9f
+	.long	0x53f
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2093
+	.byte	0x9
+	.byte	0x28
+	.byte	0x3
+	.long	0x50d
+	.uleb128 0x4
+	.long	.LASF2094
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x53f
+	.uleb128 0xf
+	.long	0x30
+	.byte	0xa
+	.byte	0x23
+	.long	0x5a5
+	.uleb128 0x1
+	.long	.LASF2095
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0xa
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2106
+	.byte	0x4c
+	.byte	0xa
+	.byte	0x3c
+	.long	0x6cd
+	.uleb128 0xb
+	.string	"P8"
+	.byte	0xa
+	.byte	0x3d
+	.byte	0xd
+	.long	0x6cd
+	.byte	0
+	.uleb128 0xb
+	.string	"I8"
+	.byte	0xa
+	.byte	0x3e
+	.byte	0xd
+	.long	0x6cd
+	.byte	0xa
+	.uleb128 0xb
+	.string	"D8"
+	.byte	0xa
+	.byte	0x3f
+	.byte	0xd
+	.long	0x6cd
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2107
+	.byte	0xa
+	.byte	0x41
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2108
+	.byte	0xa
+	.byte	0x42
+	.byte	0xe
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2109
+	.byte	0xa
+	.byte	0x43
+	.byte	0xe
+	.long	0xc3
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2110
+	.byte	0xa
+	.byte	0x44
+	.byte	0xe
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2111
+	.byte	0xa
+	.byte	0x45
+	.byte	0xe
+	.long	0xc3
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2112
+	.byte	0xa
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2113
+	.byte	0xa
+	.byte	0x47
+	.byte	0xb
+	.long	0xee
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2114
+	.byte	0xa
+	.byte	0x48
+	.byte	0xb
+	.long	0xee
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2115
+	.byte	0xa
+	.byte	0x49
+	.byte	0xd
+	.long	0xb7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2116
+	.byte	0xa
+	.byte	0x4a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF2117
+	.byte	0xa
+	.byte	0x4b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2118
+	.byte	0xa
+	.byte	0x4c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF2119
+	.byte	0xa
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2120
+	.byte	0xa
+	.byte	0x50
+	.byte	0xe
+	.long	0xc3
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2121
+	.byte	0xa
+	.byte	0x51
+	.byte	0xb
+	.long	0xee
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2122
+	.byte	0xa
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2123
+	.byte	0xa
+	.byte	0x53
+	.byte	0xd
+	.long	0xb7
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF2124
+	.byte	0xa
+	.byte	0x54
+	.byte	0xb
+	.long	0xee
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2125
+	.byte	0xa
+	.byte	0x55
+	.byte	0xb
+	.long	0xee
+	.byte	0x48
+	.byte	0
+	.uleb128 0xd
+	.long	0xb7
+	.long	0x6dd
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2126
+	.byte	0xa
+	.byte	0x56
+	.byte	0x3
+	.long	0x5a5
+	.uleb128 0xd
+	.long	0x9f
+	.long	0x6f9
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2127
+	.byte	0xb
+	.byte	0x50
+	.byte	0x10
+	.long	0x6e9
+	.uleb128 0x3
+	.long	.LASF2128
+	.byte	0xc
+	.byte	0x14
+	.byte	0x10
+	.long	0x711
+	.uleb128 0x7
+	.long	0x716
+	.uleb128 0x26
+	.uleb128 0x3
+	.long	.LASF2129
+	.byte	0xc
+	.byte	0x15
+	.byte	0x10
+	.long	0x723
+	.uleb128 0x7
+	.long	0x728
+	.uleb128 0x17
+	.long	0x738
+	.uleb128 0x8
+	.long	0xe9
+	.uleb128 0x8
+	.long	0xe9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2130
+	.byte	0x30
+	.byte	0xc
+	.byte	0x17
+	.long	0x7a0
+	.uleb128 0x2
+	.long	.LASF2131
+	.byte	0xc
+	.byte	0x18
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2132
+	.byte	0xc
+	.byte	0x19
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2133
+	.byte	0xc
+	.byte	0x1a
+	.byte	0x13
+	.long	0x705
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2134
+	.byte	0xc
+	.byte	0x1b
+	.byte	0x13
+	.long	0x705
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2135
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x13
+	.long	0x705
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2136
+	.byte	0xc
+	.byte	0x1d
+	.byte	0x13
+	.long	0x705
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2137
+	.byte	0xc
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x717
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2138
+	.byte	0xc
+	.byte	0x1f
+	.byte	0x3
+	.long	0x738
+	.uleb128 0xa
+	.long	.LASF2139
+	.byte	0x10
+	.byte	0xd
+	.byte	0x21
+	.long	0x7fa
+	.uleb128 0x2
+	.long	.LASF2140
+	.byte	0xd
+	.byte	0x22
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2141
+	.byte	0xd
+	.byte	0x23
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2142
+	.byte	0xd
+	.byte	0x24
+	.byte	0xb
+	.long	0xee
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2143
+	.byte	0xd
+	.byte	0x25
+	.byte	0xb
+	.long	0xee
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2144
+	.byte	0xd
+	.byte	0x26
+	.byte	0xb
+	.long	0xee
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2145
+	.byte	0xd
+	.byte	0x27
+	.byte	0x3
+	.long	0x7ac
+	.uleb128 0x10
+	.long	0x7fa
+	.uleb128 0x4
+	.long	.LASF2146
+	.byte	0xd
+	.byte	0x29
+	.byte	0x1a
+	.long	0x7fa
+	.uleb128 0xa
+	.long	.LASF2147
+	.byte	0x38
+	.byte	0xd
+	.byte	0x2b
+	.long	0x84b
+	.uleb128 0xb
+	.string	"dev"
+	.byte	0xd
+	.byte	0x2c
+	.byte	0xf
+	.long	0x7a0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2148
+	.byte	0xd
+	.byte	0x2d
+	.byte	0xd
+	.long	0xab
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2149
+	.byte	0xd
+	.byte	0x2e
+	.byte	0xd
+	.long	0xab
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2150
+	.byte	0xd
+	.byte	0x2f
+	.byte	0x3
+	.long	0x817
+	.uleb128 0x4
+	.long	.LASF2151
+	.byte	0xd
+	.byte	0x31
+	.byte	0xf
+	.long	0x84b
+	.uleb128 0x4
+	.long	.LASF2152
+	.byte	0xe
+	.byte	0x2f
+	.byte	0x1f
+	.long	0x48b
+	.uleb128 0x13
+	.long	0x490
+	.byte	0x2f
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF2153
+	.byte	0xe
+	.byte	0x2f
+	.byte	0x81
+	.long	0x1ec
+	.uleb128 0x27
+	.long	0x876
+	.byte	0xad
+	.uleb128 0x28
+	.long	0x863
+	.byte	0x31
+	.byte	0x18
+	.uleb128 0x11
+	.long	.LASF2154
+	.byte	0x35
+	.long	0xab
+	.uleb128 0x11
+	.long	.LASF2155
+	.byte	0x36
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2156
+	.byte	0x37
+	.long	0xab
+	.uleb128 0x11
+	.long	.LASF2157
+	.byte	0x38
+	.long	0xab
+	.uleb128 0x13
+	.long	0x44d
+	.byte	0x39
+	.byte	0x9
+	.uleb128 0x13
+	.long	0x459
+	.byte	0x3a
+	.byte	0x9
+	.uleb128 0x5
+	.long	.LASF2158
+	.byte	0x3d
+	.byte	0x16
+	.long	0x8d0
+	.uleb128 0x7
+	.long	0x6dd
+	.uleb128 0x5
+	.long	.LASF2159
+	.byte	0x46
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x5
+	.long	.LASF2160
+	.byte	0x47
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x29
+	.long	.LASF2165
+	.byte	0xf
+	.value	0x13d
+	.byte	0x11
+	.long	0x8f
+	.long	0x902
+	.uleb128 0x8
+	.long	0xee
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2161
+	.byte	0x9
+	.byte	0x4a
+	.uleb128 0x1a
+	.long	.LASF2163
+	.byte	0x38
+	.byte	0x9
+	.long	0xab
+	.uleb128 0x19
+	.long	.LASF2162
+	.byte	0xd
+	.byte	0x39
+	.uleb128 0x1a
+	.long	.LASF2164
+	.byte	0x34
+	.byte	0x5
+	.long	0x37e
+	.uleb128 0x14
+	.long	.LASF2166
+	.byte	0x10
+	.byte	0x51
+	.byte	0x9
+	.long	0xab
+	.long	0x941
+	.uleb128 0x8
+	.long	0xab
+	.uleb128 0x8
+	.long	0xab
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2167
+	.byte	0x6
+	.byte	0x44
+	.byte	0xa
+	.long	0xc3
+	.long	0x957
+	.uleb128 0x8
+	.long	0x3f3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2168
+	.byte	0x6
+	.byte	0x45
+	.byte	0xa
+	.long	0xc3
+	.long	0x96d
+	.uleb128 0x8
+	.long	0x3f3
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2169
+	.byte	0xe
+	.value	0x13f
+	.byte	0x9
+	.long	0xab
+	.uleb128 0x1b
+	.long	.LASF2189
+	.byte	0xcc
+	.long	0xa09
+	.uleb128 0xc
+	.long	.LASF2179
+	.byte	0xe
+	.byte	0xcc
+	.byte	0x2a
+	.long	0x441
+	.uleb128 0x5
+	.long	.LASF2170
+	.byte	0xce
+	.byte	0x15
+	.long	0x441
+	.uleb128 0x5
+	.long	.LASF2171
+	.byte	0xcf
+	.byte	0xe
+	.long	0xcf
+	.uleb128 0x5
+	.long	.LASF2172
+	.byte	0xd0
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x1c
+	.string	"dt"
+	.byte	0xd1
+	.byte	0xb
+	.long	0xee
+	.uleb128 0x5
+	.long	.LASF2173
+	.byte	0xd2
+	.byte	0xb
+	.long	0xee
+	.uleb128 0x5
+	.long	.LASF2174
+	.byte	0xd3
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2175
+	.byte	0xd4
+	.byte	0xb
+	.long	0xee
+	.uleb128 0x5
+	.long	.LASF2176
+	.byte	0xd5
+	.byte	0x12
+	.long	0xee
+	.uleb128 0x1c
+	.string	"vel"
+	.byte	0xd6
+	.byte	0x12
+	.long	0xee
+	.uleb128 0x5
+	.long	.LASF2177
+	.byte	0xd7
+	.byte	0x12
+	.long	0xee
+	.uleb128 0x5
+	.long	.LASF2178
+	.byte	0xd8
+	.byte	0x14
+	.long	0xab
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2183
+	.byte	0xa8
+	.byte	0x9
+	.long	0xab
+	.long	0xa5e
+	.uleb128 0xc
+	.long	.LASF2174
+	.byte	0xe
+	.byte	0xa8
+	.byte	0x34
+	.long	0xab
+	.uleb128 0xc
+	.long	.LASF2175
+	.byte	0xe
+	.byte	0xa8
+	.byte	0x43
+	.long	0xee
+	.uleb128 0xc
+	.long	.LASF2176
+	.byte	0xe
+	.byte	0xa8
+	.byte	0x53
+	.long	0xee
+	.uleb128 0x5
+	.long	.LASF2180
+	.byte	0xaa
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2181
+	.byte	0xab
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2182
+	.byte	0xac
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2184
+	.byte	0xa3
+	.byte	0x5
+	.long	0x37e
+	.long	0xa7a
+	.uleb128 0xc
+	.long	.LASF2094
+	.byte	0xe
+	.byte	0xa3
+	.byte	0x34
+	.long	0xa7a
+	.byte	0
+	.uleb128 0x7
+	.long	0x53f
+	.uleb128 0x15
+	.long	.LASF2185
+	.byte	0x92
+	.uleb128 0x15
+	.long	.LASF2186
+	.byte	0x81
+	.uleb128 0x15
+	.long	.LASF2187
+	.byte	0x78
+	.uleb128 0x2b
+	.long	.LASF2200
+	.byte	0xe
+	.byte	0x6f
+	.byte	0xd
+	.uleb128 0x2c
+	.long	.LASF2195
+	.byte	0xe
+	.byte	0x4e
+	.byte	0xd
+	.long	0xab1
+	.uleb128 0x5
+	.long	.LASF2188
+	.byte	0x50
+	.byte	0x14
+	.long	0xb7
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2190
+	.byte	0x3f
+	.long	0xac8
+	.uleb128 0xc
+	.long	.LASF2191
+	.byte	0xe
+	.byte	0x3f
+	.byte	0x2a
+	.long	0x8d0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2192
+	.byte	0xd
+	.byte	0x29
+	.byte	0x59
+	.long	0xad4
+	.uleb128 0x7
+	.long	0x806
+	.uleb128 0x16
+	.long	.LASF2193
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x56
+	.long	0xae5
+	.uleb128 0x7
+	.long	0x48b
+	.uleb128 0x16
+	.long	.LASF2194
+	.byte	0x5
+	.byte	0xa5
+	.byte	0x5c
+	.long	0xaf6
+	.uleb128 0x7
+	.long	0x391
+	.uleb128 0x2d
+	.long	.LASF2196
+	.byte	0x10
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x1e
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x1e
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0xc
+	.long	.LASF2197
+	.byte	0x10
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 17 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 19 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.file 20 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 22 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 23 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 26 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 33 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF806
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF842
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x111
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF870
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF871
+	.byte	0x4
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF888
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF889
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF890
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF891
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF894
+	.file 46 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF895
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF912
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF925
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF930
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF933
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF934
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF950
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF951
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF952
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF964
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF971
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF972
+	.byte	0x4
+	.byte	0x4
+	.file 63 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF976
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x40
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x4
+	.file 66 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x43
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1376
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 75 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4b
+	.file 76 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 77 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x4d
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.file 78 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x4e
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1744
+	.byte	0x4
+	.byte	0x4
+	.file 79 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.file 80 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4
+	.file 81 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.file 82 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1917
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1956
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1957
+	.byte	0x4
+	.file 83 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x53
+	.file 84 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x54
+	.file 85 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.file 86 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x56
+	.file 87 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1964
+	.byte	0x4
+	.file 88 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x58
+	.file 89 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x59
+	.byte	0x4
+	.byte	0x4
+	.file 90 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5a
+	.file 91 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1969
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1971
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF815
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF834
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF869
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.526987f9f8e61fa953f503f76de36390,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF887
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.135.9eeb6b52c2522ad7aff16ad95342972e,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF903
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF911
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF929
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF932
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.52.4f882364bb7424384ae71496b52638dc,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF945
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF949
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF970
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1253
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1257
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1261
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1263
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1265
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1275
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1289
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1291
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1293
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1299
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1301
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1303
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1305
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1307
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1317
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1319
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1321
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1323
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1345
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1357
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1375
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1378
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1383
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1413
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1425
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1426
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1427
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1428
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1438
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1443
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1454
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1457
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1460
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1463
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1441
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1464
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1465
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1466
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1467
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1468
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1486
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1490
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1651
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1664
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1665
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1666
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1667
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1612
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1692
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1693
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1694
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1695
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1696
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1697
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1698
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1699
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1700
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1701
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1702
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1703
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1704
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1705
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1706
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1707
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1708
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1709
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1710
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1711
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1712
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1713
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1714
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1715
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1716
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1718
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1720
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1721
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1722
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1749
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1753
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1769
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1776
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1799
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1881
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1916
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1927
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1968
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF2201
+	.long	.LASF2202
+	.long	.LASF2203
+	.long	.LASF2204
+	.long	.LASF2205
+	.long	.LASF2206
+	.long	.LASF2207
+	.long	.LASF2208
+	.long	.LASF2209
+	.long	.LASF2210
+	.long	.LASF2211
+	.long	.LASF2212
+	.long	.LASF2213
+	.long	.LASF2214
+	.long	.LASF2215
+	.long	.LASF2216
+	.long	.LASF2217
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x5c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2218
+	.byte	0xd
+	.long	.LASF2219
+	.byte	0xd
+	.long	.LASF2220
+	.byte	0xd
+	.long	.LASF2221
+	.byte	0x3
+	.long	.LASF2222
+	.byte	0x5
+	.long	.LASF2223
+	.byte	0x5
+	.long	.LASF2224
+	.byte	0x2
+	.long	.LASF2225
+	.byte	0x6
+	.long	.LASF2226
+	.byte	0x6
+	.long	.LASF2227
+	.byte	0x6
+	.long	.LASF2228
+	.byte	0x7
+	.long	.LASF2229
+	.byte	0x4
+	.long	.LASF2229
+	.byte	0x8
+	.long	.LASF2230
+	.byte	0x6
+	.long	.LASF2231
+	.byte	0xd
+	.long	.LASF2232
+	.byte	0x2
+	.long	.LASF2233
+	.byte	0x10
+	.long	.LASF2234
+	.byte	0x11
+	.long	.LASF2235
+	.byte	0x11
+	.long	.LASF2235
+	.byte	0x10
+	.long	.LASF2236
+	.byte	0xd
+	.long	.LASF2237
+	.byte	0x10
+	.long	.LASF2238
+	.byte	0x10
+	.long	.LASF2239
+	.byte	0xd
+	.long	.LASF2240
+	.byte	0xd
+	.long	.LASF2241
+	.byte	0xf
+	.long	.LASF2242
+	.byte	0xd
+	.long	.LASF2243
+	.byte	0xe
+	.long	.LASF2244
+	.byte	0xe
+	.long	.LASF2245
+	.byte	0xd
+	.long	.LASF2246
+	.byte	0xd
+	.long	.LASF2247
+	.byte	0xd
+	.long	.LASF2248
+	.byte	0x10
+	.long	.LASF2249
+	.byte	0x11
+	.long	.LASF2250
+	.byte	0xd
+	.long	.LASF2251
+	.byte	0xd
+	.long	.LASF2252
+	.byte	0xd
+	.long	.LASF2253
+	.byte	0xd
+	.long	.LASF2254
+	.byte	0xc
+	.long	.LASF2255
+	.byte	0xc
+	.long	.LASF2218
+	.byte	0xf
+	.long	.LASF2256
+	.byte	0xc
+	.long	.LASF2257
+	.byte	0xc
+	.long	.LASF2258
+	.byte	0xc
+	.long	.LASF2259
+	.byte	0xc
+	.long	.LASF2260
+	.byte	0x10
+	.long	.LASF2260
+	.byte	0xd
+	.long	.LASF2261
+	.byte	0xd
+	.long	.LASF2262
+	.byte	0xd
+	.long	.LASF2263
+	.byte	0xd
+	.long	.LASF2264
+	.byte	0xf
+	.long	.LASF2264
+	.byte	0xd
+	.long	.LASF2265
+	.byte	0xc
+	.long	.LASF2266
+	.byte	0xc
+	.long	.LASF2267
+	.byte	0xc
+	.long	.LASF2268
+	.byte	0xc
+	.long	.LASF2269
+	.byte	0xd
+	.long	.LASF2270
+	.byte	0xd
+	.long	.LASF2271
+	.byte	0xd
+	.long	.LASF2272
+	.byte	0xd
+	.long	.LASF2273
+	.byte	0xd
+	.long	.LASF2274
+	.byte	0xd
+	.long	.LASF2275
+	.byte	0x10
+	.long	.LASF2276
+	.byte	0xd
+	.long	.LASF2277
+	.byte	0xd
+	.long	.LASF2278
+	.byte	0x10
+	.long	.LASF2279
+	.byte	0xd
+	.long	.LASF2280
+	.byte	0xd
+	.long	.LASF2281
+	.byte	0xd
+	.long	.LASF2282
+	.byte	0xd
+	.long	.LASF2283
+	.byte	0xd
+	.long	.LASF2284
+	.byte	0xd
+	.long	.LASF2285
+	.byte	0xd
+	.long	.LASF2286
+	.byte	0xd
+	.long	.LASF2287
+	.byte	0xb
+	.long	.LASF2288
+	.byte	0xa
+	.long	.LASF2289
+	.byte	0x9
+	.long	.LASF2290
+	.byte	0xa
+	.long	.LASF2291
+	.byte	0x1
+	.long	.LASF2292
+	.byte	0x2
+	.long	.LASF2293
+	.byte	0x1
+	.long	.LASF2294
+	.byte	0x3
+	.long	.LASF2295
+	.byte	0x8
+	.long	.LASF2296
+	.byte	0x4
+	.long	.LASF2297
+	.byte	0x4
+	.long	.LASF2298
+	.byte	0x8
+	.long	.LASF2299
+	.byte	0x2
+	.long	.LASF2300
+	.byte	0x8
+	.long	.LASF2301
+	.byte	0x8
+	.long	.LASF2302
+	.byte	0x8
+	.long	.LASF2303
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1339:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF864:
+	.string	"__ldiv_t_defined 1"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1900:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1361:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF1010:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1215:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1243:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1362:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF959:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1639:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1489:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF1226:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2096:
+	.string	"PIDPITCH"
+.LASF794:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1646:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1740:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF1119:
+	.string	"__DECL_SIMD_sinh "
+.LASF885:
+	.string	"__ssize_t_defined "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1387:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF1513:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2147:
+	.string	"baro_s"
+.LASF2150:
+	.string	"baro_t"
+.LASF1640:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1047:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1693:
+	.string	"USE_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF897:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1619:
+	.string	"USE_SERIALRX_CRSF "
+.LASF2153:
+	.string	"airplaneConfig_Registry"
+.LASF1477:
+	.string	"FP_NORMAL 4"
+.LASF1183:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1163:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1020:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1589:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1328:
+	.string	"__DECL_SIMD_log1pf"
+.LASF883:
+	.string	"__pid_t_defined "
+.LASF896:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1917:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1777:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1557:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF1239:
+	.string	"__DECL_SIMD_tan "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1224:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF812:
+	.string	"WNOWAIT 0x01000000"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1977:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2157:
+	.string	"altHoldThrottleAdjustment"
+.LASF1283:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1564:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF2057:
+	.string	"_Bool"
+.LASF978:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1673:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2179:
+	.string	"currentTimeUs"
+.LASF1389:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF941:
+	.string	"NFDBITS __NFDBITS"
+.LASF1187:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1641:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1115:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1343:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2095:
+	.string	"PIDROLL"
+.LASF1892:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1494:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1783:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1563:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1084:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1953:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1306:
+	.string	"__DECL_SIMD_sinh"
+.LASF1911:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1116:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1024:
+	.string	"__DECL_SIMD_expf64 "
+.LASF2048:
+	.string	"rcModeActivationMask"
+.LASF1647:
+	.string	"USE_SENSOR_NAMES "
+.LASF806:
+	.string	"_STDLIB_H 1"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1403:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1392:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1845:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1190:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF995:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1526:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF2102:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2133:
+	.string	"start_ut"
+.LASF1121:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1305:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1363:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1801:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF983:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1137:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1008:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1988:
+	.string	"uint16_t"
+.LASF908:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1301:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1873:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1390:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1630:
+	.string	"TELEMETRY_HOTT "
+.LASF1002:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1141:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1310:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1789:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1110:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1480:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF977:
+	.string	"_MATH_H 1"
+.LASF1674:
+	.string	"LED0_PIN NONE"
+.LASF1737:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1677:
+	.string	"ACC "
+.LASF1308:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1430:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF880:
+	.string	"__uid_t_defined "
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1104:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1841:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF991:
+	.string	"__DECL_SIMD_sinl "
+.LASF1536:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF1833:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1771:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1805:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1503:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2065:
+	.string	"GPS_HOLD_MODE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1818:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF879:
+	.string	"__nlink_t_defined "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1932:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF2075:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF2170:
+	.string	"previousTimeUs"
+.LASF785:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1012:
+	.string	"__DECL_SIMD_logf16 "
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1825:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1884:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1761:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1950:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2026:
+	.string	"BOXSONAR"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF2193:
+	.string	"airplaneConfig"
+.LASF2104:
+	.string	"PIDVEL"
+.LASF859:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1596:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1569:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF1068:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1443:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1011:
+	.string	"__DECL_SIMD_logl "
+.LASF1550:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1488:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1356:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1342:
+	.string	"__DECL_SIMD_tanh"
+.LASF1656:
+	.string	"_T_PTRDIFF_ "
+.LASF1248:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1578:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1921:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1782:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF1019:
+	.string	"__DECL_SIMD_exp "
+.LASF1723:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1229:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1354:
+	.string	"__DECL_SIMD_tan"
+.LASF1094:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1111:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF925:
+	.string	"_SYS_SELECT_H 1"
+.LASF1986:
+	.string	"int32_t"
+.LASF1548:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF837:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1398:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1560:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1542:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF936:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1931:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1757:
+	.string	"FAST_MATH "
+.LASF1679:
+	.string	"BARO "
+.LASF1478:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1269:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1570:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1330:
+	.string	"__DECL_SIMD_atanh"
+.LASF1203:
+	.string	"__DECL_SIMD_erff32 "
+.LASF871:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF933:
+	.string	"__timeval_defined 1"
+.LASF1021:
+	.string	"__DECL_SIMD_expl "
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1669:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1281:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1910:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF910:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1384:
+	.string	"FP_INT_UPWARD 0"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1274:
+	.string	"__DECL_SIMD_acos"
+.LASF2146:
+	.string	"barometerConfig_System"
+.LASF1268:
+	.string	"__DECL_SIMD_expf"
+.LASF2119:
+	.string	"levelSensitivity"
+.LASF1962:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF546:
+	.string	"__always_inline"
+.LASF1085:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF2195:
+	.string	"applyMultirotorAltHold"
+.LASF1846:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1204:
+	.string	"__DECL_SIMD_erff64 "
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2088:
+	.string	"accVelScale"
+.LASF1118:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1117:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1382:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF2092:
+	.string	"values"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2159:
+	.string	"initialThrottleHold"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1838:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1405:
+	.string	"__MATH_PRECNAME"
+.LASF1154:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF822:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1294:
+	.string	"__DECL_SIMD_exp10"
+.LASF1492:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1318:
+	.string	"__DECL_SIMD_log10"
+.LASF1997:
+	.string	"PGR_SIZE_MASK"
+.LASF866:
+	.string	"RAND_MAX 2147483647"
+.LASF1415:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1302:
+	.string	"__DECL_SIMD_expm1"
+.LASF1465:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1086:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1287:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1720:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1326:
+	.string	"__DECL_SIMD_log1p"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1123:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1993:
+	.string	"double"
+.LASF1375:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1715:
+	.string	"VTX_COMMON"
+.LASF1254:
+	.string	"__DECL_SIMD_sin"
+.LASF920:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1313:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1643:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF912:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF921:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF996:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1191:
+	.string	"__DECL_SIMD_acoshl "
+.LASF929:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1642:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1446:
+	.string	"_Mret_ _Float32"
+.LASF1941:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF1925:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1426:
+	.string	"__MATHDECL_1"
+.LASF1327:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1894:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2103:
+	.string	"PIDMAG"
+.LASF1311:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF1706:
+	.string	"TELEMETRY_HOTT"
+.LASF1748:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1869:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF823:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1200:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF1345:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF847:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1609:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF2007:
+	.string	"BOXHORIZON"
+.LASF1143:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2060:
+	.string	"ANGLE_MODE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1927:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1793:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2113:
+	.string	"pidSumLimit"
+.LASF1324:
+	.string	"__DECL_SIMD_log2f"
+.LASF1172:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1909:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1079:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1097:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1790:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1813:
+	.string	"PG_PID_PROFILE 14"
+.LASF2108:
+	.string	"dterm_lpf_hz"
+.LASF1435:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1400:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF820:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2098:
+	.string	"PIDALT"
+.LASF1208:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2020:
+	.string	"BOXLLIGHTS"
+.LASF839:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1709:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1519:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF1544:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1944:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1830:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2008:
+	.string	"BOXBARO"
+.LASF1292:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1553:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1547:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF2023:
+	.string	"BOXOSD"
+.LASF1253:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2100:
+	.string	"PIDPOSR"
+.LASF1812:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF2071:
+	.string	"flightModeFlags_e"
+.LASF1638:
+	.string	"TELEMETRY_IBUS "
+.LASF1617:
+	.string	"USE_PWM "
+.LASF874:
+	.string	"__ino_t_defined "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF907:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF787:
+	.string	"_WCHAR_T "
+.LASF1180:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1026:
+	.string	"__DECL_SIMD_expf32x "
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1347:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1912:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF2176:
+	.string	"accZ_old"
+.LASF1828:
+	.string	"PG_GPS_CONFIG 30"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1038:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1236:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF900:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1975:
+	.string	"long unsigned int"
+.LASF974:
+	.string	"alloca"
+.LASF869:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1787:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1586:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2090:
+	.string	"roll"
+.LASF1662:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1795:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1581:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1928:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1978:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2111:
+	.string	"dterm_notch_cutoff"
+.LASF2163:
+	.string	"baroCalculateAltitude"
+.LASF1980:
+	.string	"__uint16_t"
+.LASF862:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1896:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF957:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF402:
+	.string	"false 0"
+.LASF1105:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1736:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1072:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1733:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2009:
+	.string	"BOXMAG"
+.LASF364:
+	.string	"__k8 1"
+.LASF1765:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF797:
+	.string	"__INT_WCHAR_T_H "
+.LASF1150:
+	.string	"__DECL_SIMD_log10f "
+.LASF1013:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1486:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1075:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1499:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF926:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF1044:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1460:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF942:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1106:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1312:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF833:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1214:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1755:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1007:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1035:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1076:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF878:
+	.string	"__mode_t_defined "
+.LASF1945:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1344:
+	.string	"__DECL_SIMD_tanhf"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF922:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF858:
+	.string	"__f32x(x) x ##f32x"
+.LASF1425:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1386:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1506:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1431:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1467:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1874:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF2061:
+	.string	"HORIZON_MODE"
+.LASF1972:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1456:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF877:
+	.string	"__gid_t_defined "
+.LASF1438:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1167:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1367:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1880:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1527:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1349:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1663:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2192:
+	.string	"barometerConfig"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF1901:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1831:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1982:
+	.string	"__uint32_t"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1891:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1992:
+	.string	"float"
+.LASF1576:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1809:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1990:
+	.string	"long long int"
+.LASF1785:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF2005:
+	.string	"BOXARM"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF796:
+	.string	"___int_wchar_t_h "
+.LASF2070:
+	.string	"FAILSAFE_MODE"
+.LASF1428:
+	.string	"__MATHDECL"
+.LASF2118:
+	.string	"levelAngleLimit"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1864:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1201:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1961:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1694:
+	.string	"USE_PWM"
+.LASF1537:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF960:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1062:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1655:
+	.string	"_PTRDIFF_T "
+.LASF2021:
+	.string	"BOXCALIB"
+.LASF2050:
+	.string	"pgRegistry_s"
+.LASF2004:
+	.string	"pgRegistry_t"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF905:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1251:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF1095:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1329:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1158:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1751:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1127:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2017:
+	.string	"BOXBEEPERON"
+.LASF923:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF962:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1535:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF1999:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF545:
+	.string	"__wur "
+.LASF1627:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1280:
+	.string	"__DECL_SIMD_atanf"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2040:
+	.string	"AUX1"
+.LASF2041:
+	.string	"AUX2"
+.LASF1052:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2043:
+	.string	"AUX4"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2045:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2047:
+	.string	"AUX8"
+.LASF798:
+	.string	"_GCC_WCHAR_T "
+.LASF1816:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF2197:
+	.string	"high"
+.LASF1412:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1462:
+	.string	"_Mret_ _Float64x"
+.LASF888:
+	.string	"__clock_t_defined 1"
+.LASF2037:
+	.string	"ROLL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF793:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1680:
+	.string	"USE_FAKE_BARO "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1625:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1943:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1561:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF1074:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1799:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF2164:
+	.string	"isBaroCalibrationComplete"
+.LASF1899:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF935:
+	.string	"__NFDBITS"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF2053:
+	.string	"yaw_deadband"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1100:
+	.string	"__DECL_SIMD_coshf "
+.LASF825:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1181:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF382:
+	.string	"unix 1"
+.LASF1580:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF1173:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1523:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1232:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1078:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF891:
+	.string	"__timer_t_defined 1"
+.LASF1422:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1995:
+	.string	"PGR_PGN_MASK"
+.LASF2027:
+	.string	"BOXSERVO1"
+.LASF2028:
+	.string	"BOXSERVO2"
+.LASF2029:
+	.string	"BOXSERVO3"
+.LASF848:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1399:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1402:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF1132:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1528:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF931:
+	.string	"____sigset_t_defined "
+.LASF1667:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF895:
+	.string	"_ENDIAN_H 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1959:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1170:
+	.string	"__DECL_SIMD_log1pf "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF988:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1614:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF1151:
+	.string	"__DECL_SIMD_log10l "
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1604:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1913:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1525:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1970:
+	.string	"BARO_UPDATE_FREQUENCY_40HZ (1000 * 25)"
+.LASF2128:
+	.string	"baroOpFuncPtr"
+.LASF1871:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1028:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1886:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1352:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1729:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF2097:
+	.string	"PIDYAW"
+.LASF850:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF979:
+	.string	"__DECL_SIMD_cos "
+.LASF1393:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF2169:
+	.string	"altitudeHoldGetEstimatedAltitude"
+.LASF1484:
+	.string	"MATH_ERRNO 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1583:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF976:
+	.string	"__COMPAR_FN_T "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF2178:
+	.string	"lastBaroAlt"
+.LASF1244:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF963:
+	.string	"__ONCE_ALIGNMENT "
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1138:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1948:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1157:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1060:
+	.string	"__DECL_SIMD_asinf "
+.LASF816:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF2001:
+	.string	"size"
+.LASF1616:
+	.string	"USE_PPM "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF946:
+	.string	"__blksize_t_defined "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF894:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1856:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF2063:
+	.string	"BARO_MODE"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1098:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF917:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1432:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1668:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1252:
+	.string	"__DECL_SIMD_cosf"
+.LASF1416:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1298:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1027:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1184:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1297:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF980:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2069:
+	.string	"SONAR_MODE"
+.LASF845:
+	.string	"__HAVE_FLOAT64 1"
+.LASF939:
+	.string	"__FDS_BITS(set) ((set)->fds_bits)"
+.LASF1837:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1505:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1956:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF2181:
+	.string	"error"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF906:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF2062:
+	.string	"MAG_MODE"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1987:
+	.string	"uint8_t"
+.LASF1588:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF1210:
+	.string	"__DECL_SIMD_tanhf "
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1368:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1756:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1969:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF1406:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF964:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1628:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF1045:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1549:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1333:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1351:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1032:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1237:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1199:
+	.string	"__DECL_SIMD_erf "
+.LASF2038:
+	.string	"PITCH"
+.LASF1758:
+	.string	"VERY_FAST_MATH "
+.LASF1458:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF876:
+	.string	"__dev_t_defined "
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1958:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF2191:
+	.string	"initialPidProfile"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2024:
+	.string	"BOXTELEMETRY"
+.LASF1247:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1707:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF827:
+	.string	"__WCOREFLAG 0x80"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1509:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF1046:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF763:
+	.string	"__need_size_t "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1464:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1099:
+	.string	"__DECL_SIMD_cosh "
+.LASF1466:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF989:
+	.string	"__DECL_SIMD_sin "
+.LASF965:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1708:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF889:
+	.string	"__clockid_t_defined 1"
+.LASF801:
+	.string	"_BSD_WCHAR_T_"
+.LASF1541:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF1257:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1185:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1350:
+	.string	"__DECL_SIMD_erfc"
+.LASF1147:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2184:
+	.string	"isThrustFacingDownwards"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF841:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1543:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF2148:
+	.string	"BaroAlt"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF1893:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1273:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1923:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF2190:
+	.string	"configureAltitudeHold"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1355:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF1946:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1670:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1665:
+	.string	"__need_ptrdiff_t"
+.LASF909:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF1063:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1360:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1608:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2200:
+	.string	"applyFixedWingAltHold"
+.LASF1101:
+	.string	"__DECL_SIMD_coshl "
+.LASF1770:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1407:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1420:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1834:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1652:
+	.string	"_STDDEF_H "
+.LASF1186:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2127:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1955:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1922:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF985:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1082:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1861:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF2149:
+	.string	"baroTemperature"
+.LASF1592:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF1017:
+	.string	"__DECL_SIMD_logf64x "
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1929:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1859:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1409:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1824:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1735:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF830:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1788:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1714:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2136:
+	.string	"get_up"
+.LASF1829:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1135:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2134:
+	.string	"get_ut"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF928:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1940:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF842:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1112:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1370:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF2129:
+	.string	"baroCalculateFuncPtr"
+.LASF898:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2035:
+	.string	"BOXBLACKBOXERASE"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1719:
+	.string	"BLACKBOX"
+.LASF1842:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1872:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1963:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF1704:
+	.string	"LED_STRIP"
+.LASF1136:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1317:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF840:
+	.string	"__f128(x) x ##f128"
+.LASF1192:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF948:
+	.string	"__fsblkcnt_t_defined "
+.LASF992:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF2189:
+	.string	"calculateEstimatedAltitude"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF904:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1259:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2152:
+	.string	"pgResetTemplate_airplaneConfig"
+.LASF2112:
+	.string	"itermWindupPointPercent"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1700:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1780:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1233:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1701:
+	.string	"USE_SERIALRX_SUMH"
+.LASF949:
+	.string	"__fsfilcnt_t_defined "
+.LASF807:
+	.string	"WNOHANG 1"
+.LASF1144:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1391:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1275:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF958:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1629:
+	.string	"TELEMETRY_FRSKY "
+.LASF1848:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1240:
+	.string	"__DECL_SIMD_tanf "
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1870:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1746:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1133:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1538:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF2002:
+	.string	"address"
+.LASF1769:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1418:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1533:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF1889:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1738:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1699:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1447:
+	.string	"_Marg_ _Float32x"
+.LASF981:
+	.string	"__DECL_SIMD_cosl "
+.LASF1365:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF2187:
+	.string	"applyAltHold"
+.LASF1371:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1394:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF809:
+	.string	"WSTOPPED 2"
+.LASF803:
+	.string	"NULL"
+.LASF1919:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2073:
+	.string	"GPS_FIX_HOME"
+.LASF972:
+	.string	"__have_pthread_attr_t 1"
+.LASF2091:
+	.string	"pitch"
+.LASF1766:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF810:
+	.string	"WEXITED 4"
+.LASF1469:
+	.string	"__MATHCALL_NARROW"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1786:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1726:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1373:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1595:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF499:
+	.string	"__PMT"
+.LASF1177:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF799:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF2125:
+	.string	"rateAccelLimit"
+.LASF1721:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2106:
+	.string	"pidProfile_s"
+.LASF2126:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1207:
+	.string	"__DECL_SIMD_erff64x "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF819:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2173:
+	.string	"vel_acc"
+.LASF1611:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1863:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1498:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2059:
+	.string	"rcControlsConfig_System"
+.LASF1160:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1546:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1423:
+	.string	"_Mdouble_ _Float64x"
+.LASF1005:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1556:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF1209:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2174:
+	.string	"vel_tmp"
+.LASF1916:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1620:
+	.string	"USE_SERIALRX_IBUS "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1998:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1476:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF838:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1806:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1322:
+	.string	"__DECL_SIMD_log2"
+.LASF881:
+	.string	"__off_t_defined "
+.LASF1574:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1555:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF1050:
+	.string	"__DECL_SIMD_atanf "
+.LASF1491:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF916:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1964:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF811:
+	.string	"WCONTINUED 8"
+.LASF1300:
+	.string	"__DECL_SIMD_coshf"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1551:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1774:
+	.string	"UNIT_TESTED "
+.LASF2083:
+	.string	"fixedwing_althold_reversed"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1814:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1149:
+	.string	"__DECL_SIMD_log10 "
+.LASF1731:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1058:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF791:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1264:
+	.string	"__DECL_SIMD_logf"
+.LASF1277:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF2168:
+	.string	"disableFlightMode"
+.LASF1057:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2198:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF890:
+	.string	"__time_t_defined 1"
+.LASF1898:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF854:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1800:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1784:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1607:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF1109:
+	.string	"__DECL_SIMD_expm1 "
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF892:
+	.string	"__useconds_t_defined "
+.LASF1419:
+	.string	"_Mdouble_ _Float128"
+.LASF1529:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF1876:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2115:
+	.string	"dterm_average_count"
+.LASF1228:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF2185:
+	.string	"updateSonarAltHoldState"
+.LASF2180:
+	.string	"result"
+.LASF1577:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF961:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1175:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1587:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF1320:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1626:
+	.string	"BLACKBOX "
+.LASF1622:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2154:
+	.string	"setVelocity"
+.LASF893:
+	.string	"__suseconds_t_defined "
+.LASF1593:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1508:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF951:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2116:
+	.string	"vbatPidCompensation"
+.LASF943:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1171:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1053:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF1009:
+	.string	"__DECL_SIMD_log "
+.LASF2074:
+	.string	"GPS_FIX"
+.LASF1003:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF927:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF805:
+	.string	"__need_NULL"
+.LASF1176:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2049:
+	.string	"rcCommand"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1572:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF1421:
+	.string	"_Mdouble_ _Float32x"
+.LASF1750:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1120:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1376:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1065:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1033:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1164:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1703:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1049:
+	.string	"__DECL_SIMD_atan "
+.LASF1904:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1730:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1427:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1450:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1636:
+	.string	"CMS "
+.LASF2003:
+	.string	"reset"
+.LASF1314:
+	.string	"__DECL_SIMD_atan2"
+.LASF1991:
+	.string	"long long unsigned int"
+.LASF1807:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1083:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1436:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2066:
+	.string	"HEADFREE_MODE"
+.LASF1066:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1441:
+	.string	"__MATHCALL_NAME"
+.LASF1822:
+	.string	"PG_RX_CONFIG 24"
+.LASF1169:
+	.string	"__DECL_SIMD_log1p "
+.LASF2033:
+	.string	"BOX3DDISABLESWITCH"
+.LASF2142:
+	.string	"baro_noise_lpf"
+.LASF1241:
+	.string	"__DECL_SIMD_tanl "
+.LASF1096:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1485:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1847:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1747:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2167:
+	.string	"enableFlightMode"
+.LASF1985:
+	.string	"int16_t"
+.LASF1844:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1539:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF1973:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1850:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1976:
+	.string	"signed char"
+.LASF855:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1778:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1014:
+	.string	"__DECL_SIMD_logf64 "
+.LASF997:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1113:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1632:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1471:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1633:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1672:
+	.string	"U_ID_1 1"
+.LASF1364:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1348:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1692:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF795:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1815:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1906:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF2080:
+	.string	"AltHold"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF919:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF911:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1854:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1749:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1193:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1754:
+	.string	"sq(x) ((x)*(x))"
+.LASF993:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1165:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1444:
+	.string	"_Mret_ double"
+.LASF1295:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1776:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1718:
+	.string	"VTX_TRAMP"
+.LASF971:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1279:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF857:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1374:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1566:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF1631:
+	.string	"TELEMETRY_LTM "
+.LASF1601:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1936:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF950:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2012:
+	.string	"BOXCAMSTAB"
+.LASF815:
+	.string	"__WCLONE 0x80000000"
+.LASF1161:
+	.string	"__DECL_SIMD_log2l "
+.LASF1933:
+	.string	"PWM_PULSE_MIN 750"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1890:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF945:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1823:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1262:
+	.string	"__DECL_SIMD_log"
+.LASF831:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1888:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1989:
+	.string	"uint32_t"
+.LASF846:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1278:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2032:
+	.string	"BOXAIRMODE"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1734:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1827:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1413:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1905:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1440:
+	.string	"_Marg_"
+.LASF786:
+	.string	"__WCHAR_T__ "
+.LASF1220:
+	.string	"__DECL_SIMD_asinhf "
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1332:
+	.string	"__DECL_SIMD_atanhf"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1222:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1654:
+	.string	"_ANSI_STDDEF_H "
+.LASF1810:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1877:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1567:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF1996:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1015:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1832:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1865:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2010:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1501:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1914:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1366:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1724:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1454:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF1453:
+	.string	"_Marg_ _Float128"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1006:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1410:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1195:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF856:
+	.string	"__f32(x) x ##f32"
+.LASF1887:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1926:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1752:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1781:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2121:
+	.string	"itermAcceleratorGain"
+.LASF975:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1475:
+	.string	"FP_ZERO 2"
+.LASF914:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF2137:
+	.string	"calculate"
+.LASF2141:
+	.string	"baro_sample_count"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1168:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF903:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1023:
+	.string	"__DECL_SIMD_expf32 "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1690:
+	.string	"USE_UART8 "
+.LASF1022:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1907:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1725:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1282:
+	.string	"__DECL_SIMD_asin"
+.LASF1852:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1166:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1635:
+	.string	"GPS "
+.LASF1957:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1303:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2084:
+	.string	"airplaneConfig_t"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2143:
+	.string	"baro_cf_vel"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF2078:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1388:
+	.string	"FP_INT_TONEAREST 4"
+.LASF1826:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1408:
+	.string	"_Mdouble_ float"
+.LASF1983:
+	.string	"long int"
+.LASF1895:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1286:
+	.string	"__DECL_SIMD_hypot"
+.LASF1819:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1256:
+	.string	"__DECL_SIMD_sinf"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1634:
+	.string	"USE_SERVOS "
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF509:
+	.string	"__P(args) args"
+.LASF2085:
+	.string	"airplaneConfig_System"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF1198:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2166:
+	.string	"applyDeadband"
+.LASF1174:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF955:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1319:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1637:
+	.string	"TELEMETRY_CRSF "
+.LASF1659:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1459:
+	.string	"_Mret_ _Float64"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2165:
+	.string	"lrintf"
+.LASF1658:
+	.string	"__PTRDIFF_T "
+.LASF934:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF868:
+	.string	"EXIT_SUCCESS 0"
+.LASF1126:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1395:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2089:
+	.string	"accSum"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1938:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF2156:
+	.string	"errorVelocityI"
+.LASF1711:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1401:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2086:
+	.string	"accTimeSum"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1559:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF2087:
+	.string	"accSumCount"
+.LASF1455:
+	.string	"_Mret_ _Float32x"
+.LASF1258:
+	.string	"__DECL_SIMD_sincos"
+.LASF1061:
+	.string	"__DECL_SIMD_asinl "
+.LASF1671:
+	.string	"U_ID_0 0"
+.LASF1331:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1341:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF860:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1504:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1159:
+	.string	"__DECL_SIMD_log2 "
+.LASF1377:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1666:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1178:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1590:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2015:
+	.string	"BOXGPSHOLD"
+.LASF861:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF937:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1817:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1188:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1762:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1862:
+	.string	"PG_PID_CONFIG 504"
+.LASF1219:
+	.string	"__DECL_SIMD_asinh "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1520:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF522:
+	.string	"__flexarr []"
+.LASF863:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1029:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1705:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1487:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1500:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2011:
+	.string	"BOXHEADADJ"
+.LASF2171:
+	.string	"dTime"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF932:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1796:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF788:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1585:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1579:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF998:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1554:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF2014:
+	.string	"BOXGPSHOME"
+.LASF2114:
+	.string	"pidSumLimitYaw"
+.LASF1474:
+	.string	"FP_INFINITE 1"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1843:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1612:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2123:
+	.string	"dtermSetpointWeight"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF2162:
+	.string	"performBaroCalibrationCycle"
+.LASF1682:
+	.string	"USE_FAKE_MAG "
+.LASF1404:
+	.string	"_Mdouble_"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2188:
+	.string	"isAltHoldChanged"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1272:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1285:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF956:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF2099:
+	.string	"PIDPOS"
+.LASF1155:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1722:
+	.string	"USE_DSHOT"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1217:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF800:
+	.string	"__DEFINED_wchar_t "
+.LASF849:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF832:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1325:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF2082:
+	.string	"airplaneConfig_s"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1152:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1697:
+	.string	"USE_SERIALRX_IBUS"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1069:
+	.string	"__DECL_SIMD_hypot "
+.LASF1378:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1908:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF808:
+	.string	"WUNTRACED 2"
+.LASF2030:
+	.string	"BOXBLACKBOX"
+.LASF1600:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1025:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1461:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF2144:
+	.string	"baro_cf_alt"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF984:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1156:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1048:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1881:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1383:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1702:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1645:
+	.string	"USE_RX_MSP "
+.LASF1712:
+	.string	"TELEMETRY_IBUS"
+.LASF401:
+	.string	"true 1"
+.LASF986:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1250:
+	.string	"__DECL_SIMD_cos"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1902:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1040:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF1949:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2175:
+	.string	"accZ_tmp"
+.LASF2110:
+	.string	"dterm_notch_hz"
+.LASF1223:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1288:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1939:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF844:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF1128:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1299:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1610:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1695:
+	.string	"SERIAL_RX"
+.LASF1744:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1463:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2107:
+	.string	"dterm_filter_type"
+.LASF2025:
+	.string	"BOXGTUNE"
+.LASF1516:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1235:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1064:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF804:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1835:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1196:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2064:
+	.string	"GPS_HOME_MODE"
+.LASF970:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1967:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1598:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1717:
+	.string	"VTX_SMARTAUDIO"
+.LASF1621:
+	.string	"USE_SERIALRX_SBUS "
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1772:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1321:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1698:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2155:
+	.string	"velocityControl"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF930:
+	.string	"__sigset_t_defined 1"
+.LASF1289:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1090:
+	.string	"__DECL_SIMD_exp10f "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1439:
+	.string	"_Mret_"
+.LASF1915:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2006:
+	.string	"BOXANGLE"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF2140:
+	.string	"baro_hardware"
+.LASF1483:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF802:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1145:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1657:
+	.string	"_T_PTRDIFF "
+.LASF1054:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1545:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF1246:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1189:
+	.string	"__DECL_SIMD_acosh "
+.LASF1353:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1245:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1952:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1584:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1678:
+	.string	"USE_FAKE_ACC "
+.LASF2139:
+	.string	"barometerConfig_s"
+.LASF2145:
+	.string	"barometerConfig_t"
+.LASF1522:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1470:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1602:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1381:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1473:
+	.string	"FP_NAN 0"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1263:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF852:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF884:
+	.string	"__id_t_defined "
+.LASF1146:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1102:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1497:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1291:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF968:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF824:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF2177:
+	.string	"accAlt"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1716:
+	.string	"VTX_CONTROL"
+.LASF967:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1336:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1510:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF886:
+	.string	"__daddr_t_defined "
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1234:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1315:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF814:
+	.string	"__WALL 0x40000000"
+.LASF2039:
+	.string	"THROTTLE"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF901:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1261:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF915:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF1385:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF1039:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1372:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1134:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1016:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1323:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF953:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2031:
+	.string	"BOXFAILSAFE"
+.LASF2131:
+	.string	"ut_delay"
+.LASF826:
+	.string	"__W_CONTINUED 0xffff"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1855:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1613:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1359:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1451:
+	.string	"_Marg_ _Float64x"
+.LASF1599:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1791:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1271:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1623:
+	.string	"USE_SERIALRX_SUMD "
+.LASF872:
+	.string	"_SYS_TYPES_H 1"
+.LASF1971:
+	.string	"DEGREES_80_IN_DECIDEGREES 800"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1042:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1875:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF918:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1139:
+	.string	"__DECL_SIMD_atan2 "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1552:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF899:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1276:
+	.string	"__DECL_SIMD_acosf"
+.LASF1334:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1779:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1676:
+	.string	"USE_FAKE_GYRO "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF902:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1794:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1212:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1803:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1216:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1797:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF792:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1087:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1502:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF865:
+	.string	"__lldiv_t_defined 1"
+.LASF2076:
+	.string	"SMALL_ANGLE"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1739:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2051:
+	.string	"rcControlsConfig_s"
+.LASF2058:
+	.string	"rcControlsConfig_t"
+.LASF1496:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2036:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1981:
+	.string	"__int32_t"
+.LASF1379:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1482:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1954:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2022:
+	.string	"BOXGOV"
+.LASF2054:
+	.string	"alt_hold_deadband"
+.LASF1764:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1093:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1227:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF821:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF875:
+	.string	"__ino64_t_defined "
+.LASF1433:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1124:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1820:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1768:
+	.string	"Q12 (1 << 12)"
+.LASF1597:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1615:
+	.string	"USE_CLI "
+.LASF1369:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF1340:
+	.string	"__DECL_SIMD_erff"
+.LASF2151:
+	.string	"baro"
+.LASF1357:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1644:
+	.string	"USE_MSP_PUSH "
+.LASF1041:
+	.string	"__DECL_SIMD_acosl "
+.LASF1448:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1849:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1605:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF1267:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF764:
+	.string	"__need_wchar_t "
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1293:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF2077:
+	.string	"FIXED_WING"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1337:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1396:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF947:
+	.string	"__blkcnt_t_defined "
+.LASF2130:
+	.string	"baroDev_s"
+.LASF1030:
+	.string	"__DECL_SIMD_powf "
+.LASF813:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF789:
+	.string	"_T_WCHAR "
+.LASF1036:
+	.string	"__DECL_SIMD_powf32x "
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1947:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1966:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1067:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1653:
+	.string	"_STDDEF_H_ "
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1059:
+	.string	"__DECL_SIMD_asin "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1249:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF2135:
+	.string	"start_up"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1429:
+	.string	"__MATHCALL"
+.LASF1153:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF2081:
+	.string	"vario"
+.LASF1221:
+	.string	"__DECL_SIMD_asinhl "
+.LASF882:
+	.string	"__off64_t_defined "
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1713:
+	.string	"USE_DASHBOARD"
+.LASF954:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF973:
+	.string	"_ALLOCA_H 1"
+.LASF1878:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1493:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1603:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1490:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF1206:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1649:
+	.string	"VTX_CONTROL "
+.LASF1179:
+	.string	"__DECL_SIMD_atanh "
+.LASF2042:
+	.string	"AUX3"
+.LASF2019:
+	.string	"BOXLEDLOW"
+.LASF1821:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2044:
+	.string	"AUX5"
+.LASF1380:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF2046:
+	.string	"AUX7"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1091:
+	.string	"__DECL_SIMD_exp10l "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2072:
+	.string	"flightModeFlags"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2122:
+	.string	"setpointRelaxRatio"
+.LASF1760:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2199:
+	.string	"rc_alias"
+.LASF1660:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF790:
+	.string	"__WCHAR_T "
+.LASF1284:
+	.string	"__DECL_SIMD_asinf"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1346:
+	.string	"__DECL_SIMD_asinh"
+.LASF1934:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF873:
+	.string	"__u_char_defined "
+.LASF2034:
+	.string	"BOXFPVANGLEMIX"
+.LASF1108:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1070:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1309:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1004:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF938:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1883:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1055:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1452:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF851:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1479:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF2079:
+	.string	"timeUs_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1515:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF2186:
+	.string	"updateAltHoldState"
+.LASF2138:
+	.string	"baroDev_t"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1148:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1960:
+	.string	"SONAR_GPIO GPIOB"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1034:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1920:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1518:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF1335:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1000:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1994:
+	.string	"pgn_t"
+.LASF1867:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF836:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1802:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1930:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF1056:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1937:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF2056:
+	.string	"yaw_control_reversed"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1681:
+	.string	"MAG "
+.LASF2182:
+	.string	"setVel"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF1080:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1984:
+	.string	"char"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1296:
+	.string	"__DECL_SIMD_exp10f"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1358:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF835:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1689:
+	.string	"USE_UART7 "
+.LASF2117:
+	.string	"pidAtMinThrottle"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1197:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2194:
+	.string	"rcControlsConfig"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1732:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1414:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1804:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF817:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1202:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1798:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1524:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1255:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF2160:
+	.string	"EstAlt"
+.LASF1763:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1107:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1114:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1530:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF1745:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1860:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1218:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1808:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1089:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1741:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF834:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1103:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1077:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1606:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF1194:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF994:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1753:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1242:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF944:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1591:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF1879:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2161:
+	.string	"imuResetAccelerationSum"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF853:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1882:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1968:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF1037:
+	.string	"__DECL_SIMD_powf64x "
+.LASF987:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1897:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1773:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1727:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1051:
+	.string	"__DECL_SIMD_atanl "
+.LASF1582:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF952:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1449:
+	.string	"_Marg_ _Float64"
+.LASF1230:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1437:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1661:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF2018:
+	.string	"BOXLEDMAX"
+.LASF1182:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1162:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1205:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1088:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1122:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1043:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1511:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1457:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1565:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF1965:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF913:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1130:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1307:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF1836:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1031:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF887:
+	.string	"__key_t_defined "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1442:
+	.string	"_Marg_ long double"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1951:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1540:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF1213:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF867:
+	.string	"EXIT_FAILURE 1"
+.LASF1942:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1575:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF1594:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF828:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1728:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1417:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1853:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1532:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1775:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2132:
+	.string	"up_delay"
+.LASF1767:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2094:
+	.string	"attitude"
+.LASF1424:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1618:
+	.string	"SERIAL_RX "
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1696:
+	.string	"USE_SERIALRX_CRSF"
+.LASF966:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1840:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1683:
+	.string	"USE_UART1 "
+.LASF818:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2101:
+	.string	"PIDNAVR"
+.LASF2158:
+	.string	"pidProfile"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1885:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF2055:
+	.string	"alt_hold_fast_change"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1445:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF1868:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1507:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1434:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1558:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1691:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF969:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1071:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF982:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1624:
+	.string	"USE_SERIALRX_SUMH "
+.LASF829:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2093:
+	.string	"attitudeEulerAngles_t"
+.LASF1411:
+	.string	"_Mdouble_ long double"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1684:
+	.string	"USE_UART2 "
+.LASF1648:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1651:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1650:
+	.string	"VTX_SMARTAUDIO "
+.LASF1742:
+	.string	"__disable_irq() "
+.LASF2105:
+	.string	"PID_ITEM_COUNT"
+.LASF1338:
+	.string	"__DECL_SIMD_erf"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1481:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1562:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2067:
+	.string	"UNUSED_MODE"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1001:
+	.string	"__DECL_SIMD_sincosl "
+.LASF870:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1514:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF1979:
+	.string	"short int"
+.LASF1568:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF1935:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1839:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2124:
+	.string	"yawRateAccelLimit"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1081:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1018:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1517:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1685:
+	.string	"USE_UART3 "
+.LASF1397:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF2172:
+	.string	"baroVel"
+.LASF2183:
+	.string	"calculateAltHoldThrottleAdjustment"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1512:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF2109:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1316:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1270:
+	.string	"__DECL_SIMD_pow"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1851:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF2000:
+	.string	"pgResetFunc"
+.LASF1858:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1759:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF1571:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF1468:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1743:
+	.string	"__enable_irq() "
+.LASF1974:
+	.string	"unsigned int"
+.LASF1686:
+	.string	"USE_UART4 "
+.LASF1073:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF924:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1238:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1472:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1903:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1140:
+	.string	"__DECL_SIMD_atan2f "
+.LASF999:
+	.string	"__DECL_SIMD_sincos "
+.LASF1918:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1211:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2016:
+	.string	"BOXPASSTHRU"
+.LASF1266:
+	.string	"__DECL_SIMD_exp"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1866:
+	.string	"PG_PWM_CONFIG 508"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1521:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF1531:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF1092:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2052:
+	.string	"deadband"
+.LASF990:
+	.string	"__DECL_SIMD_sinf "
+.LASF1265:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF1142:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2120:
+	.string	"itermThrottleThreshold"
+.LASF1534:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF2013:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1687:
+	.string	"USE_UART5 "
+.LASF1811:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1304:
+	.string	"__DECL_SIMD_expm1f"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF2068:
+	.string	"PASSTHRU_MODE"
+.LASF940:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1710:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1231:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1857:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1924:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1260:
+	.string	"__DECL_SIMD_sincosf"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF843:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2196:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1664:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1792:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1495:
+	.string	"M_E 2.7182818284590452354"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1290:
+	.string	"__DECL_SIMD_exp2"
+.LASF1225:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1675:
+	.string	"GYRO "
+.LASF1573:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1688:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1131:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2270:
+	.string	"thread-shared-types.h"
+.LASF2214:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2280:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2216:
+	.string	"/usr/include"
+.LASF2284:
+	.string	"mathcalls-helper-functions.h"
+.LASF2253:
+	.string	"floatn-common.h"
+.LASF2235:
+	.string	"stdint.h"
+.LASF2201:
+	.string	"src/main/build"
+.LASF2213:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2229:
+	.string	"barometer.h"
+.LASF2234:
+	.string	"stdbool.h"
+.LASF2286:
+	.string	"iscanonical.h"
+.LASF2224:
+	.string	"time.h"
+.LASF2264:
+	.string	"select.h"
+.LASF2209:
+	.string	"src/main/target/SITL"
+.LASF0:
+	.string	"./src/main/flight/altitudehold.c"
+.LASF2269:
+	.string	"pthreadtypes.h"
+.LASF2290:
+	.string	"common_post.h"
+.LASF2212:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2236:
+	.string	"libc-header-start.h"
+.LASF2259:
+	.string	"timer_t.h"
+.LASF2207:
+	.string	"src/main/rx"
+.LASF2287:
+	.string	"platform.h"
+.LASF2217:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2303:
+	.string	"voltage_ids.h"
+.LASF2206:
+	.string	"src/main/flight"
+.LASF2226:
+	.string	"imu.h"
+.LASF2291:
+	.string	"debug.h"
+.LASF2233:
+	.string	"stdc-predef.h"
+.LASF2278:
+	.string	"math.h"
+.LASF2260:
+	.string	"endian.h"
+.LASF2299:
+	.string	"filter.h"
+.LASF2237:
+	.string	"features.h"
+.LASF2211:
+	.string	"src/main"
+.LASF2230:
+	.string	"altitudehold.c"
+.LASF2295:
+	.string	"sonar.h"
+.LASF2239:
+	.string	"wordsize.h"
+.LASF2225:
+	.string	"altitudehold.h"
+.LASF2238:
+	.string	"features-time64.h"
+.LASF2274:
+	.string	"struct_rwlock.h"
+.LASF2223:
+	.string	"runtime_config.h"
+.LASF2282:
+	.string	"fp-logb.h"
+.LASF2246:
+	.string	"time64.h"
+.LASF2250:
+	.string	"waitflags.h"
+.LASF2289:
+	.string	"target.h"
+.LASF2244:
+	.string	"stubs-64.h"
+.LASF2232:
+	.string	"maths.h"
+.LASF2251:
+	.string	"waitstatus.h"
+.LASF2294:
+	.string	"parameter_group_ids.h"
+.LASF2247:
+	.string	"wchar.h"
+.LASF2240:
+	.string	"timesize.h"
+.LASF2202:
+	.string	"src/main/common"
+.LASF2302:
+	.string	"voltage.h"
+.LASF2228:
+	.string	"rx.h"
+.LASF2300:
+	.string	"current.h"
+.LASF2215:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2262:
+	.string	"byteswap.h"
+.LASF2258:
+	.string	"time_t.h"
+.LASF2249:
+	.string	"stddef.h"
+.LASF2283:
+	.string	"fp-fast.h"
+.LASF2205:
+	.string	"src/main/fc"
+.LASF2252:
+	.string	"floatn.h"
+.LASF2288:
+	.string	"common.h"
+.LASF2272:
+	.string	"atomic_wide_counter.h"
+.LASF2243:
+	.string	"stubs.h"
+.LASF2221:
+	.string	"parameter_group.h"
+.LASF2227:
+	.string	"pid.h"
+.LASF2301:
+	.string	"current_ids.h"
+.LASF2263:
+	.string	"uintn-identity.h"
+.LASF2257:
+	.string	"clockid_t.h"
+.LASF2279:
+	.string	"math-vector.h"
+.LASF2261:
+	.string	"endianness.h"
+.LASF2220:
+	.string	"stdint-uintn.h"
+.LASF2256:
+	.string	"clock_t.h"
+.LASF2242:
+	.string	"long-double.h"
+.LASF2222:
+	.string	"rc_controls.h"
+.LASF2298:
+	.string	"battery.h"
+.LASF2241:
+	.string	"cdefs.h"
+.LASF2281:
+	.string	"flt-eval-method.h"
+.LASF2231:
+	.string	"mathcalls.h"
+.LASF2245:
+	.string	"typesizes.h"
+.LASF2203:
+	.string	"src/main/config"
+.LASF2296:
+	.string	"sonar_hcsr04.h"
+.LASF2254:
+	.string	"locale_t.h"
+.LASF2210:
+	.string	"src/main/target"
+.LASF2292:
+	.string	"axis.h"
+.LASF2204:
+	.string	"src/main/drivers"
+.LASF2265:
+	.string	"sigset_t.h"
+.LASF2277:
+	.string	"stdlib-float.h"
+.LASF2248:
+	.string	"stdlib.h"
+.LASF2268:
+	.string	"struct_timespec.h"
+.LASF2293:
+	.string	"build_config.h"
+.LASF2267:
+	.string	"struct_timeval.h"
+.LASF2208:
+	.string	"src/main/sensors"
+.LASF2219:
+	.string	"stdint-intn.h"
+.LASF2275:
+	.string	"alloca.h"
+.LASF2285:
+	.string	"mathcalls-narrow.h"
+.LASF2255:
+	.string	"__locale_t.h"
+.LASF2218:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2273:
+	.string	"struct_mutex.h"
+.LASF2276:
+	.string	"stdlib-bsearch.h"
+.LASF2271:
+	.string	"pthreadtypes-arch.h"
+.LASF2297:
+	.string	"io_types.h"
+.LASF2266:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`D\001\305\t"
+	.string	"\364\0138\002"
+	.string	"\037"
+	.string	"\265\352\252\344\0136\002"
+	.string	"\002\001\002\002\002\003\002\004\002\004\002"
+	.string	"\002"
+	.string	"\002\002\002\005\004"
+	.string	"\003\240\342\234\212\n\004\352\263\360\321\b\005\007\b\t\n\013\f\373\357\365\304\002\b\002\006\002\007\005\r\016\311\206\336\253\017"
+	.string	"\017\373\214\333\301\001"
+	.string	"\020\314\366\206\363\b\030\b\002\b\002"
+	.string	"\002\t"
+	.string	"\002\t\021\022\226\266\306,\002\023\336\350\245\242\005\002\025\310\370\242\344\005\020\002\n\002\n\002\013\002\013\004\002\004\030\271\231\276\332\013\031\240\377\365\343\006\004\002\f\032\322\316\223\302\002\004\002\r\034\242\357\276\260\0174\016\004\002\017\020\021\016\035\036\037&'()\354\206\342\366\006\002*\355\314\246\334\007+\203\265\311\246\017"
+	.ascii	"; \240\2021\263y\366\260\255w\1775V\004w\241\215\021E\310LH2"
+	.ascii	"(X0\300a5\202\231\200B\200yh\034b[.\374v\354|G\036Zxm\306\361"
+	.ascii	"\311\341\250\347n\301\236\017\270\212V\305\266\017V\322T\321"
+	.ascii	"\202\341\203\373\200W\301\214qL\376\305\272\346>\026\233T\345"
+	.ascii	"\262cu\023\222\370s\230\2572'aw\2123l\013\366\207s\341\026\370"
+	.ascii	"\342\027!a\025w\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375 \231\265\002"
+	.string	"\242\204\f\024\240E\303\001\377\377\377\377`\301\316\314\261I\266\031\023)S\nN\200\356\213T\353\333\312\002]Z\032\035\351d\221=\326\370\243SW\020\273\303\232U0\020\016"
+	.string	"/\001r\004\364L\357\322p\177V\204\215*K\301:\224u@mcY\361\247\266(\366o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\003\002\315\n"
+	.string	"\246\320850\217\222\016E\355\0262\033\2718\231\241L\367\226\220\006G;\310"
+	.string	"\336\303\300\f\263\316\214\335T\fm:\344\305\302\300`j\274\025\372\277{\003)C\255\021\"w\n&"
+	.string	"("
+	.string	"-"
+	.string	"\370_:\221\231\247w\034\231y\255!e\244\2462\3632\346\216\232\231\211}\251\037\231i\352c\251\253\314L\370\314m\005\017"
+	.string	"\001sDm\037G\356\275\371C[\346\375c\026\365\204\275\251\027!-\222\005\327\237S\304\356LU\241\250\240\020\316\006>\370\347\221\263\334\317u@\354\314\275)f(\202Z%\356\224\001w\330\006*`Z#\276F\322\345\002\002\214\025*\303\263R\301biw\0040\037\240s,\r\223\022\264\200\350\346\261u|\262\347\320\346~\315u\322\372\256T\220\024\325\310f\203\007\372\211\\*\223\302r\037\350\276\206\0060 P\002a\b\203\335\332!\345\360pX\302\325\267p\3121\233\361.\261\341\325\0052\215\271\220!\211\335\345\327\202\224\"<\030;\212\270\303\314\271\356\244i&\006\253-\205\300\004J\\EpV\242\354\f8\0014\360\332\256a\362\206\247\310\354\211\3036\300\n\303(\304~\230\335\301\343q\306\2751\226D\r\214w\363"
+	.ascii	"\r\027\237#sN\034\333\201S{\032\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\345\005"
+	.string	"b\310\033$\220)\351\3770\264\003\242\001\317\357\364g\345m\335\331\254\337?D\373@\250\376\r\200\377\rmS\244m\262e\n\377\242\226^"
+	.string	"\003\231\364\232\346%).1\361\023\027\273\262kte$\240[\265\210+\322\245\364\300"
+	.string	"\227\2525\374<*\023\221\364\313\272f\261=\262Kv\031]6\332\252\002N8\021\276\330\234b\353N\037\353\356\007\017\375\202\353\b\037"
+	.string	"\270"
+	.ascii	"Tc%%\020\\\314(\212\034\356h6\006\202\314\214\303\334\020\240"
+	.ascii	"(#\033\315\300X\316j\302\345\303T\036\341\342\220\001\314\275"
+	.ascii	"\271XF\233\017\343\3728\256\250\270\240\216\301\3546e\375@\311"
+	.ascii	"\312y\030g\303\334tN\003C"
+	.text
+	.section	.gnu.lto_.pureconst.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\230\004\f\230\004\016\230\004\017\230\004\020\231\004\022\230"
+	.ascii	"\004\023\230\004\025\230\004\030\230\004\031\205\004\032\230"
+	.ascii	"\004\034\230\004)\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"e\005"
+	.ascii	"b\210\027\035\2209\303\001\320\377\177\325\377\377\377\377\363"
+	.ascii	"\312\f\301\267\366S\223\201\345~\261\265\2765\231Rj\303\2041"
+	.ascii	"_l\025\363f\333$\346\324\226\362g\373, \031Q\214.b\200\307\320"
+	.ascii	"\343\332a\332Nsi+-)\2506\202\355RU*\245\022a\b\016\\_[\303\334"
+	.ascii	"\331:\363h\013\rY\026w\004! \220\202\031\302\3639\031\220\025"
+	.ascii	"`\031E\233@a\313\035\204\204K^\223\317\212\272\204\033\311\b"
+	.ascii	"\353b)l\031\007\023\b\210;\007\345X\241e\371\342\321*\214|8\224"
+	.ascii	"\337\3020\002n\003\344\200K\356\003[|#\370\253\321B+\270\033"
+	.text
+	.section	.gnu.lto_.lto.6cb24e0035b0842,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_airplaneConfig_Registry.60.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375 \212%\004"
+	.string	"d\007O"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\303\257\314\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\355\005us"
+	.string	"\005\001\006'\001\001\035(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/flight/altitudehold.c"
+	.string	"\004"
+	.ascii	"K\205\220r\025D5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_airplaneConfig.62.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"?\202\210\200\b}{\273\001"
+	.text
+	.section	.gnu.lto_configureAltitudeHold.70.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\r\t"
+	.string	"\226\221A90\221\322\001\200@\247\201N\0246X,\233\030\177p\370\240\242\260\361Z\327\237\265\330\2260\202K>\006\263\325\276;\207W\262F\240G\315W\031\223\206Swh\333\301m\367N)."
+	.string	"0"
+	.string	"1"
+	.string	"\377l\237\234\017l\237\006m\031\320\205@\rCefw\251\0049\370\b\372?y"
+	.string	",\346z\004`\330]GXL\343\226\267m`\373\301v\030\233\335]K\231\375\331\0377\033\007\f\210e7\243V\263\264\3512b\373\035\373C\322\360h\277\344&\340g\255{ve/-\273\341\201\0218\237\016\003\364\353:\217v\302\375f\245\314\016\035\264\227\264p\224>\312SZ\276\210+X\361\260O\237\265}\022\204x\274b\315qe#f#\215\035\272\242\374\260\037.\211L\t\013\n%Q\b\204\342j\252\363F\247:\342H\365\253\253\352\261)t\342:\025\352D\361\325\217#\321O\005Q\271\024]UR\0045y\0234T\340N\002\345\005\b"
+	.ascii	"AQ\022eX\023\337\342\301-\030\027\\\276\325\350p\207\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_applyMultirotorAltHold.73.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\004\n\265,"
+	.string	"*I\344\017Fp\334Q:\177\023D4\023H\177\001\361\033\322W\224Q\235\275%\031\276\277\233\026\346\212\377{j-\f4i\276\323\360\203\310Y\"\242\223\314]\020\331\036\317\370\371\234\334p\260\0064\334\007j\325o\3777\262\211LR\006\361"
+	.string	"\305"
+	.string	"\361"
+	.ascii	"h\214\346\322T\306\\\236\364L\325\"\244\317\273l\205\nWa5\036"
+	.ascii	"\2212M\346*w,\224\273f\017\2617\226\262\202\225,?a(\034E\027"
+	.ascii	"\007\216\\\223\251\243\311\354b\225\206\366\225\206v\304\270"
+	.ascii	"\343\272\273ZC\256\263t\371 \354MI\001\256D]\031~v\262\314\204"
+	.ascii	"\233\254\340\263\345r\236\245K\376\332\021\347\213\001\256{`"
+	.ascii	"\307u\310C(\327\223\203P\256\313KV\354\372\270\336\267Z\273n"
+	.ascii	"|F\226\352z\210uA\221K\323\224\330?X\213\203@\237\237\257\307"
+	.ascii	"\333\351\320z\366\265\226u\021x^K\026\034\004\372\210\351\370"
+	.ascii	"O\214}9\230\212(q\274\307c\342\361\025\306\273\260sXD\tv\235"
+	.ascii	".\002\217\257\035\214\366\2265\270&[\374\004.\273|K\256\367\232"
+	.ascii	"\362\3069L\323\224\315\370/\226[\277.B\232"
+	.string	"\246{\257\345\027\357\017\357\256\334\356\226\330\345)\003e\333\301\203\207\346+l`\357n\356\332\203\374\334\023{)\356\3224m\260\314\205\273L\205\240\242B\271\276\231\tD\313\217\t\346i\232\262\350\035\201r\177@k\343\372\235\335\255b-#vi\312\265`\031\013g\271Z.\343\272G\023g/\023(W\356$6&\310\317-\272\345\314,k\351\361\354\236m\275\307v\371L\333\307\356\277\f\376%\360\257S\375\016\370\267\351_\001\3772\235\337\341\277K\377*\375\233\364/\322\277\001\316\357\321\277F\377\026\375+\254_\242\177\207\352W\250~\203\376\005\372\027\300\277?\3477X\277@\364\353\203~\177\350\327W\277\275\177y\347w\367\257\356_\364\337Z\277\347\277]\277?\277\354@\227$\275O\322\221c\240N\352\007d^\222ql\205{S\226j\314+k\222\206\210\234 \226*:7\274\\P\246\002\324<\205\207\310\343Y"
+	.string	"]\033\210N\024\005)"
+	.string	"\355\204\207\327cn\034\347D\026W\347\247\341\242*H\275EY\220\372i$!\346\234\035C\241\301f\036hmp\202-\304\006&G\327c\373\223\327\020\332*\203v\352\027\273\300~S\024\222\265\261\027\234O\003\177\355k\237\346\244\230S\377\372T\353\332\323k\237\0336\334\346\002\206\f\031P\256\275\026\236h\2171hN\302!?\267gi\232\326\036\333\263\337\301$@\246\031f(ty\215\323@\251\320\240\001\345\272D\246"
+	.ascii	"/\233\3413Q\033\244\244P\256Jdq@\246\030>{ly\255k,\2642\273\346"
+	.ascii	"q`2cv\3756\255k\2449I\271\332\335hsr\310\326\347\366\354\312"
+	.ascii	"`8Lq9F\252*\343\231\342h\325\373\001\301T\202\006\n> x*Z\343"
+	.ascii	"\323\tcV\361\212H\342xuu\234:\312\272*\366N=\201\260:\032C\200"
+	.ascii	"@\221U\225eU$f\031\251\252\254D\020IT\025\257\210SX'\210OL{,"
+	.ascii	"\021\002\213\230u<b\021}gHn\037[\301\354\f\262\267\202\003\036"
+	.ascii	"V\034:\030R\017\350\206\323Ls\302\313c6\204@#55\001)Q\270\311"
+	.ascii	"CNkjv\"\240\205\335\364\032\002z\211\r\f\t\320\215\206\021\267"
+	.ascii	"/\"LW>\206\005\246&j\356\360\0316\0079\214a\023\001\021\352\322"
+	.ascii	"\361Ss\257&\216\265T\315]@I\320\240\344&\016\031\266\266\324"
+	.ascii	"\313f\236\214\232 \325j^pE\275\324Ek\222I\266\2326|\001\332\350"
+	.ascii	"\250\003|\353\310\243\2426\022\366P\027\021\265\360)\221P\017"
+	.ascii	"\355\321#\324\234\321\013\302S\024\222\335Q\352\240]\236\302"
+	.ascii	"l\306\2752$X\354\274!\353pR+\005\200\350\250\201D)\025\032!\221"
+	.ascii	"\222\244\240$i\f\360\002\021\031\"z\021 )\204L\325L,\303\030"
+	.ascii	"\344\321i\322Q\003\367\013\2720$\302x\260\032C\246U#MB\003\031"
+	.ascii	"\361\324\222\342\022\354\350JsI\232g\245k\204\260v\002w#\252"
+	.ascii	"\334 R\327\273\361{\344{vc\241=\346\347\374u\211\2108\004\212"
+	.ascii	"\r>\026mD$\206\221DV\240\223\026M\233\340\264,\267\336\227\237"
+	.ascii	"t\343(4;\221\204\302eb\340\234\330\215rz\250\340\035I\026\032"
+	.ascii	"V\371\211\f\247\021eh\275\214\254\247\330U\322\006DG\241\275"
+	.ascii	"\344O\020$\261p8\207\276\035\234\003Hg)\364f\024\322I\005\214"
+	.ascii	"\331t\300Tf\035tW\237,\n=]\344C\323}_\027,7RUp\271i\301!\261"
+	.ascii	"hJ\210\355o`\270\357 K0E\264\321`\340\030{!)\374\366\031\034"
+	.ascii	",6V\b\320\363\240f\001\263\260\303\314\211\003B\354\367\024`"
+	.ascii	"-\272\251z>S>\275\333\336\376\321\372\342\224\323U8\bdaof!d\033"
+	.ascii	"\213\375j\276\320\240S\305 \374nz\007\373;lr\322\311y\004\254"
+	.ascii	"\357b\267\212\340\355&\276\f\201\262B\206.S\234\354\266g\016"
+	.ascii	"\341\277u\203\016\315\036\246<\370bm\300\3278b'\325\333\203o"
+	.ascii	"\340\355\355\244\246\231\317t\273\217}\271\3135\331\001yx,|\344"
+	.ascii	"\246\002\254\236\247\035\366\271\035/\"\277\031T\263\342\220"
+	.ascii	"1>O\356\313g\246PMt\006\334\225\221\330\324\005\273e\331\340"
+	.ascii	"\220c\222\377"
+	.text
+	.section	.gnu.lto_applyAltHold.75.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\255\n"
+	.string	"\366\323I@0k\225\016\303\240\304D\216\365;\236\345:%88]\022\336\316NCx@\201\325\321\303\237\037\021A\204e\030\222\353\243s\3773X\325\250QP\241r\001*\375p\323\030\320\227\376\204\020\262eJ\0016"
+	.string	"4"
+	.string	"7"
+	.string	";\245\202\177\3272\251\237\177\324!B\361s-B$={\220.3\212\021\203pB\fe\031\256\n\035\216\272\036\020AUNcw\255\241\210\340\336n\233\303\366\264\037\t\272\342\320Z\215\331)Pe\002\373\331\356\256\245\311\276z\273\372\034\367\001\203\305\204\335\321\350aY\232\205\006\266o\377\301gC\374\331\033\236:\355U/\221\204\327n\346t\364\241\245\374\350\005\003#\007\322\222m\223G\375\321Ri\b)\314\221K\266\313MZE%PG\373\020\036\201\200\277\300\005<\372\360\232\357\331\256]Vd(\201tt\256L,\232\016s\261t\274\214\247\241L\017\003 \243\351\230\0022\224"
+	.string	"\263\262\341\314\t\206\273\001\227\315\364\272n3!)\320\263\225&o\214,\220\004\265\356\002\224\037K\254b?\301\\\0242N\035\021"
+	.ascii	"3\241/(F\207\241@o\037(\226\364B\017\266@\203\201\222\017W]\330"
+	.ascii	")\177\260\207\\\306\036\2279f\223M\211GcP{"
+	.text
+	.section	.gnu.lto_updateAltHoldState.76.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\367\001\025\021"
+	.string	"\226]lH\320\262*\035 s\262\247B\253\276\025\261\335\177sK\253\212^\027\017I\031V\253`\004\b\245\236\007\366\203l[\237\032\006\323\326\222\371\322\277\231\361\004\224-\032\211\025k=\004x\031\337\202\b\245?\b\351\272\265M\210\224)\005V"
+	.string	"O"
+	.string	"["
+	.string	"\366\355\257\210\331!\216\331=\256\203\231\267\341`\263\341\231s\212K\342\261\313\020\\\215\371\241\233\354\362\345!\310\300\307\315\217\321\255\005\034\340bbdQ\020\364\362\005\035\260\360\200\030\335j\240\250\307\226\343\271k\207\033M\36532\347\264\2167\017\367\347\266S\266E[K\001\276\232\366\030\364\226\374\352\336\206\243\351\317\376\314iZ~\214W`\372\361\241\017\223\017\277\006J\340f\372\363s\017\355>\344L\005b\353d\272#\354\203sE\330\252\036\201\352\317\252\245\252\367j\275\372"
+	.string	"B\274\336\202\032s\272\374\202L\034!\216\214\0038\242\235\n\2710J\025L\037uf\273\273(Y0\231\344C\271\002B)\002(\350\027\244}B\035\250\255\314\242\035\212\267\364^\334\bE\344h\237;(GD\356\216\326Z\363\026)\024\225J>\334-\340\323\335\211\305\311\260\350\201!\265UX\372\321\2732\353\340\321\204X\267\244.\206\232F\221NV\254\224\324\t\354\245z\255N\342+\005E\265\312 jP\235TD\224kE$!0kC\312%\276X,\227\030\242\233\037\231-M\332\200\220`\307\316L\203\323\210@"
+	.ascii	"f'\367Y_\306g\224H !\3411\352\314\364G\372M\th\316\371\300\217"
+	.ascii	"q\336\004?\346\241)\230\230\310\207\237U\340\0135 \360\002\021"
+	.ascii	"\031\355\"\340\r\353\033\366\257@\330\262\007\310\006y\320X\211"
+	.ascii	"\335\021\017\031\243\t~<\315\325\036gq\311\314k\360\210\025\246"
+	.ascii	",0G\304nk\333\255\026@2GX\\67\032\354ph\200q\307\202\255\350"
+	.ascii	"\351c'\034\"\003.yM\017n\201\221\002x\277\256m{H\243\255\343"
+	.ascii	"\304\210\024b70\311s{\212\032\330p4\206\263\007"
+	.text
+	.section	.gnu.lto_updateSonarAltHoldState.77.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\374\001%\021"
+	.string	"\366\335lG\340\260*\035\350'\240L\026\200b\205\020\026F\337w\020ug_3\206\361@9C0\264<\036\347\272K\266\255?\361\024\254\325~}\356\335\242"
+	.string	"\022*?\237\3033j"
+	.string	"u}\3015\031\037\352\007\337\373\276\335\204H\231RV"
+	.string	"O"
+	.string	"["
+	.ascii	"\266o\177D\314\0269f\337\270\016f\276&\204\255\3067\347\024\027"
+	.ascii	"\304c\227!\270\032\363C7\331\345\313C\020\004\307\215\016\322"
+	.ascii	"\215\005\034\320\"b\\Q\020\364\362\005\031\254\3708\220n5p\304"
+	.ascii	"c\233\361\334u\303\215\246\372\t\231sZ\307\233\313\375\271\355"
+	.ascii	"\224m\321\326\n\0015\345\361\347\234o\311\257\356m8\232\376\354"
+	.ascii	"\223\370L\313\217\261\nL?>\364a\362\341\327@\0177\323\237\237"
+	.ascii	"{h\367\"gj\217\255\223\351~\260\017\316\365`\253\232\004\252"
+	.ascii	"?\253\226\252\336\253\365\352\003\020\271\360@b\314\331\362\343"
+	.ascii	"1e\20482\001=rS\224L0}\324\231\355~\242\204\202\311$\037\312"
+	.ascii	"\025\020\362\005Pp\336\202\264O\250\003\265\225y\264\333q\026"
+	.ascii	"\036\n\030\341\207$\355s\007\345\200\363\037r\227\264V\232\233"
+	.ascii	"H\235\250T\362\341n\001\335\345X\234L\t\036\030R;\205\245\037"
+	.ascii	"\275+3\r\233\231\016\353\226\324\275@\323\013F\225LV,\224\224"
+	.ascii	"\t\354\245z\255N\342\013\345D\265\302 fP\235RD\224KE,!0KC\312"
+	.ascii	"%\276X,\227(\322\315\207\314\226&]8HPc\347\267\340-\036\020\200"
+	.ascii	"\331\351\361Y\177\305Y\214@\020\021\2611\352\314\364W\372\315"
+	.ascii	"\bh\316\331\300Wq\233\b~\314CK !\221\017?\253\240\2073\332\005"
+	.ascii	"5 \360\002\021\031\355\"\340\r\377\033\366\257@\335\262'\310"
+	.ascii	"\006y\320X\211\335\021\017\031\243\t~<\315\325\036gq\311\320"
+	.ascii	"k0\211\025\246,0G\304nk\333\255f@2GX\\69\032\374p\236\200\261"
+	.ascii	"\307\202\255\354\351s\037\036\"\003.\033\234\231]\200\271\002"
+	.ascii	"\330~R\336\342\026H\013\3079\021)$l`\222\347\366\0245\260\341"
+	.ascii	"h\fg\017"
+	.text
+	.section	.gnu.lto_isThrustFacingDownwards.78.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`U\001\025\016"
+	.string	"\006[_D"
+	.string	"\261&\035\363 \n\276,=\017\265\347#\344\017\025\244\026\004\025*\313%\207\217\350\220\372[\331\243m\255\233\200\021\205Q\246\202s\001+\f\320\253\326\211\237~c \300P \tMg\b\002\026\223F\366\2262\245K"
+	.string	"E"
+	.string	"O"
+	.ascii	"'p=b\027p=\332\266\210\202\222M\377V2W\261xI\201c\367\323\024"
+	.ascii	"\304M\217P\323\344wJ\032l\230\271\001\343\235\0365\034f\336\205"
+	.ascii	"T\017\317\005\202"
+	.string	"\354\356i\2361^Kf\247dw\2350^\206\373\272\355\007\266\035\330\347\020\252\262\017ww\255)\333i\354\254\277\023\323\021\246\241\246\025\246S\323\007\220u\220\341\231\261+\323\322\2611\342\013\021\266o\377+\331\231=\300\006\203\314\323\370$^\242t\026\313\003\354\246j\270\330\375\016\030\001\366\350/P\025\252\247\305\366\025\243\264\301Q\2210pT\323\206\306swO\252*_\036n\341J\365\030Qs\343\2229\276\246~\334`\310\261%\274fD\262\262\271\237\240\200\355\356\210\t\225\225\221\325\314\243\317r=^IB\260P\331r\366a3\207\375\23526\t\t\211,H`\022\362\371\350@\230C\237\023\021\227\202rR\241\333:\021H\353R\"l\"\b\332\204\r4\322B\244\025\355S\300\234\n\nI\3538\216\244e\337\036\256\246\234\320\300S=\217\032c\033S\020\224\2668*\246\177\331\201\312\326\025U\005\025\242x\032"
+	.ascii	"<\245\210\031\204\f\232\036\370\355\253\232\"\210\003#xja\001"
+	.ascii	"V\030P\212\030\210\001q\3038\003\214\3242\214\255\301\"8\303"
+	.ascii	"YYt\261\031c\357\342\263\270\3432\220VC^U\270\232\367\266\253"
+	.ascii	"\350\001"
+	.text
+	.section	.gnu.lto_calculateAltHoldThrottleAdjustment.79.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\241\003\275\031"
+	.string	"\306\257\247I\260XQ:\300\341=\204\260\0309\225h>fe\263!\240LD\231:\023\222\f>D@fD\217\300\216\265\351Q\3074\314\315Nw\261\342\211o\354\371\016\371\217\262\314\311tl\314\377\364\336\300\312O\322\267F\b\331d\357\224\002\216"
+	.string	"\216"
+	.string	"\224"
+	.ascii	"\273\252W\273`h\030\371\210A\301\005k\316\367\330\331\027\nX"
+	.ascii	"\334\017N\002\371\nc\202\345y\036/\252\371\264\313\202\212\322"
+	.ascii	"\356\312X\001\371j\333\327q\242\036\327\302\335PN\324-y8\312"
+	.ascii	"\262\273\253\230\027\020_\303\023\020_\351\213\327>\2125\244"
+	.ascii	"\263\346\243r>\037\311\022\027C\004)\200#R\271[X\240\251\005"
+	.ascii	"\225\363>A\344<\314J\342a*\327a\322\227\034P\030\263\273\377"
+	.ascii	"}\342r?s\2164\273\353\031\224\023q\223\267\315\301v\315\246)"
+	.ascii	"\002AS\027v\235\0060N\243\356\343?}\367\223\342\3648N\213/\372"
+	.ascii	"\2538\035\326i\352\351\277\274\324h\222\361\355\206\brY'\265"
+	.ascii	"\310\f\277\367\237\2352\317\223|%\312\302J\216\236\023\241}o"
+	.ascii	"B\247\233nI\365\nS\205\025\316\373|!\037\302s\"4Q\350\204\242"
+	.ascii	"C\357\312\356N\346\325\264\035\351\367x\354\324\353\375\244\036"
+	.ascii	"\377\350H\3479\005C\304\013\262$\007\t\tH-\006H\300\002\351\230"
+	.ascii	"\320\300P\204e\377\350G\215\364\021\"\221t\300+\033\377\007\334"
+	.ascii	"\016'\266Ju\273\273\341\222\207"
+	.string	"\"\ri\202!\2567\271\231\300(L\031\346\221(@\221N\240\224S\252\263\250\342:\342H_n\0301\001M-F\321\221\032`\272i\361\353Jn \374\f\373R\006\007C\273\353\3405\t\212B\200Qd\233A\377\367\b'\256tT\257\004\224M:\022Z\200\241]\333\203|#?\202\343\313x\265\2146\037D\023_\357{\214\215(\225c\366p\250\376 \177\260\3026\267\370\274\243z6\236\354\334b\357~&\325\331\247\301`0/\233\235\022V\226-\262\214\355\350\274f\342L6\233\275j\3545\241|\351\21061\031\005\227\253E\272f\201\213\001\253A\315\202\031\00398e\205\330k\303h\327\214MLv\341e\263S\302\312XkU^\270\201\305,\2544\300Z8+\327Lg5s\300\262\234\327lU\312d\263Ujg{\370P<\255`\322\245\252~\212\243\246\261\321\237p\0340O\224\244\225\332\025Z\363A"
+	.ascii	"\350y\247\271Q\237\371\303\322\244B\244:\317P\365\377~\0205\224"
+	.ascii	"4\241\tN)NuJk\214\246\370\276\237\027G\250Q<\244\fc\206\314\210"
+	.ascii	"\310H0AL\222\003\260\242\031;z\020X\250JS\3504P\234\357\267\354"
+	.ascii	"\337\355\026P\343[\373!\226v\221l\023wdn@,\365\351\321Nt\350"
+	.ascii	"\027\311\001(\216\016*}im\t\243M\317pH\265\341M\223\363\026\002"
+	.ascii	"\230\b\016\2402\032\"\366\372\301;2xV\224\253\276\330*p\214\225"
+	.ascii	"\333\214\030\210{\004|\364p\204\030t\212\240\366|S0\r\261/I\212"
+	.ascii	"s\331\n\240i\t\304\303\007\234\030\3175|\362\"\367\225&\265~"
+	.ascii	"[6T"
+	.text
+	.section	.gnu.lto_calculateEstimatedAltitude.80.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\227\fM@"
+	.string	"zm\350\027DP\236N\007\373\216\342:\307B\364\035\354\rc\322IY+\210\025\236\216u\\\257\025u\370<[\215\355\267\245\215\237\343\376\347\327\230\214\006 b\034a\032\235MV\260V\037\263_ra\2644L\310\356\226dJ\001j\001S\001m\001n\356\026\231\233es\027\331\334\237\314\235\221\271\275\203\0028i?\334\200\274\231)\234#\321\016,\206\255&\351\311<\371\230\215\331\247\356T\334\253\270\337\271\347\271\353y\233\221\335\336\316\347Z\272\221\035\303\257\264c\361?\317bD\304N\032\024\030\206\221V@ V@\2421lU\277\262\252\237P\335\332\361\205\363\340\242\021'b\240\030\n\215E\261\331\2511\274\257\255\305),\375\031r'\352\203)\314\371bt#\235u\237\342un\347xn\305\367\032\t\204\246'\003O\355\n\303S0\"yo_J\356\232\272\024\003"
+	.ascii	"\333\030\203\223k\361\244J\021\255;*`\3070\262#\236[\334\211"
+	.ascii	"\243\263@~Q\335\323\246\036\303\310\204b3F\2560\f/9\333\"\216"
+	.ascii	"\316v\003\211Ey\356v(\036\345u\272\031\315\003\303B\002\261\300"
+	.ascii	"\360\224\251\235\216\316.=\250u\266\350@\255\263\375v\263\361"
+	.ascii	"\351\033\354x?\306\354\fa\030f\276\233\277\316s4\266l\361\363"
+	.ascii	"\333\036\346<GB\312\316\374\350sdf\202dg\331\330#\355\341\255"
+	.ascii	"R:V\\\3020\354{\236mH\343\314\362\360b\261\301\325O\016RJ\243"
+	.ascii	"\030\224\003IT)\025\313_4bS;TJ\241\305e\0271c\276\347Gsdg9\033"
+	.ascii	"\247`\030\356\034\225\226y\367xw\373\350\356\267\356$U\0348\264"
+	.ascii	"\316fk\264p(ww\360\220=Z\374\021O\3302]\002\336\222T&\202\324"
+	.ascii	"\356\316H\355\202>\246\251\315\356\353\276\326Y\345\031C\237"
+	.ascii	"\271\240\334-bD\366h"
+	.string	"/\223T%]\335\373\021V\374\266V\321\346\277\252C\363\223\273K\230\310\036\315\377\264\006\375\260\316T5\t\377E\b\356G\246\236\t:\235 \211y\377m\355un.\243}\372\253\272/b\231Ng\252\216\247w=_>_\302?\275\177\211\345\2409\261\333\271x\340\214v#\375e\225=j\325:\353\177\200\320\354\231\023\333\207\354\n\306K\340\226,\200U,J:A\337\363\017o\304\034\026\302\271N\367\024\232\277\255\333\213\360\263u;\025\357**\317\363\326\300\346\236\362*\336RQ~\347\r\345z\336ON\347.\301\247\336Nln\246\233\273\211\315\315\244\314\355\300\315\275\344\346n\340\346f\340\346^\340\346V\340\346N\340\346Vrs'\271\271\221\334\334\b\334\334Gl\356%\233\333\210\315]\304\346>\340\3466\220\314]\300\315M\344\346&\340\346\036rs\017ps\013\271\271\203\334\334\002\334\334@n\356\0377w"
+	.string	"77"
+	.string	"7\267\217\233[\351\346v\335\334I77\322\315\335\343\346\346as\037\331\334\306:\300\216\271\254\350\205\340\350\236\177N\016|\347\034\231\f\f\356\215\213k\r\374\201\367\030\3143\3370\020\204FvXH\247\b\032\232\343\267\265\353 \302:\234\016\034m\324;\275\2150^\240\300\217\341{$W\337\020\325hF\013\237>O\364\316\027\247A\377\b|\273`\216}\360\203\236\300\267q\342\264\001/\364CO`0\236\203f\261\001O4\030\313\025_\350\215v\361U\300\003}\320\3475\361\034\364M\222\241\257\222#\f\213M\350\034\226\237\357\022&o\223&\255\263\002\336\001\034\335\323\357\347\225\017\024\340\001\374\317{\234\226\030\340\225P\357\363"
+	.string	"\020}\236\211\260\350\276R\352\241\336\375\242\024\251\367*\311o_\352}\215\323#?\371\036\317\321i\352\353\244\373\220o"
+	.ascii	"\256\247\352\304\351\247\236\306\250\367i\317\363|\324gk\034"
+	.ascii	"h\374\236/\"\036\237\347\363`\0347\004;\3020L\241]\216\317y\237"
+	.ascii	"\274Q^)\257\024ok\353\354\361\223\b\253UD\262D2\355\267\365\222"
+	.ascii	"\033\333\013\375M[/4 `\353\254\361\223\204fU5A\250\367;_>=Fk"
+	.ascii	"\263\006\267Tbb\240\030\f?\221\332\207z\267\213\347\330o\337"
+	.ascii	"\343\353\223\215\267\221\201!C\206\326Y\366\205\b\315\202\244"
+	.ascii	"\323\303\302\342wop5`\31130\fOhG\343i\250\332\2158\333U\001Z"
+	.ascii	"*\266\264\2121\232\\\337ZM_ZN\253.&\213fWW\023\213\310\331e\365"
+	.ascii	"(X\256\254\020M/\253+\243\023E\306\302\262\342\312\202al\321"
+	.ascii	"\3454A\002\013\313\352\330W\017\260 P\210p\365\240i\350\013D"
+	.ascii	"V\327\326\007'\213,/\257\027Xnc5\241\340jje\241x\341\334rrY1"
+	.ascii	"\235Z*\266\270R0YlYu1\261\274\276\230MG\335l\221\345\305t6\233"
+	.ascii	"^L\344\364\351S\317\207\3628\275\234\013\270C&\022\351#N\310"
+	.ascii	"M\357\364U<\336\036\331\243\314_\306\037\026\327T\027\335\327"
+	.ascii	"\364I\204fq\230\340\316\336\270/\321\302\246\314V1\275\2055\032"
+	.ascii	"n\252\336\2518\370\252\3675cw \344% \257Z\353Q\007/\265&\326"
+	.ascii	"e\211\255\311\327\340\025\374\322\267v\f~\3017x\243U\211\301"
+	.ascii	"\017Yc9\252_\360Fk|M\360J\257 H\202\367!4{\006\311jiJ\257\304"
+	.ascii	"\205\252)\367L}\367\333\366\272e\217R\275\324\032\215"
+	.string	"?\277\251n\247\272\357\371\021\021\355zx=\363\377\251\357\034\313\361\341\032\376\277\302\233\226\030\016T\213\367\350I\005=\213;\017<;;\230\274Az\261:\331\252\276|R\363\237\224\2427\313|\321\302\347\337\023\r\357yI\257\001\f\322#\370\244\3678\360\351\221\336\310\027_\341\224-8z\004\313?zv0\276\032}\321/\337c9\036`+\3368\243/\"4\333\220\003\201\024\250Q@\b\0212C$\"\"IR\220BcQ\005\304\030'%l\007\021 =\353\330h\322\3120\006\372` ,\367\367\343w\360\275\310.\244\217\202\352\024\0346*w\235H\313c\323#W\333j\323\343\344\322\3507\323\361\234\324\001\301]\034\227\351\002\314\274\237\023Kbn\003\375\305\003\026D\007\306\027\211z\256\273\007&2\240=\314\345\261@\b\327`\354\t\326\262\250\226\354\210\275\234\312\371\274\025t\210\006Q+\241\3331*BE"
+	.string	"\274d\024\266\335\201\217\211\277M\224\215\224\243\303\305\021\374\006/;`O\256\217Q\"\237\306\215\345\215\327\001\024\027<\317\006\247\246\264\347\300G\373K\324W\363#\335\224\003\025r\274Cp\322\273 8u\343\223\211\326\274/\006Y\310|\204\214L\254_\204|\327-\341\273\200\036|\367d\357E\366\226\251\031 j\332\215U9\344\310\327hz {\247\256\256Ne]*R"
+	.string	"\246"
+	.ascii	"\251F\243\t\261\214\027P\2001\300l\3410U\324J\177\327\270E\007"
+	.ascii	"\210<va\020\346W\266\247\274p\254\316\310\030\350\006\325\376"
+	.ascii	"\241U\227m\276|\r\260\204\263Y\207\303-\353\241\317\261\321\371"
+	.ascii	"G \027\036\331Q\"\276\212\304t%\214z\3737\231\347\324\326\225"
+	.ascii	"\"\0267#\271\346\306\235[D\035\264\211\324N\3135tDd\311\374\""
+	.ascii	"\b\355\221\374\303\3467\2620\361\377a\374p\311k\025\006\314j"
+	.ascii	"kc\006')\334\202\254=2\353)s9b\326\267\224\313\341\246\034\236"
+	.ascii	"\\#1\320\270\301\312-\317\221\fAB\034\361e\212$\344\013V\264"
+	.ascii	"R#\252\025\311\301\313\3042\237\365@\220J W5~b%\225bo\351\217"
+	.ascii	"\264"
+	.ascii	"\250\034q\222}a\221j\210/\205yL\320w6\242\235;\205TP\032\234"
+	.ascii	"\306c\317\004Y\233\307\215Hh\rB\243\b!\344\341J\020\314C\037"
+	.ascii	"\020\215:H6\352\337\266+'P\216/\033\361\304\364\305=\0255"
+	.text
+	.section	.gnu.lto_altitudeHoldGetEstimatedAltitude.81.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"%\007"
+	.string	"\322\21525`m\322\001"
+	.string	"\255 \244j`\326\0209:\n\242}\251u+\205\025\254\020\315\242\336\205 \324\023\277\303\217\326\324\f\002\207(\262\375\344\304j\326\343\226\354-eJ\001\326`6\225\325\341l\0340\n\2532\021\353$P\025B\\\2402\nQs5D\f\201-\006\316\0251\313\272\342\304\355\337\252(\365\022R\b\373!\3472\177\303\017\236\274v\350{\244\303T\200QE(;O\027\233*6\007J\305\260\377VE\266\323\251\003\024(\007#\273\022\335\312\236\300\022\016\333\037{\362=\376\361q\3668\215M\032u\021\")\273\033/\027\220\016\337\003\244C\315x\366\314\374\203\374u\230\220h\033\350i1\330]\247\266M\334z\333\005\266\243m\213\b"
+	.ascii	"2\241I\037\030\332\020\240k\370m\304\310B\344\341\256\230\332"
+	.ascii	"I\006"
+	.text
+	.section	.gnu.lto_applyAltHold.part.0.115.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\267\001\335\017"
+	.string	"6\335dD"
+	.string	"\221(\035[s\361Yl\315b\262\212.\376\013\031\357\326K\245Z&J\350s4^\b\372lS\365?<\224\210\215iu\235M\335\357\373%\227\376?I\3405>\227j\017\002\352\256C\341'd\357-eJ\001N"
+	.string	"N"
+	.string	"S"
+	.string	"v\347\360$l\233`p\312\226q\230\313>\246&\345D\315\356n\207\372\341\251\303\247\031S~\366q=;\330\264\270\223\303\354\263B\243\305i\370\313\026\227\341\352\301\255\036\201\335=\354\251\302\2612\005<f\237\335\265\266\341\316n\033d{\263s@\372n\006F\2251\037v"
+	.ascii	"\235\213[\350^1::\03306mR[\254\361o\225\305\206iNLk1\235\305"
+	.ascii	"t\204i\370\322\357\245\365\245S\323\357\b\300\340f\367B\354f"
+	.ascii	"=@\031\021\376\353\260\222\303X9\034\177\225\334w\231\330\035"
+	.ascii	"\337\225\n9\016|\005\210\266\273\n\374\024W\321\300\001\b\024"
+	.ascii	"\017\241~\200\220\321\324\247G\031\261\312\230\375\356(B\376"
+	.ascii	"\213E\243Q<LE0\303A\225\261\227\273{\242\256\020\257\036414\254"
+	.ascii	"\274\341\303L\272\t\b\332.+\201_\3421#\376\313\241M$\371\026"
+	.ascii	"I<|\016yBJ&\021Q\b\005\024\tU\002m(\221\021\251\364`\213@\002"
+	.ascii	"\215l\241\323\204\315S\300&\t\242\323\2062\231N[\307v\376\255"
+	.ascii	"\262\270\256u\261\027*]Amq\252\201/\b\221\236\253\252\330\034"
+	.ascii	"m\001\362\341\302\342\255\031\232r2\215\252\351QV\236f\2325\240"
+	.ascii	"F}J, p\002\241:\263\003%\022\360\235qDO\230\306 \222\313X\201"
+	.ascii	"\313\215\331\034\r\330\2165[\374\230\364\001\300(TC\2431%\360"
+	.ascii	"\20639\332\023\223\312\02175\242\b=\356\032\013f\274!\354\210"
+	.ascii	"\3160\027\316\242\213\235\2177\032\333 B/F\332-\235-[\336.\013"
+	.ascii	"\304~7+\235\235i\305\022m=\341\215\001"
+	.text
+	.section	.gnu.lto_updateAltHoldState.part.0.116.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\315\007"
+	.string	"b\21635`m\322\030"
+	.string	"9\026\b\025P\335\004b\230\005;\261\307\273\373\367\307'>\272\241\276\002A\250'~\207\037\255\251$\f\n\260\222\321\315\003\002\001|\321 [n\231\002o0\034\353\362t8\016Y\225Y\232\230y\022*\013!.T\032\205\270\301\032\"\206\340\213\241\203\305\354\272\260H\375/\341\352\350\214\204N\250\222~8\262\332\261\200hz\226|"
+	.string	"x\210\210\227\333\003\024\n:\271<\330(\331\227\362\224\264\302\204\253\243\327K\201h\367bEe9&\222\217O\356\363\324\311iO\345\224!\377\007c\355MR\244\264\331YTt(\273\033sR\217\324R\037\324\316\267\205@\251\311%\004)\235l\241\214|\227\204\001\231\335\335\242\221O\371\033\374\361\357\002\020"
+	.string	"Y\023\030w5\255H\001\324u\200(\030\346\ng\ra\347\f\2403@\233);\r"
+	.ascii	"\327\036RXh\266\364\2042\006"
+	.text
+	.section	.gnu.lto_updateSonarAltHoldState.part.0.117.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`;"
+	.string	"\305\007"
+	.string	"rN34Po\322\030\200~\354B\030D\244\270U\036W`\025\371\272\306\310\304\005\374\033\312#\017\301\013\243I\034c\315g\246\t\034[\375\327J\250-\364\200\376\336r\313\024o0\034\353\362t8\017Y\225Y\232\230y\024*+!2T\232\205\270\301\034\"\246\340\253\241\203\305\354\272\260H\375.\337\352\350\314\204R\250\222\376W\262\312\361"
+	.string	"\nto\023\002\340#$\\\206&\250P\320\271%\302I\312:\026\247\244\365\345[\035\275^\fDv/N-\273\001M>>\267\317S\347\246=\2250C\376\017\306\332\253\344\210\307\246\251daZ\331\335\230P;RKuO;]H\004J\315-\037H\351\024\022e\244\273\344\013\310\354\356\002\0329\314\377\340\217?I\020"
+	.string	"Z\023\030w\265\255H\025\324u\200(\030\346\ng\ra\347\f\2403@\233);\r"
+	.ascii	"\327\036RXh\266\364\2042\006"
+	.text
+	.section	.gnu.lto_calculateAltHoldThrottleAdjustment.part.0.124.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`x\016\265?"
+	.string	"\032i \027@P\346Q\007_\327 \275F\013\305\016\032 \275\n\261\377\327\335\215\360u\352\306\004X\355\217 l\354v\212\235r\226~t@s\003"
+	.string	"\b"
+	.string	"H"
+	.string	"\210\277\372=\177\217[\016\002\035[\263d%I)\245c\001B\001b\001\035\307,\344\255\216\303M\247\3554\334\317U\363\336\3564y\273\343\264G\211[\235!nu\232\314\372\310\217\253\3305\275Q\fW\246e\362\232\236R\326\273m\253\347p\233"
+	.ascii	"(\217\236\210\362\266~r\266x\345N\343\342V\353\265fc!\2347w\320"
+	.ascii	"\334\274\261\201\353\264\035\334m\032\255\341\260\260-\261\f"
+	.ascii	"\2347wl\254As\263,v)\335.\351[\331\214_[b\034)\346n\303f\371"
+	.ascii	"\353\001\375\255\221\302Q\357\275Pm\371\310gej\316\252\250\340"
+	.ascii	"\232^+Q\244\336\333,\r\253\365\224\356W\363k\212\253\317,{\323"
+	.ascii	"\033\205\022\221H\261\367\264\317,\031x\357X\240\265{/\205\266"
+	.ascii	"l\341\327\226\271\315pA\231\231\233L\227\331\301\313\336\224"
+	.ascii	",\272J\335\236gy\367\336\250\266\305fZ\333\366zim\373Rz\331\302"
+	.ascii	" \360\347[m\357"
+	.string	"}\270\344\356\321B\337\007\266\356\205\021\303\246\214\242\261!K:\030`l\210\222\006\316A\223\364\257\347\240H\342z\301\026\250\022\367\271W\024\254\327\022dug\300\270\211\202\265M\212\372\350\025\357\275\302\350\323{=\tapE\222\242]=&=P\0025\336\323\277'\201\312\206()\352\3541\t\301\342\325l\355_\321\246\273\200\036\372>\334{\271\231L\232\221\232\231\3470\263\024f$\274k\377RfF\256\375/\314\354\272|\021\2637\275\013\311m\205eXy{Y\255m\373\207vH\230^\345f\353 \232\235\271\353\214\374\245\374\303\376j\265Z\345\217\302l\235'@Yg\t\3269\202u\206\360\316\306w~\360\316O\255\246\333A\233u7xg\006\326y\001\320\271\330k\315\n\254s\002\353\214\300:\037\260\316\006\254\263\223u.`\235\tX\347\001@\347&\353\314d\235\211\326y\t\350, \350\034@\251\247\335"
+	.string	"\222\220\254\363\320:\013\255s\020\350\f\f:\377Z\255\331g\235W\353l\255s\317:\277uv\240s_Xz"
+	.ascii	"w\257\220j\243+f\343d\351\265n\265\3564\357\301\0304pq\362w\313"
+	.ascii	"\210O5]S(\f\032\2648I\240\305\314H\321\242\3322\"\353\272P[\314"
+	.ascii	"m\301=m\201\314\315]\250\025i\345\375\330]\030\256Ft\243\257"
+	.ascii	"\023\ntJ\335\240\332\022\005I\371\274\023q\033\352CZ\215\350"
+	.ascii	"\306\n\005.\361\201F\275w\352d\372\353\245\265\220\026\263\020"
+	.ascii	"oP\3375\325\216%\nd\327\177\032\220\035\202\310\017\237\246\353"
+	.ascii	">_h\315\234\\\347i=v\317\331\333\035.v\251\221\272Q\345\004A"
+	.ascii	"\274\212\b\021\304vH\317\223\337K\237\024=\327\254H?E\307\016"
+	.ascii	"\177\352K\017\257\201bla\357`\235\364_\313.z\210qpH\272\337\272"
+	.ascii	"\310\004\353vc\372n+\022\237\351\373\320\322+=\361\3273\001\277"
+	.ascii	"\344b>\2064>\231zb\001\264\002\336\030\026\340\237\034\255\252"
+	.ascii	"\004\340\223^\351;\316Y\326t\224\364\037\356\006\tj\246/\271"
+	.ascii	"<\314\336\275\367\372\220\276\323\230,G\034\221\2368\245'\007"
+	.ascii	"\315#\344u|\b)[\207n\226p\310s\307\305\272\225j\0163<H^F\370"
+	.ascii	"\016\r\236>\275\227\362\0169=^\230\3015\036\325\255\334\355\230"
+	.ascii	"3h\370-\250\213\314+\374\341{\233sL\360}/\374\225\316\271\005"
+	.ascii	"\370\301\357\347#\246W+\270\021$\005)f\022^d\312Xw\357\335\320"
+	.ascii	"\226\235H\r\023\334Vh\254m\201O\301.\016\023\352Q\032'R\244x"
+	.ascii	"\243\234o\311\203\3533\257h\341\355\345{\023b>\276\007\017\321"
+	.ascii	"\342\326o5\346\256\353fk`\224\2705ET\377j\373\353\263;\0215\275"
+	.ascii	"\312\016\244{o\277\003Y\035\247\241f\240\016\272\2116\240n#k"
+	.ascii	"\032\t\021T\350\032\372\243\003Hs\333\332v\275\357\272.2\337"
+	.ascii	"\277\367\355,kz-]\034\377\201\354O\377\261\244:\036\327\266\376"
+	.ascii	"\304!\332[\223-\242\006H\0308\224VJ%\325\257J\206UUo+y\365\\"
+	.ascii	"UA\253JI\205\025U#\211\205\225<:)\261\250^y\205C\013\231\265"
+	.ascii	"f%\263\262\220\366\n\211B\211\324Za\\%U\034\217T?~q\341\210A"
+	.ascii	"*\303\213\013\025\b\330\300R\272\270B\346\360\361\261\002\214"
+	.ascii	"\253"
+	.string	"d\025\022\006\016\245\225\362\212*JY%\303\352*FT\r+*\254\250c\226VT\205\005\234\264\201\314\212R&\223YQ\302\356\335\217\302\315\326 \236I\236jA\250\2370\341\371\003\363\233\302\227\362\024\035 \323O}\371\305A\037\335\371\034\254\023\374\027\263\247q\201\222\360\n\036\252\254I\307g\317\257\021\036\265KGx\t^\032\302G\360\323\247\217\320\361\370\303\007\302\367\036\343C\370v\344\304\303Tk\366P\255R\273\356e6x\360\306/p\346\334\362\364\f\376\201\203o\360O\357\243s\206-x\006\324\342/\330\2024\326\201p-SOu\3057\3329Q\200\340\025|\3239\303\232\323\003\217\340\377\220sL3\311\201\307\342t^\204:\217\034\2360xeU\332\300\037pz\003sz\230O\236%\223{\345\234\276\361t\0131f\032X\201'\360N\337\3160*\313\020\307\002\3374\005\311\200Wz\002o\0355\375"
+	.ascii	"2\244\221L\204K\231z\"kz\343\2248iF\022|\257\275\271\265\375"
+	.ascii	"\362\344\250\212\250A\340K\231\321\234t\201"
+	.string	"/\250qD\346\024B33\"\222$I\226\003\261\005\304(\005U\332\006\022@uE\021;\"\222\202\024\366\377;\300\215\317$(\013\350oE\347\373$\r.t\260\243\274\334aq\314\013F\333\232\331\n\273O\260\265\241\327\r\\\033\020\030\222oQ\336l0\375B=*\036,\254nz\356\256\265\3740\024#\222\3243\313\230\211t`\245\031\223P\346\354\312a$\366\272\341\372M\213\340T\222B\352-\272\3174\211\342\367\216\276\20369/\324Fi\273g\272\323\346\\\021\261\356\361\026\n\206\251\374\2527\214\341\204\364MC\025\347\254\t\r\257\343\330\345.-;i`\240\214\331\264\340\304\2377\\\037\3609\315\370\354\"t\223eO\224\326\303\352\230\365\246\242\342q\345q\272\007(\372\016\232\302\267\342\313\272\3364d?1.\224\3445Y\316\303\201\363T\372- \300\t\201\260n\242\031\343\031\231^ \fT\232\326o"
+	.string	"\032\212\240\320S\207\\m\016\374\254\211G\260\320vEyQ\fT\357\266N\3634\r\313\266\325X\225@\372\235a \230\257\261\317\341rM\310Hnl\013\250\234$\370g\352\232\202*y\347#\324^\223D\362b6"
+	.ascii	"`\013\306\214\223\317#\251(\025\031\034R\207t\302\\\205\311\236"
+	.ascii	"\265\266\226\005\3200\3224\025\247\232\332%\372\260\237\254>"
+	.ascii	"D\\\312\025\304\r}\373\025X\233\356Q\321\203L\364\361\374\344"
+	.ascii	"\346\235\223\310\340\232\325MGN\230\267\2000\371\200}R\224\350"
+	.ascii	"\222\374p\007\306\027\352\255\313\336M\027\304\255\313\374:\217"
+	.ascii	"cg\257;\177\016\t\362Ak\327I\261\317m\230\253\365\233,TG}\242"
+	.ascii	"`\252?\210\314\232\r\254\211\251\335\n\0051\230\240&\333\335"
+	.ascii	"\201\361\\\212\272\263\246!j\347~EK\275\330\026N-D3S\030x\001"
+	.ascii	"\221\213\001\246\211\b\360\376n\207\371\220uMyk"
+	.ascii	"\376]\377\304}\203\306m\030W\305\013y\3260\372\224AY\2400\251"
+	.ascii	"\t\361\024\370&\t\240\2532\036\0023PO6\003\022\355\214\376\313"
+	.ascii	":\305\270\364\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`5\003\235\020"
+	.string	"\266YbG\240\232M\032\0030\235\344\001\031\371j\257\325\247\376\f\237Sv\317\034a<\340Ix}\340\245\241&\207\210(i;\361\004\255\017\343\244\344\026\306(\t"
+	.string	"YF\202$\207W\307U\261\212.\340'/&\324\202\357[\357-SH"
+	.string	"N"
+	.string	"O"
+	.string	"\n\366*\330\263\203\341\361iM\317\373`\373\027\270\263\020\235 \271\354\365\3145\221\234\225\022\274D\306\211\340&r\331\201\207\310\370\372M\003\037)0\223\026\201\235\310_fz\336\374\361\373M44f\3169\007\354H\340\037\003\013\313:L\343\360\226\rw\321\360T\206\263`\030\313\205o\322\302W\204\266U\330\212\244p\324\204\275\326\222\260\024\031\264+\001\332\233`\204=\t\374\031\212\2040\224\364\331\231\340\203\237\244\203}\tz\023H\203\335\bdp\221\230\313\345r\013\36600q\346S\345\201\363Rs\321\260\242P\316*\246\330\253\240\330\245N\354ZL\354TJ\354T$\366(#\366)\372\3039\347\013\020\261?\321\177q\024Cba\024\342G\376PlhE\214\b\211\350H\205Q\213\327\372%\201"
+	.string	"\222\037v'\350a.2\357\f\247\2131`\350t\321\005M\307\365\250A\345\352b\321\255\b\326E\026\215\247\213\253O\177Z\262!\353\351\342\314\016U\\\216\234\322N\027\001\314\024:U\331n\320\340\334\260n\242\314MU\206\215)\352e\363T-\b\216\225MT\251k\242\352P\b\2254\303G\200\232D\250Q\024\342\231L\342\244-(\027\003\320\002\251\252y\021"
+	.ascii	"\241\263\002C\021I\034\315t@\314S`1\337@2\340`E\227h<d\373\205"
+	.ascii	"\245\244\347\321\327\360\266{z\326YM\037$\264\205\250l\276P\331"
+	.ascii	"\345\341\016\177\212BK\023 \030\262\312\300\225\334\203:\250"
+	.ascii	"{+e\237\230rq\242K\027\017\215d)C\035i\032\254\247$\331\035\303"
+	.ascii	"w\205\302]w>\2035\013\335ta\307M\372\345)zTy\305\226t\302\252"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.refs.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"m\b"
+	.string	"V\026?7Pk\223a\f\203\246\026\250\026\212\364\237\240\250\276\030UUU5\021\316\314\314\314\314\f\355AD\353\236\001r\003\031\0335a\257\260\031\261q\013v#D\b!D\332\226)-"
+	.string	"/"
+	.string	"3"
+	.string	"\377\2006\004\211\375 b\027l\004\221\017\254\rD\333\241\326\2006cZ\216t\005\255\211\366\022M\001-\345Y\311\236\"G\353\310\316<\007\001\025-\273*\243\330\031\236=\341\331\243r'\342K\345H\032\232^\022)\323\211h\251h\211\372\231\224<o\210v\bu\020\013\025\246MAz\004(\023T{h\334!\340N\306\034\316\033\214\325l\026S\255\345b'\0275\230\222\314T&f\005\230ZPky\266\022Y\312zb\332\211\264ty\001h1]\001\t\254\311*\260.i\307\256\001\307\016Am\020\034\3770`{\350P\235\303\3065t6\206\316/`<D\332 \233K\250\366\307f\031l\254`3\004"
+	.ascii	"\347RA\314E\341\001,&\257\323\f"
+	.text
+	.section	.gnu.lto_.decls.6cb24e0035b0842,"e",@progbits
+	.string	"(\265/\375`\0052%\347"
+	.string	"\232r\325QV \fYI\215\001F\270\234\032\305\031\313\202c\341\036-g>\324N\376\231\303Ru\370\271\304\213\314\013z\206z*(C\364\2524\3326\300\254\230\376\271HwDz\273"
+	.ascii	"\020\253)2\217E\225\302\224\343\255\340\017\374>v\217\205s\365"
+	.ascii	"{\034\336\324\361\023%DJ)So\004\027\0056\005\3216*\226w\273F"
+	.ascii	"Sl\352*Z\325\002\352\013\2155_~4\351~$\024\342D\347R\210B\241"
+	.ascii	"\242\262lV`\301\270/|xo(\273&\225\033\225\363D\307\214\213da"
+	.ascii	"uuo\334\254\373\302\272-3\330\035\033"
+	.string	"\353\306G\364\2775n\217\333\274\\\027\307\025ri\334\024\256\217\273u\207\334 w\307\005rs\\\033\227\307\375q\273.\363\236\340\352\260\317{\343\306\370]^\031\317W\352\367\306ma\355\2603M\257`R\025\335\333\031\375m\032;vo\334\031\207\342%J\n\244\276\004\211\212\375\266\315\275a\343X4\353\266\334\3104\035\024I3\003CC\221\006\r\03243L\264\313(\237\367Bg7(\274\025\372\274\244>\017\251\177_\374Wi\351,\332\007\366N\376\234\341q\326\345\346\253\205\364\353\202'\371\342\254\353f\2358z'\237\321@\321\334E?\253\351\347&\372\231\210~\236\241\237\2574\006|\247\217\315\350c6}\354Ds\360\245?`\036\332\256`\341\330\347\006\266\356\002\261{2\271\371x\203\036\276\273\263\033\364\216U\350\247E5\007nw\213\376}\352_\025tv\332\241^\\\357L\223\037Pn~\2078kF"
+	.string	"`ZY\216\354\355Dc\2376\316\2369\007\017[CQN\232(\321.9\377&\365-\031\375\3332daVt\230\221\031\363\264\\\216\335|;\306\314\347\242\311\221\0317\3330H\267b\032"
+	.ascii	"d\007\330\315\030\f\234u2\221\330\335|\013\367\333-\226\213\375"
+	.ascii	"b\231\025X\025h\254V\270\331v\261n\366y\301z\271}\263P\316\203"
+	.ascii	"rn\247\235\343\212\312\272\371z\321%\330\333^\350\331\273;{\241"
+	.ascii	"w\231\226\250\247\201\035\352\3316\244[-C=\345\322\271\177|Y"
+	.ascii	"H\232\234\335\034\224\345B\216\nSp\364\270\331^\341"
+	.string	"i\022\006\004\314\315l\326\212U\263k\266\212}\332+6\355v\212\245r\353\334;\271\367\276\035Sb\311|H\347\306\352\3618\273Z\322\2255yz\220\242\304B\211b\321|H\240\035\005\306\254\271\267\363\035~\244\237\203\007{\305B-\032v6w\324\027*GL\234P\245\241\333\333Y\244!\347\354KL\216\236\234\301\022\365x\226\207\276\255\241o\261\364I\240\201\234\330'\366y\201=\303H\262\037\2378H\342\300\271\371N\272'\351?\b\336\266\207s\320\267\027\364\354\235\275\240\367\013t\221%\352Y\262k\227X&\267d\326y\016\036\336\223\334b{;-Y\336\033\312Z\f|\326b\300[\013\002\305\244\227_\201\376\325\030,Q/\314\212]\200\247\252\230\333log\320\217\023\206\325\216\233\357\264D=m\207z\277\035\200\0012\370\355\320o9x\201\335\202\013~\234\303,\313\002\275\037\263\270\311\241\037\223\340'\017"
+	.ascii	"\n\205\374-\362\277\027\330V\205\t\376k\355\235]o\t\376\353#"
+	.ascii	"\201\r\216\340\277\"\370\337\201\333\263r\377\360c)\367\004;"
+	.ascii	"\206\004\364B?\306\361\333\017~\373\200\020~\033\"L\317\217\243"
+	.ascii	"\230=\301\"rKHqQ\224\335\0237\300\377\r.\200\037\257\030A\342"
+	.ascii	"\026\\\347\307\"8\373/\007\017\374\257r\237\326\376\353\364["
+	.ascii	"\035w\265\340\036\217\341\307!\362\217\213\374\217\373/\001\376"
+	.ascii	"/\371\217\377\034\302\177G\370o\004\376+\302\177%\360\337\t\\"
+	.ascii	"\246\377v\370\257\210\377~0\374\357\363g\032\377\r\301\177\205"
+	.ascii	"\377U\372\257\372\337\022\377\325\300\1771\360_\013\374\227\204"
+	.ascii	"\377j\360\337\237\377\366\374W\377\267\367_\374_\373\333\273"
+	.ascii	"\337\332\375\026\316o\337\374\326\315o\325\374V\356\267g~;\346"
+	.ascii	"\267\320\337\206\371\355\223\337v\371\355\226\3372\371m\333o"
+	.ascii	"\223\374\026\313o\251\3746\355\267f\277-\373\255\363\267c\277"
+	.ascii	"\005\373\355\221\337~\375\326\353\267D~\333\374m\327o\177\374"
+	.ascii	"\226\353\267=~\273\343\267\314\337\326\370\355\214\337.\177\213"
+	.ascii	"\342?\211\337B\340\377\227\377u\277\205\361_\314o_\374\326\305"
+	.ascii	"o\263~K\201\337b\375\266\305\377\242\377\024\370\377\366\333"
+	.ascii	"\025\277M\361\333\247\377$\3746\002\277\035\341\267\036\374\326"
+	.ascii	"\303o;\374\266\203\377h\376\223\371?\346\377\210\377p\377\261"
+	.ascii	"\374\277\362_\354\377\006\376\267\375\007\272\273\273\273\373"
+	.ascii	"{\032\374;\n\3703\230\021[\271\367\322\001L\350\242{\271\314"
+	.ascii	"\340\343\221\005\316\207\031}\0366\035$\003\354\211\301,\332"
+	.ascii	"\361\3367\3204\267\362\312\006\237\027\nI\226Ot\020\326\221#"
+	.ascii	"q\315^\032\266\2462L\007\005\371\372\272\320\3235\215`\225\251"
+	.ascii	"\222C\007\251\220t\354\345u\241 \314D\020y\323\306f%\210\f\035"
+	.ascii	"\344\226tL\204\310\205f\347\316BJ\303\243\245{;\222\216\233O"
+	.ascii	"\334\264c2\024\331\326\332Q\021v\265\344\205i\241\373\272\371"
+	.ascii	"<S\232\210G\022\006bq\220\034\270\313\242\351\335\314A\213\342"
+	.ascii	"\212n\245s\303w\334\350\357\300\351[\213\326\013\322\221\264"
+	.ascii	"\301\342\037\366\211\177\\\350\b\"\210\310E\267r\271\301GK3\251"
+	.ascii	"bM\007\255%\035s\331'\346\262_\256s+\221\224{\303w\226h\2377"
+	.ascii	"I\307=\236\270\207\205\003\301\305\334Z\030\214 \213\200\365"
+	.ascii	" \245\354h\364\32090\222\216\267n\237x\013\357\310"
+	.string	"H\262\215\364\201\211\262\334`\263\334~4\261\016\037\272\0347\324n\376\216\013}\0358\232HF\022\276\201q\0343\177\314\274jz\357\335\301K\327\334\221\275Tf\270\016\231\376\375{\033J\271\367\326\3429\2672\252\347\226gm\206\337\307b\233\301\336\3270\002\347\206b\333\261F\027\201B\321\270y\237\347\246\234*\333B\202\330\312Jn\305\230*\333\332\310d\0272H\271\267\220Se{\007\355d\022)\202\271\203\246\312v\326V\361\226e\267s\013\271\223\314\035\264\223\033\n\303Tr+k\252\f*+h\252l+k\227mm\240\235\204R\262Hne\320.\333J\263\313\230Y@Se\314\254\251\262\255\037\366\311\002\210\227\226\225\035<\200\330)S\311}eU\003J\t\3446\345d\3561{[3\251\255\314`\357\032L\345\030\250\0306-\312\355*\n\n\024\323:\255\242t0w\322m\312\213\271\267W\324\322\266\352"
+	.string	"\351t\333>\254\033rG\215]%\2657"
+	.string	"\254\366F\332\355\266\367F\356\275s\2245\234{\317"
+	.string	"\232jZY\355\275,\262\3325\220S\244\366\276fe\322\262\246\312t0\221\2468)k\356\025N\244m\3561[J]\206\\\262\253\324\350f\226\213\271\233q\215+F\016\007\021\030\317C\361\214%\315\2757PO\2315Qt\224z\251WDy\022\211\003\343G'\214\032\033fl\264\323\327\373Ja\305\224\233\261\213\"\037)?\240\264\3402\340\254\237\036(\030R\274\264a\254\036+,O\364S\343*le\237\370\352\231\214\271\313\366v\372`(\030[\2407\337f\350\375d\350a\026\270\3051\3251\325\305T\370\356\256no\250\037k1\260\026\203^\022\270'\275)\034\305%\212\256\354\346{\210\203\006\347W\2444\307\354\240 \341\250{\327"
+	.ascii	"\2603)\f\205U\340\0258i\2378\n\357\337+\214\204\202"
+	.string	"\243n\335\241\326\315\3146\277\242`/A^\334\365d\253U\320\327>\364u\f}=\245\237S\247\237\023]\341M\223\026P1n\246\263l.\364\366\244\325I\301\270\271\347\272\271jt\334\334\240-\257\232K\345\312Y\0205\225\307\264D\323.\324\247\263\367\326\226\346\230\232\213v\241\276\244sg\345"
+	.ascii	"q\213\223\266\346\262\271m\354\363\252\271\321\3374w\3162\211"
+	.ascii	"\303\342Kg\374!\347\251\321\344\"cL\034J\364\025\22601\267\314"
+	.ascii	"\035s\343n\230K\346\232\261\317{\346n\271ms\247\274\250\203\226"
+	.ascii	"#U\222D\317\3346kg\335\270@\210!\271\272r\331\254\210E\271\\"
+	.ascii	"0\026DM\215\260f,\212t\346f\271l\326m\351\334Z;b\230+\304)\362"
+	.ascii	"%\021\363\301\006\224/\334\233\205S6i\323\342\313\233\317\223"
+	.ascii	"\266\031P\327\313\357[O\033\251\272\263\233\257\033\356b\327"
+	.ascii	"\003\352\346\263\271]|\306\232b\254t\201\n\271\022\302\346\346"
+	.ascii	"\347l\375^\033\375^\234~\017N\277\327\246\337S\323\357\241"
+	.string	"]+Zoh\200I\242o\237wM-?ep\3518\233_\265\243\351\261\200\367\346\325u\366\245\337#\242\361\356\375\320\027\312\215b\237_\273R\256\223t\3562\353\203\r\351\343\346\367\2664\212\034\373\265\336{ZgMx\316\232j\244<\3154\320\365 \273\371>\271\260\003E[f\325i\261K\346\203\002\332\273\013\352\344\226\331\347mr\233\\$7\314\272qe\260g\364\202\206|F\247#K/\337B\031\213\322\\r\231\\\247}^\262\337$\366\213\217\2677SJ\223\354*\261_|P\316\255\334\361\341\224\203A\267\3676\216\361\200\243\363y\\\364yW\364yj\372\274(\3727\354\277G.2GKm\t\225\233\355\033\322/\030N\263\"U\367\324=;\244\302\006:Y\005M\354+\203\317\2330QG\214\\/\261'qd\327\353\026\271{lN\307\315D\212x\254l\304\211\335|\236\230\276\035K\312\360`\325"
+	.string	"\211\3327\\\327\n\213E:\252n\376\220\227\0162\223\345\331-K~\263l\254s\027"
+	.string	"G\026\260%\335\236\252\221A\251\007\016-\331\313\363\333\265\3345I\333\312\\\236\273\210\001\323FV\247\263\226\347-4\\\230\361r\323\306\245\205\313\\\032}\2412Zh\311\225+K\262\033+?P\300\242\205zT\251\222\255h`D\253H\335\016[\n]\232k\317V.4i$+\356\346\254\206\345\234\213^h\217\214W\216\025M-\304\226\004\205\346)ELd\232\fC\246\310}e\310\201\332hZ\345\264\347)v\367\307\032\324\r+{\314lQ\275\335\320AP=\236\233\366\231{\344(xj\271\265\024"
+	.ascii	"$M6rem\355f(\316\344\336\273(\247*\bU\335\315\027\312\322\357"
+	.ascii	"\240BF\362E\306H.\"f\206H\366:\023u\222\237\371,?\311h\366\231"
+	.ascii	"\3152\330\257T\036\362\"(\331,\177\225\2712\313a\231\211u[\002"
+	.ascii	"\355\244\024\272\250O\216\025O\034=\231\310\343\306\320d&Y,\223"
+	.ascii	"Y\267e\2249!G\312r\023\373\314L\314.\370\300!C7\326#[\322\223"
+	.ascii	"\326\202\306\212\233\263\323\226\265Q\355pS\362\263\202\210]"
+	.ascii	"\327\3159\311\3432\013d\013\252\265\214\302\224\260-[\364\203"
+	.ascii	"\330\364\203\316\362\021\r&j\203K\231~\220S?(L?\250\210\376\263"
+	.ascii	"W.\302+\313\262\206K\021\213\366eKU"
+	.string	"\224\020}\267%\352\345 YH\336\002K\353\201\326E\201\037]\320n\316)\3346!M+ \2761]\317%7?\377\340\241\335\255\221qs\366\241\245\202rl\260cC\n\016\0327?\373\370\263V\346:\341\316\316\315\315\037c\211z\227\016\351\371\004\\\254D\225\260\320ASI\026\211\315Y\317:rV\336q\2278\261|VY56\360\300\321\262Rs\212\331\370r\003\2759\343\3109\362\326\257\243S\245\352K\215\233\037\204\324\317\314\035\256\267 Fn\276\331\306\363\215_'GL\231|\326\351g\032\271\206\235\226*,\326\350\347\031&0\223\003\311\315Y\206\226\002\002\263\201N\031\2628 7?\313\370\363\213k\225\227\037\270U4\226r7g\0309\306\3632\243\260\363\262\003\346\336Py\371\223\301t\b9\353\345\003\271i\237\035\352e-\244g\027W\210Y[\333\315>@K\264P\\\276z\276\312X:{\027"
+	.ascii	"G\232\2348G\2168\311X\027\332S1\306\205\204\251\207\264$e\026"
+	.ascii	"6SU]\005Y\0066@1\364\201\252\202\306\2226\330<\225\247zBrt\315"
+	.ascii	"\321\305\201\223S\336| )=d\227\364\254\"K]h\336f\033J\213\003"
+	.ascii	"7+\350\377\234\321@TI\317Q\267\317\034\205e\270\360\241e#f\276"
+	.ascii	"\274\254i\035\257\244gdF\036\n\302L#\233bb<P\302@\211\363\324"
+	.ascii	":iI\307w\366\211\357\356\233dZ\022\275\321\242<\311\264\016W"
+	.ascii	"\322\261\235\335\327@\230\351]v$,\252C5\344\013\356K\353\324"
+	.ascii	"H:\206\003g\347\004L9\030\226J\01615 \032\210-\351\370\315\355"
+	.ascii	"\023\277\3016@,\31162'N\031'\355'L\f[\n7\377\247\207\036\232"
+	.ascii	"K\302k,n\343\346P\fI\240M\265BH\023\207\376\017\f1I8j\361\234"
+	.ascii	"\232C5RIA\213']\321\037-\375\237*}\350\355\0267,\310\334<\244"
+	.ascii	"L:F\023\207\345\260\226F*5\332\tnD}v\372\2763Zh\2052e\360\231"
+	.ascii	"\"5K\272\346\350z\224*\204t\2319>\343\023[\213\276\321\372\255"
+	.ascii	"\375\240\233\242w\320\222\216\307<\361\230k\206\374Ac\312\301"
+	.ascii	"\320\322&\006\226\231\266\300\305\013\026\343\005\207\031\301"
+	.ascii	"\002\226!]st>0,1]`\216\303X2\236\023\252\032M8\353\004\203\006"
+	.ascii	"\007\334\027;\303J\031\362\355>\271\300\303\2723\222|\373\005"
+	.ascii	"\2370i\232\230i\352\234\273\244\343.]\254\035\b.f\266B\312}\035"
+	.ascii	"\271F\300\312R`j^\222\244\343-[p\214\234$\333Y&\324]-\363\325"
+	.ascii	"\033\266.7\337G\245\265\221\244\343\2666\213\006b\311D\316a\030"
+	.ascii	"\222C\356\213n\357+\033x[m\334 q\323DC\324\256\206"
+	.string	"\261\350\275\367\231\273h\025\330\326\023|\345\030K\316\022\254\252/\230mg\316\013\0301\230\r[\331qA\246\311\032\021\236\0178.\240\334\274vc\340,A\256\2509\323AM\222\216\251P\271^E\316\255\305\003\235\3225G\347\243\344\f\247\235a\250\005\026h8\r\rC5hCv\315\321\351\260/k\314\260\224c\350\205\372\320\210\211*o\306Q.\234\255.,7c(\207\376HY2\006\310\241\326\210\024$g7\337\247\206~\317\234\023l\346\304\302\335\023l\366\344GS\312\f\314\221,\372=ad\270\214L\005\023\\\306\344\252id\321\224\254\2569:L\345\013I\223\233\337\303\245\337s\245\201\344\222\216\235N\374\002\204\006\2524]st8\314\n\033\\\350\364\305\304\256Zoo\353db)\211\250\222\340\261$W\315\006\301aq\204u\030B\211(\314\200\bDDaj\324Q\207\300\024L\306\242\t\243\332\024"
+	.string	"\"&\247\021\304\242\320\211IX\201\272\252Cc\t\3410\005\341(\2740L\201\307UX\342\310\211\250\224"
+	.ascii	"\024ND\3410\001\035x\360\363\340\003\212#5\3504\004\022\205G"
+	.ascii	"\306\243\323\321\321\211\242qi-\022sL\244\3520\257Gb\021\310"
+	.ascii	"3\261\022\205\306a\217\250\002-\255)\323\021\261\310"
+	.string	"\304\004"
+	.string	"\021>\"\250\303\022\351Q\030\fZ\233\234\212F\245_jL\233\2164X\325#\017\321\304\345\035\177=\353\217\250\324\304#*5a\365\004\3411\037\217\2521\030Ls\214k\023\276O\n\343z\024*\251&\374*\b\252D%\3410\315\t\252G\247L,\nW\240z\314y\272\246A\343O\251\311\310gL\227\200\371\267\252G\325\004\245&\001\254*\0040h\016\214\202\303\342\217\003Bc\372\304\343A2Z\217\351\320\207\002u\230\002G\fU\f\200\300\3444\002\bLy\230\234F"
+	.string	"\201\351N\356q0Z\207!\200\300T\017\325'\334\301h\250>\361|\035\030\2218:\025\205O\252\261\t(\250\256)\223p=\206"
+	.string	""
+	.string	"}\f\032\323\023\304\023E\021JD!0\025a=:\031\227H\034\205\025\374\204\340\230\222\360$\\\201!\200F\013_2R\022\232 :\035w\214N@\242\235\fB\034\240\202\224X\034!"
+	.string	"!uM\327\021\301&\247\013D=\034\030\255\306\264\311h\350\351gU\217<+QeZ\217N \b\206H/\344\254\303\020\3531\204^\220\23021\351"
+	.string	"y0\n\202p\024\nE \305*\004\026\207*\006\214E\243Q\365\rS\341*$\n\207\276d\204\302x\204\3028\224\256\251\b\240\261\2672\251\3531\305\210\n\016\f\016\213#\254\303\020\306\342Z4\n\327\241\023\t)\206MM)\005\007\n\215*QU\322\357\300\203\004x\360\001E\316?0\200\003\006p\320\373\007\006 !1\300\003$}\017\220\360\232\026\207&x\353\272\376\216\027P\231\204\253V\177G\245t(\202\032,\222\020\024\244\032\323\023Ac\272\364\03361\245A\352QX$\372\206\352\223\t\340\217\247x$\252\307\343\257\267~\311\310\250\256*\323\221\320\030\034"
+	.ascii	"\b\026\3245\035:\001\207)P\347\370{RE\350\254N:E:T\203\277&'"
+	.ascii	"\275\256\306t=j\343Z\002\220\350$BS\005|\232\234~\253\252\324"
+	.ascii	"{R\203x\035\206(\032\323\017r\326\037\207\016\252\321iM\215j"
+	.ascii	"\023\223J\242hLK\374\254\277\243Q\035:\205\260\246D_2rb\022\016"
+	.ascii	"\207Ec^\002\256\302&\336\2114\005>\252N\303\364\251w\"5\342\365"
+	.ascii	"KFAaS\221\321w\374\251C\241\211\242\261"
+	.string	"\204\240\260\251\347C\t\367C\004\356\007\021WmJ\261\376\214\352:\024\232\b\3529a\351g\242i\270s\302\222\317\204\211\342\352\004\374-\001\327\"\361'\264\022U\240Q-\241\204&\247 Q\230\201\nxN\244\033`r\032\021\0246\371V\242S\021\370S\225R\243\372\224\376\210G\242\332\304T\004!(,aMK<\r\021\205$\254!\202\302& u\250D\f\361\223b\025>\tW\341\221\250\216\030\252O\352\020H\037U\343\022\tu\270\256E\343\022\t\n\210\302\024\002\306\342\232\032U\241\205\242pMM@\221\016U\023\216Bj\006V\242\260\330\264\252#\230\214\352\032\034Z\205L\302\t\fU 0\204\272\246&\234HS\004}\t\003\225\230\016\233\214\302\024h\035\246?%\242\360DPE!4\001\200\365\347\001\322J\024\346|\311\350\b4\036\001-x\261I5\036\255\305\242\361\210\347\370S\022\232 \026A8\202"
+	.string	"4\n\351\236 1-\021L\325`\320\372\373\260\022\205N9/\201\004\344\360\241C\t$\243\242/`\001 `\270"
+	.ascii	"\005 \240\201Fj\320i\025\256\303\364h]R\022\016M\034\021\205"
+	.ascii	")\323\021\320x<2\302\240*\021\323%\340o=\246&~\301aq\351\267"
+	.ascii	"\016S\013\303b\361\203\037/\250\036\215\352\223j\374\r\213\306"
+	.ascii	"\225X\004\376N\244),\234(\213\227\344\251\340%\257Z\007a\026"
+	.ascii	"\266\264\023{=9\022\006\352-\307\t\235\024-d\266\"&F\212\222"
+	.ascii	"\267\261\f\025\312\304%\357\035\266\261\305L\033#q2V\257\252"
+	.ascii	"J\022\025\3542\230\017\346\252x\324i\361h!\253\263\002\007CI"
+	.ascii	"(\tc\267B\236\342\203a\303\r\2057\326\256\027C\005\034"
+	.string	"4\272\030\372\211\306\215\312\r\217!R\302nv\212aa\001a\262\301;\336n\244q\273\231\b\216\\^#\227\325X\245r\016\001J\336\212\324\321\355\345\213\f\177\236{V\3635\236\324\2315o7\3474_\323p\236J\340n\316\321\257\345\264q\321\201\303\302\022\r~\361\023\346\245G2.\357\200\336h\263q\263\320\0133\277\231\253f\201\234Qg\336DwT\374`\322\243N\013\261 C&c\365\204\3548iI(V\230a\264\020\224\0301W\255\250\bS\016\206\236s\372\250\"E\013\321\200\203\313`,\331\306\262A\234q\322t\324m\211\002\2433\244H\204\020\250\323\222\323q@\262\004Y\216)\305\220)\242!M\032\003\363\023@@X\\2\036N\230=\037\023\300\224I\304\251\226\225\f\321\314\214\024\024\024\224S\310\316\032A1\254OV\305\257 \316'M\032\276L<\031\002%oV\177\331\255r$\017\304\032"
+	.string	"fk\220_\037\344\036\374\266\272]\026ZH]"
+	.ascii	"\202\016Tt\3002\362S\354aL@`\211\251\264\232F\307\340\n\352\215"
+	.ascii	"1\034`\363\367X~kE\262\021\027\177e\374\257I\033\202\025\240"
+	.ascii	"\0049\236\275\354yr\353\0333&\323f\270GXk\016\206klm\034\212"
+	.ascii	"~"
+	.string	"\233\370\307\212\2434r$\21601\021\212\013z\367\004\r\3256\rM\372\004\303\277HAj\257\242\252z\204\250\004\204T\037\037\227t\265=\360\260\027\006(\353\026\324\375Y\273X\3263\254\304v\314\312d<p\230\324\325\345\201\332l\215\177\265\374+q\331Z>\377\r\034\206\322\352\3430\250x\232\032\265NU\305\330 \225\004&xQ\345\0013\364\3332}9\221KC\033G\270\234\005-\352\373\370\306\205\016\222b\274\002\342\326\263ml7\313\346o\026\037\302\310\367\034-\002\243\267\261\324\250\310\273G\b\020\233\332\250\230ua\231\331j\017\2643?\314\227\016#i8\206kc\262\223\t\024\332\252\332\nGD\211\224F%\332\250\376\236\036$\n,\026\221\310]\327\245\363\024\360mo\212\214>\306\226d\373tu\212a\373\222CFvKZ\353m\366\241\033@;\321\253_M\245,)\315D\327\232\036\nR\202,\344"
+	.string	"p\314\023\241\214\031\324(\\\036\266R$E\336P\271\230T\317\331\030d\r)\013\037_"
+	.string	"\255\357w\034W\202\360{\370a\236\347Ms\032L<\025\335A\310\004\2174"
+	.ascii	"\236(J[\326\0245\274\366\317\340\007\r\250\367\334w\361\317\361"
+	.ascii	"\321\267$\nO\365\332\331\223\252\277\214\2768\013\244G\021`\317"
+	.ascii	"\247\244\257\250\213.\232\222-\320\247\2502^\203\345\244*\361"
+	.ascii	"d\211\237\002\223\271u$\343L\rR\310\006\366\317\212\302\201\225"
+	.ascii	"\b^\327\336\236\004\202\344\244\244\211\263!K\246\305P.\237\314"
+	.ascii	"I\005\341\236\3428d\256m\261\003d\356\036t\375\324\301\344\235"
+	.ascii	"\222\366U\315\376\212\215\265u\270\274\253\336\223\217\263r\274"
+	.ascii	"\337u\217\225\245\275\376\245\275\211\027p\302\026\303\223\252"
+	.ascii	"\315\232\017\274\250\276\244\020\204\230\255\007T\234$\006}\213"
+	.ascii	"Ij\034G\304\007$\372+\233C\207\375{\273\353B6\367\363\007\344"
+	.ascii	"A\374\031\223\254\211\241D\224~\030\030\271=u\033\017\022\324"
+	.ascii	")YXI\005O}\006j\246\217W\322F\225j\241J\256\237c\2435\356\211"
+	.ascii	"\025.\245\345`\023\237\017Cx\235\363\305\322)6\017\226U6Y\214"
+	.ascii	"\243\241\324\330\344G\200rrFV"
+	.ascii	"\262U\215Z\231\033\340_?\337\340\304\251\224\304p\3134\2554\001"
+	.ascii	"\204\n\276\313q\331\177BM\036\272xd>\326\177\263\310\303\317"
+	.ascii	"\213\220O\361\263\225\332k'\375\333W\275\307\256_Yog\302)l\230"
+	.ascii	"O}6\026_\005\377\2002\023M\377\007\244\353LU\316\334%FW\301B"
+	.ascii	"\256D\021\021\203-n\333A\270\243A\3139\200\216\033?\0321\367"
+	.ascii	"Fo:\201\331\364 \335\3175\211\334\2760:\256\357Wl\251B\227\322"
+	.ascii	"\3512\024\016.\004[\262\317\t\342\363\261.km\244\n\2144\023\n"
+	.ascii	"\304\323OP\317\250k=\0347\365\257\034\363Q>B1\225\367"
+	.string	"\251\212Q\021\247\333C\305\177\327\363\247q%HSbv\274\313\314:\320\244d:\270)\354\230\332\217\351N\244\334\030\337\031\232=@\027\2568L\264Mz\\`f\304'\031\336\332\234\006\227\201\3760@^\304\334\022+\3547\325=\213kT\235L\372\311\245\266\222\370\210\341Y\260\363\204\035\254\332\315\r\355\305\255*\247\317\236\3079\303]0\305\356\243\210\317\002\272\026\206\245?!\222\304o\254\025\256$\253\024\326\344NF\022\237y\326\317\221\036\242\331sH\233\330\3644Y\030\341\323\2167_N[Y\321yN\243]\325\227-\211\032\305H&\317\250\232\202\267Av2\234>a\200Z\331w\303\251\025\"\235r\304\216\210\035\037>\f\017\367c\214\363\232\353\304X\313\344\325a\364\301\246\245)Hk\224\220\226\376!\237R$\211\262d\331\375-Eb\037\260N\341\222\304VQ\261\270r\211)\025\245\001\265Wlk\206\372"
+	.string	"\037<\230\355p\257\212\177\210\217j\354u\332\364\212 \377\230\346\371_\214c\362\020\315\312\005G4\027\352\256,\300\264\323\332\301\244\271\306\376\373Y\027\022x,R\320\350\3171:R\265\272\326\253M\341\216Uh\216\260\276h\256v;\"\2245\0222`\225e\337\021}\023\376\364F$\\pv\363\361\360\307\226\251\322&X\"\220G\300o@\276\207\310]\"6\254\201\246\302I\222\207\261g\260\360I\3566\221\263\225\204\3752n\342w!\337\237.\032\304\262*L\362\233,;\374\232Hb\210\264\311\374\177v\241\243\":\n|F\340"
+	.string	"'g\205l\202L\304\375\322\207\364\205\371&u\300\373"
+	.string	"\020\227\320\215\362\234!\237}?\225\rr!\312,{\3101\205^9\323\317 \227\033\202f~\374\275*\f\fXa\370\272\360\025\177\260c\215\203b\254\022G\242\t~\373\207\017\206g/z\017\223V\334\226*\202\314\376\243\314y\310(\250\307\366B\001\347"
+	.string	"WH\301<<\275\207 \020\215\036{\306\206P&M\232\3138\377\016\312\336v\223rk\252\222\247_\313faC\214\2456C\025\234dsnA>\306\225\017,_\220\366#\305d]\351\244\020\027\242\316\3511\027A'x\333\222s\344\230\235\200\270ZENC}^\330\262\340[\345RY\337\001\244u\266"
+	.string	"\236A1\223"
+	.string	"\374'\177kA3\353\256\034\203gf8\252\264Y\351\275n\245\0378\331z708\355\377\r29\226b9\207y6D\310w\r\276\255-Q\300\347\374"
+	.ascii	"\243'\020\"\326\313\261\277\034C\027\035\247\225\223w\337\346"
+	.ascii	"\201C\207\321S\236|=\030\273\021\361\1773E\341\013\3011>ky?\233"
+	.ascii	"\2008\237\357\\\t\3719\341%\035t=\332\357\271\244hwF\226-}jO"
+	.ascii	"z0\235S\223F?\023\264\177\2238\005\273\322!\027\240$\2405\022"
+	.ascii	"Ci\345\371\273\323\013G\334\201<\360\231\017c \265+\034\034\250"
+	.ascii	"\241\002\tZd\037\253<\246\243\264\322\020\032\266!\222\366W\216"
+	.ascii	"C\362\302\013a:\201\347\364\207jZAa\3017\334\214|7\233\024\302"
+	.ascii	"ya\225Q\340y\223\215\266\232\\U\b0\214FP\214&l\020U0db\256|\232"
+	.ascii	"\345t'0\320\204M\322\371\353P\001\326{GM\237\236\324\325\nw\013"
+	.ascii	"ffrb:a\271\273\3448\001\210j1\314\226\277A\351\234\375o\254\225"
+	.ascii	"\305\341\005\001\200v/B\234\232\007w:\350\013\242\2261L\213t"
+	.ascii	"\255\323\022\261\277o}r{H\243Y6\267\223)\214#Y\266(@\260[A\326"
+	.ascii	"\211\253b\336\357\315S2fx}W\256\037=\317\333\333\253\271W?\317"
+	.ascii	"\343zi\276\325\276\312\321\271\265\034\225\177\312\217\207\343"
+	.ascii	"W\300_\002}\323-\025\274Q{\247\337\244\274\231\026\347\307\354"
+	.ascii	"M\323\373\365\354\032\261\037\341\271\013OA\255[k\\\236c\030"
+	.ascii	"?-\3635:g\212\327btx\371\337\235u\223_\341\034\341\307\337R\\"
+	.ascii	"\300\233\342\333\334\346\353\241\367\\:Ki\"\311{\365\300`\220"
+	.ascii	"V\033(\376\247\233\352\317D:Y\345\276\262%\315\366\376\363\345"
+	.ascii	"\333\360\037\226\267\275L\303\016\3262E\230\001x\373#F\317\242"
+	.ascii	"\236\204-l=Zvl\357\361|\206\273\326\327\240|D}e\217~\267\327"
+	.ascii	"\260+J\007fJs~\366t\226\024\265l\257\332\374\215\276\267\251"
+	.ascii	"Kj\270\263\242Q\217\365\232YM\037?l\272!\355\317\227\234\354"
+	.ascii	"\247\265\037\223\214 \366\\`\260\331\236\344r\344e\355\255F\373"
+	.ascii	"\222\277\242l\263\262\323\377K)C\301\346\365i\263\317\202p+\003"
+	.ascii	"\375\215\365c\345\022\257\325pW"
+	.text
+	.section	.gnu.lto_.symtab.6cb24e0035b0842,"e",@progbits
+	.string	"errorVelocityI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"AltHold"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"altHoldThrottleAdjustment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"setVelocity"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"velocityControl"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"airplaneConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"configureAltitudeHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"applyAltHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"updateAltHoldState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"updateSonarAltHoldState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"isThrustFacingDownwards"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"calculateAltHoldThrottleAdjustment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"calculateEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"vario"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"altitudeHoldGetEstimatedAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"pgResetTemplate_airplaneConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"airplaneConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"accVelScale"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6cb24e0035b0842,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,12092 @@
+	.file	"failsafe.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/drivers/resource.h"
+	.file 6 "./src/main/fc/rc_controls.h"
+	.file 7 "./src/main/fc/runtime_config.h"
+	.file 8 "./src/main/flight/failsafe.h"
+	.file 9 "./src/main/io/beeper.h"
+	.file 10 "./src/main/rx/rx.h"
+	.file 11 "./src/main/flight/failsafe.c"
+	.file 12 "./src/main/drivers/system.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	failsafe.c.13860830
+	.weak	failsafe.c.13860830
+failsafe.c.13860830:
+	.long	0xa22
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF1807
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1551
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1552
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1553
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1554
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1555
+	.uleb128 0x3
+	.long	.LASF1556
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1557
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1558
+	.uleb128 0x3
+	.long	.LASF1559
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1560
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1561
+	.uleb128 0x19
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1562
+	.uleb128 0x3
+	.long	.LASF1563
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1564
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1565
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1566
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x3
+	.long	.LASF1567
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xab
+	.uleb128 0x4
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0xfd
+	.uleb128 0x6
+	.long	.LASF1568
+	.value	0xfff
+	.uleb128 0x6
+	.long	.LASF1569
+	.value	0xf000
+	.uleb128 0x6
+	.long	.LASF1570
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1572
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1573
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xf
+	.long	0x109
+	.uleb128 0x1a
+	.long	0x119
+	.uleb128 0xa
+	.long	0x8a
+	.uleb128 0xa
+	.long	0x70
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x8
+	.byte	0x4
+	.byte	0x35
+	.byte	0x5
+	.long	0x138
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x11
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x138
+	.byte	0
+	.uleb128 0xb
+	.long	0xfd
+	.uleb128 0xc
+	.long	.LASF1690
+	.byte	0x20
+	.byte	0x4
+	.byte	0x30
+	.long	0x189
+	.uleb128 0x12
+	.string	"pgn"
+	.byte	0x31
+	.byte	0xb
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1574
+	.byte	0x4
+	.byte	0x32
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1575
+	.byte	0x4
+	.byte	0x33
+	.byte	0xe
+	.long	0x189
+	.byte	0x8
+	.uleb128 0x12
+	.string	"ptr"
+	.byte	0x34
+	.byte	0xf
+	.long	0x18e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1576
+	.byte	0x4
+	.byte	0x38
+	.byte	0x7
+	.long	0x119
+	.byte	0x18
+	.byte	0
+	.uleb128 0xb
+	.long	0x9f
+	.uleb128 0xb
+	.long	0x189
+	.uleb128 0x3
+	.long	.LASF1577
+	.byte	0x4
+	.byte	0x39
+	.byte	0x3
+	.long	0x13d
+	.uleb128 0xd
+	.long	0x193
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1578
+	.uleb128 0x4
+	.long	0x30
+	.byte	0x5
+	.byte	0x14
+	.long	0x2d1
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x4
+	.long	0x30
+	.byte	0x6
+	.byte	0x18
+	.long	0x39d
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1676
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x1c
+	.long	.LASF1808
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x6
+	.byte	0x41
+	.byte	0xe
+	.long	0x404
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x1
+	.uleb128 0x1d
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	0x30
+	.byte	0x6
+	.byte	0x50
+	.long	0x41c
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1671
+	.byte	0x6
+	.byte	0x53
+	.byte	0x3
+	.long	0x404
+	.uleb128 0x4
+	.long	0x30
+	.byte	0x7
+	.byte	0x15
+	.long	0x44c
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1675
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1677
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x4
+	.long	0x30
+	.byte	0x7
+	.byte	0x22
+	.long	0x4a9
+	.uleb128 0x1
+	.long	.LASF1678
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1679
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1680
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1681
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1683
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1684
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1685
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF1686
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF1687
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF1688
+	.value	0x400
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1689
+	.byte	0x7
+	.byte	0x2e
+	.byte	0x3
+	.long	0x458
+	.uleb128 0xc
+	.long	.LASF1691
+	.byte	0xa
+	.byte	0x8
+	.byte	0x20
+	.long	0x510
+	.uleb128 0x2
+	.long	.LASF1692
+	.byte	0x8
+	.byte	0x21
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1693
+	.byte	0x8
+	.byte	0x22
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1694
+	.byte	0x8
+	.byte	0x23
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1695
+	.byte	0x8
+	.byte	0x24
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0x8
+	.byte	0x25
+	.byte	0xe
+	.long	0xab
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1697
+	.byte	0x8
+	.byte	0x26
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1698
+	.byte	0x8
+	.byte	0x27
+	.byte	0x3
+	.long	0x4b5
+	.uleb128 0xd
+	.long	0x510
+	.uleb128 0x7
+	.long	.LASF1699
+	.byte	0x8
+	.byte	0x29
+	.byte	0x19
+	.long	0x510
+	.uleb128 0x4
+	.long	0x30
+	.byte	0x8
+	.byte	0x2b
+	.long	0x55d
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1706
+	.byte	0x8
+	.byte	0x32
+	.byte	0x3
+	.long	0x52d
+	.uleb128 0x4
+	.long	0x30
+	.byte	0x8
+	.byte	0x34
+	.long	0x581
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1709
+	.byte	0x8
+	.byte	0x37
+	.byte	0x3
+	.long	0x569
+	.uleb128 0x4
+	.long	0x30
+	.byte	0x8
+	.byte	0x39
+	.long	0x5a5
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1712
+	.byte	0x28
+	.byte	0x8
+	.byte	0x3e
+	.long	0x64e
+	.uleb128 0x2
+	.long	.LASF1713
+	.byte	0x8
+	.byte	0x3f
+	.byte	0xd
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1714
+	.byte	0x8
+	.byte	0x40
+	.byte	0x9
+	.long	0x1a4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1715
+	.byte	0x8
+	.byte	0x41
+	.byte	0x9
+	.long	0x1a4
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1716
+	.byte	0x8
+	.byte	0x42
+	.byte	0xe
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1717
+	.byte	0x8
+	.byte	0x43
+	.byte	0xe
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1718
+	.byte	0x8
+	.byte	0x44
+	.byte	0xe
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1719
+	.byte	0x8
+	.byte	0x45
+	.byte	0xe
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1720
+	.byte	0x8
+	.byte	0x46
+	.byte	0xe
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1721
+	.byte	0x8
+	.byte	0x47
+	.byte	0xe
+	.long	0xb7
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1722
+	.byte	0x8
+	.byte	0x48
+	.byte	0xe
+	.long	0xb7
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1723
+	.byte	0x8
+	.byte	0x49
+	.byte	0x15
+	.long	0x55d
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1724
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x1b
+	.long	0x581
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1725
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x3
+	.long	0x5a5
+	.uleb128 0x4
+	.long	0x30
+	.byte	0x9
+	.byte	0x17
+	.long	0x6ea
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1748
+	.byte	0x9
+	.byte	0x31
+	.byte	0x3
+	.long	0x65a
+	.uleb128 0x13
+	.long	0x93
+	.long	0x706
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1749
+	.byte	0xa
+	.byte	0x50
+	.byte	0x10
+	.long	0x6f6
+	.uleb128 0xc
+	.long	.LASF1750
+	.byte	0x2c
+	.byte	0xa
+	.byte	0x76
+	.long	0x864
+	.uleb128 0x2
+	.long	.LASF1751
+	.byte	0xa
+	.byte	0x77
+	.byte	0xd
+	.long	0x864
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1752
+	.byte	0xa
+	.byte	0x78
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1753
+	.byte	0xa
+	.byte	0x79
+	.byte	0xd
+	.long	0x9f
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1754
+	.byte	0xa
+	.byte	0x7a
+	.byte	0xd
+	.long	0x9f
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1755
+	.byte	0xa
+	.byte	0x7b
+	.byte	0xd
+	.long	0x9f
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1756
+	.byte	0xa
+	.byte	0x7c
+	.byte	0xe
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1757
+	.byte	0xa
+	.byte	0x7d
+	.byte	0xd
+	.long	0x9f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1758
+	.byte	0xa
+	.byte	0x7e
+	.byte	0xd
+	.long	0x9f
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1759
+	.byte	0xa
+	.byte	0x7f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1760
+	.byte	0xa
+	.byte	0x80
+	.byte	0xd
+	.long	0x9f
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1761
+	.byte	0xa
+	.byte	0x81
+	.byte	0xd
+	.long	0x9f
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1762
+	.byte	0xa
+	.byte	0x82
+	.byte	0xd
+	.long	0x9f
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1763
+	.byte	0xa
+	.byte	0x83
+	.byte	0xe
+	.long	0xab
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1764
+	.byte	0xa
+	.byte	0x84
+	.byte	0xe
+	.long	0xab
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1765
+	.byte	0xa
+	.byte	0x85
+	.byte	0xe
+	.long	0xab
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1766
+	.byte	0xa
+	.byte	0x86
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1767
+	.byte	0xa
+	.byte	0x87
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF1768
+	.byte	0xa
+	.byte	0x88
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1769
+	.byte	0xa
+	.byte	0x89
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF1770
+	.byte	0xa
+	.byte	0x8a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1771
+	.byte	0xa
+	.byte	0x8b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF1772
+	.byte	0xa
+	.byte	0x8c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1773
+	.byte	0xa
+	.byte	0x8d
+	.byte	0xe
+	.long	0xab
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1774
+	.byte	0xa
+	.byte	0x8f
+	.byte	0xe
+	.long	0xab
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1775
+	.byte	0xa
+	.byte	0x90
+	.byte	0xe
+	.long	0xab
+	.byte	0x28
+	.byte	0
+	.uleb128 0x13
+	.long	0x9f
+	.long	0x874
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1776
+	.byte	0xa
+	.byte	0x91
+	.byte	0x3
+	.long	0x712
+	.uleb128 0xd
+	.long	0x874
+	.uleb128 0x7
+	.long	.LASF1777
+	.byte	0xa
+	.byte	0x93
+	.byte	0x13
+	.long	0x874
+	.uleb128 0x8
+	.long	.LASF1785
+	.byte	0x36
+	.byte	0x18
+	.long	0x64e
+	.uleb128 0x7
+	.long	.LASF1778
+	.byte	0xb
+	.byte	0x38
+	.byte	0x1f
+	.long	0x51c
+	.uleb128 0x1e
+	.long	0x521
+	.byte	0xb
+	.byte	0x38
+	.byte	0x50
+	.uleb128 0x7
+	.long	.LASF1779
+	.byte	0xb
+	.byte	0x38
+	.byte	0x81
+	.long	0x19f
+	.uleb128 0x1f
+	.long	0x8b0
+	.byte	0xad
+	.uleb128 0x20
+	.long	0x89c
+	.byte	0x3a
+	.byte	0x18
+	.uleb128 0x21
+	.long	.LASF1809
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x6
+	.long	0x8db
+	.uleb128 0xa
+	.long	0x6ea
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1782
+	.byte	0x6
+	.byte	0xc3
+	.byte	0x5
+	.long	0x1a4
+	.uleb128 0x22
+	.long	.LASF1796
+	.byte	0x7
+	.byte	0x4c
+	.byte	0x6
+	.uleb128 0x15
+	.long	.LASF1780
+	.byte	0x45
+	.long	0xab
+	.long	0x903
+	.uleb128 0xa
+	.long	0x4a9
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1781
+	.byte	0x44
+	.long	0xab
+	.long	0x917
+	.uleb128 0xa
+	.long	0x4a9
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1783
+	.byte	0x6
+	.byte	0xbb
+	.byte	0x12
+	.long	0x41c
+	.uleb128 0xe
+	.long	.LASF1784
+	.byte	0xc
+	.byte	0x1d
+	.byte	0xa
+	.long	0xb7
+	.uleb128 0x16
+	.long	.LASF1794
+	.byte	0xa6
+	.long	0x971
+	.uleb128 0x8
+	.long	.LASF1786
+	.byte	0xac
+	.byte	0x9
+	.long	0x1a4
+	.uleb128 0x8
+	.long	.LASF1787
+	.byte	0xad
+	.byte	0x9
+	.long	0x1a4
+	.uleb128 0x8
+	.long	.LASF1788
+	.byte	0xae
+	.byte	0x9
+	.long	0x1a4
+	.uleb128 0x8
+	.long	.LASF1789
+	.byte	0xaf
+	.byte	0x12
+	.long	0x6ea
+	.uleb128 0x8
+	.long	.LASF1790
+	.byte	0xb6
+	.byte	0x9
+	.long	0x1a4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1791
+	.byte	0x9e
+	.uleb128 0x9
+	.long	.LASF1792
+	.byte	0x96
+	.uleb128 0x9
+	.long	.LASF1793
+	.byte	0x90
+	.uleb128 0x16
+	.long	.LASF1795
+	.byte	0x8b
+	.long	0x99a
+	.uleb128 0x23
+	.long	.LASF1810
+	.byte	0xb
+	.byte	0x8b
+	.byte	0x23
+	.long	0xb7
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1797
+	.byte	0x86
+	.long	0x1a4
+	.uleb128 0x24
+	.long	.LASF1811
+	.byte	0xb
+	.byte	0x7e
+	.byte	0xd
+	.long	0x9bd
+	.uleb128 0x25
+	.uleb128 0x26
+	.string	"i"
+	.byte	0xb
+	.byte	0x80
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1812
+	.byte	0xb
+	.byte	0x74
+	.byte	0xd
+	.uleb128 0x10
+	.long	.LASF1804
+	.byte	0xb
+	.byte	0x6f
+	.byte	0xc
+	.long	0x1a4
+	.uleb128 0x9
+	.long	.LASF1798
+	.byte	0x6a
+	.uleb128 0xf
+	.long	.LASF1799
+	.byte	0x65
+	.long	0x1a4
+	.uleb128 0xf
+	.long	.LASF1800
+	.byte	0x60
+	.long	0x1a4
+	.uleb128 0x28
+	.long	.LASF1801
+	.byte	0xb
+	.byte	0x5b
+	.byte	0x11
+	.long	0x55d
+	.uleb128 0x9
+	.long	.LASF1802
+	.byte	0x53
+	.uleb128 0x9
+	.long	.LASF1803
+	.byte	0x46
+	.uleb128 0x10
+	.long	.LASF1805
+	.byte	0xa
+	.byte	0x93
+	.byte	0x44
+	.long	0xa0f
+	.uleb128 0xb
+	.long	0x880
+	.uleb128 0x10
+	.long	.LASF1806
+	.byte	0x8
+	.byte	0x29
+	.byte	0x56
+	.long	0xa20
+	.uleb128 0xb
+	.long	0x51c
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.file 16 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 18 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 19 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 29 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1d
+	.file 30 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 31 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x1f
+	.file 32 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 33 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x21
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x4
+	.file 34 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 35 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.file 36 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 37 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xc
+	.byte	0x4
+	.file 38 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x26
+	.file 39 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x27
+	.file 40 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.file 41 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x29
+	.byte	0x4
+	.file 42 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 43 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2b
+	.byte	0x4
+	.file 44 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2c
+	.file 45 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 46 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x2e
+	.file 47 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 48 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1474
+	.byte	0x4
+	.file 49 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 50 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1478
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x9
+	.file 51 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1522
+	.byte	0x4
+	.byte	0x4
+	.file 52 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF807
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF768
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF908
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF945
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF949
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF956
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1061
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1065
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1067
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1093
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1105
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1473
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1477
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1504
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1513
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1550
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF1813
+	.long	.LASF1814
+	.long	.LASF1815
+	.long	.LASF1816
+	.long	.LASF1817
+	.long	.LASF1818
+	.long	.LASF1819
+	.long	.LASF1820
+	.long	.LASF1821
+	.long	.LASF1822
+	.long	.LASF1823
+	.long	.LASF1824
+	.long	.LASF1825
+	.long	.LASF1826
+	.long	.LASF1827
+	.long	.LASF1828
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x35
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1829
+	.byte	0xc
+	.long	.LASF1830
+	.byte	0xc
+	.long	.LASF1831
+	.byte	0xc
+	.long	.LASF1832
+	.byte	0x3
+	.long	.LASF1833
+	.byte	0x4
+	.long	.LASF1834
+	.byte	0x5
+	.long	.LASF1835
+	.byte	0x5
+	.long	.LASF1836
+	.byte	0x6
+	.long	.LASF1837
+	.byte	0x7
+	.long	.LASF1838
+	.byte	0x8
+	.long	.LASF1839
+	.byte	0x6
+	.long	.LASF1840
+	.byte	0x4
+	.long	.LASF1841
+	.byte	0xf
+	.long	.LASF1842
+	.byte	0x10
+	.long	.LASF1843
+	.byte	0x10
+	.long	.LASF1843
+	.byte	0xf
+	.long	.LASF1844
+	.byte	0xc
+	.long	.LASF1845
+	.byte	0xf
+	.long	.LASF1846
+	.byte	0xf
+	.long	.LASF1847
+	.byte	0xc
+	.long	.LASF1848
+	.byte	0xc
+	.long	.LASF1849
+	.byte	0xe
+	.long	.LASF1850
+	.byte	0xc
+	.long	.LASF1851
+	.byte	0xd
+	.long	.LASF1852
+	.byte	0xd
+	.long	.LASF1853
+	.byte	0xc
+	.long	.LASF1854
+	.byte	0xc
+	.long	.LASF1855
+	.byte	0xc
+	.long	.LASF1856
+	.byte	0xb
+	.long	.LASF1857
+	.byte	0xa
+	.long	.LASF1858
+	.byte	0x9
+	.long	.LASF1859
+	.byte	0x10
+	.long	.LASF1860
+	.byte	0xa
+	.long	.LASF1861
+	.byte	0x1
+	.long	.LASF1862
+	.byte	0x2
+	.long	.LASF1863
+	.byte	0x1
+	.long	.LASF1864
+	.byte	0x3
+	.long	.LASF1865
+	.byte	0x5
+	.long	.LASF1866
+	.byte	0x4
+	.long	.LASF1867
+	.byte	0x4
+	.long	.LASF1868
+	.byte	0x4
+	.long	.LASF1869
+	.byte	0x4
+	.long	.LASF1870
+	.byte	0x4
+	.long	.LASF1871
+	.byte	0x4
+	.long	.LASF1872
+	.byte	0x4
+	.long	.LASF1873
+	.byte	0x4
+	.long	.LASF1874
+	.byte	0x2
+	.long	.LASF1875
+	.byte	0x4
+	.long	.LASF1876
+	.byte	0x4
+	.long	.LASF1877
+	.byte	0x4
+	.long	.LASF1878
+	.byte	0x2
+	.long	.LASF1879
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1465:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1485:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1497:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1101:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1053:
+	.string	"PG_VTX_CONFIG 515"
+.LASF795:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1767:
+	.string	"rcInterpolationChannels"
+.LASF1697:
+	.string	"failsafe_procedure"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF850:
+	.string	"_WCHAR_T_DEFINED "
+.LASF802:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1221:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1319:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF885:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF889:
+	.string	"USE_PPM"
+.LASF1239:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1469:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF775:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1368:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF872:
+	.string	"USE_FAKE_GYRO "
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF957:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1107:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF891:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF800:
+	.string	"USE_MSP_PUSH "
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1578:
+	.string	"_Bool"
+.LASF1758:
+	.string	"spektrum_sat_bind"
+.LASF886:
+	.string	"USE_UART8 "
+.LASF869:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1068:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF797:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1707:
+	.string	"FAILSAFE_RXLINK_DOWN"
+.LASF1587:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1456:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1329:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1741:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1694:
+	.string	"failsafe_throttle"
+.LASF1735:
+	.string	"BEEPER_GPS_STATUS"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF963:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1158:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1108:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1392:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1338:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF979:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1508:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1097:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF842:
+	.string	"__WCHAR_T__ "
+.LASF1717:
+	.string	"validRxDataReceivedAt"
+.LASF1762:
+	.string	"rssi_invert"
+.LASF930:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1461:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1017:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1433:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1305:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF981:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1584:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1468:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1410:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1565:
+	.string	"uint16_t"
+.LASF1161:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1471:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1749:
+	.string	"rcData"
+.LASF1002:
+	.string	"PG_RX_CONFIG 24"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1400:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1379:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"TELEMETRY_HOTT "
+.LASF1298:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF969:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1367:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1125:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1332:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1094:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF812:
+	.string	"_T_PTRDIFF_ "
+.LASF1406:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1532:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1281:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1343:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1013:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1247:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1089:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1317:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF967:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF841:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1740:
+	.string	"BEEPER_READY_BEEP"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1120:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1481:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1424:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1021:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1478:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1388:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1460:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1591:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1611:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1803:
+	.string	"failsafeReset"
+.LASF1128:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1075:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF833:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1086:
+	.string	"BIT(x) (1 << (x))"
+.LASF1616:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1064:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF962:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1136:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1287:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF875:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF852:
+	.string	"___int_wchar_t_h "
+.LASF1436:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1382:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1099:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1203:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1507:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF914:
+	.string	"VTX_TRAMP"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1613:
+	.string	"OWNER_BARO_EXTI"
+.LASF998:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF546:
+	.string	"__always_inline"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1797:
+	.string	"failsafeIsReceivingRxData"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1800:
+	.string	"failsafeIsMonitoring"
+.LASF890:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1590:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1630:
+	.string	"BOXMAG"
+.LASF1082:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1018:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF803:
+	.string	"USE_SENSOR_NAMES "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1031:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1032:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1570:
+	.string	"PGR_SIZE_MASK"
+.LASF1791:
+	.string	"failsafeOnValidDataFailed"
+.LASF1206:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1467:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF799:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1199:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF826:
+	.string	"_T_SIZE_ "
+.LASF1330:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1521:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1322:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1176:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1785:
+	.string	"failsafeState"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1527:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1362:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1747:
+	.string	"BEEPER_PREFERENCE"
+.LASF1640:
+	.string	"BOXLEDLOW"
+.LASF1750:
+	.string	"rxConfig_s"
+.LASF1776:
+	.string	"rxConfig_t"
+.LASF1614:
+	.string	"OWNER_USB"
+.LASF938:
+	.string	"__disable_irq() "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1049:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF1625:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF837:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1279:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1127:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1628:
+	.string	"BOXHORIZON"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1760:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1615:
+	.string	"OWNER_USB_DETECT"
+.LASF1344:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1151:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1500:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1641:
+	.string	"BOXLLIGHTS"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1595:
+	.string	"OWNER_SONAR_ECHO"
+.LASF905:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1385:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1772:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1010:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1629:
+	.string	"BOXBARO"
+.LASF960:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1583:
+	.string	"OWNER_SERVO"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF873:
+	.string	"ACC "
+.LASF1809:
+	.string	"beeper"
+.LASF1689:
+	.string	"flightModeFlags_e"
+.LASF794:
+	.string	"TELEMETRY_IBUS "
+.LASF773:
+	.string	"USE_PWM "
+.LASF1727:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF1415:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF843:
+	.string	"_WCHAR_T "
+.LASF1737:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1126:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1211:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1753:
+	.string	"sbus_inversion"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF959:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1778:
+	.string	"pgResetTemplate_failsafeConfig"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1167:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1716:
+	.string	"rxDataFailurePeriod"
+.LASF818:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1796:
+	.string	"mwDisarm"
+.LASF1134:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1523:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1557:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1559:
+	.string	"__uint16_t"
+.LASF1493:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1582:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1218:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF929:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF364:
+	.string	"__k8 1"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1610:
+	.string	"OWNER_RX_SPI_CS"
+.LASF853:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1482:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1251:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1193:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1106:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF1802:
+	.string	"failsafeInit"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1755:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1295:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1137:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1428:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1669:
+	.string	"THROTTLE_LOW"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF956:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1540:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF946:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1254:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1080:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1259:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1722:
+	.string	"receivingRxDataPeriodPreset"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1679:
+	.string	"HORIZON_MODE"
+.LASF1551:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1793:
+	.string	"failsafeOnRxResume"
+.LASF1754:
+	.string	"halfDuplex"
+.LASF1060:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1063:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF961:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF819:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1037:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1448:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1011:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1334:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1756:
+	.string	"rx_spi_id"
+.LASF1560:
+	.string	"__uint32_t"
+.LASF1041:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1488:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1795:
+	.string	"failsafeOnRxSuspend"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF989:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF965:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF1626:
+	.string	"BOXARM"
+.LASF1425:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1407:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1771:
+	.string	"fpvCamAngleDegrees"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1223:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1688:
+	.string	"FAILSAFE_MODE"
+.LASF871:
+	.string	"GYRO "
+.LASF1764:
+	.string	"mincheck"
+.LASF1044:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1070:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1061:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1065:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF811:
+	.string	"_PTRDIFF_T "
+.LASF1642:
+	.string	"BOXCALIB"
+.LASF1690:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1721:
+	.string	"receivingRxDataPeriod"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1175:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF951:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF947:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1638:
+	.string	"BOXBEEPERON"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF790:
+	.string	"USE_SERVOS "
+.LASF1572:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1622:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF783:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1510:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1661:
+	.string	"AUX1"
+.LASF1662:
+	.string	"AUX2"
+.LASF1663:
+	.string	"AUX3"
+.LASF1664:
+	.string	"AUX4"
+.LASF932:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1666:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1241:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1682:
+	.string	"GPS_HOME_MODE"
+.LASF1693:
+	.string	"failsafe_off_delay"
+.LASF1765:
+	.string	"maxcheck"
+.LASF1736:
+	.string	"BEEPER_RX_SET"
+.LASF1658:
+	.string	"ROLL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1732:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1335:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF781:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1314:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1798:
+	.string	"failsafeStartMonitoring"
+.LASF1792:
+	.string	"failsafeOnValidDataReceived"
+.LASF1604:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1431:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1377:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1556:
+	.string	"__uint8_t"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1745:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF1220:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1296:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1212:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1535:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1779:
+	.string	"failsafeConfig_Registry"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1284:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1130:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1182:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1568:
+	.string	"PGR_PGN_MASK"
+.LASF1268:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1648:
+	.string	"BOXSERVO1"
+.LASF1649:
+	.string	"BOXSERVO2"
+.LASF1650:
+	.string	"BOXSERVO3"
+.LASF1498:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF945:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF851:
+	.string	"_WCHAR_T_H "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1325:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF863:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1451:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1380:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1016:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF770:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1463:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1391:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1026:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1709:
+	.string	"failsafeRxLinkState_e"
+.LASF1051:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1483:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1422:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1185:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1208:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1719:
+	.string	"throttleLowPeriod"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1543:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF936:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1647:
+	.string	"BOXSONAR"
+.LASF1302:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1067:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1574:
+	.string	"size"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1266:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF824:
+	.string	"_SIZE_T "
+.LASF1759:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1036:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF1681:
+	.string	"BARO_MODE"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1775:
+	.string	"rx_max_usec"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1748:
+	.string	"beeperMode_e"
+.LASF864:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1014:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1271:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF866:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1687:
+	.string	"SONAR_MODE"
+.LASF1455:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF836:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1548:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1140:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF831:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1619:
+	.string	"OWNER_INVERTER"
+.LASF908:
+	.string	"TELEMETRY_IBUS"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1280:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1599:
+	.string	"OWNER_SPI_MOSI"
+.LASF1434:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1680:
+	.string	"MAG_MODE"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1564:
+	.string	"uint8_t"
+.LASF1179:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF918:
+	.string	"USE_DSHOT"
+.LASF1283:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1084:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1799:
+	.string	"failsafeIsActive"
+.LASF784:
+	.string	"TELEMETRY "
+.LASF1674:
+	.string	"ARMED"
+.LASF1030:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1286:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1654:
+	.string	"BOX3DDISABLESWITCH"
+.LASF1659:
+	.string	"PITCH"
+.LASF1539:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1062:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF854:
+	.string	"_GCC_WCHAR_T "
+.LASF849:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1725:
+	.string	"failsafeState_t"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF903:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1058:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1373:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1676:
+	.string	"rcModeActivationMask"
+.LASF1739:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1427:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF857:
+	.string	"_BSD_WCHAR_T_"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF792:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF829:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1490:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1506:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1100:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF840:
+	.string	"__need_size_t"
+.LASF1581:
+	.string	"OWNER_PPMINPUT"
+.LASF821:
+	.string	"__need_ptrdiff_t"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1723:
+	.string	"phase"
+.LASF1786:
+	.string	"receivingRxData"
+.LASF950:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1202:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF808:
+	.string	"_STDDEF_H "
+.LASF1700:
+	.string	"FAILSAFE_IDLE"
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1131:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1230:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF996:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1524:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1088:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1761:
+	.string	"rssi_scale"
+.LASF1004:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF978:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF968:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1770:
+	.string	"rcSmoothingCutoffHz"
+.LASF1146:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF766:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1550:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1801:
+	.string	"failsafePhase"
+.LASF1169:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF834:
+	.string	"_SIZE_T_DECLARED "
+.LASF1215:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1769:
+	.string	"rcSmoothingFilterType"
+.LASF1656:
+	.string	"BOXBLACKBOXERASE"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF915:
+	.string	"BLACKBOX"
+.LASF1383:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1052:
+	.string	"PG_VCD_CONFIG 514"
+.LASF900:
+	.string	"LED_STRIP"
+.LASF1364:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1346:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1409:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1766:
+	.string	"rcInterpolation"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1149:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF896:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF897:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1489:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1275:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1226:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1526:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF785:
+	.string	"TELEMETRY_FRSKY "
+.LASF1104:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1050:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF942:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1412:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1594:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1575:
+	.string	"address"
+.LASF1403:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1349:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1253:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1256:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1486:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF895:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1152:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1074:
+	.string	"IOCFG_IPU 0"
+.LASF977:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1787:
+	.string	"armed"
+.LASF859:
+	.string	"NULL"
+.LASF1515:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1457:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1811:
+	.string	"failsafeApplyControlInput"
+.LASF1596:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF764:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF966:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF499:
+	.string	"__PMT"
+.LASF855:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1718:
+	.string	"validRxDataFailedAt"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF917:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1102:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1301:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1028:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF767:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1783:
+	.string	"calculateThrottleStatus"
+.LASF1579:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1677:
+	.string	"armingFlags"
+.LASF1401:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1706:
+	.string	"failsafePhase_e"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1513:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1571:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF986:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1443:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1307:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1178:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1141:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1691:
+	.string	"failsafeConfig_s"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1148:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1250:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF954:
+	.string	"UNIT_TESTED "
+.LASF985:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF994:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF927:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF847:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1742:
+	.string	"BEEPER_ARMED"
+.LASF1111:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF931:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1311:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1807:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1495:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1714:
+	.string	"monitoring"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF964:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF763:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF825:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1763:
+	.string	"midrc"
+.LASF1132:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1340:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1278:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1110:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1421:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF778:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1194:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1352:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF980:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1394:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF861:
+	.string	"__need_NULL"
+.LASF862:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1142:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1746:
+	.string	"BEEPER_ALL"
+.LASF772:
+	.string	"USE_PPM "
+.LASF1726:
+	.string	"BEEPER_SILENCE"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1123:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1580:
+	.string	"OWNER_PWMINPUT"
+.LASF899:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1683:
+	.string	"GPS_HOLD_MODE"
+.LASF1501:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1232:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF926:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1197:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1675:
+	.string	"WAS_EVER_ARMED"
+.LASF1576:
+	.string	"reset"
+.LASF1184:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF987:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1734:
+	.string	"BEEPER_BAT_LOW"
+.LASF1077:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1684:
+	.string	"HEADFREE_MODE"
+.LASF1602:
+	.string	"OWNER_SDCARD"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1720:
+	.string	"landingShouldBeFinishedAt"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1452:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1027:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF943:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1781:
+	.string	"enableFlightMode"
+.LASF1563:
+	.string	"int16_t"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1299:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1552:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1555:
+	.string	"signed char"
+.LASF958:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1200:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF798:
+	.string	"USE_DASHBOARD "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF822:
+	.string	"__size_t__ "
+.LASF788:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF789:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1163:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1449:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1143:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF995:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1024:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1034:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1804:
+	.string	"failsafeShouldHaveCausedLandingByNow"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1358:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1277:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1505:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1529:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1730:
+	.string	"BEEPER_DISARMING"
+.LASF830:
+	.string	"_BSD_SIZE_T_ "
+.LASF1704:
+	.string	"FAILSAFE_RX_LOSS_MONITORING"
+.LASF1376:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF909:
+	.string	"USE_DASHBOARD"
+.LASF1531:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1109:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1633:
+	.string	"BOXCAMSTAB"
+.LASF1114:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1476:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF1698:
+	.string	"failsafeConfig_t"
+.LASF1744:
+	.string	"BEEPER_USB"
+.LASF1487:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1003:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1536:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1566:
+	.string	"uint32_t"
+.LASF1573:
+	.string	"pgResetFunc"
+.LASF1355:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1624:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1653:
+	.string	"BOXAIRMODE"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1752:
+	.string	"serialrx_provider"
+.LASF1007:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF782:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF810:
+	.string	"_ANSI_STDDEF_H "
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1777:
+	.string	"rxConfig_System"
+.LASF1057:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1617:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1569:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1157:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1416:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1012:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1066:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1045:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1631:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1710:
+	.string	"FAILSAFE_PROCEDURE_AUTO_LANDING"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1118:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1511:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1155:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF776:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1192:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1098:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1672:
+	.string	"OK_TO_ARM"
+.LASF1133:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF806:
+	.string	"VTX_SMARTAUDIO "
+.LASF1091:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1262:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1009:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1072:
+	.string	"IOCFG_AF_OD 0"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1504:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1124:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1790:
+	.string	"reprocessState"
+.LASF1242:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF921:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1484:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF974:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF791:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1310:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1166:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1105:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1006:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1398:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"long int"
+.LASF1492:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1227:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF999:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1245:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1592:
+	.string	"OWNER_PINDEBUG"
+.LASF1172:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1439:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1519:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1644:
+	.string	"BOXOSD"
+.LASF1509:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF793:
+	.string	"TELEMETRY_CRSF "
+.LASF815:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1085:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF814:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1272:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1692:
+	.string	"failsafe_delay"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1517:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1646:
+	.string	"BOXGTUNE"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1083:
+	.string	"EXPAND_I(x) x"
+.LASF1248:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1533:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF907:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1205:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF828:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1503:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1699:
+	.string	"failsafeConfig_System"
+.LASF1514:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1673:
+	.string	"PREVENT_ARMING"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1784:
+	.string	"millis"
+.LASF827:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1636:
+	.string	"BOXGPSHOLD"
+.LASF1025:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1042:
+	.string	"PG_PID_CONFIG 504"
+.LASF856:
+	.string	"__DEFINED_wchar_t "
+.LASF1502:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF522:
+	.string	"__flexarr []"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF901:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1632:
+	.string	"BOXHEADADJ"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1022:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF976:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF844:
+	.string	"_T_WCHAR_ "
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF982:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1188:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1712:
+	.string	"failsafeState_s"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1635:
+	.string	"BOXGPSHOME"
+.LASF1263:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1593:
+	.string	"OWNER_TIMER"
+.LASF1724:
+	.string	"rxLinkState"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1023:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1520:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1371:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1733:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1347:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF939:
+	.string	"__enable_irq() "
+.LASF1115:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1562:
+	.string	"char"
+.LASF1528:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1244:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1181:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1328:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1071:
+	.string	"IOCFG_AF_PP 0"
+.LASF870:
+	.string	"LED0_PIN NONE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1308:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF990:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1639:
+	.string	"BOXLEDMAX"
+.LASF1651:
+	.string	"BOXBLACKBOX"
+.LASF880:
+	.string	"USE_UART2 "
+.LASF973:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1703:
+	.string	"FAILSAFE_LANDED"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1316:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1652:
+	.string	"BOXFAILSAFE"
+.LASF898:
+	.string	"USE_SERIALRX_XBUS"
+.LASF801:
+	.string	"USE_RX_MSP "
+.LASF1079:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1290:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1499:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF832:
+	.string	"_SIZE_T_DEFINED "
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1464:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1522:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1534:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF839:
+	.string	"__size_t "
+.LASF1054:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF948:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF940:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1159:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1015:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1293:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF860:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1472:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1605:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF892:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1081:
+	.string	"STR_HELPER(x) #x"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1020:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF913:
+	.string	"VTX_SMARTAUDIO"
+.LASF777:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1597:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1209:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1059:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1589:
+	.string	"OWNER_ADC_RSSI"
+.LASF952:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1370:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF894:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1696:
+	.string	"failsafe_throttle_low_delay"
+.LASF876:
+	.string	"USE_FAKE_BARO "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1512:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1187:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1678:
+	.string	"ANGLE_MODE"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF858:
+	.string	"__need_wchar_t"
+.LASF975:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF813:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1743:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1547:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1350:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1728:
+	.string	"BEEPER_RX_LOST"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1313:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1229:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1056:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1445:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF912:
+	.string	"VTX_CONTROL"
+.LASF1129:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1789:
+	.string	"beeperMode"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1780:
+	.string	"disableFlightMode"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1660:
+	.string	"THROTTLE"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1173:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1645:
+	.string	"BOXTELEMETRY"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1496:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1033:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF970:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1035:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF769:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF765:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF971:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1043:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1361:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1217:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1055:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1711:
+	.string	"FAILSAFE_PROCEDURE_DROP_IT"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1600:
+	.string	"OWNER_I2C_SCL"
+.LASF1598:
+	.string	"OWNER_SPI_MISO"
+.LASF1122:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1623:
+	.string	"OWNER_COMPASS_CS"
+.LASF1516:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1090:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1145:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1395:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF983:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1544:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1768:
+	.string	"rcInterpolationInterval"
+.LASF848:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1808:
+	.string	"rc_alias"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF935:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1413:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1657:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1805:
+	.string	"rxConfig"
+.LASF1265:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1601:
+	.string	"OWNER_I2C_SDA"
+.LASF1549:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1643:
+	.string	"BOXGOV"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1374:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1000:
+	.string	"PG_IMU_CONFIG 22"
+.LASF771:
+	.string	"USE_CLI "
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1419:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1164:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1606:
+	.string	"OWNER_FLASH"
+.LASF1454:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1029:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1008:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1073:
+	.string	"IOCFG_IPD 0"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1353:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1546:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF845:
+	.string	"_T_WCHAR "
+.LASF1384:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF838:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1365:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1542:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF787:
+	.string	"TELEMETRY_LTM "
+.LASF809:
+	.string	"_STDDEF_H_ "
+.LASF1103:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1121:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1470:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1139:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1224:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1794:
+	.string	"failsafeUpdateState"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1530:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1116:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1005:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1257:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1323:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1618:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF805:
+	.string	"VTX_CONTROL "
+.LASF1705:
+	.string	"FAILSAFE_RX_LOSS_RECOVERED"
+.LASF1359:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1621:
+	.string	"OWNER_TRANSPONDER"
+.LASF1001:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1665:
+	.string	"AUX5"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1667:
+	.string	"AUX7"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1668:
+	.string	"AUX8"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1671:
+	.string	"throttleStatus_e"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF816:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF846:
+	.string	"__WCHAR_T "
+.LASF1363:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1331:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1655:
+	.string	"BOXFPVANGLEMIX"
+.LASF1269:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1480:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1466:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF911:
+	.string	"VTX_COMMON"
+.LASF1087:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF868:
+	.string	"U_ID_1 1"
+.LASF1782:
+	.string	"isUsingSticksForArming"
+.LASF867:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF919:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1608:
+	.string	"OWNER_MPU_CS"
+.LASF1567:
+	.string	"pgn_t"
+.LASF1047:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1160:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1525:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1418:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1473:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF1738:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF877:
+	.string	"MAG "
+.LASF1729:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1356:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1092:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF997:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1437:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1518:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF928:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF984:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF922:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1093:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF779:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF941:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1040:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1586:
+	.string	"OWNER_ADC_BATT"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF937:
+	.string	"EEPROM_SIZE 32768"
+.LASF1260:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1289:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1695:
+	.string	"failsafe_kill_switch"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1135:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF949:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1397:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1774:
+	.string	"rx_min_usec"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1154:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1757:
+	.string	"rx_spi_rf_channel_count"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1479:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1238:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1494:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF953:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF923:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1320:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1702:
+	.string	"FAILSAFE_LANDING"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF817:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1458:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF780:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1112:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF893:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1442:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1491:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF796:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1214:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1069:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1788:
+	.string	"failsafeSwitchIsOn"
+.LASF1477:
+	.string	"BEEP_ON do {} while(0)"
+.LASF1537:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF988:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1603:
+	.string	"OWNER_SDCARD_CS"
+.LASF924:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF955:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1381:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1751:
+	.string	"rcmap"
+.LASF835:
+	.string	"__DEFINED_size_t "
+.LASF1119:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1117:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF879:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1440:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1326:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1386:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1235:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1191:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF1806:
+	.string	"failsafeConfig"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1048:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1337:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF887:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1670:
+	.string	"THROTTLE_HIGH"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF925:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1554:
+	.string	"long unsigned int"
+.LASF1095:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1620:
+	.string	"OWNER_LED_STRIP"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1076:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF804:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF807:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF944:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1538:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1475:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1685:
+	.string	"UNUSED_MODE"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF992:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1019:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1701:
+	.string	"FAILSAFE_RX_LOSS_DETECTED"
+.LASF1292:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF881:
+	.string	"USE_UART3 "
+.LASF774:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1708:
+	.string	"FAILSAFE_RXLINK_UP"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1113:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF823:
+	.string	"__SIZE_T__ "
+.LASF1096:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1170:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1607:
+	.string	"OWNER_BARO_CS"
+.LASF1731:
+	.string	"BEEPER_ARMING"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1812:
+	.string	"failsafeActivate"
+.LASF1038:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1196:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1713:
+	.string	"events"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF1773:
+	.string	"airModeActivateThreshold"
+.LASF1553:
+	.string	"unsigned int"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF882:
+	.string	"USE_UART4 "
+.LASF1304:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1274:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF1541:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1078:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1404:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1190:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1637:
+	.string	"BOXPASSTHRU"
+.LASF1715:
+	.string	"active"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1046:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1341:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1585:
+	.string	"OWNER_ADC"
+.LASF1558:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1612:
+	.string	"OWNER_MPU_EXTI"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1577:
+	.string	"pgRegistry_t"
+.LASF920:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1474:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1233:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1634:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF883:
+	.string	"USE_UART5 "
+.LASF1389:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1627:
+	.string	"BOXANGLE"
+.LASF991:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1686:
+	.string	"PASSTHRU_MODE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF993:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1588:
+	.string	"OWNER_ADC_EXT"
+.LASF1039:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF934:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1609:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1430:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF820:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF972:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1810:
+	.string	"usSuspendPeriod"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1446:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF884:
+	.string	"USE_UART6 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1236:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1867:
+	.string	"io_types.h"
+.LASF1850:
+	.string	"long-double.h"
+.LASF1856:
+	.string	"platform.h"
+.LASF1820:
+	.string	"src/main/rx"
+.LASF1816:
+	.string	"src/main/drivers"
+.LASF1869:
+	.string	"rx_pwm.h"
+.LASF1844:
+	.string	"libc-header-start.h"
+.LASF1826:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1830:
+	.string	"stdint-intn.h"
+.LASF1834:
+	.string	"rc_controls.h"
+.LASF1862:
+	.string	"axis.h"
+.LASF1825:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1828:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1851:
+	.string	"stubs.h"
+.LASF1872:
+	.string	"io.h"
+.LASF1821:
+	.string	"src/main/target/SITL"
+.LASF1837:
+	.string	"beeper.h"
+.LASF1839:
+	.string	"failsafe.c"
+.LASF1819:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1875:
+	.string	"io_def_generated.h"
+.LASF1824:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1836:
+	.string	"failsafe.h"
+.LASF1865:
+	.string	"config.h"
+.LASF1846:
+	.string	"features-time64.h"
+.LASF1877:
+	.string	"vcd.h"
+.LASF1876:
+	.string	"sound_beeper.h"
+.LASF1829:
+	.string	"types.h"
+.LASF1840:
+	.string	"system.h"
+.LASF1848:
+	.string	"timesize.h"
+.LASF1858:
+	.string	"target.h"
+.LASF1842:
+	.string	"stdbool.h"
+.LASF1827:
+	.string	"/usr/include"
+.LASF1813:
+	.string	"src/main/build"
+.LASF1845:
+	.string	"features.h"
+.LASF1818:
+	.string	"src/main/flight"
+.LASF1853:
+	.string	"typesizes.h"
+.LASF1814:
+	.string	"src/main/common"
+.LASF1871:
+	.string	"serial.h"
+.LASF1868:
+	.string	"flash.h"
+.LASF1815:
+	.string	"src/main/config"
+.LASF0:
+	.string	"./src/main/flight/failsafe.c"
+.LASF1854:
+	.string	"time64.h"
+.LASF1879:
+	.string	"motors.h"
+.LASF1831:
+	.string	"stdint-uintn.h"
+.LASF1822:
+	.string	"src/main/target"
+.LASF1874:
+	.string	"utils.h"
+.LASF1823:
+	.string	"src/main"
+.LASF1833:
+	.string	"resource.h"
+.LASF1878:
+	.string	"time.h"
+.LASF1864:
+	.string	"parameter_group_ids.h"
+.LASF1861:
+	.string	"debug.h"
+.LASF1855:
+	.string	"wchar.h"
+.LASF1838:
+	.string	"rx.h"
+.LASF1835:
+	.string	"runtime_config.h"
+.LASF1873:
+	.string	"io_def.h"
+.LASF1817:
+	.string	"src/main/fc"
+.LASF1857:
+	.string	"common.h"
+.LASF1849:
+	.string	"cdefs.h"
+.LASF1870:
+	.string	"sdcard.h"
+.LASF1843:
+	.string	"stdint.h"
+.LASF1863:
+	.string	"build_config.h"
+.LASF1859:
+	.string	"stddef.h"
+.LASF1852:
+	.string	"stubs-64.h"
+.LASF1847:
+	.string	"wordsize.h"
+.LASF1860:
+	.string	"common_post.h"
+.LASF1866:
+	.string	"adc.h"
+.LASF1832:
+	.string	"parameter_group.h"
+.LASF1841:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\025\b"
+	.string	"D\n\257\001"
+	.string	"\022"
+	.string	"\200\331\204\226\002\f\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\005\002\001\002\006\001\240\342\234\212\n\002\003\324\342\216\230\003T\002\007\003\002\005\002\005\b\b\002\t\002\006\002\n\003\002\005"
+	.string	"\002\001\b\217\271\213\277\005\024\005\007\002\001\t\345\227\312\267\013\004\n\236\233\221\355\007\002\013\324\210\217\002\002\f\353\262\334\316\001\r\302\327\301\252\013\016\337\246\213\313\r\002\017\370\264\244\335\020\215\210\305\275\016\007\002\001\021\300\272\315\314\002\006\022\352\232\337\347\016\b\007\002\001\023\353\303\321\231\004\024\264\256\257\344\016\025\340\217\302\257\002"
+	.string	"+ \200\202)2\336\341\344f"
+	.ascii	"*\263\004\020 A!\2152\263\032\301\214[\361\245`Q \303\002\r\200"
+	.ascii	"?\240\253\r\224S\206\204\252\024\236\004Xh\3562\277d\373AL3\224"
+	.ascii	"\205\312\356\307\201\201\343m\254p\312\301\310\341\020\020 \034"
+	.ascii	"`<\300\023\340y-\233V\227\023\273\306\033\243(n"
+	.text
+	.section	.gnu.lto_.ipa_sra.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375 l]\002"
+	.string	"4\003`"
+	.string	"\016"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001"
+	.string	"\001\b"
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\003\013"
+	.string	"\003\f"
+	.string	"\003\r"
+	.string	"\001\016"
+	.string	"\003\017\001\001\020"
+	.string	"\001"
+	.string	""
+	.string	"\021\022\023"
+	.string	"\001"
+	.string	"\001"
+	.string	"\t"
+	.string	" \004J\030\213\n\003\210\315\034\221+"
+	.ascii	"3\201J;0\300\002"
+	.text
+	.section	.gnu.lto_.inline.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\264\001\r\b"
+	.string	"B\212#,pK\222\0160\3263\037\201\2350s_\261\373cAuc\343\250\322\224\377-\311\377WUU\205\356\260\321\266\305\326\306\330\026\311\226;\005\3777\206\261\220C\302\"\203\271`\035D1d\361\341\033\002)m\235\t\246\322x\374\253;\333\266\305\034A\003\217\023\241t\352FR\213"
+	.string	"\013\234\201\344*m\243\003>x0k\314\"7MSey\005N*\034\"lc\201\f\223\216\013\203\370\336\034N\211m\273\274\204\023m!|K`C\333\307C\223\0224 \260\"\222\224yK\302\362\302"
+	.ascii	"\355\312*\360\242X\245\300\332#\304\001n*\206\025j_bED\312\216"
+	.ascii	"Fd\030\r\244}\227\030R\262\220\013\373\025\267\343\006y\220\314"
+	.ascii	"\244H\036\310<\321\360\326\034\300\263\307\370\260\306\263\034"
+	.ascii	"\024#G\370\262\262c\357\335\314\361x\300\252B\351o\344\rAW\270"
+	.ascii	"\001\314\030+\020\367\265\026\353\361q\001\303p\266\247\275!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375 \242\275\002"
+	.string	"\322D\017\032\240'i\f\330\377\333/\220~\375\377\377\177\315\354\377\377?}\244-B\266L\001\2378\342\207\033N-\310V\030,\370\034\030\260IV\322\265\306\252\222W\222A+i\r\232\342\250\"d\004\t"
+	.ascii	"\374 \215\253\013{\316\310i@s\006<\271\216\033n\tw\003X"
+	.text
+	.section	.gnu.lto_.pureconst.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\230\004\003\270\004\b\230\004\t\230\004\n\204\004\013\204\004"
+	.ascii	"\f\204\004\r\230\004\016\204\004\017\230\004\020\230\004\021"
+	.ascii	"\230\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\275\003"
+	.ascii	"\242\304\013\017p\213:\374\377\177Xni`\324#\222)\005\252z\031"
+	.ascii	"i\243\225\223\243\311\224\242\310\204nH\300\202N\346h^\0134["
+	.ascii	"?[3/\233\305\217# \300\002\221\354\0016\361^\200\201\335\264"
+	.ascii	"\243u\367\343:\332\213eA\332Z\341\255Z\227\225y\273\364\342\340"
+	.ascii	"L&\226b{d\321\264\367\222f0`\026\256\231\020\027\0166\254?.\333"
+	.ascii	"\332\313\234\253\235I\026Zq\335"
+	.text
+	.section	.gnu.lto_.lto.bfe4f0848ed29393,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.50.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375 \206\375\003"
+	.string	"\024\007O"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\203\274\313\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\354\005us"
+	.string	"\005\001\006'\001\n(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.ascii	"K\t\220r\025D5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.52.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375 E\345\001"
+	.string	"\364\0028"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\005\001\006'\001\344"
+	.string	"\350\007\n?\202\210\2000\177}\277\001{\277\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\004"
+	.ascii	"@\020\\\006s\320\001\300\001"
+	.text
+	.section	.gnu.lto_failsafeReset.53.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\001\002\305\r"
+	.string	"&\327UC\360t\224\016\350\006L\304\212W\342\212:\345\034[\311\255\270aL;\013\217\001<\222\364\374\030\323\313.i\202\\\036\276\316\224`L\333\037\250\226xs2\023\342h!`\3230\254\216\213<\332\037A6\2212\245>"
+	.string	"="
+	.string	"H"
+	.string	"\232\351|\372\003\262\027\217\002\337.\210\257\310\306\300W\t\333\327Xe\007y\013e\337\362\201\3045dw\243\236\\\365T\371O\271"
+	.string	"\257\244\303\023\300\203\335uz%!n\275m\005\266\033\330y\022.\326\211.?_SOr\304\346\316\262!\300\256\207\216\257\362\225\223O\342\320\034Ry\357\320Oe\207W\007?VV\3719[\230\350\261I\304nu\251#\354c\253&\266\246a\246\261L\007)\025\376z\341\254\260\360\0312\026\250\370\213\333\332c\300` 3\223\342\243\314\006\335\305\305Ff\006\005T;t\327\210"
+	.string	"\312\356v\374\226\263\3300\224J\331!f\304\023\202)\274\213*\246\020\bKD\347\343\206\311RU\r\004\006qB\"\355D\3324QD]\030m$Q\314\260i\245\b2\235\"\007\2019\r!SDq\234)jZ\253c\253&\020h\304\254\264\263\357\311\354\b\337\341\321\221\340\345\223\331\022\236\343\203\343"
+	.string	"\313\204\337\260\021U(\034\246\306&/ @\003\021\331t3B\257J\201\003zw;\222\275'T8\0063)\337\rG|\222}\002\034\361I\366\tp\304'\331\237\240\341\214O\262{\302,8\203\325\322Q,\246\007\303`\263t\007\205\320\306"
+	.ascii	"\343\264\311;\354\220\210p\035\007\240\030\bm\330\346\211lI\320"
+	.ascii	"gC@M\267h\307\023"
+	.text
+	.section	.gnu.lto_failsafeInit.54.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"\355\007"
+	.string	"bN680q\323\001"
+	.string	"\t\021\216\216J\2073&D\317\330\030\002\353\333\254\303"
+	.string	"oaB\375\327\355!\370W\225\357\343\334\374\030\021\021\f\036\256\374\371+\214\017\252\373`\335\310\226)\005\376x@Z\346\205\266L\233\242\006\206-\244\315\207-s\230\237\316\233\236\2169\bP7E\034\327M\216\270\267V\242\bL\262\302"
+	.string	" ;\243\3620;\342)\257d@OX\\>\302l\211\223\214\002\302\335M\360E>2\341{\3742\005I\017\376\362I\330\257N(c\322\225\021RF\325*\215-\226Tn\330\267V\242lK\001c\214\021x\331\275X\325l\313\245\362a\373\034\1776\314\305p\237\352\2600\031wwJ\216\177\327\317\177\310\r4P\300S\351\272Y\330]+x\312\270\345m\027\330>\260\275\022\r"
+	.ascii	"3\241\301\037\270f.\002\203\301\306\252\222\002 \321\255\032"
+	.ascii	"t!\217\013v\274\f\001.]\247\235O"
+	.text
+	.section	.gnu.lto_failsafePhase.55.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"e\007"
+	.string	"b\21646Po\322\001@\372\205N\002\300\315Bg\007]=\340\006z\023\013\250D(l\r\265\036W\213\025f#,\254\02523n\\\003\375\3229P\022\245\207!\262\367\226)\005\316`4\227\305\331`\326%;\r\f\330\346\222\017\230\345 3\032Gb\016\234Ah4\331\3112MRs\017\367\211\374\252\320\243\260\035\361\222-`w\025|\222O\t\337\343\321\023\036=\367\350{\246G}\006+#!-\231\312X}\261'H\337\206}\270Od[\255o\"\245\024\250\354Z\224H\213\022O@l\177l\312\037=\344\343\r\316\216N@cTa\342\262;eu\202\351\021~`z|\034\337\256\233\177\221\303\026\f\026\256\003]\001\026v\327\312u\027\367\273m\004\333\t\266?\002\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.56.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375 \375\r\007"
+	.string	"\362\31526@o\222\016@E\345\277\255"
+	.string	"\342Zv\3432\223}\035~=\314\333n\231\204\375\233=\353c\345\024\002M\353\377\312\035Eg\b\365\247\200\354\201,`K\026\233%D\246s6\035\354\372x\262\013\213\240\005\205\314\203\305\206\354b\210\234\355\0237\002k\016\235-\2024m\213V\227\205\250\341"
+	.string	"\tJ\374\017\025\341\0022\023\341\2064\005q;Z\035\021z-\265\272!\200V\017jTR\244\367\262\205\221\257\345\273\321\203\032_Lf\346\020\365\277\037\314T\244hJ2M/.\211R\231x\374\375\202\210\336\332\340@4\327\216\303\324\f\222\211\021\226\314.\302\215r}\334\355G1+\026'\245\323\250/\223\220\231\277\322\211\242\303\376\004\177\301\177\021\006"
+	.string	"\n\013\270\211!|\205"
+	.ascii	"\301e`\270s\246v>\001"
+	.text
+	.section	.gnu.lto_failsafeIsActive.57.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375 \374\r\007"
+	.string	"b\31516@o\222\016@=\002\225\266\n\307\2761\210F\272\371\303`R\237\205.Q\374\277\331\263>VN!\320\264\376\257\334Qt\206P\177\n\310\036\310\002\266d\261YBd\no4\234\313\362t0\353\212\237\005\005\254s\305\006\314b\210\033\315\0235\002g\016\034-~\262L\213U\227\205\246\341\300\bJ\374\017\025\331\0022\023\341\2024\004\342r\224:\002\364\312\225\272 \200R\017fPBF\357tu\221\217\345;\321\203\031\337KB\323\377~\020\343q\222Q\311$\235Z\322\204*\351\370C_mp\020zk\267A*\006\311\304\310Jf\027\241F\267\276\355\366\243\227\224\212\023W\022\365a\0222\363\307\225(:\354O\360\027\374\026\001\b"
+	.string	"\t\013\270\211!|\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.58.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\r\007"
+	.string	"R\31515`\215\032\003@\251\214\304J\f\231\251>H\255GQ\330vP\213\2523m\236\220\305\007\376m7CE\033\221\332^\2220\244\034\351s\205\001j\0357\312&eJ\001\335h8V\345\351\\\225%?\n\tW\307\222\fW\265 7\231Gj2\305\0328\231\374`X&1\363\206\245JgB\221\214`Dm\220\245u0\007H\200\373oPkx\343\241\306p,D\350ys\254C\026\307\001\356d\364R\r\350&\312\344\017\245\235\242\007+ZW\016K-<0\235J2!\377D*\345\"\361#\243\2551\325\332\021O\356\356"
+	.string	"\221\3608\375\227\360\302\232\237V\2733\300F\022\371]\020\376\367m$\n\027\272-A\333\202\266\026\001\b"
+	.ascii	"3\001[8S\374\370\032\327\304\264\020\360\313\020\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_failsafeActivate.60.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\230\001\225\016"
+	.string	"\226\232^D"
+	.string	"\221(\035\377\356IT\361\224P\242\326\2678\235#\220\217\241\254\326\241\225\340uE\320\023\202\264\r\372_\226QQU\375\206\204X\277\345\227\314\237\225\356S\236/\034\321\377`Hdg\031[#\204\354M\244L)F"
+	.string	"H"
+	.string	"M"
+	.ascii	"\216OCMc\232\326L\347\323\017\260\200E3c\300\306.\207\327\216"
+	.ascii	"m\301\030\022\266\317q\311\256q\226j\263\0173P\\hv\227S\021/"
+	.ascii	"=K\376M|\373RL\317\214\301\356:\277\224\016\267\3366\002\333"
+	.ascii	"\t\354T\020/30\362^\264I\216\302;Q@\306\215?\024\355\013o\tu"
+	.ascii	"T\273\033"
+	.string	"\342\263|%\362G\034Z\003)\377\035\372\244x\370\241\302q\312\227\007\260\264j\\\233:l\026*5\204}l\025\204\215\24570\275\301\264\206\245\263g\220\306\347\202z\215\232\271\244T0\2051n\231\250\212)\001\036\251\022\250|9U\365(=l\b_\021A\333=\t\361S\\\205\204\t##\3610\3650++\001iS\250\240o\361\200R\2233\027\200\324\366]\264=\237\374\347\003'jr\006\366\200|@\035\251\304\353@\234\211\005\022\257\004\304a\360\272\020\347\031\2218\220\017\2132|F\234\211H4\3428\254\323kZ'Ey\243/D:*\231\177\256M7\377\206\250\351\246O\251d\252\251\3024x\214\210\346\"\323\316\312\352\364\222#\252\355\340-\036\260\b$ \220\002\241\261\362\001r\3002\034\235\260\032\203?\004\022q\035\312pl<~/y\225\310O\371\262\n\201_\254\245\024\361M\034%$\317\2505"
+	.string	"\3211b\201\243y\312\276\321\312@\f\361\364x\265af\225\r'\230'\206v8\020 \234\367!"
+	.ascii	"\323-Z\372\004"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.62.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"u\007"
+	.string	"\022\21755`m\322\001\f\255 \244f\f\265@)\2460\213v\272\367\002ZU \n\335\032:v\320\026\376\211\236\030o\255\220$!\305\307\025QAB\030\002\037\3246\2212\245\306\\2\227\265i0\353\212\033\206\005LsE\007\314j\210\030m\213\027\213\263\207\214\0267Y\246\305\312\333S\253$\325\201\217\202\374o\225\253*\225\022\032\001\345g\033\342 [\300\356&\370\037?E\370\031\207\226\340\344\273C\237S9\274ZL\247O~\256,6Ol\317\223Z\262O\255\222l\2475\323\247\0046J\n\276]\321\207\262$pD\303\366\355{t\354\312\007\b\035s\3670D/M\204BLv\275\250\027\347\236\234\377\216\303\n\223H7\362<\001\024v\327\331\215(n\275m\002\333\006\2669\002\007"
+	.ascii	"2\241q\037\330<L8\256\211 C\350p\227M\355$\003"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.63.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\375\n"
+	.string	"&UNA\020Q\234\016pY\314\242\323\361\004\024\234\036\\\342yl1"
+	.string	"1\341\274!\222"
+	.string	"_\031!.\217\217\250j\037D\024\003n\031\033\031\231@\344\021P\251\f\260n\021\211.\026\241U\214?\032\351\376R\246\0248"
+	.string	"8"
+	.string	"<"
+	.string	"*v\303\004F0y$\360\213\365(\271\305z\364g\307x\370\261\027\2710Ad\306\356b\272\341\337\363\363\037\342\024\260\003\365\274\030\354\256\023\354\260p\353m\033\260\335\261_ -6i\330!*U\203}\311\356\256\325\303\276\352\217\231\326Lg\246\177\001"
+	.string	"aq\300\305n\205U\215\035\211+<\330~\305\266PX\360\264\017\362\220\357*\317\224\335\f(\002V5\341]>J\034\224\241W\325\230\202\003\303\365\342\236\0255\365\202\301\361a#W\266\273\223\360&\273\273\361E|\204\311\357\360h\t\247<\370\350\237\254\307\353\205\203*\225+\347\t\020\001\316h8\231\rG\243"
+	.string	"#"
+	.string	"\264i\\\326\001\2152Rgr\320\231\002\370\203\311B\236N\244yBX\t\302\003M\024\302F\232'\002\366\341:\f3\300\033)\343\260\322\266qX%\334KV=\334 d$\245\033\001\r"
+	.ascii	"\373s\241\214i\023j\0307\204\004K@\334#\344x\202\\B3\230r\031"
+	.ascii	"\333Z\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.64.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\025\b"
+	.string	"\222\31777@o\323\001@-YQ\034\221\324\314\370I\007\207\375z\tna<\336w\016\320\377\246|\315\254T\215\346M\365\277rG \273\226\006\202\330W\246\353\261\213\321&[\246\024\336h8\330\305y\262\013\233\240\006\206\314\203M\207\354\372\314\315\306M\r\201\265\007\3166A\232\266\315L\270\2576\226\026NP\2428\362\337\261\354\354 \235\217\002\025\027=\225<\332\237\207\332"
+	.string	"\270\273\t~\307= \374\214Ks!\351\207\254K\031\362\265\2104\345J\355\b\t\375\367\370\r\213Q\364\254'\222\224U\030;\3644^\330\257vw\035K\366\325\267\004LP\016Dv)R1\213\222#\032\266\237qg\263<\004\367&p\302\364\262\2733b\274\273v\3769\036\360\221\274+\200\302\356Z?R\305\035o\333\3006\202\355\225\f"
+	.ascii	"3\241\333\037\270\320\334\005\333\235J\206V6`\2028\362\f\005"
+	.ascii	".C\277\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.65.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"]\013"
+	.string	"v\224KA \215j8\320>E\235\242\207\343\006\300\230n.Q\333\230\222s\006`\222\020\252;\304\347\017\271\311\234\024@B\037\303G\232\376y\217\030\200\200\306G:\201~\311\031\346\035E\253\300\365\370mo)S\n6"
+	.string	"6"
+	.string	":"
+	.string	"v\207\213\252}\213\001\201Vlw7U\360\3223\315\222_\311X\300\320{\206\340j\021\2362\215\335=\204g\201\360\313\254dv\327\t\206\007n\355\266Alw\330\027\t\340\007S\216\316\322\016  \017^\377 \301\247\236\323\345A\303&\t[\364RS\366\263U\224\375\264>\235O\337B\021\313\3001\356\032\030K\354K\273\320\300\366/.\005\236VxGQ\035aa8\345\b\247^U5\330"
+	.string	"\007_\216\266K\316\352&$\244~pX\245\013\304\325\006]\354.T\273\353\341\257\036\001\200\277\340\232E$\315'Q\256i\026\002\336`8\035\215\350\303i:\333\210\304\303}:\233\t\247\001m\233\220h\303d\270;\341\204\266Q\327\205\266\213\270\317VQ\016\021\3612\351\227i\352\034\305\366\234\002\207\241\232\260\261!D\205\013\226\273\033\027"
+	.string	"3\241\t)\306\206\241\244\177\207\021\254\003\301\272\020\367\005\346@\001e\266\3644\226"
+	.ascii	"BT%Z+\0330A\034y\206\342\232\310\204\t\344e\b\340\362\003\243"
+	.ascii	"\024Uc\273J\031"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.66.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\003\001\305\013"
+	.string	"FUMA m\225\016\334#)\002\253\0247"
+	.string	"\006"
+	.string	"\211`\025c\231`5\326qG\006\275\017\262P\267\232X\262\206P\264c\026\306P\330\254U"
+	.string	"V>\002\331\210\371\r\212`vw`\256\323\326\310~\262\245L)8"
+	.string	"7"
+	.string	";"
+	.string	"\025\223l\022\007S{\226\n\001\353\304\356f*\341\244GM\222O\301\\x\037\367\330\340\252\361\231\242\307\356\036\3033\301\327eR0\273\353\364\276\0057v\333\"\266-\366\r\004q\205W\242\224\241c\332\004\n\344\275\353/D\350\224s\266\276\020\233)l\220KE\331\217\253'\373\351\370\264>\235O\037\243\362"
+	.string	"\204%\334U\020\252X\027\346\241\202\355\007\252J\262\372`J\024\266\265o`E\375k\202^U\261\327\001\013]\206\266\001|\265YhH\r\031\241\312\026\203\253\3759\270m\244v\027\304W=\303"
+	.string	"\237\3021\207F\230?\232\034\013\326\\6\234L\310\243e8\231\250\244\243y8Y"
+	.string	"-\363\3114\240Pv\351\360&`\003\312D\333\006\312*\340>\256\236F \270J\332EE\2713\2617\357\320\341Hq\370\020a\"\243\345 w\227SE\305\031"
+	.string	"3\241[)0\207\2678\320\022\035j\021\210\313\204\f\202\261\3214\345\nV["
+	.ascii	"\337\254\244\206\025f@\334\252Dke\003&\210#\317P\\\023\3210A"
+	.ascii	"\277\f\001\\~`\224\242jlW)\003"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.67.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\265\001}\021"
+	.string	"F\240xI\320\362&\035 L\020\215\244\314\3338\033[\324K\214\364\343\013\016\255$\030S\352\365\334!\362\236:\r\350\351\321$\001G\006\"\025\366n\377\220-/y"
+	.string	"`\311?\020\320>p\204\260\244\324\205\351\310\0222\0344d7\331;\245^"
+	.string	"c"
+	.string	"b"
+	.ascii	"\037\260zu\345h`\237\310)\f\310\343h%\265ryRND\341v\273\245\202"
+	.ascii	"W\233\260^M\332>^\006\355sM\035r\273\335\375("
+	.string	"\t\222\244\344=:I\177\344V\273\307\3529\365\022\370\324\350i\335l\036\311\215\021=\256\373\364p\323\231S\244ew=wn \356z\333\016l\333\354C\005&U\273<UC\366\251\312@a\373\376\322\231\354\226q\256\344\002!\236|p\273\333z\365\227p\354\326\353}%\322'\272\321\217\236\273\316-\327\220.\351iD\312!!\020\322\201c\021\213q\344\202\306\332\024\"I@6\242,\260^]3\214\374\242\267 _r(\321)\367\366\"\264\243\300z-9\311\352\325\0135\262\371\035SZc\t\232\nB)\220O[Qz\335\005\030\255\250IA\361\320\231S>\2231\274\211\306\332\335\025\377\305a\314|\023\257\316p3\277s\263z\245\324\300\216\242\234Y\3453\035B\017\216\235T\336\320\356\244\256\373\013\215\025\002d'\225]\332&\005r*\341\244\302\364\307\3764\255\027\361a\367#\340\b>\330PA&\006\323"
+	.string	"\013_\241\030"
+	.string	"&\254\021\301\032\2330\2130\363\032a7.\256\020F&A\fm\302\360\302\210QTXPVXT\026\234\020\bGpt\231\315\302\227L\264\tE"
+	.ascii	"~\235\2041\340\214\006\006\306|\343\214\f\214&\346\213\301\300"
+	.ascii	"\232\357%\316\276\223\003\226\331\204\3427\312d\342\327*sN\177"
+	.ascii	"\354\226\034j\023\362F\246\035  \240\002\241J;\306HS\327B\221"
+	.ascii	"\305\352h:\002\241\250\260\307\375\2735\016\210\021\350'\332"
+	.ascii	"\363\241\335\241\232q\330)\302`]1\216b\304\220\343t\314\306>"
+	.ascii	"RH;\032\253l\035\345\005m\205\221Uo\360$\255=\032\230\337\003"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.87.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\024\035\035y"
+	.string	"\n\266\340(P0P\332\032\003\252\344\221\220\272\333)\021\343\252\252vJ\375_\265)w\225\0247`\206\221\276<_WYc\371\255\225\246\023\362\364\202\\\r\260j\323\213\343:\317'\2414,s\321H\304z"
+	.string	"-8)_\334\005\257.G\237\225{\243l2\245\224\002}\002H\002\212\002\314\301\b/\022\276\332#9ZD\227\362\332\206\020\230\003\236\250\032\231\033\305I\330\331S\3778\032\244an\356jS\271\352)w\230\201W\275\272k<\017z\312\"fX\357<\210\2422\304G\005g9\002h\266q3i'\334OX\310[4t\023,+N\233\210f\3224p\327\200\343V\003V/\341%"
+	.ascii	"\250E\241K-\2024`17\225Y\310\037\364\224\233l\204I\362\001s\b"
+	.ascii	"=e\026*\2505\241A\356\271-n\272\256\353#\215\244\245,\344\255"
+	.ascii	"\255\255\255\216c\263\366\\\222\033H\313\320C\272H\313\261\260"
+	.ascii	"\177E89#xYC\212\020\001\322\241\007\365\221b:D\210V\360m\003"
+	.ascii	"\026yJ\261R\020\354_\361\211\f\334A:\232\354\030V\b\265\210\276"
+	.ascii	"L\bt\3645\020\354\237P\353\270\375k\033\307\355_1O\004s\003a"
+	.ascii	")\252d\307i\tqE\3371)6+\264\357}\243K\375c\246`\377\372\0073"
+	.ascii	"o-9\311\234\245\243jo\023\221*\211\364\275\357\373\324\277_\341"
+	.ascii	"\273\2156\023\261\373\311\236:JEA=951-)%\201@:2*\"\3720$\024"
+	.ascii	"\004\364\343\343\241C\017\317\216Q'\007\247xcSC\244\031\ngd\202"
+	.ascii	"@\367\327\276S%\271g\230\\=u\245\217W\254\270\224\215\333\214"
+	.ascii	"\216j\201_cl]]\362\265!\276X\251\375\266\334s(?\322\007\205{"
+	.ascii	"rjb\212b\347KzP\\\251\272\224\362\304\223\250sx \220\364Z\241"
+	.ascii	"#\351\324\215\220tQks\244\205zB\347D*\220\325\365\207\272\036"
+	.ascii	"j\235\242\304\210\353\352\022I{s\303\212\2209\027\222\353 \271"
+	.ascii	" \016\204\244\347\366\343#\355\366K\234\034\264=\274-\343~x\007"
+	.ascii	"\275\356\341\251.a\360\341;zm\324a\353\034\0359\034\247x\203"
+	.ascii	"F\006\3276kj^C"
+	.string	"d*\337\2266\234\b\034\321\006\027\205b\321\310Xh\232\346\333\022\005\037V\227\3153\027\016\241\221\231\365L{\374\352;\353\352\322\254\035~QV\351\267\345\t.\323*Y\223x\351\352\022G\2533\306\026\326\322\036z[\326\360\240\3535\360\316I\023 ;\032mY\346\312\220\245\315\3150\225@\327\330\277\240\214n\205\336\367\0252\277\374[\235)7\256\020\231-Z\245f\224\030-m\027cz\271\027\233\n8\342}_\356.,\315U\315\37450\363\r\346\236\261dir\301\177r\267\213\341o\236\346I\333\200QS\317\355O\352\217/\3467\330\323~hu6\330\235ms\316\214\375\354O\220\243\301^\3463\200Xa\260\307h2'4\n\365\361:\337\2441\366%g\t6\t\327\204\240\332\273\f6\360\356\300\203\372\360\022\2309\313\217\nU\270\272\311\354b\314\274\345ao\222\313\343-\3631\314L\200\273 \341$"
+	.ascii	"?h\r\310\005wm\330\253\226\333s\355\301\260nK5\347\356\305^\355"
+	.ascii	"\364\260\327\343\217\350j\337\367}\335\177r\253A\031\323\272"
+	.ascii	"W\373{\257p\245^\214\215bL\360\272~\377\224\362\372h?\rL\273"
+	.ascii	"\317\027t\277\215dp\t\363\377d\356\322\375\026\b\341k\341_\330"
+	.ascii	"\353\226p\257p\233\256#\360\272 U\357\312B\326\365\021\351\266"
+	.ascii	"\377\373\036\323Y\344\001\t$\360\337\2467\3550\"h\255\340\376"
+	.ascii	"9\322-8\273\034\f\267\375\343\372\377\263+\313\274<\313\334}"
+	.ascii	"\215U\200;\0073\340\200\003n\377\374\273\257\251\243\314\006"
+	.ascii	"J\023\354\365\235\322^F\320b \206\b\335\021\270\375\223\266\314"
+	.ascii	"\025(Q\254\265\013\217K4\227\b\202\357\373Vq_{\213\004\3349\372"
+	.ascii	"\307\023P\340\035F\201\333\277\376\2375 ]\236\345\306k\004\332"
+	.ascii	"\252\257\203\201 \t\036vKK\273\001(r\330\353\353`\374\237\374"
+	.ascii	"T!\324\276x\341Oc\256\242\232:J5]sT\3175C\r\235\237\206\316N"
+	.ascii	"6\316M6\316L5\316KCg\245\241s\322\320\031\304\320\031I\350|$"
+	.ascii	"t6\032:\027\r\235\211\334\371\303\320yh\350,4t\016\032:\003\r"
+	.ascii	"\235\177\204\316>Bg\017C\347\016C\347\236\033g\236\032\347\035"
+	.ascii	"\243\316\215sN\2153\216\320\2718t\276\031:\333\b\235k\206\316"
+	.ascii	"\304\2413\215\215\363\320\306YX\343<3t\226!:\007i\234\201Bgw"
+	.ascii	"\350\374\033:\267B\347\027:\373\214s\247H\332\253i\276\357X6"
+	.ascii	"\314\353\374Qw4\222\356#\335u\335t\335s\326+\326\342\371z\276"
+	.ascii	"\263h\226v\306\021\221Z=`-\236v\306=M\260\372\262\235\364\036"
+	.ascii	"k\265o\331\327_\221\242\372\200\265:\2526\026\002\205>\350\r"
+	.ascii	"[\001\035c\232\255V}\323\031\255p\231\316\232/N\232G6\212\265"
+	.ascii	"\3628y\227$\027\r\027\357\262\363<,\262~M\352\300a\347\231\326"
+	.ascii	"\200\364\f\035\215\242\1772\360\311\007\343?\337\320R\353\274"
+	.ascii	"XS\353<\001\355\035\232\316\267\023i\026\315\215\310\370\355"
+	.ascii	"\244\205\230Z\347\215\337`M/:\346w\023f\b\\K\222\253F\357}\337"
+	.ascii	"\020\354X<K\322\353+\251T\332\205]q>\247\233p\322\205[\331s\276"
+	.ascii	"\244\330\213\344\330\230\333?\234\017\332{\322\301*ID\330\200"
+	.ascii	"\313\373\200s\247wd\350\323\030G\211UN\203\034\332\304/\254r"
+	.ascii	"\n\344`M\365b2i\3316\252\3579\241\177B\273\206\263k\313\r6\340"
+	.ascii	"\020t7\243\263\304\340a\255@@\323$r]\005\331D\305\b\3204\310"
+	.ascii	"\024\274\032\350\017;\247\363\005\033\036\327\033~x\357\r\242"
+	.ascii	"\304\247\346m\352\366\204\231\267|\246fx\\AY\314\304<\374\270"
+	.ascii	"\305\377=\2463\251\241\350v\3156(\306i\215*\324\215\027\327\016"
+	.ascii	"MR~\244\320\363O\032H(a\232\312\340\3212\203\t\317\336\024\006"
+	.ascii	"Y\023\247L\274\235\177&A\032\315Pe\224b\253FG\322\314I\030\304"
+	.ascii	"\253\016\225\007\337N\322\250\2214kqW\345\211\262\351\345\360"
+	.ascii	"\350\202\027\365\332Mq\274\254\350(\376\223\353\350\222\310\200"
+	.ascii	")\303\334\354\3700\202l*b\004H\0327\204D\223\220)\030\200\244"
+	.ascii	"p0\270Q\261\371'\337\274\315\367U\210\224(2\030\344\346\253\366"
+	.ascii	"l^\313"
+	.string	"\331\243J\023\205\273\253\3511m\335\262\304^s`P\221#\376\263\335|\244nU\240^#]\346$\n\016\003\022\256\211\370Hm\230\365\013$\\p\322\343B<\253B\245\220\274\341\035\306Bf\325\027C\305\215\246\223+\2705\357\327\247\277%Wp\253\361\354Y\216(C\022\250@\207\377d\256\376\361\031\2454\204\304gN\256\371\016$\222\032\033\222\260+\315\313<\361y\362\300\232\303\247\251\322\274\304\025\376\360\201\362\300\336f^\370\255\034\323\345Y\034\216#\251#\370\276-\252\330\327\234\205\344\216\244[\262\205d\013n\377f\276\245M\304v\346l\306\001\177\240\331u\277\200{\213\001\267\305\350\205$\234w\230\314w\016>Rf\213\303\332\223\231N\376p\203\337U!{C\316\234\f2\200wX\360\273\207\323\353\271\330X\227\255\276<\314\"X\231\177\376\367[N\035\230\352k\302]\264\317\3125\027\254\001\2126\221e\242"
+	.ascii	"\021\036\310 \005\n\020PX\235\260RQs\201\025\007*L\374"
+	.ascii	"R0\200u\200\006'\262P\204P\242hu\301\225\002*\254:\260\262\262"
+	.ascii	"`\206\241\216!\240\252B\034\243\234r\254\262Ld\225\300\302\262"
+	.ascii	":q\245\242\003+\025D>\341d\205\201\t\254\rP\230\300\340)K\203"
+	.ascii	"\fPl\200\301S\n\024&8x:\241\002\353\311\351\207\257:\260R\361"
+	.ascii	"\224uu\245\342I\250\245Gt\275\327\024\002\036\205\205\205\226"
+	.ascii	"\022\224\004)\322}\201\036[\250\251\217z1\367\352(\0353<\354"
+	.ascii	"\365\325\"\365O#L\276^D}\032\027]H\225\323''\007\353\035\027"
+	.ascii	"l\312i\223C\333\231\034L\311\301J\270\bSN\221\034\332\334\036"
+	.ascii	"Q\275\3738\264\213J+\312i\217\321\301\332\250dA9-:t\001\240\030"
+	.ascii	"?\035\237\235\216\317M\307g\246\343\263\322\361\031\251\352\371"
+	.ascii	"\250\352\331\347\370\334s|6\036\237\213\307\347\026x\374\251"
+	.ascii	"\207\032\203\0017\345\376>F|6\233\005\003e\3059\353g\215\031"
+	.ascii	"\230Y\340\360=\264x \251\325\030{sSB\243\372\364;\330\220\204"
+	.ascii	"]\235^\351\237\036\230\007\326lz'\317\321L\337\364?y`oK\317\204"
+	.ascii	"\343s$u"
+	.string	"<\216%\242\246\njS\245o&N%2\320\232H\025\363\224\364jH\243_\001\304#}\322\363\344=\323@|/A\372\316\241\007\r'\366\352\004\007D\265\273\361)\274\223\n\345\250\331bZ\001\327\350\217\276\225efF\337\264VlR\365\320\343F^S\321\267\027!{\215t\211\276\350\313\210\276\245{e]\236\355\301f\307\364Ov\260\376\300g@\027\0269x\207}\370fR\231T_!>;\270\245\177\362\320\013I\221\201\f\306\030\372)\241\3072R\225(Q\223x\263\211\3248<.\027\223\364\204\021e\346P_\260\301$\261<\322\343\322#\350\231Y`\337\004d\220\332\013\027K\330\265\353\177>\350y\210\2005_\f\031\3740\240\357\351\317\367\235\263\310\002L\016\325\255\372>X\207]\275\177\\\017\357\363\255\214\361^\036>h\255,\207j\343\204\376\200\t\202*\343\271H\374\313\004\203\257M\f\322H-\214"
+	.ascii	"z\\\214Tf\025\026(. \215`#+d\357\273h\216,\355\350\2373\316\254"
+	.ascii	"\224\"\367\322\334\n\035\277\252\303\367\024\247d\247l\241\""
+	.ascii	"\205\312,\304\370\027d\020\333\341\217\232\332\363\"\232\332"
+	.ascii	"3F\224\004\255?\254\001\202\205\250\022\0211\224Z\245\314\320"
+	.ascii	"\210H\222$\031\016\262\n\020\206\203a\032\310\262\007\022\340"
+	.ascii	"CE\nt\212)\251\221\221$Ii\3307\332\373\203q\236C\035\b\2436O"
+	.ascii	".\265\247\360\234U\231\351\344\226\247\260\270\261\263y\005D"
+	.ascii	";w&\240\300\264\347S\251\303\002\377]h\266\200?\272\037\206\304"
+	.ascii	"qo\323\263\007j\220\202B\341DI\0046\323u-\3745g\246\2254\bC\237"
+	.ascii	"\365\334\b-\372\006-\324\203\026`\005G\003>|=\221\001Qr\321\214"
+	.ascii	"\376\030X\260<\347}\243+f\214\177RD\306\205\354r\235h\006\245"
+	.ascii	"i&KpeK\213\264G\030\245\246\013\343\243\247\306\334\356\244&"
+	.ascii	"5\024\rJ\307\334\200\231\334\215\031\260\035.\3166 )[,\n]\203"
+	.ascii	"\310\034d_!\343\253\337\201lC/\2462\314O6q\017)X\001])\2704\313"
+	.ascii	"\370\021\025\340\263\006?(}\272Nk\210-\330C\315\\\320\265\207"
+	.ascii	"DN\235\223\241\354f\251\016\"\325q\226\315\277\213\260@w\230"
+	.ascii	"\323\246\253X\216\246N\301|\301m\263\245\034\357\260'\367\250"
+	.ascii	"\020\003"
+	.string	"9\200\t\310ZWGh\226\355\364\301J\343'F\340\273Y\270\037?\336\231\003X\276\"\342J\003\370\256<:\367\036>\026\004\352T`e\343b\rs#\2132\376\237\366\"\352\222Xn\216\211\303!\346\374\263\233\304;\211\034\230\032p\242\023j\331\033\233q\r\370\017\312\224,\032<'\332Nt\322\214\235x\202\255\226\365d\316\275\034\t\032jPTy\305\0179\362\215\200\267Y\365\370\334_R\334\353\"%\355l\211\3228\207&V(Jq\356^\233\234\222#\353C\265\355\001<\312}P\034\230\017T\250\317\354\r\241\256P\t\021e\002xr\026B9\312\243f\212\206\212~\235y\326\350\257\323\276\323\247\235\272p\340\351P\206[{\257\270\026V\317u\220\t\276~\303u\341\341\307\300\376h0C\3429\203U\341j\354\001\35364A7!L\033\022\225t\307\3140\3348\343+rVk\246F\017\234\324\020\242\364"
+	.string	"h]\344\344\2562v\032\004l\275\005w\364\310\245,\371?/\333\204#s\031\301\264V\020,b\276L\330\004\2079\271\013\214gs\200\003\034\221\337\261\222bw\313;\365\366\207\263\3259Y9\306\226\344\234\177\"\335\375\336o\201\325s=AjC\300r\305\371?i\307\r\320\231\354j1D0\273\033\332*\002\355\243\217\323\331\006\353\222b_\bi\0061\f\204\232\001m\022%\251?\334\204V$\204\321\247?%\033J\207!\244\232\202t\310\013\r1-\330c"
+	.string	"T\017\321\264\r|H\240\363f\301\321\204\2378\177\205!F\222\210n\302\215\371\355_J\355;~\262\206\t\245\346\005\261~\376o\224p\361\"\353\224\254DG\031Z\235\200\310C\277\320\305Y\026(\351\017\347\267x=>c\342b\370\303\251u\313\274Y\0259\016\221jUL\033y<\3774\277e\323\357z{\023\307\312\2378\230\003\004u\r+\305\256\027Z\020\223\316 \201\230\350\022\246\353\025\263\2040\242\332C\376\310\210L\004\235R\301k\336\345\276!\222\330h\227\226\312\271\301\327\374\002\177\360\222\227:\236\313\034Y\022\222"
+	.string	"\330F\"x\324\2275q\031\343\035W\315\272j~\361(\251\360\226d/\234-@ZB\257\256\324\245\031h\316\025\251\313Z\016\234\030\301!\240\210R\351\231GH\306\007|\024\311]g\221\263\t\354D\323\364w\036\202\355\224A\253\220\346\352,\034\016\276O!L\271\031\031J\223r2e\225\252\022\311s9\254^\213\317\243Wm\355\210\315o\351B\034u\222\327>\230\367\374\355r\213R,\307\n!\214\f\307\0133\311{0\205\262]IP\265rj<a\334\3174\205\006\377\002f\344\242\033\375Y[\224\267\005\247\352\267\32042\204\020\311\246\327HVBF\n/\205\366I\302u\217\305\"\270\226%\006+\0350\300Z\340"
+	.string	"f\2164\236\203'\310\331\277\fr\221\025\356g\233~\004\003\335*E!\371C/\240Gf:M\232\262\275\366x\257Y]\nq\263`\\\335\006_<"
+	.string	"fK\2477a\004\337\246\2034\231\231\234\257%\035\035\305\2715<\"\005WC\324\013\326p\367\330x\350\020\306\301K\376Q\307G\033oj:U\300\363\b=\b\021\324i\256\344$\241\356\2248\037\361\360\370\300\"je\370k\204\252\317\306&\336[)>\257\r\214\t\007\352K\257f\235\343\030\364i\201\322\273\2027T\236X"
+	.string	"\\\007\351u&\335\252S\261\016'[\247=\030\347hU/\332\261\330\325"
+	.ascii	"\260\346\226\213O\211\355z\355\324\345\355\202\2421<\221\026"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\177\002\275\r"
+	.string	"\206\026VC\360T\225\016T\234\357\337+4\001\371\260\233\334\221\"\3369cl~\353\337*\n\227\264\303\003o\214\"\0221\214Yo\353\016\345r\016<\003\027\177\317\313\"^\007\351\300\216\370\366d\262\200f\252\001\244%\"SA"
+	.string	"H"
+	.string	"B"
+	.string	"\233\201\300\216\006,\006\317^\350\304\371\352\254\205\216c\037\033\337B\3174\326\001\232\2428\216T\271\025p\r\2443\n\001\022\274\333:\316"
+	.string	"\"\317\366e\212\342t\331k\337V\250e\3169\277\335\320\331\376\2116\b\353\332\203\365\016\007k\232\3169\355O\222\006k\231\332&N)\324\b\023\003\n\236MJ\221D\244J\250\322\351\203\251D\310:\246XP\3013N\006\256\245`\235#\301:\206`\215\343\300\032f`;\024X\016\240\325\360\t-\225!\376\025\306j\344\374\272\222\321(u\3024\371Q\243TP\212\211\253\363\353\rRC\026\263#'%\370k\n\251\256\265 i\233_UF\315\330r6<\377e\004}\225i|\321\272Gh\315#\302:\326\230\216T\271\225\177\031"
+	.string	"\367\200\3717\206\377W\252\305H\214 \340\3379\321#Aa\371\007Aj\t\314%\004\374C\274P\313\213\205\342\337Tj~\022\244\206\260\031D6\377I\324O\021\027*\374\243D\305\004, "
+	.ascii	"\0031\2426\024\321*\003\272I\212Y++\004]Z[\314\177\024\2105\312"
+	.ascii	"\026\260\215wd\363x;\007\247\316A\022$A2\220\274\202\266\222"
+	.ascii	"\245\221R\260dV\345m\350\244\276\314\361\021\342\217\364\r\337"
+	.ascii	"\370\215\337\370\215\337\310\217\215\026I\037\021\343\215\267"
+	.ascii	"\2612\034\364s!2`e"
+	.text
+	.section	.gnu.lto_.refs.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"e\007"
+	.string	"\342\215',pM\322\030\206\237\305\366a\261\220\002\3709y@}\204\245\253r\327\377\377\377\317\027\035\021G|-B\215\020\310'\220\277\311\336D\246\024Z\356\356r.!\005\026\333J\323|u\262\251\233\226\002\"\241\237\223\340\275\274\003o\345\245^\351\215\336\366\336\t"
+	.ascii	"y\bH\246\343\364\r\215\f\214\013\013\246WPLHD\254\035b\351\017"
+	.ascii	"\016\357\r\353\fm_Hi+\212\243\236\230\224\220\234:\"\222\371"
+	.ascii	"\360x\345X\023^\204\367\340\324\340\305\234\026\254\021\323\266"
+	.ascii	"l0Z\336j\235\336\347t\275\367:\272B% \300\"K\316\001*\005\356"
+	.ascii	"\034\307f\367\f\247zl\341\026\316ai\21456\t\311\345\2200\220"
+	.ascii	"\220\344\240\027\025\204Hq\213jq\354\301\252\020\214k\210\022"
+	.ascii	"\342\0043\004#<,V8\\0B\260Q\342\b\246\020\207\361\222\301x\002"
+	.text
+	.section	.gnu.lto_.decls.bfe4f0848ed29393,"e",@progbits
+	.string	"(\265/\375`\315%]\252"
+	.ascii	"\332\016\355;[0JAI\351\356\313\034ZA\316\356rv\237\245\020u\226"
+	.ascii	"eM\327\033\373\220\002J/\214\333S\216;\204\331\305\316\316\""
+	.ascii	"\254g\235\331wv&9\331*O\247\023k\257\337\217\251\303\373dWu\031"
+	.ascii	"\312M\234TQ\341M\223\324\033]\f\315P\035\325Q\032)\267\373\315"
+	.ascii	"\276\326\032\331[\246'\003\260\003\334\003\310\226\3533\250\005"
+	.ascii	"\310\240\304\3142Y\024\366\330gV\016\300\002"
+	.string	"kz`\231l\212\226\3031.3\023\320\327S\231\236\234\"g\244\300\3009\037\326\034v5'\022\377\212\301\277h\3707\f\377\022\3016[c3=X${%\307\344\362\201\337\036vwn\256=\354~\237p\2102\035\327L\013\332\3145ne\254\2333C\316\304\331\363\327\005~[\260\353\271\266`w\033\207\377\206\263 g\371\264\204\343\215\211\216K\212\fH=F\215\210iG\021,)-\224?e,\232S\250\360\220T\255\200\262$\346\244\307\222pA5\217\264\022&Wj4\233kI\207]\255&\fVE\243\211E\306\364T\006\216\203Vk+\235\005\007i\231\233\200\346\362O\024\235\214\254RR\366\326\337#x\253\365\f=\206\203\\f'\036\227\213\2472\315\376\322m\315\326k\355\326]ZL\207i0\315\245\2754\263\325Z\313;\255\267\374\\\346\214\3149\377\374\b\360\240\325\272Jg\335\2452\037\2578\r"
+	.ascii	"\205\031\231\023\270\234\227\032\364h\260k\242\204\313\330\004"
+	.ascii	"\247\365\321\302\215\326W\232\331\241\261\274\317\332\354:\244"
+	.ascii	"e^\346"
+	.string	"\234s\332\315\352\350d\317\333!\370\0039w\207]\317\315u\207\335\255\017l\355\013X'\211{\254\022~\217\301o4\374\016\303o \370\235\364\351'4\310e\016\215\02606\274\354\371\236\201\337\001\254s\326\034vL\272\211\t>\200d{\276\004\223\243\rv\303T\226\364f\317\233\200\033I'ifWo\375\334J\346\256\234\2277\027\351\211J\023{\366\200\376O@\225=\370\006\374\366\331\345\264\317\356\030\237<\273\013\232\203\326\337D\032\253\263n\222R2{\345\274\334\341\021!\253\362\262gg\3316\322\313wV\0279\002<x\017\231\261r^v\326\2313R7\0068\335\030\350\306t q\355\316[\374es\330\341\346\331\375\255fu\215d\317_\300\204\275\315!k\247\374M\305\366\023\373\377f\200\024\340o)\377\227\314\375-\367w\034\004~[\345o!1\275\3456\277\245\002\3468\377\365\260F\2000\357\375W"
+	.ascii	"\036(8\363\3628\t\363\367\f`\356\346f\301o\233\250\310\371\357"
+	.ascii	"\206\302\346\310\333\375\267\377o\351r\374\333\270\377_\330\232"
+	.ascii	"\377\325\376\267\375_\373\037\346?\230/l\367\360\037\205\377"
+	.ascii	"\025\274\347\267o\177\347\374}\363w\357o\233\277k\376\326\371"
+	.ascii	"\373\205\377\274\377V\340o\346\337J\376^\362\367\327\337L\376"
+	.ascii	"\016\363\362w\220\277\275\376F\322\345\377\315\177\253\376^\373"
+	.ascii	"\033\355\357\263\277\315\376\206\362\267\330\337V\177\013\377"
+	.ascii	"\206\361\267\323\337L\177/\375\275\342o"
+	.string	"\025\177\243\370\373\370w\376\333\003\177w\340\357\023\177\257\360w\361\357\r\374=\374\273\304\337\351\337C\377\301\3767\371o\344?\226\277U\370[\003\177g\340\377\223\2771\360w\n\177s\370{\303\337<\177k\370{\347\377\333\3771\377\305\374_\376\017\361\277\354\377\316\334\334\334\334\257\273\340\347\231\375\035\262\002a\3549\206'\366\002\r\207=_\223\204O\003\207y6\200n\3010-\230\036;\221[\331\251\206\207\326\2161\247\01323TA\202\261\022\240\3336\246mk\271\323\270\225\231jTh]I\301\345\fe\203+#L\313\253\006\276\027/6m\227s/\223LM\032x\260\331/l6\r\033s\356\211b\005\312\347\376H\262\030c\317\323\244\300\307kx\307\n\350v\355\315\264k\326J\347\260\021ap\315\334\004\265\001\017\315\205)\343\030\336q\002\272\345\362fZ.\366\n\t\313l\304Y\262\322\22478N\202y\212"
+	.ascii	"Y,6\313\255\026\246\325b\323\032*\033\333:(\242U\345\003.C5\371"
+	.ascii	"4\323\246\235\255\227s\005:4\030v|\331\363\030\n\377\177\357"
+	.ascii	"2RS\316\371\205n\231\233\216\275\267\256\333\347\277\351\333"
+	.ascii	"\003\370\177\346\373\337\307\204eF\352\302\n\203\1774A\212\372"
+	.ascii	"\005\371\272\263\246\244.*\243\003\250\234\220T3\222\272\250"
+	.ascii	"\262\021\271\303\270\323\224\251\214I]9\357d$\3228B2\357$ue\247"
+	.ascii	"\214\002\315\251\363\222\312\230\221\311\274\223\221\031\351"
+	.ascii	"\202$$\225SR\027\222\323NR\027\225S\356\242\312:\031\211\324"
+	.ascii	"\264\002\231\233vr\027U[\356J:\351$u%\235\222\272\250\246\372"
+	.ascii	"\313\n\252&\2479\254\2523\335#\t\231],I!5\351\234%-\223yK\316"
+	.ascii	"\355\225\"7\r g\251d\323\026\244\031\035v<sqT\202\224\354\016"
+	.ascii	"K\307\252dF\236%\301\220\314\031\206#Q^\352\300\270<\313!\350"
+	.ascii	"3#\016\251\254\224\"\347\t\226r6v>\3139\033s\316\274&\251e\316"
+	.ascii	"5t\222\224KK9C\365,e)\243X\212\234\255\227Z\230SRWU\362G\fI\227"
+	.ascii	"2\253X\032[\231\267P5\341.\243VV\31297\030\254t\202\341fO\213"
+	.ascii	"\266\241\205-\"W\360Y\017\0162cE\215\300\232\365\226\242$\311"
+	.ascii	"b\317\363\226\226\312\224\262^&\207\310\331\363\266\354\267Q"
+	.ascii	"\254\224\316\322\311\234\221\215\202m\251\214=m\2629\3542h\236"
+	.ascii	"\235\235\341\347\026\n\216\323\220#_\366\334\261d=3\037`b\366"
+	.ascii	"\313\3560\323\344\252!\245\224\252q\306\005{\304A\322\311H\024"
+	.ascii	"-ZPjVeqa}\374??\310(u\\\221\233JB)\255\r\026h(C\260\302\210E"
+	.ascii	"b\265\354\023\313e\235X%v\211-b\303,\323\212\331\021\330$\026"
+	.ascii	"\314z\331.{\3042\261cvi\267l\023\213e\263\232i\277\354\220[\031"
+	.ascii	",\221\237\226\005\216\245\034Y\222\354\013V-\2608\0035\325\024"
+	.ascii	"\301\031\345\325\2342*\312\262\350\321rI\252\312\320\260\301"
+	.ascii	"\343\377Q^\211S~\331\030\254\220\273T\322\250\250\372\322\304"
+	.ascii	"\372\2623\354\361.\303\260\212#VM{\203J'\037\2630}Y\030\032\220"
+	.ascii	"\343\204\b)QF\215\252\203\323\032\340\006\276\025\"\247\201,"
+	.ascii	"\001\357\307\234\0137{Z ?\267AxvMP\313\354\025\200%cb\366\344"
+	.ascii	"\361\242\360y+\360we\360\275\276\340\357\252\340C\331\215\341"
+	.ascii	"\357\212\340\357\256\360wL\370;$|\335\033\276n\r\373d\301\327"
+	.ascii	"M\301\3279\301\327q\341\353\256\360\267\350`\3407\345\360\341"
+	.ascii	"N.\370'\031\376\211\004\377\324\201\177\336\300?e<y\300H'`XV"
+	.ascii	"\306W\214\016\274 bS.\300\360\271!\243\345(\304\276\260Lx\211"
+	.ascii	"G\0132\354y\016T\264\034\316\315\231\005\246\022\253\3110i\346"
+	.ascii	"l\233\254\013\273d\225l\013\353\324L\313d\223nWX\026\267gznI"
+	.ascii	"3n\277`~\301\330\013\346\316\315\355\212`I\322\264W\326\316<"
+	.ascii	"Q\263\347\022\253\307\304t\225\274lV\302\226\250X/V6OK\245'\366"
+	.ascii	"\334aj\321r\327\272I\21777[\003\214Y\016\265\337\265\2323)\332"
+	.ascii	"\300.\227\020jW;\354y\267\330\031-|\274\350r\323\262\340\235"
+	.ascii	"2,X\356qC[\217\035c\264\254\2760a\202w\322\320\320lZ\317\017"
+	.ascii	"\255\016\003#\213\341\b\336\371rvv\241\364$\215m>=\304\256\244"
+	.ascii	"xMl"
+	.ascii	"(\227~`\r3\244H\271f=I\243\233O\225\036;\306\320\220\231)\205"
+	.ascii	"\300\354R\251\211R*!b\317;\2457\227v%\213\352\226\341\260\300"
+	.ascii	"\032\216dd\027\312\217\326\225\224\220\363\215,\207\214;\303"
+	.ascii	"/\024{\2649\306\232\234\331*\2755\252\026hd\260\206* 'N\356\223"
+	.ascii	"\336\312L\273$blp>6PeXdO\306\256Z\2203\036cx\007+\307/\f\315"
+	.ascii	"\2749\256\330M\202\312/\022\300\303\250\023\303\"\t\210=\303"
+	.ascii	"\224t\2640\343\205\317\001\221[\004\b\227\237!7\b\326Z\023\310"
+	.ascii	"\025\322\245\371u\227\\&\027\3546i\346Ur\215\274\271n\f\3571"
+	.ascii	"\273J\256\fjXJn\326M\322gP:\031\311\004\256ysC\005s\252w\002"
+	.ascii	"\271\227\n\216I$\030ak\336$wy\221\364\031\3242\277\260Y\322\266"
+	.ascii	"\366\344u\231\315\274I\336\263\314\032h\320\341&\216\013\234"
+	.ascii	"\221\035\222{$\214E\224\n{\336\256\356*k\201c\306V3/W\216\n\037"
+	.ascii	"r;\354y\265\356e\205\221E\213\217\2352\304\210P\261\347ob\340"
+	.ascii	"\337\270\300\2771^,\234\245i\303,\016\277\367\206\337s\303\357"
+	.ascii	"\251\t\271A\272\244\2041\013b\257PQ:j\30167\207\335\355q\177"
+	.ascii	"\344\310\020\346\002\230\217\t\344\250\002f\317Si\313x(\227x"
+	.ascii	"\340l\331\301\324\332\241\003\233\013C\303\236W\007N\321\203"
+	.ascii	"\342\241\306\006\223\251({\376\352\370\357\223\275\301\2019\271"
+	.ascii	"7{\336\253\237_\021\330\230\2215\263\354\331\353-\361\316\026"
+	.ascii	"P\017\351+\343\367\205+\343ZY\255\245\021\207\351\206\324\006"
+	.ascii	"+\363\005,\366<[N\231qE\261\347\255\272-\\\027~\032\032'JW\244"
+	.ascii	"\204\340_\0345Vh:b\260\247\355\217\355\356\215_\252\237\206\207"
+	.ascii	"\325\204d\376\300\277S7\371\323\\\271)NV\330\363\275+\374\313"
+	.ascii	"\002\b\326n\f\261\347\265\201S\364\244<\320\250my\271\262\347"
+	.ascii	"\257\215\377B\331\251+\245\001\253\024\005\365\305\236\267\306"
+	.ascii	"\215\372\225\2724\362\225\352 \2313\322\225\3121\2233RN7\006"
+	.ascii	"\335\030\2342T\361\370\332\235\357\315\3008\315\263\273O?\277"
+	.ascii	"3,\017\257\2622{\336\330\300a\rm0`\030Q\352\244\360\320b\206"
+	.ascii	"5\27499\355P\332`[\253\332\302\032\344.\323e\312b\245\344\021"
+	.ascii	"A#\222\203\007\3469\266hq\227\216D5k\240B0\005\346*\375."
+	.string	"\235W\262\264l\261\347\305\364\330\177\232\235\031\223\2312Q\230\247\306\212\313b\305\006\261\032\260\027J.\366\274\215\021\363\210]\025W\005\003\270\2444wJ2/H.\230g\006\024Gq\217$d\005\210U\371\020\302\023S\322\305\f\024\314c\345\"]\344E\272G\022\214\033\206\030wO\340\302\314\331\363\036\263hz\374\250R\342\302<kss7\323\270e\020\244\307\231\302\310\023\227=\237;\314\006\312\312\251+\006\314\363&'w\245\264\241\201f$\212\025\346\221\213\263i8\367\320\021\203\305\222\032\030'\005\320-\031\246%c\313:\207u\316_G\253f\317\230B.\n\006\336A\001t+\346\315\264b\354\233\003\274\222\371\205\001\306\224qB\340r\206\332\300\346\313\331\231\253\021QX\202\210\023A\"1\204\025\206\0238!B\004~\"P\023?\0222\3009\321\007\020\303T\002\324\327SQ\"\212\252\260\013A\035\216(\226"
+	.string	"\246k1\205b\n\200\"\365WLGX\241\b\027\323\240\035\324\247S4B\301\b\030\374\001%\030\201\006U\370\tQ\235\023}(\202(\252\250\211T\r*\246\301`Z\264[O\364\201h4T\207|*\272\242E?\365G\004\221\001Ph4bE\2136B!\253+\372z\253O8D\324\t\207\210\027\345@Z<\213ET\r\n\372\361\324\225x\177sB]\213\351\020J\302\027\204\n\207\322\340\217\027\204\026\215N Z\344\375\267\376\202|C\304\0178\352\217\bx\006\211E(\nC\304"
+	.string	"X@h\002ZdTDI\004\tQb\321\350\204#\022B\023HtX\325\337z\202\004h\261\004\t\024KXSa\t=\022@u\267\346\234\350C18TW\240\n\002X\242\370\223\200p\230\002\325\r'\372"
+	.string	"\364\241E\351*4RA"
+	.string	"\0050$L\213\324\237\rO\210\017\253\372#~X\177A\304\024&(B\327\342\211\023n\016<0UQ!:\204\337\301\007\007\370"
+	.string	"\204#\336A"
+	.string	"\n\001\024bw\020\200~~\200>\370\301\377\340\347\256\250\2578\364\013\216\3309\321\207#\025\304\221\312s\244\326\020\177E@U\247\242A\251\211#5\370KU\264\270#\034\246\305\242\221\nE\234#4H4\032A(\370#\252\t\016\201\303u\250\022s\202R\232Uh4\004\372\204T_J,\372\216T\tv\206\253\321\317\027$LU\360\255\277\242\257\310H]K\240\304\"\005=4\370\003\026kV\0255!L}i\261\250\332"
+	.ascii	"\325\240\264H'L\213p\t J\004<\372\025\341\234\242\210\340\317"
+	.ascii	"\204p\230\256\277\340\220\250\242\253\260\004\240*\001J<\201"
+	.ascii	"\202\212\256\301t\004\007\016\220 $4\\\215D\f\tS\242u8,:\001"
+	.ascii	"\250\362\024QT"
+	.string	"\035BG@\203C\302\020\212~\"L\020\2054\004Q\241\360G\004\364\035\031\375r\202\202C\242\"\252\022\241\200\256\277\020\320\240\241\004\324\364\327#L\201h\321\310w\364+\362\035\2516E\337P*$\034\212\320\301\021\022\032\356\020\001\327t\205\242/\030LK\3706\340\023\277 \032\344[a\030\364Q\260\372@\340\241\252Q\020\n\034\252D\237\206\023Y\360!\021UA\254\303\241\n\302\246\350[}\037\374\254\302\224W\\\205\250\tt7$L\325\341\232\n\207E5\250\211t\005\376v\250j\244\362\220\340\020L\177#\202\322\340\317\004\317\n\303\b\240\301u\035\252D\353\316\032B\020JTL\205\351\bT\204\240\240\321\220\350\204!a\032$\374\005;pX}\b\340`\025\246FxE\213\250J\201\240a\252\242\024\370\255\277\021\216H\f\tS\023)\nDU\nP\037\005r\320\342\217\210\250C}$8<\004\007 \204\370"
+	.string	"\004\016~>l\270\002\024 \342\202\024&\360"
+	.string	"\f\374\200\n\375\212\301\364'\004b%\032J\203B \204\351\257\b\004P-\202\370P\001\272\376\326\023J\b\323\b\034\2516\301\341P\004\237.\305Z\r\222 k^(\356Q\0047\245\026\220o/\270\250\311\260\347ri\023\306\0023\006\3225\313_\214\2748\215=\306d;kaO\036\034sg\236\263i\035dY9\202y\216\310\3353W\356\036;7\205 \322\226\223\304\033b\274]3o7\216\306\270\233\022\005*\206O\\\031\3346\025CL\0312\027\005\214\264\253\263\245\016\206\326\r5{\302\331\244e\316=9Sd\272\020\261\347s\234\306\330\264\223I\303\252J\314\223\234\025,\260\305\3310\027\n\316\223\2153\031\366\274m7\203\024\250\202\351<\211\302\n!4##2\222&I\0072\n\020\006\304i\030\b\356\r\022"
+	.ascii	"\024A\322B\306\214\314\210\210H\222\222T\262\354\006\351(P\307"
+	.ascii	"U\3607\204z\334\315N\360y\252\020x\255\201\356\267\"\202\305"
+	.ascii	"\374cXyS\246\303\233\22602,\377\331\021#\205}(\235Bo\342\310"
+	.ascii	",&\3201\273\302\274\376],\377\234M\304v\250\204\211\021\026\376"
+	.ascii	"\305\207\275\337\230\326\201\276\322\305\337P\306)\r\t/mnq?H"
+	.ascii	"+/2p\3365\006\177\222\266C,/t"
+	.string	"9_\007\035t\f\327s\247K\0012\fHH\2210\206 &\205\\\213\2577\243\302.\212x\240$\013k\227\027\232@-\026$'\265\366M\221}e@y\223\017\316*\002\300\274\263\036l\270\251fHe\240\236\324\022\340KH1\020y\206\340\335\005sRjJ\315\350Ggg\302\203\264\036R\262\254\346\035_\017BR\f\313\375V>\343S\247\227\227/9\342\221}f\323|\026/\371\357\225\356\035\201\357\216\021p\331\315\371#:\350\002lv\310\331\212`\325\340m\243\006S\025\354\274o\035\350\327s\316\227z\013\267\235\376\217\272\036\005&\330>oS\262\361\b\366G\337RV\2022'^\022\242\0314M\255-\f\004\022\213\322\243-\305x(\234\220\367\333\264\376\215\201W\370\021\374\222\337\3646\230qE\032N\307Je>\017H"
+	.string	"\256\\<\210\240`}l\237D\017Q}\"\267yeU\274\032\036\0303\314\225p\2011/=\244\264\262\375\363\3560\266\026\r\304\3718[E\361k\301\272;\264\030\311\034\n\030"
+	.string	"\350\342U\237\314\354o\250D\331\226\025@MA(\327t\364\246D}\240HB\222Z\r\322H'\340\314hD<\216y\036\342p\305\b\225\002~"
+	.ascii	"\206F\256\360\343u\277\221*\201\004K;;me\204\221c(#N>A~5\234"
+	.ascii	"T]&\216\345\032\361\232\036\030\372\234\304\240\030\201\356."
+	.ascii	"]rA\211\020\243\207;7\312lqwD+^\344EC\235^\215\2340\201\363\242"
+	.ascii	"l\247\326\332\366u\303\326\271\312`x{\024\006\003n\210\247kr"
+	.ascii	"69\341-\352\275\215~\336\271\263\260K\362PCN\372\214\231owD\347"
+	.ascii	"\321:>\355_\036t\250\2779\363R\343\317\f\2051\024\213\034)\345"
+	.ascii	"\376N\231\251\372x\335\326AiI:\004 \264\220+\262\212\202(\342"
+	.ascii	"l\372\t\037\374\367\221\270G\335\354\002R6\330\210\314\017\027"
+	.ascii	"\024\301\305\263\357\004Gj8\264\177\2114Y\262\355\243\344\363"
+	.ascii	"\277\314\223\361:\345\256\202\342'@FA6\317\362\250\217\212\210"
+	.ascii	"\224\341~`'c`\377d!\361b\307\376]\265(p\351\213\316\254\311\261"
+	.ascii	"t\313Ta\226=5\245\373\017\266\215Nt\237\232\033\365@+\224\210"
+	.ascii	"\244(\347\331\301\276x\222\211\033\334Q=\177\206\003a\336E\352"
+	.ascii	"\231\330\210D\300\370j\r\fJ\244\0378\271\301\331`\001\255\271"
+	.ascii	":\345\213:\304t\3715\243Iy\240\264\022!\013\276r\"\255\245\210"
+	.ascii	"\035\332\335)!Q\223\252\264\006x\374\316\233\376L\232\244\352"
+	.ascii	"y\352\021\330\200r\253\337]\3477\005\261g9@Q\346k\346\241mFF"
+	.ascii	"\316\021\"\024[\263\3315\031[\341(R\350\373\237\204\263\"T M"
+	.ascii	"\302\221~&\030\n\355\235\024\314\372\256p\022\f\352\236dA\232"
+	.ascii	";\362\345E\212\364\311D\230h\267\tJ"
+	.string	"\216p\017{\223G\220\243\331\211\201\376 \331\236\003\221\314)\351\310\232\215\217~\216\327\226\250\257l\254\324\260\270\251\002\234\024\214{X(\202M\202\212\330\215!\026\021\336\013ec\330=\257W=\251\236\355\355\244b88\341\021\2226\355B3U1O\3373\306\346\222\207*\306_\301\347\244pz~\224mBM\275\341R\236|\276Y&\363\031\220QDC\314\360\204C\344v\037`\275\324o\251\302Wu\317\364Z\026\213\020\345$\t\233J\304*\371\341\374a\257\235\365'\031\2073g\230_\225b\350\025\016yA\027\210\324\270\253v\225\342+G\350\033\t\354&\233Ex\370\200\r\317\324a+\036\023\0248\321\016\3363\246o\200l\t!\366b:\355\212I\n\327\243b\326o\223MD\300Gi\347S)\344\260xQ5X\271*pF\tf\264\032\261\313\367\312\205h\374\202y\022\235\265\227!\210$8\021\007\366R"
+	.string	"L\375\236P\213H\371\260\005\037\246\216\003\316\216Y\367o\353L\264\366\236\343\263\264\235\342\307\302\361~\334!\307\262\243{r\205*\351\003'`\035\263\004\252t\036EO\344>\b\362\223\240\370\372q\216\224BZ\302\231\365\037\315\003|\232\366\345\005\252N\007\376\030\227\245\021\307X\016\030\341ixg\013\261,\333\204\263L\024hk\356\363\206\262\021\301\rs\032\254\327\034[2"
+	.ascii	"jp\275\036J\233\354\263\367\211\002\030\244>\202Xvm(,\240C\350"
+	.ascii	"3z\215d\025[\\\350\r\225\377\216\005\024\334\230\207\257Z\337"
+	.ascii	"\222Y@\254\300\277B\246\362\304\352\231\354\260\017\036 D2\b"
+	.ascii	"4\205\300u\314d\277TPa\275\306\240\312\306\266\272\022\232\202"
+	.ascii	"\331S\200\034\321:\034\373C\307\023\342\355+/|\334!\344,\303"
+	.ascii	"\355\001\257\301^\ri\202\236=\022\313{\202\027w_\245\275\034"
+	.ascii	"s/_\275\017\373\267\200s)\271\017\366>\3469\326~,v\347\364#\346"
+	.ascii	"k\303U\347\350\315\013;\r\256\272\305\227'\326E\037\234\257\317"
+	.ascii	"\337\007\236\374\b\244agO\337a\334\375\270\347\237\177\271\345"
+	.ascii	"\253F\346\b\277j5\034\346\305\270\217\210!\315;\273\227g\\\250"
+	.ascii	"G\361\225\271\355\314\023\250C\002<_\334h~T8\371\371\300z\323"
+	.ascii	"}\304y\2340E\314\253\316o\220G\250\226!>E\213\272\243\023\220"
+	.ascii	"^\204\027\020x?\r\2009[~ \005[\320\3160\376\361\276Y\036\265"
+	.ascii	"\247\361\276\333\245\036\017\004\326R\316`\261\300\323\b\347"
+	.ascii	"\216\3607\020|\303\2748?|\007\f\f\317\007\262\3677\304\204\037"
+	.ascii	"^{\220\275Y\023\377\236\354\355\242P+"
+	.text
+	.section	.gnu.lto_.symtab.bfe4f0848ed29393,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\001"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\001"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"mwDisarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"isUsingSticksForArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bfe4f0848ed29393,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
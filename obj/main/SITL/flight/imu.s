@@ -0,0 +1,17984 @@
+	.file	"imu.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/maths.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/fc/runtime_config.h"
+	.file 8 "./src/main/common/time.h"
+	.file 9 "./src/main/flight/imu.h"
+	.file 10 "./src/main/drivers/io_types.h"
+	.file 11 "./src/main/flight/pid.h"
+	.file 12 "./src/main/drivers/sensor.h"
+	.file 13 "./src/main/drivers/accgyro.h"
+	.file 14 "./src/main/drivers/accgyro_mpu.h"
+	.file 15 "./src/main/sensors/sensors.h"
+	.file 16 "./src/main/sensors/acceleration.h"
+	.file 17 "./src/main/drivers/resource.h"
+	.file 18 "./src/main/sensors/compass.h"
+	.file 19 "./src/main/sensors/gyro.h"
+	.file 20 "./src/main/flight/imu.c"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 22 "./src/main/drivers/system.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	imu.c.4b4bc25a
+	.weak	imu.c.4b4bc25a
+imu.c.4b4bc25a:
+	.long	0xfae
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x24
+	.long	.LASF2586
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2308
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2309
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2310
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2311
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2312
+	.uleb128 0x3
+	.long	.LASF2313
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2314
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2315
+	.uleb128 0x3
+	.long	.LASF2316
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2317
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2318
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2319
+	.uleb128 0x26
+	.byte	0x8
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2320
+	.uleb128 0x3
+	.long	.LASF2321
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF2322
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2323
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF2324
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF2325
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2326
+	.uleb128 0x15
+	.long	0xdb
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2327
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x106
+	.uleb128 0x19
+	.string	"X"
+	.byte	0
+	.uleb128 0x19
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x19
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2337
+	.byte	0xc
+	.byte	0x4
+	.byte	0x38
+	.byte	0x10
+	.long	0x135
+	.uleb128 0xe
+	.string	"X"
+	.byte	0x4
+	.byte	0x39
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0xe
+	.string	"Y"
+	.byte	0x4
+	.byte	0x3a
+	.byte	0xb
+	.long	0xdb
+	.byte	0x4
+	.uleb128 0xe
+	.string	"Z"
+	.byte	0x4
+	.byte	0x3b
+	.byte	0xb
+	.long	0xdb
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2328
+	.byte	0x4
+	.byte	0x3c
+	.byte	0x3
+	.long	0x106
+	.uleb128 0x1e
+	.long	.LASF2401
+	.byte	0xc
+	.byte	0x4
+	.byte	0x3e
+	.long	0x162
+	.uleb128 0x11
+	.string	"A"
+	.byte	0x4
+	.byte	0x3f
+	.byte	0xb
+	.long	0x162
+	.uleb128 0x11
+	.string	"V"
+	.byte	0x4
+	.byte	0x40
+	.byte	0x15
+	.long	0x135
+	.byte	0
+	.uleb128 0x16
+	.long	0xdb
+	.long	0x171
+	.uleb128 0x14
+	.long	0x37
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2329
+	.byte	0x4
+	.byte	0x41
+	.byte	0x3
+	.long	0x141
+	.uleb128 0x3
+	.long	.LASF2330
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xc3
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x1b7
+	.uleb128 0x17
+	.long	.LASF2331
+	.value	0xfff
+	.uleb128 0x17
+	.long	.LASF2332
+	.value	0xf000
+	.uleb128 0x17
+	.long	.LASF2333
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2335
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2336
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xf
+	.long	0x1c3
+	.uleb128 0x1f
+	.long	0x1d3
+	.uleb128 0x5
+	.long	0x96
+	.uleb128 0x5
+	.long	0x7c
+	.byte	0
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x5
+	.byte	0x35
+	.byte	0x5
+	.long	0x1f4
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x36
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x11
+	.string	"fn"
+	.byte	0x5
+	.byte	0x37
+	.byte	0x16
+	.long	0x1f4
+	.byte	0
+	.uleb128 0x7
+	.long	0x1b7
+	.uleb128 0x6
+	.long	.LASF2338
+	.byte	0x20
+	.byte	0x5
+	.byte	0x30
+	.byte	0x10
+	.long	0x248
+	.uleb128 0xe
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x31
+	.byte	0xb
+	.long	0x17d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2339
+	.byte	0x5
+	.byte	0x32
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2340
+	.byte	0x5
+	.byte	0x33
+	.byte	0xe
+	.long	0x248
+	.byte	0x8
+	.uleb128 0xe
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x34
+	.byte	0xf
+	.long	0x24d
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2341
+	.byte	0x5
+	.byte	0x38
+	.byte	0x7
+	.long	0x1d3
+	.byte	0x18
+	.byte	0
+	.uleb128 0x7
+	.long	0xb7
+	.uleb128 0x7
+	.long	0x248
+	.uleb128 0x3
+	.long	.LASF2342
+	.byte	0x5
+	.byte	0x39
+	.byte	0x3
+	.long	0x1f9
+	.uleb128 0x15
+	.long	0x252
+	.uleb128 0x27
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x7
+	.byte	0x15
+	.long	0x288
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2352
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x7
+	.byte	0x36
+	.long	0x2be
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2348
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2349
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2350
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0x10
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2353
+	.byte	0x7
+	.byte	0x42
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF2354
+	.byte	0x8
+	.byte	0x21
+	.byte	0x12
+	.long	0xcf
+	.uleb128 0xc
+	.long	.LASF2355
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0xc
+	.long	.LASF2356
+	.byte	0x9
+	.byte	0x1b
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0xc
+	.long	.LASF2357
+	.byte	0x9
+	.byte	0x1c
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x16
+	.long	0xab
+	.long	0x309
+	.uleb128 0x14
+	.long	0x37
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2358
+	.byte	0x9
+	.byte	0x1d
+	.byte	0x10
+	.long	0x2fa
+	.uleb128 0x28
+	.byte	0x6
+	.byte	0x9
+	.byte	0x22
+	.byte	0x5
+	.long	0x346
+	.uleb128 0x2
+	.long	.LASF2359
+	.byte	0x9
+	.byte	0x24
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2360
+	.byte	0x9
+	.byte	0x25
+	.byte	0x11
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0xe
+	.string	"yaw"
+	.byte	0x9
+	.byte	0x26
+	.byte	0x11
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x20
+	.byte	0x6
+	.byte	0x9
+	.byte	0x20
+	.byte	0x9
+	.long	0x368
+	.uleb128 0x11
+	.string	"raw"
+	.byte	0x9
+	.byte	0x21
+	.byte	0xd
+	.long	0x368
+	.uleb128 0x29
+	.long	.LASF2361
+	.byte	0x9
+	.byte	0x27
+	.byte	0x7
+	.long	0x315
+	.byte	0
+	.uleb128 0x16
+	.long	0x9f
+	.long	0x377
+	.uleb128 0x14
+	.long	0x37
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2362
+	.byte	0x9
+	.byte	0x28
+	.byte	0x3
+	.long	0x346
+	.uleb128 0xc
+	.long	.LASF2363
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x377
+	.uleb128 0x6
+	.long	.LASF2364
+	.byte	0x2
+	.byte	0x9
+	.byte	0x2c
+	.byte	0x10
+	.long	0x3b4
+	.uleb128 0xe
+	.string	"xy"
+	.byte	0x9
+	.byte	0x2d
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0xe
+	.string	"z"
+	.byte	0x9
+	.byte	0x2e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2365
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x3
+	.long	0x38f
+	.uleb128 0x6
+	.long	.LASF2366
+	.byte	0x8
+	.byte	0x9
+	.byte	0x31
+	.byte	0x10
+	.long	0x40f
+	.uleb128 0x2
+	.long	.LASF2367
+	.byte	0x9
+	.byte	0x32
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2368
+	.byte	0x9
+	.byte	0x33
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2369
+	.byte	0x9
+	.byte	0x34
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2370
+	.byte	0x9
+	.byte	0x35
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2371
+	.byte	0x9
+	.byte	0x36
+	.byte	0x13
+	.long	0x3b4
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2372
+	.byte	0x9
+	.byte	0x37
+	.byte	0x3
+	.long	0x3c0
+	.uleb128 0x15
+	.long	0x40f
+	.uleb128 0xc
+	.long	.LASF2373
+	.byte	0x9
+	.byte	0x39
+	.byte	0x14
+	.long	0x40f
+	.uleb128 0x6
+	.long	.LASF2374
+	.byte	0xc
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x10
+	.long	0x47b
+	.uleb128 0x2
+	.long	.LASF2368
+	.byte	0x9
+	.byte	0x3c
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2367
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xb
+	.long	0xdb
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2370
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2369
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2371
+	.byte	0x9
+	.byte	0x40
+	.byte	0x13
+	.long	0x3b4
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2375
+	.byte	0x9
+	.byte	0x41
+	.byte	0x3
+	.long	0x42c
+	.uleb128 0x3
+	.long	.LASF2376
+	.byte	0xa
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2377
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xb
+	.byte	0x23
+	.long	0x4e8
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0xa
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xc
+	.byte	0x19
+	.long	0x52a
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2393
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2396
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2398
+	.byte	0xc
+	.byte	0x23
+	.byte	0x3
+	.long	0x4e8
+	.uleb128 0x6
+	.long	.LASF2399
+	.byte	0x8
+	.byte	0xc
+	.byte	0x26
+	.byte	0xc
+	.long	0x551
+	.uleb128 0x2
+	.long	.LASF2400
+	.byte	0xc
+	.byte	0x27
+	.byte	0xe
+	.long	0x487
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2402
+	.byte	0x8
+	.byte	0xc
+	.byte	0x25
+	.long	0x56a
+	.uleb128 0x11
+	.string	"spi"
+	.byte	0xc
+	.byte	0x28
+	.byte	0x7
+	.long	0x536
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2402
+	.byte	0xc
+	.byte	0x29
+	.byte	0x3
+	.long	0x551
+	.uleb128 0x15
+	.long	0x56a
+	.uleb128 0x3
+	.long	.LASF2403
+	.byte	0xc
+	.byte	0x2f
+	.byte	0x10
+	.long	0x587
+	.uleb128 0x7
+	.long	0x58c
+	.uleb128 0x1f
+	.long	0x597
+	.uleb128 0x5
+	.long	0x597
+	.byte	0
+	.uleb128 0x7
+	.long	0x59c
+	.uleb128 0x6
+	.long	.LASF2404
+	.byte	0x60
+	.byte	0xd
+	.byte	0x44
+	.byte	0x10
+	.long	0x61f
+	.uleb128 0x2
+	.long	.LASF2405
+	.byte	0xd
+	.byte	0x45
+	.byte	0x1a
+	.long	0x57b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2406
+	.byte	0xd
+	.byte	0x46
+	.byte	0x1a
+	.long	0x61f
+	.byte	0x8
+	.uleb128 0xe
+	.string	"bus"
+	.byte	0xd
+	.byte	0x47
+	.byte	0x11
+	.long	0x56a
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2407
+	.byte	0xd
+	.byte	0x48
+	.byte	0xe
+	.long	0xc3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2408
+	.byte	0xd
+	.byte	0x49
+	.byte	0xd
+	.long	0x368
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2409
+	.byte	0xd
+	.byte	0x4a
+	.byte	0xa
+	.long	0x98
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2410
+	.byte	0xd
+	.byte	0x4b
+	.byte	0x14
+	.long	0x52a
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2411
+	.byte	0xd
+	.byte	0x4c
+	.byte	0x1a
+	.long	0x7c2
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2412
+	.byte	0xd
+	.byte	0x4d
+	.byte	0x18
+	.long	0x70a
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2413
+	.byte	0xc
+	.byte	0x30
+	.byte	0xf
+	.long	0x62b
+	.uleb128 0x7
+	.long	0x630
+	.uleb128 0x1a
+	.long	0x493
+	.long	0x63f
+	.uleb128 0x5
+	.long	0x597
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2414
+	.byte	0xe
+	.byte	0x7f
+	.byte	0xf
+	.long	0x64b
+	.uleb128 0x7
+	.long	0x650
+	.uleb128 0x1a
+	.long	0x493
+	.long	0x66e
+	.uleb128 0x5
+	.long	0x66e
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0x248
+	.byte	0
+	.uleb128 0x7
+	.long	0x576
+	.uleb128 0x3
+	.long	.LASF2415
+	.byte	0xe
+	.byte	0x80
+	.byte	0xf
+	.long	0x67f
+	.uleb128 0x7
+	.long	0x684
+	.uleb128 0x1a
+	.long	0x493
+	.long	0x69d
+	.uleb128 0x5
+	.long	0x66e
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0xb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2416
+	.byte	0xe
+	.byte	0x81
+	.byte	0xf
+	.long	0x6a9
+	.uleb128 0x7
+	.long	0x263
+	.uleb128 0x6
+	.long	.LASF2417
+	.byte	0x30
+	.byte	0xe
+	.byte	0x85
+	.byte	0x10
+	.long	0x70a
+	.uleb128 0x2
+	.long	.LASF2418
+	.byte	0xe
+	.byte	0x86
+	.byte	0x1a
+	.long	0x63f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2419
+	.byte	0xe
+	.byte	0x87
+	.byte	0x1b
+	.long	0x673
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2420
+	.byte	0xe
+	.byte	0x88
+	.byte	0x1a
+	.long	0x63f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2421
+	.byte	0xe
+	.byte	0x89
+	.byte	0x1b
+	.long	0x673
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2422
+	.byte	0xe
+	.byte	0x8a
+	.byte	0x13
+	.long	0x69d
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2423
+	.byte	0xe
+	.byte	0x8b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2424
+	.byte	0xe
+	.byte	0x8c
+	.byte	0x3
+	.long	0x6ae
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xe
+	.byte	0xaa
+	.long	0x76a
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2426
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2428
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2437
+	.byte	0xe
+	.byte	0xb7
+	.byte	0x3
+	.long	0x716
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xe
+	.byte	0xb9
+	.long	0x78e
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2439
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2440
+	.byte	0xe
+	.byte	0xbc
+	.byte	0x3
+	.long	0x776
+	.uleb128 0x6
+	.long	.LASF2441
+	.byte	0x8
+	.byte	0xe
+	.byte	0xbe
+	.byte	0x10
+	.long	0x7c2
+	.uleb128 0x2
+	.long	.LASF2442
+	.byte	0xe
+	.byte	0xbf
+	.byte	0x11
+	.long	0x76a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2443
+	.byte	0xe
+	.byte	0xc0
+	.byte	0x19
+	.long	0x78e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2444
+	.byte	0xe
+	.byte	0xc1
+	.byte	0x3
+	.long	0x79a
+	.uleb128 0x3
+	.long	.LASF2445
+	.byte	0xd
+	.byte	0x4e
+	.byte	0x3
+	.long	0x59c
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xf
+	.byte	0x14
+	.long	0x804
+	.uleb128 0x1
+	.long	.LASF2446
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2447
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2448
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2449
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2450
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xf
+	.byte	0x2d
+	.long	0x83a
+	.uleb128 0x1
+	.long	.LASF2451
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2452
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2453
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2454
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2455
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2456
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2457
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2458
+	.byte	0x78
+	.byte	0x10
+	.byte	0x2c
+	.byte	0x10
+	.long	0x87c
+	.uleb128 0xe
+	.string	"dev"
+	.byte	0x10
+	.byte	0x2d
+	.byte	0xe
+	.long	0x7ce
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2459
+	.byte	0x10
+	.byte	0x2e
+	.byte	0xe
+	.long	0xcf
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2460
+	.byte	0x10
+	.byte	0x2f
+	.byte	0xd
+	.long	0x2fa
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF2461
+	.byte	0x10
+	.byte	0x30
+	.byte	0x9
+	.long	0x493
+	.byte	0x70
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2462
+	.byte	0x10
+	.byte	0x31
+	.byte	0x3
+	.long	0x83a
+	.uleb128 0x21
+	.string	"acc"
+	.byte	0x10
+	.byte	0x33
+	.long	0x87c
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x11
+	.byte	0x14
+	.long	0x9b9
+	.uleb128 0x1
+	.long	.LASF2463
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2464
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2465
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2466
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2467
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2469
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2470
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2471
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2472
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2473
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2477
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2478
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2479
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2480
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2481
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2482
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2483
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2484
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2485
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2486
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2487
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2488
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2489
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2490
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2491
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2492
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2494
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2495
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2496
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2498
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2499
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2506
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2507
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2508
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2509
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2510
+	.byte	0x10
+	.byte	0x12
+	.byte	0x23
+	.byte	0x10
+	.long	0x9e1
+	.uleb128 0x2
+	.long	.LASF2511
+	.byte	0x12
+	.byte	0x24
+	.byte	0xd
+	.long	0x2fa
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2512
+	.byte	0x12
+	.byte	0x25
+	.byte	0xb
+	.long	0xdb
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2513
+	.byte	0x12
+	.byte	0x26
+	.byte	0x3
+	.long	0x9b9
+	.uleb128 0x21
+	.string	"mag"
+	.byte	0x12
+	.byte	0x28
+	.long	0x9e1
+	.uleb128 0x6
+	.long	.LASF2514
+	.byte	0x10
+	.byte	0x13
+	.byte	0x2c
+	.byte	0x10
+	.long	0xa20
+	.uleb128 0x2
+	.long	.LASF2515
+	.byte	0x13
+	.byte	0x2d
+	.byte	0xe
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2516
+	.byte	0x13
+	.byte	0x2e
+	.byte	0xb
+	.long	0x162
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2517
+	.byte	0x13
+	.byte	0x2f
+	.byte	0x3
+	.long	0x9f8
+	.uleb128 0xc
+	.long	.LASF2518
+	.byte	0x13
+	.byte	0x31
+	.byte	0xf
+	.long	0xa20
+	.uleb128 0x12
+	.long	0x309
+	.byte	0x3c
+	.byte	0x9
+	.uleb128 0x12
+	.long	0x2d6
+	.byte	0x3e
+	.byte	0xa
+	.uleb128 0x12
+	.long	0x2e2
+	.byte	0x3f
+	.byte	0x5
+	.uleb128 0x12
+	.long	0x2ee
+	.byte	0x40
+	.byte	0x7
+	.uleb128 0x4
+	.long	.LASF2519
+	.byte	0x42
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2520
+	.byte	0x43
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2521
+	.byte	0x44
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2512
+	.byte	0x46
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2522
+	.byte	0x48
+	.byte	0x1b
+	.long	0x47b
+	.uleb128 0xd
+	.string	"q0"
+	.byte	0x4a
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0xd
+	.string	"q1"
+	.byte	0x4a
+	.byte	0x19
+	.long	0xdb
+	.uleb128 0xd
+	.string	"q2"
+	.byte	0x4a
+	.byte	0x24
+	.long	0xdb
+	.uleb128 0xd
+	.string	"q3"
+	.byte	0x4a
+	.byte	0x2f
+	.long	0xdb
+	.uleb128 0x16
+	.long	0xdb
+	.long	0xac7
+	.uleb128 0x14
+	.long	0x37
+	.uleb128 0x14
+	.long	0x37
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2523
+	.byte	0x4b
+	.byte	0xe
+	.long	0xab3
+	.uleb128 0x12
+	.long	0x383
+	.byte	0x4d
+	.byte	0x17
+	.uleb128 0xc
+	.long	.LASF2524
+	.byte	0x14
+	.byte	0x4f
+	.byte	0x1a
+	.long	0x41b
+	.uleb128 0x12
+	.long	0x420
+	.byte	0x4f
+	.byte	0x41
+	.uleb128 0xc
+	.long	.LASF2525
+	.byte	0x14
+	.byte	0x4f
+	.byte	0x6d
+	.long	0x25e
+	.uleb128 0x2a
+	.long	0xaec
+	.byte	0x94
+	.uleb128 0x2b
+	.long	0xad9
+	.byte	0x51
+	.byte	0x13
+	.uleb128 0xf
+	.long	.LASF2526
+	.byte	0x4
+	.byte	0x51
+	.byte	0x9
+	.long	0xab
+	.long	0xb20
+	.uleb128 0x5
+	.long	0xab
+	.uleb128 0x5
+	.long	0xab
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2527
+	.byte	0x15
+	.byte	0x35
+	.byte	0x39
+	.long	0xdb
+	.long	0xb36
+	.uleb128 0x5
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF2528
+	.byte	0x15
+	.value	0x13d
+	.byte	0x11
+	.long	0x8f
+	.long	0xb4d
+	.uleb128 0x5
+	.long	0xdb
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2529
+	.byte	0x15
+	.byte	0x3b
+	.byte	0x39
+	.long	0xdb
+	.long	0xb68
+	.uleb128 0x5
+	.long	0xdb
+	.uleb128 0x5
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2587
+	.byte	0x16
+	.byte	0x1d
+	.byte	0xa
+	.long	0xcf
+	.uleb128 0xf
+	.long	.LASF2530
+	.byte	0x4
+	.byte	0x6b
+	.byte	0x7
+	.long	0xdb
+	.long	0xb8a
+	.uleb128 0x5
+	.long	0xdb
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2531
+	.byte	0x15
+	.byte	0x8f
+	.byte	0xe
+	.long	0xdb
+	.long	0xba0
+	.uleb128 0x5
+	.long	0xdb
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2532
+	.byte	0x7
+	.byte	0x47
+	.byte	0x5
+	.long	0x493
+	.long	0xbb6
+	.uleb128 0x5
+	.long	0xcf
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2533
+	.byte	0x4
+	.byte	0x6c
+	.byte	0x7
+	.long	0xdb
+	.long	0xbcc
+	.uleb128 0x5
+	.long	0xdb
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2534
+	.byte	0x4
+	.byte	0x57
+	.byte	0x7
+	.long	0xdb
+	.long	0xbe2
+	.uleb128 0x5
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2588
+	.byte	0x14
+	.value	0x1a9
+	.byte	0x9
+	.long	0x9f
+	.long	0xc0c
+	.uleb128 0x1b
+	.long	.LASF2536
+	.value	0x1a9
+	.byte	0x32
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF2535
+	.value	0x1b3
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2589
+	.byte	0x14
+	.value	0x1a4
+	.byte	0x7
+	.long	0xdb
+	.uleb128 0x30
+	.long	.LASF2569
+	.byte	0x14
+	.value	0x199
+	.byte	0x6
+	.long	0xc33
+	.uleb128 0x1b
+	.long	.LASF2537
+	.value	0x199
+	.byte	0x21
+	.long	0x2ca
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF2546
+	.byte	0x14
+	.value	0x174
+	.byte	0xd
+	.long	0xc95
+	.uleb128 0x1b
+	.long	.LASF2537
+	.value	0x174
+	.byte	0x34
+	.long	0x2ca
+	.uleb128 0x8
+	.long	.LASF2538
+	.value	0x176
+	.byte	0x15
+	.long	0xcf
+	.uleb128 0x8
+	.long	.LASF2539
+	.value	0x177
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x8
+	.long	.LASF2540
+	.value	0x178
+	.byte	0x9
+	.long	0x493
+	.uleb128 0x8
+	.long	.LASF2541
+	.value	0x179
+	.byte	0x9
+	.long	0x493
+	.uleb128 0x8
+	.long	.LASF2542
+	.value	0x17a
+	.byte	0x9
+	.long	0x493
+	.uleb128 0x8
+	.long	.LASF2543
+	.value	0x17c
+	.byte	0xe
+	.long	0xcf
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF2557
+	.byte	0x14
+	.value	0x16f
+	.byte	0xc
+	.long	0x493
+	.uleb128 0x33
+	.long	.LASF2560
+	.byte	0x14
+	.value	0x162
+	.byte	0xc
+	.long	0x493
+	.long	0xcce
+	.uleb128 0x8
+	.long	.LASF2544
+	.value	0x164
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x22
+	.uleb128 0x8
+	.long	.LASF2545
+	.value	0x165
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2590
+	.byte	0x14
+	.value	0x150
+	.byte	0xd
+	.uleb128 0x18
+	.long	.LASF2547
+	.byte	0xe2
+	.long	0xe35
+	.uleb128 0x9
+	.string	"dt"
+	.byte	0xe2
+	.byte	0x27
+	.long	0xdb
+	.uleb128 0x9
+	.string	"gx"
+	.byte	0xe2
+	.byte	0x31
+	.long	0xdb
+	.uleb128 0x9
+	.string	"gy"
+	.byte	0xe2
+	.byte	0x3b
+	.long	0xdb
+	.uleb128 0x9
+	.string	"gz"
+	.byte	0xe2
+	.byte	0x45
+	.long	0xdb
+	.uleb128 0x10
+	.long	.LASF2540
+	.byte	0xe3
+	.byte	0x25
+	.long	0x493
+	.uleb128 0x9
+	.string	"ax"
+	.byte	0xe3
+	.byte	0x33
+	.long	0xdb
+	.uleb128 0x9
+	.string	"ay"
+	.byte	0xe3
+	.byte	0x3d
+	.long	0xdb
+	.uleb128 0x9
+	.string	"az"
+	.byte	0xe3
+	.byte	0x47
+	.long	0xdb
+	.uleb128 0x10
+	.long	.LASF2541
+	.byte	0xe4
+	.byte	0x25
+	.long	0x493
+	.uleb128 0x9
+	.string	"mx"
+	.byte	0xe4
+	.byte	0x33
+	.long	0xdb
+	.uleb128 0x9
+	.string	"my"
+	.byte	0xe4
+	.byte	0x3d
+	.long	0xdb
+	.uleb128 0x9
+	.string	"mz"
+	.byte	0xe4
+	.byte	0x47
+	.long	0xdb
+	.uleb128 0x10
+	.long	.LASF2542
+	.byte	0xe5
+	.byte	0x25
+	.long	0x493
+	.uleb128 0x10
+	.long	.LASF2548
+	.byte	0xe5
+	.byte	0x33
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2549
+	.byte	0xe7
+	.byte	0x12
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2550
+	.byte	0xe7
+	.byte	0x26
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2551
+	.byte	0xe7
+	.byte	0x3a
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2552
+	.byte	0xea
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0xd
+	.string	"ez"
+	.byte	0xed
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0xd
+	.string	"ex"
+	.byte	0xf6
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0xd
+	.string	"ey"
+	.byte	0xf6
+	.byte	0x13
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2553
+	.byte	0xf7
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x8
+	.long	.LASF2554
+	.value	0x131
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0x13
+	.string	"qa"
+	.value	0x13d
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0x13
+	.string	"qb"
+	.value	0x13e
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0x13
+	.string	"qc"
+	.value	0x13f
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0x35
+	.long	0xe26
+	.uleb128 0x13
+	.string	"hx"
+	.value	0x104
+	.byte	0x15
+	.long	0xe2
+	.uleb128 0x13
+	.string	"hy"
+	.value	0x105
+	.byte	0x15
+	.long	0xe2
+	.uleb128 0x13
+	.string	"bx"
+	.value	0x106
+	.byte	0x15
+	.long	0xe2
+	.uleb128 0x8
+	.long	.LASF2555
+	.value	0x109
+	.byte	0x15
+	.long	0xe2
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x8
+	.long	.LASF2556
+	.value	0x124
+	.byte	0x19
+	.long	0xe2
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2558
+	.byte	0x14
+	.byte	0xd8
+	.byte	0xe
+	.long	0xdb
+	.uleb128 0x1c
+	.long	.LASF2559
+	.byte	0x14
+	.byte	0xd3
+	.byte	0xc
+	.long	0x493
+	.uleb128 0x1d
+	.long	.LASF2561
+	.byte	0xce
+	.long	0xdb
+	.long	0xe65
+	.uleb128 0x9
+	.string	"x"
+	.byte	0xce
+	.byte	0x1c
+	.long	0xdb
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2562
+	.byte	0xa9
+	.long	0xea6
+	.uleb128 0x10
+	.long	.LASF2543
+	.byte	0xa9
+	.byte	0x2f
+	.long	0xcf
+	.uleb128 0x4
+	.long	.LASF2563
+	.byte	0xab
+	.byte	0x14
+	.long	0xab
+	.uleb128 0x4
+	.long	.LASF2564
+	.byte	0xac
+	.byte	0x12
+	.long	0xdb
+	.uleb128 0xd
+	.string	"dT"
+	.byte	0xaf
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0x4
+	.long	.LASF2565
+	.byte	0xb1
+	.byte	0x11
+	.long	0x171
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2566
+	.byte	0x9c
+	.long	0xed5
+	.uleb128 0x9
+	.string	"v"
+	.byte	0x9c
+	.byte	0x39
+	.long	0xed5
+	.uleb128 0xd
+	.string	"x"
+	.byte	0x9f
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0xd
+	.string	"y"
+	.byte	0xa0
+	.byte	0x11
+	.long	0xe2
+	.uleb128 0xd
+	.string	"z"
+	.byte	0xa1
+	.byte	0x11
+	.long	0xe2
+	.byte	0
+	.uleb128 0x7
+	.long	0x171
+	.uleb128 0x23
+	.long	.LASF2567
+	.byte	0x93
+	.uleb128 0x23
+	.long	.LASF2568
+	.byte	0x8b
+	.uleb128 0x36
+	.long	.LASF2570
+	.byte	0x14
+	.byte	0x80
+	.byte	0x6
+	.long	0xefe
+	.uleb128 0x10
+	.long	.LASF2571
+	.byte	0x80
+	.byte	0x1c
+	.long	0xc3
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2572
+	.byte	0x7b
+	.long	0xdb
+	.long	0xf18
+	.uleb128 0x10
+	.long	.LASF2571
+	.byte	0x7b
+	.byte	0x33
+	.long	0xc3
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2573
+	.byte	0x76
+	.long	0xdb
+	.long	0xf32
+	.uleb128 0x10
+	.long	.LASF2574
+	.byte	0x76
+	.byte	0x3d
+	.long	0xdb
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2575
+	.byte	0x59
+	.long	0xfa0
+	.uleb128 0x4
+	.long	.LASF2576
+	.byte	0x5b
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2577
+	.byte	0x5c
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2578
+	.byte	0x5d
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2579
+	.byte	0x5f
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2580
+	.byte	0x60
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2581
+	.byte	0x61
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2582
+	.byte	0x62
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2583
+	.byte	0x63
+	.byte	0xb
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF2584
+	.byte	0x64
+	.byte	0xb
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2585
+	.byte	0x9
+	.byte	0x39
+	.byte	0x47
+	.long	0xfac
+	.uleb128 0x7
+	.long	0x41b
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 23 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.file 26 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 28 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 29 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 39 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1151
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1191
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 50 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x32
+	.file 51 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 52 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x34
+	.file 53 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 54 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x36
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1599
+	.byte	0x4
+	.byte	0x4
+	.file 55 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 56 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 57 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1746
+	.byte	0x4
+	.byte	0x4
+	.file 58 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3a
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 59 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3b
+	.file 60 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3c
+	.file 61 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 62 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.file 63 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x4
+	.file 64 "./src/main/sensors/barometer.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x40
+	.file 65 "./src/main/drivers/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1887
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1888
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x12
+	.file 66 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.file 67 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x43
+	.file 68 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x44
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 69 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x13
+	.byte	0x4
+	.file 70 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x46
+	.file 71 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 72 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x48
+	.file 73 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2301
+	.byte	0x4
+	.file 74 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4a
+	.file 75 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x4
+	.file 76 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4c
+	.file 77 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2306
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2307
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1150
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1172
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1190
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1193
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1198
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1222
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1240
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1241
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1242
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1243
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1253
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1263
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1265
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1267
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1269
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1271
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1272
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1273
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1275
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1276
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1278
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1256
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1421
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1498
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1515
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1519
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1522
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1427
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1547
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1548
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1549
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1550
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1551
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1552
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1553
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1554
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1567
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1575
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1598
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1615
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1654
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1736
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1745
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1748
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1756
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.8362794d947c339e17997ec0162d97db,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1775
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1784
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1874
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1883
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1886
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1890
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1916
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1928
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2296
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2300
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2305
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF2591
+	.long	.LASF2592
+	.long	.LASF2593
+	.long	.LASF2594
+	.long	.LASF2595
+	.long	.LASF2596
+	.long	.LASF2597
+	.long	.LASF2598
+	.long	.LASF2599
+	.long	.LASF2600
+	.long	.LASF2601
+	.long	.LASF2602
+	.long	.LASF2603
+	.long	.LASF2604
+	.long	.LASF2605
+	.long	.LASF2606
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4e
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2607
+	.byte	0xc
+	.long	.LASF2608
+	.byte	0xc
+	.long	.LASF2609
+	.byte	0xc
+	.long	.LASF2610
+	.byte	0x2
+	.long	.LASF2611
+	.byte	0x3
+	.long	.LASF2612
+	.byte	0x2
+	.long	.LASF2613
+	.byte	0x5
+	.long	.LASF2614
+	.byte	0x2
+	.long	.LASF2615
+	.byte	0x6
+	.long	.LASF2616
+	.byte	0x4
+	.long	.LASF2617
+	.byte	0x6
+	.long	.LASF2618
+	.byte	0x4
+	.long	.LASF2619
+	.byte	0x4
+	.long	.LASF2620
+	.byte	0x4
+	.long	.LASF2621
+	.byte	0x8
+	.long	.LASF2622
+	.byte	0x8
+	.long	.LASF2623
+	.byte	0x4
+	.long	.LASF2624
+	.byte	0x8
+	.long	.LASF2625
+	.byte	0x8
+	.long	.LASF2626
+	.byte	0x6
+	.long	.LASF2627
+	.byte	0xc
+	.long	.LASF2628
+	.byte	0x4
+	.long	.LASF2629
+	.byte	0xf
+	.long	.LASF2630
+	.byte	0x10
+	.long	.LASF2631
+	.byte	0x10
+	.long	.LASF2631
+	.byte	0xf
+	.long	.LASF2632
+	.byte	0xc
+	.long	.LASF2633
+	.byte	0xf
+	.long	.LASF2634
+	.byte	0xf
+	.long	.LASF2635
+	.byte	0xc
+	.long	.LASF2636
+	.byte	0xc
+	.long	.LASF2637
+	.byte	0xe
+	.long	.LASF2638
+	.byte	0xc
+	.long	.LASF2639
+	.byte	0xd
+	.long	.LASF2640
+	.byte	0xd
+	.long	.LASF2641
+	.byte	0xc
+	.long	.LASF2642
+	.byte	0xc
+	.long	.LASF2643
+	.byte	0xc
+	.long	.LASF2644
+	.byte	0xf
+	.long	.LASF2645
+	.byte	0xc
+	.long	.LASF2646
+	.byte	0xc
+	.long	.LASF2647
+	.byte	0xc
+	.long	.LASF2648
+	.byte	0xc
+	.long	.LASF2649
+	.byte	0xc
+	.long	.LASF2650
+	.byte	0xc
+	.long	.LASF2651
+	.byte	0xc
+	.long	.LASF2652
+	.byte	0xc
+	.long	.LASF2653
+	.byte	0xc
+	.long	.LASF2654
+	.byte	0xc
+	.long	.LASF2655
+	.byte	0xb
+	.long	.LASF2656
+	.byte	0xa
+	.long	.LASF2657
+	.byte	0x9
+	.long	.LASF2658
+	.byte	0x10
+	.long	.LASF2659
+	.byte	0xa
+	.long	.LASF2660
+	.byte	0x1
+	.long	.LASF2661
+	.byte	0x1
+	.long	.LASF2662
+	.byte	0x3
+	.long	.LASF2663
+	.byte	0x6
+	.long	.LASF2664
+	.byte	0x4
+	.long	.LASF2665
+	.byte	0x4
+	.long	.LASF2666
+	.byte	0x4
+	.long	.LASF2667
+	.byte	0x7
+	.long	.LASF2668
+	.byte	0x4
+	.long	.LASF2669
+	.byte	0x8
+	.long	.LASF2669
+	.byte	0x4
+	.long	.LASF2670
+	.byte	0x4
+	.long	.LASF2671
+	.byte	0x4
+	.long	.LASF2672
+	.byte	0x2
+	.long	.LASF2673
+	.byte	0x4
+	.long	.LASF2674
+	.byte	0x8
+	.long	.LASF2675
+	.byte	0x4
+	.long	.LASF2676
+	.byte	0x8
+	.long	.LASF2677
+	.byte	0x2
+	.long	.LASF2678
+	.byte	0x8
+	.long	.LASF2679
+	.byte	0x8
+	.long	.LASF2680
+	.byte	0x8
+	.long	.LASF2681
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2052:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2288:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2126:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1125:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1924:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF796:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1378:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF1001:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF2417:
+	.string	"mpuConfiguration_s"
+.LASF2424:
+	.string	"mpuConfiguration_t"
+.LASF1029:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1362:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF1121:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1454:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1304:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF1071:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1012:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2379:
+	.string	"PIDPITCH"
+.LASF1509:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1461:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1824:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF905:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1202:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF1328:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2142:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2070:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1455:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF833:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1548:
+	.string	"USE_PPM"
+.LASF1796:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1763:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2433:
+	.string	"ICM_20602_SPI"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF2292:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2568:
+	.string	"imuInit"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF2086:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1933:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1292:
+	.string	"FP_NORMAL 4"
+.LASF969:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF949:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF806:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1146:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1404:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1814:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1753:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF2341:
+	.string	"reset"
+.LASF1746:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1632:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF909:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1930:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1372:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF1322:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1010:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2313:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1094:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1069:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1379:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF2377:
+	.string	"_Bool"
+.LASF931:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF764:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1982:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1757:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1528:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2537:
+	.string	"currentTimeUs"
+.LASF1204:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF973:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1456:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2565:
+	.string	"accel_ned"
+.LASF2471:
+	.string	"OWNER_ADC_CURR"
+.LASF901:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1598:
+	.string	"__enable_irq() "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1649:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1715:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1942:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2144:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2252:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2378:
+	.string	"PIDROLL"
+.LASF1309:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1880:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF2395:
+	.string	"CW90_DEG_FLIP"
+.LASF988:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1502:
+	.string	"_WCHAR_T "
+.LASF1931:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF870:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2381:
+	.string	"PIDALT"
+.LASF2215:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2309:
+	.string	"short unsigned int"
+.LASF1690:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1765:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF2397:
+	.string	"CW270_DEG_FLIP"
+.LASF2025:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1740:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF902:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF810:
+	.string	"__DECL_SIMD_expf64 "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2013:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1462:
+	.string	"USE_SENSOR_NAMES "
+.LASF2284:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1218:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF2535:
+	.string	"angle"
+.LASF1700:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF976:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF781:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1341:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF2521:
+	.string	"smallAngleCosZ"
+.LASF2385:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2406:
+	.string	"read"
+.LASF907:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1866:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF2231:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1178:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1656:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2558:
+	.string	"imuGetPGainScaleFactor"
+.LASF2468:
+	.string	"OWNER_LED"
+.LASF769:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2348:
+	.string	"GPS_FIX"
+.LASF1955:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF794:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2422:
+	.string	"resetFn"
+.LASF2324:
+	.string	"uint16_t"
+.LASF807:
+	.string	"__DECL_SIMD_expl "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2294:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1087:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1751:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF1205:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2551:
+	.string	"integralFBz"
+.LASF1823:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1130:
+	.string	"__DECL_SIMD_tanhf"
+.LASF1755:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF2114:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2369:
+	.string	"small_angle"
+.LASF2202:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1445:
+	.string	"TELEMETRY_HOTT "
+.LASF788:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF927:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1096:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2226:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1644:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1295:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF763:
+	.string	"_MATH_H 1"
+.LASF2155:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1592:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1991:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF906:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1278:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1917:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1471:
+	.string	"_T_PTRDIFF_ "
+.LASF2588:
+	.string	"calculateThrottleAngleCorrection"
+.LASF2229:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1854:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1996:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1696:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF777:
+	.string	"__DECL_SIMD_sinl "
+.LASF2104:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1791:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1688:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1590:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1816:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1318:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2261:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF2225:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1673:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1803:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF2328:
+	.string	"t_fp_vector_def"
+.LASF1883:
+	.string	"GYRO_LPF_NONE 7"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1025:
+	.string	"__DECL_SIMD_tan "
+.LASF1912:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2349:
+	.string	"CALIBRATE_MAG"
+.LASF1136:
+	.string	"__DECL_SIMD_erfc"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1382:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF798:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2127:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1943:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2115:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1965:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2135:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1100:
+	.string	"__DECL_SIMD_atan2"
+.LASF1353:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF2247:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1623:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF2124:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2387:
+	.string	"PIDVEL"
+.LASF1168:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1411:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1772:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF2055:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1829:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF854:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2255:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1683:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1258:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF2029:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF2211:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF797:
+	.string	"__DECL_SIMD_logl "
+.LASF1365:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF2475:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2495:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1303:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1142:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1128:
+	.string	"__DECL_SIMD_tanh"
+.LASF2222:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1034:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1951:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1898:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF929:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1393:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1909:
+	.string	"BIT(x) (1 << (x))"
+.LASF2500:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1769:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1637:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF805:
+	.string	"__DECL_SIMD_exp "
+.LASF1959:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1015:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1140:
+	.string	"__DECL_SIMD_tan"
+.LASF880:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF897:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1320:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1219:
+	.string	"_Mdouble_"
+.LASF2322:
+	.string	"int32_t"
+.LASF1363:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF2524:
+	.string	"pgResetTemplate_imuConfig"
+.LASF1375:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1357:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF2234:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1619:
+	.string	"FAST_MATH "
+.LASF1534:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1055:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1385:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1595:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF989:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1847:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF2265:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1979:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1839:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1080:
+	.string	"__DECL_SIMD_exp10"
+.LASF2259:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2205:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1904:
+	.string	"STR_HELPER(x) #x"
+.LASF1524:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF2026:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1154:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1067:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1739:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1573:
+	.string	"VTX_TRAMP"
+.LASF2375:
+	.string	"imuRuntimeConfig_t"
+.LASF1199:
+	.string	"FP_INT_UPWARD 0"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2497:
+	.string	"OWNER_BARO_EXTI"
+.LASF1060:
+	.string	"__DECL_SIMD_acos"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2420:
+	.string	"slowreadFn"
+.LASF546:
+	.string	"__always_inline"
+.LASF871:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF990:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2357:
+	.string	"accVelScale"
+.LASF904:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1312:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF903:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1197:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF2287:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2361:
+	.string	"values"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2036:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2474:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1693:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1220:
+	.string	"__MATH_PRECNAME"
+.LASF940:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1250:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1169:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1307:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1104:
+	.string	"__DECL_SIMD_log10"
+.LASF2333:
+	.string	"PGR_SIZE_MASK"
+.LASF1230:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1088:
+	.string	"__DECL_SIMD_expm1"
+.LASF1280:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF872:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF2050:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1073:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF2516:
+	.string	"gyroADCf"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2072:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1351:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1190:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1570:
+	.string	"VTX_COMMON"
+.LASF1040:
+	.string	"__DECL_SIMD_sin"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1207:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1458:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1390:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2022:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2242:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1485:
+	.string	"_T_SIZE_ "
+.LASF1764:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2145:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2458:
+	.string	"acc_s"
+.LASF977:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1284:
+	.string	"__MATHCALL_NARROW"
+.LASF1868:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1999:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1457:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1261:
+	.string	"_Mret_ _Float32"
+.LASF1825:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1773:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1112:
+	.string	"__DECL_SIMD_log1p"
+.LASF1801:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1241:
+	.string	"__MATHDECL_1"
+.LASF1113:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF2250:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2386:
+	.string	"PIDMAG"
+.LASF1097:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2498:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2408:
+	.string	"ADCRaw"
+.LASF1724:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF2509:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2198:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1177:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF2102:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1788:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1156:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2218:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2575:
+	.string	"imuComputeRotationMatrix"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1905:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2460:
+	.string	"accSmooth"
+.LASF1779:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1648:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2233:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1110:
+	.string	"__DECL_SIMD_log2f"
+.LASF958:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2394:
+	.string	"CW0_DEG_FLIP"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1738:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF865:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2499:
+	.string	"OWNER_USB_DETECT"
+.LASF883:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1877:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF2167:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1668:
+	.string	"PG_PID_PROFILE 14"
+.LASF2413:
+	.string	"sensorAccReadFuncPtr"
+.LASF1215:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1974:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2453:
+	.string	"SENSOR_BARO"
+.LASF2425:
+	.string	"MPU_NONE"
+.LASF2062:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF994:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2291:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2230:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1148:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2363:
+	.string	"attitude"
+.LASF2479:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1564:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1334:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF2078:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1359:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF1293:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1685:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1728:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1078:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1368:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF2467:
+	.string	"OWNER_SERVO"
+.LASF1911:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1675:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1532:
+	.string	"ACC "
+.LASF2440:
+	.string	"mpu6050Resolution_e"
+.LASF1039:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2383:
+	.string	"PIDPOSR"
+.LASF1667:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1453:
+	.string	"TELEMETRY_IBUS "
+.LASF1432:
+	.string	"USE_PWM "
+.LASF890:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF930:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1873:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF1875:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF966:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1133:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1741:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF2034:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2128:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1405:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF1808:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1983:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF824:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1692:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF2276:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1952:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2123:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF2311:
+	.string	"long unsigned int"
+.LASF2138:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2555:
+	.string	"ez_ef"
+.LASF2390:
+	.string	"CW0_DEG"
+.LASF1401:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF2359:
+	.string	"roll"
+.LASF1477:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1650:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1957:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1396:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1886:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2314:
+	.string	"__int16_t"
+.LASF919:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2316:
+	.string	"__uint16_t"
+.LASF1171:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1840:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2466:
+	.string	"OWNER_MOTOR"
+.LASF891:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2546:
+	.string	"imuCalculateEstimatedAttitude"
+.LASF2041:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF858:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1588:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2046:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2373:
+	.string	"imuConfig_System"
+.LASF1627:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF1862:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF2374:
+	.string	"imuRuntimeConfig_s"
+.LASF2494:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1512:
+	.string	"__INT_WCHAR_T_H "
+.LASF936:
+	.string	"__DECL_SIMD_log10f "
+.LASF2393:
+	.string	"CW270_DEG"
+.LASF1301:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2074:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1845:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF861:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2146:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1314:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1929:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1820:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF830:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1275:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF1701:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1962:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF892:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1098:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1960:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1889:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF2251:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1985:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1000:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1617:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1865:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF793:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1043:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1105:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF862:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1749:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1298:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2447:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2210:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF2456:
+	.string	"SENSOR_GPS"
+.LASF1268:
+	.string	"_Marg_ _Float128"
+.LASF1167:
+	.string	"__f32x(x) x ##f32x"
+.LASF879:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1201:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1321:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1222:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1760:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1903:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1246:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1282:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1729:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1994:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2399:
+	.string	"deviceSpi_s"
+.LASF2269:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1934:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2308:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1271:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1950:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1253:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF822:
+	.string	"__DECL_SIMD_powf32x "
+.LASF953:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1182:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1735:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1748:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1135:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1478:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1882:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1049:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF1712:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2271:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1686:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2157:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1669:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1180:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF2300:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF1851:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2326:
+	.string	"float"
+.LASF1391:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1664:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1640:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2248:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1826:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1511:
+	.string	"___int_wchar_t_h "
+.LASF1805:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF1243:
+	.string	"__MATHDECL"
+.LASF1530:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1459:
+	.string	"USE_MSP_PUSH "
+.LASF2579:
+	.string	"q0q1"
+.LASF987:
+	.string	"__DECL_SIMD_erfl "
+.LASF2527:
+	.string	"acosf"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2298:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1549:
+	.string	"USE_PWM"
+.LASF1352:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF1981:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF848:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1470:
+	.string	"_PTRDIFF_T "
+.LASF1578:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF2338:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1037:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1998:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF1716:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1601:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1966:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF2066:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1115:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF944:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1809:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1790:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF2389:
+	.string	"ALIGN_DEFAULT"
+.LASF1613:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF913:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF2003:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1449:
+	.string	"USE_SERVOS "
+.LASF1350:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF2335:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1961:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1646:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2264:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1754:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF2506:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1442:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2437:
+	.string	"mpuSensor_e"
+.LASF1066:
+	.string	"__DECL_SIMD_atanf"
+.LASF1709:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1849:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2166:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF838:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1299:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2064:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1671:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2237:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2462:
+	.string	"acc_t"
+.LASF1227:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1277:
+	.string	"_Mret_ _Float64x"
+.LASF2405:
+	.string	"init"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1508:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2069:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1818:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1535:
+	.string	"USE_FAKE_BARO "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1440:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2427:
+	.string	"MPU_60x0"
+.LASF2137:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2140:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1376:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF2525:
+	.string	"imuConfig_Registry"
+.LASF2488:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF2254:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1785:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1342:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF1687:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF886:
+	.string	"__DECL_SIMD_coshf "
+.LASF2043:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF967:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF2119:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF2035:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1395:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF959:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2411:
+	.string	"mpuDetectionResult"
+.LASF1990:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1806:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF2107:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1953:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2139:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1018:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF864:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2180:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2590:
+	.string	"imuUpdateEulerAngles"
+.LASF1237:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF2428:
+	.string	"MPU_60x0_SPI"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2331:
+	.string	"PGR_PGN_MASK"
+.LASF2091:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2153:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1374:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF1846:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1157:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2188:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1214:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1217:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF2553:
+	.string	"recipNorm"
+.LASF1815:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF918:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2148:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1831:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF2533:
+	.string	"cos_approx"
+.LASF2274:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2203:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2173:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1691:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF774:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1429:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF1891:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF937:
+	.string	"__DECL_SIMD_log10l "
+.LASF1064:
+	.string	"__DECL_SIMD_atan"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1742:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF961:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1340:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1878:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF814:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1940:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1138:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1584:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF2245:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2380:
+	.string	"PIDYAW"
+.LASF2031:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1159:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF765:
+	.string	"__DECL_SIMD_cos "
+.LASF1036:
+	.string	"__DECL_SIMD_cos"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1398:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1111:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1030:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1787:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF2039:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF924:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2510:
+	.string	"mag_s"
+.LASF2513:
+	.string	"mag_t"
+.LASF943:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2235:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1969:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF846:
+	.string	"__DECL_SIMD_asinf "
+.LASF2201:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1841:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1890:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1828:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2339:
+	.string	"size"
+.LASF1431:
+	.string	"USE_PPM "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF2089:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2448:
+	.string	"SENSOR_INDEX_BARO"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1711:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1131:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2419:
+	.string	"writeFn"
+.LASF2280:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1384:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF1247:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1869:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1523:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1038:
+	.string	"__DECL_SIMD_cosf"
+.LASF1231:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2540:
+	.string	"useAcc"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF813:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2094:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF970:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1083:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF766:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF2099:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1129:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1935:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF910:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1291:
+	.string	"FP_SUBNORMAL 3"
+.LASF1794:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF799:
+	.string	"__DECL_SIMD_logf32 "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1634:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF2573:
+	.string	"calculateAccZLowPassFilterRCTimeConstant"
+.LASF1963:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1490:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2503:
+	.string	"OWNER_INVERTER"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2103:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2299:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF2483:
+	.string	"OWNER_SPI_MOSI"
+.LASF2531:
+	.string	"sqrtf"
+.LASF2257:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2336:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2323:
+	.string	"uint8_t"
+.LASF1403:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF2576:
+	.string	"q1q1"
+.LASF996:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2583:
+	.string	"q1q3"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1183:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF2482:
+	.string	"OWNER_SPI_MISO"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1618:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2306:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF2217:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1221:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2106:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1907:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2449:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1443:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF831:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1364:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1119:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1343:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1137:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1023:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1005:
+	.string	"__DECL_SIMD_asinh "
+.LASF1620:
+	.string	"VERY_FAST_MATH "
+.LASF1273:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1513:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1495:
+	.string	"___int_size_t_h "
+.LASF1033:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1562:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1733:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1184:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1324:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF832:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1289:
+	.string	"FP_INFINITE 1"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF885:
+	.string	"__DECL_SIMD_cosh "
+.LASF1281:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF775:
+	.string	"__DECL_SIMD_sin "
+.LASF1529:
+	.string	"LED0_PIN NONE"
+.LASF2001:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1519:
+	.string	"NULL ((void *)0)"
+.LASF1563:
+	.string	"TELEMETRY_CRSF"
+.LASF1536:
+	.string	"MAG "
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1516:
+	.string	"_BSD_WCHAR_T_"
+.LASF1356:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF971:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2459:
+	.string	"accSamplingInterval"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF2020:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1150:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2169:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1488:
+	.string	"_SIZE_T_ "
+.LASF2496:
+	.string	"OWNER_MPU_EXTI"
+.LASF1059:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1771:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF1923:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1499:
+	.string	"__need_size_t"
+.LASF1141:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2465:
+	.string	"OWNER_PPMINPUT"
+.LASF1525:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1896:
+	.string	"IOCFG_IPD 0"
+.LASF1480:
+	.string	"__need_ptrdiff_t"
+.LASF818:
+	.string	"__DECL_SIMD_powf16 "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF849:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1175:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1423:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1750:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF887:
+	.string	"__DECL_SIMD_coshl "
+.LASF1600:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2270:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2545:
+	.string	"axis"
+.LASF1235:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1689:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1467:
+	.string	"_STDDEF_H "
+.LASF2213:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF972:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1086:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1842:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF1770:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF771:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF868:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2228:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2559:
+	.string	"imuUseFastGains"
+.LASF1407:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF803:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1777:
+	.string	"LON 1"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF2150:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1863:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1714:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1224:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2018:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1679:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1266:
+	.string	"_Marg_ _Float64x"
+.LASF1643:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1569:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF2435:
+	.string	"ICM_20689_SPI"
+.LASF839:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1684:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF921:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1992:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF1493:
+	.string	"_SIZE_T_DECLARED "
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF2156:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1151:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2038:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF898:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1185:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1409:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF2016:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1758:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2077:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1989:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2194:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1085:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1559:
+	.string	"LED_STRIP"
+.LASF2187:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF922:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1103:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1149:
+	.string	"__f128(x) x ##f128"
+.LASF978:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1226:
+	.string	"_Mdouble_ long double"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF2370:
+	.string	"acc_unarmedcal"
+.LASF2232:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1988:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2455:
+	.string	"SENSOR_SONAR"
+.LASF1972:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1045:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2063:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1555:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1635:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1019:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1556:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1762:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2570:
+	.string	"imuConfigure"
+.LASF2098:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF2515:
+	.string	"targetLooptime"
+.LASF1756:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF860:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2049:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1061:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF847:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1444:
+	.string	"TELEMETRY_FRSKY "
+.LASF1927:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1026:
+	.string	"__DECL_SIMD_tanf "
+.LASF2174:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2519:
+	.string	"throttleAngleScale"
+.LASF1789:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1725:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF2452:
+	.string	"SENSOR_ACC"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF2051:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF2478:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2589:
+	.string	"getCosTiltAngle"
+.LASF2340:
+	.string	"address"
+.LASF1642:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1631:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1233:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1348:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF2085:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2172:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2076:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2079:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1593:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1554:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1262:
+	.string	"_Marg_ _Float32x"
+.LASF767:
+	.string	"__DECL_SIMD_cosl "
+.LASF1491:
+	.string	"_SIZE_T_DEFINED "
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1975:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1897:
+	.string	"IOCFG_IPU 0"
+.LASF1186:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1752:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF1209:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1652:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2008:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2118:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1518:
+	.string	"NULL"
+.LASF1767:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2347:
+	.string	"GPS_FIX_HOME"
+.LASF1225:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2421:
+	.string	"verifywriteFn"
+.LASF2246:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2360:
+	.string	"pitch"
+.LASF1498:
+	.string	"__size_t "
+.LASF2480:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2577:
+	.string	"q2q2"
+.LASF2584:
+	.string	"q2q3"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1500:
+	.string	"__wchar_t__ "
+.LASF1641:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1581:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1188:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1410:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF499:
+	.string	"__PMT"
+.LASF1937:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1514:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1576:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1899:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2073:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1810:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2429:
+	.string	"MPU_65xx_I2C"
+.LASF993:
+	.string	"__DECL_SIMD_erff64x "
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1703:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1426:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1434:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1313:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2272:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1575:
+	.string	"USE_RESOURCE_MGMT"
+.LASF946:
+	.string	"__DECL_SIMD_log2f "
+.LASF2536:
+	.string	"throttle_correction_value"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2352:
+	.string	"armingFlags"
+.LASF2224:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1371:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF995:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1745:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2075:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1435:
+	.string	"USE_SERIALRX_IBUS "
+.LASF795:
+	.string	"__DECL_SIMD_log "
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2334:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF2538:
+	.string	"previousIMUUpdateTime"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1147:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2541:
+	.string	"useMag"
+.LASF1661:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF2000:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1108:
+	.string	"__DECL_SIMD_log2"
+.LASF2130:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1775:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1561:
+	.string	"TELEMETRY_HOTT"
+.LASF1370:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF2208:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1306:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2470:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2044:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF2301:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1759:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF1123:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1366:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF1795:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1208:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1604:
+	.string	"UNIT_TESTED "
+.LASF1660:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1893:
+	.string	"IOCFG_OUT_OD 0"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2121:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1800:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF935:
+	.string	"__DECL_SIMD_log10 "
+.LASF1586:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF844:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF2581:
+	.string	"q0q3"
+.LASF1506:
+	.string	"_WCHAR_T_ "
+.LASF1274:
+	.string	"_Mret_ _Float64"
+.LASF1050:
+	.string	"__DECL_SIMD_logf"
+.LASF2416:
+	.string	"mpuResetFnPtr"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1063:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF2082:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1654:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF843:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2134:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2586:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1163:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1655:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1639:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1422:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF2364:
+	.string	"accDeadband_s"
+.LASF2365:
+	.string	"accDeadband_t"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1967:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1283:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1234:
+	.string	"_Mdouble_ _Float128"
+.LASF1344:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF1731:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2163:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2101:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1014:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1389:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1392:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF2244:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1402:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF1106:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1437:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2065:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2143:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2017:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1784:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2175:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1408:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF1885:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1323:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF1968:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF2529:
+	.string	"atan2f"
+.LASF957:
+	.string	"__DECL_SIMD_log1pl "
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF884:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1948:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF789:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1520:
+	.string	"__need_NULL"
+.LASF962:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1970:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1387:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF1236:
+	.string	"_Mdouble_ _Float32x"
+.LASF1612:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2461:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF1191:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF851:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1946:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF819:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF950:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1558:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF835:
+	.string	"__DECL_SIMD_atan "
+.LASF1861:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF881:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1834:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1585:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF2120:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1242:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2346:
+	.string	"WAS_EVER_ARMED"
+.LASF1451:
+	.string	"CMS "
+.LASF2414:
+	.string	"mpuReadRegisterFnPtr"
+.LASF1084:
+	.string	"__DECL_SIMD_cosh"
+.LASF2571:
+	.string	"throttle_correction_angle"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1662:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF2053:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF869:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1251:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF852:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2486:
+	.string	"OWNER_SDCARD"
+.LASF2518:
+	.string	"gyro"
+.LASF1256:
+	.string	"__MATHCALL_NAME"
+.LASF1677:
+	.string	"PG_RX_CONFIG 24"
+.LASF955:
+	.string	"__DECL_SIMD_log1p "
+.LASF1835:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1346:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF2189:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1792:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF1027:
+	.string	"__DECL_SIMD_tanl "
+.LASF882:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2275:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1300:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1702:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1874:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1609:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2321:
+	.string	"int16_t"
+.LASF1699:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF2122:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1116:
+	.string	"__DECL_SIMD_atanh"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1354:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF1099:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2083:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2312:
+	.string	"signed char"
+.LASF1164:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1633:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF800:
+	.string	"__DECL_SIMD_logf64 "
+.LASF783:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2023:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2204:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF899:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF1481:
+	.string	"__size_t__ "
+.LASF1447:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1286:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1448:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1527:
+	.string	"U_ID_1 1"
+.LASF1986:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1179:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1134:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1547:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1510:
+	.string	"_WCHAR_T_H "
+.LASF2415:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1114:
+	.string	"__DECL_SIMD_log1pf"
+.LASF2418:
+	.string	"readFn"
+.LASF2566:
+	.string	"imuTransformVectorBodyToEarth"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF2578:
+	.string	"q3q3"
+.LASF1611:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF979:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1616:
+	.string	"sq(x) ((x)*(x))"
+.LASF779:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF951:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1259:
+	.string	"_Mret_ double"
+.LASF1081:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1913:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1606:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2181:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2100:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1065:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1166:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1489:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1189:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1381:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF1446:
+	.string	"TELEMETRY_LTM "
+.LASF1776:
+	.string	"LAT 0"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1932:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF2196:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1416:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1949:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF947:
+	.string	"__DECL_SIMD_log2l "
+.LASF1848:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1492:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1678:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2183:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1048:
+	.string	"__DECL_SIMD_log"
+.LASF2409:
+	.string	"revisionCode"
+.LASF1836:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2325:
+	.string	"uint32_t"
+.LASF1155:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF396:
+	.string	"__REVISION__ \"669c324\""
+.LASF2178:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2508:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1591:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1589:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1682:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1228:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2012:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1255:
+	.string	"_Marg_"
+.LASF1501:
+	.string	"__WCHAR_T__ "
+.LASF1006:
+	.string	"__DECL_SIMD_asinhf "
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2219:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1441:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1008:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1469:
+	.string	"_ANSI_STDDEF_H "
+.LASF1665:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF2585:
+	.string	"imuConfig"
+.LASF1732:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2501:
+	.string	"OWNER_OSD"
+.LASF791:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2561:
+	.string	"invSqrt"
+.LASF2190:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2273:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2332:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF801:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2239:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2191:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1054:
+	.string	"__DECL_SIMD_expf"
+.LASF923:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF2002:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1051:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1817:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF2431:
+	.string	"MPU_9250_SPI"
+.LASF1419:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1971:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1316:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1941:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1743:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1181:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1579:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF816:
+	.string	"__DECL_SIMD_powf "
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2547:
+	.string	"imuMahonyAHRSupdate"
+.LASF1269:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF2015:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1921:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF792:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1734:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2343:
+	.string	"OK_TO_ARM"
+.LASF981:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF2056:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2522:
+	.string	"imuRuntimeConfig"
+.LASF1165:
+	.string	"__f32(x) x ##f32"
+.LASF1774:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1614:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1636:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1290:
+	.string	"FP_ZERO 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1895:
+	.string	"IOCFG_AF_OD 0"
+.LASF2216:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1964:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF808:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1947:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF2105:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2564:
+	.string	"accz_smooth"
+.LASF1853:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF2147:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1068:
+	.string	"__DECL_SIMD_asin"
+.LASF1887:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1707:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF952:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1450:
+	.string	"GPS "
+.LASF1888:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1089:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF2133:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2132:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1176:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF2353:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1203:
+	.string	"FP_INT_TONEAREST 4"
+.LASF1928:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1681:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF2221:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1223:
+	.string	"_Mdouble_ float"
+.LASF2319:
+	.string	"long int"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1072:
+	.string	"__DECL_SIMD_hypot"
+.LASF1674:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1042:
+	.string	"__DECL_SIMD_sinf"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF948:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1718:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1821:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2512:
+	.string	"magneticDeclination"
+.LASF1628:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF984:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF911:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1881:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2476:
+	.string	"OWNER_PINDEBUG"
+.LASF1995:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF2526:
+	.string	"applyDeadband"
+.LASF960:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2262:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2366:
+	.string	"imuConfig_s"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1783:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1452:
+	.string	"TELEMETRY_CRSF "
+.LASF1474:
+	.string	"_PTRDIFF_T_ "
+.LASF2401:
+	.string	"u_fp_vector"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1908:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2457:
+	.string	"SENSOR_GPSMAG"
+.LASF2528:
+	.string	"lrintf"
+.LASF2159:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1473:
+	.string	"__PTRDIFF_T "
+.LASF1465:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF912:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2095:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2021:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1210:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1483:
+	.string	"_SIZE_T "
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2358:
+	.string	"accSum"
+.LASF2161:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF915:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2542:
+	.string	"useYaw"
+.LASF1811:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1906:
+	.string	"EXPAND_I(x) x"
+.LASF2071:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2238:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1978:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1879:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1566:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2028:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1216:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2355:
+	.string	"accTimeSum"
+.LASF2110:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1872:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF1487:
+	.string	"__SIZE_T "
+.LASF2356:
+	.string	"accSumCount"
+.LASF1044:
+	.string	"__DECL_SIMD_sincos"
+.LASF1945:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1910:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1526:
+	.string	"U_ID_0 0"
+.LASF2557:
+	.string	"isMagnetometerHealthy"
+.LASF1127:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2344:
+	.string	"PREVENT_ARMING"
+.LASF1319:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1670:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF2200:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF945:
+	.string	"__DECL_SIMD_log2 "
+.LASF1993:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1521:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF933:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1744:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF964:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2587:
+	.string	"millis"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1413:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1170:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1245:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF974:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1936:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1624:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1717:
+	.string	"PG_PID_CONFIG 504"
+.LASF1003:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF2206:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1335:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF2152:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1172:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF815:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1560:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1302:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1315:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1206:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1697:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1651:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1503:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1400:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF2011:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1727:
+	.string	"PG_VCD_CONFIG 514"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2060:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF2283:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF784:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1369:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF1070:
+	.string	"__DECL_SIMD_asinf"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1515:
+	.string	"__DEFINED_wchar_t "
+.LASF2477:
+	.string	"OWNER_TIMER"
+.LASF2404:
+	.string	"accDev_s"
+.LASF2445:
+	.string	"accDev_t"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1698:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF837:
+	.string	"__DECL_SIMD_atanl "
+.LASF2407:
+	.string	"acc_1G"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2241:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1997:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1926:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF2170:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1537:
+	.string	"USE_FAKE_MAG "
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1938:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1058:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1574:
+	.string	"BLACKBOX"
+.LASF2582:
+	.string	"q1q2"
+.LASF2320:
+	.string	"char"
+.LASF1248:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1850:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF2382:
+	.string	"PIDPOS"
+.LASF941:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2067:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF855:
+	.string	"__DECL_SIMD_hypot "
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1577:
+	.string	"USE_DSHOT"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF2279:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1158:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2004:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1397:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF2151:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1894:
+	.string	"IOCFG_AF_PP 0"
+.LASF938:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1552:
+	.string	"USE_SERIALRX_IBUS"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF2376:
+	.string	"IO_t"
+.LASF1193:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1737:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1415:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF895:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1276:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF770:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF942:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF834:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1799:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF2192:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1736:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2489:
+	.string	"OWNER_FLASH_CS"
+.LASF1638:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF1557:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1460:
+	.string	"USE_RX_MSP "
+.LASF1902:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2113:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF1567:
+	.string	"TELEMETRY_IBUS"
+.LASF401:
+	.string	"true 1"
+.LASF1833:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF772:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2532:
+	.string	"sensors"
+.LASF826:
+	.string	"__DECL_SIMD_acosf "
+.LASF1870:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF820:
+	.string	"__DECL_SIMD_powf64 "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2454:
+	.string	"SENSOR_MAG"
+.LASF1496:
+	.string	"_GCC_SIZE_T "
+.LASF812:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1009:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1074:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1720:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2432:
+	.string	"ICM_20601_SPI"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1807:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1153:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF821:
+	.string	"__DECL_SIMD_powf128 "
+.LASF914:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF2580:
+	.string	"q0q2"
+.LASF1425:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1550:
+	.string	"SERIAL_RX"
+.LASF1939:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1599:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1610:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1091:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1331:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1021:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF850:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2116:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF2572:
+	.string	"calculateThrottleAngleScale"
+.LASF2396:
+	.string	"CW180_DEG_FLIP"
+.LASF2295:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF2096:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2258:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF982:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1580:
+	.string	"USE_PROFILE "
+.LASF888:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF2304:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF2544:
+	.string	"accMagnitude"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1695:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1572:
+	.string	"VTX_SMARTAUDIO"
+.LASF1436:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2481:
+	.string	"OWNER_SPI_SCK"
+.LASF1198:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF2032:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2473:
+	.string	"OWNER_ADC_RSSI"
+.LASF1602:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1107:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2185:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1553:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1338:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1075:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1022:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF876:
+	.string	"__DECL_SIMD_exp10f "
+.LASF809:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1827:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF1254:
+	.string	"_Mret_"
+.LASF2403:
+	.string	"sensorAccInitFuncPtr"
+.LASF2010:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2048:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1517:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1919:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1174:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1472:
+	.string	"_T_PTRDIFF "
+.LASF840:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1360:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF1032:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF975:
+	.string	"__DECL_SIMD_acosh "
+.LASF1884:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1139:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF2125:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1031:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1399:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1533:
+	.string	"USE_FAKE_ACC "
+.LASF1337:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1285:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1719:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2523:
+	.string	"rMat"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1417:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1196:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1288:
+	.string	"FP_NAN 0"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1161:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF2136:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2199:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF932:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1582:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF2569:
+	.string	"imuUpdateAttitude"
+.LASF2111:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF985:
+	.string	"__DECL_SIMD_erf "
+.LASF2426:
+	.string	"MPU_3050"
+.LASF1077:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2088:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1484:
+	.string	"_SYS_SIZE_T_H "
+.LASF2391:
+	.string	"CW90_DEG"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1192:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2329:
+	.string	"t_fp_vector"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2093:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2268:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2398:
+	.string	"sensor_align_e"
+.LASF2214:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1122:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1325:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF2129:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2290:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1020:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1101:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2197:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1672:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2087:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1047:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1394:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1200:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF825:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1187:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF2223:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF896:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1608:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF920:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF802:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1109:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF1645:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1914:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2108:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF2345:
+	.string	"ARMED"
+.LASF1710:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1428:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1424:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1414:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1057:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1438:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2184:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2327:
+	.string	"double"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF2040:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1813:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF828:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1730:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1922:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF925:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1761:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1367:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF2484:
+	.string	"OWNER_I2C_SCL"
+.LASF1062:
+	.string	"__DECL_SIMD_acosf"
+.LASF1120:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2507:
+	.string	"OWNER_COMPASS_CS"
+.LASF1531:
+	.string	"USE_FAKE_GYRO "
+.LASF1843:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF863:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF998:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1658:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1726:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2092:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1002:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF2061:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1507:
+	.string	"_BSD_WCHAR_T_ "
+.LASF873:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2068:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1317:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2350:
+	.string	"SMALL_ANGLE"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1594:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2286:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2556:
+	.string	"dcmKiGain"
+.LASF2236:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2084:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2317:
+	.string	"__int32_t"
+.LASF1194:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2485:
+	.string	"OWNER_I2C_SDA"
+.LASF2318:
+	.string	"__uint32_t"
+.LASF2337:
+	.string	"fp_vector"
+.LASF836:
+	.string	"__DECL_SIMD_atanf "
+.LASF1626:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1013:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF2162:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF2552:
+	.string	"spin_rate"
+.LASF2131:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF1819:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2444:
+	.string	"mpuDetectionResult_t"
+.LASF1630:
+	.string	"Q12 (1 << 12)"
+.LASF1844:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2402:
+	.string	"busDevice_t"
+.LASF1412:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1430:
+	.string	"USE_CLI "
+.LASF2109:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2436:
+	.string	"BMI_160_SPI"
+.LASF1126:
+	.string	"__DECL_SIMD_erff"
+.LASF1522:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1987:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1852:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2240:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1361:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF2490:
+	.string	"OWNER_FLASH"
+.LASF827:
+	.string	"__DECL_SIMD_acosl "
+.LASF1263:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1704:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1420:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF1053:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1954:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1079:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF2351:
+	.string	"FIXED_WING"
+.LASF2176:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1211:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF963:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1213:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1504:
+	.string	"_T_WCHAR "
+.LASF2207:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF2042:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1497:
+	.string	"_SIZET_ "
+.LASF2277:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2030:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF2303:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF853:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1468:
+	.string	"_STDDEF_H_ "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF845:
+	.string	"__DECL_SIMD_asin "
+.LASF2293:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2047:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1035:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1244:
+	.string	"__MATHCALL"
+.LASF939:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1900:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2171:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1007:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1358:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1568:
+	.string	"USE_DASHBOARD"
+.LASF1680:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2006:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1980:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2256:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2080:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1308:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1418:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1305:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF2502:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF992:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1464:
+	.string	"VTX_CONTROL "
+.LASF965:
+	.string	"__DECL_SIMD_atanh "
+.LASF778:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2182:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2505:
+	.string	"OWNER_TRANSPONDER"
+.LASF1676:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1838:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1871:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF877:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2168:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF954:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2033:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1622:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2024:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1475:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1143:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF2439:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1132:
+	.string	"__DECL_SIMD_asinh"
+.LASF2154:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1092:
+	.string	"__DECL_SIMD_sinh"
+.LASF1797:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF894:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2563:
+	.string	"accZoffset"
+.LASF856:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1095:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF790:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF841:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1267:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2289:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1160:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1294:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1238:
+	.string	"_Mdouble_ _Float64x"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF2354:
+	.string	"timeUs_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1330:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1118:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF934:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2297:
+	.string	"SONAR_GPIO GPIOB"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2372:
+	.string	"imuConfig_t"
+.LASF1768:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1333:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF786:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2330:
+	.string	"pgn_t"
+.LASF1722:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2164:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2560:
+	.string	"imuIsAccelerometerHealthy"
+.LASF1145:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1657:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2368:
+	.string	"dcm_ki"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF842:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2367:
+	.string	"dcm_kp"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2412:
+	.string	"mpuConfiguration"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF866:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF782:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1747:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF1915:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1082:
+	.string	"__DECL_SIMD_exp10f"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1173:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF2543:
+	.string	"deltaT"
+.LASF1144:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1544:
+	.string	"USE_UART7 "
+.LASF2260:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2243:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1486:
+	.string	"_T_SIZE "
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF983:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF2443:
+	.string	"resolution"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1587:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1229:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1944:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1659:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2081:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF956:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1653:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1339:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1041:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1625:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1916:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF893:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF900:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1973:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1345:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF1607:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1004:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2463:
+	.string	"OWNER_FREE"
+.LASF875:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1596:
+	.string	"EEPROM_SIZE 32768"
+.LASF2539:
+	.string	"rawYawError"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1832:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF889:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF2400:
+	.string	"csnPin"
+.LASF1421:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF980:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF780:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1958:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1615:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF2220:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2027:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1028:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1804:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2530:
+	.string	"sin_approx"
+.LASF1406:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF1977:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1327:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF2567:
+	.string	"imuResetAccelerationSum"
+.LASF2464:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1162:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2278:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1876:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1046:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1786:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF2282:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2305:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF2141:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF823:
+	.string	"__DECL_SIMD_powf64x "
+.LASF773:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2534:
+	.string	"degreesToRadians"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1812:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1603:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF2548:
+	.string	"yawError"
+.LASF1545:
+	.string	"USE_UART8 "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1264:
+	.string	"_Marg_ _Float64"
+.LASF1016:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1855:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1252:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1476:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1793:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF968:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2227:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"__DECL_SIMD_erff128 "
+.LASF874:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2520:
+	.string	"fc_acc"
+.LASF2514:
+	.string	"gyro_s"
+.LASF2517:
+	.string	"gyro_t"
+.LASF908:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1984:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF2158:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2281:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2434:
+	.string	"ICM_20608_SPI"
+.LASF829:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1326:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1272:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1380:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF2302:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF2423:
+	.string	"gyroReadXRegister"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF916:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1093:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF817:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2037:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1257:
+	.string	"_Marg_ long double"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1892:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1956:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1355:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF999:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1830:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF2057:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1663:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2487:
+	.string	"OWNER_SDCARD_CS"
+.LASF1583:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1232:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1856:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1708:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF2117:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1347:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1605:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1976:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1629:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2179:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1782:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF2186:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2451:
+	.string	"SENSOR_GYRO"
+.LASF1239:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1494:
+	.string	"__DEFINED_size_t "
+.LASF1433:
+	.string	"SERIAL_RX "
+.LASF1858:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1925:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1551:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1781:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1538:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1859:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF2263:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF2149:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2209:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2058:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2430:
+	.string	"MPU_65xx_SPI"
+.LASF1867:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2384:
+	.string	"PIDNAVR"
+.LASF2562:
+	.string	"imuCalculateAcceleration"
+.LASF2014:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1427:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF986:
+	.string	"__DECL_SIMD_erff "
+.LASF1386:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1837:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1297:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1723:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF393:
+	.string	"SITL 1"
+.LASF2442:
+	.string	"sensor"
+.LASF2160:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1249:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1373:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2045:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1546:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF857:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF768:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1439:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1780:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2362:
+	.string	"attitudeEulerAngles_t"
+.LASF1918:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2504:
+	.string	"OWNER_LED_STRIP"
+.LASF2177:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1539:
+	.string	"USE_UART2 "
+.LASF1463:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1466:
+	.string	"VTX_TRAMP "
+.LASF2441:
+	.string	"mpuDetectionResult_s"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1778:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2371:
+	.string	"accDeadband"
+.LASF1597:
+	.string	"__disable_irq() "
+.LASF2388:
+	.string	"PID_ITEM_COUNT"
+.LASF1124:
+	.string	"__DECL_SIMD_erf"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1296:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1377:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1571:
+	.string	"VTX_CONTROL"
+.LASF787:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1260:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF2285:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1802:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF2450:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2193:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF2574:
+	.string	"accz_lpf_cutoff"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2112:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1329:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF2315:
+	.string	"short int"
+.LASF1383:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF1694:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2090:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF867:
+	.string	"__DECL_SIMD_exp2l "
+.LASF804:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1332:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1540:
+	.string	"USE_UART3 "
+.LASF1212:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1857:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF2165:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1705:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1860:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1505:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2438:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1102:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1482:
+	.string	"__SIZE_T__ "
+.LASF2554:
+	.string	"dcmKpGain"
+.LASF1056:
+	.string	"__DECL_SIMD_pow"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1798:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF2491:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1706:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1270:
+	.string	"_Mret_ _Float32x"
+.LASF1713:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF2007:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2019:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1621:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2492:
+	.string	"OWNER_MPU_CS"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF2310:
+	.string	"unsigned int"
+.LASF2446:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1541:
+	.string	"USE_UART4 "
+.LASF1666:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF859:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1024:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2097:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1287:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1920:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1901:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1822:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1864:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF926:
+	.string	"__DECL_SIMD_atan2f "
+.LASF785:
+	.string	"__DECL_SIMD_sincos "
+.LASF2511:
+	.string	"magADC"
+.LASF1766:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF997:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1052:
+	.string	"__DECL_SIMD_exp"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1721:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1336:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF2469:
+	.string	"OWNER_ADC"
+.LASF878:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2410:
+	.string	"accAlign"
+.LASF776:
+	.string	"__DECL_SIMD_sinf "
+.LASF2342:
+	.string	"pgRegistry_t"
+.LASF928:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF811:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2249:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2307:
+	.string	"SPIN_RATE_LIMIT 20"
+.LASF1349:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF2266:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2195:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1542:
+	.string	"USE_UART5 "
+.LASF2212:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2549:
+	.string	"integralFBx"
+.LASF2550:
+	.string	"integralFBy"
+.LASF1090:
+	.string	"__DECL_SIMD_expm1f"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1240:
+	.string	"__MATHDECL_1_IMPL"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1565:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1195:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2472:
+	.string	"OWNER_ADC_EXT"
+.LASF1017:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2267:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1311:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2005:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1117:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2009:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF2392:
+	.string	"CW180_DEG"
+.LASF1152:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2493:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2253:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1479:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1647:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1310:
+	.string	"M_E 2.7182818284590452354"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1076:
+	.string	"__DECL_SIMD_exp2"
+.LASF1011:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2054:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1265:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1388:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2296:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF1543:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF917:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2059:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2673:
+	.string	"io_def_generated.h"
+.LASF2625:
+	.string	"gyro.h"
+.LASF2652:
+	.string	"mathcalls-helper-functions.h"
+.LASF2644:
+	.string	"math.h"
+.LASF2638:
+	.string	"long-double.h"
+.LASF2655:
+	.string	"platform.h"
+.LASF2627:
+	.string	"mathcalls.h"
+.LASF2622:
+	.string	"acceleration.h"
+.LASF2650:
+	.string	"fp-logb.h"
+.LASF2646:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2632:
+	.string	"libc-header-start.h"
+.LASF2637:
+	.string	"cdefs.h"
+.LASF2604:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2648:
+	.string	"floatn-common.h"
+.LASF2624:
+	.string	"compass.h"
+.LASF2608:
+	.string	"stdint-intn.h"
+.LASF2657:
+	.string	"target.h"
+.LASF2612:
+	.string	"axis.h"
+.LASF2603:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2606:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2639:
+	.string	"stubs.h"
+.LASF2619:
+	.string	"accgyro.h"
+.LASF2675:
+	.string	"sonar_hcsr04.h"
+.LASF2599:
+	.string	"src/main/target/SITL"
+.LASF2665:
+	.string	"timer.h"
+.LASF0:
+	.string	"./src/main/flight/imu.c"
+.LASF2597:
+	.string	"src/main/io"
+.LASF2626:
+	.string	"imu.c"
+.LASF2617:
+	.string	"pid.h"
+.LASF2602:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2615:
+	.string	"imu.h"
+.LASF2653:
+	.string	"mathcalls-narrow.h"
+.LASF2634:
+	.string	"features-time64.h"
+.LASF2607:
+	.string	"types.h"
+.LASF2645:
+	.string	"math-vector.h"
+.LASF2616:
+	.string	"io_types.h"
+.LASF2628:
+	.string	"system.h"
+.LASF2647:
+	.string	"floatn.h"
+.LASF2613:
+	.string	"runtime_config.h"
+.LASF2630:
+	.string	"stdbool.h"
+.LASF2605:
+	.string	"/usr/include"
+.LASF2668:
+	.string	"exti.h"
+.LASF2591:
+	.string	"src/main/build"
+.LASF2666:
+	.string	"rcc_types.h"
+.LASF2633:
+	.string	"features.h"
+.LASF2596:
+	.string	"src/main/flight"
+.LASF2641:
+	.string	"typesizes.h"
+.LASF2664:
+	.string	"pwm_output.h"
+.LASF2670:
+	.string	"io.h"
+.LASF2593:
+	.string	"src/main/config"
+.LASF2671:
+	.string	"io_def.h"
+.LASF2621:
+	.string	"sensors.h"
+.LASF2642:
+	.string	"time64.h"
+.LASF2654:
+	.string	"iscanonical.h"
+.LASF2609:
+	.string	"stdint-uintn.h"
+.LASF2600:
+	.string	"src/main/target"
+.LASF2620:
+	.string	"accgyro_mpu.h"
+.LASF2680:
+	.string	"voltage.h"
+.LASF2601:
+	.string	"src/main"
+.LASF2669:
+	.string	"barometer.h"
+.LASF2598:
+	.string	"src/main/sensors"
+.LASF2678:
+	.string	"current.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2649:
+	.string	"flt-eval-method.h"
+.LASF2623:
+	.string	"resource.h"
+.LASF2614:
+	.string	"time.h"
+.LASF2662:
+	.string	"parameter_group_ids.h"
+.LASF2618:
+	.string	"sensor.h"
+.LASF2661:
+	.string	"debug.h"
+.LASF2643:
+	.string	"wchar.h"
+.LASF2651:
+	.string	"fp-fast.h"
+.LASF2667:
+	.string	"gps.h"
+.LASF2594:
+	.string	"src/main/drivers"
+.LASF2656:
+	.string	"common.h"
+.LASF2663:
+	.string	"mixer.h"
+.LASF2610:
+	.string	"maths.h"
+.LASF2636:
+	.string	"timesize.h"
+.LASF2592:
+	.string	"src/main/common"
+.LASF2672:
+	.string	"utils.h"
+.LASF2631:
+	.string	"stdint.h"
+.LASF2660:
+	.string	"build_config.h"
+.LASF2658:
+	.string	"stddef.h"
+.LASF2640:
+	.string	"stubs-64.h"
+.LASF2681:
+	.string	"voltage_ids.h"
+.LASF2635:
+	.string	"wordsize.h"
+.LASF2676:
+	.string	"battery.h"
+.LASF2674:
+	.string	"sonar.h"
+.LASF2595:
+	.string	"src/main/fc"
+.LASF2659:
+	.string	"common_post.h"
+.LASF2611:
+	.string	"parameter_group.h"
+.LASF2679:
+	.string	"current_ids.h"
+.LASF2629:
+	.string	"stdc-predef.h"
+.LASF2677:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`i\002%\013"
+	.string	"\004\r]\003"
+	.string	"$"
+	.string	"\340\277\364\333\002\032\002"
+	.string	"\001\001\240\342\234\212\n\002\003\004\315\343\301\244\013\005\006\344\332\221\323\t\036\007\354\316\265\341\007F\003\003\002\004\002\004\b\t\n\013\r\350\244\345[\036\005\002\005"
+	.string	""
+	.string	"\016\247\320\217\212\001\017\020\022\256\313\363\343\001L\002\006\002\007\002\b\002\b\004\006\002\006\006\006\t\006\002\n\013\006\b\002\b\024\352\263\360\321\b\025\026\027\030\031\032\361\226\343\254\013 \007\006\002\f\007"
+	.string	"\002\r\033\036\271\227\355\346\006\024\002\t\002\016\002"
+	.string	"\002\003\004\002\016"
+	.string	"\002"
+	.string	"\037 !\350\314\275\271\006\b"
+	.string	"\002"
+	.string	"\"#\203\366\244\240\016\006$\350\225\315\212\b\b\002\017\006\002\007%\313\304\355\226\017&\313\332\267\345\r\004'\332\322\232\366\016(\307\357\253\232\017"
+	.ascii	"P\250\260V I\fm\006\260\202\"\252\325\001\021\320\\\343\024\t"
+	.ascii	"E\005JR\230=\306\345\022\271\226\2707m[W^\273,\310\017\342i\210"
+	.ascii	" \241\212\":\236\355\\\304\341\3061\021\207Hf\320\023\026\243"
+	.ascii	"\026~\221\266x\363\213&(\356\021\374\005\376L;\367\337|jh\373"
+	.ascii	"%}\243\211\217\260\320F\036\335\352\256\325\356\377t\317\311"
+	.ascii	"P\274\220O\267\352\231\217\372\362B\357\376)\371\367\344\331"
+	.ascii	"\264d\322\205B\364v\357e\3024\203|Vb\216\276\2662\021\321\371"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375 \320\r\003"
+	.string	"d\003\304"
+	.string	"\f"
+	.string	""
+	.string	"\001\006\001\001\007\016\001"
+	.string	"\001\001\001\r"
+	.string	""
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	"\022"
+	.string	"\001\032"
+	.string	"\036!"
+	.string	""
+	.string	"#"
+	.string	"\001$\001\001\001"
+	.string	""
+	.string	"%"
+	.string	"\003&\003\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"5E\270\\Q\351asUL|e\016\346\021@\b0\363\032p\200\250k\330\344"
+	.ascii	"f\252m\310E\220\263\206\314P6\200\005"
+	.text
+	.section	.gnu.lto_.inline.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\311\003\235\020"
+	.string	"6\026PD\020\253*\035\321\327\337\361\352\223\013B{3\200\001}\264\327\273:\327\204@\304\rtN\365\221_\240;3\0210\005"
+	.string	"\225\r\344\\\002\005@\004@M\3051\0054\216\203D\321\215l+\213\312\242\222\022\266\245\334)4"
+	.string	"@"
+	.string	"?"
+	.string	"\027\344\004_<\217\343\254\323\323\232\"\027\366\037c\203\333\372/\302y$\262\327\236Jo\200\377\032\336\324\372\351\377o\366Ie\377K\324\336\223\326\376\177\330\235\347+&\025\377w\236\253\362\323\023\\\327(a\003\307#\177\323#\376\324"
+	.string	"\200\220\301fQ\310\343\254\242\250m\220\200\225A\007P\314\313&\301i2\030\333\036\225\335\252-M6\217\262t\033oj#`\250\005*\330\177\362\001\366\233\202-\244\345\312^\017\\\262em\177TZzS\252 \034W\236u\037\223\304\315\024\020\216*\022\324\026`i\210\205x35j\222\330mF\232\303\312\bD\364w\356o/wFY\017\261\021\242\206\260"
+	.string	"\241\302gB\004\001\007\b*\354\361m\307\276\005\242\203\007\352,\034W\2369J\232Q[\2268o\320\366\300\177\317\031&\245\231.@\340.\370\0172\206-\315\261\035\352\220D\224\006c\250\001I\307\b\r\t\005I*Y\016p\242BE\346\001\021\260 \217(\t\003\031mR\331Y\003L\370\362\270\2561\207\261\347\342/\035\017\224\260\r\336x\264\311\031@\023\0268\030\3751\346\003D\267=\031\274IEA#r/\353\342'\2461\344\f_E\215F4\202\247\006:\035\222Z\341\346\375H\fB@\027\244\252\355\177F\245f\322\310\032l\301\024I\265P\355\234\347~:\207\026\351\031/\234o\364\213@7\007\305\267s\210I\356\313\032\354\030\302\024Uppd\020\035!\031\371"
+	.string	"\327\226@\300\231\256\320\370\n}\235\235\271`\227\236\020\226o\te\204Q\231\243+cj\006\371"
+	.ascii	"\370\006\n\311\227~\313\325\024G\366\343\322\346\3429Z\024\346"
+	.ascii	"\212qM"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`#\001}\006"
+	.string	"2H\032#\220)\351\377\377X*\350\325\377\377+a\252Z\273\273\013\272\331.\203\262\037\213\276\370\307J\315\036\244I\231\002\377\027\001\371G\253\352\324\361\020\217\217\315\307\032\007\006\3030b\245@\375\210\345\342\twwu\024\213\222\221\222\225K\332\ty\274b\021K\336\213j\232j\342\253\246Q\202n(t\255\273\343"
+	.ascii	"\320\256\205\264?p\023\001+ \200\202\031#\262\003\260l\321\321"
+	.ascii	"h\271;\326nV\223\020\"z\004\t\361\024\033\202O\200\316\f\017"
+	.ascii	"\036c\023O\321\234\034\233\302\346\253\305\354*\240\f\024r\r"
+	.ascii	"#\0216\020\212\360-6\251\351i\027t\023\027|\374\b\330N\222\177"
+	.ascii	"\225\201\366V9<\002\260\253t\031\267\215e\330\fr\013\327b\243"
+	.ascii	"\243\n5\004"
+	.text
+	.section	.gnu.lto_.pureconst.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\230\004\006\232\004\007\270\004\r\230\004\022\230\004\032\230"
+	.ascii	"\004\036\230\004!\230\004#\230\004$\230\004%\204\004&\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\315\005"
+	.string	"r\207\025\036\240)\303\001\377\243\372\377\303UUU\305\371~\266=\233\345\266\315\334\235\"o\311\223&S\n\252\312\263D#\2510D\001\372p\033u(cg;\272P\314\r\263Q\224\332\2529\332\242\304<m\323\002\212\366\362\020\004\272\\\253\241\273\210Me^<l\235\331\016|\022) P\2021\306\254\007qI"
+	.ascii	"\247<\265\024\203\342Z\rN\026\306\261\217\026\3435\203\036,t"
+	.ascii	"`r\035a\213\243XX\030\306It\3652&\226\033\265\023\234\341\210"
+	.ascii	"r\257\251\027\332\354\3652vV\373\307\214\007%\217\037`\252\034"
+	.ascii	"\203\256a\3072\256 \nh\307\345-B\377x\303\313\333\341\205\265"
+	.ascii	"2\004"
+	.text
+	.section	.gnu.lto_.lto.5e339cd4643bb920,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_attitude.59.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375 4\205\001"
+	.string	"T\002'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001\025\001\002\005\001?\202\210\200\030\1773\273\0014\273\001\274\001\273\b}{\275\001"
+	.string	"\003"
+	.string	"f\nK\tz"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.62.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375 \202\345\003"
+	.string	"\344\006P"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\317\301\037\005\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\005us"
+	.string	"\005\001\006'\001\b\026(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.ascii	"K\205\220r5E5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.64.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375 O%\002"
+	.string	"T\003B"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001(\005\001?\202\210\200\020\177}\273\001{\273\001\031\005\001\006'\001"
+	.string	"\304\023(yw\300\001u\277\001s\276\001q\275\001o\274\001"
+	.string	"\005"
+	.string	"H\005\006\327R\006\270y\331"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.65.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\365\007m\036"
+	.string	"\306\364\261I\260\324Q:j\20186t\225V\006\2645p\344\207+,\203\037n\207\274\307\350\240\020\236g\006\205\340\270\303\036\357\0028b\312\2552\030k\374\3751\005\270\361s\351\244\227P\310\251}{\255D^.\013\350\321\377\215\020)S\n\241"
+	.string	"\200"
+	.string	"\235"
+	.string	"S\t\351E\343U\277\360\277\372\261~\255\177\353\347\372\273~\342k\366o\365\035\347\361\254\017\337\343>\376\343E\333tSD\035\020\206]S\017\274\270\250\034|mY5"
+	.ascii	"\323\332b`\005\253\207\002\332I\335\227+\256\004!\204.\362\234"
+	.ascii	"j\246\210&\037R\007h'w'\004|\352TJ\257r\221\266D\342\026l\322"
+	.ascii	"Ee\316\031\340\244\001\320N\362\256#;9\036Gv\322J\266\224\013"
+	.ascii	"e\314\231\213\034\037\262\264\3149\201\033\343JW%\377\305\327"
+	.ascii	"\236\240\226\2563\004sN\353\023T\211{o\373g\233\310\246\021\005"
+	.ascii	"\367r\321\237a\017&\352\237N\372&\312N~w\240\250`\3221\253V\026"
+	.ascii	"&S\273\330\302%]\030\366\307\271/\354W\335\277\013o\337\257\356"
+	.ascii	"\336\261n\336\265\356\335\267n\335\271n"
+	.string	"\237w\335\271\023o\334\325=W\363\\\275s\365\355j\235\253s\256\306\271\372\346j\233\253k\256\246\271z\346j\231\253c\256\266]\rsu\355j\332\325\263\253eW\223W\217W\357\325z\365\177f^KpE\346\0341\346%\265\237;i\302\204\266\265U\261\240\r\336\366\226\266+\026\224j\032\266\230m\022\027gd\330\026p$F1`sN\003G\376u\344\3178\3512)IvR\263\236\252\310Vg\373\240T\361\036\235\346d\372\221+\333\373ln\311\035\303\202Q,~\373*\335\337p\205o/\374\372\206)z\373\253o\017\005o\217\265\3133\261\333k\351\356\206P\272\375\326\270_\235\221\r\343\336\306|\366\\\273\273>D8l\227\334\276KW7'\244\203n\301\355\211\3471i\027\177\277\270\375W\320F\223\216\331\007\022AeP9\n\225BC\345\0304`@9\n\r\225A\345\350\b\005\204\210$\020\220@"
+	.ascii	"\210f\250\024*G\023\001m0*\002j\260P\241\350\002\005 \206\242"
+	.ascii	"\bF@\"\244$ \020\217\2172L@\002j8:B\002\332\204\363\343\334\027"
+	.ascii	"^\020D\t\3236\271g\237B(\b\236\236\235\345\331\347\026\267;;"
+	.ascii	"\206\001\271\375\250\2236)\223\316\336V\305~\253[\235]1\253\234"
+	.ascii	"\261/b8\233\263[\337\342HQ\335p\331\242\305f"
+	.string	"ot\373[\233\0345\213\345\212\025\232\232\231\245\301\355\f\016\231)R\302bV\246\267\274\215\211\272a\333'\217\002\005\354\036\"\203Y\233ow\013\023U#\200\245\250ad\346T\211\214HRPT\220\f\007 \003\221\321F\035\022\300\222\231\216\211\224T\326(\267\260\214B=\007\002j^\237\021\236i\367\375\324\365\f\251\315\0032\b\013%\370v\211\374B\320\224\320w\201\331\336l\327E\320\373\\Y_vX\243\273r\316\316TGX\353<D\265\\\317\334\004\371\023\256\322\267\366\"\210\340\025\241\2278\357Z@%\302\201}O\330\273U\241\353\"*\327\"Y\022\327\277\022\311y,\001\365\302A\3712\200C\032A\234\025\221k\2730?3*0\255\023\025<\035\030\324\270:\271m\346\272\341\f&\221\266\214\317^\267\367\361\177\314(\212\200\023\177\332\361\266\351\355r\342\306\262,=\006r\325\034\204M\003\006\363\306U\241"
+	.string	"\251<<\272\316\017\002\r\303\210V\3666\211^\226\n\232\267\263\t\b\3338V"
+	.ascii	"K\210\370\0016\230\212\206\345]%1\320\222\031\357\200\243\377"
+	.ascii	"p\244\013\"\243\002"
+	.text
+	.section	.gnu.lto_imuConfigure.68.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\324\003e\030"
+	.string	"6l\231D\300\330*\035\2004c\3245\035\251.\004\322\370\221#\2301\371\337R\177s\354\241\212\301\342\333\235\325B\323T\035`\024\213n[[\206-\237)\214\274\2514\b\020\256\022\213\373\371\315I\313\013E[#\233l\231R~"
+	.string	"{"
+	.string	"\212"
+	.string	"\353\233Y\210\370L\356\244\347:\277\311h\007\025$\273{\372.\334 *\236\213\337\256\256\301\347\201\027*\325\357z\236[\241\201tc(\370\373\364\231\364\330\247\317\237l\003@\225\252\375$WR{n\205\347\256\216$Wvu\016\274\200\364\t\340\003\304O}"
+	.ascii	"\361\3235{\315uA\366<\0277^\233\335MI \257]k\376\227\274\204"
+	.ascii	"\223\301\342:\242\260\273V\234\214\031\267\274\355\004\266E\330"
+	.ascii	"a\2058`\357X\302\360|\353\tEEgZ\354\332\022H\031\312\377\030"
+	.ascii	"\361\221R\212c~~\227*\177{c\303\036\245\004i\267\205\004\377"
+	.ascii	"\311\241\354\370C>-;\241\307\235\020?/\035\b\311\331\264\310"
+	.ascii	"*\205\206\320j\320\326\371\250\364a?\334\335\265\354a?\367\013"
+	.ascii	"\230j\234\251F\251\372$\252M\242\2724\325\244\251\036\251Z\f"
+	.ascii	"\325s\252\303\251\226\252\326P\375\034\223\2212\f"
+	.string	"z\2730\212\334\004h\236\306=\177\2101\330\212\255\020\235\350(\034\220\317\246A\035\273+\332\256\205\033\345A\333\340\300\017\325\324\023\371B\037\312p3\356=F\016\020\2175\277\335\335@\372D\020\"\260i\320*\005\310$\355\r\367\221\341\202\003r\370\030\020bL2\225\006GI\332\035\016\306\303\227P\r\016\370\341^@t)\311\b6H\322\016\361-ZF\222$\312\321\224\342\352Wz\263F(m\326\253\270\227\203fw%\370SNel\275^\342\247T\023.\227\214\226b\\\271L\304V*\306\221\2052+\302\203q\004\204\021\020tP\255\330\213\207\265\342\221\301hck6\223\215\253V\214F\223\315H\320\nx\324I\261\003K\321H\274`1W\212\007\306\332I\2153\024)\035\002\226\231h\315R4\231l\226:\351l\017W\366\260\205#>\233\3641J\252\271 y\273\177\311\237\003\027\344\303\221\356=h\346\247"
+	.string	"%\377\003\346$q\244\310sr\023\224\240\320\233\3740nl\206\366\273\233\202"
+	.string	"y\222\222\313\355M\220\255H\025]\233\007L\2501@\345\0303J\t\005\"JZ\0205\006\300\002\031!+y\021@\275\203\210J\013\265\377\033"
+	.ascii	"9K\204\233D\332\210\030\316M\177n\275\205j:\271\224\034\200\233"
+	.ascii	"H\270O\226\2119\302\223F\231\rZJ\214\341\242\222\333{Q\2067Z"
+	.ascii	"P\b\274\311\361\032H\200[\344-A\256q\372\271\214v\253\375\306"
+	.ascii	"P\202\241M\204\036.R\373\221\177y~O]i\302\252z\004<\301\333 "
+	.ascii	"0\036zPdt\023G\243\234\3111\270\267\201!\005\372\2372\223\005"
+	.ascii	"n\331\374\335M\256\241\b\346P<\2215DA\027\2658\304\037"
+	.text
+	.section	.gnu.lto_imuInit.69.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\032\001\035\r"
+	.string	"\326\030WB\020\221\223\016s\271\336\372\nQ\371\250\200\363\337\212aM\243\036\013\240\034\216-\200@N\002\235\321o\326\370\337\030\022d\266\217\351\313&\262!\266e\240\t \216\241e\232\302U$\260c\225\020\262\211L)\005@"
+	.string	">"
+	.string	"H"
+	.ascii	"\370V\370\342\337\373\365G\200\231\030\006hdz\330x$\215\233"
+	.string	")\321\326\234\216Z\033\237F\244Q RP:23C\021\036\371\243\332-\006\360TH\376\225 3\373\247\362\301E\267\ri\333i\215\n\210 'H\252\361\370\034)=\332\217M\200\260\314<P\273\370\245C\315b\327\022\321\375\354j\221eg4\212\304K\351[\037\323\"#\277\243=\221\216!ZW\211+-\276\030\276\327_\253z]\245\020\f\215\002\303\364\255\026^\350n\240\340ph\241\035x\305\203NM!XE\204\0025(\234B\302\204\221\021\313\316a\247\206K\205\365\t\303T\246f)\205\246\232\262\354>\343\335|\034\261\365\220\334\257\022\360c\253e\270_\365\210\210>Zf\202\341\202\246\301B\266A\253\360\311<\241\222Ld@A\034HB\231\t\b\024\3128\247t\225\270R\005/hJh*\201\267\013\030\334\257 &$\3651.0\026\r\232z\213wsae\234062\213`\333lN2\003\033"
+	.ascii	"2\241\223i`q1\300\t\264\3331\034qh\022u\241!\226\fWx\033#\250"
+	.ascii	"\261[\207\261`c\t\343\r\374TfH\246a\r\200\301\345T\213Z\023q"
+	.ascii	"Fe\267k\"\346!\354\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_imuResetAccelerationSum.70.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"u\t"
+	.string	"&\320<90s\322\001\320\234\374\346<h}\257\323 4q\037\221\272\340\3003;\024\320\235\020\274\265h\213\202\265\200X|\002Y%h\210\240\005\203\357\354>\201\031!\264*\313F{\247\024)"
+	.string	"-"
+	.string	"."
+	.string	"\017\331\263s\036\262\366\255\021\217V\317\356R)r\357\321\363_\362\200O\205z\0049\354\256\343\247\002\271\345m\037\330F\260\017\021\237\3468\305\177\237\376I\373$\210\311Rq\346\3702s\263\321\307\016QQ\206\330\007X\271\262A\0022\233\004\234\335\217\331\317\302\246\f\211\355\031]\307\332y\313]\374\362A\233\354\262K\373,\320\371\312YZ\361~i5\fWI\241Q\270\355\205\243h\f\304v\267\3017\371\311\206\017\006\036\211L\244\215\226*(6\213\tz\261E\220\350\210\353\250\310\300\025C\202\243\245Z9\032\n\367r\365\300\003K\311\016\373U\363a\036S}\320\001\027"
+	.string	"3\001G\320\2149\364vSyNY\006Y\300\030\371%\223\013\310m\303&`\334\255\244\202\310"
+	.string	"t \026\2528"
+	.ascii	"\273\252\325\205\256\341d!\214\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_imuTransformVectorBodyToEarth.71.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`u\005\235\032"
+	.string	"V\256\236G\260\230M:\200u\224\344\346\016*\2237\021\302F\307\036z;\304iCP\352\177\213\306c}A\313\367\021\353\2211Yn3\002e\373A\377\301\343A-\023\256>\350\263\207c\276\313\244\004n5\033\272Q\223F\273I\231R\212"
+	.string	"u"
+	.string	"\220"
+	.ascii	"h\246\024y\205\343\277\177\352\007~\355\037\310\251\036\304\261"
+	.ascii	"\333\016\240\017\b\277\251\022?'jS\005\n!9\034\210\227\267\252"
+	.ascii	"\002\367\375\007\357\277\022b\022\213\235\336\323\020/sN\003"
+	.ascii	"\227n ^\376\270n9\n\\\355\363x\017\336\245L\374fN\2472G\346\364"
+	.ascii	"!0\220xi\337u\302K\3618\341\245y6\227\373\240\346\353\211G\n"
+	.ascii	"*2s\316\334\3328\357\312\363\037\344\260^S\322\365\025a\316i"
+	.ascii	"\3555\265\270\367\266\007\330\026\262C1\f\206\234H\007\377\306"
+	.ascii	"\245?\204\320\367.\375\020\341\345\027\027u\245\244A+\221 \225"
+	.ascii	"\251gl_\222\356\223}\327\\'\373\277\033\367\251\373v\340m\273"
+	.ascii	"\324\037`\325>\253\356Y5\317\252wV\255\263\352\234U\343\254\032"
+	.ascii	"\300\252oV][5m\325\263U\333\254Z\266\352\330\252kV\r[\265\270"
+	.ascii	"\352\327\252\303U\313U\273V\275\253\326U_@l\306\024\003]\346"
+	.ascii	"\\\021\f\036uV\262lVV\205\312\3166%V\325d\333\003\377"
+	.string	"\243\244g\\\263\257\265\255\026a\252\001[qk\326'\213\350Q<\036\013\312G\330\036\353L\376\304\343\255\234\354\016l\2427\326\336*\352*\334\335\327\312\"L5\2264h\271\256\r7\fs\341K<\n)y W\b\301\223x\324!\331\345\256\\\253\333\357\256\213\212I\307R\321\217x\004\202\2623|4\022\347\234\013\214H8\"\240u\303Dx\251\013\024%e\345\021\007e\373\300\253v6\2559g\">\342$n\n\272\004C\025\024TP\020D\003q\017\005}0*\312y\300p\241H\203\205\334\206\"\nF\271!\244\016\271\240\036\037q B\312y8:B\312\305|\363\256\271N\236@C\212\322.\031\2676\221\316\240\f\237M\203\346Y\275\255\333\372\354\3030m\3050\343Q\246Uf\241fQ0^\340\366\277\236\335Y\034\317\302\266g\214\2300<:\213\263;9+W\007\214G\335\326\227\234\305\351\302e\013"
+	.ascii	"\027\267\375\324\315\322\366V[\330\336h\311\262;\020Km\266\262"
+	.ascii	"\245\331\254\334\331\225n\250\201T\245\030$32\nR\224BZ\003\320"
+	.ascii	"\002\221\021\242\333\021\320\234c\016\"\223:[k\340\242\021k\f"
+	.ascii	"\321.28\346\004\232\303\223\313R\257`jR1\005\351yM\204\364\035"
+	.ascii	"\313F\2160\315\331\226]\306\031\333\331\300\275\245R\035\210"
+	.ascii	"\205\031b^\376\247\266\312V\365\231\027\252\230\237\342>\247"
+	.ascii	"\021YL\205\212\331\247p\232\304\020\244\005\321pQ,;\276J9\217"
+	.ascii	"\202\234\232Av\304\327V\200Cb\320CX\224\304,\342\303\233\207"
+	.ascii	"5\231\035\020UTW\0026\bi \021n\350\3109g\247\252\230\003{e\347"
+	.ascii	"B!6\260\006\007\346\243!v/\273C\3368?\026\334\210\374\003\031"
+	.ascii	":\313V>f\306\317TgU\037\345\306\002.\013\020\242+\246\022\214"
+	.ascii	"\020*\320\250\005\234\377"
+	.text
+	.section	.gnu.lto_imuCalculateAcceleration.72.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\035\013-3"
+	.string	"jY\374\022AP\346J\007\177B\312\""
+	.string	"\007\356\202r\004\222\336\031\361\377\272\032\353\343\034\355\343\033\232\001XSk\364\275I\326\006@"
+	.string	"\0364g\212"
+	.string	"}\351m\367\001\300W\277\211L\327_\305hhK\271IJ)\005\f\001\b\001*\001\3259\252:CUg\002\325\371\251:\017\260\316NC\316\002\252sSuf\252\316K\326Y\311:\007\250\316"
+	.ascii	"\254sRuF\252\316G\325\331\310:\027Y\347\241u&B\235\207Pg\264"
+	.ascii	":[\353\\\253\363i\235\205\325\371\255\263W\347\336pT\205\016"
+	.ascii	"\027\233{s4\007]\3003M\223\356\322\375\245O\027\272\220\271\333"
+	.ascii	"K\363\3610J\256\310\374%\006\021.\351\336\210\233\243w\357\235"
+	.ascii	"\200\366\031\345\243\330{\315%\355.2\32069\263<\246\340\275r"
+	.ascii	"Z}\362\030\332'\003\026A\355)\2663w\226\326\222\266r\006\017"
+	.ascii	"\335;d\316\231{\367\270\030\013\355\223\330L\265Oa+\325>9e\326"
+	.ascii	"\323{H\256\315sC\203\357\317\275\327\370G:m[O\341{\312=\204\234"
+	.ascii	"kk[\221su}\322\265\360h.NH\274\367\016\347\340\374\205Yxpx\034"
+	.ascii	"\315\035\205Lt\210\340i\276\366\033so\356\366\301\275\227\035"
+	.ascii	"9\247\243\031mf~\301\314f\314C\f\001(\222\331\002\006o$\023\341"
+	.ascii	"\276\215\275/\216}\346\f\375\246\276\355\277n\303f\2157\377\325"
+	.ascii	">\253\233\363\231\321Z\215\360O\256Fsf)\364>6\377\314\034\272"
+	.ascii	"\f/\227\302\230;\264\027\017H\215\344\343\377\357q\266\272/\315"
+	.ascii	"J\214\371C\223Q\203Br\357\r\023\323c\326\270\225\364\311l#\274"
+	.ascii	"\221}r\217\250}\372[%\323\370\251!\373\376\322D\267e\037\357"
+	.ascii	"\366\004\271L\326l\276\201\273\327\215\252\237\354\275\314\361"
+	.ascii	"\311\2337y\354\373}\360(\350\346M\036*\207"
+	.string	"U\274\217J\235\353\202\230\367\332\374\363\230[x\277\b3\352\214f\235/X\3473\353l\326_\232\311Z\331=f\235\035X\347\006Cg\006Cg1\353\274\300:\207Yg0\"\347\257\352\254\300:{\241\316\t\254s\227u6Z\347\"\2213Wu\336\262\316Z\250s\226uF`\235\017Xg,\"\347\253\352le\235\253Pg\252\352l\240:\027\250\316\304\352<U\235\245\002\005~\352\r\374\023:\342\021?\352\013|\035<>\231z\251'\302\361\322\305\324w\030w\343e\203i>\251o0I%\324\223}\324\013\363\034\337\220=\201\207\372>\3425\375\362\322\t\233a3\265O\002od\332\271\031:\373Dh\3007\375\223\323\017\020\360N\3374\n\271y\023J\013J\245T\005rJ\245\003\245V\244\002\001\t\370*\246\322OS\323\321\f\322\021R\231~p\351\001<\323\367QO\351\227\336\t\035\005\335\366\002\274\022\237"
+	.ascii	"\177\305\264s\023\344e\023\023\200oJ*\005\235I\257\007\351\223"
+	.ascii	"\276\217r\336\350\221\360\360\022\353\352\350\261\222\3127\022"
+	.ascii	"\364\363D_\364\317w\304{@\364\303\357\343\225\300f\246\301H\261"
+	.ascii	"`\251}\022=V\362\250o\220\331\304\345\320\023~\036GU\264o\276"
+	.ascii	"F\371\b;\252\016=\332\263\323\260{k;}\247\214[\t\247Z\322-\336"
+	.ascii	"\310tK\355s\350\243\230vE}}\232\t\022\017\360?\217\273\254\242"
+	.ascii	"\017\302\013\023\316\00313\204\006,C[N\317\211 \201\002\205\332"
+	.ascii	"'\372PL\245\340\2237\230\366r\026\032Bx\b6\024\037L\260\255\255"
+	.ascii	"\251\r\261\032\230\327\032\210/\020_E$\rj-L\260\205\250\274V"
+	.ascii	"tq\242\204\261\005\211\021%L\2100\242(\241v\302\270\266\202\205"
+	.ascii	"\261\350\304)T\260\2550\266H\221b\205q\270w[x\277\bW\260\002"
+	.ascii	"\350\366o,Cx\357\020\262\356\322-\330\305\233\354\340\261lu\203"
+	.ascii	"wP\305\255\360\337\016\366c\277\332g\003*\f~\312\330\213=\003"
+	.ascii	"\207\342Qf\320\245uu\265O\261_J\332IY\360N\364.|\330/p&K\302"
+	.ascii	"\274\036\354\302\327\203)\370J*\370\252\244]\202\367\352\341"
+	.ascii	"G\312\332\317H\332\244\301\344%\370\366\003\322\365D\206\234"
+	.ascii	"\275\361\273\270<H\032\n\304\250\365\3053\256/nq\241\371\335"
+	.ascii	"V\326k\365\260\253\313\372\201\340\351\322\214\002y\264\331\037"
+	.ascii	"x\004\337\256#\ru9\237SK\357\322\037?j\237\007\336\210\231\246"
+	.ascii	"\313\253\036KHJ\304\033i\366\304\270o\343\253\307\342r\253gN"
+	.ascii	"\217\244\311\332\310\253g\346\3408xY\365\205\304\352\253\222"
+	.ascii	"T_\365\376\227\304\221e\375\267\304m\244M:L\240\034\257A\365"
+	.ascii	"\375\307T\336"
+	.string	"\031\370\243\227A\362\t\200\326\250a<\005\225C44\n\n\222\222$\255\001\300\002\021\031#v\021\3208\247\230\252\032QJ\205v\003\215\305\317^\321\303\016\200\263\332\026\262gb\245m^\367]\f\264U\302 )\031\3737\344Ow\242dh\024L\357({O\303\002%\316}\243\036\202,\225\362Yp\250\034\364\340KR>\372\241\025s\316\300 \354u\037\263\247\002\002\203\341\332\231k5s\260$\315\376\204\235&\251\327\350\364\342a\035l\341,\017'/>\301\220u\023`7\tnMz\277oEd\f\305\243\nv\272\327 \244\333\201\\W\227\312\353\361f\247\037I`4`\256[\352<X\001d\217b\301\254\0303\342i\213\216E\312C\203\035a\327\024}\232\bD\322\303\t\220\200y\013\355J\210\325O\364\\\207\246\262\243\020]WF\30006\2242\022\317\024\322\006\354\212\371\240\342\314I\343%\325iyf"
+	.ascii	"\004\243\216\231\361\342F\026K[2\201Y\313\024\320G\fi\f\277]"
+	.ascii	"h\300\035N\211\004$LX=\n\314c\t\332Hrr\271\311Wi\247\325\265"
+	.ascii	"\361c\372Po\035\023<\341\263v\016\226\340\302\b\370\343D\030"
+	.ascii	"\242\330\315\231eC\326\272\034\370C\360\302W\336mt\367\324Nw"
+	.ascii	"7\265\224|\267\\\343\327\2765G\224\333\302\331\277'\2364\346"
+	.ascii	"\347\t#vf\320bN\225\260\261eZ\362p\200\217\260$\241\003\211\302"
+	.ascii	"\215\352\230\250\243\264\303\312\241\237\025HH\310\341\260\350"
+	.ascii	"wP\360\207\036\324\013\214N\306\314\342q\221\233\235{\033U\003"
+	.text
+	.section	.gnu.lto_imuMahonyAHRSupdate.76.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\272\037\355}"
+	.string	"\212\325T,B\020@oe8\013au\036\260\317\377\356\322\031\220|;>&\304,\036\205\240m\300\301\013\212\260\313\355fc\022\312Tk\261c\255HNy\301H\203Q\227\260M\013+\205\013\253\210\346\b\211\204\220$\223\f\300\002R\002\310\002*cW\253v\225"
+	.string	"\257\016\340U\001\274\032\200Wcx\025\206W_x\025"
+	.ascii	"\257\272\360\352\321\253-\274\312\302\253+\274J\345U\025^M\341"
+	.ascii	"U\024^=\341U\023^-\341\325)\257\222\360\352\b\257\212\360j\b"
+	.ascii	"\257\202\360\252\224W?x\325\303\256F\355*\224W\237\274\352\344"
+	.ascii	"U\243W\233\274Z\364*\321\253C\257\336\253\353U\233\205\022s4"
+	.ascii	"0@\3114\301\024b2\371\210x(\030\223\235\311kzO;\221\275\310\336"
+	.ascii	"\263\371\354>\233\221\355\310\366\363\323:\255q\245TM\345f\271"
+	.ascii	"(\024\325\233%\341K\234@\201v\026\271e\272[\254\326\370\251\220"
+	.ascii	"T\245\204.\\-K\246b\360\354\022G\266\246\027:_2}1\301h\"\325"
+	.ascii	"\032&0.koFK\225\254\336\354H2%)\206\244\336\201\2009yT\307\216"
+	.ascii	"et\346\034\034s\203\346\006\251\024Uy-(\305\223t9\2443\347\204"
+	.ascii	"\351\t\234\263jc\224$\305\221T\241\264\212\003\025\005\233_r"
+	.ascii	"\3169\250B\031\222z\2304\t\207)\252P\200UT\241L$Z\221\365<\203"
+	.ascii	"ip\rnd\033\374\347G\n\245B\314\r`o\022\255\261\371\351\322L\017"
+	.ascii	"\316\314\233*UG\272<\246\0314&\216\321\231\r8\244\355\351\323"
+	.ascii	"%\322\206\034\214\374\303\367\207\005o\217PLo\021\330\261\f\204"
+	.ascii	"\211\306%\023\234\bF\023U\370U\251&\0023jI+q\026\2470\3204M\031"
+	.ascii	"&\352\024\243\211\252)\034!\nA\321!\277-B\206@`\001\317\003>"
+	.ascii	"\2038P\n\342\023\002'\020\230\013\222\200\b\203\220i\341\321"
+	.ascii	"\017\243\211)\270T}Ui\330\030\363\237+\2463\301\030\315\034\242"
+	.ascii	"\271A\323\244\263\322\035\205~t9\004a\242\221y\311!Xw\251\201"
+	.ascii	"Gt\1778\214&\242\240\241\312\253\3529\363\031s\037]\252\223i"
+	.ascii	"\"Z\0162M\323J\0050\232x\364T\321\304\241G\024M\3241U\034L\007"
+	.ascii	"\307lz\003\310\354n\3204\315\253\277\321\242\016?\346\021\"B"
+	.ascii	"\200\220\372\340!\n\352\311\311\330T$\222\030~j\307\324M9\234"
+	.ascii	"\316\302h\361\b\237&X\204\034\0236\304\260*\220\320\016\356K"
+	.ascii	"\2233\234\002C\347\314\221\342,\210\246\034Rp\374\001\2162-\271"
+	.ascii	"\036\206)\222\213\310\270/m\3150\006\rm \261m\224\032C\251I\263"
+	.ascii	"Oh\354\204fm\215.\330\210Qs\323\2070f[\266h\306D3&1l\332\002"
+	.ascii	"\206\216\373\322\346\f\261,\005\342\371\221\027-\f\331\016\237"
+	.ascii	"\342\310\370F2\236\352KS\033\036M\323\364#\273P\246\235\260\333"
+	.ascii	"\224\3034M\335\2630b\254%\254\3522U\345\243\312\302+\376r\343"
+	.ascii	"\211yH\245\227\333\313\233\376\345\f\214L\244\355t\364\264\324"
+	.ascii	"\353\023[\343\260\030\366\032>\273\375\254@\233\324\026\257\272"
+	.ascii	"\305\265>\363\331\217e\327R\343\305\233\020\251\214Z\3465\375"
+	.ascii	"\355\006\242\321\256C\022`\017\033\272\355X\024VD\013\273\321"
+	.ascii	"\336$\210L.\t\021I\334\355*\221\016\247lv\260\243\251\352p\307"
+	.ascii	"\236\037y(\211\r\330s\234{\311\303\341\337\272\334\210|<\355"
+	.ascii	"\202\331\016|\246\251\3052\323<_\200\335]\336\004\210\204\273"
+	.ascii	"\001F\205=\0131l\t\363\277\251\215\005\307R\340\224^)\032y$v"
+	.ascii	"7\224\255%\335%\037]\252\352\276\260\237\023h;\367\f\177@d\262"
+	.ascii	"\354.\373\360'\032!\225{\377'\022\"\223d7\331\367E\301\363>\361"
+	.ascii	"\016\251$\333B\225\262\263\3135}\346^R\245#\333\277\251Z\003"
+	.ascii	"\t\t\362\351\335T\375D\255\332\256\016j\325+\320\251\320'\217"
+	.ascii	"\023Y-\347EV\343\361\236\325w\354\324Q\332\217\325q\256\263\032"
+	.ascii	"\316tV\243`>\253\351\270\217m9n\374fGV\2739\220\325m\f\310j6"
+	.ascii	"n\301\352\022\332\374\307\366\232\244\003\331f3 \333j\334\202"
+	.ascii	"\3554FcLV\2579\223\325jkZ}fO\253\315\330\220\325e\214g5\031\017"
+	.ascii	"\262z\214\030\013\262\035\306}V\247\331\220m0\306\263\375\305"
+	.ascii	"\203l{\351b\2643#\262m\346C\266\221\366c\273\314u\266\311Lg\373"
+	.ascii	"\0343#\353\bY\354\310\212\345\212\025\373Y\305\302\300\274*\202"
+	.ascii	"W\253x\225\212W\247x\365\313\253R\274\032\305\253P\274\372\304"
+	.ascii	"\253^^u\342\325&^\r\301\253]^e\342\325%^U\342U.\257&\361\352"
+	.ascii	"\226W\221xU\313\253 x\365\210W?\360\252\007^\355\300\253F\274"
+	.string	"\312\201W\213xu\003\257\022\361\352\020\257fyU\003\257\n\361j\006^\305\300\253\027x\325\002\257V\340\325 ^\245\300\253@\274\372\303\253>\274:\201W{xU\002\257\362\360j\004^\335\341U\b\274\252\303\2539\274\372\200W\035\360j\003^e\300\253\013x\025\207W\025\360*\226W\023\360\352\r\257\3320\"k\r\257\"\340U\032^=\300\253\006x\365\312\2533\274j\345\325\002\274\001S\332N.\366\227Bk.\330\334\f}\370[\245;=m\226\210\377\262[\024U\350L]\n.\304\361\3607\375\003\345\267\021>F<\203\007\312nX\236\345h\221\316\354A\331\315u\370d\345W\260\316\302nO5\310.ui4M\363\206.\f+\310\002\f\204\b)\232\210u\2528}\316Bc\256d\031\213rs<\023\270\335\334\270\215'`\300oX\335\306\367\322\333\361D\340~\243\361\003\216\200\214\3230\340\007|\365^"
+	.string	"\344\202\001\225\334\216\347\325\3556\343\005\374\352\303;\253\317\370\020\220\005]^\375\311\262\272\263\372\225\214\027\360\325\263\323%\213\272,\252\025d\234E\034\274\223R\233;P\233Hln@lf\3503K\270[\360\361,\001O\257\217\007}\247\314\240J\201\247\230\257\031\273O\362jKbl\311\225\006}t\027<EP\177\323='"
+	.string	"\234\346\214\361\b\202\234\216\367#\033!\021\342`\\1\306r\264%\2631\322\030\034\234\214\346:4\212\335J\325\232\023\360\252\344\t\300\213!9\300\005\270\2237!\333\315\366\001^\314\013\3401.\300\257\346V\363"
+	.string	">l\204T\246\271\323<\306W\020/\317\312\355\207e\367\222\216\360\034\347\223\372\211\035\306\215\346n\364\3420\376<>s{^\360\001\340f\344\342"
+	.ascii	"\374yz\362\310\271\330s\274\035\265\370\361\317\273\243K\023"
+	.ascii	"p\354dM\371\325iq\023q\360N=k7&\026\367\332\027\020\251\303\251"
+	.ascii	"\306\342\303:jw\246\020\273\342\252j?R]\305W\374g\250N\004D*"
+	.ascii	"\315\250P\222\261\235\371\232)~\342>\203\342)\340P\310\362\035"
+	.ascii	"\035\024&>\365\023%nb\216.m\230 \247\004\211O\301y\223\325\302"
+	.ascii	"\r\t\2744\347\210\207\270\315|\001E|\304Q\300\260%\254\233.\375"
+	.ascii	"\247M\226\357\330\2545\257h\242\210\373\017\210\177x\210\023"
+	.ascii	"\363\244\016\342EB\253]\243K\033\311\254\032lR\267\361\207w\216"
+	.ascii	"\271\207\177\370\0200\215.a\370\251j\001\213&\253\005\034\323"
+	.ascii	"4\261L\324U\3335\"\3529&j\021#\3533#E\023=\034\306\037\336\211"
+	.ascii	"\267V\3466T\346\022\231\033\217L\245A>\236c\356F\224\332\274"
+	.ascii	"dv\262S\330V)\360\314\363m\373\302\200L\024b\235v]\344\021\256"
+	.ascii	"\242\317\234\347"
+	.string	"D\332\312\256E\027\351'A\204\372\314-6\016J\342\253$i\313|<\311\354.KA\247\277i\024B:M>\273\223K{\273g\026;\232\2429\312a\016\365\250\357\235\231\032\331\026\266yTG\367@a\341\2442\247\035\352\0074\233\213\324\347\343\323\235\356\264\033\314\r\346Oo\2723\276\351N\037\352}yO\272\264zt\2051Y1&\033\206d\225p\035\261\302E\f3\027\025\255\257#O\272\242Lq\262\302\265a\\+\306\265^_P*\210\322\265\305\365\345\364\244K\253G\024 ^[I\234\264\244,\022)\273%e\277\240|}\361"
+	.ascii	"\323\0223\202i\025\361Z1\257\r\363\332%ZA\264VLk\303\264vkK\007"
+	.ascii	"\327\224*E+KVl\311\206-Y\325\262Ac\013I\r$5fHQI\262\272"
+	.string	"5\243\212W\327\025\025&K\272\234(\271z\322\245\345u\265\3655\345j\306\t\205\022\205\353\353\212\n\024(_WPt\247\357\246`\216D\344\340\037f{\314\226!t\3516c\231\375\034m\b\037\276\363d:\300\252\216\305\215\325Y\237\351\221\354\320\036\021\320\3564\271\bw\252p\221\343z\225:T\314\364\0349\225\270)\337R\344S\356\2735t\202\216\343\033T\201\356\353jJ*\230\222w\370\272\005\245<\312\277\222M\336\344R\216\342\016\251\204\362'\217\362\242\0362\311u\256CyS\036R\351u'\177\222<\362#\367:\261Q\221\027\271\223\237-\204\017y\223\2563y\bpr]K\256\344L\222K\224\234Ir\256\255#y\222\344\220oi\035\204#\201\303\243\005\302\2412\037\374\210\007\357\340\037\374\202C\356\201\221s\360\016\276rF~\030\220\312;\034\034\032\263\301\213\020y\3267\370\t\207\234\310}\336\031\362"
+	.ascii	"\342\250ip!\317\202\223\323\340\317\313\340B\276w\031\350p(\214"
+	.ascii	"\334\235\350\246\234\\!\236{Q&=x\b\357\334{\230t9\266\347\316"
+	.ascii	"I\374\251\235\227\354\334~0\270\355\304a@\251\316]w\301]\007"
+	.ascii	"\356\202\373NPi\301\255\274\221rn\301}')\356\366S\301\035\027"
+	.ascii	"\344\024\274\002JM\202\\9\005zpw\035\220\033\356\307}\034\210"
+	.ascii	"\240\327\217\261\373PD\347\343y~\202\033\205\373\256\307%\370"
+	.ascii	"\004\222z\320y\226K\360\225\201\317\307\323\317y\334tb\220\231"
+	.ascii	"dg\303\237\021\177\263\356!/\271\211\260\2325\036\343S\264\335"
+	.ascii	"\027\217\235\336q\325\221t\354\260\273\343\332\310\256%F\231"
+	.ascii	"I\203!\352\216\307\356o\350\025E\257p\327]\327L\r\322\002\362"
+	.ascii	"\350\341\303G\321D\257\360\025q\"\371I\220\242\276@\373\313\227"
+	.ascii	"\030j\310\301O\202\004\215\203\224\314J\222L\005\2627\374\361"
+	.ascii	"\370\214\277>g\241B}&\bGM\366\324\340UH\017_\t\277\301s\013\013"
+	.ascii	"\311\31583GN*\202\275&;\016\301#X\324d\207\216Cp\345X\327\261"
+	.ascii	"&G\"\257\007\356\300s \362z\240\201;0v\2547\300\306\300\017\371"
+	.ascii	"L\207\005\216\343\f\334\310\344\026ZC\272T\317Q(*H\005\025M\\"
+	.ascii	"\340T\177j\247\234+p\034'\352!\225Y\216u\005>\024D*?\024J\203"
+	.ascii	"\365%\301\001\202\273\250\342`-\213\222\020!\232\021\021\221"
+	.ascii	"$I\322\032\362\013\020\006\003a\030\323\352\022`TAIJ\205\315"
+	.ascii	"\230\244 )*\225\226\003\315\256\226\351k\276\207\323\216\226"
+	.ascii	"\nMd\305\370EH\353\206>\032\323J\305\022C\247\326GI=+\324\375"
+	.ascii	"++\254\306\273\262\302\352\363\337\375^#\3708xK[.\265O\271\374"
+	.ascii	"d\275(\213A\210\320$\366\252\264\221\256/7\264S\321\350\2260"
+	.ascii	"\361\252T\262\306$"
+	.string	"3\250j\270E\371\305\236\372\331\374}\363I\365\365\227x\255\203\356o`\221\351\250\300\355\262\323\020\2203*\366\325\224O*\003\020\271\260*\363\234f1\347H\337\267\302,\313\304\373lv\226\005~l\337\227\021\252\331\270l\003\244{\232\034\257\275x/3\3314\251\247\020\226\317}\304f\235%\275\231l\177/,\254\333\300Pn\2260\324\216\271\304i\261,\310b\2022\212dG\232\034\036\206\212\246\t\272\213|\225\222=H\203o\307o\nV4\\\030\3212\np\026\177,~\204\n\016B(\240fw\204\323\371r\361\032\214\rO5\004\364\370\311\362\336\"\247~\032\n\tC\216\267\276\201\315\333=\3406\255^?\"{`$V\022'yK\035\301r\277zM%\030\274B\257^rx\270\203\321\326\360\220\320\274\235\270E\350\3144P\233aJ\327\323.\376Q\220b\221\030\0162\3576#\224f\027C\337-]\024"
+	.string	"\032254`\\6m6m\3768\234\215k\372\227\005;\372\227;\240\235\213z\343{\"\2206\335\205N\211l\225z\254\017a\266\377\366\\\275\374k\314$*n\341\tu\336Q\016\266\327N\315\007#\314\277'\326|\340(\263Z&\246\251\266z\204\202\234y\b>U~\207\237{\205\177\330a\306\243\355\331\3759[\315\354\316\210\350\212\304I\250l?7l\261\004<\3330\221\256\312\344\246gA\260\370\346\370\030\222:\217\214vx\007D\251t\3774\302\233\r\026z\202\360\234\216c\256\360\252\201\315\261\\E\263\203\374\311\212\3130o\222\345\220b\337U\003\313\314)b\0069\317\333\306\217\004\345u\270\360uSG\202\362\252p1\364\260\234v\214\334V\362\320\243TF\301\374[\\\317\217;\037\022\362\266}\262\215a\231E\331\036\2412\343\275C\367~>\302\357F\332$\314;\225\253\020\033\227\234\200\354\277\205"
+	.ascii	"\335\221\334x\271\237\0375cRG\022\233\217w\013uHI\356\024n0x"
+	.ascii	"4\364\241\317\205\005e\356\340C\351#\034\004\226\216\215\323"
+	.ascii	"\261\217<\276\222M\363.\203\370gr\377V\371\304\242\207\320\347"
+	.ascii	"\003\201l\265\305\213\260D\022B\213\203/\233\272rE3Y\360\013"
+	.ascii	"D\271\204\355q$"
+	.string	"\353d%;\021\271\223#\b\254\001\253i\251\264\025*T\203Np0Z+*S\307;\266\213;\350\347r\201G\260\b\300'\334\177g\210;3#\300\336\232`\263\333N\361\364e\336\316t\352\333\202\333\275\222\304m\251\347\231L0\275\223\204\211\333\f\024\004\327i\233\021W\210\257|\316\221\362\211[<\256\3769B\352pX\310\302y)@\202\013\236d\020\346r|\332\373\373C\353>\203H\242\016\304\315u\274\233J(\301\307Q\2220\013\n,i\301\224\303d\276\333\020b#\357K\344\353\330O\002\331{\f@6\2446+\256\241\027\353\303\201\217\340G\240\235\205?\243\346\347\330\244\310\316\366\363\033\342\345F\022N\344(0\f\2572gM\275\212\326o\203\024D\t\n\274b\034s\0375$\003\332\347\306\013\317\034\321\001\031\006\335\036H/\023\245\252\272\374\236\331\255!\344\b\241-I\013T\217\215\032\005\335 \013\266"
+	.string	"\361\033 \306VY\223\307>\313W\240\370\331Nw\330J\nX\362"
+	.string	"D\2150 E\022\033\271\216\360\305\343(\236t\304p\n\020\255\025L\227\344Ef\365T\260\033\322\330P\021\355\373\002f\212r?\240\252e\202\3254\312Nr\3214\360\321\001\356\317H\337\212+*j\316\230\02231\222~~X\033\345\3503Ha\216Z\223\244\311\330jUiy;\346\373>\212\260\310\244\020\235\005UEz\\O\006\372\301W\342"
+	.ascii	"\205\267\360U\003(\220\220\031\240\227\316\247\232\2430\222c"
+	.ascii	"\t\006\034JU\003\272\270\007\020\234w\252\013"
+	.ascii	"V\026a\365\233\267qW\277\032\0233I\304\376L\304\327\244I\332"
+	.ascii	"5\373\020\326\364\252z\254\212ut'r:\343\021H\013"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.77.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`p\005}\034"
+	.string	"V\362\253H\260\226Q:\025\\\317\t\347l`\254\361\n\222O8\364\307\031\316\377\222s\306\343\232#u\251/)\375\324\376\255\366g\202\264\260\301\212+Z\365\202v\241&\345\315\037/y3G\216\237\374\263?\304\266h\367\266\021B\244L)\212"
+	.string	"\213"
+	.string	"\241"
+	.ascii	"\256\271\232\346\352\231\253e\256\226\255:F\325\261\253aW\303"
+	.ascii	"\\\375\272\332uuk\325\245\252\311\253\307\253\367j\275\372\001"
+	.ascii	"pTPQ \316\231\242\350eN\221M5l\037\346\235=\345J\303\331\232"
+	.ascii	"1\0042i\231s\3466\306wo\225\344\270\272\363[\b^Aa\321[,^\302"
+	.ascii	"\bY\234\224\t\177#\317\234\363\204\216F\337\261\207\312E\024"
+	.ascii	"\231\3207\346 E\031\035\307\025\205\260\247\332B0\347\264\006"
+	.ascii	"\205+n\327m\227\260\355c\223=\002Y2:\256\r\244\241|\220\\\036"
+	.ascii	"\037\361)\220\214\314\351\231oN\036\200\335q\267\311\357FO\213"
+	.ascii	"\216\351W\327\016\362P>\270\313sb\213\006\234\211\207.\267\244"
+	.ascii	"\373\332abOU\216+\351\016\f\347\234\006t<I\310\247q\322\"\210"
+	.ascii	"\364\301\223>QyRo\247\362\344\267\307\252\211\247E\353\023\024"
+	.ascii	"\223\251]l\245\"]\030\366\3079\347\364\276\260I\365\016\251\306"
+	.ascii	"\221\352\033\251\326\271:g\325\266Q]\033\3258\253\246\251\372"
+	.ascii	"\346\352\331\3256\3276[\263\263\375\017\251\367&wb\242O\303\r"
+	.ascii	"<\304C\312\2236\213\263:\342i\221fk\266&5\2634;J\375\256x\262"
+	.ascii	"\225\231\241\232\322\345\226\310\354\253I\312D\237a\224\356@"
+	.ascii	"\022\331\372$\211Y\333\301\221\034\201\212m\314\256\024,6\203"
+	.ascii	"\355J\371\335x\255\211\367\001\3042\2450[\303\372\331\260\251"
+	.string	"k\355\007\020\312\007_\255u\255\215\351w%\340EL<\324\220\210\356NU\304\326\036J\006\222r\355\b\027\362C\033\332\022\036d\202\254j\316Y\340\307\201T\260pA\037\274\020\274\342i\321\344\226\273N\300\006\"@B\027\224\033\321\201C\320\207\r9\020A\030t9\240!\242\034\201\232\205Bh\030\312\215\020\022\032\312\301\224\346\307\271/$\b\247x\333k\355d=\313wI%nw\366\300\243.\270/\345m\267\270\216+u\366\266\007\032a\035\313.)\201\002\005\345I\235\245Y\035m\3219g\021\2710\234\263\337\fKJ|\312\345\312\202\234\245\3118\3122\332\254\374\334\252L\230Q\251\255m\177Sq\023%\316\326\220z8\273L\300\254\330\223\225\027\301\242j\261\376)i\233a)\312\247\\\254OKhk38\224'V7K\333\0252\273\tp\250qX\003\tc33\322\244\3260\006\320\002\021\241\261n\021"
+	.string	"\261d\214\rm\355\034#h\375\245l\307\035`\273\273\036\252\315\3755i\325\275\354A_h"
+	.ascii	"\220\372\0174\217\246i\242\215\013\361f\376\t\216\370'\322\313"
+	.ascii	"\301\335t\227\211|\204X\262}\003\327\270\3234\007g\351\320\025"
+	.ascii	"\f\f\233r\271\242\006\272\201\032\333c\031\222\237\354\264\237"
+	.ascii	"\362\207\343:\b'\320k\200\355\350\361\374\205\271\330?\355\n"
+	.ascii	"\016\330\202vy\317sYf>\202\240\257\031\345\220\0010\342@\201"
+	.ascii	"\364\250\214\365\"\007\274\221+\330\b\373`\377-\365oe\215\246"
+	.ascii	"\364\242\b\233\f\335k\324\224\n\020\275\t2\222\274\316\024i\007"
+	.ascii	";d\213\377\211\250\341\267\034\223\304DT\216W\372\2220\370\207"
+	.ascii	"\370\200Ux\307v\321\225)\317Q\003"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.80.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\371\013]<"
+	.string	"\252g\220\026@@\346Q\007!U\255\023\342\307\273\322\033\352*|\260\367/\230\374\347\n\035\361vj"
+	.ascii	"\214\0341\351\362\2519!\213\202{\221E\320g;\245\277?5\220\373"
+	.ascii	"\363\006\234\326d\255\355\335d\357\235dJ\001U\001A\001[\001T"
+	.ascii	"\020\275\240f\0062\235\224\355V:,\376t\257\343\336t\217s\227"
+	.ascii	"\363\036f\235\216\327i\207\266\257\221\376l\257k\344\230\273"
+	.ascii	"\351("
+	.string	",\223\242\314\f\235\216\313i\247k\322\315\351\272\326l\255]\363\006\016\336\215V\316X\2733\212\313\260\333\235c\036\347\310&A\217]\214\326\347\272}]\346n\272C\227*K\340r\316>_\333\337\224u\373|\305~\306\323\270\032_\343m\332\007e\207M;\253<\340\023\t\256\bH\256\231\002/\356@\0376paH\264\276BM\032r\r\221\216\306F\225Y3\003\341\352#\007D\353k\024\217aw\023G\025Z3\263Q\350c\007\027)\347f\320\327\336\320B5\207\216\273\035\316\311 \275L\216vsnrHN\316M\255\276j}\255r'\326W\325\007\260\276v#\273\023y\363-\367\250\034Z\252\211\224s\026\276\224\356~W\233\336*F\372\317\367\272m\217]\325\307\310\366\036\006\"P3\377\265a\337\226\265$\370\235C\202]O\266y\033]3b\265e\355\b\356\025qV\255Z\252Um\224xU\233r\316"
+	.ascii	"\330v\250\f\324\330\316\260\252e\210\277C\035\327\335\245\021"
+	.ascii	"\344\206m\210\343\036\206\234s\3434\266 \336K\336\355\335\335"
+	.ascii	":\272}a\001\376\364*\340'\370\253\307\216\224K\250\236\352\023"
+	.ascii	"<"
+	.string	"\353H\271\305\237\335H8\377s\024F\360g\253\360(\0218(\347\374\300\316\375\254h\257b4\262\276R\275\220\020\335\017\252$\3729g\263\357`\005\250\253^\232$\t\272?}\202[\262\316_\350\221h\306y\355\"\246\233\264\021\206N\r<\237)Bm\030\232\027\235zozU\362\r\374\324\273#e\2263<\355\366<\256\007G{\225\246\341\205=\315\213\365\325\037H\310H\022O\333\311L\023\315\233\224\221\337q\2173\3426X\227\363_\223f\t`\206\207\263\2731\002g\343\020\334\2228\257\237\370D\235\310\330I\031e\234\327\335<\303\017\245\333=\377\223n\027w\227\213\233\313\305\335\200\301\017\267\360\207{K\313\305\235\345\342\016\372p/pq+\300\272\362\2477\320\305\235\300\353x[\271\270\251\274\351=\345e\334\rx\234\267\224\313yG\275\270\241^\334O/\356\002/n\247\0277\201\027\367\200\027\267\200\027w"
+	.string	"\027w\323\213\233\311\305\r\340\305\275\344\342\376\275\270}.\356\327\305\355\276\270[\027w\357\305\315\272\270\327\027\267\352\342\376\307\215[\334\356`\b\267\244-\307\no\370\2148\034\204\223\3533E\371W\377%\004I\211\207\363\321\347\2727\370\224\350j*\375w\021yJ\351\330I=\206\344\257\353\377\316\245>\351\350k\362\210\036'\t\373\332\365\276\246\351\2414r\256\307Q \035\205\217\210Y\216\270^X\225s~\217l\203\377\273,gt|\232\353\r\276\210H@\221\343q\360\360\241\375\003\353k\203\177\"D7\347/\224N4\277\361v\321\030<i#\367\241\264{G\3129\267\377\244_\037<\226N\326\r9K%\322\322\271\372\035\217\302\317\"M\241(\334:\016\266[\304\b\354i\370\273\334\320\336\314\304\234,Q\357r\336\363\021m\334{\340a\353f\316\231UU\3403"
+	.ascii	"\372\027+|\026i\366t\267\3616\220\031<)\036\323t:\275\342_\354"
+	.ascii	"\326\013\265~\353U5\313JL\255\254W\360Z\217\353\224b\202\037"
+	.ascii	"\374\254\207\n\264\340\203\277\006ZVJ\222\360A&,\274=\373\204"
+	.ascii	"\013BA\341\355n\301[\230R&\t\310\273\216e\360\n^\205\303%\272"
+	.ascii	">\224v\013=\326\333`\362\301A\267z5\207\272\313d&\372\253\367"
+	.ascii	":o\0351\343\340\240\003_M\313\255^C!4,)\257\t\020\343\274\266"
+	.ascii	"j\fIU\305z\257\223\345V\217\365~U$I\364\352\003c`5\212\252W\213"
+	.ascii	"#\031\230\214\257b\b\243\261\370\023\013\023\023\333PVD"
+	.string	"QV\024\363\031\215\031\276\212!\312\212(\274\306\216l\211\"\031\f\257\026l\027\207\\F\026\016X8\330b\0323\341\025\003\254\004\231\f/1\261\243q\251\215[\307\030`B\262\027_`0\\\be\200\025c\b\215bc\302-\250\016\233\341%&$\013\013\023\023\372\232I\367\334c\351\364I\227\316\326\357\270\324\253\245\350c\227\374\263\016\342\251\357FRAZA\323\203\205\273\221Z\220\\\252\316\336\254\245\354D\023`\267\343AW\237\375\366\335\367\375\3223}\323\013x\002_\340\241\276\033\t\006\311\304\236\326j\236\362f\312$\212\360<=\324\273r\313\324?\275+\361\234\276\200\223vf5A\222\241b\342\364>\345\200'\260\244\235\356T\202$\343rm\003\276\353\316)\245s\372\017J>\334r_\230N\037\241\345\234D\020\340\005l9;\322N\177\204\034\203\215 \3118\"L\004\027A\232\311\240\001{\232\006\326\327"
+	.string	"_A\316)\215\372&"
+	.ascii	"\3174\344(\024B\004\006\001\360\276\273'\363\367KkG\217\003B"
+	.ascii	"\204\360\343\367\r\224O\346\373\276\036G\257{S\201\325\210>\367"
+	.ascii	"\206\323\336\037Fy2\245\336}_V\352}\233\205y\034\265\006-\211"
+	.ascii	"\3007e\357}_\326g\2650Z\200\360\250a \005\231c\n\315\210\210"
+	.ascii	"\202$I\322\030\220\"!\262\352\034\021@\255S\310\210\244M*[k\200"
+	.ascii	"\201p>\241Q\264\bv\225\013\023?\002\375u\tDn\233\261\360X+?f"
+	.ascii	"d\350c\227\244[\353\222\027(A{\222\002\3435\241Z3\001\n\367)"
+	.ascii	"\305(g\327\362\366fb\305\356w\256k\2111\361\245\t\r\3245\300"
+	.ascii	"\2460\220qK^L\321\205a\017\262\246K\01631\2742v\321\334\361j"
+	.ascii	"\240\244D\256\013\rO,\022\t\007x \0207\211p)\340\247F\304\234"
+	.ascii	"\252\034S\373\237\366\234\347\262\221I\233\031\225\331\240\237"
+	.ascii	"\244\340\253\317\016Nb;\027\214\271\302kBX\313\374b\243\242\326"
+	.ascii	"4\213"
+	.string	"\001X\001\242\264\340`\345F R\360\031\023\306%\032\334$\317h\3634\363\035\364\254\310\215J\210G\224\210x\b\216\363\323\327\260\"1\3107\202\345\016\021v\004\031\0011\336:\264\034j\027\232-\016\207\234>(\030#\322y\177^\203-\nD\235\263^\025l\221a\177\373\030\034\263\352\0310\210\037\003\211t\330\376#\224^\353\306\213W\317\223\371m\371\241\240\240u\210\251\254xA;\372\346\252\035\314\331?\253\224\306\033\345\203\376<\342\374\267\036\220\356\206\314>\033k\370_C\243\330\201yo\031\326\233u\210\352\324\204\025\251\013\344\202\344X\354\356\005wq\206\240'F\030\317Q]\022\\\271\277\254\303X@j\273\017wP\305\210\307}A}\3618\b\347\273\2760pf\222\302\246j\311JZ4\220\036Q\203\020\257M\337\243+f$f\325%\033\23143\0325\3641\320B\232\031p\216\262>-\264\220\374\327\317"
+	.ascii	"2@`]\241\257\323L\316\324\371\371\236\262@w>\242\335b\231%l\f"
+	.ascii	"!\335\334\027\013\324\374\242\r\025"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.81.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\335\001-\020"
+	.string	"\366\234iG\320TQ:0)\001\312|t\313\315j\211\322\204\037#\210\315VY-\230\033(\302\227\301!9#\215\306\257\253\340\376W\272\362UE?\324@\277\261\324#\270\227\017\235\215\371\2126\310Hd\030.\321\n\214\2777\3312\245T"
+	.string	"P"
+	.string	"T"
+	.ascii	"\227\335\003\314K\307l\"\277\325\366@-:\370 \331]/\236x\354S"
+	.ascii	"vQc>I\306\300\020\"0\224}\312\027!?\300P\304\273NA\221 \243\025"
+	.ascii	"\035\025`)\244iT\t9t\246\335\375\213\253\2070G\225$\263\273V"
+	.string	"0\374p\223n\333\202\355\007\266\036\b\207M;\203\006=\370\310`\004-\312\254\270#>V\227\3307\231\306\022\366\273\335]\307\035\373\266\177\252ZU\375\022\001\020=h\210vurG[$\205V\330~\311f1\021s\265\357\342<\261\3336\370d\227\304\017\216\335\233\213\023\230\\\232\2762\003F\235\306\247R\273\374)P32\323\234\007\034E\024=3v\310\024\235\321\236Y\351A\233PpI<\304\303\242\326\275\347\032od\323\\\006\216\311\3566\360c\334\207\345\247\270t\313F\3726\363R#\002 \266\231\346\256\273+\213\306\231\217)\030Ah\252\304S5F\305\274|)\230\024\314\t\300M\004\025k\005\341U\243r\271`_\212\277\023\214\265\362^\025fV\027(x5+\024\313\373\\7\336\211\305-\f*\227\367j\265\\^\351\266\3576\356XB\210\242Y\314\231-\017\372P\016!\275uL\036\241\313o\330"
+	.ascii	"B\301\345Zn{\301kL\020P\333]\007\016( \260\202\231)\255\003\204"
+	.ascii	"\"PD\350\025\031\030\023\214P\366Z\331x\337\232\361\315\301\020"
+	.ascii	"\344\0036\241\033\313\307\025\364cp\267\233EVVC\312BV\001\333"
+	.ascii	"\334\217M\242\006W\331\231\034\341\3605p\203\036\023+\325\226"
+	.ascii	"0\307\266\256\321\242\227\030\217 0\027\310\004|\375K\326\331"
+	.ascii	"\204U\006"
+	.text
+	.section	.gnu.lto_getCosTiltAngle.82.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\275\007"
+	.string	"\002\01646Po\322\001\200\362U\200\226\001\243\256\322t\206\002\241\306\202\213^\021\232\026\207\342\326$\237=\233\031\232\205\220\263ff\346(\363\320J\267\215\316\203\343\021\331[\312\224\002\336h>\035,z\030\0260\216Bl\300\020:q\243=D\315\2003\207\004-z\262L\213V\267\177\253\244\324\214H%\034\342\323\225\342q\220\217@iw\r\272\177@\370\246CG\200\362\334\241\017\272K\252\303\324K\005%\312\224\255\213M\030\273\013\245b\330\177\253$\373\351T\002\013\024N\313.E*fO J\303\366f[\376\30696\373\364\272\222\351,$\023\"/\273\0333\277\252\303\367\200\352P3\276=7\377\035\177&+.\334(\364\0048\330]'7\252\270\365\005\266G\002\016"
+	.ascii	"2\241\233\037\270b\202\2219\032\023\341\305\201\330\f\206J\030"
+	.ascii	"\256\211\270!p\314\330\304]\221f\303\273\356\r"
+	.text
+	.section	.gnu.lto_calculateThrottleAngleCorrection.83.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\203\002U\025"
+	.string	"\346h\215I\300\360*\035\372\017%\275\205\304\241\367\006`2m{q!\005\377YG\301f.\274\353\204\205`"
+	.string	"\271\242\324\260\275\232_~>\221t\217\325\032\357\3136\277)\314\332l\326\036#B!|\304\202\023&\210\256h[#\204H\231Rz"
+	.string	"l"
+	.string	"z"
+	.ascii	"\017r\022\252g\203\032\362q\021c\316y\340\244\031\240N\302\306"
+	.ascii	"\207\224#2RV\355\222\223\335\201$x\347\304iAbN!\002\033@\235"
+	.ascii	"\264\355\1778\210\235y*\344\261)}L\320\b\325\230s\306>.R\236"
+	.ascii	"\324\207\224'W\303y\037Wy~\357c\002\0304\2027\025\276#\001\235"
+	.ascii	"\0136Z7\277\021Fd\242\371\360Zs\003T=\241\3149\255\301\033\n"
+	.ascii	"7y\333\013l7\260\225\030\027\201\363{N\032&F\037<\351\3078\251"
+	.ascii	"<\371}m@\362i\321\037^E,\221b*\016[\330\323\335\261?\316\325"
+	.ascii	"\261\255~\035\350\007y\320\355\262\272E\252=F5kT\257F\265jT\247"
+	.ascii	"F5j\325'R]\216jrT\217\243zW\255\243\372\"\003N\240\270)\3159"
+	.ascii	"\241\230c2\221H\034\036\364\333;\177\350\325H1E\370\020\2733"
+	.ascii	"1@\366\264WA"
+	.string	"\263cI\027\345\004t\255\356\205f\232\224h\302\265\017:\314\2478\\\256k_D\263\343C\311\265e\263\362\301ra\343\356\222\373\231\237\237\026\355\027\335\310G~\217i6\322\007m\264/\026\026X\372\265k.\345\203\2730\030\200\333\263\022\225~#\247H\264\273\343\243\317@\221\201iZA\261\330\004\234\323W\340\2732\\\002\352\r\217\360\321\213G\350D\267\326\212\2414\033\313\213\214\264\354\244d\266b\262bB\002\200&c\223EPy\301\325t3Z.\207\233\251\320l:\035.\327\242\023\340\031\211\314\255\026\323\265\260\324l\017b/5\331-6\313\305\304H\002\030\007\201\226\213\351p\270\\l%\234_\035\303,\301\030>\225\263\204\243>\257lm\215\355\326\032\305\267\277\321c_{\226\307jQ\313\332\253\230\371\371\251jm\007.\372\340\312C\207\246\371\"\265*\335\324\222:N\213\332\007. @\002B\fsy"
+	.ascii	"I\"]\003\376\030\240a\354j\305\r\233\372\0300O\f\321;\230\203"
+	.ascii	"\252\003\026\t/?1\026\225\024sLu\340\017\025C^\373\221\211\243"
+	.ascii	"a<\306\001l\320\253\303\342U\032X\347\273x\252%.\255v\250\312"
+	.ascii	"\251\361>\210 3\037\207U6\n\211\0020\203\241`\2573\207A\220\342"
+	.ascii	"\034\t\211\223\313\307\235\215\350:\362\352\320\264a\017"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\337\003=\021"
+	.string	"\006\032dH\320TQ:\bl0}\373\002u\001\347\261\226@c\347\034\220 \034\302\217\013S\302+/xTwZ\333Z\017\032\237\007y\2421\030\315\f\274Ai\3046\fF\020\350\377\022\376\342\236>\241\t\327\304E\"!\333v\223[\246O"
+	.string	"S"
+	.string	"O"
+	.string	"r\345;^}\037\327\215\264VX,\362\264OF\245_\343du!\325\207\244\\H\352A\020\264|\350\207\211\320\201>\215\210\352\317\210(1'\027\0030\005`\222\377\255\324\364\"\377\223h\255FW\374\375\3330\261#J)=\351\303\210\377GA\001\022h\344o3\263\0011\273\321\271\311\351\020\033\361}k\211\b\177!!\364s<\350\343\250\351\377D\007}\031\261A\213A?F\\\340\222\nf\344\377X\243,h\372=1\301\177\314\334\207\314{\310\215\351\337\210\247\301\260\344i\260\357E\305\345HZ^,?\022\274\225\343\330\202\347\223c\n05y\225\324E9\261\244I\312\344\265\311\252\027\246&\013"
+	.string	"\027\266C4\244\232\314\241\017\264\241\257CC\237G\206~\022\f\375\360B\377f\241_\244B\037\b\205>\221\245\224\376\004\212&\364\203\366'\2213\323\t\021\013/\201"
+	.string	"B\025\212Iu\205Z\"\024E>\037\212\367\266\007r\241b\307;qM\353\304\223\347&^\320ez\231\030\247\363\030\307\306y,\273\355N\217\007\324\335\226\3072PD\030\013c\340\007V\307\036:.\331H\035\007(\2013\234\365\343x{V\\R\250!\fO\202m\226\226\244P\030\326"
+	.ascii	"\003\251\031\267\001\021\240\024\006\216M$\241H0\243\035\331"
+	.ascii	"\204}j\271>\023\256\005_\220[\252\267\271g\372\243\363b+P\321"
+	.ascii	"^\f\222g\300\316\267B\f\314\241<\241\033\256\265V\303\027g\343"
+	.ascii	"\321x[x?\365\230\302e\310-2\245\246\"\316\237\363\034Jb\266N"
+	.ascii	"\235\327p\r\265m\004\254B(n8\261\260\025`\364\\\230\250\305\262"
+	.ascii	"\006\320\233\t\236Y\200\311-x7Ll\357\367iq!&\314\227\013\233"
+	.ascii	"\343@\212\247\n"
+	.text
+	.section	.gnu.lto_.refs.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\220\001\275\r"
+	.string	"\206`\\@"
+	.string	"q\233t\230"
+	.string	"\210\316v>b\305\007B\311\034\237;3\177[S\241"
+	.string	"U\257Y\373\273\252\252\252\252\252\252\252*L\334\213mV3r\204>\023}\331\377\233\275~\372\3766|\264M\261\267Y\"SF"
+	.string	"M"
+	.string	"L"
+	.string	"\327B\365\225"
+	.ascii	"\277\021 \344\367\201\214\024\027\243\023\021\"\016\371\033\240"
+	.ascii	"?\371\236|N\276&?\313\307\362\253\374"
+	.string	"\314\1779U\275(\373\032\2623\310\236 \373\201\354\"\331C\262\207\262{d\277\246\267\244\247\336\277\376\345\237\203_\3053\235\rd=$\373\002Y\017e\377\201y\320\325\271\253oX\274\272\225\017\257.]\260\037\211\324_\205\327\037\205\3667a\352\257\201\364\255\361\2764\372\2351}SX\240\234X\276&\242\016\033J*\275\031*_\fV\357\005\353KR5\203\370\300\375\0368\356G\270_\300}(\376\026\037\363\364\212\347\016\346cp\37208\377\213\255\337b\373W\250H\261\371O\224\030\205\200\277\211\326\027i\177\t\374\221MW\260y\004\034/\022\237\200\346A4\375\243\371\216\3455\370Y\374K\f\017x\335\013\275\251\216A\336G\277\304^\211\275\212}\212{L[[\207\234Ni}\322\372\323\n\312-\002:\214Oa\372\203\007\230\356:\372\206\243g`\317\272\307`\277\272\267\300\016\273\247`\177\335\037\353QP\230"
+	.ascii	"\360\217H\214\210\037! \020\2431\323\0069\201i\3328B\214\022"
+	.ascii	"7\242\340\204\231Q\200\301N\300!\210\033\245\302\361\036\221"
+	.ascii	"!U\273)0!\265q5\242*\342\344`\247\020\344\361D\211\023L\2108"
+	.ascii	"\301\204P\\ \246\254A3\003"
+	.text
+	.section	.gnu.lto_.decls.5e339cd4643bb920,"e",@progbits
+	.string	"(\265/\375`\325:}\013\001\312\245\211]U \nY:\035\301\303\3625\201A\372\231v\016\234\034D\207\024a ZYVx\204z\320\223\007$\263\370\307F\365\275I\305\244e\312D$\005\007\033\035*\004"
+	.ascii	"m\333\252T\325r\306(\177\372|\237c9\222:\304|uo\362\220\241\226"
+	.ascii	"\274\210T$\333[\312$S%\005\305\005\366\005x:\275\034V\317R\264"
+	.ascii	"g7\275#\366E\374\307>l\377\030\006W{7\177L\207\314\336M\235{"
+	.ascii	"-\270\327\202,\226\305\225d\315\236\225h\317e?\344\332}\021\223"
+	.ascii	"\304%$\343\320A|t\\\320@\342\374\354\031J\373\b\034\277\003\233"
+	.ascii	"=\351$ZS\256\007r\241\337\365<\276\353\267\376G\216\321sC\345"
+	.ascii	"\344pZ\225\341$\001\034#\265\346\036\357Cg\311\007\322V\\\017"
+	.ascii	"7\355\270\310\353\370(5\036I\\\372sx>\273\302\301M)*Q\035\332"
+	.ascii	"1\f\275\341\362\254X\004\206\322\353\276=\353W=\215\013\355\360"
+	.ascii	"5h\356\272\320\200~v\354\324~;\254:\035V\377?=\343e\374\215\033"
+	.ascii	"\231#\251\317/\3651.\324\241\374\224\323\030=w\332\016)\314\035"
+	.ascii	"zZ\205\231\353PV\377:\355tQ\377P\357\302?\352\237n\214>*\357"
+	.ascii	"\335\274\327\202\234{-P\241\370h\242\255\331_N\373\237i\227~"
+	.ascii	"\323/\331$\351\352\262\344\363%\363G9\315\235\275\177D\245L\257"
+	.ascii	"t\241\277\264\364\316O\272t:\262\330ZN\002\230\005\267~\3223"
+	.ascii	"\357L\324\023\263&e\332\357\3347\333\272\036\351\215.\364\212"
+	.ascii	"\271c\374\331n\231g\346\250{_-\351\372\243/z\346\245\323\301"
+	.ascii	"A\0236\037\017\036\222eZct\366\017\323\376^\372\006\336\351\205"
+	.ascii	"b\370\2556\237\373y\375t\024A}\366\337\322\"\330\373bX\357tz"
+	.ascii	"1\254\3769\264\377\225\026q{\326\325o\030\r:O\251\246\033\200"
+	.ascii	"`f`\310`[\373\354\345v\271_\256\337\375\273\320\013\346\366\215"
+	.ascii	"\361\005Rq\007\362\013\346V\271[\360\263K+\3319\245R2R=0w\357"
+	.ascii	"^\271tS\r\020\233J/\033\230\313\305\243\227\016z\273\206\224"
+	.ascii	"\221zx\263\264\244\250\233\354\337\244\375\217\264\337\251\366"
+	.ascii	"+\325~\257h\207\336\2365\317g\245A\367\034\022E\373\b\272{%\007"
+	.ascii	"\357]\203J\327\336\317,W\313\205^\274\213\305/\331\235\363\373"
+	.ascii	"\334\373I\342\002\022\027\357\336\335+9\314\347n\261\301\334"
+	.ascii	"\222\030"
+	.string	"\300\275\237\036|<H\240\206W\2145\373-\242\375\372\320\327\312\255\273P\r\327\316/ \341\230y\266\307\366~\352\340\004\206\005\216\321\322~5\254wz5\254~\261\264_)\275\343v{\3268\032#\035\321\262\317p\030\260s\313\353\313g\277J\372\310E\273t\320<d*\225r\247\\\350}\273k\367\355&\271Q\260\331\223\004\262\234R\f\036r\232^\316)k\206\342C\223C\257\257\312g_A\373ek\0233b\211Gsh\366~\013\323\265\367fr\237\\'\027z\233\334h~\372\035s\007r\277J.\333mr\335<\232!i\3577\252\n\254T9\"\005p\357\355\301\203\217\007\235f\226\217\035:\273\005\264\177\240=\002\332M\350\r\267g\315%\264\223\3207?\356\256\323\334$<k\265\233\206\235LWO\0138:\246\317\263\264\373\274h4nZ\242\204|\366\213v\317<\372W{\033\355\275)\370*}5"
+	.string	"?;\335\355Yo.\317\372W\267g-\300\345Y/\031\220\337\262;\306\263>M=7t\357\255\203\335\242\034\221\371\374\317\333\263\352\313\263\216\340\200\235\363\270g\026\276\272\347\020<\001\372\334\257\224[p\3178/\235\352\271\337\036|\3567k\317\375\301\364^\013\007\274\277s\004\270\347\020n\276\353u\367k\343~\325\277\362vuo\305\3359\340\026\270\343\251s\356\251,=\234\373\277\371\001\334q\334\027\024\367\177\342\344\357\233\020\305=\023\031\316\301\3359\220\301\025\340\2365\270\273\233\273;q\367&\356\036\305\335\241\274\233\347\270\343\260%J\367\333\001\341U\212\341~\241\332X\260\271\177\231\022\317\220=\220\304\335\375\334\313C\335\275\213\367=\222#\236\301\r\340\376j\036"
+	.string	"\367\034t\3673\257q\307-\334\257\020\367\353\345~\277\334o\020\367{\347\356x\356\236\347\3564\356y\207\373\267\356\237\202\373\253\340\376K\367_\341\376\0370s\177\023\334_\351\376'<\335\035\307=\207q\2774\356\377\356W\273;v\3173\356o\304\375\213\270\177\230\373\013q\377.\367\327r\377(\367_r\377$\367?r\177\020\270?\t\356\337\201\373?\300\375\031\340\376\013p\177\005\270?\t\367\037\341\376@\356\037\302\375?\270\377\001\334\237\203\373\027\300\3757\270\177\005\356\037"
+	.ascii	"\367\307\340\376=\356\317\343\376;\356\237\343\3765\356\257\335"
+	.ascii	"_u\177\354~\247\356\267\214\373\035\343~\301\270\337.\356\227"
+	.ascii	"\213\373\335s\277r\356\027\212\373u\342~\335\334o\233\373M\342"
+	.ascii	"~\221\270_3\367k\304\375\222\271\337\"\356N\202\373\305\340~"
+	.ascii	"}\334\035\316\335\321\334o\230\273\333\271\337\016\334o\005\356"
+	.ascii	"\327\202\273S\300\375\022q\277C\334\257\017\367\213\303\375\326"
+	.ascii	"p\2774\334o\225\373\245r\2773\356\215\273\003\272;\2304w\027"
+	.ascii	"\301\335S\270{\234\273\357L\247\323\251\373*u\247\261s\367\340"
+	.ascii	"\027\237\361\026\217\332D\341\225\265\370\214\3634\2220$(\237"
+	.ascii	"\261\026\025\207\221\257\035\2371\236\r\025\033]G\237q\026\232"
+	.ascii	"&zda\237\361\335\265*\253\322\366\031cYa\260E1\372\214\257\\"
+	.ascii	"\300.\314\270\317\330.\004-fe>\343:\217\326`\342\324\365\031"
+	.ascii	"[\361hf\322\203i\3543\246\363h\0263\243\311\3443\256\362Ql\216"
+	.ascii	"'d\036\025\262$,\211\020\255\001\207\024\227\202\345~L\212\345"
+	.ascii	"t\260\264\332\2600\334jG\345J\033\206\303S\252\234\246\350\200"
+	.ascii	"\333M\320\216\302\340\267\273\246\316x\332]\371\35451t\017\222"
+	.ascii	"\037\307P\240\030\312M\003ag\357,\252\256(\335\263\364\203\231"
+	.ascii	"\\\354\304I\r\267\026\332\243\367\215\366n\022@G\213\f\017\306"
+	.ascii	"\347\236\035?x\311\305nnU\230\254~\260\222\213\333\332<\352l"
+	.ascii	"nI=0~0\364\342$P\234\304\243\367i\002\247\254\031\322\375\264"
+	.ascii	"?x\315\221\366\250"
+	.string	"_*`\222\264|\256 \310\017V\303G\034#q\214\344\255\334\251\315\354\303\200\b\024\227\030\340\236z\352\3404O\264\373\273\257\273\371\264\367\216R\237\373\251\350f\275\352\275\035\334q.\276\003p\367\274\267\177\020\341\271\233r=\376\264W\264I\365\033\266;\335\2233\r\213\311\001\026\224\021V\fg\032\326f\032\375`Zx\332XLg\332\336\026\266\221\021\363\304\325\266\340L\333P\233E\035\324\335O,\3466\272\332\026\266\321nnp\032aA9\323\232P\026\234iXP;\rk\357l\243\346S\222\321~\262\260\323\260\372v\332\025\324\2163\355\n\312\231\206\305\343nI\332\002\214\222\322C\313\307\355s\032m\247\246\252\346\323\016\235\363y\265\361\366\276\320\243\3754\200\275\253\256\236\360\2321\256[\021\235S\021[\363\352>\233\212\262\256\266\021\235\363\353j\357\257\242\241\335\204\001\363I\267w\\:\346\215\252\315t\2647"
+	.ascii	"\366s\357\246\275\231w\323\355\275\231{\357\231\247\252\347\336"
+	.ascii	"3v\234]MM{O\3714\355*&\223\243\275\037\232\347\006\345L\313\272"
+	.ascii	"\002br$\255k#=\231\267k\343a=\3514\246\331f\352\242\273\240\\"
+	.ascii	"\370"
+	.string	"a4\035f+\313W\2256[\335\220\352\256\236\264\221\234\033L|\321$M\306\324\314a\364\331i\212t\021\2358\276)\2562\032\207\3354\245\226X\371\354\372\017,j\246H\224,(\221 \331K\213.<\306\\\272)\016\242\360I\367\364\2720\027\016\262'\275s\322G\3332\004\177a!\330\013\003\271P\034\004w=\016r\271<ZN\363\271\237\032\220\267$\306\303\205c\232Jo\262k<\335\301\361\217\0366q[\266"
+	.string	"\301=\260\2169\037x\353Bq\017\314\003\367\300;\336jF\t\023\034b\330i\005\r\310\232]\037\321\256\211h\327?rh\345\374E\343^\234a-|\325\206\003\337\270P\254\205\261\374\311p\226g-lc\037\300\f\313\rlu&\t\341Z\363\335ZI\273.\322>\303E\273c\253\0168a\356\212\300j\314x5\245f\f\032\034\214\234(\031\253\362\373\346\344T\206\013\246r,\225\005L\217\352\263_6,\3650~\206X\025\351\013,\365To\2055\327\205\245\336\006\216b\316(q\013\004\003t\302R\337\342\243V\037;\020,\006\236\201e\340\251\013\305R\330\205\343\027\030\206\217\215\222Ti\257&\317<\001g\216h\f\205SEO\213\0232\355#\246\374\\\023N\372\262O\302O\267\017\262d"
+	.ascii	"\271\375\033\232S\332G\263ZHq\322\203\375\330\021\264\031d8\351"
+	.ascii	"\215<\032~\272i$\264)\234\364_ODI\021\225\024;1\022V\302L\270"
+	.ascii	"\005^\302M\330\t?](Nz&\376/\376\312}\034'}\025|\244\301\321\023"
+	.ascii	"\005\212hHq\322k\275W\324\210\247\230@\260;\325j\232\272\220"
+	.ascii	"1\013\0331\031@\224>\373\f\223\036\363a\324\234n\320\375\025"
+	.ascii	"%,3\376F\340\227\271W\360\263k\006\211\026\225\024H\314sQk\321"
+	.ascii	"5\206\345\271hp\364D\343\204E\206\224,\360\245\037&Gm\312\252"
+	.ascii	"\254\211\213\360\376)f\342\300'\343\217\365Y\356\343\223c\364"
+	.ascii	"\227\026\226\223}\025\243}\315\242}\245\323\276\276\201y\300"
+	.ascii	"/3Uv\030\035\241\201\371/\020P\023\203\345\305\377\213\016\220"
+	.ascii	"7\347\331\347\377\373<Uo\311\231\363\363w\321X3\304\244\237\337"
+	.ascii	"\357^\271lYcd}\370l\314\213\221\317\367\n\025\246\"\260\347\203"
+	.ascii	"\362wg\206\265\247\247\303\207\244\304\313\026\177=\234\2749"
+	.ascii	"\256\256\317\237\345\363\374\304\216\230\345iQ\315\226\206d="
+	.ascii	"q\366\230kx\257\206\201\006+\306\034\334\347\277\253\331\302"
+	.ascii	"%\256\311\275\242f}\321\213\276\250{;++\020\274\035\323\317\276"
+	.ascii	"\036\325\371[Y\223\241#\353\363\205\276\025"
+	.string	"\265\356\353G\222@\355\352\236\334S\211\323>\260T=y\223\213\263\203n\274\317\037\347|k\0363\212\030'/\005\n\031)&\\e:\n\224o\373Jb\373\374P>\352fg\270\021#7\367\342\263{y'9weQ'\237\277INS\335\306\372\f\375&\317\304\335\367\027\2742E\204hW\2734\006\025J\013I\354s\333\037y\266K7\265\263\215\226\274-\271\320o{\265\217j\323\201%g\277\320g\373$>\317\275\241l\217\344\327.\335\324sG\315\254I\363\242\370x\310C\232\306\356rv\025I\373\205\372\336C\235/o\311I\221}v\265\251=\217\321\236\301h\317[\264\347,\372\237ov\241\034\376\354\267\312\254\241\315i\277\034\326ld\356d\252\221\273\363,\262\343\352R\2456\364\264\312\\5ra\354\3218b\346t\375\365`\356\320\024\f)RD\356(P3\315^|\325\320\024\\\021!\242\206]"
+	.ascii	"\322W\344\r\213%\335Y\251`\256\206\341xQ\243+\223@JO\300\"H\020"
+	.ascii	"U\310\232\265\243FJ\217*]_\256\ny\031o$\004j\357\263\352\325"
+	.ascii	"\342\351'\225\341Z\276l 9\365\004W9\\\355\312\241\036e\215\004"
+	.ascii	"H\207\344\263\312\325C\375\241\372Pw\250[*\217\f\336tH\320\324"
+	.ascii	"\023\264\275p\025\353\205\252\265a\357\243\247\031&[G\224\033"
+	.ascii	"\256jEm\340\311\310\361Y\315\362\250/1\303\333\262\201c\305\364"
+	.ascii	"\"\362Y\235\241Z\251WYb\232Me\264\253"
+	.string	"5\270\030\371\201\367Y\245\241\217,H9\344\245$\200i\237]\245\201S\025\344\206\326g\225\n\310\325*UF\234\215\255\3176\227gU\245\324)U\206UU\324\221*\332\325\030aC\276\250tbPq\2217v\235\254M\346\237\325g\025\206\253\314($.\267\242\026Y,\334\336\364\004C\324&W\237\324&5\352z\361\373\261\202\023\302a%\007\345j\224\334:Us\303j\241:1\321\023\374--\251G\327.\356(P\003g?\374\216\350\t\360T\247\352T\223\356\331n\261\"i\262\025\244\203\315T\334X\0245\351\255\362\210\320q}v\013X\232\002\245\237@W\215\002\325\243\227\336\347\236\272b\366i\340DL\216'\200\333Y\325A\335\202+\203\241\262p\365\310\243H\362\2548Q\233\256\026e\301\022w\226\247\325\355*\223\312\305\226/,Sw\232\033\035rs~U\264\357L\321=\200Q<\323]h\216\222\311"
+	.string	"\025\355&\017\021^}\371/\007\324\363\363\230\247\321\f\223\217%2l\332G\334e\274!Z\256|\337\330\026i]\266\323\223z\311\2009L\376\222\305\\h\006\223\265\370\337\310V\334g.\203\311X\036m,\217,\203\311y\331\017\020\307\006\322\232\325M\256\363\275\fEN\020\312\370\262_\336\222\373\242l\332\374\262jt\311\177\027\232\375\334\003\006\2341Z"
+	.string	"\313\326\276,\275qS\242B\372\234\271\334\264\270\245\033T{\027\232\371\220\202\224\371\3619\353\371^\022Si\311\241\300`R\204\312g\337\231\322\276\023\245}\207E\316\242\261HiL\265\353\214\321\256\363E\273\016\237v\317v\337\227\006\3677\227\247\177S\311Ut\304\334p(\241"
+	.ascii	"\217*J>g\271\217\343\352j\212\313lx?\326\314\340\224L\377d|\316"
+	.ascii	"S\364\221\216\034\207\032\032K\254\250>{\236\342\236\325\362"
+	.ascii	"\333\n\3232`>;\336\355Y\257\031\220g)6sQ\244F\326tO`\232g'i\371"
+	.ascii	"I\207\251&\026\002\204@U}\2501\242\205\351\344\363S\247\211\271"
+	.ascii	"\346\343s\216f&\271\211\023&\273*3\355\331\255FG\235\017!\237"
+	.ascii	"?\267y^\342N33\366d\2646\246=+\311le\344\234$}v\235/\3559\311"
+	.ascii	"\b\266\330\b\373\234\327\364\221\216\026\007\232\274\263\275"
+	.ascii	"\274\346\236\221d\350\217u\200\211j\212\313g\227\336\2365\347"
+	.ascii	"\362\254Y\r\310\363\221\347\202\306\305}\306\321Y\322\024\324"
+	.ascii	"\345g~\346\263#>\246H\327\036W\220\350\231y>{f\327\235\013\033"
+	.ascii	"y\332\207\211\214,\227\321\354\261\025a\343\342\302sY\224fj\353"
+	.ascii	"\tN\373\310(R$\337\270R\240\270\304\300t\276\272d\235A\265\006"
+	.ascii	"\270\260\260-\032\036bcT\272\364\205\266\037\317D\210x\224\003"
+	.ascii	"\350\005b\347\2441\202%\213\217\033Z\003]\026\222\2058@\215J"
+	.ascii	":\003\225U\004\356\263\347T\351\013O~<{e/\245\234$\335\203\345"
+	.ascii	"\3073\020h\006\202\317v\224\366}\252\313\262\222\336h\002\001"
+	.ascii	"\324\032\356\262\217\354#s\3710aNu\320Lvzp\371\207g.L\205\207"
+	.ascii	"W\032\232\021\257)\034[\364\205\036?\236\267\266\360s\017\n\207"
+	.ascii	"\030\315\235\025\027\276;\315\263\367\343y\207\357\300e\331H"
+	.ascii	"\t\023\313-\360\350I\216:\355\303\366\343\031\207V\316\361V\232"
+	.ascii	"\371\244\225l\361I\367\323\363\203\343\260i\307"
+	.string	"\371\322>^XX\371\006\t2\263\254\013\3157r\306\240H\303\210\005\241\360"
+	.string	"\224\322\027\216\\]9\224\274\263\215xLW\034ZS%\237\035GI_0\362\223\253n\256Q\343\255@8\361\025(\335Oo\037f\240sQ_\336j\275"
+	.string	"\366\343\231*S\375\f\016\2409\b\031\351\215\335\222V\026@\255\201\305O\226\272yJ\206G5\363i\002%59=\3557sU~<\303\3100\226\244Rt\0061?\037n\216\312-\262\213\227\321\214\022\021\007\344\206M\373\215\021m\301\371\343\371\311/4?\3411\016\246\3166s\246\255k\352\303\275\302r\344\256\210\316\200%3e\246\354\024\227\233<;e;#wxVs-\310\210\301\322j\331\217g\245\254t\257p0u\305\364\333"
+	.string	"\304\206\212\365\005L\330g\277\211\241/\344\375\344\243\233\235\331\351\321\274\263\227\212\230\272n\234\027\274\374d\243\213\257\256\220\320\234\244M~n\330\315L\277\320\314\314E\035\366\216j\200\027\223\251\0175]\330\270\366\347\334\254\211*\231\202\362\323n\243EcX2\235\222\020\302\264y\242U\347\217\3432P\\\346^\311\314\263\335\242\006\311\254\310\033\340\336o\0370\f73\033\035:"
+	.string	"H?\030\360b1c\304Ti\267q\"\363\203\377.\376\002\306\243\033\226\270\3314\265\327\374\001\240\357\007K/\366\343\303]<\2327t\2638\353\020\246\017O{\r\334\376q\314\005\212\271\3404\354\334\333\005\002\274\230\\b\200k\032\203\224\2719\274\247\367\336+lp\211\201\3519\336k\221\227d-I\026\303\212\241\266(dA@\212\240$\366\264\311\023R\240p$\316\b=\030\241e?X\032\211\023(\217D\341\007\255R\350\001\253,\241\025\"\213*\324\366(4a\002E\222m\213D\017\224J\341\b) '\260\201\341\260D\207"
+	.string	"(\217Bb\220\020\005\222\004%\313&\205\330\240\035%rX3\263\242HD$\304Q\241D\016\205j\366\241\341Q\2304\341Hl\221\307\233 #Q\271\201M\n\213C6h\003\221\021\271\243\342\202\243\260\025\256*\332#1Y\\U@&\211\210\204\301#QY\343C \210\305\"\321\270\026\213\302\241\262%\232\020by\024J\200\n\313#\261\230"
+	.string	"\f2\bf\240\201\n!\330\240eqx$\206H*\227!B\244\200<\316\250\020\262\305\334*\217\310\241\252\242M\236\240T[\037\002A\264D&\205\202I\266e\215\302\244\220(D\001\206\307\245\315Q\305\253\312\340M\033<\n\021\251G!\"\314\256@Tf\245\222M\006\005\tg\222-\021v\234\025\311\240\004A\354L\020\253\\f\345\214\013[aPP\210\bDN\220\310\310\222 D\204!\231D\232 a\270\241-\022IP\"M\264\254\220\216\005\3432E\313*Y\n\212\354\005\226F\342\f[\024\016S\260\305\266E&\207Z\t\214l\253\\\221\"\230\\\336d!\241\021\367\220"
+	.string	"Q\202\b!(\227H\"\n\214\304V\031\201\343\022i\302\270La\\\246`\215D\022\214\313\0246\"@(\203+\f\207B\234\341P\030\034\252Xk\200@\264\254R\205\n\344\006\206C\341\315p(\304l+,.\207E!\333\n[e\315\006\224H\0239m\260\207\rZ\266\304\266\025je\211$[\\F`i$\016\203\311\020C\001(\205\204E\017\204\216DcRh\263\302\005 VX1\002\304\n\033\f@\250\320\201\007EaR\210m\217D\234\235e\n\024 \224XqD\016\tEX\032\211<CmR\030\001$\t+\202\220\035\\\300\230D\252P\036\205I\022\226F\242\206V(B2\2138\341G\234\360\027\234\360@'\274\017U &[\241\b-\022\005\333.\211\214>>$&\331#+\244\035\203\f\022\220\201\006*\314\270\006\033\210\330@\304\352\032l"
+	.string	"\004\264A\006@\3323"
+	.string	"\302m\333\266\255\262\004\255\f\032\2116>\004B\031\\Y#\261%B\"'\320\262BIa\233\243\302\304\211\022Z)$2\"\207\312\240\220\320\250\2328QBHh\\\217\304\342\220=1$\266\354QHh\344\361!\020l\221\035\200Rm}\b\204\2066\003\026\224A\t\326\231\243\007) \213\312\232$\333*\211B,\n\f,\211\214=G\017\330\226\230La\205\nb\222E\001'\331\216\200bId\3049z\320\262J69#L.\227D\306\235\226x\f\241%\036\2119\331\2160<.=\b\022\262(\206\303\022\027\224A\024\330\023AB6\231}\bD\006e\220H\224\"\310\246\rV \204|$\216pT\016W\"\221\022\267AvHD\201=\241\\\232`\243\\\232\200?"
+	.ascii	"ZS\020\2420q\242\304\232\024\016\r3\033\2044qD\022\225D\024\330"
+	.ascii	"\344\r\033\024\006s\216B\304b\211\341P\250[\037\002\261$2\006"
+	.string	"\221\311\025B\303\2410\2042\311\242@L\006Y\300\006Q\210 !\"\203%\221\221gYD*\331d\2152x\201\r\246X\022\031m\222H\345\221U\256mq\251dQ\034\221\304v\310\266\354\211%\221Q\002\024\330 \254\213B\024\222l{\fA\350H,\022\031\205<m\360\202\021C-\022iL1\034\ni\212Hd\007A\225\035\036+\320*\205\354\004\332\022Al+\f\"*\241\310\016\207%\224D\f)\b\223\270XD&\363\320\260%\022\251m0\003\240\366H\234IA\270\002+\331eQ\210\302\252\f\n\021U\034\221&X#\261=.Q,\215D\t\210D\036\b\032\207AkQ8\fb\215I\341q\031\034\016\2059lQ\350(\f\026\213B\243\322\246\365!\237\025\2562\210\323\0065h\217\304\345\314\n\025>\350(4!H\310\236\030\016\20566*\330\240`\253\343C \224C\255\320\030\342\2104\032\221C"
+	.string	"8\222\210M\206h\221\310d\b\233\r\320d\340j\340^\340&\221\355\220E!H\244\"\270\264q!\211\013\206&``\002\006 t|\001\0130\261\241\004\n|\240\207 \226Fb\210vH\210XT\021\342H\024\032C\f\223\312\020 ((q\375n\254\201~jL\324\276\354\224\323\364\302\224Q\245{eMU]\270<K\200\222E\341\303eqiH`\277\027\206w\245\305\364Y\315\303#\230N\247S5\357U=u\213\253y\2563\203\007\346l\256\031\003\026\236\252E\305S\337@`\206\361$\321\030`\334\251Y\324;\365\215f?\001\025\351\343\371\302\222\213<"
+	.ascii	"\3428\213\322DA\272Be\247\345\325\004\233~V\351T+\256\326\271"
+	.ascii	"Z\367j\035\236NW\262+H\326*I:I5\370\306D\377O\013\327\216\317"
+	.ascii	"\031\332\344T*rJ+\\b`<=t\006!pj\234\n\227\313~_!A\002&\345\201"
+	.ascii	"\2413\230IQ\247HQ\337Dxy\003\342\225\305\364\331yXDQ\205\214"
+	.ascii	"eY\362\364\374B\002v\367D\215\2329\002\270$\312\311\313x.'./"
+	.ascii	"M\260\034\025\233\0132\237=\252\272\231u\355\275wn\362\376\332"
+	.ascii	"\240\323\350[\3515>\272\245%x\214F\306\221\030D\332\216j\326"
+	.ascii	"\246}z*\233j\344\215\017\360s\005SIT%I\324#\315\334\233\271\263"
+	.ascii	"\213\354\370\272$\210\362\034k\321b\353\n\232\2263\r$\023\344"
+	.ascii	"\363\323\306\255\306\332\213\317\032\002U4\365\210\212\246\252"
+	.ascii	"\335\375\244\201\021 /:\270\253i\256\252Em\246L\211\372\220@"
+	.ascii	"L\273\253g\370\314\017K\035\240\331\223\353G\304\252\371\231"
+	.ascii	"\202"
+	.string	"\204\322\250\323\362\322\211d4&1\311\230QH\212H\023\245\003S\024@0PT*\232Q\206M\037\023@\024j\304i\032f\035\252\032!I\222\326\375\346\bx\307B\035$&\312]+$\316\244\217@\264c\tk\320zXqx\204)"
+	.string	"\3023\315\3506@0J\234;\264\207\266\326\275\026\3222T\270\243\210\341\t\322m\266"
+	.ascii	"W\371\260f\025v\336E\272;\351`"
+	.string	"\245\253\f\246\376\037P\274\2065\205\262\305\3308\026\277\024\203+\2171M\337\316\354\214\307\2360[\346P\311\326\3327E\272wHj0\250c\353\324;d\004\221m\007V\034`/\233\217\227o\211\250c/\331\320\307ZA\217Ny\323\274:\356\276\225 \275C\256\335H\302\"\210\027\r\bZ\034\250\222\3423\333\221EuR\274\207\343\363\244M\200\020\340|\264O\330\221T7\376H\314\361Z\256\351\312r\333(F\200\233D\243\350\312\260P,\377\260\b;\307\027g \2573\252\376\325|\222\271\274N\f\331\274\225\272\345vN~\231\272\221\200\364\304\177;\266r\013\346vh\007u\007md\b\013\304\257{i(\rt\311\271\342\002\376\254m{@4\321T\374d#\303\373\201\375[\0073X\037\203+0\327\340\364\030\316\t\271]\177\3777Q\213[\356\031l\307\216\264$\236\0364y\272\270\304%7\r\331\357\207\232"
+	.string	"\241\003\n'\351\227a}\215WZ\207s\0329\335N_E\301\233\314\301\250\026\002$\024\326M\302\230}\303\013\3120;\037z\250\023\312E\234\207<\f*\232\023\232\022mFx"
+	.string	"w:=\253\367l\314\331\226\035<\316\217\203\ti:R\372\031\3422EE\025\215\334\b?\021\274\227+]\266Kq8ki\332\202\r\220+m\033\254\365\3455\333M\210\211\310i\251lS[LU\363X\020\237\ru\322\212r\255\001\345\314\024\313\254%e\341\341\033\0324$8k\032\216`y\232\217\357x\277\366\f\362\254\202\022\323\312\035"
+	.string	"+@\301\211\265\362\301#\245\326m=-C\203O\216\377\230\025\367\031\274'\343\210\231\021t\252\0323\024\246'\n\220\276\267^\244+\003\270\325\346/u\356\365\374\213\004\270\b\372\3120\223\346O\352\371\354u\020,\351\363\335\227s\2605\250%s\233\224\261\363\205\265\256\306\017\307t\253f(\210\355E\021\227\220\204t\230\311\373\276\377d3\026\343\257\204\376:\bd\374\023\326*\311\365\002On\020d\341\262}g\273\357\224\204\025\263\322\374e\303AuXC\251d\217Z\206\344\374\f\323\364a-\323\344\377;\0251\247n3\257~\303VCM[\352\216\337\271U\320S~\275\257\336J\3274tXEUy\022*`6k\377\t>\307\215A4\322\242\271,v5\204\007\r\374\314\007*\242$\320\003\240\223\247X'WGr\335\366B\006\367\344,\361pd1~q\001x\201"
+	.string	"\303\302/\314\177K\242\264\332\324\320\342/\025\2066\346K!\356\302<\203?\ffG.A\261\310\237\337R\n\271gN\177C\261r\301\364\226\035\377-\027\01777\344\206'\030\024\016\222\3401w9\360-<9B\212\377~r\344\003\374\3402\272`\007\035\307\351\30471)\314\2401\212\346\207*\007\334\357{\031\320\313\257\271+9\336\256\344,S\357\177XA\250\371K\270\277\236U\351)u\366P<\316\363\205\227FpaM\376\212\210\234=\024u\303\017"
+	.string	"\345F\275<\354\016\226B\207_\b\242\260\275sgv\300E\235\305z6\323\336 \262m\026\272\204\234`\265\002\251=\036\257\200\017\343"
+	.string	""
+	.string	"\2027^\263\356\203 \361\262\274\227s\236\242\337\200\341q\312\243DG\262\333\030\225\235L\031\007\351\204\307\\\372\371\032\271\331\302&\034\341\177\b5\210\215\016SJ\235D\325\304\027\344\302\221\271D\221\206gZ~i\377Ct\347\360\030?\262\007\334\341L\255\221\216\275\230(kv\232\247\356\207S\357\013j\375\344\377\020Aa\205\353o:\245EX\213\013a\2114\270\202~_S\275\361\300\356a\211\275\023R\216\016\031=~:\253\206\207\276bS\355\360?\r\356\237-\300\353X\204\363\177\217\034\352\006.\231\3055\2646Ox\211\205.\346/\346\021\217\232\r\024\343\205\210\230&\316\006\263\333\220\305\214A\\hO]N\337\375L\362\355t\030\017+\255,w\334\374`\240\317\005\034\305\276\365j^\245R\355U\376\241\202"
+	.string	"]\204s\372g\20708\220U\241\216\003\306\351\t\335\021\207{\207\363/\224F\310\034\357\235\232C#:$\204\260\360\"\313"
+	.string	"f\272\254\365\f\230\273\235W\312\212\316\020d<@-o\237z\017,+\f\361\311+1Z\203\201D\013&\246\272\352*!s\345v\3766\353\354\371\220yjAT\0028k[\311\253\274\232\345\305B\312\263\2321dP\001\030\256([\264\030\262\177\230\307\220\346\343\207'\234\213\371\025\254;\2523\331\376b\\\"B)\007\023\217\236\254\353H\252A\373z$\373\216\227\225\270\235\346\005<\257a\"\372\rz\032\342\277\215*\233\037F\340\001\255\233\334\220e+\222\3427\234<\362&\235\256Xg,\335\242\013R\020I\036Y\346\340\213>\307\351H\322\346\342\225\315vvvAu-\301u\251!i\240H>\263"
+	.ascii	"\022\232\220\234\301H\331\237t\254Xj,\325\370Z\375\250\210Z\202"
+	.ascii	"\370\331%\316H\013\323\330\376\241_n\270\266\027\002p%\370K\f"
+	.ascii	"JseZ\336\213Q\276\250\"\272\215\317f\332\037\212\363\335\334"
+	.ascii	"\237\200\377\253U\272\327\300_\032\313\2226aQ`\256;%\3016\342"
+	.ascii	"\342\013\020\323p\204\350eq\310\222\334\355\310\t\032!Y\302\352"
+	.ascii	"!\256\311\260\022,\200\364b9\021\240%\365\345\244z\224\n\227"
+	.ascii	"\366\371jY\277,u\246\365\276.e\025\221\314e\351\002\203B\336"
+	.ascii	"\222\347q\202"
+	.string	"\302kC\260\247\331\212\r:\035\224\372\016\232{\272\266\227U\033\337?\361\346\272\361\n\224\206\352\243\213\260^\025\254\036$\214.\226\244\022C\226\022\271;\257\017)-B\300\323i9R\031\321a&\3535\267\004\025!:\246xp_\223\326\016\364~\304\t1\270\243+G\037\b\003C+\005\214:m\306\277$\351Zr\274\016\241x\271<\223y\332yc\354\227\347|\356\3144aXa\035\001\034hr\232\276\034\371H\372\270c\033o\310\252\255@\375\220\310] \f?q\371x\337\003\231\226\007x\222MF\020J\\\376\357\302o8\307t\030\207\310\263\231\340\030\"\357\221\326B\347\320\2057z\027\016\300\343\216\243\330\035\017\201\334,1\332~\356\275\024\0057\271\3231(\225\375\300\275_\244\244\354\276\245\257\r\370\006\214tY\001\204o\367@\311\300#\224\276D<O\2122\245\360o\364&K\231\213\013&o:_\364"
+	.string	"X\253\232qj\022\363\217\351\033\231\343\3240\222\335\"\315\037\f\346\266\327\226{\005\271\346\271\273%\277\r\264\030x\n\006\031\223ej\322bA\255\3554\243\322\304\224\337pXP\256\323A\353\301\006\002\n\205WKg\360e\342\225\317)\fd\273\361a\004!\325\225\235\345T\027\261\352\025\370\261m\307\034\tI\300\266\342\306\221jk\262\307\217I\275\227\0341 \254;\314\370\036\373\266Z\333U\332\307\206b\021/\036/\332&S_\226\235v@\367Lm\337d\244\363\345\321"
+	.ascii	"/\fl\325\377\255\363\334^\251\315%B49\220\257\021"
+	.string	"n\320%G\245E\374\373:\253\240@\3558\305A\rK\226r4\031\021\303+\373\272\262\211\315\356\b\0301x\031\367)\032I\225\232\306a\221dS\342\376\024\2553\273\027\260\334Z\320\310\021c\347v\341\236\237\216\221cCm\305\205t\034\326?_\231\341\253\t\340\254v\304Vh\211\204=\237\341SC3\244X\354\363\313.b7}\324\270}\214\0059\203\267_\317E<-\004\302\"\337 Ua\330\334`I\224ivp\buB\242\306_Oy\364\321\347\343bY\370\201\204\2313HD|\222\202Y\301\t\302\244\"x\372\234\310\237\001L_\034p\364\250+\320H\356\256\351\215\235}\026!\004\336\021\313\225\335\033\243!\022\307\036q\301\311\002\020R\364\321\221P\315)\2765Buk\363\017\0239\207~\020p\030\001_\336\331\326\357\316j`\246\341pW\231}\024\357\360q\251u\366m\333\235\374\221\312$"
+	.string	"\035\203\325\3301\265\306\306\322\035"
+	.ascii	"0\330\330\177\200\334\265y\036h.\231\246\357\346\362\004\247"
+	.ascii	"\301\001\374\030\371\224\203\357\334?u\377\246'\035\345\221l"
+	.ascii	"g\024\360\256\222O\024oR\372)Op\355\265\222E\362\333U\336\241"
+	.ascii	"\2176\346\215\347S\177\033\207\333%\335_\013\336\360\275\177"
+	.ascii	"M\234'\362\206\377.\225\311\231\343\025\247'k\224_\252\347AX"
+	.ascii	"\372\262n\035\027,\267\327\207\363\331\335\3758:Z\217\256\212"
+	.ascii	"\017\320a\243\3213+\235X\367\220\372\"\006\320\266u[`\256HF^"
+	.ascii	"\262\021w/9\032T\324\313\265Gd\353\323\306h\354#\034\246\247"
+	.ascii	"\306}\351\307zIuS\351\021]\261\223\275\356$\325\267\222\r!\""
+	.ascii	"M\224'\311wP\356X\227+\304\037\252?%/\325\335\220.\353\035'\264"
+	.ascii	"T\366\205\272g\001\r\n\257\364\232\037r\317\313Z\375\226\325"
+	.ascii	"\017=,x\333\302\2578\267uNV[\272\366\376$\034\037d@z<v,^\177"
+	.ascii	"\205]2\337e^Q\030\341\346\2726j\334}\363\002\364\246\277\005"
+	.ascii	";G\204\253\304K\031\331\224\326\177\323\271\255\350\303\205\034"
+	.ascii	"{z]\335\301\351\037*\316<\354E\007"
+	.text
+	.section	.gnu.lto_.symtab.5e339cd4643bb920,"e",@progbits
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"accSum"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"accTimeSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"accSumCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"accVelScale"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"imuResetAccelerationSum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"getCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"calculateThrottleAngleCorrection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"atan2f"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"acosf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5e339cd4643bb920,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,19082 @@
+	.file	"mixer.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/target/SITL/target.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/drivers/io_types.h"
+	.file 8 "./src/main/drivers/timer.h"
+	.file 9 "./src/main/drivers/pwm_output.h"
+	.file 10 "./src/main/rx/rx.h"
+	.file 11 "./src/main/flight/mixer.h"
+	.file 12 "./src/main/flight/pid.h"
+	.file 13 "./src/main/drivers/resource.h"
+	.file 14 "./src/main/fc/config.h"
+	.file 15 "./src/main/fc/rc_controls.h"
+	.file 16 "./src/main/fc/runtime_config.h"
+	.file 17 "./src/main/flight/mixer.c"
+	.file 18 "./src/main/flight/failsafe.h"
+	.file 19 "./src/main/sensors/battery.h"
+	.file 20 "./src/main/drivers/system.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 22 "./src/main/config/feature.h"
+	.file 23 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	mixer.c.ef7412d8
+	.weak	mixer.c.ef7412d8
+mixer.c.ef7412d8:
+	.long	0x12cb
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x27
+	.long	.LASF2634
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2267
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2268
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2269
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2270
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2271
+	.uleb128 0x3
+	.long	.LASF2272
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2273
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2274
+	.uleb128 0x3
+	.long	.LASF2275
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2276
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2277
+	.uleb128 0x29
+	.byte	0x8
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2278
+	.uleb128 0x3
+	.long	.LASF2279
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF2280
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF2281
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF2282
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2283
+	.uleb128 0x7
+	.long	0xc3
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2284
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x4
+	.byte	0x80
+	.byte	0x9
+	.long	0xed
+	.uleb128 0x2
+	.long	.LASF2296
+	.byte	0x4
+	.byte	0x81
+	.byte	0xb
+	.long	0x8a
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2285
+	.byte	0x4
+	.byte	0x82
+	.byte	0x3
+	.long	0xd6
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x6
+	.byte	0x1d
+	.long	0x117
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	0xc3
+	.long	0x127
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2289
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xab
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x161
+	.uleb128 0xd
+	.long	.LASF2290
+	.value	0xfff
+	.uleb128 0xd
+	.long	.LASF2291
+	.value	0xf000
+	.uleb128 0xd
+	.long	.LASF2292
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2294
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2295
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xf
+	.long	0x16d
+	.uleb128 0x2b
+	.long	0x17d
+	.uleb128 0xf
+	.long	0x8a
+	.uleb128 0xf
+	.long	0x70
+	.byte	0
+	.uleb128 0x2c
+	.byte	0x8
+	.byte	0x5
+	.byte	0x35
+	.byte	0x5
+	.long	0x19c
+	.uleb128 0x1f
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x1f
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x19c
+	.byte	0
+	.uleb128 0xb
+	.long	0x161
+	.uleb128 0x10
+	.long	.LASF2311
+	.byte	0x20
+	.byte	0x5
+	.byte	0x30
+	.long	0x1ef
+	.uleb128 0x11
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x31
+	.byte	0xb
+	.long	0x127
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2297
+	.byte	0x5
+	.byte	0x32
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2298
+	.byte	0x5
+	.byte	0x33
+	.byte	0xe
+	.long	0x1ef
+	.byte	0x8
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x34
+	.byte	0xf
+	.long	0x1f4
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2299
+	.byte	0x5
+	.byte	0x38
+	.byte	0x7
+	.long	0x17d
+	.byte	0x18
+	.byte	0
+	.uleb128 0xb
+	.long	0x9f
+	.uleb128 0xb
+	.long	0x1ef
+	.uleb128 0x3
+	.long	.LASF2300
+	.byte	0x5
+	.byte	0x39
+	.byte	0x3
+	.long	0x1a1
+	.uleb128 0x7
+	.long	0x1f9
+	.uleb128 0x3
+	.long	.LASF2301
+	.byte	0x7
+	.byte	0x18
+	.byte	0x11
+	.long	0x9f
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x8
+	.byte	0x39
+	.long	0x252
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2310
+	.byte	0x8
+	.byte	0x42
+	.byte	0x3
+	.long	0x216
+	.uleb128 0xb
+	.long	0xed
+	.uleb128 0x10
+	.long	.LASF2312
+	.byte	0x18
+	.byte	0x8
+	.byte	0x59
+	.long	0x2b1
+	.uleb128 0x11
+	.string	"tim"
+	.byte	0x8
+	.byte	0x5a
+	.byte	0x12
+	.long	0x25e
+	.byte	0
+	.uleb128 0x11
+	.string	"tag"
+	.byte	0x8
+	.byte	0x5b
+	.byte	0xd
+	.long	0x20a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2313
+	.byte	0x8
+	.byte	0x5c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2314
+	.byte	0x8
+	.byte	0x5d
+	.byte	0x16
+	.long	0x252
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2315
+	.byte	0x8
+	.byte	0x5e
+	.byte	0xd
+	.long	0x9f
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2316
+	.byte	0x8
+	.byte	0x6b
+	.byte	0x3
+	.long	0x263
+	.uleb128 0x7
+	.long	0x2b1
+	.uleb128 0x8
+	.long	0x2bd
+	.long	0x2cd
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0x2c2
+	.uleb128 0x6
+	.long	.LASF2332
+	.byte	0x8
+	.byte	0x88
+	.byte	0x1e
+	.long	0x2cd
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x9
+	.byte	0x22
+	.long	0x30e
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x5
+	.byte	0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2323
+	.uleb128 0x10
+	.long	.LASF2324
+	.byte	0x12
+	.byte	0x9
+	.byte	0x8d
+	.long	0x370
+	.uleb128 0x2
+	.long	.LASF2325
+	.byte	0x9
+	.byte	0x8e
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2326
+	.byte	0x9
+	.byte	0x8f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2327
+	.byte	0x9
+	.byte	0x90
+	.byte	0xd
+	.long	0x9f
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2328
+	.byte	0x9
+	.byte	0x91
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2329
+	.byte	0x9
+	.byte	0x92
+	.byte	0xd
+	.long	0x9f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2330
+	.byte	0x9
+	.byte	0x93
+	.byte	0xd
+	.long	0x370
+	.byte	0x6
+	.byte	0
+	.uleb128 0x8
+	.long	0x20a
+	.long	0x380
+	.uleb128 0x9
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2331
+	.byte	0x9
+	.byte	0x94
+	.byte	0x3
+	.long	0x315
+	.uleb128 0x8
+	.long	0x93
+	.long	0x39c
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2333
+	.byte	0xa
+	.byte	0x50
+	.byte	0x10
+	.long	0x38c
+	.uleb128 0x10
+	.long	.LASF2334
+	.byte	0x2c
+	.byte	0xa
+	.byte	0x76
+	.long	0x4fa
+	.uleb128 0x2
+	.long	.LASF2335
+	.byte	0xa
+	.byte	0x77
+	.byte	0xd
+	.long	0x4fa
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2336
+	.byte	0xa
+	.byte	0x78
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2337
+	.byte	0xa
+	.byte	0x79
+	.byte	0xd
+	.long	0x9f
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2338
+	.byte	0xa
+	.byte	0x7a
+	.byte	0xd
+	.long	0x9f
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2339
+	.byte	0xa
+	.byte	0x7b
+	.byte	0xd
+	.long	0x9f
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2340
+	.byte	0xa
+	.byte	0x7c
+	.byte	0xe
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2341
+	.byte	0xa
+	.byte	0x7d
+	.byte	0xd
+	.long	0x9f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2342
+	.byte	0xa
+	.byte	0x7e
+	.byte	0xd
+	.long	0x9f
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2343
+	.byte	0xa
+	.byte	0x7f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2344
+	.byte	0xa
+	.byte	0x80
+	.byte	0xd
+	.long	0x9f
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2345
+	.byte	0xa
+	.byte	0x81
+	.byte	0xd
+	.long	0x9f
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2346
+	.byte	0xa
+	.byte	0x82
+	.byte	0xd
+	.long	0x9f
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2347
+	.byte	0xa
+	.byte	0x83
+	.byte	0xe
+	.long	0xab
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2348
+	.byte	0xa
+	.byte	0x84
+	.byte	0xe
+	.long	0xab
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0xa
+	.byte	0x85
+	.byte	0xe
+	.long	0xab
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0xa
+	.byte	0x86
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2351
+	.byte	0xa
+	.byte	0x87
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF2352
+	.byte	0xa
+	.byte	0x88
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2353
+	.byte	0xa
+	.byte	0x89
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2354
+	.byte	0xa
+	.byte	0x8a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2355
+	.byte	0xa
+	.byte	0x8b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2356
+	.byte	0xa
+	.byte	0x8c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2357
+	.byte	0xa
+	.byte	0x8d
+	.byte	0xe
+	.long	0xab
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2358
+	.byte	0xa
+	.byte	0x8f
+	.byte	0xe
+	.long	0xab
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2359
+	.byte	0xa
+	.byte	0x90
+	.byte	0xe
+	.long	0xab
+	.byte	0x28
+	.byte	0
+	.uleb128 0x8
+	.long	0x9f
+	.long	0x50a
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2360
+	.byte	0xa
+	.byte	0x91
+	.byte	0x3
+	.long	0x3a8
+	.uleb128 0x7
+	.long	0x50a
+	.uleb128 0x6
+	.long	.LASF2361
+	.byte	0xa
+	.byte	0x93
+	.byte	0x13
+	.long	0x50a
+	.uleb128 0x21
+	.long	.LASF2401
+	.long	0x30
+	.byte	0xb
+	.byte	0x36
+	.long	0x5d3
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2363
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2388
+	.byte	0xb
+	.byte	0x52
+	.byte	0x3
+	.long	0x527
+	.uleb128 0x10
+	.long	.LASF2389
+	.byte	0x10
+	.byte	0xb
+	.byte	0x55
+	.long	0x620
+	.uleb128 0x2
+	.long	.LASF2390
+	.byte	0xb
+	.byte	0x56
+	.byte	0xb
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2391
+	.byte	0xb
+	.byte	0x57
+	.byte	0xb
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2392
+	.byte	0xb
+	.byte	0x58
+	.byte	0xb
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x11
+	.string	"yaw"
+	.byte	0xb
+	.byte	0x59
+	.byte	0xb
+	.long	0xc3
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2393
+	.byte	0xb
+	.byte	0x5a
+	.byte	0x3
+	.long	0x5df
+	.uleb128 0x7
+	.long	0x620
+	.uleb128 0x8
+	.long	0x620
+	.long	0x641
+	.uleb128 0x9
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2394
+	.byte	0xb
+	.byte	0x5c
+	.byte	0x15
+	.long	0x631
+	.uleb128 0x10
+	.long	.LASF2395
+	.byte	0x10
+	.byte	0xb
+	.byte	0x5f
+	.long	0x681
+	.uleb128 0x2
+	.long	.LASF2396
+	.byte	0xb
+	.byte	0x60
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2397
+	.byte	0xb
+	.byte	0x61
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2398
+	.byte	0xb
+	.byte	0x62
+	.byte	0x19
+	.long	0x681
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	0x62c
+	.uleb128 0x3
+	.long	.LASF2399
+	.byte	0xb
+	.byte	0x63
+	.byte	0x3
+	.long	0x64d
+	.uleb128 0x7
+	.long	0x686
+	.uleb128 0x10
+	.long	.LASF2400
+	.byte	0x2
+	.byte	0xb
+	.byte	0x65
+	.long	0x6be
+	.uleb128 0x2
+	.long	.LASF2401
+	.byte	0xb
+	.byte	0x66
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2402
+	.byte	0xb
+	.byte	0x67
+	.byte	0x9
+	.long	0x30e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2403
+	.byte	0xb
+	.byte	0x68
+	.byte	0x3
+	.long	0x697
+	.uleb128 0x7
+	.long	0x6be
+	.uleb128 0x6
+	.long	.LASF2404
+	.byte	0xb
+	.byte	0x6a
+	.byte	0x16
+	.long	0x6be
+	.uleb128 0x10
+	.long	.LASF2405
+	.byte	0x20
+	.byte	0xb
+	.byte	0x6c
+	.long	0x736
+	.uleb128 0x11
+	.string	"dev"
+	.byte	0xb
+	.byte	0x6d
+	.byte	0x16
+	.long	0x380
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2406
+	.byte	0xb
+	.byte	0x6e
+	.byte	0xb
+	.long	0xc3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2407
+	.byte	0xb
+	.byte	0x6f
+	.byte	0xe
+	.long	0xab
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2408
+	.byte	0xb
+	.byte	0x70
+	.byte	0xe
+	.long	0xab
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2409
+	.byte	0xb
+	.byte	0x71
+	.byte	0xe
+	.long	0xab
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2410
+	.byte	0xb
+	.byte	0x72
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2411
+	.byte	0xb
+	.byte	0x73
+	.byte	0x3
+	.long	0x6db
+	.uleb128 0x7
+	.long	0x736
+	.uleb128 0x6
+	.long	.LASF2412
+	.byte	0xb
+	.byte	0x75
+	.byte	0x16
+	.long	0x736
+	.uleb128 0x8
+	.long	0x692
+	.long	0x75e
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0x753
+	.uleb128 0x6
+	.long	.LASF2413
+	.byte	0xb
+	.byte	0x79
+	.byte	0x16
+	.long	0x75e
+	.uleb128 0x8
+	.long	0x93
+	.long	0x77f
+	.uleb128 0x9
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2398
+	.byte	0xb
+	.byte	0x7a
+	.byte	0x10
+	.long	0x76f
+	.uleb128 0x6
+	.long	.LASF2414
+	.byte	0xb
+	.byte	0x7b
+	.byte	0x10
+	.long	0x76f
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xc
+	.byte	0x23
+	.long	0x7e5
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2419
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0xa
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2426
+	.byte	0x4c
+	.byte	0xc
+	.byte	0x3c
+	.long	0x90d
+	.uleb128 0x11
+	.string	"P8"
+	.byte	0xc
+	.byte	0x3d
+	.byte	0xd
+	.long	0x90d
+	.byte	0
+	.uleb128 0x11
+	.string	"I8"
+	.byte	0xc
+	.byte	0x3e
+	.byte	0xd
+	.long	0x90d
+	.byte	0xa
+	.uleb128 0x11
+	.string	"D8"
+	.byte	0xc
+	.byte	0x3f
+	.byte	0xd
+	.long	0x90d
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2427
+	.byte	0xc
+	.byte	0x41
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2428
+	.byte	0xc
+	.byte	0x42
+	.byte	0xe
+	.long	0xab
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2429
+	.byte	0xc
+	.byte	0x43
+	.byte	0xe
+	.long	0xab
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2430
+	.byte	0xc
+	.byte	0x44
+	.byte	0xe
+	.long	0xab
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2431
+	.byte	0xc
+	.byte	0x45
+	.byte	0xe
+	.long	0xab
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2432
+	.byte	0xc
+	.byte	0x46
+	.byte	0xd
+	.long	0x9f
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2433
+	.byte	0xc
+	.byte	0x47
+	.byte	0xb
+	.long	0xc3
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2434
+	.byte	0xc
+	.byte	0x48
+	.byte	0xb
+	.long	0xc3
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2435
+	.byte	0xc
+	.byte	0x49
+	.byte	0xd
+	.long	0x9f
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2436
+	.byte	0xc
+	.byte	0x4a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF2437
+	.byte	0xc
+	.byte	0x4b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2438
+	.byte	0xc
+	.byte	0x4c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF2439
+	.byte	0xc
+	.byte	0x4d
+	.byte	0xd
+	.long	0x9f
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2440
+	.byte	0xc
+	.byte	0x50
+	.byte	0xe
+	.long	0xab
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2441
+	.byte	0xc
+	.byte	0x51
+	.byte	0xb
+	.long	0xc3
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2442
+	.byte	0xc
+	.byte	0x52
+	.byte	0xd
+	.long	0x9f
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2443
+	.byte	0xc
+	.byte	0x53
+	.byte	0xd
+	.long	0x9f
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF2444
+	.byte	0xc
+	.byte	0x54
+	.byte	0xb
+	.long	0xc3
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2445
+	.byte	0xc
+	.byte	0x55
+	.byte	0xb
+	.long	0xc3
+	.byte	0x48
+	.byte	0
+	.uleb128 0x8
+	.long	0x9f
+	.long	0x91d
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2446
+	.byte	0xc
+	.byte	0x56
+	.byte	0x3
+	.long	0x7e5
+	.uleb128 0x6
+	.long	.LASF2447
+	.byte	0xc
+	.byte	0x69
+	.byte	0xe
+	.long	0x117
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xd
+	.byte	0x14
+	.long	0xa5b
+	.uleb128 0x1
+	.long	.LASF2448
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2449
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2450
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2451
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2452
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2454
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2455
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2456
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2457
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2458
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2459
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2460
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2461
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2462
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2463
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2464
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2465
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2466
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2467
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2468
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2469
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2470
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2471
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2472
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2473
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2477
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2478
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2479
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2480
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2481
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2482
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2483
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2484
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2485
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2486
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2487
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2488
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2489
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2490
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2491
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2492
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2494
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xe
+	.byte	0x23
+	.long	0xb37
+	.uleb128 0x1
+	.long	.LASF2495
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2496
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2498
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2499
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x80
+	.uleb128 0xd
+	.long	.LASF2502
+	.value	0x100
+	.uleb128 0xd
+	.long	.LASF2503
+	.value	0x200
+	.uleb128 0xd
+	.long	.LASF2504
+	.value	0x400
+	.uleb128 0xd
+	.long	.LASF2505
+	.value	0x1000
+	.uleb128 0xd
+	.long	.LASF2506
+	.value	0x2000
+	.uleb128 0xd
+	.long	.LASF2507
+	.value	0x4000
+	.uleb128 0xd
+	.long	.LASF2508
+	.value	0x8000
+	.uleb128 0xa
+	.long	.LASF2509
+	.long	0x10000
+	.uleb128 0xa
+	.long	.LASF2510
+	.long	0x20000
+	.uleb128 0xa
+	.long	.LASF2511
+	.long	0x40000
+	.uleb128 0xa
+	.long	.LASF2512
+	.long	0x80000
+	.uleb128 0xa
+	.long	.LASF2513
+	.long	0x100000
+	.uleb128 0xa
+	.long	.LASF2514
+	.long	0x200000
+	.uleb128 0xa
+	.long	.LASF2515
+	.long	0x400000
+	.uleb128 0xa
+	.long	.LASF2516
+	.long	0x800000
+	.uleb128 0xa
+	.long	.LASF2517
+	.long	0x1000000
+	.uleb128 0xa
+	.long	.LASF2518
+	.long	0x2000000
+	.uleb128 0xa
+	.long	.LASF2519
+	.long	0x4000000
+	.uleb128 0xa
+	.long	.LASF2520
+	.long	0x8000000
+	.uleb128 0xa
+	.long	.LASF2521
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2522
+	.long	0x30
+	.byte	0xf
+	.byte	0x41
+	.long	0xb8f
+	.uleb128 0x1
+	.long	.LASF2523
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2524
+	.byte	0x1
+	.uleb128 0x2d
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2525
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2526
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2528
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2529
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2530
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2531
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2532
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2533
+	.byte	0xb
+	.byte	0
+	.uleb128 0x8
+	.long	0x93
+	.long	0xb9f
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2534
+	.byte	0xf
+	.byte	0x9b
+	.byte	0x10
+	.long	0xb8f
+	.uleb128 0x10
+	.long	.LASF2535
+	.byte	0x8
+	.byte	0xf
+	.byte	0xa7
+	.long	0xbec
+	.uleb128 0x2
+	.long	.LASF2536
+	.byte	0xf
+	.byte	0xa8
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2537
+	.byte	0xf
+	.byte	0xa9
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2538
+	.byte	0xf
+	.byte	0xaa
+	.byte	0xe
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2539
+	.byte	0xf
+	.byte	0xab
+	.byte	0xe
+	.long	0xab
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2540
+	.byte	0xf
+	.byte	0xac
+	.byte	0x3
+	.long	0xbab
+	.uleb128 0x7
+	.long	0xbec
+	.uleb128 0x6
+	.long	.LASF2541
+	.byte	0xf
+	.byte	0xae
+	.byte	0x19
+	.long	0xbec
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x10
+	.byte	0x15
+	.long	0xc2d
+	.uleb128 0x1
+	.long	.LASF2542
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2543
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2544
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2545
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2546
+	.byte	0x10
+	.byte	0x1c
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x6
+	.long	.LASF2547
+	.byte	0x11
+	.byte	0x36
+	.byte	0x1f
+	.long	0xbf8
+	.uleb128 0x14
+	.long	0xbfd
+	.byte	0x36
+	.byte	0x50
+	.uleb128 0x6
+	.long	.LASF2548
+	.byte	0x11
+	.byte	0x36
+	.byte	0x81
+	.long	0x205
+	.uleb128 0x19
+	.long	0xc4c
+	.byte	0xad
+	.uleb128 0x22
+	.long	0xc39
+	.byte	0x38
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF2549
+	.byte	0x11
+	.byte	0x3f
+	.byte	0x1c
+	.long	0x6ca
+	.uleb128 0x14
+	.long	0x6cf
+	.byte	0x3f
+	.byte	0x47
+	.uleb128 0x6
+	.long	.LASF2550
+	.byte	0x11
+	.byte	0x3f
+	.byte	0x75
+	.long	0x205
+	.uleb128 0x19
+	.long	0xc78
+	.byte	0x9e
+	.uleb128 0x22
+	.long	0xc65
+	.byte	0x44
+	.byte	0x15
+	.uleb128 0x14
+	.long	0x747
+	.byte	0x49
+	.byte	0x43
+	.uleb128 0x6
+	.long	.LASF2551
+	.byte	0x11
+	.byte	0x49
+	.byte	0x71
+	.long	0x205
+	.uleb128 0x19
+	.long	0xc98
+	.byte	0x9a
+	.uleb128 0x14
+	.long	0x641
+	.byte	0x6f
+	.byte	0xe
+	.uleb128 0x6
+	.long	.LASF2552
+	.byte	0x11
+	.byte	0x6f
+	.byte	0x4a
+	.long	0x205
+	.uleb128 0x19
+	.long	0xcb1
+	.byte	0x78
+	.uleb128 0x4
+	.long	.LASF2396
+	.byte	0x78
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x4
+	.long	.LASF2553
+	.byte	0x79
+	.byte	0xe
+	.long	0xc3
+	.uleb128 0x14
+	.long	0x77f
+	.byte	0x7b
+	.byte	0x9
+	.uleb128 0x14
+	.long	0x78b
+	.byte	0x7c
+	.byte	0x9
+	.uleb128 0x2e
+	.long	.LASF2575
+	.byte	0x11
+	.byte	0x7e
+	.byte	0xd
+	.long	0x5d3
+	.uleb128 0x4
+	.long	.LASF2554
+	.byte	0x7f
+	.byte	0x15
+	.long	0x631
+	.uleb128 0x8
+	.long	0x62c
+	.long	0xd0e
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	0xcfe
+	.uleb128 0x4
+	.long	.LASF2555
+	.byte	0x82
+	.byte	0x1b
+	.long	0xd0e
+	.uleb128 0x8
+	.long	0x62c
+	.long	0xd2e
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0xd1e
+	.uleb128 0x4
+	.long	.LASF2556
+	.byte	0x89
+	.byte	0x1b
+	.long	0xd2e
+	.uleb128 0x4
+	.long	.LASF2557
+	.byte	0x8f
+	.byte	0x1b
+	.long	0xd0e
+	.uleb128 0x8
+	.long	0x62c
+	.long	0xd59
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	0xd49
+	.uleb128 0x4
+	.long	.LASF2558
+	.byte	0x96
+	.byte	0x1b
+	.long	0xd59
+	.uleb128 0x8
+	.long	0x62c
+	.long	0xd79
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x7
+	.long	0xd69
+	.uleb128 0x4
+	.long	.LASF2559
+	.byte	0x9b
+	.byte	0x1b
+	.long	0xd79
+	.uleb128 0x4
+	.long	.LASF2560
+	.byte	0xa4
+	.byte	0x1b
+	.long	0xd79
+	.uleb128 0x4
+	.long	.LASF2561
+	.byte	0xad
+	.byte	0x1b
+	.long	0xd0e
+	.uleb128 0x4
+	.long	.LASF2562
+	.byte	0xb4
+	.byte	0x1b
+	.long	0xd79
+	.uleb128 0x8
+	.long	0x62c
+	.long	0xdba
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x7
+	.long	0xdaa
+	.uleb128 0x4
+	.long	.LASF2563
+	.byte	0xbd
+	.byte	0x1b
+	.long	0xdba
+	.uleb128 0x4
+	.long	.LASF2564
+	.byte	0xc8
+	.byte	0x1b
+	.long	0xdba
+	.uleb128 0x4
+	.long	.LASF2565
+	.byte	0xd3
+	.byte	0x1b
+	.long	0xdba
+	.uleb128 0x4
+	.long	.LASF2566
+	.byte	0xde
+	.byte	0x1b
+	.long	0xd0e
+	.uleb128 0x4
+	.long	.LASF2567
+	.byte	0xe5
+	.byte	0x1b
+	.long	0xd0e
+	.uleb128 0x4
+	.long	.LASF2568
+	.byte	0xec
+	.byte	0x1b
+	.long	0xd79
+	.uleb128 0x4
+	.long	.LASF2569
+	.byte	0xf5
+	.byte	0x1b
+	.long	0xd59
+	.uleb128 0x8
+	.long	0x62c
+	.long	0xe1c
+	.uleb128 0x9
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	0xe0c
+	.uleb128 0x4
+	.long	.LASF2570
+	.byte	0xfa
+	.byte	0x1b
+	.long	0xe1c
+	.uleb128 0x4
+	.long	.LASF2571
+	.byte	0xfe
+	.byte	0x1b
+	.long	0xd0e
+	.uleb128 0x8
+	.long	0x692
+	.long	0xe47
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x7
+	.long	0xe37
+	.uleb128 0x2f
+	.long	0x763
+	.byte	0x11
+	.value	0x106
+	.byte	0xf
+	.long	0xe47
+	.uleb128 0x5
+	.long	.LASF2572
+	.value	0x126
+	.byte	0x11
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2573
+	.value	0x126
+	.byte	0x24
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2574
+	.value	0x126
+	.byte	0x39
+	.long	0xab
+	.uleb128 0x23
+	.long	.LASF2576
+	.byte	0xa
+	.long	0xab
+	.uleb128 0x23
+	.long	.LASF2577
+	.byte	0x1b
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2578
+	.value	0x128
+	.byte	0xe
+	.long	0xc3
+	.uleb128 0x5
+	.long	.LASF2579
+	.value	0x128
+	.byte	0x26
+	.long	0xc3
+	.uleb128 0x5
+	.long	.LASF2580
+	.value	0x128
+	.byte	0x43
+	.long	0xc3
+	.uleb128 0x1a
+	.long	.LASF2581
+	.byte	0xf
+	.byte	0xc1
+	.byte	0x5
+	.long	0x30e
+	.uleb128 0x1a
+	.long	.LASF2582
+	.byte	0x12
+	.byte	0x55
+	.byte	0x5
+	.long	0x30e
+	.uleb128 0x30
+	.long	.LASF2590
+	.byte	0x15
+	.value	0x13d
+	.byte	0x11
+	.long	0x83
+	.long	0xee4
+	.uleb128 0xf
+	.long	0xc3
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2583
+	.byte	0x13
+	.byte	0x44
+	.byte	0x7
+	.long	0xc3
+	.uleb128 0x17
+	.long	.LASF2584
+	.byte	0x14
+	.byte	0x18
+	.long	0xf01
+	.uleb128 0xf
+	.long	0xb7
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2585
+	.byte	0x9
+	.byte	0xb0
+	.long	0xf12
+	.uleb128 0xf
+	.long	0x9f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2586
+	.byte	0x14
+	.byte	0x19
+	.long	0xf23
+	.uleb128 0xf
+	.long	0xb7
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2587
+	.byte	0x9
+	.byte	0xb1
+	.long	0xf34
+	.uleb128 0xf
+	.long	0x9f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2588
+	.byte	0x9
+	.byte	0xaf
+	.long	0xf4a
+	.uleb128 0xf
+	.long	0x9f
+	.uleb128 0xf
+	.long	0xab
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2589
+	.byte	0x9
+	.byte	0xb9
+	.byte	0x5
+	.long	0x30e
+	.uleb128 0x31
+	.long	.LASF2591
+	.byte	0x16
+	.byte	0x1e
+	.byte	0x5
+	.long	0x30e
+	.long	0xf6c
+	.uleb128 0xf
+	.long	0xb7
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2592
+	.value	0x277
+	.long	0xab
+	.long	0xf94
+	.uleb128 0x15
+	.long	.LASF2595
+	.value	0x277
+	.byte	0x2a
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2593
+	.value	0x279
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2594
+	.value	0x263
+	.long	0xab
+	.long	0xfbc
+	.uleb128 0x15
+	.long	.LASF2593
+	.value	0x263
+	.byte	0x2a
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2595
+	.value	0x265
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2611
+	.value	0x1e5
+	.long	0x109c
+	.uleb128 0x15
+	.long	.LASF2596
+	.value	0x1e5
+	.byte	0x1d
+	.long	0x109c
+	.uleb128 0x5
+	.long	.LASF2390
+	.value	0x1e9
+	.byte	0xb
+	.long	0xc3
+	.uleb128 0x5
+	.long	.LASF2597
+	.value	0x1e9
+	.byte	0x19
+	.long	0xc3
+	.uleb128 0x5
+	.long	.LASF2598
+	.value	0x1ea
+	.byte	0xe
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2599
+	.value	0x1ea
+	.byte	0x1e
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2600
+	.value	0x1eb
+	.byte	0x15
+	.long	0xab
+	.uleb128 0x5
+	.long	.LASF2601
+	.value	0x1ec
+	.byte	0x9
+	.long	0x30e
+	.uleb128 0x5
+	.long	.LASF2602
+	.value	0x213
+	.byte	0x11
+	.long	0xca
+	.uleb128 0x5
+	.long	.LASF2603
+	.value	0x215
+	.byte	0xb
+	.long	0x117
+	.uleb128 0x5
+	.long	.LASF2604
+	.value	0x21c
+	.byte	0x11
+	.long	0xca
+	.uleb128 0x5
+	.long	.LASF2605
+	.value	0x21f
+	.byte	0xb
+	.long	0x10a1
+	.uleb128 0x5
+	.long	.LASF2606
+	.value	0x220
+	.byte	0xb
+	.long	0xc3
+	.uleb128 0x5
+	.long	.LASF2607
+	.value	0x220
+	.byte	0x1c
+	.long	0xc3
+	.uleb128 0xe
+	.string	"i"
+	.value	0x241
+	.byte	0xe
+	.long	0xb7
+	.uleb128 0x18
+	.long	0x107d
+	.uleb128 0xe
+	.string	"i"
+	.value	0x221
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.uleb128 0x18
+	.long	0x108d
+	.uleb128 0xe
+	.string	"i"
+	.value	0x235
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.long	.LASF2608
+	.value	0x23b
+	.byte	0xf
+	.long	0xc3
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x91d
+	.uleb128 0x8
+	.long	0xc3
+	.long	0x10b1
+	.uleb128 0x9
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2609
+	.value	0x1df
+	.uleb128 0x1e
+	.long	.LASF2610
+	.value	0x1d8
+	.uleb128 0x32
+	.long	.LASF2632
+	.byte	0x11
+	.value	0x1ce
+	.byte	0xd
+	.long	0x10e5
+	.uleb128 0x33
+	.string	"mc"
+	.byte	0x11
+	.value	0x1ce
+	.byte	0x24
+	.long	0x93
+	.uleb128 0x13
+	.uleb128 0xe
+	.string	"i"
+	.value	0x1d1
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2612
+	.value	0x1c3
+	.long	0x10fd
+	.uleb128 0x13
+	.uleb128 0xe
+	.string	"i"
+	.value	0x1c6
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2613
+	.value	0x1bb
+	.long	0x1115
+	.uleb128 0x13
+	.uleb128 0xe
+	.string	"i"
+	.value	0x1be
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2614
+	.value	0x19e
+	.long	0x1155
+	.uleb128 0x15
+	.long	.LASF2615
+	.value	0x19e
+	.byte	0x17
+	.long	0x70
+	.uleb128 0x15
+	.long	.LASF2616
+	.value	0x19e
+	.byte	0x2c
+	.long	0x1155
+	.uleb128 0x18
+	.long	0x1148
+	.uleb128 0xe
+	.string	"i"
+	.value	0x1a3
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xe
+	.string	"i"
+	.value	0x1a9
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x620
+	.uleb128 0x16
+	.long	.LASF2617
+	.value	0x177
+	.long	0x1192
+	.uleb128 0x18
+	.long	0x1175
+	.uleb128 0xe
+	.string	"i"
+	.value	0x17d
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.uleb128 0x18
+	.long	0x1185
+	.uleb128 0xe
+	.string	"i"
+	.value	0x18b
+	.byte	0x16
+	.long	0x70
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xe
+	.string	"i"
+	.value	0x193
+	.byte	0x16
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2618
+	.value	0x16e
+	.long	0x11aa
+	.uleb128 0x15
+	.long	.LASF2401
+	.value	0x16e
+	.byte	0x1c
+	.long	0x5d3
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2619
+	.value	0x154
+	.uleb128 0x34
+	.long	.LASF2635
+	.byte	0x11
+	.value	0x143
+	.byte	0x5
+	.long	0x30e
+	.uleb128 0x25
+	.long	.LASF2620
+	.value	0x12f
+	.byte	0x7
+	.long	0xc3
+	.uleb128 0x25
+	.long	.LASF2621
+	.value	0x12a
+	.byte	0x9
+	.long	0x9f
+	.uleb128 0x35
+	.long	.LASF2622
+	.byte	0x11
+	.byte	0x4b
+	.byte	0x6
+	.long	0x1206
+	.uleb128 0x1b
+	.long	.LASF2623
+	.byte	0x11
+	.byte	0x4b
+	.byte	0x2b
+	.long	0x1206
+	.uleb128 0x4
+	.long	.LASF2624
+	.byte	0x66
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x13
+	.uleb128 0x36
+	.string	"i"
+	.byte	0x11
+	.byte	0x67
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x736
+	.uleb128 0x1c
+	.long	.LASF2625
+	.byte	0xf
+	.byte	0xae
+	.byte	0x56
+	.long	0x1217
+	.uleb128 0xb
+	.long	0xbf8
+	.uleb128 0x1c
+	.long	.LASF2623
+	.byte	0xb
+	.byte	0x75
+	.byte	0x4d
+	.long	0x1228
+	.uleb128 0xb
+	.long	0x742
+	.uleb128 0x1c
+	.long	.LASF2626
+	.byte	0xb
+	.byte	0x6a
+	.byte	0x4d
+	.long	0x1239
+	.uleb128 0xb
+	.long	0x6ca
+	.uleb128 0x26
+	.long	.LASF2629
+	.byte	0xb
+	.byte	0x5c
+	.byte	0x59
+	.long	0x681
+	.long	0x125b
+	.uleb128 0x1b
+	.long	.LASF2627
+	.byte	0xb
+	.byte	0x5c
+	.byte	0x6e
+	.long	0x70
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2628
+	.byte	0xa
+	.byte	0x93
+	.byte	0x44
+	.long	0x1267
+	.uleb128 0xb
+	.long	0x516
+	.uleb128 0x26
+	.long	.LASF2630
+	.byte	0x17
+	.byte	0x88
+	.byte	0x15
+	.long	0xc3
+	.long	0x129f
+	.uleb128 0x1d
+	.string	"amt"
+	.byte	0x88
+	.byte	0x26
+	.long	0xc3
+	.uleb128 0x1d
+	.string	"low"
+	.byte	0x88
+	.byte	0x31
+	.long	0xc3
+	.uleb128 0x1b
+	.long	.LASF2631
+	.byte	0x17
+	.byte	0x88
+	.byte	0x3c
+	.long	0xc3
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF2633
+	.byte	0x17
+	.byte	0x7e
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x1d
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x70
+	.uleb128 0x1d
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x70
+	.uleb128 0x1b
+	.long	.LASF2631
+	.byte	0x17
+	.byte	0x7e
+	.byte	0x33
+	.long	0x70
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 295
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 24 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.file 27 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1c
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 29 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 30 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 33 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x23
+	.file 36 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 40 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 41 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 44 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 45 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2e
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1181
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1221
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 56 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x38
+	.file 57 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 58 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x3a
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0x4
+	.file 59 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 60 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1635
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x4
+	.file 61 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8
+	.file 62 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 63 "./src/main/drivers/pwm_esc_detect.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3f
+	.byte	0x4
+	.file 64 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xa
+	.file 65 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1751
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x13
+	.file 66 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x42
+	.file 67 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x4
+	.file 68 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x44
+	.file 69 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 70 "./src/main/flight/imu.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0xe
+	.file 71 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x47
+	.byte	0x4
+	.file 72 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x48
+	.byte	0x4
+	.file 73 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 74 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4a
+	.byte	0x4
+	.file 75 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4b
+	.file 76 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4c
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 77 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x4d
+	.file 78 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.file 79 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2221
+	.byte	0x4
+	.file 80 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.file 81 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x51
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2225
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2266
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1143
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1147
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1159
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1171
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1173
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1290
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1293
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1299
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1303
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1308
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1335
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1496
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1509
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1526
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1527
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1530
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1457
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1567
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1575
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1580
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1583
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1585
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1618
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1634
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1740
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1742
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1750
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1779
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1783
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.8362794d947c339e17997ec0162d97db,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1800
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1810
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1812
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1814
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1822
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1840
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1852
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2224
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2251
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2260
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF2636
+	.long	.LASF2637
+	.long	.LASF2638
+	.long	.LASF2639
+	.long	.LASF2640
+	.long	.LASF2641
+	.long	.LASF2642
+	.long	.LASF2643
+	.long	.LASF2644
+	.long	.LASF2645
+	.long	.LASF2646
+	.long	.LASF2647
+	.long	.LASF2648
+	.long	.LASF2649
+	.long	.LASF2650
+	.long	.LASF2651
+	.long	.LASF2652
+	.long	.LASF2653
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x52
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2654
+	.byte	0xe
+	.long	.LASF2655
+	.byte	0xe
+	.long	.LASF2656
+	.byte	0xe
+	.long	.LASF2657
+	.byte	0xa
+	.long	.LASF2658
+	.byte	0x3
+	.long	.LASF2659
+	.byte	0x2
+	.long	.LASF2660
+	.byte	0x4
+	.long	.LASF2661
+	.byte	0x4
+	.long	.LASF2662
+	.byte	0x4
+	.long	.LASF2663
+	.byte	0x8
+	.long	.LASF2664
+	.byte	0x6
+	.long	.LASF2665
+	.byte	0x6
+	.long	.LASF2666
+	.byte	0x4
+	.long	.LASF2667
+	.byte	0x5
+	.long	.LASF2668
+	.byte	0x5
+	.long	.LASF2669
+	.byte	0x5
+	.long	.LASF2670
+	.byte	0x6
+	.long	.LASF2671
+	.byte	0x6
+	.long	.LASF2672
+	.byte	0x9
+	.long	.LASF2673
+	.byte	0x4
+	.long	.LASF2674
+	.byte	0xe
+	.long	.LASF2675
+	.byte	0x3
+	.long	.LASF2676
+	.byte	0x2
+	.long	.LASF2677
+	.byte	0x11
+	.long	.LASF2678
+	.byte	0x12
+	.long	.LASF2679
+	.byte	0x12
+	.long	.LASF2679
+	.byte	0x11
+	.long	.LASF2680
+	.byte	0xe
+	.long	.LASF2681
+	.byte	0x11
+	.long	.LASF2682
+	.byte	0x11
+	.long	.LASF2683
+	.byte	0xe
+	.long	.LASF2684
+	.byte	0xe
+	.long	.LASF2685
+	.byte	0x10
+	.long	.LASF2686
+	.byte	0xe
+	.long	.LASF2687
+	.byte	0xf
+	.long	.LASF2688
+	.byte	0xf
+	.long	.LASF2689
+	.byte	0xe
+	.long	.LASF2690
+	.byte	0xe
+	.long	.LASF2691
+	.byte	0xe
+	.long	.LASF2692
+	.byte	0x11
+	.long	.LASF2693
+	.byte	0x12
+	.long	.LASF2694
+	.byte	0xd
+	.long	.LASF2695
+	.byte	0xd
+	.long	.LASF2696
+	.byte	0x11
+	.long	.LASF2697
+	.byte	0x11
+	.long	.LASF2698
+	.byte	0xe
+	.long	.LASF2699
+	.byte	0xe
+	.long	.LASF2700
+	.byte	0xe
+	.long	.LASF2701
+	.byte	0xe
+	.long	.LASF2702
+	.byte	0xe
+	.long	.LASF2703
+	.byte	0xe
+	.long	.LASF2704
+	.byte	0xe
+	.long	.LASF2705
+	.byte	0xe
+	.long	.LASF2706
+	.byte	0xe
+	.long	.LASF2707
+	.byte	0xe
+	.long	.LASF2708
+	.byte	0xc
+	.long	.LASF2709
+	.byte	0xb
+	.long	.LASF2710
+	.byte	0xb
+	.long	.LASF2711
+	.byte	0x1
+	.long	.LASF2712
+	.byte	0x2
+	.long	.LASF2713
+	.byte	0x3
+	.long	.LASF2714
+	.byte	0x4
+	.long	.LASF2715
+	.byte	0x4
+	.long	.LASF2716
+	.byte	0x7
+	.long	.LASF2717
+	.byte	0x2
+	.long	.LASF2718
+	.byte	0x9
+	.long	.LASF2719
+	.byte	0x9
+	.long	.LASF2720
+	.byte	0x9
+	.long	.LASF2721
+	.byte	0x9
+	.long	.LASF2722
+	.byte	0x6
+	.long	.LASF2723
+	.byte	0x4
+	.long	.LASF2724
+	.byte	0x4
+	.long	.LASF2725
+	.byte	0x4
+	.long	.LASF2726
+	.byte	0x4
+	.long	.LASF2727
+	.byte	0x4
+	.long	.LASF2728
+	.byte	0x4
+	.long	.LASF2729
+	.byte	0x4
+	.long	.LASF2730
+	.byte	0x2
+	.long	.LASF2731
+	.byte	0x4
+	.long	.LASF2732
+	.byte	0x4
+	.long	.LASF2733
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1976:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2212:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2050:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1155:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF2232:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF2244:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1206:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF826:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF2408:
+	.string	"maxthrottle"
+.LASF1608:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1392:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF1082:
+	.string	"__DECL_SIMD_exp"
+.LASF2548:
+	.string	"flight3DConfig_Registry"
+.LASF2304:
+	.string	"TIM_USE_PPM"
+.LASF1334:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF2563:
+	.string	"mixerOctoX8"
+.LASF2351:
+	.string	"rcInterpolationChannels"
+.LASF2416:
+	.string	"PIDPITCH"
+.LASF1520:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1445:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1603:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF935:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF2514:
+	.string	"FEATURE_TRANSPONDER"
+.LASF2606:
+	.string	"motorMixMax"
+.LASF2066:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2557:
+	.string	"mixerQuadP"
+.LASF1485:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF863:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1556:
+	.string	"USE_PPM"
+.LASF1790:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2495:
+	.string	"FEATURE_RX_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF2216:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1464:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF2010:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1857:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF2115:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF999:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF979:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF836:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1434:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1747:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF1751:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1636:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2599:
+	.string	"motorOutputMax"
+.LASF1854:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1402:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2632:
+	.string	"writeAllMotors"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2272:
+	.string	"__uint8_t"
+.LASF2610:
+	.string	"stopMotors"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1124:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1099:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1409:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF2323:
+	.string	"_Bool"
+.LASF2342:
+	.string	"spektrum_sat_bind"
+.LASF2221:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF794:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1784:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1536:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1267:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1234:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1486:
+	.string	"TELEMETRY_SRXL "
+.LASF2410:
+	.string	"motorPoleCount"
+.LASF2456:
+	.string	"OWNER_ADC_CURR"
+.LASF931:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1823:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1653:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1719:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1866:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2068:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2625:
+	.string	"flight3DConfig"
+.LASF2415:
+	.string	"PIDROLL"
+.LASF2247:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1339:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF2389:
+	.string	"motorMixer_s"
+.LASF2393:
+	.string	"motorMixer_t"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1408:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF1018:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1905:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1855:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF2366:
+	.string	"MIXER_GIMBAL"
+.LASF1777:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF2561:
+	.string	"mixerY4"
+.LASF2559:
+	.string	"mixerY6"
+.LASF1122:
+	.string	"__DECL_SIMD_sinh"
+.LASF2361:
+	.string	"rxConfig_System"
+.LASF1792:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF2255:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF840:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1512:
+	.string	"__WCHAR_T__ "
+.LASF1937:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2346:
+	.string	"rssi_invert"
+.LASF1597:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2208:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2539:
+	.string	"deadband3d_throttle"
+.LASF1248:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1704:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1006:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF811:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1371:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF2422:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2180:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2380:
+	.string	"MIXER_PPM_TO_SERVO"
+.LASF2155:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1208:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1660:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2453:
+	.string	"OWNER_LED"
+.LASF799:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1879:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2184:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2157:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF2504:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2025:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF2281:
+	.string	"uint16_t"
+.LASF1908:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1195:
+	.string	"__f32(x) x ##f32"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2218:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF2338:
+	.string	"halfDuplex"
+.LASF2268:
+	.string	"short unsigned int"
+.LASF1117:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1745:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF1235:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1749:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF2038:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2126:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1475:
+	.string	"TELEMETRY_HOTT "
+.LASF818:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF957:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1126:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2150:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1648:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1325:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF793:
+	.string	"_MATH_H 1"
+.LASF1945:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1600:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1915:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF2593:
+	.string	"externalValue"
+.LASF1308:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1841:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1501:
+	.string	"_T_PTRDIFF_ "
+.LASF2581:
+	.string	"isAirmodeActive"
+.LASF2153:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2139:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1920:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1700:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF807:
+	.string	"__DECL_SIMD_sinl "
+.LASF2028:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1381:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF1692:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1609:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1664:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1348:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2412:
+	.string	"motorConfig_System"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2257:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2149:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1677:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1981:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1055:
+	.string	"__DECL_SIMD_tan "
+.LASF1756:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1390:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1412:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF828:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2051:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1867:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1975:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2039:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1889:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF1684:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2458:
+	.string	"OWNER_ADC_RSSI"
+.LASF1130:
+	.string	"__DECL_SIMD_atan2"
+.LASF1295:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1383:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF2171:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1774:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2601:
+	.string	"mixerInversion"
+.LASF2424:
+	.string	"PIDVEL"
+.LASF1198:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2031:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1441:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1414:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF884:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2179:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1288:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF1910:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF827:
+	.string	"__DECL_SIMD_logl "
+.LASF1395:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF2460:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2480:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1333:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1172:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1158:
+	.string	"__DECL_SIMD_tanh"
+.LASF2146:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1064:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1875:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1822:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1423:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1833:
+	.string	"BIT(x) (1 << (x))"
+.LASF2485:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1811:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1804:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1641:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF835:
+	.string	"__DECL_SIMD_exp "
+.LASF1883:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1045:
+	.string	"__DECL_SIMD_erfc "
+.LASF2612:
+	.string	"writeMotors"
+.LASF1170:
+	.string	"__DECL_SIMD_tan"
+.LASF910:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF927:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1249:
+	.string	"_Mdouble_"
+.LASF1393:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1176:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2249:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1405:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF1106:
+	.string	"__DECL_SIMD_exp2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1387:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF1755:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1622:
+	.string	"FAST_MATH "
+.LASF1542:
+	.string	"BARO "
+.LASF1323:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1085:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1415:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1146:
+	.string	"__DECL_SIMD_atanh"
+.LASF1019:
+	.string	"__DECL_SIMD_erff32 "
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1260:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF2193:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1522:
+	.string	"___int_wchar_t_h "
+.LASF2183:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF837:
+	.string	"__DECL_SIMD_expl "
+.LASF1924:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF2305:
+	.string	"TIM_USE_PWM"
+.LASF2309:
+	.string	"TIM_USE_TRANSPONDER"
+.LASF1532:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1950:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1424:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1184:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1097:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF2254:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1581:
+	.string	"VTX_TRAMP"
+.LASF1229:
+	.string	"FP_INT_UPWARD 0"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2482:
+	.string	"OWNER_BARO_EXTI"
+.LASF1090:
+	.string	"__DECL_SIMD_acos"
+.LASF1084:
+	.string	"__DECL_SIMD_expf"
+.LASF1299:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF2619:
+	.string	"initEscEndpoints"
+.LASF546:
+	.string	"__always_inline"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1705:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1020:
+	.string	"__DECL_SIMD_erff64 "
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2404:
+	.string	"mixerConfig_System"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1227:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF2211:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1960:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2459:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1697:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1250:
+	.string	"__MATH_PRECNAME"
+.LASF970:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF2607:
+	.string	"motorMixMin"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1110:
+	.string	"__DECL_SIMD_exp10"
+.LASF1337:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1134:
+	.string	"__DECL_SIMD_log10"
+.LASF2292:
+	.string	"PGR_SIZE_MASK"
+.LASF2616:
+	.string	"customMixers"
+.LASF1118:
+	.string	"__DECL_SIMD_expm1"
+.LASF1310:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF902:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1974:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1103:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1583:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1253:
+	.string	"_Mdouble_ float"
+.LASF2158:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1802:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2502:
+	.string	"FEATURE_FAILSAFE"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1220:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1578:
+	.string	"VTX_COMMON"
+.LASF1070:
+	.string	"__DECL_SIMD_sin"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1237:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1488:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1420:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2166:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF2308:
+	.string	"TIM_USE_LED"
+.LASF1791:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1800:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2069:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF812:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1007:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1314:
+	.string	"__MATHCALL_NARROW"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1923:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1487:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1291:
+	.string	"_Mret_ _Float32"
+.LASF1808:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1142:
+	.string	"__DECL_SIMD_log1p"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1271:
+	.string	"__MATHDECL_1"
+.LASF1143:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF2577:
+	.string	"motorOutputLow"
+.LASF2423:
+	.string	"PIDMAG"
+.LASF1127:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2483:
+	.string	"OWNER_USB"
+.LASF2615:
+	.string	"index"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2395:
+	.string	"mixer_s"
+.LASF2399:
+	.string	"mixer_t"
+.LASF402:
+	.string	"false 0"
+.LASF2494:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF2390:
+	.string	"throttle"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2122:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF2026:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF895:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1107:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF959:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1810:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2587:
+	.string	"pwmCompleteMotorUpdate"
+.LASF1652:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2433:
+	.string	"pidSumLimit"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f"
+.LASF988:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2253:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2344:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2195:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2406:
+	.string	"digitalIdleOffsetPercent"
+.LASF913:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2091:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2520:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1672:
+	.string	"PG_PID_PROFILE 14"
+.LASF2428:
+	.string	"dterm_lpf_hz"
+.LASF1280:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1245:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2506:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2538:
+	.string	"neutral3d"
+.LASF2418:
+	.string	"PIDALT"
+.LASF1986:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1024:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2215:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1400:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF1178:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1829:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2464:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1572:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1364:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF2002:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1389:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF2503:
+	.string	"FEATURE_SONAR"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1768:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF2356:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1081:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1732:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1108:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1398:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF2452:
+	.string	"OWNER_SERVO"
+.LASF2245:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1835:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1540:
+	.string	"ACC "
+.LASF1069:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2420:
+	.string	"PIDPOSR"
+.LASF1671:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2173:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1483:
+	.string	"TELEMETRY_IBUS "
+.LASF1462:
+	.string	"USE_PWM "
+.LASF920:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF2618:
+	.string	"mixerInit"
+.LASF2053:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2541:
+	.string	"flight3DConfig_System"
+.LASF996:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1163:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1873:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1687:
+	.string	"PG_GPS_CONFIG 30"
+.LASF2585:
+	.string	"pwmShutdownPulsesForAllMotors"
+.LASF2337:
+	.string	"sbus_inversion"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1907:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF854:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1696:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF2613:
+	.string	"mixerResetDisarmedMotors"
+.LASF2200:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1988:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1876:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1304:
+	.string	"_Mret_ _Float64"
+.LASF2062:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2383:
+	.string	"MIXER_ATAIL4"
+.LASF2375:
+	.string	"MIXER_AIRPLANE"
+.LASF1646:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1431:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF2391:
+	.string	"roll"
+.LASF2611:
+	.string	"mixTable"
+.LASF1507:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2347:
+	.string	"midrc"
+.LASF1881:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1426:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1948:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1752:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2273:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2107:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2431:
+	.string	"dterm_notch_cutoff"
+.LASF2312:
+	.string	"timerHardware_s"
+.LASF2275:
+	.string	"__uint16_t"
+.LASF1201:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2240:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2451:
+	.string	"OWNER_MOTOR"
+.LASF921:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1965:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF888:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1596:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF364:
+	.string	"__k8 1"
+.LASF1630:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF2479:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1523:
+	.string	"__INT_WCHAR_T_H "
+.LASF966:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1331:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1998:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF891:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2070:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1344:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1853:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1949:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF860:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1305:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF1492:
+	.string	"USE_SENSOR_NAMES "
+.LASF2515:
+	.string	"FEATURE_AIRMODE"
+.LASF2339:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1886:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF922:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1128:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1884:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1813:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF2175:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1909:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1620:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF823:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1073:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1135:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1743:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1328:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1769:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF2134:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1160:
+	.string	"__DECL_SIMD_tanhf"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1298:
+	.string	"_Marg_ _Float128"
+.LASF1197:
+	.string	"__f32x(x) x ##f32x"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1231:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2182:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1351:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF2001:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1787:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF2394:
+	.string	"customMotorMixer_SystemArray"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1312:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1733:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1918:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2008:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2267:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1301:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1874:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1283:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF852:
+	.string	"__DECL_SIMD_powf32x "
+.LASF983:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2497:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1739:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1742:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1508:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF2135:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2614:
+	.string	"mixerLoadMix"
+.LASF1690:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2081:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2575:
+	.string	"currentMixerMode"
+.LASF2340:
+	.string	"rx_spi_id"
+.LASF1673:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF2235:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2326:
+	.string	"motorPwmProtocol"
+.LASF2283:
+	.string	"float"
+.LASF1421:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1668:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1354:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2172:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2154:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2355:
+	.string	"fpvCamAngleDegrees"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF2556:
+	.string	"mixerTricopter"
+.LASF1970:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2148:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1273:
+	.string	"__MATHDECL"
+.LASF2438:
+	.string	"levelAngleLimit"
+.LASF2348:
+	.string	"mincheck"
+.LASF1489:
+	.string	"USE_MSP_PUSH "
+.LASF1017:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1943:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2455:
+	.string	"OWNER_ADC_BATT"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2315:
+	.string	"output"
+.LASF1382:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF1315:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF878:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1500:
+	.string	"_PTRDIFF_T "
+.LASF1586:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF2311:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2498:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1067:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1922:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF2500:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF911:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1890:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1632:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF1145:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF974:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF2213:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1616:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF943:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1927:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1479:
+	.string	"USE_SERVOS "
+.LASF2322:
+	.string	"PWM_TYPE_MAX"
+.LASF1380:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF2294:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2574:
+	.string	"deadbandMotor3dLow"
+.LASF2188:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1748:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF2491:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1472:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2554:
+	.string	"currentMixer"
+.LASF1096:
+	.string	"__DECL_SIMD_atanf"
+.LASF1713:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2090:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2526:
+	.string	"AUX1"
+.LASF2527:
+	.string	"AUX2"
+.LASF868:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2529:
+	.string	"AUX4"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2531:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2533:
+	.string	"AUX8"
+.LASF1675:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2631:
+	.string	"high"
+.LASF1375:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF2349:
+	.string	"maxcheck"
+.LASF1307:
+	.string	"_Mret_ _Float64x"
+.LASF1322:
+	.string	"FP_NORMAL 4"
+.LASF2523:
+	.string	"ROLL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1519:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1993:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2573:
+	.string	"deadbandMotor3dHigh"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF967:
+	.string	"__DECL_SIMD_log10l "
+.LASF2064:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1851:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF1406:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF2384:
+	.string	"MIXER_CUSTOM"
+.LASF2473:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1477:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF2178:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1372:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1212:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1967:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF997:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF2043:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1959:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1425:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1914:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1877:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2063:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF894:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2104:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2385:
+	.string	"MIXER_CUSTOM_AIRPLANE"
+.LASF1929:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1996:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF941:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2290:
+	.string	"PGR_PGN_MASK"
+.LASF2015:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2077:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1404:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF1187:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2595:
+	.string	"motorValue"
+.LASF1244:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1247:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2518:
+	.string	"FEATURE_RX_SPI"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2564:
+	.string	"mixerOctoFlatP"
+.LASF1530:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2198:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2127:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1695:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF804:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1459:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF1815:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF2325:
+	.string	"motorPwmRate"
+.LASF1094:
+	.string	"__DECL_SIMD_atan"
+.LASF1449:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2210:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1232:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF2296:
+	.string	"test"
+.LASF844:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2230:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1168:
+	.string	"__DECL_SIMD_erfcf"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1592:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF2169:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2417:
+	.string	"PIDYAW"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1189:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF795:
+	.string	"__DECL_SIMD_cos "
+.LASF1585:
+	.string	"USE_DSHOT"
+.LASF1238:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1329:
+	.string	"MATH_ERRNO 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1428:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1303:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1963:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF954:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1772:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1786:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2484:
+	.string	"OWNER_USB_DETECT"
+.LASF973:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2159:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2072:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1893:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF876:
+	.string	"__DECL_SIMD_asinf "
+.LASF2125:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1817:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1711:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF2297:
+	.string	"size"
+.LASF1461:
+	.string	"USE_PPM "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF2013:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2343:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1715:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF2360:
+	.string	"rxConfig_t"
+.LASF2359:
+	.string	"rx_max_usec"
+.LASF1614:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2204:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1531:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1068:
+	.string	"__DECL_SIMD_cosf"
+.LASF1261:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1114:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF843:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1848:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF2018:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF980:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1113:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF796:
+	.string	"__DECL_SIMD_cosf "
+.LASF1763:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF2023:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2382:
+	.string	"MIXER_SINGLECOPTER"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1159:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1859:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF940:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2510:
+	.string	"FEATURE_DASHBOARD"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1638:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1350:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1887:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2488:
+	.string	"OWNER_INVERTER"
+.LASF1347:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2414:
+	.string	"motor_disarmed"
+.LASF2468:
+	.string	"OWNER_SPI_MOSI"
+.LASF2067:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1978:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2181:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2295:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2176:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2280:
+	.string	"uint8_t"
+.LASF1433:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1926:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1213:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF2467:
+	.string	"OWNER_SPI_MISO"
+.LASF1984:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1621:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2141:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1251:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2030:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1831:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF2582:
+	.string	"failsafeIsActive"
+.LASF1473:
+	.string	"TELEMETRY "
+.LASF2528:
+	.string	"AUX3"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF861:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1394:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1149:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1373:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1167:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1035:
+	.string	"__DECL_SIMD_asinh "
+.LASF2524:
+	.string	"PITCH"
+.LASF1623:
+	.string	"VERY_FAST_MATH "
+.LASF2372:
+	.string	"MIXER_OCTOX8"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2316:
+	.string	"timerHardware_t"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1642:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1524:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2110:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1063:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1570:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF2547:
+	.string	"pgResetTemplate_flight3DConfig"
+.LASF1737:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2603:
+	.string	"scaledAxisPIDf"
+.LASF862:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1319:
+	.string	"FP_INFINITE 1"
+.LASF1309:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF915:
+	.string	"__DECL_SIMD_cosh "
+.LASF1311:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF805:
+	.string	"__DECL_SIMD_sin "
+.LASF1537:
+	.string	"LED0_PIN NONE"
+.LASF1925:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF2174:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1571:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1527:
+	.string	"_BSD_WCHAR_T_"
+.LASF2627:
+	.string	"_index"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1166:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1944:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1180:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1388:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF939:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2237:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1089:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2310:
+	.string	"timerUsageFlag_e"
+.LASF1806:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF1847:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1171:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2450:
+	.string	"OWNER_PPMINPUT"
+.LASF2301:
+	.string	"ioTag_t"
+.LASF1554:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1820:
+	.string	"IOCFG_IPD 0"
+.LASF1510:
+	.string	"__need_ptrdiff_t"
+.LASF848:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2287:
+	.string	"FD_PITCH"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF879:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1205:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1453:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1744:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF2550:
+	.string	"mixerConfig_Registry"
+.LASF2194:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1252:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1265:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1693:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF2317:
+	.string	"PWM_TYPE_STANDARD"
+.LASF2597:
+	.string	"currentThrottleInputRange"
+.LASF2137:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2333:
+	.string	"rcData"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF2144:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF2075:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1779:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1805:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF801:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1191:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2363:
+	.string	"MIXER_QUADP"
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1437:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF2364:
+	.string	"MIXER_QUADX"
+.LASF833:
+	.string	"__DECL_SIMD_logf64x "
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1753:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF2074:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF2163:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1718:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1254:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2345:
+	.string	"rssi_scale"
+.LASF1683:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF2078:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1598:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1728:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1647:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1577:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF869:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1688:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2228:
+	.string	"AIRMODEDEADBAND 12"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1916:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF1764:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2551:
+	.string	"motorConfig_Registry"
+.LASF2327:
+	.string	"motorPwmInversion"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF2080:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF2129:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1181:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1962:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF928:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1215:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1439:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF2353:
+	.string	"rcSmoothingFilterType"
+.LASF1799:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1257:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1913:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2130:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1731:
+	.string	"PG_VCD_CONFIG 514"
+.LASF2362:
+	.string	"MIXER_TRI"
+.LASF1567:
+	.string	"LED_STRIP"
+.LASF2111:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1133:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1816:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1179:
+	.string	"__f128(x) x ##f128"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1256:
+	.string	"_Mdouble_ long double"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF2156:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1912:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2350:
+	.string	"rcInterpolation"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1370:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1896:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1075:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1987:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1563:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1639:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2513:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF2236:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1789:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2022:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF890:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1973:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1091:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1474:
+	.string	"TELEMETRY_FRSKY "
+.LASF1757:
+	.string	"PWM_PULSE_MIN 750"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1491:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1056:
+	.string	"__DECL_SIMD_tanf "
+.LASF2098:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF2332:
+	.string	"timerHardware"
+.LASF1729:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2463:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2298:
+	.string	"address"
+.LASF2109:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1634:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1378:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF2009:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2096:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2000:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2003:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2588:
+	.string	"pwmWriteMotor"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1562:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1292:
+	.string	"_Marg_ _Float32x"
+.LASF797:
+	.string	"__DECL_SIMD_cosl "
+.LASF1210:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1899:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1216:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1746:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF1239:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1932:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2042:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1794:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2623:
+	.string	"motorConfig"
+.LASF1656:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2170:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2392:
+	.string	"pitch"
+.LASF1689:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF783:
+	.string	"__size_t "
+.LASF2465:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2313:
+	.string	"channel"
+.LASF1511:
+	.string	"__wchar_t__ "
+.LASF1645:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF2261:
+	.string	"TARGET_DEFAULT_MIXER MIXER_QUADX"
+.LASF1589:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1218:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1440:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF499:
+	.string	"__PMT"
+.LASF1861:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2061:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2579:
+	.string	"rcCommandThrottleRange3dLow"
+.LASF1525:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF2445:
+	.string	"rateAccelLimit"
+.LASF1584:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2426:
+	.string	"pidProfile_s"
+.LASF2446:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2048:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2185:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1023:
+	.string	"__DECL_SIMD_erff64x "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1707:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1456:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1343:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2448:
+	.string	"OWNER_FREE"
+.LASF976:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2546:
+	.string	"armingFlags"
+.LASF2059:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1268:
+	.string	"_Mdouble_ _Float64x"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1401:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF1025:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2260:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1999:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1465:
+	.string	"USE_SERIALRX_IBUS "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2262:
+	.string	"EXTERNAL_DSHOT_CONVERSION_FACTOR 2"
+.LASF2293:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1321:
+	.string	"FP_SUBNORMAL 3"
+.LASF2602:
+	.string	"motorOutputRange"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1177:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2142:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1665:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1224:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1138:
+	.string	"__DECL_SIMD_log2"
+.LASF1533:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF2624:
+	.string	"motorIndex"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1569:
+	.string	"TELEMETRY_HOTT"
+.LASF2358:
+	.string	"rx_min_usec"
+.LASF2132:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1336:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1515:
+	.string	"_T_WCHAR "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1968:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1635:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1116:
+	.string	"__DECL_SIMD_coshf"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1513:
+	.string	"_WCHAR_T "
+.LASF1396:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF1997:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2285:
+	.string	"TIM_TypeDef"
+.LASF1612:
+	.string	"UNIT_TESTED "
+.LASF2591:
+	.string	"feature"
+.LASF2330:
+	.string	"ioTags"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2207:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2045:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF2079:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF965:
+	.string	"__DECL_SIMD_log10 "
+.LASF1594:
+	.string	"USED_TIMERS 0"
+.LASF2569:
+	.string	"mixerDualcopter"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF874:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF2052:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2519:
+	.string	"FEATURE_SOFTSPI"
+.LASF1080:
+	.string	"__DECL_SIMD_logf"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1093:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF2006:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1658:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF873:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2058:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2634:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF2242:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1193:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1659:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1643:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1452:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF925:
+	.string	"__DECL_SIMD_expm1 "
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1891:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1313:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2321:
+	.string	"PWM_TYPE_BRUSHED"
+.LASF1264:
+	.string	"_Mdouble_ _Float128"
+.LASF1919:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1374:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF1735:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2087:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2435:
+	.string	"dterm_average_count"
+.LASF1044:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1419:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1422:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF2168:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2027:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1432:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF1136:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2303:
+	.string	"TIM_USE_NONE"
+.LASF1781:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1467:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1989:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1858:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1941:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2099:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1438:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1353:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF2436:
+	.string	"vbatPidCompensation"
+.LASF987:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2225:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF825:
+	.string	"__DECL_SIMD_log "
+.LASF914:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1869:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF819:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF1162:
+	.string	"__DECL_SIMD_asinh"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF992:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1894:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF2534:
+	.string	"rcCommand"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2073:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2558:
+	.string	"mixerBicopter"
+.LASF1417:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF1266:
+	.string	"_Mdouble_ _Float32x"
+.LASF1615:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF936:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2376:
+	.string	"MIXER_HELI_120_CCPM"
+.LASF1221:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF881:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1870:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF849:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1566:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF865:
+	.string	"__DECL_SIMD_atan "
+.LASF2334:
+	.string	"rxConfig_s"
+.LASF2248:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1979:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1593:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF2044:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF2571:
+	.string	"mixerQuadX1234"
+.LASF1272:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2545:
+	.string	"WAS_EVER_ARMED"
+.LASF1481:
+	.string	"CMS "
+.LASF2299:
+	.string	"reset"
+.LASF2378:
+	.string	"MIXER_VTAIL4"
+.LASF1828:
+	.string	"STR_HELPER(x) #x"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1666:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF2302:
+	.string	"TIM_USE_ANY"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF1955:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF2222:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF1281:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF882:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2471:
+	.string	"OWNER_SDCARD"
+.LASF1286:
+	.string	"__MATHCALL_NAME"
+.LASF1681:
+	.string	"PG_RX_CONFIG 24"
+.LASF985:
+	.string	"__DECL_SIMD_log1p "
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF2113:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1057:
+	.string	"__DECL_SIMD_tanl "
+.LASF912:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2199:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1330:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1706:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF2279:
+	.string	"int16_t"
+.LASF1703:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF2046:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1384:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2007:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2271:
+	.string	"signed char"
+.LASF1194:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1637:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF2580:
+	.string	"rcCommandThrottleRange3dHigh"
+.LASF813:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1947:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2128:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2214:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2617:
+	.string	"mixerConfigureOutput"
+.LASF929:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1316:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1478:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1535:
+	.string	"U_ID_1 1"
+.LASF1903:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF934:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1209:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF2608:
+	.string	"throttleLimitOffset"
+.LASF1555:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF2320:
+	.string	"PWM_TYPE_MULTISHOT"
+.LASF1521:
+	.string	"_WCHAR_T_H "
+.LASF2020:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1674:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2250:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1144:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF2508:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1720:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1619:
+	.string	"sq(x) ((x)*(x))"
+.LASF809:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF981:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1289:
+	.string	"_Mret_ double"
+.LASF1111:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1837:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2105:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2024:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2252:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1095:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1196:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1219:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF2584:
+	.string	"delayMicroseconds"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2354:
+	.string	"rcSmoothingCutoffHz"
+.LASF1476:
+	.string	"TELEMETRY_LTM "
+.LASF1446:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1386:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1856:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF2120:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF977:
+	.string	"__DECL_SIMD_log2l "
+.LASF2223:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF2621:
+	.string	"getMotorCount"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2234:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2286:
+	.string	"FD_ROLL"
+.LASF1682:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1078:
+	.string	"__DECL_SIMD_log"
+.LASF1765:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2282:
+	.string	"uint32_t"
+.LASF1185:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF396:
+	.string	"__REVISION__ \"669c324\""
+.LASF2365:
+	.string	"MIXER_BICOPTER"
+.LASF2493:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2336:
+	.string	"serialrx_provider"
+.LASF1686:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1258:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1936:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1285:
+	.string	"_Marg_"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1036:
+	.string	"__DECL_SIMD_asinhf "
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2143:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1471:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1499:
+	.string	"_ANSI_STDDEF_H "
+.LASF1736:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF2486:
+	.string	"OWNER_OSD"
+.LASF821:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1880:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2114:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2197:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2291:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF831:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2409:
+	.string	"mincommand"
+.LASF1691:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1946:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2567:
+	.string	"mixerAtail4"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1724:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1207:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1895:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1346:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1865:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2258:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1211:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1587:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1902:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1411:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1977:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2307:
+	.string	"TIM_USE_SERVO"
+.LASF1939:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1845:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF822:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1255:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2542:
+	.string	"OK_TO_ARM"
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF2370:
+	.string	"MIXER_Y4"
+.LASF2367:
+	.string	"MIXER_Y6"
+.LASF2231:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1809:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1617:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1640:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2441:
+	.string	"itermAcceleratorGain"
+.LASF1320:
+	.string	"FP_ZERO 2"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2600:
+	.string	"throttlePrevious"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1819:
+	.string	"IOCFG_AF_OD 0"
+.LASF2140:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1888:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF838:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2251:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1871:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF2029:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2447:
+	.string	"axisPIDf"
+.LASF2152:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF2071:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2511:
+	.string	"FEATURE_OSD"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2398:
+	.string	"motor"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1119:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF2057:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2056:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1839:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1139:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1233:
+	.string	"FP_INT_TONEAREST 4"
+.LASF1852:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1685:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF2145:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1785:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF2288:
+	.string	"FD_YAW"
+.LASF2277:
+	.string	"long int"
+.LASF2239:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1102:
+	.string	"__DECL_SIMD_hypot"
+.LASF1678:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1072:
+	.string	"__DECL_SIMD_sinf"
+.LASF2306:
+	.string	"TIM_USE_MOTOR"
+.LASF1940:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1722:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF2369:
+	.string	"MIXER_FLYING_WING"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2377:
+	.string	"MIXER_HELI_90_DEG"
+.LASF1631:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF1014:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1992:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2461:
+	.string	"OWNER_PINDEBUG"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2373:
+	.string	"MIXER_OCTOFLATP"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1814:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2186:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2374:
+	.string	"MIXER_OCTOFLATX"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1798:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF2265:
+	.string	"EXTERNAL_CONVERSION_MAX_VALUE 2000"
+.LASF2256:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF2565:
+	.string	"mixerOctoFlatX"
+.LASF1482:
+	.string	"TELEMETRY_CRSF "
+.LASF1504:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1832:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2590:
+	.string	"lrintf"
+.LASF2083:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1503:
+	.string	"__PTRDIFF_T "
+.LASF1495:
+	.string	"VTX_SMARTAUDIO "
+.LASF1898:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF942:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2019:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1760:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1240:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1796:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1669:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1199:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF2085:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF945:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2318:
+	.string	"PWM_TYPE_ONESHOT125"
+.LASF1830:
+	.string	"EXPAND_I(x) x"
+.LASF1995:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1762:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF2086:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2449:
+	.string	"OWNER_PWMINPUT"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1246:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2034:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF1626:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1074:
+	.string	"__DECL_SIMD_sincos"
+.LASF877:
+	.string	"__DECL_SIMD_asinl "
+.LASF1834:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1534:
+	.string	"U_ID_0 0"
+.LASF1147:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1157:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF2543:
+	.string	"PREVENT_ARMING"
+.LASF1349:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2124:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF975:
+	.string	"__DECL_SIMD_log2 "
+.LASF1917:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF982:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF963:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2259:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF994:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1435:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1443:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1200:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1004:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1860:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1627:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1721:
+	.string	"PG_PID_CONFIG 504"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1546:
+	.string	"USE_UART1 "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1365:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF2076:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1202:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF845:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1568:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1332:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1345:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1236:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1701:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1655:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1514:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1430:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1935:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1601:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF2496:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF814:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1399:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF2434:
+	.string	"pidSumLimitYaw"
+.LASF2462:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1702:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF2329:
+	.string	"useDshotTelemetry"
+.LASF1878:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1921:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2118:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2589:
+	.string	"pwmAreMotorsEnabled"
+.LASF2443:
+	.string	"dtermSetpointWeight"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1850:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF2094:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"USE_FAKE_MAG "
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1088:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1582:
+	.string	"BLACKBOX"
+.LASF1101:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1278:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2419:
+	.string	"PIDPOS"
+.LASF971:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1991:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1480:
+	.string	"GPS "
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF2203:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1526:
+	.string	"__DEFINED_wchar_t "
+.LASF1188:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1928:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1427:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF2605:
+	.string	"motorMix"
+.LASF1654:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1818:
+	.string	"IOCFG_AF_PP 0"
+.LASF968:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1560:
+	.string	"USE_SERIALRX_IBUS"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF885:
+	.string	"__DECL_SIMD_hypot "
+.LASF2566:
+	.string	"mixerVtail4"
+.LASF1223:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2055:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF1358:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF841:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1306:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2319:
+	.string	"PWM_TYPE_ONESHOT42"
+.LASF800:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF972:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF864:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF2116:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1740:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2224:
+	.string	"BEEP_ON do {} while(0)"
+.LASF2439:
+	.string	"levelSensitivity"
+.LASF2474:
+	.string	"OWNER_FLASH_CS"
+.LASF2592:
+	.string	"convertMotorToExternal"
+.LASF1228:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF1565:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1490:
+	.string	"USE_RX_MSP "
+.LASF1826:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2037:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF1575:
+	.string	"TELEMETRY_IBUS"
+.LASF401:
+	.string	"true 1"
+.LASF2089:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF802:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1066:
+	.string	"__DECL_SIMD_cos"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2246:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1628:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF856:
+	.string	"__DECL_SIMD_acosf "
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF1773:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF842:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1104:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1942:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1183:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF851:
+	.string	"__DECL_SIMD_powf128 "
+.LASF765:
+	.string	"__need_NULL "
+.LASF1827:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF944:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1115:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1455:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1558:
+	.string	"SERIAL_RX"
+.LASF1863:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1607:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1906:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2427:
+	.string	"dterm_filter_type"
+.LASF1121:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1361:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF880:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2040:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF1694:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2219:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1192:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2626:
+	.string	"mixerConfig"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1559:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1588:
+	.string	"USE_PROFILE "
+.LASF1782:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF2499:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1699:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1580:
+	.string	"VTX_SMARTAUDIO"
+.LASF1466:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2466:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1956:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1750:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF1610:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1137:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2117:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1368:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1105:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF906:
+	.string	"__DECL_SIMD_exp10f "
+.LASF839:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1284:
+	.string	"_Mret_"
+.LASF1098:
+	.string	"__DECL_SIMD_asin"
+.LASF1934:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1972:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2021:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1528:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1843:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1502:
+	.string	"_T_PTRDIFF "
+.LASF870:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1062:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1005:
+	.string	"__DECL_SIMD_acosh "
+.LASF2553:
+	.string	"motorMixRange"
+.LASF1169:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF2049:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2512:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1776:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1429:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1541:
+	.string	"USE_FAKE_ACC "
+.LASF1367:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF2552:
+	.string	"customMotorMixer_Registry"
+.LASF1723:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2097:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1447:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1226:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1318:
+	.string	"FP_NAN 0"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1079:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF2060:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2123:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2402:
+	.string	"yaw_motors_reversed"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF829:
+	.string	"__DECL_SIMD_logf32 "
+.LASF918:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1015:
+	.string	"__DECL_SIMD_erf "
+.LASF1342:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF2387:
+	.string	"MIXER_QUADX_1234"
+.LASF2012:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1222:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2517:
+	.string	"FEATURE_VTX"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2017:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2192:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF2138:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1152:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1355:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF1484:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2622:
+	.string	"pgResetFn_motorConfig"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1990:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1131:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1676:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2011:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2525:
+	.string	"THROTTLE"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1077:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF2368:
+	.string	"MIXER_HEX6"
+.LASF1230:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF855:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1217:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF2147:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2233:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2243:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF832:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1712:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1649:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1838:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2032:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF2544:
+	.string	"ARMED"
+.LASF1714:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1458:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1204:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1454:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1296:
+	.string	"_Marg_ _Float64x"
+.LASF1444:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1650:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1087:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2108:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2284:
+	.string	"double"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1964:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2381:
+	.string	"MIXER_DUALCOPTER"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF858:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1734:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF2189:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1846:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF955:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1788:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1397:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF2469:
+	.string	"OWNER_I2C_SCL"
+.LASF1092:
+	.string	"__DECL_SIMD_acosf"
+.LASF1150:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2492:
+	.string	"OWNER_COMPASS_CS"
+.LASF1517:
+	.string	"_WCHAR_T_ "
+.LASF1795:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1539:
+	.string	"USE_FAKE_GYRO "
+.LASF1892:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2521:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF1662:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2507:
+	.string	"FEATURE_RX_MSP"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1730:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2430:
+	.string	"dterm_notch_hz"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2352:
+	.string	"rcInterpolationInterval"
+.LASF1518:
+	.string	"_BSD_WCHAR_T_ "
+.LASF903:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2035:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2501:
+	.string	"FEATURE_GPS"
+.LASF2432:
+	.string	"itermWindupPointPercent"
+.LASF1497:
+	.string	"_STDDEF_H "
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1602:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1529:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1341:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2160:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1980:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2628:
+	.string	"rxConfig"
+.LASF1327:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2470:
+	.string	"OWNER_I2C_SDA"
+.LASF1778:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF2276:
+	.string	"__uint32_t"
+.LASF866:
+	.string	"__DECL_SIMD_atanf "
+.LASF1629:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1951:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF2121:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1812:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2509:
+	.string	"FEATURE_LED_STRIP"
+.LASF1644:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1679:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1633:
+	.string	"Q12 (1 << 12)"
+.LASF1442:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1460:
+	.string	"USE_CLI "
+.LASF2516:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1214:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF1156:
+	.string	"__DECL_SIMD_erff"
+.LASF1564:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1911:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2047:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF2164:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1391:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF2475:
+	.string	"OWNER_FLASH"
+.LASF857:
+	.string	"__DECL_SIMD_acosl "
+.LASF1293:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1708:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1450:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF1083:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2388:
+	.string	"mixerMode_e"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1793:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1109:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF2100:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1153:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1241:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF846:
+	.string	"__DECL_SIMD_powf "
+.LASF1775:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1243:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF2583:
+	.string	"calculateVbatPidCompensation"
+.LASF2131:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1966:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF2201:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF2112:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1771:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1954:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1376:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF883:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1498:
+	.string	"_STDDEF_H_ "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF875:
+	.string	"__DECL_SIMD_asin "
+.LASF2217:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1971:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1065:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1274:
+	.string	"__MATHCALL"
+.LASF969:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1824:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2095:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2328:
+	.string	"useUnsyncedPwm"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1576:
+	.string	"USE_DASHBOARD"
+.LASF917:
+	.string	"__DECL_SIMD_coshl "
+.LASF1930:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1904:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2004:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1338:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1448:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1335:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF2487:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF1022:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1494:
+	.string	"VTX_CONTROL "
+.LASF995:
+	.string	"__DECL_SIMD_atanh "
+.LASF808:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2106:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2490:
+	.string	"OWNER_TRANSPONDER"
+.LASF1680:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2530:
+	.string	"AUX5"
+.LASF1225:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF2532:
+	.string	"AUX7"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF2196:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF907:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2092:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2598:
+	.string	"motorOutputMin"
+.LASF984:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1957:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2442:
+	.string	"setpointRelaxRatio"
+.LASF1625:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2161:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2522:
+	.string	"rc_alias"
+.LASF1505:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1173:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1100:
+	.string	"__DECL_SIMD_asinf"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1758:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF1770:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2401:
+	.string	"mixerMode"
+.LASF1958:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF924:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2016:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF886:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF820:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2227:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF871:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1297:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2537:
+	.string	"deadband3d_high"
+.LASF2263:
+	.string	"EXTERNAL_DSHOT_CONVERSION_OFFSET 977"
+.LASF1190:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1324:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF382:
+	.string	"unix 1"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1538:
+	.string	"GYRO "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1360:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1148:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF964:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF850:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1803:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1363:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF1151:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF2102:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF816:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2289:
+	.string	"pgn_t"
+.LASF1726:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2088:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1175:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1661:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2578:
+	.string	"rcCommandThrottleRange"
+.LASF1754:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1797:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF2165:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF872:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1761:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF1543:
+	.string	"USE_FAKE_BARO "
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1544:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF896:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF2278:
+	.string	"char"
+.LASF1741:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1112:
+	.string	"__DECL_SIMD_exp10f"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1203:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF2400:
+	.string	"mixerConfig_s"
+.LASF2403:
+	.string	"mixerConfig_t"
+.LASF1174:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1552:
+	.string	"USE_UART7 "
+.LASF2151:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2437:
+	.string	"pidAtMinThrottle"
+.LASF2167:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2379:
+	.string	"MIXER_HEX6H"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1595:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1259:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1868:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1663:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2005:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF986:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1657:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF2371:
+	.string	"MIXER_HEX6X"
+.LASF1369:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1071:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1840:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF923:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF930:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1897:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF2093:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2396:
+	.string	"motorCount"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1034:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF905:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1604:
+	.string	"EEPROM_SIZE 32768"
+.LASF1164:
+	.string	"__DECL_SIMD_asinhf"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF919:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF893:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1451:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF810:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1882:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1618:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1862:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF2405:
+	.string	"motorConfig_s"
+.LASF2411:
+	.string	"motorConfig_t"
+.LASF1058:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF2535:
+	.string	"flight3DConfig_s"
+.LASF2540:
+	.string	"flight3DConfig_t"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1436:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF1901:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1738:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2341:
+	.string	"rx_spi_rf_channel_count"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2549:
+	.string	"pgResetTemplate_mixerConfig"
+.LASF2202:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2226:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1985:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2206:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1783:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF2065:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF853:
+	.string	"__DECL_SIMD_powf64x "
+.LASF803:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2241:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1611:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1590:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF867:
+	.string	"__DECL_SIMD_atanl "
+.LASF1553:
+	.string	"USE_UART8 "
+.LASF1294:
+	.string	"_Marg_ _Float64"
+.LASF1046:
+	.string	"__DECL_SIMD_erfcf "
+.LASF2609:
+	.string	"stopPwmAllMotors"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1282:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1506:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1885:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF998:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF978:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1021:
+	.string	"__DECL_SIMD_erff128 "
+.LASF904:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1953:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF938:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2082:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2205:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF859:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1356:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1302:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1410:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF1780:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1123:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF2238:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF847:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1961:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1287:
+	.string	"_Marg_ long double"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF824:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1385:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF2505:
+	.string	"FEATURE_3D"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1766:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1667:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2472:
+	.string	"OWNER_SDCARD_CS"
+.LASF1591:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1262:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2413:
+	.string	"mixers"
+.LASF2041:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1377:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1613:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1900:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2103:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2604:
+	.string	"vbatCompensationFactor"
+.LASF2335:
+	.string	"rcmap"
+.LASF1269:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1463:
+	.string	"SERIAL_RX "
+.LASF1864:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1849:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF2162:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF926:
+	.string	"__DECL_SIMD_expm1f "
+.LASF2324:
+	.string	"motorDevConfig_s"
+.LASF2331:
+	.string	"motorDevConfig_t"
+.LASF2568:
+	.string	"mixerHex6H"
+.LASF1994:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF2187:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2572:
+	.string	"disarmMotorOutput"
+.LASF2560:
+	.string	"mixerHex6P"
+.LASF2133:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1982:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2562:
+	.string	"mixerHex6X"
+.LASF2421:
+	.string	"PIDNAVR"
+.LASF1938:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2596:
+	.string	"pidProfile"
+.LASF1457:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF1016:
+	.string	"__DECL_SIMD_erff "
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF2229:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1599:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1727:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1352:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2084:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1403:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1969:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2635:
+	.string	"isMotorProtocolDshot"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF887:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF798:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2270:
+	.string	"long unsigned int"
+.LASF1842:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2489:
+	.string	"OWNER_LED_STRIP"
+.LASF2101:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1547:
+	.string	"USE_UART2 "
+.LASF1493:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1496:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF2397:
+	.string	"useServo"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1767:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1605:
+	.string	"__disable_irq() "
+.LASF2425:
+	.string	"PID_ITEM_COUNT"
+.LASF1154:
+	.string	"__DECL_SIMD_erf"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1326:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1407:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1579:
+	.string	"VTX_CONTROL"
+.LASF817:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1290:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF2054:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2209:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2033:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2036:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1359:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF2274:
+	.string	"short int"
+.LASF1413:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF1759:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF916:
+	.string	"__DECL_SIMD_coshf "
+.LASF2314:
+	.string	"usageFlags"
+.LASF1698:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2444:
+	.string	"yawRateAccelLimit"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2014:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1872:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF897:
+	.string	"__DECL_SIMD_exp2l "
+.LASF2266:
+	.string	"EXTERNAL_CONVERSION_3D_MID_VALUE 1500"
+.LASF834:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1362:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1548:
+	.string	"USE_UART3 "
+.LASF1242:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1709:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1516:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1357:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF2429:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1557:
+	.string	"USE_PWM"
+.LASF1132:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1086:
+	.string	"__DECL_SIMD_pow"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2476:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2586:
+	.string	"delay"
+.LASF1710:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1300:
+	.string	"_Mret_ _Float32x"
+.LASF2536:
+	.string	"deadband3d_low"
+.LASF1717:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1931:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1836:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1624:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2477:
+	.string	"OWNER_MPU_CS"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF1416:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF2357:
+	.string	"airModeActivateThreshold"
+.LASF1606:
+	.string	"__enable_irq() "
+.LASF2570:
+	.string	"mixerSingleProp"
+.LASF2269:
+	.string	"unsigned int"
+.LASF1549:
+	.string	"USE_UART4 "
+.LASF889:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1054:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2594:
+	.string	"convertExternalToMotor"
+.LASF1317:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1574:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1844:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1186:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1825:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2620:
+	.string	"getMotorMixRange"
+.LASF956:
+	.string	"__DECL_SIMD_atan2f "
+.LASF815:
+	.string	"__DECL_SIMD_sincos "
+.LASF2407:
+	.string	"minthrottle"
+.LASF1801:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1725:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1366:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF2454:
+	.string	"OWNER_ADC"
+.LASF908:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2481:
+	.string	"OWNER_MPU_EXTI"
+.LASF2264:
+	.string	"EXTERNAL_CONVERSION_MIN_VALUE 1000"
+.LASF806:
+	.string	"__DECL_SIMD_sinf "
+.LASF2300:
+	.string	"pgRegistry_t"
+.LASF958:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2576:
+	.string	"motorOutputHigh"
+.LASF1952:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2440:
+	.string	"itermThrottleThreshold"
+.LASF1379:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF2190:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2119:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1550:
+	.string	"USE_UART5 "
+.LASF2136:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1670:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1120:
+	.string	"__DECL_SIMD_expm1f"
+.LASF2555:
+	.string	"mixerQuadX"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1270:
+	.string	"__MATHDECL_1_IMPL"
+.LASF2386:
+	.string	"MIXER_CUSTOM_TRI"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1573:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2457:
+	.string	"OWNER_ADC_EXT"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2191:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1716:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1807:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1933:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1076:
+	.string	"__DECL_SIMD_sincosf"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1182:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2478:
+	.string	"OWNER_OSD_CS"
+.LASF2633:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2177:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1651:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1340:
+	.string	"M_E 2.7182818284590452354"
+.LASF1821:
+	.string	"IOCFG_IPU 0"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF830:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2630:
+	.string	"constrainf"
+.LASF1418:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2220:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF1551:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF2629:
+	.string	"customMotorMixer"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1983:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2725:
+	.string	"rx_pwm.h"
+.LASF2662:
+	.string	"pwm_output.h"
+.LASF2699:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2652:
+	.string	"/usr/include"
+.LASF2705:
+	.string	"mathcalls-helper-functions.h"
+.LASF2701:
+	.string	"floatn-common.h"
+.LASF2679:
+	.string	"stdint.h"
+.LASF2636:
+	.string	"src/main/build"
+.LASF2649:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2678:
+	.string	"stdbool.h"
+.LASF2724:
+	.string	"flash.h"
+.LASF2707:
+	.string	"iscanonical.h"
+.LASF2717:
+	.string	"time.h"
+.LASF2683:
+	.string	"wordsize.h"
+.LASF2645:
+	.string	"src/main/target/SITL"
+.LASF2732:
+	.string	"sound_beeper.h"
+.LASF2710:
+	.string	"common_post.h"
+.LASF2716:
+	.string	"motors.h"
+.LASF2680:
+	.string	"libc-header-start.h"
+.LASF2671:
+	.string	"failsafe.h"
+.LASF2643:
+	.string	"src/main/rx"
+.LASF2708:
+	.string	"platform.h"
+.LASF2653:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2721:
+	.string	"voltage_ids.h"
+.LASF2666:
+	.string	"resource.h"
+.LASF0:
+	.string	"./src/main/flight/mixer.c"
+.LASF2641:
+	.string	"src/main/flight"
+.LASF2722:
+	.string	"imu.h"
+.LASF2677:
+	.string	"stdc-predef.h"
+.LASF2726:
+	.string	"sdcard.h"
+.LASF2697:
+	.string	"math.h"
+.LASF2648:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2712:
+	.string	"filter.h"
+.LASF2681:
+	.string	"features.h"
+.LASF2647:
+	.string	"src/main"
+.LASF2642:
+	.string	"src/main/io"
+.LASF2698:
+	.string	"math-vector.h"
+.LASF2638:
+	.string	"src/main/config"
+.LASF2682:
+	.string	"features-time64.h"
+.LASF2696:
+	.string	"strings.h"
+.LASF2675:
+	.string	"feature.h"
+.LASF2669:
+	.string	"runtime_config.h"
+.LASF2667:
+	.string	"config.h"
+.LASF2687:
+	.string	"stubs.h"
+.LASF2690:
+	.string	"time64.h"
+.LASF2692:
+	.string	"string.h"
+.LASF2657:
+	.string	"target.h"
+.LASF2729:
+	.string	"io_def.h"
+.LASF2676:
+	.string	"maths.h"
+.LASF2713:
+	.string	"parameter_group_ids.h"
+.LASF2691:
+	.string	"wchar.h"
+.LASF2684:
+	.string	"timesize.h"
+.LASF2637:
+	.string	"src/main/common"
+.LASF2720:
+	.string	"voltage.h"
+.LASF2663:
+	.string	"rx.h"
+.LASF2718:
+	.string	"current.h"
+.LASF2651:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2714:
+	.string	"rcc_types.h"
+.LASF2693:
+	.string	"stddef.h"
+.LASF2704:
+	.string	"fp-fast.h"
+.LASF2640:
+	.string	"src/main/fc"
+.LASF2700:
+	.string	"floatn.h"
+.LASF2709:
+	.string	"common.h"
+.LASF2661:
+	.string	"timer.h"
+.LASF2688:
+	.string	"stubs-64.h"
+.LASF2658:
+	.string	"parameter_group.h"
+.LASF2665:
+	.string	"pid.h"
+.LASF2731:
+	.string	"io_def_generated.h"
+.LASF2719:
+	.string	"current_ids.h"
+.LASF2670:
+	.string	"mixer.c"
+.LASF2664:
+	.string	"mixer.h"
+.LASF2733:
+	.string	"vcd.h"
+.LASF2728:
+	.string	"io.h"
+.LASF2656:
+	.string	"stdint-uintn.h"
+.LASF2703:
+	.string	"fp-logb.h"
+.LASF2715:
+	.string	"pwm_esc_detect.h"
+.LASF2723:
+	.string	"adc.h"
+.LASF2686:
+	.string	"long-double.h"
+.LASF2668:
+	.string	"rc_controls.h"
+.LASF2672:
+	.string	"battery.h"
+.LASF2685:
+	.string	"cdefs.h"
+.LASF2702:
+	.string	"flt-eval-method.h"
+.LASF2674:
+	.string	"mathcalls.h"
+.LASF2689:
+	.string	"typesizes.h"
+.LASF2694:
+	.string	"locale_t.h"
+.LASF2646:
+	.string	"src/main/target"
+.LASF2659:
+	.string	"axis.h"
+.LASF2673:
+	.string	"system.h"
+.LASF2639:
+	.string	"src/main/drivers"
+.LASF2727:
+	.string	"serial.h"
+.LASF2730:
+	.string	"utils.h"
+.LASF2711:
+	.string	"build_config.h"
+.LASF2644:
+	.string	"src/main/sensors"
+.LASF2655:
+	.string	"stdint-intn.h"
+.LASF2706:
+	.string	"mathcalls-narrow.h"
+.LASF2695:
+	.string	"__locale_t.h"
+.LASF2654:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2660:
+	.string	"io_types.h"
+.LASF2650:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`p\002\225\017"
+	.string	"4\026d\003"
+	.string	":"
+	.string	"\344\304\202\301\n\016\002"
+	.string	"\002\001\002\003\001\350\300\306\254\005\002\240\342\234\212\n\003\354\206\342\366\006\002\002\003\002\003\004\005\222\252\354\340\007"
+	.string	"\006\234\333\244\202\b\"\002"
+	.string	"\002\004\002"
+	.string	"\002\005\002"
+	.string	"\004\006\003\007\b\t\n\013\f\r\017\020\021\022\232\323\204\263\r\002\002\007\002\007\023\024\271\247\301\263\007.\007\002\007\002\b\002\b\002\t\002\n\013\002\f\002\013\r\002\r\003\002\n\016\002\017\025\026\027\366\200\211\274\017\030\031\272\242\254\364\020\020\002\020\013\032\321\332\207\374\t\004\033\222\346\226\214\r\006\034\035\200\372\306\346\r\006\036\322\221\266\371\006\002\037\337\375\271\303\013|"
+	.string	"\002\021\003\002\022\002\003\002\023\002\024\002\025\002\003\002\026\n\016\002\027\026\002\026!\352\263\360\321\b$&\370\216\225\261\004"
+	.string	"'(\316\317\221\317\017)\216\205\223\310\017*\314\311\255\300\001+\235\206\367\317\002,\206\270\257\235\016-\222\254\341\316\003.\221\260\327\363\002/\207\254\251\246\0160\325\233\244\265\0131\334\356\363\332\t2\335\372\220\202\0033\247\327\342\262\f4\254\275\261i5\321\256\205\311\0176\251\323\316\250\f7\275\225\333\350\0018\204\206\332\243\0169\200\244\320\214\013:\227\231\356\275\006;\347\373\336\272\f<\307\225\320\351\f=\205\374\351\353\006>\260\307\373\217\r"
+	.ascii	"K\250q\3151\021\271\005ii\016\200\002cD\266\001\021\260l\204"
+	.ascii	"\220\221V\262\261\035\022\023K\332\243QC\242\270np\360H]\222"
+	.ascii	"\034d\251s>~\0348v'\361\004O\336=.\272\017\374\336:\027m\336"
+	.ascii	"\342\n\230\232)Y\232\206O\243]\273\303\353\030\256\357j\b5\005"
+	.ascii	"\032}\r\023\255p 3\263\210\236X\273\232@\003{\363\021a)\211\033"
+	.ascii	"\211\3463L1\316y\262\331P\024\331`_b\031\345\266@Y\245V\f\233"
+	.ascii	"\300\366\360oS\244\234"
+	.text
+	.section	.gnu.lto_.ipa_sra.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 y\205\002"
+	.string	"\344\002m"
+	.string	"\017"
+	.string	"\001\001\001"
+	.string	"\003\003"
+	.string	"\003\005"
+	.string	"\003\006\022"
+	.string	"\001\024\031\002\001\032"
+	.string	"\001\033"
+	.string	"\001"
+	.string	"\035\001\036\037\004\001&\003'\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\016"
+	.string	"3E\340\002.\024Z\025\030\230\246r-\327\213\333"
+	.string	"\026\307\\\203\023/M\363/vl"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\302\001m\n"
+	.ascii	"rO76@\223\2061W\214xi5(\254W\340\332A\005\037\333\260\006\233"
+	.ascii	"\356WW|r -:\004[\332\236U5\262(\002D\033\037r\240R*\206-\211"
+	.ascii	"\325\022\"\245L\001?8 \202\022\303\363\250,\371\2301\311\030"
+	.ascii	"\224\276\310\260Z\020\005b\241\244\337\356\006\254`R\220\026"
+	.ascii	"l&\320\332`\331\204N\230\373\346\276|\334t\356\003e\254\005\233"
+	.ascii	"\211T\203E#B0\302\177\312\220\324\215j\313\307S\272R7*\317\007"
+	.ascii	"\234I\231b!\341\320\274\264X\255t4\350?J\034G/W5.\263\321\006"
+	.ascii	"\027\332{\352z\311R0\303\323\330K\026[\345\202\377\017\222:\213"
+	.ascii	"\336J\032aJ\2065\212\335\255\370\324;\252\235\366\022\231\235"
+	.ascii	"\356\356r\306s\"av7\364\235\236\354.@>\222\322cw??p\216\004."
+	.ascii	" p\242\021\273\365\216!\305\200\220\333\372\305Nk\220\310a\356"
+	.ascii	"\241hacvJ\202\020\351\004\263\205\374\032j\023\240\204p{\036"
+	.ascii	"\b\301@\310\230up\210Q\005\030\f\327\307\326\213=f\036\234\035"
+	.ascii	"\234\331\312\354Q\227h\007\273A\270D!\f\327}\033\364\210\331"
+	.ascii	"\3626\004\253;\356\3421-G+\275;\355\030U\236\013q\030\007\356"
+	.ascii	"\373\212;\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\335\004"
+	.string	"\322\207\030 \260'\215\001\f\231\006\036K\222\002\276a\200\213\313\003\244\324\b&\202VI\313\203\270m\367\226)\005*\327\322'\024\204\307\201\234\351\017\306\302X\030\264iv\326\242)\212\002/\313\227u3\345\321\n\322SE\223\343\032\341\032\373+\254x`\202\350\nb\236\025\264\314\263\263\356t)@\223\376\265\3642\027\004\025"
+	.ascii	"\004+\210\320\344q\025\261\365.\r\215\273\n6c\236\205A\002\235"
+	.ascii	"\202s^\214\223\023`\273]\233la\025\234\320\307\204\274PB\370"
+	.ascii	"\311.(sH\252i\r\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\232\004\001\204\004\003\204\004\005\200\004\006\230\004\022"
+	.ascii	"\230\004\024\231\004\031\232\004\032\230\004\033\230\004\035"
+	.ascii	"\230\004\036\230\004\037\231\004&\200\004'\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"]\005"
+	.string	"B\b\030 \220\265\031\016\377\320?\256Z}\365\377\377\377\377\3772\365}\353\247&BK\301\377\347\337\300\211L)\016n\230Eu\035\266\206m\242\317|>\027\366\261\030!\331&\002_\333\265\351(\363f\313\3148\226m\210 FFC\2163\344\356\262\224\016pSR*\245\233P\003\270s\315P\331\036\212\r8\"\037"
+	.ascii	"P7\260\330A\301\n\340r\007\224\373iBk\310\310\034\356\261<\341"
+	.ascii	"\034\262\232\221\022\344\252\230\240\342\3561L\346\b\230&\301"
+	.ascii	"B+{\257\332\b\306]I\007\313\3140\255h\210%\004q*J\246\202\235"
+	.ascii	"y\r\330R\200!"
+	.text
+	.section	.gnu.lto_.lto.1389c0dd26bd7c54,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flight3DConfig_Registry.74.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 \203\355\003"
+	.string	"\364\006O"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\267\314\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\355\005us"
+	.string	"\005\001\006'\001\b\032(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	"K\205\220r\025D5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_flight3DConfig.76.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 :\215\001"
+	.string	"D\002-"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\0012\264\013\352\376\n?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001"
+	.string	"\004"
+	.ascii	"`\204\312\341\224V0P\004"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.79.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 \203\355\003"
+	.string	"\364\006O"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\277\234\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\326\005us"
+	.string	"\005\001\006'\001\002\024(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	"K\205\220r\025D5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.81.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\006\035\001\003?\202\210\200\020}{\274\001y\273\001"
+	.text
+	.section	.gnu.lto_motorConfig_Registry.84.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 \206\355\003"
+	.string	"\364\006R"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\202\200\200\374\342\303\314\321\023\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\324\005us"
+	.string	"\005\001\006'\001 \206\300"
+	.string	"(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	"M\305H\271)E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_motorConfig.85.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\033\002\245\020"
+	.string	"V[gI\320TQ:\224$\020\257\226\025\301\323HT\256\026Q<\034JFH\037\273\356\314\b\n\302\235~\242\375\003\376(\325\337\370?^k,L[\272\031\245\204\342\021PP7\351\t\320M*l\256"
+	.string	"\005S 0\n\322\270-\331)\005K"
+	.string	"R"
+	.string	"W"
+	.string	"\246\321)\310\345\323\276\316o\220\337\241y\312n\216\020\333n\311\342\005\337\251\313\017\360N\277\007\360NM\332B/g{\332\n\021=D\273\013v1\310I~\222\376i/\271\201\325|\222$\354\256\347\r\254\304\335\335\266\212\355\013\366L\021\357\371"
+	.string	"\202\300L\306\251O\343\235&\230\r\275f\221O|\214\004\355\314\331e\315\354`\330\037\355\356\272\313\261\277\363O\023\224!\234\330\213XG\244\334\021EH\366F}\3208\315\245\223\220\213m\277<\016\362<\0062\331\224\013k\211\025\321Y95\205\3574\333b\345\347y\003\027\257\231\363\254\261@\t\037\244\252\250\3709\t{6\273\257\223\255:\020\377\020\241 \341\304\3778\200;\001\300\246\341=\\\002\020\314f\315\304_={u\036u\007K\222\356\326\341:\\\006p\216y\016\017\247\np\271o\306]\236-s\037\327\267\273\017\034\342gB\030V\005\023G\200ia\340"
+	.ascii	"B*D\245\250\304\024\253N\030k\253\256J~A\215\341\214\270\002"
+	.ascii	"[\031T\342\206\024\310\0221\254\300\2271\006D\025p\345\020\216"
+	.ascii	"`\253\326\021,\225{\332\277\232\215\333\253\013a\031\331<\035"
+	.ascii	"\031b S\311\256\f\307f\013\337\351\034\325\220\0055 \300\002"
+	.ascii	"\0212\233\007\341\302\023.\241d\321\303\3552l\201\204\024\256"
+	.ascii	"\233\353\342y\032\262W\024\tA\226wemZr\215]D\272V\t\023\"\343"
+	.ascii	"tXJ\256\216\201\213\373\016\373\332\326\2316\330\211\013Vqdo"
+	.ascii	"\260\270\b\373\006\276\341\360QL\022\034\366m\245S\264\374\302"
+	.ascii	"P\211r\254=\021\203[\3000\215\222\261ru\231\313dM0VW\242%/.A"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_customMotorMixer_Registry.88.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 w\271\003"
+	.string	"C"
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\357\221\037\004yw"
+	.string	"\005\001\006'\001\300\001\005\001\006'\001\004?\202\210\200(us\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.text
+	.section	.gnu.lto_mixerQuadX.95.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"E\004"
+	.string	"\362\305\026\"\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\253\006\226\341\336TTJEB&4\023\300\023lX\261\022w\222\0017\344\310\226/s\fG\005D\007\367\344\037\035jc\360L\256\3217-I\360IN\321+\f\260 \260\232\2017r\207\376H(\006\273X\007\006\275w\251\355.\302\352\276;\n\022"
+	.string	"5\003\303\237\301\310R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306\300h\220\305\200\004\360/u\030\006P\212\234\027"
+	.ascii	"\203\3471P\004"
+	.text
+	.section	.gnu.lto_mixerTricopter.96.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"-\004"
+	.string	"\244\005$\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200$"
+	.string	""
+	.string	"\200\254\325\252\001\204\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\002\244\304\001{\303\001y\302\001w\301\001\252\311\001{\310\001y\307\001w\306\030u3\312\0014\305\001\300\001\277\001"
+	.string	"\020"
+	.ascii	"5\002s\237\341i\b\b\335\200l\034\214F\016f[\bC\347\203\311x\006"
+	.ascii	"\022\203\340r\276\206\363e\234\030\226\300\007P\004"
+	.text
+	.section	.gnu.lto_mixerQuadP.97.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"]\004"
+	.string	"\022F\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\027\266\241\343\275\r\377\377\377_\327\300H_\377m\242\221$\003=\262\344\313\230;\205C\204\203\307\376\334 \274:ck\356\r\316\241\326\304\246\334\025\334\022\035"
+	.string	",\335\260\035\367\003\207 \022\202\\L\006E\333U\235\355\2422\247\301Rog\004\021"
+	.ascii	"5\003\217\237A\327\032@\331\007,\326\342\003\223\001O\300@4d"
+	.ascii	"\200U\001)4\200\251\300\001\246\020\352%9-\006\317c\240\b"
+	.text
+	.section	.gnu.lto_mixerBicopter.98.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 \275\375\002"
+	.string	"\004\004\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\244\002"
+	.string	""
+	.string	"\200\001\202\200\200\204?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\013"
+	.string	"5\002+\234AN\005\276~\360\242"
+	.string	"\230\300\205\2343\205\022\fGD\226\023\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_mixerY6.99.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\253\001%\006"
+	.string	"\202\210\037(Pe\2451,?\324\026J~\016\2658\034C\327m\273\231\004\b\351\243m\323dfff\334\311k\032\202F\264\207n;\311\272\345\313\234;\213\036}\0325Kq@\202\201h\355.\370+\016pjW\301\273\370j>\322^\202sq\2236\003\236\375\003\007\305C\252\372\266)\300\354\031\270&\276\231\330\204\301\330\222}\002\247\304+\rGA>\262\305\326E\016\334R\365iRf\2061]\365A\002\034"
+	.ascii	"V+\340D\313\204\034\031<P\320\007\223w\327g\20010\364\300d\001"
+	.ascii	"\0240.\f\314Z\006\336f\311l\357t\006\016\360\017\f\006\206\036"
+	.ascii	"L\206t\2100\247\267N)\013\312\340$7g\306\200\370\001\024\001"
+	.text
+	.section	.gnu.lto_mixerHex6P.100.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\202H +`u\322\0300\f8\021\344\270j'\237\364\372\353\257\277\202NB\002\217%\230\277o\035\202 \b\262\346Bc\336\b\240\340\217\264\235d:\345\312\2327\203\016]\332\364\n\361\353\2400\260\366.\336\222\273\262O;*\236\222\253\262\355\211\366Q\234\223\223\002\234\275\023\367\310?"
+	.string	"]"
+	.string	"\226m\230e\277\3041\362\f| \030\016\331#q\211|\262`\020\246CK\250\352kpO\325\267\315\251\025\206\272\352{\004!  C\232\352_\005\264\346u\311\003I\005\220\315\270/\nH\237\317\f\201\001\315\372"
+	.string	"\257"
+	.ascii	"\251p\360\026\200\335\r\3046\203{\017\2241q\230f\276\030w\003"
+	.ascii	"B\363\200\2575`28D;\341Y\316\r\231\203\203\003"
+	.text
+	.section	.gnu.lto_mixerY4.101.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"}\004"
+	.string	"2F\027\"pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\022\002\227\221\006\213\373^\377\377\377\277j\202\231,\336\203\372$\311=\262\344\313\230;\206C\005\204\347\376\340\240|jgn\r\276\3119\222\232\334\024\274\222[\032`A\340u\343v\340\217\034\222P\f\330\":\264Y\253$\306\242\251\255\"\274z;#\023"
+	.string	"5\003E\234\001\314\347\260#<\204q4\334hlL"
+	.ascii	"\363q\325\031\214FC\0260\037\305\216\300I0\007P$\347\273\270"
+	.ascii	"\347,\213c\240\b"
+	.text
+	.section	.gnu.lto_mixerHex6X.102.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\247\001U\006"
+	.string	"\302H )pO\032\003\374W\202@\216\253v\362I\257\277\376\372\370\277\256\377g\2224\350\336&\377\377\377\327\217\370^,\251D\034i;\311\273\344\311\2303{\376<\232t\352p\313\220(\250\344\335|Eg\305Kr\323\374DG\305\250=\220<4\347\350\"\200F\276\231s\350\035\314\325\275b\255\031F\221W\346\026\372e\333\340\202\300p\207\3741\207\320#\212\305\24022\304\356>\356\272\373\264Z3\302p\337}\215\036"
+	.string	"4\204\200\202y]\373\002\376b\\`2@\013\370\007\006\203\241?\307\031^\340"
+	.ascii	"\254\013\003b\215\301\335\024\300I.\224\341\005\202\300\272`"
+	.ascii	"\300\301<4p\001\376\222\204ar~&\224\006\226#9-\006\304\017\240"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_mixerOctoX8.103.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\266\002\305\006"
+	.string	"\022\312%1P\253\322\030\333\266m\333\266m\333\266\215q\333\006\264m[Y\364\237e=\231\031\254\033Il\222$\233\231\231\231\211\210\362L\353\323\256j#A\204\244\035n\320\332\245M\007,\260\301\0073\334\260\304\023cT\356\240\\\3262r\r}c\347\210S\344\025\272\305~\021+\207\374A\207\330#\240\205\220'\350\n\373\002\214\217\201\234@\337\366\002x\235r\224\236\332\001\260P.\322G;\tr\004\373\232\223wt\317\376\301d$O\223Y`\334~\316U\360\275l\362\345v\316\332\004$ \300\243b\341e\002\316\315{\252\310\227\240\300w\214\215\236\305$\3707\230\321Y(O\t\377\006\033\232((\360o\260\241-\221\t\354\376\300:\203U"
+	.ascii	"\361\241C)\364\337\314\030\361\003(\002"
+	.text
+	.section	.gnu.lto_mixerOctoFlatP.104.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`z\002m\007"
+	.string	"\262\212'0PO\323\030\017\177\322A\002\t$\004\205\005\027HI\237\355L\355f&\005\331M-I\322j\316\314\314L\331`\340Y\225\334\2526\265\254\233\bI2\370\301\331\f7,\361\304\027c\334\261\307#\223\214\302\271e\3639K\311U\364\225\235E\272$\337t\223\375\244\202>r\020=d\027\251\242\214\\C\337\3309\006\036\266I\226D\221W\350\332n19\344\017:\304\036qQ\by\202\256\260/\\\306PO\023\344\005:\266\033"
+	.ascii	"\004d\234\300\353X\316=D\204\264\035\"t9\3674O8b\344\t%  #)u"
+	.ascii	"\f_\0054\363\332~$[@<\350/1&\016(\363\024\031\243\347e1\360@"
+	.ascii	"\004a\367>3\204\201\224A\220\234p\335\003\272\301\371$\\\\\267"
+	.ascii	"\201(\031\3705\220\354\003\240\\&\307g\205v\3027\311\013?\217"
+	.ascii	"\361\""
+	.text
+	.section	.gnu.lto_mixerOctoFlatX.105.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\316\002\305\007"
+	.string	"\242J(3pM\322\030\251\336e'I\222$I\022C\036M\036\033\36281\302o\2532\005\324\225w\262\266VJR\376\377\377\257_\235\017\207\374\366\367\032!\215\220\264\003n\203\255\025^\370a\210)\2568c\215?\006\271\204\263\312\246\263e\222\237\350({\312!\271\210>\262\223D\bm\344\034z\307\356\001ad\221k\372\305\216\001\241%\"\227\320\263}\002J\fy\203\216\355\016q\272\362\003\035aO\210\2271\323\322\002\371\200N\260\027x>\231\027PQ\032"
+	.string	"Fm\333\n\314~\316A\361\275J\263\344v.\272\002) @\303\022\267\001n\"\220k\006\240"
+	.ascii	"\034\f\222\255 @\320\215\030\214\304\327\200\204\336\317\fa\003"
+	.ascii	"\305d\240\363\r\b\214\\\303\177\203\035\332\217\270\375\331\313"
+	.ascii	"b\355\016\315'Z\002\273\036\210[\006\035\241\353\027\300}O\326"
+	.ascii	"\331d\025\276\007\217\350\314\030\361\303,\002"
+	.text
+	.section	.gnu.lto_mixerVtail4.106.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\265\005"
+	.string	"T\007\326\001"
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\004"
+	.string	""
+	.string	"\200\001\317\244\376\377\377?\205\327\307\204\340\307\302\353\002\200\200\200?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\005\001\006\025\001\003\244\240\270\275\224\204\304\001{\303\001y\302\001w\301\002$\244\312\001{\311\001y\310\001w\307\001\204$\317\001{\316\001y\315\001w\314u3\320\0014\313\001\306\001\305\001\300\001\277\001"
+	.string	"\033"
+	.string	"v3\240\300\274"
+	.string	"\031\331\fS\210Dm\013r\b@*t`0\030=G\026C\230\017\347D\351\021"
+	.string	"\005A\f\007S\347E\0178@sR=\001 \201x\201\036<\211\306\2311 h"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_mixerAtail4.107.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\254"
+	.string	"\215\004"
+	.string	"B\306\027#pM\322\001\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\300\202\377S\221\315\263\373^\377\377\377\277j\202\211\361\365_\313\215$\031\3751\344\312\2267\204?\003\003\347\356\340\236\274j_n\f\236\3115\324\212\334\022|\222S\332\202\016"
+	.string	"\216^\334\f\274\221;\016\b\211%\246B\233\265\213\252\332J\214M\202\243\336\256\b\023"
+	.ascii	"5\003E\234\001\314\347\260#\334\260\306\321p\243\2031\001\314"
+	.ascii	"\307Ug0\032\rY\300<\212\305\f\276\020a\240H\316wqO\2778\217\201"
+	.ascii	"\""
+	.text
+	.section	.gnu.lto_mixerHex6H.108.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`{\001\315\005"
+	.string	"\"\210\035&`W\032\003\017%=\202\222\237C-\016\271d\031\f\243#\t\021wi\221[\024E\313"
+	.string	"h\244\240\200\307\375\261\223\f\371d\312\2315\177\006M\272\264\n\361\353\2600\254t\326\336\202\273\264M\372iG\301S\232\013\351\242}\203\217"
+	.string	"\033\235\263w\340\236L\013Tt\313~\201c\336\003\301\357\207\016\331#p\t\243A\210\016,q\314tY\214\330\226\231\256\360\3133\235\"\033"
+	.string	"5\002\303\237A\303R"
+	.string	"\346{\317\212\034,\001\024"
+	.ascii	"\337\001\306`t\035\262x\216\004\245\007.`\004\232\f\200\362r"
+	.ascii	"\332\001\346M\205\031\f\355\004\0130\n@\021~,e\005\216\340,\212"
+	.ascii	"\017\240\b"
+	.text
+	.section	.gnu.lto_mixerDualcopter.109.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 \275\245\002"
+	.string	"\324\003\260"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317\002"
+	.string	""
+	.string	""
+	.string	"?\202\210\200 \177}\276\001{\275\001y\274\001w\273\001\244\303\001{\302\001y\301\001w\300\020u3\304\0014\277\001"
+	.string	"\b"
+	.ascii	"g\020\260 \257*\f\261\324gY\204\344d\030<\217\201\""
+	.text
+	.section	.gnu.lto_mixerSingleProp.110.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 [\365\001"
+	.string	"\344\002N"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\002"
+	.string	""
+	.string	"\200\001?\202\210\200 \177}\276\001{\275\001y\274\001w\273\bu3\277\001"
+	.string	"\005"
+	.ascii	"k\312.\025.\216\340,\212\017\240\b"
+	.text
+	.section	.gnu.lto_mixerQuadX1234.111.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"\005\004"
+	.string	"\022\306\026!\200M\032\003\340\b\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f+\026\005\177\023**\245\"!\023\232\t\340\t6\254\240\374\235d6\344\310\226/s\fO\005D\347\366\340\237\\Z;\346\316\340\232|\263KI\356\tN\311+\273\200\005\201\241\031w\003w\344\217\204b\240\213\350 \255fj\251F\204!\333\354)\016"
+	.string	"ek\300\201y\360\261\260af"
+	.ascii	"T\300?0\030\030z`2\300\b\352\200\r\311\211\032x\023\003p"
+	.text
+	.section	.gnu.lto_mixers.112.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`6\003%\017"
+	.string	"\024\026\002\004"
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\203\345\204\005\177}"
+	.string	"\005\001\006\035\001\004\005\001?\202\210\200\030{y\275\001w\274\001u\273\001\005\001\006\025\001\032\005\001\006s\035\001\003\302\001w\301\001u\300\031\002\305\030\274\027\234\236\370%\177q"
+	.string	"\275\312\026\301\025\274\236\360\245\037om\317\024\023\350\245(ki\006\325\324\022\344%\177g\330\021\274\020\017\270\245\037ec\301\337\016\264\245(a_\b\343\342\r\260%a]\343\346\f\254%a[\343\351\013\250%kY\325\354\n\244%\177W\275\357\t\274\236\240\362\001\374\244(kU\364\007\370$kS\325\367\005\360\244\037oQ\305\374\004\354\244(\177O\275\377\003\350$\177M\275\202\002\002\344\244\037KI\205\330\003G3\207\0024\206\002\204\002\203\002\201\002\200\002\376\001\375\001\373\001\372\001\371\001\370\001\366\001\365\0015\363\001\361\001\360\001\356\001\355\001\353\001\352\001\350\001\347\001\345\001\344\001\341\001\340\001\336\001\335\001\334\001\333\001\332\001\331\001\327\001\326\001\323\001\322\001\321\001\320\001\316\001\315\001\314\001\313\001\311\001\310\001\307\001\306\001\304\001\303\001\277\001\276\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"[\250\201\270\"fZ?\326P\223\210V\007\021 ,P\021r\003-s\"\022\200\205I\221\211t\231\305\255O\374\032|\331\026Q(\270q\270&\037_\0377\354\314\375\253X\356\307\274\313\364b\2522\316ZD\204\252\336lT\235\030\b(.\315\373"
+	.string	"?\342\\w\214\363\020\261Q\371^\253"
+	.string	"\220>\316\363\266"
+	.ascii	"|\370\350\263\225\"\314DZ'\257t\360\243\032\0010\303\364(\246"
+	.ascii	"k\324\300\302\304\252\261j\2104"
+	.text
+	.section	.gnu.lto_getMotorCount.121.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 \354\255\006"
+	.string	"b\314.5@o\222\016@\265\n|\272\346\325\320\211\206!\223\367\\w\224[3\261D\361\377f\017\005\253\240Fw\325\3678\003\302\226\213\236S\245\343\360$U\037\255}\262e\nk2\330f\302\342\274\216C\203\365\300\360 \254\005\316\323`\022/3\360\025\261\301^\347\272\260WmYWBG\020r\025\337\220\212d\227c\n\017V+u=\230R\350\002L\027!<]a$\262\374\006B\227\361\275\244+\3758:\201\217\024\205\223L\321\251%Q\250\222\216\377\363\325\007\b\237\263n\033\"\214\311\304bd%s{N\243Y1\273\005\351\305\203DE\033\201\212"
+	.string	"\t\2319j#Rw\375\013~\203\237\024\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_getMotorMixRange.122.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 \376\365\006"
+	.string	"\202\r15PM\223\016\260&\313\346\016\013\223\337\327\246\257)\346\007\303F\362\320\321\027\213\375\357\b\321\363\243\375h!\377\275Yb\212X\301[\270{\252U\336x\254YBd\nk2\327\006\242\342\304\316\202B\305\220\020\033*\004N\324\\\01713\260\345\260\271b\307\262\256HmY\250=\210\371@\211oH\267\273\033:b\3565\253t\347\246J\017\006lX|^\313\324E\276\225\337<\017b|\243\204\332\367\375\340\245\004\345`$\223\242\205%O$\022\216\037{\352z\364\003\373.\3324BM1\231\020Q\311\314\210\251\300T)\352e\252\0043\212\365a\267 \215:\270.\003y\372"
+	.string	"\f2\363\227\201*:\354O\360\027\374Z\b"
+	.ascii	"2\001\0178c`\034\240k\370n\304\320Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_isMotorProtocolDshot.123.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375 \322%\006"
+	.string	"\304\nw"
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\317\265#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\213\253\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}\274\001"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\305\364\001\274\310\332\002\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\262\371P"
+	.string	"\203\003\202\260\371\270\003\006\177\001\200\300\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\b"
+	.ascii	"2\003\202\341\250a\r!0\327p}!^\270s\257v>\001"
+	.text
+	.section	.gnu.lto_initEscEndpoints.124.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\335\003\235\026"
+	.string	"V\350\214J\260\324Q:X\323]t\371\032\336\331\271T\241Z\260\303\020T\354\310\375\fH+:\235\234!\374\325s\210`\251\377\266\277\243dg\206\035\222\363\016z><\301\227<\360\237\200\003"
+	.string	"Y\376\372\252W%\217\376\325~\311'{K)Sl"
+	.string	"r"
+	.string	"\203"
+	.ascii	"$\315\2075\377\305|\327\344\267\232?6\237\305|\221\371\224\371"
+	.ascii	"\223\371\315"
+	.string	"|^\376\n`\250\337\212\025\"\254\325\303\320H\375\321\033)\376\357\353\266\337j{@u\227\204x\222\206\324Z\311>\261\266\245\263\331\366e\275\264v\274\235\245>;]<\237\355\030/7[j\255{\264\334\303\3031\263^j\255\347\035\357\303^\334\377\020\376\023\370gLJ\345N\001\305\330$\n\025ff\304\245*\315\022\2344\373\242\\%\252Zs\007\276\275uQ\363\025Z\372\231\r\375\332\210KW\272\205t\343!\327Zw\372:\342\366Z\301\250\3121\221\267\270\245.M\3747\340\360\356\266uJ\344z\347\260'\037\251\312E\376\036\216\333\304\277\263\366\317O\371+\224\257B\371)\223\217\322\374\223\346\233L~I\363e\315\2171?\257acq\337}\342\322\335\005\031\273\325\r\324]\261Z\326\264w\022\307\236@\335\020\216\207\027\233\325\313s\344\306\303\026\333\243\034\243\366\207 \001\f\214\270Tl\003\374\244\202B)"
+	.string	".X\036;h\223$\246\016\006\302\006\233\243\034\235f\223\301\021\215\303\001\323\203\265\321\324] H\004\373\"\310t\322.\310/ai\224\343\022\367\200 \354\tDJ\177e\354\f\016_\241\307\310\310\210KY\202!n<\234t\302\006\247q\251\225\035f7d\316\205\232\031\006\013d\206\331\314\rIS\303!]\002\234\246\241\254\22194Z\215|\365n;k\377\234\247J\257\320\bE\257tJ\367\304\030\375n\215;\n\020\242\223F\351\351d\322'\315\022\276z\245\326\244)\223n\bWT\",\272\217w'\353\222\236L\272\253X\303Z\326"
+	.string	"H:f\264?\312\261\212\2447*\b\351\325\260\026\205\256~\035-\225\017W\273\004\211Z\375\235Z`Y\2501X\343\034b\250$HaAQ\322b\020\003\231`\250s\020(\252\216\2235\201\241\251H\302\234c\366l\342h\236C\b\274878\372\352]\360\361/\274w<G\022\363\227\227\354A\003 \f-\341J\3441\312Y\030\356\217"
+	.string	"\325)\230v\024\"\327\256J=j\304/\2124\232\241t\f6&\027\241!\251\021H\001\367\\\220h\202"
+	.string	"\036M\214T\njS\3008i\302\177\333\242\237\372\256\353\212\226\304"
+	.ascii	"[\034y7\016`.\245a\325\227)\213\021\375\030\004\244_?\356\007"
+	.ascii	"{7s\376"
+	.text
+	.section	.gnu.lto_mixerInit.125.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"=\t"
+	.string	"\266\021B< \005)\035"
+	.string	",\t\n\240.\260\315T\n\027\0063\253\b\025\006\366$Q\305\005\036\266}l3\326\037\005\306\244Uc\021Q\020\004\f*\006\030\0358\246\027\354\r3O\250r\333-S\n-"
+	.string	"0"
+	.string	"/"
+	.string	"\237\236\023l\237\016m\235\217'{\230\233\217\227\235\335\355\244\311\303k\350\237\345\037\361\305\272\006<\354\256U|\205\334\362\266G\266!l\333\004\273k\t\263/\373u\206jp&j\273 \265"
+	.string	"K\2333*\266\017\262G#\013W\373\261\257\204\227\255\374\331%\211\305\354\216\b>\020\370\024\275`\013.ojop\350E\213\\\222e\235\321\250\364[\356\262\362S\354\241\322\213\237\276j\373\f\241\210\264\264f\235\311\344\254\002\260G\226\312\022\373\236\rv()$04\230<\216\304\rx\245/\342c\022\007z\035'T\227\262\2508]\230:\214\023\005\252#\201\032\035g\340/\303\003\273\324\367\201\035h\334{V\302,1\243\265d\n"
+	.ascii	"-\242\301rE\306^\367Y\023gxK5\035\027\254\255\325hp\227\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_mixerConfigureOutput.126.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\243\f\335="
+	.string	"\332f\234\026B@^R:\365\317\201\306\016\331\r%y\277\032R\244\252i@5\374\314\241\366)\353\2056\354\177\344N\024\020\201\221\254C\330\266\016"
+	.string	"\232\271Z\0203\361\\y$5\030f\030\305o\375\372\267F\b\331;\311V\001@\001b\001\357\231\227M\323\02340\347\314\370q?~\246\3578\274\321/\t\3265\255\260\005o\333B\361m\201;\316\376Z\037\256\375\234\335mB\016\337\311\334\332\177\353cC\201|\255[/{\310\326\336\367\025\342<\231\213\351\217)0\304\331\3751}\266\267\001\271[\3375I\335\336\257\n}"
+	.ascii	"\327\234o;A\361m\323\233\356[\366L\367m_\f\220\356\343\333\366"
+	.ascii	"\b\355\346s\267\263\367r}\266\312\b\276\357\373\314T\230Kb#\317"
+	.ascii	"\272\275\221-\364GL\243\245\262\250\231$B\036\221\206\214E\242"
+	.ascii	"\333\262\031C\373\304\013F\256/\254\037\245\275\241a\346\224"
+	.ascii	"#UnTVw\206\227\325+q\225\027U\337d\231\310\340\200\035\260\202"
+	.ascii	"\223lS]\031\031&b\211A\214\\\371\004B@\273\3175\301H\342\205"
+	.ascii	")G\234\374\370\250\223#\261L&i\360|\356\004\024\340\341\"v\005"
+	.ascii	"\017\0210;\"v\343\236\227\030\023\\d\331@\205m\337\363\032c)"
+	.ascii	"pI\307\034.\b&jYr\227\255 \006L5\371\245\305f2f\360\016w\002"
+	.ascii	"[\274\306p\313B\221\301\001\373\236W\030\333\244\023e\017[\\"
+	.ascii	"\362\234\374\222\262M\357\373^\355x\372\225\2051\361\302\373"
+	.ascii	"\276\215\271\276\216\274\223\336\375\300\356f\321}\334\020Q\271"
+	.ascii	"\037\356Fj\033\340  \321\217\331\233\346K8p\202]Z\376(\345\313"
+	.ascii	"\275)\212\013\373p\177\021\274\303\263\351E\321\332Lm%\265\237"
+	.ascii	"\b\232\265O\212\t\317\304\3733dY\347\233\305\316\263y\332o7\254"
+	.ascii	"3e\231#\313\335\303\315\371\205\325O\212\t\033\347\347\234\277"
+	.ascii	"\005\266\204\223\276\302u\312\317\337\262\313\302\207\335gs\274"
+	.ascii	"\025-\\\270p\337:\345\005\325\260A\247r\373v_"
+	.string	"C\325O\353*\031\370\\2\334\267Gg\200\242\370\2601\336\237\275\027\027v\273e\341L\355\376\023\2267\203:K\351\206 u\353;\352\210\333\301\020\356\006O\250'#n\247\323\275\231~}/)e\334I-n\244\026w\263\305}\324\342f\266\270\215Z\334K\027\267\222\305]\224q']\334DD\334\310\"\356c\021\367\020\021\267\321\305]tq\023]\334n\213\273}\2317\313\342\316,n\314\342\276\004&A:-\314\274\257\221C\303wNk\207\345\326\237\356\277\376e\316v\337)H]\037\235\264\240\312Wj\245J\226\002\201\346\372X\200\020Z\304\362*\312]\233\244i\223\034j\220\353\003\370\343f\372h\214Zo\202\335\37586\307\247\334\372!9\277\224\247K9\2313\350\021\345d\376V\241(\226\022ec\030{\270\224\177\265\303\353b\206|\312\277.\345\247\247\330\227B1\240b\376\306\227\326\335 0\326\224"
+	.string	"\374\262\327\251\3301\03332_\253\213\362\375\306\035\312\307|\255-y(+]\267\n\315\375`yar\273e\275\343\344\306"
+	.string	"\2177v)\331\202\224\245`p\215\371\252\355\206\030\020\360\025nh\362\021\0323\202>6d\236\227\241L\025tA"
+	.string	"g\200\222yen\033\334\2371S\233\312-\346+\253\0362o\254\030\b\337\341\n\214v\206\377\321\360<\003\363\300\r\002\316\336W:\001\360~:\260\037B\270!\334\267\305\374\254\262u\3455A\036\022qS\314\324\004h.Tn6\263Y)O\373\316U\312\031\374\016wv\220\331\205(.\374\3779\272?@\"T~\031\005W\312P\007\226\024\356\021\363\337\271\002\177*\327\315\304|-2?7'\365\205\361P\363d0P\216/\317\235)"
+	.string	"|\375:\2673B\205\3736\377M\305\342\206\240\250\361B\023\367\246d\036\222.eevn\246v\211\356\306Nm\276\231\265\257\233\304\347\224"
+	.string	"\201\305P\032\341\327n\021\2273\205\223\306\350euM\210s\275\023\375\264\267\215BE\016\367m\233\021T\331\002=\303G\025\f\033V-\334\236"
+	.ascii	"#\312\301\003\t1\252\030,\255\336T\f\256\252|X\325x\356\230!"
+	.ascii	"\303\212F\214\247\r+\0275\236TW:\236\f\230\372\006\216\252\253"
+	.ascii	"\347\216\0337\256\236G\267\350\263\224N18'\232\263\272\325>\205"
+	.ascii	"\227\345(S\237\374\214\244r\263E\020rT\236\236\317\243X9Q\371"
+	.ascii	"\326\263L\251|kT\226\032\320\204\220\203|k7T\f\243A\241$5>\303"
+	.ascii	"Uh\024(\025J\205\212\333 ;\300T<\005Z\355\2475\264\n\324\n>\027"
+	.ascii	"\324\212\373\266A\016\320\027\366\366\342\0359\200\203\201\271"
+	.ascii	"M\235\224!F\312gn\375\232\31631\345$eN\252c\312\247\353\223\273"
+	.ascii	"\376-\237\371tL\371\211\207\224\243\230Aif\244\314\376a\301d"
+	.ascii	"cN\232q\216\262\030\2230f>\312l -8\t\030\022\346Q\336\033\243"
+	.ascii	"\374\345e\244\351\336\354\373F\235\226\331(\263\204\264\266d"
+	.ascii	"A\271\340\256\2463p\366\276o\204\356\366\200\247S\002\370\270"
+	.ascii	"\226\331@\225\255\356F\352\235\333``\034\303\300\2512S\033\023"
+	.ascii	"9\217\227\316\377\355\033\256\205\266\350\222\316C\310\323.:"
+	.ascii	"\316\275\331k\352\271R\2102\003\250\206\335%35\357E\007p\323"
+	.ascii	"{\350\027\267\033\032\006\252\206\317U\224\245\236H3V_\355Cy"
+	.ascii	"k\004\2112\265\217~\001\201\b\250q8$\031C3#\"\"I\222\2445A\005"
+	.ascii	"\304 \307\260;\017\022\340U=\210\235\021;ZT(\f\373\033s\322^"
+	.ascii	">\224\324W\244j\245\366\245\036\257\347\001SA\304\300E\017\024"
+	.ascii	"R\207\013\315Gn\3154\202|\275cv^k\270\237)St\001\324>\b"
+	.string	"\024dV\331\237\257;\311\260N$8\005]\306\365\234]c\371\200\261\236C\201\234<Y\352So{O\231\361\257\252\270qL2\337=\217*\275\313\306\274\276\034\267j\007\224\373\331\262\032\347\360\305\272\247\2248\326$E\232\254{\201|\323\022d\b\204\264~\352\030\013i\013\001\242\225\037\016\327\n\235\027\031qd\363R\272\022\225\"\033B\226\363\207dP\300\321ho\327G}\241]&ZhIqM\002\256\343d\202\227\006@`\242\220g\271uq=\231R3\242\254\005\343\34369\211#\314\215I\2551\204>\020V\216\345-\244Y\322[|,\317\021+V\246\304\343l\034\215t\016\377j\255&\310(o\203@\253d\215\362\370\036\214K\336\203Y\231\264r\242\344[\321\334\263\367g\\\275:\314\332\001\235_*\273\233\343V\024\302\304\226\005\263\0328\242@\312\341\211\365\017\0207\270M\023}\230KF\210\257\034\250"
+	.string	"\221\366@\20075I\002\377^\351)R\236\2020QD>;\0213\241\3276\024\316\357Z\234\327`\324\333\3557\272\272\303\004t\337\272m\013\3635\276\357\tk\t5n\360\213\222\032\356\255ceC\200\004\240de2>\264>$.\210_\225\264"
+	.string	"Y*\b\032t\216g\267\266,\024\032\020\312\263\022\331\247\016A\016\242\335\204\311\306\f!T1"
+	.ascii	"\244\177\251\300\002\377m\276\302\021]\327k\013wH\220\270A0_"
+	.ascii	"m\323[!\001\316\315\253K\264CJL\226\004\245&^\327\022J\247D\243"
+	.ascii	"\265X\332\323\336\247\207H\257?f\210\331\305\361\226\237C6\017"
+	.ascii	"\33728\240\216\206\247\336\306\207\032"
+	.text
+	.section	.gnu.lto_mixerLoadMix.127.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`@\004\225\035"
+	.string	"Fv\276H\240\232Qc\270\227%\256u\367\034=%\235\264H^\345\347\320\371\242\365\032\272\217\r^\265\034\311\200\255m\274\251(\030\322\356\322\206#G\032x9\306\013\343\361\201\370\362\242\235\r#\006C\335l\352~F\322m\367\336R\246\024\245"
+	.string	"\240"
+	.string	"\252"
+	.string	"\350M\017\321\033R\372j_\310\207\364.\364\321\257{k0I\335{k\314"
+	.ascii	"\2759\363\332y\263<\355\274\351\236\215\365\341\322}\2240\310"
+	.ascii	")\353\336\233Z\033O>\351\262\354\345\360.m\357\250\353|\231\245"
+	.ascii	"\255=\237\370\n\003\353\347h\351Z\321b\307q\264\266L\335\b\254"
+	.ascii	".XS"
+	.string	"\321O\264\350\257\222f\244\244\352\306#\240\n\306(\033T\365\220q\342\021\360\b\032U\263,\277l\021\001@\264\242\234 \364+2D\004T\313\246\027\267\177zu\202\205\230%\t\321\213W\227\205{\257\253\020\221\213\033v\333G\333\033\354R&[np\031;\263?\002\217\200j\322\265(\3010]n\335\262\207?\325*\331_\300\204\314\262M\262m\265\033\371i\027\336\263\013\177\231\027o\331\235\356\330\253af\365\253V\243e\265\313V\237\266\332,\253\313Zmmu\265\325\037p\343\345\210\206\016\"6\313\360\266H\212\271V\314)\246\027\177\247\233\321\350\330\r\311\314ox\2118\\\031\205d\335\200\244\376\021\377\311\261\333\220\324v\362\021\375\t\242\305(\250-\367^\232\233\326\200\336\2541\373\226#\255\303\027\351\335\210\212\317\356M\232\"u\357\260\306\027\002I)\316\322\202 \332\2707\321\261-\335\373\273\261\335\341S\271"
+	.ascii	"Z\356\375\341H\235\t\211rGw^Hgm7\204'\036\206l\2422\255\222]"
+	.ascii	"V\326f\255U\245y\314\016\371x\306,\006\253_\325\252\022\263\026"
+	.ascii	"|u\353\345\275\367\2266{\247\230\265\331\003\217\016\314(\242"
+	.ascii	"Zb\273&\260O\\\211\227\030X\272\367\336\370P><\001Zr\334\364"
+	.ascii	"U\2347\025,eUK\263\326\036\350C\346F\236\267\325\036\310#fo\353"
+	.ascii	"U\320\030_MZ\2064\242\272u\313Z(RI,\254i* \375\351\345\217\032"
+	.ascii	"\025YD5\263\027~\306W\003\271\363v8\237\\\206\035]\017\017E\216"
+	.ascii	"\3148!\0368\200 A\004\316f\346\203\013\301\2233\235c\263\303"
+	.ascii	"\371\344v\322\236\021:\271\022\"R\236\334\207\2354g\307Km\bX"
+	.ascii	"g\002\267K{t\272]\032\033\336\333$\024\031\304\212\317\002\241"
+	.ascii	"V\311\001\204\316\2325q\274h.\303\"RyY\230}\320\030\333\303\221"
+	.ascii	"\037j\244\344\024Dy\331\232\033\302\022\214\314\276x\255'0M\\"
+	.ascii	"5\373\242\314\326(\314\350\361'&r\",\371:'\024\017\317\200\275"
+	.ascii	"\032\222\341\243Y\324\332(\240\217\323\226\326u$7\355)\263\246"
+	.ascii	"=\217Ac\214G\277 \221\302t9\225d\220\313i\225\374\027(V]y\331"
+	.ascii	"T\2501\030\2071\350\230\231\t&\232\321\264\260\305p\002\031\243"
+	.ascii	"\262\016\020hI\242\2441\026\323(#\335\036\332\367\206f\022\251"
+	.ascii	"}(\0068:\306\310n\247\301)!\312S3\230'\276/$\266*\346\304V\262"
+	.ascii	")\226\031\332\016\325lQ\03157\002\352\177\314\222\252&33\355"
+	.ascii	"\236\025BF\205\nF\354h\341pZ\257\201P\377\310-\262\213K\344\360"
+	.ascii	"GX4?I\310D\206\024[7\324{Zn\340ok!I\300T\274A,\355X3\274\307"
+	.ascii	"\250S4\006\345o\005\317n\301\270\320\227\224\352\273\265c\303"
+	.ascii	"\355\036t\334\2102\317\023\212\241\303\303\344\204\326\255&S"
+	.ascii	"p\376\362\224\n"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.128.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`r\001u\017"
+	.string	"\226\335hF\340\262(\035NEAT\340+I%\230\036Q\307\262Nb\300\277B\240A\202\364$\271\363 \034"
+	.string	"c\177\315l\3356\336\342\234\262n\253\202\001c\2141\206\210\215\004\261\226\356\244w\254J\263=\321\271%\177o)S\nR"
+	.string	"S"
+	.string	"T"
+	.string	"\376M\313\036\271e\367\370\247b\277Ck\311\001\332]NSx\344\360\273a\266\036\241f\313\2679\thF\027s=B\030\204\346\001\210}\200\021:\026\234\177\317\227\030,\341\212\230\353\277/\360!\244\213\305<7\223\335uv1\230;t\333+\333\022\354\267\b\263 \237M\232\375\271Rg\354'\250\231\001Ye\366v\357\326L\347\323\027\035\200\311\241\322\261+\242Fd{b\215\232{\277}R\210\322q~3\"\271\224\354\177\276\213\277h\3353\217\3105B\244\263S\344\307\356\226\036\255@\364H\362\001\241Gx\001\241\307\007W\335\364 N\300\262f\004&\202|\324\266\312uR\004v\354n\211\237s\031*\237\346\321\034X\254\016\3105\365-E^Y\263\017\3431:\3704\366\260\222\357\036\375\225\320\343\325"
+	.string	"\217\022\257\254ydVS\265AC\346\242.\375\336'\240x%\315\377\016Y\310d.\261\340\240\301\003\b('S"
+	.string	"\324}bZ\235TP).\005\303\005T\006\024N\003\252B\212;Y\2618S\001\2536\234V\\\212J\265\342F\337^e\267\271\350\006\211\236\227\302\242\316x\373\321M\365'KW}1OH\225\302\017K\016\301!\243j\362J\332\341\356.\334\364\336I\030\004\035"
+	.ascii	"r\311\"\323\232Os\223$z\377\227\205\270\203\204\3460W\303_c\032"
+	.ascii	"\254L\254K\212\255E\302\b\007y\2312l\027+\300\304SV8ea\305\346"
+	.ascii	"\226\256DY\235,k\007\356\342\260\210\262\027\252\032\357'\221"
+	.ascii	"\3165\237"
+	.text
+	.section	.gnu.lto_writeMotors.129.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`&\002\275\022"
+	.string	"v$}H\320TQ:\340\363l\021\262rv\0340\020\331\263w\325\030\301D\024K\030\344\007\005\336)\253[@\035\354W\373w\332\355\224\004\263\017\255\360\304\001\251\031\344\326\n\375\005\202;\327\2458\003\207H\025p;\b!do)S\nf"
+	.string	"d"
+	.string	"f"
+	.string	"BC7\2709\347\351\322\b\276K\323M\272\313x\002\335\345I@\036\366\314\017\331\324\004\025\231s\242\366\204\001<\206wT\327e\334N]\276\227\002\316h\257\313\350\311pP\224\320d1\225\303\021=\214i$Q\221\363\375r\336\205\327\033\232,\232\346\234\007\272\332\320hT\275\2249\247uF\013q{\267\355\262\r\301V\225\335\027C\f\0373\232\363\247\266\007\030\375\354\333`'\266/\353m\304\216\251Fv\370\322\255\3317\356\306\220\"/\217]\212\352\222\333n0\252?\251\366\242\272\223j\031\325q\325\253j\275\372\003\f\260\320!\303cN\234##\263H\022\245\270\355\267\177\202;\371.\374\320\244\223 \247\2778\f\327m\306\361\275@|\001F\217s\316\031\267f\273\264\267\335\004S#'8\270\245=\215NL\217\254@\207D"
+	.string	"\215^Q\351g\336\221\355\313\340\226\254u&d7\356\177\350\356\276\346\bL\217\\>\243\345\233s\246|\031\017Z\371?\227\336\300\222>\253\273\324=\320\203\b\246G~\370\337\334J\254\303\327\227F\016\031m\267\346?\325\223\303u\037\002Ne`\260\300\301\003\026\025\212\200\325\275\202\322R\311\254X\250\030\r-+\027\026\024\207\325\005\026j\245\005\203B)\340\227\016\252\026*\346\345\245\205\"\205\363\313c\013-\212`\033\263\211~kK\230`\232\331\227\275\375lx@'\271\255\220[3\311gK+}\272\323\301\265\001\267\333\b\267\031\315Yn\367\032\027\242\340\377\270\202\212Jw)\027\024\021\211\230"
+	.ascii	"\235\002\323' @\002\342\020a\017r\262\f\266m\236\f=\252\026A"
+	.ascii	"\234\023\315\374\202C\350M\311r\213\375\317\264o\221\271\253"
+	.ascii	"9<\355\266VZ\312\036\316z\240\255\021\334\376c\025\213h\205\265"
+	.ascii	"\221\254%6.6pL\3551q\037\312LnL_M\026`\346\217\245\274pc\017"
+	.ascii	"E\006\033qM\237`\342\017\252\f"
+	.text
+	.section	.gnu.lto_stopMotors.131.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\235\002\345\024"
+	.string	"\226\347\210J\260\322U:\242(\266\024\3168I\224\233\273\324\023\264\364\177\340I\206\234\372@\204\004\230W\315 C\263\244\277\247\372{\355\316U-\275m\250\357\343\226\235\303\217\235\255\263\247"
+	.string	"\254=:\260\360\360\333\202\370\237\354\224\244\221M\266L)q"
+	.string	"o"
+	.string	"u"
+	.string	"\266\373\334T\342D\224?!\020T\255\225u\352\005\345\351\311K\310\323\361\006\310S\237\310f\257N\277\362\315\006r_\257^(\204s\024UkmM\024&\371\350\273\307\275\235\216so\376\320\023H\005\331\361p\247\243\352F'E"
+	.ascii	"\336\315\350*B-=\370\315\341\351v\\\261\363\371\340\031\024\205"
+	.ascii	";\336\316W\305Rk\365\356x#n\362\266glK\260\367G>\335\316\037"
+	.ascii	"\373\256^\021\312\323\307\236\353\222\\\253\016\004\336\224\256"
+	.ascii	"w\\\237\304\244\330\243&\254Ug\212Hu\242K*\016\374\355\373F\007"
+	.ascii	"\372A\257|{\222m{\013\377\327\262C\250\326\272:\265}\373Qm\254"
+	.ascii	"\275\tB!\024%\326\334#\3710\036\303\366\243Z\205\222\204\016"
+	.ascii	"\217\203S\257\224\247\003\026\345\006\353F'\362\213Pp\260\354"
+	.ascii	"\027\371.\376\"*\036=t\0368\326Z\353H\316\003\177\322\340t\222"
+	.ascii	"\363 xt;e\005<L\304\232\323\250\t\350\325Z]\276\3603b\374\240"
+	.ascii	"S\307dd\310\323\022 \023$\303\246\371\263q\303\233f\375\300\257"
+	.ascii	"\234\310\005?\262\350y\322\001\f\231\210\365\367\207\030\022"
+	.ascii	"\371\330y\244\233%\267R\376\334y\234\"\276\322e\310\374 \317"
+	.ascii	"h\366;\032\362\364s\244Dn\247\274\303!\304\272Rv/\331\332\245"
+	.ascii	"A\345\001\204\b0\260\024\002\261\373\225B\203}\210\311Z5\033"
+	.ascii	"bb\034`Z3\261\027Y\353E\363\320JA\340Y\007\030\255U3\233\321"
+	.ascii	"Z+_\356\323\307.RN\271\251\363\201U\271\005\322n\271`3q6\211"
+	.ascii	"\"V\037\351\037\272\213\020\247\002\353'a\310\260\337\371D7q"
+	.ascii	"9\350\374\361\310\323$\347|Z\326\351\314\261\355r\322IA\207\315"
+	.ascii	"\026\255\232%\323k\274\274`0\36243 \200\002!\242\273\003\262"
+	.ascii	"\263\004\255\231\243\035\262l\004\t\032\326*\324u\b\325\037\203"
+	.ascii	"\320Q\347\271d\213\237\325\315\004L\207o\364\302\002\263\244"
+	.ascii	"\352\322\302Z[\0210\222\035\272rc\307N\025\335\343\324\320\n"
+	.ascii	"\256\r\003x\204\002\242FI\210\212\207}\230\325\026\"9\202\021"
+	.ascii	"\216\230\266\001\230\373\216d\333\275\335`\202\224C\300\275\254"
+	.ascii	"\312\227\244\210\267\205\232\370\375\210t\256\376\004"
+	.text
+	.section	.gnu.lto_stopPwmAllMotors.132.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\255\007"
+	.string	"\302\01656@s\322\001C\244\301\024\271\312-\033\005\200\340\335\212K\322\031zM\225O\231%|\326kZ\253\023\310\036\263\327\271\f\003\242\002l\235\273\007\255A\242_\2114)S\n\376x\"\210\002bO\304\260"
+	.string	"\035\024\336\003L\300\336'\206\236g\300\031\004(>Q\226\305wu\373\315\352\t\241\003ER\013\013\344\325rh\331\rXg# S\355\210P\2363\301\205n\276\246\276T\343\227\334D\302\027\361\304(\317\275\362G\326\253+\307\203\224)\247\213\006\314\346\214\335m\251\037\3667\253';\323\371\364\255\016\307KE\312.F\212fQ\025\313\210\355_\326\354\230w!{\225\223\022\212\314\356>\005\271\366\324\374\223\234\303\231\266'\300\301\356:9S\306\255\267]`\333\300\366J\013"
+	.ascii	"3\241\251\037X\312\334\260S\r\003\037\226PV\273&\"\f\201\274"
+	.ascii	"\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_mixTable.133.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`e+\345\257"
+	.ascii	"\n\0179<L \006i;c\227\314\230\272>\355\325\325Si\230\213\254"
+	.ascii	"\337\024\b\262bl\262\273\374D\254;\303\240\332\031x\033\305w"
+	.ascii	"\214\032W\340rG\350\347\252\234\267\027\335\177\307\017\332\271"
+	.ascii	"\322xib\t\n\200h8s\335\320\217\tOA\233\244\224R\262\003t\003"
+	.ascii	"\262\003BM\347\240\316\322,\241\373\232#\3708\0035\235\177\232"
+	.ascii	"\316>M\347\247\323\331\351t\356i:\3634\235]\247\363N\323\271"
+	.ascii	"\351tf6\235u\236\316K\247\263\322uN6\235\277\307\331\227\316"
+	.ascii	"\335T\032p\356"
+	.string	"\315\215\t\340\253\321{\253\221s^Ce \023\017k\237\266\177uc\351\316\322\335\327\275\245;\260y\274\313t\013v\243\351&\354\036\346\256\272\030\373\230\223y\231\222\003\277-\022\031\025\251\314\303\030k8\347\352\350l\217`\354\"I\303\350\256n\266P7N\374\203]\250\"\213i q\256Z\266\356\345\257w\271T\307\003>\b@\346p\3549\375\330\354\3423d\304\332-b\355\314\024\2731G\004:\204\216\243\003\002_\025\306D4\306\304\243\037\213i\222\300\026\323\020Y\331\340`\335\261\fs\234\\o89:\313\330\244\336k\027\201\217M1\007\263\273u\323o\372\003\235\256.q\264\211l\346A\263av\031\253\r\271!\320jz\215N\227\227\270\267*\332D\016\264\211D\207i\210i\242 \246\021\332\363*\223\243\357\337\233\264\233\223X%NR\022\247\246\367!VgYLR\357=\003*\002Y-\003b\313\364"
+	.string	"\213\331m%\263\367\232\257\375\232K{i0\335A\213i3}\246\007\273\220\335\243\016\b\325\024\242a,\263\313L\250\214\211\031/l\004y@\225\357\033\367\226\307l\345\021\343\230&\023\3552<\240R\275\327\314\001\217_\232\t\263\225>^mz\212v\030-h\227\336[mz4\354\270\266\300$\325#\200\215\215\366\227\036\3146W%\333~\ry\234ti\300\334\265J\325\225\277\326\022\355-\030$\337\277\344\365J\223\367}+`\266\362_\021P.}\214\2056\337\267L\333\027\031d\2620\266_\264\327=\330^\377\266\357\373:p\350\324z\315A\264\261d"
+	.string	"\375\322{\317t\366\330\376\252\304y_=\017\255d\006\230\255\204&\217\374\234\332\231\273J[\211v\236\217\376y\3379+_\336W\017\004s`\266\222\365:h\331JfGX\266\222\243\314oZ\217\356m\254\0270\2768\357\373.\375\221\247&(\363tR\257\331H\031m\022ONP#\232\230D,\205"
+	.string	"\361\301C\007\016\033\2244$e\300p\001\tz\024e\301\250\250\002\021\205\tCBA\022\""
+	.ascii	"\375\370<\235=<\356N\223\251\263T&\337\243\334\030\334\260\324"
+	.ascii	"\263\256&\361\246\215?\271i'7\r\365\346\003\037\301\246\013\273"
+	.ascii	"x\323\232f\322\266\bm\242/\025z\210\273\254\031\241\203\320\336"
+	.ascii	"\231\r\372\007m\022\212\306=t\020l\016f\330\b\372\006$9\2643"
+	.ascii	"\255\204m\r\311\016\200\311\240-\326\223\312x\361\f:)\222N\250"
+	.ascii	"W9\2645\215\201K_Hv\330\222\f\252rq$.`W\034j\004\355\257\217"
+	.ascii	"Z\372\327QZ\2720\216[H\352\374\250.\351\254Y^2J\3166p\211\033"
+	.ascii	"\031A\263\322EU\272\002^\025'\332\240)$\2116H&\375\240\342\023"
+	.ascii	"\246\364\020\223).\344?Z\306U\013\brhV:HIKHv\330\202\t\241\263"
+	.ascii	"fJ\222A\325%\324.\264\363\bI\032\b\211{%\361\237\272\366\241"
+	.ascii	"\203\254\363'\\;\223\035\336\320h\320Y\263\267d\220\007E\332"
+	.ascii	"tc#\335\231\301y\017\017\222\273\3236\304\233L!I\350\235\031"
+	.ascii	"\233\353\350\244\220C#\322K\260\251+\325:\351<\373\341\236}\371"
+	.ascii	"g\315\334\222\320\367}\273\260]\354\314\313]'\305\373\276\354"
+	.ascii	"\3243\264\346\022\315\234\034\301\334\0240k\370\013uaW\200\224"
+	.ascii	"\001\362EuV\300\306\024\001\373$-\033\336\364\350{\372.\306\302"
+	.ascii	"\027\375\321+\371\214\336B\230\016\214\236D\205/\002\363\245"
+	.ascii	"\302[\320\006\376e\251\360\220\001Z\311\234d\337\t\256c\\\216"
+	.ascii	"\214\301\211i\251\023[\236\031\306Qt\205\234\371\235\275\222"
+	.ascii	"v\315\214\347\333L\255\372-\310\307\244\232V\266w-\353\304\354"
+	.ascii	"\331c\361#\263C\364<\024\236\210\003\n\257$\001.\262\371\326"
+	.ascii	" W\254\f\030\344Qm\302\267\232\373C?\341'4_\347\207\034\205\254"
+	.ascii	"\b5\246}\013\342\035IcD\373.C\245\016m\221\371V\016Z\262W\030"
+	.ascii	"\364:\213\3237\257\007D\2325*\3528\013Ah\373F\023\305\24506\t"
+	.ascii	"\0032\340\262\225\335\366J\332\302!\337\204>\337C\336\027\247"
+	.ascii	"\333\347\353\274\317+\3238\377\251\304\2378q\376\211\272\274"
+	.ascii	"\301\236\353/R\025{^\351\005\f\362\f\333\267 \023&lf\262\275"
+	.ascii	"\366]\246\241J\242\327\025\275\366\026\352\330\234\205d\262\313"
+	.ascii	"\267\276\316g\355\r\272\337|\236\327\341\2336\331y7\352\304\223"
+	.ascii	"\3249\222(\024)Q*Q*\313V\356|{a~\363\210\021\346;\325\345-_\347"
+	.ascii	"\033\fR\352\221!|.\212\307|\3377\212]\316\213D\255D\257\250P"
+	.ascii	"\261l\345\362\207\264\201b\224\312g\207\3638\0367V\254X\266R"
+	.ascii	"\207\217\252(\345\005\234H\003\314\367\375\"\301\336\346n,\270"
+	.ascii	"\355Z\311-\\\270X\266R\371\335W\227\327prN\352\333\231\244\321"
+	.ascii	"\322\307wa3\025\367\264\3116Z\372\373xv06/\217d\366 \276\366"
+	.ascii	"\202\333\216!\210\341"
+	.string	"M\215\361FZ6\251G2O!\230l\221\006V\244<Z\367\323\330[\363\345r8\310\241og\260d\226`\2067\265\177D\334\327wq\220\343\266Q\361m\255e\207\3517kl\362\343\370\327\250x\024%\353\205P\262/\232\326\212\223b\231\33114aC\305I\335\221\203\034\315\032\025_wd\326\363\362\2672w\024\235\2347\374s\314=\005\312\223;%=\316m\207\244\215\364\234\2075\267\234\353\334qM\347~\353\274\356&\322\201\315\355\3266\204m-\210Z\032\332\231Y\265\214lL\254\303Z\260\271\2014XO\233\316\\=\316>z\234{\270\316[\256\263VVci\346\341\323\346\035\376\325\214ue\245\243\373\232st\231f\013Z\260\271\252\3214\343h\302\346\033M\330L\365t\236r\235m\270\3165z\234i\3708K\3658W\360t^\200\323\231\202\246\363\004Ng\0054\235\023\360tF\200\353<c\351|"
+	.string	"\327Y\202\245\263\001\\\347\002\270\3162z\234c,\235#x:C\320t\206\361t~\361t&@\323\331\305\323\371\201\246s\013\247\363"
+	.string	"\226\316,\236\316\016"
+	.string	"97"
+	.string	"\344\314\300\217\363\002\256\263\002\256\363\n\327Y"
+	.string	"\256\263\n\3279\205\353\214\302u\016\200\353\234\200\353|\242\351l\242\307\031"
+	.string	"\256s\t\3279\312u\206r\235I,\235\237\\g'\327y\204\353\334\344:3\271\316\"\\\347%\3279D\2173\b\327\371\203\353\354\301u\356\340:sp\2357\270\316J\256\263\006\3279\311u\316\320t\306\320t\276\320tFr\235\241M\347\243\246\263\005\247\263Q\323\271\350\351\\\241\351L\344t\246\320t\236\320t\036r:\007\200>HU\374\b\177\242\311\241\230\354\273\265\360Vn\256)\372\321]\235\ny\013\362\320XVJ[\202\276\253\257\212r<Y\237\220\262\240\177[\307\213a\275\211_A\b\2007\021\344\333^p1\306"
+	.ascii	"\3007\331\244@qt\\}"
+	.ascii	"g\301z\377\352\310\310\310H\243\n5\236\211\256\336\352\3058Y"
+	.ascii	"A\307\027\365\265\001\022\225\370\034=\345\375\253\261\276\247"
+	.ascii	"|O\337\274$l\017\323r|\367Y}g\361\242\253/\3615\364\016\361*"
+	.ascii	"\274\225u|\tf\211\027\222B\024%DU\324z\250\217\372\3672\275\363"
+	.ascii	":\274\372X\0339b\024\336\312>4\007\325'\204P\210\261[\r\320\372"
+	.ascii	"\254\277C8\250o.\214\225\340\026\031#CU$\361M\017\365\026\212"
+	.ascii	"\214\251\331z\247'\361\235\234\360V\357C6X\374\206~\356\351?"
+	.ascii	"\217\253\361\323\270\034\377\354\321\270\036\271\"\243]]\313"
+	.ascii	"V>}w\321\216x\247Oz\361\372*c\237\350\312\242aK\211d#\276\303"
+	.ascii	"\260!62\375\3227\275\205\303\261B\021\317\364I1?^\214\261O\211"
+	.ascii	"\324h\230\023]\230\210\3571l\210TB\374\322'\007\247w^`\017\306"
+	.ascii	"X\022t\314\\q?\215\2069%\266\222\377\353\177D\305\310\242\325"
+	.ascii	"\352\262\225!\276\313\260\245i\374\371;T\363#\363\243*\364V6"
+	.ascii	"\261A\004@\t\035\367Z\036\022\210\223\376\350$\024\271\303\264"
+	.ascii	"\354\233\2451\210\223\3665T\r\263H\255\357.\035#\031\004\345"
+	.ascii	"\314\321\264\250Z\334\017\340tM\257q\353\365]\r\264E\016\236"
+	.ascii	"\004 \033\357^W\307\352O\322\367\335\213q\277X\202x\347\2335"
+	.ascii	"\177|\301d\202x\022uy\215wr\034\001\231\255\304\300\273\374\215"
+	.ascii	"\204\233\256\231E\350\360\037\336\206{\001\371\310\370\206|&"
+	.ascii	"}#\371\340^.\355\360\336\345\357\207\357H\017\377\341\177qz\267"
+	.ascii	"\350\214!\260\230e+=\274\2236P\210\303a\354\021]\233\016\177"
+	.ascii	"T\227\007\007\311\026\004+ |\314q\22437]{\1778\274\fH*Y\237\267"
+	.ascii	"r\2141\316\002|7v3\256\203\274\236\244o%\034 \037\3478r\370\226"
+	.ascii	"\263\3419|\222\017\204\273i\263\341\237\264\201 (y\355\232\300"
+	.ascii	".7\354z=\260\3331[\331`\030\313Q\255\314 \216q\021\256Om\333"
+	.ascii	"\270}fx\245/@\223Q\247\300]\025\223\324\"\020\202\363\255\374"
+	.ascii	"d\263\366L@\312\336\270-\006\027\366O9`~\314F{\013^\354\331\206"
+	.ascii	"\355\231\302\252oaz\006\351\366\330\267\341\365\r\310?\253\216"
+	.ascii	"i_\365b\317\017\332\236I\f\314o\247/\355\315m\262w\273+\021\260"
+	.ascii	"\217\360\001d\220\307\361b\3177`~\313\036\362LT0\277\2356\373"
+	.ascii	"\241iZ\231\353]\272\351\256n`X\236\236\266\300>\202a\231\255"
+	.ascii	"\366T/\246\364IOc\217\260\033{g\013\2248\335A\2664\201\273\302"
+	.ascii	"\311\360\315\230\364\275\250\364\r\307+\254\315\020Ed\344\033"
+	.ascii	"\r\257\364\3778\275\363\372\340\210\214\205\200\247\351\321\026"
+	.ascii	"%Bd\331J\r\377T\027\230\341\223\276\247\212p\236e\354\021\tv"
+	.ascii	"\017|d\211>\240\335$\276\357\333v>\226\255\314\360G\332<\032"
+	.ascii	"\204\033\262g\334\276\0031|\273\275{\231n/<\322c\370\2366\251"
+	.ascii	"\372\013\026<\322/\0077d\311\314\370&<\323\032\370`K\3603~\031"
+	.ascii	"\202\0276\364%x\366i\004\274\260\375\276\257\2241q1\215\204\251"
+	.ascii	"Z\\\343\026\372P)\325C\337\371\246\202^\205\335tY1T\337\2048"
+	.ascii	"\276\321T}\013Z\340\356\030\2469\205\264'\354\273\214`ML\"2\370"
+	.ascii	"lMiQQ\275\330\252\262\252z \002\216\033U8\222\r\300\322\361\214"
+	.ascii	"#\204\026\216-)\253\245+,++\254\032[VR\277\305\274b1\245ck\013"
+	.ascii	"+\013\207\214\255\253\251\254\254\0365(\\U] \345\302y\205U\245"
+	.ascii	"\2255\305\200+\026\316\251\033WR\021l\365\330\261\325\343\205"
+	.ascii	"\017\225\002,`hU]\240\302\306\224\016\251\032Z\316,\254\255\032"
+	.ascii	"R\f\\aUmIi]M\355\260\302Z\261%E\203\001B\314\013\244\256\252"
+	.ascii	"\\\\P\345\"\013k\013\313\312\255j\216\262\321\304\344\004E5\025"
+	.ascii	"\342gJG\025\025V\026\f\033U;v\270F\210\254\251\013\252\254\226"
+	.ascii	"\266p\334\250\322A\265tU%e\265T#Kk)\004\021c\355\230\312Z\332"
+	.ascii	"\302\302\312Zr\365\244\375sL5i\206\322\367b\f\222\357+\207b\213"
+	.ascii	"\305#I\254qj#\257\244B}\221\316\312z\240\302,\177\337\267\353"
+	.ascii	"\311\310\177\351\254o#[D\307\251\0274\343\213T\305!O&\212\307"
+	.ascii	"\034#\206\213\315\324+\325=:\275\225{\n\324\317qP\337uI\223\324"
+	.ascii	"\003\275X\017fvOK\343"
+	.string	"{\204\241\361CZ6\304\306\021H\230\372\311\377\026\f_\244y\360x\251\n^*\260\202o\262\221\341\361\215%\331\364\326'\337X\032*\355\f\226<\276\237$\277 \2529\323\002\260Q\274!@\n~\001](x\243:\266?\304\301\245\220\307/\021o\345\t>\001\337r{h\024\360\023\374\226\327\242\200w\322\"\340\023\360~Q<&\337\367q\2211\303u\346\314\262\225\b\370\"\355\031\036'r\302\226\016\360=\212\203\007x\235\263\237\240&\002g!\f\360<w\256A\033\340\227Wg.k\216T\020.\244\333n\007qo\215\263u\214o\273\347 \306\237\320\366\207\b>\313'\2027\001E\317\003\007\256o6\033.|\277A`\245\312\333C\240E<\204\362v\200\361\\\034`\374\0056k\264\027\276\021a|\037\276x\030\033PyQ\326\007\345mT|7\274\225!\210\242\341\277\267\335\214\003s\346XMj\361\r\205"
+	.ascii	"R\242xAQ\240<\001\336\027\373MC\335\264i\267\251\023\303\306"
+	.ascii	"\255T\tI\255\2030\tAM\303[\331\305\267\330\366\316\226\263\017"
+	.ascii	"\272\325\374\346\300]\341 }\277i\361\355\306\305w\233\206>\360"
+	.ascii	".\376\371\300 \377I\024\217\351\344\201W\322\006\016\340[\374"
+	.ascii	"\225G\341\212\001PUID\224\362\227\364V\026\237\265\267\346\205"
+	.ascii	"3s\035r\245\361\246\262x\023q^\337\305TO\262\357\037\""
+	.string	"\221\254\003\277$\212\367\244{\273W\302\245F\313\305\306\233\312\305F\fU\261\201w\200\201o`\201g\340\223\203`\220,\\\201g\346\372\200\013\204eS\027x\350\327w\255x\005>\351fz'\200O\361+\236B\232\351\333\215W\361\002\370\n|\\p\276\216\261\335&\321\355\351\242a\255\346\210\212\3576n)\276\273\324\215\365]\2334*\236e\210\202T\005\343X\275\220\374\240)\334\033\364\306\027\351\306\322%\342\244\210j\331\f\226\215\245\023\210\243CL\313\336\370\024d\r\035\023k\247v\007\231\302\3515n\245\030f<\212O\366P\251<\337\n\217\\x\353\214\247\261\207\306\253^\206\342\235\314\307\032*u\261\206JQ\274\247i\224{\017kh\262\345\276\251\214Cbc\334\220\336\312.\222\243\236{%\222(\017\275c\307\377$\031\345v\274O{\t\365\315\020\372\326\271\367\351\216\3579\345\227\3033\001x;\361\t|"
+	.string	"\376\275\274%"
+	.string	"\326?\211\207\203?v\364V\356F\"2\027&\312\350\352%\030\351\370\b/\266\326'\344\315\310\304\377\274\330\211\r\207fN<{\224'\302\330E\016\203\311\250\322@%\020\243L\231\232\021\021\221$I\322\030b\013\020\b\"Q\230\266\3646\022\240SI\213\203\214)\032\021\221\024\244 )\354?\007 9\344\211\340e0\212\352m:\245Y`\202\302^\305\2576\016\252w\037]\021I\335\346\325\354\346B';)\"\343\314\257d"
+	.ascii	"%\016\306\200\371\364\320X\004}f\f+2\227\232\241\205\301\023"
+	.ascii	"\323]\224\366\326Y\360\025J\250\256\f@\315\231\025\004)\020X"
+	.ascii	"eT\330U"
+	.string	""
+	.string	"\245gQ\224&\246LJ\374\371\005\324fg\242\303\206)\204]\211\223(S"
+	.string	"\247,\340\340sm-.h\245\331\003\221n\222*@>\372L\3671V\020Y\252M\304\332\026\344\317\\x\311e\036\270\274\230\013]C\030\303\3639'\024N\036\310\310\206\355?2-\235"
+	.ascii	"\345\031\253\363\nu\365n\313\t\324\360\215\371\b\314z\023\231"
+	.ascii	"\243\2232\031\037\200\324\n|\224)\264YBCV/R\207\354&\f\336s\223"
+	.ascii	"<\355B\3029\224=c\214\331\345\030VB\003\255\305\270\367\030\233"
+	.ascii	"\337\346\213\270\240\377\032&\212\3418\345i\211\300\240\366\223"
+	.ascii	"\361\277\215/\316\3102\022*\360Q\177B\003\262\223\213\r\306\201"
+	.ascii	"\310\274\356^\365\362\300Z\263+\365\007\347\nP*y\212+\360\244"
+	.ascii	"\3012"
+	.string	"\344\025\373\247\007=\002\277Ub\315\306\001\223L&'\265\2778\246\035\036 |\252\003\242\323;M\264\267H+z\264N0jk\213\023K\245\f\027m\334\201R\310\247\263\f\367bI\025\352\254~\320\307\200\263\214\f\020\346\373\356\004}[0\341\376:\311\376\357\231&w\334\\V\262\310\221\254\262D\2249U\346f:\215\372\234I\364B$[i\\Ed\342\320\"D\341;w\224\273\205S\032\036>\354\0162\204]9rtP\351\034n\253.\224\211auj\354\365\372a\315\263\306\244\374\354CKDe\003\200\324Q\270SO\351\365h0\360+\360\340\242bM\202\254%\340r\227\362z\312<\212\021e\301\342<v\217\374\177\025Bp\326\215\313\021\215vW\255!\244y<\340\t\326-\033)\n\266\005b\025&\227\030\305\013\017\277\205t8\t(y\335\221/o\220\236\260\200\311\311\016\2176\342diT\026\272\325"
+	.string	")Y\262\206\030v:\035#\334@\327\327\364t\354\343\0338\004\362J\017\345\245\022\245O\020\350\237\211J\330k~@\033T\233\231\362\346z\233\247\336\302J\274\211\251\221"
+	.string	"\177x3\232!f\266\252\202\210\214%;\212;n+r7~OlGc\002yDY\032\344}\262\207(\273\016\204k\033\024\366\343\370\f,X9@s\021\234\317\356X\321\351\203\265\200\356\"\215{\0351^|X\215x\255\002\235h\214\213\220\366\024v\021\215\f\302\224\032\316\2668\001\007\2071\330<\336\247\031\252L\337\311\376!\355\251\346\244q\360\362\340\323\006\371lF:\364\017\226\207\027x^Z\264p\314\240f<Q\245\377b"
+	.string	"\034@\260\fZ\177\3320\247\201\213\0344t|\375\261:4\255]\325\252\030.\253\f\226a#\021\371\240\237\373N\325\357\206xmW\007\256\273\276:R\303&Y\256\331|%]eM6\013\241A\215\345/\347\373\334]\224&\312\216\206\340\022\213x\327x\231\330w\351\374\001.\245\354p\247\316\277sQ5\024\\\021\3165~Xx\023\336|O2_0\201\036\245\007' 9\375\316\030YR8\022:\315\223\277ciY\311\201\271\3023\031\356\231\003\344\bH\304\210!\336.\323C\270%fD\324\344Do\315,\334\226d\275\026\007\326a\254.\270\257\020'\257"
+	.string	",\271K\362a\361\f\261\263\326\013\367\355'\271\272\366\331\336zA\036\331\332\225\035\032k\220\037\007\304\322\211\253\307jL+\217t\f\204\354\225\0022\274c\201\247\204\310sU\300\230\033\027 \203d\020\226\365\001k\347\246\357\314\024\351\006\361;\035a\254v,\254\031\226\244't\3473\304d\230\235'4\201X\030\254\311\304\361\3563}\352\363\246\204\201\377\003h\342s\005\332\250\356\266\030?b!T\033\276KR6\236\326\272f\342\342\310&\2247\240\262(\274\016\246\224#%\324\025\271\351ma[\237P\351\215\222]F)\324\253z\345b\234V\0016&&w5r\257*q\177\033\225\326a\237{\270\300\253\b\222@\006\244\005k\277E;\034\315\3421p\002\362E'\362\377\221\016\364<\265\206"
+	.string	"\317\255\217\205$\324\266(L4\322[`\211\246\337\360\257\272c\222K\343o3\271(\203n\375\201\315\301\275A\372\t\362\346\tL\r\215\243P\210\317\005;\320\341)\253\230\243.A]\333K\240CDX=\033L\222\\\351C\241\005\b\\\212\354Z;H\223\216(V\343\243\263\322p&\200?3\244\325\001\275\315\325&\305\252\334\322\274Nes\351\232\325:Z4\fg\240\351:\033\"F\336\273\026\244\273\235\243\265\031A\236\353~\363\026\364\013CJ\242\272\0220\004\216\313w\r\013\265\361v\233%\n\235\341\343 \236\303v-\270\334\314z\267\223\020nQ\325\365c\274\323\332\203\322\224\234g\352\345\0313\203\242<\205\203W\260\324\233K\302\212|\311Xh@\323MV\211\376\355&@ \360\230\340\235\267&\3745,<\3748>\261\323\243\316"
+	.string	"\207Z\036\234\313u\327\002V\032T\237\313\304\24130X\364\036\202|\341X\362\327\2138\222\303\002\210!7(\303\n!\023[l\r\034*\324\264w\303\314\n\352\237\202\007tj\265g\244_\357\0072m\303\037`\317%)\373\364Q\031\001\n\374\217\375\2104\225\237\370\021\272,\020r&\232\325\260\333cE\325\\u@B\352\204\371*Q\274K\373GoY!e\020:;\342\2001\034S\264\246\223\220Is\340\322,tD\224\2466\017\225z\236\341\0212;\344\314**\322\211\321(W\271\227\021y\nH\301\242L\365\303\252\355\327\262\374*\021\257F\310x\354\361(\305\2730T!\271p\266\003\204"
+	.ascii	"\347_x\252\033\3174X\335\302r\341\027\222x7\b\2244Q\255\262\004"
+	.ascii	"3\313G\277\275\213\"\\\1775\357\t\2334\205'\222{\b\200\261\235"
+	.ascii	"\343\367\202T\335\r\036s\334\317\033!\247\024\3558-|f\353AWE"
+	.ascii	"\231\271;P\367\n\f\003\216\237hf\337\227lP\364\240\203\f\211"
+	.ascii	"\232\352\272\304U\216F1\031\375\006z\023\022\370\232\336$N\313"
+	.ascii	"\003\303\221Nm\274[\035\355\321K\337\257\025\214\210<\177Q\260"
+	.ascii	"\3348\037\216\314\033\350\300\250\220\030\277UP\214\212\300_"
+	.ascii	"z\317\037\003\364\004\333\234\326F\201\200\026"
+	.text
+	.section	.gnu.lto_convertExternalToMotor.134.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\r\n"
+	.string	"\306\322G@0\305*\035"
+	.string	"\320\371\351\255U\240\372G\356\270\357\\\371\375\274\035\"D\275\341\323 Tg\362E\r\013(L`\304\217@\233\t\0214\242I(\324\344\362\243\324\\\r\3342\314J\364\f\023\273wJ\0014"
+	.string	"4"
+	.string	"2"
+	.string	".7 )\324&\006 \244\005\267[\275\2043`\336\315/`\336Q\224\227\237\245\377\3313T%\267U\013\365Y\200\261\273\236\253\326\310Mo\333\301\366\206m\002\001\254\004\bv@'"
+	.string	"f\373\344\317\234\321\300:v-\277\253\375\342b\001\n\354V\210w\326\320\230t\346\274\254t\267\353\262\325vk\204\037\f\336\331\366U\276r\n\266]\367\227\245/S\013W\212\252<i,\365\364\365\027\256\324\314y\322Rj\007\f\354\314\331\0255\351\211\375\313\322\227}\331\177\032\262\261DZ'\271\355\006`)\374<\243H\212\243\003WpLHPt@ G\001,\205\237'\374H#H\232@\004\1778#h\022\215<\262#$\nA\036I\364\215\274\317\370\341q\032,z\200\243G\212\342\350e\002\013"
+	.ascii	"\257\223\360\3746\274`=8\307pM\334f\221=&LI\321%\352\276\340"
+	.ascii	"gFS;\237"
+	.text
+	.section	.gnu.lto_convertMotorToExternal.135.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\335\t"
+	.string	"\306RF; \261\322\001 \2242\002\200\004#%\2202\357\f\023=\242\rL*\200\317\001\332{\373\330\326r\022@6\024\032%\024\311\270\204\216B|\226\031\300\256\301\247\211ILTfb\367N)3"
+	.string	"4"
+	.string	"2"
+	.string	"6?\037\254\325\2076\343b\311\355\236\037\301\017:\367\350\r:\367j\311\315S\323\277\355\027-\023\334+\266:\005\250\330]\323WL\344\256\267\275`\033\303\266L\260\033\233\215\361\\Nl\253|\233=\n\256\220}\232\337\327~s4\035\315\356\331p\317\026\t\273\020\245\257\231\366ve0-\273\247\203\031\002\356\331\366S\256\242\n\266}\3569[g\256\0232Vm\231\336^\366\365\347)d,\2723\275\255\204\350j\226\356\354sE+\211}\316\326\231\375\332\377\312\201\002\003\211}\004\267\033!J\004E\"x\"\3032\025\016X\"\003\342!\024A\nA\005!J\004E\344X\216&\001\217@d\230*\231\276rC\243$\222\276S\t4}#\322\343\003!x\354\b\311\257\034G\362\363\004\013"
+	.ascii	"|\223\360\3746\274`=8\307pM\334f\221=&LI\321%\352\276\340gFS"
+	.ascii	";\237"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`\217\004]\023"
+	.string	"\266^rD\220^M:t\372\201\233-\251bN\366\264\362\227B\025\034i\223\"\331\023\200\023\030Q'%\274\362\362\350\021\331\235h\251\025\204g\265w1M\323\264aWYL\026k\036\240\024\257530\200 \224Tn\231\002Y"
+	.string	"a"
+	.string	"d"
+	.ascii	"}B2\351p*\364\007I\n\027\233\3600\t\007\304\377\tDP(\b\377\303"
+	.ascii	";\037\334\217\203\177\361\303\006\007\343\235H\357\303\340g\370"
+	.ascii	"\341\202[)\350\013\222\t\372c\b\356\206\347\201\376O\356\257"
+	.ascii	"\342<z\033\236\006\372\201\344\023\225\226\277\3772R\n`\3169"
+	.ascii	"\013\364\323\310\377\034\025\257\303\342tV|\213w\252\270\034"
+	.ascii	"\336\231\342sP\\\213O\264\"1\321zD\226P*L\342dF(\024\021\372"
+	.ascii	"$\204:\001\241;\356\325Zu\362C\253(\223\254\374|\036Z\215\310"
+	.ascii	"\016\317\272\017\013L\213CkHk\235RlC\277\220|\250\341o\370a\206"
+	.ascii	"\373x'\206\307\271p5<\217\256d\205Y\bS@Z\247\374hm\302\324*\345"
+	.ascii	"\243\225\t\2565\252G\253\222[\353\022\235s\376`\241\245\326$"
+	.ascii	"\312\343W;>\306v3\374\333r\266\245\334\315I\307\261\224\216\206"
+	.ascii	"\377\"M9'&\334\255I\tG\004\351*\352r\234\r\216\363\271q/\033"
+	.ascii	"\337S\343zh\274k\306\363\3108\236\030\347\202\361;/n\307\305"
+	.ascii	"{-\002\227=Q\007p}\355\016\006\\\3515\352\305L\215Au\321\300"
+	.ascii	"\225Y\252\300\225XF+puKT\242\253\337\226\207\001W\306\243\201"
+	.ascii	"\253\343h\264*\376\213\321\006\340\335K\321\016U\231\025\355"
+	.ascii	"\320H5[\031O\267j\215nw.\263\255\275\313lAQ\300\352\223\214h"
+	.ascii	"k4\331\016i\215\"\244UJ\220\326Z\250\021@\004Pr\241\302\202B"
+	.ascii	"\2419\020\003\231\032\345\021\220 \307\022\221PD\202\221Z\320"
+	.ascii	"\001?n\013\273\026\337{\223T\211\2734\352\332GZ\r\222\362\350"
+	.ascii	"j6\262\271z\261\237FVW\355\252\\\225\213\372\307\346I\325\347"
+	.ascii	"{\240\031\270\324B&&\207\262\035\021Y!+d\005\244\207\231\370"
+	.ascii	"\221q\2541\264\250\330\262\244\272Se\030(\353J\343.J<)T\033\234"
+	.ascii	"vm\3534\303a\333R\317\300\024\230\025\231g#\202\330=\277_\022"
+	.ascii	"\254)\201;\325\345\207\333\033s\303\326\357\037\246\267\347`"
+	.ascii	"T\001"
+	.text
+	.section	.gnu.lto_.refs.1389c0dd26bd7c54,"e",@progbits
+	.string	"(\265/\375`)\001]\f"
+	.string	"v\335U? o\224\341PE3\r\206\370\032\354\205\203\345R_\244\0050  \005\300\270\002\020\002\020\002\020\002\020^v\016\243\204&3\324\237\003k\377#\335\355\315\222f\255\221\030)\371$\336Q\362\245L\001>"
+	.string	"H"
+	.string	"A"
+	.ascii	"\203\372\235\347;\216k\236\2578\337\262\303]\0167|\300"
+	.string	"\306K\032\037\275\017e\017\322pO\366\234\f\337\274\3270\256y\237\301p\354\362\327\305\255\313?\213[._\275\001l\267\272\302\333\311/*\277\017\267X\007\350\245\356;\335\240\202\224A\027\364\243\036\335\250\202v\224\243\t\212\240\033=P\003M\265@5J\240\335\346G|\370'\326_\342\201\003\t\367o\340\370#\334K\350\203\36498\236\352^\243\034U~\352>T\006\377\t\366\213\300\374&\332\337\341\372I2\377\b\351\027\331>\204\304?\260\357\300|J{T\366&\022\307\270^\224\371\356]\372\215\304\265\354\261\2141<F|\353_\"^k\001\225;}\255o\021\035\252\004C\350k\204:\350\251\017z/mPOCx]\264\370|W\244\364\213\002\305D\366%\201\372\206\310\370~\020\321\220A\364\275`}-TxQq\262\350\023\304\351iRB\f\024L\317\t\246_EJ\n\315\217\222\375'J\177\211-\024"
+	.ascii	"7\243\004\025eT\\K\305\202\270\226`21}/\004\236\261 \016\"\364"
+	.ascii	"M`\224p\243\202eKC\024\267\331rb\205\001! \356\250A\221\002"
+	.text
+	.section	.gnu.lto_.decls.1389c0dd26bd7c54,"e",@progbits
+	.ascii	"(\265/\375`\341G\2057\001\272\0266tV LI9\351\276s\266\316\275"
+	.ascii	"\253\f\227\321>\242)\225\033\033ko\244z\346fnFg\306onn\346LM"
+	.ascii	"L\355\3676\273\304\203\324*\262X\247\243P[\225\340\327u\\Q@7"
+	.ascii	"_\311A\f0`\272\3159^.\343\335\3020\004t\330\355\377\377\375\t"
+	.ascii	"\331[\356\024(\006:\007~\007o\261^\262\206\343j\t\346\257f]U"
+	.ascii	"b\325LG\220\030\\\254|,{\214\211S\315x\214\371#\361W<\254\035"
+	.ascii	"C^X^\361Xv\020!c\370\304\222\035\326IlRL\347\005\330\335\222"
+	.ascii	"\354\257x\235l\031D\272\306_\315l`\211\221u\262\215\324\270:"
+	.ascii	"\307\225"
+	.string	"\241\36060\313/\210\355\345\234\374P\364\301\003/\240\371\332\340\366\\%:\r\340\207;\311k\\\0074\3444\371\233\221\327\267\217 \275\221T\300\326eK\337\234:t\376|\203\177\226\301?\275\340\247U\242\363g\026\374\223\n>\\%:\373G\177U\245\207\006\273\316T2\243\345\234\004\322\261k\303#\255\357O&\370\325\303\t\364\367\367\367W=\234?\211\340\237Y\370f\034|\263\016\337\354\202o\256\341\233e\370f\024|S\t\276)\004\337\274\201\177\343\340\233\261\303\277o\370{\225\350\374%\303\277E\360o\016\374\233\361\255\033|k\006\377\035\243\356\241\240\021\226\327\367o\030o\252$#P\246\372~D\024\034[\347\270\372G%'\326.\372EOuUU6UK\275\2239\247Ui\252\206\252ju\216H\276T_z\214E\371P\364\341\304\202wF\307\316\275\235\202o\303\360\355\016|\253\205\337~\370\257q:"
+	.ascii	"%o\\\001\351\373W\277\332w\206a\211\245\351\313w\252 \205\006"
+	.ascii	"W\337\367\035~%\323R\325~\242\202\362\224\024\013kY\254\230Y"
+	.ascii	"\272P\335T8\365\205\372\246\352Ue\335\253\313W\274\232\367\313"
+	.ascii	"\326V\331\352^u\273\233=\313\232\300\305\0301e\1775\333\253m"
+	.ascii	"r\224`h\2269'\353^M\241\336\331\344[\004\254\204Y&\377j\266W"
+	.ascii	"\255T\265\237\250d\316\312\261r\346\006\\\217\022,9\272\237\373"
+	.ascii	"\276\202;W\242\323\202:t\276\241`6E\346\0332+e\337\267\020\374"
+	.ascii	"\312&"
+	.string	"W\344\257gj\013uMMS\321T3UY\325\324\271\327\267\272\345\235|\005\023\206\210X\02515\356\007*(K\225\361!\226s\362\225\313\217\244\246\322U;\233\024{@\220\260e\316\371#~\244W5\225\205\252f\223o\370\305\225\036\313\234\223H\277\006$\252\232\352\245\306\331\244X\226\032\223\302\0074,nm\366rN~(\372\360\341\303\207\017wM\037\235\333\317\375\353\030\025j\262\226\351@\316S9g\r<|]\246\316\372\222\2717\302\004I\322\367\025\017\327:\244\3271Cg\026W2\247\345\234\201\314\034r?\302\372\362\324\241\363\025\r~\375\202_\265\340W*\370\265\b.\252D\347\253\016\\W\250pU\331\241~\271\006$n\241\252d\262\234\223@>q\244\304\341\353\373\272\205_;\234\365\257v8_3\366P\211\316\236:t\036U\242\363\"\3005\253\022\235\030\352\320\371 \276u\350\264\240\022\235\277"
+	.string	"~\004\360\337*\321Y\321\352\225\252\314\240\246\275\236\325*7\243\2229\231s\022\250\303\374\324\254\364}\003p\317\321+\226\017\325e\022\367\301\257\031\234\366\357\257fp\276qP%:\273\016\235\237\253DgP\035:\277\254D\347_Q\370+\225J\226\201\255\262\362\312i9'\205\360\024\227,d}\237\254D'\256C'\004\236v\265\272\374m\242\337\340Y"
+	.string	"\330\004\330\022\1775\001\215E\300\337\036h\260&\007\177E\362\327(\1773@\311_\313x*\bm\343\246\376^\200\035\252r\315\001\235%\361_\003\3773P\200\325\300"
+	.string	"\377\323\352\231[5\273\005\376;l\323e\354\005)\372"
+	.string	"W\003\177/\377\212\201%\300_\335\330\t\n\300\341)\354"
+	.string	"\256\341\277\027\370\273\214\275\240\321X\013\n`\001\360\237C\275\362\t\376K\201\357\374\367D5\341\0342\360\024\027\372\257\b\335\341i\325\002\025\250\032`a+\240\300v\370[\203\345"
+	.ascii	"\254p\377\362\242\023\3773p\016\365\212\245\340o\002\374\350"
+	.ascii	"\277\031\374\325\215\235\300\022\375\025\3569\377\005\300\003"
+	.ascii	"*\b\177\rc3\374m\277w8v\210\257\236t\177\305\300b\370\237\226"
+	.ascii	"\242^9\001~\233\346\257y\375\3332\037\341\366\267rm\343\257\226"
+	.ascii	"\313\337\024X\241\277K\310\200\220\311\311\006Y\240\277[\330"
+	.ascii	"\037\353\363w\t\212\1775\376\265\351o#\333\363\277\303\177\021"
+	.ascii	"\3607\t\246\375{\211\313\337&\360\375\r|\363\3677\tm\356\322"
+	.ascii	"\374}l\341o\240\334"
+	.string	"\337$\254\240\3667\360\312\337&<\371\233\204!\177\237\340\3617\t\177\265\300_+\360\327\013\374\325\204\237\377\r\253'\234\3477\201\377\365\376\273\360\277\315\377\275\377g\376\177\371\337\302\1777\377\331\374\207\363?\255\357?\277e{\237\020\313\363\201\277f\371\353\332\337h\177\275\362\377\376\246\f\273cuv\374\325\374\353\371W\373\327\234\277\273\3747\177\023\311\337D\376\016\373\373\310\337E\376F\362\267\022\213\377\276\361\367\220\277\203\330\234\377>\277\211\302o\317\337\332\277\341\374\375\346o\275\277\333\374\215\367\367\232\277\323\374m\367w\335\337b\376\366\3627\333\337W\376\216\362\267\330\337P\177\227\340\357\021\374\035\202\277[\374\315\342o\247\277\221\1773\375\355\201\277\207\177\013\377>\341\357\f\374]\201\277K\370{\204\277!\360w\b\177\233\370\273\001\1773\340\357\005\374\255\200\2779\370{\203\277\017\3607\210\277\013\360\267\207\277\t\360\267"
+	.ascii	"\376\356\360\367\206\2775\374M\364\367\320\337B\177\003\375\315"
+	.ascii	"\363\267\316\3379\177\233\177\333\277\353_\377\376\352\367W\276"
+	.ascii	"\277\302\371\353\233\277\352\3755\357\257w\177]"
+	.string	"\363W4\177=\363W\273\277\222\340\257%\370k\007\376\252\201\277\206\371\253\334_\343\376\217\360\237\357\177\332_\341\376\212\301\377\024\177\365\362\327\267\277\262\375U\371\327*\1775\373+\325_\241\376\232\377\372\364W\026\177]\361W\247\277\236\360W\016\374u\003\177\035\341\257\021\370\253\316_\361\377\023\377\375\376\367\375'\373o\374/\367\337\303\337\337\337\337\277c\365\367\250\375H\"\boNp\007\255\243\337\027\367E\002v@\375\360\300;;\216~\251^\225\227\312\212\351 \315+o\031\240\213\030\027\b\236\273\2718n\372\376\347\ns\300;\372\225\222\252j7s\366\202\363\366\002\346P\346\350\027\352BU5\024\230\006\214\266\245\035\346\340wt\373\367W\325\256\231\263\227\2167\237\032aI4^p\207\027G\267~~U\255\3467<\343\214\3332g\301\201\330q\322\366\327\326\367>J\314\341\313\321-\237\322\362U5\0179*j"
+	.string	"9\350\356\363\004\033i\035\335\302yUZ8\265\017\303\3109\212\313"
+	.ascii	"M\264x\250\272\\\231\321\367>_\270\350\312\321\355\033\245}c"
+	.ascii	"\345: \222\243~|\270\242\343\002Q\357\330\316\316\364\275\217"
+	.ascii	"\025\306\300\210\0337V\317\350\311\331\351\005\247\247\245*\255"
+	.ascii	"\236Y\347$\311\032\037\306`\t\236m\203g\3630\024\321\222%]\036"
+	.ascii	"\316#?\340\246\350\335\346Y,:K\232\200Y\365}\217\0356j;\272\275"
+	.ascii	"S\332\273\273\205\220\251\316J\230ie\020\357\201\303\030\224"
+	.ascii	"\251Qc\327\204\320a\007\036\026\222\\Cd\315\335r\2100\001\242"
+	.ascii	"\326\367=Jld\345\350\255\35435\256"
+	.ascii	"(C\345Y`\006U\327\267\227\263\222 0X3c\306\236\321\3119g\256"
+	.ascii	"\f\2057\200\035?x\334\326\244\246n\317\3248\037\260\257\027R"
+	.ascii	"\372\276G\n\306\300\313\221e\301\316\335\322\235\316\332\341"
+	.ascii	"\2343T2c\0255YR\327\267\227\271"
+	.string	"\270<\2306\242x\244\365\265v\277\006$\316\246'g\262\2343\207\035$J,%}\257g\311\374\327\261/\330hI!3\346M\222\273\033|\031H\311\230\027\017[W\227>7\236\270\331\365}O\025\376_\337\377\231\243\262r\316[f2gI\365\234\177}5k\365\360\373T[\003\360\377\346,\242\004\311\034\365G\226s\256np\023\267\250\035\026ds.\253\n\355\013\252\203/\255\251/\034Uh_ZBUh_\031j*\t\224PV\376\202\252B\313Yhj\n\312\204\227V\025ZT\026\252B\313Z\231\252N\253\346\344\027T\236\362\312By*Ge4/-\013\252\246\276\264\252\320\242\264\204\252\320\276\2642\332W\016\312SQY0\246r\226PF\373\302\313h^ZAUh^ZUh_J\252\033\f\263\267\2558dA\372\352\222\252\251<\343\252+*+h\256*\351\225\315\344\\\323\\\344\254<\227s"
+	.string	"r\356\362\3122\023\205\243\276I\315\315\220\322\022\345U\2239g\243+)0\257<5\007U\363\\\225\023\257\234\235H-\345\253\234s\336"
+	.string	"*9\227\213\3249( ]\331\312E\316\024\344d\316W9C\325<\227s\206\3129\347du%s\326\021T%vu\2253W\321U\356\202\332\342\"\347NC\363\246U\205\006\346\205\264\005\013\232X~\221\204\252UV^Y,\233\371\312\302hPg\331*\347\\\333`1-\032y}m\230\234-[u@\372\236\007\016'y\336z\250\325\350k\343\212v\\XA\213\222\276\347Qb\013\007\344\004\013\310\227\276\347\241\202\177\273\202\227\244\227\024\277\266^~\253\202\355\322\177\265R\261\271z\241o{U\242S"
+	.ascii	"u\350\264) \335r\371\321\222re\255\257\320\2267\240\250\030x"
+	.ascii	"Yo\277\225a\335\356\326OO\362\356\372\332l\333\330\200\360a\371"
+	.ascii	"\260Zl\226\252\264lv\255&\363I\374HlV\315b9\301\334n\300\355"
+	.ascii	"Y\266f\263c\332n\300E\311\241b\346\211\221\363\236\007\t>O\216"
+	.ascii	"4,T\274\200\245\365\265X\332^\261\312[,\026\355\032\220x\317"
+	.ascii	"\224\305rs\216\252\365\202\237Z/0\273 \211\262r\336\363\320\300"
+	.ascii	"\277\265R\245\354*G\325\331m\225\273\265W\263\200\327c\257o="
+	.ascii	"C\272=\263o^\\\364%\315:\227\345\201\365-\343\271\342\261\206"
+	.ascii	"\254\357y\\\340W6\0329H\300\b[Z\031WD\2269'w\300X\312\250\301"
+	.ascii	"e\261\262\272\304rN\336\230\261\324\2415f\207}\021c\214\221\037"
+	.ascii	"q\226\366E\325\221e\016\031\313\234\223\025\317\006\326\227\365"
+	.ascii	"\372\2619G\371\211u\331\002\303q\265\264F,\017\353U\347\270\356"
+	.ascii	"\224\277\245\225aUdi\211X&\226\314:\261a\226\212\035b\243\330"
+	.ascii	"'6\211E\301J\261b\026\212Eb\213\330%v\314N\261Gl\023\253\244"
+	.ascii	"*\255\021\013v\013\304\006\231\252x\326\210\345\262\262/\254"
+	.ascii	"\021+\004\311\322\312\3705 a\215\330\0315\356\007*\231\261Fl"
+	.ascii	"\2012%J\316I\354e\267L\022\342~G\f\276s\225\350\274\226-\370"
+	.ascii	";m\370;Y\360o}\334z\375\266\253\256\325\270\016\344<\005\244"
+	.ascii	"&\310\032\013}m\017\244[\037<S5\326\222\364\325I\303;u\350\374"
+	.ascii	"\316\030\376N\021\374\235\036\370;X\370:}\370:d\360u\340\360"
+	.ascii	"u\324\360u\236\340\353\374\300\327\311\302\327\311\270D%:\217"
+	.ascii	"\357\3601\034>\266\202\217\352\320y,\206\217\273\360q\f\374\244"
+	.ascii	"\013K\265\202\213\253l\352\226\352\257z\375\320\270\022EG_+\205"
+	.ascii	"t;\265\2000 S\372Z\033E\247c\267\246\306\213\276\277\205\262"
+	.ascii	"\271\372M\211\301\261\371\357\027\232\257\377\252\r\223\225\206"
+	.ascii	"\252o\367\265_U\032u\234\fT\363\210Hi\365=\216\302$\310\271\032"
+	.ascii	"\235\365\357\257\032\2355Y\211\316\"8F9\007\312\026\037B\302"
+	.ascii	"\200I\356\224I)\221{\023\306\206\231\031R\306\005=\023\215\032"
+	.ascii	"\0246e\354\272\205v\323\323\263\305\212\\V\3376E'\021\027\252"
+	.ascii	"\244\372>\347\005\374\277\357z\331xU\331y\215\246h\304\2314\261"
+	.ascii	"\2746\243\266\314\3534\315\246\204\213,\235\031`k\313\234\223"
+	.ascii	"E\037>|\370\361b\243V\006\337\277\331\254\261)\304\311\303\223"
+	.ascii	"Kf'D\362\270\364\375_\225\255\246\271$sQ\3238S\204M\337\347\270"
+	.ascii	"\301\317Q\203\237C\207\237\003\2077\344JtZ\261:t6\031\244w\231"
+	.ascii	"\2366f\320\244\364\245`L\335\216\225\035\233)\315B\3175]{\265"
+	.ascii	"\227\013b\264d\333\245\215\022N\337\236\\\211\316\232\254C\347"
+	.ascii	"\337b\276T&cnl\204\001s\235d\321\033\353+\227\324\222s.\312I"
+	.ascii	"\201\313\362\252\357s\262\340\217H!\311\337+\264\227\206\353"
+	.ascii	"\270\252\354/\315\345\325\254U\370M\346\254\205m\213\222d\227"
+	.ascii	"\273\375L\005e\031RR\304\276\364\333\335~\246\222\371\3109&J"
+	.ascii	"\3560:\304X\355\334\347(q\315\225\350|\316\024\374\234%\3709"
+	.ascii	"G\360s\204\340\277\335\272\255j\f+\367\355\266f\273U\274|N\025"
+	.ascii	"\224p)\353\373\234.\374\267\226\0361L\262\364Ez'\333\253\201"
+	.ascii	"\330\263,\254\264\322\267\304\233Q\246\013/K\207Y\016\031\\V"
+	.ascii	"\313\234\2237\312\314@*\002Gl\204\017"
+	.string	"?\2612\032\\b\255\265\225\203m\007\214\245\223&k(\275\326RZ\255\253\264\225n\322X\332\254\225\235\326(\364Y\227\365\224\246\322h\235\245\307:J_i&\375\244*;\331J\002\370\032\356p\20738pH\244\020'\205(r3\334\266\364\275\206$\356\360\344\315\233!0z\214\375(\323t%\351{\rb\270\002(==\323\256\310\313\2261\263\245#\n\020\333\0170p}\257a\013wX\266ic\342\335N\345\036Q\200tX\241\"\244\3575d\\\301\326\335\235\211\247\334zsc\004\027\202,o\342\3351fvf\302\340\n\326\326\254\261yA\340t\031\036\225&j\270\002'f\314\230ijPR\252\f\013b9sy\330ak\303\003\212\211\346f\0324C\264^\350k\236\251qXo|N\250\340\n\300\310\2201\355\256\234\331\322\201\251Z\300\241f\226\271iw6&\225\024\2228\342\300\\P\343\326\367\023"
+	.ascii	"\301\025x9\372o\316\231sf]\255\222\261\352\220\272\274\036{9"
+	.ascii	"sy\360aa\313M\313\244\273Y\247we\256\254\357\365\032\310\177"
+	.ascii	"\235S\fV\337\013\177\270\b\016\356\246\030\270,S\330\374|\371"
+	.ascii	"B\202\325\327\004c\206\221\213\373\322\002.\022\343v\263\213"
+	.ascii	"\351fz\361p\346\264\345\036P\331\2200\272dZ\225\242$+\253\257"
+	.ascii	"\311\305T\301La\313\033Q\0326\232R\336dS\232bgV\007\362Z\337"
+	.ascii	"\337\262_\214\265\031\353kf1\265\254\251\245\0215\301F1\246\334"
+	.ascii	"D3\247\230W<pEEm\260\344\354\204\263C#\225L\202\2511\242\245"
+	.ascii	"\257yfZ\321\341b5\246\253\357\315*D\352\220<\351\333\311\034"
+	.ascii	"\262\254)\265\2767\315\254\037\030.0\372\336,\373\257S\2024?"
+	.ascii	"\244\3645Q\300.\210\200d\240\203\246\312\2320*7Q\370M\262Zf\302"
+	.ascii	"\350\200\325\016\256\273\276?u\3504\251\220nRi%irr}OT\205\215"
+	.ascii	"\2000\271\031\205I"
+	.ascii	"\230\207&Z;f\240\364\310\321\327\0343\241\230OL'f\223\fm\260"
+	.ascii	"\021\nR7k\230R\246\030\222T\216\362a\001\025\274.\020<M\266\244"
+	.ascii	"\221\322WI\322\n\211\214\276\276\317`\207?B\207\3315v\006\211"
+	.ascii	"\313\274A\226\306\206\211C\315\262\210y\304Db\0321\223T\245\031"
+	.ascii	"f\362\2302\303\314\034\035\220\241Y\232\205\231=L!u\216+(O\265"
+	.ascii	"\355-s\316\037|~\274P\363\321sm|\r\007"
+	.string	"\251\252\020\312\330,M!\246\0173H\235\343J\346-\036\266<\273\255=s\210I\244*M!/J\346\017\037\214|\370\316\354\225\235\3677\203\230@\336b\354x\321\327\004\253hr2\200\364}\206'\3707\177T\245\371\005\364\202\211_\222\276\246\327\327\300\200\212!\343]ll\241\022\246\35730\301\317p\004?\203\017l\356\300e\226<\304\364}\206\034\370\031l\340g\310\302\317P\205\177\023\207y\003-\316\215\230\033c\302XI\365}\206)lf\231[&\215_\007h\312\233\220,}?\324\207oj\375\327\031\301\b\013Y\372\336\372.\2479\343&\326\257\323rJ\304\256\372~\350\r\276ie^\375:?f\222\250\235\365\375\320\035\276)\343\277\216\231\345\317M\216\276f\f\354b\210.\203\035\036m>v\364\375\315\251\2331~\223\252k\2300@\360\347\367\246\257\371\302\254\272\t\303t\221M\030\033x\345\034e\302"
+	.ascii	"\352\3139\n\250\326\013j\275\340N\001S\262v\336\017\201\301>"
+	.ascii	"u\350\254* \335\234\022\343ei\326\367CU0\207#&\224\tu\271\304"
+	.ascii	"i\2027\244\371\373\273\\\330\206`\016P~~7n\r\016\274\301\005"
+	.ascii	">\276!`\206\254\360\20698p.\227\262\241\2147ty\363&\f\017oX\323"
+	.ascii	"\323\273m\206p\325\341\r"
+	.string	"fwUy\357n\033?0!\310\023\242\004\311o\336\177\227\027\257\351v\330\240P\346\255/\256\331\013\336\340c\315\232[\247&\013\336P#M\232\313%\214\025\314\341\207]U^\273{\306CP\236j\341\0050\346\233\013*\025\372^3\3272UU\265\327\027\t\351\267\205j\306w\266B\337ch\2027\300 C\346\326i!\202)\210\003\246*/\230[G%\311\b\230*w\356\227\356\277a\256\230\246;\255py\313\321\367\262\200\364;gFk\213\215\276f\035:\317\271:t\036\203\027\246@\314\nw\205\033\227\004L\233uyr\007\367\373\245\351\360\362\005\272e_\r\220~\341\316(*\374\200\323\367\030\2660\0054\272t\211\201\341\005\246\240\354\255*\357\333\345\022BP\316A|\210\345\254\032 \300\364\225 C\236\334\024~\373\342ni\272\034 _Zh\353{\205\3720\005M\264T\345\325r\333t\252r\246a"
+	.ascii	".Z5@\200\2113\343\242\311ek"
+	.string	"\272\223\353m\211\230\276\027Z\203+P\263\266v\323N\024\360\352\372\242d\256.\017&\236\020\254\265\276\027\362\202\001P\003\313\261\334\264\007\345\234\245r\356\241\343\224\322\223ciUF\371\233V\325\266\272\264\345\350{\275\252\366_\347\2325\341\022\322\367Bf8\247\353\350\027\255*/\232\365\322\001\021\257\274e\301\223\334\003\345\302oG\337\013E\301E\311\344\255\322\001W\216\202\302\340\016\357\310\227\253\253{&g\007\304H\337\013\031\301\027\302\2011\0249\372-S\3362[\245\2034\257\254U\202\212\026\224)\267O\3516\246\357\205f`\r>\216~\311.\231\245\272QU\362\326\016\025\225\036c&\0250{c}/4\205-\220:\272P\352\225r\237\334)U\355f\"9*\212\004\337\222\2406\370As\370\265\252\235EH\216~\307\356X\215\273PU2\326\316\213*B\262\366r\206\003am\274\235\245\365}\220\023\f"
+	.string	"2%J\256\0236\261\254'F\\4\371u\302\346\f\313j\f\223\377:;yteZ`r\227\3208s\245K\231Y\204\217\206\226+f\301\342\220\300\265\351\373\2400|\301\022$H\314\260\033\0332Q\372>H\007\276 JX\330\033\250\036K\323\323\352\373 ,l\364\345\350\235\246\323\330,"
+	.string	"\263%\367\215\r<\273\276\027\224\271D.\021\253\027\224\245\356d\210e..\017v\206\220\275\256\276\017\222\302\027\370\t\271C\256\020\253\207\241*\013K\352\372\242\360\210\302R\206\006\007\300\206\017\037\027\310\ntnK\370~\200\375\002\301^]zp\372\336\257w\371\257\203\357\306\256\326\372^\357\376\370\25734\006\245\352\307\365\312\321\321\004\314\235\205\002\"C\256\357\201\302`\243\271\243_\036Uyy\330\034\024#\013\004\260\276e\316\342\002\341\263EmF\232\276\007j\303\034\264\034U)\365\346\250\312\233\343\356\300\220\365\20033\2269\253\013\204\235R$\005\027\256\016\240\255$l\310\212z\254v\264u\351{ %6js\364\213\003G\327a\310\212"
+	.string	"\330\3372ge\2018\320\024ld\344\350\327FU^\033]\207\251\252r\326*A\005O'\315\21623\372\036\210\007\016@\334\245qi\240\200w\247\254\260a\351{\240*l\324\302\321\257\226\226\375\322AZ\216\322\332\300\f\016D\213\345\320\272\321\367?o0\006[\367\352^],#*t>`]Sp\356\214_\254\263/\331\343\352\313\177\235\2378~Wi}\377\263\006w(r\364+C\306\335nP\226!%\343\rw\340q\364\013\003\306\335\256\2233\\[*v\276\024\002Y421\031\203\305!\360\250\363\223\002\215D\025f\320\227B\2648\242i\n<A\004\362hD\026Q\244\005\320\024Ht\n\022\201A\016D`p)\0052\211@\246\303\023D8\025\225\016\360\344T\034\022\017\260\001\007I\034\224x\022\201\n\235\210\301\342P\304\021\351$B\004\013\343q)5\026sT"
+	.string	"Q\342M\221Ec\320T\221\026\207G\342\371\245\020\":\240H\021P\025@$q\bT\021\2042\035\207\036 \207@G#\bH\024ItBQda\024\246NK%0\261h\352\200\024\026\215A\024i<\006\207'\204\276\024\002\331\002HD\205\246\020%\236"
+	.string	",:\340\350\001\023\213\246\241\0130\261h\362AS\240\260\251\002(\261\211\311\370\001\023\213\246\t\276\024\002=:\245@TE\216\206\n\016L\201\302\024E\376$\241)\220\330\304\204\246\330\220!mr2\036\225\222\216h\2122\001\217\300&\021\002\b\026\235x\212*\332D&)5\365\244IE\245&\263\250\324dQ\020\f\221\027\211D\217B!0\347\2306Y!ZT\032\022\2019B\024\351t\213\306a\032D\2219?&)5\205\3609\002\227\202\267\3051E\016\225P\022\2146\030\241\001\022\006\204@'\n\374x\300C\004:\231"
+	.string	"\n\2018\004\246\026\370A\221\002\211 \030\323\340\004J`\300\230\006'\300\203\201\r\232\214G\024(Q\2518,\001\b\005\007Oh\b\034\230\220\323"
+	.string	"\037\f\240\020\002\235(\260sD\323&cpxL\361cLaLA\004\026\217h\372\344"
+	.string	"cp\002`\n4\021<\236)\006\025&D@\201\034>\001\261N\320Q\b\244\223q\270\002=\242\300\360\245\020\301$\224i\230\026\235\216\"\202"
+	.string	"@*\001\211 (\025\207LG \017J<\001\230\342i\310\204\211D\017\230X\240\bj2\246\310\035$\232\016\217,x\220\250\211\242\247\341\t!\320(\201\036!\232t\366\264"
+	.ascii	"\036\217\036\030S\244S\220\003zt\312p\"-\242\307\243S0("
+	.string	"\035\026E\320YR\032\206\300\201\205Q\002\302\021\033>\b\036'"
+	.string	"ba\224"
+	.string	"\206%\245a\b\302\021KJ\303\020\200X\030%0\001\246#\0209\024\na`BSd\213\022\210\220\302\242\003\202H\007\244\303\3420\b9\314\340\203*\025\201$<\rO\004\235HQ%\237\007\223\212 \244(\022%A\251\211\350\301\341\021-\242J\370\033pp"
+	.string	"\016J<\345\274\204\002\216\024pt\276\204\002\220\220\024\300\001\022>\007H6M\321$\036\037!\212<\242+\320c\0222\211\005\260\305\020\321hl@\222\231~)\204p\330Tt\374A&\241\304\241\n\343\021\205p\330\324S\002E\227\020\241K\230h\264\251E\232\244B\250\007\004KI*\232\210I,\200-v@\260\364\023LZ\n\246\306b\022\206\342\320\210\242\311IX\034^@\003\017\013\240\tLN%\b\207M?\250\022\360\210\256"
+	.string	"&!\213h\023\223\361\003\341\020E\n<a\305Pqx\"\365@8l\n\002j\221\016W\f\323!\262\210\226@DW\240\304\240\024\023\024\207\300\007\034\215)\360\2102\035\321t\230\3018L\201$<\001\211(\tH\f\351\222\322\020\275@Z\034\032\233R\264\004\246#\232\n\207\322!\323P\002D4\030\364"
+	.string	"M\201$\260"
+	.ascii	"\266\020\312IMdR\316\216q\305\021-\001E:\341\224\005\260\205"
+	.ascii	"E"
+	.string	"&\035\321\247\341\tL$\032\217w)\230\016\233LTh<\241\363\245\020OG\021O\307\241\247\343N\023\220)x4\217\250p\270\302xlJz:\022\201\303#\212\024*\032\207H\244\323\t\310\237'\224\330\344dB\005\021\270\264\323\004\224&i0B8\324I\213N\306`\222\212c\322\260\t\231\364t\324 \224\242H\364hL\235\200I\302\342\360\204\244\024\210Lbr:\246\036@\233\220\033zP\"0\210\334I\217\350\212\3420i\210D\036y\202G\341\220\311,\016\231\260\007\202\350R\360\t\310\204\201\220\037\020\201+\212\306a\n$\032\233\216hZ\024!x\324\2006\265HqDS\342\020\004\"\020\204\240B\2051u\372@\2518\\J\215F\246\022\202\307!$\212\036\225P\023(Q\251\350\001\023\360\203\025M*0\020\321b\021\270\024Lzr\002&=\001\231\200\204D\343\022\022=.\245@S\340\212a\032\364"
+	.string	"\025\032O\034\207\300\242\3420\210\"\235\222\236\200LIOG\236/\205@\022\215\307\264h\f&\005\217\"\202\034L\214\bba$\376,)\r\227\200\204#\210\300c\352\204\026u\222\204#\204E\340\tB *\034J\277DAZt2~\200\022\215(~|\322/\205H\235\232R'c\022\023\213&\021\310#\272bx\024Zpc\023z\024\221\032\215G\021<iR\016R\t\230\3028<\221IJC\025E\343\007+P\023h\n$\241\207h\f\032S\343\021EP\3218D\036\321\025E\021\230X\2408\032S#\223\020\023\013\024B4Xl\201,V"
+	.ascii	"E:\375\244I%\322\342\320)\247\3051E\231P\"\232\"5.!M\240H'\241"
+	.ascii	"\025\250\320\246E4xDQ\244(R\205\212\t\240D\241\bD`:T\032\n\213"
+	.ascii	"\212C&\036\224\230\246\306\343R\372\004d\342I\2238@J\213C'\374"
+	.ascii	"\022B\r\2206@\200\n4\204\320\023\220\200\017,\250\300\b\017\300"
+	.ascii	"\301\020G\364i\310$\"]R\032\022U\210(\016\201L\"\202G\244\210"
+	.ascii	"\020F\302\"\220\211\311\030,\016\231v\236\264N\224Q\354\244\234"
+	.ascii	"RX\366\332\266\372&\311rN\376\234cG^l\201r\272(K\343\002\323"
+	.ascii	"\367tr>\3719\366s\254\3171\373\367w\242@Fy^\001\250Ir6Ir2i/\257"
+	.ascii	"\234\305r\262\004\341Z.\371\311\304\r\217YY\263\245\357)v\267"
+	.ascii	"\263 [\352\372\236J\200\332\316\314\204\231\341\001\370 r\"!"
+	.ascii	"r\036\3113\200\331\2300\256\260\237G\272\230.\324\270\251\353"
+	.ascii	"{\032\341S3#\323\367,\222#'\006\314\207\221\216!&\036\232\032"
+	.ascii	"8~}/0\003;\205\200\235Aj&\321\206.\313\303\177\002\371\031\004"
+	.ascii	"\350\356m\210\232\376\023ss\004\252\357\215d\340W\345\371e\332"
+	.ascii	"\355\305\225\201\321\367Uy\376H\323w0\310fx\331\274\006\344Y"
+	.ascii	"\005\371\222\354\301\302\n\363:{\334\0359vmO\256\224w;\273\316"
+	.ascii	"\304r\316A=h\334\260\245\365\275\021\025\026@\331\311u\3568\271"
+	.ascii	"N\0355++\004\030\331\r\270\275\314U\303\303\177\346\370\251\243"
+	.ascii	"\331\214Y\362\210Q\344\006\377'\016\275\253\226\203\b\330\215"
+	.ascii	"/<=\266\320v\330\260"
+	.string	"b|\266\316\240\261Q\243\252\2358\250\370\262\320\250\0032\343\025\304\352\334\272m7\230\360\325\320j\263\204\0055k\262\316`X\213\322\201U'\0018*a3\342\314\2501~o\256.\227\017\274\371\335YY\273s\314\212\032\034\031\267\312O\333\0305lb\230W\254\324\211\331;a\310\315-\307XU\231(,\317\222};\2209\251N\252\323\005\207%V\204\200\251/x\240\265\235.\356\306\025\226\325\367ERp\0076\276\237P&\337)U\365j2syA\345\r\300\207\334\027\223\275\\\325\345AI\210\0170g\324O)0\177W\336\276\334\376\353\324'mR\326\372\232\177?\363\257\223\323B\031\271*}_\004\205M\277\233q~\035s\007\2154N\372^C\037\376\315\276_\247\207\b\0301y}\257\301\205\204\340\250\263Q\204ZT\250\2450\006B\344\020R53\233\246\003\323\025@0`@\"\225\n\373^\017\023"
+	.string	"C\217k\265=M3\246Jf\244\240 i\226\275\003H}\003\233\022%s\212p{\325\213d\006Xk \"\002b\244C\345\b\225\016m4\361`\211\237\271q\016\327\332\230SAl\255\261\260\206\3760-D\237|\225\312:\237\257\255R\3146?I*\363\223\035h\364\"\t\375D\334\006\306\200Q\270\2043\372K\342\347[W\246\340\240\336j\n\022\214\323[~\201\b\250\017\f\324of\275(\032F\213I'\212.T\221o\327p.\t5\033\220Da\033\360\264\303:\006\311\\\2624:\257\035j\355\226\257,<\001a\310\2256\340U\025\200z"
+	.ascii	"pI\274\242,a\361\006\274i3\244,\330\341m2\253\304\327\350\262"
+	.ascii	"\f\344\353v\034\210\320\022rD\307!`\220\314\213\210\307(A \021"
+	.ascii	"\033u7\302i6\256\351j\332\314[3"
+	.string	"\214m\327b`\371\006]M\215\002\033\351\313\216\223\371R\203\003\214pu\333\306\260\365R\344y\376\2700\304i7e\335\3320\323\004\235!uPE\253\372\330\264\306\243W\346\275\220R\f\206\335K\200\320\314\026#L\021\345e\340\004\301\240\",\263!\033qZf\355{\261\227\261~\2504\300BTA\344\242-\341Cz\267\332\005\210\361\217\3656H\312c\225\313\324 v\"m1\207\bB\032r\337\360m\353e\250\254Y\320\022\314\t\367\217\236\305\205\370\n\317K\230\336r\247\3257\225\341\223\224L\345\307\303W,f\377\333\350\235u`\236hC\021\3241\206=\257\307,,\361\221/\330\277\3455f\276}\375-\302k\277\363_\363\264\366!\t\233qE\267\245\027\271\336\352=&V\360\022\334\344\227!\344c\200\265\255*%IFz\020H{J]\325\323\205\004\347\275\335\247\364\013\023\007d\276\237U\242\227\375\262"
+	.ascii	"\032\032R\206\342\033\240\222{\345eT\353\001\234\331w\307\202"
+	.ascii	"\311H\030^\277^\362\307"
+	.string	"\b\001q\322\377\304c*\237\216a.\3031l\3613\004\016\364P\\n\247&\372\027\223\240\311m^\225\340\361g\301\016JLE\360n/\340Yb|\302nfT\304\222\3744\006t\212\213\3706::\375'\203\b\335\372\323\213\322\354;\370=\336\301m\225\027'\"\375{0Y\251\255\t\274%\235O\370E\200\317\223\216\241\203\2621\246\b\304\250\323\357\337\306{\225\357\023\222\177\305D\246\277N\347\374\251\343\3005\0234*=\345\225\367\346\225\030\250\272\223\271_%~\270\202\354\004\234a\250d2g4\2662&\005Vq\260J\340\277E\271\001\034?\366\256\324\234-\231\3769\236\004\336U\236\206\213\312\327\305ms6\262\340\231\256'4\002"
+	.ascii	"\241\347A\377\216\244\201\332\0028*\332\344\273\3350:n\235\275"
+	.ascii	"\037\242\215\356\270\323\347\307\2615`\214=\332(\334\204h\263"
+	.ascii	"W@\317\320\035\211\334\264\273\035\261\027\345\334\265\262\223"
+	.ascii	"L`\030W\227?m\022}\216\332ew\355\26253~\020\346c\376]\271\325"
+	.ascii	"b\313\354\3305T\350\322\217W\224gS\f\037\337\203\200\217\203"
+	.ascii	"\243T\326M$\237\003,W\250\304\357\300\264\236\035>'\243\t\261"
+	.ascii	"'\324\201\230\202Af\266\315t{4W\254\232\232I\315\252ar\206\354"
+	.ascii	"\357\247\003\257\225\240P\3561\310\361\024\342\303H\031Qc\272"
+	.ascii	"\305\001\341\236T\315J\006\265\244\272\325\006\035\031\025\247"
+	.ascii	"k\350\211z\321\027piT\314\"^x\026SL\204\2566F\3500\324\340bI"
+	.ascii	"\302\256\226\324\240\004\360\367,\243\321_Bgr%\332^\274\374\002"
+	.ascii	"\262\347u1H\307\250\235\325\021A\nL\313\202\272+\241\263\212"
+	.ascii	"a\t\355t\347JN~\346\037W$\215u\2522\354b<\302_6\247\240\317\372"
+	.ascii	"\2031\017\230j0\345\326\345\r\003\367b\230\2751\f\007r{F\b\026"
+	.ascii	"B\263\f/\226\330\006\363$\273\034\300\216\342`pD\372y\332$]\325"
+	.ascii	"\300Z\340\360\333D(\004\271\247\322\331c}\255J<\236\330G*\300"
+	.ascii	"db\0170\352\036\372\007=\030\017\2023\036\277\r\016\004^\211"
+	.ascii	"\027\376!\234\024^\023\222H\244/$\346\372\017\255\346(:\004\350"
+	.ascii	"\377B\003\235\214\366\271\300\264yN\001Q\340\022\210\266H-\334"
+	.ascii	"eG\216\002\207\327\212I\033\361\243\n\303M\231\266$f\245W\210"
+	.ascii	"^Z#\351W\254\027\025f\331\214^x<\326\245\205\266\211\035_\305"
+	.ascii	"\324\326|\277\322r\205\262JP\234\246t\205\200=\ts\013_\317'\360"
+	.ascii	"['\331\307\310\326\234\263\254*LD\254\362\227+\333i\t,\006'\n"
+	.ascii	"\356\021\265[\353s|\357\f#\321*\013\234\257\204=\276\343\271"
+	.ascii	"`\027\361\264 k\207<\034\306\311\345\220t\2026\202r\324M\266"
+	.ascii	"\335>Q\360Q \330h\321\312\302\304\0328B\362\372\221d \264\246"
+	.ascii	"\310<4\375\317\261\2475\n\221\305\004:\263\337\201\034\336Gu"
+	.ascii	"\272\006\033B\200\3201\311\311\236\252\211\350\323\377"
+	.string	"\273\234\004\226Mv\325\256\312\332\275\277\316Ep\027\316\325~\361\b\3558\004\n \317\277M7%\223\037S\247H6\315o(\017|\025\257\t\216\177\317\004\213\243\323\t_\212\004\304(\025\252\357d{\211\277)- \320\323k\252\213mi\271<\360%\201\314\022\002\036]\236?\337u\345\374\f\264\275P\355\304{\267\321\272y\006\252\344\302\325\266\037Z\351@\376?\016)\211Tg\200z\026\332n\221\271\312~\302k,\306e.\264\201\023\302e\256_\325\030\307\013\324\205U\374\016\324I5;\206(\007\\\352\270$,\324\275\316pF4\337\352\376\335~2(\344Sa{O\372\243\224H W\022\013\311\357&K\245\311\302\311\214\303\032\354_\021\214\207\263M.\322\2607mo\242m\030\255o\177\225\002\210M\260C\027b\324\327\263R\001C\023\017\370\017Et\267\020\347\243N\003\367o\202\020\\M\320\327\016\302\343\023"
+	.ascii	"\023\346Q\316\260\322im\314\034\260\266U?\327\254\204\335\b\213"
+	.ascii	"\347\352\201b\343\0212q\377\344\250\322\230;z\364)\"\3704OxP"
+	.ascii	"\262\002\222H\263\354\241\261}\024\346T\217\256T\363xv\301P\247"
+	.ascii	"\373/`]\317\333\261\351D\312$3)\027\020k-\212\367\335\361\257"
+	.ascii	"&I}\256\372l\023LP\025\027\317\262\340k\335E\232\242y\240\301"
+	.ascii	"\023[\237\206\333\377+\034\317(\036\2552\nI{\200+z\n\021\353"
+	.ascii	"\264\327\260\026[\206\364\367\307\f\270\372\267z}'#\245\345\267"
+	.ascii	"\305\226\345\221\237\352\005\326\307\363\323\244\n\267\r\227"
+	.ascii	"7\206yi)\261q\336\210\366i\026H/\205\207\333\232\233p(\035\341"
+	.ascii	"1-Z\320\316A\367\177\311m\2018UZ\b3?\350IF\364\356\237\316\016"
+	.ascii	"l!\027\006\243\326v*V\321\305p\325\230\356,\205\343y0\374\240"
+	.ascii	"d\215\203\303\033P\214\315\266usE\007\236\317\276`V\340\304\004"
+	.ascii	"\377\212\250V\267\374\223\277\356b\001\003\324h\255\"K#\317&"
+	.ascii	"\002\323\277\36541U\267\177~\022\355\354\221\013\r@\214\234\264"
+	.ascii	"\263s\271\364\305q\251\310\357\262B\330\026\031\211#\314\006"
+	.ascii	"\310\245A\210i\234\265\233s\230W\241\266\200\017`\032}i\tV\360"
+	.ascii	"m\264\237\246\352\306\242J\307|\213`AA\217\355\f\242\371\025"
+	.ascii	"\225G\303\216\351N\321\211\231\343d\315\021y\374\"s>[(\017.\266"
+	.ascii	"\222\215\212\013\217\217]\031\f\313\267c\233=E3\326\301\210x"
+	.ascii	"Go\312\217\203o#:\016\364)\301\033\0250?\264X\214\3656\003\022"
+	.ascii	"\006\026WL\344z\001\357\306\212-(\335\344\303p9`\216\351\307"
+	.ascii	"\b\340j)\230\027-\\>@\336G\004\276\230g8\246\200\343*1\301\377"
+	.ascii	"\343\322\342\004\346\342\347\003\300P#\243\362W\254Rr\203\210"
+	.ascii	"\t\024f\020\363\301:\023d\313\b\260xA\365\262R\335\265I\250R"
+	.ascii	"i\325\321\234\033;\030\276\005h\277\303\t\340\200\225\024\223"
+	.ascii	"&\376e>\b\244\250)\365\320\367\2417+\206VEh\n\366\357m\252K\320"
+	.ascii	"\366\334\234\"\020*\263_Zu\267\006\030;\257\304\247\337\235\b"
+	.ascii	"?\342\3569\374\336\263d1Z\213H"
+	.string	"\236\007>\366\r\322sAm\365\202>\277\342\237L\377&\316n\2505\202\261\356\005\365:\274\361\016\313\327\340\234\272z\021\207\333U\335\207\236;Iq\357\031\367\005?\033Q\336\005\247-}\277\261\236/\251\206e\376Ol\277\235\037\007\256\037\277\263\264\317_\237f\275rl\023\317=5\225\253,\006F\374\372\240\267\337\271\255\t\177e\200\253pF]\335\245\276>-\007\235\367\201\345\364\330\300\347\344\377\277\3631&\2604\211\223\377\373\034\226]\034\373k\363\264\304G\225\265\356\375\314\240\376\321\317\020\256\337Lq\326-\316Q~#\337}\277E\321z\300\261\315\332V\332?\363\337U\364\245\342\326<n;\310o#\217K\364oFok\277c\t\257\321u\032\357\030\343\317Dnvq\031\322d\256kq1{\371l\253{\tR\017\241\273l\370\177\331S\230&O\270\323\2047\261yi\351\274E\316\002t\017\351\031\177W"
+	.ascii	"\fa\232a\355\b\244\275\300\370\200!\373\027q\247e\230n\333\344"
+	.ascii	"\352t\223>:\250K4\350~]\215\376(\243-\335\212\232\321s\024\177"
+	.ascii	"(\360SM\025v\201!\277,\031\216\024`'\214\341\327\003{)\343\303"
+	.ascii	"\274k\314\007\236\020\022\376\350'\257\255\211\276\314X\304\007"
+	.ascii	"\247\313\256"
+	.text
+	.section	.gnu.lto_.symtab.1389c0dd26bd7c54,"e",@progbits
+	.string	"pgResetFn_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"isMotorProtocolDshot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"initEscEndpoints"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"flight3DConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"motorOutputLow"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"motorOutputHigh"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"currentMixerMode"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"mixerConfigureOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"customMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\300"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"mixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"mixerLoadMix"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"convertExternalToMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"convertMotorToExternal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"customMotorMixer_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"pgResetTemplate_flight3DConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"flight3DConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"axisPIDf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\002"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1389c0dd26bd7c54,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
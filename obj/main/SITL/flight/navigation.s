@@ -0,0 +1,9528 @@
+	.file	"navigation.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	navigation.c.0c727d2e
+	.weak	navigation.c.0c727d2e
+navigation.c.0c727d2e:
+	.long	0x6c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2
+	.long	.LASF1610
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1600
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1601
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1602
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1603
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1604
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1605
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1606
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1607
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1608
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1609
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 1 "./src/main/flight/navigation.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 2 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.file 5 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 7 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 8 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x8
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 11 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 13 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 21 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1151
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1191
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x1d
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 33 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x21
+	.file 34 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 35 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x23
+	.file 36 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 37 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x25
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1599
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1150
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1172
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1190
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1193
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1198
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1222
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1240
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1241
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1242
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1243
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1253
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1263
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1265
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1267
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1269
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1271
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1272
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1273
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1275
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1276
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1278
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1256
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1421
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1498
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1515
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1519
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1522
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1427
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1547
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1548
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1549
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1550
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1551
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1552
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1553
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1554
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1567
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1575
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1598
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xa
+	.long	.LASF1
+	.long	.LASF1611
+	.long	.LASF1612
+	.long	.LASF1613
+	.long	.LASF1614
+	.long	.LASF1615
+	.long	.LASF1616
+	.long	.LASF1617
+	.long	.LASF1618
+	.long	.LASF1619
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x26
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1620
+	.byte	0x1
+	.long	.LASF1621
+	.byte	0x8
+	.long	.LASF1622
+	.byte	0x9
+	.long	.LASF1623
+	.byte	0x9
+	.long	.LASF1623
+	.byte	0x8
+	.long	.LASF1624
+	.byte	0x5
+	.long	.LASF1625
+	.byte	0x8
+	.long	.LASF1626
+	.byte	0x8
+	.long	.LASF1627
+	.byte	0x5
+	.long	.LASF1628
+	.byte	0x5
+	.long	.LASF1629
+	.byte	0x7
+	.long	.LASF1630
+	.byte	0x5
+	.long	.LASF1631
+	.byte	0x6
+	.long	.LASF1632
+	.byte	0x6
+	.long	.LASF1633
+	.byte	0x5
+	.long	.LASF1634
+	.byte	0x5
+	.long	.LASF1635
+	.byte	0x5
+	.long	.LASF1636
+	.byte	0x5
+	.long	.LASF1637
+	.byte	0x5
+	.long	.LASF1638
+	.byte	0x5
+	.long	.LASF1639
+	.byte	0x8
+	.long	.LASF1640
+	.byte	0x5
+	.long	.LASF1641
+	.byte	0x5
+	.long	.LASF1642
+	.byte	0x5
+	.long	.LASF1643
+	.byte	0x5
+	.long	.LASF1644
+	.byte	0x5
+	.long	.LASF1645
+	.byte	0x5
+	.long	.LASF1646
+	.byte	0x5
+	.long	.LASF1647
+	.byte	0x5
+	.long	.LASF1648
+	.byte	0x5
+	.long	.LASF1649
+	.byte	0x5
+	.long	.LASF1650
+	.byte	0x5
+	.long	.LASF1651
+	.byte	0x4
+	.long	.LASF1652
+	.byte	0x3
+	.long	.LASF1653
+	.byte	0x2
+	.long	.LASF1654
+	.byte	0x9
+	.long	.LASF1655
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1125:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF796:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1300:
+	.string	"MATH_ERREXCEPT 2"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1029:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1177:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF1121:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1454:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1012:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1509:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1461:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1595:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF905:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1202:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF1328:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1455:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF833:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1128:
+	.string	"__DECL_SIMD_tanh"
+.LASF1548:
+	.string	"USE_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1434:
+	.string	"USE_SERIALRX_CRSF "
+.LASF969:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF949:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF806:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1607:
+	.string	"char"
+.LASF909:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1372:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF1025:
+	.string	"__DECL_SIMD_tan "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1010:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1094:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1069:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1379:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF931:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF764:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1528:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1204:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF973:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1456:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF901:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1052:
+	.string	"__DECL_SIMD_exp"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1309:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1378:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF988:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1257:
+	.string	"_Marg_ long double"
+.LASF870:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1228:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1601:
+	.string	"short unsigned int"
+.LASF902:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF810:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1501:
+	.string	"__WCHAR_T__ "
+.LASF1462:
+	.string	"USE_SENSOR_NAMES "
+.LASF976:
+	.string	"__DECL_SIMD_acoshf "
+.LASF781:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1341:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF954:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF907:
+	.string	"__DECL_SIMD_sinhl "
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF769:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF794:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1087:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1130:
+	.string	"__DECL_SIMD_tanhf"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1445:
+	.string	"TELEMETRY_HOTT "
+.LASF788:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF927:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1096:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1176:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF1295:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF763:
+	.string	"_MATH_H 1"
+.LASF1592:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1278:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1471:
+	.string	"_T_PTRDIFF_ "
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF777:
+	.string	"__DECL_SIMD_sinl "
+.LASF1318:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1335:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1360:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1382:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1304:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF798:
+	.string	"__DECL_SIMD_logf16 "
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1168:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1411:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1451:
+	.string	"CMS "
+.LASF854:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1258:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF797:
+	.string	"__DECL_SIMD_logl "
+.LASF1365:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1303:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1142:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1405:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF1034:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1492:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1393:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF771:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1567:
+	.string	"TELEMETRY_IBUS"
+.LASF805:
+	.string	"__DECL_SIMD_exp "
+.LASF1015:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1140:
+	.string	"__DECL_SIMD_tan"
+.LASF880:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF897:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1219:
+	.string	"_Mdouble_"
+.LASF1363:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1146:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1375:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF1076:
+	.string	"__DECL_SIMD_exp2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1357:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF1534:
+	.string	"BARO "
+.LASF1293:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1055:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1385:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1116:
+	.string	"__DECL_SIMD_atanh"
+.LASF989:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1511:
+	.string	"___int_wchar_t_h "
+.LASF807:
+	.string	"__DECL_SIMD_expl "
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1524:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1067:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1573:
+	.string	"VTX_TRAMP"
+.LASF1199:
+	.string	"FP_INT_UPWARD 0"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1060:
+	.string	"__DECL_SIMD_acos"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1269:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF546:
+	.string	"__always_inline"
+.LASF871:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1152:
+	.string	"__HAVE_FLOAT16 0"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF903:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1197:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1220:
+	.string	"__MATH_PRECNAME"
+.LASF940:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1080:
+	.string	"__DECL_SIMD_exp10"
+.LASF1307:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1104:
+	.string	"__DECL_SIMD_log10"
+.LASF1230:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1088:
+	.string	"__DECL_SIMD_expm1"
+.LASF872:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1073:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1223:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1351:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1190:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1570:
+	.string	"VTX_COMMON"
+.LASF1040:
+	.string	"__DECL_SIMD_sin"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1207:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1458:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1390:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1485:
+	.string	"_T_SIZE_ "
+.LASF1213:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF977:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1284:
+	.string	"__MATHCALL_NARROW"
+.LASF963:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1457:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1261:
+	.string	"_Mret_ _Float32"
+.LASF1205:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1112:
+	.string	"__DECL_SIMD_log1p"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1241:
+	.string	"__MATHDECL_1"
+.LASF1113:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1097:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF1561:
+	.string	"TELEMETRY_HOTT"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1233:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF986:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1496:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1156:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1090:
+	.string	"__DECL_SIMD_expm1f"
+.LASF929:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1110:
+	.string	"__DECL_SIMD_log2f"
+.LASF958:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF853:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF865:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF883:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1296:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF994:
+	.string	"__DECL_SIMD_erff128x "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1148:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1564:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1334:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF1359:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF1493:
+	.string	"_SIZE_T_DECLARED "
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1078:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1532:
+	.string	"ACC "
+.LASF1039:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF922:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1453:
+	.string	"TELEMETRY_IBUS "
+.LASF1432:
+	.string	"USE_PWM "
+.LASF890:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1502:
+	.string	"_WCHAR_T "
+.LASF966:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1133:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF824:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1274:
+	.string	"_Mret_ _Float64"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1401:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF1477:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1396:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1171:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF402:
+	.string	"false 0"
+.LASF891:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF858:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1588:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1512:
+	.string	"__INT_WCHAR_T_H "
+.LASF936:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF861:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1314:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF830:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1498:
+	.string	"__size_t "
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1275:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF892:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1098:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1000:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF793:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1105:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF862:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1298:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1268:
+	.string	"_Marg_ _Float128"
+.LASF1167:
+	.string	"__f32x(x) x ##f32x"
+.LASF879:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1201:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1321:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1246:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1282:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1600:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1271:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1253:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF822:
+	.string	"__DECL_SIMD_powf32x "
+.LASF953:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1182:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1135:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1478:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1049:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF364:
+	.string	"__k8 1"
+.LASF1180:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF1608:
+	.string	"float"
+.LASF1391:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1530:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1075:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF987:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1549:
+	.string	"USE_PWM"
+.LASF1352:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF848:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1470:
+	.string	"_PTRDIFF_T "
+.LASF1578:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1037:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF881:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1115:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF1402:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF944:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF913:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1449:
+	.string	"USE_SERVOS "
+.LASF1350:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF545:
+	.string	"__wur "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1066:
+	.string	"__DECL_SIMD_atanf"
+.LASF1366:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF838:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1299:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1227:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1277:
+	.string	"_Mret_ _Float64x"
+.LASF1292:
+	.string	"FP_NORMAL 4"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1508:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1535:
+	.string	"USE_FAKE_BARO "
+.LASF1250:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1440:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1215:
+	.string	"_Mdouble_ double"
+.LASF1376:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF860:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1342:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF886:
+	.string	"__DECL_SIMD_coshf "
+.LASF967:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1395:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF959:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1018:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF864:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1237:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1374:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF1157:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1214:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1217:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF918:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1522:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF774:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1429:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF937:
+	.string	"__DECL_SIMD_log10l "
+.LASF429:
+	.string	"__USE_GNU"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1340:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF814:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1138:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1584:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF1159:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF765:
+	.string	"__DECL_SIMD_cos "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1398:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1111:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1030:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF924:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF943:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF846:
+	.string	"__DECL_SIMD_asinf "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1483:
+	.string	"_SIZE_T "
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1131:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1247:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1523:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1218:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1231:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1084:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF813:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF970:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF804:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1083:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF766:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1129:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1154:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1495:
+	.string	"___int_size_t_h "
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1320:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1490:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1317:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1403:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF996:
+	.string	"__DECL_SIMD_tanhf "
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1183:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1221:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF1443:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF831:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1364:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1119:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1343:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1137:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1023:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1005:
+	.string	"__DECL_SIMD_asinh "
+.LASF1404:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1273:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1513:
+	.string	"_GCC_WCHAR_T "
+.LASF1415:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1033:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1562:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1324:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF832:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1289:
+	.string	"FP_INFINITE 1"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1280:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1281:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF775:
+	.string	"__DECL_SIMD_sin "
+.LASF1529:
+	.string	"LED0_PIN NONE"
+.LASF1563:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1516:
+	.string	"_BSD_WCHAR_T_"
+.LASF1043:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1053:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF1136:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1150:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1488:
+	.string	"_SIZE_T_ "
+.LASF1059:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF1294:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1499:
+	.string	"__need_size_t"
+.LASF1141:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF1525:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1480:
+	.string	"__need_ptrdiff_t"
+.LASF818:
+	.string	"__DECL_SIMD_powf16 "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF849:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1175:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1423:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF887:
+	.string	"__DECL_SIMD_coshl "
+.LASF1222:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1235:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1467:
+	.string	"_STDDEF_H "
+.LASF972:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1086:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1249:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF868:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1191:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1161:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1407:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF803:
+	.string	"__DECL_SIMD_logf64x "
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1224:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1590:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1569:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF839:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF921:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1151:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF898:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1185:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1409:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1559:
+	.string	"LED_STRIP"
+.LASF1427:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1103:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1149:
+	.string	"__f128(x) x ##f128"
+.LASF978:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1226:
+	.string	"_Mdouble_ long double"
+.LASF778:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1045:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1555:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1019:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1556:
+	.string	"USE_SERIALRX_SUMH"
+.LASF930:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1061:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF847:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1026:
+	.string	"__DECL_SIMD_tanf "
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF919:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1353:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1554:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1262:
+	.string	"_Marg_ _Float32x"
+.LASF767:
+	.string	"__DECL_SIMD_cosl "
+.LASF1491:
+	.string	"_SIZE_T_DEFINED "
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1186:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1209:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1518:
+	.string	"NULL"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1225:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1500:
+	.string	"__wchar_t__ "
+.LASF1581:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1188:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1410:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF499:
+	.string	"__PMT"
+.LASF1514:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF1387:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1576:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF993:
+	.string	"__DECL_SIMD_erff64x "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1426:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1313:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1575:
+	.string	"USE_RESOURCE_MGMT"
+.LASF946:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1361:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1371:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF995:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF795:
+	.string	"__DECL_SIMD_log "
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1147:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF971:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1108:
+	.string	"__DECL_SIMD_log2"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1370:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF1306:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1123:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF799:
+	.string	"__DECL_SIMD_logf32 "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1092:
+	.string	"__DECL_SIMD_sinh"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF935:
+	.string	"__DECL_SIMD_log10 "
+.LASF1586:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF844:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1506:
+	.string	"_WCHAR_T_ "
+.LASF1050:
+	.string	"__DECL_SIMD_logf"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1063:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF843:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1610:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1163:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1422:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1484:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1234:
+	.string	"_Mdouble_ _Float128"
+.LASF1344:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1014:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1389:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1392:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF961:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1106:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1437:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF900:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1408:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF957:
+	.string	"__DECL_SIMD_log1pl "
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF885:
+	.string	"__DECL_SIMD_cosh "
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF884:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF789:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1520:
+	.string	"__need_NULL"
+.LASF962:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1283:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1236:
+	.string	"_Mdouble_ _Float32x"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1431:
+	.string	"USE_PPM "
+.LASF851:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF819:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF950:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1558:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF835:
+	.string	"__DECL_SIMD_atan "
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1585:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1242:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1038:
+	.string	"__DECL_SIMD_cosf"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1265:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1444:
+	.string	"TELEMETRY_FRSKY "
+.LASF1100:
+	.string	"__DECL_SIMD_atan2"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF869:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1251:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF852:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1256:
+	.string	"__MATHCALL_NAME"
+.LASF955:
+	.string	"__DECL_SIMD_log1p "
+.LASF1027:
+	.string	"__DECL_SIMD_tanl "
+.LASF882:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1243:
+	.string	"__MATHDECL"
+.LASF981:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1354:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF1099:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1604:
+	.string	"signed char"
+.LASF1164:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF800:
+	.string	"__DECL_SIMD_logf64 "
+.LASF783:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF899:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF1481:
+	.string	"__size_t__ "
+.LASF1447:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1286:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1448:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1527:
+	.string	"U_ID_1 1"
+.LASF904:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1179:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1134:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1547:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1510:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1114:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF979:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF779:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1081:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1065:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1166:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1489:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1189:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1381:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF1416:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF947:
+	.string	"__DECL_SIMD_log2l "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1048:
+	.string	"__DECL_SIMD_log"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1155:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1064:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1589:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1259:
+	.string	"_Mret_ double"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1255:
+	.string	"_Marg_"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1441:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1008:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1469:
+	.string	"_ANSI_STDDEF_H "
+.LASF791:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1054:
+	.string	"__DECL_SIMD_expf"
+.LASF923:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1419:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1316:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1181:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1579:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1435:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF792:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF951:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1465:
+	.string	"VTX_SMARTAUDIO "
+.LASF1165:
+	.string	"__f32(x) x ##f32"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1145:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1290:
+	.string	"FP_ZERO 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF808:
+	.string	"__DECL_SIMD_expf16 "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1068:
+	.string	"__DECL_SIMD_asin"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF952:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1450:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1089:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1109:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1203:
+	.string	"FP_INT_TONEAREST 4"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1606:
+	.string	"long int"
+.LASF1072:
+	.string	"__DECL_SIMD_hypot"
+.LASF1042:
+	.string	"__DECL_SIMD_sinf"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF948:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF984:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF911:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF960:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1452:
+	.string	"TELEMETRY_CRSF "
+.LASF1474:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF1358:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1473:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF912:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1210:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF915:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1566:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1216:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1487:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1044:
+	.string	"__DECL_SIMD_sincos"
+.LASF1526:
+	.string	"U_ID_0 0"
+.LASF1117:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1127:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1169:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1319:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF945:
+	.string	"__DECL_SIMD_log2 "
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1192:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1521:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF933:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF964:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1486:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1413:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1170:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1245:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF974:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1356:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF1003:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1172:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1442:
+	.string	"LED_STRIP "
+.LASF815:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1560:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1302:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1315:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1206:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1503:
+	.string	"_T_WCHAR_ "
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1400:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF784:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1369:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1515:
+	.string	"__DEFINED_wchar_t "
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF1418:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1537:
+	.string	"USE_FAKE_MAG "
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1058:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1574:
+	.string	"BLACKBOX"
+.LASF1071:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1248:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF941:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1577:
+	.string	"USE_DSHOT"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1001:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1158:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1397:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF938:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1348:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF1552:
+	.string	"USE_SERIALRX_IBUS"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF855:
+	.string	"__DECL_SIMD_hypot "
+.LASF1193:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF895:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1276:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF770:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF942:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF834:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1198:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF1557:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1460:
+	.string	"USE_RX_MSP "
+.LASF401:
+	.string	"true 1"
+.LASF772:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1036:
+	.string	"__DECL_SIMD_cos"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF826:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1346:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF812:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1009:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1074:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1153:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF821:
+	.string	"__DECL_SIMD_powf128 "
+.LASF914:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1085:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1425:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1550:
+	.string	"SERIAL_RX"
+.LASF1599:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1091:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1021:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF850:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1519:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1006:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF982:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1580:
+	.string	"USE_PROFILE "
+.LASF1384:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1572:
+	.string	"VTX_SMARTAUDIO"
+.LASF1436:
+	.string	"USE_SERIALRX_SBUS "
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1107:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1553:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1338:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1424:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1022:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF876:
+	.string	"__DECL_SIMD_exp10f "
+.LASF809:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1254:
+	.string	"_Mret_"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1517:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1174:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1472:
+	.string	"_T_PTRDIFF "
+.LASF840:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1032:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF975:
+	.string	"__DECL_SIMD_acosh "
+.LASF1139:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1031:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1399:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1533:
+	.string	"USE_FAKE_ACC "
+.LASF1337:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1285:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1417:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1196:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1288:
+	.string	"FP_NAN 0"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF932:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF888:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF985:
+	.string	"__DECL_SIMD_erf "
+.LASF1312:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1077:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1368:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1208:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF801:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1122:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1325:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1020:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1101:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1047:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1394:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1200:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF825:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1187:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF920:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF802:
+	.string	"__DECL_SIMD_logf32x "
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1428:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF990:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1266:
+	.string	"_Marg_ _Float64x"
+.LASF1414:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1057:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1609:
+	.string	"double"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF828:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1367:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF1062:
+	.string	"__DECL_SIMD_acosf"
+.LASF1120:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1531:
+	.string	"USE_FAKE_GYRO "
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF998:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1002:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1507:
+	.string	"_BSD_WCHAR_T_ "
+.LASF873:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1594:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1311:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1194:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1297:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF836:
+	.string	"__DECL_SIMD_atanf "
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1013:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1178:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF910:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1412:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1430:
+	.string	"USE_CLI "
+.LASF1184:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF1126:
+	.string	"__DECL_SIMD_erff"
+.LASF1459:
+	.string	"USE_MSP_PUSH "
+.LASF827:
+	.string	"__DECL_SIMD_acosl "
+.LASF1263:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1420:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1079:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1211:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF816:
+	.string	"__DECL_SIMD_powf "
+.LASF1308:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1504:
+	.string	"_T_WCHAR "
+.LASF1497:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1446:
+	.string	"TELEMETRY_LTM "
+.LASF1468:
+	.string	"_STDDEF_H_ "
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF845:
+	.string	"__DECL_SIMD_asin "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1035:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1244:
+	.string	"__MATHCALL"
+.LASF939:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1007:
+	.string	"__DECL_SIMD_asinhl "
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1568:
+	.string	"USE_DASHBOARD"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1305:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF992:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1464:
+	.string	"VTX_CONTROL "
+.LASF965:
+	.string	"__DECL_SIMD_atanh "
+.LASF1362:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF877:
+	.string	"__DECL_SIMD_exp10l "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1475:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1143:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1070:
+	.string	"__DECL_SIMD_asinf"
+.LASF1132:
+	.string	"__DECL_SIMD_asinh"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF894:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF856:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1095:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF790:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF841:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1267:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF1291:
+	.string	"FP_SUBNORMAL 3"
+.LASF1160:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1238:
+	.string	"_Mdouble_ _Float64x"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1330:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1118:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF934:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF820:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1333:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF786:
+	.string	"__DECL_SIMD_sincosf "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF842:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1536:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF866:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF782:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1173:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1144:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1544:
+	.string	"USE_UART7 "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF983:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1587:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1229:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF956:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1339:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1041:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF893:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1438:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1345:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1004:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF875:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1596:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF889:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF863:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1421:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF980:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF780:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1323:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1028:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1406:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1162:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF823:
+	.string	"__DECL_SIMD_powf64x "
+.LASF773:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1582:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1082:
+	.string	"__DECL_SIMD_exp10f"
+.LASF837:
+	.string	"__DECL_SIMD_atanl "
+.LASF1545:
+	.string	"USE_UART8 "
+.LASF1264:
+	.string	"_Marg_ _Float64"
+.LASF1016:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1505:
+	.string	"__WCHAR_T "
+.LASF1252:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1476:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF968:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF991:
+	.string	"__DECL_SIMD_erff128 "
+.LASF874:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF908:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF829:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1326:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1331:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1272:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1380:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF916:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1093:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF817:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1355:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF999:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1583:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1232:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1347:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1239:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1494:
+	.string	"__DEFINED_size_t "
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1433:
+	.string	"SERIAL_RX "
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1551:
+	.string	"USE_SERIALRX_CRSF"
+.LASF896:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1538:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1591:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1322:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1373:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1546:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF857:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF768:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1439:
+	.string	"USE_SERIALRX_SUMH "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1603:
+	.string	"long unsigned int"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1539:
+	.string	"USE_UART2 "
+.LASF1463:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1466:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1597:
+	.string	"__disable_irq() "
+.LASF1124:
+	.string	"__DECL_SIMD_erf"
+.LASF925:
+	.string	"__DECL_SIMD_atan2 "
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1377:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1571:
+	.string	"VTX_CONTROL"
+.LASF787:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1260:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1329:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF1605:
+	.string	"short int"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF867:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1332:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1540:
+	.string	"USE_UART3 "
+.LASF1212:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1327:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1102:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1482:
+	.string	"__SIZE_T__ "
+.LASF1056:
+	.string	"__DECL_SIMD_pow"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF906:
+	.string	"__DECL_SIMD_sinhf "
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1270:
+	.string	"_Mret_ _Float32x"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF1386:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF1598:
+	.string	"__enable_irq() "
+.LASF1602:
+	.string	"unsigned int"
+.LASF1541:
+	.string	"USE_UART4 "
+.LASF859:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1024:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1287:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF926:
+	.string	"__DECL_SIMD_atan2f "
+.LASF785:
+	.string	"__DECL_SIMD_sincos "
+.LASF997:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1336:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF878:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF776:
+	.string	"__DECL_SIMD_sinf "
+.LASF1051:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF928:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF811:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1349:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1542:
+	.string	"USE_UART5 "
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1240:
+	.string	"__MATHDECL_1_IMPL"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1565:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1195:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1017:
+	.string	"__DECL_SIMD_erfcl "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1046:
+	.string	"__DECL_SIMD_sincosf"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1593:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1479:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1301:
+	.string	"math_errhandling 0"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1310:
+	.string	"M_E 2.7182818284590452354"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1011:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1388:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1543:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1383:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF917:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1647:
+	.string	"mathcalls-helper-functions.h"
+.LASF1639:
+	.string	"math.h"
+.LASF1630:
+	.string	"long-double.h"
+.LASF1651:
+	.string	"platform.h"
+.LASF1648:
+	.string	"mathcalls.h"
+.LASF1653:
+	.string	"target.h"
+.LASF1641:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1624:
+	.string	"libc-header-start.h"
+.LASF1617:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1640:
+	.string	"math-vector.h"
+.LASF1637:
+	.string	"stdint-intn.h"
+.LASF1616:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1619:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1631:
+	.string	"stubs.h"
+.LASF1612:
+	.string	"src/main/target/SITL"
+.LASF1628:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1645:
+	.string	"fp-logb.h"
+.LASF1615:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF0:
+	.string	"./src/main/flight/navigation.c"
+.LASF1626:
+	.string	"features-time64.h"
+.LASF1633:
+	.string	"types.h"
+.LASF1642:
+	.string	"floatn.h"
+.LASF1622:
+	.string	"stdbool.h"
+.LASF1618:
+	.string	"/usr/include"
+.LASF1643:
+	.string	"floatn-common.h"
+.LASF1611:
+	.string	"src/main/flight"
+.LASF1634:
+	.string	"typesizes.h"
+.LASF1620:
+	.string	"navigation.c"
+.LASF1625:
+	.string	"features.h"
+.LASF1635:
+	.string	"time64.h"
+.LASF1650:
+	.string	"iscanonical.h"
+.LASF1638:
+	.string	"stdint-uintn.h"
+.LASF1613:
+	.string	"src/main/target"
+.LASF1614:
+	.string	"src/main"
+.LASF1644:
+	.string	"flt-eval-method.h"
+.LASF1649:
+	.string	"mathcalls-narrow.h"
+.LASF1636:
+	.string	"wchar.h"
+.LASF1646:
+	.string	"fp-fast.h"
+.LASF1652:
+	.string	"common.h"
+.LASF1629:
+	.string	"cdefs.h"
+.LASF1623:
+	.string	"stdint.h"
+.LASF1654:
+	.string	"stddef.h"
+.LASF1632:
+	.string	"stubs-64.h"
+.LASF1627:
+	.string	"wordsize.h"
+.LASF1655:
+	.string	"common_post.h"
+.LASF1621:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.8fd53a1a2eb6fdd7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8fd53a1a2eb6fdd7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.8fd53a1a2eb6fdd7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.8fd53a1a2eb6fdd7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8fd53a1a2eb6fdd7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.8fd53a1a2eb6fdd7,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.8fd53a1a2eb6fdd7,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.8fd53a1a2eb6fdd7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8fd53a1a2eb6fdd7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.8fd53a1a2eb6fdd7,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.8fd53a1a2eb6fdd7,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symtab.8fd53a1a2eb6fdd7,"e",@progbits
+	.text
+	.section	.gnu.lto_.ext_symtab.8fd53a1a2eb6fdd7,"e",@progbits
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,16065 @@
+	.file	"pid.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/build/debug.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/common/filter.h"
+	.file 8 "./src/main/config/parameter_group.h"
+	.file 9 "./src/main/flight/pid.h"
+	.file 10 "./src/main/fc/runtime_config.h"
+	.file 11 "./src/main/flight/imu.h"
+	.file 12 "./src/main/sensors/gyro.h"
+	.file 13 "./src/main/sensors/sensors.h"
+	.file 14 "./src/main/sensors/acceleration.h"
+	.file 15 "./src/main/flight/pid.c"
+	.file 16 "./src/main/fc/fc_rc.h"
+	.file 17 "./src/main/flight/mixer.h"
+	.file 18 "/usr/include/string.h"
+	.file 19 "./src/main/common/maths.h"
+	.file 20 "./src/main/fc/rc_controls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	pid.c.d71c8c1a
+	.weak	pid.c.d71c8c1a
+pid.c.d71c8c1a:
+	.long	0xfa3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF2168
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1919
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1920
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1921
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1922
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1923
+	.uleb128 0x5
+	.long	.LASF1924
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.long	.LASF1925
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1926
+	.uleb128 0x5
+	.long	.LASF1927
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1928
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1929
+	.uleb128 0x24
+	.byte	0x8
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1930
+	.uleb128 0x5
+	.long	.LASF1931
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF1932
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x11
+	.long	0x9f
+	.uleb128 0x5
+	.long	.LASF1933
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1934
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x5
+	.long	.LASF1935
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1936
+	.uleb128 0x11
+	.long	0xd4
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1937
+	.uleb128 0x8
+	.long	0x93
+	.long	0xf7
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1938
+	.byte	0x5
+	.byte	0x15
+	.byte	0x10
+	.long	0xe7
+	.uleb128 0xa
+	.long	.LASF1939
+	.byte	0x5
+	.byte	0x16
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x5
+	.byte	0x30
+	.long	0x1a5
+	.uleb128 0x1
+	.long	.LASF1940
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1941
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1942
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1943
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1944
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1946
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1947
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1948
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1950
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1951
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1952
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1953
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1954
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1955
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1956
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1957
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1958
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1959
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1960
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1961
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1962
+	.byte	0x16
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x6
+	.byte	0x1d
+	.long	0x1c3
+	.uleb128 0x1
+	.long	.LASF1963
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1964
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1965
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x6
+	.byte	0x25
+	.long	0x1db
+	.uleb128 0x1
+	.long	.LASF1966
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1968
+	.byte	0x6
+	.byte	0x28
+	.byte	0x3
+	.long	0x1c3
+	.uleb128 0x11
+	.long	0x1db
+	.uleb128 0x8
+	.long	0xd4
+	.long	0x1fc
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1971
+	.byte	0x10
+	.byte	0x7
+	.byte	0x1c
+	.long	0x239
+	.uleb128 0x2
+	.long	.LASF1969
+	.byte	0x7
+	.byte	0x1d
+	.byte	0xb
+	.long	0xd4
+	.byte	0
+	.uleb128 0x7
+	.string	"k"
+	.byte	0x7
+	.byte	0x1e
+	.byte	0xb
+	.long	0xd4
+	.byte	0x4
+	.uleb128 0x7
+	.string	"RC"
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xb
+	.long	0xd4
+	.byte	0x8
+	.uleb128 0x7
+	.string	"dT"
+	.byte	0x7
+	.byte	0x20
+	.byte	0xb
+	.long	0xd4
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1970
+	.byte	0x7
+	.byte	0x21
+	.byte	0x3
+	.long	0x1fc
+	.uleb128 0x14
+	.long	.LASF1972
+	.byte	0x1c
+	.byte	0x7
+	.byte	0x24
+	.long	0x2a6
+	.uleb128 0x7
+	.string	"b0"
+	.byte	0x7
+	.byte	0x25
+	.byte	0xb
+	.long	0xd4
+	.byte	0
+	.uleb128 0x7
+	.string	"b1"
+	.byte	0x7
+	.byte	0x25
+	.byte	0xf
+	.long	0xd4
+	.byte	0x4
+	.uleb128 0x7
+	.string	"b2"
+	.byte	0x7
+	.byte	0x25
+	.byte	0x13
+	.long	0xd4
+	.byte	0x8
+	.uleb128 0x7
+	.string	"a1"
+	.byte	0x7
+	.byte	0x25
+	.byte	0x17
+	.long	0xd4
+	.byte	0xc
+	.uleb128 0x7
+	.string	"a2"
+	.byte	0x7
+	.byte	0x25
+	.byte	0x1b
+	.long	0xd4
+	.byte	0x10
+	.uleb128 0x7
+	.string	"d1"
+	.byte	0x7
+	.byte	0x26
+	.byte	0xb
+	.long	0xd4
+	.byte	0x14
+	.uleb128 0x7
+	.string	"d2"
+	.byte	0x7
+	.byte	0x26
+	.byte	0xf
+	.long	0xd4
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1973
+	.byte	0x7
+	.byte	0x27
+	.byte	0x3
+	.long	0x245
+	.uleb128 0x25
+	.long	.LASF1974
+	.value	0x1f0
+	.byte	0x7
+	.byte	0x34
+	.byte	0x10
+	.long	0x302
+	.uleb128 0x2
+	.long	.LASF1975
+	.byte	0x7
+	.byte	0x35
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1976
+	.byte	0x7
+	.byte	0x36
+	.byte	0x9
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1977
+	.byte	0x7
+	.byte	0x37
+	.byte	0x9
+	.long	0x70
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1978
+	.byte	0x7
+	.byte	0x38
+	.byte	0xb
+	.long	0xd4
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1969
+	.byte	0x7
+	.byte	0x39
+	.byte	0xb
+	.long	0x302
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	0xd4
+	.long	0x312
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x77
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1979
+	.byte	0x7
+	.byte	0x3a
+	.byte	0x3
+	.long	0x2b2
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x7
+	.byte	0x3c
+	.long	0x33c
+	.uleb128 0x1
+	.long	.LASF1980
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1981
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1982
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x7
+	.byte	0x42
+	.long	0x354
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1985
+	.byte	0x7
+	.byte	0x45
+	.byte	0x3
+	.long	0x33c
+	.uleb128 0x5
+	.long	.LASF1986
+	.byte	0x7
+	.byte	0x51
+	.byte	0x11
+	.long	0x36c
+	.uleb128 0xb
+	.long	0x371
+	.uleb128 0x26
+	.long	0xd4
+	.long	0x385
+	.uleb128 0x3
+	.long	0x8a
+	.uleb128 0x3
+	.long	0xd4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1987
+	.byte	0x8
+	.byte	0x19
+	.byte	0x12
+	.long	0xb0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x8
+	.byte	0x21
+	.long	0x3bf
+	.uleb128 0x15
+	.long	.LASF1988
+	.value	0xfff
+	.uleb128 0x15
+	.long	.LASF1989
+	.value	0xf000
+	.uleb128 0x15
+	.long	.LASF1990
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1992
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1993
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xf
+	.long	0x3cb
+	.uleb128 0x27
+	.long	0x3db
+	.uleb128 0x3
+	.long	0x8a
+	.uleb128 0x3
+	.long	0x70
+	.byte	0
+	.uleb128 0x1c
+	.byte	0x8
+	.byte	0x8
+	.byte	0x35
+	.byte	0x5
+	.long	0x3fc
+	.uleb128 0x18
+	.string	"ptr"
+	.byte	0x8
+	.byte	0x36
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x18
+	.string	"fn"
+	.byte	0x8
+	.byte	0x37
+	.byte	0x16
+	.long	0x3fc
+	.byte	0
+	.uleb128 0xb
+	.long	0x3bf
+	.uleb128 0x14
+	.long	.LASF1994
+	.byte	0x20
+	.byte	0x8
+	.byte	0x30
+	.long	0x44f
+	.uleb128 0x7
+	.string	"pgn"
+	.byte	0x8
+	.byte	0x31
+	.byte	0xb
+	.long	0x385
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1995
+	.byte	0x8
+	.byte	0x32
+	.byte	0xe
+	.long	0xb0
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1996
+	.byte	0x8
+	.byte	0x33
+	.byte	0xe
+	.long	0x44f
+	.byte	0x8
+	.uleb128 0x7
+	.string	"ptr"
+	.byte	0x8
+	.byte	0x34
+	.byte	0xf
+	.long	0x454
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1997
+	.byte	0x8
+	.byte	0x38
+	.byte	0x7
+	.long	0x3db
+	.byte	0x18
+	.byte	0
+	.uleb128 0xb
+	.long	0x9f
+	.uleb128 0xb
+	.long	0x44f
+	.uleb128 0x5
+	.long	.LASF1998
+	.byte	0x8
+	.byte	0x39
+	.byte	0x3
+	.long	0x401
+	.uleb128 0x11
+	.long	0x459
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x9
+	.byte	0x23
+	.long	0x4b8
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0xa
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x9
+	.byte	0x37
+	.long	0x4d0
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2012
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x3
+	.long	0x4b8
+	.uleb128 0x14
+	.long	.LASF2013
+	.byte	0x4c
+	.byte	0x9
+	.byte	0x3c
+	.long	0x604
+	.uleb128 0x7
+	.string	"P8"
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xd
+	.long	0x604
+	.byte	0
+	.uleb128 0x7
+	.string	"I8"
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xd
+	.long	0x604
+	.byte	0xa
+	.uleb128 0x7
+	.string	"D8"
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xd
+	.long	0x604
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2014
+	.byte	0x9
+	.byte	0x41
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2015
+	.byte	0x9
+	.byte	0x42
+	.byte	0xe
+	.long	0xb0
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2016
+	.byte	0x9
+	.byte	0x43
+	.byte	0xe
+	.long	0xb0
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2017
+	.byte	0x9
+	.byte	0x44
+	.byte	0xe
+	.long	0xb0
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2018
+	.byte	0x9
+	.byte	0x45
+	.byte	0xe
+	.long	0xb0
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2019
+	.byte	0x9
+	.byte	0x46
+	.byte	0xd
+	.long	0x9f
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2020
+	.byte	0x9
+	.byte	0x47
+	.byte	0xb
+	.long	0xd4
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2021
+	.byte	0x9
+	.byte	0x48
+	.byte	0xb
+	.long	0xd4
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2022
+	.byte	0x9
+	.byte	0x49
+	.byte	0xd
+	.long	0x9f
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2023
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF2024
+	.byte	0x9
+	.byte	0x4b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2025
+	.byte	0x9
+	.byte	0x4c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF2026
+	.byte	0x9
+	.byte	0x4d
+	.byte	0xd
+	.long	0x9f
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2027
+	.byte	0x9
+	.byte	0x50
+	.byte	0xe
+	.long	0xb0
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2028
+	.byte	0x9
+	.byte	0x51
+	.byte	0xb
+	.long	0xd4
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2029
+	.byte	0x9
+	.byte	0x52
+	.byte	0xd
+	.long	0x9f
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2030
+	.byte	0x9
+	.byte	0x53
+	.byte	0xd
+	.long	0x9f
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF2031
+	.byte	0x9
+	.byte	0x54
+	.byte	0xb
+	.long	0xd4
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2032
+	.byte	0x9
+	.byte	0x55
+	.byte	0xb
+	.long	0xd4
+	.byte	0x48
+	.byte	0
+	.uleb128 0x8
+	.long	0x9f
+	.long	0x614
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2033
+	.byte	0x9
+	.byte	0x56
+	.byte	0x3
+	.long	0x4dc
+	.uleb128 0x11
+	.long	0x614
+	.uleb128 0x8
+	.long	0x614
+	.long	0x635
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2034
+	.byte	0x9
+	.byte	0x5d
+	.byte	0x15
+	.long	0x625
+	.uleb128 0x14
+	.long	.LASF2035
+	.byte	0x2
+	.byte	0x9
+	.byte	0x5f
+	.long	0x668
+	.uleb128 0x2
+	.long	.LASF2036
+	.byte	0x9
+	.byte	0x60
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2037
+	.byte	0x9
+	.byte	0x61
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2038
+	.byte	0x9
+	.byte	0x62
+	.byte	0x3
+	.long	0x641
+	.uleb128 0x11
+	.long	0x668
+	.uleb128 0xa
+	.long	.LASF2039
+	.byte	0x9
+	.byte	0x64
+	.byte	0x14
+	.long	0x668
+	.uleb128 0xa
+	.long	.LASF2040
+	.byte	0x9
+	.byte	0x69
+	.byte	0xe
+	.long	0x1ec
+	.uleb128 0xa
+	.long	.LASF2041
+	.byte	0x9
+	.byte	0x6b
+	.byte	0x11
+	.long	0xbc
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2042
+	.uleb128 0x28
+	.long	.LASF2169
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x14
+	.byte	0x41
+	.byte	0xe
+	.long	0x6ff
+	.uleb128 0x1
+	.long	.LASF2043
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2044
+	.byte	0x1
+	.uleb128 0x29
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2045
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2046
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2048
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2049
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2050
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2051
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2052
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2053
+	.byte	0xb
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xa
+	.byte	0x22
+	.long	0x750
+	.uleb128 0x1
+	.long	.LASF2054
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2055
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2056
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2057
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2058
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2059
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2060
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2061
+	.byte	0x80
+	.uleb128 0x15
+	.long	.LASF2062
+	.value	0x100
+	.uleb128 0x15
+	.long	.LASF2063
+	.value	0x200
+	.uleb128 0x15
+	.long	.LASF2064
+	.value	0x400
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2065
+	.byte	0xa
+	.byte	0x30
+	.byte	0x11
+	.long	0xb0
+	.uleb128 0x2a
+	.byte	0x6
+	.byte	0xb
+	.byte	0x22
+	.byte	0x5
+	.long	0x78d
+	.uleb128 0x2
+	.long	.LASF2066
+	.byte	0xb
+	.byte	0x24
+	.byte	0x11
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2067
+	.byte	0xb
+	.byte	0x25
+	.byte	0x11
+	.long	0x93
+	.byte	0x2
+	.uleb128 0x7
+	.string	"yaw"
+	.byte	0xb
+	.byte	0x26
+	.byte	0x11
+	.long	0x93
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1c
+	.byte	0x6
+	.byte	0xb
+	.byte	0x20
+	.byte	0x9
+	.long	0x7af
+	.uleb128 0x18
+	.string	"raw"
+	.byte	0xb
+	.byte	0x21
+	.byte	0xd
+	.long	0x7af
+	.uleb128 0x1d
+	.long	.LASF2068
+	.byte	0xb
+	.byte	0x27
+	.byte	0x7
+	.long	0x75c
+	.byte	0
+	.uleb128 0x8
+	.long	0x93
+	.long	0x7bf
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2069
+	.byte	0xb
+	.byte	0x28
+	.byte	0x3
+	.long	0x78d
+	.uleb128 0xa
+	.long	.LASF2070
+	.byte	0xb
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x7bf
+	.uleb128 0x8
+	.long	0x93
+	.long	0x7e7
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2071
+	.byte	0x10
+	.byte	0xc
+	.byte	0x2c
+	.long	0x80e
+	.uleb128 0x2
+	.long	.LASF2072
+	.byte	0xc
+	.byte	0x2d
+	.byte	0xe
+	.long	0xbc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2073
+	.byte	0xc
+	.byte	0x2e
+	.byte	0xb
+	.long	0x1ec
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2074
+	.byte	0xc
+	.byte	0x2f
+	.byte	0x3
+	.long	0x7e7
+	.uleb128 0xa
+	.long	.LASF2075
+	.byte	0xc
+	.byte	0x31
+	.byte	0xf
+	.long	0x80e
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xd
+	.byte	0x14
+	.long	0x850
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2079
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2080
+	.byte	0x4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2081
+	.byte	0x4
+	.byte	0xe
+	.byte	0x35
+	.long	0x877
+	.uleb128 0x2
+	.long	.LASF2066
+	.byte	0xe
+	.byte	0x36
+	.byte	0xd
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2067
+	.byte	0xe
+	.byte	0x37
+	.byte	0xd
+	.long	0x93
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2082
+	.byte	0xe
+	.byte	0x38
+	.byte	0x3
+	.long	0x850
+	.uleb128 0x2b
+	.long	.LASF2170
+	.byte	0x4
+	.byte	0xe
+	.byte	0x3a
+	.byte	0xf
+	.long	0x8a9
+	.uleb128 0x18
+	.string	"raw"
+	.byte	0xe
+	.byte	0x3b
+	.byte	0xd
+	.long	0x7d7
+	.uleb128 0x1d
+	.long	.LASF2068
+	.byte	0xe
+	.byte	0x3c
+	.byte	0x1d
+	.long	0x877
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2083
+	.byte	0xe
+	.byte	0x3d
+	.byte	0x3
+	.long	0x883
+	.uleb128 0x11
+	.long	0x8a9
+	.uleb128 0x19
+	.long	0x691
+	.byte	0x33
+	.byte	0xa
+	.uleb128 0x4
+	.long	.LASF2084
+	.byte	0x34
+	.byte	0xc
+	.long	0x69d
+	.uleb128 0x19
+	.long	0x685
+	.byte	0x36
+	.byte	0x7
+	.uleb128 0x4
+	.long	.LASF2085
+	.byte	0x3c
+	.byte	0xe
+	.long	0x1ec
+	.uleb128 0x16
+	.string	"dT"
+	.byte	0x3e
+	.byte	0xe
+	.long	0xd4
+	.uleb128 0xa
+	.long	.LASF2086
+	.byte	0xf
+	.byte	0x40
+	.byte	0x1a
+	.long	0x674
+	.uleb128 0x19
+	.long	0x679
+	.byte	0x40
+	.byte	0x41
+	.uleb128 0xa
+	.long	.LASF2087
+	.byte	0xf
+	.byte	0x40
+	.byte	0x6d
+	.long	0x465
+	.uleb128 0x1e
+	.long	0x8fb
+	.byte	0x94
+	.uleb128 0x2c
+	.long	0x8e8
+	.byte	0x49
+	.byte	0x13
+	.uleb128 0x19
+	.long	0x635
+	.byte	0x4e
+	.byte	0x41
+	.uleb128 0xa
+	.long	.LASF2088
+	.byte	0xf
+	.byte	0x4e
+	.byte	0x77
+	.long	0x465
+	.uleb128 0x1e
+	.long	0x91b
+	.byte	0xa0
+	.uleb128 0x4
+	.long	.LASF2089
+	.byte	0x99
+	.byte	0xe
+	.long	0xd4
+	.uleb128 0x8
+	.long	0x1e7
+	.long	0x948
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x11
+	.long	0x938
+	.uleb128 0x2d
+	.long	.LASF2171
+	.byte	0xf
+	.byte	0xa4
+	.byte	0x15
+	.long	0x948
+	.uleb128 0x4
+	.long	.LASF2090
+	.byte	0xa6
+	.byte	0x19
+	.long	0x360
+	.uleb128 0x8
+	.long	0x8a
+	.long	0x974
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2091
+	.byte	0xa7
+	.byte	0xe
+	.long	0x964
+	.uleb128 0x4
+	.long	.LASF2092
+	.byte	0xa8
+	.byte	0x19
+	.long	0x360
+	.uleb128 0x4
+	.long	.LASF2093
+	.byte	0xa9
+	.byte	0xe
+	.long	0x964
+	.uleb128 0x4
+	.long	.LASF2094
+	.byte	0xaa
+	.byte	0x19
+	.long	0x360
+	.uleb128 0x4
+	.long	.LASF2095
+	.byte	0xab
+	.byte	0xe
+	.long	0x8a
+	.uleb128 0x16
+	.string	"Kp"
+	.byte	0xf1
+	.byte	0xe
+	.long	0x1ec
+	.uleb128 0x16
+	.string	"Ki"
+	.byte	0xf1
+	.byte	0x15
+	.long	0x1ec
+	.uleb128 0x16
+	.string	"Kd"
+	.byte	0xf1
+	.byte	0x1c
+	.long	0x1ec
+	.uleb128 0x4
+	.long	.LASF2096
+	.byte	0xf1
+	.byte	0x23
+	.long	0x1ec
+	.uleb128 0x4
+	.long	.LASF2097
+	.byte	0xf2
+	.byte	0xe
+	.long	0xd4
+	.uleb128 0x4
+	.long	.LASF2030
+	.byte	0xf3
+	.byte	0xe
+	.long	0xd4
+	.uleb128 0x4
+	.long	.LASF2098
+	.byte	0xf4
+	.byte	0xe
+	.long	0xd4
+	.uleb128 0x4
+	.long	.LASF2099
+	.byte	0xf4
+	.byte	0x19
+	.long	0xd4
+	.uleb128 0x4
+	.long	.LASF2100
+	.byte	0xf4
+	.byte	0x26
+	.long	0xd4
+	.uleb128 0x4
+	.long	.LASF2101
+	.byte	0xf4
+	.byte	0x39
+	.long	0xd4
+	.uleb128 0x4
+	.long	.LASF2102
+	.byte	0xf4
+	.byte	0x4b
+	.long	0xd4
+	.uleb128 0xf
+	.long	.LASF2103
+	.byte	0x10
+	.byte	0x16
+	.byte	0x7
+	.long	0xd4
+	.long	0xa37
+	.uleb128 0x3
+	.long	0x70
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2104
+	.byte	0x10
+	.byte	0x17
+	.byte	0x7
+	.long	0xd4
+	.long	0xa4d
+	.uleb128 0x3
+	.long	0x70
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2105
+	.byte	0x10
+	.byte	0x15
+	.byte	0x7
+	.long	0xd4
+	.long	0xa63
+	.uleb128 0x3
+	.long	0x70
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2106
+	.byte	0x11
+	.byte	0x7f
+	.byte	0x7
+	.long	0xd4
+	.long	0xa75
+	.uleb128 0x2f
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2117
+	.byte	0x10
+	.byte	0x18
+	.byte	0x7
+	.long	0xd4
+	.uleb128 0x17
+	.long	.LASF2107
+	.byte	0xc
+	.byte	0x4e
+	.long	0xa92
+	.uleb128 0x3
+	.long	0x9f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2108
+	.byte	0x7
+	.byte	0x73
+	.long	0xaad
+	.uleb128 0x3
+	.long	0xaad
+	.uleb128 0x3
+	.long	0x9f
+	.uleb128 0x3
+	.long	0xb0
+	.byte	0
+	.uleb128 0xb
+	.long	0x312
+	.uleb128 0xf
+	.long	.LASF2109
+	.byte	0x7
+	.byte	0x74
+	.byte	0x7
+	.long	0xd4
+	.long	0xacd
+	.uleb128 0x3
+	.long	0xaad
+	.uleb128 0x3
+	.long	0xd4
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2110
+	.byte	0x7
+	.byte	0x57
+	.long	0xae8
+	.uleb128 0x3
+	.long	0xae8
+	.uleb128 0x3
+	.long	0xd4
+	.uleb128 0x3
+	.long	0xbc
+	.byte	0
+	.uleb128 0xb
+	.long	0x2a6
+	.uleb128 0x17
+	.long	.LASF2111
+	.byte	0x7
+	.byte	0x5e
+	.long	0xb08
+	.uleb128 0x3
+	.long	0xb08
+	.uleb128 0x3
+	.long	0x9f
+	.uleb128 0x3
+	.long	0xd4
+	.byte	0
+	.uleb128 0xb
+	.long	0x239
+	.uleb128 0xf
+	.long	.LASF2112
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x7
+	.long	0xd4
+	.long	0xb28
+	.uleb128 0x3
+	.long	0xb08
+	.uleb128 0x3
+	.long	0xd4
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2113
+	.byte	0x7
+	.byte	0x58
+	.long	0xb4d
+	.uleb128 0x3
+	.long	0xae8
+	.uleb128 0x3
+	.long	0xd4
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0xd4
+	.uleb128 0x3
+	.long	0x354
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2114
+	.byte	0x7
+	.byte	0x5c
+	.byte	0x7
+	.long	0xd4
+	.long	0xb68
+	.uleb128 0x3
+	.long	0xb0
+	.uleb128 0x3
+	.long	0xb0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2115
+	.byte	0x7
+	.byte	0x5b
+	.byte	0x7
+	.long	0xd4
+	.long	0xb83
+	.uleb128 0x3
+	.long	0xae8
+	.uleb128 0x3
+	.long	0xd4
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2116
+	.byte	0x7
+	.byte	0x54
+	.byte	0x7
+	.long	0xd4
+	.long	0xb9e
+	.uleb128 0x3
+	.long	0x8a
+	.uleb128 0x3
+	.long	0xd4
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2118
+	.byte	0xc
+	.byte	0x4d
+	.byte	0x9
+	.long	0x9f
+	.uleb128 0xf
+	.long	.LASF2119
+	.byte	0x12
+	.byte	0x2b
+	.byte	0xe
+	.long	0x8a
+	.long	0xbca
+	.uleb128 0x3
+	.long	0x8a
+	.uleb128 0x3
+	.long	0xbca
+	.uleb128 0x3
+	.long	0xc8
+	.byte	0
+	.uleb128 0xb
+	.long	0xbcf
+	.uleb128 0x30
+	.uleb128 0x20
+	.long	.LASF2144
+	.value	0x13e
+	.long	0xca2
+	.uleb128 0x10
+	.long	.LASF2120
+	.value	0x13e
+	.byte	0x28
+	.long	0xca2
+	.uleb128 0x10
+	.long	.LASF2121
+	.value	0x13e
+	.byte	0x4f
+	.long	0xca7
+	.uleb128 0x6
+	.long	.LASF2122
+	.value	0x140
+	.byte	0x12
+	.long	0xcac
+	.uleb128 0x6
+	.long	.LASF2123
+	.value	0x141
+	.byte	0x11
+	.long	0xdb
+	.uleb128 0x6
+	.long	.LASF2124
+	.value	0x142
+	.byte	0x11
+	.long	0xdb
+	.uleb128 0x6
+	.long	.LASF2125
+	.value	0x145
+	.byte	0x11
+	.long	0xdb
+	.uleb128 0xe
+	.uleb128 0x6
+	.long	.LASF2126
+	.value	0x148
+	.byte	0xe
+	.long	0x70
+	.uleb128 0xe
+	.uleb128 0x6
+	.long	.LASF2127
+	.value	0x149
+	.byte	0xf
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF2128
+	.value	0x153
+	.byte	0x15
+	.long	0xdb
+	.uleb128 0x6
+	.long	.LASF2129
+	.value	0x15a
+	.byte	0x15
+	.long	0xdb
+	.uleb128 0x6
+	.long	.LASF2130
+	.value	0x15d
+	.byte	0xf
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF2131
+	.value	0x163
+	.byte	0xf
+	.long	0xd4
+	.uleb128 0xe
+	.uleb128 0x6
+	.long	.LASF2132
+	.value	0x175
+	.byte	0x13
+	.long	0xd4
+	.uleb128 0x31
+	.string	"rD"
+	.byte	0xf
+	.value	0x179
+	.byte	0x19
+	.long	0xdb
+	.uleb128 0x6
+	.long	.LASF2133
+	.value	0x17b
+	.byte	0x19
+	.long	0xdb
+	.uleb128 0x6
+	.long	.LASF2134
+	.value	0x17e
+	.byte	0x13
+	.long	0xd4
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x620
+	.uleb128 0xb
+	.long	0x8b5
+	.uleb128 0x8
+	.long	0xd4
+	.long	0xcbc
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2137
+	.value	0x131
+	.long	0xd4
+	.long	0xcfc
+	.uleb128 0x10
+	.long	.LASF2126
+	.value	0x131
+	.byte	0x24
+	.long	0x70
+	.uleb128 0x10
+	.long	.LASF2127
+	.value	0x131
+	.byte	0x30
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF2135
+	.value	0x132
+	.byte	0x12
+	.long	0x1ec
+	.uleb128 0x6
+	.long	.LASF2136
+	.value	0x133
+	.byte	0x11
+	.long	0xdb
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2138
+	.value	0x11d
+	.long	0xd4
+	.long	0xd62
+	.uleb128 0x10
+	.long	.LASF2126
+	.value	0x11d
+	.byte	0x1b
+	.long	0x70
+	.uleb128 0x10
+	.long	.LASF2120
+	.value	0x11d
+	.byte	0x35
+	.long	0xca2
+	.uleb128 0x10
+	.long	.LASF2121
+	.value	0x11d
+	.byte	0x5c
+	.long	0xca7
+	.uleb128 0x10
+	.long	.LASF2127
+	.value	0x11d
+	.byte	0x6d
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF2139
+	.value	0x11f
+	.byte	0xb
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF2140
+	.value	0x124
+	.byte	0x11
+	.long	0xdb
+	.uleb128 0xe
+	.uleb128 0x6
+	.long	.LASF2141
+	.value	0x12b
+	.byte	0x15
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2142
+	.value	0x113
+	.long	0xd4
+	.long	0xd8c
+	.uleb128 0x6
+	.long	.LASF2141
+	.value	0x114
+	.byte	0xb
+	.long	0xd4
+	.uleb128 0xe
+	.uleb128 0x6
+	.long	.LASF2143
+	.value	0x116
+	.byte	0x15
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2145
+	.value	0x10a
+	.long	0xdb0
+	.uleb128 0x10
+	.long	.LASF2120
+	.value	0x10a
+	.byte	0x22
+	.long	0xca2
+	.uleb128 0x6
+	.long	.LASF2146
+	.value	0x10c
+	.byte	0x13
+	.long	0xab
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2147
+	.byte	0xf6
+	.long	0xddf
+	.uleb128 0x13
+	.long	.LASF2120
+	.byte	0xf
+	.byte	0xf6
+	.byte	0x28
+	.long	0xca2
+	.uleb128 0x4
+	.long	.LASF2146
+	.byte	0xf8
+	.byte	0x13
+	.long	0xab
+	.uleb128 0xe
+	.uleb128 0x4
+	.long	.LASF2126
+	.byte	0xf9
+	.byte	0xd
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2148
+	.byte	0xad
+	.long	0xe90
+	.uleb128 0x13
+	.long	.LASF2120
+	.byte	0xf
+	.byte	0xad
+	.byte	0x29
+	.long	0xca2
+	.uleb128 0x4
+	.long	.LASF2149
+	.byte	0xaf
+	.byte	0x1b
+	.long	0xe90
+	.uleb128 0x4
+	.long	.LASF2150
+	.byte	0xb0
+	.byte	0x18
+	.long	0xea0
+	.uleb128 0x4
+	.long	.LASF2151
+	.byte	0xb1
+	.byte	0x1b
+	.long	0xe90
+	.uleb128 0x4
+	.long	.LASF2152
+	.byte	0xb2
+	.byte	0x1f
+	.long	0xeb0
+	.uleb128 0x4
+	.long	.LASF2153
+	.byte	0xb3
+	.byte	0x18
+	.long	0x239
+	.uleb128 0x4
+	.long	.LASF2154
+	.byte	0xb5
+	.byte	0xe
+	.long	0xbc
+	.uleb128 0x4
+	.long	.LASF2146
+	.byte	0xba
+	.byte	0x13
+	.long	0xab
+	.uleb128 0x1b
+	.long	0xe60
+	.uleb128 0x4
+	.long	.LASF2155
+	.byte	0xc0
+	.byte	0x15
+	.long	0xdb
+	.uleb128 0xe
+	.uleb128 0x4
+	.long	.LASF2126
+	.byte	0xc1
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	0xe71
+	.uleb128 0x4
+	.long	.LASF2126
+	.byte	0xd0
+	.byte	0x16
+	.long	0x70
+	.byte	0
+	.uleb128 0x1b
+	.long	0xe82
+	.uleb128 0x4
+	.long	.LASF2126
+	.byte	0xd7
+	.byte	0x16
+	.long	0x70
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x4
+	.long	.LASF2126
+	.byte	0xde
+	.byte	0x16
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x2a6
+	.long	0xea0
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	0x239
+	.long	0xeb0
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	0x312
+	.long	0xec0
+	.uleb128 0x9
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2156
+	.byte	0x9f
+	.long	0xed7
+	.uleb128 0x13
+	.long	.LASF2157
+	.byte	0xf
+	.byte	0x9f
+	.byte	0x34
+	.long	0x4d0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2158
+	.byte	0x9b
+	.long	0xeee
+	.uleb128 0x13
+	.long	.LASF2159
+	.byte	0xf
+	.byte	0x9b
+	.byte	0x23
+	.long	0xd4
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2160
+	.byte	0x92
+	.long	0xf06
+	.uleb128 0xe
+	.uleb128 0x4
+	.long	.LASF2126
+	.byte	0x94
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2161
+	.byte	0x8c
+	.long	0xf1d
+	.uleb128 0x13
+	.long	.LASF2162
+	.byte	0xf
+	.byte	0x8c
+	.byte	0x24
+	.long	0xbc
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2163
+	.byte	0x85
+	.long	0xf3f
+	.uleb128 0x13
+	.long	.LASF2164
+	.byte	0xf
+	.byte	0x85
+	.byte	0x2a
+	.long	0xf3f
+	.uleb128 0xe
+	.uleb128 0x16
+	.string	"i"
+	.byte	0x87
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x614
+	.uleb128 0x12
+	.long	.LASF2165
+	.byte	0x50
+	.long	0xf66
+	.uleb128 0x13
+	.long	.LASF2120
+	.byte	0xf
+	.byte	0x50
+	.byte	0x24
+	.long	0xf3f
+	.uleb128 0x4
+	.long	.LASF2166
+	.byte	0x52
+	.byte	0x25
+	.long	0x620
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF2172
+	.byte	0x9
+	.byte	0x64
+	.byte	0x47
+	.long	0xf72
+	.uleb128 0xb
+	.long	0x674
+	.uleb128 0x33
+	.long	.LASF2173
+	.byte	0x13
+	.byte	0x88
+	.byte	0x15
+	.long	0xd4
+	.uleb128 0x21
+	.string	"amt"
+	.byte	0x88
+	.byte	0x26
+	.long	0xd4
+	.uleb128 0x21
+	.string	"low"
+	.byte	0x88
+	.byte	0x31
+	.long	0xd4
+	.uleb128 0x13
+	.long	.LASF2167
+	.byte	0x13
+	.byte	0x88
+	.byte	0x3c
+	.long	0xd4
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 21 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.file 24 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x19
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 26 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 27 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 30 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 32 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x20
+	.file 33 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 39 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 40 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x29
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1181
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1221
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x30
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 52 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x34
+	.file 53 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 54 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x36
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 55 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x37
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0x4
+	.file 56 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1640
+	.byte	0x4
+	.file 57 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 58 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 59 "./src/main/config/config_profile.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x4
+	.file 60 "./src/main/fc/fc_core.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3c
+	.file 61 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1761
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x11
+	.file 62 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 63 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3f
+	.file 64 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x40
+	.file 65 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 66 "./src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xc
+	.file 67 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0xe
+	.file 68 "./src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x44
+	.file 69 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x45
+	.byte	0x4
+	.file 70 "./src/main/drivers/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1918
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1143
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1147
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1159
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1171
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1173
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1290
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1293
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1299
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1303
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1308
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1335
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1496
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1509
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1526
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1527
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1530
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1457
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1567
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1575
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1580
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1583
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1585
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1623
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1639
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1645
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1668
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1750
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1760
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1796
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1798
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1806
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.8362794d947c339e17997ec0162d97db,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1815
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1905
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1917
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF2174
+	.long	.LASF2175
+	.long	.LASF2176
+	.long	.LASF2177
+	.long	.LASF2178
+	.long	.LASF2179
+	.long	.LASF2180
+	.long	.LASF2181
+	.long	.LASF2182
+	.long	.LASF2183
+	.long	.LASF2184
+	.long	.LASF2185
+	.long	.LASF2186
+	.long	.LASF2187
+	.long	.LASF2188
+	.long	.LASF2189
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x47
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2190
+	.byte	0xc
+	.long	.LASF2191
+	.byte	0xc
+	.long	.LASF2192
+	.byte	0xc
+	.long	.LASF2193
+	.byte	0x10
+	.long	.LASF2194
+	.byte	0x1
+	.long	.LASF2195
+	.byte	0x2
+	.long	.LASF2196
+	.byte	0x2
+	.long	.LASF2197
+	.byte	0x3
+	.long	.LASF2198
+	.byte	0x6
+	.long	.LASF2199
+	.byte	0x5
+	.long	.LASF2200
+	.byte	0x6
+	.long	.LASF2201
+	.byte	0x7
+	.long	.LASF2202
+	.byte	0x7
+	.long	.LASF2203
+	.byte	0x7
+	.long	.LASF2204
+	.byte	0x6
+	.long	.LASF2205
+	.byte	0x5
+	.long	.LASF2206
+	.byte	0x6
+	.long	.LASF2207
+	.byte	0xf
+	.long	.LASF2208
+	.byte	0x2
+	.long	.LASF2209
+	.byte	0x5
+	.long	.LASF2210
+	.byte	0xf
+	.long	.LASF2211
+	.byte	0x10
+	.long	.LASF2212
+	.byte	0x10
+	.long	.LASF2212
+	.byte	0xf
+	.long	.LASF2213
+	.byte	0xc
+	.long	.LASF2214
+	.byte	0xf
+	.long	.LASF2215
+	.byte	0xf
+	.long	.LASF2216
+	.byte	0xc
+	.long	.LASF2217
+	.byte	0xc
+	.long	.LASF2218
+	.byte	0xe
+	.long	.LASF2219
+	.byte	0xc
+	.long	.LASF2220
+	.byte	0xd
+	.long	.LASF2221
+	.byte	0xd
+	.long	.LASF2222
+	.byte	0xc
+	.long	.LASF2223
+	.byte	0xc
+	.long	.LASF2224
+	.byte	0xc
+	.long	.LASF2225
+	.byte	0xb
+	.long	.LASF2226
+	.byte	0xb
+	.long	.LASF2227
+	.byte	0xf
+	.long	.LASF2228
+	.byte	0xf
+	.long	.LASF2229
+	.byte	0xc
+	.long	.LASF2230
+	.byte	0xc
+	.long	.LASF2231
+	.byte	0xc
+	.long	.LASF2232
+	.byte	0xc
+	.long	.LASF2233
+	.byte	0xc
+	.long	.LASF2234
+	.byte	0xc
+	.long	.LASF2235
+	.byte	0xc
+	.long	.LASF2236
+	.byte	0xc
+	.long	.LASF2237
+	.byte	0xc
+	.long	.LASF2238
+	.byte	0xc
+	.long	.LASF2239
+	.byte	0xc
+	.long	.LASF2240
+	.byte	0xa
+	.long	.LASF2241
+	.byte	0x9
+	.long	.LASF2242
+	.byte	0x8
+	.long	.LASF2243
+	.byte	0x9
+	.long	.LASF2244
+	.byte	0x1
+	.long	.LASF2245
+	.byte	0x3
+	.long	.LASF2246
+	.byte	0x3
+	.long	.LASF2247
+	.byte	0x3
+	.long	.LASF2248
+	.byte	0x5
+	.long	.LASF2249
+	.byte	0x2
+	.long	.LASF2250
+	.byte	0x4
+	.long	.LASF2251
+	.byte	0x4
+	.long	.LASF2252
+	.byte	0x4
+	.long	.LASF2253
+	.byte	0x4
+	.long	.LASF2254
+	.byte	0x6
+	.long	.LASF2255
+	.byte	0x4
+	.long	.LASF2256
+	.byte	0x4
+	.long	.LASF2257
+	.byte	0x4
+	.long	.LASF2258
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1155:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1768:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1780:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1873:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF826:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1239:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1543:
+	.string	"USE_FAKE_BARO "
+.LASF1151:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1484:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2132:
+	.string	"dynC"
+.LASF1334:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2122:
+	.string	"previousRateError"
+.LASF2000:
+	.string	"PIDPITCH"
+.LASF1520:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1491:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1588:
+	.string	"USE_PROFILE "
+.LASF935:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1232:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF1358:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1485:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF863:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1556:
+	.string	"USE_PPM"
+.LASF1827:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1813:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1464:
+	.string	"USE_SERIALRX_CRSF "
+.LASF999:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF979:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF836:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1434:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1845:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1803:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF1761:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1646:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF939:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1976:
+	.string	"targetCount"
+.LASF1055:
+	.string	"__DECL_SIMD_tan "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1924:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1124:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1724:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1099:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1409:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF2042:
+	.string	"_Bool"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF794:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1807:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF1536:
+	.string	"U_ID_2 2"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1267:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1986:
+	.string	"filterApplyFnPtr"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1486:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF931:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1082:
+	.string	"__DECL_SIMD_exp"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1999:
+	.string	"PIDROLL"
+.LASF2035:
+	.string	"pidConfig_s"
+.LASF2038:
+	.string	"pidConfig_t"
+.LASF1339:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1911:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF1652:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1408:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF2136:
+	.string	"currentVelocity"
+.LASF1962:
+	.string	"DEBUG_COUNT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2156:
+	.string	"pidStabilisationState"
+.LASF1920:
+	.string	"short unsigned int"
+.LASF1815:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF840:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1512:
+	.string	"__WCHAR_T__ "
+.LASF2146:
+	.string	"gyroIsrHeld"
+.LASF1492:
+	.string	"USE_SENSOR_NAMES "
+.LASF1248:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF2139:
+	.string	"angle"
+.LASF1714:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1006:
+	.string	"__DECL_SIMD_acoshf "
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1371:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF2006:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF937:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1897:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1326:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1670:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF799:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1970:
+	.string	"pt1Filter_t"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF824:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1933:
+	.string	"uint16_t"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1117:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1801:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF1691:
+	.string	"PG_RX_CONFIG 24"
+.LASF1721:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1854:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1160:
+	.string	"__DECL_SIMD_tanhf"
+.LASF1805:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2118:
+	.string	"gyroIsrHold"
+.LASF2103:
+	.string	"getRcDeflection"
+.LASF1475:
+	.string	"TELEMETRY_HOTT "
+.LASF818:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF957:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1126:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1658:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF1325:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF793:
+	.string	"_MATH_H 1"
+.LASF1600:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1308:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1501:
+	.string	"_T_PTRDIFF_ "
+.LASF1885:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF842:
+	.string	"__DECL_SIMD_expf32x "
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1710:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF807:
+	.string	"__DECL_SIMD_sinl "
+.LASF1822:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1702:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1609:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1674:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1847:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF1348:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2059:
+	.string	"GPS_HOLD_MODE"
+.LASF2135:
+	.string	"previousSetpoint"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1687:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1834:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1914:
+	.string	"GYRO_LPF_NONE 7"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1390:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1412:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF828:
+	.string	"__DECL_SIMD_logf16 "
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1764:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1631:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2008:
+	.string	"PIDVEL"
+.LASF2130:
+	.string	"PTerm"
+.LASF1198:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF2101:
+	.string	"ITermWindupPoint"
+.LASF1441:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1414:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF1860:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF884:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1288:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF827:
+	.string	"__DECL_SIMD_logl "
+.LASF1395:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1333:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1172:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1158:
+	.string	"__DECL_SIMD_tanh"
+.LASF1064:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1423:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF801:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1754:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1575:
+	.string	"TELEMETRY_IBUS"
+.LASF1651:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF835:
+	.string	"__DECL_SIMD_exp "
+.LASF1045:
+	.string	"__DECL_SIMD_erfc "
+.LASF1170:
+	.string	"__DECL_SIMD_tan"
+.LASF910:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF927:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1249:
+	.string	"_Mdouble_"
+.LASF1393:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1176:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1785:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1405:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF1106:
+	.string	"__DECL_SIMD_exp2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1387:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF1627:
+	.string	"FAST_MATH "
+.LASF1542:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1085:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1415:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1146:
+	.string	"__DECL_SIMD_atanh"
+.LASF1019:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1878:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1870:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1522:
+	.string	"___int_wchar_t_h "
+.LASF837:
+	.string	"__DECL_SIMD_expl "
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF2036:
+	.string	"pid_process_denom"
+.LASF1532:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1184:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1097:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1790:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1581:
+	.string	"VTX_TRAMP"
+.LASF1821:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1090:
+	.string	"__DECL_SIMD_acos"
+.LASF1985:
+	.string	"biquadFilterType_e"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1168:
+	.string	"__DECL_SIMD_erfcf"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1182:
+	.string	"__HAVE_FLOAT16 0"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1982:
+	.string	"FILTER_FIR"
+.LASF1402:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1227:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF2068:
+	.string	"values"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2123:
+	.string	"tpaFactor"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1707:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF2041:
+	.string	"targetPidLooptime"
+.LASF970:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF2100:
+	.string	"horizonTransition"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1337:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1134:
+	.string	"__DECL_SIMD_log10"
+.LASF1990:
+	.string	"PGR_SIZE_MASK"
+.LASF1260:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1118:
+	.string	"__DECL_SIMD_expm1"
+.LASF1310:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF902:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1311:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1103:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF2073:
+	.string	"gyroADCf"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1853:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1381:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1220:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1578:
+	.string	"VTX_COMMON"
+.LASF1070:
+	.string	"__DECL_SIMD_sin"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1237:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1488:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1420:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF1814:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2114:
+	.string	"filterGetNotchQ"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF812:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1007:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1314:
+	.string	"__MATHCALL_NARROW"
+.LASF1950:
+	.string	"DEBUG_VELOCITY"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1487:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1291:
+	.string	"_Mret_ _Float32"
+.LASF1856:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1758:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF1235:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1142:
+	.string	"__DECL_SIMD_log1p"
+.LASF1832:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1271:
+	.string	"__MATHDECL_1"
+.LASF1143:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1591:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1774:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2007:
+	.string	"PIDMAG"
+.LASF1127:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF1569:
+	.string	"TELEMETRY_HOTT"
+.LASF1977:
+	.string	"index"
+.LASF1110:
+	.string	"__DECL_SIMD_exp10"
+.LASF1626:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF1738:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1016:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1819:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1186:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1120:
+	.string	"__DECL_SIMD_expm1f"
+.LASF1454:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF959:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2054:
+	.string	"ANGLE_MODE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1662:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2020:
+	.string	"pidSumLimit"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f"
+.LASF988:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1789:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF895:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1992:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF913:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1908:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF2119:
+	.string	"memcpy"
+.LASF1682:
+	.string	"PG_PID_PROFILE 14"
+.LASF2015:
+	.string	"dterm_lpf_hz"
+.LASF1250:
+	.string	"__MATH_PRECNAME"
+.LASF1280:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1245:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1513:
+	.string	"_WCHAR_T "
+.LASF2107:
+	.string	"gyroIsrRelease"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2002:
+	.string	"PIDALT"
+.LASF1024:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1178:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1572:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1364:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF2138:
+	.string	"pidLevel"
+.LASF1323:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF2111:
+	.string	"pt1FilterInit"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1699:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1742:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1108:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1398:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1540:
+	.string	"ACC "
+.LASF1069:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2004:
+	.string	"PIDPOSR"
+.LASF1681:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1483:
+	.string	"TELEMETRY_IBUS "
+.LASF1462:
+	.string	"USE_PWM "
+.LASF920:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1904:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF1906:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF996:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1163:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1792:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1697:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1943:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF854:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1706:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1922:
+	.string	"long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1959:
+	.string	"DEBUG_DYN_NOTCH"
+.LASF1656:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1431:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF2066:
+	.string	"roll"
+.LASF1507:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1664:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1426:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1498:
+	.string	"_STDDEF_H_ "
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1925:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2018:
+	.string	"dterm_notch_cutoff"
+.LASF1948:
+	.string	"DEBUG_NOTCH"
+.LASF1927:
+	.string	"__uint16_t"
+.LASF1201:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1776:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF1871:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF402:
+	.string	"false 0"
+.LASF921:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1978:
+	.string	"movingSum"
+.LASF888:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1596:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1635:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF1893:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF2149:
+	.string	"biquadFilterNotch"
+.LASF1523:
+	.string	"__INT_WCHAR_T_H "
+.LASF966:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1331:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF891:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1344:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1851:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF860:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1305:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF1715:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF922:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1128:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF1018:
+	.string	"__DECL_SIMD_erff16 "
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1625:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1896:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF823:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1135:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1799:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1328:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2116:
+	.string	"nullFilterApply"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1298:
+	.string	"_Marg_ _Float128"
+.LASF1197:
+	.string	"__f32x(x) x ##f32x"
+.LASF1231:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1351:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1252:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1810:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1975:
+	.string	"filledCount"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1312:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1743:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF2055:
+	.string	"HORIZON_MODE"
+.LASF1919:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1301:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1283:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF852:
+	.string	"__DECL_SIMD_powf32x "
+.LASF983:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1212:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1749:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1798:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1650:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1508:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2153:
+	.string	"pt1FilterYaw"
+.LASF1079:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF1781:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1700:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1972:
+	.string	"biquadFilter_s"
+.LASF364:
+	.string	"__k8 1"
+.LASF1683:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1210:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF1771:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2141:
+	.string	"horizonLevelStrength"
+.LASF1421:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1678:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1407:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF1654:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1857:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1836:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF2064:
+	.string	"FAILSAFE_MODE"
+.LASF1273:
+	.string	"__MATHDECL"
+.LASF1538:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1733:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1017:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2144:
+	.string	"pidController"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1560:
+	.string	"USE_SERIALRX_IBUS"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2093:
+	.string	"dtermFilterLpf"
+.LASF1382:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF878:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1500:
+	.string	"_PTRDIFF_T "
+.LASF1586:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1994:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1067:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2133:
+	.string	"delta"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF911:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1892:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF1145:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF2098:
+	.string	"levelGain"
+.LASF974:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1840:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1980:
+	.string	"FILTER_PT1"
+.LASF2115:
+	.string	"biquadFilterApply"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1621:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF943:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1839:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF1479:
+	.string	"USE_SERVOS "
+.LASF1380:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2112:
+	.string	"pt1FilterApply"
+.LASF1804:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF545:
+	.string	"__wur "
+.LASF1472:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1096:
+	.string	"__DECL_SIMD_atanf"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1880:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2046:
+	.string	"AUX1"
+.LASF2047:
+	.string	"AUX2"
+.LASF868:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2049:
+	.string	"AUX4"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2051:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2053:
+	.string	"AUX8"
+.LASF1685:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2058:
+	.string	"GPS_HOME_MODE"
+.LASF2167:
+	.string	"high"
+.LASF1257:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1307:
+	.string	"_Mret_ _Float64x"
+.LASF1322:
+	.string	"FP_NORMAL 4"
+.LASF2043:
+	.string	"ROLL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2142:
+	.string	"calcHorizonLevelStrength"
+.LASF1849:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1406:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF890:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1855:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF1779:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1816:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1372:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF916:
+	.string	"__DECL_SIMD_coshf "
+.LASF2089:
+	.string	"itermAccelerator"
+.LASF997:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1425:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1211:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1837:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1580:
+	.string	"VTX_SMARTAUDIO"
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF894:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1632:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1952:
+	.string	"DEBUG_ANGLERATE"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1988:
+	.string	"PGR_PGN_MASK"
+.LASF2154:
+	.string	"pidFrequencyNyquist"
+.LASF1404:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF2137:
+	.string	"accelerationLimit"
+.LASF1877:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1187:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1244:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1247:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1530:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1705:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF804:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1459:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF967:
+	.string	"__DECL_SIMD_log10l "
+.LASF1938:
+	.string	"debug"
+.LASF1449:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1793:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1370:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1740:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1909:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF844:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1766:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1592:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF2001:
+	.string	"PIDYAW"
+.LASF1189:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF795:
+	.string	"__DECL_SIMD_cos "
+.LASF1066:
+	.string	"__DECL_SIMD_cos"
+.LASF1329:
+	.string	"MATH_ERRNO 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1428:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF2140:
+	.string	"errorAngle"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1818:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1899:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF954:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF973:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF876:
+	.string	"__DECL_SIMD_asinf "
+.LASF1673:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2095:
+	.string	"ptermYawFilter"
+.LASF1995:
+	.string	"size"
+.LASF1461:
+	.string	"USE_PPM "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF2134:
+	.string	"DTerm"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2078:
+	.string	"SENSOR_INDEX_BARO"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1725:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF2057:
+	.string	"BARO_MODE"
+.LASF2094:
+	.string	"ptermYawFilterApplyFn"
+.LASF1614:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1900:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1531:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1068:
+	.string	"__DECL_SIMD_cosf"
+.LASF1261:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1114:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF843:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1113:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF796:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF2090:
+	.string	"dtermNotchFilterApplyFn"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1159:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF940:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1649:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1825:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1350:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1955:
+	.string	"DEBUG_STACK"
+.LASF1347:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1935:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2056:
+	.string	"MAG_MODE"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1932:
+	.string	"uint8_t"
+.LASF1433:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2147:
+	.string	"pidInitConfig"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1213:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF1961:
+	.string	"DEBUG_DSHOT_RPM_TELEMETRY"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2150:
+	.string	"pt1Filter"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1251:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1643:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF2079:
+	.string	"SENSOR_INDEX_MAG"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF1473:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF861:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1394:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1149:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1373:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1167:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1035:
+	.string	"__DECL_SIMD_asinh "
+.LASF2044:
+	.string	"PITCH"
+.LASF1628:
+	.string	"VERY_FAST_MATH "
+.LASF1303:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1797:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1524:
+	.string	"_GCC_WCHAR_T "
+.LASF1519:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2026:
+	.string	"levelSensitivity"
+.LASF1858:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF1063:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1570:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1747:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1354:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF862:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1319:
+	.string	"FP_INFINITE 1"
+.LASF1309:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF915:
+	.string	"__DECL_SIMD_cosh "
+.LASF1981:
+	.string	"FILTER_BIQUAD"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF805:
+	.string	"__DECL_SIMD_sin "
+.LASF1537:
+	.string	"LED0_PIN NONE"
+.LASF1571:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1527:
+	.string	"_BSD_WCHAR_T_"
+.LASF1386:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF1073:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1166:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1180:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2084:
+	.string	"pidStabilisationEnabled"
+.LASF1089:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1756:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1171:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF1533:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1510:
+	.string	"__need_ptrdiff_t"
+.LASF848:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1964:
+	.string	"FD_PITCH"
+.LASF2025:
+	.string	"levelAngleLimit"
+.LASF879:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1205:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1453:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1800:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF917:
+	.string	"__DECL_SIMD_coshl "
+.LASF1608:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2126:
+	.string	"axis"
+.LASF1265:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1703:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1497:
+	.string	"_STDDEF_H "
+.LASF2097:
+	.string	"relaxFactor"
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1116:
+	.string	"__DECL_SIMD_coshf"
+.LASF2127:
+	.string	"currentPidSetpoint"
+.LASF1072:
+	.string	"__DECL_SIMD_sinf"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2010:
+	.string	"PID_STABILISATION_OFF"
+.LASF1755:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF2165:
+	.string	"resetPidProfile"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1234:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1730:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1437:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF833:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1020:
+	.string	"__DECL_SIMD_erff64 "
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1229:
+	.string	"FP_INT_UPWARD 0"
+.LASF1894:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1728:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1254:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1693:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1598:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1657:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1577:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF869:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1181:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2164:
+	.string	"pidProfiles"
+.LASF1215:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1439:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF1808:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1642:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF1958:
+	.string	"DEBUG_FFT"
+.LASF1741:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1567:
+	.string	"LED_STRIP"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1133:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1179:
+	.string	"__f128(x) x ##f128"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1256:
+	.string	"_Mdouble_ long double"
+.LASF2148:
+	.string	"pidInitFilters"
+.LASF808:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1945:
+	.string	"DEBUG_MIXER"
+.LASF1075:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1563:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1564:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1772:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1812:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1913:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1091:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF877:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1474:
+	.string	"TELEMETRY_FRSKY "
+.LASF1869:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1056:
+	.string	"__DECL_SIMD_tanf "
+.LASF2125:
+	.string	"dynKi"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1820:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1739:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1616:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF2157:
+	.string	"pidControllerState"
+.LASF1644:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF1318:
+	.string	"FP_NAN 0"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1383:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF1736:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1996:
+	.string	"address"
+.LASF1639:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1769:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1562:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1292:
+	.string	"_Marg_ _Float32x"
+.LASF797:
+	.string	"__DECL_SIMD_cosl "
+.LASF1831:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1216:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1802:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF1872:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF2072:
+	.string	"targetLooptime"
+.LASF785:
+	.string	"NULL"
+.LASF1752:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF2143:
+	.string	"mostDeflectedPos"
+.LASF2067:
+	.string	"pitch"
+.LASF783:
+	.string	"__size_t "
+.LASF1671:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1511:
+	.string	"__wchar_t__ "
+.LASF1655:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1589:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1218:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1440:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF499:
+	.string	"__PMT"
+.LASF2063:
+	.string	"SONAR_MODE"
+.LASF1525:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2124:
+	.string	"motorMixRange"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF2032:
+	.string	"rateAccelLimit"
+.LASF1584:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF2013:
+	.string	"pidProfile_s"
+.LASF2033:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1841:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF1023:
+	.string	"__DECL_SIMD_erff64x "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1717:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1456:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1343:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1583:
+	.string	"USE_RESOURCE_MGMT"
+.LASF976:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1391:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1268:
+	.string	"_Mdouble_ _Float64x"
+.LASF821:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1401:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF1025:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1796:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1465:
+	.string	"USE_SERIALRX_IBUS "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1991:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1321:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1177:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1675:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1138:
+	.string	"__DECL_SIMD_log2"
+.LASF1760:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1400:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF1884:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF2117:
+	.string	"getThrottlePIDAttenuation"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1640:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1809:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF1153:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1942:
+	.string	"DEBUG_BATTERY"
+.LASF1826:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1612:
+	.string	"UNIT_TESTED "
+.LASF829:
+	.string	"__DECL_SIMD_logf32 "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2131:
+	.string	"ITerm"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF965:
+	.string	"__DECL_SIMD_log10 "
+.LASF1594:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF874:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF811:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1304:
+	.string	"_Mret_ _Float64"
+.LASF1080:
+	.string	"__DECL_SIMD_logf"
+.LASF1882:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1093:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1668:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF873:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2168:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1778:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1193:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1669:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1653:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF2159:
+	.string	"newItermAccelerator"
+.LASF1452:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF925:
+	.string	"__DECL_SIMD_expm1 "
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1313:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1264:
+	.string	"_Mdouble_ _Float128"
+.LASF1374:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF2158:
+	.string	"pidSetItermAccelerator"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2022:
+	.string	"dterm_average_count"
+.LASF1044:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1419:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1422:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF2012:
+	.string	"pidStabilisationState_e"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1432:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF1136:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1467:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1389:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF1438:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF1916:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1353:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF2023:
+	.string	"vbatPidCompensation"
+.LASF987:
+	.string	"__DECL_SIMD_log1pl "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF2077:
+	.string	"SENSOR_INDEX_ACC"
+.LASF825:
+	.string	"__DECL_SIMD_log "
+.LASF914:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF819:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF992:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1417:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF1266:
+	.string	"_Mdouble_ _Float32x"
+.LASF1620:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF936:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1221:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF881:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF849:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF980:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1566:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF865:
+	.string	"__DECL_SIMD_atan "
+.LASF1784:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1865:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1593:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1272:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1295:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1481:
+	.string	"CMS "
+.LASF1997:
+	.string	"reset"
+.LASF1130:
+	.string	"__DECL_SIMD_atan2"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1676:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1281:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2060:
+	.string	"HEADFREE_MODE"
+.LASF882:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2151:
+	.string	"biquadFilter"
+.LASF1286:
+	.string	"__MATHCALL_NAME"
+.LASF985:
+	.string	"__DECL_SIMD_log1p "
+.LASF1979:
+	.string	"firFilterDenoise_t"
+.LASF1866:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1823:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF1057:
+	.string	"__DECL_SIMD_tanl "
+.LASF912:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1330:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1716:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1905:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1617:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1931:
+	.string	"int16_t"
+.LASF1713:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1384:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1923:
+	.string	"signed char"
+.LASF1194:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1647:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF830:
+	.string	"__DECL_SIMD_logf64 "
+.LASF813:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1940:
+	.string	"DEBUG_NONE"
+.LASF929:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1477:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1316:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1478:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1535:
+	.string	"U_ID_1 1"
+.LASF934:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1209:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1164:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1555:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1521:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1684:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1144:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1723:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1619:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1624:
+	.string	"sq(x) ((x)*(x))"
+.LASF809:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF981:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1095:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1196:
+	.string	"__f64(x) x ##f64"
+.LASF2096:
+	.string	"maxVelocity"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1219:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1411:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF1476:
+	.string	"TELEMETRY_LTM "
+.LASF1446:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1324:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF977:
+	.string	"__DECL_SIMD_log2l "
+.LASF1879:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1770:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF1963:
+	.string	"FD_ROLL"
+.LASF1692:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1078:
+	.string	"__DECL_SIMD_log"
+.LASF1867:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1934:
+	.string	"uint32_t"
+.LASF1185:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF396:
+	.string	"__REVISION__ \"669c324\""
+.LASF2171:
+	.string	"rcAliasToAngleIndexMap"
+.LASF1094:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1597:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1696:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1258:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1969:
+	.string	"state"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF1362:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1285:
+	.string	"_Marg_"
+.LASF2037:
+	.string	"pid_in_gyro_isr"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1471:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1499:
+	.string	"_ANSI_STDDEF_H "
+.LASF1679:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1746:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1396:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1989:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF831:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1084:
+	.string	"__DECL_SIMD_expf"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1081:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1734:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1207:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1346:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2088:
+	.string	"pidProfiles_Registry"
+.LASF1794:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1236:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1587:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1299:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF822:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1255:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF1195:
+	.string	"__f32(x) x ##f32"
+.LASF1767:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1759:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1622:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1698:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF2028:
+	.string	"itermAcceleratorGain"
+.LASF1320:
+	.string	"FP_ZERO 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF984:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1553:
+	.string	"USE_UART8 "
+.LASF838:
+	.string	"__DECL_SIMD_expf16 "
+.LASF928:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1787:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2040:
+	.string	"axisPIDf"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1098:
+	.string	"__DECL_SIMD_asin"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF982:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1480:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1119:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2166:
+	.string	"_reset_template_82"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1206:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1233:
+	.string	"FP_INT_TONEAREST 4"
+.LASF1695:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1270:
+	.string	"__MATHDECL_1_IMPL"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF942:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1965:
+	.string	"FD_YAW"
+.LASF1929:
+	.string	"long int"
+.LASF1775:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1102:
+	.string	"__DECL_SIMD_hypot"
+.LASF1688:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF978:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1732:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1852:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1636:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF1014:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF941:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1912:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF546:
+	.string	"__always_inline"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1482:
+	.string	"TELEMETRY_CRSF "
+.LASF1954:
+	.string	"DEBUG_SCHEDULER"
+.LASF1504:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1859:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF1503:
+	.string	"__PTRDIFF_T "
+.LASF1495:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1240:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1665:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF945:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1842:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1910:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF2104:
+	.string	"getRcDeflectionAbs"
+.LASF1574:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1246:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1903:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1300:
+	.string	"_Mret_ _Float32x"
+.LASF1074:
+	.string	"__DECL_SIMD_sincos"
+.LASF1786:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1534:
+	.string	"U_ID_0 0"
+.LASF1147:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1157:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1199:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1349:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF975:
+	.string	"__DECL_SIMD_log2 "
+.LASF1529:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF963:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF994:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1435:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1443:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1200:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1004:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2129:
+	.string	"errorRate"
+.LASF1629:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1731:
+	.string	"PG_PID_CONFIG 504"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1365:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1202:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF845:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1568:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1332:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1345:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1613:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1711:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1939:
+	.string	"debugMode"
+.LASF1514:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1430:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1876:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1918:
+	.string	"PID_PROCESS_DENOM_DEFAULT 2"
+.LASF814:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1399:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF2021:
+	.string	"pidSumLimitYaw"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1712:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1457:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2030:
+	.string	"dtermSetpointWeight"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1545:
+	.string	"USE_FAKE_MAG "
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1088:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1582:
+	.string	"BLACKBOX"
+.LASF1101:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1278:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1881:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF2003:
+	.string	"PIDPOS"
+.LASF971:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1585:
+	.string	"USE_DSHOT"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1188:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF968:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF885:
+	.string	"__DECL_SIMD_hypot "
+.LASF2092:
+	.string	"dtermLpfApplyFn"
+.LASF1223:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1788:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF1445:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF841:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1306:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF800:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF972:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF864:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1830:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1750:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1565:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1490:
+	.string	"USE_RX_MSP "
+.LASF2145:
+	.string	"pidInit"
+.LASF1526:
+	.string	"__DEFINED_wchar_t "
+.LASF401:
+	.string	"true 1"
+.LASF1864:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF802:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1782:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1633:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF856:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1773:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF2017:
+	.string	"dterm_notch_hz"
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1947:
+	.string	"DEBUG_PIDLOOP"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1104:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1838:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF2075:
+	.string	"gyro"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1183:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF851:
+	.string	"__DECL_SIMD_powf128 "
+.LASF765:
+	.string	"__need_NULL "
+.LASF944:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1115:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1455:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1558:
+	.string	"SERIAL_RX"
+.LASF1607:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1618:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2014:
+	.string	"dterm_filter_type"
+.LASF1121:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1361:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF880:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF2172:
+	.string	"pidConfig"
+.LASF1704:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2163:
+	.string	"pgResetFn_pidProfiles"
+.LASF1036:
+	.string	"__DECL_SIMD_asinhf "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1559:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2085:
+	.string	"previousGyroIf"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1709:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF2161:
+	.string	"pidSetTargetLooptime"
+.LASF1466:
+	.string	"USE_SERIALRX_SBUS "
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1228:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1806:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF1610:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1137:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1561:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1875:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF1368:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1105:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF810:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF906:
+	.string	"__DECL_SIMD_exp10f "
+.LASF839:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1284:
+	.string	"_Mret_"
+.LASF1795:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1528:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1204:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1502:
+	.string	"_T_PTRDIFF "
+.LASF870:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1062:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1005:
+	.string	"__DECL_SIMD_acosh "
+.LASF1915:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1169:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2160:
+	.string	"pidResetErrorGyroState"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1429:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1541:
+	.string	"USE_FAKE_ACC "
+.LASF1367:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF1973:
+	.string	"biquadFilter_t"
+.LASF1315:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2086:
+	.string	"pgResetTemplate_pidConfig"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1447:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1226:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2121:
+	.string	"angleTrim"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1191:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1111:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1951:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF918:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1015:
+	.string	"__DECL_SIMD_erf "
+.LASF1342:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1107:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1222:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2087:
+	.string	"pidConfig_Registry"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1238:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1579:
+	.string	"VTX_CONTROL"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1152:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1355:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF2082:
+	.string	"rollAndPitchTrims_t_def"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1131:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1686:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2045:
+	.string	"THROTTLE"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1946:
+	.string	"DEBUG_AIRMODE"
+.LASF1077:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1424:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1230:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF855:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1217:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF832:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1139:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF1659:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1941:
+	.string	"DEBUG_CYCLETIME"
+.LASF1956:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF1458:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1296:
+	.string	"_Marg_ _Float64x"
+.LASF1444:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1660:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1087:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1937:
+	.string	"double"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhl "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF858:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1744:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1757:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF1203:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1811:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1397:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF1092:
+	.string	"__DECL_SIMD_acosf"
+.LASF1150:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1648:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1517:
+	.string	"_WCHAR_T_ "
+.LASF1539:
+	.string	"USE_FAKE_GYRO "
+.LASF1874:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF1868:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2105:
+	.string	"getSetpointRate"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1666:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1518:
+	.string	"_BSD_WCHAR_T_ "
+.LASF903:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2113:
+	.string	"biquadFilterInit"
+.LASF2019:
+	.string	"itermWindupPointPercent"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1829:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1602:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1341:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1971:
+	.string	"pt1Filter_s"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1843:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1224:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1327:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1928:
+	.string	"__uint32_t"
+.LASF866:
+	.string	"__DECL_SIMD_atanf "
+.LASF1634:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1641:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1850:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF1208:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1689:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1638:
+	.string	"Q12 (1 << 12)"
+.LASF1672:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1442:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1460:
+	.string	"USE_CLI "
+.LASF1214:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF1156:
+	.string	"__DECL_SIMD_erff"
+.LASF1451:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF1883:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF1489:
+	.string	"USE_MSP_PUSH "
+.LASF857:
+	.string	"__DECL_SIMD_acosl "
+.LASF1293:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1603:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF1450:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF1083:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1109:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1241:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF846:
+	.string	"__DECL_SIMD_powf "
+.LASF1243:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1515:
+	.string	"_T_WCHAR "
+.LASF1917:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1376:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF883:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2099:
+	.string	"horizonGain"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF875:
+	.string	"__DECL_SIMD_asin "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1065:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1274:
+	.string	"__MATHCALL"
+.LASF969:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1388:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1576:
+	.string	"USE_DASHBOARD"
+.LASF1694:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1974:
+	.string	"firFilterDenoise_s"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1338:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1448:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1335:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF1022:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1494:
+	.string	"VTX_CONTROL "
+.LASF995:
+	.string	"__DECL_SIMD_atanh "
+.LASF2048:
+	.string	"AUX3"
+.LASF1392:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF1983:
+	.string	"FILTER_LPF"
+.LASF2050:
+	.string	"AUX5"
+.LASF2039:
+	.string	"pidConfig_System"
+.LASF2052:
+	.string	"AUX7"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1902:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF907:
+	.string	"__DECL_SIMD_exp10l "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1861:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF2065:
+	.string	"flightModeFlags"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2029:
+	.string	"setpointRelaxRatio"
+.LASF1630:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2169:
+	.string	"rc_alias"
+.LASF1505:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1173:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1100:
+	.string	"__DECL_SIMD_asinf"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1162:
+	.string	"__DECL_SIMD_asinh"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1122:
+	.string	"__DECL_SIMD_sinh"
+.LASF1828:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF924:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF886:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF820:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1763:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF871:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1297:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1190:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1336:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1360:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1148:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF964:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF850:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1753:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1363:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF816:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1987:
+	.string	"pgn_t"
+.LASF1960:
+	.string	"DEBUG_GYRO_TO_MOTOR"
+.LASF1175:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2110:
+	.string	"biquadFilterInitLPF"
+.LASF1848:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF872:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1936:
+	.string	"float"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF1949:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1544:
+	.string	"MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF896:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF2011:
+	.string	"PID_STABILISATION_ON"
+.LASF1930:
+	.string	"char"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2081:
+	.string	"rollAndPitchTrims_s"
+.LASF2083:
+	.string	"rollAndPitchTrims_t"
+.LASF2170:
+	.string	"rollAndPitchTrims_u"
+.LASF1174:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1552:
+	.string	"USE_UART7 "
+.LASF1645:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF2024:
+	.string	"pidAtMinThrottle"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1595:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1259:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2102:
+	.string	"ITermWindupPointInv"
+.LASF986:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1667:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1369:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1071:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF1966:
+	.string	"AI_ROLL"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF923:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF930:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1375:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF1615:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1729:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1034:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF905:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1604:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1863:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF919:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF893:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1289:
+	.string	"_Mret_ double"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1953:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1623:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1058:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1835:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1436:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1748:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1192:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2152:
+	.string	"denoisingFilter"
+.LASF1762:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1907:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1817:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF2034:
+	.string	"pidProfiles_SystemArray"
+.LASF853:
+	.string	"__DECL_SIMD_powf64x "
+.LASF803:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1777:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1846:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1611:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1590:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1112:
+	.string	"__DECL_SIMD_exp10f"
+.LASF867:
+	.string	"__DECL_SIMD_atanl "
+.LASF1427:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF1294:
+	.string	"_Marg_ _Float64"
+.LASF1046:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1886:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1282:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1506:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1824:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF998:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1984:
+	.string	"FILTER_NOTCH"
+.LASF1021:
+	.string	"__DECL_SIMD_erff128 "
+.LASF904:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2071:
+	.string	"gyro_s"
+.LASF2074:
+	.string	"gyro_t"
+.LASF938:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF859:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1356:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1302:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1410:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1123:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF847:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1287:
+	.string	"_Marg_ long double"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF2091:
+	.string	"dtermFilterNotch"
+.LASF1385:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF1944:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1967:
+	.string	"AI_PITCH"
+.LASF2108:
+	.string	"firFilterDenoiseInit"
+.LASF1677:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1663:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1262:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1887:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1722:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1957:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF1377:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1637:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2070:
+	.string	"attitude"
+.LASF1888:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF377:
+	.string	"__linux 1"
+.LASF1269:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1463:
+	.string	"SERIAL_RX "
+.LASF1889:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF926:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1546:
+	.string	"USE_UART1 "
+.LASF2155:
+	.string	"notchQ"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1890:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1862:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1898:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2005:
+	.string	"PIDNAVR"
+.LASF1718:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF2120:
+	.string	"pidProfile"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1765:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1599:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1290:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF1737:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1352:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1403:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1968:
+	.string	"angle_index_t"
+.LASF1554:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF887:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF798:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2069:
+	.string	"attitudeEulerAngles_t"
+.LASF1791:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1547:
+	.string	"USE_UART2 "
+.LASF1493:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1496:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1605:
+	.string	"__disable_irq() "
+.LASF2009:
+	.string	"PID_ITEM_COUNT"
+.LASF1154:
+	.string	"__DECL_SIMD_erf"
+.LASF955:
+	.string	"__DECL_SIMD_atan2 "
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1378:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2061:
+	.string	"UNUSED_MODE"
+.LASF817:
+	.string	"__DECL_SIMD_sincosl "
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1833:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF2080:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1359:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF1926:
+	.string	"short int"
+.LASF1413:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF1708:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2031:
+	.string	"yawRateAccelLimit"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF897:
+	.string	"__DECL_SIMD_exp2l "
+.LASF834:
+	.string	"__DECL_SIMD_logf128x "
+.LASF2128:
+	.string	"gyroRate"
+.LASF1548:
+	.string	"USE_UART3 "
+.LASF1242:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1719:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1891:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1516:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1357:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF2016:
+	.string	"yaw_lpf_hz"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1557:
+	.string	"USE_PWM"
+.LASF1132:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1086:
+	.string	"__DECL_SIMD_pow"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1901:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2162:
+	.string	"pidLooptime"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1720:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1993:
+	.string	"pgResetFunc"
+.LASF1727:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF2109:
+	.string	"firFilterDenoiseUpdate"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF1416:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF1606:
+	.string	"__enable_irq() "
+.LASF1921:
+	.string	"unsigned int"
+.LASF2076:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1549:
+	.string	"USE_UART4 "
+.LASF889:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1054:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1317:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1783:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2106:
+	.string	"getMotorMixRange"
+.LASF1895:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF956:
+	.string	"__DECL_SIMD_atan2f "
+.LASF815:
+	.string	"__DECL_SIMD_sincos "
+.LASF1701:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1751:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1735:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1690:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1366:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF1253:
+	.string	"_Mdouble_ float"
+.LASF908:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF806:
+	.string	"__DECL_SIMD_sinf "
+.LASF1998:
+	.string	"pgRegistry_t"
+.LASF958:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1844:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF2027:
+	.string	"itermThrottleThreshold"
+.LASF1379:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1550:
+	.string	"USE_UART5 "
+.LASF1680:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF2062:
+	.string	"PASSTHRU_MODE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF1573:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1225:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1726:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1076:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1601:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1509:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1661:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1745:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1340:
+	.string	"M_E 2.7182818284590452354"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2173:
+	.string	"constrainf"
+.LASF1418:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1551:
+	.string	"USE_UART6 "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2201:
+	.string	"gyro.h"
+.LASF2236:
+	.string	"mathcalls-helper-functions.h"
+.LASF2228:
+	.string	"math.h"
+.LASF2181:
+	.string	"src/main/target/SITL"
+.LASF2226:
+	.string	"__locale_t.h"
+.LASF2240:
+	.string	"platform.h"
+.LASF2237:
+	.string	"mathcalls.h"
+.LASF2203:
+	.string	"acceleration.h"
+.LASF2230:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2213:
+	.string	"libc-header-start.h"
+.LASF2187:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2227:
+	.string	"strings.h"
+.LASF2191:
+	.string	"stdint-intn.h"
+.LASF2209:
+	.string	"rc_controls.h"
+.LASF2195:
+	.string	"axis.h"
+.LASF2186:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2189:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2220:
+	.string	"stubs.h"
+.LASF2256:
+	.string	"accgyro.h"
+.LASF0:
+	.string	"./src/main/flight/pid.c"
+.LASF2204:
+	.string	"pid.c"
+.LASF2252:
+	.string	"timer.h"
+.LASF2242:
+	.string	"target.h"
+.LASF2217:
+	.string	"timesize.h"
+.LASF2206:
+	.string	"mixer.h"
+.LASF2198:
+	.string	"pid.h"
+.LASF2185:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2200:
+	.string	"imu.h"
+.LASF2205:
+	.string	"fc_rc.h"
+.LASF2215:
+	.string	"features-time64.h"
+.LASF2190:
+	.string	"types.h"
+.LASF2229:
+	.string	"math-vector.h"
+.LASF2232:
+	.string	"floatn-common.h"
+.LASF2247:
+	.string	"config_profile.h"
+.LASF2231:
+	.string	"floatn.h"
+.LASF2199:
+	.string	"runtime_config.h"
+.LASF2211:
+	.string	"stdbool.h"
+.LASF2188:
+	.string	"/usr/include"
+.LASF2257:
+	.string	"exti.h"
+.LASF2174:
+	.string	"src/main/build"
+.LASF2253:
+	.string	"rcc_types.h"
+.LASF2214:
+	.string	"features.h"
+.LASF2179:
+	.string	"src/main/flight"
+.LASF2222:
+	.string	"typesizes.h"
+.LASF2251:
+	.string	"pwm_output.h"
+.LASF2175:
+	.string	"src/main/common"
+.LASF2176:
+	.string	"src/main/config"
+.LASF2202:
+	.string	"sensors.h"
+.LASF2223:
+	.string	"time64.h"
+.LASF2219:
+	.string	"long-double.h"
+.LASF2192:
+	.string	"stdint-uintn.h"
+.LASF2182:
+	.string	"src/main/target"
+.LASF2258:
+	.string	"accgyro_mpu.h"
+.LASF2238:
+	.string	"mathcalls-narrow.h"
+.LASF2246:
+	.string	"parameter_group_ids.h"
+.LASF2180:
+	.string	"src/main/sensors"
+.LASF2249:
+	.string	"time.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2233:
+	.string	"flt-eval-method.h"
+.LASF2183:
+	.string	"src/main"
+.LASF2248:
+	.string	"fc_core.h"
+.LASF2218:
+	.string	"cdefs.h"
+.LASF2239:
+	.string	"iscanonical.h"
+.LASF2255:
+	.string	"sensor.h"
+.LASF2194:
+	.string	"debug.h"
+.LASF2224:
+	.string	"wchar.h"
+.LASF2235:
+	.string	"fp-fast.h"
+.LASF2250:
+	.string	"io_types.h"
+.LASF2177:
+	.string	"src/main/drivers"
+.LASF2241:
+	.string	"common.h"
+.LASF2245:
+	.string	"config_reset.h"
+.LASF2208:
+	.string	"maths.h"
+.LASF2234:
+	.string	"fp-logb.h"
+.LASF2207:
+	.string	"string.h"
+.LASF2184:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2225:
+	.string	"locale_t.h"
+.LASF2212:
+	.string	"stdint.h"
+.LASF2244:
+	.string	"build_config.h"
+.LASF2193:
+	.string	"stddef.h"
+.LASF2221:
+	.string	"stubs-64.h"
+.LASF2216:
+	.string	"wordsize.h"
+.LASF2178:
+	.string	"src/main/fc"
+.LASF2243:
+	.string	"common_post.h"
+.LASF2197:
+	.string	"parameter_group.h"
+.LASF2254:
+	.string	"navigation.h"
+.LASF2210:
+	.string	"stdc-predef.h"
+.LASF2196:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001/"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`\340\001=\013"
+	.string	"D\016\324\002"
+	.string	"1"
+	.string	"\235\220\226\317\003"
+	.string	"\001\322\372\317\201\t\002\317\346\372\233\001\004\002"
+	.string	"\003\240\342\234\212\n\004\254\252\221\270\007\016\002\001\002\002\003\002\003\002\004\002\004\002\005\002\005\007\b\t\232\373\214\201\t"
+	.string	"\n\266\210\226\325\b\004\002\006\002\006\013\f\r\303\216\256\340\002\002\002"
+	.string	"\002\007\016\017\256\330\276\211\r"
+	.string	"\020\315\343\301\244\013\021\356\363\250\233\t\002\002\b\002\b\022\023\240\343\363\305\t:\002\005\002\002\002\t\n\002\013\001\n\024\027\030\031\033\034\035\037 !\"#\306\311\336\317\0052"
+	.string	"\002\007"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	"$%&'()*+,\340\333\306\357\b\b\002\006\002\f\002\001\002\r./\214\274\202\316\f@\007\f\016\001\002\017\002\020\b\002\b0125\336\215\314\344\r6\200\221\251\254\00378\306\367\220\200\0079\224\341\245\213\017"
+	.ascii	"K\250!yB\201\fEIAZ\f\300\202!2v\021\260x4H\033\355\265wh\370"
+	.ascii	"Z~i?\306\004\n\306\244\017\271\226\303\036\337\3661.\265\217"
+	.ascii	"\320\262H\347L\376\270\367\037\351\214\231cu\024\334\212\244"
+	.ascii	"\252\327|\320\273h\236\246\372I\301\224\213\r\315\212\263\020"
+	.ascii	"\206\035\253}\033\2148g\213\301dzOG\301\303\375\266\274\364\341"
+	.ascii	"\302F$\332\027\375\235'8\362\201px\031g\303\006zZj\341\212\324"
+	.ascii	"\036"
+	.text
+	.section	.gnu.lto_.ipa_sra.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375 \377\005\004"
+	.string	"\262\005\020\032\300%\215\001\377\377\377\277\240U\325\227\273\334~\3026Y{\221],)eJ\001\252j9\301\005(^\372M\024Q\337\357@\305\022\017FO\332\0264\334hi\352\007.T\337\231\265n\257\356q\020\032"
+	.ascii	"x\006b\250\251\032\240c\b\250\n@t\201\023,Q\331\242\261\340\303"
+	.ascii	"3F\005\310\031(/W\007\2050\034\001{*\203\265\346A\341\346T\321"
+	.ascii	"\356\002\310\f\264\022pLRl\026\264\001,"
+	.text
+	.section	.gnu.lto_.inline.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`U\002\005\r"
+	.string	"f\223A:@\305(\215\001u\201uu\335\317\327I\322#\300S\005\313\026\232\350$\2330\021\2113\3666]\260\343\200}6#m\236'\3642l\357:!\241\257\277\275.\267h\377\337R\312\024-"
+	.string	"/"
+	.string	"4"
+	.string	"\343\231n\332A\240\305\004!_KY@#\004%\341||Q\247\217\235\367\237\347(ww3_\312nw9\371\310)l\027\225}\266B\004\273\213\232\244.\273\253\231`QW\220\377\233G\371~k\252\347;#P7,\f\222\013\007\314\017J|m\351\237D\314\225\313\227\n"
+	.ascii	"\326\302\017\003*\314\243'#\352~\313\224\200\003\024\236\347"
+	.ascii	"R\345\341Z\301\224)AF2X\016pHK-\017p\303\374\3212G\352)\345\252"
+	.ascii	"\363\377B\211\343\272\351r\356\274\211#(\3630S\335\030\0203\240"
+	.ascii	"\371\223\236|TX\340KB9V)/\330\375pkw\r8\025\331]\320\r\244\204"
+	.ascii	"\355\356\347M\032\333]\323)Kvw\327\n\f\001D\250q\271rDJ\202\224"
+	.ascii	"\024\333Y\003\220\002!\":\017\021 \265T\312$\030-4\324Y\326\367"
+	.ascii	"\321\266:\276\262Pn\300\265\341\323'\003\331!Y\244\022\027Kw"
+	.ascii	"6:I\213\022t\233\344\256G\342\177\262\365G\r\352@\226ah\271\017"
+	.ascii	"\271\226\257\311\232\3508\252\242w\243\353\235\376\235,J''F\034"
+	.ascii	"\200\2039\335\230\370>M\225\315WA\223\243p\216\234\373\221\254"
+	.ascii	"\325\365\024\262m7W%\220m\267./~\375\346k\023F\264\311\020\275"
+	.ascii	"<\204\256\221\367\034\r\312\364qx"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`-\002\265\b"
+	.string	"\202\214#(\200)I\0073\260\f\003\020\264\203a\006f\352FG`\004H\210v1\020OC\251j\030\366\373\325\037\321\177\363Md\222\001T\260\215"
+	.string	"\032f\356\207z\273\300\327\201\3557d \033\365\215\352\347n\372\207j\302\037\312\335\035#\316=\232\320S\374\332\362\374rP\300PH\202%\231\342>\361\022O\243Z\364~"
+	.string	"m2jT\2664\250}\377Ddn\3104\267d\311HdVTmG\275\243:!\020zH+A8A&kQ;\317\001\236\205; \200\002\031\273\342\001\317\202\t\336\230\227\203\0059\020\003{\0132\212\251B\340\363-{s\207\221\324\201\317\261`\273\003\354\f)%\243\207\367\300\037\022@\271\244\231:\b\t\r\224\205\026\201\237\212\335`\354\374\2555B\343N8Z\027\221\270`&\031P"
+	.ascii	"\007\007\\)xLL;{\364\r\367\242\345\277X\251\\\253N\003\335\253"
+	.ascii	"\223W!0\246]\202I\342\275\211\375Dl\320. \021N\0340\307\021\022"
+	.ascii	"\013.\212\033"
+	.text
+	.section	.gnu.lto_.pureconst.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\230\004\002\230\004\004\231\004\t\230\004\n\230\004\r\230\004"
+	.ascii	"\017\230\004\021\230\004\023\231\004#\231\004,\230\004/\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`\356"
+	.string	"\215\b"
+	.string	"\342\215+0Pm\222\016h\0203\r\327\021\321(Y\031\243\260\231y\331#\004U\315\231ATE\210\366\200\217\214a\377\354-^\300\2578AF\354\214\021\"e\nk2\032\213\213\214\344\210r\210>\250\243\250\023C -\303\303\3236\215\016m\240\240\304\375IZ\034\206\336u\362ps\025sv\253\221\3631\227zyL'\246\374\322i)\267T}G\221\371\304\332\346|\241}R\365G\204\244\362\300@\241\274"
+	.ascii	"*\207\332\037\020\230\225\362J1\330\223'tR\312)e\247:&\371|R"
+	.ascii	"\200_\322Y\237\365y\255\211Pvq\2144\215\215\003:\234\340{\206"
+	.ascii	"\004) `\202Qf\326\003\020\te\334\323b-\035\324\215P\247\201\342"
+	.ascii	"\325FU\r\264&8\023i\373[\234+<Lf\007\r+Pm\322\"&\003\244](m\030"
+	.ascii	"\230\331\2201\020*3mk#|\030\t\304e\350b\bW`\"\246\353\302\361"
+	.ascii	"\261n\ra\021\346\217\325\345\266b\355\270\313\020\227\301\025"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.lto.3426a74754ec15b6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidConfig_Registry.46.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375 \203\355\003"
+	.string	"\364\006Q"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\304\321\037\005\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\314\005us"
+	.string	"\005\001\006'\001\002\370#(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.ascii	"L\005\226r5E5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidConfig.48.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375 %\r\001"
+	.string	"\310\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\002?\202\210\200\020\177}\274\001{\273\001"
+	.string	"\002"
+	.ascii	")C\017\240\b"
+	.text
+	.section	.gnu.lto_pidProfiles_Registry.51.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375 \203\335\003"
+	.string	"\324\006Q"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\202\200\200\374\342\203\317\341\027\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\336\005us"
+	.string	"\005\001\006'\001\344'\001\016(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\004"
+	.string	"L\305\350\031R\212\"o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_resetPidProfile.52.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\035\n"
+	.string	"\246\023I@ \345*\035"
+	.string	"\274\220\005X\004\027H1"
+	.string	"\023K\326\364\341A=\017\307\\P\001"
+	.string	"\003E\207\304\332\260\027\003P*\3200\260\265\211\002\224Q!\027(n\003\266\f\260\264\b\f\204\207\266\021B\366N)2"
+	.string	"6"
+	.string	"7"
+	.string	"\235{>\257\360\335\353\034\341\273\347\322\026\3603\266\247\305Hdp\273\013\326\224\227\247\245\377\331\t\314\326\352\224S\261\273\246f\313\344\256\267\355`\333\3026\201\264\242\330\357vw]a\366e?\3552Xp\003\026hvK\016\030X\233w\263B\251\375\263\264=6\303\214\304\351g\276\313_\312\313B~\260\013\253\325\354\236\021~\b\271\033\207\272v\003\370~>F\005\021 \266\313\272\351\303\234\206\352\256r\317 \252\357\346=_\365\335\243\325\366\370\2407\335\300\252+\3775{%\264\270r\267\245\005\354s\025\026\205B\212041\002\031\220Lbi$1F\342\251\300!h$\236\300\324\206\206h*\201\035\242\210\003\fI\024\b\372x<\221H05\216$\3509\367\335V\230/Nl\"u\304\037\033W\n"
+	.ascii	"QS\240L\350\375\013\f\217\017\220\020\207%P\270\214>]lp\227\027"
+	.ascii	"\355$\003"
+	.text
+	.section	.gnu.lto_pgResetFn_pidProfiles.53.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`m\002\345\024"
+	.string	"\246h\212I\300\322Q:B;,\304p\"%\366@\024P\224\340\002u\206P\352\251 \347\220\200\320y\250\264\330^ \200"
+	.string	"jj%\030\316\0164%O\330[\024\246\300\243P\330\202\032\302\314f{\375\351^(\220\233\3567g\263d\313\235Rq"
+	.string	"s"
+	.string	"s"
+	.ascii	"C.v\353\341[\266kGvi\037\350*p\017zy\201\335\234\246\245\335"
+	.ascii	"Q\304\t\304\207\036\177@\365P\274\001\325C\343l\034\037y\366"
+	.ascii	"\277\0171\277\250\335\215\351\216\365s"
+	.string	"\274\247\304=\234*q\376j&t\004$b\360z0\017'\201\335\025\320\3430\031H\231\236N\316\236\232\353\177W\3003\305\353\325\\\256f\273k\311\353\321\334\252\333\266\331\216`\313\233\273\326\034[|\320\277\272\357\236\227V\225\226*}\026\313\207F\b\217\335\231)\037\353\024\3020q\337o\337\037:\320\345D\376\221\322$\245\330\335\326C\243\242\227\231\256\303\316$\036\033\260\207.%\331\345\215\\^\364\0022.\315C\210\030\201\242\036\032\202\370\320\205B\346\217\376\317\345#\263\355\2578\013\334}f\022a@\210E\277\231\034\273\013{\350\022\361\341k>_\272\205\324\340\331\335\235\347+\335Em\276\304Cc\270\251\316\273\251\036\252\372\300\f\032\344y~\355\024\306\307\021\302\001\236E\304\364\264G\237\360\263R;V\006\255z\243\277r\272R\325\267\330\3718\351\226\241\272J\375\356\204NNy\352u\336\210\371\221\223S\016"
+	.string	"\354Q\335]\0305\354\367\375\301MN\006\375\337\347\017\216\004\332<\255\f\332\243N\252\216\375\357\006,\332mBr\342\340\204\244\001\312\310\200[\312\nM\245f\223\200Bci\371d\004\205\306\022k\251@\201\266\242\022\273@3\261\020;\261\335b# \256\261\244\330b-\265\232-\326\032s\377j\216/t\021\370\343\224S]\250:^5\251\250\n%a\237*#\362\251%P\033d\217\0318Sg9\031\374\234\242\336\367\327\202O\025\365\273\021.\240\315\377\373="
+	.string	"{\234@^\334H\351X\0314"
+	.ascii	"y\244\037). P\002A\214Yy\301\375bh8t\365\257\354`Z\250\022a\235"
+	.ascii	"\223\035\b\004\363\004~Y\350\2035(D\330W\320\355X`\243\316@\021"
+	.ascii	"\355\260\007+\020\326\260\327\233\311\r\332+AX\362\025\336\342"
+	.ascii	"i\303\264&\017\202il\033\301\3005+*H4lH-Q\344\306\342~<\367\006"
+	.ascii	"\232\363\275+K\2730\026\321\006\013{\233\003\376)w.\363\004"
+	.text
+	.section	.gnu.lto_pidSetTargetLooptime.54.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"%\013"
+	.string	"vUOD\020mj:0\221L\363\021\353EIx\334\214+\250\320:\\\365s\224'\251\022#7\254H\321\003\205\376\223\333\254\333\373\002\363w\001"
+	.string	"\334(\300\370\003\3600\bR\034\r\230\rp\216B\001L\306\250\221-S\n8"
+	.string	"7"
+	.string	"?"
+	.string	"\033^\273\343\2071\025\327:\236\261]\313\216\261]sh\223\370(aO\242\022\220'v\227\233\021\036^C\377\254W\304\323\350J!\331]\253xbp\317\333\276\330.\261\217\t\212\302\036G:!\330\317vw=S\366W\177\246jU\365)\026\257\020\036\261]\005e\212\205i\035(\330\276\3751\264-6\307\002\220\353Y\276\205\253\302\257D\256\354>\b-\267\266k'E\023v\335\324 \346`=R\226\037\020\354\222.\237:3\020\246\n%-\235\315\317{0\225`e\323\277p\f\"\177\202\017\204\364\3425?\264]\323\030\201\"ii\325\240\022\261\001\336h:\221N\023\302\311\\t<\036\b\374\276\023\216\007Z\334e8\036\310\201\004\004\360\006"
+	.string	"\340\bx\033\017\327}\np\231\r\177`\347\303\201\276\357\303Y\306}\2663e\302\001F\232%\353\364\311g\260\313\200\003\r"
+	.ascii	"bS\340L\350\025\nL\200nuh\007\207y44\256\212\233\003\274[\252"
+	.ascii	"\225\323\005#\270\346\026\302|\002"
+	.text
+	.section	.gnu.lto_pidResetErrorGyroState.55.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`B\0015\016"
+	.string	"fZ^E"
+	.string	"\223\223\016\300\215y\320\265\201[?\201\031\025\227\313\312\341/\004i\3212\375 aL"
+	.string	"\233\246Z\317\2321\b\f\n\246\004\263\225\032\331\377\377\377\333Qo\231\342\320\327\333\351\274\235!\265\303\035O\020\331[\312\224\002G"
+	.string	"I"
+	.string	"I"
+	.string	"\366\216\1772{U\n\204\252\265\273\232\236\260\036~7\314\322#\324,\371  \232+H\275\270\316\364\b\t\354\256\200\316\003l\220-\035*a\n\227\353\277\227\244rp\235\313\023\004\264\273N\256#qc\267M\262\375\300~\210\233.\3733\245\306\330\377*\214\035\357\335\307"
+	.string	"\330\270Qb\263+\342\365co\242\f\024\367~\373\"-\217\277\302\377\314\021\351\3419\213\267(\335\363\214\3144\"\213\241\232\341\261\273\235G\223d\217#7\200=\302\027\300\036\317q)0\352\275\217x~\215\372\017%P\3712\tWc;\027\330\346p\030\2569\240cwO|\027\177\241\301\237y\364\006\226<\367\350\263`\217\tdZ\247|9\300\252\206\352\356\232\324\235\337;\004\023\247t\371\337\241\212\227\\\321\300\021\016\231l'\233\211\003\224\317"
+	.string	"\025Q\206\020\364\366A\021\245h+\025(\210,L\3200\210B\027\264\215\244\242}\020x\224\"\201\244\255\214F$\215\363\355\025\3064\317V67'EE\215q\bK\243*+;\277\2660\3705\002\253C\372p\275\254\202N\351:\f\036"
+	.string	"{\221\"3\264\237\311.t\317\353\357*X;\035\353\231\330^\236Y\205e\032[\302\r)\336\b\365\330\220\033\230"
+	.ascii	"V<ea\305N\327\304\251\211<\224(\301*\364\313\025Af\334\270Q6"
+	.ascii	"\330io\317\001\177R\356\\\363\t"
+	.text
+	.section	.gnu.lto_pidSetItermAccelerator.57.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\345\b"
+	.string	"&\021@;0\345(\035"
+	.string	"\354]\217\005-\017\024\250k\267\327\313\037\340C\306\312\300"
+	.string	"\245\357\276l#)\224\\W\276\367A#\366\206\201\232\001\202N\331\217\311r:\032?\275\234!\262\311\336)\005,"
+	.string	"/"
+	.string	"."
+	.string	"\332;\333\245?\233\346-\221\275\313d\303U\263\2733\206\374;\374\374\243|\223R\235\016\003 v\3270\245\352\270\343m'\330\236\260\275\022\037\366Y?\324\024V\237q\355r\314\002lL\276\224\330>\307>\210y8\264\177\362\325w\226a\336\354\302\264\270\354.\203\027\004.\021N\260]\006\234\326^\026CE\r\303\350\247\\\3050\237\304\031~\301\247.}\277\266\313\202\021\017\024\234\031\262"
+	.string	"\220Y(\263['\030A\354k\273\273\216\001\006}\250\003\3754\204<\003\265\363@\225\033q\224F\220*\347I`p\245\216\251'$2M\317\242B4\242\230%\021\2104i\275\230\036\003w&\256N\257\353\352\f\t"
+	.string	"\352S\240\314\2000\034EX\002\233"
+	.ascii	"\3432\312\267\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_pidStabilisationState.58.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"\245\t"
+	.string	"\366\222F> \345*\035"
+	.string	"\2748\205\200\250\023L\342W\243h31XM\221S\034\005"
+	.string	"\023\023\034Ck\230r\200\004/\350PT\332D\005J2\004C\314\306\232R\204I\321\241\225g\035\007!d\357\224\0021"
+	.string	"2"
+	.string	"6"
+	.string	"\336\302\017\276{\335\013\276{6\355\230\237&{\230\353\003v\333]\260\226\334<5\375\273\256I\251L\247\001\023\273k\232R\211\334\365\266\031lW\330v\t\366\273\335]W\226\375\326O)\365\275\213\325m\306!\266\013\222\013\260/\336\f\305\3667v\202L\342\324~\312U\314\267J\326\354\216\300\260\354\236\017n\020x\035m\205\2239U\224_\375\225\277<\374\023w\220\350S\367|\322wO\341U\223\331N4\347\277\364\321\372\372\026T-6C\321\234\rh!8\333R"
+	.string	"\366i\242\225$\366t\302\210\260\003\361\341\f\200JOiA\202B\241\221,E#\305G\034\0218\344|\304\021Xjd\210!\fP$z6\300\220\344"
+	.string	"9\b\036G \022,\307\221\0047\347\276\333\312r\b"
+	.ascii	"\331S\240Lh\361\013Tp\341\330ehk5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_rcAliasToAngleIndexMap.59.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375 %\025\001"
+	.string	"\320\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001"
+	.string	"?\202\210\200\020}3\274\0014\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_pidInitFilters.66.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`\006\021\225I"
+	.string	"Jx|\032<0\346\316\0304\324(\025\017\005\350\317\f\0044s \343\266\275c\247\260Tf\202l\205\023\314\357\204\202\202"
+	.ascii	"\300|ca\r\263\2253\250\302D\225\213,\"+-Y\331\335[\344N)\245"
+	.ascii	"\240\001m\001\226\001QAn\247\312\246\211Un\245\020U\231!\275"
+	.ascii	"fruv\204\200\334J\355\371\353\233\223j\263\305\275\206\373\217"
+	.ascii	"[)7~<\350\327'$\f\331\253\324\231-\3564\334j\270\355U\252\257"
+	.ascii	"o\007\022\232\3264D.\b\342\373\276-\220\275\032\333L\363q+\205"
+	.ascii	"\245\3174\032\267\367z \241i\310>\276C\020\310^\253\214Rx[[\020"
+	.ascii	"\334\326\363\201|\355\216~{\030!\276\257^V\257\234\001\t\300"
+	.ascii	"p\253\235\271\311t\236\333\323\037\235\364\276T\344\004\276\257"
+	.ascii	"\236\002\306B\366\312z\375d{E\366\022\333+\263\313,\250\365\346"
+	.ascii	"\336\346\263\203\306\247\350}_\255\227s*=\331\333\250\327|\\"
+	.ascii	"\335\216\202zrj"
+	.string	"z2-)%!9\233\314e\253L\"\217\354j|w\271\007\344-J\325\240\035\005\345\354SM\204[\023\323O]\230\026\246\235\352\300x\223 \026\177fi&\301\306\232\336\301\255e\351\245*\235+Y\351\244jc\325\335\301\255Yi$-\200Q\334y\354\252\262\346\326M\300\306\232\273\203[sk\346\261\353K\256mye\216E\202Kkc\221\004\300\245A1\266\307.9\266D\2705-\255|\222,Lk\"`K\232\023G\032\237V\266\334ua\032\233\021\301 `\265\377\316\374x\307\244\331c\327_\033\267\200\251J\325\230\364\252\024\247\230\b\267\306\326F\343\363\210\026iS\r\210\021\001\242 \242V\315\314\277\251Vf\254z\337\267\371\332\207\250\231\271\037\273\336\367e\227\252\2555\003hf7\301\3144\230\235\021\002\204\255\246\233\310\337\"\277\311\0033\267j\370\272\362\363\276\321\226r\327i;\035<|\360\226~"
+	.ascii	"\224.Y\3765\372+g\372\344\030?\216\301\033\337\371\240\271\363"
+	.ascii	"o|\366\020\332\243\250/\266\277\357\013\375\021\354\177\0134"
+	.ascii	"\206f\316\210\231C\264\234\021\310\3675\343\342\216\343\262\221"
+	.ascii	"@b\371\301\366\372\3774\234\372\337\242\255o\275\2473\237@\341"
+	.ascii	"-\335\372F\362V\366Pn\r\341a\360\275\327U\321g\360}\350\354N"
+	.ascii	"?W\233\215\357\033%\340\337gs\312|\221\271\335\364\033\256rc"
+	.ascii	"\341\024L\365\226\366\312\315T\266\327\376\007tlQ_\344v\016\234"
+	.ascii	"7m\332@\377+S\370z#f=\250\177\034s\033\337\247\302\374\345ua"
+	.ascii	"\302\3229B\3675s\365\264\333A\3535o\365^3\203\016l\306jjs\201"
+	.ascii	"f\323|\325~\315VLg\002L\347\001Ng\001J\347\252\245s\200\326\231"
+	.ascii	"\212\351<\345t\226j\235\0010\235\243\226\316PI\316OJg\247\326"
+	.ascii	"\271i\351\374l:31\235\227\234\316J\255s\222\322\031\t\311\331"
+	.ascii	"\351tn.\235\231\255\363R\351\334\266\316\312\245s\262\351\214"
+	.ascii	"d:\037\231\316l\353\274.\235\215\255\363+\235]\351\334!\234\323"
+	.ascii	"<\n\022\275\357\221EG/\341\332\246\256\003\273\251\335l\272\375"
+	.ascii	"\272\373\272\365\272\367:\351H?:\353\253/\231{*K\357\034\342"
+	.ascii	"\026\251:{(+\375R\322+\275\003\272y\223\021I\177\301p\032u&H"
+	.ascii	"\237d\033,t\276\022>\f\340I\216\270w\306C\276\266\"A\027Ws\325"
+	.ascii	" \370\021Os\221\340p\225(a{u\376\312\307Du\323V\245\311\246U"
+	.ascii	"\274E\001\3338\b\327\244\n\272L\334&\017\210\224Y\354%5\217\331"
+	.ascii	"\244\216\t\340B\016\303\024\276\212\335\374B\bu\305\345\307\361"
+	.ascii	"\031;\232\223)c7\353,\376\262C{\212\3555\212\335\373\366\036"
+	.ascii	"hA\310\367\205v\024v\351\213\366\304\356}\337\003\016\336\200"
+	.ascii	"\370\243'\355\310G\363\247\f\247^\272\235Z"
+	.string	"\324\241\355\303S\357\224\314\367\351\362\231\317\356I~\334\234^\272n\235h\331|\255\244\272!?\216\235Rv\302\257V\326\254\266\372!\336<\310Z\275\327\237\376\353\325\r\316\352\273\242\336\250\025\307\250ir\234\360\355\327U\t\332\352'|\237E\251`\004\211\226w\273SX\256O~\373\3108W\316[\312\306\227\355\241\254\374\366\373\360\f1\352\213\204\224\337{t\323A\215\330\303\245s\257\\a{M~\222\215I!\362\017\371\220\312\0177\240\016\344fq\353\334\273\273=RBQC0\2549\351\227\366\343r\2510\367\276\257\004>\335\307\365\302\254\303\305s\361\336xH\272\244IU\362=\367\350H\"\233U\342-\017nIE\302\365\335G\300\331?>\263;\306\315\363\226r}\025\220\207\362\377\361{}\366\277L\353Y\277\341\320M\251j\030\274\270\0028\302x\2600\216\220\001\226C\254\006\233\003G\230\216\033=@\364"
+	.string	"\253\361B\307\215\027c\033\\\204\331Xr1\343\005\2071\034\035\304\306z\304h\231E\0030\t`\r\"\270X\340|1#\f\206\330\230\b\027a6\224\f\266\300E\230\r\255\0342b\204\315\200\241U#\214\005\r-\2601\034Z\013\236X\314\306\2131\255\034bbcZ\255\336\333e\b\243_\306\037\234@\0372C\263\207\362\326\023\360j^\024\005\257\372\001\317^]q\234r\b\206*\340\007P\275\200o\264G\177U\237d\303\3635+\246\346\274\317\325\270j4V\254`\367\234\217\017\001\221\035\036\362y\201`\206\013\224\325\224l\220b\325\355)\300\373\027\252\017\360\354\240\023\025Y\242\223\241\252\26651]\370\365\317RVca\tb}\007>/|\007b\375\005\305\r\036\365S\377\364\314d\207\310\022I\375\024\200\227\n\003\340\273\217n\032\341\243\276\005;\211\366\350\027\027\333"
+	.string	"\013\365\021\236\035\215\255\354\013\324'\331\230\252jO\337\205\313\235\n;\267#[TA\213\327\2215\022#S$Sd{}Zd\n\024T$[t\241W\032\001Y\264\224\344\365\353\037\244\254.P\240Z\340\233\252\344\365M-\360^x,\370\363\235\236\t\210\213\326\364N\357\200g\210sM\337i\f\275\312\263P!\323S\231\342R\300\022l\3617\227\013\227\037ws\275\334p\361\230\022\223\250U<\017\240\330)|\243\335|\335D\250t\220\374\232_\277\376af\365\325\0179\324W\200\275\342]}\263aBh[\025\347\3277\233\253\377\262`D\220\202#}\201]\250A0&\035SfFDD$I\2224\006\221\005\304\030\007\325]\007\021"
+	.ascii	"\2514R\325\210&\005ie\016Q)\225R\223\262\254\257\3355\021\241"
+	.ascii	"\371d\353\235\253\225\370\003L~jc\361\305\201s\236\343$\241\340"
+	.ascii	"\006\215m\222\2625I\256T\261($\0059\202\032\027\215\306\203e"
+	.ascii	"\302v\225\307b\3247\364\022\376\253\022TEx6\016H\246\003\255"
+	.ascii	"l+\007)\361\232@\274\376\235?\017\327f\315A\307\200x\217}\271"
+	.ascii	"\0214\352m\272\244\311\234&h\350\374\375\256\350\262\217\242"
+	.ascii	"X\035m\350\360\250\226\321\377\223\310ea\274~>\2702k=\263\302"
+	.ascii	"\263 >\270}\0276=\366\345F\250]P,|^]#3`W\021-\356\326\315\020"
+	.ascii	"\267!\215\307\335\323\202\224\352\2652P\311\353\245\275#\250"
+	.ascii	"\201O\302 T\027\246\035\021\316N\254\263\005\316\202i\236O\234"
+	.ascii	"\256\272\365\264q\0325\267\3372E\257\313\037\273\032\271\005"
+	.ascii	"\222!\310S#z\213\347\024\344w\263\307\225\365\345\033\300\001"
+	.ascii	"U\030\260\363\231\356\317\032\177\314\2361hj"
+	.ascii	"WX\360\374N\224\320\346\237;S\354\370\202\210x\311\254\302pu"
+	.ascii	"\223\254o\347M\036\225T\305/\375\356\342\366\370\236s\226\037"
+	.ascii	"Z\260-\271\253\332\331\367\265%\261A^\317=\003$2\250\214\326"
+	.ascii	"\032\255\212\243Vq\233\215\t\353G\242m\301\237r\273\335$\235"
+	.ascii	"\302\t7\027Sy*\3135\\\231/\231\022)\325PA\272\306\230w\316\203"
+	.ascii	"b\272\202\342\321\350ed!\364Ap\246A\342S_\277\204\332D\206\341"
+	.ascii	"\326P\376\020L=#\202\364XLPd,\002\033P\361#2?\n\224J\325\022"
+	.ascii	"\245\366\231\211\312zgo~3\025\373\307\341\230\242\207\317GNV"
+	.ascii	"\246a)*@A\313\036\251#\315\320.\300\223_\325\272\242K\313\023"
+	.ascii	"$;\331`\313\360\037@\356\360\200\027\007\343\225)#5\367\024\205"
+	.ascii	"c\204\331\315\207\t\006\027\fP\235\204#\034\243\331m\363\333"
+	.ascii	"\003y\360\227\027\037tQ\230\373\221\202F\232\375\366\222\254"
+	.ascii	"&Mbz\231\031\bH\371\305\272\222\355g@{5\222O\034\357!\260F=\376"
+	.ascii	"\204\223\243~\003\240NTl\242@\203\031>\032\177\374E\207QO\253"
+	.ascii	"\336\312\274\030u\226@\303f\221\374y\374\210\345\214\262}D>\345"
+	.ascii	"\203dla\017'\260\0311\3266A\327\306X\037\373 ._b\263\017M\003"
+	.ascii	"\215N{\003\331*\"\007\366\263\222\277u\336\037"
+	.text
+	.section	.gnu.lto_pidInitConfig.78.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`L\t\005+"
+	.string	"\272J"
+	.string	"\020C`\336Q:\363\302(\371)g\240\025\346\327T\220:oDHt\2449\216D\f?p\203\361\262_\303\247\320\254n\354\211\302FW\006\325'x\307\242\344A/\211W\241\326\362:\342\221@?\330o\233\310-S\340"
+	.string	"\325"
+	.string	"\370"
+	.ascii	"\365J]\237d\353\221l\275\017\255?\352z#[\337\263\365<\264~\327"
+	.ascii	"\365\326\326\243\266\276\321\372\332\365|\341HJ\222>\023\n\335"
+	.ascii	"\353\343\231\350\302Yg\025n23\177m\206g1g\266\373~N\036\303d"
+	.ascii	"\216\334\274[\017\371\243Wf\212\241\271{\257\207\036[ \312\034"
+	.ascii	"\346\276\037\333p\350\340\310Lc\357Z\341\241\321S7w/s\213\355"
+	.ascii	"\275\376\3432\344\372\263\027\376r\3445\033\334t/\2248l\356e"
+	.ascii	"v=\253\307\366L\206\332\261\355\261\323\216\355\217\377\037f"
+	.ascii	"\246].\363\007G\263\356\336+\354"
+	.string	")oF\231|\264\036\331\242]\217g^\2050\\u\246\314\022\r\311\026e\272\367*\241\335@\025T\035h\311\212^\021\302\315l\254\005&]\242\t\341\312\253p\357}]\242\001\341\357\370\177\361\277\210\337\250Fug\367\232Yu\243\315J,\311\372|\355\356\036\244\234\343\256\3158\026\231\325\247\023Nc\024\246\335{\026\341'2\032\026\275{\317\036\2349\026q\321\225F\205\355\331\306\216-\267P\315iV\237GJ\007u\337{\221\375-\346&Kh\302l\214fqR\323@\303f&\003\315*\242\367\352\037\243\254\362r\330\034\244I\262\221\257)\240:\267\"\372\231\310\332Q~\346\333P~/^cf\300L\376\220\233\374 Z\337e\353\271l\375\226\255\327\262\365\t\272\036\201\255\317\262\365X\266\376\200\255\277\262\365V\266\276\312\326\033\260\365@[O\205\326Ou\275\224\255/`\353\177h=\201\256\037`\353\243l\275"
+	.ascii	"\264>@\327C\331\372'[\357\204\326\003\350\372&[\317d\353\227"
+	.ascii	"\320tS\003\372*H\324\\\bV\244"
+	.string	"&O\226&\207\004tT\200\026\320\326\r\252\0030\037\366c\244\212\353#\025\307\343\273\355\330B5\225\234\323\211\366$7\242\256Y\3229\365S6s\357UzjV\276\001h\247\356fS\003 \301y\232j\372\254\303\324g;|\347\351\231\312K\274\355m;\266\275\006\211D^AK\315\244\324K\315\233\223\324J&\030\316\330\273\367&5\226\334Z\030>J\025\331\216\362\244#\355\325\375V\2678\330:\376\277\213\203}a\317Y=d\2078\tv\005\263\212\210Q\324\253\271\311@.\016\266W\263rI\2034\020\022\2359'\226o\242\364\3615\322Q\373\214\372\350\r\005\31312\324\203\363&\305!&\314D\274\356\355\232g{\347\346\213\235\266P\035\264\331<M\212\273\367F8\267q\nv\261\261\312\313\261\035\333\352\266\244{\312\311\"Z\340\356)<\237\001e\304\031_hX\0131\r\305\262\rdE\032c\276\177-"
+	.string	"\213"
+	.string	"\266"
+	.string	"BXpI\254\005Q\005Y\021D\030\021\306\321\301\202aD\030B\031+\306\210-T\b_\020\277\\\b\301\212e\302`\324\311`\210\025\2052\310\310\212B\037\3632\337\206r\021W\340\314:\371\253\332\325\377q\313\261K\345\345\201g\215\374\260\273\230p\021\371\362\2665[\\oZ\267n\265m*\255$\235J\264j\220#\230AO\370\210a&h\255\216\232\243\304\202\240\023X\250?\214\b\232\013IV\377\257;j\017\036\225\357\206\325Y\007\272\252\261:\252\251\304\222\274Ps\034h,9#\\\025\307\323\2474e\273-\351\256\272\236=\315\252I\f\273'\253\276\252j\003mu\266So\206\252f8jE6\360\"\016\006\232\202\332\032\021`\242\016\212\250\200SM\325hS\252\247\f\031\033\324\005\245\272\201\332\220\002\204>\374\272"
+	.string	"\201\376\265\3053\240\t\0042^\305\005\200\301\250Q<e\231R3\"\"J\322\024$\215\001"
+	.ascii	"\003\221\221!y\021\3008\311 \"\021\241 \005IaY\003Q\207\316\301"
+	.ascii	"\035Jx\361\224\316\207'\2707\227^\"\337\375\304Q\356\321\374"
+	.ascii	"\350\277\223\367\266\322\207^B\026@\240\026\242\345\t\007D%\375"
+	.ascii	"\013\324\322mW#\266\fX\3767X\265{\025\220d\230\204\201\351!L"
+	.ascii	"\004\315\240\321\365\013\245\031^\357cV\222Z\243A\300\2048p\016"
+	.ascii	"\017Zh\206iK\233/\206NH\335\227.P\272\033\310`)9\372\374\370"
+	.ascii	"\340\035\222\006kAb\231D\345\222\177J\372\246{_\024Xm\377\314"
+	.ascii	"n\202\377\324\322:\022\305\207Q\254\225\303\341\231y\223\240"
+	.ascii	"\200p\b\304\206\214f\331t\023vi\302\212\b\343\007\223G\354\023"
+	.ascii	"\307\224O\364\215\214\245\"\302J\035\036q\031t\270\252\3720!"
+	.ascii	"5\337\277Grm\232\224\376\355\240\216\036\032\373\3745\027\f/"
+	.ascii	"\234V\213\266\223\312\353\374\307\374\345q\336\321\265\274h\221"
+	.ascii	"6$\362\350\244\342\337\013\334Tk`y\302O\242\034(\261(\253\242"
+	.ascii	"S\003\223D\037eI\036'?H\246\271\376\230\203*?\365\324\020\030"
+	.ascii	"\377-Zq+\230}\354\032\304\371\255\306!\335\360p\306~I\377\227"
+	.ascii	"\220\361\rh\267\036l\007\275\313tbO\005"
+	.text
+	.section	.gnu.lto_pidInit.79.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`v\002%\025"
+	.string	"\266\350\215J\260\324Q:\330\221\277\250\r?B\032\033\345\031z\363](/\270\325\315\311\234V\276\334\376U^\021\311&\315l\247\301\364\373\332\325F\325g\377lNY\034m6\343\217u\033A\325R\270\004\031\021f\013\004N\355\211\354&{\247\024q"
+	.string	"q"
+	.string	"|"
+	.string	"EP\277\252W[ _S\306'\351\354\327\353\217\344\027\312\212\230m\307\026\354^\356\220\013\203D(%D\265[*xu\004\243\234\210}\332\377\375hw\340\210\233\354\022\t\211\273\345\212\023\220\257./\200\365J>"
+	.ascii	"\353\325;{\352\245\213}0\305\217R\325\356\302h\213\357>w\376"
+	.ascii	"\221\336\362\001\361|\222@\330]O\037\220\211\233\336\266\212"
+	.ascii	"m\031{N\005\263\210_\323\016q3\357#\351\203\206z\224\307\263"
+	.ascii	"(#jg\021\273\354M\312\302\376\270\273kJd\223\323%\007\376.r\272"
+	.ascii	"\365\362&I\246k\235\036\3534eM\317:}\223\223b\220\027 \273$\256"
+	.ascii	"\214,T-\276x\371\333\367\223\036\264_\326\275\206\317\304aX\265"
+	.ascii	"\273\257\3352\355h\024$\376\252\016\224\210\215\363K\276\215"
+	.ascii	"+\351~Cg,\027\350(\002\367Q!dh\375\340\352\312G\317.O\245EK\350"
+	.ascii	"\370c\244-\372'\037*\236\220F\224\277\343O:\276\221abbX\257\003"
+	.ascii	"\244\204\036\274Kxt\246wp*\255\210\214\364K\224\236\216t\305"
+	.ascii	"'F\217R\372\237#2/\356\220\273=.>\361:<|\230\231a\275N\352@\312"
+	.ascii	"\246\371P\207\334]\027\037\307s\310|\243W\323j\363\276\032\353"
+	.ascii	"\365\024A\021\2207\257<\2133H\372\362)\274\264\033[\016\356v"
+	.ascii	"\2530\263\341^3\033\332\204\034\316\313-\247\253\275L\323\"k"
+	.ascii	" ka0c\001@\263\261\325\334r\030f6\234\3132\226\231\r\007\313"
+	.ascii	"\001Q\263\331\324\300D\330hn`\262\034\016\214\205\200o8Z\016"
+	.ascii	"\226s\273\345`\257\222\367q)\22158A\361h\317\006f\245\266\204"
+	.ascii	"\027\222\326\023\"\005`\201\351\242\366\205\f\363>\247\364P\036"
+	.ascii	"\237\374\374\245\037\3510AD+\252\022\352\363x\0177m\360\320C"
+	.ascii	"%\337\220\246, p\002\221\251d\007Q/p>\264\274\214\241OB5\227"
+	.ascii	"\373\013[T\300\f\033\023\227\013n\232~X\331\275\034\24776\313"
+	.ascii	"M\242l!\337U6'K\030\272#QH\223n\345F\363\0279\214\b\265-\032"
+	.ascii	"u\243!#\320\316\366]\340g\t2\272\t\0317\236w`\217a3\310F\344"
+	.ascii	"\212\3219\351\024\257\304D\001\275\274h\037\031"
+	.text
+	.section	.gnu.lto_calcHorizonLevelStrength.80.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`\306\004\355\035"
+	.string	"f\365\274I\260\226Uc\024lc\275\251<\3445\016\236\354A;\n=\244\r\205\343B\302j2\214\347\025\b\\<@\210\266M\0324\221R\313\346\250\375\303\373\330\2723\207?Cv\275\377\030\024'K\036\277F\227%-\331{\357-eJ\001\247"
+	.string	"\241"
+	.string	"\243"
+	.string	"7o\353|\241]/)5o\3621\365!*"
+	.ascii	"T\025\214r\357ep\323\n\322\233\376\216\363\320\331\307\322\t"
+	.ascii	"F\020%\316\b\202\272r\357\205\311\234\300y\263|\314y\323\276"
+	.ascii	"\270\356-V\212\236fi\253\316Gm\204\237y\242\342=)\376|\336\372"
+	.ascii	"Q\021T\204\205EQ\322YI\242\0235\210\222jZ.H1U\342I\"\244\222"
+	.ascii	"\200\223\026Pn\344U\364\350g\353wt3\300\017\250\224\271\367~"
+	.ascii	"\370S\313\357\222n\313\0049\262\034\t\360\343\225\257\250"
+	.string	"\037\031\027\276\n\375z\265\2426\367^W\337\257\350v\335\366\r\333=\273\324\005H%G\333u\346M\207\240\264\253Z\\\221I\222\267j\261\235x\325\002\355\227\327\272\260m5\214\255~\261\325\351\233n\324V\237\266\332\264\325\245\255\266\266\272\332\352\307\264\226\266PQ`r/\211\253-\267\211\211\244\361\246\337\276\337\343F\333\345\236?\371?^\274\020Vo\n\307\275\327%\025\344\204T\020\004?\277D CD /`\210\364f\024\224\2172=\247\033\254)\"\341q\005\001\257\306\326G\365\034\352\006c\240\220\202\212\034\3344\206\364\346\213K\215\357\344\017_]|\200\020\212\261T\341=zlW9R\013\364\215\216\363\305~\370\324J\325R\320\321\204\261\251\025\262m\336\370V\321F\362B~\023E\246! \225K\021O\373\250\313\230\326\307\273\366\356\335\315\234\266\204\002bJmiM{\240\032\274z\225\244\264\177\212\001"
+	.ascii	")%\265\367\361\013%\332\340\305\266\352\tc\321\033\267\025\222"
+	.ascii	"\021\f\323\002\355\200$Z\033X{\242\225\301m\034\207z_\265\267"
+	.ascii	"\241\324\263>\376\360\027\201\244\272\021&\031CJ\013|\245b5\203"
+	.ascii	"h-\320f\030.\351\325,\366\211\034\351\243\037\264\007\033\353"
+	.ascii	"}6\2367o\017T!\355\352\225k3\035\332\254\364`\333\261\236\321"
+	.ascii	"\340f9\234\032\214\307V\253\331b\257\\\r\307\342l\026rd\271\230"
+	.ascii	"lG\203lB\016g\253\t0\316\203X\204\330\003\b94/\263\234"
+	.string	"\016\217\354\226\273\331\221u\220U\340\261}\240\335l\263\001\216\321\344\3206\300r3\035\332\216\006\030\017\r\247\006\213\335p0\032\003\266m\220\335`9\233\355\006s\331\266\323\356\345\265.|c\205u\332\033\317R*2d\n\215\364S\257\031\031\355\217G\255\220\225\240\264\263<_\370\026\262\njm\244\210\377\360\255\025G\027K\224]\013@Q\230t\224\317\n\005\313\002M\333a8\365\021>\034C\300)\"\214\214\004]\250aP\006\r\"D2\"\223\024\244\311p\240\202\231\251\252:\021\200-efa\n5:\260f?\361B\365\"I\r'!~=\222\364$\333\250\265N\225\\>$#\213\315\362\024\356\300 \304D;\037\256'{\321\034!\241V\001\3024\b\262\306e\225\265\r0Zq\231[?\301`\322\370\023\375\217bA\036\250kb$M\340\002\223e\027H\013U\212\227vZ\031\336\033>\205\247\367\243\326"
+	.ascii	"#\310_Z\215\356\256\310\233\366\200Q,Orn\253?+\311\001\277\336"
+	.ascii	"\317\342bMD\177\335\267\245\313\244\263\212\036Ya\355\"\375*"
+	.ascii	"\266\315\200\321\350\222\237\214S\013\310\225\352\262S\016\306"
+	.ascii	"\330\240J\211B,\366*E\360\254\006"
+	.text
+	.section	.gnu.lto_pidLevel.81.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`\032\007\r+"
+	.string	"\332N(\021F`\232N:\017\374\026Z2\303\326su\022>\257\265\275\307\202\356\bU\332\036~\377\350\033\nT\264\271:f\273\357\360\216\013'\312_b\036\215\247\220w\303\346g'\324TV\323\026\313#\232\274Nw\267F\b\221;\311\001\001\347"
+	.string	"\002\0013\350\346\214d\267\301X\307-\265{\006\341-\214\2225\004\264\220\251}\234\325\253\334\263\237\2650.\3005W\371\352pV\314\305\253\226\031\213?\345o\\4\246\271q\034\264\257\tS\n\222\271\355J\230EC(jF\345\357\336\233\340*?\031\205 S6\216Kyn\227\226\336\207\036\310\216\322\""
+	.ascii	"\317\335\202\242\304\202\360\252\021\fi-\363\325\356\004\353"
+	.ascii	"O^\274\347^\037~r\367\252)`\bjBc\027\362\366L\370\216\207\367"
+	.ascii	"\362"
+	.string	"H\223\273\367*\340$\341Uf\346\247]\t\026s\\\252Vv\026\234\262\204km\315\2757y|\320z5\375\317z\265\201\034\353\301UM\333b\361\377\366\024\t\234\232\350W\326\203`_\301\256\246A^A\242:_\320\024\301\337\\\232\277\301\260)\361\313\306;E\240#\213\r\235/\2554\210K\2171\307\273\355\372\332\2626(\341\336\3136\372U\343,<3\257`\346!\314\353\227\335D}=(\021-\033\310;v@3;)\355\243i\377nl\253\263\330v\367\272\006\375{\333>W\034f\250\353-\205\367n-\361\263dH!<{\261^}\027\3651y\332@\266t\201{\327\272aV\323\262M\306\374\364\266\017\346\241\345\003HGg\373\r<\357l\364\266\363\361Q~\002\251\345\242\273\235\211\316\344\037\360'\277\361l\347\241\324\262Pj9(\265\f\224Z\376I-\373\f-\367\244\226yR\313;\267\254s\313"
+	.string	"\204\226sn\271(\264LL-\017oYx\313\301\324\362\032\264\254\246\226\323\324r\337\262\rZ~\322\177\004\256\305\320@\346^\257\3007w\213J'\344y\177\333\357\366f\276\261\016\311W\270h\264\313\273\3522\303\362\034\307c.\262\325\251\360\345^w+m\307W\274\263\023\273\263#"
+	.string	"#\214n.\303\261:\2648B\354\260\213\272\213\237\264\036\350=(b\236\264\366\364\201f\313\025\3661\367\253\300?c\013\0300\254W{\232\310,\f\307\261\337\306\323E}l\013\007E\323\212;\225/E\306.G\b\fl\263u\357\323\300N\363\364\241Dtz\247\215z\320\277g\027[\247\203zP\264\234\006\320\247\341pa\356\335r\300\314\341a:\200\221\360\341R\312Z\254Ws\372p}t\304.\362\205\3631-9`\016q/\"\030\224\335{\227\366\336e\0043\211\022\366\321\022\353Ub/\231\321\211\025\365\335\356\350\370q\377\333\205h\304\320\330\374=\323\265\211\332\247\331B\317"
+	.string	"\210&\261sh\270\354\350&c\242\036\366\t(Z\266l\033>\336\211nF\366n\345\277\341\206\346\305gf\355\337\r\373t?>\343\204=\f\266\260\033\016\0240\330\352\035W\034\265\327\276\037\364\317\304\267\250})u`D}\267\037\237\326\r\247\035QN(*e\323\311$\245T\241\334@\305t\261l2\243\200\242\240\226Q\351\n\246Ts\224\222U\224\263i*I\305\234\232b:\031\235SM\255Nh2\233M%\321I\265dV9\225LOK\017N*e\263y\345\3443\265l\202PJAQ5\r\225RK\024\314\246\207\247e\025\221\233\02689pZ\320\340Ii\307j\311\242)e'\245\247eU\322\031\005\265\224B\221\244Z6M%\235\232VI\245"
+	.ascii	"\314\254R6\223N&\263\231,\252=\237\336\366\241\342`[\217\372"
+	.ascii	"e\304\342\250H=4\324\017\306\236\255\305\177;\261n\311PK\b\036"
+	.ascii	"\031h\241>\322a\324A-\324\002\374\216\r\324A}4Xi@\035\241/\247"
+	.ascii	".\211Q?\257@\223\t\366Q\243~\2221\255\316\342_\371e\324\035\331"
+	.ascii	"\273/k\363'\267\"\365\331~|\3764R7\037\224H\231\003r\034\005"
+	.ascii	"\256b\037\345*\353\325\237F\366\205\361\211\375\261\001\304\203"
+	.ascii	"\3415Dm2f\262\322>}\274\007\200\206\250!4\005\225BH\241\021\021"
+	.ascii	"\021\031I\222t\220\242\221\262\262\r\021\260\265u\243\244\335"
+	.ascii	"\356q),\213\374\357GP\364?Wm\027M\026l\365}\3542\350f\271\362"
+	.ascii	"\340$\232\260]\030\017\t<Rw`\334xn\323\260/E\224\327\373\305"
+	.ascii	"K\230\274)\016\013\001=_\f[Sb5\336\212z\202\206$\227\203W\210"
+	.ascii	",\331J\342\327\362P\231M\266\274\335\341K\361V\214DQp\003\"\202"
+	.ascii	"\336U\026\246\330\201\177\326T\037n\351:\n\240\340M\260\204P"
+	.ascii	"\213\267\361\021\036\320\034\312\\\0212\013/\237\220\356\376"
+	.ascii	"\363\214\2243\354N\201\337G\210et\002\256\263\301T\203od\252"
+	.ascii	"\206#\227\200\241\035?\022U\f\020\240^\327\355\372(\221z\247"
+	.ascii	"Pz\374Z\233m=5\253\321 \345Kd\227\244B\203\324$\030\262\372\202"
+	.ascii	"p\337\303p\016\005\200k\232\363x\264\231\333/:3<\221H\201H\363"
+	.ascii	"\243\313\230'7\020\023\270lK\f\037\002\212\n\224\342a\234Kp5"
+	.ascii	"\276\365\007"
+	.text
+	.section	.gnu.lto_pidController.83.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`\232\024\315b"
+	.ascii	"\372\242\300#M \320\312I\007J\377/\2067\333\231\370\261\370\367"
+	.ascii	"\237\254\321Q\005}n^\024GX\215\243.\362\247\311\273=L\267\217"
+	.ascii	"h,5\216m,\251h\377\210q\270}=X\036p\226\213\201\334Up\311\270"
+	.ascii	"x\303\221\356\377\331\177{\255\336\204H\231d3\002\343\0012\002"
+	.ascii	"7\363\317\375\207\213v\3174\247jg8\r\217\363\300%2\321i\316\211"
+	.ascii	"\323\003'O\033\034\022\020L\t\333\236.\302\243Mfo\226)\247\217"
+	.ascii	"\240\333\375\366n\226\270h\300\222kr\212|\315\236\357m\206it"
+	.ascii	"^\3224%\366\235\351\334\335\364\252*\277O\3152\257T\022\201\315"
+	.ascii	"\231\316\3018\323G\260\tM\025\312gS\344J\341]\222"
+	.string	"\346\212\243LmU{\030\366v\217\341y\227\341{nj\236\b\242\301\351\201\261\26599\203\007V\306\006F\260\f\357n\231ep?\342\246n\231H\344\240\0214V\251\332\273\260g2Y\241[<\241\230R\330\002\232\345\006OS\204x\264\251N\325\356_(r4I\344X <\312/\363\026~f\211K\203sI\200\224\231\001\223\"+J\313\312\222m9\204G\231\316\252\316\302\345\214'\003&\024S*%\331>\020L\3234\305\321m@xT\352\\\202S\305q\0340\025\245drR\026\020\036]ZSu\336\275\n\2073^\214\221{HS+2\300\220\246q+vJxt\343\236T\217\n\177T\217\256q\227\316\343\324\322\237\351\203\244\f\2364M\251\272\204m\356\237q\337'6\036\352\351\203S\023\323\222R\022\322\221\221\207\"\242!\241 \"\320P\370S\321\263\331\270?s\021\201\314$\023\261C\235Epg"
+	.ascii	"\3141~\272b\246\302?\204\271\323\2332\314\237\022\f71y\371\322"
+	.ascii	"\211\342O\351\345L\n<\201\225\264<)\313\221N*\275#K\376\247\314"
+	.ascii	"r\026\251\351\261\3637%\026>:Q\b\326\345\360?\245\2263i\211\226"
+	.ascii	"\344\003\331\330\350\313=\230\260\306Ej'\372\237RM\n\017\241"
+	.ascii	"]\350\024\2009\205\317\377\224h\347P[\233\261(\034\004\345\304"
+	.ascii	"siO\315\214\2114=0\177S\216\300@PB\274)E\340\341\223\013C\374"
+	.ascii	"\374XQ1[\276\236Nhl@\030b\202\344$\341\246J\rD&HF\227n\216\360"
+	.ascii	"\371\247|rJ\355\235\313\230\220q\237y\224mi\207\212\231\n\347"
+	.ascii	"\037\2534M\227\223L\314\276Q\337e\020\273Kf\327\210-~i\232\242"
+	.ascii	"\235\266X}v\224\034\033 \215\325\225\017\211\347x\267\346\017"
+	.ascii	"H\337\357G[5\220\266\373\351\3113\343G\277\205\243<7\007\272"
+	.ascii	"\303\373K\333\374K\232\334\275\351\233\352\263\271\324P\336\227"
+	.ascii	"\307\245iz2w\227G\234\335%\027H\306z\332\236\3032\205i\232\032"
+	.ascii	"\260\307\341w\256\366X\216n"
+	.string	"\r\0336z\251i\027\224\327\305\252\257f\211\247zW\307\016~\322\252\377d\nY\213\355\367~\017\362\266t\232\246b\275)\\L9\363'\027*n.\372d\272]4\247A\342\320\357\356#\337\366u.\270\314=\226\205`\351\370\311\245\253G\271\007X[\036yp[\3642\277L\226\246\307\021\3573\r\262m\214\007\227\363Fh\3217s\304\273\021H\300O\266\3507\341<'\007\364\347.u\344=[\304\273XY\374\344\001\315\301\224\261\026[%3\316c\362\227\362\236\335\2701\356\264\335?m+\273\357\373jU\336\254\312;A\345\305\272\337\027H\345\375\341\243\007\217\277\371\3568\340W\307\341|s\340\250\2747j\\\321\230!\343x\337\030\327\373\302x\361\270\177\201\213\371\025\260\022\362\"p2_\0277\363m\361\271\357\001\225w\305\233_\025\257\373\246\370\335\027\305\211\253\371\2328\335wJ\210\267D\345%Qy\001"
+	.ascii	"\342\0351\344\025\001\304\033b\310+\025\304\013\202\310\033U"
+	.ascii	"y\241*\357S\345\375Py\235*oS\345e\252\274K\225W\251\362"
+	.string	"&U^\244\312{D\3445\252\274\036*oQ\345%\252\274C\225W\250\362\006U^b\345\005\002\342\035\016y\205\225\367\247\362V!/Zy\317\312\333\225\227+\357)p\262scc0M\227\f\356\220\372\241v'\334\357\357\373\337\374\200?\234\277\371\327\375w?\336\257\367\253\371\351~2\017r|d\254\307\t\257\031\317\204iJF\300\262Z\330\016\306'B,F\352Q\243\206j\212\341\253\321o^\031a\351jtRsy\f\374\225\350\255\371KymM\231:F\036\370\b[Y\246R\225(}'iC\212F\321\036\372\274\203D\033\203\363\220\345\013\035\242\2536\362E\314\020\215N\241\327%E\277\256h\257\232\204eBM!\261\266\224r%u,\352\253f>$\032Q\017u\021\232\224\245#\352\026kK\027-\324C]\313 \337\202\232\330B\fe\231$,]P\257h.\217@M\354\346#\3022\205O\252"
+	.ascii	"\365\323\232\335\220^\224(^\324\360\020u\332\236K\227>B3\332"
+	.ascii	"H\227\276 \031\215\002\254E\027\345\330\350=\241\321\257{\002"
+	.ascii	"!"
+	.string	",\263D\034'i4\232H\357\fE\377nh\206\n\226\321\303^a\317h\251#-\266\313f\334d\347\254\031\331\330\352\321a\017\227\307%\2544f1\236`ts\253G\205\255\244$o0\317\n\0303\241sh\002h\215\213\022\342\213\336\023\310D\237\350\262%\373T\027\345\232y|d\364\357.u\374i\031}>\310\267\030]\373\247\3172\3107\376\200=\270\332b\243\366S\323\356\270'F\037\357R\307\023\035\243y\016\262m\354\016\214\276\336#\230\302\311e\262\210\263F.\234\344\252\204Z\232\246\004\034]F\302\035\030\273\354\261|1\2061\206\251Ga\264R\323N\357D\320\213\020l\242\027h\005\3328F\001~\362E\337\311\024$-\266Cyux\354 \265\020;m\371\213W\247\272\265`\031<\320\332\026:\241V\263\333\026\264\266j\023]\366\251\212@\177\357B\033\344\002\373S\025m\004z\031\311\222S\026c"
+	.string	"\206\f\031\365(\332T\3151&\372j\206\235\266\374\223\325w\363+I\213B\247N\320{\236V\255\325e\253\306\257\357i!|\361;\336\335\340\327g\231Jq\370D\255A9\362\240\235?\255\266:\n\317\376\321Y}d\333\224\226$\332\317\217>{\202>\022m\214\007\r\250\273\363W\201\364\320\025\271\276\240;\276\r\ft\201i\235/\212\214\365%dK\013}\201~uqy\021\371\332\322\241\305u\303\310\253\b\026D\270\365\205\225\243\350U,n\ro\240C\212[\016\314@1\340\322"
+	.string	"\353\004\373\342\312\362\022\262\365\300W\327V\261\230A\026Q\321\353+\013+\006\026\221\257\341V\220.\254\034\032p\325(z}y\r\021\342\272\352\002\323B\207p\025\035\330\022\022\244\013k\270X\002d\031\220%@\001Z,\210\266\204pQ\340U\274\241\305E\004h\263Xhq\021\241\372\252 \b\227\020\n\250\272\270\260\206Pe\0251\240b\301\264^D\266\212T_^^E*b\334\361O\333\312\231\013\367\356\374\216=\006\325i+d\302\007\037\335\201\234\342S]\266\342S\315\300\031\225\224\356|\362\321\247\373T\373\350\237K\bn\374\241\323\326,\223j\257"
+	.string	"5<R\234\276UKtQ.0\217\365\266\346\204\325\t\253S\217\226\350\241\346ro\314_\332D\"\206;\300\244\r=\032\200&\321("
+	.ascii	"hcQz\360\350\021\275\"\272G\035\fv\302\362\214\240\273A\304"
+	.ascii	"\031\217\376\233\035\035\242W\252y\274\260s\\`4aw\302t\b\313"
+	.ascii	"\023\226\247\036\r\321C\2739c\226\260=F7\251Vj.\367\234\324:"
+	.ascii	"*)\357i&\020f\302\370\270\210C\206\313\204\r\212\031\307\306"
+	.ascii	"\352\321'm\330\321 \232\t\020\331W\300\331\340\001\241\314qY"
+	.ascii	"\372\002\327'\tG?\013\\\237Q\215V\321e\304\033\217\324\250\376"
+	.ascii	"\025\271&\307\361\n\306#H\214I\222\324\243Q\035\265\266<\236"
+	.ascii	"\r\356\350\277\201\352\035\315|:\372\251\241\372\004\024\003"
+	.ascii	"we,\263\361\324QM>a\226\tB\rL\211\3462\217\216>\340\207vj\035"
+	.ascii	"{^>\364\311\254-\233:G;\3659\007\331\226\002\243\300\\\214\037"
+	.ascii	"\\`\\\262\244\036m\352\026:\344\350\303a\352\034\335i\220m*\372"
+	.ascii	"D3\365\311\207|\033\273AE\277\251t\344B\017\322\215^\201"
+	.string	"cE\343h\276s&-\265R\337\350(>nK\375\032\224\272\216\371\306\215\275\t\351\227\"1\223\232H\214\034\033\244>\352\244~\026&HM\300\332r\211\233\034u\021$\2756\373'E\f\337\321\233\033\317\252Q\237J\201\300\250AD\005\225B\206DDDD\222$I\007Q\005\304\030\306\2504;\021\0209\310\234\032R\220$\035/\360\3225\312\370'rjT\367\005\235g\207l\275\227\036\263\352X\302\276\302\321F\225\253\2362\f\020ZFBs\352\322\340Q\215\2028\223\002\246\250\n\273\3440\251e\f\\s\022q\036\221\241\214\204?\321\030'L\372\217X\212g\200+\021\n\301\026(\376\350m\240\262&%\276\320\243Md\206)\367r\016=#-w\233\246R\222\321\261f\324A\021\022\344\004\222+\247\363J\2511:\350\217T\270\037\f[\005\\\0349\211@\305x-.C\272\272\364\177\262\344\350\313\306XO"
+	.string	"\2438\004\007\"\020fY\337\321\225\2655A\312\233\242\362\372l\231\233\324\306\377\2523/\3477\363\007TA2G\326Vl\b\257g\205\210\216\034\344\210\211Q\311:\241\212\220%\361w<\265\022Mq\255\223\201\257M\223L3c\2333{\245\214\034\027\2163\221\">\322x\376\302n\310R\373*\377"
+	.string	"@\210\302\205\272\017v\3046\206\306\260\230~\220WHgI\232\354"
+	.string	"W\326E\226w=\252^\220_\3569\360\340t\243r\222\261Dz\335\303\312\236\213Y2^\301p\024\204\243\322\205\242%\314\026\b\270\236]y\r\302\312!\315\001\331\363\345$\006\376\345A\260\036z\217\274\233~}\331|\274\200\202\310/\274\365\251hO\306AQ\035\255\363\n\231\214P\026\251=\022\"\202[p\32395RM\336\236\312\232\267 \013"
+	.string	"\323\346\322wr\356U\235\350\330z|\312i}\204$\0378\2668\221\203\307+\364SG\226\256"
+	.string	"\260gcN\031\274\371\374\363\360;\211H\264?\351=\3146\330\203\024\001x\216|\306\343\276A\217\274\255\224\004\223g\002)\231\210lV\016@\302-c\023\364t\262\335\347\\e\355-\303\310\n\3677\273v\307Y\351'/\013\030\210W14~\346\374"
+	.string	"\355\207\367\306\3220k/q\f=\244\316\204~bX\021Y\260\214\020m\261:\276\021\333\262\037w\353{H]lhX\030mI\305\002\013-;B\222\236\346R\327\032\t]\035!\307\312!\247\305W\251/T7S\033\234\245\335\033!d`\235X\305\021\355\332\300\362:\201\177D\372\240\344\027MM\241\026&\264j\345\311x\032\300y\3309\201]\375\356\217\372\2706a\256P\371\223\007\313\271\225F#\002\241\205\303\361\030U\204"
+	.string	"\003"
+	.string	"\002{"
+	.string	" i\240\273D\252\306T\306\200\274Z\356$\225\013\252=\274\f\263\373i#\207p^\f\025tN#Q\215 \374\243\023\276\361\336_\035b(\332\261\367\240-\210\211H\234/b\232\017QeW0\203\353H.R\262\231\016\005\2118\331x\261\370V\033\236\223I\n\262\306\2473\023U\006\234l\376h8J\276HTp\366\347\264\214](yK\271\020\347\361\024\324\245\214#;\310"
+	.ascii	"(\251\350\007\304\376\3357\354\260\r\006%i\333\350-n\3062\216"
+	.ascii	"\016^\342\246\3318\315\217\2115`\203\322\t\205<k\036\211\030"
+	.ascii	"\322I\324\0376\366=\3466\334\260^\363\270\016\314\302\372\\\324"
+	.ascii	"\256e%\3246\253z\376\311{y\207\256\250\316c\b\324\307d i"
+	.text
+	.section	.gnu.lto__reset_template_82.7.85.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`0"
+	.string	"-\007"
+	.string	"4\013\002\001"
+	.string	""
+	.string	"\""
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317\202\200\200\204\b"
+	.string	""
+	.string	"\200\240\001\006\035\001\344\024\002\200'\001\336\0027\001\376\377\377?\240\263\346\314#\202\200\200\004\2002\005\001\006'\001\240'\001\204'\006''\002\002\177\005\001'\r\030\002\177?\202\210\200\350\002}{\315\001y\314\001w\313\001u\302\001s\312\001q\311\001o\310\001m\307\001k\306\001i\305\001g\304\001e\303\001c\302\001a\301\001_\301\001]\300\001[\277\001Y\276\001W\275\001U\274\001S\273\001"
+	.string	"\n\024\026\024"
+	.string	""
+	.string	"5Sd"
+	.string	"K\n(2-"
+	.string	""
+	.string	"\016!2"
+	.string	"7\n,:F2\017\"\0312(7\025"
+	.ascii	")\341\007;\\\302\330\025\346\210`\027\bk\303>h\031\013GUx\220"
+	.ascii	"\"\307\3241\320\022`\006\266\030\225\257\312\220\234\001\343"
+	.ascii	"\222\263X>\200\""
+	.text
+	.section	.gnu.lto_.symbol_nodes.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`\025\005\265\025"
+	.string	"\026c\201H\220\332M:\202\210\221\002^@v,\307\306\221\276\334\330\314i\006\357\312\241\241\030\t\022\363v\342D@h\322\326v;\257\020\231\030\222\237\212\213\242(\212\026\225\343\317\0374kA\0244"
+	.string	"jF\202K\360\326\207\354&r\313\024h"
+	.string	"u"
+	.string	"l"
+	.ascii	"\017\216\205:\350[\331\372\253\377\2015I\375*\313\025w\204\324"
+	.ascii	"\317:Jpk\233\255(4j\243\242\005t\211\232h\210\207~'\204\200\006"
+	.ascii	"\365\320\254W@\0354\033\334\t\375y\023\237\233\321\377:\344\323"
+	.ascii	"z\372S\030\374\t\255<^E\022\216}\257\311\377\226\025\347`\364"
+	.ascii	"\377\344\375\256\376\376\273z\354\326Z+O\013\315\3775\002\001"
+	.ascii	"g\222b\312I5E1\371\260\370\241?\016(\251(']\023\324\222\316F"
+	.ascii	"\317\267\334\261\004\264\342\246\342fR\274\f\212\223\241'\024"
+	.ascii	"\230\370\331\226\350S\231\337\221\030\351\177\235\021\377\"\242"
+	.ascii	"/e\206x\024\020\207\362\341\\\036\276\244\303\231P\016\337\332"
+	.ascii	"p \325p\255\232\241\3375s\036\304p,z\341?\013/\253\320\347\262"
+	.ascii	"\024\276eB\222\204\217)\365\263l\004\034\004$\032>5<\322\216"
+	.ascii	"%\362\200r\377\225\344\210\357Y\"\333\364\256%r\316\006\200\013"
+	.ascii	"d\355\372\322\240y\315\220\267w\024r-\b\334\233\375\240\362\335"
+	.ascii	"&\327\312\r\356~\031\251\362\272M\266)\227k\255;\333\271F\037"
+	.ascii	"\f\215~\230\031}12\372aO\375+1\372bN}2\030\375.\272\276\226\027"
+	.ascii	"}/M}"
+	.string	"\264\\\177\314V\027\375\257m\321C\037_\2533[\004l'\021\261\25532\324Q\355\303zW>\3100Gps\246\310\352\215\344\033\301}Y\020%c7\222\r\360\366h\322\246\254B\222o\200\007\222\274\300-\222s\273\\$\013(\221F\016 dg\344\2332qd\245\221\237z\273;\254\264\273\303[\025\024y\253p\"\353H\022\031\252\367\237\310\272r\377\333\001\031\202\023\031\247\334\r_\250\021`\030\017e\244(\245\312t\320\002\2511j\016\021p\030\217\024\221HDD$\220\t{g\261$X\267pG\035\2553\315#o4\364\026Z\247!\313w\326\364\\\310r$\317\230\361\340A\246,\257\367\334\337\363\270\377\353\331\371\237\203)\267\235\277\231\t\303\320\336\020\336\206\362i\376_,n\364X\255\324\n\370\353\013No\277\363\240U\240A&B\205\256=\243T^\\X\327\356\216KSS\030\361\273H\265\013U;"
+	.ascii	"x\bG>B\220\355\003\264\244xu\253@\007\250\203\366\004\022\025"
+	.ascii	"2\377M\340\2606\2048*\006\270\364\266h.\246\006"
+	.text
+	.section	.gnu.lto_.refs.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\035\013"
+	.string	"\366\232QA\020mJ\322\001\203\023P\241&UG\300w\033J\250\026"
+	.string	""
+	.string	""
+	.string	",\222\237\226\3741\232[@"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364j\371\264\251o0\261\255\353\3306\035\346:\272\336\266o\220\215E\264\330\332\226)="
+	.string	"B"
+	.string	"@"
+	.ascii	"_\007\271\037m\272H\223k2\271\006"
+	.string	"\323=/\3670]\022\0270:\2734@OK+=\322\025@\337bO\256\224<kZ\364p\362)\311\227\266\357D\326\264+\331k\331\231\307\346\375\222\b\375\002\366H\352\250\273\0168\342wC\224w#\324\253\301\311\253\001\352\315\360\362f\200\372*R\204|\b\344\243\030\301\375\"@<\231\374\217\257\257!\376\031:}\f\0038\371\035_\277\360\362\213\257\303\274\034\026\177\350\376\016\241\237\003\350\367 =\306\352_\333\247Z\335\323z\017\365\024\325\006>[b\217\\\337X\037Y]@{\020\252\276\207T\177\303\005\017T\277#>F\326c\223\036J\272\352\324AS\337\224\002#HV&\3103\226\260\274\026*\\\276\024\302\336\t\235\257\204\357\033a\363\205\200\371>8\320\313\361\3726(}\031\270z\027(p\375+BN\377\t\323o\"\354\227\350\372 \226?D\374?\300\017\r\004\001\323\202:S.0@\024\245\260\205"
+	.ascii	"\301\023\243hPx\342\200\005P\244"
+	.text
+	.section	.gnu.lto_.decls.3426a74754ec15b6,"e",@progbits
+	.string	"(\265/\375`\364@\365%\001\232\003zoT \fQ9\351l\032<\237\335\033\327/\376\300\235\317\337\022\377\\E\363\352\305M4\235\377j\236\2378\2672\377\337\034\276\027\330\311yd\344Wl:\241'\334\363\323\221\316T\255\200SNuzY\225"
+	.string	"\214~\236\343\347+l\024\361\237\341\252\252nK\310\336r\247\372\005\362\006\372\006]\276\322\3726\223\356%\335\344\315\244\225<D\007\377\241j&7g\251Z\005"
+	.string	"\254U"
+	.string	"'\027\"RS\320\373\363\005\376;\211\330\217\314\352\206\262\305\376FR\327\356\326]M\306\r\227^\337\237#\035\200\366\320L5\t\303"
+	.ascii	"Sia\0333R\244\236\231J\323\227\b\363,\347\274\301\302y!\002\243"
+	.ascii	"\357\357\034,\244\203T\264\036\322_1\032H\225\003\023\201N\235"
+	.ascii	"\346\220\306\321^\3003g/\276\260\234\363\006\017\036z\362\202"
+	.ascii	"\340@/\230\006\240\026\272\224\354 \363\243MX\013\355\243\242"
+	.ascii	"\365\217\356q\366\343GD\216N\317\356\235\211i\242\367\027\f\377"
+	.ascii	"\322\300\177\363x{\235\345\2343\370\314\220[s\243o\210\2437\017"
+	.ascii	"\264\311\026\036{}\377\356\342\362Y\013{s\245o\214\326\002J\005"
+	.ascii	"\345\\\304\255\271\243uT\264\346\342j\034\275U\345\300\356\023"
+	.ascii	"\265f\316\331\303\006\017wM\357\013\fz{\253g\324\256\237\214"
+	.ascii	"-eY\372\326+G\357\034\366\255KU\235\276\277K\374\352F\243-\254"
+	.ascii	"m\364\215\316\252h\255\365\267U\205{_\365\f\340\231s\327\225"
+	.ascii	"\260\326\352\032=\003(\305\314\313\022Vv\214\321\3139{\320\340"
+	.ascii	"\301\003\222\314\007\037\276\267y\370\326\016\367\262\261*\332"
+	.ascii	"\206\226\221\2035\017l\n\253\357\255\031L\202\234\353\006\264"
+	.ascii	"\366\365\325\r\350\255\034\276\375\202\321\206\321/D@\306\"\253"
+	.ascii	"o\273`R\345\2345\234H\366\342\334\365\275\265\202_\231ant`&\244"
+	.ascii	"Y\331\336\300\232g\376\212&M\213&\233\030\255.^\266\302\306\310"
+	.ascii	"\305h\232q\301\366%GX\316\314o\360W2\265\232\006\214\n\312St"
+	.ascii	"A\302\332\376\243\273;\315\262!nt/\23293\307\220\271\332\340"
+	.ascii	"?\302\253v@\233\263\224\23500q\277*_8\340\312X5sf\242\221S\327"
+	.ascii	"T\273*\247u\237\3645\327\376\312f\005\310_\341\324;\255\354\\"
+	.ascii	"\3474\213\372\246\251:\252\322\351\026\275\242\326\351\251\272"
+	.ascii	"W\343T;-\325UU\257\366U\276\212V\345\3246\257\315\352\346\227"
+	.ascii	"\2313\025\363\257c^\345\324\271\272\3052\3370\213)0\23293\311"
+	.ascii	"\376*\2452\253\234\232w7[\266\304PEG\244\231s~\035\373+\333\037"
+	.ascii	"\242\203*\247r\251i\226\031\226\247\350\260`\360#N\334\016\275"
+	.ascii	"\234\231\0364x\360\340\001w\241i\0261\272\267Z\370Zy\201o\225"
+	.ascii	"\370v\005\376k\235\232\332V\323R\310\231*\347\234!h\347c\215"
+	.ascii	"L\337\312\346\350\265\216\b]j1sZ\3169\350CEc\255H_\036+\205{"
+	.ascii	"\272\211\203*\021\372f-B\337t\370\r\207\337j\370\275\004\277"
+	.ascii	"\271"
+	.string	"\360[\006\266\240\022\241\357)\374\332\006\277\306\341\016kX\203'XD-B_\201\340\212\245f\251h\030T-\257W\252\333O)ff\346\314\f\266\020;jS\372\276v\341W\fP\333\327W1@_[\340\240Z\204v%B\377V\213\320\247X\203J\204^\256\026\241\037\342:\245\236U4\nj\225\207\350\3406\312,\217\345\314\f\002\335qr\207\257\357Q\300?\302W*G!\225;x\007\374J\001Z\373*\005\350/\3407\266\240\026\241\267\022\241gV\"\264\216Q`\2250\272rZ\316L\241 3\313\252G\3373k\021\212+\021\372\377M\375]\316_\321\377y\365\377\367\376z\377\363\375\265\017\247\326\3179\235\327\375\317\360\367\027\021vpm\201W1\326\023\r\342}\235A}\363\300\200\312\265G\201\232\304b\350\022\216\332\211\r\242\261E\275\306\203\006\364\210\036\341\257]>\237\300\177\243\300\354\205k\261D\365"
+	.string	"\277\035\372k\006\034\376:\301_s\330\240\277\332\261\347\365h\370\317\241\313\350\304\t\360\333\017\374\355\304\006\177\202\005\376\025\2105QYX\374\327\263\332\243\n\377\352e\177\307\340\025\374\367X\373\277\235\277\217\376\246\ny_\375}\316\357t\207\323\371-\372\0238\274"
+	.ascii	"\377\035\361\267\024{\376}A\017\340\177\235\277\331\354\375\273"
+	.ascii	"\202\277\003\360[k\373o,\266\376M\305\276\306_\365\376\356\353"
+	.ascii	";\177=\353\337_\376z\303\016\233\374\327:\177\217\341\373\257"
+	.ascii	"\327t\032\360W\256\336\373\017\347\257[]F\257\347\374-\347?\207"
+	.ascii	"\277F\035\203\377\006\370\177B[\260\327U9P\225V\350o\r\374m\342"
+	.ascii	"\177\377W\354\257]<\330\362\377\374-\220\277\276\265\331\034"
+	.ascii	"\177\r\261\301\357o\257:\016\tG\177;\325\364\r\244\360\236\337"
+	.ascii	"\216\370\033\216\017\336\361\337\\\356J\320vD\177\265\300_K\374"
+	.ascii	"\215\343\277\375\317\004\374\035\3657\325\337+\376\226\372\273"
+	.ascii	"\352oe\335\337\307\277\363\337$`\363\037\350?I\370{\315\337i"
+	.ascii	"\3766\363\367\334\337d\376\006\363w\226\277\255\374\215\3667"
+	.ascii	"\363\357\261\277\237\374\275\344\357\257\277s\374\035\343\357"
+	.ascii	"\026\177\243\360\267\005\376\256\300\337#\376\236\300\337%\374"
+	.ascii	"\375\301\337\f\370[\001\177'\340\357\016\376\336\340\357\243"
+	.ascii	"\277A\374\235\301\337\b\370\333\303\337\035\3766\300\337\027"
+	.ascii	"\374=\200\277-\370\033\377\365\316_\371\376\272\367W8\177\265"
+	.ascii	"\373+\233\277\252\371\353\334_\301\374\025\356\257\312\277v\371"
+	.ascii	"\353\226\277\276\375\265\355\257j\177\255\362\327\263\277N\371"
+	.ascii	"k\331_=\360\327(\177\205\362W'\177e\362W%\177\025\362W \177\375"
+	.ascii	"\361\327\241\277\242\360\327\023\177\355\361W\257\277v\375o\372"
+	.ascii	"\353\007\177\345\372\353\326_=\370k\210\377Z\376\232\301_s\374"
+	.ascii	"\265\347\2577\376\232\365\377\204\277F\375\265\351\257)\374\265"
+	.ascii	"\003\177%\341\377\211\277r\340\257\033\370+\006\376z\201\277"
+	.ascii	"\232\370\253\t\177\005\341\257\017\370\253\003\376*\342\257\033"
+	.ascii	"\374U\203\277\202\370\253\321_\003\360W\237\377c\377"
+	.string	"G\374\177\372\037\367\177\250\257\257\257\357\377m\371{\262\374 \036\020n\315\237\035x\2028\302[3-l\032\253\346\203\026\312\234g  \256i\325\374\366\214Ec\243,\02671\314\276\377\261\302\226Y\213P\021\225\b\275\317\036\306\240&\314\303\330\271\032\304\234\242\203\022\226\263V\207\2374\315\2734en\347\334~\224Rq\242\364\265b\254\\\360KmM\226\034\031,=\300\244l\376\251\223#/\215\035\323p\222x=\221\363I\2033L\t\377[0\007\323c\325,_qP\302\324\352\020\244\363\303k\257\357}\274\340\241/\302[\270W4\013gwXe\226\372\272\340\213\234\024,T&\274\355\202f\2734\223\312\314W?+&\363\303}Z\300\0240\263d\261[\034@EJ\023k-9\"\245\345v\013P\225\225\263#d\312\300\276\204\364\275\017\026\036\"\"\264W\252}{cA\305I\323'\343\273\325\246\312Y\212"
+	.ascii	"A\037Q\324\324\350K\201\02766\333\346%\354GDF\0225k\345\266\255"
+	.ascii	"\307\316\314X\365\254\301BZ\204\267j\025\315\252\265\230\006"
+	.ascii	"f\216\372\2711{\300`\n\360\320\320l\025.]\300\026\362\272H\351"
+	.ascii	"[\005\357\234KRd\255\357{\246`\2411\302\333\253\253\273]f\036"
+	.ascii	"\362s\223\023z\"\274\2352\245\323.\0253c\241mp\037\3164\"u\332"
+	.ascii	"\372\276\347\b\256\240\312J\261fV\212-\323\302\354QB\345"
+	.ascii	"F\237e\336\226]:)h\324\244\375\347A\307\\\325\241\323\367=[\230"
+	.ascii	"(\216\3606J\224\273\235'g8'oKL\304Fx\013\005\312\335J\310+\312"
+	.ascii	"D\330a\316\321\322\353\251\302\3007\341\255\0234\353\244n\271"
+	.ascii	"Rfy\331C$\312\310\226^\316p\037Z\311\223\263!}\317\323\005\007"
+	.ascii	"\331\204\267L*\232eb\267\256\224Y\216\032\001\030\255\0175\214"
+	.ascii	"\034\033WmxC\035\"'b\225t\3169\207\375\252\250Ei\332$\267Jj\331"
+	.ascii	"\025\032\312\276V\354\\\376\363\374\264a\311\241\325\327\"\261"
+	.ascii	"Uob\366\316\372\332\"\366\b\327^\215\271#\267a\226\355\256\005"
+	.ascii	"\016\"\314\r<b+\226\220Y#\375\245dF\230*\2363|!\013o\205\240"
+	.ascii	"Y!w\253K\f3\252\3305\3632\1778\017\022\f\200900\013\244\346\234"
+	.ascii	"\263V\216r\243\200\032a\313\016\377\343\334\002q\323\022\262"
+	.ascii	"\354{\236\033\270\002\035?n\1774\033\234\261\274Y\260\003\354"
+	.ascii	"N\337\363La\333CC\017y\303G\247\357\361\034l\275\200=`\340\271"
+	.ascii	"\365=n\342\277\242\335\315v\225\205\345\234\203~\330\300iK\353"
+	.ascii	"{\314\006[.\276;\027r\372\036\177a\372\274q\251\321\350ksl\350"
+	.ascii	"qc\323\302\232boX7u7\276\372\036\207Y-\016<\204\267S\267-\254"
+	.ascii	"\013\233\365\301\ne\226\022\263@L\330\034-\275\274\\~\250\221"
+	.ascii	"\304\t\331\223\276\307=\360+\023\006Y\230U\224\260\214e\227\226"
+	.ascii	"\206\235Q\321\254\f\033\303\312\332UZ\330\230\225a_\240i\232"
+	.ascii	"\350\231\226\033jz\3561\017|\\\003\037_\341c+|\354\002\377g\007"
+	.ascii	"O@\306R\335RY%\316qo\277\033_Y\350,\213[%\017\2218zAl\225\317"
+	.ascii	"\030\0342\324\330*\273\342TS#F\021\246\360.\212\227\276\377\341"
+	.ascii	"\341\377\310\340\337J\331\250\323.-j\253"
+	.string	"\257\315\301\274$VX\364\375\357\r\343]i\216\271\021\362v\3244\362\366fI\033\235\356\353\275\266\323wZ\257\353T\264\346k8\3578-\347wl\316\335\252\\Z\r#\273R\321\264\271\033\220'g8(o|\235w7 \0253\017\371\255y\343\203\323\3139\007\373\220d\311A\367\277#\270\312\325\"\224C%B\377\363\302\377\355\300\377m\341\377n\340\377\262\360\1773\360\177K\\\001\030auR{\356]\327v\375\242f\031K\023_A\232yI\343\303Q;\270\2023a\323\265\231\367\231\256;\323lpT\316Q\314|\245AI\236\243\245\227\265\264:\334\027.\222\030\351\333l\360~eW0\350\372>N\253\371\317\323\223W\346L\0325izf\254\241\302\245]\234@\370fX\251h\215\246\266af\r\026\f\021\2707}\217n\301\377\353\373G\263\3242\347,\343d\346\345\324\017\372\327\327\263\326\016?P\265u"
+	.ascii	"\377o\316\247`\0043G\331\r\3119W8X\314M*G\337\377\026\344Sn\251"
+	.ascii	"<\363\212\372\300\013\213\312\313\206\362\314\013KHy\346\225"
+	.ascii	"\243\250\212D\t-\263W\224\362,g!*\252(\021\272\260\224gRYHy\226"
+	.ascii	"\261\362\2129\254\232\231^Q\231\252+\013e\252,\225\317\272\260"
+	.ascii	",PRya)\317\244\260\204\224g^X\371\314+\007e*\251e\013\252\274"
+	.ascii	"\024\312g^n\362Y\027V\220\362\254\013Ky\346\265U\353\224o\364"
+	.ascii	"\260\322\f\371j\253n\224T9\206\325\226\3242HN\311\354\312jr\256"
+	.ascii	"iUy\231\345r\036@\316[]K5R6\352\333\224\\\214)+R]\225\231s\336"
+	.ascii	"`5\365\325\225\251\344\242j\226S&\351\3129\311\024S\266\3129"
+	.ascii	"g\016\242\230r\031H\225\213\352\261\225aT\345\f\200\314\314\331"
+	.ascii	"*\347\250\232\345r\316Q9\347\337r\213\2313\216 e\230\225U\316"
+	.ascii	"Z\032\254\362V\024\226\252\234;\215\315\033\226\362\354\253\353"
+	.ascii	"\b\013\332YXf\301\214\252J\030]9,\253\361Z\342\263\250\262\f"
+	.ascii	"#\347\\\337\3400\254\031y}\217\342\300\177\227i\271L\226\367"
+	.ascii	"\245\301\307J\307\335X\337\036\323mYg\232\364=*\325b~\315\272"
+	.ascii	"\200\254T\226\030\267\276\314\237\253+!]q`T\320\322\"\353\333"
+	.ascii	"`zF\005\316\240\322\004G\337\206;z\177i\200\220\036O\372Z/\033"
+	.ascii	"\230`\331\361\243\013\227\272\245\r\230;\\r\006\036*t\270lm\301"
+	.ascii	"\002\234!\266\246E\337o\340\226v\364\207\350\240\261\364\225"
+	.ascii	"\232\006"
+	.string	"\214b\346\253\337\227Z\216.z93\377w\226\326R\321\032K\277Uf\366\340A\003.\262$\214\034\364\376\224\203\177\232\301?\267\340\277\333\330\342\352\352\216\364=j\266\236\322bU.\355.\031c\245\327*Z\263\265\032[\237u\032\220\212\231\261~louy\032<Xe\231)G\320\373\023\tn*\215V\321:t\025\036*f>\313\231\031\344A\363FGZ\337\237@\360k\0074\330\327\327\327W;\240?q\340\237X\370o\263\262\256\250\036M\372\226\375\025M3\177\367\323\225\263\225\234s\006`\325X\224 }k\256E\350\337R~\327QeL\276\220E\351\262G\307E\337W\264\2162\026\254q\344\016\016(\357\261?D\007w\373\311y,\347\314\001H\211\230\267/}\373\311\357\376\363\004\303 \021K\323\367q\356\366\237\247*\271\342d\315\t\023(\001R\304\264~\364\375\205(\\tgfv\242U\263|\225"
+	.string	"9>\270&\265\314\017 `'\225\237hx>TS\240\240\351{\236\375\316|\225I\323\367\234R\323\372\006\263E\363\r.\212\"#;\231\032\304\344\352\362\3206&vLN)?\231P\2620m\364}\234\232\366\237\347\374\222c\347\326\367Df\360\005\036\347\3309v>\271\245\312\\Ex\312\220\341\205\351{\242-\370\002\223\263\311\331\344|R\317\344A\2413\001&d\264N'?\237\254E\351\203#\n\2023\004\021\376?}\374\004\362W\264\323\307\271\304\322\375\344(\263|\365c{\362\244\213^Vju"
+	.string	"\276h\343\345#\354\347\222\237JBt\360;\343\0174\264\276g\222W o\320\224}\177\"9\305~\036\236#vV\356\364=\321\013|\036\311@\007\035\036uN#m\225E\211\216\276g\221\267\371\317\003d\245\fl\253\357\343\234D\376\363\3301_tS}\317 \247\220\212\366\270s\310\231A`\026\026jq}OD\205_\037\207\226\240>\016=[\370\t\366\363\360d\341\362\341\325\367Cu\360\177\376\370y~khr\204\365\375\320\034\374\241&\036bq\352\370\371u\3528[\240\250\342\0212\245l\346\345\326\207\340\235\255\260\270\276'\217\323\353\354:w\234\\Cb\360\220\225\260:\251\347\362'\216sy\346\350\240%%\205"
+	.ascii	"\261%v\253\223b\245/\223\311w\303\216\215\276\247\215\363\006"
+	.ascii	"\217\026\030t[}\177j\201\315\021Q\322\267\317\254\337\330\222"
+	.ascii	"J\255\357\317\032\326N\030--\372\376\244\361\237\247\004u<\234"
+	.ascii	"\364=g\340\252\241+\030\360\2601\273\023\322\367?\261~\316\370"
+	.ascii	"O\031\365\314\235K\001F\016\2556}\201\225\b\275b\216~b\265\221"
+	.ascii	"\264\270\270\276\037J\202\207h\b\177\276\250h\347\2133\306\007"
+	.ascii	"`A9\177\265x\313K\255\017?G\302\370\350\321g\214\377\204qZ\265"
+	.ascii	"\\w\211qm\351\013\354\252Eh5S\211\320\017m\341\241\026\342~\357"
+	.ascii	"\352\030;\247\242\335\270\263\305\321T\226\032b\201\230\\\255"
+	.ascii	"\341E\027\247\357\251\374\301 \362\242N\337\017]\341o\360\346"
+	.ascii	"\306Y\262\346\310\315m\303a"
+	.ascii	"JY\302X\035\336m\3325\245\316\025g\3259u\262\250h'\325\225s\r"
+	.ascii	"\314\223\352\346\325-U\016\354\20316M4'\325\235s\373\252\234"
+	.ascii	"VP\246\272\242\007\304\203\205\332\216\237\213\367;\016S\312"
+	.ascii	"\022"
+	.string	"\310\360\216\372\256\336\275S\345\264\230Y\206O[\236\221$g>\243*\332\355\323\300\3149m\003\020\337\032=2\364\376\367\216\235\2377\0279X\364\275u\360\316\342^\364\350{\2411\370\277t*\332\345\303\013\262@b\247H\337\273\367\273\026Q.^\364}\234[\003\013\0241}/\024\207/\304\005_(\355\302\301g\232:\306\364\275\220\031\276\020\031\276\220\023|\241#\370\277\315\333\346\f\f\2341mj\032\235\030\030S}/D\004\3375\267\356\332\375<\301'o?\330\372^\310\007\376e\363\237\347\204 d\330\372\336z.\350M\363\253\346\347\3518#aV}/\324\205\177\317\\4?\017PM\021\265\262\276\027\322\302\277f\376\363\234l}pn\364\275t\270J\310\005\006=:\256\354\310\021\346\227\356\277b\356\230;\027\202>;s\372^\271[\346w\356\222\311w\216\203\256\234\245\356\\\260N\316R\301Z\005P\253"
+	.string	"\356\223/#k\350\275\320\n|5\265\b\005\252Dh#9\372\r3\246KSJ\337\0075\361P\233\260:\251W\213\226\373\305*\263\224\027\007_\230[\037\3163\274%Yp?]K\262\232\314\213c\355\314Y_/\267K\333\026\260\326|\365\275\\\3202\034To}\0374w\267<\210\r\3279\302_,X\032\314=\251r\017\"a9k}\350!\223\342\245\255\357\203\250\340\236\022\376\272]\267\232v\243\314\362U\317\212\271\257%?{e{k\372>\210\007\316\360F\370k\245\354\2665\227\017\246\224Y\312\353"
+	.ascii	"Gr\320\025~\220\017\013Y\021\376\256\255\265\330\245b\346\250"
+	.ascii	"z'we\340\t9\323\367\301<\274\201N\370kv\253\334\264\026\253\271"
+	.ascii	"j9\00156\315`\031\274al\312\255r\247\\\264"
+	.string	"\316]k\232\227\312/\232\365\021\265\005\247\357=;\0276R\226\224\365\r\272\341\007\307p\206\267(\277Q.\023\347\r;\344\200kjSh\\)\277L ]\215;7\372^2[U\344I\226;G~p\261\365}\260\b\026\202#\374\205r\241X\037x*\347.\255\013\216,\265>\364 \351A\005L\337\007u\340 \034\302_'\327\211\375\272Tf9\352w\267\254\313\343A\263\243\r^\337\007\265\360\0040\2300Q\303\321\244b\326\365\245\357\203K|!K\370\253D\311T\216\267:\370\302\013\341\257\330\025\343j\301\256Y\207\211\324\204\277G\216\224HC\006\023m\021\376\032\271F\356v\203\362\013\026l\302\200Z0\021\031\341\253Y5cQ\245\216H\212\360w\310\220\2617L\244D\370\033$H\213U\241\234\245\210\274\265a\"!\302_\260\013\326b\350\222\204*\3005<A\330\375q\177Xe\025\274f\326\322\352\320"
+	.ascii	"\2735e}\017\034\303D]\302\337\036=~\207.yXP\211#\202\211j\b\177"
+	.ascii	"\275\256\027\030\240\r\314!K\370\353\302\266\270V\267\253\001"
+	.ascii	"b\272n\327\177_\\\030w\007\017\0304\320\372R]&>\322\230\351{"
+	.ascii	"qX\253\253\265\307\224q.^xXm\232K\275\346\345\2729\356\326\325"
+	.ascii	"qoT\264\213\343J\375\322\27056\2708\356\214s\251ri\" \271k\376"
+	.ascii	"dQ\262V\365s\377k\343W\353\2771\356\025U\023\034\312\267\276"
+	.ascii	"7\353\350\327\306\217\026-R_}?\247\022\241\001hV\"\364\300\027"
+	.ascii	"\370@}\370@{\370@mp\005\226\f~@\256E\350O\256\022\241\007j\303"
+	.ascii	"EH\2047_e\224\n\200\220\351rY\374*{\300\200xq\322\367F\335*\340"
+	.ascii	"\2217\245\332\255\272+p\330x\223\244/\025V\006\201\341\243\357"
+	.ascii	"\201\236\340;u\245z\300l\b\221\353{\240\0260\320\022sx!\274\265"
+	.ascii	"s\307\252\251Y\306\362\2043k\200\246\360\177\340`\"\027\302["
+	.ascii	">\276/g0\207,\274\225\323\302\352\331=\013\304\344\275\277\216"
+	.ascii	"\261sl\326\351\202\305\034\255\276\377\211\303\235k\021\372\037"
+	.ascii	"7\214\301\n\017\317\302a\322\344\203\323\003\336Y\023\227\337"
+	.ascii	"\334\302\351\241R\307\207]_\333\306\346\375\314\340\241\347\226"
+	.ascii	"\347\346\b\221\0306jt\034(xSM\033\243\357b\264\251\363\303\304"
+	.ascii	"C}\302[;;\273\003]\362\304\360\001\327\374\t\303Cp\204\267l^"
+	.ascii	"\321,\233.\353Y\362T\241\022g2J2\245C\247\024\306\342\020\231"
+	.ascii	"&\215\307\244\036(#1MA\020AH\"%.m8\223\021\222\310B\321\t\004"
+	.ascii	"q\3118,\301Bq\004\362\230\036G\244\304\245 b:,\221\022\227\202"
+	.ascii	"JM\307\022|,\220\022I\b\246E\2430h\004\022&\244E\2430-\032\205"
+	.ascii	"\027\322\242Q\bDL\016\211M\304\022\310\244\360\210T\261\004\f"
+	.ascii	"\236\311(\t\211\224\224\002DR\n\fI\024 4\245 \212\220T\"%.\r"
+	.ascii	"\235\311h\311XD\246I\020D%\250\246$c\021\0042\t\005\002CS\023"
+	.ascii	"\224\321x4\376R$b\b\212It\205#\222)=\032\177)\206\304\246\253"
+	.ascii	"\342)\311\211\350\204\016}\230\016\225Rb\022xb\203\212!\022\t"
+	.ascii	"B\206\364\t\352\210\\BB\022S\242\323\0209|\002qA\222\021\312"
+	.ascii	"\307"
+	.string	"\230\242\317$\322\322\323O\212d\\z:\215KO\226\030\202b\362&\223D\244\222\322\360\207L\237\254\022\321\270Tl\032\376\224\210I\250k<\026\323$b\362w$\322\322\223\021\020r\310\224tU \323dq\211X\002\351B\212\204DlZ2\016\201\236\206#X *\031\205\307\023\311a\261\t\204$$\206\363LFKP(\210J \224\232\212P(6\020\225\216#\226\240P\020\225x\204\216\214\210\351\260\004Q\n\021\204$\222E\026\206XH\003\243!$\261\251\351\210L\201\234\210iR\205\211\240#R\305\322\375\251`\024\022\235\020\006\251H\213I\307&\"\006X\030:\371 \217i\322p\004\026\206MD\244\217\022\005\272H\201~\242@\003\2550D\301\tIL\237\212\224\210MM\305\024>\251\021\352\030\202\017\013D%c\361t\2022\261d,\252pt\342\tn`\264d,*\t\245I\244!b:Tz\272"
+	.string	"1Y<\032\211\" \213)0\374p`\224\342\311\004 O\007F\306\021R<\231\020\f\362\300\210H\250\251\t\312\030\034\201))=\236\220A\211\330\204bh\224@Q\220\020C\n\341\021\251\202\204$\324\261\250\002\021\371\004<\"U\220\200<\"\221\022P*>aP*\222\020:\221\022M(\025\237.\030\213C\022|\214\305!\t<g2JB\":\025S#\024\022DR\212"
+	.string	"$\227\206M#\020\225\216#\202X\251\370\204\215\307!\362\004\223\020S\272d$\"S\023\214\307\020\024\221\307\022\222\232\206I\032\222H\306\021Rb\222Xb\351\251(M\207\307\246\024'2%a\034AE\323\323\023\bA)R\022Il\202\222"
+	.ascii	"Q\t*-\246\351\260\210\210D|Rqb(=\241\324I$\037b:L\223\347\007"
+	.ascii	"j\b%\372'\231\026\215B\245\342\0230\204\321\nC\024\216\322'`"
+	.ascii	"z&#\020\306\243\223\3231i\202\020J\235\034Ai\b\005\202\"\n\240"
+	.ascii	"\006(\372\bE\207@\321G\303\0161\354#\245\036z\222\221R\361\211"
+	.ascii	"D\360IE$\321H\\\302\347\300\203\f<\020\301\302\357\"\026\240"
+	.ascii	"\301\0024@/b\001GG"
+	.string	"\013\360\340\b\337\203#\233"
+	.string	"\243\020\"\220\210\351\260\351\311\211\230\"\245\304$\021\211t\201\210DL\207\251\211bS\021\30505\241T|\312\220DZ*\2460\036CP*>\3718\035\215D%\244d\222\230tD>!)\025\237\204\220\311\"\222\261\210\304dtD\252X\002@\022\351\210T\261\204\246H!6 :\025\323\247\343\321\204\224\270\204\034\246\300\024!\210"
+	.ascii	"\302\021\251b\t7\035\217\021@:\323\024D%\2444\303\231\214\214"
+	.ascii	"\307\342\020D\022yL\032\211\311\001$\241\220\222NE\344\t\246"
+	.ascii	"\244\264HB\311\bBS\323\021I\264\302\020i\317d\004\345T"
+	.string	"lj:\"/SRZ|:\177+\fU\330$\021\252i\250\002\232\236I\303\217OD$\210\364xD\202\360A\002\223H\304\246b\212#\222\204R\361\351G\004\211\026!l\021\"4\361IE\212\204$\246M\305\024B?!`BJ\361\324\204\264\302PEO\b\230\200)R\034S\250$$\246\244\364hD\032J\215\304$$\221Dj,\036I<A)\031\213\031\310\340\263\302\020\005'(\023J\305'`j\204:&!\021\227\206H\242\nC$\343\261\230\016\223F\342\223\3231\004\245\"\211t\210B\005\"cqD\n\202R\361)\210\330\264d\004!\250\"-\252PL\213I#\321D\023Q\005bSP\212\344\301Qj,Ba\245\246#S\222\210d:AlJ\323#\222\351\004\006cqH\002\362\230\016\221D'$1-^8\026\323a\t\026\206M\304\022\311\241\024IDj,B\375><J\022\221t\224"
+	.ascii	"%\243\340\025\240\200\020,\270\300\t$\340$#\245\342\023\210\224"
+	.ascii	"i\251\330\224\002\204\261"
+	.string	"8t\002\221\204L\2020\312\2202-\025\211\031H\215\305\343SJ4\341\204$\246JDi\321\251hB\0231)\t\004b:,\261\302P\205\320\177\324\206U\002\304\367\365\225\321\2544\327\205[\332\034\264\206\005\002D\226\246\025\006\245Q\267\330X\301\307\326\027\225q\303Ley\3217\007\201t\350\256\346`\331-\017z?\314\320\345\371\004\217\353\210\231\276\025\314A]\240W\250\0134F].\3638\320\"U\327\324\313Z4:\374\250\325\321\030nx\311\224;,}Q\030w;\313|`\231\353\213\276\270[\360J\231\032!ED\360\217\266\260\312\346\202CG\017U~] -J\227\276\035&\005\035au\270\320*&P\017\314\231\026+N+w\314M\024.(\325\355\262L;5U\350\324U\376\334\251\261{\201J\235Y.\332\\\225\0234\n\355\232\345=\201C\363\0360J\235\222\254\017N\320\n\217\2533w\300"
+	.string	"\277\274\344\320\330\261j\260\235W\236\215:'\031\240\021<6S|v\256\005$c\270\350\330\035@u\310\224\311\330\233\363)\302\314\262B\357\356\370\325\375\240J2'\253\225I\272\264\220\36345<\271\027p~\306\311\313\342\221\243\357\231w\276a\022\266\266\246\357+\332\357\360\304\354\262\220\365=\233\247\033\26005-m\336\\\352%\321c\323f\311/\006\024\276\037xg\214z\345\025\266\346\256\331"
+	.ascii	"\235\334\221q\263\263>\320\026Yu\352\324\2359\354\350p#\245\357"
+	.ascii	"\2058k\326X \032\272l\032)(t\232\334/q+\352\372\276h\006\276"
+	.ascii	"@\207\006\315\231\246\232\345+\b\344\245i6\t\032\201\023\326"
+	.ascii	"\346g\03270$=\324\372\376B\032|\241\315\214\231,P\350\364t\345"
+	.ascii	"7\254\276\277\340\005g\340:\313\234e\3169\r]Qn.\020{\253\313"
+	.ascii	"\253r6d\255\3579W\323\326`5\211\302\2061\264\205\ts\222\321\200"
+	.ascii	"s\024\272\261\346/\216X\f\2511?\311\270\345\310\302\223\321\367"
+	.ascii	"\024\223\002\034\235\027\024\214\001l\313\226\023L\023[\245\216"
+	.ascii	"l\316\227\237`\200tp\235\331\365=\341\030@\025w\246\357\351\345"
+	.ascii	"nr\314,\253\276g\227N\003\016\361A\226\325\367\344\362\333\261"
+	.ascii	"V'\216\305\321gsP\344\202\340\242\266+W\316,Fp\225\265\255\034"
+	.ascii	"X~f1\203\001f\257\357\371f\345\202^ZH\261\323\367t\273\033\234"
+	.ascii	"Y[\363B\026.\222q\246\235i\247\225\272\260\340\026\224\034yl"
+	.ascii	"?\255\340Y\365X.\373\236k\267\252\356\212U\230\276\247ZM\273"
+	.ascii	"z\343K\262\345\006\204M\250C\361\223Z@0\313a \0132\247\220\""
+	.ascii	"\032\3226c\263\025@ X8 \222\013\231\315\036\023@\204\216\fEE"
+	.ascii	"\220B\307j\206\024$\031\366\337\007\017\003\303\234\203\303\321"
+	.ascii	"\035\207\023\266\347\322\302s-\323\356\324\211:\310+\217A\023"
+	.ascii	"=\020*\217\322\032n\363\242~\233\206V\037\223\350\250V\267\254"
+	.ascii	"\312\221"
+	.string	"\243\215\251R\351\320(f\323\t'\343\245T\312=\030\335\202?/\027\002\246\027K\021\3668\242\310\371R\347i\336\035\3452y\200\020*C%\322\265\262g\342Wh\022\302\027\352Tc\325m\260\247\272\216\2022{\232*1%\252\027:J\310\331\2042\307&VQ5\210l\037<+\0349\024x\264\216f\317.x\215\234\273\225\210\235HQ\r\313\364\257t\320S\210O\320\260<\026.V \257\221\t9\262\355%{\230\207\021<\356\314S\tBy\377\225tyd\251\360\271\262}a\352\241\362?\222\310\365C\263\366\347\332@w\027\371\233\270z\235N\23207\213\204\205k<\221\016\003>Q\215\317\224\350\032\3512\004< l`\247\376\307\214X\251\b\273;8Y\026D\242\274\177\243\003\222\207\332\246Q\200F\226G\207\311cw\247\230\300\364\307\254\361\t7_T\340\276A\216\221\002Wt<\261\016\226\252\243\240!"
+	.string	",4\203\314[i\027\211F\375\354\013F\226\377\306\243\305r\370>#\216\020\002\025\0343\322\316\022c\001L\216\206<\3308,\241\306H\343$a\"\302\231\267\017\035\222\344\272\030\211\022\3411\231\225\233E\205nD\364\255\1777\004d\311\315Zl\f[\270\330g\333\205\272\206\333\324\r\365\2257\002?\037oy\007\311sc\024\236\b8\232\226\\\n\177\274stA\001\241\305\177\324\273\3171\357\211u\351\332\330v\030/\251$D(28`\016\332XF\017\024\220^+B2b\220\343\f\t\270\021\004$\203\307E\376O\271f!\n\325b\242\367gM\222\235\031\327\304+3\317\221\362$\337\013\023^\254\327\2367\2437\262\207\263cfC\210\016\364\t\344y\300\225\035\256X\374'\346?\270N\270\177\302\302\005\276\344\263\374\003\276\236oW5}\312\025'\034\2134\276\371"
+	.ascii	"\271\n\"\220z\031\004\224\233\353\0044().\t\202\330{\250\261"
+	.ascii	"\346\201Q\352\334\371z+\030!\257T\207E\344\003\250UY_\343f:\225"
+	.ascii	"1\202\231vG\031JU\001\003\334\213\325Y'\223\240\203\255\242k"
+	.ascii	"?\265\247\226x\026\017|\3362\325g\272\352\351\025\004wZ\307\335"
+	.ascii	"u\033|\003\313\036r\335\001D\327+\277\216F{B\251\363)\020}$\252"
+	.ascii	"\261\270y\004q\234\323\005fp\rdH\303\23199\024(\302\352L\305"
+	.ascii	"\027\033\355\313\b\245\224n^bP2@z\037@l\006\342\023\002b9)\210"
+	.ascii	"\306\274\3647\264<\030\211Qo\265 ~\260\356\255\362\310\363fj"
+	.ascii	"\257\362-bk/c\314\360\0264<D\262q4^\344\265\245hsN1\333\264\240"
+	.ascii	"\364\033`\007\032\237\305n\242pm\3525\223\372\224T\007\376\240"
+	.ascii	"\312O\243\374\315\236\306\204K?x\2214_\200\213m\354\371\037H"
+	.ascii	"dU\305/\246\365"
+	.string	"gk\357\345c!\305\341\347\342Y\310\351\204pk\224Z\365\265*\033FU\021\345'\307\245\304\351\246\301\337 \250\313\021`|g\030\3253\203%kuV;\004\316_\234'\204\001\275\322\276\236\345\204\252\311\3644\371\215^\330_\375\253d\331\340\203\213>\2508\237\325l\317\235\273\261\264\277\334\255\300\205o\3302/dI;\001\315\210\242\201\263\"/\354\302R\303\376Sw\037|\213Q\355\201\250\361\317\220\330\033\363\272\036nC\337^@\267\367\016T\336\227\260\037=\252\271\311\235\252\237\320F\261\263\333"
+	.string	"\215U\311(\221a4\265P9G\304\251\366\306"
+	.string	"L"
+	.string	"\323\227\376QK!\257-\0305\001\272\243\313\350\3628\bV\217\252K^\216\274\261_O\032\274b\323\001b\215dN\375\326FHMSI\337\005K\300\357\024\231\263\370\004\233^\363y\f\017\316\210\265\351\366\005\026\315[\270\b\210Z\022\200w\350\311\376\337\345\n\ny\2571\262j\316\310\302\f\350j;\322~\002\265\3536|"
+	.string	"o\243h\307fd9\3708\207\352\2411Le\374<\023\344U*u\234\245\272\324\226\314\203\216\023\222\373ID\306yKs\245<\215\242\323\030\204>N\361\240\240\361\345K"
+	.string	"\205;0pd\032\371\271\240\260\330\036\363B\235\032/\004iW7\231\305\232l\225Q>\320\001\356\363\b\345@\220\356i\315\377\243\355\374\350\334Kz\200\\\212\034I\320hH=k{\"$\023\203\335>s\303\212l\331\250\rY\275\367\307+\032T\304\304r\267\256\347\274G\016'\301\313\306\267\341\261\230B\306\336XN\377\300\001D\177\2240\324\347H\"\274vAZ\226\2666t\354\227\213vX\343&\025\030\276&\373\026\350>\002\255\212\335\032\257CFN\365\241\273T\374F]\350\313&\033*gE\027\334\023\030@\003\0330\t\360\350\317\002D\233\351@}9eW\027\250\324\265\301D\330\260$>M\030\264\024\200\272b\214iI/\021\002ly\n\226\262\006\266\365\020\2641v\362Pd^\230*'\030w\345\021\321U\323\226\315\263eSP\323,\324\311'\226\013}\212\370\363\271\343y"
+	.string	"\304\035;\001\307\206\243y\245 \177\331T*\301{\272\247\365\344\272\366\207\032\025\213sF?\013\025\374\256\032hJ\277\177l\027\215\373\350\006^\351\207\316\006\357\2704\245i\312\004\207\267\025U\372c\177\317~V2M\317\003\366\037i\272\274.\007t\324+5(\330)~8X \243\2741\035\272V<\265\231\030\300\212\267\017\327\237\377^Zo\223\316\024\311Q\215\2560j\026i\217\202\275(\031\364\302\027\023b\265_\321\020\003\310h\204\030\212b\332\347V[\304E\004\f\002\n\360rB+\311\240\250\306/\245z\337/B\244\314\327\245\241\311\344\243P\030\021{\221\316\347\373Z\315\"\362\271\005x\360\360\327fY\036\340\345\243\232\204\356\271\375"
+	.ascii	"\301&\376\0178|\361a\341\267lRd\216\347\n>\021u\354t3\342\003"
+	.ascii	"\021\222\027I\002\274Aw\370\361\243\337\206;\272\231h e}\177"
+	.ascii	"\203\213\256P\377\262\260V\030Q~!\254T\207\377\264\0362Q\262"
+	.ascii	"\f\254\240\241\375\367\352\213\027\254p\235G\375\247y\327\326"
+	.ascii	"\005\345\271\320\207%\003\365\332h\213\353|~~\002\352\204\360"
+	.ascii	"\032\365\355\276R\261*\005\261s8=\026\2310p\225x#\203\325qQ\300"
+	.ascii	"\016@\264\2312\034\272\b\263>\367\213o\312Q\246\365\033\021\001"
+	.ascii	"'\t4\366<(\031\330|\244}H\006=\201\224\352y;\374\233\200\210"
+	.ascii	"\001\226\021\317\200mr1\037\212\325\222\306\243\322LR\373\254"
+	.ascii	"\020\225\r\013\277\2347Lo\231T\t\326>9.\311\201X'+=$\363\026"
+	.ascii	"\272\221.h,\366I\244\2011\235\034\276\007F\26667\023\201 \271"
+	.ascii	"\232\027$\342\235\241\313\342\220\301\207y\253\370\034\f\246"
+	.ascii	"\264E'\364\030\325\320\331$\321\220\211\t\252\327\344\3513\357"
+	.ascii	"Xa\302g|$\005Toqu2\364\263\227/\250\334\307s\2274.C\b\221\216"
+	.ascii	"\327|E\0379aM6\367\342\237\214Q\275T\215\363\345\372\013kp/\202"
+	.ascii	"\322\341\034\352\257\252jx\323\373\302R\243\313\357\266\341\274"
+	.ascii	"/l\316\377\325~,6\264\251\317\367\252\375v\333\263\344\\v\177"
+	.ascii	"\t\3558m\026\377\330\362\003\217>U\272m\365C\006\227\231\\\230"
+	.ascii	"\332\346\003Z\2002\016\341\323\255g<\206\246P\235d\256\363y\350"
+	.ascii	"\013\277mn\314\363\233\365\265\256\356\265\370\253\223\255^\271"
+	.ascii	"\247\274\255\024v\023\306\376\022\235\314\357\037W\177s\332\336"
+	.ascii	"j\272\232\347\304\002\333\337<\344\027\372\262[\006k\016\336"
+	.ascii	"\377\261\374C\222\243\327\177\026\373\2734e\205\366\230\0322"
+	.ascii	"\274\016\276\237\335\331\214\272&u\207-\374W\366\252\273K>\327"
+	.ascii	"\360\226\332\021\366\331\343\240\037\212>\"w\250\266\233H\370"
+	.ascii	"%`\204_o*\322A\347w\316\314\001\376\235a\347d\373F3\303\317."
+	.ascii	"l~v\\\366?\362\200\250Q\221?\251\177I}\"\243c\336]\372<\021\340"
+	.ascii	"9\343\t\361\rZ\347\214#y\334\260\242s\326\377\352\307\255u\034"
+	.ascii	"\373\276\364\371(\257\327^\201\366-\363S??\354\335\013\033\247"
+	.ascii	"\003\206m\317\035\350\314E!=?\003\216q2WW:%\242\003I\253|\321"
+	.ascii	"\311\351\n"
+	.text
+	.section	.gnu.lto_.symtab.3426a74754ec15b6,"e",@progbits
+	.string	"pgResetFn_pidProfiles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"resetPidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"pidSetTargetLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"targetPidLooptime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"pidResetErrorGyroState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"pidSetItermAccelerator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"pidStabilisationState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"pidInitConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"pidConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"axisPIDf"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"rcAliasToAngleIndexMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"pidProfiles_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"pidProfiles_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\344"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"pgResetTemplate_pidConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\002"
+	.string	""
+	.string	"pidConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"firFilterDenoiseUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"getRcDeflectionAbs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"getRcDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"gyroIsrRelease"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"gyroIsrHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"getSetpointRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"getThrottlePIDAttenuation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3426a74754ec15b6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10432 @@
+	.file	"beeper.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/config/parameter_group.h"
+	.file 4 "./src/main/drivers/io_types.h"
+	.file 5 "./src/main/drivers/sound_beeper.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/common/time.h"
+	.file 8 "./src/main/io/beeper.h"
+	.file 9 "./src/main/sensors/sensors.h"
+	.file 10 "./src/main/fc/config.h"
+	.file 11 "./src/main/io/beeper.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	beeper.c.86a0a5d8
+	.weak	beeper.c.86a0a5d8
+beeper.c.86a0a5d8:
+	.long	0x4d0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x13
+	.long	.LASF1653
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1530
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1531
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1532
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1533
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1534
+	.uleb128 0x2
+	.long	.LASF1536
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1535
+	.uleb128 0x2
+	.long	.LASF1537
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1538
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1539
+	.uleb128 0x15
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1540
+	.uleb128 0x8
+	.long	0x80
+	.uleb128 0x2
+	.long	.LASF1541
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1542
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF1543
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x2
+	.long	.LASF1544
+	.byte	0x3
+	.byte	0x19
+	.byte	0x12
+	.long	0x98
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x3
+	.byte	0x21
+	.long	0xea
+	.uleb128 0x6
+	.long	.LASF1545
+	.value	0xfff
+	.uleb128 0x6
+	.long	.LASF1546
+	.value	0xf000
+	.uleb128 0x6
+	.long	.LASF1547
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1549
+	.value	0x8000
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1550
+	.byte	0x3
+	.byte	0x2e
+	.byte	0xf
+	.long	0xf6
+	.uleb128 0x16
+	.long	0x106
+	.uleb128 0xc
+	.long	0x7e
+	.uleb128 0xc
+	.long	0x64
+	.byte	0
+	.uleb128 0x17
+	.byte	0x8
+	.byte	0x3
+	.byte	0x35
+	.byte	0x5
+	.long	0x125
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0xd
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x125
+	.byte	0
+	.uleb128 0x7
+	.long	0xea
+	.uleb128 0xe
+	.long	.LASF1556
+	.byte	0x20
+	.byte	0x3
+	.byte	0x30
+	.long	0x176
+	.uleb128 0xf
+	.string	"pgn"
+	.byte	0x31
+	.byte	0xb
+	.long	0xb0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1551
+	.byte	0x3
+	.byte	0x32
+	.byte	0xe
+	.long	0x98
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1552
+	.byte	0x3
+	.byte	0x33
+	.byte	0xe
+	.long	0x176
+	.byte	0x8
+	.uleb128 0xf
+	.string	"ptr"
+	.byte	0x34
+	.byte	0xf
+	.long	0x17b
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1553
+	.byte	0x3
+	.byte	0x38
+	.byte	0x7
+	.long	0x106
+	.byte	0x18
+	.byte	0
+	.uleb128 0x7
+	.long	0x8c
+	.uleb128 0x7
+	.long	0x176
+	.uleb128 0x2
+	.long	.LASF1554
+	.byte	0x3
+	.byte	0x39
+	.byte	0x3
+	.long	0x12a
+	.uleb128 0x8
+	.long	0x180
+	.uleb128 0x2
+	.long	.LASF1555
+	.byte	0x4
+	.byte	0x18
+	.byte	0x11
+	.long	0x8c
+	.uleb128 0xe
+	.long	.LASF1557
+	.byte	0x3
+	.byte	0x5
+	.byte	0x20
+	.long	0x1d1
+	.uleb128 0x4
+	.long	.LASF1558
+	.byte	0x5
+	.byte	0x21
+	.byte	0xd
+	.long	0x191
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1559
+	.byte	0x5
+	.byte	0x22
+	.byte	0xd
+	.long	0x8c
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1560
+	.byte	0x5
+	.byte	0x23
+	.byte	0xd
+	.long	0x8c
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1561
+	.byte	0x5
+	.byte	0x24
+	.byte	0x3
+	.long	0x19d
+	.uleb128 0x8
+	.long	0x1d1
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1562
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x30f
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	0x87
+	.uleb128 0x9
+	.long	.LASF1640
+	.byte	0xa
+	.byte	0x4d
+	.byte	0x1a
+	.long	0x1d1
+	.uleb128 0x2
+	.long	.LASF1610
+	.byte	0x7
+	.byte	0x21
+	.byte	0x12
+	.long	0xa4
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x8
+	.byte	0x17
+	.long	0x3bc
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x15
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1633
+	.byte	0x8
+	.byte	0x31
+	.byte	0x3
+	.long	0x32c
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1634
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x9
+	.byte	0x14
+	.long	0x3f9
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1641
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x20
+	.long	0x1dd
+	.uleb128 0x18
+	.long	0x314
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x53
+	.uleb128 0x9
+	.long	.LASF1642
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x85
+	.long	0x18c
+	.uleb128 0x19
+	.long	0x40d
+	.byte	0xb2
+	.uleb128 0x1a
+	.long	0x3f9
+	.byte	0x3d
+	.byte	0x19
+	.uleb128 0xa
+	.long	.LASF1643
+	.value	0x1b3
+	.byte	0x5
+	.long	0x1e2
+	.uleb128 0xa
+	.long	.LASF1644
+	.value	0x1b2
+	.byte	0x5
+	.long	0x64
+	.uleb128 0x10
+	.long	.LASF1645
+	.value	0x1b1
+	.byte	0xd
+	.long	0x30f
+	.long	0x45b
+	.uleb128 0x11
+	.string	"idx"
+	.value	0x1b1
+	.byte	0x29
+	.long	0x64
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1646
+	.value	0x1b0
+	.byte	0xe
+	.long	0x3bc
+	.long	0x478
+	.uleb128 0x11
+	.string	"idx"
+	.value	0x1b0
+	.byte	0x2a
+	.long	0x64
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1647
+	.value	0x1af
+	.byte	0xa
+	.long	0xa4
+	.uleb128 0x12
+	.long	.LASF1649
+	.value	0x1ae
+	.long	0x49c
+	.uleb128 0xb
+	.long	.LASF1648
+	.value	0x1ae
+	.byte	0x1c
+	.long	0x320
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1650
+	.value	0x1ad
+	.long	0x4b4
+	.uleb128 0xb
+	.long	.LASF1651
+	.value	0x1ad
+	.byte	0x26
+	.long	0x8c
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1654
+	.byte	0xb
+	.value	0x1ac
+	.byte	0x6
+	.uleb128 0x1c
+	.long	.LASF1655
+	.byte	0xb
+	.value	0x1ab
+	.byte	0x6
+	.uleb128 0xb
+	.long	.LASF1652
+	.value	0x1ab
+	.byte	0x1a
+	.long	0x3bc
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 29 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1d
+	.file 30 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 31 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x1f
+	.file 32 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 33 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x21
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x4
+	.file 34 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 35 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.file 36 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.file 37 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 38 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xa
+	.file 39 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x27
+	.byte	0x4
+	.file 40 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0x4
+	.file 41 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 42 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2a
+	.byte	0x4
+	.file 43 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2b
+	.file 44 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 45 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 46 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1468
+	.byte	0x4
+	.file 47 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1469
+	.byte	0x4
+	.file 48 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1479
+	.byte	0x4
+	.byte	0x4
+	.file 49 "./src/main/io/statusindicator.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x31
+	.byte	0x4
+	.file 50 "./src/main/io/vtx.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x32
+	.file 51 "./src/main/fc/rc_controls.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 52 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x34
+	.file 53 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x35
+	.file 54 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1515
+	.byte	0x4
+	.file 55 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x37
+	.file 56 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x4
+	.file 57 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x39
+	.file 58 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1529
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF807
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF768
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF908
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF965
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF988
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1070
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1072
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1077
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1087
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1099
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1478
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1505
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx.h.22.12f28c2beccab569593ab27679518da5,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1510
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1519
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1522
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1656
+	.long	.LASF1657
+	.long	.LASF1658
+	.long	.LASF1659
+	.long	.LASF1660
+	.long	.LASF1661
+	.long	.LASF1662
+	.long	.LASF1663
+	.long	.LASF1664
+	.long	.LASF1665
+	.long	.LASF1666
+	.long	.LASF1667
+	.long	.LASF1668
+	.long	.LASF1669
+	.long	.LASF1670
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1671
+	.byte	0xb
+	.long	.LASF1672
+	.byte	0xb
+	.long	.LASF1673
+	.byte	0x3
+	.long	.LASF1674
+	.byte	0x4
+	.long	.LASF1675
+	.byte	0x4
+	.long	.LASF1676
+	.byte	0x4
+	.long	.LASF1677
+	.byte	0x2
+	.long	.LASF1678
+	.byte	0x6
+	.long	.LASF1679
+	.byte	0x7
+	.long	.LASF1680
+	.byte	0x5
+	.long	.LASF1681
+	.byte	0x6
+	.long	.LASF1682
+	.byte	0xe
+	.long	.LASF1683
+	.byte	0xf
+	.long	.LASF1684
+	.byte	0xf
+	.long	.LASF1684
+	.byte	0xe
+	.long	.LASF1685
+	.byte	0xb
+	.long	.LASF1686
+	.byte	0xe
+	.long	.LASF1687
+	.byte	0xe
+	.long	.LASF1688
+	.byte	0xb
+	.long	.LASF1689
+	.byte	0xb
+	.long	.LASF1690
+	.byte	0xd
+	.long	.LASF1691
+	.byte	0xb
+	.long	.LASF1692
+	.byte	0xc
+	.long	.LASF1693
+	.byte	0xc
+	.long	.LASF1694
+	.byte	0xb
+	.long	.LASF1695
+	.byte	0xb
+	.long	.LASF1696
+	.byte	0xb
+	.long	.LASF1697
+	.byte	0xb
+	.long	.LASF1698
+	.byte	0xa
+	.long	.LASF1699
+	.byte	0x9
+	.long	.LASF1700
+	.byte	0x8
+	.long	.LASF1701
+	.byte	0xf
+	.long	.LASF1702
+	.byte	0x9
+	.long	.LASF1703
+	.byte	0x2
+	.long	.LASF1704
+	.byte	0x3
+	.long	.LASF1705
+	.byte	0x1
+	.long	.LASF1706
+	.byte	0x3
+	.long	.LASF1707
+	.byte	0x4
+	.long	.LASF1708
+	.byte	0x4
+	.long	.LASF1709
+	.byte	0x4
+	.long	.LASF1710
+	.byte	0x4
+	.long	.LASF1711
+	.byte	0x4
+	.long	.LASF1712
+	.byte	0x4
+	.long	.LASF1713
+	.byte	0x4
+	.long	.LASF1714
+	.byte	0x4
+	.long	.LASF1715
+	.byte	0x4
+	.long	.LASF1716
+	.byte	0x4
+	.long	.LASF1717
+	.byte	0x5
+	.long	.LASF1718
+	.byte	0x6
+	.long	.LASF1719
+	.byte	0x6
+	.long	.LASF1720
+	.byte	0x5
+	.long	.LASF1721
+	.byte	0x7
+	.long	.LASF1722
+	.byte	0x2
+	.long	.LASF1723
+	.byte	0x2
+	.long	.LASF1724
+	.byte	0x7
+	.long	.LASF1725
+	.byte	0x7
+	.long	.LASF1726
+	.byte	0x7
+	.long	.LASF1727
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1459:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1486:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1498:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1095:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF795:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1121:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF850:
+	.string	"_WCHAR_T_DEFINED "
+.LASF802:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF771:
+	.string	"USE_CLI "
+.LASF1215:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1313:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF885:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF889:
+	.string	"USE_PPM"
+.LASF1233:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1463:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF775:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1362:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF872:
+	.string	"USE_FAKE_GYRO "
+.LASF1558:
+	.string	"ioTag"
+.LASF966:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1528:
+	.string	"BEEPER_COMMAND_REPEAT 0xFE"
+.LASF1101:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF891:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1536:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF967:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1562:
+	.string	"_Bool"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF886:
+	.string	"USE_UART8 "
+.LASF869:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1080:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1525:
+	.string	"BEEPER_PIN NONE"
+.LASF797:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1571:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1640:
+	.string	"beeperDevConfig_System"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1501:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1620:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1084:
+	.string	"IOCFG_AF_OD 0"
+.LASF972:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1152:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1102:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1386:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1332:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF988:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1473:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1091:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF842:
+	.string	"__WCHAR_T__ "
+.LASF803:
+	.string	"USE_SENSOR_NAMES "
+.LASF1455:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1026:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1427:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1373:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF990:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1568:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1542:
+	.string	"uint16_t"
+.LASF1155:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1465:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1011:
+	.string	"PG_RX_CONFIG 24"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF786:
+	.string	"TELEMETRY_HOTT "
+.LASF978:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1361:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1119:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF933:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1088:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF812:
+	.string	"_T_PTRDIFF_ "
+.LASF1400:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1275:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1022:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1241:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF955:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1311:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF976:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF841:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1625:
+	.string	"BEEPER_READY_BEEP"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1114:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1482:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1418:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1278:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1030:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1454:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1575:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1595:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1122:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1087:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF833:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF952:
+	.string	"BIT(x) (1 << (x))"
+.LASF1600:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1076:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1521:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF971:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1130:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF986:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1281:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF875:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF852:
+	.string	"___int_wchar_t_h "
+.LASF1430:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1376:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1093:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1197:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1472:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF914:
+	.string	"VTX_TRAMP"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1597:
+	.string	"OWNER_BARO_EXTI"
+.LASF1007:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF546:
+	.string	"__always_inline"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF890:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1650:
+	.string	"beeperConfirmationBeeps"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1574:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF947:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1027:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1040:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1041:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1547:
+	.string	"PGR_SIZE_MASK"
+.LASF1200:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF799:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1193:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1316:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1646:
+	.string	"beeperModeForTableIndex"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF798:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1356:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1632:
+	.string	"BEEPER_PREFERENCE"
+.LASF1492:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1598:
+	.string	"OWNER_USB"
+.LASF1161:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1058:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF1609:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF837:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1273:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF982:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1338:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1145:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1579:
+	.string	"OWNER_SONAR_ECHO"
+.LASF905:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1379:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1325:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1019:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1062:
+	.string	"PG_VTX_CONFIG 515"
+.LASF969:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1567:
+	.string	"OWNER_SERVO"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF873:
+	.string	"ACC "
+.LASF1655:
+	.string	"beeper"
+.LASF1643:
+	.string	"isBeeperOn"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF794:
+	.string	"TELEMETRY_IBUS "
+.LASF773:
+	.string	"USE_PWM "
+.LASF1612:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF1409:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF843:
+	.string	"_WCHAR_T "
+.LASF1622:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1469:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1474:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1205:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF968:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF818:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1128:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1481:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1537:
+	.string	"__uint16_t"
+.LASF1494:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1566:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1212:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF929:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1594:
+	.string	"OWNER_RX_SPI_CS"
+.LASF853:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1483:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1245:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1187:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1100:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1506:
+	.string	"VTX_BAND_MIN 1"
+.LASF1652:
+	.string	"mode"
+.LASF1131:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1422:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF965:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1511:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1248:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF945:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1253:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1440:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1530:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1069:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1072:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF970:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF819:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1382:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1020:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1328:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1003:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1050:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1489:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1634:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF998:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF974:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1419:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1401:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1217:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF871:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF800:
+	.string	"USE_MSP_PUSH "
+.LASF1520:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1262:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1077:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF811:
+	.string	"_PTRDIFF_T "
+.LASF1556:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1169:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF960:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1137:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF826:
+	.string	"_T_SIZE_ "
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1557:
+	.string	"beeperDevConfig_s"
+.LASF1561:
+	.string	"beeperDevConfig_t"
+.LASF1512:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1549:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1159:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1606:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1404:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1475:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF932:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1235:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1518:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1621:
+	.string	"BEEPER_RX_SET"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1617:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1329:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF781:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1308:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1588:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1425:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1371:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1630:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF1214:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1086:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1290:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1206:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1124:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1176:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1545:
+	.string	"PGR_PGN_MASK"
+.LASF1499:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF863:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1445:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1331:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1374:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1025:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF770:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1457:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1035:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1060:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1111:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1484:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1416:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1179:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1202:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF936:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1599:
+	.string	"OWNER_USB_DETECT"
+.LASF1296:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1082:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1079:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1551:
+	.string	"size"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1260:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1637:
+	.string	"SENSOR_INDEX_BARO"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1045:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1633:
+	.string	"beeperMode_e"
+.LASF864:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1265:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF866:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1449:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF836:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1134:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF831:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1603:
+	.string	"OWNER_INVERTER"
+.LASF908:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1274:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1583:
+	.string	"OWNER_SPI_MOSI"
+.LASF1428:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1550:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1541:
+	.string	"uint8_t"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1173:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF918:
+	.string	"USE_DSHOT"
+.LASF1277:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF949:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1638:
+	.string	"SENSOR_INDEX_MAG"
+.LASF784:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF1039:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1280:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1071:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF854:
+	.string	"_GCC_WCHAR_T "
+.LASF849:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF903:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1067:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1367:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1394:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1286:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1624:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1421:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF857:
+	.string	"_BSD_WCHAR_T_"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF792:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF829:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1491:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1471:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1094:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF840:
+	.string	"__need_size_t"
+.LASF1565:
+	.string	"OWNER_PPMINPUT"
+.LASF1555:
+	.string	"ioTag_t"
+.LASF821:
+	.string	"__need_ptrdiff_t"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF764:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF951:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1508:
+	.string	"VTX_CHANNEL_MIN 1"
+.LASF1196:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF808:
+	.string	"_STDDEF_H "
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1125:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1224:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1005:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1522:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1037:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1013:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF987:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF977:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1140:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1163:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF834:
+	.string	"_SIZE_T_DECLARED "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1209:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF915:
+	.string	"BLACKBOX"
+.LASF1377:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1323:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF900:
+	.string	"LED_STRIP"
+.LASF1358:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1340:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1403:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1143:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF896:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF897:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1490:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1654:
+	.string	"beeperSilence"
+.LASF1269:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF785:
+	.string	"TELEMETRY_FRSKY "
+.LASF1098:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1059:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1406:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1578:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1552:
+	.string	"address"
+.LASF1397:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1343:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1247:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1250:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1487:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF895:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1146:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1289:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF859:
+	.string	"NULL"
+.LASF1268:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1451:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1580:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF975:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF922:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF499:
+	.string	"__PMT"
+.LASF855:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1384:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1559:
+	.string	"isInverted"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF917:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1096:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1295:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF767:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1563:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1478:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1548:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF995:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1301:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1172:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1135:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1513:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1515:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF1142:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1626:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1244:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF963:
+	.string	"UNIT_TESTED "
+.LASF994:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1326:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF927:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1527:
+	.string	"MAX_MULTI_BEEPS 20"
+.LASF847:
+	.string	"_WCHAR_T_ "
+.LASF1627:
+	.string	"BEEPER_ARMED"
+.LASF1105:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF931:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1305:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1653:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1496:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF790:
+	.string	"USE_SERVOS "
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF973:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF763:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF825:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1126:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1272:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1104:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1415:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF778:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1188:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1346:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF1046:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF1636:
+	.string	"SENSOR_INDEX_ACC"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF989:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1388:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF861:
+	.string	"__need_NULL"
+.LASF862:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1141:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1136:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1631:
+	.string	"BEEPER_ALL"
+.LASF772:
+	.string	"USE_PPM "
+.LASF1611:
+	.string	"BEEPER_SILENCE"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1117:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF899:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF892:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1502:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1226:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF926:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1191:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1553:
+	.string	"reset"
+.LASF1178:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF996:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1619:
+	.string	"BEEPER_BAT_LOW"
+.LASF942:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1586:
+	.string	"OWNER_SDCARD"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1446:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1036:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1293:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1531:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1534:
+	.string	"signed char"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1194:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF822:
+	.string	"__size_t__ "
+.LASF788:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF789:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1157:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1443:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF851:
+	.string	"_WCHAR_T_H "
+.LASF1267:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1004:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1033:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1043:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1352:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1271:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1470:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1615:
+	.string	"BEEPER_DISARMING"
+.LASF830:
+	.string	"_BSD_SIZE_T_ "
+.LASF1170:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1370:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF909:
+	.string	"USE_DASHBOARD"
+.LASF787:
+	.string	"TELEMETRY_LTM "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1103:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF954:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1108:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1074:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1488:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1012:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1543:
+	.string	"uint32_t"
+.LASF1507:
+	.string	"VTX_BAND_MAX 5"
+.LASF1349:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1608:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF930:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1016:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF810:
+	.string	"_ANSI_STDDEF_H "
+.LASF1066:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1601:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1546:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1151:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1410:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1021:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1078:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1054:
+	.string	"PG_PPM_CONFIG 507"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1112:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1476:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF920:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1149:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF776:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1186:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1092:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1127:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF806:
+	.string	"VTX_SMARTAUDIO "
+.LASF957:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1256:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1018:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1505:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1118:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1236:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF921:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1485:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF983:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF791:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1304:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF911:
+	.string	"VTX_COMMON"
+.LASF1160:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1099:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1015:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1392:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1539:
+	.string	"long int"
+.LASF1493:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1221:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1008:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1510:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1239:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1576:
+	.string	"OWNER_PINDEBUG"
+.LASF1166:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1648:
+	.string	"currentTimeUs"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1433:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF793:
+	.string	"TELEMETRY_CRSF "
+.LASF815:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF1524:
+	.string	"IS_INVERTED false"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF950:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF814:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1266:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF948:
+	.string	"EXPAND_I(x) x"
+.LASF1242:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1647:
+	.string	"getArmingBeepTimeMicros"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF907:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1199:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF828:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1504:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF827:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1034:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1051:
+	.string	"PG_PID_CONFIG 504"
+.LASF856:
+	.string	"__DEFINED_wchar_t "
+.LASF1503:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF522:
+	.string	"__flexarr []"
+.LASF783:
+	.string	"LED_STRIP "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF901:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF964:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1031:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF985:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF844:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF991:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1182:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1061:
+	.string	"PG_VCD_CONFIG 514"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1257:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1577:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1032:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1365:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1395:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1341:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF939:
+	.string	"__enable_irq() "
+.LASF1109:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1540:
+	.string	"char"
+.LASF1238:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1175:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1322:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1083:
+	.string	"IOCFG_AF_PP 0"
+.LASF870:
+	.string	"LED0_PIN NONE"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1302:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF999:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF880:
+	.string	"USE_UART2 "
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1070:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1310:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF898:
+	.string	"USE_SERIALRX_XBUS"
+.LASF801:
+	.string	"USE_RX_MSP "
+.LASF944:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1284:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1500:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF832:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1458:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1479:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF839:
+	.string	"__size_t "
+.LASF766:
+	.string	"I2C1_OVERCLOCK true"
+.LASF940:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1024:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1287:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF860:
+	.string	"NULL ((void *)0)"
+.LASF1466:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1589:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF946:
+	.string	"STR_HELPER(x) #x"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1029:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF913:
+	.string	"VTX_SMARTAUDIO"
+.LASF777:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1560:
+	.string	"isOpenDrain"
+.LASF1581:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1203:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1068:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1573:
+	.string	"OWNER_ADC_RSSI"
+.LASF961:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1364:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF894:
+	.string	"USE_SERIALRX_SBUS"
+.LASF876:
+	.string	"USE_FAKE_BARO "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1477:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1181:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF858:
+	.string	"__need_wchar_t"
+.LASF984:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF813:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1628:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1053:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1344:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1613:
+	.string	"BEEPER_RX_LOST"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1307:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF923:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1223:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1065:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1439:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1385:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1123:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1461:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1529:
+	.string	"BEEPER_COMMAND_STOP 0xFF"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1167:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1497:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1042:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1645:
+	.string	"beeperNameForTableIndex"
+.LASF979:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1523:
+	.string	"IS_OPEN_DRAIN true"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1044:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF769:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF765:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF980:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1052:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1355:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1211:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1064:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1584:
+	.string	"OWNER_I2C_SCL"
+.LASF1582:
+	.string	"OWNER_SPI_MISO"
+.LASF1116:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1607:
+	.string	"OWNER_COMPASS_CS"
+.LASF956:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1139:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1389:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF992:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF848:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1220:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF935:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1407:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1259:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1585:
+	.string	"OWNER_I2C_SDA"
+.LASF1538:
+	.string	"__uint32_t"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1368:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1009:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1413:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1158:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1590:
+	.string	"OWNER_FLASH"
+.LASF1448:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1038:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1017:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1085:
+	.string	"IOCFG_IPD 0"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1347:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1651:
+	.string	"beepCount"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF845:
+	.string	"_T_WCHAR "
+.LASF1378:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF838:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1649:
+	.string	"beeperUpdate"
+.LASF1359:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1517:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF809:
+	.string	"_STDDEF_H_ "
+.LASF1097:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1115:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1464:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1133:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1218:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1334:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1110:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1618:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1014:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1251:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1317:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1602:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF805:
+	.string	"VTX_CONTROL "
+.LASF1353:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1605:
+	.string	"OWNER_TRANSPONDER"
+.LASF1010:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF816:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF846:
+	.string	"__WCHAR_T "
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1263:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1120:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF953:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1610:
+	.string	"timeUs_t"
+.LASF868:
+	.string	"U_ID_1 1"
+.LASF867:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF919:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1592:
+	.string	"OWNER_MPU_CS"
+.LASF1544:
+	.string	"pgn_t"
+.LASF1056:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1154:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1412:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1629:
+	.string	"BEEPER_USB"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1623:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF877:
+	.string	"MAG "
+.LASF1614:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1350:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF958:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1006:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF938:
+	.string	"__disable_irq() "
+.LASF1354:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1431:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF928:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF993:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1644:
+	.string	"beeperTableEntryCount"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF959:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF779:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1049:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1570:
+	.string	"OWNER_ADC_BATT"
+.LASF1023:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF937:
+	.string	"EEPROM_SIZE 32768"
+.LASF1254:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1283:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1641:
+	.string	"pgResetTemplate_beeperDevConfig"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1129:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1514:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1391:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1337:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1148:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1564:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1526:
+	.string	"BEEPER_NAMES "
+.LASF1480:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1232:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1519:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF1495:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF962:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1314:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF817:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1132:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1452:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF780:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1106:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1516:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF893:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1436:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF796:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1208:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1081:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1075:
+	.string	"BEEP_ON do {} while(0)"
+.LASF997:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1587:
+	.string	"OWNER_SDCARD_CS"
+.LASF924:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF835:
+	.string	"__DEFINED_size_t "
+.LASF1113:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1299:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF879:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1434:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1320:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1229:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1185:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1057:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF887:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF925:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1533:
+	.string	"long unsigned int"
+.LASF1089:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1604:
+	.string	"OWNER_LED_STRIP"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF941:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF804:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF807:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1073:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF912:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1456:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1639:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1001:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1028:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF881:
+	.string	"USE_UART3 "
+.LASF774:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1509:
+	.string	"VTX_CHANNEL_MAX 8"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1107:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1292:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF823:
+	.string	"__SIZE_T__ "
+.LASF1090:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1164:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1591:
+	.string	"OWNER_BARO_CS"
+.LASF1616:
+	.string	"BEEPER_ARMING"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1047:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1190:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1642:
+	.string	"beeperDevConfig_Registry"
+.LASF1532:
+	.string	"unsigned int"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF882:
+	.string	"USE_UART4 "
+.LASF1298:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1460:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF943:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1398:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1184:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1063:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1055:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1335:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1569:
+	.string	"OWNER_ADC"
+.LASF1535:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1596:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1554:
+	.string	"pgRegistry_t"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1468:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1227:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1437:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF883:
+	.string	"USE_UART5 "
+.LASF1383:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF824:
+	.string	"_SIZE_T "
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1002:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1572:
+	.string	"OWNER_ADC_EXT"
+.LASF1048:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF934:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1593:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1424:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF820:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF981:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1635:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1467:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF884:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1230:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1674:
+	.string	"io_types.h"
+.LASF1691:
+	.string	"long-double.h"
+.LASF1698:
+	.string	"platform.h"
+.LASF1659:
+	.string	"src/main/drivers"
+.LASF1710:
+	.string	"rx_pwm.h"
+.LASF1685:
+	.string	"libc-header-start.h"
+.LASF1668:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1661:
+	.string	"src/main/io"
+.LASF1697:
+	.string	"stdint-intn.h"
+.LASF1700:
+	.string	"target.h"
+.LASF1723:
+	.string	"axis.h"
+.LASF1667:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1670:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1681:
+	.string	"beeper.c"
+.LASF1679:
+	.string	"sensors.h"
+.LASF1663:
+	.string	"src/main/target/SITL"
+.LASF1678:
+	.string	"beeper.h"
+.LASF1689:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1715:
+	.string	"io_def_generated.h"
+.LASF1666:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1680:
+	.string	"config.h"
+.LASF1727:
+	.string	"voltage_ids.h"
+.LASF1687:
+	.string	"features-time64.h"
+.LASF1716:
+	.string	"vcd.h"
+.LASF1720:
+	.string	"rc_controls.h"
+.LASF1671:
+	.string	"types.h"
+.LASF1707:
+	.string	"system.h"
+.LASF1717:
+	.string	"runtime_config.h"
+.LASF1683:
+	.string	"stdbool.h"
+.LASF1669:
+	.string	"/usr/include"
+.LASF1719:
+	.string	"vtx.h"
+.LASF1726:
+	.string	"voltage.h"
+.LASF1656:
+	.string	"src/main/build"
+.LASF1704:
+	.string	"feature.h"
+.LASF1686:
+	.string	"features.h"
+.LASF1699:
+	.string	"common.h"
+.LASF1694:
+	.string	"typesizes.h"
+.LASF1657:
+	.string	"src/main/common"
+.LASF1712:
+	.string	"serial.h"
+.LASF1709:
+	.string	"flash.h"
+.LASF1658:
+	.string	"src/main/config"
+.LASF1675:
+	.string	"sound_beeper.h"
+.LASF1695:
+	.string	"time64.h"
+.LASF1672:
+	.string	"stdint-uintn.h"
+.LASF1664:
+	.string	"src/main/target"
+.LASF1703:
+	.string	"utils.h"
+.LASF1718:
+	.string	"statusindicator.h"
+.LASF1711:
+	.string	"sdcard.h"
+.LASF1662:
+	.string	"src/main/sensors"
+.LASF0:
+	.string	"./src/main/io/beeper.c"
+.LASF1665:
+	.string	"src/main"
+.LASF1677:
+	.string	"time.h"
+.LASF1706:
+	.string	"parameter_group_ids.h"
+.LASF1696:
+	.string	"wchar.h"
+.LASF1725:
+	.string	"current_ids.h"
+.LASF1714:
+	.string	"io_def.h"
+.LASF1660:
+	.string	"src/main/fc"
+.LASF1713:
+	.string	"io.h"
+.LASF1692:
+	.string	"stubs.h"
+.LASF1724:
+	.string	"current.h"
+.LASF1721:
+	.string	"battery.h"
+.LASF1690:
+	.string	"cdefs.h"
+.LASF1684:
+	.string	"stdint.h"
+.LASF1705:
+	.string	"build_config.h"
+.LASF1701:
+	.string	"stddef.h"
+.LASF1693:
+	.string	"stubs-64.h"
+.LASF1688:
+	.string	"wordsize.h"
+.LASF1702:
+	.string	"common_post.h"
+.LASF1708:
+	.string	"adc.h"
+.LASF1673:
+	.string	"parameter_group.h"
+.LASF1676:
+	.string	"resource.h"
+.LASF1682:
+	.string	"stdc-predef.h"
+.LASF1722:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 _M\002"
+	.string	"t\003S"
+	.string	"\f"
+	.string	"\354\301\314\336\005"
+	.string	"\001\274\205\242\255\006"
+	.string	"\002\003\004\222\252\354\340\007"
+	.string	"\005\317\253\250\341\002"
+	.string	"\006\007\b\t\230\200\234\277\004\n\307\275\237\261\007\013\240\342\234\212\n"
+	.string	"\006"
+	.string	"*Cp\216\013\214\2522\204\230cm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 =U\001"
+	.string	"\3401"
+	.string	"\t"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\001\002\003\004"
+	.string	"\003\005\003\006\007"
+	.string	"\003\b"
+	.string	"\003"
+	.string	"\005"
+	.ascii	"*\203[.\251\214\3332\322\006\260"
+	.text
+	.section	.gnu.lto_.inline.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\035\002"
+	.string	"t\002F\001"
+	.string	"\t"
+	.string	""
+	.string	"\003\200\200\200\200\002d\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\201\200\200\200~"
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"\001\002\003\004\005\006\007\b"
+	.string	"\013"
+	.string	""
+	.string	")"
+	.string	"y"
+	.string	"\311"
+	.string	"R"
+	.string	"\362"
+	.ascii	"\222\001\244p\024\215\315u\271\211G\001\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 =U\001"
+	.string	"\3201"
+	.string	"\t"
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	"\001\003\002\004"
+	.string	""
+	.string	"\005\003\006\007"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"*\203[NU\032\003\"P\002\337"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\200\004\007\200\004\b\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 E\335"
+	.string	""
+	.string	"`9"
+	.string	"\005"
+	.string	"\001\002"
+	.string	"\002\003\005\006"
+	.string	"\006"
+	.ascii	"`\013\330\0076s\331\002d\275\001,"
+	.text
+	.section	.gnu.lto_.lto.95f5f3ba48df2381,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_beeperDevConfig_Registry.52.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\324\006P"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\303\257\335\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\365\005us"
+	.string	"\005\001\006'\001\003\367\003(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/beeper.c"
+	.string	"\004"
+	.ascii	"L\005\226r\025D5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_beeperDevConfig.54.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 (-\001"
+	.string	"\350\033"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001"
+	.string	"?\202\210\200\030\177}\274\001{\274\001y\273\001"
+	.string	"\002"
+	.ascii	")\242\f\240\b"
+	.text
+	.section	.gnu.lto_beeper.55.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\r\007"
+	.string	"\322\r24`o\032\003pH\b\0077\261\344\3176\250\200\350\224]-:\t\305:\226\314L\2735y\270'4\305\217\242\020t\031\242\356\334(\320\"\211k\333\336R\312\224\002\325p\026.\205\213Ac\005H\316\364\300n,L~\244\204\210\263\023#:\227'n0\211h\021t~$\026'\346\304bf\273\341\237V\2238*\236E\2551\272ki7\220{\035\255\341\377\367i\255{\260V\3721^\\\2562\241\200\264u\246\255J\020\354Z\213\230\224y\204\242\325?\n9\371\267\204\036"
+	.string	"x*\360"
+	.string	"\345\tZ\200\362\324\254]\361\366q\233\244\\\224X\376\307\347\341\314.\253M\342*$\002\331a\034\376\327\205D\031\356s[\203\266\rm7\002\b"
+	.ascii	"\002Td\342}^4\270`\3472\210\265\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_beeperSilence.56.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 \300%\005"
+	.string	"R\311\",\200U\351"
+	.string	"\034\222\304A\255\004N\325:[c\253\304\022\325z\324\210\227\177{\016\227i\213Hb\005\024\250\263,(9\204\272\265\275S\n\256\250\031\257\030\035*-\215X\r\210VS\242\224\301\362\212S'RN\235\272=\344\016\024X1b_\200\335e\017j\354\013\026r\366[<#\332\275\f\b,i\020\352\330\376d\314.\275\343\354A#\313\007`w\025n\216\375a\376=/h[\366G`\354\256\237\266anx\333\t\333\n\333\217\b"
+	.ascii	"3\003\366\231\241\300\367\273\206\307B\350\227q\301\245[\264"
+	.ascii	"\363\t"
+	.text
+	.section	.gnu.lto_beeperConfirmationBeeps.57.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 \377\375\006"
+	.string	"\242\314/5@o\222\016@\265\345\360\233\022\245,W\326j)\304c\007)\2371NM\261?\032\307jh\354ri\354\265c\370'\364O\330X\216%/\336\316\032Z\333'D\246s\0346\227\346J\340X\003\241ODd\250\356X\031\006\302\260\006\030=\360\343\271\036`'\203\200\026\301\021\204e0\024c\0063[\366\225"
+	.string	"48&\036\305E\351H\327\362\233\310=\217/&_\351\335\263\350\307)\023\343\305%U\250\223\220\277\231\257L\032\347\036a\243UD\342\227\271Qb\222\271\035l Pj\355W\272\201dO)\025$,\231\t\237\251Z\235v;\322jD\022\325\005(d\346nD\312\350\257\177\301\277\360_\004\013"
+	.ascii	"7\003\200(m\21173`\2413\246\341.\327p\354\020\006\230\032\002"
+	.ascii	"\356\362\242\235d"
+	.text
+	.section	.gnu.lto_beeperUpdate.58.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"e\007"
+	.string	"r\21645`o\032\003pH\b\027\323\214a\007\003p\217`\224\202p2\022\3444\333f\274 %\364\036.\344{\226\004\206b\261)\030\352\370\201\320\3627g\321\336[\312\224\002\325P4d\013\231\203\006\033\370HH\316&\002\324\221sVh\002\325\260)=RN\304m\023;\233\214\023\265\371\211\230A7\217\234\021\264m3f\272\233:4\325\332\350\270\200\030uH\351\357\245\355B\017\236ZS\377_hj\037\024\371\244\362\217b`\316R\245\200\264u\246\275F\f~\255E<\302\231\304\242\327_\022A\371;\205&\004\270:p\201\345\2122\201\345\252\\\333\342\356\343>Y\3110q\371\037\241\2079?\256v\211/\021)\344\007\360\360\277OD\322p\241\333\"\264\205h\313\021\b"
+	.ascii	"\263\223\240Lh\320\013\f\027\002]\006\261V\243\301]^\264\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_getArmingBeepTimeMicros.59.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 \325\355\005"
+	.string	"\362\n)1pK\323\001@\206\352\030\"2\234\260\322XI\370\334p\"8FL\240fwGWt\213\323E\207\252\006Tx\347\037\246\357\265\254[jl[\333;\245\206\236\031\245\030\003\240\214 A\0040"
+	.string	"\241Y"
+	.string	"\237\211\245\024'4\220rB\247\356\335e\323w\013\206\003\207\340G4l\333\260+\325\034f\237Yw\331M\340X\266\253\320\301\261\031\315\005\204\355\311v|\211OL\246L}\260^\005FB\246\261[!\345\221\367\2069\344\275q\016\247o\324?\305%YeQo\217\313\356\272U\326\302\355n\273b\333b{\003\b"
+	.ascii	"2\003.j\364\257BpMdF\210+D\036\356\n\245\235d"
+	.text
+	.section	.gnu.lto_beeperModeForTableIndex.60.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375`\025"
+	.string	"u\007"
+	.string	"\302\21537@o\222\016\f\351\200\233:\025b\204\353]m\343\026\026V\257\207Cw\353-\3667A\217\315\0350*m\313\236a y-v\006\rg\331\3125\177\370mk\215\020\231\002{B\013\037\205\017\203\247\023@\021\022\301A\235-\033e\331C\324D1B\364\201\210\240M\"v\b\326F\331\026'4m\213\234.\313a\330\006G\005\264\270\253\242\240\362\255\276+=\230\372Z\t;\376\301\217\246d21fb\222\345J\001\371I\317\371\315\013\302{\035Ye\200L\324\312If&|\260\351\365\337\220\212\220\346\254Nu\322\230\270\\\224\300dv\261\240\003X/\253\002X/\350Q\256\217\273%\351\323h1\235J}\032\207\314\374\231N\031\035\3667\370\033~U\013"
+	.string	"\211IEfh`\344j\200#\204W\271\3105<\302\242\341!\270"
+	.ascii	"T\236N;\311"
+	.text
+	.section	.gnu.lto_beeperNameForTableIndex.61.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\365\007"
+	.string	"\362\21678@o\323\001\200K\001\201}\351\353\234|\323=\230\006\307\270\n\245\262\003\306 \2335^\233$\2432]-m+^E\201v\f-\316\224\b\327\375X\305\275\322\247M\366N)\366\200\026\264\004\215\301\223\tP\2008\351O\346m\241m{\240\035G#8\r\202~<\t\232\025\270\013m\036\235\350:\217bu\017Z\n\246\020\244BZ\370a\t\213\tC6\316\330U\024%\207\375jw\327r\303\216\234\324\351\"2\273\03154\3532W>l\1776f_)\0071\332/\271\311\367j\026\003\354\226ZTv\027\301\235\353\323\240\262\355\223\374\364\031\344T\023i\343\001s\201J\355V\352z\002\353\363\372\200\365);\016>\202\376O\036\200\322xA\031\211\0367\016\273\353\2101\"\335\362\266;\266\033l\217\004\013"
+	.string	"\211IEfh`$k"
+	.ascii	"J\210\277\022<]\363n0\361\340\356\223j\305$L2"
+	.text
+	.section	.gnu.lto_beeperTableEntryCount.62.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 \324\335\005"
+	.string	"\"\013)1`M\222\016"
+	.string	"\255\224\224\300\t\002\227&\271\r\373\337N\342\225\316\321\360\221\255RL\236\371\241\220}\013"
+	.string	"L\200r\227\373B\250\302\013\307\266\326\b\221)[*\320a\234Kh\357\322\026.\b\n\315\002\031Z%\340\207q\2605\274\007[Te\031\365_\320nP8\260\207;Q\221\253\344\253\314b\026_'\031\365\353\240\324&3\342\304$E\036\020\215?~t9\332\021?\304\2510\246f\214@|\220df\023\250\004\365q\n"
+	.string	"\365a\027\215]\361\326\243\322F3e\272(\006\231\371\322L\022\235\365\037\370\t\376\030\007"
+	.ascii	"2\003v\2501\\\023\235\021\002\013\221\211\273Bi'\031"
+	.text
+	.section	.gnu.lto_isBeeperOn.63.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 \315\355\005"
+	.string	"4\nv"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\345\243\237\001\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\353\255\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\365\262\001\274\340\004\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\262\371\360\005"
+	.string	"\203\003\202\260\371\350\007\006\177\001\200\300\013/root/repo"
+	.string	"\027./src/main/io/beeper.c"
+	.string	"\t"
+	.ascii	"2\003\202a\251a\017!0\327p\270\210\261\204\310\341\316\231\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_.symbol_nodes.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\275\003"
+	.string	"\324\005\016\001"
+	.string	""
+	.string	""
+	.string	"\0027\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\0028\177\0059\177\006:\177\007;\177\b<\177\t=\177\n>\177\013?\177\f\0056\r\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\0054\016gistry"
+	.string	""
+	.string	"\0052\017\201\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\345\334\006\240\035\370\034\370\034\370\034\370\034\370\034"
+	.ascii	"\370\034x\347Z\023\017"
+	.text
+	.section	.gnu.lto_.refs.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002\n\002\013\002\t"
+	.text
+	.section	.gnu.lto_.decls.95f5f3ba48df2381,"e",@progbits
+	.string	"(\265/\375`\215\016\025O"
+	.string	"\252\215$\037UP\020\"\245\003\352\032\211:B\265\373\240\034\020P\"+\215-\256\273\302\250\367\037\032\037\0166\037\362:\2430j\276\316p\024\272\257\350\247\333\241\366Y\266\376\035\001\377f\024"
+	.string	"\300\245\362\337\342\026g\f\202\313\277\241\264\215\016\204\251?xJ?\334\216\332j\335_\312\024\247\001\345\001\330\001H\232l\356\263\267\213T\310\020\214g\362h<\223C\237.&\207\335'\322\307\350E\034\256qI\2054.\223H\017]\354a/\211@j1\2114jI\"}\214K\"\322X\244Bz\200\322\252\3622\262\251\361\330#\306b\327\200\222\"\036}\322\214g\262\301t\257\227S\037\205\272\245\222G0\304\035;\326\224V\243\351\n1\271gw\017"
+	.ascii	"\325T\225\354b\232QI\262[I\223\213\206:1<\323z\205M\033\006\221"
+	.ascii	"\352'\247n\002\372\354\206\352\036n\247u\367\260\273o\216Rg7"
+	.ascii	"\017\037c\026\024TwT\020TK\r\311\234\272\331km\fi\\V%\213\310"
+	.ascii	"\270\226Y\035\343\034\256\361)\331Y\r\206\352X\227\303)\375\324"
+	.ascii	"\335k\246f!q\340\300t\304z\355\212g/u\210:\304\2660\375\005u"
+	.ascii	"\227[e\225\006,\327\027@q\334p\253\265\272\317\236\2356N\332"
+	.ascii	"\254a\372\025\365ok\200n\267x\007\r$7\230\036E](\253\265\312"
+	.ascii	"\235\362\257\224=O\267\222\275\354>wpD\035gX\230\202\330\037"
+	.ascii	"\035\335\017:\035\241\377<T\215\342\\\277#t=;B\207\246\f\027"
+	.ascii	"1gU\264DI\202\373\327j\377\255\372\277\305\377N\375\013\300\277"
+	.ascii	"\037\376\r\340_\240\377\364\347\242\177\037\3707\202\177%\370"
+	.ascii	"w\305\277\023\374[\001\213\177\207\376u\340\337\0066\203\377"
+	.ascii	";?\343\370\027\203\177-\3707\350\277\333\3772\377\311\374W\373"
+	.ascii	"\217\366\177\206\377e\377\311\376\213\375o\361\337\353?\327\377"
+	.ascii	"\255\377>\377\315\376\353\274\275\275\275\375{\342\347&\177\016"
+	.ascii	"2m\373\243\343\331\017\272]S\364\335\341\203\356\030u\266\027"
+	.ascii	"\033\36123c\272\303Yj\035b\306\314\272mT\343\306\260\315`\322"
+	.ascii	"\204\r\207\031!n\233fw$I\325\023\323M\303\213f\325|\323\354\031"
+	.ascii	"\235\342\271ih7q7\004\317n\210\\\331\025\221JX=o\325\212\244"
+	.ascii	"\255m\313\234mc\257\326f0q\273Q\201\350\243J\231\227\321%kQ\216"
+	.ascii	"\260P\253\262K\227%s\025\246M\307\303K\210\030/_2;\306\213\225"
+	.ascii	"\326\230\177\277\254\r+\006\347\325}z\350\201\202\302\020\026"
+	.ascii	"\316\236\035\331\232%9\230n\230]\373\262-\030\266\023\311n\342"
+	.ascii	"\262\365\354\320M\354\331\r\261\033\202>\2512bEG\317*\324\237"
+	.ascii	"\373\243\253\373A\3076j5KK[\265\25600m\273\253\245\222\254-_"
+	.ascii	"\265\245\022f+\210\361e4\007\031\22435\265\272\231\231-\032g"
+	.ascii	"\335p\205\325\320\206\303\003\355\314"
+	.string	"\n\323E\3333\334Z\013iF\264\354\276\230\231\362\"S\2770\324]1\206\030v\006\264\234\013Sj]d\370\316\300\243U\326\226\303\327QY\021\267\257\272\223\312\222e\313\316\262x\206\304\320\343\313\013\337\262\034\024\027\316\035]\271\2524b\260\034\251;%ccKV}\272i\214\226\254\235\333q\252\310t\225K\226SS\202e\205\351\267\252\356\242\b\255\225\005\373^Q\356\225\025\273Ow7u\373\370b\244\026\326\365\346\326QR#v\320\236\260\311\330\260\257\330\311\350tkuw\0018m\234\312\2001=\232\245\362\177Wb\315\n\213\351G\250\277\256\211\307\356\276\221;\373\330\244\243\333\334\356\210\177gq+\324\315\263Cw\r\25535\t\026b\017\246\377A\364\377;\320\303&E\"\322C\237}4.\251\206\306*jH\017g\003\001\352e\2206\236T\001D\226\334\002K\331\264(\237.\212\271\265\r\005\r\r\355"
+	.ascii	"\211\361\365C"
+	.string	"\207\256\3601\0054\031+P\222i3\361\027I\341&\254\334\264\250\263o\344\204\265\3310v\362\224U\262\224\007\235=44\300\316\2320nJ\2352\212\316\330\214\0361\230\262\326.\315h\004\351\362d\225\f\345dzb a\203\305\224\235|\214\214\341\f\032tK=5\253\247bJ\252\227\266)4\257z\272\254l\204\263V)\202\217\234\257\370\3519\342\331'[\261\371\242\002\245~E\350poo+Bw\312\2442V\375\331\212\213\344\2264\234A\343\"]\314\345\354\251\211\351i\221\352\323\373\243\003A\305Az\236\214\r\001\253bQ\244\0060\246\024\b\233\031\311\202J\362\200\301\372\232\302\364\374\003\354\355L\nL\331Gu\242R\"p\246\304~\364`z\366\361\357\032\236*\341\215\215\032\246\007\263?:\356Qt\226\312A\203\241M\nS\035\332T\353\017\241u\262\253\303Y\306*W\007\216\342)\347\020\310\346(\225"
+	.string	"\207U\245\201b\272\343\f\302\331\362\302\246\246L\305\301(p\216U\262\016F\236g0\215\357y\0235\370\370\205\002j\273xp\335>\254du\237\347\247\277\350_"
+	.string	"\005\353\340\033\333\305\243\002\314\207\226[\367\031444T\271\306\270\254\251\364\270\255z\\\026\333\240:\316\204`\021\251\307Q\325\343vT\237\375\321\005\355\217\016\267\037t|\002\307`\343\277\333ey\342\"e\243\236\235p\210\250]-a\312\3732\0357\235\213\377\356F\353X\374\232Q\317C&\376;\034\033-Yd0=\216X\317m\002\033\020'L\367\255:\261\031\021\273\265\2551VL\277l\266\315\262y\320]\354n ~\352\021u\003\323\007K\2460H\002\007\002\b\357\202\004\023\214\037P\351\bh\n\315%\036\220\307D\244\204\204"
+	.string	"\222\017\306\004B3\230\343\003\201s\301#\035\341\221O\211)\347Sb\302\t\217\214\212\314\022zA\032\f\232\300\244$\336\rP\310\204\373\016\t@a\260\247dn\020$\274\013\022I>\030\277 Q\020h\212\320\003&\t\371z<`\004>\223I\203`/'x\344Axt\243\304k\361\353\345\222L!\320\024\301gA\260\207\223d\372\224z/x7If\020\006E2\2037\347\tyI\300#%&\022<J\"\230\021\034\231B\336\013\246%\263\205\320\f\232\033(1\035\360\342\367[q\224\363i"
+	.string	"4\203=\034\241\017\306\017\002\022\200B\237\004?@\236\013$\272\304c1\202\231\344\263\300|\361\001\257\005\3607\001\220\360h\001\0235\370\003\"\36520\227z-\224|\275%\340\003BS\t\310\024\362\222\230:\b2\231\346\n\337\257'\344-\001{ \370~\020"
+	.string	"\231H>\363E\217\203\235\003\375\307d\002\211\204\277\037\220(Gw\244\036\320\364\231J\365'\214\0240J1\302\315S\250(\241\242\204\356)T\024\025\2510*\2527*\302\t\217\202\035\230K=a\025\036\245\020\372z0n\314#3\351\227\201\316S$\241\340\225\340\031\245 \001\300\031`"
+	.string	"\002\020\035\260\240\240\"\221"
+	.ascii	"\232L\246\371\001\321\257G\344\353\361\226\210\220\200A\"\022"
+	.ascii	"\002`\271\262K\203\202\226\r\026\213\342\211\272a\225\306\264"
+	.ascii	"\236 t\006\373\031\214\257\320\241Ow\225\325X\037\243\022\330"
+	.ascii	"mys\202\206\351\016\252%\203\353\006\252ZS`\036g!\253d\036\374"
+	.ascii	"\0254\345\034\346\274P\303\256\r\020\033TL\275n\236\256h\354"
+	.ascii	"\300\364\271\034\365&\222\360\022&a\212X\340\"Zl+\260\225\230"
+	.ascii	"\266-\256\302\\L\205\273V\311Kfr\036\302*<\210\237x\311X\214"
+	.ascii	"d\323\210"
+	.string	"8\240\265\2666\374\034\201\t\250a,\307\030432\"#2\222$\3511\005\2040(\245\274\001\021`)\263jH\322$\315\001\"S\005\205\3418\331-\r'B\347\177O\003\374,\017\352\274\001\262X\267\251D\225\360\345!\343nT\211\241;\335\211i2\221\222!\356\351\326\326\243\370F\302\372\332\256\347~l\321\227\327)^>/\311\023\264t\003\r#e\266qR\215\255L]\332"
+	.string	"\325\032xx\357\005\276\301\337\214\332F\305\341\340i\240\225N\265\327Nz\003*\007\030\240(\245\r\316\304\305\354Y\200\036Y\331\216\300\341\346\234\336sW\300\255,\033*\251iDT\232,Nu,\036\013\027]\0248q\017H\025\351L\003E\244\245\035X\f\223\301\201\346\013\035\252\3255Z\253\"\325)\203T\263\237\335*u\375\260^U\312\237\006\020\270\300\026m\347\205\255\204\214V"
+	.ascii	"9$Vw\242\254\200\374g\013\247\377\250\243s\311s=\317\317}U\244"
+	.ascii	"5\354\221\236yz\231t\364\340\376_5\206\325\"\007\0307\330:\365"
+	.ascii	"\023r\366\370K\30102M\030\177>\366\375\020\021\254z\rq\205\322"
+	.ascii	"\254!\325\2231\206\036j\323{g0\304\177\331_0\202\331\021V.\227"
+	.ascii	"\343\022\022f;\341\020M.X\230\374\024el2s\374N\376\241j\017j"
+	.ascii	"\t\334\034\314\224\270\240\007@\352\343q\361\004\034\223\357"
+	.ascii	"\244u\236\230%I\f\201\004\316\267\220v\346Cw\023\001*\036\034"
+	.ascii	"Q\035\270\374Dl]\327\267\365p\223(\037-\316\371DMv\r\260\240"
+	.ascii	"\326\373\234\3719\262M}\252%(%\031\352\241I\200!\256\375$3\033"
+	.ascii	"\310\346\363M\b\314\\\220D5,\360n\320d\2122i\022\347df\345\254"
+	.ascii	"\007g\"\220\253%\233Z\324S\211R\252\307\203\331\360>bm\002\305"
+	.ascii	"V\034\205A\027\374>\340\356\013\216\330\272\337Z\347\371\016"
+	.ascii	"u\260\353\367Iy\262]\346\303\324a\272$\230\265Mr\267\300N\334"
+	.ascii	"H\335\033\205\254\207N\235x7\327\226\253"
+	.text
+	.section	.gnu.lto_.symtab.95f5f3ba48df2381,"e",@progbits
+	.string	"beeper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316"
+	.string	""
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321"
+	.string	""
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"beeperUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331"
+	.string	""
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336"
+	.string	""
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342"
+	.string	""
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"isBeeperOn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_beeperDevConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"beeperDevConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"beeperDevConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.95f5f3ba48df2381,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
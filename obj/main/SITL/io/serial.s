@@ -0,0 +1,13321 @@
+	.file	"serial.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/target/SITL/target.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/drivers/serial.h"
+	.file 8 "./src/main/io/serial.h"
+	.file 9 "./src/main/io/serial.c"
+	.file 10 "./src/main/fc/cli.h"
+	.file 11 "./src/main/drivers/system.h"
+	.file 12 "./src/main/drivers/serial_uart.h"
+	.file 13 "./src/main/telemetry/telemetry.h"
+	.file 14 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	serial.c.4c550864
+	.weak	serial.c.4c550864
+serial.c.4c550864:
+	.long	0xf7c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF1772
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1520
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1521
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1522
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1523
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1524
+	.uleb128 0x5
+	.long	.LASF1526
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1525
+	.uleb128 0x5
+	.long	.LASF1527
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1528
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1529
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1530
+	.uleb128 0x5
+	.long	.LASF1531
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xb
+	.long	0x87
+	.uleb128 0x23
+	.long	0x87
+	.uleb128 0x5
+	.long	.LASF1532
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x5
+	.long	.LASF1533
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0xb
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF1534
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x24
+	.byte	0x8
+	.byte	0x4
+	.byte	0x94
+	.byte	0x9
+	.long	0xdd
+	.uleb128 0x2
+	.long	.LASF1543
+	.byte	0x4
+	.byte	0x95
+	.byte	0xb
+	.long	0x7e
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1535
+	.byte	0x4
+	.byte	0x96
+	.byte	0x3
+	.long	0xc6
+	.uleb128 0x5
+	.long	.LASF1536
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0x9d
+	.uleb128 0x11
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x124
+	.uleb128 0xe
+	.long	.LASF1537
+	.value	0xfff
+	.uleb128 0xe
+	.long	.LASF1538
+	.value	0xf000
+	.uleb128 0xe
+	.long	.LASF1539
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1541
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1542
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xf
+	.long	0x130
+	.uleb128 0xf
+	.long	0x140
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x25
+	.byte	0x8
+	.byte	0x5
+	.byte	0x35
+	.byte	0x5
+	.long	0x15f
+	.uleb128 0x1a
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0x1a
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x15f
+	.byte	0
+	.uleb128 0x4
+	.long	0x124
+	.uleb128 0x10
+	.long	.LASF1613
+	.byte	0x20
+	.byte	0x5
+	.byte	0x30
+	.byte	0x10
+	.long	0x1b1
+	.uleb128 0x1b
+	.string	"pgn"
+	.byte	0x31
+	.byte	0xb
+	.long	0xe9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1544
+	.byte	0x5
+	.byte	0x32
+	.byte	0xe
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1545
+	.byte	0x5
+	.byte	0x33
+	.byte	0xe
+	.long	0x1b1
+	.byte	0x8
+	.uleb128 0x1b
+	.string	"ptr"
+	.byte	0x34
+	.byte	0xf
+	.long	0x1b6
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1546
+	.byte	0x5
+	.byte	0x38
+	.byte	0x7
+	.long	0x140
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0x87
+	.uleb128 0x4
+	.long	0x1b1
+	.uleb128 0x5
+	.long	.LASF1547
+	.byte	0x5
+	.byte	0x39
+	.byte	0x3
+	.long	0x164
+	.uleb128 0xb
+	.long	0x1bb
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1548
+	.uleb128 0xf
+	.long	0x1e3
+	.uleb128 0x3
+	.long	0x1e3
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x93
+	.uleb128 0x4
+	.long	0x1d3
+	.uleb128 0x11
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x314
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1599
+	.long	0x30
+	.byte	0x16
+	.long	0x335
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1599
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x3
+	.long	0x314
+	.uleb128 0x1c
+	.long	.LASF1600
+	.long	0x30
+	.byte	0x1c
+	.long	0x38c
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1600
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x3
+	.long	0x341
+	.uleb128 0x5
+	.long	.LASF1611
+	.byte	0x7
+	.byte	0x31
+	.byte	0x10
+	.long	0x3a4
+	.uleb128 0x4
+	.long	0x3a9
+	.uleb128 0xf
+	.long	0x3b4
+	.uleb128 0x3
+	.long	0x9d
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1612
+	.byte	0x7
+	.byte	0x32
+	.byte	0x10
+	.long	0x1e8
+	.uleb128 0x10
+	.long	.LASF1614
+	.byte	0x50
+	.byte	0x7
+	.byte	0x34
+	.byte	0x10
+	.long	0x491
+	.uleb128 0x2
+	.long	.LASF1615
+	.byte	0x7
+	.byte	0x36
+	.byte	0x24
+	.long	0x540
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1616
+	.byte	0x7
+	.byte	0x38
+	.byte	0xd
+	.long	0x87
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1617
+	.byte	0x7
+	.byte	0x39
+	.byte	0x10
+	.long	0x335
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1618
+	.byte	0x7
+	.byte	0x3a
+	.byte	0x13
+	.long	0x38c
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1619
+	.byte	0x7
+	.byte	0x3c
+	.byte	0xe
+	.long	0xa9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1620
+	.byte	0x7
+	.byte	0x3e
+	.byte	0xe
+	.long	0xa9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1621
+	.byte	0x7
+	.byte	0x3f
+	.byte	0xe
+	.long	0xa9
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1622
+	.byte	0x7
+	.byte	0x40
+	.byte	0x17
+	.long	0x545
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1623
+	.byte	0x7
+	.byte	0x41
+	.byte	0x17
+	.long	0x545
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1624
+	.byte	0x7
+	.byte	0x42
+	.byte	0xe
+	.long	0xa9
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1625
+	.byte	0x7
+	.byte	0x43
+	.byte	0xe
+	.long	0xa9
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF1626
+	.byte	0x7
+	.byte	0x44
+	.byte	0xe
+	.long	0xa9
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1627
+	.byte	0x7
+	.byte	0x45
+	.byte	0xe
+	.long	0xa9
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1628
+	.byte	0x7
+	.byte	0x47
+	.byte	0x1e
+	.long	0x398
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1629
+	.byte	0x7
+	.byte	0x48
+	.byte	0x23
+	.long	0x3b4
+	.byte	0x48
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1630
+	.byte	0x60
+	.byte	0x7
+	.byte	0x5a
+	.byte	0x8
+	.long	0x53b
+	.uleb128 0x2
+	.long	.LASF1631
+	.byte	0x7
+	.byte	0x5b
+	.byte	0xc
+	.long	0x570
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1632
+	.byte	0x7
+	.byte	0x5d
+	.byte	0x10
+	.long	0x589
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1633
+	.byte	0x7
+	.byte	0x5e
+	.byte	0x10
+	.long	0x589
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1634
+	.byte	0x7
+	.byte	0x60
+	.byte	0xf
+	.long	0x59d
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1635
+	.byte	0x7
+	.byte	0x63
+	.byte	0xc
+	.long	0x5b2
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1636
+	.byte	0x7
+	.byte	0x65
+	.byte	0xb
+	.long	0x5c6
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1637
+	.byte	0x7
+	.byte	0x67
+	.byte	0xc
+	.long	0x5db
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1638
+	.byte	0x7
+	.byte	0x69
+	.byte	0xc
+	.long	0x5fb
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1639
+	.byte	0x7
+	.byte	0x6b
+	.byte	0xc
+	.long	0x60b
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1640
+	.byte	0x7
+	.byte	0x6c
+	.byte	0xc
+	.long	0x60b
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1641
+	.byte	0x7
+	.byte	0x6f
+	.byte	0xb
+	.long	0x629
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF1642
+	.byte	0x7
+	.byte	0x71
+	.byte	0xb
+	.long	0x642
+	.byte	0x58
+	.byte	0
+	.uleb128 0xb
+	.long	0x491
+	.uleb128 0x4
+	.long	0x53b
+	.uleb128 0x4
+	.long	0x98
+	.uleb128 0x5
+	.long	.LASF1643
+	.byte	0x7
+	.byte	0x49
+	.byte	0x3
+	.long	0x3c0
+	.uleb128 0xb
+	.long	0x54a
+	.uleb128 0xf
+	.long	0x56b
+	.uleb128 0x3
+	.long	0x56b
+	.uleb128 0x3
+	.long	0x87
+	.byte	0
+	.uleb128 0x4
+	.long	0x54a
+	.uleb128 0x4
+	.long	0x55b
+	.uleb128 0x14
+	.long	0xa9
+	.long	0x584
+	.uleb128 0x3
+	.long	0x584
+	.byte	0
+	.uleb128 0x4
+	.long	0x556
+	.uleb128 0x4
+	.long	0x575
+	.uleb128 0x14
+	.long	0x87
+	.long	0x59d
+	.uleb128 0x3
+	.long	0x56b
+	.byte	0
+	.uleb128 0x4
+	.long	0x58e
+	.uleb128 0xf
+	.long	0x5b2
+	.uleb128 0x3
+	.long	0x56b
+	.uleb128 0x3
+	.long	0xa9
+	.byte	0
+	.uleb128 0x4
+	.long	0x5a2
+	.uleb128 0x14
+	.long	0x1cc
+	.long	0x5c6
+	.uleb128 0x3
+	.long	0x584
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b7
+	.uleb128 0xf
+	.long	0x5db
+	.uleb128 0x3
+	.long	0x56b
+	.uleb128 0x3
+	.long	0x335
+	.byte	0
+	.uleb128 0x4
+	.long	0x5cb
+	.uleb128 0xf
+	.long	0x5f5
+	.uleb128 0x3
+	.long	0x56b
+	.uleb128 0x3
+	.long	0x5f5
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x5fa
+	.uleb128 0x26
+	.uleb128 0x4
+	.long	0x5e0
+	.uleb128 0xf
+	.long	0x60b
+	.uleb128 0x3
+	.long	0x56b
+	.byte	0
+	.uleb128 0x4
+	.long	0x600
+	.uleb128 0x14
+	.long	0x64
+	.long	0x629
+	.uleb128 0x3
+	.long	0x56b
+	.uleb128 0x3
+	.long	0x1b1
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x610
+	.uleb128 0x14
+	.long	0x1cc
+	.long	0x642
+	.uleb128 0x3
+	.long	0x56b
+	.uleb128 0x3
+	.long	0x3b4
+	.byte	0
+	.uleb128 0x4
+	.long	0x62e
+	.uleb128 0x4
+	.long	0xdd
+	.uleb128 0x11
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x1a
+	.long	0x66b
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1647
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x3
+	.long	0x64c
+	.uleb128 0x11
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x20
+	.long	0x6dd
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x80
+	.uleb128 0xe
+	.long	.LASF1657
+	.value	0x200
+	.uleb128 0xe
+	.long	.LASF1658
+	.value	0x400
+	.uleb128 0xe
+	.long	.LASF1659
+	.value	0x800
+	.uleb128 0xe
+	.long	.LASF1660
+	.value	0x1000
+	.uleb128 0xe
+	.long	.LASF1661
+	.value	0x2000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1662
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x3
+	.long	0x677
+	.uleb128 0x11
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x31
+	.long	0x756
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1671
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1675
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1676
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1677
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1678
+	.byte	0xf
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1679
+	.byte	0x8
+	.byte	0x42
+	.byte	0x3
+	.long	0x6e9
+	.uleb128 0x15
+	.long	0xb5
+	.long	0x76d
+	.uleb128 0x27
+	.byte	0
+	.uleb128 0xb
+	.long	0x762
+	.uleb128 0x16
+	.long	.LASF1693
+	.byte	0x8
+	.byte	0x44
+	.byte	0x17
+	.long	0x76d
+	.uleb128 0x11
+	.byte	0x5
+	.long	0x64
+	.byte	0x8
+	.byte	0x47
+	.long	0x7d3
+	.uleb128 0x28
+	.long	.LASF1680
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF1681
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1683
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1684
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1685
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1687
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1692
+	.byte	0x8
+	.byte	0x54
+	.byte	0x3
+	.long	0x77e
+	.uleb128 0xb
+	.long	0x7d3
+	.uleb128 0x15
+	.long	0x7df
+	.long	0x7f4
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0xb
+	.long	0x7e4
+	.uleb128 0x16
+	.long	.LASF1694
+	.byte	0x8
+	.byte	0x56
+	.byte	0x25
+	.long	0x7f4
+	.uleb128 0x10
+	.long	.LASF1695
+	.byte	0x18
+	.byte	0x8
+	.byte	0x5d
+	.byte	0x10
+	.long	0x83a
+	.uleb128 0x2
+	.long	.LASF1616
+	.byte	0x8
+	.byte	0x5e
+	.byte	0x1c
+	.long	0x7d3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0x8
+	.byte	0x5f
+	.byte	0x13
+	.long	0x56b
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1697
+	.byte	0x8
+	.byte	0x60
+	.byte	0x1a
+	.long	0x6dd
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1698
+	.byte	0x8
+	.byte	0x61
+	.byte	0x3
+	.long	0x805
+	.uleb128 0xb
+	.long	0x83a
+	.uleb128 0x10
+	.long	.LASF1699
+	.byte	0xc
+	.byte	0x8
+	.byte	0x69
+	.byte	0x10
+	.long	0x8a7
+	.uleb128 0x2
+	.long	.LASF1700
+	.byte	0x8
+	.byte	0x6a
+	.byte	0xe
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1616
+	.byte	0x8
+	.byte	0x6b
+	.byte	0x1c
+	.long	0x7d3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1701
+	.byte	0x8
+	.byte	0x6c
+	.byte	0xd
+	.long	0x87
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1702
+	.byte	0x8
+	.byte	0x6d
+	.byte	0xd
+	.long	0x87
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1703
+	.byte	0x8
+	.byte	0x6e
+	.byte	0xd
+	.long	0x87
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1704
+	.byte	0x8
+	.byte	0x6f
+	.byte	0xd
+	.long	0x87
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1705
+	.byte	0x8
+	.byte	0x70
+	.byte	0x3
+	.long	0x84b
+	.uleb128 0xb
+	.long	0x8a7
+	.uleb128 0x10
+	.long	.LASF1706
+	.byte	0x64
+	.byte	0x8
+	.byte	0x72
+	.byte	0x10
+	.long	0x8ed
+	.uleb128 0x2
+	.long	.LASF1707
+	.byte	0x8
+	.byte	0x73
+	.byte	0x18
+	.long	0x8ed
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1708
+	.byte	0x8
+	.byte	0x74
+	.byte	0xe
+	.long	0x9d
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1709
+	.byte	0x8
+	.byte	0x75
+	.byte	0xd
+	.long	0x87
+	.byte	0x62
+	.byte	0
+	.uleb128 0x15
+	.long	0x8a7
+	.long	0x8fd
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1710
+	.byte	0x8
+	.byte	0x76
+	.byte	0x3
+	.long	0x8b8
+	.uleb128 0xb
+	.long	0x8fd
+	.uleb128 0x16
+	.long	.LASF1711
+	.byte	0x8
+	.byte	0x78
+	.byte	0x17
+	.long	0x8fd
+	.uleb128 0x5
+	.long	.LASF1712
+	.byte	0x8
+	.byte	0x7a
+	.byte	0xe
+	.long	0x926
+	.uleb128 0xf
+	.long	0x931
+	.uleb128 0x3
+	.long	0x87
+	.byte	0
+	.uleb128 0x4
+	.long	0x3c0
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1713
+	.uleb128 0x15
+	.long	0x83a
+	.long	0x94d
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1714
+	.byte	0x3b
+	.byte	0x1a
+	.long	0x93d
+	.uleb128 0x1d
+	.long	0x7f9
+	.byte	0x3d
+	.byte	0x1e
+	.uleb128 0x9
+	.long	.LASF1715
+	.byte	0x61
+	.byte	0x10
+	.long	0x87
+	.uleb128 0x15
+	.long	0xb5
+	.long	0x97a
+	.uleb128 0x17
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0xb
+	.long	0x96a
+	.uleb128 0x29
+	.long	0x772
+	.byte	0x9
+	.byte	0x63
+	.byte	0x10
+	.long	0x97a
+	.uleb128 0x1d
+	.long	0x90e
+	.byte	0x68
+	.byte	0x46
+	.uleb128 0x16
+	.long	.LASF1716
+	.byte	0x9
+	.byte	0x68
+	.byte	0x75
+	.long	0x1c7
+	.uleb128 0x2a
+	.long	0x992
+	.byte	0x9f
+	.uleb128 0x10
+	.long	.LASF1717
+	.byte	0x1
+	.byte	0x9
+	.byte	0xb2
+	.byte	0x10
+	.long	0x9bf
+	.uleb128 0x2
+	.long	.LASF1718
+	.byte	0x9
+	.byte	0xb3
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1719
+	.byte	0x9
+	.byte	0xb4
+	.byte	0x3
+	.long	0x9a4
+	.uleb128 0x9
+	.long	.LASF1720
+	.byte	0xb6
+	.byte	0x24
+	.long	0x9bf
+	.uleb128 0x10
+	.long	.LASF1721
+	.byte	0x1
+	.byte	0x9
+	.byte	0xcb
+	.byte	0x10
+	.long	0x9f1
+	.uleb128 0x2
+	.long	.LASF1718
+	.byte	0x9
+	.byte	0xcc
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1722
+	.byte	0x9
+	.byte	0xcd
+	.byte	0x3
+	.long	0x9d6
+	.uleb128 0x9
+	.long	.LASF1723
+	.byte	0xdc
+	.byte	0x24
+	.long	0x9f1
+	.uleb128 0x19
+	.long	.LASF1631
+	.byte	0x7
+	.byte	0x74
+	.long	0xa1e
+	.uleb128 0x3
+	.long	0x56b
+	.uleb128 0x3
+	.long	0x87
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1634
+	.byte	0x7
+	.byte	0x78
+	.byte	0x9
+	.long	0x87
+	.long	0xa34
+	.uleb128 0x3
+	.long	0x56b
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1724
+	.byte	0x7
+	.byte	0x75
+	.byte	0xa
+	.long	0xa9
+	.long	0xa4a
+	.uleb128 0x3
+	.long	0x584
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1741
+	.byte	0xb
+	.byte	0x2e
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1725
+	.byte	0xa
+	.byte	0x1a
+	.long	0xa63
+	.uleb128 0x3
+	.long	0x931
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1636
+	.byte	0x7
+	.byte	0x7d
+	.byte	0x5
+	.long	0x1cc
+	.long	0xa79
+	.uleb128 0x3
+	.long	0x584
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1726
+	.byte	0xb
+	.byte	0x19
+	.long	0xa8a
+	.uleb128 0x3
+	.long	0xa9
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1727
+	.byte	0xc
+	.byte	0x4e
+	.byte	0xf
+	.long	0x56b
+	.long	0xab4
+	.uleb128 0x3
+	.long	0x647
+	.uleb128 0x3
+	.long	0x398
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x335
+	.uleb128 0x3
+	.long	0x38c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1728
+	.byte	0xd
+	.byte	0x3e
+	.byte	0x5
+	.long	0x1cc
+	.long	0xaca
+	.uleb128 0x3
+	.long	0xaca
+	.byte	0
+	.uleb128 0x4
+	.long	0x8b3
+	.uleb128 0x12
+	.long	.LASF1729
+	.byte	0xe
+	.byte	0x3d
+	.byte	0xe
+	.long	0x7e
+	.long	0xaef
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0xba
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1735
+	.value	0x207
+	.long	0xb47
+	.uleb128 0x6
+	.long	.LASF1730
+	.value	0x207
+	.byte	0x26
+	.long	0x56b
+	.uleb128 0x6
+	.long	.LASF1731
+	.value	0x207
+	.byte	0x3a
+	.long	0x56b
+	.uleb128 0x6
+	.long	.LASF1732
+	.value	0x207
+	.byte	0x51
+	.long	0xb47
+	.uleb128 0x6
+	.long	.LASF1733
+	.value	0x207
+	.byte	0x68
+	.long	0xb47
+	.uleb128 0x2c
+	.long	0xb3a
+	.uleb128 0x1e
+	.string	"c"
+	.value	0x21e
+	.byte	0x15
+	.long	0x87
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1e
+	.string	"c"
+	.value	0x225
+	.byte	0x16
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x91a
+	.uleb128 0x2d
+	.long	.LASF1773
+	.byte	0x9
+	.value	0x1fd
+	.byte	0xd
+	.long	0xb66
+	.uleb128 0x6
+	.long	.LASF1734
+	.value	0x1fd
+	.byte	0x21
+	.long	0x87
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1736
+	.value	0x1ed
+	.long	0xb8a
+	.uleb128 0x6
+	.long	.LASF1696
+	.value	0x1ed
+	.byte	0x2d
+	.long	0x56b
+	.uleb128 0x6
+	.long	.LASF1737
+	.value	0x1ed
+	.byte	0x41
+	.long	0x87
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1738
+	.value	0x1e6
+	.long	0xba2
+	.uleb128 0x6
+	.long	.LASF1696
+	.value	0x1e6
+	.byte	0x3a
+	.long	0x56b
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1739
+	.value	0x1dc
+	.byte	0x5
+	.long	0x1cc
+	.long	0xbcd
+	.uleb128 0x6
+	.long	.LASF1616
+	.value	0x1dc
+	.byte	0x32
+	.long	0x7d3
+	.uleb128 0x8
+	.uleb128 0xa
+	.long	.LASF1740
+	.value	0x1de
+	.byte	0x12
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF1742
+	.byte	0x9
+	.value	0x1d7
+	.byte	0x9
+	.long	0x87
+	.uleb128 0x13
+	.long	.LASF1743
+	.value	0x1cd
+	.long	0xc00
+	.uleb128 0x6
+	.long	.LASF1616
+	.value	0x1cd
+	.byte	0x2e
+	.long	0x7d3
+	.uleb128 0x8
+	.uleb128 0xa
+	.long	.LASF1740
+	.value	0x1cf
+	.byte	0x12
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1744
+	.value	0x1ab
+	.long	0xc32
+	.uleb128 0x6
+	.long	.LASF1745
+	.value	0x1ab
+	.byte	0x15
+	.long	0x1cc
+	.uleb128 0x6
+	.long	.LASF1746
+	.value	0x1ab
+	.byte	0x3f
+	.long	0x7d3
+	.uleb128 0x8
+	.uleb128 0xa
+	.long	.LASF1740
+	.value	0x1b4
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1747
+	.value	0x19b
+	.long	0xc56
+	.uleb128 0x6
+	.long	.LASF1696
+	.value	0x19b
+	.byte	0x24
+	.long	0x56b
+	.uleb128 0xa
+	.long	.LASF1748
+	.value	0x19d
+	.byte	0x18
+	.long	0xc56
+	.byte	0
+	.uleb128 0x4
+	.long	0x83a
+	.uleb128 0x18
+	.long	.LASF1749
+	.value	0x13c
+	.byte	0xf
+	.long	0x56b
+	.long	0xccc
+	.uleb128 0x6
+	.long	.LASF1616
+	.value	0x13d
+	.byte	0x1c
+	.long	0x7d3
+	.uleb128 0x6
+	.long	.LASF1697
+	.value	0x13e
+	.byte	0x1a
+	.long	0x6dd
+	.uleb128 0x6
+	.long	.LASF1628
+	.value	0x13f
+	.byte	0x1e
+	.long	0x398
+	.uleb128 0x6
+	.long	.LASF1619
+	.value	0x140
+	.byte	0xe
+	.long	0xa9
+	.uleb128 0x6
+	.long	.LASF1617
+	.value	0x141
+	.byte	0x10
+	.long	0x335
+	.uleb128 0x6
+	.long	.LASF1618
+	.value	0x142
+	.byte	0x13
+	.long	0x38c
+	.uleb128 0xa
+	.long	.LASF1748
+	.value	0x14b
+	.byte	0x18
+	.long	0xc56
+	.uleb128 0xa
+	.long	.LASF1696
+	.value	0x151
+	.byte	0x13
+	.long	0x56b
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1750
+	.value	0x136
+	.byte	0x5
+	.long	0x1cc
+	.long	0xcf5
+	.uleb128 0x6
+	.long	.LASF1616
+	.value	0x136
+	.byte	0x35
+	.long	0x7d3
+	.uleb128 0xa
+	.long	.LASF1751
+	.value	0x138
+	.byte	0x19
+	.long	0xcf5
+	.byte	0
+	.uleb128 0x4
+	.long	0x8a7
+	.uleb128 0x18
+	.long	.LASF1752
+	.value	0x12b
+	.byte	0x15
+	.long	0xcf5
+	.long	0xd33
+	.uleb128 0x6
+	.long	.LASF1616
+	.value	0x12b
+	.byte	0x48
+	.long	0x7d3
+	.uleb128 0x8
+	.uleb128 0xa
+	.long	.LASF1740
+	.value	0x12d
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x8
+	.uleb128 0xa
+	.long	.LASF1751
+	.value	0x12e
+	.byte	0x1d
+	.long	0xcf5
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1753
+	.byte	0xfc
+	.byte	0x5
+	.long	0x1cc
+	.long	0xd82
+	.uleb128 0x7
+	.long	.LASF1754
+	.byte	0xfc
+	.byte	0x2f
+	.long	0xd82
+	.uleb128 0xa
+	.long	.LASF1755
+	.value	0x108
+	.byte	0xd
+	.long	0x87
+	.uleb128 0x8
+	.uleb128 0xa
+	.long	.LASF1740
+	.value	0x10a
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x8
+	.uleb128 0xa
+	.long	.LASF1756
+	.value	0x10b
+	.byte	0x23
+	.long	0xaca
+	.uleb128 0xa
+	.long	.LASF1757
+	.value	0x111
+	.byte	0x11
+	.long	0x87
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x909
+	.uleb128 0xc
+	.long	.LASF1758
+	.byte	0xe5
+	.byte	0xf
+	.long	0x56b
+	.long	0xdc7
+	.uleb128 0x7
+	.long	.LASF1700
+	.byte	0xe5
+	.byte	0x31
+	.long	0x9d
+	.uleb128 0x7
+	.long	.LASF1759
+	.byte	0xe5
+	.byte	0x54
+	.long	0x6dd
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF1751
+	.byte	0xe8
+	.byte	0x23
+	.long	0xaca
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF1748
+	.byte	0xeb
+	.byte	0x26
+	.long	0xdc7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x846
+	.uleb128 0xc
+	.long	.LASF1760
+	.byte	0xde
+	.byte	0xf
+	.long	0x56b
+	.long	0xdf2
+	.uleb128 0x7
+	.long	.LASF1700
+	.byte	0xde
+	.byte	0x2d
+	.long	0x9d
+	.uleb128 0x7
+	.long	.LASF1759
+	.byte	0xde
+	.byte	0x50
+	.long	0x6dd
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1761
+	.byte	0xd7
+	.byte	0x5
+	.long	0x1cc
+	.long	0xe23
+	.uleb128 0x7
+	.long	.LASF1756
+	.byte	0xd7
+	.byte	0x32
+	.long	0xaca
+	.uleb128 0x7
+	.long	.LASF1700
+	.byte	0xd7
+	.byte	0x47
+	.long	0x9d
+	.uleb128 0x7
+	.long	.LASF1759
+	.byte	0xd7
+	.byte	0x6a
+	.long	0x6dd
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1762
+	.byte	0xcf
+	.byte	0xf
+	.long	0x66b
+	.long	0xe49
+	.uleb128 0x7
+	.long	.LASF1756
+	.byte	0xcf
+	.byte	0x3e
+	.long	0xaca
+	.uleb128 0x7
+	.long	.LASF1697
+	.byte	0xcf
+	.byte	0x5f
+	.long	0x6dd
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1763
+	.byte	0xbf
+	.byte	0x15
+	.long	0xcf5
+	.long	0xe71
+	.uleb128 0x7
+	.long	.LASF1697
+	.byte	0xbf
+	.byte	0x43
+	.long	0x6dd
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF1751
+	.byte	0xc2
+	.byte	0x1d
+	.long	0xcf5
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1764
+	.byte	0xb8
+	.byte	0x15
+	.long	0xcf5
+	.long	0xe8c
+	.uleb128 0x7
+	.long	.LASF1697
+	.byte	0xb8
+	.byte	0x3f
+	.long	0x6dd
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1765
+	.byte	0xa7
+	.byte	0x14
+	.long	0xc56
+	.long	0xebf
+	.uleb128 0x7
+	.long	.LASF1696
+	.byte	0xa7
+	.byte	0x3c
+	.long	0x56b
+	.uleb128 0x9
+	.long	.LASF1740
+	.byte	0xa8
+	.byte	0xd
+	.long	0x87
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF1751
+	.byte	0xaa
+	.byte	0x1c
+	.long	0xc56
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1766
+	.byte	0x9b
+	.byte	0x14
+	.long	0xc56
+	.long	0xef2
+	.uleb128 0x7
+	.long	.LASF1616
+	.byte	0x9b
+	.byte	0x4b
+	.long	0x7d3
+	.uleb128 0x9
+	.long	.LASF1740
+	.byte	0x9d
+	.byte	0xd
+	.long	0x87
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF1751
+	.byte	0x9f
+	.byte	0x1c
+	.long	0xc56
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1767
+	.byte	0x91
+	.byte	0x5
+	.long	0x64
+	.long	0xf1a
+	.uleb128 0x7
+	.long	.LASF1616
+	.byte	0x91
+	.byte	0x3c
+	.long	0x7d3
+	.uleb128 0x8
+	.uleb128 0x9
+	.long	.LASF1740
+	.byte	0x93
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1768
+	.byte	0x85
+	.byte	0xc
+	.long	0x756
+	.long	0xf40
+	.uleb128 0x7
+	.long	.LASF1619
+	.byte	0x85
+	.byte	0x29
+	.long	0xa9
+	.uleb128 0x9
+	.long	.LASF1740
+	.byte	0x87
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF1769
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x6
+	.long	0xf64
+	.uleb128 0x7
+	.long	.LASF1770
+	.byte	0x6a
+	.byte	0x2d
+	.long	0xf64
+	.uleb128 0x8
+	.uleb128 0x30
+	.string	"i"
+	.byte	0x9
+	.byte	0x6e
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x8fd
+	.uleb128 0x1f
+	.long	.LASF1771
+	.byte	0x78
+	.byte	0xa2
+	.long	0xf64
+	.uleb128 0x1f
+	.long	.LASF1770
+	.byte	0x78
+	.byte	0x50
+	.long	0xd82
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 15 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.file 18 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 20 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 21 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 24 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 34 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 35 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x23
+	.file 36 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 37 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x25
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.file 38 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 39 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 40 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 41 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x29
+	.file 42 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2a
+	.file 43 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 44 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x4
+	.file 45 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 46 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.file 47 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 48 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 49 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1473
+	.byte	0x4
+	.file 50 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 51 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1477
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 52 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1505
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1506
+	.byte	0x4
+	.file 53 "./src/main/msp/msp_serial.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x35
+	.file 54 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1507
+	.byte	0x4
+	.file 55 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x37
+	.file 56 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1516
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1519
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF973
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF996
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1078
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1080
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1082
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1084
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1092
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1104
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1472
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1476
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_uart.h.26.d7df672ceb076edc577f28d9952e617b,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1494
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.23.95742be8daec10c1d662dd67b9ee58de,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1504
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.27.07521096acbd1fc23b5da89615487a6f,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1515
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF1774
+	.long	.LASF1775
+	.long	.LASF1776
+	.long	.LASF1777
+	.long	.LASF1778
+	.long	.LASF1779
+	.long	.LASF1780
+	.long	.LASF1781
+	.long	.LASF1782
+	.long	.LASF1783
+	.long	.LASF1784
+	.long	.LASF1785
+	.long	.LASF1786
+	.long	.LASF1787
+	.long	.LASF1788
+	.long	.LASF1789
+	.long	.LASF1790
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x39
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1791
+	.byte	0xd
+	.long	.LASF1792
+	.byte	0xd
+	.long	.LASF1793
+	.byte	0x11
+	.long	.LASF1794
+	.byte	0x8
+	.long	.LASF1795
+	.byte	0x3
+	.long	.LASF1796
+	.byte	0x4
+	.long	.LASF1797
+	.byte	0x4
+	.long	.LASF1797
+	.byte	0x6
+	.long	.LASF1798
+	.byte	0x6
+	.long	.LASF1799
+	.byte	0x5
+	.long	.LASF1800
+	.byte	0x4
+	.long	.LASF1801
+	.byte	0x4
+	.long	.LASF1802
+	.byte	0xa
+	.long	.LASF1803
+	.byte	0x10
+	.long	.LASF1804
+	.byte	0x10
+	.long	.LASF1805
+	.byte	0x11
+	.long	.LASF1806
+	.byte	0x11
+	.long	.LASF1806
+	.byte	0x10
+	.long	.LASF1807
+	.byte	0xd
+	.long	.LASF1808
+	.byte	0x10
+	.long	.LASF1809
+	.byte	0x10
+	.long	.LASF1810
+	.byte	0xd
+	.long	.LASF1811
+	.byte	0xd
+	.long	.LASF1812
+	.byte	0xf
+	.long	.LASF1813
+	.byte	0xd
+	.long	.LASF1814
+	.byte	0xe
+	.long	.LASF1815
+	.byte	0xe
+	.long	.LASF1816
+	.byte	0xd
+	.long	.LASF1817
+	.byte	0xd
+	.long	.LASF1818
+	.byte	0xd
+	.long	.LASF1819
+	.byte	0xd
+	.long	.LASF1820
+	.byte	0xc
+	.long	.LASF1821
+	.byte	0xc
+	.long	.LASF1822
+	.byte	0x10
+	.long	.LASF1823
+	.byte	0xb
+	.long	.LASF1824
+	.byte	0x9
+	.long	.LASF1825
+	.byte	0x9
+	.long	.LASF1826
+	.byte	0x1
+	.long	.LASF1827
+	.byte	0x2
+	.long	.LASF1828
+	.byte	0x3
+	.long	.LASF1829
+	.byte	0x5
+	.long	.LASF1830
+	.byte	0x4
+	.long	.LASF1831
+	.byte	0x4
+	.long	.LASF1832
+	.byte	0x4
+	.long	.LASF1833
+	.byte	0x4
+	.long	.LASF1834
+	.byte	0x4
+	.long	.LASF1835
+	.byte	0x4
+	.long	.LASF1836
+	.byte	0x4
+	.long	.LASF1837
+	.byte	0x4
+	.long	.LASF1838
+	.byte	0x4
+	.long	.LASF1839
+	.byte	0x4
+	.long	.LASF1840
+	.byte	0x4
+	.long	.LASF1841
+	.byte	0x7
+	.long	.LASF1842
+	.byte	0x2
+	.long	.LASF1843
+	.byte	0x7
+	.long	.LASF1844
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1464:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1100:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1194:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1757:
+	.string	"bitCount"
+.LASF1126:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1220:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1620:
+	.string	"rxBufferSize"
+.LASF1318:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF1709:
+	.string	"reboot_character"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_PPM"
+.LASF1238:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1637:
+	.string	"setMode"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1468:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1367:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF974:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1106:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1615:
+	.string	"vTable"
+.LASF1533:
+	.string	"uint32_t"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1548:
+	.string	"_Bool"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1085:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1760:
+	.string	"findSharedSerialPort"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1557:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1455:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1328:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1255:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF980:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF1601:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1157:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1107:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1391:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1337:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF996:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1651:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1752:
+	.string	"serialFindPortConfiguration"
+.LASF1096:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1460:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1034:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1432:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1170:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1304:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1485:
+	.string	"UART4_TX_BUFFER_SIZE 256"
+.LASF1554:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1467:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1532:
+	.string	"uint16_t"
+.LASF1160:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1470:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1019:
+	.string	"PG_RX_CONFIG 24"
+.LASF1679:
+	.string	"baudRate_e"
+.LASF1658:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1399:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1378:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF1297:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1489:
+	.string	"UART6_TX_BUFFER_SIZE 256"
+.LASF1366:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1124:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1167:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1093:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF1715:
+	.string	"serialPortCount"
+.LASF1405:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1280:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1342:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1030:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1246:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1233:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF969:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1316:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF984:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1303:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1119:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1484:
+	.string	"UART4_RX_BUFFER_SIZE 256"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1423:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1149:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1283:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1493:
+	.string	"UART8_TX_BUFFER_SIZE 256"
+.LASF1038:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1387:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1459:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1653:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1494:
+	.string	"UART_RX_FRAME_CHUNK_SIZE 64"
+.LASF1127:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1092:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF966:
+	.string	"BIT(x) (1 << (x))"
+.LASF1586:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1081:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF979:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1135:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1710:
+	.string	"serialConfig_t"
+.LASF1152:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1700:
+	.string	"functionMask"
+.LASF1286:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF883:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1639:
+	.string	"beginWrite"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1707:
+	.string	"portConfigs"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF1435:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1381:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1098:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1202:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1583:
+	.string	"OWNER_BARO_EXTI"
+.LASF1015:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF546:
+	.string	"__always_inline"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1596:
+	.string	"MODE_RX"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF898:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1264:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1560:
+	.string	"OWNER_SERIAL_TX"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF962:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1035:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1048:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1049:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1539:
+	.string	"PGR_SIZE_MASK"
+.LASF1205:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1677:
+	.string	"BAUD_2000000"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1642:
+	.string	"setRxFrameCallback"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1198:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1089:
+	.string	"IOCFG_AF_OD 0"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1321:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1646:
+	.string	"PORTSHARING_SHARED"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1361:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1434:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1584:
+	.string	"OWNER_USB"
+.LASF1740:
+	.string	"index"
+.LASF1166:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1066:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF1595:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1278:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1597:
+	.string	"MODE_TX"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1512:
+	.string	"MSP_PORT_MAX_HEADER_SIZE 8"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1497:
+	.string	"LED0_OFF do {} while(0)"
+.LASF990:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1343:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1010:
+	.string	"PG_PID_PROFILE 14"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1150:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1565:
+	.string	"OWNER_SONAR_ECHO"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF1732:
+	.string	"leftC"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1384:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1027:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1070:
+	.string	"PG_VTX_CONFIG 515"
+.LASF977:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1553:
+	.string	"OWNER_SERVO"
+.LASF1197:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1736:
+	.string	"serialEvaluateNonMspData"
+.LASF881:
+	.string	"ACC "
+.LASF1299:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF803:
+	.string	"USE_PWM "
+.LASF1414:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF1770:
+	.string	"serialConfig"
+.LASF1477:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1210:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1458:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF976:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1452:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1128:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1133:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1200:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1527:
+	.string	"__uint16_t"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1552:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1217:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1656:
+	.string	"FUNCTION_BLACKBOX"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1580:
+	.string	"OWNER_RX_SPI_CS"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1250:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1192:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1105:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1626:
+	.string	"txBufferHead"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1669:
+	.string	"BAUD_230400"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1617:
+	.string	"mode"
+.LASF1136:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1427:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1672:
+	.string	"BAUD_460800"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1738:
+	.string	"waitForSerialPortToFinishTransmitting"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1675:
+	.string	"BAUD_1000000"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1253:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF960:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1258:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1678:
+	.string	"BAUD_2470000"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1445:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1652:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1520:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1077:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1080:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF978:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1054:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1447:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1028:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1333:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1011:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1713:
+	.string	"float"
+.LASF1616:
+	.string	"identifier"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1006:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF982:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1424:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1406:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1222:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1638:
+	.string	"writeBuf"
+.LASF879:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1061:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1556:
+	.string	"OWNER_ADC_BATT"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1661:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1087:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1078:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1082:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF1613:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1174:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1747:
+	.string	"closeSerialPort"
+.LASF1640:
+	.string	"endWrite"
+.LASF1648:
+	.string	"FUNCTION_NONE"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1179:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1541:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1097:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1592:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1409:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1749:
+	.string	"openSerialPort"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1240:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1267:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1245:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1334:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1313:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1665:
+	.string	"BAUD_19200"
+.LASF1574:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1673:
+	.string	"BAUD_500000"
+.LASF1737:
+	.string	"receivedChar"
+.LASF1376:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1526:
+	.string	"__uint8_t"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1219:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1676:
+	.string	"BAUD_1500000"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1295:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1211:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF1129:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1181:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1671:
+	.string	"BAUD_400000"
+.LASF1537:
+	.string	"PGR_PGN_MASK"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1635:
+	.string	"serialSetBaudRate"
+.LASF1771:
+	.string	"serialConfigMutable"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1324:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1450:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1379:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1033:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF1628:
+	.string	"rxCallback"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1462:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1043:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1702:
+	.string	"gps_baudrateIndex"
+.LASF1068:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1543:
+	.string	"test"
+.LASF1498:
+	.string	"LED0_ON do {} while(0)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1421:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1184:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1622:
+	.string	"rxBuffer"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1621:
+	.string	"txBufferSize"
+.LASF1605:
+	.string	"SERIAL_PARITY_NO"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1585:
+	.string	"OWNER_USB_DETECT"
+.LASF1411:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1301:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1084:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1544:
+	.string	"size"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1265:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1053:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1731:
+	.string	"right"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1270:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1454:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1139:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1589:
+	.string	"OWNER_INVERTER"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF1534:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1279:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1569:
+	.string	"OWNER_SPI_MOSI"
+.LASF1433:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1542:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1531:
+	.string	"uint8_t"
+.LASF1178:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1712:
+	.string	"serialConsumer"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF1282:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF964:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1492:
+	.string	"UART8_RX_BUFFER_SIZE 256"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF1047:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1285:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1079:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1490:
+	.string	"UART7_RX_BUFFER_SIZE 256"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1773:
+	.string	"nopConsumer"
+.LASF1515:
+	.string	"MSP_PUSH_MAX_RATE_HZ 200"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1075:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1372:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1291:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1426:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1686:
+	.string	"SERIAL_PORT_USART6"
+.LASF822:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1756:
+	.string	"portConfig"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1099:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1684:
+	.string	"SERIAL_PORT_UART4"
+.LASF1685:
+	.string	"SERIAL_PORT_UART5"
+.LASF1662:
+	.string	"serialPortFunction_e"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1723:
+	.string	"findSharedSerialPortState"
+.LASF949:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1201:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF1389:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1130:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1229:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1013:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF968:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1021:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF995:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF985:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1145:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1168:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF1517:
+	.string	"BAUD_RATE_COUNT (sizeof(baudRates) / sizeof(baudRates[0]))"
+.LASF1624:
+	.string	"rxBufferHead"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1214:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1725:
+	.string	"cliEnter"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF1382:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1069:
+	.string	"PG_VCD_CONFIG 514"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF1363:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1345:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1728:
+	.string	"telemetryCheckRxPortShared"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1408:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1164:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1519:
+	.string	"ALL_FUNCTIONS_SHARABLE_WITH_MSP (FUNCTION_BLACKBOX | ALL_TELEMETRY_FUNCTIONS_MASK)"
+.LASF1742:
+	.string	"serialGetAvailablePortCount"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1148:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1664:
+	.string	"BAUD_9600"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1743:
+	.string	"serialRemovePort"
+.LASF1274:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF1103:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1067:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1730:
+	.string	"left"
+.LASF1564:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1659:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1545:
+	.string	"address"
+.LASF1402:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1654:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1151:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1091:
+	.string	"IOCFG_IPU 0"
+.LASF1516:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF994:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1294:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1273:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1456:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1566:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF983:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF499:
+	.string	"__PMT"
+.LASF1703:
+	.string	"blackbox_baudrateIndex"
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1704:
+	.string	"telemetry_baudrateIndex"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF956:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1101:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1300:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1045:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1670:
+	.string	"BAUD_250000"
+.LASF1649:
+	.string	"FUNCTION_MSP"
+.LASF1549:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1400:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1540:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1003:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1306:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1177:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1140:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1514:
+	.string	"MSP_PUSH_MAX_COMMANDS 8"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1147:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1727:
+	.string	"uartOpen"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1249:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF1002:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1755:
+	.string	"mspPortCount"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1331:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF1717:
+	.string	"findSerialPortConfigState_s"
+.LASF1719:
+	.string	"findSerialPortConfigState_t"
+.LASF1110:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1310:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1772:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1495:
+	.string	"LED_NUMBER 3"
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF981:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1143:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1729:
+	.string	"memset"
+.LASF1131:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1502:
+	.string	"LED2_TOGGLE do {} while(0)"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1277:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1109:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1420:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1193:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1351:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF997:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1393:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1146:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1141:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF1491:
+	.string	"UART7_TX_BUFFER_SIZE 256"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF802:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1122:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1598:
+	.string	"MODE_RXTX"
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1645:
+	.string	"PORTSHARING_NOT_SHARED"
+.LASF1511:
+	.string	"MSP_PORT_STREAM_LIMIT 0xffff"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1231:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1196:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1546:
+	.string	"reset"
+.LASF1183:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1480:
+	.string	"UART2_RX_BUFFER_SIZE 256"
+.LASF1004:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF1207:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF957:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1572:
+	.string	"OWNER_SDCARD"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1451:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1044:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1298:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1521:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1481:
+	.string	"UART2_TX_BUFFER_SIZE 256"
+.LASF1524:
+	.string	"signed char"
+.LASF975:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1199:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1162:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1448:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1142:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1012:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1041:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1051:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1602:
+	.string	"SERIAL_INVERTED"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1357:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1276:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF1175:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1375:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1496:
+	.string	"LED0_TOGGLE do {} while(0)"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1108:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1113:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1475:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1020:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1735:
+	.string	"serialPassthrough"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1690:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1691:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1354:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1594:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1766:
+	.string	"findSerialPortUsageByIdentifier"
+.LASF1024:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1655:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF1711:
+	.string	"serialConfig_System"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1739:
+	.string	"serialIsPortAvailable"
+.LASF1074:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1587:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1449:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1538:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1156:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1415:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1029:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1083:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1062:
+	.string	"PG_PPM_CONFIG 507"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1117:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1017:
+	.string	"PG_IMU_CONFIG 22"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1154:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1191:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1132:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF1697:
+	.string	"function"
+.LASF971:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1261:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1026:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1696:
+	.string	"serialPort"
+.LASF1608:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1309:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1123:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1241:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1689:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF929:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1724:
+	.string	"serialRxBytesWaiting"
+.LASF991:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF821:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1681:
+	.string	"SERIAL_PORT_USART1"
+.LASF1682:
+	.string	"SERIAL_PORT_USART2"
+.LASF1683:
+	.string	"SERIAL_PORT_USART3"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1165:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1535:
+	.string	"USART_TypeDef"
+.LASF1687:
+	.string	"SERIAL_PORT_USART7"
+.LASF1688:
+	.string	"SERIAL_PORT_USART8"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1632:
+	.string	"serialTotalRxWaiting"
+.LASF1501:
+	.string	"LED1_ON do {} while(0)"
+.LASF1104:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1023:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1397:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1529:
+	.string	"long int"
+.LASF1226:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1016:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1244:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1562:
+	.string	"OWNER_PINDEBUG"
+.LASF1171:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1438:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1754:
+	.string	"serialConfigToCheck"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1483:
+	.string	"UART3_TX_BUFFER_SIZE 256"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1508:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF1759:
+	.string	"sharedWithFunction"
+.LASF1666:
+	.string	"BAUD_38400"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1487:
+	.string	"UART5_TX_BUFFER_SIZE 256"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1271:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1716:
+	.string	"serialConfig_Registry"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1007:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF963:
+	.string	"EXPAND_I(x) x"
+.LASF1247:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1204:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1612:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1625:
+	.string	"rxBufferTail"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1042:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1636:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1059:
+	.string	"PG_PID_CONFIG 504"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF522:
+	.string	"__flexarr []"
+.LASF813:
+	.string	"LED_STRIP "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1039:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF993:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF999:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1187:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1236:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1262:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1563:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1040:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1748:
+	.string	"serialPortUsage"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1370:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1346:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF1114:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1530:
+	.string	"char"
+.LASF1488:
+	.string	"UART6_RX_BUFFER_SIZE 256"
+.LASF1243:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1180:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1327:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1088:
+	.string	"IOCFG_AF_PP 0"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF1503:
+	.string	"LED2_OFF do {} while(0)"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1307:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1680:
+	.string	"SERIAL_PORT_NONE"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF998:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1315:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF959:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1289:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1499:
+	.string	"LED1_TOGGLE do {} while(0)"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1518:
+	.string	"ALL_TELEMETRY_FUNCTIONS_MASK (TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK | FUNCTION_TELEMETRY_HOTT | FUNCTION_TELEMETRY_SMARTPORT)"
+.LASF1463:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1507:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1718:
+	.string	"lastIndex"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF1606:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1158:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1032:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1292:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF1471:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1575:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF961:
+	.string	"STR_HELPER(x) #x"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1509:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF1037:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF1567:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1208:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1076:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1559:
+	.string	"OWNER_ADC_RSSI"
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1369:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1186:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF992:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1161:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1750:
+	.string	"doesConfigurationUsePort"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1349:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1312:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1228:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1644:
+	.string	"PORTSHARING_UNUSED"
+.LASF1699:
+	.string	"serialPortConfig_s"
+.LASF1705:
+	.string	"serialPortConfig_t"
+.LASF1765:
+	.string	"findSerialPortUsageByPort"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1444:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1390:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1466:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1172:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1627:
+	.string	"txBufferTail"
+.LASF986:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1050:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF987:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1284:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1052:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF988:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1060:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1360:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1216:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1072:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF1769:
+	.string	"pgResetFn_serialConfig"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1570:
+	.string	"OWNER_I2C_SCL"
+.LASF1568:
+	.string	"OWNER_SPI_MISO"
+.LASF1121:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1571:
+	.string	"OWNER_I2C_SDA"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1593:
+	.string	"OWNER_COMPASS_CS"
+.LASF970:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1144:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1394:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1479:
+	.string	"UART1_TX_BUFFER_SIZE 256"
+.LASF1268:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1225:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1746:
+	.string	"serialPortToDisable"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1412:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1607:
+	.string	"SERIAL_UNIDIR"
+.LASF1528:
+	.string	"__uint32_t"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1734:
+	.string	"data"
+.LASF1373:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1693:
+	.string	"baudRates"
+.LASF801:
+	.string	"USE_CLI "
+.LASF1418:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1163:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1674:
+	.string	"BAUD_921600"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1576:
+	.string	"OWNER_FLASH"
+.LASF1619:
+	.string	"baudRate"
+.LASF1453:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1025:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1763:
+	.string	"findNextSerialPortConfig"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1692:
+	.string	"serialPortIdentifier_e"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1090:
+	.string	"IOCFG_IPD 0"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1352:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1714:
+	.string	"serialPortUsageList"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1701:
+	.string	"msp_baudrateIndex"
+.LASF1623:
+	.string	"txBuffer"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF1383:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1506:
+	.string	"CLI_SETTING_NOT_FOUND -1"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1364:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1741:
+	.string	"systemResetToBootloader"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF1102:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1120:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1469:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1138:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1223:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1753:
+	.string	"isSerialConfigValid"
+.LASF1339:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1751:
+	.string	"candidate"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1022:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1708:
+	.string	"serial_update_rate_hz"
+.LASF1256:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1322:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1706:
+	.string	"serialConfig_s"
+.LASF1588:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF1720:
+	.string	"findSerialPortConfigState"
+.LASF1762:
+	.string	"determinePortSharing"
+.LASF1358:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1591:
+	.string	"OWNER_TRANSPONDER"
+.LASF1018:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1733:
+	.string	"rightC"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1668:
+	.string	"BAUD_115200"
+.LASF1330:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1630:
+	.string	"serialPortVTable"
+.LASF1721:
+	.string	"findSharedSerialPortState_s"
+.LASF1722:
+	.string	"findSharedSerialPortState_t"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1603:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1650:
+	.string	"FUNCTION_GPS"
+.LASF1604:
+	.string	"SERIAL_STOPBITS_2"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1599:
+	.string	"portMode_t"
+.LASF1125:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF967:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1657:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1578:
+	.string	"OWNER_MPU_CS"
+.LASF1581:
+	.string	"OWNER_SPI_CS"
+.LASF1064:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1159:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1417:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1647:
+	.string	"portSharing_e"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF885:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1355:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF972:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1014:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF1510:
+	.string	"MSP_PORT_OUTBUF_SIZE 256"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1611:
+	.string	"serialReceiveCallbackPtr"
+.LASF1436:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1486:
+	.string	"UART5_RX_BUFFER_SIZE 256"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1001:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF973:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1609:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1057:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1031:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1761:
+	.string	"isSerialPortShared"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF1259:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1634:
+	.string	"serialRead"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1641:
+	.string	"readBuf"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1134:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1396:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1745:
+	.string	"softserialEnabled"
+.LASF1153:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1614:
+	.string	"serialPort_s"
+.LASF1643:
+	.string	"serialPort_t"
+.LASF1550:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1237:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1744:
+	.string	"serialInit"
+.LASF1663:
+	.string	"BAUD_AUTO"
+.LASF1633:
+	.string	"serialTotalTxFree"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1319:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1610:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1478:
+	.string	"UART1_RX_BUFFER_SIZE 256"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF1767:
+	.string	"findSerialPortIndexByIdentifier"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1137:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF965:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1768:
+	.string	"lookupBaudRateIndex"
+.LASF1430:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1457:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1111:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1764:
+	.string	"findSerialPortConfig"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1441:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1213:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1086:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1600:
+	.string	"portOptions_t"
+.LASF1476:
+	.string	"BEEP_ON do {} while(0)"
+.LASF1005:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1573:
+	.string	"OWNER_SDCARD_CS"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1118:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1116:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF1115:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1439:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1325:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1385:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1536:
+	.string	"pgn_t"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1234:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1629:
+	.string	"rxFrameCallback"
+.LASF1695:
+	.string	"serialPortUsage_s"
+.LASF1698:
+	.string	"serialPortUsage_t"
+.LASF1190:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1504:
+	.string	"LED2_ON do {} while(0)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1065:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1500:
+	.string	"LED1_OFF do {} while(0)"
+.LASF1336:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1660:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1523:
+	.string	"long unsigned int"
+.LASF1094:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1590:
+	.string	"OWNER_LED_STRIP"
+.LASF1758:
+	.string	"findNextSharedSerialPort"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF888:
+	.string	"USE_UART2 "
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1474:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1513:
+	.string	"MSP_SERIAL_PROCESS_TIME_US 250"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1461:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1288:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1009:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1631:
+	.string	"serialWrite"
+.LASF1036:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1112:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1095:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1169:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1577:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1726:
+	.string	"delay"
+.LASF1055:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1195:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1667:
+	.string	"BAUD_57600"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1522:
+	.string	"unsigned int"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF1058:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1482:
+	.string	"UART3_RX_BUFFER_SIZE 256"
+.LASF1465:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF958:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1403:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1189:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1071:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1063:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1340:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1555:
+	.string	"OWNER_ADC"
+.LASF1525:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1582:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1547:
+	.string	"pgRegistry_t"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1473:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1232:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1442:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1388:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1008:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1505:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1558:
+	.string	"OWNER_ADC_EXT"
+.LASF1056:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1551:
+	.string	"OWNER_PPMINPUT"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1618:
+	.string	"options"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1579:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1429:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF989:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1073:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1694:
+	.string	"serialPortIdentifiers"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1472:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1235:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1819:
+	.string	"stdint-intn.h"
+.LASF1813:
+	.string	"long-double.h"
+.LASF1821:
+	.string	"__locale_t.h"
+.LASF1823:
+	.string	"platform.h"
+.LASF1777:
+	.string	"src/main/drivers"
+.LASF1833:
+	.string	"rx_pwm.h"
+.LASF1807:
+	.string	"libc-header-start.h"
+.LASF1788:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1838:
+	.string	"sound_beeper.h"
+.LASF1810:
+	.string	"wordsize.h"
+.LASF1794:
+	.string	"target.h"
+.LASF1834:
+	.string	"sdcard.h"
+.LASF1787:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1790:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1814:
+	.string	"stubs.h"
+.LASF1818:
+	.string	"wchar.h"
+.LASF1826:
+	.string	"build_config.h"
+.LASF1781:
+	.string	"src/main/target/SITL"
+.LASF1841:
+	.string	"msp_serial.h"
+.LASF1779:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1837:
+	.string	"io_def_generated.h"
+.LASF1780:
+	.string	"src/main/msp"
+.LASF1829:
+	.string	"config.h"
+.LASF1822:
+	.string	"strings.h"
+.LASF1809:
+	.string	"features-time64.h"
+.LASF1839:
+	.string	"vcd.h"
+.LASF1801:
+	.string	"serial_uart.h"
+.LASF1791:
+	.string	"types.h"
+.LASF1786:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1831:
+	.string	"io_types.h"
+.LASF1800:
+	.string	"system.h"
+.LASF1811:
+	.string	"timesize.h"
+.LASF1805:
+	.string	"stdbool.h"
+.LASF1789:
+	.string	"/usr/include"
+.LASF1774:
+	.string	"src/main/build"
+.LASF1808:
+	.string	"features.h"
+.LASF1824:
+	.string	"common.h"
+.LASF1816:
+	.string	"typesizes.h"
+.LASF1799:
+	.string	"cli.h"
+.LASF1775:
+	.string	"src/main/common"
+.LASF1797:
+	.string	"serial.h"
+.LASF1776:
+	.string	"src/main/config"
+.LASF1832:
+	.string	"flash.h"
+.LASF1817:
+	.string	"time64.h"
+.LASF1792:
+	.string	"stdint-uintn.h"
+.LASF1782:
+	.string	"src/main/target"
+.LASF1827:
+	.string	"utils.h"
+.LASF1844:
+	.string	"streambuf.h"
+.LASF1784:
+	.string	"src/main"
+.LASF1840:
+	.string	"light_led.h"
+.LASF1796:
+	.string	"resource.h"
+.LASF1802:
+	.string	"telemetry.h"
+.LASF1842:
+	.string	"time.h"
+.LASF1828:
+	.string	"parameter_group_ids.h"
+.LASF1783:
+	.string	"src/main/telemetry"
+.LASF1836:
+	.string	"io_def.h"
+.LASF1778:
+	.string	"src/main/fc"
+.LASF1835:
+	.string	"io.h"
+.LASF0:
+	.string	"./src/main/io/serial.c"
+.LASF1785:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1843:
+	.string	"msp.h"
+.LASF1803:
+	.string	"string.h"
+.LASF1812:
+	.string	"cdefs.h"
+.LASF1820:
+	.string	"locale_t.h"
+.LASF1806:
+	.string	"stdint.h"
+.LASF1798:
+	.string	"serial.c"
+.LASF1793:
+	.string	"stddef.h"
+.LASF1815:
+	.string	"stubs-64.h"
+.LASF1825:
+	.string	"common_post.h"
+.LASF1830:
+	.string	"adc.h"
+.LASF1795:
+	.string	"parameter_group.h"
+.LASF1804:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375 \tI"
+	.string	""
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\036"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"\245\n"
+	.string	"\244\020\275\001"
+	.string	" "
+	.string	"\354\301\314\336\005"
+	.string	"\001\363\330\276\203\007\022\002"
+	.string	"\002\001\002"
+	.string	"\002\002\002\003\004\226\230\365\242\b\003\327\214\256\274\b\002\002\005\002\006\004\333\375\377\333\001\005\373\306\354\242\001\002\006\332\321\347\237\002\002\002\007\002\007\007\240\342\234\212\n\b\340\312\235\355\005\t\365\365\232\331\003\006\002\003\002\b\002\t\002\t\n\013\f\346\224\340\266\r\r\360\371\267\351\n\002\002\004\002\n\016\361\255\215\366\f\017\312\255\203\356\004\f\002\003\002\013\002\n\007\002\007\002\f\002\r\020\021\330\316\241\361\007"
+	.string	"\022\201\267\341\302\n\002\023\263\210\303\241\004\002\002\t\002\t\024\344\326\341\330\017\004\002\004\002\t\025\310\356\360\205\003\016\002\007\002\003\002\017\f\002\007\026\225\321\235\326\006\b\020\027\205\221\270\243\016\024\002\003\002\003\002"
+	.string	"\002\021\030\031\301\375\230\360\017\b\032\350\300\306\254\005\003\033\352\245\231\243\n\021\034\246\343\274\353\004"
+	.string	"\035\226\333\341\336\001\022\036\200\236\352\337\005"
+	.string	"\037\234\371\203I"
+	.string	"\036"
+	.string	"@C1m\230\275\025\024\250h\026s\035\350"
+	.ascii	"\0063\r\354M\362f\271N\310|J_]\203\204A\\\"<\032\032\205\273"
+	.ascii	"7\255\221\313\337\245]B]\245\334\035\325\354\312\252iDT\340\310"
+	.ascii	"\225\260ff\242]\037\005p\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\024\001\245\005"
+	.string	"\362F\023\031pM\322\001\371\377\377\377\377\377\017\202\021\004A\020\004-@\033\"\204\310\235R\256\372\31245\371\372H\226\212\234\346\007Hp\310\036\323\321\330Z\254b=k\215vJ \016:\r[z\355\302`N\260\n0\273(\tm\273\277\272\fK\t1 \200\202Ig\332\320i\306\"\300"
+	.string	"f\3308~D\343d\006k\243o\301\215A\020bOpm\323c\250Np[\254\254T.!\315\374v"
+	.ascii	"\214t\262\356\222S(f\206\301\360\225\241g6z\220\003\031\260("
+	.ascii	"\007\243\363nly350\355\3557.#\nP\300\341c\030\327`\016\241\007"
+	.ascii	"\363\323\332\236\302\r\001"
+	.text
+	.section	.gnu.lto_.inline.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\225\005\315\030"
+	.string	"\366%\206J\260\022R:\346\244\314\013|\220\251\266\302\223\262\245\315\177\260\0307|\301\031\213{d\004\037f\001\n\f4\334P\037\257\265\037\270C4>\266\263\374\240\377\022\327\216z\247\364\n\357\007}q\220\326\366\266f\326\177\\\026\302\366N2\005r"
+	.string	"n"
+	.string	"z"
+	.string	"\236\036!\277\023D\362.\246^\225\327\004I\311x9\344T\300-\232\020\303\314r\034\300-\032\022\226\311\003\334\242\0211"
+	.string	"\227\330;\213a\320*\266\362\027\303\240\025i\020\031\321^\231PCQ\277\330\312\3241\024\365#=\215+\247\355\020\272{\217\230\244\0311\233e\352\310@u8i\371\207\236P\217\211\327\276h_\250\265\276\330\267W\367Zk\235\266\315\342\206\243\335\362'\0305H4h\2319)F\374\0228"
+	.ascii	"\2564\256\274\367^\357n\266\250\265\276,\322\233\275\254\322"
+	.ascii	"\267\240&\253\364\235X\266 Ls>\3214\202\251\3566C\237\034\321"
+	.ascii	"\364\346\333\207>7L\353\331h\273\344\273"
+	.string	"\347\t\255\350M\231X>7K0\307\250\002S\335$\302\332\002\222\2463\237\316|*a\362\230 \312\261v\231\212\266I\276\353\273\327^\f\033\264&5\355h\241`p\331\007\257\2528\030p\355\3477\2634\n=\254\b\326\256\204\250J\231i\3245\2731\330\033\304\264\332\263q\324\362\250\245\2337\302\020J\244o\325)\347\201\361\321\203\222\341\306\024\021\017\033\355\013\\\332-\f-\355\024l\217\"\b\235_\b\"\355<\277d`\312#\323p\211\020\351\207\215\255\n\351\207\215\314$#\306\225k/l\246\334H\005\225\2136\256\\\373;\243\277\255}\330tns\277\315*\034\205\006\341\214\213N\333\266o\321\332\316\233\016D\333y\247^\336c\214N4!p\001\343\3125\265_\327\315\332\201} \326\316S\371\324\013\323\323\313\004\354\327\355\n\356\276\263\243\304\021\375)\232\222\"}2 \367O\001\266\257\003\204\343d\273E"
+	.ascii	"\3418\311lb\272{\220R\216/f\227\003y\250\3218d\2102N\321\214"
+	.ascii	"\024\264\205\016\260\002\241\031\"v\022\200EI\204<\021\2202A"
+	.ascii	"\005\022\240\262k\017\360\244{\263qb\226\227\313n\204\275 \315"
+	.ascii	"N\336\232-\240\013\210\016\370I-A\n\200\273\372\320\354\0202"
+	.ascii	"u\3727k\021y@H\266\204\017p\275D\276\204>d\\n\234Z(y\265$^\250"
+	.ascii	"\35593\271\205Dd2oE\2527cl\310\006\0039P\227)\361\361 )9w\306"
+	.ascii	"\333\3608\303\031}St\363\361@\025D\242\357\303H\221u\354FPw\310"
+	.ascii	"\"\3012\200g\007\020\312rQ\"x\203\227\024r\020\004\027\323Y\264"
+	.ascii	"\263\245\023}&\256$&\303\353\363x8\353&\345\2265\223]\235L\""
+	.ascii	"\362\313\360\206|\213\377\"\345\020zw)el$d\237\031\031\\HW#}"
+	.ascii	"A\224\346]<2q\306\223\272=h\260!('\314\243`<\247\327b)\343\376"
+	.ascii	"\300\264\244\301EUst"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\004\005}\f"
+	.string	"\006\0226.\200EI\007,\316\270\244$\244`\203\344\210\221\230\242eX"
+	.string	"p\231\200t\302`\037\265\326Zk\204l\256!\274\r\355\t\332M\022\271SJ\001'"
+	.string	"*"
+	.string	"*"
+	.string	"\246\240M\301\273\371\307\023\262\200\245\260-\216\324VZq+p\301o\363\007\325\007\271n\036\376\231l;o\355>]"
+	.string	"\004\330\260f\360H\301\204-aG\030\362\204]Q\344\274\246(r\217\335\315S\300>\301b\317\206\301vj\260'\363\\\366\007\030\243\315\355\231\3602\354;\253\331\177Jw\313\202\270Xt\311\313Ky\317{\370AJ9)\360\314\301\325\344\312q%\271b\317\366l \034E\310\267\347\310\367<\237[?\007\270\311\353<\327\335\260/)\303\270\001\377\346}\335\267#\r\322>\232\303\220!\207+<aU\250\001I\312\244(,j\nY\306\260\002\031\232\2436\022\300\202B\fe\221"
+	.ascii	"1\301 \n&3\371\177\036#W\301\254\212\204r@\236\2770CU\311\324"
+	.ascii	"k\372 \247\216BC\345\210\221\345\002\003\360\372\226M\220\236"
+	.ascii	"\372n\206\304\275\005\270\034\274\300vZ\315HZ\203\246\277\301"
+	.ascii	"#\360i\032\250\226\351\227\013-U-\247/)\265\254\251\314\031\323"
+	.ascii	"\01782\342\271\376|\206\374\251\377uq\326~\036+\206/z\t\305\220"
+	.ascii	"\316\307_\r\344A!\201(\037\326\004K\032$\254\354\346\326\262"
+	.ascii	"t\366\327\300\033\005\030\300\3406H4P\364+r\034\234\212\255\305"
+	.ascii	"\353X'_\361\200\023"
+	.text
+	.section	.gnu.lto_.pureconst.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375 La\002"
+	.string	"H"
+	.string	""
+	.string	""
+	.string	"\030"
+	.ascii	"\200\004\001\232\004\003\200\004\005\200\004\006\205\004\b\205"
+	.ascii	"\004\t\271\004\f\271\004\r\205\004\016\205\004\017\271\004\021"
+	.ascii	"\030\022\231\004\023\205\004\024\205\004\025\232\004\026\232"
+	.ascii	"\004\027\230\004\031\230\004\032\204\004\033\204\004\034\270"
+	.ascii	"\004\035\230\004\036\264\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`C\001\r\t"
+	.string	"\022\215(,\200K2\034\310\220fB\327\343\3661\203\263\256\005\255\t\234\215A,\312\220X\023\327R\227\212\245\215\2206\306\365\217G\273\355\275\211\224)OTX`\324\215V\364\t\341Vz\360O9\204\301,\210\370\265\321R\336/\271J9\237H\373\320>'\255\343\264\023\211\203&\200\270\201:t6\2243tB\351\221i\244\021\370%\345\220z\r(D\202\013\235\227\362K\233!"
+	.string	"\243B\371?\036\227\242`\2234:\334E\306\255-7om\247\214-\214\271z\3547\357+\016\213e\316\2376'\224\021y9\345\365\305\0047 p\002!32\0172B\314\305@\201\004p\017\204Uh|\007\2750\202_\021\221\253\320\266n\267\351\274\260=\254\360\024\336\005\303\320\330\342\035\273\322!\013\310\272\013B\304\262\343\n\026\226\316\360-\035\321.k\026\030+B\001\304\023\346\021\016\270\350\004\232\376\2737[\n\003\370\256~\262\002\257B\227\312\364\3170\340\220\273\211u\216yj\216-\333\306\315D\323\245\361\022u\270\3457"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_.lto.6da5883fd5a690c6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPortIdentifiers.33.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375 v\345\002"
+	.string	"4\004i"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\325"
+	.string	"\001\007\005\001\006\025\325"
+	.string	"\001\006\325"
+	.string	"\001\005\325"
+	.string	"\001\004\003\002\002?\202\210\200\300\001\1773,4-\305\001\304\001\303\001.\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\n"
+	.string	"@\bT\343\300\004\230G\300"
+	.string	"\314&\260"
+	.ascii	"L!)\327\017\240\b"
+	.text
+	.section	.gnu.lto_baudRates.35.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\025\006"
+	.string	"\302\210!*po\326|\375k\213A\252\277\343n\220\265_}\252\327\037\353\375\215\246eUUU\345|\330 =\317\001\276\301\352\244Q#2\311u\314\2315o\346\\\336\331\334\363g\320\347\241E\217\032\223F/m\3724\352\324\252W\263n\355\372\305\030\266\210\330\362\212\022H\035D\255f-"
+	.string	"\315\334\272\220\363\304\333\375UF\304%\220\030\257@a\222\003\007y\t\217\260,\304\316\324\253\263\3115\374qoSR\331 \367V\257\365C\034"
+	.string	"4\023\004\306\325L\0160\027\\\004\303\300m`\004\270\b\206\201s1\355R\\-\304\242\201\021\340\006\264\013d\300]\320\006\310\215y\003\332\0058\240] \204\314[\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_serialConfig_Registry.38.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375 \202\305\003"
+	.string	"\244\006Q"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\202\200\200\374\342\203\354\341\025\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\334\005us"
+	.string	"\005\001\006'\001\344\r(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/io/serial.c"
+	.string	"\004"
+	.string	"L\005\2412R\212\"o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetFn_serialConfig.39.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\256\003\005\027"
+	.string	"6(\220J\260\324Uc\020E\321\0340\020\023\024_RTp\315\026\302S\343C\305\017\002D\022"
+	.string	"Wv:\231:\217\254\331\311}@\246\223\007sW\375\347\302\3329y\177\3647<\337\035\276\035\246\202\316\250\372R"
+	.string	"\032\311h\267\275\267\224)\005v"
+	.string	"v"
+	.string	"~"
+	.string	"\345M\354\030\023\313\253}\243\037\351\216\244\363\001\367\nQ\351\2707\330\300)\350M\007o\340\274\211\276\300y\323:\273\310\203\300{\241\224\211\245$\367\336\324\2720\3722x\227Uw\263\264U\347'\275\002-\t\255\210\277\335\315\322\345\3633$\300\257D9\3032\242\242\347\327\253e\214\240\333+\275\026\215\364\254\210\277\240W\027\314\275\327\325\367\003\272\317\333\016a\233\202m\205\004v\350\243U\264\226\375\302C`\301\253I_\351\245\214\026.\243\243Y\035\344\236:e7\255-bD\275\317(<vg\330\214\240V\326\255I;\270\253v\310\376\f\213\247\310V\310~\035\3517/\274k\255\276"
+	.string	"\231\242$X\t~\334{bk\311\2552\2150.\374\355\307\240X\374\240\257d\223X\024\313i\274\206\356B?\241\273\037t(\364q\344\336+\273\351\t\350M\224/{\341QT^\355\313\236gE\257n96<\332q\033\303\217@\252\" \241\234\341T=\246$<\225\032\036\005\305\303\3514\247\275\341N4\306\342\003 \222\342\361Z\273\3469h)H\0345\006\300{\357\354\246m\363&\033z\357}a\312\351p"
+	.string	"I\244s\336<\233|Y\274\272E\342\304\033\364\336\235\231o\3437n\345\211n\032D\356\274\357\246\237\263gza\344\325-\237\f\223\216\267&m\266\273\345e\346\300\305\205\326\262B\300\306\306\001\347\026sb\332\212\207\032\033\256\226Ko\266\024\307Vs\223\322p\271t\005\201o\037j\2704\347v\303\245&\301{+\344\n)\252x\266g\007\261p\"30\225JDa\224\371\025M\n\020V\374\321\312\372gN\373\302\255f\026\250|HM\201\020X\212|\322\001\f\251\216\246\035\262K\312\276\254\275\252\262W\333\343\247\263\332\230\253\235\252\344G\2650\274\232|y\357\275eK\250AP\305\220B& \231PH\013Z\035\320\002\231!\"\017\021 UH*\220\241R\217\373\006\n\367vM\201e\020\257\242E\272\2610\246\264\261dh\034\256-1m\255\033\004\244<\017!)\324d\353\273\344\246\304\261."
+	.ascii	"\251}\034\356\216\346\202t\033Mt_\235\241L3:9\022\001\360R\251"
+	.ascii	"\321\230\225\350\rX\365W\224\002`\252\371\277\223\275/\t\270"
+	.ascii	"Ef`\005\307\302\364\376\034\232\215\207;\211\266t\032\357UU#"
+	.ascii	"\231\201\257\375\01654\350\346\330\362]\017;\305\206\273/\033"
+	.ascii	"\246\001"
+	.text
+	.section	.gnu.lto_lookupBaudRateIndex.40.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\367\001\265\022"
+	.string	"vc~I\320\224M:\320\b\372 \037\327\315M\251\310yZ\222\211\343\245\001\025\350I\223\241\217\0227\221*\274\336Q\021\203\235[\266\220\241\001\316\343A\035\006\016\250$\2740+\356\3330\027%\236\304]B\270>X\233%\204\354-wJ\001i"
+	.string	"e"
+	.string	"k"
+	.ascii	"\216\311Z\"\364p>\350\030\r\241\264\202'/\320"
+	.string	"}\312\023\350>\027\310\001.\353\335\305\330\275n\312\2151\337\346\236\334&\032>%\241\216d\351\001\262\361\334c-\274\211\235\020\317\347\205\333\rZ\030\342R\262\f\265\270\225\2048r\211\216\230H\302Y\334\347\276\340\226D\013y\036\275\026J\251#-\004q\177\267]\263M\301\216\007\002\271\253\220F\344\240\021\312\2566qm\366Wd\344\354\360\376\330\216N}\307\375\236\243\347\353-_\357\235\321QF_\245\3025)x\242t'\312\b\3051\225N\274\376v\215\2373\211\211\n\360\201J\315+\315G\203\274#\333\316\017J+\203OK0\271\2011\036\327\301)J}j\314\240\2646p\202\357\363.\376\242&\365'\262\323tr\277}N\317M\214\362s\027\220DK\021\217\204\210\210\230r\345\356\326\354\335\324F\035%H,\020\324\"&\2716{\033\367\005\243\307,\026\361\360\0300\037\245\263\025\277\350F.y\023\237\326"
+	.string	"\353N\373\364a\335g\334\224\222\334o\024\242sD\026\243\f"
+	.ascii	"i\3056\005\031\002\262k\243\351^_\201\204,BY\205\342\001\034"
+	.ascii	"X/1\255\351\224\b+\016TT\\RP\006\260fV\026^6\2540|vA\311\260"
+	.ascii	"j\275X0\320\325\002cZ+\030\320\345\005\003Q\f\330%\303z\2013"
+	.ascii	".\327\013$\261\355J\277?\226Y\362\321\371\261\356\271\247\202"
+	.ascii	"\226p2\265s\256[d{\303\303[\233!8\315o'-\236\350rk\023\234f\261"
+	.ascii	"\210|\362\221\333\"\213P\227\224R\332}\373$ 0\002\242\224dvd"
+	.ascii	"\021\374\274\206\324\314\025y\201\235\330\276\323\3006\330f\030"
+	.ascii	"\"\246\305\255\204m\023\211\313\254\253P\264\226\241~\270\217"
+	.ascii	"\025\303\350\216>\236\023jt\305\301\336g5\265\222 a\354\377C"
+	.ascii	"\n\nAx\337?\355\026\264\004\247\b\265\020\270\306^\312\n\335"
+	.ascii	"\350\264\201\f"
+	.text
+	.section	.gnu.lto_findSerialPortIndexByIdentifier.41.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\346\001-\022"
+	.string	"\026byH\320\224M: \203#\312c\207\374?,\375^\032.Jn\032x\004\2769d\237\230\004\362="
+	.string	"\320\236<mam\263\365\214\305k\221\007{\326\243+\274\304\324gceQ\3270\367\330\027\203\277P\306\306\"d\357-eJ\001c"
+	.string	"`"
+	.string	"f"
+	.ascii	"\337g?7CF\346\234\251\223\023\220\217\360\003\344\343\242\260"
+	.ascii	"wH\273\245\272\336\311\bW]\376\353\035\354rt~\224|7\260EH\022"
+	.ascii	"\317mW\234\317Fe\213\235G\t@I\262o\304!l \343\305O\311\307\001"
+	.ascii	"\256\215\bw\372b\272\267\035\005H\207\354\333\271v.sN\253\354"
+	.ascii	"\023q{\267\215c;\202\2552\276\213\210x \341\365\261;y\241?\256"
+	.ascii	"z_\273U\325\367H\206\360@\301\315\031\"\3274wD#\026\257\375\366"
+	.ascii	"M>\250\3704\337\346\223\t\b\025\273\346#\357\245\343\021\r\251"
+	.ascii	"P\232s\246<\032\202\367x\333e\237l\223\227\312\365B\033"
+	.string	"\f`\316\236\246\033sN\005F\340=\036\306c\270\354#HK\021Np]\271\357`\302Fs\017\272\341t\205\254\210\217\bW\267[\034\273\344\226\303@\f\026\004\356\314q\277-\032@b\272\244\3416.xs\306Z\374\032\037\232\201\017z4\206\032y\331\243_#\037\277\007~\214`\232s\200\033\216%\3129R\264N\371kwp\002f;t\321\363\031'\271\341zLe\262i/\335\231\003\031T12\253\350\025\006-\013XX`VP\002Z\252\325\204\025\215\214*fEb\030\024\205\227UK5\223b\255R2\253\227\n)\230\326L\nU\300,\013\252V\212\206\305j\245N\264\371\365\361\224p9\022u\303nw\327.\260\265)\321\355\314'\236(w\2214\345\272GR\367\001RL\227r=\272.0e:\234sN)O`\312\024% @\002\242\324Yu\200\022L\0340\373\214\222\"\241\274&\005\325N\311"
+	.ascii	"I\022\207\232\303_\033\266\3334E\253i}\277\261+\023K\254;Kt8"
+	.ascii	"$\312\305\243\003y\201\241XP&d9^\004\305\231E\342j\030 \037\310"
+	.ascii	"\373\310@v,\241)\242\026\002\245\261\237\262\0027:-&\003"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByIdentifier.42.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\264\002\275\026"
+	.string	"Vj\227L\260\322U:+|\"\001\307\341\2215\036\333:N\336$\344l?\271\320U\037\3008\317\032^D\227\367I+\t\304\276\345\265\315~\006?8c\354\375?\313qC\267\203,o\250#\253\025\336\213#\3707\351\366\003\221%Ad\357\275\223\f\201"
+	.string	"}"
+	.string	"\205"
+	.string	"i\313\025\220{(F\034\345\234\0254\202\362X\344\336\347/r\2553\220\352\330\264^|b\204Q9\247\257N_\200<.O\200<\266*\272\374M\337d\325}E\342k\253\256\357\362\325]\315\324\330"
+	.string	"Acn\n\224\016\021\017\362*\351\342\346\270\002\217\221\017\r\361{\033\374\364\354\200\240/\327\002\211J\037\276\312\240\275j\037|MZ\3429\025\321\233\327\225J\316\271\253\017\265y\227\357n\264\273)tW\2418\273zl\326\324\203g\025\217L\271\036\273S\227j\177\335o\244\035\036H\264\315\3516\237\376%\331\265\361\201\357{\341\333\342\332\365\326>\313\302Q\024\324\210S\3164US\271\006Nbq\341\017|\355\276\253\251\344\304\013\265\\\306\341\205\272g\230\032\223\346%HBy\374\276P\256\345\232Q\322\375`38\311\035\210+s\213\025\361\367\363\224s:r\334\020JWQI\255\207\321\007zP\356\001)\212?\352\n\037\217&l\177\375'%*KZke\272A\206@\034\350\355r\\\373\353\322Vk\013\336\350U\251\356\306p\244\026\314\324\324\223sF9Z\t"
+	.string	"\\\212*\272\221\216<\2566d\007\b\300\020J\332\013\217\303\331\235H\227@\307\327\335\035>\264\342@'\347\234\022\343\305Z\237\347\2707\334\352}\307\375\033yLZk\364\335\\{\2732\306P\355jU\177\370\177(VY\342\214\017$k\1778\362\300O\b3\026\230\354\224\321`1\223\303LF;q\233\240\244,89\211\231\220\f\260\315\316\013'\013m&;Y\035#\311"
+	.ascii	";m\263\333\253v\276h'l\345\025\263\335^$!]\3230\263\275Xj5\333"
+	.ascii	"\253\225\346\333\234\bF\"\242\021y\031\377\360\346\223\022\325"
+	.ascii	"\265\026c\333*;\313+\261\262\2776i`\323b_=\361\327\312<\300\321"
+	.ascii	"\253R\267\307\211\333*\273z\374\3159g\322\264\007^dw\034y\255"
+	.ascii	"i\017c\202W\253\0362 P\002A(\031\017\200&x5`\232\031\244\202"
+	.ascii	"%^S1\025\211\317v\267\006\262S\225\275\215-_\205#b\230\020\377"
+	.ascii	"bA\0277\032\267\035\177\031a\f*\027\232p\322(\247\206\363E\303"
+	.ascii	"\355\355\257\251\f\315}6D+>\320}n\212\007\227\331J\306\rr\233"
+	.ascii	"H{y\206w@\007,^\242\342\271Kv \023\353aw#\021\230\225\225\t\216"
+	.ascii	"\210\262\206\316\275Z\363\004"
+	.text
+	.section	.gnu.lto_findSerialPortUsageByPort.43.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\252\002m\026"
+	.string	"\206\351\224K\240\024R:(\013\003>Y\316=\317\360}\321\263\225{\314\254\3058hOXL\322e\020x\033'^\tk\223\257\351\335\276\032\255\177\316\242\233}/m\316\2730Z@\017\3262\013lN\233fY}\274\f\260\237\374v\357-w\222\001\177"
+	.string	"|"
+	.string	"\177"
+	.ascii	"\027po\221\222\034\367\226\0138A\354\3650\036\003\207y\006\312"
+	.ascii	"#!\331NT\317\023\327\275%\215\313\027\260\257\261\023\260\257"
+	.ascii	"}\202c\247\345\331N\336a\266\322\236<~\316a\024\366\023\004\344"
+	.ascii	"\004\330C_\210\f\tq\241\316\264JC\257\027R`\375\200\037N\251"
+	.ascii	"\003\031LH'\300\035\332C\243\216\027?}\200\276\331\027~Ne\021"
+	.ascii	"\261\240\200C\2370\230{/\317\037P\350\034;3\003\231\331\002\363"
+	.ascii	"l\nD\275\351\305\262\245\013orT\262\272\323\213\271\314\231\035"
+	.ascii	"d>K\031\3510\202\273\210\231\274\323\037\263<\271\276<\323\023"
+	.ascii	"\317='O:\371&dSN\021\037 R\276\356\005\372Rr{\324)\025'\376\345"
+	.ascii	"'\363gJ+\177\372P6[*\022y\277<A$\320\016\325\204\330\353\371"
+	.ascii	"C\034\331\314h\205\371Bn\320\202\363r\027\273+`\306\340\216\255"
+	.ascii	"{K\005\257\034a&be\316\317\270\323MI\277#?j\007\371[UIm\273\333"
+	.ascii	"\207\371\344\370\342\200\257\227E;\310\261\236\255#\006\361\315"
+	.ascii	".f\226y\324M\265\322\342\272\367\272\340\310\005\030j1\331\370"
+	.ascii	"\r\236}\235\215\202\344\004\340\350\302\366\211\337\021\365\016"
+	.ascii	"\305K9\37213\207\327\310=8\272\367\276\030OC\003\037\305+\323"
+	.ascii	"\330\314\377^\3716\366\325v_\375\206h\277aW=Kz\363\213_\374="
+	.ascii	"\034[\264\361'\211Twpg_\276B\267\232Z\f.f\246f#7\334bfp\225Y"
+	.ascii	"\\^\030\264\264\330XT\006\324\350r\024L\330\246\202\241\206\323"
+	.ascii	"\335hh9\034m\006W\223\241\331t44\025\024\316e\270\351h5\271\234"
+	.ascii	"\216&+\357\273H\302\025\017c\224\375\361/\236\334\252J\242\335"
+	.ascii	"\2656\303\364Z\207\004\254\203LRU\262\353o\376\351\264} \b\361"
+	.ascii	"\315.\212\304\004m\230\336\364:\275\367^K\366\313#\350}gi\223"
+	.ascii	"}\236\022:\363\353FG\026\263\0032 @\002\242P2\036h\242\333\314"
+	.ascii	"\273\0320\315\fR\301\022\257\251\230\212\304g\273[\003\331Q\225"
+	.ascii	"\305l\\\355U8\020\303d\361/\032t\\H\206qD\265\245\030\224^\b"
+	.ascii	"\341\244\242\234\030\356.\032`\357<Me7\367\332\020Wq\377\357"
+	.ascii	"CS\034\\v+\0330Hl\242\355\245\312\310\221\316<\\\241k\276\023"
+	.ascii	"\310N 4E\324\0023\2652\326\021Q\326\320\271Wk\236"
+	.text
+	.section	.gnu.lto_findSerialPortConfig.45.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\235\003\215\032"
+	.string	"\206\261\253I\260ZM:\220\005\025P\262\370PQ\265\371\020\202v;m\333\026\243zs\3043\315\325\306s\020\316{\n\326\210\374&\376O-O\013\255\177\344=\324\036\324w\006\374\177Q8&.\034\246f}*-\216Z#\204\354-w\222\001\222"
+	.string	"\217"
+	.string	"\233"
+	.ascii	"<\314/\367\236\fn\331Bx\313\267\3650\213\267g\376a\026\231\021"
+	.ascii	"\334\221R\346\037=\311\317O\037V\335\273\243\307\344\336\323"
+	.ascii	"\001+\boY\365F~\344\207c\007N"
+	.string	"\243\030\342,j\350\026u\3579\362\371\002\337mx\002\337m\363\340Jc\267\365k\032\343+y\245\t\2012e@\2674\262\025\317\005\321*`\310\214\177u\002\022Z\017\032\231P\355\032\016\312w\247D\262\025\264\237{-BS2e3N\301\n\367^\246\246,\306\031<3\247`f\f\314\235\024\267\354\322\2417u\276\022/z\223YB\r\304tG\306\351R)\3463\210\366\214\3718NL>\270\213\230\231\262\bR^\201\224U\037\345\360\2723h)\177\225\262\255\224\353\317\277kD3WF\245{_\364\316\334&\333D\310u?\363\371H\327\361w,\362\317m\3171\367\274\306O\352\332\024\355\336+\336\342B \030\341n\026e\2634Rz\\\317O\237\001\367,\234\262\364\034\334\332<\215G\272\215\177\263\30122\377\326\363%\261_!\030\252\027\001\366\t\251\311J\207\03217\032\225W\361\300\007\022k\003=\216"
+	.string	"\360n\200}\335}t\224T\212)\326@\313\275\367&\354R6\234'\341\3669\346\360(\035(h\201\362%\017\037@\200\370n\301n/f\215\332_'\270\rM\225\264\307\266\237\343\326\237\220\2072\272\367\3428\271\031\246<\371\325\266\235\340&\224#\210\366\370\273\277\005\217F?u\251\351\272g\271\257x2\234\236\364\327\330\365\236\272\217;\253\244RLwe\002\320\237\231>\006\177\355Lth\214\356-o\362yW\032\301\007\0229<\255\020\256\020;-R\305\020p$<\210\020\201\204p3`\347\345\342!wP\210\b\231\274!\321r\301rN\214/\327\270\343j\225\030I\330\211\361\306"
+	.string	"\277L\344\300F\236\327\0136\212g\371.\272"
+	.string	"e\003\247T?\345\337]5\006L\220\006[l\"f\026\233Uv\020\363ug\225\307\375J~\027De\232\312\037\266g\f\366\016\033\225,d\210\245\266\202-G%\355\235\210\013\031\365\336{k\317\370\357\034\216\242\245o\301\267j\230\215\213\nj\206U\335\275\352\352e\310F\330\252\376\320T\2163\374\212\206C\250q\034\305\030Q\f\231\231\241h\202\214Tc@\002b\020J\363\021"
+	.string	"\302\032\261\345\314\001\266xM~\321\272\020\251\n!\217\006\033\344>\027\200\360z\212\373\034\177\372\341F\3374bl\353\237b\005\bo\005\016o\204\360\204Jr\327-\366I\331\232\202rF\025\216\231b\244\350T%J,\"\206\2578G>\221\"C\220&;\276\030a\345\231\250"
+	.ascii	"\033\246L\026.D^\235\226\276\013\361\243\244\225k\001\022\234"
+	.ascii	"\003\344\344\003P\227\002\336\232N\035\370L\034\362\275|\311"
+	.ascii	">3*1\302\327\323&\020\373\001"
+	.text
+	.section	.gnu.lto_findNextSerialPortConfig.46.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\314\002\255\026"
+	.string	"\226\251\224L\240\024R:\025\353\t}9\206\300`\301\364\270`Q\360\357\177\213qXm\002m\260\256\036\364$mwK*?W\265\357v\372\265\374\331\357\026[\036o\342u\030)\301\025\003\276\224\006\3019\016\363i0I\270iw*!d\023\271\223\f\177"
+	.string	"x"
+	.string	"\201"
+	.string	"h\255\017\362\223.#\347)\016yruN\3604\335\2332\340\225\363\366"
+	.string	"\371\027\207\221\303\270\002\251\321\217\353\267\265+f\335\233\242\234\236@y{~@y\333El+\356\2455\311\2568\276\207\227\260\336\316\203\272jOX\004\335\234"
+	.string	"$\302\353\t\235$\035\304"
+	.ascii	"\036\301z;\262\205\306\247\023_yz:\265\037<\202\026\304\341\324"
+	.ascii	"R/\350\325\214\271\367r\345\365~\316\347\231\371\0033K`\256U"
+	.ascii	"\001][\245\270CBW\267\370\304\037\3041\250\245\206\b\227\272"
+	.ascii	"\177\301\0038\002E\335\212\2049\325\325\3761\377%\252\007\nn"
+	.ascii	"\037\363\323\037\366\342\312gW6\313\312eY\331\332\312$Y\271\273"
+	.ascii	"r\375\360|\023\033\237,+\030\343\275=[I\356\017\353\264\342\303"
+	.ascii	"\237\371)R\350\213\027\272R\200\240\314'~\210\373\335\361)\351"
+	.ascii	")\342\025\2717Up\313\020\316\333\363\2059\314.\346\024\250d\202"
+	.ascii	"\262\354\333P\210N=\302\260\266]6Y\265\033\"\333\366wZ\314\024"
+	.ascii	"\276"
+	.string	"\243\202\225\232\001\324\221#frU\004\342\270\023\256\274%\033\345()\300Q\304\253?<N\211\334\231p\013\250x\314\334\341G\013?\302\\\370\215\330\003\252\032\267!\233\315\314\224\267\257\356*\236\220\331\335*\305\235V\256nqmf\332\225j>et\357}\341\033O#\003_\305-\323\330\352y\267|[y{\236\221\334kJ3\263\233\230\fM\246\026\223\225p\313\013L\003\027\027Y\013\213\200\232\215v#\253q\300p\262\214EC\214v\233\331\2406\032Z\243\305hP\331\315\006eAa\333\206\331\r\275\261\331n\250+\315\275}\021\246\206\214L\366M?\361%XVH\344\373\344\2639&\327\272\024e\377\330l\023C\037<jN(\263W\202$=\370\273\b\001D\336{\257\355\037\377\255D\344{2\333\307\307\262B\352W\277y\230a\307\021\006\216DW\0015 @\002b\214a\363\266T\002D\233\237\303\212\335"
+	.ascii	"l\264&\224)0\344G\377\fT\321\216\211{Et\\f\366\256\337\017\245"
+	.ascii	"@\273\260G\306\020231\374\303@{G\220\305;B\360\210\023c\211\307"
+	.ascii	"\201\3104\203\206\221\354\226i5\214\001\213%\016\034H\"\374\030"
+	.ascii	"4j[GqR\214\257;\016\310\233\3416\n\331&|\234l\313\327\327C\250"
+	.ascii	"\312\352\310o#)8\026\306\300\321\032;\367j\303\023"
+	.text
+	.section	.gnu.lto_determinePortSharing.47.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`w\001\025\020"
+	.string	"6_pG\340\322&\035#e\022\207\020p\246d>\036d\300L+\002\217\343\325\257\341\231jtD\233\253\334\2342\272\031h^A\270+\034\352\r\373\031I\302\f3\216C\261\221x\004L1 \032\036\257`\245\261\025\261do)S\n_"
+	.string	"U"
+	.string	"]"
+	.ascii	"%@\323\321\b\033! s\206\\\311G\264\313x\002\332\345\222\370w"
+	.ascii	"M\306\325\317?\2012\327>\\\306\222\"\245\020)0C4\020\2739\212"
+	.ascii	"Q\201\210\0339)\360\025G\214v~\240\300\032\335x\322s##\005\322"
+	.ascii	"DT\f%\025\227]q\300\032U\223\312\234\323\252\001\354p\233n\273"
+	.ascii	"\263\035\301~O\366\343\\\230\375\240\337\364\360\227VG\251^\251"
+	.ascii	"\326\250\376\226*2"
+	.string	"r\360bN\016\263!\023\207\244q\302v\214\215\262IX\230\254>\bC\f0_;@\020\266K\222\024&\252\366\177\016\024\363\020\346\002\346\204-\315\2303\\`\004\333\245\303\315\266\357\363\0251\376b\030\033\323o\360\361A$\027&\322C\207lh\216\016\017;\342\306\374\004\332\356{L\253\273\253\325\260\001A\2433\177uo\2634\2433\333\336]X\330\346|\245\370B\256\227m\316y\023\227\337\003H?3:\373\356\240h\201\264\206\321\344J\220!\2754\210/\373i\210(\307T!v(\243\033\013,\257s\255X\027Z6\237\2444`\200\202\262:Q\r\230\320\265\260\274\007\256\226\347r\362JEa\245k\261\274p^\307\261\272\225\n\334\252\365\302\251\n\330saiq.\317kq\250p>\316\205\371:I<z\030\327\370\177\232\b\217\244!\251\377\264\313\016@'\211g\375O\213\213c;\256Uf\226F\013\030"
+	.string	"\200C\260\303\320c\373"
+	.ascii	"of\tR\306\300\202U\r+\305\243`\352\3005\272\205\201 \212i\334"
+	.ascii	"\300\020\206kbDl\354\263\205\271\204,+\324\020pB\22068\205\320"
+	.ascii	"\222P;T0\315"
+	.text
+	.section	.gnu.lto_isSerialPortShared.48.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\300\001%\021"
+	.string	"\266awG\340\320(\035\362\003)\241+\371\263"
+	.string	"\002\375\t\242\030t\374\241\330\363\370\360_O\b\336A3\314l\034\332\361\261\236gf\301P\262K\242\332`\016b\260\004\034\\\n\316\331\370H=\360\350\035f\001\235-\310\337{K\231Ra"
+	.string	"`"
+	.string	"_"
+	.ascii	"I.\346\264\0350\201\356\321\266\007\220\217\335I\344\243m'`y"
+	.ascii	"\031\3476\020>\007\n\332)\3121\247\315[\240\343\\F\270\212\343"
+	.ascii	"\377\366\027\021#Z\360\310r.3<ZPh2\347<\311b\272\220dv\204\013"
+	.ascii	"\221U\200(\270\032\207\337\256=2\230j\211\301\234\323\312#\303"
+	.ascii	"p\227n\273\306v\312>RF\177w\241_Bu\224jXRoI\255R\375S\310\r\244"
+	.ascii	"\005\2679}r<\246\214\b#\310\366\355\247x\331'\273D\203J\324\337"
+	.ascii	"|\024/z"
+	.string	"\335\310\006\212\314\230\207\030\017\272G\023xA\005\352\211|\333O\274>DAEf\f\346\323\240{\024\321\222\034\025\325\233\360I\274\304\353B7\0070'-\264\023\t\327\345c\277p\007\314\330\327fG4`\001\271{\\\267\272\273\022\307\316\006\230\346\374\325\375N\017\035\315\331\236\371\n\232n\316X\213\257\202\365u!\036\277'5\204t4w\305\325f/\3267R.\210\r\242\244\230\352\360\251\303\324\035\266-G\367\307>\234sN/\315\266\332\364\241\377\343\001\253O\345J\255l^d\\*\b\021`X(\231\326\310L\013\345`\365\251\\\251\225M\f\210WZ\024 `aI\255\244\214HP\305\254>\027\027\353\25319\2252\001\245b\301\264\274O\345\255T(\032/\305jy)\002\374\325\300\260<\327\367\261\274\223m\036\316\245Y\243\201+Dy\334\036\333\2465\321Y\230\343\232:\271?r?\324f,\342\006\034"
+	.ascii	"\200C\260\301\320\257>\2149\262\310\231\"\020\370\301\244\006"
+	.ascii	"\215\241\022\006\002\204\002\305\305\350\240\025\024\004D\032"
+	.ascii	"b\032\002\257.\303\200y\340\212`\260\247F\301\261\bj\213Z\210"
+	.ascii	"\224\204b\324\354Yi\220\265N("
+	.text
+	.section	.gnu.lto_findSharedSerialPort.50.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"]\f"
+	.string	"&\330WB"
+	.string	"\223\232\016\263\002"
+	.string	"\372\372\232V\315\341\333;+\033\036\001UB\263\021\225Kt\2341\252i\033S\246\202Q\303\256\334]0\333\360k\200*)\204f/Z+\026P$\3765\202Vw\250\204\330n[\246\024B"
+	.string	"E"
+	.string	"B"
+	.string	"2vg\002\227P\227\"j\333Wq\227\317\237\003S\3242\355xa\211\341\261;-\317\027\320\\R'\240\271\214&\376\271~\374\307\\J\341B#\f\201\327\311\301\356Z\303P\313\035o\273\304\266\004\373\017\002%\354K\033I\330VO\207\371\345\347/E\365\251\001!n4\030\355~\030\371X\033r\006\n\333\237\035b\223\3500\221X\274\305w\230\f\222\310r\030!J\241.+\211d\306$\252\375\227\257\370>5X\356\212\250\021\321\256\220\351\303)V\035\"h)>>\007\313\017\220\216\2542 @\364\367\214\006\301\357\3421:\002D\273\240\207\376\213\303X\361O\\z\353\350\303K\277\323y\364\241+\017\021\264\312\204p\254\366\260'\2501\332\226y\230\346IQ\361\262\b\0238\334\245\322\215\370d\001\003\005((\330\311f\304BwA\320\266\314\3034\017\005"
+	.string	"\3066\027\256\214\343t\326\226YZv\255X\030\327Y\033\003\3360p8\313\3336\316\n\231{O\261\002\305\r\016\2402>\020"
+	.ascii	"\242\223\240\314\2000l\020;=#\232f3B\270&Fj\241a&:\020>\030\005"
+	.ascii	"\307\340T#@\304\223\272bj'\031"
+	.text
+	.section	.gnu.lto_findNextSharedSerialPort.51.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`b\t\2356"
+	.string	"\372]\364\024BP\246U\007\223\264\255;\336\247\303\004\257.\305U\2542\231\002UQ\374\302\177U\n\202\362\374L\222\201p5\333\273\376x\244\363B\022\375D4Q\373\276\311|V\006\270\310\234<\270\256\233\267\335{K\231R4\0011\001F\001\037\007\331\355\337z\260cn\234X2\004Q\3037\377\330\323\273I\276P]\223\351\226\267w\235\t~\367"
+	.ascii	"\327\320\177\215\177\233\003Y\206\317&\371{\n\252\223b\317\336"
+	.ascii	"\366\216#\274\3532\340w\375\247O\356\274w\263;\224;\317\375@"
+	.ascii	"\224a\213\346\303\240>M\217\366h7\245p\221\200\337Mj\017(\031"
+	.ascii	"\352\354\376f\036\f\352\343 \356\356\235\345f\266w<\301\033\300"
+	.ascii	"\357\036\345/\363^P\276,\020[\221\346\260dN5p{\307J\036\377\200"
+	.ascii	"\367]\370\003\274\357\352*\360\267\361;\354>\275\374\237\257"
+	.ascii	"\307\333\351\340\334\353\266:/\375\243\376\007\305z5R\3317%}"
+	.ascii	"\362\275 \266*HK\212\365\274\026_mW\277k'|\371\322\366W\250\223"
+	.ascii	"686f\365hM\262\256\315UA\331\376\ne\322j\020\024\250\311[\247"
+	.ascii	"2\274\200\212\324\352s\255\207\257\256+\277\250\263\325h\246"
+	.ascii	"u\376\372\013\274@\231\3447\007\302\372\020\260\274Y\275\313"
+	.ascii	"\213\016\311\355\025z\325&\301\371l$\332\314\372\325|+\306\013"
+	.ascii	"\316+NK\372\344s\016\304\336\333\3633*}\007\276\373Kp\367*w\370"
+	.ascii	"*m{\357\f\376k\3176\303\237\353]\247Q#\377\263\306\373\356?\007"
+	.ascii	"1\337\351u\365k\244ESXR\271\221\177\233\177*j\227<\2253E\220"
+	.ascii	"\326[j~G\205r\3359\353\036Ke\275E\266\344\031u="
+	.string	"\305]\227\275\200.\273\220\200/\373\200W{\027\240\263\007\370\352{\020\230\035\300/\373\221g\007\002\263\377>\315\277\357\343\377\336/\373\316\263\277\275\354\256/{\253\263\347^\3667\240\200\013\353\252J\231\306\306\033I#E\333\352\302\331\362\325\177\265\367?{5\377\253\363\034\352\253\376V\207\332H8`i;\376\035\377<@\251?pix\212I\315xG?x\265Ex\027\251l\310\313\237v|<\3056\336\321W\f\226=\241\3315t42vr\264\333*\336\322\277\372:\363\202S\302\357\"\355\031\376\331\323\361\257\263V\347\370lv \031\002F\347\350?\007\311\316\320\375\347\270\005\f\307\227\343\224\024\025'\300\322\346\325e|8O/\346O\366\324\177\243\343\374\3512\203\243\240\360t\311\260\315o\366\364iz\004\367\02394-\203\267\031L5\324\371\313\236\002n_\365%\231<Ut\257{\272\366\336\031\206,\313"
+	.string	"\321T\341\262Tn.\277\276\272\343}w\200\026^1\323s\023\275\n\320\257\366?\262\230\325\034\265C\202\225\347W\335c\344\275,\363\301\312\336[\003\243o\264\374Z\202\205\b\361\276+@\353\265\247\222\240\016\240skNF\314\353?\225X#=\255\212{\363\352-\247\367\253\317\"k\247\310\372;\261l\236\327q\251\303%\216P\253?\355\223\230.\342\263#6$\371\223(\016\256\325\277\007\355U\210\271n\263\262\257\242\206\2612s\326\337\030*r\345:x\001h\021?\335\323"
+	.string	"\264\201\265\227\302G\332\325>x\217\364\263\205\361i\346D\356\323;}\244_CN\253\237\336\351w2\362\022_\310\204\216\020\0368B\203T"
+	.ascii	"\365\370\351z{A\311\367\335\237v\340f\006\316\247\030\364\346"
+	.ascii	"weU=;g\335\247\337\354\263\376\262w\020\314\261\357\220\325\243"
+	.ascii	"\206\271\356\266\1776\237\364b\017(\311\340\237\356\016\344\377"
+	.ascii	"\234x\262\266\275\233\032P\274\037\025B\260\254X^{73\360\371"
+	.ascii	">,\\\274x\001\303\223p\226T\304\221\263\n\277$\213\231\263\356"
+	.ascii	"\352\254\221\0269\031iw\031\217uz\266Hb\321FQi$6\025w\304\033"
+	.ascii	"K\311\027J\344q\005\320\007\261\311Xto\024m\030\217\"\224\310"
+	.ascii	"#\217\035Q\271\324Tl2.1\351H\340P\026a4\021\221K8\222A\277\220"
+	.ascii	"AC\005\f\030\230.P\b\346H.\2410\036\213J&\343\223\215\2363Q\320"
+	.ascii	"\261TD\022\223J\307\242\222\261\270\264C\211\t\231T\242 \364"
+	.ascii	"#\017\"RIy<\"\225x1\363\365\024\022X>S\252\317\177\371>\332\357"
+	.ascii	"\270\262\214x@\375\276\332A0\265\224\364\247\267<\247\265\302"
+	.ascii	"\322\334e\344#Np\246ru\203\007\203\004\nZZ\026\234Oo}>\262F\t"
+	.ascii	"[\257\325\tu\201\345\227\374\\\206\201s\221\024\3131\360\336"
+	.ascii	"\033\250\031\270\375\250`\034\252\252\250x\371\f\242+\254\255"
+	.ascii	"\265tS\262fq\203v\316\276\307R/d\313Fwz\213\304\332\330\224\n"
+	.ascii	"g\346\377\365U\f\001sR_\001Z\250\215\370\347x\205\372\265\302"
+	.ascii	"\334\250d\256B\375v\324\322\376\321\236g\315r\211{{\242\323["
+	.ascii	"\256C\313\021\320\356\323}E\037\324F\340wz\203-\"\255\240\376"
+	.ascii	"j\273\367\3360\001\375\325O\322\363AM@\377S\021[t\335Z\313\363"
+	.ascii	"\320Zn\200n52,\200\274\250q \344\224c\f\321H \022F\222$\035`"
+	.ascii	"\002\021\2522\363\022`\3665WHR\240l\354\277\001\020J\252\371"
+	.ascii	"L\242\257\212\257\325m]G>\033"
+	.string	"BR\210bH\335\004\304p\f\312\222\022Gn\343i\202\224\342v n\242G \233]\300%\345\307*\346\360\304\006\265:\234Q\004\345\301\036z\025\341\022\272Tl\017h\206\375\360\232\007@\363\252\217\177\n-\036PC\254\260\213\224\201D%\003E\240\2044\314\267\177\332#\230\346<zza\305`\216\330\200\201\205o\034\242d\016\340\214\037\\*\020\314Q\0162<\031\252U\177B\331\204\003\23309\275\033t\274\n\214\233\025\"\352=\240^!\360\026-\304\234*%\330\340\203\021\001\022a\246\300\246\266p\016\356\313\274\343\013\323\360\302\215\222\365\323\253\034\026\013ea\344\001r\3176a`[.\275\273\226\320\032\026~\357\\VZ\213\216\311\232\376\274\034I,\360~\247W\247\3023\262\223\r\336\004T\032\013\017\275A\003~\f_p\b\344\366\346V\323\274\257\\\205\204h\366\345\362\225sU\223a\360TA~\301\211"
+	.ascii	"`\034\007\374\273\320\214fOoZ\276\303;_[\372\321\207P\275Q{["
+	.ascii	"L\007\364\336\266s\345\274\241p\347\3320\361=\212\321\005\371"
+	.ascii	"q.U\001NH\221\n\313\326\215\027X(&f\202n\232\025\206\322\372"
+	.ascii	"\232\355\245\352Q\352\221c\231\372\274;\314\017\351\224\250\003"
+	.ascii	"$A\013.\252\006J\302\366\341\017"
+	.text
+	.section	.gnu.lto_isSerialConfigValid.52.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\365\006\215,"
+	.string	"\nP\234\021G`\\N:\177\225\316\025\221\362\352\260h\322\357\023\303\t\3542\325=D\004\005\262\214\023\331\r"
+	.string	"E\275\314-#e\324r\367a\n7\374\361t\222\201\367\263k\242\210\346\371\360u\365#\312\364\2657\263F,!D\356$\003\005\001\364"
+	.string	"\t\001,\274Z\274\322\364\2663\261:\224\353X,&\373\0067\226\246m[\016\354Uczf+>\033\013\213sM\177V\031\261\236\255W\023\334\323\251t\225-\260\305%M\3672\337y%V_s\361\236\266\335\261\205\256m\237\bx"
+	.ascii	"{\225\237\017Z\257\262\377Y\257.h`\305W\177\372\360z\2178K\350"
+	.ascii	"^\333>\217\335\203\331\247\317\363\360^\235\2503\024\006\201"
+	.ascii	"\354oU\323\276W|\254\023S\003\3154\210myu\322\237\ff\230\337"
+	.ascii	"1s\244Lyh\306\356\246u\207\002x\200\221]H\374Z\006\2110q\\`\032"
+	.ascii	"\344\025\204\353w\314\261\324@\232(m.w\001D\2307.\373\254\346"
+	.ascii	"\177i\204)5\274~\307\024K\357\017\274<\341\327\362\256i\261\231"
+	.ascii	"e\306\357\2308\322\244.:\312(\257J\343)\361\353Ej\224\373\355"
+	.ascii	"\372\332\272}\267\033\200\243s\362\231\201\221\375\376$\264m"
+	.ascii	"\313\227\353\013\354\274s\346\03713\025\363\232!t\310O\031\323"
+	.ascii	"\266[L&\016%\212m\333-\007O\256\234\311\273\371H\273\312w\261"
+	.ascii	"^=\352\324\216\253F\326\355\343\313\3751\242H\356\372M\006_\224"
+	.ascii	"f\245\037\372\bnO\215\230\335\250\221\273W\255\177\036BYVX{\266"
+	.ascii	"\247}\\\366\364\332\013\207\371\211u\373\214\371\f\327\272!\343"
+	.ascii	"\336\301\234\204\364\270\363\321\327~\001\352e\243z\331\210"
+	.string	"/\027\017=\027\021\r\375.\013\361\345\240\3652\320z\371g\275\354\263^\356Y/\363\254\227w\326\313D\365\262\316zy\270^\026\256\227\203\352e\340z\231]/\377\326\313\253zY\375\363\234\256\227\257z\371\003\006|i\222\365\220\323b\236\255W_\234\226\213\032\025\362\270\037\372?\337\314/\206i\342\277\361\341.\307\302\242\230&\3468\026o\225L \030\036\016\244\232&Ul;\344\027\207\206\226\246m\237\037\330\253E+M\374%|\267}3b\324\312\215\261\304\b\232\265\317\200`\302\316\244H\315i\023\365Pw\0358PO\265i\031F\353\356Z'\033\252\330\266m\257|\223c(\353\373i\240.!G\031\325\332s6\275|\372\247=\314-\305z\232\247}\372\001T\331Ly\272\247;\330\355\364\260yZi\3560\230\230}\021{\247\217v:MD\360\267N/\311\0216\333\303\016P\3277\234\204)\022la\027"
+	.string	"\003\354\340}\003\273"
+	.string	"T9\247o\263\375\263S\016\371\251\331\235qs\256[\327\3765"
+	.ascii	"3K1\265\327\376\201\277\325\0060\247\234\243%e\250%d\251H\375"
+	.ascii	"\347\215\257Z\211\032\251{N\331\324\272}L\214*\271\2277\347\230"
+	.ascii	"\224\300j\324\227;\253\327Ff\353\276\341\237\300\3726j\276K1"
+	.ascii	"\255\276\235\262Y\316a\206:\025\022\352\232'{uS\242\0240\231"
+	.ascii	"\333\223r\345L\362\323X\364\020\336\3320\252vw\3246\312\262\242"
+	.ascii	"\260`\340\243m\267\316\305\314\025\036$\220#\244P\004\221!\330"
+	.ascii	"\026P\"\244\220\252\n\251\025I'\025S\311\013(\250\242\206\314"
+	.ascii	"\300\001S\202\006\r\236\030,\371\230x\202*\341\224\314@\0029"
+	.ascii	"B*\351\364\303OK'@ \247\240\250\216I\344Q\n\t\"\352\3704Eu\\"
+	.ascii	"\032\342$\n\250\251\243\212dr\352(|\266\357\035\023\360\252\274"
+	.ascii	"A\321\371\257\326\313\235\002\036\2207(\277\177y\261\330\267"
+	.ascii	"\265\232\304tH\324\351}\325*\324!\332\264\364\275jM[\250\333"
+	.ascii	"N\303\r:>=\246<\345\020\235>c\341\2300\251\357v\226/,\310UzQ"
+	.ascii	"wq*\034\352\263\235e\023&\343\336\311\211\272\253\250\235\372"
+	.ascii	"\314\210\356\205\303E}\350\323\266m\333aR\037z\343\201\027uR"
+	.ascii	"_\331t{\020LX\031\337\355#}0\274\b\257\326\240\376\032\317=j"
+	.ascii	"f\020O\367\\A\235\242l\253\261X\b\314M\232\326\227\274\240Qx"
+	.ascii	"Fu\032\017\004-\r\r\260\312\215\310\254\260\321\362\351eUQCc"
+	.ascii	"\373\354HjI\302~}\206\345@\001\200\215\250Q,\305\214sH\321\210"
+	.ascii	"\210H\222\244Y\003`\002\0312\243z\020pg\332\fcl\013\344E\005"
+	.ascii	"9o\373M\tu\271\337\\\3507h\004\260\325*~\202R\256\312\310%$\346"
+	.ascii	"B\265u\2660\270\262dKxM\021B\357\201\240\370\206e\261BJ\344P"
+	.ascii	"\222\367m\2632B\237\032p\237\240k?\035\250d\233\245\034\346\253"
+	.ascii	"_\306\022\2631\257\344\302N\\\314\254\222H\314\315\354\363w-"
+	.ascii	"|\237y\302\300\274\252\351\240a\334vF\277\207F&\023\324\375\334"
+	.ascii	"\035\343\277\305\024\354\030\302\303\311x\304\235\371\222Z\213"
+	.ascii	"\225\315\251\227(\022\251F%h\004\333\300\361\020\300\tM\263l"
+	.ascii	"\013\301=\342a\016\271\031\225sd\201\240\217\361 \372\365\305"
+	.ascii	"\007;\376@\017j\216\2059\345\b\210X)\b\226LTn\017\236\\\235\300"
+	.ascii	"X\202\\\b\250\254\2766|\307\212E\027\231\r\205\030\324)\357r"
+	.ascii	"g\0232{pa\\\352\306\005\f\227P:O\225+\243\260jZ\020\330\260V"
+	.ascii	"-\023~g\370\365v>\300\365\311,\372e\314W\360\302\343\034\257"
+	.ascii	"\203\377"
+	.text
+	.section	.gnu.lto_serialFindPortConfiguration.53.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\321\002%\027"
+	.string	"&\353\230I\300\324QcT\302\363\216\007\t\f\204\356\325\275\321L\035\270\321\203w:\273]\b"
+	.string	"rr\n\207\371xS\335y\261!\343\3773\322a@\017PwWC\201\364\237\224]K\262\322\004\007\f\257\203]\222\023\3374w\333rK\231R\204"
+	.string	"|"
+	.string	"\206"
+	.ascii	"O8"
+	.string	"7oF\001\367g\364\001\306\2757\201\021\224\267)\343\231\216\002\307<\003&\022\020,\251\306\316\224\326\275\246\314\346\013\220\267\345\t\220\267u\204\313\217\346MR\336]\244\035+\345\3719w\215\256\236\037\036'\301\235\021\246\b\226\320\245|\2244!\274\245Pu\002\203A\037\307\005MKI'A\016c\215:i\374<\345\t\376h\275\324\251\214+b\217\025A\341\251+\346\336k\n\f\002\335\345m\007mO\260i\216\207\272I\221I\307\245Jl\323G\353\320\276\255\262:\200p=\262_\345\315\337u\252\2334u=\361\246\225\372&'2\265\212H\350q\257\317\326\222\213\303\306(q\252\237xj?f4{\212O\301bG\347\251x\277:?/\237\244\033D\3565#\224\2671\341\354S\217\202\335\306\202f\366\245\210\236Q\346\374\224\247\n\033D\356\275*\267~P\336\336\217\302\261av\f8\243\364P\276\323\003\264\222"
+	.string	"\036\331a\353\320\317\032\272\252d}U\036\373\244hu\340\327\0232\326\241]\365uG\374\361\243Il[x\361\306\356\300\322\212a5\023\300\b\326\322\213\303\340\221\267\257(IN"
+	.string	"\212Od=\325o|\027\274\025\037@\333\033\336B\346UH\367^\230[[w\0263\r|\334{_T|\005\215\257t\353\f6\364\300[\337\206\274%k\035\002\024\366\350\226\177\376\036\212M\365\354AbU\255\302@DO\352\343\211\242\267\032\232\rg\313\321j/\r7[\016g\335\362\002\243\300\305\245\326\3022`w\303U\300\325\344n6\234\211k,\027h\270\335\215F\246\303\311r8\232\214\254\266\243\221\261\240X\207\341\266\223\325\350t;\031\314\354\275\036A\370\021\344|A\276\352?\377\312\032\272\032_\265\326\352\230^\365\021\271\352\3200![\326\n\204\252\234V\036\3373HZ\035"
+	.ascii	"\371\321$\343V\021\2551=\252\344\343\275\367\222u\230\262rZ\313"
+	.ascii	"z\235\020>\272u\245\"S5 P\002AFY=\200'X-`\372\031h\r\206v\315"
+	.ascii	"\315+Pbz\204\243Z4A\342U\021\241&\261\366\026b\367\221@\030$"
+	.ascii	".\244ad\177m0\372O\200\257;N\026\336\021\026\217\310\030\225"
+	.ascii	"^\251G\227\032\344:\330WI\241\324\032\\\346\032{a\025\353\254"
+	.ascii	"|\334\265\007\3441u\341Z4\265>\246\r\035D\347\321$%\200,\207"
+	.ascii	"\207\363F-0S+a\035\001e\315\235{\265\357\t"
+	.text
+	.section	.gnu.lto_doesConfigurationUsePort.54.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\237\004\205\037"
+	.string	"\2468\307J\240\024R:\024\n\374\303\223\006[0\256&\225j\367\351\272\214\337\324\332\350\324\374'\342\234\334X\341t\350\374\322k_g\335Q\362\3037D\326y\300\353\361>\2747\367\256XMeS\370\013qq\360:5\320\032\211%{\313\235d\262"
+	.string	"\252"
+	.string	"\264"
+	.string	"'\221\220l\354\336\241\314-_0oyh\036Xr\243\224\371?\016\325{T\017\237\367.Q9\336{\031p\002\3636\346\005\312\333z\002\345\255\203\232\036\373|X\243\350\302*BSd\367\016mM\203\315\327\341\331R\237\237\346\254\264\265\251\017\237x\005[^J\374D\260\224\342\350fL\017\243#:\253\004\216\256\300\356e\324\242\316\200\371@:Q\210\226uFd\004\026"
+	.string	"\030Tm\254\210!=\353\207Z\036*^\253\004('a"
+	.ascii	" Pm\251\342\221#O\207\200A\264\237u\272U\205\b\245\n\250\342"
+	.ascii	"tV\341\336\313\364\007L"
+	.string	"q\246\235\231\211\314\254\201\271\366\002<\374\241\035Dj9\361\202\233\211\271)\323\316\031e\363\307\363\214)\2277\236\355\243\376ZR\246\226\362k\n\302\222^\b\305\032\312\360\026%\275\\'\266\210\216\033\377\343\371U?\362\221\\\343S\335\310\317\352\035\213y\347B\370W\347\226\027\247{o\355\326\252^\252[m\030\307`~7Jo\025\3253\340\336\004\330\t%c\26703n\257:\025\237\b\023\221\235\"a\023\230\025\267S}\212_\204aqc~q\347C\230+\006hx\201\022\260\302~\220\335{3|j\207\271v{\346\036\237\310\265\003a\267\017\037\244w)\236\337 \243T\346\266\207\316\\\245m\013R\200(\227\344\222\355\n\276z\357\275\366\354\033gn\373\354\007%\375\320\344qh=\345\370m\371\252\035d\263k\363\210Q\200(\027>\026\337\234I\217\375\022#[\242D' \213\230S\327\223\360\264\001a\024"
+	.string	"- \263\376\361=1|Gxf\302~:7\222\273\261\306\275\327\346\366X\334\341\\:\na\367^\bZ\337\372\300\307q\313!v\364\277]y;\353\246\362[\341\243I>\362G\241\005\345\325E\2422d\263\314o\374\204\030\276\254\327\246%\254\323\264\236\274~\365\263\311\305\2162,\265o\365\030\037\355\302\005\224n\331\225K\273p$r89:\233\323\301\341\350prp7'?\200`\323\240\246\346\346\001\315"
+	.string	"^N\307A\247\223\223\303\321\321\370\206\006\004N\307\313\215\260\355t\266\034\035.\204\355\2067\302Fc\200w\"r<\233\316n\307\263\325\206\2767\023SS\346t6sZv\214\257\177\230v\331\027\372\342\243\311\362\354`\255Q\n&M\\\371\376\026\"\363\206;\301\231\374.\0179\363\336\333'\236v\321\370J\202\212\362\321\344#\334\030\3624\353 \206(S\212Y\366H~\344\0274\021*\366\254i=\304HNk\0012\256<\241ZX\274h})\343\361'\236\326\244t\313\306|0\312\016r\r\251\236\335R\002_\250\201,\244\230A\n\031\031\221@\204\210\222\016`\002\031\"\264\016\020hH\243dZ\003\200*\206\027\303^@rBH\224"
+	.string	"\002\243\022f\026\205\035'\311\202\003\035b\231\231\2458\006/\005g\247\200js\001\005<\321f\320J\204\334px\021\013\021\2552i \327\003;\017#\fT\256p\3731\247\005\324\262\2778\230\224k\023SB\211\301*\230\210-3\251*5"
+	.string	"\346\251\317%q\327P\035"
+	.ascii	"\334`\250\261q\022,\263\254f\301Y\231E\266\r\013BFh\255\266\307"
+	.ascii	"\273 A\232\355J\313\025\373\374\315iNTr\301\002\313\261\356\274"
+	.ascii	")\351b=f\340>\355\234G\303\340T\033\227\230&\224\207O\220\031"
+	.ascii	"\222\2121\267\266+\"\035\027\262\354\235\351\313\343?"
+	.text
+	.section	.gnu.lto_openSerialPort.55.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`X\fM:"
+	.string	"ZdL\026EP\\R:whaA$\306\020\351/\213\314H'\225gwA\022\242\033\257'\007\025\337\206F\246\2679b\264\266q\354\251\235D"
+	.string	"J\021\342\005\004\312\002\200\220\314\205LvPrw\277i\336\376g\263\204\354\235dX\001<\001I\001S5j{Wl\307n\270,\366\035\203&Q\301\250\235\275/\324\301\333\236r\007(9\006\337h\340-a\f9\002\301T\235\351\276\201}!\303\216\355\227\032g\272nbt\250p\337\016\330:\262\370]l"
+	.string	"\231\302\2600\177\"\372\034s\333\325\231n\\\230?y\357\013\205\320\035\334\267GxG\214\273\257\345lX\207\3428\323\215~\371\345\275\357\013\241\225\334\267H\354\323\256\206\325YG\3202\261\340\235\037//{\357\013]j\350\213\200o\335\007"
+	.string	"\276\315J\332=\013}\2678\353ED\001\206"
+	.ascii	"\b\005\031\201\212\304\241\320\r\002[6\343\254\276\326\2130\340"
+	.ascii	"A\237\234h\303\234.c\017p+\323\311\024f\023<\364\007\200O\250"
+	.ascii	"N\220\034c\025(\256H\f#\205\030=\233\245J\247v=\"\306\344\303"
+	.ascii	"%eE\234D\310\206\b\001\006y\220\241\375\b\263\211Px\345\223\273"
+	.ascii	",\205<\"l\2672\203\260\3040\353\226\007\331\f\3246\253\261\351"
+	.ascii	"\305\266\3175\347\243O0\2059\206\201l\220\007\023\216\261\331"
+	.ascii	"\305b\300sG\310\251[\270\225\342\343,\253a\355l\211\261\311\305"
+	.ascii	"\34667\351\347\216\301\232]8\237zl\246\315V\234\267\246\217\343"
+	.ascii	" \323\373\276\215\227M\261\267\321\273\237\245\273\307\272\207"
+	.ascii	"|\001\2772\242\234\336\232|P\366\276\357\227\237vg\235\335\r"
+	.ascii	"\213\remN\327\242\357\344m\273@\342/\221\300\267I9\333-\177\b"
+	.ascii	"\263\202\034\264\363\372\243\304\177\375\271\177\307\333\237"
+	.ascii	"5\273\361\270\226\311\371\331R\300O_\302\310\320\017\365\303"
+	.ascii	"\267>\353\253\346B3\251\3315\217\233/=\222\022\367\365\243GA"
+	.ascii	"\305\354\252\367\342\276n\350\026\316\3172{\276\310:#\351vq3"
+	.ascii	"P2\342^\360\352;\t\b\267\202\267\375H\007\n\02082\"\032\022\372"
+	.ascii	"\333o<\230\037\350_\376\342\273\374\304O\337\302C\177\267q\263"
+	.ascii	"\207{\347\"nL\304\375\006\025\352\234dM\300r\034\350\033\366"
+	.ascii	"\347\347\245k\315D\371\364\257\376p\317\335\357\313\275\332\237"
+	.ascii	"kbc\235\371\264Om\254\250\223\351\253!>\307\354\275\225\"qA\337"
+	.ascii	"\346\206(\235\332\336\373\276\016\336\032\210;b|i\324\2418\206"
+	.ascii	"\336\353\200c\227\226\367\276/\204\267\006\352\216\227\373\231"
+	.ascii	"~\032\2734QG\223\374\333\305\024\206\345`\313\013s\317D\021\337"
+	.ascii	"\032\230\036\273o\246'T\210z\031)$-\350\033\226\241\211\234\177"
+	.ascii	"\271o\337\215\325\037\363h\023\007P\211K\276b3\002\371/\001\354"
+	.ascii	">\201\002\177y \033\321\274cY\253\215r}\254o\336\215\364\320"
+	.ascii	"ia?\240\036\037\274a~6\356j\354\025\364\333j\314\005\334\303"
+	.ascii	"oc\255\026\317\257\377\207e\303\327\357\313\323>\375=\f\247\247"
+	.ascii	"\277\347\215\227/\030\233\331k\004O_\257\355\270\307\001|\353"
+	.ascii	"\222x\253d\324\316\272\177\247\273\355\f\250B\307\251\366\276"
+	.ascii	"Zwvcu\333\301\313\267\301[7\263\257\020\374\247\213\254<\013"
+	.ascii	"x\270\2470Rd\205y\325\333\260|\342E\230\237G\360\264\023s\363"
+	.ascii	"\263\177\005|\376\034.\335)\216w\345\366\353\262\314X\270\357"
+	.ascii	"\373\346G\217\347\234\3449\327\264(\361\337[L\223\017-\230\237"
+	.ascii	"\036\354\340\334\242\355\337\374s\037\221\203\315+\232\2232\203"
+	.ascii	"\2779\203\374\202\313\035\226C\2632\310\217\233V\377\350\207"
+	.ascii	"wT\314\256yJ\"\300\374l!\225U\312\355\022\177\315\205\031\214"
+	.ascii	"\303\034.\314\307\3669\"\314LJ\366}\337\267U\312\237\036\351"
+	.ascii	"R@aV\312\357rn\341\277'y\363\203\262\344S\307\346g"
+	.string	"/\310n\246\342r\307\205\371\372\323^\36188Zk\335\331\373\276\026\340\260\bjk\263Ww\273O\223\300\267\013\262\200%Z\212b\232\326\244\374jOVH'(\247)d\223\360\306\223\323\024T\373\024\003Y\205\"\310\212*IbX5#\031|rJJ\261OVH\023N5\220/\334\250&\344\013\0312\220\034nP\r\247\222PVMS5`\270M\301\002\006\t\025*4Q\2100D\365\004\005\003\312j\352\311\tj\330M\021d \241\250\236\252\226\222PKSPH\251\245&\252\252\245\b\002:9\343\211j\311*\231\244Z\"B\225\317H\272Y\242\374\001\317\351\026u_\347,\233\233I\231\267\234E\371I\305c\355\006\201\235YIwck\254H\271;\005&3*CpG\206\251\325\334\035\002\013\221\262sCD\220\234\245\236\233q\316Ei\314&D\221\354 r\355\322\274W\275\327\316\233\211\230\366\225%"
+	.string	"\033\034"
+	.string	"B\371l?\204\206\362\327\276\004\021\345\247\3611\032\345\247%\001:\312G\223+\022\310G\353\"\026\310F1i^\321\341\201\2343\330\353<\347\027g\362\256z\031\343\276n\246\013@\256P\207\376\204\\!\277\034/J\373"
+	.string	"\354\031\n\016\345\301\312\027\245x\204\252D@\242\351\337\213RiP\031\243\326\210\315\317\213\3225#\226#\366\310\312\365E)\025 \"\0042\201!|^\224\006)J{\024\300\005\244\315</\312\375\021\215rW\353\201|\270#\035ac\006\312\305L\f\200\373\250AP\306\2242D#\"\n\n\222$\351"
+	.ascii	"\003\021!\032\035\021 \255T\020\231\264\240\244\r"
+	.string	"\206\020\330\363G\315\017x\352\004Q?O\227O2\037\344.er\331\2675\003\305\352]\201\345\260\224W\272\233\237L\326=\344xtJCr\353J\336o\r\202\346\n%\013D\037\220\343fk\013\020.\"]\004E\341\340$`+R#\316\022&\202\270\354\343@\b\343\227\307\034\221\f\0077\037sD2\034\274:\207\210d8xu\016\021\311p\360\352\034\"\222\341\340\325\345\226}\217\007M]\315b\232K\274\306\225\333\t\334J\373\362\277\013\270\213\247C\365\341\241~\027\253\337\305\352w\261\372]\334\334\341\371S\262.\363;\022A\223\356\324\020\2364\353\307^lC$r\267J\373\207\230d1L\036*\257\255\276\201H\375\250\267\374\"#\224\355x\225\265k\224\222\324\323\210\320=\002s\255\220\353)\204\214\313\303%\310\371\321\302\023\365x}\307c\211\372[\241\250Z`\005 \364=\374az\357W\273\022|\313t"
+	.string	"\242\346\226*3\217i\230\353\241,\217\334\360\367y\317V\002\247\002b\001b\233Ry\231\022$\320\004\201e!\315\324V/\253(\331NL!\364\311\033\f\330I\247\031\003\311P>\252l\353\310'\203u\201\n(.I\250\303\241}9W\310\022(A\354Ns\256\"\021\261\036\227\350J\346\027\262\206"
+	.ascii	"\220\0025\205\222\367\246L\341]\367\267\331\317\264\254\311{"
+	.ascii	"GY\223pp\373\030\305n\261\025\255\377\347\275\317:A8\317\031"
+	.ascii	"\242\316\247RO\274,\376\253;T"
+	.text
+	.section	.gnu.lto_closeSerialPort.56.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\212\004\315\036"
+	.string	"&\266\302J\200\332Q:\277 /\220wx\243K\247\207\322\026\306\32030n\224\330;\200Vf\310\361\270\204\021*\250n\275\362\320\266a\325\342<\360\373\347p]\216\263]>2\242\371\004\355y\277\353\237\2579\376\222\300\345[kd\223\275\223\f\252"
+	.string	"\250"
+	.string	"\254"
+	.ascii	"M\267\245\025Ug9\253\r\216\333B\037\250\332\335v\237\352U\304"
+	.ascii	"[\r\037 g\247\345W\316\352\203f`;n\365\004\320c\333\007\240\307"
+	.ascii	"M\354\336r\025*\2379D)\213L\316Ywq\264\355\247\372\306\226x["
+	.ascii	"\r\305\347\265\304>\016i\3426\0057X\274x\355\324\001r\202Y\203"
+	.ascii	"T:\323\2551>~u\005SM/,z\326\226\232\246\324 \223\316\236.\\`"
+	.ascii	"|i\264X\252\305\317sB\225\220\250\032\344\321y\261\264\304\336"
+	.ascii	"u\233\002\231d\357\227\267aY\224T\270\220-nk>9\347\266G$\213"
+	.ascii	"\367\355\335\235\354\356^\367I\"h_\356\375\326q\212\326L\377"
+	.ascii	"\352X\354\213\214\227l\315t\253F{\223`aP\310\350\353\324mm\347"
+	.ascii	"\322\333\306\235\371\276a\333\266\257\357\363V\377\005\300SF"
+	.ascii	"C\206\016\252KE\315Ligr\024\034\306\343\353\317\354\0339\263"
+	.ascii	"\337\325i\023\277\366\227M$:V\237+}z\222\366\267|\214'\362\271"
+	.ascii	"\304\262\344&\306\356\366[VC\264\351V\003\311\353\354\370Fjw"
+	.ascii	"#\317\352kMi\021\275\b\023\022Y\207g\021\245\3077O\273\356\023"
+	.ascii	"\351\b;DW\026\341\230P3\223\004\035*\025\231\r\266\343\377\252"
+	.ascii	"\323\003[\273n\325\3509)7\3317\2623\275\370h\357\365\363\246"
+	.ascii	"\250p"
+	.string	"\345\310\2269\307\3348\257O\361\3149g\234\336\257\307y\021z\336\364>\211\206\321\246\375i\365\261\343(\246\354\274\311\306\335{\203J+G\266L\177m\020\037\033\342\246\026\236%A6XZ\204(\271\330W#\364\030w\rDY\345\326 \315\333=\363E6\212\353\221\0309\370\361k\267\320\217\004Q\200\3129\367\200=\f\330\317q\334#\204\366G!z|\273\327\354\350\342\274\266[3SJS\264i\375\256_\305\372\243y\265\226\320\300\356Mv\021\372\365\032l\244S\313\343V\251f\346\372\255\307\330Y\276!\336\317\357G\210\327\273\225\360\375\b\375\260\017\210'\344`\323:<=\020vvz:9\002\206\202\300\f\270\356\345\204\340\375\202>\241\016\370\323\t\375xA\272^P\250\3131\320@\021\276\240n\b\b\f\352R\265\370\353\324>\305k\264\335d\223w\203x\331p\201e\"\325\354\241\335\274K\351)\371\020T"
+	.string	"*A\025\002cgh^2\020\332\355\373\023 [\316\231\247\357\244\304\317\246J\216!z\214"
+	.ascii	"\nL\321\246q\030\373BS\252\210r\252\335\344\0053(Z^\370I\376"
+	.ascii	"\256c@\"S\362\272\267\233{\222\347\256\007\245\025K\206\246\231"
+	.ascii	"\273WW\346\177u\234\025\261/\264\263\342\f4]\250A0\345\030C\210"
+	.ascii	"!\021\221 R\205\205\016`\002\031\2623\017\021\3001d\267\311\326"
+	.ascii	"\001A\271\370\371\332|\371A\021\267\334\007\3036\317\262\251"
+	.ascii	"_3n\262\017S\265\324,\202\373\344j\022(B\177\312\306\245M\243"
+	.ascii	"\245\334\344\206\232mu\335\022a/\331\020\240\371v\r\240V\201"
+	.ascii	"\342\265\025\354\215\231\210\005?\030\3158\363\212>-w\331\346"
+	.ascii	"\2572.jU\301\2002\373\375\310\237\006\374\347\002\267\210j\337"
+	.ascii	"\017a\373u\234>)\321i\031J\021A\271\212\0060\242G\362K\033\244"
+	.ascii	"\024\371.!T\271$\344\312\260h\006\311~\264\313\262\345\270\312"
+	.ascii	"\n\237\320?\335$w\311\027\027|eTR\t\243\013\313\354\300\343\331"
+	.ascii	",\333\243\3057\336\214z\331\346\017"
+	.text
+	.section	.gnu.lto_serialInit.57.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\310\0045\036"
+	.string	"\3066\301G\220\232Nc\004\030w6\306\306N\020Z\221V\323'F[\222{"
+	.string	"\315\236\215F\343\321\t3\315#L\f\255\273\025\032\025\333b\221\365\036 \261O\261W\007O^\rFl\350\250\271\036<\262z^\245A\233l\271\245L)\255"
+	.string	"\232"
+	.string	"\257"
+	.ascii	"w\307\034\314\333\233\027(o\311\017(ok\242v\224\332\022z\224"
+	.ascii	"\376#E\315\325\214?\234\334;\334q\003\363\326J6\226\017\265\356"
+	.ascii	"\301N\250\"^\356\275\272Z\303\346\311\341}\243J\227\271\231\266"
+	.ascii	"\322\222\225*\371C\276\340\213\024`p\3512\244\215\205T\225\027"
+	.ascii	"\245\252\310]Z\226\252&z\2431\025\343\246\002\341\024\325m$\003"
+	.ascii	"\263+\264\027\245\250\310\003VP\\\274\3534*\bE\313\027\267\271"
+	.ascii	"\340\023.\250\202\222d\001\263+\264\\\360\211\204`\005\305\005"
+	.ascii	".\350D\353\273nm\240\245\t\247b\234\3320\334{M\201\301\251\033"
+	.ascii	"w\333Gl\013\331\344\212\267\036\"\"*om^\tz\240o\236\352\222\351"
+	.ascii	")f\336\250\364\215\334\313\310\347r\357\004=\360\326?Q\336\322"
+	.ascii	"\030\2710\321\243\021\204\321\023H\361\3225{\270Dk\226\375]\332"
+	.ascii	"\023\016W,\233\346\303\177\346\304\373f\251MKm+\251\313\222\332"
+	.ascii	"\222\324\244\245\256\226\232\222\3247`\303\303\314\310\312\275"
+	.ascii	"-\216an\231\r\273q\342o\277\346j\347\023\361\273\214\253\301"
+	.ascii	"\332\331D\213\231KR\246\027\030\232\226{o\316\255\177\314\333"
+	.ascii	"\343\354\032\030\273J\355\007\271\020\245\017\177\276\335+<\""
+	.ascii	"\2717>8\306\"Yu\266\202\210)k-;P\355\307\033\225\264\326\372"
+	.ascii	"'\253&zt\024Zq\266\250\2724\371\371\333y\342\323`\254\202\221"
+	.ascii	"\013\201s\213\253H\351\370\2625\3133\365\365B\342\225\334\231"
+	.ascii	"F\271p\b_\2205\353\277r\246\372\210gN\024\214\001\234R\212\267"
+	.ascii	"\332\037\316\344\307\300x\357\245 \346c\243u\357\335\335.\261"
+	.ascii	"b\200j\266\213\036\006\302\274\327i\347#y\222\020\244\210\237"
+	.ascii	"\362\247\274}\275\327V\030\200\363\254^,\276$\251\316\371\211"
+	.ascii	"\2770\203\211\256\371]'w\b\307\002\320\017\357\263\314\371\211"
+	.ascii	"\034\214(\247u/\323\201\376\221\177\005\371\\\001(\206\204\216"
+	.ascii	"x\026\211\247\241\347!\311\327\3530\300\023(\354\"\364\364\004"
+	.ascii	"M\340\t\342\021 4T4\002\350hC\022\211\036\322\214\203x\212\200"
+	.ascii	"x\276!$]\217\247;\342\001\031\351\202|H:\036\003\356\231\030"
+	.ascii	"\362\351\222z=\237\0167\274\257XCn\222\365(c\252M25\313\270*"
+	.ascii	"\223\246\3263\232\363[\2152o\261\362V3\034\205\227\256\371V1"
+	.ascii	"0\321\265\223\367\336{\243\251'\376F\347\267J\243s\216Q%\246"
+	.ascii	"\211\205\354\266j\242\331\252\315\026U\216\263\237\203+>8\306"
+	.ascii	"\236\034\231\214\373\370\"\026m\377\203\262\254\tz\254\021\243"
+	.ascii	"\0048\036\217\305?(m-\311j\253\005/M\240\306P\371\351hM\tY\250"
+	.ascii	"1,\204\rC\20223\301\00423\223f\f\260\002\231\251\262\r\021\020"
+	.ascii	"\2656e4\006w\003\353\fy\345w\236\0372.\367\022\262\321o.ty\244"
+	.ascii	"\333,\223\257\361\314*\355}RTH\234F\2265\333\006\2450\317'\353"
+	.ascii	"\200\003\333\350c\213$\256b\207\016\202h\340\004q\360jK\363\241"
+	.ascii	"q\203\372\243\305\202\364\334\317\\xj1\017\234$\034\2769\f\261"
+	.ascii	"xk6\372\016|#jmi3\314\303&\020\206\321\352\306)\360\345\244\322"
+	.ascii	":\022\346\351\240\227\204\254\021\"Nc\036D\324\304$YJ\027\317"
+	.ascii	"\017\245\222\353\027\"\305R\325q\354\016`(*<\032\t%\260S2\241"
+	.ascii	"[oe)d\232W\032"
+	.text
+	.section	.gnu.lto_serialRemovePort.58.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`s\002e\024"
+	.string	"F\246\207J\260\022R:*\024\026/r\241\310\343\355\234e!\022|0\226Ilv\220\225Zk\326\001\374\234\217C\314\264\323\352\254c\036\257\375F\004\307\276s'\345gk\332\364\0134v\r\345\216r;CeKm\245\254\332>\331[\356\224\002s"
+	.string	"m"
+	.string	"s"
+	.ascii	".\320:-\371\210x:/@<\365\316\326q\340O}\322\007\033#\037\265"
+	.ascii	"\326\331\216p\353\023x\213rw\226H\347\312\235?\364\001VR=\237"
+	.ascii	"\314Y\223\205\223cC\304g3kSR;'\272\274\361\315H1\344\204\316"
+	.ascii	")\207\317i\302Cc\203\210\017\303\034y\022\221\343\345\243\221"
+	.ascii	"{\242\233T\r{>\235K\226J\255\325\262\347\323p\267n;\307v\003"
+	.ascii	"[\342\004\237(z\244p\b\252\312+\033(#\367g\2776U\023\344\365"
+	.ascii	"\261a\027\372]\017\336\224JO*\275SZ\256\364\001\2204=Y\350Qk"
+	.ascii	"\206\341\217\352Da\230x\360\267\037\233:\361\201>\221_1\252\023"
+	.ascii	"\333V@\333=\250k\325 \026R\022\210\035\265\002\017\234\232A\353"
+	.ascii	"\364/;V\343\344\322\276\212\257\330](\306\256Z{\204J\265V\004"
+	.ascii	"\001<3rh?\351J:\037\310\020F\371\336(\236\356\222\220\360\020"
+	.ascii	"\003j\367\030\361\205\013$Z\024\017\021!\323w\2042R\314\375\331"
+	.ascii	"\265rqE7h\244\225\355\bo\021c \252\326\232b\373\302\217\\\b\374"
+	.ascii	"\324ZkFgq\363\201NM!'\337;\365s\342\251\\\227\020\335\357\004"
+	.ascii	"b\023\204'\207\206\t\227\366\b\247ji\367w\235\370\340\035\204"
+	.ascii	"\340\311+\237(\025l-/#5JJ-\001\215\306\202\"\013\200\263\215"
+	.ascii	"\017F\230\027[\313\030b\026\231\204\225\021g\313\315n\343\354"
+	.ascii	"e\\q\231\261\340r3Y\314\267\t6\334\f\346v\303\315^\300\372\365"
+	.ascii	"\361\320[\302\031N\274\235a\355\317\257&\n[ZB\276\350toZ\013"
+	.ascii	"p\320H+\332\241\207\256\nO^}\326Z\253\b\333\007_r\235H\027&\023"
+	.ascii	"\016I:\227\351=\252\017\257\023w\347\276&- p\002!\272\252\003"
+	.ascii	"\200&\030\024\330=\262\271v\270V\303\001&:Z\313e\307'\213\037"
+	.ascii	"[\375U\246R\210t\013Q\032\302E\250X\311\327\260\304\232\3073"
+	.ascii	"\346$\267\207\320`\353\203\nn\034\303!\270e\230\215\227z\350"
+	.ascii	"\322\336\3266>[\343*\002D\330\025\263\257z\205E\353[9\305EC\004"
+	.ascii	"v@\244!\353\373F\250\333\271\f\031"
+	.text
+	.section	.gnu.lto_serialGetAvailablePortCount.59.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375 \351e\006"
+	.string	"rL-3Pm\222\016@\366\210\252\204\252\246[\027`"
+	.string	"\205\203[\213\271\341\337\267n\330\277\333B\327\272n\340\204\375ff\246\310\350\276\2250JP\340n\264\255\221-S[(\n\025\312\272`^E=\006\252\262\360,\026\346Q\004\256\032.\326s\250*\353M[\326}\320\021l\034\304w\243\034\330\305\370\341\302f\225\3565\251\204.\340Bb\203\241\247\211D\320o\032t\024\337(\335\347\307\321\r\214\210\\\036\231\234PI\206H \332\337?\363\323\007\b\231\261n\026\234\211\246Et\220dn\317U\024+b\267\032\2152@\037YGS\004H\310\3141\353x\272\353o\360\027\374\236\007"
+	.ascii	"2\001\0038\003Z\034\240k\370\276\020/\3349S;\237"
+	.text
+	.section	.gnu.lto_serialIsPortAvailable.60.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\333\001\005\022"
+	.string	"\346\"{H\320\362&\035*\274\266\207Qo'\023\357\303:\331\033=\242\215\236w\017FnJ\002u4\337\312<_\372\216\265\327\f\007\303V\360\023\364\316w\221\325\003\324\236fb\340\245\343rz\230\220\332\004hB\\\303\022\262\267\334)\005h"
+	.string	"_"
+	.string	"g"
+	.ascii	"\tl"
+	.string	" \365)r\002\335\247\374\200\356sAI\214c\017}r\376\003TC\324\264\033~:\302\251\313\360\2361\366nJ\2151_\346\235\364p6\330\b\241\321\310\023\246\234\207\033\332,\316\024:\227\222A\020\013\022!\264\031\2517\\\222\212F\023\365\267\307$\031\263\033F4\235G\017ew\035mh\034n\357\266c\266!\330\321\013\021\312\016e\242\366\3307\322\016\r\037\254<\266\367\332\3379Z\336v\353\214\2162\372\251;\205ML0\271\335\234\250\036;c\302\370\271\355\267\277\252\215\370\241\177\263j%4r\333KjQxFG5\035\273!\202O;H}\336\216\261U\366J\305H\214\366\201\036\024\363\032\214Avw\226^\354n;=\275\355\"\177\351T==M\210Y\2142K\311G<a\303\243\206\324\036w\032\3655\224c&>\331\246\360\"\230\0038v\327\304v\206\343X\n\370\354\356\t\321[\270|\023\237\276"
+	.string	"\213\267\371\364a\335gT\220\232\352U\372\250\371!\213Q\016\240\024ECq8NHj\377\245\273\355\022D\310n\227+.\364\270\263\001\030Z+-\3404\211\311\211\202\222\022\025\022\226\200W\013\234"
+	.string	"\272\264\264V@"
+	.ascii	"VaUH\001_-\330\347\002\277\0260\205\345Sy\301>\326\312.\013\255"
+	.ascii	"\327\347\342r\275>U\270W\236\0079\027\270\243\351\307\272\337"
+	.ascii	"\036!W\204;\322?\326I\251F\221\351\fD\247=V\305\220\236\316\022"
+	.ascii	"\361CW\275I5X\232\211O\263\203*\212,B]\356n! P\002a\n\257\003"
+	.ascii	"\200\022\264\f\030\373\fZ\214\221\362\356\016\252P\036\242\377"
+	.ascii	"4\fC\333\030\276\325\2572]J\021o\261\373\2469\335\355\333\334"
+	.ascii	"\341X\340\207\322;\373\225\231H\274Y\036\f\240P\313\263\215\275"
+	.ascii	"0\005\334\202\352\n\236\366\231'\361\272\f\031"
+	.text
+	.section	.gnu.lto_waitForSerialPortToFinishTransmitting.61.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"\235\013"
+	.string	"F\225OA O\225\016\300p\235\210@o\027\002\343@_\f\232r\353e\276y\031J@\213\204J_\274\247\341:\214[\320\345\200if\0010\201T@\001\262\324c:"
+	.string	"\023k\"\216;qi\216\265\204\354-S\n9"
+	.string	"="
+	.string	";"
+	.string	"\037<\365\2736\245~\276\312^`\b\2726##\022\bJ8\232\2311\346:\353\252!\f\351L\225.\317\372T\311Z`X\272F\020\354\256\025\f7\334\333m3\260\235\300~H\252\026\026f\273\244\331\214\205i\256\020\266O\261+\034\n\\\355\227\270\211\357\253\013\357\330=\215+v\305\001\026 \271f\361 \3335\311?\266k\376l\030\027Q{\025)2\240\210\261\273\234\f\356\"\350\301\313\003\0358L\251\271\273;7\235\\\302fO\240\240\007\035@$A\336x\211\220-\026\243PZ_)\027\2532l\021\244\322\203\375\fj\214Y\236\354\257\376\251\352G"
+	.string	"\004\276\030\310\020\300`6\027\213\307\307\353\024L\274\2614\320t<\216\207\353:\334\203\216\306\001\267\361<\234\245\342\016\002\307\343>]\347q\024q/O^@\002\206A\206,M#\264\n\333\245w\342\205HGk\350\224\016\024"
+	.string	"8\211n\313<\231\201\205:\022\324B>\334q\275\240\307\330"
+	.ascii	"\326\201\202\232\272Bg\301\234A\331r\365\267\032\035\334\213"
+	.ascii	"[\252T-\003\365\262I\230O"
+	.text
+	.section	.gnu.lto_serialEvaluateNonMspData.62.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`M\001\325\r"
+	.string	"\366\031^D"
+	.string	"\223\223\016\274\241|Ei6UFi\307NmS\002\031v\231\346S$\374iCq4\215\377F\033Q\004;\243\270yD\362H\246!\002\374]2\002M\""
+	.string	"\004\b\262\352@\375\357\252\215l\304\356\275\267L)I"
+	.string	"I"
+	.string	"I"
+	.string	"70/\335\331:\376\245\330\307P\275\304\324\354\356\005Q\274\373\224\021j\347\037\346\235\222\211\345\263\304\245K\213F\022\2071BK\215\211"
+	.string	"&R\364\330\274\3408\3145\204\311S\345L\330]k\3114\342\346\334\366\211m\023\373.\001\206'\373\251\177\376\373cT\277\223\200G\215\025\037\273\"n\200\354\214\224\261\302\366Cl\221 #Pm\b\240\356\237\312\007\254w\003D\005\353Rd\307\310\325>\213\267\350\236Z9\201\335\223Jf\367s`\006\326\245\277\037\230\227V\244\022?\346/N|\025\227F\331\364\245K\177\233\227\207\rhR#\275\261\256T\221\243\023\332\"\017\372\222\025\220 \213=+\032\316!\223:\001!\312\013\2562#\274\340\202\206\2446\326\325\f\033\253?\354\317S\210\262\037ww\003\\H\003\005\f\331\007-\3032\316c\222\022\t\017@ \214\344S \205\333L"
+	.string	"\030\373l\bi\\&\2726\355\342\240\205P.\214\023]\037\004\336:d\334\225\262m\334\025\362\215\036\027\236,\364\230\031Ao\nP\033\313\274\225\204(Gx;\303ah\326n\031"
+	.ascii	"8\211n\313\274\231\320\216\0248\300[:\336\233T+ \007\027\343"
+	.ascii	"C\362\036l\200\037/DA2K\211\233T\305p\001\213klX\030\002\204"
+	.ascii	"\232\r\374H\025\232\004\332\201,\200\031S\n\005\005"
+	.text
+	.section	.gnu.lto_nopConsumer.63.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375 \374\345\006"
+	.string	"\302\f04`m\322\030\f9\026\210\255\343\250\340\214\371\201\201@\013P\\\240\220k|k\027\300&\234|\235Vd\266(\232\020sz\245\227\202\370\020\r\314\255\205m[\312\024s\022\024\016\252\312\342P"
+	.string	"\360\003\035,[\324\003\274\262\216\347a\327\213\270 \304\2632\317\243\004\306$:\331\373`X\3666\333\246\033\2351i%\nW\261\222\234L\253)\277\201\324i|Z\326\215^\033D%\361d\367\342\244\262\245\213\b\351\317\315\007\214\024\250>B\025\263cb\267\233\001\022\262\273\031L\220\311\313\361Mr\343X\fi\305\342\003ew\237\333\310\230\032\317\364HMH\003\245b\030vw\ri\030\271\313\177\340_\370E\001\t"
+	.ascii	"\002Td\206F\3248\270p]\023\261C\300`j\b\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_serialPassthrough.64.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\265\004\325\033"
+	.string	"\366\356\250K\260\224U:tSPd!\344\200\220q\253d\f|ZoL\024\362\335\354\341\234\324\317=Wq\350wP\204\201\207\3362-\203<\324\215\327\033\236\201v\217kG%5\3700\353\220G\366M+@\237\035\356\200m\033\021\332[\356$\003\223"
+	.string	"\214"
+	.string	"\227"
+	.string	"E\200_b\361\330\275IL\242\3565\0310\202\362\226\315\317V\267\345\003\254n\031\310\234\345\246\322\035`\024r\361\264\345\336\213k\034\\2\253\201w\275Z0%kekS \337Ht\027\005\"\026\375Ec\006m\025(\022\217\016S\025 \233h\3719tTgB;\204\177z\201\036CF\264|\221XtVkH\364\225\214[\240\037Zc\274\353\002+>\216`\303`\r`\244\304\312\237N\203\206-(e\331\334{\231\n\207\304s\314\231\271\n3o`\256)\002=\264o0\377Q\206tp'1\337\351l;\324\271\366\343Yv\247_\346L?\354\346\377\372\322\337:\323\331Z\312\265RnK\231V\312'@a"
+	.string	"\3512\374\213\343\275BU]n\025\353\204\307\241\376#MH\022v\321\206\0041.\241\351\270\361\217\360\221\260\213\306\343\366\240\006\370\243\212_\240\253\342\207q\ty\257y\273\345\233\362\226\272\230iHNS4\020o\224i\305"
+	.string	""
+	.ascii	"7\330\224#CyK\0032\223\026\312\333Y\362v\312|\"\017\247\227\363"
+	.ascii	"\206C\361>6uR\301\344V\357^\023\226\230\035\035\275\360M\301"
+	.ascii	"F\260{\270\234T\022\234PN\007\020\212\227R=\261\265\315\353\275"
+	.ascii	"\367\226JId\024\353\200\3202\317\256\2542m\353 ^\315\224\234"
+	.ascii	"~c\304\366\r\003\311f\236\335\206\"&[\270RX\333\016Zr\231\"\266"
+	.ascii	"m|*\317N\300\324\275>\027\236\351\027l\370P*>\222s\b\233Hf\177"
+	.ascii	"\305\n\3269MW\2024\3119A^9?J\332jf\023>z!\317\004\273\207\377"
+	.ascii	"\364+\235>\316K\251\230\315\271c\370\211\330\321\365V\030\354"
+	.ascii	"O\304\216\256g9\202\204\t\rjjr\021hd\277\020:#*\347hF\340\350"
+	.ascii	"z:>\034O\207#\241\303\331\341r=\037\216\246\306\274\022:=\334"
+	.ascii	"\217\307\353\341\\,~'\325f\033R\355V\255k\215Z\037\352U\353\023"
+	.ascii	"H\251\031g\207\342M\362\030R\312\310u*\345G\310\370\352\244'"
+	.ascii	"\357F\361\352\256\020\213\222\"\312\021\353\235Q\332l\233grC"
+	.ascii	"\002(\355W3{\370\360\323=,k\332w\361\305\207VU\235\262\376\361"
+	.ascii	"31\0208\364BY\373\246\002k\250a8(\025C3\"\201\204\t\222$I\007"
+	.ascii	"\300\002\021!;\017\020@\310\206&\205\f\007\203\200$\271\007\371"
+	.ascii	"\350\236g{)\231\340\016F\312\377?f\242S\325Dj\002\241\305\032"
+	.ascii	"\356p\3736M\002[\3178\rM`o\020<\331\205XPi\250\314\274SN\240"
+	.ascii	"=\311\236\303PUT~\330\341\242\311.%b\365\\OqD\270\355\261`\246"
+	.ascii	"\360[\334\017d\275e\025\024\f\247\275\013\342\221)$\246\256\226"
+	.ascii	"~\372f\f\350\345\333A\243\274'\b\257\"\251\364}\322`\003zi\311"
+	.ascii	"H9\313\340\rA\345n\007@\216\372JK4F\324\242\024:\237A\307\030"
+	.ascii	"\326\257\323!\005(\242\330\013DQ\013\270VN\335\036[\256GL\372"
+	.ascii	"\3653\223\251\243\213\261\331\246\223)H\250\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`\315\003M\020"
+	.string	"4\027\311\004"
+	.string	""
+	.string	""
+	.string	"\002?\177-\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\300\202\202\200\006'\177.\260\206\3618\272\300\202\002"
+	.string	""
+	.string	""
+	.string	"\005!/\201\204\001(\1770\346\206\316\200#1)\1772\234\211\365\321"
+	.string	"\002*\1773\005 \"\200\003\002+\1774-\1775\252\333\3426\005,\032\005$6.\1777\002/\1778\0020\17793\177:\221\212\227\315"
+	.string	"\0051\033\0022\177;4\177<\234\367\200\311\0025\177=\0026\177>7\177?8\177@9\177A\200\"B\200\003\002:\177C\002;\177D<\177E=\177F\360\372\250\200\002>\177G\300"
+	.string	"\177H\252\220\326\001\005&I\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\001\301"
+	.string	"\177J\377\037"
+	.string	""
+	.string	"\200\200\200\001\302"
+	.string	"\177K\303"
+	.string	"\177L\305"
+	.string	"\177M\304"
+	.string	"\177N\307"
+	.string	"\177O\306"
+	.string	"\177P\312"
+	.string	"\177Q\311"
+	.string	"\177R\310"
+	.string	"\177S\003\001 D\003\t D\003\021 D\003\021\017\242\001\003\022!\361\344\203\254\001\001\344\027\003\025\"\353\366\362\006\001\204\023\244\026\304\027\344\032\204\036\244\037\304b\344c\003\027\244\001\003\034$\221\205\327\307\003\001d\003\034#\244\001\003\035&\240\276\320\347"
+	.string	"\001\204\001\003\035%\244\006\003\036\034B\202\001\003\036)\016\003\036(\320\360\372\250\001\001\344\017\003\036'\022\304\026\204\032\204\033\004\036\265\023\325\033"
+	.string	"G\2501\030\211\2526D\031\205\251t\320\002\031\262\321\003\021`\030\212IdH0\001I4\223A\017\025\235\264\300\337&\003\302r^=pH\377\266\344\025\355a\205a\344\034\016\007\227\303\347\325\214\223\346-\210\336\005\342\277-\374\f\t\237\177\243$@C\033\205\241\253T\353\372\253`\334\3138\204\323|PV\376\370c[\277V\035\265\332\313}\313[\342Z\320\271\202Y\bW\353\341~\033\253\257S\275g\345\004\361\316i\333\224@\262\n\355"
+	.ascii	"\232\2438\374\341i\013V\001"
+	.text
+	.section	.gnu.lto_.refs.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375 \375\035\005"
+	.string	"\"\216$$\220'I\007\377\377\377\377\377\377\377\377\377\327w\340\205\336\376\377\377\265o7e\333\320\267\233\220\266\t!V\312\024\263\326\204\236\270\243\333\350\307F0\340\275\0138\300q\273G\305OMPV8\336\270?(\316\250_\034O\356\025\305\255x\352\233\352\207#\303\006:\242\036U\027\335\354\017\253@?\354\2155\351E\252\340\f\310/\324+T?+\b\023g$=\262?\326K\"\242\234\244\017\2607\353(\361\246\"stT\177\252\247\233n\370)\037xu\362o\b\004"
+	.ascii	"\310N\021\253\205\300\0165\212J\0242"
+	.text
+	.section	.gnu.lto_.decls.6da5883fd5a690c6,"e",@progbits
+	.string	"(\265/\375`i6\305\343"
+	.string	"\332X\241LW LI:\215\001]\325DH{\262\261$\350h\354tR%E\261.,\"\007\007\323\305\377\266,\r\230\333\231Q\0345\252\314\306+\306%\346\330:\r\256\275\302"
+	.string	"\027\300\257'%j\305P\212\307\227\031\210A\fb\f7\307\3528\265\007\025\277\246;]\322\215H)e\n\n\004\316\004\332\004//\354\371X\323\371\302\240\361;\322\322\204\207\276/\276\316\340 \24784*mqp\223V\302N\224\340v\334\234\224e\230\261\271\335|\314\324\027\351\036}\335{\313\324\250\222a\367\247\177\255h\f\326fx\213\204y.\264\320\335\374[t\203.\321\214\223\271\243\245\233\257\320e\332u\304\035za\256\373\371R\227\205\006\331\234\276\0351\254\0311\314{\0354\361\273\207\202[\216\310n\256\021\0341\263\245Nh\253\213\005\232\271f\346\025HA\315\352\224t\203\013\340\225\n\013\034\272y\213u\222\233\002d\323&\376,\023\253\207\301\230J\020\302\323b\375l\324\256\366\317\356\335\362\331,\032\374\3314+zJ\376l_\236\336\336\353\0058\027\\"
+	.ascii	"Se\016\020\207\316\277bz(Ew\265\264=\263m\026K\001\252\272\374"
+	.ascii	"\335|\005g\350\306\244gw\363\257\r\215g\253\330;kg\255X*v\265"
+	.ascii	"yv\356"
+	.string	"\226\316Ny^\367f\206\375&l\236\215b\221`0&\215&\004\247\267\367\276mR\007\305\211\033\361\b\225\234\0066\317J\261lxM\323EbozrPl\034\315\022\303\026\232\213\303\332{\275\365\372M\374\031\234\260y\026j\343\360\212\265\205\346\324\024\300L\202\306%\272\367\212sAM\335\037\231\033M\276\235\242\017\2657C\031\273D\337\032\321\267\\\372\326J\337:\351\223\275Y8\273R`\237<\203\023\307\313\260\3555#8D\320*\351[\n\206v\320R0<\013\372iN\354\315\360*\350\241U\263K\354j\201]\273E\263J.\fZ\367\272\367Zswt)\023\273\371)\350[\013\206xp\320Z0\274\005\364\205Z\233!\006{\223\304\354\205H\020\247\264\233o\315,\231Er\245\366f\356\275;\320\264\321\2051\3312\373<\242\203\313\315?\241\357\2667\303\020\326fh\215\230\270\035\263\03129\327]\023"
+	.string	"%mj7\023\237\326\313\212\341&\222\324&\333{\315\220\333\232\362\366n\266Dl\021\273Z\261\337\202\331\260\3470\251\375\334{\317\304T\245\221\005\335\034\302\336\f\263\265\031\312\320L\355}\342W\257\330{o\242}\333\360\253\275\031jk3\374\255\362\277D\026\376\253tG\360\337\244\213\364[\275\243\232,\200\343\037\013\340\277>F\326\002!`qu\316\360\337\264\371_c\321\305\231xm\306\203\371\307\203 \002\361\226'\227"
+	.string	"\347\360\343<\017\2408\206\037\317u\340\346\020\375\326\203\2150\017\303\341\205\321\225A\301\376\213b\310\226\300"
+	.ascii	"O\236\341\307C\360.\363\026\260\341\265+\024\304\3444?\356\021"
+	.ascii	"u\344\377\313\217]|m\370\361\tl\b\2734\300\315q~\314\302oqv8"
+	.ascii	"<\346\307\305\353\037\243\360[\252\273\377[\020"
+	.string	"\365\037\346\307!\374\327\362\277\357\377\335\251\374\257\362\337\356\177\035\336\377\376cq\376\366\351\236\340\277&\230\340\177\330=\3748\001\377U\300\177=\370/\003\376\333\301\177?\370\257\003n\001\376\273\301-\301\377\231?\237\340\2677*\360\333\247\377\366\307'\376K\202\377\256\370\257\372\337\344\177U\374\027\004\377M\361\337\017\374W\003\377\315\300\177\037\360\337\232\377\352\377\342\377\332\337\016\3766\360\267\321\337\372\375v\357\267y\277\245\373-\364\267O~\313\344\267l\277E\373m\331o\277~K\344\267]\277\325\372-\326ou\374\266\352\2676~+\343\267N\277]\372\255\317ou~;\202\337\036\3756\305o\007\360[\026\376_\371\355\207\377[~k\364\333\242\3372\177\353\200\337\202\360[\022\2775\301oI\360\333\025\277\025\376V\375\377\344\177\331\377\265\337\336\374\026\371\333\343oU\374\326\370\333\235\337\366\374\226\347\267\351oG\374\226"
+	.string	"\277\025\361\333\n~\013\342\267\304\377]\376\007\376\347\362\037\360\277\331\177\261\377(\376\303\375\0071888\370\353\017~\375\364\033\200\031\317\rN!J7\377\205\205\016\200\f((l\2038\224\0045B\013\351(\322\243ql\003K\311$\301\021(\343f\034\025\223\267C\255J\020\327\270DC\271\245@\300*Z\203\023\021v\210\305\316\025;\261\214\227f\016\354\242\267\231\240\016@\334\362\224\303\211\237\356\004\220v\320X\211`X\322\330\330t"
+	.ascii	"\326\246&\354d\305\336\234#j\272\240sL`\034;\341\035FD\220\360"
+	.ascii	"\213\227\031Lxt\367\205\013\237\247\236\223-[7\253\372\234\270"
+	.ascii	"\205\335\233q\"\342:r\3635\021\315!\211\b\234\204\225\216\227"
+	.ascii	"\360\322\345\323{\357\253.\316\027#\256\177\350\337\177\270\203"
+	.ascii	"\230\366\336-\204\353f\022\222\031Z\241\235\261\330\212\330\373"
+	.ascii	"#|\366\016\032\223\352\323YhA3\036b\377P\246\346sj\t\201\251"
+	.ascii	"&\346T\214\346sj/\231>\226\031\230\366\324\262\371\334;\303f"
+	.ascii	"2\227\022\220\332\031\232\317\335\264\207\2444\331\275N-7Sjg"
+	.string	"\330\314\035\024\242\311\234jj>\203\23224\237SM\3739\2651lf\020\023\013\346f\312\260\237S{\373)\325\204\241\371\224jj>\247\254\254\025\213)\276\026F\244\252XX\260&s+%A\0051a\2006W\251}\267\267%#\332L\"\366\206\222b\272\013\212a\323\204\240JBI\202\244<$\tQIm&\264\251%\265\267\226P\317N\332`\271B\267\016\013]\336\200\332HD{\003 i\357\245\335\320\275\367r\357Md\202Z\367\226\201\241\211\225\224\264\267\023'iC-\325\210\366\276dU\322\232\232O*)\023jcO\254]\264.-\326\276\233b\322\317%\330F\312\242\261\232\\\360\255cS\372\260n\326\240D\304\261\221]\261\321\315\033a\335K\225K\024_\224\030\325\270yq\021fq\334\304D2\314\0257\363\336A\326V@cm\005\302\266\036Ab\303|\"\337\020f\n\261\361\350\273\031\013\305"
+	.string	"\246A\263\320i\274\304\373y6\020\320\226&\350\024dW\274<\316\2727\331\275\243\341%%\347\023\213\f^A-=\216\300\005Q1\177\334l\323E\304/ \340\r\304\331\330\316+\212o\213\213\320H\031]\334\315'N\351\023\233\332\306L\304\257\337z\375n\324\256{\311f\350\n\023\323\001\376ph\272\366x\020\261\242?\\\242\245\317MOi\357\346\233%\227\r\2355\021\333\263\353\345\023v-Yc\304\t\251\374\254\240\335\274\2561i5\312^`\261\1775N\317.?\256\334<0<)U7\337\274\377\342]+\027JF\030\315\021=\272Y\306\256UzX\031\331\033\243\362B(\366\306\025tg'C7\330\205\257\306+\211\213,uS\210:\252"
+	.ascii	"\006\231r:\231\036yCO7'\355)\2315\335!\203zfw\255\305\234S/,"
+	.ascii	"\353\310\013\b\022\326\217KD\303\304\260\231TIXa]\201K\027\356"
+	.ascii	"\325\222\330\322\326\025r4\327\344\272D^\202\227\205\327\375"
+	.ascii	"b\002\330\304F\371\200+\372\274d \204\232$8\257H\271q\027\312"
+	.ascii	"\205\336(\227\311e\273O\356\334\205\273r\367\355\266]\267\353"
+	.ascii	"\304\256\267\311=\372-\273H.\226\326%:\"f4\245\311]\257\230\205"
+	.ascii	"\222I m\213"
+	.string	"^\223\373\302\025\002B\250\271\203\246>\370\301\224\005\352\202a4\255\313\220\020\371.I\273s\341\306\260\251\226\006\203\307b\t\033\332o\332\314\013&\034\222\233o\222{63\b8\370<SbD\244\017\355\346\325Kfii\207\324\333`\250u\305E\265\360id\367\b\031\230\225*+\020;\264\253\261kdXd\316\352\315N_\b\3259\253\214j/\354\202A\325u\261h\323\027\246i\230!D\246\f\336\"\227\310Q\226\033R\302\364\205\\\372\302\037\372\302\033\372\302\030\372B%!A\260\256\302\362n\206\326\310\bv\315\331\270\371\302!\375\034\325\317x\372YN?\253i\f\254\315\360\372"
+	.ascii	"\202\344\325\265\245{\360h3[Z\355\370\345\361+2 p\234\013Y\317"
+	.ascii	"\233\257\305\262\345\257,'\216\233\237{\350\310\021\263\366\326"
+	.ascii	"\247%\207\205:7\266\203\212\342\333\262\262\353\315qqx\335\020"
+	.ascii	"\\\313\371\271\251\352\306f\202f\335|e5\202\305\205\213\312b"
+	.ascii	"\031\312\340\243\0016%ES\006(t\3635\270R\267\306\272\227\210"
+	.ascii	"UxQ|Q\033v\275R7\352\031\234\360\302\301;\262\262\264r>\216\323"
+	.ascii	"\307k4\240\344\226\316\374n\236\201aPya\003L_\203\353\342:\235"
+	.ascii	"\211\221\3519\257\321]\352\200\210\351\305h\356\353\2772\356"
+	.ascii	"\323\215a\327\353\274L\277M\267\305q\256\263\310\005\027\340"
+	.ascii	"\\\020\371\314\031\267DOI>\373_`\262\252\236B\370\364\023\240"
+	.ascii	"\303\234\232\232n\316f\317\273V\036\322\336\315\031\311\333\234"
+	.ascii	"v\321\034\271\f\313Q\315\t\335\234\307\362\021\273\036.\223\235"
+	.ascii	"fIQ\031\034\236\376\t\354\341\206Y\354\371\271\244F\325\324\\"
+	.ascii	"\030\222\272\031Xr\3724M\264M\215\334\364L\225\233\362\027n:"
+	.ascii	"w\213\022s@`\3405o.BD\352q\024\210D_\003\035yG\020*9r\225\027"
+	.ascii	"\336\215\214\303\212\336V\356\312^yH&b\327\314\225yX%\231+[Y"
+	.ascii	"6\013\265\202\200W\025\256\334#\277`\241N\f\233y\026\325\233"
+	.ascii	"\261QT\026%\223o<\017\204Ps\204\"W\362\013\331G\326\262P\347"
+	.ascii	"\272[\304(\331\313\"#H\026b\327\374\302=\314p\241\022-2\324\312"
+	.ascii	"YiF3\212n\316@\236pG7\236\260\354\232\177\324\024\001\351\342"
+	.ascii	"\343\346|\365<\026K\243#\032'}\032&}\032!\235]\320S\364h\310"
+	.ascii	"u\321\237\331\242?\323\247?cE\377\031G\256\022>\337\372\344r"
+	.ascii	"U\334\\\034\222\320\235\316Q\331F\236\372_j\270\322p\230A\365"
+	.ascii	"\263T\t.@1\2739\333\267\r3\215\347\032pWXIp\372yF\206\372_h\356"
+	.ascii	"|\224\201\255\351g\031f\203}O"
+	.string	"7\347'M4c\304\002\030\032gQ3n~~\372\263\213\374\";? \202\301\354\224c<;3\214\235\235\033H\355\035\224\2355\201{\007\325X[\201\265\025d.\252+$\303\374\231U\377\316\336\fg\350L<\267\210\221c\242\367\345\202\276\301\222\215\262Q^\372\340\307\022\326vn\215\020&\t\261#Sz^\"\016\341Xk\334\234\223\256\254\320\364n\316Hw\311G\034\226\250\233\363\321\325\302\2343\342\246\205f-nj\310\315\237qj\016uy(\017\345&\2268,\242Y\2224\027r\321sSO\211\006\262\2709\023\335\245\035l1\262\006u\007#!!\274\247\321\316`\352\204\354\215\271\351\016Sy\231\227\230n\204+\257\272\033A\362\304t\007%\202\202xP\303\330\325\225^\315\223=\027S\327r<h\343b\2504m\021\311\241;\274\001\002\342@\215F\243G\030`\035\227\343@\"\027\225\332\223\214\223\326"
+	.string	"E\304q\024Gm\034\214P\331z\200\313\020i\234\235\345Y\260\237\335;\017.\212o\253\303\230\026T\313\261\037\332V\221&7\343>\334D\222$\352\311E\343"
+	.string	"\301r,xOo%]^9f0\301z\307{08f,\275\3604\016\\]\035\316#R\321FoTpX9\316\273KD\204\204\251\335\214\361,\022\231\027r\202g7\343*\327isq\321\335\214\251\334\253\254$Fut3\276\273DD\"\2654\0307c\273+\346"
+	.string	"*L~\367+\246K\n\340\335\023\355A\312\245`\272\021\266\325q\005FlM\207\325\3341]\363\345I\327c)\246="
+	.string	"\312\341(r\030:\302R\007\234\f\227\263=7(\307P\254\033\321\242\230\034\032"
+	.string	"YN\356\004?\321;0\212/z\205\002}\240\335\214\237\b\315\334\326\316\336.\036\226\030tontPhxmY\265\225\326\322\323\315\217q\241?0a\202\331\354\212`A\201r\331!\250?\024\251]\r\263\335\275\217\330)\321\033\022\241\361\b\\;f\273KlBK\244\334\214\227L\321\037\370\314p\232\031F\033ais\\a\265\2601+|v\214\206\233X.\216\213\333\315X\t~>\355\306\234\334\214\223X6:;/\253%\032\004\025\030.\033a\023\355\242\026 \210\003\317\310q\031\231>b5\304n\f\037\031\322\351P\253\362\034\303a\370\231\245W\205\206\237X\f\372\3464ue\365@\366\326\004s\245A\224}\341\365\013w\351\345`\214\336\231\025\037N\332\346H\3041\221\333\025\023\261\200\020 \333\273i"
+	.ascii	"bN\234\007\270{H\376\240n>L\220\006\261\027$\b\356\212\251\212"
+	.ascii	"F\361Eg\216\360\221\305\t9\356\302\\\177Gju\230\013\017y\222"
+	.ascii	"\344h\312"
+	.string	"\025\231*A7,[v\356C^S\211\223\214\222(cJ\3624\005H@\360\013@\260\326\313f\332\333\271\361\024\264(\276\255\020cU\326\254c\255\017\264\230A\356\022\324\317\217lMS\360\265\003\377\330\201\2614l\251\275\261\210fC]z4KR\220\300x\034c\341+\313W\004\020\312\025\366\361|\022,\233q\217@\237\236z\\&\230$g5\270\2624\005|9r`\035\266J\007F\022C)\t[\035\353h\2132\245E\323\"\3110\264\274r\2415\fRQ\341*\030!\263(\276h\026\342Vd\204o\274\004\375\221\371X\003<G\243j,r@\231\252-\200\260\342\204\235\"L\252\032\223\034\210y\017\t\243\217N\t\235\024\033\222\251z\234\200\321GG'\323\235\"\322GE\"A@\242\350\360\036\022-\024}\322\035a\013\352\217\212\t|x\017\211\234cZ\004\322\357!Q\301N\272\342\004\025t\322\236\020"
+	.string	"\360\036\022\252\262D\272\003\344\243s4\226H*\201Jp\360\361\001:\036\221G\242\2323d\001y$\246(\246>YM\225*R\025C\365=$~\200\220I\236\234d\252\026\177J\350\020@\347\b\024sLq\223Be\216\214\232s\344\371\021\036y~p*\002\2432+\225irg\247HL\252?x'=\362\030}\212\304\235T\t\224S%\361\311\034\236\037\0223\271\205\244\2524\362\244'\334\364\360"
+	.string	"!\223=\252RY,\252E\t\374(/pD\226\220\252E \237\342\n\023\3409\032U\325\250By,&Q\364(\215G\243\bH\024I\244\b\252\261\310B\001\224$\250G \037cq\205\b\250)\005V@\252\300\240\036\201\220!\324\250\306#\t\251\022\351\243SsL\177\2204J\r(S\344\016N1\t\264s4\212\360a\307\350S\334\200\315\206\235Ti\324\220\346\360\034\215\351\321\250\"\231\252\351\316\006uEZ\002\216\212TU\266\200B\216\315\006\017-\200 "
+	.ascii	"\345K\232\003\003\302\017\220\nH\244\217\215\362\206\307\230"
+	.ascii	"\"\347(\202\232*"
+	.string	"\323\023x~8\374 \2171\3271&\323c\312\243\277\001\007\t\340\240\203\025\304w\340\001\006\036`0|\007\036\2300\341\001\007&\36490\201U\245\321\0026>H$\b9\302\024\251\004\322\237\026P\344\2408!\002(h`\346=$,\200\202\004\024J\250)O\262\250\206P\225\251\232U\017\252\207d\252\002H\371\036e2]\301\230\334\001\221TM\240@E1)\302\212d\315\0060\244>)\024Q\2540Ts\322\035\344\005`\322\035\244\212\254\346``F\371\203$\246j\361\004\235\212\300\210\202VuRf\247\230\216\340c,\242H\246)R"
+	.ascii	"\201\260B\225I\252&\244+\030S\235\364\004\034\025t\212)\370\370"
+	.ascii	"\024CX\221\204I\223\305\236\353(U\024P\3309\032S|P\225E\237\027"
+	.ascii	"5\315\021a\203V\346\244<E\245\0062\250\312\034\031\0305'\003"
+	.ascii	"\r\324d\252\352\024\223\305\036\235\034\025\211L!Mb\240QsL\350"
+	.ascii	"\351p\344O\232,\241\"\221\311\0221-$\325TE\352\223\252\035\224"
+	.ascii	"9\032TP\026/pD\032U\235#P\n\031#\314\217RE\006\345\017O\0065"
+	.ascii	"\247\003\342\212t\347H\302\016P1\205\234\025\310\024T\320)\372"
+	.ascii	"\244\300A\311cLqD\206\240&\221?1j\016\007&\324\243\021H\213\240"
+	.ascii	"'\231\223\252\305\235\037\240\234\2334'\231\032S\030\325c\272"
+	.ascii	"C\202\232D\232\300\341\033p\320\001\006'N\350l@B\303\027\260"
+	.ascii	"\200\020Bh\240\004\nh\035\022>Ec2U\226@\032K\034\215E\025%t\222"
+	.ascii	"\312\022$8\374\02725i\264\324\020\202c)G3\250\303JR\312\2010"
+	.ascii	"\316.>\342\204I\227/\3726\205\005\022\336\203\251\272\362\004"
+	.ascii	"\353(\257\354\311\212\352\n\215\370.P#-\013\213\\\247\267\264"
+	.ascii	"\275\330\322\314U\362\323\312\226.E\031\332\305\311\2205\242"
+	.ascii	"\334\006\002$Xu7\337\0331{5\326$L\3146G\343\356I(\2208\344+\312"
+	.ascii	"Y\320\215\316|9\331PZVa9<&_\302\215e\330\277\026D\212\ff5\350"
+	.ascii	"\327\240\016\301c\247(\201VRn\336\240\005\b\230\003\305\362\364"
+	.ascii	"^\222l\200\311\340\362\034x\211d\252\346xPe\030\322\033j\370"
+	.ascii	"\371\345(\006v\027\215QE\365\260\337\222V\214\374\367\034}\341"
+	.ascii	"\026\206\003Poh\366\365\345f\003\326,P\371/\312\217\264+z\303"
+	.ascii	"\022,X2\037\216\024\266\233\302\301\267%\024kC\202\261\367\314"
+	.ascii	"\227\251\f\261p\241\367\272*\\\240Y\017i\b\360\355\231\2467 "
+	.ascii	"\261r+9\357\230\271k\310a\351'[\232@\354\232\363\244h\371@\262"
+	.ascii	"\2457l\271\273\313U\216\264\230\362+\301\257\212\312s\225\347"
+	.ascii	"\271\257\272;\f0\364\2069)Rr\335\206\257\264,PwgF\254\362\224"
+	.ascii	"\347\272f\232\223\013gt2\353r_\241\233\343\263\202\307\2749\211"
+	.ascii	"Fh\006V\216-\372\306\250I\223\f\305\221Z\356}\220\025"
+	.string	"EP\356N\371\210f(\317\320\273\324\264\247$\353\346\f\227\345\336\240\256\214\344r\034\031 \213+,4$\312K\312\315On\225~\f\301\335\234\337\262[vr\246o\264\326\376\265\334f\303\242p\331\212\356\355\034\021\023\004ky\227\331\236\333j\234onC\236n}x5M\372\006M\004\330\263\021\260\254\206\353d\3662l/\021\321\334\376\372\242\273\351\034\021\003v\004\026\345&yV{N\313\340\304\363\266\202\324\005\335\234\321\036\204\253\250\023\023\003\202|\276\305\024b\016\311\bi\222$\215\001\343\024@@@L4\031\016\2279\037\023\300\323\350\343\241\024h\021cJd$IR\250l\034\334\256y\346\362\224\365\034\022\b0\371\351\352\211\334\276\036\2374\276^\222\304\227\346\274\371\016-@\314U\362P\237iW%\030SDR6\035z\225V\331\344M7-\214\035,\305D\020\255\023\233[Y\367\276\321\243\226/\372"
+	.string	"I\306\341G\f\271j\220W\205~\365\271E\233\364\237\022cq>\237\300\253Z*\037e\301>\253\366\203/;\323\213\250\346\273$\377\323\210\376QT\024\312\222\341\265,8\262F\026:\306o\317A\350\352\337\023\333\332pI\340,Q\306\355\005(\264G\245\006\323\013\320I\203\327\303\216\341\003\205\301\216&\236\322+\200\025\316\260\361\343\0066;\232\212\006\311uC\013\222\242?\204\337\212\220\364G\007<\350o\325\035\240\206~\035\2123\313UU\220WJy:\351-:I\245\033x\210\310\223M\226\235\202\271\265\374\265\323\245\337\373^\372\337R*\255\361\346P\264\310o\317\245Q\rD\330\001w\314\204L\377\360ke\252\231\300\024\2272\341q\216\257\276\337-ws\003\233mi\351v\330V*\3162\311\322\313X\233v\370c\300"
+	.string	"\266\321:t\026\022\274E\2168a\234\030y\177\326\b\364\352Wa\205\302\030\002KL\240<\360\325\313\262\004\336\305\1778\250-!\n5\255f\310\355G\205K\0077\253\263+\327\251\347\263\357\330F\023\275\023\344\347\333\200\206\\\027N\261\226\001iE\345\271\3371)\372\366\\i\005\277_\3654(:\003\321\320!Li\356\357\034\303O\302\212\267\030\202\250\363 g\336>\367\225\214\036\207dZ)/\177\274\316e\3327\207\037N\236\320"
+	.string	"\\\254\260`\036aY\212\022\361\344D\3771\"X\241Xt\032\372\354\305u\322\0258>@\204\367\270\275\262\306\261!\314I"
+	.string	"QW\316\305\034\005\250B>U2\007\\\331\245\226f\324\236\025g\2565\322Uv\332\316\202\250\352\227\231<\362\\\033?]#By\214\234\217\304\233f\035\347'\245\214\306,\236i\265L\210j[\242\331\361W\200\206]\n\372\006\\c_\343\207\363~_\224\324.\211\260\034\002\263\317\3315\232\354,\256R\316\215\336`)\230[\332\336\036*\330d&\306r\304bmfd\365\226\235\243\255\370L\350B\212\267\235;\326n\034\035g\263\266\336{KyM\342_(6\023\027\262\214V\253\236>n\220\355\200\307\216\017\322\321+\026sI\006S.\025v]\034\177\n\377\232i\026\350O0\262\252\023\251\220.\337!(r\342\377\317-:L\267\351\352|\f\t\302\230\032\013\345\n\2357\212|\177u\035\244\357+\374\275\020\266DV}\020c\220\033\252j.\272\013[.O\022\360\250\320@`\310\307)\261=\212E"
+	.ascii	"\263\316\3405\345\202`D\026\b5\373\203-{\360\rn\247V\343\222"
+	.ascii	"\321@\035\345<\350\330\254\215\3433\214\257\b\372M\300\023u\373"
+	.ascii	"\366\003\325\004\f\rD\021\204\273\212\325\223\001\244\fc\264"
+	.ascii	"\304\302\030T\332s\314\374=\262aE\303\315XB\305N\372w \357\270"
+	.ascii	"\023\267\314?E\013#\222:u\275R\377\t\307\270\346n\373\375\353"
+	.ascii	"U\337\377\002\335\366d\267\373\211\251\267\206\255\217\255\253"
+	.ascii	"\261\233\271*\335#B)W\016n\205\343\262\204x\315\322F\366\200"
+	.ascii	"\361\215\231\357X\260H}5\235\323N7!\375\343\231\253\244\017E"
+	.ascii	"\242R\266c\202\n\254\307=\231\300U\204\024Oaoju?\366>\204Ea\336"
+	.ascii	"\303\005\310\224\375\241\301\205\302\245\223\242\366c\230O\225"
+	.ascii	"9G\t\306a\232\"\376\213S\325a\270\rU\347\317l\302>m\361s\331"
+	.ascii	"\001\347\023\205\207H\321(V\f\304CQ\277\256\\\1773\366\276\366"
+	.ascii	"\243\327\310\335!\305\271\365#\311=\353\357\341D\207>]\335\210"
+	.ascii	"\271\017\371\323\3138\263\330\347^\265c\222\345F\004<9\\?1\210"
+	.ascii	"%\207\305\032s#\007S"
+	.ascii	"\227(\022\005\236\236H^[\032\334\036p\214\337V\213\264j9b\334"
+	.ascii	"\035\314<H\327X\367Y\371M\317\332\333\007H\003\216JV\356\206"
+	.ascii	"\224\3736\013\027\320\211\267bP\345\230F\264\341\034\370\201"
+	.ascii	"Iym\031\200\272\206\021\253\rgF=\337\232\213\300\023\345\305"
+	.ascii	"\232#\324=(\301; g \325P\272\326\017\230"
+	.string	"\264\220\262\225f\260\262^\310\002\313\002z\b\270x \231_\352\0325\267\376n\312\007\f$p\\\340i\220)\353\347,jH]\2354\252\206z\323\032\307\302!\227\300\024k\025\224\240\036(\254B\372\224\230\3759w\265X\rW\256\265\375\222&4\035\025\243g\221\262\002\220\271\205\373d\017\301\021\221\220\235a\031\337\233>\0213F\231\377\234'\2442\256\177\017\352\226D\311?\021N\3110K\024\026\320\275\2543I\037\026\304\351\213\317\241tI\272\337f\333i?Q`\240E\002\332\336\201\263r\350\351\230\364\3640\300\346\204\256y\3466\306\266\216\037\027\3755S9\220zc\031\271\360H\330$\353\304\320\207\3449/\002\326\035 m\177\020\205E\223d\370\240\310\257\3442zPhD\211\032\226\272F\310E\355+\264\370\336\036\305A,2\n\004\353\032\253X\243`\266\206A\344+\316\322\234w~\013-o\005\254\3171"
+	.ascii	"\205\342'\301\003\013A\216\216\177\271@\364g\fe6\027r\272W\256"
+	.ascii	"\354l\212\030;\261%\2312H;\252\261\001D\253\314\333\034\301\314"
+	.ascii	"\2626\232'p\205\271\b\335\351\361\233\361\317\371\304E\317\004"
+	.ascii	"y\3774\357\302w\234\316BCYi\235\370\264\322'\201\225\273\341"
+	.ascii	"\327\227'\331\316O\214sto\"8\341\214\362 \\E\023\231\366\375"
+	.ascii	"\215\34760\305\016\324-\242\341\302\\^:0(F)\377e\336\004\221"
+	.ascii	"\r\370Y\b\243\340?\222\001\213\223[o\300Bf\017\364-\0262\202"
+	.ascii	"\270g\"jB\027\020\263\357\262\204\025\265\242\3267\274\331\265"
+	.ascii	"8G\213\306\334\236\251\031\363\217J\023\nd\202\360\177z\225\211"
+	.ascii	"\027\177\3119P\312|\303\336\013z\204AL\nI\016\367V\227H\243v"
+	.ascii	"\347tk\233+S17\226\310\204\217\203\256e\003\275\223\003\354\n"
+	.ascii	"VP\030\347\264\236\242e\ndO\\\210\013t\211(\256\311U\364"
+	.string	"A\271\245\350\033|\260[J\203\300\3428\001\374:\"IG|3`\367\312\373\357\2466\363\034\235M_\202\334\3172'D\032\265\364\345\262\035b\246\036v+\320!\207\"\212\224\223\031\323V\204\243\202\203\037\321\364\215\250X\265\366\027\036w\004z\"\271d\370\251\210\034\225\323VJ\344m\013n\332\027\350K\r\232\262\225Yn?\335\344\232\314h\224N\\?C\332\001\325\233(\340%a>0\372\275\3357\242NH\025\307|\315\277\225\331KS\021A%\325\344h\020\343\035\330\0275A\r\334\320P\223\344u\310\026\305\206\236\344\022\020\206\3054^`\224\313\263\332u_8L\007\310\210\020)\023\001Ea\200\370\020h\212\362\251/P\241\372\223\355S\241\022lk\356\302\245\303\371wLQ\301\233\030\346^:\007\260\002#u+_uzb`\201\304O]\201oyO\210\235\233\300\331X\210o\341F.\331\244-\033Y"
+	.ascii	"/\325\302P05\256\344\260o\204\340\226\314\373\367\372\227\277"
+	.ascii	"\005\fb\337\272\372\316\340u\177\231\357\226\036\003o\342\214"
+	.ascii	"=\2779\215}\221g7\244\275R\374V\341X\275\212\037k\264\243\303"
+	.ascii	"*\336\023%\357\222\277\n\276\351\363E\321~\002\362f\371\255\222"
+	.ascii	"\260\006.\202\330<\275\"\035^\325\277S\344u\325\363\021\250\314"
+	.ascii	"q.\342;\r_3\372\257\343\204\350V\250\023l>{2\027cE\237\304\017"
+	.ascii	"\344nd\303\344^\035\273\374\017\2178f\377v\372\210\362\021\215"
+	.ascii	"\257\274\007\243\375\314K\336J\236G\251\367\310\337$q\3248\324"
+	.ascii	"\335\367\211Gkn\322\217B/\213\372\314\301\315\017\032\264>\270"
+	.ascii	"\273f\016\340GLw\204\275q\325\247\204>cX\337\340ZE'u\347H\347"
+	.ascii	"\345\342\034\254\272\342u\200\354\023F\353\n\357\266\2469\017"
+	.ascii	"\243\361\207\373j+\237\246\317b\037=\277\376\230\254kW\240\277"
+	.ascii	"\245\214K\367\364\037\342 \016\360-hg\363\375\264\377\322v\256"
+	.ascii	"\266\354\266\213-\230\206^\nz/\341\2727\312z\370q\225\237m\247"
+	.ascii	"\320f9g\273\211\004\333\021\217\351\273\324\304\2568\374v]c\337"
+	.ascii	"3\201\235\316I+p/Jx\tw\322%\223\313u\323\245\357\035\330=\353"
+	.ascii	"g\342\221\270\346\3465\227\007^vV[f\326\354\321n\177\273\251"
+	.ascii	"\217\324\227\276:\036\370@\346\310\361^\177\031F\204\253\304"
+	.ascii	"\271\322\365]j?\360\223[\355\353 \314U\2179\321/\342e\332\357"
+	.ascii	"v\372u\023\2756\230\034=\352\337\023\236%\016?lw\351\274\005"
+	.ascii	"\243{wf\367\357\337K<\277\024-yg\203\357\n"
+	.text
+	.section	.gnu.lto_.symtab.6da5883fd5a690c6,"e",@progbits
+	.string	"pgResetFn_serialConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"serialPortIdentifiers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"lookupBaudRateIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"findSerialPortIndexByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"findSerialPortUsageByIdentifier"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"findSerialPortUsageByPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"isSerialPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"findNextSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"serialFindPortConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"doesConfigurationUsePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"serialRemovePort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"serialGetAvailablePortCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"serialIsPortAvailable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"serialEvaluateNonMspData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"serialPassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"serialConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"uartOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"cliEnter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6da5883fd5a690c6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
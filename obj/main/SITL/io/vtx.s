@@ -0,0 +1,8852 @@
+	.file	"vtx.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	vtx.c.1c6d79ae
+	.weak	vtx.c.1c6d79ae
+vtx.c.1c6d79ae:
+	.long	0x6c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2
+	.long	.LASF1549
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1539
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1540
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1541
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1542
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1543
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1544
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1545
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1546
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1547
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1548
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 1 "./src/main/io/vtx.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 2 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 3 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.file 4 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 5 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x5
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.file 7 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF446
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF525
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF600
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF618
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF641
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF525
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF701
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF705
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF706
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF802
+	.byte	0x4
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 24 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x18
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF935
+	.byte	0x4
+	.byte	0x4
+	.file 25 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 26 "./src/main/config/config_eeprom.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1a
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF958
+	.byte	0x4
+	.file 28 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1c
+	.file 29 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 30 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 31 "./src/main/drivers/vtx_rtc6705.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 32 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x20
+	.file 33 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x21
+	.file 34 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.file 35 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x23
+	.byte	0x4
+	.file 36 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 37 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x4
+	.file 38 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x26
+	.file 39 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.file 40 "./src/main/drivers/resource.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 41 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x29
+	.file 42 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 43 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1489
+	.byte	0x4
+	.file 44 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 45 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1493
+	.byte	0x4
+	.file 46 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 47 "./src/main/io/beeper.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2f
+	.file 48 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1503
+	.byte	0x4
+	.byte	0x4
+	.file 49 "./src/main/io/osd.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 50 "./src/main/io/vtx.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x32
+	.file 51 "./src/main/fc/rc_controls.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF443
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF478
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF480
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF484
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF486
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF494
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF496
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF502
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF524
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF532
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF537
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF538
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF597
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF599
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF617
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF628
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF630
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF632
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF634
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF636
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF638
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF640
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF656
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF704
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF801
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF815
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF852
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF853
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF855
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF857
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF903
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF934
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF952
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF965
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF988
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1070
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_rtc6705.h.29.f70f213c1c618a64d2b43f7ba3a35b2a,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1076
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1078
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1080
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1082
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1090
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1108
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1120
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1488
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1492
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1502
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.23.dfeea95d53f02f32dbd532b1d756929b,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1507
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1533
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx.h.22.12f28c2beccab569593ab27679518da5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1538
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1550
+	.long	.LASF1551
+	.long	.LASF1552
+	.long	.LASF1553
+	.long	.LASF1554
+	.long	.LASF1555
+	.long	.LASF1556
+	.long	.LASF1557
+	.long	.LASF1558
+	.long	.LASF1559
+	.long	.LASF1560
+	.long	.LASF1561
+	.long	.LASF1562
+	.long	.LASF1563
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x34
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1564
+	.byte	0x6
+	.long	.LASF1565
+	.byte	0xd
+	.long	.LASF1566
+	.byte	0x9
+	.long	.LASF1567
+	.byte	0x8
+	.long	.LASF1568
+	.byte	0x7
+	.long	.LASF1569
+	.byte	0xe
+	.long	.LASF1569
+	.byte	0xd
+	.long	.LASF1570
+	.byte	0xa
+	.long	.LASF1571
+	.byte	0xd
+	.long	.LASF1572
+	.byte	0xd
+	.long	.LASF1573
+	.byte	0xa
+	.long	.LASF1574
+	.byte	0xa
+	.long	.LASF1575
+	.byte	0xc
+	.long	.LASF1576
+	.byte	0xa
+	.long	.LASF1577
+	.byte	0xb
+	.long	.LASF1578
+	.byte	0xb
+	.long	.LASF1579
+	.byte	0xa
+	.long	.LASF1580
+	.byte	0xa
+	.long	.LASF1581
+	.byte	0xa
+	.long	.LASF1582
+	.byte	0xa
+	.long	.LASF1583
+	.byte	0xa
+	.long	.LASF1584
+	.byte	0xa
+	.long	.LASF1585
+	.byte	0xe
+	.long	.LASF1586
+	.byte	0x8
+	.long	.LASF1587
+	.byte	0x2
+	.long	.LASF1588
+	.byte	0x3
+	.long	.LASF1589
+	.byte	0xe
+	.long	.LASF1590
+	.byte	0x3
+	.long	.LASF1591
+	.byte	0x1
+	.long	.LASF1592
+	.byte	0x3
+	.long	.LASF1593
+	.byte	0x4
+	.long	.LASF1594
+	.byte	0x5
+	.long	.LASF1595
+	.byte	0x4
+	.long	.LASF1596
+	.byte	0x4
+	.long	.LASF1597
+	.byte	0x4
+	.long	.LASF1598
+	.byte	0x4
+	.long	.LASF1599
+	.byte	0x4
+	.long	.LASF1600
+	.byte	0x4
+	.long	.LASF1601
+	.byte	0x4
+	.long	.LASF1602
+	.byte	0x4
+	.long	.LASF1603
+	.byte	0x4
+	.long	.LASF1604
+	.byte	0x2
+	.long	.LASF1605
+	.byte	0x4
+	.long	.LASF1606
+	.byte	0x4
+	.long	.LASF1607
+	.byte	0x4
+	.long	.LASF1608
+	.byte	0x5
+	.long	.LASF1609
+	.byte	0x6
+	.long	.LASF1610
+	.byte	0x2
+	.long	.LASF1611
+	.byte	0x6
+	.long	.LASF1612
+	.byte	0x6
+	.long	.LASF1613
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1480:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1514:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF779:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1526:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1116:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1072:
+	.string	"RTC6705_BAND_MAX 5"
+.LASF943:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF431:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF967:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF845:
+	.string	"_WCHAR_T_DEFINED "
+.LASF438:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF787:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF540:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF502:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF407:
+	.string	"USE_CLI "
+.LASF1236:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF941:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1334:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF567:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF880:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF445:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF771:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF648:
+	.string	"__SQUAD_TYPE long int"
+.LASF884:
+	.string	"USE_PPM"
+.LASF1254:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF526:
+	.string	"__USE_MISC 1"
+.LASF1484:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF411:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1383:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF867:
+	.string	"USE_FAKE_GYRO "
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF966:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1122:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF591:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF886:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF702:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1548:
+	.string	"_Bool"
+.LASF881:
+	.string	"USE_UART8 "
+.LASF1103:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF864:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1083:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF433:
+	.string	"TELEMETRY_SRXL "
+.LASF544:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1471:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1529:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF531:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF972:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1173:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1123:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF468:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1407:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1353:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF444:
+	.string	"_STDINT_H 1"
+.LASF798:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF988:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1112:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF837:
+	.string	"__WCHAR_T__ "
+.LASF439:
+	.string	"USE_SENSOR_NAMES "
+.LASF1476:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1026:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF953:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1448:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1394:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF990:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF565:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1483:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1425:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1176:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1486:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF698:
+	.string	"__FD_SETSIZE 1024"
+.LASF656:
+	.string	"__STD_TYPE typedef"
+.LASF1011:
+	.string	"PG_RX_CONFIG 24"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF546:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF422:
+	.string	"TELEMETRY_HOTT "
+.LASF978:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1382:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1140:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF928:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF479:
+	.string	"_ISOC95_SOURCE"
+.LASF1109:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF807:
+	.string	"_T_PTRDIFF_ "
+.LASF440:
+	.string	"VTX_COMMON "
+.LASF1421:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF736:
+	.string	"INT_FAST8_MAX (127)"
+.LASF645:
+	.string	"__U32_TYPE unsigned int"
+.LASF1296:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1022:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1262:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF466:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1104:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1332:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF976:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF836:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1135:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF457:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF763:
+	.string	"UINT8_C(c) c"
+.LASF1510:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1439:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF944:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF603:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF665:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1299:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1030:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1475:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF694:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF563:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF467:
+	.string	"__USE_ATFILE"
+.LASF1143:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1090:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF969:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1101:
+	.string	"BIT(x) (1 << (x))"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1079:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF971:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF740:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1151:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1302:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF542:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF939:
+	.string	"FAST_MATH "
+.LASF870:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF847:
+	.string	"___int_wchar_t_h "
+.LASF1451:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1397:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF448:
+	.string	"__USE_ISOC11"
+.LASF1114:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF860:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1218:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF911:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF909:
+	.string	"VTX_TRAMP"
+.LASF613:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF780:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1007:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF586:
+	.string	"__always_inline"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF521:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF885:
+	.string	"USE_PWM"
+.LASF796:
+	.string	"UINTMAX_WIDTH 64"
+.LASF710:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF893:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1097:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1027:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF703:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1040:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1041:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1221:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF732:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF675:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF435:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF569:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1214:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1337:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF559:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1191:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF434:
+	.string	"USE_DASHBOARD "
+.LASF515:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1377:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF948:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF620:
+	.string	"__stub_chflags "
+.LASF1520:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF897:
+	.string	"TELEMETRY_HOTT"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1182:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF938:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF1058:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF956:
+	.string	"false 0"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF759:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF832:
+	.string	"_GCC_SIZE_T "
+.LASF624:
+	.string	"__stub_setlogin "
+.LASF1294:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1142:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF626:
+	.string	"__stub_stty "
+.LASF982:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF522:
+	.string	"__WORDSIZE 64"
+.LASF627:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF761:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1359:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1166:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF900:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF598:
+	.string	"__attribute_copy__"
+.LASF1400:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF829:
+	.string	"_SIZE_T_DECLARED "
+.LASF1346:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF628:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1019:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF709:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1062:
+	.string	"PG_VTX_CONFIG 515"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1073:
+	.string	"RTC6705_CHANNEL_MIN 1"
+.LASF868:
+	.string	"ACC "
+.LASF579:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF430:
+	.string	"TELEMETRY_IBUS "
+.LASF409:
+	.string	"USE_PWM "
+.LASF1430:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF838:
+	.string	"_WCHAR_T "
+.LASF1493:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF639:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF958:
+	.string	"EEPROM_CONF_VERSION 159"
+.LASF1498:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1226:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF968:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1468:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1144:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF722:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF813:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1149:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF741:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF758:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1522:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1233:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF924:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF507:
+	.string	"__USE_POSIX 1"
+.LASF452:
+	.string	"__USE_POSIX"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF848:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1074:
+	.string	"RTC6705_CHANNEL_MAX 8"
+.LASF1266:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1208:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1121:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF610:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF487:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF739:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1534:
+	.string	"VTX_BAND_MIN 1"
+.LASF1152:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1081:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1443:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF561:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF937:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF629:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1508:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF965:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF635:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1269:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF596:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1095:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1274:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1323:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF723:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1539:
+	.string	"unsigned char"
+.LASF706:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF733:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF611:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1069:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1078:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF970:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF814:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF770:
+	.string	"UINT8_WIDTH 8"
+.LASF1403:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1463:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1020:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1349:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1003:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1050:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1517:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1547:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF998:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF450:
+	.string	"__USE_ISOC95"
+.LASF974:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF449:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1440:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1422:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF760:
+	.string	"INT16_C(c) c"
+.LASF1238:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF866:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1053:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1283:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1070:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF705:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1080:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF806:
+	.string	"_PTRDIFF_T "
+.LASF607:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF459:
+	.string	"__USE_XOPEN2K"
+.LASF1190:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF455:
+	.string	"__USE_POSIX199506"
+.LASF960:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1158:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF821:
+	.string	"_T_SIZE_ "
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF497:
+	.string	"_DEFAULT_SOURCE"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1456:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF585:
+	.string	"__wur "
+.LASF419:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF548:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF927:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1256:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF498:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF844:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1261:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF667:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1350:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1340:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF417:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1329:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1076:
+	.string	"RTC6705_FREQ_MAX 5950"
+.LASF1446:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1392:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF545:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF707:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF715:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF726:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF601:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1235:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1089:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF558:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1311:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF649:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1145:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF462:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1197:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF743:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1527:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1507:
+	.string	"OSD_POSCFG_MAX (VISIBLE_FLAG|0x3FF)"
+.LASF525:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF691:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF496:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF858:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1466:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF609:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1395:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1025:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF406:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF765:
+	.string	"UINT32_C(c) c ## U"
+.LASF756:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF469:
+	.string	"__USE_GNU"
+.LASF1499:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF719:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1035:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1060:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1132:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1512:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1200:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1223:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF762:
+	.string	"INT64_C(c) c ## L"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF471:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF655:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1424:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF699:
+	.string	"_BITS_TIME64_H 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF738:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF679:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF931:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF571:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1317:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1085:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1082:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF464:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF819:
+	.string	"_SIZE_T "
+.LASF587:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1045:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF528:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF643:
+	.string	"__U16_TYPE unsigned short int"
+.LASF582:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF859:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF616:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF572:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1286:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF475:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF861:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF831:
+	.string	"___int_size_t_h "
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1155:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF826:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF903:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1295:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1449:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF681:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1482:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1194:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF621:
+	.string	"__stub_fchflags "
+.LASF647:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF913:
+	.string	"USE_DSHOT"
+.LASF1099:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF420:
+	.string	"TELEMETRY "
+.LASF456:
+	.string	"__USE_XOPEN"
+.LASF1039:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1301:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF478:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF940:
+	.string	"VERY_FAST_MATH "
+.LASF523:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1077:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF614:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF849:
+	.string	"_GCC_WCHAR_T "
+.LASF599:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF660:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF898:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF755:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF606:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1388:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1415:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF382:
+	.string	"unix 1"
+.LASF1307:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF899:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF505:
+	.string	"__USE_ISOC99 1"
+.LASF852:
+	.string	"_BSD_WCHAR_T_"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF428:
+	.string	"CMS "
+.LASF605:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF824:
+	.string	"_SIZE_T_ "
+.LASF686:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1519:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1495:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1115:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF835:
+	.string	"__need_size_t"
+.LASF882:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF816:
+	.string	"__need_ptrdiff_t"
+.LASF518:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF791:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF400:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF959:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1536:
+	.string	"VTX_CHANNEL_MIN 1"
+.LASF1217:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF803:
+	.string	"_STDDEF_H "
+.LASF873:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF753:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF482:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1146:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF802:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1245:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF768:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1005:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF519:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF551:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1037:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1013:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF987:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF977:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1161:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF622:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF693:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1184:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1230:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF720:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF695:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF910:
+	.string	"BLACKBOX"
+.LASF1398:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1344:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF895:
+	.string	"LED_STRIP"
+.LASF1379:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF766:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1361:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF721:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF788:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1224:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1164:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF529:
+	.string	"__USE_GNU 1"
+.LASF891:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF892:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1518:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1290:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF421:
+	.string	"TELEMETRY_FRSKY "
+.LASF1119:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF533:
+	.string	"__GNU_LIBRARY__"
+.LASF1442:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF527:
+	.string	"__USE_ATFILE 1"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF952:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1418:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1364:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1268:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1271:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1515:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF890:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF730:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1167:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF486:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF986:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF713:
+	.string	"INT16_MAX (32767)"
+.LASF1310:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF854:
+	.string	"NULL"
+.LASF1289:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1472:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1465:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF672:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF975:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF917:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF539:
+	.string	"__PMT"
+.LASF850:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1405:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF774:
+	.string	"UINT32_WIDTH 32"
+.LASF912:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1117:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1316:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF403:
+	.string	"I2C2_OVERCLOCK true"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF767:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1502:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1281:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF995:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1322:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF828:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1193:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF840:
+	.string	"_T_WCHAR "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF494:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1163:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1265:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF646:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF963:
+	.string	"UNIT_TESTED "
+.LASF994:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1461:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF747:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF535:
+	.string	"__GLIBC__ 2"
+.LASF1347:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF922:
+	.string	"USED_TIMERS 0"
+.LASF734:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF714:
+	.string	"INT32_MAX (2147483647)"
+.LASF842:
+	.string	"_WCHAR_T_ "
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1126:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF926:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1326:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1549:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF549:
+	.string	"__P(args) args"
+.LASF1524:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF426:
+	.string	"USE_SERVOS "
+.LASF906:
+	.string	"VTX_COMMON"
+.LASF973:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF724:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF399:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF820:
+	.string	"_SYS_SIZE_T_H "
+.LASF671:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF801:
+	.string	"WINT_WIDTH 32"
+.LASF1159:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1147:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1293:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1125:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1436:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1059:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF414:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1257:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1209:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1367:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF751:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF682:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF712:
+	.string	"INT8_MAX (127)"
+.LASF1505:
+	.string	"VISIBLE(x) (x & VISIBLE_FLAG)"
+.LASF1046:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF461:
+	.string	"__USE_XOPEN2K8"
+.LASF754:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF989:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1409:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF683:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF856:
+	.string	"__need_NULL"
+.LASF857:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1157:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF474:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF524:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF463:
+	.string	"__USE_LARGEFILE"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF408:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1138:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF556:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF894:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF887:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1530:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF509:
+	.string	"__USE_POSIX199309 1"
+.LASF1247:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF921:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF574:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1212:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1496:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1199:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF996:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF947:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF483:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF555:
+	.string	"__END_DECLS "
+.LASF1092:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1467:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF668:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1036:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF697:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1314:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1540:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1543:
+	.string	"signed char"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1215:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1427:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF817:
+	.string	"__size_t__ "
+.LASF424:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF511:
+	.string	"__USE_XOPEN2K 1"
+.LASF425:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1178:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1464:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF883:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF846:
+	.string	"_WCHAR_T_H "
+.LASF1410:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1004:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF575:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1033:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF493:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1043:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF692:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF640:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF936:
+	.string	"sq(x) ((x)*(x))"
+.LASF748:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF619:
+	.string	"__stub___compat_bdflush "
+.LASF1373:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1292:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF447:
+	.string	"_FEATURES_H 1"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF825:
+	.string	"_BSD_SIZE_T_ "
+.LASF593:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1391:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF577:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF904:
+	.string	"USE_DASHBOARD"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1124:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1129:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1491:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1516:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF618:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1012:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF669:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1535:
+	.string	"VTX_BAND_MAX 5"
+.LASF1370:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF925:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1016:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF485:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF492:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF661:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF418:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF805:
+	.string	"_ANSI_STDDEF_H "
+.LASF1066:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF543:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1172:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1431:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1021:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1054:
+	.string	"PG_PPM_CONFIG 507"
+.LASF793:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1133:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1500:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF915:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1170:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF608:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF735:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF412:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1207:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1113:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1148:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF442:
+	.string	"VTX_SMARTAUDIO "
+.LASF1106:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1277:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1018:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF663:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF662:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1087:
+	.string	"IOCFG_AF_OD 0"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1533:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1139:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF612:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF916:
+	.string	"USE_PROFILE "
+.LASF746:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF553:
+	.string	"__ptr_t void *"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1513:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF481:
+	.string	"_ISOC99_SOURCE"
+.LASF983:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF427:
+	.string	"GPS "
+.LASF652:
+	.string	"__SLONG32_TYPE int"
+.LASF1325:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF718:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1181:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1120:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1015:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF451:
+	.string	"__USE_ISOCXX11"
+.LASF1413:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"long int"
+.LASF1521:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1242:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1008:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1227:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1538:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF477:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF949:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF708:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF716:
+	.string	"UINT8_MAX (255)"
+.LASF1260:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF566:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1187:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1454:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF789:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF550:
+	.string	"__PMT(args) args"
+.LASF429:
+	.string	"TELEMETRY_CRSF "
+.LASF810:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF725:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF809:
+	.string	"__PTRDIFF_T "
+.LASF776:
+	.string	"UINT64_WIDTH 64"
+.LASF1287:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF685:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF538:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1098:
+	.string	"EXPAND_I(x) x"
+.LASF1263:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF902:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1220:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF785:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF823:
+	.string	"__SIZE_T "
+.LASF690:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1532:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF773:
+	.string	"INT32_WIDTH 32"
+.LASF673:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF689:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1504:
+	.string	"VISIBLE_FLAG 0x0800"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF822:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1034:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF945:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF508:
+	.string	"__USE_POSIX2 1"
+.LASF1051:
+	.string	"PG_PID_CONFIG 504"
+.LASF851:
+	.string	"__DEFINED_wchar_t "
+.LASF1531:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF562:
+	.string	"__flexarr []"
+.LASF476:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF568:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF641:
+	.string	"_BITS_TYPES_H 1"
+.LASF896:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF729:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF786:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF964:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1437:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF632:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1031:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF985:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF839:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF991:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1203:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1061:
+	.string	"PG_VCD_CONFIG 514"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF489:
+	.string	"_POSIX_C_SOURCE"
+.LASF797:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1278:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF644:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1032:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1386:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1416:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF514:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1362:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF934:
+	.string	"__enable_irq() "
+.LASF1130:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF737:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF782:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1546:
+	.string	"char"
+.LASF1259:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF664:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF625:
+	.string	"__stub_sigreturn "
+.LASF1196:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1343:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF792:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF865:
+	.string	"LED0_PIN NONE"
+.LASF584:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF642:
+	.string	"__S16_TYPE short int"
+.LASF1494:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF999:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF875:
+	.string	"USE_UART2 "
+.LASF490:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF581:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1492:
+	.string	"BEEP_ON do {} while(0)"
+.LASF704:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1331:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF437:
+	.string	"USE_RX_MSP "
+.LASF1094:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1305:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF955:
+	.string	"true 1"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF588:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1528:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF676:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF827:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1479:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF501:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF701:
+	.string	"__STD_TYPE"
+.LASF1503:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF687:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF731:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF957:
+	.string	"__bool_true_false_are_defined 1"
+.LASF659:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF653:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF834:
+	.string	"__size_t "
+.LASF402:
+	.string	"I2C1_OVERCLOCK true"
+.LASF935:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1024:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF666:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1308:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF855:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1487:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF777:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1096:
+	.string	"STR_HELPER(x) #x"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1029:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF908:
+	.string	"VTX_SMARTAUDIO"
+.LASF413:
+	.string	"USE_SERIALRX_SBUS "
+.LASF711:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1352:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1068:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF961:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1385:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF889:
+	.string	"USE_SERIALRX_SBUS"
+.LASF871:
+	.string	"USE_FAKE_BARO "
+.LASF604:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1501:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1202:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF589:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF853:
+	.string	"__need_wchar_t"
+.LASF984:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF745:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF808:
+	.string	"_T_PTRDIFF "
+.LASF541:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF520:
+	.string	"__USE_LARGEFILE 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF630:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF869:
+	.string	"USE_FAKE_ACC "
+.LASF495:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1365:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF615:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF617:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1328:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1460:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1244:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1506:
+	.string	"OSD_POS_MAX 0x3FF"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1470:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF480:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1406:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__USE_ISOC11 1"
+.LASF590:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF557:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1188:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF473:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF516:
+	.string	"_LARGEFILE_SOURCE"
+.LASF651:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1525:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1042:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF728:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF979:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF465:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1044:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF405:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF401:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF980:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1052:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1376:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"_XOPEN_SOURCE"
+.LASF1232:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1064:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF674:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1137:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1105:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1160:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF992:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF684:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF500:
+	.string	"_ATFILE_SOURCE 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF843:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1241:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF727:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF930:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF576:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1478:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1280:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF446:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF453:
+	.string	"__USE_POSIX2"
+.LASF1389:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1009:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF901:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1434:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1179:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF436:
+	.string	"USE_MSP_PUSH "
+.LASF1469:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1038:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1017:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF650:
+	.string	"__SWORD_TYPE long int"
+.LASF1088:
+	.string	"IOCFG_IPD 0"
+.LASF460:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1368:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF742:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1511:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF833:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF783:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1380:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF717:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF423:
+	.string	"TELEMETRY_LTM "
+.LASF804:
+	.string	"_STDDEF_H_ "
+.LASF1118:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF700:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1136:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1485:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1154:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF657:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1239:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1355:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1131:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF696:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF764:
+	.string	"UINT16_C(c) c"
+.LASF1014:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1272:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF750:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1338:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF775:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF441:
+	.string	"VTX_CONTROL "
+.LASF1374:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1010:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF454:
+	.string	"__USE_POSIX199309"
+.LASF752:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF772:
+	.string	"UINT16_WIDTH 16"
+.LASF951:
+	.string	"Q12 (1 << 12)"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF811:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF841:
+	.string	"__WCHAR_T "
+.LASF633:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1284:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1509:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1141:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1102:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF503:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF863:
+	.string	"U_ID_1 1"
+.LASF862:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF914:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF517:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1056:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1175:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1433:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF905:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF784:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF872:
+	.string	"MAG "
+.LASF554:
+	.string	"__BEGIN_DECLS "
+.LASF594:
+	.string	"__restrict_arr __restrict"
+.LASF1371:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1107:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1006:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF564:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF933:
+	.string	"__disable_irq() "
+.LASF1375:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1452:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF510:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1298:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF923:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF623:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF595:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF993:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF946:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF512:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1108:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF415:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1049:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1023:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF932:
+	.string	"EEPROM_SIZE 32768"
+.LASF1275:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF795:
+	.string	"INTMAX_WIDTH 64"
+.LASF1304:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF499:
+	.string	"_ATFILE_SOURCE"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF794:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1412:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1358:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF532:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1169:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF637:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1253:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1474:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1523:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF570:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF962:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF918:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF488:
+	.string	"_POSIX_SOURCE 1"
+.LASF1335:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF749:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1075:
+	.string	"RTC6705_FREQ_MIN 5600"
+.LASF954:
+	.string	"bool _Bool"
+.LASF812:
+	.string	"___int_ptrdiff_t_h "
+.LASF484:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF597:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF688:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1100:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1071:
+	.string	"RTC6705_BAND_MIN 1"
+.LASF1473:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF416:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1127:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF888:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1457:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF432:
+	.string	"TELEMETRY_MAVLINK "
+.LASF534:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1229:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF678:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF757:
+	.string	"WINT_MIN (0u)"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1084:
+	.string	"IOCFG_OUT_PP 0"
+.LASF997:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF919:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF950:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF830:
+	.string	"__DEFINED_size_t "
+.LASF1134:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1320:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF874:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1455:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1341:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1401:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF578:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1250:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1206:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF800:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1086:
+	.string	"IOCFG_AF_PP 0"
+.LASF1057:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1067:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1428:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF380:
+	.string	"__unix 1"
+.LASF600:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF631:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF920:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF580:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1542:
+	.string	"long unsigned int"
+.LASF1110:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1497:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF744:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1091:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF472:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF443:
+	.string	"VTX_TRAMP "
+.LASF634:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF636:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1490:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF680:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF799:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF907:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1477:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF677:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF778:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1001:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1028:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF670:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF876:
+	.string	"USE_UART3 "
+.LASF410:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1537:
+	.string	"VTX_CHANNEL_MAX 8"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1128:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1313:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF818:
+	.string	"__SIZE_T__ "
+.LASF1111:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1185:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF560:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF552:
+	.string	"__STRING(x) #x"
+.LASF1047:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1211:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF942:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF530:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF513:
+	.string	"__USE_XOPEN 1"
+.LASF790:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1541:
+	.string	"unsigned int"
+.LASF458:
+	.string	"__USE_UNIX98"
+.LASF877:
+	.string	"USE_UART4 "
+.LASF1319:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1481:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF573:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1093:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF638:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF583:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1419:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1205:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1063:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF658:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF536:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1055:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1356:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1544:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF547:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1489:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1248:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1458:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF878:
+	.string	"USE_UART5 "
+.LASF1404:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF654:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1002:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1048:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF769:
+	.string	"INT8_WIDTH 8"
+.LASF602:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF929:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1445:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF815:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF981:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1065:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF506:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1488:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF879:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF592:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1251:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1596:
+	.string	"io_types.h"
+.LASF1593:
+	.string	"vtx_rtc6705.h"
+.LASF1566:
+	.string	"platform.h"
+.LASF1553:
+	.string	"src/main/drivers"
+.LASF1598:
+	.string	"rx_pwm.h"
+.LASF1570:
+	.string	"libc-header-start.h"
+.LASF1561:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1555:
+	.string	"src/main/io"
+.LASF1551:
+	.string	"src/main/common"
+.LASF1583:
+	.string	"stdint-intn.h"
+.LASF1568:
+	.string	"target.h"
+.LASF1560:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1563:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1577:
+	.string	"stubs.h"
+.LASF1591:
+	.string	"build_config.h"
+.LASF1556:
+	.string	"src/main/target/SITL"
+.LASF1609:
+	.string	"beeper.h"
+.LASF1574:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1605:
+	.string	"io_def_generated.h"
+.LASF1559:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1594:
+	.string	"config.h"
+.LASF1576:
+	.string	"long-double.h"
+.LASF1572:
+	.string	"features-time64.h"
+.LASF1607:
+	.string	"vcd.h"
+.LASF1606:
+	.string	"sound_beeper.h"
+.LASF1579:
+	.string	"types.h"
+.LASF1608:
+	.string	"runtime_config.h"
+.LASF1589:
+	.string	"stdbool.h"
+.LASF1562:
+	.string	"/usr/include"
+.LASF1612:
+	.string	"vtx.h"
+.LASF1550:
+	.string	"src/main/build"
+.LASF1571:
+	.string	"features.h"
+.LASF1567:
+	.string	"common.h"
+.LASF1580:
+	.string	"typesizes.h"
+.LASF0:
+	.string	"./src/main/io/vtx.c"
+.LASF1600:
+	.string	"serial.h"
+.LASF1613:
+	.string	"rc_controls.h"
+.LASF1552:
+	.string	"src/main/config"
+.LASF1597:
+	.string	"flash.h"
+.LASF1581:
+	.string	"time64.h"
+.LASF1584:
+	.string	"stdint-uintn.h"
+.LASF1557:
+	.string	"src/main/target"
+.LASF1604:
+	.string	"utils.h"
+.LASF1599:
+	.string	"sdcard.h"
+.LASF1558:
+	.string	"src/main"
+.LASF1610:
+	.string	"time.h"
+.LASF1592:
+	.string	"parameter_group_ids.h"
+.LASF1582:
+	.string	"wchar.h"
+.LASF1603:
+	.string	"io_def.h"
+.LASF1554:
+	.string	"src/main/fc"
+.LASF1601:
+	.string	"io.h"
+.LASF1587:
+	.string	"maths.h"
+.LASF1564:
+	.string	"vtx.c"
+.LASF1575:
+	.string	"cdefs.h"
+.LASF1569:
+	.string	"stdint.h"
+.LASF1588:
+	.string	"config_eeprom.h"
+.LASF1585:
+	.string	"stddef.h"
+.LASF1578:
+	.string	"stubs-64.h"
+.LASF1573:
+	.string	"wordsize.h"
+.LASF1611:
+	.string	"osd.h"
+.LASF1586:
+	.string	"common_post.h"
+.LASF1595:
+	.string	"adc.h"
+.LASF1590:
+	.string	"parameter_group.h"
+.LASF1602:
+	.string	"resource.h"
+.LASF1565:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.114f756c706a46f4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.114f756c706a46f4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.114f756c706a46f4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.114f756c706a46f4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.114f756c706a46f4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.114f756c706a46f4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.114f756c706a46f4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.114f756c706a46f4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.114f756c706a46f4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.114f756c706a46f4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.114f756c706a46f4,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symtab.114f756c706a46f4,"e",@progbits
+	.text
+	.section	.gnu.lto_.ext_symtab.114f756c706a46f4,"e",@progbits
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,14387 @@
+	.file	"msp_serial.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/streambuf.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/drivers/serial.h"
+	.file 8 "./src/main/fc/fc_dispatch.h"
+	.file 9 "./src/main/drivers/resource.h"
+	.file 10 "./src/main/io/serial.h"
+	.file 11 "./src/main/msp/msp.h"
+	.file 12 "./src/main/msp/msp_serial.h"
+	.file 13 "./src/main/msp/msp_serial.c"
+	.file 14 "./src/main/common/maths.h"
+	.file 15 "/usr/include/string.h"
+	.file 16 "./src/main/drivers/system.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	msp_serial.c.c7e32492
+	.weak	msp_serial.c.c7e32492
+msp_serial.c.c7e32492:
+	.long	0x1426
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x23
+	.long	.LASF1894
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1595
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1596
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1597
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1598
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1599
+	.uleb128 0x6
+	.long	.LASF1600
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.long	.LASF1601
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1602
+	.uleb128 0x6
+	.long	.LASF1603
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x6
+	.long	.LASF1604
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x7c
+	.uleb128 0x6
+	.long	.LASF1605
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1606
+	.uleb128 0x25
+	.byte	0x8
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1607
+	.uleb128 0x6
+	.long	.LASF1608
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x6
+	.long	.LASF1609
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x6
+	.long	.LASF1610
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x8
+	.long	0xbc
+	.uleb128 0x26
+	.long	0xbc
+	.uleb128 0x6
+	.long	.LASF1611
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x8
+	.long	0xd2
+	.uleb128 0x6
+	.long	.LASF1612
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x8
+	.long	0xe3
+	.uleb128 0x6
+	.long	.LASF1613
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1614
+	.uleb128 0xf
+	.long	.LASF1682
+	.byte	0x10
+	.byte	0x5
+	.byte	0x19
+	.byte	0x10
+	.long	0x12f
+	.uleb128 0x15
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x1a
+	.byte	0xe
+	.long	0x12f
+	.byte	0
+	.uleb128 0x15
+	.string	"end"
+	.byte	0x5
+	.byte	0x1b
+	.byte	0xe
+	.long	0x12f
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xbc
+	.uleb128 0x6
+	.long	.LASF1615
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x3
+	.long	0x107
+	.uleb128 0x6
+	.long	.LASF1616
+	.byte	0x6
+	.byte	0x19
+	.byte	0x11
+	.long	0xb0
+	.uleb128 0x6
+	.long	.LASF1617
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0xe3
+	.uleb128 0x8
+	.long	0x14c
+	.uleb128 0x16
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x14
+	.long	0x284
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1662
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1668
+	.long	0x30
+	.byte	0x16
+	.long	0x2a5
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1668
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x3
+	.long	0x284
+	.uleb128 0x1e
+	.long	.LASF1669
+	.long	0x30
+	.byte	0x1c
+	.long	0x2fc
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1671
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1675
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1676
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1677
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1678
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1679
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1669
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x3
+	.long	0x2b1
+	.uleb128 0x6
+	.long	.LASF1680
+	.byte	0x7
+	.byte	0x31
+	.byte	0x10
+	.long	0x314
+	.uleb128 0x5
+	.long	0x319
+	.uleb128 0x10
+	.long	0x324
+	.uleb128 0x2
+	.long	0xd2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1681
+	.byte	0x7
+	.byte	0x32
+	.byte	0x10
+	.long	0x330
+	.uleb128 0x5
+	.long	0x335
+	.uleb128 0x10
+	.long	0x345
+	.uleb128 0x2
+	.long	0x345
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0xc8
+	.uleb128 0xf
+	.long	.LASF1683
+	.byte	0x50
+	.byte	0x7
+	.byte	0x34
+	.byte	0x10
+	.long	0x41b
+	.uleb128 0x3
+	.long	.LASF1684
+	.byte	0x7
+	.byte	0x36
+	.byte	0x24
+	.long	0x4ca
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1685
+	.byte	0x7
+	.byte	0x38
+	.byte	0xd
+	.long	0xbc
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1686
+	.byte	0x7
+	.byte	0x39
+	.byte	0x10
+	.long	0x2a5
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1687
+	.byte	0x7
+	.byte	0x3a
+	.byte	0x13
+	.long	0x2fc
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1688
+	.byte	0x7
+	.byte	0x3c
+	.byte	0xe
+	.long	0xe3
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1689
+	.byte	0x7
+	.byte	0x3e
+	.byte	0xe
+	.long	0xe3
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1690
+	.byte	0x7
+	.byte	0x3f
+	.byte	0xe
+	.long	0xe3
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF1691
+	.byte	0x7
+	.byte	0x40
+	.byte	0x17
+	.long	0x4cf
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1692
+	.byte	0x7
+	.byte	0x41
+	.byte	0x17
+	.long	0x4cf
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1693
+	.byte	0x7
+	.byte	0x42
+	.byte	0xe
+	.long	0xe3
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1694
+	.byte	0x7
+	.byte	0x43
+	.byte	0xe
+	.long	0xe3
+	.byte	0x34
+	.uleb128 0x3
+	.long	.LASF1695
+	.byte	0x7
+	.byte	0x44
+	.byte	0xe
+	.long	0xe3
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1696
+	.byte	0x7
+	.byte	0x45
+	.byte	0xe
+	.long	0xe3
+	.byte	0x3c
+	.uleb128 0x3
+	.long	.LASF1697
+	.byte	0x7
+	.byte	0x47
+	.byte	0x1e
+	.long	0x308
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1698
+	.byte	0x7
+	.byte	0x48
+	.byte	0x23
+	.long	0x324
+	.byte	0x48
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1699
+	.byte	0x60
+	.byte	0x7
+	.byte	0x5a
+	.byte	0x8
+	.long	0x4c5
+	.uleb128 0x3
+	.long	.LASF1700
+	.byte	0x7
+	.byte	0x5b
+	.byte	0xc
+	.long	0x4fa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1701
+	.byte	0x7
+	.byte	0x5d
+	.byte	0x10
+	.long	0x513
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1702
+	.byte	0x7
+	.byte	0x5e
+	.byte	0x10
+	.long	0x513
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1703
+	.byte	0x7
+	.byte	0x60
+	.byte	0xf
+	.long	0x527
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1704
+	.byte	0x7
+	.byte	0x63
+	.byte	0xc
+	.long	0x53c
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1705
+	.byte	0x7
+	.byte	0x65
+	.byte	0xb
+	.long	0x55c
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1706
+	.byte	0x7
+	.byte	0x67
+	.byte	0xc
+	.long	0x571
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1707
+	.byte	0x7
+	.byte	0x69
+	.byte	0xc
+	.long	0x591
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1708
+	.byte	0x7
+	.byte	0x6b
+	.byte	0xc
+	.long	0x5a1
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1709
+	.byte	0x7
+	.byte	0x6c
+	.byte	0xc
+	.long	0x5a1
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF1710
+	.byte	0x7
+	.byte	0x6f
+	.byte	0xb
+	.long	0x5bf
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF1711
+	.byte	0x7
+	.byte	0x71
+	.byte	0xb
+	.long	0x5d8
+	.byte	0x58
+	.byte	0
+	.uleb128 0x8
+	.long	0x41b
+	.uleb128 0x5
+	.long	0x4c5
+	.uleb128 0x5
+	.long	0xcd
+	.uleb128 0x6
+	.long	.LASF1712
+	.byte	0x7
+	.byte	0x49
+	.byte	0x3
+	.long	0x34a
+	.uleb128 0x8
+	.long	0x4d4
+	.uleb128 0x10
+	.long	0x4f5
+	.uleb128 0x2
+	.long	0x4f5
+	.uleb128 0x2
+	.long	0xbc
+	.byte	0
+	.uleb128 0x5
+	.long	0x4d4
+	.uleb128 0x5
+	.long	0x4e5
+	.uleb128 0x13
+	.long	0xe3
+	.long	0x50e
+	.uleb128 0x2
+	.long	0x50e
+	.byte	0
+	.uleb128 0x5
+	.long	0x4e0
+	.uleb128 0x5
+	.long	0x4ff
+	.uleb128 0x13
+	.long	0xbc
+	.long	0x527
+	.uleb128 0x2
+	.long	0x4f5
+	.byte	0
+	.uleb128 0x5
+	.long	0x518
+	.uleb128 0x10
+	.long	0x53c
+	.uleb128 0x2
+	.long	0x4f5
+	.uleb128 0x2
+	.long	0xe3
+	.byte	0
+	.uleb128 0x5
+	.long	0x52c
+	.uleb128 0x13
+	.long	0x550
+	.long	0x550
+	.uleb128 0x2
+	.long	0x50e
+	.byte	0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1713
+	.uleb128 0x8
+	.long	0x550
+	.uleb128 0x5
+	.long	0x541
+	.uleb128 0x10
+	.long	0x571
+	.uleb128 0x2
+	.long	0x4f5
+	.uleb128 0x2
+	.long	0x2a5
+	.byte	0
+	.uleb128 0x5
+	.long	0x561
+	.uleb128 0x10
+	.long	0x58b
+	.uleb128 0x2
+	.long	0x4f5
+	.uleb128 0x2
+	.long	0x58b
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0x590
+	.uleb128 0x27
+	.uleb128 0x5
+	.long	0x576
+	.uleb128 0x10
+	.long	0x5a1
+	.uleb128 0x2
+	.long	0x4f5
+	.byte	0
+	.uleb128 0x5
+	.long	0x596
+	.uleb128 0x13
+	.long	0x7c
+	.long	0x5bf
+	.uleb128 0x2
+	.long	0x4f5
+	.uleb128 0x2
+	.long	0x12f
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0x5a6
+	.uleb128 0x13
+	.long	0x550
+	.long	0x5d8
+	.uleb128 0x2
+	.long	0x4f5
+	.uleb128 0x2
+	.long	0x324
+	.byte	0
+	.uleb128 0x5
+	.long	0x5c4
+	.uleb128 0x6
+	.long	.LASF1714
+	.byte	0x8
+	.byte	0x15
+	.byte	0xe
+	.long	0x5e9
+	.uleb128 0x10
+	.long	0x5f4
+	.uleb128 0x2
+	.long	0x5f4
+	.byte	0
+	.uleb128 0x5
+	.long	0x5f9
+	.uleb128 0xf
+	.long	.LASF1715
+	.byte	0x18
+	.byte	0x8
+	.byte	0x17
+	.byte	0x10
+	.long	0x62e
+	.uleb128 0x3
+	.long	.LASF1716
+	.byte	0x8
+	.byte	0x18
+	.byte	0x13
+	.long	0x62e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1717
+	.byte	0x8
+	.byte	0x19
+	.byte	0xe
+	.long	0xe3
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1718
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x1d
+	.long	0x5f4
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	0x5dd
+	.uleb128 0x6
+	.long	.LASF1719
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x3
+	.long	0x5f9
+	.uleb128 0x16
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x20
+	.long	0x6a5
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x80
+	.uleb128 0x18
+	.long	.LASF1729
+	.value	0x200
+	.uleb128 0x18
+	.long	.LASF1730
+	.value	0x400
+	.uleb128 0x18
+	.long	.LASF1731
+	.value	0x800
+	.uleb128 0x18
+	.long	.LASF1732
+	.value	0x1000
+	.uleb128 0x18
+	.long	.LASF1733
+	.value	0x2000
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1734
+	.byte	0xa
+	.byte	0x2f
+	.byte	0x3
+	.long	0x63f
+	.uleb128 0xe
+	.long	0xef
+	.long	0x6bc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x8
+	.long	0x6b1
+	.uleb128 0x29
+	.long	.LASF1895
+	.byte	0xa
+	.byte	0x44
+	.byte	0x17
+	.long	0x6bc
+	.uleb128 0x16
+	.byte	0x5
+	.long	0x7c
+	.byte	0xa
+	.byte	0x47
+	.long	0x721
+	.uleb128 0x1f
+	.long	.LASF1735
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1747
+	.byte	0xa
+	.byte	0x54
+	.byte	0x3
+	.long	0x6cd
+	.uleb128 0xf
+	.long	.LASF1748
+	.byte	0xc
+	.byte	0xa
+	.byte	0x69
+	.byte	0x10
+	.long	0x789
+	.uleb128 0x3
+	.long	.LASF1749
+	.byte	0xa
+	.byte	0x6a
+	.byte	0xe
+	.long	0xd2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1685
+	.byte	0xa
+	.byte	0x6b
+	.byte	0x1c
+	.long	0x721
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1750
+	.byte	0xa
+	.byte	0x6c
+	.byte	0xd
+	.long	0xbc
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1751
+	.byte	0xa
+	.byte	0x6d
+	.byte	0xd
+	.long	0xbc
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1752
+	.byte	0xa
+	.byte	0x6e
+	.byte	0xd
+	.long	0xbc
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1753
+	.byte	0xa
+	.byte	0x6f
+	.byte	0xd
+	.long	0xbc
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1754
+	.byte	0xa
+	.byte	0x70
+	.byte	0x3
+	.long	0x72d
+	.uleb128 0x16
+	.byte	0x5
+	.long	0x7c
+	.byte	0xb
+	.byte	0x19
+	.long	0x7b3
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x1
+	.uleb128 0x1f
+	.long	.LASF1756
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1758
+	.byte	0xb
+	.byte	0x1d
+	.byte	0x3
+	.long	0x795
+	.uleb128 0x8
+	.long	0x7b3
+	.uleb128 0x6
+	.long	.LASF1759
+	.byte	0xb
+	.byte	0x23
+	.byte	0xf
+	.long	0x7d0
+	.uleb128 0x5
+	.long	0x7d5
+	.uleb128 0x13
+	.long	0x7c
+	.long	0x7f3
+	.uleb128 0x2
+	.long	0xe3
+	.uleb128 0x2
+	.long	0xe3
+	.uleb128 0x2
+	.long	0x12f
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1760
+	.byte	0x28
+	.byte	0xb
+	.byte	0x25
+	.byte	0x10
+	.long	0x85c
+	.uleb128 0x15
+	.string	"buf"
+	.byte	0xb
+	.byte	0x26
+	.byte	0xc
+	.long	0x134
+	.byte	0
+	.uleb128 0x15
+	.string	"cmd"
+	.byte	0xb
+	.byte	0x27
+	.byte	0xe
+	.long	0xd2
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1761
+	.byte	0xb
+	.byte	0x28
+	.byte	0xd
+	.long	0xa4
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF1762
+	.byte	0xb
+	.byte	0x2d
+	.byte	0xe
+	.long	0xd2
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1763
+	.byte	0xb
+	.byte	0x2e
+	.byte	0xe
+	.long	0xd2
+	.byte	0x16
+	.uleb128 0x3
+	.long	.LASF1764
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x14
+	.long	0x7c4
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1765
+	.byte	0xb
+	.byte	0x30
+	.byte	0xe
+	.long	0xe3
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1766
+	.byte	0xb
+	.byte	0x31
+	.byte	0x3
+	.long	0x7f3
+	.uleb128 0x6
+	.long	.LASF1767
+	.byte	0xb
+	.byte	0x34
+	.byte	0x10
+	.long	0x879
+	.uleb128 0x8
+	.long	0x868
+	.uleb128 0x5
+	.long	0x87e
+	.uleb128 0x10
+	.long	0x889
+	.uleb128 0x2
+	.long	0x889
+	.byte	0
+	.uleb128 0x5
+	.long	0x34a
+	.uleb128 0x6
+	.long	.LASF1768
+	.byte	0xb
+	.byte	0x35
+	.byte	0x17
+	.long	0x89a
+	.uleb128 0x5
+	.long	0x89f
+	.uleb128 0x13
+	.long	0x7b3
+	.long	0x8b8
+	.uleb128 0x2
+	.long	0x8b8
+	.uleb128 0x2
+	.long	0x8b8
+	.uleb128 0x2
+	.long	0x8bd
+	.byte	0
+	.uleb128 0x5
+	.long	0x85c
+	.uleb128 0x5
+	.long	0x868
+	.uleb128 0x6
+	.long	.LASF1769
+	.byte	0xb
+	.byte	0x37
+	.byte	0xf
+	.long	0x8ce
+	.uleb128 0x5
+	.long	0x8d3
+	.uleb128 0x13
+	.long	0x550
+	.long	0x8e7
+	.uleb128 0x2
+	.long	0xd2
+	.uleb128 0x2
+	.long	0x8e7
+	.byte	0
+	.uleb128 0x5
+	.long	0x134
+	.uleb128 0x16
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x1d
+	.long	0x93b
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1776
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1777
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1778
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1779
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1780
+	.byte	0xa
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1781
+	.byte	0xc
+	.byte	0x29
+	.byte	0x3
+	.long	0x8ec
+	.uleb128 0x16
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x2b
+	.long	0x960
+	.uleb128 0x1
+	.long	.LASF1782
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1783
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1784
+	.byte	0xc
+	.byte	0x2e
+	.byte	0x3
+	.long	0x947
+	.uleb128 0xf
+	.long	.LASF1785
+	.byte	0x5
+	.byte	0xc
+	.byte	0x31
+	.byte	0x10
+	.long	0x9a1
+	.uleb128 0x3
+	.long	.LASF1786
+	.byte	0xc
+	.byte	0x32
+	.byte	0xd
+	.long	0xbc
+	.byte	0
+	.uleb128 0x15
+	.string	"cmd"
+	.byte	0xc
+	.byte	0x33
+	.byte	0xe
+	.long	0xd2
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1787
+	.byte	0xc
+	.byte	0x34
+	.byte	0xe
+	.long	0xd2
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1788
+	.byte	0xc
+	.byte	0x35
+	.byte	0x1b
+	.long	0x96c
+	.uleb128 0x8
+	.long	0x9a1
+	.uleb128 0x16
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x37
+	.long	0x9cb
+	.uleb128 0x1
+	.long	.LASF1789
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1790
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1791
+	.byte	0xc
+	.byte	0x3a
+	.byte	0x3
+	.long	0x9b2
+	.uleb128 0xf
+	.long	.LASF1792
+	.byte	0x30
+	.byte	0xc
+	.byte	0x58
+	.byte	0x10
+	.long	0xa59
+	.uleb128 0x3
+	.long	.LASF1793
+	.byte	0xc
+	.byte	0x59
+	.byte	0x9
+	.long	0x550
+	.byte	0
+	.uleb128 0x15
+	.string	"buf"
+	.byte	0xc
+	.byte	0x5a
+	.byte	0x14
+	.long	0x345
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1794
+	.byte	0xc
+	.byte	0x5b
+	.byte	0xe
+	.long	0xd2
+	.byte	0x10
+	.uleb128 0x15
+	.string	"fn"
+	.byte	0xc
+	.byte	0x5c
+	.byte	0x14
+	.long	0x7c4
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1795
+	.byte	0xc
+	.byte	0x5d
+	.byte	0xe
+	.long	0xe3
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1796
+	.byte	0xc
+	.byte	0x5e
+	.byte	0xe
+	.long	0xd2
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF1797
+	.byte	0xc
+	.byte	0x5f
+	.byte	0xe
+	.long	0xd2
+	.byte	0x26
+	.uleb128 0x3
+	.long	.LASF1798
+	.byte	0xc
+	.byte	0x60
+	.byte	0xd
+	.long	0xbc
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1799
+	.byte	0xc
+	.byte	0x61
+	.byte	0x12
+	.long	0x960
+	.byte	0x2c
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1800
+	.byte	0xc
+	.byte	0x62
+	.byte	0x3
+	.long	0x9d7
+	.uleb128 0x8
+	.long	0xa59
+	.uleb128 0xf
+	.long	.LASF1801
+	.byte	0x24
+	.byte	0xc
+	.byte	0x69
+	.byte	0x10
+	.long	0xac6
+	.uleb128 0x3
+	.long	.LASF1802
+	.byte	0xc
+	.byte	0x6a
+	.byte	0xe
+	.long	0xac6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1803
+	.byte	0xc
+	.byte	0x6b
+	.byte	0xd
+	.long	0xbc
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1799
+	.byte	0xc
+	.byte	0x6c
+	.byte	0x12
+	.long	0x960
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1804
+	.byte	0xc
+	.byte	0x6d
+	.byte	0x11
+	.long	0x140
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1805
+	.byte	0xc
+	.byte	0x6e
+	.byte	0xe
+	.long	0x14c
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF1806
+	.byte	0xc
+	.byte	0x6f
+	.byte	0xe
+	.long	0xd2
+	.byte	0x20
+	.byte	0
+	.uleb128 0xe
+	.long	0xd2
+	.long	0xad6
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1807
+	.byte	0xc
+	.byte	0x70
+	.byte	0x3
+	.long	0xa6a
+	.uleb128 0x2a
+	.long	.LASF1808
+	.value	0x140
+	.byte	0xc
+	.byte	0x74
+	.byte	0x10
+	.long	0xb8d
+	.uleb128 0x3
+	.long	.LASF1809
+	.byte	0xc
+	.byte	0x75
+	.byte	0x1a
+	.long	0x889
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1796
+	.byte	0xc
+	.byte	0x76
+	.byte	0xe
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1810
+	.byte	0xc
+	.byte	0x77
+	.byte	0xe
+	.long	0xd2
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1798
+	.byte	0xc
+	.byte	0x78
+	.byte	0xd
+	.long	0xbc
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1811
+	.byte	0xc
+	.byte	0x79
+	.byte	0xe
+	.long	0xd2
+	.byte	0xe
+	.uleb128 0x3
+	.long	.LASF1812
+	.byte	0xc
+	.byte	0x7a
+	.byte	0xd
+	.long	0xbc
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1813
+	.byte	0xc
+	.byte	0x7b
+	.byte	0x12
+	.long	0x960
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1814
+	.byte	0xc
+	.byte	0x7c
+	.byte	0x10
+	.long	0x93b
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1815
+	.byte	0xc
+	.byte	0x7d
+	.byte	0x11
+	.long	0xa59
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1816
+	.byte	0xc
+	.byte	0x7e
+	.byte	0x19
+	.long	0x868
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF1817
+	.byte	0xc
+	.byte	0x80
+	.byte	0x1b
+	.long	0xad6
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF1818
+	.byte	0xc
+	.byte	0x82
+	.byte	0xd
+	.long	0xb8d
+	.byte	0x7c
+	.byte	0
+	.uleb128 0xe
+	.long	0xbc
+	.long	0xb9d
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xbf
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1819
+	.byte	0xc
+	.byte	0x83
+	.byte	0x3
+	.long	0xae2
+	.uleb128 0x8
+	.long	0xb9d
+	.uleb128 0xe
+	.long	0xb9d
+	.long	0xbbe
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1820
+	.byte	0x28
+	.byte	0x12
+	.long	0xbae
+	.uleb128 0xe
+	.long	0xbc
+	.long	0xbd9
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1821
+	.value	0x12f
+	.byte	0x10
+	.long	0xbc9
+	.uleb128 0xe
+	.long	0x633
+	.long	0xbf5
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1822
+	.value	0x134
+	.byte	0x18
+	.long	0xbe5
+	.uleb128 0xe
+	.long	0x550
+	.long	0xc11
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1823
+	.value	0x135
+	.byte	0xc
+	.long	0xc01
+	.uleb128 0x14
+	.long	.LASF1827
+	.byte	0x5
+	.byte	0x23
+	.long	0xc38
+	.uleb128 0x2
+	.long	0x8e7
+	.uleb128 0x2
+	.long	0x58b
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1705
+	.byte	0x7
+	.byte	0x7d
+	.byte	0x5
+	.long	0x550
+	.long	0xc4e
+	.uleb128 0x2
+	.long	0x50e
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1896
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x6
+	.uleb128 0xb
+	.long	.LASF1824
+	.byte	0x5
+	.byte	0x2c
+	.byte	0xa
+	.long	0x12f
+	.long	0xc6c
+	.uleb128 0x2
+	.long	0x8e7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1825
+	.byte	0x5
+	.byte	0x27
+	.byte	0xa
+	.long	0xd2
+	.long	0xc82
+	.uleb128 0x2
+	.long	0x8e7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1826
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x5
+	.long	0x7c
+	.long	0xc98
+	.uleb128 0x2
+	.long	0x8e7
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1828
+	.byte	0x8
+	.byte	0x20
+	.long	0xcae
+	.uleb128 0x2
+	.long	0xcae
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0x633
+	.uleb128 0x14
+	.long	.LASF1829
+	.byte	0x5
+	.byte	0x30
+	.long	0xcc9
+	.uleb128 0x2
+	.long	0x8e7
+	.uleb128 0x2
+	.long	0x12f
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1830
+	.byte	0xe
+	.byte	0x93
+	.byte	0x9
+	.long	0xbc
+	.long	0xce4
+	.uleb128 0x2
+	.long	0xbc
+	.uleb128 0x2
+	.long	0x22
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1831
+	.byte	0x7
+	.byte	0x84
+	.long	0xcf5
+	.uleb128 0x2
+	.long	0x4f5
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1832
+	.byte	0x7
+	.byte	0x77
+	.long	0xd10
+	.uleb128 0x2
+	.long	0x4f5
+	.uleb128 0x2
+	.long	0x345
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1833
+	.byte	0x7
+	.byte	0x76
+	.byte	0xa
+	.long	0xe3
+	.long	0xd26
+	.uleb128 0x2
+	.long	0x50e
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1834
+	.byte	0x7
+	.byte	0x83
+	.long	0xd37
+	.uleb128 0x2
+	.long	0x4f5
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1835
+	.byte	0xa
+	.byte	0xa4
+	.long	0xd4d
+	.uleb128 0x2
+	.long	0x4f5
+	.uleb128 0x2
+	.long	0xbc
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1836
+	.byte	0x7
+	.byte	0x79
+	.byte	0x5
+	.long	0x7c
+	.long	0xd6d
+	.uleb128 0x2
+	.long	0x4f5
+	.uleb128 0x2
+	.long	0x12f
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1897
+	.byte	0x10
+	.byte	0x1b
+	.byte	0xa
+	.long	0xe3
+	.uleb128 0x14
+	.long	.LASF1837
+	.byte	0xa
+	.byte	0x9a
+	.long	0xd8a
+	.uleb128 0x2
+	.long	0x4f5
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1838
+	.byte	0xf
+	.byte	0x3d
+	.byte	0xe
+	.long	0x9b
+	.long	0xdaa
+	.uleb128 0x2
+	.long	0x9b
+	.uleb128 0x2
+	.long	0x7c
+	.uleb128 0x2
+	.long	0xf4
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1839
+	.byte	0xa
+	.byte	0x87
+	.byte	0x15
+	.long	0xdc0
+	.long	0xdc0
+	.uleb128 0x2
+	.long	0x6a5
+	.byte	0
+	.uleb128 0x5
+	.long	0x789
+	.uleb128 0xb
+	.long	.LASF1840
+	.byte	0xa
+	.byte	0x92
+	.byte	0xf
+	.long	0x4f5
+	.long	0xdf4
+	.uleb128 0x2
+	.long	0x721
+	.uleb128 0x2
+	.long	0x6a5
+	.uleb128 0x2
+	.long	0x308
+	.uleb128 0x2
+	.long	0xe3
+	.uleb128 0x2
+	.long	0x2a5
+	.uleb128 0x2
+	.long	0x2fc
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1841
+	.byte	0xa
+	.byte	0x86
+	.byte	0x15
+	.long	0xdc0
+	.long	0xe0a
+	.uleb128 0x2
+	.long	0x6a5
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1842
+	.value	0x24d
+	.byte	0xa
+	.long	0xe3
+	.long	0xe4f
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x24f
+	.byte	0xe
+	.long	0xe3
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1843
+	.value	0x251
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1844
+	.value	0x252
+	.byte	0x1b
+	.long	0xe54
+	.uleb128 0x4
+	.long	.LASF1845
+	.value	0x25c
+	.byte	0x18
+	.long	0xef
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xb9d
+	.uleb128 0x8
+	.long	0xe4f
+	.uleb128 0x1d
+	.long	.LASF1854
+	.value	0x226
+	.long	0xebf
+	.uleb128 0x9
+	.long	.LASF1846
+	.value	0x226
+	.byte	0x2a
+	.long	0x14c
+	.uleb128 0x9
+	.long	.LASF1847
+	.value	0x226
+	.byte	0x4d
+	.long	0x8c2
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1843
+	.value	0x228
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1844
+	.value	0x229
+	.byte	0x1b
+	.long	0xe54
+	.uleb128 0x4
+	.long	.LASF1817
+	.value	0x22a
+	.byte	0x20
+	.long	0xebf
+	.uleb128 0x7
+	.uleb128 0x12
+	.string	"i"
+	.value	0x239
+	.byte	0x12
+	.long	0x7c
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1848
+	.value	0x23a
+	.byte	0x19
+	.long	0x85c
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xad6
+	.uleb128 0x1c
+	.long	.LASF1849
+	.value	0x216
+	.byte	0xd
+	.long	0x140
+	.long	0xefd
+	.uleb128 0x4
+	.long	.LASF1804
+	.value	0x218
+	.byte	0x11
+	.long	0x140
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1843
+	.value	0x219
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1844
+	.value	0x21a
+	.byte	0x1a
+	.long	0xefd
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xba9
+	.uleb128 0x1c
+	.long	.LASF1850
+	.value	0x1f0
+	.byte	0x5
+	.long	0x7c
+	.long	0xf77
+	.uleb128 0x19
+	.string	"cmd"
+	.value	0x1f0
+	.byte	0x1b
+	.long	0xbc
+	.uleb128 0x9
+	.long	.LASF1851
+	.value	0x1f0
+	.byte	0x2f
+	.long	0x345
+	.uleb128 0x9
+	.long	.LASF1852
+	.value	0x1f0
+	.byte	0x39
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF1853
+	.value	0x1f2
+	.byte	0x14
+	.long	0xf77
+	.uleb128 0x12
+	.string	"ret"
+	.value	0x1f3
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF1817
+	.value	0x1f5
+	.byte	0x11
+	.long	0x85c
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1843
+	.value	0x1fb
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1844
+	.value	0x1fc
+	.byte	0x1b
+	.long	0xe54
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xbc
+	.long	0xf87
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x1d
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1855
+	.value	0x1e5
+	.long	0xfa1
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1843
+	.value	0x1ea
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1856
+	.value	0x1c0
+	.long	0x1021
+	.uleb128 0x9
+	.long	.LASF1857
+	.value	0x1c0
+	.byte	0x2f
+	.long	0x9cb
+	.uleb128 0x9
+	.long	.LASF1858
+	.value	0x1c0
+	.byte	0x5a
+	.long	0x88e
+	.uleb128 0x4
+	.long	.LASF1859
+	.value	0x1c2
+	.byte	0x14
+	.long	0x158
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1843
+	.value	0x1c4
+	.byte	0x12
+	.long	0xbc
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1844
+	.value	0x1c5
+	.byte	0x1b
+	.long	0xe54
+	.uleb128 0x7
+	.uleb128 0x12
+	.string	"buf"
+	.value	0x1cf
+	.byte	0x19
+	.long	0x1021
+	.uleb128 0x4
+	.long	.LASF1803
+	.value	0x1d0
+	.byte	0x1b
+	.long	0x83
+	.uleb128 0x7
+	.uleb128 0x12
+	.string	"i"
+	.value	0x1d4
+	.byte	0x1a
+	.long	0x7c
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1860
+	.value	0x1d5
+	.byte	0x1f
+	.long	0x557
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xbc
+	.long	0x1031
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1861
+	.value	0x1af
+	.byte	0xc
+	.long	0x550
+	.long	0x104e
+	.uleb128 0x9
+	.long	.LASF1844
+	.value	0x1af
+	.byte	0x38
+	.long	0xefd
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1862
+	.value	0x1a4
+	.byte	0xc
+	.long	0x550
+	.long	0x107b
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1843
+	.value	0x1a6
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1815
+	.value	0x1a7
+	.byte	0x1c
+	.long	0x107b
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xa65
+	.uleb128 0x20
+	.long	.LASF1871
+	.value	0x17f
+	.long	0x10ee
+	.uleb128 0x19
+	.string	"msp"
+	.value	0x17f
+	.byte	0x38
+	.long	0xe4f
+	.uleb128 0x9
+	.long	.LASF1858
+	.value	0x17f
+	.byte	0x54
+	.long	0x88e
+	.uleb128 0x4
+	.long	.LASF1863
+	.value	0x181
+	.byte	0x11
+	.long	0x85c
+	.uleb128 0x4
+	.long	.LASF1864
+	.value	0x187
+	.byte	0xe
+	.long	0x12f
+	.uleb128 0x4
+	.long	.LASF1865
+	.value	0x189
+	.byte	0x11
+	.long	0x85c
+	.uleb128 0x4
+	.long	.LASF1866
+	.value	0x18f
+	.byte	0x19
+	.long	0x868
+	.uleb128 0x4
+	.long	.LASF1867
+	.value	0x190
+	.byte	0x17
+	.long	0x7bf
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1843
+	.value	0x19a
+	.byte	0x13
+	.long	0x83
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1868
+	.value	0x170
+	.byte	0x14
+	.long	0x7b3
+	.long	0x113b
+	.uleb128 0x19
+	.string	"msp"
+	.value	0x170
+	.byte	0x37
+	.long	0xe4f
+	.uleb128 0x9
+	.long	.LASF1858
+	.value	0x170
+	.byte	0x53
+	.long	0x88e
+	.uleb128 0x9
+	.long	.LASF1865
+	.value	0x170
+	.byte	0x75
+	.long	0x8b8
+	.uleb128 0x9
+	.long	.LASF1863
+	.value	0x170
+	.byte	0x8b
+	.long	0x8b8
+	.uleb128 0x9
+	.long	.LASF1866
+	.value	0x170
+	.byte	0xa7
+	.long	0x8bd
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1869
+	.value	0x151
+	.byte	0x14
+	.long	0x7b3
+	.long	0x11a2
+	.uleb128 0x19
+	.string	"msp"
+	.value	0x151
+	.byte	0x32
+	.long	0xe4f
+	.uleb128 0x19
+	.string	"src"
+	.value	0x151
+	.byte	0x3f
+	.long	0x8e7
+	.uleb128 0x4
+	.long	.LASF1817
+	.value	0x153
+	.byte	0x1c
+	.long	0xebf
+	.uleb128 0x4
+	.long	.LASF1870
+	.value	0x155
+	.byte	0x14
+	.long	0xde
+	.uleb128 0x4
+	.long	.LASF1803
+	.value	0x156
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x7
+	.uleb128 0x12
+	.string	"i"
+	.value	0x15f
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x7
+	.uleb128 0x12
+	.string	"cmd"
+	.value	0x160
+	.byte	0x18
+	.long	0xde
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1872
+	.value	0x137
+	.long	0x11de
+	.uleb128 0x9
+	.long	.LASF1873
+	.value	0x137
+	.byte	0x33
+	.long	0xcae
+	.uleb128 0x4
+	.long	.LASF1843
+	.value	0x139
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF1844
+	.value	0x13a
+	.byte	0x10
+	.long	0xe4f
+	.uleb128 0x4
+	.long	.LASF1866
+	.value	0x147
+	.byte	0x1f
+	.long	0x874
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1874
+	.byte	0xfc
+	.byte	0xc
+	.long	0x7c
+	.long	0x127c
+	.uleb128 0x17
+	.string	"msp"
+	.byte	0xd
+	.byte	0xfc
+	.byte	0x27
+	.long	0xe4f
+	.uleb128 0xc
+	.long	.LASF1848
+	.byte	0xfc
+	.byte	0x39
+	.long	0x8b8
+	.uleb128 0xc
+	.long	.LASF1799
+	.byte	0xfc
+	.byte	0x4e
+	.long	0x960
+	.uleb128 0xc
+	.long	.LASF1815
+	.byte	0xfc
+	.byte	0x5b
+	.long	0x550
+	.uleb128 0xa
+	.long	.LASF1875
+	.byte	0xff
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF1876
+	.value	0x100
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x12
+	.string	"len"
+	.value	0x101
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x4
+	.long	.LASF1877
+	.value	0x102
+	.byte	0x13
+	.long	0xc8
+	.uleb128 0x12
+	.string	"hdr"
+	.value	0x103
+	.byte	0xd
+	.long	0x127c
+	.uleb128 0x4
+	.long	.LASF1878
+	.value	0x104
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF1798
+	.value	0x117
+	.byte	0xd
+	.long	0xbc
+	.uleb128 0x7
+	.uleb128 0x4
+	.long	.LASF1879
+	.value	0x107
+	.byte	0x18
+	.long	0x128c
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xbc
+	.long	0x128c
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	0x9a1
+	.uleb128 0x1a
+	.long	.LASF1880
+	.byte	0xcd
+	.byte	0xc
+	.long	0x550
+	.long	0x12e8
+	.uleb128 0x17
+	.string	"msp"
+	.byte	0xd
+	.byte	0xcd
+	.byte	0x2c
+	.long	0xe4f
+	.uleb128 0xa
+	.long	.LASF1815
+	.byte	0xcf
+	.byte	0x12
+	.long	0x12e8
+	.uleb128 0xa
+	.long	.LASF1881
+	.byte	0xd0
+	.byte	0xd
+	.long	0x1021
+	.uleb128 0x7
+	.uleb128 0x21
+	.string	"len"
+	.byte	0xd4
+	.byte	0xd
+	.long	0x7c
+	.uleb128 0xa
+	.long	.LASF1851
+	.byte	0xd8
+	.byte	0x18
+	.long	0x345
+	.uleb128 0x7
+	.uleb128 0xa
+	.long	.LASF1882
+	.byte	0xe0
+	.byte	0x17
+	.long	0x83
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xa59
+	.uleb128 0x1a
+	.long	.LASF1883
+	.byte	0xba
+	.byte	0xc
+	.long	0x7c
+	.long	0x1308
+	.uleb128 0xc
+	.long	.LASF1844
+	.byte	0xba
+	.byte	0x3a
+	.long	0xefd
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1884
+	.byte	0x60
+	.byte	0xc
+	.long	0x550
+	.long	0x133a
+	.uleb128 0xc
+	.long	.LASF1844
+	.byte	0x60
+	.byte	0x34
+	.long	0xe4f
+	.uleb128 0x17
+	.string	"c"
+	.byte	0xd
+	.byte	0x60
+	.byte	0x45
+	.long	0xbc
+	.uleb128 0x7
+	.uleb128 0x21
+	.string	"hdr"
+	.byte	0x99
+	.byte	0x22
+	.long	0x133a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x9ad
+	.uleb128 0x1a
+	.long	.LASF1885
+	.byte	0x52
+	.byte	0x10
+	.long	0xbc
+	.long	0x137c
+	.uleb128 0xc
+	.long	.LASF1799
+	.byte	0x52
+	.byte	0x32
+	.long	0x960
+	.uleb128 0xc
+	.long	.LASF1798
+	.byte	0x52
+	.byte	0x43
+	.long	0xbc
+	.uleb128 0xc
+	.long	.LASF1851
+	.byte	0x52
+	.byte	0x5c
+	.long	0x345
+	.uleb128 0x17
+	.string	"len"
+	.byte	0xd
+	.byte	0x52
+	.byte	0x66
+	.long	0x7c
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1886
+	.byte	0x47
+	.long	0x13ac
+	.uleb128 0xc
+	.long	.LASF1887
+	.byte	0x47
+	.byte	0x34
+	.long	0x4f5
+	.uleb128 0x7
+	.uleb128 0xa
+	.long	.LASF1843
+	.byte	0x49
+	.byte	0x12
+	.long	0xbc
+	.uleb128 0x7
+	.uleb128 0xa
+	.long	.LASF1888
+	.byte	0x4a
+	.byte	0x14
+	.long	0xe4f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1889
+	.byte	0x32
+	.long	0x13e5
+	.uleb128 0xa
+	.long	.LASF1843
+	.byte	0x34
+	.byte	0xd
+	.long	0xbc
+	.uleb128 0xa
+	.long	.LASF1890
+	.byte	0x35
+	.byte	0x19
+	.long	0xdc0
+	.uleb128 0x7
+	.uleb128 0xa
+	.long	.LASF1844
+	.byte	0x37
+	.byte	0x14
+	.long	0xe4f
+	.uleb128 0xa
+	.long	.LASF1887
+	.byte	0x3d
+	.byte	0x17
+	.long	0x4f5
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1891
+	.byte	0xd
+	.byte	0x2b
+	.byte	0xd
+	.long	0x1408
+	.uleb128 0xc
+	.long	.LASF1892
+	.byte	0x2b
+	.byte	0x25
+	.long	0xe4f
+	.uleb128 0xc
+	.long	.LASF1887
+	.byte	0x2b
+	.byte	0x43
+	.long	0x4f5
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF1893
+	.byte	0x6
+	.byte	0x25
+	.byte	0x1b
+	.long	0x140
+	.uleb128 0x17
+	.string	"a"
+	.byte	0x6
+	.byte	0x25
+	.byte	0x2e
+	.long	0x14c
+	.uleb128 0x17
+	.string	"b"
+	.byte	0x6
+	.byte	0x25
+	.byte	0x3a
+	.long	0x14c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 17 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 19 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.file 20 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 22 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 23 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 26 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 35 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 36 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x24
+	.file 37 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 38 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 39 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x27
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF966
+	.byte	0x4
+	.file 40 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.file 41 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 42 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 43 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 44 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1378
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xa
+	.file 45 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2d
+	.file 46 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1408
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x4
+	.file 47 "./src/main/msp/msp_protocol.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1594
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF965
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF985
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF989
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF997
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1009
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1377
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1384
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1407
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol.h.59.90a37f358cf6019dfa5d9b9aacc74c56,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.27.07521096acbd1fc23b5da89615487a6f,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1589
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF1898
+	.long	.LASF1899
+	.long	.LASF1900
+	.long	.LASF1901
+	.long	.LASF1902
+	.long	.LASF1903
+	.long	.LASF1904
+	.long	.LASF1905
+	.long	.LASF1906
+	.long	.LASF1907
+	.long	.LASF1908
+	.long	.LASF1909
+	.long	.LASF1910
+	.long	.LASF1911
+	.long	.LASF1912
+	.long	.LASF1913
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x30
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1914
+	.byte	0xc
+	.long	.LASF1915
+	.byte	0xc
+	.long	.LASF1916
+	.byte	0xc
+	.long	.LASF1917
+	.byte	0x10
+	.long	.LASF1918
+	.byte	0x2
+	.long	.LASF1919
+	.byte	0x2
+	.long	.LASF1920
+	.byte	0x4
+	.long	.LASF1921
+	.byte	0x5
+	.long	.LASF1922
+	.byte	0x4
+	.long	.LASF1920
+	.byte	0x6
+	.long	.LASF1923
+	.byte	0x7
+	.long	.LASF1924
+	.byte	0x7
+	.long	.LASF1925
+	.byte	0x7
+	.long	.LASF1926
+	.byte	0x2
+	.long	.LASF1927
+	.byte	0xf
+	.long	.LASF1928
+	.byte	0x4
+	.long	.LASF1929
+	.byte	0xf
+	.long	.LASF1930
+	.byte	0x10
+	.long	.LASF1931
+	.byte	0x10
+	.long	.LASF1931
+	.byte	0xf
+	.long	.LASF1932
+	.byte	0xc
+	.long	.LASF1933
+	.byte	0xf
+	.long	.LASF1934
+	.byte	0xf
+	.long	.LASF1935
+	.byte	0xc
+	.long	.LASF1936
+	.byte	0xc
+	.long	.LASF1937
+	.byte	0xe
+	.long	.LASF1938
+	.byte	0xc
+	.long	.LASF1939
+	.byte	0xd
+	.long	.LASF1940
+	.byte	0xd
+	.long	.LASF1941
+	.byte	0xc
+	.long	.LASF1942
+	.byte	0xc
+	.long	.LASF1943
+	.byte	0xc
+	.long	.LASF1944
+	.byte	0xb
+	.long	.LASF1945
+	.byte	0xb
+	.long	.LASF1946
+	.byte	0xf
+	.long	.LASF1947
+	.byte	0xa
+	.long	.LASF1948
+	.byte	0x9
+	.long	.LASF1949
+	.byte	0x8
+	.long	.LASF1950
+	.byte	0x9
+	.long	.LASF1951
+	.byte	0x2
+	.long	.LASF1952
+	.byte	0x4
+	.long	.LASF1953
+	.byte	0x4
+	.long	.LASF1954
+	.byte	0x4
+	.long	.LASF1955
+	.byte	0x4
+	.long	.LASF1956
+	.byte	0x3
+	.long	.LASF1957
+	.byte	0x1
+	.long	.LASF1958
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1369:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1005:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1088:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF956:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1099:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1031:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1536:
+	.string	"MSP_SCHEDULER_TRACE 135"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1125:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF954:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1689:
+	.string	"rxBufferSize"
+.LASF1828:
+	.string	"dispatchAdd"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_PPM"
+.LASF1143:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1706:
+	.string	"setMode"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1373:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1272:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1829:
+	.string	"sbufSwitchToReader"
+.LASF1380:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1385:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1011:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1600:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1684:
+	.string	"vTable"
+.LASF1612:
+	.string	"uint32_t"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1713:
+	.string	"_Bool"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF980:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF1414:
+	.string	"BASEFLIGHT_IDENTIFIER \"BAFL\";"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF990:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1870:
+	.string	"rateHz"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1626:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1553:
+	.string	"MSP_SET_SERVO_CONFIGURATION 212"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1696:
+	.string	"txBufferTail"
+.LASF1670:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1835:
+	.string	"serialEvaluateNonMspData"
+.LASF1012:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1296:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1242:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1723:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1001:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF1480:
+	.string	"MSP_FAILSAFE_CONFIG 75"
+.LASF1365:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1666:
+	.string	"MODE_TX"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1337:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1075:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1283:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"MSP_SET_RX_MAP 65"
+.LASF1857:
+	.string	"evaluateNonMspData"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1645:
+	.string	"OWNER_FLASH"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1466:
+	.string	"MSP_SET_VOLTAGE_METER_CONFIG 57"
+.LASF1611:
+	.string	"uint16_t"
+.LASF1065:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1375:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1053:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1135:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1304:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF964:
+	.string	"Q12 (1 << 12)"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1524:
+	.string	"MSP_NAV_CONFIG 122"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF1718:
+	.string	"next"
+.LASF1078:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1797:
+	.string	"length"
+.LASF1029:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1072:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF1310:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1185:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1247:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1496:
+	.string	"MSP_SET_ADVANCED_CONFIG 91"
+.LASF1151:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1507:
+	.string	"MSP_RAW_IMU 102"
+.LASF1576:
+	.string	"MSP_GPSSTATISTICS 166"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1556:
+	.string	"MSP_SET_MOTOR_3D_CONFIG 217"
+.LASF1559:
+	.string	"MSP_SET_SENSOR_ALIGNMENT 220"
+.LASF1470:
+	.string	"MSP_ARMING_CONFIG 61"
+.LASF1591:
+	.string	"MSP_STREAM_CHUNK_SIZE 64"
+.LASF1074:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF981:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1221:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1024:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1132:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1628:
+	.string	"OWNER_ADC_RSSI"
+.LASF1328:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1762:
+	.string	"streamLimit"
+.LASF1054:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1188:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1263:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1763:
+	.string	"streamLength"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1800:
+	.string	"mspStream_t"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1364:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1630:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1725:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1445:
+	.string	"MSP_FEATURE_CONFIG 36"
+.LASF1032:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF997:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF978:
+	.string	"BIT(x) (1 << (x))"
+.LASF1655:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1693:
+	.string	"rxBufferHead"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1040:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1609:
+	.string	"int32_t"
+.LASF1879:
+	.string	"hdrV2"
+.LASF1749:
+	.string	"functionMask"
+.LASF1191:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1428:
+	.string	"CAP_NAVI_VERSION_BIT_2 ((uint32_t)1 << 29)"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF952:
+	.string	"FAST_MATH "
+.LASF883:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1708:
+	.string	"beginWrite"
+.LASF1545:
+	.string	"MSP_SET_PID 202"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1350:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF1764:
+	.string	"streamFn"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1286:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1003:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1107:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF1818:
+	.string	"inBuf"
+.LASF1537:
+	.string	"MSP_DATAFLASH_LOG_LIST 136"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1652:
+	.string	"OWNER_BARO_EXTI"
+.LASF1433:
+	.string	"CAP_EXTAUX ((uint32_t)1 << 5)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1864:
+	.string	"outBufHead"
+.LASF1442:
+	.string	"MSP_SET_BATTERY_CONFIG 33"
+.LASF546:
+	.string	"__always_inline"
+.LASF1123:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1716:
+	.string	"dispatch"
+.LASF1665:
+	.string	"MODE_RX"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1409:
+	.string	"MSP_PROTOCOL_VERSION 0"
+.LASF1541:
+	.string	"MSP_SETTING_FIND 140"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1823:
+	.string	"mspPostProcessQueued"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1169:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1629:
+	.string	"OWNER_SERIAL_TX"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF973:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1546:
+	.string	"MSP_SET_RC_TUNING 204"
+.LASF1448:
+	.string	"MSP_SET_BOARD_ALIGNMENT_CONFIG 39"
+.LASF1110:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1822:
+	.string	"mspPostProcessDispatch"
+.LASF1891:
+	.string	"resetMspPort"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1711:
+	.string	"setRxFrameCallback"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1103:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1323:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF994:
+	.string	"IOCFG_AF_OD 0"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1226:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1730:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF1266:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF961:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF1410:
+	.string	"API_VERSION_MAJOR 1"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1417:
+	.string	"INAV_IDENTIFIER \"INAV\""
+.LASF1339:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1653:
+	.string	"OWNER_USB"
+.LASF1413:
+	.string	"MULTIWII_IDENTIFIER \"MWII\";"
+.LASF1071:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1532:
+	.string	"MSP_MOTOR_CONFIG 131"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF402:
+	.string	"false 0"
+.LASF1664:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1801:
+	.string	"mspPushSubscription_s"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1760:
+	.string	"mspPacket_s"
+.LASF1766:
+	.string	"mspPacket_t"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1586:
+	.string	"MSP_PORT_MAX_HEADER_SIZE 8"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1888:
+	.string	"candidateMspPort"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1855:
+	.string	"mspSerialInit"
+.LASF1616:
+	.string	"timeDelta_t"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF1881:
+	.string	"chunk"
+.LASF1248:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1055:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1544:
+	.string	"MSP_SET_RAW_GPS 201"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1634:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1778:
+	.string	"MSP_PAYLOAD_V2"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1289:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1444:
+	.string	"MSP_SET_MODE_RANGE 35"
+.LASF1388:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1622:
+	.string	"OWNER_SERVO"
+.LASF1102:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF881:
+	.string	"ACC "
+.LASF1482:
+	.string	"MSP_RXFAIL_CONFIG 77"
+.LASF1461:
+	.string	"MSP_ADJUSTMENT_RANGES 52"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF803:
+	.string	"USE_PWM "
+.LASF1319:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF1571:
+	.string	"MSP_DEBUG 254"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1792:
+	.string	"mspStream_s"
+.LASF1115:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1387:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1875:
+	.string	"bufLen"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1866:
+	.string	"mspPostProcessFn"
+.LASF1033:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1395:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1830:
+	.string	"crc8_dvb_s2"
+.LASF1403:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1038:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1105:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1601:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1603:
+	.string	"__uint16_t"
+.LASF1490:
+	.string	"MSP_SET_OSD_CONFIG 85"
+.LASF1802:
+	.string	"cmds"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1621:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1122:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1728:
+	.string	"FUNCTION_BLACKBOX"
+.LASF364:
+	.string	"__k8 1"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1649:
+	.string	"OWNER_RX_SPI_CS"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1463:
+	.string	"MSP_CF_SERIAL_CONFIG 54"
+.LASF1155:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1773:
+	.string	"MSP_HEADER_ARROW"
+.LASF1097:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1476:
+	.string	"MSP_REBOOT 68"
+.LASF1010:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1695:
+	.string	"txBufferHead"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1581:
+	.string	"MSP_SET_4WAY_IF 245"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1686:
+	.string	"mode"
+.LASF1771:
+	.string	"MSP_HEADER_START"
+.LASF1041:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1332:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1550:
+	.string	"MSP_SET_WP 209"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1498:
+	.string	"MSP_SET_FILTER_CONFIG 93"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF950:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1384:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1623:
+	.string	"OWNER_LED"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1513:
+	.string	"MSP_ATTITUDE 108"
+.LASF1868:
+	.string	"mspSerialProcessCommand"
+.LASF1158:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF971:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1163:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1877:
+	.string	"direction"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1724:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1595:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1436:
+	.string	"MSP_FC_VERSION 3"
+.LASF1522:
+	.string	"MSP_SERVO_CONFIGURATIONS 120"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1440:
+	.string	"MSP_SET_NAME 11"
+.LASF989:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1502:
+	.string	"MSP_SET_SENSOR_CONFIG 97"
+.LASF1292:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1352:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1223:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1451:
+	.string	"MSP_MIXER_CONFIG 42"
+.LASF1238:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1717:
+	.string	"delayedUntil"
+.LASF1614:
+	.string	"float"
+.LASF1549:
+	.string	"MSP_RESET_CONF 208"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1501:
+	.string	"MSP_SENSOR_CONFIG 96"
+.LASF1393:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1329:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1311:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1127:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1707:
+	.string	"writeBuf"
+.LASF879:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1625:
+	.string	"OWNER_ADC_BATT"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1733:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1172:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF1515:
+	.string	"MSP_ANALOG 110"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1079:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF1379:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1837:
+	.string	"closeSerialPort"
+.LASF1709:
+	.string	"endWrite"
+.LASF1720:
+	.string	"FUNCTION_NONE"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1568:
+	.string	"MSP_RESERVE_1 251"
+.LASF1460:
+	.string	"MSP_SET_RSSI_CONFIG 51"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1084:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1810:
+	.string	"dataSize"
+.LASF1896:
+	.string	"dispatchEnable"
+.LASF1002:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1661:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1314:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1885:
+	.string	"mspSerialChecksumBuf"
+.LASF1415:
+	.string	"BETAFLIGHT_IDENTIFIER \"BTFL\""
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1145:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1150:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1521:
+	.string	"MSP_BOXIDS 119"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1239:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1218:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1488:
+	.string	"MSP_SET_TRANSPONDER_CONFIG 83"
+.LASF1643:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1558:
+	.string	"MSP_SET_RESET_CURR_PID 219"
+.LASF1335:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1281:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1124:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1734:
+	.string	"serialPortFunction_e"
+.LASF1200:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1116:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1446:
+	.string	"MSP_SET_FEATURE_CONFIG 37"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1833:
+	.string	"serialTxBytesFree"
+.LASF1034:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1046:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF1086:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1531:
+	.string	"MSP_BATTERY_STATE 130"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1816:
+	.string	"postProcessFn"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1422:
+	.string	"BOARD_IDENTIFIER_LENGTH 4"
+.LASF1704:
+	.string	"serialSetBaudRate"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1229:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1703:
+	.string	"serialRead"
+.LASF1355:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1284:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF1697:
+	.string	"rxCallback"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1367:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1848:
+	.string	"packet"
+.LASF1510:
+	.string	"MSP_RC 105"
+.LASF1751:
+	.string	"gps_baudrateIndex"
+.LASF1516:
+	.string	"MSP_RC_TUNING 111"
+.LASF1021:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1791:
+	.string	"mspEvaluateNonMspData_e"
+.LASF1525:
+	.string	"MSP_MOTOR_3D_CONFIG 124"
+.LASF1326:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1089:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1691:
+	.string	"rxBuffer"
+.LASF1479:
+	.string	"MSP_DATAFLASH_ERASE 72"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1690:
+	.string	"txBufferSize"
+.LASF1674:
+	.string	"SERIAL_PARITY_NO"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1432:
+	.string	"CAP_NAVCAP ((uint32_t)1 << 4)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1120:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1654:
+	.string	"OWNER_USB_DETECT"
+.LASF1206:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF992:
+	.string	"IOCFG_OUT_OD 0"
+.LASF987:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1787:
+	.string	"size"
+.LASF1807:
+	.string	"mspPushSubscription_t"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1548:
+	.string	"MSP_MAG_CALIBRATION 206"
+.LASF1453:
+	.string	"MSP_RX_CONFIG 44"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1808:
+	.string	"mspPort_s"
+.LASF1819:
+	.string	"mspPort_t"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1175:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1776:
+	.string	"MSP_HEADER_X"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1421:
+	.string	"FLIGHT_CONTROLLER_VERSION_MASK 0xFFF"
+.LASF1777:
+	.string	"MSP_HEADER_V2"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF1863:
+	.string	"reply"
+.LASF1044:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1658:
+	.string	"OWNER_INVERTER"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF1613:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1184:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1638:
+	.string	"OWNER_SPI_MOSI"
+.LASF1338:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1806:
+	.string	"skipped"
+.LASF1685:
+	.string	"identifier"
+.LASF1610:
+	.string	"uint8_t"
+.LASF1083:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1458:
+	.string	"MSP_SET_LED_STRIP_CONFIG 49"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1420:
+	.string	"FLIGHT_CONTROLLER_VERSION_LENGTH 3"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF951:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1593:
+	.string	"CHECKSUM_STARTPOS 3"
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF1187:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF975:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1569:
+	.string	"MSP_RESERVE_2 252"
+.LASF1202:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1872:
+	.string	"mspSerialPostProcess"
+.LASF1427:
+	.string	"CAP_NAVI_VERSION_BIT_3 ((uint32_t)1 << 30)"
+.LASF953:
+	.string	"VERY_FAST_MATH "
+.LASF1361:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1781:
+	.string	"mspState_e"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF988:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF1391:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF1812:
+	.string	"cmdFlags"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1589:
+	.string	"MSP_PUSH_MAX_RATE_HZ 200"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1572:
+	.string	"MSP_RESERVE_3 255"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1493:
+	.string	"MSP_VTX_CONFIG 88"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1277:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1196:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1082:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1883:
+	.string	"mspSerialFrameBytesRemaining"
+.LASF1852:
+	.string	"datalen"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1737:
+	.string	"SERIAL_PORT_USART2"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF1850:
+	.string	"mspSerialPush"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1397:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF822:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1890:
+	.string	"portConfig"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1004:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1784:
+	.string	"mspVersion_e"
+.LASF1739:
+	.string	"SERIAL_PORT_UART4"
+.LASF1740:
+	.string	"SERIAL_PORT_UART5"
+.LASF1681:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF1865:
+	.string	"command"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1506:
+	.string	"MSP_STATUS 101"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF977:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1106:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF1294:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1035:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1134:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF1370:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1459:
+	.string	"MSP_RSSI_CONFIG 50"
+.LASF1527:
+	.string	"MSP_SENSOR_ALIGNMENT 126"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1431:
+	.string	"CAP_FLAPS ((uint32_t)1 << 3)"
+.LASF1406:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1396:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1050:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1073:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF1492:
+	.string	"MSP_OSD_CHAR_WRITE 87"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1119:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF1508:
+	.string	"MSP_SERVO 103"
+.LASF1287:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1505:
+	.string	"MSP_DISPLAYPORT 182"
+.LASF1233:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF1268:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1250:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1570:
+	.string	"MSP_DEBUGMSG 253"
+.LASF1511:
+	.string	"MSP_RAW_GPS 106"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1547:
+	.string	"MSP_ACC_CALIBRATION 205"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1313:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1069:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1845:
+	.string	"bytesFree"
+.LASF1454:
+	.string	"MSP_SET_RX_CONFIG 45"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1179:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1519:
+	.string	"MSP_PIDNAMES 117"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF1008:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1590:
+	.string	"MSP_SERIAL_RX_CHUNK_SIZE 64"
+.LASF1884:
+	.string	"mspSerialProcessReceivedData"
+.LASF1484:
+	.string	"MSP_SDCARD_SUMMARY 79"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1331:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1316:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1633:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1731:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF965:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1307:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1564:
+	.string	"MSP_DATAFLASH_LOG_ERASE 225"
+.LASF1253:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1157:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1726:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1056:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF996:
+	.string	"IOCFG_IPU 0"
+.LASF1540:
+	.string	"MSP_SETTING_VALUES 139"
+.LASF1477:
+	.string	"MSP_DATAFLASH_SUMMARY 70"
+.LASF1842:
+	.string	"mspSerialTxBytesFree"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1199:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1178:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF1780:
+	.string	"MSP_COMMAND_RECEIVED"
+.LASF1635:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1878:
+	.string	"hdrLen"
+.LASF1514:
+	.string	"MSP_ALTITUDE 109"
+.LASF1394:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF499:
+	.string	"__PMT"
+.LASF1752:
+	.string	"blackbox_baudrateIndex"
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1426:
+	.string	"CAP_NAVI_VERSION_BIT_4_MSB ((uint32_t)1 << 31)"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1753:
+	.string	"telemetry_baudrateIndex"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF967:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1006:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1205:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1443:
+	.string	"MSP_MODE_RANGES 34"
+.LASF1721:
+	.string	"FUNCTION_MSP"
+.LASF1618:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1485:
+	.string	"MSP_BLACKBOX_CONFIG 80"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1170:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1504:
+	.string	"MSP_SET_OSD_VIDEO_CONFIG 181"
+.LASF1538:
+	.string	"MSP_DATAFLASH_LOG_READ 137"
+.LASF1081:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1859:
+	.string	"startTimeUs"
+.LASF1211:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1045:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1588:
+	.string	"MSP_PUSH_MAX_COMMANDS 8"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1052:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1489:
+	.string	"MSP_OSD_CONFIG 84"
+.LASF1154:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1236:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1424:
+	.string	"CAP_PLATFORM_32BIT ((uint32_t)1 << 31)"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1015:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1215:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1894:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1392:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1048:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1838:
+	.string	"memset"
+.LASF1036:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1416:
+	.string	"CLEANFLIGHT_IDENTIFIER \"CLFL\""
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1182:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1014:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1452:
+	.string	"MSP_SET_MIXER_CONFIG 43"
+.LASF1761:
+	.string	"result"
+.LASF1325:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1817:
+	.string	"push"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1533:
+	.string	"MSP_GPS_CONFIG 132"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1497:
+	.string	"MSP_FILTER_CONFIG 92"
+.LASF1098:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1256:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1430:
+	.string	"CAP_DYNBALANCE ((uint32_t)1 << 2)"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1809:
+	.string	"port"
+.LASF1450:
+	.string	"MSP_SET_CURRENT_METER_CONFIG 41"
+.LASF1298:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1811:
+	.string	"cmdMSP"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1847:
+	.string	"mspPushCommandFn"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF802:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1027:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1667:
+	.string	"MODE_RXTX"
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1758:
+	.string	"mspResult_e"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1136:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1412:
+	.string	"API_VERSION_LENGTH 2"
+.LASF1101:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1062:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1824:
+	.string	"sbufPtr"
+.LASF1486:
+	.string	"MSP_SET_BLACKBOX_CONFIG 81"
+.LASF1775:
+	.string	"MSP_HEADER_CMD"
+.LASF1702:
+	.string	"serialTotalTxFree"
+.LASF960:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF1112:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF968:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1779:
+	.string	"MSP_CHECKSUM_V2"
+.LASF1641:
+	.string	"OWNER_SDCARD"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF1117:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1813:
+	.string	"mspVersion"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1356:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1608:
+	.string	"int16_t"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1419:
+	.string	"FLIGHT_CONTROLLER_IDENTIFIER_LENGTH 4"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1203:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1596:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1599:
+	.string	"signed char"
+.LASF1386:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1104:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1578:
+	.string	"MSP_SET_ACC_TRIM 239"
+.LASF1768:
+	.string	"mspProcessCommandFnPtr"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF1434:
+	.string	"MSP_API_VERSION 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1481:
+	.string	"MSP_SET_FAILSAFE_CONFIG 76"
+.LASF1067:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1353:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1528:
+	.string	"MSP_LED_STRIP_MODECOLOR 127"
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF1177:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1671:
+	.string	"SERIAL_INVERTED"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF949:
+	.string	"sq(x) ((x)*(x))"
+.LASF1867:
+	.string	"status"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1552:
+	.string	"MSP_SET_HEADING 211"
+.LASF1803:
+	.string	"count"
+.LASF1886:
+	.string	"mspSerialReleasePortIfAllocated"
+.LASF1262:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1181:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1579:
+	.string	"MSP_SERVO_MIX_RULES 241"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF1080:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1280:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1013:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1018:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1745:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1746:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF396:
+	.string	"__REVISION__ \"669c324\""
+.LASF1491:
+	.string	"MSP_OSD_CHAR_READ 86"
+.LASF1563:
+	.string	"MSP_SET_COMPASS_CONFIG 224"
+.LASF1259:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1663:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1093:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1727:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF1840:
+	.string	"openSerialPort"
+.LASF1656:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1435:
+	.string	"MSP_FC_VARIANT 2"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1271:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1061:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1320:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1534:
+	.string	"MSP_COMPASS_CONFIG 133"
+.LASF1769:
+	.string	"mspPushCommandFnPtr"
+.LASF1487:
+	.string	"MSP_TRANSPONDER_CONFIG 82"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF986:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1495:
+	.string	"MSP_ADVANCED_CONFIG 90"
+.LASF1022:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1059:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1096:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1037:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF983:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1772:
+	.string	"MSP_HEADER_M"
+.LASF1166:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1389:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1474:
+	.string	"MSP_BF_CONFIG 66"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1887:
+	.string	"serialPort"
+.LASF1677:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1214:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1401:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1028:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1146:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1744:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF929:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1478:
+	.string	"MSP_DATAFLASH_READ 71"
+.LASF1402:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF821:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1827:
+	.string	"sbufWriteData"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1736:
+	.string	"SERIAL_PORT_USART1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1738:
+	.string	"SERIAL_PORT_USART3"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1070:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1741:
+	.string	"SERIAL_PORT_USART6"
+.LASF1742:
+	.string	"SERIAL_PORT_USART7"
+.LASF1743:
+	.string	"SERIAL_PORT_USART8"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1701:
+	.string	"serialTotalRxWaiting"
+.LASF1407:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1009:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1302:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1606:
+	.string	"long int"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1131:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1232:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1836:
+	.string	"serialReadBuf"
+.LASF962:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1149:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1631:
+	.string	"OWNER_PINDEBUG"
+.LASF1076:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1846:
+	.string	"currentTimeUs"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1343:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1582:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1176:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1795:
+	.string	"context"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF974:
+	.string	"EXPAND_I(x) x"
+.LASF1152:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1109:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF957:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1694:
+	.string	"rxBufferTail"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1580:
+	.string	"MSP_SET_SERVO_MIX_RULE 242"
+.LASF1790:
+	.string	"MSP_SKIP_NON_MSP_DATA"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1832:
+	.string	"serialWriteBuf"
+.LASF1457:
+	.string	"MSP_LED_STRIP_CONFIG 48"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1893:
+	.string	"cmpTimeUs"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1705:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF958:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF1523:
+	.string	"MSP_NAV_STATUS 121"
+.LASF522:
+	.string	"__flexarr []"
+.LASF813:
+	.string	"LED_STRIP "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1831:
+	.string	"serialEndWrite"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1462:
+	.string	"MSP_SET_ADJUSTMENT_RANGE 53"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1383:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1404:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1512:
+	.string	"MSP_COMP_GPS 107"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1092:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1141:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1382:
+	.string	"UNIT_TESTED "
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1167:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1632:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1880:
+	.string	"mspSerialStreamReply"
+.LASF1275:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1305:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1251:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF1019:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1594:
+	.string	"MSP_POST_PROCESS_POLL_US 1000"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1607:
+	.string	"char"
+.LASF1861:
+	.string	"mspSerialCanProcessCommand"
+.LASF1148:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1565:
+	.string	"MSP_SET_SETTING_VALUES 226"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1085:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1715:
+	.string	"dispatchEntry_s"
+.LASF1719:
+	.string	"dispatchEntry_t"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1212:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1060:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1735:
+	.string	"SERIAL_PORT_NONE"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1843:
+	.string	"portIndex"
+.LASF1220:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF970:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1194:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF898:
+	.string	"USE_PWM"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1471:
+	.string	"MSP_SET_ARMING_CONFIG 62"
+.LASF1456:
+	.string	"MSP_SET_LED_COLORS 47"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1368:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF966:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1755:
+	.string	"MSP_RESULT_ACK"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF1889:
+	.string	"mspSerialAllocatePorts"
+.LASF1675:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1063:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1844:
+	.string	"mspPort"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1197:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF1376:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1644:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF1562:
+	.string	"MSP_SET_GPS_CONFIG 223"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF972:
+	.string	"STR_HELPER(x) #x"
+.LASF1873:
+	.string	"self"
+.LASF1585:
+	.string	"MSP_PORT_STREAM_LIMIT 0xffff"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1583:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF1636:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1113:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF401:
+	.string	"true 1"
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1091:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1129:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1066:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1826:
+	.string	"sbufBytesRemaining"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF1561:
+	.string	"MSP_SET_MOTOR_CONFIG 222"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1503:
+	.string	"MSP_OSD_VIDEO_CONFIG 180"
+.LASF1254:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1217:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1411:
+	.string	"API_VERSION_MINOR 33"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1500:
+	.string	"MSP_SET_PID_ADVANCED 95"
+.LASF1133:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1418:
+	.string	"RACEFLIGHT_IDENTIFIER \"RCFL\""
+.LASF1575:
+	.string	"MSP_GPSSVINFO 164"
+.LASF1765:
+	.string	"streamContext"
+.LASF1748:
+	.string	"serialPortConfig_s"
+.LASF1754:
+	.string	"serialPortConfig_t"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1349:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1295:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1371:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1854:
+	.string	"mspSerialPushSubscriptions"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1077:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1820:
+	.string	"mspPorts"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1874:
+	.string	"mspSerialEncode"
+.LASF1398:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1782:
+	.string	"MSP_V1"
+.LASF1783:
+	.string	"MSP_V2"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1399:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1554:
+	.string	"MSP_SET_MOTOR 214"
+.LASF1265:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1121:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1520:
+	.string	"MSP_WP 118"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1639:
+	.string	"OWNER_I2C_SCL"
+.LASF1637:
+	.string	"OWNER_SPI_MISO"
+.LASF1026:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1640:
+	.string	"OWNER_I2C_SDA"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1662:
+	.string	"OWNER_COMPASS_CS"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF982:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1049:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1299:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1551:
+	.string	"MSP_SELECT_SETTING 210"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1405:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1130:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1577:
+	.string	"MSP_ACC_TRIM 240"
+.LASF1340:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1804:
+	.string	"periodUs"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1455:
+	.string	"MSP_LED_COLORS 46"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1317:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1604:
+	.string	"__int32_t"
+.LASF1676:
+	.string	"SERIAL_UNIDIR"
+.LASF1605:
+	.string	"__uint32_t"
+.LASF1814:
+	.string	"c_state"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1108:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1851:
+	.string	"data"
+.LASF1278:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1882:
+	.string	"produced"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1441:
+	.string	"MSP_BATTERY_CONFIG 32"
+.LASF1895:
+	.string	"baudRates"
+.LASF801:
+	.string	"USE_CLI "
+.LASF1190:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1068:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1468:
+	.string	"MSP_PID_CONTROLLER 59"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF1688:
+	.string	"baudRate"
+.LASF1358:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF1555:
+	.string	"MSP_SET_NAV_CONFIG 215"
+.LASF1839:
+	.string	"findNextSerialPortConfig"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1747:
+	.string	"serialPortIdentifier_e"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF995:
+	.string	"IOCFG_IPD 0"
+.LASF1423:
+	.string	"BOARD_HARDWARE_REVISION_LENGTH 2"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1475:
+	.string	"MSP_SET_BF_CONFIG 67"
+.LASF1257:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1750:
+	.string	"msp_baudrateIndex"
+.LASF1530:
+	.string	"MSP_CURRENT_METERS 129"
+.LASF1692:
+	.string	"txBuffer"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF1288:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1269:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1509:
+	.string	"MSP_MOTOR 104"
+.LASF1821:
+	.string	"outBuf"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1111:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF1007:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1025:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1374:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1043:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1128:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1244:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1557:
+	.string	"MSP_SET_RC_DEADBAND 218"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1359:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1447:
+	.string	"MSP_BOARD_ALIGNMENT_CONFIG 38"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1560:
+	.string	"MSP_SET_LED_STRIP_MODECOLOR 221"
+.LASF1087:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1381:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1161:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1227:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1437:
+	.string	"MSP_BOARD_INFO 4"
+.LASF1657:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF1439:
+	.string	"MSP_NAME 10"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1660:
+	.string	"OWNER_TRANSPONDER"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1114:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF1235:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1699:
+	.string	"serialPortVTable"
+.LASF1518:
+	.string	"MSP_BOXNAMES 116"
+.LASF1173:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1449:
+	.string	"MSP_CURRENT_METER_CONFIG 40"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1672:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1722:
+	.string	"FUNCTION_GPS"
+.LASF1673:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1494:
+	.string	"MSP_SET_VTX_CONFIG 89"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1668:
+	.string	"portMode_t"
+.LASF1030:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF979:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1617:
+	.string	"timeUs_t"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1796:
+	.string	"offset"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1825:
+	.string	"sbufReadU16"
+.LASF1160:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1729:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1756:
+	.string	"MSP_RESULT_ERROR"
+.LASF1650:
+	.string	"OWNER_SPI_CS"
+.LASF998:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1682:
+	.string	"sbuf_s"
+.LASF1615:
+	.string	"sbuf_t"
+.LASF1064:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1322:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF885:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1260:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF984:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF1584:
+	.string	"MSP_PORT_OUTBUF_SIZE 256"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1680:
+	.string	"serialReceiveCallbackPtr"
+.LASF1341:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1862:
+	.string	"mspSerialOutBufInUse"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1798:
+	.string	"checksum"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF959:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1788:
+	.string	"mspHeaderV2_t"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF985:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1834:
+	.string	"serialBeginWrite"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1526:
+	.string	"MSP_RC_DEADBAND 125"
+.LASF1678:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1794:
+	.string	"bufLength"
+.LASF1574:
+	.string	"MSP_UID 160"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF1164:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1193:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1871:
+	.string	"mspSerialProcessReceivedCommand"
+.LASF1710:
+	.string	"readBuf"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1039:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1301:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1058:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1683:
+	.string	"serialPort_s"
+.LASF1712:
+	.string	"serialPort_t"
+.LASF1619:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1858:
+	.string	"mspProcessCommandFn"
+.LASF1142:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1767:
+	.string	"mspPostProcessFnPtr"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1542:
+	.string	"MSP_MOTOR_TELEMETRY 141"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1224:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1679:
+	.string	"SERIAL_BIDIR_PP"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1805:
+	.string	"nextPushAt"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF1567:
+	.string	"MSP_EEPROM_WRITE 250"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1042:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF976:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1464:
+	.string	"MSP_SET_CF_SERIAL_CONFIG 55"
+.LASF1362:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1016:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1841:
+	.string	"findSerialPortConfig"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1346:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1118:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1159:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF991:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1425:
+	.string	"CAP_BASEFLIGHT_CONFIG ((uint32_t)1 << 30)"
+.LASF1669:
+	.string	"portOptions_t"
+.LASF1642:
+	.string	"OWNER_SDCARD_CS"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1856:
+	.string	"mspSerialProcess"
+.LASF1543:
+	.string	"MSP_SET_RAW_RC 200"
+.LASF1057:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF963:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1023:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1209:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1467:
+	.string	"MSP_SONAR_ALTITUDE 58"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1757:
+	.string	"MSP_RESULT_NO_REPLY"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF1020:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1465:
+	.string	"MSP_VOLTAGE_METER_CONFIG 56"
+.LASF1344:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1290:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1869:
+	.string	"mspSerialSubscribe"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1139:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1698:
+	.string	"rxFrameCallback"
+.LASF1095:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF993:
+	.string	"IOCFG_AF_PP 0"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1241:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1732:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1126:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF1499:
+	.string	"MSP_PID_ADVANCED 94"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1598:
+	.string	"long unsigned int"
+.LASF999:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1659:
+	.string	"OWNER_LED_STRIP"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF888:
+	.string	"USE_UART2 "
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1539:
+	.string	"MSP_SETTING_INFO 138"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1587:
+	.string	"MSP_SERIAL_PROCESS_TIME_US 250"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1274:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1438:
+	.string	"MSP_BUILD_INFO 5"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1566:
+	.string	"MSP_SET_PUSH_SUBSCRIPTION 227"
+.LASF1770:
+	.string	"MSP_IDLE"
+.LASF1592:
+	.string	"JUMBO_FRAME_SIZE_LIMIT 255"
+.LASF1700:
+	.string	"serialWrite"
+.LASF1469:
+	.string	"MSP_SET_PID_CONTROLLER 60"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1390:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF1472:
+	.string	"MSP_RX_MAP 64"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1849:
+	.string	"mspSerialPushPeriod"
+.LASF1714:
+	.string	"dispatchFunc"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1774:
+	.string	"MSP_HEADER_SIZE"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1017:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1785:
+	.string	"mspHeaderV2_s"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1000:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1799:
+	.string	"version"
+.LASF1646:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1860:
+	.string	"consumed"
+.LASF1100:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF955:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1647:
+	.string	"OWNER_MPU_CS"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1483:
+	.string	"MSP_SET_RXFAIL_CONFIG 78"
+.LASF1597:
+	.string	"unsigned int"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF1208:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1429:
+	.string	"CAP_NAVI_VERSION_BIT_1_LSB ((uint32_t)1 << 28)"
+.LASF1853:
+	.string	"pushBuf"
+.LASF1789:
+	.string	"MSP_EVALUATE_NON_MSP_DATA"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF1815:
+	.string	"stream"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF969:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1308:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1094:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1759:
+	.string	"mspStreamFnPtr"
+.LASF1245:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1624:
+	.string	"OWNER_ADC"
+.LASF1602:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1651:
+	.string	"OWNER_MPU_EXTI"
+.LASF1793:
+	.string	"pending"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1378:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1137:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1347:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1293:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1535:
+	.string	"MSP_TASK_HISTOGRAM 134"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1408:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1627:
+	.string	"OWNER_ADC_EXT"
+.LASF1047:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1090:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1620:
+	.string	"OWNER_PPMINPUT"
+.LASF1897:
+	.string	"micros"
+.LASF1687:
+	.string	"options"
+.LASF1051:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1648:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1334:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1876:
+	.string	"streamLen"
+.LASF1400:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1517:
+	.string	"MSP_PID 112"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1786:
+	.string	"flags"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1892:
+	.string	"mspPortToReset"
+.LASF1573:
+	.string	"MSP_STATUS_EX 150"
+.LASF1529:
+	.string	"MSP_VOLTAGE_METERS 128"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1377:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1140:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1918:
+	.string	"streambuf.h"
+.LASF1938:
+	.string	"long-double.h"
+.LASF1945:
+	.string	"__locale_t.h"
+.LASF1947:
+	.string	"platform.h"
+.LASF1901:
+	.string	"src/main/drivers"
+.LASF1932:
+	.string	"libc-header-start.h"
+.LASF1911:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1915:
+	.string	"stdint-intn.h"
+.LASF1949:
+	.string	"target.h"
+.LASF1910:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1913:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1939:
+	.string	"stubs.h"
+.LASF1925:
+	.string	"msp_serial.c"
+.LASF1952:
+	.string	"io.h"
+.LASF1905:
+	.string	"src/main/target/SITL"
+.LASF1924:
+	.string	"msp_serial.h"
+.LASF1903:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1955:
+	.string	"io_def_generated.h"
+.LASF1904:
+	.string	"src/main/msp"
+.LASF1946:
+	.string	"strings.h"
+.LASF1934:
+	.string	"features-time64.h"
+.LASF1914:
+	.string	"types.h"
+.LASF1909:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1921:
+	.string	"fc_dispatch.h"
+.LASF1928:
+	.string	"system.h"
+.LASF1936:
+	.string	"timesize.h"
+.LASF1930:
+	.string	"stdbool.h"
+.LASF1912:
+	.string	"/usr/include"
+.LASF1898:
+	.string	"src/main/build"
+.LASF1933:
+	.string	"features.h"
+.LASF1948:
+	.string	"common.h"
+.LASF1941:
+	.string	"typesizes.h"
+.LASF1899:
+	.string	"src/main/common"
+.LASF1920:
+	.string	"serial.h"
+.LASF1900:
+	.string	"src/main/config"
+.LASF1942:
+	.string	"time64.h"
+.LASF1916:
+	.string	"stdint-uintn.h"
+.LASF1906:
+	.string	"src/main/target"
+.LASF1951:
+	.string	"utils.h"
+.LASF1907:
+	.string	"src/main"
+.LASF1922:
+	.string	"resource.h"
+.LASF1919:
+	.string	"time.h"
+.LASF1953:
+	.string	"io_types.h"
+.LASF1943:
+	.string	"wchar.h"
+.LASF1954:
+	.string	"io_def.h"
+.LASF1902:
+	.string	"src/main/fc"
+.LASF0:
+	.string	"./src/main/msp/msp_serial.c"
+.LASF1908:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1926:
+	.string	"maths.h"
+.LASF1923:
+	.string	"msp.h"
+.LASF1927:
+	.string	"string.h"
+.LASF1937:
+	.string	"cdefs.h"
+.LASF1944:
+	.string	"locale_t.h"
+.LASF1931:
+	.string	"stdint.h"
+.LASF1957:
+	.string	"build_config.h"
+.LASF1917:
+	.string	"stddef.h"
+.LASF1940:
+	.string	"stubs-64.h"
+.LASF1958:
+	.string	"msp_protocol.h"
+.LASF1935:
+	.string	"wordsize.h"
+.LASF1950:
+	.string	"common_post.h"
+.LASF1956:
+	.string	"parameter_group.h"
+.LASF1929:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	"\b"
+	.string	"\017"
+	.string	"\030"
+	.text
+	.section	.gnu.lto_.icf.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\\\003\275\017"
+	.string	"V\324I=\020Q\234\306cD\033\253\371\036\336\244\t\365\233)M\256U\003\265\241\307\3757\007oh\246\213_\251"
+	.string	"\212"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\252\252F\025\240H~\362\037\375\357&\222\221\266\273\211\354\315m\331H4"
+	.string	":"
+	.string	"6"
+	.ascii	"\330\362\271\334\222\253|\347\250P\007\016\236\207^\357\265\356"
+	.ascii	"j\245\272\253V\274\032\301zF\204\340|1\210\300b\002\005\247~"
+	.ascii	"L\375\324\323\023\273\200:\241\2112AK\232\032\0242\353\355M\272"
+	.ascii	"m\275\275\333\330\333\035\267\255\361\307\006t\301\fR\013\325"
+	.ascii	"\326~r<@\001\302\252\206\023\302H\205\202H\255Cx\341\205\003"
+	.ascii	"\023U6$\2736\"\322\007\312\003W\336k~\350\\2Z<\3065\225a\243"
+	.ascii	"\003\004\2316\003\211\030\234\f\233\362\247D\235\374\375]`Vh"
+	.ascii	"\220"
+	.string	")]\273\330\331\330\361\216;>\275\222u\217\034\271\263\\\001\023\224\022J\030\022P>\210\204Q\036\250F\035\"\315D-\2140\033>\311\367G\340\375\264]\241\271\201\211\fX\300\257\213\022\">^\364\274\327\313<\300\240\301\321=7\032N\244\340*\007\030\300Xz\250\361\305\240$\030\n\322J\2411\220\202*#\326\001\0210\271\222\022\211[\230\003*\336,^\321\234p\362\300K\026\333}\003\216I\307:\361\366e\270`rD\\\266\3046\301]\013P\037\036\004\027\374\361\213E\304\251\017\360\005\013\267\177muS\317\225<\316,\225\303}\264\017\f6)\342\333\243\023\335\021\305=\266\005s\016\007X\177O#\216\276|\020N\310\005\232n\207\201\366\274\223\177\370\336\2735\026\256?\341\232\271\301\243\276\307\275\"\001_\366D\3519\3378\362\005\031R\t\242\236\337Kn\\P\236\326rRw\2774\r\217/\370y\233K"
+	.ascii	"\233\310\223\262[[\247\360\364z\302oc\356o\033\247\346y!\300"
+	.ascii	"\177Rx\033\277\224\342C\031"
+	.text
+	.section	.gnu.lto_.ipa_sra.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`$\001e\007"
+	.string	"2\312\031\033pK\222\016\300"
+	.string	""
+	.string	""
+	.string	"AU\325\037\350\224\301"
+	.string	"\271&#\302f\211%do\231R*y\340A\032|\321T\260\n\235\004\017\350Y\027H|\200J\366\215u+\241/\351\306T\312\271\016\262\205B\245\3163\2361S\330&\323z\240\265\032\236\244\214\002X\016\257\204\360\020\355\251t\303\260%\354\027\016a\033i\213\321*\334\021; `\202A\223\326\003\345\002$\022"
+	.ascii	"hU.\026\2537h)\0167w\244\002\220\207L\003\272\344=C\200\346\002"
+	.ascii	"H\022D7\276r\266\226D H\023_\204\033\321\n\340%cD\003\333%\220"
+	.ascii	" \005=\017\267 B}\004\307\367\266\006Fdk\013\021F\335\273\320"
+	.ascii	"F\025\322\342\306\006\034\202\207$\n\215{\314\365\350\345t\253"
+	.ascii	"a\266\362\026\311k\330\205\327\375>\240Z\213\"\271x\330\016\""
+	.ascii	"\251\273bpE\031\002"
+	.text
+	.section	.gnu.lto_.inline.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\261\016\r6"
+	.string	"\372F\370\016E\200\336I:R\300\036 ~\311\217F\316\231\371\223=2\305\332\240\313\023\017\221\206)\307@E5\371J\365?\223\252DS#\267\034\333z\226s\024\313\222\344\264)qk\237g\250\306\004\3336\376\337\215\220\275\223L\001\316"
+	.string	"\337"
+	.string	"\326"
+	.string	"Q\360\334\224*\035\2017I\306\305\305\331\321`\240\364P\007i\242\2374\321\327\023\276=\\\350\226\334\023\226\3252n\224\226\350\315\262C?\261(\326\336"
+	.string	"%\226\346\r\333\241C\255\3552\260\365\035E\225\365\335\2048\3457jk\3649\302Fe\215C\177\332\235\262\276C\331;\324\032}\177r\203\2511,&\273\302wQp\255\223\264g\332[\272\r39q=\277w$\247\350L\241\262\246I\022\211\027\325\026\321\247[}*\342^\340\320\024Y\377\254\364a\255U\364\177>\322k\255u}_\351\243\255\242\326*e\367\330\322\275/\204\357\203\357JY!\221k\024:\324~\255\204?\331\257\322\033\325d\224p(\347\274L\322I\036\2670\0066\220\177\216\004Sl\027n/\211\233\211\371aU\301\262(\350\242\340\355"
+	.ascii	"\323\266'\317\376\344\001\247g\322t\257\206\220g@\222T\335\336"
+	.ascii	"\355\022\256\325\373W[I\204k\332\373\325#\t6\026&\316\374\371"
+	.ascii	"\364\3673\375\001%\026\032\226\026\321^\032\342h\215\326q\306"
+	.ascii	"W\340\321\260\320\252\346\231h:\301nL\r\001Pjt)\265\257z\377"
+	.ascii	"H\330\216\004\245g\005\361<P\334\324\375U\341\001\023\316I'\354"
+	.ascii	"\316\224\203\331\244\206W\360\207R#\211\344mM\365i\323\3626\034"
+	.ascii	"\035B\212\265\275\tE\336\331\004!3\334\256z\033}\353\nN\035M"
+	.ascii	"\177"
+	.string	"\265\326\017\322\355\212k\270\275\253yS\205m\322Z\353\221\264\302\004\355\fx\037S\272\b\347.\250\"$\030*P|\320Q\004\235\223\316\n|\026\330\230\331\370\323Y\217.\245\026\225\r\017\233\t\376yI\032\331\"\244\3013\217\267$\225\274-a\221\300nz\23663\206\034zl[\370~\273\254\205?\335\376F\031\031-\034\352b\226\230\226\351\364\364L{\201\350\256w'\332I\232\021\322\301\261\300.!\311\326\272~t\030\277v`B^\3111\325\303j\036\322\244\327\351t2^\276\204\370T\370~\265\254\3460\3219\007d#\271\220@\256u\317K\257\252\265\n\360{-\202\"|i\356\311\242\227\351pXh[\002<\332J\323\224\372HH\271\240\240\357\222\314YtQ\320&\220\233\376\364\347\221\034c%mx\363xu\264\275#[\n\207\272\267\312m\333\250\253\221\302\237>\275M\257SV\317\bx\006p\323I"
+	.string	"\267\315t!mV9~l'i\206\026vQ\220F\331\033\034\202\2571!\221\001N\360\001\343\347\210\273\331\212\001d\225\3340\304l\\q\033\037\202+/\252/BQ\274\250\276\030\360\001\027\005\377\323B-L\221,BC#\376\245\013\314\215 _\001\037\237\r\326Z}\356\235\201l\005\\\373\235\250\223\021`J\235\364\217\223\025\263\314\223\322\311\246;yr'\355p\252^\244\361\200\341\204\3341\207\314\231\311<$"
+	.ascii	"\340qj\225\3329}I\227[\017\236\007\330\243\275\002\250c\214\366"
+	.ascii	"\b\331\203\315\315JH\362\360b[\363\231\307\233K\217\033\022\246"
+	.ascii	"\b"
+	.string	"\020\323\245\\\3318\323\273\360&\031wg\305\232\220\177\\\357\341N\264\315\313\255\225\216\265E#\213\352\250\222\224\202Cs\244\247\211XY\033\"\352\024\322D\322\353$\241h\301\340\221\301i>;\321^\233\"I/*2\2702:\250\204-\221u\222\001\201y\250A\2712\246\206DF\222$\2254\006\321\004\204I\306\034\224\036\021\3600\207\224C\"#\"I\222J\206\0030\242\001\301\306\036A-\333\220\r\204(\340^\363\354\345\030\f8\354\022\315\273\224\355:\350\274\225bjo\007\222\203\t\353nRN1\333\256\313\323\335b\025\321\363\232\325\022L\262\271\215\243\017\200\220m\262M\221\214+\023\332e+\257\330\215\265\232\337\266\277[\005\250\360>\035\343\322\333kv\311H\227\373\036\231y\r\005\004\275G-W\343Wb\321h\nd`\367\302nnx\206D'*\234\314\354\004jlYP\353M\336\022\327\fm\020\024"
+	.string	"l\246\310\003r\270\356\214L\2776a\366Y\016&\007{\320x\331\252\254\b\256\237#c\37318{\376\230\275\237OB\032\232\036\321\254\374x\301\tj1\304ii\215\003\227HL\251\001\375\031\360\027\376\254\240\266\301s\322\370@\303|9@$\3425\335^U\314\256\242\246\334\250\020+\\b\ti\224\221\003\253\026F\250=\031\230\232\224\t\234\207z\3025&\020\212\177~\364J\332\242\b\241\024\335\372\207VP\345\357h\300\252\233k\2047\331 \310mV~:\257GR>\022-\244\036\3104A8&\366@ \340\235V\326\036\237\003p\2251\033r\256\323Egf\242{gv\364K\034\331\234\357\315\020\003\034\206\032\330\005\332hP"
+	.string	"y\3237\360\003\032\232\004\227\330MDn\351b\230\007n\346"
+	.string	"\2462\370\205\376v\206\007\3563\017\252s\227\363\331\357\322\333\302\353\311\326\271]Rw\266 \322\233\352T\274e\035\254\211=>\246\024\345!s;mL\355\225\245B\225\256I\313z\301q\204\365\254\340`\2373\300\236\301\016\371]\005J\253\322t"
+	.string	"\223\312\244\001\345\235\320\214A\271\016\026\346O\344\200\200\322"
+	.string	"\371Um\354=\207\304B\022\016\f"
+	.string	"\2114\363\370qz\275\360\230<c<\207G\354X\360w\270\201\205\236\335\337K\203\320\362\310\354;\341p,\370\304\203J\005\311\257\302\343\237\210f\036\376d\360\267\333f\025\200B\264\307\347j\017\\oC\253Bf\302P\252\266\020\302\021n\3505C,-\244-\254\\B\347\250\030d\007\361x\222\206\344C4_\362\004\227m2;\315i\217\261\007\234\251\\O\3364tL\224\331\377M\267G\005\236\346#\357\256\314\017?\t\016\206\257\247\275|1P8|\007uh"
+	.string	""
+	.string	"\311\\2Z\232vAd\260Ubn\027{\364Sx\231\027i\330\373\211\323o\262\261\027/+\263\233\240\261\334@\003$\203\251\020\343\330\215\nI.\206\331\216\022X\307vl\252\311G\026\300`\247\307\220\022v\004\b\272\204\"\264"
+	.string	"p~-\226\313\334\312[\210KeA\246Z\233or\316\247"
+	.ascii	"iN\334\312^\t\310\367\021\257\307B\033\314\343\253\304\366\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\346\b\325\026"
+	.string	"\366\233R:0o\222t\244\264T\240H\"P\307\305NL\206\2300\263\013!\207\017\252\013;g\207P\322\313\210H\324\037\274\350\177\354\177\376\340\035\316j\224\002}-?\216~k\273\021\"\223\f9"
+	.string	"B"
+	.string	"G"
+	.string	"\274\325\273zs./u\275e\367\347\301:\241[\313A\247\364(=M\267\356\254\330Y\177\253l\320e="
+	.string	"_\305\247\027\246g\275\312\267\344uI|I\223\275T\317\f^\244\b\320$\356\225\235\247\204jv\240\267\240GyZ\027\227\243\264\211\242(\232&\326o\026+\212N`jV\240V\230\246ib\311TajfN\301}\304\213\270/\t2ZO=\2646z\226\036\246\367\361\253'\225*5\203Y.G\216\n\237\223\347dqL\271\r6\037\364U\213i\004\366\0372\345&\256C\037)q$\027\202\020v\032\355\f\342Q\036\311q\350#\323\243+n\026\311\224\247\2162}b\204\264\243j\021\332T\3231\002$O\343\362\3465\3545P(7\241\232\246WH\307\025\244\177\030 \013\360\276%2\241j\003\302\nmtK\307\3642\004\236GB\225e\260\344\245\373Y\210\2463\0300\212#\b\260`U\352\273`\"\030\254'.\357"
+	.string	"\001\200\267\250\221\275S#2R\220\244\220\346`\002\021\242\272\352\022\340\3410\004\303Z\022\244\224\230\022\241\211\222\202\024*\215\001\250\373\313\253\200\255B\026\266\013\311.\207/\264^0\242\233\333\250N%\253\002\002\367\006\271\351\375ef>r\236D"
+	.ascii	"\330\3469N\006\310v@]\026\022f\215\326q\225p3fx\300\3338\034"
+	.ascii	"x\260\203\017Bh\251\231\3532\244)\225\204\002\323!\n\235tb\324"
+	.ascii	"u\344\354\361[1\223\210DU\365[\240I\325d\215>9i\353\016a}\351"
+	.ascii	"\023\271$t\003\333izK&\215\322\310\314\003\225=\335\247\002\313"
+	.ascii	"\316\251$\034\347-\266~ul\240\240)\254~\001\256\225\027\006\370"
+	.ascii	"=\232\266EuI9\367\357/\2106M\302!\346B\335a\364>\244\375(j\264"
+	.ascii	"\277M\027\233X\253\214x\177o\224\345<K\201\212\222\002H\261\271"
+	.ascii	"TY2\361\253\214\016\342N\207\244\013\177\220\344f\341\017i\020"
+	.ascii	"\244}\303\r\225\016\006)\blp\375\231\035+\200p\006h\215\205`"
+	.ascii	"\025\3324.\215\231\302`(o\260\345A_\305\254\203\353\351\342\232"
+	.ascii	"\022\355\021E\017\336\361/\251xt\272#5\b\373_\203O^\235\307\362"
+	.ascii	"\031lF\200Y\001?\023\ftSA\321\357$\003\234z\257\270\302:;o\310"
+	.ascii	"\021\235\356\025\241}(vI\003=\020E\355\020\004\r\342\232\213"
+	.ascii	"\203\255\030x\334\324}y\347rHY\324a\350:\334\230\326K\236m\360"
+	.ascii	"w1Z%G\006"
+	.text
+	.section	.gnu.lto_.pureconst.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375 A\345\001"
+	.string	"\022\004\016\030\240)\035\377sJz\356\377\377\303\252\316\246\342i\331?\263\366\177\"y\007\363\271\316\327L\346\245\216\226\251\334\344\"\257\343\032\267\270\304\034>\341\013\356\027\270i\23223("
+	.text
+	.section	.gnu.lto_.ipa_modref.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\275\002\255\016"
+	.string	"6\225A6`K\223\341P\314-\020\003\3164(b}\b\202\001\036c\200\2675\203\020\353\026\352k\004\301\250ER\024\351\340\260+7\212F\333\325\212\272\022\326\177\211%dK\231\002-"
+	.string	"2"
+	.string	"2"
+	.string	"\257\365\033\266\3368\332+\264\261\037\244k=\335\032_\203\252\245'ZF\312#\267\376~\317\202\256U7\347\n\252\216\332\337\302\0333^\205\b\221\363\370P*\034\306}\240PU\306\350f\271\205\362\241\021\226\307\231&\274\211\206\261:\366\032\315\263\244\234\352;,h\232\352\031\333b\336!\031\007u\226\312\255\230Wj).\200\247\327r\336l\315q\031\324\303\320\306\234\314\312\3651H\202\3179wi\2172\326L\353kT_X\320\306\262\202\3769\030\264G\345<G\250p\200\360\234\340II\225\210\213 \372\300\2340\240\234{V\312)\215\327\205\005\b\314e2(Z\340\301\023\bp\341\206\262\373\224\006,`r\341\001\363\234\223\300G\271\206d\250\301L\307\220\321i\322\236\001P\0021J\231y\021\020I\215N\244a;\330K\305>5\237N\341\332\022\306\273\200\247\273\345\234"
+	.string	"\311U\375\037D\032\0041\013q\225S\177b6*\275\f\f\3047m\246\377+p\223:\f$w\271\201\020n\273\237`\361w%#\013\250U(\342\0252\346\201\302S\001\351m4\366\267\333\3734xg\024\301d9\242\n"
+	.ascii	"\027c1V\2173\276\377\304o\262\202\016J\366}\302(aHG\257\026\304"
+	.ascii	"\005\316\270\356\343,\332\304Pa8\305\211\317\342mp\027\335'\247"
+	.ascii	"\226k\274r\332\243\205\206qF\026\203\220\2055\244\205}}\032\020"
+	.ascii	"^\255\375\204\373\037\351H$\253\215\253\n\001\376\005/\004\206"
+	.ascii	">\253\"\313\036"
+	.text
+	.section	.gnu.lto_.lto.2e37fb9b28356d3d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_mspSerialAllocatePorts.14.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`d\006-("
+	.string	"zG\300\017F`\336Q:\005\022G\351,3\260\261\230\260\347\321l\314vNq\032\220T\341\261\\\322\256\367o-\362k\215\247!\372\320\254\302\365\2078\026N\216\2601\234\241\303\b10\021\033@v\210\307m4k\215\020\"w\222\001\356"
+	.string	"\330"
+	.string	"\352"
+	.string	"\350\035\022\340b\235\335IrcJ\355\315\250\036\246\330<>\024Qs\360\224g\2341\361\275\360\277\274\231\204VVd\303\347\005\0332\034k\200R|\214\212y}\372w\271\030\257IV L0\236Y\205\336!\030\264\344\t\301{\232$\306\364\260s1~\271\303\351\212\207\2077=\317{\231JOY\211\367\224\231\017\252Oy\027\240>e#\363\236\242\254\240;\310/p\367\336\245n\302\2535\336\267\366vj\212\2665\362\205\312\306\350\230)\255\356CwY?\242\334\t\244\b\332$\3674s\261+\273\252\\F\336\333\t\271\212\026\210\263V\005\250D\242\b\216$\021\263*\265ljA\316M\t\027\221\243\250"
+	.ascii	"\"gs\200\312,\264\301\034*E\336\274\335Rb\331\276\330\023Xy\206"
+	.ascii	"\305)\3412r\273s\272\367\262M*\271\316Agf+\314\234\203Ye\020"
+	.ascii	"G5\305\003_If\326\3614*\222\352\334{\233\316\034\315\n\376\223"
+	.ascii	"\247\314\242\205}\262\205\3724\330\266-\031\344\327o\024\020"
+	.ascii	"2\320\321\326\361\233\347\265\301qvsM\226\2629\370\3069\324_"
+	.ascii	"\036\t\200\375\237Tf\241\f\373\344P\037\211\027V[qP\315\371*"
+	.ascii	"\365\314_\360:\3329>\024f\334\333\265s\314\314+\333L\230\337"
+	.ascii	"\364%\267\207{\t\363\221Q\321\311\316D/;\007\207\204\200\277"
+	.ascii	"3\317A\253\345u\265\354[-\367|\226w=\313\252j9\345YF\277<\367"
+	.ascii	"\316\262U-\337\300S\0227'\236\246\303\274?\352\350.[j\006\354"
+	.ascii	"d\177\331\277\374\231G\231\317\037{\032\363\312T\007\303\027"
+	.ascii	"s\264\343\241\353\n\273\367\256gtL\250\375\031\031\016\025HO"
+	.ascii	"+\b\363\315\302\024\003O>\005\234\034Y*\260\226yVS\225\036l~"
+	.ascii	"\232\361\2121\213}\222\221\264\332\212\237v\024[\234\027\355"
+	.ascii	"JR\340\372\234\035\351hV\254c\016\323\243+\216\212C%R\301\330"
+	.ascii	"\342\336\210\372dGB`\371F.j\337\330EU\233\257A}\231\357\232y"
+	.ascii	"\003\007\373$Q\243\227"
+	.string	"H[1s\207\317\371\260\340+C\235][)S\227\003\202w/V\023\337\3718!P\021$\324'I\250O\325>\035;f\320N\373\310@\314&\316V\305;\234\027(xOv\250O\321\006\360\325\005e\216\317\303\215\017')\260\353H\327m%\\\364s\324g\036\351U\352\257\217\332\372\321\352\272\262u\\\354s\273\244\373c\007\275\241\332&\216\335\301\262r\314\234\342j7\032\204a\271\3672\271Q!\342\n\034\233\267)\252Om\017p\262\024\272\005\373eW\341\025SB)a\211\341\t`\224T\215\335\024q8\302\227C\b\303\306\207\036C\250 \001B\004!\205\247\007\003d@\305\2601\3340E\034F\371\370\351\001\r\027PD\241T\213(\251\032K6\240\\\324Xz\"J-= \300\303(!qij8$.\255\314\343{\t\243S\310\304=\217}\365\3645\023\023hkv\250\031\355u\003{\353b\357"
+	.ascii	"%\315~\314\031\355\t\365\257\267\240\324\2657\370\272"
+	.string	"\327k[@\310!\326\327h\033R\313\332\201\335\353\267!\321\\\354 \364\260\305\275\375\254\235c ;\241\367\336\273&\330B6wF\315(\260\273\267\030\335\0055\025\262\211\036\265\320{\315\004\235\242\245\0265\243\351\257\203z\213\331\250\314\231\215T\214\232\205\027V\363\357Q&$\250\235\216\273\2427\377u\221\n\304y\317\376\346;\200=\343\236\3074Nq\267\033J`p\001\200\202\25010g\024\203\306L\211\004\"#\211\2321p\002\2311+z\020hG\263I\20610,7G\246\220)\361\273\277\236\330\317\326\177\257\376 \016\306\037\235\023r\270-\024K\tLN/\201\313\340P\302\312\314\f\f\276z 7\213\024\327\006\356b\250\364\313\352k3W\320\341k\007\233\333\351\374\276\007\305\256\026\216\203\2576\233\345\310\001]q\306\f{ o\212P\\\333if\257.\314\3623\312\213P16\253j\270\025h=&"
+	.string	"\271`\244tZ\3719\304s\236d\334\272\201\2326-5n\005xD\314\236D\334j\215c\241\353Fb\023\021\217\320\022\277?\260)x\214[v{\263\377\371\243o\241\252H\200i\255\201\310\237\030\027,\327I\247\305\035\345\256\200\353,\307\312\037i{\3468M\214Q\375P\367\304\371~\brP%\341x"
+	.ascii	"/\bz\007_\334\201\327\210.$$\016\277\337\325'\212\207lf\215\355"
+	.ascii	" =\303\225\257\026.i\366\364\202\346\017"
+	.text
+	.section	.gnu.lto_mspSerialReleasePortIfAllocated.15.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\315\002u\026"
+	.string	"\246*\224H\320VQc\220\027\325p\363\316\017\"_Pn\205%\333\334\303\315\023\3037\353\025p\rh1\353y\226\254Y\232\201!\324l\222dZ\230\272\203KY\272\027\227V q\271\221\253\353\002GIJGB\337\377{o\271\245L)|"
+	.string	"x"
+	.string	"\202"
+	.string	"\324\276\215\337\210\275\250\303\003\334;\304\344\350^S\201c\304[\233\037"
+	.string	"\336\212\027"
+	.string	"\336:f7\271\251\342~\367\323\323\203r\3575\325\024\256\377\314\033\244\261\207\240\375*\215\3718\216"
+	.ascii	"\227\343V\312\036~/\367^\227\262\347[@\243\340\312\213\240\333"
+	.ascii	"\021\377>\032&%\316\245\364\360\215!\232 y\357\324\247\254\321"
+	.ascii	"z\335\023\b\375\270\225A\247a\315\275\327\364V\002\335\342m\213"
+	.ascii	"\260\235c\3233\340s\237pbF\221|\335\277\030(\350\t\243\310\245"
+	.ascii	"H\266)\243\225\310\376\357\275\327u\310"
+	.string	"\036_\364\213\347\335\341sw\265\324\364\243>\013xD\244@\216{\177\222\244\334!6H\213\363\376\\\251\304\311\337\371=\217%\023'\233\267\363k\003\241\342C\303Q\020oK\345\3117}\235\307\333\022\320\311\266g\032\304\236\343\021\257\213\220\307N\310\311\275f\314\255m\304\333\217v\311vz6*e\2532\2035Z\250X\355\234\025\375\3150\265*\263\313I\303\272'$\214|\225\310b\245\225\334)\251\321(\266/\374HC\b\304\b\312\275\367\364\203\325\"3\232at\037;\340-\255\007\224\024\261\2342\212\204\365\274W81{\217\235R\222\233m\016\347\301\242Qq\357}\240\343;Z>\213[gx\321\337n\375\027x\033Vz\344\026T\353+\330\353\2312\243I~\357\377p\306\250\367^Y\265\317\0230\262u\343z\331\250`(\234\025\216\016*\365\262A\205\243#\001F\266\\*\236\201@3\303@\345 %C"
+	.ascii	"F\266nV\234\222\301\200Z\221\252\227\005\327\213e\322Y\241X\246"
+	.ascii	"\024\3712\311\030p\313\245\"M\260V\2134\215\346\375o\035:\216"
+	.ascii	"\213'\220!\263J\013+\221\001\340\354X\355\n\372\363\265\372D"
+	.ascii	"XR\243Q\254\f\024\265\326\314(\322?p\254\317\035\346<`\255c\275"
+	.ascii	"\315\004\215&\335\306\t\203\332\027J\315[\b\030\363\260\0063"
+	.ascii	" @\002\202\320]y\034\256;\307\177c\314\343-1\332\026\267\223"
+	.ascii	"%\033\223j\266G4p\214\030\201)\033\372`r\205\270\275\342H\375"
+	.ascii	"q\272\364u\020)\263x\003\033\201\002\270\027\231\222\035\025"
+	.ascii	"\230\372\205\022N2\312\351\221\023\bnHh\237\r\225a\270W\b/(*"
+	.ascii	"\356&L\326\200\nB{\277\200\003\351\002%\370\275+o\273\024\213"
+	.ascii	"\330\016\252\347\372\267^\314}\333\253\222\342N\033\310"
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedData.17.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`-\024]G"
+	.string	"\nk\b\030B@bR\007\217\351}\236[W\315\267\332\207\320S\23173\223\367\341\330\337\036\030\b\351 \356 \363\300\252| \242\374\214:U\235\252\337s\212\031y\325\353\356\017@\f'\253*\351\245m{\357\275\245L)p\001M\001t\001u\373\rv\376\261\3753\257y\305@q\367\177\246U\371o\361\347\342\305\347\223*w\271\031\356L\004;\203=\020'tmS\377\372\005\371\337w\257\341^t\177*\251r\365c\247/4s\375\365\250 \377\373\034R\245\265\373\267\275[\215\177\243\361C\363l&'\314<c\005\370\224\374\257c?\t\377+\177\021\374\257\273{\201\0035<\353\261g?b.:j\027>\363\214\245\332M>\353\003LA\245"
+	.ascii	"D=\241\236\234\232\230\234\315%%f\022\322\221\321R\231D\026\021"
+	.ascii	"\r\t\005\035\201\214E\342P\216\341\327\335:\313\237\370\245\365"
+	.ascii	"\001\246\240h\316h)\261=\r \352N?\315\200\321PO_\336I\373E71"
+	.ascii	"e\353\264\223\3133\371y\211\321\351\246[\205\203\317\330\373"
+	.ascii	"y\331\271\306>\3246pzI\211\351\326\246\223\336\3304\322\221\321"
+	.ascii	"Z\026\275\324\002E+\265\250\351dlu\345\f\260m\020\371$M\027\021"
+	.ascii	"\r\t]]\347\024\2573\035tdR\002V\366@dq\3174\305\253L\033\213"
+	.ascii	"\277\305\367\304\241\221)^E\264\034\273\3202> \357\347E\304M"
+	.ascii	"\262Y\"\207\252a\001S\320&\023&\352\241\351\271\234\003~c+%`"
+	.ascii	"b\357\372y\361\025\277n\350}\374\302\341:\347y\376\270\327]_"
+	.ascii	"\\Z\307V\363<\273\256~\201\275\013x\367-\344\356\031\334\207"
+	.ascii	"\266\004@\333\214\301\206SF\314\273\225\226q[\351~\016\036Q\266"
+	.ascii	"\017[Qo\267\333A\"\f\307M\277a\033\326m\3713\334V7\363jH\352"
+	.ascii	"\032\023\210\033\026Y\377ay\025\260{\212_\243\342\t\320\312\021"
+	.ascii	";\207,\336V\267{\036sT\374\376\356_\023B\365\320\362`>\377\276"
+	.ascii	"w\317\377\214K\306\277\314\036\343\237\247\303\370\343\375c\301"
+	.ascii	"\377>\030w\247\363_FGWg)\267\242\352B\217\3016\017\336y\267\365"
+	.ascii	"\245\260Vy\326<\313s\234+\342\367\356\323Oa\350\2762\316\r\361"
+	.ascii	"\323\363<km\227\302\277O\310\005\336\320}\334\235\305\317I\345"
+	.ascii	"y\236\021\370{\311Jk!\247\375\353O\003\376\3677\362\372\266\245"
+	.ascii	"\267\376q\337a\r\311\340\235Y\373q\307j\351mu\177w\336f\356\217"
+	.ascii	"\375\207\376\333\277\324P\373s\250\035\312\265?\311\332\235b"
+	.ascii	"\355M\261v&Y\273\323\325\336\224\265/\271\332\225\\\355\314X"
+	.ascii	"{R\254\035I\326~\024k7\212\265/c\355JY{\322\325\216\224\265\027"
+	.ascii	"\271\332\211\\\355C\261v\241X{\220\254\375\030k\007\212\265\033"
+	.ascii	"]\355\305X;Q\326>\224\265\313\261\3668\326\016\313\332_Y\273"
+	.ascii	"\033k\337\261v\rk\377\017\313\263\262\261%\001V\246E\333\300"
+	.ascii	"\365\215h\3579\324B5#4\225)A{H(\212\016\373\240-\244\026\r\332"
+	.ascii	"\315\300\276\230\207Y]S\243\3559Q\353\004\227tZV\257\250\347"
+	.ascii	"/\212R\254\257Y<\256o2m\302\r\2765\353\006\203\315\177L:\017"
+	.ascii	"\335W\306,\033\021\265MX\322\3079V\327\016\374P\323\201\264\304"
+	.ascii	"J<\004\214\354\210\250\221d\245\354=\270=\243c\331q+\217\020"
+	.ascii	"\353\340\t.\201\266Q\315\030\320\376\274\253\230q7\b\374$\233"
+	.ascii	"%q\224\325\377mC.\320G\225\314\316\301v[\230\364\025\232\310"
+	.ascii	"t\t8\317\263\002w"
+	.string	"\017z\b\210\177\005\004\216\301\273\270]Bj!q\007\2116\001\377\2430\274\211\333%\314Q\306ed\b&\357\241\227\\\004\271\255\361\206\367V\223\3433\241}\304\373\357\002\337\266Jh\036Qx\177\334S\211\3512\210\346\213^\275Cz\226'\310\273\251Sw\277{\367Q\205p\351\255\273\223\3208\246n\330\024v\017\241\267\246H%c\366kow\021zF\356\275\355\250\205[z\2735C\344\276\024&\034\204nw\022\357g\252\334\204\261\340qN\217\337Ga\367\022\317'\272\004\210g\273\233x\301\350W\357@\267\336\233\220Zhg(O_\022M\017M(\r\032\275\240mu\r\364t\037\204f\334/\205\241v\227;\324\256#E*]\211l\351\255{\334V\035W(V\354\350{\201\005\006\nT\245H\020\035\240\224q\005CC\f,i\354\321\001.L\260\270J\201U\"\006\226\224\352\005\013\023R\252\350\025\026\325"
+	.ascii	"\246\303\210\221\342\212J\006\f\030WTE\354\374\333\314a7\201"
+	.ascii	"sw\304\377,\370\343\276\302\037\230\271\273\355\237\005?\355"
+	.ascii	"\256\355V[\233+\300\034\267w\016S6\225\344\343h\327tv\313\013"
+	.ascii	"\324)p\352\264\225W-\226\254\230?)\275.+J&q\004\001h\2757\312"
+	.ascii	"\346Q+E\360L+j[\275i3\355+\271@7M;\352\217I{\304\311Fi7\235K"
+	.ascii	"\273\231fIIK&A\363\241A\332\314\244=\244\235T\006Ik\344\315["
+	.ascii	"\303\362\314\353*\222\344\307\372\004\312i\370R\270JK\223\374"
+	.ascii	"R\370\371\324c\230PO\333\252\335N,\314i\233-\267\221\216\034"
+	.ascii	"\034m\030^\224\251\375Z\356\273\350\366h\333M\373\262\340\264"
+	.ascii	"\366\301\321\016p}#4\252\213\332U\357@\320sF;\352\372\346\247"
+	.ascii	"IwaB!\263{^\254\n\023\246\t\360r\277\022\2714\021\364\226\t\362"
+	.ascii	"<\337@\340:.+\215\302\237\237\001\377\273\334\312\353\233\236"
+	.ascii	"\266\177\271wv\321p\030\240\316\252o\276}\004iS\326f\3011\310"
+	.ascii	"H\300\234\306\314\264\361\231\347\231\300\007A\262\305\345\337"
+	.ascii	"G\026\217\256\002\370\305\031\205\225Z\242\312\255\264\223\324"
+	.ascii	"Y\220}\325;"
+	.string	"F\232h#\267\373\006\016\372\253\311\355\304\261\265\274h#\003\201\242\250\201@\t\22132\022$(H\n\222d8\321\005\204\020\306\240\253\016\021\2000\211$B4\"\022\210h\nR\2246S)\3724\373M\332j#\021_A/\240\214RUp\240\\\fzUv&\277`\311n\256Mt%\272\366\303k\363\232?\365d\273E\257\327QX2\226\213jr9\334\205R'<tO?\016-\305\3558\370^=\273]\035zR\353r\254\320\217\fU\244\315\361.\212+g\226\016*\013\220\034-\244\300\305\337\217\314\026\225mU\341\001d}\037\204\311\264\364\253\373\266\216\224\002\277y\t\027%\rK\375\3450\351\302\214\364\027u\271.\223\006\220!j\311\205\356\241\2018\244\036>K0\220\302&\366\333\256[\242\333S5\254\214\312\302\240\241\375j\"\221\030\364J\007\247\332Zc\350\205P\320yc\222)kN\320\2720"
+	.string	"\217\0371\254"
+	.ascii	"\025\277H]\216\271\250\234\373\315\254\026\304\347r\274\352\230"
+	.ascii	"\013~\342\022\373Ks\013LIc\356\022\326\007\322Oj\345\021C\032"
+	.ascii	"\303:\374\256\220d\323\350\371\203\003\016\2548) N>z\205@\276"
+	.ascii	"`\241\363\323\026\201\025I\340\244\246x\202\336H\0272\276I\243"
+	.ascii	"oY.\313\273\213/\2253\243\215\316\271\355p\024\334\300\224\006"
+	.ascii	"\326\2251b0k\354b%\212\002\313wv\217\n-\337\240\222\264\002x"
+	.ascii	"tP\324\251Y\374\024\2070\020Q\243\347>FG\221\325?G\312[c\326"
+	.ascii	"\343\r\331\323O\237*\330\005\004\303a\t\024\334\006~\254\315"
+	.ascii	"\002\263\373\243\217\274K\372zR\260\221EbO\2311a\231\313\263"
+	.ascii	"H\212\243\376n\352\007\034\237\234\034\250\213\301KL"
+	.string	"<J&+\304\326\207\034!j\t:5\346H"
+	.string	"\020\331L\315\242\034\352\224\312\r\225\3047Hbf\334CRz\357\313\212H\253\375\326]\002\256\375\230\363\202\n{\350\315))\334\322\005\020\212c\b\217\315\272\241K\335\261=\271d\351\306\nh\257\3403\375jpL\374\264\372\336%\207\364m\365\366\271\210\330\270\"P\365g\232^m\214\336\334\245\251l\2207\247k\254Y\324"
+	.string	"\033\361\313\032\317\213(-\256\210\202S\345\242(T"
+	.ascii	"\003<P\004\312\270Cs|<\033\213\313B(F\366\360\025\274\022\276"
+	.ascii	"K\023;\331\314\220\362\346\252\360C\024\3414i&S?\314\246\343"
+	.ascii	"Q\365P\247\031\235\022Q\244\013\240\026\033\2219\353\335\032"
+	.ascii	"d\372o\234\013^\340\375~\227aY]\263\250\335c\036\225\021\026"
+	.ascii	"\245\226\275\261\262]\254\205\3355Y\311\b\277\330\253\321\005"
+	.ascii	"3L\307\206\215\204aN|\032\334\301|\224\007\240U\372`\376x\256"
+	.ascii	"\316\b\234\027Y\254\261\341\304X\257j\341\272\242\344\330\210"
+	.ascii	"\365\035\343\227\336Z>\235\277\333\025\330\257\344V|\177"
+	.text
+	.section	.gnu.lto_mspSerialFrameBytesRemaining.18.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\375\001\315\020"
+	.string	"f\340nE\360\222(\035@\317\037\362K\227wz\252\254d\002"
+	.string	"8\224\245t\213\207\324\262\317\020\304\230V\314\243y\361\272MW)\360\2532\237\321\217e\306\020\237\201#\250\262tG34\277\374*i\"\260\337\b!{K\231R["
+	.string	"V"
+	.string	"^"
+	.ascii	"-\276\203*\0070'\214\006\307\234`\002\037\350.\rv\266\375\025"
+	.ascii	"g\361\3311\021,\341\342V4,\027!sN\217\300?\333e\274\200\355r"
+	.ascii	"I\374\273\214\253\237\237\272<"
+	.string	"\3552\204\212\033-\327\207\307\317\227E\265}b1':\256\325*w2\347\264\266\\\035\356\355\266#\330v`+\204\026\2729Y\026\370/L\250\016\305\245\257\262]~IL\314V4\364i\357\274\314\370\230:\304\006S\272#\354o\030\2063^\230-\325\034\251\356\016\376\234T\313\250\216Q\275\253VU\2773\002\242\207\307c\316\ra\315\224\221:R\330w\361\331\036\273@\215\311\3654\177\366\016=\207H\327\3731[\321\320\"0\036^\343#\034\242\210rk\217&\350[\234\215\233\362e\334C#\223R\233\307bb;\3260\256i\330\322\235\264\275\37068V\006\331|\315\360i\270\326\311\223\266Kkk\256ld\217a\273\266.-s\246.\302\237]\323\3264\340y\255\364\306v\3510\002.i\240\240\304D\304 \004\"I9\225\036\230P$\316!\020\005\224\321I\204\222`B\221\274\n#\024\222\027:\241<\320"
+	.ascii	"\227L\242\223\227R*\235<\0178\037\347\302\374\027\220\231\"\370"
+	.ascii	"i\017\020\273\365rV\256\006\333ruU\276\313}\022e\334nW\376\302"
+	.ascii	"\0267\006\301 Sih\335\335\263n\034& \200\202\231Q\352\001\223"
+	.ascii	"8<\fc\337\236\375bI\245$*\033w\305;:\324\b\203\242\260\236&j"
+	.ascii	"U\311l\013\326\301o\2550t\n\301\021\033\375\336\223~\244\201"
+	.ascii	"\267\242\200\0353`\376R \206\201\247DC\372\303\007~\f\377\241"
+	.ascii	"=!i\r\n\241\203j\251$\206\363\355\262\367\004"
+	.text
+	.section	.gnu.lto_mspSerialStreamReply.19.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\177\016\025J"
+	.ascii	"\312|T\033@@\244\326\030\353\207\026Q\220\022\306\200\205\025"
+	.ascii	"C|\353w\305\016\272\217I \254\241\265\347'\217\201V\304\270\201"
+	.ascii	"\340\357\304\311_\364\353KR\016\367R \277\270Ndxn{\262\335%D"
+	.ascii	"J\231RJ\001\246\001\210\001\247\001\f%\345\325i\266\232\372\232"
+	.ascii	"\271D^\020\271\317\344\331X\212Q\3373\252-y\342\002\025\3405"
+	.ascii	"\207\336g\274:\317\006K}\317Z\r\2223q\201\335\362\212\271&\267"
+	.ascii	"\030\3561}\307\254\222\3512_m\206\255D\260(\261\256\t\224\277"
+	.ascii	"\367}S\020\273]\262L<\273. P-&\272\316\213\371\330\2553\177q"
+	.ascii	"W\233\216\217L(M\34609\372\035\213\026\311\352\224\374\275/U"
+	.ascii	"\004\261[f\226fS\033\314W\317\351 \276S\256\232\270\375\275o"
+	.ascii	"\324A\267lE\354\226};\311eJ\233\356\314\035\327^\276ZnG\033\275"
+	.ascii	"o[\337\231\367\245B`\007\304n\231\332In\267\304Fr\273\205\222"
+	.ascii	"\372bgS\335\314\206P5(]\340\373R\233\337dXXXX\330,\265\371\310"
+	.ascii	"\311w\266Q\021\2212\211<\032\213G\304\241\333\262\357Nn\004U"
+	.ascii	"Aax\310\234\201\265\021\033\332[\027\261\r\376\320\fJ2\213B\326"
+	.ascii	"pQ7'b\243z\004\246\3655\372\306\"\007\241u\032.\252\304\225\327"
+	.ascii	"\350\032]\230'\r0ASk"
+	.string	"$;\354a\026\245\257\3214\226j\360/\r\022?2AK\322\306\264.r?\223\364\021\333`\255OH_\243N\330\2449K\3664_\033\200\213\036q\342\220m\356\3650\353k\324\b[\3446\370\247\373\332\313\316\240\356\262\241\031\351Vy6\306.\337\367=\236\365p\226\275\340E\313[\337\265\0039\023c\177\256n\257\341\242k\376M\327,\026.l\342\004\331\320\324\332\207\031\336\367e';CkFj\346\246\301\314^\314\311h?\341\233\017\364\220\223\3733w\270\362&\373Gq\307\377\301[\337u\377\300\343\273r\033&S\334\376\247\314\254\\C\300\373\231C\214\360&\343\243T\354\301\230\231D\323\211A\354g\362\223{z!+\325\\\035\017\315\365}\323\035\246\227O'\344\026\323sr$\271\2211\227h9&\210\357\373V\210\343l;\301\030\322\n\255\305A\331\201\202s\020\245h\b\322\330H8!}:!\003"
+	.ascii	"\364'\b\370:!35\314\177\312\334\306\264+z\370\333\230?x\350\275"
+	.ascii	"\346+\253\016F\316\0346\264\265YC\3535WQM\265\233f\251(\250\t"
+	.ascii	"-\327\r\241\355\232\027\264\231\346'vV\300\316\314\243s\202\243"
+	.ascii	"3\002$\347\003Hg\003G\347e\322\271@\322\331)\351\334\224tfJ:"
+	.ascii	"\023H:\017H:\0138r^*:\0070rV::'\0259\003@:#!\235\217\212\316"
+	.ascii	"FE\347\"\"g\242\242\263\262\350\234,:#\223\316\307\242\263\261"
+	.ascii	"\350\\,:\023\225\316C\327\331M:\267Ig\026\351\374Gg?:\267\210"
+	.ascii	"\257)\201\177,\020z_\263\302B\257\2346\215\224\326\353\266v\357"
+	.ascii	"u\273\351\266\3536\323=\327C\346f\3625\271\217\217\3146nd\224"
+	.ascii	"\301c\247\325|\314G\366j<n4\255\246\3274\233au\317q\357\365\263"
+	.ascii	"\3475L{\255\354k\204\372\242\325i\272\336V\257\266\353Z\242\276"
+	.ascii	"hn\240^\247\331Z\202Q_3\276f\321[/\017\306Ko\303}\210I\233\257"
+	.ascii	"3<\233\300\332t)\376\224\273\251\334\006\377\216\276\215['n_"
+	.ascii	"3\235\f\271\255\302\t\274\353\242\033\241(\355\324/\370\262\266"
+	.ascii	"\"\b\247\257YB\203\206Q\337w\r\242I\027h^K\365O_\346m\303]z\027"
+	.ascii	"U\277\346k\243\030\276\353\313\246\213\322+RA@{V\245\317\260"
+	.ascii	"\364}\246\227Ov\2529\230\r\247\251\245/*}\200\177;J\272pK\351"
+	.ascii	"\333\314\233\034\021\\\323\237~\301'=\263s\211s\032%\035+\224"
+	.ascii	"\364M~yT\236\334\ty\301gx\022\0378\200w\320L\3167\347\223\345"
+	.ascii	"\330\203q\324\003\370\206\036\002\220W\304\370\207f\320P\206"
+	.ascii	"+\365\315V}\243\314\013\"\365C\244\f<\352\373M\3339z\244g\242"
+	.ascii	"\227\372%\364\301\244\364 '\025\246"
+	.string	"\233T\036\244/\312\031\375\321\263V\350\241\242O\276\321\013\34036%\254\350\007\360\251\322\201\234W\210\376\301[\336Y\224\362\243\222\217|\345\267v\222\357\332\201\036:>\362;K\003V\035\237\351'\367,\204j\266\272\023\036\312\320\265\253\316-Jm\327'\244\335\327\r\004\217\320\2452>\325\373\335X\240\342\023\337\370\255\241\261)\305w\r\265O|\366\r\364\020\241\251o\273\341\273?\365n\035\263\022\346\205\314\376\360[\272.\335\247\313\375\2467<A\r\254N\254\355O\271}\366\271\252}b>\350\245\367\264\257\340\215\331\371\245\365T\3719\333L\344\370$?9% \022\357\217\325\211\365\t\373Sv\320\023\236\253\352'\346\203\214\304s3\341\333\314\007/\262\260\274^lq\325 jyu\311\300\312\202\201E\244\261\025\243\213+\013\307\220F\326\214oq\243\305\013V\253E\026\327\215.W\006\r/\030X-CY\240"
+	.string	"\025\2255\205\025A\251F\227\3263V\204\031-bpeu\261\250\321\245\325\244\021\243\205V\023\213\253\253\031\201\211\267jdq5olmq5\217\324g\177\233\202\267 }~\030\353`\337\227\rC\317u\377\315y!3_\301C\200\"qc\022\251Ip6M\360\001\374\344\f\275\202\200F?u\231\235A\234\315\231'P\334\203>\360\b\\\t\0025\025\314<i[\020\334\016<\373\206\214H\027\336\203+R\344\244\342\032x\327S\325\343\344K\003\337]\334\3107]\273\017\2779\242\237r\201w\"R\340\023\370\311\tq\362\274-W\345O\271\351\231\276\3738ZS\224\351\223\336\344\236t\335jx{W\216SW6$y\354\360\314\026\253\376\303\2271\023x Ud\200\003^\300\023\370~\372\001\377t_\374G\225\200'\362\223C\346]q\262-\"\321[\311"
+	.ascii	"\237^h\325\353?\302\250\340\337\323\t\t?|\353!\177Z\204\222e"
+	.ascii	"\315\350\341\351\257\236\364\0307,x\r_\326|\315fab\264zf\217"
+	.ascii	"\224\276\303\2279\350\253o.U8\036\276\367\"\364\325{x\1773\266"
+	.ascii	"\026\346\205V\200\327\267\3654\\=\373Z}\353\365\262\303sx\253"
+	.ascii	"wAP\"a\356\203\307\240s\b7\024\356.\267[\016\377weH6,\237\255"
+	.ascii	"\3417\374\013\032\263r#\213T\020\360\353\366z\234\031\177\312"
+	.ascii	"\314\024\002<7\237\363\2103\2117Y\325\273\001\201)\250\201 \310"
+	.ascii	"\234R\210dDD$M\222\326\001\005\304 G%e\036\021p5TV\323T*\007"
+	.ascii	"e<\277NP\304N\216\3623\026M?\377\367*m\250\200\006\251kC\322"
+	.ascii	"\013R\363\361!\240H\2153q\360I3s\365\247:\307\b\231\227R\324"
+	.ascii	"g<Vx\307\240T\344\245:\024u\364\020\00629\373!\031\314\307\350"
+	.ascii	"/\257\243\373\342]\374\323\343q(\316;S>\255\017P\245je\b\222"
+	.ascii	"\216\003i\323\t\323\377?^)\235\370N\222d\b8)(\207\315A\321\233"
+	.ascii	"\275\307\fk\022\337>\373\360$\214B>W\341\203\337|6\374,\274\322"
+	.ascii	"\236L}\206Z\027\310M\202\210(\244(\222\320v`P\342I\306\223\033"
+	.ascii	";l\215\322{\301\265\204/\342\b\031)_}Bm\003\251\216\3516\342"
+	.ascii	":J\304\334\320=\331@\017|o\342]\236\246;\264\001"
+	.string	"\311\006Q\001\242\225\004[9\241.\351 \273%W\300\0046\225\344\201\357:\013|M\002m/\275\013;\322\371\203\243F\2245\017\361\251\270\271P\376\245wAY;f\276\261\356\272k\312\256l3\002mA\033\254\3511$DC|\356\353\243g\202\003\305\345E\261\211\246\f\002&+`\236I\241!\202\006\242\341\020C\003\357\322F~\310\203dQ\250\312\036\255?\340:\3729L\361A\276+\221\216\235\271\346y<\262\362Z2\223\276,%\302\203\305\351/\207s\317\307\024\233\230\313<\f\345\275 \261\247\321\203\227\n\204\212\255\300;\026\227d\1779\346\347<\353\013\314{\326`R]I\241\001lF\3623=\177i\244\017\366$\r\221\030\346\317\222gM\316\303Ex\234%g\023{\245dk\022\366\222\302d\3147"
+	.string	"g\206\307\331\016\326\226\320\267B\366]\227vG\200\272\031!\226\2750\0018"
+	.string	"Kk\225P\026\030\250\006\320*z\220\023\356`\206\342R\270\004\276\324\321\377\373\374\234\371\013\201Mp\322\200q\376\233\265q"
+	.ascii	"d-P\342\231\345\211\373m\2146\234d+6\204\306\261\306m\2416\013"
+	.ascii	"olc\3137;\335\265\207;\242\377\200\202\226^\311\211s\306\227"
+	.ascii	"\313j1\276\352\2047\312r\343{\324)\202U\034\312\3223\b\310|\325"
+	.ascii	"\t\350%\356\342\236A\303\r\322\271!\212R\345\235\n9\310\017\373"
+	.ascii	"\f5"
+	.text
+	.section	.gnu.lto_mspSerialEncode.20.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\217\025}b"
+	.string	"\332\236\364\"N0\320\322\031\016\373\376Z\2043\274\375\237qoX\211\037\034+\002#\310|\025\326\207\246\241\263\247''\013\264\035\210x\037+H>\235\213cd\316lM"
+	.string	""
+	.string	"\250T\254\001\315\222\b\267M\276w\017\013\334\026SU[\022#\016\322\366\336R&\031&\002\350\001\030\002w\333\273\271\f\247\341o\240\236\240\211\241\255\353:T\327\033\344\326\266\031\\\222d\rM\200\270\031\250\3165\214\271\016\261;\016\371q8>\003\225\021s\035\222\366y\t\341\226\2000W/7G\224\017\267)\n\300q3Xg\256^\251\221\267%-\346\272\204\002\363\006\255\017"
+	.string	"5\307\346\277\341`\256\313\263I\262\206\326\327\006\307\356\360h\357\252\3733\207\341j_\363\030\336\366\346\016\231\222\260\201\022x!dlUKZ\305U\313L\310\225u]\177`Y\253*\223GB\b_\324X\241\311\343\332[W\246\2163\307\3354;\204\353\225\035\245Y\327\336\272~y\320<\356\242\331\246\020\310\227\220\214Y\t{\353\272\"\347\216\273f\260\204\353\225`\0313+{\353\272v\342\350\316\0202y\035Q\336MQ\200z2=\316\004\241\344\r\355\255\205\360(\223\326\261\371/\3708\213\253\226\nb\024\370\0359\214\b~\016\b\217\222\320;\236w\237v0\352\231#\034h]\235\254Y[W\246"
+	.ascii	"{Bxt\231\302\237\035M\335m\236\314\262eP\331\203rL\337\272\256"
+	.ascii	"\307\245\017\245G\317\007\245G\033J0000\220h\321\237\314\357"
+	.ascii	"O\253?2*\"\032\022B\n2\002\025\177\210>\037z\206<;\302`\212\236"
+	.ascii	"\315\352\276\371\223O\r"
+	.string	"\217k\t\344GF-\274\310\312\034\025&\252\362!+\027\252r$/sS8\350,\321\205\216\333\351\276Z8\221\310\004\211\362,_R\330\330\345@\247\211\275\030v8\335W\224s\310\253\n\327\233f\\<\203A\274\252\234\356\253\354\204\242\263\307v<1\376\t\256x2\244\311\211e\367\331'\233\374\303\031\036\023\356\031\322}-9\227\262|)a\236\2470d\311wN\367\225\004\t\013E\2440$\354A\345\233\027\221\345+\214S#GO\023b3\024!.\203\234Cs*\3240\\n\361\311\263,\362>\203\220\244\201C\\j\235(\340hI\362\346\271k\231\305\034\\\261\256\3532\327r\3107\351\273\357aw\221\354\006\331\020\252\226=\327\321\276\252%=J\314\333;\302\324W\363!6\2607i\2231T\031\235=\264\235,\363\211\367PY\236\320\307&\321]{\225K\212\366\253\210\311\323b:[NG\345\2026"
+	.string	"yiI0\247\376\332\227\222$\332\251_gK,\213\b\211>\333U\214%\371\357<\317>\266Q\234\0220\311\201]\336\247\236\235m\200\331\023\210\263\241\257W\005\223v\367T\021#G\213\351\354\256\372\345sT0\335Lyi\314\266l\352\263\371R\222\3776\004s\3572\320"
+	.ascii	"\237\253\251\227\316'\225T\306\265\373\300q\200`O}\"A\001e\""
+	.ascii	"\244G\271{\f\227\221\037@\272#~\357V\300\202\317\265\3031\255"
+	.ascii	"\006\262\273\026\\\017)\\\327\325\200}\rj\224\026\302)#\244G"
+	.ascii	"\337IyiI\016\\\241\3007~|+\377\3552\263\270\311v\277\315(M)\333"
+	.ascii	"Nv\221S\227\373J\331\2102\362jP\343q_\032\207\373f0C\306\357"
+	.ascii	"\2761`\2740\362bp\273\257\213\333}[\274\356{\001\312\313\342"
+	.ascii	"d\376\005\376\302\377\364\265\257\023\312{<\233o\323\303\374"
+	.ascii	"(\316\374M\030yK\by\231P^\022G\363\035\201\362\212\360\341]\362"
+	.ascii	"\341\r\201\362\2020\362*\005\361&\371\360~\b\342E\362\341=2\362"
+	.ascii	"\032\025y\213\204x\211~x\207\212\274BA\274A'\257\361\344\005"
+	.ascii	"By\213>\274?F^\"\312\353c\344\3551\362\016\213\274<F\336\035"
+	.ascii	"\224WX\344\r\026yS ^\264\310{\376\3606\221\227}x\337\301\225"
+	.ascii	"\254\365\341\240\342\206u\365\n\354a}\203\262Y9\334\037\367\313"
+	.ascii	"\375u\277\335\177\367\233\371\321\374i\376\265\237\315\207\273"
+	.ascii	"g\322;\256\234\0352\331\220\307\301\271\206\025W\2553^W\212\b"
+	.ascii	"\361\352n\367\273\303\201\"\333/\336\257\023\237\333\035.\216"
+	.ascii	"S\270\210\021e\024;F\005b\274(\327\020]\334\215\267\254\340\203"
+	.ascii	"\fM\f\255Ew\035\357'\227'D\030\275\347\007\206\362\027'\036\243"
+	.ascii	"\357E\214\034\031M\217\3212\232\343\034\340\243[_\327\242ow\346"
+	.ascii	"\277\215\321\277;\327u]\177`\364\353^4\006\r\243y\216\322\310"
+	.ascii	"r\226\037l\254\250\322\243\030t\253u%q\321\003\274E\273\350\236"
+	.ascii	"\263\265\002\017.c~|]\246M\220%\261\311\270\330w\343+V~\212\264"
+	.ascii	"\351;\361=\236\312Dm\302\347\272\240\323\006\262O\275(\254\017"
+	.ascii	"\026\2425\266\256\253\323\361\276\"\351\323d\373\017\355d\217"
+	.ascii	"\005Ll\310b\177\363(\221\035xx\311/\347\021\220\240D\271f\207"
+	.ascii	"\301>\342x\347!\343\206n\205\363\235\261-c~9\024\373w_rc)\252"
+	.ascii	"\0266\343(;V\201\325\263\373\322\261\322\327=\365\351\2764\302"
+	.ascii	"\210.v\217\331\022\313\222\343\021}\267\020?d*\224-V\341\247"
+	.ascii	"\213\362\322\222"
+	.string	"<lq#zE\017\021\205\324\247\211\fv\247\366\351\216\333\002\314j\323\303\344jXB=\315wJ@\"[3\b\203\310\326\226T\344K\013\303&\003|U\352\324Wbh\350a\213\001\0053Tr\242<=D\302\323Ifi_v\232X&\354\235\3461J\300d\340\253R\247\026\366\331\334\322!\213\003\367\3153\036\341\267\231\036\315Y\214%\271\004\315\270\b\221s\3619u\260YO\t\330\303\266%\355]U\n/\3253\366\342/\225\312\017\007w\\|I\016\264\302&\250gi\2030K3f\351a\303\302]0\b\210\263MW\3032 \316\272\256PG\237\367\035c\227\363\227\300\326D\t\b\334\331N\223-\007W\355J\351\007\313\264t\337\256\224\226H\376\251m\2101.a6$J\336\t+\321\273\233\242\331\214\361\013Kr\2400\210.p\253\364T\226UN\021\267J\231\272\213\357#}j\006\230\256\224\356\356"
+	.ascii	"WSZ(\241\016*\026V\261\257s@\025\313~\312^-)\\\\M\335@\243xD"
+	.ascii	"M\2359\220\023l\360\201\2154\007r\202\235\034H\017:\207\025\025"
+	.ascii	"\017)\344\025\325\324\316\325\324\215\316\201\234\340j\352FZ"
+	.ascii	"\365\001\026\016)\344\r)aU\024\362\212\007V\232\303\212\n\353"
+	.ascii	"\n\tB\220\007\022\207T\224\216tS @@\212'\344\001RMD:\260\252"
+	.ascii	"z\245\232<\210\242\272Bb\325\320\201Uu\314A\025Uu\224\272\302"
+	.ascii	":6%\255\225\016\344\325\221\207\225\325\325q\310L\276\235\260"
+	.ascii	"\350\245dg-\226\231\035\347\272\246\240b/\f\007.\212\213h\026"
+	.ascii	"\335j[bY#Z\004\267u\241[\217\216xI\316\322\026\024\277\333\317"
+	.ascii	"\300(\021'\304\026\234\020mZ\214\210\242zO\241\f\032\211\344"
+	.ascii	"9rqpoH\346\220EsCSM-\025\200\234\241\032IM\243\273>7d\243\367"
+	.ascii	"DR\352(\251\251\276\234TO\315\035\216F?N\252/\367\023\310\230"
+	.ascii	"+\020\331\350\303E\265\006m#\214\0065\372q4\272\006\221\314\034"
+	.ascii	"\272\005dK\222\r5uR\203\350\375\\\006<\345,\024R\202\032\241"
+	.ascii	"\377\264\245}!\265\223\235{#\227\324\217;\257xSj\020}%\240R'"
+	.ascii	"\231\205%u\272\034\023kj\244\376\220"
+	.string	"\300\330\326\233\017\035\"/\r\251\337d\214\330\306\244H\00644\004\261\360\246\240$t\b\0309\222\203\321\00161\347\007\017KAF\216\370\310\217\305\323\230\226\fG\255\224\227\006\366\364\307n|\274\345-!bT\207\335\260\2327s\243\016a\026\326\266,\352\335\037\201\334\306V\324}\247\004\f<\003\302k\32435e:\324!\312\3424\252\022\006\275 |FU\0225"
+	.string	"y\177C$p\031\025\f\2311\374\302P3\231\245\371\tuq\030\365\314\205\246\026\352\256\303C\220\t\f\206*M\215\213\017\212y\251\022\341s\005u\017\344\2211?\276\367HwU0\366\322\203\250l\325#\334EEB\004\021G\207d\016@?/zO\237\013zFw\355{\244\306\266\261@\003\265\261HVUJ\242\201\272\365\224hY8\230\371\365\270\370\222\277\263\253\243\333\231\003\333\363\333K\362\337\337\214~]\261\311v\002\201\322\250q8\345\220SfFDD$I\222Bc1\005\304 &%4;\021\320<\307\230\022\022\021I\222\244\320n\003\303D\255\316\347\033.\265p\317\224V-\236\322-\022\201Bh\254\347\256\036\314\245\201/\346\376\363k\312j\332 yK"
+	.string	"c\204$m\323\016(c\254\215\003&s\232X3\302\256B\037\023\305G\303c\332\256\200\f\346\273\305[!\346\264\237d\307`\034\002\221\026M\316 \377\371\273:\\\210\322\367\006YIw\241\023B:i\024\312\330\240\216\004]\024A\0312\355qu\233\024x:\3052*xD\022\325\333\224hh\330\233\257Kh\350&*"
+	.string	"\245\270E'2/\036:\177\370\320x\032\230\241SB\321\323\265x\204\240\031\t\307\300-\313\215\251\263\352\234Hk\237d\354e\355\321L\235\370\036\365\307\265;u\215=j\021\267\273\242\020\231_\032\301\243\217\324\316h\206\020\222E\225\350\301\312\017]sC!\357O\205\004\217\r\351R\034;\255\332\344\002\200\370&4\314\001\365\367\313\024\270|\220\004\366V\033\232\256\232\356\304\016Li\246\200\206\375\305\203E-:(\013\256\333XEMN@\241\240\227B\212pW&ww%p5{f.\256\026\344\201\260\271}\222\303\356&\353p\222\307%\2229.\032W\270\257\\]O\220\211=\324G\337^7\234"
+	.string	"\273\034\b\372C\252\b\325t\302\275\240\023}F\343HB\357\355\037$P2\320Ql'\007\033.\016D\017\362\313\222\350\023!\022\202\240\340\366\373#P\300\020\224c\301\336~\331\250]\301S\365A\264\031\221\243)j&)j)\305\036U\356\"5\362pcw\311\026j\007\236!\021,\210\221\264/(\030\275&F4\246\251\314\233\302bro\301\214k\263\202\311N\207\210\326\\\320b\003\244\003\035\301\214\003\240\007R\261+\323\366\326\037\354\325\267\313\334\227\371\345\335\f\317\233x\r\n\243ZT\347F\"\341\250\001\211J\275"
+	.string	"\302\226\216*"
+	.string	"HJtJ"
+	.string	"\271\222%\320m\307\340b\307\267\350\245\037!\350\351B\365\312\"\344\203eg\037\037R/1\020X\223\364q\241CG\"I!.p\227[3\333\240\001\317?\346\f\031\221\325|\006\\o\267\354\243\364\230\212c\r2dt\222'9\013yJ\3159\267M\242P\234\322\350MIK,\253\035\230\214\345\\\334\006c\216\246r\211`\027-\033z\261\347k7\333b9\006r`E\316\020\346\341\204\016\372\204\331\207\215"
+	.string	"N\356b!\202\0303\215\311Z\317\255\323\027\237YE\253N\260o\222\013b\223\022d\210e\nv[,\263\355\024\326R\365\017<Av<\330&\274\244\321Q\311\314\227\371\226y\235\003]\006\370K\302 \330\007^R2\326\023O\205\233\203\270\300\344o\320#I1\223\375\205\331\024=\206\200\215Nq\263\333\313O\263\203R\325\237b-\206C\327\317K\255\220T@/K\310\363&\232B\ts\313\344d\364i\003\352$M#jA\tQ\276\242\237A\235\325\345\307\201HX\177\013\3531"
+	.ascii	"\n\334Zmz\362\0362\334\n\004,\r,\233#_\3662\372\035\n\346\366"
+	.ascii	" (\307\276\365P\216\311\036Ob+\021\203\350\250\264\230\355\204"
+	.ascii	"\2318=j}}\375\251L\002\362\210ue\023Q\350\005\305\030{\016\271"
+	.ascii	"\330F\276/:H\223\002*\007\023\255\241\321\177"
+	.text
+	.section	.gnu.lto_mspSerialPostProcess.24.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\030\005u\037"
+	.string	"\226v\304I\200\234Q:_\035\361\323B!\034lk\004\246%X\227\205X\275;a\275\332\365\305\272;\f\nv\027r\277f\227\304b!\027\377A\250\037\333lb\345\"\313hnG\264s\236\024-\252\026\206\214t'\240\265\222O6\331;\311\254"
+	.string	"\235"
+	.string	"\273"
+	.string	"?WX!\322\343\\VO\367\247V\027g>\256y\t\006\226f\262\231\363\272\340\2701t.H\317\355\227\364\223W\022\274\362\305\003\344\354D\006+\347\265A/H\217{\275\016z\234^"
+	.ascii	"z\334\301n3_\221y\006u&\251\252\231s\326] \017\236\226\316P|"
+	.ascii	"^\033\354\327\214\302\323\236~\210\343\263\027Q:\342\030\223"
+	.ascii	",z*`\332\262\201cD:u\272\370(c3&Y\354s\325L\212"
+	.string	"\365X\302\3613\206\315H\264\367|pD\206\024\034\343\321i{\302F\352\313\333\031F\242\2653\n9\347\266E\343\322\273\366\356>v\367P7\266\005n\332^\333\375X\022\331\320\2265\201\367\026\372k\357\221\266\372Qzi\316\303\027\373O\016e\250\037u\334*z\366\305\343~\017=\256\335\337\263\n\351\310\221-\353/\377\201\207\222\030X\266n\272W\241\275O\335?\363u\352\376\372\276\335\352m\273\362\257\241\266\323\3246\232\332\3063\333'j\373b\333\026\333~\316\245\232\232h8,s\246Q\366&s\341)B\276\376V\267\335\357\276\223`\177\352T_\266-\227d\331o\362\252\340\255X\244B\245t\351%\366\225s&\221\036\357\234\271**&\300\307\267\004\325\230\r\027\343\303!9<L\207\004QNL\311c0_\360\305A)\255\225\032\366\312\324\026&\314\343\361%\006v\037\332\305W\240\253\317\345\\\036>\200"
+	.string	"\201\0363\350\n\003\2405v\244\262\207\227\363>\365\201\320\363\236)\342[@'\331QK\3209v\314r\336\003\277>\2064\361\272\367\251\257\242\367\226\240\362\"\3326\335=\342WTl\203\fI\316\031\202\225 \232\2211$T^\005\210\036\337\233\343\245\264Zb\314,\345gr'\237\002\314A\026\273;\305\263\2024"
+	.ascii	"\351bJ\346\234%\\\035Kh\307\343\241h`\332\264\224\323\201%\331"
+	.ascii	"\323\241IK\r\323vo\365\235\241\r-x&\2102\030\375|E4\243\337\214"
+	.ascii	"\350\202\252"
+	.string	"\362v\276\337\217\221\352\373)R{\267\366\231\360\300\307\001/\302\216g\300\211\025<\365\354\035\317\n\241\241\037O\r*R{:\242!\241\236n\367Su<\270\366\025\361~:#\237\357\247\263\255\371\024\206\367\210\266c\323\333\267\333;\304+l\2528\352\013\2335\351\245I)my\030\020.\212+\rX\001d\030\021\346\355~}\360\013\b\030\225<c\346v\rx)u\210\224\361\341\310 \350\n\333\361\033Y9\240R\003\266v\273+X\260/\366y\205=\3655\0256C\257\375\201\263\367vg\320`_D\357s4\021\257\360\314\255a\026z\237\230\001h\250Q0\007\025TJFD\342\204I\222\016\220\002\221\241+\017\020H\311F\223\024\213\001\220\211\304\f\347c.!\247\345uL\266sxd[\b\316T\276\306\222\013\202\231\032\216\3005\222\214 \034\005S\256\243R`\255\\G\352I\352\276D\232\331\301GyH"
+	.string	"\371\2606\337p\210-\257\250d\212\212&\356Z\334j\334\370c,\204\272+X'Yh\254N\032)h\334\222D\032\021+` \244\020\213\t\254\255wX\265C\267\3763r?\261\335\227\016\371\001\257\312\370x\254\207\302(|dz\272"
+	.ascii	"\371,\023O\227C\363$\213\276R\375\020I)\2274\325\267\334\222"
+	.ascii	"\240\306\nT9\335'\310WP8\322>^$\352\"\376\007\206}\361l\341G"
+	.ascii	"-\304zz\365\223\366\r\017U\302\250\001"
+	.text
+	.section	.gnu.lto_mspSerialSubscribe.25.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\356\006m)"
+	.string	"\352I$\020D`\336Q:\363\251(V\314f(w\205\251\354\270\203/\267\350k\240\3547R\036\341\352\376\335\261\f]VqE\233\247`\177p\202}\t\250P\313p\242\f\314. \025\037\376\232\023\327\377\266'\215\020\"w\222\001\361"
+	.string	"\341"
+	.string	"\362"
+	.string	"\313+."
+	.ascii	"\231\371\031\251\253E\255\227m].\263\314\335\333T\261>\r`\217"
+	.ascii	"\020\021\237\346c\235\312Z\317\364\3212w\357\215\360\224O\254"
+	.ascii	"GOb\243\375\270\033\261>=r\022\255e\376\331\307H\275\031\344"
+	.ascii	"\002\356\365\222c\273\2679\201#\254O\271\271^\314\313\2448\211"
+	.ascii	"6\2530\177K0e\231\272{/\221\301\207\352S\364\004\324\247M\205"
+	.ascii	"\327\243\315\363\317&\037\004\376|\275\225'TS\264m\222?\365\340"
+	.ascii	"\235G\307\346\354\301b\"9\360pYM\326$\261\277\006S\264\230\334"
+	.ascii	"\207v0\033\003k\2643\317\336\222\2667\360\222\245\304\256\326"
+	.ascii	"\311yL.<\\\026\227\322\252\247r\362\024\205\300%gK\310\274B\207"
+	.ascii	"w\244\370\3711\205X\324\307\334z\243\016\310\016\275\t\231Vh"
+	.ascii	"\0023B\254\334y\273dVY\313\373p\357e\213\305\324:\0038\363y\314"
+	.ascii	"\334\304\254\002\t<\300\016\2339\306\f{\254w\220.\253\236b\373"
+	.ascii	"\026\007\356\266\371\323\234\201\232\277!\027T\301bn\272[q\275"
+	.string	"\367fp\303d\344\245,X\270\312\260<\345\007\271\301\310\265K\013\251\311\233\262\n?\272\250,\"\276\363-\302\270\330\321]\213\210\2719e\373\213\371\354\026\006\246\213\333\213Y\351l\347\244\247\235\215R\313\b\216\366\017\337\374\007\260eaj9\370\2653\360g\371\307\263\354\343Y\356\365,\257>\313\274\236eu\265\234\256\226\321\325r\363,[\236\345?\270\030\266\272@L\317{\215\334%\272v\3226[\316\366\257\375io\346#i\021\371l\370m\374C:\302Vd\251&c}\212\244$\362\325\360\327\360\357)\322\2205vs\216\201\261>=\263\024\277\314\321\334\311\277#<D\3464\310\337\253\254\236\221\277\342Zs\337\227\330\234\035\0353\333\270\034\211a\334\275w\003\263\211\363A!<\300'\t\225\275c#Y\3236\034=_\274|w\217R\223\332\236\375^\3158yzK\252\332G\346\024\327\263\344\206\311\270\252]"
+	.ascii	"\354\f\370<\222\324gKj\251\267\375D\236\314\306\323\007\r\315"
+	.ascii	"J\004\253\323\302\353/\376\035,Q#G\330^t\036l\032d\370\3307\273"
+	.ascii	"\263P\231W\374\016\013\276\035\246\"0\356\315\221\352\323\002"
+	.ascii	"q\203\250\fm\340\242l\243\366\327\225\226f\202\322\376\3424\215"
+	.ascii	"\345G\251A(at\032A\007{\371'5m\032d\344\320\356N\333\022Rn\t"
+	.ascii	"@\273\025]\355Qj\260\273m\031e\231}\253c\324O;\003{vSm\033\365"
+	.ascii	"\025]\205\251\262w\266g\314\201\013\366\325\376\002E\207.^\330"
+	.ascii	"c!h\265\355HbH\234\335_\022\376\276\0272t\254\354\2415\234\212"
+	.ascii	"\235\3438\220QP(\220\022\306\036MG\265\307\216\250\247bZ<\"\233"
+	.ascii	"-p\300`\341\202QC\221\202\001(\244Ss\221\202\216\246\034G#r\006"
+	.ascii	"\024\322\211\270#G\223\023\261xD\022)(\340'(\343\221\330\343"
+	.ascii	"\351\351H\3745\357"
+	.string	"\333\213/\366\306\373\223\352\235?\261\034S\262I\223O\252\302^2\263\260\371\003UW1\224\240}\222\221P\231\223a\257#1\214\033\024\366k\346\244\330\013%\311\b\035Y\346\244Yr\214=\326\257ytU=\277\370\232\031\304\005\205\320\323k\017VM_\377*L\260{\335\204\224\213\272\254\315,\342sKv\316\237\265\025\200\235\331\347\0238^\373a\001<\026\235Q\363\332\256)\027Q\331;2;vt\n\266\314\306\200\375\305\275%>\245n9a\204\003{i\324\300\016!\307\312\036B\353D\001\362\007*\213\b\275\367\336\237R\177M\302\201\255\324\001\200\213\250Q0\005\031b\206\210D$h\222\024\013\007p\002\0219g\035\021pQ\212l![\007\205?_S\264\354\317.\202\255-i\211\263d\362)\231\303\336\315b\201\027\303\312\370f\207\361@\223\264\214\324x\024\347\261\353`d\262iV\223\273\325fM\031\324"
+	.string	"\331\351\361c\313\230W\362\324|^\375\017\262\332P-\220C\221\231\204\272N\022:BI\337o\217\002\247~\016C:\315\0361\337\342\256\020(BY\250;`\213\006\034\265x\244:\352H6\266\277a\322\031qz\266\020\2535\346\232\324\353n\263l\034<\321w\372\022\3305\373\b\261\321\347\263\324\257\355?\324\253\214\236\241\374\273\227\245I\22428\332\270\262\310\245\003o F\341\252D$\334\230\221\355\314-<\247\367\321n\347\0054\037\323\203\020\006\301\006j\177\311Ql\032'"
+	.string	"\212\377P>\314\336:\3207WXW\f\377\310\355\326:P\276\242\236\252\232C\214\327Y\003\263\235\311\212\031R$$\310\311,m!\227'\341A\221"
+	.ascii	"\366k4B\r"
+	.text
+	.section	.gnu.lto_mspSerialProcessCommand.26.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\204\002\r\024"
+	.string	"\266\244\203J\240\024R:9\264\202\363i\225\205\213=\321s\350\234\260\344Va\213\230U\024\234\030\343\252 \031\326\205\352\253\332\255t\357J\371_\325}\226>A\332\002F\207\341\364\372Sz\247\004\306o\241\326\2128%\007\177,\277\335D\356\224\002l"
+	.string	"j"
+	.string	"q"
+	.string	"\324"
+	.ascii	"p\234\323>\322\223|\336\343p\224Z\213\210\330\250\265\227\300"
+	.ascii	"\b\304S\367D\333>\214\307\360\361O\3303\342\301\206~BMEj\255"
+	.ascii	"c\313\005\264N\303\253\264N\027\305\177N\303\235?\276\3564\206"
+	.ascii	"JHX\303#X\362D|\303\230\250\352\013\300\333\205.\027\301\026"
+	.ascii	"\207\372\034\342\005\315\351\232\251\265z\226\274\020w\353\266"
+	.ascii	"%\330\336`\317\243>\324I\246r\374\2503\313\356\351\346\236\260"
+	.ascii	"\037\326Z\253\267\310\366t\312{\277\211\247K\376\364\303\356"
+	.ascii	"\364\223\\\351\177\235\351\027=M_\323\2418\275\256\351\331\232"
+	.ascii	"\276\n\001,"
+	.string	"\037\025|\265\202\b\032\251=\250\024\013\333>6\314vY1\322'\r>\f&\234\232H\334\020\215!\023OU\215x\352R\216\253\324S\340\244\356\226T\320\210\017\236SW\313\364\333]\205\341\246\354\254\022\002R\205kO8\016\n/\255v\303\235G\204\200(s\256\311\3326\261\371r\267\245\303\352\354\337\320a\371\225\266\354R\263\323\007\277\335\250\222h\307\201\226/\003\216\211\321\fRZ\001\230\322\341`D\326\207\005rZ\353{\2634d7\261l_8\r\032\003\177\206\rG\254\265\376\350\324\347i\235~WR \001\315`6\232\035\362v\322\223\203\233\345\250\314e\243\261`\213\325j7\b$9\223\335r\021pdM\30502\013`\024\314\032\310^\006\340\310\332Z\366\222\023\243\345f\244\r\216\254\2156Z\2546\312r\344\370\302\342\033n\226\033wn\267\334\b\263\355^}X\267\310:I5\302\222=\324_/d"
+	.ascii	"7e\351\016\331\246\353\031\240\r\242+\023\266$+\256_[\2622%<"
+	.ascii	"\254.3 \300\002!\261\363\351\034\305\255A\305\360T\346\312k\004"
+	.ascii	"\275m\tRVho\315I-M\215\207\254_\033\001L\367#z(\260d\261y\016"
+	.ascii	"\353jx\342i$r \263\301\206Z\246\250\344\204$\220\354\230(\245"
+	.ascii	"\024!i#\254\n\032\363\232\3702 \n]\366\310p\033{\233#\204a\241"
+	.ascii	"\313\034\221\022+\032\322\211@n\360\243#\364@\326E#@("
+	.text
+	.section	.gnu.lto_mspSerialProcessReceivedCommand.27.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\230\007\325+"
+	.string	"*Jx\020CP\346M:/\356!/\006n\004\002\205\361\373L\307\227m\317\027\227~)\214\321\352n\024q\201\364\234\036\316\354\237k\341Z'A\0209\020/( \2600"
+	.string	"?\320\315\3663!\353\t\373F,!d\313$\003\356"
+	.string	"\343"
+	.string	"\374"
+	.string	"n:Z"
+	.string	"Z\036L=\372\253\371\232\263\275\355J\3765M\201#\344^[\336\024}\306\2660\272{\223>\310\260y\233\365n\260~\277\214\224\310BFw\257\021\242z\264#4\255\0012\257e\235wI\362\036!\316\335-\247\342"
+	.string	"\217\346i\326\253\365`\352J^\344\214?\3112\023\2162\f\365(\323\331\244\004\330\311\037\b\004\334\2564h\"\324\243M`\3007\363\313\334\314\3724 \037p\257\331\335\362\336$\005\236\240\036\345\344\225\322\243\352\013\244Gye\026\364\344\331\355a\3113\252\271\273\367\002\255\225\257\357\245\350i{\345_y\337\021\251\365\236\222\247?\2441\t\371\325\350Y\200\354M\237\277\275\213 \215\247S\237.L\274\372\024\273=%\320\271\035JBv\235JaZ\216W\276\301\220\\\335\275\016\367^\356#\362\310Y=3o1\263\030soG\350-qn\316\037\266fv\221{\323\317\337|C\224\255V\304\315,\223\273\255\210-\243\274CH\231G\\\031\305P\350\230\332\235\335\236\242S3\356r&"
+	.string	"T\271\031\216\352\351{\256s\342xV4\225|;R\27515b\356\335\372\221\317|\035\024|\264\243\254B\252\177\224JY\234N\221\241\230]\\\371\202\241\216\3768\026\2439\360\345\034.\006\037\215\257\224\301?\036\025p\032\351Q\003st[\235\307JnF\360\352n+bNj\265\245\302\374\363Z3\346\273\235\031\\\355\274\364\344\237\340i\277\201"
+	.string	"\315\277\244\346#"
+	.string	"\315>"
+	.string	"\315*Rs\357\327\234\372\232\321\264\371<j\266\276\346V\233\377"
+	.string	"\312\f\212\223,A\254\237\344\r\313[t\343\320\267-w\373\325\376\265\337\315\017\347My\200\374%\377\215\177Mq\001JV\262\265I\377\2706\261\252=\357|\201\341z\373\2070\ru\237.dn\250\245\202\367\336\327\336\263HsK\n\311\255e)\363\372\244\217k\231\212\244tf\007Gw\002\333\351\251\235\262R1Z-+\375\265^Aj:5S\353K\023\302%\361\352$4w\227\224\006/gP\3124\327\262\265\326,HM\007g\353\226\225K\377\310L^V\213\221\230s\344~\226\210ni\271G\272dk\244\371\323\325\211\270\231prK\366jgz\320_~\315\372E\371\345\331d\250\t\254\2010\353\230\376q\311\022\020\273K\254\026+\301]\274\272\254\364kW\320\264;\203Z\346\225\314\331\242\030\312\314\021\241\026\005\323\206\227vZC\326\336\2366e\364\345\205\313Z{c\243\255\316;\363BQj\333"
+	.ascii	"kmc\322n\t\261\315)\217u\203\206\n\232\367^\017\027\004B\275"
+	.ascii	"\367B\005j\021b\301\031\032\220\364\001<\2046\252\242\256\210"
+	.ascii	"C+_\217\034VB\"jcJH\342\006\326\207+\254\341Q\260W%\342\2528"
+	.ascii	"\024P\304\272\232\272*\246U\"lTMQQ\rA\024\213\302\340\220\230"
+	.ascii	"\302\252HU\200+h\270P\301\202\020C\360\351\200U\221\312r\360"
+	.ascii	")\307\024\016\242\260H\303\252H\005\254\3021E\005\f\022\213\300"
+	.ascii	"'\005<\264\022\022\201W\303!\021\370K\336\237\327\232\305@\022"
+	.ascii	"\267e\2718k\215\016\315y\257\024\016\207\363+?\200\016M\347\365"
+	.ascii	"8\364\204\377,\363\312\265zqG\231Jj\226\255\306\013g\375\244"
+	.ascii	"\241\254B\300V\"D\322\243?\373\343\030\326\2348\274\272?\230"
+	.ascii	"2\t6h"
+	.string	"\222=5\355\222\230\212\370\220\224\346\2304\230\036Yb\207\036\013\252\334b\235d\rC\256H\220\244G\217\254\203+ox\275$}$+\311\3629\326!1\0211\260w\363Y\006\266\357\030\033m%\317vR\325\372\354\277\354pu\330\332Dm\"]d\r\200\243\250a \007\231RHQ0\"\"I\222\244\003p\002\021\2313\363\021\220\261TU\232$\313\001\3058\302D\354\270\243\n{\276\352\203\227\ty\301\227]s\202\203s\321\350\271T\261\371\273\351\231F\356\232!v\277\350\371G\311)\355\020\261>\375yy\222\206\267\276)'3)\001\303^\n\234G\345\343\203\321\247=\032\277pa:\227=\233\305@I\343CE\302\211\274\354d6\254bH\350\266r\037\"\276H\214#\206\3407{\313J\333\315\fGB\034\265\234\362\264\331\307\227\207}\337\343\361eE/\302\2170\342W\237\266\224\205\256K<\207P\323\017"
+	.string	"\272\311\204e\323\266\332v\220\332\243&K\210#\345\025a/\034A\330"
+	.ascii	"5\037Z\"\343t\356(\202\327)\206u\331\305\260E\374\277\231\234"
+	.ascii	"j\350\301(\342<\325!w.\277\346l\323Q\001\030:\333\234\341\314"
+	.ascii	"\033\003\0168p\203\220\272\236\333\016\227\233$\013\006\023\376"
+	.ascii	"U;\366\277i\310\264A4\210\302N\373\210\303\322\273<\277s^fA\025"
+	.ascii	"q\313\335\325M\207q\371\341F\243%*\035!\225\004#\271\342\203"
+	.ascii	"\013t\275\305H\211Ty\241\306Q(\206\373*;V^\020h\3409\b#5\030"
+	.ascii	"\255\031\215\036\037\366\03077%zj"
+	.text
+	.section	.gnu.lto_mspSerialCanProcessCommand.29.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\233\005\345\""
+	.string	"\366}\333Cp\350Jc\240\037\325k\225\261\230\005\036_'C\223\177@J\030jOQ-\024qb\316\376\221h8\243X\370'{\220No\220"
+	.string	"P\005\210U\272\344\337\351.:\031As\222\366\023H#{\357\275\245L)\304"
+	.string	"\272"
+	.string	"\320"
+	.string	"%\220\274\024+\273\367\362\366\225\335\263\201R\222j\265\177v(W\217\"\343A\367\222\335m\2717-2\021\372\322\351\205\314\227\350\003\230/\221\034\\\031\353\351\220\257\323\353\fW\225\273{\323#+\304\366dz\363*\326{=<\3644}%i+\226?\343\275\223\251\370&\257\2728?\302v\274\207\004\322A2\310\262Uy\006\202\204\3458J.AyB\304NI\003\363%`:\352\t\007\206\203\004\336{\317\306U\315\034\367\035\016\214G\371\341\216\223$"
+	.ascii	"-M\266|\2104\310\242%jwzD\255jI\005bel\370\020\263H!4@\346^|"
+	.ascii	"\255A\324\252\365d\272\367\272v\021\303\356\337m\317\261=\302"
+	.ascii	".'\004\357\262bh\210\ru.-\320{\265\036la\021%`H\021\031\346\313"
+	.ascii	"\333!\"Q\206\365\350\027\017\302\r\314\216\234[\361\330iV\265"
+	.ascii	"e\366\355\361x<\332\222\331\256\016\002B\253\177\320j\037W\377"
+	.ascii	"\276v\373\036\345\357q\365\351j\363\254&\315j[V\037\200\322\233"
+	.ascii	"\030\017#nl\233\364~\035\363\334\267\262\013\222\257\375\366"
+	.ascii	"},\327\342\263\271\347++_\363\263\\]\315\266zj\002N\316\304\316"
+	.ascii	"\356\275o\222\216\345V\374+sW\254\236\006\343w\013\214\367\345"
+	.ascii	"e\264\2737\375`&\351V.\305\257\002<\223d\277\212?\345hV\247b"
+	.ascii	"/@\255\364\022\227\346\354\316\356\356\275D/\215\001}q\022>G"
+	.ascii	"\201\307\346\215\\\234\217M@D\314\0333\343\331\366\237\025\242"
+	.ascii	"\311]\315\301\267YQ\232\315=a\263\246\251\307\246\315]\232\253"
+	.ascii	"\201a\276\374Y\2418\037\031%p\227\314\257\345@\343\321t(\320"
+	.ascii	"u5C\375\255\302\222\233{\357\203\227*~\246\311\204\031\004\267"
+	.ascii	"\233\271`g\320P\337\245a\203;\240ca\007x\204a`56\254x|\266\243"
+	.ascii	"k\304\330\235\311\027:1\323\226\371w*\367\226\304g\311\316{0"
+	.ascii	"I\213\002\315M\250Zk\207\020Q\337E\332\2441-;\3036\211\207)a"
+	.ascii	"-\002!\267\324p=\352\276J[v[\274\341c\013i\313\374\023f\2655"
+	.ascii	"\210\323\275<\241h\265Eq\257\\\350\240\031\263\266\314\3072o"
+	.ascii	"Q\240\311i\325;\266\203\001QNAa\025"
+	.string	"\225\031#\230\342\305\205*\241\324\024\317H\021\032 %\005\225\236\214\006T\t\2458LQE\235~2r\341\004%\fR\235\230\242\212:z\001\345\024u\364$\244:2\032\262\324TPxT%%%<\352\245\303\223\327\222\371\364\252\3432\366\230\366\3057\321\311\245\031\311\267\375\2645\254\231\2066\213\274\367\336\236\332-\320\225I3\362\336\366\263\035\003\235\2304\343\371c\231AA\326\264E\\:\206\365h\027\217\322q\263\263c\327c\313\374\033\203\002Y+\347#\272\317\326(\272\317R(}\374\360Y\246a\305\363:,\3046\036\220\375\332\201\013\356\263@\366[bYY~32=~\304\214\022 \350\217\365\261\257\203V\006\253\3708\024~u\354\352\340\374X\245q\250\221$\302\020\203\006\315\214\210\004\243\005J:\240\002\221!$\017\020hG\222$)f\f\223z\376\307\362R\022\001\206\316\006ML\240;A\3500"
+	.string	"Xk\242\230\204'\026\346\203\001,\274\350P\330\376\f\227\377\227\340\f\006]\034c\307\3707\253\027]\020\351\3637\253\027[]\247\224\221\265\332b\031\001@TV\rd\262#\177\022I\017L\317\204\021[\203d\274-\033\024\031\260XiM\030@\r\233\205\002"
+	.ascii	"\320\361\0225\247p$\307\022&\323\270\005\317\260\207\247\223"
+	.ascii	"\305\t\366\303\031\032V\304^\301\321\027\347\355\2665\310\357"
+	.ascii	"\t\343\0251\261\351A\224\037m^|M\247{\314,2\312_\366\b\214\340"
+	.ascii	"=l\300\353i8#\312\315\316\275\311,:\030jS^\336\017x\315\260\222"
+	.ascii	"E\354\315\030\031\275.GOh\204\3602\361\355h\352\036\326\213*"
+	.text
+	.section	.gnu.lto_mspSerialProcess.30.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\363\013]D"
+	.string	"\352u\\\032>0bR\007\353\207>t\220\214}\025t\035\362\201\f\253u\364\265\253\f@/W\226\273~\3435\202\242}V>\0030\004v\001"
+	.string	"\n'G\252u\016PKX#\242P\222\016'i{'\231R\224\001|\001\230\001\376J\3559\333\355\332\333H\305q^U\230\372\235\3271\366bt\243\207\304\313\331\370\350\206\375\315\276\246a\251:gw\035\220\343W\365\210gF\035\214\343,\225\277\255\325Re\2349\353i\246\256&H\324R,Fw\306\305\321\337\316\036\245\332\234\236\273=\316\345\246>7\244\221\342\370\372\267\027\307Y\bMu\364\267\351\313\242\277\256;\025\375\235v\027\362\354Z\354zE\312\326\030\306ql\365Z\262\311f\352w7\353\315t\247\016\305\\>951-))\223H8)\n\351h,\276\356\347i\273\321\303\032\317O\374\320\001rc\375r(wi[}s#\264\t\313\314,gn\276\\\313Op\325\266m\265Kvr9\314qb\346\333*\0277s\t$t\270j\227\334\3446\373"
+	.ascii	"\313|[\335\342JaI;\364\274(\231\251x\306\346K[\\\351z\266\346"
+	.ascii	"J\3278f\346\346\333*\232\213\001q\220\317\265Rr2"
+	.string	"\313Y\025GN]\317\2508\354:\030\214\243\310\267U*\356\322\314\215\352{|\n\256:%'U\361(\227\351\212 :\357\363\251m\265\214[\245\207\211\\O\301U\3232R\236[M\371rt067\302\276\255B\311EW\200\031;5\245\265\314E`g\006\020\266\222\345\327\370fFx=\353\342\256Ka\220U\212\322:\346\302K\n\375\361<\317G\254b\371\275\215;0\004\214;\274\236\271y6z\210\343\2703\325z\346\r\300\273\335Pw\233\351N\352\020.^d\247\276(\372;\365\357Gu\262|\3777Q\231#\260\374\250=\317\035\211v\312\266\355\316\334\271\375c\275\212~\347.\324\274\215\273b\256Y\033e\333|\257\363&XNl\247\334\r#Fvj\363\275\211Z\330\177\365\222P\355\2600\316\211\335\331\260\374\330n\207\232\203b\326\217\245\373j)\267\004W\343^E\345s\356\r\034\320\233\201\327\361N"
+	.ascii	"\347>\340x\336S^\347\335\204sC\271\2377\323\357\274\227K\271"
+	.ascii	"\237\222\271\233\224r3)\345^B\346V\202s+\225\271\223\311\334"
+	.ascii	"\310dn8\231;\t\316\215\244\314}D\3466\302\271\213\311\334n2\367"
+	.ascii	"#sg8\267Op\266\241Qy3\362\200\262\261\331#F1\340\313\367\346"
+	.ascii	"\200\356~\356u\334\363\270\343\271\337\271\327\271\261\333\233"
+	.ascii	"J\234\355\177\355{\032n\232\001\346h~ec3\"\210\201\342\f\343"
+	.ascii	"8\373\345\350o3\314\331\256\247]\333\024\363k:p\364\332\006\337"
+	.ascii	"\004\235m\307\373\0049\373\216\343\231z\036\3501\366r\342-m0"
+	.ascii	"\216\253\\\216\376\272\261/\213\213\352D\233b\331\330\332\003"
+	.ascii	"1\033G\205\3659\335p\373\3607\355{.\307\301\034\026\264\2708"
+	.ascii	"\216a\2768h|q\020]\351i|\027\273m\206\3318C\006L\234\306\354"
+	.ascii	"z>\034\016\0177\033[=\356\r\025\316\260\314\317\331\356\246="
+	.ascii	"O\353\354\306\223zLVERb(\311\364\030N\206\026\246\365\244D\211"
+	.ascii	"\262\207\205\310\007Y\371JlS.\331\251-U\033\373\257Lv\003\210"
+	.ascii	"\034 Z\\\036S!#.\fZ\\\026S\372\r\201s\311W\376\277I\276\333\261"
+	.ascii	"\361\r\320\022:yS\304\004F\276o\351\004\341Oz\344\273~eP\302"
+	.ascii	"|H\261\301\303o|S\306\307\340\223\376\337\224Iaj\377\030\274"
+	.ascii	"\003z\263AF\372\267\351\227\354T\006\337\034\373\257>>\322\277"
+	.ascii	"tVx\237\327\361\370\3116\264.|\276\307\335\211\266\257\237\215"
+	.ascii	"\2351k\322c\333\035\303\032\342`\324c\351h1\301;\034]\340\223"
+	.ascii	"VN\202\177\242 C\275\353\361\276\251\030\257[3\222\231\232\311"
+	.ascii	"NM\360\376"
+	.string	"D\215\354\277\022o(\225\315)\203xh\374\r\235\365\246S,>\324\273~d\210\302\362\24360\225\233\242\311N-~1\255\013\354m\343>w&Z4\276\2077\250\021\222+\350O\034\231\334\304\b\260\360\370X_\020\305P\035\243#r\367\363\030\251<\365\335\037Bd\247\272\357`\324\304\376k\212\312\366\256\370,\376s\321\t\216\360C\317\002k$\274\260\304\313&\317\320_\302\301\377\002l`48\331\273{\037\313\207\217\036\264\370\257\255\324\246m\343\234\350\310+\213\376\2707\212\371\271\350\002\3052bw\233pB7^;l\312\304qla\220\n\030\220\235\241\240\013BQ\3647?3p\016\251\255\262\235z\307s\037j`\036\b\205\202@\324\356\026\342\200TX\255\305q\214\301\217\377a\321\336\346o\0075\236P/\351V4\353\250\3456\274h|\327\226W4\353\245\341\215\243\352\t\325\352\262\332\212B\241\321,"
+	.ascii	"X\336\305\0255\376x\326\330\"\321\305\025\335\201$u\361\204j"
+	.ascii	"\265\350\342\302\352\222\302[\"jlaA\241\321\017R\3513+\312\225"
+	.ascii	"b\207\024\352\324W\031(\\Mx^\310\252bbua\201\330!5\261\025=\361"
+	.ascii	"\354\302\362\322\201\325\343\331\324YU:\260\264\270\236\322\031"
+	.ascii	";\244P\253--,\250U\026\227\324\252j@Gw<\271\254\272\242Q.+8\013"
+	.ascii	"\346\217e\215\2078\364r8\b\366aP\217m%)\313\253\177\267d\347"
+	.ascii	"\343\313?\362AP,#\276d\356\374\f\001\345\230\217}\277\363&\230"
+	.ascii	"{\025\227\177\005\373!|[\036\372\264I\361\300\277\033\235\237"
+	.ascii	"\363yS\317=\317\221\330\016\253\207\203\022\376\300G%*s\324\374"
+	.ascii	"\247\227\360\001\022\221y\231\343\357\243\253\034G\"$\205\211"
+	.ascii	"\237C|O\357zO\357\242\302\337\022\n\271\352\247\242L\2474\225"
+	.ascii	"\177\326l\007\320\221\276\247\246\177A\ty*mj%;\265\351\275Q\237"
+	.ascii	"B\206c\234\262\022gz\277\236M\261\030\344\006\255U\246\037\300"
+	.ascii	"\346\265({X\230\013\307dIlzl'\371\024[\\\372<fz%'\231b\215d\364"
+	.ascii	"2\222#KO p.\213Vn\313\237\025AL\037\266\006\256\311\222C\271"
+	.ascii	"\026&Q\202\272q|\355\320\347L\203j\362#\345c\033\316\203\244"
+	.ascii	"z\343\226(*g\376\221\004\317\374\017z\3042\342\373\344\312|\017"
+	.ascii	"`9\321\3358\216\343$\325\273\337\003g>"
+	.string	"\325\007\200\352\250a$\004\221c\b\315\214\210\210&I\322\030P\002!c\312l\033\020XG3\223\024\322\030\276.\325\240T\t-}\356C\327O\207R\360\300\273#/\212\350\336\001y8QJ\351N\263\274\224\325\"\331\374\005\024\221R\342u\232W\212\232\222\273\341+\331Tm\026\317\335@\364\t\375\2730\261\236\312\225\307Ax\273\2117a\304\310n\035\316\216\341\212\273\204\357\307\241\254Q\331W\227h\252\332U\326\260\205L\030H\221\212\265Dx\236\007s2P\007\224\347\037\025\244\202C\232V\277\020\232p0\013\235\021\202\031\223\301>\t\361\177\020\365\0350\237\376\255\003\327\032Z\006\260\032\r\234\177\261s\242\030\027\214\016\300\323\372;]\325\3270#T\265\363B\274\316\263I\340=}7\365\253\365\341d\260\320x\231%\020\n\213\332=2\252\360\r7\303\267\345\375\243+\201|g\373\206\304\266\327\032\342\371\303\3140"
+	.ascii	"m\377\2230\301>\344\003\004Y\007\346L\333Vp\036&\333l\267\344"
+	.ascii	"\032\022\031\246D\212\373\244\016\201|\226\224Ax\005\025[\004"
+	.ascii	"\245\"\346"
+	.string	"C\233[\241\363\341@l\310\321)\t0\242$\363dL\224Y\235\211\f22\315\337P\335\207\310\202\2340\310+x\273\003z\375\335\234\237\336JN\305\371\360\224\f[nMx\235\321\236\370\235\314\026BB2\322\366\330\226\205\276\027\343\311NDl\344\b\b\t\002\363\261LH"
+	.string	"\201\202\327a\302\266\345\304P$`7\027\n\362\200\251\205\306\304\242\004\347!\327\314\343\226\325\217\357'\212i6\271\tV.{7s\230k\372\265\036j\230d\350\274Ky\301\317e\314T\251\303\245\341+\365\0226,@\221\336\304\301\310\365=\322)\363\027\3109k\030\021\031\241"
+	.ascii	"J\346\227n=?\205\002u\251`\220\013\013\377\203M_FQ\001"
+	.text
+	.section	.gnu.lto_mspSerialInit.31.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\323\001\005\021"
+	.string	"\006_oH\340\262(\035\314\n\211\202\342`\325f\301\204\007\002\240"
+	.string	"\246G\006D\022\3218YQ,\f\302\001\220\236\355\177]\365\202\210\246\273\001\270[\177\3152\2141\232\343\234\324\367\262\022]\006\207\3314\324|\277l\224|\262\211\334)\005V"
+	.string	"V"
+	.string	"^"
+	.ascii	"\237\246\023\360>\273\017\360>O\362\314\356\361\261f\317C\003"
+	.ascii	"\304\316\217\335\005\365\204\365\335xwr\366\331\251\234\371\242"
+	.ascii	"\024\316\017\b\001\2117\332g'`wEn\037:\005\322\345f\223\235\r"
+	.ascii	"\314\365\343\021\b\335\020o0\227\242\324\356Z\212\267\227\333"
+	.ascii	"\273\355\320\266\004[\206\004>\212Ok\220\311\213\237\276\314"
+	.ascii	"\373\2649t\220\027mjQ\232e.F\307\312 {\244I\245\261\377\325\031"
+	.ascii	"\373;\356\376\250\224\223\203\005h7\304P\220\365\2315R\034\367"
+	.ascii	"\333/\275\224\3709\376hRiD\311u\316bv\234m|4\021\337\013\236"
+	.ascii	"\036\037\273{\372\364\351\013\372\351[J\330\344\220Mr7\024T'"
+	.ascii	"^}\006k\244fwMl\263\\F\253\304cw\033\300x\f\013.\024\024\357"
+	.ascii	"\323\333!\222\250\311!\003\310\255P\335]\232\372\364\343\376"
+	.ascii	"\300DM\006\371\343\273\033\231\222\212\221\264_\030l6\236\024"
+	.ascii	"\2157\016\357\364\347|G&R\263[\273\350\267\270\213\f\001&q\300"
+	.ascii	"\200dA\353\204\205*\260\241UA%\302J\370\202\215\314B]X\271\302"
+	.ascii	"VL\005\213\245\200*\256U\n\310\nc \312\200_\260V\b\256\274^!"
+	.ascii	"H\032\367:c\225\216OMm\023\216\363\220\034\316T\032\007\350\321"
+	.ascii	"O\365G\236~u\031\371\025\302\217\007\td\306\310\254\246j2\350"
+	.ascii	"]\367\351q7%\370\003) \200\202)\233\271\003W\230}6\006l\253>"
+	.ascii	"Y j\367\006h+\205$\013N|\\,\221\264\367d\253XV@K\374K\001HXW"
+	.ascii	"\306\340\243\034\266\315\016\214\360\254\230\310\212\204-\210"
+	.ascii	"\326\364\006\025\361\273\343X;\026\343\324\226\007\262\022l\323"
+	.ascii	"o\023\3011\3017\334`coo\300\227r\347\202O"
+	.text
+	.section	.gnu.lto_mspSerialPush.32.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\363\006}*"
+	.string	"\312K\230\020BPdN:\035/:\361N_2\250(z\236\363\342\354\312\324PE\336\237\216\031\035\225\226z\355\2109\203\261Y\2370\3517EE\344\200\250@X\001\3423\250\t\032\274"
+	.string	"\336\210\344\206,!\204\220\275\223\f\365"
+	.string	"\344"
+	.string	"\006\001l=\236\273\300J\230\025\312\313\031\314\351h\263X\217^%\204'\245\303,\354\275g\323s:\230s\262O.\347\374\324&\326\243\3031\026\337\356+\257\246}\332\217\023\310\231\312R\204r\035\206\261\367v[\310\320\036m\253q\316cf\344rV>\265\323z\364f~\246\355\236s*\313\2207\273\363j\303\227sf\233^ =z>)=\212\2574\376\251|\013o\373#\241QpUS\364\304\267\355\253Qo?\317\304\344\254\261sCr\375\350\034"
+	.string	"\345\244 \344\n\325(+aOn\324\013\202bk\035X\223\263\351\013\230\330U+|yI\317\013D\370\240\004@z\235G~^~\204\310\256\213\252f\314C\3110'?O\f\204\220N\002 \211\234\302$\206"
+	.ascii	"\035\316\357\027r\310\305\217{\204\246\2353}\311\260'\277jT\316"
+	.ascii	"\271\357\021\031\366\006\360\3566\324\335U\335\251\221}:)\225"
+	.ascii	"\311\336Y\316\306\037\373w\216\007F\177\313\321\316\222\272}"
+	.ascii	"\251\364h\267\214\327\231\321P\335So\243j\250\243?.!^\017\375"
+	.ascii	"8\227C\354o\351\267\335\350\037\217\016x\216\364\250R\240<\343"
+	.ascii	"m\366]\3229] 3\336\277V@\247\256@ Y\237^\276\177\335J\256\213"
+	.ascii	"\253t\277\233\315&\2631\225n\246\245\263\371\225\236\366']\356"
+	.ascii	"\215t\264_\300\341\336\253\232\032\335F\203\267\317\273\275\361"
+	.ascii	"z\373\252\267\177 UB\306w(\310\233\234\2214\001\363\036t\316"
+	.ascii	"\354r?\334\317\366\273=\275h\367\207vl\377M\037N\013\207wl\267"
+	.ascii	"\034\217\340\021<\300\274\234\2256\360\260}7\375\270\026\036"
+	.ascii	"\035\322\301\255\275\371\213\261\036}w\333o\373[\013\207il\267"
+	.ascii	"[\317Y\271\300V5\263Ay9\347\027q\254\332\327\332\007\230\253"
+	.ascii	"i\224ip\225p\022\376\334\375\3321G\303\262\226Lk\346\376\330"
+	.ascii	"M]\230kLp\n\240\027&\031(\311UG\212\342\342\032A-\232/\3221,"
+	.ascii	"\3536\315\025}x!\266v4\021\"\024\017\245\034P\357\214\215\212"
+	.ascii	"\300H2\317\357\352\230(\227t\271\223*}+=A<ok=\036\220\020k\316"
+	.ascii	"\371\304\t\260\240\261\325)\271h\212\330EAq\225>\3153c\031';"
+	.ascii	"\3002\360\235\266'"
+	.string	"\346\347\274J/.\256\t4\344\372u\367\210\027\272B\3530\371r\316P\204L\b\355\230g\202>\210Dz\364b\003\201\320\216\226\177uH\370r\357Af\374\035\t\007w9g\253\333\231`\313\376\034\320\t\024*T\244G\2210\326s\\r8\277\221e_\035\3169s\341v\352@f\214\373\031&y\227{\307\335,\336\326\242\241~\324\023\200\217W0\361\274\230u3\236\312\226\347\263\005`-o8\272g\370\246sq=+\230x\001Z\305\253\024XYU\252\017b\r+\022Z\305+\254\240\026\261\210qd\361\300:\255\210;\324)\255\251\032g[\340\200\301\302\005\242\006\252\t\006jTQ\341\246\232\260c*G\221\2305\003+\253\212\265\3121U\305R\025\263\330\t\b\372\n\213Xd\265\256\256\212\254P\231\377|\nU\214\361\027\346@f\304B\272\307\231s\322\303\331\376\274\264\267\033\251)\001\353\323\373\021\256\322"
+	.ascii	"\360\0301\341\307}\355k\256\370\253O\243\024\377\355\353\237"
+	.ascii	"@\264\353t\025\177=}\305 \004\r\271~WT|\267^\357\375\373\231"
+	.ascii	"s\316\302U\305}\236*F\242\226\204\031\\\302}\246*N\361W7\023"
+	.ascii	">\334W\314\204\3375&$\356\027\263\334Kq\224\361\376]\243\321"
+	.ascii	"\022\276\333\233$\\\247\377-\226\364so\273\261\"\341\356VK\313"
+	.ascii	"\345\376\270\204=\220ya\2564\020\356\347n\226zp\327\374\334\003"
+	.ascii	"\031\334yi\301\020\t\200\216\250Q(\306\230c\244HDDFR\3304\006"
+	.ascii	"`\002\231)4n\020`H\232$I\007\020@\326\353\374|N\327\324\006,"
+	.ascii	"\223l\362\031\375\332t6\212Aq\256\213\024\315;\032\2713\367\312"
+	.ascii	"Y\036&\316r:\004\344\207\363]\314\352K\225\253m\347)VZ\236\b"
+	.ascii	"XE\311*\367Y-~\333\227v\222@X\027\206w\2320\321\224\351\005\036"
+	.ascii	"g\031\313D4\316-\211\350\327\376\243\261\304M\201\004\177}\221"
+	.ascii	"t\367\367F\0161a\235\307\177\fX\277\272d\346\303V\364\274\341"
+	.ascii	"\030\202\214\233/Z\021\240S\004A\237t\232 \367\342ll\313\373"
+	.ascii	"2\321\216\025\333/\306\307KFX\005[\327\373\245\301U\f\240\257"
+	.ascii	"l\256\267\335\t\243$\245\202s\204\211\031\021X\372\256\337\262"
+	.ascii	"\277\036\223\214\207q;\207n\030\310A\r\n\334\253zEP\253\020\026"
+	.ascii	"$\0339\026\033\350%S4\212?47)\022\327\007&}bh\rw\031%\345\242"
+	.ascii	"9S\231\320\275]\354gf,\376\3771\352q\360\003\230\030\201Q\321"
+	.ascii	"\231p\371\360\375lM_\342\375\001"
+	.text
+	.section	.gnu.lto_mspSerialPushPeriod.33.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\266\004\235\035"
+	.string	"V4\270I\240\230Q:\240\331\3654\002(\205\236\247\177:\261%\320\231\247'\"\300\203\246\316\310\026Z\035\027\026\360\323\361\320\347\237\300y\330\357iZ\232\362I\374\244\3003s\35405-\346\261\277=\035\270\245\232\t\262\355I#{\313\235d\240"
+	.string	"\240"
+	.string	"\255"
+	.string	"\033\314\3333\373\360\2338&\263\252\375\330\373\035\336\317\340\201\244\024\346\336;\273\345\231y\3137r&\037\356e\200\341\023\326\220\202\304\210\322\272\367\322l~\240\274\255/P\336\266\017\356W\344\371E{\207\275LWik\323\036\337\225\323t\f@\301$P\370sX\0350T\037"
+	.ascii	"\321\227+\247\307\260xS\201\321\220xW)@\370\213A\255\315\275"
+	.ascii	"7&\204Ak-P\254\302\372y\203X\035`%\r}\3524(\f\242\375\247{@*"
+	.ascii	"\"\306hX<u\345\334{\231\002\205\303s\354\314l\305\314#\230k\213"
+	.ascii	"L\367^\nH\236\344\004\037\310-\363\344\350\201\267\374\\y\313"
+	.ascii	"*\230g\026\r\027\350\230\302\364`\305\324\tP\235d\372\336\373"
+	.ascii	"\323N\267\360\247W\"Fw\314\254C\221\217nq\203S\314y\351\0263"
+	.ascii	"\362\207\266\221\371\234L&\323p\363`\206\275\314;\235K\373\343"
+	.ascii	"\271Z\312])\323\246\374\030\200!4\204\007&\357\265\221Ds\261"
+	.ascii	"\330'B\356\364\037O\231/\373R\343C\361\2478&\003s\344Q>\227r"
+	.ascii	"1\340\236\367\302,\244\2450\367\"? M\031\226\032\037\311\177"
+	.ascii	"\342\330\255,\213\023C\221\241\205T$4Y\223U;\307G\267\250\371"
+	.ascii	"\352\037Ob\213\b\006Zl/\210V\224\316,\257F\220u\232\331\202\225"
+	.ascii	"\224\303\325F\266\335\r\340\204\272\n\361+\"~ud\305VZU\271\352"
+	.ascii	"\376\325\217f\250b\025\227\262W\332\356%\250.A\364\f\375/\251"
+	.ascii	"\270\304\266\221\257S\322>\030\022\237\242s\223\265s)\266\017"
+	.ascii	"\335F\201B\373\246\313)\r\254\244\035\265\215&\312\367\016\312"
+	.ascii	"K\020=\303\314\267?1\001\202XE\353\336 \tNp_\"VQb\362&.\312\333"
+	.ascii	"w\315\217\243\217&\371Tg\231\363^\3526TW\302\223\035\001\231"
+	.ascii	"y\367*\\\314IT\026Q=\273\034\007\035\217\307\305\342V\"\205\206"
+	.ascii	"\236]N\367b\b\025j\020\"\334&\330pjx\037J\344p\273\233\316d\033"
+	.ascii	"\016\212\035\334\356\306\323\321\361xh)p;<4\333\216G\303I\300"
+	.ascii	"9\335mG\353\311\345v\264\030\362\376\267\276l\233fW(\3625\020"
+	.ascii	"\037\235\311\303\332\310\001\250\230\260\376\323o\343'DDg/;\310"
+	.ascii	"\325\254\375\246\037\207\224P\r:\273\355\340\315\313\276`@\313"
+	.ascii	"\366\217\\R\272\365z\357\275\257\3226\327\266\375\251_\350'\264"
+	.ascii	"\304\365j\256\325v\355 3\254\357t\033\007/\033\326\377\021\001"
+	.ascii	"\005c\250a4\345\024\203HD\002\221@F\n\fu\200\002!\242\334\016"
+	.ascii	"\020pG\323$\303\030t\335\277S\316xI\036\033\300\006\2256 I\016"
+	.ascii	"\022\207\n\020\200\317\320l\304$b\327)>)H\203_3b\301&c\323rj"
+	.ascii	"t\301\330\007\317\263\372\375\377A,}}\362/\352>\340\374\2568"
+	.ascii	">\036T2M\3370`<\241\032\201{\033\345u6\330\255\374K\362@\372"
+	.ascii	"n\217\023L\301\322\t0s%r\204\304*b\253\3528\312I0\302\247>H\253"
+	.ascii	"\227\302\303\023\346*\001\370\324\376\262 \316\2302\001Am\\\354"
+	.ascii	"\312\372\275\001\377&>'\212\024R\020\220c\364\260\350\204\025"
+	.ascii	"x\224:\263\374\2677u\340\013\274\343C`\326\356\303\273-M\024"
+	.ascii	"`;\231r\247\002"
+	.text
+	.section	.gnu.lto_mspSerialPushSubscriptions.34.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\315\0245`"
+	.ascii	"\212\231L\"N0\320\322\031\016\273\375\205\236A\232\220UcDu\332"
+	.ascii	"\006\026\311\363\313z\206\362\311\256w\216N\254\233\321M\316"
+	.ascii	"\327\354\3770K\270\364\237\023\317V\251\304\3261\335\001!\232"
+	.ascii	"\247\240\316\342]\360\266\035\r\307\354P\245>Dt\024\324\204\354"
+	.ascii	"-e\222\001\f\002\357\001\032\002gr$\257\334\200<\327\374Fp-\235"
+	.ascii	"O\207\302\317\344@\333V\255\257qYn\371=]\225h\006\205]\343\226"
+	.ascii	"\217\331\223Y\343\252\317r1\3739\365avq\034\314\n\271\230}>\226"
+	.ascii	"\366\\\366^.\347a\371eJ\313\211f"
+	.string	"\346\006\361\251\007\"K\273]l\374\254\315\365[bhg\244\210O\223\002\227\366X\3665$\335Y\332]u\350\026\244-\031g\351[\236e\257\305\251\005\307i\270\361\025+\2538$\210\227\347\272\266\231\240f\351Y\376\266\217K\256Y\332}\034\216\303\355\\\362\252m\325jr>\327H<\335\030\177\303\261k|\212\032w\223\236K\334\366\031\324_Q\241\350g\275r\373\252\200\370t\333\210In\226\316\273_{\025\365l9\266\270\256cg\276\254k\233\001K\202\3704y!\341S\364\035\204O\325]\275\267\225\255Eh]x\274\371\255\353\252\3240\364\020\211D\333G\333\276F\250\372#\243\"\242!\241\240\016\034\200~\220|z\220Gc\022O\2218\024\246h\263\272\037:\271\375C\027\027\2537Z\264\252~4\0055a\305Fj/jf\245\2751c\"&\037\032:\t\005\2359\225p\207%\347\320$+\0064\351|"
+	.ascii	"\315\254$\f4t\222;\212&\007\355\207\311\221P$58"
+	.string	"\2617\263\250\240!\340\324\330\370\240?a\250\2119/\356ya\013\354H\264\251J\232Y_\211#\363&Ya|lf}\241I2F\330x%\330\223P\037\032\3528y3k\r5\021\245\007\227\363\274\231U\344r\017\240IV\031\027\003\030\333\352:\021=\002C\303\365fV\027*@\233#\3167\311b\362\220\n-\315\234\261\255\264\013y\244(\001O\271\276\036\255\035\250\320\220%K\243\026\026\243h\002N\255\"=ZW\250q\005=\273\313\235\177haq\277\206\247G\202\264\255\375\215m\251\235\207N\353\272./\265\266\276\036\276\313\023\354.\331.\007/\001m\177\317\021-\242\213\370x\b\202\350\356\021}\304\207%\203\225\233\247\203cu/\346\025\341\"\273\001D\277\371d\367\333<\271\017\260\217\034\037\323\203\007V\267\002\350\305H\301\253J\233l\377B\310\375\275\b\330\352\305\211P\300J\256\032\344\325\206\360)\267"
+	.ascii	"\314Uz\274\371B\233l\017%|K\271\341]1\340\356N\360@\250\016\230"
+	.ascii	"zv`|\215\351\364\003|\017\341\261)yP\255\271\356\375]\236"
+	.string	"\004s?\033!\312(x\035\013\316\306\314K[\327\365\304\323>\030\3066pn\300\326\350\234O\003\f\326\006Ql\013\204\2212k&\256\225\245\016J\363C\377\313o\210)?G\003\021w\313\335\225\340O\030Je\353\272\242\320\273\034\016\366J\236\256\007\037\360\227\037\b\237~\350N\263$\242\344\301\275\334\201\262\3249i\366\272\256U\275$T\210)\331\316\276\206\243P\306\030\316k\375\333[\331\316n\233\0257\331\356wppPp\033\311.\222\267\205\223\017/\013\037\336\025H^\025\027\363m:\362\246`B\361+\177\t#\357\210#\257\b#o\210\263\375 \376\345\373\341v_\244o\371\036\035y\215xx\213~x\211|x\207|x\205\214\274AF\336\016G^\016F^\240\"\357\017\222\327\347\310\333\343\303\213\364\341=\372\360\032{xy\220\274E#/\321\310;4\362\n\217\274\351\221\0275\3626\017/\027y\317"
+	.ascii	"\tO\206\b\321:\220\301u\0352\030\270\262I\3010\271\230?\316o"
+	.ascii	"\367\177\371\267\334\303\331\322\376n\357\\\243\207%x\207\243"
+	.ascii	">NT\321\r\032\340s]\263\302\210Oy\204\207\261\245}\263G\354v"
+	.ascii	"\356\353\326z\037eh\177\317/\242\233\346\353>\206\251\267Y\304"
+	.string	"\252,b\031\264.f\316\006\205\203\331\243\371\032&&\23545i\300\324\244\241s/\"]^\337b\336\361[W\345\227\313^\370\213\332\302^I\227\352\305_\252^\352\027sQ\303\326\205;\325#{\202\210J\306,\226i`-*\331^\311\336\251\302\260AW\315\360\236\316\003\335\325\361-\035\2569J *kk\232\307\216\203{\303\362\253gBc\037\273\347b\340\031\324\263\013\230u\332\254\260\031;\210M\372+\031\300\360~\212\200G\350\220\032\311>\314\035\310C\023\347\245\207\305~2\227 \317L\234\227\343\377$l\321?Zt\013^\f\320\033\326\327\227\277\247O\223-\362\f\322\251\033N\022\2117\365\017\003\336\324.\322\260\261\246V\356\\3\255G\217S_\314\223\005\274\251\235\372s\177\024\272\257\025qM\002\221,zE\277\317\r\r\023\246\242:A\366MQKc\321\013\240q\024\325I\321\016\312\023'+z"
+	.string	"\263Mr\361Y\035\233\214\305\256\342a\320T(i\024g\332\272^\235\220\201\t\f\243\335\033?>\343%7\204OU\264\020\036\333\221\016\255\371\302?\346\3112\034\203*\005\200\207I\322\242\351N\305b3\030 DY\003[\323\3432U\n\0161%\231\023m0\363\374\333k3\203\203el\262\375\211\274v"
+	.string	"I\272JE\310\323\034E\215\221\250T\316\306\354\363;2\306\323Jk\226<q\201\347IXl)78W\fX\205\303\236"
+	.ascii	"(S\2550X\213\r\230}~_t\330H\261\0010c\243\303Rl\262\"9.`\362"
+	.ascii	"u1[\340[\356\t\233\330)\337\\s\303\004\366y!6 L\321Rnk\256\030"
+	.ascii	"\220N\b\334\327\032\242S\f\033D\207`\263\346j\236T\322=\205\334"
+	.ascii	"\260\271r01\345\370\255\260\245\365\345\236\260\273\207\335s"
+	.ascii	"X`V<\270h\013\033\345\302C\320\312\nIr\305m\230\004D\212\021"
+	.ascii	"\260\265\307\366wuT\3229sU\330\204M\266\":\355\036sC\303\337"
+	.ascii	"9!\332i{\270\2035\305j]\260\220\006\206\314 @~\240};3\266m\363"
+	.ascii	"\313\375P\340\274\002TO&\310\210QC8\343\"|K(\361\0045\203J\211"
+	.ascii	"F\024\024T\224\f\243\030\247\222\212\032\2260e\243\006\n\025"
+	.ascii	"\343I\212jJ\230\302\323\b4\"\240\222\212\252Q\244\341\300\b4"
+	.ascii	"b@AE\271(a\312F\0055\246\240~\366\200\245\004\016@\340i\001\031"
+	.ascii	"%\206\2464x\202\232\221\001\025\215'))\0332\220+\243\304\t1f"
+	.ascii	"H=M\205Pc\nJ\211\306\214\030PJ2\244\246\224J$mT\215')%\252\250"
+	.ascii	"()%c\233\362_\033\211\333\211pN\304\376\236\312\266\332\037\025"
+	.ascii	"1u\303a\022?:j\027i\330Q\177\013\272\256\353j\304\324\337r\324"
+	.ascii	"L\375\241\273:4\266*j\2625N\031B\321i\022$\022G\352\037Hznj\212"
+	.ascii	"\332\250\337?^|\213\031\270\364\321\243\250C\340\261)\321:H}"
+	.ascii	"\273\003\366\215\271@\204\242o\207\324(\372X`Vo.T\246\356\006"
+	.ascii	"~\332\021\204\033\272\004L\342D\375<\342\207<\035rx\350\230\323"
+	.ascii	"V:n`\352\212keW\365J\324\305\260\023s\340v\b\025\237W\274\206"
+	.ascii	"\372N\240\035@\276r\241\036\352\346\363S\317:\350\202K\253\323"
+	.ascii	"\307'\324Cx]\314\275\265\240&\333\240\006BS\374\ba\207\016\352"
+	.ascii	"$\016\335\241\207o<\004\033"
+	.ascii	"\330S}\374\255\354j\312t\324\321\361\307_rh!\013\f\360O\357\352"
+	.ascii	"\270\243c\220\277\004j\f\304\256\272\212\365\240\376\244\353"
+	.ascii	"\315/\317\371\323\006\230\265\300\002\216\352U\002\357y\374F"
+	.ascii	"\365\321s7\300\235j\245\356\340/\367wv,l\207(t]\307X<\316/\350"
+	.ascii	"\302\242\366\274\302\203;\002\210\225@\316b\247u\246e\332\f\034"
+	.ascii	"|\372cnM\374<\256S}\b-\320[\242}:\271\243\253\026\331=\315s\203"
+	.ascii	"\315\365F\302]\365\307\235j\220="
+	.string	"A\244\203\354]u\310\235\352\331\236\200\200\325\250g\002\224\355\252Z\234F]!\005\246`\032\032\2723\310>\027SP\rL\0315,\201\2739&\363\342t\230w\306\360\372\245c\201\303\364\034\031BfID\311rj\201\300\250\2214\305\224R\210FDD\222$\2054\006Q\005\204\030F\2354\017\021P\261S\214DDF\234\306\266lD\321B\355\345\322\347R\372\001\342\252\316'Q\fH\202\001{'\364:\205\347\331\251\356@\233\222\205G\t\001\327\260\032\356V\314\220\342\377\314\340L\004\305H\350\250\\\202giQ\355\355\225G\301\375\312\"h\337K\221\3215x\315\204\024\004\331b\232\264a\232(m\033\037\346\222s\224\267\363G\215/\213\241 \377/\346\326\372\313{\276O\312%v\312\355\257\202\367g\264\027\306\245\2108\0016)\254*\033y\316[\226\266\262\205\265\267\020\305\"#tV\246ec&\224\246AR"
+	.string	"\332R\374\364IJ\304\374\321\020\345;F\254MuQ\t\"\236\322\304\260\244wo\230t\353\f;\213\362\277\251\340\353\255%\201\266\004\n\261\310\314\251\030|\214u \330+\267\021\303\244\211\251\224\035a\246\326\r\213\320H\203\003\002\0313\202+\371\212\200G\340\316\250/\034Fl] A\346\260\364!\016\377!\325\246\256\301(\305\240\270\013\304X\233AA<#\244\007f\313\377\224\353\354\244\263-G!\334P\203\201\204\235\n\205\2301\202\363'\212vS\206\316"
+	.ascii	"\365\205q\021:\007\300\241\240q\336!\221\327\342wAX\365e~\324"
+	.ascii	"fQ=\226\016\204\262\317\004\264\337\376R\223\026\306\273Y\316"
+	.ascii	"\r\312\362D\360]\210\307c>\272o\260]S\223y(\336\207]\370\001"
+	.ascii	"V\250W3]`\"\177\035\016O\n\033\026k!\013\bH\204\301n\364\324"
+	.ascii	"\315\"\3567\316#u\263%|X5\3105\351\205\204\245C:\2433aM\0019"
+	.ascii	"\025\t\255\013\214\004\215)\206j\352\263\205C\350\217\376\242"
+	.ascii	"\026\356@\ff73\237Q\237\177\327\233A\321P\005\374M\361\204L\355"
+	.ascii	"\302\236\353\005o\333\034\270\340\366+\0369\207\034\331\322\""
+	.ascii	"L\227\266+d"
+	.string	"\317\304B\3068\210\rEH\263\337\233^o\204\365\r\366\031q\312%n$\313\220L\002\335\\nd\t\303\217\264a\363\t\236%\023S1H\263\002\264\341\215~E\226\324\005\244\376\331\262/\334V\215^3\tO\200\353\2176\027\310\353\217\322\001Q8\006:\006\306\307\241\260\356\007\030\031\332j\003u\021\035\373\236\021\323\376M\317>\237\215\236$]\364ai\007\231`M\355\365z\271~~'\325\205\r\321\3674\225\230\271\2360\"9\001:\352\021\236\017\023jn\300X\rZ\241\232\023\\\234\320\2603\3172\246\334_I\203\\X-oM\205\313J\271\352\215K\300S\264_>\257\203\367\340\022\320l\200Ck]\030\026\321\206\255A\326aX\214\214b\360\204\243\203\037\324\333\353\323\303\300\256\307\224\017\372\300\277\b@\022\210\364X\020Y\254VX\030\365$\313\346\306\034?K\201\325J\224B\376\246ug\330\2407\030\312"
+	.ascii	"\231\345\246\336b\f4\026\023\316\203_\3035\346\322\177\335m\327"
+	.ascii	"\243\017\021\360N|\310v\024\034\003\013\347\277\232\001\215\230"
+	.ascii	"\235)\335\033c\365\204\344xJ\302\226j\311\237\364\260:\360$&"
+	.ascii	"N>tE\020Ov4k\001\327\255q\376\373\220\351\332\021\241>\004\006"
+	.ascii	"\332O\306\362\371\245\222gy^u\327\022\310\376R\237N\013\355\353"
+	.ascii	"!%\373\303\020\371\017"
+	.text
+	.section	.gnu.lto_mspSerialTxBytesFree.35.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\202\004\335\036"
+	.string	"&w\304K\220\330Q:\b\002\035z\026RJ\333@\341\203\370\300\253\002\352\3658\374\245\263\254\327\027\254o\037\366L\257E6~kw\364}\325\276$\244\\\305$\203\300H\202\016\204\306Q\301\331\371\216@\320C\342\214\016\373\266O\b!D\356$\003\261"
+	.string	"\250"
+	.string	"\262"
+	.string	"\265\241\355\305\237_\242{\026\\+\216\255{\2156?\331F\375\3117\362%\037\376\301\240\342'L\260\336\bB\302u\257\321V\363\002\350O\363\003\320\237\315\203\373\246\361\034\263?\227\305`j\212\236f\333\037~\232\303\364\013@6\250\202B\337e\346Lr\250\206\331"
+	.ascii	"\310\306\020\354 \032\036&#Ta\326\004\031*\262j\327\220JM\005"
+	.ascii	"FVb<9D\303,\200%)+\310\242\377\025\375L\223\206VA\241\214\233"
+	.ascii	"&N\226p(#\\a\312`h)\037u+$\004\332~\3237\254J^\220\210\206\267"
+	.ascii	"i\316\275\227"
+	.string	"mPHt\236\235\231\2610\263\016\263\211\023R[\367\336\006=Q\017\200TN%\373\336\353k\266\371\217o\2729\004\351\016\031\002\260\\.\227O\200\276x\nG?\353\305\026j\335\022\363\345Z/f\243\3176\221\371\277\255\203\231\366\247\3439E\317\323r\277x\266\246\345\313\030\330\342\224\345i5j+\343}\261\374\272U'\024 \177\372\217\177\361\315\374\332j\343;\361\221<\212e5!PO\342s\344\211\231\233\274\027f\255>8\030\325\232\361\tE\213\252uI\203\372\263\266\303\3067\362\233X\366\263\306\343\310S\346E^3i\210\\*r\357\265\240\376<\263\017\237\211e\001?\353eaM\344Y\243\275s\272\002\264]^\311Y\377\3515\002l\007\017\366\301Y\277\350\b\330>1\311'9\276\210\250Z6\300tQb)S\002\277\241\255\363)7\365T)p\352\275\267\373\200\222\027{\204\205\325\r\264\211lg"
+	.ascii	"\361)\317\232\013\254/\243\333H\374+%\225sS\030\032Z\314&\366"
+	.ascii	"\240\357\235\023\027\240\355b\346\020\237\352\341P4\305u\357"
+	.ascii	"\205 \005\312\243\360\320\237o\032.\305\237]\362\221J\252\344"
+	.ascii	"\225\372\221\257Qr'\274\003WAf\326\275\311\316\227\212\246$,"
+	.ascii	"9\023\021\374\037?\231'g\037\374\311\317\241?\271\004\363\354"
+	.ascii	"L\013\340\032\275]N\203\216\307\223\342p;\013<\\\357\304\007"
+	.ascii	"\230\t\034\b\022\031z\273\234\016\306\016&\3408x\200\213p\273"
+	.ascii	"\241\351\341v\315\267\233\021:;;\034\317\203\216\307c#\261\243"
+	.ascii	"\303c\273\355x\266\233\032\347t\270\235\255\227\313\355l2\343"
+	.ascii	"\275\031C\333\332\236p\364k >\323\337\303JFR\326D\246U\201\321"
+	.ascii	"zU\nJbm\236"
+	.string	"\266\020\233\260\263\317t\225k\305\021\324\304^\311\321\026b\360\264+`\001m\027\001.\264\255\027\247\375\343\315X\023\037\003\212\210\226:k6O\264\317\026b\246\365\217\013\2366\255\277\302\b\310.i\256\224Q\316\316\371\275x\213T\216\251\n[\250!0\251\024TfF\202\231@HA\2351p\002!\251\243\036\020hV3I\322\030e\330;g\372:{\270\236\346\363K\347\375\310\277y\354p\026\232\024\223\337\235\013u\364Q\037C\351\317\001\004=\0022\210R\333\236_\273\352\365{\f\275\222b\200e\361l?j\305\314\b\255\034\376\374;8\020\315\342\n\300\231T/]\215\345\313\321\367b\364\247\215\354^P\334cBQA(\317>\314Qpj\022\035\351\030\200B\274\200Ew\251\237;6\026N\301\002ru\376Bf=\311\215\255\025AJ\nR4\022\2619X\036\230\036e\201P\235\200\235\344p\0228\b\300g"
+	.ascii	"\271<\204I\222<i\223d\207\223\216\205\277\211\0325"
+	.text
+	.section	.gnu.lto_mspSerialFrameBytesRemaining.part.0.59.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\205\001E\016"
+	.string	"V\333]C\020\221\223\016[$\b\250U9B\260\303E\272'\023\243b\315\300e\256\306\355"
+	.string	">\356\250=\016\343|dr\"D\020\213jk\306\200"
+	.string	"PQ"
+	.string	"J\232\316~\317*eH\225CG\323g[\204\220\275\245L)H"
+	.string	"G"
+	.string	"M"
+	.string	"^`=\272\263\354\243\330H\266\375\023o\341\354\030\330\255\224*\0163)*n\354\356\365x\340\002\250Gx\017\352QI\234\273&\344\374\034\225L\256\367\036c\260|\243\022\210g\307a%\262\273\266B\334\361\266#\330\226`\337F\253&\033\246-\230\256`\232\202\351\250i\b\323\252\351<\314\377\215\007\202\226]\017_\315\216\2100Xl\337\276\267\331\034\337\343l\216\267\277\210\nt\373\201\224\240&$\3630~\212w\334_D\017\260k\232y\261\333}<\006\224\302\030\024\023'\371\031j\304~\202\372!\343\222\252\372\224\034\366\205\267\320\254\335\r\016|\026\0310\370%\036}\021\365\230J@\306EC~\006p\372fl\322\254\260\275\331\234]\303ZY\322\356*x\274\367\315\211F\206I\342HU\261\302\303\006\201\320"
+	.string	"$\344\363\300\323\031P\222a\023B\032\250\262\247Sa\204$\373h\024B\032\350\262@2\002\272<\231vu\f\030\013}\262\253\004\303\262\213s\270j\362\275wd\245\226v\260mi\352\211\213\034\355ZDU\3056\203SZ)E\003EDT\325! \220\002\241\244\331\001SpxlXN\232\253 \273\231d\241\314"
+	.ascii	"\222\344\2061\237\266Fa\3156\330P\373av\024\345`xUk\220\013X"
+	.ascii	"\362:\302\2171\304\024f!\b\276\016\375\370\272\033\320(qx\262"
+	.ascii	"\351\333\215\030Hp\364\265\006\017"
+	.text
+	.section	.gnu.lto_mspSerialChecksumBuf.part.0.61.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\363\002M\026"
+	.string	"Vi\216J\320\320*\035rJD)\206\013\263\224\346+lWU\3304\nc\004\3518fC\373\200\034{\013\030I\272\231\031v\243\016\313<\221\321\232\261\347\017\346\310(\026W!\"\224\bN\204O\030HXC\347E,\335,\t\332D\356\224\002{"
+	.string	"w"
+	.string	"r"
+	.ascii	"\274`\212\005\345\003\230N\311\217\230N}+\253\357\206$\206k\347"
+	.ascii	"\201W\221{H\335\331\350\021\325Z\232\234\272\204<\265\217\302"
+	.ascii	"\255\223\333M\353\004\347\334\313\034\037j7\242\246gG\255%\353"
+	.ascii	"tEx\034\016\207\303\213\345\2753wq'\315\371(\034\220l~2\027\305"
+	.ascii	"q\306G\002\300\217'\242(%\025]\370\331\373\351\346\242L`\370"
+	.ascii	"\0349\035Uj\255&3\334\246\333\216`\333\201\275\005"
+	.string	"\002&\307\2356\035x\323\235\026\307\351\235\017\336\027\021a\315\250\3257\344QqhQ\211\017\335\376\320\315\027:e\373BA6UN\311\251?\204\263S\247\256\3316+\360pj\255\006H\204.:/\024d\363\251V\0178\210\334\200<\235\366\255\254\277\033\022$ \277\347>\270\377\370\205\030Ry\037\204D\265V\006\344\251J\274\225\365\302\r\2278\037\364\313\257\300\235E\314\200\220\032\300}\220\\\025\235Xk\255;\356\201\251)\256im\026\331\274\315\270\252\231\2251]\323~W\334\355\251\351\341\273\2400\363u\374\030\323\351.\325\321\333\240\233C\317}\360\252\003\377\3165\031\321\234\330\315\241/\374-\370\030\325\250\373\003c\3467\375\026\377\320\347\\\362\203n\005\272\271\344\245\033\302>J\216R\222\027\204}\240\037\344\301\377\343\300?\205:\035\350\001.\263\225\032-6at\211\265\354\013\346\005At+\305\325B\020K"
+	.ascii	"[\t\220\331j,\260\230\004\030i\330\252\345\265B\213\325\036\274"
+	.ascii	"\324d,\227\225\227\214\005\243\325X+\002\236\275\304h,\230\331"
+	.ascii	"\214\306\232\027\227.\n\265)8\272\335\241|\226P\242HAN:;G\363"
+	.ascii	"\264\344\307^x\023\2369\367\333\263HS{\032;9\346\270t{%'\367"
+	.ascii	"<\301#\336T\362i\017\264:\271\247\235F4\0354\320\310\240\373"
+	.ascii	"A\250A8\344\024B\b\021\211FD\206\210\007`\202Q\216\312\016\020"
+	.ascii	"xI\323\312\034T\204\013\217\217\215\360\346wz\272\304\337NY\317"
+	.ascii	"\212C\27022\223\312\334\224F\246\366\230fA9\"\033\237\265\026"
+	.ascii	"\240h\320b\036t!m\002\231o\313\362\177\241\260NX\361\026mG \251"
+	.ascii	"\320\214\310\356\356\233H\330\332\373\006\353\235c7\377\201\033"
+	.ascii	"\f\305\255/\tC\026\003\362\221X\347\342\341\277z2dr\275\350\250"
+	.ascii	"\354C\225\331\3447\215\253\242\3722\236\002"
+	.text
+	.section	.gnu.lto_mspSerialPostProcess.part.0.64.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`\257\001\035\017"
+	.string	"\326\332aF\360t\224\016(\242\247Z\212g\241\312\324\257\003\033A\251\334\004/\007ty&\300\317\363\220\340\360\237\256\233\004\205\345\334\24006-\023\262c\3001\320\245\273\004\340\226h\300j.\260\207C-\235G\277\266\355\275wJ\001G"
+	.string	"T"
+	.string	"I"
+	.ascii	"\tN\r\252\247\006o\200sZ_\200sj?\206mO\345\317\026r\220\305v"
+	.ascii	"Z\f\t\021\276v7;\225+\376]\306\371\371q\205%uy\3271\022!\313"
+	.ascii	"G\213e\304#\201\317\316\311\356\272\272\334\364\266\035\330&"
+	.ascii	"\331\277\t\247\030\214\031\377\306c\276\313d\250)U\215\001R\204"
+	.ascii	"\310\356V\250\247$\023\013C\033\032D8l&\324S,G\211}V\r\016sM"
+	.ascii	"\200\333\322\201\307K\306k\027\004\235\032B\265w\030\225\003"
+	.ascii	"\340\266\2500\027%1\036\364g\234\306w\030\225\017\330]\005\261"
+	.ascii	"\331\005\003\237\0225v~\334;8\030\272\370\025\223\200\220)\337"
+	.ascii	"u\t.=6\032\211\362\305r\316\335]\313\225}\360\377\004\235\b\200"
+	.ascii	"bW\304\315\221MAu\274x\315O\363\267.\355\333oy>\315k\356\262"
+	.ascii	"\307\236\367\326\347\263\036~\306\236\0334\013\246\b(n;\001@"
+	.ascii	"q\035\323\203\256\323F\033'Bu\233\350\324\225\004\330\244\301"
+	.ascii	"\002\023\005\032\203Q\350s!E\353\246G\241\024\024\022\247u\024"
+	.ascii	"N])3\221PJ\331\210\353\262\020\002o'\215\313P\333\306e\236\313"
+	.ascii	"\225O<\310\017\226R\276\330\2362+U8( \240\202\231\253\333\220"
+	.ascii	"\202c\313\353\215\315b\326b\316\340kP\037Et\234\206e\211\342"
+	.ascii	"0uw\277\020\027\001\f,\030\f\002\343 ,0\305!\306\003\221Z1\007"
+	.ascii	"\253\205\372\261\213\335\\\242\303\300#\251x\002\331\213\355"
+	.ascii	"e\353\234\037\300\222\274g\026\270\2754\026\265\355?\201\216"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`A\006]\034"
+	.string	"\0260\262G\200^Q:\003B\235e\005\210C\356\212\0077\305\200a?#1\365\340y\301\275\330\224\312A\224\306\225\bDp\030*\245!\321H\030\256\330.\3073\224\213ax=\007C\377\025\3744c\350\376A\007!16\233\210\334\001\245"
+	.string	"\235"
+	.string	"\234"
+	.string	"\006l4\203\032\335\200FG\230\321\022d\264R\214v\300i\232\336\313\203\321\013\370E\377\\\364\321\330\242}c\006\013\305b1\020\213\356\255h\036\356K\023$M\275\033YE\327R$\311\356\275\243\232r\241\203\242i#\230\254\023\2353\321\027\314XB"
+	.ascii	"\t\234,\302\220lD\023\t\207WD\264\020yV]\305\t\321h\257\202U"
+	.ascii	"\2370\020\2754\362\371\320\267\236\207\306\320\241uwx\265%\n"
+	.ascii	"\207\0360\306\3224M7t\200\361\367\362\232.\001\220\335{\311T"
+	.ascii	"US\255{\373^3I\370\305b\261\250\241\215\306{\357l)/T6\032\002"
+	.ascii	"\326"
+	.string	"eV\236\327\366\312\357V>\303\274\362\370\312\223-_0*Y\254t\345\271=*O\006\371b\276\210(!\232\235\201\314\302\2410\215\214\374l\310g\337\254|b1Re\fT~\242\036\273\216\345\242)/YE?m\345\267\221\303\325e\364\223m\313?,\2522F?\007w?\013Y\226\241\321\302\"\032\377\324\362L*\330E4\236\\\371\022\237\324A\242\273\017\322\027\2004\005\250F\360\243\023\370\350\003=\032\351\251\t\360\350\002;\272\202\216~\220\243!\340\350\t7Z\201S\007>\333i+s\024\330\021+\006l\347\365\200\355\267%\314K\274\234X\251\305\202\270\230\267\302\266\360\320j\017Z\231\211kT/\002\2653!\321\256\013\362\315\003|\243\205t\276\0064\317\323Xf\253>ag\222\316\007\001c\347\371\013\3133\317]Z\266\300\204\352\016\026\225\313()33\363,\f\376\332*A\306\251!\303\346g\236\251"
+	.string	"K\363<\245\345\231\207Z\177\346e\230_\0214\317\354\316<\213#\363\272!+\r\205\3032\326A^y!+\337/-T\275\362P-\217Qp\270t\345\0037he\366\222\362\007K7\3403\256\370\342\231\262\243\346bOD\236`'\f\0213w\247v\227\273\023\253\313\335F\313\027\212dm%\345\216\252\346\320ol\322\320o+\337@ZU\300\005C?Y\005Bg\325&t&f\237\320\233\332\"\364M@\036\277\334\030Qs\242\347q\361\330\322\331\263\345\242\307\261\314L\260\344\231B\200\376F\034\321\327\326\004\350i@\3463e\346"
+	.string	"\"\321\237D\366U\021\307\224\350\231\212\320\317X\337\355\263\225/\227\236&\255\322\355\270\002\266\337\202|\273\244\240\264\t[\250Q\030\303:\207DD$\210\264\270\320p\260\002)\24219\021\220(\255\020!\022L(\022\314\310<\270\251\3531\321\036\275\0039Q\333\353\254\345Z\026\314\231\214{+\317\374p\030\351{\244\363\262\037\022<\336\"\"\374\361d\002\f2wy\213\341\245\253\017j\257b\370\013g\213NMA6\021#HQ\341=VDh\360v\344m\373S\372\335\032\267\327\277\320\360\317\352?\240\310\303 ,\026\300*\371^\003i\326\261s\322C\200m,\311GM"
+	.ascii	"x\261 \320$\354^\361\225\260\034\222FD\260\201\235k9)\025\335"
+	.ascii	".\225\354\020E\303\030T\265K\035\303\241L-\235\356%\364u:{\230"
+	.ascii	"\221\251\001"
+	.text
+	.section	.gnu.lto_.refs.2e37fb9b28356d3d,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"=\006"
+	.string	"\322\016(*\200K\322\030\253`\206y\035=L\310\204L\310\204L\b\360Hv\340\006\027\303O\337>)\203l#%q\357\275'!\215\020\231R\372,\301\032\002\362\341\261\332\301\261\261\252\221\261N1^/\326\212\2115b}X\204wj\353Z#\337DY\nc\202t\247#\235\215t\003\215\n:U\333\373\004\026-V\212\265a-X\243\003\034\325\332|\223S\341\225\"e\253\372$\214\007\253\301[Y'\266\223\025b\313\326g\275v\220\022\242\235\016l\031\230.|V\326\311\254sY\3678F\253d\005X\027]\"\016"
+	.ascii	"(!-q\215\212\002q[\242@\205\372F\3121\264-\247\373\200\361\301"
+	.ascii	"\220\232:\200%s\013\375\305\214\002"
+	.text
+	.section	.gnu.lto_.decls.2e37fb9b28356d3d,"e",@progbits
+	.ascii	"(\265/\375`\355L\255@\001\212\r^rV JA;\351\317\357\346\254Q0"
+	.ascii	"mr\024\206\225\0048\002\301\321`\"X\355\230\335/\215\300~\007"
+	.ascii	"i\006\263\007\215\035\357\374\002e\325\333\346\212\327\272N\247"
+	.ascii	"\372R\224\242\255\331\276\212\353(\346\260\353\233W\fA\214\311"
+	.ascii	"i'\277\275\016\323S\033\020\204A\221C\310\336r\247\n\006\021"
+	.ascii	"\007O\007_pIz\033\360o\214\365M\270\376\275\343Q\227\206\223"
+	.ascii	"?\266\306P\260\0325\206<\033\277\005\327w\264o\f\335\262\226"
+	.ascii	"i\215\337\\\326\333\267\266\321P9[oQ\314\306\r\005g\007\377\274"
+	.ascii	"\274\032\267S\245\363\233\362\327\270k\364R\222\257&h\215"
+	.string	"\273)\247\311H\222Yc/mG\307\304l|\300\303\375\037b\034n_t\215\337Z\232\306\020\217L\217\263\306o\270\365\255\266\276\243\254\357\260U\003\333\243\276\227\254\357\255\365f\333\243j`y\324\316\253\323`\f+\215\337<\326\3337[H\230\002U\033\231\301[\302\177\203\016.\006'g\260\234\263\007\f\006\306\f\033\215\017h\323\374\037\332\340\351\241\251K\203\006\206`\226\262\306\377\355\233Ec\005\2419g\252+\251/\215\337N\353;\257f|p\316\242a\246\032\337\352\255\267`V\254\334\025s\256R\254\350\242?\177\026\317\362\351$e\310JvY\270r\316\377-\031\353g\313\330\250\035c\001\355\233\375\263bn\315\354\33114g\245\234\363\013`\377l\237\335\273\320\266U\006\331\226\002l\320\201\375\263u\326\313\205r\325\230Y\311\215\265\331\270+\346\\\315\310\264Ds\206\252\331?;g\267\\1gV\272\362a"
+	.string	"\346\332\232\215\300\234\241#F\370\214\0301b\304=\033\323\024\250\203o\275\326[\253\325\362\375V\315\336\331=\373\314yJ\316\231\203\216\021\272\036q\215-\030\253g\337B\3300\267iv\312\323$h\206\346\f\335\351!\203hd\215o\245\326\333\020\352-,\264!T\373\345\3476\217GuFA\363Y\316y\207\00258\267\3065\226G\275\305\261Z.\266\213}\233\300\332}\203\016~\227c;9\204^\204h\032\3376\255\267\023\250\266\320N\240\336\312\260Z\354\322U\0242\215\257\001Kw<\366\314\271I9\350\330\032\037\271\332+\026\213};\234\315\222wv\254"
+	.ascii	"\306\320\326\370C\353\213\234s\266\207Sk\016\247\276\002\253"
+	.ascii	"u\263T\354\233\b\013w\273f\331>T\202\346\262\234\241;8I9\326"
+	.ascii	"\2704>\213\025\347\304m\225K\220\224;\270\317"
+	.string	"z+B\335),,,\264\"\324\347\254\037l\217\212y\324\f\266Gm\313\243~\260<\352\327\265\237\266G\305\300\362\250o\263<*N\266=\252\205Z\036\365Q\313\243\276\316\366\250\277\025\373\355\227\005\263a\267\311\364\314g9C5\324|\305Y\2355\266am\237X\350m\230u\362\r:8\216R\006\313\031j\303p\316I\326Z\240c\255\005)\\\221$2\025\277\327Cm\217\272Z\036\325)\255\200C\225\2638\342\374\370K\343\241\341\217\325n\207\200\276am*\360\367\006\264\354\241\370\373FI\005\302<\211Z\004\314\021>\304Ma\252I8\003\3764\002W\002\226\303\215\300Y`m\370\323\024\256\245\367.\207\353\363_\bd\340\267H\017s\200\377\262\220\363' \256\n>'\300\217\215\332\311\236\371m\264\237.\213\277\347\316\363\247&t\322]\3617\003\356\nw\370\200\277W\270*\376\273\363[(\016\370[\350\n"
+	.string	"\0012\254\210'\3357\203\253\302M\341\277'\330\334\203?\035\001\204M[K\202\275\300\216p\302kB\003v\374\375\345\246\370-\241E\321\033\270#\364\336\3377\027\305\337@\177\343\\\005\374VI\212%B\376\256\340\357\017A\256\b\277\005\353\032\n\314\335\f\354\327=a\233\027\341Ok\376\206\240#pCP\362\325<\177\3374Nw\270@\317\217\305\376\217\371\037-r\017\360\037\260\357\357\377\336\375\236\\\020B\370o\346\311\324\315\3006{\260\221\377\203\1777\335\017\376\216^\023\r\203\204\337\336\026\236\360\024\370o\006j;\245\023\374\375\3025\300\337P(\360\252\240\273\\\017~{\301\253\330\034g\277U\362\337\016\272\354\221$=vK\374\026\311o\213\374\366+\204\317\177\020}c\321n\006QXhi\336\204\037\017\332\013\032yI\374v\202\337~\370[\312%\200\325\360["
+	.string	"x\300@\202\337V\360[\n\032\311\035\300\337<\356\005#\374\026\304\253|n\002\277}\340\377\003!n\006\327\322\307\262\f\230\370q\337oE\020\272\002@aM\270 N\370\316\217\323~\033\365[\016\277\325\361\333\034\177\343W\371o"
+	.string	"\376\356\272\030\374\026\204\337\232\370\355\007\277=\300o\025\360[\021~\233\302\236\260(F\034\204\345a\267\342\026\3748\253y\\\320!\256\341O?\230\273"
+	.string	"\370\357\257\005\277\345\362[+\177\337\370\033\307\375\360\3339\004t\006\267\202\277\315\374\215\001\005\026\356\036~\233d\233w\202\273\277\241\376\207\370\323"
+	.ascii	"\374\327\347\277\017\3747\303\177m\376\233\376\367\376\327\376"
+	.ascii	"\035\370\267\337\337|\177\347\375m\367\367\226\277\351\376N\373"
+	.ascii	"\033\312\337d\177\207\375\375\365\267\327\337I\376\326\372{\310"
+	.ascii	"\337X\177\033\340o\253\277}\374=\365w\216\277\241\376v\372\273"
+	.ascii	"\306\3372\376\206\3617\363o\016\374\235\201\277\223\177\027\377"
+	.ascii	"\036\372\373\002\177K\340\357\025\1777\340\267H\277\215\376\266"
+	.ascii	"\360\267^~\273\366[\233\337n\370-\210\337~\375\317\362\337\314"
+	.ascii	"o\245~+\343\267J\2775\341\267W\177\223\360\037\356\357\020\376"
+	.ascii	"\036\300\337!~;\364[\f\3746\002\177c\360\333\377m\301os\376\376"
+	.ascii	"\3607\316\337\035\376\276\371\333\346\357\232\377Z\376\263\370"
+	.ascii	"\017\342\177\230\377v\277\035\361[\021\177\253\377\t\377?\371"
+	.ascii	";\375\033\377}\377\356\277\355o\223\376\376o\375~\233\367\333"
+	.ascii	"/\277\275\373-\333o\323~+\345\267h\2775\373-\224\337B\177\033"
+	.ascii	"\366\333'\277\365\371\255\223\337\202\375\266\307\377\025\277"
+	.ascii	"\235\372-\217\337.\375\226\306og\374\266\371\333\030\277\205"
+	.ascii	"\361[\346oQ\370\355\t\377\241\3777\360_\356\177Oaaa\341\237s"
+	.ascii	"\302o\263\376\0364\005\370G\231%@+]\254\252\236L\352\246Di\314"
+	.ascii	"\001\313\211c\036o\230\007~\016\2339CY\300\303o\211T`v:3\370"
+	.ascii	"q\f\307\317\037O\341\036\326\013\346S\2425\2431\246\3729\216"
+	.ascii	"\001\207\006\r#\177\215m\241\345Q3d\313\243\336\346\t\336A$\006"
+	.ascii	"\323J\343\333d\255\267o8\n\353@\233*\243\303\306\261\216\177"
+	.ascii	"\203\016p\016\035\256.Lf\2151\016\0355\030}g\032\337\206\007"
+	.ascii	"\276\201\241\360\323\226\0215\247\306\330\t?\r\333\006\265\b"
+	.ascii	"y\302N/\271\277\251/\fX\205\241\3035\356\326\n\345%7\033\037"
+	.ascii	"\0207\375\037\326\304\355\305\221\341\246%\026\026\332\031\223"
+	.ascii	"V\021$c\314\306\230\206\321\007\023/\215o\303\3043\232\205:\310"
+	.ascii	"\b\301j,%\r\025^c\350\216\022\032lY\320\2336*\264\033\215o\326"
+	.ascii	"\3128Qk\254\243.!\"\303\r\332\225\204\026\244\361\217\2278\333"
+	.ascii	"%Js\2058\377\227\314\375\273\2058\317|\323c\255M\2561aJ$P\360"
+	.ascii	"\254\361\207d\326\237\213\346\002z\235\271{\036\230\315\023\004"
+	.ascii	"\233\244\271\203W\320\276]4W\357\327\314\rDs\313\\?\233/K\255"
+	.ascii	"\271;&\214\220\346\212?t[-\324\366\250>\226G\375\360l\375\360"
+	.ascii	"k\305P\333\243\376l\214_\246b\304/"
+	.ascii	"\252\323w\243\b\220\306\267O\214\037\036\334R\343\017\265\326"
+	.ascii	"\377\362\331\267+\306\346\357\310V[\343\003\336\275\377\303\027"
+	.ascii	"l\360A\357\336\r\323\005\257M\354\206\271z7\314\034\313\031\215"
+	.ascii	"?\244Z\377\013&\016\356\211\317\357\346\335/\275\346\325\365"
+	.ascii	"\365\373\345\377{\251\237\316\314A\275kS\242\303\273\223\032"
+	.ascii	"\323C\254\261\027\025\2133\372\245\361\207K\\n\335\325r\351n"
+	.ascii	"\227\273\305\276]\273\233\345W\316\216\035_\273\336\273W\256"
+	.ascii	"\230sec\312]\267\271-\\T\264D\257\335\305\222%z\253\274Y/:\313"
+	.ascii	"\f\231iG\307ew\341\362\322\217\203/\261\254\270\035<3gXt\360"
+	.ascii	"W\271\025\347l\375\372u\255\3302\263 h\032\177\375q\343\236s"
+	.ascii	"n\256\332\316\222\032\177\205Z\277\346\365g\266G}\r\230\365W"
+	.ascii	"\332\330r\366\002\241gj\277l\377]\273M6\354\352\005\226-5\276"
+	.ascii	"\226G\265i?\277j\267-.F\232)\355T\226\345OKZ\227\r\241^\221)"
+	.ascii	")\277hAt\244Y\322X\312''\216\214\220\030\316\256\031\030\223"
+	.ascii	"\034\246\3615\273@\316\034j\220\024:\215\211r\241\340\253\251"
+	.ascii	"\030^\310~\241\374\235v\313\206~\3166#\215q\266=\352\035\373"
+	.ascii	"\371%\263f7\242\2704N\200\230\2152I\302\020\201\366\016\225p"
+	.ascii	"\207\030YX\326\320\n\227\226\246'\035\230\270\305\200\345\344"
+	.ascii	"\202\345\r\3365i\374\025\365$\203\256\361k\350\326\333u\217\344"
+	.ascii	"E\247T],[\007D\204&W\242\267\311Ur\221\\&\327\353.\271I\354\333"
+	.ascii	"\355\272[\277\\\327\210\222e\363a\367t\322\234\237t\\N\"\200"
+	.ascii	"\261u\335\030\032\207\007f\363\204+[\2429CoW\353\270Z\036\230"
+	.ascii	"\315\006t\255u\214\256\373\264{\266\016H\306Ku\204T]9Co\3202"
+	.ascii	"\227\217"
+	.string	"\f\3705^kCm\217*\302\362\250\257)R\304\307:u\2512\330\3705X\353\377;\344\n\261o\227\310\005r\037h\316S\202\264\223\316RC\316?\276\270r\206^\"7\253\235l]\0244C\325\230=\005\251\002s\206\372\214\030\201\231d`\346T\374\032\346z5\315z5p\275V\367\207}\353p\257\362\216\035\003\204\371\324\370jt\345@\316\266\203j\013\013m\007\365*\230\365*\335z\265m\275j\266\376\227JD\316\031<fW\217@\265\331\006\2305\305\243\252\t]\263\261\324\231R[\231\272\274\306W\275\326\027\340\346\2705\364:p\262{:\027\344\374\fs\233n\216\213\303\356\351<A?\35495\351\322q\243\356\016\373vs\\\347\205\2726\356\215[hn*\345\234G\214\030\341\223\256\211\211\346X\361\325$\253\b\333\243\246\367\351\037\332\320\231\331\301\325\370j\221\365j\f\353\325\035\353U\034\253\317e\232"
+	.ascii	"\232\243\351\307R\b\245*i`4,\335\235q\233\352\236\215-S\326$"
+	.ascii	"m[Dd\004!\313\322$)\006\214\233\254-\314\274\306M\025\345\244"
+	.ascii	"S\272L\234\365\344\201\307,\003\001\253\245\273\306\267c\\\n"
+	.ascii	"\243S\232\212\211\030\316!\224]T\224Mn\t,\013\023W'a\351%\035"
+	.ascii	"\245\fY\311\252\211\213\315.M\247U\351+&b8\2075\310j\324\365"
+	.ascii	"\026\273f\227^\262ug)\300\b\275\364\027[w\226\"N\260L\357Y/\266"
+	.ascii	".*\204&\201|\355\347\201\331D!\352.;M\023v\341\315\r\330d\032"
+	.ascii	"\315Mj\301\036\3543\375\327\201m\306\276u\031+x\033\245\307t"
+	.ascii	"\322\034\2152\235\327al\335Y\212\2663R\3124]o\361\300l\346\244"
+	.ascii	"\252\020\2148\373\242\2019C\325\300\266A\257\0178\315\355\027"
+	.ascii	"U\317\304\366\364\240\371\310\027\266\255\356k1\352\023; Y\032"
+	.ascii	"?\375\262>\255[\237\302\255\030\t\232\225\237^\203\231\302\373"
+	.ascii	"\232\321\370\251\224\365)\224\325\306\313\311]ac\274\276\323"
+	.ascii	"Y\"\363\243K\343\247L\326\247[\353S\254\365\351\216\365)\323"
+	.ascii	"\372\224\271\376\275E\013\327\326\030_\343\272\035\034\302/;"
+	.ascii	"\037\215\217\005\327c\276\365\270n=\256\262\036G\211k+p;G\230"
+	.ascii	"\300\276\032\037\027\211\203K\341\322\226@\372\355\rw\351\204"
+	.ascii	" )\333\013C\022\205\325\370\270\252\255\335\330n\236\220\037"
+	.ascii	"e\215\217\225\332\330l\302\314\240\362\266\366f\023\223sCINJ"
+	.ascii	"\343V\353\035\205\202\205e\367o\375[\212-\334I\342\214jB;\263"
+	.ascii	"M&B\277\306fPL\307\3141\327\370Wo\215b\317\364\322\212\260\271"
+	.ascii	"\214\3645\264\225:\313D\f\347\002\254\006-\030\220\036\302L\363"
+	.ascii	"\003#\260)\346\253\235t\224.k\262~\322M\032\254\307\032J\213"
+	.ascii	"u\230}kh#y'i%\367\201\366\021\233\306D\f\347\320\211\214\017"
+	.ascii	"\332D\320D\033j\321l\340\025s\252p\327\214\346\234\177\240\275"
+	.ascii	"u\206\254\241\275\244\275t\226\031r\276\242\301\245\006\355\""
+	.ascii	"\2026dU\364\302D\200\377\356\262e\026\212\365r\001\0169|U\222"
+	.ascii	"\0206n&?\357.\033\030dBx4\266a^\326\r}\263\254\277p\353\357\224"
+	.ascii	"\365mP\326Gm\217\372\013\266\376\032i!\351\022\0273\254\016r"
+	.ascii	"\251V\254!\023)_7\032\377B\255\357\0302\302~\244l\330\205r\325"
+	.ascii	"D\261\362\352\031\275\344\344o\252\366\321W\035C[u\217~\366T"
+	.ascii	"\377\260o]\325<\336I\315\274OW5\214\263\034v\217\371\305\326"
+	.ascii	"U\335|\"\245\253\354\234\335B\206\026\265jL\215\303\326Ee\310"
+	.ascii	"Jd`\\9C\177\252ZG\3570\021\3039\\b6\211\216\360\031\321\001\321"
+	.ascii	"\233\2745(@\242O\375r\332r\bY{\240i\355\200D\357\327K\371|\236"
+	.ascii	"\227/\013Ra\251\013\363\334{\312Wh\203\314`\3434\f\206>\275\320"
+	.ascii	"\332i\f\f0Lp\355\020uw\227\346Y\264\245\326\334\005re\200_\236"
+	.ascii	"\346\255uU)l\234\342\245L+\2144M\332\304\254>q\\\270\244viPA"
+	.ascii	"\252\300!\235\227)N\272<\265k\247\232\261\277\274%\336\032\001"
+	.ascii	"\326\226-\\}Q\235\277\0327\234\215\257\001n\225\200\206\332S"
+	.ascii	"7\265\224\356\342\341\344\345X\256Q\303\226eH\232\300\334\214"
+	.ascii	"\022q#\266$\306\345\312S\272\247s\033tp\276\256%xI\215S\271\353"
+	.ascii	"D\321Q\2116~\212%\315\362\017m\220\\\2251i|\rK\326\023`,\307"
+	.ascii	"\323S\343\324\312\371\376\017;\t\037\223_\3434\356pQ_\002\263"
+	.ascii	"\340\264X\3311\033\247T\322*\366\355r\351\333\241;:Td\240\311"
+	.ascii	"5\276\206\255\365\366rj\007\354\345\324\224\355i\333?\034R\241"
+	.ascii	"\272\252j|\rY\353\237\256\375\303\032)x<\270\032_C\325z\r<\326"
+	.ascii	"\016\200ffiZ\264/\332\365\246\004\226%\345i\032\326\031*=\032"
+	.ascii	"\247h\251\224M\r@<$\215\3233\rLk\007/P\240\244Sv,\327\360q\203"
+	.ascii	"\366E\003\267\354ie\r\256\035\222\304\304R2\233\001\312\324\223"
+	.ascii	"\213Z\254'ZE\306\236\222\335<}\310\b\324[}\366\2348I\303|\236"
+	.ascii	"\027LT\220jg.k\313\231>y\032f\367\270~tY\323\262F\300\367\365"
+	.ascii	"\225j\331\261\\C5;\202\005\025\230s\224\b\033&\270\267\254&k"
+	.ascii	"\007\264%KR/\237\347\322\017\003\270#U\204\201+\232\037\230\223"
+	.ascii	"\256\247^s<\334\364\032\247L<\360\322\024\327\370\200\023\204"
+	.ascii	"Y\363\262\245\3613\330X#p\236\370\237rq\245I\354X\256q\242\256"
+	.ascii	"/\332\225s\224\b\225\316jFZ\212\344i\022\234+;\"VGp\240\313,"
+	.ascii	"\346\210\221\341\230\2750J:L\036\\Y\215\237a"
+	.string	"\271z\240Q\244H\252\365\fR*\0227\374\264\302DK\253\227\364\230\324m\355\255\036\260"
+	.string	"\001\222\016\351\234s\346\252\271bd-\252S\345\354\312\236\220\247C\244f\204\r6N\203\3308\225pL\tK\224\377\303\265I\226/?\267u\202\262\253\253\024\353\326\231sf\346L\325C\305\301\205"
+	.string	"Q;\246\306)\226\\\023\0254'k\0052\254\254R\2503nC@ u?\032\177gk\255\300GJ\225R\245>\374\242D\254J\234\\\214\244\317\247>\304\340L\355\351\ti\234\306\200O\004&q\333\241ZA\244\211\212J\247|\214\370\335\024\001\f|\222\362x:e\203\305c\t\226J\r\353\312\2249K\245\322\035\367\212\223\334\020\214\205\245\322\336\2604\276\016\341\232#v\342\351\215\033i\016\021\316\236\031*\004#bYq\2019Oe\200\317\244d\230Iq\330(P\262\267\306\320\rQL\234\032_\347o\rA$}J\237R(\253\346\303\346\314\222\037\023\240}K\241\322.I\264\2444\276\016]:#\255\221\316H\235\324\013\252h\2445h\244N6;{4=u\022\323\203)\005\253\361\001S\246 B\250\020\246L\351\222N\264))\006!S!\033\215\306\3279[\257Cd\345"
+	.ascii	"x\342\251\f\373\226\312\300y\330\314\331\206\005=\304p\254>O"
+	.ascii	"'\236\302xKa\\6\237\234\237~z\270\351\344\325\202\234\3464\247"
+	.ascii	"\314\016\302\374\322\244\247\314Gq2\027C\343t\211\335t\320\272"
+	.ascii	"\300\310\303RV\236`<\033?\247n\275@\313\2313\230\260\003bK\244"
+	.ascii	"\2720\241\024\2773V\032\3434o6|\230i\214\321\340\247\256\036"
+	.ascii	"B`4\306\202v\0133jJJ\030\016\r\250*T\215\237\323\266\006\340"
+	.ascii	"\t\020\020\233\321\200\214\333\022\251\3002\307f\302z\202tYi"
+	.ascii	"|\300\233\246\030\204b\215\237\363\225\207\373\3620\031u\314"
+	.ascii	"1\031\034\254\034U\2364\306~Q\020a'\300\340>0X\214\315\316\017"
+	.ascii	"J|,\221\n\344;\026c\275\254:dh\251\322\030\357\331-a\266\256"
+	.ascii	"\372\032\3430z9X\353sh\254\357\202\361\272\340;\0209[\350\263"
+	.ascii	"\2063G9E\004\200\317\016\343\331\341\273av\372i\260\305\207\227"
+	.ascii	"\343\273\0335<\25248|\353q\320V\013\304d\311\202\353\254\223"
+	.ascii	"-\307u\023\310\353zj\214\265`71cno\2151\035\226\002\263D\363"
+	.ascii	"\321\030\317\311\031Y\001\360\005\007\207\257\214\371Q\362d\345"
+	.ascii	"\370JM\237\017\246Uc\034\207\335v\n\327\314\004\301\241ZA4\327"
+	.ascii	"\326p\225\017\226K\244\272\250\034W\311Q\246\253\2531f\303n\377"
+	.ascii	"\207\026`\342\263sk+\243\002c\303l(\325\244\213]"
+	.string	"\343\003\246Ve\366\330\032\037g\271~0bv3<\305\346\234sT^\372\375\310\3719E\340)\203aqd\244\374\037\356\\%m)\301x\t*\252g\266\003\205\t\222\253\263Frod\331\362\303\303P\332k\310\025\225\306\277\241\202\3130\031\206\322\206\327\004\217\035\223\3310\365no\360\2531\026\353R\225\346\t\375?dq\247\267\005Cq\030\227\024\231\301\"59\230\202V\236\\ \266\007\024\221\260\306\024,9q\254\205\273\260\027\006\263\231\206\223\0015\364\242_\307`?\336\302\\\253\240\f/*\215q\223\237\343/\035\257e\017\255\306\023HY)H:\201\215\340#\307H\216\0043Ys\316Kh\256\3213\270\\\"\025\230\243\242Dt\032`T\f^r\314\244\363|\360\3115\306J\254\227\377\303\213G\304-Mc\234\344\006l\375o\337\277\232\223\2349g\250\024\232\235L\034\365\267\267\251\265\"\376\034{-"
+	.string	"\376\343\234O\002\t\232\223\312\354\345\234\355\337\212\204-\211\307\207\234\3269\233eUK\021\252\236\224\252t4\313\252\23644\313\252\362RIk\251\301\231\253\226\315\262\2345()-S<\237\232eIYC\263,?e\030]\236l\206V-\263\3223k\310J9)\227=\237>4\225\252\236\232eIO\032\232eUO\271\254*g\310JI\316\031J\331\251!\227U\371\345\262\347S\206f\331\363\251YV\245e\277f|EA\001\356]\351Y\277\246Rvj\232Jrf\250kB\2379/g{\026#;s]\316"
+	.string	"\310y\352\351\314K\322a\333\230uN\314)I\317\016ML\253gV\252[\332\\\327L\362\3149\t\323En\3129g\016\226\320\272\034\304\326-\177Le\246\0309G\220\24197\345\274\264\271.\347\274\3149\3278\247\2409Kehr55\345\034\345\323\224\247\226n1r\3563\275\266\247f\231\325\363\307-J\031W\226\001]\332&\3233s\345\274*\347Z\266\024\313L9gKf\345z\2621\246\261\215\332\036\225\202\246\225\303\223\023\307A\354\033\016\202\211\234"
+	.string	"\315K\233\264%\221\037\013\301Cn\023\347iu\205\320\252q\b\331\366\25057J\353\217\201d\341\024\341\203\261\2431\306\262~NiOf\002wA\242XdTv`qT\0244,&Y8\242\340"
+	.ascii	"$\321E\020V"
+	.string	"\036\2157\005e1YD\342\020\225\304\024CH-\2229E\242\026\304#\t:CH(\204\2109\305\244\021Q\320\216\320\3218\264\341X<2\322Y\241|QTA\350h\034\362\201AyTD\202\322X\224<\022\221,\222F\tV0b\341\"Hi\314\300\n!!\005\334 \225*\206\220Z$k\216\306\026\212(\356\202D\013G#R\231,Q\024B\"\n:\032K \223H%  \"B:\036\215\2165J\240\242\006\214I5\003FH\027J\243c\315\020\261H\204\225\305dQ\261H\035BBQT\032\221\021\020:\222\2403\204\324\"\371\200\007?,\b\021\213+\f!\265H\336\334\005\211\242\2422\tC\322\b\031d,R\357\202D\322\205\222X\024\301\006I\240\026/\b\001\231\bB\006\335h(\026\221%\274`\221T\341\"\211\244\202Gi<\242\220Ah\b\205$\261HT\\!YT\022\203\214\210\210\024"
+	.string	"A\n\b\204\212HE\244\007l\250\240(d\024t$a\007\006\242\243\342\n\033\206\220P\214 \201\006$\224H\342\021\211\026\216\306\243\221XT\\!YT\302\200\342\002\016\305\026\017\020\225\304\024B\036\216\304\021\"p\221D\252q\221DZq\224,\312y\220\021Y<\026[X\317\201\007\004\360\300\304\213\232\233"
+	.string	"A\003\0204Po\002\204\237\037\020<\370Y\357\301\317\325\200\304\020\022\n\027I\244\243aR\211\\\225E\240\0226|\b\t\205\022\311H\025:\022\213\212\214F8J\026AP\004Z\341(YtS\004\"*\211)\216\222)\034\215T(*\211HD\304\027H8J\026qP\336\005\t\240\240\241\022AC\312\027\305#^\211\214\312#\013BE\030\210DE!\234\240#R\t8I \030\220\312#\t.\202\224\304\243\244QhGid\344"
+	.string	"\003RY,*\022\025\225\034\222@-\030\207\216F#<\340B\222\230\302\321\310\250\f:\"\r\341\024\201P\200\340(Y\224<jA\303\213\242\320\021\205\242\222\210\024B\"\266"
+	.ascii	"za\324\302\205 \"Q\013\b\224wA\242g\204\234$\220\262\350B\020"
+	.ascii	"Q\305Q\262\350Fy\027$\206\220Z\2248\032\025\025\031\005Q t,\336"
+	.ascii	"$\320\020R\213\244\212T\036\335\032%\021R\262\210T\225\306\""
+	.ascii	"\343\r\316\261\204UY\324\2001\211\205\212.\004\021\217\324$\320"
+	.ascii	"\006\020@\026\205\210\305"
+	.ascii	"\023\216\222E9\311\026\210DC\251PQ\320-\221D\026_0\"\205 \220"
+	.ascii	"\241H\324\202\310\342\005\025Y4\016\031\225\307\242\220\321F"
+	.ascii	"\tT\0242JA\2114:\262)\n\031\025a%\220\003\224H\243\243\234\244"
+	.ascii	"QMQI\\A\b\211\330b-j\300\270\242\250\001\343\212U\271\"q\204"
+	.ascii	"\210\305\023\210\214D\026\310\342\320\020\022\212\027J\034\244"
+	.ascii	"R\205\317\013\244\rR\251\242\370\202\261\030T\\a\002\027\202"
+	.ascii	"\210-\210\210\210#\024\213\210\310\022^ w\224CH(\216\306t\250"
+	.ascii	"D\032\035\341\242\006\214"
+	.string	"+\210J\242\320\252bE\nBEAj\262\005\"Q\tBEA+PQI\264)*\211\312$PP\2152\tt\323\302\321(t,\036\325\f!\265\270\r\030Bj1D*U\034KXq\224,\3229\016\265\022h\203\002(_\024\225G\243\240\032e194d\244\272P\266p,\022\251EHI\027\202\212.\202\326\"b\021\251L\252H\245\n\025G\311\"\236$\220\022i\244\002\347XB2Y\f2B\252P&\215\216r\224w\341\341FGEd\t\245\221\021\262\304\215P\361\350\310\350B\262&\tt42*\217\214\310\240d\013\244\025.\222H*\216\222E=J \017~\224G#\322\232\024*\n\302J \023\312\243\021\251FyD2\nJ\213@\0208J\026\341\034\215\214Id\361\205\032%\020QITLQ,2*o\222,\b\031\031\221\305\243U\t\224d\241XdT\256\337\340\003\0166(@\321"
+	.string	"A$ \370\007\037\214\360\201\005\025LX\203H\020\021\215\310b\022\350(YT\342(YT\342h$\026\225\bB&K\220\220@\251"
+	.string	"\027I$\025\312\027\305\243\215\213$\322\021&22B\001\224\376W\345\256j\371\3259\225N'\313\225\025\247\306\366i{\324\r\226GU\263\374\\\225\273I\223\033\334j\314cy\324\232\252%UP\215\315\350,\345\245\365\260\242F\r\217\304\200\233\022\007\226\006\376\270\362\006\227B\355"
+	.string	"b\365\2262\323(\223*\276*Sn\004s(\001RQi"
+	.ascii	"R1\301r\253\202\267\326\272\250\251m\252\363\246\253\256N\355"
+	.ascii	"\204\345\330\263\261\210\246\024uM\212\2526\324\001C%\354I`\216"
+	.ascii	"\272!\342W\247\\U\333\321\313\202\313\322XM\263q]\b\213\230i"
+	.ascii	"|@ 8!\201\215\317s\007\006\347\324\370\303\232\032E=S\243\250"
+	.ascii	"f\303\037,b\252\331\320\b\022+\246\306\347i[\177\025J\336^\232"
+	.ascii	"\2152L\270\242\211!;C\226\362\345\220E\021f\031\253\203\222\253"
+	.ascii	"\270\240W\305^3\245\256\357\251\261\032\366s\025\272>\2270\261"
+	.ascii	"j\314\301\362\250\320\225\312\325\031\025'\370J\006%73*X\252"
+	.ascii	"5\203J\f\232\376J\303\326,Z7\244\2328\251hm\205L/\277\365\f\334"
+	.ascii	"\2153]\330\314\r\226\270\2703&\251\035.\202V\367g\344\352\222"
+	.ascii	"\377\332\2707T%8ktP\260\032\253H\324$W\225\250G\262\252\204\203"
+	.ascii	"g\316I\252\222\23549'\355\340&V[RT|\236\264\325\256\375\\5\202"
+	.ascii	"\177\224\251q\204\213l\303\262O\255\2670\231\373\307\344J\232"
+	.ascii	"V\032>\233\202\303L\221$Q\203Zt\215\325!Z\276\340\3455>\217\331"
+	.ascii	"\372\253B\360]\332%\266\207\244\261\232u;PXXX\230&\347$5\253"
+	.ascii	"\325 *\220\253Y\267\326\002k-\330\251\311\353j&\251X=\024\333"
+	.ascii	"\202F\353\312\253\257\374\256\300\3701es%f\216\313*\245\323\251"
+	.ascii	"\013+\fR\245.-SI\331\226\2174\007U\020\030x\352\223\310]\332"
+	.ascii	"\221&5\206@\263\300\260\035\215C\334\251R*\225*\245\366X\227"
+	.ascii	"5C\214\250SW{\340A<\260\300"
+	.string	"\306*\017\354\366#L\311]\223\325\247\307\215\033j\224\317\363\202\341\022\244\352\272\177ry3t\\\215\022c\245\304\3206\244\261\232\003CU50jM\032\2538\336w\003H\370\f$\262\372\254\251P*T\ne\306Ek.p\f\207YW\343\363\364X#PS\231T&\325\351\354\213\006\346\\\301\025\336\2515\256:\223\344\225\021l\254:\245R7\t\230\0311\032\253<5\326\b\230\310\220\241\322\260\031\240\314\273)\\\251\027\250\247\231:\343*\215\273\30043\032\253\315Tj\310\233\016$\017\224Y#8\243\302PaX\271nB\n\005\361V\t\376T\246\312\344\222#\004\207\226\f\267U\002(\202\202\352\322\347\271\364\013\001\316GV\\\215\025\250\0165_]\246RN\230\214\2715N\013\357\025\234\033Z\b\327\032\247\204\370*7i\342\245q:\330W\234\310\254\226\032\247i\272&\206[\033\216\306)\232\016\363\177\210"
+	.string	"0\3162\375\345\346\253\213`\336\330*\201\0202d\322@\237\347r\f\007n~Yq8>\330\006\303\374=\rL\315\230Yr\3033\223\226\231\233\262t\347\345\212\020K_\nx\263H\300\327T\303W8j\\\242\2505\376\003AV\237\256\276\276\324oCX[_\205\235\250\023\322\243ZT2\306(&\031bhhDh\2224\006s\025@ @<\032\026J\210\234{\023\300\004\313\213Ei\254\346\234S3##IR\220\312t\323Ub\021\3472oO\n\353\371h|\310\202\323Qe"
+	.string	"9~\215\363"
+	.string	"\300\264\036H\312\207\340\013\002\342iv\202\307\336 \261)\rS\0239\217i\223T\340\237,\221,w|\346\341\213\265\254\366\0134ix:S\203\353\177\345\233\260\251n:\250\300\212\0021\372\203&\006\335|W\367\235\341\026\364\240\256=\371\340b\214@\361cG\253\320\266\321,\257\372/i\342\375\223\247\245!8J\233\031\277\373h\026z\221\212x\224\030\2574\232\362\210\031\313\004!B\374F\360y\035,s\001\b\307y\253\177\313\020\021\315\234\027T\322\306"
+	.string	"\226r\301\026\005@\332\230\343\360\267\304t#\030VJt\221\016h1\271\005|\216\r,4\203\321.\tL\206|2,\243\333\232\202\f(\256\213\013\273\020QK\303iY5U\213\321U\0339\346\025ya/\205\324\316N(\\v\003\261Pe_\224/\232-d\017qP\257\003\374\006r\233\241\377\232\036\022\335b\373\b<\233;p\260h\003\233@\330\223;B.\374\222\343G\271\035po\366\002\310\2539\036~\372\321\017\027\252\033\203\351"
+	.string	"\264\315\325p\317\022\353\374\305\312wd\203\224\t8>\320\271w\272\032\243r\375\225\031\225\336%\226q6\024\037\206(PA\314\342\224R\377\332\tN\312\213rI\351\224\334.h\023\223\2136+o*S\361\211\333"
+	.string	"\226o^\222\030\024+MB|\200\013-D\301(\335\210\245#\002\rgw\340\227\202h\020@\362\350\272(\243h\272\254\221\f$\021\367Y\371\353\273\036\243\232k\345`\254g\306;\325\325\216\036\270>X\347\242\"\375\n\n\332ouG\364mF\245c\302A\005\230\234q\240\210,\320=AJO\177\245X\330W\266\034\212\211\301\2662cc\322\337!\037\036\375\370\347Ox\033h\331\005\3725l\223'\233\\\247"
+	.ascii	"\202\231\371\354T\023\376\217\373V\001j(.\024CqhC\035 +\016{"
+	.ascii	"\\|\005\345\262\021\347\033\334\204\364W\342\204W:g\032@\362"
+	.ascii	"+\321\253\206X\026!nF\205\377\340L:\211pJc\200/%n\nx\360\216"
+	.ascii	"p\177\024\207\221\310[\341>SwP \274\275\204\334\337\200\262I"
+	.ascii	"\355\274\260\203nZ\247Z\003\362\312\241\376\251\271\032\205\250"
+	.ascii	"q"
+	.string	"\232\373kYpQ<S\345\236\320!\023`\003k\314g\205\031\335*\255D\222a\315\322\370\207b/\365\337\232\t\356lw\256\233v\013Y~d\246\016^'\326\271\317y\334%\003\330\023\234\003\306\340W\035\352g\252\345\216g\322Lb\215\246\215^W\374\254S\320]\257\211\t\352\207E\231\023xt\242\247\260\212\f\232)\310d\341\266\231\360t\224\366\200\234Oy\274\r\233T\232\324R s8\022\237\212E\343@#\340\005r<d\024\322 <\237)8y\253\277\314\374\022\306\331\260'\026\013\244\206\334\235\213>\344Y\250nn\243}1\345,\205%\206\242\231\265!\001\335\346\240\030\251f\231p\032:F\231\n\214t\3037G\335\256\334\264\034t\311)\207\022\351\340?\2023\016\203`E\311\016\257\330hk\375B\310\200\200A8\263p)\023\f\334C\234\357\reb\005?\305\270\214\327975\262\242\264"
+	.string	"\375\264\311\\\\pN\361-R(}\330\3002\373\034\335Q\2029\342pZ1D,\021?\273\333\251\303\364`\025\320\205\317\361\265\030\337v\374\0321|\226o\n\315P\360\250\364\376\032\322\330L/\271\f\276\030\202-\340\n*\311\200\267\370\252\354\205\321E\247\037z\202V\021\017j\227\352\317\0364\221\311p\331\315\3334\212\266\254e\365\226\353\234\211\226\354A\222V\365\ntg\310\210\306\026\024"
+	.ascii	"Fy\025D\253\354\3121\204\341\301\213\001\327\256t\337M\006\243"
+	.ascii	"\354\013K\241\205\361X\3125rz;,\201\005\304\233Z\250\240\017"
+	.ascii	"\nWi&?\355\0236c\347\302\234\260\265ihH%\030\"\260\037\353o\037"
+	.ascii	"[\240\241\020\221F\032\307`:"
+	.string	"t\331#\025\027\354\340\240\252j\271b\004|\256q\265@cu\"\031@6\201\212\177\224\022\024]h\240I\271!\221r\365\032O%\324\333A\272\335\335\323M\334^1}U9N{k\255\017\367\225\306\324\024\236\262C\316\205\233\237<7#\213:<N\347hBU*\321\201\276\246\347\344\300\217W\256v\"\364\247TX\250\352+9\322\363F\242\343\353\345\367\355\037\022\3067\355\311\270x\366\212%R\312Q\001\255\006e\201\306g\234|%\001\326u|\316\341\363]:M\023I\271\300<\355\256\002\367S~\313&\237\332\013O\364\377\201\300\352K\340\0212I\037l%d8g\035\271\362\024\224\340\225\214\354\262\275MZ2h#A\331\240\342T\257\266\240\037\n\351=^)\035\243Yc\221\262\254\212\024\214\031\272\t\224\\\325!\365 \021\037\274f\237|s\200\033^$dtR)UB\307\207\247v\257\255\023N\266"
+	.ascii	")\200\301}Q\240\340\264\310|e\356\034\305\340\221\024I\016\033"
+	.ascii	"Y\263\315\222 \331\345\337;\203\270)O\302\334\003O\215\001\017"
+	.ascii	"\352\330\302\225\037\303t\243P\031\212\"\f\377\026/S\311&\"\256"
+	.ascii	"\322\204\3316\260U\261\177\346\2527\007\035J\236"
+	.string	"Ou\237\276\203\004\374\230\270\203u##G\322\200\026\037b\237\216a\336L 1R<\301\323U\354s))S\022B\222\341\211%(\236\251\210\2150s\342\025&\315\2000\377\206\270\354\222\2225\245\331\214\214\277\2200\322^\200w\232\";u*t>.W\300 L(\355\305R\362[P\2058\234G'\021{\342=\252\242\007\313\026\237~\375\206\246\275\005\377R\340\253\357\004\314\246I\300\312*\330\305\302a\205\226\264r\343\215_\241\270K\252E%9\026\271\352\227\277\222\372`qc\370\220*\273p\262F\213kb3\351\003\301n\321:\326@?{\200P\346a\225\206\241\027\275\3540j|\210ve\216\241\262f\320\257\361\207\3040\253-=\224\366^\034j%c\007Q\2321z\273\327D\225\3666\026\243\231\3045\301\030B\357\0305\343\216\325\032\023\270\301;(\207\325\257\b\304D\331g3y\201\013%\332\027"
+	.string	"\371XkQ"
+	.string	"\351\364\251\244B\340\202\370\207\347\314\005\200(\341\333\354c\246&Z\2376V\306\037\323z"
+	.string	"6\036\317\375Y\316\330\242\250fSsu\235\213\233\216\320e\212\376s\375\036\004\317\360=\212?!\242l\272\276\031\331\216\302\206\227\203G^\214\003}\317\337\033n\036$\001\036\027\360S\032>q\207-\313\366s\313\001i\264\336`Xu\372S\241JF"
+	.string	"y\b\204\341DVI\307I\b\326\331c\265\317~\205\305\333\001l\214y\206E\307r\340\270\343\223\017\275\003:\026\322\205\023\226\020O\205Y\367M\363\0275\313\216\240\362\200 k\034h\f\267\217\t\256\251\274W\200\276\013*N>\365\370+^\333\360\242\273=Z&rZ\020 D\216\271\"\203\340\260\251\244\202\224<\020"
+	.string	"\300[_\016\213\333\306-%\004\030\031}n\222\244\035Q0;\243[\316\300\205 \376\034\320\374\341W-\310\001`\200\026\260\2370K!\332\306\t\307\343\375\177\252Z\215p&\354\220\210\\\n\372\227\027F\270\345\215\260\370\fF\3072w\317\265\362;`\266\243\017\271n\t\324TJ\3501/s\"\257\240"
+	.string	"b\201\224\342\252\201\265\313\250\244\177\216\330\215\266<\257\276\240\2100Z\263\213\321\375e4I"
+	.string	"\013\031\346\305\203\3603$hkB\331\237?e\r#\313%k\3040\302\332\260Ij\b%\232\244\006r\200H\206xhF\032+!\f\002\001\007\207\344|\317\260\0314\003\006/5\t\261\206%\377\346Vn\002\376\314\030\225XfE\237B0\227\031\033I\300\224+\364m\032/\336\331\205OtG\326(X\336\247\346\311C\234\342(S\030\007w\313Z\231\305\203X\013\217\366\245PA\3356\317,1\206-'\231\f&\311>\342y\024\032.}8\035\236C\210\264\306B\267\216\242LV\344\b\3347\204y*\003'\232\016\243\267\354\006"
+	.string	"nXn\224w\352\fxXl\327\211\362\220p\035\302\\\216I;\252\fS\256\b\006\355\256\305\277ne\301\201"
+	.string	"\251\032\033\037s\037;\317\211\t#\310\2765\305\231\236\257g\372\271\347\351I\302N\300m\225\306\200\004wtCl\367\245\026(\032Y\237\211b\314\330L\227"
+	.string	"\263\005\365;\371\271\364\237KK\024i\272B\370\377\207U\364\016\342\273\032yu\352>\265a8\215\343C\370\210\215\307\031v\002cVc\375\235(\313\214S\361\223\305\374\277\371\300\340j\343\352\301\235\367\323\216`]\221\264,E\237\212<\2710\230xF^\304\001\020\373\006\264o\353\\j\325<\001Q\326\2744\2743\371{2\267$?m\005\207\021qM\367:\246\376s\334\013\231\360\337\367~\376\235>\360\223\0307\226\256\265\255\266\313TST^c{\020\032\327\310\224\035\n\326,W^\177\342-\300\377K\350.\255\217\t^\2424[Z\377C\0249\331\274t\350\326\310\256\235uk\304#H\261\223\264c\244\206\364\333E\304\215"
+	.string	"g\313\351\311\3566\327O\363\317\361\263,\334\301\261w\272\217\221\265\244\340\"\367\327e\272t\250\307\271\363\025\326i\t\255\324\374\022\327\370"
+	.string	"\222+\233S+\243\306\214\351}\250\323\b\322~\004t\202\275\276\026\270\311\336]S\177\030\350:(\357\321\344\264\364\377\243\0138\360"
+	.ascii	"\037\337M\343E*o!y\316m\276\365oPp.q\271\023z\356C\361\216\244"
+	.ascii	"g\017i\251\213'\216]\233\214\222\355#\321Yt\335\2117\323.\362"
+	.ascii	"\373w\363\203Q\326\272*\034F6\002\303\330\306\241\204\223nf="
+	.ascii	"\026\013\264\177Ul\260\347"
+	.ascii	"\276\325\214\323?\363\263\214\220\215\n\317;|&\243\331^7Dq\263"
+	.ascii	"\373\001\361}f\332?\343\367\300\030\203~G\360\213\241\357\210"
+	.ascii	">\353>\344\247\321\276{\006\373\031\nt\033\315\343\3506ZpT\361"
+	.ascii	"\224d\220z7\033X`\374\322\233h\340o\272\331\207\317\313\312-"
+	.ascii	"\356\241r\177\260\034)\371\233\316_\343>\236\354\214&\326\t\326"
+	.ascii	"\021\234as\001\372\372m\337fgc\340c\3467\335\032\371\271\300"
+	.ascii	"\337\367W\332Xeoq\307\201C\267\237\233Y\231\304\227\305~\365"
+	.ascii	"\330G\332\227\307+\017\272\377\237\213\266\223 \237I\233~w9|"
+	.ascii	"\223G\334\005C\017\276}=[\274\034],\003AS\322H\234S\022\373b"
+	.ascii	"\016\206}\335\364\327\271#\316\177\344\363=\265\330\023\370\214"
+	.ascii	"\346\001\375y\2643\274%\024\317\024\036\315\324\224\234\373L"
+	.ascii	"\376\344\373x\r\210\242\017\255\241\334S\007\275L8|\324\374\272"
+	.ascii	"\372\310\332\241\215\247\252\327\373\313\206.[c\234?*\263\016"
+	.ascii	"_$\310]\001"
+	.text
+	.section	.gnu.lto_.symtab.2e37fb9b28356d3d,"e",@progbits
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\002"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"mspSerialPushPeriod"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"mspSerialPushSubscriptions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"dispatchAdd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"findNextSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"serialEvaluateNonMspData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"serialReadBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"dispatchEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2e37fb9b28356d3d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,15872 @@
+	.file	"rx.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/filter.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/fc/config.h"
+	.file 8 "./src/main/fc/rc_controls.h"
+	.file 9 "./src/main/common/time.h"
+	.file 10 "./src/main/rx/rx.h"
+	.file 11 "./src/main/rx/rx.c"
+	.file 12 "./src/main/flight/failsafe.h"
+	.file 13 "/usr/include/string.h"
+	.file 14 "./src/main/common/maths.h"
+	.file 15 "./src/main/rx/msp.h"
+	.file 16 "./src/main/config/feature.h"
+	.file 17 "./src/main/drivers/system.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rx.c.46564fa3
+	.weak	rx.c.46564fa3
+rx.c.46564fa3:
+	.long	0x10ce
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2a
+	.long	.LASF2103
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1776
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1777
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1778
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1779
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1780
+	.uleb128 0x3
+	.long	.LASF1781
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1782
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1783
+	.uleb128 0x3
+	.long	.LASF1784
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1785
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF1786
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1787
+	.uleb128 0x2c
+	.byte	0x8
+	.uleb128 0x5
+	.long	0xa2
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1788
+	.uleb128 0x7
+	.long	0xa2
+	.uleb128 0x3
+	.long	.LASF1789
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1790
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1791
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x7
+	.long	0xc6
+	.uleb128 0x3
+	.long	.LASF1792
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1793
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x7
+	.long	0xe3
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1794
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1795
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1796
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x5
+	.byte	0x3c
+	.long	0x12c
+	.uleb128 0x1
+	.long	.LASF1797
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1798
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1799
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1800
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xd7
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x166
+	.uleb128 0xf
+	.long	.LASF1801
+	.value	0xfff
+	.uleb128 0xf
+	.long	.LASF1802
+	.value	0xf000
+	.uleb128 0xf
+	.long	.LASF1803
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1804
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1805
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1806
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xf
+	.long	0x172
+	.uleb128 0x2d
+	.long	0x182
+	.uleb128 0x8
+	.long	0x9b
+	.uleb128 0x8
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2e
+	.byte	0x8
+	.byte	0x4
+	.byte	0x35
+	.byte	0x5
+	.long	0x1a1
+	.uleb128 0x22
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x9b
+	.uleb128 0x22
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x1a1
+	.byte	0
+	.uleb128 0x5
+	.long	0x166
+	.uleb128 0x13
+	.long	.LASF1935
+	.byte	0x20
+	.byte	0x4
+	.byte	0x30
+	.long	0x1f4
+	.uleb128 0x18
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xb
+	.long	0x12c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1807
+	.byte	0x4
+	.byte	0x32
+	.byte	0xe
+	.long	0xd7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1808
+	.byte	0x4
+	.byte	0x33
+	.byte	0xe
+	.long	0x1f4
+	.byte	0x8
+	.uleb128 0x18
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x34
+	.byte	0xf
+	.long	0x1f9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1809
+	.byte	0x4
+	.byte	0x38
+	.byte	0x7
+	.long	0x182
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	0xc6
+	.uleb128 0x5
+	.long	0x1f4
+	.uleb128 0x3
+	.long	.LASF1810
+	.byte	0x4
+	.byte	0x39
+	.byte	0x3
+	.long	0x1a6
+	.uleb128 0x7
+	.long	0x1fe
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1811
+	.uleb128 0x7
+	.long	0x20f
+	.uleb128 0x5
+	.long	0xd2
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x346
+	.uleb128 0x1
+	.long	.LASF1812
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1813
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1814
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1816
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1818
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1819
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1820
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1821
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1822
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1823
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1824
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1825
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1826
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1827
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1828
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1829
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1830
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1831
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1832
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1833
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1834
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1836
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1840
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1841
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1848
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1849
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1850
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1851
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x7
+	.byte	0x23
+	.long	0x422
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0x80
+	.uleb128 0xf
+	.long	.LASF1866
+	.value	0x100
+	.uleb128 0xf
+	.long	.LASF1867
+	.value	0x200
+	.uleb128 0xf
+	.long	.LASF1868
+	.value	0x400
+	.uleb128 0xf
+	.long	.LASF1869
+	.value	0x1000
+	.uleb128 0xf
+	.long	.LASF1870
+	.value	0x2000
+	.uleb128 0xf
+	.long	.LASF1871
+	.value	0x4000
+	.uleb128 0xf
+	.long	.LASF1872
+	.value	0x8000
+	.uleb128 0xb
+	.long	.LASF1873
+	.long	0x10000
+	.uleb128 0xb
+	.long	.LASF1874
+	.long	0x20000
+	.uleb128 0xb
+	.long	.LASF1875
+	.long	0x40000
+	.uleb128 0xb
+	.long	.LASF1876
+	.long	0x80000
+	.uleb128 0xb
+	.long	.LASF1877
+	.long	0x100000
+	.uleb128 0xb
+	.long	.LASF1878
+	.long	0x200000
+	.uleb128 0xb
+	.long	.LASF1879
+	.long	0x400000
+	.uleb128 0xb
+	.long	.LASF1880
+	.long	0x800000
+	.uleb128 0xb
+	.long	.LASF1881
+	.long	0x1000000
+	.uleb128 0xb
+	.long	.LASF1882
+	.long	0x2000000
+	.uleb128 0xb
+	.long	.LASF1883
+	.long	0x4000000
+	.uleb128 0xb
+	.long	.LASF1884
+	.long	0x8000000
+	.uleb128 0xb
+	.long	.LASF1885
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x8
+	.byte	0x18
+	.long	0x4ee
+	.uleb128 0x1
+	.long	.LASF1886
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1887
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1890
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1892
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1893
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1894
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1895
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1896
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1897
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1898
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1899
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1900
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1901
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1902
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1903
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1904
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1905
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1906
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1907
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1908
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1909
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1910
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1911
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1912
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1913
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1914
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1915
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1916
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1917
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1918
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x3
+	.long	0x422
+	.uleb128 0xe
+	.long	.LASF1945
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0x2f
+	.long	.LASF2104
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x8
+	.byte	0x41
+	.byte	0xe
+	.long	0x561
+	.uleb128 0x1
+	.long	.LASF1919
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1920
+	.byte	0x1
+	.uleb128 0x30
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1921
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1922
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1924
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1925
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1926
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1927
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1928
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1929
+	.byte	0xb
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x8
+	.byte	0x5c
+	.long	0x58b
+	.uleb128 0x1
+	.long	.LASF1930
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1931
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1932
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1933
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1934
+	.byte	0x4
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1936
+	.byte	0x2
+	.byte	0x8
+	.byte	0x88
+	.long	0x5b2
+	.uleb128 0x2
+	.long	.LASF1937
+	.byte	0x8
+	.byte	0x89
+	.byte	0xd
+	.long	0xc6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1938
+	.byte	0x8
+	.byte	0x8a
+	.byte	0xd
+	.long	0xc6
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1939
+	.byte	0x8
+	.byte	0x8b
+	.byte	0x3
+	.long	0x58b
+	.uleb128 0x13
+	.long	.LASF1940
+	.byte	0x8
+	.byte	0x8
+	.byte	0x8d
+	.long	0x5f2
+	.uleb128 0x2
+	.long	.LASF1941
+	.byte	0x8
+	.byte	0x8e
+	.byte	0xd
+	.long	0x4ee
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1942
+	.byte	0x8
+	.byte	0x8f
+	.byte	0xd
+	.long	0xc6
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1943
+	.byte	0x8
+	.byte	0x90
+	.byte	0x14
+	.long	0x5b2
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1944
+	.byte	0x8
+	.byte	0x91
+	.byte	0x3
+	.long	0x5be
+	.uleb128 0x7
+	.long	0x5f2
+	.uleb128 0x10
+	.long	0x5f2
+	.long	0x613
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1946
+	.byte	0x8
+	.byte	0x93
+	.byte	0x22
+	.long	0x603
+	.uleb128 0x3
+	.long	.LASF1947
+	.byte	0x9
+	.byte	0x19
+	.byte	0x11
+	.long	0xba
+	.uleb128 0x3
+	.long	.LASF1948
+	.byte	0x9
+	.byte	0x21
+	.byte	0x12
+	.long	0xe3
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xa
+	.byte	0x2b
+	.long	0x655
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1950
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1951
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1952
+	.byte	0xa
+	.byte	0x4c
+	.byte	0x11
+	.long	0xd7
+	.uleb128 0x10
+	.long	0xa9
+	.long	0x66c
+	.uleb128 0x31
+	.byte	0
+	.uleb128 0x7
+	.long	0x661
+	.uleb128 0xe
+	.long	.LASF1953
+	.byte	0xa
+	.byte	0x4e
+	.byte	0x13
+	.long	0x66c
+	.uleb128 0x10
+	.long	0xae
+	.long	0x68d
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1954
+	.byte	0xa
+	.byte	0x50
+	.byte	0x10
+	.long	0x67d
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xa
+	.byte	0x58
+	.long	0x6bd
+	.uleb128 0x1
+	.long	.LASF1955
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1956
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1957
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1958
+	.byte	0x3
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1959
+	.byte	0x2
+	.byte	0xa
+	.byte	0x68
+	.long	0x6e4
+	.uleb128 0x2
+	.long	.LASF1960
+	.byte	0xa
+	.byte	0x69
+	.byte	0xd
+	.long	0xc6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1961
+	.byte	0xa
+	.byte	0x6a
+	.byte	0xd
+	.long	0xc6
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1962
+	.byte	0xa
+	.byte	0x6b
+	.byte	0x3
+	.long	0x6bd
+	.uleb128 0x7
+	.long	0x6e4
+	.uleb128 0x10
+	.long	0x6e4
+	.long	0x705
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1963
+	.byte	0xa
+	.byte	0x6d
+	.byte	0x22
+	.long	0x6f5
+	.uleb128 0x13
+	.long	.LASF1964
+	.byte	0x4
+	.byte	0xa
+	.byte	0x6f
+	.long	0x738
+	.uleb128 0x18
+	.string	"min"
+	.byte	0xa
+	.byte	0x70
+	.byte	0xe
+	.long	0xd7
+	.byte	0
+	.uleb128 0x18
+	.string	"max"
+	.byte	0xa
+	.byte	0x71
+	.byte	0xe
+	.long	0xd7
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1965
+	.byte	0xa
+	.byte	0x72
+	.byte	0x3
+	.long	0x711
+	.uleb128 0x7
+	.long	0x738
+	.uleb128 0x10
+	.long	0x738
+	.long	0x759
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1966
+	.byte	0xa
+	.byte	0x74
+	.byte	0x1f
+	.long	0x749
+	.uleb128 0x13
+	.long	.LASF1967
+	.byte	0x2c
+	.byte	0xa
+	.byte	0x76
+	.long	0x8b7
+	.uleb128 0x2
+	.long	.LASF1968
+	.byte	0xa
+	.byte	0x77
+	.byte	0xd
+	.long	0x8bc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1969
+	.byte	0xa
+	.byte	0x78
+	.byte	0xd
+	.long	0xc6
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1970
+	.byte	0xa
+	.byte	0x79
+	.byte	0xd
+	.long	0xc6
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1971
+	.byte	0xa
+	.byte	0x7a
+	.byte	0xd
+	.long	0xc6
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1972
+	.byte	0xa
+	.byte	0x7b
+	.byte	0xd
+	.long	0xc6
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1973
+	.byte	0xa
+	.byte	0x7c
+	.byte	0xe
+	.long	0xe3
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1974
+	.byte	0xa
+	.byte	0x7d
+	.byte	0xd
+	.long	0xc6
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1975
+	.byte	0xa
+	.byte	0x7e
+	.byte	0xd
+	.long	0xc6
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1976
+	.byte	0xa
+	.byte	0x7f
+	.byte	0xd
+	.long	0xc6
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1977
+	.byte	0xa
+	.byte	0x80
+	.byte	0xd
+	.long	0xc6
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1978
+	.byte	0xa
+	.byte	0x81
+	.byte	0xd
+	.long	0xc6
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1979
+	.byte	0xa
+	.byte	0x82
+	.byte	0xd
+	.long	0xc6
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1980
+	.byte	0xa
+	.byte	0x83
+	.byte	0xe
+	.long	0xd7
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1981
+	.byte	0xa
+	.byte	0x84
+	.byte	0xe
+	.long	0xd7
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1982
+	.byte	0xa
+	.byte	0x85
+	.byte	0xe
+	.long	0xd7
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1983
+	.byte	0xa
+	.byte	0x86
+	.byte	0xd
+	.long	0xc6
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1984
+	.byte	0xa
+	.byte	0x87
+	.byte	0xd
+	.long	0xc6
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF1985
+	.byte	0xa
+	.byte	0x88
+	.byte	0xd
+	.long	0xc6
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1986
+	.byte	0xa
+	.byte	0x89
+	.byte	0xd
+	.long	0xc6
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF1987
+	.byte	0xa
+	.byte	0x8a
+	.byte	0xd
+	.long	0xc6
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1988
+	.byte	0xa
+	.byte	0x8b
+	.byte	0xd
+	.long	0xc6
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF1989
+	.byte	0xa
+	.byte	0x8c
+	.byte	0xd
+	.long	0xc6
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1990
+	.byte	0xa
+	.byte	0x8d
+	.byte	0xe
+	.long	0xd7
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1991
+	.byte	0xa
+	.byte	0x8f
+	.byte	0xe
+	.long	0xd7
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1992
+	.byte	0xa
+	.byte	0x90
+	.byte	0xe
+	.long	0xd7
+	.byte	0x28
+	.byte	0
+	.uleb128 0x7
+	.long	0x765
+	.uleb128 0x10
+	.long	0xc6
+	.long	0x8cc
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1993
+	.byte	0xa
+	.byte	0x91
+	.byte	0x3
+	.long	0x765
+	.uleb128 0x7
+	.long	0x8cc
+	.uleb128 0xe
+	.long	.LASF1994
+	.byte	0xa
+	.byte	0x93
+	.byte	0x13
+	.long	0x8cc
+	.uleb128 0x3
+	.long	.LASF1995
+	.byte	0xa
+	.byte	0x98
+	.byte	0x14
+	.long	0x8f5
+	.uleb128 0x5
+	.long	0x8fa
+	.uleb128 0x32
+	.long	0xd7
+	.long	0x90e
+	.uleb128 0x8
+	.long	0x90e
+	.uleb128 0x8
+	.long	0xc6
+	.byte	0
+	.uleb128 0x5
+	.long	0x961
+	.uleb128 0x13
+	.long	.LASF1996
+	.byte	0x20
+	.byte	0xa
+	.byte	0x9c
+	.long	0x961
+	.uleb128 0x2
+	.long	.LASF1997
+	.byte	0xa
+	.byte	0x9d
+	.byte	0xd
+	.long	0xc6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1998
+	.byte	0xa
+	.byte	0x9e
+	.byte	0xe
+	.long	0xd7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1999
+	.byte	0xa
+	.byte	0x9f
+	.byte	0x18
+	.long	0x8e9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2000
+	.byte	0xa
+	.byte	0xa0
+	.byte	0x18
+	.long	0x966
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2001
+	.byte	0xa
+	.byte	0xa1
+	.byte	0x18
+	.long	0x97c
+	.byte	0x18
+	.byte	0
+	.uleb128 0x7
+	.long	0x913
+	.uleb128 0x3
+	.long	.LASF2002
+	.byte	0xa
+	.byte	0x99
+	.byte	0x13
+	.long	0x972
+	.uleb128 0x5
+	.long	0x977
+	.uleb128 0x23
+	.long	0xc6
+	.uleb128 0x3
+	.long	.LASF2003
+	.byte	0xa
+	.byte	0x9a
+	.byte	0x14
+	.long	0x988
+	.uleb128 0x5
+	.long	0x98d
+	.uleb128 0x23
+	.long	0x62b
+	.uleb128 0x3
+	.long	.LASF2004
+	.byte	0xa
+	.byte	0xa2
+	.byte	0x3
+	.long	0x913
+	.uleb128 0x7
+	.long	0x992
+	.uleb128 0xe
+	.long	.LASF2005
+	.byte	0xa
+	.byte	0xa4
+	.byte	0x1a
+	.long	0x992
+	.uleb128 0x10
+	.long	0xa9
+	.long	0x9bf
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x14
+	.byte	0
+	.uleb128 0x7
+	.long	0x9af
+	.uleb128 0x33
+	.long	0x671
+	.byte	0xb
+	.byte	0x42
+	.byte	0xc
+	.long	0x9bf
+	.uleb128 0x14
+	.long	0x655
+	.byte	0x44
+	.byte	0xa
+	.uleb128 0xa
+	.long	.LASF2006
+	.byte	0x46
+	.byte	0xc
+	.long	0x20f
+	.uleb128 0xa
+	.long	.LASF2007
+	.byte	0x47
+	.byte	0xc
+	.long	0x20f
+	.uleb128 0xa
+	.long	.LASF2008
+	.byte	0x48
+	.byte	0xc
+	.long	0x20f
+	.uleb128 0xa
+	.long	.LASF2009
+	.byte	0x49
+	.byte	0xc
+	.long	0x20f
+	.uleb128 0xa
+	.long	.LASF2010
+	.byte	0x4a
+	.byte	0xc
+	.long	0x20f
+	.uleb128 0xa
+	.long	.LASF2011
+	.byte	0x4b
+	.byte	0xc
+	.long	0x20f
+	.uleb128 0xa
+	.long	.LASF2012
+	.byte	0x4d
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0xa
+	.long	.LASF2013
+	.byte	0x4e
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0xa
+	.long	.LASF2014
+	.byte	0x4f
+	.byte	0x11
+	.long	0x62b
+	.uleb128 0xa
+	.long	.LASF2015
+	.byte	0x50
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0xa
+	.long	.LASF2016
+	.byte	0x51
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0xa
+	.long	.LASF2017
+	.byte	0x52
+	.byte	0x10
+	.long	0xc6
+	.uleb128 0x24
+	.long	.LASF2018
+	.byte	0x54
+	.byte	0x9
+	.long	0x67d
+	.uleb128 0x14
+	.long	0x68d
+	.byte	0x55
+	.byte	0x9
+	.uleb128 0x10
+	.long	0xe3
+	.long	0xa7d
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x11
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2019
+	.byte	0x56
+	.byte	0xa
+	.long	0xa6d
+	.uleb128 0x14
+	.long	0x9a3
+	.byte	0x61
+	.byte	0x13
+	.uleb128 0xa
+	.long	.LASF2020
+	.byte	0x62
+	.byte	0x10
+	.long	0xc6
+	.uleb128 0x14
+	.long	0x8dd
+	.byte	0x6f
+	.byte	0x3a
+	.uleb128 0xe
+	.long	.LASF2021
+	.byte	0xb
+	.byte	0x6f
+	.byte	0x65
+	.long	0x20a
+	.uleb128 0x1d
+	.long	0xaa1
+	.byte	0x8b
+	.uleb128 0x14
+	.long	0x759
+	.byte	0x92
+	.byte	0x5f
+	.uleb128 0xe
+	.long	.LASF2022
+	.byte	0xb
+	.byte	0x92
+	.byte	0x9f
+	.long	0x20a
+	.uleb128 0x1d
+	.long	0xaba
+	.byte	0xd2
+	.uleb128 0x14
+	.long	0x705
+	.byte	0x9c
+	.byte	0x68
+	.uleb128 0xe
+	.long	.LASF2023
+	.byte	0xb
+	.byte	0x9c
+	.byte	0xac
+	.long	0x20a
+	.uleb128 0x1d
+	.long	0xad3
+	.byte	0xe2
+	.uleb128 0xa
+	.long	.LASF2024
+	.byte	0xbf
+	.byte	0x10
+	.long	0xc6
+	.uleb128 0x1e
+	.long	.LASF2027
+	.byte	0xd
+	.byte	0xf6
+	.byte	0xe
+	.long	0x9d
+	.long	0xb0b
+	.uleb128 0x8
+	.long	0xfb
+	.uleb128 0x8
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2025
+	.byte	0x5b
+	.uleb128 0x1f
+	.long	.LASF2026
+	.byte	0x5a
+	.uleb128 0x1e
+	.long	.LASF2028
+	.byte	0xe
+	.byte	0x59
+	.byte	0x5
+	.long	0x7c
+	.long	0xb41
+	.uleb128 0x8
+	.long	0x7c
+	.uleb128 0x8
+	.long	0x7c
+	.uleb128 0x8
+	.long	0x7c
+	.uleb128 0x8
+	.long	0x7c
+	.uleb128 0x8
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2029
+	.byte	0x58
+	.uleb128 0x25
+	.long	.LASF2030
+	.byte	0xc
+	.byte	0x57
+	.long	0xb58
+	.uleb128 0x8
+	.long	0xe3
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2033
+	.byte	0x1b
+	.long	0xe3
+	.uleb128 0x25
+	.long	.LASF2031
+	.byte	0xf
+	.byte	0x16
+	.long	0xb78
+	.uleb128 0x8
+	.long	0xb78
+	.uleb128 0x8
+	.long	0xb7d
+	.byte	0
+	.uleb128 0x5
+	.long	0x8b7
+	.uleb128 0x5
+	.long	0x913
+	.uleb128 0x1e
+	.long	.LASF2032
+	.byte	0x10
+	.byte	0x1e
+	.byte	0x5
+	.long	0x20f
+	.long	0xb98
+	.uleb128 0x8
+	.long	0xe3
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2034
+	.byte	0x1d
+	.long	0xe3
+	.uleb128 0x19
+	.long	.LASF2035
+	.value	0x2b9
+	.byte	0xa
+	.long	0x62b
+	.uleb128 0x19
+	.long	.LASF2036
+	.value	0x2b4
+	.byte	0xa
+	.long	0xd7
+	.uleb128 0x15
+	.long	.LASF2037
+	.value	0x2aa
+	.long	0xbd2
+	.uleb128 0x6
+	.long	.LASF2039
+	.value	0x2aa
+	.byte	0x1a
+	.long	0x62b
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2038
+	.value	0x2a3
+	.long	0xbea
+	.uleb128 0x6
+	.long	.LASF2040
+	.value	0x2a3
+	.byte	0x1d
+	.long	0xd7
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2041
+	.value	0x27b
+	.long	0xc02
+	.uleb128 0x6
+	.long	.LASF2039
+	.value	0x27b
+	.byte	0x24
+	.long	0x62b
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2042
+	.value	0x269
+	.long	0xc1a
+	.uleb128 0x4
+	.long	.LASF2043
+	.value	0x26b
+	.byte	0xd
+	.long	0xae
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2044
+	.value	0x25f
+	.long	0xc56
+	.uleb128 0x6
+	.long	.LASF2045
+	.value	0x25f
+	.byte	0x22
+	.long	0xfb
+	.uleb128 0x6
+	.long	.LASF2046
+	.value	0x25f
+	.byte	0x35
+	.long	0xc56
+	.uleb128 0x9
+	.uleb128 0x1b
+	.string	"c"
+	.value	0x261
+	.byte	0x16
+	.long	0xfb
+	.uleb128 0x9
+	.uleb128 0x1b
+	.string	"s"
+	.value	0x262
+	.byte	0x15
+	.long	0xfb
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x8cc
+	.uleb128 0x15
+	.long	.LASF2047
+	.value	0x24d
+	.long	0xc73
+	.uleb128 0x6
+	.long	.LASF2039
+	.value	0x24d
+	.byte	0x34
+	.long	0x62b
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2048
+	.value	0x20c
+	.long	0xce9
+	.uleb128 0x6
+	.long	.LASF2039
+	.value	0x20c
+	.byte	0x38
+	.long	0x62b
+	.uleb128 0x4
+	.long	.LASF2049
+	.value	0x20e
+	.byte	0x9
+	.long	0x20f
+	.uleb128 0x4
+	.long	.LASF2050
+	.value	0x20f
+	.byte	0xf
+	.long	0x216
+	.uleb128 0x4
+	.long	.LASF2051
+	.value	0x210
+	.byte	0x14
+	.long	0xef
+	.uleb128 0x27
+	.long	0xcda
+	.uleb128 0x4
+	.long	.LASF2052
+	.value	0x223
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2053
+	.value	0x225
+	.byte	0x12
+	.long	0xd7
+	.uleb128 0x4
+	.long	.LASF2054
+	.value	0x227
+	.byte	0xd
+	.long	0x20f
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2052
+	.value	0x243
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2055
+	.value	0x1f9
+	.long	0xd29
+	.uleb128 0x4
+	.long	.LASF1997
+	.value	0x1fb
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2052
+	.value	0x1fc
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2056
+	.value	0x1fe
+	.byte	0x17
+	.long	0xd2
+	.uleb128 0x4
+	.long	.LASF2053
+	.value	0x201
+	.byte	0x12
+	.long	0xd7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2059
+	.value	0x1e9
+	.byte	0x10
+	.long	0xc6
+	.long	0xd54
+	.uleb128 0x4
+	.long	.LASF2057
+	.value	0x1eb
+	.byte	0x14
+	.long	0xc6
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2058
+	.value	0x1ee
+	.byte	0x11
+	.long	0xc6
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2060
+	.value	0x1dc
+	.byte	0x11
+	.long	0xd7
+	.long	0xd7d
+	.uleb128 0x6
+	.long	.LASF2053
+	.value	0x1dc
+	.byte	0x35
+	.long	0x7c
+	.uleb128 0x6
+	.long	.LASF1943
+	.value	0x1dc
+	.byte	0x5b
+	.long	0xd7d
+	.byte	0
+	.uleb128 0x5
+	.long	0x744
+	.uleb128 0x16
+	.long	.LASF2061
+	.value	0x1bf
+	.byte	0x11
+	.long	0xd7
+	.long	0xdab
+	.uleb128 0x6
+	.long	.LASF2052
+	.value	0x1bf
+	.byte	0x28
+	.long	0xc6
+	.uleb128 0x4
+	.long	.LASF2062
+	.value	0x1c1
+	.byte	0x26
+	.long	0xdab
+	.byte	0
+	.uleb128 0x5
+	.long	0x6f0
+	.uleb128 0x16
+	.long	.LASF2063
+	.value	0x1a5
+	.byte	0x11
+	.long	0xd7
+	.long	0xe17
+	.uleb128 0x6
+	.long	.LASF2064
+	.value	0x1a5
+	.byte	0x37
+	.long	0xc6
+	.uleb128 0x6
+	.long	.LASF2053
+	.value	0x1a5
+	.byte	0x46
+	.long	0xd7
+	.uleb128 0x4
+	.long	.LASF2065
+	.value	0x1a7
+	.byte	0x14
+	.long	0xe17
+	.uleb128 0x4
+	.long	.LASF2066
+	.value	0x1a8
+	.byte	0x14
+	.long	0xe2d
+	.uleb128 0x4
+	.long	.LASF2067
+	.value	0x1a9
+	.byte	0x10
+	.long	0x20f
+	.uleb128 0x4
+	.long	.LASF2068
+	.value	0x1ab
+	.byte	0x13
+	.long	0xd2
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2069
+	.value	0x1b9
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xae
+	.long	0xe2d
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xb
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x10
+	.long	0xae
+	.long	0xe3d
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2070
+	.byte	0xb
+	.value	0x179
+	.byte	0x5
+	.long	0x20f
+	.long	0xe75
+	.uleb128 0x6
+	.long	.LASF2039
+	.value	0x179
+	.byte	0x1c
+	.long	0x62b
+	.uleb128 0x6
+	.long	.LASF2071
+	.value	0x179
+	.byte	0x37
+	.long	0x61f
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2072
+	.value	0x198
+	.byte	0x17
+	.long	0xd2
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF2073
+	.value	0x172
+	.uleb128 0x28
+	.long	.LASF2074
+	.value	0x16b
+	.uleb128 0x35
+	.long	.LASF2088
+	.byte	0xb
+	.value	0x166
+	.byte	0xc
+	.long	0x20f
+	.uleb128 0x19
+	.long	.LASF2075
+	.value	0x161
+	.byte	0x5
+	.long	0x20f
+	.uleb128 0x19
+	.long	.LASF2076
+	.value	0x15c
+	.byte	0x5
+	.long	0x20f
+	.uleb128 0x16
+	.long	.LASF2077
+	.value	0x154
+	.byte	0x10
+	.long	0xc6
+	.long	0xedd
+	.uleb128 0x6
+	.long	.LASF2078
+	.value	0x154
+	.byte	0x39
+	.long	0x21b
+	.uleb128 0x6
+	.long	.LASF2079
+	.value	0x154
+	.byte	0x4d
+	.long	0xc6
+	.uleb128 0x6
+	.long	.LASF2080
+	.value	0x154
+	.byte	0x6b
+	.long	0xc6
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2081
+	.value	0x111
+	.long	0xf21
+	.uleb128 0x27
+	.long	0xef8
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x119
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x121
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2082
+	.value	0x122
+	.byte	0x2a
+	.long	0xf21
+	.uleb128 0x9
+	.uleb128 0x4
+	.long	.LASF2083
+	.value	0x125
+	.byte	0x16
+	.long	0xd7
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x5fe
+	.uleb128 0x36
+	.long	.LASF2084
+	.byte	0xb
+	.byte	0xd1
+	.byte	0xd
+	.long	0xf4b
+	.uleb128 0xc
+	.long	.LASF2052
+	.byte	0xb
+	.byte	0xd1
+	.byte	0x31
+	.long	0xc6
+	.uleb128 0xc
+	.long	.LASF2085
+	.byte	0xb
+	.byte	0xd1
+	.byte	0x4a
+	.long	0x20f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2086
+	.byte	0xb
+	.byte	0xca
+	.byte	0x18
+	.long	0x20f
+	.long	0xf68
+	.uleb128 0xc
+	.long	.LASF2087
+	.byte	0xb
+	.byte	0xca
+	.byte	0x2e
+	.long	0xd7
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2089
+	.byte	0xb
+	.byte	0xc5
+	.byte	0x18
+	.long	0x20f
+	.uleb128 0x37
+	.long	.LASF2105
+	.byte	0xb
+	.byte	0xc1
+	.byte	0xd
+	.uleb128 0x20
+	.long	.LASF2090
+	.byte	0xb
+	.byte	0xb8
+	.byte	0x10
+	.long	0xc6
+	.uleb128 0x17
+	.long	.LASF2091
+	.byte	0xb
+	.byte	0xb0
+	.byte	0x11
+	.long	0xd7
+	.long	0xfb1
+	.uleb128 0xc
+	.long	.LASF2005
+	.byte	0xb
+	.byte	0xb0
+	.byte	0x38
+	.long	0xfb1
+	.uleb128 0xc
+	.long	.LASF2052
+	.byte	0xb
+	.byte	0xb0
+	.byte	0x51
+	.long	0xc6
+	.byte	0
+	.uleb128 0x5
+	.long	0x99e
+	.uleb128 0x1c
+	.long	.LASF2092
+	.byte	0xa7
+	.long	0xfd7
+	.uleb128 0xc
+	.long	.LASF2093
+	.byte	0xb
+	.byte	0xa7
+	.byte	0x43
+	.long	0xfd7
+	.uleb128 0x9
+	.uleb128 0x21
+	.string	"i"
+	.byte	0xa9
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x738
+	.uleb128 0x1c
+	.long	.LASF2094
+	.byte	0x9d
+	.long	0xffd
+	.uleb128 0xc
+	.long	.LASF2095
+	.byte	0xb
+	.byte	0x9d
+	.byte	0x44
+	.long	0xffd
+	.uleb128 0x9
+	.uleb128 0x21
+	.string	"i"
+	.byte	0x9f
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x6e4
+	.uleb128 0x1c
+	.long	.LASF2096
+	.byte	0x93
+	.long	0x1023
+	.uleb128 0xc
+	.long	.LASF2097
+	.byte	0xb
+	.byte	0x93
+	.byte	0x3e
+	.long	0xfd7
+	.uleb128 0x9
+	.uleb128 0x21
+	.string	"i"
+	.byte	0x96
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2098
+	.byte	0x70
+	.long	0x103a
+	.uleb128 0xc
+	.long	.LASF2046
+	.byte	0xb
+	.byte	0x70
+	.byte	0x25
+	.long	0xc56
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2046
+	.byte	0xa
+	.byte	0x93
+	.byte	0x44
+	.long	0x1046
+	.uleb128 0x5
+	.long	0x8d8
+	.uleb128 0x17
+	.long	.LASF2097
+	.byte	0xa
+	.byte	0x74
+	.byte	0x71
+	.long	0xd7d
+	.long	0x1068
+	.uleb128 0xc
+	.long	.LASF2099
+	.byte	0xa
+	.byte	0x74
+	.byte	0x8b
+	.long	0x7c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2095
+	.byte	0xa
+	.byte	0x6d
+	.byte	0x7b
+	.long	0xdab
+	.long	0x1085
+	.uleb128 0xc
+	.long	.LASF2099
+	.byte	0xa
+	.byte	0x6d
+	.byte	0x98
+	.long	0x7c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2100
+	.byte	0x8
+	.byte	0x93
+	.byte	0x7b
+	.long	0xf21
+	.long	0x10a2
+	.uleb128 0xc
+	.long	.LASF2099
+	.byte	0x8
+	.byte	0x93
+	.byte	0x98
+	.long	0x7c
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF2101
+	.byte	0xe
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x29
+	.string	"amt"
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x29
+	.string	"low"
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0xc
+	.long	.LASF2102
+	.byte	0xe
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 18 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 19 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.file 21 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 23 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 24 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 27 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 34 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF806
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF842
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x111
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF870
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF871
+	.byte	0x4
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF888
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF889
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF890
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF891
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF894
+	.file 47 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF895
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF912
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF925
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF930
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF933
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF934
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF950
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF951
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF952
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF964
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF971
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF972
+	.byte	0x4
+	.byte	0x4
+	.file 64 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF976
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x41
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 67 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 68 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x44
+	.file 69 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 70 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 71 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x47
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1118
+	.byte	0x4
+	.byte	0x4
+	.file 72 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 73 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.file 74 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1135
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 75 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 76 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x4
+	.file 77 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 78 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x4e
+	.file 79 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x4
+	.file 80 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 81 "./src/main/drivers/rx_spi.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1285
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x7
+	.file 82 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x52
+	.byte	0x4
+	.file 83 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x53
+	.byte	0x4
+	.file 84 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x54
+	.file 85 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x55
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.file 86 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.file 87 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1676
+	.byte	0x4
+	.file 88 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 89 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x59
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1680
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 90 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1715
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1716
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 91 "./src/main/rx/pwm.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x5b
+	.byte	0x4
+	.file 92 "./src/main/rx/sbus.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x5c
+	.byte	0x4
+	.file 93 "./src/main/rx/spektrum.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 94 "./src/main/rx/sumd.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x5e
+	.byte	0x4
+	.file 95 "./src/main/rx/sumh.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0xf
+	.byte	0x4
+	.file 96 "./src/main/rx/xbus.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x60
+	.byte	0x4
+	.file 97 "./src/main/rx/ibus.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x61
+	.byte	0x4
+	.file 98 "./src/main/rx/jetiexbus.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x62
+	.byte	0x4
+	.file 99 "./src/main/rx/crsf.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 100 "./src/main/rx/rx_spi.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1775
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF815
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF834
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF869
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.526987f9f8e61fa953f503f76de36390,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF887
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.135.9eeb6b52c2522ad7aff16ad95342972e,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF903
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF911
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF929
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF932
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.52.4f882364bb7424384ae71496b52638dc,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF945
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF949
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF970
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1040
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF986
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1086
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1088
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1090
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1096
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1117
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1125
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1130
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1134
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1152
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1170
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1175
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1198
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1280
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1282
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1284
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1287
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1307
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1679
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1706
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1714
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1744
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.spektrum.h.20.7eabd3dc96720430f10f642c53b6edaf,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1749
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.crsf.h.20.5d1ddf160b80638dd6926c0a31784517,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1755
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_spi.h.64.fd2df210de894f8eb89a02c524951c8f,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1761
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF2106
+	.long	.LASF2107
+	.long	.LASF2108
+	.long	.LASF2109
+	.long	.LASF2110
+	.long	.LASF2111
+	.long	.LASF2112
+	.long	.LASF2113
+	.long	.LASF2114
+	.long	.LASF2115
+	.long	.LASF2116
+	.long	.LASF2117
+	.long	.LASF2118
+	.long	.LASF2119
+	.long	.LASF2120
+	.long	.LASF2121
+	.long	.LASF2122
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x65
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2123
+	.byte	0xd
+	.long	.LASF2124
+	.byte	0xd
+	.long	.LASF2125
+	.byte	0xd
+	.long	.LASF2126
+	.byte	0x3
+	.long	.LASF2127
+	.byte	0x2
+	.long	.LASF2128
+	.byte	0x4
+	.long	.LASF2129
+	.byte	0x5
+	.long	.LASF2130
+	.byte	0x5
+	.long	.LASF2131
+	.byte	0x2
+	.long	.LASF2132
+	.byte	0x8
+	.long	.LASF2133
+	.byte	0x8
+	.long	.LASF2134
+	.byte	0x6
+	.long	.LASF2135
+	.byte	0x10
+	.long	.LASF2136
+	.byte	0x2
+	.long	.LASF2137
+	.byte	0x8
+	.long	.LASF2138
+	.byte	0x3
+	.long	.LASF2139
+	.byte	0x4
+	.long	.LASF2140
+	.byte	0x10
+	.long	.LASF2141
+	.byte	0x11
+	.long	.LASF2142
+	.byte	0x11
+	.long	.LASF2142
+	.byte	0x10
+	.long	.LASF2143
+	.byte	0xd
+	.long	.LASF2144
+	.byte	0x10
+	.long	.LASF2145
+	.byte	0x10
+	.long	.LASF2146
+	.byte	0xd
+	.long	.LASF2147
+	.byte	0xd
+	.long	.LASF2148
+	.byte	0xf
+	.long	.LASF2149
+	.byte	0xd
+	.long	.LASF2150
+	.byte	0xe
+	.long	.LASF2151
+	.byte	0xe
+	.long	.LASF2152
+	.byte	0xd
+	.long	.LASF2153
+	.byte	0xd
+	.long	.LASF2154
+	.byte	0xd
+	.long	.LASF2155
+	.byte	0x10
+	.long	.LASF2156
+	.byte	0x11
+	.long	.LASF2157
+	.byte	0xd
+	.long	.LASF2158
+	.byte	0xd
+	.long	.LASF2159
+	.byte	0xd
+	.long	.LASF2160
+	.byte	0xd
+	.long	.LASF2161
+	.byte	0xc
+	.long	.LASF2162
+	.byte	0xc
+	.long	.LASF2123
+	.byte	0xf
+	.long	.LASF2163
+	.byte	0xc
+	.long	.LASF2164
+	.byte	0xc
+	.long	.LASF2165
+	.byte	0xc
+	.long	.LASF2166
+	.byte	0xc
+	.long	.LASF2167
+	.byte	0x10
+	.long	.LASF2167
+	.byte	0xd
+	.long	.LASF2168
+	.byte	0xd
+	.long	.LASF2169
+	.byte	0xd
+	.long	.LASF2170
+	.byte	0xd
+	.long	.LASF2171
+	.byte	0xf
+	.long	.LASF2171
+	.byte	0xd
+	.long	.LASF2172
+	.byte	0xc
+	.long	.LASF2173
+	.byte	0xc
+	.long	.LASF2174
+	.byte	0xc
+	.long	.LASF2175
+	.byte	0xc
+	.long	.LASF2176
+	.byte	0xd
+	.long	.LASF2177
+	.byte	0xd
+	.long	.LASF2178
+	.byte	0xd
+	.long	.LASF2179
+	.byte	0xd
+	.long	.LASF2180
+	.byte	0xd
+	.long	.LASF2181
+	.byte	0xd
+	.long	.LASF2182
+	.byte	0x10
+	.long	.LASF2183
+	.byte	0xd
+	.long	.LASF2184
+	.byte	0xd
+	.long	.LASF2185
+	.byte	0x10
+	.long	.LASF2186
+	.byte	0xb
+	.long	.LASF2187
+	.byte	0xa
+	.long	.LASF2188
+	.byte	0x9
+	.long	.LASF2189
+	.byte	0xa
+	.long	.LASF2190
+	.byte	0x1
+	.long	.LASF2191
+	.byte	0x1
+	.long	.LASF2192
+	.byte	0x2
+	.long	.LASF2193
+	.byte	0x2
+	.long	.LASF2194
+	.byte	0x3
+	.long	.LASF2195
+	.byte	0x3
+	.long	.LASF2196
+	.byte	0x4
+	.long	.LASF2197
+	.byte	0x4
+	.long	.LASF2198
+	.byte	0x4
+	.long	.LASF2199
+	.byte	0x4
+	.long	.LASF2200
+	.byte	0x4
+	.long	.LASF2201
+	.byte	0x4
+	.long	.LASF2202
+	.byte	0x4
+	.long	.LASF2203
+	.byte	0x4
+	.long	.LASF2204
+	.byte	0x4
+	.long	.LASF2205
+	.byte	0x4
+	.long	.LASF2206
+	.byte	0x4
+	.long	.LASF2207
+	.byte	0x4
+	.long	.LASF2202
+	.byte	0x7
+	.long	.LASF2208
+	.byte	0x8
+	.long	.LASF2209
+	.byte	0x8
+	.long	.LASF2210
+	.byte	0x8
+	.long	.LASF2211
+	.byte	0x8
+	.long	.LASF2212
+	.byte	0x8
+	.long	.LASF2213
+	.byte	0x8
+	.long	.LASF2214
+	.byte	0x8
+	.long	.LASF2215
+	.byte	0x8
+	.long	.LASF2216
+	.byte	0x8
+	.long	.LASF2199
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1667:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF864:
+	.string	"__ldiv_t_defined 1"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1699:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1303:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1386:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1599:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF959:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1397:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1775:
+	.string	"RSSI_ADC_SAMPLE_COUNT 16"
+.LASF1984:
+	.string	"rcInterpolationChannels"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF794:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1020:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF2059:
+	.string	"getRxChannelCount"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1878:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1141:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2047:
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+.LASF1521:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1063:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF1495:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1067:
+	.string	"USE_PPM"
+.LASF1441:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1859:
+	.string	"FEATURE_RX_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF897:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF993:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1570:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1398:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1050:
+	.string	"USE_FAKE_GYRO "
+.LASF1362:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF883:
+	.string	"__pid_t_defined "
+.LASF896:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1176:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2063:
+	.string	"calculateNonDataDrivenChannel"
+.LASF1309:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1552:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF812:
+	.string	"WNOWAIT 0x01000000"
+.LASF1069:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1781:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1874:
+	.string	"FEATURE_DASHBOARD"
+.LASF1177:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1571:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1811:
+	.string	"_Bool"
+.LASF1975:
+	.string	"spektrum_sat_bind"
+.LASF1676:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1064:
+	.string	"USE_UART8 "
+.LASF1361:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1171:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF1047:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2056:
+	.string	"rawChannel"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2039:
+	.string	"currentTimeUs"
+.LASF1015:
+	.string	"TELEMETRY_SRXL "
+.LASF878:
+	.string	"__mode_t_defined "
+.LASF1820:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1658:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1531:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1523:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1631:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1702:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1691:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1182:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1765:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1360:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1310:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1594:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1449:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2015:
+	.string	"needRxSignalMaxDelayUs"
+.LASF1994:
+	.string	"rxConfig_System"
+.LASF858:
+	.string	"__f32x(x) x ##f32x"
+.LASF1299:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF786:
+	.string	"__WCHAR_T__ "
+.LASF1979:
+	.string	"rssi_invert"
+.LASF806:
+	.string	"_STDLIB_H 1"
+.LASF1108:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1663:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1244:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1008:
+	.string	"USE_SERVOS "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1236:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1755:
+	.string	"CRSF_PAYLOAD_SIZE_MAX (CRSF_FRAME_SIZE_MAX - 4)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1635:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1373:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1610:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1507:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1200:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1961:
+	.string	"step"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1670:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1754:
+	.string	"CRSF_FRAME_SIZE_MAX 64"
+.LASF2017:
+	.string	"skipRxSamples"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1868:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1792:
+	.string	"uint16_t"
+.LASF1363:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF908:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1673:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1272:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1221:
+	.string	"PG_RX_CONFIG 24"
+.LASF1433:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1602:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1493:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1581:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1004:
+	.string	"TELEMETRY_HOTT "
+.LASF1500:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1188:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1569:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1327:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1111:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1370:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1030:
+	.string	"_T_PTRDIFF_ "
+.LASF1608:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1726:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1483:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1545:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1232:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1757:
+	.string	"RC_CHANNEL_FLIP RC_SPI_AUX2"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF2020:
+	.string	"rcSampleIndex"
+.LASF1240:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1436:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF879:
+	.string	"__nlink_t_defined "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2072:
+	.string	"frameStatus"
+.LASF1519:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1186:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF785:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1506:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1322:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1430:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1344:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF1224:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1683:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1626:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1144:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1739:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF1907:
+	.string	"BOXSONAR"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF859:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1486:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF2044:
+	.string	"parseRcChannels"
+.LASF1010:
+	.string	"CMS "
+.LASF1680:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1634:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1662:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1824:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1844:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1723:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1330:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1163:
+	.string	"BIT(x) (1 << (x))"
+.LASF1849:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1283:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1756:
+	.string	"RC_CHANNEL_RATE RC_SPI_AUX1"
+.LASF1181:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1338:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1075:
+	.string	"USE_SERIALRX_SUMH"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF925:
+	.string	"_SYS_SELECT_H 1"
+.LASF1790:
+	.string	"int32_t"
+.LASF1196:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF837:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1487:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF936:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1613:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1139:
+	.string	"FAST_MATH "
+.LASF1053:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1939:
+	.string	"channelRange_t"
+.LASF871:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1648:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"__timeval_defined 1"
+.LASF1638:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1584:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1158:
+	.string	"STR_HELPER(x) #x"
+.LASF2041:
+	.string	"updateRSSIADC"
+.LASF1998:
+	.string	"rxRefreshRate"
+.LASF2004:
+	.string	"rxRuntimeConfig_t"
+.LASF1285:
+	.string	"RX_SPI_MAX_PAYLOAD_SIZE 32"
+.LASF1094:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF910:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1748:
+	.string	"SRXL_FRAME_OVERHEAD 5"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1846:
+	.string	"OWNER_BARO_EXTI"
+.LASF1217:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2028:
+	.string	"scaleRange"
+.LASF546:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF843:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1799:
+	.string	"FILTER_FIR"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1068:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1823:
+	.string	"OWNER_SERIAL_TX"
+.LASF1076:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1890:
+	.string	"BOXMAG"
+.LASF1159:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1237:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1021:
+	.string	"USE_SENSOR_NAMES "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF2055:
+	.string	"readRxChannelsApplyRanges"
+.LASF1251:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1803:
+	.string	"PGR_SIZE_MASK"
+.LASF1943:
+	.string	"range"
+.LASF2025:
+	.string	"failsafeOnValidDataFailed"
+.LASF1408:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1306:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF2035:
+	.string	"rxFrameTimeUs"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1353:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1017:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF912:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1401:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF921:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1714:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1524:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF929:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1866:
+	.string	"FEATURE_FAILSAFE"
+.LASF2051:
+	.string	"currentMilliTime"
+.LASF1016:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2024:
+	.string	"validFlightChannelMask"
+.LASF1564:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1148:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1761:
+	.string	"RC_CHANNEL_RTH RC_SPI_AUX6"
+.LASF1900:
+	.string	"BOXLEDLOW"
+.LASF1967:
+	.string	"rxConfig_s"
+.LASF1993:
+	.string	"rxConfig_t"
+.LASF1847:
+	.string	"OWNER_USB"
+.LASF2043:
+	.string	"pwmRssi"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1268:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1957:
+	.string	"RX_FAILSAFE_MODE_SET"
+.LASF823:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1858:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1577:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1481:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF847:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1888:
+	.string	"BOXHORIZON"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1422:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1192:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1612:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1977:
+	.string	"rssi_channel"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF880:
+	.string	"__uid_t_defined "
+.LASF1999:
+	.string	"rcReadRawFn"
+.LASF1546:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1884:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF820:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1870:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2065:
+	.string	"rcSamples"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1901:
+	.string	"BOXLLIGHTS"
+.LASF839:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1828:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1083:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1587:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1457:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1043:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1733:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF1989:
+	.string	"max_aux_channel"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1229:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1889:
+	.string	"BOXBARO"
+.LASF1179:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1816:
+	.string	"OWNER_SERVO"
+.LASF1700:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1165:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1051:
+	.string	"ACC "
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1628:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1012:
+	.string	"TELEMETRY_IBUS "
+.LASF991:
+	.string	"USE_PWM "
+.LASF1617:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF907:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF787:
+	.string	"_WCHAR_T "
+.LASF1934:
+	.string	"RC_SMOOTHING_FILTER"
+.LASF1637:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1328:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1413:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1661:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1970:
+	.string	"sbus_inversion"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1178:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF900:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1443:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1867:
+	.string	"FEATURE_SONAR"
+.LASF1517:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF974:
+	.string	"alloca"
+.LASF869:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1369:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1746:
+	.string	"SPEKTRUM_SAT_BIND_MAX 10"
+.LASF1036:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1980:
+	.string	"midrc"
+.LASF1336:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1403:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1717:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1782:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1784:
+	.string	"__uint16_t"
+.LASF862:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1695:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF957:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1815:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2058:
+	.string	"maxChannels"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1107:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF364:
+	.string	"__k8 1"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1843:
+	.string	"OWNER_RX_SPI_CS"
+.LASF797:
+	.string	"__INT_WCHAR_T_H "
+.LASF1172:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1684:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1453:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1308:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1404:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF926:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1879:
+	.string	"FEATURE_AIRMODE"
+.LASF1972:
+	.string	"rx_spi_protocol"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1488:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1960:
+	.string	"mode"
+.LASF920:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1339:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1286:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1630:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1364:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF833:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1137:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1758:
+	.string	"RC_CHANNEL_PICTURE RC_SPI_AUX3"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1437:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2085:
+	.string	"valid"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1125:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1734:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1131:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1817:
+	.string	"OWNER_LED"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1456:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1157:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1273:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1510:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1463:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1313:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1776:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF877:
+	.string	"__gid_t_defined "
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1862:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2029:
+	.string	"failsafeOnRxResume"
+.LASF1971:
+	.string	"halfDuplex"
+.LASF1279:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1282:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1180:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1037:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1590:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1650:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1861:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1536:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1973:
+	.string	"rx_spi_id"
+.LASF1786:
+	.string	"__uint32_t"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1690:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF2030:
+	.string	"failsafeOnRxSuspend"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1208:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1184:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF1886:
+	.string	"BOXARM"
+.LASF1627:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1609:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF379:
+	.string	"linux 1"
+.LASF1988:
+	.string	"fpvCamAngleDegrees"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF796:
+	.string	"___int_wchar_t_h "
+.LASF1425:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1049:
+	.string	"GYRO "
+.LASF1981:
+	.string	"mincheck"
+.LASF1018:
+	.string	"USE_MSP_PUSH "
+.LASF1769:
+	.string	"RX_SPI_DEFAULT_PROTOCOL 0"
+.LASF1489:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2066:
+	.string	"rcDataMean"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1290:
+	.string	"IOCFG_OUT_OD 0"
+.LASF960:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1013:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1029:
+	.string	"_PTRDIFF_T "
+.LASF1902:
+	.string	"BOXCALIB"
+.LASF1935:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF905:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1377:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1864:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1120:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1445:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF2077:
+	.string	"calculateChannelRemapping"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1797:
+	.string	"FILTER_PT1"
+.LASF1132:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1898:
+	.string	"BOXBEEPERON"
+.LASF923:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1382:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF962:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1805:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1340:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1643:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1855:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1966:
+	.string	"rxChannelRangeConfigs_SystemArray"
+.LASF1001:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1253:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF2069:
+	.string	"sampleIndex"
+.LASF1922:
+	.string	"AUX1"
+.LASF1923:
+	.string	"AUX2"
+.LASF822:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1925:
+	.string	"AUX4"
+.LASF1110:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1927:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1929:
+	.string	"AUX8"
+.LASF1215:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2102:
+	.string	"high"
+.LASF1982:
+	.string	"maxcheck"
+.LASF888:
+	.string	"__clock_t_defined 1"
+.LASF1919:
+	.string	"ROLL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF793:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1448:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2053:
+	.string	"sample"
+.LASF1537:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF999:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1126:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF2026:
+	.string	"failsafeOnValidDataReceived"
+.LASF1837:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1633:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF935:
+	.string	"__NFDBITS"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF825:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1294:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1498:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF382:
+	.string	"unix 1"
+.LASF1729:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1332:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1278:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2018:
+	.string	"rcRaw"
+.LASF891:
+	.string	"__timer_t_defined 1"
+.LASF1384:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1451:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1801:
+	.string	"PGR_PGN_MASK"
+.LASF1470:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1908:
+	.string	"BOXSERVO1"
+.LASF1909:
+	.string	"BOXSERVO2"
+.LASF1910:
+	.string	"BOXSERVO3"
+.LASF848:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1130:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF795:
+	.string	"_WCHAR_T_H "
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1882:
+	.string	"FEATURE_RX_SPI"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF2040:
+	.string	"linkRssi"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF931:
+	.string	"____sigset_t_defined "
+.LASF1041:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF895:
+	.string	"_ENDIAN_H 1"
+.LASF1653:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1582:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2037:
+	.string	"updateRSSI"
+.LASF1235:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF988:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF1288:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF402:
+	.string	"false 0"
+.LASF1665:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1245:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF2073:
+	.string	"resumeRxSignal"
+.LASF1270:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1329:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1752:
+	.string	"CRSF_PORT_MODE MODE_RXTX"
+.LASF1624:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1387:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1410:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF850:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF963:
+	.string	"__ONCE_ALIGNMENT "
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1418:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1737:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1114:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1848:
+	.string	"OWNER_USB_DETECT"
+.LASF1527:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1504:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF816:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1646:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1287:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1807:
+	.string	"size"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1468:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF946:
+	.string	"__blksize_t_defined "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF894:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1976:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1255:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF1956:
+	.string	"RX_FAILSAFE_MODE_HOLD"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1992:
+	.string	"rx_max_usec"
+.LASF917:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1042:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1473:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1378:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1478:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2062:
+	.string	"channelFailsafeConfig"
+.LASF1044:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1657:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF845:
+	.string	"__HAVE_FLOAT64 1"
+.LASF939:
+	.string	"__FDS_BITS(set) ((set)->fds_bits)"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1742:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1342:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2014:
+	.string	"lastRxFrameTimeUs"
+.LASF1763:
+	.string	"PPM_AND_PWM_SAMPLE_COUNT 3"
+.LASF1852:
+	.string	"OWNER_INVERTER"
+.LASF1086:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1482:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF906:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1832:
+	.string	"OWNER_SPI_MOSI"
+.LASF1636:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1791:
+	.string	"uint8_t"
+.LASF1381:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1138:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1096:
+	.string	"USE_DSHOT"
+.LASF1485:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF964:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1161:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1173:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF2036:
+	.string	"rxGetRefreshRate"
+.LASF1002:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF1249:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1914:
+	.string	"BOX3DDISABLESWITCH"
+.LASF1920:
+	.string	"PITCH"
+.LASF1140:
+	.string	"VERY_FAST_MATH "
+.LASF1659:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF876:
+	.string	"__dev_t_defined "
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1281:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF798:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1905:
+	.string	"BOXTELEMETRY"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1081:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF827:
+	.string	"__WCOREFLAG 0x80"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1575:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1918:
+	.string	"boxId_e"
+.LASF763:
+	.string	"__need_size_t "
+.LASF1945:
+	.string	"rcModeActivationMask"
+.LASF1798:
+	.string	"FILTER_BIQUAD"
+.LASF1860:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF965:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1380:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1629:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1082:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF801:
+	.string	"_BSD_WCHAR_T_"
+.LASF2099:
+	.string	"_index"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1399:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF841:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1692:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2087:
+	.string	"pulseDuration"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1760:
+	.string	"RC_CHANNEL_HEADLESS RC_SPI_AUX5"
+.LASF1766:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1814:
+	.string	"OWNER_PPMINPUT"
+.LASF1502:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1039:
+	.string	"__need_ptrdiff_t"
+.LASF909:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF982:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1119:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1649:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1233:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1026:
+	.string	"_STDDEF_H "
+.LASF1592:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1056:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1333:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1589:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1607:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF911:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1432:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1499:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF2075:
+	.string	"rxAreFlightChannelsValid"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1718:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1529:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF2008:
+	.string	"rxSignalReceivedNotDataDriven"
+.LASF1258:
+	.string	"PG_OSD_CONFIG 501"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1978:
+	.string	"rssi_scale"
+.LASF1223:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1772:
+	.string	"RX_MAX_USEC 2115"
+.LASF1197:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF830:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1187:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1987:
+	.string	"rcSmoothingCutoffHz"
+.LASF1348:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF984:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1228:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1744:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1371:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1389:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2005:
+	.string	"rxRuntimeConfig"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF842:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1417:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF898:
+	.string	"__BIG_ENDIAN 4321"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1554:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1986:
+	.string	"rcSmoothingFilterType"
+.LASF1916:
+	.string	"BOXBLACKBOXERASE"
+.LASF1143:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1093:
+	.string	"BLACKBOX"
+.LASF1585:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1671:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1271:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1078:
+	.string	"LED_STRIP"
+.LASF1566:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1226:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF986:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF2098:
+	.string	"pgResetFn_rxConfig"
+.LASF840:
+	.string	"__f128(x) x ##f128"
+.LASF1721:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF948:
+	.string	"__fsblkcnt_t_defined "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1611:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF904:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1983:
+	.string	"rcInterpolation"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1351:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1442:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1074:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2083:
+	.string	"value"
+.LASF1877:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF949:
+	.string	"__fsfilcnt_t_defined "
+.LASF890:
+	.string	"__time_t_defined 1"
+.LASF807:
+	.string	"WNOHANG 1"
+.LASF1477:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1428:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF958:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1003:
+	.string	"TELEMETRY_FRSKY "
+.LASF1936:
+	.string	"channelRange_s"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1553:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1269:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1127:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1614:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1827:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1808:
+	.string	"address"
+.LASF1152:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1605:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1551:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1455:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1458:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1688:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1073:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1520:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1354:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF889:
+	.string	"__clockid_t_defined 1"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF809:
+	.string	"WSTOPPED 2"
+.LASF1497:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF803:
+	.string	"NULL"
+.LASF1708:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2086:
+	.string	"isPulseValid"
+.LASF972:
+	.string	"__have_pthread_attr_t 1"
+.LASF810:
+	.string	"WEXITED 4"
+.LASF1829:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2052:
+	.string	"channel"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1185:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1100:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF499:
+	.string	"__PMT"
+.LASF1316:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF799:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1933:
+	.string	"RC_SMOOTHING_MANUAL"
+.LASF1095:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1296:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1503:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1640:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF819:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF985:
+	.string	"I2C2_OVERCLOCK true"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1514:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2081:
+	.string	"rxInit"
+.LASF1535:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1454:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1189:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1764:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1804:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF838:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1205:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1645:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1379:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1509:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1343:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF916:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF1773:
+	.string	"RX_MID_USEC 1500"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1423:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1135:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF811:
+	.string	"WCONTINUED 8"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1452:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1123:
+	.string	"UNIT_TESTED "
+.LASF2032:
+	.string	"feature"
+.LASF1204:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1931:
+	.string	"RC_SMOOTHING_DEFAULT"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1213:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1105:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1883:
+	.string	"FEATURE_SOFTSPI"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1461:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1198:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1109:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1513:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2103:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1697:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF854:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2048:
+	.string	"detectAndApplySignalLossBehaviour"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1183:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF981:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1346:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF892:
+	.string	"__useconds_t_defined "
+.LASF1334:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1275:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1480:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1312:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1623:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF961:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF996:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1444:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1396:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF893:
+	.string	"__suseconds_t_defined "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF951:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF943:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF2096:
+	.string	"pgResetFn_rxChannelRangeConfigs"
+.LASF1751:
+	.string	"CRSF_PORT_OPTIONS (SERIAL_STOPBITS_1 | SERIAL_PARITY_NO)"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1199:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1596:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF927:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF805:
+	.string	"__need_NULL"
+.LASF1040:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1349:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1771:
+	.string	"RX_MIN_USEC 885"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1528:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1484:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF990:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1325:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1813:
+	.string	"OWNER_PWMINPUT"
+.LASF1077:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1070:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1302:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1703:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1104:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1809:
+	.string	"reset"
+.LASF1080:
+	.string	"TELEMETRY_HOTT"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1795:
+	.string	"long long unsigned int"
+.LASF1206:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1147:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF2007:
+	.string	"rxSignalReceived"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1154:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1835:
+	.string	"OWNER_SDCARD"
+.LASF1415:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF977:
+	.string	"_STRING_H 1"
+.LASF1568:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1654:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1246:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1128:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1789:
+	.string	"int16_t"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1352:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1501:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1777:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1462:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1780:
+	.string	"signed char"
+.LASF855:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1530:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1402:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1583:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1940:
+	.string	"modeActivationCondition_s"
+.LASF1944:
+	.string	"modeActivationCondition_t"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1006:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1007:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1365:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1651:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1066:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1345:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1475:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1214:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1243:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF919:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF942:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF1872:
+	.string	"FEATURE_RSSI_ADC"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1136:
+	.string	"sq(x) ((x)*(x))"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1749:
+	.string	"SRXL_FRAME_SIZE_MAX (SPEK_FRAME_SIZE + SRXL_FRAME_OVERHEAD)"
+.LASF1560:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1479:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1092:
+	.string	"VTX_TRAMP"
+.LASF971:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1616:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF857:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1578:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1087:
+	.string	"USE_DASHBOARD"
+.LASF1825:
+	.string	"OWNER_PINDEBUG"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF950:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1893:
+	.string	"BOXCAMSTAB"
+.LASF815:
+	.string	"__WCLONE 0x80000000"
+.LASF1295:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1678:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1689:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF945:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF2019:
+	.string	"rcInvalidPulsPeriod"
+.LASF1222:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF831:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1687:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1793:
+	.string	"uint32_t"
+.LASF846:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF955:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1557:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1857:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1913:
+	.string	"BOXAIRMODE"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1969:
+	.string	"serialrx_provider"
+.LASF2071:
+	.string	"currentDeltaTime"
+.LASF1391:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF2013:
+	.string	"needRxSignalBefore"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1598:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1000:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1028:
+	.string	"_ANSI_STDDEF_H "
+.LASF1209:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1276:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1850:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF2090:
+	.string	"nullFrameStatus"
+.LASF1538:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2045:
+	.string	"input"
+.LASF1802:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1212:
+	.string	"PG_PID_PROFILE 14"
+.LASF1618:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1264:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1891:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1350:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1320:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1491:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1098:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1958:
+	.string	"RX_FAILSAFE_MODE_INVALID"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF994:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1394:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1300:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF887:
+	.string	"__key_t_defined "
+.LASF1930:
+	.string	"RC_SMOOTHING_OFF"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF1168:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1686:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1464:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1949:
+	.string	"RX_FRAME_PENDING"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF914:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1556:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1292:
+	.string	"IOCFG_AF_OD 0"
+.LASF903:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1595:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF2080:
+	.string	"channelToRemap"
+.LASF1706:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1326:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF934:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1526:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1875:
+	.string	"FEATURE_OSD"
+.LASF1720:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1193:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF2001:
+	.string	"rcFrameTimeUsFn"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1512:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1511:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1089:
+	.string	"VTX_COMMON"
+.LASF1368:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1307:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1225:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1600:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1787:
+	.string	"long int"
+.LASF1694:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1429:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1218:
+	.string	"PG_SERVO_MIXER 21"
+.LASF2050:
+	.string	"rxIsDataDriven"
+.LASF1395:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1146:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1149:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1447:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1951:
+	.string	"RX_FRAME_FAILSAFE"
+.LASF1374:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1641:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1712:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1904:
+	.string	"BOXOSD"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1011:
+	.string	"TELEMETRY_CRSF "
+.LASF1033:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1032:
+	.string	"__PTRDIFF_T "
+.LASF928:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1024:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF868:
+	.string	"EXIT_SUCCESS 0"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1474:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1424:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1710:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2079:
+	.string	"channelMapEntryCount"
+.LASF1540:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1160:
+	.string	"EXPAND_I(x) x"
+.LASF1450:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1727:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1541:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1085:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1407:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1705:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1707:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1652:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF860:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1953:
+	.string	"rcChannelLetters"
+.LASF2057:
+	.string	"maxChannelsAllowed"
+.LASF1372:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1574:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF2034:
+	.string	"millis"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1896:
+	.string	"BOXGPSHOLD"
+.LASF861:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF937:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1216:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1145:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1261:
+	.string	"PG_PID_CONFIG 504"
+.LASF800:
+	.string	"__DEFINED_wchar_t "
+.LASF1704:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF522:
+	.string	"__flexarr []"
+.LASF863:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF976:
+	.string	"__COMPAR_FN_T "
+.LASF1079:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1892:
+	.string	"BOXHEADADJ"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF932:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1195:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF788:
+	.string	"_T_WCHAR_ "
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1201:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF1996:
+	.string	"rxRuntimeConfig_s"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1390:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1439:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF2094:
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+.LASF866:
+	.string	"RAND_MAX 2147483647"
+.LASF1895:
+	.string	"BOXGPSHOME"
+.LASF1465:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1826:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1242:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1713:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF2002:
+	.string	"rcFrameStatusFnPtr"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2100:
+	.string	"modeActivationConditions"
+.LASF1376:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1573:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1603:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1549:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1317:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1750:
+	.string	"CRSF_BAUDRATE 420000"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1955:
+	.string	"RX_FAILSAFE_MODE_AUTO"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF2064:
+	.string	"chan"
+.LASF1788:
+	.string	"char"
+.LASF956:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF2009:
+	.string	"rxFlightChannelsValid"
+.LASF1685:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1722:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1446:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1532:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1009:
+	.string	"GPS "
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1741:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF849:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1383:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1194:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1405:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1291:
+	.string	"IOCFG_AF_PP 0"
+.LASF2006:
+	.string	"rxDataReceived"
+.LASF1048:
+	.string	"LED0_PIN NONE"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1938:
+	.string	"endStep"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF808:
+	.string	"WUNTRACED 2"
+.LASF1911:
+	.string	"BOXBLACKBOX"
+.LASF1058:
+	.string	"USE_UART2 "
+.LASF922:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1604:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2092:
+	.string	"resetAllRxChannelRangeConfigurations"
+.LASF1280:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1679:
+	.string	"BEEP_ON do {} while(0)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2084:
+	.string	"rxUpdateFlightChannelStatus"
+.LASF1518:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1912:
+	.string	"BOXFAILSAFE"
+.LASF1019:
+	.string	"USE_RX_MSP "
+.LASF1156:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1492:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1544:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1701:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2003:
+	.string	"rcFrameTimeUsFnPtr"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF1738:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1865:
+	.string	"FEATURE_GPS"
+.LASF1725:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1666:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1716:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1728:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1952:
+	.string	"rssi"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF844:
+	.string	"__HAVE_FLOAT32 1"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF1357:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2067:
+	.string	"rxSamplesCollected"
+.LASF2078:
+	.string	"channelMap"
+.LASF1133:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1118:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1129:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1906:
+	.string	"BOXGTUNE"
+.LASF1234:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2060:
+	.string	"applyRxChannelRangeConfiguraton"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2038:
+	.string	"rxSetLinkRssi"
+.LASF804:
+	.string	"NULL ((void *)0)"
+.LASF1674:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1838:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1099:
+	.string	"USE_PROFILE "
+.LASF970:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1863:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1239:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1091:
+	.string	"VTX_SMARTAUDIO"
+.LASF995:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1830:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1411:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1822:
+	.string	"OWNER_ADC_RSSI"
+.LASF1121:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1572:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1072:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1054:
+	.string	"USE_FAKE_BARO "
+.LASF930:
+	.string	"__sigset_t_defined 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1959:
+	.string	"rxFailsafeChannelConfig_s"
+.LASF1962:
+	.string	"rxFailsafeChannelConfig_t"
+.LASF1887:
+	.string	"BOXANGLE"
+.LASF1427:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF802:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1954:
+	.string	"rcData"
+.LASF1031:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF881:
+	.string	"__off_t_defined "
+.LASF1833:
+	.string	"OWNER_I2C_SCL"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF2088:
+	.string	"isRxDataDriven"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1052:
+	.string	"USE_FAKE_ACC "
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1263:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1941:
+	.string	"modeId"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF852:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1515:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF884:
+	.string	"__id_t_defined "
+.LASF1431:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1490:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2054:
+	.string	"validPulse"
+.LASF968:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF824:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1881:
+	.string	"FEATURE_VTX"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1472:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1647:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1117:
+	.string	"__enable_irq() "
+.LASF1770:
+	.string	"SERIALRX_PROVIDER 0"
+.LASF1593:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1331:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF967:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1580:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1655:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1508:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1669:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"__daddr_t_defined "
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF814:
+	.string	"__WALL 0x40000000"
+.LASF2091:
+	.string	"nullReadRawRC"
+.LASF1466:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1921:
+	.string	"THROTTLE"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF901:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1547:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF1375:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1698:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1252:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF953:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF826:
+	.string	"__W_CONTINUED 0xffff"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1254:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF987:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF983:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1190:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1262:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1563:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF872:
+	.string	"_SYS_TYPES_H 1"
+.LASF2076:
+	.string	"rxIsReceivingSignal"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1419:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1274:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF918:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF2012:
+	.string	"rxUpdateAt"
+.LASF2068:
+	.string	"currentSampleIndex"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF899:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1831:
+	.string	"OWNER_SPI_MISO"
+.LASF1324:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1856:
+	.string	"OWNER_COMPASS_CS"
+.LASF791:
+	.string	"_WCHAR_T_ "
+.LASF1709:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1167:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1347:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1937:
+	.string	"startStep"
+.LASF1597:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1885:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF1202:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1871:
+	.string	"FEATURE_RX_MSP"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1964:
+	.string	"rxChannelRangeConfig_s"
+.LASF1965:
+	.string	"rxChannelRangeConfig_t"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1985:
+	.string	"rcInterpolationInterval"
+.LASF792:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2104:
+	.string	"rc_alias"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF865:
+	.string	"__lldiv_t_defined 1"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1113:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1615:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1917:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1785:
+	.string	"__int32_t"
+.LASF2046:
+	.string	"rxConfig"
+.LASF1467:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1834:
+	.string	"OWNER_I2C_SDA"
+.LASF1743:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1903:
+	.string	"BOXGOV"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF821:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF875:
+	.string	"__ino64_t_defined "
+.LASF1576:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1284:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF1873:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1496:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1219:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1151:
+	.string	"Q12 (1 << 12)"
+.LASF1774:
+	.string	"REQUIRED_CHANNEL_MASK 0x0F"
+.LASF989:
+	.string	"USE_CLI "
+.LASF1880:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1621:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1366:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1619:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1947:
+	.string	"timeDelta_t"
+.LASF1839:
+	.string	"OWNER_FLASH"
+.LASF1656:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1248:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1227:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF764:
+	.string	"__need_wchar_t "
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1555:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF947:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF813:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF789:
+	.string	"_T_WCHAR "
+.LASF1586:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1567:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1736:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1409:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1559:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1434:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1005:
+	.string	"TELEMETRY_LTM "
+.LASF1027:
+	.string	"_STDDEF_H_ "
+.LASF1305:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1323:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1672:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1341:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1426:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1542:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1724:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1318:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1550:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF882:
+	.string	"__off64_t_defined "
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF954:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1385:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF973:
+	.string	"_ALLOCA_H 1"
+.LASF1359:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1277:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF1459:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1525:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1851:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1023:
+	.string	"VTX_CONTROL "
+.LASF1924:
+	.string	"AUX3"
+.LASF1561:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1854:
+	.string	"OWNER_TRANSPONDER"
+.LASF1220:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1926:
+	.string	"AUX5"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1928:
+	.string	"AUX7"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1174:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1693:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF856:
+	.string	"__f32(x) x ##f32"
+.LASF1034:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF790:
+	.string	"__WCHAR_T "
+.LASF1175:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF1565:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1997:
+	.string	"channelCount"
+.LASF1533:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF873:
+	.string	"__u_char_defined "
+.LASF1915:
+	.string	"BOXFPVANGLEMIX"
+.LASF1471:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1745:
+	.string	"SPEKTRUM_SAT_BIND_DISABLED 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF938:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1682:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1358:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1668:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF851:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1164:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1948:
+	.string	"timeUs_t"
+.LASF1046:
+	.string	"U_ID_1 1"
+.LASF1045:
+	.string	"U_ID_0 0"
+.LASF874:
+	.string	"__ino_t_defined "
+.LASF1097:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1841:
+	.string	"OWNER_MPU_CS"
+.LASF1800:
+	.string	"pgn_t"
+.LASF1534:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1266:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1950:
+	.string	"RX_FRAME_COMPLETE"
+.LASF836:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1719:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1620:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1088:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1796:
+	.string	"float"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1055:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1558:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1169:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1759:
+	.string	"RC_CHANNEL_VIDEO RC_SPI_AUX4"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1116:
+	.string	"__disable_irq() "
+.LASF1562:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF835:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1639:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1747:
+	.string	"SPEK_FRAME_SIZE 16"
+.LASF1622:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1711:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1106:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1203:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF817:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF978:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF2011:
+	.string	"rxIsInFailsafeModeNotDataDriven"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1170:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1942:
+	.string	"auxChannelIndex"
+.LASF997:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2010:
+	.string	"rxIsInFailsafeMode"
+.LASF1259:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1819:
+	.string	"OWNER_ADC_BATT"
+.LASF1812:
+	.string	"OWNER_FREE"
+.LASF1115:
+	.string	"EEPROM_SIZE 32768"
+.LASF1753:
+	.string	"CRSF_MAX_CHANNEL 16"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF834:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF980:
+	.string	"_STRINGS_H 1"
+.LASF1516:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1946:
+	.string	"modeActivationConditions_SystemArray"
+.LASF885:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1337:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1134:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1367:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1991:
+	.string	"rx_min_usec"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF944:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1601:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1356:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1974:
+	.string	"rx_spi_rf_channel_count"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF853:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1681:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1440:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2097:
+	.string	"rxChannelRangeConfigs"
+.LASF1696:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1122:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1101:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1522:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF952:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1301:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF975:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF2105:
+	.string	"rxResetFlightChannelStatus"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1035:
+	.string	"___int_ptrdiff_t_h "
+.LASF2027:
+	.string	"strchr"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1762:
+	.string	"MAX_INVALID_PULS_TIME 300"
+.LASF1899:
+	.string	"BOXLEDMAX"
+.LASF1767:
+	.string	"SKIP_RC_ON_SUSPEND_PERIOD 1500000"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF979:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1162:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1963:
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+.LASF1660:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF998:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1314:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF913:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1071:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1644:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2074:
+	.string	"suspendRxSignal"
+.LASF1014:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF941:
+	.string	"NFDBITS __NFDBITS"
+.LASF1794:
+	.string	"long long int"
+.LASF1548:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF2022:
+	.string	"rxChannelRangeConfigs_Registry"
+.LASF1289:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1740:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1869:
+	.string	"FEATURE_3D"
+.LASF867:
+	.string	"EXIT_FAILURE 1"
+.LASF2089:
+	.string	"rxHaveValidFlightChannels"
+.LASF1731:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1207:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1836:
+	.string	"OWNER_SDCARD_CS"
+.LASF828:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1102:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1124:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1355:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1150:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1968:
+	.string	"rcmap"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1321:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1319:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1304:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF966:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2093:
+	.string	"rxChannelRangeConfig"
+.LASF1335:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1057:
+	.string	"USE_UART1 "
+.LASF818:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF2000:
+	.string	"rcFrameStatusFn"
+.LASF1642:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1247:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1588:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1230:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1393:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2042:
+	.string	"updateRSSIPWM"
+.LASF1460:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1267:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1539:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1420:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1065:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF969:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1103:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF829:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1779:
+	.string	"long unsigned int"
+.LASF1297:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1853:
+	.string	"OWNER_LED_STRIP"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1153:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1022:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1025:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF1768:
+	.string	"SKIP_RC_SAMPLES_ON_RESUME 2"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2023:
+	.string	"rxFailsafeChannelConfigs_Registry"
+.LASF1732:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1677:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1090:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF870:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1664:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1211:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1238:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2070:
+	.string	"rxUpdateCheck"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2082:
+	.string	"modeActivationCondition"
+.LASF1469:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1730:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF1494:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1059:
+	.string	"USE_UART3 "
+.LASF992:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF2021:
+	.string	"rxConfig_Registry"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1315:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2049:
+	.string	"useValueFromRx"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF2016:
+	.string	"suspendRxSignalUntil"
+.LASF1298:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1840:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1250:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1806:
+	.string	"pgResetFunc"
+.LASF1257:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1166:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1142:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF1990:
+	.string	"airModeActivateThreshold"
+.LASF1778:
+	.string	"unsigned int"
+.LASF1060:
+	.string	"USE_UART4 "
+.LASF1260:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF924:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1476:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1579:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF1735:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1155:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF2061:
+	.string	"getRxfailValue"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF902:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1606:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1392:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1897:
+	.string	"BOXPASSTHRU"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1265:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1543:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1818:
+	.string	"OWNER_ADC"
+.LASF1783:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1845:
+	.string	"OWNER_MPU_EXTI"
+.LASF1414:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1810:
+	.string	"pgRegistry_t"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1505:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1995:
+	.string	"rcReadRawDataFnPtr"
+.LASF1435:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1894:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1061:
+	.string	"USE_UART5 "
+.LASF1591:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1210:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1876:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF940:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1715:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1084:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1821:
+	.string	"OWNER_ADC_EXT"
+.LASF1256:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1388:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF2033:
+	.string	"micros"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2095:
+	.string	"rxFailsafeChannelConfigs"
+.LASF1311:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1112:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1842:
+	.string	"OWNER_OSD_CS"
+.LASF2101:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1632:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1038:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1191:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF832:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1625:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1293:
+	.string	"IOCFG_IPD 0"
+.LASF1416:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1932:
+	.string	"RC_SMOOTHING_AUTO"
+.LASF1675:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF1062:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF2031:
+	.string	"rxMspInit"
+.LASF1438:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2198:
+	.string	"rx_pwm.h"
+.LASF2177:
+	.string	"thread-shared-types.h"
+.LASF2119:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2121:
+	.string	"/usr/include"
+.LASF2160:
+	.string	"floatn-common.h"
+.LASF2142:
+	.string	"stdint.h"
+.LASF2106:
+	.string	"src/main/build"
+.LASF2118:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2141:
+	.string	"stdbool.h"
+.LASF2200:
+	.string	"flash.h"
+.LASF2131:
+	.string	"time.h"
+.LASF2171:
+	.string	"select.h"
+.LASF2114:
+	.string	"src/main/target/SITL"
+.LASF2176:
+	.string	"pthreadtypes.h"
+.LASF2206:
+	.string	"sound_beeper.h"
+.LASF2189:
+	.string	"common_post.h"
+.LASF2214:
+	.string	"ibus.h"
+.LASF2117:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2143:
+	.string	"libc-header-start.h"
+.LASF2166:
+	.string	"timer_t.h"
+.LASF2134:
+	.string	"failsafe.h"
+.LASF2186:
+	.string	"platform.h"
+.LASF2122:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2128:
+	.string	"resource.h"
+.LASF2111:
+	.string	"src/main/flight"
+.LASF2164:
+	.string	"clockid_t.h"
+.LASF2215:
+	.string	"jetiexbus.h"
+.LASF2191:
+	.string	"debug.h"
+.LASF2190:
+	.string	"build_config.h"
+.LASF2140:
+	.string	"stdc-predef.h"
+.LASF2201:
+	.string	"sdcard.h"
+.LASF2167:
+	.string	"endian.h"
+.LASF2127:
+	.string	"filter.h"
+.LASF2204:
+	.string	"io_def.h"
+.LASF2144:
+	.string	"features.h"
+.LASF2116:
+	.string	"src/main"
+.LASF2112:
+	.string	"src/main/io"
+.LASF2153:
+	.string	"time64.h"
+.LASF2146:
+	.string	"wordsize.h"
+.LASF2108:
+	.string	"src/main/config"
+.LASF2145:
+	.string	"features-time64.h"
+.LASF2185:
+	.string	"strings.h"
+.LASF2138:
+	.string	"feature.h"
+.LASF2181:
+	.string	"struct_rwlock.h"
+.LASF2169:
+	.string	"byteswap.h"
+.LASF2129:
+	.string	"config.h"
+.LASF2150:
+	.string	"stubs.h"
+.LASF2157:
+	.string	"waitflags.h"
+.LASF2188:
+	.string	"target.h"
+.LASF2212:
+	.string	"sumh.h"
+.LASF2151:
+	.string	"stubs-64.h"
+.LASF2136:
+	.string	"maths.h"
+.LASF2158:
+	.string	"waitstatus.h"
+.LASF2195:
+	.string	"parameter_group_ids.h"
+.LASF2154:
+	.string	"wchar.h"
+.LASF2133:
+	.string	"rx.c"
+.LASF2107:
+	.string	"src/main/common"
+.LASF2132:
+	.string	"rx.h"
+.LASF2120:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2209:
+	.string	"sbus.h"
+.LASF2165:
+	.string	"time_t.h"
+.LASF2156:
+	.string	"stddef.h"
+.LASF2110:
+	.string	"src/main/fc"
+.LASF2159:
+	.string	"floatn.h"
+.LASF2147:
+	.string	"timesize.h"
+.LASF0:
+	.string	"./src/main/rx/rx.c"
+.LASF2187:
+	.string	"common.h"
+.LASF2179:
+	.string	"atomic_wide_counter.h"
+.LASF2203:
+	.string	"io.h"
+.LASF2126:
+	.string	"parameter_group.h"
+.LASF2194:
+	.string	"config_reset.h"
+.LASF2213:
+	.string	"xbus.h"
+.LASF2205:
+	.string	"io_def_generated.h"
+.LASF2170:
+	.string	"uintn-identity.h"
+.LASF2199:
+	.string	"rx_spi.h"
+.LASF2207:
+	.string	"vcd.h"
+.LASF2168:
+	.string	"endianness.h"
+.LASF2125:
+	.string	"stdint-uintn.h"
+.LASF2163:
+	.string	"clock_t.h"
+.LASF2196:
+	.string	"adc.h"
+.LASF2149:
+	.string	"long-double.h"
+.LASF2130:
+	.string	"rc_controls.h"
+.LASF2148:
+	.string	"cdefs.h"
+.LASF2210:
+	.string	"spektrum.h"
+.LASF2113:
+	.string	"src/main/rx"
+.LASF2152:
+	.string	"typesizes.h"
+.LASF2137:
+	.string	"msp.h"
+.LASF2208:
+	.string	"pwm.h"
+.LASF2216:
+	.string	"crsf.h"
+.LASF2161:
+	.string	"locale_t.h"
+.LASF2115:
+	.string	"src/main/target"
+.LASF2192:
+	.string	"axis.h"
+.LASF2139:
+	.string	"system.h"
+.LASF2109:
+	.string	"src/main/drivers"
+.LASF2172:
+	.string	"sigset_t.h"
+.LASF2202:
+	.string	"serial.h"
+.LASF2184:
+	.string	"stdlib-float.h"
+.LASF2155:
+	.string	"stdlib.h"
+.LASF2193:
+	.string	"utils.h"
+.LASF2175:
+	.string	"struct_timespec.h"
+.LASF2174:
+	.string	"struct_timeval.h"
+.LASF2124:
+	.string	"stdint-intn.h"
+.LASF2182:
+	.string	"alloca.h"
+.LASF2211:
+	.string	"sumd.h"
+.LASF2162:
+	.string	"__locale_t.h"
+.LASF2123:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2180:
+	.string	"struct_mutex.h"
+.LASF2183:
+	.string	"stdlib-bsearch.h"
+.LASF2135:
+	.string	"string.h"
+.LASF2178:
+	.string	"pthreadtypes-arch.h"
+.LASF2197:
+	.string	"io_types.h"
+.LASF2173:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\n"
+	.string	"+"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\226\002\035\020"
+	.string	"$\025\212\003"
+	.string	"9"
+	.string	"\354\256\342\024\004\002"
+	.string	"\002\001\001\321\332\305\303\017\004\002\002\002\003\267\335\335\337\n"
+	.string	"\003\222\252\354\340\007"
+	.string	"\004\351\320\257\242\017\022\002\004\002\005\002\006\004\002\007\005\007\005\352\263\360\321\b\006\240\342\234\212\n\007\b\t\277\201\230\306\016\b\002"
+	.string	"\002\b\n\311\274\304\215\f\002\002\t\002\002\002\n\002\013\002\013\002\f\002\n\002\004\002\r\013\f\r\016\017\020\252\336\342\246\b\t\002"
+	.string	"\002\t\021\347\205\253\276\n\b\002\016\002\016\022\023\024\353\337\222\300\013F\004\002\r\002\017\002\020\017\002\017\006\025\026\027\242\302\263\302\013\030\031\032\033\035\202\234\243\220\005\036\251\317\226\266\017\002\002"
+	.string	"\002"
+	.string	"\037 \332\322\230\254\002"
+	.string	"!\264\370\341\227\005\"\361\361\273\257\016\"\021\002\n\002\022\023\017\002\017#%\350\300\306\254\005&'\376\340\327\201\004\004()*\214\276\367\272\016+\270\220\334\340\003\036\006\002\006\017\002\017,-./0\217\300\253\210\r\b1\365\273\261\345\024\002\025\002\0252\202\245\236\333\0063\305\204\223\201\003\032\002\024\002\024"
+	.string	"\002"
+	.string	"4\231\265\224\341\f\t5\370\355\353\234\005\b"
+	.string	"\002"
+	.string	"6\317\356\361\267\004\n7\354\206\342\366\0068\266\325\307\362\0029\274\360\202\340\003:\352\276\233\352\f"
+	.ascii	"Y\250AIA\231\251\032\205M\n\303\001p\202R3e\036\020HI\246&\251"
+	.ascii	"\244\003\017\b}\0267\2464\326\262\310j\200\377c\263[\303\260"
+	.ascii	"\250<\214\263\240]LF\032\332\234\247f\234\235\206=P7\212I\301"
+	.ascii	"r\"b\236J\271b\022kR\230\230\3539=K\364\205\027\350u\264\347"
+	.ascii	"\265\201\024\215(p\343\264W\311 p!\r,\177U;\302>\323\305\206"
+	.ascii	"\305\312B\306\274\374\330\302\232\221\210'\304\364y\026!\364"
+	.ascii	"\2162\325\224\334\265\215T\226\203\321\275an\211\374m\365y\275"
+	.ascii	"\370\370ly\322x5Z^\375\374=\333\355:\226vb\352\366\207F\374\016"
+	.text
+	.section	.gnu.lto_.ipa_sra.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"\235\004"
+	.string	"\362\206\022\026\200\317r30\0033_\317\220\033\02713D\370?\022{K\231RN\314\274\354[\256\254M\346\247L\226\354\b\3441\035\263\301\370\205B?\261;B\235 7\320\371(\220\357\314\321\245\245*H\nL\315\334"
+	.ascii	">J\357\301\r\001! p\002Qh\033\020\344'oaf\355\313\"s\205\367"
+	.ascii	"\207S\203mYC\365D\342K\017#\2778\303\346F\312H\201\215\240Q\224"
+	.ascii	"\303\b\354\210i%,\250dXs#qdp\207\241\240R\241\250\203\341\213"
+	.ascii	"\0137\004"
+	.text
+	.section	.gnu.lto_.inline.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\332\004\335\025"
+	.string	"\006\337nI\300\224Q\032\0036\030\364\017\270\235V\251\231mF\334\365]\360\236\346Y\300\354\026\321\352\221\265\273\350\024\272\265\220\271e\233RvY\206\2369\330l\233\006\312\"X\004\364\361\366\036T\024>s\024}\330\242\202\255\231\260\177o\271SU"
+	.string	"X"
+	.string	"Z"
+	.string	"\035\246\313p\346x?3\300Q\377\364p\203j=<\252\231\005q\002\007\321\313\374UV\312\237\265\362]\316,\021\316G\211\226\351\364Pk\245\375|i\266\310\315\006wB\263H7\033\234\311r_\330\326Z\353\351esh\034\221"
+	.string	"\354K\331\034\307\021)\365\0046\351\b\271\236\220\024JC\262V\303?9d\220\024N\254\335\260i\031\256\256\306\346\303\262\200W\301\346\267b\25555\370\352dB/\354\322\216\235\235\005\263\025a\204\033q\340\324/\3214}\220\204\312\320i\253\365R\360\245\340Kc\246\222\215Q\224\177\323\357\301y\312\312\225u\311\225\r:\"=\025\023vA1\216I\252\237qLBm\340C\323\255\227\331\335\032*-'\234Z+\352\002)\371K\224/U3\266@J:;:\333\036Gnt$\214\371\263\254\\.g\323H\013\026\274\215>y\360K\366\233~\025\246\256\306\266\333a\206m\256\027d\267\nq\372\330\332\002K\210\020NZ.g\311e\177\312\326\004\220\216\007\312\020\266V\353\341\371~\360K\f\267~\270+\241Z+\312\016f\f\034\316\017\222\024$d\344\260x@\206n\f\270Al~8\252\267U\016\237\243\242"
+	.string	"3"
+	.string	"\251l\205j\245\301\354C^\334\270v\275T\374e\027\n\022X\330\235\bJv6W\004\025\365b0lr\250A9Sd\344\204$E\205\225\003`\002!Rc\346\001\022\240\365P\0041!\006\232"
+	.string	"%-\250Uw\216g\263/\370\244\t&\211\037j\022\017:+a\327\352:\307\330\225\244\310\234\256\020\024A\262\n\232|\335\316SR\330GC\246\361\204\326\243IHq\377\t\375\357d\256y\307\007\236\341\332\2526{\226\261n\222\234?\205r\200\310\331\233U\261\202k\211T\263Yc#\034\2447\357\356\245\360,\227*\377\260\337\352\242a.\235Y40\321\351EhC@\2678\036\f\330A\363\211N)%\214\021\222xU\200\373L<\027\370\233P\220\033K\276GT]\317a)\002\370\266\217\320\276\031\265\246&Y(l\223$\350\f\300j{\252o\316\277\360."
+	.ascii	"[\240?\321f\306p\351\007\003\002{\372\177\307\301\305\353\342"
+	.ascii	"Z\232\3345\213\024\305\034\230_\241\226\322\235s\354\316\013"
+	.ascii	"\315\3612LT\215\213\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\024\002%\f"
+	.string	"fR;7P\207(\303\001 \323{)\034\375\213\302nh\0061UUU\r\332\265\2314\0203\223A\364\322f \bm\265'\206\317\210\306\226\306\b?\017D\327\366-\021{K\231\002'"
+	.string	"-"
+	.string	","
+	.string	"\245"
+	.string	"\256 \312\260d\357\261]\263]\374]\213<\372\002\204R7\251\223\310\266g\223^\351\223-#\353\030y\345\310\267A\244\242IE\245\245\223\344\t\302\225UY\354D\355\037Tn>\026 \t\260|\203*k\216\236\210\364D\345"
+	.string	"\332>\"\201$\320\216\220#\024\t\030\260\023a\376\341\035\246\001\266\244\245\254}\003/D\300\252\226U\313\2420,\275\367^\237\312\222\324_\237\3533{\007\310\213\245%!s6\022\032\214\214\013\013\310_\361\024O\023;\n\347]]\335\200G"
+	.ascii	"bX\223l~\316r\032\227\262&\251S\320D\270\253>5\363\017\361\013"
+	.ascii	"\002A\250\3410\354\314\220Ti\315\254\001P\002Q\252\314<\021\300"
+	.ascii	"Pj\306H\212*\325b\342B\320\331`]e^|\353\275\212\227\021\242@"
+	.ascii	"\030a\225j\213\216\366Y\222\200\220\361\346\225eE\030e\277\354"
+	.ascii	"\323\324\305s\367GI\377h\221m\360PAPBD\251\220\243\310@\242a"
+	.ascii	"\200i\321\226\221\320\204I;1\253\027\333\274T\244\254\2331\226"
+	.ascii	"\357H\306\030{\023\372`\212\221\245\022\304\236\314\372\221\210"
+	.ascii	"\340\213\t\233\273\341\006\304\374\017\357i-\237\\T\267*\251"
+	.ascii	"\207)O"
+	.text
+	.section	.gnu.lto_.pureconst.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375 V]\002"
+	.string	"b\305\021\033pW\351\255\036\253\376\377\277\256\252\220\b\245j\003R\007\320|n\360\261\203\240\265\035\037\342;\\\303-\234\204sp\0057p\001\267\372\250o\032\2453\272\320}\256s\231q\271\312\230\214\310\375u\274\214\2638\2551\263D"
+	.text
+	.section	.gnu.lto_.ipa_modref.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`O\001E\t"
+	.string	"r\r'+\200K2\034\323P\021\0038V0\331\204\213\004M"
+	.string	"\3721\002L8\2665\261l\210D\210\264\245v3\033Ikz\331\256\215$\311\024J*.\250"
+	.ascii	"u\022J\275\210\007\241\322\017\225s\345,\303\271\317k}\341\310"
+	.ascii	"`\354\342\\\313\r\2279\323(94\250\306\362\201\231\230!\362\214"
+	.ascii	"\254\332-\274\324\016zB7>IQe\224Y\236\226\r&\005>\220*\354\246"
+	.ascii	"\347tC\240\364\034\211\243\333\204<\023\236j\341\003\212\260"
+	.ascii	"\213\236\321\256\362\244\334(\3201\200\372\1770\237\347\344a"
+	.ascii	"&\304\207N\021> `\002!fu\007PVd\267\003*4\b\347%&\320R \306u"
+	.ascii	"&H\203@e.[\272\256\332V\016\3618\f\223n\276\256\275\326Z\034"
+	.ascii	"k\020\rVEx~\267\340T\364\214@\017\246\241\303\013\202\254)\004"
+	.ascii	"\034\027\275\270u\265\206\031\263\031\317\256\227hBT\303:\002"
+	.ascii	"\013!2\303\036\214\235\333\276\261b/{C\301\032O\037\356\375\001"
+	.ascii	"\026~\222\260\217\001\342\"(\214\363\261\353E\266\304K\224\341"
+	.ascii	"\262\033\340\355\034\230\f\256\b"
+	.text
+	.section	.gnu.lto_.lto.f85406b0b830fdf2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rxConfig_Registry.83.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375 ~\275\003"
+	.string	"\264\006Q"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\303\357\341\035\005\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\376\004us"
+	.string	"\005\001\006'\001,\230 ?\202\210\200(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\003"
+	.ascii	")\"\245(\362\006P\004"
+	.text
+	.section	.gnu.lto_pgResetFn_rxConfig.84.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\372\001\r\016"
+	.string	"f\230\\F\360T\225\016(\230\003N\r\361\375\362\277\227\274\246\306\207\270\005y\b\234\243\307\2651,\252b"
+	.string	"\302\035\326\"P\365\245\021D\204\001{w\216\264h\257\021\005\216 (\216Q\t\365\342g\2049\351\204\216\034\022\264wJ\001B"
+	.string	"G"
+	.string	"N"
+	.string	"\317\221O\251\275\263\213\273\201c\327L`\003\337;\233\007y\357\276{\274w&\355\"7W\354U\316\021+0\273\013V\025'OI\3770\256)Ql\247"
+	.ascii	"\036\354\256i\211r\342\256\267}\3006\312\246$\002>\275\373\234"
+	.ascii	"Ih\337\315\201\037\003\004\215\236,\374\232\367\3563\304\310"
+	.ascii	"\215\306\370\223C\261\004\311R&\266i\2435\205\375\314\356\256"
+	.ascii	"+\316~\312O;\025\026\346H\250e\267DL\223}\351\\\\\330\376\306"
+	.ascii	"\026\265@pj\377E\rF\357l\f\031\350K\213DT\233\251\215\\\020\002"
+	.ascii	":L\bP\321p!\242\247$u \001f\250\376C\344\254\336\303\323:\217"
+	.ascii	"\031u}\307\214Cd\303]>\226\327[\304\215\217\217<;<\213\030\212"
+	.ascii	"\275\306\312m\017\247\361\027\360\354\017\2271\0136\225\026("
+	.ascii	"\230@!\002\004\215K)\226\351\304\340d\"qZ.\026,D\311\306\317"
+	.ascii	"*\222l\004e#\bs\245^\240j\214\201$\217C\016\253\021\354\020\206"
+	.ascii	"#\2701\367\231\2558K\310\361r\253!\f\242\264\336\374ia\300\271"
+	.ascii	"{\362\362\302w\022! \300\202\031:vB\024\201x\346\022\r\350\330"
+	.ascii	"\334\340t3\355\370\312*F\030\002X\265@\352]\230\300%\t\324z\025"
+	.ascii	"\tD\305\n\003\200K\b\304P;VF \270\241e\023\202\211\303\032\320"
+	.ascii	"\274\251\265C~\350o\035\r}y\321\0362"
+	.text
+	.section	.gnu.lto_rxChannelRangeConfigs_Registry.87.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375 }\245\003"
+	.string	"d\006P"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\325\342\033\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\345\006us"
+	.string	"\005\001\006'\001\020,(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	"K\205H\271)E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxChannelRangeConfigs.88.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\335\001\215\021"
+	.string	"F\241uG\340\360&\035\262g\362%\026Pc\243\212@L\024\307\006\256Zn\243/\336\347\344yT\212\2330\252\330s\206\330Q\317\257\365\2705\213|\370\2021\232\261\b\3512\272\254\203t\324-\\\013\235\334?\241\r\255\021\262\245L)^"
+	.string	"\\"
+	.string	"c"
+	.string	"\033\"\260\210\352\235\303\207x\357T\007\361\336Yf\323x\350\263'\372\271!\302\261\273\237~p|\f\357\230\262wQS\346\017]\344\307\005\016\215\346]\364\310\005q\370\240Y\210&5\243\334o\317\034ZMF \235\353o\037\001q\003\207\246\363L\251\354\256\023\207\246\341\366n\033\264\315\300N\001\001\276sA\265#+\217\275\272\320\237\272\355\216Ok\2463\323g\255\234b\214\314\330\305\020\245c\227\272\026#n\373\355\2676\244\370\241\1773\253UK\261\355\247\270\n\331mFR\321dP\025\021\211\250\261\273$\357\274@\365\256\025\317\262[\027R\236\366O\034\205\354B3\017\260\313\263\343h\003\007\036u\245\267\3510"
+	.string	"\227\004\340(\346,l\244\230.\343\331\023\276B\246"
+	.ascii	"\323\356\242\370E1\n\004|B\274\363g\274w\006|\234RS\252z\233"
+	.ascii	"\0227\f\357\232z\033\0225\031\345\250W}\272\3311\313({\340\224"
+	.ascii	"TkF9 5\311o\273\002\017\263\204\362o\217&v\022\227$c\023\312"
+	.ascii	"\016iR{\0340\267\211\313\345\004%\001\312I\311G\314\013\214\313"
+	.ascii	"\013\266\322\362\362r5x\320\362z\271\034\254\304\300\020\263"
+	.ascii	"\224\304\300/\006~/\030\027\204\217\005\214\371J@\f\213\320\002"
+	.ascii	"~\022`0\360c\205{\345\361\207\256\302=-\315\264\246\323\036\247"
+	.ascii	"^\350J\265)I\0365\3076\222\027u\245\251B\346P\332\211\2522K\250"
+	.ascii	"\307\335\335\270\322\333\336\n% p\002)\205\263\003\367\n8\n\370"
+	.ascii	"\035\302\036\020\024-\323\301\316\232\032\253\261X\241\325_\205"
+	.ascii	"\007)=\342\b\036\243\303\267\023\223p\347\002\230\2710p\203m"
+	.ascii	"F\331L:vv\005\267x\333\260\254\311A\3205\013\033\303\211\370"
+	.ascii	"\366\225\245]\204E\270\027*\307\373\021\351\\\353\t"
+	.text
+	.section	.gnu.lto_rxFailsafeChannelConfigs_Registry.91.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375 }\245\003"
+	.string	"d\006P"
+	.string	""
+	.string	""
+	.string	"!"
+	.string	"\005\001\212\001\202\200\200\374\342\203\336\202\023\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\374\006us"
+	.string	"\005\001\006'\001$+(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\023./src/main/rx/rx.c"
+	.string	"\004"
+	.ascii	"K\205H\271)E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_rxFailsafeChannelConfigs.92.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\220\003m\031"
+	.string	"\266\356\244H\260\226Q:,Dg\220vm#D8J;p*6l.\241\276\200W5\255\305K?e\214\347C\340\331\342\245CE\0345-\303&\260-\374)\375\251_\270R\020\267\320\373b\222k\342\017x\350\301\225Z#{\313\235R\214"
+	.string	"\210"
+	.string	"\227"
+	.string	"\324f\336e\327T\331\271\264\277\364 \270\013\t\201@@-\362%%\251\265\207c\006\255S\367n <m\275@xj\234\215\345\275\033\365MA\216\232\254j\255\260\265a\002\237\275;\224\270\263B:W\342|\2463P\312\262\033\211\316\232\233\203K\322k<\232\025\224$u\371\357\022i\324\311P\206\307\212S\025\2373\302S\f1\257\261h\276v@\321\271F\021r\377\373\003\034\301\335\270\342\222u\241\326j\271\033O\334\255\3336a\373f/QNB\271\2737\352\021\256\334y\344hLN\006\215\363p\277\t\246\216\226t2\350"
+	.string	"\300q\247FX\221\261\276\371}\267\020#'\257\374\337\347\217\031\322)(\245\312+\273\247\223\313\263O\343\245\205\224\267\206=s!\277\f\225f\335w\207S\232^z\256\364\256\264\224\322\177\271\\D\271\361Rk\211`\230*E\241t\334\367\333\257\331\262\343\367\374\237]5\\v>\344Dp\3679\252Ed\242U\244\211IK\255\365\346\324\031Z\0177\202Q\263\013\262\326\346p&\256\031T\276\264\310\311\340\244\313\363\323mr\007\376\277?\005\220\205\324"
+	.string	"\247%P\277%P4SD\212\345\t\t\220'$\007|\034Z\247R^\331\365\344\216\nm\343\252\221:\225pP-Y-\310\261\003@\036(\336\311Q\263WG\0024\306\030%\3019\265\206\0139iE\002H\226\271<Y\345\273R$\3018"
+	.ascii	"\020\205\024\272\266\207\033\021rp\243\326\252\343\027\371pk"
+	.ascii	"@\245t\352\207\bOi\324n\313\227n\202\251]\231\235{#\037\362\016"
+	.ascii	"\262\r3\331\004!\002\255e97YP\214\006\253\2114\232\330C\023D"
+	.ascii	"\213\355\354\226\020\373\231\240CAgB\316\353\266a\366S\023y\200"
+	.ascii	"|j\265\230\214\307\347'v\003\232\3050\f\331\020\270'g\310\006"
+	.ascii	"\033\262\301j\263\030\r\326c\273\301r\nX\354\340c\203\005\211"
+	.ascii	"\242\r\346\352\345\2765l\246\267\200/\244r\253c-\317\254*:\263"
+	.ascii	"[%o\036.R\270<UE\022\314Y8\005C9k\2555\\\236\345Tp\241PR5\201"
+	.ascii	"\261\364B!k\221\354\231\275\3576\020\036\356\314\006D\250Q<G"
+	.ascii	"\0202\2100\301\214\210\314P\032u\300\002\031\262\351\006\021"
+	.ascii	"\240AsTZ\267\034\2130U|\r\310\\\217(\263M\224\266\2501\254\215"
+	.ascii	"m\322\311\316=\n4A)]\025e\003a\342L%n9\233;\220xa\030\324+3D"
+	.ascii	"5\250:\220\354\353\362\305L\252>x\250\264]\264\210\303\205\312"
+	.ascii	"\212,\311\320\256\353\240\230\006\330\332\347\360\234\334\364"
+	.ascii	"\251bg\f$\265\206^W\356\362\355y\027\204D\252\221\272\207\335"
+	.ascii	"\366\215?\020\3511\007y \022~qt\\O'\201T"
+	.text
+	.section	.gnu.lto_resetAllRxChannelRangeConfigurations.93.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\355\001\305\021"
+	.string	"V\241vH\340\360&\035\300\237\314$\rf?XT\261[\t\214\013\213:)\315>-\353@\357\t\023\260Qe\301\237#S{\356\326f}~\253\200\037\264`\214f\fK\272\f"
+	.string	"u%y_\002\360\006^G\203e\302\210%d\313\235R_"
+	.string	"^"
+	.string	"c"
+	.string	"\273\242\002\213|\357,\236\200\367\356;\210\367\3160\333\306\305\021{\"\244\rD9v\027T\021\236\237\342=%\354\335T\t\363\207.\322\203\303\2066\363nz\334~@|\3204L\023\234\243\333m\2273\232LN\237\233\353mO\320\203dC\273\271D\251\354\256\245\r\315\303\355\335vh\333\201-\021\004\342\214T\036\373\276\375\340$Yw\354\324\367\332??\336\362\265\373"
+	.ascii	"\376\0017\006\221\344v9\344v,S\007\243\304\307\337\376\352(\305"
+	.ascii	"\027}\233U+\027)\266}\025_\001\373h\245o\246\303WD\024\343\306"
+	.ascii	"\356\216\274s\203\357]\310\274\312^\211)\227\366S\\\b\366\232"
+	.ascii	"L\001\001K3\316\222\002\252\022\223\270\317\335\335\231\322\217"
+	.ascii	"\017!\271\324\224\276&G&sV\231\370\364\265\207\210\277~\2525"
+	.ascii	"jN\310\202\002$Yx\013\024M(\247\307x\366\205\027\305|\273\213"
+	.ascii	"\342\263\310\200\301\200\023\211w\276\214\367\356\200\323SL\346"
+	.ascii	"\354a\004\244\212st\363Q\217\374\343\031\204\210I\234o\373\004"
+	.ascii	"\322\221F?M+qv0\267\t\313\345\004e\001\312I\311\307\013\214K"
+	.ascii	"\313\265\322\362\322b=\210\320\322j\261 \254\274\302\001f)y\205"
+	.ascii	"\340+\004[0,\t KH\001,\001\261kBK\bVp\271BP%\356u\307C\377\214"
+	.ascii	"\204\230b*\353\224\307(\031\232\322\327R\216\034\271\324\331"
+	.ascii	"mO=-\275\320O=\345\324\353\314J\236\324\025\0324R\307\f\235\313"
+	.ascii	"' \220\002\2412\352\001\346\n(\n\3705$\224\3670\207\373\215s"
+	.ascii	"P\232\303\032#b\002\266]\007M\333J\254]\310\272j$\201\224o\322"
+	.ascii	"\004\202y\r\204\007\226\206k\212v\350\b\207X\024\217\021\326"
+	.ascii	"a\262\003\022\202\211a8\301m\367\033)\325\275\340\020\341^\250"
+	.ascii	"\036\357C\244s\345'"
+	.text
+	.section	.gnu.lto_nullReadRawRC.94.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\205\t"
+	.string	"6\321B= \005)\035\200\324\005Q\263Y\326\006\214\343h<\307"
+	.string	"\300'+o\035R\031\271\354\243\206$\216Q;0\bcQ\353\005@a\202\226;\242\276Y\315 \360\203J\353f oK>\331)\005/"
+	.string	"0"
+	.string	"1"
+	.string	"\001\266\234\214\225\333n\235\242\027|\336\311\217>\357\270\217\217\227\243\177\225{HDtf\264\330%haw-g4\216\233\273\355\003\333\016\266e\002\036i\227N\342S,.Z\031N\bC\350\035\251\243$\245\375\223\243\210\257\027'\330\255\335\\v+\202\rB\357\\C\266\375\222\233\210\036e\005\331\b\373\361\243\340\201\301\311\354\315x1\222\005\346f\345\216]c\222\263\331\367\354\356\232\253\331\322\243\261\371Zv5\002"
+	.string	"\330\232\356e\304\266h{6\251V\n\022+\020LE\250@NH\261L\250\023\312\364\t@\264X`\330\260r\265^`\305\003\214\016X\365\301\350\204\321\t\266R\256\251\242\024\363\0339\234X\321\371\nC:\275\032\r"
+	.ascii	"\2213\240\314\200`\330kX'\004R9\274\322\374\\\370\022\031;*\324"
+	.ascii	"\020p\302H\265b\022&\031"
+	.text
+	.section	.gnu.lto_nullFrameStatus.95.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375 \304\225\005"
+	.string	"\"\312&1pU\323\001"
+	.string	"\240$\241C`\017\320\006\b\277\255Auj\3727\224\225]\263\315>x\233\331;\311\357\252j$\361@Z\036u4XL\330\266\267L\001\257\250k\3625y\022yH\270\232\026\246\020\267(\220\311\027\313\232,ko\354~Zht01s\351iX\360\327\f\306\317\277Sw\367c\367CI0\300\245\356\355\300\240\005\b"
+	.string	"\336\177\354\227_0\260\323\255\241\355\240\3716\244\257\273r\004-]H\277;\332I\344\005h\\\266\320\340\350\356C\215\343\354\343\376W\374O\374\257\004\007"
+	.ascii	"2\003\036jt\257\302\232k\336\022\202\204;gj\347\023"
+	.text
+	.section	.gnu.lto_rxInit.101.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\031\f]="
+	.string	"*g\304\026BP\236N\007{_\006hn!\022\013\023n\307\177\273\201\001\201\253\313\326#\331\023\372t\237\215:R\235g\002\226'\361\204\307\013\001\0162\226\206c\204"
+	.ascii	"\231qS,\\\227\214\271\233\326L\204\354\275SJ)\\\001G\001[\001"
+	.ascii	"6\214\027\317\370e7\006\313\330\253\220\347h;n1\017\246\304-"
+	.ascii	"\214z\353\256\nwg\200\214I\365\016\223\243\357\230\217\303e\216"
+	.ascii	"-\271\232t\231q\352\225=\030{U\332b\342\356\302]\247\324\364"
+	.ascii	"\322_\332\006\243\243o\227\330q\210\335\235\340\275Q\b\306^9"
+	.ascii	"j$\200G\312\310^\t\030\n\335\346\233]\024\002~L\334Pn.\214$\020"
+	.ascii	"\310\324s\275\245\355(\363-5\243\367I!L\035\264\251W>`\354u\251"
+	.ascii	"\215\330^\325V\262\275\362\216\206r\323\222\3024\350\275\027"
+	.ascii	"\251\"[f:\035u\273m\367\346\345\005\317\275\367\351\227\024\025"
+	.ascii	"\025\t1Q\253\321f\365\333V\022\r\t\005\001\375$\221>Gc\221]\325"
+	.ascii	"\367\226\273x\201\214oK\316\335S\253\225M\232Hu \230g\247\247"
+	.ascii	"bMT\243\260'\316\226c\342C\352s\341A\353\251\330\233J\341\320"
+	.ascii	"\013NK\315\\H\311\230"
+	.string	"[\007\2515\320OZ'\215\344\2419r\212\330\231\373L\305\324\324\245\27260E\254\210\037\245\335\300N\n\333\230[\033\r\024\213\027\330\306\2104\013\364\364R\227\344\272|U\377\t!\030\320\223K\245\220\007V\370\365\334rU\212\220\376\346\322nf\215T\316\335SH{\361\302\275\227\335\371\034k.j\346f2s\017f\344\007/\202\374\356\275\023\270\347t`+\205J\033\027\307\3069\330\357\337^z\230[+\r\330b1\336\333\224\300\355\327\177\255\\\253\245\335\322na{\355/\3607\227\324\2533\375*\207\200\323\347\246\nkLG\344\346\322j\034\233\353\021\262?\326Z\212\345\206\323q\2442h\320\300\366\252\344V\350f\272\201\345\356\3537\033\270\341\270\203\007\017l\257F~\205}\206\203-\202e\006\321lD\254Q\340W\250f\004\211\005&:\315\t4j\240\353\245\231\242H\221\300\357^f;\231U4\337\n"
+	.string	"n\367^\t\334{mf\212\033\256W\246\252\362v\366\312]5\3069\204\351{\330\210,\212\341\340uD\346\350\226\177\033s#A\341\322\307\237\2049\nj\351\224tf\220t^\220t\026\320x\315\001\232\2569\251\243\315HG\347\243\2423"
+	.ascii	"\325\331Hu.B:+Yg\"\326yHu\026R\235\203Xg \326\371GuN\252\316"
+	.ascii	"H\244\263\017\322\371\350\343ld\235\213\2543{t^\215\316\252\321"
+	.ascii	"\371\213\316\316:w\004'\2674\2647&/'z\303\366\344\271}\253\036"
+	.ascii	"\224\306\353\246\353\216\3663\267\222\030\023\3471R\351\311\304"
+	.ascii	"d\272L\333x\001gS6,\f\253C\372\374\361\177N\272\246\351\207["
+	.ascii	"^6\244\375Z\317\310\204\370\274\217\371\233\343\362\261\326\213"
+	.ascii	"[\037\376l\277\036\272\212\205\035\277\333t\023\372\251\211\371"
+	.ascii	"\264a\254\361\263\244\177M?\374\341`m\330\007%pi\320/\037\356"
+	.ascii	"\324\361\n\336\366\312\246\314n0-\305l\315P\220\351^\355\231"
+	.ascii	"\317\361s\366\030\346\017\336\325>_9\345\2232\201\366\312\336"
+	.ascii	"t\2566\bY[V\306f\334\236\031\327\306\020@\351\203B\261\007*H"
+	.ascii	"2\266+\246\207\022\357\316\374x#L\372\016\323Ku\335`{dr\360\346"
+	.ascii	"\216\034\277\215\275\270\340[\256\217X\312\350\260\f^\300\177"
+	.ascii	"\321I\367\202\bX\272\326\213\037\277G\"L\337\243\032\213\277"
+	.ascii	"\300H\353I,~\227)\262\317\340\275\016\342!\373\025\336\346\222"
+	.ascii	"e}\202l\313`\327\357,R(_\272\334\036i\221x;\327\247\261\326|"
+	.ascii	"-n\271\366\321K\234\256\337\306E\300\217\372\007\364\246F\372"
+	.ascii	"/\346c\221>\003`\323\017\335 \375\005\246#v\031&ptj\324w\264"
+	.ascii	"\227\0364\322G}\027\030#T\013\245\224\334\006\233\260m[\322\276"
+	.ascii	"\275yq\016\302\265\024\373\257\376\312\246+m\313\367\260\003"
+	.ascii	"gn\235\264P\274\235\377M"
+	.string	"\266\266\365Z\234\324\2733}f\016\321t\002\f\243\312F\214\251\033+\303X\322\210\201\225U\343\n\213j\005U\326\023\225\213\0018\252Z\\Y\255`\255Z\\ae\270\302\262\2521u\303\252\006\225TU\013,\031G\fa\312E\224\204\b\022\242\226@V\315TK\034YO8\262\236\256\254\246d<Qe\321xZ*\031kFU\326S\r,\254\254'd\224\331\237\204\327\2705CA\346o\2612Y$\352O\230\334\n\0231xC\035\256\312\302\222\302\264=o\322Z\374\255\335\322Gt|\322@\350\275L?wc\036\211<\366x;\215q\324\360\f\005\271^\213Y5l\320\036\372\342<\023\026G\230\334C4r]9B\364mx\372\350Y\364=z\b&\324\242\206\203CAP\377\200\306\246N*J\222\322\251\367\336+\004\365M\227\364P\337\255\026$\210\007}\033\367\331\220\037\247o-fz\222\313\017\360_\314"
+	.string	"J8\333\013\243#\355\034\f\360"
+	.string	"\036\211O-z\243/\006*\277\350[\313\323Z\257\024J\004\215\240)\337\351\017\3134\3007\036\220\223\027i\242wr\263\036z\"\241\037z\320A/\364I\201>\037D\345\347\333\276\361\212\315\266\301\002\375\362=\251m\260?\017\364\3355%\371?\377u\226\215\374\344'%\036\037\371Hq\212\366\324\222^\354\361\233M\n\250D\233\346u\003\331\013\200\373\250a0$\025chfDD\222$Ik\200\002\231\241\"\352\006\021@\255U\214d&Is\325+\177\034\244\374\251\355\1771\032\233\364d60e6\365\361Z\355\253\376\260\n\372\030#*=\345\357\025\022\314\177%)\306|\321\027`n>!\354\224d\271R\367\341\267\032)-\271^\300\3516\3556\362\007!\255Dq"
+	.string	"C}Z\323\316\026g\004f\321\351\377\367\267}Ep\370!D\f\373\215xr\0015\023\203\230\2300\0052\027,d\361\177\251\247\371Mt\200?5g\376\2514|\326\3730C!F\306\264\256\216\374\001\031\273\223\341\243\033\022\274"
+	.string	"\215S\371s\224\321`\036\306Y&p\244K\245*\r\272\033l\373j\rFy+\2453\325\bu\f\204bn\275<\235\374\007\025\370\252{\362'M\347]\221\360\304J@\307\334\306\264\223]\335\375(b\267\341m\236\2311\372\306\322\370\231\243\266\325 \332S\345\360\002\225|\236\023\216"
+	.string	"\027\257%VN\327H/\372\215\306.\363R\370\3734\311\201\323r\366\305e\204mP\327\b\314'\b~3\341\374y\272=\024\263\353v0h\t1"
+	.ascii	"\003\356\006a\2207\223\020\331\256H\260\317\320\201+E\035zV$"
+	.ascii	"\360D\207\234\357\310\322\207\006\252<\004[B1\b\303\250\3066"
+	.ascii	"\316N\356A0\301\246<\303o\216\340\2646\273\br\241{\321\266;\243"
+	.ascii	"\265\245\023)\327@\270\364\206\257\036@@{6\332C\006/\343\220"
+	.ascii	")\275sO\2562\351\325\245_\005\375 ;T@(\007\3579\365\274\241\016"
+	.ascii	"\240\3064\343j\202\232\372\232\3332\214\3228}2\016]q\375\347"
+	.ascii	"\006\270\347&\325\254\241\304\202\005\217\337\256\353\247\024"
+	.ascii	"\255\205\303\035\306\217\366\035\302\007X\262W\006N\200>\363"
+	.ascii	"\370\331\260\310\2733\216\373\263Y\267\343I\n\331u\367E\220\277"
+	.ascii	"\027m\376"
+	.text
+	.section	.gnu.lto_rxIsReceivingSignal.103.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375 \345M\006"
+	.string	"\342\013,3PO\222\016\203\362MZ\b\324,]^\200["
+	.string	"\001\034\213\353l\353\306B\326&\2559\2533S\003\210\343\231\231FN\364Y\241\317\002Y\0262\333\032\3312\005k2\033\3276\256=4,84\215\213h\031\201+\b\006\327$\252\3125\352\312\216\214\340\303(\276#%y\327\343\t\016\326\352t9\230N\310\0028,>8\232\272Hl\371\313\203,\343+%\303\370qd\003/)\n*\231\240\221K\242L&\037\177\347\251\017\020:\277^\033\240v\210T\224\260d^\215i\364\025\337mH%\220\223\025+\344)\002$d\346h\205D\235\3657\370\013~Q\b"
+	.ascii	"2\003\302\260X\302\335\256\211\177\021x\t\221\303\2353\265\363"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_rxAreFlightChannelsValid.104.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375 \345M\006"
+	.string	"\342\013,3@o\222\016@\265*>\244\356\013\272\353\346Zl>\213F\320\234\tX\242\370?\261\007\204FH b\207h\307\200\360a\206\202\033=F\337]\374\255\221-Sg0\032\3274\256=4,8\264\214\213h\030\201+\b\006\327$\252\3125\352\312\216\214\300\303(\276!\025y\267\343\211\r\326\352t7\227N\310\0026D\036\034MY$\262\374\325A\206\361\225\222]\3748\262\001\221\212\202I\346g\324\222)S\211\307\317y\352\003\004\316\257\227\306\247\034$\025#+\231Wc\031}\305w\013R\351\343\004\305\002u\212"
+	.string	"\t\2319Z\240Pg\375\r\376\202?\024\b"
+	.ascii	"2\003\302\260X\302\335\256\211\177\021x\t\221\303\2353\265\363"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_suspendRxSignal.106.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"\335\b"
+	.string	"vP<90\3456\035"
+	.string	"\360\233\205gg\214>'\303\340\242\232\357\257\003\224\026\254\020\303\023 \264\366'\222\201\337\264T\315\336\241^a`D\020\260\020\376\0214I\213\307\030\231\b\2212\245("
+	.string	"+"
+	.string	"."
+	.string	"\276\306\234\rs\360co\242\302 \231\331\335\250\036\347\236\234\177\323\007>R\367\fX\330]\347G\322\270\365\266\025l'\330\327V\332\242\212\374w\025qx\3329S&\226M"
+	.string	"6\330\245v\330\267VK\366\323\371\364\005\016NV\032Zv3V\0016\274RB\354\276\310G<\237,\303~\031\270\310d\352\224\352\243\016\202|\020Ol\227\277a\277T\345\213\031\345\312V\225\204\007a\327T\353\345b\303\313\225\003\346lBZ\fi1\242\343\360\211\034m\213\233\002g\022\017Z\244\3102-j\300\275\265Zb@\tG\352\231 \177\272\r\321\311\177F\260@\335\203\005\017"
+	.string	"3\241\017(0\356_\353\241\335\246\360"
+	.ascii	"\213\227J\303\324\006(\264\362\247\026t!G\030\354\277\214\013"
+	.ascii	".\335\242\235O"
+	.text
+	.section	.gnu.lto_resumeRxSignal.107.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\005\b"
+	.string	"\322\21656Po\322\001\200\232\007\205*\302\036\336"
+	.string	"\004\013$\277\372\0277\355\255\352\274\003n\226\b\234\344\326\355\263\254\331\270\021\203\230Ad\207\026S H\234yc\t!R\246\024\356pF\320\215\240s\360,\200\\\007\206\034G\300\357\201\001\272\210\367\240\333\244\366\327**a\305*\251\311\001i7x\362\321\005'\371O\346\177\034\344\003z/;6\260\002\223*\223\253\337q\017\b_\303!\021\346\213\262cJ\022_J\331\362\2256I\"\037\257$\013\223nNU\211\312\246\214\235\332R/\354_\253(\373\351k\bPR\024V\273\024\255\231ea#\033\266\277\261f\273<\225\261\027i\231\b\211\331]\247\030\327\236\232\177\216\003\304\323\366\324 \354\2563\236*n\275\355\003\333\006\266Y\002\017"
+	.ascii	"3\241\333\037\230\320n8\303\210\246\016\001\213\227J\303\224"
+	.ascii	"\r]\265\032\317U\\\030\351\202\315/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_rxUpdateCheck.108.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`1\0055\037"
+	.string	"f\367\300H\240\230Q:\3004\026@{\216\225\370q\230\327HO\245\355+\006\375#\206\256D\374\222M.e0m\277-\376(,\r\253\330\001\377\2625.\321\032\017p\235\n/\210\211\016Z\200q\344\004\214\373L\227o\033!\204\310\235R\254"
+	.string	"\236"
+	.string	"\264"
+	.string	"\366i\343d\365\254P\005\030&\265\326\035?x\235\304Q\322C\251\375\252\373@\272\325\n\303j\205\252bR\253p\307\007^'k\017P\236\034O+O\332\366\202\006H\336](\265\364\033]>!fj\025\332\326\306w\227\2351\330\313,\311q\351\3167\201\3062^\260\224~I\227\235\367\364\363)&CG\007\323\f\n\323\201jr\372\313\004\202j\002\336\034iNH\266Nd\002\216\t\266v\3108\177>Z\022\231\234\256\\P\022\306\307\363\307\202\356\354\327b\254\325Z\017\344\364\305\257G\251\tTk5U\3725\3356\267=\305\266\007{\004\023$\335\0022,5DZkM\332\r\372\273\362+b\310\205\005=c\177\310\211\354|*\013\221\240W:\351\223(O~e[\200<Z\364\2003\304"
+	.ascii	"?rtqU\212\306\026&\321\r\332\037\353F\331\246\256Q\352\234\017"
+	.ascii	"\357\233[\3754\030\365\214R\333\220\3242S\237/\352\030I\r#\251"
+	.ascii	"_&\265i\352\322"
+	.string	"\244&M=\226\324KR_\347\207\212\306\323\2153\233EX\227\212i\252\025\322\t\216\017\177\3738[=~\020\377\312'N\226\236\017Q\324\222\204u\tD\027a\025\202\223\276\360:y\033)\025\264b\3533e\305+\302\026\013m_\013\333\273\240\321\243\305+8\013A\257\365\231\002\362\320\224U\204\226L\271\3679\351u\215K\005\303(D\211\013\353\346\216\373\253S\240\226\017\n5\261r|WJ\311\221\0323\313\"S\026(\311\345\372Q\2247K\256\251\017\330\243E\313\262\304\020o\366\303\327x\024\215\005P\357\336\354g\324\350m\222\355\r\217\302\341Uk\375\361\237\034J\007\237\352\244=|\370P\236\334\375\231\262\312a5\t\201#\365\253\277\264\242\204!\227\334v\264\0345\251]\\/\362$\006\244\306\314\260\212\304\217\0334m\351\352\206T\214\374\b.\027\024T>EGF7\243\f\271\241\233n\304y3*\221\213"
+	.string	"\300\fn#|~\032\374\370\360\314\2126\344\206\2044\030\231\310\351tG8\033\343xR\350l)t6\023B\267!\033NWd\343\241\231\350DNg3\"\"\322\331Na\375X7\3124\206\340\364L\360\231k[\343m\317\263\255\355}kx\264X\3126\350\177\317\215\222\355\277|\301A\b\222-\017\215m\260\310\317\375\027/\347\316\246\200@\036\233\002\203\b\333\240\035d\225\264U\320\303\314Y\233}a\333\254\277\345\\VH\230\340O(O\032\030_\004\250c\233\263e\214\177\207\023\022-f\2052\2663\036C.\246\360\255q\250AL\t\021\252\241\tZP\222\202j\016\300\002\021!+n\020H\310f\223\244\003E\320"
+	.string	"\370\371\215\277\fZ?Az\013L\204R-U!\312\340\303\205\307\006G,"
+	.ascii	"\026\024\3735\035N\225d\226z\221\243\324qh\251r\345&\202\247"
+	.ascii	"E\023\330K\344L\371\rat\370\005\211Z\n\344\347\202\230@\003\370"
+	.ascii	"\237\3063\200Xz\177\264E=\212t\217P\n\323e\234\333\376e\022-"
+	.ascii	"\021\r\216B\fe\027F\330bM\335G\360\222D~D>\212\001\234\250\367"
+	.ascii	"\234\241\251k\275\207\353\352%\212\356\240\275$s\026@8\006O\225"
+	.ascii	"\3342N\201|IN\216\252L\240\253H\351\246\240\203\205\\W\207\326"
+	.ascii	"DJW\037Z\024y\215\375\221\205sK\3144\272\221\250z=\276L\002\026"
+	.ascii	" \034\326s!\252\265\3266A\251"
+	.text
+	.section	.gnu.lto_calculateNonDataDrivenChannel.109.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\376\004\005 "
+	.string	"F\370\306J\220\330Q:\002\304\030\221\360\222~\212_A\004\r\rH\253'bz\345\345DB(\350\311Ol\260\024-\243?\3535bW5\356\353\367\0162\304J@\002\260)\307\311\315\375\323\f"
+	.string	"B\333\343\244\243\334\361\244\021B\b!r'\031\262"
+	.string	"\246"
+	.string	"\263"
+	.string	"I\353\205\312@\346J\222\236\227\374\303\023e\327\366+\222\305\271LK0|\320\227<\353\256-\363\002\007G_b\304}\357\324\330\224{\327\004l"
+	.ascii	"}y$Or\304Hv\265\212\242]m95Is\357\332\3039\316|i\037\300|\331"
+	.ascii	"<\270O\256\347\323\"=EO\263$\333\"\361\223\236\236\276\nWgf\250"
+	.ascii	"b\3248J\342\034\243\244H\005\326\005\261\311\236Ah\334<}Z?0\306"
+	.ascii	"\365D\244\361r\306I\362\300T\026\0316\"\023\211\373\3221\346"
+	.ascii	"B\242j\330V\211+H\335\275\367\305[\030\304%kO\337\275\227\355"
+	.ascii	"\0231\306\231vf6\302\314@\314\344\226\177z\311\007\321\2700)"
+	.ascii	"%\333\206o\004\222\206L\b\017\220\343\213\307\200\245\214\032"
+	.ascii	"\262k\315\230\327$\333U\314\277\215\033_3\270w0\347\330\362\316"
+	.ascii	"\327_\347K~\334\261\3169l\371\366\254\263-\265|\223Z\256\245"
+	.ascii	"\226U\3252M\265\234\246\226Q\325\362\231Z6i\226\313\3242\331"
+	.ascii	"\226\273-[\324\362\t<(\233\302q%\245\303"
+	.string	"\254\027\252\315\331\355Rv\375x\326\217\365\323\232\266\264%\363s,v|&|-Vs-vM\356\344\350Y\354\245cZ/1\302\230\326\265\200\276\324\221g>\342\027Y\3459\3331c\245\320\005_?\264\213\331\270\260.4\335f\317\237\365\237\034JZ'\207PY\343\231\343\177\246\226\337\r\354\306g\321@\264a\203\371R\200U\031\227{\357\275eW=\310\274R\300\252\254f4. \203\"B\332\033\231\357aQK\315\350u\344\255\027e\236t\220Yv\207\242\030\223]\303\374*\267\022d\002\310\376\t\310|Yv-L\252\n\331\314\\t*?\035fV\361)\034nV\367^\bR\316\005\344\373x\311(\202\301'2\235&\273\334\312\351\356\343\332\266\005\343\304\306\032\225\034s\372X\327)Y3\356\0230\3379\375\246\256%\333\206\371O\016\305\210\357\203\205 lDj\221\320\203\320\204\013'\204\204\303!\212 "
+	.string	"\341\210\022$\200D&3"
+	.ascii	"~h\340\343\300\247\001\317&\004\f\021$9\310+\032\366\212\206"
+	.ascii	"=!\021@\022\275\340\220\250\307\013\300C%\204\303\336\211\241"
+	.ascii	"\241aO]\357{\007\337\256\316\234\270\320\235~\361\024^\210q\342"
+	.ascii	"j\235\276\335\232}J\275\224\336\364N\177\200Y\353\233n2MG\226"
+	.ascii	"\304\374P\261Z\013\350\321U<\315\250\346\210v\025\337\216\230"
+	.ascii	"\271n\261\262\347\266v\221\340\266\226P\026\241\262\265O\311"
+	.ascii	"\232\235<s\375,\004\267u\256\377c<sT\033\354\207\003\013Ck5\355"
+	.ascii	"\263i\335^MSh\247\035\016\346\307\373\302a\347\005m^\217.\263"
+	.ascii	"\317j\250Q,%\025E#3\"#-H\212Y\003`\002!Sv\035\020`X\242$\035"
+	.ascii	"\217\034\303$[\277\373`\242\245\002\367P\255tD\274\f$\246\017"
+	.ascii	"\310$.|\013l)\023\240\017\361i\220A\336\306M\236 \023\307\247"
+	.ascii	"'\2317\317s\256\310\324\221C6\343Fx\363\3258 \005\003D\265I\232"
+	.ascii	"o\332\266Y\307\330c\\2\226l\302\031<\365>\005Bpi\3120N\007\365"
+	.ascii	"l\036g\t\243\357\013\b\371_\242\230\215\275~\241\246\017\rFh"
+	.ascii	"V@M\232\276vp\340\247\243\265\003\266\372\231\205!|\204\317M"
+	.ascii	"\251,\365|V\301#\"\372k\201\025\377xG\311]\224\214\242\202\337"
+	.ascii	"Js\340\327sp#\354i\354B\333\240PpJ\007\320?Eu\206eQ\333\024/"
+	.ascii	"n5Fk\333\372\335\320\n%,\375\255+5"
+	.text
+	.section	.gnu.lto_getRxfailValue.110.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\022\005\215\037"
+	.string	"\366x\307E\200ZN:\377$\233\263\313\t\341\372\025\370\341\353\330\367\232\0170\262\342\207\245\354{\025pEn\213\264&\217\222\203\275q\023\b\214\365C\256\347\031pf\271\027v}]\"-,\341\355_\2500k\t!\322\344N)\257"
+	.string	"\256"
+	.string	"\265"
+	.ascii	"\276\225_q\3613\257e\250A\257\"+4Xg\344j\255\016N\232\303y\222"
+	.ascii	"Hw\337l\252W@\310\300~\231?<\225\251Wy\361\212\305\265\303\221"
+	.ascii	"6\343\255\326a\203\223\2460<\037T\026\360b\260\364S\fA\302\324"
+	.ascii	"\311\244\274\265\n\307t\251u\350\300\b\316\223\266\375(\037\233"
+	.ascii	"2\025\035\022\341\342!9fY\221\253u\350\003p\241\362$}Pyr\207"
+	.ascii	"\234\352\247Y\222\272\245T~\325\317\236\230\0233)\rI\371\340"
+	.ascii	"\327\311\227\235C\032\0178 ^_\327\305"
+	.string	"\270\332,\253R(l\315\b\257\013k\251\211Tk5\325\352\362\272w\267\255\3036\320&\315v\340\270\354\274\005\237\326D\337\264\321z\026\033\306\271(m\020\233\261,\311X\255u\202\226oY\362\217\234\364\t \275\326I\037X\236t\n7\235`^\t\304\212\017\234\304\004,\007\020,\017\220\347\f\212\215's\276G;Q\220\336qo\277f\\\326\\\220\036\375\262\363\2108\332*\275c\017\255\350\n\261\277\307\3431\316\033\30465\220\251\177L\355s\262\277gj\236I\2753\251\317\222\332<\251K\223zKj\272\324\0070D\207-\352\254\326\033G<\265H\252\211\331\305\315|,@l\314\344lO\021]\rk\227\2078rc\rN\022\311\241\005?\312\001\324\356\360\201^kw\267\312\275\225\2422\254\212\264\355=\304&E\022\304\333\2048\3755g#b\004\t\022\345\311\237=P\204\354[D&\304\033\251\212\346\231"
+	.ascii	"\347\206\246s\363\325\354\245z\244y\361l6\232g_RR\345\311_\330"
+	.ascii	"[\035\235s\017\321\207\230\017}\025\253h\236\207\255\205\201"
+	.ascii	"Y3\376\031*\246\244\202\215\361\311\330x\336@y\322T\253\336\250"
+	.ascii	"\241\244\326\272\340al\033\315\265\257Z\253.\364\224m\244Z\265"
+	.ascii	"\326a]\320\003\273\242s\266K\034\314O\303\330\021\341X\255WG"
+	.ascii	"_\274\\\355\305*pC\026\244GS\342\216\266,\177\225\023\241\375"
+	.ascii	"e\357\005F\021\265d\302\tX\242<\001drz\252\260\304\364c\241\002"
+	.ascii	"\370\273 \344\b?&\243#\tGFE?*\226\234\234~(\224L+\025EA\371\242"
+	.ascii	"\240|N\300_\223O\t\212\205\257(\310O+\226\240|-\236\236\240|"
+	.ascii	"\275a\360\272\272A\374'q\304\022\250I\235-\323g\255#w_\366\235"
+	.ascii	"\2359B\335\317\362\226\206m\336\032)\270V\272Zk=I\343\251\312"
+	.ascii	"\335\372\354\261\204\004NU\236\273\333c-\261\242G\233{.\205c"
+	.ascii	"\341r~@)E\2707s\215\334\220\365\020\341\312\234\022\323\230\345"
+	.ascii	"\002\355\263\346l\304p\372o\016GC\322\206\r\345\311r\005\024"
+	.ascii	"Q\013\322\243\207\312\264\325\265\337\355l+_\250!<\343\224dH"
+	.ascii	"H\246\222\024\026\024j\f\200\"\2512\343\001\021\2009\224J\n\n"
+	.ascii	"\f\303\030\227k\252\203\022\326\371\321\236\321K.gC@,\267\201"
+	.ascii	"\217\340\244\325\272L`\316\016\360w\2602g\314?\223\321f\020 "
+	.ascii	"|!\355\263\037\302\311\300]\034\321<6\025\232\037'Bk*p! \361"
+	.ascii	"%D\214\340\333\260\004\302I\222\032LF\020M\007\214z\261\0234"
+	.ascii	"\304\310\235y\205\214\004\330)K\366\366#\001y[E\366)\026\341"
+	.ascii	"M$\302\321\371Uk\242\307\340\035\246\036\217\3004\210\t\273\276"
+	.ascii	"\315}\211\224\030+\236\220\254Q\221s5\243\376\007\242H\004\""
+	.ascii	"\027X|\366\3058tA\032\"\r\006\365\331hs\3329\177@\023\376\bq"
+	.ascii	"t\362F\007{\335\036\250"
+	.text
+	.section	.gnu.lto_applyRxChannelRangeConfiguraton.111.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\274\001\265\020"
+	.string	"v\240qF\340\360&\035\003\277~`}\203\361a\211\240\027#=\323\"\206\227\260\214} &\253I\273S\202\274d\232\366,[_\226\364f\2778\354\2031\306X\006aH\030\r@\007\004\325\007\b\353<\246M\323\255\221\275\245L)\\"
+	.string	"V"
+	.string	"\\"
+	.string	"\260\177>\262j\327\003\f\243\335-1\201\324\343\b\264\355\377\034\b\346X~ (p\370"
+	.ascii	"\321l7v?\357\343\001\270\307<\b\367\250\037\036;\324\214\371"
+	.ascii	"6\207*N6rj\026\256P\204\207\303\022\253v\003GP \321n{\352\324"
+	.ascii	"f\231\250\225\335u\346\324*\334\361\266\023\330F`gIM\366g\223"
+	.ascii	"\332c\037\256\362\330N\2632\335\221\351\325\277\273\373\320\257"
+	.ascii	"\372\367\243\234\216\231\2060\255\231N\230\276\207\310\206\025"
+	.ascii	"\021b\354N\2709-R<\341c\033fwv\210\f\022-q!\330\207j\004|\354"
+	.ascii	"L\350\307h\367+\261J\352\321_*\204\005I\246\375\240\223\bI\253"
+	.ascii	"\377>\"\313&w\351a\204rq\037q\251PQj;x\311\347t\n\027\203\332"
+	.ascii	"X\025\272^\244Z\340\232z\032\264'[\346D3\251\335Y\212o\302\005"
+	.ascii	"Bjw/\342\321\257\341\036\257(!\202dys\252\270p\246\235\033\221"
+	.ascii	"j\217\r\034\245\n\204^\314\222\311\267\235#\305-i3-\f`Z\257\350"
+	.ascii	"\003\255\005')()'&\254\026\227\230\227\326\fg\026\023\232\227"
+	.ascii	"G\363\362`\032\264^<\226\327\214g\002bWL\313\313{\340r\275\274"
+	.ascii	"\356\333+\217e\226\224lW\355,IH?\306E\325\261\035\325+2\275\201"
+	.ascii	"+e\351[\320\236d\032Vj;\034\321\001@Q\207\256\324\2113#*u\332"
+	.ascii	"\241\003\216pj\334d\b  \200\002!i\241\007\200F\221Yhf\003\031"
+	.ascii	"FGV\330\267\363\222\253\377\341\223M\347\r+\343\225\3414;\230"
+	.ascii	"\366P\334o\\N<`i\330\207K(*W\224\004\354O4 \0221Z\240\216\361"
+	.ascii	"\211\274\333\227\013\250\013\245\032h.\b\005"
+	.text
+	.section	.gnu.lto_readRxChannelsApplyRanges.113.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`_\t\2755"
+	.ascii	"\232[\034\024DP\346Q\007\033\276F\375>\230\252\207\243\t-,\312"
+	.ascii	"4\224\277)\257\211\274\361\"\210\315\223\345\243i\2656\322\262"
+	.ascii	"\270\367\360+\037\264\3664=Q\244\022\250\016\354\357\201\bS\035"
+	.ascii	"\034>`\355n\262\367\336[\312\224\002)\001&\0011\001\306\375U"
+	.ascii	"`b?N\270\277\032e\246\375\363W\372\243y\325\231;\323\f\205p\321"
+	.ascii	"P\271\303f\236\351\337t\330\343_\272\363x\245\267w\016-\177o"
+	.ascii	"\346\311\370\23311\177\356o\346\022*\360\3702Cwci\317\302\334"
+	.ascii	"\342\366Vjp\177\365'\303\303\035\376U\177\231\303K\202~?\346"
+	.ascii	"\307\342'\353\341Vq\271\315?\205\342\366\336M\277z\002\367W\337"
+	.ascii	"'\261\277\252\037\200\375\325cw?\257\004\333m\230\264\270\234"
+	.ascii	"\333{\377\264\024?zU\371\316\313\361\367x\360\273s[vUu\216\375"
+	.ascii	"\313>A\227\032\253;g\307\252\357\251-\326\326\225\217r-Q/\320"
+	.ascii	"\305\251=Z1\363\242 \225<\214\340\013\231\344_U\302\326\220?"
+	.ascii	"\037\345J\242\366\342\370\034_\rI\336\345\23037F\372\205<\362"
+	.ascii	"\256\332\200\t\033\221\217r\035Q\223\352<\341\363p\217 \013W"
+	.ascii	"Wn\333\rh\277\206\031\002\364\205T\362l\221_\337c\221W\211\216"
+	.ascii	"X\360\361*\353\346g!\307,\325\267\367\376\345g\255\243U\316\355"
+	.ascii	"\206\275\267g\343\021\371N\364\356\257\272\273\025w\367+1\314"
+	.ascii	"\362\\e:\367\277\363x\206\376U\034\0060\277\021\310\376j\244"
+	.ascii	"yy\272\210y\352\007\302,\377}zy\"^Z\336\362\223Pt\347B\356J\253"
+	.ascii	"\254\223\356\177\001\214.\3165\024w\242\354\004\336\354Lo\366"
+	.ascii	"\245]\366\001\275\354Jov\001o\366$\244\2437\273Q\321\233\275"
+	.ascii	"\367\314w\336\223\275\303\237\366\336\376\331;\313\313\276\266"
+	.ascii	"\331\3256\273\206\263\3477\373\037\210\261\245N\274\266\367\326"
+	.ascii	"\324\320\206\256ja\317\374O\373?\373'{\1779\017\027t\373:og\327"
+	.ascii	"\234~y\213\262y\213\266]\274\334_\241\317\241\257J\271\267\314"
+	.ascii	"@]B\205\340?\207\257\334[l\2307\272\361\263E\251\273K\271\221"
+	.ascii	"\006\276\374v\371\333\374\347<\235\340\263E\rPn\344\313\315\201"
+	.ascii	"\216\231\333[\031+\335\017\300\312\t\272\303\277\346\016;\325"
+	.ascii	"\273\361\207\343\242\213\351\036\373\256\224\373\210azf\314\234"
+	.ascii	"\217\316\257\315\357\244\3727\356\374\260\211H\006o|\212]\036"
+	.ascii	"\374\3523\202\374\374\323\370\263y5!m\246\320\376\324\261p\177"
+	.ascii	"eB\242\346\327\304\237\246\343wiO\325\304@\326\372\335d\037*"
+	.ascii	",\340\331\233\370\306b\326E\332\207\245\253\234Ik\255\333\334"
+	.ascii	"C\306\002\221\257\362\237\211\016\211"
+	.string	"2\351o\363\326\366\257\366\257\330\024*\215#\356t2\023IL}\024\373\353\222~-$\304<u%\355yO\007\350\317\332b\225\247\316j%\255\235\305:8\317GB\250\013\217\333\276;YV\3070k\203\373\027N[\324\316\357\234pQJ\003m\375o\357\033\334\037\262\017}\237\177!\021\371\215\036\341\351F|\333\263bMX\375Z\205+\326\251\035\322\3155\254c\333\224\241\t\021\355U._RX?\331\373\004hX\377\241b\235\227\375{y\021\202\316\t\320DS\332X\336 \005S\272\234\253N\nR\227F9\242g\033\"#\0236U'=I\363\264\320\314\355*\323\225x\271\241\273\367v\362\217{@&P\250P\301\376\232\244\037L\341=\313x\372\231\357#\346B\256\376\220\355i\236\316j\262\230X-}\305\367\231r\367\276r\362\337\363|X\370W\371\325[\274x\301\376\332\323\016\362\220}\363\037\310s\254"
+	.string	"\221\261/\372\207\254\221\0168\200QP'\202)\206\302\034R\035\220p"
+	.string	"G\274^c\007\324\f)\0330X*\240\360\205\272\201#\n8\305\266SO;\200Q\260O"
+	.string	"\322\240\340T\301\211\002\004\242\034R:\202O7\240\244\244\2005d\360\\\006\204\035\302\337\016\341O\312\0060\352'C8\365\203\020\300\2038\240\204\277\034\301\240\360\007+\211\257\241\270\217(\027(Q[\365t\322\213\250\300HZ\353a\233\236\2055\253\237\330\2562]\362)\215\236\275\272\367\336<\235t\245\254\243\333{\244\2270\217LvE\272\325Z\356H\372\317\034<\253\221\364\377\230\227t\325\216\214\255\024y\346\312\3078\314\277\212X\254%\326\302\376\372F\271V\257Z/\001\234\211\212E[\375i\031\326I\375i\0132\001\255j\367\330K\f&\277\361\250H\253\372\235o$\353\310F\032G\\\313Ab1\331\r\314(\314@\342\261<\005\333{_0f\255\270\214\303\323\023\373+\001\335\004g,\262\366!\350|\301y"
+	.string	"\202\232q\204\364\t\264\235B\230G6R9\217\3569~\275:\351\237\207K\235\273\244\037\356\233\300\024\233\355k&\255\365\340Y-<R\244?\200\315\250q(\345\224C\b\r\211\0042\223$i\f`\002\031);\333\020P\250H\222$\255\001\210a\336\363\356\375!\301\223\306\241\273:(\372\274\rS\301\330\007\263\206\311\336\333\256\017\347\264Pe\216\312S\350\2110\223\226C\030\321\250B\212\200b\246\3203\321i\2146\030#M\007\270\234\217\004T\326CG\235\b!\275 \034]\005}\212\221\202\367v\224\317\357\004fY\233OR/C\275\326u]]\364J\f\210*\314\270\202i\207\210\254\245\202#w\343\006\261\272\206\307\033\311%b(\304\356\020\036\314[\020\365;H\271\020L2,\240\277\251\331\211R\322\216\200X~\350\244\026a\f!\214U"
+	.string	"F\274"
+	.ascii	"\311\273\370a4N;|\200`!r?\001\231n+\230\357\322\242\250\n\370"
+	.ascii	"\226\025\340\177\037\335\032\021\261\205LApl\023\365\206\325"
+	.ascii	"c6\b\307\357\347;\340Ss\353f\0303\013eiT\310\247\303\343\362"
+	.ascii	"\3459-\322\244\375b\223\fa,=`^`)\"\205\340\330\241\035\372K["
+	.ascii	"=e_\243\222\t\0036bx\r\237\267\326\233\333\271\323\357\2560\354"
+	.ascii	"\263v@.\352\374\222qXN%\310\ft\020/;\006Rs\336z\317pWL^\\p\272"
+	.ascii	"A\300\301W?\"\201\353\306)H\327T\331\001\256\215o\344_\256\234"
+	.ascii	"K\235\232\266yoB\367\262\027\264\252\024\260zT\262T\377\025?"
+	.ascii	"\223\261^R\004\335\016\346\r|j%\275=~\305\017\233\277\343\030"
+	.ascii	"\rAJaO\225\021\327_|\264\247\202\314\230??\330B \333\260\300"
+	.ascii	"\023\373\371^\251\001"
+	.text
+	.section	.gnu.lto_detectAndApplySignalLossBehaviour.114.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\303\025\275f"
+	.string	"J\242H$N \222\322\031\0164\306\224=\273(05\2508}\222\302\230\355!\210\317\373\306\270\016\237\267\343\301\0353\332\300\370\343w@l0w\027\201-\001\007.\204@\314g\301+C\261\343M\324o\374\223\302\311\314b\346q\024\025=D\204\354-e\222\0010\002\006\002/\002\316\225\353r_\336\320\376\256\022\201I\332\333\260\317\341h\326y\035~\247<\036T\022\313\2716u\326\230\350\2050\274\212d\242\031p\260\022^a\362\2075\264\303`\267\206\327\355\317lq\225\247\233\272\rk\244\267\256+\227\244\275\333~\216H\0053;'\\cR\267v0\274*\242-\3515\274\314^N\204[\322\356\345\266"
+	.string	"\245\251\323 \325@\034h\221a\231)2\207\323\340nK\274b\203CF\0031\037Su\267\025\342\206EL\325\356\337v\213{\344n+\244!\314\2320\264\253\3730Gv\213W\205\207\341ko\333\"\021\223\315*y\345\\\271\202W\226@\321\376(\030!\251"
+	.string	"%\345c\340\340\253\326\212\004NY\025h\220\341U\"\261\244]\247\007\311$\316\265\253\230\305t\242\375\255\253s\305\325\2451\034\222\223t\336=\332\323\224W\373`\211\353*\366Wf]\235\003,\212\341\325\344\201\202W\323\377\004\257\256r\227\315\220\222\365\312E\331\224e\333\337\272\256H\235\005\305\372<u~\207Z\371##\025)\212P\234H\232(Ab\004"
+	.string	"\"\210\206\204\202\200B\374\370\364 y\216;\306\242\016q(\f\252i\263r/\\J\257\200\3351\273\256~\024\007\225\201\215T\300=\005\231\031\270\310\017.MF\3070\212\022\274\304\374\204p\t\372\242\257:\26431/1O\006\257pA\343n\002\f\227xkSc\022\251P\t\027\227?\233i)\002o\240r\237\373\342\021"
+	.string	"\240]\304\013_\230(M\236A\243;\343\241\022\274\274\\(\250\313\201\314\232\\P\340\020?\274\345>&\274\307\004=-\214\334r\236\024\210\213\013\363\317&Y*"
+	.string	"\224\006 n\326\254\302\307\023\236\3150\3369!\346E\345F\263&\025.Na#\205u\204Kb^QN|6\243\244I4?a\326\004\343\241pi\356\352\025&uh\200b^^.\204\362\340R\213\325b\227\222&]Z\234\212\360>v%I\223\353\272\276\355\274\325\225\305,\\Z\327u\231\331\345\365\r\340\273\274fw\263\354\376\244\b\327\201{2\364s\323\004\354[\333\256\343\006\326\004\214\002\365\022\226\260\307\316v\r\254`q\240\033\001\302p\020!\2306\323rG\332$\366\256\366\330\233\267\222n\343\336W"
+	.string	"\317\273g\312\234\265\203\257xp\2278\363\3549>\316\214\356\341<\216\325~\313\002\021\302g\n\t^}\223\320\362\205\305s\366oO\272\347\b\021\322\274\364Z\005\217\272\202\265\036\222\360\233\r\3409W\324w>)\324\373\007A\024]\324\234F\353K\026\317\331\340\223\365/\032\247L\301J\345\202\027\365\030\376\266\037\213\226\023( 4\210\327y\365\246\340\036\016\202\b\370\314\243\226a%I_\355\341\256CW\366\\9p\350\346\f\017\260ous\002\375\255\202g{7\001S\300\342\300e-'z\200\321\225\003w\235Y\334c\273G\200\354\rt\033\313\256\221\267\t\311+\004\311\033\344}_ H\336\037H^\037)o\017$/\017$/\003H\336\035\257\373\352@\362\346@\362\342@\362\336@\362\332@\3622\371\360.\340\303[\303\310\273\224\362\322Hyg\244\2742\214\2741zx\025\350\341M"
+	.string	"\206\222\213\"o\022R\312{d\3445\272\363[t\265\037\205\2217Y\344%z\233\357\320\361\276B7\363\r:\333\027\310\310\033\342\310\373\323\303\353\303\303\333\303\303\2134\362\362\034y\217=\274;F^\343\221\267\310\303\253\203\344%\036y\207<\274\302\2247x\344US\3364\345\355\224\227S\336O@\244\005\256&]_\322f]\271\346\300Y\361T\271.\357\373\353\3766?\336o\346w\376l\027\356\276o\357\027u\263,n\200\332\351\254}\365p6O|B\022\334\320\326\370`\267\346\351>@\261sm\036\355\254L\224\036\236\354\256\207\301\237\373\035\316\203\332\345\366\027\206\246&\215\225\232\2324V_\341\313\333"
+	.string	"\"\f\257\346\231\221Z\202W\302,\311\310\317\333\002\2240\270\031\251\007|\346\216\022\243^6v\307\271{\256\037\241\013\020O\202\212'(\323\200\364L\020\352b7\337R\016V\236\335\223\313\2624\211\003d\267\214\343Q\352\377\0205\t-):\370\270h\241\336:j\252\236\267\2743O\241>^\336\361\26080\204N\2235\245 \313\242\3161\243[\336\024,j\235\026\362i\205eQi\376\364\230\317\215\306b\243\231\372F_\357\304\345\327\002m\243\227\227r\304\230\232\370U\243\027\350/\243,u\215N\333\226r\232\232\305\227:\215\243\005\307\bg\367T1&N[\017\215\031\035l\032\315|\313\257\276T\220\3303\232\311,\277d\351\335\201\037R"
+	.string	"\214\362\360\241\337\017M\300>5g\016\\b?/\355\351\242\0057\365\256rL\231\205\317t\321Gs\016\352\246^fF\203\232\330=\267\224\363\302\216\201\022\310D*\355\260\225\272\333\302\250(\2650\r;\205\026~\313s\341\371\257\032\302\250\361\364\330\026\265\260/\266\246C\022~#\245\t\214\243(O@A\331\245K\360\252\260\017\330\223k\342&\305\312\321\270\342gs\t\262LY\306\025Y<F\214\246\222\321\301>\3372J\236\nO\031}\034NE\013\f\n\b\215\3212\372K9;=\266<\207\346\n\237\261\261\254\002M\324RS\372\326r(c(#(\320gs\256\233\342\027\226\246V\354\261\345\341\036*x4'\222\225\221Y\306\021\223\232\250\267\022h\242\356\026\326\356\330\254R\005v\242da\270\256I^,w\261\227\322\005\345\231\362\005\345\013\301\253\t\364\321\236\032\233\353\300\235=W\276\023\361\372\254"
+	.string	"\366\255\371.\031\265\300\376"
+	.string	"\243D}\274TG\355\244\346\271\245\034,\236\323"
+	.ascii	"s)\323\206\353\272\"\260\034\0027Q\202\331o\271\2725\230\230"
+	.ascii	"\202W\325V\332\223{\236\0171\310@\004\352\233p4?\0237\2602\035"
+	.ascii	"\206N\211\327\260\307\366xe^\226q\301\277\031\356P\026\266\214"
+	.ascii	"S\377\303\201zkw\205\f+XsOY\020K\0010\312s\251\340\362\022fJ"
+	.ascii	"\335\310\221#x\265\004\231\337\230E\246\240\2148Q\035\261\221"
+	.ascii	"\301\216\372\024\225\201\224SU\360\251*\352H\020\013\240\242"
+	.ascii	"\2346\320\031\"\254\212z*R\304\351\002&$NRE$\rHMQ\341x:\022\345"
+	.ascii	"\364\300S\325\221c\221\247\r\240\250l8\031q\262Q\265\003\t\325"
+	.ascii	"\021**\n\312\007r\rp\"\342\342\205\322\013\027-\216UMORP\016"
+	.ascii	"\030)\362DEud\310\316\016i\201\204\n\t\t\025R\021(')\244!TUH"
+	.ascii	"-~v*\203'*$#SSTHE'\326\033\313\202\240\306\005<\254\316:\032"
+	.ascii	"\352\020\315jB:\004\364\337\342V\206FHT\215\021\220;\025Ar\330"
+	.ascii	"\2743`\316\244\b\322@\242v7\004\001\322\357{\262\205\377h \321"
+	.ascii	":\272\037~\017c6\307\254\350\206\023H}\350\211d*l-\343\222+>"
+	.ascii	"\324[lv\037s>\242n\324*C\3756\335$\215\2344(\220\372m\206\032"
+	.ascii	"iHO\r\224\347\317\017\256A\316\247\177Zp\322"
+	.string	"\247\347\fu\362zj\300\372\tD\020VN\254h\262\202\005}\232&Fd\204+\243[Y\023\256\3230\243\377\3413\320 \363#\322\\\321f\331\226\234\301\273J%\312%\237\271\311\254\267\2748O\343Y\337\t&\336\024\354i.am/\331\024DvO\177\371\345\306a\232\226(\267\266\202W\221-c\357K\205\016\353\n%z\344\005\366h6\253\020\204"
+	.string	"\361\025g\215\0071[\347\321=\372K\271\030x\264\321u\340\252\2049\021\317M\031\300\276*$zl\203\232\247\231\013\003\315\263s\177\tP'\003}\314!\035\241C-\205\226\2579"
+	.string	"z\f\255\215\031=\336\321\360\274\210\036\333\035\255\243\251\270\370\213\324\213e/|\246\354r\242|\362$xuG\017\240E\r\353\016\314SG\277.\275T0G\353h&\243\025\226E\267J(\314\202\022l\205\034\315bO\r\353\314\207i\002\361"
+	.ascii	"\243L\324cK@\024!\030\375\271\017\377\312\306,\343\204+\036\324"
+	.ascii	"[RA\034]\301\332^\231RJ\016\034&\276\320]\347\316\205\247\r'"
+	.ascii	"\222\020\330\004\354\203\"\026\3247\363"
+	.string	"t]\327u\bF\337\314\223,\036\3240\372=l,t\354\302\245\371\230\321\235>\022\300\3066\252\242$!\201\363\250\201(&\231BfFDDD\222$I\007Q\005\304 \346\240\264n\021\020\261SN\315\214$IJ\331\347\206\030\253W\"\037\225\357\020d\320\257!\231\372qxg9\327\235\304\f*\205!\344\0161\321e>\312\213]\351\355\241h7\325\333\243-`w\336\022\t\310\313\007G\031\020Du\220\243I\314?AV'\326\240\305R\374\236\216rU\315\021\240\363\033\377k7 g\034\3238\b\345\250/\344\277n\356\215&\340\320{3\232\310)S\260\245\2419a\352\367T\324\213\250 \276\253\364\350\366\365\312\001\357\315o\016\270\260\020}\247'\200\357\345\213d\311\352\250\266\b\216n\030\030P|\357\313%O\325-\n\200\337\036\200\017\352\236\323\216{\270\310\261j\3255^\377\021\350q\305\362T\371\202'"
+	.string	"\221\211\374\301\r8~\206\023\307]\r^\345:^|\004\335\212=P\335\305{\207\200\332\377\374\320\223\363\235\220\364\361R\277.\251}\217\233\331\002VB\037d@\274\324\305\213i\023g1,\230\027\236&Toj\277\n\312\271\033\310\005\311\266\021o\267\201\357v2\ba\346n\346\"\337\300R\353\301T\314\227\200\222c\004d\376Az\026U+\336N\003\202\266\214d\033\035\277\361\264\223\302\257\024\356cCz\022\370r\335\020\364)\374\002H\336\311\237\\\301\344\2101&\007;<\230\377\214X(D\031G\307\002\326\202\314\267\240\361\3277\247\023@^\311\005\301\314\360\223\035]'p\320\256\270\r\3044F\260\267\314\b\374\2051\276\031\226\333\307\326\203\276\260J\340,\030\312\333\r\223\\\f\270w\336\262\304]\"o\245*\031\233H\200\202\301\207\271\004\211\031\222\330"
+	.string	"#\314\271b\275\"\3663\243\305\302A\245\304\207\0204\t\333t9\210a`\347f^W\270\262R\371m\013=:\272\300\201\030i\305-1\004\364\277\004\022'\276\230C\031\323\361S\302\274=\244uz=o\305\361h\335t\201\241\331\007\213\003\3755\350\251\265\032Z\320\273\226\326\273+\001\255\365\304\340\244k\333\b\325g\200\213\307>\264m\211\345\213\030\313\325p\247\223\257\216\016\025\2661=\375$\240\274"
+	.ascii	"q\013K\244(\351\317%9p\335\360\351\307J\224\300\203\250\307f"
+	.ascii	"\362\276P\230P\b\367rW%ErS\2418\223v\220c\360\"\305.op\260\314"
+	.ascii	"\3769\317\250\357\311"
+	.string	"=:\364\256\032\273l\031Lr&Td\037\307H\201\300CH\320F\342\003\336\221\351\266\307\210<mAd|\007V\007\215t\3438\021\025d\254\324DbH\302\337Sy\360\254_W\326\367\006\257\340\307\254DJ@v\357}\310G\235\367^\342\373l\025\273B\300\352\203\301n5YV\314\324\3642\333\321\246\250\264\026\207A\355K\214\263\343\350gx\321v\007@\222\003\342\023\205&\237J\f\205ys\355U\334n\246\022^x\036{\314\003\316\\\301\232\323\330\205\330/\330=\373\240\245\033\260\f\2701Zh\240'\242\034\001\265s\226\220dz1h\230\321I\206\013E\215\301y\267\333S\335\322\220F\221$c\216\345H\241S\204\022\247\300\354z]\026\236\254\360\377.\\b\231\245\346\273\230l\177\264\204\273\266Q\2073o\307\017\267Z\347\304\255\215\177`\217\324\304q\306tn\255*!\310\264\326\345\2122\\\275\341\323"
+	.string	"H\016\347\226yyE\030+/J\303\001"
+	.ascii	"\236Z\223?Q\031G\201\037\007r\030\020O\236\\\036\212\030\364"
+	.ascii	",:\355\301\313\307||<\356h\245\347\032\3237Y\333o\317\210%\005"
+	.ascii	"\331\270\203\n"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.115.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\250\001\025\020"
+	.string	"6]iG\360\260(\035\360g\035j\370>[\346:\324\322L\373v\340\036\254\021\343\234\377\035\324\274\377\276P\207@\303`\277\216\264\347\r\023\254\023\351\352\031\031;\233\320\365\3624l\3404\300\301+\261\360\324\352\023E\032\331D\312\224\002U"
+	.string	"L"
+	.string	"W"
+	.string	"-\373\306e6\013\"B\303\313\f\307\356z\n\342\255\207\270\270i\266\374"
+	.string	"\241\353\241\016\346\334cg\360!\003\020\030\302<^\370F\n[\266\322\356\212B\226\324\215"
+	.ascii	"\315\206\034\244\320e+\271\340yy\354I!\204e\206Fv\327\t\206\026"
+	.ascii	"\356\356\266Y\266\027\330\257\021\226\271Rk\354o\273\273V\032"
+	.ascii	"\3738\177\247\351\230i\325tf\372\243\221\317Mx\f@\273\025j;\226"
+	.ascii	"'\256\ba\373\366e-[d\203\320\020<\037\363I\274D\3538+\006\260"
+	.ascii	"\353\301\206\212]\331\001\027\350\036K\027\300=n\377\340\036"
+	.ascii	"\035Z\343NU\277\234\027($\250\016\350\211\321\241\261\310\226"
+	.ascii	"\030;B\255\342R\037\344\320`\311 \373\263\237P\255LLt\324\023"
+	.ascii	"\363\312\232\r\320v\256\276\211\347\260\374\033\243\244\344\301"
+	.ascii	"G?\205{\314\031\370\363\222\341\360\025\256\323\3536s\231\201"
+	.ascii	"e\315\217\3756\264\230\214M\035\016N@\002!DD\201H\210\211\304"
+	.ascii	"r\200R\245\032\234\224\240\276\017\345\344\341\223I\345\363T"
+	.ascii	">\257$E\242\362N\037\3133}x5\001\365y'\253\325\347\211d\373m"
+	.ascii	"\225\306#/\205\205<\262S;B*\017zS\327\203:\324t8\0301j\212\203"
+	.ascii	"?\265\250\272\3432\003\233Ak\361\227\317\312l\001' \220\002\031"
+	.ascii	"\242\264\003\277E\221\036\017A\302M\310\315 YV\330*\002\235c"
+	.ascii	"=\220B\362\032\b*\260\204\264\321m\246\345\262\237\311\016\341"
+	.ascii	"\342\004\023G\020\307e\356\363\346\257\243 b!\346\214u@'k\331"
+	.ascii	"T\320\316\250]$\266\301\030\260\275[h\211!\bn\272Y\243w=("
+	.text
+	.section	.gnu.lto_parseRcChannels.116.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`@\003m\030"
+	.string	"\266l\234H\260XQ:\220\244%\216\277\027\305=.\235I\032\354\240\233\032\206\255G\341\214\027\304:\023\217\225\n:\254\273\325;\315\r\030\327\252\320I\335\242\376\223\366\203\316}\347\270&\207\003\2753\007\371O\265g\027\215\221\2667\221;\245\211"
+	.string	"\200"
+	.string	"\207"
+	.string	"6~cv\234\316\007\324*\224$\244\326\034\003#"
+	.ascii	"?\235{\001\372\t\336\205~zfGy\216\250\256\212px\330Q\245\326"
+	.ascii	"\332\332\026F\311\331A\024\235\337\312\231\237\343\037\213\240"
+	.ascii	"\247\333\270s\360C\331@\274\270R\210\022\237\214S\023\221\037"
+	.ascii	"\325$\n@\f\240S\022\237/\265\326p\264\311\357s1\341\243\211j"
+	.ascii	"\354\371\0264):\361\335\245\317\310#\367G\237,\202\202\334F\240"
+	.ascii	"K\324L\255\325\3626\212\270"
+	.string	"S\267\215\3026\215\275\023\002V\374\243\1772V\260z?JUZ\261s;r\207\354\313\0209E\361\n\331\252\347\376\226#\335\341q\177\352\272\233R\3519\245\277Oz?i\271\322\017\3202\345\311\370\240]\255 \236\256T&\223\b\214#\375\272\025\217\345\357\360w\016W<\220\214\212\222$\334`\371:\374#\207\237+\034\313\326\351\b\250J\365#\215\"\036M\265\346\024|z\006\374|h\257b\260d\216\003\224\b\340\347j\210ui?\3637)r\277\245K|#0\260\310\356\246\226\256\\\212\245gFm\251g\342)p5\214\346\016\361>\004\266 \310\205\030X2\024\372\031n\007\235\022\036\351t\211\273B\305\311w\035\032\256\250c\342\221N>\257\007\244\024\356\221\236\323\"\277\347\335\007,\001Q\255=\277\371I\357\361\372\356\342\323\027`\364\267O\037\026\313 \177\013\367\305\266;\236\373\335\037\036\262\320\344\223\277\373"
+	.ascii	"^o\304\356\220\330\306uj\257{\215\n\232\f9w\335\302\353\006'"
+	.ascii	"F#\023A;\260\271y\020\003!\346\001\214J\303\006\f8\257i\027\214"
+	.ascii	"Ll\311\304\026\316\313\006\326r\2119-\030\027\3070T\020[\032"
+	.ascii	"b1\261\025\346\352W(\307\377\241\227\202\tmkM\340\0169\305DU"
+	.ascii	";\231\244O\r\235K\343\003\021k\300\271\3679\361\263\202\356\f"
+	.ascii	"MZ\371Wk\255(\325K\203\323U\355{\214j\362\211@S\357G\376\320"
+	.ascii	"om\313\236\204\302\001\242Z\253\214ms$.\260\326\032s\344\246"
+	.ascii	"\202\201%\027\034\350\003C\250a \007\ttF\002\031\031\231\221"
+	.ascii	"\002\267pp\002\031\032;\017\020pH\032u\1770\356\277'7R\247@\327"
+	.ascii	"}\3130J\312Q\261\016\341\370\033\352\001\300\376\244\266\214"
+	.ascii	"\305%\301\003x\323K\353\250Y\350h\322Io}\364\241\370\214\330"
+	.ascii	"\364\303\205\2322\236E\261\201\004\207\310d\230U\275\"\340\354"
+	.ascii	"\200\021\210m\313\004\2425\373\377\264\007\177\204\341\310\031"
+	.ascii	"\"\027\355\300i\235\004\026Y\017\241[\344\254\340\t]\003 \324"
+	.ascii	"7\200X\352+$Zs\352Y\006\002\220$\206\355e\222\311\277?"
+	.text
+	.section	.gnu.lto_rxSetLinkRssi.119.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"\235\013"
+	.string	"\366\026SB o\233\016\303 \001@c\256\222\006\304\225\003\006\243\3246;\241K\301\024\033\214@\035\233`{\033\t\265\2214E\241\323\355K\234\346\225"
+	.string	"\200\b\312\370\355*\261y!\2010M\034\232\376!K\233H\231R@"
+	.string	">"
+	.string	"?"
+	.string	"\321\233\355\342\241\310\022\020\201\302\343\004\214\335\275\324\303\267S\232\233\177\360"
+	.string	"\274\257\343\224\265\341J!PI\361\002\363u\224\346\343\203w\360\211\341+eZ<\273\353\364>\rw\274m\007\266\033\330?\020\nb\337\364W\231VM\247%\300\210\f\337GZ\354~\234d\354IT\001\302\366\355\207\233}\261\007\254H\220y\320'q\222\355\246\013\216\273\035HLvC\005.`=\n\270\246z\314g\252\007\3511\203\313\323/\262\242b\242\032\342kT\251\020JP\272\\\261\215\275D\303\332\355:~\211\233\320\374\221G[\330\310{\217\376\206jPL\\\236l \205\003\213\315\030vXJ\r\261O\355\356:^\360\221\300\3510\350p6\230\220\246=\020\221B\023,\2036\034\331\305\221]\244\320gt\2012\355\332d\214Q\210\220]\0250,\273.!w\005\261\225\022\342\204\323\022uIU[4\312{>xO\247\035\256T\325\001\r"
+	.ascii	"\222\031efh<\223\025\fVx{!\265\237\025\353tgR\002L\260\251\313"
+	.ascii	"Dq\347b\266C\003SP"
+	.text
+	.section	.gnu.lto_updateRSSI.120.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`6\005=!"
+	.string	"\326\273\322F\200\234Nc\237\003=\243z\223\201b\330?\340e\200\021\2206McDf\307_b8\261N\334%\367\352)\247\333\332\236\321d|\306TS\251\372M(\024%L+\230\200F\026)i\241\244\031\004\313\366\336{K\231R\264"
+	.string	"\267"
+	.string	"\307"
+	.string	"G\177\314B\247\033m\213N\342\254\270\356\275:1'?,\210\305\220\3750\037\311\301\234\236\004\212\227\032\257\213\363\312\006\024.\004/\035\001}\251S\177$\312\326\275\274o\024\332:\033@\330\320\353\277|\256w\t\357e\3025\367\3420rv\2571\201\t\240/y\3771_\222\3571_Zh{\2711\353\006\005\2112\025\026w\357\355Y\035\027\3764K\322V\241OC\314\211\237h\214\233g\321\f2RV\310\2121^\3028\271+\242 y\367\336\217\r\253%\177\252\264\250vE\"y"
+	.ascii	"\016m\314\277^U\024\245j=\213\356\275\256T\305\0277z\333\327"
+	.ascii	"\266\222]B\b?2o=\200m\031V3\266\215\376\344\b\275wH\344\257\335"
+	.ascii	"\t\b\237\307K'\211\250\247\022a\276\274\375\321\342\225\3269"
+	.ascii	"\033\340\262\345v\353\031\333(U-\226}\362\332\034vM\265\017Z"
+	.ascii	"\335\203V\363\224\325;e\265NY\235SV\357pn\316j\335YmcV\327\374"
+	.ascii	"x\243e\365y\257\277,\253I\263\372@VKm\030\204\315\276\031o\325"
+	.ascii	"\034\232\333V\246\365\370\361\267\357\037\271Z\324\225\370K\336"
+	.ascii	"\344iK3\306\304\241\235%A;\023`%\204\031\223\"fL\200\300>\240"
+	.ascii	"B\336\320x\213\347\225\215\261\001ZCe}Y\324\311\274F\032o\221"
+	.ascii	"\347J\216($\301KK@\037sf\347\245e\257A\354:+\003\247cw\254+q"
+	.ascii	"\214\225\347X\035\353 \353\t1\214\224\332m\310\212n7\355\207"
+	.ascii	"qD\263\242\013\2303\313\321\020\374f9\366eO2\3565sgs\354\211"
+	.ascii	"V8vgm\030\033\216-J\313\033\373\343yi=c\235\275\261\225\311\224"
+	.ascii	"\234\215\005@\344$L\235=\321\007jm,\331eJ.\035{S\373\016$G(\244"
+	.ascii	"\305\202\362\232\ro\253R\203\206\332\243\275\364)P@Y\356\275"
+	.ascii	"\r|\266K\341\320\301\3473_\242v\247%M\350\244=m\231\206h%U\347"
+	.ascii	"|KZ2lJ\356m\313\315\2072\177\374\203\033\351\237\3656\304M\354"
+	.ascii	"o!\266\345\242\f\230\217q\351\252OPT\375\260\026\313\001H \222"
+	.ascii	"\220H'\340\bk$!&\244&\337\257\247\004\374\375\200F\002\232~>"
+	.ascii	"\233\304\304T\341\347\264tZ\201\357\303\002\"\006D\013\204vL"
+	.ascii	"\030\216~I\027\232\224\216\202\301\022F86\022z\n\366\236\202"
+	.ascii	"=\245$\337\257g\024d\352\t\365\030\270t\024\3545\001\201\301"
+	.ascii	"\236\316\230\236\2746\007\312e\255-\265R\366\217\277\021ck+\003"
+	.ascii	"\227\236\001\252=\201B=\225\255=\341\322Z\260\211\232bx\343\336"
+	.ascii	";\364\257\027\245Yf\340\316"
+	.string	"L\213e\037\261.+\362\306\356\304\266\250X\324\342X\025\266\217\365\261\374\r\203\317\303\0314hX\243\372\322c}\354\257\020\2514y\032\267\305x]\207\367\246\005xl\217=\021\310\216\345\261Ab\210pi\rg\250Q@\250\220A\206JD\204\202\026\244\2409p\002\031*\253n\021\240\271\204CIa\347\2017\177O\247_Q\231\357;\243M\264\306<\211\246\225\214\235\005\210Y\3045\307\216\024^VTWPlm\020\302\362\345Aa\0040\216\357\331J\002\245c/\001\226A\263\002\225a\336Jl\230\225\022\270\216\001\332\tGa\273\256Q\321\220v\257;\323\013\340\347\272_7\3238\206\006\026DE\f\346\224\0164\306\260<%J_\216\366\037\bX\f.(\005p\303;8p\"\006\334\ndEG\034A\037cWe,\3363Y\226\220\351\"\261\237I\236\013 \254)\004\217\242]\303\003?\354\313\336\314\236\370"
+	.ascii	"\330\326\263\267,Zp\001\252\006\235\347\215\373[\277\300K\334"
+	.ascii	"\272iz\270\234\214\215\032"
+	.text
+	.section	.gnu.lto_rxGetRefreshRate.121.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"%\007"
+	.string	"\242\31516@o\222\016@\3753\206\225<\236R\270C*\257\234\003<k\\\357\356\326\224\265\266\331\003\352ZE\001\t\035U\r\207\247!"
+	.string	"5\356\201t\255\257\337D#\237\020\231\002w8\036+z\254\b\341\300\360\020;\226D\344h\256\"\032\2548QUV\244\266,&\237\350g\220\275\213\237\242%W@f&\\\222n\025\367\243p\213\217\253Vx?\257@e$s\247)\216t.\277a\356u|1\371D\277\333=\201\222)\324\321J\246\306\351%Q\340\t\351\007=uK\r\001}m02l\003b\3120i\311\334\342@\t2\205\256\232L\341\363\350Uw\335\212t!e\304\242\205\260:"
+	.string	"\205\314\334i\241\215\376\372#\374\007?)\t"
+	.ascii	"\013\013=\263\030\277\"\3366\204\345\032\336\033\341\262\020"
+	.ascii	"d\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_rxFrameTimeUs.122.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375 \365\265\006"
+	.string	"\362\f/3`m\322\001@\\\020\304LF\330\302&^\205\327E\r\251\005f\332N\201\021k\255\367\254W\303WX\002\200\353\004p\262\305\273\323\212\250\237\"\262\211\224)\005\306\\2\256e\\s`Phh\030\007\321.\025S\017\013\256EP\224kS\334\353'\325Ri\307>\350\361\371\034\226\320\344\2553_#\235\245\nl`T\031\362\344\331D\261#'5\303~\264\372\261\235N\r"
+	.string	"U\300_#\273\026\241\224-a\"\227\355\215=\371\036\377\330\370%LT\320\240\343\204\"\304d76\313\007\244\263\350\025\351L5\376\236\317?\310\021:\027\211\0059O\200\203\335uZ\360\342\326\333.\260M`\333\023\b"
+	.ascii	"2\001\0038\003^\034\240kxo\204\313B\220\341\256\230\332I\006"
+	.text
+	.section	.gnu.lto_getRxfailValue.part.0.149.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\274\003\225\030"
+	.string	"\366k\232H\260VU:\324\225\3637\336\033\\\326\242j\3218R5\364\244*&l\345|\227\336\363\013\003{q!\261\003\255r\251\343V\267\006\003\025\226N\033\326R\370\233\206oo\247\236\225\002\371\312\237\377 l\375\233\331F6\331;\245\177"
+	.string	"\210"
+	.string	"\204"
+	.string	"]vK\234W?P\275\272T\231\204o\363\004o\312\356*\260\t\336\214\363\245\0278\310\375\350f\272+\344\004\311n\231\343\003\252\327i\204\373\331\366\177\274(g\240Y\n\17718\242L\020)\356\226\256\327"
+	.string	"\257!_\347i\310WZ\343@\257#\235$\220?}@\335\353\355iL\355\270\360\202\305\007|q*\003\354\215\254\335=\3613\005\2207\347\200\223\251\235\335\265\n\306\235\272m\r\266e6\325\022\302`\257\304\261-\302>\364D\211\235\f\004%l\0041}x\322\276o\344K\354\225iO\362\225\314`\031R\304\261z\345\002+p)\026\341\274\262\212I\374#_\242\035\211\231L\330]\260\305\223\022\304T\334\335\234WSP\275\262\306\323\220Fh\256HE\212GbX\304\223\2342\261\324cwW\243?\304\371H'ze\034\356G7\325\352H)\341\210\3720\267z\265\021\272\261O\304\017r!\271\017\261}\203~"
+	.ascii	"Z,\241\b\276&+|<\021h\362\341\264swu\364\003yz\"!Yz\363\213g"
+	.ascii	"&k\017#\355X\207y\337\251\205\241\036\325Y\246\211\207"
+	.string	"\323N(&\3338;goQ\t\367\267C\233\340\365\304_E\323\216)\272\031fR\032P\376\341\347\204\362\217\376\335\2042%)\r\373\343\322\031\366jz\\M\323\325\364\214\231~\252@\213i\227E\024\230\035\252Jr\034\351Ol4\333 T\2212\r\224\302\340\217\211}\306\215Q\006\366\360\023\3430\223\361\220\035d=3Z\204X\317\313\006B\366\222Pc\006\257\236\006:\016t\032\264d@\304f\263\227\007X\312\260\326O\315\365Ss\315d/\037\027\254fs\265hL\013\021\253\271F\320h5\327\312\366<\235\341?]\031i}\032\322IG\232\202zgGy\365\302\257X\241\305$\243q$.%\262\215\341U2\250v{:>\225;i\360o\274z\003\317\274\217\207|\235\364\304O\245\242.BF@v3\312d\024\242U\272\200aH\250\2018\344\fb\002\252`D\"\t$T\240\007\220\2421Bz\022"
+	.string	"\326-\311\224235\025\326\254\277\001\227=*W\303\240\013R,\311.j\006\035\352Q\n1'\336\023\033v:\021\203\2068\317O\206\016\224\027\327\0208\n\250\327\322KA\244\344\233=d\203\006Y\366c\224L\217ns"
+	.string	"\316)\214\253\312\247\363v\216\206+\303\b\356*\350\3065\260\372\304\312\t"
+	.ascii	"2o\263cU\237opY\236\376Xp\215\211\003\221EX\325W\2730>\254oF"
+	.ascii	"\207B\257\365\327\006\361VG\300s\030M\363\233e{\202\307\007"
+	.text
+	.section	.gnu.lto_calculateRxChannelsAndUpdateFailsafe.part.0.157.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"\315\013"
+	.string	"\006\027P> O\225\016\200\222Z\202\250\304 \004\246\002\332(\351\201\220\333==\266Qf'8\235fG\037cK=:\277\204\335uU"
+	.string	"1"
+	.string	"F\240\216\036\275v`\322"
+	.string	"\304\211\253i[$\233H\231R<"
+	.string	"<"
+	.string	"="
+	.string	"\004\036\207\225O\266C\355\222\355\320>\b\333)\227=\233\305?\215\245|\270\020\201D\307\356\306C\335p\357\232\232\347\253\256"
+	.string	"^\023\236\003\256edv\327\017\n7\274\355\003\266\025\330\037\005\326\264j:\377\375\177\244\205\030bW\302,\306f\200)<\330\276}Y\312\216\3702\317\216\034\332N}\003\245}\373rQ8\fd\376\363E|\204\367\r\224!\273\032V\240\330\375\n\034:3\373%n\302\343w\360\007\224o\035\372\240\3550u\302\241\302*g\356t@\362js\243\007\252r\347\305\226\266\311A\276\345\nKU\276\354\327\340p\241b\023Fj\314\252]\333\335\265\302\034F\240\351\\0\t0\027\213"
+	.string	"\022\003N\350\263\240$\342t\235i\023\300\033\313\251\213\247.\212>\232P\334t\244h\221\230k\300\351b\211\343\272\030\271\302\234Y)\313\252\032\263\255z\342\255\026\277gKU=\004\f\254\f\026"
+	.ascii	"\277\211\362\277`q\316\300\257I\231a\0200\245\330\205T\266w\266"
+	.ascii	"\230S\240>/\006\344\201\021\357\022 \317:\3463\200\315\344\235"
+	.ascii	"f\201k\017\270\321\"\372]e\f"
+	.text
+	.section	.gnu.lto_rxSetLinkRssi.part.0.159.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`[\001\235\016"
+	.string	"\366\233bE\360\260(\035p\376\216O\374\271I*\026\\\263\351.l'\t\276\343\352_\333hN\b\252\303\234wy-z\345\355\306`\031\026\300\267\210\2328|\212[dx\262\020pd fL\244\323\374\345\221\374\275\211\224)\005K"
+	.string	"P"
+	.string	"L"
+	.string	"\002N"
+	.string	"\376\345;\340\237\375\021\266I*\227\354\031\217\254\365\020\201\242\302\rlw\271?\355\360\3223\315W\362;!"
+	.string	"R+\323\263L\2550\\\267\025*3\260\273o=-\254N\231\003\376:!\273k-\303\ro\273\201m\006\366C\004.\221\325r\327\f\016\t\330\242\342\307o^B\305)\036\221\325\002]<\270\250\001\333\215\334\237\243v\373V\271\313\t^b\300\356\267H\366\346\267J\366f\322mF\031W\245*\360\342C\363\321\247yM\3516#\277]\030\232\025\273\021\301\237\017h\177\001\024j\2342\346\237xq\200\261\211\303\372\334]\223\252\214m\021\274f\215K\006*ox\313\334\275\t\264OB\371\324\365\341\2744\344\240\324\224*c}\317Vc\354NZ\037\377\204\351k\371\362\331\260{!\226ca\036\213\017&HN\3116\206\240@\344\001\310g\301\007\304\023"
+	.string	"$\02290A\001E\320<\342Y\351\270\225\216C\001\211\234p#\235\210\363t8$\201\244\343&\204B\035\267\331\316g\2531\326^ rX\364\224\251\372)\256b\344\317\230\244\344\371%\360\3576R4X2\346N\354#\230\252\n[\004\034"
+	.ascii	"O\345\t\231\200\275\024#\304`\202\247k\211S\226\205\301\256\301"
+	.ascii	">@\024\fs\205\303\307\n\022T\210>\027J=\303\320\0046\344\253"
+	.ascii	"YT%\004\301\263\216\371\f`3y\247\331\341\332+\n\227\246\246\004"
+	.ascii	"\267^[\306"
+	.text
+	.section	.gnu.lto_updateRSSI.part.0.160.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`\332\002\275\024"
+	.string	"6\344\202K\300\322Q:\202[)("
+	.string	"A\037\031/\220\300e\270"
+	.string	"\3503\361\240\031\034\024\253\356\305\226H.JI\022a}\032\374)\332\2526\020;^\366\371K\024\005\216S\210S`g\202\270\030EGAhK\320\262\260\320A\333'd\357\224\002c"
+	.string	"r"
+	.string	"m"
+	.string	":\233\365\361\202e\250\rogw_\004\202/J\177\372?\007\322\375'c"
+	.ascii	"\273$\\ \355\236)6\260\372x\362\221\324G\361\255\324Gj\373/l"
+	.ascii	"\347p\254\263y\374\364\331\222\025M5\301\341\356\222\037\253"
+	.ascii	"\211\353^\251\250\363oz3\257\007\236\336\364:\234\212\\T1\330"
+	.ascii	"]\257<\334\343m\257\330\336\331\225$;((%\265PJ\"\001\266\254"
+	.ascii	">\036\031Y"
+	.string	"x\302;\267\247\342\311\031*\220\342\245\242?\272\335\310B\361\334\236\b\017\220\f,R>\332\301\352E\376\214\\\355B\256=\246\241\216owY2j>Q\211\206\227}\"\037\306c\324>\024s\262;\027G\305\223s\303\267`\365Q\300G\336J\005o6\353A9\037h\226\355\334\1772\364\301\356>\240|\364\203\002\007~\300\023\324O\307R?\007\245Q\376\357n\260\243Q\256b-a_\334\332cW*B\201\323\356\206 ?vgTR\341\224s).\210\323\207\303\201(\220|\303\345\235(n:\016\232\313jC\263\033q\200\346D\r\320p\367$?\372\\\275\350\017z\265oZ\017\035\237\037\274\r\233\345\333i\370H\257q&\230\020>\206\302%!\341\222I\226\271p&\2113[2\227\231L\274\321,T\313\\5\231\rV\222/\264\262\244\305Ll%\254\316j\265\b\345\rFe\004\260\026\225\225\004+*\256"
+	.string	"\265\t,\345L\202\355\205\3054cb!\216\271p&\2113\311\227\031\254$cf\215t\265L\203a1I\033\215f\222\364\265\307+(\341\323\256b\260\207\240~\236v5\204\322\335\273\244\354Y\005\372\033C\330\341\325\031\007> \240\002\0312\343\006\235\315\b\250\t\237\204N\224 \316\231\301\003i\017\372eKZ\026\210y\036\022[\r\017A\306=|,E\b\020\202\313\261~\261\001M\020\222H,\234\3217:\202"
+	.ascii	"\306\221\261Id\3271p\333\210\371f\f\222\331\351X\270%Y*\260\352"
+	.ascii	"3\245H\033\372\247`Z\371ojR\204\305\325+@\246\365ec\253\331`"
+	.ascii	"3{l@\230fa=>O\266eP\261\031#\227\025\013\200\027\317\036\035"
+	.ascii	"{\347\265f\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`u\005\205\027"
+	.string	"\206\245\213G\200XN:\373Q\005\271re\300\020^\320\374\037\266\335\261Q^k\250u\241\302\224:\264=?\031\206\372\266\26569\\_\354\202\210f\231\3438\216\343h?\\%\330\016'x/\f\327\033O}\343\326\340\354&\211L\001t"
+	.string	"v"
+	.string	"w"
+	.ascii	"}3\347\322\247\320\023)<\0137\233M4\023\372t=J\275\3103\351i"
+	.ascii	"\364D\244\263\321\023\203\247BO\344y\025\341\026\215\272\230"
+	.ascii	"vG\375\273SB\277\356\214\260@\214\366\007\204\265\242\374\257"
+	.ascii	"\261>\370\032\255a[\304\310\027dQ\277\fQ\337K-\026\225`\276Z"
+	.ascii	"k\035\352wI\240G\304\315A\177\313YT>\371\373W\013\262\027\363"
+	.ascii	"\225\265&\324\307r\376\277\251\n}52\372i\234\372z1\372W\024$"
+	.ascii	"Q:\030\3753M}\274\363\305\241P\027?\243-\256dq\263\025}2*\372"
+	.ascii	"sg\212\243\241\270\024z\242/g\242\037w\226\350\217!\3616#\036"
+	.ascii	"\205V\004^bn\"\372aj\210>\227\023D\257\326\371A\211z\350Eb\354"
+	.ascii	"\320{\204\303\032)\327\r'\323p5\3125\303\335(W\f_R\256\027^F"
+	.ascii	"\271Z\270\030\323\307*\004Nc{\264!{W:@\336\245\020\310\002\212"
+	.ascii	"kt\007\346,G\207\227K\230\303\007\330\226\315\332\216X?\337N"
+	.ascii	"r\3776\207\225\304\371\361\215q\227\271\325<;\302\341a\357UU"
+	.ascii	"/\221\252\337\234\352\2559\372{8\372ln\364\036\245z}\330\350"
+	.ascii	"\257\331\377g\255\365\347iF\365\366\330\032\267\002\3656\372"
+	.ascii	"\363\030\356\320\021\005\3654l\202\242b\3605\036i\\\013}\352"
+	.ascii	"3g\0047\320S\304\233\334\355b\332\255\355\020\361/)4\304\273"
+	.ascii	"\374R\210\001\214\005\033p\201&\273_YiqA\276\0372\310\267pd@"
+	.ascii	"@|c\024\373a\246\365\325\261\037\2362n\200#\330\226\222\017K"
+	.ascii	"\301\021X\n}\370\007\267\354\204)\367v\245\017\257\261\207\027"
+	.ascii	"\354\360\322/\310[\004\006y\231\024\367|\313\323\323R\262\334"
+	.ascii	"\240:\2532$ o\022\256\035\020\206\267$\t\310\303\267]!^yH\037"
+	.ascii	"\220\003a\250A\020#\251\226\211PR\320\224\206\003\340\002!\022"
+	.ascii	"\333\034\021\220\030K+\"\022\220\004\022\220HM\007\fjx@\333\020"
+	.ascii	"\324\002`%=8\303b\365F\252`[\264\230\265\276\372\255\244\246"
+	.ascii	"\201\3661\256\005$\351\214\301\362IkT\n\2352%_4\344{f\227\366"
+	.ascii	"\314l>\300\3033\326o\267\352\336\216j\201;C\246\275\271\013V"
+	.ascii	"\371\244\t\322\027$\273\212\003y&&\037\320\277\304\001v\300\201"
+	.ascii	"\006w/q#\007B>\036\316\324\no\"\204k\375h\332\347Qd*T\204a'\343"
+	.ascii	"\256\n\272\336\323\245\376X4/\022\263\t\374~\2144!\362i\261\362"
+	.ascii	"\244B\314\276\377<b~(m\211\237\333\363\007"
+	.text
+	.section	.gnu.lto_.refs.f85406b0b830fdf2,"e",@progbits
+	.string	"(\265/\375`9\001u\f"
+	.string	"&a\\>0k\233t\203\231\033>b\361\202\261M\027\006t\203\037\276\030.\211\0373#\"\"\"\"\202p\277L\205\252^\375\377\257n\177\377\277\272\336U\337\376\337L\355M\255%D\030\255m\315n\231\002J"
+	.string	"L"
+	.string	"K"
+	.string	"\025\333K(\035\233\374\265uK\273\002\263E\362\223\3541\311\230\364\005?\002\247\310\023\\\375\303\312?1\357\304\317\300<{\217\275~\275\016\343W\360\247w\344\335U\217Qu\013\352\271\352\265\252g\022\335\222xH\365iZ\232\370\364\b\324\364E\336\n\024&\274^\t\361\033\001~!\274\357\203\254\327\001\245\267\301\244\227\201\305w\201\245WA\345\037\361~\021!^\037D\374?\300\337\303\373;p\310\372\032\270~\206J\037C\345\021d\017\302=\b\276\007\276\346\372K\245o\224\017Ol\235\352|\264\255q=u=\342t@Nu]\342t\223\247e\001=\2675\375\r\230~H\314\017\201\371\027,d\276#\363\034\231\337\310\274&\353\031\3601\340k\\\307\262~ab\227\242\\\212=3\317\330\f\355\351R"
+	.string	"\275\232zs$\314\003yZ\t\222MI\032\310\363s\201\236\361\217\276\271t\013\376\313\366\220NxG\217\241<\022\312\251PnD\303\256W\234\237\272\217@% \255\001\372\316\363\233O\307\304\017\320\351\027\314_l\235\243\364\315\323\257\370\321\323\237\326\t"
+	.ascii	"\230T\310\346,^l\302\375P\371<\355\"0\030\030;(f\314Z%\n"
+	.text
+	.section	.gnu.lto_.decls.f85406b0b830fdf2,"e",@progbits
+	.ascii	"(\265/\375`.H\2553\001\372\nNqU LI9\351\252\272\256s\3562\356"
+	.ascii	"+\362\257\362*\2563\306J*jff\245.33_\325n\315\374\337\315\337"
+	.ascii	"\377\357sFa\325f\034\353\364\2138@U\350e6\312\0348l\264<\266"
+	.ascii	"\353E\016F0\342\314\023CN\3500\247N\377\374\377\341\326\204\354"
+	.ascii	"-w\n\367\005\020\007?\0077\226]CLN\2435\262u\330\244\031\020"
+	.ascii	"K\307\232e\332_\3414Z\215\203\261\324~,sN\276W\374=uE\206\253"
+	.ascii	"\2465Z\343\3603\3139)\302H\204\nq\364\3108\270mW\213N\002\364"
+	.ascii	"\341\326!\367\201\234\331\316\376\266\370\372v\016\2447\231\005"
+	.ascii	"T\342\256\364\335\251C\347\357\032\374K\207\177\253\340\263\325"
+	.ascii	"\242\3637\n\376=\303\347R\213\316\236\3214\2522D\203\001\255"
+	.ascii	"\222Y\231s2\bX\206\315\r\266\276\277A\360k\2103\350\357\357\357"
+	.ascii	"\257\2068\177\221\3707\013\337\272\301\267^\360-\025l\004\005"
+	.ascii	"\337\032\301!\314\360\255\017|;\206\017g\267\360\355\334\340"
+	.ascii	"\343\325\341/\3310\206:t\336\257\026\235\357\027\360;\007~{\341"
+	.ascii	"W?\374\212\006\277\332\341\017~oz\242\270qb#\031\242\205\262"
+	.ascii	"4n\372*\035+38lj\233\252g\351\272\316\254\350[\223\265\3504\342"
+	.ascii	"[.\221\323\301\326\267.\273\256\251{\257\313\252\346\032\234"
+	.ascii	"\270\217U]\336\234\251j\005\001T+\b3\256\005\252(\347}\365\202"
+	.ascii	"\377\232\006\r\006rZq\372V4\177\025S\357\352\031\037<77d\214"
+	.ascii	"!S\313T\275\212\314\331*\347\274a\347K\313\023,}\253\231\212"
+	.ascii	"W\225\034j^\016\252|?\252\274\372\276b\301&\310\271r8\353\337"
+	.ascii	"_\345p\232\250E\347\351\004\351u\214\205\223\273"
+	.string	"\232\323\367&k\321y\266:tV;\244\3270Cg\027X2\263\345\234\203\314\260\271\034B\372\366\324\241\363\257`8\354\034\271\202\243G\035\235E\333\342\323\353\373e\005\017\245\230\276\257H\360\377\352\245v\251\312:W\267\324d\316\311\234\363Op\251r@S\030r\325\235\227\r48Q\347*\226*g\223f;RttY\346\2344\022!\"(G\02122\316\373z\206_\303p\315R\265T\245\207\032w\rN\334NA\311i9'\203~\352$\251#\247\357\253\027~\365p\326\277\352\341|\325\302\177\275\342!(9\343\305\216\276\177\205\253V|\266\200xY\323\267\212QO\023\034yW}\037\205\277A\262\256\001Qa\310VUxf9'\377\327\267J\245*\353\224*\345\225\255\266\275\2239+s\316\257M~\244\327)\325\255\256\331$\\\266\252\n\363A\2161ks~9'E\030\211\360\231\3416&\347\274\247"
+	.string	"\376P\213\316[\207\316\177\200\353\223\n\245*3\250j\257Nj\223\233T\311\234\3149\031\324B\350\264E\351{$\354s\364\037\210,\237\370\211_38\355\337_\315\340|\343\256C'\206Zt\376\225\311_\227\324\264\fl\226\0262\263\345\234\314\200\255\262\274\245\365}\262\026\235\270\016\235\025E\005\b\350B4\242\312\251t\215\006\005\320\275\340\257&."
+	.string	"\001t\227G\341\273\232%SQ\270\360W\017\\\255\205\277;X\f\324,"
+	.string	"\376\212$\201\016\366\350\177^Eq\n\376k\200\277\207\354\207\277j\360\327\024:4\321\035\300_\271\006\360\327\243^\373k\r1{\301_\2676\320\242'pq\3745\216\265\340\357\023w\031"
+	.string	"y\370\233lG\36740\005)\326\303_\327\330\016\177}\343%\374^5\262\024\374\027\2005\372\217\202%\262A\277\375\371m\217\005\376\026\377\025\305A\370\355\2333^\354\316\177+x\025\005{\376\326\374\353\007\352\002Z(T+\360\277\203\275)t\2350\177\307\271\210\3372\371[\314\317\355n\336\314\371\374\366H\336\336_\371\376~SS\250mN\327n\376:\\Z\360\3330\377\333\350\241\351\345\3775\035\264\244\300V\364[\2574\177\025\241\001PK\350\006\030\335U\007\374\357\360\fv\364\002.\370o\t\376J\207\246\032\035\300\370w\2213m\200>Q\215\320\236\301\201\376\213\376\r4\021\374\353_\223\270\377\355\300\337B\364\376J\365\327\022\374\225\004\177M\341\257S\177\347\375\325\352o\274\277\007\360\267\b3\377\243\374]\246q\220\371+\361\357\235.\033\363&\001,\252\321\335\377\270\026\376u\003\177}"
+	.string	"\004\376\252\364\327\b\264\230\277r\340\257\027\370\353\215\016\363?\257\0363\370o\364_"
+	.string	"\377\325\354\272\313Q\374\027\305_\243\364o\261\342\236\230\277\255\262\362\363\277\f\370\337\245\265\374\347\362\377\313;\374\327"
+	.ascii	"\335{~\033\325U\232\n\360\277\333\377)\377\325\256\201\377V\276"
+	.ascii	"\363\333\246\236\322o\034\376\226\300\337n\177\r\322\366\327"
+	.ascii	"\020\1775\361\327\021\177]\300_\r\360\327\017\376\272\301_\021"
+	.ascii	"\360\327\004\324\023\177%\361\327\003\374\217\253-\256\341\277"
+	.ascii	">\376&\301\337'\370;\377]\202\277\247\376\256\372+\262A\360\367"
+	.ascii	"\b\376f\201\355\377\317o\016\340o)\177\037\371\033\355\357\263"
+	.ascii	"\277\211\374=\344\357\035\177\223\375\215\374\333\306\3371\376"
+	.ascii	"\326\372\333\352o\f\374m\201\277+\370\233\350\357\024\177O\340"
+	.ascii	"o\240"
+	.string	"\277\037\360\267\003\376n\300\337 \374\275\200\277\017\360\267\001\376>\361\267\006\177\233\370\233\304\337#\376\006\300\337 \376\276\340o\017\177\033\375]\364w\320\337=\177\003\377\336\371\333\374\333\376]\377\372\367W:\177\225\363\3277\177\355\373\353\362\257|\177=\363\327\274\277\336\375\265\356\257s\177\325\362\327+\177\255\362\327\267\277\262\3755\312_\237\374U\311_\317\376\372\200\277F\340\2577\376z\365W\341_U\370+\213\377n\376\267\371\277\346\177\336\3773\377\277\374\257\362\327 \177\365\361\327\035\177E\376\325\350\257c\177\025\373k\214\277\242\370\217\302\177\265\377q\177\365\372k\327_[\374\025\353\257!\370+\324_\213\177}\372\353\360\257 \370+\323_\227\376\032\374+\b\377\337\374\357\373\277\367\037\315\377\272\377t\377\341\376[\371\237\366\337\370\177\356\377\005\177\177\177\177\177\217\211\337\347\304\217\224$S\266L\265R\2219O\3119o"
+	.string	"\341m\007\221\276\326\f\322-^\002\204\354P\322\327\326\241\263\366\254a\n\222\034\335\332\211\261wU\016g\263\2357\256\271e\317\031\246"
+	.string	"H\030+&L\273uFruY\366\344\300\357\321\302\034\362\350\350l\235\024\"p\226\357\253J[g\212y\241\314\255\357y\3700\005Z\344\344\354\334\233\244\227\333\271\2372'-\264\372\332.\300\236/C\200tq1\203\220\301\221\341\262\245\347\253\312M\016\272S\223\007\243\357y\260\340\n\306\034\335f\261mVK\355\003a\305\\\226\202\317\243\004W\260<\252\313j\341\332\354\225\272\274 \346\272x|\340\363|\341\n\270\034\335R\261m\266JE\003\002\213\254\234\277\220\272,\273F\234'\013\0378\007\027q\035\331\266j\337~\rNT\245}\253rFy\212\357C\222\344\210\003\325\340\327*wV`\246\246f\331j\3169\203\345)\276"
+	.ascii	"t\201\353\n\361[)\267lg\230+Ti\372\332\265*\307\005'\347\205"
+	.ascii	"\276\357\253k\377\201\327\311\031X\217\276\007\302a\013\346D"
+	.ascii	"\211\322n+\374\200I|AVZ\232}\3229\347l\266\343\306\003o\231\301"
+	.ascii	"b\204\370m\362\366\t\260\307\227\221\254\276\226\211u\262fm\355"
+	.ascii	"\206ub\233\\-7\257\032\026\006\220\217\032}j}\213\340\013\276"
+	.ascii	"\240\241Y%8\347\314"
+	.string	"\304\fx\345\204\205\224$\267JTl\321\222\205\344?\260\003oXN,\022{\204\013\214\225\266/0\274\350)\215\324->o\250\330\375\365=\220\013\177\240:\262Cl\013\267e/\263g8\347<\225\314\\Fqf\177r~\031\f,\204)\245\252\214\322\026\271=\273\032 ,lr(\373\276\317\272\360\037h\311x\311\005q\301\254kL\022/U\316\2531b\226H\225\302\303&\b_\214\276\307k\360\377\372\376\317L\325\225s\3762\223\271\253\312\347\374\353\253Yk\210\377\247\332z\364\377\346\374\337~"
+	.ascii	"M9SQ\361\3139\3276\370\314\n\225\330\207l\332ue)\311\246@ \363"
+	.ascii	"\262\"\243\221\245$\363\312\220\245$\313SVeS\031\2722\331T\226"
+	.ascii	"2\347\fVVS\" \275\262\224T9C\2262{\345\025b\274jN\222Me+d\316"
+	.ascii	"\220\2552UV\"\275>dY\221ye)\251\2742d)\311\274\262\222,c\310"
+	.ascii	"VT]"
+	.string	",\254rW\206\254$\333\313J\244\027\206,%\322+KI\006\244\216\261\350Q\3675\305\217GX\315\221e\225\267^\330\240\352\302`\227\225Df\274\234+\333U\356\312v9\037\345l\003\331\205GE\243\302U\331mUM\241B\326d\316\231\303\213*\035\310le7U\263]\326\013\310\234_\250r\312/r\316\231\203\251\244]\006R\355\246v\330\310ZW9S\220\2239\277\310y\252f\273\234\363T\316y\247\313F2\347\032\030\262\314^\274\310\031\314\350E\2661u\345*\347f\323\203\363\312R\352@\"]YS\232e\254\344T\315\322Bf\263\214G\326\205\225SO\262V\316\271\262\301f^0\370\200\334\n\371m\220\276a\271>\020D\006\f0}\201u\350\254K\220n\201\004\335Y\351+\353;\244<\262<\252\365Q\225\326\207\0253\263r\3662\341\002\322\306\b\236\031A\246\350\364=N\202\255\030\276\302:2"
+	.string	"r\245\t\361\352k\311\254\216\252|\234\335\221\203\202\266\364\341\200\353{L\003K\345\234s}\334\271\363\270\263\250\306\321-\362Ui\221\266E\235\352\362@\0240\313\334\0056\242\302A\363B\244\3571\026.\312:\272\275\361\252\2647\354\030\256\312\312\371\213"
+	.ascii	"I\272\376\344\374r\027\330\b\240V\221\2660 \310\360\322\353\373"
+	.ascii	"\235;\374[\033VL\306\026\330\232.\2716\034nh\334\326\370-\230"
+	.ascii	"\r\263\\\037\370YS\243\032\323\267\376\250EgQ\035:\355\f\244"
+	.ascii	"[\032\270\216\334\026\220\276DVF\214$:X\264\364\2650\222Vgts"
+	.ascii	"\360\372~\347J\262\007n\254-F\337\337zu-\211\321cH\016\002^\221"
+	.ascii	"\203&\243\257}a\267n\271\254V\266\\\034 s\246\262\\Asr\246\n"
+	.ascii	"\252\025D\255 \256\022\035D\334\316\373\235).Z|\345\351\311\350"
+	.ascii	"kY\030\355\\\371\022\263\243\357w\236\340\337fY\254\027\270\306"
+	.ascii	"Z\364\265WI\266\234\263\021\217\036\026\027W\337\357\370\300"
+	.ascii	"\337\300Zu\233~\003d\205![\361\0303\263T\266\312\256\250Jk\325"
+	.ascii	"~\277\311\234\331\332\254U\263\301\261\264V\r\307N\331\244\031"
+	.ascii	"v\261\342\3072\347,\302H\204\b\274\346\306\013-\360\265\331g"
+	.ascii	"\006\224\275\031}\277\003\326u\232NU\366_\313\231S\303\354\257"
+	.ascii	"\343T9\240\251d\346J\321\365\306\r\0223\n\022\030\177\347\375"
+	.ascii	"\311\006\377\034\203\177z\301?\265\340\237J\332\r\020Y#\nU\337"
+	.ascii	"\237Ep\367\375BA\376X\252\031tV\372\376\024\202\177\212\341\277"
+	.ascii	"\371\326\330\3108s\333{3\327h,I[\256\271{Fv\264Y\323a}\262\321"
+	.ascii	"+3\243&\304\017\2342UH:M\243\341AbG\305&\231\3149\033\375\020"
+	.ascii	"Yr\3758\243\227D&\241c\246\361:\257\256P\363\"N\337F\326\242"
+	.ascii	"\023\203:tv\031\244\267\031 \257$jn}34\031\271\n\\\270(\3531"
+	.ascii	"}\327\202I\033+}\223i\\\\B\220}\353\256Y\026\330^\337\272\366"
+	.ascii	"\302d\331\326T\330\220\352\272K\223/m\327t\r\246\303Te\3275\334"
+	.ascii	"+\234\236\273Q2g+\244*\315\245\332\201a\310VjN\352\032J\263y"
+	.ascii	"p\325\005\334Z\321\266\3149\311\201\r\"d>\267s-:\177n\341\237"
+	.ascii	"Y\256\267\304\005\311\303\362\222F.\316).\213\255o\307\255\005"
+	.ascii	"m\211\251\213\321\267\255t\226\377\300\035\"cK\322\372\376\235"
+	.ascii	"\005\213\2276\267$\311\0239\007\317MU\366\225\206Kf\243\233E"
+	.ascii	"\355K\222\2767\347\360\373\252\334\177\240\251\303\r\032+V\336"
+	.ascii	"z\212\033^\022\003\211]\332\233[OY\022\313\n\267*\327\223\347"
+	.ascii	"\205\204\311\220\226\242\344\b\030\026}o\206\341We\257\265\032"
+	.ascii	"\336\216$.\372\266\232\322'\347\264\234s\207\213F\356oN\337("
+	.ascii	">T3\252\204\351{\263\013\337\314\370\357'uE\336\372\"\275\321"
+	.ascii	"ZF\207\331']XJ\2249\313\n\247\322!c\243\302\251\1775\264V\270"
+	.ascii	"p\241\205\365\367Tgm\335\030\203\023\343\216N\225\025\230Y\246"
+	.ascii	"\n3\343b\261l \355B\017i']\326M\372H#\351\037\275\244_\350\264"
+	.ascii	"f\322E\332H\2375\2216\353$\235l!\335B+i\037\035\244*\033\255"
+	.ascii	"w\274yt\217\337\344\233\305\337S\335\342\305\262\353\357\251"
+	.ascii	"\366\3122{\361\367\324\026\217\026e\344\340X\302\250c\326\344"
+	.ascii	"\357\251\376\272\373;\361W8\265\216\230\031\013\033q\226ms\002"
+	.ascii	"}E\252\232|\251\242\344\266HR\306E%\357\20447\253)\366\314\007"
+	.ascii	"l\005\333\2237+\344I\226\0337\323\355Z\271\362\202\203L\333\315"
+	.ascii	"2f\205\004\257o\3212\311M'IL)\026\r\316S\311\f\206\234\332\363"
+	.ascii	"\200\216\036\033#~9\013,\304\216RN\233\260'7\245\334T\323\340"
+	.ascii	"\204\271\346c\314[\223\276\257Js\315r9\300\210\330\231\276\246"
+	.ascii	"\362@`tX\226}oB1\243\374@\2363\036\312#}\257A\007~\001\240\314"
+	.ascii	"\360\362\352k&\255\327I\006\n\335\024\223\311\315&?\260\247I"
+	.ascii	"\334\325]\337k\020\303\346\222\233i?\260\366\330\262\023\323"
+	.ascii	"\367\032f\340\337T\362\003}\366\206\314\b\322\367\032\274\360"
+	.ascii	"5\264\300\032\236\0349b\353\216P\001\307\270)\367\336`\r\\\320"
+	.ascii	"\320\212\234\251\343\307\243\025\247\305G\337\027-\261\006)."
+	.ascii	"\270`\236\241\361\225\251\343GWd\353M\221\233g\367\316I\031\274"
+	.ascii	"/x\003XY\231I\244B\311\\\247\024,g"
+	.string	"\352\370\201\315\245\311\3655\211t\230\336\021;\"}_\204\004k\020\323\243\2079\304\bi\311\21093\003h\r\216\332\236\220\233C\344\314\270\202\353k\3760\203\364\336\223\030t\202\230@^\344\310\302\305\004e\007Z\337\367\231>\254\276\370\320\363\321W\200\310\350$\221}_\024\2065x\355\330a\353*\206d\325\235\022\263\234\301B\364\200qS+\243\2035\270 #\263uFG\212\224\251c\002\033\027vjx\003\325\330\230\2114BZ3b\356\314\220\344\f\026\342\007\314\227\025/\023\307M\344O\237\232]\223\260\377\300\263\216kN\234\276'Bb\r4\216\376\2333\314\031\246\215\n%s\021\035\371\022S\303/g\260\020<Va{c}\177S\354\246\215\307\355\024\311\233j\241\257Y\343q\3105+a}\315\260\032>`\274\3655\301\260\2346'c\372\2324\036\2673W\247\003G\034\\\324\202\271u3\206\271\005\204"
+	.ascii	"K\226\177r~=lp|A\372\232_&\f\257..<\\\264f^\335\3242\257L\253"
+	.ascii	"\024\256\200zjA"
+	.ascii	"\226\271\313\306\210f\"7\346\327\327la\2720Y\230Y&\326P\033."
+	.ascii	"\002sT\223\324\353\345\027\357z1\255\220\2522UZ\210-I3\013\223"
+	.ascii	"\273'}\315\252\035\255\026\\\314\351\373\2414\374\r\324\334\245"
+	.ascii	"\221<$4W\257CU\026\tig\226y\367\f\232K\307\314\346\324\255cR"
+	.ascii	"U\345\375\273{\367\357\246\251k\325\356\007\biz\313\373w\371"
+	.ascii	"n\234*~\313\234\363O\016\2546\034>7\357i:Te"
+	.string	"\221\320D\315\362\306\271l.\234j\007\226\314_=T\370\224\324\371]9wNU\33687Jf\021\"8\374\310\311\363kr\336\377\302\271~p-\304\260\372\3367U9\347bG\337\017\271\300\377\355\253\312\353&\b\253\b\235\262\276\267\315\323\\\026S-\\<N\306\225%t}?\224\205?D\205/\324w\327`2\313\033u}/\264\006_\350\f\276P\031|\241:\374\3373WO\351\245M\235^\337\321iU\365\275\220\027|\307\3342\327\314\017\fR\002\327\343\255\357\205\260\340_2\377\201\022\b\002\346\255\357\255\217;\257\230\337\273\037\330sD\314^\364\275\020\025\374kw\303\374@ \274\262\266'}/\244\206\177\301\274\375\265\t\353{\353\360\225\320\221\fxnT\301!v\277\374\326\375\227\256WX\256\021\374\321y\323\367\247\016\235w\016\351\367K\235\334\322I_\237:t^H\006\336@v\271\\.\255\006L"
+	.string	"\032\034\263\261,9r}/\204\2057\224\305=\356\312\275v\3258\351z^\260\303\242\246\357\225s\203?\350\270r\345fQ@\376\223C\202a\300\301k\303\362\233\305\210\227YV\206;lT\243\355m\327J\315\371\310\322\2429aB\244\312\257\025?\261)l\372^*\326\353?\020\350\347\007\206J\337\367\335)L\244(!\233r\337\300\306\300\025\261,\314\342\216\320]\267\336\201\304k\203\327\367\031\262`\2420)R:\354b\310V:n\230\261a\"\"G7J\275jj\255\\\032\301\257\255<\207\266\\(\027\212\013v\177r~\031|`\242\035\311\344\231]\206\030\270\003\223%Kn\023\\\344\244\353O\316\317k\313\030\336e\362\333$\003kg|}o\032\220\026\031\2261\036\377\201<h;\204\274\320\367\031\256p\207\276$I\230"
+	.ascii	"\323\302dq\322\367\030\336`\"\270#\333V\357\221#U\316\304\216"
+	.ascii	"[U\220e\036&R;\272g\365\242\241ua\320\202_;\354\3540\347\026"
+	.ascii	"\271El\035\207%\330L\217$c\372\036\203\022{\35023\273e$$\251"
+	.ascii	"\262\332\272\353{\fB\260\007\033-\264p\313H(:\222\\A\017\b\233"
+	.ascii	"\276eK\027\316th\365=\006\032\330\007\306\321/\217\252\274<\256"
+	.ascii	"\020\020\330\2209F\21083\260\021\265\211\026\275)\027\310\257"
+	.ascii	"\220\377\366\270>n\220\020\324Q\"\267D\362DG\337\373\003\351"
+	.ascii	"\027H\317\333\034\035\"}\207\352\320\311\223k\321Y\221u\350|"
+	.ascii	"\020\037&Rr\364\253CG\207\221\220\251\2760@\313As\330\003]\216"
+	.ascii	"\034\266\256\312\350J\303F&H\013\276\300\310\305qqd`\271\343"
+	.ascii	"\302\226%\227\276\017\"rk\\\033\267\306\275qolP\"vm\210\315!"
+	.ascii	"}x\250\r\231\352\373\240\035\370A_x\b\356\350\316\250\027Ly\301"
+	.ascii	"\352Z\210L5\025\302\205$\227\021g\2341aU\372>\350\005~\255k\247"
+	.ascii	"\327\225\341ucl\300r\364ue\334\257\033\003O\235]\314\376\344"
+	.ascii	"\220d0\260\020\325\r\325\2256}\377\013\3437\206\245\013r\246"
+	.ascii	"\004\372\303\007\322\273/.\327}a\345\030\315\335\255\313u\267"
+	.ascii	"\254\234\232\273\334\234gp?W^\350\221\326\367@j\370@a\030\030"
+	.ascii	"\347\350\327EU^\027\035v\255\240d/\036\"\3117n\374r\3462\342"
+	.ascii	"n\301\331\002\246\357\201\254\360\220\337eqYt\251\301Dt\216~"
+	.ascii	"\261\224\027\253\327\204@\263s\221\304F\226\276\377\361\202\213"
+	.ascii	"\310\034\375\256\270+\300,\377\344\374\242`\242\252\252*\244"
+	.ascii	"\031&\332:\252j\352\235\272S\033\230\375t\341!1\177\177uY\223"
+	.ascii	"\231\013i\371'\207\344\017\017\245\241C\247.\215\362\324\236"
+	.ascii	"\211\263\354\023\006\033\2619\202s8V\3161\344\234\253r\036\273"
+	.ascii	"q\302H\306\271\225\223\026\267\204\323\367}\255\374\017T\212"
+	.ascii	"\013\342\327\367>N0Q\231\243\3337o\340\260\330\2321t\372\336"
+	.ascii	"\007\t.\232rt\333\246\215\355\243\272\361aK\233\241Q7\307\366"
+	.ascii	"\321}`\r\226Y\231\276\367\201\201\237\306\356\245\261|g\3165"
+	.ascii	"\211\344\352\272\345\343\021\362\344*G\337\n\324\330=5vYs\027"
+	.ascii	"\230\345\232\333\345N\0131I\032>V\370=j0\321\334\321\355\031"
+	.ascii	"\245=\323zxEV\316^\030\240%O%\f2s\372\276\007\017\027\235\035"
+	.ascii	"\335\222QZ26\257\346+9\367\020K@\0342(\215Z\033+x\267y\177\007"
+	.ascii	"&\\\340\204\037\3430\352\004\243\320\247\002\251$\243\020H*\245"
+	.ascii	"\300h\001t\205 \tR)\207&\242\020\n*\370\204r(:\022\205\326\310"
+	.ascii	"\b\023\205\301\364h$\026\227\200w\"\321D\024\246Gc\t\224)j\270"
+	.ascii	"D\024\226H\215Q%4\f\207QDb\221\270#\202b\352t,\022wT\004\321"
+	.ascii	"\341E\323(\250\233:-\245G\343\231$d,\246K\302\2473\205T\322\320"
+	.ascii	"\235H\030K\030St\005a\312d\024\016\207\302\247\363N$\240\214"
+	.ascii	"O%\244R\242\243\220X\002\224\321\004\251\024X\301\235H\224P\341"
+	.ascii	"\201\t\035\n\203\304\t\250\340p'\022h\032u\f"
+	.string	"\242*v\356D\302\350t\f>\225 \026\237\236(\340\311`\301\361N$\240\242\212i\223R\212\036\321\247`\032\204*\261\204\301\0221\252\207\250\242M\243R\023\224\317Q\211\330\004e\022\233\240,:\002\241\361\032\215h\312\304\024\334I\217P\226\t%6\t\207\301\035&\324\030u\211E\341q\t5\356<Uj\202\"\361\303Bz4\n\233\320$\020\351\317\021}\200T\212A\310\230\204\032\323 T\3201\004\036\251\244\24318\314\020<\006E\220J\201\320\264\250\002m\200\220\nK\250\023\n\251\364\007}\2122\242)P\022\224P\005\343\317Px$V\200\210\210B\031\243\214Ah\032\202Tj\324D\024\032K\220J\20700V\200\205\340\020\025A*hB\022\023\212\0225\034\205\304\022\244\322\323\230F\r\207!`\300SB\212\024IQ\031\204Fcz\177\204Fc\222\nDa\004\216h\n\251\224\b\003\364\030d\202\252"
+	.ascii	"\0231\004\343\b\025\214A\023\210E\341RJ\304$\034\006-`\224J\213"
+	.ascii	"\230\212\302\024=\3018\214:\201X\302R:\244\2021h\302\321\251"
+	.ascii	"I8\034\201I8\f\256\240A\be*\232@,\301X\202Tz\001\206cQ\002L\350"
+	.ascii	"\nBt\tM\222J=\244QE\341\nA'\264\001Fc1\002\303 \261I\230\202"
+	.ascii	"\211\030\302q\t=\242L N\f\200L\2208\246A(\022h\3240h\201\241"
+	.ascii	"0\250\242H\004\301\244\245\324d!\230\246!\200\020:\022\243\212"
+	.ascii	"(\222\216hS\206\rH0\241\"(\016\207\301'\"#\332D\f\206`d\n\242"
+	.ascii	")\007b\361\030L\243\222X\030BA\005/\3401A\202\030DM\b\036\203"
+	.ascii	"\",\245>BH$\230\320\343\022:\034\026QH\245D@\rH\030{\320!\324"
+	.ascii	"S0\305R\372\203\256 LE\b\036\203\"\020\213\022@\217\301a\324"
+	.ascii	"\3220\270\344a8\214\"\006\241H\032\016\243\210?\306#\243\022"
+	.ascii	"q\204#jD\223\232\240.\370"
+	.string	"\2220E\211h\023>\007\035\024\240\003\017\244v\356\301\007&>0q\336\203\017\220\220>\350"
+	.ascii	"\t\277\003$kL\321\343\021\215\300R\212\341NM*P\246\245\024\202"
+	.ascii	"\036\030\240\203\023\034l\240\001\022\nI\016\b\241\350\250\024"
+	.ascii	"<\016Q\021\320'\341\261\347\t=\032YH\021\364\245\240c\032tZ\272"
+	.ascii	"\307\343\361N$\214\303bz$\026\227\224\226\322\022K*:@\241\307"
+	.ascii	"\024LDt\307\250\264\004\004\205\036S\034\323\340\321\bD\233\210"
+	.ascii	"\301\3244*\021\213\302\243\220\211XDA,\n\2378\240JL%H\025S\330"
+	.ascii	"a*\001e*>\235R(\023\261\204\250`\320\221\030\265\344\203\036"
+	.ascii	"\203INF4U\201&I\245?\351\361\004\342\b\301cP\004\241'\341\221"
+	.ascii	"\030\225$\225f \216 \202`\022S\020MZJ{\322\343\t\304\021\214"
+	.ascii	"Q\307\3401Ez<A\350\250t\304\304\021\214\025@\237\204(\240O\301"
+	.ascii	"t\204\2454H*\345\201\n>-\245f\2122\tW(\246PJR\3510(LQc\006bQ"
+	.ascii	"h4F\245`\004\222B\207PQ\"\250\030\006\235x\206\305\245\342\261"
+	.ascii	"\230B\005\035\2254\330\200I\b<\022\243\212KJ*R%!\224QI*\335\220"
+	.ascii	"\341\210\032\321\264x\214\n*1\021\205)(\035\203F\245\247\250"
+	.ascii	"\364\250\002\ne"
+	.string	"\254\300\007\035\006\227\214<\307\024]\201(T\022\032\215i\317R\312$|2\211\302'\254\302\022\352\264$\025|\302A\306ap\005bQx\f\016\213P)z$\226\260\224n@\241X@!E\217C\341\bE# A\205\212\3421\nE\023Q\350t,\026\237R,\245CF\024M\233P\021\320a\0231\204\247 \212\025\240T\b-)IE\005\225\244\202OAL\303\242\223\021M\235P@\217\301\025\204\307\245\020P\246\242\t\2510hD\024.\241\306(%\251\340\223\222T\3323,\026\033\240d\356\034\241\320\243\361\242*\202\306\24108\202T\312\341\250\344\301\221(\214\332A\231\212O\367x\247\241\027\241\320\264\304\261XLK\364H\005\237\254Q\251I\250\202XD\2016\021\203IC\224H\f:\241\220J5\034\225:@:\022\205Q\370\033\004Up\320\301\211\0168 \261DB*\005\372\001\016\200\342C\005$\360"
+	.string	"\274DB*-!\225\226 \n\203O%\226Rc\t\022BD\341\223\375\177\3728{"
+	.ascii	"\221\371\353q\003\030\006M\0337'\217{cG]\243\261B\316[_#*\262"
+	.ascii	"S\307If\353\216\201j\211\321\017\374\252<s\334\030f\334\333\324"
+	.ascii	"\017\244)eg\307\224+08\344\234u\370\324\256\214\261\305\205y"
+	.ascii	"\233q\336\260K>6yM\372\236b\034 s\246:k\2346~\212="
+	.string	"y\212\325\n\"\250V\020}6\005F\235\363Z\360v\3168\303\316\031'\230P\025\254\032K\032?\301\3165-\276\314\030\211a\013zx\2352\274\316\030}]0~\3068\261\306\330\320\372\236_U\256\316V\230U\337\367\001}Z|e\031\353\373\r\177\330C\025\327\331\305u\313\220\222\330-\261\005m^\234[/l]\335\343`\257+\016[\200\347\342\324rq\313\330|\330\203\333\260\004'\323rN\002\235F\206`]\001K\022\201\035\331:\263\346h,\301\314\364\375O\254\363JMO\316\227\276#\210\301\310\322\327\303\2173\237+\316|Z\001A\240\235U?\255\362\2264\241\353{R\365\030Lc\316\223'}\317\251*wf\315\034\226\r9\360\207\2679\346\337\034\263\016\006V9_e\2518:\320,\351\334\254c\271\324\251\023g\266\301\0056\343$\225uf\312\340\365\375\006,\374\233plT\261\030_;\374,\237"
+	.string	"\260\264\340\372~\300\3433\337\360\231n\354\035\035\326\027\02267\335\364\265\222\214E\027\263\317l\003\204\242\225C\t\220/l\336\324`s\215\271\274\271ws\257\315=\373\367w2\031#\345T\323\312\236/P\346\310\245\261u\267-\354\207\0164\346\331U\242\201C\347\2149\204om\305\234\356\264\251 e}\223@-l\001\271\201'\344\347/L\033\244\231\033\004\315\013'e\220xH\036ZdL\",\306\324\310\031\323a\270M\215\235\213\273'HzxQ\023c\307\202x\221B\243/\210\025sf\030s\316\264\003N1\300\354\215\033._n\332\231`\274\234\360i\001c\326\325\220b\304\315^U\036[\260\276L\272\366\253]o`\220\211\303\037\224\310\231^\344\314.{"
+	.string	"X!\004\353\253\213\311\005\247\r\021\0233\271\230[\316#G\302\334\031A9\033\353{\rS0\b2\023\316\2143\341L-\265\213"
+	.string	"N\304\210\251\341gf\271\251%\356\nM\0331}M,W4@\301\277i%\204\344\250s\301\303rX0\307(J2\304\024)\222\251M3\006\223\025@0H<\036\226\213\250M>\023@\003\213\353\245a\240\347\034S\206hDD\222$\205\322\316\001\207L\202T\232\303\201v+\235F\034\354\366\221\325\3465\372&h\020\001\241;h\377\013*c\261r\347BQ\314\262\310\fg\336G\307\271\374\356S)\022\263/\225\013$\315p\377\260\241\271-\366\323\373\356\336\24346\325\276\303\366\243\032XkN\335\321Pb\275\204\225\013b\375\205\334\332\200Y\254;\177\227\257+\251\001\312\227\212\325`\027w\0328W\363[\207G\304P\\\220\263\n\216\"\244\262\370\373I\2079\257\030\207\242\200-F+\211k\346\310\r\340\371\203\253\234VS&}\237\323\317}\335\372C\3342MWK\263\342\347\234\235\330\235\300\377\321\314"
+	.string	"p\320\204\321\024\356\3365\f\224uf\266\342\331\354\260\343\347?\321\201Ey\027\350\30609\324\016^8V{\342\363!\201\212\fo\246\234\230 \340\202c\335|*K4\2276\350\351~\272r\372\214\030\317\013\001!\367\354J\240&\227\252vr\022=6\302e\341\3412<\340\205\253g\361\226\326\311\376\356\204\211\241v\202\310\"N\020\031\026i*\353\210\01709\003B\375;\340^,\027\203\230\360\\e\246\254T\276\274\372\236<B8\013\340\305\370\035\r\b\254t-\b\261\214*W\314\215\351\007\237\301\2477\234\256jX\373\355[Y\373\013\256ZC3\005\033\217\230z\376z\273\326\211\337\036a\217\224g\\ze\364W*\\~v\224rR\214\355c\204.\\\2706:p\214t\350k\215$'\302\273\245/K\235\"\364\312!\224^k\262m\250\372\031]\356U\352\322\337\270\\'\250\217"
+	.ascii	"\247}D\347rYK\206@\214\016\321W\304\275\0163\374\367\247\364"
+	.ascii	"\022\001\017\205\267,.*\370v\355!KN\244\241{\272\214Q~U\023n"
+	.ascii	"R\310\311\311\244Z\256\213me\215~9[\342\333\311\352\007\016["
+	.ascii	"\204\315\007\001\315$\337''C\217\364\245\370\231\201v\355\202"
+	.ascii	"]\245\373\333\030g\036.Aq\233>9\345\372\224J\367\032\227\325"
+	.ascii	"\311T;\021\212\227qLTU\344\253\242| 9\260\313\341\377&\020\310"
+	.ascii	"hU=\317\375elj\013\307\333\227\004-\032PH\327\n\217\370\036\207"
+	.ascii	"\332Z\207\246N\353\353\273U\\\314!\266`\263*:(\211\361\220\017"
+	.ascii	"\247U\2333|\355q\371\016\022:m\303\026\315{\344\335\336uD\225"
+	.ascii	"z\353\205i\034\001\237VT\345]-\020\001\327D\224R\251\273\375"
+	.ascii	"\004\001g\007\2022(\311\227\264'\005)J\022*\021y\204\331\267"
+	.ascii	"\216\267N\2229\023\331\267\202P\3401/0\240!b\\"
+	.string	"\3556\264\257\323\247\002=\036\t2]\260\016\f'\300\"_b\267\254\354\361h\207\024\256\301\034?\037\251\200j\203\303<P\377=\312(\277T&Z\006$o\025r\243"
+	.string	"\206\350\256L\257\277?\213\210b\262\251\273J\216GA#PI\341]]>\261\342\346:-\210\310\022\323Q\330?\n\r\336\032\262\222/\344\006\204F\331\251\021\ft\343\201\364\324\204\307\251*\367\340>`\f\300\320\233\231j\"&P\031\277\314a!G\251\"\353\006i#\246\264\ftA\215kx\2740\036\002\177B\340l\270\335\350z\376iV\362\320\336|\217\nHz\001z]\027\336\"\242\311\322\302\222\275\b1\361\343\020Qf"
+	.string	"\271\023{\274\327zC\030\360[\230\324\257b\027\002C\035\321y"
+	.string	"\272\254\231\334\002\312\023#\177d\\4c\377h\\\371\252qTxC\325\300\205\217\016\230\240\212\b\226|\002\200g\262\377\016,\346gt\201\007\030\355X%r(\214\320\316[\253\325\273D,\013\304C$\327\022\343\221\256\315\211>\013(\260\264\227\234\232>\203\251\"@\235(\357\256/\220\256iR\n\373j:O\020\305\276\357\t\236\365PS~\214\303.d\021\2146\241\253\243\255\266\275{\204 \322\267\005Y8\270\332\302\231\031)\256o\025\021-\366M;E\276\003!"
+	.string	"s\236\r{\204\325\003@\026\344\254\337iD\004\234\255\352\032\2225]\251?j\306H\005\311\\\377G`#A\n\324\002\324rz\261\003\241\036N\260\325\305\"\243\306\265\325\222\336\314(\303\b\006\263\351\024J\267\220\325,\315\25544E\330\224\326\225\325\324c\222\271\357\346\227\326\025\371V\270S%\303\020L\3249`1Hk\242Uz\263^\372\221\300\340\350\340\2315\204\330\212,\222\303cc!\353D\031\3460\t\224'\246\207\270\333\003\230\035\313\264\343\324P\004\344q\221\302\201&T\375\346\342\333\320%\"\220\030\177y\303\034\274\b\305\237\302\206"
+	.string	"ku\001t\246\322p\323h6\3012:\320T\334Wu(\017\370\301\017b\344\264\2222\243\202\217\355n.\377$\251N\f\205\212\215\300\2666\337!J\262\331y\243\271\346a\030[#\\F\036\272\032\253\250\237W\177\271g\"\236\017\302\260b\177\232a\037\250\357\212\n\006\367F<o\243:#\201\227\217\332-\247^\302\"\3312p>\351\362\213p\312\bx\364C?\"\032E\037\331F\345)[\301;F\274\213\230IF[`\n\227\362\350l9>\032\315z\331\027\223;\022(\031:&\275~\020\233\347\030@\032D\024\235W\225\032N\336\274K\256\265f\254\030\177|\261\310\"\311\305\346\234\350t[\255\207\331QA*\022\204\013w\023Tb\353\267\257\2716\340\274B\374\255\n\211oy\343\264\362%\022\345>}"
+	.string	"\370u\375\246\3468\351\354\215\227!\253\242\206\324\311\363\315I`\266\037\212\031\227\227\325\224\331E\335\234J\254o{\017\344\212\217f\376j\005\311\260\341@\320w\rf\022\177\311\350\263\211H\216\315\255\360r\330\327\234 \"\211\365\344t\337\274\340\024\270\350y\001\023B\352\201!\026\004\351\027\205 \007\337\265\275\006\033\006j\253\204`\334\241(/\207\207\253\fJ\226\200\346d\2521\270ch\360\351V\237\357\213P"
+	.string	"Us\031\222\230\326\023(\363\304(\324n]c\366\3444\020\242\247\204Y\033\234\356\224#\234\265k\013\274\001\334\177\024(\2521\355:\003\032\301\302\242\273\002\237 o\237\252\037\301\210@\211\355)+;\257\2166\026d\337\221\206S16\217w\005P\005\007C\256\003\325\362\326\323#\332\335\t\034P\030\002Wj\3329\035:\346\257\001G\317\001\214\366\367\371.\031\270\311\321Z\270\2315\222,\264a\375\332\016\235\312\373\353\366\210\223\254\333\224@4\245\251\006\211\341\341\277jI\020\020D\365^\226TQ\0022M\02238P\216\240\b\361\216\262\341"
+	.string	"\005\244a8<\306\332d\256\327\335\250\302+\374jab6\347L\341\002y\206<\2512\037\202\320\233\360j\245\245\207\304H\345\251\354\2744\335.hx;\373\247\001(\3162\353\243\224\305\017\362e\2677\001-\025\303z\313\017i"
+	.string	"\260\311\272d\006\204\365\b\273>\261\365\033\336\366k\224\007kW/W\326\021\2033Y\246\326\347\320Oq$\221\204\020\033a\271\\n\210;"
+	.string	"P\201\201!\210k\024f\304\311\344\002\267\002\335\373\274\312;\354\230\210tI\342r \332D"
+	.string	"\017\257.\036)\355L\207\337\271{L\ni/\f@\236\016\234i\266\223\3366\325Y\221\3249z\266\340Cr\240\034n\224\334*\215A&\234>j\304<\236J\221\257K<\372\316%\214\333G\220\275pQ\227\320NS 1\202\340~8\321=)|\326\306\222\347R\304O\337\273\032HaR\235\322\365H0?\324\023"
+	.string	"\022b\256\367\260nS\210\253(\234-k\223K*l\243;"
+	.string	")\354\037f\0077\351\007\030\371xD\037Wr`w_E\207p\373A\362Bf%Z\362\256\211\334L\2546\212Y\2057\312\375\351U\003\266\rl}\274\350Y>\371\005\310 `\205\201\021\363\271\305% \330D\272\352\2472\\\353\316\007\202_s<1\022\217\205^\271nS~\020\263\222\202?\222\177%\201\177Y<\360\026\247R\267\207\241\237\023\034;p\024\016\216\016\374\221\214yx\201/\376\223\330\336s>\237\340\206 ^V=\200\260\206\240l\r\376C\301\225S.O\220f\323\322G\034Y\033\312 \016\300a\222%\323\375\331\301\341&'\235\216\324\346\373\026\236\340cF\350\177\215-\006=\277\360\363\277\347\207H\363\316JK\354\372\205I\370j\230\255\321)\301\343"
+	.string	"?+&\303\367\264p2\357\371\251\326\346t0\243g\356\r\017G~\203G\r@\234\3634s/\304N\002\336\345\274u'\236~\326h\270R\266\302\026\335.\225x\370\220\217\002\020\337Rx$\217\253\343\233\216\270X#W\311\344\035kG\271\201[Y&\032\227\300\243k\232S\033\365\376\357|\023\333\t&,_\037?\217\354\030$\347\322\242\357Pj\r3=2_\232h;\370{\235\r\250\263\252L/\253G\346\013\346\300\327\301\346\377\205\245\t\206)E\023\221>$k\316\033w\274\236\342\177\313\266\223\034\350\270\225\327\361\376\020\335"
+	.ascii	"\365)UG\256\016C\236\227\346\271}\263\345_\263\032,\364\301{"
+	.ascii	"\300\360q\364;\375\307\275\316\340\274\322\333\233\032q\013\236"
+	.ascii	"\344<\315\351a\276}\321\305\303\003\2179\352\264\377\321\236"
+	.ascii	"\343\336\357\367\307\341\337N\\\363\353\373\221\217\260\361\007"
+	.ascii	"\017\037\236\032\033\324G\360\353\275\324\364%\004\370\312\017"
+	.ascii	";\376\r\r\234\255\223\241\016\360\355\231\337\216y\366\230kk"
+	.ascii	"S\027\347~\003z Y\243\224/\274\261\231=\305\313\277\205\315J"
+	.ascii	"\321\207\016\2735\272\317\274\271\213\212\266^\233\203\317\370"
+	.ascii	"k\252\270+"
+	.text
+	.section	.gnu.lto_.symtab.f85406b0b830fdf2,"e",@progbits
+	.string	"pgResetFn_rxChannelRangeConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"pgResetFn_rxFailsafeChannelConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"rxRuntimeConfig"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"rxChannelRangeConfigs_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"rcRaw"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"rcData"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"$"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"rcInvalidPulsPeriod"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"H"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"rssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"resetAllRxChannelRangeConfigurations"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"suspendRxSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"resumeRxSignal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"rcChannelLetters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"pgResetFn_rxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"rxSetLinkRssi"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"rxGetRefreshRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"rxFrameTimeUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\002"
+	.string	""
+	.string	"rxFailsafeChannelConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"rxChannelRangeConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"rxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"rxMspInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f85406b0b830fdf2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10316 @@
+	.file	"scheduler.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/scheduler/scheduler.h"
+	.file 7 "./src/main/build/profile.h"
+	.file 8 "./src/main/scheduler/scheduler.c"
+	.file 9 "./src/main/drivers/system.h"
+	.file 10 "/usr/include/string.h"
+	.file 11 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	scheduler.c.c7f5c4a0
+	.weak	scheduler.c.c7f5c4a0
+scheduler.c.c7f5c4a0:
+	.long	0xdf7
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x22
+	.long	.LASF1199
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF999
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1000
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1001
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1002
+	.uleb128 0x5
+	.long	.LASF1004
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1003
+	.uleb128 0x5
+	.long	.LASF1005
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1006
+	.uleb128 0x5
+	.long	.LASF1007
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x5
+	.long	.LASF1008
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.long	0x7c
+	.uleb128 0x5
+	.long	.LASF1009
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1010
+	.uleb128 0x5
+	.long	.LASF1011
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x24
+	.byte	0x8
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1012
+	.uleb128 0xb
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF1013
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF1014
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF1015
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xb
+	.long	0xcd
+	.uleb128 0x5
+	.long	.LASF1016
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xb
+	.long	0xde
+	.uleb128 0x5
+	.long	.LASF1017
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x25
+	.long	0xef
+	.uleb128 0xb
+	.long	0xef
+	.uleb128 0x5
+	.long	.LASF1018
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0x5
+	.long	.LASF1019
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x9
+	.long	0xb0
+	.uleb128 0x5
+	.long	.LASF1020
+	.byte	0x5
+	.byte	0x19
+	.byte	0x11
+	.long	0xc1
+	.uleb128 0xb
+	.long	0x122
+	.uleb128 0x5
+	.long	.LASF1021
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0xef
+	.uleb128 0xb
+	.long	0x133
+	.uleb128 0x18
+	.long	0x30
+	.byte	0x6
+	.byte	0x16
+	.long	0x17a
+	.uleb128 0x3
+	.long	.LASF1022
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1023
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1024
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1025
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1027
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1028
+	.byte	0xff
+	.byte	0
+	.uleb128 0x15
+	.byte	0xc
+	.byte	0x20
+	.long	0x1a9
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x6
+	.byte	0x21
+	.byte	0xe
+	.long	0x133
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1030
+	.byte	0x6
+	.byte	0x22
+	.byte	0xe
+	.long	0x133
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1031
+	.byte	0x6
+	.byte	0x23
+	.byte	0xe
+	.long	0x133
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1032
+	.byte	0x6
+	.byte	0x24
+	.byte	0x3
+	.long	0x17a
+	.uleb128 0x15
+	.byte	0x28
+	.byte	0x26
+	.long	0x232
+	.uleb128 0x2
+	.long	.LASF1033
+	.byte	0x6
+	.byte	0x27
+	.byte	0x12
+	.long	0x11d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1034
+	.byte	0x6
+	.byte	0x28
+	.byte	0x12
+	.long	0x11d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1035
+	.byte	0x6
+	.byte	0x29
+	.byte	0x11
+	.long	0x232
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1036
+	.byte	0x6
+	.byte	0x2a
+	.byte	0xd
+	.long	0xcd
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1037
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x11
+	.long	0x122
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1038
+	.byte	0x6
+	.byte	0x2c
+	.byte	0x11
+	.long	0x122
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xe
+	.long	0x133
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1030
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xe
+	.long	0x133
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1031
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x133
+	.byte	0x24
+	.byte	0
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1039
+	.uleb128 0xb
+	.long	0x232
+	.uleb128 0x5
+	.long	.LASF1040
+	.byte	0x6
+	.byte	0x30
+	.byte	0x3
+	.long	0x1b5
+	.uleb128 0x15
+	.byte	0xc
+	.byte	0x35
+	.long	0x286
+	.uleb128 0x2
+	.long	.LASF1041
+	.byte	0x6
+	.byte	0x36
+	.byte	0xe
+	.long	0x133
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1042
+	.byte	0x6
+	.byte	0x37
+	.byte	0xe
+	.long	0xde
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1043
+	.byte	0x6
+	.byte	0x38
+	.byte	0xe
+	.long	0xde
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1044
+	.byte	0x6
+	.byte	0x39
+	.byte	0xd
+	.long	0xcd
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1045
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x3
+	.long	0x24a
+	.uleb128 0x18
+	.long	0x30
+	.byte	0x6
+	.byte	0x3c
+	.long	0x30a
+	.uleb128 0x3
+	.long	.LASF1046
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1047
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1048
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1049
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1050
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1053
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1054
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1055
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1056
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1057
+	.byte	0xb
+	.uleb128 0x3
+	.long	.LASF1058
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1059
+	.byte	0xd
+	.uleb128 0x3
+	.long	.LASF1060
+	.byte	0xe
+	.uleb128 0x3
+	.long	.LASF1061
+	.byte	0xf
+	.uleb128 0x3
+	.long	.LASF1062
+	.byte	0xf
+	.uleb128 0x3
+	.long	.LASF1063
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1064
+	.byte	0x6
+	.byte	0x8b
+	.byte	0x3
+	.long	0x292
+	.uleb128 0x15
+	.byte	0x90
+	.byte	0x8d
+	.long	0x415
+	.uleb128 0x2
+	.long	.LASF1033
+	.byte	0x6
+	.byte	0x8f
+	.byte	0x12
+	.long	0x11d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1034
+	.byte	0x6
+	.byte	0x90
+	.byte	0x12
+	.long	0x11d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1065
+	.byte	0x6
+	.byte	0x91
+	.byte	0xb
+	.long	0x429
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1066
+	.byte	0x6
+	.byte	0x92
+	.byte	0xc
+	.long	0x439
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1037
+	.byte	0x6
+	.byte	0x93
+	.byte	0x11
+	.long	0x122
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1036
+	.byte	0x6
+	.byte	0x94
+	.byte	0x13
+	.long	0xd9
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1067
+	.byte	0x6
+	.byte	0x97
+	.byte	0xe
+	.long	0xde
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1068
+	.byte	0x6
+	.byte	0x98
+	.byte	0xe
+	.long	0xde
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1069
+	.byte	0x6
+	.byte	0x99
+	.byte	0x11
+	.long	0x122
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF1070
+	.byte	0x6
+	.byte	0x9a
+	.byte	0xe
+	.long	0x133
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1071
+	.byte	0x6
+	.byte	0x9b
+	.byte	0xe
+	.long	0x133
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF1072
+	.byte	0x6
+	.byte	0x9d
+	.byte	0xe
+	.long	0x133
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1073
+	.byte	0x6
+	.byte	0x9e
+	.byte	0xc
+	.long	0xb5
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1074
+	.byte	0x6
+	.byte	0x9f
+	.byte	0xd
+	.long	0xcd
+	.byte	0x3d
+	.uleb128 0x2
+	.long	.LASF1075
+	.byte	0x6
+	.byte	0xa4
+	.byte	0xe
+	.long	0x133
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x6
+	.byte	0xa5
+	.byte	0xe
+	.long	0x133
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF1030
+	.byte	0x6
+	.byte	0xa6
+	.byte	0xe
+	.long	0x133
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1076
+	.byte	0x6
+	.byte	0xa8
+	.byte	0xe
+	.long	0x43e
+	.byte	0x4c
+	.uleb128 0x2
+	.long	.LASF1077
+	.byte	0x6
+	.byte	0xa9
+	.byte	0xe
+	.long	0x43e
+	.byte	0x6c
+	.byte	0
+	.uleb128 0x26
+	.long	0x232
+	.long	0x429
+	.uleb128 0xc
+	.long	0x133
+	.uleb128 0xc
+	.long	0x122
+	.byte	0
+	.uleb128 0x9
+	.long	0x415
+	.uleb128 0x27
+	.long	0x439
+	.uleb128 0xc
+	.long	0x133
+	.byte	0
+	.uleb128 0x9
+	.long	0x42e
+	.uleb128 0xf
+	.long	0xde
+	.long	0x44e
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1078
+	.byte	0x6
+	.byte	0xac
+	.byte	0x3
+	.long	0x316
+	.uleb128 0xb
+	.long	0x44e
+	.uleb128 0xf
+	.long	0x44e
+	.long	0x46f
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xe
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1079
+	.byte	0x6
+	.byte	0xae
+	.byte	0x11
+	.long	0x45f
+	.uleb128 0x19
+	.long	.LASF1080
+	.byte	0x6
+	.byte	0xaf
+	.byte	0x11
+	.long	0xde
+	.uleb128 0x5
+	.long	.LASF1081
+	.byte	0x7
+	.byte	0x23
+	.byte	0x12
+	.long	0xef
+	.uleb128 0xb
+	.long	0x487
+	.uleb128 0x18
+	.long	0x30
+	.byte	0x7
+	.byte	0x25
+	.long	0x4d4
+	.uleb128 0x3
+	.long	.LASF1082
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1083
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1084
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1085
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1086
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1088
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1089
+	.byte	0x15
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1090
+	.byte	0x7
+	.byte	0x2e
+	.byte	0x3
+	.long	0x498
+	.uleb128 0x28
+	.long	.LASF1200
+	.byte	0x10
+	.byte	0x7
+	.byte	0x32
+	.byte	0x10
+	.long	0x515
+	.uleb128 0x2
+	.long	.LASF1091
+	.byte	0x7
+	.byte	0x33
+	.byte	0xe
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1092
+	.byte	0x7
+	.byte	0x34
+	.byte	0x14
+	.long	0x487
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1093
+	.byte	0x7
+	.byte	0x35
+	.byte	0xe
+	.long	0x105
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1094
+	.byte	0x7
+	.byte	0x36
+	.byte	0x3
+	.long	0x4e0
+	.uleb128 0xf
+	.long	0x515
+	.long	0x531
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x14
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1095
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x17
+	.long	0x521
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1096
+	.uleb128 0x7
+	.long	.LASF1097
+	.byte	0x8
+	.byte	0x2b
+	.byte	0x12
+	.long	0x550
+	.uleb128 0x9
+	.long	0x44e
+	.uleb128 0x7
+	.long	.LASF1098
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x11
+	.long	0xef
+	.uleb128 0x7
+	.long	.LASF1099
+	.byte	0x8
+	.byte	0x2e
+	.byte	0x11
+	.long	0xef
+	.uleb128 0x7
+	.long	.LASF1100
+	.byte	0x8
+	.byte	0x30
+	.byte	0xc
+	.long	0x232
+	.uleb128 0x29
+	.long	0x47b
+	.byte	0x8
+	.byte	0x31
+	.byte	0xa
+	.uleb128 0x7
+	.long	.LASF1074
+	.byte	0x8
+	.byte	0x34
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF1101
+	.byte	0x8
+	.byte	0x35
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0xf
+	.long	0x550
+	.long	0x5a9
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1102
+	.byte	0x8
+	.byte	0x38
+	.byte	0x12
+	.long	0x599
+	.uleb128 0xf
+	.long	0x550
+	.long	0x5c5
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xe
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1103
+	.byte	0x8
+	.byte	0x48
+	.byte	0x12
+	.long	0x5b5
+	.uleb128 0x7
+	.long	.LASF1104
+	.byte	0x8
+	.byte	0x49
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF1105
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x12
+	.long	0x5b5
+	.uleb128 0x7
+	.long	.LASF1106
+	.byte	0x8
+	.byte	0x4b
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x1a
+	.long	.LASF1107
+	.value	0x107
+	.long	0x133
+	.uleb128 0x1a
+	.long	.LASF1108
+	.value	0x108
+	.long	0x133
+	.uleb128 0x1a
+	.long	.LASF1109
+	.value	0x109
+	.long	0x133
+	.uleb128 0xf
+	.long	0x286
+	.long	0x626
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1110
+	.value	0x127
+	.byte	0x1e
+	.long	0x616
+	.uleb128 0x1
+	.long	.LASF1111
+	.value	0x128
+	.byte	0x1a
+	.long	0xfb
+	.uleb128 0x1d
+	.long	.LASF1112
+	.byte	0x7
+	.byte	0x3a
+	.byte	0x10
+	.long	0x487
+	.uleb128 0x1d
+	.long	.LASF1113
+	.byte	0x9
+	.byte	0x1b
+	.byte	0xa
+	.long	0xef
+	.uleb128 0x1e
+	.long	.LASF1114
+	.byte	0x2f
+	.long	0xa7
+	.long	0x674
+	.uleb128 0xc
+	.long	0xa7
+	.uleb128 0xc
+	.long	0x674
+	.uleb128 0xc
+	.long	0x111
+	.byte	0
+	.uleb128 0x9
+	.long	0x679
+	.uleb128 0x2a
+	.uleb128 0x1e
+	.long	.LASF1115
+	.byte	0x3d
+	.long	0xa7
+	.long	0x698
+	.uleb128 0xc
+	.long	0xa7
+	.uleb128 0xc
+	.long	0x7c
+	.uleb128 0xc
+	.long	0x111
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1140
+	.value	0x200
+	.long	0x7d3
+	.uleb128 0x1
+	.long	.LASF1116
+	.value	0x203
+	.byte	0x14
+	.long	0x13f
+	.uleb128 0x1
+	.long	.LASF1117
+	.value	0x204
+	.byte	0x1a
+	.long	0x493
+	.uleb128 0x1
+	.long	.LASF1118
+	.value	0x205
+	.byte	0x14
+	.long	0x487
+	.uleb128 0x1
+	.long	.LASF1119
+	.value	0x208
+	.byte	0xe
+	.long	0x133
+	.uleb128 0x1
+	.long	.LASF1120
+	.value	0x212
+	.byte	0xf
+	.long	0x239
+	.uleb128 0x1
+	.long	.LASF1121
+	.value	0x215
+	.byte	0xf
+	.long	0x550
+	.uleb128 0x1
+	.long	.LASF1122
+	.value	0x216
+	.byte	0xe
+	.long	0xde
+	.uleb128 0x1
+	.long	.LASF1123
+	.value	0x219
+	.byte	0xe
+	.long	0xde
+	.uleb128 0x1
+	.long	.LASF1124
+	.value	0x227
+	.byte	0x9
+	.long	0x7d3
+	.uleb128 0x1
+	.long	.LASF1125
+	.value	0x228
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x1
+	.long	.LASF1126
+	.value	0x28b
+	.byte	0x1a
+	.long	0x493
+	.uleb128 0x16
+	.long	0x755
+	.uleb128 0x1
+	.long	.LASF1127
+	.value	0x209
+	.byte	0x1a
+	.long	0x7e3
+	.uleb128 0x6
+	.uleb128 0x1
+	.long	.LASF1072
+	.value	0x20a
+	.byte	0x18
+	.long	0x13f
+	.uleb128 0x6
+	.uleb128 0x1
+	.long	.LASF1128
+	.value	0x20e
+	.byte	0x1c
+	.long	0x13f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x774
+	.uleb128 0x13
+	.string	"ii"
+	.value	0x21b
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x6
+	.uleb128 0x1
+	.long	.LASF1127
+	.value	0x21c
+	.byte	0x13
+	.long	0x550
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	0x79e
+	.uleb128 0x13
+	.string	"pos"
+	.value	0x22d
+	.byte	0x13
+	.long	0x83
+	.uleb128 0x1
+	.long	.LASF1127
+	.value	0x22e
+	.byte	0x13
+	.long	0x550
+	.uleb128 0x1
+	.long	.LASF1129
+	.value	0x23c
+	.byte	0x13
+	.long	0x83
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1
+	.long	.LASF1130
+	.value	0x264
+	.byte	0x1b
+	.long	0x12e
+	.uleb128 0x1
+	.long	.LASF1131
+	.value	0x272
+	.byte	0x12
+	.long	0x133
+	.uleb128 0x1
+	.long	.LASF1132
+	.value	0x279
+	.byte	0x1e
+	.long	0x493
+	.uleb128 0x6
+	.uleb128 0x1
+	.long	.LASF1133
+	.value	0x27f
+	.byte	0x1c
+	.long	0x13f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x7c
+	.long	0x7e3
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xe
+	.byte	0
+	.uleb128 0x9
+	.long	0x45a
+	.uleb128 0x1b
+	.long	.LASF1135
+	.value	0x1ec
+	.byte	0xc
+	.long	0x232
+	.long	0x835
+	.uleb128 0x4
+	.long	.LASF1127
+	.value	0x1ec
+	.byte	0x2c
+	.long	0x7e3
+	.uleb128 0x4
+	.long	.LASF1121
+	.value	0x1ec
+	.byte	0x42
+	.long	0x7e3
+	.uleb128 0x4
+	.long	.LASF1122
+	.value	0x1ec
+	.byte	0x59
+	.long	0xde
+	.uleb128 0x4
+	.long	.LASF1120
+	.value	0x1ec
+	.byte	0x7b
+	.long	0x232
+	.uleb128 0x1
+	.long	.LASF1134
+	.value	0x1ee
+	.byte	0xf
+	.long	0x239
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1136
+	.value	0x1c6
+	.byte	0xc
+	.long	0x232
+	.long	0x886
+	.uleb128 0x4
+	.long	.LASF1127
+	.value	0x1c6
+	.byte	0x2e
+	.long	0x550
+	.uleb128 0x4
+	.long	.LASF1116
+	.value	0x1c6
+	.byte	0x3d
+	.long	0x133
+	.uleb128 0x1
+	.long	.LASF1137
+	.value	0x1cf
+	.byte	0x1a
+	.long	0x493
+	.uleb128 0x6
+	.uleb128 0x1
+	.long	.LASF1138
+	.value	0x1d1
+	.byte	0x1e
+	.long	0x493
+	.uleb128 0x6
+	.uleb128 0x1
+	.long	.LASF1139
+	.value	0x1d8
+	.byte	0x1c
+	.long	0x100
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1201
+	.byte	0x8
+	.value	0x1bb
+	.byte	0x6
+	.uleb128 0x11
+	.long	.LASF1141
+	.value	0x1a4
+	.long	0x8b3
+	.uleb128 0x4
+	.long	.LASF1044
+	.value	0x1a4
+	.byte	0x2e
+	.long	0x30a
+	.uleb128 0x1
+	.long	.LASF1127
+	.value	0x1a9
+	.byte	0xf
+	.long	0x550
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1142
+	.value	0x19f
+	.long	0x8cb
+	.uleb128 0x4
+	.long	.LASF1143
+	.value	0x19f
+	.byte	0x2d
+	.long	0x232
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1148
+	.value	0x194
+	.byte	0xd
+	.long	0x122
+	.long	0x8e8
+	.uleb128 0x4
+	.long	.LASF1044
+	.value	0x194
+	.byte	0x29
+	.long	0x30a
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1144
+	.value	0x188
+	.long	0x91a
+	.uleb128 0x4
+	.long	.LASF1044
+	.value	0x188
+	.byte	0x20
+	.long	0x30a
+	.uleb128 0x4
+	.long	.LASF1145
+	.value	0x188
+	.byte	0x2c
+	.long	0x232
+	.uleb128 0x6
+	.uleb128 0x1
+	.long	.LASF1127
+	.value	0x18b
+	.byte	0x13
+	.long	0x550
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1146
+	.value	0x178
+	.long	0x94a
+	.uleb128 0x4
+	.long	.LASF1044
+	.value	0x178
+	.byte	0x20
+	.long	0x30a
+	.uleb128 0x4
+	.long	.LASF1147
+	.value	0x178
+	.byte	0x31
+	.long	0xef
+	.uleb128 0x1
+	.long	.LASF1127
+	.value	0x17a
+	.byte	0xf
+	.long	0x550
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1149
+	.value	0x160
+	.byte	0x5
+	.long	0x7c
+	.long	0x9d3
+	.uleb128 0x4
+	.long	.LASF1150
+	.value	0x160
+	.byte	0x22
+	.long	0x9d3
+	.uleb128 0x4
+	.long	.LASF1151
+	.value	0x160
+	.byte	0x43
+	.long	0x9d8
+	.uleb128 0x4
+	.long	.LASF1152
+	.value	0x160
+	.byte	0x50
+	.long	0x7c
+	.uleb128 0x13
+	.string	"end"
+	.value	0x162
+	.byte	0x14
+	.long	0x100
+	.uleb128 0x1
+	.long	.LASF1153
+	.value	0x163
+	.byte	0x14
+	.long	0x100
+	.uleb128 0x1
+	.long	.LASF1154
+	.value	0x164
+	.byte	0xe
+	.long	0xef
+	.uleb128 0x1
+	.long	.LASF1091
+	.value	0x168
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x1
+	.long	.LASF1155
+	.value	0x16d
+	.byte	0x14
+	.long	0x100
+	.uleb128 0x1
+	.long	.LASF1156
+	.value	0x16e
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x6
+	.uleb128 0x13
+	.string	"i"
+	.value	0x169
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xef
+	.uleb128 0x9
+	.long	0x286
+	.uleb128 0x2c
+	.long	.LASF1171
+	.byte	0x8
+	.value	0x157
+	.byte	0xa
+	.long	0xef
+	.uleb128 0x17
+	.long	.LASF1157
+	.value	0x152
+	.byte	0x11
+	.long	0xa07
+	.long	0xa07
+	.uleb128 0x4
+	.long	.LASF1044
+	.value	0x152
+	.byte	0x36
+	.long	0x30a
+	.byte	0
+	.uleb128 0x9
+	.long	0xea
+	.uleb128 0x17
+	.long	.LASF1158
+	.value	0x14d
+	.byte	0x11
+	.long	0xa07
+	.long	0xa29
+	.uleb128 0x4
+	.long	.LASF1044
+	.value	0x14d
+	.byte	0x35
+	.long	0x30a
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1160
+	.value	0x13f
+	.long	0xa7d
+	.uleb128 0x4
+	.long	.LASF1127
+	.value	0x13f
+	.byte	0x29
+	.long	0x550
+	.uleb128 0x4
+	.long	.LASF1041
+	.value	0x13f
+	.byte	0x38
+	.long	0x133
+	.uleb128 0x4
+	.long	.LASF1043
+	.value	0x13f
+	.byte	0x4f
+	.long	0x122
+	.uleb128 0x4
+	.long	.LASF1042
+	.value	0x13f
+	.byte	0x62
+	.long	0x133
+	.uleb128 0x1
+	.long	.LASF1150
+	.value	0x144
+	.byte	0x14
+	.long	0x100
+	.uleb128 0x1
+	.long	.LASF1159
+	.value	0x145
+	.byte	0x1c
+	.long	0x9d8
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1161
+	.value	0x133
+	.long	0xab9
+	.uleb128 0x4
+	.long	.LASF1162
+	.value	0x133
+	.byte	0x24
+	.long	0xab9
+	.uleb128 0x4
+	.long	.LASF1163
+	.value	0x133
+	.byte	0x3b
+	.long	0x122
+	.uleb128 0x1
+	.long	.LASF1164
+	.value	0x135
+	.byte	0x13
+	.long	0xd9
+	.uleb128 0x6
+	.uleb128 0x13
+	.string	"i"
+	.value	0x138
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xde
+	.uleb128 0x1b
+	.long	.LASF1165
+	.value	0x12a
+	.byte	0x10
+	.long	0xcd
+	.long	0xae7
+	.uleb128 0x4
+	.long	.LASF1163
+	.value	0x12a
+	.byte	0x2c
+	.long	0x122
+	.uleb128 0x1
+	.long	.LASF1164
+	.value	0x12f
+	.byte	0xf
+	.long	0x83
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1166
+	.value	0x112
+	.long	0xb0b
+	.uleb128 0x4
+	.long	.LASF1044
+	.value	0x112
+	.byte	0x1d
+	.long	0x30a
+	.uleb128 0x4
+	.long	.LASF1167
+	.value	0x112
+	.byte	0x34
+	.long	0xb0b
+	.byte	0
+	.uleb128 0x9
+	.long	0x23e
+	.uleb128 0x11
+	.long	.LASF1168
+	.value	0x10b
+	.long	0xb28
+	.uleb128 0x4
+	.long	.LASF1169
+	.value	0x10b
+	.byte	0x2a
+	.long	0xb28
+	.byte	0
+	.uleb128 0x9
+	.long	0x1a9
+	.uleb128 0x20
+	.long	.LASF1170
+	.byte	0xf9
+	.long	0xb44
+	.uleb128 0x8
+	.long	.LASF1116
+	.byte	0x8
+	.byte	0xf9
+	.byte	0x1a
+	.long	0x133
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1172
+	.byte	0xf4
+	.long	0x550
+	.uleb128 0x21
+	.long	.LASF1173
+	.byte	0xeb
+	.long	0x550
+	.uleb128 0x1c
+	.long	.LASF1174
+	.byte	0xd8
+	.long	0x232
+	.long	0xb80
+	.uleb128 0x8
+	.long	.LASF1127
+	.byte	0x8
+	.byte	0xd8
+	.byte	0x1b
+	.long	0x550
+	.uleb128 0x6
+	.uleb128 0xe
+	.string	"ii"
+	.byte	0x8
+	.byte	0xda
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1175
+	.byte	0xc4
+	.long	0x232
+	.long	0xba8
+	.uleb128 0x8
+	.long	.LASF1127
+	.byte	0x8
+	.byte	0xc4
+	.byte	0x18
+	.long	0x550
+	.uleb128 0x6
+	.uleb128 0xe
+	.string	"ii"
+	.byte	0x8
+	.byte	0xc9
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1176
+	.byte	0xba
+	.long	0x232
+	.long	0xbd0
+	.uleb128 0x8
+	.long	.LASF1127
+	.byte	0x8
+	.byte	0xba
+	.byte	0x1d
+	.long	0x550
+	.uleb128 0x6
+	.uleb128 0xe
+	.string	"ii"
+	.byte	0x8
+	.byte	0xbc
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1177
+	.byte	0xac
+	.long	0xbe8
+	.uleb128 0x6
+	.uleb128 0xe
+	.string	"ii"
+	.byte	0x8
+	.byte	0xb2
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1178
+	.byte	0xa4
+	.long	0xc00
+	.uleb128 0x6
+	.uleb128 0xe
+	.string	"ii"
+	.byte	0x8
+	.byte	0xa6
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1179
+	.byte	0x8f
+	.long	0xc42
+	.uleb128 0x8
+	.long	.LASF1127
+	.byte	0x8
+	.byte	0x8f
+	.byte	0x2d
+	.long	0x550
+	.uleb128 0x16
+	.long	0xc27
+	.uleb128 0xe
+	.string	"ii"
+	.byte	0x8
+	.byte	0x92
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xe
+	.string	"pos"
+	.byte	0x8
+	.byte	0x99
+	.byte	0x13
+	.long	0x83
+	.uleb128 0x7
+	.long	.LASF1180
+	.byte	0x8
+	.byte	0x9a
+	.byte	0x13
+	.long	0x550
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1181
+	.byte	0x83
+	.long	0xc59
+	.uleb128 0x8
+	.long	.LASF1127
+	.byte	0x8
+	.byte	0x83
+	.byte	0x2b
+	.long	0x550
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1182
+	.byte	0x7a
+	.long	0xc70
+	.uleb128 0x8
+	.long	.LASF1127
+	.byte	0x8
+	.byte	0x7a
+	.byte	0x2b
+	.long	0x550
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1183
+	.byte	0x66
+	.long	0xca1
+	.uleb128 0xd
+	.string	"pos"
+	.byte	0x8
+	.byte	0x66
+	.byte	0x27
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF1127
+	.byte	0x8
+	.byte	0x68
+	.byte	0xf
+	.long	0x550
+	.uleb128 0x6
+	.uleb128 0x7
+	.long	.LASF1129
+	.byte	0x8
+	.byte	0x6a
+	.byte	0xd
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1184
+	.byte	0x58
+	.long	0xcd2
+	.uleb128 0xd
+	.string	"pos"
+	.byte	0x8
+	.byte	0x58
+	.byte	0x25
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF1127
+	.byte	0x8
+	.byte	0x5a
+	.byte	0xf
+	.long	0x550
+	.uleb128 0x6
+	.uleb128 0x7
+	.long	.LASF1185
+	.byte	0x8
+	.byte	0x5c
+	.byte	0x13
+	.long	0x83
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1186
+	.byte	0x52
+	.long	0xcf5
+	.uleb128 0xd
+	.string	"pos"
+	.byte	0x8
+	.byte	0x52
+	.byte	0x22
+	.long	0x7c
+	.uleb128 0x8
+	.long	.LASF1127
+	.byte	0x8
+	.byte	0x52
+	.byte	0x31
+	.long	0x550
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1187
+	.byte	0x8
+	.byte	0x4d
+	.byte	0xc
+	.long	0x232
+	.long	0xd1a
+	.uleb128 0xd
+	.string	"a"
+	.byte	0x8
+	.byte	0x4d
+	.byte	0x2b
+	.long	0x7e3
+	.uleb128 0xd
+	.string	"b"
+	.byte	0x8
+	.byte	0x4d
+	.byte	0x3e
+	.long	0x7e3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1188
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x11
+	.long	0xde
+	.long	0xd43
+	.uleb128 0x8
+	.long	.LASF1189
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x29
+	.long	0x133
+	.uleb128 0x8
+	.long	.LASF1190
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x40
+	.long	0x122
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1191
+	.byte	0xb
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.long	0xd78
+	.uleb128 0xd
+	.string	"amt"
+	.byte	0xb
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0xd
+	.string	"low"
+	.byte	0xb
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0x8
+	.long	.LASF1192
+	.byte	0xb
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1193
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x18
+	.long	0xef
+	.long	0xd95
+	.uleb128 0x8
+	.long	.LASF1194
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x38
+	.long	0x487
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1195
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x1e
+	.long	0x487
+	.long	0xdd4
+	.uleb128 0x8
+	.long	.LASF1196
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x3b
+	.long	0x4d4
+	.uleb128 0x8
+	.long	.LASF1197
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x51
+	.long	0x487
+	.uleb128 0x7
+	.long	.LASF1194
+	.byte	0x7
+	.byte	0x51
+	.byte	0x1a
+	.long	0x493
+	.uleb128 0xe
+	.string	"p"
+	.byte	0x7
+	.byte	0x53
+	.byte	0x15
+	.long	0xdd4
+	.byte	0
+	.uleb128 0x9
+	.long	0x515
+	.uleb128 0x2d
+	.long	.LASF1198
+	.byte	0x5
+	.byte	0x25
+	.byte	0x1b
+	.long	0x122
+	.uleb128 0xd
+	.string	"a"
+	.byte	0x5
+	.byte	0x25
+	.byte	0x2e
+	.long	0x133
+	.uleb128 0xd
+	.string	"b"
+	.byte	0x5
+	.byte	0x25
+	.byte	0x3a
+	.long	0x133
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF399
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF407
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF486
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF561
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF579
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF602
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF486
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF662
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF667
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF763
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF790
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 30 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 33 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 34 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x22
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF949
+	.byte	0x4
+	.byte	0x4
+	.file 35 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF955
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 36 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF998
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF404
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF406
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF480
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF482
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF485
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF498
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF499
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF546
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF560
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF587
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF595
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF597
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF599
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF601
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF617
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF661
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF665
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF762
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF406
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF591
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF593
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF595
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF597
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF599
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF601
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF785
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF787
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF788
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF785
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF788
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF838
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF852
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF787
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF871
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF799
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF917
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF927
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF948
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF954
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.50.10d0067a73777b2d14d79db5df156f88,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.profile.h.48.b5d3bdbbb4f3d375ccee68ec649323aa,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF961
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF978
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF997
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF1202
+	.long	.LASF1203
+	.long	.LASF1204
+	.long	.LASF1205
+	.long	.LASF1206
+	.long	.LASF1207
+	.long	.LASF1208
+	.long	.LASF1209
+	.long	.LASF1210
+	.long	.LASF1211
+	.long	.LASF1212
+	.long	.LASF1213
+	.long	.LASF1214
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x25
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1215
+	.byte	0x9
+	.long	.LASF1216
+	.byte	0x9
+	.long	.LASF1217
+	.byte	0x9
+	.long	.LASF1218
+	.byte	0xd
+	.long	.LASF1219
+	.byte	0x2
+	.long	.LASF1220
+	.byte	0x4
+	.long	.LASF1221
+	.byte	0x1
+	.long	.LASF1222
+	.byte	0x4
+	.long	.LASF1223
+	.byte	0x3
+	.long	.LASF1224
+	.byte	0xc
+	.long	.LASF1225
+	.byte	0x2
+	.long	.LASF1226
+	.byte	0xc
+	.long	.LASF1227
+	.byte	0xd
+	.long	.LASF1228
+	.byte	0xd
+	.long	.LASF1228
+	.byte	0xc
+	.long	.LASF1229
+	.byte	0x9
+	.long	.LASF1230
+	.byte	0xc
+	.long	.LASF1231
+	.byte	0xc
+	.long	.LASF1232
+	.byte	0x9
+	.long	.LASF1233
+	.byte	0x9
+	.long	.LASF1234
+	.byte	0xb
+	.long	.LASF1235
+	.byte	0x9
+	.long	.LASF1236
+	.byte	0xa
+	.long	.LASF1237
+	.byte	0xa
+	.long	.LASF1238
+	.byte	0x9
+	.long	.LASF1239
+	.byte	0x9
+	.long	.LASF1240
+	.byte	0x9
+	.long	.LASF1241
+	.byte	0x8
+	.long	.LASF1242
+	.byte	0x8
+	.long	.LASF1243
+	.byte	0xc
+	.long	.LASF1244
+	.byte	0x7
+	.long	.LASF1245
+	.byte	0x6
+	.long	.LASF1246
+	.byte	0x5
+	.long	.LASF1247
+	.byte	0x6
+	.long	.LASF1248
+	.byte	0x1
+	.long	.LASF1249
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF675:
+	.string	"INT32_MAX (2147483647)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF617:
+	.string	"__STD_TYPE typedef"
+.LASF817:
+	.string	"TELEMETRY_HOTT "
+.LASF1013:
+	.string	"int8_t"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF814:
+	.string	"LED_STRIP "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1123:
+	.string	"waitingTasks"
+.LASF1019:
+	.string	"size_t"
+.LASF1044:
+	.string	"taskId"
+.LASF465:
+	.string	"__USE_ISOC11 1"
+.LASF655:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF959:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1058:
+	.string	"TASK_ALTITUDE"
+.LASF1057:
+	.string	"TASK_BARO"
+.LASF787:
+	.string	"NULL ((void *)0)"
+.LASF1090:
+	.string	"profileProbe_e"
+.LASF1129:
+	.string	"child"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF919:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1061:
+	.string	"TASK_COUNT"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF423:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF548:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF794:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1118:
+	.string	"taskTicks"
+.LASF435:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF523:
+	.string	"__flexarr []"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1134:
+	.string	"taskCanBeChosenForScheduling"
+.LASF721:
+	.string	"INT16_C(c) c"
+.LASF1014:
+	.string	"int32_t"
+.LASF752:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1038:
+	.string	"latestDeltaTime"
+.LASF494:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1101:
+	.string	"taskQueueSize"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF876:
+	.string	"U_ID_0 0"
+.LASF714:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF490:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF711:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF888:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF953:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF871:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF948:
+	.string	"__enable_irq() "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF894:
+	.string	"USE_UART7 "
+.LASF1026:
+	.string	"TASK_PRIORITY_HIGH"
+.LASF941:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1086:
+	.string	"PROFILE_CHECK_FUNC"
+.LASF734:
+	.string	"INT32_WIDTH 32"
+.LASF736:
+	.string	"INT64_WIDTH 64"
+.LASF537:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1109:
+	.string	"checkFuncMovingSumExecutionTime"
+.LASF853:
+	.string	"__wchar_t__ "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF662:
+	.string	"__STD_TYPE"
+.LASF934:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF700:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF510:
+	.string	"__P(args) args"
+.LASF636:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1124:
+	.string	"dueStack"
+.LASF768:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF995:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF630:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1137:
+	.string	"checkFuncStartTicks"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF810:
+	.string	"USE_SERIALRX_SUMD "
+.LASF870:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF838:
+	.string	"VTX_TRAMP "
+.LASF1187:
+	.string	"deadlineBefore"
+.LASF496:
+	.string	"__GLIBC__ 2"
+.LASF455:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF704:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF847:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF429:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF669:
+	.string	"INT8_MIN (-128)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1198:
+	.string	"cmpTimeUs"
+.LASF614:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1148:
+	.string	"getTaskDeltaTime"
+.LASF498:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF827:
+	.string	"TELEMETRY_MAVLINK "
+.LASF443:
+	.string	"_ISOC99_SOURCE 1"
+.LASF525:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF772:
+	.string	"_T_SIZE "
+.LASF575:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF678:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF699:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF411:
+	.string	"__USE_ISOC95"
+.LASF932:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF426:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF790:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF954:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF413:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF877:
+	.string	"U_ID_1 1"
+.LASF520:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1041:
+	.string	"startedAt"
+.LASF837:
+	.string	"VTX_SMARTAUDIO "
+.LASF904:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1106:
+	.string	"eventTaskCount"
+.LASF1161:
+	.string	"histogramAdd"
+.LASF716:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF582:
+	.string	"__stub_fchflags "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF839:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF639:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF803:
+	.string	"USE_PPM "
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF437:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF417:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF422:
+	.string	"__USE_XOPEN2K8"
+.LASF1168:
+	.string	"getCheckFuncInfo"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF547:
+	.string	"__always_inline"
+.LASF770:
+	.string	"_SYS_SIZE_T_H "
+.LASF807:
+	.string	"USE_SERIALRX_IBUS "
+.LASF821:
+	.string	"USE_SERVOS "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF433:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF671:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1080:
+	.string	"averageSystemLoadPercent"
+.LASF943:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1010:
+	.string	"long int"
+.LASF916:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1114:
+	.string	"memmove"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF991:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF438:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF473:
+	.string	"__USE_XOPEN2K8 1"
+.LASF645:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1096:
+	.string	"float"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF974:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF846:
+	.string	"_PTRDIFF_T_ "
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF952:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1097:
+	.string	"currentTask"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF659:
+	.string	"__FD_SETSIZE 1024"
+.LASF1170:
+	.string	"taskSystem"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF980:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF644:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF892:
+	.string	"USE_UART5 "
+.LASF1082:
+	.string	"PROFILE_GYRO_UPDATE"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF706:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1000:
+	.string	"short unsigned int"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF544:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF920:
+	.string	"VTX_COMMON"
+.LASF528:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF512:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF761:
+	.string	"WCHAR_WIDTH 32"
+.LASF907:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1121:
+	.string	"selectedTask"
+.LASF968:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF451:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF961:
+	.string	"PROFILE_TICKS_PER_US 1000"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF900:
+	.string	"SERIAL_RX"
+.LASF946:
+	.string	"EEPROM_SIZE 32768"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF533:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF713:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF815:
+	.string	"TELEMETRY "
+.LASF792:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1102:
+	.string	"taskQueueArray"
+.LASF1192:
+	.string	"high"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1160:
+	.string	"schedulerTraceAdd"
+.LASF1077:
+	.string	"executionHistogram"
+.LASF977:
+	.string	"Q12 (1 << 12)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1055:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF949:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF782:
+	.string	"_GCC_SIZE_T "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1113:
+	.string	"micros"
+.LASF745:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF641:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF589:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF963:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF493:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF503:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1003:
+	.string	"signed char"
+.LASF737:
+	.string	"UINT64_WIDTH 64"
+.LASF1015:
+	.string	"uint8_t"
+.LASF585:
+	.string	"__stub_setlogin "
+.LASF635:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1068:
+	.string	"taskAgeCycles"
+.LASF604:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF514:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF895:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF619:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1028:
+	.string	"TASK_PRIORITY_MAX"
+.LASF883:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF830:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF914:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1030:
+	.string	"totalExecutionTime"
+.LASF637:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1045:
+	.string	"schedulerTraceEntry_t"
+.LASF999:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF466:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF511:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF691:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1060:
+	.string	"TASK_MSP_PUSH"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1031:
+	.string	"averageExecutionTime"
+.LASF780:
+	.string	"__DEFINED_size_t "
+.LASF602:
+	.string	"_BITS_TYPES_H 1"
+.LASF917:
+	.string	"TELEMETRY_IBUS"
+.LASF1024:
+	.string	"TASK_PRIORITY_MEDIUM"
+.LASF481:
+	.string	"__USE_LARGEFILE 1"
+.LASF789:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF762:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF890:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1016:
+	.string	"uint16_t"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF670:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF979:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1039:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF555:
+	.string	"__restrict_arr __restrict"
+.LASF580:
+	.string	"__stub___compat_bdflush "
+.LASF1103:
+	.string	"deadlineQueueArray"
+.LASF786:
+	.string	"NULL"
+.LASF809:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF646:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1191:
+	.string	"constrain"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF686:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1188:
+	.string	"periodsElapsed"
+.LASF534:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF684:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF622:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF753:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF972:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1032:
+	.string	"cfCheckFuncInfo_t"
+.LASF908:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF607:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF629:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF432:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1099:
+	.string	"totalWaitingTasksSamples"
+.LASF552:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1104:
+	.string	"deadlineQueueSize"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF928:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF763:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1007:
+	.string	"__uint16_t"
+.LASF985:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1029:
+	.string	"maxExecutionTime"
+.LASF933:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF420:
+	.string	"__USE_XOPEN2K"
+.LASF661:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1201:
+	.string	"schedulerInit"
+.LASF421:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF823:
+	.string	"CMS "
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF836:
+	.string	"VTX_CONTROL "
+.LASF982:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF550:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1088:
+	.string	"PROFILE_TASK_FIRST"
+.LASF453:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF938:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF767:
+	.string	"__size_t__ "
+.LASF470:
+	.string	"__USE_POSIX199309 1"
+.LASF996:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF697:
+	.string	"INT_FAST8_MAX (127)"
+.LASF685:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF612:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF758:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF726:
+	.string	"UINT32_C(c) c ## U"
+.LASF705:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF415:
+	.string	"__USE_POSIX199309"
+.LASF676:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1095:
+	.string	"profileProbes"
+.LASF921:
+	.string	"VTX_CONTROL"
+.LASF1027:
+	.string	"TASK_PRIORITY_REALTIME"
+.LASF497:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF419:
+	.string	"__USE_UNIX98"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF436:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF872:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1173:
+	.string	"queueFirst"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF1157:
+	.string	"getTaskExecutionHistogram"
+.LASF660:
+	.string	"_BITS_TIME64_H 1"
+.LASF623:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF799:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF903:
+	.string	"USE_SERIALRX_SBUS"
+.LASF608:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF785:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF653:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF808:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF765:
+	.string	"__need_size_t "
+.LASF783:
+	.string	"_SIZET_ "
+.LASF693:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF891:
+	.string	"USE_UART4 "
+.LASF519:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF446:
+	.string	"_ISOC2X_SOURCE"
+.LASF937:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF561:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF401:
+	.string	"bool _Bool"
+.LASF1127:
+	.string	"task"
+.LASF984:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1005:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF860:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF702:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF797:
+	.string	"I2C1_OVERCLOCK true"
+.LASF875:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF532:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1131:
+	.string	"taskStartedAt"
+.LASF526:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1138:
+	.string	"checkFuncTicks"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF905:
+	.string	"USE_SERIALRX_SUMD"
+.LASF703:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF634:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1185:
+	.string	"parent"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1056:
+	.string	"TASK_COMPASS"
+.LASF925:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1004:
+	.string	"__int8_t"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF983:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF878:
+	.string	"U_ID_2 2"
+.LASF880:
+	.string	"GYRO "
+.LASF542:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1182:
+	.string	"deadlineQueueUpdate"
+.LASF553:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF471:
+	.string	"__USE_POSIX199506 1"
+.LASF735:
+	.string	"UINT32_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF460:
+	.string	"_ATFILE_SOURCE"
+.LASF601:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF718:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF407:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF994:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF409:
+	.string	"__USE_ISOC11"
+.LASF485:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF834:
+	.string	"USE_SENSOR_NAMES "
+.LASF665:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF739:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF667:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1145:
+	.string	"enabled"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1092:
+	.string	"maxTicks"
+.LASF1172:
+	.string	"queueNext"
+.LASF1100:
+	.string	"calculateTaskStatistics"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF741:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF742:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF482:
+	.string	"__USE_LARGEFILE64 1"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF709:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF748:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1049:
+	.string	"TASK_ATTITUDE"
+.LASF677:
+	.string	"UINT8_MAX (255)"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1107:
+	.string	"checkFuncMaxExecutionTime"
+.LASF724:
+	.string	"UINT8_C(c) c"
+.LASF1183:
+	.string	"deadlineQueueSiftDown"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF448:
+	.string	"_POSIX_SOURCE"
+.LASF944:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF467:
+	.string	"__USE_ISOC95 1"
+.LASF695:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF571:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF771:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1110:
+	.string	"traceRing"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF749:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF942:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF801:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF524:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF440:
+	.string	"_ISOC95_SOURCE"
+.LASF1116:
+	.string	"currentTimeUs"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF981:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1196:
+	.string	"probe"
+.LASF1128:
+	.string	"newTimeInterval"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF506:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1020:
+	.string	"timeDelta_t"
+.LASF766:
+	.string	"__need_NULL "
+.LASF408:
+	.string	"_FEATURES_H 1"
+.LASF459:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF638:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF966:
+	.string	"VERY_FAST_MATH "
+.LASF504:
+	.string	"__LEAF , __leaf__"
+.LASF424:
+	.string	"__USE_LARGEFILE"
+.LASF833:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF536:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF750:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF640:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF879:
+	.string	"LED0_PIN NONE"
+.LASF1125:
+	.string	"dueStackSize"
+.LASF1071:
+	.string	"lastSignaledAt"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF618:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF997:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1074:
+	.string	"taskQueuePos"
+.LASF896:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF848:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF476:
+	.string	"__USE_UNIX98 1"
+.LASF654:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE"
+.LASF543:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF755:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF955:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF843:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1120:
+	.string	"outsideRealtimeGuardInterval"
+.LASF428:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF912:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF978:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF666:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1194:
+	.string	"ticks"
+.LASF909:
+	.string	"LED_STRIP"
+.LASF1034:
+	.string	"subTaskName"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF475:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF852:
+	.string	"__need_ptrdiff_t"
+.LASF800:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF856:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF899:
+	.string	"USE_PWM"
+.LASF564:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF414:
+	.string	"__USE_POSIX2"
+.LASF1132:
+	.string	"taskStartTicks"
+.LASF945:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1009:
+	.string	"__uint32_t"
+.LASF738:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF774:
+	.string	"_SIZE_T_ "
+.LASF489:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF1078:
+	.string	"cfTask_t"
+.LASF759:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF1070:
+	.string	"lastExecutedAt"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1149:
+	.string	"schedulerTraceRead"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF578:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF405:
+	.string	"_STDINT_H 1"
+.LASF1174:
+	.string	"queueRemove"
+.LASF924:
+	.string	"BLACKBOX"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF708:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF559:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1063:
+	.string	"TASK_SELF"
+.LASF858:
+	.string	"__WCHAR_T "
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF812:
+	.string	"USE_SERIALRX_XBUS "
+.LASF773:
+	.string	"__SIZE_T "
+.LASF509:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF452:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1046:
+	.string	"TASK_SYSTEM"
+.LASF1053:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF1067:
+	.string	"dynamicPriority"
+.LASF540:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF558:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF500:
+	.string	"__PMT"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF897:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF973:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1043:
+	.string	"lateness"
+.LASF696:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF461:
+	.string	"_ATFILE_SOURCE 1"
+.LASF609:
+	.string	"__SQUAD_TYPE long int"
+.LASF906:
+	.string	"USE_SERIALRX_SUMH"
+.LASF616:
+	.string	"__U64_TYPE unsigned long int"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF730:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1023:
+	.string	"TASK_PRIORITY_LOW"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF431:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1135:
+	.string	"taskIsPreferred"
+.LASF841:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1091:
+	.string	"count"
+.LASF969:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF820:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1037:
+	.string	"desiredPeriod"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF570:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1139:
+	.string	"checkFuncExecutionTime"
+.LASF1165:
+	.string	"histogramBucket"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1089:
+	.string	"PROFILE_PROBE_COUNT"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1001:
+	.string	"unsigned int"
+.LASF664:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF733:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF501:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1040:
+	.string	"cfTaskInfo_t"
+.LASF1112:
+	.string	"profileTicks"
+.LASF1079:
+	.string	"cfTasks"
+.LASF427:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF400:
+	.string	"_STDBOOL_H "
+.LASF867:
+	.string	"_WCHAR_T_DECLARED "
+.LASF819:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF472:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF647:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF606:
+	.string	"__U32_TYPE unsigned int"
+.LASF844:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF531:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF990:
+	.string	"BIT(x) (1 << (x))"
+.LASF842:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1098:
+	.string	"totalWaitingTasks"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF535:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF463:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF557:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF583:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF688:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF643:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF681:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF950:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF805:
+	.string	"SERIAL_RX "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF828:
+	.string	"TELEMETRY_SRXL "
+.LASF546:
+	.string	"__wur "
+.LASF479:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF910:
+	.string	"TELEMETRY_FRSKY"
+.LASF403:
+	.string	"false 0"
+.LASF1150:
+	.string	"sequence"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF731:
+	.string	"UINT8_WIDTH 8"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF720:
+	.string	"INT8_C(c) c"
+.LASF402:
+	.string	"true 1"
+.LASF1065:
+	.string	"checkFunc"
+.LASF522:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF658:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF495:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1073:
+	.string	"deadlineQueuePos"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1064:
+	.string	"cfTaskId_e"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF962:
+	.string	"sq(x) ((x)*(x))"
+.LASF1076:
+	.string	"latenessHistogram"
+.LASF507:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF563:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF562:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF513:
+	.string	"__STRING(x) #x"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1047:
+	.string	"TASK_GYROPID"
+.LASF560:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF850:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF964:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF656:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF788:
+	.string	"__need_NULL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF781:
+	.string	"___int_size_t_h "
+.LASF740:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF855:
+	.string	"_WCHAR_T "
+.LASF886:
+	.string	"MAG "
+.LASF1189:
+	.string	"elapsedUs"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1069:
+	.string	"taskLatestDeltaTime"
+.LASF1021:
+	.string	"timeUs_t"
+.LASF885:
+	.string	"USE_FAKE_BARO "
+.LASF778:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF849:
+	.string	"_GCC_PTRDIFF_T "
+.LASF584:
+	.string	"__stub_revoke "
+.LASF791:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF567:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1012:
+	.string	"char"
+.LASF508:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF569:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF769:
+	.string	"_SIZE_T "
+.LASF863:
+	.string	"_WCHAR_T_H "
+.LASF1051:
+	.string	"TASK_SERIAL"
+.LASF683:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF887:
+	.string	"USE_FAKE_MAG "
+.LASF923:
+	.string	"VTX_TRAMP"
+.LASF1142:
+	.string	"schedulerSetCalulateTaskStatistics"
+.LASF631:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF840:
+	.string	"_STDDEF_H_ "
+.LASF926:
+	.string	"USE_SERVOS"
+.LASF806:
+	.string	"USE_SERIALRX_CRSF "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF760:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF813:
+	.string	"BLACKBOX "
+.LASF831:
+	.string	"USE_MSP_PUSH "
+.LASF486:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1025:
+	.string	"TASK_PRIORITY_MEDIUM_HIGH"
+.LASF1152:
+	.string	"maxEntries"
+.LASF947:
+	.string	"__disable_irq() "
+.LASF902:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1035:
+	.string	"isEnabled"
+.LASF1199:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF410:
+	.string	"__USE_ISOC99"
+.LASF1159:
+	.string	"entry"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1147:
+	.string	"newPeriodMicros"
+.LASF418:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF915:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF976:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF515:
+	.string	"__BEGIN_DECLS "
+.LASF866:
+	.string	"_GCC_WCHAR_T "
+.LASF692:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1155:
+	.string	"overwritten"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF668:
+	.string	"__intptr_t_defined "
+.LASF474:
+	.string	"__USE_XOPEN 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF628:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF825:
+	.string	"TELEMETRY_IBUS "
+.LASF998:
+	.string	"MOVING_SUM_COUNT 32"
+.LASF992:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF862:
+	.string	"_WCHAR_T_DEFINED "
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF393:
+	.string	"SITL 1"
+.LASF441:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF412:
+	.string	"__USE_ISOCXX11"
+.LASF1054:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF777:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1011:
+	.string	"__uint64_t"
+.LASF1081:
+	.string	"profileTicks_t"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF845:
+	.string	"__PTRDIFF_T "
+.LASF1087:
+	.string	"PROFILE_SCHEDULER"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF689:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1002:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1176:
+	.string	"queueContains"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF881:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF539:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF416:
+	.string	"__USE_POSIX199506"
+.LASF746:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF722:
+	.string	"INT32_C(c) c"
+.LASF960:
+	.string	"PROFILE_TASK(taskId) ((profileProbe_e)(PROFILE_TASK_FIRST + (taskId)))"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF727:
+	.string	"UINT64_C(c) c ## UL"
+.LASF882:
+	.string	"ACC "
+.LASF650:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1022:
+	.string	"TASK_PRIORITY_IDLE"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF901:
+	.string	"USE_SERIALRX_CRSF"
+.LASF483:
+	.string	"__WORDSIZE 64"
+.LASF784:
+	.string	"__size_t "
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1175:
+	.string	"queueAdd"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF587:
+	.string	"__stub_stty "
+.LASF818:
+	.string	"TELEMETRY_LTM "
+.LASF1163:
+	.string	"timeUs"
+.LASF918:
+	.string	"USE_DASHBOARD"
+.LASF521:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF615:
+	.string	"__S64_TYPE long int"
+.LASF574:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF775:
+	.string	"_BSD_SIZE_T_ "
+.LASF518:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1184:
+	.string	"deadlineQueueSiftUp"
+.LASF729:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1115:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1190:
+	.string	"period"
+.LASF857:
+	.string	"_T_WCHAR "
+.LASF1133:
+	.string	"taskExecutionTime"
+.LASF605:
+	.string	"__S32_TYPE int"
+.LASF679:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1075:
+	.string	"movingSumExecutionTime"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF632:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF717:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF764:
+	.string	"_STRING_H 1"
+.LASF663:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1119:
+	.string	"timeToNextRealtimeTask"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF723:
+	.string	"INT64_C(c) c ## L"
+.LASF488:
+	.string	"__USE_ATFILE 1"
+.LASF1059:
+	.string	"TASK_TELEMETRY"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1062:
+	.string	"TASK_NONE"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF859:
+	.string	"_WCHAR_T_ "
+.LASF832:
+	.string	"USE_RX_MSP "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1085:
+	.string	"PROFILE_HANDLE_BLACKBOX"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF965:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF861:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1042:
+	.string	"executionTime"
+.LASF796:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1048:
+	.string	"TASK_ACCEL"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1167:
+	.string	"taskInfo"
+.LASF581:
+	.string	"__stub_chflags "
+.LASF1177:
+	.string	"queueClear"
+.LASF430:
+	.string	"__USE_GNU"
+.LASF804:
+	.string	"USE_PWM "
+.LASF1200:
+	.string	"profileProbe_s"
+.LASF1094:
+	.string	"profileProbe_t"
+.LASF649:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF893:
+	.string	"USE_UART6 "
+.LASF1130:
+	.string	"taskLateness"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF822:
+	.string	"GPS "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF798:
+	.string	"I2C2_OVERCLOCK true"
+.LASF957:
+	.string	"SCHEDULER_TRACE_SIZE 64"
+.LASF573:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF642:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF568:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF898:
+	.string	"USE_PPM"
+.LASF551:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF399:
+	.string	"SRC_MAIN_SCHEDULER_C_ "
+.LASF444:
+	.string	"_ISOC11_SOURCE"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF835:
+	.string	"VTX_COMMON "
+.LASF1162:
+	.string	"histogram"
+.LASF1179:
+	.string	"schedulerQueueRemoved"
+.LASF541:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF715:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF701:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF516:
+	.string	"__END_DECLS "
+.LASF1169:
+	.string	"checkFuncInfo"
+.LASF743:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1140:
+	.string	"scheduler"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1197:
+	.string	"startTicks"
+.LASF1144:
+	.string	"setTaskEnabled"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF956:
+	.string	"SCHEDULER_HISTOGRAM_BUCKETS 16"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF936:
+	.string	"USED_TIMERS 0"
+.LASF1178:
+	.string	"schedulerQueueRenumber"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1006:
+	.string	"short int"
+.LASF499:
+	.string	"_SYS_CDEFS_H 1"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1018:
+	.string	"uint64_t"
+.LASF1143:
+	.string	"calculateTaskStatisticsToUse"
+.LASF439:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF554:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF673:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1166:
+	.string	"getTaskInfo"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF529:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF975:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF744:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF829:
+	.string	"USE_DASHBOARD "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1117:
+	.string	"schedulerStartTicks"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF566:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1154:
+	.string	"start"
+.LASF884:
+	.string	"BARO "
+.LASF610:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1093:
+	.string	"totalTicks"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF586:
+	.string	"__stub_sigreturn "
+.LASF577:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF648:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF527:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF627:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1156:
+	.string	"dropped"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF530:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF611:
+	.string	"__SWORD_TYPE long int"
+.LASF854:
+	.string	"__WCHAR_T__ "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1164:
+	.string	"bucket"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF538:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1111:
+	.string	"traceSequence"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF624:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF468:
+	.string	"__USE_POSIX 1"
+.LASF710:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF707:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1171:
+	.string	"schedulerTraceSequence"
+.LASF1084:
+	.string	"PROFILE_MIX_TABLE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF576:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF868:
+	.string	"__DEFINED_wchar_t "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF989:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF725:
+	.string	"UINT16_C(c) c"
+.LASF457:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF802:
+	.string	"USE_CLI "
+.LASF478:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF603:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF719:
+	.string	"WINT_MAX (4294967295u)"
+.LASF824:
+	.string	"TELEMETRY_CRSF "
+.LASF680:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF545:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF549:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF864:
+	.string	"___int_wchar_t_h "
+.LASF993:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF747:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF929:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1186:
+	.string	"deadlineQueueSet"
+.LASF565:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF779:
+	.string	"_SIZE_T_DECLARED "
+.LASF970:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF672:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF621:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1146:
+	.string	"rescheduleTask"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF951:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF889:
+	.string	"USE_UART2 "
+.LASF1083:
+	.string	"PROFILE_PID_CONTROLLER"
+.LASF1141:
+	.string	"schedulerResetTaskStatistics"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF869:
+	.string	"_BSD_WCHAR_T_"
+.LASF687:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF757:
+	.string	"UINTMAX_WIDTH 64"
+.LASF652:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1017:
+	.string	"uint32_t"
+.LASF464:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1153:
+	.string	"held"
+.LASF682:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF988:
+	.string	"UNUSED(x) (void)(x)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF447:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF694:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1033:
+	.string	"taskName"
+.LASF517:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF449:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF469:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF633:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF865:
+	.string	"__INT_WCHAR_T_H "
+.LASF572:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF756:
+	.string	"INTMAX_WIDTH 64"
+.LASF674:
+	.string	"INT16_MAX (32767)"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF625:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF480:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF484:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1105:
+	.string	"eventTaskArray"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF939:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF795:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF967:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF922:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF502:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF445:
+	.string	"_ISOC11_SOURCE 1"
+.LASF1195:
+	.string	"profileRecord"
+.LASF1066:
+	.string	"taskFunc"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF698:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF931:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF613:
+	.string	"__SLONG32_TYPE int"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF491:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF751:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF986:
+	.string	"EXPAND_I(x) x"
+.LASF1136:
+	.string	"updateEventTaskPriority"
+.LASF487:
+	.string	"__USE_MISC 1"
+.LASF404:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1122:
+	.string	"selectedTaskDynamicPriority"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1151:
+	.string	"entries"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF754:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1108:
+	.string	"checkFuncTotalExecutionTime"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF826:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF811:
+	.string	"USE_SERIALRX_SUMH "
+.LASF851:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF971:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1008:
+	.string	"__int32_t"
+.LASF579:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF505:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF911:
+	.string	"TELEMETRY_HOTT"
+.LASF1072:
+	.string	"nextExecuteAt"
+.LASF1126:
+	.string	"schedulerTicks"
+.LASF987:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1052:
+	.string	"TASK_DISPATCH"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF425:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF626:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF940:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1050:
+	.string	"TASK_RX"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1036:
+	.string	"staticPriority"
+.LASF816:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1158:
+	.string	"getTaskLatenessHistogram"
+.LASF442:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF793:
+	.string	"_STRINGS_H 1"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF958:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF657:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF690:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF712:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF927:
+	.string	"USE_DSHOT"
+.LASF450:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF651:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF935:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF728:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1193:
+	.string	"profileTicksToUs"
+.LASF873:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF620:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF556:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1180:
+	.string	"last"
+.LASF1181:
+	.string	"schedulerQueueAdded"
+.LASF913:
+	.string	"TELEMETRY_CRSF"
+.LASF732:
+	.string	"INT16_WIDTH 16"
+.LASF930:
+	.string	"USE_PROFILE "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1247:
+	.string	"common_post.h"
+.LASF1235:
+	.string	"long-double.h"
+.LASF1242:
+	.string	"__locale_t.h"
+.LASF1244:
+	.string	"platform.h"
+.LASF1204:
+	.string	"src/main/drivers"
+.LASF1229:
+	.string	"libc-header-start.h"
+.LASF1234:
+	.string	"cdefs.h"
+.LASF1212:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1203:
+	.string	"src/main/common"
+.LASF1216:
+	.string	"stdint-intn.h"
+.LASF1246:
+	.string	"target.h"
+.LASF1211:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1214:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1236:
+	.string	"stubs.h"
+.LASF1206:
+	.string	"src/main/target/SITL"
+.LASF1233:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF0:
+	.string	"./src/main/scheduler/scheduler.c"
+.LASF1221:
+	.string	"profile.h"
+.LASF1243:
+	.string	"strings.h"
+.LASF1231:
+	.string	"features-time64.h"
+.LASF1215:
+	.string	"types.h"
+.LASF1210:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1223:
+	.string	"system.h"
+.LASF1227:
+	.string	"stdbool.h"
+.LASF1213:
+	.string	"/usr/include"
+.LASF1202:
+	.string	"src/main/build"
+.LASF1230:
+	.string	"features.h"
+.LASF1245:
+	.string	"common.h"
+.LASF1238:
+	.string	"typesizes.h"
+.LASF1241:
+	.string	"locale_t.h"
+.LASF1220:
+	.string	"scheduler.h"
+.LASF1239:
+	.string	"time64.h"
+.LASF1217:
+	.string	"stdint-uintn.h"
+.LASF1207:
+	.string	"src/main/target"
+.LASF1249:
+	.string	"utils.h"
+.LASF1222:
+	.string	"scheduler.c"
+.LASF1208:
+	.string	"src/main"
+.LASF1219:
+	.string	"time.h"
+.LASF1248:
+	.string	"debug.h"
+.LASF1240:
+	.string	"wchar.h"
+.LASF1225:
+	.string	"maths.h"
+.LASF1224:
+	.string	"string.h"
+.LASF1209:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1228:
+	.string	"stdint.h"
+.LASF1218:
+	.string	"stddef.h"
+.LASF1237:
+	.string	"stubs-64.h"
+.LASF1232:
+	.string	"wordsize.h"
+.LASF1205:
+	.string	"src/main/scheduler"
+.LASF1226:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013"
+	.string	"4"
+	.text
+	.section	.gnu.lto_.icf.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\324\003}\023"
+	.string	"\224\030\310\004"
+	.string	"2"
+	.string	"\226\222\361\274\n\020\002"
+	.string	"\002\001\002\002\003\004\002\005\001\240\342\234\212\n\002\357\231\267\203\016\032\006\002\006\003\352\263\360\321\b\004\247\306\272\262\013\016\002\002\002\005\002\006\002\005\004\002\005\005\365\350\367\344\t\030\002\007\006\007\b\215\350\372\305\n\034\t\272\372\225\224\006\f\002\b\013\237\201\363\312\006(\002\t\n\013\002\013\002\t\002\005\f\r\016\017\020\321\262\232\233\002\n\002\f\021\243\316\352\277\007\f\r\002\002\002\023\025\350\207\220P\b\002\t\002\003\002\n\t\002\003\026\207\335\227\256\b\004\027\215\316\205\345\007\016\006\002\006\030\031\032\033\336\216\253\242\001\016\006\002\006\034\035\352\270\372\363\016\004\006\002\006\036\334\335\235\227\t\006\002\006\037\301\206\236\306\b\006\002\006 \354\316\321u"
+	.string	"\002\017\002\005!\"\217\346\223\377\b\004#\201\273\366\332\b"
+	.string	"\002\016$\305\376\267\202\002\n\t\002\t%&'(\300\346\205\214\005\002\002\020)\257\322\332\345\007&\002\021\002\022\002\021\002\023\013\002\023\002\006\002\022\002\006\002\023\002\n\002\022\002\n\002\023\002\002\002\022*\344\274\344n"
+	.string	"+\353\273\225\306\004"
+	.string	",\354\206\342\366\006-\271\364\302\307\024\002\024\025\002\026.\330\326\227\356\f\006\002\005/\245\261\360\304\004"
+	.string	"0\253\344\270\373\t\0061\271\213\357\254\003\0022\204\223\315\036\b3\267\345\211\374\0164\375\252\211\242\003\\\006\002\003\t\027\002\006\002\027\006\007\013\002\013\002\002\002\005\002\027\002\027"
+	.string	"m\250\221\251\300!\251\022R\230\202\244\003P\202A\250\256:\021\340@\2430\232\021I\223JZ\003P\236"
+	.ascii	"\206z\n1\345\240\246\320\025A\267Qt\037z\212\212;bK\3326\261"
+	.ascii	"\372N\252\310\207b\2102J\256\030\312\024\241o\206'\225\200B\214"
+	.ascii	"\224\347\016\346\007A\2244mwQ\333;\357\341K\312\311Y\305\032"
+	.ascii	"\225\321\372\3450\027j_z\210B8\205Y4liA\246\315.\207\372aV\001"
+	.ascii	"\013\362{H\020\254\341\346\346\266\020\\\276\344\371c\305N\025"
+	.ascii	"\313Z\241\201\335\362\362\210\215T\233\376@\317xmEs\nh\321\254"
+	.ascii	"\"\322}\221\271$\031l\326\303\373\365\302\253)$L\036\337[\326"
+	.ascii	"\214B\275^Z\335.>\243V%<\276C\357\030z$&\260\327\241#\205\207"
+	.ascii	"k\223\240*<B\354\371\202\371\254\357c\324\335\022"
+	.text
+	.section	.gnu.lto_.ipa_sra.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\313"
+	.string	"\325\006"
+	.string	"\002\211\032!pe2\034\374\377\377\377\271\372\377\377\377k\277A\001"
+	.ascii	"\361O\302#\204Q\314\t\245\301\263\270\245\224)\357\177\317\356"
+	.ascii	"\224\263M\327l\231\r\263{/\335\322UJ\031'\273\032\325#}\"\344"
+	.ascii	"\301\273\243\301\350\213\216\210\236\373\005\260\366\027,\275"
+	.ascii	"\252\215\342:\364\023Q\301Q\0021A\326\260_\205m\022\341Kh\017"
+	.ascii	"v`\357\305=\275\2005 \220\2021\264m\223@O\027\035C\\p\261\214"
+	.ascii	"\350\203\305\335`y\2435\314a\203\253q\tB\007\006\331Y\206\314"
+	.ascii	"`\243\256\2217h\211\\\370\024\026\3130\222\001\bp\200\340\314"
+	.ascii	"\336,e\031a\304\212\325Qh\203\234nf\354h.m\223\271B\027\261["
+	.ascii	"\341\034\201@\030\027\206\262\016\004\001\346d\213\020NF1\324"
+	.ascii	"\203\311i\360mEp\003"
+	.text
+	.section	.gnu.lto_.inline.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375``\f\3350"
+	.string	":F\240\016E\200\236M:U\274.\2045\310AEe\265s\203B\367\3707\337]\250P\357\241\346>\322\362\343\330Q\327\377\341B:\336l\320w\271\245l\332zcL:\345b\250F\2049\300\324@\340w\212\2064i{'\231\002\314"
+	.string	"\322"
+	.string	"\336"
+	.ascii	"\353d\013\\\305\324\234\223\343*k\201\3071\352^[\312\004"
+	.string	"qPS\310\031\031\302\221\367\2541i~AO\036\237\356Q\247\363\307\322\245?:]\315\0360\3005I\2126\213Z\253\317\316!}wl\221Neo\235\336\016\"\322\253l\013\343\322\247\217\221mM\2775\265q\247>\0351\203\350\300\321\265\246\245)\324\277f\360@\273\251i\357^~e\330\344\\\332\346\227\276\021I\372\243G\177\267\300Z\353\315\336m\220\201\327i\004u\372\300\327\236h\323\373A,p\025\246^\251\t\244\307\016>E\246&&\0211#Z\272\t&fDk\311\247\346\325\373~\357\265V,\321.1\327\370\334X\2624m\037}\275^\023\277\"\273\202\243\310N\340\234\210\324\3434\262\335\366\365\374Rk=r\200\245\243)\357y\256\302\344\241\036\335\233S\323\206\031\264\030\006l\266\203\276\036D\004O\261\363Ll\255\210\221\311\246\337\220h\217\366=\3329\372\352\373NF\323E3\355M<^G`"
+	.string	"\231.\320twS\235Ou\273\203\231\021\031\233>-\217U\2466\211\272U\224._\204\335\264\363\243M\222\233I\262\222~\3274\001\257g\327\364\201\004\337}\262IO2\275-\306\304\244W\371\346\235:\327\220j\246\3018;\352h\265\326 \251\227$f\260\326Z\344\237\251\351c\b&\216\001\217\244\316#\3514\255\316\314\224\334\037I\247\273\211B\366d=\222\036I\336\324Q\306\345%`\367\341p(\307\366\3640.,_\326ei\005\024\333BLdz\225E1,k\304"
+	.string	"\270\034\022\334\322r\244\266e\315\025##-o\246\365\201\203g\255\302\314!\003\313@\327[b\342x\221\266\247\201\021\330>\017\265\257 )D\355+\210\363\001{\315'KXVT\342N\250\244\241\031r\201#\333d\262\204eBw\234,a\031\220\007\270\351'd\033\313\335_\204qY\261\321\3524\177\274\231\"e=\362\306\3279\034\016\207\353\2557\245\357\024\027\204\270t*\340&\035\205}\340\334\r!&=E\224U:\325l\321DTz\325\374\361\222\370\226\027\254\032C.\232\325\364\351\246_\247\037\tjm\255\237\274\273KC\315%o\326r\254\351\223)\217\256\t\343\022.\365\t\245\335\350\363K\266\363T+\304\371\252\275y\245\016\243N\034\254\234\005L\322\275\007&\351\317\231\233~9\272"
+	.string	"\304\323&-[\206h\2378\215=Y\210\354\332\211\251\245\006y\254\221\r\030\200\226\304\254\027r\2247\227\350\350\002C\024\341\364Y\323#\300\026*\330\206\232H\306\260"
+	.string	"\251G\262\204\232\363yCH\203\316\226-Ur\305\206\031\316\024|S\312\005\316\023\210\210\210t&\332\335+\255\t\030\357XZ_?\321c)\274s\306\007uy\263\255"
+	.string	"\205mL\266\200T\204,\201fU\3111\205\003\275\202\257_D\314\027=\013\034\2417!<\260\375i\007RWd\324\354\2525\006"
+	.string	".j_\302\007\263\206\332\327\031\223\033\330\236?\306\335]f`\3337t\377j\365\005y)\352@\023Xk\035\255d;\3525\001I\366\356\373\361\206\212\350\255P\037s\003\n\360\326U\221\351\273US\226\311d\201\036\250\3610\245\02026##\005I\222t\221\004\2049\205\250\324|\022"
+	.string	"%=Hb\250\214\214\210PPP\222\244\222e\rPH\304\313`p\265o\260\004\305\321\204\233\327\345\007\272S\226{\2476s\263C+O\313[4\255\013\336#\013#\331\"\022\np{\3069\302\317\247\355\321\363PaiK\301\275\376\214\320\256\313\235\t6\317\217R>S\276L{\323\246v\356\373\244\353h\270\225B\367\372\373l\002\306\326\007\330\247\222\0061w\332\034\226\032\001\241\374\302\023\314h\371\205\250\271\020r\350\226\320+\025\243\034\315\r\323X\331M\246\016\341u\250\340\255\241\214\374\350\003\375\343D\306\304\204\346\356\324r\f\nXL\264P\337\325\256w\353\224M\003\r\213\271\365\365\210Qpi#\252\300\257\001\314k\"^\371_\314#\3239:\214\333Bc\336q\373\237\301\020\231\317c\367\250<\024\252\f\360\302\032\023\263\001\210H (BY\242.\007Q\t\265\222(c\002\270-\006~qH^\004R"
+	.string	"[\205[\177\224\321=\254.C\277\364\232\311\313@Fs\203\334.\367\013\237\332\030R\225\032\323\304\232\266\223v\206J\356I\272I\367uv:\006\263A\206W\211V\200\215JSUH~\023\227\376\321K\206E|\375\"9\304\360\035\306~\250\214\317\333\003\201\337\366\337\005\2349l#L1\302&f#w\375\001"
+	.string	"\207\263Qx\211V\310\271\217\214\351\b\" E\360\203\372\377+\032\246\"<9z\355_\211\260\364\376\320\314\201P\f\034\234\276\021\272\201f1\035=.U\213DW\0263\230\240\207t\016\006\313\231\353Q\274\252k\310\335y\344q\002\254#\352\017\224\346\023l|\323(FDb\211"
+	.string	"\313\320%b!\210\360\364W\216\336V\2101\212\376\326q|:J-\013r\230\202\234@A4E\237\017\354\027\357\257\221\203\237C\366\325@qz\0138\270\256H\255\314&\027}\306\311\345\240\022b\004F]D\fxNt\315 @\023\353fD\372\300\233\271"
+	.ascii	"CG\320\021\3274\242\251\307\217\260\327v\251\3672\212\250\233"
+	.ascii	"=\345O\367\002\366d\226\335\355>\276K\013\214\246\272\347[\005"
+	.ascii	"\231p9\345\302+\373Z\237<\021d\032U\225\003\363E\2038W}\330\007"
+	.ascii	">\332_={*\260~\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\224\004\265\017"
+	.string	"\366\324@3`m\322\001\220\363\220\213I\364D0\224\302\375\030&g\037.\276\003]\301C\020\004\365\016/%\320jGo\303\236pC\017\254\n\026\256\"q\023\271SJ\001/"
+	.string	"0"
+	.string	"1"
+	.string	"\255\274\367\212\350\024\271\343\3459\t\364\341i=+\366\003(\207\354\021O\016\231\343\273\257/3\327\304\335i\034\3258r\373\t_=\233\335L'\217vJB&\333\353\261\335\020\232\211\036\331\"\273X\242\360\343\354\217\273\233w%\n\363\364\263m,\300\234\215\271\033\340\275\207y\016X\234m\332t\"6\330\305\r\355\325f\232\277\236\032\213\362\274\367\030zR\227\204b\220k\342\213\271\264Y\346\222\334[s|\215co\256]h\253V\301\211Mt\327\323\355\001\265\022\335\3363\276\343C\304\230k\243\246\251\305(\250\223 \031\322\214\366\366\302%N\313J\215\305UA\3214^\023\016\022\033&\341p\325\223\340y\360\214h;\034\315\306"
+	.ascii	"\302\022j\250!=\311\\02\233f3@\002b\230\272\352\006\022\300\023"
+	.ascii	"A\302\341\244\224V \301\204\231\024\024*\3733\006\026\262\031"
+	.ascii	"<^G;\034^\317\204.\276\252\234\241[\343&\300\200\344\373`Q\313"
+	.ascii	"\337\304$\017\237(D\313k\230\347Q\260\327\241[\301\372\366\230"
+	.ascii	"\252\266]\231n\250+\310F\225\325\376\025\016PJ~\264\337&\262"
+	.ascii	"%P\270\215\370\236F\263\245\367\017e\"\361\037rJG\350@\374t\256"
+	.ascii	"\333\210s\265\220\250\227l?\032\003\354B;b\020\227P\241\306\221"
+	.ascii	"\203\231M\210\004\244w\025\253'\236z\376\254\324pE|\266\206m"
+	.ascii	"\265\003\265!\"f\314\202\231\331\301\311\226qv\023\032\322\256"
+	.ascii	"\263\302\350\337\305Q<\327\305\300fV\207\017[\016\234\023\207"
+	.ascii	"\007\020\250J\030)\016\223\376\352\315\230Ly\372\2516\2433\007"
+	.ascii	"\315q\313\255\3343\b\3325\300(p\002"
+	.text
+	.section	.gnu.lto_.pureconst.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375 k\265\002"
+	.string	"\262\206\024\033pO\032\003\374\353\213\205\276UUU\373\304U\177\343?\372\030>\030P\205D\272\f\336\3618\276\3614\256\214\207\361\213[\274\242\242\250&.\361\210\007\361\036^2rx\r#\206\237\205+<\341\b\327\301e\360\202\023|\340\002\0178\300u\310-\231\231'"
+	.text
+	.section	.gnu.lto_.ipa_modref.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\331\004\335\022"
+	.string	"VXJ8Pk\223\3410\"\216RQ?\223\213\376\035\343-\022\237\0020\370'q\327\345\306\202\235V\236\231\357t\030\371D\215\030i\347\263\311\242\256\212\203\253<\341\236l\333dK\231\0025"
+	.string	">"
+	.string	":"
+	.ascii	"e\017\n`V\224\220\017\205x\375|\177?J\224\335\332z<*\177\236"
+	.ascii	"U\335Z'mm\2719\227t\035At\"\345\221\025\221\242\334\322\311\312"
+	.ascii	"'\332\333\001\236m\002\335@\320\330T\0326\225\253\376\347\034"
+	.ascii	"\002|\236\305a\336\207\f\264[\312\307\036{k\200\203\016\247\301"
+	.ascii	"\361\334\205)\225K\227\362\013\306\021\260\243\201\n\235\351"
+	.ascii	"\221\244\254\224W\236\247\231\177\020\324\rJn\222\356\367$gP"
+	.ascii	"\366\202rL\327C\323\350\253\253\257\332T\311\fT\360\244$(\211"
+	.ascii	"\2402)o\301\036\232\333\"6t\270\f7#P\"\302\271i\362S\"u\342@"
+	.ascii	"dj\013\004S\023u\2011A\246.0&v'\216\005B\265\202\0047\301\002"
+	.ascii	"\006\017\216\302\206\305O\230.\351K9\236\313<'"
+	.string	"\345\224Z\301\016\363\006mm\275(\036o\231\216\216\225$c\222\231\311\347a\200\220\250\2015s\214HIA!\035@\002b\3141\243\007\021 %3\224\321L\030IR\310\264\006\213\227\366\\\200@\365\317P\301\004j\206\233E\013\022\tQ\275\n\205]6\016\330=\310\033G\020\226\300\342[\275\261{\3018\327\252\001*\260m\323\334\2407\363i\314b!\202R\254%y\036\206pD<\024\237$?uPfW\217<\310l9F#\355t\222\t\016\204\177\006\034h\334\261\257%}t\360EU\241r\003\301\350\334\3462\300\302\264\220Y7\374w\242P\354XIq\005\\v\363\030\306\323\001\305\264\337;\364\007\340\340\t\237B?\264\341\332\023\332~\20660\230 p3\022\357\376Z/1\365\315\305\227'\020\227\006\342\324\346\373+\017\227\231\205}\370\365Y'F\323\272\016a\031\312a\260\224\230G\240\327\037\034\227\n"
+	.ascii	"VfX\252\312\300\363Gng\270d\243\334\300\255\343\354&\262\215"
+	.ascii	"\365\272\002,h\np\200\2227\204\210\206\006\310\377}.\177Ce\264"
+	.ascii	"\001^\311V\004\225;\260*s\311\214\312\017\217\320\247\247P\207"
+	.ascii	"\232Z%\365z\276h"
+	.text
+	.section	.gnu.lto_.lto.34adf3621de77d63,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_profileRecord.1.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\200\003\355\026"
+	.string	"\366(\222J\240\226U:\250?\374\003+:\206\034\355\303\314\275J\311\344\005\235\022\276\013Mul?<\354\307\323\343\323^\356\350\336\036\264\205]\251\332\304\266\204\b\275\302J\343\025o\2077\005\225\222\365:0\005<\230\021\203\r[K6\221;\311{"
+	.string	"t"
+	.string	"~"
+	.string	"9*\234\036\025K\272\315\004\257K\301L=\205l\261\210\255\271\033\t\264M\017P\204\324kk\030\243\364E V\325\215\302\251F\267\251`\021\244^ww\357\342D5\273\033\315\237\340"
+	.string	"\342\211\233\243\246n\023\346\272\n\371:>\205|\345\024\337}d\272\333\243X\306!\023G\200A\336\307\021g\001A\233\321\325\335G:\305\t\372(E\261t\367R`P\347[\277\273\022v\367\303.\013\005\256\036u\332\025\237Y\3149~B>\372\264*\272[\353@\017<\237\204\320\307\274\245'\016\246\246N\273&\217\362p\367c\263\317\356\213\376"
+	.string	"?\277\254\233\377\252\322E\221tI\222n%\351\216\225.W\272\264\322}\001\362\311\020\003H\335\"\236\240\264\220zc\305\317\177\367\273[\263?:\322\256Z/b\273\247\207\024/'\245D\004\252\220\024\203qb\315\215t\357_L\362Y\\\231\376\270\211\322k\271\017\f\262\245\246\036<\306\036\314:\212K\0076\371e$e\346+\371\355\354f8\016\231li\250\273\033\334(ULr4\325\270\r\035\371J\231\201\212z\364i\351\271\203\251\223~\243\273\036\343J\272\025$\335}\340\356\276\234F9!D\320\016Qw?\220\361\031\263}\320\353j\240\325=\215|]\231\325\245\204:c\213\237_\223\246\356\216\265\b\351Yd\361\317\007[\276\016\344\252\3558\231\222f!w\223\345p"
+	.string	"6&[P2\200qP\276\312\327m6C\3632\213)q*3\227\332\315V7\3465\233\241\301\324n6\330\313\f\215\306\005\306\201&\333"
+	.string	"+o8\330\253\2655\333\354\006\313\325j7\330\312\354\217\315>\013A\330c\337\322\323\311\310C$;\346)\0361\262\222\244D\357\fB\273\233\307<d1\212]\210>l\350\223\335\275\360\"\273\312S\034\"\302\204b\225\037$\013\t\002\244\362\030@\250AP\005\2211S\026\215\342\024\244 \035\200\242\231J\333\021`\261\"\n\032\t\304l3\r\340J\352\2143-(1\356@\214X_9\231\027X\220\313\220\303\352\261\261\016\004\221:\177\031\364\376F\177`\362%\225\347\347\037\030\327l\212\362"
+	.ascii	"8O\216J+\005\365\220\327\303\007K\300\244xd\236\252\0228e\271"
+	.ascii	"\335\024\251\024o\343\007\316\236v\327\225T\335#\307\267\236"
+	.ascii	"h\265\177\0319j \300\037z\202>\fs\253\026b\357\342\315\2054\024"
+	.ascii	"\331\267!!\r"
+	.text
+	.section	.gnu.lto_deadlineQueueSiftUp.22.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\344\006}&"
+	.string	"*A@\016K\200\026V:\341\205\262@7\357\205w\235O\212k\361\036\265\330%%\260\233?\227\343\013S@\201\247\031+\336\372\307\246\251\225\217\246\316z\245&\371\215\250\371\377\310?\342\217\344\243\323\247\237\204\rt:\257&\325\366\223 B\310\336I\006\310"
+	.string	"\316"
+	.string	"\321"
+	.string	"\307\262\335\275\247\n:R\270\026\333\031KN\t\256*\331\024Evj\t*\232s\266\271Z\023e\367{e\320\213,W\322)z\265\317$\250\033w\025?\331\270\032\"\273\037\257D\350H\3413\261\330\026A\215Ds>\332\\m\n\354\325>\2625>v\277\335\217:\022\241K5\263\333\234u,\265r\316\tZ\001{5w\001\353\325\364"
+	.string	"\326\253-\324}\345G\036\331\266\004U\304$-\347\254\303;Z\275B_\325\024_\241\376\2551\305\310\230\342\353\214\221\230\374=2\016]5\210\213\247\351\003$P=\276\374E2\022\245\0309\365\004g$^\374\344\323!4\304\214\214.~m\021r\316}\215\214Jo\333\273[\330\335\301\356\225JW\211\366\314W\255\3738tqS\367s\236_N\215\231\272o\267in\267g~[\246\275\035\323\336\306\265\267o\277z\267G\276\331K\375\266\364Ro|o\337\337~"
+	.string	"[\2141\003Y9'\255\201\311N\225\353\307\257~d\277\311\307\200\036\245\037v\347\263\232bM,b\31530\346/Gt\314\306\0062\312\242\322\f\220\355\330{0\2403\177\3511\033\037\265$\236\245\375+\370\344P\360X\230W3\311\253\211#\231\201\355b\372\024P\261\263\335w\005\317\364Y\213\355\013\250\215\013\254\223`7\256\tP7n\013\253\237u-l\224\002u\t\034\263R1\271\353e\315\222]\367\225\t+hT\005\366V\335\270\016\372\222\376\324\253,\220\245\345\234qT\001\277)\275\264~$%3\353\271\024\037\353\271)c\225\r\246f\312a\225\301\300\244\030\321\375\322}\257\256'\021\325\234\303\253\366\177\235\215\n\211z\211\306`\031L"
+	.ascii	"\255(\314\r\343p\f.\200F\00424vuM\207\363\255\225\031,\314\266"
+	.ascii	"\334\360\305p\370`Vxpx@wx\025\036\2333QN\237\n\212^\377\311g"
+	.ascii	"\275z\3037fR\303\257\337\224I\236\207\362#\021\217@/\276\327"
+	.ascii	"s\303\256\347H\274L\310N\2718'F\251\326\342_=w\363\343\026_0"
+	.ascii	"b\030\234\247\3708]\022o\f\335\265\376\362_\241\364\202\241U"
+	.ascii	"\220V\270\257\262\013\213\217<\204\034\303\253\326s2\341\r\217"
+	.ascii	"\234s\203>\364R|\375\247\253\035B\347\336H\007\323\230q\r\357"
+	.ascii	"Z\007-\002\307\267\243\363\243\343\371\355\354\374z5\036\316"
+	.ascii	"\373\017\217\017\310\353YG\004y?i+\340\355z\013@0\350\341\b\b"
+	.ascii	"\376zp\367p\200>\022@\037|\"zA\035\217\016oG\327\003\006u8\b"
+	.ascii	"\372\327\343\003\352~~?\240\016w\034\0363u\253)\356\024\247\030"
+	.ascii	"\343\243\356\356\t2\234C<\244<\r\276Uc\270\027\236\r\375'\214"
+	.ascii	"i"
+	.string	"N\274\013\027\253*\026\237\n\343+oS0|\254\270\251\277<{V\344F\332\342N\257\r\247\370\310\346)\226\020\366\344\337\202\330\345\231#\f\323\234sVqS\267\324\035\344\260)=s\026\326\277\374\204\242s\006\303\3174\304\224\345\234s\372[Pl\020\256Wo\244%\3053\030\223\025\205\371znu\227x\026\341\200\262\350\001\263\032[\001\200\227\250\2010\306\220R\250\204DD\n\232$\035p\002\231\231\273n\021p\261d5$I\n\231\366\016?\322'Y'\323\360\3569\245Q\226\312\362D\372E\210\272K\3007s0<\020b\310\212\365\373QR\206\374\2020Hh\n\274\325\206\017\334}p\351\022!\2338J\007\360):\226\f\372\211D(\2427\204\351\307\243\022\304\306\021\247\266g\230\215x\035\204\310a\354qW\236P3V;{\307w3\355$\250e\002;\"\300\267g\233\311@\315\312\346R[\216\236\317"
+	.ascii	"AA\215@\325\303\b\204\032\207\344\0305ds8\355\216\b\031\0160"
+	.ascii	"L\274\315\205C<\034\206Mk\261\312\033\352\324\232b\303UoE\325"
+	.ascii	"\200|Qc\033\035s\310\276\310\347\363\224\037\005b\017S`'\034"
+	.ascii	"\035\300]\374\013\355z\306\035\\\227\214\313\277\242=\303\202"
+	.ascii	"\370\022! \2443\217L\247\365\016G\270\034\357\255\021\302`\260"
+	.ascii	"n\013\030C\206\035\3150\351\336Vx0E~\035\243X2@'\323\305\311"
+	.ascii	"i\347\002+p\037*\324\0168\276`$\037m\300\365\206y\230\261\252"
+	.ascii	"e\242(#\311\214\335\356\217GKJM\336\373\003"
+	.text
+	.section	.gnu.lto_deadlineQueueSiftDown.23.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\345\te1"
+	.string	"\352P\230\021I\200\030R:\177\235\207\375\177\037Xe?\224t\271P\374w\316\357\301\233\203\245^G+y?\315\275\275\356^s`\261/\354\020\304\005O\210h\226!U;M\327\006\270\033W\021\206!\364>\247\024C~,\226|B\210\334I\006\377"
+	.string	""
+	.string	"\001"
+	.string	"\001\367\302\370\361WP\f\2573\013\353\273\230y\354t(|\345\247\\(#'\345\b\367\263\366R\234\316\365\244\026w7\254\202(x\232\\S\024W\245\025\330\363\336\233\340iP\332\357\366I\247\027W1d\220\347S~\024'f\336S\364H\346\005\r\177?\376\t\324\271\236~\207\305\035\261Y\366\274\367\230\340)WX\237\362q\005:\363\273e~\326\265\240\276\305K\336\335\313#\214\312\275W\001/X\237\366\356\243>E\317\243>e(f/?\376\270:+0b\024\271{\257\257}p[\250\357V\235\232\242m\241\370V\207r\312\230\342\273#\217fU\205M\031\211\361\365"
+	.ascii	"\263XC\207\"p\263\3422 G\232\f\026F\242UW\032Oq\214*\320\336"
+	.ascii	"\275\227g\034Z\024\215\240\305\004\310\277n_\030\245\320\346"
+	.ascii	"R^9\362\007\216\024m\330\2661\306\270\325M\270\367\262\2352\302"
+	.ascii	"8\333\234\231\2250s\220yg$OB?\356\275\017\370[\316\005\004\037"
+	.ascii	"\353)\037\211\260\237\022\241>\005\3209N1\241\235c\2534\302\274"
+	.ascii	"\026\r\3631\312\366\025\363\0330\321\202p\367`\276\345\240\235"
+	.ascii	"e\240\235\345\237[\026\260Z\366Y-\367\254\226ynyg\265\034`\265"
+	.ascii	"\254\263Z\316\3019\327\031\300\267\376\233{\235w\253\265\254"
+	.ascii	"\263\226Uk9\375\326\031\275\345\276e{\3137\240{\272\025\230\273"
+	.ascii	"\227j.\315mK\305\210\334\353\347rf\341k9\034\027\243\252\236"
+	.ascii	"o\315c\341\271}a2v\267\023O\343\257\275\355aele_\330\312\342"
+	.ascii	"\324\226%zR\307k|`\003.K\216\300\333Og\257v\342\313\022\350\361"
+	.ascii	"\032\237\3655\f#w\264\246+?k\2678\2632*\2632\035\310\f+\331r"
+	.ascii	"i\200\212\237jO\326\364\345\222Z\334\315hVaX\25541\363\306N0"
+	.ascii	"\363\252\200\361\303N\245\215d\230X\240\343\205Q\354I\351\\)"
+	.ascii	"+\260\"7^:\016\352N[/\310\264&\363D\210Zm=~\226\377\355\353\023"
+	.ascii	"\311\323\314Sh\321p\200\336i\2401\3045:\235\323\001z\300\230"
+	.ascii	"a\221(\347\3239\036p\337u\271\341\342M\214N_KN?K\232`N\377p\207"
+	.ascii	"\237!Z\357\225j\3007\303\004\344c-\251OuZ\310\271%|\273M\322"
+	.ascii	"\t\226\377\305\260I3\3557\325>\023\305\313\220Q\373aN\017\217"
+	.ascii	"{Z\305\244\375/@~0c\334\256\324\367\035S>I\273\007\367\332\275"
+	.ascii	"<\250\273\377\365\035\265\341\021\241\257\035\324l\2079\242\264"
+	.ascii	"\272\271\205\253\013\355\2535Nkm\3355\243\366\246\327f\201\323"
+	.ascii	"\266\203H5){\206\371\317\203\341%\037\213\215\330\n[Q\237\332"
+	.ascii	"\366q\326\270Q.\301\351{\275'\3647N\277\3130G\324y\251\256\375"
+	.ascii	"\266j\206G\242\354\034\377\353o\241Lr\344m\224H\326\236 D\357"
+	.ascii	"\275\267\031@\237\353\022v\b-\232\017\357\022\034b\310\b\351"
+	.ascii	"\210\311G\"\t\t)\t\030\344\341D/\032q\024\002\230\212X\"bBy\001"
+	.ascii	"\321\017\310\340\203\003\340\220\317R\222R3p(h4\242\251\310("
+	.ascii	"\004p\311G\342\210\b\311\007\f.\371\206\016p\222\222Q\320\307"
+	.ascii	"\224\224\024\364\361\216\302\353\326f\264\327F)\200i\023vT\362"
+	.ascii	"l@\375.\316`\251\2126\360\261\320\0062a]\264\350\232\"\345=\264"
+	.ascii	"\237|oM\310\256\257\230\267\016a\207\360\214y\303\300(\224\265"
+	.ascii	"\375d\260S\032n\340\356\275\r\330\256P"
+	.string	"\332\360\244>\375T\230\265\177\272\337\210k\204I4f\025f\022\226\370\364\003g\207\006\2348\204Un\2234cR\371_$\227\315\033\366\236\020\354Fi\306\354)U=\314\326\037M\326\250\335LM\206\2448\275k\026j.\240\203H632*\342\030\233\332\217\346\323\002x\272\247}\334\332x\372l=}5)\245\236\376\341\016VX\304\203vf\246\353\223\215\260wN\327>\247\230p\214\271\353\t^\367!:i\023\006\200\343\250\2410\306\030RhdF\202$I\222\016\200\002\021\0313\253\003\021@\255d\212h$IR\030\016:\342$z\\Oq\357\217\316\321@\206P\254\361E d\374\266\027$\367\373\253\357\020\344\355\225\240\362\n\312\366|\245\347\355\307\361\327-@\256\307\024\215\224r!\r\0050\266`\177c\246^\232d\272\335,\246j\216\203\225}\355\021H]\204Z\260\375\030\353\347:\022\202kF\230\367"
+	.string	"8\210\264X\232\236P)\323g{W\237'\234m0\247'P\t6\223\232`\345\021:T^"
+	.ascii	"\023\336\026U /\022-\324\2261\356\273\365\005\352\023\020\206"
+	.ascii	"\317{\264\271\006R}\302\t\021\200 \236\033\365\371\002\300f\342"
+	.ascii	"0H\034\242K\233\030\231g\363\257m\201|t3\265h\230\241\202>lG"
+	.ascii	"\305,\225(\"v\205>p$\306\356\n2\005\"\022\034\322\021\371Q\242"
+	.ascii	"&\001\037ld\320\023\2779\217\340\333\203\217ThO\240\272\237\353"
+	.ascii	"\261\n/\230\177\270\033\301\0171m\036\225\333\004Ec\344\224A"
+	.ascii	"\215\351\026S\221\247\037z\213t\0045E(\2272\273\277\353r\346"
+	.ascii	"\013\255\265T\245>\323\376\017S\321%\354\367_\374\275Q\20633"
+	.ascii	"\244\370h\315\213\016\230$\216-\2100\336%\034\022\274\341o\036"
+	.ascii	"\362\316\257\253\350%y\205\243\264lS\303\005\333`\212\355\362"
+	.ascii	"n\341G&\334\016\007\363\n\004#\314\227A\354\300\300\222.T\262"
+	.ascii	"\\\356\003|\334\242\347\300\307\207\224\230\022\032\327\253\264"
+	.ascii	"`\235\325\353\306\002p'\312\346\036\224\031\242Cr\336\216\243"
+	.ascii	"')\216\031M\255\350\204\220\016_\327\025.\207'\233\321o\353b"
+	.ascii	"\200.\037\336\177;L\005"
+	.text
+	.section	.gnu.lto_deadlineQueueUpdate.24.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`]\002\375\022"
+	.string	"v\243{G\320\016)\035;A\312W\255\351#\323\031\007\220\312\023<1\363\2116\375\346\343@7\013\003\213\227$\022\262LmJ8\243\336\343f\230\250\177\307\200S\017\017`\213\256\276&8\b\313\036\352\003k\233\370o\215\220M\244L)f"
+	.string	"]"
+	.string	"j"
+	.ascii	"\273:\001.I=Z\367\017\3601u\017\360\3214\333\351:\f\033\362<"
+	.ascii	"\331\020\301\330\335\226^8\355`\3744i~\230\262\273\027\272\352"
+	.ascii	"\206\2239H\341\3613i\302\351\260r\234Z\260p4\371\211\354.\013"
+	.ascii	"gK\375@v\224&p\340j\276\221\035O\323\205"
+	.string	"\236\022p3\231a\312\356:o8\234;\274m\027\333*v\352\004\003|\017+0)\240G?\006|\274\206\360r\265\3549\213b\250\330\204\262u2\251>\366\277\335]k\217\375\334\277\241\351\325\227V=\235\322t\250i\360K\307L\177\231VMg\246\337\261\302\331\205,\355\336\364d,SD\312`\373,\033\300\212\223\247}\016\357@{.\346\035\273=)\216\002\256\327K\337\364\203T\313^\276\002\315\215\206O}B\00557\f)}\304I\030\205\017d\230\223\3627'\201\217\241\026\340Y\210\njda\023U\313\3363\350\266\263S\263\200Q\025\f-\331\362\3116\203\213`\211\312\001\365\251\335\362\020\032.\324\350\366B\365\372)HT\2633\243\252\267\211r9\210X*\312\217\035\341\037f\251\335\r.q\231\274N\026\240\274H>Zf\256\227\317/\022\031\314\001\314\n\254\301k\326z\300\342ri\275d\263\026I"
+	.ascii	"\307 \300d\255\227XL\326b\351\366\332\243\222\303T\323\031\320"
+	.ascii	"#Wj\033P\351JotB\245#\274\\\030\345\221\240\332\007\020\344o"
+	.ascii	"\026\261\251\2145\212f\200\374\354\220\242\372xCS\272\0214\304"
+	.ascii	"\263\345\223\354G1\004\374\0227\221\300\007zt- P\0021J\341\035"
+	.ascii	"\025\346\244\3327\266x\233q\310-m\367\276i\006\031\3266\002^"
+	.ascii	"7\377\324\256\002\323\377\262\266\025\027\204\377\r\"d\241\016"
+	.ascii	"KQK;\"4N\343\240em\r\224;\322\243\254\210\273\243`\241\360#\335"
+	.ascii	"\307\257\361f0W\222\256y\353\266` DN*{u\215\345\221\207\3157"
+	.ascii	"\035mxu\262\212\025!\323\255,\313\354\001"
+	.text
+	.section	.gnu.lto_schedulerQueueAdded.25.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\314\003}\031"
+	.string	"\326,\235J\260\226Q:\024\346\034\006\036]\020 \321r\240\3414\004+\257\303q\3609_2\222\364\234\232\rxdk\374\363\267\357&\243z\253'`\277-\337\200\032\312C~\300\300\331b\210\201\177Z\217Mc\233P\024\375O\032!D\356\224\002\203"
+	.string	"\205"
+	.string	"\213"
+	.string	"@\356\344{\020W\035\351\234r\232q\245\326j\363\322\020\316\2274\362?|\266\354\345evM\021\333\251\375\036\367\001|\361w"
+	.ascii	"\265&]!\251\325hc\234\363\245\215\2371_\236\017`\2764\320\266"
+	.ascii	"r\243\214\372R:2z\332Rk\255m\214\003_\222K\201\376\233\016\033"
+	.ascii	"\022\211^\2368\031#\236\370\2222\023V\242\310\020\213\310\034"
+	.ascii	"*\304\024o:=\"\n)}=\250\265\232\016\211%n\363\266'\330\216`\223"
+	.ascii	"\264E\206\316Z\353\002\237\b\217\207\223\351g\276\374\312p\025"
+	.ascii	"\203\264\313t\210\n\255J\273\330F!]%\373d\335$\333\244\236\275"
+	.ascii	"\370\307,ul\251aK}\226\324\257\222\332\\\352\262\244&\227z\227"
+	.ascii	"\232\222\324\247\211\355\310B \245V\022]^*V9E\303\377q)\337\215"
+	.ascii	">\324\205l\t#:j\255\262\250\032\002\tfd<\332N\037\345{\361g\""
+	.ascii	"\301R\274\230q\005x\022!\235QJG\t^\nhb["
+	.string	"\372'?\260\254\035S\235\013\303\361Z\333\302\237\334\266\312\020\213\271\344\276\326\334*\327\334\033}\271p'\030\312u\260T\f:\303\257n\006\270\2126l\325BK\r2fm\203\270\325\217\346Xkm\340/9\023\234\235\353\3511_\332,\255\330\255\372\020\213\202\323\335}\210\026B\332e\177\352J\\\3453\331\307T\364CS\231/\351\036XB\341\002x\235i\377\374\210N\346X@F\026\230!,\026F\226\210$\353!\363\253\301iJ\021\345b{\367\275]\320\032\347\226\203\263m`\200\273\231\371\351\335\204H\343nx\271\016\037xr\034p\275\032\220\317MW\303\361z\265\033\002\336\005\345x5\241\335\216W\223\031\203'\353&Y\207\007Vp\205e\r\215\255-\201\002\375\320\264\242%\362lc\261\034Z\325\177\372\233\256s\003k\266\227\362\317\217:\230\243\317t\356lw\313\350\013\205\272\322\002z\224-\234]\241g"
+	.ascii	"\327\212K=\006e\245u!\377\b\250*(1\373\250s\377tZ\220v1\f\312"
+	.ascii	"\316\271\001Q\250a0\203\025R\250f&\243 i\323\001p\002\03113\017"
+	.ascii	"\021\300\261DR$\005\305\302\001\365\003\323\020\315\263\251\234"
+	.ascii	"|\022\221\025\264N)2\017A\025\3012\b\337\202\207\360\013\306"
+	.ascii	"4\252\006\b'J\032\212\323\222\236\003\327\3442\307\034\213\265"
+	.ascii	" \323s\207\302\326\004Q\251\367\206%\224\375\276\203J\022\377"
+	.ascii	"\207\206#\220\021\223\347\020v\352\021\241\3255\202\333D\204"
+	.ascii	"\031\030\377\200Aj\275Sg\237\370\255\301_Mb\001Rc\302\017\255"
+	.ascii	"\260\321\t\275KF\007\335\274x\234\022cc\335w\222\341`\356te\023"
+	.ascii	"=\214\006\273'!\343\241%\220\300\203\276\227\177\024}\237\373"
+	.ascii	"\354\250aS5"
+	.text
+	.section	.gnu.lto_schedulerQueueRemoved.26.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\206\006]'"
+	.string	"\nD\350\016Gp\334Q:\261\367CY@@\324b\352\221\373Y\350\347>\013\271\255\302\220\224\271\024\262H\026%G\3665<m\364\031\240T\250Nl\311\347=V\226m=\347\365s0\302\336;\027\371*\372\027\377\263\031i\204\020\271\223\f\332"
+	.string	"\316"
+	.string	"\331"
+	.string	"\374#\237\013\253AA|\327\362-NGrXj\243\230\256]\260\342\334{\037\374\344\r\351O!\323\252\314AD\337-\363\261<\213\323\263\202\007\272\327\212\354\353\336c\004\226\220\376\344\343\005\240?\323\363\320\237\354\304\374\346\307\253{3\026\211\352\202\347\336[\324I\030\300\315\343\031\265N\317\341\322\033z\232\255Z'\376\265\256`\211\030q\312\306sC8\363"
+	.ascii	"Z\031\225+\020r\204\353Q\212@lj\026 r\206\307\327\0171H\203\244"
+	.ascii	"\315\017{;+R=Y\024\212\217\2379#\0239U;\250n\232\026\262TQ\342"
+	.ascii	"3u\303\354-I\261s\271\225\232\032\332N}\\5y@\272\324\370LE\231"
+	.ascii	"\020\324H\241\272\326\207\242\024\203X{\273p\357eK\234\332q\326"
+	.ascii	"\235\231\321\230\331\0033\212!\314\254\36402\322{\257\021\037"
+	.ascii	"\214\004\214tI\020\375\371\366Y\313\022\3326\266k\230\263k\227"
+	.ascii	"\314\307'\333F\257\"Inp[1\367\236<\363\256<\003=\353\377\331"
+	.ascii	"\231\226u\250e\365\310s\316\264\2143-\247\246\345\033j\0315-"
+	.ascii	"\237\267l\232\226\373\226\355i\371\006T\036i\034$\357\325\321"
+	.ascii	"\246\347\232\235`N\236\374\225?\362"
+	.string	"\315|\376\326\277\232\316\305\377r0\266\214\314\275W\365\312\212:\252\371n\357\325\364\254 Z\304Q!\301\212\363\263K\2314\026!p\306g\332w5]\311a/\246`\310\b?\203\222x\371z\245\244!4\374\271C\243\225'\367\336\016\351\317\240)>\346d\360\027\252\210#\246]\211s\357\221\303\267\232\230\325\237A>|\001+\235]\0333fi\033\201(\3325\220h~O\003\242=@I\226\326\237\203(\247\207\205\313\314\255\215\254\262\235\275>\261\324\007\337\265\324\256\317\316P6\264l\214v6\356\207\320\\V\355\372\202\320.o\336{/\332\353#/$\264K\206\360]\367\372PD\236N\255\252k\227V9\304J\3544{\327\271\226z\235\260&}\366\255\245\230\003\254cf3\363\212\247\t&P3\233\36122\263\215\224\200u\363\315|\214\303\370K8\005\213a1i\3049D\277u7\352\006\212\310\223m\343"
+	.ascii	"k\231\002^C\350\230m\344\237\266\375*\344\332\320\262\2358\231"
+	.ascii	"`\005\376\230\213!1\213${bR'X\003;\227?\307*\326hl\266\254\335"
+	.ascii	"F\376\215\316\306\260T\226\201\276M \327\f-[LJ/:\006\323Q\013"
+	.ascii	"\023\t\311\262\204\243\t?\037\n\n?\"\001,\230\216b\230\374#Z"
+	.ascii	"\002\266\220q\002\250\342\307T\344\002\351(\251\350\267\304T"
+	.ascii	"D4\304J/\200KE1\224\224\226\212\324\243\360m\225r\3650\023\366"
+	.ascii	"\023T\256\215V\327\314\037\324\326\365\335D\355\021\3326< \324"
+	.ascii	"n\260\226\333sf\201\2329\304\b{\"\013\r\333\006\347\364\374\353"
+	.ascii	"\322\354_\374\273\035\240N\r\004\f\3564\342\034\2735&\342t\202"
+	.ascii	"=\2659\b\326\204|=\267U\346`\256A\f\232\327\205\204]\027\362"
+	.ascii	"Y\2277)pn\340\332\310\274\376\351%\344\032\335\232\307\351@\024"
+	.ascii	"\016\320Gm\301U\235;\274~\362\037\214\b\355\262\305\335\004\211"
+	.ascii	"\256\332 1\227H\3425\016\f\327k,Y\332\270\276\332Q\332Dk?t\253"
+	.ascii	"\2353\240\276\022m\240\266dQ{\326\037G\200\216\250Q$E\035SjD"
+	.ascii	"&\020\221\221$I\007p\002\221)\273n\020X\250H\223\fs\365\210\236"
+	.ascii	"F$\237\376\025\224=\"\037c\210\332P\305\020\203t\376\373\275"
+	.ascii	"c\207\023\272\370f\303\310m\210$I\322\250*\274a\276T\007.\212"
+	.ascii	"h-\024\b\350\362\350\332\f2\022\214%.\222\362YFe\035\022$\261"
+	.ascii	"D\340I\327\301I\332\226h\223rK\210J\315\025\0171\334\300\036"
+	.ascii	"L\377dQ\322\330\324\261\031\241\316:\205\320\263C\277Z\036\342"
+	.ascii	"&\357\315;\257\3566:0\1778*\303]H\3604ovZ\336^\241\371vn\220"
+	.ascii	"\301F\007\013\335\366\344\241c\350\0247\236g/\264\016P\340\254"
+	.ascii	"7Jr\243\3508\312\314\177\202A\341$\237L\007\017L\205%\017\223"
+	.ascii	"i\377\315glqxh\226>[\2730\235h\207\237\024`\205\362\261\267\334"
+	.ascii	"\250\312\304\334E\314\352\347*N\2129\237\362\370h%\036\300\260"
+	.ascii	"\b\024\343\3164b]6\321uq\361\024y\331\304\204\375f\376@@\305"
+	.ascii	"Fd\316\005\312'\206q\335\372H\325\345^\226\267)\343d\350\017"
+	.ascii	" \245Q\251\032"
+	.text
+	.section	.gnu.lto_queueClear.28.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`g\002e\023"
+	.string	"&#{F\340\322h8\240NC\250A\202\270dL\264\026%\t\356A\365\035\214\b\252\037\217>I\226\357k\214\330\030Z+\307#\f\327\r\034V\261R\243\030\346hH\312\274\357\025\1773\211\313/\301\310\034J|\033\332{K\231Rd"
+	.string	"a"
+	.string	"i"
+	.string	"@7\243\336\356\246\016\372\244t\260\344\250\360\340w\002\341\301\233\f\263{|\254\355o8J\334\204\354\256\250+<\340\337x\177\t;\370i\302\374\236'\340\001\232\321b\007?\021\231\232\235\021\232\314\247r\324\313}|\322\320b\362cas\375x\005;\274\031\315\346)\262\262\273\316\031\355\304\035\336v\213m\tv\346\004\277\317o\257\221\332\256\3543\377\305ax\360u\016\372\345\225\237\035\364_\341A\033\204\210\374\314%3\032s\342~\2106\221\3541\226\232c_\245v\324\263\342\330\247\333n\315t>}\001\246\336\016\006>vk\222\206\354\020\230\343\271\355\267Or\003\305\367\361G\233H\204P\376s\027\260\333\274+\305L\224\002'\375L\212\230L\262H\263#\202]\025\332\026\236S9\360\203F\254\016\024\355\356u`\302\203)!^\003\246\264\273*\376\214\323`eh\265\324"
+	.string	"\217\334\t\307S\005\342\311\320\324\251\337v\b*d\211\344\217\377Z\334$n\207\333`\035\252((u?\306ex\347\353\230\305:\353\302\203\250Z\020Y&9q\266R~o\2410\025>Q5X\245`x\2602A\265Z\351\225\211\213\305\341u\201\245a\365\"\266\264T,\342\312\365\"\232 \260K\007\226K\374\340\342\342\022M\343^q<\341\307\220LclP(P\313\301#)\n\322\363"
+	.string	"8!Psl2\322\223\252Q\246\256J\243\232\032A\007\211<\362\256\202u\251"
+	.ascii	"P\3102\t\310\215zE\226H\377vw\277\223\336\366\222\005W\r6 \220"
+	.ascii	"\002\2411\273\0013c\322\336'4\\\262\211\374*\334\201\031\271"
+	.ascii	"A\226\257\022\262\356#9\240\020\364S\335\302\020X\270\357f\\"
+	.ascii	"~\006\210F.\313\372\205-\030\261\300\022\002\034\034\235:\376"
+	.ascii	"s(\013/8\312V\337F\373#E\223\214\370\330hW8+\202\260\360\264"
+	.ascii	"\016#Nf\230]t2\316\006\nu\3658(Q\373\352@\333\301n\372618\006"
+	.ascii	"\335\r\305B\365\361\236\210t.\372\004"
+	.text
+	.section	.gnu.lto_queueContains.29.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\357\001\355\021"
+	.string	"\206\"xH\340\322&\035\203\n'Sh8o\rA\242\246\251w\355\310\260\363K\267\323\344&\341^8A$j\3117\327\250\235{]\276\242\003#\267\322\214c\030c\324\030\216\001\226\312&\360\005\006\r!\034\237\fRL\032\331[\312\224\002d"
+	.string	"]"
+	.string	"b"
+	.ascii	"s\2663cN\220\304&\336\245"
+	.string	"\301\213t\227\336\tt\227\bT.\277\016\232\2609-\251\203\017\322\234\340\267%,\340\021\274\245\276\336\311\270\372\362c\336\205\310fjd1\225*n\036c\203\235\026'Bd2qk7\032'\331\214\356mW\241\245\230\321\217\354\346j:\231sZid n\323m\277lO\260\025\0251\2724\373\n\212l\344xg\366C\236\277\263:>\274w\325\252\352{,8H?>\034s\332\344\224f\016)\224\342\341o\037US\335\347\340\t\025\252\354\333\374\027\257\271\036\232\310\213\371\340\335|\224|\3149S\227\226\340]\216\304\373\240\313>\331(\026*\325\367\370.\276\343:\017\314\007\314\232\003\262{\002S\334\343\234sJ\323>\374\bLq>\360]\323~fDLs&\251\t\2422D\314j\304\245\271\333/+<\222\321$\333\346\360\0300\336\234\223\201\017\343\267\226\257si\227\027=\315\245\377\262\005\216\204`\232s"
+	.ascii	" \\\321\352\350Q\373Y\247\376\360\016p`\266\307\025\357\271\222"
+	.ascii	"\230\212\263\301**j\023\224\004+U\205\005\253\022\221\013-\224"
+	.ascii	"\226\350U\t+\005\203\013\205\024\013\253\326\247A\005%\303\267"
+	.ascii	"b\265\276\022\003^\331\220\302\372ZVVX\337\t\234\337\031\004"
+	.ascii	"#\017\267 \351\277\272\333\036a\307\322-h\377W\027\343\372\004"
+	.ascii	"\2661\024\335\322|\312\211\246]\036\232\372n\215\355}p\343?\007"
+	.ascii	"2\221\257c\026\017y\250\273\324\005\020\002\026% P\002a\n\251"
+	.ascii	"\007\2459)\356\2336|\337\203\026\3268\024\273C\210i$\006B\357"
+	.ascii	"\2074\263\355\312 \030\332\320E1\362FMTi\336\340\226\243\213"
+	.ascii	"B?|\256\354V\246$mn\321\016\006M\330\337\356i\013\334=0\314\013"
+	.ascii	"o\241\222\272\246\346\255\330G\320f\251\275.\372\004"
+	.text
+	.section	.gnu.lto_queueAdd.30.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\360\006\305("
+	.string	"zH\254\017Dp\234J:\377!!\004\323~\253\206\276\277\212D*\253\211\336\355O$\215\202\213B+j \342m\336\327\031/\206\005IQ\304\221\006\314v\366/?\212\017\027BW\353-\226\202\310g\320X#\215\020\"wJ\001\345"
+	.string	"\333"
+	.string	"\355"
+	.ascii	"\376\332P\255\311\376\232\237v\265\252s\261]\222\3261\005\233"
+	.ascii	"\020\005\317\354/MS\245\227\326p\276L\"\277\245\312\026\276\254"
+	.ascii	"\376\321\312\026\332C\035M\265\036\3157\273\026\253\237\021\017"
+	.ascii	" M\307\312\346\322\364\270\300\f\316\227>>\200\371\362"
+	.string	"\374\220\371\262A\223\225\257~\\\342u%8\266\326\376\322\364\310\264J\256P\264t\320\311\343-$\257\376#\364\t\236@ \263$\027\255W>\326\177\362\276\302\342\266\252\360Iv\020\271O\330\203CN\222B\335\017\257\347}\005!\253\223\275\276\307\t\251\300\027\211\034\250\210\211\202\031\263j9\305\307Ir\202\2262&(\230\026\271ila\376\366\332\005f\254{\3728J&\020+\323\343y_bd\2004H\342\034\355\004\250|\205\325\ntJ\323\324\225\013l\307\035t\373\blo\260\315\027\001H{to?\327\240\231[5p\322\334v\311\374?\310#\323\004\3351\333\231_\023jg\264\252\035\373r\237\263\235\377\304S\256\253\347r\235\371\362;\200I\220b\335\343\243\375C\037^\035:i\275c\037\263\352\222\3317\235\036\2625\357\230\355\352\001GF\265\272\210\350n\367\320\317~!W\007\035\356F]\rDV\377"
+	.ascii	"\253\205d\265\017\260:hV\237f5\220\2546\313\352\262\254&ku%\253"
+	.ascii	"\217\204T&\026\246$\307\352\035S\257=xR\274\222.\312\335~\270"
+	.ascii	"W\373\303!M\377\362\243pH$\316\252\300\025/fe]\356\346\277Yh"
+	.ascii	"\253\267\331U?\372^\204H\330\312\3224\025\236\315)\313FJ\272"
+	.ascii	"\225\341\231)\275\034Va\253\372\031\321\374\nz\221\331"
+	.string	"\341{9Lkz\227o\t_\023ci\t\227m\fWC\244\340\346e^pK6\\?\316\233\214\t\334s/\307H\305\\\340~K\317\321~\315=\312c\224\202~\2612\244\233\003$\270d.\227,\243U\355\240\031Q\356\355\366\316l\250\233\211:\323T\353\201_\246F\nr\227O\f\312Y\261\356y\325\222uf\353<\321\254&>FL\215\373\271\306\317Hm\273!\205\fh\200\307\r.\240\035\363\333nA\357\006\233\\\371\273\377\355\031\330\350a\223\333_\231\003\266\236\251\275A;\331\207\367\307W|\220G\306\211\271d\0266!\215v\337\240J\037\332.\333[\201\364;2\264NE2M\323\2644\332\273=\251X\357X\301\207\326ho\024\313\252{\274\240\253N^[\221\261;r\311\\\264BK\245\266\027\342v\3043M\323\b>\230\327I\371O^\232\205\013\027\346\313\242\rRR\325\f\236\034@5\241\200"
+	.ascii	"\265\024\200\205\214\247\031\244\241\226\250\242Z\3208\021\245"
+	.ascii	"\002J\006\323\013\251'\027LPT2\230\226\bx\nF\024\025\323\214"
+	.ascii	"\251)*&\341\261\370\035s\255\277\0232\177w\223A\240=\332/\350"
+	.ascii	"y\261\311\t\177\367\240\355Z;\0257\253\313\017\026\037\242\335"
+	.ascii	"7@JGQ4q\350\036\356\325\256\355-\210\220h\017\207.\221O\034\277"
+	.ascii	"\257:\245J\232\016\237\023]\223@t"
+	.string	"\217\212\252\315\241C=\027\320\356bYh=\230Xmh\035\3234ep\264;)\335VC\277>\020\376:\377\304\340\325\341C\347\210\252\320\332\"H$i-\226\321\263\237\235s.:\337\237\275Q,\213\320\306!\"\3011\300$\f-\313\003P\317\r\256p\355\022O\365\\\226`\304\270X\366\335\304\020\340f\305\365\210\007\226\264\021n\225\243\340G\353\263d\036\243XV\200\222\250q4&\021bfFD$\210$m\206\003\240\002\221\2512n\020`G\263I!\255\001E[\231\352s_\316\263\027\331}\266L\3231Z.\260\273\211\265\344\277*C\252$\214:B\322\316_\032B\214\255\367\264\236\257\214\310J@|\214Qh\233\324\265I\260,\222+%\360-\017\220LA\032\250Q\213*\270\367u'M\340\222\365\234\331\277N'\200G\352\332\305\326\210oUfj\b\360\256Cv\347\346I|\344\316u`\224]{"
+	.ascii	"x\376j\3742\"\226\034\223\001\250xq*\032\0320\321`y\324J\321"
+	.ascii	"~_`\241F\223\366\360\302\362\220\367\243+k}\024\361\034\367\021"
+	.ascii	"\034Y\261\2250\340\214\333Q0\267\377\3103z\256~U\264q\345\bG"
+	.ascii	"\033\233\214\203\240i\021(\266\302\n:D\255/U\bx\2570cD\365\205"
+	.ascii	"8g\224\322Y\366\205\370\004\227\\\300\355\367\271\230\367xe\361"
+	.ascii	"\003\253\300\207\216r\235\316c\b{\342\277r\336N\342]\023\246"
+	.ascii	"\346\264Q]gk\177I}W\236\206+i\300v\305\222\372\032\326\251\310"
+	.ascii	"\311j"
+	.text
+	.section	.gnu.lto_queueRemove.31.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\300\003\365\032"
+	.string	"\246r\255H\260ZM:P\262\374\341\034\361y\211feT\342\276a\034\244s\265\360\211\260{|\n\305\326cj\260\332\232mZ\377\250y\031\243R\254\314\340? \347\3678\262;n`\303\\\tpx2\261\216P)6B\310\336R\312\024\230"
+	.string	"\216"
+	.string	"\236"
+	.string	"D\266\251\266\275K\2117#\321\347\373\021\246\326\252\263\364\027\304\2459s\277e\355\037\177\034-0\346e\372\006Y!\265\035B[W\255H@\232\324Z28\217\270\364\345\022"
+	.string	"\227\212+"
+	.string	"\\\332"
+	.ascii	"V\273m\313\245\026\253\344\203\250\210U\255\345\253\225l\017"
+	.ascii	"\260\263\334\203m\333\020\244\263\331\366\275mH\362\210\212x"
+	.ascii	"9\006kv\034-\025_\354\234\023\204\370\250A\362T\314n\362E\031"
+	.ascii	"y:\356uZ\206b%\267%\t\357h9\354\251\265\236w<\027{q\377\263\370"
+	.ascii	"\217\341\357+\001\275-\353u\321\361\325\377\177\330#4\261\326"
+	.ascii	"\032\341kd}A_\034K\177b\306"
+	.string	"\273[\372\2355\202.Op\374{\353\211\fUc\371\322\224\244\257\263\333[\n3pN;{,\3232\215\312f\3762\307\235\364\357\003**6\336H\377\315\016\331u\235O\236o\323j\376\330\374\232\355\355Y\224/R~\330|p\362\351\344\317\346w\363\231\371[ \305\224\225\030\tP\265\266\370\235\251S\364I\216\355\355\376\2133\006\266E\266\034q\252`\377:}\003\313\264=86s\235}\255\200\224\016\317\321\225\225g$ZM\231*\023\006g\004\200]\375\307~rt};\231\246\246\277Q+u\251/\216\203x\324\243vcv\226\273\246\227\274\242\252l\346#\323\016[\354_\004\t\336\335%\314\030\352\333\277N\204p\270\214\330&4\005KPb3\230/\023!\006K\265\326\335\375\227\355\022\332\004.K\225\204M\245vG\013\226\325`\207Y\206d\344\370G\005\234M{\301\f\361\350\236\275DiX\315\335}"
+	.ascii	"\315\220\216\034\377N>\2251\360\024\243jv\322]\001@@|\036\037"
+	.ascii	"\0071\330\007\b\261\035\002\"f>(\346c;\262\237\021B\036~B\304"
+	.ascii	"f\257\022@>$^1\331\354\265\223\340A&~d/\024AA\262\327X\342\266"
+	.ascii	"\221,la\342\203\002\2776\360\223l\033\233~\017\256s7\302N\372"
+	.ascii	"h\203\336t{a\235muQ\253\307\256pE\307W\25726\013\006\216\177"
+	.ascii	"U4Z\275\263\326Z\301\233\336\336\346,\330V\337\364\322\036\214"
+	.ascii	"$\006\222\024:\273\325\254.Z\247\315\240\364\203\b\252\307\346"
+	.ascii	".\372\007\360\257a\003\357\216\354\356\333]\315\3414^\241+k\255"
+	.ascii	"<\001H\250Q$\207\fR\320\220\tFdf\204R\347P\002A\312\210\352\020"
+	.ascii	"\210)I\262\034\345\335\251L\261\317\241Y\226z\\\265t\371\025"
+	.ascii	"\006%8\360\20550Y\254\252\237J@\004\374\346\367\013\372\031\021"
+	.ascii	"P\202r11@M\274\346\257\320Pn\377\367r|\210\036\210d\265\332\242"
+	.ascii	"\263N\321\361\030\371\027\371$\317w\034\242\2515\bF\0364\341"
+	.ascii	"\304\024E\016\2244\223\034\212\214U\361\023R-\032\370\303W\t"
+	.ascii	"\211~\333:\037&W-\353\236\006\256\314\001\307\236V\305\r\025"
+	.ascii	"\374\215\370\350Z\254\303\212\341\362N\203S\024\362b\006\r"
+	.text
+	.section	.gnu.lto_queueFirst.32.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`>"
+	.string	"=\b"
+	.string	"b\01788@\217\322\001@\375D\347=\001W\033\350\224\312E\021\232\200\235\223\3603\030\240_\365\033\362\372\264\230\022\356>\223\274(\212\252\177\002\324`qr\337D\374j\221l\"wJ\001\3166\234\026\321q\320\0362\216\234\200h\220\220\031\307\221\033\003o\024\032'+\266\215\223\231\271\277VI\252\005!\305H\370H\207\331]\005?\344\"\035\337\364h\013\217G\t:R\037\302}\220O\233\370&_X\005\357=\372Va\217\232\022+\004[\206%\247\225\205.\366\004A\335\260\177\255\222lC\353\025\200RYX\355j\264^6%\246<\354\243>v\306?\375\343\343n`\226F\330\352$\203\244ewJ\317k\260G\314\005\260G\345xw\330\371\377~\261>\026O\004:\004`\330]CO4\272\365\266\017lK\333(\001\016"
+	.ascii	"i\331'c:\374\f\267\254\374\030\333O\363\202\214%0\327N\335\342"
+	.ascii	"\232\310\033\002\313\214H\334iS;\311"
+	.text
+	.section	.gnu.lto_queueNext.33.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\035\t"
+	.string	"F\321>90\345(\035"
+	.string	"\3607\312\257#\016\007\364O\212\0363^\314\301\026y\215`\300\017\b\343\332\217u\325>\306\361\252\322\306GDDb\222\300\373)\330\b_\223\213_w7)S\n,"
+	.string	"."
+	.string	"-"
+	.string	".0\033\256\232].\232{\001\374\343\234"
+	.string	"\376i\310\265\247\346\337\344\233\231\026\315\2262=\003\034v\327\271\245T\267\336\266\202\355h\177\023\037\233"
+	.string	"l\316\224\nb\177\263\272\262\235~\231\316L\037\016\254\2644\304\354rt\001\226\345\275F\354\267Jv\307'yI\311\232\001'\242\202\001$\022\374{*\360JE\321\330&s\312\316\013\277\246^\303\003\225\235\375\223s\216\371,c\030\226\337\376|\303\340\337\365\340\245\343\224\235;\001\376x2\320\304\b\002\024\361\021\305\n\211\007\212\370\311D\321\223\340\220\005(\213\027\241P\026;\334^WO\021N\212\312\270\212\306\331]\006?\345.\221\317\372\363(\016"
+	.ascii	"i\331'c\261\346\315hEi\264\320\234\220\034(C`\261`)\031]\310"
+	.ascii	"q\007{2\215\023\327\212I\230d"
+	.text
+	.section	.gnu.lto_taskSystem.34.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`]\001\345\r"
+	.string	"\306XZC"
+	.string	"\225\222\016\243\345\3410:\202\340\373\216a+\203u\264G\364\253*1\244:+g\270P\206\321~\203\021\026\315\022;b\371"
+	.string	"\b$$\351\003l\245\226\345\207\021\205*\357\275\257D\201i6\326\310\336R\246\024B"
+	.string	"C"
+	.string	"F"
+	.string	""
+	.ascii	"\036E\017Q\217\360\006\250Gov\220{3\373\031Fbn\212\354n\245("
+	.ascii	"\276\035jn\276\347\344\303u\246C\021\327\001\335\013\024\355"
+	.ascii	"\356a<=t\247L\317\311\356:\271\016\304\035o;\202\355\t\366i\002"
+	.ascii	";\211C\204\307&\022\3333\245\236\260\017ww\2552\266\246c\246"
+	.ascii	"a\2465\323\231\351\203\n\214\330\001A\307\356\207ogub\316\n\333"
+	.ascii	"\007\331\007h\036<\355\267\270\213\355/:\370\263k\242\006\307"
+	.ascii	"\256\267\300&\001\030F=\236\023\0025*\314\021\223\344\252\n\325"
+	.ascii	"\343\003\246\246\3075*U\3650,N\371\335\254\244*\b\200\363\345"
+	.ascii	"\356\232\324\032u\265`\003\344%\217\330\217q\031\232\257\302"
+	.ascii	"\245\226<\367\350\267P\217\327\222\024%\\\3623\2016Aa`5\300\340"
+	.ascii	"\300\032\205\264\n\027)\205\002\213\312\225e%K\200\255Qvm(]\270"
+	.ascii	"2XZ\245\222\202B\252\254L\253F\t\214q\270\262\212\005\303\262"
+	.ascii	"\n\344\355\341\252\214%\220\320q\321\023\274\261\202\340G\210"
+	.ascii	"\333\334F\311\314\220\234.\252O\34354\220\002# \220\002\261)"
+	.ascii	"\363\\\023RZ2i\357[\346\266maDV\210X\210\216\313\030\r)\314="
+	.ascii	"\255\2675\036/\033\346!\274\200\027K\363\033\337`\310\324t\271"
+	.ascii	"]6`\270\344\341(\b%D}D\231w\242;\266\265\037\r\270\344\003\226"
+	.ascii	"\226\333\256\245\007"
+	.text
+	.section	.gnu.lto_getCheckFuncInfo.38.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\027\001\355\013"
+	.string	"\006\026O@ Q\224\016\263\202\224C\366\274\023\027\305E\214\250c\214\200/"
+	.string	"\274^\0328\007s\301\334\326\333\206\035\251\360\210'o\213\226#W\002\300@\202\226"
+	.string	"zq#\250\212\252.6\277\3456\310&R\246\024:"
+	.string	"9"
+	.string	">"
+	.string	"\250\027\"\273\037\003_&\207\376^\271\016'7p\035\272\263i\374K\355AN\035>l\354.\246#\336=;\377\036\017\340\231FO"
+	.string	"\022v\327\351\231>\334z\333\tlW\260\017\"%bl\336\260\277Q\252\b\373\326\356\256\025e\277\343\2772meZ3\235\231\276\200\002\"002v=\224\340X\0228B\302\366)\366\201S\204\247}\023_u\357\020\235\300n..UK\317!GiEG\365!\036\251\266\347 *\264\324\005\253\253\235\341\037\334dw\037\370)6P%\245\022y5\374\023G\301\371*o\b\345\275C?t\035^\025\314\bA\312\022\347H\276d\032D\007\032\b\321R\3214\037L\374p\023:1\333\304\001\216\226-\273\300Y\3106\021\204}8\031\017\0267\020fA`\rC\266a\0324m\303(\337\336ZE\231B\013\022\222\226l\251\3159\013\030\002\357\032"
+	.string	"|\232\220\226%2\366\206\317Z\334\252Y\320Vd\360\203d\320\004\0220\001\272p\331\021<"
+	.ascii	"wpY\023\206\003\022\2468\316\032;`,(k\033\312\352t\031\373[\215"
+	.ascii	"\006wy\321N2"
+	.text
+	.section	.gnu.lto_getTaskInfo.39.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\253\006\275#"
+	.string	"v\377\335F\200\234NcK\037\006H\372%QUX_U\034\264\241]U\212\245\005\360%d\b\305B\030\334{\355u\206Ci\240\312\013\002\377,TCX\230\212\261\250x\372y\351\311\3059\017zf\005\f4h\223\275\267\224)\005\301"
+	.string	"\271"
+	.string	"\320"
+	.ascii	"U\027\243Be\354bh\265I\363\323I\351\317\035\257\340\237\034\314"
+	.ascii	"\017\333\371\n\332\017\253\272\023\233\001Y%\357\221\001\220"
+	.ascii	"3%A?\275\341`U6\357\347y\266\216\\\260&\317dx/\024\027po\226"
+	.ascii	"\231\n\351O'S\235\266\340\253}%\347\032\276+\205w\367\356\340"
+	.ascii	"\222ror\310\n\322\237@\327A\177\232\037\200\376\364\320>\363"
+	.ascii	"$\362^\254\007\013\260\267{\357\317\362p\357f\362>\353\360\350"
+	.ascii	"i\332:\364\277^ix\371JS\036U\034\3159^a\035\213\365\fR\343\246"
+	.ascii	"\311\200\353\310V\316\321\312\264^aWx\307\253jO\366Z&WLS\036"
+	.ascii	"k\274\352\214\356\275\256\306\343\214[w\333+l{\260Q\256\2676"
+	.ascii	"\210[\231Jo\306\244\224\243\366\003\005\372\323\202\031\333\354"
+	.ascii	"\245S\231\022*\262\035\342e\302\003j\367\336\005R>E\204\377\343"
+	.ascii	"\247\233\234\352\215N\350\317[\241\265.b\235s-\313\202vk\234"
+	.ascii	"\235"
+	.string	",V\253e\277\bmK\017\333,{W\375\203V\373\364\230\325<_\336\275{\375\001\336\365\003@\253q\322\352]Z\235\246\325\272\264\032\325U\237h\265iV\333\263\272\236\325'`z\301\262\345\303\246%o\21497\367\354,\003\362\345o\337\177\362\245Of\236\207\037\263\253\336\304\207\242\033r\345\310\275\227\367\323\366\225bTF\305\026\327\034SJQ\362vo2\350\347N\221\240Y\257\fEf\204\t\220eL\373\333\352\372\362cm\013_{Z~\251\374\277\276c\253q\006\227\206\350\003\265Z\346\3650{\254%S\203\336\263X>\266g\035p\361\307<\315f\376\017cp\225z\243\253\240?}\354\356\006\261\316\271\355\350Y#\242y\357\275g\217\375\362@B\357\331\036\373\253\034\305:\347!,81\034YXL\253e\036km\324\327\232Um\343\217\331\037\036\206*\365\321\016F\003\207\244$\364'\217-\260V\006"
+	.ascii	"J\234\005S\306Ki\035\364/\337@\007\221\354&\221\035c\247\360"
+	.ascii	"\006\345\031\276\350\200s\263\366\312\003\021k\234\3753\252\002"
+	.ascii	"\306/B\240\232\027km\027\243\215.\325\332\035\316\305v\361p-"
+	.ascii	"S>d\026!\002$\226j}[[\002NRJ'\314\246\246\n\025\242Dj\005J\300"
+	.ascii	"%\242\020\301%\237\016\223\004')\245\023\250\227|QB\022SL\302"
+	.ascii	"\021KR\277\022MJO\277\245(\251\237\317\200\241L\b\243~'\240\240"
+	.ascii	"\242~\274$\3616\013B\232\213\260(\247\377\204\236\354\023\304"
+	.ascii	"\310\205E\261\377\023\372s!\356\214h\213\306\tRa\2741\266\021"
+	.ascii	"\205\324\027H@$\226P\bi\304\261\300-\270\035\221\332B\214\261"
+	.ascii	"\355\274\315\320\324\356l\017\333\225\\\321H]qTT\255\204\276"
+	.ascii	"ZLm\021\033\035\222\252\302,\311\347\216\210\344\204Cot\226h"
+	.ascii	"\r\032j\355!\327\343\216L\260\341\222\303\035\001\337\204BlP"
+	.ascii	"\013t;\255\355\340k\036\254\211p7\t?\265{\255\332\204\t\324\324"
+	.ascii	"\234\366\267\326\245\306\2646\205\243Ab\253p6\244\037\362\336"
+	.ascii	"\033\177\2501(\346\230b\b\221\310\310\310hZh\f\320\002\221!*"
+	.ascii	"\036\021\0209\247\030\262I\025\245\r\340\214~\342\364t\375s\222"
+	.ascii	"-G\240\257S\262T k\\\240b\265d1F\303\327l\370\2140\262\355?\354"
+	.ascii	"\323\336\177\f\024\316\352<\370\353-\371\270\232#\355:P\262H"
+	.ascii	"Xa\276\375}\036Jw/\n%\240\215)-4|F@\310b\263\337\013`\350\211"
+	.ascii	"\206\263!\023e\220\233\032Rc\367\340\206\204\377\240\322\232"
+	.ascii	"\241&\003\375\267\274\025}Px>\326jj\nC%\373\257ld\253\272UJa"
+	.ascii	"\337\031uYti\312\006{\307f\306\022\233_\231R/\232\003W\003.\342"
+	.ascii	"\215\026\214\030\311\230\203\201\201\201\020\231\340(5\322]\371"
+	.ascii	" KA\212\306\r\311#S\004\245xRu\351\026|\244\307\314\035\013\250"
+	.ascii	"\324#\346\031{\237\215\267\346X\005\001\350/\330{RW;\231\326"
+	.ascii	"\360 \211y\360_\210\370\003"
+	.text
+	.section	.gnu.lto_histogramAdd.43.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\257\004M "
+	.string	"\246\273\317I\220XN:\305\261ql\375\252\246\332=\214\313\301\033wT\355\235w\241\272\277\325\236\216F\241\025aw\336gk\177$\234\003\265\301\350\316$\212\310\035\221\b@4)R\n\256\360`\202\233\016Sr\224|wk\204\020B\244L2\272"
+	.string	"\265"
+	.string	"\271"
+	.ascii	"<'\037\033\217\004x\253\243\275\325*\305\346Uke\260\025\322\233"
+	.ascii	":%/\205\357\274{\"/\002\274\221\023\237\251uj\313\253V#\203m"
+	.ascii	"\220\336\\\343y\347\315\364\003\316\233\013\334\355r#\216\212"
+	.ascii	"ViQ:\256\325Z{}cw/\215\337\223\201GO3-\233\201\373\037\317Nm"
+	.ascii	"WeZE"
+	.string	"\244\243e\217E\221\nPT*%D\335\b{\027\n>q?\236n\246OOK\005QT\234\336ufQT*yc6\266\374\370\003@\210/\270\314a\245\t\313\264\212N\357\262GD\366\bP\024\226;/A\230|\353\314TLbF'\324Z\227\227\212.\276\267\357.\217\335\335\260[>\0058^\0027^\234#\27777^\233\232\033\371iR\336\231[\375\273s}u(o\016\345\305\241\2747\2247=/z\362\236'\257\211\362\226\347\355\223\227O\336\027H\220\026\025\243jK\227\031k\213$\231*f6\351q\344\317u\236\016\337vm\216\267\303\267\313\265`:I\306Z\274\320e$\262\246!=r\277\265\271\005\256\321\223\354\265P,0k\373\254*-<.\037\363\263\254\216NL\241\250\220rvs\277\304(w\223'\305\267{%F\307\"\221\"\021S%fV\316j\255;7\371\307\315\361h\370\034@"
+	.string	"\036\313DZ}\240Zf\\\316j5\356\334\334\f\033_d\260\330\372\255\006\2140\336\367\2349\315\324\311\344\177g\331>Wf\373'%~\251\216\375\211>\023T\260i\272\373\303 \302\357\224\363\315\375!\020!'\233\301\252\344\364\261\220\377\361\217j\232\"\026,q\232@_\300I\2347\215\323&\226a\232\220\t\331M\037i\323:_\260\363\246_f\350C\310\311\005\3003\275Gz"
+	.ascii	":\277d\323:I\215\264\273\236\351\346\242\324\026\344\344\362"
+	.ascii	"\327\0212$P5\302\272\251\366G\347\256}\256\252$\361\230\375\326"
+	.ascii	"q_C\310\256\365;5\t\271\262\353g]'\310l\313\223\341%\006\255"
+	.ascii	"2\333\256Q\310M\265\373\215r\364\362\265=\265\213\343\315\t@"
+	.ascii	"/\372\001\3613\3629\2110\374\004\001\025\235\333\240\347\301"
+	.ascii	"\017B\207\b?\036^P\317\220\007\241\"\"\240\017\267\375\361\f"
+	.ascii	"\375\2040\342\360\363\341G\324\023\001\324\023\324\373\r\021"
+	.ascii	"\365x\016\254\320\210\237\241^\221\220\320P/g\f\276\247\326\002"
+	.ascii	"\233X\260\205\233+\361\023\360\377N\\\347\232\325p}5&\250\340"
+	.ascii	"\361\270/1d\025m\252\275\3450k\332\314\221\356\\\327L\272\246"
+	.ascii	"\220%\211\307\224a\244t=!\310l/k\255\365\254\351s-\270\256k\372"
+	.ascii	"\303(\004M_n}\203\343Kh\013\236\366\255\033l\330&\344\344\210"
+	.ascii	"\364l\232F\357\344f\237\2726\233\325\336\365Tm\006\261{\f\255"
+	.ascii	"\b\232\331T\373\033XaEL{j9W\250Q\030\306\224R\f\231\231`&\020"
+	.ascii	"\231\321\246\rP\0021\246.\353\020hH\233$\315\001\032\004\246"
+	.ascii	":'&p/\253\244nl\350\211f\360x\001_\302\212{;B\254j\200\324\314"
+	.ascii	")\357\241\335\250R\1770\252nB\276&\341\033\274\031q\252\027\210"
+	.ascii	"\353;\302\327>\023n\215\267\2614\021,(\032h\274P\231\211\311"
+	.ascii	"\016\250\331\006\\S\r\347aHp\320(\302\361\200\177\257\357\345"
+	.ascii	"\253\360\342<\211\244\317~\311\006\260\374\2031\034Y\31743\250"
+	.ascii	"\377\361\265]vP\035\313Y\371\260\330^\"ls\024*rq\367D\n\226\342"
+	.ascii	"\f\251\367x\021C\020\310\343\236\343\341\\c\214\317\320 \003"
+	.ascii	"\036\002Vd\221\261TE\217d\300TD\251\032"
+	.text
+	.section	.gnu.lto_schedulerTraceAdd.44.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\366\005\205#"
+	.string	"v~\336J\200\330U:J\020zXa\260\326\350\373\362\253PI-R\302\201\344i~\321V\252M\245\200\222w!\316\336\330\300\226^j\016HQ\002\301\361}\003@H6\004\001\307\375u\257\245I\\\367\211\236+\005\333D+i$h\357$\003\303"
+	.string	"\276"
+	.string	"\321"
+	.ascii	"-\226\271\351\201\327\363\n\350\351\256J\317v\357E\374\224n\326"
+	.ascii	"\226\271i\247\0074\t}>\355\244K!v\347\236\376Q\316\3259\035\230"
+	.ascii	"^7\323hUbZ\271`\304\030\232\365\272\241\034=#\231nK0d\230\345"
+	.ascii	"\274\004z\332"
+	.string	"E\255\273\322\273ZIL\021]=\354\004\251\246\223[\364\330\361\225sV\320\035\326\247\272e\357.\317\244}VR\337r\346\361\274\260>\375\251\351\206\364~\273\177u\254\366JX<@\316QX\276r^*h\241\365i/\337\243>]\317\243>\355\266\033\315\227S\331F\025M>y\346\234y\330\307\333\337\266\177\256\337\224MJ\277\266\b9\347\276\312\246\031o\374\356>\320\335<\272U\004\001YN\027c/ \336\005\353\340\213\237\204\372\320 \333\2719\370\270;\304\210{e\347\240\\`\245\356k\021*\273}\317\362[s\316\f\260\224`\327*\026\352\323\343{\246\264a\274\321\356\021\302\204\346\3147\255{y\274X\252\373\265\214\243\272m\267w\317\372u\266\333<g\276w\256\365\353\334\311\237s%?\316\355v\016\3476.w\373\226\273\275\342n\333p\267\325\333\355\364v\273\266\336\306\266\333w\275\375\001\t\314<\345"
+	.ascii	"\362\002\207Y\346\245\250\233<\226\202\0059\363\357~_\312\305"
+	.ascii	"\272sM|W\377\353U\036\306\253\032{\272\3129\347\232V\3124\255"
+	.ascii	"\354\276<\201Q\361\002F\305\247\311ot\373\023\330\206\357\231"
+	.ascii	"$\324x\243`^?\327oXV\031\315\214\007\357p_$\233\263\347`\036"
+	.ascii	"\374`J\fy\261\343\230Ma\177\215-7Ko\324\344\233\326M\365M\240"
+	.ascii	"\037,\007\337\253\307*\2439U\334-\341k&`\251\255\247\032\347"
+	.ascii	"\225\316\024\253\230\300\261l\013\212\243\321'\251:8\305\274"
+	.ascii	"&eZk\216;t\270\233\302\323$a\251\255#9g\006h*\344\312\264\236"
+	.ascii	"f~\346H}*\200*\207Q\007Y.\373\241\374\347]'sT`\252U|L\005\021"
+	.ascii	"UC\034\204\271\030\013\335\0270`\310\320G+\324\214\003?\226B"
+	.ascii	"HP\306\233\326\020\256A\335\3015l{\222t:\336h\3370\034\370\314"
+	.ascii	"\377\030O\366/\033~^\325\035>\334+?\250Ow\260\017\225SC&\210"
+	.ascii	"\206jG\302\"\334CA\304\241\242\017\310\013\n"
+	.string	"\201@\341oW\004\3720\373\013\262F)X\342\2124,\006\331\224\005\022q\b\n\211\212F?v\005\013\200Hd\203l\321W\264\026%\220`\213C_\221xk!\337\202_\257D\203_P\317\t\242\257X\353_\320\220-2\"\301\016\375\210\274 \221\017\310\373\r\211\274 \003-D\301\016yE\241p\310\313-\215\257e\034\345\301\310\230\021\037;\207\373d\327\305\345\242tf\3450>C>\021!\303\021\271\306\326\310\256\n\314U\272\371\206q\370rIB\215L\357-\352\212o\370\310-\3077-\326\232\263\361\312~\332\335\264H\332$-V\213\245>\305\301+\306Md\221\243\025\023\232\323\206\273\333%G\233\260{\266\331\005r\250A8\245\224B\004)3##\243\240I\032\003\260\002\221\0313\036\021p\261dE#\005I\ncO_\257\265\372\230\3664\364\337&;\323\"q,\274y\026#\301>S(NYJ"
+	.string	"\037\233\2103\301\246\030.\273\342\rm$K\351\264d\252\b4\020\257\204\302p\0024\374\217\211d\203\016\245\237\270\304\260<\202V\372\303]_%[\3410U\0013\373l\336\206\355|'\343\310\212H&\305\276K\352\360\355\235;H\001\303"
+	.string	"\211pG\033\317:XE\2556\032\372X{\232\3263\"\206\200\237,5x\027T\333qH\333\241\274\271\004"
+	.ascii	"\251T\272\002Y\214\373}\020\324b>\362q\350\3128\366\221\347\275"
+	.ascii	"v\305X\342\032\312+ET\233\351H.\354\221\341\020n\0034=\200\261"
+	.ascii	"1;\310\bt\243\253+\"4`\252;\b\242\267u]\227\300'\372\203\221"
+	.ascii	".\344E\005"
+	.text
+	.section	.gnu.lto_getTaskLatenessHistogram.45.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\375\t"
+	.string	"\026SF> \005)\035"
+	.string	"N1\300\342r\245U\250\204\204\374\216]\203\020\013jz\033\214\324\204\340\350\255\376\226\324\332\007\006\223s\300f\352\021"
+	.string	"\203\305\032c\322R@\316\240t\331\354\373\r\221M\366N)4"
+	.string	"3"
+	.string	"3"
+	.string	",\267\024\352,V\260r2B#\260[=\327\203\272S\317\017\272\323\251\362\326e\313\377\3149\227\234\333\bs]\016L\354\256\345\b\213\335\363\266\033lW\330\266\005\266\245\345\353\177.\241\266c1`\227\344f[\035\212\323b\233e\177l\004\023\222\224\366c.\303z\0051\301\256L@m\267:x\3449\rq\266\375\227\303\004\340m<\026\"Nm\207\234&\202\002\354\256\004\315kT>\313\251?V\362\343\251\277\352N\345<\200\261\344%o\376\310V\026\260\253K\316\024\373\334\356\256'J\036\225\036>\210\013\322'\002\231(4\304R\252\363'\nO\033*\323\t\343\023=\216\214\022\312\373B\321\0231\030\3548\205^\n\004C\357S\367\2263\364\232\"\366oP\006\263\321\016\r"
+	.ascii	"7\215O\313>\231\026aX;N\245\215q2m\311\246-t\215v\301\004\001"
+	.ascii	"'\236T+&a\222\001"
+	.text
+	.section	.gnu.lto_getTaskExecutionHistogram.46.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"\345\t"
+	.string	"\026\223E;0\221\322\001@\026.)F\276~dd\313\342Y\004fQ\306\364\223\215S.\004\264\327\177\354h\026\030L\336\275\206=\303\302q \260S\317\210TZ\345`A\236\327<\331\204\354\224\0024"
+	.string	"3"
+	.string	"3"
+	.string	".\277\njm&PB\342a\333\331\255\240\353E\337\351\347\241\357\264\033\371\353\363\345\277\345\036\312\r\247\224\301>\001\034v\327\263\224\315\356\356\266\021lC\330\306\005\266\247\347\353\177\217\340f\023A\263\373\221\303m\r\2359\261\355\262Av\210\3074\247\375\225\263\270^7\034\260K\323\221\331\255\t.}NG\236m?\345*\001\342a2\f\030Nms\334F\212rv\267\301\345/,\337\344\324\032\255\371\362\324o}\247\263\373M\t\022\2339\203h;{\354\n\233\235\210}ow\327]H.\235\024\302\005\tSH\022\241\036*\310\323\352sH\032S\026,Tj\"$\301\013\212\223\n\fG\022$\035X\304H\215\340J\024G\020T\367\236\335(\326u\330\217Q\r\324J;\r"
+	.ascii	"7\215O\313>\231\026aX;N\245\215q2m\311\246-t\215v\301\004\001"
+	.ascii	"'\236T+&a\222\001"
+	.text
+	.section	.gnu.lto_schedulerTraceSequence.47.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\355\006"
+	.string	"2M03`O\322\001p\030\035$\313\250\233\020\033\376\006s=\275\027\005G\bTFlH\333\003=\022\314\032L\002\344\242\210)\312\332j@\021\302\331\305\330{K\231R\2364\026\325 \241@-L\033\370\300\220\340"
+	.string	"'k\0035\005\256 (\013FT\225\005\243\270o\253\237T\251B-\354\233<NH\0171\005'\217\335\371\234w\227\032"
+	.string	"\242q\222!G\034\2332v\364\244v\330o\253\037\333\351T\002\230\027\204\224]\214\320\314\2728\026\220\355\216\035\371#'\351\370j\361#{*\240\013\224\230\335\b\245\017\274\273v\201w\247\036\277\236\227\377\2227\221\226\025,\363<\001\016v\327\211e\031\267\336\266\201mh{#\t"
+	.ascii	"i\331'c\232\364\206\241\r\026\272\206\337F\214,D\036\356\212"
+	.ascii	"\251\235d"
+	.text
+	.section	.gnu.lto_schedulerTraceRead.48.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\t\007\275*"
+	.string	"\352M\260\020I\200ZN:\177~\245TW\314\271\325\310x\365q\313\276\030\321\243\022~\222\033\026sU\247\340\353\3214l\333A?\354\265\027\364\246\2628s\232n\023J\351\207t\317\223!\374\366\244\271\206\\\252T\377\377\256\215\020B\210\334I\006\377"
+	.string	"\341"
+	.string	"\365"
+	.ascii	"VF\262\260\017_\210\005\275\302\304Jd\201Ey\201\221\"\202\307"
+	.ascii	"\227T\330\361\212\333\275I\017\352\317\235\021$\346.VS\251V\250"
+	.ascii	"]:\326\334\356\275F?Y\203\252\033\203\324\366MX\315\314\271D"
+	.ascii	"\033[e\367^\004l\201\013\222\345\"\341\223s\211L\216\025\324"
+	.ascii	"\237:*H\267\314W\362%SO\232\270\316\2757\300\312\356M\"`\005"
+	.ascii	"\352ON\252?r$S\314jfr\013y\035_VN\316\334{\217|\347A\177\232"
+	.ascii	"\337\241?\033\007\247\313\345ry3yF\355\324qj\212\236f\333)~\232"
+	.ascii	"d\246\255u1\"\251\216\003\312b\021\343\252Y\344ff\346l+b\230"
+	.ascii	"<*x\030ov  +\256lj\246'T\360\270AZ\231\017\336\334\316\236v\302"
+	.ascii	"\242?^\374L\223\322^t\005\212\021\371\342f\213\367\r\222h\372"
+	.ascii	"\356\2757\273=\"\253\254M\223\356\275l\215H\026g\2333s\222\231"
+	.ascii	"Q0\243?\002\367\r/\205\366\232@\333\266\"\231*\030\275~\331}"
+	.ascii	"\303G\271\222\311\367\035\374\241\311\336\330\204\376\354uO\216"
+	.ascii	"+.\273d\253t\301v-\032\346$\225m-\346?\330zs\343\276\301\\\324"
+	.ascii	"\226\r\234\353'\032\372\327Y\350`\347\2407\371\201|?O\376\005"
+	.ascii	"Nv&\360\262s\357]g\237\243\235y\027;\367\244\226yR\313;\326\362"
+	.ascii	"N\265\254S-\353\250\226sT\3138m\371&\265\034 \265\f \265\234"
+	.ascii	"\263\226mT\3138\325\262\232ZNS\313hj\371L-\233\251\345N-\333"
+	.ascii	"\324\362\215xT\264\\\200r\257\212"
+	.string	"e\232\233\345<\353q\264\277\353\377\372\301~\261\237\354/{\312\374]\027\022\377\214\237\306\271\235\027\032\253M\371Q\375y\346)\276\327\237<\354c\207r3\316\351\326\224I\371\2109\227\250\003\314GG\330n\332Z\214\223q\026u\1771\215\316\353cP\363z\202\025\242}\303\222\305\353\243\335\274\367^\264\250\217v\337\201\363\272hH\031\004\352l\034~\274\334{\037\360\263\\\213\022\177\307O\376\255\366\306\025]\363\300a\207\004\372\263'\307\031\256\211\332\246_\024r\256\202\252\215\353\027\201\250m\235Dx\020E;\355\263\315\352\252\352l\264_\254\301\353\263\315\243P\016\351\366R\236@\236\255\305&\212\2101\373Y\244\313\376tO\037\231\215~\264C\300z\332\315!YV\031$\250\017fvP_M\267m\263\005\250)\222\001\352\356s\314j\315\320.\271\247{m\273\303\334\3546\312\037=\23544}\276a\257}}5"
+	.ascii	"\2244z-"
+	.string	"\222\020\351\326j\rL\326\210\366\215\177\272\327\357\207)\372\250\232\361\323\027;\004,*\022\202\274\255\035|\023\350\317\237~\231\243\214a\f\002}\262L_rZ{\t\304\332\301\024\002\225\204\301S\350\024\365\364;\235V\241\220\t(\005\\E<\345\226V(\250'\340RJa\204R\223Mpe\002\n\235\326\224\025(1\3705\330\340\340\227\200g\3759\255Q!\326\240\312\277\004\300\025D\324\322\332\341\027<rbRj:\372\001\203G\t\200\370\tj\005\036\t\237\236\200G9\276\357\033|\255$)\324\241^\217\210I\215\356c\240}\303\256b\237\016j\003m\325\212>\244\360\264\365r5\3061\303\235\346\361\351\235\266J\237N\032\342t6\247wM\324\314\0302\330\033y\001V\261\251X\327D\275\323i\235N\233jV\216\3239\375\261\"\220\233\306\351[\255\031vP\3374\332\2066\324\357\272/@\017\265m\263\003\364"
+	.string	"'E28\313\3452\371 *\324"
+	.ascii	"\332\034+\3260\323\201\275!Q[\213/\345BV\271\304h\001\3260\211"
+	.ascii	"P\377\353\276a\256\205\332\266m\3115\203\034W\\\001\200\217\250"
+	.ascii	"a8\347\020RJfDD4I\013\255\001P\0021\346\030\231\007\020hI\242"
+	.ascii	"\264\001\255\343g\310HUNw&\f\004\372\032\224\b\261?\342\335d"
+	.ascii	"\0016\324\203\r\321\331S\226\320\302\035\\\346\277\373\216n-"
+	.ascii	"\321\330s#$\005\020\267J\006z\t\301\017\323i\031-a\201C\271\307"
+	.ascii	"\275\204\326|(1\253\307\262a\257\f\024~\250\272!vr\336j.>\n#"
+	.ascii	"\373?'\226\323\375\341\373S\260\036\247\344\257\200\303C@(*,"
+	.ascii	"\233-d\206a\267`\207\2301\235\241\332Qa7,j\364\355F`[\b\330\220"
+	.ascii	"\233@j\036u\343\031d\225\330u\245\216\347\357\266+\312\273\314"
+	.ascii	"{\034\245\216s\253\324\354q\354@\202S\205\213\354\235*aIB$3\035"
+	.ascii	"\347\212P7_\304\t\351\323\2123\274\200\257\020\"\025\250*Z\366"
+	.ascii	"\347\206\346\031e1c\257\330\022U\203\237{\327\017\347\245\275"
+	.ascii	"\324\270 @c\325r9\303,\035\352\003\327\330+j\203\244\222\025"
+	.ascii	"\367\305t+Y/\207#\231+\355\241\017\2715H\343cv4(\337\274A\245"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_rescheduleTask.49.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\244\002u\025"
+	.string	"\026\350\216I\300RRc*T\b\312nw\202\201\032\266N\362Tu\261"
+	.string	"D\264\313YD\220\246\377\205mF\341Z\3201(\221\031\375\341|\005 \225tz\313\353\272\n\236l\333\362e5\276x\273,\3720\274,W\251_\367\336rK\231Rx"
+	.string	"s"
+	.string	"\177"
+	.string	"w\361#\335\221pLr\257\220\214\245{\177\007\334R\336\256\3745\336\212W\031o\255\263\203\374Gt_\303\212'\264\272\367\302\352\211\353N\216V\254T\347_x\022\363\3149Yr\376|\364\271]\271\367\266\316\rT\024UD\330\200r\235<\321"
+	.string	"\024\213\021\255\223\207V\221"
+	.string	"\320\016\020\256sG|9\231\370q\341i\317\251C)\351r\35755O\017wy\333\031l\313l\352\013\025\006(\265C\261\374\362\251xn|\360\f\202v4\313/_\320\025\325\245Y\366/\207\326\236}\361\336{]\207\354\326\177\177I>x\333#\375\242\245\246\"\365M\316\324d%\004\202\322\275\034\216\020\271M\026\207\321\203\277\375\013\335J9\212\331\366_\034\250{0\367\313\323\201\204\347\003k\352\336_\201[?(o\375+SV\304\350\357F\352\245\274M\351\305N\355@L\252WZ\3173R\362\233\261\254\257\001\204<Ct\206\037\250PT\013\243\321.\345"
+	.string	"\334\264}\341J5\001D\367\336\0057\2364\343\027\335\232\306f\033om}\225\351S\204\bkj\311\2724"
+	.ascii	"y\270~\262(S\225S\t\261\366|\030'+\f\260\307\205/\031\236Odu"
+	.ascii	"\331\3158\215\234_\344\n8z\363\326\307\215\267d=A\021bG\217\330"
+	.ascii	"D\307\325\323S\230@M\265\366\214r\234Q\f38\231\215\210\263\335"
+	.ascii	"f\265\227\030[\355Fs\200\201Vs\342\026\031\202Y\202\b\261\031"
+	.ascii	"\313+\246\301\fNf3z\306r\243M\260\020C\223\231\341`55\031\rl"
+	.ascii	"v\303\301X\006\330F\201v\203\331\330l7X\353w/\336:$|9$\321\264"
+	.ascii	"\253:6Y{\276\017\312\332\232\363%U\262\266j\217\215B[\325\226"
+	.ascii	"\315\350M\257\354\324\034\233\f\177h\265i\317!\241\274\367*\360"
+	.ascii	"c\310\324\\Q\367\336\0320 \200\002\251\022\264\003'\343S\357"
+	.ascii	"\023M\273\267\330F\206\017e\bA].\003j\201g\263\261\206\277\375"
+	.ascii	"/|-7\026\230\273!\362\020\262jZZ07\007c\277R\020~\017\304\032"
+	.ascii	"\236\224c\347\333\314L\303\n\fK\242=\240\177H\260\02697\370\b"
+	.ascii	"z\203\304MgA\323\n\361\224\311\205\374\262\0138:\344H\330\344"
+	.ascii	"\264x\t\313\367\263\245\254u\006"
+	.text
+	.section	.gnu.lto_setTaskEnabled.50.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`>\001U\016"
+	.string	"V\334cE"
+	.string	"\261&\035\1774\362\270\364\253@\253\250\207\324\217\"\2644&\264\326=\013\327\220`H\377\331Z\227}\213\260\t|\013\253\374y\340nkO\374\362\252\217\373\225\213\327\003I\22204"
+	.string	"\240\300\036\215\020B\266\224)\005M"
+	.string	"S"
+	.string	"L"
+	.ascii	"\273\034N\250\330\005\021Xd;\026r\220\354X\374\200\354\230?["
+	.ascii	"\306\301\017{\024\032T.\033\273\313\251\207\177\217\232\237\257"
+	.ascii	"\201:+\026\352q\213\271\336</\260\\b\310\356\276\365|a\24525"
+	.ascii	"\320\356:W\254\f"
+	.string	"7v\333$\266\033\330\207\t)v1\2049\366\205\341\200\260\375\217\227\356&^\343\371\260\320\331\277\361m^\342\273k\302\267\002Lg\225\263a\306.x\340\230\031l\307\fn\367k>\333c{\204\235\346[N0\362\035\\!\360\032\257\231\026\013\266c\0364\272\347I\3703\037\361\235\206\305\235\252\035-\031\346\356\256z%S-\261\211\341\2227\234zU\325\034UL\200\324\250C%B\300Y\262\250\327t\251pR\031:]\204\200\261\211\303\006Q\251\035\354k\030\206\241U\306>\370k\232\316N\363\307Lk\2463\323\007P`\305\013\223'&\357\024E#\224\022/e\244Y\304S\020\032y\320\205> \"\222\023\223w\312\034\372\224F(*\242\021\204\220\211K1\361\"p\241\222\211\373\0300I\302\250\304\235H\244\022\347\001\367qU\306\016X\274Z4\025\243\226\231F\265M*\371\225\337:\210\202\242\254i\246\316\027"
+	.string	"7\215O\313\276\031\323\256dc\301V\240\017,\026\252\204\300\301+L\\\030c`\027ty\346\032\205\013\306\263\330C\273ZA\034\fu\020\270\366"
+	.ascii	".G\r\342\017\245\f"
+	.text
+	.section	.gnu.lto_getTaskDeltaTime.51.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\207\001\245\017"
+	.string	"\226\\iG\300VQ:$\361:-\016\006b0S*\026\344\305q\373\232\335"
+	.string	"\376\323\213\"\323}\002\003Q\265@\027hHl\307\030\007'G\025\306\247\036\004A\020\262O\241\243\330\300\013\007"
+	.string	"\244\2541\nv:\375\217\266\367\226;\245T"
+	.string	"P"
+	.string	"X"
+	.string	"\261\366\363\225\\\310B"
+	.string	"-\331\335n\345)\3632\276\300\274\324\026\367>eT\350\3719\2378F<$\352\003\021Wv\367\364}\200\221\303\221\\\354;q\215\013n\337\016\324\267\023\005\310H\022\343\264C\236O\007\302\222\313\356\032\306\276\022w\351\266)\330\216`\377F*\301\206\333\201I>\355"
+	.string	"\206\210\214,db\327r\240\372\330\217\253=\266\241\247\241\345g\277\032\032*\364K\007\222\212\\P\262;\"\327d\211\310\0370l\337\330'\233\200\220\026\b?\263\261i\227E\220\036\2735\005fA\271\264\355\323x\215\033{\001\373"
+	.string	"\307o0\216i\265\346\245T\025\334\f\351\267\237\240\031\022\205c#B\2458R\023>D\034\305\r\017\362\034\370@\036^(\273{Y\315\274\234j\232\301`\316\276\215\333j|\231gh\340c\227>\315\274\274\"\300\241\200\301\234\003\f\r\261\321\013$\022\252>\036p\233\251\001fQ1X5\230\320\262J\245\274@\200y\251d\246W)\027\013\303\314\013\253\302\352\325e\260\240\212\351V\256W\227J\340\226\006\226\253\223i\265\\\335\251\266\217\253=\376\n\241Y\364\275y'B*\244\324\323nB\002\344\211N\205\312\243v\201\251\316\324\341\251\024\331\035\236\343e\240h7\037"
+	.ascii	"7\215Ok\037\022\246\3014{%kk`\367\355\243\b\037\227\3640\375"
+	.ascii	"\206\206\201;\200/(\005\362B\017\203Y\003t\001C\222\026K\027"
+	.ascii	"\312\026\246%O\230\200]\023\351\265\3209\023f\361\223c\204k\200"
+	.ascii	"\033\241\354Zi\037\215\240\240"
+	.text
+	.section	.gnu.lto_schedulerSetCalulateTaskStatistics.52.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\375\b"
+	.string	"\206\320?< \0057\035"
+	.string	",4\006\215\f\337\3671\205\320f9h\260-em*\304k\301Y\264\246;n\300(\n\305r\251\366\232A\340(\t\006P\352\220u\310(\\\025i\316G$d\313\224\002*"
+	.string	"."
+	.string	"/"
+	.string	"\003\317,\3329\037S\3661-\220\227\235\335\325$\312\305\253\350\277\345\004)\325\351*\020\261\273\326\224J\344\226\267\315`\333\3026K'\225'\366\261\225+\373\254_1\004\222\232\016f7\344\025`]\231\314\212\355{\354\002\027\tU\333!$\236e:\270\316\rkfwl0(\035\334\247\205\236\367i\236q\217\255\\U\224\270P\362\303*\375\326G\223\257b\217\222>\365\314/\005<S\3001A\351\313J3b\263\n\300\036\003\006m\0173\204\0011?\006\034H\341\211\3009\n\301Q\270\205\023\032\340&\342\302\255#\315n\233\t\236\237\217\353H\027\\\306\0045\216\321\266\241\315\017\324>\013\366\002\n"
+	.ascii	"i\312\274\264\354\2331}{\303\3420\r\272\220\247\007\353^j\034"
+	.ascii	"\270s\213v>\001"
+	.text
+	.section	.gnu.lto_schedulerResetTaskStatistics.53.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`.\003e\026"
+	.string	"vg\216I\260TRc(\203f\212\024~\356\334\\6\0362\370\fK;IF\177\326\021\246\343\374\356\342Mz\252{\321\t\364\307\234O\024]\021\356n\300\236\264?\354\017\273\231/x\274\330\200)\037.\374\366\273\231\241\272\367\226[\312\224\002x"
+	.string	"v"
+	.string	"}"
+	.string	"3~w\352\361\311\275I?\246\356-20\314y\333\362ZyK\236\245\274\365\3176\362\"\361^*J\bJ\354\336k\253,\376\273YZ\262\322\237\177\343O\202B\237\233(\302\022/\213n[\356\2753a\bJ\222,'\242\274hB!r\201\327\013\243\2310\210VR\301Q\026\t\232\020\210\254q\251 r\343\351\220\360\207RS\346\336k\032\024\216\270\317\333\376`\273\202]g\002"
+	.ascii	"\2160\272\356\"x\264U\353\320\002\336S\222\225\306(\004\210\216"
+	.ascii	"\271vD\272\257\374\323% \001)\231kG\"&I.%\263\213>\264\016\355"
+	.ascii	"\223\267*\331)\346\237n{\247\237\254\324\264R\237v DbHn\216\334"
+	.ascii	"+\242\254\311\335\262;\230\376\364\333\277\3213\225\0251/\276"
+	.ascii	"\306\357O\276\337 \242\023\241\"W`\367\026]nM\341\274u\361T1"
+	.ascii	"\2129\265/\343\001V\007\254Nu;\303\253\020Tu]]i"
+	.string	"\333|Jw\336{!\370P58\264\257{o\002\342\022\252\244\257&\246\322\352\360\r \006m{\270\024N\001\342\2757B\216G\355\374\245[w\350\365\312[[\037\026,\212A\034\003\233\2624\020F-\032\212&J\025\306\225\202\254C\333\270Yi\214Cn<\312\221F\227Ye\2007\216\303\347/Yg\207>x\353\357\224\267f\r\320\302\004\220\2269\272\336-\2074\314\315\001\356\001\206\030\334K\255f\202\256w\313)\215{\341\345ntjr\032p=\333\006\233\033\216\r\307\353\331^\fx\307!\307\263\345\354v<\333\254xO\336\252t\036\225l\001\353\217m\326\241\177\344am\3459:U\263\246\324!{\205\036\353.\247Z3\317\242\004\260Vh\313},]\376j[\270@\037t\003\244\240\352c\337\007\317y{\017\334\355\371J\203\004\213\256r\017? \220\002\031\232c\007\267\306\247\336'\230^}C\320\002"
+	.string	"\261\027@\006\220\0319w^\265\351/\242\303I\013\333/\\\270$\t\033\036.\030\202\f\033\202m\240\007\2179\205\bT<\337H!\215s\0307\343\266:\301\212\270\033jLp\257)\333\246B\031\035\327\255%#t;\344r\036*\321\356\375\275ff\361\303\013KZ<"
+	.ascii	":\032\026\026\271y\330Ld9\362\202\021\207f}[o\363hwP\270\022"
+	.ascii	"PH|rj{\311\250\317mK\255\364\f"
+	.text
+	.section	.gnu.lto_schedulerInit.54.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"\345\b"
+	.string	"\206\320<8@\217\322\001\2035\211\f\376\215\\\356\324y\004h\005\223\034]\005\025\207\245\3726>!\310\353\323b\350\220\021UO2\205\313\360X\335\375i\t"
+	.string	"\343\210\214(b\307-S\n)"
+	.string	"-"
+	.string	"-"
+	.string	"~\306\236\335r\023i\217\342\3328\261vw\306\217{W\317\177\310\005B\321w\r`\330]k(\352\270\343m'\330\236\266[\001%g\200\364\341\245\017\302.\rT/\240\276\254A\245\264\\V]\266\351\323\350a\037`\343\310\226_-k\305\261\354r\274`6%U@\354?A\020\220vw\241\344&\034\277ti\211m\303.m\316B#~.\210Y\301\324\366`\350C\037\204\342g\r*\365\1770\177\344$\037?\3166\2356\341y\320\"\262\316\244\3408l3\353:s\203`\256B\353\346\005\307u3c\332\307Q\203(\005\306\220\007\364\"?\321T\265\013>\264\255\020\016"
+	.ascii	"i\3317c1\352gHj\356\331\330\244\340\3449\333\330\271\202\235"
+	.ascii	"\302\3325\321-\004\3742\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_updateEventTaskPriority.55.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\017\nM6"
+	.ascii	":^\250\024?P\252\325\030\314\355\003\330\0202\221\231\330L\255"
+	.ascii	"\247\361\211h,\"\345h(\026\333!\373\021\303)x\004\211B\330\322"
+	.ascii	"\2375@\361V7\227c0&3\264[\245\377\035/\367J\312\312-\245L)\245"
+	.ascii	"<\001#\0015\001=\246\3527\334r\332\214W\306\314\314\373\276="
+	.ascii	":s\216/\231\341\352Mg\3161m\276L\fX\357\016\3568p\252<\310\271"
+	.ascii	"%\3102|\3578T\r\247\312\304\233ja\2626&\327*Gu\031\025s\257U"
+	.ascii	"g\376\301\355\344\036\360\317\220\331\315\216\340U\363eNE\345"
+	.ascii	"\306&\264\312/X \332\360\233\275\346G\263\251b\336\373V\231K"
+	.ascii	"\301\266\032L\201\316\241;s\217u\232\037M\326\243\003\274\257"
+	.ascii	"\327\323\316\3736+\360\005\266Unv\322\332*\333\003\326V\231\231"
+	.ascii	"3\f\1770\262\233X\264vZF\260\234r\357\333\024\376\225F\266\317"
+	.ascii	"\355\265<v\267\252\351;\222\333\252}\036\211\320\230X\225#Q\332"
+	.ascii	"\335\2010@h\320\240^\203*G\240t\013\335\202\222\006\323\2368"
+	.ascii	"/\225\340\206\326\250\241"
+	.string	"[\\i\222V\227\254vv\0030[N\234\355d\224\336\265\263\227\034\235Y1$\207\311\244WU\220SiH\016sI\253Az\314\245\247\251\204.?I~\314\2534I\220\025D}\266\364O\031xI\2116t\253I\032\354\023\b\253\235\355C\230J\367\035\210\367}\331\263\230G\232\177\315\314\214\230\331\311\314C\021\374\277\364\351\247\177\226a\312\027\r\255\372\35720f\030\035\350\370\200\255\237X\374\037\270\3171P\017\362|\305\236\235\326~\031m\016]\371#f\216\321\177\234\330\367}9p\373A\222=\261[z\254\255\366\377\332\310\222^\307\355\354&\270\255\350\333\353\220\230\233J\377/\346N\337\367bv\235\207\255\363\206\326Y\203\353\234\301u\026\272\316L\215\326\f\241\331t/\265\233f\007M\326\035dg\005\255\263R\353\234\300\347\214\300u>\340:\033p\235\013\270\316I\2563\001\327Y\200\353\034\300u\006\2623"
+	.string	"v\376\365\234}\256\263\353:\367~\316m\353\314k\235\331\326y\347s^[g\325uN]\347\3579{\353\334\034>\230\351\342\362\242\365\206\232\257V]\2447\220\232\346\245\321\272\3354\267\235\346\243\243\363p\357\211J\023\250klMO\224\222\220!\317{MG\353\211J\233/s\201R\315\0201^\215\206\334w\270\325\034\341\221b\255\266\330:Zf\334\212\260\255\002\333\206\234\006<\204\346\343\021\034 vt0\367\372\2149\317E\320\b_gV\355\177\2715\20076\243\216Croa$\032d\032\357,d\232\265U"
+	.ascii	"\377kk\262\340\351>\325 |\243\005\335\301\247\035be\0261\302"
+	.ascii	";\013\302\267\232)\235\326M\344y\207\323\346pY\361\220\353O\201"
+	.ascii	"\373~\351\271\375\337\007\203\274\025\273\357\3736\303\242\353"
+	.ascii	"\375\322\273\277\306-\303\224'ZQU\357?\200\221%St\"b\353O4\007"
+	.ascii	"\337n\0208\263\212\025\336Y\016\276\321\246(\337\312-\372\366"
+	.ascii	"\210J\035\034\366\277\332\327\300\270\316\354\376\213\333\314"
+	.ascii	"\227.\252\206\307\260L\233P\367Y\247v\350\260\352|?{\303\017"
+	.ascii	"av\237b\274?4G\250\331\347u\355^}\366w"
+	.string	"jK0\353\357X4[\023\373\276W\353S(\243>\263\213.\344\304\376\330\022e\275\265\323\272\341\325O\315\226]J\257\353vv\313\005nJ\324-\271\376\327k\370\316\360\036\267<\343o\224\360\233\325\030\231*\374\364\2014\323\312\364\302\377\270%\030\035u\275\005\020XW\372_\314\364\351\313h\343\307\237\351=\021\026\335Y7A\202\266Y\243\360\022\026\205\363o:\351w\234\016&\035R\\\303B\361\006\024\r)c\016\341\214\033PT2\224\246T\034RPST\304\"\217\021\005~3\244\240\214\305\034\353\261iF\361\230\343\351F\221w\264A\204j1e|\232bA\304AE\302\006\261X\2038\340\330T\214\202j1\205\243h4R\021}|\341i\003qH\243\003\321B\222\215\343\323T\312D\013\306\342\r\252\031\305\032\304\243\020\007\324S\224\220h<\n-4`\251\034E\243pJJ\312(\3545\223\235\276\357\305"
+	.string	"\350\224\225\271\355\326\355\354\022\212\270\312\352\354\272\221\253\002V\360\f\"\371J\237\223\247\0215\032&\367\326W\362\f*s]@H\224\234H\202WB\360\t<\013\301Sh#\003\304dv\341B\234\026\2601\252[z\346\027\276\254b"
+	.string	"\306\225\364\272\271\336\201\277J\347\f\374\201\357e#O\2061\360]\347\250\200\277c\206\237\364\005\276\351\306$=\2058\002\037\251\263\336\004<\360\t\274\232h\331\025\340\207/\340\017\314-\303\324f\265\025\370\001\276\227t-\327\321\2522H1\261oD\277'\034t\370\215\247[\255{c\034\275Q\267\035[G\255\020~\370\256\266<\243\344\323m\031\022\350\273\247\233kI\267\244\rn\255\203I\265n#\001\200\311\250a(\006\231R\250dFDAA\222$\035\240\"\021\272\242\007\021P=dF\222\202\024\245\260\261\031\237\023"
+	.string	"7H\210\304\367\240\0318Z\321_\246\327\323\233\335\232\272#\323sA\022\376c\242\222}\220L\031\335\307\271\252\353f\376\257\035p'\033\006U\343D\300\030\036\300\243FW\254\270Q\2323+?I\210p\314\267;\007e\206_\214\t\223%>\342r\346\330\341\017r\215\220\022)\023\023\267\024\206\317cb\216-s:\226\260e\021\026N\006O&vPM\242\204\036A\352\354\233,7\3748\177\315\332z\266\203\223\300;\270s\013\252\\j\005\350\245\315\n\235V\344\336\203}\320\314a-gev\212\226chr`\006\022\305Z\343\245"
+	.ascii	"\305\246\241\325\036\276\016\203\362\317^\367>\346>\256\220\033"
+	.ascii	"\002\266v%\004\037\200Y/\336G\206ef\"j\363\242\b\020\343\330"
+	.ascii	"\325\354I\362r[w->\007!\237\216\320=/\217\215\250\253e\253*u"
+	.ascii	"\226\247^\223\036\325\367\327Gfzo\233\312\036?@\244\331(\262"
+	.ascii	"\300\217\304\263T\177\225\203x&mY\265q\177^\213X\212\372\203"
+	.ascii	"\245.\323y\233f\035^P\320\306\2721\303}c=\333\023\020\b|\b\361"
+	.ascii	"\320u\315\230\3150\300[T\333\"\364\240x\236|\226\"\350'\374\364"
+	.ascii	"\035\004\360]g\274,\016\231(\304\242t\253\347q\343\301\354\320"
+	.ascii	"Vv\275\236\256\272y}#\361h\202tj\314\333\354\b\252\037\267\n"
+	.ascii	"\226\342Q\257\343R\346\236\3642\177"
+	.text
+	.section	.gnu.lto_taskIsPreferred.56.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\002\003E\030"
+	.string	"\326-\243H\300VQ:\224J\024\022C\3716\207\252\263\005\342\352\274`j:"
+	.string	""
+	.string	"\341\362Hd\025\203?\263\177\200\272o\027F\343\372\247\277\033\252Nby\225<\001\224d\343\n\210\220\237\365\345LK\200w\037\365}\255\244\021\262\267L)\214"
+	.string	"\211"
+	.string	"\217"
+	.string	"\252\212\333\005m\b\377\3154\261v\337\303?:\017\237\353z.\240\326\"\245\244ZK\007\276\t\377\271<\r\370/\374"
+	.string	"\360\237m?`\371\270\366\262\306\020jH\t(HS\255\345j\322x\355!\n\374\350\334\232/\223\263=\374\r\306Q\251\034\020\024\0260\026\244\fRP\032&\242+_\370\342\224\026\220\241\344\"@\016\005]\300Dt%\225\303\355\f\220\373\241\tj\255\347}\205r\270]\024N\255\325\033\224kq\307\334\266\220m\034\366\352\002\266-Q\252\340\326\311\347\035\304\323\222\027-u\237\354\322\266\323\310\376\354\365z=\317\"\373@\376\324\313_\206\256c\256\373\303\013\371A\257?\272\246^O\324z\301\365\001Ph\222\021#G\223)\245\254C\275/u\351K\222\303\366\355#\371\244T5X\366yDh\tle\035\232"
+	.ascii	"&\313Q\315??\027\252b\f\271\220\332K\0043\226\034-\231\261`\321"
+	.ascii	"}\020\377\307w>\007\302\263\252\212\373\321\021\"\374\247Z\025"
+	.ascii	"\316G\331C \373\2409\301i38=\272\266*~\226j\2557\347\035\347"
+	.ascii	"\266ON\315\230\351\005\ns\333\236\027I\027\246\031\250i\344\375"
+	.ascii	"j\2768\300\254\240\rN\247P\315\351\024\261\333'J\240\034\351"
+	.ascii	"\004-\305\211|\346\t\217\245\0338\215\300\223\340\316\r=\210"
+	.ascii	"vTH<\211\3349\245p\3612=\305)K\3227\215\374\317\035J`n\320Yt"
+	.ascii	"\027\370\031B\327\3339\261un\304\025\326\212\213\340\027y\301"
+	.ascii	"\302\033=\340\277\317\031\033\272\333\366\366\3235\020\234\224"
+	.ascii	"\211S$^\244\207\030\f\303k\224\301JX\030+\274D\013\007v\304\023"
+	.ascii	"\261q\366\322\220\023\023i\031F\0279\333\021\307\016c\016)\233"
+	.ascii	"\321`\007xfd\fF\3068\264H\227\370\342\271`@G&~\310\031g\255q"
+	.ascii	"g\224\001\360\215\b\241\305\032!\241eC\243#\023g\324-\233\330"
+	.ascii	"\270C\313\031K\264d\253\027)\272V\255\230le\243\3000\023cl5\203"
+	.ascii	"\301b\253TYO\353,\262)j\316\363\236\001\213\225!G\300#\375\373"
+	.ascii	"\246qn\363\307\264\326ZC\325\306L\231\031N[l\0055 \200\242\231"
+	.ascii	"C\037\003\246\226\344@\003\306q\231\221iK\262\355Uew\256#_\220"
+	.ascii	"\224\004\037\024yc!\366\001\257^\336\316\210\204\366\030\343"
+	.ascii	"q\363c$\262W\265\335\003lX\232\236\321\261\364\305E4\376`\f\211"
+	.ascii	"\307U\217\340\230q\f\0211}s\247m\316\f\303\306,Z\277\331\341"
+	.ascii	"\272\017|7\001Y\220\300\312\361\032L\234}\365}\264\337a\216\031"
+	.ascii	"\334\"\271\352N\333\256P\006"
+	.text
+	.section	.gnu.lto_scheduler.57.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`4$E\250"
+	.string	"\232\t\315:R \306Q:\303\0014::\354\312\207\007\007\327;]\361\267\227\332Fe\213\006#\353\241\305\371b\035\206\345U:\312\202\0052c\007v\336\344\351Og\235~V.\0348\220S\306\226\370\256\362+\306\023\r\306\272[\302#y<+\345\261_\027i[\312$\003\265\003E\003\223\003\273_N\302M\f\300g\313L\202\266\352\320\226\204@$\212\207\031\315"
+	.ascii	"\274$\204\245&\027\264#\315D.j\315\\Pb\365g\245\260\275\212I"
+	.ascii	"\f\260\373s\204\214\313:N\230\024\304\030l\331\b\207u\2340,\254"
+	.ascii	"X\241P\032\023a/.\"\244\366\325\301\033+_\376TU\265\023\205\273"
+	.ascii	"\224mV\372n\270\302O\022\204\344\324\350\264\314AS\274\303\\"
+	.ascii	"R\027\\\336\342!=f\256N\223\23174\231\031\b&\211\231\031V\013"
+	.ascii	"\221\326D\021\231U\251\027*S-`\222\230\265P\274#u\303\353|p\301"
+	.ascii	"\375\234\023\366@_x"
+	.string	"K\323BgpJ]!\312\310\24738\225F\325\261\004\236\007d)~\230\003\016\312\313\021\211\202\200\022E\344\347\360\301qP\316P\323(J\242\007@\003\343\\\316\003\007\001\365\246\024?\024\342j\321$2\003j\346Mh\354/\231\252t0\240u\370\204\342\r\037\354\232\250\375\233\275\337\376\030\331\004\031RW\365cR\240Z\214wnh\350\333\273/\274']\242\366l\366|\373c\234\333\373\203\246\375\035a!jof\277f\341l\260jv\211q\026\323|\255\272\231\345'i\252v\177~f\367g}\334\314\n\245\220&EU\325\023\242\3664\354\365\214R\312\3600\312u\321\361V\261\006\037\273?\037\366\234\313\031\360.\207\341\rx\335\307<\206\337}\206\347\355O\220\txV_\200Ud \201\017Z\344L\026\273\020\256\222\251\357z\203\202\375\335\275@F\311#\327\025\3252gK\f\n4\260\274\230\254T5\213"
+	.string	"\n\345\255\2043_\016f\3710AR\325,\252\222\361\250\361\342\373\221\342\207\033-\006\271\361\"$U\333Z@\251\274\215P\3740(\207\271\277\260<\235\220\253^\352\3259P\270?U\215\362(~8\304\315\026.\267\274\013\nHU\272\024Z\367\266\243\370a\243\211\300\030\026\335;\242\t`Q5G\361C#Z\324\265<n\371-$0\r\211\252cF97<-sT5\252\342\303E\240\370!\323\215\210\037\246G\022?\\\356\302y\264M\365"
+	.ascii	"%\362\3542GUU\250>aw\227\204\236F\277\306%\246\313\247@\341t"
+	.ascii	"\302DS\t\022#D0\205XRJB\002\361\301C\207#\243\"\344\221hH\310"
+	.ascii	"\030\004\364\343\323S\344!\016\323\346\345>\357#\226\3305\367"
+	.ascii	"\274\214m=\005\336Q\234I\303\235\360\362\370D\335M\244)\376\306"
+	.ascii	"\340\360U\254.5\n\243\342\305E\302p\023\230\227H\031x3\266\344"
+	.ascii	"\253\030\230\364\247\f\016\033.\362\205I\214\340i\341\204\254"
+	.ascii	"\001\027\361U\314\013\f\314\224\"\317\276\260\341\"\027\261\212"
+	.ascii	"\321\220\256`ce\311Q\020\243\343\020\\\362\240\360\022\221l\313"
+	.ascii	"\225\222\342\2640R\226\203\310\022\210\205?\300\335\003\\\312"
+	.ascii	"\024\310\002w\320a&F\313\240\023\262*?\242b\224\246\230\222\032"
+	.ascii	"\325\251\302EX\3206q\234\220\305\035\231B\315\300\025\366ULJ"
+	.ascii	":\324F'\316\003\243\360\221\267\234\310\355C_\305\334\362\332"
+	.ascii	"X(\345\341\n"
+	.string	"\243\362UL-}\200\316\037\231\2739c#O\213\005\220\245=\250\311\201\2320\341\037\021N\310\320\356\263\212\241\245L~\027\201\202\330\022\356qs\022_xZ\340\234\220\245\275\3703\326d\236\264[xa\206\257bfi\004q,\270]\357\311D\037h\222\017\221<MA\244\2259b\034\033\2226\2451\341\315\327\234\277\306\270\270\257\367\024f_\344\366\274\214%9\363\264PUu\331k\214\354\253\342\273}b\367q\273L0\002L$h\006\345\004!>\314\243jX\251\372b\316\304T\341\1776U\013\311\255y\301.\357o[\357\326(\305\341\227P\"\261\033\216\234\231!L\247\n_YB\211\375.n\255\306M\013^x\232m\333\357\331\200\353\335\347\t\364\354Y\307\"4\005\375\265\351\260E?\357\3059P\263g\035s\tw\321_\353v\n\372E\337\020\246\323\301\0053\341R\320/\363Tm6\031e8\244S\275"
+	.string	"gY\230\336+\211-\372k\367N\"\034\264\240p\nV\356\354\0362\bhh\337y\311Y\361\252F@\337\231V\245\252\225\332\230\235\271O\235\236\231\027\337\330\211r\032\336j\245E3\231\220\207S}2gb\272\350\251N\3278\003\371V.;\372{gbJ\365\216\3565|'\342[\343\326g\311Re+m\266U\361a_\311\235\031\302t6\355a\337\357yG\252ut\332\251\237\363\255I\267^\221\352\333p\246\356\267Tw\027gZ\263\273\377\274c\205\247t\300\375.mT\340(VEU\035\302b\031\212\026\235\345\225\242\024\036\304\017\337On[\326\374E\346\312\326\032\206&O\360zEh\275\377\311\037s\335]\301mA\212\252\252>\260\274"
+	.string	">a\t\267\227\362\341.\263,\343\226q\304\017Eh%72\\\027\307&\360\223\275\333K\331%\227\265\343{\255\035\361C\243\266@&\027\356\327\373\324eY\323\274\370\206\360m\020\360zOUp\302seb\203r\204\n\013\013\013\357D<\231K"
+	.string	"]\037\002\361v'\300\232\323\212\306A_\206\020\274\373\"\006\337\213\203\376\030\247\365l\325\321\307;\023\223\t7\211wiX\300\367\322\321?[k\366\326\362\334\330\333\240\034\225\tw\243Mn\266\335\263Xk\200\262\375dwM-\255\t\023\264#\336/93\273\222$H\216\224\235\354cba\177\363=\330\275\376\367=\221?S\336;O\367=\027\023\311\373\255\307\371^=\340w\251\225\362\212\220\305\317\357\025\020$/\002\220\274U\027\363\245\232\372\336w\307m\370Jy\200\344\355\3402|98\336W\207\221W\003\356\372\342\270\221\301\373\276\030\\`\303\202\0324fT #\006\214\027/\363\245\300\305\311|[\334\356\033u\344\235\340\310+\301\2217\202#/\004G\336"
+	.string	"\034y\001p\344}\340\310\353"
+	.string	"\213#o\003F\274\f\034y\0278\362*\360\2017\201\017\274\bx\340\2052\342}\272\227\357\001H\336\025G^\025G\336\024G^\024G^'$\357\211#\257\211#oS\007\336\022G^\022G\336\021G^\021G^\246#o\210%%$o\322\303|\221\220\274 \214x? y= y;\034\361\036\035\361\032\235\356[t\304\213,\342=\036\361\022=\372\035B\362\032\217\274AH^ $\357\217\021\257\017\222\267\007\311[4\342\345)\342%\"y\207G\336\364\310\333H^>\362\376O@\3305\325\270"
+	.ascii	"\355\352\275\250\032VXGE3$S\205\237\347\256\377\357\217\363\003"
+	.ascii	"\376o\376\276\177\357\267\341/\363G\177\027~\272\337\313\037"
+	.ascii	"\346\027\363\223\371\355~\031~\274\027\005]\243\277V\351JzS\""
+	.ascii	"\026-\343F\277\350\313;\222N\r\234\214\032\027\364\351nt\213"
+	.ascii	"\245f['4-\351^\275)R\006H\255\036\352/N:\227\214&l\220\316\325"
+	.ascii	"\213\274\240\213h\364\"\321\350E\326\350'\351\257M\212\321\213"
+	.ascii	"\024\2437E\312\350+\271R\263\241I\005\275\344x\365\243\031\364"
+	.ascii	"\275:\275cS\226\324l\333\344T\203\003\342F\033\315"
+	.ascii	"\241\231\371\240\325\031\364\327\352\275\203N\352\007\376\250"
+	.ascii	"\347D\241\271\354\016z\331\231\306fl\315\240\037Ej\266\243\023"
+	.ascii	"nf7\032\211\235\025D\240\232\021\017G5\232F\177=P-\315\303\325"
+	.ascii	"\336\264\203\214\216\001\324W\204\253J\244\377\007\242O\204\277"
+	.ascii	"w\304e\203\350\366s\2420\030\203\306\007\025PM\035\224s\266."
+	.ascii	"(~\036X\200R9\372\222N\300iT\347\251\230;\317\272\"\264\017\035"
+	.ascii	"\332C\313\350\253\037j\264\207\016g\270.\350s5\3739\323\232z"
+	.ascii	"G]\203\035\243>\352T\317\231\206l\2426j\236;'\n\307F\346-\241"
+	.ascii	"\305c\257\250a%\352\031\214\355\347%\207\311\200\037\255\211"
+	.ascii	":\005\3036\327$:\370\307\354\320lg\375%\375\263fA'\226&\027\206"
+	.ascii	"\355\375!92\323\342;\021\315\272\005\235(4\271pC(\314\223S\006"
+	.ascii	"j\324lb;\304\232\375\236w\352<\007\341\252\022\276F\225\267A"
+	.ascii	"@c\237\316\231r\260\302vSM|\327\3433vS\036{!\273\243\241(\251"
+	.ascii	"\310\225:ij;\211aw\031\306d\204\024\213J\360\0052\325\214\371"
+	.ascii	"\306Q\337J@N\021\277\325Wre\232\177\340od\016\355o\360\217\331"
+	.ascii	"\337j\017\202\317;A\255\243\317l\020\202\3167\256\017\013\235"
+	.ascii	"\fy\217\337\022)P\300\240\346&\253g\032\343:\245\221\357\316"
+	.ascii	"\022\355\200\266\2406\266\331\302E\355\307Q\031L\220\247/K\267"
+	.ascii	"\262\345\024UM\334\262\017\310,\261\354\0362Z\375\350\323o\264"
+	.ascii	"V\263^\340\213j\260\254\352\261\331\026h\016\315\210\220\212"
+	.ascii	"?\357'\372\206V\374H\226z\207\226\372G<\350\035\362\240\017\350"
+	.ascii	"\257\025B\352M\207\220\232\005\321\256x\227\275+\342kj\013$\201"
+	.ascii	"\210N\215\nLmnE\206\2146z\251\277\3268\243=0\302h$\240\336A\207"
+	.ascii	"\004\310I\215\225\005\246\336\324\250\t5\333\376`\t:Y\337\315"
+	.ascii	"e(Y\241\250\342\030\004Y CI\022\033A\025P\301\362\031A/\352@"
+	.ascii	"\247<\353\212\fw\030\375\205A\377\364\0133sJ\326\356\247{\314"
+	.ascii	"\230H:\0303\372^l\364\3510\350\367u\034\3014m\306f[)sgi@\037"
+	.string	"\233\321\025\364W\023\347\031\025\240\364\007F\277\350[q\f\372d}#\2745\207\027\3750\025\364\275pP\230g!Y\325\261\266r\306.\ba\261\214\205\004\033\226hP|\037\353\025m\2660\325\224\0015\333\231\314)\201\343\363\260\336\264\307F[\320_\034\275O\002\\\354\236\206\241\266,\201\357\345\323L\317\336\332\031\335C\325E5c\253\005}\272\237f\013\353\323\235\211y!D\033\375\260n0\3164;z0\264p\307'\007\221\247\257\344\372\236XG\037\254w\227l\313\023\370^<\r\301\032Wo\021\256*X\377\315\007\260\306dB\255\225\267\004Y\321\246\205\343\226nQ\226S\246\200\265Q\0332L\277\023\321\255\203\235\245\214\253N\017\217\213\336\224\350\242\377\354\257\367\271\311aU\261\374t\200\253\020\342\275\\\202\265\013\302S\262G\325\001\254\256\200@Q\365\250\312\332\201\2045\374aUE\244T&\177$\261\244l"
+	.string	"a\271\240J\032w|Ax\202\372a\345\303\207\325\324\007\251SYU]%\201\020\2259\250\222J R=\222=J+ M\325\243\n\204\251aU\025\007I\376\020\302r\221\304\312\232J\216\020\003k\204\344\217\240T\231#\351\243j\003\254\037\311\253\253\254\251 \254+),\001 y(\245\260z\260FHb`\265\301Q\017)\021\256\222X?hP]IeU\220\364Q\205\325C*\251A\222\252J\211\225e\225\004$\004\253\352\312\252\352\352\306T\225\017\251\037B`P%\261\246\222=\222J$%\017\245\324\006\037\374\250\302\252\222\n\002TL&\240J"
+	.string	"<\246\244\260\004\220\314\242\002Z\004\244\030\230j\340"
+	.string	"\016L=M=\031)yLUm`\334\251\247\253d\217,\252$\bSJ\250\037UR>\240\246\256\224PO\"\326\nH\362\n\n\313\312\352\n\352'\312|?\351I\301\n\341\263\316)\253\377\006\005{\326\205\340\265G\025\373\306\240avs\025\220\252\252\223\250\277\026\372\340Vu\202\036^\353\216\310AG\365\004=\324s\246\365]\211\352\333II\261\001\177\2555h\034\235\247U\303\231\004\315D\231\264&\202\226\240Q\200q\342\240\327K\"\350\t\334\220@\320fk\035\200\206\240\207\202\316\2643\235$"
+	.string	"e"
+	.string	"\350#I|\017t\003\r\200&\3369\323\034x\240=\330q\276\r\033h\007ZI\320y\247\311\205izL\331@'\265\331\302\354\033[\225\240\235\315\376\024\234\\\376\006\377x\370\036\0021\253\277\326|\347\304\322lr\237\027\312V\225\311\317\304yg\0057@F;\023\323\354D|{\205(\232\315\251\331vi.\016\216\t m\344\214\243\322\244\243q\364\027\003F\030\260\223\325\267;\023\223\257z\2015Z{|\257\254."
+	.ascii	"\361ND\005z\201\376\320\305\231\226@+\320\354\367-CD\240\023"
+	.ascii	"\350;\313t\227\226_QU\231\367\332~6\021\2556Zn\264\374\374\210"
+	.ascii	"\037*5\002\215\324\305\271\302\0078\254*\343\350\205\352]`mH"
+	.ascii	"o\305i\256\f\240\372H\360\252\371y\325\347\262\326\354-@\034"
+	.ascii	"\315]'\2004w\001i\005\2545\365\200b\320b\203\211f\333\247m\265"
+	.ascii	"\267rh\001j\t\362\275\264\004\211\037>\265\261M\336\252v=\307"
+	.ascii	"\335\2526\301`\245A-B\276\3272\r\351\255=\337^\026\342\foOJ4"
+	.ascii	"\333\022\341\330\214\270Z\013\315\301\231\021\361&\255A\177\335"
+	.ascii	"\360\022}%\327f\b\323\201\263#\204/P\205U%T\272\231YY\325\336"
+	.ascii	"\325\262\303\203GC=/9*zE\212\326\321*\232G\317\371\326\314!E"
+	.ascii	"\377\313\036t\325\240\371\353\215\267w\206\206I\302\b\030\232"
+	.ascii	"\264\276\032\2124\2610\024\315F\300\234\332D\243\350\3339\321"
+	.ascii	"N\202S\305\023\375;@\245\211"
+	.string	">\336\331\036\334\177\242jvF4\033\331\330\271\310\0376\007'\206I\277I\023\223#eM\315dcZ\205\034G)\304\307\242\251'8c3\b\302\215\032\241\b\034\304\022\335c\302d\221\333b88`,\321\212\355\200\333\026f\221\023\321\355\235\255&\242p\231\303\264tA\277lIF+1\334\225z\207\\\237\323^\231R/\273\3417A\232K..\342\207Em\314\nI\264y\216h\021Mbo\331\365\\\202\215\350\036\263\262\026\321l\347y\207\r!S\257\361\222\363e\0271D3\245\341u\331\365\265\004\003#~\030\242\227|\346\256D\007\345\204P\032B\3227\212z\211~\244/H\322Kt@\2037\250\362\3500\017\203\32014C\"2\222$I\007B\n\020\210\203q\242\327\366\006\022@\2251\211\245b3\"I\222d\2171!\315\fv\260\366 \312\200\337(\255\204\374W,\202\275\321\203\222#\035\351\004"
+	.ascii	"E\370`yC\236\215x\247\376\215\273f\255\324\361\236#\326\243\005"
+	.ascii	"\367\225\005\005\036\024R!\0262\242\2748\334\253d\001\335T\262"
+	.ascii	"\261\236k\321\2015\016\267\320\004\346\340:*%3\321\226\334\177"
+	.ascii	";\322jK\265\206A\371VF\352\365\312\364<\004=x\222\351\r\2127"
+	.ascii	"hP\021q\027\303\2066\\\036\336@\242i\204\241\002\225\032\246"
+	.ascii	"\004\263#\376\030CT-\236\276\245`]\270\211\027h'aZ\307\241\035"
+	.ascii	"\252\204O\n\326_n`R\330=\361&\221\217ovi\213\215f\033\376\034"
+	.ascii	":n\243C"
+	.ascii	"\273,\221\036'\375;\025\026\304EOL\311\001\215F~k\"@\214\017"
+	.ascii	"Q/\265\271\271z\367u\017s\3573\246?c#W4-\202\35322l\023\277\364"
+	.ascii	"o{\002\210\bs\235\225\226\215\336\030\325\246\342\314\266(\330"
+	.ascii	"%2E\234B\006\025\365J\3151\003v\177\006\305\261\003\303\333o"
+	.ascii	"\277\330b "
+	.string	"@9Y\250\242j \f0\367\272\207\212\273\003\020|j\350k\315\240\265\321\320\332\330\352[:\366\360\264\357\215\256\335\032\035n\337\230\377C^\325\033\323\323\303\316\364\037N\371\023\273\2561\374c\330\204\354\221\336\306\331\234\006\376\367\241\261\026!+GI\3165\353\255q`\321FSX{\225{\362\227\320\206\312d\203\352\2050\033Fz\340\256Z\3712J\260\250X\353\313\322\327Q\232G\016B\036\026kX|\025\237v4\337g\r\270\017qZ\372>\324F\324\273\001\327H#j\266\346\261\2011\335[\357+\210\332\350\342-W\240\360\251}\314\326)\334\274s\251=\207\340\365z\315\300\005\304hG\232\242\337\230,dO[\204\237\323\233\361T\300]\024\221\036\004k\020$B\340D\354@\314\301\324\026V\377\323W\b\344\304Z\220\3064\307J\221\365\035\334U\373\335-{a&s\222\213\3642a\241$.z;\251\205"
+	.string	"(\305\177'\353\244$\f\303\001\324\026\217\346o\315Q\261#\317\243\323o\307\350\021\016\346\366\035\317>p\f\305\223d\353d\003$.\004E\355T\276\031\301P\t2\316\247\020\246\303\377\261\223u\324W\377\360G\034Yc\017\315\276]\204\2335D<bn\264\bP\020\376\331h\242o3\034\241\331?\nSb\240\265?\207S\327\211\367\367\305I\274\033\275\274\\@\330;\277>\226\252\303\234\344h\325\b\335\332$\315\033U\242wt\322p\344\221\027\250\304\262\245\233"
+	.ascii	"\263\013\276\355<\223\317\360\252:eed\237\227(\"1\306g<z\366"
+	.ascii	"='\350|\325\321b\302P\334B\037\363\034\330\267\026\236`\016Q"
+	.ascii	"\017Lb\b\271$\321\342#fu79\361s\363\212\327\227\310\257\035x"
+	.ascii	"\0172{\323\207\377\001\336\372\366\024\365?v\023yz\316\324\375"
+	.ascii	"\304\bF\035\027[%\222\r\254@\354|\335\213W\355\316\023\244\t"
+	.ascii	"\225W_\313O\305IF\021\300\235\003\224\365\347\263s\\\271\302"
+	.ascii	"\177vcU\033{M\272\366\r\255]8G@\020\265\037\226\236\376#\025"
+	.ascii	"\344\261_\357\364Ij\022\246P\313\243\204\027\255\205\017}n?\306"
+	.ascii	"\342%ysbY\265%\037\221"
+	.string	"wKWgl\033\357\202\bB\224\324\177\370\324\304\r3+\244Vl\006\232\277x\242\351\005\216\2213\213w\255\0078\323\274W>\241\265\"\f\272s\373_%\004R\037\366k?s\206\266\223\302\210p\272\320\300\246\333\fs1b\n\331%\342\215\266\034c\332\301\241]@\234PH\203\036\374\026=\261-\323m5\273\331;\223\272\267\306<\233\026\"\262\021\034\220e\275\374\340\311\243j\363\3066\0010\301\211 \373r\252\346Fa\b\336\354P\353\366#\371\f\016\022\301e\373h\265i\213\324\351\026\342@\356\2600\356\207\320\346&L'\355\326]L&\341\316Z\363{\374\202\237\254\262:\213\277\327\031UI\367&\234\333\336(\250\215\360Z<\220\025Dx\337Pp\016n\206\200\017 \035\350\240U\242\272:\310\030\315\322)\222\274\207\222>y\3279\321\301\304\332~'\336\274j\t\255\301\272\275\277\313\013\370\274\277\037\252\264"
+	.ascii	"\247\0237\347\255\221\023v\372=\211i\312\352\245\027\037\204"
+	.ascii	"\3306C\244\204\345\027\002\037\022z\344\250%\213\007`\215Zi\036"
+	.ascii	"\324R\342\320q.\362t\370\243\327v\3309\272r8\r6\013\3274>F\341"
+	.ascii	"?\035\354\332\030\246\361\016\177\006\206\227\346\251\242\343"
+	.ascii	"\346+\311[\335\246\347R6\324j\331\347qD\300\215\007<`\035\220"
+	.ascii	"U<\326\300\307}\022hi\231+\335\353\020\337\026`X\357\373\013"
+	.ascii	"\236\253D\273.>7\245\241\214\206\271\211\342Dk3R!\036\036\310"
+	.ascii	"\t"
+	.string	"vH\035\321\375\"\312\227\356U\232fg\024\316\331\313/\002Y\324{R=K\003\031\340\\\031\t\223\260'\034\032% \214;I\211CP\035xD\365(\310\255\227\311\0308c\256\f\352Pq\277\255\376T\207M\255\237@\220\277\252\247b\304\266\324I\327\203<8t4\265\357\2110,:{\222\n\r]\214\370\r\235Q0\033C\310vcO\251\342\026\004\206+\022\315r}C\307c\254kH;\371\001\372s\223\221\n\234\364\351\200#\211\344\254M\324\020B\216\031\267 P\317\031r\330I\260\233.\362y\364\360\022\344\303W\353\312\212\201\337V?C\300\002\211\016\217e\315\324\005\035\2758\316\277&\326\266\"5zL\263\253>\324\2014EZ`\025\374\366\025!\376\210\032d<\345B\300\242\007\256Qi\322q\304\231\217T3\303\247,/\276JAM\356\305P\244\307\2769F\365J\310|\271\201\350\257\035\260\307g"
+	.ascii	"\245\320w9\277j\265\250\221\"`g\310\336\2235\255q\315@\3352\025"
+	.ascii	"K\025I|\251\233\036\270\200Q4PiP\326\341\260+\300\252\232Z\340"
+	.ascii	"k\034v\205\335\253J\f\007"
+	.text
+	.section	.gnu.lto_taskIsPreferred.part.0.73.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`z\003\335\030"
+	.string	"\346l\240G\260\334(\035<\276x<\b\304'\240\340 \256-\f\251Z\252!\214Z;\033Q\322\324\277z@\360c^o\277\tY\310\377(\226\001I\"\375\231\235w1~\205\252\036\023\327\357\306_\224\327\245\302Z#\204l\"w\222\001\213"
+	.string	"\213"
+	.string	"\211"
+	.string	"\267\006N"
+	.string	"\233U\327\243\374'\2072{\224\330\007\334+\004\346\350^4\302-\357\204\267\214\376\300w\033\276\300w\313\374&\314\263\222\341\230\231yV3\246\035\rr\003o`bLas/\252\272m \247\375\263^W\220\306\257A\271\027\377l\244i\354o\244U\202r7\356y<D9,"
+	.ascii	"\222\2401\202\312\331j{\005rXQ\n\220\203\341AP:\242\343H\257"
+	.ascii	"3r\265Z\t\034\004/\334{9\304q\016\317\314)\230\231\bs\203\bl"
+	.ascii	"?\364{a\345>\372\327\357\376\347\250\342\b\340q\357-}s}\330,"
+	.ascii	"E~\364\033\2752\237\371F2\376\321\221\030\305\262\027\235\210"
+	.ascii	"V\001\316\030\243\031\3526\025d\305|,WT4x\201\336\233\0058j\234"
+	.ascii	"<\270\345\347N\246U\031\2651\367\336\235\324\216\242\023\321"
+	.ascii	"\2162\350\321\305I\027\206\205\267\225Y\206^\\\n\267\262\365"
+	.ascii	"C\374)\2472{\025\0265um\265%$\302\333T\225\222\262\355\244\304"
+	.ascii	"\022\244\256m\027\344A\366(\261\004h_\312\260\r\324$7\215\344"
+	.ascii	"\314\033\035\266uC"
+	.string	"\267\177\360\327\266\301\366\302\304PR\363\342\342k\tK\314\343\271\220\266\021\b\311IZC\346r\221\215Z\031\257u^w\237\311n\211\371\304\267\224\341\275\266\t|--z\370Cn\273\031,A\001\252)\367\253\322\221\034G\035\373\336%vfl\265\r\037\351\247\244$2\267\266.Ku\303'\372\201\252\033n\260u\314\3574MSn!f\256|\342\312\246\260r\310\225AS\345\317T\003'\\\245\b\363\265\301E\236/\024\031H\f.1\303\202\226\270\302$a\256\016,S\374\341@\372\224\260\226H\206 Y\345\t\373y-\210\301J\363U\232\037\306\322Gt\3054(\3509\305\021,\0226\222-\362\314\341\035Q\302\2702Aa\3249\320s\2120\217G\035\223l\375\260H\024\343\251r\225\242\217j4O\225\216\003~\245 M\025\354\3652U\250{\267\205\270\nI\305XS\023Iix`\237z\0063\237\232/"
+	.string	"u\215\373\336\275\367~a{mjoKD\250q0\005\215a\0023$\201\210\210\004m\324\001\240\242)+\333\020`H#M*\035\003b\226\034\370\200H/\351\234\232\324\223\333n\256\261P(\306\242pH\001m\001\016\2528\325\357qA\362\207\304\332>\021%a\354p\017\251j}\360,\341+\2446\327\314$vh9\f@V8\203\203\f\272d\247\331\310\353+e0\326\256\004\201\206g\007\377\240"
+	.ascii	"`\360P\234@\265\254`<\314\241T)\243\345\034\00109\347D\025\241"
+	.ascii	"+\221[EQ\2146\377\276d\364\272\351\003"
+	.text
+	.section	.gnu.lto_queueAdd.part.0.78.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\342\003u\032"
+	.string	"V\260\245I\300VQ:$!\031\225\350\n\004\310j\rQ/\300\317\225@\213]\240 \206\245\267\025\235\0063\223\215 \265\207\365O\033=\271\366\276q\020\020\273\354\226\240LV\311M\214U\2301\324%T\225p\375\017\005\3645K6\331;\245\214"
+	.string	"\224"
+	.string	"\220"
+	.string	"\257\276\257\307&_=\302\263\tt+w\227\206\245\342E\347K\337\307\177\364\374hv\002\273E\274$\273\245\003\323\254^]\336\300\370\272z\314\370:m\277\207\037\274hC\017^=\256\275\264\201{\215\024(\220\242vK\327+\255\341\001\027\313\233\316\332\253H\347X\363gP\316\304\353\231\276@G\220F\225\245\034\213\213\242\352\007\207#@\356&\326H\r\177o\372\024\312\331&\005\220c\305g\314G\225\315\356z\325\342V\335v\b\333\026l\361@_r\241\337\364\333\rcgb\0041d\020\365\202L4\017\275x=x\237\017\204\001\354\341\241\304\202z}\311\225\370\277,\277\230\202\335\260\307S\022\263\311\245\037\361\221\2304\355Fl\331\203\370EH\032I\274\335%_\211\330\370"
+	.string	"\255\270\304s\352E\261v\020\221\375h6\016\301\340tR\303W\226\357\365\245#\371CX@^\366\207\370B\236$\273\222\203\255[\271\271\tFN\275\250\335\255\260zm\211\217\031\221d6y\037\315\007b\3226\355G\263\026\005Z\233N&\027\032\366(8\b\254\354n\004\377\211\304\006\1777\033_\037\004E)\255A\024_\204v\211;\315V\273[\343?9\224\034\177\367\352\016:\363A:\224u\345g\233S~\323WR\232\206\\\240\226&1\371\311M\252s2g\027\377\350\267\315.\246#\325\331\257\261!54-\262==\256\246\253\250\232\246tz^x\037"
+	.string	"\003\034\002\210vqS^VF\375\031=\370&-\023\345\005\"\236S\217\267\267RF\346\332\201\037\212\305(I\357G~\341\357\273\00399\32347\020`/\r\022`3\006:\304nD\210\206\315\360\340x\220e\300\341"
+	.string	"\213\271>\344\334\350\270`<1\327L\002\357\200\300\341q\211\330\331\341q\221\247E>\323\013\210\177m\034Gj\033\033\3651\255\030p-\224\226\316p"
+	.string	"\340\223\231\276\322\262e\271\fE\2523\3052\312\234\2741Ez*d\333\225\236Rpr\233R\366\247\234\212\203\376\3167\006\0328\276V\n\343B\3142c\251\215M\334\335\245\"\275\360\255\006?\025\351O\020\371\314);\020\212\361\2644T\250aH$0\n\031\303\320\310H\220\t\323f\f\220\002\231)\322\016\020hj(\311\306\030E\273\245G\213\033 yD?\257\020\206\231\002\345\325N\246(S\017W:\177\177r\312\332\016"
+	.string	"5\037\240\353<\261?69$X\017/y$|\2077\214\002\373D\\\373\020"
+	.string	"\036{7d\366\f\331\253!q\031h8$\216DiX\020\201\257\032\354\233\215\210\006\342\274\3518Y\254E\250@\230\024\034P\326\215\260\200\315\021\0262\337C\r\301\213\334\357`y[\236"
+	.ascii	"\324o\n\376\277\337\243Pn-\353e`\n\324iE\255m\375\336\201<\370"
+	.ascii	"\235\304\327VJ\375\224\007\315\024"
+	.text
+	.section	.gnu.lto_queueRemove.part.0.79.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\372\002\225\026"
+	.string	"\206j\221J\240\022V:\342c\340\007\307\356|\3602\223j\353\334\342\006\356\204mm4!x\253\206\246bX\302\326\265\264\372\177\215K\311\327\203\273_8+Z\013\350u8;\236\342Qd\211\017\336,\305 \227\024\030\326\306w\377'\233\310\235R|"
+	.string	"{"
+	.string	"z"
+	.string	"9d;?\364Y\274\305\356B\271\017\250\225\007\310X\353\020\305\261\326\251\207')O[\037)O\247\355\003YE\246\303Q\221\355\314\373\320\347\367\236\037\232\241\037\265\016a\247\333c\001'\207\367N\336)\271\263\344\371\323\006\350\341\364JG\260\002\207\t\035G@\021'I\326\314\017E"
+	.string	"\240\217\\\251:2\335\370y\003\354\315\rQ\001\342s\344%\213\245\326\352V\316\315\272m\r\266#\330\033\013:\265\376\256\200\324\022\224)\305\223\376\342O\374\332\367\217^\364\215vY\207\373\222\267)\312\225\364\027\276\222\3168%R\262'\235\350#\225 \355\016"
+	.ascii	"\031\203~L\244d?\372\220od2%\263o\344\3038\021\356E~z\371\206"
+	.ascii	"\025\350@x\f\372Qk\205\320:}\221\037)\207p\367\211:\337\205]"
+	.ascii	"\266u\027\312\275\266\246\366\202'\247>qg\273N\275\301\271Y\343"
+	.ascii	"\033\326Zc%\001\257\336\264\262\202\177\311\375\007\035\231"
+	.string	"ye\224\033\0227\352\276h\332eT(\260\243\326\312\300\207\342P\363\205\271\362\3646R\273K\237h\202\024\355\016\177\312\265j\255+~\323\235\\|\341\251_l\3636\2665\341\301\324\233W\276\361\255\250\031G*\251\272DP3\300\271\301\030sZ\371B\177oZy\313\r\332_\361\251:zylO\227\254iJ\226\323\273\323\363\305\373!\t\226D\002\265\332t\254e\301LF\241\301,\205\304\005\246%\206\364,\345F\273\200\233@\2630\203\201a\250\265\274\300f7\030X\212\001\3332\320n\260\030\233\355\006s}y|\245\023 \177^Y\226k\226\336\312x\251\204_NQ\335\035\213\204\260\322[>\250*\325\221\334\240\267Gyr\327\211I\356\367\306\266\351~\037\330\360\315*\3734^\303O\276\3203;\331\251<\245\013`\0049\265S\227\245G\326Z\353\222\373\342\003< `\002!sv\007esR\355/f"
+	.string	"IS\021\345\274\272\313PCN\345\346%\360\242d\027\262,%\363\2071\271\254\331 \235K\006*\004\357\330\357L\022\355Q\354E\335\n2\022\247\026\302d`\316\202e\361Z\301-P0K~\261\215\031m0\244\367e\231\205q\207l\275\267A\306\371\030M@8-E\244\2079a\323\267\233\270\260X\361M$\327^\240\330\236\262\021\265"
+	.ascii	"\337\204f\362B-$E\270\245F*y\357\302x"
+	.text
+	.section	.gnu.lto_setTaskEnabled.part.0.81.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\003U\027"
+	.string	"\026,\232H\260\230Qc\200u1\261l\343a\313\304\214\375j\004f/\324\b\001\211l^\013\201O\262ZB\361\267\253!\320\322M\247t\320B\256\236\027\333C\236S\276\302'\342\001?I"
+	.string	"\325\027\376l\203(\300\240\322\032\331RJ\231R\210"
+	.string	"\202"
+	.string	"\177"
+	.string	"5\254[\230\303\306\333z\001\343\255\375\030\266y@\367l&/\225\356q \r\021\251\334{c\267\024\305{o\261V\243\255t\272z\376\211\227I\002\204\f\376\274\025\303Z\251\020\341\304\204\221\207\257j\201#D\\\310\204(Q|\005\207\346Xa\277\025\344\215"
+	.ascii	"\221\352L\023))B\323N2x\364\352\n\036\235VX\221\023JX\202Auf"
+	.ascii	"\304\020\016\217\372$\n\002\315\351r\327\312\301\275\327\367"
+	.ascii	"}\270_\267\235d{\202=\247\004\377_\003f\206\334\373\253\272r"
+	.ascii	"IX\036,^\374\355\373\305\333\360\243\3742\357O\273\371R^#\240"
+	.ascii	"\013\221\354\305\023}(\227\"\231}(\377\306\235z\177\332\375\n"
+	.ascii	"\001[\344\022\020M\356-\r\334:B\311\272O\344\331/\237\330\263"
+	.ascii	"_\346\275F\317\313\373\253\222\325\371&#\260\351\275F\317\313"
+	.ascii	"\243P\311\b\002\201uk\336i\370\324\362\006\201\001\240\310\346"
+	.ascii	"|\351\317\370\260w\032>n\335k\302i\307\275\345\201[\007\223Z"
+	.ascii	"J\344\236\261R\034\200)\030\226\276x\t$|\326\307\177\354\374"
+	.ascii	"%_\300\301\031o)e\220\002\351+\310\021T\225\n\317c\327@\211\264"
+	.ascii	"\255\341R\266\337P\272\367.\320\361\035:\376\322\255o<\363\344"
+	.ascii	"\255\3173\336Nz\262\203oV\231~JE)R\202Ra\313}\306S\372\244)I"
+	.ascii	"\320\254\342G\375ESLF\356\2642\251\320\324\365z\357\275\246I"
+	.ascii	"\3668=\332i\373\246\277\332ij\247\347\313\266\334LWoj9\025f;"
+	.ascii	"\265\225kf\th6\026d4\032\330\315\003[n\246\033M\243\301\325r"
+	.ascii	"v75\f\264\\l\007g\246\023\243\341r1\232\030\3372\324p1\335\355"
+	.ascii	"\206\213\275l\317\327K\223\210gM\375\240\362Q\240\026\005\002"
+	.ascii	"\303\351\364\204\004\212\3252-\265g\264y\3220A\364\307,S1\230"
+	.ascii	"^|`Z=7\216\364/\354\332\205\344X\367^\005~\020\235\315_\332\215"
+	.ascii	"\267#]\331\310\001c\bd\303\257\305H\205\236\225R\352\244\307"
+	.ascii	"\220\0066 `\002\031\203\346\001g\306\243\261\205$\266\245\017"
+	.ascii	"\351\034\021\315E\335\270,\3226\217d\001\253\260m\3602\2471\230"
+	.ascii	"f\347\233)\240\333S\031\235\253-\216\200\002\316!\334i\202\334"
+	.ascii	"A\323\310cUf\246\263K\303\274w(\205\265\246Q:\314\240\024\214"
+	.ascii	"\277\216\373\261\217v\365_B\341\370,\016\374\374\270%\315\031"
+	.ascii	"\266=e\215\001\263\366\376\302\217\207\005B8x\252\331\332\033"
+	.ascii	"\217\313\224G\336`\255\312\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`+\005\025\027"
+	.string	"\006\243\206G\220\334\316\030"
+	.string	"\201\366\366Wl(\252\001\222\255\263)\325\256\327Tg\362"
+	.string	"\330\247\340\305\020\024\020\211\b\023$2\263\b"
+	.string	"\270,\354"
+	.string	"\231\231\231\331\316$\177\034\r\301\302\003\215\300\214\360\307S\035J\315e\226\335\244L)\245u"
+	.string	"s"
+	.string	"s"
+	.string	"R\372\003"
+	.string	"\237\032\022\3303r\326\305\303/\261;|O\347\305b\261\310\341\327\213\301\021\271\301\207t\240\206\005\031\336A\025.31\f\337\240/ \260\220\200\\\247\n\n~3\024\236H7a\237Hx^b\324\324S\204\307\265\322\215L\312!\221~@\217i\232\246G/\300\b\247\350u\332w\031\230\372n\310TU\323\254\335\337%\366`\336:\206\244\367f\357\256LO`\254\226\364\262G\237Q\031w\204,lG\347\361H;\336H\307\027\345x%N\323t\367\304\361I\334\364\276\033\317\263\361\273\032\217\322\370\241\031/$\343!4\323?X\372\240\030\017\004\343\177^|\217\213\347\351ujQ\262\250\221+l\244\212?\220\342\r\240x]\237\240\231\370\005+\361g\330\230\"\\$>\327#\276\200\b\032rw[M\231\204x\002\r\3427\314XK\240\260r:\247\r\271\273\274\264|\235:\257\301\235^\006k\247\317"
+	.string	"\031G\034\342\245w\272\251\223\363\234!\231s\2332\326\t\343\022\244\227\363\037\321\216\323\202\334`_\310\242\002\230\316\353\322\r\216\313"
+	.string	"y\241@Ia\341\335\270\t\244\034\315\2257,\212\020'[\3517!\363\231T\261kW\372og\363\235\2569n\310\264+\263\247\255\371-\310k\205H\333U_\320\261\263\004\231\267\216%YU\034\324\373*hC\275\225\2241\017\225\2230;\324\233j\213i\304\264\312|\250\367\324\3122T\254\204#\352\214\265r\177\371\230r\305D\275I5Qg\032\2627\371\361$\246D\235\205;\324\177>\324y\230\033rVy\334\031r\033`\215\220H\250uA^\016\271\203[\262\252F ?\267\370\366u\246\325\373q\232\032\\\250a\024\346J&2\243$\205\345\312\001\200\002\251\252b\035\021\240\034\220\031%\222\221Hd&\325\001\356w\2123\362vQ\225\337\360\375\231\226I_#h0^&=\001`\237\\\305P\215\372\364?=o\262\r\303.\205\3117 '\376\216\234\256\242\272g1\205\274\276\221n\362H,H"
+	.ascii	"\371fv99p\201=\323\312\"g\341\375\222\227\025\345`p\240\355\304"
+	.ascii	"\373@\330w\034,\006\033\342\253\207\241\t\306\b\351\035\233a"
+	.ascii	"\005x1\016j\356t\035K\231\313W\022Q\242\352\001\367~\021\246"
+	.ascii	"W{\335\210\311\361p\210\001h\217\226>\342;B@\264\266\216M\032"
+	.ascii	"\230\306D\232\215\250#\035\177 :\303\316\312\215\344U\374\001"
+	.text
+	.section	.gnu.lto_.refs.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`^\001]\f"
+	.string	"\026\341W9PK\232t0\211\262\024&\025\033\217\2007\263,\334bgfff\0341\323\321\261\033\306A\304\320\377\037Q\373\037Q?\237\346\330\210\006Rk\217\326\326\326\354'j\215l\231\002A"
+	.string	"K"
+	.string	"I"
+	.ascii	"=r\376qz\343\334\270-\036\322\372\243=\204\373\350u\350\375\343"
+	.ascii	":\363n4[\355\260u\252\275\363"
+	.string	"z\343\372s3\356\250\377\264\227\374\n\355Kh\237\364\253>\325\207Z\2761\332\261v\247\237\375\345\323AW\314\251xZ?\036\023\037\220G\327\001\264^\265\177\372\316\352\313\3253\246\200\027 \217\254_\342\021\371\204\352Y\325'`\216U\035V\375\241\352\r\265\343=\205\251\2371\375\023\244\336@z\006Q_\020\275\001\350\347\r\341t\312\371\007'_\300\247\300\247\200\037\201\217\301\177\300\217\260~\212\337\2009\003?\341\223\347F\364\214\3649]\321\226\262\016I\272C\321]\366Mr\204\271\236h/W%\362\005\373\006\023\222C\254\257\254>\305\\\212I\2009bu,\366G\314\003\237\021\240O\b\017\240\257\006\2547C\326\213!\373^\220\364Z\220\374\035\372sh\377\006\367g\274\257\304\247\\\275\342zG\374\351\252\002\307\016b$\310\023*\202\336\300\017\344\021\314\035\366E^\241^\242\272@;\251-*=aR\032\017"
+	.ascii	"\311\023\"f^\326ST\347\305\005\261Z\312]Uk\347\230b\020\302\355"
+	.ascii	"\031,\346\225U\325\376l=\303\265A\"u\3151"
+	.text
+	.section	.gnu.lto_.decls.34adf3621de77d63,"e",@progbits
+	.string	"(\265/\375`\003=\265\374"
+	.ascii	"\312q\275QU LI9\351\352\276\356s\377#'\266{w\367\376\376\366"
+	.ascii	"\316\314Ud\251\335\271\371\237\337\373\277n3\177w\315\335\377"
+	.ascii	"\357\323h\312\241\355\334j\336\266\204\250\"\267\213\334cOl\364"
+	.ascii	"\3646I\352\373\235\232\256\322\256\373s\027\tl\337\307]A*\312"
+	.ascii	"\272j\355\336[\2467\004\036\0057\005oI*\215\016\3533\373L\223"
+	.ascii	"\300\030\024?\032\375\327\201!\0249\213.ZdEs~^\001\321\326;\022"
+	.ascii	"\325d\"+-.#w\255g\2238\361\022+\"\321\234s\222W\032\235\326l"
+	.ascii	"6\2113\023U\331)@\t^\224-\2029?7\270\331@\002N7\266\340\334["
+	.ascii	"#\\lga\213JDc\303\214\253\255\242\032\241\027\215zkP\025z\035"
+	.ascii	"\252\271\016y0\225\263P\035\242\351\222\263\020Mw\006\335\031"
+	.ascii	"\334\"U>\226p\301\257X\276x\351\272'dE\365\266\227&\354\200\222"
+	.ascii	"\256\277z\233\2606\227\356\362&\354A\031\242\334\2047g\241\356"
+	.ascii	"\f\216\335\031\f\333x\b\335@\274\257y\270\2674\333\361\210j-"
+	.ascii	"J\317\350\225C+\210\034\376;\260\263X\243\243\251\247\r\361\313"
+	.ascii	"\337\230Z\275\235\345Xd\262\005G\260\266\350`\275\017l\266\377"
+	.ascii	"E\235\266,\3016"
+	.string	"\\C\366\004SR\322\232\372\302\257;\260\211\352\204\033\257\363\032\372\266\266B\343\026(\225V\357k\022\226\001\346m\3047\027\374\336\303o)\370\215\206{\256\351\032z\323um7\224\364D\206S\220\013\373\206\370\026\202;J\3035\364\202\226\362\004|p\033\024\226\301f\276\020\371BX\357\273\007~_@\354\302\276\200\370\306\201M\3445\f\374\031p\253\365ZCq\332\311\033\255\233\274H\364\314b2B5\320\352\352=\013\374\306!\3224\016\361!\300\030\364\007\342m$\375l\263\236\312\231(\347\034\242\223`\211\361\325\333c\255\244\241\032t\331{I3\371P\350\231\2379?i\252\226\227\262\033\352\255\351\017\304\232\002\313\344\374d\257\200*\177p\017\370\255\001\321\026\026\266\006\304\276\341\204\r\r\326\201\350lzfh\316\231\206\370e0\006\264^\232\356@|v\007b\315\375\201\210\001]\177 \376\331\037\210\270;\020e"
+	.string	"\220\205\3139\3746\220\017\356\354\357\016\037\310\346,\222\277\231T\0362\306\267:\244j\305\324\001dU\254\216\201\202k\340\277-\376\226\253;r\325a\275Z\253^\375\357b\301\337\"\372C\265\2528\276,\t\376\236R\237\376\356\2537N\363\337 \232\234{\002 \243\317\337\202\325\tP\312\313m\376\233\276y?\360\341\177U\310\300\204\242\013\376\033\377K\201\266\300\337\023h\025j\r\177\037\377\026\2533\377\315>Pm\324\032\177u\332\032\224\222*\322k~\253\374\333\3707\213\277+\370;\371w\361\357\021\374M\343\363_\212\212\0250\374m\363\367O\210{\234\377~\3607\007:\260\201\372\3422\377-\300c\376[\204\371\357\320\357\304\377\366\337W\252\221\216=\267\277\253T\027E\177GU\242\277&\207\376\346@e\304o\313\360o\361\362*\b\204\336\341\267uUV\030\260\252\252\361r\021\2775a\251\006\305\334h"
+	.string	"\201\246\032\034\374\r\242G\314\250\371\257&\370k\f\177m\376\303o\031\360\267\b\177\207\360w\003\200\324\237\377d\177=A\371\337\003\3775\370\253\317=\374\266\003\177\355\371\353\b\376\032\202\277b\340\257(\374\265\204\277\216\360\327\234\277\212\360W\020\376\036\374k\002\376\312\301_\t\360\327\f\376\032\200\277\216\370+\207\277\306\374\025\377\225\370\327\373\327\372\327\377\355\345o.\177\357\375M\345o\300\277\375\376\216\376\315\367w\336\337w\177G\371{\356\357\264\277\321\3766\373{\354\357\347\337G\376\006\373\273\310\337_\177w\375\275\365\267\216\277\255\376\256\372\033\307\337R\1777\375]\343\357\031\1773\375M\303\337\367\357\345\337\310\277A\360?\313\337\030\370\373\350\357\234\277c\374\215\363w\001\376\206\3617"
+	.string	"\3766\372\273\203\277O\374]\364\337\202\377\\\3763\371?\364\337\313\177+\377\235\374\257\373\037\342\177\212\377X\376\316\177\247\340o\023\374\r\364w\363o\346\337.\374-\202\277C\360w\013\177\247\370{\205\277M\370\273\204\277I\370{\204\277!\3607\211\377(\376\016\300\337\033\374}\200\2775\370\333"
+	.string	"\177c\360\237\305\177\270\377\003(,,,\374gp~\f\342\307\361\n\270&\017U\211\301\005\323\003\337\27499Y)$SQ\267R\267\t\206\321\235\205\252Q2>2(\373\204\347v\305\257F\r\365"
+	.ascii	"_\330\325{\243\223~\264\200\253\3670N8F-\207D\333\246\206\332"
+	.ascii	"\246\267\245\220\205\226Lt93\211\303\030\341\233h\215\032D\350"
+	.ascii	"\210\1778f,\347vFC\355\214zU4\312\231\t\247\2138\207E\340\310"
+	.ascii	"\261IV\351\326\t\265N\313\324M9\310\317\203!MN\234\337.\3352"
+	.ascii	"UB-K\274\336vi\250\331\020\307\004\237\230\205\2349g\246\341"
+	.ascii	"3;\207d\336\303\236i\333\002\370\177\263\375"
+	.string	"\177\001\n9\007\341\345e\301]M\204n`\220\207tN#1\252\240\021\250\226\210\250l\030\211Q\345 \242\036A6\316L\025d$\226\263M&\"\n:a*\333\030\211\345\245\334\302n\251\363\223*(\023Me\233L\224\20500\"\242Z2\022\023Z\2621\022\243Z\312bT\271&\023\t9_\020e\247M\026\243\362\313bSK5FbSKFbTO\035\305\b\360\311\322]^\225Y\327\031\021\345$\244'!g\r\235\321s*\347\345\334\320\242\354\024@\316OS\316<!\033\2356D\2274d&4\325\317\234\263\b\244\241\252\251LDg\024d*\347 C+2\222\007AO\272\214\325tA9\236\362QQ\316#\220r\016\352L\227s\016\3129\3038\237\2369;\325\030q!!\345\334t\203\224\237\202\324\212r\256P\275\264%#\261\252\251\023jJ\304\270\262\213gPs\345<*'\026\013J\222\217"
+	.ascii	"1\327\222\214\277z\177\320\321\364\0168*\204\365>\305\300\332"
+	.ascii	"\222\352\305}9\2670\032jaT\273\021\232\302r\220\321J\256\211"
+	.ascii	"\304\f\216,|\202\365\236\030\205c\260rn\215\032j\215*[\n\317"
+	.ascii	"\034dl\222\373\004\005\263\323I\342C>\334\302\026\225\340/+\212"
+	.ascii	"]\013;4\343E\304\005\f'V\3507lj\306\n\325\210k\362|\306\244E"
+	.ascii	"\225\315\260\271\360\370,\333\002U\370W/\365\313\333\306\344"
+	.ascii	"\230x\325k\035\320\205\360\351H\322R\275\257\204\177\035\254"
+	.ascii	"\\jZ\275sjMF\365\232 \346-'^\005\233lFS]\275\020\320rv\243t@"
+	.ascii	"l\004\002\301eX\350bd\001<r\371\251\271\250\267\376\331\254\267"
+	.ascii	"5!%\030\211\003\346jQ\023\260J\245\365\326\244D?\340k,\035'B"
+	.ascii	"\224\033Q~U\257\356\325\276\232W\261T+\365J\2156\264\336U\274"
+	.ascii	"\337\200\361ua\n(mq\\H\370\232\016z\002\230\\\324\217\257Vi\302"
+	.ascii	"\243\3159\352\215\313\217\217\005\270|3\023G\365\265\345\341"
+	.ascii	"V\234!\030\376pk\212\235\214\rn\204T\354\376JW\353\252\024\036"
+	.ascii	"R\305\344\254\267]\324D\347j\213\316\343\202\222\"W\343d\372"
+	.ascii	"\232\300\215\325[\245\314\360\225\305\231\325\373\241\323[\215"
+	.ascii	"R\2414\264\302\035n\t\\uk6&p\335V\206\367z\354\325\341\373a\213"
+	.ascii	"'\201\177v_Tml1N\256\210\030\251\267\262\375u\255:\261B\b\241"
+	.ascii	"d\251"
+	.string	"\027\347\356\240\226VG\225\325VomR\323\320\302\366\372\360\373\312X\2335\335\216\021\300\004\315*ZeR\2274\264\236\375\025\332F~O\234\325\262\216k\272&\007\024\031<\253J\332\3548\314y\252\357\304Y%\023"
+	.string	"\226\033Q_ \004\2411\031\357o\036\226\271r\3707\r\377\222\211\231\021m\264 dr\003!\214\rO\252\240a\027\320<k \345H\242\001&r\302\004\354Y\221\f\247r\3540R\357\221\033\033\005)i\310\027\376_m\250E*XC\253\221\332\365\366\253A\314\024\300U\201\034\2139S\355\031\251^\225\210\005CF)\200\361EO\030\251<\252\217\030\244\247\235\340\315\006\033l \323\305\345\206\206o\025R\2074\364p\365\353\306\034Q\330"
+	.ascii	"\353\375\225\201\237\202>\034\361\327\bw\266\203?\212w\200P\320"
+	.ascii	"(\276\325\253=p\026\"xT\340\360\355\032\376\"\210D\367\324\272"
+	.ascii	"\231\331\353\022'\227\205e\233HAA\237\305 I\320\234\354\300\231"
+	.ascii	"\031\274\033\372\252\367\312\230\004\313\254\260\252\346\250"
+	.ascii	"VuJ\346\030\264\005\353J\2750OA\252\023\257U\270\260\320\tV\275"
+	.ascii	"\307\356@\254Si\317'\321)\251\342\220\037F\352\352\255Q70C[\006"
+	.ascii	"\255\324{[\206\337`{mF\324\342+\311\0233\260)F\270\240P\261\201"
+	.ascii	"\253J\263\035\211\236y\tf\254H-\222\272\021%hD\256\355Z\034\211"
+	.ascii	"^\2514\232\257\315\3543\r\273\030\363Q"
+	.string	"\223*\214\352\254OuF\265QoT\247ZC\215Q\241j\215*\243\036U\244\272T\231jSC+\215j\364\233g\316DP\336:\316>\271`\310\254\220 \2514\032K\367\035\203\236Y\311XeK\354Dam\321tM\317\314d\034\333q#JPK\177)\252\202\025m\322\326lg\\9?\217\324\027}v\024\252\311\331*k\321\267\033\345/\032\273\254\304\2064\341s\020Vci\251\336\353v\276 |G~\365\336'o\223i\302\023\324\321&W5e\250^\266\343\232\2132\270%|\327\212kQVTK\226\334\335\340\202\201O\366{Fv\233\\)9\017\231x\016\345e\243'\234\0312AA/h\277M\332\230\246\3042\016\r\f%Z\206\352\275L~\315\360\252\300\205\325\373\243\020\276e\277Kn\310\330\013\342\005\377\027\272C\212\334\337\026\374\031+X\346H\216\230\330\035\353\260\254dT\232\262\023\304!\342"
+	.ascii	"\262g5\266\265\025$\005\3174\205\205\021\227r\225\016\031X\326"
+	.ascii	"\260M\321\363i\243s\\1XGSab\330F\351\202]\260{\344\355\331'\370"
+	.ascii	"%\201\034QnF~\217\330,L=\316ft`\233\256\257\257[\344\f\311\375"
+	.ascii	"\203\002[#\362[\004\353\n\215\275\031\"l\303\344\006\271A\256"
+	.ascii	"\220b[1\256\305\0278\257_!\255\027\0235\245\007\030 \346\340"
+	.ascii	"\344\303\307\005\302D\220\270c\213\215\032?~\201`!\216\375pb"
+	.ascii	"\253\367r5\021>+Z@\344\224\272p\241\2029,\271\272\272<\264\240"
+	.ascii	"G\031MbYw\353\227\307\333\\pr\342\325{\265j`\213\037aZ\352\275"
+	.ascii	":n\226\020\3006\266\254\213U\261\326\372r\324"
+	.string	"&=E\352\312\355\356P\303\035\342\252\252n\216\312\005\243\204\211\217h\021\220P.)G\005\2427\204\316G\021\334A\017\007\216+\265\227\305\025m\301w7\205=\034\335\247\373t\245\376\n\320\225\366\204C$\022\375s\203\372\225\272Q\035j@\221\335(\033\304\245t\366\304\272\bQ\250%\343\002\177\300\2733\356\214\353d%\213\313\246\005\211\212qk\370u:\272\331\001\261\253\3676Y\0272d\220]\261am\244\215%\261Q\343jeI\333\243Q\377\216P/C\2004\b1\b\347E\272H\227I\204\f.%u2\250\226~\003\247\356\244\256sD\223\016\267\353\274J4@\222d\325P\245X?\2507\272\233\024\243\207\215\2039\367E\337\030\r\2751\332\254>\263\223x\026\343\205\224\003\213\032~\267\031\321\330\226\363kdT\201\034\t6\326\345\374\026\335\242\n\304\250E\027s\205A\360\270D\227\250\263<\200l0\372"
+	.string	".|d70\b\261+t\207\256\320\3158\b\357\n\327\261L\316)\266\204A\240\025\336\240\302\233\033\001\204\\36\324\212\214\352\275\331B!\240\351\315\252\336\307\024a\243X\216%l\353\245\241\326K\235\272yf&#\023\256>AAc\235\"\006Z.\201v\220h\223\247\305r\321b\007E8\311\367kpG\223\340\355 ^\225\036\320z\355\026\353\202X\310\343\305\r\343\036\276\261\r\207\330\001h\263"
+	.ascii	"Z*)\004y\230\233\032&\215\315=!\3031A9$\272\337\372\355\031\""
+	.ascii	"\255\357}6\212\363\r\034\r]V\220.\3656\324F\355\202\364X\002"
+	.ascii	"\246g\257\350Y>>\020P\366\354\225\275-\271\307\226\340\270\342"
+	.ascii	"\3027B\341\030\244\274\274\267]"
+	.string	"\2444\243R\235\255Rg\357\210\017\274\275\373\321UuTo\210\234cg\253\330Y*8\310\203\337\263\tG\006\312\216G\332\224[*F\350\2223-\306\"\374\242\026\3745\013\267f\347\f\220s?\247\224\234r\267s\305\277\027gq\326\355E\021\332X\275V\212u\303.\344\246\200\231!\351j\272\252\227&\317\211\205sb\243\024\263\223\360\371v\033\305\210\225\205b\335\260\222&\034N\352\265m\326\355\362\260Zk\342\366\304\346\271\25023<(N\365Z\2666\243q\321\005x\204P\006\006\223\223\250;\374b\023,s\225s\233\326P\233V\t981P\326\2448\206e\200\344\334\242\241Y\244\024\262\220\214\003\334\310u$^\034\202=`\221\221Y3\234sn\251h\237\340\027\223[3\343\227%T\224\352\265K,T\re\201I\352\265e\315\306C\315\311V\257\205\266\036\314\026[\221.E+\354\301KX\230\035\373"
+	.string	"\212K\354vl\346\t\032\214\267z\355\rU\f\006P\013\036^\261\t\307\004\346\334>\237Jv\t\037\221\300/X&\347\334\0369\322l\027\253\211\253B\221\302ff\207eb\344\334\202\2015\333\b\320,\264t"
+	.string	"\031N($\216_h\034\035\205a#_\316m\021\250-\322\2047\331\362\345>\301\257\354|\2228\316\3025^^^\366\353\204\037\335\220\333/\233C(\n\226z\255\020\013\025\344\271\305\0053a\343\217\234\333\036\r\265=lWM\221\263sf2\345F4\347&\022\225\b\\\364\252\336\333\256\337\372\260\\\025\211\326\263\313\213z\355\217\023\267@\276<I\302\252\327Cw ~\310i\230\bW@\003\013\313n\265\0230\204\256\250\235\326\355V\3651\354\023DC\252\327fY\242&]\035T\3651\234\361\206\246\246\005\337d\035:\254\224\223(\f\035\216\211\313\271\265\262\252W\034\234\023\270\301)\n\243\206c\254TUq\205\341\2330\034\307a\245\002\314\026~R\324\360\244L\026\310\036\024\230,\230+\232H\237\021\312$rYl\2460\354"
+	.string	"\225@\263L]\360\001R\246,\244\313\237\027\322\022J(\177||~vD0[`\341\263Sl*\223\266\231\242\370\212\016\230%\230\3134\206\344\222\307\002\346\317r'\351C\364I}`\276\242\003\025\312\344\262\311,\221\362"
+	.ascii	"\365\354(\223%\226L\240\022 zz\200\224\312\037%LS'\245!\311$"
+	.ascii	"6S\246O\352C,\301\317rE\363G\t\363\0022\355\271M\246\362ggHC"
+	.ascii	"\317\216\2162\331\324\321\231\221)6\223J\025fR\026,\350A"
+	.string	"\232\320LQ,\005\220.\217<\310\224\005\016 DT\340FEL3UQ\323T\246;\310\237\n\334\3300\323\036\026>H\024L\025\312d3\211\334\300\215O\332d\316\200\302\330\224!\275@\261\311\\&#\260\\\002\355\304\034S\346\007\2462\211l*\177f\226\310\264\307\004c\f\207\224\206$\212\031\314C\002\thhLt\320\\\"Yt\300\223.\227\351\013\351r\005&\b\025\312$\013\305tG\231\002\221 E\321\234\341\341!\301\206\207\207\204\0252\026\020\221\242\002\013\004\200\271\223l2Q"
+	.string	"\355\364 wB\240"
+	.string	"\024\202\271\374\331IY\230\341Ic\370\361IY0\241\251LcH\217<)\017\017\t\035\322&\222\207E\013)\r6\312\022\374\234\360\201\003\213\026\232/$Qt\370Nr\231*S\025\370\036\200\300\001\b!\310"
+	.string	"\363\020D0!\202\t\342C\020\341\304\t\021@8\201\017\302\t\313\204\371\316\f\310\345\222\204c\252\303cLex\322\036\027\220J\024\230\311b\017MS\347\347\005\245\n&\274\260c\223\252@.\323\030\220\036\232:3,\233J\024\322\035\3442\005\217\n\304%\262\311,\316\340\346WtP\202\247'\t\344B\005M\035\017@02uR\027~\226+4u\022\240\200\246\022\350gg\330\324I{\222/\374,Y\034\2310\354$S\310\200\364\301M\235\027v\360Wd\360\037\026\351\262D\363\347gY\"&\345\260D\256\330\271\251\017\362\00200\221)\\"
+	.string	"b\306\364\374\374\224\2403\334IW\354\024w\224@\021\300<?\311e\272\002O\272L2S\236\231&\262\311<\316\320L.\177\222\313\025v\222>H\345\f<4\314\264gg\006\023R\025$\3144ub\220\315\236\364\204&3m\"+\320\241I\002\017O\332\203T\252H\242h2\221=\307&\tiS\206T9CL\225\311\036\036d\312S\323\324\t\001\206\371\263B\n\224\002e"
+	.string	"\006&\262)\343\003\204B\2052\031\303\217\017\b\031\220>5M\035f\013\251O\262\211S\237d\n\345O\262\t\264\223\312\200B\017\262\371\323\344\320\324\001\341DS\231\004\3027\201\364`\347\203\027\026\260\323\301\2073\200\001&`\320\302\005$\200w:X\246=@<\351\212\035f\te\022\351Sbg\311,\321\001\006>\310\245\212\237&3\231\002\223\231*\323&\262\307\246\207Y\314\334\036\020\030<l\224#/% \303-\373\305D\311\221\237\326\315\361\"\n\013a\2750TB\250\230\206Xv\016\013\f0\263z\237G\242\220-\027j:\354\226\fZ\f#\033\352\035!X5\274\252\032Z\001b0$j\227\343C\253\031F\262\2425Ex\204\3230jH5\214\032\3420\372\340\352\233\372\020\207\231\021\253\030x\365\016\245\266@Q\221\253\262\242\364\024\275e5\354\250\272a\007\203"
+	.ascii	"\372\030\034:!\021\311\243\023R\203\035\373\221!\205l\330\324"
+	.ascii	"gfN\370\266\352\035q\003\323\320\006\323\260F;\021\200\244\356"
+	.ascii	"\013\215\017k\264\025]\311bW\357p\306\3330a\031\022*\365\016"
+	.ascii	"e\274\355prUR4k\370\207\207\246!IO\030\\^\376\224n\223f\340\335"
+	.ascii	"Y\275\037\216\fc\f\223\2061\206H\177\031\334\230\352\023\034"
+	.ascii	"\036}\210\024w\371\244d\311\321\204\301h\266\030)a]\236\274\340"
+	.string	"3\262w%\374\035Y\325\033\"oX4t1,\262\321\232\247r6\213\322h\341\177\330\302J\035\243\360l\330 \272zI6\020^\r\207n\034\035\222B\254\241\020\223\0172\251\271zE\004z\031\006]/\303\\\314N\023]i\205\037fB\334f\265\245U\357\375b\335\320\266j\f\272\305h\t\242\203\346\tW\360&x\273\b^\302b\320\321\212\032\227\031\202\271i\006\227_B\032=\035mQ\352\275\203\315f\355\276\360\330r\024\274Z2\315Q\016\357./\013\026\261v\375n\340\365\273Y\332\003\257\251\013\370\233E\320\353\206\254z\357\337\333\356\205\251\210\3558%j\273`\250\\\315\020\272}w\354\250j\317J\355q<#b\367W\257\314\222+Wn\016\"\331\017-O\306\24366\035H\260\314\223\271\337\272\271\253G\343\314\371([\242\0345\307Ut!\004\206\034\225_\275_+\312+%J\352\275y\277Q\260"
+	.string	"\225\030\341\335(?\256\230}\251\367\336q"
+	.ascii	"\305\005G\227*\337a\307\303\253\336z\247 \255yA\325"
+	.string	"{\355\3367c\226d\307\023\335\020,\303%G\355\327\211\332\215\263w29(,+\3014y\003t\nf\243&\234\230$1\222\324A\371\215\373\225\222\200\017\316\207\277\204\334\t\325{\341~l\212\013\205{\250\343#\343<0\034r\2141\207FDF\232$\351S\024@0H<0\030Qg\336\033\023\200\023\b\304\251\034F\031R\314\314\210\210\024\024\024\024\244R\030\306-%\254\252=\253N\007@/6\334\222\002\200\276\246\373\036G\234\245\352d\221\366\251]R\304\205\365\022z\323\265&\334\312\222!\3351\233 hE\303\231@\345B4\225\002d$\005C\003.T\231\227\326\223\303\020\314\265\003\367\202\362},1\314%\242`\b\272\022S\275\007\345\354\312\234K\246\266sT\r^r\234\213\370\024\016*o/\210\316\241\237\3410D\324\204\350m\274y\224\267\nU\fJ\265\200%\334\037\314\320ibn8E\235\226"
+	.ascii	"\320\024nTR!o\035e\251\206\277\213\221\020\272\034\271\r\tYa"
+	.ascii	"\025#\260\001\257\b\021\264~\300\355\304\303\370\334[`\255W\203"
+	.ascii	"a/s1\024\373\272\310\016lp\324\210\331\340\252\343\230`$&\227"
+	.ascii	"\235Y\237\237\311\022\222\036i>H\334\n1\265\233\334\304\315q"
+	.ascii	"\260=&\354\241\037\026#?\351\352o\257g\251\262\002\200!?\226"
+	.ascii	"\202A\364\037\360\023<\r{[\2349\305\324%R$\254\244\200\317U;"
+	.ascii	"\341Q\214G\216\237\256\214\n\034\3659\264\n\033\273\354u,\353"
+	.ascii	"*\326\201\377\n\022\373F\021\261\257\226\377hN\271v\330\035\342"
+	.ascii	"\252\241\214\334\334\340\017\206|\026\314]\322A\246D\235\314"
+	.ascii	" \305\240\304\3510h\f\312\371\373\306\370\246-\201\310\326\251"
+	.ascii	"\352_\325a\324\263Z\270\332\035`^SM\353\374\322^\206Q\217\263"
+	.ascii	"\265\364,]\243C\211w\230h\320\205\356cC\343\f\233\242\352\220"
+	.ascii	"Y\221h\243\207\030\233\033=E\213\212WM\346\347\361=\211?\223"
+	.ascii	"t1\376\315Q\265\256\200\n\311E\314\013\245\245w\t\204\220\242"
+	.ascii	"\365\317N\277\027\244,\2219k\256S\252\204\217m@\232\250%\031"
+	.ascii	"\251\342i\236/\351\277O\026\2273\002\201\362D\262a`\201K\016"
+	.ascii	"|\2349\260\210\017]\340\001\020\360\025\267\243a\217?\331\363"
+	.ascii	"v\344E\366\025h8+\240Q\023\265\260\375#pki\256\333&\270\267&"
+	.ascii	"\253\"d\351\216\004\254\264\rS{\234\364\364U\342\360\206\024"
+	.ascii	"\035\315\272\\E\203[y*\372\213\034e\244a\004\303\360#\032f\230"
+	.ascii	"\244Q=n\251\332C\037\353\"\212?m}\222q\223\222L\020\257\002,"
+	.ascii	"\231\236\354_\005^\277\256\3617u\360e\213\257\304\342\361\022"
+	.ascii	"\034\242\023\336\013w\256\316c6\353n\327F\023\353%\200\255\203"
+	.ascii	"\333Kg\257\377\362\366\325\373\333!\350!\361XI\277\327\342\255"
+	.ascii	"\333E\017d\247(\254|3#P\310\366w\230\213\257\312Id\366o\264\007"
+	.ascii	"^\2108\305\357a$\001\262\3049k\231m\267\364\204\3204?\300\227"
+	.ascii	"\020Ai\323\243\225F\364\n\230o\021\\\325\204\250#/"
+	.string	"7\257\307\264\2551y\210\301\356t\f\023{\301\264_\352\2545\304\253\034\n\3679u\332\241\266gvo\006*b8\344\020\277Yokf\344\311\033\342\321\230\272\254\037\214\023\310\330$c\274</\375\002\231\322\002QB\230\037\031\363\254\245^\025\253i\234\373*\354mz&\031\351\216`!\r\206\361\246\334\347p"
+	.ascii	"\246\363\006b\003\263Z\320\035\030\373\351\007\0369\26171\344"
+	.ascii	"ry\037\004\256\310GN\265}\371\303\325u\335\344\224IU\304}\024"
+	.ascii	"\036\270\206_\255m{\032\016\252\317\230\"\263m|\325\200\314'"
+	.ascii	"0t\300o\202\2075p\315\304J\021:E\255\225\343@\230\316\rL+\320"
+	.ascii	"\026\335#;-\234>h\34384$7\304|\371\206z$9\002]\320\210$\363H"
+	.ascii	"\302\337\374\353\272*7\n\345Q\002\234\320\247\345\231u\250\367"
+	.ascii	"Z)\210\004\300\207\2441\n\006+\013\b*\353\352\354\304\021-^\006"
+	.ascii	"\030U\022\005\367\234O\333\210F\345b\265\227+/\033\302\223\345"
+	.ascii	"v\313\344w:A\216\335w\303\313U0j\212r\242\352\034  ,\017\023"
+	.ascii	"LV\313+'N\030\277\360!`\"V\360\247;\302\227\355\2746\351H\215"
+	.ascii	"a\205F\252\263s\236I\302\341\256Lx\211\355\033\367\032\350\321"
+	.ascii	"\267\262\352\247\361#\354\272\007\354c%\021q\371\350#cR\337\354"
+	.ascii	"{cb\236\030\222~\330\002\207\034\037\277\240\375$\004!\340n\365"
+	.ascii	"v\271\374q\007w|q\020\200\021P\007%BT\336Ri\033\037>H\021\260"
+	.ascii	"\3600\271<\"\335\255\224\343\220\210\362\337$1\365\341\021\212"
+	.ascii	"J\363\277\347\220\256\367\232\b\357\022\245\230[!Y\003\r\346"
+	.ascii	"\375\002\250Z\335\212\340\b9\317?\216\r(7S;\213#,\304c\211c\340"
+	.ascii	"\202\374\334\311\027\305\211\366\354\317\322>\030\025Z\036\256"
+	.ascii	"x\342\275\247|q\350\f\222\350.\262\376qw!H\267\254g!\255C\017"
+	.ascii	"\210|\366)\201\206IZL\311u\330\262\253\377\177xy\260\350p\"F"
+	.ascii	"\001\025@\r\265\257_\243\0037u\354\025\376>\346\222p\253\252"
+	.ascii	"h\273\377\247\343b\237\347V\013\bH\306\356\321R\177<"
+	.string	"\202\257\037\377}\224p\356\253\017\t\302\002\346zmM*\217]\263\233\244\370\273\276\267\004]\r\252'\251\222Wl\301\274\006\247&\204\334\264\252\315\210\340\027S\232\215w\344\317\320\201\006\320\274\33783n*\006\301:!\330!t\036G\260\260\311\227\212\344\233\005+L\321s\342\213%\270\264y\350\2265\213\364\371\240q\345\375\375\006xe\272\027s\227)}\265d\265W^\216\364\rM\264\315\341\213Ep\263 a\022b\343E\207\255\232\225\336\3208\316C\330HPp\031\322\214\251L\237}gI\3125\002\214\336NJ/1T\336\202nv\262O\023\030\214JNA\022M]\311\226\211\305\257\331+\337m?\260Z\216\261\303\216\343\016@n}t8\274\210%\273\310-\356\024\274?\025}C\223a&\355\275q\nH\213\204#\212\313?\021h~H\327\001\346\2271\227\332\177\371\375<\214~\370xA9\177\351\366\332"
+	.string	"\003\367\317<\004\217:\235\373\366\312\"\325\375\240^\335\330\245XA)k\232\242OU\234$\356 a\220\217AY\323\251F\312\0246@\313\227\331"
+	.ascii	"\211\016\005\221ea \336}k\2208\r\246C\271\240\035\2236U\262\243"
+	.ascii	"\371I\313\032x\301\3117\213\f\305\242}\027~\0179\256K\"\354\026"
+	.ascii	"\237\024\333$h\226\031\232\360\202\336\232\203\021\204\274u\337"
+	.ascii	"/\310J3\004\373\316\360\357\337e2 \003\270US\337\336"
+	.string	"\031\032\004\b\026\320\n\223;\275\240\005\3367@\243Z\224C\220\t\332\244B\212)e\005\306T\234F\371\216-#\321\270)b1k\fS\231\265$\221\013G\323\307\"\235/d\277\023bM\027\002p\241\200\2020QuL]md\003R\375^a\360*|\257>\204\325\333\032\\%\367M\033\361\311\220^\333\277\353N\346K*\003\357\301L[I\226\316 \216!\"+1\240\221\260\035\367\211\t\"UfOt(\236L\214U\3031\307\\\300F\237\220o\037\\\323'\017\365r\270u\017y\274J]\376D\252F\310\263y\326y|\327'\317I_\344\342lH\\\fE\347T\201\320\321L\365\363\233\001F\202\236\034\210%\r\337\344&\370R\203,\350\347C\301'\373|\371\267\272\204\2337o\003\223\364\334\177\203\032\311}\017R\334\300^B\003<\3050\020\364\245$\350\020\031rH\2051\366\341\232m\022\004\220\326T"
+	.string	"e\255\026\027[\335\t\013\2311.37u\320aL6b\202\224\260\311\344\317\263c'\362\332\234\314f\242\227@\261\327\342|\006\260Z3K\337*\257}\332g\366\305\332\206\030\035\220\301\370_\345\345Z1a\212tB\025\262\330"
+	.string	"Q\225\351@\337\346\311\336\303\311\321e\247<\224)r6\b[\326\003\301mFUp\036\017\220d\261u\330\276\315>\370\\+\300ye\241\357pfC\033\221=r.\307\325\205\374\330\357\250?\374\205\260\213\344\345m\306\200\363<\373\362\374\313\364?\036\035\357\355\377\342?\340\275F&xo->\313\375\225\337%\347\321\020y\026\327\237\374\253\021_\203~\315}O\"g\251\265\221\330\251\351\260\305\234\370\230O0\3308F\217\317%3'{$,\253\177\241\3612\315>\311F\207/\272\323\336\240\177\230\3466\237X\200\357*\302~\211\037\001.\360\217\361\250\2723\220\271\361\274B~\"z,~\260_l\3746v\026\332\332\374K{\020\023T\256\372\317e\362\217\033\316\002qiB\177\343r\370\017\247.\351\242gN\271R{%\376/ \007\252e&\222=\256\233\001\037\307 \276\374]\326\037^"
+	.ascii	"\275\253%\334Yl:'h\253&O>/\367fx\262\360'VZ\277Q\337w\3365|\367"
+	.ascii	"\371\234\326\332\023\217\206P\332\305\344\177\3665\240\362\371"
+	.ascii	"\363\344}\024\255\251h7k\366\354\033f\271R/\027\213\230\216'"
+	.ascii	"{\236\376SC\377?\370\206"
+	.string	"\220-?v\376\215\306\337\335\243\025/\356\256\177\371\315+\007\260C{\214\355aQ\343\244\274\007}\030w\n\214\313\\\362c\336q\220\371,nw\360a\217\217\267\321\261\206v3\251o\374\267\212\357\363!\331\257\177\315y\203\363z\304\235\031\037\200\257;\332\230\02299'=\035m\216\235\204s@\312\n\352\013\356\277\036}@\266\247\020-\210\227\212\357\024GL\317\033\277\n\037\325\017\352\314\t\315~\250\357\b\234\233\037\272\331=[6@\303b\331\023y\252\016\347\325\312\234#\236\360\373\b\337\341\366{\363\004\327\211\264\201\317?s\210\230\275\207\277\370\247\361\3706\303\236\267.}\215\337\024g\236\250_9\007\341\253l\366\252\\\307\317\330O\310\037.}\335gC\236\205+{\034Lc\360\030\303BE\307\267Yd\347\234\203\271\351\bw%\357\016\235\275\3307\214?_g\200,\225\231\b\360Su\214P\316\235\303\371<"
+	.ascii	"\256\001\2667\244\365\315pA\270\357\311\345c\036\254v+\352\211"
+	.ascii	"s\255\346F\375E\264K\035F\373\030W\361\351l\032\210Ybv\033\362"
+	.ascii	"\317~\340K\324\263\376\377\345\007\346)Vi\025\027\272;\201l\365"
+	.ascii	"\205\363\035W\337\335gx\317\275\335\350\266-\364\352u\267\275"
+	.ascii	"\275zK\356\005\3774jW\366\316\001n\317\370}\202\2674\257n.\365"
+	.ascii	"\f\377c\360\326\243\246?y\362\234\330!\354\355\305\340DM\376"
+	.ascii	"\3539"
+	.string	"\271<\220~"
+	.ascii	"\237\300\377\330\020\255\003wy\234|-6\333\035\345/\"q\210\311"
+	.ascii	"\237\376\233f\235R\223?\347\017\360\3477\350\261\377\334\377"
+	.ascii	"\365\361\234\367\275]\335-)\276cV\305s\3051#s\341\363\273b\350"
+	.ascii	"\177\2427\323%N\232\343\207?v\033\235\272/\367\231\200\027\336"
+	.ascii	"\305\257\202\2563\340\330\321\r"
+	.text
+	.section	.gnu.lto_.symtab.34adf3621de77d63,"e",@progbits
+	.string	"checkFuncMovingSumExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"checkFuncTotalExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"checkFuncMaxExecutionTime"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"queueClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"queueContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"queueAdd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"queueRemove"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"queueFirst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"queueNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"taskSystem"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"getCheckFuncInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\002"
+	.string	""
+	.string	"getTaskInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"getTaskLatenessHistogram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"getTaskExecutionHistogram"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"schedulerTraceSequence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"schedulerTraceRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\002"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"schedulerSetCalulateTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"scheduler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"profileProbes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"profileTicks"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.34adf3621de77d63,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,19069 @@
+	.file	"acceleration.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/build/debug.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/common/filter.h"
+	.file 8 "./src/main/config/parameter_group.h"
+	.file 9 "./src/main/drivers/io_types.h"
+	.file 10 "./src/main/drivers/sensor.h"
+	.file 11 "./src/main/drivers/accgyro.h"
+	.file 12 "./src/main/drivers/accgyro_mpu.h"
+	.file 13 "./src/main/drivers/resource.h"
+	.file 14 "./src/main/fc/config.h"
+	.file 15 "./src/main/io/beeper.h"
+	.file 16 "./src/main/sensors/sensors.h"
+	.file 17 "./src/main/sensors/acceleration.h"
+	.file 18 "./src/main/sensors/acceleration.c"
+	.file 19 "./src/main/sensors/boardalignment.h"
+	.file 20 "./src/main/config/feature.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 22 "./src/main/sensors/gyro.h"
+	.file 23 "/usr/include/string.h"
+	.file 24 "./src/main/fc/runtime_config.h"
+	.file 25 "./src/main/drivers/accgyro_fake.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	acceleration.c.6229c5d4
+	.weak	acceleration.c.6229c5d4
+acceleration.c.6229c5d4:
+	.long	0xf52
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x26
+	.long	.LASF2783
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2462
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2463
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2464
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2465
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2466
+	.uleb128 0x2
+	.long	.LASF2467
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF2468
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2469
+	.uleb128 0x2
+	.long	.LASF2470
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF2471
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF2472
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2473
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2474
+	.uleb128 0x2
+	.long	.LASF2475
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF2476
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF2477
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF2478
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF2479
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x2
+	.long	.LASF2480
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2481
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2482
+	.uleb128 0xf
+	.long	0x9f
+	.long	0x105
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2483
+	.byte	0x5
+	.byte	0x15
+	.byte	0x10
+	.long	0xf5
+	.uleb128 0xc
+	.long	.LASF2484
+	.byte	0x5
+	.byte	0x16
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x30
+	.long	0x1b3
+	.uleb128 0x1
+	.long	.LASF2485
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2486
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2487
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2488
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2489
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2491
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2492
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2494
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2495
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2496
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2498
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2499
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2506
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2507
+	.byte	0x16
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x1cb
+	.uleb128 0x19
+	.string	"X"
+	.byte	0
+	.uleb128 0x19
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x19
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2516
+	.byte	0x1c
+	.byte	0x7
+	.byte	0x24
+	.byte	0x10
+	.long	0x22d
+	.uleb128 0x8
+	.string	"b0"
+	.byte	0x7
+	.byte	0x25
+	.byte	0xb
+	.long	0xe7
+	.byte	0
+	.uleb128 0x8
+	.string	"b1"
+	.byte	0x7
+	.byte	0x25
+	.byte	0xf
+	.long	0xe7
+	.byte	0x4
+	.uleb128 0x8
+	.string	"b2"
+	.byte	0x7
+	.byte	0x25
+	.byte	0x13
+	.long	0xe7
+	.byte	0x8
+	.uleb128 0x8
+	.string	"a1"
+	.byte	0x7
+	.byte	0x25
+	.byte	0x17
+	.long	0xe7
+	.byte	0xc
+	.uleb128 0x8
+	.string	"a2"
+	.byte	0x7
+	.byte	0x25
+	.byte	0x1b
+	.long	0xe7
+	.byte	0x10
+	.uleb128 0x8
+	.string	"d1"
+	.byte	0x7
+	.byte	0x26
+	.byte	0xb
+	.long	0xe7
+	.byte	0x14
+	.uleb128 0x8
+	.string	"d2"
+	.byte	0x7
+	.byte	0x26
+	.byte	0xf
+	.long	0xe7
+	.byte	0x18
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2508
+	.byte	0x7
+	.byte	0x27
+	.byte	0x3
+	.long	0x1cb
+	.uleb128 0x2
+	.long	.LASF2509
+	.byte	0x8
+	.byte	0x19
+	.byte	0x12
+	.long	0xc3
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x21
+	.long	0x273
+	.uleb128 0xa
+	.long	.LASF2510
+	.value	0xfff
+	.uleb128 0xa
+	.long	.LASF2511
+	.value	0xf000
+	.uleb128 0xa
+	.long	.LASF2512
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2514
+	.value	0x8000
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2515
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xf
+	.long	0x27f
+	.uleb128 0x1e
+	.long	0x28f
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x29
+	.byte	0x8
+	.byte	0x8
+	.byte	0x35
+	.byte	0x5
+	.long	0x2b0
+	.uleb128 0x12
+	.string	"ptr"
+	.byte	0x8
+	.byte	0x36
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x12
+	.string	"fn"
+	.byte	0x8
+	.byte	0x37
+	.byte	0x16
+	.long	0x2b0
+	.byte	0
+	.uleb128 0x5
+	.long	0x273
+	.uleb128 0xb
+	.long	.LASF2517
+	.byte	0x20
+	.byte	0x8
+	.byte	0x30
+	.byte	0x10
+	.long	0x304
+	.uleb128 0x8
+	.string	"pgn"
+	.byte	0x8
+	.byte	0x31
+	.byte	0xb
+	.long	0x239
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2518
+	.byte	0x8
+	.byte	0x32
+	.byte	0xe
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF2519
+	.byte	0x8
+	.byte	0x33
+	.byte	0xe
+	.long	0x304
+	.byte	0x8
+	.uleb128 0x8
+	.string	"ptr"
+	.byte	0x8
+	.byte	0x34
+	.byte	0xf
+	.long	0x309
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2520
+	.byte	0x8
+	.byte	0x38
+	.byte	0x7
+	.long	0x28f
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0x304
+	.uleb128 0x2
+	.long	.LASF2521
+	.byte	0x8
+	.byte	0x39
+	.byte	0x3
+	.long	0x2b5
+	.uleb128 0x11
+	.long	0x30e
+	.uleb128 0x2
+	.long	.LASF2522
+	.byte	0x9
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x19
+	.long	0x36d
+	.uleb128 0x1
+	.long	.LASF2523
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2524
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2525
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2526
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2527
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2529
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2530
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2531
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2532
+	.byte	0xa
+	.byte	0x23
+	.byte	0x3
+	.long	0x32b
+	.uleb128 0xb
+	.long	.LASF2533
+	.byte	0x8
+	.byte	0xa
+	.byte	0x26
+	.byte	0xc
+	.long	0x394
+	.uleb128 0x3
+	.long	.LASF2534
+	.byte	0xa
+	.byte	0x27
+	.byte	0xe
+	.long	0x31f
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2535
+	.byte	0x8
+	.byte	0xa
+	.byte	0x25
+	.long	0x3ad
+	.uleb128 0x12
+	.string	"spi"
+	.byte	0xa
+	.byte	0x28
+	.byte	0x7
+	.long	0x379
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2535
+	.byte	0xa
+	.byte	0x29
+	.byte	0x3
+	.long	0x394
+	.uleb128 0x11
+	.long	0x3ad
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2536
+	.uleb128 0x2
+	.long	.LASF2537
+	.byte	0xa
+	.byte	0x2f
+	.byte	0x10
+	.long	0x3d1
+	.uleb128 0x5
+	.long	0x3d6
+	.uleb128 0x1e
+	.long	0x3e1
+	.uleb128 0x4
+	.long	0x3e1
+	.byte	0
+	.uleb128 0x5
+	.long	0x3e6
+	.uleb128 0xb
+	.long	.LASF2538
+	.byte	0x60
+	.byte	0xb
+	.byte	0x44
+	.byte	0x10
+	.long	0x469
+	.uleb128 0x3
+	.long	.LASF2539
+	.byte	0xb
+	.byte	0x45
+	.byte	0x1a
+	.long	0x3c5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2540
+	.byte	0xb
+	.byte	0x46
+	.byte	0x1a
+	.long	0x469
+	.byte	0x8
+	.uleb128 0x8
+	.string	"bus"
+	.byte	0xb
+	.byte	0x47
+	.byte	0x11
+	.long	0x3ad
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2541
+	.byte	0xb
+	.byte	0x48
+	.byte	0xe
+	.long	0xc3
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF2542
+	.byte	0xb
+	.byte	0x49
+	.byte	0xd
+	.long	0x623
+	.byte	0x1a
+	.uleb128 0x3
+	.long	.LASF2543
+	.byte	0xb
+	.byte	0x4a
+	.byte	0xa
+	.long	0x98
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF2544
+	.byte	0xb
+	.byte	0x4b
+	.byte	0x14
+	.long	0x36d
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF2545
+	.byte	0xb
+	.byte	0x4c
+	.byte	0x1a
+	.long	0x617
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF2546
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x18
+	.long	0x55a
+	.byte	0x30
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2547
+	.byte	0xa
+	.byte	0x30
+	.byte	0xf
+	.long	0x475
+	.uleb128 0x5
+	.long	0x47a
+	.uleb128 0x1b
+	.long	0x3be
+	.long	0x489
+	.uleb128 0x4
+	.long	0x3e1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2548
+	.byte	0xc
+	.byte	0x7f
+	.byte	0xf
+	.long	0x495
+	.uleb128 0x5
+	.long	0x49a
+	.uleb128 0x1b
+	.long	0x3be
+	.long	0x4b8
+	.uleb128 0x4
+	.long	0x4b8
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0x304
+	.byte	0
+	.uleb128 0x5
+	.long	0x3b9
+	.uleb128 0x2
+	.long	.LASF2549
+	.byte	0xc
+	.byte	0x80
+	.byte	0xf
+	.long	0x4c9
+	.uleb128 0x5
+	.long	0x4ce
+	.uleb128 0x1b
+	.long	0x3be
+	.long	0x4e7
+	.uleb128 0x4
+	.long	0x4b8
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x4
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2550
+	.byte	0xc
+	.byte	0x81
+	.byte	0xf
+	.long	0x4f3
+	.uleb128 0x5
+	.long	0x4f8
+	.uleb128 0x2a
+	.uleb128 0xb
+	.long	.LASF2551
+	.byte	0x30
+	.byte	0xc
+	.byte	0x85
+	.byte	0x10
+	.long	0x555
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0xc
+	.byte	0x86
+	.byte	0x1a
+	.long	0x489
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2553
+	.byte	0xc
+	.byte	0x87
+	.byte	0x1b
+	.long	0x4bd
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2554
+	.byte	0xc
+	.byte	0x88
+	.byte	0x1a
+	.long	0x489
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2555
+	.byte	0xc
+	.byte	0x89
+	.byte	0x1b
+	.long	0x4bd
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF2556
+	.byte	0xc
+	.byte	0x8a
+	.byte	0x13
+	.long	0x4e7
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF2557
+	.byte	0xc
+	.byte	0x8b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.byte	0
+	.uleb128 0x11
+	.long	0x4f9
+	.uleb128 0x2
+	.long	.LASF2558
+	.byte	0xc
+	.byte	0x8c
+	.byte	0x3
+	.long	0x4f9
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0xaa
+	.long	0x5ba
+	.uleb128 0x1
+	.long	.LASF2559
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2560
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2561
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2562
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2563
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2565
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2566
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2567
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2568
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2569
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2570
+	.byte	0xb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2571
+	.byte	0xc
+	.byte	0xb7
+	.byte	0x3
+	.long	0x566
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0xb9
+	.long	0x5de
+	.uleb128 0x1
+	.long	.LASF2572
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2573
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2574
+	.byte	0xc
+	.byte	0xbc
+	.byte	0x3
+	.long	0x5c6
+	.uleb128 0xb
+	.long	.LASF2575
+	.byte	0x8
+	.byte	0xc
+	.byte	0xbe
+	.byte	0x10
+	.long	0x612
+	.uleb128 0x3
+	.long	.LASF2576
+	.byte	0xc
+	.byte	0xbf
+	.byte	0x11
+	.long	0x5ba
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2577
+	.byte	0xc
+	.byte	0xc0
+	.byte	0x19
+	.long	0x5de
+	.byte	0x4
+	.byte	0
+	.uleb128 0x11
+	.long	0x5ea
+	.uleb128 0x2
+	.long	.LASF2578
+	.byte	0xc
+	.byte	0xc1
+	.byte	0x3
+	.long	0x5ea
+	.uleb128 0xf
+	.long	0x9f
+	.long	0x633
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xf
+	.long	0xab
+	.long	0x643
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2579
+	.byte	0xb
+	.byte	0x4e
+	.byte	0x3
+	.long	0x3e6
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x14
+	.long	0x775
+	.uleb128 0x1
+	.long	.LASF2580
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2581
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2582
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2583
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2584
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2586
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2587
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2588
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2589
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2590
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2591
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2592
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2593
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2594
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2595
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2596
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2597
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2598
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2599
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2600
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2601
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2602
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2603
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2604
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2605
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2606
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2607
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2608
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2609
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2610
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2611
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2612
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2613
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2614
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2615
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2616
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2617
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2618
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2619
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2620
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2621
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2622
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2623
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2624
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2625
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2626
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x23
+	.long	0x851
+	.uleb128 0x1
+	.long	.LASF2627
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2628
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2629
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2630
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2631
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2632
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2633
+	.byte	0x80
+	.uleb128 0xa
+	.long	.LASF2634
+	.value	0x100
+	.uleb128 0xa
+	.long	.LASF2635
+	.value	0x200
+	.uleb128 0xa
+	.long	.LASF2636
+	.value	0x400
+	.uleb128 0xa
+	.long	.LASF2637
+	.value	0x1000
+	.uleb128 0xa
+	.long	.LASF2638
+	.value	0x2000
+	.uleb128 0xa
+	.long	.LASF2639
+	.value	0x4000
+	.uleb128 0xa
+	.long	.LASF2640
+	.value	0x8000
+	.uleb128 0x6
+	.long	.LASF2641
+	.long	0x10000
+	.uleb128 0x6
+	.long	.LASF2642
+	.long	0x20000
+	.uleb128 0x6
+	.long	.LASF2643
+	.long	0x40000
+	.uleb128 0x6
+	.long	.LASF2644
+	.long	0x80000
+	.uleb128 0x6
+	.long	.LASF2645
+	.long	0x100000
+	.uleb128 0x6
+	.long	.LASF2646
+	.long	0x200000
+	.uleb128 0x6
+	.long	.LASF2647
+	.long	0x400000
+	.uleb128 0x6
+	.long	.LASF2648
+	.long	0x800000
+	.uleb128 0x6
+	.long	.LASF2649
+	.long	0x1000000
+	.uleb128 0x6
+	.long	.LASF2650
+	.long	0x2000000
+	.uleb128 0x6
+	.long	.LASF2651
+	.long	0x4000000
+	.uleb128 0x6
+	.long	.LASF2652
+	.long	0x8000000
+	.uleb128 0x6
+	.long	.LASF2653
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x17
+	.long	0x8e1
+	.uleb128 0x1
+	.long	.LASF2654
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2655
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2656
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2657
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2658
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2659
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2660
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2661
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2662
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2663
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2664
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2665
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2666
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2667
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2668
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2669
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2670
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2671
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2672
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2673
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2674
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2675
+	.byte	0x15
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2676
+	.byte	0xf
+	.byte	0x31
+	.byte	0x3
+	.long	0x851
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x14
+	.long	0x917
+	.uleb128 0x1
+	.long	.LASF2677
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2678
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2679
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2680
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2681
+	.byte	0x4
+	.byte	0
+	.uleb128 0xf
+	.long	0xb7
+	.long	0x927
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2682
+	.byte	0x10
+	.byte	0x1c
+	.byte	0x10
+	.long	0x917
+	.uleb128 0xb
+	.long	.LASF2683
+	.byte	0x6
+	.byte	0x10
+	.byte	0x1e
+	.byte	0x10
+	.long	0x968
+	.uleb128 0x3
+	.long	.LASF2684
+	.byte	0x10
+	.byte	0x1f
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2685
+	.byte	0x10
+	.byte	0x20
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x8
+	.string	"yaw"
+	.byte	0x10
+	.byte	0x21
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2686
+	.byte	0x10
+	.byte	0x22
+	.byte	0x3
+	.long	0x933
+	.uleb128 0x1a
+	.long	.LASF2687
+	.byte	0x6
+	.byte	0x10
+	.byte	0x24
+	.long	0x999
+	.uleb128 0x12
+	.string	"raw"
+	.byte	0x10
+	.byte	0x25
+	.byte	0xd
+	.long	0x623
+	.uleb128 0x1f
+	.long	.LASF2688
+	.byte	0x10
+	.byte	0x26
+	.byte	0x1f
+	.long	0x968
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2689
+	.byte	0x10
+	.byte	0x27
+	.byte	0x3
+	.long	0x974
+	.uleb128 0x11
+	.long	0x999
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x2d
+	.long	0x9e0
+	.uleb128 0x1
+	.long	.LASF2690
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2691
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2692
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2693
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2694
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2695
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2696
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x19
+	.long	0xa4c
+	.uleb128 0x1
+	.long	.LASF2697
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2698
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2699
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2700
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2701
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2702
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2703
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2704
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2705
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2706
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2707
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2708
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2709
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2710
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2711
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2712
+	.byte	0xf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2713
+	.byte	0x11
+	.byte	0x2a
+	.byte	0x3
+	.long	0x9e0
+	.uleb128 0xb
+	.long	.LASF2714
+	.byte	0x78
+	.byte	0x11
+	.byte	0x2c
+	.byte	0x10
+	.long	0xa9a
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x11
+	.byte	0x2d
+	.byte	0xe
+	.long	0x643
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2715
+	.byte	0x11
+	.byte	0x2e
+	.byte	0xe
+	.long	0xcf
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF2716
+	.byte	0x11
+	.byte	0x2f
+	.byte	0xd
+	.long	0x633
+	.byte	0x64
+	.uleb128 0x3
+	.long	.LASF2717
+	.byte	0x11
+	.byte	0x30
+	.byte	0x9
+	.long	0x3be
+	.byte	0x70
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2718
+	.byte	0x11
+	.byte	0x31
+	.byte	0x3
+	.long	0xa58
+	.uleb128 0x2b
+	.string	"acc"
+	.byte	0x11
+	.byte	0x33
+	.byte	0xe
+	.long	0xa9a
+	.uleb128 0xb
+	.long	.LASF2719
+	.byte	0x4
+	.byte	0x11
+	.byte	0x35
+	.byte	0x10
+	.long	0xada
+	.uleb128 0x3
+	.long	.LASF2684
+	.byte	0x11
+	.byte	0x36
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2685
+	.byte	0x11
+	.byte	0x37
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2720
+	.byte	0x11
+	.byte	0x38
+	.byte	0x3
+	.long	0xab2
+	.uleb128 0x1a
+	.long	.LASF2721
+	.byte	0x4
+	.byte	0x11
+	.byte	0x3a
+	.long	0xb0b
+	.uleb128 0x12
+	.string	"raw"
+	.byte	0x11
+	.byte	0x3b
+	.byte	0xd
+	.long	0xb0b
+	.uleb128 0x1f
+	.long	.LASF2688
+	.byte	0x11
+	.byte	0x3c
+	.byte	0x1d
+	.long	0xada
+	.byte	0
+	.uleb128 0xf
+	.long	0x9f
+	.long	0xb1b
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2722
+	.byte	0x11
+	.byte	0x3d
+	.byte	0x3
+	.long	0xae6
+	.uleb128 0xb
+	.long	.LASF2723
+	.byte	0x14
+	.byte	0x11
+	.byte	0x40
+	.byte	0x10
+	.long	0xb76
+	.uleb128 0x3
+	.long	.LASF2724
+	.byte	0x11
+	.byte	0x41
+	.byte	0xe
+	.long	0xc3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2725
+	.byte	0x11
+	.byte	0x42
+	.byte	0x14
+	.long	0x36d
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2726
+	.byte	0x11
+	.byte	0x43
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2727
+	.byte	0x11
+	.byte	0x44
+	.byte	0x1b
+	.long	0x999
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF2728
+	.byte	0x11
+	.byte	0x45
+	.byte	0x19
+	.long	0xb1b
+	.byte	0x10
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2729
+	.byte	0x11
+	.byte	0x46
+	.byte	0x3
+	.long	0xb27
+	.uleb128 0x11
+	.long	0xb76
+	.uleb128 0xc
+	.long	.LASF2730
+	.byte	0x11
+	.byte	0x48
+	.byte	0x1e
+	.long	0xb76
+	.uleb128 0x20
+	.long	0xaa6
+	.byte	0x47
+	.byte	0x7
+	.uleb128 0x13
+	.long	.LASF2735
+	.byte	0x49
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xc
+	.long	.LASF2731
+	.byte	0x12
+	.byte	0x4b
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xc
+	.long	.LASF2732
+	.byte	0x12
+	.byte	0x4c
+	.byte	0xc
+	.long	0x3be
+	.uleb128 0xc
+	.long	.LASF2733
+	.byte	0x12
+	.byte	0x4d
+	.byte	0xc
+	.long	0x3be
+	.uleb128 0xc
+	.long	.LASF2734
+	.byte	0x12
+	.byte	0x4e
+	.byte	0xc
+	.long	0x3be
+	.uleb128 0x13
+	.long	.LASF2736
+	.byte	0x50
+	.byte	0x1f
+	.long	0xbe0
+	.uleb128 0x5
+	.long	0x999
+	.uleb128 0x13
+	.long	.LASF2737
+	.byte	0x52
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0xf
+	.long	0x22d
+	.long	0xc00
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2738
+	.byte	0x53
+	.byte	0x17
+	.long	0xbf0
+	.uleb128 0x20
+	.long	0xb87
+	.byte	0x55
+	.byte	0x5b
+	.uleb128 0xc
+	.long	.LASF2739
+	.byte	0x12
+	.byte	0x55
+	.byte	0x91
+	.long	0x31a
+	.uleb128 0x2c
+	.long	0xc12
+	.byte	0xc2
+	.uleb128 0x14
+	.long	.LASF2740
+	.byte	0xf
+	.byte	0x3b
+	.long	0xc35
+	.uleb128 0x4
+	.long	0x8e1
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2766
+	.byte	0xe
+	.byte	0x67
+	.byte	0x6
+	.uleb128 0x15
+	.long	.LASF2742
+	.byte	0x14
+	.byte	0x1e
+	.byte	0x5
+	.long	0x3be
+	.long	0xc53
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2741
+	.byte	0x13
+	.byte	0x1e
+	.long	0xc69
+	.uleb128 0x4
+	.long	0xc69
+	.uleb128 0x4
+	.long	0xb7
+	.byte	0
+	.uleb128 0x5
+	.long	0xab
+	.uleb128 0x2e
+	.long	.LASF2743
+	.byte	0x15
+	.value	0x13d
+	.byte	0x11
+	.long	0x8f
+	.long	0xc85
+	.uleb128 0x4
+	.long	0xe7
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2744
+	.byte	0x7
+	.byte	0x5b
+	.byte	0x7
+	.long	0xe7
+	.long	0xca0
+	.uleb128 0x4
+	.long	0xca0
+	.uleb128 0x4
+	.long	0xe7
+	.byte	0
+	.uleb128 0x5
+	.long	0x22d
+	.uleb128 0x14
+	.long	.LASF2745
+	.byte	0x7
+	.byte	0x57
+	.long	0xcc0
+	.uleb128 0x4
+	.long	0xca0
+	.uleb128 0x4
+	.long	0xe7
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2746
+	.byte	0x55
+	.byte	0x24
+	.long	0xccb
+	.uleb128 0x5
+	.long	0x612
+	.uleb128 0x1c
+	.long	.LASF2747
+	.byte	0x53
+	.byte	0x22
+	.long	0xcdb
+	.uleb128 0x5
+	.long	0x555
+	.uleb128 0x1c
+	.long	.LASF2748
+	.byte	0x51
+	.byte	0x14
+	.long	0x4b8
+	.uleb128 0x15
+	.long	.LASF2749
+	.byte	0x17
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0xd0b
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x7c
+	.uleb128 0x4
+	.long	0xdb
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2750
+	.byte	0x18
+	.byte	0x48
+	.long	0xd1c
+	.uleb128 0x4
+	.long	0xcf
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2751
+	.byte	0x19
+	.byte	0x15
+	.byte	0x5
+	.long	0x3be
+	.long	0xd32
+	.uleb128 0x4
+	.long	0x3e1
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2753
+	.value	0x1ea
+	.long	0xd58
+	.uleb128 0xd
+	.long	.LASF2755
+	.value	0x1ea
+	.byte	0x25
+	.long	0xc3
+	.uleb128 0x17
+	.uleb128 0xe
+	.long	.LASF2752
+	.value	0x1ee
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2754
+	.value	0x1e5
+	.long	0xd70
+	.uleb128 0xd
+	.long	.LASF2756
+	.value	0x1e5
+	.byte	0x32
+	.long	0xbe0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2757
+	.value	0x1c6
+	.long	0xda8
+	.uleb128 0xd
+	.long	.LASF2758
+	.value	0x1c6
+	.byte	0x25
+	.long	0xda8
+	.uleb128 0x2f
+	.long	0xd99
+	.uleb128 0xe
+	.long	.LASF2752
+	.value	0x1cd
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xe
+	.long	.LASF2752
+	.value	0x1d3
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xb1b
+	.uleb128 0x1d
+	.long	.LASF2759
+	.value	0x1bf
+	.long	0xdc5
+	.uleb128 0xd
+	.long	.LASF2736
+	.value	0x1bf
+	.byte	0x41
+	.long	0xdc5
+	.byte	0
+	.uleb128 0x5
+	.long	0x9a5
+	.uleb128 0x1d
+	.long	.LASF2760
+	.value	0x18a
+	.long	0xe0f
+	.uleb128 0xd
+	.long	.LASF2758
+	.value	0x18a
+	.byte	0x49
+	.long	0xda8
+	.uleb128 0xe
+	.long	.LASF2752
+	.value	0x18c
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x21
+	.string	"b"
+	.value	0x18d
+	.long	0x633
+	.uleb128 0xe
+	.long	.LASF2761
+	.value	0x18e
+	.byte	0x14
+	.long	0x623
+	.uleb128 0xe
+	.long	.LASF2762
+	.value	0x18f
+	.byte	0x20
+	.long	0xb1b
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2763
+	.value	0x16a
+	.long	0xe3e
+	.uleb128 0xd
+	.long	.LASF2758
+	.value	0x16a
+	.byte	0x40
+	.long	0xda8
+	.uleb128 0x21
+	.string	"a"
+	.value	0x16c
+	.long	0x633
+	.uleb128 0x17
+	.uleb128 0xe
+	.long	.LASF2752
+	.value	0x16e
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2764
+	.value	0x165
+	.long	0x3be
+	.uleb128 0x22
+	.long	.LASF2765
+	.value	0x160
+	.long	0x3be
+	.uleb128 0x30
+	.long	.LASF2767
+	.byte	0x12
+	.value	0x15b
+	.byte	0x5
+	.long	0x3be
+	.uleb128 0x16
+	.long	.LASF2768
+	.value	0x156
+	.long	0xe79
+	.uleb128 0xd
+	.long	.LASF2769
+	.value	0x156
+	.byte	0x27
+	.long	0xc3
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF2770
+	.byte	0x12
+	.value	0x12f
+	.byte	0x5
+	.long	0x3be
+	.long	0xea5
+	.uleb128 0xd
+	.long	.LASF2771
+	.value	0x12f
+	.byte	0x16
+	.long	0xcf
+	.uleb128 0x17
+	.uleb128 0xe
+	.long	.LASF2752
+	.value	0x14c
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF2772
+	.byte	0x12
+	.byte	0x7b
+	.byte	0x5
+	.long	0x3be
+	.long	0xee0
+	.uleb128 0x33
+	.string	"dev"
+	.byte	0x12
+	.byte	0x7b
+	.byte	0x19
+	.long	0xee0
+	.uleb128 0x18
+	.long	.LASF2773
+	.byte	0x7b
+	.byte	0x33
+	.long	0xa4c
+	.uleb128 0x13
+	.long	.LASF2774
+	.byte	0x7d
+	.byte	0x1a
+	.long	0xa4c
+	.uleb128 0x34
+	.long	.LASF2784
+	.byte	0x12
+	.byte	0x83
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	0x643
+	.uleb128 0x23
+	.long	.LASF2775
+	.byte	0x70
+	.long	0xefb
+	.uleb128 0x18
+	.long	.LASF2776
+	.byte	0x70
+	.byte	0x3b
+	.long	0xefb
+	.byte	0
+	.uleb128 0x5
+	.long	0xb76
+	.uleb128 0x24
+	.long	.LASF2778
+	.byte	0x6b
+	.uleb128 0x35
+	.long	.LASF2777
+	.byte	0x12
+	.byte	0x64
+	.byte	0xd
+	.long	0xf1e
+	.uleb128 0x18
+	.long	.LASF2727
+	.byte	0x64
+	.byte	0x3d
+	.long	0xbe0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2779
+	.byte	0x5f
+	.uleb128 0x23
+	.long	.LASF2780
+	.byte	0x57
+	.long	0xf3a
+	.uleb128 0x18
+	.long	.LASF2758
+	.byte	0x57
+	.byte	0x32
+	.long	0xda8
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2781
+	.byte	0x48
+	.byte	0xcc
+	.long	0xefb
+	.uleb128 0x25
+	.long	.LASF2782
+	.byte	0x48
+	.byte	0x65
+	.long	0xf50
+	.uleb128 0x5
+	.long	0xb82
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 26 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 28 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1c
+	.file 29 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 31 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 32 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x20
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 37 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x25
+	.file 38 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 44 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 45 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2e
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1181
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1221
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 56 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x38
+	.file 57 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 58 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x3a
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 59 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x3b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1617
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x8
+	.file 60 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 61 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 62 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xb
+	.file 63 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3f
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 64 "./src/main/drivers/accgyro_adxl345.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x40
+	.byte	0x4
+	.file 65 "./src/main/drivers/accgyro_bma280.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x19
+	.byte	0x4
+	.file 66 "./src/main/drivers/accgyro_l3g4200d.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x42
+	.byte	0x4
+	.file 67 "./src/main/drivers/accgyro_l3gd20.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x43
+	.byte	0x4
+	.file 68 "./src/main/drivers/accgyro_lsm303dlhc.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 69 "./src/main/drivers/accgyro_mma845x.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x45
+	.byte	0x4
+	.file 70 "./src/main/drivers/accgyro_mpu3050.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 71 "./src/main/drivers/accgyro_mpu6050.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x47
+	.byte	0x4
+	.file 72 "./src/main/drivers/accgyro_mpu6500.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 73 "./src/main/drivers/accgyro_spi_bmi160.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x49
+	.byte	0x4
+	.file 74 "./src/main/drivers/accgyro_spi_icm20689.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 75 "./src/main/drivers/accgyro_spi_mpu6000.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 76 "./src/main/drivers/accgyro_spi_mpu6500.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x4c
+	.byte	0x4
+	.file 77 "./src/main/drivers/accgyro_spi_mpu9250.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 78 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x4e
+	.file 79 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4f
+	.byte	0x4
+	.byte	0x4
+	.file 80 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0xe
+	.file 81 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x51
+	.byte	0x4
+	.file 82 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x52
+	.byte	0x4
+	.file 83 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 84 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x54
+	.byte	0x4
+	.file 85 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x55
+	.file 86 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x56
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.file 87 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x57
+	.file 88 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x58
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.file 89 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2444
+	.byte	0x4
+	.file 90 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 91 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2448
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0xf
+	.file 92 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2458
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1143
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1147
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1159
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1171
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1173
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1290
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1293
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1299
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1303
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1308
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1335
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1496
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1509
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1526
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1527
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1530
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1457
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1567
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1575
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1580
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1583
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1585
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1612
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1647
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1736
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1826
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1835
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_lsm303dlhc.h.57.fca8398e4fda95a0f26079c2c3deff7e,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2003
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu3050.h.21.5c2c3f68cf533de2f049158113684e6d,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2010
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu6500.h.20.81784e103e59d17986bd067df6cf9997,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_icm20689.h.21.e4ceb006a38c1b53339fd03e766f2c2c,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2024
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_mpu6000.h.6.3b6c85f4d39f2b8f455a259d1cae7373,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1826
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_mpu9250.h.6.ec8aa7be40d86c318c904947d7c80cc8,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1826
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2037
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2443
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2457
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2461
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF2785
+	.long	.LASF2786
+	.long	.LASF2787
+	.long	.LASF2788
+	.long	.LASF2789
+	.long	.LASF2790
+	.long	.LASF2791
+	.long	.LASF2792
+	.long	.LASF2793
+	.long	.LASF2794
+	.long	.LASF2795
+	.long	.LASF2796
+	.long	.LASF2797
+	.long	.LASF2798
+	.long	.LASF2799
+	.long	.LASF2800
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x5d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2801
+	.byte	0xc
+	.long	.LASF2802
+	.byte	0xc
+	.long	.LASF2803
+	.byte	0xc
+	.long	.LASF2804
+	.byte	0x10
+	.long	.LASF2805
+	.byte	0x1
+	.long	.LASF2806
+	.byte	0x2
+	.long	.LASF2807
+	.byte	0x2
+	.long	.LASF2808
+	.byte	0x3
+	.long	.LASF2809
+	.byte	0x4
+	.long	.LASF2810
+	.byte	0x4
+	.long	.LASF2811
+	.byte	0x4
+	.long	.LASF2812
+	.byte	0x4
+	.long	.LASF2813
+	.byte	0x4
+	.long	.LASF2814
+	.byte	0x5
+	.long	.LASF2815
+	.byte	0x6
+	.long	.LASF2816
+	.byte	0x7
+	.long	.LASF2817
+	.byte	0x7
+	.long	.LASF2818
+	.byte	0x7
+	.long	.LASF2819
+	.byte	0x7
+	.long	.LASF2820
+	.byte	0x3
+	.long	.LASF2821
+	.byte	0xc
+	.long	.LASF2822
+	.byte	0x7
+	.long	.LASF2823
+	.byte	0xf
+	.long	.LASF2824
+	.byte	0x5
+	.long	.LASF2825
+	.byte	0x4
+	.long	.LASF2826
+	.byte	0xf
+	.long	.LASF2827
+	.byte	0x10
+	.long	.LASF2828
+	.byte	0x10
+	.long	.LASF2828
+	.byte	0xf
+	.long	.LASF2829
+	.byte	0xc
+	.long	.LASF2830
+	.byte	0xf
+	.long	.LASF2831
+	.byte	0xf
+	.long	.LASF2832
+	.byte	0xc
+	.long	.LASF2833
+	.byte	0xc
+	.long	.LASF2834
+	.byte	0xe
+	.long	.LASF2835
+	.byte	0xc
+	.long	.LASF2836
+	.byte	0xd
+	.long	.LASF2837
+	.byte	0xd
+	.long	.LASF2838
+	.byte	0xc
+	.long	.LASF2839
+	.byte	0xc
+	.long	.LASF2840
+	.byte	0xc
+	.long	.LASF2841
+	.byte	0xb
+	.long	.LASF2842
+	.byte	0xb
+	.long	.LASF2843
+	.byte	0xf
+	.long	.LASF2844
+	.byte	0xf
+	.long	.LASF2845
+	.byte	0xc
+	.long	.LASF2846
+	.byte	0xc
+	.long	.LASF2847
+	.byte	0xc
+	.long	.LASF2848
+	.byte	0xc
+	.long	.LASF2849
+	.byte	0xc
+	.long	.LASF2850
+	.byte	0xc
+	.long	.LASF2851
+	.byte	0xc
+	.long	.LASF2852
+	.byte	0xc
+	.long	.LASF2853
+	.byte	0xc
+	.long	.LASF2854
+	.byte	0xc
+	.long	.LASF2855
+	.byte	0xa
+	.long	.LASF2856
+	.byte	0x9
+	.long	.LASF2857
+	.byte	0x8
+	.long	.LASF2858
+	.byte	0x9
+	.long	.LASF2859
+	.byte	0x1
+	.long	.LASF2860
+	.byte	0x3
+	.long	.LASF2861
+	.byte	0x3
+	.long	.LASF2862
+	.byte	0x4
+	.long	.LASF2863
+	.byte	0x4
+	.long	.LASF2864
+	.byte	0x4
+	.long	.LASF2865
+	.byte	0x4
+	.long	.LASF2866
+	.byte	0x4
+	.long	.LASF2867
+	.byte	0x4
+	.long	.LASF2868
+	.byte	0x4
+	.long	.LASF2869
+	.byte	0x4
+	.long	.LASF2870
+	.byte	0x4
+	.long	.LASF2871
+	.byte	0x4
+	.long	.LASF2872
+	.byte	0x4
+	.long	.LASF2873
+	.byte	0x4
+	.long	.LASF2874
+	.byte	0x4
+	.long	.LASF2875
+	.byte	0x4
+	.long	.LASF2876
+	.byte	0x4
+	.long	.LASF2877
+	.byte	0x4
+	.long	.LASF2878
+	.byte	0x4
+	.long	.LASF2879
+	.byte	0x4
+	.long	.LASF2880
+	.byte	0x4
+	.long	.LASF2881
+	.byte	0x4
+	.long	.LASF2882
+	.byte	0x4
+	.long	.LASF2883
+	.byte	0x4
+	.long	.LASF2884
+	.byte	0x4
+	.long	.LASF2885
+	.byte	0x4
+	.long	.LASF2886
+	.byte	0x4
+	.long	.LASF2887
+	.byte	0x2
+	.long	.LASF2888
+	.byte	0x4
+	.long	.LASF2889
+	.byte	0x4
+	.long	.LASF2890
+	.byte	0x4
+	.long	.LASF2891
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2199:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2435:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2273:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF2128:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1155:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1206:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF826:
+	.string	"__DECL_SIMD_logf "
+.LASF2015:
+	.string	"ICM20602_WHO_AM_I_CONST (0x12)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1408:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF2551:
+	.string	"mpuConfiguration_s"
+.LASF2558:
+	.string	"mpuConfiguration_t"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1943:
+	.string	"LSM303DLHC_IT1_OVERRUN ((uint8_t)0x02)"
+.LASF1392:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF1151:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1484:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1334:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF1101:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1858:
+	.string	"LSM303DLHC_OUT_Z_L_A 0x2C"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1520:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1491:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF935:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF2646:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1358:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1936:
+	.string	"LSM303DLHC_HPF_AOI2_ENABLE ((uint8_t)0x02)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1485:
+	.string	"TELEMETRY_MAVLINK "
+.LASF2777:
+	.string	"resetFlightDynamicsTrims"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF863:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF2259:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1556:
+	.string	"USE_PPM"
+.LASF1990:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_5_6Ga 330"
+.LASF1748:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1743:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF2627:
+	.string	"FEATURE_RX_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF2439:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1464:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF2233:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2750:
+	.string	"sensorsSet"
+.LASF1322:
+	.string	"FP_NORMAL 4"
+.LASF999:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF979:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF836:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1434:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1907:
+	.string	"LSM303DLHC_AXES_ENABLE ((uint8_t)0x07)"
+.LASF2520:
+	.string	"reset"
+.LASF1687:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1625:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF939:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF2077:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1402:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF879:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2467:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1124:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1703:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1099:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1409:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF2536:
+	.string	"_Bool"
+.LASF794:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2129:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1241:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF2687:
+	.string	"flightDynamicsTrims_u"
+.LASF1536:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1267:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1234:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1486:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2588:
+	.string	"OWNER_ADC_CURR"
+.LASF2080:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF931:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF983:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1642:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1708:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF2089:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2291:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2399:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2372:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2669:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF2663:
+	.string	"BEEPER_GPS_STATUS"
+.LASF2056:
+	.string	"BIT(x) (1 << (x))"
+.LASF1339:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1832:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2000:
+	.string	"LSM303DLHC_SINGLE_CONVERSION ((uint8_t) 0x01)"
+.LASF1631:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF2529:
+	.string	"CW90_DEG_FLIP"
+.LASF1018:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2507:
+	.string	"DEBUG_COUNT"
+.LASF2078:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2362:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2463:
+	.string	"short unsigned int"
+.LASF1683:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1773:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2531:
+	.string	"CW270_DEG_FLIP"
+.LASF2172:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2452:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF840:
+	.string	"__DECL_SIMD_expf64 "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2160:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1492:
+	.string	"USE_SENSOR_NAMES "
+.LASF1217:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF2431:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1952:
+	.string	"LSM303DLHC_MOV_RECOGNITION ((uint8_t)0x40)"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1248:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1693:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1006:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1917:
+	.string	"LSM303DLHC_BLE_LSB ((uint8_t)0x00)"
+.LASF2429:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2682:
+	.string	"detectedSensors"
+.LASF1371:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF984:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2540:
+	.string	"read"
+.LASF937:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1818:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF2378:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1208:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1649:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1863:
+	.string	"LSM303DLHC_INT1_SOURCE_A 0x31"
+.LASF2585:
+	.string	"OWNER_LED"
+.LASF799:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2102:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2013:
+	.string	"MPU9255_WHO_AM_I_CONST (0x73)"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2636:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2556:
+	.string	"resetFn"
+.LASF2478:
+	.string	"uint16_t"
+.LASF837:
+	.string	"__DECL_SIMD_expl "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2441:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1117:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF2728:
+	.string	"accelerometerTrims"
+.LASF1160:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2370:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1898:
+	.string	"LSM303DLHC_ODR_50_HZ ((uint8_t)0x40)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2349:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1475:
+	.string	"TELEMETRY_HOTT "
+.LASF818:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF957:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1126:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2022:
+	.string	"MPU6500_BIT_I2C_IF_DIS (1 << 4)"
+.LASF1637:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1325:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF793:
+	.string	"_MATH_H 1"
+.LASF2168:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1600:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF2138:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF2770:
+	.string	"accInit"
+.LASF936:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1308:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF2014:
+	.string	"ICM20601_WHO_AM_I_CONST (0xAC)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF2064:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1501:
+	.string	"_T_PTRDIFF_ "
+.LASF2376:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1806:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF2143:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1689:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF807:
+	.string	"__DECL_SIMD_sinl "
+.LASF2251:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1381:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF1681:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1598:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1653:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1768:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF2217:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1348:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2122:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2754:
+	.string	"setAccelerationTrims"
+.LASF2408:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1854:
+	.string	"LSM303DLHC_OUT_X_L_A 0x28"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1666:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1755:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF2204:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1835:
+	.string	"GYRO_LPF_NONE 7"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2153:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1055:
+	.string	"__DECL_SIMD_tan "
+.LASF2059:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1390:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF1841:
+	.string	"LSM303DLHC_I2C_SCK_PIN PB6"
+.LASF1166:
+	.string	"__DECL_SIMD_erfc"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1412:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2668:
+	.string	"BEEPER_READY_BEEP"
+.LASF828:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2274:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2090:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2198:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2262:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2112:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2282:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1383:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF2394:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF2271:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1198:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2254:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1441:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1414:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF2202:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1879:
+	.string	"LSM303DLHC_OUT_X_H_M 0x03"
+.LASF1781:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF884:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2402:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1676:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1288:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF2176:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF827:
+	.string	"__DECL_SIMD_logl "
+.LASF1395:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF2592:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2612:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1333:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1172:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1158:
+	.string	"__DECL_SIMD_tanh"
+.LASF1961:
+	.string	"LSM303DLHC_Z_SINGLE_CLICK ((uint8_t)0x10)"
+.LASF1064:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1955:
+	.string	"LSM303DLHC_Z_LOW ((uint8_t)0x10)"
+.LASF2045:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1423:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1905:
+	.string	"LSM303DLHC_Y_ENABLE ((uint8_t)0x02)"
+.LASF2617:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1606:
+	.string	"__enable_irq() "
+.LASF1630:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF835:
+	.string	"__DECL_SIMD_exp "
+.LASF2106:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1045:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1170:
+	.string	"__DECL_SIMD_tan"
+.LASF910:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1249:
+	.string	"_Mdouble_"
+.LASF2476:
+	.string	"int32_t"
+.LASF1393:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1559:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1176:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1405:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF1106:
+	.string	"__DECL_SIMD_exp2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1387:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF2381:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1542:
+	.string	"BARO "
+.LASF1323:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1085:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1415:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1603:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF1019:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1123:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2126:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1522:
+	.string	"___int_wchar_t_h "
+.LASF2406:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2352:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF2051:
+	.string	"STR_HELPER(x) #x"
+.LASF1532:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF2173:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2028:
+	.string	"BITS_DLPF_CFG_98HZ 0x02"
+.LASF2034:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2369:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1925:
+	.string	"LSM303DLHC_HPFCF_8 ((uint8_t)0x00)"
+.LASF1097:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF2451:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1581:
+	.string	"VTX_TRAMP"
+.LASF1229:
+	.string	"FP_INT_UPWARD 0"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2614:
+	.string	"OWNER_BARO_EXTI"
+.LASF1090:
+	.string	"__DECL_SIMD_acos"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2554:
+	.string	"slowreadFn"
+.LASF1842:
+	.string	"LSM303DLHC_I2C_SDA_PIN PB7"
+.LASF1168:
+	.string	"__DECL_SIMD_erfcf"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1694:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1020:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2027:
+	.string	"BITS_DLPF_CFG_188HZ 0x01"
+.LASF1958:
+	.string	"LSM303DLHC_X_HIGH ((uint8_t)0x02)"
+.LASF934:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF2748:
+	.string	"gyroSensorBus"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1227:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF2434:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2688:
+	.string	"values"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2183:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2591:
+	.string	"OWNER_SERIAL_TX"
+.LASF1934:
+	.string	"LSM303DLHC_HPF_AOI1_ENABLE ((uint8_t)0x01)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1686:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1250:
+	.string	"__MATH_PRECNAME"
+.LASF970:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1978:
+	.string	"LSM303DLHC_FS_1_3_GA ((uint8_t) 0x20)"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1280:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1337:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1134:
+	.string	"__DECL_SIMD_log10"
+.LASF2512:
+	.string	"PGR_SIZE_MASK"
+.LASF1260:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1118:
+	.string	"__DECL_SIMD_expm1"
+.LASF1310:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF902:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF2011:
+	.string	"MPU6500_WHO_AM_I_CONST (0x70)"
+.LASF1103:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF1998:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_8_1Ga 205"
+.LASF1253:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2368:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2634:
+	.string	"FEATURE_FAILSAFE"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1220:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1578:
+	.string	"VTX_COMMON"
+.LASF1070:
+	.string	"__DECL_SIMD_sin"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1237:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1488:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1420:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2169:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2186:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF2346:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1950:
+	.string	"LSM303DLHC_OR_COMBINATION ((uint8_t)0x00)"
+.LASF2780:
+	.string	"resetRollAndPitchTrims"
+.LASF2042:
+	.string	"IOCFG_AF_OD 0"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2292:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2714:
+	.string	"acc_s"
+.LASF1007:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1314:
+	.string	"__MATHCALL_NARROW"
+.LASF2495:
+	.string	"DEBUG_VELOCITY"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1987:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_2_5Ga 670"
+.LASF1487:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1291:
+	.string	"_Mret_ _Float32"
+.LASF1777:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF2332:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1142:
+	.string	"__DECL_SIMD_log1p"
+.LASF1753:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1271:
+	.string	"__MATHDECL_1"
+.LASF2675:
+	.string	"BEEPER_PREFERENCE"
+.LASF1591:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2305:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1127:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2615:
+	.string	"OWNER_USB"
+.LASF1110:
+	.string	"__DECL_SIMD_exp10"
+.LASF2542:
+	.string	"ADCRaw"
+.LASF2766:
+	.string	"saveConfigAndNotify"
+.LASF1717:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1848:
+	.string	"LSM303DLHC_CTRL_REG3_A 0x22"
+.LASF402:
+	.string	"false 0"
+.LASF2626:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2345:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1948:
+	.string	"LSM303DLHC_IT2_ACT ((uint8_t)0x08)"
+.LASF1740:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1186:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1986:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_1_9Ga 855"
+.LASF1971:
+	.string	"LSM303DLHC_ODR_1_5_HZ ((uint8_t) 0x04)"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1454:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF959:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF2052:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1641:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2380:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f"
+.LASF988:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF883:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2450:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF895:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2699:
+	.string	"ACC_ADXL345"
+.LASF913:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2304:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1829:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF2314:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2652:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1661:
+	.string	"PG_PID_PROFILE 14"
+.LASF2547:
+	.string	"sensorAccReadFuncPtr"
+.LASF1900:
+	.string	"LSM303DLHC_ODR_200_HZ ((uint8_t)0x60)"
+.LASF1245:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1992:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_1_3Ga 980"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2638:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF2692:
+	.string	"SENSOR_BARO"
+.LASF2559:
+	.string	"MPU_NONE"
+.LASF2209:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1024:
+	.string	"__DECL_SIMD_erff128x "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1400:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF2377:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1178:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2596:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1572:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1364:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF2225:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1389:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF2635:
+	.string	"FEATURE_SONAR"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1678:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2268:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1721:
+	.string	"PG_VTX_CONFIG 515"
+.LASF2724:
+	.string	"acc_lpf_hz"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1398:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF2584:
+	.string	"OWNER_SERVO"
+.LASF1913:
+	.string	"LSM303DLHC_FULLSCALE_8G ((uint8_t)0x20)"
+.LASF1668:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1540:
+	.string	"ACC "
+.LASF2574:
+	.string	"mpu6050Resolution_e"
+.LASF1069:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1747:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF2740:
+	.string	"beeper"
+.LASF1660:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1483:
+	.string	"TELEMETRY_IBUS "
+.LASF1462:
+	.string	"USE_PWM "
+.LASF2655:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF920:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1825:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2665:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1827:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF2023:
+	.string	"ICM20689_WHO_AM_I_CONST (0x98)"
+.LASF996:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1163:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1108:
+	.string	"__DECL_SIMD_exp2f"
+.LASF2096:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2181:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2275:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2375:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2488:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF2130:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF854:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1685:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1516:
+	.string	"__WCHAR_T "
+.LASF2099:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2270:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1304:
+	.string	"_Mret_ _Float64"
+.LASF2285:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2326:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2772:
+	.string	"accDetect"
+.LASF2524:
+	.string	"CW0_DEG"
+.LASF2713:
+	.string	"accelerationSensor_e"
+.LASF2684:
+	.string	"roll"
+.LASF1507:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1643:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2104:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1426:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1954:
+	.string	"LSM303DLHC_Z_HIGH ((uint8_t)0x20)"
+.LASF2686:
+	.string	"flightDynamicsTrims_def_t"
+.LASF2468:
+	.string	"__int16_t"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1843:
+	.string	"LSM303DLHC_DRDY_PIN PE2"
+.LASF2493:
+	.string	"DEBUG_NOTCH"
+.LASF2470:
+	.string	"__uint16_t"
+.LASF1201:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2504:
+	.string	"DEBUG_DYN_NOTCH"
+.LASF1792:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2583:
+	.string	"OWNER_MOTOR"
+.LASF921:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF2753:
+	.string	"setAccelerationFilter"
+.LASF1906:
+	.string	"LSM303DLHC_Z_ENABLE ((uint8_t)0x04)"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1596:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2193:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1737:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF1814:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF2611:
+	.string	"OWNER_RX_SPI_CS"
+.LASF2567:
+	.string	"ICM_20602_SPI"
+.LASF966:
+	.string	"__DECL_SIMD_log10f "
+.LASF2527:
+	.string	"CW270_DEG"
+.LASF1915:
+	.string	"LSM303DLHC_BlockUpdate_Continous ((uint8_t)0x00)"
+.LASF1331:
+	.string	"math_errhandling 0"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2221:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF891:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2293:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1344:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF2076:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1772:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF860:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1305:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF2647:
+	.string	"FEATURE_AIRMODE"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2109:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF922:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1128:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF2323:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2107:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1877:
+	.string	"LSM303DLHC_CRB_REG_M 0x01"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF2398:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2132:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF2136:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1817:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF823:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1135:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF892:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1328:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2678:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2357:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF2695:
+	.string	"SENSOR_GPS"
+.LASF1298:
+	.string	"_Marg_ _Float128"
+.LASF1197:
+	.string	"__f32x(x) x ##f32x"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1270:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1231:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1351:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1252:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2050:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1312:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1722:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF2017:
+	.string	"MPU6500_BIT_RESET (0x80)"
+.LASF2533:
+	.string	"deviceSpi_s"
+.LASF1874:
+	.string	"LSM303DLHC_TIME_LATENCY_A 0x3C"
+.LASF355:
+	.string	"__amd64 1"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF2739:
+	.string	"accelerometerConfig_Registry"
+.LASF2081:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2462:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1301:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1983:
+	.string	"LSM303DLHC_FS_5_6_GA ((uint8_t) 0xC0)"
+.LASF2097:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1283:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF852:
+	.string	"__DECL_SIMD_powf32x "
+.LASF2630:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2779:
+	.string	"accResetRollAndPitchTrims"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2309:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2629:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1728:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1736:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1508:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2727:
+	.string	"accZero"
+.LASF1079:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF2358:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2418:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2004:
+	.string	"MPU3050_SMPLRT_DIV 0x15"
+.LASF1679:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2516:
+	.string	"biquadFilter_s"
+.LASF364:
+	.string	"__k8 1"
+.LASF1662:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1980:
+	.string	"LSM303DLHC_FS_2_5_GA ((uint8_t) 0x60)"
+.LASF1803:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2012:
+	.string	"MPU9250_WHO_AM_I_CONST (0x71)"
+.LASF2481:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1421:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1657:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1633:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2395:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1778:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1757:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF1273:
+	.string	"__MATHDECL"
+.LASF1538:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1489:
+	.string	"USE_MSP_PUSH "
+.LASF1017:
+	.string	"__DECL_SIMD_erfl "
+.LASF1815:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1557:
+	.string	"USE_PWM"
+.LASF1382:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF1881:
+	.string	"LSM303DLHC_OUT_Z_H_M 0x05"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF878:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1500:
+	.string	"_PTRDIFF_T "
+.LASF1586:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF2517:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1067:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2760:
+	.string	"performInflightAccelerationCalibration"
+.LASF2632:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1619:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2113:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF2213:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1145:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1897:
+	.string	"LSM303DLHC_ODR_25_HZ ((uint8_t)0x30)"
+.LASF974:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1761:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1742:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF811:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF2523:
+	.string	"ALIGN_DEFAULT"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1614:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF943:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1760:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF1479:
+	.string	"USE_SERVOS "
+.LASF1380:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2514:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF2108:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1639:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2005:
+	.string	"MPU3050_DLPF_FS_SYNC 0x16"
+.LASF2020:
+	.string	"MPU6500_BIT_INT_ANYRD_2CLEAR (1 << 4)"
+.LASF1989:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_4_7Ga 400"
+.LASF2623:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1472:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2571:
+	.string	"mpuSensor_e"
+.LASF1096:
+	.string	"__DECL_SIMD_atanf"
+.LASF1702:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1801:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2313:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF868:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1329:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1878:
+	.string	"LSM303DLHC_MR_REG_M 0x02"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2211:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2098:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1664:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2384:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2718:
+	.string	"acc_t"
+.LASF1257:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1307:
+	.string	"_Mret_ _Float64x"
+.LASF2664:
+	.string	"BEEPER_RX_SET"
+.LASF2539:
+	.string	"init"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1770:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1543:
+	.string	"USE_FAKE_BARO "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2561:
+	.string	"MPU_60x0"
+.LASF2284:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2232:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1406:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF2605:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1776:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF2401:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1372:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF1974:
+	.string	"LSM303DLHC_ODR_15_HZ ((uint8_t) 0x10)"
+.LASF1880:
+	.string	"LSM303DLHC_OUT_X_L_M 0x04"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2673:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF916:
+	.string	"__DECL_SIMD_coshf "
+.LASF1212:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF2190:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF997:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2266:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF2182:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1425:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1190:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2545:
+	.string	"mpuDetectionResult"
+.LASF2137:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1758:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF2032:
+	.string	"mpu9250_CONFIG 0x1A"
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF894:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2497:
+	.string	"DEBUG_ANGLERATE"
+.LASF1838:
+	.string	"LSM303DLHC_FLAG_TIMEOUT ((uint32_t)0x1000)"
+.LASF2419:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2562:
+	.string	"MPU_60x0_SPI"
+.LASF1982:
+	.string	"LSM303DLHC_FS_4_7_GA ((uint8_t) 0xA0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2219:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF941:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2510:
+	.string	"PGR_PGN_MASK"
+.LASF2238:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2289:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1404:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF1798:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1187:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2335:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1244:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1247:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2650:
+	.string	"FEATURE_RX_SPI"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2295:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1530:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2421:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2350:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1684:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF804:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1459:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF2038:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF967:
+	.string	"__DECL_SIMD_log10l "
+.LASF2483:
+	.string	"debug"
+.LASF1920:
+	.string	"LSM303DLHC_BOOT_REBOOTMEMORY ((uint8_t)0x80)"
+.LASF1449:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2433:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2705:
+	.string	"ACC_MPU6500"
+.LASF1370:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1847:
+	.string	"LSM303DLHC_CTRL_REG2_A 0x21"
+.LASF1232:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF1830:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF844:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2087:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1957:
+	.string	"LSM303DLHC_Y_LOW ((uint8_t)0x04)"
+.LASF1592:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF2392:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1635:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF2178:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1894:
+	.string	"LSM303DLHC_LOWPOWER_MODE ((uint8_t)0x08)"
+.LASF1189:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2373:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF795:
+	.string	"__DECL_SIMD_cos "
+.LASF2351:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1066:
+	.string	"__DECL_SIMD_cos"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1428:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF2031:
+	.string	"MPU6000_WHO_AM_I_CONST (0x68)"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1739:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF1887:
+	.string	"LSM303DLHC_IRB_REG_M 0x0B"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1820:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF954:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2616:
+	.string	"OWNER_USB_DETECT"
+.LASF973:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2382:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2116:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF876:
+	.string	"__DECL_SIMD_asinf "
+.LASF2348:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1793:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF2518:
+	.string	"size"
+.LASF1461:
+	.string	"USE_PPM "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1949:
+	.string	"LSM303DLHC_IT2_HLACTIVE ((uint8_t)0x02)"
+.LASF2310:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2679:
+	.string	"SENSOR_INDEX_BARO"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1704:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2141:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2553:
+	.string	"writeFn"
+.LASF2751:
+	.string	"fakeAccDetect"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2676:
+	.string	"beeperMode_e"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1821:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1531:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1923:
+	.string	"LSM303DLHC_HPM_NORMAL_MODE ((uint8_t)0x80)"
+.LASF1068:
+	.string	"__DECL_SIMD_cosf"
+.LASF1261:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1114:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1870:
+	.string	"LSM303DLHC_CLICK_CFG_A 0x38"
+.LASF843:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2071:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF2241:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1113:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF796:
+	.string	"__DECL_SIMD_cosf "
+.LASF1960:
+	.string	"LSM303DLHC_Z_DOUBLE_CLICK ((uint8_t)0x20)"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF2246:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1839:
+	.string	"LSM303DLHC_LONG_TIMEOUT ((uint32_t)(10 * LSM303DLHC_FLAG_TIMEOUT))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1159:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2082:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1184:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2642:
+	.string	"FEATURE_DASHBOARD"
+.LASF1746:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1627:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1350:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2110:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2500:
+	.string	"DEBUG_STACK"
+.LASF2620:
+	.string	"OWNER_INVERTER"
+.LASF1347:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2480:
+	.string	"size_t"
+.LASF1836:
+	.string	"LSM303DLHC_OK ((uint32_t) 0)"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2600:
+	.string	"OWNER_SPI_MOSI"
+.LASF2290:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2201:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2404:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2515:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2477:
+	.string	"uint8_t"
+.LASF1433:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF1888:
+	.string	"LSM303DLHC_IRC_REG_M 0x0C"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2149:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1213:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF2599:
+	.string	"OWNER_SPI_MISO"
+.LASF2506:
+	.string	"DEBUG_DSHOT_RPM_TELEMETRY"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2393:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2364:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1251:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2253:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2338:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1899:
+	.string	"LSM303DLHC_ODR_100_HZ ((uint8_t)0x50)"
+.LASF2054:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1732:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF2680:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1473:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF861:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1394:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF2747:
+	.string	"gyroMpuConfiguration"
+.LASF1149:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1373:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1167:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1035:
+	.string	"__DECL_SIMD_asinh "
+.LASF927:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1303:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF2768:
+	.string	"accSetCalibrationCycles"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1735:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF2456:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1884:
+	.string	"LSM303DLHC_OUT_Y_L_M 0x08"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1524:
+	.string	"_GCC_WCHAR_T "
+.LASF1519:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2707:
+	.string	"ACC_ICM20601"
+.LASF2708:
+	.string	"ACC_ICM20602"
+.LASF1779:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF1063:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1570:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1981:
+	.string	"LSM303DLHC_FS_4_0_GA ((uint8_t) 0x80)"
+.LASF1726:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1214:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1354:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF2694:
+	.string	"SENSOR_SONAR"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1319:
+	.string	"FP_INFINITE 1"
+.LASF1309:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF915:
+	.string	"__DECL_SIMD_cosh "
+.LASF1311:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF805:
+	.string	"__DECL_SIMD_sin "
+.LASF2667:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1537:
+	.string	"LED0_PIN NONE"
+.LASF2148:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF2397:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1571:
+	.string	"TELEMETRY_CRSF"
+.LASF1544:
+	.string	"MAG "
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1527:
+	.string	"_BSD_WCHAR_T_"
+.LASF1386:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF1073:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2715:
+	.string	"accSamplingInterval"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF2167:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1180:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2316:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF2737:
+	.string	"accLpfCutHz"
+.LASF2613:
+	.string	"OWNER_MPU_EXTI"
+.LASF1089:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1964:
+	.string	"LSM303DLHC_X_DOUBLE_CLICK ((uint8_t)0x02)"
+.LASF2070:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1171:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2287:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF2582:
+	.string	"OWNER_PPMINPUT"
+.LASF2758:
+	.string	"rollAndPitchTrims"
+.LASF2043:
+	.string	"IOCFG_IPD 0"
+.LASF1510:
+	.string	"__need_ptrdiff_t"
+.LASF848:
+	.string	"__DECL_SIMD_powf16 "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1205:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1453:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1951:
+	.string	"LSM303DLHC_AND_COMBINATION ((uint8_t)0x80)"
+.LASF917:
+	.string	"__DECL_SIMD_coshl "
+.LASF1618:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2417:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2752:
+	.string	"axis"
+.LASF1265:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1682:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1497:
+	.string	"_STDDEF_H "
+.LASF2360:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1116:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1939:
+	.string	"LSM303DLHC_IT1_AOI2 ((uint8_t)0x20)"
+.LASF1072:
+	.string	"__DECL_SIMD_sinf"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF2203:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1794:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF2428:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF801:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1191:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1709:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1437:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF833:
+	.string	"__DECL_SIMD_logf64x "
+.LASF2436:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2297:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF2767:
+	.string	"isAccelerationCalibrationComplete"
+.LASF1707:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1254:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2041:
+	.string	"IOCFG_AF_PP 0"
+.LASF2145:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1672:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1296:
+	.string	"_Marg_ _Float64x"
+.LASF1636:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1577:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF2040:
+	.string	"IOCFG_OUT_OD 0"
+.LASF2569:
+	.string	"ICM_20689_SPI"
+.LASF869:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1677:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1930:
+	.string	"LSM303DLHC_HIGHPASSFILTER_ENABLE ((uint8_t)0x08)"
+.LASF2100:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2303:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1181:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2185:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF928:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2001:
+	.string	"LSM303DLHC_SLEEP ((uint8_t) 0x02)"
+.LASF1215:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1956:
+	.string	"LSM303DLHC_Y_HIGH ((uint8_t)0x08)"
+.LASF1439:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF2776:
+	.string	"instance"
+.LASF1962:
+	.string	"LSM303DLHC_Y_DOUBLE_CLICK ((uint8_t)0x08)"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2224:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1731:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF2353:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2503:
+	.string	"DEBUG_FFT"
+.LASF1720:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1969:
+	.string	"LSM303DLHC_INT1INTERRUPT_HIGH_EDGE ((uint8_t)0x00)"
+.LASF1567:
+	.string	"LED_STRIP"
+.LASF2334:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1133:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF2039:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1179:
+	.string	"__f128(x) x ##f128"
+.LASF2781:
+	.string	"accelerometerConfigMutable"
+.LASF1256:
+	.string	"_Mdouble_ long double"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1882:
+	.string	"LSM303DLHC_OUT_Z_L_M 0x06"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1991:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_8_1Ga 230"
+.LASF2379:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2135:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2490:
+	.string	"DEBUG_MIXER"
+.LASF2119:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1075:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF2761:
+	.string	"accZero_saved"
+.LASF2210:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1563:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1628:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2645:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF2438:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2006:
+	.string	"MPU3050_INT_CFG 0x17"
+.LASF2033:
+	.string	"MPU9250_BIT_RESET (0x80)"
+.LASF1834:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2245:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF890:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2196:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1091:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF877:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1474:
+	.string	"TELEMETRY_FRSKY "
+.LASF2009:
+	.string	"MPU3050_USER_CTRL 0x3D"
+.LASF2074:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF2711:
+	.string	"ACC_BMI160"
+.LASF1056:
+	.string	"__DECL_SIMD_tanf "
+.LASF1963:
+	.string	"LSM303DLHC_Y_SINGLE_CLICK ((uint8_t)0x04)"
+.LASF2321:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1741:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1718:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF2691:
+	.string	"SENSOR_ACC"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1733:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF2595:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1715:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2519:
+	.string	"address"
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1378:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF1891:
+	.string	"ACC_I2C_ADDRESS 0x32"
+.LASF2319:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2223:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2226:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1972:
+	.string	"LSM303DLHC_ODR_3_0_HZ ((uint8_t) 0x08)"
+.LASF2037:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1601:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF2278:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF1562:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1292:
+	.string	"_Marg_ _Float32x"
+.LASF797:
+	.string	"__DECL_SIMD_cosl "
+.LASF1752:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF2683:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF2016:
+	.string	"ICM20608G_WHO_AM_I_CONST (0xAF)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1216:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1239:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF2155:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2265:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF2773:
+	.string	"accHardwareToUse"
+.LASF1872:
+	.string	"LSM303DLHC_CLICK_THS_A 0x3A"
+.LASF2648:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF2427:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2685:
+	.string	"pitch"
+.LASF783:
+	.string	"__size_t "
+.LASF2597:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2003:
+	.string	"LSM303DLHC_TEMPSENSOR_DISABLE ((uint8_t) 0x00)"
+.LASF1893:
+	.string	"LSM303DLHC_NORMAL_MODE ((uint8_t)0x00)"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1511:
+	.string	"__wchar_t__ "
+.LASF1634:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1589:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1218:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1440:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF499:
+	.string	"__PMT"
+.LASF2084:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1525:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2701:
+	.string	"ACC_MMA8452"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF2670:
+	.string	"BEEPER_ARMED"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1727:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1584:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1845:
+	.string	"LSM303DLHC_I2C_INT2_PIN PE5"
+.LASF2046:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1762:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2563:
+	.string	"MPU_65xx_I2C"
+.LASF2762:
+	.string	"angleTrim_saved"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1696:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1456:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1947:
+	.string	"LSM303DLHC_IT2_BOOT ((uint8_t)0x10)"
+.LASF1343:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1583:
+	.string	"USE_RESOURCE_MGMT"
+.LASF976:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1391:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF2371:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1268:
+	.string	"_Mdouble_ _Float64x"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1401:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF1025:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2457:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2222:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1465:
+	.string	"USE_SERIALRX_IBUS "
+.LASF825:
+	.string	"__DECL_SIMD_log "
+.LASF2513:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1321:
+	.string	"FP_SUBNORMAL 3"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1177:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2365:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1654:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1922:
+	.string	"LSM303DLHC_HPM_REF_SIGNAL ((uint8_t)0x40)"
+.LASF2147:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1138:
+	.string	"__DECL_SIMD_log2"
+.LASF1533:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF2301:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1569:
+	.string	"TELEMETRY_HOTT"
+.LASF2732:
+	.string	"AccInflightCalibrationMeasurementDone"
+.LASF2355:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1938:
+	.string	"LSM303DLHC_IT1_AOI1 ((uint8_t)0x40)"
+.LASF1336:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2587:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2191:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1851:
+	.string	"LSM303DLHC_CTRL_REG6_A 0x25"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1617:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1153:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1513:
+	.string	"_WCHAR_T "
+.LASF2487:
+	.string	"DEBUG_BATTERY"
+.LASF2220:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1238:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1622:
+	.string	"UNIT_TESTED "
+.LASF2742:
+	.string	"feature"
+.LASF829:
+	.string	"__DECL_SIMD_logf32 "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2430:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1941:
+	.string	"LSM303DLHC_IT1_DRY2 ((uint8_t)0x08)"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF2302:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF965:
+	.string	"__DECL_SIMD_log10 "
+.LASF1594:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF874:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF2651:
+	.string	"FEATURE_SOFTSPI"
+.LASF1080:
+	.string	"__DECL_SIMD_logf"
+.LASF2021:
+	.string	"MPU6500_BIT_RAW_RDY_EN (1 << 0)"
+.LASF2550:
+	.string	"mpuResetFnPtr"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1093:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF2229:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1647:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF873:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2281:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2783:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1193:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1648:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF2010:
+	.string	"MPU3050_PWR_MGM 0x3E"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1632:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1452:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF2689:
+	.string	"flightDynamicsTrims_t"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1902:
+	.string	"LSM303DLHC_ODR_1620_HZ_LP ((uint8_t)0x80)"
+.LASF1313:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2749:
+	.string	"memset"
+.LASF1264:
+	.string	"_Mdouble_ _Float128"
+.LASF1374:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF1724:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF2733:
+	.string	"AccInflightCalibrationSavetoEEProm"
+.LASF1985:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_1_3Ga 1100"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2248:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1044:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1419:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1422:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF2391:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1918:
+	.string	"LSM303DLHC_BLE_MSB ((uint8_t)0x40)"
+.LASF2250:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1136:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1875:
+	.string	"LSM303DLHC_TIME_WINDOW_A 0x3D"
+.LASF2389:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1467:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2212:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2710:
+	.string	"ACC_ICM20689"
+.LASF1867:
+	.string	"LSM303DLHC_INT2_SOURCE_A 0x35"
+.LASF1931:
+	.string	"LSM303DLHC_HPF_CLICK_DISABLE ((uint8_t)0x00)"
+.LASF2322:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1438:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF2086:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1353:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF2115:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF987:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2448:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1749:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF914:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2092:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF819:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF992:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2117:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1417:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF2734:
+	.string	"AccInflightCalibrationActive"
+.LASF1613:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2717:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF2674:
+	.string	"BEEPER_ALL"
+.LASF1221:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2654:
+	.string	"BEEPER_SILENCE"
+.LASF881:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1953:
+	.string	"LSM303DLHC_POS_RECOGNITION ((uint8_t)0xC0)"
+.LASF849:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF980:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1342:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1566:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF865:
+	.string	"__DECL_SIMD_atan "
+.LASF1813:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF911:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1786:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1593:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF2267:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1859:
+	.string	"LSM303DLHC_OUT_Z_H_A 0x2D"
+.LASF1272:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1295:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1481:
+	.string	"CMS "
+.LASF2548:
+	.string	"mpuReadRegisterFnPtr"
+.LASF1130:
+	.string	"__DECL_SIMD_atan2"
+.LASF1959:
+	.string	"LSM303DLHC_X_LOW ((uint8_t)0x01)"
+.LASF2300:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF2782:
+	.string	"accelerometerConfig"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1655:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF2200:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF2662:
+	.string	"BEEPER_BAT_LOW"
+.LASF1281:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF882:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2603:
+	.string	"OWNER_SDCARD"
+.LASF1286:
+	.string	"__MATHCALL_NAME"
+.LASF1670:
+	.string	"PG_RX_CONFIG 24"
+.LASF985:
+	.string	"__DECL_SIMD_log1p "
+.LASF1787:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF2336:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1744:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF1057:
+	.string	"__DECL_SIMD_tanl "
+.LASF912:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1979:
+	.string	"LSM303DLHC_FS_1_9_GA ((uint8_t) 0x40)"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1873:
+	.string	"LSM303DLHC_TIME_LIMIT_A 0x3B"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1330:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1695:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1826:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1610:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2475:
+	.string	"int16_t"
+.LASF1692:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF2269:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1146:
+	.string	"__DECL_SIMD_atanh"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1384:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2230:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2466:
+	.string	"signed char"
+.LASF1194:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF2283:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1626:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF830:
+	.string	"__DECL_SIMD_logf64 "
+.LASF813:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2170:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2485:
+	.string	"DEBUG_NONE"
+.LASF1914:
+	.string	"LSM303DLHC_FULLSCALE_16G ((uint8_t)0x30)"
+.LASF929:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1477:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1316:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1478:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1535:
+	.string	"U_ID_1 1"
+.LASF2133:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1209:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1164:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1555:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1521:
+	.string	"_WCHAR_T_H "
+.LASF2549:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1663:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1144:
+	.string	"__DECL_SIMD_log1pf"
+.LASF2552:
+	.string	"readFn"
+.LASF2036:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF2640:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1612:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1710:
+	.string	"PG_PID_CONFIG 504"
+.LASF809:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF981:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1289:
+	.string	"_Mret_ double"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2060:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1624:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1892:
+	.string	"MAG_I2C_ADDRESS 0x3C"
+.LASF2328:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2247:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2449:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF2422:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1095:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1196:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2658:
+	.string	"BEEPER_DISARMING"
+.LASF2706:
+	.string	"ACC_MPU9250"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1219:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1411:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF1476:
+	.string	"TELEMETRY_LTM "
+.LASF1869:
+	.string	"LSM303DLHC_INT2_DURATION_A 0x37"
+.LASF2489:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF2079:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF2343:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1446:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF2058:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF977:
+	.string	"__DECL_SIMD_log2l "
+.LASF1862:
+	.string	"LSM303DLHC_INT1_CFG_A 0x30"
+.LASF1800:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF2744:
+	.string	"biquadFilterApply"
+.LASF2446:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1671:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2330:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1078:
+	.string	"__DECL_SIMD_log"
+.LASF2543:
+	.string	"revisionCode"
+.LASF1788:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2479:
+	.string	"uint32_t"
+.LASF1185:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF887:
+	.string	"__DECL_SIMD_hypotl "
+.LASF2625:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1599:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1597:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1675:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1258:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2159:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1970:
+	.string	"LSM303DLHC_ODR_0_75_HZ ((uint8_t) 0x00)"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1285:
+	.string	"_Marg_"
+.LASF1512:
+	.string	"__WCHAR_T__ "
+.LASF1036:
+	.string	"__DECL_SIMD_asinhf "
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2366:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1471:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1499:
+	.string	"_ANSI_STDDEF_H "
+.LASF1725:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1432:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF2618:
+	.string	"OWNER_OSD"
+.LASF821:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1396:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF2306:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2337:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2420:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2511:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF831:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2386:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2280:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1084:
+	.string	"__DECL_SIMD_expf"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF2139:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1081:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2565:
+	.string	"MPU_9250_SPI"
+.LASF1207:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2118:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1346:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF2088:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2455:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1211:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1587:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF2778:
+	.string	"accResetFlightDynamicsTrims"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF888:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1299:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF2162:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2068:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF822:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1255:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF1976:
+	.string	"LSM303DLHC_ODR_75_HZ ((uint8_t) 0x18)"
+.LASF1195:
+	.string	"__f32(x) x ##f32"
+.LASF1615:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF2759:
+	.string	"applyAccelerationTrims"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1320:
+	.string	"FP_ZERO 2"
+.LASF1935:
+	.string	"LSM303DLHC_HPF_AOI2_DISABLE ((uint8_t)0x00)"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2765:
+	.string	"isOnFinalAccelerationCalibrationCycle"
+.LASF2363:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF839:
+	.string	"__DECL_SIMD_expf32 "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF2111:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1553:
+	.string	"USE_UART8 "
+.LASF838:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1860:
+	.string	"LSM303DLHC_FIFO_CTRL_REG_A 0x2E"
+.LASF2094:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1946:
+	.string	"LSM303DLHC_IT2_INT2 ((uint8_t)0x20)"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2325:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1805:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF2294:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2643:
+	.string	"FEATURE_OSD"
+.LASF2709:
+	.string	"ACC_ICM20608G"
+.LASF1700:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF982:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1480:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1119:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1997:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_5_6Ga 295"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2279:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2062:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1139:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1233:
+	.string	"FP_INT_TONEAREST 4"
+.LASF2075:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1674:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF942:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2473:
+	.string	"long int"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1102:
+	.string	"__DECL_SIMD_hypot"
+.LASF1667:
+	.string	"PG_SERVO_MIXER 21"
+.LASF2163:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF978:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1711:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2249:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF1014:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1833:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2593:
+	.string	"OWNER_PINDEBUG"
+.LASF2142:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2409:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1994:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_2_5Ga 600"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1912:
+	.string	"LSM303DLHC_FULLSCALE_4G ((uint8_t)0x10)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF546:
+	.string	"__always_inline"
+.LASF2764:
+	.string	"isOnFirstAccelerationCalibrationCycle"
+.LASF1876:
+	.string	"LSM303DLHC_CRA_REG_M 0x00"
+.LASF2660:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF2725:
+	.string	"acc_align"
+.LASF1482:
+	.string	"TELEMETRY_CRSF "
+.LASF2499:
+	.string	"DEBUG_SCHEDULER"
+.LASF1504:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF2055:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2696:
+	.string	"SENSOR_GPSMAG"
+.LASF1780:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2743:
+	.string	"lrintf"
+.LASF1503:
+	.string	"__PTRDIFF_T "
+.LASF1495:
+	.string	"VTX_SMARTAUDIO "
+.LASF2121:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1937:
+	.string	"LSM303DLHC_IT1_CLICK ((uint8_t)0x80)"
+.LASF2242:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1924:
+	.string	"LSM303DLHC_HPM_AUTORESET_INT ((uint8_t)0xC0)"
+.LASF1240:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1658:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF2308:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1644:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF945:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1763:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF2053:
+	.string	"EXPAND_I(x) x"
+.LASF2218:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2385:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1210:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF2125:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1831:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF2726:
+	.string	"acc_hardware"
+.LASF1574:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2175:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1246:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2257:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1824:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF2712:
+	.string	"ACC_FAKE"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF2252:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1074:
+	.string	"__DECL_SIMD_sincos"
+.LASF1857:
+	.string	"LSM303DLHC_OUT_Y_H_A 0x2B"
+.LASF2057:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1534:
+	.string	"U_ID_0 0"
+.LASF1147:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1143:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1157:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1199:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1349:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1908:
+	.string	"LSM303DLHC_AXES_DISABLE ((uint8_t)0x00)"
+.LASF2347:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF975:
+	.string	"__DECL_SIMD_log2 "
+.LASF2140:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1529:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF963:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF994:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1435:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1443:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1975:
+	.string	"LSM303DLHC_ODR_30_HZ ((uint8_t) 0x14)"
+.LASF1200:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1004:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2083:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF2755:
+	.string	"initialAccLpfCutHz"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1365:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF2299:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1202:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF845:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1568:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1332:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1345:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1236:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2458:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1690:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2484:
+	.string	"debugMode"
+.LASF1514:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1430:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1993:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_1_9Ga 760"
+.LASF2158:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1797:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2207:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF2628:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF814:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1399:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF1100:
+	.string	"__DECL_SIMD_asinf"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1526:
+	.string	"__DEFINED_wchar_t "
+.LASF2594:
+	.string	"OWNER_TIMER"
+.LASF2538:
+	.string	"accDev_s"
+.LASF2579:
+	.string	"accDev_t"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1691:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF2541:
+	.string	"acc_1G"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2388:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2144:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2341:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1868:
+	.string	"LSM303DLHC_INT2_THS_A 0x36"
+.LASF2344:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"USE_FAKE_MAG "
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2085:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1903:
+	.string	"LSM303DLHC_ODR_1344_HZ ((uint8_t)0x90)"
+.LASF1088:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF2741:
+	.string	"alignSensors"
+.LASF1582:
+	.string	"BLACKBOX"
+.LASF1856:
+	.string	"LSM303DLHC_OUT_Y_L_A 0x2A"
+.LASF2474:
+	.string	"char"
+.LASF1278:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1802:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF971:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2214:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF885:
+	.string	"__DECL_SIMD_hypot "
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1585:
+	.string	"USE_DSHOT"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF2426:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1861:
+	.string	"LSM303DLHC_FIFO_SRC_REG_A 0x2F"
+.LASF1188:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2151:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1916:
+	.string	"LSM303DLHC_BlockUpdate_Single ((uint8_t)0x80)"
+.LASF2298:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1602:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF968:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1560:
+	.string	"USE_SERIALRX_IBUS"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF2522:
+	.string	"IO_t"
+.LASF1223:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2730:
+	.string	"accelerometerConfig_System"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1445:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF925:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1306:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF800:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF972:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF864:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1751:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF2339:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1729:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1929:
+	.string	"LSM303DLHC_HIGHPASSFILTER_DISABLE ((uint8_t)0x00)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2606:
+	.string	"OWNER_FLASH_CS"
+.LASF2286:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1228:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF1565:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1490:
+	.string	"USE_RX_MSP "
+.LASF2049:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2260:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF1575:
+	.string	"TELEMETRY_IBUS"
+.LASF401:
+	.string	"true 1"
+.LASF1785:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF802:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2114:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF2443:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF856:
+	.string	"__DECL_SIMD_acosf "
+.LASF1822:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2702:
+	.string	"ACC_BMA280"
+.LASF1886:
+	.string	"LSM303DLHC_IRA_REG_M 0x0A"
+.LASF2460:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF1921:
+	.string	"LSM303DLHC_HPM_NORMAL_MODE_RES ((uint8_t)0x00)"
+.LASF842:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2492:
+	.string	"DEBUG_PIDLOOP"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1104:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1713:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2566:
+	.string	"ICM_20601_SPI"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1759:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2769:
+	.string	"calibrationCyclesRequired"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1183:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF851:
+	.string	"__DECL_SIMD_powf128 "
+.LASF765:
+	.string	"__need_NULL "
+.LASF1901:
+	.string	"LSM303DLHC_ODR_400_HZ ((uint8_t)0x70)"
+.LASF944:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1115:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1455:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1558:
+	.string	"SERIAL_RX"
+.LASF1866:
+	.string	"LSM303DLHC_INT2_CFG_A 0x34"
+.LASF1235:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1607:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1611:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1121:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1361:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF880:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2263:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF2530:
+	.string	"CW180_DEG_FLIP"
+.LASF2442:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1968:
+	.string	"LSM303DLHC_INT1INTERRUPT_LOW_EDGE ((uint8_t)0x20)"
+.LASF2243:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2405:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1588:
+	.string	"USE_PROFILE "
+.LASF1864:
+	.string	"LSM303DLHC_INT1_THS_A 0x32"
+.LASF2631:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1933:
+	.string	"LSM303DLHC_HPF_AOI1_DISABLE ((uint8_t)0x00)"
+.LASF1688:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1580:
+	.string	"VTX_SMARTAUDIO"
+.LASF1466:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2598:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2179:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2590:
+	.string	"OWNER_ADC_RSSI"
+.LASF1620:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1137:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2340:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1368:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1105:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF810:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF906:
+	.string	"__DECL_SIMD_exp10f "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1284:
+	.string	"_Mret_"
+.LASF2537:
+	.string	"sensorAccInitFuncPtr"
+.LASF2157:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2195:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1965:
+	.string	"LSM303DLHC_X_SINGLE_CLICK ((uint8_t)0x01)"
+.LASF1528:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2066:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF2030:
+	.string	"GYRO_SCALE_FACTOR 0.00053292f"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1502:
+	.string	"_T_PTRDIFF "
+.LASF870:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1062:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1005:
+	.string	"__DECL_SIMD_acosh "
+.LASF2671:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF1169:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF2272:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF2757:
+	.string	"accUpdate"
+.LASF2644:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1429:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1541:
+	.string	"USE_FAKE_ACC "
+.LASF1889:
+	.string	"LSM303DLHC_TEMP_OUT_H_M 0x31"
+.LASF1367:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF2150:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF2508:
+	.string	"biquadFilter_t"
+.LASF1315:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1712:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2320:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2656:
+	.string	"BEEPER_RX_LOST"
+.LASF1447:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1226:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1318:
+	.string	"FP_NAN 0"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1988:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_4Ga 450"
+.LASF1111:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2496:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2415:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF918:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1015:
+	.string	"__DECL_SIMD_erf "
+.LASF2560:
+	.string	"MPU_3050"
+.LASF1107:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2235:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2525:
+	.string	"CW90_DEG"
+.LASF2333:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1222:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2649:
+	.string	"FEATURE_VTX"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2240:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2532:
+	.string	"sensor_align_e"
+.LASF2361:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2146:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2731:
+	.string	"InflightcalibratingA"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1152:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1355:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF2276:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2437:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2720:
+	.string	"rollAndPitchTrims_t_def"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1131:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1919:
+	.string	"LSM303DLHC_BOOT_NORMALMODE ((uint8_t)0x00)"
+.LASF1665:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF2234:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2491:
+	.string	"DEBUG_AIRMODE"
+.LASF1077:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1424:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1230:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF1904:
+	.string	"LSM303DLHC_X_ENABLE ((uint8_t)0x01)"
+.LASF855:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2555:
+	.string	"verifywriteFn"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF926:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1609:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF832:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1701:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1638:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF2061:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF862:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF2255:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2486:
+	.string	"DEBUG_CYCLETIME"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF2501:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF1458:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1204:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1444:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1087:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2331:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2482:
+	.string	"double"
+.LASF1846:
+	.string	"LSM303DLHC_CTRL_REG1_A 0x20"
+.LASF2454:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF2187:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1765:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF858:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1723:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF2261:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF2069:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2035:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF1203:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1397:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF2601:
+	.string	"OWNER_I2C_SCL"
+.LASF1092:
+	.string	"__DECL_SIMD_acosf"
+.LASF1932:
+	.string	"LSM303DLHC_HPF_CLICK_ENABLE ((uint8_t)0x04)"
+.LASF1150:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2624:
+	.string	"OWNER_COMPASS_CS"
+.LASF1517:
+	.string	"_WCHAR_T_ "
+.LASF2738:
+	.string	"accFilter"
+.LASF1539:
+	.string	"USE_FAKE_GYRO "
+.LASF1795:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2007:
+	.string	"MPU3050_TEMP_OUT 0x1B"
+.LASF893:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2653:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF1651:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2639:
+	.string	"FEATURE_RX_MSP"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1719:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF2192:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2208:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1645:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1518:
+	.string	"_BSD_WCHAR_T_ "
+.LASF903:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2215:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2258:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2633:
+	.string	"FEATURE_GPS"
+.LASF2723:
+	.string	"accelerometerConfig_s"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2729:
+	.string	"accelerometerConfig_t"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2459:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1341:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2383:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2231:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2471:
+	.string	"__int32_t"
+.LASF1224:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2602:
+	.string	"OWNER_I2C_SDA"
+.LASF2472:
+	.string	"__uint32_t"
+.LASF866:
+	.string	"__DECL_SIMD_atanf "
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1730:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1791:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1771:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF2641:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF940:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2578:
+	.string	"mpuDetectionResult_t"
+.LASF1796:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2535:
+	.string	"busDevice_t"
+.LASF1442:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1460:
+	.string	"USE_CLI "
+.LASF2256:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2570:
+	.string	"BMI_160_SPI"
+.LASF1156:
+	.string	"__DECL_SIMD_erff"
+.LASF1564:
+	.string	"USE_SERIALRX_SUMH"
+.LASF2134:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1804:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2387:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2461:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF2607:
+	.string	"OWNER_FLASH"
+.LASF857:
+	.string	"__DECL_SIMD_acosl "
+.LASF1293:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1697:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1450:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF1083:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2101:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1966:
+	.string	"LSM303DLHC_INT1INTERRUPT_DISABLE ((uint8_t)0x00)"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1109:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF2771:
+	.string	"gyroSamplingInverval"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF2227:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2763:
+	.string	"performAcclerationCalibration"
+.LASF2165:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF846:
+	.string	"__DECL_SIMD_powf "
+.LASF1243:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1515:
+	.string	"_T_WCHAR "
+.LASF2354:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF2189:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF2424:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF2026:
+	.string	"BITS_DLPF_CFG_256HZ 0x00"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2177:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1376:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF2327:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1840:
+	.string	"LSM303DLHC_I2C I2C1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1498:
+	.string	"_STDDEF_H_ "
+.LASF2073:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1094:
+	.string	"__DECL_SIMD_atan"
+.LASF1944:
+	.string	"LSM303DLHC_IT2_CLICK ((uint8_t)0x80)"
+.LASF875:
+	.string	"__DECL_SIMD_asin "
+.LASF2440:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2194:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1065:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1274:
+	.string	"__MATHCALL"
+.LASF969:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF2047:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2318:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1388:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2661:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1576:
+	.string	"USE_DASHBOARD"
+.LASF1673:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1865:
+	.string	"LSM303DLHC_INT1_DURATION_A 0x33"
+.LASF2127:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2403:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2528:
+	.string	"CW0_DEG_FLIP"
+.LASF1266:
+	.string	"_Mdouble_ _Float32x"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1338:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1448:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1335:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF2619:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF1022:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1494:
+	.string	"VTX_CONTROL "
+.LASF995:
+	.string	"__DECL_SIMD_atanh "
+.LASF808:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2329:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2622:
+	.string	"OWNER_TRANSPONDER"
+.LASF1669:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2019:
+	.string	"MPU6500_BIT_BYPASS_EN (1 << 1)"
+.LASF1225:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1790:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1823:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF907:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2315:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF2716:
+	.string	"accSmooth"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1890:
+	.string	"LSM303DLHC_TEMP_OUT_L_M 0x32"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2180:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2093:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF2356:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2171:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1505:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1173:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF2573:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1734:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF1162:
+	.string	"__DECL_SIMD_asinh"
+.LASF1799:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF1122:
+	.string	"__DECL_SIMD_sinh"
+.LASF1431:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF2736:
+	.string	"accelerationTrims"
+.LASF924:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2239:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF886:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF820:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2704:
+	.string	"ACC_MPU6000"
+.LASF2784:
+	.string	"retry"
+.LASF1871:
+	.string	"LSM303DLHC_CLICK_SOURCE_A 0x39"
+.LASF871:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1297:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1324:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF382:
+	.string	"unix 1"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2693:
+	.string	"SENSOR_MAG"
+.LASF1023:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1148:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF964:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF850:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1363:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF1855:
+	.string	"LSM303DLHC_OUT_X_H_A 0x29"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF816:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2509:
+	.string	"pgn_t"
+.LASF2025:
+	.string	"MPU6000_CONFIG 0x1A"
+.LASF2505:
+	.string	"DEBUG_GYRO_TO_MOTOR"
+.LASF1853:
+	.string	"LSM303DLHC_STATUS_REG_A 0x27"
+.LASF2311:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1175:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1650:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2423:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2745:
+	.string	"biquadFilterInitLPF"
+.LASF1996:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_4_7Ga 355"
+.LASF1769:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF872:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2672:
+	.string	"BEEPER_USB"
+.LASF1927:
+	.string	"LSM303DLHC_HPFCF_32 ((uint8_t)0x20)"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF2494:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF2666:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2546:
+	.string	"mpuConfiguration"
+.LASF2657:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF896:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF812:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF2024:
+	.string	"ICM20689_BIT_RESET (0x80)"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1112:
+	.string	"__DECL_SIMD_exp10f"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2317:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2719:
+	.string	"rollAndPitchTrims_s"
+.LASF2722:
+	.string	"rollAndPitchTrims_t"
+.LASF2721:
+	.string	"rollAndPitchTrims_u"
+.LASF1174:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1552:
+	.string	"USE_UART7 "
+.LASF2407:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1984:
+	.string	"LSM303DLHC_FS_8_1_GA ((uint8_t) 0xE0)"
+.LASF2390:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF2577:
+	.string	"resolution"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1595:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1259:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2091:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1652:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1999:
+	.string	"LSM303DLHC_CONTINUOS_CONVERSION ((uint8_t) 0x00)"
+.LASF2228:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF986:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1646:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1369:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1071:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF1883:
+	.string	"LSM303DLHC_OUT_Y_H_M 0x07"
+.LASF1410:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF2063:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF923:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF930:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1973:
+	.string	"LSM303DLHC_ODR_7_5_HZ ((uint8_t) 0x0C)"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2120:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF2008:
+	.string	"MPU3050_GYRO_OUT 0x1D"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1375:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF1608:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1034:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2580:
+	.string	"OWNER_FREE"
+.LASF905:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1604:
+	.string	"EEPROM_SIZE 32768"
+.LASF2164:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1784:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF919:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF2534:
+	.string	"csnPin"
+.LASF1451:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF2498:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF2105:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1616:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF2367:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2174:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1058:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1756:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1436:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF2124:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1357:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF2581:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1192:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2425:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1828:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1076:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1738:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1940:
+	.string	"LSM303DLHC_IT1_DRY1 ((uint8_t)0x10)"
+.LASF1967:
+	.string	"LSM303DLHC_INT1INTERRUPT_ENABLE ((uint8_t)0x80)"
+.LASF2288:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF853:
+	.string	"__DECL_SIMD_powf64x "
+.LASF803:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1945:
+	.string	"LSM303DLHC_IT2_INT1 ((uint8_t)0x40)"
+.LASF1767:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1764:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1621:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1590:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1926:
+	.string	"LSM303DLHC_HPFCF_16 ((uint8_t)0x10)"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF867:
+	.string	"__DECL_SIMD_atanl "
+.LASF1427:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1294:
+	.string	"_Marg_ _Float64"
+.LASF1046:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1928:
+	.string	"LSM303DLHC_HPFCF_64 ((uint8_t)0x30)"
+.LASF1807:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1282:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1506:
+	.string	"___int_ptrdiff_t_h "
+.LASF2703:
+	.string	"ACC_LSM303DLHC"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1745:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF998:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1021:
+	.string	"__DECL_SIMD_erff128 "
+.LASF904:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1852:
+	.string	"LSM303DLHC_REFERENCE_A 0x26"
+.LASF938:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2131:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1849:
+	.string	"LSM303DLHC_CTRL_REG4_A 0x23"
+.LASF2453:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF2002:
+	.string	"LSM303DLHC_TEMPSENSOR_ENABLE ((uint8_t) 0x80)"
+.LASF2568:
+	.string	"ICM_20608_SPI"
+.LASF859:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1356:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1302:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1360:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF2557:
+	.string	"gyroReadXRegister"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF847:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2184:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2698:
+	.string	"ACC_NONE"
+.LASF1287:
+	.string	"_Marg_ long double"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF824:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1385:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF2637:
+	.string	"FEATURE_3D"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1523:
+	.string	"__INT_WCHAR_T_H "
+.LASF2447:
+	.string	"BEEP_ON do {} while(0)"
+.LASF1656:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2604:
+	.string	"OWNER_SDCARD_CS"
+.LASF1262:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1808:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF2502:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF2264:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1377:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1623:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2123:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1766:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF2746:
+	.string	"gyroMpuDetectionResult"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1809:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF377:
+	.string	"__linux 1"
+.LASF2690:
+	.string	"SENSOR_GYRO"
+.LASF1269:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1463:
+	.string	"SERIAL_RX "
+.LASF1977:
+	.string	"LSM303DLHC_ODR_220_HZ ((uint8_t) 0x1C)"
+.LASF1810:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF2072:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2700:
+	.string	"ACC_MPU6050"
+.LASF2103:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1546:
+	.string	"USE_UART1 "
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1942:
+	.string	"LSM303DLHC_IT1_WTM ((uint8_t)0x04)"
+.LASF1811:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF2410:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2018:
+	.string	"MPU6500_BIT_RESERVED (1 << 0)"
+.LASF1783:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF2296:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1909:
+	.string	"LSM303DLHC_HR_ENABLE ((uint8_t)0x08)"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2205:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2564:
+	.string	"MPU_65xx_SPI"
+.LASF1819:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF1910:
+	.string	"LSM303DLHC_HR_DISABLE ((uint8_t)0x00)"
+.LASF1775:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1837:
+	.string	"LSM303DLHC_FAIL ((uint32_t) 0)"
+.LASF2161:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1457:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF1016:
+	.string	"__DECL_SIMD_erff "
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1789:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1327:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1290:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF1716:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1352:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2576:
+	.string	"sensor"
+.LASF2307:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1403:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2188:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1554:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF798:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2465:
+	.string	"long unsigned int"
+.LASF2065:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2621:
+	.string	"OWNER_LED_STRIP"
+.LASF2324:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1547:
+	.string	"USE_UART2 "
+.LASF1493:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1496:
+	.string	"VTX_TRAMP "
+.LASF2575:
+	.string	"mpuDetectionResult_s"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2197:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1605:
+	.string	"__disable_irq() "
+.LASF2445:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF1154:
+	.string	"__DECL_SIMD_erf"
+.LASF955:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2236:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1326:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1407:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1579:
+	.string	"VTX_CONTROL"
+.LASF1629:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF817:
+	.string	"__DECL_SIMD_sincosl "
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2277:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2432:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1754:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF2681:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1995:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_4Ga 400"
+.LASF1359:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF2469:
+	.string	"short int"
+.LASF1413:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF2774:
+	.string	"accHardware"
+.LASF1098:
+	.string	"__DECL_SIMD_asin"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1782:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2216:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2237:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF2095:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF897:
+	.string	"__DECL_SIMD_exp2l "
+.LASF834:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1362:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1548:
+	.string	"USE_UART3 "
+.LASF1242:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF2312:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1698:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1812:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1895:
+	.string	"LSM303DLHC_ODR_1_HZ ((uint8_t)0x10)"
+.LASF2735:
+	.string	"calibratingA"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2572:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1132:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF2775:
+	.string	"pgResetFn_accelerometerConfig"
+.LASF1086:
+	.string	"__DECL_SIMD_pow"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1750:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF2608:
+	.string	"OWNER_BARO_CS"
+.LASF2659:
+	.string	"BEEPER_ARMING"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1699:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1300:
+	.string	"_Mret_ _Float32x"
+.LASF1706:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF2154:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2166:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2609:
+	.string	"OWNER_MPU_CS"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF1416:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF2464:
+	.string	"unsigned int"
+.LASF2677:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1549:
+	.string	"USE_UART4 "
+.LASF889:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1054:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2244:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1317:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF2067:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2048:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1774:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1816:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF956:
+	.string	"__DECL_SIMD_atan2f "
+.LASF815:
+	.string	"__DECL_SIMD_sincos "
+.LASF1680:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF2374:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2029:
+	.string	"BITS_DLPF_CFG_42HZ 0x03"
+.LASF1082:
+	.string	"__DECL_SIMD_exp"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1714:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1366:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF2586:
+	.string	"OWNER_ADC"
+.LASF908:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2544:
+	.string	"accAlign"
+.LASF806:
+	.string	"__DECL_SIMD_sinf "
+.LASF2521:
+	.string	"pgRegistry_t"
+.LASF958:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF841:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2697:
+	.string	"ACC_DEFAULT"
+.LASF2396:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2444:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1379:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF2413:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2342:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1550:
+	.string	"USE_UART5 "
+.LASF2359:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1659:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1911:
+	.string	"LSM303DLHC_FULLSCALE_2G ((uint8_t)0x00)"
+.LASF1120:
+	.string	"__DECL_SIMD_expm1f"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF1896:
+	.string	"LSM303DLHC_ODR_10_HZ ((uint8_t)0x20)"
+.LASF1885:
+	.string	"LSM303DLHC_SR_REG_M 0x09"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1573:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2589:
+	.string	"OWNER_ADC_EXT"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2414:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1705:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2152:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2412:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2156:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF2526:
+	.string	"CW180_DEG"
+.LASF1844:
+	.string	"LSM303DLHC_I2C_INT1_PIN PE4"
+.LASF1182:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2610:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2400:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1640:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2756:
+	.string	"accelerationTrimsToUse"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1340:
+	.string	"M_E 2.7182818284590452354"
+.LASF2044:
+	.string	"IOCFG_IPU 0"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1850:
+	.string	"LSM303DLHC_CTRL_REG5_A 0x24"
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1418:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2416:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1551:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2411:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2206:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2882:
+	.string	"rx_pwm.h"
+.LASF2866:
+	.string	"accgyro_l3gd20.h"
+.LASF2846:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2799:
+	.string	"/usr/include"
+.LASF2852:
+	.string	"mathcalls-helper-functions.h"
+.LASF2848:
+	.string	"floatn-common.h"
+.LASF2828:
+	.string	"stdint.h"
+.LASF2785:
+	.string	"src/main/build"
+.LASF2796:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2827:
+	.string	"stdbool.h"
+.LASF2875:
+	.string	"accgyro_spi_mpu6500.h"
+.LASF2854:
+	.string	"iscanonical.h"
+.LASF2864:
+	.string	"accgyro_bma280.h"
+.LASF2832:
+	.string	"wordsize.h"
+.LASF2792:
+	.string	"src/main/target/SITL"
+.LASF2891:
+	.string	"time.h"
+.LASF2889:
+	.string	"sound_beeper.h"
+.LASF2858:
+	.string	"common_post.h"
+.LASF2795:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2829:
+	.string	"libc-header-start.h"
+.LASF2855:
+	.string	"platform.h"
+.LASF2800:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2807:
+	.string	"filter.h"
+.LASF2813:
+	.string	"resource.h"
+.LASF2819:
+	.string	"boardalignment.h"
+.LASF0:
+	.string	"./src/main/sensors/acceleration.c"
+.LASF2805:
+	.string	"debug.h"
+.LASF2826:
+	.string	"stdc-predef.h"
+.LASF2811:
+	.string	"accgyro.h"
+.LASF2844:
+	.string	"math.h"
+.LASF2876:
+	.string	"accgyro_spi_mpu9250.h"
+.LASF2862:
+	.string	"exti.h"
+.LASF2874:
+	.string	"accgyro_spi_mpu6000.h"
+.LASF2830:
+	.string	"features.h"
+.LASF2871:
+	.string	"accgyro_mpu6500.h"
+.LASF2790:
+	.string	"src/main/io"
+.LASF2845:
+	.string	"math-vector.h"
+.LASF2787:
+	.string	"src/main/config"
+.LASF2831:
+	.string	"features-time64.h"
+.LASF2843:
+	.string	"strings.h"
+.LASF2873:
+	.string	"accgyro_spi_icm20689.h"
+.LASF2815:
+	.string	"beeper.h"
+.LASF2824:
+	.string	"runtime_config.h"
+.LASF2814:
+	.string	"config.h"
+.LASF2850:
+	.string	"fp-logb.h"
+.LASF2822:
+	.string	"gyro.h"
+.LASF2839:
+	.string	"time64.h"
+.LASF2823:
+	.string	"string.h"
+.LASF2857:
+	.string	"target.h"
+.LASF2886:
+	.string	"io_def.h"
+.LASF2877:
+	.string	"bus_spi.h"
+.LASF2860:
+	.string	"parameter_group_ids.h"
+.LASF2840:
+	.string	"wchar.h"
+.LASF2833:
+	.string	"timesize.h"
+.LASF2786:
+	.string	"src/main/common"
+.LASF2798:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2878:
+	.string	"rcc_types.h"
+.LASF2818:
+	.string	"acceleration.c"
+.LASF2868:
+	.string	"accgyro_mma845x.h"
+.LASF2817:
+	.string	"acceleration.h"
+.LASF2804:
+	.string	"stddef.h"
+.LASF2851:
+	.string	"fp-fast.h"
+.LASF2789:
+	.string	"src/main/fc"
+.LASF2847:
+	.string	"floatn.h"
+.LASF2856:
+	.string	"common.h"
+.LASF2837:
+	.string	"stubs-64.h"
+.LASF2836:
+	.string	"stubs.h"
+.LASF2808:
+	.string	"parameter_group.h"
+.LASF2861:
+	.string	"config_reset.h"
+.LASF2888:
+	.string	"io_def_generated.h"
+.LASF2820:
+	.string	"feature.h"
+.LASF2881:
+	.string	"flash.h"
+.LASF2816:
+	.string	"sensors.h"
+.LASF2890:
+	.string	"vcd.h"
+.LASF2812:
+	.string	"accgyro_mpu.h"
+.LASF2865:
+	.string	"accgyro_l3g4200d.h"
+.LASF2885:
+	.string	"io.h"
+.LASF2803:
+	.string	"stdint-uintn.h"
+.LASF2825:
+	.string	"accgyro_fake.h"
+.LASF2880:
+	.string	"adc.h"
+.LASF2835:
+	.string	"long-double.h"
+.LASF2834:
+	.string	"cdefs.h"
+.LASF2849:
+	.string	"flt-eval-method.h"
+.LASF2821:
+	.string	"mathcalls.h"
+.LASF2838:
+	.string	"typesizes.h"
+.LASF2863:
+	.string	"accgyro_adxl345.h"
+.LASF2810:
+	.string	"sensor.h"
+.LASF2841:
+	.string	"locale_t.h"
+.LASF2793:
+	.string	"src/main/target"
+.LASF2872:
+	.string	"accgyro_spi_bmi160.h"
+.LASF2806:
+	.string	"axis.h"
+.LASF2879:
+	.string	"system.h"
+.LASF2788:
+	.string	"src/main/drivers"
+.LASF2884:
+	.string	"serial.h"
+.LASF2870:
+	.string	"accgyro_mpu6050.h"
+.LASF2887:
+	.string	"utils.h"
+.LASF2859:
+	.string	"build_config.h"
+.LASF2869:
+	.string	"accgyro_mpu3050.h"
+.LASF2791:
+	.string	"src/main/sensors"
+.LASF2802:
+	.string	"stdint-intn.h"
+.LASF2867:
+	.string	"accgyro_lsm303dlhc.h"
+.LASF2853:
+	.string	"mathcalls-narrow.h"
+.LASF2842:
+	.string	"__locale_t.h"
+.LASF2801:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2794:
+	.string	"src/main"
+.LASF2883:
+	.string	"sdcard.h"
+.LASF2809:
+	.string	"io_types.h"
+.LASF2797:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375 \nQ"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020"
+	.string	"\037"
+	.text
+	.section	.gnu.lto_.icf.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\272\001\035\f"
+	.string	"\226\220@= \345*\215\001\307'\026\007\235$8\255\367\020f\210\322\020qV\273\355\020\200A\327\202\306-\214\177\254\001\b\002 "
+	.string	" \001 \001\320R\t6\331\266\255\356\333yt\362\375\t!D\222\264I."
+	.string	"0"
+	.string	"1"
+	.string	"\t\245\302B,D\f\267\266&n\025 I\333\305rt\334\251\270xx\270\340O\247\247F\021\326\305\214~\323\277\277w\224\227K\355C}w\004\227\357\232S\235\227\005\206+\004\372xvs\317f\347\235\363\2516\225\\"
+	.string	"ss\371%"
+	.string	"\211\227\rN\025\037\316\363\226\241+\030\234\212\324\324kf2\213\336\003\346\324V\253\006C\2056?\3445\340\034N\233\223\344Df\312\264\364\\\272\322\370\270\353b\245\214\220@^\006me\004\032d\376\231|'/\003_\245\320`\321\035h@JL8\fF8?\"\n\366\323\207\260\235lF0D\317\246\032\230\\1\304x\bx.7mz/M\232\364>Z\024; \240\0022\032\362$\251\022H,\347J\221\314BV\301'\241\210\3271\3235\217\026u%\360\3258\200\306"
+	.ascii	"Syk\001\013@\362\336\255\313\3411\025ul\273\267\306+lN\363\210"
+	.ascii	"\204b\256W?\304\306\036F\\\360\177 \373\205\031d\301\247\034"
+	.ascii	"<`\330\324Bfg:\013\203\t\3305\0050\030\270\215\244\017(\304\272"
+	.ascii	"\233Z\216\273\314\261\263\370(l\217@\200)\002\006\213M\345\376"
+	.ascii	"\331\025e\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375 \325u\003"
+	.string	"B\004\r\026\260i8\f\303`M\222$\201$[3\262\020\314\3564\266\345N)\217\2437\223\331e\267br\311\"{l\354\026\n\372M\007.'\266v\n\013\354\357`\024\027"
+	.ascii	"1SD\317AR\007\370\303\024\235a\204*\340\325a\242,Nj\f\252\212"
+	.ascii	"\333\274\0053\001\032<a\351Le\237f\001\254\f\214\315l\221\345"
+	.ascii	"9\025l/\326m\240\r"
+	.text
+	.section	.gnu.lto_.inline.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\t\003}\017"
+	.string	"\026UL? S4\214\001c\2508a\"\357\fJr\017HL\304\303\033L\031\254\355$9\261s\303\312W\214\017\300"
+	.string	"\220m63\0174UO\207@\024\f#v\272),\241\252\232\272\375\346n[J\231\002>"
+	.string	":"
+	.string	"5"
+	.string	"'4\344\360ay\222VP\225\340\200\026\2561w\022\317\221\244/Z\2140q\215/\313\006\223\f2\260/\345\005\f0:0(\245\207\t#4\022\214yV>D\311G.Y\354\356\365\231\365$?rl\3474\243T\355\256\207\362k\211\236\212\024#\250\245\004\223\354\201\253\023\\pi\031a\220\225\244;v\027\301\230\205\220\273\273)\322"
+	.string	"\003H\f;\255\255\323A\336\b\361V`\373\200\267N/\371)[\300[\207[\367\027}\353\360\361\242\031B\265\342\321 _M\371\201\004\225\332\305\232\307Xo\235>f\326\277\002\334\\kA\203\036\350\367}\001\377[\220\303\022\307\307@\206r\032\251\215\020\017Ev\001O^!]{\314,\221\202\330]N\f\022T\367\271\363F\204S\022)\021\n\225O\307\252\344\200)E\314(\3618\023PN\310\332(\026Y\250\001E\211\204\002\222\231 m\261\001\220\002!\251*\017\022@4M\210\264h\212h\\\377w\030\334\026\263\013\271\f\360\246\217\375\277*\277\361\374\272\306o\233\234i\220\f&\026[\020KO(\201w\017\317\246\025`.\371\372|\366\210i"
+	.ascii	"\300\234\307#\242\323\312\220\256\265|\377C\267E\003\322\361"
+	.ascii	"\221\355\214Vs\370@\3455\254E\207X\2014z\264<\324\220\231\224"
+	.ascii	"\361\205\314^\233\370$z\325\"\245\271\355C\r2j`\332\035\204/"
+	.ascii	"\305L\310\256w\242\337\363p\337\200 \f\253\200\n\301!\315\356"
+	.ascii	"z,\217\265IC\235\373\227\373\373W\201\327\320\242\352\314\203"
+	.ascii	"\203\001pZ\316#\315U\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`I\001-\b"
+	.string	"\342\214&*\200)I\007=BV0*\200\375\360&2\"\274\273\022\024E\271\300\313E\344p\232\026E_\374#\306E\0011\350\366\233\310$\003d\323C\277`\fs\212\002\231\320,\344d23\254\344\r\227)2\022b\034b\275\226\336G`\350=z\216\357\001i@\026(\004\344@U\225?\357<\306Eq\316U0\202\252\224\266\377`\356\226\330K\254S\242\023\237\205}j\372\344]\234\363\300\b*\035\317\363<W\342\265\022iK@{\004\001\310+5\2564\033CXkTf\017=\005X\207- `\2421\350\356\305\304ta\300\001\001U\031\234)\200\356b|\032\207\036\306\326\345\n\237\0041\250Y\254\tx\211\212\271\005\272\017\203\262\260\035\006\215\007\376[1\315\231\302\t\311\361\330X3\320]@\276\202\325E\220Gb\341\335n\347\006\332\017H\320M\032z\324"
+	.ascii	"\266I\257o\340\333!\354\316=\264v\223NkR+n"
+	.text
+	.section	.gnu.lto_.pureconst.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\232\004\001\232\004\006\232\004\016\230\004\020\230\004\024"
+	.ascii	"\231\004\027\230\004\030\232\004\031\232\004\032\232\004\033"
+	.ascii	"\232\004\034\231\004\035\230\004\036\204\004\037\230\004 \230"
+	.ascii	"\004!\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\243\001\275\t"
+	.string	"\222N)+pk2\034\374\252\252\212\216\240\376\177\237\253P@\375U\254\177G\244o6\371\345\327&D\261:\3734\224\270\"\365 $M\232L)j020\221\243\005\225Zl\247\211*D\317Z\025s\212\371\2044\327l5\363\31463\307l1s$S\251m.\333I\202\"\034\250\224\301Z\340x\254\213\216\217\2658\326R\302-\233\230@\375\002q\332z\304\2429\004D\005t"
+	.string	"\335\262\265\314%\333\207"
+	.string	"\025\372Q\005\255\303\274\262\255\034\321\237\3553\247y\303\226aN\231\263\020D\331\2337\272+mJ{c\007|t\032\001@\250\241-c\210DDR\324\254\001@\002B\030d\346\001\021@94\252h\232}\003\303\212\307h\016\235\031\304"
+	.ascii	"\212\314\340Cx\241\272\267\356^\247C\317\272J\025\217\253\240"
+	.ascii	"r\264\352\352\302gP\200#HdC\351\205\377L\"\024\3409t\362\"\321"
+	.ascii	"\336\261\344\316\026r\350\001\275g\321u\212\013\366\221\304O"
+	.ascii	"J\t]\376[W\263\251\376L\302\007Z\340\341Tk*3\2170|\370v\324n"
+	.ascii	"\355\001\201;U7\342\017\211\3343%|\243\316\366, \n"
+	.text
+	.section	.gnu.lto_.lto.3b86eaa5fb569c50,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_accelerometerConfig_Registry.43.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375 \214\035\004"
+	.string	"T\007P"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	"\005\001\212\001\202\200\200\374\342\303\326\341\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\314\006us"
+	.string	"\005\001\006'\001\024#(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/sensors/acceleration.c"
+	.string	"\004"
+	.ascii	"K\205H\271)E\2217\200\""
+	.text
+	.section	.gnu.lto_resetRollAndPitchTrims.44.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"U\n"
+	.string	"\226\023I? \3458\035"
+	.string	"\307\236\t0$\003/~\300\"\326\315\037\354\017"
+	.string	"\002eQV\002\030\250\236\001\355\353\017g\034\303\253=\223\2122\315(\023\204\347R\002\025\321\270\250\245\207\023C\367\361\336\366\367N)3"
+	.string	"4"
+	.string	"9"
+	.string	"\235s>o\320\235\353\274\240;g\323\276\371\351\332\313^$0\002v\327\253(7OM\377\261\023\254X\251\323\201\211\3355]\261L\356z\333\r\2663\354w\002\365\304>gw\327\265e\037\366S\256#0\223@\333-\271\025\330\032'\363\262}\373\247i{\354\005\225\212\323\307\374\225\263\230\207\241\376\331m\331\304\354\236\016~\b\347\236\263\265ea\253\251\252\210\353\310\200\277\334\3468m\346#tvyY\207E\266\307]>,j\001\t\2415)\347|TwN\301\025@Eo\2463"
+	.string	"4Km\366\231\242\001\206 E|\022\241\220\btP\232B\022C\343;\205\027$\221\242T\032\311\217?\2208\206\247\021\t\226\300\357\033y%9\226\"Xzb82y\037Yz \006\217\033 \351\235\306\221\364<\001\r"
+	.ascii	"BQ\022gX\223\270\360\370\005\231\3412\310\330\251iQ\245,\306"
+	.ascii	"\364\253g\007\3502\021\334\271E;\237"
+	.text
+	.section	.gnu.lto_accResetRollAndPitchTrims.45.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`%\001e\r"
+	.string	"\306\330ZC\020S\2341\200\344\254\333\2003\274jcT\203n\310\b\226?*\023\300\216\276\007l\034F\355\360\374\336nw\376\271\206;R\365I{\227\2108#0\364\b\0378\354&\200E\212JN\330\265\366\247\330-S\nA"
+	.string	"J"
+	.string	"G"
+	.string	"@\2545\031\274\272\001\346\325\346\005`\257\230\007\300^}\023\222\235\275>\363h\377\270\251\262\277\253\020(C\254\265\332\265\342\343\351\350\277\344\231\362\004\342\364\342\261\326\232\226\247\022\367u\333\nlc\260\237\"G@R\025\323\023\265\303R\025\333,\321K\205}\213\275R\266\345bBG\201\323\332\021+El\253\342 \361M~Iw\341\237X\350\221\275\332\036o\212\236\222\b\nw\265\340\365@\013\t\224\236\345\277\370\212tS\304HdP\\\222\250\326e\"B\343\277\326\360\0336j`|\002\330\257E\237\361\271\363k\016\227\021\272\003\3431D\354\325\200J\bIW\374{MJ\220\237<3\345\340\361S\244/}\224\247t\360Y\274\332\303\007\372\362u\344\366\201\275\236\025v"
+	.string	"z\260A\340p:\233\001\241\250\003/d\330F]\005\220\027!\024\372@"
+	.string	"\3366\336\327\215> \027\342\266\355\243\205\340\027z\\\250y\335G\244m`\250m\022\370\333\300\201\332\350\373@-3\311[\354\225\232p\242E^%\373\254\277\344\2323\030"
+	.ascii	"BQ\022gX\177\322\302\350H\202\354\203\263\303\210\200\b(\216"
+	.ascii	"*\311l\025\221\267\300\005\002\202\257n\017U\r\272\220#\032c"
+	.ascii	"?\246[4\236c[@\"\006\312\340\2451p./\204I\006"
+	.text
+	.section	.gnu.lto_accResetFlightDynamicsTrims.47.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`n\001\345\r"
+	.string	"\346\330[E\020q\233\016@q\256x\372"
+	.string	"[R\262\375^\210\337\221(\314\353\037\b\034\341}\027Xp\"\230\302\202l\256\333\3263A\254\366\3255\235b\024\001\244\021"
+	.string	"\225\020p\370\324\345}\230g^\024\236\314\376\367\332\266S\nA"
+	.string	"J"
+	.string	"J"
+	.string	".:vG\005\247^\2609\365\370"
+	.string	"\326\351\346"
+	.string	"\254S\277$\262\257\323_\376\354\324G\322\236|\321\320\302cw\261j\304\277\317\317\277xNx\222\341S3\262\273\236\341\t\312]\3356\002\333$\366S\0017\335"
+	.string	"8a<K\021\265\023\306\036G\263\022a?\263\225\212M5+5<7v;\304\364\330\023\215Q\302/\235\024}\305g!I]\247\266\277\217\336\310h\303\003\362%\301i\001\024\2219o\362O\034\205\350\243gy\340\244\204\b&Z\374\244%\034\306\013\027\036\034\263LAU\353\244K\356R\005\220\256p\026\335\007iwCT|\205g\235zH;\300\031\343\223\357\224 Pg\3719\224\037l\274\364\346C\277\345),\370$N}\001\303|x\332\271sX\247\001f\020\241\201&\002\002\022\362\031P\271\r\202\246e\032k\237P\005\231d\3346a\323\264\f\353\270\332\205\266\016\013\201\262\022L\343:\354s\300\225\302\306a&\265r\3305\202\317l\245\342\240t\002\253\221}\323/\276S\212'\020t\0323d\020\b\036"
+	.ascii	"\270S\340\fkyZ\3701\025\001\024\016p\002\216\003\311\210x\342"
+	.ascii	"a0\006\034\203C\024!\361\022\202ha \230I\372\017\206 `x\2118"
+	.ascii	"T\335\355\232\210h\342\376\304k1b\216\003\004\331\031(\203\227"
+	.ascii	"\306\300\271\274\020&\031"
+	.text
+	.section	.gnu.lto_pgResetFn_accelerometerConfig.48.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\271\001\305\017"
+	.string	"\246\333gG\340rj:\002\217\272\273p\326\346\017\b\371\250C\274\200\021\320\fN\304*H\251\350\214\303b\226\314*R\b,\315\r\376\213\231\2048\314$sL\254\365\241\241\366\022CX_\341;S\342\027\235\312$\224\276?\027\265\235RK"
+	.string	"T"
+	.string	"Y"
+	.string	"\037\261\007\360\b\235\332w\235\005\3520*'\331m\335d\273g\002/\360^}>@\367\352\035@\367j\224\275\343g\212\375\253\266\022#\310\356~\034\212\243NQ\376[\274\263j\001q\3129\331]\323U\213\313\315\335\266\001\333$\233z\002!6/\206\310\\\n\b\244\350\315\024F\303\255\334\020\371\201\316\356p\030\036\fz-\251\001I\361R\017|\027\037RhM\205\257\322\275\226\350\260\245h\215)\314F\216\2457\373TQ\356\204\375\315\356\256\271\226}\230\237V\216\017\034\036\231]V\215\220\245\325\331\213\355\260\0365ff#\227\220\b\375L\370\331\250c\351\2240\021\013e\243\f\227\021)\260h#\216\355\024FC\223\361X\314\351D%B\302\253f\333=\021xV\204*}\254\364\230S\307\322\031\361z\261\275\332\202\367\372\3634N+\233\374\f\016\336\356\202^=\201\345\"\341\262\351\323\003d\031b"
+	.ascii	"A\021\307,\211\345\005\r\240I\254\2002B \221\310\222\304\fP\032"
+	.ascii	"\200\016LL@\037\001!8\212L\346(z\006?#)\232DeH\nAP\364\231%i"
+	.ascii	"\216\241\371\215\242\250\364\201\245\371}\n\230\334\020\226\237"
+	.ascii	"\211$\313o\344L}\263\\\313\021~\320R\234\3524& \260\002\232\232"
+	.ascii	"\352\001\311\027(g\355'\213\361\032\272\b\274\033\353\266\031"
+	.ascii	"n\315c\306V\313\037S\344v8\310&\007\372\322\306\004\027$0\031"
+	.ascii	"\345EO?\327>\n\355\243\306\3342\"\0016\337%;S\033\311\204\304"
+	.ascii	"\307\032\320|\247\266#\226\241\2779\032zy\321z2"
+	.text
+	.section	.gnu.lto_accDetect.49.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\255\004\325\037"
+	.string	"F;\315H\240\330Qc\204\205s\3141\322mx\304\026\366\030\377\301\254e\325}C\0221\271\341\001wd{\375\235\341\351l^*\256\213\250\005\035AJ^\311/\360\016?\270^\b\250U\321I\345\333\313\321\203\316\037[\267\335{K\231R\272"
+	.string	"\253"
+	.string	"\270"
+	.ascii	"~z\"B/\372<"
+	.string	"\273WF\025\013\350M\233\262\246\307\255\326\017\361\203\\\210\320\247\202.\340^\247\037\307{S\006v\200\336tz\232\363&\372\231\363f\316M\310CO\241\220>CLX\025voj\2634l\353\320k\264\031*;\315\322\326!\377\367\332\201K\247\2257F\274T\0359|Q\022\340\001\004\362\035\303\245:\263+\240\020E\311\322\221t\364;\206JUV\332\242Q\311\221C\027\245\004!>j\324\210\302z\002 \006K\233{\357\215\257G\304\023\325$\360\262\244A\302aD#\026\225\n\222\\Zh\304`\2654b\322\253l\347\336\353jDTq\303\3346\225\355\021v\351\023@\247\335\273\021 \364\336\253\343gq0\001\003u\343\246\037t\336\244\221\222\005X\307LSB^\343iF1\344\255b>\355\213\257\367\235;\300*\346\027\371\215\237\300%\265%\371\253^\354\364\367\362\332'\277\352 \233\330\260u\262g>\365\313"
+	.ascii	"x\361\217q\365\354V7\352j\331\213\367\351\352\322\325\266\372"
+	.ascii	"4_:\206]1\020\345^\244\261.\327\211\331\225\343V\267\177%\344"
+	.ascii	"W\335\350Z\215\326\315\276\321\312\207\376\206(\022*/\311{\323"
+	.ascii	"\0057\255Co\326(\271\375\307_e[\350E\f\366\004G\311{\357\315"
+	.ascii	"Mw@k\210\334l=Uey\224\344\245\365`m\265\245-\217\b\225\210\352"
+	.ascii	"\330i\255=\255\b\277\256\216\332j\253\025a\027Q\0353[$Q\373\""
+	.ascii	"\032T2H\330M\357\315\317\241\363\226GE%X\271xVe\254\275"
+	.string	"#Qot\033\241)h\177\036\360\205LJ\206a!\246CC\240d/%1\334\340D\203T\206\213\341\030\206\005&K\007\362n]\340J\036\212K\362h\332'\333?r\357\3746\252hdR\332'\013XX\302-\364\307\273\2541\366\264G\366\275\376e\260\252\265\244\006\270\357<\372\\\006C\357\375\035\206MW\243[\204$u$\266\301~\030\266m\260jt\357im\202\365\213k\026\223\0375\037\357G\3073u=\f\273\013:\036\316\004\017\017W!\227\303\311\370\001\317-\007!'G\007\247@\t\035\217u\016\307g\327\363\203\343\351B\350r9\234\255\307\333\365|t=\233O\017N\204-\307\353\331p\016x7B\307\263\375\354v<[-\275Q/i2{\343)L\3312n\315\236\344\263\231\365\016\320\022\325b\252\375\241\247\336Hf\255\3759\306WQ\004\233j\025\263\2145\b\007U\024\301\364\336\333\340\306\357"
+	.string	"\021h\3058\322d\277\272\313\023\2653\366h\306z\240\232R\275\230t\220M\242f%\326\2652\f\343\305\342\305\0035\001\275\222,\026\223\323\0224\305\323\330\355\223*\305,\231}\362\215\237Aa1e\276\353\016[\250a\034K!\206\f\231\tf\242\232\031\245\003p\002\23122\017\020hi\222\2441R\357\237\316{v\300\0375i\202\264\356\215"
+	.ascii	"\020\256&G\224Q\374gk\b\363\317\210\301\274J\003^3\233,\004\212"
+	.ascii	"~\320\001\373S,od\352\n7\246\266\225\231\2647\275E\013azG\212"
+	.ascii	"\035\025\330\r\244\224\220-\212t\326\204\242OX\221\004\221\210"
+	.ascii	"\277d\210o\222\3150T\246NE\301\376]\241\212a\373\321\371|\327"
+	.ascii	"\311\347(Ca\026\3452K\275-8\374\\g \317\275\301k\273\374\235"
+	.ascii	"\017\200\233z=DP\375\244\316\nGr\370\225G\361\351\235[h*\200"
+	.ascii	"\345@\302\277L\002\346c\350]\227\207\315\356\317\2730\025"
+	.text
+	.section	.gnu.lto_accInit.50.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\262\002\355\024"
+	.string	"v\247\214I\260TN:X\352\305\2600p\236\247J\023k\266\033\314\305\023\235\346\027\246\2756\241\312\247\357\350\300%\001o\326\216<\374\202\025\225\375\373\267\215X\276\037JssO\373\335#\270\267-'\2463\232Z\355\300!\266O\b\3312\245r"
+	.string	"n"
+	.string	"\201"
+	.ascii	"LeV*\222\021\210\224\355\333?\221\354\026\273\200\031a\367C\377"
+	.ascii	"\306\253\220n\365\301\264Z[\310\330\252\365\244\361\202\331G"
+	.ascii	"\231\327\310\217\342a\310\217\266ms\203\344\362\347\023\323\241"
+	.ascii	"\216(a\221\325z\332\250S\271\345E\272\245\017@\370\2738k:\025"
+	.ascii	"gV|5\265\b\203b-\314E\223\017\277$\204I\273,9\265V\257)4q\217"
+	.ascii	"\267\375\3006\006\233\222\001\353c)\005p\313,`\355\033\216\372"
+	.ascii	"\260\b\322\237\227\253K\314eMv{\221\n\376\3639\202^\236j\005"
+	.ascii	"\336\364q\374\n\310\217\372h]\320\336\374\350\007\r\361\366\246"
+	.ascii	"eD\320\237?|\217\212\022S\242\324\255b\237\301\2450\354\323\340"
+	.ascii	"\023\253\021\246/\354[\3750^\323\274\236yM\262\254Gr-\216k*\256"
+	.ascii	"\227\256_\373\324I\006\205BV\255\0011\\\304~\b\204\271\224*g"
+	.ascii	"\354M\222\312\204\240?\213t\244\017\242t\305.i\334H95\2535\t"
+	.ascii	"\307\377:XY\243\264QR\225T\344G\221\336\214Y-\027X\221\016eU"
+	.ascii	"\202\r\345\360C\034t\t\021\261\f\254\rAgoRz\024^\\\036v\020"
+	.string	"<q\220\360\037\023\266\264\250\224\230\265+\360\354\315\245?AD\354=@\364\324\226\324Z\037\345\037Y8\017\237\027\373\302w\374\004x\252\265\342|\324\021f\240\341\006\327\300\306\006\247&F\350f\324\313\031\355v\200v:!\242\241\033\017\257w\0044\300\270\232\035OWt\353\345\204r8\334\315\346\353\361|\273\234\317\266\323\335\206l\270\236\317Vs\300<\242\\\317V\304\343\365l-'\360\"\245\321\017\2573\346$Kk\257\3443\272d{F\235\003\244A\221fa\250]:\225P{\223FE\372\333Z\353\217\272$I\232\341\212I\322R\361\314\216\364\347\223\224\001- \320\242\t\250\252\007\005\222D0\303A\326\233\330\214cW(Z\260@\013\033\302\225\204\256=\200a\272N\260u\237\262\033\013\313\324<\b\232\023\325b\307\261\254 V\276\357M\034\227\304\300?\263\371\225B\243\341s0\311\226$\376#\023[\241)"
+	.ascii	"\212\366\247\260\256\306Ei\261\347\362U4\215\300$\357\240\356"
+	.ascii	">\032C\336\003"
+	.text
+	.section	.gnu.lto_accSetCalibrationCycles.51.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"-\t"
+	.string	"\346QB90\221\322\001\200@\367H);\230R\230\264\301\344\027\350M\2750E\331\355\032\332\217\375\r\250\001#\257\001$i\247`\202`\222\036\"\314<\347\340\243Fo)\306\370\335\366N)."
+	.string	"1"
+	.string	"2"
+	.string	"\240\317x\002\320\247A\373\346a\311\376\005\305\303egw\251$9\370\b\372g\271@\313\265z\004\210\330]\307\226\013\344\226\267\255`\273\332\216\005\237\335]\313\227}\330\037?\00594\026\263\335\217Y\317\312\246L\212\355\207l\004\233\211\030\355\253|\005<L\345\271+\002\023\263\033.\230!\340s\340\242\036Eu\235GC\341\376\263\362\345\n\035\031Kv8J\277\3451\225\177b\216T|\353\323O\201>E&!\2548s\234\301\251\331\310c\207\253(G\354\007n(9T\b\022\351adP\332<nCc\243\3706SMI\\p&\255\036\270\216N\035\207\322\274\315\264\325\252\321\317\353\276\323\366\321\023\247a\320\352}t\224\340.c\013\t"
+	.string	"M\311Z"
+	.ascii	"\267\214=\343\26368\273\3432\264\265\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_isAccelerationCalibrationComplete.52.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"5\007"
+	.string	"\202\21635`m\322\001@ab\344\306\033\006p\210}vC\327'\\H\223\205C\024\2725t\354@\263\273q\\\007\204P\002"
+	.string	"\023L\340\331\376C_\002.\250\021\"eJ\001\266(\030\254X\252x-\\\226U\275,\302\f\273\262\207U*\206g\305\354Q\b\f\033\256\370,\020\306Gq{i\025\244:\260Q\216\375\313\344\252\372\216\210\223\235}\215o\\\374\013;`\362\333'\0373\371t\025\b\201\330dg*b\263\304\3464\251\022\366\245U\220\355\264f\372R\300\350C\001d\327\323\215\326c\022a\330\276\375\214\214M\371"
+	.string	"!c\355\\\205\347\026\241\016\007\311.\367\224\342\332S\363\037\2724\322!\262}4O\200\204\335un\237\207[o\273\300\266\201\355\211\007"
+	.ascii	"2\241U\037\370\003&@\327p\220!J\270\313\246v\222\001"
+	.text
+	.section	.gnu.lto_performAcclerationCalibration.55.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`#\b\005,"
+	.string	"\232K\200\020C`^N:\023\246\365\251\255\304\301\317N\322\345\344\234\321\3130\231\206@aB&\211\333\004\366\220\026c\261\261\232\217\374\232M\343\020\305dx\315@\2214\216*"
+	.string	"\232\325 \305\357\251\3247k\304nB\266L2\356"
+	.string	"\343"
+	.string	"\377"
+	.ascii	"\027\352(\263H\217>\235W\262hr\250}m\307\227\214&\022S\333\301"
+	.ascii	"\034\274\031\036_\362\321*\222\264/\367\336\340Qf\376\331y\305"
+	.ascii	"\2267\fC\\\033\250\243\005\260L\275\177\306cy\303\016g\311\335"
+	.ascii	"\230\273\243\3742<\230\203Gk\220\331i\311\324\233\371cN\346\370"
+	.ascii	"\262\036\001\220n\027\332\2176\367.\035p\204\364(/\317d\217\246"
+	.ascii	"W\262G\371\310\034\350\313\261\353\273\002\367\225vw\357\215"
+	.ascii	"\252U\270\376\\\236m\037\377K}\026=k\037\371fG\320\\K*\267\376"
+	.ascii	";\020%L\311\323s\202\217"
+	.string	"\273&\227\003Sr\026\345}\351\271\331\017p\001\023k\337\211t\357\025*\277N\b\035D\311\325\026\270\005\311\321#?O\006N\350\030\021*}\234Lx\244\374\t*\273\272\276\355\f\342\f%\225H\336>\r\367^\356\2442\354\f<3waf\027\314i\007dG\371F\261h\2176\315\331\t\231o\3105\346\217\263R\001\273\321:\325&Y\252\2405\273:\217\371n\356f\344\2231\f\253~\322\312\036u\252NM1d\357\361\331\034\310|\"w\327\374C\2220\311S\304|S\357\275[\225\241~\266g\200\202l=~\333\317.Q\206c\232\tF\356\266\036\363\222\253+\025\346\377\326)\314\300\346\005\304\227\375O\300f\247\263\235\207\300\346&`3S\332\274\364kV\0026\003\3705'\331f$\333|d\233\205i\263\221m.\262\315A\333\fL\233\177\276\346\3246\373l\263\265\315\250\257\371\264\315\3256\267m>\324"
+	.string	"-xZ\330\271\227\310\336\241{\007u\313r\266\243\315Gs6\314A\316\3615\\\337\354\262Lq\233\223\226)Ns5\307\263\361[\272\005\226\256\251\251Cwo\205\036\254E\204\016\254\301D\210\200{\277\252\227w\345\253\277z\306}%\272K+\230\255\276\352K\363\n\303u\346\374f\321j+\032\327\340vTi\035Z\211M7D\002\354\210\234I\177\243]Po\366\244\263\275\255\272<t\013\326\016d\036\221S{*\b\314\305\2533;\220\211\347\253T\370\327\007%\326\332\247\241>\254A\034|X\247\372tu\236^\325\200l\275\237\226X\317\366\247\006\037Vb=1\t\231\177\260\200>\030"
+	.string	"\361?!R?8F\0208Y\r{\2248f\207\374\334\2335H\230\350'M\330\243g%`E\254\016\352|\250\206c{\252\204cz\n\314\331\t\222\253U\216\312h\fOrP\327\327Z\273\315\313\tW\357\261\035\252\004s|\342u\252\206s\367^):\217K\261\242E\013{\264k\202&\034U*\347\325\310\212[\021sN\243\314,\342L\252\243\261{\257\005\376\333\343T\361\003ZV:\252N\246\360\242B\361\202\004\tR\017\002h\315\260\312*\021\243h\303J\304\213\253\r2d`e%q\361\301\025\226\225\215\252,\243\fc\261X\025\245\225\205\245ue\324\212\272\262\252\232\021U\314\322\212z\200\200\261h\030\263\242l`aeE\005\227\310\377\326)\254b\313\035d\345\342\246\272\244\356\355\335h\231jS}'a\252KM\261\206{\362\237\202f>z9\202\351'\371\211\253n\361"
+	.string	"\261\337\354\351\0367P\360\350\220^x\312\213i#ER\001\226L\203}`\251\233\341\243Y\023\331\300RG\271\207\034\313\246\370d=\354Q\002cvf\016T\253C;\212.txuO\365g\177B\302\035Y\252B:\310\031\227\034\244T\227\352\277\022\001\250IU\251\372\byi\341\320@\214_c\356\320?<<m\256\277"
+	.string	"\324\2575\313\220jR\365\021:\252H\302z\324\\\355\243\273\372\250\020Ni\344\240\267\372\026U\243\200\253\250Q(\t\225ChHF\202$-H\032\003\220\002\221\241\252\362\021p1Dd\244\005\312\316vB\221\035\263\325\220\347\2345\034\343\005Oj\260p\314\273\262\240\006D\311"
+	.ascii	"\2048\230 \033\254\270i2H\220b\271\344\350\270}\003n\336\373"
+	.ascii	"R\210,\204C\255\2279m2\326\005\203\325\334YtV\365\215$j\233P"
+	.ascii	"\0176\365f\201\305~+IO\313-\030\201\320~~\026Ml\370\241\356\230"
+	.ascii	"\"\026X}\026G\213n\007I\256\017\336m\364<\b\224\2208_\322J\320"
+	.ascii	"\334O\273\320|\346'\325*=\020\232\3650f\211~x{<\313\305\336\332"
+	.ascii	"^\213\272\201\0217h\2372\031~\264\375\354\203\332\3116\236\331"
+	.ascii	"+Eju\326 \304\211+!\241\357\206\2258\256L\236\b\006\245\320\\"
+	.ascii	"\036\204\025\2004\201J\251\276zt\1778-\327\301\252y9\027\r\205"
+	.ascii	"\023\356\245\201b\026I\001g\227\226f\342n2\213G\362\252\201&"
+	.ascii	"n\315\223\363\r]R\263\017.\264\201\026\247w\330GxL\023Y*\364"
+	.ascii	"z{0\276\304>\222|\364\n\\\372\342\031\324Z\223;\371x\r\n\352"
+	.ascii	"\363\006\027\222e-\t\267\005s\264\246r\351C\017\030\035P\244"
+	.ascii	"\370o\257\002\030\334,\276/\333O\303~V]\2330\222\375N\322\377"
+	.text
+	.section	.gnu.lto_performInflightAccelerationCalibration.56.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\325\r\035>"
+	.string	"jc\364\025?@\244N\007\263\323\026QR\301\032\024\221\367\\\207\331\n"
+	.string	"\234>\021B@&\203\202K\274\004\377\361\260:\032\377\232\\\302\n?\204\355\300\263X\310!:\3712\023"
+	.ascii	"\375\1777\262\367\336{\313\224RB\0015\001V\001\252\373\235\272"
+	.ascii	"\337\270\375~\366\333;L\020tk\313\302\004\003r\346!\207\214\262"
+	.ascii	"\036\025o\313\372\352\247\357NO\273\275\275\316\237\335\305\306"
+	.ascii	"\341h\332\3238\215\351\343\026\227s.\266\333\245\231\315\231"
+	.ascii	"\327,\374\335\305\rNiA\372\273\035\016g^s:K\006\343\006]m\257"
+	.ascii	"\303\321]t\325\235\256\213P{\220\020\264^w\352h3\027VM\2266\300"
+	.ascii	"\234\235\013\\\355\023\r\225\207\364\357\3668\227{}nG\223R\356"
+	.ascii	"Q\247\344.gg\203~\320\272\332NgZ]m]\300\352j\277\335\204\334"
+	.ascii	"\311\314l\226%ii\006s\316Y\270JcO\235\336\355\277\216td,\022"
+	.ascii	"\335\226]\325\244\024\377\333\316r\271K\"<\034\311\315\217R\005"
+	.ascii	"\200r\0229T\315-e\032\242e\331\344\215,W\224\2656/VEYc\342\304"
+	.ascii	"4\202\217\3016\207\2521I\215\213\322\372\270\027\265%\357\246"
+	.ascii	"JJR\0079g\037\337\262\\T\326\330\234M\342k\032\332\253\256d\363"
+	.ascii	"$\250Z[J\225sv:\257\362\242\346\344S#\216S\005nx\214 \021\351"
+	.ascii	"\2212\355\221\"\310\351\374\203\0209\373g\271r\316\375K\"k\336"
+	.ascii	"J\336\355S\335\275\242\373\310Cv\177~+\016\224<F\377\274\242"
+	.ascii	"\230\036\r\321f;\322A\036"
+	.string	"\374O\322\355\266\272?\270\037\257>o[\210\013\314\035\253\253+v\273\346\\\237\212\241{\274\317\375\362\274w\336\352\252\312\227b\276\275\006nG/\275\003\315_\330\030\347%\t\370\034\247c\242\035\213\253]C\304\373RD\3362P\371\207\f\\NR\213\231s\246\320M\302\357L\2649\347\25589\276\260\242X\310VW1\326j\342\265\277q8d(T\250X]}\214\365g\334\323\203\266\236\217!\\0~k\007[\035\263\250\373\353\361\213\272}\215\263\001k\307\322ab\357KW\333\305VW\035\037\233l\312?\354':sqOe\240Ls\234\204\201\371\013\273\235g\217\337\272\375s\316<\032O\351\356\3629\367\007\356\364\276r\277\255\214\337\007\330o\003\306\357\002\304\357*\3427\225\373}$~O\021\277\245\334\357\250\366\033\212\370\375D\374v*~7\261\337\004\330\357\001\3567\223\373\275\344~\013p\277\003\270\337"
+	.string	"\332o%\366;\251\375F\"~\037\021\277\215\304\357\"\361\233H\374v\331\357\326\375f\335\357\325\375\016\31593\0020\227-\237\005\213"
+	.string	"\270"
+	.string	"\330J\263\301W\241\022"
+	.string	"Oh\342\215\001\200\247$\255\242/%\305\327\221\331\350\241$\333\177\002"
+	.ascii	"Oh\342\271)A\201\201&x\243\277[\326\356\267\313\373\345}\331"
+	.ascii	"T=0\217\256\301\227]I\030\255h\215;\200\204\201ck\377\221G2\366"
+	.ascii	"\216y\341\336\227/\334\332\304Ip\310\032\242\203\255I\270\354"
+	.ascii	"\327\222\260U\223\215\217\t\324]\374\326"
+	.string	"n \266\013\253e\222:\b\322\351<-\214r\325\\\312/\364\264\355\302\356t*\345\027\266\273\216\365\nwaG\260\004Q{r\025\222\264\212~\020\026_\307\006L\301\007\202\204\217M\266#\013<\r)\305|4\rK\314\367q *\210\304W\344\b\237!\223\230\257\364e .\342#\374\203\320\334\316^|F^E_3~\250A*\332\310\r_\271\367LW\327\352\252\021_\375\341)\377\360\205\027\"\333EE\354\342\021\261#J3<|\314.\360\356\206\341\203H\246D\256H\203\215\r\357\313\r\253\253QQ\301+\354\342\317K3\\\332+t\245\032\275\037\253\267\361\026{\024\301\026#h\262!\355\021b\025\277\265\273\347\234s\022\236\322\201~\357\0204e\261!\300B\210:\370\240\244\333E\005\261\330\003fc7\300\322\226\320B+\254\002\004\b[XMf1\306\312F\270\b\2431\006\242\205\214.\0300\310\312"
+	.string	"t\030\226\f\2621\032`eb0\304\302\302\300\262\314\312\310\314d\210\231e\311\030\003\213\221\025Vf\226\205U\240\311f\210\225e\321 #+\313*:\225\216\247\364W\241\036%>Cr\360\335/\224W\312\031\346\321P\211\334\351\274\365\343\247F\b\210\321\b\241}\334\237\335\341\001\375i\005\235V\177\266\207\347\223\354-\177\366\207\207zuK1\005\375\351\304\347!h\032/\021\006\220\360\320\003\354vF\276CVX\217_\3372\360"
+	.string	"\266\302\236fh"
+	.string	"\027\300\007\260\332\b\215\313\331\037\276}\037\330\205\267\312\343y\233[|\006\360\205\346\\\025.\200\325FT\270\352\216\035*\277#\256\2237\205\217n\\\nO\315\301\223\352\203F\341\273\3441\016\207/\251'\034\205\323\2764\303\207\302RM6\bN\370\t\253yhe\332 [6N\030A\023O\254\357N\r\026S\220\357\016\03592\314#\374\366I\274)\315\225\027\256\t\033\377\330\236O\317H"
+	.string	"\327\341\303C\007[\007`\002\316\001x\352O\216\027\231\360\234\334\240\016o&\351\317h\031\257\fL8&\354\317?\271%<&\211\200\371bT?\017&\351O\346\177\361\302\020}/K\330\237\001\201*\250a4\b\025C4\"\"\242 IRH\007q\005\304\020h\231\231\007\021\3004\311\030#\032Q\352\0246\346BI\226L\205\344yD\240Q\261\214\242HF\311<\303Z\261\257?[3U\277\313>Gq\370\022\026kQ\314o\022\217\376|\rV\237\"+\355\021\375\355E\355\f\364\221\272\3710@\362\005\353\3028\373\233\352`a\232r"
+	.string	"wc\346^nV\376\275\232\024;\242\377\031r\220\\w\021\177q\337&\273`]8\304\351\214=\267\244\377;\034\350\273\255i\026\265@<\320\267?E\255\023+\364\"\317\311LUa|\234A\303\005\341\243Z\013\233@\363\316\3139 BQY\350\303\204#\370\255%\366\210&\250\0054A\007t\201\311\365\220\016!\002,N\256Ra\016h\302#I\332\n\031\261\352\355&\330\353\252\344\201-\276\265\312\021\325\337a"
+	.string	"\270g4e\362\350\221\371C\2261\215s\264r?Q\356\277\210f9S\234\312\3577\215\r\213\001\235\210e.5"
+	.string	"\213\207\003\231z{wN\321%\350\276C\271\202%\222\003\270\320\017\261\363\200r\377\250\304\233E\246 \326\267O\344\344\001\312\2031\020c\272Qh\351\372;L\224\371o\351y\226\250\3150^\371 \235=\304P\213\311[\335"
+	.string	"\036'6?\353\005\034\034R\242\342O,9\036\353'R\371\333\342\001\206\2709\202\314\367\335sJ\2230\330\377(\3769:\215\257B\033\250*+\246=\367\2271a\377\\\254(\034\316\300{\336}\272k\t\250ex\361\317L\202\326\247\373\001\222\025\275Di\321\307\013\315#\315\017\tM\353\361\r#\r\355\2431!\344\260\260c\034vv=\031\345\037\332\217Bf\263\357<\003\331\274k|\\\223\337s;U\311\334/\224\367\233\362)m\217\205\227\321A\322\235f\321\334-w\347\033\343]\013\324\332\rc\361\031\\\t[\233\b\344Q\311:7!%D\213\030!]\313J_\336\035\032\250S\232\345\320\204\243\223sN\235J\234\032"
+	.ascii	"\3109\204F\272]\316\350\021\312I\347\335\234 I\210iu\233\315"
+	.ascii	"oK\222c\350\316F\232\222\203\177"
+	.text
+	.section	.gnu.lto_accUpdate.58.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\017\0015\r"
+	.string	"f\231\\D"
+	.string	"\223\223\016\340\030yx\332\210\232\002\264\027\375w\f\244b\0060\222\237U\022!Dv\360\004hf-,WWK\342Q\027J\031\002\311;\307^:\313C\021\344W`\021\013\315Z\255@\240\020\233%\233H\231RG"
+	.string	"F"
+	.string	"J"
+	.string	"\016?\202=nN"
+	.string	"{4h\353x\370\262\207\301rZ\301\332\335LG\200\240\202\2774A\037$5\372\265i\271^\t<\314h\341\244J\327H\215\0209\276z\262\244L\231\232\223\335u\242R\035\356x\333(\266%\330\337\0022<6g\354\260\224*\302\376aX\0376X]\354\253~\215\2463\323\337\\\306\004k\007\206\326.\207\326\217\245\021e\224\260}\373!hsl\0033(\317\257\374\023G\001^\245\341!\273./b\354\206\n\274`\363\030\243\335]u\006,uB\f\016S\3720\200|x\027\\\200\227]\322Q-T\016\260\320\324\022\020&\035\331\256p\025 \021\273{\214\212"
+	.string	"\033\273k\002\363\024\237O\342\321\027V\362\250G\177\005{\274\212\334P\221\262\345\257\036\241\307\006f\220R\2425 !1\351\024\370@\234\007\201\202&\342\036\244\204\034|>\235\027b\255\023\3528\221\307\333>\233\246y\262\317\353\276\320\366e!\316\003\3124\357\313:\b\334Y\330\274L\324u^\306\tI\247\237\220\264t\272\006\244Fmm\313\243|i\023"
+	.ascii	"BQ\022e2\f\202d\023\341j BS\230P\267\302\274\221\205\210ib\200"
+	.ascii	"\340\200!l\205\353\345\322m\332\242\272L\004\356^K\32340\005"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_setAccelerationTrims.59.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\035\t"
+	.string	"\206\221A; \005)\035"
+	.string	"\254<\004|\265\371"
+	.string	"\034\003\361\001\223+g\305:\033\373\240\022\005\313m\303m2\367\021\270_e\220Kf\222"
+	.string	"\n\030@6\3059\003\220/\370\204F\356}\367\337;\245-"
+	.string	"0"
+	.string	"0"
+	.string	"2t\002\320\245={\347_\311^&\306\003\246gwg$\271w\350\371g\271\200\353\305:\f\230\330]C\327\013\344\216\267\315`\373\302\366K\2160\373\261\037~\024Pl8xv?f\001V&iNl_d'\340P\034\332W\371\212\367\330\352\003\2730\235\231\335\257\301\016\241K\177/"
+	.string	"=\242o\377\331\b\263E\212\254\025;\f\243\337r\227\225o\342\r\025\274\353\322W\201.\017rBZpfX#r\263\020\200\375\261`\034\261\377\331\335\r~\300\200\240\022\243Q\204F5\204\255\253\250\244\356d\342H\006\246\032\252\232R%n\313\330(-\315\216\253\035j\353&\312T:M\312uS[p\325\330\270\231\252\225\233\001\t"
+	.ascii	":9\0173\031\312\230>>\303\203\2630.\243|\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_setAccelerationFilter.60.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`Z\001\365\016"
+	.string	"6\336iF\360\222(\035\300\226\217\005\364\345]R\377\033\336.\020\274:\253\243\346p(>*\236\023F\215M\343)\322\004AF\030\031\035\312jE\333J\340\213lL\314}\240\221\003S\217\365yj[A\265'OKm7\3312\245S"
+	.string	"Q"
+	.string	"T"
+	.ascii	"\341[(\317]\0221d\354\216\b\254@\373\004p\002\235O\275\200\316"
+	.ascii	"\247C\033\347\343\211=M\r\0162<vw\223&B\r\237I\r}\020\023\217"
+	.ascii	"j%>\323D\\\302\256\036V\251Ldw\357\272\266\254XTALv\327\252Z"
+	.ascii	"\205\270\347mG\260\315\331/\021*Y\366uwEK\027"
+	.string	"\373\255\177\376u\253T\337c\200\306\r\224\315\356\207\037>\366f\316@\361\327o\0374#\272\314\307\017(&\262\017\363Y\274E\370\227k4\021\204\026\243\261\261cwG>=A\373\024\311\356\217\241\375\261A1\"\325\273\374\025\217\t\027\364*K)zJ\317(\355\220J\240\232s\217\342\277\273+%\313'u.)\274t\244\264\207m\f\207A\322v\267\304\237y\354\363a>\235\001\004e\310KK\305\224\276\213\277@\3710NQ\321\253>}\225\316\347\200\034#V\364\207\325&\005\216\325\034{\024\003\240\247\201\313\274\240\002\203\256\001\tII\250\300\006\b\247\224\007\026P$t\235\203\023\316;y%/\200\273P\351\363N\234it2\352:n\003M\037X\032\201[\311\343H[g\002\267\320\001\177(#\323v\372>\323\366\031\367\322\305u\315\246\346fE\262d\222\345\303\356y\311\301\321\221\253l\261C\324\036\005\024"
+	.ascii	"\203Q\022e2\374\203\007\210\343\314\367\366\r\325e\314\265\214"
+	.ascii	"\023\3374\257\315X\002s\267\324-\3542\333,A\300\t\313\252\301"
+	.ascii	"\340\304\003\243\0345\210?\2242"
+	.text
+	.section	.gnu.lto_accZero_saved.2.78.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\031\001"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\273\0014\273\001\274\001\273\001"
+	.text
+	.section	.gnu.lto_angleTrim_saved.1.79.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\370\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\031\001"
+	.string	"\005\001?\202\210\200\020\1773\273\0014\273\b}{\274\001"
+	.string	"\002"
+	.string	"_D\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_accDetect.part.0.91.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`E\002e\022"
+	.string	"\326\241wI\340\3206\035L\267\210\322\005:\245\201\273\307\320\022\341\324w\201a\330\226Zx\t\026\200\021\252\360\372\226\341\311\206\365\233\001'\350N\312\311w\002A\274\0050)\221\327 \177\327\275\177\322\275\bdmc"
+	.string	"x\227\216\355\266wJ\001^"
+	.string	"f"
+	.string	"^"
+	.string	"\035\235/}\026o\341\372N\353\004vot\212vK\021;\330^]\336\200\351u;\210\351U\263\375\025^u\244\214m\257:\227_/sbn3\363\340\263c\267\344^)\211\277N\247\366\362gl\206\345\364DWp\342\310&G\320\f\210\317\002\327"
+	.string	"\260v\327[\210\273\336\366\004\333(\366\374\020'\223$\231\202\225;#C~\247\305ry\251`3\273\314\345\003=\310\247W\224Pg?\b\206\312\306\"\263\r\361(!\355\226\f^\rn\257(\033\335u~ \333\256\377\370\350\013`\220v7\344\325\0306\225\371\002\253q\321\325y\037\377\305y\\\357Qq\200\335\021:,l\257)\315+n\315\027X\271\273\rP(\002;g\3768\312d[\3445L\016\344\354n\004\337\3504B\277\304\2539\214\363\261Q)\226\3242\227|\242\217\320\324\360H\332Iqd\314\236\277h\316\231\277\363\267\314\231\251Fq\354kKolO\277\206\334\370\020\261\033\263\324ck\352\f\023\037\372e\277\320\251}\3732\322\027z\214\017\235\310\001\247\226\230\002\212\025\034G\302\013\240\350\255\220\210\036\205\357\363\006\370\001I\367IX\255 \250\020t"
+	.string	"I\250?\325IX\222\342\211\340\006\360\373<n\024\303\361\004\034\271\223\022\317\204\373\304\221S%p\210\002\212\\J\030\212\334\351\364f\322\374\310\346\3772\235\302P\263Z\250\013\005Q!`\316g0\331%\032\346cN\301(\213\247Q\n\034\001- `\242a(\357\322\214G\007\001?,T\304\341\307R\001\266\240\013\177\270\035\rQ,\343\371\002\224\300\025a\241\271w\263\242\216\360P,\374,0T\202\212gx\241&"
+	.ascii	"\205\371\267E\2238q\0038\274\r\364\253y+\361\202\024\002\354"
+	.ascii	",\243N\022\244:\357\327\333{\377\346q\002\334'P\257S@A\275}\211"
+	.ascii	"S\224\335\177\255\032\003"
+	.text
+	.section	.gnu.lto_accInit.part.0.94.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\020\007%'"
+	.string	"jC\250\016Bp\252Mc\253R\b\022\001\204&\231P\347(\272E\326\200@h\276\326\214\346\221o6h2\t\025\210\334\326\226\335\210\214:\352"
+	.string	"P\006\"\203\265(\314zA\213\262c%\031\005\025-5\262\367\336R\246\024\321"
+	.string	"\320"
+	.string	"\325"
+	.string	"nq\273\331\201\211\026/1\333\245F\213q\334\314\034\242(\361\022\273\367\246\245_Fe\247~Y\225\235\232\352]~\245\361ni-\030.\331z\243?v\262\252w\371\031w/\230\2243\367\032\221n\272\302\355\346\356\007\316\233\345\013\2347\355sq\022\006*\255$\fU\006\336\030\366\343M\344\354\370\262v\257\221w\3232\261}i\274o\025x]\232\303\335\320\323,m\005"
+	.string	"\364Q%\253\353\252\221\247\f\300\270\212<W\356\2120\260\242E\244\342J\001\024\216;\352\rUZ\302E<J\374y<\003:ZC\312]\315\332\302\252f\035nu\275|\331\035t}\271\312s\334\352\272\275*w\367\336\334\226\260V\002\007\200*\335{\375\340\221\333\350\266\373\330\306\262O\2567\370!\234^\2027\326\351\227\320Z\331Vq7+\332\260\2715jBV\321\n\325{\246\323f\3615LFv\213\253\351\351\302\356\275\031\322\034\255\311\207r\323NO\365\303\233\376\323y\023A\030\241`m\363\313\236C\033D\347V\266j\213\266"
+	.ascii	"^\357\275V\266JlW\247iu\016\227\253\276\241\270\352\023\2556"
+	.ascii	"o\325%Zmo\374\353Y\375\004GP\002x\335\373\243-\321\3752\323L"
+	.ascii	"\371\331\253\002c\030\227V\031*\333P\272\342\241\243<\222Y\023"
+	.ascii	"[\273B\343\321\307\234\f\016\333\260<t\004\221XHB\334A\264\361"
+	.ascii	"\366\002\366\375\263\233\371G\247\246\362N\270 \310\322\317^"
+	.ascii	"\346\213Y d\311\276\2300^\263\023\032\357\026\2126ibk\367\336"
+	.ascii	"\243\233\001\366\360\241~\350\035V\2751\214\324\206\266i\274"
+	.ascii	"\r\004\222\332\275W\203\242/\n!b\304\b\373a\020\323\236\366X"
+	.ascii	"\200\202\265\215\315\264\270C\277\333Ziqd\307\337\007\222\213"
+	.ascii	"Em\361d:\255ua\266GX\021\331'\364BL>\024\223(Q\342\274i\255N"
+	.ascii	"\017\261\"\263\230\266\370\347\202\002UI{E\nI+u\310.T\355\277"
+	.ascii	"\3236\361\344\317\310\317\0035\035\022\310\353|gU\025\331\376"
+	.ascii	"\367\336km\3216\037'\313El,!=\304j(\217\223e\033\233#\262\343"
+	.ascii	"\337q\322\364\242\350\277\263\316\355\241\210\312\2757\302\034"
+	.ascii	"\333I\023\f\361^\253{\331O\263Me'oaW\253\312N\272\016oV\026\225"
+	.ascii	"\373u#\334\254v\207U\027\271\242\035BPo\3668)\016\204\335\206"
+	.ascii	"1\005\225\243W\372\302\013\fM\033\222\2222LP \243w\303\347t#"
+	.ascii	"J\304S\024\224\f\0323z'\244|\277'\003n\232\020%\005U\243\347"
+	.ascii	"s\222\341\324\324\324\343M\371\244\246\242\234\246xQP\275\031"
+	.ascii	"\274&\337\024oB\003K\321p\362\361jHI\371x\351\353\265J\226\370"
+	.ascii	"<\tc&\375\201g\232Z+\005\355\225.\315Y\033X\245\016\201W\f\324"
+	.ascii	"\036=\243\312\243\354\020\212j\314\362\034\005\231\351\220h9"
+	.ascii	"[\364\201Y\316\234\201X\252\016`\226\333\275\302\f\256WU\b\334"
+	.ascii	"\002\344\002\034\003\216\2357s\226,\312\227\327\030Y\016\b\230"
+	.ascii	"\227\017\300\003\206\212\217*\203neC\242\301\331\242S'(\316\232"
+	.ascii	"N\316\243\2436\013\351\250\375`\002\001\263J\301\362\206\263"
+	.ascii	"?\373.X\331,\341\250\305\331cy]\3256#\005\331\262\253\245=\355"
+	.ascii	"\315:\200\220\250a4\006\225RfDdd$IS\350\200\002\231\232\252z"
+	.ascii	"\022\340\3451(\025*SI\241\306^c\331\351\263@\302R\023\036rkl"
+	.ascii	"\222\313Dy\260\3121\033\207\203\207R\314\200\330Q^\377Pw\225"
+	.ascii	"\n$\233d\357\302\224\254\272\314\250c\3460\031\267e\350\266\004"
+	.ascii	"\317+#\330\021\207\243\304\347W\321\361\3232\301\372(D7\224\272"
+	.ascii	"j\255i\267R%\233\325m1H}\337\004\364i\264u\013\337yny@\350X#"
+	.ascii	"\341iI@\201\003n\2425\361<\031\343)\234\r\262\004\031-\276\204"
+	.ascii	"\367\263\032\342\232\\\311F(=P\256\005\272\265$\3374\316m\247"
+	.ascii	"\223UX\304pv@\006\204\227#\214\356\027\016\3034)\301\025\262"
+	.ascii	"\246\204^'\317\3405\367\016c\321\2761\316\224\333\233\023\376"
+	.ascii	"@\260\355\215'\242Q\023\261\t\363\371\332\350\325\257n.\251\307"
+	.ascii	"\277l<\213%qU\202\373\224\030s\226T=\036\007\374\367p3pu\341"
+	.ascii	"(\357.\373\307\334S\371\251\255\335\370\304k\343\271\211\240"
+	.ascii	"\200\250\020\224\312\024J'E|\340SD\372\003\036\346\017\331\313"
+	.ascii	"\270e\374\250fY\262\336\243\002"
+	.text
+	.section	.gnu.lto_accUpdate.part.0.96.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\371\013\265:"
+	.string	"\212c\260\025AP\246N\007K\305\003\367/\377\372\334\026*\377.\242\360\374\277\313M\375\260\336BkH\325\2061Db\254\024\211J \200*"
+	.string	""
+	.ascii	"  \020\006u*\372\3460\333RaP\330O\215\354n{\357\224R\nF\0011"
+	.ascii	"\001J\001\253\327\330*Gw\306w\357\215\352\224\265\326N\235\320"
+	.ascii	"NR\323\264\032\032\035\307\037\245\016\23044\230\207\215\006"
+	.ascii	"G\307q\313\245b\230hn\367\336>c\306\006\325W\017\rtB\370\356"
+	.ascii	"mFu\312\004\306\n\365>\203\243\315\330Xq{\f\257\312\223\017E"
+	.ascii	"\227\301\201r\303u1\017\271\341Z\346!w\365\030\035K\315[6F \320"
+	.ascii	"\312\275\233\334o-\246\3551:\332x\357\332\034\233{\233R\235\262"
+	.ascii	"\203\265Sn\266\222"
+	.string	"\332\351\332Ij\247\314\335\306\314]c\314-\363\237n2o\323\t\0213\363w\357=v\372QT\376F\233\315\302o\373\310\250XD\034\n\3315\250\246\350\273\261\345\366\352\243 \025\232\206\372\273\343\006\250V\306l\243&]l\202\346EOjegMD\027\360\325\021j\274\2613Ti\210\025e\3031\361!z\324\300M\022\027\006\251\240\224)iVI\257n\372\tol\t\352\004\327OZ\306\314<\210\036\335{\213dbh\003\377A\366\345\2520\313\221N]If\244Qt\001\032\235\"E\2620T\t\317\223>C20\377\266\353\005\200\200\224dG\332\221\332\030\244\272\367r'\331\232\221\232\271E03\027\363PAj\235\224{\323\003\375%\243\035B\355\257\021\247\007\346\206\230\333N\337\t\301M\205G\224(\241v\332\337\304fV\204\366\206\367\375\367^\257\377%3Gu\327\365\205\264\244]\243]\324\224\374\330"
+	.string	"\366]\017\344n\244\312l\242\351 \211\314{\357\004n9=\347\0047\225N9\205\no\245\n\265S\004y\202\222\376\344\206k\341\335\027\274\353\201\376K~c\367\3755f\326\031\212u~Z\235\235X\347\003\254\263\001\326\271\300\352\334\304:3\261\316\004X\347\001\253\363\022\353,\300\3109\200\352\254\324\315n"
+	.ascii	"B\347$\326\031\251\350l,:\037\031\261\316\305\"\347\242\2413"
+	.ascii	"\221\350<\034:\013Ygv\025:\007U\3269]\235\321\325\371\273\256"
+	.ascii	"\331\203\316=\341\250\306\b\355\336!\317C7-\265\273\322u\335"
+	.ascii	"\316\206\303\017$t1\022\275fa\337\347\217\317\355\357\2025\243"
+	.ascii	"\036H\240\301\310\245\260\337\233\003\307\355\357\336&ss;\335"
+	.ascii	"\264Ib\325\3166J\332\244\241\233\322uv<\344.v\002k^\262\261{"
+	.ascii	"\257\230U\3275\0347\033& V\314\315\206{\256\327\264M\307\316"
+	.ascii	"X\352\321\033\237]\314\354\313\237M\\\331:a\300\035\334\307\207"
+	.ascii	"\004=\216\236\001\233\230@\303_\362P\nk\364\251\2245\252\327"
+	.ascii	"5%\262~;]h\364\355\\\337H\n\355MQ\313y\264o\005<\254\n\200\203"
+	.ascii	"\265\262\357\213\217\316\211%\232r\342\262\215\242\266\262\350"
+	.ascii	"\235\300\336\213\243\\\370\303gn\247\264U\274\225\304w\n{/f\277"
+	.ascii	".\020\344)\237\355\225\226C\324\211\332,\355\226\266K\027\265"
+	.ascii	"\323\341\267\362\b\373\302G\353\360\340K\372S\253\003\333\267"
+	.ascii	"\336c\250\252\3510\001\331\357=n\272\205\334\305a\271y\357]\177"
+	.ascii	"\215\273\375"
+	.string	"\242\006\177E\334\336\240&\324~i\303\264mm\233\332i\360\211zf\316\340/\231\335K\325\377=\217j\377\037R\355o\265\007\346\206\002\325\374\251\222\350\275\367\252\252S\322\003\231A\373\253\337<\320\276\374\311\n\320\332\322\367k\337\0040\3331\335WUd\006\362\243\354C?\375\026K\004H\303T\336\037\016\n\230~> `\366A\177J\317\216x7F\005TK\177\371{\032,P\340\316k=+\f\0312\250\235.\315)\373\222\376\314\321|4\264\223\002\363\206\336\303\241\347:\264\236\017-\227\327i\236\377v\262\331\275\t\310\254\033W\250\221#\260\220\200U\341\301\203\tSK\310\030Y\\\"^`\315\310\362\300B\253\n\006\214-.#cMime\315\270\342j\001\243\005\026\326\325\021\311\265\205\324j\201<je]\3058bq!\217SP\274%\243\005\327q\306\326\026\327q\330}\177\215\251\222\377\325\r\327#"
+	.string	"\323"
+	.string	"\371\222GP\377\346\326\366\364\007\036\312\351\237\302\200q\362-\356\245\013\027ov\252\235\036@b\340\263`\271R\340\231\336@\323\027\250B\245I\312\245\2601\231\374\316\b\036\201\207\262\254\"\256\rx\001O\340}\020\017,K?@m\007\3401\357^\260\035\201\356d\007\")\346\275`\236\006b\307\223\233\212\r\265\323\245?\35213p\264\366M\t\315Y\025\221\311D\300+\261\3315\232\026\336\021\221\353u\220\035>@\277"
+	.ascii	"\337g\330\223\270"
+	.string	"\222+\257\366\353K\3554\300\263fn\307\210Q\330\263\370KF\252J\026\034\355\326\207\312\334\376h\203x+\225\036B\232\337!\302\273]D\301\001\220\265D\210w\205\360\210\277,\324I\306\270?d\374\362x\231\221\266-\351\233\364\314\3244\tCx7M\247_\260\374\371\335\r\212\340H\337q>\326&Y\357M\266rHU\200<!\355\222\366\314[\311\306G\372\206\353\256\"\226\350\331\001\200\365\250Q,&\231C\206FF\202H\222$\351\220\002\221\2412\326\001\021`\255C\212jFUg8N\016`\213)\224Eg\225rS\222\005\003\213\024\243\026\312\346,dS\332\277\357\312\265\336\260||\2555\237\"M\364Dj\364\231\352\331\322IWa\325\277\275\372\250\343\273\033K\357\364\353\373\264\366\345\242\036\221\203f\363`\210o\324\"\354\270\260c_\2140\322){+\361U\021\210\237l\357\177;\346qh\017\250\270"
+	.string	"\027n\265yQ\355\022[\025\205\374\374\371\223\356g\202S&#\276\021\256\177\234>eQ\3715*\3142\022\232B\2324\342\341\2632R\327\030v\226p&\307>q\2068\242\270!\210\203\323\266\207\271\375#\231\307\264\337\242N\270R}\200@f\302\366\340\021\310\031B\364\330]Z\204\213\356\255\331\241\210\353\232\026V\306\346\376\216\372=H\322|\027U\214\3745\301\346\306{\367\326\021\243\377\267\b6\n\300\225')\273-\223\375\213H[nt\033\250\375\256n\242Q\"\324\321\245e\224\261i-\267S\224.\344\020-\225X\2316>\240\230\027Ds9S\300\224PU\210oyc\375R\367d\020\004\004\352H\001\002G\213h\346\005\306\301\346\203\215\310\226X\033\262\0325\240h*0E\351\003*\373\303x\024\252\231\277EF3\027\361\376\315\016\304\363\354\217\243\225{\025P\307+3\362?\212\211\032F1^\220"
+	.ascii	"\216\b\340\021r\302\362\352h2\356#h!eiK\335\316\300\241\311\254"
+	.ascii	"I\310\266\320H3o^MgM\200\031*\314?\250\177q!\334\224\347M\262"
+	.ascii	"\366\266\027\252l[\243\202\227\r\207t\316e\033\223\022yf|@0\327"
+	.ascii	"T\353\243\346\002i\231\177\214\377H\351\365<tQB\262\304\217i"
+	.ascii	"g\363K\003"
+	.text
+	.section	.gnu.lto_setAccelerationFilter.part.0.97.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\177\002u\024"
+	.string	"\226g\205I\320\322(\035`\002\265\245\327\2603\225\255\326(\002\016\214\235}L\300^Ok>K\\{,\255\232\224\372\327\314z\317\316\177y\365\264\225-2p\233Lp\222E\207\265X(\340v\004\216\013m\2313bX6\211d\023\271S\nl"
+	.string	"l"
+	.string	"n"
+	.ascii	"\273)&?/*\337\363\177\016T;o\346\271\253S\024c\267\2272\002\361"
+	.ascii	"\223\344\001^\022~J\333_a\233\206\343\232\315\343\275\023{#\033"
+	.ascii	"\034\206z\354\256\352SMX\017\366n\225\265\203*g\315\007a\021"
+	.ascii	"z\210ng;\b\222\354\356\310\016\007\246\354\356\177\2277\273\233"
+	.ascii	"T\021\0259\227%\237 ,\273k\021\304\035\336\266\214\355\225-Q"
+	.ascii	"\004\377\352\216\035\212\322\363\276\033\004\221\326PZN\351\213"
+	.ascii	"\fhpc\367C\323\217\325\231G)\356\373\203.\355\373\276\263\360"
+	.ascii	"\177>\231f\024\256\267;\034\023\337\313}\017\362\211L~/\366\211"
+	.ascii	"\374\241\267\250\335\205\221D\033\216\3703\302\261\264\2730\342"
+	.ascii	"'\n\274\037D\363\205|\262M;o&\r\354-w\362\351\007\325\354\323"
+	.ascii	"\2473x&;\340v\003$~\224V2Y\200\274\252N\265!D\220\327\031\225"
+	.ascii	"S\233\375\032\257\221\353lc8\r\t)\035\273\273`\306\221&\300\304"
+	.ascii	"\304\204\237S\257\013!U\365\271\245\313\370\321\314\367\361j"
+	.ascii	"\0345D\204\315\272Q\005qwW\374\242\303h\371>\237\266@#\257\243"
+	.ascii	"\321\020\240\233l\362\177\277\207$\236\322\352\356\332\244\377"
+	.ascii	"B2\371\274\273\345&\231\254\377T\036;\261\226\206\025\350\004"
+	.ascii	"2\nF\006**+(\00468\220]p\241P\363`\034[fV-Y\313\325\002\340\021"
+	.ascii	"\305\365j\311V0\326\fk\034W\252\030\354\025s\261b*WkE\243\032"
+	.ascii	"a1\025J\001\277jX0\225\354\365\202\251\344\277\272\343\013]L"
+	.ascii	"B\312qS\033Py<{\346\311O=2TPol;uP]v\340\244\217\231S\0024\013"
+	.ascii	"\250\241\336w\324\201\203\032\352s#ld\223S\0011 @\002\202\024"
+	.ascii	"E\346\001\202\021\022C\204\311\206\035\352\013\331\244w\353v"
+	.ascii	"\364\366\256\027\032\231\304L\210\323\345\373n\031\336jYY\003"
+	.ascii	"cw\236\266\031\241\371sg\203\254\343i\263\207V\240w\255\245L"
+	.ascii	"\212Q~\225\271\361\224\033\334r\203$\025\340b\217\260!\r\002"
+	.ascii	"\034\016{(\216ei\037\357G\376~S\3342\\\325\340\262\270@ \232"
+	.ascii	"\216\033\333`\336r\271\275'(<"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\300\003\325\021"
+	.string	"\026\332eH\300XM:(X\026\301u\2424`\360\235:\312\304\310\340!e\203\bbG'w\233\262\214.d\017i\353\366\025\237D`\034\313FB\261\221p\035#\3753\006^x\256\377\337\264\256k\200knK\343\365\0227!r\313\024N"
+	.string	"\\"
+	.string	"Q"
+	.string	"V\344\004\037\032\206\365HB\377I\002\335)\302\247@\270\224\007\2479x\024\356\347M-\237C\221\224\322XO\347H\236\027\356\261\326k\347O8\376\267R\035\030\367\177\3220\244G\333\240\031\310p\206\364\367\337\324c7J)\315i\003\362\377f$g\325N\364\231\366\267QDcF\f\242\241\242 \"\0317\337\232\303\004\rW\242yH\364\316&i\001\242cD\353\210h\005!:\001\343\210B\262\003D#X"
+	.string	"\3654\344C\037\360\3208[\207\266\241H\034\272Fn\350c\221\032\276\204\313p%\030\372W\344c\027d,\304T\200\241\320\017;\363\243\212\217\331\361\022Y\251\332\002\214\313/*\236\025\226\342\033u\357t\244\210\221k\362J|M\026\022\262\004\262\360Xr-\303\350\317\206\372I/\372J.\372IjB\335\323\242\357\204E\277IP\177iE\237\211\212\276XK\321?(\372T\366\377\003\237\241W\200k\260\266\225u,\006 \003\331\005\352\003y\2125 \357h\003\362\326\033\220\201p@\366\302u1\005\241\245>N\325]\243-Q4\232\217g\365X\300\b\323\361\200\272;\243\224\306t\354\2112\035\177\262\355\370\033wg:^)\005P\250\221\214\322\31043E\245\225\003\340\002\251)n\003\021\300\230\265\314H4\023\320D\222\016WmVF\005\"$\222"
+	.string	"\322\331\346"
+	.string	"a\205b7pJp\306r\266 \025\340\360~\203\236\323\246y\362L"
+	.ascii	"\323\315\020\274\253j\222\243\250\003\215\370\252n\220zE\"<-"
+	.ascii	"U\253\226\270\020y\267\005]\347\003\310\340\002\032?\244\033"
+	.ascii	"\001lV(1\201\372\330\021\354\302\3716\207\263\363\355\001!\277"
+	.ascii	"b\271\320\315\177S\311\215\352\314\2763CI5z\323\236\210S\300"
+	.ascii	"\002\322\322^\227\203y\235\346?\030\245+T5"
+	.text
+	.section	.gnu.lto_.refs.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\314"
+	.string	"\265\t"
+	.string	"\306\327A5@i\233t\320\332Z\017\345\267<\324Kg\030\206a\030\206a\030\206a\030\206AQm\271\222G\200R\370\327\377\327W\017\377jffo\246f-\221F6\3312\0050"
+	.string	"4"
+	.string	"3"
+	.string	"\375r:\365\272\364:\364\272\323\276q7\222_\200}\013~\201|\001\354+\330K\264\247\260\227\340_\355\253\354\023\353R~\304\036b\375\341]|\031\004\022\332\037\341\371!D\375L\364?p}\214\373\033\\\234\337\362\376\312\373\004\357\021\264?\260\320\r@\235\200{\212\366\023\331#\236N\311\237<\037y\272\203\373\206\023\375J\016\300\017\2208\200\354\220\n\177\344;\250\237\022b\274c\270\256\211\365\214\n\277\250\267\362'\352\245\354O\366\226x\346cv\202n\026\225\372\025\362\2470!\217\026N\250B\340\330*\351,q\314#8\342\220\216\330\207\276H<\262\036\312\376:&>\232\035\253\273\006vc\365f\325\201\273\no\324\r\366\031\214\203\213\202\f\021"
+	.ascii	".[\226+\323\276\026\262\2021\005\306\200I\313.\300\254\261\331"
+	.ascii	"\234F\013Ka\rn*H\324\303\0071\r(\313n\331\374\301Z\320"
+	.text
+	.section	.gnu.lto_.decls.3b86eaa5fb569c50,"e",@progbits
+	.string	"(\265/\375`\373>=\r\001\212\234\225[W JI:\351\234g\001\02343\231\220"
+	.string	"\311\177\274\221\202\227\306M\273\251\b\211\210"
+	.ascii	"h>_E\267\247\t\213`\333\231\216Pl7{$\243K\254\355Dp\303u1\034"
+	.ascii	"\305q\024\f\325q\354\202\003\210\370\240\342t\202C\303\262\b"
+	.ascii	"\302\211m\255C\272\301\"K6\221;\005\317\004\276\005\320\005m"
+	.ascii	"\343\326\341\337#\330\002\213\201\250~\270g\230\230m\006b\207"
+	.ascii	"\256\202\331\313R\225\326\367\027\f\377\332\300\277T\370y\026"
+	.ascii	"\003\261\237\3351Z\306\373\331Q3H\375\2749;\255\275\240\306\332"
+	.ascii	"\013V9\036\3163\342\375\215\302W\r\361\247\026\003\021\252\321"
+	.ascii	"T8c\364m\250n\352\247\236q3L\212\352\333,\272\205\225^\256\235"
+	.ascii	"`\220\2409\212c\256\211C\013\326\300\313\345\210\317\263\031"
+	.ascii	"\2103\357\025\031`\244\2705\261V\321)\324%\246+\350\205\373\244"
+	.ascii	"1\366\325\267\2272\240&v\210\207m\221,\335d\313j\232\266R#5\212"
+	.ascii	"v\366\221\225v\222\235\336b\261\177\277V\f\004\007\235d\363\254"
+	.ascii	"\236\n\345z9\222\265\002\332I\366\3146Q\241n'@a\232v\222\255"
+	.ascii	"b\257\250P7\254t\226\342\226\254\223l\024KE-s\302kG*\2469C=\340"
+	.ascii	"x\360\340\301\303\314\036a\213)3\267s\316\214\335\2364Kq\027"
+	.ascii	"\313\305J\355\241\rt\263\2066oK\204B\303\351\241\215Z@\254-\\"
+	.ascii	"\036<\304\374\345\220\"\336-Q\232\033W]V}\257\002y\273Rh\007"
+	.ascii	"\255\324\022Z\301(a\215\023\232\235<\360\223\032\033\304\361"
+	.ascii	"\240"
+	.string	"\022F\357\246\304\373\336\202\337R\360-`T\306E\336\024\031}A\360\334j!z)\241A\250\004\333+\233\201\030A\217ak\305\366Yi\006\326\257upQ;\353\302\267\031\020\325\303C\233\001\361\235\303N\261P\002\013SLa\273g\245X\251\345\373\355\230%\3735\273\312\321\234\2414\2523\352\256\255\003\321\306v \276\237\260ub\237X)\007\013\345 8\270\3324\313b9Cmh\272|u\331\322\367\235\002\337r \332C\313\201xk\210\361r\210=\242\024\312\355a7[g\363\266n\027\266i\316\371\316\332Y\251eb\333\230\330\250es&\341\312\361 cU\343)\005\361\266\200\243\016\266\340\266\326\367\026\t\276E\362\226f\311\224\330$5k\316Wj\\\226\316\312Y\251]b\343\336\320\207\260K,\234M\262\001E\316WU6O\256\254\2001\230s\366\340\001\307\303\0328%\304\202\357\355\f|\353\304\357"
+	.string	">\013\370E\370\0230Rf\315l\022{\2253R\316Y\303\013\224\2222\270\276\366\210M\263\322\034\273v\213f\221|uB3\324\376m\035=\365\275\261\031\210O\001\317\364\374j\237\300\2319x\r\366@\316\207\2076\207h\321xn\215X1\fD\247'4\247\345\234mT\267%I\206};\006\277\361\007\233\201Ht\263\031\210\026\330\f\304k1\020o\2406\003\021[\f\304\f\004\240\341\277$\374]\327v\277\255!\307\224\242\205\246\233\373\373\304\222\346`QX\240\3376A\235\002-\227#\302\177CXf\333\337\027\376\206\240\331\034\220t)\177'\371\177B\n\177#\371[:\330\341W\261\374\215\0014\252\337\376M\235\3747\324\362_\375\3250\265\353\357"
+	.string	"D[\024fp\233\377&"
+	.string	"\352\367\277C\277\225\236!i\370\315\177y\032\310\354\0315G\200<(\347\371U\b\330\b4\353\342\312\376\343\364\330\337bj\214\035\342\177}\032\354\377\n_\377+\201\337\006\366\327o\373\332\353\267\367o\"\035h\027\177\017\361@\313\350:j*!\177\357\350 @~\353\365\177\203\025\324\371\325+\375\203\001\177\227\360\333\354w\367\267j\211j\375\232_M\361\177\311\377\271\377J\230\374o\241\271>\363\337\007\\\346\277\016\370O\370_\360\\\376o9\376\257\t\177O\340\357\n\374m\201\277)\360\267\317\337\305\2773\364\002\376\216\300\337\020\350\036\377i\376\213\3667\217\277\253\376\226\372\373\305\337,\376f\372[\305\337H\177o\340o\243\277\205\376\016\372\373\347o\022\177c\360\267\210\277q\376\336\371\273"
+	.ascii	"\277\025\374\255\337\337\036\376\356\3607\001\376\026\300\337"
+	.ascii	"\034\376\246\340\357\234\2773\374\215\341\267\205\277\035\374"
+	.ascii	"\355\337o\247\277\335\373\255\336o\237\3746\357\267w\277\255"
+	.ascii	"\373\355\334o\345~\033\367\333\267\337\262\375v\355\267\321\337"
+	.ascii	"\236\360[\236\337r\340\267\t\370m\217\337\352\370\355\326o\261"
+	.ascii	"\376O\371m\330oW\370\255\206\377I~\373\377x\277\035\362\333\233"
+	.ascii	"\337\342\337\202\375\326\351\267\027\376\373\375\226\305o\211"
+	.ascii	"\374v\351\267A~\313\341?\222\337r\375\326\307oy\374v\307os\374"
+	.ascii	"\026\307oo\374\326\306o\265~\233\365[\032\277\275\372\255\325"
+	.ascii	"og\374\266\352\2672~\373\374m\214\337F\375\026\306o_\374\026"
+	.ascii	"\352\267.~\373\364[\b\376\253\360\333\230\337\302\374\007\372"
+	.ascii	"o\367?\303\341\341\341\341\217\227~\231\f\376\002|\020GK9C\361"
+	.ascii	"\204\2259i\360\230\033\3701YX\203T\217\212\304\252lR\225\315"
+	.ascii	"^\351\220\235N\001\004y\202j\360\230(|k\257\0207\2640r#\352\232"
+	.ascii	"}\346&\026\016\302h8I\257\256\331(\005:\261\251Y'\032\213\251"
+	.ascii	"ZZ\tGZ\310\322y\206\251\312\223B\365\210\r\314Q\273\\0I\032\304"
+	.ascii	"\034\242\364\250E\324\261\253d'S\2438\347\214S\244\371|v v\251"
+	.ascii	"\355]\235]\215\332(\034M\034\252\331\214\240]\225\013\263\262"
+	.ascii	"\025D\254\304\350%\032@& L*\324N\261_\224U\035~\377\304\354t"
+	.ascii	"\3129C\255\320\354t4C\264\253\265\035~\032\253Z\fr\276\006+@"
+	.ascii	"\263\223\211\236\026\034\244\3159eA^\363\234\226\242XM\020\260"
+	.ascii	"\236\220\260b,E\261r\023\251G\363\202S\306j.Es\276\220\221\220"
+	.ascii	"\232\"\\\345\013K\321\374\224Q<y\262\031\212\325\314HW\371BF"
+	.ascii	"\312N\013\226\220\260\236\226\242\316\247\013KQ\254\247\034\305"
+	.ascii	"\3127\031\311\351\224\002);]\310Q,,9z\365t\263\024\275zZ\212"
+	.ascii	"b\345\260\204)z\274\200\232\323\323\352a\337\226\2202\213&*\247"
+	.ascii	"\323M\336\022\364*\363\345l\323\222\262\023\0069S]9\3619cX\267"
+	.ascii	"\243<\026GH\234W\026\332t\224u\225\221\362\226\204\\\345,\344"
+	.ascii	"((7m\320\204\346e\0346\257Y\203*3%\345<AS\316M\233\363r\316\315"
+	.ascii	"\234\363\213\023\0254g\251\233%\256\246\246\234\2378M\231\252"
+	.ascii	"\371\226\224s\247Qq{Z\212f]\361\274\031\211re%h\323re>,'\034"
+	.ascii	"m\226e\246,\230\353\311\305__\350Y\226\257\030}\277T\260\230"
+	.ascii	"\274\002,\332\3670W_\032\\\364X\251\332\245\022\001a\303\017"
+	.ascii	",7\n\007\263\323S\203\036\322D\nJ\337!6v~O\037\202\3708\213\032"
+	.ascii	"$\306\n P{*\220\037I\334\252<1\343Rc\254\270\001\026\351{c\320"
+	.ascii	"\322\336\224z\370\240\202\007\245\013\017u\207\031^\341\264\263"
+	.ascii	"@_\332\360h\344\365\205A\243*\007\016\033\316&.\372B\323j\304"
+	.ascii	"\214D\321\333\212vV\233\335\331\r5\205\214\271))\033Z\304.'Z"
+	.ascii	"[}\241H'\364i\375\250\221e\342\371\034\313J\253q\201\346%\205"
+	.ascii	"\225DC\303\n\311\n\032\226o=\253\003s^u\240!\334;\362\262\212"
+	.ascii	"{\361\241d\211\334\f\265\312\346yYq\365\275Z\245w\201\234\243"
+	.ascii	"4~J\240<\372\252S<W\251"
+	.ascii	">\320Q\003\254\257\252Jq\260\201F5\325\220\361\f[\222\225\366"
+	.ascii	"\264\207X\216\013\035\\\f6e\025\335`T\016\2217+\0330\272\371"
+	.ascii	"\002\250\247V"
+	.string	"\367Bu\001\243\307\244P\211\013\333\244H\033\227)*\324\325&)^V\246\372\336\222\251M=\325P6/\355\2025\231J55U\317\250\201\311\031\013Om\352+5E\363\203;\251\261\301\027M\r\243\2375Mhn\001\202Oj\214\205\372\244:\251-\254TmRU\\]\2412\341\310\250\230\252\350\213\271/\320A\234\207\325%\232&V\246\304\315\341\207pk\271\263&\013Us\177Y6\025\352\246\200,\031\323#\335v\306\"\254\215d\265\230\252\271\205\264\227\2213)57\330sJ\246\346\0162u\330]\324\246z\244&\251N\025IE\241*Y\251\232;\355-\325V\307\271\232{Is\351 \311\351\204\243\252\251\232\273F\003\201\nQ\226\365\347e\017\265\232\236\021\\C\0310\031?T\364=\266\201\377z\212\306b\256\355TD\221\352,\300\326\24255\345\301\322{h-\270\304\230\364^\007IN0,\242\310"
+	.string	"l)=\335p\264\224\235Y\035\342r\025\250A\302.l\301\016\354\301\336b\245\r\330Y\3364\032\013\t\247\006IK\364\253\346\036\277\300\307M\374\227B\374\227?\277\276\322\367\322\004\007R\322\235_\367\035"
+	.string	"\255\020\313\312\273\317\346\007\335\222Y\337\256\322NV+lfK}\233\n\306\222\002\233\366\355)\026I\226X\021>\325L\f\220\214\317\352\3351\035\301\351u\024(/rZ\366\312\304\364\240\330\370)\255\001>yC\241\241\202\347\203\253o\343\265\223?0#eN\236\267\226\255\030\222\005\245\351k\2525i\261\034\030\254\030xu}\373.\246\312\025;8\253\267f\005Zi\353\321ut\304\037|8\016\257Z\240\273j2\266\262"
+	.ascii	"\255\264\351\326'BzH\373\376\345\211\377\242\024\327J\3400\217"
+	.ascii	"(TJ\376\342\340\240\244e\276\2677\334\375\210T\232K\n\373\232"
+	.ascii	"\r\211a\324\233\017:\234\004I\022!)\220\254\275\221<g\362\206"
+	.ascii	"\231B&x/\372\036\36005{cmq}[\255\246\351I\306\352\373V\353\264"
+	.ascii	"Cs\3160\201|\\\302\332\360\211R\234\263>i)\201\365\355h\027\351"
+	.ascii	"3\233\367\274\311Hlt\323\2343\232\225v\264\305\032*\311V\224"
+	.ascii	"{o\245}\326e8\320\234\323\316z\254\2416\357\t"
+	.string	"\315P/j\323,`\2039Cq<\334!Mb{\367\236H\003\3675\331\375t0\211*\322\367D*|\"\f|\342\023>\021\005>\261\211\277\026\342\257Yp\017i\"o\257\356\312\355\265\301U\316\316\366\2621\314\331ic\355\005\326^p\301\262|H\211\367\253\037\376\352\004\177\245\303?pl\\T\035Y:\303\017\241\325[R\255\303\036\315e\245\355\243q\374B\263\217\316\321<j\220\240\371)\003\271\n\224\027\215tpK\024\361\366\016\233\025<\224t4\351X\235\370\267\257o4\024Z\216\353$\202Z\330bt\026\031-%\201\\\322p\016\324\351N\353\013\234\253\246\226\017]pP\300\006-\n\024_-\326\027\253\213\032\033ph^\253\213\025\312FV\017\036\320:,\204H\353S\343h\265\031;\264\364}\004Qx\002*\026,\032\t\316\225\032\005\216l\211\327\372\326\365\306#\n\306)\2622\255L\252\2405\253"
+	.string	"n\214\213\216\246\tT\333\023\024\343\304\255Ik\322\252\302\036y\002\0268H\f[S\021dM\361UE\234]\226X\337Ui]\272\216+\253!\353\322\223\017\026>"
+	.string	"1\260\3008~\206_\235\206+\222\005\264\320\374\274j\376\r\300\252n\210\341`^\242\352"
+	.ascii	"d\303\212\311z\364\025\211\311!\232\033\326\232\2776\245D\261"
+	.ascii	"3[\202o\227\337\303)\027U\204\274q\331b\202\367\267\206\017A"
+	.ascii	"\024\347\240\020\024\274\20588\027\201\0226\235\2212\355\223"
+	.ascii	"B\370[\330\266\344\274\2037\213M\226\332\224\250\267\331.\266"
+	.ascii	"/)\020\234\243\345w\277\013h\315\250t\301G\244TSZ~\001\315\230"
+	.ascii	"\352\b\373\336\351\315\362\271\024d\\:\313\337\313[\215-\347"
+	.ascii	"\323\214\341\324\237\224\213\345\242P\205`\201\345\365\275W\336"
+	.ascii	"Fg\226d\n\301\f<\301\n*T\256\025\353\364a(\023\250\"\313R\225"
+	.ascii	"_+\027\n\331\036_\026\214Sco\357\362\341\\\251W\200\364\b\364"
+	.ascii	"j\251,x9Z\312/\337c\272$aY\023\362\201\212\216\036J0NW\217\236"
+	.ascii	"^\323Y\263\334\002\347\353O\307`\207\033&\245\251m\013\343\314"
+	.ascii	"\270^\277F\254\364z\335'<G\331\351\325\241\353\215J\203\233'"
+	.ascii	"\205M\256\257\023&\036+\f\373\376\302\024~\b$\227m\310\024i\363"
+	.ascii	"\211UI\273jV\246v\027\3576\271Ln\236\225\336\273\333\366\316"
+	.ascii	"\272G\216\203\344\336\3355{\305\346m\201 F\345\336]\267K7HCC"
+	.ascii	"I\315j\346\246\275o\303\321\322\002\306\374.\335}\273s2I\376"
+	.ascii	"n0i\341\326Y\351\245\273\207\034\232-S\006\307\210sw\311\214"
+	.ascii	"\233\212)\245\276W.j\267\242\006\2258+\275J\200p\351\321\367"
+	.ascii	"\302\275/ES\305\212\313\301x\013\273\223\202\177\343\004\377"
+	.ascii	"F\311M\202\243L\253\330\360o\244\3707h\3707E\324\232"
+	.string	"o\215\326i\301\373\302\235\315n\364\242\37506`n6\326~\340\337\263\023r4Y\353{\355\345\210\027\372[\366\303\264\235\017\256\246\035\370w\354\222\361\365P\273\251\201\177\213\254\035j\221\321\367\212\341\244\233\250\fb\252\330\254\256\330\177\301nX{]`\003\207\\\004\373\236\317f \322X\f\304f\342\371\375\222\301[2%#\304\023\320\335\037\367\307\035\222C\370fe\\\275\330\273]\277Cf\252@a\013\274B`\302\262\356\256\220\033\004N:F\005O\311X\036\273@l\333\013T\336\234\222\036\336\240\344\366\270\\\267\307\365\261\200\fD\356\\\036\227V\337\353\303\foprw\334\035\027\313v9\271Q\350\325\201]@\236\344\300\025\344\0349\354\270\300\270\360lX\340\nf\334\255\273\325t7\371\b\n\031\227\275B\367\202N\013\256\240\206\215{\303\006\007Xn\024z]#cdYw\327\352f]\253[\343\326\230"
+	.ascii	"H\317\325\315\272W\027\0137s\266\320\200\211\222\355)]\032\277"
+	.ascii	"X\352]\216 Q{\345\222\005y\3328\202_\223\0037\212\236\337\252"
+	.ascii	"[\245f\335\025)\327\340\301\0253F6\227\244\006\356\247\236\337"
+	.ascii	"\251;e\365bP8\371\0232CXF8\245\357k\362\215qe\334\030\352\332"
+	.ascii	"\004\323\373\2742\356S]\313\301\342\204\306\354\217\305W >M\024"
+	.ascii	"\214\263\242\347\027\306\255\364\302\350\0247P\031\373A\3411"
+	.ascii	"\315NO\r^\232\350\331\265 \3058\271\347\252\241\225\252\206\327"
+	.ascii	"\005\314\007]?\256\213_\345\242v\271P6Z\370\230\256\364}\372"
+	.ascii	"\023\202D\251\357i\302\360-\231z\3106u\352p\353\246\237\247\351"
+	.ascii	"\303\riH\222\025\327\351\252\270,n\213\233\3426Y\351e\272(~\223"
+	.ascii	"\256\322\322\333l^\232\345\032c\313o\243\013s\273L\367\350m;"
+	.ascii	"^\246\274Q\3512\230s\366`s\b\004.\337\334\323Pa\273\201\246\t"
+	.ascii	"\237F\005>\215\022>\r\022>M\023\177\246\013\376\314\026\274^"
+	.ascii	")\231\301\2025D),\354\2421\023E\213:\250E\025\334@\b\250\016"
+	.ascii	"\002\252\202\031\246\260\3308\260+jj\340UA\032@\264\274\261\236"
+	.ascii	"A\304kaXx\207?\303\206!\270\321s\365O"
+	.ascii	"\252\376\251UO(\210\255\020\033\314\371\251\301*\b\250Ue\f\237"
+	.ascii	"O\275\302\247N\2119[\350U\013\247\253S\230\037A\262\230\372r"
+	.ascii	"\320\232\242^\231\242\372\341f\004d?Z\fi\255\210\332w"
+	.string	"\325o\245\232\322\225\244\257JE\265\362\"\003\220\215\210jE\255b\371\246\204[j\214\025\273(aj\230\026+#sB\360g\262\260\206\"=W\367\366\336n\2147iS\337\317d\254\341G\317U=\275~\336\246Yn\021\242\354F\241\227\f\021\031PXuX\203Z\317\325'V\252>\351'\b\317\253&\226\017A\234\300\320\331\230\222)\202)\350\353\271\332d\211\232\327P6'91\240\251j*\023\206/C\004op2Y\242\336u\023g7\f\327d5\275\201/\003\003S\020\330c\277\254\332\302\022\265\316\262\335\274\025\347$kp\031%\374\030A\254A\253\347\352\334\234\275\002\302\326\325\217L\247\001M\027\224\205\221\276\217y\202)\220\312\311\305\305\204a\rr=W\343\244j\234\352B]\312\316\254\017\272\2328\360\006\033=W\335\220\250o\r\005B\313!\244r\205\242\004\030\230K\245P1\211\034!\331\200%r"
+	.string	"8I\244\222\271\224@H\310(\231$J\2760}\210\314\343r\3508D\\\032!\200\306\204\tL\220\340A:>#\216\030(\226\240y\220\316\316Qi\304,\036K\274<H\347GY$\"\2613#$T4\0061\213C;K&\222\304\216Q\022\310"
+	.string	"\0320J\"\205\f\260\201\b\037\021\035h`\347\370c$dL\"w\224K\243\235\035\026\210\224AL\242\344K\211\342Q\3502\227I\"\343Z\202\231D*\205\210'\204\212\212F\\\030\001\205\0220\370\034\207\220\314\244\221r\307X\002"
+	.string	"\314\243\n\313\230\007\351\354\020!\211\017\3221\226\320p\242\004\222It\302Or\004\006\346\203t\212\214\210\224@>Ee\261h\307("
+	.string	"c\322H&Y\242\327\245\317\f\323'\tT\264&\201\212\324\343\006\220\313\273\\\036\225??\305\027%\263H\3759\276\374\034\227Fw\371\362\023J\245\017P\221\016\315\t\345\206e\004G\346Q\250h\210(\204\013\226G!\343\211\020\216\032F\240\240\230\223\202\004\031\216\313\r\353\203tv~\204\220F$r\200\214H\034\177`\216\314\345\t\025|&`>H\247\304N\222hh\210\310H\001\210\237^\372\374\024\2152\200$Q\363\201D\363\220h\020$\232\247\330 \212\315\363\323\312#S\b9\302\006\026\3004\n\241DQ\tFcQ\006Y\254Y\376\034\177l`>\3500\225\305\"\235\233!\"%\n\tH"
+	.string	"\021\363h\242\250\002\006\307$\221\b\314\344q\350\2504Z\026\217&\f\340h\002\3114\216H\022\205`4\216\330@\302~\320!\241\332\360\350\034\205\200\222\305\0134 t~\216&\212K\037\233\bF$I \300\205\242\r\241STG"
+	.ascii	"%\2153$\220B\305\020\214\306\021CJ\242\022\312c\021\007\037\240"
+	.ascii	"\"\0167\"\225\307\344\021\b\177\003\021\006\020\321\201\006^"
+	.ascii	"\336\201\007\037<\370@|\007\036\360\360x \202\007_\004\217\032"
+	.ascii	"\301\215L\243\261\250\036}\216?D&(\217E\307#\211\231\345\312"
+	.ascii	"|\220\0163\002\027\226>\020\020_\222#\260@"
+	.string	"$\264\214Q\036\231K$\3201\005\b\030\025\reH\216pd\"\225,\234(\201T\036M\320(\231(\244`T4D\223\034\201y\\\036\225/FFEC7Ld\222\004&2\211\274J&\n\306\244\321\b?\305c\nF\343\210\b\226>&\216\"\374\024\217\312\373 \235\rK\037d\221\n?2L\237\006\220p\223H\024\222K#\021Y\264T\231>G#\322\304Q\204\245\021\t\231\245\021\tU\001<D\026\212)\204 \302\b\242\262\030d\274\307\037\242\020\222D\310%\322\304Q93\302h,b\346\203t\214\212\206|\210\224'\200\216&\220\312\237\243O\n\0378\370 \302\250h\b\203\221\020\321\362\250\214Y\372Dp\364Q\301\250hH\206\310\0242Z\036S0\036\231G\021\214\212\206 0q\374Q\205\212&\224Gf\222\004\240$R\250h\250\250\202\321X\304\020\304$\"\032RA\210\210\b\001>\353\321\230l"
+	.string	"sY<\226\300\034\361sd\026\177\212\0360b\211\314a\372\200\b\301djx\020\006K#\037\024~\222#0@\260\364\001B\226H\022\205\240<2\217CDFx\003A>%\212\204b\216>5I \244P\021\206\351\323\0013\2114z9*\213,\374(\213A>Fcq\206Y\342\370\223\363 \035\016'*:*w\230DD\312\035\031\026\212'\324%\005BBD\312\033dd\"\213\326\345\321H\250h\202h\344\263\034B*WX\032\221C\305\344\t\021\230A@H\241\022\031\230>\"x\230I\344\3137\370\341\300\330\003\002\204\b\035\234\367\364\204`\301\003NP"
+	.ascii	"6\352$\211\220\314\242\362(t4\032\213;K%\3212y\\\356$\221\305"
+	.ascii	"\241\035\243r\271\243s\001\013E\245J\244<N\300h,\276|\265S\267"
+	.ascii	"dq\321A\2415\205PZ\b\326\255*\334`\340\330\203\n9\342\265G\267"
+	.ascii	"\"\275\030\031d\203\232+\274\001\004oF_\nx\274\255K\326\267U"
+	.ascii	"\316f\247&XV%_\345\n\300\264\305b\215\263A\362\272\001\265\306"
+	.ascii	"\255p\267\254L\fGNOIQ\261\365\275\004On\200\327\310\223\244\257"
+	.ascii	"6\027\230\212\030\233 \033\324j%\255I\265&Y\221\274\b\342E\351"
+	.ascii	"\321\234i\351\322\354[\001\332\221um=\262J\255\223S\210\254\347"
+	.ascii	"\363E\007\351\252\246\304\371FeU[\323\356\213%q?\326\257\300"
+	.ascii	")n}\237\201\213\021+Q+\204\\\320n\2155\252\256\331\020\361C#"
+	.ascii	"\262\236]>#D\252\244\365]\241k\331W\263\257f\275\232\251\207"
+	.ascii	"\207\304\"zG\210w\303\330:\266\222\255c_o7\n\275\346\360\006"
+	.ascii	"5\261\265\210\330\365\001\303\363\325\374\021f\257\020c\240\330"
+	.ascii	"\262\006&h\303w\245\305\364\245\372\251S\277\257(}\241b3-Z\350"
+	.ascii	"\270\"\362\342zMS\200\r\221z\t\"\205\252\256k\255\352\026A\234"
+	.ascii	"\246\204\250D`d\030\211A$\310W\036yd\2078\200L\021\360\307\244"
+	.ascii	"\325\267\202\244\225k\375\261r\335!6;m\360U\226\341\211\377\325"
+	.ascii	"\207\032%<\254\332\3227\247\212\325W\032V+\017uo&\277\264\325"
+	.ascii	"Q\201\032\314K\317\0162e+\312\234l}\345\361u\007\b\016\336\207"
+	.ascii	"\275\206\3549\373\256:\276\346x\336\301Mq\2549~\230\230 ZQ\""
+	.ascii	"\204\370\006\300fQOO}\327\033\357\273\220>&,}W\033\227\373S\312"
+	.ascii	"\340\215U\013/\013\312Q\337\025k\315\262\322\333\2555^\003\247"
+	.ascii	"\244f\367\207\377\001{;\342z\365\265\t7C\013\353P\2727\305U\005"
+	.ascii	"\347\344QQ\255UkG8l\226\340QAU\265\023\033RJ}w8\307-*j\225\372"
+	.ascii	"`\263\022\334\231\216\251\341\221\336\223\324*\003\251G\340*"
+	.ascii	"c}\032\362Y\311\302E\002\205H\250\363b\363\211`:\305\234c\f\331"
+	.ascii	"\310\214$I\032\003\243\024@0PP(\032\215\210\321\036\023\300S"
+	.ascii	"i\344y\222\205!S53\223$Y6\003\237\300\272\276\017*z\025I9#\367"
+	.ascii	"F>\321\255P]\207\352\261)\332D2\030\365\243U\250\251)\256\324"
+	.ascii	"L\304S4{\225_\367f\2415k\201\372\354\342zKb^\004\214;\322\r@"
+	.ascii	"\230\305x\332!.\016T\264\2157(%\240\372\201"
+	.string	"\211\232\245\030\371\3501\232]n\246M\334h\310D\3063\rF\233\b\300\343\b\237A\024\022\245%%\263t\343\025\315\223~\240\217po\303\234\334\365\301\025\2468\332\327\345>\226\332\016\372\263\230<\037\256\223\031pic\202\252 \031\375\235\\\340\353\370\207I@\263\261\036\247M\230\0017\270\231\020\362S\025|\241V\245\204\275\271\206b\350\373\350\272\3108Y\220\344\t\242\203\277\242?\225\316\205Dd"
+	.string	"\344\266D\315sa]@"
+	.ascii	"9{\t5\373@\271\252\323\255\315+\320\362\367g?_HHZ\227\034\344"
+	.ascii	"\3101\241rSi\331\2400z\343\203\227\341\\H\036\260\037\346\020"
+	.ascii	"J\366\020j\214\024'\0302v\260{\022\273\033\340$BB\267\f<_.\341"
+	.ascii	"\204\200\352'\236\250\222j\245\375\321BQo\252\341x\264\"cq\300"
+	.ascii	"\216\032\314\t\365\232\217\240\300\t\307Yp\276\303\3511u'~m\240"
+	.ascii	"\316m[\240\220\265K\276\273\341\257\305\350\262\364\350\364\001"
+	.ascii	"UK&\321N\307\305\333\354o\006\335qK\213\302\0327\377\036\245"
+	.ascii	"\274N0/4\233\024\255\0245 \202\\\304\341^\300\335Ru\347\210\256"
+	.ascii	"$\3524\007\250\203;\233+\"\343\"\216\224*\321?\267\013\361\347"
+	.ascii	"C\220\256\b\274{\2563\253\013"
+	.string	"\314\324a\202\342\365\360!\321~\004_\341!5\252\242\307\205\327\316r\\\344\346\277\324\372\351\270ts~I\rW\263pG\201\377\230\225\337\203\265v<\217\342\005\337\361\264\323\274=\214cA\321\210\247(j;a\230\347\321:\253u\233y\036\355\237\310\240\021!\335/\265\ny\001V\001\346\017SPK\213*\266Hj\240\204\n\030\265At\366Fl?9~o\200Y\315Q(4\005?\3712\351g\300\013\007\250\245\300\020@\023\3778!c~H\351v\232\306Q,\277\037d*\3349m\231\315\221\314\307\312\216\311\234\325P\r&Px\376\277A\333?\326\330\017\316\024\375r\3650\235\3066^\332;\b\365W\316\002\234$\315\277s\242\030\307\354r\264*i\036\233\300h\006\006\277\352fK\331\006\302S\340\256\306[)8\341\0305\323\001%@\023196\3758\366\302\237\244\230\213\255#\330\237h\024\\f\3740"
+	.string	"C\324\023^\b\026\377\345\221S\375.\332\213\3344\373\\\035\365\334\317\313\257\241S\361\240O\0062\337\007\025\n\\\366-\321\034BF)\351us<\n\364}\216\252\0340\250\222;\316\003\004\247V@I\304]\313\274\346\263\"\357\202\016\b\013\304^\b\205\355\251G\001\016\032\202#\356\217\237%-\260-\t\342V\365\322\323\370\374\333J6&:\263\265\357u\222\226-\334\215mbF\205VN\013\227OO\215\237\246\f\026c\237S\360\204\322"
+	.ascii	"\005\320\232\025l\316\255\323\242@;c\272\301\020\256U\313\332"
+	.ascii	"\326Y_/\302T\016\036\240\365\347\241\211\317cW\376\362\026\263"
+	.ascii	"\275P\001^\333\202\254\223\206\027\364\230m\310\335\362\013;"
+	.ascii	"\373\234\006\334\255a\323&\024\256\223Z\343\023\227v\227\202"
+	.ascii	"\317\026!\225\nr%3E)\376\031\304`\324\336\274\213\360Ut\024R"
+	.ascii	"\373\332\243\006\221\t\213\354L;\320PNc@\263<0\222\343\301H\302"
+	.ascii	"\265\275\021\363\020\261#\230\020D\2157]\231\244Y\302\032i\242"
+	.ascii	"\363\203<\0078\204\013\037$5\342\223\307\270^\213,\202\2517\301"
+	.ascii	"]\216\306\2608d\023\025\371\331\315\270\023\225\346\203.\031"
+	.ascii	"\230\350\032\246\035\214\030\222\231p\017}\021J\313\220\203\027"
+	.ascii	"\203\242F/\255I\306\017A\222F\265>\271\230SYu7\262\225\247\330"
+	.ascii	"\334\020y~;\210\223:\220\177\354\006\236t&p&\374\027\\\211\244"
+	.ascii	"\274\003\317\240\227\370j\263\034\253E\376\316J\366\237\217\246"
+	.ascii	"\336\032\023\257\202\3362\346\233\030\022\362\347\375\335t\312"
+	.ascii	"\017\\A\236B\255\r\375\037o\217\036\344\206\314xC\353\243\013"
+	.ascii	"\365lK\360\224{IH\312}\006\337/*\222ynK\005L`\206\001q\233\324"
+	.ascii	">Hw\373\354\236\004\b\345B'[\214\322_Vf\210\250\001u\255\003"
+	.ascii	"w5<\275i}o\006\346\026&\004/\231<\273!<\026\t\205\376\366\263"
+	.ascii	"Eg\377`C\303x.\266\263\257\242\003d\f\317zMZ\344\207p;\217\301"
+	.ascii	"\260\211\275\270\002\265\271B\353&\271\254T\205\032\217\021_"
+	.ascii	"A\325y\n\352\300dX\256\r;\2619D\251\235\244b\374\247\270\371"
+	.ascii	"1,K\223I\260\251\363F\2365\0203X'\267\3160\275[\326\332z\320"
+	.ascii	"\001z\267\360\021\002\177\346\007%9S\305\276\272\177\024\245"
+	.ascii	"\350\250\004\013\303\026<\337\313\261\264\337\326\312RnH\225"
+	.ascii	"S\013\376;\037\221>\340\313l\266!\f\275\033d\031J\366K)\363U"
+	.ascii	"\223J\362\025z0\252\rX\224\212\230X\211L\306r\374\002T\223\373"
+	.ascii	"\237L\276%^\365\305\313d\344\366\322Eg\023V\030\303\344\354\375"
+	.ascii	"\243\366\344\r\203\210\357\244J'\324\265;\321\342\001\2724W\362"
+	.ascii	"\273R\347\213[\216\227\202Xi\021`)\220p\327\030@\026\355>\tJ"
+	.ascii	"\234\345\245Ie\366o\263\342DoA\232\243\016ST\241\323\206\210"
+	.ascii	"\205\374\031\3424\030\016J\034Y\334$Y|N\251K\322\002\323\235"
+	.ascii	"-4\037\216\237\233#\021\336@\203\t\214a\251\016\356\311n0y{\037"
+	.ascii	"\206\002\235S\355J\236\324:\211\007\005x`\204N>\002\254J<0\276"
+	.ascii	"\037\226N\341\023\232\207\201\326\246#A\232\022*4x\354\314\356"
+	.ascii	"\235\341xB\276.\252\2676\030\255W`\021\2531Yd\254\265\333\304"
+	.ascii	"?\340\213\357\bz\316\177\247 \350\251.\207E\376\237\021\335\341"
+	.ascii	"ck\202b\320wU|\337&+\345]\3501\335\262\276\375\334\375\307\215"
+	.ascii	"}\340u\035\214\235\035\311\360\253/\3371o7\237#\255]4\"\363C"
+	.ascii	"o\b\312w\204C=+\221\023 \301\177\202\314\371.\301\371\3321qN"
+	.ascii	"\0310\242[ :\244Q\366+\314\202~\t\023e\246\364\322\031T\320\364"
+	.ascii	"C#P<\317k\371v\232G\354\3447\356AU1\230\037\300\346h\017p\013"
+	.ascii	")EKK\324\276\204\200\033\361-@\324\n\271&\354\301\310\312}r)"
+	.ascii	"\341\312\323J\362c@;"
+	.string	"X[\003Bo'\034\365A\321\362\317\371#\354\3504\016R\220I9\360\341G%\022\244<\246\207(\264\237\342\277\203=\274\236@\332\337\277\252\207\371\352\205\321\356\231`\306 d\275*{_\221\370a)\204;\r\351\221y\323\316\317\020\230\332\005\007\261\"\206\034\357\351r\375\025H\242#\022d\233\354a\345r\314\013\315c\212\225\032+\016Pm\262q\t\235\003\3277\354>\236Qc4\2535J\342\0054Kv^\020q\222\231\304\302\020\363i\320\354\211L\222\263E\361\276]'5 \345S\345y\320\235\247 \024Ir3'!|4\352Q\026J\004\361,\265\021!B\370\243\032\007\226C\276\301(\277j\340\350\363t\271\363\037\206\341~z\233Q@[\223\r\033\335\245\333\332\210\211H\215{!\376)\363\"\333\276\224\220\200\204\2353-\017\2551\031\364\277=\206\212\313\026\3761t\021D\353S\314s\007Q B\216"
+	.string	"\002;\276{\253R\350b\025\021\271\203!\352"
+	.string	"\201\267\247taf\320`A\350\274T\2512\005b\241\366\025\366\307\3778&\265\2408G4\3077pF+Q\350\013"
+	.ascii	"x\350\356'\373\001\212aP,dv0\037\332AP\345\253\311e\366\312\234"
+	.ascii	"y\002P\324\332\031\b\315\3776\023k\340\315\315P4\263\204j\367"
+	.ascii	"\204\177\210\002"
+	.ascii	",\352\203\241\275\360W\003\262c1\276\330\365Sfa\016\243\224\214"
+	.ascii	"\267\302\266L\212\216\353\204\306U\2675\363,iC\331\017\034{\233"
+	.ascii	"x\261\352\323B\204\023\257\350\302g\370\351\b\253\277\005zB@"
+	.ascii	"\253"
+	.string	"0O\243\373\212\245p\305lcP`\310I2)q.#\0161n\032/M\0177\2038\345\212:4\221-\320\365\t\237\nPDu\342\023IFZ=\271Nb#E+\252\02756\345\240J\224QK\252\022&\350\316;%6VJ\324\307&\365\225\230\347\r\265\033\013\004\365\213\020\260\361\031Uo\004\230!\3671QgJ\020<\235\322r\256\226\206}v,\313g\266\210\306@\266\033\255\275\311\341\307\036,E\315\271\376\255R]\360\006@\261&\311\316D\353w\202W\262\247@;,\377\0043s?\230\202v\203\3725-SJ\347\231\250!%v\204\330\327\322\373\356)\330\327\201\366\3450,\340\231\007\363\217\n-s>$\364\"\275\356v\336\312xV\bwd6\006\033\240\356\342\227\246\366\254\310Y4^\335\316\360nG\331Z\374/\201\321\265\006\256\006z/\375\357\336\002[\254\354\367\035a?s{\322B\376"
+	.ascii	"\335-\177\376\373\334o\363\3663s\362\315\336\327\325\201\232"
+	.ascii	"w\001\247\201\236B\375m\231\006w\230\275\216\245\303]\336\037"
+	.ascii	".\317\315\341\025}\376\356\002v\371B\343\332\362]B\315\032\200"
+	.ascii	"[]\3178\234\242\345\013\315\216\315\245i\343\003p\360t\312\261"
+	.ascii	"\246\025\256w!<\034\365\006`\353\266\272\035\026\235\007\260"
+	.ascii	"#(\016\006\257b\001\225\331\226\023\n\253\031\375b\035\021\374"
+	.ascii	"\f\2672\270\261\236?\215\034\324\316\311\277\177\206\323/\253"
+	.ascii	"\2173|g\317h\243\341\362m\364\375\203\037\324\200\232\223~@\330"
+	.ascii	"X9\366\237\300|\250\370\033}\357\374\256g\262\337\252|#\336)"
+	.ascii	"\3303\027Xt\362\276\210\013f\336t\2762\274\311q(}\323\206C\223"
+	.ascii	"\206\033\017\035\315\371\354:x\363\350\223q\350y\324\275\032"
+	.ascii	"\024F\361\237b\254\242\276\210\364#\234|\327t\340\223\261)\237"
+	.ascii	"\007\365%\345\027\365o*\016\3245\304\177<O\312\215\314\035\317"
+	.ascii	"u\2157\355\375\253\347\276\211\341]\326\265\346\275\n|-\276\210"
+	.ascii	"\371>]{\237\376Fx\242\300\222\235\207\212\241\203\313\236\214"
+	.ascii	"NH\264k\203\n/\271\247\272\002"
+	.text
+	.section	.gnu.lto_.symtab.3b86eaa5fb569c50,"e",@progbits
+	.string	"pgResetFn_accelerometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"x"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"resetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"accResetRollAndPitchTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"accResetFlightDynamicsTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"accDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"accSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"isAccelerationCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"setAccelerationTrims"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"setAccelerationFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"accelerometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\002"
+	.string	""
+	.string	"InflightcalibratingA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"AccInflightCalibrationActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"AccInflightCalibrationMeasurementDone"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"AccInflightCalibrationSavetoEEProm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"gyroMpuConfiguration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3b86eaa5fb569c50,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,12677 @@
+	.file	"barometer.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/drivers/barometer.h"
+	.file 6 "./src/main/sensors/barometer.h"
+	.file 7 "./src/main/sensors/sensors.h"
+	.file 8 "./src/main/sensors/barometer.c"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 10 "./src/main/common/maths.h"
+	.file 11 "./src/main/fc/runtime_config.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	barometer.c.9032f90c
+	.weak	barometer.c.9032f90c
+barometer.c.9032f90c:
+	.long	0x642
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1888
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1775
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1776
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1777
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1778
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1779
+	.uleb128 0x2
+	.long	.LASF1781
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1780
+	.uleb128 0x2
+	.long	.LASF1782
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1783
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1784
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1785
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1786
+	.uleb128 0x2
+	.long	.LASF1787
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1788
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1789
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF1790
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1791
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1792
+	.uleb128 0x2
+	.long	.LASF1793
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xab
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x10b
+	.uleb128 0xb
+	.long	.LASF1794
+	.value	0xfff
+	.uleb128 0xb
+	.long	.LASF1795
+	.value	0xf000
+	.uleb128 0xb
+	.long	.LASF1796
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1797
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1798
+	.value	0x8000
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1799
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xf
+	.long	0x117
+	.uleb128 0x11
+	.long	0x127
+	.uleb128 0x6
+	.long	0x8a
+	.uleb128 0x6
+	.long	0x70
+	.byte	0
+	.uleb128 0x1c
+	.byte	0x8
+	.byte	0x4
+	.byte	0x35
+	.byte	0x5
+	.long	0x146
+	.uleb128 0x12
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x12
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x146
+	.byte	0
+	.uleb128 0x7
+	.long	0x10b
+	.uleb128 0xc
+	.long	.LASF1806
+	.byte	0x20
+	.byte	0x4
+	.byte	0x30
+	.long	0x199
+	.uleb128 0xd
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xb
+	.long	0xd1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1800
+	.byte	0x4
+	.byte	0x32
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1801
+	.byte	0x4
+	.byte	0x33
+	.byte	0xe
+	.long	0x199
+	.byte	0x8
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x34
+	.byte	0xf
+	.long	0x19e
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1802
+	.byte	0x4
+	.byte	0x38
+	.byte	0x7
+	.long	0x127
+	.byte	0x18
+	.byte	0
+	.uleb128 0x7
+	.long	0x9f
+	.uleb128 0x7
+	.long	0x199
+	.uleb128 0x2
+	.long	.LASF1803
+	.byte	0x4
+	.byte	0x39
+	.byte	0x3
+	.long	0x14b
+	.uleb128 0x13
+	.long	0x1a3
+	.uleb128 0x2
+	.long	.LASF1804
+	.byte	0x5
+	.byte	0x14
+	.byte	0x10
+	.long	0x1c0
+	.uleb128 0x7
+	.long	0x1c5
+	.uleb128 0x1d
+	.uleb128 0x2
+	.long	.LASF1805
+	.byte	0x5
+	.byte	0x15
+	.byte	0x10
+	.long	0x1d2
+	.uleb128 0x7
+	.long	0x1d7
+	.uleb128 0x11
+	.long	0x1e7
+	.uleb128 0x6
+	.long	0x1e7
+	.uleb128 0x6
+	.long	0x1e7
+	.byte	0
+	.uleb128 0x7
+	.long	0x93
+	.uleb128 0xc
+	.long	.LASF1807
+	.byte	0x30
+	.byte	0x5
+	.byte	0x17
+	.long	0x254
+	.uleb128 0x4
+	.long	.LASF1808
+	.byte	0x5
+	.byte	0x18
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1809
+	.byte	0x5
+	.byte	0x19
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1810
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x13
+	.long	0x1b4
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1811
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x13
+	.long	0x1b4
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1812
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x13
+	.long	0x1b4
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF1813
+	.byte	0x5
+	.byte	0x1d
+	.byte	0x13
+	.long	0x1b4
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF1814
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x1c6
+	.byte	0x28
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1815
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x3
+	.long	0x1ec
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x6
+	.byte	0x17
+	.long	0x28a
+	.uleb128 0x1
+	.long	.LASF1816
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1817
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1818
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1819
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1820
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1821
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x3
+	.long	0x260
+	.uleb128 0xc
+	.long	.LASF1822
+	.byte	0x10
+	.byte	0x6
+	.byte	0x21
+	.long	0x2e4
+	.uleb128 0x4
+	.long	.LASF1823
+	.byte	0x6
+	.byte	0x22
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1824
+	.byte	0x6
+	.byte	0x23
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1825
+	.byte	0x6
+	.byte	0x24
+	.byte	0xb
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1826
+	.byte	0x6
+	.byte	0x25
+	.byte	0xb
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1827
+	.byte	0x6
+	.byte	0x26
+	.byte	0xb
+	.long	0xc3
+	.byte	0xc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1828
+	.byte	0x6
+	.byte	0x27
+	.byte	0x3
+	.long	0x296
+	.uleb128 0x13
+	.long	0x2e4
+	.uleb128 0xa
+	.long	.LASF1833
+	.byte	0x6
+	.byte	0x29
+	.byte	0x1a
+	.long	0x2e4
+	.uleb128 0xc
+	.long	.LASF1829
+	.byte	0x38
+	.byte	0x6
+	.byte	0x2b
+	.long	0x335
+	.uleb128 0xd
+	.string	"dev"
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xf
+	.long	0x254
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1830
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xd
+	.long	0x93
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF1831
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xd
+	.long	0x93
+	.byte	0x34
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1832
+	.byte	0x6
+	.byte	0x2f
+	.byte	0x3
+	.long	0x301
+	.uleb128 0xa
+	.long	.LASF1834
+	.byte	0x6
+	.byte	0x31
+	.byte	0xf
+	.long	0x335
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x377
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1836
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0x4
+	.byte	0
+	.uleb128 0xe
+	.long	0x9f
+	.long	0x387
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1840
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x10
+	.long	0x377
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x7
+	.byte	0x2d
+	.long	0x3c9
+	.uleb128 0x1
+	.long	.LASF1841
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0x40
+	.byte	0
+	.uleb128 0x14
+	.long	0x341
+	.byte	0x2d
+	.byte	0x8
+	.uleb128 0xa
+	.long	.LASF1848
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x20
+	.long	0x2f0
+	.uleb128 0x14
+	.long	0x2f5
+	.byte	0x2f
+	.byte	0x53
+	.uleb128 0xa
+	.long	.LASF1849
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x85
+	.long	0x1af
+	.uleb128 0x1e
+	.long	0x3e3
+	.byte	0xb2
+	.uleb128 0x1f
+	.long	0x3d0
+	.byte	0x31
+	.byte	0x19
+	.uleb128 0x3
+	.long	.LASF1850
+	.byte	0x3b
+	.byte	0x11
+	.long	0xab
+	.uleb128 0x3
+	.long	.LASF1851
+	.byte	0x3c
+	.byte	0x10
+	.long	0x93
+	.uleb128 0x3
+	.long	.LASF1831
+	.byte	0x3d
+	.byte	0x10
+	.long	0x93
+	.uleb128 0x3
+	.long	.LASF1852
+	.byte	0x3f
+	.byte	0x10
+	.long	0x93
+	.uleb128 0x3
+	.long	.LASF1853
+	.byte	0x40
+	.byte	0x10
+	.long	0x93
+	.uleb128 0x3
+	.long	.LASF1854
+	.byte	0x41
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF1855
+	.byte	0x89
+	.byte	0xc
+	.long	0x449
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1856
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x8
+	.byte	0xbd
+	.long	0x468
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1859
+	.byte	0x8
+	.byte	0xc0
+	.byte	0x3
+	.long	0x450
+	.uleb128 0x20
+	.long	.LASF1860
+	.byte	0x9
+	.value	0x13d
+	.byte	0x11
+	.long	0x83
+	.long	0x48b
+	.uleb128 0x6
+	.long	0xc3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1861
+	.byte	0x9
+	.byte	0x8c
+	.byte	0x39
+	.long	0xc3
+	.long	0x4a6
+	.uleb128 0x6
+	.long	0xc3
+	.uleb128 0x6
+	.long	0xc3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1862
+	.byte	0xa
+	.byte	0x60
+	.byte	0x9
+	.long	0x93
+	.long	0x4bc
+	.uleb128 0x6
+	.long	0x1e7
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1864
+	.byte	0xb
+	.byte	0x48
+	.byte	0x6
+	.long	0x4ce
+	.uleb128 0x6
+	.long	0xb7
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1880
+	.byte	0xf0
+	.long	0x4e4
+	.uleb128 0x3
+	.long	.LASF1863
+	.byte	0xf2
+	.byte	0x14
+	.long	0x93
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1865
+	.byte	0xdf
+	.byte	0x9
+	.long	0x93
+	.long	0x4ff
+	.uleb128 0x3
+	.long	.LASF1866
+	.byte	0xe1
+	.byte	0xd
+	.long	0x93
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1867
+	.byte	0xc7
+	.byte	0xa
+	.long	0xb7
+	.long	0x51a
+	.uleb128 0x3
+	.long	.LASF1868
+	.byte	0xc9
+	.byte	0x1d
+	.long	0x468
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1883
+	.byte	0xc3
+	.long	0x449
+	.uleb128 0x18
+	.long	.LASF1875
+	.byte	0xa5
+	.byte	0x11
+	.long	0xb7
+	.long	0x576
+	.uleb128 0x8
+	.long	.LASF1869
+	.byte	0xa5
+	.byte	0x33
+	.long	0x9f
+	.uleb128 0x8
+	.long	.LASF1870
+	.byte	0xa5
+	.byte	0x4d
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF1871
+	.byte	0xa5
+	.byte	0x64
+	.long	0x93
+	.uleb128 0x3
+	.long	.LASF1872
+	.byte	0xa7
+	.byte	0x14
+	.long	0x576
+	.uleb128 0x3
+	.long	.LASF1873
+	.byte	0xa8
+	.byte	0x10
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1874
+	.byte	0xa9
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0xe
+	.long	0x93
+	.long	0x586
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2f
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1876
+	.byte	0x8d
+	.byte	0x10
+	.long	0x93
+	.long	0x5cd
+	.uleb128 0x8
+	.long	.LASF1871
+	.byte	0x8d
+	.byte	0x33
+	.long	0x93
+	.uleb128 0x3
+	.long	.LASF1877
+	.byte	0x8f
+	.byte	0x14
+	.long	0x5cd
+	.uleb128 0x3
+	.long	.LASF1878
+	.byte	0x90
+	.byte	0x10
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1879
+	.byte	0x91
+	.byte	0x10
+	.long	0x449
+	.uleb128 0x3
+	.long	.LASF1874
+	.byte	0x92
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0xe
+	.long	0x93
+	.long	0x5dd
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1881
+	.byte	0x84
+	.long	0x5f3
+	.uleb128 0x8
+	.long	.LASF1882
+	.byte	0x84
+	.byte	0x28
+	.long	0xab
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1884
+	.byte	0x7f
+	.long	0x449
+	.uleb128 0x10
+	.long	.LASF1885
+	.byte	0x43
+	.byte	0x5
+	.long	0x449
+	.long	0x62f
+	.uleb128 0x22
+	.string	"dev"
+	.byte	0x8
+	.byte	0x43
+	.byte	0x1b
+	.long	0x62f
+	.uleb128 0x8
+	.long	.LASF1886
+	.byte	0x43
+	.byte	0x2d
+	.long	0x28a
+	.uleb128 0x3
+	.long	.LASF1887
+	.byte	0x47
+	.byte	0x12
+	.long	0x28a
+	.byte	0
+	.uleb128 0x7
+	.long	0x254
+	.uleb128 0x23
+	.long	.LASF1889
+	.byte	0x6
+	.byte	0x29
+	.byte	0x59
+	.long	0x640
+	.uleb128 0x7
+	.long	0x2f0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 28 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1151
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1191
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 39 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.file 40 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 41 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x29
+	.file 42 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 43 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x2b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1599
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4
+	.file 44 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 45 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1728
+	.byte	0x4
+	.file 46 "./src/main/drivers/barometer_bmp085.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.file 47 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x4
+	.file 48 "./src/main/drivers/barometer_bmp280.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 49 "./src/main/drivers/barometer_fake.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x31
+	.byte	0x4
+	.file 50 "./src/main/drivers/barometer_ms5611.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x32
+	.byte	0x4
+	.file 51 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1769
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1774
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1150
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1172
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1190
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1193
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1198
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1219
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1220
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1222
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1240
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1241
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1242
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1243
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1253
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1263
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1265
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1267
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1269
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1271
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1272
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1273
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1275
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1276
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1278
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1254
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1256
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1421
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1466
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1498
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1515
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1519
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1522
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1427
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1547
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1548
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1549
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1550
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1551
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1552
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1553
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1554
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1567
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1575
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1598
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1615
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1645
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1727
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1730
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.barometer_bmp280.h.20.12d0a75f7d7a90ce6a83e177a70ec71d,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1759
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1768
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1772
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1890
+	.long	.LASF1891
+	.long	.LASF1892
+	.long	.LASF1893
+	.long	.LASF1894
+	.long	.LASF1895
+	.long	.LASF1896
+	.long	.LASF1897
+	.long	.LASF1898
+	.long	.LASF1899
+	.long	.LASF1900
+	.long	.LASF1901
+	.long	.LASF1902
+	.long	.LASF1903
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x34
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1904
+	.byte	0xa
+	.long	.LASF1905
+	.byte	0xa
+	.long	.LASF1906
+	.byte	0xa
+	.long	.LASF1907
+	.byte	0x3
+	.long	.LASF1908
+	.byte	0x4
+	.long	.LASF1908
+	.byte	0x6
+	.long	.LASF1909
+	.byte	0x6
+	.long	.LASF1910
+	.byte	0x6
+	.long	.LASF1911
+	.byte	0xa
+	.long	.LASF1912
+	.byte	0x2
+	.long	.LASF1913
+	.byte	0x5
+	.long	.LASF1914
+	.byte	0xd
+	.long	.LASF1915
+	.byte	0xe
+	.long	.LASF1916
+	.byte	0xe
+	.long	.LASF1916
+	.byte	0xd
+	.long	.LASF1917
+	.byte	0xa
+	.long	.LASF1918
+	.byte	0xd
+	.long	.LASF1919
+	.byte	0xd
+	.long	.LASF1920
+	.byte	0xa
+	.long	.LASF1921
+	.byte	0xa
+	.long	.LASF1922
+	.byte	0xc
+	.long	.LASF1923
+	.byte	0xa
+	.long	.LASF1924
+	.byte	0xb
+	.long	.LASF1925
+	.byte	0xb
+	.long	.LASF1926
+	.byte	0xa
+	.long	.LASF1927
+	.byte	0xa
+	.long	.LASF1928
+	.byte	0xa
+	.long	.LASF1929
+	.byte	0xd
+	.long	.LASF1930
+	.byte	0xa
+	.long	.LASF1931
+	.byte	0xa
+	.long	.LASF1932
+	.byte	0xa
+	.long	.LASF1933
+	.byte	0xa
+	.long	.LASF1934
+	.byte	0xa
+	.long	.LASF1935
+	.byte	0xa
+	.long	.LASF1936
+	.byte	0xa
+	.long	.LASF1937
+	.byte	0xa
+	.long	.LASF1938
+	.byte	0xa
+	.long	.LASF1939
+	.byte	0xa
+	.long	.LASF1940
+	.byte	0x9
+	.long	.LASF1941
+	.byte	0x8
+	.long	.LASF1942
+	.byte	0x7
+	.long	.LASF1943
+	.byte	0xe
+	.long	.LASF1944
+	.byte	0x8
+	.long	.LASF1945
+	.byte	0x1
+	.long	.LASF1946
+	.byte	0x3
+	.long	.LASF1947
+	.byte	0x4
+	.long	.LASF1948
+	.byte	0x4
+	.long	.LASF1949
+	.byte	0x4
+	.long	.LASF1950
+	.byte	0x4
+	.long	.LASF1951
+	.byte	0x4
+	.long	.LASF1952
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1125:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF796:
+	.string	"__DECL_SIMD_logf "
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1300:
+	.string	"MATH_ERREXCEPT 2"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1029:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1535:
+	.string	"USE_FAKE_BARO "
+.LASF1121:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1454:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1304:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF1405:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1509:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1461:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1595:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF905:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1202:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF1328:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1829:
+	.string	"baro_s"
+.LASF1832:
+	.string	"baro_t"
+.LASF1455:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF833:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1548:
+	.string	"USE_PPM"
+.LASF1850:
+	.string	"calibratingB"
+.LASF1814:
+	.string	"calculate"
+.LASF1434:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1864:
+	.string	"sensorsSet"
+.LASF969:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF949:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF806:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1786:
+	.string	"char"
+.LASF1623:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1372:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF849:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1010:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1781:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1094:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1069:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1379:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF1856:
+	.string	"_Bool"
+.LASF931:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF764:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1528:
+	.string	"U_ID_2 2"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1846:
+	.string	"SENSOR_GPS"
+.LASF973:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1456:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF901:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1052:
+	.string	"__DECL_SIMD_exp"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1706:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1309:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1629:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1378:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF988:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1502:
+	.string	"_WCHAR_T "
+.LASF1257:
+	.string	"_Marg_ long double"
+.LASF870:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1228:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1776:
+	.string	"short unsigned int"
+.LASF1759:
+	.string	"T_SETUP_PRESSURE_MAX (10)"
+.LASF1763:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF902:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF810:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1501:
+	.string	"__WCHAR_T__ "
+.LASF1462:
+	.string	"USE_SENSOR_NAMES "
+.LASF1691:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF976:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1840:
+	.string	"detectedSensors"
+.LASF1341:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF954:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1810:
+	.string	"start_ut"
+.LASF907:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1647:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF769:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF794:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1789:
+	.string	"uint16_t"
+.LASF807:
+	.string	"__DECL_SIMD_expl "
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1087:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1668:
+	.string	"PG_RX_CONFIG 24"
+.LASF1130:
+	.string	"__DECL_SIMD_tanhf"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1445:
+	.string	"TELEMETRY_HOTT "
+.LASF927:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1096:
+	.string	"__DECL_SIMD_cbrt"
+.LASF1635:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1491:
+	.string	"_SIZE_T_DEFINED "
+.LASF1295:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF763:
+	.string	"_MATH_H 1"
+.LASF1592:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1278:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1471:
+	.string	"_T_PTRDIFF_ "
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1687:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF777:
+	.string	"__DECL_SIMD_sinl "
+.LASF1679:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF779:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1318:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF827:
+	.string	"__DECL_SIMD_acosl "
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1664:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1360:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1819:
+	.string	"BARO_MS5611"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF798:
+	.string	"__DECL_SIMD_logf16 "
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1607:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1168:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1411:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1826:
+	.string	"baro_cf_vel"
+.LASF1731:
+	.string	"BMP280_I2C_ADDR (0x76)"
+.LASF854:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1674:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1258:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF797:
+	.string	"__DECL_SIMD_logl "
+.LASF1365:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1749:
+	.string	"BMP280_OVERSAMP_1X (0x01)"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1303:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1142:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1128:
+	.string	"__DECL_SIMD_tanh"
+.LASF1034:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF929:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1393:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF771:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1881:
+	.string	"baroSetCalibrationCycles"
+.LASF1628:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF805:
+	.string	"__DECL_SIMD_exp "
+.LASF1015:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1140:
+	.string	"__DECL_SIMD_tan"
+.LASF880:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF897:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1219:
+	.string	"_Mdouble_"
+.LASF1787:
+	.string	"int32_t"
+.LASF1363:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1146:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1375:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF1076:
+	.string	"__DECL_SIMD_exp2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1357:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF1603:
+	.string	"FAST_MATH "
+.LASF1534:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1055:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1385:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1885:
+	.string	"baroDetect"
+.LASF1116:
+	.string	"__DECL_SIMD_atanh"
+.LASF989:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1511:
+	.string	"___int_wchar_t_h "
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1524:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1067:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF1762:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1573:
+	.string	"VTX_TRAMP"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1060:
+	.string	"__DECL_SIMD_acos"
+.LASF1833:
+	.string	"barometerConfig_System"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF546:
+	.string	"__always_inline"
+.LASF871:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF990:
+	.string	"__DECL_SIMD_erff64 "
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1750:
+	.string	"BMP280_OVERSAMP_2X (0x02)"
+.LASF903:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1197:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1684:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1220:
+	.string	"__MATH_PRECNAME"
+.LASF940:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1080:
+	.string	"__DECL_SIMD_exp10"
+.LASF1307:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1104:
+	.string	"__DECL_SIMD_log10"
+.LASF1796:
+	.string	"PGR_SIZE_MASK"
+.LASF1230:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1088:
+	.string	"__DECL_SIMD_expm1"
+.LASF872:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1073:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1223:
+	.string	"_Mdouble_ float"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1853:
+	.string	"baroGroundPressure"
+.LASF1753:
+	.string	"BMP280_OVERSAMP_16X (0x05)"
+.LASF1351:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1190:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF1570:
+	.string	"VTX_COMMON"
+.LASF1040:
+	.string	"__DECL_SIMD_sin"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1207:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1458:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1390:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1485:
+	.string	"_T_SIZE_ "
+.LASF1213:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF977:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1284:
+	.string	"__MATHCALL_NARROW"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1457:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1261:
+	.string	"_Mret_ _Float32"
+.LASF1205:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1112:
+	.string	"__DECL_SIMD_log1p"
+.LASF1878:
+	.string	"currentFilterSampleIndex"
+.LASF1241:
+	.string	"__MATHDECL_1"
+.LASF1113:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1097:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF1561:
+	.string	"TELEMETRY_HOTT"
+.LASF1849:
+	.string	"barometerConfig_Registry"
+.LASF1715:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1233:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF986:
+	.string	"__DECL_SIMD_erff "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1177:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1156:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1090:
+	.string	"__DECL_SIMD_expm1f"
+.LASF1424:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1639:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1110:
+	.string	"__DECL_SIMD_log2f"
+.LASF958:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF853:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1761:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF865:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF883:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1296:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1843:
+	.string	"SENSOR_BARO"
+.LASF994:
+	.string	"__DECL_SIMD_erff128x "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1752:
+	.string	"BMP280_OVERSAMP_8X (0x04)"
+.LASF1148:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1564:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1334:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF1359:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF1293:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1676:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1719:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1078:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1532:
+	.string	"ACC "
+.LASF1039:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1658:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1453:
+	.string	"TELEMETRY_IBUS "
+.LASF1432:
+	.string	"USE_PWM "
+.LASF890:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF966:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1133:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF1764:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF824:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1683:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1778:
+	.string	"long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1633:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1401:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF1477:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1641:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1396:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1772:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF919:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1782:
+	.string	"__uint16_t"
+.LASF1171:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF402:
+	.string	"false 0"
+.LASF891:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF858:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1588:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1877:
+	.string	"barometerFilterSamples"
+.LASF1611:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1512:
+	.string	"__INT_WCHAR_T_H "
+.LASF936:
+	.string	"__DECL_SIMD_log10f "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF861:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1314:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF830:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1275:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF1692:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1310:
+	.string	"M_E 2.7182818284590452354"
+.LASF1098:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF1000:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1601:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1732:
+	.string	"BMP280_DEFAULT_CHIP_ID (0x58)"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF793:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1105:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF862:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1298:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1836:
+	.string	"SENSOR_INDEX_ACC"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1268:
+	.string	"_Marg_ _Float128"
+.LASF1167:
+	.string	"__f32x(x) x ##f32x"
+.LASF879:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1201:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1321:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1246:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1282:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1720:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1775:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1271:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1253:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF953:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1182:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1726:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1730:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1135:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1478:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1889:
+	.string	"barometerConfig"
+.LASF1049:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF1677:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF364:
+	.string	"__k8 1"
+.LASF1660:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1180:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1791:
+	.string	"float"
+.LASF1391:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1655:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1631:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1530:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1710:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF987:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1549:
+	.string	"USE_PWM"
+.LASF1352:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1821:
+	.string	"baroSensor_e"
+.LASF1470:
+	.string	"_PTRDIFF_T "
+.LASF1578:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1806:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1037:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF1617:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1115:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF1402:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF944:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF781:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1743:
+	.string	"BMP280_TEMPERATURE_XLSB_REG (0xFC)"
+.LASF913:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1449:
+	.string	"USE_SERVOS "
+.LASF380:
+	.string	"__unix 1"
+.LASF1798:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF545:
+	.string	"__wur "
+.LASF1442:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1066:
+	.string	"__DECL_SIMD_atanf"
+.LASF1366:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF838:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1299:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1662:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1227:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1277:
+	.string	"_Mret_ _Float64x"
+.LASF1292:
+	.string	"FP_NORMAL 4"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1508:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF848:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1250:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1440:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1215:
+	.string	"_Mdouble_ double"
+.LASF1376:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF860:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF886:
+	.string	"__DECL_SIMD_coshf "
+.LASF967:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1395:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF959:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1869:
+	.string	"baroSampleCount"
+.LASF1746:
+	.string	"BMP280_PRESSURE_TEMPERATURE_CALIB_DATA_LENGTH (24)"
+.LASF1018:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF864:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1237:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1794:
+	.string	"PGR_PGN_MASK"
+.LASF1374:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF1157:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1214:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1217:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF918:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1522:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1682:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF774:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1429:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF937:
+	.string	"__DECL_SIMD_log10l "
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1419:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1765:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1340:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1717:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF814:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1138:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1584:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1159:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF765:
+	.string	"__DECL_SIMD_cos "
+.LASF1751:
+	.string	"BMP280_OVERSAMP_4X (0x03)"
+.LASF1208:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1398:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1111:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1756:
+	.string	"BMP280_MODE (BMP280_PRESSURE_OSR << 2 | BMP280_TEMPERATURE_OSR << 5 | BMP280_FORCED_MODE)"
+.LASF924:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF943:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF846:
+	.string	"__DECL_SIMD_asinf "
+.LASF1382:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF1698:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1800:
+	.string	"size"
+.LASF1431:
+	.string	"USE_PPM "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1837:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1342:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF1702:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1622:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1247:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1523:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1218:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1231:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1084:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF813:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF970:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF804:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1083:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF766:
+	.string	"__DECL_SIMD_cosf "
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1129:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF1154:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1626:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF799:
+	.string	"__DECL_SIMD_logf32 "
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1490:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1728:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1567:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1799:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1788:
+	.string	"uint8_t"
+.LASF1403:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF996:
+	.string	"__DECL_SIMD_tanhf "
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1183:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1602:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF1240:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1221:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF1838:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1855:
+	.string	"baroReady"
+.LASF1443:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF831:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1364:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF1119:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1343:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1137:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1023:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1005:
+	.string	"__DECL_SIMD_asinh "
+.LASF1404:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1604:
+	.string	"VERY_FAST_MATH "
+.LASF1273:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1729:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1513:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF892:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1495:
+	.string	"___int_size_t_h "
+.LASF1033:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1562:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1724:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1324:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF832:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1289:
+	.string	"FP_INFINITE 1"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1280:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1281:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF775:
+	.string	"__DECL_SIMD_sin "
+.LASF1529:
+	.string	"LED0_PIN NONE"
+.LASF1563:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1516:
+	.string	"_BSD_WCHAR_T_"
+.LASF1043:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1053:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF1136:
+	.string	"__DECL_SIMD_erfc"
+.LASF933:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1150:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1830:
+	.string	"BaroAlt"
+.LASF909:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1488:
+	.string	"_SIZE_T_ "
+.LASF1059:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF1294:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1871:
+	.string	"newPressureReading"
+.LASF1499:
+	.string	"__need_size_t"
+.LASF1141:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF1525:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1480:
+	.string	"__need_ptrdiff_t"
+.LASF818:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1854:
+	.string	"baroPressureSum"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1745:
+	.string	"BMP280_TEMPERATURE_CALIB_DIG_T1_LSB_REG (0x88)"
+.LASF1175:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1423:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF887:
+	.string	"__DECL_SIMD_coshl "
+.LASF1616:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1222:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1235:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1680:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1467:
+	.string	"_STDDEF_H "
+.LASF972:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1086:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1249:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF868:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1012:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1831:
+	.string	"baroTemperature"
+.LASF1407:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF803:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1754:
+	.string	"BMP280_PRESSURE_OSR (BMP280_OVERSAMP_8X)"
+.LASF1199:
+	.string	"FP_INT_UPWARD 0"
+.LASF1705:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1224:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1773:
+	.string	"PRESSURE_SAMPLES_MEDIAN 3"
+.LASF1670:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1590:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1634:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1569:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF839:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1675:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF921:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1811:
+	.string	"get_ut"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1493:
+	.string	"_SIZE_T_DECLARED "
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1151:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF898:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1813:
+	.string	"get_up"
+.LASF1185:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1805:
+	.string	"baroCalculateFuncPtr"
+.LASF1409:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1718:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1559:
+	.string	"LED_STRIP"
+.LASF922:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1103:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1149:
+	.string	"__f128(x) x ##f128"
+.LASF978:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1226:
+	.string	"_Mdouble_ long double"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1748:
+	.string	"BMP280_OVERSAMP_SKIPPED (0x00)"
+.LASF1845:
+	.string	"SENSOR_SONAR"
+.LASF1045:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1555:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1019:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1556:
+	.string	"USE_SERIALRX_SUMH"
+.LASF930:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1061:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF847:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1444:
+	.string	"TELEMETRY_FRSKY "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1026:
+	.string	"__DECL_SIMD_tanf "
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1716:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1842:
+	.string	"SENSOR_ACC"
+.LASF1739:
+	.string	"BMP280_PRESSURE_LSB_REG (0xF8)"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1353:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF1801:
+	.string	"address"
+.LASF1615:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1350:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1554:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1262:
+	.string	"_Marg_ _Float32x"
+.LASF767:
+	.string	"__DECL_SIMD_cosl "
+.LASF885:
+	.string	"__DECL_SIMD_cosh "
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1186:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1209:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1643:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1518:
+	.string	"NULL"
+.LASF1859:
+	.string	"barometerState_e"
+.LASF1225:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1498:
+	.string	"__size_t "
+.LASF1648:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1500:
+	.string	"__wchar_t__ "
+.LASF1632:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1581:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1188:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1410:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF499:
+	.string	"__PMT"
+.LASF1514:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF1387:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1576:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1886:
+	.string	"baroHardwareToUse"
+.LASF993:
+	.string	"__DECL_SIMD_erff64x "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1694:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1426:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1313:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1575:
+	.string	"USE_RESOURCE_MGMT"
+.LASF946:
+	.string	"__DECL_SIMD_log2f "
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1361:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1371:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF995:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1768:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1435:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1852:
+	.string	"baroGroundAltitude"
+.LASF1797:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1147:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1652:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF971:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1108:
+	.string	"__DECL_SIMD_log2"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1370:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF1384:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1123:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1620:
+	.string	"UNIT_TESTED "
+.LASF1651:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF935:
+	.string	"__DECL_SIMD_log10 "
+.LASF1586:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF844:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1738:
+	.string	"BMP280_PRESSURE_MSB_REG (0xF7)"
+.LASF1506:
+	.string	"_WCHAR_T_ "
+.LASF1274:
+	.string	"_Mret_ _Float64"
+.LASF1050:
+	.string	"__DECL_SIMD_logf"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1063:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1645:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF843:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1888:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1757:
+	.string	"T_INIT_MAX (20)"
+.LASF1163:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1646:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1879:
+	.string	"medianFilterReady"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1422:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF1484:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1234:
+	.string	"_Mdouble_ _Float128"
+.LASF1344:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF1722:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1014:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1389:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1392:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF961:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1741:
+	.string	"BMP280_TEMPERATURE_MSB_REG (0xFA)"
+.LASF1106:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1441:
+	.string	"BLACKBOX "
+.LASF1437:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1875:
+	.string	"recalculateBarometerTotal"
+.LASF1408:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF1771:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF957:
+	.string	"__DECL_SIMD_log1pl "
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF884:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF789:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1520:
+	.string	"__need_NULL"
+.LASF962:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1283:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1236:
+	.string	"_Mdouble_ _Float32x"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF1131:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF906:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1191:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF851:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF819:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF950:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1558:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF835:
+	.string	"__DECL_SIMD_atan "
+.LASF881:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1585:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1242:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1038:
+	.string	"__DECL_SIMD_cosf"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1265:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1451:
+	.string	"CMS "
+.LASF1802:
+	.string	"reset"
+.LASF1100:
+	.string	"__DECL_SIMD_atan2"
+.LASF1690:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1653:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF869:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1251:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF852:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1256:
+	.string	"__MATHCALL_NAME"
+.LASF955:
+	.string	"__DECL_SIMD_log1p "
+.LASF1825:
+	.string	"baro_noise_lpf"
+.LASF1027:
+	.string	"__DECL_SIMD_tanl "
+.LASF882:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1857:
+	.string	"BAROMETER_NEEDS_SAMPLES"
+.LASF1693:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1243:
+	.string	"__MATHDECL"
+.LASF981:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1354:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF1099:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1779:
+	.string	"signed char"
+.LASF1164:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1624:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF800:
+	.string	"__DECL_SIMD_logf64 "
+.LASF783:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF899:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF1481:
+	.string	"__size_t__ "
+.LASF1447:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1286:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1448:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1527:
+	.string	"U_ID_1 1"
+.LASF904:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1179:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1134:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1547:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1510:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1661:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1114:
+	.string	"__DECL_SIMD_log1pf"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1700:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1707:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF979:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1600:
+	.string	"sq(x) ((x)*(x))"
+.LASF795:
+	.string	"__DECL_SIMD_log "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1081:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1734:
+	.string	"BMP280_RST_REG (0xE0)"
+.LASF1065:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1166:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1489:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1189:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1381:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF1446:
+	.string	"TELEMETRY_LTM "
+.LASF1416:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF947:
+	.string	"__DECL_SIMD_log2l "
+.LASF1492:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1669:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1048:
+	.string	"__DECL_SIMD_log"
+.LASF1844:
+	.string	"SENSOR_MAG"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1790:
+	.string	"uint32_t"
+.LASF1155:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1064:
+	.string	"__DECL_SIMD_atan"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1589:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1673:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1259:
+	.string	"_Mret_ double"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1868:
+	.string	"state"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1255:
+	.string	"_Marg_"
+.LASF1006:
+	.string	"__DECL_SIMD_asinhf "
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1118:
+	.string	"__DECL_SIMD_atanhf"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1008:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1469:
+	.string	"_ANSI_STDDEF_H "
+.LASF1723:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF791:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1795:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1659:
+	.string	"PG_PID_PROFILE 14"
+.LASF1054:
+	.string	"__DECL_SIMD_expf"
+.LASF923:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1051:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1711:
+	.string	"PG_PPM_CONFIG 507"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1316:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1766:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1320:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1579:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1733:
+	.string	"BMP280_CHIP_ID_REG (0xD0)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1269:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF792:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1725:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF951:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF1165:
+	.string	"__f32(x) x ##f32"
+.LASF1627:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1290:
+	.string	"FP_ZERO 2"
+.LASF1824:
+	.string	"baro_sample_count"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF808:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1630:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1876:
+	.string	"applyBarometerMedianFilter"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1068:
+	.string	"__DECL_SIMD_asin"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF952:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1450:
+	.string	"GPS "
+.LASF1769:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1089:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1176:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1203:
+	.string	"FP_INT_TONEAREST 4"
+.LASF1672:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1755:
+	.string	"BMP280_TEMPERATURE_OSR (BMP280_OVERSAMP_1X)"
+.LASF1785:
+	.string	"long int"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1072:
+	.string	"__DECL_SIMD_hypot"
+.LASF1665:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1042:
+	.string	"__DECL_SIMD_sinf"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1818:
+	.string	"BARO_BMP085"
+.LASF948:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1709:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1612:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF984:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF911:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1736:
+	.string	"BMP280_CTRL_MEAS_REG (0xF4)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF960:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1452:
+	.string	"TELEMETRY_CRSF "
+.LASF1474:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF1358:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1847:
+	.string	"SENSOR_GPSMAG"
+.LASF1860:
+	.string	"lrintf"
+.LASF1473:
+	.string	"__PTRDIFF_T "
+.LASF1465:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF912:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1210:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1656:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1804:
+	.string	"baroOpFuncPtr"
+.LASF1870:
+	.string	"pressureTotal"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF915:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1566:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1216:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1487:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1044:
+	.string	"__DECL_SIMD_sincos"
+.LASF1526:
+	.string	"U_ID_0 0"
+.LASF1117:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1127:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1169:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1319:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF945:
+	.string	"__DECL_SIMD_log2 "
+.LASF1192:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1521:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF964:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1413:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1170:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1245:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1181:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF974:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1608:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1356:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF1708:
+	.string	"PG_PID_CONFIG 504"
+.LASF1003:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1335:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1172:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF815:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1560:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1302:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1315:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1206:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1688:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1642:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1503:
+	.string	"_T_WCHAR_ "
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1400:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1593:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF784:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1369:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1515:
+	.string	"__DEFINED_wchar_t "
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1689:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1427:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1867:
+	.string	"baroUpdate"
+.LASF1880:
+	.string	"performBaroCalibrationCycle"
+.LASF1537:
+	.string	"USE_FAKE_MAG "
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1058:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1574:
+	.string	"BLACKBOX"
+.LASF1071:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1248:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF941:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1577:
+	.string	"USE_DSHOT"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1001:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1158:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1397:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF938:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1348:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF1552:
+	.string	"USE_SERIALRX_IBUS"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF855:
+	.string	"__DECL_SIMD_hypot "
+.LASF1193:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1760:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1415:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF895:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1276:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF1827:
+	.string	"baro_cf_alt"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF876:
+	.string	"__DECL_SIMD_exp10f "
+.LASF770:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF942:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF834:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1727:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1198:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF1557:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1460:
+	.string	"USE_RX_MSP "
+.LASF401:
+	.string	"true 1"
+.LASF772:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1036:
+	.string	"__DECL_SIMD_cos"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF826:
+	.string	"__DECL_SIMD_acosf "
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1346:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF812:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1009:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1883:
+	.string	"isBaroReady"
+.LASF1317:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1074:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1737:
+	.string	"BMP280_CONFIG_REG (0xF5)"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1882:
+	.string	"calibrationCyclesRequired"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1153:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1758:
+	.string	"T_MEASURE_PER_OSRS_MAX (37)"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF821:
+	.string	"__DECL_SIMD_powf128 "
+.LASF914:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1085:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1425:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1550:
+	.string	"SERIAL_RX"
+.LASF1599:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1091:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1681:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1021:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF850:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1519:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF982:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1580:
+	.string	"USE_PROFILE "
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1686:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1572:
+	.string	"VTX_SMARTAUDIO"
+.LASF1436:
+	.string	"USE_SERIALRX_SBUS "
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1618:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1107:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF1553:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1338:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1075:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1022:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF788:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF809:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1254:
+	.string	"_Mret_"
+.LASF1767:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1823:
+	.string	"baro_hardware"
+.LASF1517:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1174:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1472:
+	.string	"_T_PTRDIFF "
+.LASF840:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1032:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF975:
+	.string	"__DECL_SIMD_acosh "
+.LASF1770:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1139:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1031:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1399:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1533:
+	.string	"USE_FAKE_ACC "
+.LASF1822:
+	.string	"barometerConfig_s"
+.LASF1828:
+	.string	"barometerConfig_t"
+.LASF1337:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF1744:
+	.string	"BMP280_FORCED_MODE (0x01)"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1285:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1417:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1196:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1288:
+	.string	"FP_NAN 0"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1161:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF932:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF888:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF985:
+	.string	"__DECL_SIMD_erf "
+.LASF1312:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1077:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF1368:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF801:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1122:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1325:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF1851:
+	.string	"baroPressure"
+.LASF1020:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1101:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF1663:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1047:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1394:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1200:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF825:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1187:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1774:
+	.string	"PRESSURE_SAMPLE_COUNT (barometerConfig()->baro_sample_count - 1)"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF920:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF802:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1109:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF1636:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1808:
+	.string	"ut_delay"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1701:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1428:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1266:
+	.string	"_Marg_ _Float64x"
+.LASF1414:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1637:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1057:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1438:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1792:
+	.string	"double"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF828:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1721:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF925:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1873:
+	.string	"currentSampleIndex"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1367:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF1062:
+	.string	"__DECL_SIMD_acosf"
+.LASF1120:
+	.string	"__DECL_SIMD_acosh"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1625:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1531:
+	.string	"USE_FAKE_GYRO "
+.LASF1866:
+	.string	"BaroAlt_tmp"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF998:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1649:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1002:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1507:
+	.string	"_BSD_WCHAR_T_ "
+.LASF873:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1594:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1311:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1783:
+	.string	"__int32_t"
+.LASF1194:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1297:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1784:
+	.string	"__uint32_t"
+.LASF836:
+	.string	"__DECL_SIMD_atanf "
+.LASF1610:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1013:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1178:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF910:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1666:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1614:
+	.string	"Q12 (1 << 12)"
+.LASF1412:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF1430:
+	.string	"USE_CLI "
+.LASF1184:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF1126:
+	.string	"__DECL_SIMD_erff"
+.LASF1834:
+	.string	"baro"
+.LASF1459:
+	.string	"USE_MSP_PUSH "
+.LASF1816:
+	.string	"BARO_DEFAULT"
+.LASF1263:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1695:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1420:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1079:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1211:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF963:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF816:
+	.string	"__DECL_SIMD_powf "
+.LASF1308:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1504:
+	.string	"_T_WCHAR "
+.LASF822:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1497:
+	.string	"_SIZET_ "
+.LASF1820:
+	.string	"BARO_BMP280"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF991:
+	.string	"__DECL_SIMD_erff128 "
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1468:
+	.string	"_STDDEF_H_ "
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF845:
+	.string	"__DECL_SIMD_asin "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1740:
+	.string	"BMP280_PRESSURE_XLSB_REG (0xF9)"
+.LASF1035:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF1812:
+	.string	"start_up"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1244:
+	.string	"__MATHCALL"
+.LASF939:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1007:
+	.string	"__DECL_SIMD_asinhl "
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1568:
+	.string	"USE_DASHBOARD"
+.LASF1671:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1418:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1305:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF992:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1464:
+	.string	"VTX_CONTROL "
+.LASF965:
+	.string	"__DECL_SIMD_atanh "
+.LASF778:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1362:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF1667:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1204:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF877:
+	.string	"__DECL_SIMD_exp10l "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1606:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1475:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1143:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF1070:
+	.string	"__DECL_SIMD_asinf"
+.LASF1132:
+	.string	"__DECL_SIMD_asinh"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1092:
+	.string	"__DECL_SIMD_sinh"
+.LASF894:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF856:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1030:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1095:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF790:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF841:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1267:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF1291:
+	.string	"FP_SUBNORMAL 3"
+.LASF1160:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1238:
+	.string	"_Mdouble_ _Float64x"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1330:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1807:
+	.string	"baroDev_s"
+.LASF1815:
+	.string	"baroDev_t"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF934:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF820:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1333:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF786:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1793:
+	.string	"pgn_t"
+.LASF1713:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1145:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1862:
+	.string	"quickMedianFilter3"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF842:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1536:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF866:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF782:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1173:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1144:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1544:
+	.string	"USE_UART7 "
+.LASF1735:
+	.string	"BMP280_STAT_REG (0xF3)"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1486:
+	.string	"_T_SIZE "
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF983:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1587:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1229:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1650:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF956:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1644:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1339:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1041:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1609:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF893:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF900:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1345:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1004:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1654:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF875:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1596:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF889:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF863:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1421:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF980:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF780:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1323:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1028:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1406:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1162:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF823:
+	.string	"__DECL_SIMD_powf64x "
+.LASF773:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1619:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1582:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1082:
+	.string	"__DECL_SIMD_exp10f"
+.LASF837:
+	.string	"__DECL_SIMD_atanl "
+.LASF1545:
+	.string	"USE_UART8 "
+.LASF1264:
+	.string	"_Marg_ _Float64"
+.LASF1016:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1252:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1476:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF968:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF874:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF908:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1865:
+	.string	"baroCalculateAltitude"
+.LASF829:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1326:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1331:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1272:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1380:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF916:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1093:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF817:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1874:
+	.string	"nextSampleIndex"
+.LASF1355:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF999:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1848:
+	.string	"pgResetTemplate_barometerConfig"
+.LASF1640:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1583:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1232:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1699:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1347:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1621:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1809:
+	.string	"up_delay"
+.LASF1613:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1841:
+	.string	"SENSOR_GYRO"
+.LASF1239:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1494:
+	.string	"__DEFINED_size_t "
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1433:
+	.string	"SERIAL_RX "
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1551:
+	.string	"USE_SERIALRX_CRSF"
+.LASF896:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1538:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1742:
+	.string	"BMP280_TEMPERATURE_LSB_REG (0xFB)"
+.LASF1863:
+	.string	"savedGroundPressure"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1591:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1714:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1322:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1373:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1546:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1306:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF857:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF768:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1439:
+	.string	"USE_SERIALRX_SUMH "
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1887:
+	.string	"baroHardware"
+.LASF1496:
+	.string	"_GCC_SIZE_T "
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1539:
+	.string	"USE_UART2 "
+.LASF1463:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1466:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1597:
+	.string	"__disable_irq() "
+.LASF1884:
+	.string	"isBaroCalibrationComplete"
+.LASF1124:
+	.string	"__DECL_SIMD_erf"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1377:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1571:
+	.string	"VTX_CONTROL"
+.LASF787:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1260:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1839:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1329:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF1780:
+	.string	"short int"
+.LASF1685:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1872:
+	.string	"barometerSamples"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF867:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1332:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1540:
+	.string	"USE_UART3 "
+.LASF1212:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1696:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1505:
+	.string	"__WCHAR_T "
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1327:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1102:
+	.string	"__DECL_SIMD_atan2f"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1482:
+	.string	"__SIZE_T__ "
+.LASF1056:
+	.string	"__DECL_SIMD_pow"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1697:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1270:
+	.string	"_Mret_ _Float32x"
+.LASF1704:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1605:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF1386:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF1025:
+	.string	"__DECL_SIMD_tan "
+.LASF1598:
+	.string	"__enable_irq() "
+.LASF1777:
+	.string	"unsigned int"
+.LASF1835:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1541:
+	.string	"USE_UART4 "
+.LASF859:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1024:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1287:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF926:
+	.string	"__DECL_SIMD_atan2f "
+.LASF785:
+	.string	"__DECL_SIMD_sincos "
+.LASF1678:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF997:
+	.string	"__DECL_SIMD_tanhl "
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1712:
+	.string	"PG_PWM_CONFIG 508"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1747:
+	.string	"BMP280_DATA_FRAME_SIZE (6)"
+.LASF1336:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF878:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1858:
+	.string	"BAROMETER_NEEDS_CALCULATION"
+.LASF776:
+	.string	"__DECL_SIMD_sinf "
+.LASF1803:
+	.string	"pgRegistry_t"
+.LASF928:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF811:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1349:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1542:
+	.string	"USE_UART5 "
+.LASF1861:
+	.string	"powf"
+.LASF1657:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1483:
+	.string	"_SIZE_T "
+.LASF1817:
+	.string	"BARO_NONE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF1565:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1195:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1017:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1703:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1046:
+	.string	"__DECL_SIMD_sincosf"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1152:
+	.string	"__HAVE_FLOAT16 0"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1479:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1638:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1301:
+	.string	"math_errhandling 0"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1011:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1388:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1543:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1383:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF917:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1948:
+	.string	"io_types.h"
+.LASF1937:
+	.string	"mathcalls-helper-functions.h"
+.LASF1929:
+	.string	"math.h"
+.LASF1923:
+	.string	"long-double.h"
+.LASF1940:
+	.string	"platform.h"
+.LASF1911:
+	.string	"mathcalls.h"
+.LASF1893:
+	.string	"src/main/drivers"
+.LASF1931:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1917:
+	.string	"libc-header-start.h"
+.LASF1901:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1930:
+	.string	"math-vector.h"
+.LASF1905:
+	.string	"stdint-intn.h"
+.LASF1942:
+	.string	"target.h"
+.LASF0:
+	.string	"./src/main/sensors/barometer.c"
+.LASF1900:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1903:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1924:
+	.string	"stubs.h"
+.LASF1896:
+	.string	"src/main/target/SITL"
+.LASF1921:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1935:
+	.string	"fp-logb.h"
+.LASF1899:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1938:
+	.string	"mathcalls-narrow.h"
+.LASF1919:
+	.string	"features-time64.h"
+.LASF1904:
+	.string	"types.h"
+.LASF1952:
+	.string	"system.h"
+.LASF1932:
+	.string	"floatn.h"
+.LASF1913:
+	.string	"runtime_config.h"
+.LASF1915:
+	.string	"stdbool.h"
+.LASF1902:
+	.string	"/usr/include"
+.LASF1890:
+	.string	"src/main/build"
+.LASF1933:
+	.string	"floatn-common.h"
+.LASF1941:
+	.string	"common.h"
+.LASF1926:
+	.string	"typesizes.h"
+.LASF1891:
+	.string	"src/main/common"
+.LASF1918:
+	.string	"features.h"
+.LASF1950:
+	.string	"barometer_fake.h"
+.LASF1909:
+	.string	"sensors.h"
+.LASF1927:
+	.string	"time64.h"
+.LASF1939:
+	.string	"iscanonical.h"
+.LASF1906:
+	.string	"stdint-uintn.h"
+.LASF1897:
+	.string	"src/main/target"
+.LASF1910:
+	.string	"barometer.c"
+.LASF1892:
+	.string	"src/main/config"
+.LASF1908:
+	.string	"barometer.h"
+.LASF1895:
+	.string	"src/main/sensors"
+.LASF1934:
+	.string	"flt-eval-method.h"
+.LASF1898:
+	.string	"src/main"
+.LASF1949:
+	.string	"barometer_bmp280.h"
+.LASF1946:
+	.string	"parameter_group_ids.h"
+.LASF1928:
+	.string	"wchar.h"
+.LASF1936:
+	.string	"fp-fast.h"
+.LASF1951:
+	.string	"barometer_ms5611.h"
+.LASF1894:
+	.string	"src/main/fc"
+.LASF1912:
+	.string	"maths.h"
+.LASF1922:
+	.string	"cdefs.h"
+.LASF1916:
+	.string	"stdint.h"
+.LASF1945:
+	.string	"build_config.h"
+.LASF1943:
+	.string	"stddef.h"
+.LASF1925:
+	.string	"stubs-64.h"
+.LASF1920:
+	.string	"wordsize.h"
+.LASF1947:
+	.string	"barometer_bmp085.h"
+.LASF1944:
+	.string	"common_post.h"
+.LASF1907:
+	.string	"parameter_group.h"
+.LASF1914:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375 \ri"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b"
+	.string	""
+	.string	""
+	.string	"\025"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"\005\b"
+	.string	"\364\nx\001"
+	.string	"\034"
+	.string	"\367\255\350\337\016\n\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002"
+	.string	"\002\002\001\352\263\360\321\b\002\003\240\342\234\212\n\004\205\320\323\240\004\016\002"
+	.string	"\002\003\005\006\007\b\253\240\306\374\t\022\002\004\002\005\006\002\005\007\002\007\002\b\002\t\n\002\n\002\013\002\005\t\n\013\f\r\016\017\223\216\323\207\002\002\002\b\002\f\021\200\333\377\224\002\002\002\013\002\013\022\023\265\372\210\203\b\024\350\300\306\254\005\002\025\367\340\312\251\r\n\013\002\005\026\323\351\272\225\003\022"
+	.string	"\005\002\r\002\t\027\030\271\271\257\254\001\024\013"
+	.string	"\002"
+	.string	"\031\364\201\355\242\016\032\033\351\301\232\333\016\034\305\302\234\303\r"
+	.string	"$ P\002s\350z~\201\301\334\033A7"
+	.string	"\"\317J\334\273\f[\323\"x\302\262\005\002#\001\020#\200\376\314u\315\320\255\214\225\366\335\246\261\213Dw"
+	.ascii	"\215QI\234\267m\333Xq\254c\261\211\254\2347\326\001\367\022\244"
+	.ascii	"\364\3435>\302\2122\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375 hu\002"
+	.string	"4\003\\"
+	.string	"\n"
+	.string	"\001\003"
+	.string	"\002\004\003"
+	.string	""
+	.string	"\001\003\001\001\002"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\001\017\002"
+	.string	"\020"
+	.string	"\007\003"
+	.string	"\001\021"
+	.string	"\003\023\001\024"
+	.string	"\003\025\026"
+	.string	""
+	.string	""
+	.string	"\030"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"Q\211\030\r \204\320\\\235)\312*g7\247M8K\277\204\261\001,"
+	.text
+	.section	.gnu.lto_.inline.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`\034\001\275\b"
+	.string	"\"\216/4@o\222\016\034\215\016\234\350hd\270\025$m\265\347\f(\bP\357\367"
+	.ascii	"\352\321Y`\026\375>\265c\206U\321\231RO\224\315\236\3416Yc\r"
+	.ascii	"\267F\210\334)\267\021\211\305\305\b\245\003D\341\203\377z\375"
+	.ascii	"\007\334\365\260\2022?\r\375\006\321P&\305\302\233NOZ2\021LO"
+	.ascii	"\311D+\2315\006\377C\333GN+\370\373\330\221\266\036\003\372\316"
+	.ascii	"\241\251x\274\274N\355&2\363\363\256\210\357\220a\252*\201\035"
+	.ascii	"=\335(\341\030\241\256,\251j_\257I\231\210fd&\302\324\327k\t"
+	.ascii	"\3751\305q\304\332G\b\344\242\331=\376\002\355r\232\2319\275"
+	.ascii	"\247!\231\210e\323G\254\025&\032\030\326\003\\\202$ P\002a\004"
+	.ascii	"\263\003R\006`j\304.p`\207\212Y9\210\363\001\374\022p\n\300\022"
+	.ascii	"x~\f\214\023IR\037\366\301(\rT\304A,i\343\025\272\2215\353\310"
+	.ascii	"\016L\321\305\026\r\034c\241\210Ng\361\321\260 5\267\3563\254"
+	.ascii	"\334\221AV7;sp\020\257pC"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"]\005"
+	.string	"bI\036%\220E\351\340\351w'\322\206"
+	.string	"\264\242\356\264\177\001&3F\261\203|8b\215\355'\204@\302\326\337\266\226;\245\0245TL\001\210@\244V\221\031\360\220$\307\341\367\026zZ\247\320\264L\357\274X?;B\357\300>k\370\\ybK|\267q\347\352\032\266a\213,3s\265\201\242{\274/ws$\034\023\266\325\241\243eG\353.\3437\3257\271\314\325\227\243\262+\250\021\001\023"
+	.ascii	"F\271@*\n\\<\bF9\013cTb\203\353/=4\242M\005\233\324e\347L\n'"
+	.ascii	"I3\r\301\024t8\334\231\333\024S\004\026`\b"
+	.text
+	.section	.gnu.lto_.pureconst.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\230\004\004\230\004\b\230\004\017\230\004\021\204\004\023\230"
+	.ascii	"\004\024\204\004\025\230\004\026\230\004\030\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"e\005"
+	.string	"\002\307\024\036\260'\303\001\f\303"
+	.ascii	"\222$\220\206a\030\340\326\266-\261d\327\254\r\346,\242\320\366"
+	.ascii	"N2\005\372Q\316\0058,\355z\203Z\020\3154\301\0370\236\214-v\350"
+	.ascii	"\211Nvi\247\330%6\256O`Y\020\007\3620G]\362Dlt\312S\331\251\247"
+	.ascii	"z\005\256\021' p\0021\224u%\201p\271\212\210\200C\271n>\340\242"
+	.ascii	"\340>\270Ea\231\361X\246K\016\274^v9\360\242\227\252\320\205"
+	.ascii	"\201\244K`4\356\266p\017\221\205\"F\264\357]\326:\331\256\017"
+	.ascii	"\275\335X~\007C\205%\240\323\004b\270:\311K\036\337?p5\255\270"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.lto.e532ebac52cc6833,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_barometerConfig_Registry.12.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375 \210\025\004"
+	.string	"D\007O"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\303\257\334\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\364\005us"
+	.string	"\005\001\006'\001\020&(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/sensors/barometer.c"
+	.string	"\004"
+	.ascii	"K\205\220r\025D5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_barometerConfig.14.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375 mM\002"
+	.string	"\204\003`"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\004"
+	.string	""
+	.string	"\200\240\217\205\367\001\317\300\275\224\374\346\314\231\006\035\001\025\001?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\006"
+	.ascii	")B\3005\200Gpv\001\026\r\240\b"
+	.text
+	.section	.gnu.lto_baroDetect.21.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`\251\001\275\020"
+	.string	"&\240rF\360\356&\035\002\177\333\354'\316\277\2125\307at\230\265Y\256\364q\341\2352XnH^\202\325\352M\216f\f3:\210\302\227a\317CD;\356\317I\261&C\311\265\365h\342\263\030\200\f\353Cf\b\"{o\231R\\"
+	.string	"\\"
+	.string	"_"
+	.string	"\327Y\275D\205o\354\306F\004\355\206\t|\342>\035\236c\373\344.`\373\264m\324\202\225Y\017qhn3##\243\355\206]\364p\326eT\226\337\272\274\354\006rb\330\030\375\3002<J\017\026C2\032\260\030\331\021\333\200\024"
+	.ascii	"\006\243\232!\262\273\326\027\f\303=o{\304v\212\375Y\252\344"
+	.ascii	"\313"
+	.string	"^\2223C:ZU\262\303\226\306\033\373rw\3271f\177\347\227V\253T\237\013\t\242\275(`\264KS[\332\241\251\002\204\355\225/\263\206\311\006e\363\274p\255\013\334\317\t\232\331n\210\340\323\0168\223\006T\fob\365\235\027\003\330\355 D\302}zH\223\005\224\252}\022\001D&\225W\331l\b+\372\227=bb\313\332\003\203(\332\276\317S|\004pv\227\201\217\342?\022\374\017\237V\271\350_\237\276\313\366\251\367\212\355\363\257#\227\326\342\224\311\304pi\315!5\264\243\035iAd\021\327\2238\324|b\274\261\374\201M\306\006B1\232\344\001!\206d<\317Mj\\\001&Oe\362\225x`\212\002\n\230\"\331\360\311\007H\nJ\301\007\310\211c\202\207\022}r\002\275\026o\345\003S\017:\025\370\251X<U\307\242\222Z\351N@Uw\352\360\027\301\003\273\226\357\003;\215p/7\306\274\025-\365"
+	.string	"\305\237\265\025\271\350\001R\237\265i\234\261\255Q#\214}\236_\204N\r\322\314%3h\001\034"
+	.ascii	"5Y\345\264>h\f\256_h\002$>\230\205\026\331\200\257\005\0305\276"
+	.ascii	"\024\353\221d\253\225\023\004\n\032T\022\306\240Z\006\020\222"
+	.ascii	"\303\331\245\3161\3025\373l\302|\224,\027\"\003\341;5\n\2169"
+	.ascii	"O\2658\225\216<\255\202\002"
+	.text
+	.section	.gnu.lto_isBaroCalibrationComplete.22.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`\005"
+	.string	"\035\007"
+	.string	"R\31624`m\322\001"
+	.string	"\375\203Hj\006\221\206\330\217%\252\365Q\227\025\266\347m\001\335\032:v\240\331\335XH%\364.IV\202\205\232\240\241;\340\360\272%dK\231R\266P\242\225\261.0V\024\336\025\341\205\261\256\207Y\250\\\236%^\217\"`\310`\305\227\2010\276J\333\273\325\221\352\200G?\3665\324U\365\240\322'7\373\032\337\320\370\026n\330\344\263O\376\206\372t\r\b\201\360\344\346*b\223\304\326:\251\023\366\335\352\310vZ3}\007\360"
+	.string	"R\320\261\033\332J\366c*]\330\276\375\f\216]\371"
+	.string	"\201c\354\032)t\211\r\3041\262\253=\2558\366\304\374c\334\211\220<2Q\3479I\330]g&r\270\365\266\tl\033\330\246\b\007"
+	.ascii	"2\241U\037\370\003&@\327p\220!J\270\313\246v\222\001"
+	.text
+	.section	.gnu.lto_baroSetCalibrationCycles.23.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"M\t"
+	.string	"\026\222C=0\345(\035"
+	.string	"p\3739\360\247\031\376#\031Y\374\027q3\207\033\013'\260\007\205q\367e\033\366\007\324\306\"\370>\002\020%A\f\022\030\2050J\2306"
+	.string	"1\263VT3+\353\376{\247\024/"
+	.string	"1"
+	.string	"3"
+	.string	"\036\316g<\002\347\323\240\035\340!\312\376\345\321\361\032\260\273T\236\034|\004\375\273\274@\265B=\016@\354\256\243j\005r\313\333^\260]a\333\025\376fw\327\222e\277\365\307\215\301\b\r\203\200\335\217X\201\205M\231\025\333\357\330\035"
+	.string	"\0221\332gy\013\370\326\311s\267d&f7lpF\360y\360\036\006Wi\311\363*\355\204\373\315J\226'H`)\311\341(\375\227\273N\276\2127L\361\252O\337\304\371\364\244\204\244b\314\021F\244f#\001;DEi\342\336>\240\013\207\207\017(\363Xp\265\323\310\340(>N\264\231\"H^W\322j\250\023i[\202\267\254r%n\344U-D\277\352}$\356\243\244N\033\321\255~4Sp\b"
+	.ascii	"\207R\026eB\033_\340\301\005\030\227Q\254\325hp\227\027\355$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_applyBarometerMedianFilter.25.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`\254\002\325\025"
+	.string	"F\350\220J\300VQ:\320\365\310\233\235\260\252\213\b\327\3554\366\222\202\236H\3767\375S<\235\367!\t\376yJXLMO\025\374 z3S$@\214\3647'\221\275\177\334\340\201;\027\r\227\255\003w\213;U\377\375\331\"!d\313\224\002|"
+	.string	"r"
+	.string	"~"
+	.string	"4.x3b\036\372A\212\304\215\3674d\006Pk\212%\274Z\253\214[\247\207\266}\031\237\321\3012\360daCy@\361\341\206\224Z\253\313\345,\361!x\001\342C\272\342\262\213!HW\346\377\\\304y\021\245f+\361\020\204I\362\001ee\013\002Y!`\324<,8\342\024\204\271\021\031\261\262\321@\326\021\025L\256\373\202\260\001\355\252\330\324Z\2755\233\210[\345\266%\330\346\261\227\027\364D\267I\320\rh\233\354\023\335\206{\376\2205\270h_{\350\273H|xj"
+	.string	"\311\304l\233\214\022\342s\200\223\362\373\201\342\371\256{\003 IJ\277\272L\366\371\2634g\037\254T\310\366zu\032?\352\3445\370\363\246\342z\303\365W\006\b\335N\344n4\311YC4M\251F\341\217\030?\017.\335]\320\356\340\353\234J\351n\354\323=\027\332Ym\001HzNh\314S\271\241\017=\366D)\005a\233\342\322\034\"%\264]2o\251\n\211\311\307\243\245\205\211\335E\241\2669|\207\214\345\250\326\212\300\337]\007\314\037z\350\r$)><\320\342\304l\233\202\340\224~\32463\220\346n\212>\216\34701X\260 >d9z\242\332\031\211\371\317\2338\325\256\210\3570j7#Js\226\371\211\346\020!\321v\311\273\033r\242?\3572[&\023\370\003\031\306\235X\202\221B\005\330\213\201O\2061\266b\235\231\032\036\232\00235-V\204X\317\316k\\0\226\027Ls,q0\214\261"
+	.ascii	"\326i\225\243\317\b#\313W\216\313,I36\232\256X\317\013\346\322"
+	.ascii	")MW\253\305d\205\261t\371\220d\351J\235\365T\310\020\202@\024"
+	.ascii	"\275\356/\265pEA\220\332fF\201D\325\276\306{\344\313Q\255\263"
+	.ascii	"\327\212\3343a_[Q\0058\032\375\361N\020#\245\037\213\245$^Hs"
+	.ascii	"~0 P\"\"\007\357\300\320b\305\001[N\250y\367\200e\247\326\372"
+	.ascii	"\365\236\335\003\013\252\254ZL\002!\n'\307\214\"'\n\356\3342"
+	.ascii	"\264l\2400\354\026\023\211\323\344^\277\353\270\316cN;y,\326"
+	.ascii	"M\323oC\263Mv\221\205\377(i)/@\340\024\324\273\232\036\256UM"
+	.ascii	"\214=j?H\203c\254W\240D\030\232\274\253\305\227\217\274\\\244"
+	.ascii	"\367:\334\224\242\357\001"
+	.text
+	.section	.gnu.lto_recalculateBarometerTotal.26.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`K\003=\030"
+	.string	"&-\237I\260XQ:\300\324d|]\257V"
+	.string	"D\231R\0249\263\210y\244?X\fF\027\027\365\374c\3153\026\\|\f\351G\242M6z\034&m\246o\354J\374\302\345\246G\377\260_X|\007B\217g\223\317\366\177\311'\204\310\235R\212"
+	.string	"\177"
+	.string	"\213"
+	.ascii	"JPj\255/\017\255\243\3221\003\326\330\341qTk\205q\215\321\214"
+	.ascii	"\351\317\0360@\305\231(A3>T\271\230Yj+`\300s\243\016\336Z\205"
+	.ascii	"\230\034\325z\3028f|h\333\217q\031<\356\001\317\024:\325\256"
+	.ascii	"\007P\257J\255g\254\300]\304\207\340_\342\303E\361\236\203K{"
+	.ascii	"\374\367\016\276`1$\247\3639H\342\013\036\020*B\002\200\016\007"
+	.ascii	"\272\0341\321\344\275S\020\272\037JQ\016j\255\2469\335\210;\274"
+	.ascii	"\355\b\266q\366j\b\254\245N>\b\375\320'\3738\236\303I\276\n\327"
+	.ascii	"\034\204>\367\320w\020\361\341\027FI\320\215>y\365\242\305\252"
+	.ascii	"\350\007S\202b\245\251R'\373\364\241\273\263\017\326=a\303~\336"
+	.ascii	"\257\237\177\313k\374\256\033\375-\326yw\nE=.5\nE-.u\270\324"
+	.ascii	"\340R\357R\323\245\276\200\nEU\242 \240Rk\210',\325H\210\304"
+	.ascii	"\342\274\2134\244k\363\370=\257TKfl\236\223F\037\021\343\215"
+	.ascii	"]\224)\\q\017\224\345fo\270\220\2351)\334\024\322\r\b\270\006"
+	.ascii	"\210\202\226"
+	.string	"~\273\266=\374\307\216\200$\265\326\006\276\217\037\311|\025\263\231\3700L\3125\265\250km\f6\364\271\335\303\030\302\255\217\337;\r\223\b+M\251up\003w\367\f\242\277\343\276\f8e)>tI\"\205\345\243\361\362\363^\033\272\371f\374\276\"'ddwg\326\322\255\261\241\004G\257\270\265t\267\007P\026\352\213\361\253\324\311\254=\357\005n\324\311\b\376\r\034H\0134\b6\016$\315\205\201fcAFN\220\260C\322Znd\266\222\2064uj5\322\314iy\226@\346\202\202\005\tdb\\l4\235\362\001y\223\203#\243\340\362,\306$m$Ni\312jb5\263\254\321\310Z\214f#\303\211\315\314Z,\206\200\313\034\322\214\331\312\322\214\255\316z\260\356\t\037\311\322\223}\371jW\004\310\007emjA\330\206\255\314\320m\177L}S~K\003\210\202\242\300\306}-\254\b\265\343\315\225\210\240\326"
+	.string	"\021\022\323k\177\266\254\270\257\r< \240\242\2212\363\312\031)jv [*4J4\306\343\335\004\302a\214\200\t\225n\024\333\255\212\261\255\323\2706a%Ud\265\f\346H\036\336S\260\210\033)\365.\263\250|\332\2611\3250n\255"
+	.ascii	"O\216\350\346\016\030\236\250\205\261\363p\266\235\002,6LC\033"
+	.ascii	"\006\232o\256\301\300\237\200l(\fW\0342};\332\242\026#\326\226"
+	.ascii	"\217q\200\233\351o\347\243dAn\2560\216\013Y\302\225/\002\032"
+	.ascii	"cu\351\224B\354\001"
+	.text
+	.section	.gnu.lto_isBaroReady.27.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375 \361\245\006"
+	.string	"\262\214.3Pm\222\016\274&\203"
+	.string	"\"\2324\263"
+	.string	"GA)\3623\230[\333\323#=\376\337\355\260k#\264;xo\216\231\031\"\247\213t\346\211NS\2518\315\222-S[(\257\312T\027\353U\026\334\365\254\013S]\016\303P\2718\313\273\034e`\253\241z.cY\317QY\266\211\260\021t\332\303w\243\034\330\305\330A\203\365t\272\032\200N\330\004.&:X\232\242H\034\371\214\203\255\342;\311&\372ql\006\022\005)\311\374\224H\362c\362\310\3707O\215\220\260\031kf\361\351(\002\242C$3smT\254\210\335jtB\"\205x@\234b\200Bf\216\036P\250\267\376\005\377\301\037\n\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_baroUpdate.28.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`\353\001\005\020"
+	.string	"\226\234fF\360\222(\035*\201m\236\221U\354\032\332u\021\230"
+	.string	"vq\266$Ge\345\367\035\016\336-\035H\275su|\353\2570!*z\354\nu\375\037@r\344\031\031eD\323c\224\207\n\177\275VM}\r9{o)S\nR"
+	.string	"L"
+	.string	"Z"
+	.string	"(\333\343\247\270\n\224SP\366\372\344\214e%&gN\031g\340!\371\b/@>n\210\247\036\341j\312\017\371T\217[\313\341a\2079(d\264\276\226/\f\325|\270\341\371T \002W\r\016\240\217\245\n\200d\316im}\033ny\333\016l'\260\225\024\rnTT\307\376\212\313:\037\306\030P\364\255G\037E>~A:\254t\307 \023\207=\204V\302\306T\036\266\214\245\373b\037\316\005a[\375\221\352\315j\031\325\020\252\027\252u\325\007\201tj\026\314\346d\331\3511k\221\206\204\252\375X4\022D^3%\004^2\"\"f\274\2231B6:dv\302a\274p\261\261"
+	.string	"j]3pa\255\312\366\3503\222\310.\275E\311"
+	.string	"\2339\247\002\026\2171\361a\036]\301d\222\217\272\242\233\030\rf\224\215c{M\rs\316\003\037\332\211\232J}\350\fN\215\207\335\227_\220\337&\215x\245\224\222\251\363F\024\270\223\327\235NJ'\356\304dd\342H\336\211\033)\340\316B\311\343R\272\316\343<\262\325!\334\366\260\203\344\300q\355g\345f\260-\327$\253e\031\264#\212\324~"
+	.ascii	"A\337\332vW\345B\343#Z\256\0324\334\317~\345\207\035\341\001"
+	.ascii	"+ \220\202\231)\253\003\202\004l\230\363\n\362m\244\260\0274"
+	.ascii	"<\202c\f\353+\1774\236\265\034Bl\007\213\003n-\376\222\031G\343"
+	.ascii	"\032\b9<\265\3531\240#\026\216c$\231T\025w\326\302[\2501P\221"
+	.ascii	")\303[[\205\342\211\205\250-2#\352\323\224\213\\\boP4n\260\225"
+	.ascii	"\243x\020\223\321\\\020\n"
+	.text
+	.section	.gnu.lto_baroCalculateAltitude.29.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`Q\004\r\034"
+	.string	"&\264\262H\260XQ:@#\304%\f1\235D\342\340\006 \221\253\251\025\312\020\243\357\f\263I4w*\236R\311\355VO\3310\2552*N:\016\313\307\312\002\303\3272\3610\2206\3760W\366\247\260O\323\325\310C[\333\233\310\235R\225"
+	.string	"\223"
+	.string	"\240"
+	.string	"SZ\234\322+J\313\225>\355\325\003\n\003\250ZUT\205\251O\346\221\033\017\376\366\375\246;\331-\2338\223\267\005\225\326\247\337d\302n}\336>\341\013\335\222\241Z\360 \217%\264\202\005u\024d\252\326J\340\3235\326\247\317\343=N\230'2\331"
+	.string	"\322#!\321\223\227Z\253\215v\030\375\024\237C?\367\350\274Oq%\317_9\020\215\370\320\362\003\n}\272\2708\003t\361u\001\207DZ\255\365\302\313\024@\237\224+\007\265V\313\037\220\305Mo;\203\355\013\266X#S\356\225\\\t\372@\036\304\007\027\"\004\375\374\376\211f\030C\326Z\205v\215~\350l/\374M\023U\r*)W\206\344\027\373?\376\364\343'YDN\376\367\351\347\350\347leW^\364d\225\357\364\n,D\341\224\027\252\027\f9l\021\245J06\223O\256\221}\261n\221m\351\036\226\364L\366\340\035\233\322<+\351\035*\r\243\322:T:\207J\343P\351\033*mC\245_S\3325\245kV\3224T\272E\245g\250\264\f\225fQ\351\325J\323\225\236\001\323\265\005\220\2028d5\033[\331~T\362!y\022\036\005\013\026\350g\315\356\314\210\355\203\247\365$\030\323ll%\226"
+	.string	"\262\265\366\005\f\364?\232\245\r\021\025\345\250\265V\212\031\227d\326\303\327Z\345\314\212R\243\322\216\364\360NY\222h\204a\255\235A\003\375Ofi(V\310\036\336HH\257V7\250\252z2Tko\300jY+v\031\227\350\256vF\215Ss\277t\001D\215;\304\235\265\357\212;\213\032e\370d\225\345\356\236h\2147\274\b\007V\255C\t\374!'\322\301O\372\264\207\333\215>\3661\240"
+	.ascii	"\304\001\004\006\024\324`%rA\036\202F<\320\355n\020Z\366\251"
+	.ascii	"\355pA\270\234nw\373`\003\332\351\200H\340\200l$~n9\233\317\016"
+	.ascii	"\310V\353\261\256\004ng\013\322\351v\266\026S\357b\335\242\236"
+	.ascii	"\245\365\326g+<V\225\236\325A\n\366\206<&\201KM\341\261\301E"
+	.ascii	"\207h\236\215\302sY\201\362\337\226\336\362\254\354\002\333\321"
+	.ascii	"\331\233\205\355>\2152r\026guv&e\223\263\002\244F%\331\342l\254"
+	.ascii	"\3108e\263\257\275Y\0325.\371x>\036\305\023:\261\331C!\005]\373"
+	.ascii	"\332\0253N=x\023\036\253\326\232\300_r&\021$L\230@\037R\2501"
+	.ascii	"<\306\fb\306\031\032I#I+-\006\200\002\2311\233m\021\200\261d"
+	.ascii	"gR\271\035\311\226\022S\250\244xR:\201\032E\2112C\373\242t\204"
+	.ascii	"\220\221\322\204\251\n\205\022[\270\313\251(\224\226\306\300"
+	.ascii	"#21\177y\344\n\322h\214\261\227\277\356c\203\375\344\263\260"
+	.ascii	"N\\\333\300\216\333xit\253\207o\024V\213\333f\211\204\351Y6\233"
+	.ascii	"\322\230\037\373\241hQ\r\262\312\230\t\353\301x\266\2505\325"
+	.ascii	"\202\266\351XU$[DL<\002\341\250\021\321\206\356\264mwJ\210r\263"
+	.ascii	"zA\302\304\341\326\3504\365Q\002_\241\306\024\241N *\311\243"
+	.ascii	"\267\343\220\276\r|T"
+	.text
+	.section	.gnu.lto_performBaroCalibrationCycle.30.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`-\003\r\026"
+	.string	"\246\347\210I\320\322(\035\232\230\251Raju1ejJN\321\276\237\033}}\251\241\351\323\245\333\320N\355\\t\301\326N\370Ur\264\r\206\037\242mY\351h\211\251\031\324j\351#}\322\003\f\200\321\320~D\273\231\265}\262I\2222\005o"
+	.string	"i"
+	.string	"u"
+	.ascii	"k\324\327\247]\233v-\206k\371u\270\353\357zw\255'\254%$\004\275"
+	.ascii	"9-\004\227&P\026}\320U[U\256\261\225t\210g\352\211\0307<\035"
+	.ascii	"sN\330;h\215\312\360[c\325 E\345t6*q44\251\3149S:\034}h@\307"
+	.ascii	"\005\206\225\356\026\272\2208\310\320 \335\n:\333\256Ie\316\351"
+	.ascii	"\315\351.\250E\265\255\3006\212\375\r\001R>%Ih\034\241D\020^"
+	.ascii	"``D\224\244\355\035]\377\237\207\323\221\240\366\211\372\275"
+	.ascii	"\342\200l\033\264U\204\n\305X}<\233Y\315\251\264\316\210*\365"
+	.ascii	"\260\236\234q\203f\031m\317\007cn\017{\310\266\337\331\032\316"
+	.ascii	"9\247\277c\177m\"\256]\342\272\265\353\222]\223\310\365\210\\"
+	.ascii	"\213\3105K\256Wr\035\262k\220]\253\276N=\270\037\333\335\323"
+	.ascii	"9\347\212<\344\341@\264\326=%R\362\311\260\264\272\315\240\201"
+	.ascii	"\2509\326\tP\270\215\335\323]\212qN\247\004\203\300\333\234c"
+	.ascii	"\201\220\257\256\270\037\220\207<\364\341f\250\016r\323Ou\024"
+	.ascii	"\232\253\221\272\312\344\250\247\256?\352\347\235\036\336\344"
+	.ascii	"\362\207\0032\375\364R\361\246\007\370\311\213\327\233\037v\240"
+	.ascii	"&\036\234\346\274\035\260\226P\036\213\325G\245]d2Q\003vy\321"
+	.ascii	"d4\262\230\031\215\245\005V\243\315j2\262\032L\346\205%\006\346"
+	.ascii	"B\253\301^\003<\213 \243\301hf3\032L54\352w\034\363\001\034o"
+	.ascii	"\223\252\377\356\313\325\330\341\372Q0\2501\261u\227Q\353\256"
+	.ascii	"\244\234\034\313\002\007\222\206\360;\215\211\326\026\352\213"
+	.ascii	"%XY\021U\002\340\2711\366l\250\207\234\016\360\337\225\\\365"
+	.ascii	"\026\022I\267\345Q4\241\344'=9#\r\222\025\013FN\362b\334\340"
+	.ascii	"\315N\210\327\310\005\250\bI\250Q<\310\224Q\312\212\224Q\234"
+	.ascii	"j\003\200\002\231\261*\017\020H\253\2102\034c\260\365\232\031"
+	.ascii	"@\270\214\035g\305F\210\004j'K\225\220\001\235\004\027\027\251"
+	.ascii	"\312\2511\352\265\371\200.\031D\020\272\304\250w\221B\220U\346"
+	.ascii	"G\257\267#\360Y}\263(\r\231\330C\231\024q\313U\305\242\301\275"
+	.ascii	"V\342\031\205\323d9\373Z\001\357\034W\025\031j\250\306\231\034"
+	.ascii	"\272\341\254\270\333\315z\303\316\355\307\306\001\3414N|\013"
+	.ascii	"\222\206\207\212\204&\204\3472\346\337\023\365\375\355\257\264"
+	.ascii	"\t\250\025\246\037\311\177"
+	.text
+	.section	.gnu.lto_baroUpdate.part.0.44.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`o\003\275\026"
+	.string	"\026\250\215J\240TN:\326\350\234\022\034\323\357\232A\035\r\257z\005\277\"\254\232\202#\216(\222\225\346\364m\267\337\025:\2166\243\215\366\312\272\322t\267\231q\026\366l\370vzE 7\323`y\322\2469\374\202a\206n\333\244\021B\344N)t"
+	.string	"u"
+	.string	"}"
+	.ascii	"b-:\201C\n\232\302\202a\325\347L\260\342,t\2343\340\004\016-"
+	.ascii	"\370\020\025\364Y\336:?\035\200\310"
+	.string	"\252\251\326Z\273/\354\3315_\270c\327>>\365\202l\373N\017\356\330\024O\240\020\t\003\350\307EX\255\247\355\343\312O\310\217\342M\310\217K\342\346\227\212\246O\177B\276\357\205\027\303\234\250~BD\247%\027e.\265V\227\036\356\361\266\031\330\216\261\327*\024>\243\002\212Ms\0318\001Z\265\326\226\030\217\312\371I\037}\241\206\376\367\321\257Y\224-(\036:f\222\341\016\222\033Y\225\026ya\273g\357\330]%\260\006U\243\212\340\343\205\177\207a\025\226\217\212\321E\362\212\027\353\036\331%u\255\244\246\321\250g%u)\243\226\315\250\311\222z\224Q\213$\365\216\324t\244\276\211\211-X+\320\230\221j4J)\265\3509'\364\277rW6\254\317\344\312v\305~\216\330|\272\017SX\326\352\323\342\367x\226\203\007//\344Gr/\274\001\020!\260D<A\311\246F\374|\331eb\210\310\327\257\316\303\204"
+	.string	"\003C~\034wf%\343'y\346&\256\312V\221\027\001\372\363:\252b~\236\352V\326\312\363\237\217\3439dfn\364\277\033\371\321\253!\302\247$H\331\330+:\3415\2064\250U\t\365\327\r\214z\326g;\306\200c\331\345pr6\272\035\215\005\033o\247\343\335\344x\266\233\032\032\033\033n\307\263\261\250X\227!\267\263\341\350t;[\3156\275X\367\310\027~\346\005\206\202\322\266\266\034l\327\326.<\333c"
+	.string	"C\260\335E\262=[\332\376\304\273L\245\024 \027\256"
+	.ascii	"\020\310lSJ@\r\3112\227H_\353[\346\222\231\302d2\231\310\217"
+	.ascii	"'ZB\276\262\312\375\261\\\277 \007\250\270\343\312\3266U\230"
+	.ascii	"N\001I\2501D\207\024SfDf\002\t\206\0246c\240\242)\272s\0210A"
+	.ascii	"\251\210\2104\367?\0032NU\370\315\246o\217\265%\266\301\037u"
+	.ascii	"\034Z\b\362\032;\3635\"\341\325\206\027\375\227m+\370\003d~,"
+	.ascii	"\327\3527\362\313\211@1r\223A\254\006\356\243\311z\232\324\317"
+	.ascii	"+\237\006#\206\021R\263?\006\2047__\212\335\037\036K\220f %\317"
+	.ascii	"Nl\277\331\231P\273S\371M\254Q\314\224\207\215\217\214\357\275"
+	.ascii	"\376\005\236i\355\231\274\221\227\210\021\301\236\217\266\207"
+	.ascii	"G\2540\245\320o$\301\227\230)"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`\277\001%\013"
+	.string	"D\020\273\002"
+	.string	""
+	.string	""
+	.string	"\002\031\177!\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\200\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005$\"\200\204\001"
+	.string	""
+	.string	"\003\005%#&\021\002\032\177$\"%\030&#',\177(\204\202\202\200 \t)\201"
+	.string	"\005\020\024\021\025\005\024*\n+\201"
+	.string	"\005!,\002\025\177-\272\200\202\002"
+	.string	""
+	.string	""
+	.string	"\005\037.\002\026\177/\0170\027\1771\002\033\1772\002\034\1773\035\1774\005\0225\036\1776\005\0237\005*8\0169\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005\f:gistry"
+	.string	""
+	.string	"\001'\177;\377\037"
+	.string	""
+	.string	"\200\200\200\001 \177<)\177=(\177>\003"
+	.string	"\035\320\360\372\250\001\001\244\016\003\004\200\004\001\302\n\003\b\004\342\n\004\b\365\006\225\265\001\003\017\036\310\377\241\372\001\001\344\006\003\025\b\340\236\212\256\001\001\302\n\004\025\241\341\365\321\002\365\006\003\026 \201\001\204\n\003\026\037\344\022\003\030 \244\013"
+	.ascii	", \340\002!\252n\255Ac\256e\nR('\270\261~\271 \2700\210\204\206"
+	.ascii	"K\r\276z\030\034^@\bd\351\257\024,\313\237\364=\250\354\310\301"
+	.ascii	"\211:\266\353\216v\373/\3634\021\035C],\370\004k\013!xH5\004"
+	.ascii	"a\374\3628pI\332`i\344\3500\207\357b\254\222\303x\314D\031"
+	.text
+	.section	.gnu.lto_.refs.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375 \357\035\005"
+	.string	"\342M%%\240%I\007\377\377\377\377\377\377\377\377\371\377\374\277\365\377\377f\233m\3557K\254\265\2044Bv#\2044\262e\n7\3300"
+	.string	"/Pt\202\327\027\357\007^o\024\317,\335\300\364\243\275B\3760'\326\b\371\007\331\r\262\013\264o\362\227\345\263\375\201<z+y!\277\271\036\207\351\244\210\216\357COC\013=\221\257\270\236 \375\320\336!\337\3263\206\263\205\257|\225o\344\007{\201z\243^Q\017\200\036\241\272K\035\241\r5sp\005?i\177\247;\354\251\237\376\204\003"
+	.ascii	"I\024\306BP\236\240\230\001"
+	.text
+	.section	.gnu.lto_.decls.e532ebac52cc6833,"e",@progbits
+	.string	"(\265/\375`\323\"m\245"
+	.string	"\252\t]:Z0JI9\351\256\272\272\273\352\272\252\273\253S\367\375]\271;g\024\200\3478\3424\224\300\247\255\032\035-c\353\337\352\252\267\336\335\376\360U\221;R\202\373qD\b\307\341\337\376\327p\265P4U4i\024\025\faj\267h\001j}\315\352\250\206Y\253\330\215\356\315F\262\245L\001\023\003\215\003\250\003\274\354\244\276\357b\033A\200"
+	.string	"\261\303E\316\264"
+	.ascii	"b\315j\242\241\354\231\035s+,9\325\346\373h?\202\nKi\033\"\206"
+	.ascii	"\311\360\035\343q\030\036\303ex\311fx\313\331\t?\371N\372\021"
+	.ascii	"Z\202\214\210\302R\332\300\254\260\031\276\302s\fw\325\301\227"
+	.ascii	"W\334\024\226\322\366\305o\\\030\214\005IG\020\354\302\350\356"
+	.ascii	"M\317_\277\217\031\256\302Rj\332\302\275VX9E\264\300\030swo\n"
+	.ascii	"b\007D\016\330W\017&:&\333\3251\025\244\22100\330/u80\270\335"
+	.ascii	"0\266\311u7a\226\314\230\265\311t5\n\336\016c\233\007\363\303"
+	.ascii	"\t\323\272\322\326\346Y\026\214,0`\366\274e\317+X\226c,\274\364"
+	.ascii	"\300Y\316cl\3454\306\364\246\367\246\031\032\013oY\204\312\236"
+	.ascii	"=\364j^\036{\350\235\243\254\016\307\260\347\243\375\b\254\016"
+	.ascii	"o\3501\\\033\324\030\034U\332\274\007\3549`;\244\260\365\033"
+	.ascii	"\260\017\301\002\2330a\267\261\031Wm\236\227\314\244\315\\\332"
+	.ascii	"\270\252j\223\227\334v.7\367Z@\023\307"
+	.string	"\365\303l\t\233\217\252\t\013\027jJx\215F\n\225\2656o.s\350q\232\346sV\363\200U\262G\233=hI\332\210\013c\2156\317I~V\262\021>\353\344\275J\367\336\tn\322\314,\321h\223\311\030\006^~\t\233\235\2170\222\377\224\322\253\344\036L\212=\332\354\300\034z\246\003\354\r\360\\\366\rq\367npkO\270\367^\037\177I\357p\314\241w\303\033z<\346s.\262\241\207\214Jo\206\232\326\266d\246\315\346\r=\376b\261z|\221\274e\367\246\032|C\332\252\312\332d\261\3460N\317b\fv\021\033\374F\351~\335\233\262\230y\257\221\031\203\034f\fh\226\3700\026\351\231o\373\2249\364,o \363\200</$\302\200\031\363:>\003\342o\254S\360w\231\273\237\3150?\203\371\331\356K\235\b/\307\300\377\020\n\360\367\227\237Q\320\375\277\273\230\377K\376\233\241\371\177\246\013\227\267\375<"
+	.ascii	"\021&\370\273\207\371\367\026\r\266x\320\371\373\351g#Z\200\032"
+	.ascii	"8\315\337X\346\376#\240\335~^fa\003\334\202V\373\231\202\237"
+	.ascii	"9\374\274\363s\005?O\360s\324\377\336_G\374,\344g\260\237\303"
+	.ascii	"~\036\362\263\330\317D\260\374|\365\263\327\317]r\177e\361\363"
+	.ascii	"\225\237\331~6\373\231\354\347\261\237m\374\234\364"
+	.string	"\363\375Y\004?\207\340\347\025?\213\360\263\t?\243?\037\375\\\3643\007~V\3613\t?g\340\347\013\374l\201\237G\370\231\002?G\340g\020~\366\340\347\005\374\314\363s\002~>\361\337\356?\334\317&\376\257\375?\373\037\366_\204\377Y~.\361\363\006?\223\370Y\304\177.?\003\377#\371\331\303\317\032\376K\340\347\f~\356\3603\001~\026\300\317\277\237\355\317\276\237{\377\231\374g\373\237\344\177\372\037\305\377\005\374w\373\217\223\227\227\227\367\233\307\277\267\201\177\007J[=\337\022\370fr^6\223\366\352 *\275\305^SZT\b\237W\ne\246\274\331+\351%J\232\255w/\247\311\030\310_\336Z/Yk6\276H/\037\274\320E}`/\274\274\2466\233\255f\351\202\313j\363\2755\373\036\021[\303\006|\243\365\262\323\230\255\203\026\307{\241\200N\350zZ\366\275\034\326\206\235\361\262\317Xl\347\026\275"
+	.string	"\327\220q\310\273\236\f[\023\305l\331G\276\304\026\221\326\214E\023\272\336\265\247\231\2635VJe\227e\340\004\206wYo\231@`,\351j\263\311\032\252FM)eF\233m\244\267\272M)\227D\243fm\200"
+	.string	"Y\214\233HV\217\261X\207bzc\214\200LC\234F\314\236\006\313\332`\205e\265\330\227t\030\341\306!\203\\\344\rq\032({S\314T\177u\024&(E\254X!\226\351l\311f\203\364\225.S.\234u\345e\361\240\243\321\246\205\002\206`\216\341xZ\226\t\030\202\233\213\227\315\305gfz\237jb\244q\310\273\364C\273\360\263\362%GY\2337\273\254M\022\370\356\321Y\255\305I\370.!#\300b\212\356\"\221!n&\255\315\022\260Wh\2547\013\313f\241\177p\324-\326uXK\213C\336\335(\344\207\277}\274\177\360Y\206!Of_\316zX\270\250\230\252\330\277\377\3365\"\357\275P4\351E&\335\234i\230?\3748\\\271"
+	.ascii	"U\001t\367\202i\331\331-4#\216w\270\035\334b\020%\343\223\206"
+	.ascii	"\233^\344Q\251\243x4\022\367\244!\275T\023\\\245\325=\246:\236"
+	.ascii	"\314\344\355\233^\276J:\236<pL\223\310c\232,\352\\\245d\361\336"
+	.ascii	"\364I\347Xf,\362Q\251\343\351\250L>i\270J\267x\225F*\253\224"
+	.ascii	"|:>I>\351\034\225\306\247\243\222\216'\r_ZY9\232\246\030\357"
+	.ascii	"\270xT\2720\234\244\214H\035\270c\232\274r\367r\331\322E\026"
+	.ascii	"\340^\251$R\316X\203\323\222\340`$!1&9\275\367R\340\224T\225"
+	.ascii	"\274JpG\256\344\275\\I*\356%QL\341n\017\206+ZI\335\027K\367V"
+	.ascii	"\340to\221/\334\275\267x\357\365!\245\322{o\350\034\265\234\234"
+	.ascii	"\356\215\332q\272RE\265\245{\273,K\332\323QY\225\364Q#Sj]\246"
+	.ascii	"\264\310ZWN\007\322*\213D\356\213/V\353IF\035\217\346a\222i\001"
+	.ascii	"\t\326\346\353\r\273C\205\266\202\0132\245\325\346\333\n\212"
+	.ascii	"\204{\2258\\\330R\037m\266\016\237wU\002\260\254\204\264Yy\003"
+	.ascii	"\225\007\253\264v\344+9ES$\006!\3066;G\247\300\313\236\2729\226"
+	.ascii	"\274\312{S\234j\244\001\005\355C/\303\007\251\256a\363\226t\247"
+	.ascii	"l\363\033\3008b\244\351hM\222h!qB\"b\203\256\3212\032\212\341"
+	.ascii	"\242\022 \304\354F\323h\033\215\243\243x\3315\032\205s\\\317"
+	.ascii	"\270\231\336\213\344\336[\243_\034\215\341\312X\013\310\031\035"
+	.ascii	"\210*\305\007\ny7&\337z\264o2\266c4\222\227\027\364S-\216\335"
+	.ascii	"/\2343^g\312\324\331\363\005=\316\343\013zo8\373V\263o#\366\355"
+	.ascii	"e\377vqA\206\224\206\223U\213\0178c\254$\0059\376\313\235\225"
+	.ascii	"*\026\315\324I?81G\242\332\374\210Nb(\234gA\322\321\f{B\347\306"
+	.ascii	"g9\277{u@\321b'\357$\216\201\317r\224\322\373t\342\r\252\356"
+	.ascii	"\356o\245f\321K\001\f\206\323\033\225,\326\035`\312\211\230\222"
+	.ascii	"\273{\224\372 \264c\352I]{e\373\223<#i:\320\370\205$^fm\326\264"
+	.ascii	"W\265+U\334\306\260\330\232\344\025\r\207\2149.*g\377\357\346"
+	.ascii	"\352\311[\335\233\275\r\023\373\373*+\253f<vc\354l\025\207\274"
+	.ascii	"\331\204q\361\345\270|53\247\210Y\221\353\255\267\030flX\260"
+	.ascii	"\277\035@eUV\262\235d\321K\006^E!J>\364\346\350P S\215\274\222"
+	.ascii	"\235E\200\314G\361\214\365u\301\361\252\002/+\216:V\217Q\027"
+	.ascii	"\352\304\021:-2M\276\332$\222*\275\360\321d\306\213\375\b\026"
+	.ascii	"\352\017 XV\250W_s<j\017-tCjX\025\253_5"
+	.ascii	"\345e\005\253Y\347\267\272\243\202U\254,`U\253\006a\270(\235"
+	.ascii	"\253\224\344\016\004\016\025\323r\352\306\344\361-a\\j\220\332"
+	.ascii	"B\355b\270\250\364B\331\234y\001\022\304\253\n\341e\rRF\001N"
+	.ascii	"\031,wa\275. 7i.p0\265Y_`\245[\223U\272\305\313\312\305\344\002"
+	.ascii	"\336\2176\253\013\337\322\242\350\242\351Kf\250\r\201\002f_\323"
+	.ascii	"e_S}\330*t9\336\254\354k\222\36658\354kd\330\277\366\250W\312"
+	.ascii	"\030\354\336\352UCM\201\362\"\251\315\327\304\260]uT\253\fB\322"
+	.ascii	"v\034\251\na\205(G\3324\251^e\270ei9%s\344~,\211L\035\311\263"
+	.ascii	"\263\321fM\301.\325\024=\324\344H2\205\243\315\327\024\376\272"
+	.ascii	"TsT'\022@\220\207'\246\315\313)}^\245l\336\332\350\304\344\254"
+	.ascii	"\017\f\220\275\270\262x\215\252,\252\r\223H*#\307\007R*DNq\212"
+	.ascii	"\255\253\315\324\307\245\244\313[\233\025\205J\243\326\370\177"
+	.ascii	"\277\265\027S\244\340\354\353\214\232\2538\037/\264\331\025\352"
+	.ascii	"U\306\377\363}!\225\226n\366\025Y\237\360\236\254\265h\363\277"
+	.ascii	"5\373\032c\004sT^mV\030v\351\247\364\360\3132\266\005\253\315"
+	.ascii	"W\030\177=\326\026\325\211\204{\225\372\005\216\250.m\326\246"
+	.ascii	"\372\342\325\251\272\270\325\211D\362^cu\312`\346^c\006f\f\230"
+	.ascii	"10\205Te\231\365\314\377\304\354\351\230C/\2077\364\352\222\317"
+	.ascii	"+Sg\225\271\271\265\211\363\233\262\277&\300\020\\\215gj\022"
+	.ascii	"\237A\001\361\222\277&{\013\306\332+`\237\341z\353\3453\020\256"
+	.ascii	"\021\252C\0137\316\372|\311\375\222\340\341q\033\336\215C\336"
+	.ascii	"\371\276\330\312\254\310\254\315Q\246\214\335\262?*ww=\246\265"
+	.ascii	"|d<\304\350\314\255+\245\"c\316z,\302\256\274r\330\232\033a\302"
+	.ascii	"\364\026"
+	.string	"\020\274\004}9\303\322\346\355\223\265\201R\367\272\266\263wG-\275\361R\263\241\244\315\266\253PV\330R\316\231b[Q;\356\254\317\f\260\271p\323-\233\216\347:\275\310\232,\2559{\346\271\236\315\027-\315EKo\001\241(\206\364c\210\224-\277\026\266\252^\250Y\037\023\360\235%K[\231\305\261\373T\303\224\226i\273\2737*\004\215\0300*\314UY\033<`\334\343Z\316\336{\001\320\202\326\212\0267\336\256\274\345X,\207\353\207\332W\233=\245\255\320\220\301\250\"\263\322Uj\324\220\274\340\345\fN\2259\247c\233Tx\013\303`4&\365\225T\230W\2276\357\213\26250\200\r\205;\312\222\206k0\363\226]\243\f\022_|P\366>\027`=\337\023\340\373\311y\331Oz\b\027\221?\262\266(t4m\\n\310}\261v\013\330M\270;\206\336b\2445\253jA7\305\236;A#\242\0244\346U"
+	.string	"\t\203\303\022\204C\250\221\360&\250h\210\330\341\034\006\211\200\316\240\016GEF:)>`td\022\021\005\201\210\350P\t=HB!\rN@\022\016\021i@\242\304O\t\023'\364\234AHD@\302\241\236!\021\251\247\347\003FC\025\250\221\320\227\"x\022\231(Qh\004D\223\002\025\016\r\211zW\301S4\204\n\221\206=@)\320\023E\215\n4X\324#4**\252`D\007\200\206\220< \001z\025<GHFC\241\237\3400x\324\003\224\001z\022m\204)\232\206\370s\203\376\b\205\216h\204BG\365\004\301\020\321\f\n\n\372\206\350Q=\316\212!J\034\022:+\360\023t\n\205\206\210\202\276\240\223\210d\002\235D\337\203h0h\370#t\304\2233\f\252"
+	.string	"2\177\320\223xV@\350\210"
+	.string	"\033\200<A\247\tA\"\207\242\241Q\212\341y$\200 !\222\321\360\001g\020\022:\204\0221\200\203\r\361$\002Z\201\236(<\020\022\002\335\234\250\321\007B\243!48,a\210(\370\001q\210\202\253\340\271\200\030t\006e@\201N\364l"
+	.string	"M\t\036\242\257\350D\211+P\024!\2410k\200<\3500x\304s\242\301\240\243\021HH \301\006"
+	.string	" \n\242F\"\234C\n4\210\340Y\021\024<+P\264ag\004\317\tg\220\020\002\250\360\034\016\221\200*8\177N4\210\242\320A\321s\210D$\236C\n\334\004\340@\302\340P\320)\001\017V\020\035\035\005+8\320\320\360\024\236B\366$JhP\302\304\t\276\2338\001<\001\354\335\304\t\037\237\023%|\354K\370T\037\036\"\212\341\211\022\r9`\347\374AqC\374\021\032J!4\372@\3039\f~ h\030T\361\203\376\230\360\241B$#\240\237\223\350\250(H\324\220\342\210\350\347$\016\031\ts\210N\023P\242\340O\n \233\253 \376\364\320\2538M\030\032\006\021\340FG\347\260\00752\032\366\330|"
+	.string	"\200\023\r\022!\001\021\005\201~\304\037\023\316\006\374P$\213\376\224\360A\205CHvE\220\350\f\3729B\262(:\f\242D;D)"
+	.string	"$Dr\300\321\004p\216\220~\320S\250g\302\031TQ\"\006\030\r\203\036\370\316!\022\032\034\236GE\247\b\031\320\037\021#P\341\220\357@@\016R\210\030\001\344\200\207\3039\340\340\203\016#\204\360"
+	.ascii	"\013\3043<\321\263\310h\030,\241\20784\"\nOb\217p(X\324\0034"
+	.ascii	"$\366\360\f\200\310\310\310\203\037\232.\243\202+v\265y\303U"
+	.ascii	"\311\324\274J\246\236\371\025{uN\242P\370P\317T\274#\3060N\025"
+	.ascii	"\257\232\201\222r\244I\310i\304\222*\210\251e\032\205<\033e7"
+	.ascii	"\320,Z\275#\242u\357\325\271\311bwV\266\264O*\027\fA\254\204"
+	.ascii	"a#\273K\002\225\2661Q\301a\367ze\313\030$\257\315\364\353&F\f"
+	.ascii	"\254d\335\226]r\201k\362\302\226\241E\n\\\312\320y\335@\231\013"
+	.ascii	"\363B\0270\213U\203\314\030\227\376a\322`\201\207\013[*\031\r"
+	.ascii	"\025\274\031S\264\360\\\257\006\2132G\346\252\231\251\3242\006"
+	.ascii	"/K\017\311\351\312\262E\251\261\330\350\201{aF\233\277\246"
+	.string	"\266W*m\365\212\331v\357\0222G\214\22304\254\274^A\243\222\263\301\243\315Z\345hOBD\016k\n\316Tq\253\253\315\372\244J\251qUd\214NJ\373\n\327E\354\207\\\2335\212]\272\351\362`6\231\335\325(8R.X\251\320f\205\342\363\372Fc\303\215\n\253M\233&5\206\3526%\005E\266\303\276:\361\002\302\345\223\240\007\225(X\276x\255g,\332M\265Y\231\274\242A1e\245\251\305\250b\221\326\346o\250\254\265C\362\252\004Ie\013\202\351\250\202\3114H\322\030R\312\320\324\310H\222$\035\002\n\020\204Cq\236\nj\017\022`U=\3171\307HD\222\024\244P\032\366\r\243!\b\264y,\022x\361\013\320\252\357\210\311\240H\335\260\322\013\274#\313\210\0228y\343(\360e\240\223\327\341\244\234\035\323d\302\262H\025&\016\372\250I\t\022\021\020\344\341\031Q\272\373\301P\363\037\200\231"
+	.string	"\365z1_\301\021\235r?+3\302\"\304I\006+0I\377B[\252\031v\315\n\203\f\3643\330\267\253\243TB\346^\366c\245\327(\205\264m\263\205\260"
+	.ascii	"\022\274H\"\035\320\036\r\356\217\266\322\322\244\026\343\223"
+	.ascii	"\030\272h\372\r?4\354bS\364\334\335\230\212\321\274\203'\342"
+	.ascii	"elq\336O|q\371\352a<\2031\316sa7\375\352B\347\230\234$d\214\317"
+	.ascii	"\264\372\270F\375\241\314\205\344)D\300\027>\265\324\031{\327"
+	.ascii	"\r>\245$$B"
+	.string	":N\2457\376-'\f@\240\022H\201\005 \377"
+	.ascii	"W\023\200\202\320Q\277\343\314\030\306\\\032\343\352`\214\"G"
+	.ascii	"\234y\021\363\250,\030\253!\262\224\265o\274c8.<J\241\006\004"
+	.ascii	"s\241\016\214\275\230\317\252\250\"\247&Q\314\313q\242k\033\216"
+	.ascii	"H\306\035%\004\204\314\350\rk\301\374e\343\211\324\210J\251\321"
+	.ascii	"\260-\231\304Q\300\001\\F\217\241?\225\266\343\354#\332%\013"
+	.ascii	"\265\374\323\346\034\245\226\246\202\216\250\246-~\364\237\250"
+	.ascii	"g\272V\217\203\370\311\257\227\365/\f\374\276\265\375;\3203\177"
+	.ascii	"\217\305\332U\005aj\264W\300\003_=\252\312\264B5\257-\376\034"
+	.ascii	"w\224\254\223!\352\253\204\302\300\371[\215\343L\256\331p\026"
+	.ascii	"\306Z\017\032{a)|x\003\022C,\374\240\316\037\206\263\263d\202"
+	.ascii	"\021\016\252\312N\020l\273\314uf\036\036kd_\003\352\3340\336"
+	.ascii	"\320\322\022\005.\241\350\332\001\271{&\320\223\273\f\266\216"
+	.ascii	"\342\037\202\304\032UW\004\220l}l\325\351\241X\263w6\314\007"
+	.ascii	"Z\213~[/\016\235|\331G\303\002\f\031\264\201\260oh\267\253\271"
+	.ascii	"\022p\307E\002]\340\365\004G\222A\347\334\341\0218=\017&\344"
+	.ascii	"\027e\210\314?\251E\301\320;\222\325\351\340\003\030\277\242"
+	.ascii	"\306\227\341\215_p\374n\231g\025()61\016\350\250\n\246\212q-"
+	.ascii	")q:\321 dsx\332c\211!Y\212<\"\363>\245\303l\310\350\362\236\247"
+	.ascii	"\341\002Qh\266\r\307\341D\036Z\315\277\265\017\310\373\365s\354"
+	.ascii	"a9*N\f\375\207\251Pe\215\200\257\347\341\325\276\357|\0368 \244"
+	.ascii	"\353\212n\245r\265Z\272"
+	.string	"\317kU\\L\017\256\267/\304\366\253J\330U\210F;\241\307\001P\255\352\364c\203\374\230\024\264]\363\\+\222\272\201\364\314\372UL\372\246\373V9\262\333b\200\\\206n\262~\276\222\275/\230\235,t\361&\327\20393T\"\350\3716sR\021<Bh.Lo\376C]\351\206\250\233\240\002j\330\001\345\245JQ\r\374<r\350\273\215\026\274\305\300\301N\023\006\f\276\274>\323F\342U8\303I\300@\326\352$\211\235V}\326\251\304\352\250\027FA\027\352\367\203&\326\320\374\205\035\0041\347\251\216\020\001wF\300\3317\tv\024\350\267\226\323\3512d3=\013\275\032i\fCI)\306Q\342\314g\b\326\362\375jM\026\372\273:\314\200\250\026\034\026+4RR\274\362\033\004\nI\214j*\006\247\220~\367\023\303\364j0\236\237K\022\330^\372\311\300bM\227`\232p\247\005Q`%#\020\213;!n"
+	.string	"\241\017S\266\314\352\202W\373-\364 \206\306\\`l\\\024\240\032\226\025%\215\222\340\220n\340$\035\244\236<\374Y\n\334\334\001\224\2031`\002\324\332\270/A\271\004y\315\234\\\n\024\367>\210\377\246\340\363\346>+^\025\320\245\263>\256i\220R\320\204\0175\021\352JB&E\024\323?\376\321\004 \355Rt\r\007mN\230`M\247\342\201}\035l\343x.\264>B\340\2061\352\202\025\346\017mm\213=\314\"\n\262\377\031\275\"@\347\217\351\264\200_\312\250\265\013]\267\001\217P5\333*\361\325+\003r\327\316\036C\227R\240p\215\2653D 5\270\356\346%\033\347+\001\367\236\210x\222\204\2511y\217\210\334\362\022\266!\376<\337\265L\200\017\300\373qW\004\177\022"
+	.string	"^\016\233m\350f\357E@sl\204E,8\315q\252\032\002\020g\302\214\037j\2540\002\rc\222\246\020\3266l\231\330\254\031\215\307n\372\177q\312\353$\213\017L\2657\316v\013b\356?G\270\031nD\247\006\206\250[>\033$5&\2644\351b{!\317/\323\367w}g\345\2154*wga\200~\007\3366\227\261\242|\277\311\263T>8\217\275\205\317\266\036)\261\277\201I\370\252\020t\022\013O\251t\251\252\245\335)\021\336%Cc\365p~\200Ow@\331\253B\001\212\t\374K\004\220A=R\276v\353et\2475\344\327\371\374\302\371\352\312\367\351Vnb5s\2163\372y92+\341\327w\255\255\325\356N\377\231\307\300v&\371\270\363O[\215\331="
+	.ascii	"\357\257\354\032\244\305\352\266{\205\375\351\335_\036~\233\320"
+	.ascii	"\016\212\217@\235\224\355\204\017\316\360s\232\272\217\367\335"
+	.ascii	"p\343\373\3672\252Y\377Ug><W\246\347\346\036\264\341\r\241\017"
+	.ascii	"T\375\266\333\n\364\031ciG\325\214\317\3757\027\242\037w\317"
+	.ascii	"\026\317R\214\333S\357\2347w\354;\177\016\267\246\017\233Gp\243"
+	.ascii	"m3\020\233\351c\350G\271!\037fQ\234\226\3737\376K\311\346{{\234"
+	.ascii	"\372%\261Uo\036\33611\274\237)uO\273\222\343]s\236\375;\373\336"
+	.ascii	"!P\033\263K\267C\230#\331\231\302\3041\323\371\353)\375Xg\226"
+	.ascii	"<I}>lm\3544\320[\001"
+	.text
+	.section	.gnu.lto_.symtab.e532ebac52cc6833,"e",@progbits
+	.string	"baro"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"isBaroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"baroSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"isBaroReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"baroCalculateAltitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"performBaroCalibrationCycle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\001"
+	.string	""
+	.string	"pgResetTemplate_barometerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"barometerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e532ebac52cc6833,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,12800 @@
+	.file	"battery.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/build/debug.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/drivers/adc.h"
+	.file 7 "./src/main/fc/runtime_config.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/fc/config.h"
+	.file 10 "./src/main/fc/rc_controls.h"
+	.file 11 "./src/main/common/time.h"
+	.file 12 "./src/main/io/beeper.h"
+	.file 13 "./src/main/sensors/current.h"
+	.file 14 "./src/main/sensors/voltage.h"
+	.file 15 "./src/main/sensors/battery.h"
+	.file 16 "./src/main/sensors/battery.c"
+	.file 17 "./src/main/common/utils.h"
+	.file 18 "./src/main/common/maths.h"
+	.file 19 "./src/main/config/feature.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	battery.c.ea9a6ddf
+	.weak	battery.c.ea9a6ddf
+battery.c.ea9a6ddf:
+	.long	0xbbf
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF1822
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1540
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1541
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1542
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1543
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1544
+	.uleb128 0x2
+	.long	.LASF1545
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1546
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1547
+	.uleb128 0x2
+	.long	.LASF1548
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1549
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1550
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1551
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1552
+	.uleb128 0xe
+	.long	0x98
+	.uleb128 0x2
+	.long	.LASF1553
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1554
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0xe
+	.long	0xb0
+	.uleb128 0x2
+	.long	.LASF1555
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1556
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1557
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x16
+	.long	0xa4
+	.long	0xf4
+	.uleb128 0x17
+	.long	0x37
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1558
+	.byte	0x4
+	.byte	0x15
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0xc
+	.long	.LASF1559
+	.byte	0x4
+	.byte	0x16
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x4
+	.byte	0x30
+	.long	0x1a2
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x16
+	.byte	0
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1583
+	.uleb128 0x2
+	.long	.LASF1584
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xcd
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x1e3
+	.uleb128 0x7
+	.long	.LASF1585
+	.value	0xfff
+	.uleb128 0x7
+	.long	.LASF1586
+	.value	0xf000
+	.uleb128 0x7
+	.long	.LASF1587
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1589
+	.value	0x8000
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1590
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xf
+	.long	0x1ef
+	.uleb128 0x23
+	.long	0x1ff
+	.uleb128 0x4
+	.long	0x96
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x24
+	.byte	0x8
+	.byte	0x5
+	.byte	0x35
+	.byte	0x5
+	.long	0x21e
+	.uleb128 0x18
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x18
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x21e
+	.byte	0
+	.uleb128 0xd
+	.long	0x1e3
+	.uleb128 0x12
+	.long	.LASF1725
+	.byte	0x20
+	.byte	0x5
+	.byte	0x30
+	.long	0x26f
+	.uleb128 0x19
+	.string	"pgn"
+	.byte	0x31
+	.byte	0xb
+	.long	0x1a9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1591
+	.byte	0x5
+	.byte	0x32
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1592
+	.byte	0x5
+	.byte	0x33
+	.byte	0xe
+	.long	0x26f
+	.byte	0x8
+	.uleb128 0x19
+	.string	"ptr"
+	.byte	0x34
+	.byte	0xf
+	.long	0x274
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1593
+	.byte	0x5
+	.byte	0x38
+	.byte	0x7
+	.long	0x1ff
+	.byte	0x18
+	.byte	0
+	.uleb128 0xd
+	.long	0xc1
+	.uleb128 0xd
+	.long	0x26f
+	.uleb128 0x2
+	.long	.LASF1594
+	.byte	0x5
+	.byte	0x39
+	.byte	0x3
+	.long	0x223
+	.uleb128 0xe
+	.long	0x279
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x6
+	.byte	0x16
+	.long	0x2b4
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1600
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x7
+	.byte	0x15
+	.long	0x2df
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1605
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x8
+	.byte	0x14
+	.long	0x411
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x2e
+	.byte	0
+	.uleb128 0xd
+	.long	0x9f
+	.uleb128 0xe
+	.long	0x411
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x9
+	.byte	0x23
+	.long	0x4f7
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x80
+	.uleb128 0x7
+	.long	.LASF1660
+	.value	0x100
+	.uleb128 0x7
+	.long	.LASF1661
+	.value	0x200
+	.uleb128 0x7
+	.long	.LASF1662
+	.value	0x400
+	.uleb128 0x7
+	.long	.LASF1663
+	.value	0x1000
+	.uleb128 0x7
+	.long	.LASF1664
+	.value	0x2000
+	.uleb128 0x7
+	.long	.LASF1665
+	.value	0x4000
+	.uleb128 0x7
+	.long	.LASF1666
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF1667
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF1668
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF1669
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF1670
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF1671
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF1672
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF1673
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF1674
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF1675
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF1676
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF1677
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF1678
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF1679
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1823
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0xa
+	.byte	0x41
+	.byte	0xe
+	.long	0x552
+	.uleb128 0x1
+	.long	.LASF1680
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1681
+	.byte	0x1
+	.uleb128 0x26
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1683
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1685
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1686
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1687
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xa
+	.byte	0x50
+	.long	0x56a
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1693
+	.byte	0xa
+	.byte	0x53
+	.byte	0x3
+	.long	0x552
+	.uleb128 0xc
+	.long	.LASF1694
+	.byte	0xa
+	.byte	0x9b
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x2
+	.long	.LASF1695
+	.byte	0xb
+	.byte	0x21
+	.byte	0x12
+	.long	0xd9
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xc
+	.byte	0x17
+	.long	0x61e
+	.uleb128 0x1
+	.long	.LASF1696
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1697
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1699
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1709
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0x15
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1718
+	.byte	0xc
+	.byte	0x31
+	.byte	0x3
+	.long	0x58e
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xd
+	.byte	0x16
+	.long	0x654
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1724
+	.byte	0xd
+	.byte	0x1c
+	.byte	0x3
+	.long	0x62a
+	.uleb128 0x12
+	.long	.LASF1726
+	.byte	0xc
+	.byte	0xd
+	.byte	0x1e
+	.long	0x694
+	.uleb128 0x3
+	.long	.LASF1727
+	.byte	0xd
+	.byte	0x1f
+	.byte	0xd
+	.long	0xb0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1728
+	.byte	0xd
+	.byte	0x20
+	.byte	0xd
+	.long	0xb0
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1729
+	.byte	0xd
+	.byte	0x21
+	.byte	0xd
+	.long	0xb0
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1730
+	.byte	0xd
+	.byte	0x22
+	.byte	0x3
+	.long	0x660
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xe
+	.byte	0x1a
+	.long	0x6be
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1734
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x3
+	.long	0x6a0
+	.uleb128 0x12
+	.long	.LASF1735
+	.byte	0x4
+	.byte	0xe
+	.byte	0x22
+	.long	0x6f1
+	.uleb128 0x3
+	.long	.LASF1736
+	.byte	0xe
+	.byte	0x23
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1737
+	.byte	0xe
+	.byte	0x24
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1738
+	.byte	0xe
+	.byte	0x25
+	.byte	0x3
+	.long	0x6ca
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xe
+	.byte	0x3f
+	.long	0x721
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1743
+	.byte	0xe
+	.byte	0x44
+	.byte	0x3
+	.long	0x6fd
+	.uleb128 0x12
+	.long	.LASF1744
+	.byte	0x14
+	.byte	0xf
+	.byte	0x1b
+	.long	0x7c9
+	.uleb128 0x3
+	.long	.LASF1745
+	.byte	0xf
+	.byte	0x1d
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1746
+	.byte	0xf
+	.byte	0x1e
+	.byte	0xd
+	.long	0xc1
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1747
+	.byte	0xf
+	.byte	0x1f
+	.byte	0xd
+	.long	0xc1
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1748
+	.byte	0xf
+	.byte	0x20
+	.byte	0xd
+	.long	0xc1
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1749
+	.byte	0xf
+	.byte	0x22
+	.byte	0x1a
+	.long	0x6be
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1750
+	.byte	0xf
+	.byte	0x25
+	.byte	0x1a
+	.long	0x654
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1751
+	.byte	0xf
+	.byte	0x26
+	.byte	0xe
+	.long	0xcd
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1752
+	.byte	0xf
+	.byte	0x29
+	.byte	0x9
+	.long	0x2b4
+	.byte	0xe
+	.uleb128 0x3
+	.long	.LASF1753
+	.byte	0xf
+	.byte	0x2a
+	.byte	0x9
+	.long	0x2b4
+	.byte	0xf
+	.uleb128 0x3
+	.long	.LASF1754
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xd
+	.long	0xc1
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1755
+	.byte	0xf
+	.byte	0x2c
+	.byte	0xd
+	.long	0xc1
+	.byte	0x11
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1756
+	.byte	0xf
+	.byte	0x2d
+	.byte	0x3
+	.long	0x72d
+	.uleb128 0xe
+	.long	0x7c9
+	.uleb128 0xc
+	.long	.LASF1757
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x18
+	.long	0x7c9
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xf
+	.byte	0x31
+	.long	0x80a
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1760
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1762
+	.byte	0xf
+	.byte	0x36
+	.byte	0x3
+	.long	0x7e6
+	.uleb128 0x13
+	.long	.LASF1763
+	.byte	0x3e
+	.byte	0x9
+	.long	0xc1
+	.uleb128 0x13
+	.long	.LASF1764
+	.byte	0x3f
+	.byte	0xa
+	.long	0xcd
+	.uleb128 0x13
+	.long	.LASF1765
+	.byte	0x40
+	.byte	0xa
+	.long	0xcd
+	.uleb128 0xa
+	.long	.LASF1766
+	.byte	0x42
+	.byte	0x17
+	.long	0x694
+	.uleb128 0xa
+	.long	.LASF1767
+	.byte	0x43
+	.byte	0x17
+	.long	0x6f1
+	.uleb128 0xa
+	.long	.LASF1768
+	.byte	0x45
+	.byte	0x17
+	.long	0x80a
+	.uleb128 0xa
+	.long	.LASF1769
+	.byte	0x46
+	.byte	0x17
+	.long	0x80a
+	.uleb128 0xa
+	.long	.LASF1770
+	.byte	0x47
+	.byte	0x17
+	.long	0x80a
+	.uleb128 0xc
+	.long	.LASF1771
+	.byte	0x10
+	.byte	0x55
+	.byte	0x1e
+	.long	0x7d5
+	.uleb128 0x27
+	.long	0x7da
+	.byte	0x10
+	.byte	0x55
+	.byte	0x4d
+	.uleb128 0xc
+	.long	.LASF1772
+	.byte	0x10
+	.byte	0x55
+	.byte	0x7d
+	.long	0x285
+	.uleb128 0x28
+	.long	0x882
+	.byte	0xa8
+	.uleb128 0x29
+	.long	0x86e
+	.byte	0x57
+	.byte	0x17
+	.uleb128 0x16
+	.long	0x416
+	.long	0x8aa
+	.uleb128 0x17
+	.long	0x37
+	.byte	0
+	.uleb128 0xe
+	.long	0x89b
+	.uleb128 0x13
+	.long	.LASF1773
+	.byte	0xf4
+	.byte	0x14
+	.long	0x8aa
+	.uleb128 0xb
+	.long	.LASF1774
+	.byte	0xc
+	.byte	0x3b
+	.long	0x8cb
+	.uleb128 0x4
+	.long	0x61e
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1775
+	.byte	0xd
+	.byte	0x68
+	.long	0x8dc
+	.uleb128 0x4
+	.long	0x8dc
+	.byte	0
+	.uleb128 0xd
+	.long	0x694
+	.uleb128 0xb
+	.long	.LASF1776
+	.byte	0xd
+	.byte	0x67
+	.long	0x901
+	.uleb128 0x4
+	.long	0xb0
+	.uleb128 0x4
+	.long	0x2b4
+	.uleb128 0x4
+	.long	0x2b4
+	.uleb128 0x4
+	.long	0xb0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1824
+	.byte	0x13
+	.byte	0x1e
+	.byte	0x5
+	.long	0x2b4
+	.long	0x917
+	.uleb128 0x4
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1825
+	.byte	0xa
+	.byte	0xbb
+	.byte	0x12
+	.long	0x56a
+	.uleb128 0xb
+	.long	.LASF1777
+	.byte	0xd
+	.byte	0x64
+	.long	0x934
+	.uleb128 0x4
+	.long	0x8dc
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1778
+	.byte	0xd
+	.byte	0x63
+	.long	0x945
+	.uleb128 0x4
+	.long	0xb0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1779
+	.byte	0xd
+	.byte	0x6a
+	.uleb128 0x11
+	.long	.LASF1780
+	.byte	0xd
+	.byte	0x66
+	.uleb128 0x11
+	.long	.LASF1781
+	.byte	0xd
+	.byte	0x62
+	.uleb128 0xb
+	.long	.LASF1782
+	.byte	0xd
+	.byte	0x60
+	.long	0x96b
+	.uleb128 0x4
+	.long	0x8dc
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1783
+	.byte	0xe
+	.byte	0x54
+	.uleb128 0xb
+	.long	.LASF1784
+	.byte	0xe
+	.byte	0x52
+	.long	0x983
+	.uleb128 0x4
+	.long	0x983
+	.byte	0
+	.uleb128 0xd
+	.long	0x6f1
+	.uleb128 0xb
+	.long	.LASF1785
+	.byte	0xe
+	.byte	0x56
+	.long	0x99e
+	.uleb128 0x4
+	.long	0x721
+	.uleb128 0x4
+	.long	0x983
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1786
+	.byte	0xe
+	.byte	0x55
+	.uleb128 0xf
+	.long	.LASF1787
+	.value	0x1a7
+	.byte	0x9
+	.long	0xb0
+	.uleb128 0xf
+	.long	.LASF1788
+	.value	0x1a2
+	.byte	0x9
+	.long	0xb0
+	.uleb128 0xf
+	.long	.LASF1789
+	.value	0x19e
+	.byte	0x9
+	.long	0xb0
+	.uleb128 0xf
+	.long	.LASF1790
+	.value	0x198
+	.byte	0x9
+	.long	0xc1
+	.uleb128 0xf
+	.long	.LASF1791
+	.value	0x193
+	.byte	0xa
+	.long	0xcd
+	.uleb128 0xf
+	.long	.LASF1792
+	.value	0x18e
+	.byte	0xa
+	.long	0xcd
+	.uleb128 0x2c
+	.long	.LASF1803
+	.byte	0x10
+	.value	0x186
+	.byte	0x6
+	.uleb128 0x1a
+	.long	.LASF1793
+	.value	0x176
+	.byte	0x9
+	.long	0xc1
+	.long	0xa21
+	.uleb128 0x9
+	.long	.LASF1794
+	.value	0x178
+	.byte	0xd
+	.long	0xc1
+	.uleb128 0x14
+	.uleb128 0x9
+	.long	.LASF1751
+	.value	0x17a
+	.byte	0x12
+	.long	0xcd
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1795
+	.value	0x16d
+	.byte	0x7
+	.long	0x1a2
+	.long	0xa3e
+	.uleb128 0x9
+	.long	.LASF1796
+	.value	0x16e
+	.byte	0xb
+	.long	0x1a2
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF1808
+	.byte	0x10
+	.value	0x141
+	.byte	0x6
+	.long	0xa97
+	.uleb128 0x2e
+	.long	.LASF1816
+	.byte	0x10
+	.value	0x141
+	.byte	0x29
+	.long	0x582
+	.uleb128 0x9
+	.long	.LASF1797
+	.value	0x149
+	.byte	0x15
+	.long	0xd9
+	.uleb128 0x9
+	.long	.LASF1798
+	.value	0x14a
+	.byte	0x13
+	.long	0xbc
+	.uleb128 0x14
+	.uleb128 0x9
+	.long	.LASF1799
+	.value	0x154
+	.byte	0x1e
+	.long	0x56a
+	.uleb128 0x9
+	.long	.LASF1800
+	.value	0x155
+	.byte	0x11
+	.long	0x2b4
+	.uleb128 0x9
+	.long	.LASF1801
+	.value	0x156
+	.byte	0x15
+	.long	0xb0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF1820
+	.byte	0x10
+	.value	0x132
+	.byte	0xd
+	.long	0xab3
+	.uleb128 0x14
+	.uleb128 0x9
+	.long	.LASF1802
+	.value	0x135
+	.byte	0x11
+	.long	0xc1
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1804
+	.byte	0xfb
+	.uleb128 0x1c
+	.long	.LASF1805
+	.byte	0xf6
+	.byte	0xe
+	.long	0x411
+	.uleb128 0x1c
+	.long	.LASF1806
+	.byte	0xef
+	.byte	0x10
+	.long	0x80a
+	.uleb128 0x1b
+	.long	.LASF1807
+	.byte	0xe7
+	.uleb128 0x1d
+	.long	.LASF1813
+	.byte	0xca
+	.uleb128 0x1e
+	.long	.LASF1809
+	.byte	0x99
+	.long	0xb09
+	.uleb128 0xa
+	.long	.LASF1810
+	.byte	0x9b
+	.byte	0x15
+	.long	0xcd
+	.uleb128 0xa
+	.long	.LASF1811
+	.byte	0x9d
+	.byte	0x9
+	.long	0x2b4
+	.uleb128 0x14
+	.uleb128 0xa
+	.long	.LASF1812
+	.byte	0xaa
+	.byte	0x12
+	.long	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1814
+	.byte	0x88
+	.uleb128 0x1e
+	.long	.LASF1815
+	.byte	0x6a
+	.long	0xb26
+	.uleb128 0x15
+	.long	.LASF1816
+	.byte	0x10
+	.byte	0x6a
+	.byte	0x24
+	.long	0x582
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF1826
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x53
+	.long	0xb32
+	.uleb128 0xd
+	.long	0x7d5
+	.uleb128 0x1f
+	.long	.LASF1817
+	.byte	0x11
+	.byte	0x4c
+	.byte	0x17
+	.long	0xb0
+	.long	0xb5c
+	.uleb128 0x10
+	.string	"a"
+	.byte	0x11
+	.byte	0x4c
+	.byte	0x26
+	.long	0xd9
+	.uleb128 0x10
+	.string	"b"
+	.byte	0x11
+	.byte	0x4c
+	.byte	0x32
+	.long	0xd9
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1818
+	.byte	0x12
+	.byte	0x88
+	.byte	0x15
+	.long	0x1a2
+	.long	0xb91
+	.uleb128 0x10
+	.string	"amt"
+	.byte	0x12
+	.byte	0x88
+	.byte	0x26
+	.long	0x1a2
+	.uleb128 0x10
+	.string	"low"
+	.byte	0x12
+	.byte	0x88
+	.byte	0x31
+	.long	0x1a2
+	.uleb128 0x15
+	.long	.LASF1819
+	.byte	0x12
+	.byte	0x88
+	.byte	0x3c
+	.long	0x1a2
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1821
+	.byte	0x12
+	.byte	0x7e
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x10
+	.string	"amt"
+	.byte	0x12
+	.byte	0x7e
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0x10
+	.string	"low"
+	.byte	0x12
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x7c
+	.uleb128 0x15
+	.long	.LASF1819
+	.byte	0x12
+	.byte	0x7e
+	.byte	0x33
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 20 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.file 23 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 25 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 26 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 29 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 36 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.file 37 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 38 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x26
+	.file 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 40 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x28
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 41 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x29
+	.file 42 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF950
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.file 43 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.file 44 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6
+	.file 45 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 46 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x9
+	.file 47 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2f
+	.byte	0x4
+	.file 48 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 49 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x31
+	.byte	0x4
+	.file 50 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x32
+	.file 51 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x33
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 52 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 53 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1501
+	.byte	0x4
+	.file 54 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 55 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1505
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1532
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xd
+	.file 56 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xe
+	.file 57 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1539
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF807
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF768
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF908
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF945
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF949
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF986
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF992
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1015
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1097
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1099
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1108
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1110
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1112
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1120
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1132
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1500
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1504
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1531
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1536
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1827
+	.long	.LASF1828
+	.long	.LASF1829
+	.long	.LASF1830
+	.long	.LASF1831
+	.long	.LASF1832
+	.long	.LASF1833
+	.long	.LASF1834
+	.long	.LASF1835
+	.long	.LASF1836
+	.long	.LASF1837
+	.long	.LASF1838
+	.long	.LASF1839
+	.long	.LASF1840
+	.long	.LASF1841
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3a
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1842
+	.byte	0xb
+	.long	.LASF1843
+	.byte	0xb
+	.long	.LASF1844
+	.byte	0xb
+	.long	.LASF1845
+	.byte	0x1
+	.long	.LASF1846
+	.byte	0x3
+	.long	.LASF1847
+	.byte	0x4
+	.long	.LASF1848
+	.byte	0x5
+	.long	.LASF1849
+	.byte	0x4
+	.long	.LASF1850
+	.byte	0x5
+	.long	.LASF1851
+	.byte	0x5
+	.long	.LASF1852
+	.byte	0x2
+	.long	.LASF1853
+	.byte	0x6
+	.long	.LASF1854
+	.byte	0x7
+	.long	.LASF1855
+	.byte	0x7
+	.long	.LASF1856
+	.byte	0x7
+	.long	.LASF1857
+	.byte	0x7
+	.long	.LASF1858
+	.byte	0x2
+	.long	.LASF1859
+	.byte	0x2
+	.long	.LASF1860
+	.byte	0x3
+	.long	.LASF1861
+	.byte	0xe
+	.long	.LASF1862
+	.byte	0xf
+	.long	.LASF1863
+	.byte	0xf
+	.long	.LASF1863
+	.byte	0xe
+	.long	.LASF1864
+	.byte	0xb
+	.long	.LASF1865
+	.byte	0xe
+	.long	.LASF1866
+	.byte	0xe
+	.long	.LASF1867
+	.byte	0xb
+	.long	.LASF1868
+	.byte	0xb
+	.long	.LASF1869
+	.byte	0xd
+	.long	.LASF1870
+	.byte	0xb
+	.long	.LASF1871
+	.byte	0xc
+	.long	.LASF1872
+	.byte	0xc
+	.long	.LASF1873
+	.byte	0xb
+	.long	.LASF1874
+	.byte	0xb
+	.long	.LASF1875
+	.byte	0xb
+	.long	.LASF1876
+	.byte	0xa
+	.long	.LASF1877
+	.byte	0x9
+	.long	.LASF1878
+	.byte	0x8
+	.long	.LASF1879
+	.byte	0xf
+	.long	.LASF1880
+	.byte	0x9
+	.long	.LASF1881
+	.byte	0x2
+	.long	.LASF1882
+	.byte	0x2
+	.long	.LASF1883
+	.byte	0x1
+	.long	.LASF1884
+	.byte	0x3
+	.long	.LASF1885
+	.byte	0x4
+	.long	.LASF1886
+	.byte	0x4
+	.long	.LASF1887
+	.byte	0x4
+	.long	.LASF1888
+	.byte	0x4
+	.long	.LASF1889
+	.byte	0x4
+	.long	.LASF1890
+	.byte	0x4
+	.long	.LASF1891
+	.byte	0x4
+	.long	.LASF1892
+	.byte	0x4
+	.long	.LASF1893
+	.byte	0x4
+	.long	.LASF1894
+	.byte	0x4
+	.long	.LASF1895
+	.byte	0x4
+	.long	.LASF1896
+	.byte	0x7
+	.long	.LASF1897
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1492:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1512:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1524:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1128:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF958:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF795:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1154:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF850:
+	.string	"_WCHAR_T_DEFINED "
+.LASF802:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1783:
+	.string	"voltageMeterADCInit"
+.LASF1095:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1672:
+	.string	"FEATURE_TRANSPONDER"
+.LASF956:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1346:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF885:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1790:
+	.string	"getBatteryCellCount"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF889:
+	.string	"USE_PPM"
+.LASF1595:
+	.string	"ADC_BATTERY"
+.LASF1266:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1653:
+	.string	"FEATURE_RX_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1496:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF775:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1395:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF872:
+	.string	"USE_FAKE_GYRO "
+.LASF1735:
+	.string	"voltageMeter_s"
+.LASF1738:
+	.string	"voltageMeter_t"
+.LASF1593:
+	.string	"reset"
+.LASF993:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1134:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF891:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1545:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1600:
+	.string	"_Bool"
+.LASF886:
+	.string	"USE_UART8 "
+.LASF869:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1113:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF797:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1614:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1483:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1356:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1456:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1711:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1757:
+	.string	"batteryConfig_System"
+.LASF1794:
+	.string	"batteryPercentage"
+.LASF1705:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1117:
+	.string	"IOCFG_AF_OD 0"
+.LASF1804:
+	.string	"batteryInit"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1582:
+	.string	"DEBUG_COUNT"
+.LASF1135:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1419:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1274:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1103:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1124:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF842:
+	.string	"__WCHAR_T__ "
+.LASF803:
+	.string	"USE_SENSOR_NAMES "
+.LASF1488:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1053:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1460:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1332:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1611:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1495:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1662:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1556:
+	.string	"uint16_t"
+.LASF1188:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1498:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1038:
+	.string	"PG_RX_CONFIG 24"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1427:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1406:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF786:
+	.string	"TELEMETRY_HOTT "
+.LASF1325:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1005:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1394:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1152:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF933:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1121:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF812:
+	.string	"_T_PTRDIFF_ "
+.LASF1433:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1308:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1370:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1049:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF982:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1344:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1003:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF841:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1710:
+	.string	"BEEPER_READY_BEEP"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1147:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1616:
+	.string	"OWNER_ADC_RSSI"
+.LASF1508:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1451:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF959:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1311:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1057:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1802:
+	.string	"batteryPercentageRemaining"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1415:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1487:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1618:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1638:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1797:
+	.string	"ibatLastServiced"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1155:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1120:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF833:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF979:
+	.string	"BIT(x) (1 << (x))"
+.LASF1643:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1109:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF998:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1163:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF897:
+	.string	"USE_SERIALRX_SUMH"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1554:
+	.string	"int32_t"
+.LASF1314:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF954:
+	.string	"FAST_MATH "
+.LASF875:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1726:
+	.string	"currentMeter_s"
+.LASF1730:
+	.string	"currentMeter_t"
+.LASF1463:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1409:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1126:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1817:
+	.string	"cmp32"
+.LASF1230:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF914:
+	.string	"VTX_TRAMP"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1640:
+	.string	"OWNER_BARO_EXTI"
+.LASF1034:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF796:
+	.string	"TELEMETRY_MAVLINK "
+.LASF546:
+	.string	"__always_inline"
+.LASF1767:
+	.string	"voltageMeter"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1820:
+	.string	"batteryUpdateConsumptionState"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF890:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1737:
+	.string	"unfiltered"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1617:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF974:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1054:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1813:
+	.string	"batteryUpdateVoltageState"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1067:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1782:
+	.string	"currentMeterReset"
+.LASF1587:
+	.string	"PGR_SIZE_MASK"
+.LASF1233:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1660:
+	.string	"FEATURE_FAILSAFE"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF799:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1226:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1446:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"_T_SIZE_ "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1349:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1722:
+	.string	"CURRENT_METER_ESC"
+.LASF1818:
+	.string	"constrainf"
+.LASF1570:
+	.string	"DEBUG_VELOCITY"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1734:
+	.string	"voltageMeterSource_e"
+.LASF798:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1389:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF963:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1717:
+	.string	"BEEPER_PREFERENCE"
+.LASF1518:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1641:
+	.string	"OWNER_USB"
+.LASF1194:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1085:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF1652:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF837:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1306:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1009:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1437:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1371:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1678:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1664:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1527:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1597:
+	.string	"ADC_EXTERNAL1"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1622:
+	.string	"OWNER_SONAR_ECHO"
+.LASF905:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1412:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1796:
+	.string	"batteryScaler"
+.LASF834:
+	.string	"_SIZE_T_DECLARED "
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1046:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1089:
+	.string	"PG_VTX_CONFIG 515"
+.LASF996:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1610:
+	.string	"OWNER_SERVO"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF873:
+	.string	"ACC "
+.LASF1774:
+	.string	"beeper"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF794:
+	.string	"TELEMETRY_IBUS "
+.LASF773:
+	.string	"USE_PWM "
+.LASF1697:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF1442:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF843:
+	.string	"_WCHAR_T "
+.LASF1707:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1505:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1104:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1238:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1563:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1666:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1480:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1268:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1809:
+	.string	"batteryUpdatePresence"
+.LASF1661:
+	.string	"FEATURE_SONAR"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1579:
+	.string	"DEBUG_DYN_NOTCH"
+.LASF1772:
+	.string	"batteryConfig_Registry"
+.LASF818:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1743:
+	.string	"voltageSensorADC_e"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1546:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1568:
+	.string	"DEBUG_NOTCH"
+.LASF1548:
+	.string	"__uint16_t"
+.LASF1520:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1609:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1245:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF929:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1637:
+	.string	"OWNER_RX_SPI_CS"
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1509:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1278:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1220:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1133:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1748:
+	.string	"batteryNotPresentLevel"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1763:
+	.string	"batteryCellCount"
+.LASF1164:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1455:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF952:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1777:
+	.string	"currentMeterADCRead"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF992:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1742:
+	.string	"VOLTAGE_SENSOR_ADC_5V"
+.LASF946:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1281:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF972:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1819:
+	.string	"high"
+.LASF1539:
+	.string	"DEFAULT_VOLTAGE_METER_SOURCE VOLTAGE_METER_NONE"
+.LASF1090:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1335:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1473:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1540:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1756:
+	.string	"batteryConfig_t"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1656:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1814:
+	.string	"updateBatteryBeeperAlert"
+.LASF1655:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1096:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1099:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF997:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF819:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1073:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1475:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1047:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1361:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1030:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1077:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1515:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1583:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1025:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1001:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1452:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1434:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF852:
+	.string	"___int_wchar_t_h "
+.LASF1250:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1755:
+	.string	"vbathysteresis"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF800:
+	.string	"USE_MSP_PUSH "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1762:
+	.string	"batteryState_e"
+.LASF1115:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1097:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1110:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF811:
+	.string	"_PTRDIFF_T "
+.LASF1725:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1751:
+	.string	"batteryCapacity"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1202:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1658:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF987:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1793:
+	.string	"calculateBatteryPercentageRemaining"
+.LASF1170:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1798:
+	.string	"lastUpdateAt"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1780:
+	.string	"currentMeterVirtualInit"
+.LASF947:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF790:
+	.string	"USE_SERVOS "
+.LASF1589:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1468:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1649:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1773:
+	.string	"batteryStateStrings"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1785:
+	.string	"voltageMeterADCRead"
+.LASF1684:
+	.string	"AUX2"
+.LASF1685:
+	.string	"AUX3"
+.LASF1013:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF932:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1688:
+	.string	"AUX6"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1690:
+	.string	"AUX8"
+.LASF1032:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1691:
+	.string	"THROTTLE_LOW"
+.LASF1732:
+	.string	"VOLTAGE_METER_ADC"
+.LASF1295:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1535:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1706:
+	.string	"BEEPER_RX_SET"
+.LASF1680:
+	.string	"ROLL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1702:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1362:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF781:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1341:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1631:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1458:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1404:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1715:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF1247:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1119:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1323:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1239:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1741:
+	.string	"VOLTAGE_SENSOR_ADC_9V"
+.LASF1157:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1537:
+	.string	"VBAT_STABLE_MAX_DELTA 2"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1724:
+	.string	"currentMeterSource_e"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1572:
+	.string	"DEBUG_ANGLERATE"
+.LASF1209:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1585:
+	.string	"PGR_PGN_MASK"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1525:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF945:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1676:
+	.string	"FEATURE_RX_SPI"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1752:
+	.string	"useVBatAlerts"
+.LASF863:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1478:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1407:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1052:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF770:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF1749:
+	.string	"voltageMeterSource"
+.LASF1558:
+	.string	"debug"
+.LASF1105:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1062:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1087:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1510:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1449:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1212:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1235:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF936:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1642:
+	.string	"OWNER_USB_DETECT"
+.LASF1352:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1329:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1471:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1112:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1591:
+	.string	"size"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1293:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF824:
+	.string	"_SIZE_T "
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1072:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1718:
+	.string	"beeperMode_e"
+.LASF1731:
+	.string	"VOLTAGE_METER_NONE"
+.LASF1784:
+	.string	"voltageMeterReset"
+.LASF864:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1298:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF866:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1482:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1668:
+	.string	"FEATURE_DASHBOARD"
+.LASF836:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF995:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1167:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1575:
+	.string	"DEBUG_STACK"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1646:
+	.string	"OWNER_INVERTER"
+.LASF908:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1307:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1626:
+	.string	"OWNER_SPI_MOSI"
+.LASF1461:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1590:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1555:
+	.string	"uint8_t"
+.LASF1206:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1581:
+	.string	"DEBUG_DSHOT_RPM_TELEMETRY"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF953:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF918:
+	.string	"USE_DSHOT"
+.LASF1310:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1808:
+	.string	"batteryUpdateCurrentMeter"
+.LASF976:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1768:
+	.string	"batteryState"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF784:
+	.string	"TELEMETRY "
+.LASF1603:
+	.string	"ARMED"
+.LASF1066:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1687:
+	.string	"AUX5"
+.LASF1313:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1681:
+	.string	"PITCH"
+.LASF955:
+	.string	"VERY_FAST_MATH "
+.LASF1484:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1098:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF999:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF854:
+	.string	"_GCC_WCHAR_T "
+.LASF849:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF903:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1094:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1400:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1319:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1654:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF1709:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1205:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1454:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF857:
+	.string	"_BSD_WCHAR_T_"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF792:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1373:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF829:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1517:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1101:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1127:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF840:
+	.string	"__need_size_t"
+.LASF1608:
+	.string	"OWNER_PPMINPUT"
+.LASF821:
+	.string	"__need_ptrdiff_t"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF764:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF978:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1474:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1229:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF808:
+	.string	"_STDDEF_H "
+.LASF1417:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1071:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1158:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1257:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1040:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1014:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1004:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1173:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF766:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1760:
+	.string	"BATTERY_CRITICAL"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1196:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1242:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF915:
+	.string	"BLACKBOX"
+.LASF1410:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1578:
+	.string	"DEBUG_FFT"
+.LASF1088:
+	.string	"PG_VCD_CONFIG 514"
+.LASF1786:
+	.string	"voltageMeterADCRefresh"
+.LASF900:
+	.string	"LED_STRIP"
+.LASF1391:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1017:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1736:
+	.string	"filtered"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1801:
+	.string	"throttleOffset"
+.LASF1559:
+	.string	"debugMode"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1436:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1565:
+	.string	"DEBUG_MIXER"
+.LASF1176:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF896:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1671:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1516:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1302:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1253:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF785:
+	.string	"TELEMETRY_FRSKY "
+.LASF1131:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1822:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1788:
+	.string	"getAmperageLatest"
+.LASF1086:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF942:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF1739:
+	.string	"VOLTAGE_SENSOR_ADC_VBAT"
+.LASF1439:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1621:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1592:
+	.string	"address"
+.LASF967:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1430:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1376:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1280:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1283:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1513:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF895:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1754:
+	.string	"consumptionWarningPercentage"
+.LASF1179:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1322:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF859:
+	.string	"NULL"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF1623:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1695:
+	.string	"timeUs_t"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1776:
+	.string	"currentMeterVirtualRefresh"
+.LASF1002:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF922:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF499:
+	.string	"__PMT"
+.LASF855:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF917:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1129:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1328:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1465:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1064:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF767:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1825:
+	.string	"calculateThrottleStatus"
+.LASF1606:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1764:
+	.string	"batteryWarningVoltage"
+.LASF1605:
+	.string	"armingFlags"
+.LASF1428:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1108:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1588:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1022:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1470:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1334:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1248:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF950:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF1175:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1562:
+	.string	"DEBUG_BATTERY"
+.LASF1277:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF990:
+	.string	"UNIT_TESTED "
+.LASF1824:
+	.string	"feature"
+.LASF1021:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1761:
+	.string	"BATTERY_NOT_PRESENT"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1359:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF927:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1596:
+	.string	"ADC_CURRENT"
+.LASF1677:
+	.string	"FEATURE_SOFTSPI"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1712:
+	.string	"BEEPER_ARMED"
+.LASF1286:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1138:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF931:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1338:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1522:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1000:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF763:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF825:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1766:
+	.string	"currentMeter"
+.LASF1159:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1305:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1137:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1448:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF778:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1269:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1221:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1379:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1016:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1421:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF861:
+	.string	"__need_NULL"
+.LASF862:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1694:
+	.string	"rcCommand"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1169:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1598:
+	.string	"ADC_RSSI"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1716:
+	.string	"BEEPER_ALL"
+.LASF772:
+	.string	"USE_PPM "
+.LASF1696:
+	.string	"BEEPER_SILENCE"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1150:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1720:
+	.string	"CURRENT_METER_ADC"
+.LASF899:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF892:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1528:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF926:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1759:
+	.string	"BATTERY_WARNING"
+.LASF1224:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1185:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1604:
+	.string	"WAS_EVER_ARMED"
+.LASF1102:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1211:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1023:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF962:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1704:
+	.string	"BEEPER_BAT_LOW"
+.LASF969:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1629:
+	.string	"OWNER_SDCARD"
+.LASF1778:
+	.string	"currentMeterADCRefresh"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1479:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1063:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF943:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1553:
+	.string	"int16_t"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1326:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1541:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1287:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1544:
+	.string	"signed char"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF994:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1227:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1560:
+	.string	"DEBUG_NONE"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF822:
+	.string	"__size_t__ "
+.LASF788:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF789:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1190:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1476:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF851:
+	.string	"_WCHAR_T_H "
+.LASF1300:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1031:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1060:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1070:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF951:
+	.string	"sq(x) ((x)*(x))"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1385:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1304:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1815:
+	.string	"batteryUpdateVoltage"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1700:
+	.string	"BEEPER_DISARMING"
+.LASF830:
+	.string	"_BSD_SIZE_T_ "
+.LASF1203:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1403:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1466:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF909:
+	.string	"USE_DASHBOARD"
+.LASF787:
+	.string	"TELEMETRY_LTM "
+.LASF1791:
+	.string	"getBatteryVoltageLatest"
+.LASF1564:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF1136:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF981:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1141:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1503:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF1714:
+	.string	"BEEPER_USB"
+.LASF1514:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1039:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1557:
+	.string	"uint32_t"
+.LASF1382:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1651:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF930:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1043:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF782:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF810:
+	.string	"_ANSI_STDDEF_H "
+.LASF1093:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1644:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1807:
+	.string	"batteryUpdateStates"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1580:
+	.string	"DEBUG_GYRO_TO_MOTOR"
+.LASF1477:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1586:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1184:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1443:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1048:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1800:
+	.string	"throttleLowAndMotorStop"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1145:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1106:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF920:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1182:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1789:
+	.string	"getAmperage"
+.LASF1799:
+	.string	"throttleStatus"
+.LASF776:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1219:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1125:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1601:
+	.string	"OK_TO_ARM"
+.LASF1160:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF806:
+	.string	"VTX_SMARTAUDIO "
+.LASF984:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1511:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1289:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1045:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1531:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF921:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1669:
+	.string	"FEATURE_OSD"
+.LASF1068:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1010:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF791:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1337:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF911:
+	.string	"VTX_COMMON"
+.LASF1193:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1015:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1132:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1042:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1551:
+	.string	"long int"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1254:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1035:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF964:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1272:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1619:
+	.string	"OWNER_PINDEBUG"
+.LASF1199:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1816:
+	.string	"currentTimeUs"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1795:
+	.string	"calculateVbatPidCompensation"
+.LASF1673:
+	.string	"FEATURE_AIRMODE"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF793:
+	.string	"TELEMETRY_CRSF "
+.LASF1574:
+	.string	"DEBUG_SCHEDULER"
+.LASF815:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF977:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1758:
+	.string	"BATTERY_OK"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF814:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF831:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1299:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1425:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1365:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1744:
+	.string	"batteryConfig_s"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1723:
+	.string	"CURRENT_METER_MAX"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF975:
+	.string	"EXPAND_I(x) x"
+.LASF1275:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF907:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1232:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF828:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1530:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1602:
+	.string	"PREVENT_ARMING"
+.LASF1151:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1803:
+	.string	"batteryUpdateAlarms"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF827:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1061:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF960:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1078:
+	.string	"PG_PID_CONFIG 504"
+.LASF856:
+	.string	"__DEFINED_wchar_t "
+.LASF1529:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF522:
+	.string	"__flexarr []"
+.LASF783:
+	.string	"LED_STRIP "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF901:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1178:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1058:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1012:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF844:
+	.string	"_T_WCHAR_ "
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1018:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1215:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1290:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1620:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1059:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1398:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1703:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1374:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1810:
+	.string	"previousVoltage"
+.LASF939:
+	.string	"__enable_irq() "
+.LASF1142:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1552:
+	.string	"char"
+.LASF1271:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1208:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1355:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1116:
+	.string	"IOCFG_AF_PP 0"
+.LASF1519:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF870:
+	.string	"LED0_PIN NONE"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1692:
+	.string	"THROTTLE_HIGH"
+.LASF1100:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF1026:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF880:
+	.string	"USE_UART2 "
+.LASF1729:
+	.string	"mAhDrawn"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1504:
+	.string	"BEEP_ON do {} while(0)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1343:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF898:
+	.string	"USE_SERIALRX_XBUS"
+.LASF801:
+	.string	"USE_RX_MSP "
+.LASF971:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1317:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1526:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF832:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1491:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1567:
+	.string	"DEBUG_PIDLOOP"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1532:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1081:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1805:
+	.string	"getBatteryStateString"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF839:
+	.string	"__size_t "
+.LASF948:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF940:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1051:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1320:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF860:
+	.string	"NULL ((void *)0)"
+.LASF1499:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1632:
+	.string	"OWNER_FLASH_CS"
+.LASF1779:
+	.string	"currentMeterESCInit"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF973:
+	.string	"STR_HELPER(x) #x"
+.LASF1657:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1056:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF913:
+	.string	"VTX_SMARTAUDIO"
+.LASF777:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1624:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1236:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF988:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1397:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF894:
+	.string	"USE_SERIALRX_SBUS"
+.LASF876:
+	.string	"USE_FAKE_BARO "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1107:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1214:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF858:
+	.string	"__need_wchar_t"
+.LASF1011:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF813:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1713:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1670:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1080:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1377:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1698:
+	.string	"BEEPER_RX_LOST"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1826:
+	.string	"batteryConfig"
+.LASF1340:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1571:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF1256:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1092:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1675:
+	.string	"FEATURE_VTX"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1472:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1418:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1156:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1494:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1682:
+	.string	"THROTTLE"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1566:
+	.string	"DEBUG_AIRMODE"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1200:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1523:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1069:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1006:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1727:
+	.string	"amperage"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1561:
+	.string	"DEBUG_CYCLETIME"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF1576:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF769:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF765:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1007:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1079:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1388:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1745:
+	.string	"vbatmaxcellvoltage"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1244:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1091:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1627:
+	.string	"OWNER_I2C_SCL"
+.LASF1625:
+	.string	"OWNER_SPI_MISO"
+.LASF1149:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1650:
+	.string	"OWNER_COMPASS_CS"
+.LASF847:
+	.string	"_WCHAR_T_ "
+.LASF983:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1172:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1422:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1679:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF1019:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1665:
+	.string	"FEATURE_RX_MSP"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1787:
+	.string	"getMAhDrawn"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF848:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1823:
+	.string	"rc_alias"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1659:
+	.string	"FEATURE_GPS"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF935:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1490:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1440:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1549:
+	.string	"__int32_t"
+.LASF1292:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1628:
+	.string	"OWNER_I2C_SDA"
+.LASF1550:
+	.string	"__uint32_t"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1401:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1667:
+	.string	"FEATURE_LED_STRIP"
+.LASF902:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1036:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1747:
+	.string	"vbatwarningcellvoltage"
+.LASF771:
+	.string	"USE_CLI "
+.LASF1674:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1740:
+	.string	"VOLTAGE_SENSOR_ADC_12V"
+.LASF1191:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1633:
+	.string	"OWNER_FLASH"
+.LASF1481:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1065:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1044:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1118:
+	.string	"IOCFG_IPD 0"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1380:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF845:
+	.string	"_T_WCHAR "
+.LASF1411:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF838:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1392:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1534:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1259:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF809:
+	.string	"_STDDEF_H_ "
+.LASF1130:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1148:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1497:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1166:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1251:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1806:
+	.string	"getBatteryState"
+.LASF1367:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1750:
+	.string	"currentMeterSource"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1143:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1041:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1284:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1350:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1645:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF1683:
+	.string	"AUX1"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF805:
+	.string	"VTX_CONTROL "
+.LASF1386:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1648:
+	.string	"OWNER_TRANSPONDER"
+.LASF1037:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1770:
+	.string	"consumptionState"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1689:
+	.string	"AUX7"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1693:
+	.string	"throttleStatus_e"
+.LASF1812:
+	.string	"cells"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF966:
+	.string	"Q12 (1 << 12)"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF816:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF846:
+	.string	"__WCHAR_T "
+.LASF1358:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1161:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1296:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1769:
+	.string	"voltageState"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1507:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1493:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1153:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF980:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF871:
+	.string	"GYRO "
+.LASF868:
+	.string	"U_ID_1 1"
+.LASF867:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1719:
+	.string	"CURRENT_METER_NONE"
+.LASF919:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1635:
+	.string	"OWNER_MPU_CS"
+.LASF1584:
+	.string	"pgn_t"
+.LASF1083:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1187:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1445:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1569:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF1708:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF877:
+	.string	"MAG "
+.LASF1699:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1383:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF985:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1033:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1464:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF928:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1020:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF961:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF986:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF779:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF941:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1076:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1613:
+	.string	"OWNER_ADC_BATT"
+.LASF1050:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF937:
+	.string	"EEPROM_SIZE 32768"
+.LASF1721:
+	.string	"CURRENT_METER_VIRTUAL"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1753:
+	.string	"useConsumptionAlerts"
+.LASF1316:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1771:
+	.string	"pgResetTemplate_batteryConfig"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF949:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1424:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1181:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1607:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1506:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1265:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1486:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1536:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF1521:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF989:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF923:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1347:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF817:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1781:
+	.string	"currentMeterADCInit"
+.LASF774:
+	.string	"SERIAL_RX "
+.LASF1599:
+	.string	"ADC_CHANNEL_COUNT"
+.LASF1485:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF780:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1139:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1533:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF893:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1469:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1223:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1241:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1111:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1114:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1663:
+	.string	"FEATURE_3D"
+.LASF1686:
+	.string	"AUX4"
+.LASF853:
+	.string	"__INT_WCHAR_T_H "
+.LASF1024:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1630:
+	.string	"OWNER_SDCARD_CS"
+.LASF924:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1577:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF1811:
+	.string	"isVoltageStable"
+.LASF991:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1180:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF965:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF835:
+	.string	"__DEFINED_size_t "
+.LASF1146:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1144:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1733:
+	.string	"VOLTAGE_METER_ESC"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF879:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1467:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1353:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1413:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1262:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1218:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1084:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1364:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF887:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1573:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF925:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1543:
+	.string	"long unsigned int"
+.LASF1122:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1647:
+	.string	"OWNER_LED_STRIP"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF968:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF804:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF807:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF944:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF938:
+	.string	"__disable_irq() "
+.LASF1502:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF912:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1489:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1028:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1055:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF881:
+	.string	"USE_UART3 "
+.LASF1792:
+	.string	"getBatteryVoltage"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1140:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF823:
+	.string	"__SIZE_T__ "
+.LASF1123:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1197:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1634:
+	.string	"OWNER_BARO_CS"
+.LASF1701:
+	.string	"BEEPER_ARMING"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1074:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1765:
+	.string	"batteryCriticalVoltage"
+.LASF957:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF1542:
+	.string	"unsigned int"
+.LASF882:
+	.string	"USE_UART4 "
+.LASF1331:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1301:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF970:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1431:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1217:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1082:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1368:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1612:
+	.string	"OWNER_ADC"
+.LASF1547:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1639:
+	.string	"OWNER_MPU_EXTI"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1594:
+	.string	"pgRegistry_t"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1501:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1260:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1775:
+	.string	"currentMeterVirtualRead"
+.LASF29:
+	.string	"_LP64 1"
+.LASF883:
+	.string	"USE_UART5 "
+.LASF1416:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1029:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1615:
+	.string	"OWNER_ADC_EXT"
+.LASF1538:
+	.string	"DEFAULT_CURRENT_METER_SOURCE CURRENT_METER_VIRTUAL"
+.LASF1075:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF934:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1636:
+	.string	"OWNER_OSD_CS"
+.LASF1821:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1457:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF820:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1008:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1728:
+	.string	"amperageLatest"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1746:
+	.string	"vbatmincellvoltage"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1500:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF884:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1263:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1885:
+	.string	"io_types.h"
+.LASF1870:
+	.string	"long-double.h"
+.LASF1857:
+	.string	"battery.c"
+.LASF1830:
+	.string	"src/main/drivers"
+.LASF1856:
+	.string	"battery.h"
+.LASF1864:
+	.string	"libc-header-start.h"
+.LASF1839:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1832:
+	.string	"src/main/io"
+.LASF1843:
+	.string	"stdint-intn.h"
+.LASF1851:
+	.string	"rc_controls.h"
+.LASF1882:
+	.string	"axis.h"
+.LASF1838:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1841:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1847:
+	.string	"adc.h"
+.LASF1891:
+	.string	"io.h"
+.LASF1834:
+	.string	"src/main/target/SITL"
+.LASF1853:
+	.string	"beeper.h"
+.LASF1878:
+	.string	"target.h"
+.LASF1868:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1855:
+	.string	"voltage.h"
+.LASF1837:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1850:
+	.string	"config.h"
+.LASF1897:
+	.string	"voltage_ids.h"
+.LASF1866:
+	.string	"features-time64.h"
+.LASF1895:
+	.string	"vcd.h"
+.LASF1894:
+	.string	"sound_beeper.h"
+.LASF1842:
+	.string	"types.h"
+.LASF1886:
+	.string	"system.h"
+.LASF1848:
+	.string	"runtime_config.h"
+.LASF1862:
+	.string	"stdbool.h"
+.LASF1840:
+	.string	"/usr/include"
+.LASF1827:
+	.string	"src/main/build"
+.LASF1860:
+	.string	"feature.h"
+.LASF1865:
+	.string	"features.h"
+.LASF1877:
+	.string	"common.h"
+.LASF1873:
+	.string	"typesizes.h"
+.LASF1828:
+	.string	"src/main/common"
+.LASF1890:
+	.string	"serial.h"
+.LASF1829:
+	.string	"src/main/config"
+.LASF1887:
+	.string	"flash.h"
+.LASF1874:
+	.string	"time64.h"
+.LASF1844:
+	.string	"stdint-uintn.h"
+.LASF1835:
+	.string	"src/main/target"
+.LASF1858:
+	.string	"utils.h"
+.LASF1836:
+	.string	"src/main"
+.LASF1888:
+	.string	"rx_pwm.h"
+.LASF1833:
+	.string	"src/main/sensors"
+.LASF1849:
+	.string	"resource.h"
+.LASF1852:
+	.string	"time.h"
+.LASF1884:
+	.string	"parameter_group_ids.h"
+.LASF1845:
+	.string	"debug.h"
+.LASF1875:
+	.string	"wchar.h"
+.LASF1896:
+	.string	"current_ids.h"
+.LASF1892:
+	.string	"io_def.h"
+.LASF1831:
+	.string	"src/main/fc"
+.LASF0:
+	.string	"./src/main/sensors/battery.c"
+.LASF1871:
+	.string	"stubs.h"
+.LASF1854:
+	.string	"current.h"
+.LASF1859:
+	.string	"maths.h"
+.LASF1869:
+	.string	"cdefs.h"
+.LASF1889:
+	.string	"sdcard.h"
+.LASF1863:
+	.string	"stdint.h"
+.LASF1883:
+	.string	"build_config.h"
+.LASF1879:
+	.string	"stddef.h"
+.LASF1872:
+	.string	"stubs-64.h"
+.LASF1867:
+	.string	"wordsize.h"
+.LASF1893:
+	.string	"io_def_generated.h"
+.LASF1880:
+	.string	"common_post.h"
+.LASF1846:
+	.string	"parameter_group.h"
+.LASF1876:
+	.string	"platform.h"
+.LASF1861:
+	.string	"stdc-predef.h"
+.LASF1881:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`e\001\r\f"
+	.string	"t\017Y\002"
+	.string	"#"
+	.string	"\337\374\225\265\016\034\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\001\002\001\002\003\002\004\001"
+	.string	"\002"
+	.string	"\001\240\342\234\212\n\002\003\004\005\006\246\300\251\343\t\002\007\b\361\312\235\227\007\b\005\002\006\n\253\353\330\347\r\006\002\003\004\013\f\252\315\215\326\r\004\002\007\002\004\016\312\303\303\372\0036\003\001\002\001\017\352\263\360\321\b\020\021\354\206\342\366\006\022\234\236\237\233\f\b\002\t\023\303\232\323\226\004\024\321\352\326\334\007\020\n\002\004\025\026\326\352\202\226\002\f\013\n\002\004\003\002\003\027\032\251\331\204\340\001\002\033\274\272\250\314\001\001\002\004\002\f\002\r\003\002\004\034\373\325\227\324\f\016\002\016\003\035\303\366\326\240\b\006"
+	.string	"\002"
+	.string	"\036\200\224\310\322\016\002\037\300\253\277\314\017\002 \317\356\361\267\004!\350\300\306\254\005\002\"\207\312\266\244\016\002#\320\374\270\356\001$\325\241\220\227%\263\213\266\344\001&\340\303\354\340\001"
+	.string	"> `\2021V\326\0160\332]\341e\246Bf\034\332\020\310\226\374\242\243\013\250\302\3545\230\2773jA\310\316\353^\340@\302LL\t\030f\377\310\257m\232\2733\305@\037\r\006\3057x\0065"
+	.string	"Z\300\200\262\242\247\350\272\022\241\241\247\017\375\005K\027<\213\373D.\200s\004S\002P\fX^8Z\210\200\326"
+	.ascii	"\020\300\b\200\312\031\237\271u3\245%\032q\006\032m\317\332\227"
+	.ascii	"\271\354r\035\343&\002\001\367\307e\254C\343n"
+	.text
+	.section	.gnu.lto_.ipa_sra.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375 \233\315\002"
+	.string	"\202\004\r\023\240]\016\377\377\377\377\003\360\333-\327\331qq\367J\222RNkV\223\232\323\224f\004\355\343\314\006p2\373\037\270$\023\231\307\032\253\027\223\330a\205U\361\n\017"
+	.ascii	"(15\343\362\214\264\022p\346\b|\200(\024\202cJY\001\003\324$"
+	.ascii	"\004\001h^\312Y\263\001,"
+	.text
+	.section	.gnu.lto_.inline.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\277\002\005\013"
+	.string	"rM16@o\222\016\t\021Uw-&\367l\317\207\322\377V\323\365uY\300\007\257\250\272\n"
+	.string	"\272\233\223\317\223\325\365\303\307@\332\017\226?\024Geh\350\215\277{\330\275[\n\213B\240\007\207\206\f\024\027\021\315\037\216\266\001{V\355\003\201\264\2573\203I\373$8,\265\357\363\302\230\262\302\310\204\345#S\346\317"
+	.ascii	"\236\n\243]\304\312\013\311\007\304\035\221\005\306\234NT\236"
+	.ascii	"\017.L\031T j\231\271\200\313\267Bu\027\035+T7qf\215\345s,\214"
+	.ascii	"K\217\215\226\023\301\330K\300\317-S\355\033\230C\302\rI\363"
+	.ascii	"\306\372\005\260t\275\226Yj\250\204\260d_\3778j\330\266\327o"
+	.ascii	"X\322\226\002\337\332\020\246m\350\021\316\221B\250a9EBs\201"
+	.ascii	"6\366\fp\002\231\271\262\016\022\300#I\001IRF\032#p\312\305\\"
+	.ascii	"\376\036\370\214qS\315\341a\3554\255V\342:C.\213\251\220\202"
+	.ascii	"\206\217\030\t@\276\260t\344\354\270\346\330\016,\3458\177\272"
+	.ascii	"<:\315\336\223E++]\275V\3570\260\331\211\260\373\3012]\017a\252"
+	.ascii	"\031\341jV\312r\031`\227`%\252\252\3379Sv'\017<L\300\177,\352"
+	.ascii	"\265o\301\205\351?\\6Sb\361\0370\256\255\322(\357#kF\2066g\321"
+	.ascii	"E\335\303+\022\310\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"\315\005"
+	.string	"\002J\036(\200EI\0073\260J\021P?3\204003:BH\036f[\230\220\2511\003\376\201\217\214\212?\031|E\266'M\312\024\377\344%\037y\310?\336\3617\030\377\342\025\177\242\2251R\256\345\004\200\231\002x\301\225\2157\276X[C\".\205\332t\350\r\377|a\022\220\003|\316\312U5FGFW\236\251\222~\332tF\302\017~\255E%9T\022wh\271\366\357?L\201\031"
+	.ascii	"\004+\310\243\340\250\2009gk-\023l\253\223*V\203\312^\320\225"
+	.ascii	"\341m\235\265\315\252\332\016\006+\236@)\210\261z\002\267\006"
+	.ascii	"\246\220\343\223DT\007\177Z\004M\200\270h\346V\200!"
+	.text
+	.section	.gnu.lto_.pureconst.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375 D\325\001"
+	.string	"B\204\r\026\240\3250\006\177\372\377\377j\325\003\376\277m\333=\231n\265-\2052.\360\200\003|r\311#\007\271\3079\3368\343\026\2278\342\2073\\\341\204\033\234\340J\251\252A"
+	.text
+	.section	.gnu.lto_.ipa_modref.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"e\004"
+	.ascii	"R\205\017\025pU\r\007\374\377\377\277\353\213\355\366\311b\257"
+	.ascii	"A\374\276\2202\005\003\226W\356\224\367\273\326\330\342I\231"
+	.ascii	"rs\310:W{:\214/\211\244\\\225sxa&\324\211\312\221\316S~\032\\"
+	.ascii	"\314@% \320\002\031;\017f1/X\033X\3719\211%;J\320\002\307u\215"
+	.ascii	"\230+/B\307\211\216\b\213a\036s\2076\002\033\367\277\350q\325"
+	.ascii	"\304\206\323\237H-\0017\375dy\203\030A\360\321\314\340\034\303"
+	.ascii	"f\204\2060n\006l+\212\033"
+	.text
+	.section	.gnu.lto_.lto.65797e904e921ecc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_batteryConfig_Registry.60.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375 \210A\004"
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\303\326\301\027\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001"
+	.string	"\005\001\212\001\202\200\200\350\345\005us"
+	.string	"\005\001\006'\001\024\005\001\006'\001\213 ?\202\210\200(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.text
+	.section	.gnu.lto_pgResetTemplate_batteryConfig.62.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375 w\355\002"
+	.string	"T\004j"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\005\001\006\177\001"
+	.string	"'}{\035\0017#!+?\202\210\200\330\001yw\305\001u\304\001s\303\001q\302\001o\301\001m\300\001k\277\001i\276\001g\275\001e\274\001c\273\001"
+	.string	"\n"
+	.string	"@\004\334\005m\200\\\312\261\227\226\232\013"
+	.ascii	"1)\267\f\240\b"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.63.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`2\002E\022"
+	.string	"\366`wH\320\224M:V\r\007P\n\003\341S\302\311\225\367\225\025\350\374\005\360\350\237\276\266\201P\241\016\001\005\310\331\332\266\2254~Z\254u/V\344\206\225\350\rn\"\201\003*\261\236#\335\004\216\207d\353\224\205\001\033!\204l\231Rc"
+	.string	"Z"
+	.string	"h"
+	.ascii	"-\210\212vK\005N\220z\207\362\225\367\216{\211\367\3161;\310"
+	.ascii	"\313\235}P\017\233\033M\273\013N\030\217\375\363:nj\314?\260"
+	.ascii	"C\204\264\311\376\245N\334\263\t"
+	.string	"\241\235\201'\356@\347f\254\340A\332n>\271\325\221\013 *\033\215C\200\343\303\004\211\255\246\3729\330]+i+q\247n{\306\266\004[[\001[[\361k\334\306\313\347y\347\031\032=\371\316\247\361\336\351<I\372\231i\224\277\036$\0024J'\246\325'\273\244\351|a\237\333\335\365\324\261\377\363{S=U\255\252\226[\323\322\311\217\335\021QF\366\326\345\220a\373\366\313\230\255\262MR4\270\036\310\357\271O\354?5\006\260\033s\256\222P\350\320\rRwdeT\344\n\026jP9\233\022@\310\351\246FC\216Xp\237\220\001\372\362Dajwv\322\037:\216\013\030B=\031z,\317\0265\200\2302\177L*\2657\304\350I\243\320\246\314$BK\251\235%\261\273)-\037%'%\231B=\006\211s\233\377\340\3514\tJ\252i\021\333\256\007uHm\316\320j\255\204\fBQ\245\344EA\214\201\231"
+	.ascii	"\223\021\307q\206%\300,\025\017\243\b\203\205/\340kt\275d\304"
+	.ascii	"\027(\003\023\306\200\254\361\005\252\234\330\305A\034A\230\313"
+	.ascii	"5\202\252rvn\247\216!\250\270\315&\355+\240\366\203\bs\312\354"
+	.ascii	"M\273FE\324rvw\201\352\223\247g\361\346|\271\216\357`\361y\334"
+	.ascii	"\342\342\342\275\013- \220\002!\252\262\r\311*8\033\272Mb4By"
+	.ascii	"/\317.!\\\274T\"\3337\262\241!\373\310\023D\026%q\256a\234`\017"
+	.ascii	"\006CoG\023\204\213\220\232\275\222\250\340\001ox`^\032-\021"
+	.ascii	"\001S\007\351\232\301\024\213\232\005m\360\336\305\007\333M/"
+	.ascii	"\212\372a\fho\373qG\230\264\363U\236\343n\244-\206F\200{"
+	.text
+	.section	.gnu.lto_updateBatteryBeeperAlert.64.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`s\001\025\016"
+	.string	"\266\230ZD"
+	.string	"\2216\035ox\3713P-\320\003q|\323O\367\357\211{\r@\036\2622\2513PZ:\f>\360]1\232\375fT\342\200F\\\300\337\037\f\366\256Z\377/\375\021\233\021w\002\205\257\037R\330\357M\266L)D"
+	.string	"G"
+	.string	"H"
+	.ascii	"6\366y\314 \233\346\241\312nJ'\022bl\354n&3\034\364YI\005\371"
+	.ascii	"\n\216\336\327}\0268Ugy%b\245\206\367Y\270\024\215,\001\340\214"
+	.ascii	"\206\3533\221\2729\260\273V\357\253p[\267\255\300\266\001\373"
+	.ascii	"b\037\353SJ\217\225\223\220\216\376\313/\231S\007\251\006\225"
+	.ascii	"\242\241&\0173Vk\354P\244\262d_\216\343\230\262L\261U-\255\013"
+	.ascii	"\206\214\017\231\335\t\343\215\025g\013\016\266\357\273\374\245"
+	.ascii	"\344-\2260+@\354.\366\351\273\224\004\246\020&~}\020;\305qp\006"
+	.ascii	"|!S\370*\324\352\255\t\206\016K\212\361O\230\206\263\333\035"
+	.ascii	"\345'\261>5\300F(]@\355\332/\341\243pT\226\302\206\373q\226'"
+	.ascii	"8\221R\250\221\346\260\037\236\004\211\277\301\020>z/\026\001"
+	.ascii	"\371l\035\217'dA\306m\0327\322\341\262\021\006!\r2\221\215\313"
+	.ascii	"@\006Xs\320\3312\217\246m\031\026\206^\255L1\202\030bH\212|\230"
+	.ascii	"\277\332\335\235.6,P\034\200iDu\265t(\347\232e?\340\364\236\t"
+	.ascii	"\214dg\217% \220\002)\302]\f#B\003(\006\346\340\317\36583\246"
+	.ascii	"\027\237A\225\314W\2323W0\235\270\203+\266\354\332\234`v\351"
+	.ascii	"\225m\361J\261=\246l\373\261q\304\206\3530\303\264\245\304\340"
+	.ascii	"hg\315h\204\003\277_1\230\016\324\370-H\007s\\\352,\272\354="
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_batteryUpdatePresence.65.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\006\t\245."
+	.string	"\252N@\021E`\246\326\030\303\237\216\247K\237\027\247+_\213\035^\322\345\252L\\P#\255\361\367\377\234_S:\274!\b\320\372,\006\032\3771\253\260\363vC'\336\302\"\377~\034Cz\210\020\267e\311mDJ)eJ)\005\376"
+	.string	"\346"
+	.string	"\n\001\356\352\334\256\316\254\352\274\252\316\252\352\374\357\354\357\334\007\212\336\2326\234G\276\f\332\333uG\347}[\257"
+	.ascii	"\351\264vw\346&\326)\340\216r\253\261\217H\247\2254Z\262\323"
+	.ascii	"\b\270Y^.\224i\0276\025\334^\213Md{U\273\207\355\265\033\312"
+	.ascii	">\"\033\005\006\016$;\t\212b\026\332\333e\300\207\231$q\336\027"
+	.ascii	"m\251Wfr{\345$\263\232F#{{z\2665\215\363\276\257\361{t\262\207"
+	.ascii	"\302 p\347\347\353\361\334\226]\325\367$w\322Y\023\346WV\017"
+	.ascii	"\237-|B\311<\bl\372\316\330\r\377\301y\215\231y\331p_\273"
+	.string	"`\215\233\322&\007\330X\367\220r\200\321h\036\r\265F2\363\232\341n\233y\211y\273\345\254Z\240\371\005F\303y\325P\211bt\240Y\372\032\326\252\357k\205?\360K\205Z|\337\267\241\355\\_Z\356\355\202\367}\331\231_`\315<\315\334\016\230\031\003\263\373!\253\373+\\\234\034\261\2650\270\216&\215\240p\227\235\244{s\336\224\353;\325W\177\007\253]\202m\037J\352\346]\202e\277\375^6\327g\277@\032\365\377\327\357e\020-\277\343~\365\207\342\374\377{\313\216\371\251\241H\271\357\373:q;\351'H\356\262^YDT\024\333\253\177KyF\225~\327\376\276o\326K\261\375Baw\3223*|\016s/\351\251\024w\031\237\240\362f\366\312M\365\t\302\3424\241bJ\277ca\333\026\237\266 r\346^\257cF\323\362w2\267\372\376\016f%\3259@\2475'\2753\222\353\\l\235\217\\g"
+	.string	"\254\263Q\353\\\364\316D\255\363\320;\013\275s\320;\003\265\316?\357L|g\237\326\271\347\235yZ\347\241\352,T\235\203\2523\260u\336Q\235\177\357\354k\235{\357\314c\235\003S\240\347\371\240g\335~\036\250A\247A\363\363\315\344\031m#\376\031)\007Tu\230s>\317\363\304g\331\226f=\357\363\240\315\224\351\371\236\312E\207\317\363,\333\360\271\307t\034\204\b\022$\260\275v\322\017\377\331\266\354~kX\336\032\216\302\2631\347\272\003\033\206\311\f]\273X\263\222\364\013\224\275w\022`;\2555\340"
+	.string	"\256!!\212\321\201\206\3476\263\261\302\267\222\202\371\255\025Q\372N\353\242\322\353X\370J\357lL\035|\341\023M\227M\340\377>\370\254\224\345\221\235\007Zh/]v\276\247O\336\377^\255\263e\247T\353\bC\340^\257[Rk\262\305}'/u\200\377!\302m+\272\202\264\357d\337\363\036J\n\246\367\276\013\275\005\203\373\276*\234\270\265t\233\206\r\0348\260\275\366\376\200\\4\013\026\336\267J2g\375\203\331|c\337\311\256.u\2106\273g\352"
+	.string	"\317\365\335\201u?(\206\017\251\034\225\256\322\301\303\361\310vWSS\310\247\225\241B\204p:&8\"\233z\220S \216X\027\220\"\216XSU\031\256\242\202\374\324d\302\n\211\205u\004a\274\262\252\272\032\201\2742\216\210:R\031\237\254\256\214MF\\E\002ie\304\252\252\2622\372\320\224\255\276\277\203'\byS\276\026#=\fO\303\234s0\377B\372\001r\321\261a\361\231\271\311\273^\034}\321\305\321\f"
+	.ascii	"\277\345\314d\221 \331\373\276\b\330Yx\213\344Y\022I\022\232"
+	.ascii	"\2046\263\031=\200o_a\364\304\247\330"
+	.string	"\024\031\302w\2627\004\266\350AH\345\270\307\2702\251DB\321\023\345\246\204\301\275A\177\005\220\321\3351i\273#3tu\032\002[gDFWgE\016\034\337\033\226\302\203\007\027\020\b\3324\242D\211\261C\364B\017%u\033z\"7tC\357\364\234k#\364\255\022\216\023\231!V\366{\247\225v?\205\364LC\273_pq\311\0025\362\364\275\223\273\314\013\030^\273u\223y\371\341*}\322s1\007\255a\240\006\200\300\250a$g\225R\246fD\202$\005I\322\030\240\002\221\231\252\352\0210\255e\206L$\032\306\353\264N\017\206*\3318\300\031\321\262\242\364E\0012\333\216\200\215b\241\335\350<\376tf\001\260\252\245\223f\002\2375/\334\301L\204@ \231p1\321\267\260}\304\334\004\376\310\025S;a\033Q\240\3131N$r^YG\311*\\\342d\257\326l\204\230$\333\315vk\2625\027\230\212"
+	.string	"\023\257\020\336e\241\254\023l\225\207]\241\340{\006V@\236v+\004m\"\373\300!$\332\213o.\246\r\270x\006H\207l\214(\263E\345H\340\377u\202\t\f\346\314]6'\252\013@Em\t}\336\004\006\203\244\355lW\317\376\357\240\272\230\021\317?#\003\355\020X\200\226\327Q\313\373f\252\364\313\201m\004<\316%\022\266A\262\026IZ\244\022\276\335=\177G\215\364\366\001\303\020\350%cPV\244\345SH\352\rP#n\366\320\353\364\202x9\256\022\022'"
+	.string	"\345 \fp\331$Q\256\337\302\271\225\377\037\177\266\227\322\303AeG\221\357\020\213A\314\275\310f\214\276\371\304\035\036\366Z\371@TH\344\244!\333h7\262\276\321+\340}-\365)\307\207h\177\334\275\017Df\317=\362\005\340O\204\363\206\334\342Rz\356\227pwPj\334F\007\214@\023\324\016t\235GcF"
+	.ascii	"\304\253\301\276Rb\321-\233a\376"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltageState.66.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\315\004\345\027"
+	.string	"\306h\216K\320\360(\035>\321\004R\211\2606\330R\003\2743\265\271\001\037\362oK\320\034km\310'J\341\274\\b\356\024\365k\332W\333fg\373')\035t\333Q\352a\324\343\345\216\001O\203\035!50C\277\352O\b!\204\020\"\245L\001x"
+	.string	"k"
+	.string	"|"
+	.ascii	"\017\233\337\314\347\345\257\200\324\213\212\004H\265Z\b\322"
+	.ascii	"\250?QH\303\377E\257\362+mo\246\2222/4\037\031\265\326\264eV"
+	.ascii	"e\321\323,\311Q\f\233U\276\344\312\254\335V\026=Anl/l\22676\034"
+	.ascii	"\223\344jD\335h-,"
+	.string	"\202\350\\r\033&\331r\341\007\3162\205\333\214\033\003\313y\223\215\252Z\353\352l\271\220\311U\255\365\\\273\271\354O\373\037\305\177\004\177\250\023\036\266\306\246f\330\371\362\\\251\334\223q\305s\255\322`l\376\355\375W\352\013,6\324\272\2620\\\253\007>X\270\306\277\034\226w\362\2559,\205\267\266\3427e\\q\333\304\3058x\366\341$Uf\372{2\356\335\277a\355\230\237\371\035\314\347`\276\252\371\251\346\243B\376F\363O\314G\233\1772\337l~\331|2\344\217\315\027\231\003{\362\021\211\275\373\236(0\023\003\200\217\304{\265\326\260w/u<F3^:\331b\227\355\001\324b#\343\340\307&\027\254\t\006e\2553\221\257\320\226h\340\200\305\032W\034{\207hxa\213\033\264#HFZ\255q\305\260\267\007\330\335K\253\021\343\340\177\b\013DR\326ZE\276!VD\204o\315\212/q\271\306\025\271\t"
+	.string	"y(\237\316vXT\316o\205\233\266\177\276 8\307\347\033\037\t\231\360j\241\240\260\036\244\260\227\013f\322\202\245&$\254\222t\344\005KC\006\334%\241\365JQ\\\256W\212\366b\033n\307\340l\031\224\373\305Z\366\325\331\257B\364E\323\331\321\034\275:`G\033"
+	.string	"\342\\\264\340`\372\260'\337\fsg\005\214\262wW\265\331\313\3439\232\361R\222\252S\032\\\200\nH\344\317\317hL\365\211\352S\247\332ch\243QGF\033\275C@\264OE\nZh\257\017\215\331'Q\n\263\250'h\250Qd#\021\243\031\222\242\224\n\215\001\340\002\021\251!;\021"
+	.ascii	"%eJ\331T\250\032\007\022\r-B\221a\350d\021\244\220\241\016\265"
+	.ascii	"\304\257(VX\002\2200\0227W0,\303\303\013\2518Gm\007\373\3360"
+	.ascii	"\202e[`\262\305\214\223\177\365\313I\232+K\020\360o\327+\242"
+	.ascii	"W\341\321\025b\350\017\336\236\372\201\367\370\206\341\202\253"
+	.ascii	"\267\b05\360\250\320\013|\275\031-_\312Mi+\206O\247\346<\207"
+	.ascii	"\267\3054\n&\255\033\217\0137\376\305\0036\266\307\352\367\250"
+	.ascii	"\220!V\007\307CMYx\320a\377\205\273\347>\b\004\237\307\\\311"
+	.ascii	"D\0041h\374\213O\215\307*,@\201\213<\271\022\\`\261P\003"
+	.text
+	.section	.gnu.lto_batteryUpdateStates.67.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"e\b"
+	.string	"\242\01776@o\323\001@\201UL\271T\035:\343@Q\030\2326\021T\240\206\241\273\355=\262D\261\232\246\201A\355*m\362\362\030\037\304e\bX\335\302\251\325~p\b\2212\245\346h>\331\245i\233\005\0303,z\256\b=\f\233\016\344d\021j\b\2149\\\031\3240,\203\231oO\255\212\024F&\220vV\035i8\361VR\257\252\227`\351D:\251\030?\344\037\346o\370!\346\275W~\004xu}\211\206\005(O\266> ,\017*\355OD\336sA\247\234\263\324\221\262\351b\177\\\352\205}jUd?\255O\347\323\027\260@P\020H\273\024\247\2275U&\034\266\237\361f\253\374\313\330\223J\023$-\273\013\025\343\333s\363?:\306\013q\317\200\204\335uz\241\212[o\333\300\366\201\375\201\023"
+	.ascii	"3\241!(p\371\335\001;\320\030p\227\324j\340\030\020\202\347\214"
+	.ascii	"\021u\037\224\233s\261:\333pad\031,y\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_getBatteryState.68.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375 \376\365\006"
+	.string	"\302\31514`m\322\001"
+	.string	"\255 \324\264G\315X\255\234\216G\253\251v\332qN)\202i\r\365\036N\262\033\350*\241wI\262\313`\214B\236kU\277_\265d\023)S\n\316\\6\260\3020\214\302\273\240ui\252\353i\0260\f/\003\257w)\260\325P\301\207Y\026|T\334k(\325\362Q\007\373\036\217\231\217\341\r'\257\335\371\234\351.5\340\"\342\223#S\023\233(v\364\244R\330\227vw\255!\333\351T\201\021\023\004\220\335\207Q\312\2268\221\f\373\242\216M\371\033\347\3508\223\242\305\006"
+	.string	"\"\001}\234\354\306g9\301t'}`\272\323\212g\317\314\177\307%\rQ\210\266y\236\225\204\335uj\033\304\255\267m`\373\300\266D\007"
+	.ascii	"2\001/8\003\\\034 ]\346\311\f>\334\025S;\311"
+	.text
+	.section	.gnu.lto_batteryStateStrings.69.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375 \314\265\005"
+	.string	"D\nq"
+	.string	""
+	.string	""
+	.string	"O"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\237\366\340\276\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'9\206\b{\by\276\002\005\001'C\206\bwu\301'L\206\bsq\303\001"
+	.string	"?\202\210\200 o3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\fNOT PRESENT"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/battery.c"
+	.string	"\tCRITICAL"
+	.string	"\bWARNING"
+	.string	"\003OK"
+	.string	"\006"
+	.ascii	"O\221\006\001\003\302y\346\321\240\362\033@\021"
+	.text
+	.section	.gnu.lto_getBatteryStateString.70.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"\335\t"
+	.string	"\246RD< \345*\035\007\026q&\001\267"
+	.string	""
+	.string	"4\365\253\033y\004\n"
+	.string	"\351\021\244\204\"\344\253\300!X\371\177\334\274%\250DUj'"
+	.string	"0"
+	.string	"\300\0240\3739O\203T\001\213\270\337\222M\366N)2"
+	.string	"/"
+	.string	"6"
+	.string	"\247\203\372\321\312\310`2b\001v+u\275\001\367\251y\001\367)=~z<\371\207}\033\020\312T\254\213\307\314\303\356:\252X\255[\336\266\202m\006\373\233\366\267\225.\333\321RF\307m\023\323\342P\333]\325h\3132g!~\370Z\272\211\005R4\221\335\355>\375\260dw\237\267Mv\347\223\274\304\344\240\355\257O{\"N$\017\373\002"
+	.string	"\332\310\314?9\n\350\277LA\212W\221\270\317(\t@6P\261\346\327\017\250\254\270<\3745V\341K\307\261Q\200]SQv\004\366p*\276\317h\324\201\240\340\347\201\241\017HC\021\035\020\365| \345 \330\233\370|t\344y\037\355*\352\333J\227\224\t(\231\262m\213\313$4\273\030\r~\354)\001\017"
+	.ascii	"2\241'h`\265\204G:Wj\342\030\032\325\036\342\276DL\t\3225\021"
+	.ascii	"\211\211\034U<\205\212L\334iS;\311"
+	.text
+	.section	.gnu.lto_batteryInit.71.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\004\265\026"
+	.string	"fd\205I\300RRc/H\373(\021\254;\250\021\354v\253\326\277\3206G\205q\241\035\300?^~&\341\005\275\353\345U\332\346S\t\017|\332\267\240\347\270\322J\245\342\020\361|\025\306\300\352iC\256\243\303\344G\210\325&ro)S\nq"
+	.string	"j"
+	.string	"w"
+	.string	"/\231M\351` \274\367\303\327\220\033\034\177E\266\037\263i\017\3374t\377\304\225\343\244u\357-k\211\233'av\024+5}*\365t\362p'\253`\"R\026%\312\027\264\343\3631\247\303\b\017\307\0020\020\244\343#\212O\272\270\"Jx\362z^E\331V\316U\214\247\023\025\340h\001\221\360v\224\302T\356\275\246'o\347\026\271\355\037\333\bl1A3,\370D\037}\241\245\305~\264]^\350O\027\330U\234\351\017\t\306c\300\320d\b\370`\254\377t(\230\030\031\031\373\361\004k\304\231\3564c\022\302\257Y\277\305]\3244\334n\366\243"
+	.ascii	"\236z\033\353+}\311\306'\362\206\033"
+	.string	"\372\363\243\177c?\232\f\t\311\321/\323\037\317\352R.\273Iw\361V\022\366\305[\205lJMO\035\270\213\210\365p\250\027\212\3570UXQ\257\003\301\025\034\317a*\231L++\r\034t\331\330\252\007O\372\310\217\213\236\027\305*8\332%\226P\r\2406\204\b\272\2123\311\357\0069tun\357\242\310~6\2028\332e\341\324R\257\236\203}\r\360\"kG\267lKx\215\t\344\275\273\005\376\357@\n\025XX\354\307\327\223\254\245\222\0233z\026\237j!\357\315\375\364\245\036~I\271\261\321jj\\0\2247[\355FC\273\22541.3\345\213\355V\246\234\270\226\201f+kj5[\031k\312]|\025\"\2014\202\271\252\363\257n\025\2214Qt\004\3442\240\017\006\344\003\221u\031\360'x;\3531\217\200<=>\323\371\030\304\037V*\037\376\017*\303\350\366\204>\226\207\344o\"\331\217\246\347\365"
+	.string	"et\036\266\207\265g\230\342\336g\250Q`\212P\025\215\224\024\224\024\322\030\340\002\021)\242\007\02109\204\216h\nY\326\222Z\212\022VV\203\274\273\001\022\242\357\330"
+	.string	"\211D\370\023\321\322\252>Im\376P\262\344\362\261<\346\326C(\323\207\006\035\320\207\364\311\2670\020\004\233u}vwy\250Ob'\211t\216\205a\254\371\202)\326\261\3306t\251[l\005\243\b8"
+	.ascii	"\200\350o\302\336\024\257\fUS\240B~\005WV\366\262T\262v\267\377"
+	.ascii	"\321\2715\240\321{\b\245\t\005\2228\376$\261\210L'\314A#H\242"
+	.ascii	"\200\005\202\002s\th@\221\233\007*\322\013\026\242\212\031\f"
+	.ascii	"\222\021C'\367\327\212\273l\312\345\203\320(\247\n"
+	.text
+	.section	.gnu.lto_batteryUpdateConsumptionState.72.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\347\002\225\023"
+	.string	"&\342yH\340\320(\035sJn\222\375I\224\331\250q\f[\325P(R^\007\035\003\034`\031Y\b\203'M\376\367\327\037\036#Em\324\372\003\3702\346G\b\310c\3142\313\034\360\272H\001\341L\231\220\023\330_\373\t!\204l\231Rd"
+	.string	"`"
+	.string	"d"
+	.ascii	"\273\345\201{F\020\336\373\311/{\306K\234\005s\212d|r\354\256"
+	.ascii	"8C\374uS)\004?\257\233\372\362A\223\322\214\026s\323H)\034\232"
+	.ascii	"\361\320\211\224\230\251Q\0204\001Ac\363\317\203&s\242eP\017"
+	.ascii	"\203v2\235\267\217\f\315\330t\"\273\373\235\253\006ZL\0254\331"
+	.ascii	"]\353\214Fs\237n\233\307v\004[\313?\301\nwe%~y\236\n\276\316"
+	.ascii	"=\267^\364\263{\376\313w\357\223@\316\r\2469+\016\306\320*\222"
+	.ascii	"]\306t\326\354w;o\354\333n\260Sw\235zN\265\252\372'\220$\031"
+	.ascii	"\f\202v9\344v\254\220\0074\342\266\337~\310\315\211o\302\277"
+	.ascii	"\371\024R;I\240\340u\033L\270$\300\237\034#\032\00187`\232\263"
+	.ascii	"\007\256\3067k+\016N\262\207H\246G\006\200\013\272\bL\221\374"
+	.ascii	"\2416*\245\237\201\363\266\017\261\031\343\337\376\r\270\030"
+	.ascii	".w\327\203\371\346\fp\273\212\377\300\370:\036U\252\357\336\234"
+	.ascii	"7\"\252\201iN\337\315\232\337\362\351\324$\226\247h\361\321y"
+	.ascii	"\024D\272\2731\363\027\276O\225\236\"\231\036\331v\t\236\260"
+	.ascii	"\262R\202Z\200\032I@T+\226\321\301\250B\271Vc\212\034\033\fp"
+	.ascii	"\212\304\0029\272\\(\025\261E\262Z\253\261%\256XP.b\212l\211"
+	.ascii	"$\005\314\2420\222\242\213\305\"\305S\t\373\274\361\316C\\N\b"
+	.ascii	"6c&\277\320Q\272\013\034\037\273\033\316\232\301\331\315\213"
+	.ascii	"\350\tzp\034\004\240N@\007\033\240\036\345\363Y\274\005\212\204"
+	.ascii	"\224\224\357\236\201? \260\002)\242\262\003\211E\234C\232;\213"
+	.ascii	"\334\266\207\311~\356IhOc\273\322\357j\307\274B\276\300;l\356"
+	.ascii	"A\031\302q\320\342\246d\013\3056\230]\357>x(\213Q\236\365\321"
+	.ascii	"\005\030$\f\021\216\256:\260m\336\275\301\253D\227\341\354YN"
+	.ascii	"\265\335\016#4\343\243h7\231\250\223\205KY\t 6\r\306\233\350"
+	.ascii	"$\306\0265\360\351\025F~\034\225\361\234)0\301-\270\321^\030"
+	.ascii	"\n\241\267\033\r\255F=\032u\370\030-\003"
+	.text
+	.section	.gnu.lto_batteryUpdateCurrentMeter.73.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\277\007\265-"
+	.string	":O\224\021G`\034R:\367\364\247\356T\264X\005'\253\320\017\0165\333k\033b\\-h\222\254\311\223\303T\310}\033\2314`7j\002\376\006\313\202.WOW\242\375\246\241\037\3268\332>\317\302<\364\\h\373\2374B\310\336I\006\002\001\372"
+	.ascii	"\013\001\335\300\206\272\225>\226k\361mq\211\222s\006\232eI3"
+	.ascii	"\313B \006\333f\263\234&i3\013\263\313\371ItU\230\305(\275/\203"
+	.ascii	"\372\225\247\364\231\257\202\310\262\250\354\330]\355\023'\203"
+	.ascii	"\352\006^\275\037k\240\220\032\243\356\347\fvi\305\236\301\371"
+	.ascii	"\021\3159\023]\355\016\354\325n\241-F\277\335\017;\225\366b5"
+	.ascii	"\332\227\263\226\0334\347g\203f\300^\035z\200\365j\372\240\365"
+	.ascii	"j\267\335s\177\"\311\337r\203Yf\227s&\342#o\017\374\371\330\336"
+	.ascii	"\252\246\370\266\375\345\201DnL~c\240aR|\275\243G\3718;\324\304"
+	.ascii	"\312\307\355\245\013\242iu\016g\205\225\006\330\261\244\3714"
+	.ascii	"\346]{Gc\307\320\305E\247^\313\n\b\325\357\312\306\n\300\200"
+	.ascii	"\226\325\2174u\320\026\r\273\323\342\001\3448}`\303.\313\347"
+	.ascii	"j*\r\332a\252\371\330o\325\225\324\275\275\243\234s\337\346\025"
+	.ascii	"\217w\360\335]\246\273\275\272{\t\0027\363\301/\373P\324\311"
+	.ascii	"\274\314\323\021\004\210\365\352\305\b\234\33450\214\3455v&\025"
+	.ascii	"f\t\357\255\\"
+	.string	"L\t6\347\2507\373mwC\352'\271\332#J\224XO\240\270o\366\320\024^vp\r\b\\\267\201\2129q\247X\217U\220\305M];\335\377r0)\372I\272\230t\337LZ\257\036\017\271\260\242n^\013\261\340>v$&_wu\371\336\351~J]\274\325}\234\227\227\227\327\330H\267\357\366\360ho\341\241\357\240\337m\240\236\333?\027\373}zn\377zn\373\326\333\254\357v\257\347\366\032\274\255\256\267S\340m\374\273}}\267_\340S\276\354\350H\260\345\274#\017O~S\325\274\216\366C\317^\334}\241\250Qs\271\227\2475P\210\016\n\203\206\230\2670;\"\354U!<\007\020\332wI\262\371\253w\326\245$z\203\275\032\340\006\232\323\320\3243_\231\020\023\r\263\223\361\263\353U\025S\340R\363Y+\243\326\"\311R\275\313C8\243\356\235\325\207\267\336a\206\254\305a\223k\212\203sdo\022\\"
+	.string	"\177Z\273[\260\366\311}3\305+\025\347\024^\336@\033X\217\336a\254Ax\tM]\032\030O\332\356\352\202\360\241\007nw+\245\235r\337\f\302\257\342\224\302\313~\332\257c\315-\356\3015\266\267UMN]K\005\205\020:t\177pw\005\013>kU\340\330\374`ov\321\345\305cS\025\215\242\342-\271\376\\\3175\230#$\013\337\346\233>\234\333\267\231\253\272\276\262\263M\337\315\177a\275\372!\273E\303\024|M\347\274\274\020\026Iv@\306\231\025"
+	.string	"\2356n\236\356\306\3604\031\330\234\247\"\364\321\034N\003\007\017\036\326\253\030\017\343\304\246\300\3453\002\270\262\326\240\374\340?\315\312\376\261\377\270\300\234wQ \374\203{t\230y.\366\301@x"
+	.ascii	"\027\252/\251\233\327?\273zFK\313\337\003K\224\034t\344\340I"
+	.ascii	"'eQ\031\342\305Q\031\002yT\0369(5Ux:n\020\2404&\227\226<\030"
+	.ascii	"](\225G\344\n\245\217\212\367\212\242\244\013\026J'b\323\221"
+	.ascii	"\211\351\230D\240xe\005\243\262\250\364\002I\231,\272\b\366"
+	.string	"\222\222R\204\342\204\242\261((\211ddb!B\331dD\"\235\222z:\251\b\niT*\213*\210I\3441\331dL\022\233X\024\231\210I\310$\261h\330\307\027F$Qy<\"\211\300g\324\323\214\215\364\305R\3758\357\2434\013hr\253n\223\215\211\232\343`\013\362\266\274x\375\303[}Y\242\007\345\236\230\3511\370\017Wu\013\347\250]\346\245\032R\007G\274B\374\303>\334\026i\267\230x\331,\366\3413\363D\r\327!f\361\323\016$\307\004\223~\270\366\360\020\367ebI\335\274\233S\264G\222z\370eqXtpB|\264\030X\3570\353\212\205\370\312Q\tQ\361\212\323\242\343\265\\l\316YB\377\316\361\264]\255\222\326\253\365\n\200\233\250a$\350\030SfjDDR\320\026\206\003`\002\221\2612z\020H\247h&Ia8\312P\212d|%\26149\322\211\020\032^\026\352\250\310\332_"
+	.string	"\357#\367\215cw\277\310I\024\3369I\022\367\236\236\307\254\205\337\223\202\206\006\352\2672\244\255\323\310\364\374 9Wb\252 \370\323t}\2222=b"
+	.string	"T\315 \0334J\311{h\350\300\204\345\361\242\305A\032\344T8\223\214^9\222`\332\b\363hl\003\227?\031'\371\242\263\334\205\372\242\025\t\2658\350\0271\036@G`\350[\274\013T\330"
+	.string	"\216\317X>\330Y\034\216\361\376\311\344:\016\335D\343\350\ng\240B\265\206E\345|r\234\273"
+	.string	"R\361\027\314<\331\030\204U\356\377\224\201\242t\320\326\374\236\333w\250\246\345\rO\305P\027\027\314\0212\036\336\207\220R\375@\304&l1\244\322K\211\241e\2404\031\375\025\244\332\262\004\003\336\220\300\202lq\377\227\222\341la\264\264`'A\322g\221\252\247*V62\316'\367L6t\312\345\264\254\367\277\267?\302\351We\377B\"\266\273\025\027\320\350\367\312\233Q\024\324s%,\004="
+	.ascii	"\b\350>\221Z\2567]\324nE\264\253\001"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.74.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\r\001\375\f"
+	.string	"FXWC"
+	.string	"\2216\035\300\220do\313\213\276b1\002\245\365\363\320\231n`\243\263(\375\323\276\330\300\317cz\362r\005"
+	.string	"h\304Et\341w\230\374\222k\335\275\267\227\0279/\264\032\017\370u\372\201@\237\354-eJ\001C"
+	.string	"D"
+	.string	"A"
+	.string	"\036\301\357\003\313aV\\@1cw+\217\023\230\036\341;\246G\365\360\355Ps\3633\0338\342\205\005(\3449\2446\\\005\204:\350\261\273\027=SB\237\314\314fw\235\240\220\206;\336v\003\333\016\354\217\004NR\t\027\233%\373\373\244\256\330\207\253\035l\275w\347\323\217\033%\016* \304\330\305\020Sc[\304\024!\356\335\376\267q\f\020\301\300\276\350\236G\224'C\001\0130/2v7\301\243\025P\217~\313Il\016\320"
+	.string	"\322\306(\344A\251\252\236\247\352\212\311t\rqy\321%\r\333\332O\230P\273\335\207o\342.\025|\226G\237\240\344A\217>\312\364x5"
+	.string	"\302\3432\306I\022\215\356\354v9\004\367\276@\205\313R\216 \"\362a\201X\227\246#\273F,\316\203"
+	.string	"\346hN\262\253\323\261B*-\303\264\222K\253J$X$\025'\323*\315\001c\023\256\254\352`XVq|\334\241\246\222\264\300\310\177WM\261\255\n\242\302\351\307\027}\203D\322\r\027\031"
+	.ascii	"<\213\231+\213\033l\203\021\207-\234dw\201\246E`&c\006\3660Q"
+	.ascii	"\205\035\3135\031\"5\210\2730Tm\2700\226\214eQ\314\351L\263X"
+	.ascii	"\276\250i\200\273\320\250q\206\032\262]\245\f"
+	.text
+	.section	.gnu.lto_calculateBatteryPercentageRemaining.75.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\331\006\275&"
+	.string	"\312E\024\017G\200\334M:\253\350p\312\n^O\005\343\364\225\346\036\344\221\316\3441\311S\301n\226Cg\023\007\306\226\035\321\236\332V-"
+	.string	"\204\315\021,;\223l\227H\356t6{j\323P\342\302\017\022H\240Z\246[\223F\b\2212\311\336"
+	.string	"\313"
+	.string	"\340"
+	.string	"\273\333\024O\262gr'\177\222\233\361\306vf6\344\314\314\b\214\212\262&?\312\232\b!\237u\265\264u\254\305\004[\222F\0037\207p@\225|\262\375\330\225\244\370\222M+\217\265\350\243\303\215\353\006[\255\025\301\315\005\201\336\\*\201b@\355\301\366H \031P?\036\311\325\305\254\320\212\206v\225\305\271\200\336\344y\320y\223\377s\336\334\207\245\330\335\335\344\335\253\375\221\335\001\245P7b\241\325\013\267\004\b[\262\326\243\201\233{"
+	.string	"\275\271\t\024\\-\326\217>^\234@\322p\215\261\325z\354u\217c\3754\313f\254=\356AI\204\f\227\256b\326O\0327uE\032/yE\025\273\342\0267\362\354\242\230\226K\265\326\0379\263(j1\343\036\324Z\227\273\2121\276\270\357n\211\335]\261{V\t7\231:\350\007\330\221\177\01357\\k\315j*\177\203@\232\331\3428\273\257r+X\373 K\002\310\357\002\2367\337I?l\020\371mY\215\315\261\316\033\357 \007\221\333\226\325\326|\251\334\266{\324\342\346\261\373\262\366\216]\247\246\213}\231J\336"
+	.string	"7~\225J\336$\224\027\t\345=*y\215J\336\242\222\227\250\344\035*y\205L\336 \224\027\b\345\375Ay}J\336\236\222\227\247\344\335)yy&/"
+	.ascii	"\224W\007\307\273+yu'o\356\344EK^\334\311{\236\274\346\311[\226"
+	.ascii	"\274}\362\262\311{\001F6\274xx\253\365\305\233\234\332\305\214"
+	.ascii	"\"\344b\277\361\274\373\264(\227\362)\271\031ngf\013\003\315"
+	.ascii	"\202\201*\001\222&y\264\rn\022~f\002j\006@\237K\031\260]\353"
+	.ascii	"\264\211\206\313\215\302\311X\211\371\030\013\0302d8o\356\372"
+	.ascii	"ce\300\336L\247\276\221\250\235\272\347\\\312\022\021\312\217"
+	.ascii	"\274\216G\030\032\234\344P\023\365r\372&\314u=\324\r|\250\245"
+	.ascii	"m\264\322\256kR\374R\271m?\345\237\261D\216\213\"lj\230o\332"
+	.ascii	"y)\006\376(\272>\224/\345Z\327\245Y\272\005\355\263s\375\364"
+	.ascii	"\n\256\321~\232"
+	.string	"\3045R\032\227\333\223\223-o\253V\242\223\331g\037\255\245_e?\365\322\342\267\355.\233HK\232\334\325\360/\033\320Z\353\202}\227{\341\320\341\303\207\363f\367\247\224\001cjns-M\362\324\332^6\217\265:\231Z\250\243\006\207\251/\366\f9\210\353\273\226(\005dj\335Z\260\307\362,\277}\220\233;bj\352\fR#\246\244J\024\301\022\275ROURC\037\260G\025\004\002\203QFC\240\257\255\206SQ>\023>\b;+\"D\210\005>\006\276\337\323\317o\204oH\365\213\022\376*\364l\324\223\225\3607\034\372@\364\252\204\301*\252_U\217j\312\007\354E\t\253zOI\0334\361\023\366\206\301\240\260\267;\022_\326\336\261\017{c6\365\221\317\315\t\333R:\365\2110\027|*Wj\026\273\253\324\fr\020[k\177\344\272+5\224\372\306\357\003by6\355t\323Y\031Y2@\357$u"
+	.string	"\264'?+K\352\223!uR\227fG\r\324H]`,5b\324GE\315\323F\355`N\372\305k\241.\352\336X\352\025\324B\021\256&MP\363\332\200\363\247\201\232\200Y\372\345\323:\375\323EhR\257\236\366\341i^\367\364\323\257\346i\2455"
+	.string	"\315\353s\005\200\211\250a@\345\024B\246\210D\nR\220\024Z\r\260\002\031\242b\035\021P\251\226\2504\3112\006\333&\335\200\007~>w\276\\\231\031\334P\177\312\233\323\323\3217x\324$\262\211~C\320l\215\324\n\264][\027i#\230\374M\276\212\220=n\031]T\361\345\223\351\360\210]\253n\036_\321\242\230\311\270S\240\360z\277\256\323rv\327\247\325\rY\210=\355\257\273\002(\366+>\273\033Kt\310&#\305|\364\214\304f"
+	.string	"\007\rZ\275\266\370\352\242\021\266\353\345\347c\003K\254\260\002\205\243\243\305[\321@d\317\251\306\211B\256\376\321\222(\372N\002\232\020d\326\270\355*\326\024\362\324"
+	.string	"\021\215\262\233\222\005\245\320\342N\270\r\245\327\300<\344\277\250>\241\311h\300\207MBZ\336"
+	.ascii	"\316\030\325\301?\377\236q\024\037.I\bCi\342\222\362\203t\335"
+	.ascii	"\004E^\206\363\017\215\346\260\3267\250Q\304\221?,B\306ZL\231"
+	.ascii	"\001\261\036S\030|\206\376\001"
+	.text
+	.section	.gnu.lto_batteryUpdateAlarms.76.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"}\t"
+	.string	"\226QB= \345*\035"
+	.string	"<r\002\220\304\212\322\030\253d\002W\302)\r\030UQ7\013\310\020\245\033\026\234\037\352w\300#\250\3058\004kM\025\242h\001\304\345\336\220\n\017\006\302\306\261\226\354-S\n/"
+	.string	"1"
+	.string	"2"
+	.string	"2\352\311\327xv\367\256o\300\020u\311\361(\027f-\002\nB\2254X\205\200w]3\302OU\343\331]+\030n\334\333m;\330f\260\035\023\261\021\230U\0026\354\323\330a_nd\331W\177;(y\201\250\355\256j\005V\266\271\210\330>\307';\300a\255\375\212\006\206\312\200\335\235\321\343\247\007_D\231 F\362\026m\306\022}\221y\004\245"
+	.string	"P)\315\266w\224\212\201]U\203\177\362\227\205\017\362\315%\223\036\374\346\2332\337\036\021>^)\255Y\003\016uJ\235\210D\372\200\246\327q\336H\344\315Q\304Gb\206:ov\022\314M\210\272I\342\270nr`\251\313\215,?\230\310R\361\223\033\2659\n=h\205\r"
+	.ascii	"3\241\333\037\003\210P|\330+\251\026@\241\025&\003\035\254qM"
+	.ascii	"$`B~\031\202\270\\\246\024j\017"
+	.text
+	.section	.gnu.lto_getBatteryVoltage.77.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"U\007"
+	.string	"\"N35Po\322\001\200~\266\251c`\305c`\007\006\007"
+	.string	"\004jD\350\371:\024\267\206Z\357\036\221ed\273\240v\246\252\252\030\253\375\317\265\202\204(F#\262\211\224)\005\326`:\320\312\262L\303\303\340\205q,\354q6\031\207\247\201\330\303\034\370z\260\340\313\256\013\276*\356\247\325\221\025!\244\022\266!^\242\005\354\356\202O\362\030\341w\334\271\343\311ow\276G\r8FBYr\205\261\351bGPj\206\375iud;\235Z@R\331\224v)J/\233\342H\037\266?v\345\203<\344c-\343F\005\205r1a\322\262\033\237\300\t\250\273\374"
+	.string	"u\247\032\327\236\232\177\221O,+'\233\b\364\004`\330]\347&\262\270\365\266\023l+\330\366\b\t"
+	.ascii	"\t\013\035\263\030\277\"\3365\204\345\032~\0331\262\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryVoltageLatest.78.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"]\007"
+	.string	"\"\21635`O\322\001p\b<\312*$\006,|a9N^\254\326\240 \375\260\202\321\032\322\266\035\"\262\213(c\310M?\f\207\005\206s\201\326s\355\342\307 \233H\231R\356l>\320\3122N\303\303\340\205y,\354y\0348\020\257\003\261\2679\360\025a\301\227]\027|U\334O\253%+\302H)lK\374D\013\330\335\005\337\344q\302\377\270\363\007\224\337\356|\220\032t\224\214\262\306U\306\346\214\035E\251\032\366\247\325\222\355tj\301J\313\203\313\256E\r\315\2628\225\020\333!\273\362E>\022\262\226\221\343\202J\361\250@\221\331\215O\340\004\324]~\200\272\323\215kO\315?\311\247\230\027\230\215$z\0020\354\256s#a\334z\333\t\266\025l\203\004\t"
+	.ascii	"\t\013\035\263\030\277\"\3365\204\345\032~\0331\262\020y\270"
+	.ascii	"+\246v\222\001"
+	.text
+	.section	.gnu.lto_getBatteryCellCount.79.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375 \357\235\006"
+	.string	"\022\215/4Pm\222\016\260\312\231AJ#\200Y\027\340(\240\220\376\026s\303\277wz\374\277\333\2539m\305\324#\320\33133c\305\352\212\3242\021\320`j\264\366\311\226)c,\232\253\312\262\213\302\303.\013\313T\330\313,\\\032\036\346\302\236e`\313\241\272^fY\327\243\266\254\033\241#\360\270\207\357F9\264{\261f\203\375t\272\233J't\001\026\021\036,MI$\232\374\326A7\361\245df\356F?\216N\200D\204\301#\023T:\311\220\351#\343\357\317y\352\003\004\316Z\267\nP\005\203\004\321Q\222\271=GQ\255\250\335j\224B\032\001\371\204:E\200\204\314\034?!Qw\375\013~\203_\024\006"
+	.ascii	"2\001/8\003Z\034\340]\246\204\273lj'\031"
+	.text
+	.section	.gnu.lto_getAmperage.80.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"=\007"
+	.string	"bN34`m\322\001"
+	.string	"\315C\206mT\234KC\350R\304\352\253\332\240\001\347\254\020\315\242\336;\324d7\320UB\357\222d\345\3054\021\362,v\235\372Gdo)S\n\316\\6\221\272.\314\002\264bei(\013j\0300\r0\023-x)p\345@ExUU\204\323\266w\253 \253\345\243\021\266\037\016\202\005\354n\202\377\361\r\302\327\370\363\206\223\317\376|\216\364\227J\220!\372\344\310S\305\246\212\275yR-\354\273U\220\355t*\202\310MHv'F+[\362F6lw\354\311\347xG\307\230\33304)$\222\bI\331]h\371\200\364\347. \375\351\305\261'\346\337\343\016\345d\224i\236'\200\302\356:3\215\342\326\3336\260}`;\024\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_getAmperageLatest.81.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"M\007"
+	.string	"b\31635Po\322\001\200~\276\334)B4\247\t\207\242\243\214 :\026\233\343\232\025\315\242\326\273Gd\031i7h\235\251\252*\306j\377s\265p\023\245\321\210\354-eJ\001\336d:\261\3020\315\002\274\242uq\252\013r\0304\016p\023/\2301\260\365PE\210YV\204\324\266w\253#+&\244\022\266!>\222\005\354n\202/\362-\302\347\370s\307\223\327\376|\317\364\227Z\260\021\022\312\222\251\213M\027{\003\245b\330w\253#\333\351T\002\213\224\206\223]\212\322\313\242<\223\016\333\037\233\362=\376\361q\3466\r\321D*\231 i\331]\210\371\300\364\347.0\375i\306\263g\346\037\344\216eEE\023\201\236"
+	.string	"\n\273\353\324D\025\267\336\366\201m\004\333\244\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_getMAhDrawn.82.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"E\007"
+	.string	"b\21634`m\322\001"
+	.string	"\315g\b\271\205"
+	.string	"(\005_\263\201\2744\337\002SO\031\302\264\206z\357P\223\335 \005#\364.IV^LQ\3103\360\277\245\177D\366\2262\245\316\\8\261\3020\314\002\274\242um\252\013n\0300\032\230\211\027\274\030\330j\250\"\304,+Bj\333\273U\221\325\002R\b\333\016\017\311\002v7\301\007\371\366\340g\374\231\323\311k\177~g\372K-\300\370"
+	.string	"e\311\024\305\246\212\275}R+\354\273U\221\355t*\301\206\211fdW\242\264\262%\217D\303\266\307\246|\216wx\234\271\355\"4\215H\021\")\273\013-\037\230\376\334\005\246?\265x\366\314\374{\334\241\234\220\264\320\347\t\240\260\273N-4q\353m\037\330F\260=\n\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_batteryUpdateVoltage.part.0.107.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\001\002m\020"
+	.string	"\326]jG\340\224(\035\240%E\033\302s\031*\341\335fpz\325N\003\037\342\t\346\027#\f\303t\305\0213ma\003\355\227\202\274\315\0255p\325\211\315"
+	.string	"A0\020\203n\264\276\207\213\r\255k\237\251D\003\307<\310'\233l\231RP"
+	.string	"X"
+	.string	"T"
+	.ascii	"\207q\236\326c+\227\354\242\240\325vG\025\247x\237\bN\240\373"
+	.ascii	"\344~\322}\252\355\277\260\315\n\341\226M\344#l?\013B3\303\266"
+	.ascii	"\273\337\247T\361\326\245r-\377\263\227\274l6\\\002\260\031q"
+	.ascii	"\035p\016\304\262\273\366H\334\363"
+	.string	"\266\031\330~\261\265%\223G\013\033,\253Xdj8p4\234\332\216mgF\024\323x\r\030\253\f\2140\021\235\217\220\016;\266\335\361\373\364\350]v\265o\230\313\260\214Q\304\305\356\206\356\313X\376\314!\333\254\307V\032a]%P>}Y\313\016}\306x\245539\273\273\240\300\315\003\325\217\016:^\033\221@\360\307\313\210Ty\032$6\206\347(y\273\273\342\3438\355\305g\361iS\250\177\2052\301\n\036\227&\361g\277\207\036\023?\253\376\215\353\315\217\335\020\\z\263\344d\n\373\334J\035\033\244\346:\265\004\251\265S\337S\360\301\344\304.\210$G6'\316p\301\305ee\344`\004\212NP-\240\2514!u\002EQE\022`\222(F\004S\251\221\205\017%\206\250\023\210\372N\245\221\351#\211\250Ot\300\241\006P\374Ra(~z\251c\t8C\\RFr*\007\342#%G\341>z\310"
+	.string	"=7?\2537\253\264\235\362\035\025L`\273\333\300\017* \200\202\031\263\362\303\367 \247\002\262,\313\035Ga#\206\376\t\354\324\270s\036\332\303=\336\256\205d\315\274l\334\364\245\250\213\215}\027\240\327\377\336;\330\332\301\235d\302a-\323G\306?|G\211\177\343\342\\"
+	.string	"\221a\232\b`\342a\344\311\264\f*4c\272l."
+	.ascii	" /\350N\277\351'\2301"
+	.text
+	.section	.gnu.lto_calculateVbatPidCompensation.part.0.120.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\216\004U\034"
+	.string	"\2461\255I\260XQ:\300\007\342\216\300T\f\b\202 \254\263u\251\013~:0\230\351\003_My\002\262\263\220_>\332\217\341\371A\325OS\372\036\246,\314\344\376m\354\354\263A\365\r|:\0274\207#\353\200U~#\215\220-wJ\001\222"
+	.string	"\234"
+	.string	"\226"
+	.string	"A\031%\026?$\f.:\002\251\244\263E<\311%\024-\345\372G;\037\311\245w\246\361\tk\020\370\243\235\362\342"
+	.string	"\034\017\354\013\017\304C\222\007X\340W%\212\252\326Zs\321\013\310\213E;\240m\337\307\177\354\330C*\214\021|\025(\037\245\252Z\353\353\"\315\t\214\027\351e\306\213\013\343;\247;\305\035\177\005\243<\242\244~\200xNW\260\341\347\017\220\212o"
+	.string	" \037\245\251\265\036\351\223\004PoN\001\027W\260Z\253\311\240{\274m\t\266S\330\264EX\272\260\340\3151s\211\274\"\255;d\273\350tI\247[t\232E\247IrzE\247G:-\256\246)\235\336qz\216\323\017@"
+	.ascii	"B\213ZO\214\001S\205D#6~\364\tT\322S\232\2505\266u%\021\222\235"
+	.ascii	"A\300z#z\250\223OXc\344GD\030\304\001a\f\024\243\022)\237"
+	.string	"&U\265\n_\027-$/c\177\203\260\370J\037\332\245uO\362\205\234\310\235VAME\f\370\232\212$\350\371\3004\244\212i\310\fQmW\205\324\322\004\224\224\037U\005\254<\240\363K\272\007\251\001<\005gb\355\227N\303\233_L\356\270\254\335\246\037\223\336\222\213\240i\302\237P k\2557\276\223OU\260p\341\302xq\265\0273\305H\334\335q\377\313\321\233cLW\334\377\250\276tg\222\370\210\231\273K\303\374\250l\f\227\212\221\265\372n|\250G\311\374\340E\317pp\306\213s\303\330\030rQd\264\322\361\342I\177\t\032F'zdq=\035\231\252\363\213\367\263\326\312\263Kd;g\374\272j$Q\361M/\366\227\234I\216\0374\207\332\374Om\274\370m\260%\246\321prh4\204\255\303\232f\203\243\345b\265\227\216\255V\263\311fr\265\330z\203\006\r71\007\261\231\215\314m\326!&\223"
+	.ascii	"\3002\033\335m\226\313\3052\274p7\033Ng\206{\351\344\304j/\331"
+	.ascii	"\r\367\262A`\233\207\331\355\225\263\331n\257\322\366<\255;\344"
+	.ascii	"\271\345\326|\\\231\217r\327\222\260\355Z\007B\274\355\371Ho"
+	.ascii	"==M-\314_\372\221\316\202R\004\354B\305\243\264\265\345\216\\"
+	.ascii	"\240\234\265\255\365\374i\351\r\337b\3321\345\364\257`\272QB"
+	.ascii	"F\226:\303E\023\241&\017\357\351\2535e\250\201@\345\210A\b\r"
+	.ascii	"\211\004\"\n$\2061p\002\241\242*;\021p9\225\264\260 \245\366"
+	.ascii	"\r\254\257\324\361\311\331h\342g\265R\362\017\271\373\217\f\n"
+	.ascii	"c(\370la\003(\2059_\226\267\244\271\205\266/\260A,9R\362M\205"
+	.ascii	"\006B\344\357G!\304\376\031\231\341\003\007;\362\337\350\006"
+	.ascii	"Dz\356P\345\327>\210\276 \243\007\377\2000\302}3\216H\023\300"
+	.ascii	"\205\006JM\265nU\300\3177\337\330\223\326}k\006\370\274\220\235"
+	.ascii	"\374\2210?@|\230\257Z\225\266\027\360\332m\251\2672B\332\355"
+	.ascii	"\023\265\305]\\$*\345\265,\344\333\354n2\t\376\241\004\245R\242"
+	.ascii	"\005\320\374\360A\311\025\001\202\306\200m\372~\365;\276-\215"
+	.ascii	"h\332\332\256\024\334I\235\370<\357Q\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\213\004\215\022"
+	.string	"\006\335lH\260\326M:\3742\235\337\274\207\276`\202G\360.\305\370v(s\2740\273a}\211\323\376wR\003\020\211>\375\301\375\353\337 \036\264\037`\205\247\340y\342\300\025\255\335\217\037\t(\260\3419$c\211`\273F\203D\271e\nV"
+	.string	"Z"
+	.string	"Z"
+	.string	"7d\317\215\223;y\202v\\\025\273i\350\230J\212S\006\202\027I3\345\310p\356'\362\306C\004LQ\034m\356&\262\346gw\273\035\224\003\367\2234@+ \344\231\211\300\f\200\217\267\266\216s"
+	.ascii	"\220g\373\233\2428c\330\267\243Ph\312\234s\322\334P\322\266W"
+	.ascii	"\"\020n-\265G(\331\226B$=\030\362\354#\333\021\b\033\322\022"
+	.ascii	"\222\322\207$\0211\353H\302\001\221\327\340\006btK1\270s\013"
+	.ascii	"\356\037Ew\024\321\355C*\270{\f\3355d\202;\207\320\315C\006\335"
+	.ascii	";$\220u\336\217\227x>N\342\355j\267\016\260F\273q\314l\303\223"
+	.ascii	"\335\0013V\354\200\353\032\301}a\251\300\326uS)\345\344\212\205"
+	.ascii	"\rl\277\333\rlU\247\352\302\204\n+\034\330\272\276Q\325i\312"
+	.ascii	"\211\252\346[\017\267\222\016\267\025\207\373j\303\215\245\341"
+	.ascii	"f\222\341\316\302p\023\271p\027\261p\033\251p\037\241p#\231p"
+	.ascii	"\007\221p\013\211pO\351\234\323\016\020\326&\325\026Q\266r\337"
+	.ascii	"\314\252\030#\263F\232b\231\375\232\324OsN\230\230U(\225\257"
+	.ascii	"\227\235\271\305\302\205\341\t\367E\327\023\256\313Mi\252^\244"
+	.ascii	"\220\205\3332\013\227\345F\013wE\247\316:\261\005\243\026\256"
+	.ascii	"\306\302u\311\001\267\005\247\n.\013NU\007\334\225\021\334\027"
+	.ascii	"N\255\225\013M\250Q\b\204\221\271\221$\005\211\262\254\001\340"
+	.ascii	"\002\031*N\033\021\320\020\264\204\030\201 \022J@\030\346\001"
+	.ascii	"U\221\204_\202\323T\353#\241i\353\364v$t\036C\336d\322\326\277"
+	.ascii	"u\211\030F\220\216\373.H\344B\026Z\"\225,h\344\007%\261\213|"
+	.ascii	"\264a\326\226\035Y_\262\342SC\345\327Ir\342\327\267\352RlYb\327"
+	.ascii	"b(\223\340\332F\352z\303 \035\246\232\332\205\325\370>\2404\206"
+	.ascii	"L\313I\002\321z\204gn\233\n\025d\f\037\007d\341\035\277\305\265"
+	.ascii	"\334\001\272\356\201\354D\025"
+	.text
+	.section	.gnu.lto_.refs.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"]\t"
+	.string	"F\032C/`k3\254\001\233\261\003\204\004A\020\004A\020\004A\020$\026\021\356A\032P\370\3267]\365\332o\335h\355\333\357w\263\273\255\355\275\345\2262\0052"
+	.string	"5"
+	.string	"8"
+	.string	"\017\263\314m\270\321]Q\210\t=\252\303v\036\365\254\343\336\323\251\004\252^\232/\354\212\252\024\314\226\252\223;\242Yb;T\205n\007\263c[\035\2716\002\337x\324\025\352\024 \237\320\324\022\230:BT!H\365A\325\0067\003[AS\023\334\032LEp\027\210j\206T1\252Vn\311\375pc3\016#\226\022d\210\331\223\325\220\330@e\212\311R\356\211R!\312\316d\231\350\004:qW&;\221j\344n0\0135\325\301T\247\352E\325\236\212\2006\020\337Sb\355\371Pg\300`\277`!\n1\354,\303.\027\325\246\026\325\242\003*\252Y\001\025\240>\236\372\324\2164I\025B\252\322\035\221\252\023m\027\300\363\300}\271-l\310\364s_\324\342\274;Q\035LvA\n"
+	.ascii	" \004p?\245\271\247\373\243\255\r\215\243\213\326\260\360j\255"
+	.ascii	"x\033\304\275\n\246\031"
+	.text
+	.section	.gnu.lto_.decls.65797e904e921ecc,"e",@progbits
+	.string	"(\265/\375`41\375\321"
+	.string	"\032C=GW NI9\351)\216\235a\317\\\312K\253\341\315\032\202\023\336r\314\nA\307\257*\334\024e\375\320}\346h\357\305\346p)\376F\245\200Q,\263=\366\007\226\342u/\n\224\204\364\253\255\204\2257s\264~\016\203 '\036\267-)\350\363\002\360\324\365\020[\331\261\267\224)\244\003d\004\231\004+\370\255]!\342\205f\205\2310^\325\tC\312\232z\177\334\002n\273a:\257\362\204$Au|\367A\023+\271?\246\362\007U\021@\232\225\\\330\026\266\201\273\364e@\326\30270\027\366\302\201\374\205O\376c,\347,\354\367z\336\233\024!\216\231\334\320{\261\352\274@\370@\004\376\343&\314\344\006y^)\023\350\254\344\376x\354\017:\377\361\036G\271I\236w\352\210\304J\256\003\237\016:\350"
+	.string	"\306H\023\253\026>\225\227\334\023\274\200n\331S\245}\177\261o(\366\355f}\270'(\205\247\330\340\271\350[\033\"\305\006\363q\224\037\215 ]\337*,\224@{\266b\217\367\304\276\311=A\276k\266c\274\363\035;\251I\362]\275\227\211Y\203\033f\r`\342v0\025\t\3263\235=\243\331\3771\016\313r\274\204\317\017<\367\017D8E\236\3351\233\033\204\334"
+	.string	"\230e\317\037\202\034\310\037\202g\0256\207y\224|\3009\251\242f\314\360\306iNj\270u=\243\245q\333\r\314\275\3136\257{O8v\343\223\3378I\237\367\036\004~c$\334\346\241\304\275K\254\235'6<}\375\335{v\340\323\301\r\225*9\360\202\365 \260\317\200e5^\343\223\003f;\037a\264\3030\235\367\274\367\304i\256/jE\272^\002\366\314A\220\006\0062\007\301\237`\233y\2029\334\023\374\331\b\0076\251\204m\254\353\317\314\237\305x\214\213P\250\024\313\233v\357\251\003S\244\311\020\246\256L\204\311\370\344\"?\233\361\331\353\331\3622\357=m(\023\225\023\267\256\031pO\2602O\260\346\347\\v\234\274+\302\333\236\177\2028\374\023\374\311=A\313<A/\034\350\232\246@\2275\004v\376\376\252\""
+	.string	"\225\002~6"
+	.string	"\013\004L\321\002\374\177\223\032@\324\203?\r"
+	.ascii	"\006N\320\236\002pp\201$\025A\227\320w\"]\232\004\026\334\320"
+	.ascii	"\013\370\273\366\b\"t\b\0344m\020\376\006z\320\337Y\232Z\001"
+	.ascii	"\235\200\r\346\316\341\247{|V\032\004\026:\266\275[\371\331\330"
+	.ascii	"\035\344\364\361o\004\374\375\363\367\006\177\023\340o\r\376"
+	.ascii	"\366\360_\346\357)\257\177;)\001;A\3404?\325\231\200\207\367"
+	.ascii	"\374\215\"\004\302\356 \201$\355\363\337\247{\376s\340\377\006"
+	.ascii	"?\300\3374\364\005\315\363\377\3543\177\313\370\331\003\275\363"
+	.ascii	"\277\354\377\\\220\237\351\032\257s\032\347\347\025\372\346\036"
+	.ascii	"\376\341\357\035\377m\370\257\345?\227\377\201\377\273\374\367"
+	.ascii	"\373\377\345\377\337\177\300\3777\374\367\362\363\215\377}\377"
+	.ascii	"\367\376\333\375\307\371\251\332\317m?#\371y\355\347$?\277\265"
+	.ascii	"\315\317`?\247\375\214\3265\377m~\272\3657\315\3371\177\303\374"
+	.ascii	"\034\3703\340\317~?c\371\271\371s\337\317|?\357\375\254\367\363"
+	.ascii	"\223\237\353~\216\373\031\356g\034?W\375L\3653\213\237\247~\226"
+	.ascii	"\3729\352\347\023?C\375\354\364s\362\347\021\374\214\374\231"
+	.ascii	"\005?\253\340\347\030~>\301\317K?\233\340g\342\317%\370\331\350"
+	.ascii	"\347\341\317C?\273\360\263\360g\241\237C\360\363\007~\326\300"
+	.ascii	"\317\030\370\331\002?S\340\347\t\374,\201\237!\360\263\207\237"
+	.ascii	"\203~F\341\347\007\374\354\200\237c~\266?7\340?\333\317@?3\340"
+	.ascii	"\347\022~^\300\317\"\374\374\301\317!~\006\3613\002~\336\340"
+	.ascii	"\347\003\374o\341g\f~\346\360s\317\317:?\317\374,\3633\377\374"
+	.ascii	"\3773\374\207\373\317\374_\344\177\007\376\323\375\357\020\030"
+	.ascii	"\030\030\370[\026~\373\366kP\023\315\276\262\343\025s\344H\225"
+	.ascii	"f\315\214\024J\220W\246h\\\212$\177-l\017\223J[\241\322Ud\256"
+	.ascii	"\022K\006\200M\231\037\314+J\252\364\030\216\022@'T]/S\302\346"
+	.ascii	"\350\375\274\247LiZ?\333\263\367\323P\270\2434\224\356\3436{"
+	.ascii	"\337,\n\032bM\333\002{;\203=s[\260\207n\357{m\304^\237%J\033"
+	.ascii	",\273\344\2131\333\367\347\255\247wv\245fJ\340\315\201\250\341"
+	.ascii	"b\306\245\257\207\315\241\372y?9\373\t3\251A\0364'\002\371\300"
+	.ascii	"\262\352\372\256\256\3556\270 \313I\3379i;\026>\210\275Q\031"
+	.ascii	"a_\210t\265s\223\251\342Rv\275M\332\307\340Y\366\373y79\273I"
+	.ascii	"\233\250LgW\305L\211\267\033\256\376\356\255\0021CV\266\004\311"
+	.ascii	"i\257DI\317\005\357\345s)\245|\317q\220\242\241\227\320\320r"
+	.ascii	"\026y\257\217X\325\217\fTX\017\300\270\267\334\315X\\\223K\327"
+	.ascii	"ki\035Bq9\376\272>\206\313>F\312\346 \371y\303\301\275\3050Y"
+	.ascii	"\016&\334\334\224\334`\237\315\321\361\363F\202\204\333\370\276"
+	.ascii	"Y\247\"P6T\346\230M3\330\234.?o\266\363\331lM\226\243\342Z\276"
+	.ascii	"\255\035\315\253\254\002\021\354\201t2\203\210\315\311\372y\253"
+	.ascii	"\235\255\306m(\334@\341G`\363*\347@\324\234\310ZB\261as\346~"
+	.ascii	"\336G\216\364\030\013x'"
+	.string	"\210\007a\330\236\270\237>\353\"o\346\331\3146\302U\027y%\204,\313*\345\017\237m\344Uj\256\007\230\274\037]\301k\337\177\3602)\357\275*`\316\253l\252\t2\f\363\317o\303\224\tp\351\037\200\023\234\027i\347\305\317\372pc\262z\006\3670xJ(\246\026\022\005\255\251\244\226\013(\246\326E&\273\220:\312\253\205\204b\336\253s\223I\344\n\313\253\003\305\274S\267D\336\024\337S\013y\223\313\253s\223\227)\003\250\244\326\024\024\223iJ\007\212\2515u\231Z7\347&\231\224&\222W\251s\231ZW.s9\225\003\305\\NA1\265\254\270\f\312\212\327\224\023/[b\374\005\225\2742D]1)s\360\240\316\345\215r/\2479]%\001\356\275Z*\2430\271\340\267&<\031\232\332\230\226|\336{;D5m-o\022\017\352\307\362\336\037M$nT\b\310\023\357\342`<\344\214\253\233\302\351^"
+	.ascii	"D\335\213\344\213w\357E\336{c\224W\347\2750r\240\274\242\242"
+	.ascii	"\356\255\362\211\272WH8\247{;M\312\333\024\024sk\031\004\207"
+	.ascii	"\306\364\272O'\222\275n\024-\245e\"\315n\212,\326kj\005\226\256"
+	.ascii	"\347M0\210\216'\270\256\026\354\313\006`\327s\rF\235\215\256"
+	.ascii	"M$\357*\254\n\233m1\033\032\272\031~\004\216\t\301\221\201\222"
+	.ascii	"%F\232\017\233\003\366\363\006;\237\r\326=|r\356\335:\341\005"
+	.ascii	"S\343G\003\261\202\204\206 +~\370\350\036lK\316\264\256_>\326"
+	.ascii	"\013F\225\214\256\207I\332\234\263\237\367\216\263w4\217\237"
+	.ascii	"\313\244\342\204//\276\253\277\253T\202\350\256\3533S\205\007"
+	.ascii	"e\271\304\276\256\3754\027N\r\023U\222'f\215\243]\240\350\241"
+	.ascii	"\242\353\353\217\276\3216\356b\304\344\266\322jh\311\234xJ\251"
+	.ascii	"\256\007AF\331\330\213\216q#s\257\226\232\027\237\265Vcu\214"
+	.ascii	"\030\0347\257\356\357\357\031\275\3254\370l\255^\276\263X\257"
+	.ascii	"b5y\230\260\265\246>\331\323\033\354\251\025\3330\332\212\317"
+	.ascii	"\307\365\225L\362\274L\034K\2208\370,\nb\036\027<\265\263\177"
+	.ascii	"W\375\330p\201\322\024\346\002\nU\213\236\255\277\256\026\177"
+	.ascii	"\257h\026=U\263\2747"
+	.ascii	"I\241H\201\241u\355\313=\301\fT\364\024G\361\212Q7\245\024cQ"
+	.ascii	"C\3079&\003\007\b\244E\327\216j\031\336R\235\342\266T\b\313{"
+	.ascii	"\231Z\n\307\313\275L8\314\0320kP\207l\361X\013\326S&V\312\211"
+	.ascii	"6\001CU\025Y\327\267\211\206\342\345\305\340f\205\2210\030]\273"
+	.ascii	"D;\361\331\241\237\030\313\215\246\251\256\247pv\005\367r\207"
+	.ascii	" \007\006r\207`7\005\275\223<Ae\325yqN\340\2321\244+m\246\016"
+	.ascii	"1`p2j4\362o&Y\346G\343I\036\023+\271?\021\232d\315\263>\256\201"
+	.ascii	"\361\322\0029tvg\253>\325'\332\364\021r\346\325\341\334I\235"
+	.ascii	"\250:bw\\TdE\326\022>K$\226\237\273\257\036r\1772rv)p\324\022"
+	.ascii	"5i\345\325&\326\2656\325\004\362\351\225\005\251L9Xv\007\371"
+	.ascii	"\345\013\r\264\221\247\245\342\317\346N\205\333\324\r\247\201"
+	.ascii	"|\247\305\b\036\331\020;)/]\270X\235'6\330@\001\233yuaM\242V"
+	.ascii	"\364\321.\247\200Ud`\262w\273R.\035"
+	.string	"c\006)`\177\365\253\316J\225\256t\013\337Y\346\212\035\314\216\021\354\373\221\365dgu\330\374\374h\363\346\325\331\324@\302\267\004\315\356L\301\202\245\215\350x\232\263\315\313'\243\207\335i2e\nm\246y\365\221@$\225\225\323f\357\341\355U\241\331:\233\360h\025J\205\007_\236\330\227L\240\226 q5\364\222\t\021\031yK\273\243\244\257o\315\253\365n\220Au=N\n\273\323\306\307W\002^^]X\255\001Y\206\346gw\214\354\355\265\021\006,\363\352\302\330\004\215\034ax\226\007KO\257\215\354\360\n\222\331hz\251Y\036(;;\372\204s\316&\275./\n\344\205\223'\274\323'6\207^\036\215\256\364\256\203\360\\\331\2156 v\007\313\222/\241u>K\252\227\343i.\214\206\013E\323\f\272\323:\2335*A\264\320&?\361\0057\243\t\2235\254)\275\356\252?h\320j\353:\307I\202jY"
+	.string	"\323\266\254\316\220\037%Jh\034\237])v\373\302\022\344\247ad\261\313\3214\234\306\335\340t\205\255sx \205\253\253\353o\222VG\006\256S \224\213\302\0055]\246\035\031"
+	.ascii	"y\353?\024av]\337bR\354@\341e\213=\bb\224H\220\276\246\020\n"
+	.ascii	"66%\b\r\253\241\271F\221\320$\224"
+	.string	"\215\272\361I\333(\331}\030\215\266\321!\334\306x7P\030\223\322l\243e\364\b\343U\345\334d\222\277\346\275\327&\353IMFM\rr*\036\232\240X \253r\204\236\024\215\361\252\316\253\202\006\311\225*4\244Q5>\351\221\373\234\367\246u\260\001\354\373#\013\242\031\251y;a\365\324\2252\231I\207b\006\332\031\237\264\310S\217/]]\251\331\251\230@\236@\361\270\332\002N\314I\021{\033\"\3666^t\314\3565c\330\345\260\267\251ao\223eo\363\302\3764\214\2021\233\370\331Q0f\322zNR4u\275M\013K{\320\0378C\336j\260\371\270@\216;\266\256\365\253\351xxEy\335D\351R3\343\001\303\026\350\367\242+\355\262N6O\034\314\304H\"\303\252\353i\327O\255\350\216\024\004~\331\322\365Q\270'\330YA\247:h\354\344\232eM\253\303\202\3028\275AaP\034,T]\025'"
+	.ascii	"i\362]\375\025\035\231\213q\006Q\325p\322\225\316\2405"
+	.string	"\250\215_FFI\n\275\253(\366\224\306\314\215\274\035@\2726\325\222\211\031S&\325\364\354\351\222f\3752\364K\235\022\023t\366T\006\013\246d\t\351J\261\254SM\033\0072R\316\250pu=\305\372i\f~\322R$\350\024VUV\272\3360O\220Z\005\235^5\2174:\272\25665]\226\207FU\225\0335Q\203\222'Z\226\347\213\212\212\262X\363\302A\303Z\025\245\345!\262b\005eA\006s\202\321\035a\3211\202%\310n\b\351\372\232\244\345Q\233\232\242\311\035aM+\347bO\254iy\342\250\024\225\242Q,P\341\362\n\376\2001\2075gy\236\320\0244\005\215BC\202\005\",K\\T\333\f\227\231S\026\232\345\241BO\320\023\f\207\307w\0256#$\213E\227\036\266\307\215BQ(\267\346\r\236\031\027\277\256\247\301\262=.\250\023u\022!\306\222\346Z\036\033h\323i\023M\312\334{\345"
+	.string	"D\360tX\201]\232d&4}SaD\352,\314\335\317)\222\"\231\t\nUK\312g\346\343/\214\266x3K\363\26236\374\274\003\003\333\004\n7\226LZ\031,\371\352!\007#V\3677c\302^0\367\323]\270\275t\351/=\304\"\225\226\215\353\205\314\237\275\314\236=\367\220\340\005d\\\316\245\345l\316m\232b\302KK\324\224\033\233\355\361\261eK\003\216"
+	.string	"6q\220NLoeV\207\307\017\013\341\316\302ggi-;J\n<\325\320\274\312+\0207y\312>1\277\231\256\247\022Y\246\224'M\025\024\0222.\333#\244\031#flH\034\205HD#a\361(ct\\\nALBB\002\300\007 (!\r\301p\030\n\035s\214KG\307cR\221\004\00708\t\240aq\351(\034\216\210\001\200\316\n)\360\034\t\227\216E#\0270\020\321\002\004\206xH\030\207\305\021\034\210\204\303\r\210X!\005\036\235\223"
+	.string	"\n\221d\204A\360\250\264\224T,B\022\026\205J!\206\f0D\\\212\300qh\244!\216h\030\243P\315Q\210X\244\004C,R\242\303\024\030\031\253\3218,\022\021\tc\212G%z\233\030\212G\243Q\321p\003BDCb\221\321\2210\206hh\\\252CCc\314\205G!\321Q\250H\t\350FH\ti\310\201\343\3208\334@\221\322\007\013\350\244p\034\026\321\360`\240cD*\n\217R0~(\"\032\r7`4\202\2704"
+	.string	"c\221\360(\002ED#\244\242\220\346$\200\214GI\305#1iHh\250\030bh\004\021Q\210\204\224$b\250(\223\343\001\020\321p\310\b\206\342\260\205\243QX\201\243\360\005\243\035\021G#\342\004h\214<ED\243\342\261\205\036\025\216\303\"\234\034\234  \027\214KIF0\f\213J:\303!\231#q)I\304\321\3210\307\203\320H\034*!%\211 2\312\300Q\370\302\321\322\320\221p\250"
+	.string	"'\001\024\202\350\310h\351\205\016EK/\f\211`<"
+	.string	":\026\205J@\001\250QA\205%\237#\341\220\321\321\250(\002\251\205\013z\\\030\036\205DJ\035\350\360!\243\342\2208,\262\017a\004\005\214@\002\nbN\202\t\036\230\340A\360$\230\020\024d\302\bA\366#\004\321\243\320\360(<\266P3\024\022\261B\n-\034?t\2549\n\031;0D2:\332\241\320\220(\311\002\305\241\322p\370B\315I"
+	.ascii	"\335\330\243qx\024V`X$,\016\225\220\2047G\241\017@ \236@X\\\201"
+	.ascii	"D\nH\266($1TcN\302(Td4\202\230\204\002!\321\bi\347\350h8t\002"
+	.ascii	"\016GC\030\206\0258\022\207\306a1\003\307\244\013p\030\n\355"
+	.ascii	"\f\205.\030\016\025\227\222Z8\022\207\305\342\322\320N\fG\243"
+	.ascii	"!\241\222P\004\316Q\250\202\013C\343\222\315QR\222\nB0\306cq"
+	.ascii	"x\224\202\210\241q\351\002\342p\2508\314@\021\321\210X\024z\200"
+	.ascii	"\230dtTBZ2\022\223\206<\034\205H\2101\032\031\2151\2208\n_\200"
+	.ascii	"\341\346$\200><IiX\fqL"
+	.string	"J*\206\2401\n\025\207\307\241\005\206E\302\343Q\022\f7\366(4B\320\221h\264d\211\206\305\341\361\310h\004qi\346#\210\210F\020\226 \034\002\361\274\204\022Dd\320\201\013H\300\016\001\305P\034\036\217\302\027B\030\213IF\342\320\030\202h$D\n1T4\206"
+	.string	"\362p\016uGj\333\221\312\026\202\022\246\265W6\267 E\250\300u\255jw3\243\001\227v7\234$fQ\270\334\200$\021\262\206f9\3240\253hf\325\210\f\362^\271;+9#\225Y\211 \213 \231Eb\264\262\274\230\322DN\034/g\314\275z\306X\230I\2227#a\026\203)\261z\212\325\262\004\224\345\345\350B\366Z\026\007\343T\203_^\327J\344q\200je-\350Z\307\036\027Cg\267%Cg\205\375\353\220\266\263!K\253\252\023B\001i`\300mQ\013\243\2018Q\2264R\200\325\022\327\n\231\212 \025\305\226%38\001\351!jU\360Pt\345"
+	.ascii	"V\275\352\217\352U}\260\362\004\037g6\232\177\267\212\305\317"
+	.ascii	"_{\274\372H\252U\251u\255_=\344z0\244\360\345`9\2315R\326\356"
+	.ascii	"\264t\321$M\3279C\211\256'\315\033\226\032\013\035\264I\221m"
+	.ascii	"Rt\\\255\245\277j\\,5G\305\001f6\303\251\353k\023SIV\032XRdt"
+	.ascii	"\345#A\2577\350\233\234\223\027\0335\204\246\276\366\272\276"
+	.ascii	"J\221\340\313\016\024w]"
+	.string	"\353\214\240W\032\002@\022\007\3275\246nU-3(\033\252\326_\2275\253&G\213\025w]\237\306=A\031\261\240W\0318znZ\272\260j\f\252\022f5\206\315U\217\0314\272V\253\240\327+\230\027tY\\]i\230'(%\305\265\354\027\334\026tQ\002\220\212\262\240Ru\255\252.^\251\216\023\023%\f\212)\330\202\306\241\201MIc\321c\026\t\263\357\304\2129\025\264\256\206\217K\027\263\251\3461\263%\205\017\213\222>\271i\321feC\312HU{qcK\206&\273\371b\212\303\212\302\301UB\354J\327\235\037\325D5QQ\260yQ\037[\334\344\352\211W\024_\273U:\002\204:\2503\243\363yT\270$\031b\312\320\b\rI\2234\006\263\024@ PX.\234QW\227\017\023\300Ti\004r\226\245\320\224\311H\222\244\324\276\001\026\222\226\364M\200\210&\002_\315Z\253\350\001+\362S>\306"
+	.string	"\2541\337\316Q\216x\b\276u@\251Q\313\300\022\361\022s\222\323V\307\354\235\252\350\n\270\222\377U\217\313\275\360e\226\325`[$(\363,w]\251\356\356\031&\307\3179m\323P\254\2604F\216\026%K\375\312\314}I\002\260\214*\365\n\336\302p\373\373\252\342\021roi\344\362!\263\323\006\002&\256\024Sb1\240\324\312\321\007\263A\214jF\336\036\365O\240\342\237Wg4\337\376\276_\316\313\340\266O\037Gf\340\030\346r3Z0\3015\361\007\036=\036z\316\220\335:\212:K\237)SC\210;\307\035\032\310\366\032\313\255\217\224%,\207\325\345\234-\254\341;D`\036\003J1F>"
+	.string	"2\346\331\223\232a\247/n2K\003\361\005\036\312\213\307J\311%{\342t*\031\352\244\352\022C\321(`\247\354\026\257\212\001;.bP\337YA\372\304\250\b@\334\251\201\302\324^h>.~\\\241\320\210\200\256\274AS\013BH(\336H\003\240\223\355R\232\200\""
+	.ascii	"\374\f'\246(0\311\254\003o'E\224\334\344\211\261^\250\013\225"
+	.ascii	"\320\021o\373\3118\330\241f\327wr\221w\375\3011jfVK\347D\335"
+	.ascii	"\374[\252)e\246\334r\334\303\017\222\002\225\356:p\013\037\367"
+	.ascii	"DC"
+	.string	"\035\313uY\343\"\013\222\220\264\026Z\324T-\227\3110^]:\200\r\311\343\207\345E9T\0261h\322\347\2713\364\276\021\223\250\027\037\035\016Pq+\360\270yE[\344\373\203\303\371\311\226\016&\312\007}\2601\335C2\231m\t\241\002\260.\035\027\004\004Y\225\032\177y\212\372_tv\2702\242\274\013\222\036\002\3758m\237&4\377\371\344e\334h\001\023\026\244\004V$\005HS~~!t}\230\322\035\302\037\277\237\006Dm*\230D#\b%\206\323UI\272w\244\227\315?\337\022\300\336\355\270UIsu\366E\217+\352\276\343u\302.\177\322\320H\314gS\205\022\270?\232pPO\rW\227\227\374\3760\327\213h5\306\324\345\315+\347k\255\310\217\346\020fQ\034P\312M\212\207\"\223\203\265\276\313i$\332\321a\026\247\304\225\307\241\005\020\001e\327=\310\006\206\n\264\315\302\005\r%\004B\263\005"
+	.ascii	"PA\004\257\033;\345>\223l\314C;\370Y*}.\310\034-\216Zw8\033\337"
+	.ascii	"\205\032\215\215\200\325\206\021\354M0\357Y7=S]' \030\b\266r"
+	.ascii	"\023\013\240\270B\301\r7Y\370\t\313P\253\332\303\352E\344\263"
+	.ascii	"(\tB(n"
+	.string	"\320=`J\214\221\362\334\352y\214\227\322\225\201\235ID\271\303\371\323i\335\270\305\243\242L\naN\253\213r\245[:\243Q\n\250Y\361+R\332\322\345\271%\376o\304\351\333n\361\025\222\310\211F\254\343((d\266Lv\214o\013YjX\361}\342D\033^\b\200\256\0268'\023\220\007\223\f\024\326/\226\n\320P\034\374\032\350\253\347\001\205\265\222\201\327\364\231\007\260\275X\005\260\256\005E\254\256\261#}\"O\346[\264\374\232/\230\020Y\235x\256\bE>j\220\311\211\034]\2271\017\276n\337r!\037dD\214\352\260 :c\007{\324\211\322\227\357\372$\221\026\227#~5\211\236IB\302V\236oBm\330\233\177M\324\204=\360\263XN\0331\r\340\211\232sV!\261\030\347Q\251\253\310G \314!\004\030\203\371#F\013\257\025\224k\022\275{\374\200\264F\2655\302\344\312o\2265\217\027\322G\013"
+	.string	"\303h\262\373\0260\226\302\004Wh}\021P\2518\356\265\262c(\252\371s@As\274\\\002x\034weCe\3508E\221\344K\267,a\231\021E\207k\271\2703\222\277\225\037\264\\\b\246g\343\t\320\301\026wI<\222\"\276\204K\215\330Qnv{\027C\020\242d\347:\364\307E\024w3$KG\217\376LH\030J\311\334\234\237P\n\242\255B\253\236\321\275\340\022\007\004\350j\t\326\311\301\224`\266\357\366\220\004"
+	.string	"<\254\177yp\003HwkW\262~\211\tc\345\017 \270\273/}\016{\312z\207^iU\331PH3\376\254k\242\002}\034\006=\201s\3609\364\257=\325\276r\217\342/\200:\333\017\336\364`\373\256\f\307w\300!-95\022sF\245\362G\332\313\337\310\200L\342\207\355\230\325N\212H\253\346WW\344\324Q:\333\0345K&\363lW'\234O\f\321\026\031\262\306\267\340\360-\037\225\213G\tq\322\265]=\316U\210v\200\377\234\033\244\201\3740"
+	.ascii	"Q$\341\206I\315<\215\315\2117y\320\342\211\320N\335\300\244\347"
+	.ascii	"\323\036l\214\336Z\325\001\001\216\226\356\356*\3214:\254\245"
+	.ascii	"\350\314.\224w\245=\213\257@\274\007\rr<\005rv\374\313b._\336"
+	.ascii	"m\315I\234\207\306\313\345\220\274\\\264P\344\256>3B\310$\312"
+	.ascii	"i\207#\346\220\216\263a`/\201e\331\r\214\376\034A\267\204\227"
+	.ascii	"\026\265\225#t\"D]\343\200Y\315\246%\352Z\300\345\222\327c\346"
+	.ascii	"~\246\222\231\250\361%\234\326?t\272#\350CP\240B"
+	.string	"\300|4\327\024\334H>j\bK\335\213\003\023D\334\252w\241\363n\270\236M\235\370\225\277N\202\305\r\311\275\356\214\021\357\214\027\344\bn\0323\303CM\352\301\203\352\352\2431\335\004\255\371RV\200ev\240\243\377\273K\331"
+	.string	"\337=<\313\227\277\253$\332$\227F\317t\257\215\177]'\222j\347\373\274\347g\320a/\306o\327\023+E\263&09{\223%\340\240oT\227sL\036\2742?w\020pi\301\365Jm\t\342/\003\342\177\036\017\313!\265\253\362N:\2754t\274\271;->\363Z\370'\243\334\310\021\377t\263\201`\325\221\023:~\240%\225S\205\r4\026Q\030\270\374\235s\t8\263\002\243\203\005\020\370\034Y{\017\002\002:\261\354.\273\303\312\002\241L\273\201\026B'\204\315\235$~\335j\253\262as/\032\245\215\bJ\"V\f@\316w7\333\025\341mo,#\234\t\t\257q\355w\021\342y]\035\321\322\027\206\240\247\355K\275\341\265\214\376\364'\312\272\022?\322\027\264x?\321{\003\242cT\343j\267"
+	.ascii	"\033c\355\275.\362F\265M\0239\267dW}\027\377\030\036\017\360"
+	.ascii	"a\342\221\353\374\345\343Vz^x)\274\244\357\213\205'\251\307\242"
+	.ascii	"\306\310\234\212\301n\370A\254N\324\347\215\230J\003\361.A7\300"
+	.ascii	"\333\221;\020\255i\260\226\"aCA\375\242\361\205\325z\350~ \360"
+	.ascii	"r\360]\"c\360\2570\374\316\375\234\234c\207\242\303\034\233\233"
+	.ascii	"N=\243~\363\335r\222\265\364I\206\273\334z\230<><\376f\226@\227"
+	.ascii	"\017\177)Z#4\217\204\264H\375\342\216Y\340\013I\361\254\337p"
+	.ascii	"\224\364\b\337?\360\236cu\266>\\\360}2S\332|\320\237\357\351"
+	.ascii	"\307\326\025{\3551\214\316\362\340\212,\006\351\217\211y\206"
+	.ascii	"\215\367@_Y\357\f\354\261\275_\025\017G~a\372\021\314\243\204"
+	.ascii	"7\203A\354\372\201\351\227\246>\342\307B|\356:)0P\342\021\374"
+	.ascii	"\r\b\277\330\034\243\364\\q\240\325\211I0\377\350t\005\341\217"
+	.ascii	"\260oh\377\237\227\001\267R\271\016\177\022\3605a \233\255\236"
+	.ascii	"Z\347S\242\233\024\354\227\363\314\315[\275\356[\265\345\373"
+	.ascii	"\372\335\267\016\035\277\270\353\343g`\361\360U>I\351\214\031"
+	.ascii	"\265'\032wf\314\273/\311\345\344\250\206\311\330wA7\225\305\022"
+	.ascii	"G\301\365\252to\365\212\301_\211\315I,\321\337\335\310\n\324"
+	.ascii	"\017\211\227\263\237'\262#Q>U\233\222\375\003\303\220}\235\270"
+	.ascii	"s\230\206\215\310\375\250\377\325^\340\313\363\352&I\206;s\325"
+	.ascii	"\305\241\221\211o\001\346\230\352\266w\371\036\363E\343\317#"
+	.ascii	"Z\004\234t\303\337?b\2438o\362\342\272c9\367\314\020\351M\201"
+	.ascii	"\305]\001"
+	.text
+	.section	.gnu.lto_.symtab.65797e904e921ecc,"e",@progbits
+	.string	"batteryWarningVoltage"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"batteryCriticalVoltage"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"batteryCellCount"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"batteryUpdateVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"batteryUpdatePresence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"getBatteryStateString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"batteryStateStrings"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"batteryUpdateCurrentMeter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"calculateVbatPidCompensation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"batteryUpdateStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"batteryUpdateAlarms"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"getBatteryVoltageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"getAmperageLatest"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"pgResetTemplate_batteryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"batteryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"currentMeterESCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"currentMeterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.65797e904e921ecc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10912 @@
+	.file	"compass.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/axis.h"
+	.file 6 "./src/main/drivers/io_types.h"
+	.file 7 "./src/main/drivers/sensor.h"
+	.file 8 "./src/main/drivers/compass.h"
+	.file 9 "./src/main/drivers/resource.h"
+	.file 10 "./src/main/fc/runtime_config.h"
+	.file 11 "./src/main/sensors/sensors.h"
+	.file 12 "./src/main/sensors/compass.h"
+	.file 13 "./src/main/sensors/compass.c"
+	.file 14 "./src/main/sensors/boardalignment.h"
+	.file 15 "./src/main/fc/config.h"
+	.file 16 "./src/main/sensors/gyro.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	compass.c.509eda29
+	.weak	compass.c.509eda29
+compass.c.509eda29:
+	.long	0x7fe
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1659
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1499
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1500
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1501
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1502
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1503
+	.uleb128 0x2
+	.long	.LASF1504
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1505
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1506
+	.uleb128 0x2
+	.long	.LASF1507
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1508
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1509
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1510
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1511
+	.uleb128 0x2
+	.long	.LASF1512
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xb
+	.long	0x9f
+	.uleb128 0x2
+	.long	.LASF1513
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF1514
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1515
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1516
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x14
+	.long	0xf8
+	.uleb128 0xf
+	.string	"X"
+	.byte	0
+	.uleb128 0xf
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0xf
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1517
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xc8
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x132
+	.uleb128 0xc
+	.long	.LASF1518
+	.value	0xfff
+	.uleb128 0xc
+	.long	.LASF1519
+	.value	0xf000
+	.uleb128 0xc
+	.long	.LASF1520
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1521
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1522
+	.value	0x8000
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1523
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xf
+	.long	0x13e
+	.uleb128 0x1c
+	.long	0x14e
+	.uleb128 0x8
+	.long	0x96
+	.uleb128 0x8
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x4
+	.byte	0x35
+	.byte	0x5
+	.long	0x16f
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x36
+	.byte	0xf
+	.long	0x96
+	.uleb128 0xd
+	.string	"fn"
+	.byte	0x4
+	.byte	0x37
+	.byte	0x16
+	.long	0x16f
+	.byte	0
+	.uleb128 0x4
+	.long	0x132
+	.uleb128 0x9
+	.long	.LASF1540
+	.byte	0x20
+	.byte	0x4
+	.byte	0x30
+	.byte	0x10
+	.long	0x1c3
+	.uleb128 0xe
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xb
+	.long	0xf8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1524
+	.byte	0x4
+	.byte	0x32
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1525
+	.byte	0x4
+	.byte	0x33
+	.byte	0xe
+	.long	0x1c3
+	.byte	0x8
+	.uleb128 0xe
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x34
+	.byte	0xf
+	.long	0x1c8
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1526
+	.byte	0x4
+	.byte	0x38
+	.byte	0x7
+	.long	0x14e
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0xbc
+	.uleb128 0x4
+	.long	0x1c3
+	.uleb128 0x2
+	.long	.LASF1527
+	.byte	0x4
+	.byte	0x39
+	.byte	0x3
+	.long	0x174
+	.uleb128 0xb
+	.long	0x1cd
+	.uleb128 0x2
+	.long	.LASF1528
+	.byte	0x6
+	.byte	0x18
+	.byte	0x11
+	.long	0xbc
+	.uleb128 0x2
+	.long	.LASF1529
+	.byte	0x6
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x19
+	.long	0x238
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1534
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1536
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1537
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1538
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1539
+	.byte	0x7
+	.byte	0x23
+	.byte	0x3
+	.long	0x1f6
+	.uleb128 0x9
+	.long	.LASF1541
+	.byte	0x8
+	.byte	0x7
+	.byte	0x26
+	.byte	0xc
+	.long	0x25f
+	.uleb128 0x3
+	.long	.LASF1542
+	.byte	0x7
+	.byte	0x27
+	.byte	0xe
+	.long	0x1ea
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1543
+	.byte	0x8
+	.byte	0x7
+	.byte	0x25
+	.long	0x278
+	.uleb128 0xd
+	.string	"spi"
+	.byte	0x7
+	.byte	0x28
+	.byte	0x7
+	.long	0x244
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1543
+	.byte	0x7
+	.byte	0x29
+	.byte	0x3
+	.long	0x25f
+	.uleb128 0xb
+	.long	0x278
+	.uleb128 0x2
+	.long	.LASF1544
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xf
+	.long	0x295
+	.uleb128 0x4
+	.long	0x29a
+	.uleb128 0x1e
+	.long	0x29f
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1545
+	.uleb128 0x2
+	.long	.LASF1546
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xf
+	.long	0x2b2
+	.uleb128 0x4
+	.long	0x2b7
+	.uleb128 0x1f
+	.long	0x29f
+	.long	0x2c6
+	.uleb128 0x8
+	.long	0x2c6
+	.byte	0
+	.uleb128 0x4
+	.long	0x9f
+	.uleb128 0x9
+	.long	.LASF1547
+	.byte	0x20
+	.byte	0x8
+	.byte	0x16
+	.byte	0x10
+	.long	0x30d
+	.uleb128 0x3
+	.long	.LASF1548
+	.byte	0x8
+	.byte	0x17
+	.byte	0x17
+	.long	0x289
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1549
+	.byte	0x8
+	.byte	0x18
+	.byte	0x17
+	.long	0x2a6
+	.byte	0x8
+	.uleb128 0xe
+	.string	"bus"
+	.byte	0x8
+	.byte	0x19
+	.byte	0x11
+	.long	0x278
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1550
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x14
+	.long	0x238
+	.byte	0x18
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1551
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x3
+	.long	0x2cb
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x14
+	.long	0x43f
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x36
+	.long	0x469
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x10
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1609
+	.byte	0xa
+	.byte	0x42
+	.byte	0x10
+	.long	0xbc
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x14
+	.long	0x49f
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x4
+	.byte	0
+	.uleb128 0x10
+	.long	0xbc
+	.long	0x4af
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1610
+	.byte	0xb
+	.byte	0x1c
+	.byte	0x10
+	.long	0x49f
+	.uleb128 0x9
+	.long	.LASF1611
+	.byte	0x6
+	.byte	0xb
+	.byte	0x1e
+	.byte	0x10
+	.long	0x4f0
+	.uleb128 0x3
+	.long	.LASF1612
+	.byte	0xb
+	.byte	0x1f
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1613
+	.byte	0xb
+	.byte	0x20
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0xe
+	.string	"yaw"
+	.byte	0xb
+	.byte	0x21
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1614
+	.byte	0xb
+	.byte	0x22
+	.byte	0x3
+	.long	0x4bb
+	.uleb128 0x14
+	.long	.LASF1615
+	.byte	0x6
+	.byte	0xb
+	.byte	0x24
+	.long	0x521
+	.uleb128 0xd
+	.string	"raw"
+	.byte	0xb
+	.byte	0x25
+	.byte	0xd
+	.long	0x521
+	.uleb128 0x20
+	.long	.LASF1616
+	.byte	0xb
+	.byte	0x26
+	.byte	0x1f
+	.long	0x4f0
+	.byte	0
+	.uleb128 0x10
+	.long	0x9f
+	.long	0x531
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1617
+	.byte	0xb
+	.byte	0x27
+	.byte	0x3
+	.long	0x4fc
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x2d
+	.long	0x573
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x1b
+	.long	0x59d
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1630
+	.byte	0xc
+	.byte	0x21
+	.byte	0x3
+	.long	0x573
+	.uleb128 0x9
+	.long	.LASF1631
+	.byte	0x10
+	.byte	0xc
+	.byte	0x23
+	.byte	0x10
+	.long	0x5d1
+	.uleb128 0x3
+	.long	.LASF1632
+	.byte	0xc
+	.byte	0x24
+	.byte	0xd
+	.long	0x5d1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1633
+	.byte	0xc
+	.byte	0x25
+	.byte	0xb
+	.long	0x5e1
+	.byte	0xc
+	.byte	0
+	.uleb128 0x10
+	.long	0xb0
+	.long	0x5e1
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1634
+	.uleb128 0x2
+	.long	.LASF1635
+	.byte	0xc
+	.byte	0x26
+	.byte	0x3
+	.long	0x5a9
+	.uleb128 0x21
+	.string	"mag"
+	.byte	0xc
+	.byte	0x28
+	.byte	0xe
+	.long	0x5e8
+	.uleb128 0x9
+	.long	.LASF1636
+	.byte	0x10
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x10
+	.long	0x64f
+	.uleb128 0x3
+	.long	.LASF1637
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1638
+	.byte	0xc
+	.byte	0x2d
+	.byte	0x14
+	.long	0x238
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1639
+	.byte	0xc
+	.byte	0x2e
+	.byte	0xd
+	.long	0xbc
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1640
+	.byte	0xc
+	.byte	0x2f
+	.byte	0xd
+	.long	0x1de
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1641
+	.byte	0xc
+	.byte	0x30
+	.byte	0x1b
+	.long	0x531
+	.byte	0xa
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1642
+	.byte	0xc
+	.byte	0x31
+	.byte	0x3
+	.long	0x600
+	.uleb128 0xb
+	.long	0x64f
+	.uleb128 0xa
+	.long	.LASF1643
+	.byte	0xc
+	.byte	0x33
+	.byte	0x18
+	.long	0x64f
+	.uleb128 0x22
+	.long	.LASF1660
+	.byte	0xd
+	.byte	0x30
+	.byte	0xa
+	.long	0x30d
+	.uleb128 0x15
+	.long	0x5f4
+	.byte	0x31
+	.byte	0x7
+	.uleb128 0xa
+	.long	.LASF1644
+	.byte	0xd
+	.byte	0x39
+	.byte	0x1e
+	.long	0x65b
+	.uleb128 0x15
+	.long	0x660
+	.byte	0x39
+	.byte	0x4d
+	.uleb128 0xa
+	.long	.LASF1645
+	.byte	0xd
+	.byte	0x39
+	.byte	0x7d
+	.long	0x1d9
+	.uleb128 0x23
+	.long	0x692
+	.byte	0xa8
+	.uleb128 0x24
+	.long	0x67f
+	.byte	0x3b
+	.byte	0x17
+	.uleb128 0x6
+	.long	.LASF1646
+	.byte	0x45
+	.byte	0x10
+	.long	0x521
+	.uleb128 0x6
+	.long	.LASF1647
+	.byte	0x46
+	.byte	0x10
+	.long	0xbc
+	.uleb128 0x25
+	.long	.LASF1661
+	.byte	0xf
+	.byte	0x67
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF1648
+	.byte	0xe
+	.byte	0x1e
+	.long	0x6df
+	.uleb128 0x8
+	.long	0x6df
+	.uleb128 0x8
+	.long	0xbc
+	.byte	0
+	.uleb128 0x4
+	.long	0xb0
+	.uleb128 0x26
+	.long	.LASF1662
+	.byte	0x10
+	.byte	0x51
+	.byte	0x14
+	.long	0x6f0
+	.uleb128 0x4
+	.long	0x284
+	.uleb128 0x16
+	.long	.LASF1649
+	.byte	0xa
+	.byte	0x48
+	.long	0x706
+	.uleb128 0x8
+	.long	0xd4
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1663
+	.byte	0xd
+	.byte	0xa4
+	.byte	0x6
+	.long	0x78a
+	.uleb128 0x12
+	.long	.LASF1650
+	.byte	0xa4
+	.byte	0x1d
+	.long	0xd4
+	.uleb128 0x12
+	.long	.LASF1641
+	.byte	0xa4
+	.byte	0x41
+	.long	0x78a
+	.uleb128 0x6
+	.long	.LASF1651
+	.byte	0xa6
+	.byte	0x15
+	.long	0xd4
+	.uleb128 0x6
+	.long	.LASF1652
+	.byte	0xa7
+	.byte	0x22
+	.long	0x531
+	.uleb128 0x6
+	.long	.LASF1653
+	.byte	0xa8
+	.byte	0x22
+	.long	0x531
+	.uleb128 0x13
+	.long	0x75a
+	.uleb128 0x6
+	.long	.LASF1654
+	.byte	0xab
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.uleb128 0x13
+	.long	0x76b
+	.uleb128 0x6
+	.long	.LASF1654
+	.byte	0xb2
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.uleb128 0x13
+	.long	0x77c
+	.uleb128 0x6
+	.long	.LASF1654
+	.byte	0xc3
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x6
+	.long	.LASF1654
+	.byte	0xcb
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x531
+	.uleb128 0x17
+	.long	.LASF1655
+	.byte	0x8c
+	.long	0x29f
+	.long	0x7b2
+	.uleb128 0x18
+	.string	"deg"
+	.byte	0x97
+	.long	0xab
+	.uleb128 0x18
+	.string	"min"
+	.byte	0x98
+	.long	0xab
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1656
+	.byte	0x48
+	.long	0x29f
+	.long	0x7eb
+	.uleb128 0x29
+	.string	"dev"
+	.byte	0xd
+	.byte	0x48
+	.byte	0x1d
+	.long	0x7eb
+	.uleb128 0x12
+	.long	.LASF1657
+	.byte	0x48
+	.byte	0x2e
+	.long	0x59d
+	.uleb128 0x6
+	.long	.LASF1658
+	.byte	0x4a
+	.byte	0x11
+	.long	0x59d
+	.uleb128 0x2a
+	.long	.LASF1664
+	.byte	0xd
+	.byte	0x4c
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	0x30d
+	.uleb128 0x2b
+	.long	.LASF1665
+	.byte	0xc
+	.byte	0x33
+	.byte	0x53
+	.long	0x7fc
+	.uleb128 0x4
+	.long	0x65b
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 17 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 19 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.file 20 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 22 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 23 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 26 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 33 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.file 34 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 35 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x23
+	.file 36 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 37 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x25
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.file 38 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 39 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1059
+	.byte	0x4
+	.file 40 "./src/main/drivers/compass_ak8975.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x28
+	.byte	0x4
+	.file 41 "./src/main/drivers/compass_ak8963.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x29
+	.byte	0x4
+	.file 42 "./src/main/drivers/compass_fake.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2a
+	.byte	0x4
+	.file 43 "./src/main/drivers/compass_hmc5883l.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2b
+	.byte	0x4
+	.file 44 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2c
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 45 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x2d
+	.file 46 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 47 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 48 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xf
+	.file 49 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x31
+	.byte	0x4
+	.file 50 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x32
+	.byte	0x4
+	.file 51 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 52 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0x4
+	.file 53 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1480
+	.byte	0x4
+	.file 54 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 55 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1484
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x10
+	.file 56 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1497
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1498
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF807
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF820
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF856
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF857
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF858
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF860
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF768
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF908
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF944
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF951
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF974
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1056
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1061
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1069
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1087
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1099
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.23.95742be8daec10c1d662dd67b9ee58de,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1477
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1479
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1483
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1493
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1496
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1666
+	.long	.LASF1667
+	.long	.LASF1668
+	.long	.LASF1669
+	.long	.LASF1670
+	.long	.LASF1671
+	.long	.LASF1672
+	.long	.LASF1673
+	.long	.LASF1674
+	.long	.LASF1675
+	.long	.LASF1676
+	.long	.LASF1677
+	.long	.LASF1678
+	.long	.LASF1679
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x39
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1680
+	.byte	0xa
+	.long	.LASF1681
+	.byte	0xa
+	.long	.LASF1682
+	.byte	0xa
+	.long	.LASF1683
+	.byte	0x3
+	.long	.LASF1684
+	.byte	0x2
+	.long	.LASF1685
+	.byte	0x4
+	.long	.LASF1686
+	.byte	0x4
+	.long	.LASF1687
+	.byte	0x4
+	.long	.LASF1688
+	.byte	0x4
+	.long	.LASF1689
+	.byte	0x5
+	.long	.LASF1690
+	.byte	0x6
+	.long	.LASF1687
+	.byte	0x6
+	.long	.LASF1691
+	.byte	0x6
+	.long	.LASF1692
+	.byte	0x6
+	.long	.LASF1693
+	.byte	0x5
+	.long	.LASF1694
+	.byte	0x6
+	.long	.LASF1695
+	.byte	0xd
+	.long	.LASF1696
+	.byte	0xe
+	.long	.LASF1697
+	.byte	0xe
+	.long	.LASF1697
+	.byte	0xd
+	.long	.LASF1698
+	.byte	0xa
+	.long	.LASF1699
+	.byte	0xd
+	.long	.LASF1700
+	.byte	0xd
+	.long	.LASF1701
+	.byte	0xa
+	.long	.LASF1702
+	.byte	0xa
+	.long	.LASF1703
+	.byte	0xc
+	.long	.LASF1704
+	.byte	0xa
+	.long	.LASF1705
+	.byte	0xb
+	.long	.LASF1706
+	.byte	0xb
+	.long	.LASF1707
+	.byte	0xa
+	.long	.LASF1708
+	.byte	0xa
+	.long	.LASF1709
+	.byte	0xa
+	.long	.LASF1710
+	.byte	0x9
+	.long	.LASF1711
+	.byte	0x8
+	.long	.LASF1712
+	.byte	0x7
+	.long	.LASF1713
+	.byte	0xe
+	.long	.LASF1714
+	.byte	0x8
+	.long	.LASF1715
+	.byte	0x1
+	.long	.LASF1716
+	.byte	0x3
+	.long	.LASF1717
+	.byte	0x4
+	.long	.LASF1718
+	.byte	0x4
+	.long	.LASF1719
+	.byte	0x4
+	.long	.LASF1720
+	.byte	0x4
+	.long	.LASF1721
+	.byte	0x4
+	.long	.LASF1722
+	.byte	0x4
+	.long	.LASF1723
+	.byte	0x2
+	.long	.LASF1724
+	.byte	0x4
+	.long	.LASF1725
+	.byte	0x4
+	.long	.LASF1726
+	.byte	0x4
+	.long	.LASF1727
+	.byte	0x4
+	.long	.LASF1728
+	.byte	0x4
+	.long	.LASF1729
+	.byte	0x4
+	.long	.LASF1730
+	.byte	0x4
+	.long	.LASF1731
+	.byte	0x4
+	.long	.LASF1732
+	.byte	0x4
+	.long	.LASF1733
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1626:
+	.string	"MAG_NONE"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1095:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF953:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF850:
+	.string	"_WCHAR_T_DEFINED "
+.LASF802:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1215:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1313:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF885:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF889:
+	.string	"USE_PPM"
+.LASF1233:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1637:
+	.string	"mag_declination"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1463:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF775:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1649:
+	.string	"sensorsSet"
+.LASF1362:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF872:
+	.string	"USE_FAKE_GYRO "
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1639:
+	.string	"mag_hardware"
+.LASF952:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1657:
+	.string	"magHardwareToUse"
+.LASF1101:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF891:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1504:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1545:
+	.string	"_Bool"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF886:
+	.string	"USE_UART8 "
+.LASF1617:
+	.string	"flightDynamicsTrims_t"
+.LASF1615:
+	.string	"flightDynamicsTrims_u"
+.LASF869:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1062:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1623:
+	.string	"SENSOR_GPS"
+.LASF797:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1560:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF958:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1536:
+	.string	"CW90_DEG_FLIP"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1152:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1102:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1386:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1332:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1653:
+	.string	"magZeroTempMax"
+.LASF974:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1538:
+	.string	"CW270_DEG_FLIP"
+.LASF1488:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1091:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF842:
+	.string	"__WCHAR_T__ "
+.LASF803:
+	.string	"USE_SENSOR_NAMES "
+.LASF1455:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1610:
+	.string	"detectedSensors"
+.LASF1012:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1549:
+	.string	"read"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1373:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1557:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1600:
+	.string	"GPS_FIX"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1404:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1515:
+	.string	"uint16_t"
+.LASF1155:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1465:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF997:
+	.string	"PG_RX_CONFIG 24"
+.LASF1541:
+	.string	"deviceSpi_s"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1394:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF786:
+	.string	"TELEMETRY_HOTT "
+.LASF964:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1361:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1119:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF933:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1088:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF812:
+	.string	"_T_PTRDIFF_ "
+.LASF1550:
+	.string	"magAlign"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1275:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1008:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1241:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1083:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1311:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF962:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF841:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1114:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1136:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1562:
+	.string	"OWNER_ADC_RSSI"
+.LASF1418:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1278:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1016:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1650:
+	.string	"currentTime"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1382:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1454:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1564:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1122:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF955:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1080:
+	.string	"BIT(x) (1 << (x))"
+.LASF1589:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1478:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF957:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1130:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1513:
+	.string	"int32_t"
+.LASF1281:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF875:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1643:
+	.string	"compassConfig_System"
+.LASF852:
+	.string	"___int_wchar_t_h "
+.LASF1430:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1376:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1093:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1197:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1487:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF914:
+	.string	"VTX_TRAMP"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1586:
+	.string	"OWNER_BARO_EXTI"
+.LASF993:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF546:
+	.string	"__always_inline"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1662:
+	.string	"gyroSensorBus"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF890:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1616:
+	.string	"values"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1563:
+	.string	"OWNER_SERIAL_TX"
+.LASF898:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1076:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1013:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1026:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1027:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1520:
+	.string	"PGR_SIZE_MASK"
+.LASF1200:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF799:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1193:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1316:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1170:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF798:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1356:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1429:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1587:
+	.string	"OWNER_USB"
+.LASF1161:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1661:
+	.string	"saveConfigAndNotify"
+.LASF1044:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF1598:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF837:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1273:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1121:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1470:
+	.string	"LED0_OFF do {} while(0)"
+.LASF968:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1535:
+	.string	"CW0_DEG_FLIP"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1486:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1588:
+	.string	"OWNER_USB_DETECT"
+.LASF1338:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF1652:
+	.string	"magZeroTempMin"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1145:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1620:
+	.string	"SENSOR_BARO"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1568:
+	.string	"OWNER_SONAR_ECHO"
+.LASF905:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1379:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1325:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1005:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1048:
+	.string	"PG_VTX_CONFIG 515"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1556:
+	.string	"OWNER_SERVO"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF873:
+	.string	"ACC "
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF794:
+	.string	"TELEMETRY_IBUS "
+.LASF773:
+	.string	"USE_PWM "
+.LASF1409:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF843:
+	.string	"_WCHAR_T "
+.LASF1484:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1489:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1205:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF954:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1123:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1531:
+	.string	"CW0_DEG"
+.LASF1629:
+	.string	"MAG_AK8963"
+.LASF1612:
+	.string	"roll"
+.LASF818:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1128:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1614:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1505:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1507:
+	.string	"__uint16_t"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1555:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1212:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF929:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1583:
+	.string	"OWNER_RX_SPI_CS"
+.LASF853:
+	.string	"__INT_WCHAR_T_H "
+.LASF1534:
+	.string	"CW270_DEG"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1245:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1187:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1601:
+	.string	"CALIBRATE_MAG"
+.LASF1100:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF1628:
+	.string	"MAG_AK8975"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1131:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1422:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF951:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF941:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1248:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1074:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1253:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1440:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1499:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1644:
+	.string	"pgResetTemplate_compassConfig"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1055:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1058:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF956:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF819:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1032:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1442:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1006:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1328:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF989:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1036:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1634:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF984:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF960:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1419:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1401:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1217:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF871:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF800:
+	.string	"USE_MSP_PUSH "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1559:
+	.string	"OWNER_ADC_BATT"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1262:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF795:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF811:
+	.string	"_PTRDIFF_T "
+.LASF1540:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1169:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF946:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1137:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1059:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF826:
+	.string	"_T_SIZE_ "
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1530:
+	.string	"ALIGN_DEFAULT"
+.LASF942:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF790:
+	.string	"USE_SERVOS "
+.LASF1522:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1159:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1595:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF783:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1490:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF932:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1235:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1548:
+	.string	"init"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF849:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1240:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1319:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF781:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1308:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1656:
+	.string	"compassDetect"
+.LASF1577:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1425:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1371:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1214:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1290:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1206:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1124:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1544:
+	.string	"sensorInitFuncPtr"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1176:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1518:
+	.string	"PGR_PGN_MASK"
+.LASF851:
+	.string	"_WCHAR_T_H "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF863:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1445:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1331:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1374:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1011:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF770:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1457:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1385:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1021:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1046:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1111:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1416:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1179:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1202:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF936:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1631:
+	.string	"mag_s"
+.LASF1635:
+	.string	"mag_t"
+.LASF1296:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1064:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1061:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1524:
+	.string	"size"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1260:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1606:
+	.string	"SENSOR_INDEX_BARO"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1031:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF864:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1265:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF866:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1449:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF836:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1134:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF831:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1592:
+	.string	"OWNER_INVERTER"
+.LASF908:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1274:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1572:
+	.string	"OWNER_SPI_MOSI"
+.LASF1428:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1523:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1514:
+	.string	"uint8_t"
+.LASF1173:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF918:
+	.string	"USE_DSHOT"
+.LASF1277:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1078:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1607:
+	.string	"SENSOR_INDEX_MAG"
+.LASF784:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF1025:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1280:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1057:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF854:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF903:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1053:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1367:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1286:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1421:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF857:
+	.string	"_BSD_WCHAR_T_"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF792:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF829:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1641:
+	.string	"magZero"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1094:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF840:
+	.string	"__need_size_t"
+.LASF1554:
+	.string	"OWNER_PPMINPUT"
+.LASF1528:
+	.string	"ioTag_t"
+.LASF821:
+	.string	"__need_ptrdiff_t"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF764:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF945:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1654:
+	.string	"axis"
+.LASF1196:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF808:
+	.string	"_STDDEF_H "
+.LASF1384:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1125:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1224:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF991:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1496:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1023:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF999:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF973:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF963:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1140:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF766:
+	.string	"I2C1_OVERCLOCK true"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1163:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF834:
+	.string	"_SIZE_T_DECLARED "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1209:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF915:
+	.string	"BLACKBOX"
+.LASF1365:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1017:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1323:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF900:
+	.string	"LED_STRIP"
+.LASF1358:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF768:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1627:
+	.string	"MAG_HMC5883"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1403:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1622:
+	.string	"SENSOR_SONAR"
+.LASF1143:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF896:
+	.string	"USE_SERIALRX_SUMD"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF897:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1269:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1098:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1045:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1619:
+	.string	"SENSOR_ACC"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1406:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1567:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1525:
+	.string	"address"
+.LASF1552:
+	.string	"OWNER_FREE"
+.LASF1259:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1343:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1247:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1250:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF895:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1611:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1146:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1068:
+	.string	"IOCFG_IPU 0"
+.LASF972:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1289:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF859:
+	.string	"NULL"
+.LASF1599:
+	.string	"GPS_FIX_HOME"
+.LASF1268:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1451:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1613:
+	.string	"pitch"
+.LASF1569:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF961:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF499:
+	.string	"__PMT"
+.LASF855:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF917:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1096:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1295:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF767:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1638:
+	.string	"mag_align"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1493:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1521:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF981:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1471:
+	.string	"LED0_ON do {} while(0)"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1301:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1172:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1135:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1142:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1244:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF949:
+	.string	"UNIT_TESTED "
+.LASF980:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1326:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF927:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF847:
+	.string	"_WCHAR_T_ "
+.LASF1105:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF931:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1305:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1659:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1468:
+	.string	"LED_NUMBER 3"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF959:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF763:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF825:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1126:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1475:
+	.string	"LED2_TOGGLE do {} while(0)"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1272:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1104:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1415:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF778:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1188:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1346:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1495:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF1605:
+	.string	"SENSOR_INDEX_ACC"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF975:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1388:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF861:
+	.string	"__need_NULL"
+.LASF862:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1141:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF772:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1117:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF899:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF892:
+	.string	"USE_SERIALRX_CRSF"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1226:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF926:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1191:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1526:
+	.string	"reset"
+.LASF1178:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF982:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF1645:
+	.string	"compassConfig_Registry"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1071:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1575:
+	.string	"OWNER_SDCARD"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1446:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1022:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1512:
+	.string	"int16_t"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1293:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1500:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1503:
+	.string	"signed char"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1194:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF822:
+	.string	"__size_t__ "
+.LASF788:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF789:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1157:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1443:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1329:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF990:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1665:
+	.string	"compassConfig"
+.LASF1019:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1029:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1352:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1271:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1485:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF830:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1370:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF909:
+	.string	"USE_DASHBOARD"
+.LASF787:
+	.string	"TELEMETRY_LTM "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1103:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1082:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1108:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF833:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF998:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1621:
+	.string	"SENSOR_MAG"
+.LASF1397:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1516:
+	.string	"uint32_t"
+.LASF1349:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1597:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF930:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1002:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF782:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF810:
+	.string	"_ANSI_STDDEF_H "
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1052:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1590:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1519:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1151:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1410:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1007:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1060:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1040:
+	.string	"PG_PPM_CONFIG 507"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1112:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1491:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF920:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1149:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF776:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1186:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1092:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1127:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF806:
+	.string	"VTX_SMARTAUDIO "
+.LASF1085:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1256:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1004:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1066:
+	.string	"IOCFG_AF_OD 0"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1118:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1236:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF921:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF969:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF791:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1304:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1160:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1609:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1474:
+	.string	"LED1_ON do {} while(0)"
+.LASF1099:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1001:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1392:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1510:
+	.string	"long int"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1221:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF994:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF785:
+	.string	"TELEMETRY_FRSKY "
+.LASF1038:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1633:
+	.string	"magneticDeclination"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1239:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1565:
+	.string	"OWNER_PINDEBUG"
+.LASF1166:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1433:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF793:
+	.string	"TELEMETRY_CRSF "
+.LASF1238:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF815:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1624:
+	.string	"SENSOR_GPSMAG"
+.LASF814:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1266:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF985:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1077:
+	.string	"EXPAND_I(x) x"
+.LASF1242:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF907:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1199:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF828:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1658:
+	.string	"magHardware"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1069:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF827:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1020:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1037:
+	.string	"PG_PID_CONFIG 504"
+.LASF856:
+	.string	"__DEFINED_wchar_t "
+.LASF1377:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF522:
+	.string	"__flexarr []"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF901:
+	.string	"TELEMETRY_FRSKY"
+.LASF1660:
+	.string	"magDev"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF950:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1640:
+	.string	"interruptTag"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF971:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF844:
+	.string	"_T_WCHAR_ "
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF977:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1182:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1047:
+	.string	"PG_VCD_CONFIG 514"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1257:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1566:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1018:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1395:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1341:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF939:
+	.string	"__enable_irq() "
+.LASF1109:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1511:
+	.string	"char"
+.LASF1625:
+	.string	"MAG_DEFAULT"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1175:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1322:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF935:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF870:
+	.string	"LED0_PIN NONE"
+.LASF1476:
+	.string	"LED2_OFF do {} while(0)"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1529:
+	.string	"IO_t"
+.LASF1302:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF824:
+	.string	"_SIZE_T "
+.LASF880:
+	.string	"USE_UART2 "
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1630:
+	.string	"magSensor_e"
+.LASF1056:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF976:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1310:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF801:
+	.string	"USE_RX_MSP "
+.LASF1073:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1284:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF832:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1458:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1497:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF839:
+	.string	"__size_t "
+.LASF943:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF940:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1546:
+	.string	"sensorReadFuncPtr"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1010:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1655:
+	.string	"compassInit"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1287:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF860:
+	.string	"NULL ((void *)0)"
+.LASF1537:
+	.string	"CW180_DEG_FLIP"
+.LASF1466:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1578:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1075:
+	.string	"STR_HELPER(x) #x"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1015:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF913:
+	.string	"VTX_SMARTAUDIO"
+.LASF911:
+	.string	"VTX_COMMON"
+.LASF1570:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1203:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1054:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF947:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1364:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF894:
+	.string	"USE_SERIALRX_SBUS"
+.LASF876:
+	.string	"USE_FAKE_BARO "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1492:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1181:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF858:
+	.string	"__need_wchar_t"
+.LASF970:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF813:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1494:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1651:
+	.string	"tCal"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1039:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1344:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1307:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1648:
+	.string	"alignSensors"
+.LASF1223:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1532:
+	.string	"CW90_DEG"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1439:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1539:
+	.string	"sensor_align_e"
+.LASF912:
+	.string	"VTX_CONTROL"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1461:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1663:
+	.string	"compassUpdate"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1167:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1079:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1028:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF965:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1030:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF769:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF765:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF966:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1547:
+	.string	"magDev_s"
+.LASF1551:
+	.string	"magDev_t"
+.LASF1355:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1211:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1050:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1479:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1573:
+	.string	"OWNER_I2C_SCL"
+.LASF1571:
+	.string	"OWNER_SPI_MISO"
+.LASF1116:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1596:
+	.string	"OWNER_COMPASS_CS"
+.LASF1084:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1139:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1389:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF978:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF848:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1220:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1602:
+	.string	"SMALL_ANGLE"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1646:
+	.string	"magADCRaw"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1407:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1508:
+	.string	"__int32_t"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1574:
+	.string	"OWNER_I2C_SDA"
+.LASF1509:
+	.string	"__uint32_t"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1368:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF995:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1543:
+	.string	"busDevice_t"
+.LASF771:
+	.string	"USE_CLI "
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1413:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1158:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1636:
+	.string	"compassConfig_s"
+.LASF1642:
+	.string	"compassConfig_t"
+.LASF1579:
+	.string	"OWNER_FLASH"
+.LASF1448:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1024:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1003:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1067:
+	.string	"IOCFG_IPD 0"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1603:
+	.string	"FIXED_WING"
+.LASF1347:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF777:
+	.string	"USE_SERIALRX_SBUS "
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF845:
+	.string	"_T_WCHAR "
+.LASF1378:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF838:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1359:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF809:
+	.string	"_STDDEF_H_ "
+.LASF1097:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1115:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1464:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1133:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1218:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1334:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1110:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1000:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1251:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1317:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1591:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF805:
+	.string	"VTX_CONTROL "
+.LASF1353:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1594:
+	.string	"OWNER_TRANSPONDER"
+.LASF996:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1482:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF816:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF846:
+	.string	"__WCHAR_T "
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1263:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1664:
+	.string	"retry"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1120:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1081:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF868:
+	.string	"U_ID_1 1"
+.LASF867:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF919:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1581:
+	.string	"OWNER_MPU_CS"
+.LASF1584:
+	.string	"OWNER_SPI_CS"
+.LASF1042:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1154:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1412:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF877:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1350:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1086:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF992:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF938:
+	.string	"__disable_irq() "
+.LASF1354:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1431:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF928:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF979:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF922:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1087:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF779:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1035:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1009:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF937:
+	.string	"EEPROM_SIZE 32768"
+.LASF1254:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1283:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1542:
+	.string	"csnPin"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1129:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF944:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1391:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1400:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1337:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1148:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1553:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1232:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1469:
+	.string	"LED0_TOGGLE do {} while(0)"
+.LASF948:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF923:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1314:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF817:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1498:
+	.string	"COMPASS_INTERRUPT_TAG IO_TAG_NONE"
+.LASF1132:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1452:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF780:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1106:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF893:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1436:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF796:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1208:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1063:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1483:
+	.string	"BEEP_ON do {} while(0)"
+.LASF983:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1576:
+	.string	"OWNER_SDCARD_CS"
+.LASF924:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1647:
+	.string	"magInit"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1618:
+	.string	"SENSOR_GYRO"
+.LASF835:
+	.string	"__DEFINED_size_t "
+.LASF1113:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1299:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF879:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1434:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1320:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1517:
+	.string	"pgn_t"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1229:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1185:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1477:
+	.string	"LED2_ON do {} while(0)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1065:
+	.string	"IOCFG_AF_PP 0"
+.LASF1043:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1473:
+	.string	"LED1_OFF do {} while(0)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF887:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF925:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1502:
+	.string	"long unsigned int"
+.LASF1089:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1593:
+	.string	"OWNER_LED_STRIP"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1070:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF804:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF807:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1481:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1340:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1456:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1608:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1472:
+	.string	"LED1_TOGGLE do {} while(0)"
+.LASF987:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1014:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF881:
+	.string	"USE_UART3 "
+.LASF774:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1107:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1292:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF823:
+	.string	"__SIZE_T__ "
+.LASF1090:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1632:
+	.string	"magADC"
+.LASF1164:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1580:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1033:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1190:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1501:
+	.string	"unsigned int"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF882:
+	.string	"USE_UART4 "
+.LASF1298:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1460:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1072:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1398:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1184:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1049:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1041:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1335:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1558:
+	.string	"OWNER_ADC"
+.LASF1506:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1585:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1527:
+	.string	"pgRegistry_t"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1480:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1227:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1437:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF883:
+	.string	"USE_UART5 "
+.LASF1383:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF986:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF988:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1561:
+	.string	"OWNER_ADC_EXT"
+.LASF1034:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1533:
+	.string	"CW180_DEG"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF934:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1582:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1424:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF820:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF967:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1051:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1604:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1427:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1467:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF884:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1230:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF0:
+	.string	"./src/main/sensors/compass.c"
+.LASF1694:
+	.string	"gyro.h"
+.LASF1704:
+	.string	"long-double.h"
+.LASF1710:
+	.string	"platform.h"
+.LASF1712:
+	.string	"target.h"
+.LASF1691:
+	.string	"compass.c"
+.LASF1698:
+	.string	"libc-header-start.h"
+.LASF1696:
+	.string	"stdbool.h"
+.LASF1677:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1687:
+	.string	"compass.h"
+.LASF1681:
+	.string	"stdint-intn.h"
+.LASF1684:
+	.string	"axis.h"
+.LASF1676:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1679:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1705:
+	.string	"stubs.h"
+.LASF1672:
+	.string	"src/main/target/SITL"
+.LASF1702:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1724:
+	.string	"io_def_generated.h"
+.LASF1675:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1693:
+	.string	"config.h"
+.LASF1700:
+	.string	"features-time64.h"
+.LASF1732:
+	.string	"vcd.h"
+.LASF1731:
+	.string	"sound_beeper.h"
+.LASF1680:
+	.string	"types.h"
+.LASF1685:
+	.string	"io_types.h"
+.LASF1689:
+	.string	"runtime_config.h"
+.LASF1669:
+	.string	"src/main/drivers"
+.LASF1678:
+	.string	"/usr/include"
+.LASF1666:
+	.string	"src/main/build"
+.LASF1719:
+	.string	"compass_fake.h"
+.LASF1699:
+	.string	"features.h"
+.LASF1711:
+	.string	"common.h"
+.LASF1707:
+	.string	"typesizes.h"
+.LASF1667:
+	.string	"src/main/common"
+.LASF1730:
+	.string	"serial.h"
+.LASF1718:
+	.string	"compass_ak8963.h"
+.LASF1668:
+	.string	"src/main/config"
+.LASF1690:
+	.string	"sensors.h"
+.LASF1708:
+	.string	"time64.h"
+.LASF1682:
+	.string	"stdint-uintn.h"
+.LASF1673:
+	.string	"src/main/target"
+.LASF1717:
+	.string	"compass_ak8975.h"
+.LASF1674:
+	.string	"src/main"
+.LASF1725:
+	.string	"light_led.h"
+.LASF1671:
+	.string	"src/main/sensors"
+.LASF1688:
+	.string	"resource.h"
+.LASF1728:
+	.string	"rx_pwm.h"
+.LASF1733:
+	.string	"time.h"
+.LASF1716:
+	.string	"parameter_group_ids.h"
+.LASF1686:
+	.string	"sensor.h"
+.LASF1709:
+	.string	"wchar.h"
+.LASF1722:
+	.string	"io_def.h"
+.LASF1670:
+	.string	"src/main/fc"
+.LASF1721:
+	.string	"io.h"
+.LASF1692:
+	.string	"boardalignment.h"
+.LASF1703:
+	.string	"cdefs.h"
+.LASF1729:
+	.string	"sdcard.h"
+.LASF1723:
+	.string	"utils.h"
+.LASF1697:
+	.string	"stdint.h"
+.LASF1715:
+	.string	"build_config.h"
+.LASF1713:
+	.string	"stddef.h"
+.LASF1706:
+	.string	"stubs-64.h"
+.LASF1720:
+	.string	"compass_hmc5883l.h"
+.LASF1701:
+	.string	"wordsize.h"
+.LASF1714:
+	.string	"common_post.h"
+.LASF1726:
+	.string	"adc.h"
+.LASF1683:
+	.string	"parameter_group.h"
+.LASF1695:
+	.string	"stdc-predef.h"
+.LASF1727:
+	.string	"flash.h"
+	.text
+	.section	.gnu.lto_.profile.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.text
+	.section	.gnu.lto_.icf.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375 \362\235\004"
+	.string	"\242\306\030$\240)\215\001\200\311\247\210[v\361\231\273\031\353\\E\357\343\227\250\252F\375\177u\262\345&\233\354\275%\331i\313\tp(\036\273\201Ha\360\034\3274\b\2051i\013\016\331\003\207\357;\233\251\337\316n\275\031z\f\227\205@\031\345\b\210\230X\317\333\354\365ZgV\277KQd\251\244t\376\213\207\330\310MI\024"
+	.string	"5ER\356\276\232\221\030A/\004;\003v\001 \200\257\fC\260\340\005\300\317\007\260"
+	.ascii	"\270\3139vSf\246\316\202&\234\"\312\006\332"
+	.text
+	.section	.gnu.lto_.ipa_sra.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375 /\375"
+	.string	""
+	.string	"\250#"
+	.string	"\003"
+	.string	"\002"
+	.string	"\003\001"
+	.string	"\003"
+	.string	""
+	.string	"\005\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.string	"3\213\001\231l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375 \233\335\003"
+	.string	"\022G\031%\200K\322\001\333zk+\350!\007\213\230\346\bu\323\320b^\b\354^\220\224\031\230\001D\370\270\216mk\267\334)\277\375\t\300\013\311\037\316`\367A\304\350\245j08\031\245o\322q\020\247;\007\2422\212\210\016\301\253\203d.\305\2012\027b\373\357m\334eby\f^uS\311x\n}S\re.\302\337\221\007"
+	.ascii	"3\203\200\200}\212\\S\001\003\271zT+0h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375 m\225\002"
+	.string	"\302\304\020\035\240'\351\377\377\017|\254\252*\336O\r\212\265\027\200\243\n\306'\326\3160i\204\310\224\002\016j\306/\336*&X\2317\256\321yt\266\211\231\344&\255\026\f\007\t\305\210\254\002\207:`\365*\371YD\004\004"
+	.ascii	"3\t_\316\362\312\034k\003X"
+	.text
+	.section	.gnu.lto_.pureconst.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\271\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375 a-\002"
+	.string	"r\004\r\026\320\2455@\201\246"
+	.string	""
+	.string	"\226\002<SB\b\221\003\240$h\247\224\002Uf\005\032P\316\302GN\3026Pp\232\315\274w\216\207\314\312F\266\221\030\210+2\004\005"
+	.ascii	"s\306\212\031\351\316\b \304\r\264\001"
+	.text
+	.section	.gnu.lto_.lto.716d78621202ad5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compassConfig_Registry.38.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375 \206\005\004"
+	.string	"$\007O"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\274\274\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\345\005us"
+	.string	"\005\001\006'\001\020((qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/compass.c"
+	.string	"\004"
+	.ascii	"K\205\220r\025D5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_compassConfig.40.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375 7\215\001"
+	.string	"d\002*"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\003\005\001\006\177\031\001"
+	.string	"?\202\210\200 }{\276\001y\275\001w\274\001u\273\001"
+	.string	"\003"
+	.ascii	"/B\247\f=\200\""
+	.text
+	.section	.gnu.lto_compassDetect.43.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375`\031\002\r\023"
+	.string	"\246#\200I\320\362&\035\252\n\314\342\220\330 "
+	.string	"\371Q\233AN\037\242[!\327\f\321\016i\235>Oe\352\353\346\367\371\301LcC}\024\361\351l\317\0248\231\2258\310J\0030\215\344\215y\333\030\304\364\031@f\270q\202\310&{\247\024i"
+	.string	"f"
+	.string	"j"
+	.string	">\321\213d7\272\271\200][\321\323.\251\300\t\276W\2237\361^\277\227x\257()2\317N\016\361<\210\303\005%\252]\022\244!L\347\354^\355\350\234\371\264{\264')\307\006\356\204\317\353\252Vav\035\275\225P"
+	.ascii	"j\026\272\005E*D\274\374\334\251\351LJR\363\371\024a\331]O\f"
+	.ascii	"\265\236[\344\266E\333\021\354\231\0226\373F\177\375\355\247"
+	.ascii	"\277\335\027i\360C\245c\300\213]\236\252 K\243\3060a\373\366"
+	.ascii	"\231d\276\322K\257ZP.\373\345R\354\243i\370pA\036\246vI\004\257"
+	.ascii	"~\360\275\266r\256\257\370\225l\313\236\344\0347\360ajw\017\274"
+	.ascii	"\332\345k\271p\321y$\237<\013\331o1\217\354\002\315h\371^\013"
+	.ascii	"t-\3225\347\217\002\264\323\0328n\270\216\n\215H\035\r\251w\272"
+	.ascii	"\273I\351\351\216)\004\244\033:\363Gw\364D\265\203\351s\t\206"
+	.ascii	"_\343\331\343[\324|\273\253\342\343hlXC\273\373\022\257\376\215"
+	.ascii	"\367j\"\305\003gV\331#*O\262\224\"\267\023\210\347c\336\227n"
+	.ascii	"\026\234\t\304O\372\313\267\240 }L\321\246\020\233\244\275[*"
+	.ascii	"\344O\225\\\324\b\323\253\230H\023\2125\034]`\016B\361e\003#"
+	.ascii	"\276\030Hx\305\004\360\n\312\013&\\q\245\234\224P\ba\250_N\306"
+	.ascii	"\3615\023\003{\001G\0216\312\204#(3\341\025\003\276\210#xB\300"
+	.ascii	"\260\231P\004i`0\021\\\221{j\233yf\301\2419f\341:\344\026\267"
+	.ascii	"A%\027E\302\353\232\226\002\231\205\253\345\234\376\333k~XeU"
+	.ascii	"\023\b\233\214J\205(\315\300\323\343&\003' @\002\203\220\332"
+	.ascii	"\rR\233wy\225 \032\253\353Fv>\351\200g\245)\035B\033\327\320"
+	.ascii	"\t\030{F\006\036\232F\227\377H\354`\001j\302P\205F\272\270\253"
+	.ascii	"\006\377n\361\323R\034\013\230\021\225X^c@\023Q\216\023\362\332"
+	.ascii	"\366|\324\261\302Z\007\271n\200\037Z\207\316\026]\276q/\225\007"
+	.text
+	.section	.gnu.lto_compassInit.44.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375`]\004M\035"
+	.string	"v\264\271H\240\330Qc\300\327\263x\341\306\257\rd\224_\250\343\t$km\271\0033s\030J\261\246k\016S\264\316y\210\004\375\371HQ[>\256z\211\362^y\3401}\216\017\240\311X3\3073\314q\302]:kn\266\367\2262\245\237"
+	.string	"\235"
+	.string	"\246"
+	.ascii	"/i\344\254h\373\220\037\312\266\357F|\345\267\"y"
+	.string	"!xi\t\347\313\333?\277\351N\216\315\222P\0244\340\314\035R\321\303G\204\363\345,\207\355\303\023\371\275\b\n\032\020\275G\032v\240\303\343\2757\301K+8_\316\234\306|Y?\300|i\006\016~\006:\272dt!\r\026Q\307{\321\232\315a[\201n\226\244\255@~\320M\373\002J\350+\375\001\343e,\250\242\222\244}\232\352\022\020\\AB \"\204\351[\257E\301\241jaA\030\25727\367^W\242\340\213[\346\266w\266}l\262D\267K\226[\277\330\250P\265B\3736\305&:l\225\354\023o\330Yme\252\253Y\375\030\201\245\0324\204I\366\013\275Fc\300\\\257R\253\307\211\277}\277\352Z~\222o9\346\337\317\367'\037\311\263\354\r\256\330\357R]R\207\225\215\254'b\375\220\350\r~\210\204\016\217 \354\337\255z7B-.\2312y\r\2173\324V\326_\371\351\217\370n\3253\217"
+	.string	"\030\341\220\261\340\245;\234/\215\236\257\362\371P\247r\354\345\254\313f\237\312\217\272\224\357S?g\320\321\231\342\230\201\345^\324\302\031Z\236\360*\024d6Th\214[\314a\361n\035&\025\244\b\253\3771\237\344\276\321\372\267~J\r\361\n\252a\310k\205Y\307\001r\273h\261\366\304?\375\253w\336\013<\321\224_\235\006\254_\\\255\265\347b!\306\256p)\027\316{\207l\374\342\243`\310\220\223c\0330\025\251i\327\275Rl\2409\017\237gr8\024\017\001\214N\376\344C\210^/\252h\306\254\332:8\273\301\206\220\rrM\271\212X\266\353\001\233\347K\214%[\272\367\332\370J\336\325\343\363x\351\021\271z\242\234\371\322\200\361\b\254c|\247\343p\0058^\216\016g\346\004n\307\342v\267\237\235\335M\002\317-\027\363\355L\340v%\017n\307\372\001\203\333\016\356\201\315A\315"
+	.string	"\237\236\234\265N\r\217w#\221\323\351\324x;\035\317\007\307\253\371\364\334r5\235\035\257VS\300:\022\270]\315\204N\267\253\305P\340\255\022\220\351\033\240\025\262,eB\003^\375N?\215\\>\272`I\221\2127\215Q\334a\222U\327\336\260,\r\026\255\374\304\367l\310\246\306T%)-)\255\020f\255\013#.6J\225\247\224\264B"
+	.ascii	"\306&1\345\255\334d\265\026f\213\354\037\023fE\030\2412T\275"
+	.ascii	"\220M\304c\026\343\253T\026\005\363\001Y\250a,\350\024bH\002"
+	.ascii	"#\221\202$I\032\003p\002\2219\264\r\020`H\244I\2419\235\247\377"
+	.ascii	"\362*.\234\226\277\265b&M\260\"\261\035D\212\227\024\342\324"
+	.ascii	"\213\230n7e\030\335Ay@\241\032\324<w\034?\206\312[r\326\373\033"
+	.ascii	"\376\253\363\001\037X\201\364\272\r!\214-Ln{>\331%*\330\354\032"
+	.ascii	"\2061M\222\201\240\227}hz\025{yR@n\005\244/\331\346b\355E\272"
+	.ascii	"\2038 \271X#\016\344\327\200J\217\266\325\212i\241\373\377\330"
+	.ascii	"A\"LG\203\0313\0248\310\f\237\033\250\2443\016\f}\342>\372ov"
+	.ascii	"\013dJ9O\221\177\330\030h*w|\354\203 \264t\375zK\257\bT"
+	.text
+	.section	.gnu.lto_compassUpdate.45.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375`\245\017\005B"
+	.string	"\372i4\027@P\346\316\030\023\b\325>$@xR\303\n\350D\240\367\004\374\270\346t\254\235\363\357/\326\246r\245\"`$\021<q\002\2354\tl\352\371\016\371\373\277\372\375>\003\300\220\354\240M\244\224R\246\224Rb\001>\001f\001\005\352\274\257\214C@\357\232\364\017I?\273\271t\357u\353u\352\250\277\257\314\335\002\352cc\033\350i\355\370\256\r\211\263\213\303\307\306\326\316s\257\255\314\0266\266j\370\364\b[.[\334Y\270\265\260\261\365\333b\326c@6m\006\273\247g\306\316\373\276W\235r\006\266S\324\310\334\362\330r\274\276\3426\026\025I\307w-\317\305\027\333)\343\261\355\333V;sOi*nWY\301\304\367\225\243\342\345}\361\260\270"
+	.ascii	"\333\351S#\325N\3216R;ev\231\3514\236\363m\275>\246^\237\367"
+	.ascii	"}\263~\210Q\222\345o\024\257\031M\335NBJ\"\217\214\212\210\216"
+	.ascii	"C\255\222P\220\261HdW5E\337]\356\265K@\2241M\267\264Nz\322HH"
+	.ascii	"\372\214x\362H#\373\332kH\334\035\271\267#}\204\036\017\364p"
+	.ascii	"\243\265K\310[\221.\"\322DD\370\350\374\350\354!'\237\017o{Y"
+	.ascii	"\244\225\352\224\314\200\342BOxx\320\2166\356\200R2#\316\213"
+	.ascii	"ro:\232\210\036sla:\013%\344\r\256\327\265kKG\230#\274#\367\006"
+	.ascii	"\327*\372\0248C\007\372\224\307\346)z|\337\267uc\201\036\360"
+	.ascii	"675G\223\324\350o-meDM\323\255F\373\332\365\276/{\323\355\255"
+	.ascii	"\031@3\273\0243k`n\227\002\314X=\365\017\b\327\374O\241\334\324"
+	.ascii	"w-\275\260Q\364\353[\257\237\n\364\324\177}\263\365P\363C\236"
+	.ascii	"j\273\013\374?#\001)\310\024\332\fX\353$\323e,\\\300\200A\355"
+	.ascii	"\364\001\233x\374\377\233i\270\364C\273\036\243\334\022\343/"
+	.ascii	"5\370\027\364\204\362\377\276o\332\363\025\327\217\245\027rk"
+	.ascii	"i\264\211\334\335\221w\226\016\323\341H\360}\227\335\344\376"
+	.ascii	"k0a\034:x7;\250\317\306\037k\237\306\314\036\332\213\030\373"
+	.ascii	"\276\257\026\267_w\031\343\256\353\224\311Bx7;\345\016\241v\332"
+	.ascii	"/4Xe\351\207ldbg\354\341O\036\201\257\0272\343\245\371\3171w"
+	.ascii	"\277\037\204\371k\202WWc\351nPtf\320U\272\267\210\316Z\375l\266"
+	.ascii	"j.\315U\275\327L\325z\315S\253\263\024\353L\200u\216b\235\007"
+	.ascii	"\254\316\002Xg\250\325\371iuvb\235\003\254\316M\2533\023\353"
+	.ascii	"\274\264:\003`\235\225\214\316IFg$\3269\311:#W\347#\326\331\210"
+	.ascii	"u.b\235\211V\347#\353<\304:\267\254\263\320\352\034\304:\033"
+	.ascii	"\213\316\305\2423qufY\347\265\350\254\262\316)\321\031e\235\177"
+	.ascii	"uv\325\271\301\3320l\002\217\224\003r\344;\334G\017\036\336\f"
+	.ascii	"\250vjTX\364:r\300\021\375\320\027\035\237\350\206\215#\226\323"
+	.ascii	"xs\033z\244\237\366ex\f\207!\364\306o\337\003\261\331\251\275"
+	.ascii	"P\233r\312\351\315\250\240\237\242\373[\372a\001o!\001)\350L"
+	.ascii	"\260\326\351l\306G\016\376\3611\026\377C\236\253!q\245\024?H"
+	.ascii	"O\221\370\334p<\255\013\333\275S\325'\276\317a\302\275x\252"
+	.string	"!\376\034\033\211\254]\237\022Q\257\232\212*\245A\365\275\347l\327\367\036\325wa\265\001\032\006\002\344.1\241BO\023\217\231@\366\377(\235\374\2045\tv\037w\311\t\025\335\304\263>\373\250\036\246\341\036\t\t\234z\300\260\362\254\237\200\356\217L+\325#}G\311\344&i;al\035\227\315]\222t\326\251P;\215r\346i\237czUni\224\212\\\320\023p\353\271\345\364\234\025)\334&M\324N\207\350v\200a\306{\337W\355&\225\001\033\230\207v\223\252>\203\206\323\202\356\035w\035\273P\\)\336MW\212\332\251\372\311A\270\347\227@(O\277\263\364\033\327\n\353\006,)\330\206\035<\360n\362\023\213Oc\255O\277\363\272\2150\r\017\273LE_\353\331\231pj\020Z\215W\032\364\245\350\252t^\027\237T\322\237c\"\341\177\375\023\372UO}\033sh\"P\210\241fgd\033B\210\225\255\274"
+	.string	"\201\030\b\262\005\007\022\0300\"+\023\221\241\304\b\262\2633\023cF\0363\200\206&F\242\314l,\013\355\314\fm\004\031Z\326\b\021beYcghY\006\232\330\214\004\331YV\t3\263\263,#\336\333\375~\020\256"
+	.string	"\270f\371j\234\344\314n\021\327\210\332\247YABz}Jxt\325VV}V\337\317\244\327\367\323\352\275\356\244\376\251\f \310\307\344$\360R\217\276a\032\306u\324\023\370\2457lQ\006<\324G}\222\236\200\037\260E\331b\366\302:\214\026\001\337b\350\236\036\352\233\210gQ6\020\314\013\323\022\304r\342\351\033\fBA>\273C_\243\200r~wt\215\207t\346Y\306\360krDX4\341SB\245\253\256\252J\343\252\276\271\030M\370\346R\365\023\262b\340\360\"\247*T\246\230p\362A\024 M\323\007\210\242\344r:\2240\005N\177\322\364\\t\177K?\036G\246w\242\234\362&a\004\234\211\3223}\252\207i\230\364\213;\360\276\357\320\317-\275\322\267\222\2743"
+	.string	"~I\211\222\313\351I\302\0248\335\016\300s\271u~D\202\223\0210\246:\245w\032\374\343\353\256\341\227c\315\317q\267\322\007i\207\260\035\366\n5\351\317\362\320 \375\326'\375\003\262\331\251\371\321\020Z\241\"\311q'\322\017\321\371\271\005%_\310\\\020\344\033}\362(\201S\250a4G\03533\"\"\222\024\244 i\f\261\005\304\030\346\334\231\007\021\360\250D\216\241\231\241)T\206\003\247J\035\325\273\022D\2659\007\324\372\037U\036\235E\220|\3034\202\231\013\r\276\321\356\201\233\357\325\300,\366\262\247"
+	.string	"\036M\204\250Q5\241\324\351\272\013\373=\177\fT\347\254\310\206W\036\270\353\341#j\016\203\330_\305\3564\"\242\376\023\312M~\227\234\245\226C$\210B8\210\275\262%\020\036\001\327H\362`\357USqv\372u\306x\355\247\301\235\3157\b)\215\032\n9'\321T\276\241A\200\357\246{\277\037\227_\244oU\\]\331\353\251\373\321*\340\374\234C\221\373\217 \217G\321+\2121oz\255\306X\264\020\245\326\352UM]\365No\376Zf\256\031\210HO\311\277\227\004\002\255\025\251\004IOn\362\357\275\340\351F\354{\364\253;\301\205\351<H\322\221\214\307Q\376\340\316\373\005\266y\2151W\265\021T\b\035\t[\310{\376 "
+	.string	"y\344\260\b\333\373\320\261\376m\362)\354\320\3675\006\354\0368R\240\2037"
+	.string	"\237\223\226O\270\230Z\025>\230&c\005M\"\2719X\375"
+	.string	"\321#7\205\242\307AL{\250X\t\253\310\r?\376h\351j\267\267n\360\b]8m\373\030\n`\n\362`n\244\203r\200{\302\023y,X\213\027\025\027b\213v}\256m\312Q"
+	.string	"\220t\020@\237\353\020R\317\221 \004\271\336\020ij\241\341\202f>\243\013 \216\274\026\223.\240f\202W\244oN\375n^\333\356{3\352\377\356}6J(\rr\321\246+\236\030\035\fP\021\372\311\376\006\234\032/O<\246\341\356H!O\271\265\346\366\326\265\351\024\373XO\276U\240\310\3622"
+	.ascii	"\nSe\331V\366x4\016\310\241\341\363\177,\345\207XW\006sK*kt\236"
+	.ascii	"\350"
+	.string	"\023\005t:\021\320\020\334\255\023\304D\333F\025M\203W\304\030$\001\371\367=\223*\330@\\K\214\3544\327\204`U\350\255\365\346\364\330y\021\250\250\253\037\300\324\036\365U4\376\335#\242\006G(Q\031\367\0134\001@Y\243+\252\242\230A'\376!\033=\r\325\266s\244\377QHu\307\225V&b\314\232\bb`\272\022AT\215"
+	.ascii	"\242\347\304\305j\251tZ!_\211\351h\n\025"
+	.text
+	.section	.gnu.lto_.symbol_nodes.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375`@"
+	.string	"\025\006"
+	.string	"\364\b<\001"
+	.string	""
+	.string	""
+	.string	"\002+\177\035\252\333\3426\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\002,\177\036\005#\023\201\204\005\"\037$ \002-\177!\200\200\200\200\001\005)\025\200\003\0052\" "
+	.string	""
+	.string	""
+	.string	"\0053#4$5%*&('\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\005&(gistry"
+	.string	""
+	.string	"\0010\177)\377\037"
+	.string	""
+	.string	"\200\200\200\0016\177*1\177+\003\001\016\204\001\003\005\020\244\016\003\005\017\200\200\200 \001\204\177\004\005\325\001"
+	.string	"\024"
+	.ascii	"7CQ\177\364\304\272\006\250\207\017\220\343/\365\203`q\371\223"
+	.ascii	"s\017\220\033\310\215%\267\2319\211Z\271\t\375\200\201Yrhei\220"
+	.ascii	"#\r\346\030"
+	.text
+	.section	.gnu.lto_.refs.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375 \233\245\003"
+	.ascii	"\362\b\032\"\220+\303\0013\266\202O\310\337\377\277\272\273\273"
+	.ascii	"\273\323-?\261#\252y\301'\215\354\275\367\336{K\231\002\003\232"
+	.ascii	"\372\3647\232L\343c\036\377\362~\213\343W\334O\231\264_R~\244"
+	.ascii	"?\244\334\321o\2243\372\013\347\025\214'\036G8~\350\033\032'"
+	.ascii	"\260\037\264\013\320?\345\316\372\265\272B\253\302\001\304Yz"
+	.ascii	"\205xK\246\377\021\003\024\004\001'\344\241J\024"
+	.text
+	.section	.gnu.lto_.decls.716d78621202ad5,"e",@progbits
+	.string	"(\265/\375`\221\033e\206"
+	.string	"\212\342\2441R0\320:J\007\224\313\343\230=\035\327\232|mM\332+k\037B6N\323d-/\327\032\005\307\200-\320$\365\352o\323\265\253\325:\224TWyK\321\276\363|\322%\246\016J\243\240A \312\335yT\215\007\204\211$K2\366\350\247\324.\371dK\231\002\240\002\021\003\007\0036\250o\330\2731\221\235\327\371\301\322C\004L\237t\212~\324\372\270\271\321\347\373\312&ya\035\332\236\304\3418\236\303p8e9\374vf\303m\220W\270\213\210\251\244\006^\240\360\030\313a7\f\307nfJjQ\342\356M\345\360\031^\303n[\351\325J!,k\354\250\350\350\350\350\\2Wu\001\3407|\346N\036+3\366\034\306\366e\"\224\304\026V\203F\307\2202;HIs4\026\314\271\362\272\2353\232\237$J\272\256\232p\0160X\275\351\323\347Y\210=\247\354f\006\215\3232\233A\346l\346G\361"
+	.string	"\263\005\335+b\b\216\230c\234>\231\255\271\f\267\235\331x\355(\036x\020\362\216\335\2332\333y\357\221\371"
+	.ascii	"!\346\003t`\216\034\255\240\347\371\207\275\235\377\374\310I"
+	.ascii	"c\346\253\317\237\307\234\325\274\222p\221\322'\343\300_8\r\301"
+	.ascii	"`\316aX\314u\307\364\246\367\336!\236\3635\265\354\323\003\023"
+	.ascii	"\241\3158l\f\367r\b\224\347\3468\004z^\332\020\272\245WU\224"
+	.ascii	">\031\215\315\230\013\273my\270H.jq\367\3364N\031\215\261\034"
+	.ascii	"\205h\255-_i\316s\013\247\314\205o(J\357}\212?\211\013\237\261"
+	.ascii	"\226\232&\271W\310\017\0209\334\251J\"woZtt6\301\032Ss\236G\301"
+	.ascii	"\302q\226\3039\215\224\3011\245\317\227`\037\202}\007\366\024"
+	.ascii	"\330K`=0\bT\n\217\261\225\232\274b^\263{\323\017:+d\242\034\373"
+	.ascii	"\344)L\306)[\341\262\237e\314\333\2747\345\325#\0166\264>I0\021"
+	.ascii	"z2\b4\310\350\377\220\016\367\201\267=\033\241Cssssl\204>e\""
+	.ascii	"\3242\b'f\"~&\3613\226\237\025P\376<\345\347+6\234\317\305\374"
+	.ascii	"o\373y\350r\376\347P\302\305\377\242\377fV\364\224f\234%V~\256"
+	.ascii	"\\\3663\013\256\"\342o\257\377p$(\363\177\367w\220\237\223~6"
+	.ascii	"\361s\003?\243\370\371\370\277\354\257\273\237\211\374\f\366"
+	.ascii	"\263\221\237\277~\246\341g$\351\317\313\237\207\374,\204\312"
+	.ascii	"\177\336_{?\223\375\374\344g&?\207\375<\365\363\323\317,\374"
+	.ascii	"\f\374\231\351g\025~N\341g\022~v\361s\213\237C\370\237\366\377"
+	.ascii	"\203\237+\370\031\203\237w\377"
+	.string	"\337\374\247\363\263\322\317\374\263\005\377\373\374<\301\317\022\374\034\301\317+~\206\340\277\b?\253\370\371\201\237\035\3709\305\317??\333\237\321\237u?\237\377=\370_\347\277\225\377\f\374_\373\217\316\315\315\315\375\355\364\237z~\"\002\002F1u\352X%hG\036$\356un\312d\223\313H\001\327\022\311\225#\331\344\272F$\022\343\007\345\3452&\233\367~\270H\244Q\211y?$\233wye\350\260\344\233r\031/\222y?\\\344=\222H\"\271\226\311\346q\371!\331\344Z\336&\327\365p\221G\245\025\362*?\334&\227\234\333d.=$\233\314e\262\311\265\203\331\222n\312,\303\324\351:\302\313$\362\326\300\352qTzpK\246\314\373v/\233Q]%\002\367\366`*\337\21698m\312\255\306\324\rG&\247XS]\314\213tK.a\336\273d\252\351b9`L\335n\021v3\n\351q\257\250\356%"
+	.string	"\353^#_\267{\257\361\336\273S\366H\357\335\341!)\206\205u\357V\021\326\355a\354Buo\233\265I[&\233]\314\244.W\232b\267*5\262\330}\343R\332\246\261\312\275\242c\305\2266\346\364y\205\007\006\354N\222>\257\323ayF\214\336\315\264\233\255\f\201\203)\254\270\253T.p]\226\r\2223z\247\347\264\323.;\031N\271\306\213\334Un-"
+	.string	"d\303\227,5}V\001\272:\022A\272\261?\327\0305\331\320\217\032:>\314\332z,(\213Y\233.^lK\211\362\003\200+T~\350i(\035d\n\032\0376O\214x;\250\231z\342\244\225C\037jrMB\354\234t\0012\204\t\273\005\335qrF\313\222\016\303\301\270%EX\323\260&\326\\]M\304L\323\b\353\032\035\344\316[R\207\365W\203\261\333\226\004Q\332\342\356M\223t\r-\326HZ\t\247\035\326G\302\332\b\303-M`\263\261\347\310\313\233\2176A\347\3172\373\263\006\373\363\253\b\257\017\224>z\230\366\247\r\333B\332\213\323\021=\244\032\313\206N\034l^H\372\374I\303\236G\240<\307#\320\327>\366fL\2042C\240H\322\344\001\363f\265\272\007\273}\235}\270"
+	.string	"i\037\234\366\217^\366\217\316j\345q\213\330\021\020\020!K+\364\344Q\345\306\244i\351\363\225\213=\213\261a&V\206\203\325\204t\3672\317\304t\364\216\316\301io\365\215wo\365\f\254&tL\257\222\005\025\036iGEG\272;q;\310\261\347+\r\366Ui_i\330W\031\366\335\307\276\337Z\371\367Uc\261\032\357\264\276T\361\202\306\276\313\330\023L\204\242i\357\031#\206R\034XB\254:i\207\034\315\330\3503\025\032\273\222\006M\225\034\336\030/,5\252\356B[\263\3222zJ\250\016\332\332\fw\376\244\236b<Gc73\026k\262\245\221}\344\264\247\372\236mh\343\317\236\342\035xN\b\231^#\213\033l\354\221+:B\223VL\302\320\223o?\261\347\271\237\345\370\016\367i\346"
+	.ascii	"Ai{\250p"
+	.string	"\364\311zx\017\247\007\303|~\220\351mr\0211\306\"b\326\205\335\301\240\034&\351\234\007\004\252\334J\257YM\013C\265\247HG8\255`\265\207\230\nVg\250[\354\366E\301X\2338\036\253`\325G\365\222\213\343\005\251:\003\022t*\017'b*\251\001\031\234\352U\177T!@[\344\f\3011\244\022\341\264z\375(\004O\017\03392TH\355J\233\301\243\252\317\312\305\3155\032B\23409\255A\252j\340\203\244\317\n\344pV\306\0314\016\346\274\321E\n\333\022{\213\304\336\006\331a\323\304\371h\343aos\330z\243\342\340\264D\315\321F\370\234Y\351\363\266\206=\227@\353\334\034\227@o\255\354\255\321\376U\253.uM2u\332\352\262\301\316\260]M\361\261\365\252\326\030\212\2226D\013\326\007`f\264\364yV\032\275\026&\2065C\350\r\311Y\225>_\255\264\314\325\321\321gMZ\252]\234\022"
+	.ascii	"\370\340\002\204G\237\257\311\277\343j\325\013s|\336\230\be\271"
+	.ascii	"\244W*\240\2660qT\324,O\210\021C\341\216\363z\214S\2474@/\262"
+	.ascii	"MO\334U\366X@W6$\317\214\264HW\304\316\224\261\317\356So5\342"
+	.ascii	"pu\246G\232}\317}\351p\204I\237\335{\336|\376\237\335\230\022"
+	.ascii	"y\246\305\276\363\264\236\377\247\362)\203\203U\237\337Y\261"
+	.ascii	"\357\035\376\377\310\340&\b\224>[\316R\355\226\224\370iS\006"
+	.ascii	"g\244\317\267\334\337s\232N\343Q\241\257xl\305\351\263\355\364"
+	.ascii	"\2357\236\256s\033\217\003\314{\217\215gh\317\275\307!\346\003"
+	.ascii	"\230\0178\243t\205eA\317\357\302\354\343\230\b\025b\020h\307"
+	.ascii	"%\275\345t\230\331\332Z\237\274\335\322\362\232\030\265\033n"
+	.ascii	"8\270\006+\272;+0T\210\314\350\315\246M\007"
+	.string	"!q\364p\257\227\232X\036{\224\215\025Rb\364Vc\246\327t\020{\323Z\330\200\206\222\261G\317\254\320\227Q\347\300}\306L\243i*\3475\273G-\007\306\270\245\013\034m\332\243S\354\271\251\240\226\215\321\333-m\267\006\243`\213i\234C\"\tsN\036\271{\325\026\320q\335\301\003E\313\nQ\251]\255\333\354-\032\223\006Q\231\261\311b{\267\035\316\031\227G\256\252\317.\323T"
+	.string	"x\223\244\231cMJ\027\233\215\265&\343%\013Y\033f\320\027\262K6\246\227!vZnb\252\372<\212\264<\032F\3570a\032\013\033\225\030D\331!\256\352K\006X\034\033\364\306\350\375\345\234\366\027\256C\301Vz\215\350\226\253+\343\302\202{\263CY^\356\205\321\330+B\272\306\313\223!\256(f\232\224\261C5\030\265Y\237\275\263t\227,\235f\215\367\032\323\233\025\200\222\273\265e\004d5\006\316\227F{\247\361\330\264\354\330\351\263\2654\027\344\021:D\270\274\267P\031\323\204\f\235\237*\"\\3\364\3317\360\233\02669<}\336NO\321]/,[}^\307\305\276\177\364\036\225\367^-]z\225SAg\035\263\321\317\343\312\b\374?o\375_"
+	.string	"\006\351\roB*\n\177OLC\037\324\n\304 \023K/\006\210\361\"X\204\372\200IX\301\017\206\217\b\342MH\004\020\245,\200\032\306"
+	.string	"\362\212oB\212\222\202\032\002{\303_\361\367\344\033\372\242L$\360#\002\t_\264\216\330\013*\366\204\300(\235\020\030U_\b\022O\"\3617db\362\355\206\305\250z^\214a\221\030\004\376Z\364\004`\372\355\230~D\251s\351G\334\335W\3641\r{\300($\241\241\257i\351,\372\234\212?\342\257\0050j\204\013\276\023H.\370\204\222\220\204A\017\242\236~.<\234(\220\234|\027\024\3217!-\365~O\301\242Pjhb\351\205\001D\240\317\t\203_\321W$\002\360+\372\230\242Fx\372\025\2111D\b"
+	.string	"\306O\t\250\270\364+\376\224x_\n\016\177\302\037\320\336\001\025\r\250X\341\302\356+X\234`q\002\375\n\026II,T$\331\253H\252\305\026|-.P\252\340KE\240\357\251\332_O\004\240\357\t\210\330\003\006_\b\241.\030b\032\372)\366V\024\205A\251\335o\350k\201i\350k\n*\366\200>\027P\301\035\320\347\242\030%5\034\376\212\302`P\261\330{\361c\n\361&\244\026|1*\261"
+	.string	"''\250\341\331\264T\fF\351\210?)'\037\fT\252G|\n\016]\020\227\202O>a\f\245b\0230\350\364\202\250\005\337\260B\r\177'"
+	.ascii	"}O\2737\021{@\337\223\256\330C\221\342\002\245\n\200\276'T\b"
+	.ascii	"\025,\372\204A\247\245\237\322R\260\370\023\002}O \212o\032\361"
+	.ascii	"\353\371zBB`\320\251\002b\017\306O\t\350{\262\305\240p\203bP"
+	.ascii	"\030<\207\305\020\226\204R\0300\371~->8AAY\320\323\025{*\222"
+	.ascii	"\212\302\340\216\311\367\033\236oB\"\016\1770\202C&\250\250\337"
+	.ascii	"\320D\021\njh\002\210\330\013F\211\300\004T\354\201\260\301)"
+	.ascii	"\f\206 $.\241\301(b-\366~KA\030?%\242\324\n@D\251\025\352#@\341"
+	.ascii	"c\372Ep\342\001$\020\217 \202\013H\214\360A\006v\t\211H\364E"
+	.ascii	"=A-\231 \016\241\210\302\037\321\2040\350{2\2614$\232@\022qV"
+	.ascii	"\237\234g:\276\272\314\232\212=\203\343F\003\013\317\3310\343"
+	.ascii	"\230\243^\251di7\212\250\351\263H:\026\224\225e\204\331\254L"
+	.ascii	"\262\224(yT+"
+	.string	"]\326k\315\252'i*\224\347L\026\236Z\245\261\360v\240\341\201\247\246\025\314\217\255-}\362\316\242D\251dE\314\272&\007$mOP)Zf(\251S^\311pX\353\032\353\263J\251cF\230@\232\214q\237\260\032av\300\272\356\274A\313byU\2348\251O\270\354f\025A\221c\344\313)e\r\026\332\023\235\016K\220d\351\363??,\017\215Q\222'\251L\212\230\3069'\230,\301p\310\335\273e4\024\246\255\207VeR\227\004\r\331Q\005\327K\224T\241\321\244+\345\301\031\317\270j\r\214\345\207+G\033\031;\226\367\243\312x\315\2522jXMn]-\025Y\3125^\344\206\224mpU\372D\262\273:Bc\317\233}\n\035\225G\0236I6\352r\314M\ne\325z\023\367U\215T\032j\221\032\202\021\250\"\251HG\362\230B\b)335\2224\351\342\t\020\206\002\202\234\t\242\017\022"
+	.string	"EE\2161\310\020\321$I\2465\b\322\245\232\213\212\254\350~\213 s\034\371\314\\\370\344\031H\2031\004z\"9\255\240\3678m\312C\276r\245\223y\272i\327D\221\257\325\317r\002\306\302\223\245\026\334i\267\245\276\241\235\326\274\031\253X\342Y\n0\026w[c\214Hx\303\017\266\024\251mu\361\342rv\315,W\370\265\204\024\013G\375\307\036\327^\352u\246ls\221\271\020\254{gj\030\0079\340\255\340$@\211\003\355}r\007=\354>\323+\215:\264D\263x\375\313\376!\232O7C\347t\202\252\271\013X\377*L\313\023Y\212f:4\r\255)\325>\035\251'Fd\363\350\233(\237\201b\361B\212\240|\221U\032\311p\350\203\210\376\005\\\353P\207g\204\026\001\371P\324\221\037h)5<\322h"
+	.string	"\213\2305\236R\353\253w\352I\231\237"
+	.string	"\346\027V\276\346-\235*\236\367QJ\233\013\250\237\r\216\235\2126\235aY\231'\005Kw\342+\013\215\026X\300\300&\372\352\234fM\360\02688\367\221Gv\013\261\031\305L\204.\263\363\330\034\220_fJW\023H\255\300\017E\237;\252\3402\242n\363\220\340'c-\035pp\212\246\217'G%W\002\372"
+	.ascii	"\f!\364\225\337\214uE\252\313i*\331\354\261\346\223Yq\204\204"
+	.ascii	"\035\250\027\360\213\342\201\324\263\024\231\230\b \246\253r"
+	.ascii	"\023{t\037\216\330\274j\365"
+	.string	"\230\213\223/\240rPU+\357j\215\330&\017\267YB\325h\266\215t\316\037$1\030\266\247x\366\304n\376d\334\037\bg\022\177/J\201\242\311\301\3149\304\227\245\222\211\311u\337s\272\"\334\204i\t.\362\001\322\257c,\314O\230&\215\344~\004\220\017\356\244\251>\3230n\2228\335p/\304\277\023\022(\241\362\2629-I\361\244>$%,\032\205)n`\321o\306\231]{\260\326\217\272\022\016\013 \224\312R\223\003\201\370\005<\031eY\340\301\t(\217]\036\223\267\232\375\370\004\340I^&\234\0064\361\303Q\245\252\301F\352R\250\353\324\363V_\314(\351\225\312y\267 \222\310\314\025@\330\366^n\002\322\205\266\222\321\006\332\265\203\t\030\371M\3310\335\256\202N!a\212;\240>v\262p\311\n+\340P\364sFK\242\204b^\333\231Y\224\354\311\211\345\264\205\222\314A\361\035u\306\230vT"
+	.ascii	"\034\212\334\336O\006}\331\305\376\374\230\2340\032\037\362\343"
+	.ascii	"\3459\300\363\033\220H\367\314\213\032\363\301{n\033\360\260"
+	.ascii	"\265\322\274\366\367I]*\234\274W\207u\247\216Y\312\372\023\001"
+	.ascii	"\245b\231/,t\214|\031\227\rB$\251g\0317!\032\005\310;\363\214"
+	.ascii	" \273z\343y\323\"7\227;\274#b\270 $\317\006\201\037::I\222\220"
+	.ascii	"#\035\256\330E\"\007\20113\001\002\207\n\362\361$\305,\036s\365"
+	.ascii	"\316X\336\226\223\364\376,:@"
+	.string	"\373\335\271\233\020\3337\3070\265\343\375&&T\237\260\025n8\252\2268\332\211O\006\235\216\\\333e2z\226g\322z\253\225=?\360N\335\334\005\277\221\341\276h\030\276W'\310!\376\313\263S\346\317\006dC\372\312k1[\355\303\261 *'\341x\257\3323\304\026|W"
+	.ascii	"l6\223\024\006\205\231\007\356\034=\207\314\256\240\215\"\256"
+	.ascii	"%\031\350\t\266_\265\301'u\306\001\204\231\r\nB\216R\225@\006"
+	.ascii	"f[\343\016#\220\177\016\216\037/,\357E\\\214.\200$<&\305\213"
+	.ascii	"\363\002\352\362\035\275\224\245\300\230\270\002B\257pGp*\342"
+	.ascii	"\207\020\002\177\r\254\364wo<\210\276\r\314\362PTZ\033\332UP"
+	.ascii	"\373\320\370\204\341u\020\033%\347\205\326\246w\244\351n\036"
+	.ascii	"\232\210\203'\273f\231\324n\035o;\r\342b \\\256\177\006b^b\247"
+	.ascii	"\005YF\276\013k\315\337\322\007F\036\353\306L}\216\365\002p\226"
+	.ascii	"\2713\036q\3368\316,hx\260B>\321>\351\343\257\366\351\362O\343"
+	.ascii	"\305\313\360\356@N\343\305`\212\177\254\374\363\3563j\003\307"
+	.ascii	"r\212\034\374\233}\312\305\252\243\343i\005"
+	.text
+	.section	.gnu.lto_.symtab.716d78621202ad5,"e",@progbits
+	.string	"compassDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"magDev"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"pgResetTemplate_compassConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"compassConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.716d78621202ad5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9137 @@
+	.file	"current.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/filter.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/drivers/adc.h"
+	.file 8 "./src/main/sensors/current_ids.h"
+	.file 9 "./src/main/sensors/current.h"
+	.file 10 "./src/main/sensors/current.c"
+	.file 11 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	current.c.87e637a2
+	.weak	current.c.87e637a2
+current.c.87e637a2:
+	.long	0x788
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1244
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1116
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1117
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1118
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1119
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1120
+	.uleb128 0x2
+	.long	.LASF1121
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1122
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1123
+	.uleb128 0x2
+	.long	.LASF1124
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1125
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1126
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1127
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1128
+	.uleb128 0x2
+	.long	.LASF1129
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1130
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF1131
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xb
+	.long	0xb7
+	.uleb128 0x2
+	.long	.LASF1132
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xb
+	.long	0xc8
+	.uleb128 0x2
+	.long	.LASF1133
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x2
+	.long	.LASF1134
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1135
+	.uleb128 0x9
+	.long	.LASF1150
+	.byte	0x1c
+	.byte	0x5
+	.byte	0x24
+	.long	0x159
+	.uleb128 0x7
+	.string	"b0"
+	.byte	0x5
+	.byte	0x25
+	.byte	0xb
+	.long	0xf1
+	.byte	0
+	.uleb128 0x7
+	.string	"b1"
+	.byte	0x5
+	.byte	0x25
+	.byte	0xf
+	.long	0xf1
+	.byte	0x4
+	.uleb128 0x7
+	.string	"b2"
+	.byte	0x5
+	.byte	0x25
+	.byte	0x13
+	.long	0xf1
+	.byte	0x8
+	.uleb128 0x7
+	.string	"a1"
+	.byte	0x5
+	.byte	0x25
+	.byte	0x17
+	.long	0xf1
+	.byte	0xc
+	.uleb128 0x7
+	.string	"a2"
+	.byte	0x5
+	.byte	0x25
+	.byte	0x1b
+	.long	0xf1
+	.byte	0x10
+	.uleb128 0x7
+	.string	"d1"
+	.byte	0x5
+	.byte	0x26
+	.byte	0xb
+	.long	0xf1
+	.byte	0x14
+	.uleb128 0x7
+	.string	"d2"
+	.byte	0x5
+	.byte	0x26
+	.byte	0xf
+	.long	0xf1
+	.byte	0x18
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1136
+	.byte	0x5
+	.byte	0x27
+	.byte	0x3
+	.long	0xf8
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x7
+	.byte	0x16
+	.long	0x18f
+	.uleb128 0x1
+	.long	.LASF1137
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1138
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1139
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1140
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1141
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1142
+	.uleb128 0x2
+	.long	.LASF1143
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0xc8
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.long	0x1d0
+	.uleb128 0xe
+	.long	.LASF1144
+	.value	0xfff
+	.uleb128 0xe
+	.long	.LASF1145
+	.value	0xf000
+	.uleb128 0xe
+	.long	.LASF1146
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1147
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1148
+	.value	0x8000
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1149
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xf
+	.long	0x1dc
+	.uleb128 0x1c
+	.long	0x1ec
+	.uleb128 0x5
+	.long	0x96
+	.uleb128 0x5
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x6
+	.byte	0x35
+	.byte	0x5
+	.long	0x20b
+	.uleb128 0x13
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x13
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x20b
+	.byte	0
+	.uleb128 0xa
+	.long	0x1d0
+	.uleb128 0x9
+	.long	.LASF1151
+	.byte	0x20
+	.byte	0x6
+	.byte	0x30
+	.long	0x25e
+	.uleb128 0x7
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x31
+	.byte	0xb
+	.long	0x196
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1152
+	.byte	0x6
+	.byte	0x32
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1153
+	.byte	0x6
+	.byte	0x33
+	.byte	0xe
+	.long	0x25e
+	.byte	0x8
+	.uleb128 0x7
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x34
+	.byte	0xf
+	.long	0x263
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1154
+	.byte	0x6
+	.byte	0x38
+	.byte	0x7
+	.long	0x1ec
+	.byte	0x18
+	.byte	0
+	.uleb128 0xa
+	.long	0xb7
+	.uleb128 0xa
+	.long	0x25e
+	.uleb128 0x2
+	.long	.LASF1155
+	.byte	0x6
+	.byte	0x39
+	.byte	0x3
+	.long	0x210
+	.uleb128 0xb
+	.long	0x268
+	.uleb128 0x14
+	.long	0xc3
+	.long	0x284
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0xb
+	.long	0x279
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x8
+	.byte	0x18
+	.long	0x349
+	.uleb128 0x1
+	.long	.LASF1156
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1157
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1158
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1159
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1160
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1161
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1162
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1163
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1164
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1165
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1166
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1167
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1168
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF1169
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF1170
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF1171
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF1172
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF1173
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF1174
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF1175
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1176
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF1177
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF1178
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF1179
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF1180
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF1181
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF1182
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF1183
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF1184
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1185
+	.byte	0x51
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1186
+	.byte	0x8
+	.byte	0x45
+	.byte	0x3
+	.long	0x289
+	.uleb128 0x9
+	.long	.LASF1187
+	.byte	0xc
+	.byte	0x9
+	.byte	0x1e
+	.long	0x389
+	.uleb128 0x3
+	.long	.LASF1188
+	.byte	0x9
+	.byte	0x1f
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1189
+	.byte	0x9
+	.byte	0x20
+	.byte	0xd
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1190
+	.byte	0x9
+	.byte	0x21
+	.byte	0xd
+	.long	0xab
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1191
+	.byte	0x9
+	.byte	0x22
+	.byte	0x3
+	.long	0x355
+	.uleb128 0x9
+	.long	.LASF1192
+	.byte	0x8
+	.byte	0x9
+	.byte	0x26
+	.long	0x3bc
+	.uleb128 0x3
+	.long	.LASF1190
+	.byte	0x9
+	.byte	0x27
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1193
+	.byte	0x9
+	.byte	0x28
+	.byte	0xb
+	.long	0xf1
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x9
+	.byte	0x29
+	.byte	0x3
+	.long	0x395
+	.uleb128 0x9
+	.long	.LASF1195
+	.byte	0x10
+	.byte	0x9
+	.byte	0x3a
+	.long	0x3fc
+	.uleb128 0x3
+	.long	.LASF1196
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x21
+	.long	0x3bc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1188
+	.byte	0x9
+	.byte	0x3c
+	.byte	0xd
+	.long	0xab
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1189
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xd
+	.long	0xab
+	.byte	0xc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1197
+	.byte	0x9
+	.byte	0x3e
+	.byte	0x3
+	.long	0x3c8
+	.uleb128 0x9
+	.long	.LASF1198
+	.byte	0x4
+	.byte	0x9
+	.byte	0x40
+	.long	0x42f
+	.uleb128 0x3
+	.long	.LASF1199
+	.byte	0x9
+	.byte	0x41
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1200
+	.byte	0x9
+	.byte	0x42
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1201
+	.byte	0x9
+	.byte	0x43
+	.byte	0x3
+	.long	0x408
+	.uleb128 0xb
+	.long	0x42f
+	.uleb128 0xc
+	.long	.LASF1206
+	.byte	0x9
+	.byte	0x45
+	.byte	0x21
+	.long	0x42f
+	.uleb128 0x9
+	.long	.LASF1202
+	.byte	0xc
+	.byte	0x9
+	.byte	0x4b
+	.long	0x473
+	.uleb128 0x3
+	.long	.LASF1196
+	.byte	0x9
+	.byte	0x4c
+	.byte	0x21
+	.long	0x3bc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1188
+	.byte	0x9
+	.byte	0x4d
+	.byte	0xd
+	.long	0xab
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1203
+	.byte	0x9
+	.byte	0x4e
+	.byte	0x3
+	.long	0x44c
+	.uleb128 0x9
+	.long	.LASF1204
+	.byte	0x4
+	.byte	0x9
+	.byte	0x50
+	.long	0x4a6
+	.uleb128 0x3
+	.long	.LASF1199
+	.byte	0x9
+	.byte	0x51
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1200
+	.byte	0x9
+	.byte	0x52
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1205
+	.byte	0x9
+	.byte	0x53
+	.byte	0x3
+	.long	0x47f
+	.uleb128 0xb
+	.long	0x4a6
+	.uleb128 0xc
+	.long	.LASF1207
+	.byte	0x9
+	.byte	0x55
+	.byte	0x25
+	.long	0x4a6
+	.uleb128 0xc
+	.long	.LASF1208
+	.byte	0x9
+	.byte	0x72
+	.byte	0x16
+	.long	0xc3
+	.uleb128 0xc
+	.long	.LASF1209
+	.byte	0x9
+	.byte	0x73
+	.byte	0x16
+	.long	0x284
+	.uleb128 0x14
+	.long	0xc3
+	.long	0x4eb
+	.uleb128 0x1f
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xb
+	.long	0x4db
+	.uleb128 0x20
+	.long	0x4cf
+	.byte	0xa
+	.byte	0x27
+	.byte	0xf
+	.long	0x4eb
+	.uleb128 0x10
+	.long	0x4c3
+	.byte	0x3b
+	.byte	0xf
+	.uleb128 0xd
+	.long	.LASF1230
+	.byte	0x4f
+	.byte	0x17
+	.long	0x159
+	.uleb128 0xc
+	.long	.LASF1210
+	.byte	0xa
+	.byte	0x59
+	.byte	0x27
+	.long	0x43b
+	.uleb128 0x10
+	.long	0x440
+	.byte	0x59
+	.byte	0x68
+	.uleb128 0xc
+	.long	.LASF1211
+	.byte	0xa
+	.byte	0x59
+	.byte	0xa1
+	.long	0x274
+	.uleb128 0x15
+	.long	0x521
+	.byte	0xd5
+	.uleb128 0x21
+	.long	0x50e
+	.byte	0x5b
+	.byte	0x20
+	.uleb128 0x10
+	.long	0x4b7
+	.byte	0x60
+	.byte	0x1e
+	.uleb128 0xc
+	.long	.LASF1212
+	.byte	0xa
+	.byte	0x60
+	.byte	0x5b
+	.long	0x274
+	.uleb128 0x15
+	.long	0x541
+	.byte	0x93
+	.uleb128 0x16
+	.long	.LASF1213
+	.byte	0x77
+	.byte	0x18
+	.long	0x3fc
+	.uleb128 0x16
+	.long	.LASF1214
+	.byte	0x93
+	.byte	0x1d
+	.long	0x473
+	.uleb128 0x11
+	.long	.LASF1215
+	.byte	0x5
+	.byte	0x5b
+	.byte	0x7
+	.long	0xf1
+	.long	0x584
+	.uleb128 0x5
+	.long	0x584
+	.uleb128 0x5
+	.long	0xf1
+	.byte	0
+	.uleb128 0xa
+	.long	0x159
+	.uleb128 0x11
+	.long	.LASF1216
+	.byte	0x7
+	.byte	0x33
+	.byte	0xa
+	.long	0xc8
+	.long	0x59f
+	.uleb128 0x5
+	.long	0xb7
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1245
+	.byte	0x5
+	.byte	0x57
+	.byte	0x6
+	.long	0x5bb
+	.uleb128 0x5
+	.long	0x584
+	.uleb128 0x5
+	.long	0xf1
+	.uleb128 0x5
+	.long	0xd9
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1217
+	.byte	0xb
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0x5db
+	.uleb128 0x5
+	.long	0x96
+	.uleb128 0x5
+	.long	0x7c
+	.uleb128 0x5
+	.long	0xe5
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1219
+	.byte	0xee
+	.long	0x5fb
+	.uleb128 0x17
+	.string	"id"
+	.byte	0xee
+	.byte	0x28
+	.long	0x349
+	.uleb128 0x4
+	.long	.LASF1218
+	.byte	0xee
+	.byte	0x3c
+	.long	0x5fb
+	.byte	0
+	.uleb128 0xa
+	.long	0x389
+	.uleb128 0x8
+	.long	.LASF1220
+	.byte	0xd8
+	.long	0x621
+	.uleb128 0x4
+	.long	.LASF1221
+	.byte	0xd8
+	.byte	0x27
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF1218
+	.byte	0xd8
+	.byte	0x44
+	.long	0x5fb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1222
+	.byte	0xcd
+	.long	0x637
+	.uleb128 0x4
+	.long	.LASF1218
+	.byte	0xcd
+	.byte	0x32
+	.long	0x5fb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1223
+	.byte	0xbe
+	.long	0x64d
+	.uleb128 0x4
+	.long	.LASF1224
+	.byte	0xbe
+	.byte	0x25
+	.long	0xab
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1232
+	.byte	0xb7
+	.uleb128 0x8
+	.long	.LASF1225
+	.byte	0xa8
+	.long	0x669
+	.uleb128 0x4
+	.long	.LASF1218
+	.byte	0xa8
+	.byte	0x2e
+	.long	0x5fb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1226
+	.byte	0x9a
+	.long	0x6ad
+	.uleb128 0x4
+	.long	.LASF1224
+	.byte	0x9a
+	.byte	0x29
+	.long	0xab
+	.uleb128 0x4
+	.long	.LASF1227
+	.byte	0x9a
+	.byte	0x3b
+	.long	0x18f
+	.uleb128 0x4
+	.long	.LASF1228
+	.byte	0x9a
+	.byte	0x47
+	.long	0x18f
+	.uleb128 0x4
+	.long	.LASF1229
+	.byte	0x9a
+	.byte	0x68
+	.long	0xab
+	.uleb128 0x23
+	.uleb128 0xd
+	.long	.LASF1231
+	.byte	0xa2
+	.byte	0xd
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1233
+	.byte	0x95
+	.uleb128 0x8
+	.long	.LASF1234
+	.byte	0x88
+	.long	0x6c9
+	.uleb128 0x4
+	.long	.LASF1218
+	.byte	0x88
+	.byte	0x2a
+	.long	0x5fb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1235
+	.byte	0x7f
+	.long	0x6ea
+	.uleb128 0x4
+	.long	.LASF1224
+	.byte	0x7f
+	.byte	0x25
+	.long	0xab
+	.uleb128 0xd
+	.long	.LASF1236
+	.byte	0x81
+	.byte	0x14
+	.long	0xd4
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1237
+	.byte	0x79
+	.uleb128 0x24
+	.long	.LASF1246
+	.byte	0xa
+	.byte	0x6d
+	.byte	0xd
+	.long	0x71e
+	.uleb128 0x4
+	.long	.LASF1238
+	.byte	0x6d
+	.byte	0x45
+	.long	0x71e
+	.uleb128 0x4
+	.long	.LASF1189
+	.byte	0x6d
+	.byte	0x54
+	.long	0xab
+	.uleb128 0x4
+	.long	.LASF1224
+	.byte	0x6d
+	.byte	0x6c
+	.long	0xab
+	.byte	0
+	.uleb128 0xa
+	.long	0x3bc
+	.uleb128 0x25
+	.long	.LASF1247
+	.byte	0xa
+	.byte	0x62
+	.byte	0x10
+	.long	0xab
+	.long	0x755
+	.uleb128 0x17
+	.string	"src"
+	.byte	0x62
+	.byte	0x3a
+	.long	0xd4
+	.uleb128 0xd
+	.long	.LASF1239
+	.byte	0x65
+	.byte	0x25
+	.long	0x755
+	.uleb128 0xd
+	.long	.LASF1240
+	.byte	0x67
+	.byte	0xd
+	.long	0xab
+	.byte	0
+	.uleb128 0xa
+	.long	0x43b
+	.uleb128 0x8
+	.long	.LASF1241
+	.byte	0x41
+	.long	0x770
+	.uleb128 0x4
+	.long	.LASF1218
+	.byte	0x41
+	.byte	0x28
+	.long	0x5fb
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1242
+	.byte	0x55
+	.byte	0x7a
+	.long	0x77b
+	.uleb128 0xa
+	.long	0x4b2
+	.uleb128 0x18
+	.long	.LASF1243
+	.byte	0x45
+	.byte	0x6e
+	.long	0x755
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 30 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 33 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 34 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x22
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.file 35 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 36 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 37 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.file 38 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF995
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.file 39 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 40 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 41 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 42 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.file 43 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2b
+	.file 44 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1108
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1115
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF972
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF990
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF994
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF997
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1020
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1102
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.31.3b5d682359a370a2ebd4f23a79bccb6b,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1111
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1248
+	.long	.LASF1249
+	.long	.LASF1250
+	.long	.LASF1251
+	.long	.LASF1252
+	.long	.LASF1253
+	.long	.LASF1254
+	.long	.LASF1255
+	.long	.LASF1256
+	.long	.LASF1257
+	.long	.LASF1258
+	.long	.LASF1259
+	.long	.LASF1260
+	.long	.LASF1261
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1262
+	.byte	0xa
+	.long	.LASF1263
+	.byte	0xa
+	.long	.LASF1264
+	.byte	0xa
+	.long	.LASF1265
+	.byte	0xe
+	.long	.LASF1266
+	.byte	0x2
+	.long	.LASF1267
+	.byte	0x3
+	.long	.LASF1268
+	.byte	0x4
+	.long	.LASF1269
+	.byte	0x5
+	.long	.LASF1270
+	.byte	0x5
+	.long	.LASF1271
+	.byte	0x5
+	.long	.LASF1272
+	.byte	0xd
+	.long	.LASF1273
+	.byte	0xd
+	.long	.LASF1274
+	.byte	0xe
+	.long	.LASF1275
+	.byte	0xe
+	.long	.LASF1275
+	.byte	0xd
+	.long	.LASF1276
+	.byte	0xa
+	.long	.LASF1277
+	.byte	0xd
+	.long	.LASF1278
+	.byte	0xd
+	.long	.LASF1279
+	.byte	0xa
+	.long	.LASF1280
+	.byte	0xa
+	.long	.LASF1281
+	.byte	0xc
+	.long	.LASF1282
+	.byte	0xa
+	.long	.LASF1283
+	.byte	0xb
+	.long	.LASF1284
+	.byte	0xb
+	.long	.LASF1285
+	.byte	0xa
+	.long	.LASF1286
+	.byte	0xa
+	.long	.LASF1287
+	.byte	0xa
+	.long	.LASF1288
+	.byte	0x9
+	.long	.LASF1289
+	.byte	0x9
+	.long	.LASF1290
+	.byte	0xd
+	.long	.LASF1291
+	.byte	0x8
+	.long	.LASF1292
+	.byte	0x7
+	.long	.LASF1293
+	.byte	0x6
+	.long	.LASF1294
+	.byte	0x7
+	.long	.LASF1295
+	.byte	0x1
+	.long	.LASF1296
+	.byte	0x2
+	.long	.LASF1297
+	.byte	0x2
+	.long	.LASF1298
+	.byte	0x2
+	.long	.LASF1299
+	.byte	0x4
+	.long	.LASF1300
+	.byte	0x4
+	.long	.LASF1301
+	.byte	0x3
+	.long	.LASF1302
+	.byte	0x3
+	.long	.LASF1303
+	.byte	0x5
+	.long	.LASF1304
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1080:
+	.string	"PG_OSD_CONFIG 501"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1215:
+	.string	"biquadFilterApply"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1134:
+	.string	"size_t"
+.LASF1016:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1087:
+	.string	"PG_PWM_CONFIG 508"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1184:
+	.string	"CURRENT_METER_ID_VIRTUAL_1"
+.LASF1185:
+	.string	"CURRENT_METER_ID_VIRTUAL_2"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1232:
+	.string	"currentMeterESCInit"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1058:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1019:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF522:
+	.string	"__flexarr []"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1206:
+	.string	"currentSensorADCConfig_System"
+.LASF1130:
+	.string	"int32_t"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF1009:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1228:
+	.string	"throttleLowAndMotorStop"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1129:
+	.string	"int16_t"
+.LASF1187:
+	.string	"currentMeter_s"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF981:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1186:
+	.string	"currentMeterId_e"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1088:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1111:
+	.string	"ESC_SENSOR_COMBINED 255"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1017:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1221:
+	.string	"motorNumber"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1239:
+	.string	"config"
+.LASF1238:
+	.string	"state"
+.LASF509:
+	.string	"__P(args) args"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF988:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1164:
+	.string	"CURRENT_METER_ID_9V_2"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1241:
+	.string	"currentMeterReset"
+.LASF1156:
+	.string	"CURRENT_METER_ID_NONE"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1223:
+	.string	"currentMeterESCRefresh"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1229:
+	.string	"throttleOffset"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1038:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1083:
+	.string	"PG_PID_CONFIG 504"
+.LASF1209:
+	.string	"currentMeterIds"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF984:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1137:
+	.string	"ADC_BATTERY"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1141:
+	.string	"ADC_CHANNEL_COUNT"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1037:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1090:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1030:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF994:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1245:
+	.string	"biquadFilterInitLPF"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1052:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF802:
+	.string	"USE_PPM "
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF546:
+	.string	"__always_inline"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1127:
+	.string	"long int"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF957:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1145:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1169:
+	.string	"CURRENT_METER_ID_ESC_COMBINED_1"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1205:
+	.string	"currentSensorVirtualConfig_t"
+.LASF968:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF380:
+	.string	"__unix 1"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1082:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1117:
+	.string	"short unsigned int"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF962:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1146:
+	.string	"PGR_SIZE_MASK"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1015:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF971:
+	.string	"Q12 (1 << 12)"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1140:
+	.string	"ADC_RSSI"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1120:
+	.string	"signed char"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1131:
+	.string	"uint8_t"
+.LASF1219:
+	.string	"currentMeterRead"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF1240:
+	.string	"millivolts"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF973:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF1236:
+	.string	"iBatSample"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1077:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF1044:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1199:
+	.string	"scale"
+.LASF1055:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1116:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1196:
+	.string	"mahDrawnState"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1050:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1147:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1142:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1003:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF785:
+	.string	"NULL"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1191:
+	.string	"currentMeter_t"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1099:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1075:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1192:
+	.string	"currentMeterMAhDrawnState_s"
+.LASF1194:
+	.string	"currentMeterMAhDrawnState_t"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF764:
+	.string	"__need_size_t "
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1124:
+	.string	"__uint16_t"
+.LASF979:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF976:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF766:
+	.string	"__size_t__ "
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF989:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1031:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF1204:
+	.string	"currentSensorVirtualConfig_s"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1089:
+	.string	"PG_ADC_CONFIG 510"
+.LASF1243:
+	.string	"currentSensorADCConfig"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1060:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1230:
+	.string	"adciBatFilter"
+.LASF1002:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF997:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1056:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF784:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1162:
+	.string	"CURRENT_METER_ID_5V_10"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1067:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1027:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF993:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF965:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1066:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF400:
+	.string	"bool _Bool"
+.LASF964:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF978:
+	.string	"STR_HELPER(x) #x"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1121:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1213:
+	.string	"currentMeterADCState"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1144:
+	.string	"PGR_PGN_MASK"
+.LASF1231:
+	.string	"throttleFactor"
+.LASF1242:
+	.string	"currentSensorVirtualConfig"
+.LASF985:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1004:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF1115:
+	.string	"CURRENT_METER_OFFSET_DEFAULT 0"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1036:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF977:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1012:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF987:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF1029:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1211:
+	.string	"currentSensorADCConfig_Registry"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1160:
+	.string	"CURRENT_METER_ID_5V_1"
+.LASF1161:
+	.string	"CURRENT_METER_ID_5V_2"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1023:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1153:
+	.string	"address"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1234:
+	.string	"currentMeterADCRead"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1163:
+	.string	"CURRENT_METER_ID_9V_1"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF975:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF765:
+	.string	"__need_NULL "
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF960:
+	.string	"VERY_FAST_MATH "
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1218:
+	.string	"meter"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF990:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF883:
+	.string	"BARO "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1227:
+	.string	"armed"
+.LASF1006:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1007:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1166:
+	.string	"CURRENT_METER_ID_12V_1"
+.LASF1167:
+	.string	"CURRENT_METER_ID_12V_2"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF972:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1039:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF999:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1220:
+	.string	"currentMeterESCReadMotor"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1126:
+	.string	"__uint32_t"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF1159:
+	.string	"CURRENT_METER_ID_BATTERY_10"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1093:
+	.string	"PG_VCD_CONFIG 514"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1065:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1022:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF1073:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF772:
+	.string	"__SIZE_T "
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF499:
+	.string	"__PMT"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1086:
+	.string	"PG_PPM_CONFIG 507"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1195:
+	.string	"currentMeterADCState_s"
+.LASF1197:
+	.string	"currentMeterADCState_t"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF967:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1008:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1207:
+	.string	"currentSensorVirtualConfig_System"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF963:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1026:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1154:
+	.string	"reset"
+.LASF1033:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1118:
+	.string	"unsigned int"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1110:
+	.string	"ESC_BATTERY_AGE_MAX 10"
+.LASF1020:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1100:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1109:
+	.string	"ESC_DATA_INVALID 255"
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1107:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1114:
+	.string	"CURRENT_METER_SCALE_DEFAULT 400"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF983:
+	.string	"BIT(x) (1 << (x))"
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1143:
+	.string	"pgn_t"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1193:
+	.string	"mAhDrawnF"
+.LASF1151:
+	.string	"pgRegistry_s"
+.LASF1155:
+	.string	"pgRegistry_t"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1189:
+	.string	"amperageLatest"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF545:
+	.string	"__wur "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF402:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1053:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1247:
+	.string	"currentMeterADCToCentiamps"
+.LASF1104:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF401:
+	.string	"true 1"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1200:
+	.string	"offset"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF881:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1171:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_1"
+.LASF1172:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_2"
+.LASF1173:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_3"
+.LASF1174:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_4"
+.LASF1175:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_5"
+.LASF1176:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_6"
+.LASF1177:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_7"
+.LASF1178:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_8"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1021:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1097:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF958:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF787:
+	.string	"__need_NULL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF1051:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF885:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF956:
+	.string	"sq(x) ((x)*(x))"
+.LASF1150:
+	.string	"biquadFilter_s"
+.LASF1136:
+	.string	"biquadFilter_t"
+.LASF1070:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1128:
+	.string	"char"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF813:
+	.string	"LED_STRIP "
+.LASF1040:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1042:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1043:
+	.string	"PG_RX_CONFIG 24"
+.LASF1024:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1081:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1198:
+	.string	"currentSensorADCConfig_s"
+.LASF1201:
+	.string	"currentSensorADCConfig_t"
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF1170:
+	.string	"CURRENT_METER_ID_ESC_COMBINED_10"
+.LASF1034:
+	.string	"PG_PID_PROFILE 14"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF998:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF1013:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF1225:
+	.string	"currentMeterVirtualRead"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF879:
+	.string	"GYRO "
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1190:
+	.string	"mAhDrawn"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1244:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF970:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF1148:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF1084:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF974:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF995:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF1076:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1098:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1152:
+	.string	"size"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF393:
+	.string	"SITL 1"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1046:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1096:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1018:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1132:
+	.string	"uint16_t"
+.LASF1216:
+	.string	"adcGetChannel"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1119:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1048:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF1071:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1224:
+	.string	"lastUpdateAt"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1165:
+	.string	"CURRENT_METER_ID_9V_10"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1233:
+	.string	"currentMeterVirtualInit"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1014:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1210:
+	.string	"pgResetTemplate_currentSensorADCConfig"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF991:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF783:
+	.string	"__size_t "
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF822:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1000:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1101:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1045:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1217:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1105:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF1032:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1122:
+	.string	"__int16_t"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1139:
+	.string	"ADC_EXTERNAL1"
+.LASF1214:
+	.string	"currentMeterVirtualState"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1212:
+	.string	"currentSensorVirtualConfig_Registry"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1061:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1057:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF959:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF966:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1203:
+	.string	"currentSensorVirtualState_t"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1010:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF803:
+	.string	"USE_PWM "
+.LASF782:
+	.string	"_SIZET_ "
+.LASF1001:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF821:
+	.string	"GPS "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1246:
+	.string	"updateCurrentmAhDrawnState"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF897:
+	.string	"USE_PPM"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1011:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1072:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1028:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1059:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1049:
+	.string	"PG_GPS_CONFIG 30"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1180:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_10"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1182:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_12"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1047:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1102:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF1091:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1226:
+	.string	"currentMeterVirtualRefresh"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF1235:
+	.string	"currentMeterADCRefresh"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1123:
+	.string	"short int"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1113:
+	.string	"IBAT_LPF_FREQ 0.4f"
+.LASF1063:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1179:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_9"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1181:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_11"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1005:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF969:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF1188:
+	.string	"amperage"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1183:
+	.string	"CURRENT_METER_ID_ESC_MOTOR_20"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1202:
+	.string	"currentMeterVirtualState_s"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1068:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1064:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF1054:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF949:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF801:
+	.string	"USE_CLI "
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1112:
+	.string	"ADCVREF 3300"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF996:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF986:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1035:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF888:
+	.string	"USE_UART2 "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1106:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1062:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1133:
+	.string	"uint32_t"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF982:
+	.string	"UNUSED(x) (void)(x)"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1157:
+	.string	"CURRENT_METER_ID_BATTERY_1"
+.LASF1103:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1079:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1041:
+	.string	"PG_IMU_CONFIG 22"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1069:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1094:
+	.string	"PG_VTX_CONFIG 515"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF961:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1135:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF980:
+	.string	"EXPAND_I(x) x"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1149:
+	.string	"pgResetFunc"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1085:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1025:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1138:
+	.string	"ADC_CURRENT"
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1074:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1125:
+	.string	"__int32_t"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1095:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1222:
+	.string	"currentMeterESCReadCombined"
+.LASF1208:
+	.string	"supportedCurrentMeterCount"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF898:
+	.string	"USE_PWM"
+.LASF1237:
+	.string	"currentMeterADCInit"
+.LASF1158:
+	.string	"CURRENT_METER_ID_BATTERY_2"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1108:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1168:
+	.string	"CURRENT_METER_ID_12V_10"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF992:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1078:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF1092:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF929:
+	.string	"USE_PROFILE "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1299:
+	.string	"io_types.h"
+.LASF1282:
+	.string	"long-double.h"
+.LASF1289:
+	.string	"__locale_t.h"
+.LASF1291:
+	.string	"platform.h"
+.LASF1293:
+	.string	"target.h"
+.LASF1276:
+	.string	"libc-header-start.h"
+.LASF1274:
+	.string	"stdbool.h"
+.LASF1259:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1249:
+	.string	"src/main/common"
+.LASF1263:
+	.string	"stdint-intn.h"
+.LASF0:
+	.string	"./src/main/sensors/current.c"
+.LASF1298:
+	.string	"axis.h"
+.LASF1258:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1261:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1283:
+	.string	"stubs.h"
+.LASF1253:
+	.string	"src/main/target/SITL"
+.LASF1280:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1257:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1290:
+	.string	"strings.h"
+.LASF1278:
+	.string	"features-time64.h"
+.LASF1262:
+	.string	"types.h"
+.LASF1271:
+	.string	"current.c"
+.LASF1251:
+	.string	"src/main/drivers"
+.LASF1260:
+	.string	"/usr/include"
+.LASF1248:
+	.string	"src/main/build"
+.LASF1300:
+	.string	"system.h"
+.LASF1277:
+	.string	"features.h"
+.LASF1292:
+	.string	"common.h"
+.LASF1285:
+	.string	"typesizes.h"
+.LASF1288:
+	.string	"locale_t.h"
+.LASF1303:
+	.string	"esc_sensor.h"
+.LASF1250:
+	.string	"src/main/config"
+.LASF1286:
+	.string	"time64.h"
+.LASF1264:
+	.string	"stdint-uintn.h"
+.LASF1254:
+	.string	"src/main/target"
+.LASF1297:
+	.string	"utils.h"
+.LASF1296:
+	.string	"maths.h"
+.LASF1252:
+	.string	"src/main/sensors"
+.LASF1255:
+	.string	"src/main"
+.LASF1304:
+	.string	"time.h"
+.LASF1301:
+	.string	"parameter_group_ids.h"
+.LASF1287:
+	.string	"wchar.h"
+.LASF1270:
+	.string	"current.h"
+.LASF1256:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1272:
+	.string	"string.h"
+.LASF1281:
+	.string	"cdefs.h"
+.LASF1275:
+	.string	"stdint.h"
+.LASF1295:
+	.string	"build_config.h"
+.LASF1265:
+	.string	"stddef.h"
+.LASF1284:
+	.string	"stubs-64.h"
+.LASF1302:
+	.string	"config_reset.h"
+.LASF1279:
+	.string	"wordsize.h"
+.LASF1294:
+	.string	"common_post.h"
+.LASF1268:
+	.string	"adc.h"
+.LASF1267:
+	.string	"parameter_group.h"
+.LASF1269:
+	.string	"current_ids.h"
+.LASF1273:
+	.string	"stdc-predef.h"
+.LASF1266:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`A"
+	.string	"]\006"
+	.string	"T\t5\001"
+	.string	"\026"
+	.string	"\246\201\307\205\t\006\002"
+	.string	"\002\001\001\326\245\251\266\r"
+	.string	"\002\240\342\234\212\n\003\004\244\326\212\346\t\024\002\002\002\003\002\004\002\003\002"
+	.string	"\002\005\006\002\007"
+	.string	"\002\007\005\006\365\253\371\246\005\f\005\007\233\346\244\226\006"
+	.string	"\b\t\242\233\362\205\b\020\002\002\002\b\002"
+	.string	"\002\t\002\004\n\013\270\272\250\266\013\n\001\f\274\205\242\255\006"
+	.string	"\r\354\301\314\336\005"
+	.string	"\016\017\256\333\356\326\016\020\021\265\343\353\255\013\022\340\207\245\357\f\023\217\300\262\314\b\024\253\327\227\253\013\025\231\366\331l"
+	.string	"\026"
+	.string	"6\236\230\377Q\200\215\257/D\300"
+	.string	"\240\316\240\035\027\"^\030\270\342\326S\202gR@81L"
+	.ascii	"\352\fV\215\354df\006\340\313\205)W\355H*\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375 t=\002"
+	.string	"D\002h"
+	.string	"\f"
+	.string	"\001\001\001"
+	.string	"\004\006\001\007\t\004\001\013\f"
+	.string	"\001\r\001\001\016"
+	.string	"\001\017\002\001\020\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\016"
+	.ascii	"\020\006\021\210\250\304h\tD\250\201\270\034\250*\31430\345\330"
+	.ascii	"\246\265\230\303r\347^\254\333@\033"
+	.text
+	.section	.gnu.lto_.inline.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`7\001\275\006"
+	.string	"\"\313 %\200\251\205\016\233\301,!\224i\020L\321\205\201\025\302\247\246\237K\230\006d\001\037{\031\321M\244`\213{\313\235\0027\003\002\214\275<\266\260\200\225\377\373\240\3463\370\034\336\315\317E$"
+	.string	"HX\365\025Q\t'\376\325`$\234\3526\211\005#_\221I\264=> *\370\025\261\306\213\255"
+	.ascii	"\361\\\340D\333\004\2761P\321\366\340\373\332~\346X\207\266\017"
+	.ascii	"/)\327|\fy\307\332\326\370\005q\321\326\370e\"\004! @\002\202"
+	.ascii	"\020*> \3051y\200%\231\223\244 \200fl\364\300!1\200Jw\3232\177"
+	.ascii	"5Gx\351E\201\275t\355\363\320\322X\206pJ\rJ\310\243\031G\344"
+	.ascii	"0\206\035\236o\371\277\337\347\005\350\2323\301\233\261\223q"
+	.ascii	"\247\033\316M\270\257\241]7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\275\005"
+	.string	"2\t\036'\2405\031\016\253x(N\354\"z\275\027\274"
+	.string	"O\236==g\210\002\200[\340\231\005\236\326\366\022\273\244\305\316{\313$\003\274O\341\356K\224\354\333\226V\004\311V\332\241\257\365\035\375+\003c\256\360\272qK\222\252)\347\346\301\214;\301\017\334)Y\222\003%\007\032\262jp\001\202@@C>\242(\001\240i&\213\276\231\365\314\352\214T=\\=SiZ\344\367\245'\343\216\032"
+	.ascii	".#\321\314\250\240\320\210w\230\256)\220\003\027\013/\350p\b"
+	.ascii	"\032\003\"\250^\006b\b\bC\\\230c\240\t\232B\\\303\025\006\362"
+	.ascii	"P\274DX \304\320z\306\bV\002XX\200!"
+	.text
+	.section	.gnu.lto_.pureconst.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\001\230\004\004\232\004\006\232\004\007\230\004\t\232"
+	.ascii	"\004\013\232\004\f\200\004\r\200\004\016\232\004\017\232\004"
+	.ascii	"\020\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"\215\004"
+	.string	"\"\306\024 \260'\303\001\f\363\201$\t\313\034RH\332\016\200\303mkk\203\301nB6\271d\223\275\245L\0013\032\216\0052\200lW\363%\303\024c\210\036\227\334HQ$L\337>\017\345\206\316B'\241s\320.\350AK\373\375^\3429_\345\201\362\301\325\351\331\002\032"
+	.string	""
+	.ascii	"\021\360\016\270\354(\342,\226s`p`\bx\017\320\f\246\300#\216"
+	.ascii	"\221\021\006\304\315!D\320w\327\200\023\224\001\260\267\246%"
+	.ascii	"YEU\t\216\033\013\002\2612\352\313\310\003(\002"
+	.text
+	.section	.gnu.lto_.lto.2dfb37358f83656c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_currentMeterReset.16.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\255\t"
+	.string	"\026RC< \005)\035"
+	.string	",\001\2410\352 \034d\bqC\231I\b\326zL\0353fA\207h\326b\367a\377[\030y/\262"
+	.string	"\002\002\360\326P\253]\256\323\232\"\375!\205.Y\317m\367N)/"
+	.string	"1"
+	.string	"4"
+	.string	"\006\334g\347\037\356\323\240]\363P\266W\321\310`\271\331]*G\016>\202\376i\027x\301Z\217\001\017\273\353\370\202q\334\362\266\023lC\330G\b1\373\263?r\034H\314\301\313\356\306-\300\332\246K\211\355\333\017A\333c\023\314\214\036O\363M~\002~\306z\301n\f\246e7d\360B\347\323\341\003.\211\361\275\006\372X}%\344\241p\233\342)\025\235\335%\371(\026\027\0032\222O\237\305}\202hl\\\361\346X\353\220\331\b\300\016[Q\212\330\347\354\356Z\006\036\231J\r\244\256\344 \372\324N\325\241\246O\"U\252\253uu\242_\365\276T\367\321\224\204\tEO\365\243\242\220\275\211\256R\225\347U\352\t\367\234\2251G\204\330\002\017"
+	.string	"A\263\240L\350\036\007\306\205\001\327"
+	.ascii	"z\3401\240\271\246\250\200wM\025\366\312\204\001\272L\004wn\321"
+	.ascii	"\316'"
+	.text
+	.section	.gnu.lto_currentSensorADCConfig_Registry.20.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375 \210\025\004"
+	.string	"D\007Q"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\334\321\031\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\345\006us"
+	.string	"\005\001\006'\001\004\200\002(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.string	"\004"
+	.ascii	"L\005\226r5E5\202\0018"
+	.text
+	.section	.gnu.lto_pgResetTemplate_currentSensorADCConfig.22.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006'\001"
+	.string	"\005\001\006\031\001\220\003?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_currentSensorVirtualConfig_Registry.25.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375 z\321\003"
+	.string	"C"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\344\221\033\005yw"
+	.string	"\005\001\006'\001\004\005\001\006'\001\201\002?\202\210\200(us\277\001q\276\001o\275\001m\274\001k\273\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/current.c"
+	.text
+	.section	.gnu.lto_currentMeterADCInit.29.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`_"
+	.string	"\375\b"
+	.string	"\226\320=9@o\323\001\003\246\303\272\343\021\303(#\001\343KD\211\023\250\311\221\034Bw[\375\224}\021f\330\333\246\330\214\207\224\035\206\211\005\231\357\006[\322*\371\2457\242Q#{\247\024)"
+	.string	"."
+	.string	"1"
+	.string	"\3667\016m\227\217\247}\310\252\"\005\263\273tj<\274\f\375{<@,\211.5\t\273k)\226.\356y\333\034\333\035\373X\206"
+	.string	"\345\305c>\230\035\263#$\344E\037\220\246\310\222\344\205e%\313\036Erf\330\277v\232\354K\023\263b\220\262k\321\222Y\025\206\302\341\231M^\322\322\201\261Fh\265f(vG\234\243>\302\001\210<\365i\3408\357a\225I\202[%\353\374\250\217\340\300iwt\321\3778H\310\3378\026\326<\240n\2535\244\321\257z_\267}\264\373,pT\253\037\365\024\330s\330*\005y^\245\233q\177\3554Y\201\245\032\315\t\013\310I:9C\017"
+	.ascii	"2\241\023h`\360\030<\346\002\2203\030\b\222\201\326 \212a\004"
+	.ascii	"a\\\023\311B\300/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_currentMeterADCRefresh.30.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`\246\b\325,"
+	.string	"\212O8\021E`\336Q:\367\212\305\320L!UNCa\323\031>\024\216\017\374\003:\031\003\372\024df1\272\276a7\364\327\376\241\362\327\373 \311\025\221\006\312\341\022/\302\323\020\243\205\270U\347\t\n>\231-\277\221&w\222\001\371"
+	.string	"\356"
+	.ascii	"\005\001\312\351q\275\332\246FK\2032\207\324\020\241\250\236"
+	.ascii	"}\233\361j\264^\334\377\200\263dz\225\306\310\f\224\362\331~"
+	.ascii	"\306\214o\3159\367(_\355e\030\310H\344\326\317\370d\200cN,\367"
+	.ascii	"^\340U\350\030\256\335\205\262\301\254.h%J\265\207n}\f\027\211"
+	.ascii	"\025\211\3313\356\3363\tW\231\306\305l\361\321\376d\340\325`"
+	.ascii	"\363\311O;\230\255\207\271\361\273\374\341\013[\002\235Z\257"
+	.ascii	"2\331\032\f\023\305|\264\255;\273V\257\037k\332\222h\334\275"
+	.ascii	"W\305z\265o\306\300!\267\250\223\375\013\362e\\\353U[w\340\320"
+	.ascii	"\021w/\031\204\253,b\275Jd\207\314D\3352\237\313\273 \337\354"
+	.ascii	"b\337\275J\240j\367^\t\034a\275*<\022\357\352\356F\274\253\214"
+	.ascii	"d\326s2(\367fu`\316\271{\357S?9\362\026\311\277\331}L ^\267="
+	.ascii	"\r\367^\266L A\316}fvb\346$\314+\232;\270\334\233<\223\037\347"
+	.ascii	"rZ\360\243\\e\027C{\346\220w\365j\177\227$\3112\377\245\0259"
+	.ascii	"\231_\b\230\030\034\350Y\203}\212\365\372e\027&\355 \016\332"
+	.ascii	"\bg&\312\260g\366\372aI\276\332\213\3553\354\315\265\203\230"
+	.ascii	"\311\224\266\2330\177w\233\t\263j\271\201j\231\001\320\362\002"
+	.ascii	"\325\262\002'\325r\002\237e\004\217\236\205?\313\007~\226\233"
+	.ascii	"~\226\231T\313K\252e\003@\313\005T\313JI\252e\002>\313\003.="
+	.ascii	"#\375,\037\375,\033\375,\027\251\226\005\254\226\211V\313\001"
+	.ascii	"V\313\3017\377\241\3252P\265\274\276\354\334S-\357|\226{\265"
+	.ascii	"lW\313\177\3603\342\306A\332\275>\352\b\3357um\312\243\277\364"
+	.ascii	"/{3\237\237\346n\230\201l\\s\267\277\231@\233k\323\f\322\246"
+	.ascii	"\th\312\246kw\301t\270`Q\267\237\032\317\246\253\350>\307\235"
+	.ascii	"\366\313*wS\351\232\223'\021\003\255\324K\005\332@\357\330RX"
+	.ascii	"/{\013\034\317\223Z)\251/%\320H\2354\240\tH\231\305\351\n\r@"
+	.ascii	"\352K\217\032\351p7\352#:/j\243\356\"\351\007\t:\333\0313\335"
+	.ascii	"_\353\356]\236\245[\223}\377\354s"
+	.string	"R\353\237\003\352\340AJ\212\007B\204=\323\266\020G{q\257\337I\316e\\\362I\244A3\217x\237\256%\270{/\024\237\317\345J\234@\201\202wU\2052\345\3707\373\245<\305\336\030\264\202n\320;\347R\313\202f\320;\266\024\337\263B\317\202\266P\247\231\204sj\005\335\316\345\230\362\212S\202\026\266S[\347\222\n\202N\320\007\243{\224Y\374\016\327z\357\027\224\035\004\275T\247i\323\252\b\373\321\003-\354\347\001pf\3435\365\201\346A\227tJq\356\200\307\324M\255B\227cJ[\307\275f\352\236\202\321%m\035\037e\211\013$w\243\2373\264H_\320\234\001<\343h$\036\207!\2102\206Eb\226\3250H<\016\217Fu\252hl\031T1\256\260\246x\306c\025\226\r\252\252**\253\037\261*\313jx\3428\344@\365c\n\303\013\025\240\210\0270L0:n \036\2070\262P\034\215\303*"
+	.string	"<5\341xE,\026kL=\031\213X\306+\242\361\351\212jh\3654U4>M`b\254,b\361\351\210\205U|\002\222%\277{3\341\017G\336\222\255\234\266\375f\377=\213\274\t\310b\207t\211\235)G\324\002\332\346Y\272\225yC\324a\034\035\202\022\304\372a\312\005h`\023\265\n]\"QF\337\344#\346\3552g\250\253\003\363uo\322)\330\001\372k\007[\211m\0317\324\273^\2737]\216)\031\271\305\372\340\350\312\226\207\355\201\364rBK\213w\025\330Mu\232n\376K\363\362\346\276\375=\322\266\300\031\352\267\271p\327\237^\230<\263;\264,\034#\273X&\322\013\324U\035o\343\021\026\254k]\266\257Yd\251\2317\004\200\242\250Q0\246\224bL\315\214H\222\224$\035\260\002\221\241*;\022\300U9\fb\025\211\221\244\365Y\3663"
+	.string	"~\257pw\225\361\034\2021[\304\264\260o\366,\273\320\215"
+	.ascii	"$\204\207c\277\353\017d\bQ\2133\217\223\373\243\217\221\322l"
+	.ascii	"\210\222\304\036\004\222\032\305\2646Qo\256\310zG2,\263\223\327"
+	.ascii	"\026&\026\002i\233r\2505\232\300\216\211(\fM{\r\272\030\340\361"
+	.ascii	"\2727\207\2417\367o\331\256\001s\3467\327a\323q\231\\:\242\210"
+	.ascii	"\343\323\353Xg\243\034\376\205\243q\373\345\233\006\030E^)0?"
+	.ascii	"0\357\355\2442\3422\354b\t\341'`c(\216X%{\023kfd\365k\351M7\020"
+	.ascii	"\277\beA\341(\360\312S\266:\224\245Y\340\033\013\301\007\360"
+	.ascii	")\256\230\035\3059\332Tn\246\370V\270\365B\376\266b\255#)\353"
+	.ascii	"\273\313%v_\365\237a\327\"\036\361\341&\3673\202\030\204w\274"
+	.ascii	"\024\201\001?)\023\341\312h\032^>\"\t\002\360\017ls\275\377\240"
+	.ascii	"\210\002\330-\242\251U\341\303\214\230\321A\031V\240\025&U\356"
+	.ascii	"U\206kdj\022\212\037/\257X\001\212\036\267K\245\372\b\347\363"
+	.ascii	"#\006\363?\330\322\205mQ\001"
+	.text
+	.section	.gnu.lto_currentMeterADCRead.31.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`.\001\035\f"
+	.string	"\326\226P?\020Q\225\016pY\314\242N\253\257"
+	.string	"\354\257\232\025e\210\347\330\271\364\234~\273FD\022\240\201\321\307:1-\001F&\310#\b\""
+	.string	"\210\250&\206\335\261L0\211\024\300\256\200m\266r#)S\n<"
+	.string	";"
+	.string	"A"
+	.string	"\027\260kj\241b7\264\370@\344\321\341\007\\\217\221W\256G\177\366\214\207\247}\353\002\205V\215\335\3054\303\277\347\347\237u\tX\032=\001,\330]'X\262p\353m\027\260\315\300~*\037N\023\033`l\332\260\303Q*\006\373\220\335]\253\311\376\352\217\231\326Lg\246/\t\220za\200c\267\302\307\215\355\210,4\330\276\375\360\263'6E\205y\236\345\177\270\352\373J\024)\034X<\036Q\250n:\244\332\235\237H\031\017^\202D\252\205\303\325\366|D\313\333('\224\350zT\027 \r;\302Et\221\335\315\370 \036\002\344\243\036-!\224\007\037\375\320\365xM\020cE\312\306p4\b2\232F\301\245\302i\236\346\211\316.\336G\3438P\206u\334\326}\264\016\373t8\036,\343:\354B\300\033\004\215\303\274m\343\260I\270\207\254\232\032x\350 \351\004\253\332\234\257\310\316\321m<\254=\031"
+	.string	"A\263\340Lh\356\007V\271\227\222\241"
+	.string	"\317\250\354\354\f\302\030\002\213\001\351\300\023 \230*P\f\336"
+	.ascii	"|\267 \007\336\r\2030JI\313&\330S\021\021\252\260Y\227\211\340"
+	.ascii	"\316-\332\371\004"
+	.text
+	.section	.gnu.lto_currentMeterVirtualInit.33.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`\007"
+	.string	"\005\007"
+	.string	"\302\21514pM\322\001\200\364h\311k\f\377\350~\315\303\373;s\200\251\343\216C\314\277\021\274\345\037\255\215Z\342L\262\376^\254\006\270\"c\365?7\274\260\354/eJ\001\2360\231\212\202P3\275\013ZWE]\257j`px\023\274\036\306\300\326\003\005_\306\262\340\223\266\275v\026PB\033\235p\224\004\267Ht\371;\276a\005\236\335\315\243\357\361\017\215\257qg\b,\037\357|,\272\263#$\362\321\007\024\2529AFJ6W\354MK\305\260\017\260\332\261u\340\204$!e\327\242\205eC.d\303\366%g\266\3117\317\036\364\251"
+	.string	"\251\354\356\323\214g\317\314?\307\005\"G{\006(\354\2563r.n\275m\004\333\027\333\237\b"
+	.ascii	"3\001{8\323\030\3365\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRefresh.34.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`\363\005]$"
+	.string	"\232AH\016I\220\232Q:\202\002\231"
+	.string	"\260|\342va\372\252\254\257\315\302\276\374\b\021\343\203k:M\240H\371\335'\377\276\177\003\3013\013\2174g\366\"\2218U\247\363\334k0\327\303\274\215\234~\341V\240K\330\037mO\032\331D\356$\003\313"
+	.string	"\302"
+	.string	"\323"
+	.ascii	"\1771F\250\345uO\340\221\276#\341\213\tG(\257{\215\266\333\032"
+	.ascii	"\034\234\255O\362\243\\\312\322\221\276 \343\255a\356\360\301"
+	.ascii	"\025\365u\313*\316[6\236\237Zb\246\335V\032s\315\206\324\257"
+	.ascii	"\334\271LB\262N\234\2675\030NV\334X\244\343+C\034\\Wf\004\n\200"
+	.ascii	"7\256\b:\233\254\250\254{\215\006\330\302y\233\223\006\367\312"
+	.ascii	"\374\2503\001\276\370c\331\275A\260X\335{\rp\201\363\326\350"
+	.ascii	"\002\314\333\362=\346-\003\231\313\334X\344\376\b\345\342\370"
+	.ascii	"u\357\2755\221\003o\332\262+\220\037;\222\021\233X\334\2345\341"
+	.ascii	"\270\275\361\262\005\026Sm\235\246ait\357\375\3615F\223\260\326"
+	.ascii	"\330\321\275\227+\261\251\3069vf6\301\314>\230\255\227m\251\\"
+	.ascii	"\304aF\217\205\304y/\323\002\376\225g\231\340\037\271\345\023"
+	.ascii	"H\365D$\363\366\375*#\305`\r\343\212l\263u\353\033f\243\260\366"
+	.ascii	"\023\363\313\333C\230\273\362\320YY\350\254\034tV\006z\361\377"
+	.ascii	"\351\312>g\345\236_\235y.\365\007\270\223\177\347\306\037@W\256"
+	.ascii	"]\352<\353\312\262\256|v\345XW6c\225mW.\273rw\345jV>\021\255"
+	.ascii	"\207\027\033\227{g\204\301\271]\254\025$\277\372\231_\373\201"
+	.ascii	"c,\246\325\200\340\230\257\030\353dA\343\234zB\332f\234\267\262"
+	.ascii	"t(\374)\257z\025\213C\211S\324\275\227fU\254aUdC\205\352W\336"
+	.ascii	"(\021\256\355V\307\005\356\365T\226N\365\343\271\001Ea\254|6"
+	.ascii	"\325d\353V\371\251f\211U\2334?}+Y\237\312\241\274\313W\271\356"
+	.ascii	"\r\236\310\274\341d88\270\035\223\f\363;\271d-+\036?K\3620\373"
+	.ascii	"I\346u%Ni;\227\035\240g\035\203\371\004\363#\360\345D4>]\373"
+	.ascii	"l\2535t\212q\305\332\247\211\276\f\241x:\3265Lb\333\354\030X"
+	.ascii	"\207oy\360b\373`\214\024s\2229x\372W7\n\226\315\323\357\032:"
+	.ascii	"!8c\231\335e\017\035\207P\263\236uw\fl\230DX\303\2227f}"
+	.string	"\024\264\266_\352)\200\004\353\033\326A\206\275\354\247-\337i\336\261~\031H\260z\357e\321\274\302\004\320!\236\210a\252n\270\"\337\324f\376p\255_\021\327\275w\001?\313\265\200\310\351t`D4\357\032\274]\252\313IH{h\232\253\200\222\310\361P%\244\234\016\232\346\322\236M\321\336\210\021\027t\224vi\006\336.\335Y\020\221\004aiW\001E\221\246;^\211\024H\004\212\304\313YF\220c\220`\001\312\240\301\201\236\024\002\232\346D(mH{9\0249\254;\220&\241<\236Ow\353\361v\275$\264wK2\221C\272\351x\275\333\001\"\336)\241\274[\272\333\361n4c\360\345\355!L\301G\227`\013\231\231\237\374\217\327\200\305\252\215\327\020\206\177\375\330p\360\t\365P\327\256\341\226\251*[B\275\206\253jE\324\3245D4A\335\323Bm\251\206N\302\252\027\317$\273\\~\020\026\026\205\351\336\340"
+	.ascii	"\240\016\352\327\032\250\205\260\206^?-\353Z\307\264\206I\204"
+	.ascii	"\234\341g\270\3524s/\016>\237y\333\323\001v\25018\307\224B\210"
+	.ascii	"\031\031\021Q\230\202\2449\220\002\221)\263:\020P\307h\223\f"
+	.ascii	"\007\037m\006\202\302\265U\314\260b\262\200\372c\210\201\f\r"
+	.ascii	"\366\001\340\0074\322\262lC\216\262?\020\366\333\220\3245}\n"
+	.ascii	"\203\266{\235\354\272\217\215\261e\353\337\344\335\220\\\201"
+	.ascii	"\204\314\201i}o\037\257\212\016\304\365\017\211\177\240\016:"
+	.ascii	"\022\214\312\327\n\231\327\t\274\r\205\337T\210\224\266F\326"
+	.ascii	"\006\370\023\252\227\021\340\264\255e2\037\247A\226\257\234\214"
+	.ascii	"(|2\003~0\217\374\215u0\312\r\267\340\332\364\3464\332\375\234"
+	.ascii	"<\232\242\253\275\032\037\311\377q\342\364\223\216\306O\247\367"
+	.ascii	"\244\013\323\035:i?\003\324\274\273[<{\3202\204i\315\035\241"
+	.ascii	"Iz\034\204\337\273\307p\343Z\254\224w0\240\024lO\214A^\262\021"
+	.ascii	"\344\255\316\200w\272\306wV\002\323\315\005M{[\0331\315\344&"
+	.ascii	"\336\037"
+	.text
+	.section	.gnu.lto_currentMeterVirtualRead.35.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`\003\001\265\013"
+	.string	"6\326N> O\225\016\200h\f\213\316.\342\215F\017\370\t4N@}\007j\351\322"
+	.string	"\020\216`T\350\177l\241\370\033\324\022\365\017\202$\204\b45\r[\206\331\017\"\0328p,@\223\310\215\266L):"
+	.string	":"
+	.string	"?"
+	.string	";b\221b7\214\370"
+	.string	"v\351\360\004\256K\354\220\353\322\236\r\343!i\177ZA\341\024cwg\274p\357\352\3717\035\300'\372\\5\024\354\256\365\023U\270\343m\033\260\275\300~(\212\312\340bU\206\035~4Z\260\357\330\335u\034\331\007\177\207\252U\325\307\036\034ZDP\354\2066f\254J\252\300`\373\366C\317~\330\001R\223\353M\276\207\177\360\016z>`\003\r\216\302\314\325e\t\215\026\026\270\301\301I\350\213\257\245\341\321\316|\304)\302&\200T\362\\\2271\365\265l\b\027\321a\273K\361A<\004\307/]ZBG\377]\372\235\353\362\221\302\002A\272\341\236\\*\b(Z%\201\004\302i\033-#\235I6\032\215\3438\331\354\270\255\323h\335\324`.\231\231q\335\224\024\360\366@\343\346f\333\270\371\b\367\216\215#3\350\240\002\305\t\326hg?\241\335DgY9\026"
+	.string	"A\263\240L\350\332\013\f\017\212\f\265*F\220b\267\303`\b\0263\030\371"
+	.ascii	"\026\240\030NQ\002\274ahF\351k\330,{j#B\2656\352\202\021\\s\013"
+	.ascii	"a>\001"
+	.text
+	.section	.gnu.lto_currentMeterESCInit.36.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375 \307M\005"
+	.string	"\302\t$,\200\305\351"
+	.string	"\034\356`V\032\217\215\001j\235:V.eRF\331P;\332\266{p{lF\310\034\244\231j\364\304"
+	.string	"i\360o\367N)\216\240\212\222\244\204D:e\234\2244\225r4&\215\344T\350\340\370\220\244V1J}\266=\324\020\021(qb\337\200\275]\017Z\354\017\026j\366{:"
+	.string	"\335\354R\n\b\266C\340dl\377\261e\007|\303\3549\201\t\327\355\256\302\313\255?\313\277\346\006,\273\376\n\214\335\365\303\262\312\ro[a{a{\n\b"
+	.string	"3\003\366\231\301\300\367\273\206\223\2050^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_currentMeterESCRefresh.37.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\265\007"
+	.string	"\022\01775P\217\032\003\203r\347xfQ\213p9\212\023\252\222e\321\316\222\266ej{`\325\233\034.Ix\221\022W#"
+	.string	"*\022"
+	.string	"\240\n;\243\206\250\272u\220\275\245L)M\310@\n\013\032\210\341\343\341\0364.\223\030Ep3\243\3504\364\341D\232\224\026\2418\3456E\332\214\242\211\254\"\206\344\214\037\202n#MFn\333d\344\244\356\353\360\324\353\005\325j\301\200\031\025X\275\345\362\007\323\246H\017~\264\276\376\277\360\324\276\211b\255\342\314\2771\023\363\025LE\244\2559m\347\244\301\257\365\210I:\227\\t\363{\240\244\374G\350A\200\261\002\017h\214]\366h\214\265kY\234\n\271U2\032*\326\377\bA\334\371u\265M\274)\231H~"
+	.string	"\016\377\373J&\016\027\272\255A[\210\266\035\001\b"
+	.ascii	"\270\263\240L\350\322\013\f\027Z]\306\263VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_currentMeterESCReadCombined.38.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`\035\001\r\r"
+	.string	"vWWB"
+	.string	"S\225\016\200Q\264\353b\375_\271\254J\333\336\r\260m]\367\034h\345\332\032\375\337(\t\310\330\223d\204\013\205EpNX\227q\177\2351\220\013\350\243Zg:y\340\255\033\370\310C\267\207\033\221\235R?"
+	.string	"F"
+	.string	"D"
+	.string	"\257\323\013\354\262|\324\330\255\013\254\240r\352z\003\335i\345\227\356\324\244\375\343\265\265\267\215\330\360\202dw?\256\304\311O\322?\354\001R*\r\237"
+	.string	">\273\353\231R\255n\356\266\023\330~`\337D9v8 \262\333\341\244\310\336\250\215\024~\3544\323\253?\213p\203\305\356z\227}P\034\2262\243\305\210\346\324\322\203\363y\231\351\257\323\201\272\253\253"
+	.string	"\001\303Er\352\307L\266wz\317\036p\202\363i\337u\027\344\003\265\020\232\237\346\322m\027\b\264v\267\343\3272`\360Q\234\272S\314\210\220r\236\370\264\013\250}\370\354\023Vx(\t\262\334eGPN\023O\0328x\3544\261+jr$\354Svw\315\261\354\277\376\331Y\002\346\200<\f:\240\247\301\346\"\202$PD\035\332\220F\240(\226B\337(\206\343\b\034\277\021\005\220\350\013\211\343\267\3118\254"
+	.string	"\212\037)\f\305\317\253\345)\313\261\fA\307\255\344P?\354\022\206\324\022 \245\205\313\300\210\030\037#3\003\032"
+	.ascii	"A\263\240L\350V\032\030\017\3437\001\001b\300<\360\030\200\335"
+	.ascii	"RSD\205#\325n\203f\255\240\344h\t\254.\363~B\0131\376\217\027"
+	.ascii	"S\270\370P\207P\325*\252\225\276\225\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_currentMeterESCReadMotor.39.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`Q\001E\016"
+	.string	"\246\031_F"
+	.string	"\223\223\016`\024\356T\001\357+\256\273\344\214&\243\222e\220\251\350L\354\272\254#\265_\251~\222\002>\002\341\266ih\215\217\022D&\325\243\336\256\026\200TO\226t\016t\347\202\360\354\262\345`\343\343i\233\354\235RG"
+	.string	"N"
+	.string	"K"
+	.string	"7\340\371\f9\211\347S\004\005\212\321Fi\340}F\203\345\356\t\033\033\273u\201\025\204|\332\263y\274\302\354c\310tX\265v7\223)\356=z\376i\036"
+	.string	"\325\262\341\021\300\312\356:\242Z\\ny\333\tlG\260\177#\036\023\253\325\303\201\315.\210\235 \313\2328V\370\251\203\245\303\360W\022r\310\354.v\325\312\311\303^4Z\324\223\317\021\035 \031\257*\325uy\f\211\232\231\326\247\237*\331\330\3471[D\004HF\373.\376\302{5\035 \260\034R\037\036\324&\270\3170\211`\211\223\0374\206\313\350\006\300\354n\212_\223\201\344\2530y>Kv"
+	.string	"\371\342\216\017^"
+	.string	"8\342\346\253S`\021\"\374\021\345UG\360E\035\217\264n\n\344\304\204>6\352\330\365\024%\n\373\327\356\256\345\213\375\372\307T\033i\3334\n\213\n\203\024M\005\364!\241Z\205\215\004\201r#n\303\034\372\214D\032\245\244P\326Q\256\023i]&\262\300\262e!\332e\037\023s\0274\232\2158\216fX\375~\255|\361\025\262B\234O\236~\232O\310\251!\316\267\275FI\036"
+	.string	"\247\263\240L\350j\032\030\217s\260\002\002\304\200y\3401"
+	.ascii	"\273\245\246\210\nG\252\335(\315\206\227\215i\356gY\311.\370"
+	.ascii	"~L\013\321>\347\033\246\202\362\241\032\002\271T\305\211\032"
+	.ascii	"\t,\334\001F\244\251(\340./\332I\006"
+	.text
+	.section	.gnu.lto_currentMeterRead.40.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`h\001\305\016"
+	.string	"\306\232bG\360\260(\035\220\225\321\037\226\013\033Rk0\360\034\244\233Q\362\355\372\321\212\346(f\033\233\343zM\226\315=R\001}\351\304\006\214|\317\234\254t\031\340Q\231(\244\214\255Y\032\267c\316\374S]L\326j\177\267\275S\nI"
+	.string	"L"
+	.string	"Q"
+	.string	"\"\255\006}\264\277z\315w\033\013\376\330\025!\343\305nU\340\004\242O\222\023"
+	.string	"}~\036\002\372\364g\343x\245\331\273f`h\361\354.\2253\377\036?\3777\377p\201\271\360\030B\331]G\027\230\230[\336\366\001\333\017\354\353\bu_f\262\305\2310J\370\255\277NO\341\273\f\204\220\311\254vW\373\264\375\020%\225a?,j`%\237 :4\306\207\247\263P\005\352\306\334D\207\327\212\347\323o\235l\355\363\232\255\345\240\261\036\305w\026\352\002vU2\007\242O\327-\001hv\327\304WQ\201\202O\002\005\372\024\271\301\003\2143\377u"
+	.string	"!\207\234\273\036\341\204\206\330\016)\037\236\004\214=V\231\301b; /1r\006\364\330\330\316\306\036\273\246\242\034a\377\263\273k\251\262\317\372\345m\376\207\020\250d@\314\320\2206\002\335f\332X\246\027\244\23400\331N\032\214BTV\242I#Si\353\272\026\022\365:\316+m\036-\255\244\260PR\347\321\321\2109\t[GM\034\327Q\255\202\377\254T\031\302\006\034P\246\376\233\213tf\260\030\f\344\356B\344\303\204\267\030\211\241\207\222\377e\357+\002\037"
+	.string	"\216YE&^=\215\206\307\336X\301\003b\300<\360\030\200\335RSD\205#\325n\272f\303\313\3066\267\256lfY\251.X\202\3323\206\025T\2508\324uT[u\261\222\031\304"
+	.ascii	"\341?5\005\356\316\251V\300I^\\\223\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`E\001\265\007"
+	.string	"\244\nA\002"
+	.string	""
+	.string	""
+	.string	"\002\020\177\034\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\200\202\035\177\035\005\034\016\201\204\001"
+	.string	""
+	.string	""
+	.string	"\005\021\013\200\003\002\036\177\036\005\022\037\002\037\177 \002!\177!\005 \020\"\177\"\005\027##\177$\002$\177%\002%\177&&\177''\177((\177)\005\031*\205\204\001"
+	.string	".pg_registry"
+	.string	""
+	.string	"\005\026+setdata"
+	.string	""
+	.string	"\005\024,\017-\201"
+	.string	"\005\016.\001*\177/\377\037"
+	.string	""
+	.string	"\200\200\200\001)\1770,\1771+\1772\003\001\027D\003\001\026\204\001\003\004\031\004\030\304\017\003\007\027"
+	.ascii	"  \260\002!\264\305\001\262~`L\242\273A@\032\206z\f\016\017\220"
+	.ascii	"\322-5\335\202\341\374\310\311W\n\343( \331\tl\033\322\356\347"
+	.ascii	"\376\334\346\227;i\":Hw\234\016\216;\0264!\240\244\r6\212\222"
+	.ascii	"\306\330?\035\255P\307"
+	.text
+	.section	.gnu.lto_.refs.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375 \211\375\002"
+	.string	"\222\310\026\035\240)\215\001\360\377\377\273\252\252\002{\307r\364\306\333f\247\271\006\267\225\204\310\275\223L\001\016\266\233\323\202r9\375dvq\245\342\312\304\251\341\264pe\223\024]y\022p~/\345\255\266\276\312\321\311\245\222K\310\372X\035\227\rS\206)\342\354\341\222`\0320\021#:\373\327j$"
+	.text
+	.section	.gnu.lto_.decls.2dfb37358f83656c,"e",@progbits
+	.string	"(\265/\375`{!\325\230"
+	.string	":\371\3006O \222\312I\007^<\357\212\034Z\355\241s]\032>t\013\266\025\313\234\347\311IQ\374\307pd\347\264\320\203L\334\215\255\305bfD\333\241j\034a\272j\201\003D\255\210\b@$X@D\314[\227p#\"\225\215\275y\261\353K6O\266\224)\336\002]\003m\003\374\307r\206t\226\300U\361*\023\007\316\017\037\024\274#\255\372\361\033\2062\034v\003'\t\234/\261\025+v\002\233\344\270c[\177nsF}f\031\313c\223Fg\311\344\252\353\354\312\3374\r\343\361\031\226\252}\340C\316\224\327\260\032\206r\032\346;\3671\032-\274\226\206\251"
+	.string	"N\207V\264\226#\227lU\371\362\210\240P\223\255f\206\200\244\334\314A[};\3273Z\336\335X\252\306bO\300L\357\275{\\\206\241\254\307d\324\364X\2526C\212\333\264\007*\b\2314\250\276y\254g5\3539\210\225\304\016\024.[G\356\306h\301\335=\273\304\261\234}\276\255Q\320\251\351\275O;\2262\224\3070\020\375\2747\372\202\307p\030\256\003R\n\335%\224\224\330\320\212u\312\203\nJP=\263\255<\307b\030J\202\351\324 \201\262\202\2569\334\313$\202\034\030\310$\202\347)+\377\300_\030\232\202\301\234\275p\227\353(\237\367y\3573\250\225"
+	.string	"\256A\311\326s\212\240\r\f\344\024\3013\330\332,\"(\304#\202?\303\245X\227]\330\316Z\375\231\313\317f|\306o\226I\305u\325\356}\206\340a\373\362Tk\325mh\025\023\342\334j\365<d\375\213+T\316\262\260\025 \341\275]kb\367\336\2423\033Sa+'\244\356\355\322\002@\031\215\222\363\273\367\266\261\026\336\302Pfc,g5^\273\372\274wy\357]\261b\305\220:d\032&\265\252\207a\275\224G\004}ZXOc\345'Wa\350\3438z\236\302h\027.\2377z\357\r\342\257/\311\257V\017\302\352c\364\247}\200\264{#x\210\225\206{\357\335\341\307\005\337+\n\036\021T\237<\"\270\262\210\340\205\177c9\317\337S\276\376=\326\177\207\235\377V\362\007\030\364w\017\177n"
+	.ascii	"\377\246\267\254\332\242(\374]\365?\357\277\336\3774W\363\263"
+	.ascii	"\0274\377\321\200\351\373?\364?\305\377\005\230\357?\n\034\304"
+	.ascii	"\023\370;\307\317S\006\220\272\325\321\035\350o\034\304\274\347"
+	.ascii	"\267,\376\217\371\017\304\317]\377\355o;\370\271\352\347\346"
+	.ascii	"\317V?\363\370\331\307\317;\314\375|\303\317T?O\205\371\377\363"
+	.ascii	"\333\025\376k\371\317\366\277\355;\177\317\360\263\334\317q?"
+	.ascii	"\277\375\214\366\263\223\237\303~V\362\263\327\317@~F\372\331"
+	.ascii	"\205\237Y\370y\205\237S\370\231\306\317&\374L\302\317\036\374"
+	.ascii	"\314\301\3173~\326\340g\f~\256\340\347\022?\273\370?\302\177"
+	.ascii	"3?\037\360\363\003?\023\375\334\342\277\333\317\r\374\314\300"
+	.ascii	"\317\n\374\217\376\214\300\317\005\374l\342\347\241\237\371\377"
+	.ascii	"\234\377p\376\263\371/\302\3775\377\357\376\333\375\347\362\377"
+	.ascii	"\355?\215\377/\376\317\375\027\n\f\f\f\374U\241?\310\342\037"
+	.ascii	"z \355&\344!\207w[\3556\266\262\302\355Aa\322jkQ}\020\203\246"
+	.ascii	"\257\325fk\345\032\375\001\026\325[\177\300\324\324\032\r\017"
+	.ascii	"Ll%\323\243\342\206\313\3723v\245\261\\\261\342\234\212\301\253"
+	.ascii	"\322e\312\312#\304\350\035\205v\264\303\204\246.3\335@\225\001"
+	.ascii	"\001b\314\324\326\372\263\366|vZ\240\330\217\335r\315L\225w\032"
+	.ascii	"g\271\316%l%\250GF$\310\\\177\366\2464\332*t\241\356\340\210"
+	.ascii	"\371H\221\001\031\323\206\241\215\246cG\306$\013\233\025(\214"
+	.ascii	"Q\223\265\223\367\223>{\322f|\233\367:/\200JM\257\323\251b\207"
+	.ascii	"\311\222\277\035R\336f\357\363\271\367D\343I\361\332\264\372"
+	.ascii	"6]\366_\330\343\365\204\222vYG\t\313\2633s\023\006\266y\022\327"
+	.ascii	"*\264\2410\226\240\334\224-;\273\365\347\340U6\357\275>t\236"
+	.ascii	"\267\t\345\023d\035f\025\377\017\333\253\367\336D\013\317\233"
+	.ascii	"\244+\302f\035sSb\241\270\327\2216\231\321\256d\006]V\313\256"
+	.ascii	"+f\264\353&\227L\222!\232\267+\311\214\336\033\342.\227\311\031"
+	.ascii	"\\7\0043z\255n\016;+\276\317\256\344]r\335\020wy\225(\230\313"
+	.ascii	".+fTi\025\202\031\355\262\272\321\256+t\227\312\246\324\3626"
+	.ascii	"C\334hW\232\033\345\262\022bF\271\254\230\321.,\226b\366\221"
+	.ascii	"Y\211)\342\025\306\\\230\313\313\243*K\331\024\2222\237\\\267"
+	.ascii	"\314\275\254\246\3436\017\2707\213\253YFy\305oPR\036PZ\224\\"
+	.ascii	"L\242\n\312\213\353.\245L2\256{\311\240p\334*\b\222O\351\375"
+	.ascii	"bi\262H\326\245\322qo\211\252{\223|\245\367\336\344\275w\247"
+	.ascii	"\231\365\274W\210\020S\254\252\352^\347P\325\315Jr\321qo\253"
+	.ascii	"\355\275Y1\243^\\E\\\256D\305n\3243\311b\267LWs\215&\253\\\252"
+	.ascii	"5\253\230\325\0175\335\304\352\315Yb\341\002\212s\327\343M\253"
+	.ascii	"\317g\317\333\220\265\035Zm&C:<\226\310\351D\365\022\235\275"
+	.ascii	"\260\25717\255\344j\032\327\217U\006\241sk\265{h$\f%\240\277"
+	.ascii	"l2\355\236\375\314)\233#\247"
+	.string	"o=\023\020\344@& \310Sg\3646r\206\266\221\306\342d\223\004#J8\372W\026'n\345\351b\364&r\2066\221\366\342dS\270\005\n\315\3646\235,z\240\326\300\366Z\355\256\241\037\251\227>%\332z\365km\255\036\302P\025\275%$\263FK\215k=\253\b\006\251\b\376\235\325XAc\334\354ai\265\205\364\324\016@\263V\257.W\036(\243\367\362\f\355e;U<o\262\347nk+\313\3576\233,\256\226Aj\310\264D\265z\373%j\313\364lJ\311\233T\330\033U\333\264\203t\263wh \335\243\1770\264}t\325;G\353\340\201\266e\312\274\033\030\2637\264\366\321;\356\006\264|\336%\030\264a\271\361[\261\"(\260\t\334\025Ro\243\254\267_\353\355\221\365\326k\275\345Zo\265\326[!\353\355\325\312'\254\324\332\312\356dC\275\225}\357\"\202\373,\357\331\275\317V\252\367*\231\r"
+	.string	"b6@'\016L\t\r\252\267P\201\177\302/I\264\324\375\361\025\266b\2534W,^Z\177\266JS\350\303+k\016\00324R\353{\224k\317\226\021\224C\261h\234v{04\314\251b\305\222%\013k\312-Z\032U\0308\255\3322{\366/RT"
+	.string	"\373\314l\207K\021$\312+\237?,5yVJWY\262.)\322Vm\224\273\201Ik\2336W]\217\2778}\253pjd\307\330:\201Z'v\214\237(\334\266\262\242 \363\256\326\324\255v\254y\346R\f\237bV,X\016\200k>\264z\333\244\223\274p\3573D\230\346V\253.\212n}\bF\361B\004N\253\302?#\013\3066\354w\021\001Cm\230\005\033\262"
+	.ascii	"M\316\3646\305\260`0*?\002\237k\263\005\013>\317|z\364P\302\325"
+	.ascii	"*\017\2305r\253\304\032\261@j\350\020\232\361*S\303,}\340\321"
+	.ascii	"\252\375\262I,\022\333\203=\302\303\265\362\214\331\253\333."
+	.ascii	"{e\275Jx\201\t\007e6\355\221\243'u\345\031\245\373\301\344\257"
+	.ascii	"U\273e\211\b\273P\335eq\361 \261\003s\322j\333!;g\315\345\232"
+	.ascii	"\226\005\024\323E*K\0073D\312Z\265X\253\016\036\253\024\302\275"
+	.ascii	"4>%\255\336b\375\226\007+\244\251\260\234h"
+	.string	"Z\375\224G\004\201\362\212n\235\035\24667\267\267\362\264\031q\0317\336\373\rC\033\317\002\261L\347\365\261\342N-\213\005\217\2276[\366Z\335\3419\264C\005\266\343\217n\375\213@\233|\242W\004\330r\316\314\274hv\234\376;3\345a\255\254\017\333\303\376`\250mZ\345\333\257\341|\3106{\016\313\261\024I\006g{|\326\264Pv\007K\235Bw\271\305\357\207H\324\332\226\217\332q\316w\002\212\351\001Z\237\335a\227v\212\245\316\347\365\321\323\226F\311\324\357\336'\225\255b\250\335\361!\022?r\364\374\320\202\352o\247\254\224\317\333\024VT\253\226\031\235\333Qd\311\372[\035\f\265QAQM"
+	.string	"\231\264js\234O*9\265\343q@\270\230\321}\255\027z\255\027\006\261w\305\233j\t\233\353\205T\353\205Q\353\327\300\277\226\023\r\303\246NN\222\276\243\243\202\222\2636\n\026\021\3545\335\246\335\374\302 )oG\330\326\254o6#$\001\202\255U\265\323\274\325\374\302\236\013\023\253\352[\337hz\372\013\201\3120Y\253Bf}\367\351\260\005\262\341\241\325\346[u\254`R\360hm\331j\276\277\363\272L\237ya"
+	.string	"\033\002\001\337\264\332{m\346}\246\365n\237\201\200\353^e\237\t\372\273W\031\304l"
+	.string	"\263\001\252\024\257\260,A\365k\227\365exD\360\207E\004Y\255\350MFD\260\351|^\265\236\272\037\246T\302\326\2369\251\264\357\352\266\262\242\340\375\031ic\367\276\013\262\371!\241k\265\3074X\221h_\324\220\325\347\316\315u]^\224`\020^\210\234\241{\327\375\004\221\352"
+	.string	"\323j\213\351$eW\276"
+	.ascii	"Ys\254>D\344\344\332,Ok++\212\272\367\225\267\324[}\240|\371"
+	.ascii	"\322is\304\200\246\320\256\334\301\255>mq"
+	.string	"\217k4v^\213\207f++\312uf\251`\351\331\034*h\253O\227.\355\245K\233\255\311{\223\317\333\203\255\200\331\312\362\263N\267\246\234#+\217\024\2437\027.=\306\367mu\203\252\t\227h1\221\264\372\235\345\352\243\227%K\273I\021\373\201\343#\253\312\226\007D\344\020I\203\210\034&9=\2258:1\r\225\220E\242\214&\024d\314\210q\034-\220\222\206DG#Q\006%c\022\211%b\2618\304!\003I\354\240\206%'\247\030!\216\243\305\215\242\222\021y$\"&=-!\025\225\210\214\307'\"\001\226\226\236\212\305\246\342\016\362(8C\223\021\007\262\251\270ccH\\R\221\304#\023\221)\310A\t!\2108&}\020T\002O#\213OM2d$\021\221\306&'\247\247c\211\243\002>D\016\223\220\304#\320\222\023\023\021\205\005\220\307\321\302\351\251\311x\203ih\034:\021!%\200T|\342"
+	.string	"I<\366\024m\264Q\347xt\303\311\007yT\274\341\244S\274\341d\2116(\035\325\343\221hLJ\032\356\030\221N6\211X\274\241\2644\334I\"\036\237\324b\223\022\022\211x\334\271\361\350\206S\213\037\343\020\007\222Z\203\021yT\272A<\001\001c\023\262I\204$bQ\251\006S\223\214\244\241\t\032\033\320\330 i8\200\001%\006H\032\022O`\"\"\2175\320 "
+	.string	"\307\221h\264A<A\251\370\201\214\0311\220\304#\361\204\020GR2\022\213\304\033\353!\200\341"
+	.string	"\f\th\330\271\004\024<@\301\003\301K@AQ\021\0050\212\326\303(\262H$\361(\351\003!\344\221\004;\001\2308\022\322\006Q\261\211\211\251\t\311\204\213\244>\036%\r\237bP\252\001\364@\215.\252\321.jt\321\260]\f\273(\251\215D\344\222\022\007\310\241\006JHI\303\237\245\246&\r\216tJ,\r\237\220F%\025N\034\217d\314\210!"
+	.string	"\222\003\341\361(\206\b&\210\310!\222\306\220\351\347xtC\311F\261I\206\214\0311h\f\021\227\206HG\035\344\021\214\"dQ\351iE\022\2176l4\005\221\307A\300\233\234\210F\"dS\223\221\250\2478\303\3208\003G\f\246\365xd$\"\211\""
+	.ascii	"\255\310#\027/\220E\245\235\273\030\032\275\200A4\222\240\205"
+	.ascii	"\210O0\201\f\024)\214\320\301\212\324\002Y$\032\215OHDGc\323"
+	.ascii	"\261H<\022\025\225\206LDH\306#Q\213\023\310#\0219\f\201xch$:"
+	.ascii	"1\r\201\246q=4\251\033\202FN\315\032=\264V\177\246dl\037\031"
+	.ascii	"\313\327\227\353^\261\035,^t\3233\267|\"h\351\020\322\252-c\315"
+	.ascii	"@\311\021\3464c\367\342\304\311\3214\363\023\244L\024M\217\311"
+	.ascii	"4\323+J\036[\t\366x\252\231\372X\255@^\326\316\342Y;\033\204"
+	.ascii	"\007<PY\232*~{w\033\004[\341Y#\005\327F\216\312\230\363\210\233"
+	.ascii	"1\355\3249\243\226\314\222Z4\365\212\235\2162 \332\313\006\316"
+	.ascii	"\321\372Qg\337\200\244T\002\277\350\306\256\256\\\225\211\351"
+	.ascii	"0(v\200ys^Ala\270\336\264\332#\365\345\213\225\013\266\371\200"
+	.ascii	"\346g\241.\23290\267rr;Sv\317\253N\242\343\345\346\214\333\226"
+	.ascii	"\225G\017\016\316\306\335\231\371\344M\371\362\274\334\306\271"
+	.ascii	"\3710\225m\246\264j\273\330\263 \2575\275 n\354dKY\226\263\265"
+	.ascii	"\307\354y\033}\3327K\306\347&\323n\217\035793!~\227\351T\321"
+	.ascii	"SeG\2251l\267o\267n.\"8\337\032\345\t\031e\253v\313m\233\223"
+	.ascii	"\016n\252\305\266\215\031\211B\321Z\357@Z\020+\253Vm\226\363"
+	.ascii	"\235\214\217*M\253v\355q>\316<\277\036\254\332\353\274\356\240"
+	.ascii	"Z\265V\354\025\206~\316b9\020\\\324\332\\\220\365:\360\347\202"
+	.ascii	"6\355\026\n7\304H\027\217*Y\310`\211\265\372\236\202\234\250"
+	.ascii	"\202\3014\b\363\0242\b\241\231\221\031I\222tB\n\022\n\345\221"
+	.ascii	"\"\250>\022@%1\317)\306\230\252\221$\005\205B\007\023\025\200"
+	.ascii	"Q\222\n\222\32489#\321\347\256(\204\221\300e\020\201\346\340"
+	.ascii	"<\344e]n\026\025A\244D<\207x\313\321\205"
+	.string	"\216\357\f\2024\252D\215\033\254\353A\352j\352$\025\\{\201\242\223\307R\221\313}\243\bWf\325\336}c\004\236@I\360\f \372@\323h\b\335\001lz\300\212\235\307!\213h\322\033\204\200D\372\263\226\013\304@t\245\003_e\256]EL\001\246\372\370\213E\260\334\362\327\205\325\303\021\210\b\354\351\033\377D\215\013\260aA|\336Div\371[)A\353x\314\032\3264k\211\020\236?\001\211\323\347\236ZqdC\362kt\037\361\201\t\006\355iZ\365\027\216t\275&\206\3355\360r\004\274y\016\272\314\033\302z\247\202E\240\220\344\220\350\036I\241\3676\343\311\205Y\254`\277\255\347/%\271eF4%\271f\321xu\373\3568\2461\342#(Y\200\223d\265\001\335\366@\361\360m\231Sb\340\342\226q\342\035\240J\310\325C\201\222B\313w8\023s\340\373\315\331\365\271\253_\037\256\016\316\253\226\006\355"
+	.ascii	"\034\303\265p\025\220\317&\376\323\314;\273\327\021\325U\tTb"
+	.ascii	"\\\206Ee\241[\017\271)W\005\bl\354\351N\006\240\257\3747{\177"
+	.ascii	"\361\364\321\275\231\243\351\201HCq\033\361\343\257\026\rp\261"
+	.ascii	"B\264\203&hh*\317\236\022\350\241\021\210\251\\}\331\346\232"
+	.ascii	"\250\006\356F\225\301W\226|v\336\027\366\311\037\240P\206\\\242"
+	.ascii	"\001\200\002\0024D1\334\374\221\203\024\354\2748\237\305IZ\213"
+	.ascii	"&\226\346\214J\226\037@4\210(\330<\255\020y\217\213\341\311\254"
+	.ascii	"\241"
+	.ascii	"\266\3131.\224J\247\224\205\276y\3172p\222-\276\201\344RM\363"
+	.ascii	"\204|\246WW\261s-\0359\236\032\2405\233\017]],\036Ayv\320\270"
+	.ascii	"L\332z\324#\335\202\253\373*\346b\214\304MI\200_\315n\363\352"
+	.ascii	"\r>\336\025\212D\r\260#\345\250\353\031\2043\361\347\364\251"
+	.ascii	"\217\250\234Wg\241\373\240\365\234\026"
+	.string	"\260i}Q\221\"\225\355\244\234dDW^$\311eZ\353.$\"\222\314\252\373\252J\305\240\252z)\226e\216\223pw]T\310\026\230\005\n%\016\202I\021*qI\001\"7\211=E\\7\221\3129\364\326\301@r\022\370\372H\203nAi\330w\025\342V\301K\237T\326\314\340\037\345N\353\264\001\"bKX\303\001t\347\317ZV\007\274\214W4T\365=\333\0353K/V6X\2769\226\217&U\275\261\216SoDe\364C#\023\200\315\275v\340-q\013'MhGW\375Y=\036v\204\205\217\277\250f\b\206\203R\372h\352c\274\022]\007f\357e\332=\372YZ\342\215$\236b\364y!\241} \252\210\244\361\377v[f\f\275\261\254I\3630\261\345\001\333\234!i7\202\355\344\025\232\257\216\370\223\271zr\274\241v\336\221lHC\221Yb\304\240CW\214!\364B\354\002\005\275X\331\351"
+	.string	",C\003\243\035\025\201h\261\030\340t\220_\362\354+9\262\252\033xt\366Y\2549A\316W\177\300\364\006\3110\220\fY]\303\354\236\303\265\022\363j\234\347\326I\373\240q\262\343|`\226\342\t\"<\006.\372\243\245\3112\201D3\272\317Y\333$H1W\255\253\004\363<\200\326\327\201\355\006o@\r\206t4V4\215Lu\004\r\t\265\276g\013\216\346L\353y\263\332\276=\252\242\267\233\202\201\222|\342hD\013\375$98\315\342%\001ZC\2419$#\223m\226\267\350\343\315\340)]BE\306~\372a\265u\322\377\035\227\274\r\007\300\273@\2249`i\324#r\0231\005\355mu\003\331\277\354a\341\031\017\203n\006\334\222\252\361]VQH\331\243\376!\377\027|\214\355\363\330Y\315\353_o\307\260\341\030/\003\327F\202EX"
+	.string	"\257\300\205\rB\271\377V\013\246?|\357n\320M#5\340)\327\342fR\r\302q\311\013\347\303\020!\017f\212\205q\317t\340\025N\220HZF\265\362\331#\240\255\037T\242\032\343$(\227\030g4\367j\232\332+Q\205\217\341\320U\205\033B\357\245\321p\373p)`\2018\003\016c\214P\235\301\213\354\233o\021\215=\215_\212$XG\353\021\264\217\217j\005\237\333\002\260\250\341\251\224|\032?F\247u|\310\264|!)\301\244\370\261?\333\360\247\001\237\215oy.\306N\274\306]\247_\307\033\002ywr\350\311\242\203l\033\234\364\024.\356\363\017\273\262\262\303\357+\320\300\274O\224\227\305CE'\205\017\004c\263\307\315?\033\365\2665wx}\r\215\220\217X\336T\366\2202\022\3320n\031wJ\366\275l\034\361I\330\233(\323M\301 \3705R|\321\370\367&"
+	.ascii	"ca-\236W\371\261D\314n\362\216\347\025\356\036\271~ItU\315\265"
+	.ascii	"\307#pd\260\271\347gL\037\203n~\256.\035\033fAM\222\247G\274"
+	.ascii	",\301q\351\251N\322i~B\2756>\367\351\324\264\002"
+	.text
+	.section	.gnu.lto_.symtab.2dfb37358f83656c,"e",@progbits
+	.string	"currentMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"currentMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"currentMeterADCState"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"currentMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"currentSensorADCConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"currentMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"currentMeterVirtualInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.string	"currentMeterVirtualState"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"currentMeterVirtualRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"currentMeterVirtualRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"currentMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"currentMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"currentMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"currentMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"currentMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"currentSensorVirtualConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"pgResetTemplate_currentSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"currentSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"supportedCurrentMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"currentMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2dfb37358f83656c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,20352 @@
+	.file	"gyro.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/build/debug.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/scheduler/scheduler.h"
+	.file 8 "./src/main/build/profile.h"
+	.file 9 "./src/main/common/axis.h"
+	.file 10 "./src/main/common/maths.h"
+	.file 11 "./src/main/common/filter.h"
+	.file 12 "./src/main/config/parameter_group.h"
+	.file 13 "./src/main/drivers/io_types.h"
+	.file 14 "./src/main/drivers/exti.h"
+	.file 15 "./src/main/drivers/sensor.h"
+	.file 16 "./src/main/drivers/accgyro.h"
+	.file 17 "./src/main/drivers/accgyro_mpu.h"
+	.file 18 "./src/main/drivers/resource.h"
+	.file 19 "./src/main/io/beeper.h"
+	.file 20 "./src/main/sensors/gyro.h"
+	.file 21 "./src/main/sensors/sensors.h"
+	.file 22 "./src/main/sensors/gyro.c"
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 24 "./src/main/sensors/boardalignment.h"
+	.file 25 "./src/main/fc/runtime_config.h"
+	.file 26 "./src/main/drivers/accgyro_fake.h"
+	.file 27 "./src/main/drivers/gyro_sync.h"
+	.file 28 "/usr/include/string.h"
+	.file 29 "./src/main/drivers/system.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	gyro.c.9169376d
+	.weak	gyro.c.9169376d
+gyro.c.9169376d:
+	.long	0x13cf
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x24
+	.long	.LASF2915
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2527
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2528
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2529
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2530
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2531
+	.uleb128 0x4
+	.long	.LASF2532
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF2533
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2534
+	.uleb128 0x4
+	.long	.LASF2535
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF2536
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF2537
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2538
+	.uleb128 0x26
+	.byte	0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2539
+	.uleb128 0x4
+	.long	.LASF2540
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x4
+	.long	.LASF2541
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF2542
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xc
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF2543
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF2544
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x1e
+	.long	0xd4
+	.uleb128 0xc
+	.long	0xd4
+	.uleb128 0x4
+	.long	.LASF2545
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2546
+	.uleb128 0xc
+	.long	0xf6
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2547
+	.uleb128 0xf
+	.long	0x9f
+	.long	0x119
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2548
+	.byte	0x5
+	.byte	0x15
+	.byte	0x10
+	.long	0x109
+	.uleb128 0x11
+	.long	.LASF2549
+	.byte	0x5
+	.byte	0x16
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x5
+	.byte	0x30
+	.long	0x1c7
+	.uleb128 0x1
+	.long	.LASF2550
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2551
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2552
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2553
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2554
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2555
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2556
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2557
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2558
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2559
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2560
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2561
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2562
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2563
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2564
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2565
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2566
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2567
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2568
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2569
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2570
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2571
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2572
+	.byte	0x16
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2573
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0xd4
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2574
+	.uleb128 0x1e
+	.long	0x1d3
+	.uleb128 0xc
+	.long	0x1d3
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x7
+	.byte	0x3c
+	.long	0x25c
+	.uleb128 0x1
+	.long	.LASF2575
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2576
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2577
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2578
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2579
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2581
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2582
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2583
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2584
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2585
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2586
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2587
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2588
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2589
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2590
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2591
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2592
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2593
+	.byte	0x7
+	.byte	0x8b
+	.byte	0x3
+	.long	0x1e4
+	.uleb128 0x14
+	.long	0x273
+	.uleb128 0x2
+	.long	0x1c7
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x8
+	.byte	0x25
+	.long	0x2af
+	.uleb128 0x1
+	.long	.LASF2594
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2595
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2596
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2597
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2598
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2600
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2601
+	.byte	0x15
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x9
+	.byte	0x14
+	.long	0x2c7
+	.uleb128 0x19
+	.string	"X"
+	.byte	0
+	.uleb128 0x19
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x19
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2607
+	.byte	0x14
+	.byte	0xa
+	.byte	0x31
+	.byte	0x10
+	.long	0x316
+	.uleb128 0x3
+	.long	.LASF2602
+	.byte	0xa
+	.byte	0x33
+	.byte	0xb
+	.long	0xf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2603
+	.byte	0xa
+	.byte	0x33
+	.byte	0x13
+	.long	0xf6
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2604
+	.byte	0xa
+	.byte	0x33
+	.byte	0x1b
+	.long	0xf6
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2605
+	.byte	0xa
+	.byte	0x33
+	.byte	0x23
+	.long	0xf6
+	.byte	0xc
+	.uleb128 0x7
+	.string	"m_n"
+	.byte	0xa
+	.byte	0x34
+	.byte	0x9
+	.long	0x7c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2606
+	.byte	0xa
+	.byte	0x35
+	.byte	0x3
+	.long	0x2c7
+	.uleb128 0xf
+	.long	0xf6
+	.long	0x332
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2608
+	.byte	0x10
+	.byte	0xb
+	.byte	0x2a
+	.byte	0x10
+	.long	0x358
+	.uleb128 0x3
+	.long	.LASF2609
+	.byte	0xb
+	.byte	0x2b
+	.byte	0xb
+	.long	0x322
+	.byte	0
+	.uleb128 0x7
+	.string	"k"
+	.byte	0xb
+	.byte	0x2c
+	.byte	0xb
+	.long	0xf6
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2610
+	.byte	0xb
+	.byte	0x2d
+	.byte	0x3
+	.long	0x332
+	.uleb128 0xa
+	.long	.LASF2611
+	.byte	0x54
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x10
+	.long	0x3c6
+	.uleb128 0x7
+	.string	"b0"
+	.byte	0xb
+	.byte	0x30
+	.byte	0xb
+	.long	0x322
+	.byte	0
+	.uleb128 0x7
+	.string	"b1"
+	.byte	0xb
+	.byte	0x30
+	.byte	0x12
+	.long	0x322
+	.byte	0xc
+	.uleb128 0x7
+	.string	"b2"
+	.byte	0xb
+	.byte	0x30
+	.byte	0x19
+	.long	0x322
+	.byte	0x18
+	.uleb128 0x7
+	.string	"a1"
+	.byte	0xb
+	.byte	0x30
+	.byte	0x20
+	.long	0x322
+	.byte	0x24
+	.uleb128 0x7
+	.string	"a2"
+	.byte	0xb
+	.byte	0x30
+	.byte	0x27
+	.long	0x322
+	.byte	0x30
+	.uleb128 0x7
+	.string	"d1"
+	.byte	0xb
+	.byte	0x31
+	.byte	0xb
+	.long	0x322
+	.byte	0x3c
+	.uleb128 0x7
+	.string	"d2"
+	.byte	0xb
+	.byte	0x31
+	.byte	0x12
+	.long	0x322
+	.byte	0x48
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2612
+	.byte	0xb
+	.byte	0x32
+	.byte	0x3
+	.long	0x364
+	.uleb128 0x27
+	.long	.LASF2613
+	.value	0x1f0
+	.byte	0xb
+	.byte	0x34
+	.byte	0x10
+	.long	0x422
+	.uleb128 0x3
+	.long	.LASF2614
+	.byte	0xb
+	.byte	0x35
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2615
+	.byte	0xb
+	.byte	0x36
+	.byte	0x9
+	.long	0x7c
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2616
+	.byte	0xb
+	.byte	0x37
+	.byte	0x9
+	.long	0x7c
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2617
+	.byte	0xb
+	.byte	0x38
+	.byte	0xb
+	.long	0xf6
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF2609
+	.byte	0xb
+	.byte	0x39
+	.byte	0xb
+	.long	0x422
+	.byte	0x10
+	.byte	0
+	.uleb128 0xf
+	.long	0xf6
+	.long	0x432
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x77
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2618
+	.byte	0xb
+	.byte	0x3a
+	.byte	0x3
+	.long	0x3d2
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xb
+	.byte	0x3c
+	.long	0x45c
+	.uleb128 0x1
+	.long	.LASF2619
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2620
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2621
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xb
+	.byte	0x42
+	.long	0x474
+	.uleb128 0x1
+	.long	.LASF2622
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2623
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2624
+	.byte	0xb
+	.byte	0x45
+	.byte	0x3
+	.long	0x45c
+	.uleb128 0x5
+	.long	0xf6
+	.uleb128 0x4
+	.long	.LASF2625
+	.byte	0xb
+	.byte	0x52
+	.byte	0x10
+	.long	0x491
+	.uleb128 0x5
+	.long	0x496
+	.uleb128 0x14
+	.long	0x4a6
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x480
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2626
+	.byte	0xc
+	.byte	0x19
+	.byte	0x12
+	.long	0xc8
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xc
+	.byte	0x21
+	.long	0x4e0
+	.uleb128 0x17
+	.long	.LASF2627
+	.value	0xfff
+	.uleb128 0x17
+	.long	.LASF2628
+	.value	0xf000
+	.uleb128 0x17
+	.long	.LASF2629
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2630
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2631
+	.value	0x8000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2632
+	.byte	0xc
+	.byte	0x2e
+	.byte	0xf
+	.long	0x4ec
+	.uleb128 0x14
+	.long	0x4fc
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x7c
+	.byte	0
+	.uleb128 0x28
+	.byte	0x8
+	.byte	0xc
+	.byte	0x35
+	.byte	0x5
+	.long	0x51d
+	.uleb128 0x1a
+	.string	"ptr"
+	.byte	0xc
+	.byte	0x36
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x1a
+	.string	"fn"
+	.byte	0xc
+	.byte	0x37
+	.byte	0x16
+	.long	0x51d
+	.byte	0
+	.uleb128 0x5
+	.long	0x4e0
+	.uleb128 0xa
+	.long	.LASF2633
+	.byte	0x20
+	.byte	0xc
+	.byte	0x30
+	.byte	0x10
+	.long	0x571
+	.uleb128 0x7
+	.string	"pgn"
+	.byte	0xc
+	.byte	0x31
+	.byte	0xb
+	.long	0x4a6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2634
+	.byte	0xc
+	.byte	0x32
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF2635
+	.byte	0xc
+	.byte	0x33
+	.byte	0xe
+	.long	0x571
+	.byte	0x8
+	.uleb128 0x7
+	.string	"ptr"
+	.byte	0xc
+	.byte	0x34
+	.byte	0xf
+	.long	0x576
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2636
+	.byte	0xc
+	.byte	0x38
+	.byte	0x7
+	.long	0x4fc
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x5
+	.long	0x571
+	.uleb128 0x4
+	.long	.LASF2637
+	.byte	0xc
+	.byte	0x39
+	.byte	0x3
+	.long	0x522
+	.uleb128 0xc
+	.long	0x57b
+	.uleb128 0x4
+	.long	.LASF2638
+	.byte	0xd
+	.byte	0x18
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF2639
+	.byte	0xd
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0xa
+	.long	.LASF2640
+	.byte	0x1
+	.byte	0xe
+	.byte	0x1a
+	.byte	0x10
+	.long	0x5bf
+	.uleb128 0x7
+	.string	"tag"
+	.byte	0xe
+	.byte	0x1b
+	.byte	0xd
+	.long	0x58c
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2641
+	.byte	0xe
+	.byte	0x1c
+	.byte	0x3
+	.long	0x5a4
+	.uleb128 0xc
+	.long	0x5bf
+	.uleb128 0x4
+	.long	.LASF2642
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x22
+	.long	0x5dc
+	.uleb128 0xa
+	.long	.LASF2643
+	.byte	0x8
+	.byte	0xe
+	.byte	0x21
+	.byte	0x8
+	.long	0x5f6
+	.uleb128 0x7
+	.string	"fn"
+	.byte	0xe
+	.byte	0x22
+	.byte	0x1a
+	.long	0x612
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2644
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xe
+	.long	0x602
+	.uleb128 0x14
+	.long	0x60d
+	.uleb128 0x2
+	.long	0x60d
+	.byte	0
+	.uleb128 0x5
+	.long	0x5d0
+	.uleb128 0x5
+	.long	0x5f6
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xf
+	.byte	0x19
+	.long	0x659
+	.uleb128 0x1
+	.long	.LASF2645
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2646
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2647
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2648
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2649
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2650
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2651
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2652
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2653
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2654
+	.byte	0xf
+	.byte	0x23
+	.byte	0x3
+	.long	0x617
+	.uleb128 0xa
+	.long	.LASF2655
+	.byte	0x8
+	.byte	0xf
+	.byte	0x26
+	.byte	0xc
+	.long	0x680
+	.uleb128 0x3
+	.long	.LASF2656
+	.byte	0xf
+	.byte	0x27
+	.byte	0xe
+	.long	0x598
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2657
+	.byte	0x8
+	.byte	0xf
+	.byte	0x25
+	.byte	0xf
+	.long	0x69a
+	.uleb128 0x1a
+	.string	"spi"
+	.byte	0xf
+	.byte	0x28
+	.byte	0x7
+	.long	0x665
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2657
+	.byte	0xf
+	.byte	0x29
+	.byte	0x3
+	.long	0x680
+	.uleb128 0xc
+	.long	0x69a
+	.uleb128 0x5
+	.long	0x9f
+	.uleb128 0x4
+	.long	.LASF2658
+	.byte	0xf
+	.byte	0x32
+	.byte	0x10
+	.long	0x6bc
+	.uleb128 0x5
+	.long	0x6c1
+	.uleb128 0x14
+	.long	0x6cc
+	.uleb128 0x2
+	.long	0x6cc
+	.byte	0
+	.uleb128 0x5
+	.long	0x6d1
+	.uleb128 0xa
+	.long	.LASF2659
+	.byte	0xb0
+	.byte	0x10
+	.byte	0x2d
+	.byte	0x10
+	.long	0x7e3
+	.uleb128 0x3
+	.long	.LASF2660
+	.byte	0x10
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x6b0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2661
+	.byte	0x10
+	.byte	0x2f
+	.byte	0x1b
+	.long	0x7e3
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2662
+	.byte	0x10
+	.byte	0x30
+	.byte	0x1f
+	.long	0x80f
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2663
+	.byte	0x10
+	.byte	0x31
+	.byte	0x26
+	.long	0x834
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF2664
+	.byte	0x10
+	.byte	0x32
+	.byte	0x1d
+	.long	0x803
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF2665
+	.byte	0x10
+	.byte	0x33
+	.byte	0x17
+	.long	0x5d0
+	.byte	0x28
+	.uleb128 0x7
+	.string	"bus"
+	.byte	0x10
+	.byte	0x34
+	.byte	0x11
+	.long	0x69a
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF2666
+	.byte	0x10
+	.byte	0x35
+	.byte	0xb
+	.long	0xf6
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF2667
+	.byte	0x10
+	.byte	0x36
+	.byte	0xd
+	.long	0xa0a
+	.byte	0x3c
+	.uleb128 0x3
+	.long	.LASF2668
+	.byte	0x10
+	.byte	0x37
+	.byte	0xd
+	.long	0xa1a
+	.byte	0x44
+	.uleb128 0x3
+	.long	.LASF2669
+	.byte	0x10
+	.byte	0x38
+	.byte	0xd
+	.long	0xa1a
+	.byte	0x50
+	.uleb128 0x7
+	.string	"lpf"
+	.byte	0x10
+	.byte	0x39
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5c
+	.uleb128 0x3
+	.long	.LASF2670
+	.byte	0x10
+	.byte	0x3a
+	.byte	0x13
+	.long	0x9fe
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF2671
+	.byte	0x10
+	.byte	0x3b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x64
+	.uleb128 0x3
+	.long	.LASF2672
+	.byte	0x10
+	.byte	0x3c
+	.byte	0x12
+	.long	0x1da
+	.byte	0x65
+	.uleb128 0x3
+	.long	.LASF2673
+	.byte	0x10
+	.byte	0x3d
+	.byte	0x17
+	.long	0xe0
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF2674
+	.byte	0x10
+	.byte	0x3e
+	.byte	0x14
+	.long	0x659
+	.byte	0x6c
+	.uleb128 0x3
+	.long	.LASF2675
+	.byte	0x10
+	.byte	0x3f
+	.byte	0x1a
+	.long	0x9c9
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF2676
+	.byte	0x10
+	.byte	0x40
+	.byte	0x19
+	.long	0xa2a
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF2677
+	.byte	0x10
+	.byte	0x41
+	.byte	0x18
+	.long	0x90c
+	.byte	0x80
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2678
+	.byte	0xf
+	.byte	0x33
+	.byte	0xf
+	.long	0x7ef
+	.uleb128 0x5
+	.long	0x7f4
+	.uleb128 0x18
+	.long	0x1d3
+	.long	0x803
+	.uleb128 0x2
+	.long	0x6cc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2679
+	.byte	0xf
+	.byte	0x34
+	.byte	0xf
+	.long	0x7ef
+	.uleb128 0x4
+	.long	.LASF2680
+	.byte	0xf
+	.byte	0x35
+	.byte	0xf
+	.long	0x81b
+	.uleb128 0x5
+	.long	0x820
+	.uleb128 0x18
+	.long	0x1d3
+	.long	0x834
+	.uleb128 0x2
+	.long	0x6cc
+	.uleb128 0x2
+	.long	0x6ab
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2681
+	.byte	0xf
+	.byte	0x36
+	.byte	0xf
+	.long	0x7ef
+	.uleb128 0x4
+	.long	.LASF2682
+	.byte	0x11
+	.byte	0x7f
+	.byte	0xf
+	.long	0x84c
+	.uleb128 0x5
+	.long	0x851
+	.uleb128 0x18
+	.long	0x1d3
+	.long	0x86f
+	.uleb128 0x2
+	.long	0x86f
+	.uleb128 0x2
+	.long	0xb7
+	.uleb128 0x2
+	.long	0xb7
+	.uleb128 0x2
+	.long	0x571
+	.byte	0
+	.uleb128 0x5
+	.long	0x6a6
+	.uleb128 0x4
+	.long	.LASF2683
+	.byte	0x11
+	.byte	0x80
+	.byte	0xf
+	.long	0x880
+	.uleb128 0x5
+	.long	0x885
+	.uleb128 0x18
+	.long	0x1d3
+	.long	0x89e
+	.uleb128 0x2
+	.long	0x86f
+	.uleb128 0x2
+	.long	0xb7
+	.uleb128 0x2
+	.long	0xb7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2684
+	.byte	0x11
+	.byte	0x81
+	.byte	0xf
+	.long	0x8aa
+	.uleb128 0x5
+	.long	0x8af
+	.uleb128 0x2a
+	.uleb128 0xa
+	.long	.LASF2685
+	.byte	0x30
+	.byte	0x11
+	.byte	0x85
+	.byte	0x10
+	.long	0x90c
+	.uleb128 0x3
+	.long	.LASF2686
+	.byte	0x11
+	.byte	0x86
+	.byte	0x1a
+	.long	0x840
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2687
+	.byte	0x11
+	.byte	0x87
+	.byte	0x1b
+	.long	0x874
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2688
+	.byte	0x11
+	.byte	0x88
+	.byte	0x1a
+	.long	0x840
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2689
+	.byte	0x11
+	.byte	0x89
+	.byte	0x1b
+	.long	0x874
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF2690
+	.byte	0x11
+	.byte	0x8a
+	.byte	0x13
+	.long	0x89e
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF2691
+	.byte	0x11
+	.byte	0x8b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2692
+	.byte	0x11
+	.byte	0x8c
+	.byte	0x3
+	.long	0x8b0
+	.uleb128 0xc
+	.long	0x90c
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x11
+	.byte	0xaa
+	.long	0x971
+	.uleb128 0x1
+	.long	.LASF2693
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2694
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2695
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2696
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2697
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2698
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2699
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2700
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2701
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2702
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2703
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2704
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2705
+	.byte	0x11
+	.byte	0xb7
+	.byte	0x3
+	.long	0x91d
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x11
+	.byte	0xb9
+	.long	0x995
+	.uleb128 0x1
+	.long	.LASF2706
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2707
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2708
+	.byte	0x11
+	.byte	0xbc
+	.byte	0x3
+	.long	0x97d
+	.uleb128 0xa
+	.long	.LASF2709
+	.byte	0x8
+	.byte	0x11
+	.byte	0xbe
+	.byte	0x10
+	.long	0x9c9
+	.uleb128 0x3
+	.long	.LASF2710
+	.byte	0x11
+	.byte	0xbf
+	.byte	0x11
+	.long	0x971
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2711
+	.byte	0x11
+	.byte	0xc0
+	.byte	0x19
+	.long	0x995
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2712
+	.byte	0x11
+	.byte	0xc1
+	.byte	0x3
+	.long	0x9a1
+	.uleb128 0xc
+	.long	0x9c9
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x10
+	.byte	0x26
+	.long	0x9fe
+	.uleb128 0x1
+	.long	.LASF2713
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2714
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2715
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2716
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2717
+	.byte	0x10
+	.byte	0x2b
+	.byte	0x3
+	.long	0x9da
+	.uleb128 0xf
+	.long	0x9f
+	.long	0xa1a
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xf
+	.long	0xab
+	.long	0xa2a
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	0x5cb
+	.uleb128 0x4
+	.long	.LASF2718
+	.byte	0x10
+	.byte	0x42
+	.byte	0x3
+	.long	0x6d1
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x12
+	.byte	0x14
+	.long	0xb61
+	.uleb128 0x1
+	.long	.LASF2719
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2720
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2721
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2722
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2723
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2724
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2725
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2726
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2727
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2728
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2729
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2730
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2731
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2732
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2733
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2734
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2735
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2736
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2737
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2738
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2739
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2740
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2741
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2742
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2743
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2744
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2745
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2746
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2747
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2748
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2749
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2750
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2751
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2752
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2753
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2754
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2755
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2756
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2757
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2758
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2759
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2760
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2761
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2762
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2763
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2764
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2765
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x13
+	.byte	0x17
+	.long	0xbf1
+	.uleb128 0x1
+	.long	.LASF2766
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2767
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2768
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2769
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2770
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2771
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2772
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2773
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2774
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2775
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2776
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2777
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2778
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2779
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2780
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2781
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2782
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2783
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2784
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2785
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2786
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2787
+	.byte	0x15
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2788
+	.byte	0x13
+	.byte	0x31
+	.byte	0x3
+	.long	0xb61
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x14
+	.byte	0x1a
+	.long	0xc63
+	.uleb128 0x1
+	.long	.LASF2789
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2790
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2791
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2792
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2793
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2794
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2795
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2796
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2797
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2798
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2799
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2800
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2801
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2802
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2803
+	.byte	0xe
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2804
+	.byte	0x14
+	.byte	0x2a
+	.byte	0x3
+	.long	0xbfd
+	.uleb128 0xc
+	.long	0xc63
+	.uleb128 0xa
+	.long	.LASF2805
+	.byte	0x10
+	.byte	0x14
+	.byte	0x2c
+	.byte	0x10
+	.long	0xc9c
+	.uleb128 0x3
+	.long	.LASF2806
+	.byte	0x14
+	.byte	0x2d
+	.byte	0xe
+	.long	0xd4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2807
+	.byte	0x14
+	.byte	0x2e
+	.byte	0xb
+	.long	0x322
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2808
+	.byte	0x14
+	.byte	0x2f
+	.byte	0x3
+	.long	0xc74
+	.uleb128 0x11
+	.long	.LASF2809
+	.byte	0x14
+	.byte	0x31
+	.byte	0xf
+	.long	0xc9c
+	.uleb128 0xa
+	.long	.LASF2810
+	.byte	0x1c
+	.byte	0x14
+	.byte	0x33
+	.byte	0x10
+	.long	0xd92
+	.uleb128 0x3
+	.long	.LASF2811
+	.byte	0x14
+	.byte	0x34
+	.byte	0x14
+	.long	0x659
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2812
+	.byte	0x14
+	.byte	0x35
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2813
+	.byte	0x14
+	.byte	0x36
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF2814
+	.byte	0x14
+	.byte	0x37
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF2815
+	.byte	0x14
+	.byte	0x38
+	.byte	0xd
+	.long	0xb7
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF2816
+	.byte	0x14
+	.byte	0x39
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2817
+	.byte	0x14
+	.byte	0x3a
+	.byte	0xd
+	.long	0x1d3
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF2818
+	.byte	0x14
+	.byte	0x3b
+	.byte	0xd
+	.long	0x1d3
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF2819
+	.byte	0x14
+	.byte	0x3c
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.uleb128 0x3
+	.long	.LASF2820
+	.byte	0x14
+	.byte	0x3d
+	.byte	0xe
+	.long	0xc8
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF2821
+	.byte	0x14
+	.byte	0x3e
+	.byte	0xe
+	.long	0xc8
+	.byte	0xe
+	.uleb128 0x3
+	.long	.LASF2822
+	.byte	0x14
+	.byte	0x3f
+	.byte	0xe
+	.long	0xc8
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2823
+	.byte	0x14
+	.byte	0x40
+	.byte	0xe
+	.long	0xc8
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF2824
+	.byte	0x14
+	.byte	0x41
+	.byte	0xd
+	.long	0x1d3
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF2825
+	.byte	0x14
+	.byte	0x42
+	.byte	0xe
+	.long	0xc8
+	.byte	0x16
+	.uleb128 0x3
+	.long	.LASF2826
+	.byte	0x14
+	.byte	0x43
+	.byte	0xe
+	.long	0xc8
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2827
+	.byte	0x14
+	.byte	0x44
+	.byte	0x3
+	.long	0xcb4
+	.uleb128 0xc
+	.long	0xd92
+	.uleb128 0x11
+	.long	.LASF2828
+	.byte	0x14
+	.byte	0x46
+	.byte	0x15
+	.long	0xd92
+	.uleb128 0x4
+	.long	.LASF2829
+	.byte	0x14
+	.byte	0x4b
+	.byte	0xe
+	.long	0x268
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x15
+	.byte	0x14
+	.long	0xde5
+	.uleb128 0x1
+	.long	.LASF2830
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2831
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2832
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2833
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2834
+	.byte	0x4
+	.byte	0
+	.uleb128 0xf
+	.long	0xb7
+	.long	0xdf5
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2835
+	.byte	0x15
+	.byte	0x1c
+	.byte	0x10
+	.long	0xde5
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x15
+	.byte	0x2d
+	.long	0xe37
+	.uleb128 0x1
+	.long	.LASF2836
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2837
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2838
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2839
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2840
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2841
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2842
+	.byte	0x40
+	.byte	0
+	.uleb128 0x1f
+	.long	0xca8
+	.byte	0x4b
+	.byte	0x8
+	.uleb128 0xe
+	.long	.LASF2843
+	.byte	0x4d
+	.byte	0x12
+	.long	0xa2f
+	.uleb128 0xe
+	.long	.LASF2844
+	.byte	0x4e
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0xe
+	.long	.LASF2845
+	.byte	0x53
+	.byte	0x11
+	.long	0xc8
+	.uleb128 0xe
+	.long	.LASF2846
+	.byte	0x56
+	.byte	0x1a
+	.long	0x485
+	.uleb128 0xe
+	.long	.LASF2847
+	.byte	0x57
+	.byte	0xe
+	.long	0x96
+	.uleb128 0xe
+	.long	.LASF2848
+	.byte	0x58
+	.byte	0x1a
+	.long	0x485
+	.uleb128 0xe
+	.long	.LASF2849
+	.byte	0x59
+	.byte	0x18
+	.long	0x3c6
+	.uleb128 0xe
+	.long	.LASF2850
+	.byte	0x5a
+	.byte	0x1a
+	.long	0x485
+	.uleb128 0xe
+	.long	.LASF2851
+	.byte	0x5b
+	.byte	0x18
+	.long	0x3c6
+	.uleb128 0x11
+	.long	.LASF2852
+	.byte	0x16
+	.byte	0x70
+	.byte	0x1b
+	.long	0xd9e
+	.uleb128 0x1f
+	.long	0xda3
+	.byte	0x70
+	.byte	0x44
+	.uleb128 0x11
+	.long	.LASF2853
+	.byte	0x16
+	.byte	0x70
+	.byte	0x71
+	.long	0x587
+	.uleb128 0x2b
+	.long	0xeb4
+	.byte	0x99
+	.uleb128 0x2c
+	.long	0xea1
+	.byte	0x72
+	.byte	0x14
+	.uleb128 0x9
+	.long	.LASF2854
+	.byte	0x13
+	.byte	0x3b
+	.long	0xede
+	.uleb128 0x2
+	.long	0xbf1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2855
+	.byte	0x7
+	.byte	0xb7
+	.long	0xeef
+	.uleb128 0x2
+	.long	0x25c
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2858
+	.byte	0xa
+	.byte	0x56
+	.byte	0x7
+	.long	0xf6
+	.long	0xf05
+	.uleb128 0x2
+	.long	0xf05
+	.byte	0
+	.uleb128 0x5
+	.long	0x316
+	.uleb128 0x9
+	.long	.LASF2856
+	.byte	0xa
+	.byte	0x54
+	.long	0xf20
+	.uleb128 0x2
+	.long	0xf05
+	.uleb128 0x2
+	.long	0xf6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2857
+	.byte	0xa
+	.byte	0x53
+	.long	0xf31
+	.uleb128 0x2
+	.long	0xf05
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2859
+	.byte	0x17
+	.value	0x13d
+	.byte	0x11
+	.long	0x8f
+	.long	0xf48
+	.uleb128 0x2
+	.long	0xf6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2860
+	.byte	0x18
+	.byte	0x1e
+	.long	0xf5e
+	.uleb128 0x2
+	.long	0xf5e
+	.uleb128 0x2
+	.long	0xb7
+	.byte	0
+	.uleb128 0x5
+	.long	0xab
+	.uleb128 0x2e
+	.long	.LASF2916
+	.byte	0x1d
+	.byte	0x1b
+	.byte	0xa
+	.long	0xd4
+	.uleb128 0x9
+	.long	.LASF2861
+	.byte	0xb
+	.byte	0x62
+	.long	0xf94
+	.uleb128 0x2
+	.long	0xf94
+	.uleb128 0x2
+	.long	0xf6
+	.uleb128 0x2
+	.long	0xd4
+	.uleb128 0x2
+	.long	0xf6
+	.uleb128 0x2
+	.long	0x474
+	.byte	0
+	.uleb128 0x5
+	.long	0x3c6
+	.uleb128 0x15
+	.long	.LASF2862
+	.byte	0xb
+	.byte	0x5c
+	.byte	0x7
+	.long	0xf6
+	.long	0xfb4
+	.uleb128 0x2
+	.long	0xc8
+	.uleb128 0x2
+	.long	0xc8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2863
+	.byte	0xb
+	.byte	0x73
+	.long	0xfcf
+	.uleb128 0x2
+	.long	0xfcf
+	.uleb128 0x2
+	.long	0xb7
+	.uleb128 0x2
+	.long	0xc8
+	.byte	0
+	.uleb128 0x5
+	.long	0x432
+	.uleb128 0x9
+	.long	.LASF2864
+	.byte	0xb
+	.byte	0x75
+	.long	0xfea
+	.uleb128 0x2
+	.long	0xfcf
+	.uleb128 0x2
+	.long	0x480
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2865
+	.byte	0xb
+	.byte	0x66
+	.long	0x1005
+	.uleb128 0x2
+	.long	0x1005
+	.uleb128 0x2
+	.long	0xb7
+	.uleb128 0x2
+	.long	0xf6
+	.byte	0
+	.uleb128 0x5
+	.long	0x358
+	.uleb128 0x9
+	.long	.LASF2866
+	.byte	0xb
+	.byte	0x67
+	.long	0x1020
+	.uleb128 0x2
+	.long	0x1005
+	.uleb128 0x2
+	.long	0x480
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2867
+	.byte	0xb
+	.byte	0x63
+	.long	0x103b
+	.uleb128 0x2
+	.long	0xf94
+	.uleb128 0x2
+	.long	0xf6
+	.uleb128 0x2
+	.long	0xd4
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2868
+	.byte	0xb
+	.byte	0x65
+	.long	0x1051
+	.uleb128 0x2
+	.long	0xf94
+	.uleb128 0x2
+	.long	0x480
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2869
+	.byte	0xb
+	.byte	0x55
+	.long	0x1067
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x480
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2870
+	.byte	0x19
+	.byte	0x48
+	.long	0x1078
+	.uleb128 0x2
+	.long	0xd4
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2871
+	.byte	0x1a
+	.byte	0x19
+	.byte	0x5
+	.long	0x1d3
+	.long	0x108e
+	.uleb128 0x2
+	.long	0x6cc
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2872
+	.byte	0x1b
+	.byte	0xc
+	.byte	0xa
+	.long	0xd4
+	.long	0x10b3
+	.uleb128 0x2
+	.long	0x10b3
+	.uleb128 0x2
+	.long	0xb7
+	.uleb128 0x2
+	.long	0xb7
+	.uleb128 0x2
+	.long	0x1d3
+	.byte	0
+	.uleb128 0x5
+	.long	0xa2f
+	.uleb128 0x15
+	.long	.LASF2873
+	.byte	0x1c
+	.byte	0x3d
+	.byte	0xe
+	.long	0x96
+	.long	0x10d8
+	.uleb128 0x2
+	.long	0x96
+	.uleb128 0x2
+	.long	0x7c
+	.uleb128 0x2
+	.long	0xea
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2874
+	.value	0x2d2
+	.byte	0x9
+	.long	0x9f
+	.long	0x10f5
+	.uleb128 0xd
+	.long	.LASF2876
+	.value	0x2d2
+	.byte	0x19
+	.long	0x7c
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2877
+	.value	0x2cd
+	.byte	0x9
+	.long	0x9f
+	.uleb128 0x21
+	.long	.LASF2889
+	.value	0x2c6
+	.uleb128 0x12
+	.long	.LASF2880
+	.value	0x28d
+	.long	0x113a
+	.uleb128 0x8
+	.long	.LASF2875
+	.value	0x2a3
+	.byte	0xf
+	.long	0x1df
+	.uleb128 0x8
+	.long	.LASF2807
+	.value	0x2b3
+	.byte	0xb
+	.long	0x322
+	.uleb128 0x13
+	.uleb128 0x8
+	.long	.LASF2876
+	.value	0x2b4
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2878
+	.value	0x288
+	.byte	0xa
+	.long	0x1c7
+	.uleb128 0x16
+	.long	.LASF2879
+	.value	0x283
+	.byte	0x5
+	.long	0x1d3
+	.uleb128 0x12
+	.long	.LASF2881
+	.value	0x27a
+	.long	0x116a
+	.uleb128 0xd
+	.long	.LASF2882
+	.value	0x27a
+	.byte	0x1d
+	.long	0xb7
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2883
+	.value	0x271
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0x12
+	.long	.LASF2884
+	.value	0x25f
+	.long	0x118e
+	.uleb128 0xd
+	.long	.LASF2885
+	.value	0x25f
+	.byte	0x2c
+	.long	0x118e
+	.byte	0
+	.uleb128 0x5
+	.long	0xdaf
+	.uleb128 0x22
+	.long	.LASF2886
+	.value	0x223
+	.long	0x11ab
+	.uleb128 0xd
+	.long	.LASF2807
+	.value	0x223
+	.byte	0x25
+	.long	0x480
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2887
+	.value	0x1f5
+	.long	0x1201
+	.uleb128 0xd
+	.long	.LASF2888
+	.value	0x1f5
+	.byte	0x2f
+	.long	0x10b3
+	.uleb128 0xd
+	.long	.LASF2812
+	.value	0x1f5
+	.byte	0x40
+	.long	0xb7
+	.uleb128 0x1b
+	.string	"g"
+	.value	0x1f7
+	.byte	0x14
+	.long	0xa1a
+	.uleb128 0x1b
+	.string	"var"
+	.value	0x1f8
+	.byte	0x14
+	.long	0x1201
+	.uleb128 0x13
+	.uleb128 0x8
+	.long	.LASF2876
+	.value	0x1fa
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0x13
+	.uleb128 0x1b
+	.string	"dev"
+	.value	0x20b
+	.byte	0x19
+	.long	0xfd
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x316
+	.long	0x1211
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2890
+	.value	0x1f0
+	.uleb128 0x1c
+	.long	.LASF2891
+	.value	0x1eb
+	.byte	0xc
+	.long	0x1d3
+	.uleb128 0x1c
+	.long	.LASF2892
+	.value	0x1e6
+	.byte	0x11
+	.long	0xc8
+	.uleb128 0x1c
+	.long	.LASF2893
+	.value	0x1e1
+	.byte	0xc
+	.long	0x1d3
+	.uleb128 0x16
+	.long	.LASF2894
+	.value	0x1dc
+	.byte	0x5
+	.long	0x1d3
+	.uleb128 0x12
+	.long	.LASF2895
+	.value	0x1cf
+	.long	0x1260
+	.uleb128 0x8
+	.long	.LASF2896
+	.value	0x1d2
+	.byte	0x13
+	.long	0xc3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2897
+	.value	0x193
+	.long	0x129e
+	.uleb128 0xd
+	.long	.LASF2898
+	.value	0x193
+	.byte	0x24
+	.long	0xc8
+	.uleb128 0xd
+	.long	.LASF2899
+	.value	0x193
+	.byte	0x36
+	.long	0xc8
+	.uleb128 0x8
+	.long	.LASF2900
+	.value	0x196
+	.byte	0x14
+	.long	0xe5
+	.uleb128 0x13
+	.uleb128 0x8
+	.long	.LASF2901
+	.value	0x199
+	.byte	0x15
+	.long	0xfd
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2902
+	.value	0x188
+	.long	0x12dc
+	.uleb128 0xd
+	.long	.LASF2898
+	.value	0x188
+	.byte	0x24
+	.long	0xc8
+	.uleb128 0xd
+	.long	.LASF2899
+	.value	0x188
+	.byte	0x36
+	.long	0xc8
+	.uleb128 0x8
+	.long	.LASF2900
+	.value	0x18b
+	.byte	0x14
+	.long	0xe5
+	.uleb128 0x13
+	.uleb128 0x8
+	.long	.LASF2901
+	.value	0x18e
+	.byte	0x15
+	.long	0xfd
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2903
+	.value	0x168
+	.long	0x1332
+	.uleb128 0xd
+	.long	.LASF2904
+	.value	0x168
+	.byte	0x20
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF2905
+	.value	0x16a
+	.byte	0x1c
+	.long	0x3c6
+	.uleb128 0x8
+	.long	.LASF2906
+	.value	0x16b
+	.byte	0x19
+	.long	0x358
+	.uleb128 0x8
+	.long	.LASF2907
+	.value	0x16c
+	.byte	0x1f
+	.long	0x1332
+	.uleb128 0x8
+	.long	.LASF2900
+	.value	0x16f
+	.byte	0x14
+	.long	0xe5
+	.uleb128 0x13
+	.uleb128 0x8
+	.long	.LASF2876
+	.value	0x180
+	.byte	0x16
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x432
+	.long	0x1342
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2908
+	.value	0x138
+	.byte	0x5
+	.long	0x1d3
+	.long	0x135f
+	.uleb128 0x8
+	.long	.LASF2909
+	.value	0x146
+	.byte	0x18
+	.long	0xc6f
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2917
+	.byte	0x16
+	.byte	0xa1
+	.byte	0x15
+	.long	0xc63
+	.long	0x1387
+	.uleb128 0x30
+	.string	"dev"
+	.byte	0x16
+	.byte	0xa1
+	.byte	0x2b
+	.long	0x10b3
+	.uleb128 0xe
+	.long	.LASF2909
+	.byte	0xa3
+	.byte	0x12
+	.long	0xc63
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2910
+	.byte	0x9c
+	.byte	0x1d
+	.long	0x1392
+	.uleb128 0x5
+	.long	0x9d5
+	.uleb128 0x1d
+	.long	.LASF2911
+	.byte	0x98
+	.byte	0x1b
+	.long	0x13a2
+	.uleb128 0x5
+	.long	0x918
+	.uleb128 0x1d
+	.long	.LASF2912
+	.byte	0x93
+	.byte	0x14
+	.long	0x86f
+	.uleb128 0x23
+	.long	.LASF2913
+	.byte	0x46
+	.byte	0x96
+	.long	0x13bd
+	.uleb128 0x5
+	.long	0xd92
+	.uleb128 0x23
+	.long	.LASF2914
+	.byte	0x46
+	.byte	0x4a
+	.long	0x13cd
+	.uleb128 0x5
+	.long	0xd9e
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 30 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 32 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x20
+	.file 33 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x22
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 35 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 36 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x24
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 39 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 41 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x29
+	.file 42 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 48 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 49 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x32
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1181
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1221
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 60 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3c
+	.file 61 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 62 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x3e
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 63 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x3f
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1613
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1640
+	.byte	0x4
+	.file 64 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x40
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.file 65 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 66 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 67 "./src/main/drivers/accgyro_adxl345.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x43
+	.byte	0x4
+	.file 68 "./src/main/drivers/accgyro_bma280.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x1a
+	.byte	0x4
+	.file 69 "./src/main/drivers/accgyro_l3g4200d.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x45
+	.byte	0x4
+	.file 70 "./src/main/drivers/accgyro_l3gd20.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x46
+	.byte	0x4
+	.file 71 "./src/main/drivers/accgyro_lsm303dlhc.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 72 "./src/main/drivers/accgyro_mma845x.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x48
+	.byte	0x4
+	.file 73 "./src/main/drivers/accgyro_mpu3050.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 74 "./src/main/drivers/accgyro_mpu6050.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x4a
+	.byte	0x4
+	.file 75 "./src/main/drivers/accgyro_mpu6500.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 76 "./src/main/drivers/accgyro_spi_bmi160.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x4c
+	.byte	0x4
+	.file 77 "./src/main/drivers/accgyro_spi_icm20689.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 78 "./src/main/drivers/accgyro_spi_mpu6000.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.file 79 "./src/main/drivers/accgyro_spi_mpu6500.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x4f
+	.byte	0x4
+	.file 80 "./src/main/drivers/accgyro_spi_mpu9250.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.file 81 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x51
+	.file 82 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x1b
+	.byte	0x4
+	.file 83 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x53
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.file 84 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.file 85 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 86 "./src/main/drivers/nvic.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x13
+	.byte	0x4
+	.file 87 "./src/main/io/statusindicator.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x14
+	.byte	0x4
+	.file 88 "./src/main/sensors/gyroanalyse.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2526
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1089
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1097
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1099
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1101
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1103
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1105
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1107
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1109
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1111
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1117
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1129
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1131
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1135
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1137
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1143
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1147
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1155
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1157
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1159
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1161
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1163
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1165
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1167
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1169
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1171
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1173
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1220
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1252
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1290
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1293
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1299
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1303
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1305
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1308
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1310
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1335
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1496
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1509
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1526
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1527
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1529
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1530
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1457
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1555
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1556
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1557
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1558
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1559
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1560
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1561
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1562
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1563
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1564
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1565
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1566
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1567
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1568
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1573
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1574
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1575
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1576
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1577
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1578
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1580
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1583
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1584
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1585
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1612
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.50.10d0067a73777b2d14d79db5df156f88,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1617
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.profile.h.48.b5d3bdbbb4f3d375ccee68ec649323aa,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1623
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1639
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1665
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1688
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1770
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1772
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1871
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_lsm303dlhc.h.57.fca8398e4fda95a0f26079c2c3deff7e,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2039
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu3050.h.21.5c2c3f68cf533de2f049158113684e6d,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2046
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu6500.h.20.81784e103e59d17986bd067df6cf9997,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_icm20689.h.21.e4ceb006a38c1b53339fd03e766f2c2c,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2060
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_mpu6000.h.6.3b6c85f4d39f2b8f455a259d1cae7373,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_spi_mpu9250.h.6.ec8aa7be40d86c318c904947d7c80cc8,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2071
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.nvic.h.6.efba2b2d501cb542ce721628ece555cb,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2505
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyroanalyse.h.23.0b1f88510c8181f9938f950155cd183e,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2519
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2524
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF2918
+	.long	.LASF2919
+	.long	.LASF2920
+	.long	.LASF2921
+	.long	.LASF2922
+	.long	.LASF2923
+	.long	.LASF2924
+	.long	.LASF2925
+	.long	.LASF2926
+	.long	.LASF2927
+	.long	.LASF2928
+	.long	.LASF2929
+	.long	.LASF2930
+	.long	.LASF2931
+	.long	.LASF2932
+	.long	.LASF2933
+	.long	.LASF2934
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x59
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2935
+	.byte	0xd
+	.long	.LASF2936
+	.byte	0xd
+	.long	.LASF2937
+	.byte	0xd
+	.long	.LASF2938
+	.byte	0x11
+	.long	.LASF2939
+	.byte	0x1
+	.long	.LASF2940
+	.byte	0x2
+	.long	.LASF2941
+	.byte	0x7
+	.long	.LASF2942
+	.byte	0x1
+	.long	.LASF2943
+	.byte	0x2
+	.long	.LASF2944
+	.byte	0x2
+	.long	.LASF2945
+	.byte	0x2
+	.long	.LASF2946
+	.byte	0x3
+	.long	.LASF2947
+	.byte	0x4
+	.long	.LASF2948
+	.byte	0x4
+	.long	.LASF2949
+	.byte	0x4
+	.long	.LASF2950
+	.byte	0x4
+	.long	.LASF2951
+	.byte	0x4
+	.long	.LASF2952
+	.byte	0x4
+	.long	.LASF2953
+	.byte	0x6
+	.long	.LASF2954
+	.byte	0x8
+	.long	.LASF2955
+	.byte	0x8
+	.long	.LASF2956
+	.byte	0x8
+	.long	.LASF2957
+	.byte	0xd
+	.long	.LASF2958
+	.byte	0x8
+	.long	.LASF2959
+	.byte	0x5
+	.long	.LASF2960
+	.byte	0x4
+	.long	.LASF2961
+	.byte	0x4
+	.long	.LASF2962
+	.byte	0x10
+	.long	.LASF2963
+	.byte	0x4
+	.long	.LASF2964
+	.byte	0x10
+	.long	.LASF2965
+	.byte	0x11
+	.long	.LASF2966
+	.byte	0x11
+	.long	.LASF2966
+	.byte	0x10
+	.long	.LASF2967
+	.byte	0xd
+	.long	.LASF2968
+	.byte	0x10
+	.long	.LASF2969
+	.byte	0x10
+	.long	.LASF2970
+	.byte	0xd
+	.long	.LASF2971
+	.byte	0xd
+	.long	.LASF2972
+	.byte	0xf
+	.long	.LASF2973
+	.byte	0xd
+	.long	.LASF2974
+	.byte	0xe
+	.long	.LASF2975
+	.byte	0xe
+	.long	.LASF2976
+	.byte	0xd
+	.long	.LASF2977
+	.byte	0xd
+	.long	.LASF2978
+	.byte	0xd
+	.long	.LASF2979
+	.byte	0xc
+	.long	.LASF2980
+	.byte	0xc
+	.long	.LASF2981
+	.byte	0x10
+	.long	.LASF2982
+	.byte	0x10
+	.long	.LASF2983
+	.byte	0xd
+	.long	.LASF2984
+	.byte	0xd
+	.long	.LASF2985
+	.byte	0xd
+	.long	.LASF2986
+	.byte	0xd
+	.long	.LASF2987
+	.byte	0xd
+	.long	.LASF2988
+	.byte	0xd
+	.long	.LASF2989
+	.byte	0xd
+	.long	.LASF2990
+	.byte	0xd
+	.long	.LASF2991
+	.byte	0xd
+	.long	.LASF2992
+	.byte	0xd
+	.long	.LASF2993
+	.byte	0xb
+	.long	.LASF2994
+	.byte	0xa
+	.long	.LASF2995
+	.byte	0x9
+	.long	.LASF2996
+	.byte	0xa
+	.long	.LASF2997
+	.byte	0x2
+	.long	.LASF2998
+	.byte	0x1
+	.long	.LASF2999
+	.byte	0x3
+	.long	.LASF3000
+	.byte	0x4
+	.long	.LASF3001
+	.byte	0x4
+	.long	.LASF3002
+	.byte	0x4
+	.long	.LASF3003
+	.byte	0x4
+	.long	.LASF3004
+	.byte	0x4
+	.long	.LASF3005
+	.byte	0x4
+	.long	.LASF3006
+	.byte	0x4
+	.long	.LASF3007
+	.byte	0x4
+	.long	.LASF3008
+	.byte	0x4
+	.long	.LASF3009
+	.byte	0x4
+	.long	.LASF3010
+	.byte	0x4
+	.long	.LASF3011
+	.byte	0x4
+	.long	.LASF3012
+	.byte	0x4
+	.long	.LASF3013
+	.byte	0x4
+	.long	.LASF3014
+	.byte	0x4
+	.long	.LASF3015
+	.byte	0x4
+	.long	.LASF3016
+	.byte	0x4
+	.long	.LASF3017
+	.byte	0x4
+	.long	.LASF3018
+	.byte	0x4
+	.long	.LASF3019
+	.byte	0x4
+	.long	.LASF3020
+	.byte	0x6
+	.long	.LASF3021
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2215:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2451:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2289:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF2144:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1155:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF2644:
+	.string	"extiHandlerCallback"
+.LASF2281:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1206:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF826:
+	.string	"__DECL_SIMD_logf "
+.LASF2051:
+	.string	"ICM20602_WHO_AM_I_CONST (0x12)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1408:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF2685:
+	.string	"mpuConfiguration_s"
+.LASF2692:
+	.string	"mpuConfiguration_t"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1979:
+	.string	"LSM303DLHC_IT1_OVERRUN ((uint8_t)0x02)"
+.LASF1207:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF1082:
+	.string	"__DECL_SIMD_exp"
+.LASF1484:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2870:
+	.string	"sensorsSet"
+.LASF2490:
+	.string	"NVIC_PRIO_SERIALUART8_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF1334:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF1101:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1894:
+	.string	"LSM303DLHC_OUT_Z_L_A 0x2C"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1520:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1491:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2674:
+	.string	"gyroAlign"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1603:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF935:
+	.string	"__DECL_SIMD_sinh "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1232:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF1358:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1972:
+	.string	"LSM303DLHC_HPF_AOI2_ENABLE ((uint8_t)0x02)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1485:
+	.string	"TELEMETRY_MAVLINK "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF863:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF2275:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1135:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF2026:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_5_6Ga 330"
+.LASF1784:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1811:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF2701:
+	.string	"ICM_20602_SPI"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF2455:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1464:
+	.string	"USE_SERIALRX_CRSF "
+.LASF2024:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_4Ga 450"
+.LASF2640:
+	.string	"extiConfig_s"
+.LASF2641:
+	.string	"extiConfig_t"
+.LASF1322:
+	.string	"FP_NORMAL 4"
+.LASF999:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF979:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF836:
+	.string	"__DECL_SIMD_expf "
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1434:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF1802:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF2636:
+	.string	"reset"
+.LASF1613:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1666:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF939:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF2093:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF2615:
+	.string	"targetCount"
+.LASF879:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2819:
+	.string	"gyro_to_use"
+.LASF2603:
+	.string	"m_newM"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2532:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2605:
+	.string	"m_newS"
+.LASF1124:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1744:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF1099:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF1409:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF2574:
+	.string	"_Bool"
+.LASF794:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2145:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1180:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1536:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF2642:
+	.string	"extiCallbackRec_t"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1267:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1234:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1486:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2875:
+	.string	"calibrationComplete"
+.LASF2727:
+	.string	"OWNER_ADC_CURR"
+.LASF2096:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF931:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1606:
+	.string	"__enable_irq() "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1683:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1749:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF2206:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2315:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2307:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2415:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2388:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2469:
+	.string	"NVIC_PRIO_SERIALUART1_TXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF2781:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF2775:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1339:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1868:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2036:
+	.string	"LSM303DLHC_SINGLE_CONVERSION ((uint8_t) 0x01)"
+.LASF1672:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF2651:
+	.string	"CW90_DEG_FLIP"
+.LASF1018:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2572:
+	.string	"DEBUG_COUNT"
+.LASF2094:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2378:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1122:
+	.string	"__DECL_SIMD_sinh"
+.LASF1615:
+	.string	"SCHEDULER_TRACE_SIZE 64"
+.LASF1809:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2653:
+	.string	"CW270_DEG_FLIP"
+.LASF2188:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2509:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF840:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1512:
+	.string	"__WCHAR_T__ "
+.LASF2176:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2896:
+	.string	"gyroIsrHeld"
+.LASF1492:
+	.string	"USE_SENSOR_NAMES "
+.LASF1217:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF2447:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1988:
+	.string	"LSM303DLHC_MOV_RECOGNITION ((uint8_t)0x40)"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1248:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1237:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1734:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1006:
+	.string	"__DECL_SIMD_acoshf "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1953:
+	.string	"LSM303DLHC_BLE_LSB ((uint8_t)0x00)"
+.LASF2835:
+	.string	"detectedSensors"
+.LASF1371:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF984:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF2887:
+	.string	"performGyroCalibration"
+.LASF2047:
+	.string	"MPU6500_WHO_AM_I_CONST (0x70)"
+.LASF2661:
+	.string	"read"
+.LASF2582:
+	.string	"TASK_BATTERY_VOLTAGE"
+.LASF1854:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF2394:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1208:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1690:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1899:
+	.string	"LSM303DLHC_INT1_SOURCE_A 0x31"
+.LASF2724:
+	.string	"OWNER_LED"
+.LASF799:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2118:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2671:
+	.string	"mpuDividerDrops"
+.LASF2049:
+	.string	"MPU9255_WHO_AM_I_CONST (0x73)"
+.LASF2099:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2518:
+	.string	"FFT_MIN_FREQ 100"
+.LASF824:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2462:
+	.string	"NVIC_PRIO_BARO_EXTI NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF2690:
+	.string	"resetFn"
+.LASF2543:
+	.string	"uint16_t"
+.LASF1094:
+	.string	"__DECL_SIMD_atan"
+.LASF2517:
+	.string	"FFT_SAMPLING_RATE 1000"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2457:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1117:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF1235:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2594:
+	.string	"PROFILE_GYRO_UPDATE"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2386:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2277:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2883:
+	.string	"gyroIsrHold"
+.LASF2365:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1475:
+	.string	"TELEMETRY_HOTT "
+.LASF818:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF957:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1126:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2058:
+	.string	"MPU6500_BIT_I2C_IF_DIS (1 << 4)"
+.LASF1678:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1325:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF793:
+	.string	"_MATH_H 1"
+.LASF2184:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1600:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2154:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1308:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF2050:
+	.string	"ICM20601_WHO_AM_I_CONST (0xAC)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF2080:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1501:
+	.string	"_T_PTRDIFF_ "
+.LASF2804:
+	.string	"gyroSensor_e"
+.LASF2392:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1842:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF2159:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF807:
+	.string	"__DECL_SIMD_sinl "
+.LASF2267:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1779:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1722:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1598:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1694:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1804:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF2233:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1348:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2138:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2511:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2424:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1890:
+	.string	"LSM303DLHC_OUT_X_L_A 0x28"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1730:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1791:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF2220:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1871:
+	.string	"GYRO_LPF_NONE 7"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2169:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1055:
+	.string	"__DECL_SIMD_tan "
+.LASF1655:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1390:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF1877:
+	.string	"LSM303DLHC_I2C_SCK_PIN PB6"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1412:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2780:
+	.string	"BEEPER_READY_BEEP"
+.LASF828:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2290:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2106:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2914:
+	.string	"gyroConfig"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2278:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2128:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2298:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1383:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF2410:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1631:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF2287:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1198:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2270:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF2852:
+	.string	"pgResetTemplate_gyroConfig"
+.LASF1441:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF1414:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF2218:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1915:
+	.string	"LSM303DLHC_OUT_X_H_M 0x03"
+.LASF2810:
+	.string	"gyroConfig_s"
+.LASF884:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2418:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1717:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1288:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2192:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF827:
+	.string	"__DECL_SIMD_logl "
+.LASF1395:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF2731:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2751:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2792:
+	.string	"GYRO_L3G4200D"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1172:
+	.string	"__DECL_SIMD_tanf"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1158:
+	.string	"__DECL_SIMD_tanh"
+.LASF1997:
+	.string	"LSM303DLHC_Z_SINGLE_CLICK ((uint8_t)0x10)"
+.LASF2385:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1064:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1991:
+	.string	"LSM303DLHC_Z_LOW ((uint8_t)0x10)"
+.LASF2079:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1423:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1652:
+	.string	"BIT(x) (1 << (x))"
+.LASF2756:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1671:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF835:
+	.string	"__DECL_SIMD_exp "
+.LASF2122:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1045:
+	.string	"__DECL_SIMD_erfc "
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1170:
+	.string	"__DECL_SIMD_tan"
+.LASF910:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF927:
+	.string	"__DECL_SIMD_expm1l "
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1249:
+	.string	"_Mdouble_"
+.LASF2541:
+	.string	"int32_t"
+.LASF1393:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF1176:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1337:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1106:
+	.string	"__DECL_SIMD_exp2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1387:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF2397:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1627:
+	.string	"FAST_MATH "
+.LASF1542:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1085:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF1415:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1146:
+	.string	"__DECL_SIMD_atanh"
+.LASF1019:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1835:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2142:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1522:
+	.string	"___int_wchar_t_h "
+.LASF2422:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF837:
+	.string	"__DECL_SIMD_expl "
+.LASF2368:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1646:
+	.string	"STR_HELPER(x) #x"
+.LASF1532:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF2527:
+	.string	"unsigned char"
+.LASF2064:
+	.string	"BITS_DLPF_CFG_98HZ 0x02"
+.LASF1184:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1961:
+	.string	"LSM303DLHC_HPFCF_8 ((uint8_t)0x00)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF2508:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1581:
+	.string	"VTX_TRAMP"
+.LASF1229:
+	.string	"FP_INT_UPWARD 0"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2753:
+	.string	"OWNER_BARO_EXTI"
+.LASF1707:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2624:
+	.string	"biquadFilterType_e"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2688:
+	.string	"slowreadFn"
+.LASF1878:
+	.string	"LSM303DLHC_I2C_SDA_PIN PB7"
+.LASF546:
+	.string	"__always_inline"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1020:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2621:
+	.string	"FILTER_FIR"
+.LASF2063:
+	.string	"BITS_DLPF_CFG_188HZ 0x01"
+.LASF1402:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF1994:
+	.string	"LSM303DLHC_X_HIGH ((uint8_t)0x02)"
+.LASF934:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF2912:
+	.string	"gyroSensorBus"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1557:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1227:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF2450:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2482:
+	.string	"NVIC_PRIO_SERIALUART5_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF2100:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2199:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2730:
+	.string	"OWNER_SERIAL_TX"
+.LASF1970:
+	.string	"LSM303DLHC_HPF_AOI1_ENABLE ((uint8_t)0x01)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1727:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1250:
+	.string	"__MATH_PRECNAME"
+.LASF970:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF2014:
+	.string	"LSM303DLHC_FS_1_3_GA ((uint8_t) 0x20)"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF2515:
+	.string	"FFT_WINDOW_SIZE 32"
+.LASF1110:
+	.string	"__DECL_SIMD_exp10"
+.LASF2913:
+	.string	"gyroConfigMutable"
+.LASF1134:
+	.string	"__DECL_SIMD_log10"
+.LASF2629:
+	.string	"PGR_SIZE_MASK"
+.LASF1260:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1118:
+	.string	"__DECL_SIMD_expm1"
+.LASF1310:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF902:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1311:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1103:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF2034:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_8_1Ga 205"
+.LASF2807:
+	.string	"gyroADCf"
+.LASF2475:
+	.string	"NVIC_PRIO_SERIALUART3_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2384:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1381:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1220:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF2168:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1070:
+	.string	"__DECL_SIMD_sin"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1488:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1420:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2185:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2669:
+	.string	"gyroADC"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF2362:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1986:
+	.string	"LSM303DLHC_OR_COMBINATION ((uint8_t)0x00)"
+.LASF2862:
+	.string	"filterGetNotchQ"
+.LASF2607:
+	.string	"stdev_s"
+.LASF2606:
+	.string	"stdev_t"
+.LASF2037:
+	.string	"LSM303DLHC_SLEEP ((uint8_t) 0x02)"
+.LASF1007:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1314:
+	.string	"__MATHCALL_NARROW"
+.LASF2560:
+	.string	"DEBUG_VELOCITY"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF2023:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_2_5Ga 670"
+.LASF1487:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1291:
+	.string	"_Mret_ _Float32"
+.LASF1813:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF2348:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1789:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1271:
+	.string	"__MATHDECL_1"
+.LASF2787:
+	.string	"BEEPER_PREFERENCE"
+.LASF1591:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2321:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2800:
+	.string	"GYRO_ICM20608G"
+.LASF2616:
+	.string	"index"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2070:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF2672:
+	.string	"dataReady"
+.LASF1884:
+	.string	"LSM303DLHC_CTRL_REG3_A 0x22"
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2765:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2361:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF2540:
+	.string	"int16_t"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1776:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF1186:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2668:
+	.string	"gyroZero"
+.LASF2007:
+	.string	"LSM303DLHC_ODR_1_5_HZ ((uint8_t) 0x04)"
+.LASF2381:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1454:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF2818:
+	.string	"gyro_use_32khz"
+.LASF959:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1619:
+	.string	"PROFILE_TICKS_PER_US 1000"
+.LASF2485:
+	.string	"NVIC_PRIO_SERIALUART6_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF2487:
+	.string	"NVIC_PRIO_SERIALUART7_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF1949:
+	.string	"LSM303DLHC_FULLSCALE_8G ((uint8_t)0x20)"
+.LASF1682:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1930:
+	.string	"LSM303DLHC_LOWPOWER_MODE ((uint8_t)0x08)"
+.LASF2878:
+	.string	"gyroDataReadyAtUs"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f"
+.LASF988:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2650:
+	.string	"CW0_DEG_FLIP"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2507:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF895:
+	.string	"__DECL_SIMD_exp2 "
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF2367:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF913:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1865:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF2330:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1450:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF1702:
+	.string	"PG_PID_PROFILE 14"
+.LASF1280:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1936:
+	.string	"LSM303DLHC_ODR_200_HZ ((uint8_t)0x60)"
+.LASF1245:
+	.string	"_Mdouble_ double"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF2028:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_1_3Ga 980"
+.LASF2881:
+	.string	"gyroIsrRelease"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2137:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2006:
+	.string	"LSM303DLHC_ODR_0_75_HZ ((uint8_t) 0x00)"
+.LASF2838:
+	.string	"SENSOR_BARO"
+.LASF2693:
+	.string	"MPU_NONE"
+.LASF1806:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF1024:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2454:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2501:
+	.string	"NVIC_PRIO_MAX7456_DMA NVIC_BUILD_PRIORITY(3, 0)"
+.LASF2393:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2484:
+	.string	"NVIC_PRIO_SERIALUART6_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF1178:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2895:
+	.string	"gyroInitFilters"
+.LASF2735:
+	.string	"OWNER_SONAR_ECHO"
+.LASF2601:
+	.string	"PROFILE_PROBE_COUNT"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1364:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF2241:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1389:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF1323:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1719:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2284:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1762:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1108:
+	.string	"__DECL_SIMD_exp2f"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1398:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF2723:
+	.string	"OWNER_SERVO"
+.LASF1654:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1709:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1392:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF2708:
+	.string	"mpu6050Resolution_e"
+.LASF1069:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF2460:
+	.string	"NVIC_PRIO_MAX NVIC_BUILD_PRIORITY(0, 1)"
+.LASF2663:
+	.string	"intStatus"
+.LASF1783:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF2854:
+	.string	"beeper"
+.LASF2396:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1701:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2412:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1483:
+	.string	"TELEMETRY_IBUS "
+.LASF1462:
+	.string	"USE_PWM "
+.LASF2767:
+	.string	"BEEPER_GYRO_CALIBRATED"
+.LASF920:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1861:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF2777:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1863:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF2059:
+	.string	"ICM20689_WHO_AM_I_CONST (0x98)"
+.LASF996:
+	.string	"__DECL_SIMD_atanhf "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1163:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF2319:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF2112:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1944:
+	.string	"LSM303DLHC_AXES_DISABLE ((uint8_t)0x00)"
+.LASF2291:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2391:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2553:
+	.string	"DEBUG_GYRO"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF2146:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF854:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1726:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF2858:
+	.string	"devStandardDeviation"
+.LASF1516:
+	.string	"__WCHAR_T "
+.LASF2115:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2286:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1304:
+	.string	"_Mret_ _Float64"
+.LASF2894:
+	.string	"isGyroCalibrationComplete"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2342:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2569:
+	.string	"DEBUG_DYN_NOTCH"
+.LASF2646:
+	.string	"CW0_DEG"
+.LASF1431:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF1507:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2885:
+	.string	"callback"
+.LASF1684:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2120:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1426:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1990:
+	.string	"LSM303DLHC_Z_HIGH ((uint8_t)0x20)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2533:
+	.string	"__int16_t"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1879:
+	.string	"LSM303DLHC_DRDY_PIN PE2"
+.LASF2558:
+	.string	"DEBUG_NOTCH"
+.LASF2535:
+	.string	"__uint16_t"
+.LASF1201:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1828:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF2471:
+	.string	"NVIC_PRIO_SERIALUART1 NVIC_BUILD_PRIORITY(1, 1)"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2722:
+	.string	"OWNER_MOTOR"
+.LASF921:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF396:
+	.string	"__REVISION__ \"053eab6\""
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2617:
+	.string	"movingSum"
+.LASF1942:
+	.string	"LSM303DLHC_Z_ENABLE ((uint8_t)0x04)"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF2681:
+	.string	"sensorGyroInterruptStatusFuncPtr"
+.LASF1596:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2209:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF364:
+	.string	"__k8 1"
+.LASF1635:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF1850:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF2750:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1523:
+	.string	"__INT_WCHAR_T_H "
+.LASF966:
+	.string	"__DECL_SIMD_log10f "
+.LASF2649:
+	.string	"CW270_DEG"
+.LASF1951:
+	.string	"LSM303DLHC_BlockUpdate_Continous ((uint8_t)0x00)"
+.LASF2814:
+	.string	"gyro_lpf"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2237:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF891:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2309:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1344:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF2092:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1808:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF860:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1305:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF1718:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1735:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2903:
+	.string	"gyroInitFilterLpf"
+.LASF922:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF2794:
+	.string	"GYRO_L3GD20"
+.LASF2339:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2123:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1913:
+	.string	"LSM303DLHC_CRB_REG_M 0x01"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF2414:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2148:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1647:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1625:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF2152:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1853:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF823:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF851:
+	.string	"__DECL_SIMD_powf128 "
+.LASF892:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF2796:
+	.string	"GYRO_MPU6500"
+.LASF2831:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2373:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1160:
+	.string	"__DECL_SIMD_tanhf"
+.LASF2841:
+	.string	"SENSOR_GPS"
+.LASF1298:
+	.string	"_Marg_ _Float128"
+.LASF1197:
+	.string	"__f32x(x) x ##f32x"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1231:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1617:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= LOAD_PERCENTAGE_ONE)"
+.LASF1351:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1252:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2614:
+	.string	"filledCount"
+.LASF1645:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1312:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1622:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF2053:
+	.string	"MPU6500_BIT_RESET (0x80)"
+.LASF2655:
+	.string	"deviceSpi_s"
+.LASF1910:
+	.string	"LSM303DLHC_TIME_LATENCY_A 0x3C"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1127:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2886:
+	.string	"gyroApplyFilters"
+.LASF2666:
+	.string	"scale"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1301:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1957:
+	.string	"LSM303DLHC_HPM_NORMAL_MODE_RES ((uint8_t)0x00)"
+.LASF2113:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1283:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF852:
+	.string	"__DECL_SIMD_powf32x "
+.LASF983:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2242:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1212:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1769:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1772:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1670:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1508:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1079:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF2374:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2434:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2040:
+	.string	"MPU3050_SMPLRT_DIV 0x15"
+.LASF1720:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2320:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1703:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF2811:
+	.string	"gyro_align"
+.LASF1839:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF2048:
+	.string	"MPU9250_WHO_AM_I_CONST (0x71)"
+.LASF2546:
+	.string	"float"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1421:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1698:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1674:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2411:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1814:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1793:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF1273:
+	.string	"__MATHDECL"
+.LASF1538:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1489:
+	.string	"USE_MSP_PUSH "
+.LASF2844:
+	.string	"gyroTemperature0"
+.LASF1017:
+	.string	"__DECL_SIMD_erfl "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1578:
+	.string	"VTX_COMMON"
+.LASF1382:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF1917:
+	.string	"LSM303DLHC_OUT_Z_H_M 0x05"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF878:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1500:
+	.string	"_PTRDIFF_T "
+.LASF1586:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF2633:
+	.string	"pgRegistry_s"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1067:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF2161:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF2461:
+	.string	"NVIC_PRIO_TIMER NVIC_BUILD_PRIORITY(1, 1)"
+.LASF2907:
+	.string	"gyroDenoiseState"
+.LASF1660:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2129:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1637:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF1145:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1933:
+	.string	"LSM303DLHC_ODR_25_HZ ((uint8_t)0x30)"
+.LASF974:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1797:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1778:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF2619:
+	.string	"FILTER_PT1"
+.LASF2645:
+	.string	"ALIGN_DEFAULT"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1621:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF943:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1796:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF1479:
+	.string	"USE_SERVOS "
+.LASF1380:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF2631:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF2124:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1680:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2041:
+	.string	"MPU3050_DLPF_FS_SYNC 0x16"
+.LASF2056:
+	.string	"MPU6500_BIT_INT_ANYRD_2CLEAR (1 << 4)"
+.LASF1876:
+	.string	"LSM303DLHC_I2C I2C1"
+.LASF2762:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1472:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2705:
+	.string	"mpuSensor_e"
+.LASF2592:
+	.string	"TASK_SELF"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1837:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2329:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2872:
+	.string	"gyroSetSampleRate"
+.LASF868:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1329:
+	.string	"MATH_ERRNO 1"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1914:
+	.string	"LSM303DLHC_MR_REG_M 0x02"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2227:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2114:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2802:
+	.string	"GYRO_BMI160"
+.LASF2400:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1307:
+	.string	"_Mret_ _Float64x"
+.LASF2776:
+	.string	"BEEPER_RX_SET"
+.LASF2660:
+	.string	"init"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2856:
+	.string	"devPush"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1543:
+	.string	"USE_FAKE_BARO "
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2695:
+	.string	"MPU_60x0"
+.LASF2300:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2248:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1406:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF2853:
+	.string	"gyroConfig_Registry"
+.LASF2382:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF2744:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1688:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF2417:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF2498:
+	.string	"NVIC_PRIO_MPU_DATA_READY NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF1773:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1372:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF1916:
+	.string	"LSM303DLHC_OUT_X_L_M 0x04"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2584:
+	.string	"TASK_BATTERY_ALERTS"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2785:
+	.string	"BEEPER_BLACKBOX_ERASE"
+.LASF916:
+	.string	"__DECL_SIMD_coshf "
+.LASF2523:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF2664:
+	.string	"update"
+.LASF997:
+	.string	"__DECL_SIMD_atanhl "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2282:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF2198:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1425:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2060:
+	.string	"ICM20689_BIT_RESET (0x80)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2675:
+	.string	"mpuDetectionResult"
+.LASF2153:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1794:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF2068:
+	.string	"mpu9250_CONFIG 0x1A"
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF894:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2562:
+	.string	"DEBUG_ANGLERATE"
+.LASF1874:
+	.string	"LSM303DLHC_FLAG_TIMEOUT ((uint32_t)0x1000)"
+.LASF2849:
+	.string	"notchFilter1"
+.LASF2696:
+	.string	"MPU_60x0_SPI"
+.LASF2018:
+	.string	"LSM303DLHC_FS_4_7_GA ((uint8_t) 0xA0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2235:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2627:
+	.string	"PGR_PGN_MASK"
+.LASF2254:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2305:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1404:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF1834:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF1187:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2351:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1244:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1247:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2139:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1530:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2522:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF2437:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2366:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1725:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF804:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1459:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF2072:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF2476:
+	.string	"NVIC_PRIO_SERIALUART3_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF967:
+	.string	"__DECL_SIMD_log10l "
+.LASF2548:
+	.string	"debug"
+.LASF402:
+	.string	"false 0"
+.LASF1817:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1449:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2449:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1370:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF1883:
+	.string	"LSM303DLHC_CTRL_REG2_A 0x21"
+.LASF1760:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1866:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF844:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2103:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1168:
+	.string	"__DECL_SIMD_erfcf"
+.LASF1592:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF2408:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1676:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF2194:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2593:
+	.string	"cfTaskId_e"
+.LASF2479:
+	.string	"NVIC_PRIO_SERIALUART4_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF1189:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2389:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF795:
+	.string	"__DECL_SIMD_cos "
+.LASF1238:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1428:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1141:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF2067:
+	.string	"MPU6000_WHO_AM_I_CONST (0x68)"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1775:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF1923:
+	.string	"LSM303DLHC_IRB_REG_M 0x0B"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1856:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF954:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2755:
+	.string	"OWNER_USB_DETECT"
+.LASF2525:
+	.string	"DEBUG_GYRO_CALIBRATION 3"
+.LASF973:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2398:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2311:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1614:
+	.string	"SCHEDULER_HISTOGRAM_BUCKETS 16"
+.LASF876:
+	.string	"__DECL_SIMD_asinf "
+.LASF2364:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1829:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF2634:
+	.string	"size"
+.LASF1461:
+	.string	"USE_PPM "
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1985:
+	.string	"LSM303DLHC_IT2_HLACTIVE ((uint8_t)0x02)"
+.LASF2326:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2832:
+	.string	"SENSOR_INDEX_BARO"
+.LASF2478:
+	.string	"NVIC_PRIO_SERIALUART4_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1745:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2157:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2687:
+	.string	"writeFn"
+.LASF2443:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2788:
+	.string	"beeperMode_e"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1857:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1531:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1068:
+	.string	"__DECL_SIMD_cosf"
+.LASF1261:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1114:
+	.string	"__DECL_SIMD_cosh"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1906:
+	.string	"LSM303DLHC_CLICK_CFG_A 0x38"
+.LASF843:
+	.string	"__DECL_SIMD_expf64x "
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2257:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1113:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF796:
+	.string	"__DECL_SIMD_cosf "
+.LASF1996:
+	.string	"LSM303DLHC_Z_DOUBLE_CLICK ((uint8_t)0x20)"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF2262:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1159:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF2098:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF940:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1669:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1668:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1350:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2126:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2565:
+	.string	"DEBUG_STACK"
+.LASF2754:
+	.string	"OWNER_USB"
+.LASF2759:
+	.string	"OWNER_INVERTER"
+.LASF1347:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2545:
+	.string	"size_t"
+.LASF1872:
+	.string	"LSM303DLHC_OK ((uint32_t) 0)"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2739:
+	.string	"OWNER_SPI_MOSI"
+.LASF2306:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2217:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2420:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2821:
+	.string	"gyro_soft_notch_cutoff_1"
+.LASF2823:
+	.string	"gyro_soft_notch_cutoff_2"
+.LASF2542:
+	.string	"uint8_t"
+.LASF1433:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF1924:
+	.string	"LSM303DLHC_IRC_REG_M 0x0C"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2165:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2480:
+	.string	"NVIC_PRIO_SERIALUART4 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF2865:
+	.string	"pt1Filter3Init"
+.LASF1213:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF2738:
+	.string	"OWNER_SPI_MISO"
+.LASF2571:
+	.string	"DEBUG_DSHOT_RPM_TELEMETRY"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1912:
+	.string	"LSM303DLHC_CRA_REG_M 0x00"
+.LASF1626:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2815:
+	.string	"gyro_soft_lpf_type"
+.LASF1251:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2269:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2354:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1935:
+	.string	"LSM303DLHC_ODR_100_HZ ((uint8_t)0x50)"
+.LASF1649:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2833:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1473:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF861:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1394:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF2911:
+	.string	"gyroMpuConfiguration"
+.LASF1149:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF1373:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF2464:
+	.string	"NVIC_PRIO_TRANSPONDER_DMA NVIC_BUILD_PRIORITY(3, 0)"
+.LASF1167:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1035:
+	.string	"__DECL_SIMD_asinh "
+.LASF1628:
+	.string	"VERY_FAST_MATH "
+.LASF1303:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF2308:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2577:
+	.string	"TASK_ACCEL"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2505:
+	.string	"NVIC_PRIORITY_SUB(prio) (((prio)&(0x0f>>(7-(NVIC_PRIORITY_GROUPING>>8))))>>4)"
+.LASF1920:
+	.string	"LSM303DLHC_OUT_Y_L_M 0x08"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1524:
+	.string	"_GCC_WCHAR_T "
+.LASF1519:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1812:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF2249:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1815:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF1063:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1570:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF2246:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2017:
+	.string	"LSM303DLHC_FS_4_0_GA ((uint8_t) 0x80)"
+.LASF2848:
+	.string	"notchFilter1ApplyFn"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1214:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1354:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF862:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1319:
+	.string	"FP_INFINITE 1"
+.LASF1309:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF915:
+	.string	"__DECL_SIMD_cosh "
+.LASF2620:
+	.string	"FILTER_BIQUAD"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2879:
+	.string	"gyroIsrUpdateActive"
+.LASF2779:
+	.string	"BEEPER_ACC_CALIBRATION_FAIL"
+.LASF1537:
+	.string	"LED0_PIN NONE"
+.LASF2164:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF2413:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1571:
+	.string	"TELEMETRY_CRSF"
+.LASF1544:
+	.string	"MAG "
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1527:
+	.string	"_BSD_WCHAR_T_"
+.LASF1386:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF1073:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1166:
+	.string	"__DECL_SIMD_erfc"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF2183:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2793:
+	.string	"GYRO_MPU3050"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2332:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1089:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2000:
+	.string	"LSM303DLHC_X_DOUBLE_CLICK ((uint8_t)0x02)"
+.LASF2086:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1171:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2303:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF2721:
+	.string	"OWNER_PPMINPUT"
+.LASF2638:
+	.string	"ioTag_t"
+.LASF2077:
+	.string	"IOCFG_IPD 0"
+.LASF1510:
+	.string	"__need_ptrdiff_t"
+.LASF848:
+	.string	"__DECL_SIMD_powf16 "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1205:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1453:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1987:
+	.string	"LSM303DLHC_AND_COMBINATION ((uint8_t)0x80)"
+.LASF917:
+	.string	"__DECL_SIMD_coshl "
+.LASF1651:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2433:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2876:
+	.string	"axis"
+.LASF1265:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1723:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1497:
+	.string	"_STDDEF_H "
+.LASF2492:
+	.string	"NVIC_PRIO_SERIALUART8 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF2376:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1116:
+	.string	"__DECL_SIMD_coshf"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1975:
+	.string	"LSM303DLHC_IT1_AOI2 ((uint8_t)0x20)"
+.LASF1072:
+	.string	"__DECL_SIMD_sinf"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF2219:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1830:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF2444:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF801:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1191:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1750:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF2857:
+	.string	"devClear"
+.LASF1437:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF833:
+	.string	"__DECL_SIMD_logf64x "
+.LASF2452:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2313:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1851:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1748:
+	.string	"PG_OSD_CONFIG 501"
+.LASF1254:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF2181:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1713:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1758:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1296:
+	.string	"_Marg_ _Float64x"
+.LASF1677:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1577:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF2074:
+	.string	"IOCFG_OUT_OD 0"
+.LASF2703:
+	.string	"ICM_20689_SPI"
+.LASF869:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2877:
+	.string	"gyroGetTemperature"
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2564:
+	.string	"DEBUG_SCHEDULER"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1966:
+	.string	"LSM303DLHC_HIGHPASSFILTER_ENABLE ((uint8_t)0x08)"
+.LASF2190:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2502:
+	.string	"NVIC_PRIORITY_GROUPING NVIC_PriorityGroup_2"
+.LASF1941:
+	.string	"LSM303DLHC_Y_ENABLE ((uint8_t)0x02)"
+.LASF1971:
+	.string	"LSM303DLHC_HPF_AOI2_DISABLE ((uint8_t)0x00)"
+.LASF2667:
+	.string	"gyroADCRaw"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2201:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF928:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1215:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF1992:
+	.string	"LSM303DLHC_Y_HIGH ((uint8_t)0x08)"
+.LASF1439:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF2234:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2179:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1998:
+	.string	"LSM303DLHC_Y_DOUBLE_CLICK ((uint8_t)0x08)"
+.LASF2466:
+	.string	"NVIC_PRIO_MPU_INT_EXTI_PID NVIC_BUILD_PRIORITY(2, 0)"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2240:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1947:
+	.string	"LSM303DLHC_FULLSCALE_2G ((uint8_t)0x00)"
+.LASF2357:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2568:
+	.string	"DEBUG_FFT"
+.LASF1761:
+	.string	"PG_VCD_CONFIG 514"
+.LASF2005:
+	.string	"LSM303DLHC_INT1INTERRUPT_HIGH_EDGE ((uint8_t)0x00)"
+.LASF1567:
+	.string	"LED_STRIP"
+.LASF2350:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1716:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1133:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF1179:
+	.string	"__f128(x) x ##f128"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1256:
+	.string	"_Mdouble_ long double"
+.LASF1896:
+	.string	"LSM303DLHC_FIFO_CTRL_REG_A 0x2E"
+.LASF808:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1918:
+	.string	"LSM303DLHC_OUT_Z_L_M 0x06"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF2496:
+	.string	"NVIC_PRIO_USB_WUP NVIC_BUILD_PRIORITY(1, 0)"
+.LASF2395:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2151:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2555:
+	.string	"DEBUG_MIXER"
+.LASF2135:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1075:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1939:
+	.string	"LSM303DLHC_ODR_1344_HZ ((uint8_t)0x90)"
+.LASF2226:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1563:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1564:
+	.string	"USE_SERIALRX_SUMH"
+.LASF2042:
+	.string	"MPU3050_INT_CFG 0x17"
+.LASF2069:
+	.string	"MPU9250_BIT_RESET (0x80)"
+.LASF1870:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2261:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF2806:
+	.string	"targetLooptime"
+.LASF890:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2212:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1091:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF877:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1474:
+	.string	"TELEMETRY_FRSKY "
+.LASF2045:
+	.string	"MPU3050_USER_CTRL 0x3D"
+.LASF2090:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1880:
+	.string	"LSM303DLHC_I2C_INT1_PIN PE4"
+.LASF1056:
+	.string	"__DECL_SIMD_tanf "
+.LASF1999:
+	.string	"LSM303DLHC_Y_SINGLE_CLICK ((uint8_t)0x04)"
+.LASF2486:
+	.string	"NVIC_PRIO_SERIALUART6 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF2337:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1777:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1759:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF2837:
+	.string	"SENSOR_ACC"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF2611:
+	.string	"biquadFilter3_s"
+.LASF2612:
+	.string	"biquadFilter3_t"
+.LASF1756:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF2635:
+	.string	"address"
+.LASF1639:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1378:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF1405:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF1927:
+	.string	"ACC_I2C_ADDRESS 0x32"
+.LASF2335:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2239:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1858:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF2008:
+	.string	"LSM303DLHC_ODR_3_0_HZ ((uint8_t) 0x08)"
+.LASF2071:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1331:
+	.string	"math_errhandling 0"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1562:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1292:
+	.string	"_Marg_ _Float32x"
+.LASF797:
+	.string	"__DECL_SIMD_cosl "
+.LASF1788:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF1210:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF2052:
+	.string	"ICM20608G_WHO_AM_I_CONST (0xAF)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF1982:
+	.string	"LSM303DLHC_IT2_INT2 ((uint8_t)0x20)"
+.LASF1239:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF2171:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2010:
+	.string	"LSM303DLHC_ODR_15_HZ ((uint8_t) 0x10)"
+.LASF785:
+	.string	"NULL"
+.LASF2465:
+	.string	"NVIC_PRIO_MPU_INT_EXTI NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF1908:
+	.string	"LSM303DLHC_CLICK_THS_A 0x3A"
+.LASF1255:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2409:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2736:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2039:
+	.string	"LSM303DLHC_TEMPSENSOR_DISABLE ((uint8_t) 0x00)"
+.LASF1929:
+	.string	"LSM303DLHC_NORMAL_MODE ((uint8_t)0x00)"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1511:
+	.string	"__wchar_t__ "
+.LASF1675:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1216:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1589:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1218:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF1440:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF499:
+	.string	"__PMT"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2380:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1525:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2495:
+	.string	"NVIC_PRIO_USB NVIC_BUILD_PRIORITY(2, 0)"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF2477:
+	.string	"NVIC_PRIO_SERIALUART3 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF1584:
+	.string	"USE_SERVOS"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1881:
+	.string	"LSM303DLHC_I2C_INT2_PIN PE5"
+.LASF1641:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1798:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF2697:
+	.string	"MPU_65xx_I2C"
+.LASF2516:
+	.string	"FFT_BIN_COUNT (FFT_WINDOW_SIZE / 2)"
+.LASF1023:
+	.string	"__DECL_SIMD_erff64x "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1737:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2197:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1456:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1983:
+	.string	"LSM303DLHC_IT2_BOOT ((uint8_t)0x10)"
+.LASF1343:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2435:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1583:
+	.string	"USE_RESOURCE_MGMT"
+.LASF976:
+	.string	"__DECL_SIMD_log2f "
+.LASF2598:
+	.string	"PROFILE_CHECK_FUNC"
+.LASF1391:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF2387:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2213:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1268:
+	.string	"_Mdouble_ _Float64x"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1401:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF1025:
+	.string	"__DECL_SIMD_tanh "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1556:
+	.string	"USE_PPM"
+.LASF2526:
+	.string	"GYRO_SYNC_DENOM_DEFAULT 4"
+.LASF2238:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1465:
+	.string	"USE_SERIALRX_IBUS "
+.LASF825:
+	.string	"__DECL_SIMD_log "
+.LASF2166:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2630:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF2370:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1321:
+	.string	"FP_SUBNORMAL 3"
+.LASF2900:
+	.string	"gyroFrequencyNyquist"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1177:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2797:
+	.string	"GYRO_MPU9250"
+.LASF1695:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1958:
+	.string	"LSM303DLHC_HPM_REF_SIGNAL ((uint8_t)0x40)"
+.LASF2163:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1138:
+	.string	"__DECL_SIMD_log2"
+.LASF1533:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF2497:
+	.string	"NVIC_PRIO_SONAR_ECHO NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1569:
+	.string	"TELEMETRY_HOTT"
+.LASF1400:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF2371:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1974:
+	.string	"LSM303DLHC_IT1_AOI1 ((uint8_t)0x40)"
+.LASF1336:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2726:
+	.string	"OWNER_ADC_BATT"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2207:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1887:
+	.string	"LSM303DLHC_CTRL_REG6_A 0x25"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1640:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1090:
+	.string	"__DECL_SIMD_acos"
+.LASF1513:
+	.string	"_WCHAR_T "
+.LASF2552:
+	.string	"DEBUG_BATTERY"
+.LASF2236:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2473:
+	.string	"NVIC_PRIO_SERIALUART2_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF1663:
+	.string	"UNIT_TESTED "
+.LASF829:
+	.string	"__DECL_SIMD_logf32 "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1977:
+	.string	"LSM303DLHC_IT1_DRY2 ((uint8_t)0x08)"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF2318:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1594:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF874:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF811:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF2223:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1080:
+	.string	"__DECL_SIMD_logf"
+.LASF2057:
+	.string	"MPU6500_BIT_RAW_RDY_EN (1 << 0)"
+.LASF2684:
+	.string	"mpuResetFnPtr"
+.LASF2782:
+	.string	"BEEPER_ARMED"
+.LASF2245:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2904:
+	.string	"lpfHz"
+.LASF873:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2297:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2915:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF2258:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1193:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1689:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF2046:
+	.string	"MPU3050_PWR_MGM 0x3E"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1673:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1452:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF925:
+	.string	"__DECL_SIMD_expm1 "
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1938:
+	.string	"LSM303DLHC_ODR_1620_HZ_LP ((uint8_t)0x80)"
+.LASF1313:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2873:
+	.string	"memset"
+.LASF1264:
+	.string	"_Mdouble_ _Float128"
+.LASF1374:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF1765:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1442:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF2021:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_1_3Ga 1100"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2264:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1044:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1419:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF1595:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1422:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF2407:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2404:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2500:
+	.string	"NVIC_PRIO_CALLBACK NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1954:
+	.string	"LSM303DLHC_BLE_MSB ((uint8_t)0x40)"
+.LASF2266:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2665:
+	.string	"exti"
+.LASF1136:
+	.string	"__DECL_SIMD_log10f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1911:
+	.string	"LSM303DLHC_TIME_WINDOW_A 0x3D"
+.LASF2869:
+	.string	"nullFilter3Apply"
+.LASF2225:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1467:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2228:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2097:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2180:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1967:
+	.string	"LSM303DLHC_HPF_CLICK_DISABLE ((uint8_t)0x00)"
+.LASF2338:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1438:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF2102:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF2468:
+	.string	"NVIC_PRIO_WS2811_DMA NVIC_BUILD_PRIORITY(1, 2)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1353:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF2131:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF987:
+	.string	"__DECL_SIMD_log1pl "
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF914:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2575:
+	.string	"TASK_SYSTEM"
+.LASF819:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF992:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2133:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1357:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF2578:
+	.string	"TASK_ATTITUDE"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1417:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF941:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1266:
+	.string	"_Mdouble_ _Float32x"
+.LASF1620:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF936:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2786:
+	.string	"BEEPER_ALL"
+.LASF1221:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2766:
+	.string	"BEEPER_SILENCE"
+.LASF881:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1989:
+	.string	"LSM303DLHC_POS_RECOGNITION ((uint8_t)0xC0)"
+.LASF849:
+	.string	"__DECL_SIMD_powf32 "
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF980:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1342:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1566:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF865:
+	.string	"__DECL_SIMD_atan "
+.LASF1849:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF911:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1822:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1593:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF2283:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1895:
+	.string	"LSM303DLHC_OUT_Z_H_A 0x2D"
+.LASF1272:
+	.string	"__MATHDECL_ALIAS"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1295:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF1481:
+	.string	"CMS "
+.LASF2682:
+	.string	"mpuReadRegisterFnPtr"
+.LASF1130:
+	.string	"__DECL_SIMD_atan2"
+.LASF1995:
+	.string	"LSM303DLHC_X_LOW ((uint8_t)0x01)"
+.LASF2316:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1696:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF2216:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF2774:
+	.string	"BEEPER_BAT_LOW"
+.LASF1281:
+	.string	"_Mret_ float"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF882:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2742:
+	.string	"OWNER_SDCARD"
+.LASF2809:
+	.string	"gyro"
+.LASF1286:
+	.string	"__MATHCALL_NAME"
+.LASF1711:
+	.string	"PG_RX_CONFIG 24"
+.LASF985:
+	.string	"__DECL_SIMD_log1p "
+.LASF2618:
+	.string	"firFilterDenoise_t"
+.LASF1823:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF2352:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1780:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF1057:
+	.string	"__DECL_SIMD_tanl "
+.LASF912:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2015:
+	.string	"LSM303DLHC_FS_1_9_GA ((uint8_t) 0x40)"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1909:
+	.string	"LSM303DLHC_TIME_LIMIT_A 0x3B"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1330:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1736:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1862:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1610:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2016:
+	.string	"LSM303DLHC_FS_2_5_GA ((uint8_t) 0x60)"
+.LASF1097:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1733:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF2285:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1384:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF2528:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2065:
+	.string	"BITS_DLPF_CFG_42HZ 0x03"
+.LASF2531:
+	.string	"signed char"
+.LASF1194:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF2829:
+	.string	"gyroIsrCallbackFn"
+.LASF1667:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF830:
+	.string	"__DECL_SIMD_logf64 "
+.LASF813:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2186:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2550:
+	.string	"DEBUG_NONE"
+.LASF1950:
+	.string	"LSM303DLHC_FULLSCALE_16G ((uint8_t)0x30)"
+.LASF2453:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF929:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1477:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1316:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1478:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1535:
+	.string	"U_ID_1 1"
+.LASF2149:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1209:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF1164:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1555:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1521:
+	.string	"_WCHAR_T_H "
+.LASF2683:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1704:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1144:
+	.string	"__DECL_SIMD_log1pf"
+.LASF2686:
+	.string	"readFn"
+.LASF2576:
+	.string	"TASK_GYROPID"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1743:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1612:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1624:
+	.string	"sq(x) ((x)*(x))"
+.LASF809:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF981:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1289:
+	.string	"_Mret_ double"
+.LASF2463:
+	.string	"NVIC_PRIO_SONAR_EXTI NVIC_BUILD_PRIORITY(2, 0)"
+.LASF1111:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1656:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1665:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1928:
+	.string	"MAG_I2C_ADDRESS 0x3C"
+.LASF2344:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2263:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2499:
+	.string	"NVIC_PRIO_MAG_DATA_READY NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF2438:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1095:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1196:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2770:
+	.string	"BEEPER_DISARMING"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1219:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1411:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF1476:
+	.string	"TELEMETRY_LTM "
+.LASF2817:
+	.string	"gyro_isr_update"
+.LASF1446:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1905:
+	.string	"LSM303DLHC_INT2_DURATION_A 0x37"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF2095:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1128:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF977:
+	.string	"__DECL_SIMD_log2l "
+.LASF1898:
+	.string	"LSM303DLHC_INT1_CFG_A 0x30"
+.LASF1836:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1960:
+	.string	"LSM303DLHC_HPM_AUTORESET_INT ((uint8_t)0xC0)"
+.LASF1712:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1078:
+	.string	"__DECL_SIMD_log"
+.LASF2839:
+	.string	"SENSOR_MAG"
+.LASF1824:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2544:
+	.string	"uint32_t"
+.LASF1185:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2341:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2764:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1599:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1597:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2798:
+	.string	"GYRO_ICM20601"
+.LASF1258:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2175:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1888:
+	.string	"LSM303DLHC_REFERENCE_A 0x26"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2609:
+	.string	"state"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF1685:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1285:
+	.string	"_Marg_"
+.LASF1036:
+	.string	"__DECL_SIMD_asinhf "
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2825:
+	.string	"gyro_dyn_notch_q"
+.LASF1471:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1499:
+	.string	"_ANSI_STDDEF_H "
+.LASF1766:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1432:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF2757:
+	.string	"OWNER_OSD"
+.LASF821:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1396:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF2119:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2353:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2436:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2628:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF831:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2402:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2296:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1084:
+	.string	"__DECL_SIMD_expf"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF2874:
+	.string	"gyroRateDps"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1081:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2699:
+	.string	"MPU_9250_SPI"
+.LASF2820:
+	.string	"gyro_soft_notch_hz_1"
+.LASF2822:
+	.string	"gyro_soft_notch_hz_2"
+.LASF2134:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1346:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF2104:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2512:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1211:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF2803:
+	.string	"GYRO_FAKE"
+.LASF2141:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2861:
+	.string	"biquadFilter3Init"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2504:
+	.string	"NVIC_PRIORITY_BASE(prio) (((prio)>>(4-(7-(NVIC_PRIORITY_GROUPING>>8))))>>4)"
+.LASF888:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1299:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF2178:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2084:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF822:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1768:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF2012:
+	.string	"LSM303DLHC_ODR_75_HZ ((uint8_t) 0x18)"
+.LASF1195:
+	.string	"__f32(x) x ##f32"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1320:
+	.string	"FP_ZERO 2"
+.LASF2678:
+	.string	"sensorGyroReadFuncPtr"
+.LASF1844:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2076:
+	.string	"IOCFG_AF_OD 0"
+.LASF2379:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF815:
+	.string	"__DECL_SIMD_sincos "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF2127:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF838:
+	.string	"__DECL_SIMD_expf16 "
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2110:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1616:
+	.string	"LOAD_PERCENTAGE_ONE 100"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1841:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF2898:
+	.string	"notchHz"
+.LASF2491:
+	.string	"NVIC_PRIO_SERIALUART8_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF2310:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1098:
+	.string	"__DECL_SIMD_asin"
+.LASF1959:
+	.string	"LSM303DLHC_HPM_NORMAL_MODE ((uint8_t)0x80)"
+.LASF2899:
+	.string	"notchCutoffHz"
+.LASF1741:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF982:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1480:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1119:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF2033:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_5_6Ga 295"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2295:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2446:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2670:
+	.string	"gyroRateKHz"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1139:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1233:
+	.string	"FP_INT_TONEAREST 4"
+.LASF2091:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2847:
+	.string	"softLpfFilter"
+.LASF1715:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1270:
+	.string	"__MATHDECL_1_IMPL"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1253:
+	.string	"_Mdouble_ float"
+.LASF2538:
+	.string	"long int"
+.LASF2301:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1102:
+	.string	"__DECL_SIMD_hypot"
+.LASF1708:
+	.string	"PG_SERVO_MIXER 21"
+.LASF2713:
+	.string	"GYRO_RATE_1_kHz"
+.LASF1504:
+	.string	"_PTRDIFF_T_ "
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1752:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1932:
+	.string	"LSM303DLHC_ODR_10_HZ ((uint8_t)0x20)"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2265:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1636:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF1014:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1869:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2732:
+	.string	"OWNER_PINDEBUG"
+.LASF2158:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2425:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1993:
+	.string	"LSM303DLHC_Y_LOW ((uint8_t)0x04)"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2030:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_2_5Ga 600"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1948:
+	.string	"LSM303DLHC_FULLSCALE_4G ((uint8_t)0x10)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF2714:
+	.string	"GYRO_RATE_3200_Hz"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1903:
+	.string	"LSM303DLHC_INT2_SOURCE_A 0x35"
+.LASF2882:
+	.string	"held"
+.LASF1482:
+	.string	"TELEMETRY_CRSF "
+.LASF2902:
+	.string	"gyroInitFilterNotch1"
+.LASF2897:
+	.string	"gyroInitFilterNotch2"
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1650:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2842:
+	.string	"SENSOR_GPSMAG"
+.LASF1816:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF2859:
+	.string	"lrintf"
+.LASF2322:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1503:
+	.string	"__PTRDIFF_T "
+.LASF1495:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF942:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1973:
+	.string	"LSM303DLHC_IT1_CLICK ((uint8_t)0x80)"
+.LASF1984:
+	.string	"LSM303DLHC_IT2_ACT ((uint8_t)0x08)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1240:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1540:
+	.string	"ACC "
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1699:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF2324:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2580:
+	.string	"TASK_SERIAL"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2734:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF945:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1799:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1648:
+	.string	"EXPAND_I(x) x"
+.LASF2125:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF2401:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1867:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1574:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2880:
+	.string	"gyroUpdate"
+.LASF1246:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2273:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1860:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF2268:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1300:
+	.string	"_Mret_ _Float32x"
+.LASF1074:
+	.string	"__DECL_SIMD_sincos"
+.LASF1893:
+	.string	"LSM303DLHC_OUT_Y_H_A 0x2B"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1534:
+	.string	"U_ID_0 0"
+.LASF2372:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1147:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF1143:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1157:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1199:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1349:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2917:
+	.string	"gyroDetect"
+.LASF2363:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF975:
+	.string	"__DECL_SIMD_log2 "
+.LASF2156:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2474:
+	.string	"NVIC_PRIO_SERIALUART2 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF1529:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2712:
+	.string	"mpuDetectionResult_t"
+.LASF963:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2513:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF994:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1435:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1142:
+	.string	"__DECL_SIMD_log1p"
+.LASF2011:
+	.string	"LSM303DLHC_ODR_30_HZ ((uint8_t) 0x14)"
+.LASF1200:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF2799:
+	.string	"GYRO_ICM20602"
+.LASF1004:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2383:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2679:
+	.string	"sensorGyroUpdateFuncPtr"
+.LASF1632:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1751:
+	.string	"PG_PID_CONFIG 504"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF2369:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1202:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF845:
+	.string	"__DECL_SIMD_pow "
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1568:
+	.string	"TELEMETRY_FRSKY"
+.LASF2530:
+	.string	"long unsigned int"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1332:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1345:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1236:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1731:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2549:
+	.string	"debugMode"
+.LASF1514:
+	.string	"_T_WCHAR_ "
+.LASF2643:
+	.string	"extiCallbackRec_s"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1430:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF2029:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_1_9Ga 760"
+.LASF2174:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1833:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1601:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF2579:
+	.string	"TASK_RX"
+.LASF814:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1399:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF1100:
+	.string	"__DECL_SIMD_asinf"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF2599:
+	.string	"PROFILE_SCHEDULER"
+.LASF1526:
+	.string	"__DEFINED_wchar_t "
+.LASF2733:
+	.string	"OWNER_TIMER"
+.LASF2116:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1732:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1457:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2160:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2590:
+	.string	"TASK_COUNT"
+.LASF1572:
+	.string	"TELEMETRY_SRXL"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1904:
+	.string	"LSM303DLHC_INT2_THS_A 0x36"
+.LASF2360:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"USE_FAKE_MAG "
+.LASF2867:
+	.string	"biquadFilter3InitLPF"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1587:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF2608:
+	.string	"pt1Filter3_s"
+.LASF2610:
+	.string	"pt1Filter3_t"
+.LASF1088:
+	.string	"__DECL_SIMD_powf"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF2860:
+	.string	"alignSensors"
+.LASF1582:
+	.string	"BLACKBOX"
+.LASF1943:
+	.string	"LSM303DLHC_AXES_ENABLE ((uint8_t)0x07)"
+.LASF2539:
+	.string	"char"
+.LASF1278:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1838:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF971:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2230:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF885:
+	.string	"__DECL_SIMD_hypot "
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1585:
+	.string	"USE_DSHOT"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF2442:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1897:
+	.string	"LSM303DLHC_FIFO_SRC_REG_A 0x2F"
+.LASF1188:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2167:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1427:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF1952:
+	.string	"LSM303DLHC_BlockUpdate_Single ((uint8_t)0x80)"
+.LASF2314:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2189:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2075:
+	.string	"IOCFG_AF_PP 0"
+.LASF968:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1560:
+	.string	"USE_SERIALRX_IBUS"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF2639:
+	.string	"IO_t"
+.LASF1223:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2294:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2908:
+	.string	"gyroInit"
+.LASF1445:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF841:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1306:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF800:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF972:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF864:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1787:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF2355:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1770:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1965:
+	.string	"LSM303DLHC_HIGHPASSFILTER_DISABLE ((uint8_t)0x00)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2745:
+	.string	"OWNER_FLASH_CS"
+.LASF2302:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1228:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1565:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1490:
+	.string	"USE_RX_MSP "
+.LASF1644:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2276:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF1575:
+	.string	"TELEMETRY_IBUS"
+.LASF401:
+	.string	"true 1"
+.LASF1821:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF802:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1066:
+	.string	"__DECL_SIMD_cos"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2130:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF2459:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF1633:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF856:
+	.string	"__DECL_SIMD_acosf "
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1922:
+	.string	"LSM303DLHC_IRA_REG_M 0x0A"
+.LASF2659:
+	.string	"gyroDev_s"
+.LASF2718:
+	.string	"gyroDev_t"
+.LASF2596:
+	.string	"PROFILE_MIX_TABLE"
+.LASF842:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2557:
+	.string	"DEBUG_PIDLOOP"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1104:
+	.string	"__DECL_SIMD_hypotf"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1754:
+	.string	"PG_PPM_CONFIG 507"
+.LASF2700:
+	.string	"ICM_20601_SPI"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1795:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1183:
+	.string	"__HAVE_FLOAT32 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF2851:
+	.string	"notchFilter2"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF2600:
+	.string	"PROFILE_TASK_FIRST"
+.LASF1937:
+	.string	"LSM303DLHC_ODR_400_HZ ((uint8_t)0x70)"
+.LASF944:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1115:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF1455:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1558:
+	.string	"SERIAL_RX"
+.LASF1902:
+	.string	"LSM303DLHC_INT2_CFG_A 0x34"
+.LASF2520:
+	.string	"FFT_STEPS_PER_AXIS 3"
+.LASF1607:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1611:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF937:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1121:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1361:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF880:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2279:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF2652:
+	.string	"CW180_DEG_FLIP"
+.LASF2458:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF2004:
+	.string	"LSM303DLHC_INT1INTERRUPT_LOW_EDGE ((uint8_t)0x20)"
+.LASF1192:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2421:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1559:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1724:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1588:
+	.string	"USE_PROFILE "
+.LASF1900:
+	.string	"LSM303DLHC_INT1_THS_A 0x32"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1969:
+	.string	"LSM303DLHC_HPF_AOI1_DISABLE ((uint8_t)0x00)"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1443:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF1580:
+	.string	"VTX_SMARTAUDIO"
+.LASF1466:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2737:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2195:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2729:
+	.string	"OWNER_ADC_RSSI"
+.LASF1661:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1137:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2356:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2585:
+	.string	"TASK_COMPASS"
+.LASF1368:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1105:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF810:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF906:
+	.string	"__DECL_SIMD_exp10f "
+.LASF839:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1284:
+	.string	"_Mret_"
+.LASF2488:
+	.string	"NVIC_PRIO_SERIALUART7_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF2173:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2211:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1328:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1169:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1528:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2082:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF2581:
+	.string	"TASK_DISPATCH"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1502:
+	.string	"_T_PTRDIFF "
+.LASF870:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF2891:
+	.string	"isOnFirstGyroCalibrationCycle"
+.LASF1062:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1005:
+	.string	"__DECL_SIMD_acosh "
+.LASF2783:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2288:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF2025:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_4_7Ga 400"
+.LASF1429:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF1541:
+	.string	"USE_FAKE_ACC "
+.LASF1925:
+	.string	"LSM303DLHC_TEMP_OUT_H_M 0x31"
+.LASF2871:
+	.string	"fakeGyroDetect"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1315:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1753:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF2519:
+	.string	"FFT_UPDATE_RATE_HZ 300"
+.LASF2336:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2768:
+	.string	"BEEPER_RX_LOST"
+.LASF1447:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1226:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1318:
+	.string	"FP_NAN 0"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF2299:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1934:
+	.string	"LSM303DLHC_ODR_50_HZ ((uint8_t)0x40)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2561:
+	.string	"DEBUG_DTERM_FILTER"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF918:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF2597:
+	.string	"PROFILE_HANDLE_BLACKBOX"
+.LASF1015:
+	.string	"__DECL_SIMD_erf "
+.LASF2694:
+	.string	"MPU_3050"
+.LASF2494:
+	.string	"NVIC_PRIO_I2C_EV NVIC_BUILD_PRIORITY(0, 0)"
+.LASF1107:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2251:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2647:
+	.string	"CW90_DEG"
+.LASF2359:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1222:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2658:
+	.string	"sensorGyroInitFuncPtr"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1832:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2431:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2654:
+	.string	"sensor_align_e"
+.LASF2377:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2162:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2795:
+	.string	"GYRO_MPU6000"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1152:
+	.string	"__DECL_SIMD_acoshf"
+.LASF1355:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF2001:
+	.string	"LSM303DLHC_X_SINGLE_CLICK ((uint8_t)0x01)"
+.LASF2292:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1367:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF1956:
+	.string	"LSM303DLHC_BOOT_REBOOTMEMORY ((uint8_t)0x80)"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2229:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1131:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF2514:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1955:
+	.string	"LSM303DLHC_BOOT_NORMALMODE ((uint8_t)0x00)"
+.LASF1706:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF2250:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2155:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2556:
+	.string	"DEBUG_AIRMODE"
+.LASF1077:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1424:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF1230:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF1940:
+	.string	"LSM303DLHC_X_ENABLE ((uint8_t)0x01)"
+.LASF855:
+	.string	"__DECL_SIMD_acos "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2689:
+	.string	"verifywriteFn"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1609:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF832:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1742:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1679:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1657:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2271:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2551:
+	.string	"DEBUG_CYCLETIME"
+.LASF2566:
+	.string	"DEBUG_ESC_SENSOR_RPM"
+.LASF1458:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1204:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1444:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF2656:
+	.string	"csnPin"
+.LASF1087:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2347:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2547:
+	.string	"double"
+.LASF1882:
+	.string	"LSM303DLHC_CTRL_REG1_A 0x20"
+.LASF2521:
+	.string	"FFT_AXIS_UPDATE_HZ ((float)FFT_UPDATE_RATE_HZ / (FFT_STEPS_PER_AXIS * XYZ_AXIS_COUNT))"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF2203:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1801:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF858:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1764:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF2428:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2085:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1653:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1203:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1397:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF2740:
+	.string	"OWNER_I2C_SCL"
+.LASF1092:
+	.string	"__DECL_SIMD_acosf"
+.LASF1968:
+	.string	"LSM303DLHC_HPF_CLICK_ENABLE ((uint8_t)0x04)"
+.LASF1150:
+	.string	"__DECL_SIMD_acosh"
+.LASF2889:
+	.string	"gyroReadTemperature"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2763:
+	.string	"OWNER_COMPASS_CS"
+.LASF1517:
+	.string	"_WCHAR_T_ "
+.LASF1539:
+	.string	"USE_FAKE_GYRO "
+.LASF2864:
+	.string	"firFilterDenoise3Update"
+.LASF1831:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF805:
+	.string	"__DECL_SIMD_sin "
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1692:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2583:
+	.string	"TASK_BATTERY_CURRENT"
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF2208:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2224:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1686:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1518:
+	.string	"_BSD_WCHAR_T_ "
+.LASF903:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2231:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2274:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF2066:
+	.string	"GYRO_SCALE_FACTOR 0.00053292f"
+.LASF1681:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2087:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1786:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1602:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2202:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1341:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2855:
+	.string	"schedulerResetTaskStatistics"
+.LASF2399:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2247:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2536:
+	.string	"__int32_t"
+.LASF1224:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2801:
+	.string	"GYRO_ICM20689"
+.LASF2741:
+	.string	"OWNER_I2C_SDA"
+.LASF2537:
+	.string	"__uint32_t"
+.LASF866:
+	.string	"__DECL_SIMD_atanf "
+.LASF1634:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF2325:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1827:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF1807:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2586:
+	.string	"TASK_BARO"
+.LASF1638:
+	.string	"Q12 (1 << 12)"
+.LASF2816:
+	.string	"gyro_soft_lpf_hz"
+.LASF2657:
+	.string	"busDevice_t"
+.LASF2673:
+	.string	"dataReadyAtUs"
+.LASF1460:
+	.string	"USE_CLI "
+.LASF2272:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2704:
+	.string	"BMI_160_SPI"
+.LASF1156:
+	.string	"__DECL_SIMD_erff"
+.LASF2405:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2150:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1840:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF2132:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF2403:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2524:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF2746:
+	.string	"OWNER_FLASH"
+.LASF857:
+	.string	"__DECL_SIMD_acosl "
+.LASF1293:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF1738:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF2846:
+	.string	"softLpfFilterApplyFn"
+.LASF1083:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2117:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF2002:
+	.string	"LSM303DLHC_INT1INTERRUPT_DISABLE ((uint8_t)0x00)"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1109:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF1181:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1153:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1241:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF846:
+	.string	"__DECL_SIMD_powf "
+.LASF1243:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1515:
+	.string	"_T_WCHAR "
+.LASF2715:
+	.string	"GYRO_RATE_8_kHz"
+.LASF2205:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF2440:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1132:
+	.string	"__DECL_SIMD_atan2f"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF2062:
+	.string	"BITS_DLPF_CFG_256HZ 0x00"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2587:
+	.string	"TASK_ALTITUDE"
+.LASF2193:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1376:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF2343:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF883:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1498:
+	.string	"_STDDEF_H_ "
+.LASF2089:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1980:
+	.string	"LSM303DLHC_IT2_CLICK ((uint8_t)0x80)"
+.LASF875:
+	.string	"__DECL_SIMD_asin "
+.LASF2456:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2827:
+	.string	"gyroConfig_t"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2210:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1065:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1274:
+	.string	"__MATHCALL"
+.LASF969:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1642:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2334:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1388:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF2472:
+	.string	"NVIC_PRIO_SERIALUART2_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2773:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1576:
+	.string	"USE_DASHBOARD"
+.LASF1714:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1901:
+	.string	"LSM303DLHC_INT1_DURATION_A 0x33"
+.LASF2143:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2419:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1767:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF2613:
+	.string	"firFilterDenoise_s"
+.LASF2243:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1338:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF1448:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1335:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF2758:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF1022:
+	.string	"__DECL_SIMD_erff32x "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1494:
+	.string	"VTX_CONTROL "
+.LASF995:
+	.string	"__DECL_SIMD_atanh "
+.LASF2483:
+	.string	"NVIC_PRIO_SERIALUART5 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF2345:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2761:
+	.string	"OWNER_TRANSPONDER"
+.LASF2622:
+	.string	"FILTER_LPF"
+.LASF2055:
+	.string	"MPU6500_BIT_BYPASS_EN (1 << 1)"
+.LASF1225:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1826:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1859:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF907:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2331:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1818:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF1926:
+	.string	"LSM303DLHC_TEMP_OUT_L_M 0x32"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2196:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2109:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1630:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2187:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1505:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1173:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF2707:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1892:
+	.string	"LSM303DLHC_OUT_Y_L_A 0x2A"
+.LASF1162:
+	.string	"__DECL_SIMD_asinh"
+.LASF2317:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1785:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF2791:
+	.string	"GYRO_MPU6050"
+.LASF2481:
+	.string	"NVIC_PRIO_SERIALUART5_TXDMA NVIC_BUILD_PRIORITY(1, 0)"
+.LASF924:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2255:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF886:
+	.string	"__DECL_SIMD_hypotf "
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF2850:
+	.string	"notchFilter2ApplyFn"
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF2662:
+	.string	"temperature"
+.LASF820:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2445:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2589:
+	.string	"TASK_MSP_PUSH"
+.LASF1907:
+	.string	"LSM303DLHC_CLICK_SOURCE_A 0x39"
+.LASF871:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1297:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1190:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1324:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF382:
+	.string	"unix 1"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF2573:
+	.string	"timeUs_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1360:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF1148:
+	.string	"__DECL_SIMD_atanhf"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF964:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF2812:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF850:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1363:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF1151:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF1891:
+	.string	"LSM303DLHC_OUT_X_H_A 0x29"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF816:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2626:
+	.string	"pgn_t"
+.LASF2061:
+	.string	"MPU6000_CONFIG 0x1A"
+.LASF2570:
+	.string	"DEBUG_GYRO_TO_MOTOR"
+.LASF1889:
+	.string	"LSM303DLHC_STATUS_REG_A 0x27"
+.LASF2327:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1175:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1691:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2439:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2032:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_4_7Ga 355"
+.LASF1805:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF872:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2784:
+	.string	"BEEPER_USB"
+.LASF1963:
+	.string	"LSM303DLHC_HPFCF_32 ((uint8_t)0x20)"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF2559:
+	.string	"DEBUG_RC_INTERPOLATION"
+.LASF2778:
+	.string	"BEEPER_ACC_CALIBRATION"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF2677:
+	.string	"mpuConfiguration"
+.LASF2769:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF896:
+	.string	"__DECL_SIMD_exp2f "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF2489:
+	.string	"NVIC_PRIO_SERIALUART7 NVIC_BUILD_PRIORITY(1, 2)"
+.LASF812:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF2840:
+	.string	"SENSOR_SONAR"
+.LASF1658:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1112:
+	.string	"__DECL_SIMD_exp10f"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2333:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2890:
+	.string	"gyroSetCalibrationCycles"
+.LASF2716:
+	.string	"GYRO_RATE_32_kHz"
+.LASF2346:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1174:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1552:
+	.string	"USE_UART7 "
+.LASF2423:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2020:
+	.string	"LSM303DLHC_FS_8_1_GA ((uint8_t) 0xE0)"
+.LASF2406:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF2717:
+	.string	"gyroRateKHz_e"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF2826:
+	.string	"gyro_dyn_notch_min_hz"
+.LASF2711:
+	.string	"resolution"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1096:
+	.string	"__DECL_SIMD_atanf"
+.LASF1259:
+	.string	"_Mdouble_ _Float32"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2813:
+	.string	"gyro_sync_denom"
+.LASF2107:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1693:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2035:
+	.string	"LSM303DLHC_CONTINUOS_CONVERSION ((uint8_t) 0x00)"
+.LASF986:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1687:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1369:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF1071:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF1919:
+	.string	"LSM303DLHC_OUT_Y_H_M 0x07"
+.LASF2027:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_8_1Ga 230"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1659:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF923:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF930:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2136:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF2044:
+	.string	"MPU3050_GYRO_OUT 0x1D"
+.LASF2591:
+	.string	"TASK_NONE"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1375:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF1608:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1034:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2719:
+	.string	"OWNER_FREE"
+.LASF2503:
+	.string	"NVIC_BUILD_PRIORITY(base,sub) (((((base)<<(4-(7-(NVIC_PRIORITY_GROUPING>>8))))|((sub)&(0x0f>>(7-(NVIC_PRIORITY_GROUPING>>8)))))<<4)&0xf0)"
+.LASF905:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1604:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1820:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF919:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF893:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF2676:
+	.string	"mpuIntExtiConfig"
+.LASF1451:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF2563:
+	.string	"DEBUG_ESC_SENSOR"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF2121:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF2019:
+	.string	"LSM303DLHC_FS_5_6_GA ((uint8_t) 0xC0)"
+.LASF1623:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF2101:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF2602:
+	.string	"m_oldM"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1058:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1792:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF2604:
+	.string	"m_oldS"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1436:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF2470:
+	.string	"NVIC_PRIO_SERIALUART1_RXDMA NVIC_BUILD_PRIORITY(1, 1)"
+.LASF2140:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF2789:
+	.string	"GYRO_NONE"
+.LASF2720:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2441:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2506:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1864:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1076:
+	.string	"__DECL_SIMD_sincosf"
+.LASF1774:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1976:
+	.string	"LSM303DLHC_IT1_DRY1 ((uint8_t)0x10)"
+.LASF2003:
+	.string	"LSM303DLHC_INT1INTERRUPT_ENABLE ((uint8_t)0x80)"
+.LASF2304:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF2256:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF853:
+	.string	"__DECL_SIMD_powf64x "
+.LASF803:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1981:
+	.string	"LSM303DLHC_IT2_INT1 ((uint8_t)0x40)"
+.LASF1803:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1800:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1662:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1590:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1962:
+	.string	"LSM303DLHC_HPFCF_16 ((uint8_t)0x10)"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF867:
+	.string	"__DECL_SIMD_atanl "
+.LASF1553:
+	.string	"USE_UART8 "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1294:
+	.string	"_Marg_ _Float64"
+.LASF1046:
+	.string	"__DECL_SIMD_erfcf "
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1964:
+	.string	"LSM303DLHC_HPFCF_64 ((uint8_t)0x30)"
+.LASF1843:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1282:
+	.string	"_Marg_ double"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1506:
+	.string	"___int_ptrdiff_t_h "
+.LASF1875:
+	.string	"LSM303DLHC_LONG_TIMEOUT ((uint32_t)(10 * LSM303DLHC_FLAG_TIMEOUT))"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF1302:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF965:
+	.string	"__DECL_SIMD_log10 "
+.LASF1781:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF998:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF978:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF2623:
+	.string	"FILTER_NOTCH"
+.LASF1021:
+	.string	"__DECL_SIMD_erff128 "
+.LASF904:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2790:
+	.string	"GYRO_DEFAULT"
+.LASF2892:
+	.string	"gyroCalculateCalibratingCycles"
+.LASF2805:
+	.string	"gyro_s"
+.LASF2808:
+	.string	"gyro_t"
+.LASF938:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2147:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF2824:
+	.string	"gyro_dyn_notch"
+.LASF2510:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF2038:
+	.string	"LSM303DLHC_TEMPSENSOR_ENABLE ((uint8_t) 0x80)"
+.LASF2702:
+	.string	"ICM_20608_SPI"
+.LASF859:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1356:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2893:
+	.string	"isOnFinalGyroCalibrationCycle"
+.LASF1410:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF2691:
+	.string	"gyroReadXRegister"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1123:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF847:
+	.string	"__DECL_SIMD_powl "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2200:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1287:
+	.string	"_Marg_ long double"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF2073:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1385:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF2554:
+	.string	"DEBUG_ACCELEROMETER"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2043:
+	.string	"MPU3050_TEMP_OUT 0x1B"
+.LASF2022:
+	.string	"LSM303DLHC_M_SENSITIVITY_XY_1_9Ga 855"
+.LASF2863:
+	.string	"firFilterDenoiseInit"
+.LASF1697:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2743:
+	.string	"OWNER_SDCARD_CS"
+.LASF1262:
+	.string	"_Mdouble_ _Float64"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2884:
+	.string	"gyroSetIsrCallback"
+.LASF2567:
+	.string	"DEBUG_ESC_SENSOR_TMP"
+.LASF2280:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1377:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF1664:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2910:
+	.string	"gyroMpuDetectionResult"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1845:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF2349:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2836:
+	.string	"SENSOR_GYRO"
+.LASF1269:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF2105:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2013:
+	.string	"LSM303DLHC_ODR_220_HZ ((uint8_t) 0x1C)"
+.LASF2909:
+	.string	"gyroHardware"
+.LASF1846:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF2088:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF2009:
+	.string	"LSM303DLHC_ODR_7_5_HZ ((uint8_t) 0x0C)"
+.LASF926:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1729:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1546:
+	.string	"USE_UART1 "
+.LASF2901:
+	.string	"notchQ"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1978:
+	.string	"LSM303DLHC_IT1_WTM ((uint8_t)0x04)"
+.LASF1847:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF2426:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2054:
+	.string	"MPU6500_BIT_RESERVED (1 << 0)"
+.LASF1819:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF2312:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1945:
+	.string	"LSM303DLHC_HR_ENABLE ((uint8_t)0x08)"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2221:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2698:
+	.string	"MPU_65xx_SPI"
+.LASF1855:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2843:
+	.string	"gyroDev0"
+.LASF1946:
+	.string	"LSM303DLHC_HR_DISABLE ((uint8_t)0x00)"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1873:
+	.string	"LSM303DLHC_FAIL ((uint32_t) 0)"
+.LASF2177:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1705:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2244:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF1016:
+	.string	"__DECL_SIMD_erff "
+.LASF1416:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1825:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1327:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1290:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF1757:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1352:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2710:
+	.string	"sensor"
+.LASF2323:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1403:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2204:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1554:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF887:
+	.string	"__DECL_SIMD_hypotl "
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF798:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF2625:
+	.string	"filter3ApplyFnPtr"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1463:
+	.string	"SERIAL_RX "
+.LASF2081:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2760:
+	.string	"OWNER_LED_STRIP"
+.LASF2340:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1547:
+	.string	"USE_UART2 "
+.LASF1493:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1496:
+	.string	"VTX_TRAMP "
+.LASF2709:
+	.string	"mpuDetectionResult_s"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF2906:
+	.string	"gyroFilterPt1"
+.LASF1605:
+	.string	"__disable_irq() "
+.LASF1154:
+	.string	"__DECL_SIMD_erf"
+.LASF955:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2252:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1326:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1407:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1579:
+	.string	"VTX_CONTROL"
+.LASF817:
+	.string	"__DECL_SIMD_sincosl "
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2293:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2448:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1790:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF2834:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2031:
+	.string	"LSM303DLHC_M_SENSITIVITY_Z_4Ga 400"
+.LASF1359:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF2534:
+	.string	"short int"
+.LASF1413:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF1728:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2232:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2253:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF2111:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF897:
+	.string	"__DECL_SIMD_exp2l "
+.LASF834:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1362:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF1548:
+	.string	"USE_UART3 "
+.LASF1242:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF2328:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1739:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1848:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1931:
+	.string	"LSM303DLHC_ODR_1_HZ ((uint8_t)0x10)"
+.LASF1333:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2706:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2845:
+	.string	"calibratingG"
+.LASF1093:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF2772:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1086:
+	.string	"__DECL_SIMD_pow"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2588:
+	.string	"TASK_TELEMETRY"
+.LASF2467:
+	.string	"NVIC_PRIO_MAG_INT_EXTI NVIC_BUILD_PRIORITY(0x0f, 0x0f)"
+.LASF2747:
+	.string	"OWNER_BARO_CS"
+.LASF2680:
+	.string	"sensorGyroReadDataFuncPtr"
+.LASF2771:
+	.string	"BEEPER_ARMING"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1740:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF2632:
+	.string	"pgResetFunc"
+.LASF1747:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF2170:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2182:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1629:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF2429:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2748:
+	.string	"OWNER_MPU_CS"
+.LASF2493:
+	.string	"NVIC_PRIO_I2C_ER NVIC_BUILD_PRIORITY(0, 0)"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF2595:
+	.string	"PROFILE_PID_CONTROLLER"
+.LASF2905:
+	.string	"gyroFilterLPF"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF2529:
+	.string	"unsigned int"
+.LASF2830:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1549:
+	.string	"USE_UART4 "
+.LASF889:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1054:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2260:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1317:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2828:
+	.string	"gyroConfig_System"
+.LASF2083:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2259:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1643:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1810:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1771:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF1852:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF956:
+	.string	"__DECL_SIMD_atan2f "
+.LASF2866:
+	.string	"pt1Filter3Apply"
+.LASF1721:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF2390:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhl "
+.LASF2868:
+	.string	"biquadFilter3Apply"
+.LASF1763:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1365:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1755:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1710:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1366:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF2725:
+	.string	"OWNER_ADC"
+.LASF908:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2752:
+	.string	"OWNER_MPU_EXTI"
+.LASF806:
+	.string	"__DECL_SIMD_sinf "
+.LASF2637:
+	.string	"pgRegistry_t"
+.LASF958:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2191:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1379:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF2108:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2358:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1550:
+	.string	"USE_UART5 "
+.LASF2375:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1885:
+	.string	"LSM303DLHC_CTRL_REG4_A 0x23"
+.LASF1700:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1120:
+	.string	"__DECL_SIMD_expm1f"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF1782:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF1921:
+	.string	"LSM303DLHC_SR_REG_M 0x09"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1573:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2728:
+	.string	"OWNER_ADC_EXT"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2430:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1746:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2214:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2172:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF2648:
+	.string	"CW180_DEG"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2916:
+	.string	"micros"
+.LASF2888:
+	.string	"gyroDev"
+.LASF1182:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2749:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2416:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1618:
+	.string	"PROFILE_TASK(taskId) ((profileProbe_e)(PROFILE_TASK_FIRST + (taskId)))"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1340:
+	.string	"M_E 2.7182818284590452354"
+.LASF2078:
+	.string	"IOCFG_IPU 0"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1886:
+	.string	"LSM303DLHC_CTRL_REG5_A 0x24"
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1418:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2432:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1551:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2427:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2222:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3003:
+	.string	"accgyro_l3gd20.h"
+.LASF2984:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2933:
+	.string	"/usr/include"
+.LASF2990:
+	.string	"mathcalls-helper-functions.h"
+.LASF2986:
+	.string	"floatn-common.h"
+.LASF2966:
+	.string	"stdint.h"
+.LASF2918:
+	.string	"src/main/build"
+.LASF2930:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2965:
+	.string	"stdbool.h"
+.LASF3012:
+	.string	"accgyro_spi_mpu6500.h"
+.LASF2992:
+	.string	"iscanonical.h"
+.LASF3001:
+	.string	"accgyro_bma280.h"
+.LASF2970:
+	.string	"wordsize.h"
+.LASF2926:
+	.string	"src/main/target/SITL"
+.LASF2940:
+	.string	"time.h"
+.LASF2942:
+	.string	"profile.h"
+.LASF2996:
+	.string	"common_post.h"
+.LASF2967:
+	.string	"libc-header-start.h"
+.LASF2993:
+	.string	"platform.h"
+.LASF2934:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2945:
+	.string	"filter.h"
+.LASF2952:
+	.string	"resource.h"
+.LASF2958:
+	.string	"boardalignment.h"
+.LASF3020:
+	.string	"statusindicator.h"
+.LASF2939:
+	.string	"debug.h"
+.LASF2964:
+	.string	"stdc-predef.h"
+.LASF2950:
+	.string	"accgyro.h"
+.LASF2982:
+	.string	"math.h"
+.LASF2929:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2948:
+	.string	"exti.h"
+.LASF3011:
+	.string	"accgyro_spi_mpu6000.h"
+.LASF2968:
+	.string	"features.h"
+.LASF3008:
+	.string	"accgyro_mpu6500.h"
+.LASF2923:
+	.string	"src/main/io"
+.LASF2983:
+	.string	"math-vector.h"
+.LASF3013:
+	.string	"accgyro_spi_mpu9250.h"
+.LASF2920:
+	.string	"src/main/config"
+.LASF2969:
+	.string	"features-time64.h"
+.LASF2981:
+	.string	"strings.h"
+.LASF3010:
+	.string	"accgyro_spi_icm20689.h"
+.LASF2961:
+	.string	"gyro_sync.h"
+.LASF2953:
+	.string	"beeper.h"
+.LASF2959:
+	.string	"runtime_config.h"
+.LASF3002:
+	.string	"accgyro_l3g4200d.h"
+.LASF2988:
+	.string	"fp-logb.h"
+.LASF2954:
+	.string	"gyro.h"
+.LASF2977:
+	.string	"time64.h"
+.LASF2962:
+	.string	"string.h"
+.LASF2995:
+	.string	"target.h"
+.LASF3017:
+	.string	"io_def.h"
+.LASF3014:
+	.string	"bus_spi.h"
+.LASF2944:
+	.string	"maths.h"
+.LASF2999:
+	.string	"parameter_group_ids.h"
+.LASF2978:
+	.string	"wchar.h"
+.LASF2971:
+	.string	"timesize.h"
+.LASF2919:
+	.string	"src/main/common"
+.LASF2932:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2956:
+	.string	"gyro.c"
+.LASF3015:
+	.string	"rcc_types.h"
+.LASF0:
+	.string	"./src/main/sensors/gyro.c"
+.LASF3005:
+	.string	"accgyro_mma845x.h"
+.LASF2938:
+	.string	"stddef.h"
+.LASF2989:
+	.string	"fp-fast.h"
+.LASF2922:
+	.string	"src/main/fc"
+.LASF2985:
+	.string	"floatn.h"
+.LASF2994:
+	.string	"common.h"
+.LASF2975:
+	.string	"stubs-64.h"
+.LASF2974:
+	.string	"stubs.h"
+.LASF2946:
+	.string	"parameter_group.h"
+.LASF2924:
+	.string	"src/main/scheduler"
+.LASF2955:
+	.string	"sensors.h"
+.LASF2951:
+	.string	"accgyro_mpu.h"
+.LASF3016:
+	.string	"io.h"
+.LASF2937:
+	.string	"stdint-uintn.h"
+.LASF3021:
+	.string	"gyroanalyse.h"
+.LASF2941:
+	.string	"scheduler.h"
+.LASF2960:
+	.string	"accgyro_fake.h"
+.LASF2973:
+	.string	"long-double.h"
+.LASF2972:
+	.string	"cdefs.h"
+.LASF2987:
+	.string	"flt-eval-method.h"
+.LASF2957:
+	.string	"mathcalls.h"
+.LASF2976:
+	.string	"typesizes.h"
+.LASF3000:
+	.string	"accgyro_adxl345.h"
+.LASF2949:
+	.string	"sensor.h"
+.LASF2979:
+	.string	"locale_t.h"
+.LASF2927:
+	.string	"src/main/target"
+.LASF3009:
+	.string	"accgyro_spi_bmi160.h"
+.LASF2943:
+	.string	"axis.h"
+.LASF2963:
+	.string	"system.h"
+.LASF2921:
+	.string	"src/main/drivers"
+.LASF3007:
+	.string	"accgyro_mpu6050.h"
+.LASF2997:
+	.string	"utils.h"
+.LASF2998:
+	.string	"build_config.h"
+.LASF3006:
+	.string	"accgyro_mpu3050.h"
+.LASF2925:
+	.string	"src/main/sensors"
+.LASF2936:
+	.string	"stdint-intn.h"
+.LASF3004:
+	.string	"accgyro_lsm303dlhc.h"
+.LASF2991:
+	.string	"mathcalls-narrow.h"
+.LASF3019:
+	.string	"nvic.h"
+.LASF2980:
+	.string	"__locale_t.h"
+.LASF2935:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2928:
+	.string	"src/main"
+.LASF3018:
+	.string	"io_def_generated.h"
+.LASF2947:
+	.string	"io_types.h"
+.LASF2931:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375 \020\201"
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"-"
+	.string	"."
+	.text
+	.section	.gnu.lto_.icf.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\346\001\365\r"
+	.string	"t\023\332\002"
+	.string	"-"
+	.string	"\340\225\334\300\005\004\002"
+	.string	"\002\001\002\002\002\003\002\346\375\371\222\r\"\002\004\002\004\002\005\002\005\002\006\002\006\002\007\002\b\006\t\003\240\342\234\212\n\004\007\b\t\n\013\f\356\202\252\204\001&\002\n\002\t\002\013\002\013\002\f\002\r\001\001\r\352\263\360\321\b\016\017\020\233\232\353\275\n\006\n\002\t\022\023\344\252\231\317\004\004\025\026\322\214\354\327\0052\002\016\002\017\002\007\002\017\002\f"
+	.string	"\002\017\002\002\020\f\006\002\017\002\006\002\021\t\021\002\021\027\030\031\300\313\276\365\002"
+	.string	"\032\307\357\265\351\001"
+	.string	"\033\265\327\367\353\004"
+	.string	"\034\366\333\255\264\005\016\036 !\301\343\232\371\003\"#\271\322\366\301\f\n\013$\376\236\351\233\016\022\002\016\002\020\002\002\017\002\022\002\017\002"
+	.string	"\002\020%\307\307\304\352\003\002&\200\333\377\224\002\002'\220\324\255\321\n\004(\354\301\314\336\005"
+	.string	")\222\252\354\340\007"
+	.string	"*+\204\366\221\342\002\002\002\023\002\017,\254\253\213\313\005\002\002\n\002\017-\225\217\227\201\f\006.\263\331\357\020\002\002\024\002\017/0\347\273\234\355\f\0071\233\213\234\234\b\0172\206\370\243\306\r3\365\375\263\300\004"
+	.ascii	"B\250QM\001\231\20042J\312\r\200\2029E\263\r\021`USUA\022Cc\201"
+	.ascii	"\022\n%w\202|-\262'\270\225\t\177\270\233z\251a\221[\275\267"
+	.ascii	"':\363\247\210I\216\214\244\225dr\233\264\002\235\251H\377gA"
+	.ascii	"\240\225\246\274\244\333u\274\027Q6\276uM9\006\261giN\225\\\361"
+	.ascii	"\230\371\211X\326\365\250\200>\213>\274.\355G@h\004\177\305}"
+	.ascii	"\037OB\327\277c\264\335\347-;l^\215@UT\360"
+	.text
+	.section	.gnu.lto_.ipa_sra.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"\345\004"
+	.ascii	"2\306\021\031p\213\206\003\374\253\252\252\252\201\362\377\377"
+	.ascii	"\377\377\323\322e\312\306{l\223;\245*\365\327\230\214\205b&&"
+	.ascii	"\3420\r_X\302\034\354\024\354\006v\300\264\024\3155\241\371\250"
+	.ascii	"Ns\362\314\373E)\253\257T\344\361;\227;\002# 0\002\243 S\017"
+	.ascii	"\341B\f\341\202\204\230:\345N\360F\030C\241\356\027C\323\346"
+	.ascii	"0\032\222\227c\2629\332\003]\366\236!\372\027\267+\210\231\b"
+	.ascii	"3\337D\013\225\202\321\b\257\200\335)\214bZ8\226BvA>\302U\f\302"
+	.ascii	"U\211\307\346a\005.\300\020"
+	.text
+	.section	.gnu.lto_.inline.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\300\005\325\024"
+	.string	"6\033_D\340\262(\215\001&\350\366 \256\205b6\334\bu\220<-\002\247\031\300\262\200x\200@T\307{\021\"\260\201a0\371\374o\377$#\035\216:\2141\3068]\225\254V\342>K\333VK\013\266\267 mK)SK"
+	.string	"G"
+	.string	"N"
+	.string	")\220\224\033\220\302FJ\027\352\252!u\350@a3\2149S\367"
+	.string	"<\251\334\232\235\034\356W\331\311\320`'\371\332\312\232\025\023*\022\316M\035\247\217\177(\363D%\213\335\375xT\316\270\341!\345#\037WIk\351bpO\362\006\023\371\364R\"\346\312\312\224\335\035\035`S\007\362vw\267_\345\313\356\212r\034Y\212\263\373\022=\n%\276_\006mQ\211a\341~\243\037\206|\364)g5v\304\236\312r\270X\001\372\226\322\300\341\302\243\202\347'%\342c\357Oo\337\204\255\224\256\225\346\006e%d\002\353\357}~\027\262\006\253\315\022\225\"`5Y\311\237\327\366*\005\355:\327U\356\300j2\223KH\006p\330\335\027\242\364\021\344Z\251#C+a!\217\261\354\344\374\202+\221>d\033\344}>\005o\352p\225\376\002t\245/G\200\360\372\341\004\t\232\320\017\036;\304\330\214\020\365"
+	.string	"ac&\262\003m\300`\201\202\023u\331\335\217Jq\022\244<#P\f\241\323b\206\203\231\271A\021\371\300\217\036\b\337o)\217\355\356\310\006N%+e\230\250\300\002\001}\2501A\307\314\310\310LA\222\302r`\002\231\231*\363\022"
+	.ascii	"dI\313aC\b#$cR\376\353\036\007\356\030\230\363\250\311%Z)EDJ"
+	.ascii	"\246\001\227r\342\277\201|\035u\2119=K\r}\337\022r1X\266\230"
+	.ascii	"W\fD@Q\254\252\343n\246-\331y\027\211\373\207:\341\030\n(IBw"
+	.ascii	"(`\006f\017\370\bm\0240\355\264\017\260,>\037\002\365\0371\224"
+	.ascii	"[\356\202\333\230\004\237\013\f=\200SBp\032\024\037\33548\325"
+	.ascii	"\221\306\t\004R(I(\371a\214\021\023\001\350tL_\020\017\032\036"
+	.ascii	"2\260\243\032\300\205\345/\34459^w)M\032\301\027\025\\\317\024"
+	.ascii	"}\034\244O\212\313\312u\354@\251^\214\334\374\242\272[\001\324"
+	.ascii	"L\356\rG\016\217N\023;\232\325NE\270\343\274\325\\}\200\326\003"
+	.ascii	"sT\271\332\037\032\"\353\335Ur\003\035]\246\321\227\033.5\200"
+	.ascii	"\017\261F\27405 \320=\bP\275\250F\350\277V%\342\353\007q\f\235"
+	.ascii	"\240\031\013MZ`\263.\226\302\234z\360&"
+	.text
+	.section	.gnu.lto_.jmpfuncs.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\004-\r"
+	.string	"\006\22140`k\222\016\260!\b\022D\271\230\256\001"
+	.string	""
+	.string	""
+	.string	"\320O"
+	.string	"\321\026"
+	.string	"&\020\273\231Q\377u\261O\367\363\366\3775?\357J\357\354s,nN\210\224)#"
+	.string	"'"
+	.string	"*"
+	.string	"\031\234t1\2525z\216\364\\yG\322\305z]\213\354\267\262\320\337X\237,\304\311\212k\331\266\310)\263\217\233#7W\262\251m\022xU\025Y\261rd\345JV<)\372D\021'\256\024\327Jml\213\220\r\240\032o\214\032d\226\316\245\353B$\210\345E-]wc\t\236\362\223\227\374\247\200\021\b\"\342\207\305~\352 \204\203\334\240$q=RU\026\220\003\377w\300\341\033\250\206QM\327\fT{\341\025\236#%<B\206\007\277y\203=\216CL\327\255\241\032\300gf\037s\tV\250q\261R\214h&\205\205t@\002B\030;\262\003\022"
+	.ascii	"\262 \205\324\024\207\242\310 \021\031\242\031\252\264\356!\262"
+	.ascii	"h\350|\263l\221\245\\f\213J\301\277I\346A\216\221\f\252\332K"
+	.ascii	"\r\017*\024P\356\357\202\t\345o}\365vY`\016\"\247\270\017\031"
+	.ascii	"tr\254\017b\002\030W\006\221\360G\004I\317\373H\034\221\255\\"
+	.ascii	"x\365\243X\252Pc\bPT\310\304?z\370\330X\030\203\030w\223\020"
+	.ascii	" \320\360\310U\3467%\237%\227\005&Mn\")\300!\324\007\267H\f\270"
+	.ascii	"\024\342T$\246\264P\313\304\350\354\2402\342b\330|\345\302\270"
+	.ascii	"\027\206\307c\212Cfa\301\247\251\365\272Og}?4\326\017\367\333"
+	.ascii	"B\314\323\022\203\024\372\362'\024\377\242^N\f"
+	.text
+	.section	.gnu.lto_.pureconst.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375 Ve\002"
+	.string	"b\005\022\033pW\351\251\016\225\002UU\004"
+	.string	"\bT\321P\225\376\377\037"
+	.string	"0\362/\352\246\275\035\343a4\334\302I8\007\243\340\013|\200\257\272\3248]\351F\027\272\317un\363\255\217\371\226S\271\311E\356q\032'\212\323\226\231!\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`J\001\375\007"
+	.ascii	"\202J '\2005\032\0163\300\212\211\201#\243\001\315\021zM\354"
+	.ascii	"\216\020\301/\255\304\226l\033>>\3018\217X|\340\277O\276\224"
+	.ascii	")g\003\004X\341\217\f\033\261\347\n\250\034\001Z\312e\323O\370"
+	.ascii	"\244\022z\236\016A\323\236X\271U.y\274\032\371!\017\207\3252"
+	.ascii	"\334\263j\177L\342\211\240\312\251\316\251|Z\2740\345\f\267F"
+	.ascii	")x\235Ry\243\2123Xz\370\031\225C\235O\271\323>\377\3364\356\200"
+	.ascii	"+v_\2018 \220\202\031\252\243\007\f\"\340\374\371.Q\021\0170"
+	.ascii	"\374\270\007\333\020\305\026\307m\250\2479\207\033\302\332q\344"
+	.ascii	"\326~&=\356\346c4+\266=\266 ;O\005X\027M\311\356eb\2127\332l"
+	.ascii	"e9\270\027\266-d\031\334\254bE\213\035\013c\021;\nElCpZ\323>"
+	.ascii	"\276\031\252\357m\326\214\270\222\260g\257-\214pv\322\360\255"
+	.ascii	"\306)\005\360\302l\236\340\332\267\\/\036J\021"
+	.text
+	.section	.gnu.lto_.lto.20ab49ad1462ba59,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroConfig_Registry.30.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375 \205)\004"
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	"("
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\364\301\021\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001"
+	.string	"\005\001\212\001\202\200\200\250\317\005us"
+	.string	"\005\001\006'\001\034\005\001\006'\001\212 ?\202\210\200(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/sensors/gyro.c"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gyroConfig.32.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375 \223\325\003"
+	.string	"4\006\206"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\370\372\001\005\001\006\177\001\344\310\001\254\002\220\003\005\001\006\035\035\001\332\035\001\0040\005\001\006}\001"
+	.string	"?\202\210\200\300\002{y\306\001w\305\001u\304\001s\302\001q\302\001o\303\001m\275\001k\275\001i\302\001g\301\001e\300\001c\277\001a\276\001_\275\001]\274\001[\273\001"
+	.string	"\t"
+	.string	")2@\214\242\256\200\206\201@\225\301`\216\2552\312"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_gyroSensorBus.33.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"E\007"
+	.string	"\342M36@s\322\001@$\344oP*\f\262\312\020\310|\216|\310\\\006+\035\007\242Y\244{\363\263m\314\322p\367\216a\270|4\253z\326\210~\231*\020-\331d\357\224\002\356XQ\202\036\340\224q~<\023~ \034\"`GNh\0358Jx$\244\210Q\302W\367+\023\002\247]\322\251=\257RQ \263\273\013w~\312\253\205/rgP\210\235\336\371\241\352\216a\203\324.\3748\226\325\330u\304\232\207}j[\207\315\002\\`\024bv5nl\366\305\265\220\330\026\331\3177\371\211\310\227A=\231\036FH\006\013\315n\205\256'\250\356"
+	.string	">P\335\265\217_g\227\177\224S% 3\2644:\3434\354\256\031-\231\356v\333\b\266\023l\217\004\t"
+	.ascii	"2\003\3020\027a\237\r\001\272\206W#\232\026\202\020w\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_gyroMpuConfiguration.34.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"-\007"
+	.string	"\"\01634`o\032\003p6$\226\243\311\242\376\017E\313\260\025\377# \332M\352L#\253\023\374\260\023\032\255CC0\fG\t\005\324\034\303\001\341\263a\374\225M\312\224\002\365t\242\f=\300K\306\013\364\271 \b\302!\002z\344\005;\007\215\022\037\t)b\224\320\2327\312\004\007\365\227\234\265\227O*\n`\376/\370\325&\236\0265\210_C\242\346\314\257\026U~\f\032%wQk\343m\246\235\244\346:Zo\376\277\216\243m\0021.\n*\177F\r\315[\336\212H\333Qk\325#&\031\0253\230\250\023\347%\205\221\"\363O\330i\202\312/\300\003\225\237\3630\346\206\325.\361&\365\301\222\231Hn"
+	.string	"\r\377\3332\323\311un\213\3206\241mH\b"
+	.ascii	"2\003\3020\027a\237\r\001\3165O\013A\210\273bj'\031"
+	.text
+	.section	.gnu.lto_gyroMpuDetectionResult.35.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"E\007"
+	.string	"\342M36`O\322\001s\001\030\341RC\231F\212Q6\244\265Q\363M\301\273I\235\2435\244m;\320\330\020\332F'\001I\022\026Z\241\331\022\346\031\270\307\217\006\331d\357\224\002\276\254(9\021p\31287\330\204\033\t\210\tx\311\t\255\004G\nLB\213\030%\254\352>\245b\200\264\013:\265\347Q.\016\\v\267\341\317?y\305\360C\376\314\351\264\323?\277C\3759p\200\\\206\253\216m2v\37547\262?\255\363\260\233"
+	.string	"M\013\303\313\356F\315\314\262\274\225\021\333\036\273\362K^\3628C\250$\021\301\250\244\241\022\263[\241\353\r\250\277\200\027P\177\356\343\331[\346\337\344\023\t\b\f\r}\336"
+	.string	"\036v\327\215\206D\267\273m\005\333\013\266E\002\t"
+	.ascii	"2\003\3020\027a\237\r\001\272\206W#\232\026\202\020w\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_gyroDetect.36.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\251\001\365\020"
+	.string	"V\337qI\320\322(\035b\302\257l\214\034r1\360\261\304(\006(\374&\236\367\243\016\344\203\314\025e\366\372bQ\357\324\337$\003\027\221\307\217W6Lm@)\037\240\337,\203,'\2500\255\256\201^\2000\021\200\277l\342\t\331{\247\024\\"
+	.string	"Z"
+	.string	"`"
+	.ascii	"\345\313Evkzb\354\226&+\360\316\271\364l\373)\216\343\362X\313"
+	.ascii	"Y\214d\343\202\203\216\320n\371\215\274@w\256~@w\216\216\370"
+	.ascii	"\370J\347\350\277\366z\202\007\210\214\275^A\234\326\006;D8!"
+	.ascii	"\261\230\032"
+	.string	"\300\304\206\025\257}\312\304`\346\004`\262\273\236d\354\303\315\335\024\3549\n\2366\232\237\177\354N{\005\031l\026\231@\215\022CA;\213\354\3625\251\215\375\272\264\306>\355\036\275\374+\235>\310C\370\b\355(\241\261\333\341G\217\365\341f\2208\355\267o\333\345\327L\")2\2356z/\017\336\216\216M\307n\271\340\234%x$@\2469\355\253x\216\353\001\266K\016\003D0\333]\b\376\213\363\234\030%e\236L\351\316q6\310\240\322MF\355 \267\234\020\233\300\234cv#\243.\335\251X\303\0213\211<\232\225\332a\206y\3624\202,\206\276\f\316\370\f\005M\233\210\237\257tv\353-V\274\335E\371,XZJ\263\233s\376Kw\316\300\214\007l\376\b\240\250ja\211\252\t%\263P\017\034\244P\fR'\001, \213zu\nE\227\223\257%\206-\025\260\365\251\240\250.|+\261\365\235\0168\304"
+	.string	"\212\237\2060\024?R\271\257Kk\374\0333>\350m?\n\032\236\351\217\335\210\312\330\036\321\224\fFaz\252\310\374-t\266j5Oz\244t\273%\350\002! `\002\0311\333\003\204\301\363N\201\"^$\022\bo\310\362\003<@B\370\372uu|9\bN`\222\007aD\301=4\317+\b\034CVC\006\206\261~\375\213\\$\f"
+	.ascii	"\tVb\030v\342\301\0216\310\272\211\f\322\t@m\320^\244\027S\336"
+	.ascii	"\303,\002"
+	.text
+	.section	.gnu.lto_gyroInit.37.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\345\001-\022"
+	.string	"Vb{I\320\362&\035\240\030\335\007\355\250k^\224`A\377\021\373\343TL9\331\330u\203{\274\206\024\210\202\013Eok\266\237\340\205\006\304i\243\327\347h\277\311\027\0172yMkd6\347\250\316\017P\033e\002\305\034\371\204\020)S\nh"
+	.string	"^"
+	.string	"k"
+	.string	"\244\214\r\246\237\224\177>\020\376S=\005\376\363\036"
+	.string	"\374\347\004\013j,{\211\303\271O\023\207\030Ms\226\342\232\270\354\340\347\255\312|"
+	.ascii	"\344\354`\b\342\337u/\220S\003h)\210\314\271'Bn\360T\035H\233"
+	.ascii	"\256\207\242\203\343\003\tY\363RI$x\\w\275!mTCV\346\234\326\033"
+	.ascii	"\351\341\016\271m\030\333\rlE\ts\322~\363_\034\b\346\237\370"
+	.ascii	"\347\0131\375\355\237\037\3130\243\277Ye\2633_w\226\035\036\247"
+	.ascii	"\036S\201\330eM\267\307\2767\347\234\336\022\366\252Q\317\335"
+	.ascii	"\241\325k\265\216\254Z\350\210\360q\332\245r\342\354\202L\244"
+	.ascii	"\257\b\305s\267_\326\370:\213\030(b\331\327\371?wQ\363\034\215"
+	.ascii	"\312V\316\253\034>h\272\363\210\321\221\322qOLC\336\366\370\373"
+	.ascii	"\t\210\332\353\356\001\035\225\354v;\247\237\200\341\242\326"
+	.ascii	"j\243S\323\235S+R(\321\217\244\021\273=>\r\030.\005 \0356}\262"
+	.ascii	"\032\355(\205\373\334U4\005\342\022}\371\240W8\3434Z\256\327"
+	.ascii	"\013\246\202\376\026\356wxl;sJ\005\022JM\356\033`\312_\036F\214"
+	.ascii	"\004\027~a1P\240\302B\240\262j\255L\\\243\313\314\313\350\362"
+	.ascii	"`\304\255\025l\324\360\022c#,\026\343\212\21110.\026\304\326"
+	.ascii	"\030\023W\003\f\223q\215\"\006\030l\024EJ\332\275O\035\354\b"
+	.ascii	"!CH_\364\335\033\333\273^\241m\r\024\2406\013\004\375Mww\366"
+	.ascii	"\271X0]\006\332\021N$#\200\233s\262|\241\017I\230\320\322\002"
+	.ascii	"\376\013\" `\202Abw\007\3408\330QZ\017\315#8\213A\244\320e\333"
+	.ascii	"+\260i\004x\247\212\361E\2315\260\266s\r&\t0ho\020\271\254\264"
+	.ascii	"\242\006\230\227\275\313ad\26260\305\250\335\264\3413\342\236"
+	.ascii	"3\342\255\335\240\0329\305K0\331\337\375\241\351*\002\205\002"
+	.text
+	.section	.gnu.lto_gyroInitFilterLpf.38.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\322\004\325\035"
+	.string	"ft\270D\200lMc\316I\027\020\307\223\2221a%\326^\317\335\226R\241?\212]\316?"
+	.string	"(pECD\210\b\212\307aF\276\\\352\033\205\026\246B\t\240\346\265] \013\354\252\257\243\006\002\032\211v\357\275\267\224)\005\240"
+	.string	"\230"
+	.string	"\250"
+	.ascii	"\267\177\345\034J\320\203f?\313\307\272\225\363\350\223\311\333"
+	.ascii	"av\201b\023v/\332\340\243k\346\307\331\007\220\037\305\007 ?"
+	.ascii	"\332\b\342\320j}\025C\220p\376\352\206\355\275A\266\200\271\027"
+	.ascii	"u\340\005\346G\2376\330\321\"\367]\314\004\263\210\335{i\226"
+	.ascii	"\310Y\317\233%9\212\266\236\276\201\257>\302(\336\315\367\246"
+	.ascii	"^\2265@M\310\262fCr\007\217\020\251\251\2179\204\242\200\344"
+	.ascii	"\200#\\H\202V\034\212\372U\353f\307\2248\273\367>\353\025*\312"
+	.ascii	"WkY\273\367\272\n\243\244\356\240\333\366a{\204-\246\001\337"
+	.ascii	"#u\355\004\277{{\007\254=\020\215\257\016}[\355\021\037`\230"
+	.ascii	"\215\342\\R\230\367^%_\313\267\250\360\223|\364\212\333\215\374"
+	.ascii	"x[\301\bVM\255\340^ \025\271\267w\241\257u,K~\022\303`\252\027"
+	.ascii	"~\364\231\310\217\226K\310\243W\2076\272\232b\024\245\246P\334"
+	.ascii	"\334\372\307F}\325V\331\267\303\341ph;\304\376\325_t\364\226"
+	.ascii	"\325j\241\262:\250\2546k5iV\217d\265XV\333\262\272\222\325'p"
+	.ascii	"\364\243M\212\255{u\f\001]\257Q\314\222\243\037\253X\255\035"
+	.ascii	"\027z\006\264<\027Y\323\036\030&K\273\336\306\206\364\305\346"
+	.ascii	"^\031j\330\352\2056R\315\273l\207C\207\016]i<\200\230\360uF\224"
+	.ascii	"\245g\316\365\031\257\006b\300u\244\314h\253\312\370\351\351"
+	.ascii	"0\271w\214O\346\005\310\217b\017c\033\314\274\227\367 \256\302"
+	.ascii	"\013\025\210\311\245\272\013\"P\375\352\230\355\020\337\022a"
+	.ascii	"\336\373S\362\275\374\013\211\022&L\220\037G\213$\007\213(\345"
+	.ascii	"\022m\225eV\2648\264\272\212\254hm\226\340X\257\016\177k\253"
+	.ascii	"\374\033d\221e\2415\347W\375\270\246cd\366\350"
+	.string	"g\275\372\307\326\312l\205\003\\c\275\0254vKN3\236><\335\232pN3p:\r\002\334BiB\004\nJ\017($\001\260\261\301\205\214\030\243oI9\335\323\013\332N\227\3335\341v\264\246\245\025L\264\233nGK:rN\006NG\243\221\313\351hCh\357\342\265C|\002\210W\317\372l\324w\321dPIk\237J\316%5\353\265\037i]\203c\007s\242\364O)\246\240\006Y!=\247\225\231\307\347\223\023\212\220}pl\353@\037w\250\256ma8DSm\220=\320\211\257\017\330iU\347vN)N\247\325i5\207\317I\345\254\022G\217\230\023\245x\274H\2435\263\372+\207c3\337\370\002\206\032c\250A8\006\035DD\023fIAA\n-\006\220\002\0311\262n\0210\271vC\232$\205e\f\3249\216\316O\227\342\344\364BzA\331\333\275B-\337hE3\203DX@\235\363h\277"
+	.ascii	"\254\327\333\3741d\035g\274\320\356.s\247\276\025x\026-j\340"
+	.ascii	"\035\013\245\265hUx\267\337f'\265\233@K\325\340\205AlW\311\300"
+	.ascii	"\032\354e\377\221\273\207\232N\357<!\227\371\276\263\302^\220"
+	.ascii	"\r\016Rm^\007\323\356\251\036\037\356\363!(\267\n\266\220\034"
+	.ascii	"\346\371\241\033\370\361\243\211:\272\265\022\244\307.\215:+"
+	.ascii	"\343\337dE\245\346l\225\\@\032\304\246\272M\225T\022>O\017\234"
+	.ascii	"\211\367lU\020M\325@\242\005\336\362\277Q\005u\0173\213r\262"
+	.ascii	"9o\267N\033\231\247\006"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch1.39.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\013\002\365\022"
+	.string	"\226d\200H\300\322Q:\"Rq\205H\001\030\207\t\235\310\221\351eO\202[\222\006}D\340\017#\026\276\017\363\bT\327\314\252U\027m\365R\033\364r\270A\030\004\310\f\017\177\254\251\257\212\320R\354\370\037\210Q\260\250lv\023)S\ni"
+	.string	"f"
+	.string	"i"
+	.string	"\341\343\211PJ\346U\370)^t\273\321\215\343n\b\245\027\273<\005>\020>\216\234D\365\230\027\240z\364\315\216:/h\277\364\201\307\307cw[:\342\267GP\363\346\257X@t;\334c\330\341 \210@\n\306\016\222\036\022:\326.'Ud\247\003\232\354\356}O\r;\234\314\025\313\356:u;\237[u\333\022l\303\330\331\022\247\251\036uI\347!\227?\247\023\221\215\315)\233\207K\005\262\017\356\356Z\177\354L\2632\035r\336\017r\243?|\357^\201i0\2465\246\023L_\244\244\251\006\214i\267\347\347c\237bS\211\367n\237\305\215ur\224b\337\347\2578\322\355=[\210\343\020&m"
+	.string	"!\265\313K\360\350\b\341\243\txBt\304\213r\020\252P<?r\371{\356.N\025\310\277Q\205j\001\tGN\366p:\241X\351{7\311\345\224UW\232P;4\324L\317\341\263\273\266\201\234\335\\\001\325\3578\341\344\317\327\324\022\035;R\366\313\227\\\341\356\252\370IWz\371C\217\226\201\301T\217\327\006BF&0\314\020\270\261\233\273\316oq\0272\177\3104\264\274\356\321\0015\032\254\206\306\006\301\346\212\275jh^\263\007\003l\\bbd\265\232\026"
+	.ascii	"\206Qa\260`E%e\005e\304\306\345\202\253&\213\255\354B\221\315"
+	.ascii	"l2-\332LF\213\275h\255\030\354e\246\345\232\321Z(%\226ex\315"
+	.ascii	"Z5\231l\326b\361\366\340\352\217'\304x\312)N\f\220,S\250\220"
+	.ascii	"\276\263\350(\316 \312\322U\250!\352\264e\024\235\b\002\025h"
+	.ascii	"\245\240^\004\322\214P\301& \220\202!\272\342\006rq\370\353\241"
+	.ascii	"\003g\205\346\223\030U\204\242\331\336\363=\302\227\304\273\322"
+	.ascii	"\223\342]\266\361\2327n\202\332:BW*\025\317nh\331\303\213\013"
+	.ascii	"\265p\335\311\260\030\312\001\212{\216\030\2574H\256\210H\314"
+	.ascii	"\262\2620.\f\036\030\276\317Qj\315)\305\331.Z\006"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch2.40.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\013\002\375\022"
+	.string	"\226\244\200H\300\322Q:\242\212\340\304\214\301O\246\347l\244J\346\277=M\211\206\240\264\256\0260\004A\276\207o\004J\333\336\252U\027m\365\2226\225\3720e\001 \002A\311\315$#\253\227\241t2\351\266O\207\224\343h\355&R\246\024i"
+	.string	"g"
+	.string	"i"
+	.ascii	"\341\243\n\017\226\314\247\360Q\334\350\366#\035\307\335\020"
+	.ascii	"J0v{\013\214 |4\371\211\3521/@\365\350\233\r\365\336\320~\251"
+	.ascii	"\204\317Ojw[:\342\267GP\363\346\257^Fv<\334c\370\341 \230 *\306"
+	.ascii	"\217\223\237\242\035\213\267\223Z\302\343\001S"
+	.string	"v\367\277'\007\236.s\365\262\273\316\035\017\350V\335\366\004\3333v\302\004\247\251\036ui\007\"\227SN&\03286\207\330=\\\252\220}pw\327\032dg\232\225i\222\367\376\221\037\375\341}\367\nL\2031\2551\235`\372%(R72\344\330\375\231\"\262NQ\206\211\373n\237\305\215e@\307b\377\347\2578\322\355>[\210\363\020&u(\212\332\355)x\264\204\3601\005T\001\242\242\007\365 \252O>Er9\365\334]\234\252\220\257\243\n\365\002\322\216\235\024\342d\262\261\322\373\236\222\313!V]i>\365\324P\277x\017\240\335\265\017\354\354\346\n\250\276\207I\227S\276\246\242\370\350\211\262e\276\344\nw\267\305O\272\322\313'zt\r\f\246z\274: q\324\244\301\206\200\216\335\334w~\213\273\220\371D\276\241\345w\217\0165\032\f\347\306\026\301\346\212\275pn^3\b\003rbhhd5\034\030"
+	.ascii	"\236ii\300\300\245\205\305e\305$'\006\203\253&\213\255\354Z\221"
+	.ascii	"\315l5-\332LF\213\275h\255\030L\306\246\345\232\321Z+(\226mx"
+	.ascii	"\315Z5\231l\326b\365\366\340j\220)\004q\312\251.\006H\226+X\310"
+	.ascii	"\337_x\024\347\021e\351*T\022u\3323\214N\f\201*\264RP/\002\251"
+	.ascii	")T0& \220\202!\272\342\006rq\370\353\241\003g\205\346\223\030"
+	.ascii	"U\204\242\331\336\363=\302\227\304\273\322\223\342]\266\361\232"
+	.ascii	"7n\202\332:BW*\025\317nh\331\303\213\013\265p\335\311\260\030"
+	.ascii	"\312\001\212{\216\030\2574H\256\210H\314\262\2620.\f\036\030"
+	.ascii	"\276\317Qj\315)\305\331.Z\006"
+	.text
+	.section	.gnu.lto_gyroInitFilters.41.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\224\001\365\r"
+	.string	"F\231[C\360\224\232\016\340M*p\262oT#\355\211;)\226s\261\302B\222\022u\324\303\231\243\275\223\021YSVI%N,<\211\316E=\007\033{\223\247\227Ds\310T\024\214\331\230\254\2016\353&do)S\nG"
+	.string	"D"
+	.string	"F"
+	.string	":^\330\376k\f2\260\343\244\301\211w\032\227jaP7\210\264(\262\373)xt\202\352\321\236=\344\337\212}\316\211\230\233$\273\213\251\212{O\317\177\315\255\222\314\350IA\330]gI\246\304\255\267]\300v\004;M\002z@\210\r){\234:=\016b:\315o\002\005)y\234:<\202l\362\330\337Kj\n\373pu\306\326\364\007\246-MW0Miz\202\351\250i\b\323\252\351\314\364\003\204\216"
+	.string	"\021Ac\227D\217\222\335\211\001\003\022\352\244\366\205\f#t\344\250S\312m\324\210\212@\025f\237\241\335\250\036\207\205M\310\007\200L\265W6\344K6\201\321\221\257\251\013b\226\330,\227\341R\355\302\210\374\35716\337\305\243=t\371\322\243\337M\217\017V\021=p\200\"b\200re\227"
+	.string	"\025\016\232\004\256\233"
+	.string	"rvm\\\b\rX\307m]\213\326a-+),X\306u\330E\300[\007\215\303>l\033\207\201>\322\341\352\2141 \331!\351\213CF*\375\250M\301\322O\205\347\310\261(\255,\034\007\007\365#\" \340\002\031\272\325\001\227\340\230\242\f\214G\"\205\333\026dy\337\303\036\266+\231\347B\007,\345\0312A\245\003\276\346\036\267[#\207\215\207MT\\\347R\f2\214j\031"
+	.ascii	"\0276\t\003;'\002#\"\306\234)\f;`\231\027\255'\003"
+	.text
+	.section	.gnu.lto_isGyroCalibrationComplete.42.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\375\006"
+	.string	"\342\31515Pm\222\016CNQ\305(\247>\313g1\220\300\n\223c@\253\261\257\376\354\333\337\r\325\300\242\025S\301\303\236\233\231)\022qo\005\f'2\270\250\265\255m\"S[*\326\225)@\354\2620\314\005\203\230\205\004\006h\2710X\001\330j\270\\\320\301\262.Xq\261\031\312\034\340d\347\233\23143\353!u^\367\325\350F\346b\374\220\275n\245n6)\325\f\370\220\340\274\356j\"\276\322s\233\227\024\337)f\350\177\347{w\022(\361\200"
+	.string	"\211\361\323\221\304\016\212$\372\373\035i\276\332\340@\263V\356\342S\321\310\3031\022#\007\323\242Z\237v\233\321)\244$\262\2016}\024\204\030\343o\003E\364\354O\360\027\374\025\001\007"
+	.ascii	"2\001?8\343\003/@\327p\220!J\270\313\246v\222\001"
+	.text
+	.section	.gnu.lto_gyroSetCalibrationCycles.46.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\235\n"
+	.string	"\306\024J=0M\225\016C\353\034&\221di\223\346\017\316:;\360p\335K#]\357\3770\300\217\225\021\310\213P\217\312\b2c\367\260\346\"\"\022\204\323rP\271\005\305)\300\302\210\"!\233H\231R3"
+	.string	"7"
+	.string	":"
+	.string	"\332\243?\272\330\332\343}\321gk\376\354\022\017%\354M*\315\006\024\273\273\351\347\337\363\363\037zc\303y\360\314\f\354\256s\303\211p\353m\007\260=\300~\201\254\024\353D\242N#6S\330!\230\352\261\177\355\356Z;\266\2461M\307L_\231\316\f"
+	.string	"\b\021\016L\273\020Z*6\025?P\260}\177t\322\345\"\307\322\352\302\356\006\023,*\246\317X\2704j\364\240Y\221\232\251^\301.\315S\006\003h\356\032*\026\273K\300\017\237\301\363A\217f`\311o\036}\013\366\230\2321\201\204\311\226O\372\005\252B\303\023~8\270\256A\202\315\3538\217\002\3616J\004\301d{t\336\346\3000\247"
+	.string	"\322m\0138\256\333\264\020s\355\370@\210\024FAc\352sxi\342\203\034\221H\260\307\207.\340\263\002It0\221\251\036\017"
+	.ascii	"2\001\367\336\fxh\306\220\352\247%\240\306\t\301\224D\325\200"
+	.ascii	"\263\301\302[V\226O\027\204\017e\035\270t\213v>\001"
+	.text
+	.section	.gnu.lto_performGyroCalibration.47.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`~\013\315;"
+	.string	"jd\f\026?@\350\316\030Y\207\372\033\231H\321\236r\231\237\r\244g\370\321-\0164W\033\243\221\266\007t\037\241yD\354w\360\353|\321\316\327\227P\t\323\036\305\252\1771\215Fziii\023)eJ)\005L\0014\001X\001]\240\300\020\316\265\034\034\035\207\203o\205\0245\034\346\256\226\343 `\2357]\314s8\230\213n\344\230\002t.O\311\255\206;N\201\037%3s\267\3517\267\341\330N\350\005&|\203\343\267\367\276o\204^\271\205\260W&\265\223\330^\243\243\325\360\0244\317\332\373\276\305^\271\335t0\027{]\213\314\n\324(\337\231\247\252\334n\353\321\355\333\304\023\222A\330\253\2020\312v\3466\323ln\237\361\321\311\367\255\022\215\363\276mO\fA\330+\2675"
+	.string	"\266Wa'\261\275\262\313\\\250\333\322\336 \027B_l\024\275\357\033\365h\374\255\2665\037\335\355d{\204<\032\213\304\2410\310\256\352\273\313M\f\363\352d\233\326Gii\312\034\251\266d\252T\323\217V\304\242\264q\254\213\301\013U\272\\\3413\023Sk\242Z\201mM\355\325\274\321i/`O|(\005\203\2422\3255\002/`N\\\210\300L\f\332A\265\211,\217\222\226\202AU"
+	.ascii	"}\250\f\352\272/g[\n6\326q\355D\302\234\276.iU\245\n\242h\f\031"
+	.ascii	"\026D5\372}\345\025\303\200\370w\\\257\\\374\370\314\304\242"
+	.ascii	"\264\007/\274\357\313\376\f\023kFj\346\306\300\3141\230\211m"
+	.ascii	"\002!\330^\231\276\341\264\2179\323G\306\006\rN[\004\373\364"
+	.ascii	"\017\276\235^\240\376\351\327\271/\300\245\017N\333\004\013\365"
+	.ascii	"n\347$\323d\022\0355!|\337\327\212[O\357A\301\235\245WN\241\302"
+	.ascii	"\373\251\202\355u\351\227\324\3160=\220[N\023\243]\244qzx\266"
+	.ascii	"\210\317\242Cp\232\030-\323G\312\304\340\031\243\177\377\276"
+	.ascii	"\257\327s\004\013R\230q\255\2021\353;\260\327i\232\030\215J_"
+	.ascii	"\377cnk\372\2371w3\303\344\310\370\2530\267\316\024Zg\254\326"
+	.ascii	"\371*\351<!\351l\325:W\265\316\022\222\316TI\347\251\326Y)\225"
+	.ascii	"t\206j\235\237\272\255\333\251\351\232\233Z\347\007}\246[A\353"
+	.ascii	"\314\224t^j\270f\245\3269\251uFz\347\344;\267\357|\364\316\310"
+	.ascii	"\326\371\370\316F\243s\361\235\211G\316C\244\263\360\350\034"
+	.ascii	",:\263F\347\365\235\325w\376w\366\242sW`\301\250\317\217D\357"
+	.ascii	"\213$\220\321\313g\235\303\245\351\272\341\232\350CW\231\033"
+	.ascii	"\317\035^\337\020\255\265\035\346e\333\361\bh]\235%s\361\316"
+	.ascii	"\216\373\016z\307\247\344\226\343\2563Dg\243_\261\327\373\344"
+	.ascii	"\005pR:\017\223+#\376\0317}\361\377\212[\036\342\027\235\236"
+	.ascii	"\330\240P\223,\303\036\254\323\267\231\233^O\245rX1/\034B9\230"
+	.ascii	"\333\244j\352G\034\211\353\204\331\205\342F\211\302\n\177\370"
+	.ascii	"\301\271/@)o\232\342Ra\373)\374^\304\326\003\302\254\t\n\376"
+	.ascii	"Y\0176\370m\305\207\370\263\207{\346\242y?]4\266\327\340\033"
+	.ascii	"P\203\356I\3134}\3235\023\323Y,\256\026\357g\323\273R\272\256"
+	.ascii	"\223S\251\030V\004\253,b%\315!<\017\242\374\245@P7M\2146\221"
+	.ascii	"k!\337\"00\315\254\002i\\\2349\355\353\342o\326\3224PiAZ\037"
+	.ascii	"\0132\007\276>\373\305\005\023\204\321\226\361\017C\200\251\037"
+	.ascii	"\373\277~;\367\234\250\257(\353\230\226\250\237\206\230\036\370"
+	.ascii	"\352\373\234\223\fQV\003fWL\367y8\344\256\271c\nd\361\301\366"
+	.ascii	"\372\337@m\016_\226p\317\377\2506\007N\332dM\340\375\314.\233"
+	.ascii	"\213\306\373\311L@\336\213\271\tm!\247\317A\030\n\350\265 \r"
+	.ascii	"18p`{\355\357'\223\300\b\315\314'z\232u\224\366\276\357\025\367"
+	.ascii	"\237\006\344a\306\207\017l\257\001\246}\310h#\236\313\263\245"
+	.ascii	"\216\372g\374\340\231~\fM\"\267@@\334\217\271\361:O\004w\026"
+	.ascii	"\006\021\"9\264\\|\327\326\216\025\252\013\031K\030]Z\\0J\320"
+	.ascii	"Xn"
+	.string	"\335X\301\305bK\306\n\r7hh\315\320\312\261\004\301\304.\254&PaY)\261\240Z@\2659\2646\004\271\005\324\222\213\307\213\250.\256e\027\r\255\256(\032[+fD\265\340\352\212\202\032\300\313\032Z\\Q7\226K\256\250b\033\263\277\n_`~SJ2\351\257\004\006\266\b\026\351\223\320\220^\351\201tQ[\301\273\335!D\\#,\372\256\274m7\214ev\223\270K\032NzH@\037\022\270\243?cw6\205\3574\355\320\"[\274\246PX\343\326iR>i#\377\214\207zF\251\177=\217\320JO\344\251\225^\203\036\020\367\3733S\372\013L\377k\365}\337\367(\365\r\347\324J/\365\355$k\306u\243\225!roT\b\214\324\230\374\262\254\003d\001TBOC\355\037}\362\t\3309\311`}\373\004\374|\001\276\361\217\236e\343$;>\362\373\013\260\261\376\370]\327\035\352@\357\232\200\332"
+	.string	"6\257\036k\302_YM\270c\022>\006\305\352\316\316\2358\324\370N\201\354\270\221\313\033SD\202\223\332U=\223\266\323\f\320\0205\001\311\031\352\323\022\276\212\352%L}\363i*<L\302\225x\222)<w\35441j'}\375\257X&\007\317\003\200\374\250a$\007\231C\212fD\244\240 I\322\030\220\002\221\031+r\003\021P\275St\244i\366\016\254\013+\330{\261\265\232\377\r\306\006\341>\001^\304\373\345\305\343\273M\252\001\t)\003e\226\260\375\212\344\324\017\206\266J\257@a\325''@!\342\"\004-\001$\327\345m\2258Y\340w\246\260\304]E\301\245\263Z\257u\241'\315\315\202\306DI\311\n\240\264*\005\356\327L\333\017(\t\314\037w\226V\334#W\211\003$\340\331\204({\027\024\2438\343+C^\002\310\266\2746w\020"
+	.string	"M\370J\260-\223^)?b\234M\215\213D\336M\225\342\022\031\260\233\2300\342\r9,\036i\342\2365 \360\340\207\225\222:]\300\336\273?\220\274\244A\367 \326\204p\261\352%\240\262\312\222\2267'\273'\371\256o\344\351\324\304<\013G\303e\262\313\325d\372n`\332\002\006\350)\336\375\3461\007<\205\320\253\035\207\273\276xsn\322\257<"
+	.string	"\225;\033\225\306\232\211\237\224J\361-\013\215\204ZT\260\250,\0032\344#\202\350\002\352\022\263\205\2432\033\223\211\265\210\253H\266f\275\321\207\016\343\301%\033\006 \231\340\234"
+	.ascii	"YgGS \355\2016\020k \334\336\370m\346'x\3635\364$\006\\\260\245"
+	.ascii	"\256\005L=\270w\001\264J\302\367\242\312\273\177\303\301x\004"
+	.ascii	"Q:N\237\343\217\240w\177$:\306!,\221\253\300\217?\304\032\251"
+	.ascii	"w%Z\020\t\375\325\311\232\326\211\257\t\233\356\206Y*&2\212\313"
+	.ascii	"\00770\206\262\370\321\274\314\277\236\032g\376\221m`\245e\226"
+	.ascii	"\300\300\037J\216j(\3327\004\367aW\023\210S\027\006\370,\\\271"
+	.ascii	"\347S\034e\220J\376\226j\326i\224\273N\356\206\217\326\230@\241"
+	.ascii	"!\344\365\030\357\246\222\304f\323\246\r\231\n\r*I\3244w*"
+	.text
+	.section	.gnu.lto_gyroApplyFilters.48.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\345\004\r\031"
+	.string	"\346)\224H\260\326Qc\024f#\204\021\374\032\246e\"\342\303/H\203O\227.T\337\265\n\022$\236G\334\267Yee\264\331\3717\351\016\250\201\035+{>r;\021\250\376~\231\035\330\325\336\356\217\310a\314\265\266A\366\226rK\231R{"
+	.string	"q"
+	.string	"\202"
+	.string	"X,l\037f\023PR\360i?\306\241z\217r\325k\3672\345\270\272w\bc\003\345\253\207o\261\257\345Y\354\253{\366\021"
+	.ascii	"C\327\307\240\005\025\321\224\223{\357\215\242x\357%i\353Hg\317"
+	.ascii	"\277\324_\277\240\357\345\200%#\244\223\337*B\"\232\226\304k"
+	.ascii	"\210\2419\036\235\216\007\224|\034\315\202BcK\220\023F.\365\t"
+	.ascii	"\f\006\315I>\270\367z\376\202F\367\353\266\213lC\260+\031\223"
+	.ascii	"\372\324/C\324g\277\306\247\334\305\323\323c_\247/\3433:\370"
+	.ascii	"B\373\350\346\177\257\276\316\276\236\276\220\200\346\024\027"
+	.ascii	"(\226\330\272\023\212=\364M\332d\177\274\224\311~\324\357R\247"
+	.ascii	"ku\232V\247W\346\364lN\313\310\351\230\235\206\325i\025r\372"
+	.ascii	"e\247\313:M\222\323\326N\327:=\216\323\224N\3179\375\227\330"
+	.ascii	"\2230x\021C\356\0351%\312\325\252\001"
+	.string	"=\376\303\307\274\211\026Fc*\260\254R\205\204a_0\327A,\351\213,\261F\262\342xL\361\205u\242\243\245\266\021\374\312\202-\305\275\327\201_u+\f\276\360\325\031nn~I*\265\324\022\211\244\260\314\221\332\0326\330\377*}\021\242\272`\253R\350\273\312\276\216\324v\001\223nb\351N(\377\212\237\222\026\245M\345q,\245;4\210\b\315'\366m\374\006NN.g_)uQ\021St!\233.4\346 \323`\301\214L\202\031[\316F\333\251\211@S:g\323\355@\360\334x;\035\357G\207w\373\351\311\361\271\345v\274\233-\200u\036tv\267\017:\335\356\006\033\336\217\2272\025{h\001\321 \327\2344a\222U\343AS\222\004\211/\244\321\271\004\230\264c\345\210\255Z\334{zW\017*\306u\357\225)r#=)\232\232\232%+t\234\002&\021\271\206\330H\300\315\204L\230=}\370\"N"
+	.string	"\327\275@\377\371A\276eC\001\207\223\001\251\240\2239\2251\032j\250Qt\310\b\211\220\242\244\240\240 \351\320\002\021\021\252:\021"
+	.ascii	"\255e\350\002\333\326\256\034\\<\330\352\213\375\205\002\244"
+	.ascii	"3\215\013\240\374\210\376\231\271\035R\240\366\235\001E\231\r"
+	.ascii	"\244\310\303\370\256\240\320f$\331t\2311\372\241|\304\276\021"
+	.ascii	"\202\002<\347$\362\020\022\311\300\352\035\2115.w\226\375\036"
+	.ascii	"\366h\244BQ\231\333\320Y3C=\203\257N\256\274CY\275\037\254\037"
+	.ascii	"T\200m\332\222*%\327\211mJ\325\b\b`mw\371R\274\364\035\373\007"
+	.ascii	"L1T\030(>\256\272\201\274\bv\260_\2322C\374{&Q\377\233\375\021"
+	.ascii	"\242A;+h(p#\003\347\253ZJ\344\177\357h\364\211\251\200gUAC\205"
+	.ascii	"\235\026B\fr\3769\252\303\247<Y\r"
+	.text
+	.section	.gnu.lto_gyroSetIsrCallback.49.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\215\007"
+	.string	"\242\31655@s3\006@\270GxE\337'\346\366K|\036IA\275\352\375\224 x\264\207a0\300\353\023\305\276\3312\fY\260\377\242K\031\3560s2!n\337\266\2252\245\235\b=8\210B\f\242k\300\"\303$H$,\263\232]\332\246A1\271M\343J#n\226*\260\213\231m\334\274\020\252a\214\266\231\241i\333\374\204w\347\022\254\225JAq\310\216&\244Nf\036o\332\320\213r\244u\347\377+\3016\n\324\274|\016q\371?rp\216\252bL\332\372\323\202\274\006\307\326*^\351\314\262a\202\037\224\201\371\303\205*X\256\032\332\300\343\312r\201\307U\273\226\306a\311\017PN\036-6\377\247$q\347\330\325>9\300\364y\216"
+	.string	"\020\377\033M\037\210+\335\026\3246\242\255H\b"
+	.ascii	"As\240L\350\322\013\f\027\230]\306\373VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_gyroIsrHold.50.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375 \316\335\005"
+	.string	"\302\n)0`M\323\030\003\371\212B!\270\203\353\034!1\334\323r\324\377L\224>\261\027\b\355X\354>vJ\020\022n\312]U\327\tM\001o\214a\367\226);\r\214\023\017OF(\241G>\b\302!\3429Q\276\246`(\361\304\027A\030\037\223\255:\354g\300\202\006\205\243f6\266\251|65\307\361zY\207}\033`\271\260\364\"\331\305hY\331\022\200\021\217__C\244gNP\220\236\004\025\323\211\301\207\211\205H\312n\366\\\207NmsU\020m\240.\224\312\232\264\t0\354\356\255\2622t\247\377\301\217\360G\001\007"
+	.ascii	"2\003\036::\020\302r\r\227\027\342\205;gj\347\023"
+	.text
+	.section	.gnu.lto_gyroIsrRelease.51.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"5\007"
+	.string	"\242\r35@s\322\030\200\260\207P\370\3429\t:<^\223\343Q\235[\234\201\227\340\2775\234\223\255\317\312\217\216V\257\242\b|\336-\343Z\216G<Vs\227w\226\354-S\223B\017\r\242\320\202\310\032 Y\\\024\325#+J\215\t\210\311\210\225.\f\226*$.\340Hb\320*8b\\\022f\304(!h[\255\366\241>5!)\216\3271\002\315\316\314\272\234\337L\356\231\274V\373P\357\004JR2%\221\331\375\330\321\331\224\007F\345\327\327\226\371\2407\210\261\234Sm\006\207\251,\033\277\335\021\355ewS8\341\243\236\347\333\350\206\262\004+8\036.7\273\013\337\211NusUM\003N\231I\035@\304\356\356N\031\210\376\364?\370!~\221\b"
+	.ascii	"\2059e&\036\346\243}\303\265\256\211\202\036\"\202;\267h\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_gyroIsrUpdateActive.52.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"m\007"
+	.string	"\262\31645Po\322\001\200\374\252s\211\230\335Ngz|. \216\335=\224O\034\023\226\355\326P\"\361@\003\305\030|c\"3\343Fw\267\037\346B\034\363\fk\t\2212\245\326d\340\205-\274x\301\310\331\304\307aPpx\232+\276\314\200\341\303\346z\021\020^\317\342\366\324\352H\225\340\243 \373\361rU\325\225P\n(;\333\020\037\211"
+	.string	"\273\213\340\213\274$\341w\274\362\004\226\027\275\362\261\313\253\253"
+	.string	"G\351\223\235\255\214M\026\233\363\244j\330\247VG\266\323\232\351S\r\030Z\305v\222iW\353ZV\245B\361\260}\333\035\333\262\301A\307\3319\222\026\360A\021*9\355rO7\236=3\377!\247N\027&$\246\223\315\363\304$\354\256S\264Y\334\372\002\333 \001\b"
+	.ascii	"2\241u\037\330DL8\256\211BC\350p\227\261\331\362\256{\003"
+	.text
+	.section	.gnu.lto_gyroDataReadyAtUs.53.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"M\007"
+	.string	"\222N45Po\322\001\200\276F\020\205\266\252\306p\250\323Z\200\231P,\206\354\343\270\2725\324z7B\367p\221oMd\232\304H\032\366\307t\326\025Ld\"\"\233l\231R\326d\242\3544\300)\343\344l&\34480<@\215\2340c\340\b\261\2210\"F\t\253m?\255\033\331Y!'\262=_\"\021\260\233\201\340\223|\233\360=\376\334\361\350\261?\337C\375\251+\320FL\264\344Jc\325\305\336@\3526\354O\273\273v#\333ju\002\034,\3315\224]\213\322\313\256\274\024\222\355\217]\371 \017\371\370R\240\be\230\017\214\212\223\226\335\rZ'\240\376\246\017P\177\256\343\327\365\362/\362\005\221\246\202e\240+@\302\356Z\261\354\342v\267}`\033c\233\024\007"
+	.string	"\013\013=\263\030|\205"
+	.ascii	"\343\232\222\205\310\303]1\265\223\f"
+	.text
+	.section	.gnu.lto_gyroUpdate.54.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\331\001\265\021"
+	.string	"V\341yI\320\362&\035\240\030v\214\314\314\311\017\034U\237\2140\202\327\346H\231\247\324t\233\263\\t\353\231s\272\026\356nm\226\322\304\3209\221\320\017\315>\2408\f\256\3609a\f0%\016\277\275\035]\035\035F\371!\215\021B\244L)e"
+	.string	"b"
+	.string	"b"
+	.string	"\363C\202\177F\260\372\347\335Q\300\177$?\001\377\231\264}\274\004\232\004\204H\350$I\3159\303=A*y\360\363VI\177vP\004\307\363o\305s\317;\220\353\231\032\301\331\274\224\246\235N\t.G\3273a\022\352P\202\253y\nX,Q]w\365\200\313Q\r\201\231sZo8\020w\310mW\260\r\301\326\001\001\272\213(\325\230SQS\201\330eM\367\307\2767\347\234\336\234\375\251\275U\257\247\326U\237\304\200R\355\tI\250\304\352(\347NU\220\271\373h\250\260}\373F\244_t\235GTB\350\314\322B\276\344\2202+\347N\310SP\031\263\372\247\322\303b\277\310\037\272\013\362D8)\266r\316\300\247\0246\206\244f\273\336\266\370\330vf{\302\231(\304X\024\024+P?\234t\355\326\227\\%;\3464\001cq\334\242\214\264\312"
+	.string	"\324\236\201\351o\2728>\265\235y\005\352\206\323E\364"
+	.string	"Z\261\373\343\307\300\257\314\021\224M\251lcxRl5\347t\361\217\216$\372A\377\234a\324\337\376\371#\370\357+\200\007\021M\253\374\257\233\027\215ML\214\251\021a7-\231\f\214\246\345:\261\005\227\006\f^\\\026\274\260\\\254"
+	.string	"\027b\0368X\331\305\022e\033f\302Q&\2165\2571\254\201\265b\241K6\206\254\002\026m^\262\360F\024e\341HI\373\346`h[;\270-z\232r|(jG\220\240\277yw\346\027\273\334\bO\003\350\231\350\215>c\\\315I\373M\206\003\037"
+	.string	",\241\261\022Efh:\303\031x<(\tZ\007\300\n\255i\037\210\002e\350\031z\020\260L\005$\206\031\020X\325v\030\353\254c\326\203\300\002C\346-\274\250\340D\030.s\034\025"
+	.ascii	"\234\270\244,\f.\277\226\034_55*\246\316"
+	.text
+	.section	.gnu.lto_gyroReadTemperature.55.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"u\n"
+	.string	"\226RF> \345*\035"
+	.string	"\234G\200\241/\266I\003\260q\276\260\275\316#I\214\220\243\001\220\327\202\341F\272\343\327Z1?\022T\262=\260\f\002\b\004"
+	.string	"\221\334\310\263\306v\211\361\225\017\370F\366\336)\0052"
+	.string	"5"
+	.string	"4"
+	.string	"\273\353\321\221\243^\351D\371\227}@\034S\257 \247\025\241\345B\036\214\254\372@\302B.\373\344\030Ws\nD\354\256\2478~\334\335mK\330\366\330w\b\335i\302\fM5s\366\224&1;\005\330\265\324\244\"\366\353R\227\375\351w\006d\315\370\223\334\256Gn\300\342:\230\022\333\357\030e\227\257\275V!\326\261q\003\020\267\235\030^\273\252\213*\324\r\0324\345\267\224\260I\302Z/\324\245\315)\205\215\2065\003\330\016\237R\342\354.\204\217rZ\206O\362\316\246\323\274\370\316?m\036\006}>\320T\341\205\340\027\216B\2417\262\230\020y 0\364>\013\376.B\240\207\361}\240\327\251\355\353R\2279e\f\247\242\253J0?;\013\251@\346\366\025\321G\"\315\002\024"
+	.ascii	"3\241c(\206\340\203\365l\257\032\332A\312\021\200\021\222\331"
+	.ascii	"\301&X\"\n\310C\225\025q\203\035\302qMt`B~\031B\\\272\251\332"
+	.ascii	"\231\242)("
+	.text
+	.section	.gnu.lto_gyroGetTemperature.56.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375 \374\335\006"
+	.string	"bM03`m\322\001"
+	.string	"9PP@\021\273\376\203+j\f\330\302r!\254f\030\320\bA\275\307D\307b\352\302x\bb\003*\205\200\275tG~\214\276\020\373K\231R\306\\\036\3348\270\b_\324d\242\323<4@8\f\214\356r\340\027\221\201N\342=\350$l\257\240T\204J=\366G\216M~\2077\234\274\365\346s\242\267\324\001\016\214*3K\237M\025\033\243R5\354\003\254\202l\247S\005N*\256\207Pv-\262\2255i%\036\266;\266\344\203<\244\343\3112QQ\t\037\031\024$)\273\353\bn\020\275\345\013\2427\335\370\364\234\374\213\234\301\023\312\254\213z\006,\354\256\323\272.n\275m\005\333\026\333\237\b"
+	.ascii	"2\001\0038\003^\034\240kxo\204\313B\220\341\256\230\332I\006"
+	.text
+	.section	.gnu.lto_gyroRateDps.57.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\355\013"
+	.string	"V\227R?\020Q]8s\031\200\305R\272\202\254\210\355\321\310\3736\214\200\220\035\013\021\240M@\335\3746\177/\301\001&cU\255.\n"
+	.string	" \002\253\351\201\217\203s\352\226\320Q\324\273a\025\275\264\211\224)\005@"
+	.string	"="
+	.string	"A"
+	.string	"\273\005L \362\214\202\331\366G\234D\310\242\001\026Fa%\304\207\322\312\306\356v\223\203h\317\362\037\3323\345p\321S\344\337\304\033\220R3DS\370\334\030\354\256S4e\270\365\266\005\330^`\337Ay\303\036\303\324\r\366\261U\r\266\323\333\307_\303\322\230\246U\323\251\351G<j\240LO\301\330\305\360\302\2611\262\026\b\333![b\007pq\231\366U/\021\372h\027\356\330=\211h\261\001\251W\325\313\270\360\202\2449\013\263\"\276\212\257\330p:y\261\243\bh\250l\177OaV\245\303\356*\260=_y!\256\335\265\2348\212\b>\352\231AP^|\346\203\264g\327\212\207\326(_\226\2346~`Ip\340b1p\341& g\002\006s\206\363>\n\233\016\374<\360\243\001\273\017\007\343\3512\037\330q"
+	.string	"\354A\320|\235\004\317\373:\311\270\367\246\224\221\222\214\351\246/\345\230\244\252\215\311h\0271\245T\320\320\001\022"
+	.ascii	"\2059Efh0\202\320\256\026\005\313Q5\374\272`\020\36095\3016#"
+	.ascii	"\006\301FlZ\355\232(0\213\375\202\t\002N\030\251VL\302$\003"
+	.text
+	.section	.gnu.lto_gyroInitFilterLpf.part.0.89.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\314\003\215\032"
+	.string	"\026\361\247G\240\\M:\024\366mx\300\021D\366#\\}\314\232\013J\272\004\2566>w\353;K\336\232G!\221\2765M\253QEK\353e\266\353\3219\032&(\216\325Yp\241\353rO\350\343Qg\206\277\227+\322\310&{\247\024\216"
+	.string	"\221"
+	.string	"\227"
+	.string	"M\\\210\273%\321\247\004\006\315n){\365L|\215\235@\370\n~@\350\334\227\304x\2713\226\026\224\031\351\374\223%P\320}I\f\323]\036Q\254\354\226\017^\335@|\265\237\304vn\311:\373\314K!{\337\026\244(\255\335\035_i\020\323\203\345\rN\335+Hg\250\363]\263\250'\300ZC\366v\257`\200\335\205\365\214@\bS\251G4\301I\032\251qz\337A$XP\310^\215O\001\017]\263\335\265\310t\273n\033\206\355 \233b\tn&u2\r\277\024\210-\212\323\256\220N\327?\375 \235\246\256\351\351\232>\254\200\202.\2733~m\266\251b)r\250_\352Ur\306\315\210\222\214\300)^J%Z[T\312>u*B\306\321$#^\217\034'2\216\322h\355\226\343\253K\221\332\367\245\376\304\367\371\345\\\316\217\361R\207\362\245"
+	.ascii	"\221\022\305TSIhv7\204\320\237\270\332Psdw_\323\207\312\371Q"
+	.ascii	"~9\367&.\034+*\267\267t(\335\3535\347\306h\337\211_\236\211\356"
+	.ascii	"\001\267\217\361\260\026^\305\270\350I&\220V\372I)\275\357\002"
+	.ascii	"\246\220\336\320\337\357\f\302\323I=\221p\020\315\237\355\017"
+	.ascii	"\277\002!\356\356\216\377\345`B\210\0301\"|=\375\324\220'\034"
+	.ascii	"+\032a\350\351\356\356(u\262-+\321\304\233[\246\362\261s\313"
+	.ascii	"0\253\336\273\360 \260:\027\022>\221W\227\340\231'y\302\252o"
+	.ascii	"\261\231\036\032\315\313\257\206\242\002\326.\357\244\237\345"
+	.ascii	"Z||\"V\3613O\376P\221L\274\3713\254\312M\230\235[Wl\347\304"
+	.string	"\246m\360\n\240j\353j7\003N\201\363y\321\003\006\341|\204Z\fu\030\242\001\325\204Z\324n\031plb\247\302\204\013;\021.\350\004\200\241\341\004\213\025\3254\035\333m\b\305\210\273\331p@5\334\b\344\323\3633\322n\270Q\307\200m,j\2671\310f\273\215/\333\363Q\027\255v\\\361(\221\351_\251\223_YT\2445k\312\036R%\333~\360\220b\310*\232l|\337\253\016\037!\235\361\300\335]P\244\227z\314\301C*\322\037\361\030s\364\016LJ+uQ{\003\207y\322\261#\272\263O\306\206\203E\332\016O\250Q4f\020c\0021fFf$\230a\330\006`\002!fT\035\021\020\252t\333,\373\031\237G\242\234\304\036\354\016i-\367\253w\352\330\356a\277\270\021\272r\005\217\034\366'\256\302\002^\203\267\201\214Q\371\261\241\365\016\037\271U\321\313\025\b\001\347\222\373\224C\316@\324\245'\244"
+	.string	"\204\251\353@\rs;B\267\030o\265\376y\356\333\333O\300k:\030\200lB\222C~n\263\031\177p\202-og\365TpR"
+	.ascii	"\212\316\332\221\264\214\025\375\242\tX.\347X>\340\246\363M\377"
+	.ascii	"\202\305\255ko\020T\3461\b\267\024\367\036\310\003\242\345\267"
+	.ascii	"\204)"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch1.part.0.90.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\202\0025\024"
+	.string	"\246e\203I\300\322Q:\203a\214 \257Kq\300\231\211*\272\240\037\212\036:\003\006\222\001\242\001\003O\006\275:\257\267\327\372S\242\256\375\310)\026)=\006\233\315\306\252$(E@1`\376e\250\246\035\301\032\321\214\311\032\261d\023\271S\nh"
+	.string	"l"
+	.string	"k"
+	.ascii	"\263\005\332H\306\221\321\024\004\361\323\270\027\341\310\336"
+	.ascii	"\362x'/^*\337\363\207N\224{\021\216\347nO\323\323n\217\301\247"
+	.ascii	"\023\210\237%7\020~\312\023\b?\355\013\331\306\361\234\263\247"
+	.ascii	"\336\003\332\373xt\220\204\354\256\353S]<w\225`\316\377\322E"
+	.ascii	"v;\272+\200\235\024\227\003\016\262\036\354\256"
+	.string	"E\025\367\274\355\024\3332\266\214\n\377\335S\245\301\367~Ui\371\243\377$&\nf\354\242\270\032\262=\023*\306\225\376\337\245}\377w&\337\311\327t\013\342\235\370^\377]\311\367\375|M7Q\3073)\001\243\005\325\356\312\304\317\373J8\177\311#\306=\251\306-\021\275\335\341])7\362yB\343e\337\206\217\364\032\271'\325\210:\236\310t\202\005\325no\301\247/\210\017T\266\206\353\330 \356\256\212\037\365\034\034\374\240Owhi\t?C\025!*\232\372\337[9\262\312\002\244TP\355\230L~7\2655BuV\005\365:V*U\203\350X\221H\r\371%&\005h7\347;\377\306\241d\374 \317\214\362\2731\374T \273\0259\362\312w\372MH\t\375XY%\365\307\n\036\\\365\261Y\322\254P:\f0\230\230m\234\205\266Z\314\215\306\246\202Ml&\273\321\310h\022\n\334\260\270\270\214\266[\204"
+	.string	"\376\240\342\240\301\212\312k\005\245\344\206\005&f\033g,\307PF\232\315\213\253F\033k3Y\3155\213\3610\343\212\321j.\224\003\036A\310h.\3338\322\\\362\340\252\217\277tQ\n\207\217\034\raU\375\261\215@\376\023\302\251\341\323{\300\304\035\347A\301\002\f\206!\203\374\316\340\362\260\364$\0025 \300\002\231\262\332\006bqX\327\177d\312\237\214\354-\005F\207\257bSs\205\007+g\f\004P2(i\022\214\274X\007\034\233\343\021\335=\300m(\327\b\217\214qAL^\214\360\306\f\322\006s\b'\316\322\360\003Q\237\027k\305\277\306U\327z2Mwc\244\232\f\370\275\242;\203a\242;0\343\"\217S\322<a[R6\033"
+	.ascii	"m/RN\351\364k\351\030"
+	.text
+	.section	.gnu.lto_gyroInitFilterNotch2.part.0.91.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\202\002-\024"
+	.string	"\346\345\203J\320\362&\035\003\201&\240\344\340\254T\304\313E\372\221~ \212Bb)\37722/\007\304\354\342\005\332Z\260\265-/\365\255\335"
+	.string	"\314E\217\225\276\311%\241\210}b\377(\320\313&\376\233\233t\031\362\307JP%\226l\262wJ\001h"
+	.string	"k"
+	.string	"l"
+	.string	"\257\255\317EB\214\212\244 \204\257\276\235(g\226K\222\t|\270\350|\351\317\370\020\356D9\256\273>KN\273%\203W+\b_Mn"
+	.string	"|\235'"
+	.ascii	"\276\332\227a\373F\032gK\275\f\3323\265\3309\032\262\273\342"
+	.ascii	"+eq\334\351\374p\376\223>\262\353\311\235\002\3509\3619\340\037"
+	.ascii	"\353\301\356"
+	.string	":Dq\327\333V\261=cO\250\006\337\273+\235\376^\376\224N\317\033\375/9\021W\354\362\\\025Y\237\372\004\343\274\277\367i\337\357]\311obZ\262\t\221(<\256\367\316\363\231H\246%[\230#OH\270\2101\265\273\261\360\365>\357\346'\231\304\267#\331\270\025\242\334\036\362<\034\311+\212\216\313~\r\377\3504pG\262\tsd\250d\342\305\324n\271\340\325\027\302\266\206\343\330\020\356\356\212\017\365\033\034|\241Wwpq\001_A:2DU\351{o\351f\225\005\314I?j\303b\363\273J[\"h\316\224~\364;VtRJ\265cU\022\025\30402*A\273\272\357|\033\177\232\361\205L3\316\357F\360\225\376\330\245\320\315+\277\351/\021\005\244\307\316\252I\201L\277\177\273\273\246?6k\232\005\316\257\030Xm\224\2015\232\214\255\346\246\302\rL\026\263\325\304f\022\n\340\264\274\274\2145[\204"
+	.string	"\376\260\342\240\001\313\212\213%\305\004\247%\006V\033e,\303R\306\331\r\214H\233\2154Y\214&\312d<\320\210\260\031ML9\340\021Dl&\326\306q&\316\177K\177\374\244\207QDx\350\250\216)\245@\266\021\314\177\002X)\350\364\035\2570\307uP\260\360za\3100\277\363\267*X\364#\246\0024 \300\002\241\262\316\001bq\370\327\177\316\224?\031\331[\n\214\036\276\nM\315\034\036L\316\033\b\330dP\322$Xy\261\r8.G#\352{@\333\320\327\b\227\214\361\203@\336\215(\026\314C q\206\206_\304\373\260X\013\376\265W]\325\2231\335\215\221j2\340\367\212\356\f\206\211\356\300\214\227<NIs\207mNYo"
+	.ascii	"\264\275p9\325\351\327\2561"
+	.text
+	.section	.gnu.lto_gyroInit.part.0.109.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`Z\005\325\033"
+	.string	"\306.\250F\240\\Qc\024\024P%&Nf\351\312\255|F\221\236\026\313\3754\2566\237%<q\336\305\341\n\006SB\234\177\376L\025\204\243\345\243\202\243\302y\fnZ\t\021\013i\357\003\fFv\312\037\270\215\273m\271\245L)\211"
+	.string	"\230"
+	.string	"\224"
+	.string	"\030|ozK\367\336\262\345?\021\371?\227&\272\323\220\221\376TT\336.\3002\263\177\372Lo*\272\323PLw^\336\013.VK;\267n@\336\306n`\274\025O`\274\375\023G\230@\204d\333\021&\024\331\374\231\204\343G\206GP\303{O\331m5r\363V\254t4}\334m\253G\247\t\0311UQ<\036\027\351\216\267\3435\207\247\023c\367\336\377Nk\360\214(\035\360\261\325s\3575\331\343n\335\366\t\3334\333\336\bX>4=\246\246\034\315\362\2105\004\312\005H\315"
+	.ascii	"b\203i\315\177\027\241\244\344Jx)\026\255E\\\307\213\267\022"
+	.ascii	"\261M]\302\250_%\265\313EM\276\250[$\365\350\242\266$\265\350"
+	.ascii	"\242\256$\365\013\354X\001\320\273\027G\326\233\033\304bI\362"
+	.ascii	"\247g\t\212\341\240!;\024\301\231\224\003I\212\310\267\036#\032"
+	.ascii	"2\304\250+\347\322\360\352\316\035*\257\"\344[\245!#'d\001\360"
+	.ascii	"\306\214\236O\222\264\357\030\007\372\201\223\036\220\312\003"
+	.ascii	"\214\205\372\342\344\302\263$Y`C5\264\320\201"
+	.string	"\016At\025g\333|r+\223\211T\343\2529f\232\350\024V\220\254\266\351\3644\031r\320P-;\341\0313$\235\342\263\222B\247\256\202\255jkx\325\006X\231{\357\314\037s2\034<|\3700\336V\251\2350\001\245U\254c=\360b|\310{s\337\371a\036\004\021\302\307G\304\b\372]\253\306\216*\316\266\216$\376\205\312\332\210R\253X\342^Lt\251KP\225\326Ju\024'G\263\316\205F\336\253\233\371S\337\362\343#\2715P\020\375.h\274}\375\357:\001^\221bFAB\205\031\204\n<?<\001\200l4\241\0246Z\007\230\177xj\266!\025\262\233\255vs\001t\223\271`Ak!\373\261\335d<\n\\{\001d\223\301\250\325l\262\362\342\255D\350\017)T\304\337\034\313Z\303vY\335\223\253F\366\200\217\240\003j\233>3\t\375\3161\243\2123\335\242C|-\271\033\223I\201\253\377\316"
+	.string	"\n\f\260*J\b\204Me\005O\357\275\270Z\213\3306\225\306WE\001<\243\243n\232\274\215\251\304\346\345\363\r\247\300\321\241\007~\215\217\2012B\273\252\313g\250QH\344\030B\002\031\022\221@F$\352\240\002\231\"\252y\022`\205)\307$S\2140\0066\246\375\357\374\026\0209\346kW6I\213\003\317\327\263\302w!\322\225/\312{\363]4hQ\267\233\303\032\354-\277\330\027h\364*{\202\345\345h\013\025\277_\355\b\312\2077\3377j\357^\020\210\245\277\303\205\325\231\341\260{99\250\226h\253\025 \315q\335\350\274\320\331\257\212\345\b4\tze\"%\213N\204\244\260\327\322\004c$z\213\252\200\237!\234\333\013\006\323\215\027(\204\332k\255C\322\275k\311\bF\223x\372\231\311!R\377\004\377<\331\240\272\303"
+	.ascii	"\215n\321o\003\222-Ri\275\025X\273\023\301\356\023HpK-\327\272"
+	.ascii	"V\301\303\351O\032\266\312x(\343\007"
+	.text
+	.section	.gnu.lto_gyroUpdate.part.0.111.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\336\013\2758"
+	.ascii	"Z]|\024@@\246N\007A\363\220\006\024\310$O6\206F\021<\313\332"
+	.ascii	"\200\205d8\fG5\304\023$C\3070|o\305\036\330A\374\300.z\242\002"
+	.ascii	"l\370\360\002_\002c\235\274Y5\021\021\332d\357\235RJ\001*\001"
+	.ascii	"%\001<\001\254\312\334\334t\035\345\256c\"\177\361YT\225\252"
+	.ascii	"\246\353'\367\033\2707\334l\272M\333nx\016Z\360y\245\317%\301"
+	.ascii	"\266\212L[im5\314D\316\321Q\026\302\241\003\227&\007\363\216"
+	.ascii	"\2162Q\313\335\22352\367^\342s?\277\270\347\032\312D\376\372"
+	.ascii	"\352g\313\355\3543Ll5\212\310\031\256\252\320\266\231\036H0\347"
+	.ascii	"5\013\376\201sb\261\255F9\251bn'w\\\313\265]\306\007R\314y\301"
+	.ascii	"\326?W\352\220\371\273\367\fB\253\354\200m\225\3734\323\332j"
+	.ascii	"\261\225\326V{\f3\177\235q\313\\\250\235\315\353\344\245\t\031"
+	.ascii	"\364\357\336\233l\365\247\360w\352lf\275\355\"q(d\203\253\232"
+	.ascii	"\276\033[n\260.\0063\264\2451i\"T[\332\222\036\246\310%)\022"
+	.ascii	"\332P[\316\224\2700M\302;K\222J\270\367\2169\333R\322\324:\210"
+	.ascii	"\244\327\364\301Z\236\"G4\262\224\311\017\224A]\267t\325\325"
+	.ascii	":u&Z\221\376\224\311\354\n"
+	.string	"\363\210\026\226>\350\203\263\250\241\355ehb\356\002\332\030\314p\357\345V6i>63\3631\263\016f\"W\377\351T\013\n\004\350\033\354A\302\363\377\003b@^\210\306\313:\372y7L?\345\3737Y$\245\007Fh>\"\222\315{\357\005\346\021\275\207\204T\336\275\327\252U=\375\3117;\245\007\262G\357\352\270\271V\346\022}\307\3041\357^6+\356:m\347\0047\\\253\234B\313\233\251\265\266\372\324Lt\306\003\271\241=\214\336ei\344w\035\320\337\215\337\330\367\336\313\037\205YJ\350\274\340\350\254\300\350\034et\206\022:#\217\316\t\214\316\b\214\316\007\204\316OGg\003F\347\002Fg\002Fg\247&\326y\300\321\231\251\350\274dtV2:\0130:\007\020:'\t\235\001\b\235\217F\241s\261\350L$:\017\205\316\302\2413;t\016\n\235W\326Y\025:\247\254\363\013\235\235u\356\253\024L\020"
+	.string	"k\367\232\005>\272OT;,=\327\375\354\246k:\314\205\004s6\315\252*\344`.\247\261\337\003\354CF\316\027{\245W\315\331L\353\347[\036\231\277+\346\204`\327qv\260\327\377\030S\2621x\016Y\376%[eg\001^\351\203\320\345\226\260)\236\204\351X5\001\337\3207\271\244\017\360?g\331\307'\351\217\030\311Z\362\"L?"
+	.ascii	"\177\374\244O\241\313,ai \254\3327G\313\232:\003\360VovJf\341"
+	.ascii	"C@<\271\220\254\245\274 \307\177\322\263K\303\207\007\357\357"
+	.ascii	"\275`\352\273\261?\204\356\272n\263\245\2367\016\241\245\276"
+	.ascii	"\214\371\323\007^\374\216:S\253\3538\220\326J\213\205\370\305"
+	.ascii	"o7\255\026_\266\\\330{\305\254\330\305|\254"
+	.string	"\365\322\202i\303\204Y[%N\035\272{\262\026\267\002\266E;\200\233%\023!\207\020\025\243zn#\277\357\1777v\260\036\276\212\247\236\230;b\217\332q6\362[\343J\031\\Wq\177<\270\3331k\253=\327R\242v\2624\352S\006\372m\307p\303q\033\327\226i\313\254\255\016\377IOMM\243x\2442r\376!j\300\207$\201\013\277\243\r\t\213\275W\331\314GY\007\232\200\314\241\2037\223\221c\017\306\354\013\277\241\335V\310\"\005\366\2145\370\354\263\223\251\205yhF\037\330E\301\247z\223\343#\262~\"D~\352\257M\250\373\f\221\220*\344\315s\002\323\347\333\323\013\f\303+\006\017\255\264\005\216\0264n\324\330\302\262\261\025\003\207V\227\212\0304\264V(1\013+\013\024\256\254&\\Q\255\240Jr\201\265A\003\313+\250\266\272z\274Hzumy\331h\341\225\264\021C\253FrE\227W\222\252"
+	.string	"o\335h\321\225\304\261\265\325\225$v\006\345\207\025}\244\367\266a\350\373n\342\202\237{\236Q\360\013\242\024@}\224\227\221\213\203\nD\376\0301a\022<\022A\202\003\217`\312\277x\351r"
+	.string	"\322\323o\321\222\305\300?\375\023*`\340\t\274\323\027\370\207\264\274c\005\216\300\367\234\236\234Sa\272\nyc\376\346c\252\351S\274\331\222\001i\313\312\326V\235\276\002 \336e\347\275w\330\200\257\321\225w\264\347Z\263\246\026\255%\322\344S$|7\007{\301\246\3474\225z\343\227\031\037k\257\353:\0054r\006e\3126}\32352B\033\277\351{\271\226\366\361\331\301\323\026\034\360PD$\235\315\333Z#H\332$IV\246\037\360A(Y\244*o\233\264N\326f2}3z\"\366`\334^\224h\356~\254-\333\272\364:\330\231x\223\226\rJ\353\346\266\266\272\364Ooju|\207\224z\216\351\226\362\036\312\364\023\360\001\200\371\250q<\005\231bDFDD\222\202$\351\220\002\021\241\252\252\003\021"
+	.string	"=\207\024\032\223\241\244\324\032\215D\304w\203\275\337:\237\213\305\310\246\241W\373M\230Jrq\250\2321#}\272\330q\226\217\"Z`\\c/P\033\312\224\022\031\25056\205(q\226\217\"Z`Z\357"
+	.string	"9\341\214\353\230f\003\313;\r\271\301\024&\032B\230\234\361\321\334\024wHv\346-\214@\006\035\224 5\346\te\330xnP\377\322\220\3032\261\356xIj\013x&w\270\003\361\006\343\356\252\316.\232il:,\36152\244\335U\305\353\t\032\256\340\274\004\013\364E\331\r\272\255\260\265f\263\307'\nX\306X\327\364!q4\31424`\206\203GGq\177\177\307\305\374\227\245R>\260\264\3210*\027\334kC\213\263l\026\224"
+	.string	"\376\300d\006\310\313\353\0173\317\245\247\217D\340\315\236M\006\023\257\327y\217M\bW(\205+\215({d\333\242\337\350\031\226\\e\362\020h\236@\346>\312}\021\341"
+	.string	"0^\374v3\357\374\213\352\035\376\324A\252E\030\207b\220:'\312\244\324G\214\217\217\343\266\205\305\031\301\004\305K)C8\365\353\3369h'\314\023\342e;\034\344\307\240\2030w\016\367\242o\330R\255yH\230\203\300\301\315\266@\t\332T\350\023x\302\224\232\246\020(\022\272\205\241\016#<x\001N\250\342\027%n\344\306\220\211|"
+	.ascii	"HUw\3466\301\374\366\342\255Z\266(\305\271\222&\202\366\334\236"
+	.ascii	"\360}\350\303\335D\321\241\006\311{a)\324\364\372\335f\233=6"
+	.ascii	"\360\274}M\346n\022\260\037d\203k\203Q&\234b\270\301\361\007"
+	.ascii	"\207\250\364\323\201\316\303\245\245\246\211\315\344\253\300"
+	.ascii	"\340\3016\013\327\336\240\237i\334s\226\252\001\t\343\316\241"
+	.ascii	"2`\225\003\360\3446!\255\237\262\344\245\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`\247\006\265\030"
+	.string	"\306&\220J\240\024R:\300\353\362\026|u1\345\005\273\027\033\333\364\211\351\353x\201\024\336\212\371\207\264\350\214\n\347\331 h\327\343UO\316 ;\330\n\376)\370\247`\307\343\177\2102v\260y\313\254\275\347\311g\2302\033-_+\371\222\310\024w"
+	.string	"\177"
+	.string	"|"
+	.ascii	"] C\0031\364\257D\353\221\013\355\263\3203itf\205\276\226\222"
+	.ascii	"B\337J9\241\217%\241_\245\214\360-\363\177Y\261\352O\2236\324"
+	.ascii	"W\262\025E\215\013\241O\245|p0\007\177\322`\267\250\216\256)"
+	.ascii	"\241NP>\n\230\233\031P\344\361f\210\002\202\356\304\004\272\327"
+	.ascii	"\217\214\311\377\032\253\317\331\323\njx\210\346\177[E\321j\344"
+	.ascii	"\357\377+\307\326j\255u\330\301\362\377\rH\375&1\372]0\372K^"
+	.ascii	"\364\271\\\364\241,\365\243\264\350\207)\365\305\222\372c[\221"
+	.ascii	"\372_G\035\264\225E\027\367\247\341\004\365\264\244dD\300\374"
+	.ascii	"\213\240\212\216\240\220\236\220\234\210\224\232p\276\306\032"
+	.ascii	"E5\346\212\366!\352\236R\030\300T\321<)z\210\242wN\264\216\211"
+	.ascii	"fP\242\027\220\350\234\021\215#\242mB\264\260\004\321\317\362"
+	.ascii	"\241\021x\350\003\035\332@\351{\312\241\257\265\277gmh\241e\r"
+	.ascii	"\001L\203\356\236l\224L:*%\367X\265\326\341\311\233\022wlK\026"
+	.ascii	"w\274)Q\307\266dQ\307\267dP\f;\031yp\314"
+	.string	"\224\356\314\026\034\\=8\226I.\257\310\325\331\020\307\247\017\216\001\244\313\265\326\250\037\034\277\034\367^dUS\200p\234C\313\355\216\262\006\343bKw\253nL\225\rK\276\245\3733*!>t\316\233\3349?\365\231\2449\365O\332\214\006j\352#\231\372Id\004\337\3430\207\327jK,Dx\200\341\324lV75\233\331\236\253\354\330\343\274\341=\356J\235Q\ryz\3037\344\226`hW~\004\205\274\350\205<\244%\344\027\264`\355\226\036\031\344\0340\310.\310\037\220o\250\017\310\213\334Z\017\270\373\361\315l\037\206\344\212J\347\343\023\215\351\261\316\210\325c\230tm\304\202\214=\253\307.\311]\241\223s\350\332L\221I\341N\346\031w\321-)6\206go\250a\024\306\201J$IR\220Ts\340\002!\"r\003\021`\024\215\032eD#\301\210\004\222\322\003\032\236\214V\201\254\251\302\"O\"\322\240L"
+	.ascii	"2\3165\336\234!SJ\200%\245lf\274\bZQ\fy\007\204B\377\331\377"
+	.ascii	"\265\233\223o\025\2738C\215\344\236\310\364\2217\177L\212\355"
+	.ascii	"\334:}\327w\372\256\277\333\026\205\213@\223\271~\370/\341[r"
+	.ascii	"/\337\377\247\331\236\320\375Q\\\035\334\334\345\301\255\243"
+	.ascii	"\021R\351\023\325I\200/O\367\256\305\363\224\334\360\007\242"
+	.ascii	"[\320\233\220\350\026j\265\316'\321\252D\325s\344\241i\2414M"
+	.ascii	"\312u\b\264i (\035\030j_\214M\002\355\001/\356\013U\"\210#k\240"
+	.ascii	"5,\363\021\342\374c\240\357\266\221'w7b\215*"
+	.text
+	.section	.gnu.lto_.refs.20ab49ad1462ba59,"e",@progbits
+	.string	"(\265/\375`D\001\255\013"
+	.string	"\026\035N2Pg\224t\020\220\221\0033@\021\250\252\252\252\252\252\252\252\252\252\306"
+	.string	"6\216`\235\342\021\266\241\205B\0375\220\246\r\340\037\350\267V\276!\324\032!R\246?"
+	.string	">"
+	.string	"C"
+	.string	"\323_!q\003\354' \336y\236#\375\345\321-\023\277\351)\217.\231\370Cz\306\216\"w\030\207`\234\303\270\306\321\037\032\237a\364\206\3053@\234\002\361\b\342\320\363j}\325\225\216\310\371=\020\035\323\376\244\237\\\207\334O\307\243{\307q\306=t|\335\367\230\2400s4XY3Fo\260/\245w\301\311z\222t\007\373G\322\237\305U\244+E\b\364\021$>\204\007\322\277\200\375\t\002\317\353\362\240^\027\007\365&\3233\213c\032:Fq\013\246\037\246\337\342\025J\257(\036i\277\270\364G\221aZ\260\360^\025\370\016\03208*8~\305\375\b\330S@<\342y\210{\316\361\315\275\346>s\001S\264\265@W\354\211^\211\t\360G\242?\327\001\352\3065bu\026\300\031\022_\354"
+	.string	"\345\360\250\365\262\002Pg\216/\\O\270\247\034\237\264\1770>]\2176lH\373\251\275\243=\243\375jk\002\027"
+	.string	"\330V\204\235"
+	.ascii	"B\224\026\210\226\n\241i\361\33374\216\215\217\332\204a\316\305"
+	.ascii	"`\202k\232`]\260\021\202=\n\316D\004!R\316\201\261\226u\232\313"
+	.ascii	"\344\2105\r\002\020\024)"
+	.text
+	.section	.gnu.lto_.decls.20ab49ad1462ba59,"e",@progbits
+	.ascii	"(\265/\375`\272V\215q\001\312fr\206U \fY:\215\001\324\347\240"
+	.ascii	"$\344T\270\300\020"
+	.string	"\265\226\203\241\253\333r\342\310\211.\272\362\030\031Vco\322\241\262a\204\350U\031\037/qT\342\022z\324n\3603\313\240D6\317\327H\364*\264Z\255lsn\274\316Ml\321\315\022\207\036\242\260-\311\336RJ\231\0022\007Y\b\232\bzQn}U~\347x\356\352\2124o\276R\256\334\377`\017\032\262\2653\271K\345\fF\030\217\r<y\3106\256)W\306\206 \327\215\272,7\337\270\0343g\350\246\334\374>\273\367?\210\362P\203\007\267\343FI\301\310\004\371\273\371\351\214\026\334\332\256\200\360\350\263\316\353\206zAB\004\312\315Oa\350\243m\264\316\266A\251mZ\240\364:1&\321\333\001F\355iX\310\263L\363\346\233\2064\3436\006\345\242\233$\251\321\206w\363\3216}T\355\232\221!q\223&\356\346\243B\312\310\200I6hu7_2[\246\367e\315\315wL7\251\220-\304\202{a\270"
+	.ascii	"\021{\321\005\366Vv\363Q-\215\344Z\341P{q\3633\034\375\234F\377"
+	.ascii	"X\240\3646E\350\302\314q\3633\235\276u\336\"D\202b\314\336\324"
+	.ascii	"|\375\022\371G\224\260w\270O\313\307\327\020\333\204Y\003n\210"
+	.ascii	"\227\317\025\2728X^WHJv\006jy\363\263\024\375\fEk\t\341'I%\327"
+	.ascii	"\207u\336\037\027\307\217\233u\273z\332\266\2760\331\331Rl\244"
+	.ascii	"\344\256\036V\206\214\247\362\346\313#\250\205F\r,7?\343\320"
+	.ascii	"\377\335a\235\227\353\037Q\342z;{\233\355\2759\200\330q\304\352"
+	.ascii	"\346\367\335\255\377\301\373#\314\23167_\035\313\375\344\352"
+	.ascii	"f-\240^\225\027\264\233\237\245n\216\213\343\356x\002Su\363\263"
+	.ascii	"\013}\314\247\217\317h\017\026(\335\200VuE\221\335|m\\\252[\303"
+	.ascii	"\3321\177v\362\355\312s\357}\303:\257\215+#\203\r\327*\n\220"
+	.ascii	"09\377\2774\254\363\326\2703\204H\374E\267\306]^+k\307tn+\017"
+	.ascii	"\340\264\344\374\366v\ne\220\303\246\314\304\344|\274\246o\235"
+	.ascii	"\317\273U\327\313^Zl,\271\371\370L\037\223\351\3430},D\037\373"
+	.ascii	"\320\307[\032\306\177\241n\362\276\260@+\271\263)7_\0277\312"
+	.ascii	":7\\\345m\233+u\364\311\271\235h\200@U\335\374c\203\322c\246"
+	.ascii	"&\301\336vCj\377\376\354\206\364xJ\213\260Aij\201\322\343\244"
+	.ascii	"\276\323\315\357\376\255\237\255\263\177wk\357\344\336[\303N"
+	.ascii	"\334\033\0276n\266o,\034\353|\025\033g\373\330 V\220An\376}\243"
+	.ascii	"W\330{o\373*)\360UR\333\246\350\326\315\201\322%\323\351\203"
+	.ascii	"\343\346\\\274\271\371\362\351\035\013\224\376>\365\343,P\232"
+	.ascii	"\306\362a\347\033\026/7\377zIs\347\264\325\263g\254\263\203}"
+	.ascii	"~D\211c$\232\017O\034%q\336\364m\207\324\376\331\016\351/\023"
+	.ascii	"m\327\243\023\005\307\303\355f{wm\031k\346\366\316\222\371\210"
+	.ascii	"\022\337In\263\275\235\366.\357\375d\255\005=\326Z\200V\371z"
+	.ascii	"JK\363\357\230\376%\242A\330\240\024\204\005\023L:\267\332\336"
+	.ascii	"v>\026\b\035\03077\377v\351\337\033:\315v\261_\324\264\221\272"
+	.ascii	"\371W\251o\343\350\333Y\240\364v6(\325\"\3443#\307\023\345\315"
+	.ascii	"\267e\364I\304Y*\370l\251"
+	.string	"\241t\375=\367v\376\267X,\235u\332,V\356\331\2717\333\336\273\310f\261U\354\025|\266\334\311\0373.\200z\342\266\306oog\006B\031\360@\361sc#\315s\326\212\017\214\257(\257\233o\177\314\331,}\033e\247\\+'B\244n~\b\264\224\257\372B\375\333\267(L\345\215-7\267\340\324QN\341}\335\374\024\264u\263P\234[\250g\214\024,_7\177\004}\023\372O\013\224\342m\203R\021\026(\265\333\002\245e\326\314\246ae\214\255\315\266\267\363\002\232\226\205\354\351f\273\3042\261\3163\213\366\214\266\265\325\366v\362\340'\033[\340n\366`\203\322l\201\322\235\241\333&\367y\332%~\365-\210\324\347\357\357\357\317\202H\357\264A\251\266@\351o\265\n\360[*xI\b\256\002\260\331o\341\202`\t\374\226\253\354\177*\3746\347\267N\377\315p@\023\302+\360W\215\005\374\250\006\277}\200\205"
+	.string	"&\373m\003~\013e\215\377\237B%X\n\373\2707l\b\347\200U\030\373\361\227\030Z\304\353`)\200\037\223\360\3335G\360\007F\262\222\250\316\217\023"
+	.string	"\366_\021\214"
+	.string	"7q\021L\004\177=+\261!\270S.\374h\327}{\376\321\034\277\355\340\267Ak\342\267\373\267\036 \340:?z\343\267\017\260\020\370\355\006\277\005\301o\031\200\327\037\037\260\017\032\004\370m\362?\030\240\377\300\037\235\361[\026\277\025a\211^f\352\370G\245\376l\361_!\264\004\277\325\372\355\215\333\201\325;\300\237\226J\002K7\341\002\370\263\006~l\301o\367\272~<\364[\276\036%0\017.\233\201\037\027`\307oY\370q\321\326o\233p\t\035\377\275\300\1771\360c\255\377q\270>\b\375\327"
+	.string	"\316\201\263~\214\205\2316\352\n\370\363\bl\220\017\300\306w~T\205\337\006\3013\256\222\364G\217O\222N\260\325\355\333\007\360?\005,\365\t~T\255\352`i\301\177\241p\025V\342\250\233\f\376\366\017/\177\234\002\325\177\203?\226\201\247~\234\201\030\2775\363c\030\326\n\277\300R6\353\267Wv\371_\016X\371\237\303\177\t\334\034\034\365\3475\370\263\375o\022\354\342V0"
+	.string	"\334\342\307 \370\357\017NB\375\377\360\343\247\377\206i\370Q\246\037_@\302\370/\0016\260D\277=\376\357\3622w\350?\206?O\340\307\373\267#\370\257\005\227\300\204\037\217\340\267\"\370m\021\213"
+	.string	"\204\037\263\360\333\022\374V\303o]\330(\314\342\277\376\321\022\277\215\362\333\263\337J\371\355\223\337\266\375\326\355\267N~\333\302o\325~\213\366\333\267\337\306\375v\355\267i\277\205\373-\333\177\305\374G;\320\217\302\3758\375q\360\3079?\006\376X\347\307<X\205\377\366\375\030\3751\306+\376\363\374i\207\037;\375\330\370\343\024?\326\300\217+\360\343\t\374\270\204\037\203\360c\017~l\342\307#~\274\301\217\007\360\343\013~\\\301\2173\374\030\303\217{\376;\346\277S\376\373\366_\267\377\322\370o\333\177\327\376\253\366_\264\3776\371o\331\177\225\3747\354\277b\3775\362\337\345\177\223\377m\376\027\310\177\377_\037\377\335\372/\326\177o\374\267\306\177\253\376;\365\337\026\377%\301\177U\374w\003\377\315\300\177O\374\027\204\377.\340\277\035\374\367"
+	.ascii	"\377-\361_\022\377-\372o\210\377n\360_\002\374\367\303o=\370"
+	.ascii	"-\003\376\203\371\255\210\377e~\353\200\377V\360\337\314\377"
+	.ascii	"\245\377r\370\255\213\377q\376K\340\277?\277\r\376\226\306\177"
+	.ascii	"\001\360_\241\377^\370/\317\177s~\333\364[6\377\377~\273\346"
+	.ascii	"\267|\277\335\373\255\336o\361~{\365?\205\337\006\371\377\374"
+	.ascii	"\355\334o\253\374V\356\267T~;\345\267=~\313\343\267\\\377Q\374"
+	.ascii	"v\307o\267~\253\343\2675~;\343\277\t\277\265\372m\325oc\374V"
+	.ascii	"\371\333\250\377i\377\327\377t\377+\370\373\373\373\373u\342"
+	.ascii	"\376\236\007\374\nX\006M\262\332\335\037@)\367\266*\202\263W"
+	.ascii	"\326\364\363\001\243\357c\2479\310\r\345&6\237\235a! \366\323"
+	.ascii	"\023\006I\300\250\350[,$\025\200WYYf\262W\002"
+	.string	"\216\224%\317L\260\306fp\2719\233e.*ep\256\370\230\351\0160\206\236\225(\3119\204~v2\215\254\351\003Ds\350\033z\026\023\023C\372\320\320\367j\3509I\022\\#\243\311\335\343\253\2717S\203\034&M\254D\271\371>2\364\355\032z>\342\314G\354^F\242m\252\234\026]\326\\\361\333\373\212\006;l\316\330\224\271\371=w\232\303\335\3203\030\330\363\322e0*\255\310S\213\346\300e\350\271\310\2553\027\3119\260r?\361"
+	.string	"\221\244\213S\203\367<\321\002\230\341\345\225\277\376\263\367\206\332[+Gz\0056\344\371\353\\\224om=a\232\202\276\241\347 \316\034\004\307\310H\264]\225\023u\206\346\351\2677S\003tM_\227\231\233\337\243\324\003\340\222\267\236\267\362\017\273\367\336\314\215Dc"
+	.string	",UK\020\177\346\361\374\343\037Q\"\373\310\251\321\234sqs\356\262giQEn>\217\233\334#s\351\031N,\032\231+\357\300lN)J\354\002wA\202\303\312\315\347y\352\254\025\246E\217\260\233\317\363E\347\254#5d$o>\217\024\315\241m\350\031\313:3\326}q\202~\001\245\345\324\177\276\312\314,\2643y7\347\033Q\222\317\265\233\317CD\377\271\206uf\033=fU\236ln~_\246\361?hTE\210\337\315y\306\316\223\215\267.7\237\247Ks\020\033z\246\262\316L\225\253>`\333\273\312\303\021\246\006A\257\262(\267\233\363\262\247G\f=\270\233\317\243\245\317s\245\207\322\f=\307\310\310<\205\361\354\266ZN"
+	.ascii	"F\226'\017\f\375\0357z\350o\350\330\31532?\345\027\037\264\030"
+	.ascii	"*\223\002\322\251\305 s\363w\364\364m]\216\312-\016\327\023\334"
+	.ascii	"\373\212\226fVf\027\326\231\243r2Ge\250\324\f\230P\006<c\326"
+	.ascii	"\262\324\322\374\035<\375\035.\372;X\364w\334\364\220\226!\374"
+	.ascii	"\006\3039\216\223\2218N\336\032\2717\322\271\2516\224!\313\232"
+	.ascii	"~\233\311\004\241\203\254\351\373\372{\336eS\2347v\224\350\377"
+	.ascii	"\366\367O\367\323r\357m\205:\367\022j'\375\355-j-\210\237\307"
+	.ascii	"b{\301\377\2747\007\353\336Pkv{o\313\247\217\300=\341\360\260"
+	.ascii	"Q\273\245R\215\013\371\001W\225R\215\253\352\2022\311uC\251\306"
+	.ascii	"UuA\251\306\265\221I\"\310\013\313\315\205T\252\355}a\357\275"
+	.ascii	"w2\211<\261U\245T{\332\027\224j\273j\267\360Re\267\223\013\271"
+	.ascii	"\223[\373\302N\356\247\255\266U\345A\231\344\252R\252=U]P\252"
+	.ascii	"qUm5\256\375\263\223OK\251\344^^\330j\\{[m\253\352G\251\266U"
+	.ascii	"\245T\343\032\263cR_\254f8\261\373\361\302\236)\223[\306T\326"
+	.ascii	"\323\362\307N\351\334\332d\366\266l.\366r\333\355}\301\336Y["
+	.ascii	"K2O7l\034\224\235\f\250\026\236\266\254s\357\275a\n\212\307\326"
+	.ascii	"N\332!\355\266S\"\331\332\033\t\224\322\236\332{o\003 \235v;"
+	.ascii	"\210\265C\366\310\3321\\\354\r\200\355\334{jo\244\335v{o\344"
+	.ascii	"\336\033\270\314r\356\215\365\243lNM\355\315\024\232\332YH)."
+	.ascii	"\366\276lwqUJ5\036[ER\326\324\232;\312\211\264\312\030[\273\271"
+	.ascii	"\311p-\265\032\362l\307\330{\3334\272Y5\003\315\315\337Ij\016"
+	.ascii	"L\206\216\331\334:1\033\034\205a\371\200\264\034O7x\315\236\231"
+	.ascii	"+\036d\324`>\025\320\b\311\262%\r\336\2737`\030\261\272\371:"
+	.ascii	"q\370\331a\017\035\353\351a<\022~\366\346\241\244\251\223\246"
+	.ascii	";\330\030:\276r\353\304W0^P\f\254\254\351\267\227K\r\314\234"
+	.ascii	"`\246\265\270\371:L}\265\205-\256\210\213\220808\f\036\203\357"
+	.ascii	"\360\027\\\006\213\261NL\006w9\306\202\263\254i\201\213\263"
+	.string	"#\323\\\243\303\314\236\340\336O8\342\220^\344\312<\311\340:\314\354\371B\212\371\365\304\2251\221\372\311\317a\243\237SF?G\214~\316\027\375\034;\375\234-\3729Y\364s\254ht\313\006\245\227\203\242\177l\245\254\307\013\036\031\225\271[$\277a\373\222V\345\252\241YT]\246\3440\223\311\324\225\222\nv\363\313\362\204\356f#C\354]\321\362on\f+!\363k.\311k\216\025Y\376\315\371\371h\376\315\371a#G\336\024\371\213\232XH\017\272\367V\234&~\303hx\nf\303Pp\013x\rG\301Np\032\206\303R\360\023\254\206\343p\233ub7\334\344\330\211\317\236I\020\301Bz\236\234{\t\204{\272a&SN\251\257]f\367\276\236\177s~E`\037\230\301yb$I\354\335\231\346\337\334\230\331\306yv\177s8\354/r\303b\366\016Xd\353o\356&\261\033\366\302B\254\035\220\375\204\344"
+	.ascii	"l\353oNH\327%}d\271 [;\033\224r\260@\351s\226\350\347\030\321"
+	.ascii	"\317\251\322\317A\352\007\375\364\203a4\007r\372A5}\266$\372"
+	.ascii	"qA\364\257\330\240\364A\032\372\332\215\376\323\006\245\327b"
+	.ascii	"\364u\024}\315D_\177i\374\003\003\261\316\0178\210\323\347z\301"
+	.ascii	"iK\273\371\272\207\276\375\220\342\277?\373!\275\226\241\177"
+	.ascii	"\334\025\225\345\t\356q\007,\233\343\301\306c_'/\236np}\320I"
+	.ascii	"*nf;@\360\260\021\0035\266\245\245Cg\306\f\330\315Z\370\006f"
+	.ascii	"Z;\266\034V\207u\340\034\326\211\2650\216_#8\353\331\271wR\013"
+	.ascii	"_a,\240[\334\337\034VvI\003K\263\3356(=\020O;}\202b\322\344`"
+	.ascii	"\273\371"
+	.string	"\300-\230y\270{\271\354i\371\335|\240\234\376\261\215\032+\230L&5\354\326\336\032zf8\031\303\242\261AL\212\016\037x\306\363\220gbXn\306Uxm\236\334|\353\304U\313\236f\022Iw3^Z\220W$\311\315X\306\363z\352ztA\336\374\276\277\201\315I\205\335\214c\330\215\351h\336\214c\334\356u`k\340\321\223s~\335\214_\024\035\303\360\300\253\007\331\315\030Kup\332\230\352q\363\217\2258*\307\f\354\354\313\315\330\005\312\305J\234!7\037\bE\337\232}\261a\316\304\2218\273kuO8\367\357\306\271|\270\305Us\331\33457\315\335\273n\256\337}\203\367\355\273m\360\023F^48i\235\030\352\n\371}r\331\216\334$\034\240\224%d\225y\356\3554\022v\227p\200R\222\020\207\314\332\324e\346|9\333\354\033\017\345so\247e\263pv\213\265c#\201\357\017C\335\266\373\344"
+	.ascii	"\245\334{\206\007\260\345\266k7\306\341\254\035\233m\206\345"
+	.ascii	"=/\362>\335m\355\3302\331\231 \027\214\003\224\222\2046wO\264"
+	.ascii	"<\273\327\203\367\326r\323\\\303P\267\305\205a\355\200d2\275"
+	.ascii	"'\032\333\227sfK\314o\271\214\261x=H\347\246\312\201sv\301\272"
+	.ascii	"@t\362\232\233\013\206\262v\326KO\322\271\253t\250\354\334\214"
+	.ascii	"\371\325\215(\201\241\354\032\273g\355\230\036\220\261\301P\227"
+	.ascii	"\311ur\200R\222\240\206\213U\203\241,\233\273{\222\316\215\004"
+	.ascii	"\026\331n\306\374\366\336\031d \224\001\226\241\245\n\222\f\362"
+	.ascii	"\031\262+\260\0277\037x\245\303\334/Nd\\A\271o\034\270X\006_"
+	.ascii	"\204\301\272W\377\210\022\227\314\035c\367\260\263\t|\322\205"
+	.ascii	"\343Y\004\346bqB\325\334\333yk\006w\261p\340b\031\224\021\346"
+	.ascii	"\212\304\177\215\220\271Y\356\027\016P\312\235\2350eh\215]\274"
+	.ascii	"\233w\357n\231k\346\352Y\347%s\305\334\256\331'\027rf \324\223"
+	.ascii	"\344SS\322\223\017\214\322O\371\364"
+	.string	"\323<\3754L\227\353\305\016\310%H\322E\\\227\3331\300I\033..\277v>`W\224h7\337\272+\207\367\206\246\274\371n\261{\\Xd\317\233\257\026\273\327\002\017\263%t\030\315\254\257\t\335\355\336\375\262%\006\224\223{e\256\n\237\230\263\233\237\026\2612\347\023b~c\350\223\031%V\344\236V\321\351\261\343\007\326\315)\025\224\310\023.\25527\247S\354\336\225S\352\t"
+	.string	"\037\272\00267\267\024Nh\013\217\371b\304j,-s{q\344\355)\234\036J\205\216\207\331\315i\013i\024\324kKGX\024\373WDF\221>>]\301\231\264\264\264\r\312\223\207\311\203\013^\312\366\264\rm\033\302e\355\346\364\211\016\214'P?nN\327\016g\347\2641us\352\004c\r\351bb\343\346T\r\250\003\312\233>\354\247\346\245\314\316\213\016\300\025\023&\351\331\0273`\337\021\031O\251\363\351\031\034\016\033zV7\247M\246\350"
+	.string	" \031\033K\315\024"
+	.string	"&\346\347\223U\206\003M\331S\263\251\036\313\345\315)Y\006\303c\346mJ\313\315\251\022\273G\025\347\006\311\206%\272\202\255\024I\212$\r\363j\242T\374\354\270$y\032\246\327\243&\367\226\206DW\360\242H\221\324\210\220\336K\322\206<\367f\202\020B\0133\006\354\251\221g\030\277\233\323f\331\330\225\032Ct\2073@\016$\375\262h\233\212C\022/\\O?\027~O\304\322!O\277\016w&I\223H\352\305\306\311\033\033\251W*\004\215\253\206\224+{\307\2569v\226\006\311o9}H\262\360\335\374\r7t\207\272\036\177\217\324\207E\333T\034H\363#\313X\036WU\220\256\247>0\237\025\221(}\377\203\032\376\274\242n\276\320\025\335!\312\326V\312e\341\216\370X^\2544uBv<\345\312\211\343b\317\r\315\377\240\210;/\"7_H\211\256"
+	.ascii	"\314\306\323,\033\251\226\355\263\316\315\334B\242\031\322A\307"
+	.ascii	"e\304o+\263@$\371\320\241%\307S--\351\237\2238.\270$oJ\240\334"
+	.ascii	"\234b=\305\361\007\201c\302\320\241\335|!\244N\231O\257\376 "
+	.ascii	"\212c\206\031$7_\303\033\375\2477\376\340\016\020-uhn\276\006"
+	.ascii	"5\372\032\316h\017~4h\\\"\026mS\331\037Vq\306\374\346\360\356"
+	.ascii	"\2267_\303\022\355aL\272L\227\251\325\221\2476mt\324\274H\223"
+	.ascii	"V=\265\372\322D\f\031\254\377\301\264\216\352M\233\233\257\301"
+	.ascii	"Jwp\2269\232\346^\241|\326\211\226Ie\024A\355'/\f\226 ?xQ%\344"
+	.ascii	"\346t\n\030\343\013\306\233\233\257\241\205>\t6\250\033k\007"
+	.ascii	"\344\203\2602k.\235\231\231>T\r\3363*}\221\302H\225i\f\353L\245"
+	.ascii	"\3207\277W(\337\205\256T*\205\372\335\031I\245P8i\322\357\271"
+	.ascii	"\367\316\200gGT\233\216\235\214\366=\217\003\224\222\004&z\317"
+	.ascii	"4y\263R\250(h\326,\375\322\026\251\013\353L\223\317`\003\217"
+	.ascii	"\2332~L\322\374\247P\351\323N\334\013\034Q7\247H5:\030=n\376"
+	.ascii	"\004r\372G\377\2543\335\327\2132\002\207\310\315h\234\347I!_"
+	.ascii	"\300\230\340M\177\2023\264\215\016\363\314Q\246?\201\230\376"
+	.ascii	"\004F\364'\020\242\177T\r\235Z\026\276\272\233?\201\017}\267"
+	.ascii	"\rJ\321'\212\306\207,\316\207\333\315G% \204\213\333\315\371"
+	.ascii	"\314\245+\322\234\272\371\250^\017\031\"mg7\037\315s\373"
+	.string	"\343\273\272\031\305\323.&`~\310\311\361\246\003\307\335Q\274\037\255\202\232a\341\017\316\232\233O\306\006\245\326\257\350\350\235N\335\334\263\311\315\237 \251;\254\rY%\026\225;*F\016\035C\002s[\211X\262#K\203\240\\\031\225\213\233\235I\2500H07\243^P0h\230?\030\244\022\343K\326\315\017z\243\217~\001\342\345+\311\315\327\276J\212\332\035\355\362\007\201f\313d\333\315\017Z\243\217\326\241\\\376 \206\243\205\212\324\315\017:\243\217n\371\037,\201\231\035JnF\265h\027Av\037\202why^sG\265\374\250\025\\\004\245\353@\f\034\31437\243X\320,G\351\320+\033\2453\300\326\336O(\235\317\233\275\237|\254\265\300Z\0132\031\217\"P\322\374 :\335c\201R\264J\321\321\271[\204\215\216\356f\036\013\224>\310\251-\270\022\027\207N\tz &\244\251\237\350h\220\241R\216N\341"
+	.ascii	"\214\0315\252\324\220R\266\005\211\266\240/J\024\364\355nm\261"
+	.ascii	"\034\317=1i\352\336\356\213#K\326\254\335\374\240\035\372\002"
+	.ascii	"\244\233\333uS\223\356u)k\372}\241i\301\343\346\007M\351\013"
+	.ascii	"\310P6\224\rm\303J\251\234\b\342\243F[\246\221\361\346\376\336"
+	.ascii	"\334\374\fn\364\005kkkhX\260/\225\002v\335\374xJ3F_0E\ru\242"
+	.ascii	"\226\367\335[{7\201W\216\264!\242\361r\336\374\fW\364\005wgh"
+	.ascii	"\332\031\212\346!\271\267\213\275\002\230#e\236\233\231\005\342"
+	.ascii	"\262i\222\367\004\315\356\351\224\251\032[r\3633\264\240/P\263"
+	.ascii	"d\t\332$\025\333+k\216Q=\373\33409\332\244G\213-\031Wim?\232"
+	.ascii	"7?\203\022\215AU\031jVv\3356\300\321i\263\002C\346\346g\330\322"
+	.ascii	"\030\230)A\311\224\240a$ \327\234\005\251\224\341\371\270\371"
+	.ascii	"\031\\ A\305\220\240a\003@C\223\240bh\0224,H\207\317\030\034"
+	.ascii	"),a`Gx\304\270\371@p\364\201\3624\006lFn\344\272\351\235f\317"
+	.ascii	"g\212\027\250\345\026\355\341\205\220\013A\233\366\307\t\365"
+	.ascii	"\005\256\031\224b\204\311\025Z\344hs\231\345D\355f\324\013%\242"
+	.ascii	"\305\311\035\034J\004\375r\362\211\t\223\002\302\261q\206oHN"
+	.ascii	"\006\241l\201\341\003\212\242=H\001r xi\3216\225P\022)b~~Wl["
+	.ascii	"\314\364\207(..\324\007\\\227Y\316\232\222\357\207\017\264k\033"
+	.ascii	"\361\322\205v\241=\316P=\317\264\240n\312\326\344\340a\345n\233"
+	.ascii	"\326\020\276.\375\341F\326\263\320\255\273\367\336M\340[\230"
+	.ascii	"\261'J\206\315+\314\026\252\203\254L\2261:P-<$\177`\3168}\236"
+	.ascii	"\350\240\213\312q\305t\311\251\201s\363\201\226\372"
+	.string	"\303\017\364\n\275B\261DT\001\313\002\241\375\376\334\322\216b]\271\035\037XQy7\037\350Iw\370\032:z\343\326\211\336\310:\264\324\336OL\021K\220\350\2210Z\342\334|\f\317\031h\215\031\327\355\002%\r\264\006\215\353\226R\221\362\344\211\310\334\315\307\020F\037\003\025*\264\212\n\003;t\211V\241K4i\253\200\2255\3076\223\t\002\215\302\025\345y\36310\321\307\300\245=\224\241Qh\024:\325\201\005\342#lF\214\243S\332kF\\\215\233Q%\n\343\177\320'\210\031\230\f\030\350\213&O\2760\315\330\250\255\0359P)\334E\307\314\023(\345\315\030\250\364\367F\223\351\336\326\271E\265\334\314%\210!-\024\211\266@\221h\322\356\345\336L\005Da>7\223\t\242\207\213\030'\331\315?\nu4\371\346\023\215\273\233\321\247\016\\\371\302u\363\373\260\220\377\301\334\344\b\323\307\315\277\320F\377B\235\036"
+	.ascii	"\214\241g2\310l&\307\231\241\200\262\263\034\347\317e\362]\206"
+	.ascii	"\323\246\205\334\217\233\275d\261\2561`n\316~\031*\253a\203\366"
+	.ascii	"|\225\236\340\336\\z\3153gl\235\236\337\363Mf\223\333d7y\215"
+	.ascii	"uf\277l\367\214&\247\361\313{y\317\235)I\240\270\330\311\177"
+	.ascii	"\356{V\363g\274\234w\270\2361,e\334"
+	.string	"\315\231\257\350\271o\207\n\225'\0367\177\215\005J\003\360\234\242\177aM\377\202S\377B\230\256"
+	.string	"\333u\351o\3316(\325\211\263@\351/X\351"
+	.ascii	"\310\r\375\317u\257\313b,\332\246R\200\0241\277\261\275\231 "
+	.ascii	"t\020/pv\230g1iN\222\300\2719s\311`R\"T\312\026\300<\177\301"
+	.ascii	"\272\221\006\311\315^\264RH\214\256\233\377\363\247s\227l\227"
+	.ascii	"\003\344\206\227\335\315\377\301\323?r\372Z2RK\336;{o\244s\213"
+	.ascii	"jC\031\362\247L\013\340\312\320\363Z\223\334\226\263| \365\207"
+	.ascii	"\314Y\376\374$\263e,(]\023f\334\315Wr\336@\245\001\273\371?G"
+	.ascii	"\364ID\301\021\327\302\234\031)\257b\355\330N\030\301{\232\271"
+	.ascii	"\225\305U\311S\262\\\236\313V\2543S\311o\317p9\216J\206r\270"
+	.ascii	"\236\244s\017\301\220g\204\353\351\267\367\006jy\271\022\267"
+	.ascii	"\223\377CC\333-\033\224f\260@\351\177b\350\377\264\320\367\211"
+	.ascii	"\243\357\263F\337\347\251\357\203\247\261\235\rJ=\260@\351}\304"
+	.ascii	"h\001\274\r=\247\005\352R\n\341\352d\202\260\270\244\002]\217"
+	.ascii	"Fu\351\210\305\222\2208\024\2018\201\343\260C\022Q]\205KNGK\302"
+	.ascii	"\n\256DT4\036\r\223\210C\343z\234`i\311\211H,\022\201\253\221"
+	.ascii	"\312\302\360\230\256\352\221IeJ\257D\244\256B\024\324\245&&!"
+	.ascii	"\212UE!\302\t\021\310\260\016\211%\364\\\211h%\252LHFa1\305q"
+	.ascii	"g\035\022K\270@\201U\035\301g\035\022K\310"
+	.string	"`\024\252K!\254P\221\264\322\321\351\204\025*\322p\205z\002\311(D\"\nW\024+T\244\fW\":\036\r\327\343p\025\256(>p\024\246`T\227\234\220T\245\243#\207+\021\205(\0165\244W\":.-\t\217\216\3530E\b'b\322\006+8\021\207K\033\030\300\204\221\t\016V\b\241\"9-\035\021\207!\214G\247\020!T(\032\225\326\"\021\250B\250.\345\365H,\036\241*V\342\320\270\224^\211H\375\200P\305\005#\250\037\020\252\350\271\022\221\221\3124\\\211N\306\020G*\002\260\252(r\326+\02159\025\215IFFuU\231\204FaS\210\244\241\n\"\006GD'\021t\320\243QR\323\316jDLjB\211IMXeax\314\307\243jDB\022\002\215k\023>\017\013\243\021\020\222\nDR\217N\371\b\274p\025\"\031%5\021\365\030\205JG\331H]\205KMLj\nIM"
+	.string	"86\235PW!\n\253:\002\320\261\002+\b'V\f\327#\020\214\307\022\200\324\243P]RQ0\036K@Z*\222`<\226\260\252(\216\352\322\021\213\020T\024\352\252.51\025C8\0167\350\243\217\217\bKKN\304\237\tL8:5\200I]\217,P\\\310\0311\"C\221\322\321Z\224"
+	.string	"\005H\352\322\322P\205\316Jt*\206\240\263\202\212D\034\242LN(\222\210\303\025E\246\340\317\b\"u\025\256(\326\243\021\006\022\352qX$\252'\214C\025\032D\020\255Fa\023\221\320z%\242\243\322*d\"\0321\341\243\321\n\025i=\002M0\001\005\322R\321\210)E\241\202J4bJ\215\302\025X\004\221Q\270\002M\262EDIx\204$\342\321N\321\310b\004&cQ\205Qm\232`\004\020z%\242$\247\024*R\b\244\245\241S\n\025\251hB\222S\n\025)\310CT\321\024\201UE\361\230\341\250DtDR\221|V\026KMM \220\270 \"\005\242\b\307\325\350X\001\225i\270\352\265hd\221\224E8!\002\006 \022\341\204\b\370\254\037\260Ek\323\216\272\n\327#\312\243\242)\002?\032\032U\242\232\244o"
+	.ascii	"\023\033\230\340`\005\3409@\200\b\004\210H\317\001\002\212\212"
+	.ascii	"\020`\242H\337D\021&AT\264\236 b\205z\302Hmb\221\002\006\325"
+	.ascii	"\b\251\204\017\034\205)\2508\312Q\215T\244\242\tF\265IUS\354"
+	.ascii	"\024\375h\275\022\221\212\020\304\"\023S\361\210\202\021H\367"
+	.ascii	"hD\002I\350\004\202a\n\037\021)nQ\212;\"\305-\022\336\021\302"
+	.ascii	"[\204tG\030\325ui(\302\316\321\250hd\221\264\203\264TT:\252F"
+	.ascii	"\245\024R\f\227\204!\254D\225I]Q4\241hd\221\344\201\251HT\221"
+	.ascii	"\214\216\210,\216F>*\232\226\214\324&\026\253\221\212\246%\f"
+	.string	",(\031\251hZ\37212\036\207>,(}`\004\t#\365\350\244\036\235\214\212\253NQ\321\b#\026\2242\2140R\241\242\270:\035\255*\212G\241\036\020\374\254F&\212XP2\"\016\231\214\224\216\326\"\321\210\310\002)\350J\307Te\032\256M\305b\004V5\311(\\{T\204p\002\204+\021uX/\200$T/\034\2150\244@$a\006\242\bHB\325\250Bq\351\230c\\O \212`T\327\3430IE\301\002NMLAD\021\324uhT\201\205\212\241Q]\301c\\O@\301\251\211\211\207(\302\252\036U#\220X\034\256B\243\223S\023\323\317:$\226\260\016\211\303 $\241j\314\302Ux\002I\250\242\260A5:\255B\243\332\304\244\256:MNF\243\272\022K\360ptZ\205+\212\2258\f\032\327\023\216\210N\"T\240hd1\202\206\243\321\n\365\204\272\n\221\232\234\322+\021\r\327\025T"
+	.ascii	"\030\325%$\242\220\204\341\272\202\n\264\022U\334\243\321\221"
+	.ascii	"\212\302\007\216\204)\226\226\204\027\206\353\nj\276\022\021"
+	.ascii	"\207\243\321\260\t\005\222\316j4\201\0222qx\002\361x\224\016"
+	.ascii	"\233\216x5R\217\206+\324\023G\247\024:G\247\024X]\022\036\035"
+	.ascii	"\321\325\310D\321J\034\002U\020\242\220S4\252\031(\032Y$i`\b"
+	.ascii	"'\200*\232\226\260j\304\303\002\t\020PW!\nE#\213$\235\325\210"
+	.ascii	"\203\2258t\002\036\233\212"
+	.string	"\306\023F\025i\270bx\302\251\211\311g\251Xl\200\021\032\\\215F\220X\211C'}\254\300\n\002\013$\241\212\202p\025\"\361\250F\304\244\341\222\320\250\207\2304\\\002\241hd\221\024\\\257D\344\324\304dT4\262H::\022\2068\032\325\025C#\222\005/6\251\306\020k\261h\f\241\243\032\241 \242\204\b\023NML@\304\342puZ*\036Uc\316\321(\203j\204\302\251\211I']\227\234\216*\n\304\342p=RW\365\204S\023\023\206\365h\244\356$\rU\020\213!\f\327\025\034\260\022Kpjb\3729\222\211\003\220\350\300DQ\007D?\357\240\203\020<T@\002#\350#\242\242\221ER\210\243\261x$\252\307\020\304\241\220)\304\221\361\030\202h\303\177 \223\374\345cC\013\030*K2\223g[\230#f)\\\\\215 bn\316IK\243\344\006Y\352\345\272\211r\346u\363\007#I\200J\222"
+	.string	"\307\202\310\275\221?\033*\f\221\2701\261\026n Q#\026\226\246y\032\263\302\207\003\016\233\233\317A\211\376\201H\332xZ\220r2u\344\254\247\210\336\035\224\021\263l\266\267\244\nX\216c\2312\224\2145\263\230\0306r\250\025\311p\314\370H\"\271\371\003Z\020 \021`\020\340\3271<]\201"
+	.ascii	"\263\373\233\363\333L\032 \200_\300!W\230\2549\033\002\364\332"
+	.ascii	"ue\236d-\347eniS\007\024\202\233\344%-\204,o>\007\"\372\007\002"
+	.ascii	"\351\223\322\322sssO\0326$J\212\217\224+gM\314\f[\227\017\255"
+	.ascii	"6_\2668\221<\031\023\303#\325Z\363{\263\342J\277\252\340tL\331"
+	.ascii	"a$\325"
+	.string	"\222\303\242f+\r\243\263\342\026DG\316b"
+	.string	"\277\"Z\031\013\320\256\216\212u\036\016\230u\326\334{\377\354\334\361Ea\273\371\034\200h\f\230@, \016 \026\032F\202\033\260\262\346\030\207\027\032\203&\220\t\274\0022\3210\fO\250\332\236\024\340i\fz"
+	.string	"k"
+	.string	"o"
+	.string	"k"
+	.string	"m\004\367r\210M\027\240\r,\304\353\314\305\216\233OA\024\375\003i`!7Z\270q\273\331\251\023\247\325F\303\nM\362l\325 \373Q\225\267_\2260R\313\264JO\2221Y\366\250\236_\274Q+\343\005(\003m\316Q\001i\0018\225\322U\311\n\223\022\003\343\345\370\302\202\001\003\235*\"a\210\271\331iFE\345\265\005\224\3129t\220I\223w\2633\003SL\0060\n\rk"
+	.ascii	"\232\030]@\027\371G\233\"n-rU\005\330\226\314\001\223)\032\273"
+	.ascii	"&\177A\234Ul\334\254\200O\251\225\032\036\0338@\344\226\234/"
+	.ascii	"TzM\340N\377\360\342\372\226\334\234\205r\234\260I\211\212s\237"
+	.ascii	">-\366\230\264\301I\337\240\325\265y\336\fW\267\303.u\303L\333"
+	.ascii	"\262e\225\266I\331\370x\3422\343f'\333\336"
+	.string	"{C\217\331Z\0300~YG\2261\271\276t\315\030?=$\220\233+\370\302\307\227\366\245O\216\224\305\345\304\250\"\227\366\335\211\331\025\271\371\024\004\321\026\214\201y*\006L\212\006\213\331\331H\264M\005\204\243#\223\363\333J&\b\2353\030g]\362\236\242y\2727\242\304\363\306\302\304<\335\234>\337\303\3342\345y\363S\275\364\314\037\3149\322\245&v\363)x\241\277\201F\263QUus\212\367\274\213$/\306\336\315\251\231Wa\216\361\373qW\307\343\013\324\315\351\230\224\214u\236.-s\247O\317\224\2506\272\233O\001\224\276=]Z\002{\2724\r\023\234\242\325\305u\363\201P\304\340h\276\321\026\310\330\262%\365b\3216U\232\226\026\346\347wu\200M\361\352\362\324\013\306\362@\f5YnN\3552\327\334\022\031;nN\271\330=`\232\031\034SnN\353t\034\031WI{\267\363\302\212\212\326\315\007"
+	.string	"\024\355\301\212\225\224\316\255\331\243L\373\022%\313S:\035:\270\270\0317\247X\216\260j\344\335\234^\311W\320\242<\001\220D\007\340.\225\222JI\253t\t\206\036\250\323!\303zh.\305(\016\246\020C\250f\206\266i\f\223\025@0HD$\022\013\327I=\023\200\204\rM49O\203N13#\"\"\"IAAI!\303\030\314hx\"\022t\252L\260\220c\301o\013\346\266\203"
+	.string	"\202Z\"2\034>\361BW4\031\3131\016<N\246\333\205gv\247\374[\247\236\253,$<\366\244E\232\225\335\204\375\260\261\216\232|t\004\246\177\016\242&&M\210\333\035_\214\276\330i\217\203)\340a\3571\331Lk\211\002\274 \204\345N\266Uj\374zq\004"
+	.ascii	"^\215\353\370\217//\225\357r\256\3265\3722\024\246\337$\202\213"
+	.ascii	"vW1|\274\205QV\347\236K\215\305\372:\251\270\267\036+\262\324"
+	.ascii	"i\2230"
+	.string	"\253T1\334A\350\b\036\225\030\302\264\317G&\002\325\356\033Bgt\347\f\311\0328\262\215\364\034;\365i\352`&v(\226\207\252\016\203\364\022\351\372\347q&&\017\347\364e\r\t\340\222\027\326\355P\207\205\212\006\270hG\200#\024\252\022\336\356\001\226\3521\223\335\336\267\226\235]\016-v>\032v\202l\367\354\336\355\200\017\303\360\277\013<\037\205\345\023\3651\207N4%\314\331\035\302V\302,\177\200}\024\244Fv\3416\256{\0131z;\022$v\300@\312\024\305 {c\242\324\267\267I\351\363\324\237\t%\375\233T[\260\257R7\n=\305H\246\024\316\336\313'\t\242x\370j\221\372\341\364i/\205P\354!\232\222\322\246,\225\377\252\326@\316\316a\203K\004'\026\344\013q\334\375Y\236\251\020=1\272z\214\2746\373\037\031\273\002\365\250\001r!\nF\354]\343D)\25204\032\n\210\314\372\bU"
+	.ascii	"\335x\270\213{; \225\016\225\032\2540!\201\253/t\222~\350\307"
+	.ascii	"\341\236D\264)\310\303wot\031\t0[F\244\304)G\021\221\3735'`@"
+	.ascii	"\2721/\0060\256f,l\007L\377\035\2448\311R\030\212d\370B\343\234"
+	.ascii	"\365\327\004)\305\252N\263\271V\002|\360\332G\3530#Qa[\203\231"
+	.ascii	"-\035\250p\220\216m\237EF\256\203\235\335M\024j..\262JQ*\264"
+	.ascii	"\220$\266\352\n\226\360\242geU\024\300\355\241\331\245\230\021"
+	.ascii	"~E\376\313\313,Z\310\325!\345\205\035\272\317Wk\372\017\316\215"
+	.ascii	"/>9\303F\310\322\373hj*E\031\354\026\250\017\226\231\246H\t\217"
+	.ascii	"\001>UE\227\221\2476O]\006\200(\001\224\345\322\032{\242\016"
+	.ascii	"\242\240\342\275\017\200w\201p\201\037[\374\371\277\032lE\254"
+	.ascii	"\271\201\034=6#\210\201\203\324*\036$2\005\341\372N\314\213\033"
+	.ascii	"\220\fc\305\346:\371\240\207\376\346\b\363\031pO\031F\364\026"
+	.ascii	"\336D5\315\326\224.\367\330BVy)q\221\340\343\0016=\003f\3137"
+	.ascii	"k\027\346\301gH\201N\317\325\302cwO\205j\376|\036U\263\372n\343"
+	.ascii	"\237z\006\246\030j\003\f\3707\r\316\344\030\365\244\272\334\272"
+	.ascii	"HPW]\310\306-7>\265/\301\255\222&\342\245\017\023|`*/l\264\353"
+	.ascii	"!f\t\177\261\351\345\261\034e\355\342\276\251\210S\207\"j\350"
+	.ascii	"v^\215\325\201\373\325\224\342\246\206%\324N\030\201\234|H\257"
+	.ascii	"\237Q\343\304\035\236\274~i\305a=\261\375\213\004\032\241.\335"
+	.ascii	"5\352!b\332\316\037\363\357\232E\032\313\370\027\334gv\251\312"
+	.ascii	"\345\356Ph-\ns|V\321\247w\223?\355Obz\002\215\352\261\352=\376"
+	.ascii	"\325f\034\261\302a\021W\310\030\0270x(\374\214\344\364\235\352"
+	.ascii	"\313\346\232\313\"]2\242\225\327\253\t\026\bM\307\310s\004\037"
+	.ascii	"\\a\275\037W\233\314L\030+\026\007f/\205\363\317]\250U\330\241"
+	.ascii	"@\312y\\`#\272\324\237h\352\322r\363\r\204\bW\314)\032]N\313"
+	.ascii	"\216\375\204\350Y\322\235k\032\307\036\343\366\233\027\234\231"
+	.ascii	"esr\262\264\355\302\363\352\350\356\245\262\313\tI\374s\303\177"
+	.ascii	"\257K\336\224\217\307\304kJ I\3519\331O\274\252\263\365P%\246"
+	.ascii	"q<6\251\363\370\355\0362\253\036\037+\374\261\351\240x\2216\233"
+	.ascii	";ltRm\377\017\332\034\334W)\246#l\225\035\006\223\bW\005\312"
+	.ascii	"\261\232\330\n\323\276\316\3722-\220\357\261\234\034\333\033"
+	.ascii	"RD\007a\314\265-\264\021\214\034+.\324,x\313J!\207\021\"\245"
+	.ascii	"\372q'\233i&0\003\025\211\207}\344\2505yF\257%\034\325\257)\260"
+	.ascii	"\303\363\2720\316d@|\002\237\365\370\007a\374\337\215 \037.{"
+	.ascii	"\267\343`\203\234|\271\245&{O[\355\324#<\324\325\030\212\314"
+	.ascii	"\005>Vr\255\303P;O\320\006\32194\305-\320@\375\313F\273\264\220"
+	.ascii	"\333\346\001\264\276G\261\"\260\232<\241\326\372\n\300\352\005"
+	.ascii	"\300\322\340\301\326\3336\006s\r0R\375\"0\260bh\0026\274\177"
+	.ascii	"\354\030\3229krr\274A\314\353\354d\367\351\344>\326\037\336\211"
+	.ascii	"\212\224\371p\327S\234\004\231\242\270\262\262CX\372Jd\314\347"
+	.ascii	"J/<\303\253\\<Ouq\331\327j\351\200\301]\274\303^\345\022\023"
+	.ascii	"H\244\003p\357?\264-\265\023+P\226\331m<\334\225N\030\366t\245"
+	.ascii	"\335 \333\340\240\302\200,\n\224\022\261\224"
+	.string	"\325m\351\t\303\207\212\240\362&'\242y~.\323\244\251\024\240!\340[\321\243\251\210\365d\330\033\352\304\004B\211ZS<6\013E-\305\201\361efbV\334\334\005\310\302On\362\313\033\245\262\254yj1\347\242\005s2\036\343\001\241\205\024\277\225\023\020(\037\2667\245P\255*Q\037D\032\273\270\264\331(\344\325MJQp\324\215\326\272\r\200B\003\334\340\3176$\016\244lk\373x\f\025>RY\270K\215\360\2002\250"
+	.string	"\274\213\222q0R\003bz\267\361\206C\035\300\005\r\005\310Ca\221_\031\210\376\230\3522j\350\372\f\354\352C\244L\004\202F\2611\365\\g\037\272\\\330\342\2140\016[r\312\233)G\216\364%P\210V\221\255\026\355.\346\"\351T\305\247I*\322\026\337\305\357\205\315f'##7Q\305\312M\361]\24752z\212\214@\237\222b\242P\206{\023\253l\3439P:\334\007\234\264\220\346\263G1\016}\033\2577B\313(!L\325\b>R\257\"\302\263\321\361\004\207\322\212&&p"
+	.ascii	"v\024\322?V\270\376\374%\272;\211"
+	.string	"\024\332\337\213\200\342y{\235\036F#\221\247d\0073W\302\256\335n!x\360\375\202\371\007m\005\t\020\370\013n\263Qm\275\002Pq\214 xa/r\306O\215\022\270\237\nb\365\354p\332hIZ\305\007%q\345'\022S\324\341\225\240\304\314\371\310\203d\335\335\216d=\271\304\225\246Af\223\022\202\357\232\327\360f\036{\245/v\320\f\235\250l\024\202\340\375D\332tx\f|,\220`\215L$%\277\tV\0259z]\273Q\367\342\030\317\033\261\225\352lgg\304x-=\207\\\177\316\0239\355\f\226\024\212=B\202\361PY~x\034\b\217\307 \037n\230\016\002\025\364x\2232C,\257\374m\214\327\005\371o\205m\303\255\374\321\234\340\223\321\317\3614L\232\333r>\177}6\210]\306D\201#NC&M\030\261\362\266\\*\231\307\212\007K\fP|\343K\307\370_\374\001\224u\370\345\374\200W\332"
+	.string	"n\200\227h\214\263\025D\302\037\377\033\271\231p/\337m#8\033\355cg\252<\334\245\210\215\"\022\0035\333\021\256)\300aL\346\324\316\374\221\324\242\261|D\341(\301\035\023\fDk\276\311\212\030:\244\301\213\b"
+	.string	"\367\005\221\004~\342\320}\202x\231\202\221\017\272\tt\016>"
+	.string	"D\265\304\246\315\002\016\"\343\221\225\323\315\232\247*E9<N\211\315:\342w"
+	.ascii	"\332\206GMT\007T"
+	.string	"\236q\331\227\025\306\247\314g\333Q\016\023uh\355g\036\251\333Os\224P\315\271\b\252\320\243\374\200hj\273(\235\224\247\031\347G\326\230\355+\270\200\245\003v'N\212\240\020\310\244\347\316\351\207\373-\364*bj\335\275B\360\330:\336\036\224u\300\235A\013\202v\336\334|t\036&\3706\243\323MDMG\230\330\277@\250\310Qs\217\316\216XA\351#z]\327\210\264\022A\324;c\335\253PbH\355\315d\"\034d[\177\231\001B\201\330Y>Y=w\211\311\243X\375\035\371\276w3\264\214\231b\326u\374\270u\260K\326\325\276z<\301\307\366\215\277s\276\343\301\246\316O\270\233\344\017\327\334\332!\230\364\002^\277\001\026\333|\346\255n}\326\235\260\211\366\271\334`\202\252\265bj%\323\234;\322\265\276 B\257:MS\253<\266\211J\213\307W\233\234\266\255\317\030R\300\265\nQ`\216$\274G\270"
+	.string	"\277\202\372\307\306I\264\346\177\201\241\313\037\371\355\335\264&$lvv'\275y\377\037\370\221\320\003S\354\251|CR\216\331Ub\342E\201H$A\"K9\026\323/9\3452\267\233\rU\221d\202\201\f\370\225\025\275Y\021e\217\016l!\345\023\324\212\"@)I\362'\271`\314\247\\\3410\377X\356\356\212\230+?\371\323\002\221\t%\236\232\242\230x\355\037r\031\216\005\370\021\023\337xp\277\302/\007M\362\240Q8T3C\243R\030T\312ji\n\342\2009\214w\250\306\2555\344\362Ao@2\266f:\006\225\360\304\237$\020\266'\242eS\322k\b\316\223\305\307#-\025\257\364g\026~\0336"
+	.ascii	"\033\260J\331"
+	.string	"\340\244tz\311\004'\360\315\215\306\241$\312\330\361\b\366\314\345sB\361\304\022\325\223\361P\b\207\221F\333c\364\360\246\364\241\024\214t\234\360.\001\2671\305\251\353\217\244\371\024\327\342\341@d\b\233\204\222\201fgF\336\257\242\320\t\225\321\017\311Lv\336\342\363\230/\256\316i\204m\254\352\r\210Pm\350\345@A\252\006\020\002\275\303\362\366]C\244\375[\361nf\304\377B;\024Ra\345\332#\200\310\267\035\326\237\007\367o\343\360\024<\f\212\341 j\016\006#\020?\364\262Y\317\345\325\205\313\225\246{u\262\353L\336\234\346\007\r\017W\365\332\274\302\024\027\035<]\231>\341\314\300\357\025\200\220>t\022\0203\002\350\247D\037\320h\300\276\227b\025\252e\261\tT\262\013?G\366\034L\223l\203\\j\361\"y8\202\277k\327\364\355\032\t\272nw\272\225|X`\0376\332\364h\224\nM q\327\317\203"
+	.string	"\222S\nfb\340r\022\331\336j\277\315\257\305d\360`C\364UW\265(\230\266\001\344$\354\211D\\\235\375\250\3521Y6b\321\305\322s\377\375\235\215G\030\347;0\374\006g\237\237[\205\323v`\366[\302\313\2242\203\306K\345\007\347]\233z\367\240u9\036j\r\226`\227\026\035\"\374\354@\362\207\367\363B\202wv\3660c%<\3534\367\034&\0270\242\335\356o\253\344\231\224\214\037c\203\342\353\205\357#\343\271\363\2165\022\372\340\325\327o\003\375\366R\375\274\034_\f\331}z\330\242\245m\270\371\354>\237.\231WtGM?\347\306\263"
+	.ascii	"\373\020\266\033\274\334\212\335|,#\347\302E\313>\345\340\337"
+	.ascii	"\025qe\227\342\003\031\375F\353\361&\316\207Z\257\270&\376v\212"
+	.ascii	"ihQ\237\327[\263\027V\037\344\357/~=`wm6\037b\331\267h\340\305"
+	.ascii	"\020J<\356\221\373\360v\216\326\357\004\236t\231\206\020\347"
+	.ascii	"\242\356,\032}\222\371L\235<D\3443\321\2719\3435\317V<X\006o"
+	.ascii	"\266\234%\256\r\244{\205\224/)\272\035;b\322\005\3311\334m_\215"
+	.ascii	"\370\017~O\234\347\2126\356*\350\374`+,\315\202\344\221\313\247"
+	.ascii	";x\024]\320^=\357\336\237W\225\271\317x\221x\377\372\r\222\277"
+	.ascii	"\234\3379\210|+\350)T\033\261}\303\035>\023gN{\200\302#\264\266"
+	.ascii	"\201\231\243?\322\017\345\377K\364\033\330\241\263\036\016u\256"
+	.ascii	"\022{\324a\214\347\257\032\037(9\234t7\354\313?\232\346X\355"
+	.ascii	"\250\356\201\2307\213\216\2600\337Y\017]p\366\341\033iH\3249"
+	.ascii	"eB/+\213\375vF\337\025"
+	.text
+	.section	.gnu.lto_.symtab.20ab49ad1462ba59,"e",@progbits
+	.string	"gyro"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"gyroSensorBus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"gyroMpuConfiguration"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\002"
+	.string	""
+	.string	"gyroMpuDetectionResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"gyroInitFilterLpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"gyroInitFilterNotch1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"gyroInitFilterNotch2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"gyroInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"isGyroCalibrationComplete"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"gyroSetCalibrationCycles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"gyroSetIsrCallback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"gyroIsrHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"gyroIsrRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"gyroIsrUpdateActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"gyroDataReadyAtUs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"gyroReadTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"gyroGetTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"gyroRateDps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"pgResetTemplate_gyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"gyroConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"firFilterDenoise3Update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"biquadFilter3Apply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"nullFilter3Apply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"pt1Filter3Apply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"schedulerResetTaskStatistics"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"firFilterDenoiseInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"biquadFilter3Init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"alignSensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"pt1Filter3Init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"biquadFilter3InitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"gyroSetSampleRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.20ab49ad1462ba59,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
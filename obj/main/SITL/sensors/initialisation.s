@@ -0,0 +1,10927 @@
+	.file	"initialisation.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/resource.h"
+	.file 5 "./src/main/sensors/sensors.h"
+	.file 6 "./src/main/sensors/acceleration.h"
+	.file 7 "./src/main/drivers/barometer.h"
+	.file 8 "./src/main/sensors/barometer.h"
+	.file 9 "./src/main/sensors/gyro.h"
+	.file 10 "./src/main/sensors/compass.h"
+	.file 11 "./src/main/sensors/initialisation.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	initialisation.c.0f7e5ebd
+	.weak	initialisation.c.0f7e5ebd
+initialisation.c.0f7e5ebd:
+	.long	0x58b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xe
+	.long	.LASF1752
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1606
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1607
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1608
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1609
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1610
+	.uleb128 0x3
+	.long	.LASF1612
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1611
+	.uleb128 0x3
+	.long	.LASF1613
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1614
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1615
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1616
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1617
+	.uleb128 0x3
+	.long	.LASF1618
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1619
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1620
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x3
+	.long	.LASF1621
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1622
+	.uleb128 0x10
+	.uleb128 0x6
+	.long	0xc8
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x4
+	.byte	0x14
+	.long	0x1f4
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1662
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x5
+	.byte	0x14
+	.long	0x21e
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1671
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	0x9d
+	.long	0x22e
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1716
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x10
+	.long	0x21e
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1675
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x6
+	.byte	0x19
+	.long	0x2ad
+	.uleb128 0x1
+	.long	.LASF1676
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1677
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1678
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1679
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1680
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1683
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1684
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1685
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1686
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1687
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1692
+	.byte	0x7
+	.byte	0x14
+	.byte	0x10
+	.long	0xc9
+	.uleb128 0x3
+	.long	.LASF1693
+	.byte	0x7
+	.byte	0x15
+	.byte	0x10
+	.long	0x2c5
+	.uleb128 0x6
+	.long	0x2ca
+	.uleb128 0x11
+	.long	0x2da
+	.uleb128 0x7
+	.long	0x2da
+	.uleb128 0x7
+	.long	0x2da
+	.byte	0
+	.uleb128 0x6
+	.long	0x91
+	.uleb128 0x9
+	.long	.LASF1708
+	.byte	0x30
+	.byte	0x7
+	.byte	0x17
+	.long	0x347
+	.uleb128 0x2
+	.long	.LASF1694
+	.byte	0x7
+	.byte	0x18
+	.byte	0xe
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1695
+	.byte	0x7
+	.byte	0x19
+	.byte	0xe
+	.long	0xa9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0x7
+	.byte	0x1a
+	.byte	0x13
+	.long	0x2ad
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1697
+	.byte	0x7
+	.byte	0x1b
+	.byte	0x13
+	.long	0x2ad
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1698
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x13
+	.long	0x2ad
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1699
+	.byte	0x7
+	.byte	0x1d
+	.byte	0x13
+	.long	0x2ad
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1700
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x2b9
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1701
+	.byte	0x7
+	.byte	0x1f
+	.byte	0x3
+	.long	0x2df
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x8
+	.byte	0x17
+	.long	0x37d
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1707
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x3
+	.long	0x353
+	.uleb128 0x9
+	.long	.LASF1709
+	.byte	0x10
+	.byte	0x8
+	.byte	0x21
+	.long	0x3d7
+	.uleb128 0x2
+	.long	.LASF1710
+	.byte	0x8
+	.byte	0x22
+	.byte	0xd
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1711
+	.byte	0x8
+	.byte	0x23
+	.byte	0xd
+	.long	0x9d
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1712
+	.byte	0x8
+	.byte	0x24
+	.byte	0xb
+	.long	0x23a
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1713
+	.byte	0x8
+	.byte	0x25
+	.byte	0xb
+	.long	0x23a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1714
+	.byte	0x8
+	.byte	0x26
+	.byte	0xb
+	.long	0x23a
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1715
+	.byte	0x8
+	.byte	0x27
+	.byte	0x3
+	.long	0x389
+	.uleb128 0x12
+	.long	0x3d7
+	.uleb128 0x8
+	.long	.LASF1717
+	.byte	0x8
+	.byte	0x29
+	.byte	0x1a
+	.long	0x3d7
+	.uleb128 0x9
+	.long	.LASF1718
+	.byte	0x38
+	.byte	0x8
+	.byte	0x2b
+	.long	0x428
+	.uleb128 0x13
+	.string	"dev"
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xf
+	.long	0x347
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1719
+	.byte	0x8
+	.byte	0x2d
+	.byte	0xd
+	.long	0x91
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1720
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xd
+	.long	0x91
+	.byte	0x34
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1721
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x3
+	.long	0x3f4
+	.uleb128 0x8
+	.long	.LASF1722
+	.byte	0x8
+	.byte	0x31
+	.byte	0xf
+	.long	0x428
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x9
+	.byte	0x1a
+	.long	0x4a6
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0xe
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1738
+	.byte	0x10
+	.byte	0x9
+	.byte	0x2c
+	.long	0x4cd
+	.uleb128 0x2
+	.long	.LASF1739
+	.byte	0x9
+	.byte	0x2d
+	.byte	0xe
+	.long	0xb5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1740
+	.byte	0x9
+	.byte	0x2e
+	.byte	0xb
+	.long	0x4cd
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	0x23a
+	.long	0x4dd
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1741
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x3
+	.long	0x4a6
+	.uleb128 0x8
+	.long	.LASF1742
+	.byte	0x9
+	.byte	0x31
+	.byte	0xf
+	.long	0x4dd
+	.uleb128 0x5
+	.long	0x30
+	.byte	0xa
+	.byte	0x1b
+	.long	0x51f
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x4
+	.byte	0
+	.uleb128 0x14
+	.long	0x22e
+	.byte	0xb
+	.byte	0x29
+	.byte	0x9
+	.uleb128 0xc
+	.long	.LASF1748
+	.byte	0x8
+	.byte	0x33
+	.long	0xc1
+	.long	0x541
+	.uleb128 0x7
+	.long	0x541
+	.uleb128 0x7
+	.long	0x37d
+	.byte	0
+	.uleb128 0x6
+	.long	0x347
+	.uleb128 0xd
+	.long	.LASF1750
+	.byte	0xa
+	.byte	0x35
+	.long	0xc1
+	.uleb128 0xc
+	.long	.LASF1749
+	.byte	0x6
+	.byte	0x4a
+	.long	0xc1
+	.long	0x566
+	.uleb128 0x7
+	.long	0xb5
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1751
+	.byte	0x9
+	.byte	0x48
+	.long	0xc1
+	.uleb128 0x15
+	.long	.LASF1753
+	.byte	0xb
+	.byte	0x39
+	.byte	0x5
+	.long	0xc1
+	.uleb128 0x16
+	.long	.LASF1754
+	.byte	0x8
+	.byte	0x29
+	.byte	0x59
+	.long	0x589
+	.uleb128 0x6
+	.long	0x3e3
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 28 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 32 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 33 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.file 34 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 35 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 36 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x24
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.file 37 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 38 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x26
+	.file 39 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.file 40 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.file 41 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 42 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2a
+	.file 43 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2b
+	.file 44 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 45 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2d
+	.byte	0x4
+	.file 46 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 47 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2f
+	.byte	0x4
+	.file 48 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x30
+	.file 49 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 50 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 51 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1473
+	.byte	0x4
+	.file 52 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 53 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1477
+	.byte	0x4
+	.file 54 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x6
+	.file 55 "./src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x37
+	.file 56 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 57 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x39
+	.byte	0x4
+	.file 58 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3a
+	.byte	0x4
+	.file 59 "./src/main/drivers/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1593
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1594
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x9
+	.file 60 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1595
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xa
+	.byte	0x4
+	.file 61 "./src/main/sensors/sonar.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x3d
+	.file 62 "./src/main/drivers/sonar_hcsr04.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 63 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3f
+	.file 64 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1600
+	.byte	0x4
+	.file 65 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x41
+	.file 66 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x4
+	.file 67 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x43
+	.file 68 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1605
+	.byte	0x4
+	.file 69 "./src/main/sensors/initialisation.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF973
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF996
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1078
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1080
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1082
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1084
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1092
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1104
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1472
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1476
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1486
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1489
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1493
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1592
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sonar_hcsr04.h.34.a3a591e65a09ae2f5ea3c546e26119da,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1599
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1604
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1755
+	.long	.LASF1756
+	.long	.LASF1757
+	.long	.LASF1758
+	.long	.LASF1759
+	.long	.LASF1760
+	.long	.LASF1761
+	.long	.LASF1762
+	.long	.LASF1763
+	.long	.LASF1764
+	.long	.LASF1765
+	.long	.LASF1766
+	.long	.LASF1767
+	.long	.LASF1768
+	.long	.LASF1769
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x46
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1770
+	.byte	0xb
+	.long	.LASF1771
+	.byte	0xb
+	.long	.LASF1772
+	.byte	0xb
+	.long	.LASF1773
+	.byte	0x4
+	.long	.LASF1774
+	.byte	0x6
+	.long	.LASF1775
+	.byte	0x6
+	.long	.LASF1776
+	.byte	0x4
+	.long	.LASF1776
+	.byte	0x6
+	.long	.LASF1777
+	.byte	0x6
+	.long	.LASF1778
+	.byte	0x6
+	.long	.LASF1779
+	.byte	0x6
+	.long	.LASF1780
+	.byte	0xe
+	.long	.LASF1781
+	.byte	0xf
+	.long	.LASF1782
+	.byte	0xf
+	.long	.LASF1782
+	.byte	0xe
+	.long	.LASF1783
+	.byte	0xb
+	.long	.LASF1784
+	.byte	0xe
+	.long	.LASF1785
+	.byte	0xe
+	.long	.LASF1786
+	.byte	0xb
+	.long	.LASF1787
+	.byte	0xb
+	.long	.LASF1788
+	.byte	0xd
+	.long	.LASF1789
+	.byte	0xb
+	.long	.LASF1790
+	.byte	0xc
+	.long	.LASF1791
+	.byte	0xc
+	.long	.LASF1792
+	.byte	0xb
+	.long	.LASF1793
+	.byte	0xb
+	.long	.LASF1794
+	.byte	0xb
+	.long	.LASF1795
+	.byte	0xe
+	.long	.LASF1796
+	.byte	0xf
+	.long	.LASF1797
+	.byte	0xa
+	.long	.LASF1798
+	.byte	0xa
+	.long	.LASF1799
+	.byte	0xe
+	.long	.LASF1800
+	.byte	0x9
+	.long	.LASF1801
+	.byte	0x8
+	.long	.LASF1802
+	.byte	0x7
+	.long	.LASF1803
+	.byte	0x8
+	.long	.LASF1804
+	.byte	0x2
+	.long	.LASF1805
+	.byte	0x3
+	.long	.LASF1806
+	.byte	0x3
+	.long	.LASF1807
+	.byte	0x1
+	.long	.LASF1808
+	.byte	0x3
+	.long	.LASF1809
+	.byte	0x5
+	.long	.LASF1810
+	.byte	0x4
+	.long	.LASF1811
+	.byte	0x4
+	.long	.LASF1812
+	.byte	0x4
+	.long	.LASF1813
+	.byte	0x4
+	.long	.LASF1814
+	.byte	0x4
+	.long	.LASF1815
+	.byte	0x4
+	.long	.LASF1816
+	.byte	0x4
+	.long	.LASF1817
+	.byte	0x4
+	.long	.LASF1818
+	.byte	0x4
+	.long	.LASF1819
+	.byte	0x4
+	.long	.LASF1820
+	.byte	0x4
+	.long	.LASF1821
+	.byte	0x5
+	.long	.LASF1822
+	.byte	0x4
+	.long	.LASF1823
+	.byte	0x2
+	.long	.LASF1824
+	.byte	0x4
+	.long	.LASF1825
+	.byte	0x4
+	.long	.LASF1826
+	.byte	0x4
+	.long	.LASF1827
+	.byte	0x2
+	.long	.LASF1828
+	.byte	0x6
+	.long	.LASF1829
+	.byte	0x4
+	.long	.LASF1830
+	.byte	0x6
+	.long	.LASF1831
+	.byte	0x2
+	.long	.LASF1832
+	.byte	0x6
+	.long	.LASF1833
+	.byte	0x6
+	.long	.LASF1834
+	.byte	0x6
+	.long	.LASF1835
+	.byte	0x6
+	.long	.LASF1836
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1744:
+	.string	"MAG_NONE"
+.LASF1464:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1590:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1100:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1126:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF801:
+	.string	"USE_CLI "
+.LASF1220:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1718:
+	.string	"baro_s"
+.LASF1721:
+	.string	"baro_t"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_PPM"
+.LASF1238:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1468:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1367:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF974:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1106:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1612:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF975:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1622:
+	.string	"_Bool"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1085:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1631:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1455:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1089:
+	.string	"IOCFG_AF_OD 0"
+.LASF1589:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF980:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1157:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1107:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1391:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1337:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF996:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1530:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1481:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1096:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF1460:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1716:
+	.string	"detectedSensors"
+.LASF1034:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1696:
+	.string	"start_ut"
+.LASF1432:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1170:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1575:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1378:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1628:
+	.string	"OWNER_LED"
+.LASF1754:
+	.string	"barometerConfig"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1467:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1737:
+	.string	"GYRO_FAKE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1620:
+	.string	"uint16_t"
+.LASF1160:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1470:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1019:
+	.string	"PG_RX_CONFIG 24"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1399:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF986:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1366:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1124:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1749:
+	.string	"accInit"
+.LASF1167:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1093:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF1405:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1563:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1280:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1500:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1030:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1246:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1233:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1592:
+	.string	"GYRO_LPF_NONE 7"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF963:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1316:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF984:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1705:
+	.string	"BARO_MS5611"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1119:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1423:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1149:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1283:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1038:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1713:
+	.string	"baro_cf_vel"
+.LASF1538:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1387:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1459:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1635:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1726:
+	.string	"GYRO_L3G4200D"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1127:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1092:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF977:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF960:
+	.string	"BIT(x) (1 << (x))"
+.LASF1660:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1081:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF979:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1135:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1618:
+	.string	"int32_t"
+.LASF994:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1286:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF883:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1748:
+	.string	"baroDetect"
+.LASF1556:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1548:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF1435:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1381:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1098:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1202:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1480:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1657:
+	.string	"OWNER_BARO_EXTI"
+.LASF1015:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1717:
+	.string	"barometerConfig_System"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1598:
+	.string	"HCSR04_DETECTION_CONE_DECIDEGREES 300"
+.LASF546:
+	.string	"__always_inline"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF898:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1634:
+	.string	"OWNER_SERIAL_TX"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF955:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1035:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1048:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1049:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1205:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1740:
+	.string	"gyroADCf"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1198:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1321:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1577:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1175:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1534:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1361:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1434:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1734:
+	.string	"GYRO_ICM20608G"
+.LASF1166:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1066:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF1669:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1278:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1497:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF990:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1678:
+	.string	"ACC_ADXL345"
+.LASF1586:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1343:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1150:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1639:
+	.string	"OWNER_SONAR_ECHO"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1384:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF1330:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1027:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1070:
+	.string	"PG_VTX_CONFIG 515"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1627:
+	.string	"OWNER_SERVO"
+.LASF1197:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF881:
+	.string	"ACC "
+.LASF1504:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF803:
+	.string	"USE_PWM "
+.LASF1414:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF1582:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF1584:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF1477:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1482:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1210:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1517:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF976:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1452:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1747:
+	.string	"MAG_AK8963"
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1133:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1200:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1613:
+	.string	"__uint16_t"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1626:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1217:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1494:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF1571:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1654:
+	.string	"OWNER_RX_SPI_CS"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1250:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1554:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF1192:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1105:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF1746:
+	.string	"MAG_AK8975"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1728:
+	.string	"GYRO_L3GD20"
+.LASF1136:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1427:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1574:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1730:
+	.string	"GYRO_MPU6500"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1490:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1253:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF953:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1258:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1445:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF1606:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1077:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1080:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF978:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1054:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1447:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1318:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1028:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1333:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1011:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1058:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1599:
+	.string	"HCSR04_DETECTION_CONE_EXTENDED_DECIDEGREES 450"
+.LASF1675:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1006:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF982:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1424:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1406:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1222:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF879:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1597:
+	.string	"HCSR04_MAX_RANGE_CM 400"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1267:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1082:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF1525:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1174:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF968:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1142:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1518:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1491:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1179:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1501:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF1164:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1666:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1409:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1483:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1558:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1240:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1603:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1245:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1334:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1324:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1313:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1648:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1533:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF1430:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1376:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1219:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1091:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1295:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1211:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1129:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1181:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1567:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1450:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1336:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1379:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1033:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1462:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1390:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1684:
+	.string	"ACC_MPU6500"
+.LASF1043:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1068:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1587:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1116:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1512:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1421:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1184:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1207:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1753:
+	.string	"sensorsAutodetect"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1496:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1659:
+	.string	"OWNER_USB_DETECT"
+.LASF1301:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1087:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1084:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1537:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1672:
+	.string	"SENSOR_INDEX_BARO"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1053:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF973:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1508:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1559:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1270:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1719:
+	.string	"BaroAlt"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1454:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1503:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1139:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1658:
+	.string	"OWNER_USB"
+.LASF1663:
+	.string	"OWNER_INVERTER"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1279:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1643:
+	.string	"OWNER_SPI_MOSI"
+.LASF1433:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1619:
+	.string	"uint8_t"
+.LASF1178:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1605:
+	.string	"SONAR_OUT_OF_RANGE (-1)"
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF1282:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF957:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1673:
+	.string	"SENSOR_INDEX_MAG"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF1047:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1535:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1285:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1079:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1686:
+	.string	"ACC_ICM20601"
+.LASF1687:
+	.string	"ACC_ICM20602"
+.LASF1536:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1044:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1075:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1372:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1291:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1177:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1426:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF822:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1479:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1099:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1625:
+	.string	"OWNER_PPMINPUT"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF1550:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF959:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1736:
+	.string	"GYRO_BMI160"
+.LASF1201:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF1389:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1130:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1229:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1720:
+	.string	"baroTemperature"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1013:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1489:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1572:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1045:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF1021:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF995:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF985:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1145:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1699:
+	.string	"get_up"
+.LASF1697:
+	.string	"get_ut"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1168:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1214:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1693:
+	.string	"baroCalculateFuncPtr"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF1382:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1328:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF1363:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1745:
+	.string	"MAG_HMC5883"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1408:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1148:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1591:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1274:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1739:
+	.string	"targetLooptime"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1103:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1690:
+	.string	"ACC_BMI160"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1498:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1067:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1411:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1638:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1264:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1348:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1255:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1509:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1151:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1294:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1588:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1273:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1456:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1640:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF983:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF499:
+	.string	"__PMT"
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1680:
+	.string	"ACC_MMA8452"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1101:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1300:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1623:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1486:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1265:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1731:
+	.string	"GYRO_MPU9250"
+.LASF1003:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1306:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1140:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1492:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1562:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1600:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF1147:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1249:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF971:
+	.string	"UNIT_TESTED "
+.LASF1002:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1331:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF1560:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1110:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1310:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1752:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF981:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1143:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1131:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1277:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1109:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1420:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1527:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1689:
+	.string	"ACC_ICM20689"
+.LASF1193:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1351:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1488:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF1552:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF1671:
+	.string	"SENSOR_INDEX_ACC"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF997:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1393:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1146:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1141:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF802:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1122:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1570:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1231:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1196:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF1183:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1004:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF950:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1646:
+	.string	"OWNER_SDCARD"
+.LASF1742:
+	.string	"gyro"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1544:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1712:
+	.string	"baro_noise_lpf"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1451:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1583:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1298:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1607:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1610:
+	.string	"signed char"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1199:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1162:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1448:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF1272:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1012:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1041:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1051:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1357:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1276:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1478:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1685:
+	.string	"ACC_MPU9250"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1375:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1727:
+	.string	"GYRO_MPU3050"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1108:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF962:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1113:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1519:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1020:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1402:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1621:
+	.string	"uint32_t"
+.LASF1354:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1668:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1024:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF1074:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1661:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1449:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1156:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1415:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1029:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1083:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1549:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1526:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1062:
+	.string	"PG_PPM_CONFIG 507"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1516:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1117:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1484:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1154:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1191:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1097:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1499:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF1132:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF965:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1261:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1026:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1700:
+	.string	"calculate"
+.LASF1711:
+	.string	"baro_sample_count"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1123:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1241:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF929:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1593:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1688:
+	.string	"ACC_ICM20608G"
+.LASF991:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF821:
+	.string	"GPS "
+.LASF1594:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1309:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF1165:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1194:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1104:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1023:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1397:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1616:
+	.string	"long int"
+.LASF1226:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1016:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1704:
+	.string	"BARO_BMP085"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1244:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1636:
+	.string	"OWNER_PINDEBUG"
+.LASF1171:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1438:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF1243:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1271:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1692:
+	.string	"baroOpFuncPtr"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1520:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF956:
+	.string	"EXPAND_I(x) x"
+.LASF1247:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1204:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1581:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF1691:
+	.string	"ACC_FAKE"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1042:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF1732:
+	.string	"GYRO_ICM20601"
+.LASF1733:
+	.string	"GYRO_ICM20602"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1059:
+	.string	"PG_PID_CONFIG 504"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF522:
+	.string	"__flexarr []"
+.LASF813:
+	.string	"LED_STRIP "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF972:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1039:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF993:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF999:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1187:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1069:
+	.string	"PG_VCD_CONFIG 514"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1236:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1262:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1637:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1040:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1370:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1400:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1346:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF1114:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1617:
+	.string	"char"
+.LASF1743:
+	.string	"MAG_DEFAULT"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1180:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1327:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1088:
+	.string	"IOCFG_AF_PP 0"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1510:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF1307:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF1007:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1751:
+	.string	"gyroInit"
+.LASF888:
+	.string	"USE_UART2 "
+.LASF1714:
+	.string	"baro_cf_alt"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1515:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1078:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF998:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1315:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF952:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1289:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1551:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1528:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF1463:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1681:
+	.string	"ACC_BMA280"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1595:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1158:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1032:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1750:
+	.string	"compassInit"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1292:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF1471:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1649:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF954:
+	.string	"STR_HELPER(x) #x"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1037:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1641:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1208:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1076:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1633:
+	.string	"OWNER_ADC_RSSI"
+.LASF969:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1369:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1485:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1186:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1710:
+	.string	"baro_hardware"
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF992:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1161:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1487:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF1709:
+	.string	"barometerConfig_s"
+.LASF1715:
+	.string	"barometerConfig_t"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1061:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1349:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1555:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1312:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1228:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1073:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1502:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1444:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF1128:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1729:
+	.string	"GYRO_MPU6000"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1466:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF1172:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1050:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF987:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1694:
+	.string	"ut_delay"
+.LASF1284:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1052:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF988:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1060:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1360:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1216:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1522:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1072:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1542:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1644:
+	.string	"OWNER_I2C_SCL"
+.LASF1642:
+	.string	"OWNER_SPI_MISO"
+.LASF1121:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1667:
+	.string	"OWNER_COMPASS_CS"
+.LASF964:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1144:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1394:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1225:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1507:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1412:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1614:
+	.string	"__int32_t"
+.LASF1735:
+	.string	"GYRO_ICM20689"
+.LASF1645:
+	.string	"OWNER_I2C_SDA"
+.LASF1615:
+	.string	"__uint32_t"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1373:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1017:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1418:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1163:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1561:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF1722:
+	.string	"baro"
+.LASF1650:
+	.string	"OWNER_FLASH"
+.LASF1702:
+	.string	"BARO_DEFAULT"
+.LASF1453:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1025:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1090:
+	.string	"IOCFG_IPD 0"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1352:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1585:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1701:
+	.string	"baroDev_t"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF1383:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF1706:
+	.string	"BARO_BMP280"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1364:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1602:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF1102:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1120:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1469:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1138:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1223:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1339:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1698:
+	.string	"start_up"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1115:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1022:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1707:
+	.string	"baroSensor_e"
+.LASF1256:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1322:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1662:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF1358:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1665:
+	.string	"OWNER_TRANSPONDER"
+.LASF1018:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1547:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1580:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1539:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF1475:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1506:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF1725:
+	.string	"GYRO_MPU6050"
+.LASF1268:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1683:
+	.string	"ACC_MPU6000"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1125:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF961:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF1708:
+	.string	"baroDev_s"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1553:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1596:
+	.string	"SONAR_GPIO GPIOB"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1652:
+	.string	"OWNER_MPU_CS"
+.LASF1655:
+	.string	"OWNER_SPI_CS"
+.LASF1064:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1159:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1417:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1505:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1723:
+	.string	"GYRO_NONE"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF885:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1355:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF966:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1014:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF1359:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1436:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1001:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF967:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1057:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1630:
+	.string	"OWNER_ADC_BATT"
+.LASF1031:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF1259:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1541:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1288:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1134:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1493:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1396:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1342:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1513:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1153:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1624:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1237:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1495:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1458:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1604:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF1524:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1521:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF970:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1319:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1557:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1564:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF1682:
+	.string	"ACC_LSM303DLHC"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1137:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1543:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF958:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1724:
+	.string	"GYRO_DEFAULT"
+.LASF1738:
+	.string	"gyro_s"
+.LASF1741:
+	.string	"gyro_t"
+.LASF1457:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1111:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1601:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1441:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1213:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1677:
+	.string	"ACC_NONE"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1086:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1476:
+	.string	"BEEP_ON do {} while(0)"
+.LASF1005:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1647:
+	.string	"OWNER_SDCARD_CS"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1565:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1152:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1695:
+	.string	"up_delay"
+.LASF1523:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1566:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1118:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1545:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF1304:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1679:
+	.string	"ACC_MPU6050"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1568:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1439:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1540:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF1325:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1385:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1234:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1576:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF1532:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1190:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1546:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1065:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1609:
+	.string	"long unsigned int"
+.LASF1094:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1664:
+	.string	"OWNER_LED_STRIP"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF949:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1474:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1345:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1461:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1511:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1674:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1009:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1036:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1569:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1112:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1297:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1095:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1169:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1579:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1651:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1055:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1195:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1529:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF1608:
+	.string	"unsigned int"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF1303:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1465:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF951:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1531:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1573:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1578:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1403:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1189:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1071:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1063:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1340:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1629:
+	.string	"OWNER_ADC"
+.LASF1611:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1656:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1676:
+	.string	"ACC_DEFAULT"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1473:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1232:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1442:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1388:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1008:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF1703:
+	.string	"BARO_NONE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1010:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1632:
+	.string	"OWNER_ADC_EXT"
+.LASF1056:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1514:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1653:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1429:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF989:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1670:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1472:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1235:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1777:
+	.string	"gyro.h"
+.LASF1789:
+	.string	"long-double.h"
+.LASF1798:
+	.string	"__locale_t.h"
+.LASF1800:
+	.string	"platform.h"
+.LASF1775:
+	.string	"acceleration.h"
+.LASF1823:
+	.string	"axis.h"
+.LASF1813:
+	.string	"rx_pwm.h"
+.LASF1783:
+	.string	"libc-header-start.h"
+.LASF1781:
+	.string	"stdbool.h"
+.LASF1767:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1778:
+	.string	"compass.h"
+.LASF1756:
+	.string	"src/main/common"
+.LASF1771:
+	.string	"stdint-intn.h"
+.LASF1802:
+	.string	"target.h"
+.LASF1814:
+	.string	"sdcard.h"
+.LASF1766:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1769:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1790:
+	.string	"stubs.h"
+.LASF1822:
+	.string	"accgyro.h"
+.LASF1829:
+	.string	"sonar_hcsr04.h"
+.LASF1761:
+	.string	"src/main/target/SITL"
+.LASF1787:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1818:
+	.string	"io_def_generated.h"
+.LASF1765:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1809:
+	.string	"config.h"
+.LASF1835:
+	.string	"voltage_ids.h"
+.LASF1799:
+	.string	"strings.h"
+.LASF1785:
+	.string	"features-time64.h"
+.LASF1820:
+	.string	"vcd.h"
+.LASF1819:
+	.string	"sound_beeper.h"
+.LASF1770:
+	.string	"types.h"
+.LASF1811:
+	.string	"io_types.h"
+.LASF1821:
+	.string	"runtime_config.h"
+.LASF1758:
+	.string	"src/main/drivers"
+.LASF1768:
+	.string	"/usr/include"
+.LASF1824:
+	.string	"exti.h"
+.LASF1755:
+	.string	"src/main/build"
+.LASF1805:
+	.string	"feature.h"
+.LASF1784:
+	.string	"features.h"
+.LASF1801:
+	.string	"common.h"
+.LASF1792:
+	.string	"typesizes.h"
+.LASF1797:
+	.string	"locale_t.h"
+.LASF1815:
+	.string	"serial.h"
+.LASF1812:
+	.string	"flash.h"
+.LASF1757:
+	.string	"src/main/config"
+.LASF1774:
+	.string	"sensors.h"
+.LASF1793:
+	.string	"time64.h"
+.LASF1772:
+	.string	"stdint-uintn.h"
+.LASF1762:
+	.string	"src/main/target"
+.LASF1804:
+	.string	"utils.h"
+.LASF1834:
+	.string	"voltage.h"
+.LASF1830:
+	.string	"battery.h"
+.LASF1763:
+	.string	"src/main"
+.LASF1776:
+	.string	"barometer.h"
+.LASF1760:
+	.string	"src/main/sensors"
+.LASF1773:
+	.string	"resource.h"
+.LASF1827:
+	.string	"time.h"
+.LASF1808:
+	.string	"parameter_group_ids.h"
+.LASF1825:
+	.string	"sensor.h"
+.LASF1794:
+	.string	"wchar.h"
+.LASF1833:
+	.string	"current_ids.h"
+.LASF1817:
+	.string	"io_def.h"
+.LASF1759:
+	.string	"src/main/fc"
+.LASF1816:
+	.string	"io.h"
+.LASF1832:
+	.string	"current.h"
+.LASF1764:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1795:
+	.string	"string.h"
+.LASF1788:
+	.string	"cdefs.h"
+.LASF0:
+	.string	"./src/main/sensors/initialisation.c"
+.LASF1782:
+	.string	"stdint.h"
+.LASF1807:
+	.string	"build_config.h"
+.LASF1796:
+	.string	"stddef.h"
+.LASF1791:
+	.string	"stubs-64.h"
+.LASF1786:
+	.string	"wordsize.h"
+.LASF1836:
+	.string	"initialisation.h"
+.LASF1826:
+	.string	"accgyro_mpu.h"
+.LASF1828:
+	.string	"sonar.h"
+.LASF1803:
+	.string	"common_post.h"
+.LASF1810:
+	.string	"adc.h"
+.LASF1806:
+	.string	"parameter_group.h"
+.LASF1779:
+	.string	"initialisation.c"
+.LASF1780:
+	.string	"stdc-predef.h"
+.LASF1831:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375 *=\001"
+	.string	"\004\002\036"
+	.string	"\003"
+	.string	"\275\210\307\313\002\004\002"
+	.string	"\002\001\002\002\002\003\004\217\322\265\255\002"
+	.string	"\005\365\246\231\344\006"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375 \036\305"
+	.string	""
+	.string	"\200\022"
+	.string	"\002"
+	.string	""
+	.string	"\003"
+	.string	"\001\004"
+	.string	"\003"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\271P6\200\005"
+	.text
+	.section	.gnu.lto_.inline.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375 |]\002"
+	.string	"\002\304\r\031\260'\035\214\270\202\021\013\030,\240\f\025@W\206a\nz\241\305\335\344N\001\377\0337\270$L#\\\337y\002\030\350;\364\033\237\301\027l\333\342\323A\245\255=G\002\006"
+	.ascii	"A@u\2231\231\373C-\006\013\306\033h\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375 ]M\002"
+	.string	"\264\003Q"
+	.string	"\002\001\300\004\001"
+	.string	"\300\004\001\377\377\377\377\017"
+	.string	""
+	.string	"\004\0036"
+	.string	"wus"
+	.string	"\002x"
+	.string	"\001\002\006q\001\001\006q\001\177\001\377\001\001\002\006(\001"
+	.string	"\006(\001\377\001\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"9\313\317\263\364n\334\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\004\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375 .\355"
+	.string	""
+	.string	"\230\""
+	.string	"\002"
+	.string	"\002\002\b"
+	.string	"\001\002\t\001"
+	.string	"\002\n\001"
+	.string	"\004"
+	.string	"\004\020"
+	.ascii	"\205\305\017x\303\002"
+	.text
+	.section	.gnu.lto_.lto.4748d39d2d4c7c46,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.48.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"E\t"
+	.string	"\026\021?9@\305(\035\240\205\346\314'c\002\205\343t\2540A\372g\217\215\201!\027\211\023626\233\034i\366\351\032\200\206\376%\227a62\225\207\345 \306\303\340\340\017F\266\224)\005."
+	.string	"."
+	.string	"/"
+	.string	"q9\316\035\256r\376\200\007:\264\\|\241A\tcu\361:xp\222\032\375t\245\360D\252\002\2329\247\225\344Y\334\327m+\330N\260\215\022\376:\335\r\373pn\311\266\032\252o\331\216\021\212\300d\316\212\026\200\231\272JL\266o\337\343c_lg>\346\n$V\265\032\211\250\314\371\005\037\207;a\033\2565\241\355\340\203\356.\350,\215\326\310\232\013\370.\204\250D\3122T\033\"BO\372f2\272\005\371\247_\246o\2252u\305\001\346`\260Lz6\233d\330H\217\304d\334\264l\303:[\304\344\246!r\264-b\020\2349t\264\350\3112-^\276\320\267\244\373\323!H"
+	.string	"\024\211>\020"
+	.ascii	"\\\b\370\251\031\347\204\301\341\225\240\f@_\250\226\006R^\343"
+	.ascii	"\256\f\241\270&\212!\342\362#{\301pS\355\321\300\324\036"
+	.text
+	.section	.gnu.lto_sensorsAutodetect.part.0.56.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375`\246\001\235\020"
+	.string	"\306\336nI\320TQ:\030\353+NEuq@\024\005@'\275\211X\214\240\231\240m|\306O\342u\327\bW\224\364\332\352\251\202~?\\T R\273\247Dy0\377\222\222\226=\275\233y\204<\264\216\372\314\2045\236h\215\020\"wJ\001U"
+	.string	"["
+	.string	"^"
+	.string	"2\307\271\345\346V\273\355n\351>\371\262K>9c\227\356\375\205WN/\303^\362\340|\260\355\225\323\214a(5*\204\310\306'\267[\202\3674\305a\327\331\301\374I\313\211]O^\245\207\007\212 ?9:\237'\357F.\273kR\210\333\273\355\026\333\021\354Y\022gq\317+q\236v\317\027\225\004'\233E>\371\t=K4\264\263\310\324\035k\367n\325f{\272\033M\3537=\275\351\223\250\2500\251\355\342\024\031Y\023^\220\213\030/\307tK\242|`\363Q\343\226\333YY\240<\f\031\307\240\224< \016\210\260\321\303\345\003|\367H\007\360\375\016\002\204p<\307\002\006//\337=\273\201\203\032\215y\252\252\001\233#6\204\337\220@\332\235\261\370?\007\242P\001\006\346\2737\365\344\347\217\233[\215\034\3558q\334ICV\350\264 \362\325N\246m\341\002\215\306\374\215"
+	.ascii	"b2\257vJ5Os\312Lc\2663|FH\332]\026_\306}68\326`\032U.\325J\034"
+	.ascii	"Q\030\0068eb\211\241\013\325\n9\240BW\310\n\301\326(\266X\252"
+	.ascii	"\026\310\nQ+05\266@\023\001\213\035T#\350\022\305\021,\275[\265"
+	.ascii	"\271\004\r\240\371\303\276N=\330\356\324.2\245\261\252\356\330"
+	.ascii	">mn(e\252\036\367 \004ShWv\232\235\340:\024\004# `\"\242\306"
+	.ascii	"l\003\202.a\227\214\021\"1\236(\264\025\r\242\230\333a\r\201"
+	.ascii	"x\340\032\311Ym\377z-c,?k\\;\200\225\272Z&py[\030\032\244\301"
+	.ascii	"\006\222\347\021^\214!\211\177\343foi\332\324GOp\260\017\373"
+	.ascii	"\205\270^\022\213\302\366\237\020\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375 \367}\004"
+	.string	"\224\006\363"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\0028\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\0052\f7\r6\005\0020\177\016\272\200\202\002/\017\201\204\001"
+	.string	""
+	.string	""
+	.string	"\0013\177\020\377\037"
+	.string	""
+	.string	"\200\200\200\0014\177\0215\177\0221\177\023\003"
+	.string	"\b\344\006\003"
+	.string	"\007\244\001\003"
+	.string	"\006d\003\004\tD\003\004"
+	.string	"\310\377\241\372\001\001\202\001"
+	.string	"\017"
+	.string	"8\007\001C\273\206~\230a\200z"
+	.ascii	"p\370\004rt\351\025\004\213\313/\224E\244:\002\002\203\303R["
+	.ascii	"\236"
+	.text
+	.section	.gnu.lto_.refs.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"\002\t"
+	.string	"\002\003\013"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4748d39d2d4c7c46,"e",@progbits
+	.string	"(\265/\375`5\020MS"
+	.ascii	"\232\217\274\037S@R\312I\007j\205\233\230\t\376\361\366b>~\022"
+	.ascii	"s\346\254W\276\314=\230\326\262\346\222.}\371\004\336\351\251"
+	.ascii	"\274a\224\306\266r\200\335\245L\355\362\217\216\200\231\346\342"
+	.ascii	"\214\335W\253\271\273\312\305Qu7}K\356\314\305\354\362\216\324"
+	.ascii	"J\335\213^l\020+e\n\262\001\346\001\342\001k>:\335X\246"
+	.string	"x\221]\371\332.\321\326k\211\232\231\026H\273\334-\253e\227\306\bpP\232\351N\201\330\037\326\313~\331.\253\334\345rQ\333\261\345\266}\315g\230\226 \345*\216Iw\023\021\021uA\322c\216\307\374\276\325\257\017u{X\037V\211b\263\274\005\322u\301\262\036\353y#\366\246\210*\365\213b\267s\213b\367M\3537I\375\022\251\337\037\365_\036P\374\244>\254\206\260\371\357\016\3136\"\013\034\\\0226\277d\377\321\262m\016\233\334%\232\271\204\213\231\356\256\262TV\271l+\345;e\327n\246w\361\037}\331\366l\325N\344\350F\312 \200\2209*+r\335)\221\020\221\216\330\305,\311\316\334\336\022;\240%\261;\nuuX\264U\016m\332\027\312\222]g\230v\262;\375\321qK\023\003\032\233?\241\362$}\243\334\200\262F\272\211\372\035\332\375\354\320\356#\252\271\311\177\237l\3725>v\017\273["
+	.string	"\376\341\214\frln\331\321\327\214\304\256hL\373GG\245m\252\r\233\314\365\313-\261\343Y\022\273\024[\302\311\277MvlHG\254:6Zw\032\3243\204\233\024\0236\237n\211]]\022\273\177/X\023$\214\360\177\371/\r\021 \200\021\302\3775\020\376\225\340\377\211\377*\376\375\340\337\016\016\370\231\204\0054P\361\177\3673\215\1773\370\027\203\177!\370\367\201\177\221\376%\372\327\350_\006\376]\361o\212\377i\377\026\360\357\211\177\205\376%\340\337\236\377_\376\357\360\277\312\377\261\377"
+	.ascii	"\374\317\362_7777\367o\375u\016\374<n\001\003XIm\035{\270$\202"
+	.ascii	"\035\273\301\244n\264U\003\301t\331Ev\031\034\022\244\253\246"
+	.ascii	"\272MXu\007\267\227\335\035\354\356\234b\220\264;\013\210\350"
+	.ascii	"ee\325m\024\262\352 A\266\251nF\023C\005\213\230\334:\036\261"
+	.ascii	"\235%\275\232*\r\256W\277!\2135\031\314\241\253\322T/,\027\320"
+	.ascii	"\260\311G\265J%%\212\222\270\3122\370\f\251\"\2636\246\376\034"
+	.ascii	"\003\357\350\242\301\214\0176+X\322\371\352\253\344+\006b\006"
+	.ascii	"\203\206-\f\343\325m\\\361\323\004\314\225\032\330\314b0e\264"
+	.ascii	"\224\270\325\273`\037\354\002\3578!E4\311\264\230\341\261n\220"
+	.ascii	"[\226\r\373\340\027\326\215\3170m\254\030"
+	.string	"\\\256\342\344\272\033\0066\362\217U\262\017\356q.2\326\232\275\311\261\244\232\327\265\325\353\326\352ui\365:\263\252\203\241#\253l%d~\221\035\265\330\274\016\254N\031\323\204\2478\007Sq\025\263\300Dna\225\254c\327|\331\254\334\205\3240q\001f\341\332\234\224a\035kf\343v\311E\301\230\330\024!\026\256ml\335\206\340\341\t)b\006qd:\226\314\302\355\322\2306\217\021p\310\302B\344\343d\254\310\025 \223\245\366K\021\312\2329\026r\260G\207,YB\356s\220g\315T\033%\233;\247\373\301\315\fB6\257\346:=d^`\332\336\334\rw\355\350R\303\346\022\261E\254\362V\266\315\026\271\022,\302\246\252\220s+\273\363\230\252c\001D=\373P\367\314\242Y\245\212M\363-\3332\307\021\246\235\362\0217Q\314\330\352W\305N77\267*vg\264\n\304O\352\231I=w\255\230\267\034\036C"
+	.string	"\tBH\375*7\314\233\031\345\007\327\326\325|\337N\206\247\373\004\216\0270\033\224l\236\263j\212 \226\\\244\344\222l\036\tK\332\246V\036B\241\024\247;A\310\304\312\260\311OL\"\222\024\235\360`\262\233e\307\036\235\320\307\22656\277\243\252;gM\232\260\021\241\243n\f\2252J\230lZ\260\b\342\226\272\303\226t\303o`\261-\353+"
+	.string	"\276\216pC\225+M\2170fr\026\353Q\003eI\246\266\343r\325\206\b%uG+\211\277\226\303\224\034\306_Bmn\025\335\344\260t\321\270\302\024\023\213r\006Y\371\213qbP\321\023\367f\206\"\233\347/-&t'{\310\360\220\"a\223\223\034\235\225Dpd\b\016l\352\226\304.\347-\351\334\325\305B\\@{\270\2123\303\340\226t\231\252:a\222\316H\276JF\302Z\346\260\254\203\023\204\241j#\327m\\\241\343\246U\206\f\233\307\t\326\017\031\302Fv\335\233\036\257\212m,\016\355\234Ib$o\235\211\360\221\237\b\033\251\301\356`\332W\333Ut\223\223k\243q\350'LZP\216\2150\227N\222\257\255*6\231\213\231\006.r\346\342\031\336\002\351<\303\036\353N\231\313\354\026\356\036\340\263{"
+	.string	"\216\025$B\263\235y\263\255\336L\326\233G\352\371\337\265\260\330\335<p\322.J\361|qv\207\376\236\325-\002\377\315\356_\350\354\016By\213\253_kB )\3728\313\"1\211\fR\200\304\032\"a &\221\035\034\332\020\f*62HLv\007\365p\030\234q\354 b\262\261\232\005/X\333)2\330\303c\007\365\260\205)\210C$\0261)\304\n\"&\221X\235D6P\017\205\305\034\303.\006u\022y\246\223G, b\362\210EL\"\215\233E\364\322\206\225|\333\"n\027\342\260wX\005\021\026\201\226\304\364\330o\335\2136\325E\004\272\203\034\213oB\030\226\212\324r\207\224\232\360\270iw\007?'\217g\306\316o\024\241"
+	.string	"\002{PN>\245\021\277\321t*)\365\020@\231\2364PR\352\345\204\260t\376\354\356M\247\023\005\256\020B"
+	.string	"\346\025h\362\371,\340\341\004\261(B\177=\250\"T\351D\317%\037\032U\201\320\225\230~\347\323i\243\276\201\027\f\274\200\241B\316a\304`\021\203\305\3560b\034\035\305xqT\377\342H\207\242\347/\n\355\375N(\247S\204\037 o\207\343\\\322\241M\025\370~=\013rL\364\304\301\364[\222\001@\316\211\366\232\242\224\232zJ:@\036\216s\206\016\032UQ\336\213\243\025zM\347\022\017*\252\242\350\257\207\002\353\017\365@\351)\n\003\250\016\240\242x\350ic\367\033E\006"
+	.ascii	"y6\230j<\371d\374N\364t:\177\275\024\226~\275\033=(\017F\016"
+	.ascii	"\372\024\345S\342\235MPN=`P\r\250"
+	.string	"&\336\td\362=\3714\2358\320\246\036\257\206\022\317\367\353\2350\3427\212L\334\007u\376\214P\237\357g4\002\310\333\241\274\026.\320'\246\250\372\245\023N\244\323\201\032,\212L\374\201\007d\244\240\301ARU*z\3621\241= SS\217\tezb2\002\376|\300\247\023h\364\304\324s2R\372\001\215\212\0228\235\230P(\237o\003\364\264\361\353\241>5d\314\250\300\367[\301F\305\002\204g\013\334\232\260+g_\244\030\265\330L\307x\256\256\216\034\255\b\361\271A\314\230!\017boG\"U;h\321@s\322V\205\315h\031\366B\252\226\003V\245\f\0276w\334\2441\2254^\323\331\241\351\301\330chmJ\232p\215\325\024):<\272\244\351P\343c\212\363\344H\204\215\332r\231\373\201\226\305U\225F,@SE\204\315\035744 \214TmL&J3-Zu\207\006'w\302g[V"
+	.ascii	"\334"
+	.string	"U\\\007b\250\210\200r>\363\001\263\201m\214M\316\201\2238g;\266\316\222f;ljag\330\252'\b8+\"\233e\273\346\377W\207\2011\250q4\250\0204#3#\"\232$\311p!\005\204(I%;\017\0210\255\243\206j$I\n\205e7%/a\032$\3147\214\366\306:\022\216\022\215\005,\261BA\334\221\261\260\370\210F\311\313\305\225\253\313\331\027\201\262K\344\035,A\237`\304?@Z\bb\225\023d<\272\bOR\352\374t\235)(43\360\313\207\013g\006i\225\017y\036\215\250a\264TpE\256\310z\360\227\374Js\2372_Q}Y\243r\177\t\001p\216\023\273\303d\364\255{\2722\260\021\223=\005\347\211\016\253\364c\"d\360\001p\236\262#\205\263a\261\024\360\374\243zK1\317\270\227d\317"
+	.string	"\374\273\324\276\251\343Y\036=tD\325. 3\310\330#9HJ\316*PR\240\304\343ky\271\321<\331j\221\335f?q\364\022\377?=ru\005lJ\f\300:~\021\367\3451\240\355\376n\264\350\321\322D,\362\355\230\207\337\250>\177\367\364\222H\026\006\3412\331ftP\314\t\n\241\323+\300\004<qBbN-\351\350\351\263Gn\215\231!\266\210\035%aK\327\272\217\304\372\305\263\212HC\331K>\337\231d0~\227P\257"
+	.ascii	"\314 \245\354\017\376"
+	.string	"\250\310\253\363p\n O\t\025O\255\246\307\222oV,\324\3649W-u\332Ri\033\365\231]V\223f\273U!\262\223\322L\227bD\334R\021L\301}\221\225\001X\217\202\215\344\330\340\364\t\320\241\244\370\352\257\330+/\2601s\334\376Q\224\203Td\r\225\001\251\347\350\224\214/\211\374#\2200\251\312\327\274\327\303\220\315}\230\330\330\377y\224\031\251\254\260m\270\r\321t\001\340\243\177\037r?\031q\245\270\003\305D\027\331F\242\204\177^\342\325\315_\301IHF\"gBvP\244\213\266\\\211],\327T\224k\022}\314\327\2254\242\020_\033A\277\t\270/S\324X\2661\215\b\304\325u\332\f\353\273I\006B&\350\271\313h\272tH*A\372\247\316\020Z\b$#\241\345\311\277E\304\312\321[P|\353\313u9\203\360)\007f7\305\326@\t\"\336\220uLn\332\346\341R\255\032[y\204C\020"
+	.ascii	"\322\177\\\023J\234x\243\344\337\236\362\275\236\236\371r~z_"
+	.ascii	"\276\335\233\203YA\006\r\360\205\273\2607\374\017\035\366\311"
+	.ascii	"\352\023\"U"
+	.text
+	.section	.gnu.lto_.symtab.4748d39d2d4c7c46,"e",@progbits
+	.string	"sensorsAutodetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"detectedSensors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"accInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"compassInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"baroDetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"gyroInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4748d39d2d4c7c46,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9044 @@
+	.file	"voltage.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/common/filter.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/sensors/voltage_ids.h"
+	.file 7 "./src/main/sensors/voltage.h"
+	.file 8 "./src/main/sensors/voltage.c"
+	.file 9 "/usr/include/string.h"
+	.file 10 "./src/main/drivers/adc.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	voltage.c.41833da4
+	.weak	voltage.c.41833da4
+voltage.c.41833da4:
+	.long	0x6d3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x18
+	.long	.LASF1236
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1120
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1121
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1122
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1123
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1124
+	.uleb128 0x2
+	.long	.LASF1126
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1125
+	.uleb128 0x2
+	.long	.LASF1127
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1128
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1129
+	.uleb128 0x1a
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1130
+	.uleb128 0x2
+	.long	.LASF1131
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xb
+	.long	0x87
+	.uleb128 0x2
+	.long	.LASF1132
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0xb
+	.long	0x98
+	.uleb128 0x2
+	.long	.LASF1133
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x2
+	.long	.LASF1134
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1135
+	.uleb128 0xe
+	.long	.LASF1145
+	.byte	0x1c
+	.byte	0x4
+	.byte	0x24
+	.long	0x129
+	.uleb128 0x7
+	.string	"b0"
+	.byte	0x4
+	.byte	0x25
+	.byte	0xb
+	.long	0xc1
+	.byte	0
+	.uleb128 0x7
+	.string	"b1"
+	.byte	0x4
+	.byte	0x25
+	.byte	0xf
+	.long	0xc1
+	.byte	0x4
+	.uleb128 0x7
+	.string	"b2"
+	.byte	0x4
+	.byte	0x25
+	.byte	0x13
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x7
+	.string	"a1"
+	.byte	0x4
+	.byte	0x25
+	.byte	0x17
+	.long	0xc1
+	.byte	0xc
+	.uleb128 0x7
+	.string	"a2"
+	.byte	0x4
+	.byte	0x25
+	.byte	0x1b
+	.long	0xc1
+	.byte	0x10
+	.uleb128 0x7
+	.string	"d1"
+	.byte	0x4
+	.byte	0x26
+	.byte	0xb
+	.long	0xc1
+	.byte	0x14
+	.uleb128 0x7
+	.string	"d2"
+	.byte	0x4
+	.byte	0x26
+	.byte	0xf
+	.long	0xc1
+	.byte	0x18
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1136
+	.byte	0x4
+	.byte	0x27
+	.byte	0x3
+	.long	0xc8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1137
+	.uleb128 0x2
+	.long	.LASF1138
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0x98
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x176
+	.uleb128 0xf
+	.long	.LASF1139
+	.value	0xfff
+	.uleb128 0xf
+	.long	.LASF1140
+	.value	0xf000
+	.uleb128 0xf
+	.long	.LASF1141
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1142
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1143
+	.value	0x8000
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1144
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xf
+	.long	0x182
+	.uleb128 0x1b
+	.long	0x192
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x1c
+	.byte	0x8
+	.byte	0x5
+	.byte	0x35
+	.byte	0x5
+	.long	0x1b1
+	.uleb128 0x16
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0x16
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x1b1
+	.byte	0
+	.uleb128 0x8
+	.long	0x176
+	.uleb128 0xe
+	.long	.LASF1146
+	.byte	0x20
+	.byte	0x5
+	.byte	0x30
+	.long	0x204
+	.uleb128 0x7
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x31
+	.byte	0xb
+	.long	0x13c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1147
+	.byte	0x5
+	.byte	0x32
+	.byte	0xe
+	.long	0x98
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1148
+	.byte	0x5
+	.byte	0x33
+	.byte	0xe
+	.long	0x204
+	.byte	0x8
+	.uleb128 0x7
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x34
+	.byte	0xf
+	.long	0x209
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1149
+	.byte	0x5
+	.byte	0x38
+	.byte	0x7
+	.long	0x192
+	.byte	0x18
+	.byte	0
+	.uleb128 0x8
+	.long	0x87
+	.uleb128 0x8
+	.long	0x204
+	.uleb128 0x2
+	.long	.LASF1150
+	.byte	0x5
+	.byte	0x39
+	.byte	0x3
+	.long	0x1b6
+	.uleb128 0xb
+	.long	0x20e
+	.uleb128 0x10
+	.long	0x93
+	.long	0x22a
+	.uleb128 0x1d
+	.byte	0
+	.uleb128 0xb
+	.long	0x21f
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x6
+	.byte	0x18
+	.long	0x2f5
+	.uleb128 0x1
+	.long	.LASF1151
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1152
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1153
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1154
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1155
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1156
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1157
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1158
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1159
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1160
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1161
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1162
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1163
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF1164
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF1165
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF1166
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF1167
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF1168
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF1169
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF1170
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1171
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF1172
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF1173
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF1174
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF1175
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF1176
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF1177
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF1178
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF1179
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1180
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF1181
+	.byte	0x77
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1182
+	.byte	0x6
+	.byte	0x47
+	.byte	0x3
+	.long	0x22f
+	.uleb128 0xe
+	.long	.LASF1183
+	.byte	0x4
+	.byte	0x7
+	.byte	0x22
+	.long	0x328
+	.uleb128 0x4
+	.long	.LASF1184
+	.byte	0x7
+	.byte	0x23
+	.byte	0xe
+	.long	0x98
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1185
+	.byte	0x7
+	.byte	0x24
+	.byte	0xe
+	.long	0x98
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1186
+	.byte	0x7
+	.byte	0x25
+	.byte	0x3
+	.long	0x301
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x7
+	.byte	0x3f
+	.long	0x358
+	.uleb128 0x1
+	.long	.LASF1187
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1188
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1189
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1190
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1191
+	.byte	0x7
+	.byte	0x44
+	.byte	0x3
+	.long	0x334
+	.uleb128 0xe
+	.long	.LASF1192
+	.byte	0x3
+	.byte	0x7
+	.byte	0x47
+	.long	0x398
+	.uleb128 0x4
+	.long	.LASF1193
+	.byte	0x7
+	.byte	0x48
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1194
+	.byte	0x7
+	.byte	0x49
+	.byte	0xd
+	.long	0x87
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1195
+	.byte	0x7
+	.byte	0x4a
+	.byte	0xd
+	.long	0x87
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1196
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x3
+	.long	0x364
+	.uleb128 0xb
+	.long	0x398
+	.uleb128 0x10
+	.long	0x398
+	.long	0x3b8
+	.uleb128 0x12
+	.long	0x37
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1197
+	.byte	0x7
+	.byte	0x4d
+	.byte	0x21
+	.long	0x3a9
+	.uleb128 0x10
+	.long	0x93
+	.long	0x3d3
+	.uleb128 0x12
+	.long	0x37
+	.byte	0
+	.uleb128 0xb
+	.long	0x3c4
+	.uleb128 0xc
+	.long	.LASF1198
+	.byte	0x7
+	.byte	0x61
+	.byte	0x16
+	.long	0x3d3
+	.uleb128 0xc
+	.long	.LASF1199
+	.byte	0x7
+	.byte	0x63
+	.byte	0x16
+	.long	0x93
+	.uleb128 0xc
+	.long	.LASF1200
+	.byte	0x7
+	.byte	0x64
+	.byte	0x16
+	.long	0x22a
+	.uleb128 0x1e
+	.long	0x3f0
+	.byte	0x8
+	.byte	0x28
+	.byte	0xf
+	.long	0x3d3
+	.uleb128 0x13
+	.long	0x3e4
+	.byte	0x44
+	.byte	0xf
+	.uleb128 0xe
+	.long	.LASF1201
+	.byte	0x20
+	.byte	0x8
+	.byte	0x60
+	.long	0x443
+	.uleb128 0x4
+	.long	.LASF1202
+	.byte	0x8
+	.byte	0x61
+	.byte	0xe
+	.long	0x98
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1203
+	.byte	0x8
+	.byte	0x62
+	.byte	0xe
+	.long	0x98
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1204
+	.byte	0x8
+	.byte	0x63
+	.byte	0x14
+	.long	0x129
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1205
+	.byte	0x8
+	.byte	0x64
+	.byte	0x3
+	.long	0x40f
+	.uleb128 0x10
+	.long	0x443
+	.long	0x45e
+	.uleb128 0x12
+	.long	0x37
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1206
+	.byte	0x8
+	.byte	0x66
+	.byte	0x1f
+	.long	0x44f
+	.uleb128 0x1f
+	.long	0x45e
+	.byte	0x68
+	.byte	0x18
+	.uleb128 0x13
+	.long	0x3b8
+	.byte	0x6f
+	.byte	0x64
+	.uleb128 0xc
+	.long	.LASF1207
+	.byte	0x8
+	.byte	0x6f
+	.byte	0xa5
+	.long	0x21a
+	.uleb128 0x20
+	.long	0x478
+	.byte	0xd9
+	.uleb128 0x21
+	.long	.LASF1237
+	.byte	0x8
+	.byte	0x7d
+	.byte	0x16
+	.long	0x3d3
+	.string	""
+	.uleb128 0x13
+	.long	0x3d8
+	.byte	0xf8
+	.byte	0xf
+	.uleb128 0x22
+	.long	.LASF1231
+	.byte	0x4
+	.byte	0x57
+	.byte	0x6
+	.long	0x4ba
+	.uleb128 0x3
+	.long	0x4ba
+	.uleb128 0x3
+	.long	0xc1
+	.uleb128 0x3
+	.long	0xa9
+	.byte	0
+	.uleb128 0x8
+	.long	0x129
+	.uleb128 0x14
+	.long	.LASF1208
+	.byte	0x9
+	.byte	0x3d
+	.byte	0xe
+	.long	0x7e
+	.long	0x4df
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0xb5
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1209
+	.byte	0x4
+	.byte	0x5b
+	.byte	0x7
+	.long	0xc1
+	.long	0x4fa
+	.uleb128 0x3
+	.long	0x4ba
+	.uleb128 0x3
+	.long	0xc1
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1210
+	.byte	0xa
+	.byte	0x33
+	.byte	0xa
+	.long	0x98
+	.long	0x510
+	.uleb128 0x3
+	.long	0x87
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1212
+	.byte	0x8
+	.value	0x105
+	.byte	0x6
+	.long	0x537
+	.uleb128 0x24
+	.string	"id"
+	.byte	0x8
+	.value	0x105
+	.byte	0x28
+	.long	0x2f5
+	.uleb128 0x25
+	.long	.LASF1211
+	.byte	0x8
+	.value	0x105
+	.byte	0x3c
+	.long	0x537
+	.byte	0
+	.uleb128 0x8
+	.long	0x328
+	.uleb128 0xa
+	.long	.LASF1213
+	.byte	0xe6
+	.long	0x553
+	.uleb128 0x6
+	.long	.LASF1214
+	.byte	0x8
+	.byte	0xe6
+	.byte	0x32
+	.long	0x537
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1215
+	.byte	0xd9
+	.long	0x576
+	.uleb128 0x6
+	.long	.LASF1216
+	.byte	0x8
+	.byte	0xd9
+	.byte	0x27
+	.long	0x87
+	.uleb128 0x6
+	.long	.LASF1214
+	.byte	0x8
+	.byte	0xd9
+	.byte	0x44
+	.long	0x537
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1217
+	.byte	0xd0
+	.uleb128 0x17
+	.long	.LASF1218
+	.byte	0xc8
+	.uleb128 0xa
+	.long	.LASF1219
+	.byte	0xac
+	.long	0x5a5
+	.uleb128 0xd
+	.uleb128 0x15
+	.string	"i"
+	.byte	0xae
+	.byte	0x12
+	.long	0x87
+	.uleb128 0xd
+	.uleb128 0x9
+	.long	.LASF1220
+	.byte	0xb1
+	.byte	0x21
+	.long	0x5a5
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x443
+	.uleb128 0xa
+	.long	.LASF1221
+	.byte	0xa4
+	.long	0x5d8
+	.uleb128 0x6
+	.long	.LASF1222
+	.byte	0x8
+	.byte	0xa4
+	.byte	0x2d
+	.long	0x358
+	.uleb128 0x6
+	.long	.LASF1214
+	.byte	0x8
+	.byte	0xa4
+	.byte	0x49
+	.long	0x537
+	.uleb128 0x9
+	.long	.LASF1220
+	.byte	0xa6
+	.byte	0x1d
+	.long	0x5a5
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1223
+	.byte	0x91
+	.long	0x627
+	.uleb128 0xd
+	.uleb128 0x15
+	.string	"i"
+	.byte	0x93
+	.byte	0x12
+	.long	0x87
+	.uleb128 0xd
+	.uleb128 0x9
+	.long	.LASF1220
+	.byte	0x96
+	.byte	0x21
+	.long	0x5a5
+	.uleb128 0x9
+	.long	.LASF1224
+	.byte	0x97
+	.byte	0x29
+	.long	0x627
+	.uleb128 0x9
+	.long	.LASF1225
+	.byte	0x99
+	.byte	0x11
+	.long	0x87
+	.uleb128 0x9
+	.long	.LASF1226
+	.byte	0x9a
+	.byte	0x12
+	.long	0x98
+	.uleb128 0x9
+	.long	.LASF1227
+	.byte	0x9c
+	.byte	0x12
+	.long	0x98
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x3a4
+	.uleb128 0x26
+	.long	.LASF1238
+	.byte	0x8
+	.byte	0x8a
+	.byte	0x11
+	.long	0x98
+	.long	0x655
+	.uleb128 0x27
+	.string	"src"
+	.byte	0x8
+	.byte	0x8a
+	.byte	0x34
+	.long	0xa4
+	.uleb128 0x6
+	.long	.LASF1224
+	.byte	0x8
+	.byte	0x8a
+	.byte	0x59
+	.long	0x627
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1228
+	.byte	0x71
+	.long	0x684
+	.uleb128 0x6
+	.long	.LASF1229
+	.byte	0x8
+	.byte	0x71
+	.byte	0x41
+	.long	0x684
+	.uleb128 0xd
+	.uleb128 0x15
+	.string	"i"
+	.byte	0x73
+	.byte	0xe
+	.long	0x64
+	.uleb128 0xd
+	.uleb128 0x9
+	.long	.LASF1230
+	.byte	0x74
+	.byte	0x2f
+	.long	0x3a4
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0x398
+	.uleb128 0x28
+	.long	.LASF1232
+	.byte	0x8
+	.byte	0x6a
+	.byte	0x19
+	.long	0x5a5
+	.long	0x6a6
+	.uleb128 0x6
+	.long	.LASF1233
+	.byte	0x8
+	.byte	0x6a
+	.byte	0x34
+	.long	0x87
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1234
+	.byte	0x4b
+	.long	0x6bd
+	.uleb128 0x6
+	.long	.LASF1211
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x28
+	.long	0x537
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1239
+	.byte	0x7
+	.byte	0x4d
+	.byte	0x76
+	.long	0x627
+	.uleb128 0x6
+	.long	.LASF1235
+	.byte	0x7
+	.byte	0x4d
+	.byte	0x91
+	.long	0x64
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.file 14 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 30 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 33 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 34 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x22
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.file 35 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 36 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.file 37 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF977
+	.byte	0x4
+	.file 38 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xa
+	.file 39 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 40 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 41 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 42 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 43 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x2b
+	.file 44 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1112
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1119
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF972
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF976
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF995
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF997
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1020
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1102
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.21.babea9fbbec072c497651a19f3937965,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1111
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.31.3b5d682359a370a2ebd4f23a79bccb6b,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1115
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1240
+	.long	.LASF1241
+	.long	.LASF1242
+	.long	.LASF1243
+	.long	.LASF1244
+	.long	.LASF1245
+	.long	.LASF1246
+	.long	.LASF1247
+	.long	.LASF1248
+	.long	.LASF1249
+	.long	.LASF1250
+	.long	.LASF1251
+	.long	.LASF1252
+	.long	.LASF1253
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1254
+	.byte	0xa
+	.long	.LASF1255
+	.byte	0xa
+	.long	.LASF1256
+	.byte	0xe
+	.long	.LASF1257
+	.byte	0x2
+	.long	.LASF1258
+	.byte	0x3
+	.long	.LASF1259
+	.byte	0x5
+	.long	.LASF1260
+	.byte	0x5
+	.long	.LASF1261
+	.byte	0x5
+	.long	.LASF1262
+	.byte	0xd
+	.long	.LASF1263
+	.byte	0x4
+	.long	.LASF1264
+	.byte	0xd
+	.long	.LASF1265
+	.byte	0xe
+	.long	.LASF1266
+	.byte	0xe
+	.long	.LASF1266
+	.byte	0xd
+	.long	.LASF1267
+	.byte	0xa
+	.long	.LASF1268
+	.byte	0xd
+	.long	.LASF1269
+	.byte	0xd
+	.long	.LASF1270
+	.byte	0xa
+	.long	.LASF1271
+	.byte	0xa
+	.long	.LASF1272
+	.byte	0xc
+	.long	.LASF1273
+	.byte	0xa
+	.long	.LASF1274
+	.byte	0xb
+	.long	.LASF1275
+	.byte	0xb
+	.long	.LASF1276
+	.byte	0xa
+	.long	.LASF1277
+	.byte	0xa
+	.long	.LASF1278
+	.byte	0xa
+	.long	.LASF1279
+	.byte	0xa
+	.long	.LASF1280
+	.byte	0x9
+	.long	.LASF1281
+	.byte	0x9
+	.long	.LASF1282
+	.byte	0xd
+	.long	.LASF1283
+	.byte	0x8
+	.long	.LASF1284
+	.byte	0x7
+	.long	.LASF1285
+	.byte	0x6
+	.long	.LASF1286
+	.byte	0x7
+	.long	.LASF1287
+	.byte	0x1
+	.long	.LASF1288
+	.byte	0x2
+	.long	.LASF1289
+	.byte	0x2
+	.long	.LASF1290
+	.byte	0x2
+	.long	.LASF1291
+	.byte	0x4
+	.long	.LASF1292
+	.byte	0x4
+	.long	.LASF1293
+	.byte	0x3
+	.long	.LASF1294
+	.byte	0x3
+	.long	.LASF1295
+	.byte	0x5
+	.long	.LASF1296
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1080:
+	.string	"PG_OSD_CONFIG 501"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1209:
+	.string	"biquadFilterApply"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1134:
+	.string	"size_t"
+.LASF1016:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1181:
+	.string	"VOLTAGE_METER_ID_CELL_40"
+.LASF1189:
+	.string	"VOLTAGE_SENSOR_ADC_9V"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF982:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1058:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1019:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF522:
+	.string	"__flexarr []"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1021:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF380:
+	.string	"__unix 1"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF1163:
+	.string	"VOLTAGE_METER_ID_12V_10"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1192:
+	.string	"voltageSensorADCConfig_s"
+.LASF1196:
+	.string	"voltageSensorADCConfig_t"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1228:
+	.string	"pgResetFn_voltageSensorADCConfig"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1229:
+	.string	"instance"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF379:
+	.string	"linux 1"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF1088:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1119:
+	.string	"VBAT_LPF_FREQ 0.4f"
+.LASF1115:
+	.string	"ESC_SENSOR_COMBINED 255"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1017:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1216:
+	.string	"motorNumber"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1224:
+	.string	"config"
+.LASF1220:
+	.string	"state"
+.LASF1226:
+	.string	"rawSample"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF993:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF1038:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF1083:
+	.string	"PG_PID_CONFIG 504"
+.LASF1013:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF989:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF977:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1185:
+	.string	"unfiltered"
+.LASF1090:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1030:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1239:
+	.string	"voltageSensorADCConfig"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF976:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1231:
+	.string	"biquadFilterInitLPF"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1052:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1207:
+	.string	"voltageSensorADCConfig_Registry"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF546:
+	.string	"__always_inline"
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF1157:
+	.string	"VOLTAGE_METER_ID_5V_10"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1129:
+	.string	"long int"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF957:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1140:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF968:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1190:
+	.string	"VOLTAGE_SENSOR_ADC_5V"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1197:
+	.string	"voltageSensorADCConfig_SystemArray"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1082:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1121:
+	.string	"short unsigned int"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF962:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1141:
+	.string	"PGR_SIZE_MASK"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1015:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1187:
+	.string	"VOLTAGE_SENSOR_ADC_VBAT"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1193:
+	.string	"vbatscale"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF971:
+	.string	"Q12 (1 << 12)"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1238:
+	.string	"voltageAdcToVoltage"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF974:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1124:
+	.string	"signed char"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1131:
+	.string	"uint8_t"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1215:
+	.string	"voltageMeterESCReadMotor"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1217:
+	.string	"voltageMeterESCRefresh"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1077:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF1044:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1120:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1107:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1104:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1050:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1142:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1012:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1137:
+	.string	"_Bool"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF509:
+	.string	"__P(args) args"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1003:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF785:
+	.string	"NULL"
+.LASF1151:
+	.string	"VOLTAGE_METER_ID_NONE"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1206:
+	.string	"voltageMeterADCStates"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1068:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1099:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1075:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1161:
+	.string	"VOLTAGE_METER_ID_12V_1"
+.LASF1162:
+	.string	"VOLTAGE_METER_ID_12V_2"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF764:
+	.string	"__need_size_t "
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1127:
+	.string	"__uint16_t"
+.LASF984:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF981:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF766:
+	.string	"__size_t__ "
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF994:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1031:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1089:
+	.string	"PG_ADC_CONFIG 510"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1060:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1002:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1195:
+	.string	"vbatresdivmultiplier"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF997:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1056:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF784:
+	.string	"__need_size_t"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1067:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1027:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1199:
+	.string	"supportedVoltageMeterCount"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF975:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1066:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF400:
+	.string	"bool _Bool"
+.LASF983:
+	.string	"STR_HELPER(x) #x"
+.LASF1126:
+	.string	"__uint8_t"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1087:
+	.string	"PG_PWM_CONFIG 508"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1172:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_7"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1174:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_9"
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1139:
+	.string	"PGR_PGN_MASK"
+.LASF990:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1004:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1036:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1194:
+	.string	"vbatresdivval"
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1200:
+	.string	"voltageMeterIds"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1233:
+	.string	"index"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF992:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1155:
+	.string	"VOLTAGE_METER_ID_5V_1"
+.LASF1156:
+	.string	"VOLTAGE_METER_ID_5V_2"
+.LASF1029:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1221:
+	.string	"voltageMeterADCRead"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1213:
+	.string	"voltageMeterESCReadCombined"
+.LASF1111:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1159:
+	.string	"VOLTAGE_METER_ID_9V_2"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF969:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1023:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF1227:
+	.string	"filteredSample"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1148:
+	.string	"address"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF29:
+	.string	"_LP64 1"
+.LASF980:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF765:
+	.string	"__need_NULL "
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF960:
+	.string	"VERY_FAST_MATH "
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1211:
+	.string	"meter"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF995:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF978:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1028:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1055:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF1006:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1234:
+	.string	"voltageMeterReset"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1007:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF972:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1225:
+	.string	"channel"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1039:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF999:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1128:
+	.string	"__uint32_t"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1184:
+	.string	"filtered"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1093:
+	.string	"PG_VCD_CONFIG 514"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1065:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1022:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF1073:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF772:
+	.string	"__SIZE_T "
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF1160:
+	.string	"VOLTAGE_METER_ID_9V_10"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1118:
+	.string	"VBAT_RESDIVMULTIPLIER_DEFAULT 1"
+.LASF499:
+	.string	"__PMT"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF967:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1091:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF1008:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF991:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF1110:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF963:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF364:
+	.string	"__k8 1"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1037:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1232:
+	.string	"getVoltageMeterADC"
+.LASF1026:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1033:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1191:
+	.string	"voltageSensorADC_e"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1122:
+	.string	"unsigned int"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1114:
+	.string	"ESC_BATTERY_AGE_MAX 10"
+.LASF1020:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1100:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1113:
+	.string	"ESC_DATA_INVALID 255"
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF998:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF988:
+	.string	"BIT(x) (1 << (x))"
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1138:
+	.string	"pgn_t"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1146:
+	.string	"pgRegistry_s"
+.LASF1150:
+	.string	"pgRegistry_t"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF545:
+	.string	"__wur "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF402:
+	.string	"false 0"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1053:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF401:
+	.string	"true 1"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1204:
+	.string	"filter"
+.LASF881:
+	.string	"ACC "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF956:
+	.string	"sq(x) ((x)*(x))"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1035:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1188:
+	.string	"VOLTAGE_SENSOR_ADC_12V"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1097:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF958:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF1223:
+	.string	"voltageMeterADCRefresh"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF1051:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF885:
+	.string	"MAG "
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1145:
+	.string	"biquadFilter_s"
+.LASF1136:
+	.string	"biquadFilter_t"
+.LASF1070:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1130:
+	.string	"char"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1202:
+	.string	"voltageFiltered"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF813:
+	.string	"LED_STRIP "
+.LASF1042:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1043:
+	.string	"PG_RX_CONFIG 24"
+.LASF1024:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1081:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1011:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF1109:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1034:
+	.string	"PG_PID_PROFILE 14"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1212:
+	.string	"voltageMeterRead"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF1201:
+	.string	"voltageMeterADCState_s"
+.LASF1205:
+	.string	"voltageMeterADCState_t"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF879:
+	.string	"GYRO "
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1236:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF970:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF1143:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF1084:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF979:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1076:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1098:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1147:
+	.string	"size"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF1235:
+	.string	"_index"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF883:
+	.string	"BARO "
+.LASF393:
+	.string	"SITL 1"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1046:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1096:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1018:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1132:
+	.string	"uint16_t"
+.LASF1210:
+	.string	"adcGetChannel"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1123:
+	.string	"long unsigned int"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1048:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF1071:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1014:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF973:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF783:
+	.string	"__size_t "
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF822:
+	.string	"CMS "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1000:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1101:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF1063:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1045:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF787:
+	.string	"__need_NULL"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1208:
+	.string	"memset"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1105:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF1032:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1117:
+	.string	"VBAT_RESDIVVAL_DEFAULT 10"
+.LASF1108:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1179:
+	.string	"VOLTAGE_METER_ID_CELL_1"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF802:
+	.string	"USE_PPM "
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1061:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1057:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1230:
+	.string	"_reset_template_116"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF959:
+	.string	"FAST_MATH "
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF966:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1072:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1010:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF803:
+	.string	"USE_PWM "
+.LASF782:
+	.string	"_SIZET_ "
+.LASF1001:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF821:
+	.string	"GPS "
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1086:
+	.string	"PG_PPM_CONFIG 507"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF1149:
+	.string	"reset"
+.LASF897:
+	.string	"USE_PPM"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF1183:
+	.string	"voltageMeter_s"
+.LASF1186:
+	.string	"voltageMeter_t"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1059:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1009:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1049:
+	.string	"PG_GPS_CONFIG 30"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF1158:
+	.string	"VOLTAGE_METER_ID_9V_1"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1047:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1102:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1125:
+	.string	"short int"
+.LASF1237:
+	.string	"voltageMeterAdcChannelMap"
+.LASF1176:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_11"
+.LASF1177:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_12"
+.LASF1040:
+	.string	"PG_SERVO_MIXER 21"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1165:
+	.string	"VOLTAGE_METER_ID_ESC_COMBINED_10"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1005:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1175:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_10"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1203:
+	.string	"voltageUnfiltered"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1214:
+	.string	"voltageMeter"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF1182:
+	.string	"voltageMeterId_e"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1178:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_20"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1064:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF1054:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF949:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF801:
+	.string	"USE_CLI "
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1152:
+	.string	"VOLTAGE_METER_ID_BATTERY_1"
+.LASF1153:
+	.string	"VOLTAGE_METER_ID_BATTERY_2"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF996:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF1166:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_1"
+.LASF1167:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_2"
+.LASF1168:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_3"
+.LASF1169:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_4"
+.LASF1170:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_5"
+.LASF1171:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_6"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1173:
+	.string	"VOLTAGE_METER_ID_ESC_MOTOR_8"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF964:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF888:
+	.string	"USE_UART2 "
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1106:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1062:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1133:
+	.string	"uint32_t"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF987:
+	.string	"UNUSED(x) (void)(x)"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1103:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1079:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1041:
+	.string	"PG_IMU_CONFIG 22"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1069:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1094:
+	.string	"PG_VTX_CONFIG 515"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1198:
+	.string	"voltageMeterADCtoIDMap"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF961:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1164:
+	.string	"VOLTAGE_METER_ID_ESC_COMBINED_1"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF382:
+	.string	"unix 1"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1135:
+	.string	"float"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF985:
+	.string	"EXPAND_I(x) x"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1144:
+	.string	"pgResetFunc"
+.LASF1219:
+	.string	"voltageMeterADCInit"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1085:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1154:
+	.string	"VOLTAGE_METER_ID_BATTERY_10"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1025:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1074:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF965:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1180:
+	.string	"VOLTAGE_METER_ID_CELL_2"
+.LASF1095:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF1116:
+	.string	"VBAT_SCALE_DEFAULT 110"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF986:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1222:
+	.string	"adcChannel"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF898:
+	.string	"USE_PWM"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF377:
+	.string	"__linux 1"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1112:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1218:
+	.string	"voltageMeterESCInit"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1078:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF1092:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF929:
+	.string	"USE_PROFILE "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1291:
+	.string	"io_types.h"
+.LASF1286:
+	.string	"common_post.h"
+.LASF1273:
+	.string	"long-double.h"
+.LASF1281:
+	.string	"__locale_t.h"
+.LASF1283:
+	.string	"platform.h"
+.LASF1285:
+	.string	"target.h"
+.LASF1267:
+	.string	"libc-header-start.h"
+.LASF1265:
+	.string	"stdbool.h"
+.LASF1251:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF0:
+	.string	"./src/main/sensors/voltage.c"
+.LASF1241:
+	.string	"src/main/common"
+.LASF1279:
+	.string	"stdint-intn.h"
+.LASF1289:
+	.string	"axis.h"
+.LASF1250:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1253:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1274:
+	.string	"stubs.h"
+.LASF1245:
+	.string	"src/main/target/SITL"
+.LASF1271:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1260:
+	.string	"voltage.h"
+.LASF1249:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1259:
+	.string	"voltage_ids.h"
+.LASF1282:
+	.string	"strings.h"
+.LASF1269:
+	.string	"features-time64.h"
+.LASF1261:
+	.string	"voltage.c"
+.LASF1292:
+	.string	"system.h"
+.LASF1243:
+	.string	"src/main/drivers"
+.LASF1252:
+	.string	"/usr/include"
+.LASF1240:
+	.string	"src/main/build"
+.LASF1268:
+	.string	"features.h"
+.LASF1284:
+	.string	"common.h"
+.LASF1276:
+	.string	"typesizes.h"
+.LASF1280:
+	.string	"locale_t.h"
+.LASF1295:
+	.string	"esc_sensor.h"
+.LASF1242:
+	.string	"src/main/config"
+.LASF1277:
+	.string	"time64.h"
+.LASF1255:
+	.string	"stdint-uintn.h"
+.LASF1246:
+	.string	"src/main/target"
+.LASF1290:
+	.string	"utils.h"
+.LASF1288:
+	.string	"maths.h"
+.LASF1244:
+	.string	"src/main/sensors"
+.LASF1247:
+	.string	"src/main"
+.LASF1296:
+	.string	"time.h"
+.LASF1293:
+	.string	"parameter_group_ids.h"
+.LASF1278:
+	.string	"wchar.h"
+.LASF1294:
+	.string	"config_reset.h"
+.LASF1248:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1262:
+	.string	"string.h"
+.LASF1272:
+	.string	"cdefs.h"
+.LASF1266:
+	.string	"stdint.h"
+.LASF1287:
+	.string	"build_config.h"
+.LASF1256:
+	.string	"stddef.h"
+.LASF1275:
+	.string	"stubs-64.h"
+.LASF1270:
+	.string	"wordsize.h"
+.LASF1254:
+	.string	"types.h"
+.LASF1263:
+	.string	"adc.h"
+.LASF1258:
+	.string	"parameter_group.h"
+.LASF1264:
+	.string	"stdc-predef.h"
+.LASF1257:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375 \347\365\004"
+	.string	"\324\007\333"
+	.string	"\023"
+	.string	"\217\211\332\324\013\004\002"
+	.string	"\001\216\235\241\221\t\002\231\331\257\376\003\b\002\001\002\001\002\002\002\003\003\240\342\234\212\n\004\314\341\206\214\004\004\002\002\003\005\371\265\336\203\t"
+	.string	"\006\360\262\252\346\013\n\002\004\001\007\b\333\326\241\250\n\t\362\335\256\306\004"
+	.string	"\n\274\205\242\255\006"
+	.string	"\013\f\357\313\212\236\006\r\016\244\310\245\335\004\017\314\251\277\367\n\020\272\253\206o\021\242\302\263\302\013\022\314\251\277\367\n"
+	.string	"\f"
+	.ascii	"A\213\252C^3\350B5\324+L\250\225\0200\356\234\205<\357\277BX"
+	.ascii	"n\240\r`\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375 mE\002"
+	.string	"\224\002a"
+	.string	"\f"
+	.string	"\001\001\002\004\005\003\006\b\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\t"
+	.string	"\001\n"
+	.string	"\001\013"
+	.string	"\001\f\001\r\016\002\001\001\001\201\004"
+	.string	""
+	.string	"\001"
+	.string	"\r"
+	.string	"\270"
+	.ascii	" \240\3120pb\247\231\234\031`\007P\203\34020\204\312\340\227"
+	.ascii	"06\200\005"
+	.text
+	.section	.gnu.lto_.inline.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`N\001\205\007"
+	.string	"b\214$)\200)I\007V =\260\330\230\200\204\027\b(\"\260\f\374\364h\001\031Sn\0241\233\340x\240\2775\333\332n\204\220-w\n\277p\330\347\025\375\342\305\202FD \217\036\200~\254\375\366`\330\205\177\261\204\204U\370\036\021\210\2032@\303(\226\267OM\234\2765\232\225\377\263:\367'\007U\306\215\271\027\216oN\343 2s\240\177\b\225\310L\201\023Cf6|R72h\213>\370\352zr\257jffzF\261?\252m\033\343\326Z+y\346\022\004' \200\002\021\273\262\003\334 "
+	.ascii	"\025\275\b\001h\221\034\201XsD\036!\221\314\221\224\247\027\260"
+	.ascii	"\242\245\303`\327\r\020\001\337=\303\220m\271a\212pi\245\272"
+	.ascii	"$\342\f6\224\267\363\312\302\316\b\023\315\341l\206}\271\261"
+	.ascii	"1\204\273\3319%p;\3556\272n\230\327P#_\035Z1\207"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\345\005"
+	.string	"\022J (\200)I\007s\005hTX\361\301X\031X\255~D7p\007\037\2171\022\017\250\203\016yE\374\206\254mv\023\262e\222\001$\257\177\250\325C\004\002\252ge\362MH"
+	.string	"\362\241(\023\303J\203-\020\252y\252yN\260\213\031\262\017\f\343@\320+\236b\247\214tT\257\321\033\370\"d\301\355\275\330/\326\331P\344\240\2213\271\304\023\n<\202\013\f\035\342\204f\206\235\n\221f\tUS\257\236\t?\b\027"
+	.string	"G\220\373\331\270$\326\004p\202\246-\313\037\240\"\241c\r"
+	.string	"\354\325*.\214q#\214V\274 0\034\2610\337L\340\335\331\005\332d\264\260"
+	.string	"\b\006\246\251\\Y"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\002\232\004\004\232\004\005\200\004\006\232\004\b\232"
+	.ascii	"\004\t\270\004\n\200\004\013\200\004\f\232\004\r\232\004\016"
+	.ascii	"\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`\031"
+	.string	"\265\003"
+	.string	"\302\304\016\027\260'\035\200$y\220\230S$\355\340\256\206#\2150\246\326\204`)S\027\306A"
+	.string	"?[U\"[\204\220\363\035M\253P\256\362\256\374\255\347|(WMe\237\261'\023~6\317 \030"
+	.ascii	" \204f6\030:\314\304\264\003\203\301 \346\200\212G8B\220\312"
+	.ascii	"\001\2647\fP\233\300l\267\316\f\323D]\326S\206]\351\002e`g\307"
+	.ascii	"\316\301\272\314^F\036@\021"
+	.text
+	.section	.gnu.lto_.lto.d9422d2a6bc84128,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_voltageMeterReset.15.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`n"
+	.string	"m\t"
+	.string	"v\222C<@\345\2501"
+	.string	"\324\365\365\304\t\363J\200:\230\2434\332\026oL\367\277\222\277\356\256\205f\333\005\201\302a\017b]\324.Z:\206\024\304\247\335\347a\253$a4\234\345\tZI\266L)/"
+	.string	"0"
+	.string	"1"
+	.string	">\340<7\366p\236\025[\001\036]\267\214$dF\340\177\267\231X\264\024k\307\\\260b\245,\t&\376W\256X#\356\346\266\fm)\332\026\b\335Z\255a\266\234\034LF\001\300/R;p\332\204Ai\353\326\243\330r\332N\n\204\245c\365\212_\242a(\033\374\255\230\227\177th\303\306\263c\265\314\355\206g\t/\237\270\266\303-\247\315\377\210\232\305\343\243\343\372\357\023\317\032\305y\"\004\030\240\222\265J\027\225\231K\003\355\230\222[Ik\315\377\007\r\211,@ \211\207\320\307\003z&\2174;\372x\027\"S\306\307\321\205\340\027\226\274\260+a\210H\335\b\f\273\317B?\r\017\354L\337\007v\234\361\326|k\265\"FSm \001\n"
+	.ascii	"A\263\240Lh\013\007\206\013\366)z\3401\252\no\320e\"\270s\213"
+	.ascii	"v>\001"
+	.text
+	.section	.gnu.lto_getVoltageMeterADC.17.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\345\t"
+	.string	"\366\022F<\020\005+\035\020\237\200*\306\324*\354\b\340\241#Z- k6lRI\221\345\330#\310\342\230\337+\002FrRI\370\252\252\252?\202\332\336\276\334\341\2537\035\306l\213\3376\331;\2453"
+	.string	"3"
+	.string	"4"
+	.string	"\036\007\312[-\344\0013c\301\331-=\227\027\350\274~.\352\274R\220\217\237\243\377\223w#\0335$-\366\351Y\330]O\222V\273\351m\033\330f\260}\023\236\246\307\375\223N\277zHfF1\273\0309"
+	.string	"+S]Dl\303l\220\035\240Q\242\323.)\300\216\2530\335\345\260i\331-\021|\360y\265\355\227\334\004\026+c\350F\332\266\270JD\301mwQ(O\021\375\220WK\274\346\311W\377EOCfLz\332\275\314\002\310f\316\240\216\2359v\031\233\364\303~\267\324f\007>\245V&\023*\341D\022Q|\253\026\253ZE\372\032R.\007p\302\023CPl}\242\327b\245\036<U(z\244\221A\210/\364\\ \030z\240r\337-\265QJ \243\027\366\003\f"
+	.ascii	"A\263\240\314\320:\201\365>\276\256\t\305&X\351\205\376\022\230"
+	.ascii	"k8)\026/\335!\214\351\232d"
+	.text
+	.section	.gnu.lto_voltageSensorADCConfig_Registry.20.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375 \210\375\003"
+	.string	"\024\007Q"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\202\200\200\374\342\303\357\241\037\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\356\006us"
+	.string	"\005\001\006'\001\003\202\002(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/sensors/voltage.c"
+	.string	"\004"
+	.ascii	"L\005N\271)E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_voltageSensorADCConfig.21.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`\234\001\375\017"
+	.string	"\326\235jF\340\222*\035\300\242\236\375^_\304\321\202\035\2365\314\362\b\326Y\200\223\303W\272*\247\203s\321Y\205-\344\206\240\220T\246WR\\\325]d\230a\336!\303\222\177u6xS\034)\006 \202\351X\243E{o\231RR"
+	.string	"V"
+	.string	"V"
+	.string	"\337\tt>\273\213t>\375\262y\374;\261\007kTlAv\327\213&\374\313\357\226\372\372\224Q_\276\247$s\004$n2\032\354S\206vW"
+	.ascii	"\215\203\f\351\214\206\2422\305\312\343k\037a\301\311h+WOiw\255"
+	.ascii	"2\232\210\273s\333,\333\020\354\323\b\363\340\255W\337\343\001"
+	.ascii	"\202\343\300m\027D\316\220\235\2313P\250\036\004\335\220|\233"
+	.ascii	"\375\001\331\220\374\317\257\371\363\t\332Ar\361\027\257\203"
+	.ascii	"\256\321\301Bt!h\323cwI>\375\240\373\f\311\177l\020\216t\265"
+	.ascii	"\317\342-^\217\331P`\300\246\200\036d\354~\n,\352>\035\341-\200"
+	.ascii	"\212\017\032?|\214\023y\230\303\310`As9v;\\\366\351\207\032N"
+	.ascii	"|\030\037C\3473An6b\306\307\221\234\354GLs\f`E\313\332\376\017"
+	.ascii	"\241\215\030M\362\203oP\"\2468~\355RE\213\2067\232U\034\373\203"
+	.ascii	"i|\261\257\273\013st\261\037\363\007\251\333\304\024\241\244"
+	.ascii	"\204\301\002\223\221\b\352\2442\271Z\252T\347\323\b%\301\344"
+	.ascii	"\232\260\272\340\265X\253\226\n\325\362T)\023\005\357\304jy#"
+	.ascii	"\003^U@\261<\327j\305\362>\337>\272X\346]x3\023\213(3\276\330"
+	.ascii	"s#\212\036u\350\314\032\035\324\244\250\020\\,\305\024\347rw"
+	.ascii	"W\212Bg\t# \200\0021V\345\001t\026\024\004\374gHS\356)\263\211"
+	.ascii	"5\254\262\331\305\255:\354I<\003\372\204\217\275\275\222\214"
+	.ascii	"M2k\213sAj!\227@\257\267\205\301N1g\227\3510\001[\276\b\356\335"
+	.ascii	"\357Z\311\305\245!\002\033\354\354m\007|P\356\\\347\t"
+	.text
+	.section	.gnu.lto_voltageMeterADCRefresh.24.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375` \b\245,"
+	.string	"zL\330\020E`\034R:k\345\272\307\363\300RC~\\\212\255Q\367\321\351\363\303J\225\232B\250M\236'\252\3346\235\277\203\242pAZm\370%\026\253\013\215\004vd\360\264:\b\267\231jy\032}x\264\362m#\261r'\031\366"
+	.string	"\353"
+	.string	"\374"
+	.ascii	"/\0234\366\304\273\367\006\231\031\331\273n\267\347\204\211\033"
+	.ascii	"\232\323\323\240.D\325\236\f?\314\305\300\370\030\206\333p\223"
+	.ascii	"a\n\220\020\371\222c\360\224_\374\236\016{u\210|,|-o;\227{\371"
+	.ascii	"\233\335\027\2550\346\023h\213\337\323 \236\333\273 \357\234"
+	.ascii	"\361\253\344\001\374\301\204\"\365{\312j?!\327\026\346\025h\t"
+	.ascii	"\035lf!~O\205A\256\366,\310\257\321\030&\211n\227\027Z\224\013"
+	.ascii	"\277\247D?R\237\332\033\251O\203uD>\032?\215\203O\203n\210\017"
+	.ascii	"$ \337\254\361\273Q|\316\266&\320{\325\234\236\362\202\337\323"
+	.ascii	"\0162\222\331\316\325\310\356\333\312\276\332\360\356\275O\275"
+	.ascii	"\204{\026\371\264\327\026\311\367A\235\375\200\223\347\022l\353"
+	.ascii	"iox\357\025\002\363\352\r-\0160.\333\223\"\366~\332\0250\231"
+	.ascii	"[\202\211\335\372\240\356\275l\227`ag\365\314\254\202\231\201"
+	.ascii	"0\377\220\002\316\271\273\321\262_r\203\327\025\371N\214\366"
+	.ascii	"\313\247\377\362\367x\373s8\343\272\233\3115\3247/\342H"
+	.string	"\322\346\361\323\336\2432f\235\317\272k\363\230\325\270l3\231o\357\275[\334I\230\203\226\233V\313\303\325\262\001\241e\246\325\362\322j\271\200j\231\200jy\200\320\262\322j9i\265,`\265\214\264Z>\022Z\016\260Z6\nZ\006\260Z.Z-\023\255\226\207V\313B\253\345\240\325\362\372\2653\360lg\337\233\347\006Z\266@\313?\020\024k\243\340y\357\216\350\237K\227\222\201\362\265\237\355o\276\231?\027w9\340\332\033+6I\355\206\361\370\032+4W\003\034\233K\003\305e\203\203\033\261\355\323X\3359\003\305=\017;L!\f\236>\317\034{\227\314B[\231\020\355i\3653G\020\277!^B\240\367\2621\360q8+f\030\007\303\001g8u@\023h\245;\245\036\200\304\362\274\250~\342\247\217R\377Y\226f$\357\tT\001\235\324\352\235\262H\323\023\250H-\240\325\267\2436j\244n;\345\024.\033\345"
+	.ascii	"}\324g\013\277\213\362 \206W\004\355\336\256\tz\360<\317\f\365"
+	.ascii	"i\200F@'\r\330F}@_\201\276\346\253\263\251\346\027sRq\223\346"
+	.ascii	"\366y\206\212\002\373k\037&\033\330\026N)\307d\337|h\206\333"
+	.ascii	"\371\035\rl\307\241\203\375\322\366\320\253\267\272\027\247\204"
+	.ascii	"&m\224\205\316>\276>\333\207J\326\351\314\037B\330/}]\343HWo"
+	.ascii	"\261\320yWw\243\324oyT\236\2727\277\363\303\344\333\203dp\320"
+	.ascii	">\320$\235\023\026\016\331\362f\230\027|\216\210.\032\003F\313"
+	.ascii	"\035\264{/\2058\2273\202D\t\373e\t\365)\233\340\023\357\352\255"
+	.ascii	"}\231\203\326\200;\370X\371\214\3352/\342\2434\333\321\314\343"
+	.ascii	"\364\223\371\341\204\001RWX\315,d\030STM\235P\215Y\305,\254t"
+	.ascii	"\305\224\212\252\243\224Je\254\252*\262\220\362i\025\257\200"
+	.ascii	"F\252\027.\212Q)\214W\306,\252)\025B\034\241\230\002\002\004"
+	.ascii	"\n\016\"\020\215\246\316RD\343\212b\026\3251\306\023\326\325"
+	.ascii	"\021\253\312\210\365T5Ut\361$u\205\365D\\\342\343\013\343\325"
+	.ascii	"S\326\361x\365\024TK\276\223\360\331\177^|\320%\233\213\323f"
+	.ascii	"r\0055m\227O\231X\034L\367n\ft\272\254\237\350X\367\233\357\335"
+	.ascii	"{o\257\231\303\242=\316'\200*\366\006\215\256{c\305\306\027\362"
+	.ascii	"\f.\216\215\022\034`E\r\200\250\213\206\232\210\317\205z\350"
+	.ascii	"{\036\324Bk\007\371z\235\223\213c\343\005\254\251\231\221W\254"
+	.ascii	"\027\215\256\233\233\300\314\013lWq\b\317\323\212MZ."
+	.string	"\344\231V\333\022O\322F\317\\F\351\206\335\324K=\354\2456\245\031S\033h\332\033\325s\242\201\230\372z\312\322\ntR/u\222\235\322\214@\0270\020\r\200\244\250a,\345\230q\310\320\314\310HR\220\264\006p\002\021\242\262\352\0210\265d\252f\024&\205\302\326\001\260\242T\rS\205\243\202\332\267\311\221\227\266\310r\003J\302\237\"j'\326p\305\244\210\241\264#\353\356H\235\003\346\235\355y\262\013g*m\021/\016\346\303\376B\301%\306\212\005\362RY\027\301!\237h\001L\244\274!\300#\2756\2001\226\221\351?T@\245\020FNp\260H\344!\344\371Dv~\271\013\364\210B\332}\276X5?\037\022\336(\350\t\364\246\007\274\035\321\370X\3728L\353h\267\220r\016*?L#w(\225[\375\346\246\361\bF\f\370M\310n\343Y\032/\037\305]s\340\271 \312f\255\034\355\365\264\342\261L8"
+	.string	"\237\bt\355"
+	.string	"\301\315\372\247P+\252\002\272\353\005\355\204\023\001\204\205\265\260\016\202\222\022\207E\f\303\310\2224v\264\260\235\343\254 \204d\312\347fYVA\321\005\200\256\330Mj\344\263\333\210\035>\006\377\332T"
+	.ascii	"{;\031x\202c\2346nP%t\2243\244s-#\031Y\342\211\3033[\211i\375"
+	.ascii	"A\033\306@LmtK\241\375\254\317\035\340\240\316\240\344i\225}"
+	.ascii	"\363\375(\370\372M\275<\276\272\346Q\247Ey[\371\237\356|\370"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_voltageMeterADCRead.25.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`\304\001=\020"
+	.string	"\306\335lI\340\262(\035@\301\242vI\023\2132\242J&\206\222\b\030}\210\311\355\tAO\237\003"
+	.string	".\354V\214@n\026\24173\253\304S\254\351\200Hm\214\203 \237!\b"
+	.string	"\356\355\021N\367\2609N\220\032\013\225\322j\333d\357\224\002S"
+	.string	"R"
+	.string	"]"
+	.string	"\004\366\345\206D\212\350\325\245\250\263)}\036\206\037\373\013\362\262\016\036\355\242\340\261\263[:\260\211\350\265\344\006B\257\334IB\257&\355 /U\354i6\0204\240\335\365h\212\223\237\244\177\332G\257\030\227O"
+	.string	"\022v\327\363\025#\342\246\267\255\300\266\005{\232\002\256\031\344Y+\321\2633\310.]&\235\261\317\355\356\232\312\330\237\375\365\262\237r\323\223\233\276\250\263\351a\"d\027\346\210\221\345\251\267\025\266o?\207\354:[\311>\r\207\365\375\020b\0043\2433d\267l\360\352\n\356\312\322\234\277\361\313\307 ?k\035\b7P\242\337\306\225\0024\255\320+\365\361\"b\263|\0075\252\371\201\355n\004\033\251\0015?`5\256\303\n\275\236."
+	.string	"\"s\315#\2365\026={\234\227<\3475V\002\237\227m\016\247\221j\215\200\231\210\355\256I\306g\204>\315\2533\210\363\257W_\324`\326_\270\231\315'\366\240u\"\340\370\215b]\201#HA\200Q>\225\223\023\023\004\024\022I\013\250R}\027&\234T\276"
+	.ascii	">\221\300\225ol\t7x\342*\024U\240\350\251X\276\224wZ\211\036"
+	.ascii	"\t\201C\f\340\312\033\303p\345u\345\236[*\343\024\027<.\352\301"
+	.ascii	"\223\332\337w\320\"\247\353@\215n?@9pL\312\240\005\265\301\007"
+	.ascii	"\" p\202\241\262\365\247\354-UP\024\372!\201aPSh\343\213irw\337"
+	.ascii	"\310\341\335z\344\255\246\263\302\006#&\fU\351\226\210\301\002"
+	.ascii	"\nf2\245\303\004J,\266\300\332KH\234!\254?\233\bqj\332\005V@"
+	.ascii	"\f\344\004_\266\002\222\274\270\026\031"
+	.text
+	.section	.gnu.lto_voltageMeterADCInit.26.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`\343\001\355\020"
+	.string	"V^mH\340\264&\035\240|\207\271b\274\351X\b\360\305Y\333\251\373\323\210M\343F\211\274\262\302\002j\256!\364\333S\264\255\245`\030\206\302\326\245\"S\f\3061\303R\002\301\353\025\217\001\022W\021"
+	.string	"\307\202\r\032%\244\221\275\367N)W"
+	.string	"U"
+	.string	"Y"
+	.string	"\333B\304#\373AdWDy\365\201\355\365\234U\266\220\213'\366\262\037\0172#\273\373M\023\246R\365J\247T\371\242Q\316\013\254\030r\275V\257\264\333\335\222W\007\332\311\231W\214\244.l>\037\373\211\212!\327\313\346R4\332]K\327\253\346\326n\233\202\355\b\266<\ta\320\312\231-\256\344\204\331\227\273\273\362\304\261\037\336\327\270\037 \b\206\354\202H\202d\201\352\r\026\017\177\373\334\b\317\217\341\357\230\343H\\\274\f\325u^\276\255\020"
+	.ascii	"j`B\017\266W\213\037\240\275n7\321^9\032\317\207\341\307\314"
+	.ascii	"\275r\037\274\005\fT\017a\266a\211\234-\237\2274\367"
+	.string	"\334Rf\227e\300\267\301\362\236\373\230\350\035D\253\320\302\355\330dw\367\320P\356\217<6\006\260k\315\225\003\214:\202\374\032/\362.'8\215\f~\212Wo\340 \357z\275\316/b\347\247\031q\3149a0\332\303K(\301\2223?v\372\342F\216\001\245\024)\005V\253\220&\244\2444P\240\342\231\230\356\025\257\304BJY8i\370@\324\tt)\201\237\213\211\324\362\255\240\300\317#\340\323\205\022\352K\235N\250\217\023\367\023\3079\337F\037@\254\031\343:av\300c>\307+\n9\343\031\377\204 $#\217\320$7;G,9;\245\023\326\t(2\006+ P\202A,m\007\005\253HC\373';^$d\353\267\303R;S\243$\2731b\372\2201xs\260\026\246\301\304d\246\2769\214\241:\3465X\032\300\351\002\316\027\326\272Iv\243B\220|\304Zn\001K{#kDqkh}\272\201"
+	.ascii	"\357J\217\236)c<W\204\314\260Uv\226\265\243|\211t\256\367\004"
+	.text
+	.section	.gnu.lto_voltageMeterESCInit.27.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375 \307}\005"
+	.string	"\002\n&0pU\323\001"
+	.string	"\240\214g\005\300"
+	.string	"\310\340\t\214\305\332I;\277q\214\230@\215\214\332N\375v@4BU\325E\367\312T\367\353\034#\267vo\231\002\256&\013Be\222I\221\225\316\212YUb\021\352\222\025\255rJxN,*\2639\251\224\276o\364\024\225h\361\342\260\300\3766\0307\366\022\376\337\321\263!\002$\340\030\375\230\003\203\007\024"
+	.string	"<\266W\262f\017\354\327\371\2124\227\020\301\177\0319\253-\324\274\373\331\003\327m\013\r\217\377\206\\\227Y\307\265\315\260\335\260}\005\007"
+	.ascii	"3\003\366\231\301\300\367\323e\374\313\270\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_voltageMeterESCRefresh.28.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375 \307u\005"
+	.string	"\002\312%/pU\323\001"
+	.string	"\240\214g\005@\0334\302\005\305b\303!\373\267T \033\266\221Q\333\251\337\016\210F\250\252\372\267\340J\005_"
+	.string	"\307\310\255\335[\246\246\244\n2a\222I\221\225\316zUU^\221\311\222\024\255RJxN**\2619\251\214\276o\354\024\225h\361\342\260\300\3764\0305\366\022\376\337\261\263!\002@\300\001\3721\007\006\017(\2048\2667rf\017\354\347}?\336\305C\360_\306\315f\0133\357v\366\260q\332B\303\343\277\341\306e\326qm3l7l[\001\007"
+	.ascii	"3\003\366\231\301\300\367\323e\374\313\270\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadMotor.29.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`:\001\215\016"
+	.string	"\346\031aF\340\026'\035P\314\307Il\200\007\201\222\002,\330P\373\302\241\327\r\270\023pF\002\2773\006)\220 \"\203\034\366\326O\320\272\210X6\234\003\313\022\023\2031\344g\025\305\313\f\370\n\3205"
+	.string	"m2-\243\335\366N)H"
+	.string	"P"
+	.string	"L"
+	.ascii	"\340\r`\237\241\247`\237\242\"\245\030m\b\021\274\343\230\260"
+	.ascii	"\334u\021dg\027t\340\006\241O{\366\222\2036\373\260F\212V\317"
+	.ascii	"\356j\022\306\275G\317\177\316\003\304\310\234x\004"
+	.string	"\320\262\273\216123\267\274\355\005\2669\330\227\021\023\206\354\262\370\211\262<S\310\f\237\365\020\365\034\276\013\203\221\354-\235T\213J\305\202|\334\350`\3609Z\225d|\013u\235\224\n\2703_\321\020\301\351\371\364\206\263Pv\366\371\314\026))\311h\377\306qx\007S*\005\026\005k\005\205\320\247\003\177\350\372\037\b\242\313\206\317a\017=\342<\270\221\315\356J\360w\224\200\361c\244\260\317\003I\234|\361\307\017/r\335\334u\r4V\257&\362\255+\370\242\217\007@\211@^H6\372\330\240*\312\027\366A+k\354\203\177\234\004Z\034\t\033\355\350in\264\243\025\004\230\305\344ae\245\364\200\205\224\262\321\016'\030\013[\355\352)\263\013\211~0u!*\t\215\333*\367B9\355\005\204\351\244\271l\234FJ\340*\202nZW\353\246e\340w\320\312\032_\240\341\371\244\352\317y\206';/&_\217\035"
+	.string	"7\263?\235\005eB\307\322\300x\030\260\005\372B\300MM6\025\272\2546\3364\013"
+	.ascii	"%\221\346\315\2256]\030[X\206\177\354\231hq\367&B\326p\026\034"
+	.ascii	"\032J\220\254\247\300`\204\252\035\260\320\206\233B\r\256\345"
+	.ascii	"\2050\311"
+	.text
+	.section	.gnu.lto_voltageMeterESCReadCombined.30.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`\n\001M\r"
+	.string	"&XYE"
+	.string	"q\234\016\240\231\315L6\024\034\355m\237\255\231\207U_\2655\310^\357\221\371\201\377o|RhSH\\\343\352p@q\362\302N6P\353qY\377)\236\217Y\236Ly\247\340\324\003\022<\306\030\271\266\355\224\002B"
+	.string	"F"
+	.string	"E"
+	.ascii	"\255\361\"\342\007\354\256p\310\3305\033\230\301\345\325\346"
+	.ascii	"\th\257\227k\264W\217\266"
+	.string	"\216\233 \373\023\030!N\225\335\3452\024\037OG\377#\007\200J\2018\375\370\354\256)*\245\272\263\333V`{\202\375\021\001\264\n(kD\210\355\222\210\365X\224:C\205O\362\323\336l\272\351\233P\310\261\335U\"~N\"\326\362\242LY\360\232ayN\3572\275D<`\256\352,\0234J\225W\203Nb\262\267\327o6\346\3459\265_>wa\200\276Z~I\373i\016gQ\312\200\354\356\003\377\344\203\007?\205\250\275\026\270\301\203\2441\377<\346\265\342&\267\020\302Z\331\261\331]O@R\230i\214\020\033Ka\266y\242\331\t\373\226\335]g+\373\"\177_\027v\243\352N\350\002\207\003\301Ag\243\371\272\260\003\005\260h\323a\b\205\032\274\016\034\370y \251\0039R\206\320\210\023} \267A`oC\367q\241\347}\334f\222\267l\266\262\204\026\n\231\235\376\221W\200\225XI![\374\247\301\031"
+	.ascii	";K\231K\026\031{\215\324\032n;k\206\276`qS\223M\205.\253\215"
+	.ascii	"\033\315\002A\211\324\022n]\206\374\t\340\371\020\004\2738\013"
+	.ascii	"\211\206jHV\242\254\nBU\234ou\005\\\313\013a\222\001"
+	.text
+	.section	.gnu.lto_voltageMeterRead.32.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`\327\001\265\021"
+	.string	"f!xI\300\324M:"
+	.string	"\237\314\360\355\b\21062\231\376\3213\351\330Ap\370\365p\243\234O0\262\006\200 !\"\365\177\366\3138:\207\005&\353^\203\314`\262K\020\202t\373\2115\271\244%\237)uR\275\001Fm\242\311&{\247\024a"
+	.string	"b"
+	.string	"b"
+	.ascii	"\342\213l\f`w\005\323\216\335\261\201\031x\257)ou\257\334Q\272"
+	.ascii	"W\213v\221\217@{\033\"@ I\355\356G]\\|\345\350\024}\362\002\202"
+	.ascii	"\334\274\276\374\211\022\371\343\306\214\347\234\307s\312)\240"
+	.ascii	"\365(\021`\206\303\265\234X\0209\371\031b&\233\263\244ew"
+	.string	"=uf;ww\333\026lO\260g\2022h'\202FP!\343\222\250\242\332\246\312\003\206\217\364\222\346G~\222\201\026B\264\241\335e\275\332\276\255E\226\263\034\216\362i\301\253I\315Fs\243\232\002\343\356\274\326\3034$\365\352#\321\330\254\327\373G\242\315\262WA\337\234'\375\3615\304\033\325\374d\327\207J\202\367\352\321[\241\370>O\303\037:QOGb\263\312/\277\262\315\360\361\244W\210Q\273\031\241\364\266\247\304\346\224\301\236\332-j\347\022\022'\025\\\311\244\324\206q\230\3271Go|\352\30163\007'\305\356:\230\177\241Ck\242\364gu\233\356\364\0029\004g&qk\006u\213\3329e\217\262I\177\354s\273\273\246>\366\215~\372\242\377\036\202/p\006tU\263\270\300\254\254Dx\300\242\202\002\0233\375\242\002bp\231\321\020v\370`\257\020&\003\302>\231\030\027\327\367\362\202}*\007\034n"
+	.ascii	"_\337L\030\276>\326\030;\267\324\307\024L4\305\250\354'\357\001"
+	.ascii	"\351\251\335\240b\225\376(\375\245c\276D`\332\210|W\367\322\031"
+	.ascii	"\256\303e\002\264\273\020\374\034\037B_\250\246{\035\020\" `"
+	.ascii	"\2021\303J\036\016\253\"&^\220\214\206bC\265\300\247\315cB\213"
+	.ascii	"\333\311&\350\262o\f\205\326>\033\311X\200\2030b\307K\0253\306"
+	.ascii	"!\r\327\240\016\263\207\214\025\226\025\307\3561\301\242\325"
+	.ascii	"@W\201C\250\t>\2202\273\271\311\034\203\276\211\306 \240"
+	.text
+	.section	.gnu.lto__reset_template_116.0.33.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375 /M\001"
+	.string	"\370\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001\n\356"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"@D\312-\003(\002"
+	.text
+	.section	.gnu.lto_voltageMeterRead.part.0.43.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`\017\004\225\032"
+	.string	"6.\243I\260\032Q:p"
+	.string	"Y\263\037-+5\027S\252$jh\343\373b\n%\270\031\311\274\376U\204\237)4\031nC\216H[\036\352\310\330\266\244)\316l\022f\345\003\277V\347\237\240\351\313\2414\275\267\325\230:\233\034v\223\275\223\f\210"
+	.string	"\216"
+	.string	"\213"
+	.ascii	"?\335=A\345\243e\353\237\360\233\334\211\355D9\234\352\006\222"
+	.ascii	"\372\270\203\370\273\n+s\355L"
+	.string	"h\t\320\326\301\243\"\322\252\365(_\311\227\330\316\204v\002\335@h|\335\250\204_\216 \3762z\004\250_\361\006P\277\314O\302\3145\036\2661\2179:\244\017\345F\215'\301\356f\375Z!\267\335\326\320\306\337\375\200\027'KE9f\334^\351\005\304\350,\025\345\350y-\360\020\200\206\356fq\307\371\236\23130s\n\346\360Dg>\177\312S\276\022\217\\\343\030\225'\331\035=\034R\225\021E\252\202\032\272i!!\376\036\031\225a\357:\274\355~#\222\226X\177\024\273Qy\0361)\250\007\f!N\211\361}c\257\305|_\354R\314\260{\240\255C\306\r\310\037\304Ga\036\031\347P\370=\005An?r\335=\376\3624\350\330\350\260\267\373\345\202\002\204x8\027\362Is\301\"\034\346\361\272\032\177\307#3\327N\224S=\364\311\003\302/_gc\036\177cpN\265A#K\357\362\324D\375\3366"
+	.ascii	"\263\344\254i\270\362\214<\375\312\312\267\230\f~\335\347w\236"
+	.ascii	"2\377\312\265\2204\0368\fX\236E\005\377\366\3137,\352wX\240\314"
+	.ascii	"\323\b\233\364~\271 \355\347T\272\212\347\203K']\204\022\352"
+	.ascii	"d\246\353\023W{\244\257\370%\352G_\235\273\213L=\355T\246\253"
+	.ascii	"\r\262\362\353^\353\023\237\350\274\341\254OlC\033\304\374\260"
+	.ascii	"-\020s\252\262=\372\327T\345\003x\020e\300\217n\034i\320\364"
+	.ascii	"\3175*r\335\0032rF\202\b\320\202\204\301\\+8\274l\\*r\346\232"
+	.ascii	"\231\327\346\246\262\005\227M\205\n\030(X\2501 #g\244\213\313"
+	.ascii	"\257\032R\205k\326\242\204\3012e\245\t#M\026\354\306\345\202"
+	.ascii	"\365\222\231\254\232\005\\\276 e\254YY\312X\365a[\240\353\343"
+	.ascii	"s\002\236V\347\357\351 \360\254O\367\021r\002\236\326\2168\031"
+	.ascii	"{\246\304\305\274RFM\301\2460\326:8b\237\262\211\203y\035\370"
+	.ascii	"\361\1772P\360o4\324\257e\332)\363\224]\367\362J\r5\341\272\373"
+	.ascii	"\302Sf\"\007\f}\301\005X\250Q0\307\2201J\251\231\221 \2430i1"
+	.ascii	"p\002\021\"4n\020X74\224T:\2571\001\341j\361>w$.\263e\312b\025"
+	.ascii	"t4\022.\334Z\342c\t\221\337\257\311\366\2656;\343\367U\337\311"
+	.ascii	"\253\367\001\r$\355\375\250\247\231\037av\354\233\017\332*AN"
+	.ascii	"\b\273lh\260\037\313\2558\016v\301c<\235M\232-j\243\262\350&"
+	.ascii	"\341\340J%UD*\212p{\245\272d\035#-*8\333\264h\364r\331\367\322"
+	.ascii	"h\331\337\273r\2500\256*\3022g\003\340s\313S\302\325\024\n\211"
+	.ascii	".\245HT\016\230j!+\326\013\370\206\017\2676\350\267\332z\013"
+	.ascii	"}\214\271s7{\277X\013Lz\200d4\337\n~"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`\026\001\255\007"
+	.string	"\002K*1pi\323\001\374\237\265\n\327\017O\216\375_\341\177h\353\266\234\353\370]\274\036"
+	.string	""
+	.string	"p\225 \376\377\277\333\354\377\333JMDF\004h\002\335zK\231\002N\230Y\0211\221\241\221s(\254\307\245\306\365\270"
+	.string	"\312qP\254\034gp\313\345\027\313)i\333\3266*\257$E`\022=\373!\343\320\260\200Q\310$`\030\020\234\021b\253\236\246=\311\267\310%\220G\036\2078\376\320\354\016\354Y\301\364\256c\326%\335M\365\001\265\006\"x\266\267\2050Z"
+	.string	"\354\356R?Pgg\334i\362\340\305\306\276\215!\221\272\273\032\351\226\332\326)\036"
+	.string	"`h0\210+k\2275\fP\017"
+	.ascii	"\016\0370\177\264p\212\n\206\313\217e4\202fL3\203\003\264\003"
+	.ascii	"\237\003\237\333\371\034\213\277\314\025=\340\017*\344\201\001"
+	.ascii	"\334A\316\316\027x=r\204\013\203\323\214\n\037Q\024\332`\342"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.refs.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375 O\275\001"
+	.string	"\362\304\f\021\220+\035\277\272\352\357\330\260\320!Dn(\345N\001\277N\330\207\273\334\331\206_\334l\204\364A\332\350\027}\242?p\245L\256\350\200\017\360\355\322\323\237\004"
+	.text
+	.section	.gnu.lto_.decls.d9422d2a6bc84128,"e",@progbits
+	.string	"(\265/\375`\222\035\215\212"
+	.ascii	"\n\344L2R0\022JJ\007\276\366C0\273\\\244\030\223\324^\036\210"
+	.ascii	"*\021\312\252x\221\243\034\253\325\305\007\252\210\314\277\234"
+	.ascii	"\325Ma\223\375w\377\347\314{\233\235?\221\355\026`\036PeATDU"
+	.ascii	"\332\005f\032\332\003\341Z\264\212\262<\243w!\"X\367\346\t\221"
+	.ascii	"2\005\234\002\017\003(\003xnt\276\346\342\324\264\332F\207\031"
+	.ascii	"\205\363\372b\317fjX\315'\347^\257+N6\274\206\241|\307i\336\353"
+	.ascii	"\275\317;\2663\001\315\361\306\311\275k\212\021)|\350\352\212"
+	.ascii	"D\225\330\367\227}k\2419a\223<@\305\272\216\356\256!|M\342\020"
+	.ascii	"\001k\365\214O\020syY\255\276\241\354Y`a\265te\263QT\320\354"
+	.ascii	"\270\214\345\270\215\343R\262\245\007PP;3\226c+\254\346\203\\"
+	.ascii	"\357\362G%\315J\013\357\336u\216\3150\020\fe9^;\263q\026_\263"
+	.ascii	"\353Y\306\252p#~\324\204]\211j\365\314\305\236\313\266`\261\023"
+	.ascii	"\353\301\b\033w"
+	.string	"\371\211\334\220\260\021}i\242\026\345\037X\f\277q\031\016\303d\030\312c\330\2073\025~^]\357M\212\201\371\032G\317\3309\005\213\035\213\237y\340\3625\037\340\275nQ\330\356\275Z\270\214\307\260\227\257\221\270q\257\233\017\021M\275))x\367\336\024)R\244\030\221\"E\212\237=%m\027H=\033\261g.{\316\262\347\035\366\234\303\236\227\366Q\256\262g)\2532\224\355\313A>\023K\366*X>c4\206\236\340+\347*l\366\034\344z\327{\327\2376\242\207F\245\325\313\260<E\177\332\r(\273-N\200=\237\360\245{{|\302\367\237m\026\341\003\342 \037G9\310G\202E\370Lp\220\217\305xM\225T^\367\354*\327\020\234Dr\245\254U\236\302c\347\225\245|E\213\247\307\262+v\357\345\025\002\257{\221\274\376\344\335\213\374aN\2009\001\025\312\027\2224\237\372\266_9\310gY\204\257\001:"
+	.string	"\210\002\370\373H\375\333\003\025g\347\371{\205\377\376&r\340\337A\266\316\177\363\370\271\313\312\317\316*t\177\347\370\225\264\003\375m\365_\356\377\\\377\234\363\263\3723\326\317f\317\237\231T~6\341g\340\317/\236F\342\177\003!\374\\\3663\331\377(g\340\357\033\230I\006?\337\3603\362g\250\237\357\317\311\237m,\371\231\351g\033~\256A\311\377\236?\375\t\340$\330\277g\370\177\367_\215\233\373\376v\341\347$?\373\3709\353g\035?W\375,\365s\324\317(\374,\3643\t?\217\3603\b?{\360s\007?o\3603\006?\027\375\\\301\317-~&\372\231\201\237\025\370\371\367\377\312\3776\377\317\374L\300\177\270\237\007\3709\350g"
+	.ascii	"~\376\371\237\367\263\316\317\366\277\233\377u\377\351\376\257"
+	.ascii	"\377O\374\377\362\377gooo\357O\223\177N\005\177PYN\336b\035\005"
+	.ascii	"H\030^\225(Px\254\324\300J\236\351\271\266#\\\236\360\232\216"
+	.ascii	"\234\263\016\214\365r\276\332\234Y\033\263=B\212\226t\223%\315"
+	.ascii	"\204\357\362^\346M\337\266\254\264\234\374h\271E\235ao&:\330"
+	.ascii	"\347\220C'\361\335\313\253\227\325\3622\227(\376v\276\223\364"
+	.ascii	"\244\3215a\243\263\034\322H\2064\230=\336{\\\257\025\243UYi\341"
+	.ascii	"u\0271G\200\320\341\r\326[\202\030\311\321j\037\351\034\266\r"
+	.ascii	"\013\007\030#\251T\222,@\214\024\351I\353\272zk\243\206ii^!\302"
+	.ascii	"i|hk\340\344p\331\347$-O\233\"~\302\r\344\375\325AZi\257\363"
+	.ascii	"\204\2673vw\211\345\300U;{\325\213\345\331R\324[\315\365\356"
+	.ascii	"\361\036\335d\246\005T\314\330]&\023\205N\363J\230&?\336\315"
+	.ascii	"\327\361\\\022;q\326|E[=\233\366R\303\334\004\301\362\362\361"
+	.ascii	"\323%dl\256\243r\222P\341\342\244Uhw\361\336\377\333\323\345"
+	.ascii	"\206\226*O\354\337\277\357\"\227\367^\0349\353]B\361\3708\207"
+	.ascii	"\031\305\337\303)+p\323\377#\214\367\036\253D\357\354\2225\344"
+	.ascii	"\326M\334?\272T>\233\307\013\232W\311&\017\345\263y\217I\260"
+	.ascii	"c\210\345m\036\225\317{C\334d\362\030\303\353\206P>\357\325\255"
+	.ascii	"A\346\212\357\332<\336\244\327\rq\223\027iB\231l^)\237\310\253"
+	.ascii	"\020\312g\363\352>\233\027\350&\221\313\033\311\273\fq\237\315"
+	.ascii	"4\367\351u\005\244|z])\237M&;Q\276\341\2702\213~I1\2312yq\250"
+	.ascii	"\342B.\201\242\312\325\353\312\335\313g6\356R\201{\271\274\226"
+	.ascii	"rH\036\314\006\025\305\001\352\n\322\213\327{/\001UP_^7\031U"
+	.ascii	"\206y\335\033\006E\343VAp\\\243\227\bG\217@\270.\225\215{\013"
+	.ascii	"\270\353\275U\367\036\371F\357\275\307{\357o\311\265\336\253"
+	.ascii	"\005\244tVU\335\313\034Qu\271\216Yl\334\333gslW\312\347\227\027"
+	.ascii	"Q\226*O\347\215Z\217\354\274r\315\245}\036\311.\325\032\353\274"
+	.ascii	"\312\241\246U\024\235\005L\256\367\t\204[\323\343\254\325\253"
+	.ascii	"S\326\316\025\275y@\233G\353\270`\310z\217>PnK\246\003;l\310"
+	.ascii	"\250z\260\331\241\343w\337\340\254\264\372\326q\246k\257\001"
+	.ascii	"\324\"m`\224\264JD\364\306\022\341[2\327\373\303cp\310\272\\"
+	.ascii	"5\216\364\b\0164Qe\256\332\252\321\250ii\222\3056UW1\264q\270"
+	.ascii	"Z\346u\237\367\256=)r\007\2305\024>F1%\225tD\214\033\036'R\270"
+	.ascii	"\310\365\215V\346\324\020S#\327jG\255\300\251\035p\364Z}\352"
+	.ascii	"\304\276E\020Y,8\016\353\371\034\201.\324\033\323yoC\265\215"
+	.ascii	"\256\301\320N\362\336\373\366\361\274\242E'\033\311z\351\352"
+	.ascii	"\374Y\371\322\262\273w]z\202\375\260\352\323/;\202\203|i*e\237"
+	.ascii	"^\313o\030\016CKp^O\234'q\340\340\331s\t\037\357q\t\337{.A\232"
+	.ascii	"e\354\2376\177\340/\rn\313)\306\036\350f\201][[\251\017*H\254"
+	.ascii	"\2254\256\255\256\247>\352~\312\250\274\004\321j\332\243\313"
+	.ascii	"\2151\275VS\256\257\271\225\251\331\265\226/\214U\336\233\247"
+	.ascii	"\005\276\341\301#\315\362\251%1\022\226B]4_\230O\263X\355'Ef"
+	.ascii	"\345\001\344\262@1EV\267Jup\331\265\342\267(Swx\3672Q\360\304"
+	.ascii	"\331\321\305a=\325\3615\036%\222\215\224V\323e\232\343_hfv\244"
+	.ascii	"9R\034Y\200\fA\302\361\344m\251\211K\257\330\2074\254\t%\272"
+	.ascii	"\306L\260<Ik\365@)\373\313+J\2478\255J\253\016p\263\322r\322"
+	.ascii	"\223\224\302\343\315\033\253,J\225\234J\245R\335E\305\317\312"
+	.ascii	"\033\225\335]\372\340\200\275\0133\262%\3062w\027\0370\351\303"
+	.ascii	"\033\b\037\322\250T\311\2749\204\276\304\370<\315x1i5\265\361"
+	.ascii	"\243\322a*\257\315\236E\232^\323\304\f\021\232\026\003\302\356"
+	.ascii	"L\327\235\261\273w\275)T\232L\217i\r\206\246\310\276\373\b\263"
+	.ascii	"\024\331v\254\306\321!\027\210\315\261X\212l6\255\307Q&\320M"
+	.ascii	"b\301\353\371\021\205\346\203G=s:\022PJ\016\246\324\351u\233"
+	.ascii	"\316\343(s\2758v\324\322|A\301\213\323{\fm\275\217X\357=#\240"
+	.ascii	"\007\216\031\274)\276<8lR[Q\255\366\033~~\231\002\362\003\217"
+	.ascii	"\241\035\304O\224\022=\260V\333\315\351n\034\245\246\276EG\226"
+	.ascii	"(`\272\354-\323\336N\265\032\373\203]\2170\255\336\326\260\267"
+	.ascii	"G\373_\236\375\357\256\216\356\351\345.\f\035\353\365\033\030"
+	.ascii	"*(;\333qm\246\347~\340\017\0246!P9\373\226\013"
+	.ascii	"\241\210\030h\253*\177\213\257\177x\303\375\300\376\202\304Y"
+	.ascii	"\365f\337o]\346\007\372\310\201\241\221}\261o2\320\275\273\254"
+	.ascii	"V{\214\265\361S;\241\323\003\213\217\255V\337c\376\026\323Q^"
+	.ascii	"i\330\323s\323\352\3458\310\327\303\"|\r\206\350\035f'\f\027"
+	.ascii	"\273\261Vy~:X \217\242v\343\366\002m/\355\306\353\265\372\305"
+	.ascii	"\341q9\220\223\227\205\346\267\303\266[\377\260N\364\032&=\242"
+	.ascii	"t\227_\024\0308:Z]\305x\254\254\214xqa=\026\356\025\373\331r"
+	.ascii	"\325|iUGL\213\226f\202\305\311\203\0202O\360\254\016\017kk\335"
+	.ascii	"\366\304i\357\266\252\260ey\2675\307\254\267\325fc=\036\275:"
+	.ascii	"\347*\306\352\264QS\213\033\342\354\201\33603sfu\362\240\207"
+	.ascii	"\366\030\337\033\307\264\322r\242\323\346\354\001\2100\273\203"
+	.ascii	"DC\3531\013t\241~\360\301\231C\205\006N\r/\273S\344\331g\317"
+	.ascii	"\266bv\005x\246\203\310\231*o+\266\310\033\231 \255\266Y/\331"
+	.ascii	"ml\310\025\037\225\265i\212\336d\fm\262.\273\200y\357\025\013"
+	.ascii	"(1@\262'l\204\224I\261\240\363\304\232\3232cw\334\246|J\217\331"
+	.ascii	"kF\304J\013\317\227\267\243J\r\033\206\366X"
+	.string	"\016\2310\260\2646\333sc\207\357\320b\355\374a\371\362bw\231\\(~qYh\302\002\302\244\240q\251\311\204&\022\216\220^\320\020J\032*\021\215\305!!\322\323\322\321Pi\210X|\032\022`i\351i8l\032\376\214F\276\030\232\2104\214M\303_\013A\341\222j\024\026\231\204L>\rD\370@\304i\b\035!\005\207\212D!\fJD$\002\226\204\303a\220\006\f\243p\203#\244`\317\fKNN/B\024\221:\030>5\301@\022\032\211MNNO\305\002\214\247!\344\364\324DL2b\n\022\203NCG\013\034\r\237v\206-tN\321\210\307h4Lr\312\031&9\245B\032\224\212j\261($\"!\005\177D\243S\212$\034&)-\005\177H\302\342\223:lR2\036\t\213\277\023\215\222\234\204zf \032\213JI\302\021\020p\n\202\020\243\203&#\214\030/t\030I8T\232\301\324\004\303"
+	.string	"b\223\261\t\004\031\031\214\020@F\006F\245a\0070b\274\0201C\220H|\301$4\026g\220a\244"
+	.string	"\215\242\220\330\202p\004\0301^\230`\024&\001\240B\310H\f:\t!\005\205#\f B\205\220\013\"\242%'&\241\321\210h\024d4\324\300(,\nGHr2\361#%\242p(L\262\207\300\305\003.\"\220\341\367\b&P1\201\n\337#\230\200\210h\002\027D\366.\210R\243\321\n\026\305 \241\021R\007@B#"
+	.string	"\214D\241\322\222\223\222q\351\211)\200\242Q\222R\013\303&\0300b\274\2201B\270\024<*\002\215F\021\374\226\2020\300\240\204T\024\022\215\301\0310\364\030O\243\304\223N\321\310\007Ih\215/a<\r\241\241a\023\023S\323\221\001or\022\022\207\214MM\304\241\235\025H]4B\n>\275\2404\303G\305\214&\232\321+f4Q\260W\004\233\b\251}E#\2411h\224\001#\306\013\242\320(\004A"
+	.ascii	"\r~\214F.\210\214C\245'{\b\202H,XD@\004\201\220\210K \001\f\023"
+	.ascii	"%\204\260\201=\022\032*\022\233\212Caqh\250\024d\032:\"\026\207"
+	.ascii	"\204H \t\211B\343\222R\013\303\022\204IA\343R\023\f!\210A\032"
+	.ascii	"G*Z'\341\211\013\342\r\331\231\017\265\n\031\033O\254\244I|\242"
+	.ascii	"c{D\252p\\\316\231\263#\227\231\016\233\203\2220]\3513\315R\263"
+	.ascii	"\306\314\224V\327u\207\255\013\r\253U\236#R\322\262TJJ\306\301"
+	.ascii	"Q'\210\326r}J\026\007M^\226V\323)\351X\2315\2531\255B\331b6G"
+	.ascii	"\304\366HIwH\305\322\035\322(\274<\246"
+	.string	"\241\200J\217\034o\360.\023\013\305\237:y\032%\205\262\3029\341R(\351\023\235&d\314\3041{R\227\246\203\303>mR\"\2054\314&\255r\025\242\247LR6.6\362\302\312\352\210\\\225Y\322M\365x\207\234k\0258\366\343i\220\037i\222\024\216\347\036\313\256\325o\255\007$m\360\256\222\211b\207l\212l\314\221\247I\236:W\2648\235\223&p\310VS$O\301\230`\332\354tH\301~\240\316\222 \317\035\326\330?P\266\343\352\252\325\324\310\351\036FG\225\246\325\264\310\267\3600\343\360rH\211\204\371z\203j5\025\222\346\300\320\177I\207\334\247-\n\355\313\031\373\033\370_|\351\327S ?\020\330\326\025\202F\250B\3018\007\023\0312\310(3#4\222$\351B\n\020\004ci\242(\242\017\022 E1\3211\247\020\315HR\222T\n\313\030\370\t@\013\266B\202\031fN\006y\002\323sG"
+	.string	"\364z{\334\003\307CX\363SO<\205\345t\267P\216Z\352b\353C\201W\313(\230T\033\016x\001&:<\030\217\202r\ry@\243\264p\007\3620\027\317\273G_\202\235\231Q\210\t\032\\q\212;\220>\217\330>@\222\b\320\251\300o\231\335\261\267\204\020D\226`?\351\b\303\343w@\365\377\356V\030G8-\022C]\211\367\r\305\007\211+\300\245\202\032\";"
+	.string	"\345L\356#C\377D\201\214n\243A\263\335\237+\354\342u\037\333\231\344\023\211(L`n\266\336\363\303\302\341\201\034\225\341\tC\005.\354\005\300"
+	.string	"\371\222Q\t\240\201 \323\304b50\332V\0306D\343<FMD\221\3230*\216\272\333sx(\236\037\315\247\335H\272MV'?}X\357k\021\240\374\306\252\334\246)_\213\263AQh.\333@\2366176\025\bWO\231\312\t\347{\204G\251\342l9czL\026A<\227\306\347hLY2L\026w\261\3508v\006{\022\245\246{\342\026\254\007\365\366\241\307@Us\212Z\220\024u\016|\200\270!0B\325>\212\207Y)\201\312.\021\016\333d\177\226\333\277\342R\232\354{!"
+	.string	"\263\027\213\316\323\310u\"\203\006\356pf\0271\211\362L\324\221\026\274Q0\271@\270\243\023;\251\nP\341qJ\362+X\375\337\227l`\r\234T\t\240;\355\277\277\237R/c\235_\035\3508\336\006\177\350]  \301,N\217_\270QT\325\251\n\235\264C\363+\301?\n\035\251\230\357\030\205<\250\374_\333\314]W\001oN\203\246\371\361\232\\+\352[\347\237\252CB\260\343\001\244 \317UAQ\216\"\036\345\301DA\210\3169\300\243~%\327\305\366\204\212\023\335\265\332w\017\n\221\225\257\330P'\366 :\266\273\032\224\243\224\";C\263\370U\336M\265\n\222\222P\\\321\017\202\305\350\360Y\322\207\204\nK\330\320!\007Dw\342G\336\371\253/+\201\303\3655o\277#1\330X1\345"
+	.string	"\313\212\005\303\313\210\366\341\373\211\240\0025\205p27\203\276\240Y\323\202\301\330\226\350\255\263\006\235\260\306\324L^\246\264\016\342\033g\302\374\272\020`OSC\027{\231b\354\266\224E\372\322-\212\247\3500ET]\244Rg[\201T\212&\361\214i\326}\032?\206\304l\264\312\020\\\360\276\333\223\305y"
+	.ascii	"H\013\364\212Sd?\205$Z\267\344\251\372\213#\345\020j>3\317\003"
+	.ascii	"\024y\004k\005qO\025~2\276\030Y6\r\204\265#\255{\022\r\203\365"
+	.ascii	"\2759\2602\233h\222\3209\221>\355m\340\004\013B\013T"
+	.string	"\212\304\272L\217\212H\222\236n\201\251\033\334fG^\301\261:\006\235\254\337V\324\020`\330\214\345\253v\"\326\245kH\264e\344\235\244\230\245;\357\3569O\273\344\234vJ\234\f\225n\373<\t\261iA\202\326Lp\273\231\027\350\336\320A\023\f\223\331\035\303p\250_ \367\r)\326\252,\322\351P\313g;C\236\023\356M\325Z\030\217f\240\020\221 \350\227\006\262\032\261\222\027\b\227\201J\244R\3271 \343R\005\tC\371\264\357\024]\004\337y\237\366}0\310b\354}\017\004\303I\264S\003\322D\021E\205\301{u\344_\310+\332@MNs\243l~\205\306\\d\366\214\250t@\t_\b\370\250\244~\333\002\227Q,p\252R\267\367\tu&\255R\361\b\277\013|\r\351\250\2552\375\372\312\271\231)\214L"
+	.string	"m\237\231\362n\301\246\272np=\372?Ou\361\231\212\022\201\231\r\314\213_\331c\02783&\376~\232\016\013R\227\006"
+	.ascii	"6\n\006Pf=C\231\372\n'\245\215\363Iq\274\321\325\364\033\363"
+	.ascii	"\037\233;\201\322'N\224\235\3021m\242\177\300N\t\346\033\262"
+	.ascii	"r\277\366p\314&\235\205\035\322`^\233g\332\367\032\253\027\303"
+	.ascii	"[\273\301\230\340\rO/\027(g\2104Z9le\326\362\277\311y|\331\344"
+	.ascii	"\206\372\232\377\250\234E\177\347\360\r\270RX?`\333\020\034}"
+	.ascii	"\317\007\371\360\351\337\t\037?\254\274\317\306K\023\316\217"
+	.ascii	">\265\212\025\372\334-\3360W\333wrQ=\020\340\\\226\227\366Me"
+	.ascii	"\255\267\321p\326\"\035\324}e\325\313\227*3\315\233\376\002\303"
+	.ascii	"^\357\252\272\357\niZ\001"
+	.text
+	.section	.gnu.lto_.symtab.d9422d2a6bc84128,"e",@progbits
+	.string	"pgResetFn_voltageSensorADCConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"voltageMeterADCStates"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	" "
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"voltageMeterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.string	"getVoltageMeterADC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"voltageMeterADCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"voltageSensorADCConfig_SystemArray"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"voltageMeterADCRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\001"
+	.string	""
+	.string	"voltageMeterADCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"voltageMeterESCInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"voltageMeterESCRefresh"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"voltageMeterESCReadMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"voltageMeterESCReadCombined"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"voltageMeterRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"voltageMeterADCtoIDMap"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"voltageSensorADCConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"supportedVoltageMeterCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"voltageMeterIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d9422d2a6bc84128,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,21578 @@
+	.file	"serial_tcp.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/include/stdint.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 7 "/usr/include/stdio.h"
+	.file 8 "/usr/include/unistd.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/sockaddr.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/socket.h"
+	.file 11 "/usr/include/netinet/in.h"
+	.file 12 "/usr/include/x86_64-linux-gnu/sys/socket.h"
+	.file 13 "./src/main/target/SITL/target.h"
+	.file 14 "./src/main/drivers/resource.h"
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/socket_type.h"
+	.file 16 "./src/main/drivers/serial.h"
+	.file 17 "./src/main/target/SITL/serial_tcp.h"
+	.file 18 "./src/main/target/SITL/serial_tcp.c"
+	.file 19 "/usr/include/string.h"
+	.file 20 "/usr/include/fcntl.h"
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.file 22 "/usr/include/errno.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	serial_tcp.c.d6f2dede
+	.weak	serial_tcp.c.d6f2dede
+serial_tcp.c.d6f2dede:
+	.long	0x12d6
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x25
+	.long	.LASF3242
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2936
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2937
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2938
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2939
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2940
+	.uleb128 0x6
+	.long	.LASF2942
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2941
+	.uleb128 0x6
+	.long	.LASF2943
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x64
+	.uleb128 0x6
+	.long	.LASF2944
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2945
+	.uleb128 0x6
+	.long	.LASF2946
+	.byte	0x1
+	.byte	0x98
+	.byte	0x12
+	.long	0x7c
+	.uleb128 0x6
+	.long	.LASF2947
+	.byte	0x1
+	.byte	0x99
+	.byte	0x12
+	.long	0x7c
+	.uleb128 0x27
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF2948
+	.byte	0x1
+	.byte	0xc2
+	.byte	0x12
+	.long	0x7c
+	.uleb128 0x3
+	.long	0xae
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2949
+	.uleb128 0x8
+	.long	0xae
+	.uleb128 0x6
+	.long	.LASF2950
+	.byte	0x1
+	.byte	0xd2
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.long	.LASF2951
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x8
+	.long	0xc6
+	.uleb128 0x1d
+	.long	0xc6
+	.uleb128 0x6
+	.long	.LASF2952
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x6
+	.long	.LASF2953
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x8
+	.long	0xe8
+	.uleb128 0x6
+	.long	.LASF2954
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x6
+	.long	.LASF2955
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x11
+	.long	.LASF3003
+	.byte	0xd8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x8
+	.long	0x298
+	.uleb128 0x2
+	.long	.LASF2956
+	.byte	0x5
+	.byte	0x33
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2957
+	.byte	0x5
+	.byte	0x36
+	.byte	0x9
+	.long	0xa9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2958
+	.byte	0x5
+	.byte	0x37
+	.byte	0x9
+	.long	0xa9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2959
+	.byte	0x5
+	.byte	0x38
+	.byte	0x9
+	.long	0xa9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2960
+	.byte	0x5
+	.byte	0x39
+	.byte	0x9
+	.long	0xa9
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2961
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x9
+	.long	0xa9
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2962
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x9
+	.long	0xa9
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2963
+	.byte	0x5
+	.byte	0x3c
+	.byte	0x9
+	.long	0xa9
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2964
+	.byte	0x5
+	.byte	0x3d
+	.byte	0x9
+	.long	0xa9
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2965
+	.byte	0x5
+	.byte	0x40
+	.byte	0x9
+	.long	0xa9
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2966
+	.byte	0x5
+	.byte	0x41
+	.byte	0x9
+	.long	0xa9
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2967
+	.byte	0x5
+	.byte	0x42
+	.byte	0x9
+	.long	0xa9
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2968
+	.byte	0x5
+	.byte	0x44
+	.byte	0x16
+	.long	0x2b1
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2969
+	.byte	0x5
+	.byte	0x46
+	.byte	0x14
+	.long	0x2b6
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF2970
+	.byte	0x5
+	.byte	0x48
+	.byte	0x7
+	.long	0x64
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF2971
+	.byte	0x5
+	.byte	0x49
+	.byte	0x7
+	.long	0x64
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF2972
+	.byte	0x5
+	.byte	0x4a
+	.byte	0xb
+	.long	0x83
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF2973
+	.byte	0x5
+	.byte	0x4d
+	.byte	0x12
+	.long	0x29
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF2974
+	.byte	0x5
+	.byte	0x4e
+	.byte	0xf
+	.long	0x3e
+	.byte	0x82
+	.uleb128 0x2
+	.long	.LASF2975
+	.byte	0x5
+	.byte	0x4f
+	.byte	0x8
+	.long	0x2bb
+	.byte	0x83
+	.uleb128 0x2
+	.long	.LASF2976
+	.byte	0x5
+	.byte	0x51
+	.byte	0xf
+	.long	0x2cb
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF2977
+	.byte	0x5
+	.byte	0x59
+	.byte	0xd
+	.long	0x8f
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF2978
+	.byte	0x5
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2d5
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF2979
+	.byte	0x5
+	.byte	0x5c
+	.byte	0x19
+	.long	0x2df
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF2980
+	.byte	0x5
+	.byte	0x5d
+	.byte	0x14
+	.long	0x2b6
+	.byte	0xa8
+	.uleb128 0x2
+	.long	.LASF2981
+	.byte	0x5
+	.byte	0x5e
+	.byte	0x9
+	.long	0x9b
+	.byte	0xb0
+	.uleb128 0x2
+	.long	.LASF2982
+	.byte	0x5
+	.byte	0x5f
+	.byte	0xa
+	.long	0x105
+	.byte	0xb8
+	.uleb128 0x2
+	.long	.LASF2983
+	.byte	0x5
+	.byte	0x60
+	.byte	0x7
+	.long	0x64
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF2984
+	.byte	0x5
+	.byte	0x62
+	.byte	0x8
+	.long	0x2e4
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2985
+	.byte	0x6
+	.byte	0x7
+	.byte	0x19
+	.long	0x111
+	.uleb128 0x28
+	.long	.LASF3243
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x9
+	.long	.LASF2986
+	.uleb128 0x3
+	.long	0x2ac
+	.uleb128 0x3
+	.long	0x111
+	.uleb128 0xd
+	.long	0xae
+	.long	0x2cb
+	.uleb128 0xf
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x2a4
+	.uleb128 0x9
+	.long	.LASF2987
+	.uleb128 0x3
+	.long	0x2d0
+	.uleb128 0x9
+	.long	.LASF2988
+	.uleb128 0x3
+	.long	0x2da
+	.uleb128 0xd
+	.long	0xae
+	.long	0x2f4
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	0xb5
+	.uleb128 0x5
+	.long	0x2f4
+	.uleb128 0x6
+	.long	.LASF2989
+	.byte	0x7
+	.byte	0x4d
+	.byte	0x13
+	.long	0x9d
+	.uleb128 0x8
+	.long	0x2fe
+	.uleb128 0x3
+	.long	0x298
+	.uleb128 0x5
+	.long	0x30f
+	.uleb128 0x29
+	.long	.LASF3244
+	.byte	0x7
+	.byte	0x91
+	.byte	0xe
+	.long	0x30f
+	.uleb128 0x2a
+	.long	.LASF2990
+	.byte	0x8
+	.value	0x112
+	.byte	0x15
+	.long	0xba
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2991
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2992
+	.uleb128 0x1e
+	.long	.LASF3139
+	.long	0x30
+	.byte	0xf
+	.byte	0x18
+	.byte	0x6
+	.long	0x38b
+	.uleb128 0x1
+	.long	.LASF2993
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2994
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2995
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2996
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2997
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2998
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2999
+	.byte	0xa
+	.uleb128 0x15
+	.long	.LASF3000
+	.long	0x80000
+	.uleb128 0xe
+	.long	.LASF3001
+	.value	0x800
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3002
+	.byte	0x9
+	.byte	0x1c
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x11
+	.long	.LASF3004
+	.byte	0x10
+	.byte	0xa
+	.byte	0xb7
+	.byte	0x8
+	.long	0x3bf
+	.uleb128 0x2
+	.long	.LASF3005
+	.byte	0xa
+	.byte	0xb9
+	.byte	0x11
+	.long	0x38b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3006
+	.byte	0xa
+	.byte	0xba
+	.byte	0xa
+	.long	0x3c4
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	0x397
+	.uleb128 0xd
+	.long	0xae
+	.long	0x3d4
+	.uleb128 0xf
+	.long	0x37
+	.byte	0xd
+	.byte	0
+	.uleb128 0x1f
+	.long	0x30
+	.byte	0xa
+	.byte	0xce
+	.byte	0x3
+	.long	0x47c
+	.uleb128 0x1
+	.long	.LASF3007
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3008
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3009
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3010
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3011
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3012
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3013
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3014
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3015
+	.byte	0x80
+	.uleb128 0xe
+	.long	.LASF3016
+	.value	0x100
+	.uleb128 0xe
+	.long	.LASF3017
+	.value	0x200
+	.uleb128 0xe
+	.long	.LASF3018
+	.value	0x400
+	.uleb128 0xe
+	.long	.LASF3019
+	.value	0x800
+	.uleb128 0xe
+	.long	.LASF3020
+	.value	0x1000
+	.uleb128 0xe
+	.long	.LASF3021
+	.value	0x2000
+	.uleb128 0xe
+	.long	.LASF3022
+	.value	0x4000
+	.uleb128 0xe
+	.long	.LASF3023
+	.value	0x8000
+	.uleb128 0x15
+	.long	.LASF3024
+	.long	0x10000
+	.uleb128 0x15
+	.long	.LASF3025
+	.long	0x40000
+	.uleb128 0x15
+	.long	.LASF3026
+	.long	0x4000000
+	.uleb128 0x15
+	.long	.LASF3027
+	.long	0x20000000
+	.uleb128 0x15
+	.long	.LASF3028
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x3
+	.long	0x397
+	.uleb128 0x5
+	.long	0x47c
+	.uleb128 0x9
+	.long	.LASF3029
+	.uleb128 0x8
+	.long	0x486
+	.uleb128 0x3
+	.long	0x486
+	.uleb128 0x5
+	.long	0x490
+	.uleb128 0x9
+	.long	.LASF3030
+	.uleb128 0x8
+	.long	0x49a
+	.uleb128 0x3
+	.long	0x49a
+	.uleb128 0x5
+	.long	0x4a4
+	.uleb128 0x9
+	.long	.LASF3031
+	.uleb128 0x8
+	.long	0x4ae
+	.uleb128 0x3
+	.long	0x4ae
+	.uleb128 0x5
+	.long	0x4b8
+	.uleb128 0x9
+	.long	.LASF3032
+	.uleb128 0x8
+	.long	0x4c2
+	.uleb128 0x3
+	.long	0x4c2
+	.uleb128 0x5
+	.long	0x4cc
+	.uleb128 0x11
+	.long	.LASF3033
+	.byte	0x10
+	.byte	0xb
+	.byte	0xf5
+	.byte	0x8
+	.long	0x518
+	.uleb128 0x2
+	.long	.LASF3034
+	.byte	0xb
+	.byte	0xf7
+	.byte	0x11
+	.long	0x38b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3035
+	.byte	0xb
+	.byte	0xf8
+	.byte	0xf
+	.long	0x77a
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3036
+	.byte	0xb
+	.byte	0xf9
+	.byte	0x14
+	.long	0x6a8
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3037
+	.byte	0xb
+	.byte	0xfc
+	.byte	0x13
+	.long	0x7fc
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	0x4d6
+	.uleb128 0x3
+	.long	0x4d6
+	.uleb128 0x5
+	.long	0x51d
+	.uleb128 0x2b
+	.long	.LASF3038
+	.byte	0x1c
+	.byte	0xb
+	.value	0x104
+	.byte	0x8
+	.long	0x577
+	.uleb128 0x17
+	.long	.LASF3039
+	.value	0x106
+	.byte	0x11
+	.long	0x38b
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3040
+	.value	0x107
+	.byte	0xf
+	.long	0x77a
+	.byte	0x2
+	.uleb128 0x17
+	.long	.LASF3041
+	.value	0x108
+	.byte	0xe
+	.long	0xe8
+	.byte	0x4
+	.uleb128 0x17
+	.long	.LASF3042
+	.value	0x109
+	.byte	0x15
+	.long	0x7e1
+	.byte	0x8
+	.uleb128 0x17
+	.long	.LASF3043
+	.value	0x10a
+	.byte	0xe
+	.long	0xe8
+	.byte	0x18
+	.byte	0
+	.uleb128 0x8
+	.long	0x527
+	.uleb128 0x3
+	.long	0x527
+	.uleb128 0x5
+	.long	0x57c
+	.uleb128 0x9
+	.long	.LASF3044
+	.uleb128 0x8
+	.long	0x586
+	.uleb128 0x3
+	.long	0x586
+	.uleb128 0x5
+	.long	0x590
+	.uleb128 0x9
+	.long	.LASF3045
+	.uleb128 0x8
+	.long	0x59a
+	.uleb128 0x3
+	.long	0x59a
+	.uleb128 0x5
+	.long	0x5a4
+	.uleb128 0x9
+	.long	.LASF3046
+	.uleb128 0x8
+	.long	0x5ae
+	.uleb128 0x3
+	.long	0x5ae
+	.uleb128 0x5
+	.long	0x5b8
+	.uleb128 0x9
+	.long	.LASF3047
+	.uleb128 0x8
+	.long	0x5c2
+	.uleb128 0x3
+	.long	0x5c2
+	.uleb128 0x5
+	.long	0x5cc
+	.uleb128 0x9
+	.long	.LASF3048
+	.uleb128 0x8
+	.long	0x5d6
+	.uleb128 0x3
+	.long	0x5d6
+	.uleb128 0x5
+	.long	0x5e0
+	.uleb128 0x9
+	.long	.LASF3049
+	.uleb128 0x8
+	.long	0x5ea
+	.uleb128 0x3
+	.long	0x5ea
+	.uleb128 0x5
+	.long	0x5f4
+	.uleb128 0x6
+	.long	.LASF3050
+	.byte	0xc
+	.byte	0x50
+	.byte	0xa
+	.long	0x60a
+	.uleb128 0x23
+	.byte	0x4f
+	.uleb128 0x3
+	.long	0x3bf
+	.uleb128 0x5
+	.long	0x60c
+	.uleb128 0x3
+	.long	0x48b
+	.uleb128 0x5
+	.long	0x616
+	.uleb128 0x3
+	.long	0x49f
+	.uleb128 0x5
+	.long	0x620
+	.uleb128 0x3
+	.long	0x4b3
+	.uleb128 0x5
+	.long	0x62a
+	.uleb128 0x3
+	.long	0x4c7
+	.uleb128 0x5
+	.long	0x634
+	.uleb128 0x3
+	.long	0x518
+	.uleb128 0x5
+	.long	0x63e
+	.uleb128 0x3
+	.long	0x577
+	.uleb128 0x5
+	.long	0x648
+	.uleb128 0x3
+	.long	0x58b
+	.uleb128 0x5
+	.long	0x652
+	.uleb128 0x3
+	.long	0x59f
+	.uleb128 0x5
+	.long	0x65c
+	.uleb128 0x3
+	.long	0x5b3
+	.uleb128 0x5
+	.long	0x666
+	.uleb128 0x3
+	.long	0x5c7
+	.uleb128 0x5
+	.long	0x670
+	.uleb128 0x3
+	.long	0x5db
+	.uleb128 0x5
+	.long	0x67a
+	.uleb128 0x3
+	.long	0x5ef
+	.uleb128 0x5
+	.long	0x684
+	.uleb128 0x6
+	.long	.LASF3051
+	.byte	0xc
+	.byte	0x54
+	.byte	0xa
+	.long	0x69a
+	.uleb128 0x23
+	.byte	0x53
+	.uleb128 0x6
+	.long	.LASF3052
+	.byte	0xb
+	.byte	0x1e
+	.byte	0x12
+	.long	0xe8
+	.uleb128 0x11
+	.long	.LASF3053
+	.byte	0x4
+	.byte	0xb
+	.byte	0x1f
+	.byte	0x8
+	.long	0x6c3
+	.uleb128 0x2
+	.long	.LASF3054
+	.byte	0xb
+	.byte	0x21
+	.byte	0xf
+	.long	0x69c
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	0x30
+	.byte	0xb
+	.byte	0x29
+	.byte	0x3
+	.long	0x77a
+	.uleb128 0x1
+	.long	.LASF3055
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3056
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3057
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3058
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3059
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3060
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3061
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3062
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3063
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3064
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3065
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3066
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3067
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF3068
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF3069
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF3070
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF3071
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF3072
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF3073
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF3074
+	.byte	0x67
+	.uleb128 0x1
+	.long	.LASF3075
+	.byte	0x6c
+	.uleb128 0x1
+	.long	.LASF3076
+	.byte	0x84
+	.uleb128 0x1
+	.long	.LASF3077
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF3078
+	.byte	0x89
+	.uleb128 0x1
+	.long	.LASF3079
+	.byte	0x8f
+	.uleb128 0x1
+	.long	.LASF3080
+	.byte	0xff
+	.uleb128 0xe
+	.long	.LASF3081
+	.value	0x106
+	.uleb128 0xe
+	.long	.LASF3082
+	.value	0x107
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3083
+	.byte	0xb
+	.byte	0x7b
+	.byte	0x12
+	.long	0xdc
+	.uleb128 0x2c
+	.byte	0x10
+	.byte	0xb
+	.byte	0xdd
+	.byte	0x5
+	.long	0x7b1
+	.uleb128 0x20
+	.long	.LASF3084
+	.byte	0xdf
+	.byte	0xa
+	.long	0x7b1
+	.uleb128 0x20
+	.long	.LASF3085
+	.byte	0xe0
+	.byte	0xb
+	.long	0x7c1
+	.uleb128 0x20
+	.long	.LASF3086
+	.byte	0xe1
+	.byte	0xb
+	.long	0x7d1
+	.byte	0
+	.uleb128 0xd
+	.long	0xc6
+	.long	0x7c1
+	.uleb128 0xf
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0xd
+	.long	0xdc
+	.long	0x7d1
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0xd
+	.long	0xe8
+	.long	0x7e1
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3087
+	.byte	0x10
+	.byte	0xb
+	.byte	0xdb
+	.byte	0x8
+	.long	0x7fc
+	.uleb128 0x2
+	.long	.LASF3088
+	.byte	0xb
+	.byte	0xe2
+	.byte	0x9
+	.long	0x786
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x22
+	.long	0x80c
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x2d
+	.byte	0x8
+	.byte	0xd
+	.byte	0x94
+	.byte	0x9
+	.long	0x823
+	.uleb128 0x2
+	.long	.LASF3089
+	.byte	0xd
+	.byte	0x95
+	.byte	0xb
+	.long	0x9b
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3090
+	.byte	0xd
+	.byte	0x96
+	.byte	0x3
+	.long	0x80c
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF3091
+	.uleb128 0x1f
+	.long	0x30
+	.byte	0xe
+	.byte	0x14
+	.byte	0xe
+	.long	0x95d
+	.uleb128 0x1
+	.long	.LASF3092
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3093
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3094
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3095
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3096
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3097
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3098
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3099
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3100
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3101
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3102
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3103
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3104
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3105
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3106
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3107
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3108
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3109
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3110
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3111
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3112
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3113
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3114
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3115
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3116
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3117
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3118
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3119
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3120
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3121
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3122
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3123
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3124
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3125
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3126
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3127
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3128
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3129
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF3130
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF3131
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3132
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3133
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3134
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF3135
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF3136
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF3137
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF3138
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF3140
+	.long	0x30
+	.byte	0x10
+	.byte	0x16
+	.byte	0xe
+	.long	0x980
+	.uleb128 0x1
+	.long	.LASF3141
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3142
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3143
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3140
+	.byte	0x10
+	.byte	0x1a
+	.byte	0x3
+	.long	0x95d
+	.uleb128 0x1e
+	.long	.LASF3144
+	.long	0x30
+	.byte	0x10
+	.byte	0x1c
+	.byte	0xe
+	.long	0x9d9
+	.uleb128 0x1
+	.long	.LASF3145
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3146
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3147
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3148
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3149
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3150
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3151
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3152
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3153
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3154
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3144
+	.byte	0x10
+	.byte	0x2f
+	.byte	0x3
+	.long	0x98c
+	.uleb128 0x6
+	.long	.LASF3155
+	.byte	0x10
+	.byte	0x31
+	.byte	0x10
+	.long	0x9f1
+	.uleb128 0x3
+	.long	0x9f6
+	.uleb128 0x12
+	.long	0xa01
+	.uleb128 0x4
+	.long	0xdc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF3156
+	.byte	0x10
+	.byte	0x32
+	.byte	0x10
+	.long	0xa0d
+	.uleb128 0x3
+	.long	0xa12
+	.uleb128 0x12
+	.long	0xa22
+	.uleb128 0x4
+	.long	0xa22
+	.uleb128 0x4
+	.long	0x64
+	.byte	0
+	.uleb128 0x3
+	.long	0xd2
+	.uleb128 0x11
+	.long	.LASF3157
+	.byte	0x50
+	.byte	0x10
+	.byte	0x34
+	.byte	0x10
+	.long	0xaf8
+	.uleb128 0x2
+	.long	.LASF3158
+	.byte	0x10
+	.byte	0x36
+	.byte	0x24
+	.long	0xba7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3159
+	.byte	0x10
+	.byte	0x38
+	.byte	0xd
+	.long	0xc6
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3160
+	.byte	0x10
+	.byte	0x39
+	.byte	0x10
+	.long	0x980
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3161
+	.byte	0x10
+	.byte	0x3a
+	.byte	0x13
+	.long	0x9d9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3162
+	.byte	0x10
+	.byte	0x3c
+	.byte	0xe
+	.long	0xe8
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3163
+	.byte	0x10
+	.byte	0x3e
+	.byte	0xe
+	.long	0xe8
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3164
+	.byte	0x10
+	.byte	0x3f
+	.byte	0xe
+	.long	0xe8
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF3165
+	.byte	0x10
+	.byte	0x40
+	.byte	0x17
+	.long	0xbac
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3166
+	.byte	0x10
+	.byte	0x41
+	.byte	0x17
+	.long	0xbac
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF3167
+	.byte	0x10
+	.byte	0x42
+	.byte	0xe
+	.long	0xe8
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF3168
+	.byte	0x10
+	.byte	0x43
+	.byte	0xe
+	.long	0xe8
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF3169
+	.byte	0x10
+	.byte	0x44
+	.byte	0xe
+	.long	0xe8
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF3170
+	.byte	0x10
+	.byte	0x45
+	.byte	0xe
+	.long	0xe8
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF3171
+	.byte	0x10
+	.byte	0x47
+	.byte	0x1e
+	.long	0x9e5
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF3172
+	.byte	0x10
+	.byte	0x48
+	.byte	0x23
+	.long	0xa01
+	.byte	0x48
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3173
+	.byte	0x60
+	.byte	0x10
+	.byte	0x5a
+	.byte	0x8
+	.long	0xba2
+	.uleb128 0x2
+	.long	.LASF3174
+	.byte	0x10
+	.byte	0x5b
+	.byte	0xc
+	.long	0xbd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3175
+	.byte	0x10
+	.byte	0x5d
+	.byte	0x10
+	.long	0xbf0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3176
+	.byte	0x10
+	.byte	0x5e
+	.byte	0x10
+	.long	0xbf0
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3177
+	.byte	0x10
+	.byte	0x60
+	.byte	0xf
+	.long	0xc04
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3178
+	.byte	0x10
+	.byte	0x63
+	.byte	0xc
+	.long	0xc19
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3179
+	.byte	0x10
+	.byte	0x65
+	.byte	0xb
+	.long	0xc34
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF3180
+	.byte	0x10
+	.byte	0x67
+	.byte	0xc
+	.long	0xc49
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF3181
+	.byte	0x10
+	.byte	0x69
+	.byte	0xc
+	.long	0xc69
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF3182
+	.byte	0x10
+	.byte	0x6b
+	.byte	0xc
+	.long	0xc79
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF3183
+	.byte	0x10
+	.byte	0x6c
+	.byte	0xc
+	.long	0xc79
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF3184
+	.byte	0x10
+	.byte	0x6f
+	.byte	0xb
+	.long	0xc9c
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF3185
+	.byte	0x10
+	.byte	0x71
+	.byte	0xb
+	.long	0xcb5
+	.byte	0x58
+	.byte	0
+	.uleb128 0x8
+	.long	0xaf8
+	.uleb128 0x3
+	.long	0xba2
+	.uleb128 0x3
+	.long	0xd7
+	.uleb128 0x6
+	.long	.LASF3186
+	.byte	0x10
+	.byte	0x49
+	.byte	0x3
+	.long	0xa27
+	.uleb128 0x8
+	.long	0xbb1
+	.uleb128 0x12
+	.long	0xbd2
+	.uleb128 0x4
+	.long	0xbd2
+	.uleb128 0x4
+	.long	0xc6
+	.byte	0
+	.uleb128 0x3
+	.long	0xbb1
+	.uleb128 0x3
+	.long	0xbc2
+	.uleb128 0x18
+	.long	0xe8
+	.long	0xbeb
+	.uleb128 0x4
+	.long	0xbeb
+	.byte	0
+	.uleb128 0x3
+	.long	0xbbd
+	.uleb128 0x3
+	.long	0xbdc
+	.uleb128 0x18
+	.long	0xc6
+	.long	0xc04
+	.uleb128 0x4
+	.long	0xbd2
+	.byte	0
+	.uleb128 0x3
+	.long	0xbf5
+	.uleb128 0x12
+	.long	0xc19
+	.uleb128 0x4
+	.long	0xbd2
+	.uleb128 0x4
+	.long	0xe8
+	.byte	0
+	.uleb128 0x3
+	.long	0xc09
+	.uleb128 0x18
+	.long	0xc2d
+	.long	0xc2d
+	.uleb128 0x4
+	.long	0xbeb
+	.byte	0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF3187
+	.uleb128 0x3
+	.long	0xc1e
+	.uleb128 0x12
+	.long	0xc49
+	.uleb128 0x4
+	.long	0xbd2
+	.uleb128 0x4
+	.long	0x980
+	.byte	0
+	.uleb128 0x3
+	.long	0xc39
+	.uleb128 0x12
+	.long	0xc63
+	.uleb128 0x4
+	.long	0xbd2
+	.uleb128 0x4
+	.long	0xc63
+	.uleb128 0x4
+	.long	0x64
+	.byte	0
+	.uleb128 0x3
+	.long	0xc68
+	.uleb128 0x2e
+	.uleb128 0x3
+	.long	0xc4e
+	.uleb128 0x12
+	.long	0xc79
+	.uleb128 0x4
+	.long	0xbd2
+	.byte	0
+	.uleb128 0x3
+	.long	0xc6e
+	.uleb128 0x18
+	.long	0x64
+	.long	0xc97
+	.uleb128 0x4
+	.long	0xbd2
+	.uleb128 0x4
+	.long	0xc97
+	.uleb128 0x4
+	.long	0x64
+	.byte	0
+	.uleb128 0x3
+	.long	0xc6
+	.uleb128 0x3
+	.long	0xc7e
+	.uleb128 0x18
+	.long	0xc2d
+	.long	0xcb5
+	.uleb128 0x4
+	.long	0xbd2
+	.uleb128 0x4
+	.long	0xa01
+	.byte	0
+	.uleb128 0x3
+	.long	0xca1
+	.uleb128 0x3
+	.long	0x823
+	.uleb128 0x2f
+	.long	.LASF3188
+	.value	0xc60
+	.byte	0x11
+	.byte	0x1d
+	.byte	0x10
+	.long	0xd29
+	.uleb128 0x2
+	.long	.LASF3189
+	.byte	0x11
+	.byte	0x1e
+	.byte	0x12
+	.long	0xbb1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3165
+	.byte	0x11
+	.byte	0x20
+	.byte	0x16
+	.long	0xd3a
+	.byte	0x50
+	.uleb128 0x19
+	.long	.LASF3166
+	.byte	0x21
+	.byte	0x16
+	.long	0xd50
+	.value	0x450
+	.uleb128 0x19
+	.long	.LASF3190
+	.byte	0x23
+	.byte	0x9
+	.long	0x64
+	.value	0xc50
+	.uleb128 0x19
+	.long	.LASF3191
+	.byte	0x24
+	.byte	0x9
+	.long	0x64
+	.value	0xc54
+	.uleb128 0x19
+	.long	.LASF3192
+	.byte	0x25
+	.byte	0xe
+	.long	0xdc
+	.value	0xc58
+	.uleb128 0x19
+	.long	.LASF3193
+	.byte	0x26
+	.byte	0x9
+	.long	0xc2d
+	.value	0xc5a
+	.byte	0
+	.uleb128 0xd
+	.long	0xd7
+	.long	0xd3a
+	.uleb128 0x21
+	.long	0x37
+	.value	0x3ff
+	.byte	0
+	.uleb128 0x1d
+	.long	0xd29
+	.uleb128 0xd
+	.long	0xd7
+	.long	0xd50
+	.uleb128 0x21
+	.long	0x37
+	.value	0x7ff
+	.byte	0
+	.uleb128 0x1d
+	.long	0xd3f
+	.uleb128 0x6
+	.long	.LASF3194
+	.byte	0x11
+	.byte	0x27
+	.byte	0x3
+	.long	0xcbf
+	.uleb128 0xd
+	.long	0xd55
+	.long	0xd71
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF3195
+	.byte	0x31
+	.byte	0x12
+	.long	0xd61
+	.uleb128 0xa
+	.long	.LASF3196
+	.byte	0xe6
+	.byte	0x26
+	.long	0xba2
+	.uleb128 0x13
+	.long	.LASF3197
+	.byte	0x7
+	.value	0x164
+	.byte	0xc
+	.long	0x64
+	.long	0xd9f
+	.uleb128 0x4
+	.long	0x2f4
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3198
+	.byte	0x7
+	.value	0x15e
+	.byte	0xc
+	.long	0x64
+	.long	0xdbc
+	.uleb128 0x4
+	.long	0x314
+	.uleb128 0x4
+	.long	0x2f9
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3199
+	.byte	0x13
+	.value	0x1a3
+	.byte	0xe
+	.long	0xa9
+	.long	0xdd3
+	.uleb128 0x4
+	.long	0x64
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3200
+	.byte	0xc
+	.value	0x128
+	.byte	0xc
+	.long	0x64
+	.long	0xdef
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x64
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3201
+	.byte	0xc
+	.byte	0x70
+	.byte	0xc
+	.long	0x64
+	.long	0xe0f
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x68e
+	.uleb128 0x4
+	.long	0x325
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3202
+	.byte	0x13
+	.byte	0x3d
+	.byte	0xe
+	.long	0x9b
+	.long	0xe2f
+	.uleb128 0x4
+	.long	0x9b
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x105
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3203
+	.byte	0xc
+	.byte	0x66
+	.byte	0xc
+	.long	0x64
+	.long	0xe4f
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x64
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3204
+	.byte	0x14
+	.byte	0x95
+	.byte	0xc
+	.long	0x64
+	.long	0xe6b
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3205
+	.byte	0xc
+	.byte	0x91
+	.byte	0x10
+	.long	0x2fe
+	.long	0xe90
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x9b
+	.uleb128 0x4
+	.long	0x105
+	.uleb128 0x4
+	.long	0x64
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3206
+	.byte	0xc
+	.value	0x115
+	.byte	0xc
+	.long	0x64
+	.long	0xebb
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0xc63
+	.uleb128 0x4
+	.long	0x325
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF3207
+	.byte	0xc
+	.value	0x132
+	.byte	0xc
+	.long	0x64
+	.long	0xedc
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0x5fe
+	.uleb128 0x4
+	.long	0xee1
+	.byte	0
+	.uleb128 0x3
+	.long	0x325
+	.uleb128 0x5
+	.long	0xedc
+	.uleb128 0x13
+	.long	.LASF3208
+	.byte	0x8
+	.value	0x166
+	.byte	0xc
+	.long	0x64
+	.long	0xefd
+	.uleb128 0x4
+	.long	0x64
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF3245
+	.byte	0x16
+	.byte	0x25
+	.byte	0xd
+	.long	0xf09
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x16
+	.long	.LASF3209
+	.byte	0xc
+	.byte	0x8a
+	.byte	0x10
+	.long	0x2fe
+	.long	0xf33
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x4
+	.long	0xc63
+	.uleb128 0x4
+	.long	0x105
+	.uleb128 0x4
+	.long	0x64
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF3211
+	.byte	0x12
+	.value	0x120
+	.byte	0xf
+	.long	0xbd2
+	.long	0xf77
+	.uleb128 0x1a
+	.long	.LASF3210
+	.byte	0x27
+	.long	0xcba
+	.uleb128 0x1a
+	.long	.LASF3171
+	.byte	0x48
+	.long	0x9e5
+	.uleb128 0x1a
+	.long	.LASF3162
+	.byte	0x5d
+	.long	0xe8
+	.uleb128 0x1a
+	.long	.LASF3160
+	.byte	0x72
+	.long	0x980
+	.uleb128 0x1a
+	.long	.LASF3161
+	.byte	0x86
+	.long	0x9d9
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF3246
+	.byte	0x12
+	.value	0x115
+	.byte	0x6
+	.long	0xf9d
+	.uleb128 0x1b
+	.uleb128 0x24
+	.string	"i"
+	.value	0x117
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x1b
+	.uleb128 0x24
+	.string	"s"
+	.value	0x118
+	.byte	0x14
+	.long	0xf9d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0xd55
+	.uleb128 0x33
+	.long	.LASF3212
+	.byte	0x12
+	.byte	0xf4
+	.byte	0xf
+	.long	0xbd2
+	.long	0xff8
+	.uleb128 0x7
+	.long	.LASF3213
+	.byte	0x12
+	.byte	0xf4
+	.byte	0x21
+	.long	0x64
+	.uleb128 0x7
+	.long	.LASF3171
+	.byte	0x12
+	.byte	0xf4
+	.byte	0x41
+	.long	0x9e5
+	.uleb128 0x7
+	.long	.LASF3162
+	.byte	0x12
+	.byte	0xf4
+	.byte	0x56
+	.long	0xe8
+	.uleb128 0x7
+	.long	.LASF3160
+	.byte	0x12
+	.byte	0xf4
+	.byte	0x6b
+	.long	0x980
+	.uleb128 0x7
+	.long	.LASF3161
+	.byte	0x12
+	.byte	0xf4
+	.byte	0x7f
+	.long	0x9d9
+	.uleb128 0xb
+	.string	"s"
+	.byte	0xfa
+	.byte	0x10
+	.long	0xf9d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3215
+	.byte	0xdf
+	.long	0x1018
+	.uleb128 0x7
+	.long	.LASF3214
+	.byte	0x12
+	.byte	0xdf
+	.byte	0x27
+	.long	0xbd2
+	.uleb128 0xb
+	.string	"s"
+	.byte	0xe1
+	.byte	0x10
+	.long	0xf9d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3216
+	.byte	0xda
+	.long	0x102f
+	.uleb128 0x7
+	.long	.LASF3214
+	.byte	0x12
+	.byte	0xda
+	.byte	0x29
+	.long	0xbd2
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3217
+	.byte	0xd5
+	.long	0x1052
+	.uleb128 0x7
+	.long	.LASF3214
+	.byte	0x12
+	.byte	0xd5
+	.byte	0x26
+	.long	0xbd2
+	.uleb128 0x7
+	.long	.LASF3160
+	.byte	0x12
+	.byte	0xd5
+	.byte	0x3b
+	.long	0x980
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3218
+	.byte	0xd0
+	.long	0x1075
+	.uleb128 0x7
+	.long	.LASF3214
+	.byte	0x12
+	.byte	0xd0
+	.byte	0x2a
+	.long	0xbd2
+	.uleb128 0x7
+	.long	.LASF3162
+	.byte	0x12
+	.byte	0xd0
+	.byte	0x3d
+	.long	0xe8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3219
+	.byte	0xbf
+	.long	0x10aa
+	.uleb128 0x7
+	.long	.LASF3214
+	.byte	0x12
+	.byte	0xbf
+	.byte	0x24
+	.long	0xbd2
+	.uleb128 0x1c
+	.string	"ch"
+	.byte	0xbf
+	.byte	0x36
+	.long	0xc6
+	.uleb128 0xb
+	.string	"s"
+	.byte	0xc1
+	.byte	0x10
+	.long	0xf9d
+	.uleb128 0xa
+	.long	.LASF3220
+	.byte	0xc2
+	.byte	0x14
+	.long	0xf4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3223
+	.byte	0x12
+	.byte	0xb5
+	.byte	0xc
+	.long	0x64
+	.long	0x10ea
+	.uleb128 0x7
+	.long	.LASF3214
+	.byte	0x12
+	.byte	0xb5
+	.byte	0x25
+	.long	0xbd2
+	.uleb128 0x7
+	.long	.LASF3221
+	.byte	0x12
+	.byte	0xb5
+	.byte	0x38
+	.long	0xc97
+	.uleb128 0x7
+	.long	.LASF3222
+	.byte	0x12
+	.byte	0xb5
+	.byte	0x42
+	.long	0x64
+	.uleb128 0x1b
+	.uleb128 0xb
+	.string	"i"
+	.byte	0xb8
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3224
+	.byte	0x12
+	.byte	0xae
+	.byte	0x10
+	.long	0xc6
+	.long	0x1111
+	.uleb128 0x7
+	.long	.LASF3214
+	.byte	0x12
+	.byte	0xae
+	.byte	0x26
+	.long	0xbd2
+	.uleb128 0xb
+	.string	"ch"
+	.byte	0xb0
+	.byte	0x13
+	.long	0xd2
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3225
+	.byte	0x12
+	.byte	0xa7
+	.byte	0xc
+	.long	0xc2d
+	.long	0x1137
+	.uleb128 0x7
+	.long	.LASF3214
+	.byte	0x12
+	.byte	0xa7
+	.byte	0x39
+	.long	0xbeb
+	.uleb128 0xb
+	.string	"s"
+	.byte	0xa9
+	.byte	0x10
+	.long	0xf9d
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3226
+	.byte	0x12
+	.byte	0x9d
+	.byte	0x11
+	.long	0xe8
+	.long	0x1168
+	.uleb128 0x7
+	.long	.LASF3214
+	.byte	0x12
+	.byte	0x9d
+	.byte	0x39
+	.long	0xbeb
+	.uleb128 0xb
+	.string	"s"
+	.byte	0x9f
+	.byte	0x10
+	.long	0xf9d
+	.uleb128 0xa
+	.long	.LASF3227
+	.byte	0xa3
+	.byte	0x14
+	.long	0xf4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3228
+	.byte	0x12
+	.byte	0x95
+	.byte	0x11
+	.long	0xe8
+	.long	0x118e
+	.uleb128 0x7
+	.long	.LASF3214
+	.byte	0x12
+	.byte	0x95
+	.byte	0x3c
+	.long	0xbeb
+	.uleb128 0xb
+	.string	"s"
+	.byte	0x97
+	.byte	0x10
+	.long	0xf9d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3229
+	.byte	0x6a
+	.long	0x11f4
+	.uleb128 0x1c
+	.string	"s"
+	.byte	0x6a
+	.byte	0x20
+	.long	0xf9d
+	.uleb128 0xb
+	.string	"fd"
+	.byte	0x70
+	.byte	0xf
+	.long	0x6b
+	.uleb128 0xa
+	.long	.LASF3189
+	.byte	0x7f
+	.byte	0x13
+	.long	0xbd2
+	.uleb128 0xb
+	.string	"buf"
+	.byte	0x80
+	.byte	0xd
+	.long	0x11f4
+	.uleb128 0xa
+	.long	.LASF3230
+	.byte	0x81
+	.byte	0x14
+	.long	0xf4
+	.uleb128 0xa
+	.long	.LASF3231
+	.byte	0x85
+	.byte	0x13
+	.long	0x30a
+	.uleb128 0x34
+	.long	0x11e8
+	.uleb128 0xb
+	.string	"one"
+	.byte	0x75
+	.byte	0x13
+	.long	0x6b
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.string	"i"
+	.byte	0x8b
+	.byte	0x12
+	.long	0x2fe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xc6
+	.long	0x1205
+	.uleb128 0x21
+	.long	0x37
+	.value	0x3ff
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3232
+	.byte	0x52
+	.long	0x1252
+	.uleb128 0x1c
+	.string	"s"
+	.byte	0x52
+	.byte	0x21
+	.long	0xf9d
+	.uleb128 0xa
+	.long	.LASF3189
+	.byte	0x54
+	.byte	0x13
+	.long	0xbd2
+	.uleb128 0x1b
+	.uleb128 0xa
+	.long	.LASF3233
+	.byte	0x5b
+	.byte	0x18
+	.long	0xf4
+	.uleb128 0xa
+	.long	.LASF3234
+	.byte	0x5c
+	.byte	0x18
+	.long	0xf4
+	.uleb128 0xa
+	.long	.LASF3222
+	.byte	0x5d
+	.byte	0x18
+	.long	0xf4
+	.uleb128 0xa
+	.long	.LASF3235
+	.byte	0x5e
+	.byte	0x17
+	.long	0x30a
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3236
+	.byte	0x12
+	.byte	0x39
+	.byte	0xc
+	.long	0xc2d
+	.long	0x128e
+	.uleb128 0x1c
+	.string	"s"
+	.byte	0x39
+	.byte	0x21
+	.long	0xf9d
+	.uleb128 0x7
+	.long	.LASF3213
+	.byte	0x12
+	.byte	0x39
+	.byte	0x28
+	.long	0x64
+	.uleb128 0xb
+	.string	"one"
+	.byte	0x3f
+	.byte	0xf
+	.long	0x6b
+	.uleb128 0xa
+	.long	.LASF3237
+	.byte	0x43
+	.byte	0x18
+	.long	0x4d6
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3238
+	.byte	0x33
+	.long	0x12a3
+	.uleb128 0x1c
+	.string	"fd"
+	.byte	0x33
+	.byte	0x23
+	.long	0x64
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3239
+	.byte	0x15
+	.byte	0x31
+	.byte	0x1
+	.long	0x70
+	.long	0x12c0
+	.uleb128 0x7
+	.long	.LASF3240
+	.byte	0x15
+	.byte	0x31
+	.byte	0x18
+	.long	0x70
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF3241
+	.byte	0x15
+	.byte	0x22
+	.byte	0x1
+	.long	0x58
+	.uleb128 0x7
+	.long	.LASF3240
+	.byte	0x15
+	.byte	0x22
+	.byte	0x18
+	.long	0x58
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 288
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 23 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1a
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 27 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 28 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 31 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 33 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x21
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF788
+	.file 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF791
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF792
+	.byte	0x4
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF793
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF794
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF795
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/cookie_io_functions_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF804
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF844
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF872
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF873
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 51 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF877
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/errno.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF878
+	.file 53 "/usr/include/linux/errno.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x35
+	.file 54 "/usr/include/x86_64-linux-gnu/asm/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x36
+	.file 55 "/usr/include/asm-generic/errno.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF879
+	.file 56 "/usr/include/asm-generic/errno-base.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1014
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1015
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/error_t.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1016
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1017
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/fcntl.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x3b
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/struct_iovec.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 61 "/usr/include/linux/falloc.h"
+	.byte	0x3
+	.uleb128 0x162
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1168
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1177
+	.byte	0x4
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/stat.h"
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1178
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h"
+	.byte	0x3
+	.uleb128 0xca
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/environments.h"
+	.byte	0x3
+	.uleb128 0xce
+	.uleb128 0x45
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0xe2
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.byte	0x3
+	.uleb128 0x276
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h"
+	.byte	0x3
+	.uleb128 0x387
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1643
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1644
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1645
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h"
+	.byte	0x3
+	.uleb128 0x4c2
+	.uleb128 0x49
+	.file 74 "/usr/include/linux/close_range.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 75 "/usr/include/arpa/inet.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1649
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1650
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1662
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1663
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1664
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1666
+	.file 80 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1676
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1689
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1694
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1697
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1713
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1714
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x59
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1715
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1727
+	.byte	0x4
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1734
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1735
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x3
+	.uleb128 0xb4
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 93 "/usr/include/x86_64-linux-gnu/asm/socket.h"
+	.byte	0x3
+	.uleb128 0x181
+	.uleb128 0x5d
+	.file 94 "/usr/include/asm-generic/socket.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x5e
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1911
+	.file 95 "/usr/include/linux/posix_types.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1912
+	.file 96 "/usr/include/linux/stddef.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.file 97 "/usr/include/x86_64-linux-gnu/asm/posix_types.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x61
+	.file 98 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.file 99 "/usr/include/asm-generic/posix_types.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x63
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1921
+	.file 100 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.file 101 "/usr/include/asm-generic/bitsperlong.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x65
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1924
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 102 "/usr/include/x86_64-linux-gnu/asm/sockios.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x66
+	.file 103 "/usr/include/asm-generic/sockios.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 104 "/usr/include/x86_64-linux-gnu/bits/types/struct_osockaddr.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x68
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2021
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 105 "/usr/include/x86_64-linux-gnu/bits/in.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x3
+	.uleb128 0x196
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x197
+	.uleb128 0x51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x4
+	.file 106 "/usr/include/netinet/tcp.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x6a
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.file 107 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x6b
+	.file 108 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.file 109 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x6d
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF2486
+	.byte	0x4
+	.byte	0x4
+	.file 110 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.file 111 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x6f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x10
+	.file 112 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x70
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.file 113 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x71
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.file 114 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x72
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.file 115 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2915
+	.byte	0x4
+	.file 116 "./src/main/drivers/serial_uart.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.53.90a05048924955a6e2e77b4203beef80,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.86760ef34d2b7513aac6ce30cb73c6f8,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.138.ba977b5ae4e90303e95ec5db0bd05792,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF836
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF843
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF865
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF875
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.errnobase.h.3.496c97749cc421db8c7f3a88bb19be3e,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.errno.h.7.abb72fb4c24e8d4d14afee66cc0be915,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntl.h.24.62c7e777a8b210e920ccbb92cfe8b9d8,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1021
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_iovec.h.20.64e3c6cefa401374951f8ea68dba2a0a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntllinux.h.42.66fc3dd2eb9e548124f834f46a09c6d1,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.falloc.h.3.74001d56cdb3f986d217acbf397bd249,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1151
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntllinux.h.367.20dd1433251f22a4594b44d9ff5a02c1,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1164
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntl.h.40.4f7e26502dfa87273d18668eb9c6dc33,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1167
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1172
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1174
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1176
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_stat.h.24.58804b9fde232cb81d58c44500307576,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1185
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stat.h.29.cab33b67e546bcdba0ebb7d142404f85,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1204
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fcntl.h.80.34001020898245d8535bf89fc94e0aa0,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.23.e34f3a5c100123d9385c8b91a86a6783,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1252
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_opt.h.20.21a42956ee7763f6aa309b86c7756272,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1314
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.environments.h.56.c5802092ccc191baeb41f8d355bb878f,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.210.b40c6c15db1d0b653f8dce03f258da9c,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.233.b2a3d412932fd0d11e894d2fa61f02a7,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1336
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.confname.h.27.257966e7e49af2ab4cb41132b3606cbf,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1642
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.close_range.h.3.4d88cbc6c547d67820b4ac3b219a3d11,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1648
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.20.8723ed9535261a0d10a3272dcb4d2131,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.20.08bd3c6531df306b747ad30a61a6808b,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.1eca9509d7610ce351584de3133ccc67,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1661
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.139.6019664dcbeb1249e99523113213c493,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.19.9d1901280ec9eab2830e2d550d553924,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1688
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1693
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1696
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.52.4f882364bb7424384ae71496b52638dc,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1708
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1712
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1726
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1730
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket_type.h.28.5a26c72aa620989d56a4a7f4b904e12a,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1744
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.41.e4f0faad59a1da54fad3da8d9088aa2a,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1872
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sockaddr.h.24.0f72ba81a432198016bbf84b8b7dd664,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1876
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.192.7ba5d7b514be57162d8c455cd6094f4b,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1910
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.3.65729c9f805bc1ab8e22fab65fee3ee6,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1916
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_types.h.22.ce27b629270cbb91230af7498cb5994b,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_types_64.h.3.c35937438f2f85070758d4696b933189,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitsperlong.h.3.81201f16c5ebf9ebeb0f369d7d7d8e27,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1923
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sockios.h.3.7ae89caef44885f67ccfdec206df4325,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1932
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.9.ad61275896734f9826c69c5bb28c7264,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2020
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.socket.h.44.1a1d675276ea9474257aba2c40fd0acc,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2026
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2028
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF2027
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.41.6a59d6a1707661b231dcfea9d9f6951a,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2159
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.43.4df33bb59d312ed38c2a8849594b8e72,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.in.h.422.ee437be11cfc9d4be701124d8f6f0975,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF2248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.tcp.h.33.467c8aca6d7abc3c3f84efd4517c587f,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF2330
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2375
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2388
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF2389
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2405
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF2406
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF2407
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF2408
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2409
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2336
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2434
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF2435
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF2436
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF2437
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF2438
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF2439
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF2440
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF2441
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF2442
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF2443
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF2444
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF2445
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF2446
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF2447
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF2448
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF2449
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF2450
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF2451
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF2452
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF2453
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF2454
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF2455
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF2456
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF2457
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF2458
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF2459
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF2460
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF2461
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF2462
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF2463
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF2464
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2485
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2503
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2519
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2522
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2524
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2532
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2534
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2536
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2537
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2541
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2547
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2550
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2552
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2553
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2554
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2555
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2557
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2558
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2559
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2560
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2561
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2562
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2563
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2565
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2566
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2567
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2568
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2569
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2572
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2573
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2574
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2576
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2577
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2578
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2579
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2581
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2584
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2587
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2588
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2589
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2590
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2591
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2592
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2593
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2594
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2595
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2596
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2597
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2598
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2600
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2601
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2602
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2603
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2604
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2605
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2606
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2607
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2608
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2609
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2610
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2611
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2612
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2613
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2614
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2615
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2616
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2617
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2618
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2620
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2621
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2623
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2624
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2625
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2626
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2627
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2628
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2629
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2630
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2631
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2632
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2633
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2634
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2635
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2636
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2637
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2638
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2639
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2640
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2641
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2642
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2643
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2644
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2645
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2646
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2647
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2648
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2649
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2650
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2651
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2652
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF2653
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF2654
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF2655
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF2656
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF2657
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF2659
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF2660
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF2661
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF2662
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF2663
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF2664
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF2665
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF2666
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2667
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2668
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2669
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF2670
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF2671
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF2672
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2673
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF2674
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF2675
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF2676
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF2677
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF2678
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2679
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF2680
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2681
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF2682
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF2683
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2684
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2685
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF2686
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2687
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2688
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2689
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2691
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF2692
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF2694
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF2695
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2696
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF2697
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2698
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF2699
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2700
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF2701
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2702
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF2703
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF2704
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF2705
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2706
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF2707
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2708
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF2709
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF2710
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2711
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2712
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF2713
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF2714
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2715
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF2716
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF2717
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF2718
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2719
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF2720
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF2721
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF2722
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF2723
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF2724
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2725
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF2726
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2727
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF2728
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF2729
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF2730
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF2731
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF2732
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF2733
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF2734
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF2735
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF2736
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF2737
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF2738
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF2739
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF2740
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF2741
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF2742
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF2743
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF2744
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF2745
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF2746
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF2747
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF2748
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF2749
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF2750
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF2751
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF2752
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF2753
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF2754
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF2755
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF2756
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2757
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF2758
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2759
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF2760
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2761
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2762
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2763
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2764
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2765
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2766
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2767
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2768
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2769
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2770
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2771
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2772
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2773
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2774
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2775
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2776
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2777
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2778
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2779
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2780
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2781
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2782
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2783
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2784
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2785
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2786
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2787
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2788
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2789
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2790
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2791
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2792
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2793
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2794
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2795
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2796
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2797
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2798
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2799
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2800
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2801
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2802
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2803
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2804
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2805
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2806
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2807
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2808
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2809
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2810
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2811
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2812
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2813
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2814
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2815
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2816
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2817
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2818
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2819
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2820
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2821
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2822
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2823
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2824
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2825
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2826
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2827
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2828
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2829
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2830
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2831
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2832
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2833
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2834
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2835
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2836
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2837
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2838
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2839
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2840
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2841
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2842
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2843
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2844
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2845
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2846
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2847
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2848
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2849
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2850
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2851
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2852
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2853
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2854
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2855
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2856
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2857
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2858
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2859
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2860
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2861
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2862
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2863
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2864
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2865
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2866
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2867
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2868
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2869
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2870
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2871
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2872
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2873
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2874
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2875
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2876
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2877
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2878
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2879
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2880
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2881
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2882
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2883
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2884
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2885
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2886
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2887
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2888
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2889
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2890
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2891
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2892
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2893
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2894
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2895
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2896
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2897
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2898
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2899
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2900
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2901
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2902
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2903
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2904
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2905
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2906
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2907
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2908
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2909
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2910
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2911
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2912
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2913
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_uart.h.26.d7df672ceb076edc577f28d9952e617b,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2916
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2917
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2918
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2919
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2920
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2921
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2922
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2923
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2924
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2925
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2926
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2927
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2928
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2929
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2930
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2931
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2932
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_tcp.h.25.0d607b14f5540424c2584e8e0964677c,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2933
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2934
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2935
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF3247
+	.long	.LASF3248
+	.long	.LASF3249
+	.long	.LASF3250
+	.long	.LASF3251
+	.long	.LASF3252
+	.long	.LASF3253
+	.long	.LASF3254
+	.long	.LASF3255
+	.long	.LASF3256
+	.long	.LASF3257
+	.long	.LASF3258
+	.long	.LASF3259
+	.long	.LASF3260
+	.long	.LASF3261
+	.long	.LASF3262
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x75
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3263
+	.byte	0xc
+	.long	.LASF3264
+	.byte	0xc
+	.long	.LASF3265
+	.byte	0xf
+	.long	.LASF3266
+	.byte	0x10
+	.long	.LASF3267
+	.byte	0xb
+	.long	.LASF3268
+	.byte	0xb
+	.long	.LASF3269
+	.byte	0xf
+	.long	.LASF3270
+	.byte	0xf
+	.long	.LASF3271
+	.byte	0xc
+	.long	.LASF3272
+	.byte	0xc
+	.long	.LASF3273
+	.byte	0x9
+	.long	.LASF3272
+	.byte	0xe
+	.long	.LASF3274
+	.byte	0x3
+	.long	.LASF3275
+	.byte	0x2
+	.long	.LASF3276
+	.byte	0xc
+	.long	.LASF3277
+	.byte	0x2
+	.long	.LASF3278
+	.byte	0x3
+	.long	.LASF3279
+	.byte	0x3
+	.long	.LASF3280
+	.byte	0xf
+	.long	.LASF3281
+	.byte	0xf
+	.long	.LASF3282
+	.byte	0xc
+	.long	.LASF3283
+	.byte	0xf
+	.long	.LASF3284
+	.byte	0xf
+	.long	.LASF3285
+	.byte	0x10
+	.long	.LASF3265
+	.byte	0x10
+	.long	.LASF3286
+	.byte	0xc
+	.long	.LASF3287
+	.byte	0xf
+	.long	.LASF3288
+	.byte	0xf
+	.long	.LASF3289
+	.byte	0xc
+	.long	.LASF3290
+	.byte	0xc
+	.long	.LASF3291
+	.byte	0xe
+	.long	.LASF3292
+	.byte	0xc
+	.long	.LASF3293
+	.byte	0xd
+	.long	.LASF3294
+	.byte	0xd
+	.long	.LASF3295
+	.byte	0xc
+	.long	.LASF3296
+	.byte	0xc
+	.long	.LASF3297
+	.byte	0xc
+	.long	.LASF3298
+	.byte	0xc
+	.long	.LASF3299
+	.byte	0x10
+	.long	.LASF3300
+	.byte	0xb
+	.long	.LASF3301
+	.byte	0xb
+	.long	.LASF3302
+	.byte	0xb
+	.long	.LASF3303
+	.byte	0xb
+	.long	.LASF3304
+	.byte	0xb
+	.long	.LASF3305
+	.byte	0xc
+	.long	.LASF3306
+	.byte	0xc
+	.long	.LASF3307
+	.byte	0xc
+	.long	.LASF3269
+	.byte	0xc
+	.long	.LASF3308
+	.byte	0xb
+	.long	.LASF3309
+	.byte	0xb
+	.long	.LASF3310
+	.byte	0xf
+	.long	.LASF3283
+	.byte	0xc
+	.long	.LASF3283
+	.byte	0x8
+	.long	.LASF3283
+	.byte	0xa
+	.long	.LASF3283
+	.byte	0x7
+	.long	.LASF3311
+	.byte	0x7
+	.long	.LASF3312
+	.byte	0xb
+	.long	.LASF3281
+	.byte	0xc
+	.long	.LASF3313
+	.byte	0xc
+	.long	.LASF3314
+	.byte	0xb
+	.long	.LASF3315
+	.byte	0x8
+	.long	.LASF3316
+	.byte	0xb
+	.long	.LASF3317
+	.byte	0xc
+	.long	.LASF3318
+	.byte	0xc
+	.long	.LASF3319
+	.byte	0xb
+	.long	.LASF3320
+	.byte	0xc
+	.long	.LASF3321
+	.byte	0xc
+	.long	.LASF3322
+	.byte	0xc
+	.long	.LASF3323
+	.byte	0xc
+	.long	.LASF3324
+	.byte	0xc
+	.long	.LASF3325
+	.byte	0xc
+	.long	.LASF3326
+	.byte	0xc
+	.long	.LASF3327
+	.byte	0xc
+	.long	.LASF3328
+	.byte	0x8
+	.long	.LASF3329
+	.byte	0x6
+	.long	.LASF3263
+	.byte	0xe
+	.long	.LASF3330
+	.byte	0xb
+	.long	.LASF3331
+	.byte	0xb
+	.long	.LASF3332
+	.byte	0xb
+	.long	.LASF3317
+	.byte	0xf
+	.long	.LASF3333
+	.byte	0xc
+	.long	.LASF3334
+	.byte	0xe
+	.long	.LASF3334
+	.byte	0xc
+	.long	.LASF3335
+	.byte	0xb
+	.long	.LASF3336
+	.byte	0xb
+	.long	.LASF3337
+	.byte	0xb
+	.long	.LASF3338
+	.byte	0xc
+	.long	.LASF3339
+	.byte	0xc
+	.long	.LASF3340
+	.byte	0xc
+	.long	.LASF3341
+	.byte	0xc
+	.long	.LASF3342
+	.byte	0xc
+	.long	.LASF3343
+	.byte	0xc
+	.long	.LASF3272
+	.byte	0xa
+	.long	.LASF3272
+	.byte	0x7
+	.long	.LASF3344
+	.byte	0x8
+	.long	.LASF3266
+	.byte	0x8
+	.long	.LASF3344
+	.byte	0xa
+	.long	.LASF3345
+	.byte	0xa
+	.long	.LASF3344
+	.byte	0x7
+	.long	.LASF3346
+	.byte	0xa
+	.long	.LASF3346
+	.byte	0x7
+	.long	.LASF3347
+	.byte	0xa
+	.long	.LASF3347
+	.byte	0x7
+	.long	.LASF3348
+	.byte	0xb
+	.long	.LASF3273
+	.byte	0xc
+	.long	.LASF3349
+	.byte	0x9
+	.long	.LASF3350
+	.byte	0x5
+	.long	.LASF3351
+	.byte	0x4
+	.long	.LASF3352
+	.byte	0x4
+	.long	.LASF3353
+	.byte	0x1
+	.long	.LASF3354
+	.byte	0x1
+	.long	.LASF3355
+	.byte	0x2
+	.long	.LASF3356
+	.byte	0x2
+	.long	.LASF3357
+	.byte	0x2
+	.long	.LASF3358
+	.byte	0x2
+	.long	.LASF3359
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2180:
+	.string	"IPPROTO_COMP IPPROTO_COMP"
+.LASF2110:
+	.string	"IPV6_RECVERR 25"
+.LASF2992:
+	.string	"long long int"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1636:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LINTFLAGS _CS_POSIX_V7_LP64_OFF64_LINTFLAGS"
+.LASF1496:
+	.string	"_SC_C_LANG_SUPPORT_R _SC_C_LANG_SUPPORT_R"
+.LASF1155:
+	.string	"AT_REMOVEDIR 0x200"
+.LASF3064:
+	.string	"IPPROTO_TP"
+.LASF1316:
+	.string	"_POSIX_V6_LPBIG_OFFBIG -1"
+.LASF3079:
+	.string	"IPPROTO_ETHERNET"
+.LASF873:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2930:
+	.string	"UART8_RX_BUFFER_SIZE 256"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1536:
+	.string	"_SC_V6_ILP32_OFF32 _SC_V6_ILP32_OFF32"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF3167:
+	.string	"rxBufferHead"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1441:
+	.string	"_SC_THREAD_PRIO_PROTECT _SC_THREAD_PRIO_PROTECT"
+.LASF2865:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2573:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF874:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF2994:
+	.string	"SOCK_DGRAM"
+.LASF2538:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF872:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF3172:
+	.string	"rxFrameCallback"
+.LASF2912:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF956:
+	.string	"ENOTUNIQ 76"
+.LASF2897:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF2816:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1038:
+	.string	"__O_NOFOLLOW 0400000"
+.LASF2145:
+	.string	"IPV6_ADD_MEMBERSHIP IPV6_JOIN_GROUP"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1617:
+	.string	"_CS_POSIX_V6_LP64_OFF64_CFLAGS _CS_POSIX_V6_LP64_OFF64_CFLAGS"
+.LASF960:
+	.string	"ELIBBAD 80"
+.LASF2982:
+	.string	"__pad5"
+.LASF1157:
+	.string	"AT_NO_AUTOMOUNT 0x800"
+.LASF881:
+	.string	"EPERM 1"
+.LASF1083:
+	.string	"F_ADD_SEALS 1033"
+.LASF2522:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2090:
+	.string	"IPV6_ADDRFORM 1"
+.LASF2939:
+	.string	"long unsigned int"
+.LASF1799:
+	.string	"AF_INET PF_INET"
+.LASF2324:
+	.string	"TCP_COOKIE_PAIR_SIZE (2*TCP_COOKIE_MAX)"
+.LASF2390:
+	.string	"__wchar_t__ "
+.LASF3199:
+	.string	"strerror"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1072:
+	.string	"__F_SETOWN_EX 15"
+.LASF1211:
+	.string	"S_IFLNK __S_IFLNK"
+.LASF2417:
+	.string	"GYRO "
+.LASF1407:
+	.string	"_SC_2_C_DEV _SC_2_C_DEV"
+.LASF2078:
+	.string	"IP_RECVFRAGSIZE 25"
+.LASF2018:
+	.string	"SCM_TIMESTAMP SO_TIMESTAMP"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF1785:
+	.string	"PF_CAIF 37"
+.LASF2778:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF817:
+	.string	"SEEK_DATA 3"
+.LASF2252:
+	.string	"TCP_CORK 3"
+.LASF1081:
+	.string	"F_SETPIPE_SZ 1031"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF789:
+	.string	"__need___va_list"
+.LASF1595:
+	.string	"_CS_XBS5_ILP32_OFF32_LIBS _CS_XBS5_ILP32_OFF32_LIBS"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1124:
+	.string	"FFSYNC O_FSYNC"
+.LASF2152:
+	.string	"IPV6_PMTUDISC_PROBE 3"
+.LASF2701:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1529:
+	.string	"_SC_2_PBS_ACCOUNTING _SC_2_PBS_ACCOUNTING"
+.LASF1470:
+	.string	"_SC_SSIZE_MAX _SC_SSIZE_MAX"
+.LASF1292:
+	.string	"_POSIX_REGEXP 1"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2436:
+	.string	"USE_PWM"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2495:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1288:
+	.string	"_LFS64_STDIO 1"
+.LASF1781:
+	.string	"PF_RXRPC 33"
+.LASF2742:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF2221:
+	.string	"INADDR_ALLSNOOPERS_GROUP ((in_addr_t) 0xe000006a)"
+.LASF1170:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF967:
+	.string	"EUSERS 87"
+.LASF1336:
+	.string	"L_XTND SEEK_END"
+.LASF1577:
+	.string	"_CS_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF837:
+	.string	"_BITS_FLOATN_H "
+.LASF2458:
+	.string	"VTX_CONTROL"
+.LASF2928:
+	.string	"UART7_RX_BUFFER_SIZE 256"
+.LASF2500:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF1145:
+	.string	"FALLOC_FL_KEEP_SIZE 0x01"
+.LASF1999:
+	.string	"SO_TIMESTAMPING_OLD 37"
+.LASF3205:
+	.string	"recv"
+.LASF1857:
+	.string	"SOL_RXRPC 272"
+.LASF1641:
+	.string	"_CS_V6_ENV _CS_V6_ENV"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1806:
+	.string	"AF_X25 PF_X25"
+.LASF3023:
+	.string	"MSG_MORE"
+.LASF1854:
+	.string	"SOL_DCCP 269"
+.LASF804:
+	.string	"__cookie_io_functions_t_defined 1"
+.LASF2123:
+	.string	"IPV6_HOPLIMIT 52"
+.LASF1604:
+	.string	"_CS_XBS5_LP64_OFF64_LINTFLAGS _CS_XBS5_LP64_OFF64_LINTFLAGS"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1665:
+	.string	"__suseconds_t_defined "
+.LASF1275:
+	.string	"_POSIX_THREAD_PRIO_INHERIT 200809L"
+.LASF2210:
+	.string	"IN_EXPERIMENTAL(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xe0000000)"
+.LASF1293:
+	.string	"_POSIX_READER_WRITER_LOCKS 200809L"
+.LASF997:
+	.string	"EUCLEAN 117"
+.LASF3202:
+	.string	"memset"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2954:
+	.string	"uintptr_t"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2136:
+	.string	"IPV6_AUTOFLOWLABEL 70"
+.LASF1299:
+	.string	"_POSIX_BARRIERS 200809L"
+.LASF2892:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1925:
+	.string	"__ASM_GENERIC_SOCKIOS_H "
+.LASF1941:
+	.string	"SO_RCVBUF 8"
+.LASF2087:
+	.string	"IP_DEFAULT_MULTICAST_TTL 1"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1905:
+	.string	"CMSG_SPACE(len) (CMSG_ALIGN (len) + CMSG_ALIGN (sizeof (struct cmsghdr)))"
+.LASF2112:
+	.string	"IPV6_JOIN_ANYCAST 27"
+.LASF1720:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF3077:
+	.string	"IPPROTO_UDPLITE"
+.LASF2213:
+	.string	"INADDR_BROADCAST ((in_addr_t) 0xffffffff)"
+.LASF2052:
+	.string	"MCAST_LEAVE_SOURCE_GROUP 47"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF29:
+	.string	"_LP64 1"
+.LASF2363:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF2194:
+	.string	"IN_CLASSA(a) ((((in_addr_t)(a)) & 0x80000000) == 0)"
+.LASF1519:
+	.string	"_SC_SPAWN _SC_SPAWN"
+.LASF2328:
+	.string	"TCP_S_DATA_OUT (1 << 3)"
+.LASF2812:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"_IOLBF 1"
+.LASF1983:
+	.string	"SO_DETACH_BPF SO_DETACH_FILTER"
+.LASF2036:
+	.string	"IP_RETOPTS 7"
+.LASF2465:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF2293:
+	.string	"TH_RST 0x04"
+.LASF1405:
+	.string	"_SC_2_VERSION _SC_2_VERSION"
+.LASF1531:
+	.string	"_SC_2_PBS_MESSAGE _SC_2_PBS_MESSAGE"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF1889:
+	.string	"MSG_FIN MSG_FIN"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1522:
+	.string	"_SC_SYSTEM_DATABASE _SC_SYSTEM_DATABASE"
+.LASF1823:
+	.string	"AF_WANPIPE PF_WANPIPE"
+.LASF2261:
+	.string	"TCP_QUICKACK 12"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1086:
+	.string	"F_SET_RW_HINT 1036"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2804:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1880:
+	.string	"MSG_PEEK MSG_PEEK"
+.LASF1193:
+	.string	"__S_IFSOCK 0140000"
+.LASF915:
+	.string	"EDEADLK 35"
+.LASF1171:
+	.string	"__BIG_ENDIAN 4321"
+.LASF937:
+	.string	"EBADSLT 57"
+.LASF1598:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LDFLAGS _CS_XBS5_ILP32_OFFBIG_LDFLAGS"
+.LASF1256:
+	.string	"_POSIX_PRIORITY_SCHEDULING 200809L"
+.LASF1222:
+	.string	"S_IXGRP (S_IXUSR >> 3)"
+.LASF1605:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_CFLAGS _CS_XBS5_LPBIG_OFFBIG_CFLAGS"
+.LASF3009:
+	.string	"MSG_DONTROUTE"
+.LASF3092:
+	.string	"OWNER_FREE"
+.LASF2521:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF3088:
+	.string	"__in6_u"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF3138:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF3083:
+	.string	"in_port_t"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1620:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LINTFLAGS _CS_POSIX_V6_LP64_OFF64_LINTFLAGS"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF2696:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1224:
+	.string	"S_IROTH (S_IRGRP >> 3)"
+.LASF2027:
+	.string	"__SOCKADDR_ONETYPE"
+.LASF2193:
+	.string	"IPPROTO_MH IPPROTO_MH"
+.LASF1203:
+	.string	"UTIME_NOW ((1l << 30) - 1l)"
+.LASF2499:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF1746:
+	.string	"PF_LOCAL 1"
+.LASF2456:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1867:
+	.string	"SOL_TLS 282"
+.LASF2625:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2311:
+	.string	"TCP_MAXWIN 65535"
+.LASF2084:
+	.string	"IP_PMTUDISC_INTERFACE 4"
+.LASF1246:
+	.string	"_XOPEN_XCU_VERSION 4"
+.LASF2535:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1197:
+	.string	"__S_ISUID 04000"
+.LASF1621:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS"
+.LASF2751:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2072:
+	.string	"IP_ORIGDSTADDR 20"
+.LASF2493:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF2654:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1984:
+	.string	"SO_ATTACH_REUSEPORT_CBPF 51"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1710:
+	.string	"__blkcnt_t_defined "
+.LASF3014:
+	.string	"MSG_DONTWAIT"
+.LASF1858:
+	.string	"SOL_PPPOL2TP 273"
+.LASF1888:
+	.string	"MSG_WAITALL MSG_WAITALL"
+.LASF1095:
+	.string	"F_SHLCK 8"
+.LASF1680:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF2738:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF3219:
+	.string	"tcpWrite"
+.LASF3230:
+	.string	"free"
+.LASF2203:
+	.string	"IN_CLASSB_MAX 65536"
+.LASF2102:
+	.string	"IPV6_MULTICAST_IF 17"
+.LASF2717:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF3024:
+	.string	"MSG_WAITFORONE"
+.LASF1339:
+	.string	"_PC_MAX_INPUT _PC_MAX_INPUT"
+.LASF3025:
+	.string	"MSG_BATCH"
+.LASF1080:
+	.string	"F_NOTIFY 1026"
+.LASF2383:
+	.string	"_PTRDIFF_T_ "
+.LASF818:
+	.string	"SEEK_HOLE 4"
+.LASF803:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1249:
+	.string	"_XOPEN_XPG4 1"
+.LASF2931:
+	.string	"UART8_TX_BUFFER_SIZE 256"
+.LASF2514:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2726:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF958:
+	.string	"EREMCHG 78"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF2043:
+	.string	"IP_BLOCK_SOURCE 38"
+.LASF1774:
+	.string	"PF_LLC 26"
+.LASF3107:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF3020:
+	.string	"MSG_RST"
+.LASF1825:
+	.string	"AF_IB PF_IB"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF836:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF2953:
+	.string	"uint32_t"
+.LASF2537:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF3188:
+	.string	"tcpPort_s"
+.LASF3194:
+	.string	"tcpPort_t"
+.LASF2643:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2283:
+	.string	"TCP_FASTOPEN_NO_COOKIE 34"
+.LASF2650:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2051:
+	.string	"MCAST_JOIN_SOURCE_GROUP 46"
+.LASF1151:
+	.string	"FALLOC_FL_UNSHARE_RANGE 0x40"
+.LASF931:
+	.string	"EL2HLT 51"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF1202:
+	.string	"__S_IEXEC 0100"
+.LASF3019:
+	.string	"MSG_CONFIRM"
+.LASF1591:
+	.string	"_CS_LFS64_LIBS _CS_LFS64_LIBS"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1163:
+	.string	"AT_RECURSIVE 0x8000"
+.LASF3084:
+	.string	"__u6_addr8"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF974:
+	.string	"ESOCKTNOSUPPORT 94"
+.LASF1219:
+	.string	"S_IRWXU (__S_IREAD|__S_IWRITE|__S_IEXEC)"
+.LASF2197:
+	.string	"IN_CLASSA_HOST (0xffffffff & ~IN_CLASSA_NET)"
+.LASF1977:
+	.string	"SO_SELECT_ERR_QUEUE 45"
+.LASF1064:
+	.string	"F_GETFL 3"
+.LASF2895:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF823:
+	.string	"FILENAME_MAX 4096"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF2713:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2278:
+	.string	"TCP_REPAIR_WINDOW 29"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF2581:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1644:
+	.string	"_GETOPT_CORE_H 1"
+.LASF2923:
+	.string	"UART4_TX_BUFFER_SIZE 256"
+.LASF1635:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LIBS _CS_POSIX_V7_LP64_OFF64_LIBS"
+.LASF1385:
+	.string	"_SC_MQ_OPEN_MAX _SC_MQ_OPEN_MAX"
+.LASF1924:
+	.string	"__ASM_GENERIC_BITS_PER_LONG "
+.LASF2692:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1104:
+	.string	"DN_ACCESS 0x00000001"
+.LASF2512:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF846:
+	.string	"__HAVE_FLOAT32 1"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF3122:
+	.string	"OWNER_OSD_CS"
+.LASF2386:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1223:
+	.string	"S_IRWXG (S_IRWXU >> 3)"
+.LASF3212:
+	.string	"tcpSerialOpen"
+.LASF2688:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF858:
+	.string	"__f32(x) x ##f32"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF3217:
+	.string	"tcpSetMode"
+.LASF2794:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2988:
+	.string	"_IO_wide_data"
+.LASF1015:
+	.string	"errno (*__errno_location ())"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1067:
+	.string	"__F_GETOWN 9"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1923:
+	.string	"__BITS_PER_LONG 64"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF2174:
+	.string	"IPPROTO_ESP IPPROTO_ESP"
+.LASF2641:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2623:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1082:
+	.string	"F_GETPIPE_SZ 1032"
+.LASF3155:
+	.string	"serialReceiveCallbackPtr"
+.LASF2364:
+	.string	"TELEMETRY_MAVLINK "
+.LASF1457:
+	.string	"_SC_2_UPE _SC_2_UPE"
+.LASF1327:
+	.string	"STDIN_FILENO 0"
+.LASF2515:
+	.string	"BIT(x) (1 << (x))"
+.LASF2610:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF2734:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF2832:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF3186:
+	.string	"serialPort_t"
+.LASF3240:
+	.string	"__bsx"
+.LASF2365:
+	.string	"TELEMETRY_SRXL "
+.LASF1701:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF996:
+	.string	"ESTALE 116"
+.LASF2885:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF2598:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2212:
+	.string	"INADDR_ANY ((in_addr_t) 0x00000000)"
+.LASF1166:
+	.string	"__mode_t_defined "
+.LASF2476:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1646:
+	.string	"_LINUX_CLOSE_RANGE_H "
+.LASF1891:
+	.string	"MSG_CONFIRM MSG_CONFIRM"
+.LASF801:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF1965:
+	.string	"SO_ACCEPTCONN 30"
+.LASF1855:
+	.string	"SOL_NETLINK 270"
+.LASF2856:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2168:
+	.string	"IPPROTO_IDP IPPROTO_IDP"
+.LASF2306:
+	.string	"TCPOPT_TIMESTAMP 8"
+.LASF2341:
+	.string	"USE_PWM "
+.LASF1187:
+	.string	"__S_IFDIR 0040000"
+.LASF1697:
+	.string	"__timeval_defined 1"
+.LASF2898:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1782:
+	.string	"PF_ISDN 34"
+.LASF1263:
+	.string	"_POSIX_CHOWN_RESTRICTED 0"
+.LASF1420:
+	.string	"_SC_IOV_MAX _SC_IOV_MAX"
+.LASF1874:
+	.string	"__SOCKADDR_COMMON(sa_prefix) sa_family_t sa_prefix ##family"
+.LASF2187:
+	.string	"IPPROTO_HOPOPTS IPPROTO_HOPOPTS"
+.LASF1574:
+	.string	"_SC_MINSIGSTKSZ _SC_MINSIGSTKSZ"
+.LASF946:
+	.string	"EREMOTE 66"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2425:
+	.string	"USE_UART1 "
+.LASF2666:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1156:
+	.string	"AT_SYMLINK_FOLLOW 0x400"
+.LASF1031:
+	.string	"O_APPEND 02000"
+.LASF2661:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF2264:
+	.string	"TCP_COOKIE_TRANSACTIONS 15"
+.LASF1195:
+	.string	"__S_TYPEISSEM(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF1326:
+	.string	"__LP64_OFF64_LDFLAGS \"-m64\""
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF977:
+	.string	"EAFNOSUPPORT 97"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF2438:
+	.string	"USE_SERIALRX_CRSF"
+.LASF815:
+	.string	"SEEK_CUR 1"
+.LASF2307:
+	.string	"TCPOLEN_TIMESTAMP 10"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF2096:
+	.string	"IPV6_CHECKSUM 7"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF3101:
+	.string	"OWNER_ADC_EXT"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF2808:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF545:
+	.string	"__wur "
+.LASF969:
+	.string	"EDESTADDRREQ 89"
+.LASF2520:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF939:
+	.string	"EBFONT 59"
+.LASF827:
+	.string	"FOPEN_MAX 16"
+.LASF2250:
+	.string	"TCP_NODELAY 1"
+.LASF3143:
+	.string	"MODE_RXTX"
+.LASF2532:
+	.string	"IOCFG_IPD 0"
+.LASF2584:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF2525:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF2334:
+	.string	"I2C1_OVERCLOCK true"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2354:
+	.string	"TELEMETRY_HOTT "
+.LASF2882:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1770:
+	.string	"PF_SNA 22"
+.LASF2855:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2735:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF2055:
+	.string	"IP_UNICAST_IF 50"
+.LASF2237:
+	.string	"IN6_IS_ADDR_LOOPBACK(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == htonl (1); }))"
+.LASF842:
+	.string	"__f128(x) x ##f128"
+.LASF921:
+	.string	"EWOULDBLOCK EAGAIN"
+.LASF1074:
+	.string	"F_SETSIG __F_SETSIG"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF2910:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF3168:
+	.string	"rxBufferTail"
+.LASF3028:
+	.string	"MSG_CMSG_CLOEXEC"
+.LASF1060:
+	.string	"O_RSYNC O_SYNC"
+.LASF1851:
+	.string	"SOL_IRDA 266"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2301:
+	.string	"TCPOPT_WINDOW 3"
+.LASF1434:
+	.string	"_SC_THREAD_KEYS_MAX _SC_THREAD_KEYS_MAX"
+.LASF1257:
+	.string	"_POSIX_SYNCHRONIZED_IO 200809L"
+.LASF889:
+	.string	"EBADF 9"
+.LASF2792:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1030:
+	.string	"O_TRUNC 01000"
+.LASF1580:
+	.string	"_CS_GNU_LIBPTHREAD_VERSION _CS_GNU_LIBPTHREAD_VERSION"
+.LASF2766:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2859:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF3054:
+	.string	"s_addr"
+.LASF2513:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1684:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF990:
+	.string	"ETIMEDOUT 110"
+.LASF2054:
+	.string	"IP_MULTICAST_ALL 49"
+.LASF1938:
+	.string	"SO_DONTROUTE 5"
+.LASF1281:
+	.string	"_POSIX_ASYNCHRONOUS_IO 200809L"
+.LASF1154:
+	.string	"AT_SYMLINK_NOFOLLOW 0x100"
+.LASF1479:
+	.string	"_SC_NL_ARGMAX _SC_NL_ARGMAX"
+.LASF1225:
+	.string	"S_IWOTH (S_IWGRP >> 3)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF2978:
+	.string	"_codecvt"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1586:
+	.string	"_CS_LFS_LDFLAGS _CS_LFS_LDFLAGS"
+.LASF2644:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1324:
+	.string	"__ILP32_OFFBIG_LDFLAGS \"-m32\""
+.LASF1884:
+	.string	"MSG_PROXY MSG_PROXY"
+.LASF2158:
+	.string	"IPV6_RTHDR_STRICT 1"
+.LASF1667:
+	.string	"_ENDIAN_H 1"
+.LASF2170:
+	.string	"IPPROTO_DCCP IPPROTO_DCCP"
+.LASF1418:
+	.string	"_SC_SELECT _SC_SELECT"
+.LASF2469:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2527:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF3166:
+	.string	"txBuffer"
+.LASF2412:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF3001:
+	.string	"SOCK_NONBLOCK"
+.LASF2995:
+	.string	"SOCK_RAW"
+.LASF2366:
+	.string	"USE_DASHBOARD "
+.LASF869:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF1032:
+	.string	"O_NONBLOCK 04000"
+.LASF1564:
+	.string	"_SC_V7_LP64_OFF64 _SC_V7_LP64_OFF64"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2984:
+	.string	"_unused2"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1565:
+	.string	"_SC_V7_LPBIG_OFFBIG _SC_V7_LPBIG_OFFBIG"
+.LASF1486:
+	.string	"_SC_XBS5_ILP32_OFFBIG _SC_XBS5_ILP32_OFFBIG"
+.LASF1643:
+	.string	"_GETOPT_POSIX_H 1"
+.LASF3174:
+	.string	"serialWrite"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF2294:
+	.string	"TH_PUSH 0x08"
+.LASF985:
+	.string	"ENOBUFS 105"
+.LASF1333:
+	.string	"__socklen_t_defined "
+.LASF1879:
+	.string	"MSG_OOB MSG_OOB"
+.LASF3087:
+	.string	"in6_addr"
+.LASF2955:
+	.string	"size_t"
+.LASF1982:
+	.string	"SO_ATTACH_BPF 50"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2826:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1775:
+	.string	"PF_IB 27"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1970:
+	.string	"SO_DOMAIN 39"
+.LASF2010:
+	.string	"SO_RESERVE_MEM 73"
+.LASF2620:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2270:
+	.string	"TCP_QUEUE_SEQ 21"
+.LASF1226:
+	.string	"S_IXOTH (S_IXGRP >> 3)"
+.LASF1996:
+	.string	"SO_BINDTOIFINDEX 62"
+.LASF1809:
+	.string	"AF_DECnet PF_DECnet"
+.LASF1915:
+	.string	"__struct_group(TAG,NAME,ATTRS,MEMBERS...) union { struct { MEMBERS } ATTRS; struct __struct_group_tag(TAG) { MEMBERS } ATTRS NAME; } ATTRS"
+.LASF795:
+	.string	"__FILE_defined 1"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF2606:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2678:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF2721:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2375:
+	.string	"VTX_TRAMP "
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF904:
+	.string	"EMFILE 24"
+.LASF1669:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF992:
+	.string	"EHOSTDOWN 112"
+.LASF2076:
+	.string	"IP_CHECKSUM 23"
+.LASF3182:
+	.string	"beginWrite"
+.LASF1850:
+	.string	"SOL_AAL 265"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF787:
+	.string	"__need_NULL"
+.LASF2669:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1294:
+	.string	"_POSIX_SHELL 1"
+.LASF3206:
+	.string	"setsockopt"
+.LASF3073:
+	.string	"IPPROTO_ENCAP"
+.LASF2175:
+	.string	"IPPROTO_AH IPPROTO_AH"
+.LASF1546:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC _SC_LEVEL1_ICACHE_ASSOC"
+.LASF3100:
+	.string	"OWNER_ADC_CURR"
+.LASF2198:
+	.string	"IN_CLASSA_MAX 128"
+.LASF945:
+	.string	"ENOPKG 65"
+.LASF3081:
+	.string	"IPPROTO_MPTCP"
+.LASF1214:
+	.string	"S_ISGID __S_ISGID"
+.LASF2017:
+	.string	"SO_SNDTIMEO SO_SNDTIMEO_OLD"
+.LASF1876:
+	.string	"_SS_SIZE 128"
+.LASF2854:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF854:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF2983:
+	.string	"_mode"
+.LASF1227:
+	.string	"S_IRWXO (S_IRWXG >> 3)"
+.LASF1670:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF2597:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2829:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2555:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF2154:
+	.string	"IPV6_PMTUDISC_OMIT 5"
+.LASF1518:
+	.string	"_SC_SIGNALS _SC_SIGNALS"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF2202:
+	.string	"IN_CLASSB_HOST (0xffffffff & ~IN_CLASSB_NET)"
+.LASF1141:
+	.string	"SPLICE_F_NONBLOCK 2"
+.LASF2548:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF2996:
+	.string	"SOCK_RDM"
+.LASF2664:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1314:
+	.string	"_POSIX_TYPED_MEMORY_OBJECTS -1"
+.LASF1380:
+	.string	"_SC_SHARED_MEMORY_OBJECTS _SC_SHARED_MEMORY_OBJECTS"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF3211:
+	.string	"uartOpen"
+.LASF991:
+	.string	"ECONNREFUSED 111"
+.LASF2631:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2755:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2876:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2639:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1196:
+	.string	"__S_TYPEISSHM(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1493:
+	.string	"_SC_BARRIERS _SC_BARRIERS"
+.LASF1731:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1922:
+	.string	"__ASM_X86_BITSPERLONG_H "
+.LASF1485:
+	.string	"_SC_XBS5_ILP32_OFF32 _SC_XBS5_ILP32_OFF32"
+.LASF1814:
+	.string	"AF_ROUTE PF_ROUTE"
+.LASF800:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF1963:
+	.string	"SO_GET_FILTER SO_ATTACH_FILTER"
+.LASF862:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF2206:
+	.string	"IN_CLASSC_NSHIFT 8"
+.LASF814:
+	.string	"SEEK_SET 0"
+.LASF3094:
+	.string	"OWNER_PPMINPUT"
+.LASF1383:
+	.string	"_SC_AIO_PRIO_DELTA_MAX _SC_AIO_PRIO_DELTA_MAX"
+.LASF981:
+	.string	"ENETUNREACH 101"
+.LASF828:
+	.string	"_PRINTF_NAN_LEN_MAX 4"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2744:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF2182:
+	.string	"IPPROTO_UDPLITE IPPROTO_UDPLITE"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF894:
+	.string	"EFAULT 14"
+.LASF2349:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1278:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_PROTECT -1"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF2681:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2595:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF2325:
+	.string	"TCP_COOKIE_IN_ALWAYS (1 << 0)"
+.LASF3208:
+	.string	"close"
+.LASF1732:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF3181:
+	.string	"writeBuf"
+.LASF2872:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1186:
+	.string	"__S_IFMT 0170000"
+.LASF995:
+	.string	"EINPROGRESS 115"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2864:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF3244:
+	.string	"stderr"
+.LASF2563:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1079:
+	.string	"F_GETLEASE 1025"
+.LASF2524:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2593:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2803:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2125:
+	.string	"IPV6_HOPOPTS 54"
+.LASF885:
+	.string	"EIO 5"
+.LASF2004:
+	.string	"SO_SNDTIMEO_NEW 67"
+.LASF1691:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF2853:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2372:
+	.string	"VTX_COMMON "
+.LASF1460:
+	.string	"_SC_XOPEN_XPG4 _SC_XOPEN_XPG4"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2049:
+	.string	"MCAST_UNBLOCK_SOURCE 44"
+.LASF1217:
+	.string	"S_IWUSR __S_IWRITE"
+.LASF2739:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1410:
+	.string	"_SC_2_SW_DEV _SC_2_SW_DEV"
+.LASF3002:
+	.string	"sa_family_t"
+.LASF2845:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF938:
+	.string	"EDEADLOCK EDEADLK"
+.LASF2697:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2723:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1676:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF2825:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1229:
+	.string	"W_OK 2"
+.LASF1096:
+	.string	"LOCK_SH 1"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF840:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1378:
+	.string	"_SC_MESSAGE_PASSING _SC_MESSAGE_PASSING"
+.LASF2009:
+	.string	"SO_BUF_LOCK 72"
+.LASF2820:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1266:
+	.string	"_XOPEN_REALTIME 1"
+.LASF2710:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2487:
+	.string	"sq(x) ((x)*(x))"
+.LASF1332:
+	.string	"__useconds_t_defined "
+.LASF1512:
+	.string	"_SC_NETWORKING _SC_NETWORKING"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1901:
+	.string	"CMSG_DATA(cmsg) ((cmsg)->__cmsg_data)"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1868:
+	.string	"SOL_XDP 283"
+.LASF1258:
+	.string	"_POSIX_FSYNC 200809L"
+.LASF3062:
+	.string	"IPPROTO_UDP"
+.LASF2326:
+	.string	"TCP_COOKIE_OUT_NEVER (1 << 1)"
+.LASF2558:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF3178:
+	.string	"serialSetBaudRate"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2675:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1658:
+	.string	"__nlink_t_defined "
+.LASF2750:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF1523:
+	.string	"_SC_SYSTEM_DATABASE_R _SC_SYSTEM_DATABASE_R"
+.LASF2942:
+	.string	"__uint8_t"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2635:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1200:
+	.string	"__S_IREAD 0400"
+.LASF2896:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1375:
+	.string	"_SC_MEMLOCK _SC_MEMLOCK"
+.LASF1800:
+	.string	"AF_AX25 PF_AX25"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF2276:
+	.string	"TCP_SAVE_SYN 27"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF785:
+	.string	"NULL"
+.LASF2746:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF3152:
+	.string	"SERIAL_BIDIR"
+.LASF1723:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1637:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1795:
+	.string	"AF_UNSPEC PF_UNSPEC"
+.LASF2409:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1004:
+	.string	"EMEDIUMTYPE 124"
+.LASF1721:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF1183:
+	.string	"_STATBUF_ST_BLKSIZE "
+.LASF2032:
+	.string	"IP_TOS 1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1994:
+	.string	"SO_TXTIME 61"
+.LASF1168:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1747:
+	.string	"PF_UNIX PF_LOCAL"
+.LASF382:
+	.string	"unix 1"
+.LASF2564:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF2253:
+	.string	"TCP_KEEPIDLE 4"
+.LASF3157:
+	.string	"serialPort_s"
+.LASF2442:
+	.string	"USE_SERIALRX_SUMD"
+.LASF2258:
+	.string	"TCP_DEFER_ACCEPT 9"
+.LASF2262:
+	.string	"TCP_CONGESTION 13"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1974:
+	.string	"SO_PEEK_OFF 42"
+.LASF1677:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF2677:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1767:
+	.string	"PF_ECONET 19"
+.LASF2286:
+	.string	"TCP_CM_INQ TCP_INQ"
+.LASF3134:
+	.string	"OWNER_TRANSPONDER"
+.LASF2022:
+	.string	"SHUT_RD SHUT_RD"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF1709:
+	.string	"__blksize_t_defined "
+.LASF998:
+	.string	"ENOTNAM 118"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF1390:
+	.string	"_SC_RTSIG_MAX _SC_RTSIG_MAX"
+.LASF3207:
+	.string	"accept"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2870:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1692:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF1722:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1285:
+	.string	"_LFS64_ASYNCHRONOUS_IO 1"
+.LASF3069:
+	.string	"IPPROTO_ESP"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF1334:
+	.string	"L_SET SEEK_SET"
+.LASF1600:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LINTFLAGS _CS_XBS5_ILP32_OFFBIG_LINTFLAGS"
+.LASF1036:
+	.string	"O_ASYNC 020000"
+.LASF1602:
+	.string	"_CS_XBS5_LP64_OFF64_LDFLAGS _CS_XBS5_LP64_OFF64_LDFLAGS"
+.LASF2640:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1210:
+	.string	"S_IFIFO __S_IFIFO"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF2333:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF2583:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1181:
+	.string	"st_mtime st_mtim.tv_sec"
+.LASF1075:
+	.string	"F_GETSIG __F_GETSIG"
+.LASF1298:
+	.string	"_POSIX_TIMERS 200809L"
+.LASF2089:
+	.string	"IP_MAX_MEMBERSHIPS 20"
+.LASF2067:
+	.string	"IP_FREEBIND 15"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2275:
+	.string	"TCP_CC_INFO 26"
+.LASF3128:
+	.string	"OWNER_USB_DETECT"
+.LASF1345:
+	.string	"_PC_VDISABLE _PC_VDISABLE"
+.LASF2160:
+	.string	"IPPROTO_IP IPPROTO_IP"
+.LASF2266:
+	.string	"TCP_THIN_DUPACK 17"
+.LASF1997:
+	.string	"SO_TIMESTAMP_OLD 29"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1498:
+	.string	"_SC_CPUTIME _SC_CPUTIME"
+.LASF1484:
+	.string	"_SC_NL_TEXTMAX _SC_NL_TEXTMAX"
+.LASF1557:
+	.string	"_SC_LEVEL4_CACHE_SIZE _SC_LEVEL4_CACHE_SIZE"
+.LASF1180:
+	.string	"st_atime st_atim.tv_sec"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2630:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1113:
+	.string	"F_SEAL_GROW 0x0004"
+.LASF1749:
+	.string	"PF_INET 2"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF3050:
+	.string	"__SOCKADDR_ARG"
+.LASF1505:
+	.string	"_SC_PIPE _SC_PIPE"
+.LASF899:
+	.string	"ENODEV 19"
+.LASF1521:
+	.string	"_SC_THREAD_SPORADIC_SERVER _SC_THREAD_SPORADIC_SERVER"
+.LASF3115:
+	.string	"OWNER_SDCARD"
+.LASF1875:
+	.string	"__SOCKADDR_COMMON_SIZE (sizeof (unsigned short int))"
+.LASF1182:
+	.string	"st_ctime st_ctim.tv_sec"
+.LASF1688:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF2448:
+	.string	"TELEMETRY_HOTT"
+.LASF1251:
+	.string	"_XOPEN_ENH_I18N 1"
+.LASF1765:
+	.string	"PF_PACKET 17"
+.LASF2621:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1830:
+	.string	"AF_IUCV PF_IUCV"
+.LASF3133:
+	.string	"OWNER_LED_STRIP"
+.LASF1453:
+	.string	"_SC_XOPEN_ENH_I18N _SC_XOPEN_ENH_I18N"
+.LASF1949:
+	.string	"SO_BSDCOMPAT 14"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2809:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF845:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2531:
+	.string	"IOCFG_AF_OD 0"
+.LASF2015:
+	.string	"SO_TIMESTAMPING SO_TIMESTAMPING_OLD"
+.LASF1451:
+	.string	"_SC_XOPEN_UNIX _SC_XOPEN_UNIX"
+.LASF1489:
+	.string	"_SC_XOPEN_LEGACY _SC_XOPEN_LEGACY"
+.LASF2711:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF1865:
+	.string	"SOL_NFC 280"
+.LASF962:
+	.string	"ELIBMAX 82"
+.LASF1135:
+	.string	"POSIX_FADV_NOREUSE __POSIX_FADV_NOREUSE"
+.LASF1548:
+	.string	"_SC_LEVEL1_DCACHE_SIZE _SC_LEVEL1_DCACHE_SIZE"
+.LASF1849:
+	.string	"SOL_ATM 264"
+.LASF1651:
+	.string	"_SYS_SOCKET_H 1"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2891:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF3169:
+	.string	"txBufferHead"
+.LASF3224:
+	.string	"tcpRead"
+.LASF1370:
+	.string	"_SC_ASYNCHRONOUS_IO _SC_ASYNCHRONOUS_IO"
+.LASF1411:
+	.string	"_SC_2_LOCALEDEF _SC_2_LOCALEDEF"
+.LASF1990:
+	.string	"SO_COOKIE 57"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF829:
+	.string	"stdin stdin"
+.LASF2300:
+	.string	"TCPOLEN_MAXSEG 4"
+.LASF2343:
+	.string	"USE_SERIALRX_CRSF "
+.LASF3245:
+	.string	"__errno_location"
+.LASF2207:
+	.string	"IN_CLASSC_HOST (0xffffffff & ~IN_CLASSC_NET)"
+.LASF2403:
+	.string	"_GCC_WCHAR_T "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2837:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1146:
+	.string	"FALLOC_FL_PUNCH_HOLE 0x02"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1539:
+	.string	"_SC_V6_LPBIG_OFFBIG _SC_V6_LPBIG_OFFBIG"
+.LASF3022:
+	.string	"MSG_NOSIGNAL"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2268:
+	.string	"TCP_REPAIR 19"
+.LASF2707:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF2024:
+	.string	"SHUT_RDWR SHUT_RDWR"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2617:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2956:
+	.string	"_flags"
+.LASF1601:
+	.string	"_CS_XBS5_LP64_OFF64_CFLAGS _CS_XBS5_LP64_OFF64_CFLAGS"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF380:
+	.string	"__unix 1"
+.LASF1094:
+	.string	"F_EXLCK 4"
+.LASF1907:
+	.string	"__CMSG_PADDING(len) ((sizeof (size_t) - ((len) & (sizeof (size_t) - 1))) & (sizeof (size_t) - 1))"
+.LASF1530:
+	.string	"_SC_2_PBS_LOCATE _SC_2_PBS_LOCATE"
+.LASF2314:
+	.string	"TCPI_OPT_TIMESTAMPS 1"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF3246:
+	.string	"tcpSerialPollAll"
+.LASF1041:
+	.string	"__O_NOATIME 01000000"
+.LASF1172:
+	.string	"__PDP_ENDIAN 3412"
+.LASF3053:
+	.string	"in_addr"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2239:
+	.string	"IN6_IS_ADDR_SITELOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfec00000); }))"
+.LASF1514:
+	.string	"_SC_SPIN_LOCKS _SC_SPIN_LOCKS"
+.LASF2385:
+	.string	"___int_ptrdiff_t_h "
+.LASF1054:
+	.string	"O_CLOEXEC __O_CLOEXEC"
+.LASF1693:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2331:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF2380:
+	.string	"_T_PTRDIFF_ "
+.LASF2402:
+	.string	"__INT_WCHAR_T_H "
+.LASF3105:
+	.string	"OWNER_PINDEBUG"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF964:
+	.string	"EILSEQ 84"
+.LASF1549:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC _SC_LEVEL1_DCACHE_ASSOC"
+.LASF2163:
+	.string	"IPPROTO_IPIP IPPROTO_IPIP"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF799:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF2103:
+	.string	"IPV6_MULTICAST_HOPS 18"
+.LASF1599:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LIBS _CS_XBS5_ILP32_OFFBIG_LIBS"
+.LASF901:
+	.string	"EISDIR 21"
+.LASF2911:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF968:
+	.string	"ENOTSOCK 88"
+.LASF2066:
+	.string	"IP_MTU 14"
+.LASF2099:
+	.string	"IPV6_NEXTHOP 9"
+.LASF2966:
+	.string	"_IO_backup_base"
+.LASF1295:
+	.string	"_POSIX_TIMEOUTS 200809L"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF3183:
+	.string	"endWrite"
+.LASF2920:
+	.string	"UART3_RX_BUFFER_SIZE 256"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF966:
+	.string	"ESTRPIPE 86"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF2254:
+	.string	"TCP_KEEPINTVL 5"
+.LASF2518:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1422:
+	.string	"_SC_PII_INTERNET_DGRAM _SC_PII_INTERNET_DGRAM"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF975:
+	.string	"EOPNOTSUPP 95"
+.LASF2844:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF2836:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2464:
+	.string	"USE_DSHOT"
+.LASF1829:
+	.string	"AF_BLUETOOTH PF_BLUETOOTH"
+.LASF2374:
+	.string	"VTX_SMARTAUDIO "
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1610:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LDFLAGS _CS_POSIX_V6_ILP32_OFF32_LDFLAGS"
+.LASF1144:
+	.string	"_FALLOC_H_ "
+.LASF2568:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF2878:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2340:
+	.string	"USE_PPM "
+.LASF3223:
+	.string	"tcpReadBuf"
+.LASF1687:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF2058:
+	.string	"IP_ROUTER_ALERT 5"
+.LASF2673:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2413:
+	.string	"U_ID_0 0"
+.LASF3109:
+	.string	"OWNER_SYSTEM"
+.LASF891:
+	.string	"EAGAIN 11"
+.LASF2021:
+	.string	"__osockaddr_defined 1"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF2450:
+	.string	"TELEMETRY_CRSF"
+.LASF2616:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF3231:
+	.string	"received"
+.LASF1606:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LDFLAGS _CS_XBS5_LPBIG_OFFBIG_LDFLAGS"
+.LASF2871:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF978:
+	.string	"EADDRINUSE 98"
+.LASF2462:
+	.string	"USE_RESOURCE_MGMT"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2411:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2894:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1920:
+	.string	"__kernel_old_dev_t __kernel_old_dev_t"
+.LASF1159:
+	.string	"AT_STATX_SYNC_TYPE 0x6000"
+.LASF2352:
+	.string	"TELEMETRY "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF3044:
+	.string	"sockaddr_inarp"
+.LASF1042:
+	.string	"__O_PATH 010000000"
+.LASF1528:
+	.string	"_SC_2_PBS _SC_2_PBS"
+.LASF947:
+	.string	"ENOLINK 67"
+.LASF1341:
+	.string	"_PC_PATH_MAX _PC_PATH_MAX"
+.LASF879:
+	.string	"_ASM_GENERIC_ERRNO_H "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF802:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF951:
+	.string	"EPROTO 71"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF925:
+	.string	"EL2NSYNC 45"
+.LASF2101:
+	.string	"IPV6_UNICAST_HOPS 16"
+.LASF2881:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1993:
+	.string	"SO_ZEROCOPY 60"
+.LASF1992:
+	.string	"SO_PEERGROUPS 59"
+.LASF2536:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2958:
+	.string	"_IO_read_end"
+.LASF1207:
+	.string	"S_IFCHR __S_IFCHR"
+.LASF2038:
+	.string	"IP_MULTICAST_TTL 33"
+.LASF3226:
+	.string	"tcpTotalTxBytesFree"
+.LASF2693:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1115:
+	.string	"F_SEAL_FUTURE_WRITE 0x0010"
+.LASF2559:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF3096:
+	.string	"OWNER_SERVO"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1553:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE _SC_LEVEL2_CACHE_LINESIZE"
+.LASF1563:
+	.string	"_SC_V7_ILP32_OFFBIG _SC_V7_ILP32_OFFBIG"
+.LASF2544:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1328:
+	.string	"STDOUT_FILENO 1"
+.LASF936:
+	.string	"EBADRQC 56"
+.LASF959:
+	.string	"ELIBACC 79"
+.LASF1209:
+	.string	"S_IFREG __S_IFREG"
+.LASF2284:
+	.string	"TCP_ZEROCOPY_RECEIVE 35"
+.LASF2965:
+	.string	"_IO_save_base"
+.LASF3197:
+	.string	"printf"
+.LASF812:
+	.string	"BUFSIZ 8192"
+.LASF2256:
+	.string	"TCP_SYNCNT 7"
+.LASF1804:
+	.string	"AF_BRIDGE PF_BRIDGE"
+.LASF970:
+	.string	"EMSGSIZE 90"
+.LASF1930:
+	.string	"SIOCATMARK 0x8905"
+.LASF848:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2019:
+	.string	"SCM_TIMESTAMPNS SO_TIMESTAMPNS"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2776:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"ENOEXEC 8"
+.LASF1582:
+	.string	"_CS_POSIX_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF1908:
+	.string	"_EXTERN_INLINE __extern_inline"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1424:
+	.string	"_SC_PII_OSI_CLTS _SC_PII_OSI_CLTS"
+.LASF1616:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1556:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE _SC_LEVEL3_CACHE_LINESIZE"
+.LASF1430:
+	.string	"_SC_GETPW_R_SIZE_MAX _SC_GETPW_R_SIZE_MAX"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1673:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF2399:
+	.string	"_WCHAR_T_DEFINED "
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1759:
+	.string	"PF_DECnet 12"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF2506:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF2418:
+	.string	"USE_FAKE_GYRO "
+.LASF2706:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF2647:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1675:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF2908:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2869:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1559:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE _SC_LEVEL4_CACHE_LINESIZE"
+.LASF1766:
+	.string	"PF_ASH 18"
+.LASF2129:
+	.string	"IPV6_RECVDSTOPTS 58"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2329:
+	.string	"TCP_MSS_DEFAULT 536U"
+.LASF3149:
+	.string	"SERIAL_PARITY_NO"
+.LASF1162:
+	.string	"AT_STATX_DONT_SYNC 0x4000"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2244:
+	.string	"IN6_IS_ADDR_MC_NODELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x1))"
+.LASF1408:
+	.string	"_SC_2_FORT_DEV _SC_2_FORT_DEV"
+.LASF1331:
+	.string	"__uid_t_defined "
+.LASF2382:
+	.string	"__PTRDIFF_T "
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1218:
+	.string	"S_IXUSR __S_IEXEC"
+.LASF2578:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF2147:
+	.string	"IPV6_RXHOPOPTS IPV6_HOPOPTS"
+.LASF3140:
+	.string	"portMode_t"
+.LASF2189:
+	.string	"IPPROTO_FRAGMENT IPPROTO_FRAGMENT"
+.LASF2805:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1716:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1040:
+	.string	"__O_DIRECT 040000"
+.LASF2107:
+	.string	"IPV6_ROUTER_ALERT 22"
+.LASF2415:
+	.string	"U_ID_2 2"
+.LASF2689:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1098:
+	.string	"LOCK_NB 4"
+.LASF1826:
+	.string	"AF_MPLS PF_MPLS"
+.LASF2913:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF3163:
+	.string	"rxBufferSize"
+.LASF2211:
+	.string	"IN_BADCLASS(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xf0000000)"
+.LASF3010:
+	.string	"MSG_TRYHARD"
+.LASF2338:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF3113:
+	.string	"OWNER_I2C_SCL"
+.LASF2037:
+	.string	"IP_MULTICAST_IF 32"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2663:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1733:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF2316:
+	.string	"TCPI_OPT_WSCALE 4"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1509:
+	.string	"_SC_MONOTONIC_CLOCK _SC_MONOTONIC_CLOCK"
+.LASF1656:
+	.string	"__ino64_t_defined "
+.LASF2963:
+	.string	"_IO_buf_base"
+.LASF1628:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LINTFLAGS _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS"
+.LASF1535:
+	.string	"_SC_2_PBS_CHECKPOINT _SC_2_PBS_CHECKPOINT"
+.LASF2997:
+	.string	"SOCK_SEQPACKET"
+.LASF3126:
+	.string	"OWNER_BARO_EXTI"
+.LASF988:
+	.string	"ESHUTDOWN 108"
+.LASF3176:
+	.string	"serialTotalTxFree"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1541:
+	.string	"_SC_TRACE _SC_TRACE"
+.LASF2753:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1349:
+	.string	"_PC_SOCK_MAXBUF _PC_SOCK_MAXBUF"
+.LASF1927:
+	.string	"SIOCSPGRP 0x8902"
+.LASF2977:
+	.string	"_offset"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2943:
+	.string	"__uint16_t"
+.LASF1756:
+	.string	"PF_X25 9"
+.LASF1432:
+	.string	"_SC_TTY_NAME_MAX _SC_TTY_NAME_MAX"
+.LASF3114:
+	.string	"OWNER_I2C_SDA"
+.LASF2768:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1454:
+	.string	"_SC_XOPEN_SHM _SC_XOPEN_SHM"
+.LASF1482:
+	.string	"_SC_NL_NMAX _SC_NL_NMAX"
+.LASF2580:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1112:
+	.string	"F_SEAL_SHRINK 0x0002"
+.LASF1458:
+	.string	"_SC_XOPEN_XPG2 _SC_XOPEN_XPG2"
+.LASF1487:
+	.string	"_SC_XBS5_LP64_OFF64 _SC_XBS5_LP64_OFF64"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF3118:
+	.string	"OWNER_FLASH_CS"
+.LASF2164:
+	.string	"IPPROTO_TCP IPPROTO_TCP"
+.LASF3038:
+	.string	"sockaddr_in6"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1569:
+	.string	"_SC_TRACE_SYS_MAX _SC_TRACE_SYS_MAX"
+.LASF1780:
+	.string	"PF_IUCV 32"
+.LASF1892:
+	.string	"MSG_RST MSG_RST"
+.LASF1831:
+	.string	"AF_RXRPC PF_RXRPC"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF808:
+	.string	"__ssize_t_defined "
+.LASF2315:
+	.string	"TCPI_OPT_SACK 2"
+.LASF2035:
+	.string	"IP_RECVRETOPTS IP_RETOPTS"
+.LASF2582:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF3234:
+	.string	"tail"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1699:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF2371:
+	.string	"USE_SENSOR_NAMES "
+.LASF1010:
+	.string	"EOWNERDEAD 130"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF841:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2731:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF2494:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2002:
+	.string	"SO_TIMESTAMPING_NEW 65"
+.LASF1287:
+	.string	"_LFS64_LARGEFILE 1"
+.LASF1056:
+	.string	"O_NOATIME __O_NOATIME"
+.LASF1416:
+	.string	"_SC_PII_OSI _SC_PII_OSI"
+.LASF2280:
+	.string	"TCP_ULP 31"
+.LASF1603:
+	.string	"_CS_XBS5_LP64_OFF64_LIBS _CS_XBS5_LP64_OFF64_LIBS"
+.LASF3049:
+	.string	"sockaddr_x25"
+.LASF1448:
+	.string	"_SC_PASS_MAX _SC_PASS_MAX"
+.LASF1839:
+	.string	"AF_KCM PF_KCM"
+.LASF3041:
+	.string	"sin6_flowinfo"
+.LASF2188:
+	.string	"IPPROTO_ROUTING IPPROTO_ROUTING"
+.LASF1381:
+	.string	"_SC_AIO_LISTIO_MAX _SC_AIO_LISTIO_MAX"
+.LASF1352:
+	.string	"_PC_REC_MAX_XFER_SIZE _PC_REC_MAX_XFER_SIZE"
+.LASF2079:
+	.string	"IP_RECVERR_RFC4884 26"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2659:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2957:
+	.string	"_IO_read_ptr"
+.LASF1290:
+	.string	"_POSIX_CPUTIME 0"
+.LASF1021:
+	.string	"F_SETLKW64 7"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1654:
+	.string	"__u_char_defined "
+.LASF2907:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1776:
+	.string	"PF_MPLS 28"
+.LASF2879:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF2466:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1061:
+	.string	"F_DUPFD 0"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2468:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2749:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF3220:
+	.string	"next"
+.LASF2503:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2743:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1105:
+	.string	"DN_MODIFY 0x00000002"
+.LASF1423:
+	.string	"_SC_PII_OSI_COTS _SC_PII_OSI_COTS"
+.LASF2679:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2551:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1467:
+	.string	"_SC_WORD_BIT _SC_WORD_BIT"
+.LASF2827:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF2426:
+	.string	"USE_UART2 "
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1373:
+	.string	"_SC_FSYNC _SC_FSYNC"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1016:
+	.string	"__error_t_defined 1"
+.LASF2115:
+	.string	"IPV6_ROUTER_ALERT_ISOLATE 30"
+.LASF3158:
+	.string	"vTable"
+.LASF784:
+	.string	"__need_size_t"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"__GNUC_VA_LIST "
+.LASF2986:
+	.string	"_IO_marker"
+.LASF355:
+	.string	"__amd64 1"
+.LASF3175:
+	.string	"serialTotalRxWaiting"
+.LASF1192:
+	.string	"__S_IFLNK 0120000"
+.LASF1895:
+	.string	"MSG_MORE MSG_MORE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF2434:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2887:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2427:
+	.string	"USE_UART3 "
+.LASF3187:
+	.string	"_Bool"
+.LASF2762:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF2938:
+	.string	"unsigned int"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2736:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1962:
+	.string	"SO_DETACH_FILTER 27"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1346:
+	.string	"_PC_SYNC_IO _PC_SYNC_IO"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2379:
+	.string	"_PTRDIFF_T "
+.LASF1987:
+	.string	"SCM_TIMESTAMPING_OPT_STATS 54"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1904:
+	.string	"CMSG_ALIGN(len) (((len) + sizeof (size_t) - 1) & (size_t) ~(sizeof (size_t) - 1))"
+.LASF2396:
+	.string	"_WCHAR_T_ "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF2330:
+	.string	"TCP_MSS_DESIRED 1220U"
+.LASF1025:
+	.string	"O_WRONLY 01"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1382:
+	.string	"_SC_AIO_MAX _SC_AIO_MAX"
+.LASF1508:
+	.string	"_SC_FILE_SYSTEM _SC_FILE_SYSTEM"
+.LASF2428:
+	.string	"USE_UART4 "
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF2591:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1413:
+	.string	"_SC_PII_XTI _SC_PII_XTI"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2637:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2889:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1119:
+	.string	"RWH_WRITE_LIFE_SHORT 2"
+.LASF2529:
+	.string	"IOCFG_OUT_OD 0"
+.LASF2312:
+	.string	"TCP_MAX_WINSHIFT 14"
+.LASF2047:
+	.string	"MCAST_JOIN_GROUP 42"
+.LASF2216:
+	.string	"IN_LOOPBACKNET 127"
+.LASF2667:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1822:
+	.string	"AF_PPPOX PF_PPPOX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF3243:
+	.string	"_IO_lock_t"
+.LASF2368:
+	.string	"USE_MSP_PUSH "
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF546:
+	.string	"__always_inline"
+.LASF1389:
+	.string	"_SC_PAGE_SIZE _SC_PAGESIZE"
+.LASF1882:
+	.string	"MSG_TRYHARD MSG_DONTROUTE"
+.LASF2429:
+	.string	"USE_UART5 "
+.LASF1253:
+	.string	"_BITS_POSIX_OPT_H 1"
+.LASF2184:
+	.string	"IPPROTO_ETHERNET IPPROTO_ETHERNET"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1743:
+	.string	"SOCK_CLOEXEC SOCK_CLOEXEC"
+.LASF2369:
+	.string	"USE_RX_MSP "
+.LASF2570:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2547:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF2542:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF953:
+	.string	"EDOTDOT 73"
+.LASF1463:
+	.string	"_SC_CHAR_MIN _SC_CHAR_MIN"
+.LASF832:
+	.string	"RENAME_NOREPLACE (1 << 0)"
+.LASF1039:
+	.string	"__O_CLOEXEC 02000000"
+.LASF1655:
+	.string	"__ino_t_defined "
+.LASF2682:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1175:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1581:
+	.string	"_CS_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF2214:
+	.string	"INADDR_NONE ((in_addr_t) 0xffffffff)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1805:
+	.string	"AF_ATMPVC PF_ATMPVC"
+.LASF2834:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1572:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT _SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF1648:
+	.string	"CLOSE_RANGE_CLOEXEC (1U << 2)"
+.LASF1926:
+	.string	"FIOSETOWN 0x8901"
+.LASF2971:
+	.string	"_flags2"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1979:
+	.string	"SO_MAX_PACING_RATE 47"
+.LASF2181:
+	.string	"IPPROTO_SCTP IPPROTO_SCTP"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF402:
+	.string	"false 0"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF805:
+	.string	"_VA_LIST_DEFINED "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2138:
+	.string	"IPV6_MINHOPCOUNT 73"
+.LASF3229:
+	.string	"tcpPoll"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1788:
+	.string	"PF_VSOCK 40"
+.LASF2005:
+	.string	"SO_DETACH_REUSEPORT_BPF 68"
+.LASF1679:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF2223:
+	.string	"s6_addr __in6_u.__u6_addr8"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1058:
+	.string	"O_TMPFILE __O_TMPFILE"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1835:
+	.string	"AF_CAIF PF_CAIF"
+.LASF2117:
+	.string	"IPV6_IPSEC_POLICY 34"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF3191:
+	.string	"clientFd"
+.LASF1456:
+	.string	"_SC_2_C_VERSION _SC_2_C_VERSION"
+.LASF2016:
+	.string	"SO_RCVTIMEO SO_RCVTIMEO_OLD"
+.LASF1409:
+	.string	"_SC_2_FORT_RUN _SC_2_FORT_RUN"
+.LASF897:
+	.string	"EEXIST 17"
+.LASF2431:
+	.string	"USE_UART7 "
+.LASF1476:
+	.string	"_SC_UINT_MAX _SC_UINT_MAX"
+.LASF2929:
+	.string	"UART7_TX_BUFFER_SIZE 256"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2819:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF2961:
+	.string	"_IO_write_ptr"
+.LASF2594:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF3232:
+	.string	"tcpFlush"
+.LASF1277:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_INHERIT 200809L"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF3153:
+	.string	"SERIAL_BIDIR_OD"
+.LASF2126:
+	.string	"IPV6_RTHDRDSTOPTS 55"
+.LASF940:
+	.string	"ENOSTR 60"
+.LASF2775:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1322:
+	.string	"__ILP32_OFF32_LDFLAGS \"-m32\""
+.LASF2274:
+	.string	"TCP_NOTSENT_LOWAT 25"
+.LASF1943:
+	.string	"SO_RCVBUFFORCE 33"
+.LASF3242:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF1492:
+	.string	"_SC_ADVISORY_INFO _SC_ADVISORY_INFO"
+.LASF1615:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LIBS _CS_POSIX_V6_ILP32_OFFBIG_LIBS"
+.LASF1845:
+	.string	"SOL_RAW 255"
+.LASF2789:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF2646:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1066:
+	.string	"__F_SETOWN 8"
+.LASF2565:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF2432:
+	.string	"USE_UART8 "
+.LASF965:
+	.string	"ERESTART 85"
+.LASF994:
+	.string	"EALREADY 114"
+.LASF2552:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2799:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2852:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF2636:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF3030:
+	.string	"sockaddr_ax25"
+.LASF2406:
+	.string	"_BSD_WCHAR_T_"
+.LASF1037:
+	.string	"__O_DIRECTORY 0200000"
+.LASF1728:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF884:
+	.string	"EINTR 4"
+.LASF1547:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE _SC_LEVEL1_ICACHE_LINESIZE"
+.LASF957:
+	.string	"EBADFD 77"
+.LASF2767:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2517:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2094:
+	.string	"IPV6_2292RTHDR 5"
+.LASF2545:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF2023:
+	.string	"SHUT_WR SHUT_WR"
+.LASF1359:
+	.string	"_SC_CHILD_MAX _SC_CHILD_MAX"
+.LASF364:
+	.string	"__k8 1"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1233:
+	.string	"F_LOCK 1"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1344:
+	.string	"_PC_NO_TRUNC _PC_NO_TRUNC"
+.LASF1429:
+	.string	"_SC_GETGR_R_SIZE_MAX _SC_GETGR_R_SIZE_MAX"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1537:
+	.string	"_SC_V6_ILP32_OFFBIG _SC_V6_ILP32_OFFBIG"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF3007:
+	.string	"MSG_OOB"
+.LASF867:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF855:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF2498:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF2443:
+	.string	"USE_SERIALRX_SUMH"
+.LASF2615:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF2085:
+	.string	"IP_PMTUDISC_OMIT 5"
+.LASF2747:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF949:
+	.string	"ESRMNT 69"
+.LASF1618:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LDFLAGS _CS_POSIX_V6_LP64_OFF64_LDFLAGS"
+.LASF1933:
+	.string	"SOL_SOCKET 1"
+.LASF1148:
+	.string	"FALLOC_FL_COLLAPSE_RANGE 0x08"
+.LASF3213:
+	.string	"index"
+.LASF2097:
+	.string	"IPV6_2292HOPLIMIT 8"
+.LASF2999:
+	.string	"SOCK_PACKET"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1481:
+	.string	"_SC_NL_MSGMAX _SC_NL_MSGMAX"
+.LASF2705:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2604:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF2050:
+	.string	"MCAST_LEAVE_GROUP 45"
+.LASF1821:
+	.string	"AF_IRDA PF_IRDA"
+.LASF2490:
+	.string	"FAST_MATH "
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1742:
+	.string	"SOCK_PACKET SOCK_PACKET"
+.LASF2572:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1870:
+	.string	"SOL_MCTP 285"
+.LASF935:
+	.string	"ENOANO 55"
+.LASF1312:
+	.string	"_POSIX_TRACE_INHERIT -1"
+.LASF1626:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LDFLAGS _CS_POSIX_V7_ILP32_OFF32_LDFLAGS"
+.LASF2345:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1372:
+	.string	"_SC_SYNCHRONIZED_IO _SC_SYNCHRONIZED_IO"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1504:
+	.string	"_SC_FIFO _SC_FIFO"
+.LASF1914:
+	.string	"__struct_group_tag(TAG) TAG"
+.LASF1690:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF2150:
+	.string	"IPV6_PMTUDISC_WANT 1"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2590:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF1185:
+	.string	"_STATBUF_ST_NSEC "
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1398:
+	.string	"_SC_BC_STRING_MAX _SC_BC_STRING_MAX"
+.LASF2319:
+	.string	"TCPI_OPT_SYN_DATA 32"
+.LASF865:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF2990:
+	.string	"socklen_t"
+.LASF3198:
+	.string	"fprintf"
+.LASF2389:
+	.string	"__need_ptrdiff_t"
+.LASF1932:
+	.string	"SIOCGSTAMPNS_OLD 0x8907"
+.LASF2470:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF870:
+	.string	"__STDIO_INLINE"
+.LASF2265:
+	.string	"TCP_THIN_LINEAR_TIMEOUTS 16"
+.LASF2075:
+	.string	"IP_NODEFRAG 22"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1955:
+	.string	"SO_RCVTIMEO_OLD 20"
+.LASF839:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2611:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2764:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2720:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF3017:
+	.string	"MSG_FIN"
+.LASF1368:
+	.string	"_SC_PRIORITY_SCHEDULING _SC_PRIORITY_SCHEDULING"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF2840:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1638:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS"
+.LASF2234:
+	.string	"htonl(x) __bswap_32 (x)"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2806:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1818:
+	.string	"AF_ATMSVC PF_ATMSVC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF3032:
+	.string	"sockaddr_eon"
+.LASF2632:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1215:
+	.string	"S_ISVTX __S_ISVTX"
+.LASF3225:
+	.string	"tcpIsTransmitBufferEmpty"
+.LASF2074:
+	.string	"IP_MINTTL 21"
+.LASF1337:
+	.string	"_PC_LINK_MAX _PC_LINK_MAX"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF3192:
+	.string	"tcpPort"
+.LASF1791:
+	.string	"PF_SMC 43"
+.LASF1427:
+	.string	"_SC_THREADS _SC_THREADS"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF3144:
+	.string	"portOptions_t"
+.LASF903:
+	.string	"ENFILE 23"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1877:
+	.string	"__ss_aligntype unsigned long int"
+.LASF1351:
+	.string	"_PC_REC_INCR_XFER_SIZE _PC_REC_INCR_XFER_SIZE"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF2472:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1627:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LIBS _CS_POSIX_V7_ILP32_OFF32_LIBS"
+.LASF1310:
+	.string	"_POSIX_TRACE -1"
+.LASF1388:
+	.string	"_SC_PAGESIZE _SC_PAGESIZE"
+.LASF2944:
+	.string	"__uint32_t"
+.LASF2857:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF887:
+	.string	"E2BIG 7"
+.LASF2539:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF1571:
+	.string	"_SC_XOPEN_STREAMS _SC_XOPEN_STREAMS"
+.LASF2867:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1005:
+	.string	"ECANCELED 125"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1611:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LIBS _CS_POSIX_V6_ILP32_OFF32_LIBS"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF883:
+	.string	"ESRCH 3"
+.LASF2807:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF3179:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1046:
+	.string	"F_SETLK F_SETLK64"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1309:
+	.string	"_POSIX_THREAD_SPORADIC_SERVER -1"
+.LASF1022:
+	.string	"__iovec_defined 1"
+.LASF1590:
+	.string	"_CS_LFS64_LDFLAGS _CS_LFS64_LDFLAGS"
+.LASF1714:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1698:
+	.string	"__NFDBITS"
+.LASF3037:
+	.string	"sin_zero"
+.LASF2976:
+	.string	"_lock"
+.LASF1784:
+	.string	"PF_IEEE802154 36"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF3156:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF922:
+	.string	"ENOMSG 42"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF1551:
+	.string	"_SC_LEVEL2_CACHE_SIZE _SC_LEVEL2_CACHE_SIZE"
+.LASF806:
+	.string	"__off_t_defined "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF2777:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF3106:
+	.string	"OWNER_TIMER"
+.LASF2533:
+	.string	"IOCFG_IPU 0"
+.LASF1558:
+	.string	"_SC_LEVEL4_CACHE_ASSOC _SC_LEVEL4_CACHE_ASSOC"
+.LASF1118:
+	.string	"RWH_WRITE_LIFE_NONE 1"
+.LASF2133:
+	.string	"IPV6_DONTFRAG 62"
+.LASF1619:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LIBS _CS_POSIX_V6_LP64_OFF64_LIBS"
+.LASF3216:
+	.string	"tcpBeginWrite"
+.LASF2674:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2309:
+	.string	"TCPOPT_TSTAMP_HDR (TCPOPT_NOP<<24|TCPOPT_NOP<<16|TCPOPT_TIMESTAMP<<8|TCPOLEN_TIMESTAMP)"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1771:
+	.string	"PF_IRDA 23"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2006:
+	.string	"SO_PREFER_BUSY_POLL 69"
+.LASF2474:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF2281:
+	.string	"TCP_MD5SIG_EXT 32"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2259:
+	.string	"TCP_WINDOW_CLAMP 10"
+.LASF2020:
+	.string	"SCM_TIMESTAMPING SO_TIMESTAMPING"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2592:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2092:
+	.string	"IPV6_2292HOPOPTS 3"
+.LASF1392:
+	.string	"_SC_SEM_VALUE_MAX _SC_SEM_VALUE_MAX"
+.LASF1917:
+	.string	"__FD_SETSIZE"
+.LASF1173:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF831:
+	.string	"stderr stderr"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF822:
+	.string	"TMP_MAX 238328"
+.LASF1954:
+	.string	"SO_SNDLOWAT 19"
+.LASF3200:
+	.string	"listen"
+.LASF2886:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1305:
+	.string	"_POSIX_IPV6 200809L"
+.LASF2088:
+	.string	"IP_DEFAULT_MULTICAST_LOOP 1"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1596:
+	.string	"_CS_XBS5_ILP32_OFF32_LINTFLAGS _CS_XBS5_ILP32_OFF32_LINTFLAGS"
+.LASF838:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1886:
+	.string	"MSG_DONTWAIT MSG_DONTWAIT"
+.LASF2122:
+	.string	"IPV6_RECVHOPLIMIT 51"
+.LASF983:
+	.string	"ECONNABORTED 103"
+.LASF871:
+	.string	"_STRING_H 1"
+.LASF1000:
+	.string	"EISNAM 120"
+.LASF1191:
+	.string	"__S_IFIFO 0010000"
+.LASF1567:
+	.string	"_SC_TRACE_EVENT_NAME_MAX _SC_TRACE_EVENT_NAME_MAX"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF3185:
+	.string	"setRxFrameCallback"
+.LASF1282:
+	.string	"_POSIX_ASYNC_IO 1"
+.LASF2932:
+	.string	"UART_RX_FRAME_CHUNK_SIZE 64"
+.LASF1308:
+	.string	"_POSIX_SPORADIC_SERVER -1"
+.LASF2964:
+	.string	"_IO_buf_end"
+.LASF1363:
+	.string	"_SC_STREAM_MAX _SC_STREAM_MAX"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2134:
+	.string	"IPV6_RECVTCLASS 66"
+.LASF2238:
+	.string	"IN6_IS_ADDR_LINKLOCAL(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); (__a->__in6_u.__u6_addr32[0] & htonl (0xffc00000)) == htonl (0xfe800000); }))"
+.LASF2937:
+	.string	"short unsigned int"
+.LASF798:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF2272:
+	.string	"TCP_FASTOPEN 23"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF2622:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF3060:
+	.string	"IPPROTO_EGP"
+.LASF1302:
+	.string	"_POSIX_MONOTONIC_CLOCK 0"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1355:
+	.string	"_PC_ALLOC_SIZE_MIN _PC_ALLOC_SIZE_MIN"
+.LASF2877:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2780:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2691:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF821:
+	.string	"L_tmpnam 20"
+.LASF1101:
+	.string	"LOCK_READ 64"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF2444:
+	.string	"USE_SERIALRX_XBUS"
+.LASF982:
+	.string	"ENETRESET 102"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2791:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF3161:
+	.string	"options"
+.LASF1123:
+	.string	"FAPPEND O_APPEND"
+.LASF1447:
+	.string	"_SC_ATEXIT_MAX _SC_ATEXIT_MAX"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF3189:
+	.string	"port"
+.LASF1738:
+	.string	"SOCK_RAW SOCK_RAW"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF2987:
+	.string	"_IO_codecvt"
+.LASF1624:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1179:
+	.string	"_BITS_STRUCT_STAT_H 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF2455:
+	.string	"USE_DASHBOARD"
+.LASF1950:
+	.string	"SO_REUSEPORT 15"
+.LASF1872:
+	.string	"SOMAXCONN 4096"
+.LASF2903:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2822:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF811:
+	.string	"_IONBF 2"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2813:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2818:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1260:
+	.string	"_POSIX_MEMLOCK 200809L"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2269:
+	.string	"TCP_REPAIR_QUEUE 20"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1136:
+	.string	"SYNC_FILE_RANGE_WAIT_BEFORE 1"
+.LASF1685:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1662:
+	.string	"__clock_t_defined 1"
+.LASF1575:
+	.string	"_SC_SIGSTKSZ _SC_SIGSTKSZ"
+.LASF2142:
+	.string	"IPV6_UNICAST_IF 76"
+.LASF1622:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS"
+.LASF1338:
+	.string	"_PC_MAX_CANON _PC_MAX_CANON"
+.LASF1820:
+	.string	"AF_SNA PF_SNA"
+.LASF1049:
+	.string	"F_OFD_SETLK 37"
+.LASF1772:
+	.string	"PF_PPPOX 24"
+.LASF1777:
+	.string	"PF_CAN 29"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1279:
+	.string	"_POSIX_SEMAPHORES 200809L"
+.LASF1059:
+	.string	"O_DSYNC __O_DSYNC"
+.LASF1177:
+	.string	"__time_t_defined 1"
+.LASF3180:
+	.string	"setMode"
+.LASF2362:
+	.string	"TELEMETRY_IBUS "
+.LASF1024:
+	.string	"O_RDONLY 00"
+.LASF3162:
+	.string	"baudRate"
+.LASF1542:
+	.string	"_SC_TRACE_EVENT_FILTER _SC_TRACE_EVENT_FILTER"
+.LASF1573:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT _SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF1393:
+	.string	"_SC_SIGQUEUE_MAX _SC_SIGQUEUE_MAX"
+.LASF3237:
+	.string	"addr"
+.LASF3125:
+	.string	"OWNER_MPU_EXTI"
+.LASF1190:
+	.string	"__S_IFREG 0100000"
+.LASF1706:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1139:
+	.string	"SYNC_FILE_RANGE_WRITE_AND_WAIT (SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WAIT_AFTER)"
+.LASF2423:
+	.string	"MAG "
+.LASF2222:
+	.string	"INADDR_MAX_LOCAL_GROUP ((in_addr_t) 0xe00000ff)"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2951:
+	.string	"uint8_t"
+.LASF1764:
+	.string	"PF_ROUTE PF_NETLINK"
+.LASF796:
+	.string	"__struct_FILE_defined 1"
+.LASF2148:
+	.string	"IPV6_RXDSTOPTS IPV6_DSTOPTS"
+.LASF1712:
+	.string	"__fsfilcnt_t_defined "
+.LASF1730:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF2119:
+	.string	"IPV6_HDRINCL 36"
+.LASF1745:
+	.string	"PF_UNSPEC 0"
+.LASF2657:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1321:
+	.string	"__ILP32_OFF32_CFLAGS \"-m32\""
+.LASF2480:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2989:
+	.string	"ssize_t"
+.LASF2447:
+	.string	"TELEMETRY_FRSKY"
+.LASF1802:
+	.string	"AF_APPLETALK PF_APPLETALK"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1754:
+	.string	"PF_BRIDGE 7"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2162:
+	.string	"IPPROTO_IGMP IPPROTO_IGMP"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF2359:
+	.string	"GPS "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF856:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1033:
+	.string	"O_NDELAY O_NONBLOCK"
+.LASF1001:
+	.string	"EREMOTEIO 121"
+.LASF2060:
+	.string	"IP_PKTOPTIONS 9"
+.LASF1762:
+	.string	"PF_KEY 15"
+.LASF2337:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF2975:
+	.string	"_shortbuf"
+.LASF2765:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1045:
+	.string	"F_GETLK F_GETLK64"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF2229:
+	.string	"INET6_ADDRSTRLEN 46"
+.LASF2627:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF2477:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF3099:
+	.string	"OWNER_ADC_BATT"
+.LASF3072:
+	.string	"IPPROTO_BEETPH"
+.LASF1048:
+	.string	"F_OFD_GETLK 36"
+.LASF3241:
+	.string	"__bswap_16"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1090:
+	.string	"FD_CLOEXEC 1"
+.LASF2648:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1645:
+	.string	"TEMP_FAILURE_RETRY(expression) (__extension__ ({ long int __result; do __result = (long int) (expression); while (__result == -1L && errno == EINTR); __result; }))"
+.LASF1230:
+	.string	"X_OK 1"
+.LASF2235:
+	.string	"htons(x) __bswap_16 (x)"
+.LASF1497:
+	.string	"_SC_CLOCK_SELECTION _SC_CLOCK_SELECTION"
+.LASF3091:
+	.string	"float"
+.LASF950:
+	.string	"ECOMM 70"
+.LASF2802:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF3074:
+	.string	"IPPROTO_PIM"
+.LASF2962:
+	.string	"_IO_write_end"
+.LASF2653:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1566:
+	.string	"_SC_SS_REPL_MAX _SC_SS_REPL_MAX"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1488:
+	.string	"_SC_XBS5_LPBIG_OFFBIG _SC_XBS5_LPBIG_OFFBIG"
+.LASF2936:
+	.string	"unsigned char"
+.LASF2172:
+	.string	"IPPROTO_RSVP IPPROTO_RSVP"
+.LASF2118:
+	.string	"IPV6_XFRM_POLICY 35"
+.LASF1442:
+	.string	"_SC_THREAD_PROCESS_SHARED _SC_THREAD_PROCESS_SHARED"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1634:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LDFLAGS _CS_POSIX_V7_LP64_OFF64_LDFLAGS"
+.LASF1713:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1674:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF2934:
+	.string	"TCP_SERIAL_RX_BUFFER_SIZE 1024"
+.LASF1384:
+	.string	"_SC_DELAYTIMER_MAX _SC_DELAYTIMER_MAX"
+.LASF2716:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF2069:
+	.string	"IP_XFRM_POLICY 17"
+.LASF1440:
+	.string	"_SC_THREAD_PRIO_INHERIT _SC_THREAD_PRIO_INHERIT"
+.LASF1450:
+	.string	"_SC_XOPEN_XCU_VERSION _SC_XOPEN_XCU_VERSION"
+.LASF1909:
+	.string	"SCM_RIGHTS SCM_RIGHTS"
+.LASF2579:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF2733:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2810:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF890:
+	.string	"ECHILD 10"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1284:
+	.string	"_POSIX_PRIORITIZED_IO 200809L"
+.LASF1661:
+	.string	"__key_t_defined "
+.LASF2299:
+	.string	"TCPOPT_MAXSEG 2"
+.LASF2690:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2227:
+	.string	"IN6ADDR_LOOPBACK_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1 } } }"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF2634:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2607:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1050:
+	.string	"F_OFD_SETLKW 38"
+.LASF2098:
+	.string	"SCM_SRCRT IPV6_RXSRCRT"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF912:
+	.string	"EPIPE 32"
+.LASF2670:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2602:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF2554:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1401:
+	.string	"_SC_EXPR_NEST_MAX _SC_EXPR_NEST_MAX"
+.LASF2155:
+	.string	"SOL_IPV6 41"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF764:
+	.string	"__need_size_t "
+.LASF893:
+	.string	"EACCES 13"
+.LASF932:
+	.string	"EBADE 52"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF2888:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF379:
+	.string	"linux 1"
+.LASF1866:
+	.string	"SOL_KCM 281"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF999:
+	.string	"ENAVAIL 119"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF1998:
+	.string	"SO_TIMESTAMPNS_OLD 35"
+.LASF2045:
+	.string	"IP_DROP_SOURCE_MEMBERSHIP 40"
+.LASF2496:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF2917:
+	.string	"UART1_TX_BUFFER_SIZE 256"
+.LASF3123:
+	.string	"OWNER_RX_SPI_CS"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1527:
+	.string	"_SC_USER_GROUPS_R _SC_USER_GROUPS_R"
+.LASF2890:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2741:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF943:
+	.string	"ENOSR 63"
+.LASF1216:
+	.string	"S_IRUSR __S_IREAD"
+.LASF3043:
+	.string	"sin6_scope_id"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF866:
+	.string	"_BITS_STDIO_H 1"
+.LASF2404:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2106:
+	.string	"IPV6_LEAVE_GROUP 21"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2342:
+	.string	"SERIAL_RX "
+.LASF2224:
+	.string	"s6_addr16 __in6_u.__u6_addr16"
+.LASF2260:
+	.string	"TCP_INFO 11"
+.LASF1786:
+	.string	"PF_ALG 38"
+.LASF3120:
+	.string	"OWNER_BARO_CS"
+.LASF2144:
+	.string	"IPV6_FREEBIND 78"
+.LASF1761:
+	.string	"PF_SECURITY 14"
+.LASF1885:
+	.string	"MSG_TRUNC MSG_TRUNC"
+.LASF2732:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2408:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1108:
+	.string	"DN_RENAME 0x00000010"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF2771:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1248:
+	.string	"_XOPEN_XPG3 1"
+.LASF1194:
+	.string	"__S_TYPEISMQ(buf) ((buf)->st_mode - (buf)->st_mode)"
+.LASF1087:
+	.string	"F_GET_FILE_RW_HINT 1037"
+.LASF3052:
+	.string	"in_addr_t"
+.LASF1511:
+	.string	"_SC_SINGLE_PROCESS _SC_SINGLE_PROCESS"
+.LASF2327:
+	.string	"TCP_S_DATA_IN (1 << 2)"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF868:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF1510:
+	.string	"_SC_MULTI_PROCESS _SC_MULTI_PROCESS"
+.LASF2384:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1121:
+	.string	"RWH_WRITE_LIFE_LONG 4"
+.LASF3135:
+	.string	"OWNER_VTX"
+.LASF2467:
+	.string	"USE_PROFILE "
+.LASF2530:
+	.string	"IOCFG_AF_PP 0"
+.LASF1415:
+	.string	"_SC_PII_INTERNET _SC_PII_INTERNET"
+.LASF3080:
+	.string	"IPPROTO_RAW"
+.LASF2485:
+	.string	"__enable_irq() "
+.LASF772:
+	.string	"__SIZE_T "
+.LASF1695:
+	.string	"____sigset_t_defined "
+.LASF1357:
+	.string	"_PC_2_SYMLINKS _PC_2_SYMLINKS"
+.LASF917:
+	.string	"ENOLCK 37"
+.LASF1114:
+	.string	"F_SEAL_WRITE 0x0008"
+.LASF2042:
+	.string	"IP_UNBLOCK_SOURCE 37"
+.LASF1152:
+	.string	"MAX_HANDLE_SZ 128"
+.LASF2575:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1555:
+	.string	"_SC_LEVEL3_CACHE_ASSOC _SC_LEVEL3_CACHE_ASSOC"
+.LASF1320:
+	.string	"_XBS5_LP64_OFF64 1"
+.LASF2946:
+	.string	"__off_t"
+.LASF1883:
+	.string	"MSG_CTRUNC MSG_CTRUNC"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF2686:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1143:
+	.string	"SPLICE_F_GIFT 8"
+.LASF1283:
+	.string	"_LFS_ASYNCHRONOUS_IO 1"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2842:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1471:
+	.string	"_SC_SCHAR_MAX _SC_SCHAR_MAX"
+.LASF2508:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF2446:
+	.string	"LED_STRIP"
+.LASF2131:
+	.string	"IPV6_RECVPATHMTU 60"
+.LASF916:
+	.string	"ENAMETOOLONG 36"
+.LASF1966:
+	.string	"SO_PEERSEC 31"
+.LASF1462:
+	.string	"_SC_CHAR_MAX _SC_CHAR_MAX"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1483:
+	.string	"_SC_NL_SETMAX _SC_NL_SETMAX"
+.LASF1446:
+	.string	"_SC_AVPHYS_PAGES _SC_AVPHYS_PAGES"
+.LASF3164:
+	.string	"txBufferSize"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF2449:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1668:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1971:
+	.string	"SO_RXQ_OVFL 40"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF2039:
+	.string	"IP_MULTICAST_LOOP 34"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF2728:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1323:
+	.string	"__ILP32_OFFBIG_CFLAGS \"-m32 -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64\""
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1103:
+	.string	"LOCK_RW 192"
+.LASF1748:
+	.string	"PF_FILE PF_LOCAL"
+.LASF2843:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2523:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF2064:
+	.string	"IP_RECVTTL 12"
+.LASF2790:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF955:
+	.string	"EOVERFLOW 75"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF2183:
+	.string	"IPPROTO_MPLS IPPROTO_MPLS"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1307:
+	.string	"_POSIX2_CHAR_TERM 200809L"
+.LASF2321:
+	.string	"TCP_MD5SIG_FLAG_PREFIX 1"
+.LASF1836:
+	.string	"AF_ALG PF_ALG"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF3132:
+	.string	"OWNER_INVERTER"
+.LASF1919:
+	.string	"__kernel_old_uid_t __kernel_old_uid_t"
+.LASF1832:
+	.string	"AF_ISDN PF_ISDN"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2700:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1319:
+	.string	"_POSIX_V6_LP64_OFF64 1"
+.LASF853:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF880:
+	.string	"_ASM_GENERIC_ERRNO_BASE_H "
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1353:
+	.string	"_PC_REC_MIN_XFER_SIZE _PC_REC_MIN_XFER_SIZE"
+.LASF1023:
+	.string	"O_ACCMODE 0003"
+.LASF820:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF1174:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1466:
+	.string	"_SC_LONG_BIT _SC_LONG_BIT"
+.LASF2387:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF3154:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1538:
+	.string	"_SC_V6_LP64_OFF64 _SC_V6_LP64_OFF64"
+.LASF2574:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2347:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1639:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LIBS _CS_POSIX_V7_LPBIG_OFFBIG_LIBS"
+.LASF1550:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE _SC_LEVEL1_DCACHE_LINESIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2113:
+	.string	"IPV6_LEAVE_ANYCAST 28"
+.LASF1252:
+	.string	"_XOPEN_LEGACY 1"
+.LASF2424:
+	.string	"USE_FAKE_MAG "
+.LASF1273:
+	.string	"_POSIX_THREAD_ATTR_STACKSIZE 200809L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1739:
+	.string	"SOCK_RDM SOCK_RDM"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2246:
+	.string	"IN6_IS_ADDR_MC_SITELOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x5))"
+.LASF1204:
+	.string	"UTIME_OMIT ((1l << 30) - 2l)"
+.LASF1133:
+	.string	"POSIX_FADV_WILLNEED 3"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2712:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2549:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1650:
+	.string	"_NETINET_IN_H 1"
+.LASF2231:
+	.string	"GROUP_FILTER_SIZE(numsrc) (sizeof (struct group_filter) - sizeof (struct sockaddr_storage) + ((numsrc) * sizeof (struct sockaddr_storage)))"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF909:
+	.string	"ESPIPE 29"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF3131:
+	.string	"OWNER_RX_BIND"
+.LASF2817:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF825:
+	.string	"L_cuserid 9"
+.LASF2012:
+	.string	"SO_RCVMARK 75"
+.LASF3111:
+	.string	"OWNER_SPI_MISO"
+.LASF2609:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1852:
+	.string	"SOL_NETBEUI 267"
+.LASF2208:
+	.string	"IN_CLASSD(a) ((((in_addr_t)(a)) & 0xf0000000) == 0xe0000000)"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF2226:
+	.string	"IN6ADDR_ANY_INIT { { { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 } } }"
+.LASF911:
+	.string	"EMLINK 31"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF892:
+	.string	"ENOMEM 12"
+.LASF1495:
+	.string	"_SC_C_LANG_SUPPORT _SC_C_LANG_SUPPORT"
+.LASF1431:
+	.string	"_SC_LOGIN_NAME_MAX _SC_LOGIN_NAME_MAX"
+.LASF2093:
+	.string	"IPV6_2292DSTOPTS 4"
+.LASF1238:
+	.string	"__POSIX2_THIS_VERSION 200809L"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1801:
+	.string	"AF_IPX PF_IPX"
+.LASF1633:
+	.string	"_CS_POSIX_V7_LP64_OFF64_CFLAGS _CS_POSIX_V7_LP64_OFF64_CFLAGS"
+.LASF2918:
+	.string	"UART2_RX_BUFFER_SIZE 256"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1869:
+	.string	"SOL_MPTCP 284"
+.LASF1377:
+	.string	"_SC_MEMORY_PROTECTION _SC_MEMORY_PROTECTION"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF2236:
+	.string	"IN6_IS_ADDR_UNSPECIFIED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && __a->__in6_u.__u6_addr32[3] == 0; }))"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1237:
+	.string	"_POSIX_VERSION 200809L"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF2979:
+	.string	"_wide_data"
+.LASF1827:
+	.string	"AF_CAN PF_CAN"
+.LASF1125:
+	.string	"FASYNC O_ASYNC"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF2095:
+	.string	"IPV6_2292PKTOPTIONS 6"
+.LASF2400:
+	.string	"_WCHAR_T_H "
+.LASF948:
+	.string	"EADV 68"
+.LASF1834:
+	.string	"AF_IEEE802154 PF_IEEE802154"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2893:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF2605:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1953:
+	.string	"SO_RCVLOWAT 18"
+.LASF2861:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF2255:
+	.string	"TCP_KEEPCNT 6"
+.LASF1544:
+	.string	"_SC_TRACE_LOG _SC_TRACE_LOG"
+.LASF1789:
+	.string	"PF_KCM 41"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF1708:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF3093:
+	.string	"OWNER_PWMINPUT"
+.LASF2668:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF2295:
+	.string	"TH_ACK 0x10"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF3151:
+	.string	"SERIAL_UNIDIR"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF2114:
+	.string	"IPV6_MULTICAST_ALL 29"
+.LASF1584:
+	.string	"_CS_POSIX_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF1206:
+	.string	"S_IFDIR __S_IFDIR"
+.LASF2758:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF2071:
+	.string	"IP_TRANSPARENT 19"
+.LASF1647:
+	.string	"CLOSE_RANGE_UNSHARE (1U << 1)"
+.LASF3222:
+	.string	"count"
+.LASF1568:
+	.string	"_SC_TRACE_NAME_MAX _SC_TRACE_NAME_MAX"
+.LASF1044:
+	.string	"__O_TMPFILE (020000000 | __O_DIRECTORY)"
+.LASF2000:
+	.string	"SO_TIMESTAMP_NEW 63"
+.LASF2478:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1106:
+	.string	"DN_CREATE 0x00000004"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1165:
+	.string	"__OPEN_NEEDS_MODE(oflag) (((oflag) & O_CREAT) != 0 || ((oflag) & __O_TMPFILE) == __O_TMPFILE)"
+.LASF1161:
+	.string	"AT_STATX_FORCE_SYNC 0x2000"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF3095:
+	.string	"OWNER_MOTOR"
+.LASF2348:
+	.string	"USE_SERIALRX_SUMH "
+.LASF2068:
+	.string	"IP_IPSEC_POLICY 16"
+.LASF1967:
+	.string	"SO_PASSSEC 34"
+.LASF2452:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1711:
+	.string	"__fsblkcnt_t_defined "
+.LASF1361:
+	.string	"_SC_NGROUPS_MAX _SC_NGROUPS_MAX"
+.LASF2381:
+	.string	"_T_PTRDIFF "
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF2972:
+	.string	"_old_offset"
+.LASF1592:
+	.string	"_CS_LFS64_LINTFLAGS _CS_LFS64_LINTFLAGS"
+.LASF1262:
+	.string	"_POSIX_MEMORY_PROTECTION 200809L"
+.LASF1244:
+	.string	"_POSIX2_LOCALEDEF __POSIX2_THIS_VERSION"
+.LASF3061:
+	.string	"IPPROTO_PUP"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1597:
+	.string	"_CS_XBS5_ILP32_OFFBIG_CFLAGS _CS_XBS5_ILP32_OFFBIG_CFLAGS"
+.LASF2336:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF2100:
+	.string	"IPV6_AUTHHDR 10"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF2105:
+	.string	"IPV6_JOIN_GROUP 20"
+.LASF830:
+	.string	"stdout stdout"
+.LASF3165:
+	.string	"rxBuffer"
+.LASF1671:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF2718:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF2798:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF3089:
+	.string	"test"
+.LASF1887:
+	.string	"MSG_EOR MSG_EOR"
+.LASF1232:
+	.string	"F_ULOCK 0"
+.LASF1205:
+	.string	"S_IFMT __S_IFMT"
+.LASF1960:
+	.string	"SO_BINDTODEVICE 25"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1490:
+	.string	"_SC_XOPEN_REALTIME _SC_XOPEN_REALTIME"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2290:
+	.string	"TCP_REPAIR_OFF_NO_WP -1"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF1212:
+	.string	"S_IFSOCK __S_IFSOCK"
+.LASF2541:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1436:
+	.string	"_SC_THREAD_THREADS_MAX _SC_THREAD_THREADS_MAX"
+.LASF3008:
+	.string	"MSG_PEEK"
+.LASF952:
+	.string	"EMULTIHOP 72"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1026:
+	.string	"O_RDWR 02"
+.LASF1076:
+	.string	"F_SETOWN_EX __F_SETOWN_EX"
+.LASF927:
+	.string	"EL3RST 47"
+.LASF1343:
+	.string	"_PC_CHOWN_RESTRICTED _PC_CHOWN_RESTRICTED"
+.LASF2185:
+	.string	"IPPROTO_RAW IPPROTO_RAW"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1100:
+	.string	"LOCK_MAND 32"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1757:
+	.string	"PF_INET6 10"
+.LASF2457:
+	.string	"VTX_COMMON"
+.LASF2026:
+	.string	"__SOCKADDR_ONETYPE(type) struct type *__restrict __ ##type ##__;"
+.LASF1149:
+	.string	"FALLOC_FL_ZERO_RANGE 0x10"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2104:
+	.string	"IPV6_MULTICAST_LOOP 19"
+.LASF1088:
+	.string	"F_SET_FILE_RW_HINT 1038"
+.LASF2880:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2285:
+	.string	"TCP_INQ 36"
+.LASF1140:
+	.string	"SPLICE_F_MOVE 1"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2370:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2835:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1394:
+	.string	"_SC_TIMER_MAX _SC_TIMER_MAX"
+.LASF2378:
+	.string	"_ANSI_STDDEF_H "
+.LASF1796:
+	.string	"AF_LOCAL PF_LOCAL"
+.LASF2921:
+	.string	"UART3_TX_BUFFER_SIZE 256"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF2507:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1477:
+	.string	"_SC_ULONG_MAX _SC_ULONG_MAX"
+.LASF2392:
+	.string	"_WCHAR_T "
+.LASF1362:
+	.string	"_SC_OPEN_MAX _SC_OPEN_MAX"
+.LASF2967:
+	.string	"_IO_save_end"
+.LASF2061:
+	.string	"IP_PMTUDISC 10"
+.LASF1753:
+	.string	"PF_NETROM 6"
+.LASF2141:
+	.string	"IPV6_TRANSPARENT 75"
+.LASF2968:
+	.string	"_markers"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2028:
+	.string	"__SOCKADDR_ONETYPE(type) const struct type *__restrict __ ##type ##__;"
+.LASF1325:
+	.string	"__LP64_OFF64_CFLAGS \"-m64\""
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF2287:
+	.string	"TCP_TX_DELAY 37"
+.LASF1127:
+	.string	"FNDELAY O_NDELAY"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1404:
+	.string	"_SC_CHARCLASS_NAME_MAX _SC_CHARCLASS_NAME_MAX"
+.LASF1057:
+	.string	"O_PATH __O_PATH"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF920:
+	.string	"ELOOP 40"
+.LASF2588:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1499:
+	.string	"_SC_THREAD_CPUTIME _SC_THREAD_CPUTIME"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF2077:
+	.string	"IP_BIND_ADDRESS_NO_PORT 24"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1607:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LIBS _CS_XBS5_LPBIG_OFFBIG_LIBS"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF857:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF3063:
+	.string	"IPPROTO_IDP"
+.LASF1366:
+	.string	"_SC_SAVED_IDS _SC_SAVED_IDS"
+.LASF2011:
+	.string	"SO_TXREHASH 74"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF3045:
+	.string	"sockaddr_ipx"
+.LASF973:
+	.string	"EPROTONOSUPPORT 93"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF2059:
+	.string	"IP_PKTINFO 8"
+.LASF522:
+	.string	"__flexarr []"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1803:
+	.string	"AF_NETROM PF_NETROM"
+.LASF1228:
+	.string	"R_OK 4"
+.LASF2486:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF2540:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF3137:
+	.string	"OWNER_CROS_EC"
+.LASF1652:
+	.string	"__BITS_SOCKET_H "
+.LASF1735:
+	.string	"__have_pthread_attr_t 1"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2373:
+	.string	"VTX_CONTROL "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF3129:
+	.string	"OWNER_BEEPER"
+.LASF2165:
+	.string	"IPPROTO_EGP IPPROTO_EGP"
+.LASF1750:
+	.string	"PF_AX25 3"
+.LASF2841:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2335:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2376:
+	.string	"_STDDEF_H "
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF2220:
+	.string	"INADDR_ALLRTRS_GROUP ((in_addr_t) 0xe0000002)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1360:
+	.string	"_SC_CLK_TCK _SC_CLK_TCK"
+.LASF1552:
+	.string	"_SC_LEVEL2_CACHE_ASSOC _SC_LEVEL2_CACHE_ASSOC"
+.LASF1199:
+	.string	"__S_ISVTX 01000"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2905:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2676:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1386:
+	.string	"_SC_MQ_PRIO_MAX _SC_MQ_PRIO_MAX"
+.LASF1717:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1269:
+	.string	"_POSIX_THREADS 200809L"
+.LASF1070:
+	.string	"__F_SETSIG 10"
+.LASF1934:
+	.string	"SO_DEBUG 1"
+.LASF908:
+	.string	"ENOSPC 28"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1612:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LINTFLAGS _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS"
+.LASF2149:
+	.string	"IPV6_PMTUDISC_DONT 0"
+.LASF3204:
+	.string	"fcntl"
+.LASF905:
+	.string	"ENOTTY 25"
+.LASF1689:
+	.string	"_SYS_SELECT_H 1"
+.LASF2397:
+	.string	"_BSD_WCHAR_T_ "
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1724:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1406:
+	.string	"_SC_2_C_BIND _SC_2_C_BIND"
+.LASF942:
+	.string	"ETIME 62"
+.LASF3068:
+	.string	"IPPROTO_GRE"
+.LASF2484:
+	.string	"__disable_irq() "
+.LASF2081:
+	.string	"IP_PMTUDISC_WANT 1"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2587:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF1773:
+	.string	"PF_WANPIPE 25"
+.LASF3184:
+	.string	"readBuf"
+.LASF3059:
+	.string	"IPPROTO_TCP"
+.LASF2698:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF1403:
+	.string	"_SC_RE_DUP_MAX _SC_RE_DUP_MAX"
+.LASF2831:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF400:
+	.string	"bool _Bool"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1579:
+	.string	"_CS_GNU_LIBC_VERSION _CS_GNU_LIBC_VERSION"
+.LASF2868:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1640:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1329:
+	.string	"STDERR_FILENO 2"
+.LASF1468:
+	.string	"_SC_MB_LEN_MAX _SC_MB_LEN_MAX"
+.LASF1893:
+	.string	"MSG_ERRQUEUE MSG_ERRQUEUE"
+.LASF2924:
+	.string	"UART5_RX_BUFFER_SIZE 256"
+.LASF3136:
+	.string	"OWNER_COMPASS_CS"
+.LASF1073:
+	.string	"__F_GETOWN_EX 16"
+.LASF3046:
+	.string	"sockaddr_iso"
+.LASF1632:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS"
+.LASF1906:
+	.string	"CMSG_LEN(len) (CMSG_ALIGN (sizeof (struct cmsghdr)) + (len))"
+.LASF1306:
+	.string	"_POSIX_RAW_SOCKETS 200809L"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1400:
+	.string	"_SC_EQUIV_CLASS_MAX _SC_EQUIV_CLASS_MAX"
+.LASF2358:
+	.string	"USE_SERVOS "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF2781:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2289:
+	.string	"TCP_REPAIR_OFF 0"
+.LASF2629:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF2430:
+	.string	"USE_UART6 "
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2926:
+	.string	"UART6_RX_BUFFER_SIZE 256"
+.LASF2652:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2243:
+	.string	"IN6_IS_ADDR_MULTICAST(a) (((const uint8_t *) (a))[0] == 0xff)"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2167:
+	.string	"IPPROTO_UDP IPPROTO_UDP"
+.LASF2740:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1188:
+	.string	"__S_IFCHR 0020000"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1011:
+	.string	"ENOTRECOVERABLE 131"
+.LASF2714:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1593:
+	.string	"_CS_XBS5_ILP32_OFF32_CFLAGS _CS_XBS5_ILP32_OFF32_CFLAGS"
+.LASF2398:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF3056:
+	.string	"IPPROTO_ICMP"
+.LASF1517:
+	.string	"_SC_SHELL _SC_SHELL"
+.LASF1109:
+	.string	"DN_ATTRIB 0x00000020"
+.LASF1271:
+	.string	"_POSIX_THREAD_SAFE_FUNCTIONS 200809L"
+.LASF3078:
+	.string	"IPPROTO_MPLS"
+.LASF2271:
+	.string	"TCP_REPAIR_OPTIONS 22"
+.LASF1608:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LINTFLAGS _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS"
+.LASF2528:
+	.string	"IOCFG_OUT_PP 0"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF2209:
+	.string	"IN_MULTICAST(a) IN_CLASSD(a)"
+.LASF2773:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1395:
+	.string	"_SC_BC_BASE_MAX _SC_BC_BASE_MAX"
+.LASF1439:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING _SC_THREAD_PRIORITY_SCHEDULING"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1128:
+	.string	"__POSIX_FADV_DONTNEED 4"
+.LASF2671:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1507:
+	.string	"_SC_FILE_LOCKING _SC_FILE_LOCKING"
+.LASF1506:
+	.string	"_SC_FILE_ATTRIBUTES _SC_FILE_ATTRIBUTES"
+.LASF1718:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2177:
+	.string	"IPPROTO_BEETPH IPPROTO_BEETPH"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1769:
+	.string	"PF_RDS 21"
+.LASF907:
+	.string	"EFBIG 27"
+.LASF1810:
+	.string	"AF_NETBEUI PF_NETBEUI"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1763:
+	.string	"PF_NETLINK 16"
+.LASF2899:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF2601:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF2730:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1358:
+	.string	"_SC_ARG_MAX _SC_ARG_MAX"
+.LASF1318:
+	.string	"_POSIX_V7_LP64_OFF64 1"
+.LASF2941:
+	.string	"short int"
+.LASF1236:
+	.string	"_UNISTD_H 1"
+.LASF1176:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1951:
+	.string	"SO_PASSCRED 16"
+.LASF2849:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF2479:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1696:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1280:
+	.string	"_POSIX_REALTIME_SIGNALS 200809L"
+.LASF1812:
+	.string	"AF_KEY PF_KEY"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1525:
+	.string	"_SC_TYPED_MEMORY_OBJECTS _SC_TYPED_MEMORY_OBJECTS"
+.LASF3236:
+	.string	"tcpListen"
+.LASF906:
+	.string	"ETXTBSY 26"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF813:
+	.string	"EOF (-1)"
+.LASF2304:
+	.string	"TCPOLEN_SACK_PERMITTED 2"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF2393:
+	.string	"_T_WCHAR_ "
+.LASF3011:
+	.string	"MSG_CTRUNC"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2463:
+	.string	"USE_SERVOS"
+.LASF3018:
+	.string	"MSG_SYN"
+.LASF1741:
+	.string	"SOCK_DCCP SOCK_DCCP"
+.LASF1063:
+	.string	"F_SETFD 2"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF2556:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF2322:
+	.string	"TCP_COOKIE_MIN 8"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2504:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1365:
+	.string	"_SC_JOB_CONTROL _SC_JOB_CONTROL"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1817:
+	.string	"AF_ECONET PF_ECONET"
+.LASF1913:
+	.string	"_LINUX_STDDEF_H "
+.LASF2935:
+	.string	"TCP_SERIAL_TX_BUFFER_SIZE 2048"
+.LASF2439:
+	.string	"USE_SERIALRX_IBUS"
+.LASF2560:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1291:
+	.string	"_POSIX_THREAD_CPUTIME 0"
+.LASF2786:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1744:
+	.string	"SOCK_NONBLOCK SOCK_NONBLOCK"
+.LASF2166:
+	.string	"IPPROTO_PUP IPPROTO_PUP"
+.LASF1968:
+	.string	"SO_MARK 36"
+.LASF2685:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF2763:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF944:
+	.string	"ENONET 64"
+.LASF1752:
+	.string	"PF_APPLETALK 5"
+.LASF919:
+	.string	"ENOTEMPTY 39"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1793:
+	.string	"PF_MCTP 45"
+.LASF2459:
+	.string	"VTX_SMARTAUDIO"
+.LASF1243:
+	.string	"_POSIX2_SW_DEV __POSIX2_THIS_VERSION"
+.LASF1976:
+	.string	"SO_LOCK_FILTER 44"
+.LASF509:
+	.string	"__P(args) args"
+.LASF2782:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2030:
+	.string	"IP_OPTIONS 4"
+.LASF1540:
+	.string	"_SC_HOST_NAME_MAX _SC_HOST_NAME_MAX"
+.LASF1683:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF2557:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1160:
+	.string	"AT_STATX_SYNC_AS_STAT 0x0000"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF763:
+	.string	"_STDIO_H 1"
+.LASF2251:
+	.string	"TCP_MAXSEG 2"
+.LASF2970:
+	.string	"_fileno"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1234:
+	.string	"F_TLOCK 2"
+.LASF1303:
+	.string	"_POSIX_CLOCK_SELECTION 200809L"
+.LASF864:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF3159:
+	.string	"identifier"
+.LASF1844:
+	.string	"AF_MAX PF_MAX"
+.LASF2863:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2927:
+	.string	"UART6_TX_BUFFER_SIZE 256"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2950:
+	.string	"__socklen_t"
+.LASF1130:
+	.string	"POSIX_FADV_NORMAL 0"
+.LASF3227:
+	.string	"used"
+.LASF2613:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1414:
+	.string	"_SC_PII_SOCKET _SC_PII_SOCKET"
+.LASF2305:
+	.string	"TCPOPT_SACK 5"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2757:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2471:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2135:
+	.string	"IPV6_TCLASS 67"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF2108:
+	.string	"IPV6_MTU_DISCOVER 23"
+.LASF2850:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1084:
+	.string	"F_GET_SEALS 1034"
+.LASF1642:
+	.string	"_CS_V7_ENV _CS_V7_ENV"
+.LASF393:
+	.string	"SITL 1"
+.LASF1981:
+	.string	"SO_INCOMING_CPU 49"
+.LASF3228:
+	.string	"tcpTotalRxBytesWaiting"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1500:
+	.string	"_SC_DEVICE_IO _SC_DEVICE_IO"
+.LASF989:
+	.string	"ETOOMANYREFS 109"
+.LASF861:
+	.string	"__f64x(x) x ##f64x"
+.LASF1681:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1945:
+	.string	"SO_OOBINLINE 10"
+.LASF2120:
+	.string	"IPV6_RECVPKTINFO 49"
+.LASF2482:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF2785:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1694:
+	.string	"__sigset_t_defined 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF2395:
+	.string	"__WCHAR_T "
+.LASF1653:
+	.string	"_SYS_TYPES_H 1"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF2948:
+	.string	"__ssize_t"
+.LASF1102:
+	.string	"LOCK_WRITE 128"
+.LASF1028:
+	.string	"O_EXCL 0200"
+.LASF1480:
+	.string	"_SC_NL_LANGMAX _SC_NL_LANGMAX"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF2770:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2339:
+	.string	"USE_CLI "
+.LASF1052:
+	.string	"O_DIRECTORY __O_DIRECTORY"
+.LASF2178:
+	.string	"IPPROTO_ENCAP IPPROTO_ENCAP"
+.LASF1062:
+	.string	"F_GETFD 1"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF3150:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF971:
+	.string	"EPROTOTYPE 91"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1330:
+	.string	"__gid_t_defined "
+.LASF2945:
+	.string	"long int"
+.LASF2759:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF851:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2748:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2589:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF3104:
+	.string	"OWNER_SERIAL_RX"
+.LASF3004:
+	.string	"sockaddr"
+.LASF1734:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF2901:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"_SC_SHRT_MAX _SC_SHRT_MAX"
+.LASF2603:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1947:
+	.string	"SO_PRIORITY 12"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1164:
+	.string	"AT_EACCESS 0x200"
+.LASF1259:
+	.string	"_POSIX_MAPPED_FILES 200809L"
+.LASF2139:
+	.string	"IPV6_ORIGDSTADDR 74"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1065:
+	.string	"F_SETFL 4"
+.LASF1002:
+	.string	"EDQUOT 122"
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2860:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF3124:
+	.string	"OWNER_SPI_CS"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1686:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF844:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1609:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_CFLAGS _CS_POSIX_V6_ILP32_OFF32_CFLAGS"
+.LASF1055:
+	.string	"O_DIRECT __O_DIRECT"
+.LASF2003:
+	.string	"SO_RCVTIMEO_NEW 66"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2313:
+	.string	"SOL_TCP 6"
+.LASF1089:
+	.string	"F_DUPFD_CLOEXEC 1030"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1985:
+	.string	"SO_ATTACH_REUSEPORT_EBPF 52"
+.LASF1533:
+	.string	"_SC_SYMLOOP_MAX _SC_SYMLOOP_MAX"
+.LASF1790:
+	.string	"PF_QIPCRTR 42"
+.LASF1376:
+	.string	"_SC_MEMLOCK_RANGE _SC_MEMLOCK_RANGE"
+.LASF2391:
+	.string	"__WCHAR_T__ "
+.LASF1007:
+	.string	"EKEYEXPIRED 127"
+.LASF2884:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF816:
+	.string	"SEEK_END 2"
+.LASF2377:
+	.string	"_STDDEF_H_ "
+.LASF2191:
+	.string	"IPPROTO_NONE IPPROTO_NONE"
+.LASF1491:
+	.string	"_SC_XOPEN_REALTIME_THREADS _SC_XOPEN_REALTIME_THREADS"
+.LASF3147:
+	.string	"SERIAL_STOPBITS_1"
+.LASF3148:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1502:
+	.string	"_SC_DEVICE_SPECIFIC_R _SC_DEVICE_SPECIFIC_R"
+.LASF2453:
+	.string	"TELEMETRY_MAVLINK"
+.LASF3103:
+	.string	"OWNER_SERIAL_TX"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF2248:
+	.string	"IN6_IS_ADDR_MC_GLOBAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0xe))"
+.LASF2993:
+	.string	"SOCK_STREAM"
+.LASF1861:
+	.string	"SOL_RDS 276"
+.LASF1515:
+	.string	"_SC_REGEXP _SC_REGEXP"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF2645:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF2502:
+	.string	"Q12 (1 << 12)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF3218:
+	.string	"tcpSetBaudRate"
+.LASF1356:
+	.string	"_PC_SYMLINK_MAX _PC_SYMLINK_MAX"
+.LASF2960:
+	.string	"_IO_write_base"
+.LASF1846:
+	.string	"SOL_DECNET 261"
+.LASF3021:
+	.string	"MSG_ERRQUEUE"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF1503:
+	.string	"_SC_FD_MGMT _SC_FD_MGMT"
+.LASF2124:
+	.string	"IPV6_RECVHOPOPTS 53"
+.LASF1374:
+	.string	"_SC_MAPPED_FILES _SC_MAPPED_FILES"
+.LASF2137:
+	.string	"IPV6_ADDR_PREFERENCES 72"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF3035:
+	.string	"sin_port"
+.LASF2553:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF401:
+	.string	"true 1"
+.LASF3145:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2140:
+	.string	"IPV6_RECVORIGDSTADDR IPV6_ORIGDSTADDR"
+.LASF1387:
+	.string	"_SC_VERSION _SC_VERSION"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF2291:
+	.string	"TH_FIN 0x01"
+.LASF2729:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF3029:
+	.string	"sockaddr_at"
+.LASF2576:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1286:
+	.string	"_LFS_LARGEFILE 1"
+.LASF1912:
+	.string	"_LINUX_POSIX_TYPES_H "
+.LASF2915:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF847:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2128:
+	.string	"IPV6_RTHDR 57"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2687:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1167:
+	.string	"__pid_t_defined "
+.LASF1438:
+	.string	"_SC_THREAD_ATTR_STACKSIZE _SC_THREAD_ATTR_STACKSIZE"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1682:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF2756:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1828:
+	.string	"AF_TIPC PF_TIPC"
+.LASF863:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1534:
+	.string	"_SC_STREAMS _SC_STREAMS"
+.LASF1018:
+	.string	"__O_LARGEFILE 0"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1003:
+	.string	"ENOMEDIUM 123"
+.LASF2933:
+	.string	"TCP_SERIAL_BASE_PORT 5760"
+.LASF1213:
+	.string	"S_ISUID __S_ISUID"
+.LASF1928:
+	.string	"FIOGETOWN 0x8903"
+.LASF2267:
+	.string	"TCP_USER_TIMEOUT 18"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1006:
+	.string	"ENOKEY 126"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1142:
+	.string	"SPLICE_F_MORE 4"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF2599:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2824:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2900:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2814:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF3170:
+	.string	"txBufferTail"
+.LASF987:
+	.string	"ENOTCONN 107"
+.LASF1936:
+	.string	"SO_TYPE 3"
+.LASF1959:
+	.string	"SO_SECURITY_ENCRYPTION_NETWORK 24"
+.LASF2157:
+	.string	"IPV6_RTHDR_LOOSE 0"
+.LASF1137:
+	.string	"SYNC_FILE_RANGE_WRITE 2"
+.LASF824:
+	.string	"L_ctermid 9"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1819:
+	.string	"AF_RDS PF_RDS"
+.LASF895:
+	.string	"ENOTBLK 15"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF2577:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF896:
+	.string	"EBUSY 16"
+.LASF1289:
+	.string	"_POSIX_SHARED_MEMORY_OBJECTS 200809L"
+.LASF1421:
+	.string	"_SC_PII_INTERNET_STREAM _SC_PII_INTERNET_STREAM"
+.LASF1811:
+	.string	"AF_SECURITY PF_SECURITY"
+.LASF1705:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF3058:
+	.string	"IPPROTO_IPIP"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF2232:
+	.string	"ntohl(x) __bswap_32 (x)"
+.LASF3173:
+	.string	"serialPortVTable"
+.LASF1613:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_CFLAGS _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1027:
+	.string	"O_CREAT 0100"
+.LASF1071:
+	.string	"__F_GETSIG 11"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF3110:
+	.string	"OWNER_SPI_SCK"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1833:
+	.string	"AF_PHONET PF_PHONET"
+.LASF2662:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2772:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2318:
+	.string	"TCPI_OPT_ECN_SEEN 16"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF914:
+	.string	"ERANGE 34"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF923:
+	.string	"EIDRM 43"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1944:
+	.string	"SO_KEEPALIVE 9"
+.LASF941:
+	.string	"ENODATA 61"
+.LASF2655:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1751:
+	.string	"PF_IPX 4"
+.LASF2752:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1859:
+	.string	"SOL_BLUETOOTH 274"
+.LASF1843:
+	.string	"AF_MCTP PF_MCTP"
+.LASF3031:
+	.string	"sockaddr_dl"
+.LASF1399:
+	.string	"_SC_COLL_WEIGHTS_MAX _SC_COLL_WEIGHTS_MAX"
+.LASF2567:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1940:
+	.string	"SO_SNDBUF 7"
+.LASF3090:
+	.string	"USART_TypeDef"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1719:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1184:
+	.string	"_STATBUF_ST_RDEV "
+.LASF1272:
+	.string	"_POSIX_THREAD_PRIORITY_SCHEDULING 200809L"
+.LASF1703:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF2437:
+	.string	"SERIAL_RX"
+.LASF1300:
+	.string	"_POSIX_MESSAGE_PASSING 200809L"
+.LASF765:
+	.string	"__need_NULL "
+.LASF930:
+	.string	"ENOCSI 50"
+.LASF859:
+	.string	"__f64(x) x ##f64"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1267:
+	.string	"_XOPEN_REALTIME_THREADS 1"
+.LASF2357:
+	.string	"USE_RESOURCE_MGMT "
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2082:
+	.string	"IP_PMTUDISC_DO 2"
+.LASF794:
+	.string	"____FILE_defined 1"
+.LASF1093:
+	.string	"F_UNLCK 2"
+.LASF2414:
+	.string	"U_ID_1 1"
+.LASF2219:
+	.string	"INADDR_ALLHOSTS_GROUP ((in_addr_t) 0xe0000001)"
+.LASF2146:
+	.string	"IPV6_DROP_MEMBERSHIP IPV6_LEAVE_GROUP"
+.LASF2973:
+	.string	"_cur_column"
+.LASF1254:
+	.string	"_POSIX_JOB_CONTROL 1"
+.LASF1035:
+	.string	"O_FSYNC O_SYNC"
+.LASF1077:
+	.string	"F_GETOWN_EX __F_GETOWN_EX"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF2683:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF902:
+	.string	"EINVAL 22"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF2489:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF928:
+	.string	"ELNRNG 48"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1315:
+	.string	"_POSIX_V7_LPBIG_OFFBIG -1"
+.LASF2346:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1465:
+	.string	"_SC_INT_MIN _SC_INT_MIN"
+.LASF2130:
+	.string	"IPV6_DSTOPTS 59"
+.LASF2225:
+	.string	"s6_addr32 __in6_u.__u6_addr32"
+.LASF2501:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF3195:
+	.string	"tcpPorts"
+.LASF3005:
+	.string	"sa_family"
+.LASF1740:
+	.string	"SOCK_SEQPACKET SOCK_SEQPACKET"
+.LASF1980:
+	.string	"SO_BPF_EXTENSIONS 48"
+.LASF2367:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF3146:
+	.string	"SERIAL_INVERTED"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1250:
+	.string	"_XOPEN_UNIX 1"
+.LASF1900:
+	.string	"MSG_CMSG_CLOEXEC MSG_CMSG_CLOEXEC"
+.LASF2774:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1807:
+	.string	"AF_INET6 PF_INET6"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2356:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF2526:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2725:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1364:
+	.string	"_SC_TZNAME_MAX _SC_TZNAME_MAX"
+.LASF2190:
+	.string	"IPPROTO_ICMPV6 IPPROTO_ICMPV6"
+.LASF1910:
+	.string	"SCM_CREDENTIALS SCM_CREDENTIALS"
+.LASF2277:
+	.string	"TCP_SAVED_SYN 28"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1725:
+	.string	"__LOCK_ALIGNMENT "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2483:
+	.string	"EEPROM_SIZE 32768"
+.LASF1347:
+	.string	"_PC_ASYNC_IO _PC_ASYNC_IO"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1444:
+	.string	"_SC_NPROCESSORS_ONLN _SC_NPROCESSORS_ONLN"
+.LASF875:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1589:
+	.string	"_CS_LFS64_CFLAGS _CS_LFS64_CFLAGS"
+.LASF1147:
+	.string	"FALLOC_FL_NO_HIDE_STALE 0x04"
+.LASF2288:
+	.string	"TCP_REPAIR_ON 1"
+.LASF1737:
+	.string	"SOCK_DGRAM SOCK_DGRAM"
+.LASF1898:
+	.string	"MSG_ZEROCOPY MSG_ZEROCOPY"
+.LASF1138:
+	.string	"SYNC_FILE_RANGE_WAIT_AFTER 4"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF2351:
+	.string	"LED_STRIP "
+.LASF3190:
+	.string	"listenFd"
+.LASF1235:
+	.string	"F_TEST 3"
+.LASF1787:
+	.string	"PF_NFC 39"
+.LASF1630:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS"
+.LASF2355:
+	.string	"TELEMETRY_LTM "
+.LASF1464:
+	.string	"_SC_INT_MAX _SC_INT_MAX"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2801:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1369:
+	.string	"_SC_TIMERS _SC_TIMERS"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2279:
+	.string	"TCP_FASTOPEN_CONNECT 30"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF2109:
+	.string	"IPV6_MTU 24"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF2904:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1478:
+	.string	"_SC_USHRT_MAX _SC_USHRT_MAX"
+.LASF1663:
+	.string	"__clockid_t_defined 1"
+.LASF2628:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1903:
+	.string	"CMSG_FIRSTHDR(mhdr) ((size_t) (mhdr)->msg_controllen >= sizeof (struct cmsghdr) ? (struct cmsghdr *) (mhdr)->msg_control : (struct cmsghdr *) 0)"
+.LASF1937:
+	.string	"SO_ERROR 4"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1948:
+	.string	"SO_LINGER 13"
+.LASF1972:
+	.string	"SO_WIFI_STATUS 41"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1455:
+	.string	"_SC_2_CHAR_TERM _SC_2_CHAR_TERM"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF3082:
+	.string	"IPPROTO_MAX"
+.LASF2649:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2947:
+	.string	"__off64_t"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF826:
+	.string	"FOPEN_MAX"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF913:
+	.string	"EDOM 33"
+.LASF3033:
+	.string	"sockaddr_in"
+.LASF2323:
+	.string	"TCP_COOKIE_MAX 16"
+.LASF2800:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1068:
+	.string	"F_SETOWN __F_SETOWN"
+.LASF2297:
+	.string	"TCPOPT_EOL 0"
+.LASF1561:
+	.string	"_SC_RAW_SOCKETS _SC_RAW_SOCKETS"
+.LASF2029:
+	.string	"__USE_KERNEL_IPV6_DEFS 0"
+.LASF1340:
+	.string	"_PC_NAME_MAX _PC_NAME_MAX"
+.LASF2940:
+	.string	"signed char"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1649:
+	.string	"_ARPA_INET_H 1"
+.LASF979:
+	.string	"EADDRNOTAVAIL 99"
+.LASF1664:
+	.string	"__timer_t_defined 1"
+.LASF1794:
+	.string	"PF_MAX 46"
+.LASF877:
+	.string	"_ERRNO_H 1"
+.LASF2511:
+	.string	"EXPAND_I(x) x"
+.LASF1862:
+	.string	"SOL_IUCV 277"
+.LASF1896:
+	.string	"MSG_WAITFORONE MSG_WAITFORONE"
+.LASF1957:
+	.string	"SO_SECURITY_AUTHENTICATION 22"
+.LASF1961:
+	.string	"SO_ATTACH_FILTER 26"
+.LASF2179:
+	.string	"IPPROTO_PIM IPPROTO_PIM"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF3026:
+	.string	"MSG_ZEROCOPY"
+.LASF924:
+	.string	"ECHRNG 44"
+.LASF3141:
+	.string	"MODE_RX"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1313:
+	.string	"_POSIX_TRACE_LOG -1"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1342:
+	.string	"_PC_PIPE_BUF _PC_PIPE_BUF"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF2550:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1729:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF3036:
+	.string	"sin_addr"
+.LASF2201:
+	.string	"IN_CLASSB_NSHIFT 16"
+.LASF1178:
+	.string	"_BITS_STAT_H 1"
+.LASF2784:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1425:
+	.string	"_SC_PII_OSI_M _SC_PII_OSI_M"
+.LASF2492:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1939:
+	.string	"SO_BROADCAST 6"
+.LASF3238:
+	.string	"tcpSetNonBlocking"
+.LASF882:
+	.string	"ENOENT 2"
+.LASF1433:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS _SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF984:
+	.string	"ECONNRESET 104"
+.LASF1873:
+	.string	"_BITS_SOCKADDR_H 1"
+.LASF1958:
+	.string	"SO_SECURITY_ENCRYPTION_TRANSPORT 23"
+.LASF2851:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2883:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1532:
+	.string	"_SC_2_PBS_TRACK _SC_2_PBS_TRACK"
+.LASF2169:
+	.string	"IPPROTO_TP IPPROTO_TP"
+.LASF2065:
+	.string	"IP_RECVTOS 13"
+.LASF1848:
+	.string	"SOL_PACKET 263"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF2998:
+	.string	"SOCK_DCCP"
+.LASF1475:
+	.string	"_SC_UCHAR_MAX _SC_UCHAR_MAX"
+.LASF2057:
+	.string	"MCAST_INCLUDE 1"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1625:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_CFLAGS _CS_POSIX_V7_ILP32_OFF32_CFLAGS"
+.LASF900:
+	.string	"ENOTDIR 20"
+.LASF1189:
+	.string	"__S_IFBLK 0060000"
+.LASF2451:
+	.string	"TELEMETRY_SRXL"
+.LASF2031:
+	.string	"IP_HDRINCL 3"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1297:
+	.string	"_POSIX_SPAWN 200809L"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF2240:
+	.string	"IN6_IS_ADDR_V4MAPPED(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == htonl (0xffff); }))"
+.LASF3196:
+	.string	"tcpVTable"
+.LASF2618:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF860:
+	.string	"__f32x(x) x ##f32x"
+.LASF1969:
+	.string	"SO_PROTOCOL 38"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF2569:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF3027:
+	.string	"MSG_FASTOPEN"
+.LASF1078:
+	.string	"F_SETLEASE 1024"
+.LASF2875:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1110:
+	.string	"DN_MULTISHOT 0x80000000"
+.LASF3142:
+	.string	"MODE_TX"
+.LASF1878:
+	.string	"_SS_PADSIZE (_SS_SIZE - __SOCKADDR_COMMON_SIZE - sizeof (__ss_aligntype))"
+.LASF1379:
+	.string	"_SC_SEMAPHORES _SC_SEMAPHORES"
+.LASF2401:
+	.string	"___int_wchar_t_h "
+.LASF961:
+	.string	"ELIBSCN 81"
+.LASF2708:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF3201:
+	.string	"bind"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1755:
+	.string	"PF_ATMPVC 8"
+.LASF1989:
+	.string	"SO_INCOMING_NAPI_ID 56"
+.LASF834:
+	.string	"RENAME_WHITEOUT (1 << 2)"
+.LASF2796:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2788:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2902:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2046:
+	.string	"IP_MSFILTER 41"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2233:
+	.string	"ntohs(x) __bswap_16 (x)"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2143:
+	.string	"IPV6_RECVFRAGSIZE 77"
+.LASF2091:
+	.string	"IPV6_2292PKTINFO 2"
+.LASF2121:
+	.string	"IPV6_PKTINFO 50"
+.LASF2332:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1837:
+	.string	"AF_NFC PF_NFC"
+.LASF2230:
+	.string	"IP_MSFILTER_SIZE(numsrc) (sizeof (struct ip_msfilter) - sizeof (struct in_addr) + (numsrc) * sizeof (struct in_addr))"
+.LASF1268:
+	.string	"_XOPEN_SHM 1"
+.LASF1797:
+	.string	"AF_UNIX PF_UNIX"
+.LASF1412:
+	.string	"_SC_PII _SC_PII"
+.LASF2694:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2727:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1554:
+	.string	"_SC_LEVEL3_CACHE_SIZE _SC_LEVEL3_CACHE_SIZE"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1459:
+	.string	"_SC_XOPEN_XPG3 _SC_XOPEN_XPG3"
+.LASF2823:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF976:
+	.string	"EPFNOSUPPORT 96"
+.LASF2445:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF2959:
+	.string	"_IO_read_base"
+.LASF1864:
+	.string	"SOL_ALG 279"
+.LASF2704:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2204:
+	.string	"IN_CLASSC(a) ((((in_addr_t)(a)) & 0xe0000000) == 0xc0000000)"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF2699:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1995:
+	.string	"SCM_TXTIME SO_TXTIME"
+.LASF2562:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2952:
+	.string	"uint16_t"
+.LASF2862:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1808:
+	.string	"AF_ROSE PF_ROSE"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2454:
+	.string	"TELEMETRY_IBUS"
+.LASF2614:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF3233:
+	.string	"head"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF2151:
+	.string	"IPV6_PMTUDISC_DO 2"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF850:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2302:
+	.string	"TCPOLEN_WINDOW 3"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1017:
+	.string	"_FCNTL_H 1"
+.LASF1853:
+	.string	"SOL_LLC 268"
+.LASF809:
+	.string	"_IOFBF 0"
+.LASF2815:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF3047:
+	.string	"sockaddr_ns"
+.LASF1469:
+	.string	"_SC_NZERO _SC_NZERO"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1894:
+	.string	"MSG_NOSIGNAL MSG_NOSIGNAL"
+.LASF3209:
+	.string	"send"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2991:
+	.string	"long long unsigned int"
+.LASF2719:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1838:
+	.string	"AF_VSOCK PF_VSOCK"
+.LASF3235:
+	.string	"sent"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1092:
+	.string	"F_WRLCK 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1614:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS"
+.LASF2703:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1516:
+	.string	"_SC_REGEX_VERSION _SC_REGEX_VERSION"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF2041:
+	.string	"IP_DROP_MEMBERSHIP 36"
+.LASF2909:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF2461:
+	.string	"BLACKBOX"
+.LASF3057:
+	.string	"IPPROTO_IGMP"
+.LASF2007:
+	.string	"SO_BUSY_POLL_BUDGET 70"
+.LASF1120:
+	.string	"RWH_WRITE_LIFE_MEDIUM 3"
+.LASF986:
+	.string	"EISCONN 106"
+.LASF3034:
+	.string	"sin_family"
+.LASF2086:
+	.string	"SOL_IP 0"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF2361:
+	.string	"TELEMETRY_CRSF "
+.LASF2914:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF3066:
+	.string	"IPPROTO_IPV6"
+.LASF1952:
+	.string	"SO_PEERCRED 17"
+.LASF3102:
+	.string	"OWNER_ADC_RSSI"
+.LASF918:
+	.string	"ENOSYS 38"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF3070:
+	.string	"IPPROTO_AH"
+.LASF1435:
+	.string	"_SC_THREAD_STACK_MIN _SC_THREAD_STACK_MIN"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF3051:
+	.string	"__CONST_SOCKADDR_ARG"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF793:
+	.string	"_____fpos64_t_defined 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF2858:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1116:
+	.string	"RWH_WRITE_LIFE_NOT_SET 0"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1991:
+	.string	"SCM_TIMESTAMPING_PKTINFO 58"
+.LASF2205:
+	.string	"IN_CLASSC_NET 0xffffff00"
+.LASF3112:
+	.string	"OWNER_SPI_MOSI"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF2159:
+	.string	"IPV6_RTHDR_TYPE_0 0"
+.LASF1798:
+	.string	"AF_FILE PF_FILE"
+.LASF2795:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2672:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF933:
+	.string	"EBADR 53"
+.LASF1659:
+	.string	"__id_t_defined "
+.LASF1020:
+	.string	"F_SETLK64 6"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1588:
+	.string	"_CS_LFS_LINTFLAGS _CS_LFS_LINTFLAGS"
+.LASF2665:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF963:
+	.string	"ELIBEXEC 83"
+.LASF2186:
+	.string	"IPPROTO_MPTCP IPPROTO_MPTCP"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF3016:
+	.string	"MSG_WAITALL"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1265:
+	.string	"_POSIX_NO_TRUNC 1"
+.LASF2161:
+	.string	"IPPROTO_ICMP IPPROTO_ICMP"
+.LASF2308:
+	.string	"TCPOLEN_TSTAMP_APPA (TCPOLEN_TIMESTAMP+2)"
+.LASF2695:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1513:
+	.string	"_SC_READER_WRITER_LOCKS _SC_READER_WRITER_LOCKS"
+.LASF835:
+	.string	"__attr_dealloc_fclose"
+.LASF788:
+	.string	"__need___va_list "
+.LASF2619:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1657:
+	.string	"__dev_t_defined "
+.LASF1816:
+	.string	"AF_ASH PF_ASH"
+.LASF2440:
+	.string	"USE_SERIALRX_SBUS"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF2080:
+	.string	"IP_PMTUDISC_DONT 0"
+.LASF1296:
+	.string	"_POSIX_SPIN_LOCKS 200809L"
+.LASF1562:
+	.string	"_SC_V7_ILP32_OFF32 _SC_V7_ILP32_OFF32"
+.LASF2745:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1132:
+	.string	"POSIX_FADV_SEQUENTIAL 2"
+.LASF1921:
+	.string	"__ASM_GENERIC_POSIX_TYPES_H "
+.LASF2303:
+	.string	"TCPOPT_SACK_PERMITTED 4"
+.LASF2192:
+	.string	"IPPROTO_DSTOPTS IPPROTO_DSTOPTS"
+.LASF2906:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1501:
+	.string	"_SC_DEVICE_SPECIFIC _SC_DEVICE_SPECIFIC"
+.LASF1707:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1276:
+	.string	"_POSIX_THREAD_PRIO_PROTECT 200809L"
+.LASF843:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF2626:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2344:
+	.string	"USE_SERIALRX_IBUS "
+.LASF3012:
+	.string	"MSG_PROXY"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1881:
+	.string	"MSG_DONTROUTE MSG_DONTROUTE"
+.LASF1034:
+	.string	"O_SYNC 04010000"
+.LASF1902:
+	.string	"CMSG_NXTHDR(mhdr,cmsg) __cmsg_nxthdr (mhdr, cmsg)"
+.LASF3108:
+	.string	"OWNER_SONAR_ECHO"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF910:
+	.string	"EROFS 30"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF2063:
+	.string	"IP_RECVERR 11"
+.LASF2709:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2156:
+	.string	"SOL_ICMPV6 58"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2242:
+	.ascii	"IN6_ARE_ADDR_EQUAL(a,b) (__extension__ ({ const struct in6_a"
+	.ascii	"ddr *__a = (const struct in6_addr *) (a); const struct in6_a"
+	.ascii	"ddr *__b = (const struct in6_addr *"
+	.string	") (b); __a->__in6_u.__u6_addr32[0] == __b->__in6_u.__u6_addr32[0] && __a->__in6_u.__u6_addr32[1] == __b->__in6_u.__u6_addr32[1] && __a->__in6_u.__u6_addr32[2] == __b->__in6_u.__u6_addr32[2] && __a->__in6_u.__u6_addr32[3] == __b->__in6_u.__u6_addr32[3]; }))"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF3203:
+	.string	"socket"
+.LASF2985:
+	.string	"FILE"
+.LASF2754:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2001:
+	.string	"SO_TIMESTAMPNS_NEW 64"
+.LASF1043:
+	.string	"__O_DSYNC 010000"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1126:
+	.string	"FNONBLOCK O_NONBLOCK"
+.LASF2916:
+	.string	"UART1_RX_BUFFER_SIZE 256"
+.LASF2217:
+	.string	"INADDR_LOOPBACK ((in_addr_t) 0x7f000001)"
+.LASF3121:
+	.string	"OWNER_MPU_CS"
+.LASF2737:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1988:
+	.string	"SO_MEMINFO 55"
+.LASF2497:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1231:
+	.string	"F_OK 0"
+.LASF2199:
+	.string	"IN_CLASSB(a) ((((in_addr_t)(a)) & 0xc0000000) == 0x80000000)"
+.LASF1935:
+	.string	"SO_REUSEADDR 2"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF2218:
+	.string	"INADDR_UNSPEC_GROUP ((in_addr_t) 0xe0000000)"
+.LASF2873:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1585:
+	.string	"_CS_LFS_CFLAGS _CS_LFS_CFLAGS"
+.LASF2847:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1069:
+	.string	"F_GETOWN __F_GETOWN"
+.LASF3171:
+	.string	"rxCallback"
+.LASF1678:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF2505:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF3040:
+	.string	"sin6_port"
+.LASF1311:
+	.string	"_POSIX_TRACE_EVENT_FILTER -1"
+.LASF2974:
+	.string	"_vtable_offset"
+.LASF1245:
+	.string	"_XOPEN_VERSION 700"
+.LASF2633:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2320:
+	.string	"TCP_MD5SIG_MAXKEYLEN 80"
+.LASF1371:
+	.string	"_SC_PRIORITIZED_IO _SC_PRIORITIZED_IO"
+.LASF1348:
+	.string	"_PC_PRIO_IO _PC_PRIO_IO"
+.LASF2949:
+	.string	"char"
+.LASF2769:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF3098:
+	.string	"OWNER_ADC"
+.LASF1629:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_CFLAGS _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS"
+.LASF797:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF1666:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF2475:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1702:
+	.string	"__FDS_BITS(set) ((set)->fds_bits)"
+.LASF2510:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1520:
+	.string	"_SC_SPORADIC_SERVER _SC_SPORADIC_SERVER"
+.LASF1956:
+	.string	"SO_SNDTIMEO_OLD 21"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2509:
+	.string	"STR_HELPER(x) #x"
+.LASF1241:
+	.string	"_POSIX2_C_BIND __POSIX2_THIS_VERSION"
+.LASF1768:
+	.string	"PF_ATMSVC 20"
+.LASF3117:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF3013:
+	.string	"MSG_TRUNC"
+.LASF1461:
+	.string	"_SC_CHAR_BIT _SC_CHAR_BIT"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF3214:
+	.string	"instance"
+.LASF1660:
+	.string	"__daddr_t_defined "
+.LASF1014:
+	.string	"ENOTSUP EOPNOTSUPP"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF3048:
+	.string	"sockaddr_un"
+.LASF1264:
+	.string	"_POSIX_VDISABLE '\\0'"
+.LASF1367:
+	.string	"_SC_REALTIME_SIGNALS _SC_REALTIME_SIGNALS"
+.LASF1029:
+	.string	"O_NOCTTY 0400"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF2410:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2008:
+	.string	"SO_NETNS_COOKIE 71"
+.LASF1863:
+	.string	"SOL_CAIF 278"
+.LASF2660:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1097:
+	.string	"LOCK_EX 2"
+.LASF3076:
+	.string	"IPPROTO_SCTP"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1091:
+	.string	"F_RDLCK 0"
+.LASF1051:
+	.string	"O_LARGEFILE __O_LARGEFILE"
+.LASF3177:
+	.string	"serialRead"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF2173:
+	.string	"IPPROTO_GRE IPPROTO_GRE"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1111:
+	.string	"F_SEAL_SEAL 0x0001"
+.LASF3039:
+	.string	"sin6_family"
+.LASF2839:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF1760:
+	.string	"PF_NETBEUI 13"
+.LASF1973:
+	.string	"SCM_WIFI_STATUS SO_WIFI_STATUS"
+.LASF2215:
+	.string	"INADDR_DUMMY ((in_addr_t) 0xc0000008)"
+.LASF2310:
+	.string	"TCP_MSS 512"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF2407:
+	.string	"__need_wchar_t"
+.LASF993:
+	.string	"EHOSTUNREACH 113"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1107:
+	.string	"DN_DELETE 0x00000008"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF2228:
+	.string	"INET_ADDRSTRLEN 16"
+.LASF1964:
+	.string	"SO_PEERNAME 28"
+.LASF1911:
+	.string	"__ASM_GENERIC_SOCKET_H "
+.LASF1134:
+	.string	"POSIX_FADV_DONTNEED __POSIX_FADV_DONTNEED"
+.LASF1594:
+	.string	"_CS_XBS5_ILP32_OFF32_LDFLAGS _CS_XBS5_ILP32_OFF32_LDFLAGS"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF1918:
+	.string	"_ASM_X86_POSIX_TYPES_64_H "
+.LASF2282:
+	.string	"TCP_FASTOPEN_KEY 33"
+.LASF2273:
+	.string	"TCP_TIMESTAMP 24"
+.LASF3000:
+	.string	"SOCK_CLOEXEC"
+.LASF2298:
+	.string	"TCPOPT_NOP 1"
+.LASF2874:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF2249:
+	.string	"_NETINET_TCP_H 1"
+.LASF2866:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2566:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF1890:
+	.string	"MSG_SYN MSG_SYN"
+.LASF1494:
+	.string	"_SC_BASE _SC_BASE"
+.LASF2070:
+	.string	"IP_PASSSEC 18"
+.LASF929:
+	.string	"EUNATCH 49"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF898:
+	.string	"EXDEV 18"
+.LASF1428:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS _SC_THREAD_SAFE_FUNCTIONS"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1169:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF2571:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2062:
+	.string	"IP_MTU_DISCOVER 10"
+.LASF2624:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1402:
+	.string	"_SC_LINE_MAX _SC_LINE_MAX"
+.LASF1813:
+	.string	"AF_NETLINK PF_NETLINK"
+.LASF1239:
+	.string	"_POSIX2_VERSION __POSIX2_THIS_VERSION"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1758:
+	.string	"PF_ROSE 11"
+.LASF2821:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2296:
+	.string	"TH_URG 0x20"
+.LASF2153:
+	.string	"IPV6_PMTUDISC_INTERFACE 4"
+.LASF3055:
+	.string	"IPPROTO_IP"
+.LASF1317:
+	.string	"_XBS5_LPBIG_OFFBIG -1"
+.LASF2828:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1150:
+	.string	"FALLOC_FL_INSERT_RANGE 0x20"
+.LASF1099:
+	.string	"LOCK_UN 8"
+.LASF3075:
+	.string	"IPPROTO_COMP"
+.LASF2922:
+	.string	"UART4_RX_BUFFER_SIZE 256"
+.LASF2176:
+	.string	"IPPROTO_MTP IPPROTO_MTP"
+.LASF3139:
+	.string	"__socket_type"
+.LASF1841:
+	.string	"AF_SMC PF_SMC"
+.LASF1396:
+	.string	"_SC_BC_DIM_MAX _SC_BC_DIM_MAX"
+.LASF3015:
+	.string	"MSG_EOR"
+.LASF2656:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1335:
+	.string	"L_INCR SEEK_CUR"
+.LASF499:
+	.string	"__PMT"
+.LASF2488:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF3085:
+	.string	"__u6_addr16"
+.LASF2919:
+	.string	"UART2_TX_BUFFER_SIZE 256"
+.LASF2481:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2787:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1117:
+	.string	"RWF_WRITE_LIFE_NOT_SET RWH_WRITE_LIFE_NOT_SET"
+.LASF2779:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF3221:
+	.string	"data"
+.LASF3210:
+	.string	"USARTx"
+.LASF1578:
+	.string	"_CS_POSIX_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1452:
+	.string	"_SC_XOPEN_CRYPT _SC_XOPEN_CRYPT"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2196:
+	.string	"IN_CLASSA_NSHIFT 24"
+.LASF3097:
+	.string	"OWNER_LED"
+.LASF1198:
+	.string	"__S_ISGID 02000"
+.LASF1274:
+	.string	"_POSIX_THREAD_ATTR_STACKADDR 200809L"
+.LASF2422:
+	.string	"USE_FAKE_BARO "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2561:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1242:
+	.string	"_POSIX2_C_DEV __POSIX2_THIS_VERSION"
+.LASF1350:
+	.string	"_PC_FILESIZEBITS _PC_FILESIZEBITS"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2811:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1526:
+	.string	"_SC_USER_GROUPS _SC_USER_GROUPS"
+.LASF1978:
+	.string	"SO_BUSY_POLL 46"
+.LASF1736:
+	.string	"SOCK_STREAM SOCK_STREAM"
+.LASF2969:
+	.string	"_chain"
+.LASF1899:
+	.string	"MSG_FASTOPEN MSG_FASTOPEN"
+.LASF1304:
+	.string	"_POSIX_ADVISORY_INFO 200809L"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1009:
+	.string	"EKEYREJECTED 129"
+.LASF1570:
+	.string	"_SC_TRACE_USER_EVENT_MAX _SC_TRACE_USER_EVENT_MAX"
+.LASF2056:
+	.string	"MCAST_EXCLUDE 0"
+.LASF954:
+	.string	"EBADMSG 74"
+.LASF2416:
+	.string	"LED0_PIN NONE"
+.LASF2292:
+	.string	"TH_SYN 0x02"
+.LASF1008:
+	.string	"EKEYREVOKED 128"
+.LASF3160:
+	.string	"mode"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF792:
+	.string	"____mbstate_t_defined 1"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF2600:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1842:
+	.string	"AF_XDP PF_XDP"
+.LASF2680:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1474:
+	.string	"_SC_SHRT_MIN _SC_SHRT_MIN"
+.LASF2040:
+	.string	"IP_ADD_MEMBERSHIP 35"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF3086:
+	.string	"__u6_addr32"
+.LASF2247:
+	.string	"IN6_IS_ADDR_MC_ORGLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x8))"
+.LASF1443:
+	.string	"_SC_NPROCESSORS_CONF _SC_NPROCESSORS_CONF"
+.LASF2034:
+	.string	"IP_RECVOPTS 6"
+.LASF1201:
+	.string	"__S_IWRITE 0200"
+.LASF1986:
+	.string	"SO_CNX_ADVICE 53"
+.LASF2127:
+	.string	"IPV6_RECVRTHDR 56"
+.LASF1704:
+	.string	"NFDBITS __NFDBITS"
+.LASF2846:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1255:
+	.string	"_POSIX_SAVED_IDS 1"
+.LASF980:
+	.string	"ENETDOWN 100"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1897:
+	.string	"MSG_BATCH MSG_BATCH"
+.LASF886:
+	.string	"ENXIO 6"
+.LASF876:
+	.string	"_STRINGS_H 1"
+.LASF2546:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2200:
+	.string	"IN_CLASSB_NET 0xffff0000"
+.LASF2317:
+	.string	"TCPI_OPT_ECN 8"
+.LASF1631:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LIBS _CS_POSIX_V7_ILP32_OFFBIG_LIBS"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2048:
+	.string	"MCAST_BLOCK_SOURCE 43"
+.LASF2353:
+	.string	"TELEMETRY_FRSKY "
+.LASF2642:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1391:
+	.string	"_SC_SEM_NSEMS_MAX _SC_SEM_NSEMS_MAX"
+.LASF2111:
+	.string	"IPV6_V6ONLY 26"
+.LASF1240:
+	.string	"_POSIX2_C_VERSION __POSIX2_THIS_VERSION"
+.LASF3071:
+	.string	"IPPROTO_MTP"
+.LASF1397:
+	.string	"_SC_BC_SCALE_MAX _SC_BC_SCALE_MAX"
+.LASF791:
+	.string	"_____fpos_t_defined 1"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2013:
+	.string	"SO_TIMESTAMP SO_TIMESTAMP_OLD"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1929:
+	.string	"SIOCGPGRP 0x8904"
+.LASF1942:
+	.string	"SO_SNDBUFFORCE 32"
+.LASF1792:
+	.string	"PF_XDP 44"
+.LASF1437:
+	.string	"_SC_THREAD_ATTR_STACKADDR _SC_THREAD_ATTR_STACKADDR"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF2460:
+	.string	"VTX_TRAMP"
+.LASF2491:
+	.string	"VERY_FAST_MATH "
+.LASF972:
+	.string	"ENOPROTOOPT 92"
+.LASF1012:
+	.string	"ERFKILL 132"
+.LASF1208:
+	.string	"S_IFBLK __S_IFBLK"
+.LASF2793:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2783:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF2516:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1916:
+	.string	"__DECLARE_FLEX_ARRAY(TYPE,NAME) struct { struct { } __empty_ ## NAME; TYPE NAME[]; }"
+.LASF1560:
+	.string	"_SC_IPV6 _SC_IPV6"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2053:
+	.string	"MCAST_MSFILTER 48"
+.LASF2073:
+	.string	"IP_RECVORIGDSTADDR IP_ORIGDSTADDR"
+.LASF2263:
+	.string	"TCP_MD5SIG 14"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF3215:
+	.string	"tcpEndWrite"
+.LASF3116:
+	.string	"OWNER_SDCARD_CS"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1131:
+	.string	"POSIX_FADV_RANDOM 1"
+.LASF2044:
+	.string	"IP_ADD_SOURCE_MEMBERSHIP 39"
+.LASF1417:
+	.string	"_SC_POLL _SC_POLL"
+.LASF852:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF2980:
+	.string	"_freeres_list"
+.LASF1545:
+	.string	"_SC_LEVEL1_ICACHE_SIZE _SC_LEVEL1_ICACHE_SIZE"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2543:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF2441:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF3239:
+	.string	"__bswap_32"
+.LASF3042:
+	.string	"sin6_addr"
+.LASF1543:
+	.string	"_SC_TRACE_INHERIT _SC_TRACE_INHERIT"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1583:
+	.string	"_CS_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF2684:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2405:
+	.string	"__DEFINED_wchar_t "
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2585:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2350:
+	.string	"BLACKBOX "
+.LASF3003:
+	.string	"_IO_FILE"
+.LASF3193:
+	.string	"buffering"
+.LASF3067:
+	.string	"IPPROTO_RSVP"
+.LASF2715:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2033:
+	.string	"IP_TTL 2"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1220:
+	.string	"S_IRGRP (S_IRUSR >> 3)"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1783:
+	.string	"PF_PHONET 35"
+.LASF2596:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2171:
+	.string	"IPPROTO_IPV6 IPPROTO_IPV6"
+.LASF2360:
+	.string	"CMS "
+.LASF2586:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1426:
+	.string	"_SC_T_IOV_MAX _SC_T_IOV_MAX"
+.LASF1727:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF2116:
+	.string	"IPV6_RECVERR_RFC4884 31"
+.LASF1815:
+	.string	"AF_PACKET PF_PACKET"
+.LASF3130:
+	.string	"OWNER_OSD"
+.LASF1047:
+	.string	"F_SETLKW F_SETLKW64"
+.LASF2435:
+	.string	"USE_PPM"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1726:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1449:
+	.string	"_SC_XOPEN_VERSION _SC_XOPEN_VERSION"
+.LASF2245:
+	.string	"IN6_IS_ADDR_MC_LINKLOCAL(a) (IN6_IS_ADDR_MULTICAST(a) && ((((const uint8_t *) (a))[1] & 0xf) == 0x2))"
+.LASF1847:
+	.string	"SOL_X25 262"
+.LASF1019:
+	.string	"F_GETLK64 5"
+.LASF3127:
+	.string	"OWNER_USB"
+.LASF2388:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF2394:
+	.string	"_T_WCHAR "
+.LASF2195:
+	.string	"IN_CLASSA_NET 0xff000000"
+.LASF783:
+	.string	"__size_t "
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2638:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF2760:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF3119:
+	.string	"OWNER_FLASH"
+.LASF934:
+	.string	"EXFULL 54"
+.LASF1931:
+	.string	"SIOCGSTAMP_OLD 0x8906"
+.LASF849:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1524:
+	.string	"_SC_TIMEOUTS _SC_TIMEOUTS"
+.LASF1053:
+	.string	"O_NOFOLLOW __O_NOFOLLOW"
+.LASF1247:
+	.string	"_XOPEN_XPG2 1"
+.LASF1856:
+	.string	"SOL_TIPC 271"
+.LASF1975:
+	.string	"SO_NOFCS 43"
+.LASF1672:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF3065:
+	.string	"IPPROTO_DCCP"
+.LASF1946:
+	.string	"SO_NO_CHECK 11"
+.LASF3006:
+	.string	"sa_data"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF2702:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF833:
+	.string	"RENAME_EXCHANGE (1 << 1)"
+.LASF2658:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2433:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1779:
+	.string	"PF_BLUETOOTH 31"
+.LASF1778:
+	.string	"PF_TIPC 30"
+.LASF2083:
+	.string	"IP_PMTUDISC_PROBE 3"
+.LASF2014:
+	.string	"SO_TIMESTAMPNS SO_TIMESTAMPNS_OLD"
+.LASF2612:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1013:
+	.string	"EHWPOISON 133"
+.LASF1840:
+	.string	"AF_QIPCRTR PF_QIPCRTR"
+.LASF1354:
+	.string	"_PC_REC_XFER_ALIGN _PC_REC_XFER_ALIGN"
+.LASF1122:
+	.string	"RWH_WRITE_LIFE_EXTREME 5"
+.LASF2257:
+	.string	"TCP_LINGER2 8"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1445:
+	.string	"_SC_PHYS_PAGES _SC_PHYS_PAGES"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF878:
+	.string	"_BITS_ERRNO_H 1"
+.LASF2797:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1576:
+	.string	"_CS_PATH _CS_PATH"
+.LASF1860:
+	.string	"SOL_PNPIPE 275"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1261:
+	.string	"_POSIX_MEMLOCK_RANGE 200809L"
+.LASF926:
+	.string	"EL3HLT 46"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF2651:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2724:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1472:
+	.string	"_SC_SCHAR_MIN _SC_SCHAR_MIN"
+.LASF1270:
+	.string	"_POSIX_REENTRANT_FUNCTIONS 1"
+.LASF1129:
+	.string	"__POSIX_FADV_NOREUSE 5"
+.LASF807:
+	.string	"__off64_t_defined "
+.LASF1419:
+	.string	"_SC_UIO_MAXIOV _SC_UIO_MAXIOV"
+.LASF1158:
+	.string	"AT_EMPTY_PATH 0x1000"
+.LASF2833:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1824:
+	.string	"AF_LLC PF_LLC"
+.LASF1871:
+	.string	"SOL_SMC 286"
+.LASF1587:
+	.string	"_CS_LFS_LIBS _CS_LFS_LIBS"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1700:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF2241:
+	.string	"IN6_IS_ADDR_V4COMPAT(a) (__extension__ ({ const struct in6_addr *__a = (const struct in6_addr *) (a); __a->__in6_u.__u6_addr32[0] == 0 && __a->__in6_u.__u6_addr32[1] == 0 && __a->__in6_u.__u6_addr32[2] == 0 && ntohl (__a->__in6_u.__u6_addr32[3]) > 1; }))"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF819:
+	.string	"P_tmpdir \"/tmp\""
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2473:
+	.string	"USED_TIMERS 0"
+.LASF1301:
+	.string	"_POSIX_THREAD_PROCESS_SHARED 200809L"
+.LASF2419:
+	.string	"ACC "
+.LASF2925:
+	.string	"UART5_TX_BUFFER_SIZE 256"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1153:
+	.string	"AT_FDCWD -100"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2981:
+	.string	"_freeres_buf"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF2132:
+	.string	"IPV6_PATHMTU 61"
+.LASF2519:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1221:
+	.string	"S_IWGRP (S_IWUSR >> 3)"
+.LASF2420:
+	.string	"USE_FAKE_ACC "
+.LASF1715:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2025:
+	.ascii	"__SOCKADDR_ALLTYPES __SOCKADDR_ONETYPE (sockaddr) __SOCKADDR"
+	.ascii	"_ONETYPE (sockaddr_at) __SOCKADDR_ONETYPE (sockaddr_ax25) __"
+	.ascii	"SOCKADDR_ONETYPE (sockaddr_dl) __SOCKADDR_ONETYPE (sockaddr_"
+	.ascii	"eon) __SOCKADDR_ONE"
+	.string	"TYPE (sockaddr_in) __SOCKADDR_ONETYPE (sockaddr_in6) __SOCKADDR_ONETYPE (sockaddr_inarp) __SOCKADDR_ONETYPE (sockaddr_ipx) __SOCKADDR_ONETYPE (sockaddr_iso) __SOCKADDR_ONETYPE (sockaddr_ns) __SOCKADDR_ONETYPE (sockaddr_un) __SOCKADDR_ONETYPE (sockaddr_x25)"
+.LASF2848:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF2421:
+	.string	"BARO "
+.LASF1085:
+	.string	"F_GET_RW_HINT 1035"
+.LASF2608:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF2722:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF2761:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2838:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF2830:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2534:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1623:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LIBS _CS_POSIX_V6_LPBIG_OFFBIG_LIBS"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3345:
+	.string	"posix_types_64.h"
+.LASF3339:
+	.string	"thread-shared-types.h"
+.LASF3283:
+	.string	"errno.h"
+.LASF3349:
+	.string	"tcp.h"
+.LASF3261:
+	.string	"/usr/include"
+.LASF3321:
+	.string	"struct_stat.h"
+.LASF3334:
+	.string	"select.h"
+.LASF3307:
+	.string	"floatn-common.h"
+.LASF3265:
+	.string	"stdint.h"
+.LASF3346:
+	.string	"bitsperlong.h"
+.LASF3258:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3300:
+	.string	"__fpos_t.h"
+.LASF3289:
+	.string	"wordsize.h"
+.LASF3313:
+	.string	"fcntl-linux.h"
+.LASF3249:
+	.string	"src/main/target/SITL"
+.LASF3342:
+	.string	"struct_mutex.h"
+.LASF3338:
+	.string	"pthreadtypes.h"
+.LASF3324:
+	.string	"confname.h"
+.LASF3352:
+	.string	"common_post.h"
+.LASF3323:
+	.string	"environments.h"
+.LASF3326:
+	.string	"getopt_core.h"
+.LASF3257:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3286:
+	.string	"libc-header-start.h"
+.LASF3332:
+	.string	"timer_t.h"
+.LASF3350:
+	.string	"platform.h"
+.LASF3262:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3301:
+	.string	"__mbstate_t.h"
+.LASF3276:
+	.string	"socket_type.h"
+.LASF3275:
+	.string	"resource.h"
+.LASF3341:
+	.string	"atomic_wide_counter.h"
+.LASF3255:
+	.string	"/usr/include/netinet"
+.LASF3331:
+	.string	"clockid_t.h"
+.LASF3270:
+	.string	"unistd.h"
+.LASF3284:
+	.string	"stdc-predef.h"
+.LASF3317:
+	.string	"endian.h"
+.LASF3287:
+	.string	"features.h"
+.LASF3279:
+	.string	"serial_tcp.c"
+.LASF3268:
+	.string	"FILE.h"
+.LASF3296:
+	.string	"time64.h"
+.LASF3278:
+	.string	"serial_tcp.h"
+.LASF3348:
+	.string	"struct_osockaddr.h"
+.LASF3312:
+	.string	"error_t.h"
+.LASF3336:
+	.string	"__sigset_t.h"
+.LASF3288:
+	.string	"features-time64.h"
+.LASF3310:
+	.string	"strings.h"
+.LASF3329:
+	.string	"inet.h"
+.LASF3343:
+	.string	"struct_rwlock.h"
+.LASF3282:
+	.string	"byteswap.h"
+.LASF3293:
+	.string	"stubs.h"
+.LASF3280:
+	.string	"string.h"
+.LASF3274:
+	.string	"target.h"
+.LASF3357:
+	.string	"io_def.h"
+.LASF3353:
+	.string	"maths.h"
+.LASF0:
+	.string	"./src/main/target/SITL/serial_tcp.c"
+.LASF3315:
+	.string	"falloc.h"
+.LASF3281:
+	.string	"fcntl.h"
+.LASF3297:
+	.string	"wchar.h"
+.LASF3290:
+	.string	"timesize.h"
+.LASF3247:
+	.string	"src/main/common"
+.LASF3260:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3328:
+	.string	"close_range.h"
+.LASF3304:
+	.string	"cookie_io_functions_t.h"
+.LASF3319:
+	.string	"time_t.h"
+.LASF3266:
+	.string	"stddef.h"
+.LASF3306:
+	.string	"floatn.h"
+.LASF3359:
+	.string	"serial_uart.h"
+.LASF3252:
+	.string	"/usr/include/arpa"
+.LASF3320:
+	.string	"stat.h"
+.LASF3351:
+	.string	"common.h"
+.LASF3294:
+	.string	"stubs-64.h"
+.LASF3355:
+	.string	"io.h"
+.LASF3302:
+	.string	"__fpos64_t.h"
+.LASF3358:
+	.string	"io_def_generated.h"
+.LASF3347:
+	.string	"sockios.h"
+.LASF3344:
+	.string	"posix_types.h"
+.LASF3333:
+	.string	"uintn-identity.h"
+.LASF3311:
+	.string	"errno-base.h"
+.LASF3254:
+	.string	"/usr/include/linux"
+.LASF3272:
+	.string	"socket.h"
+.LASF3327:
+	.string	"unistd_ext.h"
+.LASF3318:
+	.string	"endianness.h"
+.LASF3264:
+	.string	"stdint-uintn.h"
+.LASF3269:
+	.string	"stdio.h"
+.LASF3330:
+	.string	"clock_t.h"
+.LASF3267:
+	.string	"struct_FILE.h"
+.LASF3292:
+	.string	"long-double.h"
+.LASF3291:
+	.string	"cdefs.h"
+.LASF3299:
+	.string	"stdarg.h"
+.LASF3354:
+	.string	"utils.h"
+.LASF3295:
+	.string	"typesizes.h"
+.LASF3253:
+	.string	"/usr/include/asm-generic"
+.LASF3322:
+	.string	"posix_opt.h"
+.LASF3271:
+	.string	"sockaddr.h"
+.LASF3308:
+	.string	"locale_t.h"
+.LASF3250:
+	.string	"src/main/target"
+.LASF3273:
+	.string	"in.h"
+.LASF3248:
+	.string	"src/main/drivers"
+.LASF3285:
+	.string	"stdbool.h"
+.LASF3335:
+	.string	"sigset_t.h"
+.LASF3277:
+	.string	"serial.h"
+.LASF3305:
+	.string	"stdio_lim.h"
+.LASF3303:
+	.string	"__FILE.h"
+.LASF3316:
+	.string	"struct_timespec.h"
+.LASF3337:
+	.string	"struct_timeval.h"
+.LASF3298:
+	.string	"stdint-intn.h"
+.LASF3325:
+	.string	"getopt_posix.h"
+.LASF3309:
+	.string	"__locale_t.h"
+.LASF3263:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3314:
+	.string	"struct_iovec.h"
+.LASF3251:
+	.string	"src/main"
+.LASF3340:
+	.string	"pthreadtypes-arch.h"
+.LASF3356:
+	.string	"io_types.h"
+.LASF3256:
+	.string	"/usr/include/x86_64-linux-gnu/asm"
+.LASF3259:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.text
+	.section	.gnu.lto_.icf.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`N\001\255\t"
+	.string	"R\31526`m\263\006@\351{\366[\243\031\364Ue\353\366f\243\214,\033\275D\360\2526\320\261\364e\243;\212\242`\020H\300\002I\243\330HD\204$\221\"{\345\312\235\244\f\020\322\224S\bt\221\362\241\324\361"
+	.string	"\252\207\243`\322U\004o\244\303\3151\003\244\215\320\306\315e\224e4\362\264\313a\022A\311\346\025\354\356\305\207\306\347^WD\306T\200m\277\374K"
+	.string	"\221\2603\303\333dj\374\255\252pV<\350\334\262\026\023\035\025\327\375jk\331\031\366\375\357\030\306\212B\034 \246\265\327\343\324\272\236[\007l@\2629U\020+\371P|r^\375m\321h\016\250\270|\312 \372HO"
+	.string	":\361\304\370\324\324\361\217\303k-a,4\300\013\\ . P\202\202l\252\003=\020\341\022\032\243`\217\264\266\321\302\0049\2077\001\347+\t\027e{"
+	.ascii	";\002'\t\263\206o\310\2759\001\020\025p\210\200\037P\252{\273"
+	.ascii	"\301\330\340\006\026=\217\005V\013&\017\214\305\270\263\243\341"
+	.ascii	"X:ww#\201\301\027@\241e\0058\023\230\004\341\003L\013\325w\257"
+	.ascii	"\240\362R\227\264\211[\0247"
+	.text
+	.section	.gnu.lto_.ipa_sra.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"\275\004"
+	.string	"\262D\r\024\220E\351\371\273\273\273\273;_\277\332\267\377\345\237l\271S\n\222\326\272w\032F\347Q\226 K\207\306\252 \254\300\357\260\340\277\255\024\\\037\2577\321\364\\\034\0200 \340\002!;mf\031\320\225\001\017\271n\311Ch\t\233v\240\026\020.\203\320\005\013$\310\234\205\3111Q\006-J,\f\242\304`\313\223\354\207\345[\211\f\001\013B\303)\270\211\02174\314\364\036,,["
+	.string	""
+	.ascii	"\341\330\277\317b\204\306gO\0311\277\302\302\200\340\b\r\243"
+	.ascii	"H\003^\\\250!"
+	.text
+	.section	.gnu.lto_.inline.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`3\005\305\027"
+	.string	"f\"sG\340\322&\215\001\250\313\335H\377t\255\255\036i9b\250>kH\264(%\242\246\001\372\232\2406\257\253K\336\261\305\204\3653\377\305\215\375\312\320\334\0131\306\030\3131f\225\221\264\257\271v\f\265\247\035\263\2334\"\245L\001R"
+	.string	"^"
+	.string	"h"
+	.string	"\032\201E7x\210\341y\350\301\224\362T\351.vq\177\222\355[\372@\211 \204%k\253\277~\272V;\003\374R\031\307\241n\351o}\253\266\266\252h\256\253Ke\020B\323\267\026B\bw\344\224ml7\321|\205\373j\276'L{ \204\2477y;\020\373\nG\f$\035\250_\236w1S\037\265wq\355\224M\272q\303BW\224\006CP\t\325\277\364\347\310\206\204\201\375\314 \243\031\235g\254-9\355e)\317\273\250\251\266\273\230\277?=\227\316\230\3118J\375~\260\305y\tQ\303`\356\322\313\366\026 \204.\277\275\322\244\3609\203\233 W\001B<N\277\262QF\310O\311\310[\224E+\333M\206\254"
+	.string	"\202\2012\211\366\236\310\277v\007\204\220Dci\006\355\351`ci\205\365\204m\007\031\234\032\334(\327\356\322`\357\323]<\275V6\362\231\252\r\266>h8\354\244\276eE\320\350q\242"
+	.string	"\004\rR\023\213\004\026I\331\037@Cb\276ks@\344$\231\264s\026\013\337\305\273x\351\2343\375\272\377\t+c\266gQ\025B#|NX\366\205\211\017-\270Ww\361=\216\307G\206\204\340\2659\200\270\320Q0\267K\203\245L\221+\2250"
+	.string	"\275\220\233\262\301\266\322\t\257\215\206\035\233\005s05\022Bqs\372\026\035\2621C$\240ec401\224U=?\247\006\250h\266v]2\004\200\214\250q5c\206dd\202\244$I\007`\002!Dt\364\022\200U=\n)%&MQ*\245\355\260X\245\3634\231\250\366\311\331\273$\322\305C\210\364a\t\026G\251\270_\007D\236\226\264\177\370U5\273\343\021\372>Ri\253f\201\376\246g\303\335\241\362\230t\350q%\003#H\221\310I\003\210\003` \006\370\263zv\336\252C3\351pc!;/z\301\246\356\234g\336\232O\007\202\352\302\021\241\035\274\373\311\035\301\300\361=\312\371\274\231\270\235\305\354\342\260\373"
+	.ascii	"p-L\346\215p{\316\036\341\244\n\217\343j\344w\243\233a\204\273"
+	.ascii	"\346\004c\035\200\377\366\345\006\240\200\301r\n\302\001a\330"
+	.ascii	"t\331\033\022z8A\245\n?\325t\345\3620\240d\232\202g\t\235A\017"
+	.ascii	"\257<\326Rwc3b\256\024\300\261\352\363G\n\205\323\211^N\021\026"
+	.ascii	"\320e\354s:k\310\303\032\337\b\257\244\021*\005\234\350/\230"
+	.ascii	"\335\261\213\373 \003\261\224[\351P\243?\017g.\242\321Y\030S"
+	.ascii	"e\242\206\234\371\037\231\n\032\342\313\262kRe/\375m\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\002\005\355\021"
+	.string	"\226XP<@m\223\016\222a\0308]\025O\020\261\027SaQ\334,\243^\037\335S\275\371\305\177J\022&\302X1\202LMBgC7;\267\347\331.I\226\001Q,\306!H\220${\247\224\0025"
+	.string	";"
+	.string	">"
+	.string	"xK\336{/\335A\273\203w\363Q\217P\313\300g\r\334\232+~\177W\005\276\351&R7\021\267\315\206\325\331\355\306&\247\236~J\354\333Of\227j\206\026\"\021Q\b\206\302\332|\262\367\354\2125\032\210F\024b\n\303\352\211\330\256\005\3653\005k\n\336~\234{\003\337\326\023\320E\360\272X\001o\024\366\t\337\035Q\261{\340v\021\245\021\273+\002\236\334\324\215q\033xB%\nTMs\270{N\236\324\023\343Y=-\236\241\251z\022\200`\233Izf\017H  \200\247\233\331"
+	.string	",\265\327u]\257\377E\204Na\233\360\243\b\247\251UB\225:\226\313|,\347\021\261\341l<\256\343\303C\007\315GA\245\217\225\301X2,\031\226\007\0160\227K\206\363\301\3434\033\027B\343\241\351\360t<>\034\b\213\303B\004\fn\003\005\216\215\013\032.m,[\2639\233\305{o\004\344\272\234\226\334\003s\250aIS$\"\222$%\311\262\006`\002\221bF\365\021\220$g\f4H*\222(\205\302\306n"
+	.string	"\300\246K2\331Ui-^%\016\305\357\350\003\\ZE\202\265:\200\253V-\315\324&\202\201\tRq\034\351dl\356X!IR\231\340$g\"\216\250\215\rC\276\327\3179\0027\276JY5\202\240tT\343\331\f\267\255Q\264L\216\202\242(\274\301\250\301\214\326\0311\315G\367\034\276>\023\373\325\353F\366\b\240mz2\341Rv8\300\344\332Y'h\025\326\024\353\314\007\206\375M\032\273\006\246\004yWa/\354\211\225\212L\210\302\266\220*>\241\211\346\337\362dH_\247Q\301\016\332\333f3\3359\t\003A\213o\320\254#D\037"
+	.ascii	"\227\302u\324y\260\030\bLE,/\314\020\035\374\230\231\372\"Mr"
+	.ascii	"\036a\361\001/\020+I\332\020\031\030(QS\220\347\260\3407@\024"
+	.text
+	.section	.gnu.lto_.pureconst.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375 :\321\001"
+	.string	"6"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\230\004\005"
+	.ascii	"\232\004\006\232\005\b\232\004\t\232\004\n\232\004\013\231\004"
+	.ascii	"\f\231\004\r\232\004\016\231\004\017\232\004\020\232\004\023"
+	.ascii	"\231\004\024\030"
+	.text
+	.section	.gnu.lto_.ipa_modref.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\026\002-\n"
+	.string	"\202\215(+\200)I\0073 r\203"
+	.string	"0\360\t+B6\231\342\230\2204;\f \230\n\b\366\333\236\034\2535/\376\033B\266Yb\033\2212\00538<,,\336\371\233\037\313\212&;\203\202Q\001)\202\206\b\213\030\350\025h\035\177B9\302\020\f\350Dc\221\243@"
+	.string	"5\2656\247\376\264\215\033)\252\262\203]CH9\244\313B\251\035\364:\324\265n\252z\273%\314\240wl\355\024\233w\246\352\247\267\243\304\032\365/\\\234\254(\224\"N\371\243\244\372\251\240\337\221\022\345\272S\321\2343\345O\371|\2103\257WIO\250QI\350\2066)l\215\001p\002\2311;\017\0208\210j&\205\311\001or\244\215\233\341\227\372\013\340n\034\344\r\302\351\347S\200\332\022\230YK"
+	.ascii	"\317\311\207\256LYE}{\256\322\271\347\303\375\224\253\217e\250"
+	.ascii	"X\207\233\223\027x\341\212T+\002\264\177\364\252\304\330\364"
+	.ascii	"\362\034P\333\203\025\332\245\305\303z\370t\244 \225n\307:\343"
+	.ascii	"k 4d\341\020bV\226\361s\213j\364g\266#\234\005\0060\001M\222"
+	.ascii	"\355\363\330\343\273\025CG\263\344Z\314\254]\215\317'\233sf~"
+	.ascii	"P\312l\261f\207\006"
+	.text
+	.section	.gnu.lto_.lto.275a9e85f5f6f1f5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_tcpSetNonBlocking.24.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"\025\n"
+	.string	"F\323F?0\247*\035"
+	.string	"k\033m\350}\031\275R\325\320\033\247\007o\373"
+	.string	"\334\037\353\\X\002_\203\250\320\2158!\t>\220\352\321\210P0\2106D'.\341\252\373\371J\365J\215s\372Fldo\231R2"
+	.string	"1"
+	.string	"5"
+	.string	"\226o\233/T\276\311+T\2769\264\031\274\205\262\023\013P\006f\273;\343\311\303k\350\237\300/)\225\351\212@\261\273\326\224J\344\216\267\315`\373c?\023\276\334\335u\\\331g\375\362j\275\372\026\017\345\322(\330\r\251=\330\330\206"
+	.string	"\200\355cl\007\022\317\325\276\200\017\b\3172\314\227\335\222\003\257\335\345X\"'K\205\270&\304fR5Jo2{\303*\217\032\265@\002\327\310Ik\226\372p\316e\264;<\364\251\307MF\013"
+	.string	"\022M~\312\213\326`\325\201\3352i4q\356\270\216\213\020y\270\216\206\023\251C\035R\b\304\320"
+	.string	"\215\276\2564?\027\025\026\023\3542>\02089F\240\215\031\372J\263\323`\217\324}\023\364\274obZ{\271qe\216\214&\373\210\001\r"
+	.ascii	"E\223\241\214i\nj\030\316RCs@\341\024\247\rK\025\306\247\002"
+	.ascii	"\f\227\001\277\325\224q\207\027\355$\003"
+	.text
+	.section	.gnu.lto_tcpListen.25.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\020\b}2"
+	.string	"\032]<\024F`\246Q:\223\024\026\267\213\360\266 \345%4\243\030\362\365\252_\360EQ\037\233:7+\232\300\370\203\360\310\366\304x\320\234\366segk\003\263\253\212x\323I\215\005\242:\375LC\274\020\302\313\2364B\310\336I\006(\001\034\0016\001K\257\036LB\226bm\331\230\223p\367\373d\216\246;\327\303\233\365\317(\341P\032\021\3139\347\332\352f`\240\331+\243YL2\261\244\247\2742>|\217\326/\363\263\341\315\300\270\313\314\203\312\214\331\243\355i\247X\237\032\335\223\031v\347\236\276\333\252\317|Y\347\026"
+	.string	"\362u\223\025\321L\226\321%\200\332N\254OyX\276\213\371\030\253\217\305\330i-\263\017*.7bm9\363Hz\332#\326\247\317F\013\362\370\360\362_\254\016\246\233\215\313Y\211\23339\347\245\376\260>\335\241\013\322|\367v_\354]\254\256\244\361"
+	.ascii	"93);\223\363r\251!\254O{y\002\352\323\365\003\324\247\335\335"
+	.ascii	"L>\253n\277\364\3321\301\2715\246-\347%\213\233\274\375zSS\024"
+	.ascii	"\337\266o\374\332$d\220\230SI\017\256\337p\0373K\354\230%}\\"
+	.ascii	"\335\312%\2177EY\036d\276\210\2225P#>V\320"
+	.string	"\034/z,\256c\224\267Uh\nQR\0135\320fL\363\262\337\033\311\254{o\027r\316}\221\311\036o\334\273[Gw\253u\337t\004N\266{\fjw\353\345L\f:5$\265?D\022\334\365\rGMz?-\330G\366\345|\216\206\276\331\231\033\210\220\275\2479xP\271T \005.\306\335!D\354\264\260\261\343t\363\252\035\300\030\247\274c>\220.z\023\352\315^v\002k1\022%g\255#\277\346JG\221\342\036\331h\346\302\306\276c\3114\245\"\265?\377Z\273^^\330\326P\334uldj9\303\270\253\223~\f\025&\216\326\r\324\377Z\036w\253x\233n\2569\347\246>\233\017N\330+\347\374(4\316\220lX\367\331E7\351J\277\357\246\332\035\005\274G\036\237@r\304\306~\331\323/*N\266|\005u/\263.\356\352>~>\237\317\306L\272q\267\227\016\346\347]\371\027\350\333G\370\366"
+	.string	"|["
+	.string	"\356v"
+	.string	"|\333Hw\273\b\337&\302\335\006\220\273\255\303\267sC\267\207\360m\034\276\275\342\3337|[\305\267S\334m\024\337\306\370\366{.\214}\322\002a;\313\274\3439(\313I\323|}\354'\353)4s\005W\204.\347x\344\325s=\236\007\203\247E\3066k\353\346kd\321\217\322m\215v\353\036\331n\251O\2130\216\013"
+	.string	"&\302\2720\205"
+	.ascii	"`]\205\233\273\321\346\270G\352\360\005\271\350\346\332\3575"
+	.ascii	"\352\323\034\326\205\251Cf\310\204\333\335&[\037\352\221CX\202"
+	.ascii	"\026'\225,ll\335XX\332\237lA\351\242\342\260N\351\273J_\203\264"
+	.ascii	"B\356\2218\274\253\001\250\233?\363zs\305?s\242\304\272\317\377"
+	.ascii	"\r\024:^\322\033\3235Js\265H{\344\036y\303\273\243\237n\352\324"
+	.ascii	"\212\324T\254\273\243dn`\273\333$W\323.\351\246\237!\201\204"
+	.ascii	"e'\333\022\356n\273\316l\233\020\b\203\366\227\035G\005\254\315"
+	.ascii	"\271\226tS\334G\323Bi\245\250G.a\037\022-4\007A$\355\3145\374"
+	.ascii	"\320\321\345'\037\355}\001\305)FZR\207Y\250\333\257\357i\301"
+	.ascii	"P|+F\244(\217\300\326\326\234\237o\020v<\355\025\002^\335f9\263"
+	.ascii	"\335\362\024AV\0353\266\276\235_\017\230\232s\355\326\226\263"
+	.ascii	"\361\r\324\356\266\342\205\371\024\334\333i\271"
+	.string	"\334L\333\005]\346$\325\235\035\326\025\324G`r\002=T\344Qx\320s\320s\320\223\300\364\200e)PE\021Y\b\203?^\211\021\030L\260=4\344\355(\024y;b\325\024\325N8\265\023\002\211\303\240\324n\212\270\003JA=\t\213;\025)\032t\213\036\325S\214!\2208\003\212\035\022\203PlQ\310bIFQ\030\224Z\212\320\344\3244A\006\013\374\025\245\242\204A\266jXd{2\206PNN)P8\205\253~\277'T\006\360'\f\246\r\374\001\177L+\232~=\244\341;\252G\025Et\222z\nV\001\207\354\207\022\034H\260D \213\252'\"+\f>\275`\243\252\206loAOQ\001\253X\342\324T\025\233[b\035\315\230I\253t\2160\321n\177\253\276\354\250\222\020\023\r\367[\365\b\337\350\356#\334\027\260pV\307\030+\2429+\261p\262\177\r\314}\2429\347\274\3361/i\035\256"
+	.string	"<@\307\325\036\"/>\353\361[\030\\\365\271\362\243t\036\036\200\1774\222u\237\035"
+	.string	"\013\300K[\367F"
+	.string	"\374\263;J9N\266.\244\205Y\345\246\033\333\322\273\215n\256"
+	.ascii	"\220\324\376\250X\3224\\#\334}\005\350\312y\217GF\030\247\374"
+	.ascii	"\205!\311pu\230\b\337\354j\005\200\216\250Q %\025c\310\210\211"
+	.ascii	"\310\004)h\222tP\"!\305\316<\021\2401ev\206=\003,h\212\206d\225"
+	.ascii	"B4\005T\232\371<\372\213`N\220X\326\320Ux|\315\307\327\253\005"
+	.ascii	" B\372\247\013T.s\007\243u\325`\254\310\271iz\241u\376\204\006"
+	.ascii	"B\360\"\274\330OI05\343\330\b^\003\013\221`Z\255\251PY\253\317"
+	.ascii	"\352\313\025\202]\225\253\300/Op\202%\003\230X\225\234{\334\022"
+	.ascii	"\334\300m\245\025\366\f.\031\005\331i\305\275\252*v \276\276"
+	.ascii	"\352\243\272\233\250\353)\310\030y\370C&\223\222!5\332Au\213"
+	.ascii	"\024\227\b4\214I\321\027\377L$\\\333u\204\370\245#Op!K\254\336"
+	.ascii	"\035 \351M:t\210\303!\0069\f\201F\261\243\276\201j9\304\037\237"
+	.ascii	"\n\304>\244\277\202:7>\022\215\275\002\"!\206D\223\217cM\250"
+	.ascii	"t}\344t \245\211\342D\234+V\020\001:\022\013\031{\242\330?wj"
+	.ascii	"$\205\013=\310\177\300\\\363\221\240#D]\200\rh\342\220\376x\021"
+	.ascii	"\013\214\240\321\254?%\276\200\356\220NP\340\020\026\275F6\005"
+	.ascii	"d\256\315N\334\262\241\300\243\210\030\376"
+	.text
+	.section	.gnu.lto_tcpFlush.26.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\252\0055#"
+	.string	"v=\332K\200\030R:\203\031\030Z\007yy\302P\f\203R|V\350\215\232\347\307)\201t\034\256^O\212\353\200f\371\265(ms\273\226Q+\243~\243]<\316\377s\030\034M\255%\374*\237{\002n&\2531\370-\211%\204\020\262w\222\001\300"
+	.string	"\300"
+	.string	"\303"
+	.ascii	"9\347\n\352\317\367\263\202l\316\305N\367\261\220D\317D\245\232"
+	.ascii	"\021\013\016\262\234\221\t~\366\204\316%\355\374~H\337\352W\301"
+	.ascii	"\037\213^\223\263\224VW\316H\005\335@\375\331\310\017@\177\252"
+	.ascii	"\027\200\376\354`\267\227#k\3444\312FQy\226s\326a\032\315\336"
+	.ascii	"\340m\354ZSS\3644\361\r\366\215n\013Sr\302:\272\354\f&\030_/"
+	.ascii	"tz\355aJM\007t(\275\270\352\201\024\212\311\305\321v\251h\346"
+	.ascii	"\344\234\331%\342=\323( ePLN7M\bNX$\265K)\314{cK\331\267~\221"
+	.ascii	"\226\206\027\037\353f\217\2461\2531PL0~\323\236\234s_\343\022"
+	.ascii	"\323\373\366\356\376\352\356^\367\351!j\316\231G\211O\257\037"
+	.ascii	"\254\250\212a\205\343g\277(D\023}hfmE\261Z\240\341Ix\321\372"
+	.ascii	"X_\227R\302\362E\353F\032]<\325}\236\026Rl4\226\352~\362\215"
+	.ascii	"co\343\260\267o\320\3336?\3765\354m\032\364v"
+	.string	"\213\336\276\241\267m\353mv\275\275\242\267k\353mu\275\235\252\267\321\332\355S\275m\246\2671z\373\236\267_\300A>+#p%\347\2443e2\330\311$\307\223\177\367sQ;\347zV\237\310\215\374\310\267\232\315Im!\021\262\313qD\353D\316\020@\036FYU\371\250?sA\214\364\225_\006_\344\204j\244\244&9\272\312\240\376\3141sJ\"I\024HX\216d\001\3679\277\275P\214Q|\334\215A\303\275\021\207\213\236\212\330\250Olb\024\247`\210;n\370\334\360)>\023_\271\345H\2031\306`\212i\266\245\031\032\374\"\246z\361\rN\305\272\233\303\243\\|\345Mo\270\3058\370\304\252\243{\346\357\302\025%\004\305S\335\342\033\306f\266%\332\r_\313\266\034\323\342#y\t1_M\3130'\236\372\301\303\nn\261\rF\352n\227_lpw\207?\001\362\362\341\331\214\021)\215f\355\262,"
+	.ascii	"\221\213\320\304S\t~\374KR\031^2\335\375\341M\332K=\246\241:"
+	.ascii	"\n\357\231\376\326\257bY\005w\221Qu\206\373.\277\3022\327\217"
+	.ascii	"|N\326\227\020\r\0303v\357\336\305\013?\273\236\bs\004\320\016"
+	.ascii	"h\002\203L\370x'0\2507d\002\177>!\263{?\275\037\006 x~tn\206"
+	.ascii	"\336<\035!\036\360\303\210\035\320\2577\244\233p!\202\005\035"
+	.ascii	"\260\027\342\267\003\352\202\200v$t\274\337\220N'\327>\241\336"
+	.ascii	"O\007\364\371~:\026\231\337#\304G\266\247%\271H\270\226\026#"
+	.ascii	"\240:f\271a\233Z\031\036]f\266\205\265cF3\026\3330\026+\246\255"
+	.ascii	"X\305,>\305\210Ljx\305/\246\t\301\200jx\207\n\207S\254\342\023"
+	.ascii	"c\244\330\024+\246\251Y\200\200i\215\315\200\262\342n\r\356\246"
+	.ascii	"P\341\336\330\307z\317\020\033u\215\216\247\247\032\236\352\233"
+	.ascii	"\336`\003GWE%(\016\246\301HG\201\342\360\357\307\007\331\030"
+	.ascii	"\263|\321\032\207\237|\316Mu\250a(\345\230\202\206f\002\021\021"
+	.ascii	"m\n\212\031\003p\002\031\251\263n\021PE\204T\233\235\0034o\215"
+	.ascii	"\035G\343\273R\2771\275HB6Cn\370\221\246R\350\206\003\222\343"
+	.ascii	"b\310\007\202\3425+\314\272\207\016!:4*BK\035\222^\205w.\364"
+	.ascii	"\275d:\313GUq;\261\323\2666?/N-\322)Kq\034\300\267\375#]\276"
+	.ascii	"\204`\037\250\3419YH\234\026\242\340\030\fjS\342\200\027\200"
+	.ascii	"\277\376u\2057\247\254x\245\330\340\260W\277D#\304\354B\024\017"
+	.ascii	"\250Q\237\322\301\367\005c\035A\274\207\371\201\"\332{\203\365"
+	.ascii	"\2404\277#\323\3059\353`\003h\273^\325\240\213\365\f\326\312"
+	.ascii	"Z\033m\0245>\230\002\203\336\360\022\206\303\240\361B\004>B\n"
+	.ascii	"\223\0276b\243\t\271\251H\227B\2273\243\321l\217\354\373\350"
+	.ascii	"\373\202qR\013U\244\022\004o\224up\002\006\207\315O7\301\274"
+	.ascii	"\367\007"
+	.text
+	.section	.gnu.lto_tcpPoll.27.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\354\n\265;"
+	.string	"\ng\270\026CPdR\007+\3775\233Y\215\215\2611\211\245\370\247;\241\307\325\325\224\325f\346A\350\352\360\255\332\006\n\nC'\340\263\021\216\2018\004\300U\210\241\243\no\220Yw\352\240\244\243\264\266$m\357\235dJ\001^\001D\001V\001W\304\270\334\353s5\200\271\315BZ\016j\316M\0229\203i\340o\016\367z\234\r\240\262\t$\0236F\315\031\372\001\350\254qu\252k\320\r\275\261f3h.\003\241\246\327%\312\331\326\320Nf\r\034w{\027\367\362\272\033\0167\312Y\311\334]\316\320\251f"
+	.ascii	"t\266\241\256\324:\013t\244\326\331~\273\3718T-\377\222\260\021"
+	.ascii	"\0133(\347||&\r\314\276B\275\217\360\353JIHGFEE\"\321P\350\006"
+	.ascii	"\201\277\226]\037\277\355JWJr;7\200V\006\305\221\326_\030\217"
+	.ascii	"(.m:Y\035\364Q\243~\346\211\217\226\2245q#\003E?\thek^\\\221"
+	.ascii	"\316\352\356\270\264\251\266J\335\241\"\304\317\030\301\3046"
+	.ascii	"\355\314\017Z\331\023'2\346\234\207\356\325\304\205.m\016\361"
+	.ascii	")M\"\330]\031\204\r\"\342\322\246\220u\330'V\307\2474\213\340"
+	.ascii	"\340Z@\211"
+	.string	"\021>\2276\317Vc\0339b\016\\\217M2l.m\232\255E}\252\340\375\\g\020o\2018\273Bi\351KCt.\327&1aM\374\3161\2313\f\257k\323\323\215\017\242Sl\205\232\223D\217\320\t\206\177\205\022;\024\205\350\374Z\233\006)\243n\347\006\2464\237`\374\223\220sn\314t\226y/y\267\217u\267\213\356\240\236_\274s\327!\227\347\244\373\323g\365\255\026\352S\300\305I\362\322\204z\257s\243\027&\324L\270\235C\353h\334\277\273\303\007\354L\2507._\331\355#\332\356\020\2367\242\253\226\324\376`9<\251\007\222S7\367\237\326Q\356\237\002\316\r\030\356\353\356\022\256\246\363\2009\347\252\3664\357\026\023\300'\316\266\343h\235\365'Zs\363\302\325v;\367\300\005\312\267\2271\241n\250\022\177Z\267\177\023\035y\226\375J\272\251\034\352}\3648\357))(ws?\340Q\357&\027w"
+	.ascii	"\0277\223\213\033\200\213{\211\210[\251\210;\251\b7\222\213\373"
+	.ascii	"\250\210\333(\210\273\210\210\273H\204\233\030\304M\024\304="
+	.ascii	"\034\342\026\nq\273.\356\240\213\033\350\342\376\271\270[\027"
+	.ascii	"7\353\342^\203\270?\210\033\007q\273\203\017m\203\374\020\210"
+	.ascii	"\2233\217j\241,\207\215\262y\324\335\214;\324=\316}\316\275\316"
+	.ascii	"\273\265\324\312D(s\324\257\333\235\364\316\264\320i\032\235"
+	.ascii	"\341amM\0135\r\332\313\264\337\265\320\311\215\031\020\317f\026"
+	.ascii	"\320Y\354`<\214\217q2n\327B'$u[F0hvBxB\257\234\320uy^6\203L:"
+	.ascii	"\325\023@g\235\002+:\257\275\321\264\316\016\237}C&d\001\356"
+	.ascii	"~\213\274FZg\n\337\355<j\216\257\355\353\225\230@\030\236\257"
+	.ascii	"\341\320\373\274W\267}F+\365d\355@\255\217\217\360\323\370\374"
+	.ascii	"\370\356\346b\362\364\241\2727\332c\021i~\207:\216#G\034\345"
+	.ascii	"\356{\031\037\363&\241R\373\264\227\tv\346\361\215b\257\354\251"
+	.ascii	"w\377\001\211\035\242\033\322k\364\370\336\2026\332\251O\001"
+	.ascii	"7\305t?\246\336\343\330\017\376\324c;\313h\261Z\255V\375ek\201"
+	.ascii	"\037|\001v\277o\037\370Lv\226m_k\376\347\367n\267\306\376\372"
+	.ascii	"\355\263\206\226\317/'\276\307~\325\024\212S_\266>\357\226\227"
+	.ascii	"J\327?\255\271\271e\322L\347\224f<\356tn\3642\276\247KI\217\331"
+	.ascii	"\375Jq=/\025g\373\001\217B\317.V\272\313\301\326\267\2725\nB"
+	.ascii	"\034\301rU+l\366\b\001\177\372\256\234\240\337\326\2323Z\004"
+	.ascii	"7\343N}\303\325\206\372;Dj"
+	.string	"KS\263\037\365\t\277Z^.q\f\340\325\337/\255\343\371\335\204W\362|\2223\2303\245\274\365\316k\241\276\233B\005\354\314^\263\331+{(\367F*\245\2447\224k\323\016\300\370\273/d\300\316l#\330+\233(\247\346\201\2249q,\376$\\\234\r\016\007\007,\034\031C\353\261\2620WRK\306\232\325\225\342\221\310d\326\212\205\244\301\002y\205L\002\033\211\205\304Z\220U\205\225`i\313\373*\201\214+.\024/\254X$\221[G\r\036.t8r!U$\255\270\2161XX\3018^%\267\216\t\236ZK\0062y\344\322\322J\036\205\320<\346\022\274\376kL)\300\216?O/\216\375\320\241\236%\325\230s\267s#\352\033\2566\025\351\323\242\230FT\337\253P\352\233\236\354\370MO\301\r\030\356[\005\2415\275\004/L\310\335\327\234s>\242z\217\272\321\313g\264MO\365\276|J1\261`\243"
+	.string	"\377#Io\r\303\334cz"
+	.string	"\037\340\177o\226Q'\270\007\323{\334\322\003\370\026\320\362\371\325|\331\036\301\324\rO\351\033\357"
+	.string	"\361\362 \240\2273\022\253\326\3316\fs\357M\351\253\246Q\2447\372\244\3777\313*G\217\364.v\310k\r\223\035\375\323\232\023\217Y\031\271n\236\203\315\216\265\242*\\\364M\374\342\027\275\357\021;\344\205\253\030|\314\373\303A\361\237\246Q\"\035\027\354V(\320\264\370\236\265\304O\302\005\301a\357\031\361\223\246g\034C\026\251\234\232\2602\342\220\216J\002\377\322\373\3236"
+	.string	"\023\341\334yC\275$\242\017\272a\341Q\371\366\214_\016\241!\372\264\026\016\177I\271G\007\217\033\n\200\330\250a &\031TFfFD$)H\222\016p\002\021)\263\362\021@\271DU3\322\202R:4\270\027\254ER\036v\265;\242\357\234\227o\344\302\265\374\362\225\005\235=\t\037\177\323)\350\223\2317\3440\316\327}\021K\177Z\262\035\362\310\223\271\026\376+\365\355\320\215\254\251rf\031K\001\371?\034\003\004^2e^P\212\b\355\367*\306(\263L\205\262E\240_\217<\243\243@D\333\245uN\212\367\240!\017\205\203\033\026$\216t\261; 5S\256\270/\352d\025\254pN\335Dvd4\301\f\f\370q{?\226\250\224)\343\304\215$3\206IOZD@\316eyf\t#\214\302"
+	.ascii	"\364\007\\C\264\234\351\024g\355\267\031s7,f\032\023:\020\020"
+	.ascii	"\244\260\200\346\274\253\0368\234R\206\216\350)\336\316\bw)\353"
+	.ascii	"\261\005\304a\340\365\200\\n\201\350\b\210t\206d\364O\037\364"
+	.ascii	"\035\301\200\221D\023\f\245^\264\345\204\331#\201\236+ICF\304"
+	.ascii	"5t,x\006\202?\353\034\033\332\303\027K\272\027\005\201\030]\227"
+	.ascii	"\220w(.f\336>\030\\\3660R|z-\247<S\357\321X\246\305\360\263~"
+	.ascii	"\313\341\312\210\236\3751\267,\022\367\320\340\243\304\371\210"
+	.ascii	"\237hm)\247t!\b\233Xz\365\030!5\024\362s@\036\r\217H\341\214"
+	.ascii	"q\325\330\352\265\333fyH\343\372k\312\271\30182\301R\325x\237"
+	.ascii	"O\364\3010S\02026b\240\233\262\342[`P\021CW\227h\352<\240\346"
+	.ascii	"*\205\350\345\376\035\004\034\352\205\031P\200\326\352N\3444"
+	.ascii	"\354n`9\003\027\363\201eW\243SL:9P\356\377\245\327io\r\224\325"
+	.text
+	.section	.gnu.lto_tcpTotalRxBytesWaiting.28.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`I\001\315\r"
+	.string	"v\032_D\020q\224\016L%(\367\321\0266\007JJ\214\200\300\343\204\r\220\206\334s\300\030"
+	.string	"\330\006\274\373\267V\277\323\2476$\330\253\033t\262]u\264TH\242\002\024X\031\3512\250%\236v\0268\031\261do)S\nI"
+	.string	"H"
+	.string	"L"
+	.string	"\377N\036`\027\205G\213\335o\201\033d\217\3762\333\376\211\243 \271\004\277\020,-\245\204\006\0250\273\337\266\371"
+	.string	"\354\021^"
+	.string	"\366\250 ^z\226\374\267\376\340\305\b\027+\226\351\231q\260\273\316\025\253\303\255\267\215\300\366\210\375V\376L\251)\366\341*\212\355\264\366\357\307`:\3024\204i\205\351\204\351k4\0352\022\354\330\335\360\342\2611\242\213\212m\222\337\262\306@*\304f\301\360Uq"
+	.string	"\260\312\240bc\367S\360h\221\254"
+	.string	"LH\246\375\225\247 \005\036\270\263\200\372\226\227\324\253*\244\2412\201\"\271+u\023a\203\276\242B\266\233\002\361[\272\222\214\304\243\177\202=^?^VN\371\262\226C\244\341\310$\246\266w!\277\362&\245&\247\353\006\246g\271\204\017\247\214q\272`\314\330\214q\336\315}\270\017\003\n \037\316\007\347\tuF^\b\224\331\3031\361\214&X\350\200:\316\333\"\214@\020\331F\034I\327\031m!P\247d\363t\336\3069`\221\t\327m#\221\250\3334\337\336\232nN\2122\324\250\232\022\350\241rA\345\313PU\243fj\250\002\027"
+	.ascii	"\253\223\241L\2130\f\004\353\0220\270\251\362Iu\023\264\216\250"
+	.ascii	"\314\225\336\202\263,\003sw.\306\26316Es\r\247\253\005T\231\340"
+	.ascii	"!E,Q\305\203\273F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_tcpTotalTxBytesFree.29.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\036\002\205\022"
+	.string	"\306\243~I\340\320(\035p\212\np\220E\337\350"
+	.string	"C\200\221\352\356\261\003!\241\254_\304\222\347\f\335+\227\001\202M\333\377\367\022\234\260Z7\273J\275\365\001\371n\235\362`\032\034\203(q\206h:\2473 \253\254\326'\215l\"eJ\001h"
+	.string	"d"
+	.string	"j"
+	.string	"\3379\017\314\307\227\017\230\263F\207\320\234\243\0023\b/=\206\266\375\023G\001\343\3317\336\350"
+	.string	"\330\244\320\300\3131\347(\252\356\001^~'"
+	.ascii	"^\356\210\317\376\255\316\374\022\311\234\363\274K\02395r:\332"
+	.ascii	"?\017\337/\301\321\320\215\223\356\366y\310\220\310\235w\335"
+	.ascii	"\240\263\251\226H\346\234\326\234\216\303-o\373\201m\n\266\276"
+	.ascii	"\002+z4\246&\331#M\327\306\3767\267\306\266:\365\335\215\372"
+	.ascii	"\370\233@u\tT\203\240Z\202\352\017T/\250V\251~\200S\210\031 "
+	.ascii	"8\346\224\351\355\2302$Q\211\357~\033\306\3579\317\247\017\027"
+	.ascii	"#\266O\313'n\306\224\213\341\231\020^~\300\030\371\316%\244\315"
+	.ascii	"\204@1@Gs\216 \227.\t?~FT\355\006\212p4\253\017\311\375\013\234"
+	.ascii	"]\335o\301\0308"
+	.string	"\035\033\353-v\033\030\331\256\007\271\204s\336D|\026(&/\340\245.\002\234\017\337IMkcH\321\347\254\272-\315(\240\016\277A:\022Z\026\360k\241\307\306M\221l\277\256\202%\234s\212\370?(\031\302\234K\277\005\274\374\246\214vj\332\263\002\351L{\237G\020Q\323$k\261\267\\1\226\317\256\226\253\265\340\202H+\244\200\213\245\262\222\305TNB\263BVX\262\n(\253\023\230+&B\220\340\240D\224\271L`+\231\250r\262J\021Y\260\230\030r\300\257\025\027L\224\275^0\3614\316\177skR\253\252\255\315\002z\275^\3573\260\264\251=\216\006\265rK+\203p:6\020\250\375\356\252\232&Y.\270\250\325\"\034\221M{\226\033\" p\"\231U<\253\301P2\255\223a\022[\213\233\263\261<\022\\\r\317\301M\371\244onN:\332\f\217P\212\345\31583\266X\n\013\202\241j<"
+	.ascii	"-\235\353\263\306\030n\315\"\023/f\247\034\366+\020TL\fh\261"
+	.ascii	"\304\304\277\013P\355L\321\340\036"
+	.text
+	.section	.gnu.lto_tcpIsTransmitBufferEmpty.30.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"\r\f"
+	.string	"v\227UC \217\223\016@\254FB\3317"
+	.string	";Q\t<\201\315\003\323DK^\215\b\"4\326\005\241\217\330Z\357\273\220\021\214\250\377\242?\222@\b\211Z!P03I\256\r\232\036\n\346\203hL%\204l\"eJ\001@"
+	.string	"B"
+	.string	"A"
+	.string	"2R\354\306\016\037\260\376\034?\200\372\263.\200\372\263m\017\004 \207\036;\244T'(P\\b\354F\250\034\036z\206\374\267\374a`aAR\021=\253\004\273\353$\251\\\270\365\266\013\330\016\261\277\t\273\326\025\333i\352\245_\247tN\351W\027\t\027\035/\273)33\266\305\213\001a\033\344\267\370\342`\001\261#\205o\005\013"
+	.string	"H'*`\354F\003\177\336X\034\032@2\355\227\270\t\320K$\017\260\273\022\235\277\244B\033\302]D\254]\223\017\377\304\204\217\365\341\317'\241\376\256\032\036J\243\234\3615\242JU\233\223\220'y\303DEN\030\021\252\217g\220a\2242N\230\020/6e\354(J\335`\177\332\r\334\255q4\216\207\203\017\216FC\313<X\307y:\2263\315H\3265\210\200u6\215\203\013B\024l`\247=\330\260\016z:\230\b\3146\016j\b\3703\242m\260\373|6x\305\275)\335\030i\211S\257\224N+PbJ\002\017"
+	.ascii	"\253\223\241L\2130\254\313\234\005\255#*\271J\0070Xq\361\274"
+	.ascii	"\313f\023\344\302\3151vB\212.\023UD\3235\237"
+	.text
+	.section	.gnu.lto_tcpRead.31.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`j\001\355\016"
+	.string	"\266\034gF\360\262&\035\"\331?\354:m\255b\273\nh)V\263c\252\212M\354\177\212\370e\032|\243\337\307V\031\346\370EW\216v\r\254\026\332\203AQ(F\013II\013ZN\213 t\213 {\212k\214\020\262\211\224)\005Q"
+	.string	"M"
+	.string	"S"
+	.string	"\335\001 &\231\366O\034\205\3537-\037\260K\003#\306n\024yAw\350\370\002\333aw\002\333\241m\217\220\270\374z\254\211\001e\260\361\302\342\307n\364\024\304_\317\227\177\234k&D\324\200\221qyr\rv\327\t#\263\341\326\333N`;\202}\035\001\251##\307f\020;\272\244~\260\257\355\356Zi\354\307\033\364\233\037"
+	.string	"Ls0\275\3014\324\322\332\226V\230N-\375"
+	.string	"!\0328D\263\335\230\231\220\275\001wF<\376\266\313\307q\b\201\314\344\021C\267$8\027>?<v\243\202C\237\004\327\331\3649?jK\205\272\371\220u\210\315"
+	.string	"\351\343%\314\300\336\342\302IT\263\353\3416>\313v\b\322\354\321\300!E\316\254z\325\024\362\310J\304T\365/CR\236\203J%\331a\253\276\202\245\333\335\022_\205\212\205\316\346\320o\331\016\257\"!n`9s\025J\351\317\364\231F(\224\230F\006\276R\212\324b\245N\235K\243\225Rk\202\n\351\264\372X\336\003\b\016N\274\326\207\262\"\265\274\324\211\204\362J+\2267\022\261j\345[y-\225j\345\205\342\336\006)\203\031\230\306\234:<\234\332)\177\201\022\360\243>0=6\205\312)\327#\333\211\241\004\030"
+	.ascii	"\253\223\241L\2130l\312\306w\343\362\246\3318\252$S\231\207v"
+	.ascii	"\364\221\b>\314\303\261\211u4\302\226XaA\200e\242\234T\332+\270"
+	.ascii	"Y\316\270\320d\314JN\310\313De\321\324\316'"
+	.text
+	.section	.gnu.lto_tcpReadBuf.32.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\346\003\265\033"
+	.string	"\266\265\267J\260\226Q:e\345\024\027\273\001\207\"\\\265\235\201\274\377D\303 \215\365\273\227\"\212,S\\p\200\252\024\342\021\327\333a\312A\037\364\372\324'x\235\342\237\363\245o\306:\342\241\2765\341!f\\f\373\253?\"\204\220-wJ\001\244"
+	.string	"\223"
+	.string	"\241"
+	.string	"A\n\253?)v<j\2553\276\200C6\225<PQ(/\306\314\220}\332O\272\r\335{;\007P\253Q\023\217Z{3VP^t\257<\215\327\320\331A\332[\301#\201\244\204|T\265\326X\201\017\030/\322\013\030/\256\n\223\303\341px\332\273\307\251;9\212t\247\316\367\235\312@:\262\343\361\234\244$\020\221\013\027O\2106\020N9\235\th\216/F\\<\323\017 \375v\274\021\247+\236\210/=0\325\303\211\213\367C\007\020\271\330\335\3679\304\363\231\223\204Pk\365\334\361B\334\345m\223\260]c/TMBU=s\350\325dY\273\303m~\367\335)\372Y\036O\340\023T\235Q\354\036\317\334#\373\rV\b\247\274F6\314\225\376\227\235v\371\322\337\362\336\317\262\323\260\377\356\027\235v\321\351\025:\335\242\323,rz5\247U\306\351R\234&\307\351\221N\213\3424\245\323\273\323\223N\237"
+	.ascii	"Kh\204\346I\255DC)\265\210\350\204\364\337o?\206\210\314\307"
+	.ascii	"\3413\231\025\363$\263\177\016\226< \312\237\217j\252\326*s\321"
+	.ascii	"\031\312\213\267u6\313\216q\222\355\374\222\003\256\250Z\253"
+	.ascii	"\207\361\342l\332-y\017\234YY\353\211\267\360u\306\213\253\245"
+	.ascii	"RC%\224\346\320\345\276\254\312\376\265"
+	.string	"\345^J\250j\\\272\344R\251 \030>shq\307\275P\025\355;j\342\306X\330\033\336\244S\326Z\027\370:,\330\312\026\027\375\235\361\"]\002H\222z\346\360\037\200Lv\177?\200x\342\036y\316\226\275\357\377\0205\244j]\026\266C\266\314\377\373\003\237\3514\006\212\tT\002\333/\235AQ\317\214B\351\256\313\276\004w\307\340\003\344\020\326\330=r\313\316m%\2711\344g\n\375\235\273\001\266\347ntn4q\226\233\331P\327lj6\t4,\260\241i\251\321nf\271\234\033[i\032\r\016-W\303af\303\325rb\023*H\240\020\313\3256\340f\271\330\215m\326!F\303\345\304h\f\370\206S\303\305r\267\033.\306\352\325\257\221\203\242\236\365\361}_\001\241\220{d\225\022\"\314n\022*\363\327\016\301\366\265\021\204\374L\341\023\212\227!\364\314(\247\265\326:\302\354\177/\200\340\257\205\331\007\2310"
+	.ascii	"T\342\332 5\226(\352\333-Y\331\326\272\226\234\022\344\204\341"
+	.ascii	"@V\366:^\033Y\333Z2\030d\302'\310\332\031$I-`\023\250\325\372"
+	.ascii	">8\324\004? P\0021HUu\253a\030\033.\2671\005K\341\344-\020\211"
+	.ascii	"\263\373!'c\035\203z5\b\277\r\033\271r\213\345\036\221f\267\320"
+	.ascii	".\330-*39\213\f\2436\221\366s>\273\025\247\336\032\304n\2218"
+	.ascii	"\301\003\355\276~\370\376\300\f\204\344\244\312^\265\270ko\251"
+	.ascii	"\227\275\323\333\007`\315\266\306_\341t\304\"\027\374Oz33\266"
+	.ascii	"\321\306z\355\225T\376\t\221\217\344]\233\313v\264\320e\025\035"
+	.ascii	"\362I\242\001\331Z\017\273\233\353\246\335\214\202\373\242<\237"
+	.ascii	"\257\321\036("
+	.text
+	.section	.gnu.lto_tcpWrite.33.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375``\003e\027"
+	.string	"\006k\230G\300\026U:\024\336\267lW\214\340\002\tY\226F\243\266\274\347\374\025P\306X\263\022K\301U\304F\bJ\377\217\251\304\326\037\224O{c60\003kDS\271a\350\204\220\345e\272\307\251\316\027P\025\225\264M\210\224)\005\203"
+	.string	"z"
+	.string	"\203"
+	.string	"s\372$Q\030/\326\004[W\373D^\344\366_\212\317\314\371\263\304\311\234@\005^0^4\3604\362\342\370"
+	.string	"\362\242ov\322\201;f\t(\270#\0023\347d\255\216\337.\305p\365\346\237z\270\313\030\027C\004^\236|A\365t!MO\017\236\252\247B\303\020'I\317(\025\224\364\003\325\323\351\206\013T\200\261\241\352\361\204"
+	.ascii	"\302\354\262\274\350\312\242\267\243Z\2020\347\264\362z.\356"
+	.ascii	"\322m\313lo\260\267'/\372\311\350\005\226\251bl N\027\310~8\367"
+	.ascii	"\307>\360\237\371\320\275\372\357O\231\324\247\222\3324\252G"
+	.ascii	"\251.\225\324R\252E\251\016\245z\245Z\245\3724*\"W\036\024\315"
+	.ascii	"\331\023\0343\255\210G>>\364\333?\321\213\214\262\201\321\262"
+	.ascii	"\217\224\370\324\2650\361v+4\214\027m|Z7r\241\333\207L\214\270"
+	.ascii	"\026\243\222\035\317\313\234\300\004\027}!\264a\321Z\265q"
+	.string	"\032\334\016D\341\r\271(\262\322\032\360\375r\032\016\205\204\\\025\022\220\355\222C\310\230P\\\332\221\270\005\220T5f4\2656\007\227\236\347\032\236\305\031\200\021\roq\362\273\261\013\344\325\206\333A\b\211G\303\330~\275I\270\004\220d\254\366C\257\331\325]\255j\321\035\305\316d\367D\277L~ue\025\235\317\216\006m\177x\022\231\003\037\t,\3048\347<\217\213~\ny\361{\300\367\313i\320j\004#\265?\362\t7r*\306\001\265\333N\304f!\210\227:\006\213\301p<8\200\335\b\210\275f.[m&\033\375\272\031\361\262q\020\341\222\321b5\226\204\n\021(\260l\261\0174\227\2155\223\271rX/Z\215uc\300:#b4\226MG\207\306B\001\347\303\271?\206\220\333\0359\3448\262\210\t\022\237#O\333A\250\213\205W\311\241\002\303PB^<mJ\310\024\025\227\002\276\031A\353K\021\221a"
+	.ascii	"\2279q\234\207OB^d\340\263aD\203\036W\256i\225\214.Hi\307\375"
+	.ascii	"\256L9 \200\002\221)\244\033\253\306P\214i\027\331\b`\243(\201"
+	.ascii	"[\263!\275\323\252\302\200\226Om\020\3620v\333\3115\221\241\275"
+	.ascii	"\2253\330[\236@\214\313\"\363\210\026xN3L\366\202\261\226 {\362"
+	.ascii	"0\337Ka\031\266\013>\211\250\303\302l\354\212\036b\263\026q\242"
+	.ascii	"\362\362t\351[\210\330\250M\204\356\323P\214W\276;\214\211\322"
+	.ascii	"]#\266t\375<\202\212d\320\037\343\f\353\262\016\263\005\261f"
+	.ascii	"\203\216L\267g\302\212\263,\263\007"
+	.text
+	.section	.gnu.lto_tcpSetBaudRate.34.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"\245\n"
+	.string	"\366\323KC\020\253*\035xu\006%P\274\366\321\337\327\237A\024(\211\004\240\206oo\221\021\230<\226\273\330\032\306\232\351Hrh\331\2121B\222\213\002L9\263"
+	.string	"\0050\261\302\326 \260\r\tTh\274:?v\333;\2454"
+	.string	":"
+	.string	"7"
+	.string	"\027\333\251\307C\\N\267?\\N-\332\030>\272\026\323r\255\3042\354n\235\255\213\227\242\377\005\317\250V\250KL\306\356Z\252V\001\356y\333\023\266?l\323\002\237\177\375\222n$X\300p\260\013\240\246ae\024\302\001\333\327\330\234\331G\216W \036frfw\300\006\320v\312\261p*|.\355#x\002\361\257\323\035vY\024\036\354\216\025\016{\313N\2269&\310RS\305s\332'g`\332v\327\343\307RP63\003\247\376\351r*Q@@J\326,\033D\270\260\222f\217(9\t\330\267\354\356z\262\354\303\036_\310ux&\\\310\346\317\373<\013\021\217\327\211\370:\021\027\226D\241\315]\207\324\205 $\\\b\374Ju\303C\003T\303o\004\344\302*\nq%\265\003K\265C\341\021\351\003k8\032\201U3\006\r"
+	.ascii	"\253\223\241L\323I\031\0067w\326\330a\327\320f\230\r\204\357"
+	.ascii	"\324(8\306\247\232\006'yqM2"
+	.text
+	.section	.gnu.lto_tcpSetMode.35.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"m\n"
+	.string	"\266\023JB \213*\035@\352\200M\0246\031"
+	.string	"\2305P\200\026\005\004"
+	.string	"\347\302\003,\f"
+	.string	"/\250f\310~\214\225>A\260\200\2451z\020\204#;\333\2300\201V\034\217\027k!\r\022\\O\260}eC\233\354\235R3"
+	.string	"9"
+	.string	"6"
+	.string	"\332\251\307CLN\265?LN-\332\026>\026X\212\nAIK\303\356\326\251\272x)\372w\360\312\tU\272\244\\\354\256\345\t\025\340\236\267\035a\233\3036,_\375\222^.L\260\310\260\013 \266a_4B\002\333\267\330\231\026G\216o \2365rew"
+	.string	"\254\243\235f\262\214\002\316\245\375\005g ~E\272\303n\312\005aw\234pE;S\326\300\3602M\022\317i\207\374\301H\333\335\215\337\032\021\271T8p\352\223&\247\030\003\002L2f\351\222@a%\314\036Kr\022\260\237\355\356z\246\354\263\376\031^\367}2{\235\327Qxl:\r\306\343@[(\002y4s\232\020\027v\200l\036\320\023\325\214\r\214N\r\275\017p\013+\310\263}*\007\212\252F\302_\310\003k\370}`\265\214\373,\r"
+	.ascii	"\253\223\241L\323I\031\0067w\326\330a\327\320f\230\r\204\357"
+	.ascii	"\324(8\306\247\232\006'yqM2"
+	.text
+	.section	.gnu.lto_tcpBeginWrite.36.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"]\t"
+	.string	"\006\322C=\020\0059\035"
+	.string	"\200\343\236g"
+	.string	"\200Sak\227\317i\367\"\224\025<,"
+	.string	"\344(\241\221[D\216\007\243\321&v\214j\204\f\360\246\016(`\206\026v4\344\307 \237I\200 $B\366N)."
+	.string	"1"
+	.string	"3"
+	.string	"\334\267\356\003\3347\223v\315\313\326vX)\"/\261\335\255\224u\362\223\364\317\362\200\224\352\364\331\211\330]\317\224\212\344\246\267\235`\233\3026L\273k\272\262\357\372\247fz\305n\036fvGf\001\226f\213A\261}\217\215P\002\361i_\345+\344] \027\330]\311\274vK\006;t\337\\\276 \332\322\2255\330Kf\203\242!\376M\234\315q\027S\267\273\037\277\305\243\343\240u\362\315\377\340\276-\264rPsf\002X)\303\331\t\300.O\223\232\330\3276\016A!\250\001\343\003\362\fBP\364\215%Q\2503\350\221\300\361B\343\013\211a\251NXHT\3241\314\020\277\261\212B\337F\005\305R\365\024<\"\205b\035G#\261z\312}\t"
+	.ascii	"\253\223\241L\323M\331\030\314\2612\326\311e\224o5\032\334\345"
+	.ascii	"E;\311"
+	.text
+	.section	.gnu.lto_tcpEndWrite.37.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"5\013"
+	.string	"\306\025P@\020Q\225\016\200)~\333\213\300Q"
+	.string	"\212;\305\374\003\343\016"
+	.string	"\227!\363\210\002\333\333\016\264\214\244a\352\nW\002\211\232\304\233$A\200\332\340\\@\005\005+\333\027\363\035(\244\316\277'\237\033\355\235R9"
+	.string	"<"
+	.string	"?"
+	.string	"\033-v\353\001'\300>]_\271>\261\007\270>\375\3310^U\033I\235(\251\350\330]*S\377\036?\377\254K\302\023\3511\242`w\035\303S\207[\3366\001\333\033\373\003\002>dw\327\022e\177\365\177\212j\207\214\314\212]\016\0375\226c\272\030a\373gyb\331\220\261\353\350\253\301$\tK,b\354V\003\237\326\330\002f\036\355\227\270\211\357\253\013\007\260\213\n\361\322\246\320\305\207\266d\220$SZ$\036\272\354\nO\021\302v\027\343\243\260 \222*\021\237\376\350\372\254\250h\200\361\303q\303\303\213\313\327;"
+	.string	"\001F\017SZ\246\326\214\215\036v%E\031\302\001\335\275q6\016\002\b\030\316E\300\246y2\257\363t0k\027\220\346=\220\220u\270\255\243\f6\0134\324\333\"p\231G=\235l\002\325\270\216^\n\370\003\3328\352}>\034\235\324=d%\312\r>p\200\022\203\261\r"
+	.ascii	"\253\223\241\214\351\002\033\006\267n\022\311\214\215\2617m\223"
+	.ascii	"k\n\030\256\214\024\331\022\025\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_tcpVTable.38.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375 \373=\006"
+	.string	"\324\n\275"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\303\364\203\005\177}\270\364\223\005{y\370\357\263\005{w"
+	.string	"\005\001\006u\001\274\236\364\236(sq\270\356\303\tom\370\355\243\007ki\270\355\263\005ge\370\354\243\007ca\270\354\323\007c_\370\347\303\005]["
+	.string	"?\202\210\200\330\001YW\305\001U\304\001S\303\001Q\302\001O\301\001M\300\001K\277\001I\276\001G\275\001E\274\001C\273\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/target/SITL/serial_tcp.c"
+	.string	"\n"
+	.string	"\200\024@\n \005\220\022\223\024\231\304\334$)&)f\222:"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_tcpSerialOpen.39.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\333\t\r*"
+	.string	"zF\370\017E`\346Q\007\323\030\251"
+	.string	"{U\367t\306\211\307{3wx[\271\017\307[\304\303j\255e{<lh2'\304\330\370\031\022\"J\255y\217\323\037\346\364\223\361 \035\030\025:\263\n\210Ab@I\332\226{\313\224R\347"
+	.string	"\334"
+	.string	"\363"
+	.ascii	"\217\373v\007\f\222\034\255\266\350\\\264e\336\361\374\223\315"
+	.ascii	"\3220L\234\351\336M\243}\254\201\022\324\351u3\225\320\fd\231"
+	.ascii	"\251B\200\221)\037x\332J\270\004g=\334e\351\031$\323K\267\300"
+	.ascii	"@\363c\366P-Mh\200\034\245\265\344\350J\357\276g\221Q @\216\n"
+	.ascii	"\273A\226\363\022B\207\300y\232\340I\357\277\333\2578\030\r_"
+	.ascii	"vY\347r.\342\205,\347\f\241%\340<U\200vw\373\227+i4[`\231\244"
+	.ascii	"R\321\322\246\304\330r^\362z\351B\330S\234\013\300\236\336-g"
+	.ascii	"]\305)z\237mwr\265\002\263L\321\370\3031\220Qjg\204\372\024\235"
+	.ascii	"\220f\024\2623"
+	.string	"J\241@=\352\300\251\361(\356\207_t\302\235+\260\2351\n\005\332q\206\305\307\374q\030\241\376\325\0139\347\376\242\221\312\033\347\335=\243\273\211\335\271\263~\214\274\233\204\247\3512\003Xw\216J4G\026\260\234G\345\231!\347\332\357\271l/j\232RR!\376\213\024\026\247\333\204\227\021\016Hv\237p2\353\325rc\3139S\360\264\354H\025\343\346%\306\307(aO\377\016\340\272\362M>g\273\353L\027\221\365\344`\224\206\2229g/v\367\317\311\216\210\234_\274\211\242=\211\247\235\302\367^\364\264\335\207=\335\335\027+V\rxf\335-\2479m\350Ez\277\201\323Eu/\262U\037b\277Hak\242\276O\007]\277\257f\352\355\351\237\355c^\302\315\254M-\277\237\356\245\323_d\267\243\371\266\335\375\335\300\273\270\027\371\026\367\005\256\305]\201gq'r\246\367\316\227\356A\375\255\333}\347\202\276q"
+	.string	"\276U\240\357T\367\215\352\276o\356;\255\363\257\336\352\226!\371 M\f\234@\326\"\347\321\352G\325\004gW"
+	.string	"%\337\203j\305\255\033#\017(\331\233p7\313\344u4}\216\025\267f\217\343\213\b\222kNrN\336\306O\255\270U\276\324\327x\250$(\377\304v\365Z\345;}\316a\341\246\370\033K\305m\305\255\327\037?z\332\333\200\007\330/gc\255\364Z/\"|\366\340\356\025+V]\251\267\233\005\3635\fyV\334FQ\303\343E\265'\365^\261\251\2670C\316\262\035!\201d\316R^l7\343u2\240\032\2048M\270\233\263\342\266\311Q)'N\225\220\361\n\t\302\264\203\2038\275\30409\007>\350\356n7\207\016\357\305\364Z\310\252q\235\032@\363\211\336\356\017\376\006\204\001,67m\376MQ\rBv\020\370^\364\272\324\021\352\237\035t\357\275j\246\336\334D\270\331\032\2335"
+	.ascii	"\232\001K\276\344b\030dz1T\201\277\241\020\0052\371F\374`\370"
+	.ascii	"\220p,\222|H-Z\3702\304 \352\032\370\003\376\"\250\240\3603\032"
+	.ascii	"\212\001\374\271\b\246\235d\364\"\211)E\013_\220\b\\\342y(\301"
+	.ascii	"\201\004\217\t\270\202\350c\342\271\b\372\204\274$\342\022\317"
+	.ascii	"\250\250\207/\200D\036\323pH\344\001-\263\243\371\266\255\336"
+	.ascii	"82\325\304\r\256\217\371\0064;\\\232\267\235\305\272\213\243"
+	.ascii	"\273u\267/<](\365\"{\013\273\023[\211\220I-a\r\256\373\310jS"
+	.ascii	"s\264!\217%\210\221YGe\316\231\302\022L(\271\006\246\350\352"
+	.ascii	"\255,)W\334\376\371\2522\024"
+	.string	"\007l\001\326{\301\230\262\342\226MJ\227\220\025\005D\036\312\223\025\267kN\232\020\340\262\372\"\322\372%2\224\254\270\275sT&Ar\200\313\212\n\362\271\222+n\323\266\214l}\253\265\026\245\025!2\345\205x7\313\365XM\177\\q\200\273\250QH&\225R3\"\")HI\222\016 #\021\241\232\016\021\360\2503\b!%ds\2461x\036ER66|\371H\007\251\020!\371\245\261\b-l\244D I\223\3454\302\214^EH\320\"\254\323(\r\207\023\305\034\201+\021\350\303\227\315\270\347\245\224Lw\022\355\266\256~\333J\212\006\323e=\244W\202\312\345\363\340y*\246O\340\025\302#s\315\361\356\013\344\016[J\222@\211B\352\\\025L\247\375\b\334\347\334N\322\275\357\247\213X\202g\322\316\253t\003r\247\300\260h\232\342\376Y\032\204g$\204\315\264\230y?M\023o\304\230\rw|S5\024"
+	.ascii	"\nG\020}\302\026\303C\342\303\321\036Y\236\035\325\t\326\242"
+	.ascii	"\n\037\243\371\203JZJ\177u1o\230\025\204\204\274\346\001k\346"
+	.ascii	"\311\222\007J~H\213\312\222GQ\307\b\305'\353-0\246b\265\355\302"
+	.ascii	"\203\324#\340\223\270M\332^\316\236\361\233\005\273 \3632,\201"
+	.ascii	"\301\337\031\211\b}D\337\327>\352\322\225\037\035\177\300\327"
+	.ascii	"\f\32426\025y0\221E\2014\370@p)Q\204\241\245\004m\224J\212\034"
+	.ascii	"\001\246)\325j\016\322B#\251j"
+	.text
+	.section	.gnu.lto_tcpSerialPollAll.40.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\366\002\365\026"
+	.string	"\006\252\226K\240\326Q:@\237s\366%\276\033\026^\321.l\203\342b\234\362Hq\350\315\202\025\r:>\236\227\356\357\256\036\355o\311\300~7}S\350\365\243\360;l\001T\340-\222\004\262\003"
+	.string	"\271B\n\251\220n#\301\226}B\b!R&\031\201"
+	.string	"}"
+	.string	"\205"
+	.string	"']>\240<9\236\245<y\327\336v\225<\005\326C\241\3000\214RkE\233\304\236\037\323\257\311\267\237fI\216\315\267}\323_n,\341\371p?G\323\250Wu\252^\207\361\346j\211\322\323!6UX$\275D:9\02602\344\305\313\207\0207\\>\"\036G\026\0178\252V|\273q\246\252\205\322\207\347\"\237\216\373\351\rDe\361|Ig\023\247\326\272\314\363m\370\266\276\273\300\335m\260\313O\002=ze\0220\345\270\270O?\276\020\301\304)\252\312\305\335\024\307\375\333\375\315\325.\305\366\210\335\007\205_\363\301o7/3\357U\004`\025a"
+	.string	"\245\326\243\254)\225\bITq\341\037<\357\376uT\263\237\261\037\256\353\325\243\361\032\267\013\205^w\275VQ\006\030LjMs\316\223\233\236/]\315>\306>]\327\311\027Q\315e\334\351\366\340J\235\270\336\371\004\245\202I\255U\346\344\"8\003&N\200pA\366o/+\271\337\204\347@d1R\263\226\356\207\017\356\230\263ST\223\215\261\177\373\240\362M\253a\245c\254\335\235p\036A-\300\335\236\357\230\365\021!Qj\2556'u\374\2648\b\201\201\3439\204\272\245\204\023"
+	.string	"\242\023*\263/<\004\246\334\243\204\b"
+	.string	"k\255\347\355\356\205C\375\300$\251\265\336<\335Fm\177\342\344Z"
+	.string	"\342\363N\356\201\312\223f3\022\036R\216\263\366\303_\003\361\252\237\214\244\004\265ol'\266s@\202\315\016M\213\354\013\243\361\201\331\"P\320\221\321b54\347\301\002\007\250-\306C\323\261\241\025d:=(\214VCi`v\346\023\243\241\266\331\214\206\272\322\372\036\321\364\223X$\222\353\241\025g\377\326\fR\266\272\255X\346\335E\347W\252\354V`\245c\254)\021\27589.~\254\265V\263\325\017\336e\346\335\255\376ni\210\263\276D\234\3422"
+	.ascii	"\233\275\013\213\361y\353\242k\334\256\020\237<8 \220\002\231"
+	.ascii	"\"\334\0014b\0302\354\322F\316\370\310O\n\020\007\355\315\265"
+	.ascii	"\"\232h\255\300JE\227\307l\022d\251u\\\242\314\344\355\322\244"
+	.ascii	"\322\266{:\2158\216\216\251H\007\207\b\346\017\036\034\023\265"
+	.ascii	"E\335\n\357H\300;E\220\211 {\301\343\216\006\353P\336\013:\242"
+	.ascii	"}\032t\037s=\200p\333\375\261\200\001\371\204\377^\301\260\312"
+	.ascii	"\027\242\312\f\216\013o&\332\214\303\005\272\357X\305K\221;\227"
+	.ascii	" \003"
+	.text
+	.section	.gnu.lto_uartOpen.41.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`0\001\365\r"
+	.string	"vZaE"
+	.string	"\2216\035\263\240Z\212\367\342\367\340\217r_\244\274\242\323jE\232\323h\275sd\034\213\237@d\336\217\243*\235\306\bMT\374\232\266)$\217\304\2504\035\203\312\355\030\367\272\276\331\013\340)\035\245&d\313\235RJ"
+	.string	"S"
+	.string	"D"
+	.string	"R\336&\303\005\354\322\344\270\330\035\0178Av\313\266o\342'J6\211\214#d\260\033*\030\025:v\307\315\343\007\\\267\262\207\\\267T\304M\227&\377+>K\260\210\201\2129]b\013v\327\022\025#s\353m\033\260m\301\376\206\307>\376\327m\376\231Ik&-1\351\007\b\361@\203$g\267\303\212\307\316\260^\220\260]\2625\273\223\203\273T\244\032\016\025jp\026\316\n\216O\0067S\374\246\364\324\205\t\262/!PD\310n\215\314N\013NG\f\" \373r3\363 \273\325Iq\001:\322\242.\326\344\207f\212\351\245\252v\212H\036\245\351\334\031=\331s\251\252\267\241\341\203\213\\\371*\365S\257\n\003\246G\213\\Y\003\261r\207=\236\244\326\330\237\273\273V\032\333\322\332U\377\307q\376\354\251\007$\025\020$\216@\354\363@\321\374\304\256\304[\351P\262\224O\207\022\nu\rXB"
+	.string	"\376\274\317C0A\201\347!\300rR\302\300\004\302\345\217g\364\021%\204:P\370\2216\222\023\007&\233\370Q\b;qS\001u\242\355\023\2226O\001\203\243/\334D\020\f7m\334[\013\027"
+	.ascii	"\211\223\241L\2130\314\326p\367\227q\031\327\304\200\025\020"
+	.ascii	"(\f\002\202a 8PM\250+0\267\t1\200\360\235\032\205cgh\031h.\324"
+	.ascii	"8\341g\032S;\311"
+	.text
+	.section	.gnu.lto_tcpFlush.part.0.59.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`\032\003\325\025"
+	.string	"\326&\212I\3200\2511\360\013<\"~\220:3\320V\177\206p\361\220\007\b\235\303\223\244Z\212\230\3560\2347\262s\271V\223\264\237\005+\241:v\205\305\0257\374`_\202\372\004\266(\343\351F\r\303#\203\371/\020\252M\266\334R\246\024o"
+	.string	"{"
+	.string	"r"
+	.string	"\364?\237\347=\267\373\264<\300\275>!\341\275?\005\267f@\336\372\367\220\361\226\374\200\361\326\376\216m\033\3177\273\306\1775W5\223\342\005(\352\336[\336V\024\277\335\212\225\2167\037w\373\341E\035\0212v\275\016\027\351\256'\363*\262\230b\274|\364t\342\001\037\t\251\017Oaz9J\005|T\221\334{Mz\270U\267M\301\266iW\007\001>\322\223\256\364\241WB\243\035\233\315\326\232\021\371\321\201~\360C/\272\320'4\332y\335\024\021\255\260t"
+	.ascii	"\256nF\005\316\004\362\266\2453\344\013\275\305\355.VH\034\217"
+	.ascii	",\312\361H oYb\013(\030\204\001\306\251\347\351\336\373\200\274"
+	.ascii	"\275\017\264\371@^\371\207\205\036x[\335\266>\210\330_\361\303"
+	.ascii	"\362\273\201\327\261s\262y\272\367\227\340\326%\244m\367i)\360"
+	.ascii	"\273\034x\255\030\021\032g\312 \363mZ\306\216\236\373rxR\277"
+	.ascii	"ab*X+\315\352\036\216\264z\340\240\234h\350\350\r\373K\032<\364"
+	.ascii	"m|+\215\267\264R\"\230\020.t\312\036\324F\231\215\337\275\332"
+	.ascii	"\032)\234\\\3059\347FA]\212\203V\032\327\361\342\255>[E-\376"
+	.ascii	"\367W\0255\035\251\337\201`\td\304\2751S9n\t\213ts\340\257\364"
+	.ascii	"'\375H\377\221\177t\026\001\261\227yA<\221\275N\361LY\231\301"
+	.ascii	"\354\231b\326\304\2236S\021m\306\314\330\002\013#1\027\201\332"
+	.ascii	"\rs\251\300\316\n'/\031\315\254\225%\021\032@(O\323\204\366:"
+	.ascii	"\313\024\331\013\245\204\321j\245\253\345\231\212I+\317\331\214"
+	.ascii	"V\256.\336\3523\211K\315Y1x\353\t\177\004\201h\022]\207\341a"
+	.ascii	"H\215\201\0316T2M T\2546\314\244\337\231\245\2538\333&\177\341"
+	.ascii	"!y\357\035qB\250qP\007\005FF\204\002IBAAZ\034\240\002\031\262"
+	.ascii	"\252\016\020X'\267\005)\314\0014\322kB\204M\206\233\206}bg\243"
+	.ascii	"\315(\377\204\275\375\272*Dj\310\363ke\b\370\246\353\036\024"
+	.ascii	"j\236\365#\024\332\253\204\221(\317\bcS\360\"\277#\213\177c\024"
+	.ascii	"\376fU\271\314\256\203\317\352\n\233\246\344\005\207\030$G\302"
+	.ascii	"\030\215\2755\017\213\254J\234\300&}\203\301%\004P\026e\214u"
+	.ascii	"9\337\031\311\025[\361&\370\241\265\211h\005\377\211>\005"
+	.text
+	.section	.gnu.lto_.symbol_nodes.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`!\004]\022"
+	.string	"\026\035qK\320\322(\035#\025\226\365,\267\251\216\b\263\262\370cC\221\216D\204?#D\353\314V\216s\300\346\234\234Vb\266\302\013\256\360\204\303(\365\350\377\367\374\333\207\315\301O\200O\300\273\f\366\355\336\r\301\327\211~\306g\263{\023I\322\016^"
+	.string	"_"
+	.string	"Z"
+	.ascii	"\006\nT\246\364\266K++\24544\357\b\235^\241\351\200\276Y\313"
+	.ascii	"r\372\004\247"
+	.string	"Qn\372e\323\260\232&\020\3164\274\330\321tK6\323<2\231Y\r\006\203\301\230f\361\356\202\216\037\230v]\021/m\342\322\003ZZ\205\245S\3545M\023D\2246\245+0\\\274\367\336\225\216\205\224\322\372\n.n\37402\251\034b\212\225Q\347\237\001\311\307\016Ve\323\371\236\0174N\362\277\031*\216Z\225\177\336V\273x\357\275\002D\226\320.\021\272\006B\333<\350\035\007}\323\240qj\235\303\240u|\232\266\240c\024\264L\202\236A\320/\007\032\346\367^Jc=Ms\236n\ty\374x\330i\2260\271\323%\"\024B.\313\255\034i\271<\261L\236/\313\244\355\337Y\b*QZ.\311\3750\202j\360`\226Wg\314\262\312&\263l\352\241X6\231\242e\233{\250\343\365\360\261,\327\316)\226'\f=,\n\362\303QEW\3572\336R\013\262r\353\374\253B\016\ne\345\322v\032\3648\222"
+	.string	"\337u\340"
+	.ascii	"\242\2260J\3514\205\f\026!,\t\037\367\025\022\220DJ\305>)UM\245"
+	.ascii	"X\205\373\201z@\206\306\0216\341Nm$\025\335\306\021\276\322\257"
+	.ascii	"\003\372\222F\021\276\031\3027\032Q\2742\017@\350v;\215\034c"
+	.ascii	"\303\211\237\312X\236\370\275\037\b\024<\"O\f\013A\250a\f\005"
+	.ascii	"\206,0\t\023\024\245\240\315\001\360\002\241\231\342\006\021"
+	.ascii	"\240\024EH!\241\022\312\004\022\245\007w\r\033\324t7\211E<\326"
+	.ascii	"G+'p\301\004\216\006/8Q\270c\373\f\236\317\373\351\r\211\312"
+	.ascii	"\2338\347k+\221\205\231e\020\302\f2Pt\247\337/\353\237C\212%"
+	.ascii	"]%\324\203\261c\304\365\374\341i>\027X\017em\201\b\327\344\317"
+	.ascii	"\315\264\256fp\230\003\224)\260\303\004\207\224\200\234Lh\313"
+	.ascii	"S\001"
+	.text
+	.section	.gnu.lto_.refs.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375 \221=\003"
+	.string	"\222\210\027\033pO\206\003\374\377\377\377\3777T\213\177v5<\233\364##\210>\323\t\333R\246\257\372!\025\250\230H.\216s@\002\035>jL\371\245\333\322]\351\216\272)\335\223nIw\244\033\322\375\350vt7\272\031\345\213nEy\242\033z8\324\335n\247{u\013\372Mi@\034\005\006\354\317\004\001"
+	.ascii	"\204\235\bR"
+	.text
+	.section	.gnu.lto_.decls.275a9e85f5f6f1f5,"e",@progbits
+	.string	"(\265/\375`)S\215N\001*(.yU \016%\235\306\234[\"\005QD@\025PA\004\020\021\035\334e\030\211\226\200F,gRP\021"
+	.ascii	"T\021,\224n\215\034\210\331\215\334\360\004\371\345?"
+	.string	"\367mD/\321\207eA\325\241\033\021?s\227\201\272\344\3561\t\345\227c~\222\371\3033\253Mn\271\245\2242\005\236\006\212\007\242\007\350\f}t\231\2066%\017J*\r\r\005[j\036\241\3313&\0165\037?},\345\b\231\025\003\263\203;Bv\202/\247?2;\266A\206\305 \240\017&\372xL,,\206\316\t`\234X\330\013\324\327\212&a\026L\004!\200M\270\364\361\216!_\315j\304\203\t\217!_L\345\323\212\375\262^45\242T\301b\361\361\222>.\322\277\345\332\022\316\310\021$\310b!\231(\356\251\315\342\343\025\372\277\375a\255l\020\213e\201\330+\233U\235V\313\366\270\365a\251\352\323\306\331\222\325\252q\026\352\210\336\3368\254\226\345a\2158,\2318\311\227M\322\2627\376\254rd$X\231\351\365Y\255*gwT\271#\334\204Loo\034\257]V\313*\325\263\031\037\347nB"
+	.string	"-I\313VY\0323J\347.\022\221\266\324\374\333\333\271\241\336M\365\325\340_%\272\032\331UC\336 w\246\177\307\364U\3022\343\233\272\325\361\333(\233\303\232\271\311\320\262\330J\205\270\235\242\241\032BC\2638\035\2546\371\316]5d\275\253M\006\253>\310\374\002\235\230,\216j\305\004"
+	.string	"H\261h\351\272\262\3306\205\270u\262\311\315#\347&\333{\323\314\004y)\331\263\230f\260\332\344\272w\325\220kv\265\311\372~\351\337,\375\333CoX\253\032\362ok\320H\271\2248\221YliX;\303\036\335\322\2602.b\304c~,\r\274\267O\255\005\230\251\265"
+	.ascii	"\350\263\207OX\306\2779\364oc\340\241A\270$A\201\341A\006\260"
+	.ascii	"n\251e\361o_\334\032\305\364\310[Q\303b\333\334P\367\210\314"
+	.ascii	"\214,\376E\322\257H\350\006\365\264\324\301\022@M\341\013(Gz"
+	.ascii	"\317&.\272\340\204\252j\233\222\3726\363S\263\177\234\206\252"
+	.ascii	"\236Q\004\213\030\251l%\200\232\302\242\260\"9\241\013(L(\365"
+	.ascii	"\255\312\221\221\320\325Eoo\347\234\224jW\345\310HP\022\330%"
+	.ascii	"b\204]\326\274j\245\312\035A`\353\017\204?\304\225\312\307a\311"
+	.ascii	"D\341\310\312o\211,\013\353\302\n\331!\353c\267e\332\"\033d["
+	.ascii	"X \253\264+\354Ou\332e\315\362\332W\375\276\301\271\367\317\336"
+	.ascii	"\373 \374\265\315I}\273D\232z,\254\005\222?\304\355\262R\251"
+	.ascii	"U\252\034\031\tk\200z{;_\273\376\372\344vY\343jX\t\240\346\376"
+	.ascii	")\262\307\001T\227%m\177{;=\330\340\201\007\036\344\2775.B:\340"
+	.ascii	"Wg\345R\273\b\332\351x\022\263\370\266\215\213\340\013\036\013"
+	.ascii	"$I\266\274\n\312\304\370\201+\263\270\376\325\300\377B\231\301"
+	.ascii	"\300A\261@\300\333\302+\213\232\305\316\230\242\242\035L\177"
+	.ascii	"\312`\343rb\361m\230Fw\325\220\277Vm\362-\020\375W>,dD\252\334"
+	.ascii	"9\261\325\0245*\213\353^\325s\356\r\371\013\212\324\233\305\267"
+	.ascii	"P\372\366\206v\322\310t\021\322e\213\305\26704\276:\342\264\207"
+	.ascii	"W\357\224\352\270XX|\313\324\267K\375\"\304K\312\240\305uJ\255"
+	.ascii	"\303`L23.\370\236\350,~\355\323\257y\3725\212~]\242_\313t\r\021"
+	.ascii	"\375\252\245;T\233\374\272C\277\336\320\257F\272.\251L\252\323"
+	.ascii	"Cu{MR\237\027\3768\267\330\336N\032a\035\237\r2\213_\231\372"
+	.ascii	"\325C\246\031\034\034\034\254\036\362W\240;T\r\031W\233\374A"
+	.ascii	"\265\311\227\253\032r]K\243\261\022\352\342\262\370'\364\253"
+	.ascii	"\263\252\245\241O3\245\024\332k\332/b\304\255\304\354\335\265"
+	.ascii	"\367\346p\235\350\270\022\263\370}\365\354\277\020\017\271:\212"
+	.ascii	"\262\270\216U\262\352\354\240\036y-\253fG}\234\333\271\267\223"
+	.ascii	"\306\356\340r$\314\342\232\252!\333j\223\037\002\375\332A\276"
+	.ascii	"\203\203\265\203\374\r\350;\253M\376\253XX\366\002\354\342g\361"
+	.ascii	"_\303\376\312U\273*\330e\n1m\262\275\235\031\320**\260<\213\253"
+	.ascii	"W\375\252\316\r*\221\213\030\361\253\004\333]{\313\321\304t\341"
+	.ascii	"\202\202\303\342\233\240c@\274\016\271\r\330\036q\253_7\310u"
+	.ascii	"\260n\220\357\254\032\262\2566\271\212\260\202\027\013~\373\344"
+	.ascii	"\256\215\300\036k\206\\\201\337Z]\262kv5\344\005\240\177\275"
+	.ascii	"\256/1y\304_\017\360\327\264\212\370\253\007\177\3057C\220\253"
+	.ascii	"F\342Z(7\355\277h\377=\253\031\\3\023xkq \374\350\220\377\302"
+	.ascii	"\374W\370\337\364\2775\377}\371o\376/\376o\314\177e\376\213\376"
+	.ascii	"\227\346\277\031\272\374\226m\013\240\226>\276\337\356\375V\352"
+	.ascii	"\316\356?\001\376\214\200\013\177T\231\201\211\347\037\355\300"
+	.ascii	"_\217\367\204\302_\205nK\023\370\340\314\335j\006\035<\357\031"
+	.ascii	"\374\350R\236=\262\345?\007[\\\202R\235H\255\351\340\317\"]\346"
+	.ascii	"GG\300\030\211\371\321\241\026\352\007\177\025!\003kTV\363\243"
+	.ascii	"2j\265\272d\325\004\333\314\217:\375'\362\327\364?Z\325\377\327"
+	.ascii	"L\3745\251\354\257\365\257\371\2571\377\335>\344f\340\267@G\376"
+	.ascii	"\352\242\202\300\341\177\332\377\025\352\320\177E\370-\f\n0q"
+	.ascii	"\021~\264\205\277\302\374\326\352\222\375\027\307\330\377\301"
+	.ascii	"\277\316\374\365\345\257$\376\032\302_k>\344#\370\177\301E\360"
+	.ascii	"\277\203\377,\\#\325\3045\370\321\025\374\267\310\177\303~\353"
+	.ascii	"\002\354\277\036\210\374\267\370_\347o\233C~\273uw\276\376\353"
+	.ascii	"\325\365_\030\270\376\273\267\376Z\345\277B\376J\365W\035\377"
+	.ascii	"\005\222\365\327\020Q\177}\372k\325_s\374\027\353\277U\177\275"
+	.ascii	"\372k\217\377\276\370-\007\177\305\362\361\333\035\267\307\177"
+	.ascii	"I\270<v\374\025\204\213\244\303\202\360\004\3745\313\177\243"
+	.ascii	"\376;U\255\252\211\232\001\212\202\377\036\300\351?\013G\177"
+	.ascii	"4\004\377m\372o\322\177a\374\227\371_\345\177c\370/\317\177O"
+	.ascii	"\360_\022\374W\003\377-\341\277\017\370\257\210\377*\340\277"
+	.ascii	"\b\370o\207\377j\370\357\005\277\215\362\333\270\337.\371-\333"
+	.ascii	"o\325~[\366[#\277u\376\326\353\267_\277\335\372\255\326o\257"
+	.ascii	"~\313\343\267R\277}\372\355\322o\221~k\364\333\026~K\374o\366"
+	.ascii	"W\021\376Z\363\177\312\377\265\377y\277m\376\326\305o\201~\373"
+	.ascii	"\363[\025\277\205\341?\336o\217\277=\301_3\370\317\302\177\267"
+	.ascii	"\337\026\177\233\342\267(\376\372\367W\254\277*\3755\351\257"
+	.ascii	"H\177\255\361\327\243\377+\374\325\304_7\374\325\346?\330_/\370"
+	.ascii	"k\206\377a\3771\360\037\356?\006\203\203\203\203\277.\361\277"
+	.ascii	"\b\340\257\300Xx\320C\334T\335\327\037\352\203.\253\023U\332"
+	.ascii	",\326\351\201\007\033\322\026UL\270\214\037SD\377\270\313\361"
+	.ascii	"\340\217\003\361\026+\224tt\305b\314%\304q\027KE\006\007g\261"
+	.ascii	"L\265\311\217\361\322\327\253\032\362L\265\311\370\317>\rQ\331"
+	.ascii	"\026?\346J\343,\270\257:\377\304~N\261'S\352\354,~\f\225V\361"
+	.ascii	"\314\3513\377\230\017\3132\t\217,\026\343\275\30059>\213\037"
+	.ascii	"\203C\037\004|\005[y\036\207%s\373\340`\300\223\215\256\371\207"
+	.ascii	"\365\252\023_\361`\203\265\263\321E\207\361a\266h\214w[0888("
+	.ascii	"\270\267\017\306\2638\017W9\306;Mj\247\305\364\311\370\307w\325"
+	.ascii	"\n\024'BK*v\036\276\326\2068\365Z\320"
+	.string	"\326\340\224\272\245\322\007\311\342\037\327I\241!'xeq\224\027#:=%\026\037\306O\257h\201\207J"
+	.ascii	"5\205DN]z\201\227\313\237dUC\376\234\021"
+	.string	"\356\335\204W\305\343H\357\252E\016)\254\003\b\n\222\336\336\273M\310\026\242\"\374\302\005\024..\234\003\273\341\035%@\251\361c#\230\016\243\341'F\202\241\340&X\r\263\341#x\r/\301O\360\033\226\303I\360\031\216\303eX\t\036\303m\330\tf\202\341\260\031&\303ix\256:\261\033\016:vb\"O\266\002\217\260\033\216\352 \314F-\002\004c1o\227\237\347}\365\360A\324\246%\270\002\b\263Xz\341\243\032Xi\252\252\232Am\270\316\252t\f\312\r\275\2757\021\fL\243\004PS\030\344$D\357\313\312\355r\007\3612l\210\036\356A\205\255\302\204\272\376\252\366v\366ea\254\022@M!\220\023\013\275\275\235\3076~|\344\206o\340\247\353\254J\215,\227\364\366\336s^\030\353J\225\033\016\202\2618,\231'Xq\271\201n\030\f\027\251rG{\033u\0202\305%\370\267\367F\243\360\bl\203"
+	.string	"\376\261\330q\221\377n\271\202\330i\346\rj\t\221\3058,\304\261\330m`\314\340\270PYl\223\245e\234UC\256L\252M>\214\017}\030\034\37201\364a\200\364_\264\350\277P\321\177\201\323\177I\323\177\001\323\177\301\322\177y\322\257N\214\345T\002\220$<\213\377BC\377\330\n\377\320>hI\342\360\017\\5dydd\361_\204\364_\226\372BA}\271,\372\302*z\352N\242\360VX|a\024}!\023}\275j\223/<\323\027z\351\037/\035?\375\"F`'\023l"
+	.ascii	"\250\370Y\016Z\214q\340\246c'\314\264\261S\bL{\373`'\032\301"
+	.ascii	"\275}hj-@\255\005\300[NTe\031_\250\245C\2048^\272M\035\262\205"
+	.ascii	"\310\022\213/\364\2417`%\234\204\344\212\311\224\363V0\322\377"
+	.ascii	"\307h #6cF\230\305\027:\351\013m\350\272\253M\3061\260\214\352"
+	.ascii	"|\023<\343\371\314l\353\307\342\013a\350\026\3547\311\027\272"
+	.ascii	"\320?~\201\215h\374\342\2448\261\021nF\321Cka\361\365\240\276"
+	.ascii	"\366\323\265\211\207\260P\213\241\031S\260\020v\241v\343\251"
+	.ascii	"\304\342k;}\355D\377\230\005f\302\234\335\250k\201\2318\210\207"
+	.ascii	"\334[\022}mDW&!\032o\254\254\316\303a\237;if\220\004\035\201"
+	.ascii	"\263\370\332J\277\036.\267\240\036._\357\320\265\252\332\344"
+	.ascii	"k(]\231\252\206\214A\265\311\365\002\036\013\224\317\020\213"
+	.ascii	"\357\372\250\330\365\375]\277\213\345\356\335,\367\312\265r\365"
+	.ascii	"n\225\253\345\362]\274\233W\235\267oJ]\237\224\276(}P\350\346"
+	.ascii	"\372\344\372\342\372\256\223>k\345*I[\013\200\036+\212\273\302"
+	.ascii	"\001\377\335&A\222\242\334\2651\037]W\213\303\222yB\026\017\263"
+	.ascii	"KD-\216\312m#r\271\276\214\334/\265\267[f&\264v\305\320\362\236"
+	.ascii	"wl\013\337u\303\213\273h6\356\256\335\225r\243\334)\227\356\316"
+	.ascii	"](7\356R\271u\327\311\225\253\316\373\344>\261V\256\022\245\022"
+	.ascii	"YZ\302.,\350\234\034\264\025$~9.\334}\253AVTQ>kI\360\262\033"
+	.ascii	"\022\254\035\227\311]\202\313\232O\313tK\335\322\3103\311\313"
+	.ascii	"\217\234\230\226g\222\020Yj\\\354\225'S\024\0226\037}L_\027\311"
+	.ascii	"e\233\231b\032\001\022:\271Q\345O-\255n\251\001\004P-\255\004"
+	.ascii	"_nc\313\036L\204\320\344\025\361\341\335\263k\026\363\244\006"
+	.ascii	"3\310\213\221R\221\345U\342\374\221t\217\\2\215\306#\256k&+\313"
+	.ascii	"\255\n#1;\242t\215\334\"0\312\034Oj9FTS\340\b\210\270\274\335"
+	.ascii	"\260\013\246\303\274\354vX\"Jmu\371\257\nOy\235w\310\314\025"
+	.ascii	"\236\2213t\214\313\306\020L4\265u\345z\335.\031Q`\200f\2011\332"
+	.ascii	"2\320Y\025\260\273u\205\340?\254\030l<\310\340\306f\206\334e"
+	.ascii	"\241\335 \027\210\216\022\250\366\344\272\300*#\313\272\352\331"
+	.ascii	"\302R\303\342\203\300\343\372\270\3165\335\"\307\025=\253\373"
+	.ascii	"\343V]\254\352\274W\026\356u\356R\235u\335\253{\343\342\270\316"
+	.ascii	"*a\213)\202zW\267\351J]\"Mm\026\004\250g\366\207\270Ww\352\356"
+	.ascii	"h\001s\260\251\265\267\363\372\b\243b\365\202\353\256\032r\217"
+	.ascii	"\264\005\234\024\036\026_\327\320\327D\372\352\270rn?Z\026_\377"
+	.ascii	"\350\247[\364\377\233\243:\257\324\215r\356-v\245\256\323\205"
+	.ascii	"\232\371qn\243\224\312\321\340KR\223\034A\030?er\237d\2308ak"
+	.ascii	"\263\370i\232~:\246\237~\351\3772\375\3420\301\336dB&x^Y,\276"
+	.ascii	"K!~\231\006\200\366d\2638\2556\371i\226\376\257\215\016\364O"
+	.ascii	"\233Y\227"
+	.string	"\222\325\0013\264\305\351J\322\0064\316\031COHUmg\251\"{\267\306\317\250\364\375\260\270\005\013f\020\320\212\237\345\232M2\344\243,\2720\356\321\245q\233\327\350\016\335\030W\306\235q_\\\027W\250:/\221\317\335\203\226\313%\262V,\226\260\255\265\275\235\036x #tG\327\203\003&b\213pX2O\370\321e\304\226\251\301E\261v]\342,\224\261\2707\373\344\bY\227uR\261yE\224\326l\222!3\253\206\006\370g\0059,\231'\\qyZ\267*wT\263\177\314\246\326\366v\362Y-3\312\f{?9Y\273\312\273\342\266\270,\256\317]\336}\201n\320e\336\037\313\305\016V\247\355\362\r\316\335\305Z\261X\256\363\307\336OI\036\256\376\002\255\002\340\201\226\023\234kr\b\314L\\7\230[\002\357\335\023\340R\240\005\234\221A\027\365g\361\263\240~\306\363\353\243\021\223\242\233\342\327w\271\276"
+	.string	"\221\372l\026*R\246\214Y\374L\247\237\237{zB\027\203F~\354\351\335\243\034{Wz\366\n\212\326\346Wg\361\363\021\375,\244\n\336\007\212|\275\250\202\207\351\332"
+	.ascii	"\321\360\354\335u\263Q\227e\207~\2561\245.&-KK\324\224\272\324"
+	.ascii	"I\016\""
+	.string	"muV\n\214\225\022\031D\026?\017\351\243\\\350\346tT\022-ets\265)O\017j\316\312\335,.\276.=}4\316I\223\030\2433!DN\232\330!\030KOM,\034L\013\244>\2606}4\214\311\222\231\"\315\026zL\226\350\241\"\257\264%VI\272\"\312\225\026\020}\024\252\rI\352\363d2\322\206$n\207]\026\022\3136\324\244\033\263\370\0012\220<7y\206\0231\342O'R\315*\026g&\331-\277\375B\3156e\253L\277\001`3\214\214,~V\222\227\374\302\352\205d\266\302\342_\020\246\3633\253=ma\202\303\342\234\244\0016\002q\bZ\374\334&E\327#\313b\233\331\272\250\246<a\313k\\1\242xl\032!\333\226,\031\026\377\202.\275\001\327\330XF\263!\025h\365\202f\265Fv\366\214\206\265\212`\215Y\234\315\376\024*9\323\262X\234\311r\031\224RI\320\342|$"
+	.ascii	"1iIii\026\377\202\036\372}hPL\230\335\337\226(\275A\323\353y"
+	.ascii	"\210W.\262\201I\271\027B\006\223@\253\277\315<\362\220\336\260"
+	.ascii	"\2321$\213=\027y\n\305\210\232\212,\316a\177V\261\372\313bq\006"
+	.ascii	"S!\314M\316\342L\344O\241\233\323\013=\213\263\363W\222X\231"
+	.ascii	"\003\264\370}\030\360\277pf\310HG\226\305\371\353\202$\315\001"
+	.ascii	"\017\013+sm`Rb\351\360<\n\264\262K\026@\216\262"
+	.ascii	"\3263W\336\312\362\034\\Z\234\205t\325\330k\026\377\002\030:"
+	.ascii	"\007\371\263o\252)\315\342\f\344yCHoi\026\347,\274\024\352b\242"
+	.ascii	"\274\200Ho\300e\307\363\217\035\331\252\202\355\242t\352\215"
+	.ascii	"J\357o3\225<\304\324m"
+	.string	"\035\371a\225$\212\251\346\304\342L\365\\\365\013-\333\037\222\021\213\237\001\213\316=\236}\374B\341\213 \252<\375g\036\277\360\0269\255X\263\370\031\244\350gH\2427\250\313\221#OU\260]T\205\334\355\b\324\332\373\310\003\352W\367&%K=O=\223\240\214~2\004\321\034\324@\374\317MM\031j\003\223r\357\203\347\333\216\027\177{\037y\310foMa\371\351\031\352)\204\306G\305\342\354\364\247\214>\261\025\026\377O\230\246!\"\033\026?C\222\036\300U\246\221id&*dz\373\350\310\303\004\206\374`\344\245g&\030\243=\264+\213sR\276\241\337\224\250Z\344\033\331\006Y \013*\274'd\251\213\316b\245W\242\037+\340,\316H\271F>\312\360B\017@K\216\221cd\031\001\220\301\226\376\330\313\272\352{\226A\207\345\243\314\342gPj\001\b\202\250B*Z\367\352D\353\362\013!s\357\030%"
+	.string	"\347b,\240\013.\211\233\305y(\026\016K\346\306an4\002\265\272\240\203\\4\002\377\372\362\316?Th\004\376m\371\232\003D\003\241\220\321\b\374\263C\251\304\265\361\241Y\324\252\356P\274&U\271(\013\345\026\231\231\215\262\213\034\224W\344\241L\224\201r\263:3\213\252w\334\003\235R\244\n\212\027\264\204\353C\3752\0244\032\201\177!\270\240\202%\200\232\302\026K/\275',P-\350_\225;r\356\027\351\322\214F\340\337\336N\017^nX\375\310\022"
+	.string	"\376\363O^\356\017R3\262\317\363\362\204\301\375cqV\326\"\271\273\251A,;\030V\364\217\016\242j}7\202DY\374\032:\375\0324\301\262#.>\234p\005\"\211\250\253\032\262\3705U\372G\377\226\254~\216VX\374\232\033~F4\3403\006\240\305\257\361\311\362\304\307'\006f\361i\002\261\354\245U\242\200\302\364\216\356\335\3455]Y\214^A\217\276n\370X\214Z\371\025\230\276.L\177{\3724u\372G\361P)+M\252,>\rJ\005]\242%'\207f\361i\236:\323\230i\001\354\2018:W\235\350\034\032\345\004\347V\276\2405\233\013@\243\374(\035\n\305n\3050\301\271\335\rY\034Se\204\006L\023\240\311\315\r\215\333\203"
+	.string	"\027\"G\036\320\276\335\303\371\344h\034z\324#(/\207\305\250\223?w\335\2207\213\321&\225\215(\314\311\205\305(\\}K\201\330\326dX\214\276I\200J\323\317\356\277\020\206\213.\320\316\342\323`\351\002\350hkC\227|\340\204M\311\321%\317\024\313\316/\320b\364y\261\250\260"
+	.string	"\262\030M\202\357\206~\370\214Mi\016\354\330\330\236l4/t\207\276\2633T-\204\270=<\253\277\264\243jZ\312\237 \013\213Q4\273#\t\215\253j\005u\362\253\242f\361iXh\016\202\220\221\241eX\016\260\204\355\310\321\262\372\026\003\005\205\207\323L\237\346\300\b\f\f5\262\367\201\333^\221\243Fd\326f\350H\023\213q*\267\02514\254\n\336\3172\251*G\023M\200?\247\023\225\212a\017\317JkM\277\013\375\352B\257\362\336\325\311T\324\334GM\017\007X\341\205~y\241Wu7\367B\310\30213\246?\023D\347\032 \216n9\321-\\\247\227L&\037\034%\2365\370^\374\355\315d\001/sGzSH\372"
+	.string	"H\262\262P\255\264\310\b\317\352/\310Q-K\203&\013F\032\013\213Q \350\217\271\271\273\244\231\2466"
+	.string	"\221\017\037\350\225s\027="
+	.ascii	"\007\236\225\226\325\321\253\231 cV>?\246\226~\360\375@\253\266"
+	.ascii	"\244\240i\021\202\345\026\324D\251l\217\270#NQ,\376\fS#\200H"
+	.ascii	"\207\016\224\307\315\373\201g\245\265\343(\017\273\305\257,\313"
+	.ascii	"Ow8\212\212B\245\266\252r\034\225zT\222\262\313Nw\240\302\201"
+	.ascii	"\003}\322{oe\315^N\351Q\205>\241Q\212\234nX\2146\275\374\360"
+	.ascii	"\251!U\241\021\334\273\273r\242; QRB\227\354\336{W\245c9\244"
+	.ascii	"\364n\034]z\252\327v\244\313b\324F\252\366\344\255\312\333\177"
+	.ascii	"a~R$\030h\361e\322t\001\356@\2400\320\030Ge\\\006\212T\367\336"
+	.ascii	"\373h+\261t\200\233\303\263\372\333GM\017?Z"
+	.string	"\343(R}\211\341\006\026e\361\373\320\243\377B\241\234\237\037\031z\204\322`B\004\267\30361\222Y\0227tF\315\022s\003\ni\212\305\227\301\241\377\327\333?o\237\346\336\373\005\352\334\315eL\376\353+Z\253\207_\246\336\312\301\177|o\202\004{/\237L{\357\232E_\251\371$u\330\250\\\223)\326\244\244@\223\321O\023\r\246X\223Q\006\246X\323V\376\370Pfh\356&%Sl\357\f??J\022\230\214\230b>;\003Sl\033\355\025tFu;\233\224\373\207ig\330?\333g\2131\031u`\3764\0311\305|\21420\305\232\214\266X\323\256\331?>M\026?\273\231a\2135\355m1&\243\032\246\030\223\021S\254i\2532Y\334Y\301H\302\224c\251\022a\376l\242!%\237f\215\034\323\311\264\355\366\256d@\273\271\345\366\346`o%\246\246\235\017\215\272\266\224#Z\236\3710U\347\336;"
+	.ascii	"CK'\246\375#\247\254[\216\211\305\2647\3262\305\036\332{\357"
+	.ascii	"\020\224N\271=U\345\224OJ[\bho\001l\347\336C{+\353\226\333{+"
+	.ascii	"\367\336iS\311\2717R\r\263jhh\357\243\rC[I\311\006\264\267%\273"
+	.ascii	"[3b\21291\205`3\"V\265\203\234\312"
+	.string	"\312\024b\332U\333\256\251\251\305\224D\266\320\336\273\362\351*#\030X,vbp\024\204\210\350\250\321\217\026\241M\364\b\013\270 \213\255\263j\310\036\206B\034%\272+\244\204^X\334\001\312\342\250\320\217\266@]`'%NH\234Xl\377\252\206\f\242\332d\224\031\342(\213\030\262\246\035F,\376Pm\362\005]f4\2010\340\026\256\260a\347\327\234Q\342G'\004\375A\225N+H,>\b\250\022\335\327\007\024\240^\bT\211\005\003\"@H\016E\200\360\024\037xnb@\022\223)8\361a8|!\021b8|\3111\022\2218'\211\310\027\210/d\022!xnb@\236\030\032\213I\235b\317\211\3410\003\013+l \005\013\f\207\030\344\030\213'p~\212\017-\030\213\307$\362\270s<\022\217I\244F\221\352\350\364\030\215;\3064y\363\302q\007EF\2214\026\217<\371\002*T`\250\002\t$T"
+	.ascii	"\003\026Ha\205\341p&\311C\304\301\271\311I\236\035\027pv\220"
+	.ascii	"I\"\362\005\231\302\200C<\342\247\370\220D\032wpP\0247D\035\034"
+	.ascii	"\303\3161Er\307\230\032w\212\311\033\234\035\235\341\216\361"
+	.ascii	"x$\016\2075O\361!'\211,\032{2 \"wtp\320\247\370\240\2234\342"
+	.ascii	"\240@\215D\236\024\222\307\233\036\255\243S\001\035\235\035\016"
+	.ascii	"\324\250\220$\"/\200Q\241\002\006D\342\321\204\234\233\f\310"
+	.ascii	"\242\006\310\024E\317\b\372\304\013Q\243\350\031!\347\206xLy"
+	.ascii	"p\222B\2446\022yR\320\271)\036eP\364\214\360\322\202\261\230"
+	.ascii	",\336\200@\205\fxp\222\232H<\232\200$&S0\202\n\026tn\222;,\360"
+	.ascii	"\340$mR"
+	.string	"\220\344y\241\204d\361\005\244\361\346\310\002\022\005\036\234\344\206\034c\t<8I\030\375\301\207\344\361\206\347C\nd\217\216\t<8I\232\247\370\260S\314I\"5\034\217\304\234$2g\200\007')\324\321i\301Xt\001gGg\004\343\316\0062\020\223\305#\b\214\305\026\210#\360\340$e\2109;\032x\031!I\\\201\007'9s\234\234\033\242\n<8\311\3648\305#\321HlA?\004\022\r QBE\372\022&>0\361A~\t\023!B\230 \021B\237D\210\313"
+	.string	"\341\r2M\016\215D\035\027pv\220\302\244\261xQ\020I \362\244\200\205!\013*T`\005\017\310<\305\207\016I$1\211K\310"
+	.ascii	"\n&\340\247\370\220\304\3519&\221 \220D\236\024$A \223\305\023"
+	.ascii	"\016\020\221CD\366\030{\206:\037\223<1"
+	.string	"97\304\343\3141\311#\223,\036c\210\3111\022\207(zN\020\2217'd\210\310\233\023C\236\036\027pnN\fS@aH\223c$\016\2110\334 \207)\2400\214A\036\211.\034o^\030jc\361&\005\3160\357\030\211:E\024\303T\004\262\205\033\035\024\30349Lstv\2060\306\027ztvp\206\307\036\234!\fQ\347\304M\022\206\341\314\361&\005\016F\321s\"y\334I\201\034\n\223\303\024P\030\276\270\200\263\2433D\223\303\020H\240@\2613\034\n\223D$\n\024;\3034\005\024\2060I\030p\2109;8C\235\002\nC\231\233\344M\316\220\230S\214a\370RB\006P0a\230\002\nC\235D\026udP\364\234\030\"\211G\"\361\210b\030\223\034\022UPD\346\02197<\303a&\346\354\2740D\223\303\033$L\nt\212/\334\240\030\032\213\310\227\344\320X\004\221$\032\213I\242Q"
+	.ascii	"ir(D\346cN\316\315\316\221\250\202\241\261\210\324O\361!It\001"
+	.ascii	"g\007\t\002\231\002$\210\036c\013\rP\321c,\3524 \004\022C\022"
+	.ascii	"%T\200 \346\364\350\340\030\213 \216\310\036"
+	.string	"\020\013\030!B\205\036\306$o\2227#D\250\270\221\031\016G\210Pq\223A'G'\307\270C4\356\020k\214E\032\022F\022F\236\343\215qf8\3449\336\030/P\301\243\202g\007Y\214\031\016w\220\305\032\244\021i\204\031\016\215=\303cN\316\215\0138;\310\341\220&\371\024\007h\301X<!D\016\205\311\343\016\017\3161\301HL\"\213::\307\204\244\221X\324\301\321\311\343\016\007xp\222\251\316\316\316\bC4\371\024\037\220G\"\f\305c\016\207\357\360\020\217 \222;;G\0200\307$\0076x\341\346h\202\212#\rr\030\363\201\344q\207\0035D\235\0237,\300\220\217\304\"\212b\322H\314)\276$\207\304\234\035\r$\217;</\304\234\235\027pr\230B\362\270\303#\2034\356\024\223<;)1y\243BN\317\315\tMTAq\005\242\n\212+\350\244\316\271!\236p\214\311\271!\236\220\034\212"
+	.ascii	"A\247x\303\302\221\210\002E\317\b*\2221\307$\007\2100\024\211"
+	.ascii	"8D\0256$\207$B$\215\305\036\355\002\316\315\t\035\235\033\013"
+	.ascii	"\2508\276$\207%\222\306bOzb\0161G\004\n\0229\0372\270\b\"X\240"
+	.ascii	"\203\0076p\001\215\363\201\007'9\324\271)\036\211H\020\031`\001"
+	.ascii	"\205\025@$\211-\034o\222 \214\305\233\027@\340\034\221 >\030"
+	.ascii	"\340\177\312\206\306\315\340\035]\031\255\241Z|JQZjh\024\016"
+	.ascii	"KsPi\026\252\013\222"
+	.string	":14\273#K\213\272\276\263\027\370\331<;3\343rj:\3132\232\325a'\267u\344\212\331DEE\2266\251a\245\241\335\251_DAI\245E\236\032\301T\224L,b\250\320Q\035\237`\032\326\344\254K\211\007\330TL\027\230\337\215\224\bjTe'\227\303\231\357\260\316\266h\r\311z2\234\206\366\314\321\224.{^V\372\216\317l\331\225\265T\035S+\232\270\224{\006MJ\260+M\316\257H\210Vn\356U\375\2608\246onp\313I\342\256EZ\n$ev\325H\262\030\001NVi\226U\212%T\356}\367\276A\245\352\352)V\372C\013\230R\221\364G\337\021.(\213\217AS\247U/8\300\230lY|\fV\350?\245Ja\310\r\031\234\262\370\325\231\372@y\310P\215-\305\365\300Z\260\022\215;\032<r\021(KL\376v\244IS\203I\370,F\2003\205Ju\244P\351\224P\251"
+	.string	"\035_M\376\366Q\f\017\177*\365t*\315AF\245o\210\305\357KsH\221\375Y\2618\215\252MKB:,\276\215\231\276\215S\377\351\023\224\nI\272zX<"
+	.string	"\242\324Fj#mj\223\202\021\254\313\363\221\342x\332\3647\243\013\311\342\224\311V\371\001\202\305\342t\351W*\222TP\236\305\351\r.\315\201J\306S\032\251\2144I\210]\240\025\315\216\261\271\031)\322\323$\240*Y\350,Nk\374\271\345\310\220(\026\247G\351\f,\315\241\b\304\377\264\305S\241\264E\n\343\326\245joAf\300\020qAd\256\350)\214\247/D\214x\236\026\220:\037\213S\243\317\0349A\242g\361\323\346\313\025\224X\020\213S\242\347Y\254<\241=\213\323\241?c\216\246\374\345X>q\202\262\2648u!Dr\003\252\311\342\247euIU\026\337\246G\272|\n\224.S&N\262\367\362\003\347\322n3\225<\320\314\201\t6\203\2362\177\021#:\240\022\374\263\370}\035\210\371p\222fq\272\"\235\"\005\016\314\342\364\007M\202\201\207e\361c\244\232<\301b\361m\222\264\006W"
+	.string	"\237\267"
+	.ascii	"\246\312\n\266\213\"\300\f\264\322\332\314#\017:\216\312\213"
+	.ascii	"\313\342?\335O\225\317\027\241\034q7,\316\203\177\316\370\224"
+	.ascii	"\211"
+	.string	"\225Y\234\005s\027)eSO\2133\227;\226'\266d\361m\200t\240\215Rk\320\206\3459\013\226\254%\211\331|\222f\303\357YKW\325\021)\026\347\276?\341\2368-\361\005j\r\272\252<[\251\222\365Dp\333\n2C,\220\251\345\312\263\036\306bCc\373\312yoZ\203\245'O\362\335\025\214\331\312\032\347\022\357\253j\206I\f \262(\317w\317TR'\247\227\240\305\331.?Q\036J\202+\246\310\220\025\245\271\2608\327e\265\031bQ\272X\234\245\3446\037\241)1\213\377\201\213\324\031\f\213\263\\\206b\345p\374\255\240\233\203a\243R\303\243\313s(\333\223\213(Q\2268mp\261\3709.\305\301\203\352\205\035R\220\026$Z\203 \265_-7\301A1[y\204\357\205\226\213\262*\001\205\377\250\003\322#\202`\272\244(\346\034R\210\020\315\020'\215\001\363\026@0HH \022\006Q\217\017\023"
+	.ascii	"\205\nj\005\211\256\007\251D\"%\022\210\004IR\222B\2461So\275"
+	.ascii	".\265\201em\217\345.\005\003,k\026\315\347Dn\362\373P!\3452\221"
+	.ascii	"\252o9\034\310\316\215\325\254\244?\3056\004`\360J(\031\307\274"
+	.ascii	"|\361\030\312\302{\222\022\220y\013\312\016\256\305[9uv(\313"
+	.ascii	"\362=D\320\301\341\020\247\3741\267\261KTE\233\337b\301',\250"
+	.ascii	"6\203\323\257\f\024\251\346\3614D\2551\301U'\007Vi\355\325\032"
+	.ascii	"\225\263\225\334\234o\256B\305L!*\223AQ\234~\221\235\004\336"
+	.ascii	"\244A\275\246\2160V3\233 8\230\220\341\277\212F\367\024Y\005"
+	.ascii	"/\217\037:\206\037\242\3164\342E\365\n\310\2733j9\002\200\366"
+	.string	"fC,\026\365\321\276\f\021\177\365\017[R\274I\202(W$ps\265\345\254\301\035\235d\362E\315N\2671)\256\325\232!2\276\005\252&\017\344\321\365V\213\214?\220aNa,\263z\b\272\001\314u7\\;\245\373\241\021\016\234\222\275\253\202\020\345M\307\2440o_\020\326\342"
+	.string	"\356\360\3403\373\3460\201\013pq\002k=\303\236\037e\364\272\322\003\035o\375R\342\377j\224\325\375_\332\312M\233\354\247\f\310?\303\024)\035I2BT\330\333\016\270L\362\207\032WR\366\354\025h_"
+	.string	"\351\005\200Z\025[\002'\025\203\003?u\314\222\006\200^\365\206H\300C\345u\275\276w\333\326?\311j\177\220\346\350I\002\321\362\206\335+\337\346\266\2163-\231{\200\313\237\301\007\350\331K\313&i\024\316C\345\3464\nc\2344\002\333\367\241\223\347\005\013;\001\332L&\262]"
+	.string	"\336q>P4\232\271\271\244\313@\207\024\210\004\r\227\024DW(l\360\345N\200\242\270\001h\216\337N9\237aV\260\310}\345\311\217\002\022\004\367U\351\254\255\252\304\262\361\251\017\236\210\017\270\227\261X\314\361\313\323\344\266\313<\255\356\250\341\302\025\306\023\034\305$\363K\314\203B\272\353\345\273b\307\373{Z\211\274\345$\352\314\210\022@LB P3K\247\364\350}\204\233\300]\001\337\350\022\317G\242-\\9\305\210\330c\\!P\036\242)\334\0042Rn\2213-cS\013\300|p\241\212\224\013\326\353\037\205\032*\231\221`\310Y\262\273\216\307va\026\232\325ra\356g|\211\032\362\275\245\035\030\312\006HH_\321\216;\377\313:\243\245\312\371\241q\373y\214\247\022\232(\316\342\023\344\207l\210 \302\277Z\036\245\354\030p'\257 \177\365M\025U\304v\352\267:\231"
+	.ascii	"\007\355\321c"
+	.string	"\250\303\361\200*^:\\c.cn\234{\027?D\257\303\300\007q\310\035\b0\255\"\371+\336\025}\227|\304\225^\257\247I\205\202\002\225;|\0051\tRE\031\343\n>{\032&\204\2770\"\213\233\005\n`\320\037\244\317\302E\255\377\265^:fV\020\303 \252]\215\216=\325\375\336\214\344\222h\t\337\211\311\267\2757^Tb\270\035i_F:\346I\247\215\005\201<V\004\024\253\207M\205\243\347\220\222\346Y\036\244\t6\270\222]\n\b*ZA\001\354.\360\324F\255\314\\\226!\233\213\004i(\244'\322J\232\026\027\231\025V\002\030\341\2139V\243\025#P\276\016\343\023\233\237\247\263G\003\264S\177\bM\363Q\342\300\311\r \302\244(}\030!\026\321#\204\371E\245L\260\344Z\237\350\375A~M\334_9u\343@\251G\t\007\334t\303\277Z\357s\035\024 gP\373\341S\240\246\035\026\236\220"
+	.ascii	"9\026\021\237\177n\354\301Zz\204':\222)D\013\022\262\267\211"
+	.ascii	"\325\267\377\231\376\177$*\023\266X\240\013\002C^p\bt\327\260"
+	.ascii	"`\353\316\330\325\330\224\315\342\254\352\221e`\370\3436\205"
+	.ascii	"J\304\304~hf\326T\362c@\211j`\314\226c\265\374\024\353e\240\213"
+	.ascii	"\032\237\244\357\272$\3735-|\271l\377\341\b\226\277\241\275\023"
+	.ascii	"\233T\207@\246\305-a|\253\275\246\024_\231\005\345\260\216\205"
+	.ascii	"\223&\257\266\215\254\347/\232F\362\377\3763\f\272n\256I\035"
+	.ascii	">\364H|\241\031n\006(`F\236R1\027\254X\002`\213\32080\322|\223"
+	.ascii	"\2124}\233\"\007ZQ\367!0\327\203o\207\311\016\204G\356F\367\355"
+	.ascii	"HT\266\002\210\265\033\234A\221\377\223\016\215\263\301\313\321"
+	.ascii	"\257\337\201\337\214\374\225\302\277N\326\235\237`\257\327\332"
+	.ascii	"\300e=rb\375\240\372\354\214\215lz#:]\373\311f\354X{\260VO\004"
+	.ascii	")\261\225\347}~9\301j\017J\200\206\004k*'\322\200N\fzg7B\374"
+	.ascii	"\264\361\004\\!\301\207\231)C\341\365\332Okn\324]\221O\234\233"
+	.ascii	"{\250J\333j\253\227\251\023\033\343\350\023?\"\023\256!\355\264"
+	.ascii	"\364\2135\3664\311\302z\374i4\b\377\362!r\235\013\326\023\320"
+	.ascii	"\024{8d\2765:n\001\374\226\001\030\021W\240\024\365Yf\270\007"
+	.ascii	"\024\352Q\256\004\221r\361#\001\\\022\233Q\262\321\304\230*6"
+	.ascii	"n\257W\346\"\030\t#\220\277yn\376\361\274\2076\004"
+	.string	"\331Ox\272%\253k\361\023 U\362/\366@\001\355e\2330\223\214\345\030\365\226\323<\034\235Fn\222\264c\202\177\214\350(Oh\f\355\034\232O\254\035\266\270\036\325\226\035u\bm\375dkb\037\r\242:2\346k%\226\004)\207\261\201\003g\201t\257\332v\f\334[\244\241\265t\020q$\342\234\345V\272\265\261!$\250\374oY\332\374\220K\t\370\\\3533x$pm\326z\245\314_V\214\346N\334[\302\371a\373Y\356\313Hu\267V\372\234\250\313h\355u\371t\377\305\347\265\226h\230K.p\254\016\332j\003\341/\322\251?\270\210\b\017\231fl\313\034E1d\244\024\226]\362\301\036\363&\262bQu\260\206\027\362\311\357\017)N\207\200\332\305\334aS\002'F\247\371\276\330\0344Y\255>\311\374\376;\371\356ouh\353\214\316?H[\313_P\310J\316&\373>Wf\303\340(\003\375x\375"
+	.string	"\026u\350\377\2472s\t\245@^\312\026\251\023\332\205\344\326z=\022\310[G\017;|\255\027\342\332\357\256L\002!\303\314B\316ev\250\2024W\332\247\372\017\2609c;\246n\323\032\200\007\353\006?g]\270PP\211\177\235\023(4DDT>e\237^\204\220\032\245\221S\273X\276"
+	.ascii	"\222gl\223{\216\016\326\016A*\313\361\360\315SM6OK\301\232\200"
+	.ascii	"\3001\300\304O'\027I\334\321Sd\270RK?A\030\n5?\203\215\366_\214"
+	.ascii	"l\021\310nC\372\342\317$>f\264\345#8\206\360\314i\234\326\003"
+	.ascii	"\302\330V\210\373`\021$\250\325P\2342\300v\220HL\311\214\243"
+	.ascii	"3\274\236Y7(*\322\271\266\177ve\202\276\037\240\222\234\030\t"
+	.ascii	"z.>\210\246X\006d\240\324\253/\242\334\f\240^\351\031\365\374"
+	.ascii	"?c\357 @\203tab~#\322p\351hU\355\203~\203\301\311\232u\204t$"
+	.ascii	"A\017`\020\034\210\327\236\251(\244\302\255\313\1771 \301\314"
+	.ascii	"\261\244~\023t\r\330\224\255#\025\245\204L\303\343m\322H\013"
+	.ascii	"\304\261%\362\303\340\323\300\304\373\230\004\220cZL-V@N\302"
+	.ascii	"\025&\024\326$r-\273\001C\355\333G\233sJ\317\f\306|\221\t\305"
+	.ascii	"\254~3A>A\250fK .e\203,\n\204\002\201f\375 \313\376\017/R\210"
+	.ascii	"\314\242\016o,\007\201E\371\376\203\212\223\302\262`\242j\201"
+	.ascii	"*\337\301qTM5C6t9\020d#\234\227\353)4IR{\366\241\217(\276\206"
+	.ascii	"\212\215\331^$Th\277\213\230\322\303\361\367\252M\n\257\001\220"
+	.ascii	"\235!\366wP*H\031u[~\333\230\232\275I\353 \204\271\013`\033\231"
+	.ascii	"\221\n{\343\260\227\007\237K\370\0028\0217\336Y\017\027(nV\350"
+	.ascii	"\2717\257\361s^\311b\300,L\342\f8\362\206\337H\006\312\021\236"
+	.ascii	"\232\376\006\t\256\355W\006\0304N\247\307\t\237p_\321\365\243"
+	.ascii	"z\257nD\020\321\376c%\320\001\343\2579H\221E=\321L\322\255\241"
+	.ascii	"(:p>L \231\207\200\375\224I\321\275\357\270'\223k1bM3W\320\250"
+	.ascii	"\372\366\353\201\227\322\f\034\356\007\375\346q\252z\352's\213"
+	.ascii	"/B\355"
+	.string	"\363@j\006\201~\007\306\375\347\213\277\203\357i\341\022q\3657|\375\203\035\235<\001\327\202>\202\273\342\321y\343\036\344\222$\340x\313\212\300\221\330\205\203\215\353\304\177\201\013I\300\347-\024\201\343b\202"
+	.string	",\376a\0012\352]\324ps\316i\r\021\tn/p'>\342\257\205SY\344Q\024\310\342\235\366\200\337\034\372\027\204c\204d\217\rj"
+	.string	"z\b\247\261\005\352Eu^\204 (FD\235_Z+M*!\362\210\352\244O\207\223)6^X\252\327\231"
+	.string	"\005\304\352[yD\f\350\334\237\210\243\023y\274\25698\037U\025]\233\003\"\263\300\210<w\n\346\205\215,\203L\255\363sb\336J\352\25101\305\365Wp\351J[\276\331\330%#\b\233\027\021\264jus\274\337 \232\246\374\237\004\211\210\002R\371\270\f\240\361\033\357\271\256\022c\310\247E\027\3301\036N`E\260\r\316K\302K\023&\315\031\360\202>4\232\327N\356\037\340\275NO\034\035\t\324#T8\325\245\004\307\257\2421\325\005Lxa\222\005\021\027\327\001+\252\250\331\256\fR\033\362\035\221\210\f_\023\341\261,S\320\370v\263\377?Y\211\261P4X\244B\365\303\322\013R\005>\200m\034\265\201U\372\222\241\362\200cB\360\310$5\\\314\016WY\005\300\250\0369\335D\017\361\275\332"
+	.string	"\276\036\200\031=\031\306\241\236\207w\023\323oI\270\231\264\345*\006\356t\223\304}P{6\237\226\232\362Jr\256\233\232V\214<!mP\231\245D\016mn\003}7\035m}\216$9c\347\023s>W\024f6\362\017U\373\n\036V\200Y\373\315\332\374\302S\262\317\344\316X\314!\301-\025\262.M\374\261\341a}^3\032-\312\\\003\3501\342W\365:\024\340^4k\003\244'E\333\224\374\224\\\027FZZd\277\220\357\353\f\301\027\306\033\2629%`'\276S\303w\242{\024\331p\n\023I\213\020\214!6i}\037\211fH\350\024[L\007\355a\243\232\233\343gB\314\023^\240<he\204-o9\246u{"
+	.string	"\207\027\231?\300\351\313\324\033\3357AZ\234}0&2Xj\357\322\335D\256\346\354)\333\372\361\032\303\337\210\222\253\342?I\346\234U\300\353\236\340\372.\007\034\270\031\361\244\334o\217\361\277\211\361<\340\f\200t\356|KRuE\2306\253j\345Q\327 \273M\226\376#X\244\335\216\033\235\275\311\033\337\206\316\034\b\264\242\300\315\361\003\235\360\277\300w\n\221\261"
+	.ascii	"?F\036\030\034R\317\007\376\202\2553\2669]\276T:\370>\021g\224"
+	.ascii	"\177S\277O#\247\323\002\233\252+"
+	.text
+	.section	.gnu.lto_.symtab.275a9e85f5f6f1f5,"e",@progbits
+	.string	"tcpSerialOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\002"
+	.string	""
+	.string	"tcpSerialPollAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"uartOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"fcntl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"close"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"__errno_location"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"recv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"setsockopt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"accept"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"strerror"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"listen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\003"
+	.string	""
+	.string	"bind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"socket"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"send"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.275a9e85f5f6f1f5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,16647 @@
+	.file	"target.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/include/stdint.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.file 7 "/usr/include/stdio.h"
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.file 11 "./src/main/target/SITL/target.h"
+	.file 12 "./src/main/drivers/io_types.h"
+	.file 13 "./src/main/drivers/resource.h"
+	.file 14 "./src/main/drivers/light_led.h"
+	.file 15 "./src/main/drivers/timer.h"
+	.file 16 "./src/main/drivers/pwm_output.h"
+	.file 17 "./src/main/common/time.h"
+	.file 18 "./src/main/drivers/system.h"
+	.file 19 "./src/main/target/SITL/target.c"
+	.file 20 "./src/main/target/SITL/sitl_physics.h"
+	.file 21 "/usr/include/stdlib.h"
+	.file 22 "/usr/include/unistd.h"
+	.file 23 "/usr/include/string.h"
+	.file 24 "./src/main/target/SITL/serial_tcp.h"
+	.file 25 "/usr/include/time.h"
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	target.c.1c8b1e67
+	.weak	target.c.1c8b1e67
+target.c.1c8b1e67:
+	.long	0xbb1
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x21
+	.long	.LASF2351
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2131
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2132
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2133
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2134
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2135
+	.uleb128 0x4
+	.long	.LASF2137
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2136
+	.uleb128 0x4
+	.long	.LASF2138
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF2139
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2140
+	.uleb128 0x4
+	.long	.LASF2141
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x4
+	.long	.LASF2142
+	.byte	0x1
+	.byte	0x98
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x4
+	.long	.LASF2143
+	.byte	0x1
+	.byte	0x99
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x4
+	.long	.LASF2144
+	.byte	0x1
+	.byte	0xa0
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x4
+	.long	.LASF2145
+	.byte	0x1
+	.byte	0xa9
+	.byte	0xd
+	.long	0x64
+	.uleb128 0x23
+	.byte	0x8
+	.uleb128 0xc
+	.long	0xba
+	.uleb128 0x4
+	.long	.LASF2146
+	.byte	0x1
+	.byte	0xc5
+	.byte	0x12
+	.long	0x77
+	.uleb128 0x5
+	.long	0xd7
+	.uleb128 0xc
+	.long	0xcd
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2147
+	.uleb128 0xd
+	.long	0xd7
+	.uleb128 0x4
+	.long	.LASF2148
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x4
+	.long	.LASF2149
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x4
+	.long	.LASF2150
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x4
+	.long	.LASF2151
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x4
+	.long	.LASF2152
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xd
+	.long	0x113
+	.uleb128 0x4
+	.long	.LASF2153
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xd
+	.long	0x124
+	.uleb128 0x12
+	.long	.LASF2192
+	.byte	0xd8
+	.byte	0x5
+	.byte	0x31
+	.byte	0x8
+	.long	0x2bc
+	.uleb128 0x2
+	.long	.LASF2154
+	.byte	0x5
+	.byte	0x33
+	.byte	0x7
+	.long	0x64
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2155
+	.byte	0x5
+	.byte	0x36
+	.byte	0x9
+	.long	0xcd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2156
+	.byte	0x5
+	.byte	0x37
+	.byte	0x9
+	.long	0xcd
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2157
+	.byte	0x5
+	.byte	0x38
+	.byte	0x9
+	.long	0xcd
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2158
+	.byte	0x5
+	.byte	0x39
+	.byte	0x9
+	.long	0xcd
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2159
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x9
+	.long	0xcd
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2160
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x9
+	.long	0xcd
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2161
+	.byte	0x5
+	.byte	0x3c
+	.byte	0x9
+	.long	0xcd
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2162
+	.byte	0x5
+	.byte	0x3d
+	.byte	0x9
+	.long	0xcd
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2163
+	.byte	0x5
+	.byte	0x40
+	.byte	0x9
+	.long	0xcd
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2164
+	.byte	0x5
+	.byte	0x41
+	.byte	0x9
+	.long	0xcd
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2165
+	.byte	0x5
+	.byte	0x42
+	.byte	0x9
+	.long	0xcd
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2166
+	.byte	0x5
+	.byte	0x44
+	.byte	0x16
+	.long	0x2d5
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2167
+	.byte	0x5
+	.byte	0x46
+	.byte	0x14
+	.long	0x2da
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF2168
+	.byte	0x5
+	.byte	0x48
+	.byte	0x7
+	.long	0x64
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF2169
+	.byte	0x5
+	.byte	0x49
+	.byte	0x7
+	.long	0x64
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF2170
+	.byte	0x5
+	.byte	0x4a
+	.byte	0xb
+	.long	0x8a
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF2171
+	.byte	0x5
+	.byte	0x4d
+	.byte	0x12
+	.long	0x29
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF2172
+	.byte	0x5
+	.byte	0x4e
+	.byte	0xf
+	.long	0x3e
+	.byte	0x82
+	.uleb128 0x2
+	.long	.LASF2173
+	.byte	0x5
+	.byte	0x4f
+	.byte	0x8
+	.long	0x2df
+	.byte	0x83
+	.uleb128 0x2
+	.long	.LASF2174
+	.byte	0x5
+	.byte	0x51
+	.byte	0xf
+	.long	0x2ef
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF2175
+	.byte	0x5
+	.byte	0x59
+	.byte	0xd
+	.long	0x96
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF2176
+	.byte	0x5
+	.byte	0x5b
+	.byte	0x17
+	.long	0x2f9
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF2177
+	.byte	0x5
+	.byte	0x5c
+	.byte	0x19
+	.long	0x303
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF2178
+	.byte	0x5
+	.byte	0x5d
+	.byte	0x14
+	.long	0x2da
+	.byte	0xa8
+	.uleb128 0x2
+	.long	.LASF2179
+	.byte	0x5
+	.byte	0x5e
+	.byte	0x9
+	.long	0xba
+	.byte	0xb0
+	.uleb128 0x2
+	.long	.LASF2180
+	.byte	0x5
+	.byte	0x5f
+	.byte	0xa
+	.long	0x124
+	.byte	0xb8
+	.uleb128 0x2
+	.long	.LASF2181
+	.byte	0x5
+	.byte	0x60
+	.byte	0x7
+	.long	0x64
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF2182
+	.byte	0x5
+	.byte	0x62
+	.byte	0x8
+	.long	0x308
+	.byte	0xc4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2183
+	.byte	0x6
+	.byte	0x7
+	.byte	0x19
+	.long	0x135
+	.uleb128 0x24
+	.long	.LASF2352
+	.byte	0x5
+	.byte	0x2b
+	.byte	0xe
+	.uleb128 0x14
+	.long	.LASF2184
+	.uleb128 0x5
+	.long	0x2d0
+	.uleb128 0x5
+	.long	0x135
+	.uleb128 0xe
+	.long	0xd7
+	.long	0x2ef
+	.uleb128 0x10
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x2c8
+	.uleb128 0x14
+	.long	.LASF2185
+	.uleb128 0x5
+	.long	0x2f4
+	.uleb128 0x14
+	.long	.LASF2186
+	.uleb128 0x5
+	.long	0x2fe
+	.uleb128 0xe
+	.long	0xd7
+	.long	0x318
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	0xde
+	.uleb128 0xc
+	.long	0x318
+	.uleb128 0x5
+	.long	0x2bc
+	.uleb128 0xc
+	.long	0x322
+	.uleb128 0x15
+	.long	.LASF2187
+	.byte	0x7
+	.byte	0x90
+	.byte	0xe
+	.long	0x322
+	.uleb128 0x15
+	.long	.LASF2188
+	.byte	0x7
+	.byte	0x91
+	.byte	0xe
+	.long	0x322
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2189
+	.uleb128 0x4
+	.long	.LASF2190
+	.byte	0x8
+	.byte	0x7
+	.byte	0x15
+	.long	0xae
+	.uleb128 0x4
+	.long	.LASF2191
+	.byte	0x9
+	.byte	0xa
+	.byte	0x12
+	.long	0xa2
+	.uleb128 0x12
+	.long	.LASF2193
+	.byte	0x10
+	.byte	0xa
+	.byte	0xb
+	.byte	0x8
+	.long	0x38b
+	.uleb128 0x2
+	.long	.LASF2194
+	.byte	0xa
+	.byte	0x10
+	.byte	0xc
+	.long	0xa2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2195
+	.byte	0xa
+	.byte	0x15
+	.byte	0x15
+	.long	0xc1
+	.byte	0x8
+	.byte	0
+	.uleb128 0xd
+	.long	0x363
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2196
+	.uleb128 0x5
+	.long	0x3a1
+	.uleb128 0xc
+	.long	0x397
+	.uleb128 0x25
+	.uleb128 0x5
+	.long	0xcd
+	.uleb128 0xc
+	.long	0x3a2
+	.uleb128 0x1a
+	.byte	0x8
+	.byte	0xb
+	.byte	0x80
+	.long	0x3c2
+	.uleb128 0x2
+	.long	.LASF2197
+	.byte	0xb
+	.byte	0x81
+	.byte	0xb
+	.long	0xba
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2198
+	.byte	0xb
+	.byte	0x82
+	.byte	0x3
+	.long	0x3ac
+	.uleb128 0x16
+	.long	0x30
+	.byte	0xb
+	.byte	0xa6
+	.long	0x3f8
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2203
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2204
+	.byte	0xb
+	.byte	0xac
+	.byte	0x3
+	.long	0x3ce
+	.uleb128 0x15
+	.long	.LASF2205
+	.byte	0xb
+	.byte	0xb1
+	.byte	0x11
+	.long	0xfb
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2206
+	.uleb128 0x4
+	.long	.LASF2207
+	.byte	0xc
+	.byte	0x18
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0x4
+	.long	.LASF2208
+	.byte	0xc
+	.byte	0x19
+	.byte	0xf
+	.long	0xba
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2209
+	.uleb128 0x16
+	.long	0x30
+	.byte	0xd
+	.byte	0x14
+	.long	0x55c
+	.uleb128 0x1
+	.long	.LASF2210
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2211
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2212
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2213
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2214
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2216
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2217
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2222
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2223
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2224
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2225
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2226
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2230
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2231
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2242
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2245
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x5
+	.long	0xe3
+	.uleb128 0x12
+	.long	.LASF2257
+	.byte	0x4
+	.byte	0xe
+	.byte	0x19
+	.byte	0x10
+	.long	0x589
+	.uleb128 0x2
+	.long	.LASF2258
+	.byte	0xe
+	.byte	0x1a
+	.byte	0xd
+	.long	0x589
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2259
+	.byte	0xe
+	.byte	0x1b
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.byte	0
+	.uleb128 0xe
+	.long	0x417
+	.long	0x599
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2260
+	.byte	0xe
+	.byte	0x1c
+	.byte	0x3
+	.long	0x561
+	.uleb128 0xd
+	.long	0x599
+	.uleb128 0x4
+	.long	.LASF2261
+	.byte	0xf
+	.byte	0x31
+	.byte	0x12
+	.long	0xfb
+	.uleb128 0x26
+	.long	0x5aa
+	.uleb128 0x5
+	.long	0x3c2
+	.uleb128 0x1a
+	.byte	0x20
+	.byte	0x10
+	.byte	0x84
+	.long	0x613
+	.uleb128 0x17
+	.string	"ccr"
+	.byte	0x85
+	.byte	0x18
+	.long	0x613
+	.byte	0
+	.uleb128 0x17
+	.string	"tim"
+	.byte	0x86
+	.byte	0x12
+	.long	0x5bb
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2262
+	.byte	0x10
+	.byte	0x87
+	.byte	0x9
+	.long	0x42f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2263
+	.byte	0x10
+	.byte	0x88
+	.byte	0xe
+	.long	0xef
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2264
+	.byte	0x10
+	.byte	0x89
+	.byte	0x9
+	.long	0x42f
+	.byte	0x14
+	.uleb128 0x17
+	.string	"io"
+	.byte	0x8a
+	.byte	0xa
+	.long	0x423
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	0x5b6
+	.uleb128 0x4
+	.long	.LASF2265
+	.byte	0x10
+	.byte	0x8b
+	.byte	0x3
+	.long	0x5c0
+	.uleb128 0x12
+	.long	.LASF2266
+	.byte	0x12
+	.byte	0x10
+	.byte	0x8d
+	.byte	0x10
+	.long	0x680
+	.uleb128 0x2
+	.long	.LASF2267
+	.byte	0x10
+	.byte	0x8e
+	.byte	0xe
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2268
+	.byte	0x10
+	.byte	0x8f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2269
+	.byte	0x10
+	.byte	0x90
+	.byte	0xd
+	.long	0xe3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2270
+	.byte	0x10
+	.byte	0x91
+	.byte	0xd
+	.long	0xe3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2271
+	.byte	0x10
+	.byte	0x92
+	.byte	0xd
+	.long	0xe3
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2272
+	.byte	0x10
+	.byte	0x93
+	.byte	0xd
+	.long	0x680
+	.byte	0x6
+	.byte	0
+	.uleb128 0xe
+	.long	0x417
+	.long	0x690
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2273
+	.byte	0x10
+	.byte	0x94
+	.byte	0x3
+	.long	0x624
+	.uleb128 0xd
+	.long	0x690
+	.uleb128 0x4
+	.long	.LASF2274
+	.byte	0x11
+	.byte	0x21
+	.byte	0x12
+	.long	0xfb
+	.uleb128 0x16
+	.long	0x30
+	.byte	0x12
+	.byte	0x1f
+	.long	0x6e3
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2282
+	.byte	0x12
+	.byte	0x27
+	.byte	0x3
+	.long	0x6ad
+	.uleb128 0x27
+	.long	0x404
+	.byte	0x13
+	.byte	0x35
+	.byte	0xa
+	.uleb128 0xe
+	.long	0xe3
+	.long	0x708
+	.uleb128 0x28
+	.long	0x37
+	.value	0x7fff
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2283
+	.byte	0x13
+	.byte	0x37
+	.byte	0x9
+	.long	0x6f7
+	.byte	0x4
+	.uleb128 0xb
+	.long	.LASF2284
+	.byte	0x39
+	.byte	0x18
+	.long	0x363
+	.uleb128 0xb
+	.long	.LASF2285
+	.byte	0x3a
+	.byte	0xf
+	.long	0x72b
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2286
+	.uleb128 0xe
+	.long	0x618
+	.long	0x742
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2287
+	.byte	0xc0
+	.byte	0x18
+	.long	0x732
+	.uleb128 0xb
+	.long	.LASF2288
+	.byte	0xc1
+	.byte	0x10
+	.long	0xe3
+	.uleb128 0xb
+	.long	.LASF2289
+	.byte	0xc2
+	.byte	0xc
+	.long	0x42f
+	.uleb128 0x1b
+	.long	.LASF2301
+	.byte	0x18
+	.byte	0x2a
+	.uleb128 0x1c
+	.long	.LASF2290
+	.byte	0x1a
+	.long	0x77a
+	.uleb128 0x3
+	.long	0x6a1
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2291
+	.byte	0x19
+	.long	0x78f
+	.uleb128 0x3
+	.long	0xe3
+	.uleb128 0x3
+	.long	0xef
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2292
+	.byte	0x7
+	.value	0x2a9
+	.byte	0xf
+	.long	0x124
+	.long	0x7b5
+	.uleb128 0x3
+	.long	0x39c
+	.uleb128 0x3
+	.long	0x124
+	.uleb128 0x3
+	.long	0x124
+	.uleb128 0x3
+	.long	0x327
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2293
+	.byte	0x7
+	.value	0x15e
+	.byte	0xc
+	.long	0x64
+	.long	0x7d2
+	.uleb128 0x3
+	.long	0x327
+	.uleb128 0x3
+	.long	0x31d
+	.uleb128 0x18
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2294
+	.byte	0x15
+	.value	0x27d
+	.byte	0xd
+	.long	0x7e5
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2295
+	.byte	0x16
+	.value	0x252
+	.byte	0xc
+	.long	0x64
+	.long	0x802
+	.uleb128 0x3
+	.long	0x318
+	.uleb128 0x3
+	.long	0x318
+	.uleb128 0x18
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2296
+	.byte	0x7
+	.byte	0xb2
+	.byte	0xc
+	.long	0x64
+	.long	0x818
+	.uleb128 0x3
+	.long	0x322
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2297
+	.byte	0x7
+	.value	0x2a3
+	.byte	0xf
+	.long	0x124
+	.long	0x83e
+	.uleb128 0x3
+	.long	0xbc
+	.uleb128 0x3
+	.long	0x124
+	.uleb128 0x3
+	.long	0x124
+	.uleb128 0x3
+	.long	0x327
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2298
+	.byte	0x7
+	.value	0x102
+	.byte	0xe
+	.long	0x322
+	.long	0x85a
+	.uleb128 0x3
+	.long	0x31d
+	.uleb128 0x3
+	.long	0x31d
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2299
+	.byte	0x17
+	.byte	0x3d
+	.byte	0xe
+	.long	0xba
+	.long	0x87a
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x124
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2300
+	.byte	0x15
+	.byte	0x76
+	.byte	0xf
+	.long	0x72b
+	.long	0x895
+	.uleb128 0x3
+	.long	0x31d
+	.uleb128 0x3
+	.long	0x3a7
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2302
+	.byte	0x14
+	.byte	0x18
+	.uleb128 0x8
+	.long	.LASF2303
+	.byte	0x7
+	.value	0x14c
+	.byte	0xc
+	.long	0x64
+	.long	0x8c2
+	.uleb128 0x3
+	.long	0x327
+	.uleb128 0x3
+	.long	0xd2
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x124
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2304
+	.byte	0x7
+	.value	0x164
+	.byte	0xc
+	.long	0x64
+	.long	0x8da
+	.uleb128 0x3
+	.long	0x318
+	.uleb128 0x18
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2305
+	.byte	0x15
+	.value	0x28e
+	.byte	0xe
+	.long	0xcd
+	.long	0x8f1
+	.uleb128 0x3
+	.long	0x318
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2306
+	.byte	0x19
+	.value	0x119
+	.byte	0xc
+	.long	0x64
+	.long	0x90d
+	.uleb128 0x3
+	.long	0x90d
+	.uleb128 0x3
+	.long	0x912
+	.byte	0
+	.uleb128 0x5
+	.long	0x38b
+	.uleb128 0x5
+	.long	0x363
+	.uleb128 0x8
+	.long	.LASF2307
+	.byte	0x19
+	.value	0x120
+	.byte	0xc
+	.long	0x64
+	.long	0x933
+	.uleb128 0x3
+	.long	0x34b
+	.uleb128 0x3
+	.long	0x912
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2308
+	.value	0x10f
+	.long	0xfb
+	.uleb128 0x1d
+	.long	.LASF2309
+	.value	0x10a
+	.long	0xfb
+	.uleb128 0x2b
+	.long	.LASF2310
+	.byte	0x13
+	.value	0x104
+	.byte	0xa
+	.long	0xef
+	.long	0x968
+	.uleb128 0x2c
+	.long	.LASF2313
+	.byte	0x13
+	.value	0x104
+	.byte	0x20
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2311
+	.byte	0x13
+	.value	0x100
+	.byte	0x6
+	.uleb128 0xf
+	.long	.LASF2312
+	.byte	0xfc
+	.uleb128 0x9
+	.long	.LASF2318
+	.byte	0xf7
+	.long	0x98e
+	.uleb128 0x7
+	.long	.LASF2314
+	.byte	0x13
+	.byte	0xf7
+	.byte	0x27
+	.long	0x98e
+	.byte	0
+	.uleb128 0x5
+	.long	0x5a5
+	.uleb128 0xf
+	.long	.LASF2315
+	.byte	0xf3
+	.uleb128 0x11
+	.long	.LASF2316
+	.byte	0xec
+	.byte	0x5
+	.long	0x42f
+	.uleb128 0x11
+	.long	.LASF2317
+	.byte	0xe7
+	.byte	0x12
+	.long	0x9af
+	.uleb128 0x5
+	.long	0x618
+	.uleb128 0x9
+	.long	.LASF2319
+	.byte	0xe0
+	.long	0x9cb
+	.uleb128 0x7
+	.long	.LASF2320
+	.byte	0x13
+	.byte	0xe0
+	.byte	0x25
+	.long	0xe3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2321
+	.byte	0xd7
+	.long	0x9ed
+	.uleb128 0x7
+	.long	.LASF2320
+	.byte	0x13
+	.byte	0xd7
+	.byte	0x2c
+	.long	0xe3
+	.uleb128 0x13
+	.uleb128 0xa
+	.string	"i"
+	.byte	0xdb
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2322
+	.byte	0xd0
+	.long	0xa10
+	.uleb128 0x7
+	.long	.LASF2323
+	.byte	0x13
+	.byte	0xd0
+	.byte	0x1c
+	.long	0xe3
+	.uleb128 0x7
+	.long	.LASF2324
+	.byte	0x13
+	.byte	0xd0
+	.byte	0x2c
+	.long	0xef
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2325
+	.byte	0xc4
+	.long	0xa4a
+	.uleb128 0x7
+	.long	.LASF2326
+	.byte	0x13
+	.byte	0xc4
+	.byte	0x2b
+	.long	0xa4a
+	.uleb128 0x7
+	.long	.LASF2327
+	.byte	0x13
+	.byte	0xc4
+	.byte	0x41
+	.long	0xef
+	.uleb128 0x7
+	.long	.LASF2320
+	.byte	0x13
+	.byte	0xc4
+	.byte	0x54
+	.long	0xe3
+	.uleb128 0x13
+	.uleb128 0xa
+	.string	"i"
+	.byte	0xca
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x69c
+	.uleb128 0x1e
+	.long	.LASF2328
+	.byte	0xb0
+	.long	0x3f8
+	.long	0xa8c
+	.uleb128 0x7
+	.long	.LASF2329
+	.byte	0x13
+	.byte	0xb0
+	.byte	0x2a
+	.long	0x113
+	.uleb128 0x7
+	.long	.LASF2330
+	.byte	0x13
+	.byte	0xb0
+	.byte	0x39
+	.long	0xfb
+	.uleb128 0xa
+	.string	"dst"
+	.byte	0xb7
+	.byte	0xe
+	.long	0x55c
+	.uleb128 0x13
+	.uleb128 0xa
+	.string	"i"
+	.byte	0xb8
+	.byte	0x13
+	.long	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2331
+	.byte	0xa6
+	.long	0x3f8
+	.long	0xab2
+	.uleb128 0x7
+	.long	.LASF2332
+	.byte	0x13
+	.byte	0xa6
+	.byte	0x28
+	.long	0x113
+	.uleb128 0xb
+	.long	.LASF2333
+	.byte	0xab
+	.byte	0x15
+	.long	0x11f
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2334
+	.byte	0xa1
+	.uleb128 0xf
+	.long	.LASF2335
+	.byte	0x9d
+	.uleb128 0x9
+	.long	.LASF2336
+	.byte	0x95
+	.long	0xad5
+	.uleb128 0x7
+	.long	.LASF2337
+	.byte	0x13
+	.byte	0x95
+	.byte	0x20
+	.long	0x6e3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2338
+	.byte	0x8f
+	.uleb128 0xf
+	.long	.LASF2339
+	.byte	0x87
+	.uleb128 0x9
+	.long	.LASF2340
+	.byte	0x76
+	.long	0xaf7
+	.uleb128 0xb
+	.long	.LASF2341
+	.byte	0x7a
+	.byte	0x11
+	.long	0x318
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2342
+	.byte	0x6b
+	.long	0xb0b
+	.uleb128 0xa
+	.string	"f"
+	.byte	0x6d
+	.byte	0xb
+	.long	0x322
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2343
+	.byte	0x60
+	.long	0xb2a
+	.uleb128 0xa
+	.string	"f"
+	.byte	0x63
+	.byte	0xb
+	.long	0x322
+	.uleb128 0x13
+	.uleb128 0xa
+	.string	"n"
+	.byte	0x65
+	.byte	0x16
+	.long	0x130
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2344
+	.byte	0x5b
+	.long	0xb3f
+	.uleb128 0x20
+	.string	"ms"
+	.byte	0x5b
+	.byte	0x15
+	.long	0xfb
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2345
+	.byte	0x52
+	.long	0xb5e
+	.uleb128 0x20
+	.string	"us"
+	.byte	0x52
+	.byte	0x21
+	.long	0xfb
+	.uleb128 0xa
+	.string	"ts"
+	.byte	0x54
+	.byte	0x1b
+	.long	0x38b
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2346
+	.byte	0x4d
+	.byte	0xa
+	.long	0xfb
+	.uleb128 0x11
+	.long	.LASF2347
+	.byte	0x48
+	.byte	0xa
+	.long	0xfb
+	.uleb128 0x11
+	.long	.LASF2348
+	.byte	0x43
+	.byte	0xa
+	.long	0xfb
+	.uleb128 0x2e
+	.long	.LASF2353
+	.byte	0x13
+	.byte	0x3c
+	.byte	0x11
+	.long	0x107
+	.long	0xb9b
+	.uleb128 0xa
+	.string	"now"
+	.byte	0x3e
+	.byte	0x15
+	.long	0x363
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2349
+	.byte	0x1a
+	.byte	0x19
+	.byte	0x2a
+	.long	0x72b
+	.uleb128 0x7
+	.long	.LASF2350
+	.byte	0x1a
+	.byte	0x19
+	.byte	0x3c
+	.long	0x318
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x87
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 27 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 28 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 31 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 32 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x20
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 37 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x25
+	.file 38 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF788
+	.file 43 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF791
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF792
+	.byte	0x4
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF793
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF794
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF795
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/cookie_io_functions_t.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF804
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF844
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF890
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x111
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF925
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF926
+	.byte	0x4
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF941
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF942
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF943
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF946
+	.file 60 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF947
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF964
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF977
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF982
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF985
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF986
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1002
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1003
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1004
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1016
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1023
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1024
+	.byte	0x4
+	.byte	0x4
+	.file 76 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1028
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x4d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.file 78 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/time.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/timex.h"
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1090
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1091
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h"
+	.byte	0x3
+	.uleb128 0xca
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/environments.h"
+	.byte	0x3
+	.uleb128 0xce
+	.uleb128 0x54
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x3
+	.uleb128 0xe2
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/confname.h"
+	.byte	0x3
+	.uleb128 0x276
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h"
+	.byte	0x3
+	.uleb128 0x387
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1502
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1503
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h"
+	.byte	0x3
+	.uleb128 0x4c2
+	.uleb128 0x58
+	.file 89 "/usr/include/linux/close_range.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 90 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x5a
+	.file 91 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 92 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x5c
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1649
+	.byte	0x4
+	.byte	0x4
+	.file 93 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 94 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x5e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 95 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x5f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x4
+	.file 96 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x60
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.file 97 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.file 98 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xe
+	.file 99 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x63
+	.file 100 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.file 101 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x65
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.file 102 "./src/main/drivers/stack_check.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x66
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2125
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x18
+	.file 103 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x67
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2126
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2130
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF803
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.53.90a05048924955a6e2e77b4203beef80,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.86760ef34d2b7513aac6ce30cb73c6f8,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.138.ba977b5ae4e90303e95ec5db0bd05792,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF836
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF843
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF865
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.2a7f4947d4b7296e7e393bf9a618c3c1,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF911
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.fc9d051d38577d71bf2818359e56065c,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.af7f911dde3e35bc76811e3bbb474dfc,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.135.9eeb6b52c2522ad7aff16ad95342972e,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF951
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF953
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF976
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF981
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF984
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.52.4f882364bb7424384ae71496b52638dc,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF997
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1001
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1015
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1027
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1031
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.23.18ede267f3a48794bef4705df80339de,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.24.2a1e1114b014e13763222c5cd6400760,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1047
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.timex.h.19.68c3118fc57dd4af71155e57fb45153a,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1089
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.65.ad8b7cdf304665ee800a89090a0d61aa,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1093
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.23.e34f3a5c100123d9385c8b91a86a6783,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1110
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix_opt.h.20.21a42956ee7763f6aa309b86c7756272,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1172
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.environments.h.56.c5802092ccc191baeb41f8d355bb878f,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1184
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.210.b40c6c15db1d0b653f8dce03f258da9c,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.275.8c3a605c341d0c36506fbf05c049c0e7,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1195
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.confname.h.27.257966e7e49af2ab4cb41132b3606cbf,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1501
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.unistd.h.1108.729b1758ee4d2c0bf366f42e3df16551,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x457
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1508
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.close_range.h.3.4d88cbc6c547d67820b4ac3b219a3d11,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1511
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1556
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1571
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1597
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1598
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1599
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1600
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1601
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1602
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1603
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1604
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1605
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1606
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1607
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1608
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1609
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1610
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1611
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1612
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1613
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1614
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1615
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1616
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1617
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1618
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1619
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1620
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1621
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1622
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1623
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1624
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1625
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1626
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1627
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1648
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1666
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1685
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1687
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1689
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1709
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2077
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2083
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2106
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.23.95742be8daec10c1d662dd67b9ee58de,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2116
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2124
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_tcp.h.25.0d607b14f5540424c2584e8e0964677c,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2129
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF2354
+	.long	.LASF2355
+	.long	.LASF2356
+	.long	.LASF2357
+	.long	.LASF2358
+	.long	.LASF2359
+	.long	.LASF2360
+	.long	.LASF2361
+	.long	.LASF2362
+	.long	.LASF2363
+	.long	.LASF2364
+	.long	.LASF2365
+	.long	.LASF2366
+	.long	.LASF2367
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x68
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2368
+	.byte	0xa
+	.long	.LASF2369
+	.byte	0xa
+	.long	.LASF2370
+	.byte	0xd
+	.long	.LASF2371
+	.byte	0xe
+	.long	.LASF2372
+	.byte	0x9
+	.long	.LASF2373
+	.byte	0x9
+	.long	.LASF2374
+	.byte	0xd
+	.long	.LASF2375
+	.byte	0x9
+	.long	.LASF2376
+	.byte	0x9
+	.long	.LASF2377
+	.byte	0x9
+	.long	.LASF2378
+	.byte	0x5
+	.long	.LASF2379
+	.byte	0x4
+	.long	.LASF2380
+	.byte	0x4
+	.long	.LASF2381
+	.byte	0x4
+	.long	.LASF2382
+	.byte	0x4
+	.long	.LASF2383
+	.byte	0x4
+	.long	.LASF2384
+	.byte	0x2
+	.long	.LASF2385
+	.byte	0x4
+	.long	.LASF2386
+	.byte	0x5
+	.long	.LASF2387
+	.byte	0x5
+	.long	.LASF2388
+	.byte	0xd
+	.long	.LASF2389
+	.byte	0xd
+	.long	.LASF2390
+	.byte	0xd
+	.long	.LASF2391
+	.byte	0x5
+	.long	.LASF2384
+	.byte	0xd
+	.long	.LASF2392
+	.byte	0xa
+	.long	.LASF2393
+	.byte	0xd
+	.long	.LASF2394
+	.byte	0xe
+	.long	.LASF2370
+	.byte	0xe
+	.long	.LASF2395
+	.byte	0xa
+	.long	.LASF2396
+	.byte	0xd
+	.long	.LASF2397
+	.byte	0xd
+	.long	.LASF2398
+	.byte	0xa
+	.long	.LASF2399
+	.byte	0xa
+	.long	.LASF2400
+	.byte	0xc
+	.long	.LASF2401
+	.byte	0xa
+	.long	.LASF2402
+	.byte	0xb
+	.long	.LASF2403
+	.byte	0xb
+	.long	.LASF2404
+	.byte	0xa
+	.long	.LASF2405
+	.byte	0xa
+	.long	.LASF2406
+	.byte	0xa
+	.long	.LASF2407
+	.byte	0xa
+	.long	.LASF2408
+	.byte	0xe
+	.long	.LASF2409
+	.byte	0x9
+	.long	.LASF2410
+	.byte	0x9
+	.long	.LASF2411
+	.byte	0x9
+	.long	.LASF2412
+	.byte	0x9
+	.long	.LASF2413
+	.byte	0x9
+	.long	.LASF2414
+	.byte	0xa
+	.long	.LASF2415
+	.byte	0xa
+	.long	.LASF2416
+	.byte	0xa
+	.long	.LASF2374
+	.byte	0xa
+	.long	.LASF2417
+	.byte	0xa
+	.long	.LASF2418
+	.byte	0xa
+	.long	.LASF2419
+	.byte	0x9
+	.long	.LASF2420
+	.byte	0x9
+	.long	.LASF2368
+	.byte	0xc
+	.long	.LASF2421
+	.byte	0x9
+	.long	.LASF2422
+	.byte	0x9
+	.long	.LASF2423
+	.byte	0xd
+	.long	.LASF2423
+	.byte	0xa
+	.long	.LASF2424
+	.byte	0xa
+	.long	.LASF2425
+	.byte	0xa
+	.long	.LASF2426
+	.byte	0xa
+	.long	.LASF2427
+	.byte	0xc
+	.long	.LASF2427
+	.byte	0xa
+	.long	.LASF2428
+	.byte	0x9
+	.long	.LASF2429
+	.byte	0x9
+	.long	.LASF2430
+	.byte	0x9
+	.long	.LASF2431
+	.byte	0xa
+	.long	.LASF2432
+	.byte	0xa
+	.long	.LASF2433
+	.byte	0xa
+	.long	.LASF2434
+	.byte	0xa
+	.long	.LASF2435
+	.byte	0xa
+	.long	.LASF2436
+	.byte	0xa
+	.long	.LASF2437
+	.byte	0xd
+	.long	.LASF2438
+	.byte	0xa
+	.long	.LASF2439
+	.byte	0xd
+	.long	.LASF2384
+	.byte	0xa
+	.long	.LASF2440
+	.byte	0xa
+	.long	.LASF2441
+	.byte	0x9
+	.long	.LASF2442
+	.byte	0x9
+	.long	.LASF2443
+	.byte	0xa
+	.long	.LASF2444
+	.byte	0xa
+	.long	.LASF2445
+	.byte	0xa
+	.long	.LASF2446
+	.byte	0xa
+	.long	.LASF2447
+	.byte	0xa
+	.long	.LASF2448
+	.byte	0xa
+	.long	.LASF2449
+	.byte	0x8
+	.long	.LASF2450
+	.byte	0x7
+	.long	.LASF2451
+	.byte	0x6
+	.long	.LASF2452
+	.byte	0x6
+	.long	.LASF2453
+	.byte	0x2
+	.long	.LASF2454
+	.byte	0x2
+	.long	.LASF2455
+	.byte	0x4
+	.long	.LASF2456
+	.byte	0x4
+	.long	.LASF2457
+	.byte	0x4
+	.long	.LASF2458
+	.byte	0x4
+	.long	.LASF2459
+	.byte	0x3
+	.long	.LASF2460
+	.byte	0x1
+	.long	.LASF2461
+	.byte	0x4
+	.long	.LASF2462
+	.byte	0x4
+	.long	.LASF2463
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1833:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2069:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1907:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF919:
+	.string	"__ldiv_t_defined 1"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1127:
+	.string	"_POSIX_THREADS 200809L"
+.LASF1705:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1788:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2001:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1585:
+	.string	"USE_FAKE_BARO "
+.LASF1011:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1179:
+	.string	"__ILP32_OFF32_CFLAGS \"-m32\""
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2182:
+	.string	"_unused2"
+.LASF1491:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS"
+.LASF1434:
+	.string	"_SC_SIGSTKSZ _SC_SIGSTKSZ"
+.LASF1731:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1261:
+	.string	"_SC_LINE_MAX _SC_LINE_MAX"
+.LASF1309:
+	.string	"_SC_XOPEN_XCU_VERSION _SC_XOPEN_XCU_VERSION"
+.LASF1059:
+	.string	"ADJ_TICK 0x4000"
+.LASF881:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1551:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2168:
+	.string	"_fileno"
+.LASF2290:
+	.string	"sitlPhysicsUpdate"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1219:
+	.string	"_SC_CLK_TCK _SC_CLK_TCK"
+.LASF1217:
+	.string	"_SC_ARG_MAX _SC_ARG_MAX"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1825:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1422:
+	.string	"_SC_V7_ILP32_OFFBIG _SC_V7_ILP32_OFFBIG"
+.LASF1923:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1594:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF1256:
+	.string	"_SC_BC_SCALE_MAX _SC_BC_SCALE_MAX"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1598:
+	.string	"USE_PPM"
+.LASF1843:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF949:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1158:
+	.string	"_POSIX_MESSAGE_PASSING 200809L"
+.LASF1972:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1800:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2079:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1105:
+	.string	"_XOPEN_XPG2 1"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1764:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF1189:
+	.string	"R_OK 4"
+.LASF936:
+	.string	"__pid_t_defined "
+.LASF948:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1288:
+	.string	"_SC_GETGR_R_SIZE_MAX _SC_GETGR_R_SIZE_MAX"
+.LASF1711:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1769:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF896:
+	.string	"WNOWAIT 0x01000000"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2137:
+	.string	"__uint8_t"
+.LASF1281:
+	.string	"_SC_PII_INTERNET_DGRAM _SC_PII_INTERNET_DGRAM"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1655:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1284:
+	.string	"_SC_PII_OSI_M _SC_PII_OSI_M"
+.LASF1973:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2209:
+	.string	"_Bool"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1578:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1248:
+	.string	"_SC_PAGE_SIZE _SC_PAGESIZE"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1690:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1510:
+	.string	"CLOSE_RANGE_UNSHARE (1U << 1)"
+.LASF1459:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LINTFLAGS _CS_XBS5_ILP32_OFFBIG_LINTFLAGS"
+.LASF1546:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1041:
+	.string	"CLOCK_REALTIME_COARSE 5"
+.LASF2218:
+	.string	"OWNER_ADC_CURR"
+.LASF2321:
+	.string	"pwmShutdownPulsesForAllMotors"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF2060:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1371:
+	.string	"_SC_NETWORKING _SC_NETWORKING"
+.LASF1723:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1925:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1418:
+	.string	"_SC_LEVEL4_CACHE_LINESIZE _SC_LEVEL4_CACHE_LINESIZE"
+.LASF2033:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2064:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1249:
+	.string	"_SC_RTSIG_MAX _SC_RTSIG_MAX"
+.LASF2314:
+	.string	"statusLedConfig"
+.LASF797:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF1272:
+	.string	"_SC_PII_XTI _SC_PII_XTI"
+.LASF2173:
+	.string	"_shortbuf"
+.LASF2090:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF763:
+	.string	"_STDIO_H 1"
+.LASF1762:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1712:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1155:
+	.string	"_POSIX_SPAWN 200809L"
+.LASF1996:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1942:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF1961:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1701:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF1856:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1552:
+	.string	"USE_SENSOR_NAMES "
+.LASF890:
+	.string	"_STDLIB_H 1"
+.LASF1382:
+	.string	"_SC_SYSTEM_DATABASE_R _SC_SYSTEM_DATABASE_R"
+.LASF2065:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1871:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF789:
+	.string	"__need___va_list"
+.LASF1539:
+	.string	"USE_SERVOS "
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2037:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1775:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2012:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF798:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF1394:
+	.string	"_SC_2_PBS_CHECKPOINT _SC_2_PBS_CHECKPOINT"
+.LASF2215:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2072:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1463:
+	.string	"_CS_XBS5_LP64_OFF64_LINTFLAGS _CS_XBS5_LP64_OFF64_LINTFLAGS"
+.LASF2014:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"_SC_PRIORITIZED_IO _SC_PRIORITIZED_IO"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2149:
+	.string	"uint16_t"
+.LASF1765:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1126:
+	.string	"_XOPEN_SHM 1"
+.LASF960:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF2075:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF1137:
+	.string	"_POSIX_SEMAPHORES 200809L"
+.LASF2191:
+	.string	"time_t"
+.LASF2004:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1895:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2154:
+	.string	"_flags"
+.LASF1983:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1535:
+	.string	"TELEMETRY_HOTT "
+.LASF2265:
+	.string	"pwmOutputPort_t"
+.LASF1902:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1276:
+	.string	"_SC_POLL _SC_POLL"
+.LASF2085:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF820:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF1971:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1377:
+	.string	"_SC_SIGNALS _SC_SIGNALS"
+.LASF1579:
+	.string	"LED0_PIN NONE"
+.LASF1642:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1058:
+	.string	"ADJ_NANO 0x2000"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1719:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF935:
+	.string	"__uid_t_defined "
+.LASF1200:
+	.string	"_PC_PATH_MAX _PC_PATH_MAX"
+.LASF2010:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1777:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF796:
+	.string	"__struct_FILE_defined 1"
+.LASF834:
+	.string	"RENAME_WHITEOUT (1 << 2)"
+.LASF1947:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF803:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF1498:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LIBS _CS_POSIX_V7_LPBIG_OFFBIG_LIBS"
+.LASF1851:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1490:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LIBS _CS_POSIX_V7_ILP32_OFFBIG_LIBS"
+.LASF1164:
+	.string	"_POSIX_RAW_SOCKETS 200809L"
+.LASF2025:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"SEEK_SET 0"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1203:
+	.string	"_PC_NO_TRUNC _PC_NO_TRUNC"
+.LASF1257:
+	.string	"_SC_BC_STRING_MAX _SC_BC_STRING_MAX"
+.LASF1838:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF805:
+	.string	"_VA_LIST_DEFINED "
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF934:
+	.string	"__nlink_t_defined "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1152:
+	.string	"_POSIX_SHELL 1"
+.LASF1921:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1122:
+	.string	"_POSIX_VDISABLE '\\0'"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF872:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2174:
+	.string	"_lock"
+.LASF1724:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1832:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2330:
+	.string	"Data"
+.LASF1133:
+	.string	"_POSIX_THREAD_PRIO_INHERIT 200809L"
+.LASF1916:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1174:
+	.string	"_POSIX_V6_LPBIG_OFFBIG -1"
+.LASF1970:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1658:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF821:
+	.string	"L_tmpnam 20"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1803:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF861:
+	.string	"__f64x(x) x ##f64x"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1888:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1541:
+	.string	"CMS "
+.LASF1255:
+	.string	"_SC_BC_DIM_MAX _SC_BC_DIM_MAX"
+.LASF1496:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS"
+.LASF1259:
+	.string	"_SC_EQUIV_CLASS_MAX _SC_EQUIV_CLASS_MAX"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1810:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1345:
+	.string	"_SC_XBS5_ILP32_OFFBIG _SC_XBS5_ILP32_OFFBIG"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF2349:
+	.string	"atof"
+.LASF1370:
+	.string	"_SC_SINGLE_PROCESS _SC_SINGLE_PROCESS"
+.LASF1468:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_CFLAGS _CS_POSIX_V6_ILP32_OFF32_CFLAGS"
+.LASF2222:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1634:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1885:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1319:
+	.string	"_SC_XOPEN_XPG4 _SC_XOPEN_XPG4"
+.LASF1650:
+	.string	"sq(x) ((x)*(x))"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1561:
+	.string	"_T_PTRDIFF_ "
+.LASF1732:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF832:
+	.string	"RENAME_NOREPLACE (1 << 0)"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1678:
+	.string	"BIT(x) (1 << (x))"
+.LASF2247:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2089:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1740:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1628:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF2183:
+	.string	"FILE"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1168:
+	.string	"_POSIX_TRACE -1"
+.LASF2104:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1638:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF839:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF1889:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF988:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF2015:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1653:
+	.string	"FAST_MATH "
+.LASF1584:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1645:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF2123:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF926:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2050:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF985:
+	.string	"__timeval_defined 1"
+.LASF2040:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1055:
+	.string	"ADJ_TAI 0x0080"
+.LASF1986:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1193:
+	.string	"L_SET SEEK_SET"
+.LASF1292:
+	.string	"_SC_THREAD_DESTRUCTOR_ITERATIONS _SC_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF1672:
+	.string	"STR_HELPER(x) #x"
+.LASF1574:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1807:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2336:
+	.string	"failureMode"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF869:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF1383:
+	.string	"_SC_TIMEOUTS _SC_TIMEOUTS"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF962:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1095:
+	.string	"_POSIX_VERSION 200809L"
+.LASF2244:
+	.string	"OWNER_BARO_EXTI"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF546:
+	.string	"__always_inline"
+.LASF1043:
+	.string	"CLOCK_BOOTTIME 7"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF845:
+	.string	"__HAVE_FLOAT16 0"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1599:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1114:
+	.string	"_POSIX_PRIORITY_SCHEDULING 200809L"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1817:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2221:
+	.string	"OWNER_SERIAL_TX"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1144:
+	.string	"_LFS_LARGEFILE 1"
+.LASF906:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF2146:
+	.string	"__syscall_slong_t"
+.LASF1286:
+	.string	"_SC_THREADS _SC_THREADS"
+.LASF1509:
+	.string	"_LINUX_CLOSE_RANGE_H "
+.LASF1831:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF2160:
+	.string	"_IO_write_end"
+.LASF1646:
+	.string	"EEPROM_SIZE 32768"
+.LASF1159:
+	.string	"_POSIX_THREAD_PROCESS_SHARED 200809L"
+.LASF1428:
+	.string	"_SC_TRACE_SYS_MAX _SC_TRACE_SYS_MAX"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1931:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF2286:
+	.string	"double"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF1291:
+	.string	"_SC_TTY_NAME_MAX _SC_TTY_NAME_MAX"
+.LASF1499:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS"
+.LASF972:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1337:
+	.string	"_SC_USHRT_MAX _SC_USHRT_MAX"
+.LASF1548:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF964:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2278:
+	.string	"FAILURE_ACC_INCOMPATIBLE"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF2116:
+	.string	"LED2_ON do {} while(0)"
+.LASF1424:
+	.string	"_SC_V7_LPBIG_OFFBIG _SC_V7_LPBIG_OFFBIG"
+.LASF1351:
+	.string	"_SC_ADVISORY_INFO _SC_ADVISORY_INFO"
+.LASF973:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1926:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF981:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1780:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2258:
+	.string	"ledTags"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1051:
+	.string	"ADJ_MAXERROR 0x0004"
+.LASF1966:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1633:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2039:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2245:
+	.string	"OWNER_USB"
+.LASF2323:
+	.string	"index"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"____mbstate_t_defined 1"
+.LASF907:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF2256:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF868:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1979:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1883:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF849:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2156:
+	.string	"_IO_read_end"
+.LASF870:
+	.string	"__STDIO_INLINE"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1693:
+	.string	"IOCFG_AF_PP 0"
+.LASF1389:
+	.string	"_SC_2_PBS_LOCATE _SC_2_PBS_LOCATE"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1673:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2109:
+	.string	"LED0_OFF do {} while(0)"
+.LASF2319:
+	.string	"pwmCompleteMotorUpdate"
+.LASF2100:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1154:
+	.string	"_POSIX_SPIN_LOCKS 200809L"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1445:
+	.string	"_CS_LFS_LDFLAGS _CS_LFS_LDFLAGS"
+.LASF1166:
+	.string	"_POSIX_SPORADIC_SERVER -1"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1405:
+	.string	"_SC_LEVEL1_ICACHE_ASSOC _SC_LEVEL1_ICACHE_ASSOC"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1938:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2297:
+	.string	"fread"
+.LASF1948:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1175:
+	.string	"_XBS5_LPBIG_OFFBIG -1"
+.LASF1115:
+	.string	"_POSIX_SYNCHRONIZED_IO 200809L"
+.LASF1267:
+	.string	"_SC_2_FORT_DEV _SC_2_FORT_DEV"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF904:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF1347:
+	.string	"_SC_XBS5_LPBIG_OFFBIG _SC_XBS5_LPBIG_OFFBIG"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1755:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1384:
+	.string	"_SC_TYPED_MEMORY_OBJECTS _SC_TYPED_MEMORY_OBJECTS"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF841:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF828:
+	.string	"_PRINTF_NAN_LEN_MAX 4"
+.LASF2226:
+	.string	"OWNER_SONAR_ECHO"
+.LASF1614:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1989:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1859:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2053:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1052:
+	.string	"ADJ_ESTERROR 0x0008"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1798:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1473:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS"
+.LASF2328:
+	.string	"FLASH_ProgramWord"
+.LASF2087:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2214:
+	.string	"OWNER_SERVO"
+.LASF1680:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF2111:
+	.string	"LED1_TOGGLE do {} while(0)"
+.LASF819:
+	.string	"P_tmpdir \"/tmp\""
+.LASF1139:
+	.string	"_POSIX_ASYNCHRONOUS_IO 200809L"
+.LASF1904:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1097:
+	.string	"_POSIX2_VERSION __POSIX2_THIS_VERSION"
+.LASF1075:
+	.string	"STA_PPSTIME 0x0004"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2030:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1543:
+	.string	"TELEMETRY_IBUS "
+.LASF1308:
+	.string	"_SC_XOPEN_VERSION _SC_XOPEN_VERSION"
+.LASF2019:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF959:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF874:
+	.string	"_WCHAR_T "
+.LASF1400:
+	.string	"_SC_TRACE _SC_TRACE"
+.LASF2309:
+	.string	"stackTotalSize"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1730:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1815:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1909:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1393:
+	.string	"_SC_STREAMS _SC_STREAMS"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF2086:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1504:
+	.string	"F_ULOCK 0"
+.LASF952:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1733:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1919:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1026:
+	.string	"alloca"
+.LASF924:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1771:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1443:
+	.string	"_CS_POSIX_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF1567:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2102:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1738:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1805:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1476:
+	.string	"_CS_POSIX_V6_LP64_OFF64_CFLAGS _CS_POSIX_V6_LP64_OFF64_CFLAGS"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2138:
+	.string	"__uint16_t"
+.LASF864:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1009:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF2213:
+	.string	"OWNER_MOTOR"
+.LASF1070:
+	.string	"MOD_TAI ADJ_TAI"
+.LASF1165:
+	.string	"_POSIX2_CHAR_TERM 200809L"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1822:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1086:
+	.string	"STA_NANO 0x2000"
+.LASF1094:
+	.string	"_UNISTD_H 1"
+.LASF364:
+	.string	"__k8 1"
+.LASF1662:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF1107:
+	.string	"_XOPEN_XPG4 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2241:
+	.string	"OWNER_RX_SPI_CS"
+.LASF884:
+	.string	"__INT_WCHAR_T_H "
+.LASF932:
+	.string	"__gid_t_defined "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1462:
+	.string	"_CS_XBS5_LP64_OFF64_LIBS _CS_XBS5_LP64_OFF64_LIBS"
+.LASF1855:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1346:
+	.string	"_SC_XBS5_LP64_OFF64 _SC_XBS5_LP64_OFF64"
+.LASF1360:
+	.string	"_SC_DEVICE_SPECIFIC _SC_DEVICE_SPECIFIC"
+.LASF1710:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1209:
+	.string	"_PC_FILESIZEBITS _PC_FILESIZEBITS"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF783:
+	.string	"__size_t "
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1233:
+	.string	"_SC_MAPPED_FILES _SC_MAPPED_FILES"
+.LASF1373:
+	.string	"_SC_SPIN_LOCKS _SC_SPIN_LOCKS"
+.LASF2283:
+	.string	"eepromData"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2337:
+	.string	"mode"
+.LASF1741:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1507:
+	.string	"F_TEST 3"
+.LASF2032:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1482:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LIBS _CS_POSIX_V6_LPBIG_OFFBIG_LIBS"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1474:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LIBS _CS_POSIX_V6_ILP32_OFFBIG_LIBS"
+.LASF917:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1542:
+	.string	"TELEMETRY_CRSF "
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1651:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2277:
+	.string	"FAILURE_ACC_INIT"
+.LASF2167:
+	.string	"_chain"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF933:
+	.string	"__mode_t_defined "
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF860:
+	.string	"__f32x(x) x ##f32x"
+.LASF1333:
+	.string	"_SC_SHRT_MIN _SC_SHRT_MIN"
+.LASF1318:
+	.string	"_SC_XOPEN_XPG3 _SC_XOPEN_XPG3"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1295:
+	.string	"_SC_THREAD_THREADS_MAX _SC_THREAD_THREADS_MAX"
+.LASF1311:
+	.string	"_SC_XOPEN_CRYPT _SC_XOPEN_CRYPT"
+.LASF1858:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1341:
+	.string	"_SC_NL_NMAX _SC_NL_NMAX"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1671:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF2130:
+	.string	"EEPROM_FILENAME \"eeprom.bin\""
+.LASF1863:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1865:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF2131:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1640:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1034:
+	.string	"_BITS_TIME_H 1"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1687:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1568:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1245:
+	.string	"_SC_MQ_PRIO_MAX _SC_MQ_PRIO_MAX"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1992:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2052:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1408:
+	.string	"_SC_LEVEL1_DCACHE_ASSOC _SC_LEVEL1_DCACHE_ASSOC"
+.LASF1429:
+	.string	"_SC_TRACE_USER_EVENT_MAX _SC_TRACE_USER_EVENT_MAX"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1411:
+	.string	"_SC_LEVEL2_CACHE_ASSOC _SC_LEVEL2_CACHE_ASSOC"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1079:
+	.string	"STA_UNSYNC 0x0040"
+.LASF1372:
+	.string	"_SC_READER_WRITER_LOCKS _SC_READER_WRITER_LOCKS"
+.LASF2268:
+	.string	"motorPwmProtocol"
+.LASF2206:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF2092:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1088:
+	.string	"STA_CLK 0x8000"
+.LASF2200:
+	.string	"FLASH_ERROR_PG"
+.LASF1202:
+	.string	"_PC_CHOWN_RESTRICTED _PC_CHOWN_RESTRICTED"
+.LASF2011:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF883:
+	.string	"___int_wchar_t_h "
+.LASF1827:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2005:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1129:
+	.string	"_POSIX_THREAD_SAFE_FUNCTIONS 200809L"
+.LASF1580:
+	.string	"GYRO "
+.LASF1186:
+	.string	"STDOUT_FILENO 1"
+.LASF1549:
+	.string	"USE_MSP_PUSH "
+.LASF1891:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1369:
+	.string	"_SC_MULTI_PROCESS _SC_MULTI_PROCESS"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1620:
+	.string	"VTX_COMMON"
+.LASF1692:
+	.string	"IOCFG_OUT_OD 0"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF1544:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1560:
+	.string	"_PTRDIFF_T "
+.LASF1438:
+	.string	"_CS_GNU_LIBC_VERSION _CS_GNU_LIBC_VERSION"
+.LASF1951:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF957:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF2188:
+	.string	"stderr"
+.LASF2262:
+	.string	"forceOverflow"
+.LASF2078:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1747:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1664:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1330:
+	.string	"_SC_SCHAR_MAX _SC_SCHAR_MAX"
+.LASF1778:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1994:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1759:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF975:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1784:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1014:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1205:
+	.string	"_PC_SYNC_IO _PC_SYNC_IO"
+.LASF1111:
+	.string	"_BITS_POSIX_OPT_H 1"
+.LASF2098:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1453:
+	.string	"_CS_XBS5_ILP32_OFF32_LDFLAGS _CS_XBS5_ILP32_OFF32_LDFLAGS"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2122:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF2253:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1024:
+	.string	"__have_pthread_attr_t 1"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1056:
+	.string	"ADJ_SETOFFSET 0x0100"
+.LASF1985:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1845:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1149:
+	.string	"_POSIX_THREAD_CPUTIME 0"
+.LASF1629:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1293:
+	.string	"_SC_THREAD_KEYS_MAX _SC_THREAD_KEYS_MAX"
+.LASF940:
+	.string	"__clock_t_defined 1"
+.LASF1282:
+	.string	"_SC_PII_OSI_COTS _SC_PII_OSI_COTS"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF880:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1850:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1338:
+	.string	"_SC_NL_ARGMAX _SC_NL_ARGMAX"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1939:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1262:
+	.string	"_SC_RE_DUP_MAX _SC_RE_DUP_MAX"
+.LASF1530:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1918:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1381:
+	.string	"_SC_SYSTEM_DATABASE _SC_SYSTEM_DATABASE"
+.LASF1868:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1306:
+	.string	"_SC_ATEXIT_MAX _SC_ATEXIT_MAX"
+.LASF2235:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1177:
+	.string	"_POSIX_V6_LP64_OFF64 1"
+.LASF2035:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"_POSIX_MEMLOCK 200809L"
+.LASF987:
+	.string	"__NFDBITS"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF909:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1696:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1900:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1098:
+	.string	"_POSIX2_C_VERSION __POSIX2_THIS_VERSION"
+.LASF817:
+	.string	"SEEK_DATA 3"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2203:
+	.string	"FLASH_TIMEOUT"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1720:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF2331:
+	.string	"FLASH_ErasePage"
+.LASF1799:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1734:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2308:
+	.string	"stackHighMem"
+.LASF2029:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1465:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LDFLAGS _CS_XBS5_LPBIG_OFFBIG_LDFLAGS"
+.LASF2289:
+	.string	"motorsEnabled"
+.LASF1298:
+	.string	"_SC_THREAD_PRIORITY_SCHEDULING _SC_THREAD_PRIORITY_SCHEDULING"
+.LASF1786:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1853:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF788:
+	.string	"__need___va_list "
+.LASF1872:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1934:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF850:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2176:
+	.string	"_codecvt"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2159:
+	.string	"_IO_write_ptr"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF816:
+	.string	"SEEK_END 2"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF809:
+	.string	"_IOFBF 0"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF983:
+	.string	"____sigset_t_defined "
+.LASF2327:
+	.string	"idlePulse"
+.LASF1572:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF947:
+	.string	"_ENDIAN_H 1"
+.LASF2055:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF2353:
+	.string	"hostNanos"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1984:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2332:
+	.string	"Page_Address"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1274:
+	.string	"_SC_PII_INTERNET _SC_PII_INTERNET"
+.LASF1519:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF2267:
+	.string	"motorPwmRate"
+.LASF402:
+	.string	"false 0"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF2067:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1116:
+	.string	"_POSIX_FSYNC 200809L"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1349:
+	.string	"_SC_XOPEN_REALTIME _SC_XOPEN_REALTIME"
+.LASF2204:
+	.string	"FLASH_Status"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1897:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF2197:
+	.string	"test"
+.LASF2292:
+	.string	"fwrite"
+.LASF1406:
+	.string	"_SC_LEVEL1_ICACHE_LINESIZE _SC_LEVEL1_ICACHE_LINESIZE"
+.LASF950:
+	.string	"__BIG_ENDIAN 4321"
+.LASF2026:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1789:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1812:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2294:
+	.string	"exit"
+.LASF1101:
+	.string	"_POSIX2_SW_DEV __POSIX2_THIS_VERSION"
+.LASF852:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1327:
+	.string	"_SC_MB_LEN_MAX _SC_MB_LEN_MAX"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1388:
+	.string	"_SC_2_PBS_ACCOUNTING _SC_2_PBS_ACCOUNTING"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1028:
+	.string	"__COMPAR_FN_T "
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1015:
+	.string	"__ONCE_ALIGNMENT "
+.LASF1207:
+	.string	"_PC_PRIO_IO _PC_PRIO_IO"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1820:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2246:
+	.string	"OWNER_USB_DETECT"
+.LASF2016:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1929:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1906:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF900:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF2048:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1689:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1521:
+	.string	"USE_PPM "
+.LASF835:
+	.string	"__attr_dealloc_fclose"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1153:
+	.string	"_POSIX_TIMEOUTS 200809L"
+.LASF2199:
+	.string	"FLASH_BUSY"
+.LASF946:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF969:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1374:
+	.string	"_SC_REGEXP _SC_REGEXP"
+.LASF1573:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1396:
+	.string	"_SC_V6_ILP32_OFFBIG _SC_V6_ILP32_OFFBIG"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1875:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1880:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF795:
+	.string	"__FILE_defined 1"
+.LASF2059:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF847:
+	.string	"__HAVE_FLOAT64 1"
+.LASF991:
+	.string	"__FDS_BITS(set) ((set)->fds_bits)"
+.LASF1343:
+	.string	"_SC_NL_TEXTMAX _SC_NL_TEXTMAX"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF2114:
+	.string	"LED2_TOGGLE do {} while(0)"
+.LASF1744:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2036:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF2250:
+	.string	"OWNER_INVERTER"
+.LASF1469:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LDFLAGS _CS_POSIX_V6_ILP32_OFF32_LDFLAGS"
+.LASF2153:
+	.string	"size_t"
+.LASF1044:
+	.string	"CLOCK_REALTIME_ALARM 8"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1884:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF958:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1477:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LDFLAGS _CS_POSIX_V6_LP64_OFF64_LDFLAGS"
+.LASF1436:
+	.string	"_CS_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF1048:
+	.string	"_BITS_TIMEX_H 1"
+.LASF2230:
+	.string	"OWNER_SPI_MOSI"
+.LASF1835:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2038:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2148:
+	.string	"uint8_t"
+.LASF1785:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1216:
+	.string	"_PC_2_SYMLINKS _PC_2_SYMLINKS"
+.LASF1783:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1414:
+	.string	"_SC_LEVEL3_CACHE_ASSOC _SC_LEVEL3_CACHE_ASSOC"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF824:
+	.string	"L_ctermid 9"
+.LASF1066:
+	.string	"MOD_STATUS ADJ_STATUS"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1184:
+	.string	"__LP64_OFF64_LDFLAGS \"-m64\""
+.LASF1516:
+	.string	"I2C2_OVERCLOCK true"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1627:
+	.string	"USE_DSHOT"
+.LASF1887:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1016:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1247:
+	.string	"_SC_PAGESIZE _SC_PAGESIZE"
+.LASF1533:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1654:
+	.string	"VERY_FAST_MATH "
+.LASF2061:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1392:
+	.string	"_SC_SYMLOOP_MAX _SC_SYMLOOP_MAX"
+.LASF931:
+	.string	"__dev_t_defined "
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1686:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF1143:
+	.string	"_LFS64_ASYNCHRONOUS_IO 1"
+.LASF968:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF885:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1967:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1283:
+	.string	"_SC_PII_OSI_CLTS _SC_PII_OSI_CLTS"
+.LASF2335:
+	.string	"FLASH_Unlock"
+.LASF1299:
+	.string	"_SC_THREAD_PRIO_INHERIT _SC_THREAD_PRIO_INHERIT"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1612:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF911:
+	.string	"__WCOREFLAG 0x80"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2163:
+	.string	"_IO_save_base"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1977:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2329:
+	.string	"addr"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1896:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1017:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1782:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1145:
+	.string	"_LFS64_LARGEFILE 1"
+.LASF1613:
+	.string	"TELEMETRY_CRSF"
+.LASF1085:
+	.string	"STA_CLOCKERR 0x1000"
+.LASF941:
+	.string	"__clockid_t_defined 1"
+.LASF888:
+	.string	"_BSD_WCHAR_T_"
+.LASF1898:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1801:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2096:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF843:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1121:
+	.string	"_POSIX_CHOWN_RESTRICTED 0"
+.LASF1190:
+	.string	"W_OK 2"
+.LASF1252:
+	.string	"_SC_SIGQUEUE_MAX _SC_SIGQUEUE_MAX"
+.LASF784:
+	.string	"__need_size_t"
+.LASF2212:
+	.string	"OWNER_PPMINPUT"
+.LASF2207:
+	.string	"ioTag_t"
+.LASF1437:
+	.string	"_CS_POSIX_V6_WIDTH_RESTRICTED_ENVS _CS_V6_WIDTH_RESTRICTED_ENVS"
+.LASF2347:
+	.string	"microsISR"
+.LASF1570:
+	.string	"__need_ptrdiff_t"
+.LASF961:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1092:
+	.string	"TIME_UTC 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF1277:
+	.string	"_SC_SELECT _SC_SELECT"
+.LASF1513:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1460:
+	.string	"_CS_XBS5_LP64_OFF64_CFLAGS _CS_XBS5_LP64_OFF64_CFLAGS"
+.LASF2118:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF1677:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2051:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1467:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LINTFLAGS _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1806:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1334:
+	.string	"_SC_UCHAR_MAX _SC_UCHAR_MAX"
+.LASF1600:
+	.string	"SERIAL_RX"
+.LASF1587:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1735:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF2062:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1991:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1802:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2009:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1047:
+	.string	"TIMER_ABSTIME 1"
+.LASF1901:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF2180:
+	.string	"__pad5"
+.LASF2070:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2177:
+	.string	"_wide_data"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1279:
+	.string	"_SC_IOV_MAX _SC_IOV_MAX"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1779:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1441:
+	.string	"_CS_POSIX_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF914:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1846:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1772:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1619:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1750:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1120:
+	.string	"_POSIX_MEMORY_PROTECTION 200809L"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF980:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1773:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF2285:
+	.string	"clockSpeed"
+.LASF2269:
+	.string	"motorPwmInversion"
+.LASF1399:
+	.string	"_SC_HOST_NAME_MAX _SC_HOST_NAME_MAX"
+.LASF844:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1819:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1197:
+	.string	"_PC_MAX_CANON _PC_MAX_CANON"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1956:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1226:
+	.string	"_SC_REALTIME_SIGNALS _SC_REALTIME_SIGNALS"
+.LASF2288:
+	.string	"motorCount"
+.LASF1220:
+	.string	"_SC_NGROUPS_MAX _SC_NGROUPS_MAX"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1271:
+	.string	"_SC_PII _SC_PII"
+.LASF1987:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2073:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1933:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1609:
+	.string	"LED_STRIP"
+.LASF1968:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1517:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1691:
+	.string	"IOCFG_OUT_PP 0"
+.LASF842:
+	.string	"__f128(x) x ##f128"
+.LASF1000:
+	.string	"__fsblkcnt_t_defined "
+.LASF1352:
+	.string	"_SC_BARRIERS _SC_BARRIERS"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1146:
+	.string	"_LFS64_STDIO 1"
+.LASF2013:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF956:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF978:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF1753:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1038:
+	.string	"CLOCK_PROCESS_CPUTIME_ID 2"
+.LASF1404:
+	.string	"_SC_LEVEL1_ICACHE_SIZE _SC_LEVEL1_ICACHE_SIZE"
+.LASF1844:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF1605:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2129:
+	.string	"TCP_SERIAL_TX_BUFFER_SIZE 2048"
+.LASF2324:
+	.string	"value"
+.LASF1606:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1001:
+	.string	"__fsfilcnt_t_defined "
+.LASF942:
+	.string	"__time_t_defined 1"
+.LASF891:
+	.string	"WNOHANG 1"
+.LASF1472:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_CFLAGS _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS"
+.LASF1242:
+	.string	"_SC_AIO_PRIO_DELTA_MAX _SC_AIO_PRIO_DELTA_MAX"
+.LASF1879:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF2124:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF1575:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1830:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1010:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1534:
+	.string	"TELEMETRY_FRSKY "
+.LASF1708:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1470:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LIBS _CS_POSIX_V6_ILP32_OFF32_LIBS"
+.LASF1955:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1108:
+	.string	"_XOPEN_UNIX 1"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1042:
+	.string	"CLOCK_MONOTONIC_COARSE 6"
+.LASF2031:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"_CS_V7_WIDTH_RESTRICTED_ENVS _CS_V7_WIDTH_RESTRICTED_ENVS"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1435:
+	.string	"_CS_PATH _CS_PATH"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1119:
+	.string	"_POSIX_MEMLOCK_RANGE 200809L"
+.LASF2225:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1273:
+	.string	"_SC_PII_SOCKET _SC_PII_SOCKET"
+.LASF811:
+	.string	"_IONBF 2"
+.LASF2094:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1666:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1869:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1953:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1857:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1860:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2322:
+	.string	"pwmWriteMotor"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1604:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1188:
+	.string	"__socklen_t_defined "
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1756:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1403:
+	.string	"_SC_TRACE_LOG _SC_TRACE_LOG"
+.LASF2120:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF822:
+	.string	"TMP_MAX 238328"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1192:
+	.string	"F_OK 0"
+.LASF893:
+	.string	"WSTOPPED 2"
+.LASF1899:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1103:
+	.string	"_XOPEN_VERSION 700"
+.LASF2326:
+	.string	"motorConfig"
+.LASF2045:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF998:
+	.string	"__blksize_t_defined "
+.LASF2296:
+	.string	"fclose"
+.LASF1208:
+	.string	"_PC_SOCK_MAXBUF _PC_SOCK_MAXBUF"
+.LASF1663:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF894:
+	.string	"WEXITED 4"
+.LASF2227:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1993:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2313:
+	.string	"channel"
+.LASF2093:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1631:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF499:
+	.string	"__PMT"
+.LASF1718:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF886:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2193:
+	.string	"timespec"
+.LASF1201:
+	.string	"_PC_PIPE_BUF _PC_PIPE_BUF"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1626:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF1667:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1905:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2042:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1117:
+	.string	"_POSIX_MAPPED_FILES 200809L"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF903:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1432:
+	.string	"_SC_THREAD_ROBUST_PRIO_PROTECT _SC_THREAD_ROBUST_PRIO_PROTECT"
+.LASF1524:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1834:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2210:
+	.string	"OWNER_FREE"
+.LASF1285:
+	.string	"_SC_T_IOV_MAX _SC_T_IOV_MAX"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1353:
+	.string	"_SC_BASE _SC_BASE"
+.LASF1522:
+	.string	"USE_PWM "
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1156:
+	.string	"_POSIX_TIMERS 200809L"
+.LASF1937:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1497:
+	.string	"_CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS"
+.LASF1495:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LINTFLAGS _CS_POSIX_V7_LP64_OFF64_LINTFLAGS"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1870:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1823:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2343:
+	.string	"eepromLoad"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF840:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1999:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2110:
+	.string	"LED0_ON do {} while(0)"
+.LASF1781:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1911:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF806:
+	.string	"__off_t_defined "
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1611:
+	.string	"TELEMETRY_HOTT"
+.LASF1323:
+	.string	"_SC_INT_MAX _SC_INT_MAX"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF876:
+	.string	"_T_WCHAR "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF895:
+	.string	"WCONTINUED 8"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1135:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_INHERIT 200809L"
+.LASF1479:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LINTFLAGS _CS_POSIX_V6_LP64_OFF64_LINTFLAGS"
+.LASF1854:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2198:
+	.string	"TIM_TypeDef"
+.LASF2081:
+	.string	"UNIT_TESTED "
+.LASF2272:
+	.string	"ioTags"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1215:
+	.string	"_PC_SYMLINK_MAX _PC_SYMLINK_MAX"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2315:
+	.string	"IOInitGlobal"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1936:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1636:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF878:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1250:
+	.string	"_SC_SEM_NSEMS_MAX _SC_SEM_NSEMS_MAX"
+.LASF2142:
+	.string	"__off_t"
+.LASF1421:
+	.string	"_SC_V7_ILP32_OFF32 _SC_V7_ILP32_OFF32"
+.LASF1715:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1045:
+	.string	"CLOCK_BOOTTIME_ALARM 9"
+.LASF1915:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2351:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1068:
+	.string	"MOD_CLKB ADJ_TICK"
+.LASF856:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2107:
+	.string	"LED_NUMBER 3"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF2263:
+	.string	"period"
+.LASF2091:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1512:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF2151:
+	.string	"uint64_t"
+.LASF944:
+	.string	"__useconds_t_defined "
+.LASF2299:
+	.string	"memset"
+.LASF1736:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1416:
+	.string	"_SC_LEVEL4_CACHE_SIZE _SC_LEVEL4_CACHE_SIZE"
+.LASF1500:
+	.string	"_CS_V6_ENV _CS_V6_ENV"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1882:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1494:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LIBS _CS_POSIX_V7_LP64_OFF64_LIBS"
+.LASF799:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1714:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF2259:
+	.string	"polarity"
+.LASF1013:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1480:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS"
+.LASF2017:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1531:
+	.string	"BLACKBOX "
+.LASF1527:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2311:
+	.string	"timerStart"
+.LASF2165:
+	.string	"_IO_save_end"
+.LASF945:
+	.string	"__suseconds_t_defined "
+.LASF1344:
+	.string	"_SC_XBS5_ILP32_OFF32 _SC_XBS5_ILP32_OFF32"
+.LASF2350:
+	.string	"__nptr"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF1003:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF995:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1375:
+	.string	"_SC_REGEX_VERSION _SC_REGEX_VERSION"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1379:
+	.string	"_SC_SPORADIC_SERVER _SC_SPORADIC_SERVER"
+.LASF1998:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF979:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF1571:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1751:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1224:
+	.string	"_SC_JOB_CONTROL _SC_JOB_CONTROL"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1930:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1746:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1243:
+	.string	"_SC_DELAYTIMER_MAX _SC_DELAYTIMER_MAX"
+.LASF2187:
+	.string	"stdout"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1997:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1886:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF2144:
+	.string	"__time_t"
+.LASF1054:
+	.string	"ADJ_TIMECONST 0x0020"
+.LASF1113:
+	.string	"_POSIX_SAVED_IDS 1"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1727:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1608:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1326:
+	.string	"_SC_WORD_BIT _SC_WORD_BIT"
+.LASF1704:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1836:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1635:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1258:
+	.string	"_SC_COLL_WEIGHTS_MAX _SC_COLL_WEIGHTS_MAX"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1263:
+	.string	"_SC_CHARCLASS_NAME_MAX _SC_CHARCLASS_NAME_MAX"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2179:
+	.string	"_freeres_buf"
+.LASF1617:
+	.string	"TELEMETRY_IBUS"
+.LASF1037:
+	.string	"CLOCK_MONOTONIC 1"
+.LASF2339:
+	.string	"systemReset"
+.LASF793:
+	.string	"_____fpos64_t_defined 1"
+.LASF2340:
+	.string	"systemInit"
+.LASF1661:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF1824:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1668:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF823:
+	.string	"FILENAME_MAX 4096"
+.LASF2233:
+	.string	"OWNER_SDCARD"
+.LASF1339:
+	.string	"_SC_NL_LANGMAX _SC_NL_LANGMAX"
+.LASF1367:
+	.string	"_SC_FILE_SYSTEM _SC_FILE_SYSTEM"
+.LASF1029:
+	.string	"_STRING_H 1"
+.LASF1431:
+	.string	"_SC_THREAD_ROBUST_PRIO_INHERIT _SC_THREAD_ROBUST_PRIO_INHERIT"
+.LASF1508:
+	.string	"TEMP_FAILURE_RETRY(expression) (__extension__ ({ long int __result; do __result = (long int) (expression); while (__result == -1L && errno == EINTR); __result; }))"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1503:
+	.string	"_GETOPT_CORE_H 1"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1157:
+	.string	"_POSIX_BARRIERS 200809L"
+.LASF1320:
+	.string	"_SC_CHAR_BIT _SC_CHAR_BIT"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1141:
+	.string	"_LFS_ASYNCHRONOUS_IO 1"
+.LASF1181:
+	.string	"__ILP32_OFFBIG_CFLAGS \"-m32 -D_LARGEFILE_SOURCE -D_FILE_OFFSET_BITS=64\""
+.LASF1754:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1903:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1419:
+	.string	"_SC_IPV6 _SC_IPV6"
+.LASF2132:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1864:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2135:
+	.string	"signed char"
+.LASF857:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1804:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1359:
+	.string	"_SC_DEVICE_IO _SC_DEVICE_IO"
+.LASF1547:
+	.string	"USE_DASHBOARD "
+.LASF1317:
+	.string	"_SC_XOPEN_XPG2 _SC_XOPEN_XPG2"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1537:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF2056:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1409:
+	.string	"_SC_LEVEL1_DCACHE_LINESIZE _SC_LEVEL1_DCACHE_LINESIZE"
+.LASF1538:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1814:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1767:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1407:
+	.string	"_SC_LEVEL1_DCACHE_SIZE _SC_LEVEL1_DCACHE_SIZE"
+.LASF1597:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF882:
+	.string	"_WCHAR_T_H "
+.LASF1877:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1062:
+	.string	"MOD_OFFSET ADJ_OFFSET"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2054:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1688:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF971:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF963:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF813:
+	.string	"EOF (-1)"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1228:
+	.string	"_SC_TIMERS _SC_TIMERS"
+.LASF1073:
+	.string	"STA_PLL 0x0001"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF2320:
+	.string	"count"
+.LASF1402:
+	.string	"_SC_TRACE_INHERIT _SC_TRACE_INHERIT"
+.LASF1682:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1266:
+	.string	"_SC_2_C_DEV _SC_2_C_DEV"
+.LASF1355:
+	.string	"_SC_C_LANG_SUPPORT_R _SC_C_LANG_SUPPORT_R"
+.LASF1962:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1881:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1623:
+	.string	"VTX_TRAMP"
+.LASF1023:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1227:
+	.string	"_SC_PRIORITY_SCHEDULING _SC_PRIORITY_SCHEDULING"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF859:
+	.string	"__f64(x) x ##f64"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1980:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1229:
+	.string	"_SC_ASYNCHRONOUS_IO _SC_ASYNCHRONOUS_IO"
+.LASF2345:
+	.string	"delayMicroseconds"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1618:
+	.string	"USE_DASHBOARD"
+.LASF1536:
+	.string	"TELEMETRY_LTM "
+.LASF1171:
+	.string	"_POSIX_TRACE_LOG -1"
+.LASF2223:
+	.string	"OWNER_PINDEBUG"
+.LASF2121:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF1237:
+	.string	"_SC_MESSAGE_PASSING _SC_MESSAGE_PASSING"
+.LASF1002:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1213:
+	.string	"_PC_REC_XFER_ALIGN _PC_REC_XFER_ALIGN"
+.LASF899:
+	.string	"__WCLONE 0x80000000"
+.LASF1269:
+	.string	"_SC_2_SW_DEV _SC_2_SW_DEV"
+.LASF1112:
+	.string	"_POSIX_JOB_CONTROL 1"
+.LASF1697:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1485:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LDFLAGS _CS_POSIX_V7_ILP32_OFF32_LDFLAGS"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF997:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF2312:
+	.string	"timerInit"
+.LASF2157:
+	.string	"_IO_read_base"
+.LASF915:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF2007:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2150:
+	.string	"uint32_t"
+.LASF848:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF396:
+	.string	"__REVISION__ \"669c324\""
+.LASF2175:
+	.string	"_offset"
+.LASF2205:
+	.string	"SystemCoreClock"
+.LASF2255:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF1211:
+	.string	"_PC_REC_MAX_XFER_SIZE _PC_REC_MAX_XFER_SIZE"
+.LASF1639:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1093:
+	.string	"__isleap(year) ((year) % 4 == 0 && ((year) % 100 != 0 || (year) % 400 == 0))"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2162:
+	.string	"_IO_buf_end"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF1358:
+	.string	"_SC_THREAD_CPUTIME _SC_THREAD_CPUTIME"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF873:
+	.string	"__WCHAR_T__ "
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2000:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1505:
+	.string	"F_LOCK 1"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1559:
+	.string	"_ANSI_STDDEF_H "
+.LASF1945:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2248:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1082:
+	.string	"STA_PPSJITTER 0x0200"
+.LASF1478:
+	.string	"_CS_POSIX_V6_LP64_OFF64_LIBS _CS_POSIX_V6_LP64_OFF64_LIBS"
+.LASF1940:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1761:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2020:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1253:
+	.string	"_SC_TIMER_MAX _SC_TIMER_MAX"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1053:
+	.string	"ADJ_STATUS 0x0010"
+.LASF2119:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2282:
+	.string	"failureMode_e"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1074:
+	.string	"STA_PPSFREQ 0x0002"
+.LASF1722:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2181:
+	.string	"_mode"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1185:
+	.string	"STDIN_FILENO 0"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1109:
+	.string	"_XOPEN_ENH_I18N 1"
+.LASF1176:
+	.string	"_POSIX_V7_LP64_OFF64 1"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2158:
+	.string	"_IO_write_base"
+.LASF1525:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1796:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1315:
+	.string	"_SC_2_C_VERSION _SC_2_C_VERSION"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF818:
+	.string	"SEEK_HOLE 4"
+.LASF939:
+	.string	"__key_t_defined "
+.LASF1737:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF866:
+	.string	"_BITS_STDIO_H 1"
+.LASF858:
+	.string	"__f32(x) x ##f32"
+.LASF1195:
+	.string	"L_XTND SEEK_END"
+.LASF1866:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2088:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1275:
+	.string	"_SC_PII_OSI _SC_PII_OSI"
+.LASF815:
+	.string	"SEEK_CUR 1"
+.LASF966:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1958:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1694:
+	.string	"IOCFG_AF_OD 0"
+.LASF955:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1380:
+	.string	"_SC_THREAD_SPORADIC_SERVER _SC_THREAD_SPORADIC_SERVER"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1745:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1728:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1959:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1417:
+	.string	"_SC_LEVEL4_CACHE_ASSOC _SC_LEVEL4_CACHE_ASSOC"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1793:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1748:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF827:
+	.string	"FOPEN_MAX 16"
+.LASF2101:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1540:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1914:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1100:
+	.string	"_POSIX2_C_DEV __POSIX2_THIS_VERSION"
+.LASF1913:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1067:
+	.string	"MOD_TIMECONST ADJ_TIMECONST"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2113:
+	.string	"LED1_ON do {} while(0)"
+.LASF2106:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1709:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF2002:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2140:
+	.string	"long int"
+.LASF1287:
+	.string	"_SC_THREAD_SAFE_FUNCTIONS _SC_THREAD_SAFE_FUNCTIONS"
+.LASF1221:
+	.string	"_SC_OPEN_MAX _SC_OPEN_MAX"
+.LASF1797:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF801:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1928:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1458:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LIBS _CS_XBS5_ILP32_OFFBIG_LIBS"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1660:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1310:
+	.string	"_SC_XOPEN_UNIX _SC_XOPEN_UNIX"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF2310:
+	.string	"adcGetChannel"
+.LASF2184:
+	.string	"_IO_marker"
+.LASF1776:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1365:
+	.string	"_SC_FILE_ATTRIBUTES _SC_FILE_ATTRIBUTES"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF829:
+	.string	"stdin stdin"
+.LASF2043:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1007:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1172:
+	.string	"_POSIX_TYPED_MEMORY_OBJECTS -1"
+.LASF1564:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1676:
+	.string	"UNUSED(x) (void)(x)"
+.LASF2095:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1313:
+	.string	"_SC_XOPEN_SHM _SC_XOPEN_SHM"
+.LASF943:
+	.string	"__timer_t_defined 1"
+.LASF1296:
+	.string	"_SC_THREAD_ATTR_STACKADDR _SC_THREAD_ATTR_STACKADDR"
+.LASF1300:
+	.string	"_SC_THREAD_PRIO_PROTECT _SC_THREAD_PRIO_PROTECT"
+.LASF986:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF923:
+	.string	"EXIT_SUCCESS 0"
+.LASF1439:
+	.string	"_CS_GNU_LIBPTHREAD_VERSION _CS_GNU_LIBPTHREAD_VERSION"
+.LASF1876:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1090:
+	.string	"__struct_tm_defined 1"
+.LASF1060:
+	.string	"ADJ_OFFSET_SINGLESHOT 0x8001"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1582:
+	.string	"ACC "
+.LASF1132:
+	.string	"_POSIX_THREAD_ATTR_STACKADDR 200809L"
+.LASF1625:
+	.string	"USE_RESOURCE_MGMT"
+.LASF2003:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2103:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1423:
+	.string	"_SC_V7_LP64_OFF64 _SC_V7_LP64_OFF64"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF830:
+	.string	"stdout stdout"
+.LASF1674:
+	.string	"EXPAND_I(x) x"
+.LASF1852:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1401:
+	.string	"_SC_TRACE_EVENT_FILTER _SC_TRACE_EVENT_FILTER"
+.LASF826:
+	.string	"FOPEN_MAX"
+.LASF1943:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1616:
+	.string	"TELEMETRY_MAVLINK"
+.LASF2141:
+	.string	"__uint64_t"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF2185:
+	.string	"_IO_codecvt"
+.LASF1576:
+	.string	"U_ID_0 0"
+.LASF1169:
+	.string	"_POSIX_TRACE_EVENT_FILTER -1"
+.LASF1391:
+	.string	"_SC_2_PBS_TRACK _SC_2_PBS_TRACK"
+.LASF862:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1212:
+	.string	"_PC_REC_MIN_XFER_SIZE _PC_REC_MIN_XFER_SIZE"
+.LASF1774:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2300:
+	.string	"strtod"
+.LASF2152:
+	.string	"uintptr_t"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1081:
+	.string	"STA_PPSSIGNAL 0x0100"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1412:
+	.string	"_SC_LEVEL2_CACHE_LINESIZE _SC_LEVEL2_CACHE_LINESIZE"
+.LASF1976:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF2346:
+	.string	"millis"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF863:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF989:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1303:
+	.string	"_SC_NPROCESSORS_ONLN _SC_NPROCESSORS_ONLN"
+.LASF1703:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1659:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1170:
+	.string	"_POSIX_TRACE_INHERIT -1"
+.LASF887:
+	.string	"__DEFINED_wchar_t "
+.LASF804:
+	.string	"__cookie_io_functions_t_defined 1"
+.LASF1033:
+	.string	"_TIME_H 1"
+.LASF2275:
+	.string	"FAILURE_DEVELOPER"
+.LASF522:
+	.string	"__flexarr []"
+.LASF865:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1610:
+	.string	"TELEMETRY_FRSKY"
+.LASF2261:
+	.string	"timCCR_t"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1039:
+	.string	"CLOCK_THREAD_CPUTIME_ID 3"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF2041:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2082:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1506:
+	.string	"F_TLOCK 2"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF984:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2306:
+	.string	"nanosleep"
+.LASF875:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1792:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1841:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1096:
+	.string	"__POSIX2_THIS_VERSION 200809L"
+.LASF1555:
+	.string	"VTX_SMARTAUDIO "
+.LASF921:
+	.string	"RAND_MAX 2147483647"
+.LASF1867:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2224:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF2271:
+	.string	"useDshotTelemetry"
+.LASF1331:
+	.string	"_SC_SCHAR_MIN _SC_SCHAR_MIN"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1461:
+	.string	"_CS_XBS5_LP64_OFF64_LDFLAGS _CS_XBS5_LP64_OFF64_LDFLAGS"
+.LASF1975:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2316:
+	.string	"pwmAreMotorsEnabled"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1707:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF1254:
+	.string	"_SC_BC_BASE_MAX _SC_BC_BASE_MAX"
+.LASF1102:
+	.string	"_POSIX2_LOCALEDEF __POSIX2_THIS_VERSION"
+.LASF1390:
+	.string	"_SC_2_PBS_MESSAGE _SC_2_PBS_MESSAGE"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1138:
+	.string	"_POSIX_REALTIME_SIGNALS 200809L"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1265:
+	.string	"_SC_2_C_BIND _SC_2_C_BIND"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1210:
+	.string	"_PC_REC_INCR_XFER_SIZE _PC_REC_INCR_XFER_SIZE"
+.LASF1624:
+	.string	"BLACKBOX"
+.LASF1251:
+	.string	"_SC_SEM_VALUE_MAX _SC_SEM_VALUE_MAX"
+.LASF2147:
+	.string	"char"
+.LASF1008:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1450:
+	.string	"_CS_LFS64_LIBS _CS_LFS64_LIBS"
+.LASF1848:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1270:
+	.string	"_SC_2_LOCALEDEF _SC_2_LOCALEDEF"
+.LASF851:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2264:
+	.string	"enabled"
+.LASF1563:
+	.string	"__PTRDIFF_T "
+.LASF2046:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2105:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1932:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1064:
+	.string	"MOD_MAXERROR ADJ_MAXERROR"
+.LASF1290:
+	.string	"_SC_LOGIN_NAME_MAX _SC_LOGIN_NAME_MAX"
+.LASF2115:
+	.string	"LED2_OFF do {} while(0)"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF2208:
+	.string	"IO_t"
+.LASF2302:
+	.string	"sitlPhysicsInit"
+.LASF1321:
+	.string	"_SC_CHAR_MAX _SC_CHAR_MAX"
+.LASF790:
+	.string	"__GNUC_VA_LIST "
+.LASF1912:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF892:
+	.string	"WUNTRACED 2"
+.LASF2161:
+	.string	"_IO_buf_base"
+.LASF1104:
+	.string	"_XOPEN_XCU_VERSION 4"
+.LASF974:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1752:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF2006:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1760:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1920:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1087:
+	.string	"STA_MODE 0x4000"
+.LASF1607:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1550:
+	.string	"USE_RX_MSP "
+.LASF1670:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1894:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1342:
+	.string	"_SC_NL_SETMAX _SC_NL_SETMAX"
+.LASF1475:
+	.string	"_CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1163:
+	.string	"_POSIX_IPV6 200809L"
+.LASF1077:
+	.string	"STA_INS 0x0010"
+.LASF1364:
+	.string	"_SC_PIPE _SC_PIPE"
+.LASF1487:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LINTFLAGS _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS"
+.LASF1187:
+	.string	"STDERR_FILENO 2"
+.LASF1161:
+	.string	"_POSIX_CLOCK_SELECTION 200809L"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2128:
+	.string	"TCP_SERIAL_RX_BUFFER_SIZE 1024"
+.LASF2068:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2318:
+	.string	"ledInit"
+.LASF1328:
+	.string	"_SC_NZERO _SC_NZERO"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1322:
+	.string	"_SC_CHAR_MIN _SC_CHAR_MIN"
+.LASF2125:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF927:
+	.string	"_SYS_TYPES_H 1"
+.LASF1440:
+	.string	"_CS_V5_WIDTH_RESTRICTED_ENVS _CS_V5_WIDTH_RESTRICTED_ENVS"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF913:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF846:
+	.string	"__HAVE_FLOAT32 1"
+.LASF2192:
+	.string	"_IO_FILE"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF765:
+	.string	"__need_NULL "
+.LASF1488:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_CFLAGS _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS"
+.LASF1515:
+	.string	"I2C1_OVERCLOCK true"
+.LASF2186:
+	.string	"_IO_wide_data"
+.LASF1681:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1130:
+	.string	"_POSIX_THREAD_PRIORITY_SCHEDULING 200809L"
+.LASF1763:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1348:
+	.string	"_SC_XOPEN_LEGACY _SC_XOPEN_LEGACY"
+.LASF2190:
+	.string	"clockid_t"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1235:
+	.string	"_SC_MEMLOCK_RANGE _SC_MEMLOCK_RANGE"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF2270:
+	.string	"useUnsyncedPwm"
+.LASF2076:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF2236:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF1601:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1354:
+	.string	"_SC_C_LANG_SUPPORT _SC_C_LANG_SUPPORT"
+.LASF1630:
+	.string	"USE_PROFILE "
+.LASF1022:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1173:
+	.string	"_POSIX_V7_LPBIG_OFFBIG -1"
+.LASF1046:
+	.string	"CLOCK_TAI 11"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1368:
+	.string	"_SC_MONOTONIC_CLOCK _SC_MONOTONIC_CLOCK"
+.LASF1622:
+	.string	"VTX_SMARTAUDIO"
+.LASF1526:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1325:
+	.string	"_SC_LONG_BIT _SC_LONG_BIT"
+.LASF2228:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1813:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2220:
+	.string	"OWNER_ADC_RSSI"
+.LASF1922:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1206:
+	.string	"_PC_ASYNC_IO _PC_ASYNC_IO"
+.LASF1481:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS"
+.LASF1603:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1222:
+	.string	"_SC_STREAM_MAX _SC_STREAM_MAX"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF982:
+	.string	"__sigset_t_defined 1"
+.LASF1514:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1791:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1829:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1036:
+	.string	"CLOCK_REALTIME 0"
+.LASF889:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1766:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1562:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1426:
+	.string	"_SC_TRACE_EVENT_NAME_MAX _SC_TRACE_EVENT_NAME_MAX"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1583:
+	.string	"USE_FAKE_ACC "
+.LASF2291:
+	.string	"sitlPhysicsSetMotor"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF2202:
+	.string	"FLASH_COMPLETE"
+.LASF2018:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1954:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1040:
+	.string	"CLOCK_MONOTONIC_RAW 4"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1577:
+	.string	"U_ID_1 1"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF854:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1917:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF937:
+	.string	"__id_t_defined "
+.LASF1595:
+	.string	"USE_UART8 "
+.LASF2195:
+	.string	"tv_nsec"
+.LASF1493:
+	.string	"_CS_POSIX_V7_LP64_OFF64_LDFLAGS _CS_POSIX_V7_LP64_OFF64_LDFLAGS"
+.LASF1363:
+	.string	"_SC_FIFO _SC_FIFO"
+.LASF1020:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF908:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1091:
+	.string	"__itimerspec_defined 1"
+.LASF1314:
+	.string	"_SC_2_CHAR_TERM _SC_2_CHAR_TERM"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1874:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2049:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2028:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1376:
+	.string	"_SC_SHELL _SC_SHELL"
+.LASF1995:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1019:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1982:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1385:
+	.string	"_SC_USER_GROUPS _SC_USER_GROUPS"
+.LASF1910:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2071:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF938:
+	.string	"__daddr_t_defined "
+.LASF1080:
+	.string	"STA_FREQHOLD 0x0080"
+.LASF1847:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1076:
+	.string	"STA_FLL 0x0008"
+.LASF1124:
+	.string	"_XOPEN_REALTIME 1"
+.LASF1312:
+	.string	"_SC_XOPEN_ENH_I18N _SC_XOPEN_ENH_I18N"
+.LASF2166:
+	.string	"_markers"
+.LASF898:
+	.string	"__WALL 0x40000000"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1386:
+	.string	"_SC_USER_GROUPS_R _SC_USER_GROUPS_R"
+.LASF2231:
+	.string	"OWNER_I2C_SCL"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1063:
+	.string	"MOD_FREQUENCY ADJ_FREQUENCY"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF953:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1949:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF967:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF382:
+	.string	"unix 1"
+.LASF1501:
+	.string	"_CS_V7_ENV _CS_V7_ENV"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1336:
+	.string	"_SC_ULONG_MAX _SC_ULONG_MAX"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1160:
+	.string	"_POSIX_MONOTONIC_CLOCK 0"
+.LASF1768:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1427:
+	.string	"_SC_TRACE_NAME_MAX _SC_TRACE_NAME_MAX"
+.LASF1005:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1683:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF910:
+	.string	"__W_CONTINUED 0xffff"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1182:
+	.string	"__ILP32_OFFBIG_LDFLAGS \"-m32\""
+.LASF1518:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF831:
+	.string	"stderr stderr"
+.LASF2083:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2317:
+	.string	"pwmGetMotors"
+.LASF1965:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"_SC_SHARED_MEMORY_OBJECTS _SC_SHARED_MEMORY_OBJECTS"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF1361:
+	.string	"_SC_DEVICE_SPECIFIC_R _SC_DEVICE_SPECIFIC_R"
+.LASF1294:
+	.string	"_SC_THREAD_STACK_MIN _SC_THREAD_STACK_MIN"
+.LASF1071:
+	.string	"MOD_MICRO ADJ_MICRO"
+.LASF1821:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF970:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1069:
+	.string	"MOD_CLKA ADJ_OFFSET_SINGLESHOT"
+.LASF1297:
+	.string	"_SC_THREAD_ATTR_STACKSIZE _SC_THREAD_ATTR_STACKSIZE"
+.LASF1679:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF867:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF2145:
+	.string	"__clockid_t"
+.LASF1194:
+	.string	"L_INCR SEEK_CUR"
+.LASF951:
+	.string	"__PDP_ENDIAN 3412"
+.LASF2229:
+	.string	"OWNER_SPI_MISO"
+.LASF1726:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1489:
+	.string	"_CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2254:
+	.string	"OWNER_COMPASS_CS"
+.LASF1713:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1581:
+	.string	"USE_FAKE_GYRO "
+.LASF1749:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF954:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1183:
+	.string	"__LP64_OFF64_CFLAGS \"-m64\""
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1456:
+	.string	"_CS_XBS5_ILP32_OFFBIG_CFLAGS _CS_XBS5_ILP32_OFFBIG_CFLAGS"
+.LASF1826:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2066:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF879:
+	.string	"_BSD_WCHAR_T_ "
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1849:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1892:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF836:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF920:
+	.string	"__lldiv_t_defined 1"
+.LASF1557:
+	.string	"_STDDEF_H "
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2341:
+	.string	"speed"
+.LASF1644:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1395:
+	.string	"_SC_V6_ILP32_OFF32 _SC_V6_ILP32_OFF32"
+.LASF2257:
+	.string	"statusLedConfig_s"
+.LASF2260:
+	.string	"statusLedConfig_t"
+.LASF2307:
+	.string	"clock_gettime"
+.LASF1012:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF802:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF2232:
+	.string	"OWNER_I2C_SDA"
+.LASF2139:
+	.string	"__uint32_t"
+.LASF2304:
+	.string	"printf"
+.LASF1592:
+	.string	"USE_UART5 "
+.LASF2295:
+	.string	"execl"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1808:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF905:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF930:
+	.string	"__ino64_t_defined "
+.LASF1978:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1316:
+	.string	"_SC_2_UPE _SC_2_UPE"
+.LASF1665:
+	.string	"Q12 (1 << 12)"
+.LASF1244:
+	.string	"_SC_MQ_OPEN_MAX _SC_MQ_OPEN_MAX"
+.LASF1520:
+	.string	"USE_CLI "
+.LASF1890:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2023:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2293:
+	.string	"fprintf"
+.LASF2298:
+	.string	"fopen"
+.LASF2021:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1420:
+	.string	"_SC_RAW_SOCKETS _SC_RAW_SOCKETS"
+.LASF1356:
+	.string	"_SC_CLOCK_SELECTION _SC_CLOCK_SELECTION"
+.LASF833:
+	.string	"RENAME_EXCHANGE (1 << 1)"
+.LASF2237:
+	.string	"OWNER_FLASH"
+.LASF2058:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1862:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF1241:
+	.string	"_SC_AIO_MAX _SC_AIO_MAX"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF871:
+	.string	"__need_wchar_t "
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1072:
+	.string	"MOD_NANO ADJ_NANO"
+.LASF1957:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1302:
+	.string	"_SC_NPROCESSORS_CONF _SC_NPROCESSORS_CONF"
+.LASF999:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1236:
+	.string	"_SC_MEMORY_PROTECTION _SC_MEMORY_PROTECTION"
+.LASF897:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF825:
+	.string	"L_cuserid 9"
+.LASF1988:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1969:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF977:
+	.string	"_SYS_SELECT_H 1"
+.LASF1811:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF2338:
+	.string	"systemResetToBootloader"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1558:
+	.string	"_STDDEF_H_ "
+.LASF1191:
+	.string	"X_OK 1"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1725:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF2074:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1743:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF810:
+	.string	"_IOLBF 1"
+.LASF1828:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1180:
+	.string	"__ILP32_OFF32_LDFLAGS \"-m32\""
+.LASF1944:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2303:
+	.string	"setvbuf"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1065:
+	.string	"MOD_ESTERROR ADJ_ESTERROR"
+.LASF1952:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF807:
+	.string	"__off64_t_defined "
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1006:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1787:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1025:
+	.string	"_ALLOCA_H 1"
+.LASF1307:
+	.string	"_SC_PASS_MAX _SC_PASS_MAX"
+.LASF2080:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1861:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1927:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF791:
+	.string	"_____fpos_t_defined 1"
+.LASF2249:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1554:
+	.string	"VTX_CONTROL "
+.LASF2097:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1963:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2252:
+	.string	"OWNER_TRANSPONDER"
+.LASF1260:
+	.string	"_SC_EXPR_NEST_MAX _SC_EXPR_NEST_MAX"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1770:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2117:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1280:
+	.string	"_SC_PII_INTERNET_STREAM _SC_PII_INTERNET_STREAM"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1486:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_LIBS _CS_POSIX_V7_ILP32_OFF32_LIBS"
+.LASF1657:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF2287:
+	.string	"motors"
+.LASF1565:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF877:
+	.string	"__WCHAR_T "
+.LASF1199:
+	.string	"_PC_NAME_MAX _PC_NAME_MAX"
+.LASF1502:
+	.string	"_GETOPT_POSIX_H 1"
+.LASF2305:
+	.string	"getenv"
+.LASF1935:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF928:
+	.string	"__u_char_defined "
+.LASF1128:
+	.string	"_POSIX_REENTRANT_FUNCTIONS 1"
+.LASF1035:
+	.string	"CLOCKS_PER_SEC ((__clock_t) 1000000)"
+.LASF1873:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1050:
+	.string	"ADJ_FREQUENCY 0x0002"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF990:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF2194:
+	.string	"tv_sec"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2342:
+	.string	"eepromSave"
+.LASF853:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF2274:
+	.string	"timeUs_t"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1136:
+	.string	"_POSIX_THREAD_ROBUST_PRIO_PROTECT -1"
+.LASF2196:
+	.string	"long long unsigned int"
+.LASF929:
+	.string	"__ino_t_defined "
+.LASF2333:
+	.string	"offset"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1340:
+	.string	"_SC_NL_MSGMAX _SC_NL_MSGMAX"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF2171:
+	.string	"_cur_column"
+.LASF1078:
+	.string	"STA_DEL 0x0020"
+.LASF1413:
+	.string	"_SC_LEVEL3_CACHE_SIZE _SC_LEVEL3_CACHE_SIZE"
+.LASF1110:
+	.string	"_XOPEN_LEGACY 1"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2239:
+	.string	"OWNER_MPU_CS"
+.LASF2242:
+	.string	"OWNER_SPI_CS"
+.LASF1698:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2143:
+	.string	"__off64_t"
+.LASF1218:
+	.string	"_SC_CHILD_MAX _SC_CHILD_MAX"
+.LASF838:
+	.string	"__HAVE_FLOAT128 1"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2057:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1415:
+	.string	"_SC_LEVEL3_CACHE_LINESIZE _SC_LEVEL3_CACHE_LINESIZE"
+.LASF2022:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF1089:
+	.string	"STA_RONLY (STA_PPSSIGNAL | STA_PPSJITTER | STA_PPSWANDER | STA_PPSERROR | STA_CLOCKERR | STA_NANO | STA_MODE | STA_CLK)"
+.LASF1223:
+	.string	"_SC_TZNAME_MAX _SC_TZNAME_MAX"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1447:
+	.string	"_CS_LFS_LINTFLAGS _CS_LFS_LINTFLAGS"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1586:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF1378:
+	.string	"_SC_SPAWN _SC_SPAWN"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1335:
+	.string	"_SC_UINT_MAX _SC_UINT_MAX"
+.LASF1960:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1492:
+	.string	"_CS_POSIX_V7_LP64_OFF64_CFLAGS _CS_POSIX_V7_LP64_OFF64_CFLAGS"
+.LASF1684:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF2099:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1964:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF837:
+	.string	"_BITS_FLOATN_H "
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1123:
+	.string	"_POSIX_NO_TRUNC 1"
+.LASF1675:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2024:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1196:
+	.string	"_PC_LINK_MAX _PC_LINK_MAX"
+.LASF1278:
+	.string	"_SC_UIO_MAXIOV _SC_UIO_MAXIOV"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1637:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1452:
+	.string	"_CS_XBS5_ILP32_OFF32_CFLAGS _CS_XBS5_ILP32_OFF32_CFLAGS"
+.LASF1366:
+	.string	"_SC_FILE_LOCKING _SC_FILE_LOCKING"
+.LASF2284:
+	.string	"startTime"
+.LASF901:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1264:
+	.string	"_SC_2_VERSION _SC_2_VERSION"
+.LASF1449:
+	.string	"_CS_LFS64_LDFLAGS _CS_LFS64_LDFLAGS"
+.LASF1246:
+	.string	"_SC_VERSION _SC_VERSION"
+.LASF1795:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1030:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF2164:
+	.string	"_IO_backup_base"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1685:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1528:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1357:
+	.string	"_SC_CPUTIME _SC_CPUTIME"
+.LASF2155:
+	.string	"_IO_read_ptr"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF812:
+	.string	"BUFSIZ 8192"
+.LASF2217:
+	.string	"OWNER_ADC_BATT"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2108:
+	.string	"LED0_TOGGLE do {} while(0)"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1484:
+	.string	"_CS_POSIX_V7_ILP32_OFF32_CFLAGS _CS_POSIX_V7_ILP32_OFF32_CFLAGS"
+.LASF1150:
+	.string	"_POSIX_REGEXP 1"
+.LASF1214:
+	.string	"_PC_ALLOC_SIZE_MIN _PC_ALLOC_SIZE_MIN"
+.LASF918:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF2281:
+	.string	"FAILURE_GYRO_INIT_FAILED"
+.LASF1032:
+	.string	"_STRINGS_H 1"
+.LASF1398:
+	.string	"_SC_V6_LPBIG_OFFBIG _SC_V6_LPBIG_OFFBIG"
+.LASF1511:
+	.string	"CLOSE_RANGE_CLOEXEC (1U << 2)"
+.LASF808:
+	.string	"__ssize_t_defined "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1057:
+	.string	"ADJ_MICRO 0x1000"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1739:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF2178:
+	.string	"_freeres_list"
+.LASF794:
+	.string	"____FILE_defined 1"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF2201:
+	.string	"FLASH_ERROR_WRP"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF996:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1758:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1225:
+	.string	"_SC_SAVED_IDS _SC_SAVED_IDS"
+.LASF2211:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF855:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1842:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1410:
+	.string	"_SC_LEVEL2_CACHE_SIZE _SC_LEVEL2_CACHE_SIZE"
+.LASF2063:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1238:
+	.string	"_SC_SEMAPHORES _SC_SEMAPHORES"
+.LASF1632:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1147:
+	.string	"_POSIX_SHARED_MEMORY_OBJECTS 200809L"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1924:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1362:
+	.string	"_SC_FD_MGMT _SC_FD_MGMT"
+.LASF1004:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1049:
+	.string	"ADJ_OFFSET 0x0001"
+.LASF1162:
+	.string	"_POSIX_ADVISORY_INFO 200809L"
+.LASF1027:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1425:
+	.string	"_SC_SS_REPL_MAX _SC_SS_REPL_MAX"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2170:
+	.string	"_old_offset"
+.LASF1061:
+	.string	"ADJ_OFFSET_SS_READ 0xa001"
+.LASF400:
+	.string	"bool _Bool"
+.LASF1566:
+	.string	"___int_ptrdiff_t_h "
+.LASF1451:
+	.string	"_CS_LFS64_LINTFLAGS _CS_LFS64_LINTFLAGS"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1742:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1134:
+	.string	"_POSIX_THREAD_PRIO_PROTECT 200809L"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1031:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1106:
+	.string	"_XOPEN_XPG3 1"
+.LASF1532:
+	.string	"LED_STRIP "
+.LASF994:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF1529:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1716:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF965:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1602:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1545:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF993:
+	.string	"NFDBITS __NFDBITS"
+.LASF2189:
+	.string	"long long int"
+.LASF1950:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1397:
+	.string	"_SC_V6_LP64_OFF64 _SC_V6_LP64_OFF64"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1444:
+	.string	"_CS_LFS_CFLAGS _CS_LFS_CFLAGS"
+.LASF1702:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF2169:
+	.string	"_flags2"
+.LASF1387:
+	.string	"_SC_2_PBS _SC_2_PBS"
+.LASF1289:
+	.string	"_SC_GETPW_R_SIZE_MAX _SC_GETPW_R_SIZE_MAX"
+.LASF922:
+	.string	"EXIT_FAILURE 1"
+.LASF1483:
+	.string	"_CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS"
+.LASF1084:
+	.string	"STA_PPSERROR 0x0800"
+.LASF2234:
+	.string	"OWNER_SDCARD_CS"
+.LASF912:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF2301:
+	.string	"tcpSerialPollAll"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1350:
+	.string	"_SC_XOPEN_REALTIME_THREADS _SC_XOPEN_REALTIME_THREADS"
+.LASF2279:
+	.string	"FAILURE_INVALID_EEPROM_CONTENTS"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1757:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1083:
+	.string	"STA_PPSWANDER 0x0400"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1148:
+	.string	"_POSIX_CPUTIME 0"
+.LASF800:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1523:
+	.string	"SERIAL_RX "
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1466:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_LIBS _CS_XBS5_LPBIG_OFFBIG_LIBS"
+.LASF1721:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1706:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1304:
+	.string	"_SC_PHYS_PAGES _SC_PHYS_PAGES"
+.LASF1018:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2266:
+	.string	"motorDevConfig_s"
+.LASF2273:
+	.string	"motorDevConfig_t"
+.LASF1588:
+	.string	"USE_UART1 "
+.LASF902:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF2044:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1324:
+	.string	"_SC_INT_MIN _SC_INT_MIN"
+.LASF1990:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1839:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1454:
+	.string	"_CS_XBS5_ILP32_OFF32_LIBS _CS_XBS5_ILP32_OFF32_LIBS"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF2084:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1641:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1433:
+	.string	"_SC_MINSIGSTKSZ _SC_MINSIGSTKSZ"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1099:
+	.string	"_POSIX2_C_BIND __POSIX2_THIS_VERSION"
+.LASF2112:
+	.string	"LED1_OFF do {} while(0)"
+.LASF1941:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1305:
+	.string	"_SC_AVPHYS_PAGES _SC_AVPHYS_PAGES"
+.LASF1596:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1021:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1448:
+	.string	"_CS_LFS64_CFLAGS _CS_LFS64_CFLAGS"
+.LASF1234:
+	.string	"_SC_MEMLOCK _SC_MEMLOCK"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2134:
+	.string	"long unsigned int"
+.LASF1699:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2251:
+	.string	"OWNER_LED_STRIP"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1589:
+	.string	"USE_UART2 "
+.LASF1553:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1556:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1268:
+	.string	"_SC_2_FORT_RUN _SC_2_FORT_RUN"
+.LASF1647:
+	.string	"__disable_irq() "
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1455:
+	.string	"_CS_XBS5_ILP32_OFF32_LINTFLAGS _CS_XBS5_ILP32_OFF32_LINTFLAGS"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1621:
+	.string	"VTX_CONTROL"
+.LASF1198:
+	.string	"_PC_MAX_INPUT _PC_MAX_INPUT"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF925:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2334:
+	.string	"FLASH_Lock"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1974:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1151:
+	.string	"_POSIX_READER_WRITER_LOCKS 200809L"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1893:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1204:
+	.string	"_PC_VDISABLE _PC_VDISABLE"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1232:
+	.string	"_SC_FSYNC _SC_FSYNC"
+.LASF1729:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1178:
+	.string	"_XBS5_LP64_OFF64 1"
+.LASF1590:
+	.string	"USE_UART3 "
+.LASF1240:
+	.string	"_SC_AIO_LISTIO_MAX _SC_AIO_LISTIO_MAX"
+.LASF2127:
+	.string	"TCP_SERIAL_BASE_PORT 5760"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1649:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1946:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1125:
+	.string	"_XOPEN_REALTIME_THREADS 1"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1717:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1446:
+	.string	"_CS_LFS_LIBS _CS_LFS_LIBS"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF2325:
+	.string	"motorDevInit"
+.LASF1142:
+	.string	"_POSIX_PRIORITIZED_IO 200809L"
+.LASF1700:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2238:
+	.string	"OWNER_BARO_CS"
+.LASF1652:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2344:
+	.string	"delay"
+.LASF1430:
+	.string	"_SC_XOPEN_STREAMS _SC_XOPEN_STREAMS"
+.LASF1656:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1131:
+	.string	"_POSIX_THREAD_ATTR_STACKSIZE 200809L"
+.LASF1648:
+	.string	"__enable_irq() "
+.LASF2133:
+	.string	"unsigned int"
+.LASF1591:
+	.string	"USE_UART4 "
+.LASF1471:
+	.string	"_CS_POSIX_V6_ILP32_OFF32_LINTFLAGS _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS"
+.LASF1908:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF976:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1878:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1981:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1332:
+	.string	"_SC_SHRT_MAX _SC_SHRT_MAX"
+.LASF1464:
+	.string	"_CS_XBS5_LPBIG_OFFBIG_CFLAGS _CS_XBS5_LPBIG_OFFBIG_CFLAGS"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1669:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2008:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1794:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1167:
+	.string	"_POSIX_THREAD_SPORADIC_SERVER -1"
+.LASF2216:
+	.string	"OWNER_ADC"
+.LASF2136:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2243:
+	.string	"OWNER_MPU_EXTI"
+.LASF1816:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1140:
+	.string	"_POSIX_ASYNC_IO 1"
+.LASF1301:
+	.string	"_SC_THREAD_PROCESS_SHARED _SC_THREAD_PROCESS_SHARED"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1809:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2126:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1837:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2047:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF1329:
+	.string	"_SC_SSIZE_MAX _SC_SSIZE_MAX"
+.LASF2172:
+	.string	"_vtable_offset"
+.LASF2276:
+	.string	"FAILURE_MISSING_ACC"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF992:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF1615:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF2219:
+	.string	"OWNER_ADC_EXT"
+.LASF1231:
+	.string	"_SC_SYNCHRONIZED_IO _SC_SYNCHRONIZED_IO"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1790:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF2348:
+	.string	"micros"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2352:
+	.string	"_IO_lock_t"
+.LASF1643:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2240:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2034:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1569:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1457:
+	.string	"_CS_XBS5_ILP32_OFFBIG_LDFLAGS _CS_XBS5_ILP32_OFFBIG_LDFLAGS"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF916:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2027:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1695:
+	.string	"IOCFG_IPD 0"
+.LASF1818:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2077:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF1593:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF2280:
+	.string	"FAILURE_FLASH_WRITE_FAILED"
+.LASF1840:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2432:
+	.string	"thread-shared-types.h"
+.LASF2383:
+	.string	"pwm_output.h"
+.LASF2366:
+	.string	"/usr/include"
+.LASF2427:
+	.string	"select.h"
+.LASF2416:
+	.string	"floatn-common.h"
+.LASF2370:
+	.string	"stdint.h"
+.LASF2462:
+	.string	"stack_check.h"
+.LASF2354:
+	.string	"src/main/build"
+.LASF2363:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2409:
+	.string	"__fpos_t.h"
+.LASF2384:
+	.string	"time.h"
+.LASF2398:
+	.string	"wordsize.h"
+.LASF2358:
+	.string	"src/main/target/SITL"
+.LASF2435:
+	.string	"struct_mutex.h"
+.LASF2431:
+	.string	"pthreadtypes.h"
+.LASF2445:
+	.string	"confname.h"
+.LASF2452:
+	.string	"common_post.h"
+.LASF2444:
+	.string	"environments.h"
+.LASF2447:
+	.string	"getopt_core.h"
+.LASF2362:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2395:
+	.string	"libc-header-start.h"
+.LASF2422:
+	.string	"timer_t.h"
+.LASF2450:
+	.string	"platform.h"
+.LASF2367:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2410:
+	.string	"__mbstate_t.h"
+.LASF2380:
+	.string	"resource.h"
+.LASF2434:
+	.string	"atomic_wide_counter.h"
+.LASF2442:
+	.string	"struct_itimerspec.h"
+.LASF2375:
+	.string	"clockid_t.h"
+.LASF2389:
+	.string	"unistd.h"
+.LASF2381:
+	.string	"light_led.h"
+.LASF2460:
+	.string	"build_config.h"
+.LASF2393:
+	.string	"stdc-predef.h"
+.LASF2441:
+	.string	"struct_tm.h"
+.LASF2423:
+	.string	"endian.h"
+.LASF2396:
+	.string	"features.h"
+.LASF2360:
+	.string	"src/main"
+.LASF2373:
+	.string	"FILE.h"
+.LASF2405:
+	.string	"time64.h"
+.LASF2391:
+	.string	"serial_tcp.h"
+.LASF2356:
+	.string	"src/main/config"
+.LASF2361:
+	.string	"/usr/include/linux"
+.LASF2429:
+	.string	"__sigset_t.h"
+.LASF2397:
+	.string	"features-time64.h"
+.LASF2439:
+	.string	"strings.h"
+.LASF2425:
+	.string	"byteswap.h"
+.LASF2402:
+	.string	"stubs.h"
+.LASF2386:
+	.string	"target.c"
+.LASF2417:
+	.string	"waitflags.h"
+.LASF2378:
+	.string	"target.h"
+.LASF2457:
+	.string	"io_def.h"
+.LASF2418:
+	.string	"waitstatus.h"
+.LASF2453:
+	.string	"maths.h"
+.LASF2406:
+	.string	"wchar.h"
+.LASF2399:
+	.string	"timesize.h"
+.LASF2355:
+	.string	"src/main/common"
+.LASF2365:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2387:
+	.string	"sitl_physics.h"
+.LASF2449:
+	.string	"close_range.h"
+.LASF2461:
+	.string	"rcc_types.h"
+.LASF2413:
+	.string	"cookie_io_functions_t.h"
+.LASF2376:
+	.string	"time_t.h"
+.LASF2371:
+	.string	"stddef.h"
+.LASF2415:
+	.string	"floatn.h"
+.LASF2451:
+	.string	"common.h"
+.LASF2382:
+	.string	"timer.h"
+.LASF2403:
+	.string	"stubs-64.h"
+.LASF2456:
+	.string	"io.h"
+.LASF2459:
+	.string	"parameter_group.h"
+.LASF0:
+	.string	"./src/main/target/SITL/target.c"
+.LASF2411:
+	.string	"__fpos64_t.h"
+.LASF2458:
+	.string	"io_def_generated.h"
+.LASF2426:
+	.string	"uintn-identity.h"
+.LASF2448:
+	.string	"unistd_ext.h"
+.LASF2424:
+	.string	"endianness.h"
+.LASF2369:
+	.string	"stdint-uintn.h"
+.LASF2374:
+	.string	"stdio.h"
+.LASF2421:
+	.string	"clock_t.h"
+.LASF2372:
+	.string	"struct_FILE.h"
+.LASF2455:
+	.string	"adc.h"
+.LASF2401:
+	.string	"long-double.h"
+.LASF2400:
+	.string	"cdefs.h"
+.LASF2408:
+	.string	"stdarg.h"
+.LASF2454:
+	.string	"utils.h"
+.LASF2404:
+	.string	"typesizes.h"
+.LASF2443:
+	.string	"posix_opt.h"
+.LASF2419:
+	.string	"locale_t.h"
+.LASF2359:
+	.string	"src/main/target"
+.LASF2357:
+	.string	"src/main/drivers"
+.LASF2385:
+	.string	"system.h"
+.LASF2394:
+	.string	"stdbool.h"
+.LASF2428:
+	.string	"sigset_t.h"
+.LASF2463:
+	.string	"serial.h"
+.LASF2392:
+	.string	"stdlib-float.h"
+.LASF2414:
+	.string	"stdio_lim.h"
+.LASF2388:
+	.string	"stdlib.h"
+.LASF2412:
+	.string	"__FILE.h"
+.LASF2377:
+	.string	"struct_timespec.h"
+.LASF2430:
+	.string	"struct_timeval.h"
+.LASF2407:
+	.string	"stdint-intn.h"
+.LASF2437:
+	.string	"alloca.h"
+.LASF2446:
+	.string	"getopt_posix.h"
+.LASF2440:
+	.string	"timex.h"
+.LASF2420:
+	.string	"__locale_t.h"
+.LASF2368:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2436:
+	.string	"struct_rwlock.h"
+.LASF2438:
+	.string	"stdlib-bsearch.h"
+.LASF2390:
+	.string	"string.h"
+.LASF2433:
+	.string	"pthreadtypes-arch.h"
+.LASF2379:
+	.string	"io_types.h"
+.LASF2364:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"E\t"
+	.string	"$\017_\001"
+	.string	"$"
+	.string	"\353\301\337\223\002\n\002"
+	.string	"\002\001\001\002\001\001\240\342\234\212\n\002\273\214\233\367\b"
+	.string	"\003\004\350\320\256\372\t\002\006\315\335\317\264\t\002\002\003\002\003\007\315\343\301\244\013\b\t\201\327\344\341\005\n\347\261\254\270\001\b\001\002\001\013\377\205\205\214\003"
+	.string	"\f\305\260\343\346\007\006\003\002\003\016\316\360\237\350\r"
+	.string	"\017\221\227\363\210\007"
+	.string	"\020\373\245\357\226\r\002\021\274\205\242\255\006"
+	.string	"\022\262\374\202\245\005"
+	.string	"\023\232\306\235\215\006"
+	.string	"\024\213\315\214\313\016\002\002\004\002\004\025\301\313\214\224\001\006\002\005\002\005\002\006\002\007\002\006\002\006\026\240\342\234\212\n\027\030\352\263\360\321\b\031\271\305\270\301\013\002\032\210\345\211\225\006\004\033\327\255\302\222\007\002\034\313\322\375\213\007"
+	.string	"\035\350\300\306\254\005\002\036\037\354\301\314\336\005"
+	.string	" !\"\317\253\250\341\002"
+	.string	"#\222\252\354\340\007"
+	.string	"$%\313\261\312\240\f"
+	.string	"\025"
+	.ascii	"`T\225!b\006\377xX\242\241\024&Lf\200\245\302@*\376\246\034\264"
+	.ascii	"cl\3036\006m;\006\005J\231\371\331\n\232\020pl\207)\254\335I"
+	.ascii	"\005\030\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\017"
+	.string	"5\004"
+	.string	"\362\005\017\017P^2\034\263\004\0352\024\251\222\327\227d\n\316\307t\254\261\214]\274b\023sM\304\301\360\027VT\216\2604X\335\024\004\026\260}\025A?\277\2637\314\222\234\211\310\233v\272|\001\037"
+	.ascii	"F\205\033!<\252\020,r\315 T\230\b-\027\367$\244\031\001g0OI\031"
+	.ascii	"B\r\210+T\020\315\005;&\355\031\230\312\0204\0047Lb\252\272*"
+	.ascii	"7X\214\270\352\003\313Pvi\256\340\"\b\"\344\356)\300\020"
+	.text
+	.section	.gnu.lto_.inline.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\370\004e\020"
+	.string	"\326\022D90\257\322\001pY\202#(\007\335\372\256\352\234\377\325n|0M\357\233\002\213\311\275,%\341a(\\\307/\005ADDD\204\372\223\235)2\241\357\223O\b!\020\264\245\224)0"
+	.string	"2"
+	.string	"8"
+	.ascii	"\247-\271\201"
+	.string	"d|\364\362?\207\2738~\342\370\363\377\215\034I\324F\300\244d\240\257\376 \357w\304\375\245\355\356\236\373\253ii\335\035\316\207\236\251\005Ks\255bD\007\027\266\241\273S\277\226\330\365\351U\232x\243\273=\232\325\353\371\264)\335\335\231^\2479i]\373\263i/\272\333;w\0163\016!.\\\0250\330\004\230\342\331\013\007\313\354d$\265\216\316\003\224\264\253\207\023\215\331\355lE\004\205s\200\022{\376\363;\027G\036\273\273\373\344\374zI\021^\325S\223Xk$D\005W\020% \034\030\024\214B\004\367\350\356\315\007\364\0306\326\313cX\b\033\353\365]@\034y\257k\241\"\361\321\035t\251\227\247m\211\265T!\257\256\336b-\325\367Ot\250qE35R\233\3122\007\200\242\221\252\272\003\022\200TMdI\243\b\023\314\310H$\201HPT\354\0328\344\322\245k\256C\327\202\343\361;\241\211\020\326"
+	.ascii	"DC6\367T\r\310a%\246\317H\201\310\004\356\335\342D\272\360\r"
+	.ascii	"9>\302/\217)+\203\270VW\241{\350Z\250\231\352\204\273\363\030"
+	.ascii	"\201\241\215\031\222fD\0269\004\205\322N\237\260XvH\232?\275"
+	.ascii	"\203Vo\336\024\263\nvk\212U\016\253\306th\340~y\177\200P\222"
+	.ascii	"\246\265\215p\245#\301]\360\257\267\212\256\272b\004\2220$69"
+	.ascii	",\033\353}\370Uf\2578\233\334Xt\245j\220D\312\020\333\217Kr\217"
+	.ascii	"\205_\370\to\035Kr\206\234\360\202\340\0227\251\326\212\306j"
+	.ascii	"!\021\343B\032r1\033\017Qh+\305\322_T2\274\322\002T#\243}At\323"
+	.ascii	"N\316bH\356\213[j\004fA\260\251\333B\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`Y\005\335\026"
+	.string	"\306cxD\020q\233\016\231M"
+	.string	"\212#^\220\024@\005\364\203"
+	.string	"\200\""
+	.string	"E \357Z\220\027\374}\247\266n\356v\333k\261\243\210)\306L\265+7F\221R\350\343O\365\342:\213\231\332\341v\016s\375\326\326\215m\313\224\002["
+	.string	"g"
+	.string	"d"
+	.ascii	"_\374+\333 \266\247m\022V\244X&h\301\212R\306m\3523\276\366'"
+	.ascii	"\\~-\023D\261\"e\177\373\362\262//7\016\271\377%S\204l\234\366"
+	.ascii	"\267\373m\235`\307\212\326\204a\030\3761~\030\007M\360V\224\366"
+	.ascii	"~7\311\337$\367>-\005s\n\346\356|)\333\033\363\260?@\004\006"
+	.ascii	"\246\257\t\037\206 \005l\023\260\007|\324\205\t>\307n\366\373"
+	.ascii	"\213\304x\214\222a\202\247\241\351\334\206\307(\032&\370\027"
+	.ascii	"\326?\"\007\331a\202wa\305\357\303\004\337\302\212r\355\020\004"
+	.ascii	"\033\317\302\212k\217^\343\"\250o\304\004\277\302\212%&h\302"
+	.ascii	"\212\322\276c\344\256\310\235\001v\034\200\216s\322Cm\306\036"
+	.ascii	"\255\212\02357\306\272\350M\303LD\\7\2525\343\212\304\241\"\256"
+	.ascii	"\313(H\3136\316\205f\034%U\017\005FK\034\372\251\237\213\013"
+	.ascii	"Q\226\r!<*"
+	.string	"+\022lC\260\037T\016\354\0066\245%6\211\275\261\031x\004\307\177\343\325\0278\206\341{|#\375\215\334?|f\277JA\265_f]\262\246\360?\036\230\373\201\354\247\3717\256>\034Z?\234\210\326\256\024\322\256\214\262\254$0h\323<\355Ti\247\253\237\213\013y\034\207Qn#\261WI\265\023\340\026\357\004H\013e\227W1\021\327S=\311B\225t\342\302u\243\023\2151\244\244xPi\311\370\303U\025i\036\r]\265\243\247\254\202\t\207z\027\005m\332\266\225:J\342D0f\212\325\323:\023\345<ZC\330\265\225F\002g\250\341<\246\020\2422\005\205\005\005\225\264\006@\002B\230\252*\017\022\240\021I\220\345J\220@g\2212\242\334\317]\201\002\005]6\231\352\320\320\n\b\0365\372\346\225\373\204\257\013\256\310,\013\346\332\236r\023.\377b\330\001u\271^\322 \356+C_\277OL\376F\355\310"
+	.ascii	"0l@G^\2049P\261a\177\225 %\346\3100\275)1uy\022\323vOA\200/u"
+	.ascii	"\263?\306\036\363\330$\305\031\345\007\034\037 |\b\203\343\026"
+	.ascii	"#\267h\\\222\215\230\330\3554x\273\302\305\216.YwmLN\237\027"
+	.ascii	"\342\374\036\350\333\030y\237OyM\bU~\224>\177\240)p\364\216)"
+	.ascii	"o\242C\006\250\326?8\363\325\310S%b\221\003\240\005v\305\006"
+	.ascii	"\250\261m9Z!\357?l4Q\001\247\245\222Za\003C\351\202\230\035Y"
+	.ascii	"\333\231-\022\246\261\276<a\306X\345\373\272\214t\316\t"
+	.text
+	.section	.gnu.lto_.pureconst.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \\\225\002"
+	.string	"\302\205\023\035pk\322\001\214~U\376\377\277\253\252\252\310\361\\\237\307\004 \302\214\231\2655`g\353;\3231\033\2231\027S1\023\0231D\315\3035\334\302%\334\301\021\301\r\\\300\234nI\267\242[\320\365\271\316m.s\227\253\\\277&\327\224\231=\002"
+	.text
+	.section	.gnu.lto_.ipa_modref.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"-\005"
+	.string	"$\005W\001"
+	.string	""
+	.string	"\006"
+	.string	"\026"
+	.string	"\001\002!"
+	.string	"\002\002\"\001"
+	.string	"\002#\001"
+	.string	"\002"
+	.string	"\200\200\200\030\004\001\002$\006\001\002%\b\t\n\013\f\002\016"
+	.string	"\017"
+	.string	"\020\022"
+	.string	"\0230\024\002\374\007"
+	.string	"\025\003\002\031"
+	.string	"\032\001\002\001\002&\033"
+	.string	""
+	.string	"\035"
+	.string	""
+	.string	"\037\001\""
+	.string	"\0051cO3"
+	.ascii	") \020\203\031\342<\256[\270\244\220i\240\203)\220\301h\207j"
+	.ascii	"a\26014\331\202\320=\320\025\300\304q\261\333\352\204#&\270\216"
+	.ascii	"\013\0220\213\240C\330\214\275]\242j\272\fv\306bf1\037M\256A"
+	.ascii	"{\233\332\0231a\210aAO\214}\026\017\274\b"
+	.text
+	.section	.gnu.lto_.lto.6bc6fff6d02c814c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_hostNanos.39.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`n\001\005\017"
+	.string	"f\334dD\360\220*\035\340c9z\356\013\3736w\372Qv!x\224\222\267`\314]\317!C\204Q\310\016\225\373\177\347\236\317\252\327\337\247\231&\017\324\035%\313\215\370kRt\031\353\357\003eS\232{\265\223O\366\2262\245R"
+	.string	"I"
+	.string	"Q"
+	.string	"\366\370HQ \273\n\325\277\224\210K\303\210\f\233\314.\007\004\217\366\272\307o"
+	.ascii	"\037\305S\250\274\002\371H\254D\330\001[Q\263\373y\376N\200{"
+	.ascii	"\354>\200{\324\021_=W\376g\177\020\303\003-\246\302znDv\327\031"
+	.ascii	"SY"
+	.string	"\271\365\266\017\330v`\037G\261\004\267Q.\344c\376dP\226o\253q\026\230\0343\233:\354\217\225*\302>\\\ra;\355\201\351\216\24690\335\301\364F\323\034LG\230\206\232VM\247\246\017@7\300h\0377vSn;\026&\276`\371\367\333*\177\0260[k\364\031\211\323\277\324d\255\0316:\354;\034\324\250\034\315\353\204+oV\205\372\030\230-\365\252\na\274Z\\-|\026\247\245|\023\217.1\345c\217\276\211{L\005\325\354\n\237\231t\273\033r5PB\326\312\233C[3\323\345]>3u\001^\0202\nQ` \n\201\004`(\235\250E\240\221\t\020$x\250\021\351D\202\362NJHL<\321\t\305\003}\\\2620:y\250R\351\344y|{{\364\323R\227Sp\027D\003\031\227\274\271\243\235z\264@\314\253\205\243\235\027\222\013\216\236FM\266\321\250\235\202\320\274>p\272\321\007\036"
+	.ascii	"1\t\337K>\231\026aX\243=\205nY\005\313\021\2017(\304\301\244"
+	.ascii	"D\201\321U\213\203\020#\234\371\246\r\257\354\004Y\004\3258n"
+	.ascii	"\3360jq\333\230e\261\3245\361HZ\304\204\2113T7@\023\245\004\f"
+	.ascii	"w\305\324N2"
+	.text
+	.section	.gnu.lto_micros.40.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\201"
+	.string	"U\n"
+	.string	"\226\023G> \347(\035\007\013\270\205\273Ep\t\"\244\202Y\021D\2419\200\311\243A\233:\230\306x\217\263\254Il?o\254@^bL\035\bm1A\002 5\267\260\025H\004\363\343\265{o)S\n5"
+	.string	"1"
+	.string	"5"
+	.string	"-w)\331\004=\224\225\234\361H\321\304\346\3644\317\021\344#\374\201|\334\223\233\256&\377/\207,,\003\252\325\351\312q\230sZU+\220{o\233\301\366\307\276B\335\236\334)\231\232\300\366N\272&\366\341\334\226mu\246j\271\352\270j\270\352]\265\252\372\006r\004@\202\2009?>\005\363&\302T\354\303\224\354\216\037\003b\274i7|_\001\2169\271\005\270q95\013\367\250\225N?\373\336e\374\362S\214aW\364\355\332\214\365\325\215\004P\0078\375,\325\326\330\320\253\276\017!\t\016} $\036\"4\222hb\003\2214\013\nP\205\026\3322\264\217\307\243\013\321\246\221F\243M\353x\363pn+[\017\267\235\345f\373"
+	.string	"\251\005q\345*\002\224\r\367z\327!\002\213\005\020"
+	.ascii	"{\311'c\272\204\fs\277\3250\230d*K\230^\b\336\342\244\373Nf\335"
+	.ascii	"_\026qa\004\203\261-\323\342pM\233\204I\006"
+	.text
+	.section	.gnu.lto_microsISR.41.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\245\013"
+	.string	"\246\326P@0Q\223\016\203\310\017\327J!\177\340\240\376\337\002\377j\214|\342\215#\204ex\376\\\307\2510\017r\031\221\326{ \2558\226\347\215\361\250P\034<\371P\201\210\"\216\223q\200e\204\220\275\245L)<"
+	.string	"9"
+	.string	"@"
+	.string	"\325\341m\220]\371&~\002\344\320\213 F\022\t\310\307\212\224\335hY.@:|\017 \035\352\207\207\236!\377#\177\"\032`l#\321s:\260\273\316mt\341\326\333.`\373b\277A\271\303\216Y\252\007\373ow\327\332\301\206iJ\323\323KK/\r_\372\275\264j:+R\t\031\003\\\354Z\350x,\n<\021\341s\217\237\243\260\246h!\262\273\325\241\317}\354\023v1\002P%\235^<\2756\"\313\316>\311U\330\304\017\341\215K\362\233K\024"
+	.string	"H\252*\274\241\345\300\2623\225~\224\320\311o\251\307\260!S\221\037_a\0212\343\334_A\313@\243\342\260\001\316\\\0240H\260\300\362h\034\\\030\217\005\341\001fce\256\216u\261\230\023AsY\036\016\347\262\252\210\335\246\364#G@\002\005\323\314\223R\372\032\037=$\2354uh10\223g\024BNRlpqm\003]\207#\022"
+	.ascii	"{\311'\323\"\f\003\265\020m\b\311T!\303\034\221\324\030.\213"
+	.ascii	"\2065\341\f\202\274DL\t\222]fG\025O\241\"\017w\332\324N2"
+	.text
+	.section	.gnu.lto_millis.42.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\035\n"
+	.string	"\306\023F; \005)\035\007\211y\320\004\313\207\033\261\210\207\320\342l \254\210\333O\237\347cf6\223\254\344\365\301\330B\320\240cZ\300\215\004\224\030\200\313\375\227\005A0\214\217\305\356\275\245\224)6"
+	.string	"/"
+	.string	"4"
+	.string	"(\232Bz\tv\"*\311\342\201j\t\320\335\315L\t\244F\250\003R#\207hI\267tU\025\205'\034_Je\322\345$t\3677\245\312\320\263\376?\370\357\3715\013\357|\364\276\376\316\264\f\362+\354\356>\263\376\357\261\335K\336G\336C\3363\357w\367* =\231\002"
+	.string	"\335\030\237\200\216\211.$\377I\177\347\032\375#|\237\353\242{3\200\034\231\363\302\220\22539\355\367k\247+o]G>q/^\3571\266\241\274\034i8\233m\277\313\375+,VS\312\252\261:\261)\007y\026\032\024\030\346(\344\240}F3\342\341\0031A\032\305\364d\027I\204\2649\022\211\264\331\351Za3\013\343l\343\323%c\2543\250\001\221%\357\r\007\263\265\224\353\250Y\271^%^\017"
+	.ascii	"{\311'c\232\204\fk\277\3250\230d*K\230^\b\336\342\244\373Lf\335"
+	.ascii	"_\026y\027\356,X\036\256\025\2230\311"
+	.text
+	.section	.gnu.lto_delayMicroseconds.43.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\234\001\245\020"
+	.string	"\266!tG\340\322&\035\242L\344\036N1*Q\315\214\317\031\f\355\264\221AP\222\315F(\223\324\227\356\335\203\270\001o\213\212\003Y\246\225\303\\\261\214$\241\204\361\355\240qsb$.Ad\016\347o\226\257}\"\215l\"eJ\001]"
+	.string	"W"
+	.string	"d"
+	.string	"g\301\272\316\313\027\204y0n\334\324va\b\036\315\240{\374\006\020\3419y\332W\361\025\254\347d\260\267[\3033\333\215%\360\327=\216\274"
+	.string	"\367\270\235"
+	.ascii	"\367h\226\275\343\261\021{\031\t\031\027E\273\373\251\210\263"
+	.ascii	"\236,\377\262{\257\031\230'i\301\356:_3\034n\275m\022\333\r\354"
+	.ascii	"<\020\327\324\2038\256\f]\322\353S\320\004\201\265V\206\0169"
+	.ascii	"\0213\032\332<\262c0\251!\354o\273\273V\033\3739\177i"
+	.string	"K\203\304\264\027\323\235\246I\232\346\266t\324\364\246i\325tj\372\002R`EB\006h\354n\b}l\215\350S\342:\277\375\313\\\022\211qb\333\217\0058d~\264f\350\350\260\267\f\256SOID\240\017I;\325\037\020\250\207C8%)G\004\342\270\256\234\036\207\206\007H\213j\243.\263`\024\f49^C\233F\315\037\020\250\225\241nz\220\346\372\316_\270\307\277\261\312\263\374\353\321\367\214{T\365<\270\347\340\207 \020\264#\023\263\265U\302\220\026\263\333\"\t\252U:\005\345d\"A\201\311\244d\200\352B\332T\362 \202\003\b\337\352\304\222ZY}\024ZV\\>SJ\365\225\214\030U\341\224\372V(T\352+\305\366\333\252\2157\0240\243ZK]~\331vkTj:\031\032@\372&\356-.;u\2731\177\331,-\371\227G4(\214sG\310\306\346\221A\324\236p\231\213\247 \232\001\031"
+	.ascii	"0\211\331K>\231\246U\b\303p[\003\270\026\316a\007\021b}\r\034"
+	.ascii	"0\311\270Y\2415L0r\244\0362\007\253/\233(c\273\242\314\361T\026"
+	.ascii	"*\327\234\260\3414hbP\271\002N\362\342\232d"
+	.text
+	.section	.gnu.lto_delay.44.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\225\b"
+	.string	"\226\220=:0%'\035\340\231\276H\f\337\037U\225\210\227\2169\204\006o\327\2075\203\023R\377\206.B'1\320LM ;\210\026\224\033\021265\301\001By\2477z4\262\311\226)\005+"
+	.string	"-"
+	.string	"*"
+	.string	"\003\330\245A\373\346!\311\276%\305\303\005\300\356\3168r\360\n\372gy\307t\"]9\r\273k5\235@\356x\333\007\266\035l\303\004\252\352K\2145cP\263\373\321b\255J\312\230\330\276\307.@I\270\332W\371\n\370\324\310\235\335\220\222\230\335\020\3013\3402;\001vy=\261d\251\217v\206\206\336\344\214#\222\314\261\371\b\323\370\370\216\223\222\266\254/+\232\325\225\035\2224\212\330\277vw\035Q\366S\177^P\340>\024\f\333G\023\020\205\324\233\0261\001!1?\256\302\003}\363\302\002\024\232\233'\232Z\346\016\203\363\346\327u\336\364\204\373k#\312\017\001T\033\001\t"
+	.ascii	"0\211\331K>\031\323\313g\230p\026\326e\024k5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_eepromLoad.45.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`+\002\r\023"
+	.string	"f\244\201I\320\3228cb\002\365\365\310v\007\331\365\340\016`\030\360\340\2360(\035`\346d6I\234\3712\324TP\321\336\232X\267\177\311\215\2403\345\314\211\274A\212j)\212\352\265\215\331\367\335O8\374j\353\312\003.\354\357\336R\246\024j"
+	.string	"d"
+	.string	"r"
+	.ascii	"\033ppE\r\300{\377\315\246SN\352.\376Bv\033\315\357\371A\344"
+	.ascii	"\314A\364\343\336\024\345\236E\360\236\323\027\370\356\201'\360"
+	.ascii	"\335\263\314\366\361\324\347\226x\204n\202\200\334{E\213\342"
+	.ascii	"\262w\266\312\374\337.\202\326f\357B\334v\226\247\305H\315\246"
+	.ascii	"K\021bc\350\267W\234ZM\255%\006\367^W\264\006\342\366n[\305\366"
+	.ascii	"\265kK);\034D\210\324z\357]\343C\371\323\347\314\021\237{iG\375"
+	.ascii	"\240\303 \375\024\367\214\301\254G\357\371\346w\317\216e\250"
+	.ascii	"G\035\236v\346\232\313\301q+\222\235\316\252=a\277\273\367^\333"
+	.ascii	"\036\373?7x\333\375\331\352\233J+n\224\304\270\327C\222\220{"
+	.ascii	"\344\031\251\370\317o{\265\177\322I\371\251\017d\323\311\304"
+	.ascii	"O\340Y\341\004B\004\373\233!\264\232\344\222\216\201\372Y\233"
+	.ascii	"\205\202\215\2359@\256\004h\377\363\030I\375\354\205\376\267"
+	.ascii	"|\307\335\310< \303./\365(hc;7v\346\003\375\035r$l\322\016\035"
+	.ascii	"C\226\346\373\354\n\327\303\246\006q\315\215\370\354mO\331\241"
+	.ascii	"U$\013\250O_\2442a\201\247\204\223{OO4\236x\334{\036\215\001"
+	.ascii	"O\225\023\227\205z\364\263\001\006`\232\2042d\331\nc\\\255\027"
+	.ascii	"\311\n[dh\2160\r\2530f\022\302\2140*\362B\370\342\202\300\253"
+	.ascii	"\322\372\345Z\241d\310rf\034M\257[A\2021\265Z\300J\241\006\264"
+	.ascii	"n\026\352\301\204\025\026\0216\306\224*\230\370r\251dDVi\212"
+	.ascii	"\250\320\344\314X\2120\222,ESz\337]\333s;\230cqD\2635]I=\356"
+	.ascii	"4\306\027\335\036\367\031+$>\016\002$ \200\002\23113\017j\203"
+	.ascii	"+R\366\317'\306\364\227X,\3068\275\356-\242=y\334\211r\332\026"
+	.ascii	"WJ\301\031H\242\343\bk\006)\363\356r\273\351\254*\334\003(\331"
+	.ascii	"\251\r\267\200\211X\2615\215!H\211(\214q\260\326u/\364\002\306"
+	.ascii	"N\024\241H\231%\233\024\242\255="
+	.text
+	.section	.gnu.lto_eepromSave.46.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\315\001\225\021"
+	.string	"\246`vI\320\3226\035`R\344>e\227\302%,*\005\344\301\251bdi\310j\321\220X\b\\\215@M\243\371:a[\303\354\037\243;%\365rB\217=\024\225\225\265\207G\001,\246b\347\001\351\275\354\017]5\003f\212\264\311\336)\005^"
+	.string	"^"
+	.string	"d"
+	.ascii	"\037r=\226\363\035A\214\2147l\370\330-"
+	.string	"\021\274\332\343^]~\300\366\312]\300\366j\227\335\343e\320\212\374 \361\274X\332]\217\232\270\353U\243\323\345\223\300\304W-A\317\214\204\2118\325Z\206\324 :\201\355h\364\007\305e\237\036`:s\212\270\354\256'\t\013qo\267\375b\033\264\347\f\217\275\305\3475\231\314\315\227w\241!\305\206\033_T^_\236\305\r\312\216\335\361$\01676Py\2657p\230'+m\361\351@E_v\030\025EA\200\354d\262Kq\322\022\366\265\335]S \373\261\273~\372#\f\312\245\037\007t\354~h\032\262I\365\350\304c\277\375\313\\\202\"\256|E?B\235\004\355\276N\372E7\242\340\013\275\272\002\n\025c\201\207\212\236\263\031\264)\007\016\"\315df\004`\276\274\214\033\226\030\252'\365\b}\334\b\243b\317\254\346Iw#\025\355\317\016#\307\0272\006\326<\371\352\263\266\327\323\221\021\257\331d\223\231L\251"
+	.string	"\211\0244g\2534\325\202\307\316\024\3429\033R\2524&\261I\351\276\326*\304\351\300V\367eH\311\320\334t1(\003N\341P\323\254R'\026\030\326|_\211Y\024|+\251\005\252\225S\200\013\267\352\364"
+	.ascii	"\306\201\004\257\365\315\2042-\217f%\303\362T\241\215w\352\f"
+	.ascii	"\326|\241\327\002\301\320+)\367\024\310./\252S\t\314Jm\b\021"
+	.ascii	"vh\240\314J\347\356\215\264\375\023\266\227\001\" 0\002\202\224"
+	.ascii	"b\036`\013\016\244\354\313'\267X5\344O\227\272\356\245\265\361"
+	.ascii	"\302\230'2\326\312\217N\320\025\274y\215\256\n\256\033\0077."
+	.ascii	"\025\006\t,}[Cb\301\372\323\235\005\274\224:z\260h\031;\374\354"
+	.ascii	"`\267\023\215-\343\314e\373X7\300bW\204\276\007"
+	.text
+	.section	.gnu.lto_systemInit.47.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\327\003\005\034"
+	.string	"\3261\265I\220\\Q:T\322\212\b\313\033\221\177\211\301%\322U!\262\351.\373\253\344Z\215\243@S\027\327y\037\332\366W\004~\360I/\3346\257\301Xug\326G\"\361\013,\001\033\350\003\rh\305\200\242J\227;9YK\b\331;\311\235"
+	.string	"\227"
+	.string	"\242"
+	.string	"E'L@\300\031\231\224\"\265\205"
+	.ascii	"\210\317\357\213Kw\302\224\240\315P\357\252\302\032\366\274\354"
+	.ascii	"\017o\262\324\035{yO\354\330\2013>\267:\223\336\207Ld\216j3\324"
+	.ascii	"\211\035ZV]9\267\023^6\n{\331\355\017\230/a/`\276\354^w\232\267"
+	.ascii	"T\371\30542\256\272r\316(\006\362\336K\022\337^\377\304\003`"
+	.ascii	"\205\276\2278N\222<"
+	.string	"Uo\260(\300r\n\022\0236]L2\020\343\345\210L\350D6\320\301#\312\211\2774\204\300{_@9\347\276\254\020\352m\276\273Wt\267\222n\214$f\232\356\233\276\3066\307\027\376\360\352\324\357\302i\001Z\266\007T9\007\317\246\260\340\177\021\214n\367\354\013\253SM\330\327\032\246\272t\356\333OI\202\345\374;\333\217r)G}!/[\227t\317&\231/)\274[\345\335\263}:a_\033 f7\\\371\302\351n\201\027\377\350>\231\261\217n|[\206o\357|\370~\221\267/\276\375\001\006\214H\351\350\241\006\223i\363\323\2348\031LYe\310\207\177\367\263\214\022\236\320\374\252;\326Ko\373OfO[RV9\347\330\313\267\337cb\336\367\025\263\337#\232\027wo\340 #\314\2170\202<x\200rc\301=~\373/\"0\214\200\005\177$\302\313\267\357BBf\002\026\274\215\241\024A\354k.\307"
+	.string	"\242\256Q\316\261\224\341~\226ki*}!\255\242\265Z\313|y\307\260\\\277;'\t\261\275\225_\311\256\236\024\177\0060\2729\346^c\\\262\203\244\322\335\327\301\016\216Q\364\322\307:\025\221\210\233\255\002\267\317\302|\341~V\013\332=\273\203}\246\236u\241\033\257S\206M\r9l\260\336@\277+<\326\330\202\233\311|a\242b-\204\002\304P\331:\351\321m=q\265tw*\271\2600\3439\327\332i\224\273\345r\274\335\251\362\234-X@\350\016AA%\206h\261~1[k:\234\213\036\242\033\256hUQu\275\021\241\274\234Q\217\022/w\303\365\\\370\241\375dPB\323\"\036\316\226\273\241;\225\207Z\330\255H9\032\315l\f?i\005\242\f\266\n3\002Ei\212\244\226m\233\t\241"
+	.ascii	"1\204\256\251\321\256\266\242\271[\355\b\265\355Ttv\266\016)"
+	.ascii	"\335\241\253N\267Cc\355\357d\306>:D\0160?\f,\242\023u\344\271"
+	.ascii	"\335=$\275* \366\265\t\"]\\\r\002H\250A$\244\034CF!$#2\023\264"
+	.ascii	"@i\003p\002\221\261,\017\022@\207\251\267,,\254\375\177\003\260"
+	.ascii	"\246(\0015\270\362=\346<\351;J.;[\267X\031\306\342l\305\267\370"
+	.ascii	"\370\206\001\223\311\323\250\353\313D\374\215~+\250\250\306$"
+	.ascii	"\025\032\353+\373~|\334\256\371\033\233\366\361\227EZO\323\241"
+	.ascii	"I\341\205\355\355\363\\\312[\304j\226\221\231K\207\313,\250\205"
+	.ascii	"\372\334\177\374\252H\263\255ao\362\345\006v\366\177\270\323"
+	.ascii	"\235>|\341\330v#\033\2548?\23164\t\346\251O-1\034\334\354\245"
+	.ascii	"\221\276\240\366\025YV\342\251\001"
+	.text
+	.section	.gnu.lto_systemReset.48.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"\315\t"
+	.string	"\006RD; \261\322\001\360\342\324P\350\022"
+	.string	"\252C_\325O+@\200. \301\217\326\022T\367_\244L\316\001\203l\331\313OH\360\206B\013p\240\272\3556&\002(j\333\235\370K<\331)\005/"
+	.string	"4"
+	.string	"4"
+	.string	",\273\264\033\233}\371\\Jl\377\343\230=s\033\311\376F\353\270\351v\227z#\217}\306|\317\216\303\356z\316>@n\357\266\017l\237l\313\004\001&0\234\351\247X\330\013G\2710\303\277\fOIC\377l\215\215\371\231A\016O\346\237\334\204\363\330\345v\326\3306\331\364D\354\003\254\027b\177\245\026\035MBu\244\244(\216\364c\333\035\337\005S\3416*4\300\331v9\201\351W\316k_Y!\260<\345C\350\337kW\231"
+	.string	"\305\354\226\237\271<e\203X\001\226\236\314\001&\231F%\024)\261b\265T!Y#\b\\1*U\265*\214\246\304\361E\007LVX\035\301\023\004\310)\021\3114*Q\262\256\306\220\244\024\254\320ES#\214\212@\213\257\016"
+	.string	"3\203\326+\313\312\254\244\243\336\020\002ms\204T\327rZ\274\312`yZ\355\232\230\023\002~\031\0023"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_systemResetToBootloader.49.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"u\007"
+	.string	"\242M36@s\322\030@\244\301\024\263\345\3149\273\313N\"Rp\3419\305\313\262Zz\206G\2641\006N\032\364\246\247\177#2L\327\370&\311o\021\032\270Q\330\"vo\231\002\223\264l\31340\030\232\230\304%'6)#\240\324 \304\003\301#\321\202\203BC\3340\322\274\266\250e\027E\034\315\213(\202\313\nl\306M\312\031A\237u\001w\240/-,\031"
+	.string	"\267\266`|HY2F\320j#\340#\026h\365\034\035NOC\217gZW\324z\211\261Y\227\363(\223{&\257\236}%\357\261fj\f\\vCvt\226\246\202Q\371\025t\351o\024\225\262\232\"\001I\341\354n|(ZRWZw\237\204\335\335\235DF\364\247\377\300\317\360\237\004\013"
+	.ascii	"3\203\336+\037\304l\240\301\036\251\n[u\205<mqM\244\t\001\277"
+	.ascii	"\f\201\031\200\002"
+	.text
+	.section	.gnu.lto_failureMode.50.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"\215\n"
+	.string	"V\324KC \347(\035"
+	.string	"77\206s\027\210#d\233\013p\374\347q\2721p\0355\206\340C\212L\023\3036\263\230c\203\331\320\3416v\0043U\016\005\265\200\265 \020n3\273\200\240\203\370\221\235\356m#\261{\247\0244"
+	.string	"8"
+	.string	":"
+	.string	"\2735\265\003\273\345\204+\350\335\367\221\367\316s\006\357\235G\233\301\313\234=M\307\205v\333\335Jq>~\216\276\347\007cw=\311\030\231\233\336v\203m\020\333\270\376\200\233\0224\200\340`g\004\273\204Mzc\337\263\273kjc\177\366\3239}\257\003\346f\213x\260\373\222\303\255\202\016\301\216\355\213\354Q\215\342\323~\200\013\030?[q(\nS\342\266\212\244\205\302<\r\330\026\204&\245/O\013\017\200F\266\033;\211\002\212e@\330,\327<\351/Fa\366\t\274\200\212/s\312k\236|\347\277\274w\247\241\031\226\231\013NH=|\037(\272JT'\221\357\303\303\301\026\025`)\344\002U\"-\200\251p\3451\212\264a\322\340\250-pD<\265\252\211\352\264\252(\221UI\237\303\023P\254\2550\024\253\310\266?\276\003\013"
+	.ascii	"J\005Z*$\231\344\350\225%aLN\355\330\n+6\251\265\355\202\265"
+	.ascii	"\265\032\215\027\330\003"
+	.text
+	.section	.gnu.lto_FLASH_Unlock.51.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \312m\005"
+	.string	"\202I$.pU\323\001\032\240\024[8\031.`'\260\352\302-~\237c\304\004j>%f\247h\326\251O\207\227\007\034pF\"\376_bn\321\336)\005\266\250\306\203\341P\355\202\314JSI\244\302\324\232\024\245&g\223k\252\226eS%p/\277\251\"-Fl\024\260A.J\215\375\301\312\317\216\007\002\221\002`\027S0\260!\002\250c\373\2227{t\220\263\017?\2270`wUn\276=n\376=7t\036\367XX\354\256c\347eny\333\t\333\224m,\t"
+	.ascii	"{\3117\323b\237\031\f|\277k8Y\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_FLASH_Lock.52.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \336\375\005"
+	.string	"\302\312(2`\247\246\003"
+	.string	"\025\232@n\306E\220\263\2063\227\bs\251\330\017\311Im7\264\232\0024\323\363\3367\022\b':\270A@\322\342\r\210\023\006\026I)S\267(\210\304\021\211\3315\221U\026-\224\252\022-\211\211\324t\354r\311\230a\230\214\322\327\312\336#\024nx;\357\237\321\254r\2376\236_\202\017B\357\302\377\315e\321\257\207f\357g\tt\3000\350\35640t\210(\b\370\257\322\265?A?\200Vp\200\003*tw\344\221j\272\332U\005T\301uS7\321\350\356/\327y\364\254\377\027\377\251\3773\t"
+	.ascii	"{\3117\323b\2513\242\205\373\\\303\311B\030/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_FLASH_ErasePage.53.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\023\002\025\023"
+	.string	"\346e\203H\300\224Q:v0\252\372g\206\255\327T\n\243hV\361\177\351\001\260#\344\313\276\225R7r>'\220\306\300??\276\233\233\245u\306\017\036\255P\260a\234C\350\377\377\2040\221\006\327\034v\365\265\177d\351\215\021\262\245L)r"
+	.string	"g"
+	.string	"o"
+	.string	"5n\003\347\342\315\005\314\231\363\261cN\261\201\303\323?\213'\333>\215\007\341X&E\240\233\211\020\021\217\020\2229\305\220\365\025\370O\236"
+	.ascii	"\370oU\\\366O\256\312\374\234\177*,\212\330n#.%\202\234\211$"
+	.ascii	"'7\035\311\352\035\361\244n;\272R\001\356\207\210\223\033M\256"
+	.string	"\220P\f9\357\332s\333Q5a\231sZm\267\0207x\333-\266/\330\332\022+\376\231\003Lo\373\347\303\300\177_U\342Y2\323\321\347\035\300\320\213 S\231l1GWg_\316\315\331R\255\372\356F]\374OV\203\237\372\223j)\325+\325*\325\017\220\nBb0\316\371aT2\217>\036-\276\373m\034\237\347\324*\305\212\275\363\360Y\003\201\352\321\365\214\314).\370\347\t\247U\211\025U\373\001\035N\200\346\234\267\331\326p\0355\005\222\376\345\370\366Bl>3\035}\332\225{\240\251v\204\246\343\r\250\332]\022J\252\265\312@\355wg\315\224\311\337\323\242V\211\324\\\320t\264\016\301\270\316'\306L\352\352\022\017\210\316y\367\300\257\256\201\246\032\216\246\343\265H\t\351\304\256\316\247\375\276\360\214tt\311>\016X\202\2449g\267\371B\277\341\362\003\261\026LF\306\005\372\201\203V\312\213\nL\n\312"
+	.ascii	"\030\254\365\212\211\201\200\2415\343BAe\030\024\t\026\"T\bc"
+	.ascii	"\255\231\227K,\334@\343R\023\302\274`!\n\313.\233\326+\214\271"
+	.ascii	"\\\2570%\316\313\2719\377\247\207\323\027\335\246g$\345e\340"
+	.ascii	"yG\375\364p\253\227\201\340\366\330\006\327,\263\245}\251\031"
+	.ascii	"*\225\373\361\356\001~k\323d\320\333\234\372\251m\216}\242  "
+	.ascii	"P\0021$\235\0355\310\332\225\317\001\323Ta\013SV\334\321\260"
+	.ascii	"#\220r\317h\004\202\252\305W\314\263\2242N`\212\013\372\032\361"
+	.ascii	"\356C\031\204\316n\313\244J\231\b\330\211\210\300!z\303\200E"
+	.ascii	"\342t\t\023\232n\342\202t\"\220\r\022\350(\270\245f"
+	.text
+	.section	.gnu.lto_FLASH_ProgramWord.54.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`k\003\335\031"
+	.string	"\2461\252I\260XQ:\305\343\r\212\b\216\036?HC\323\271\034m\241\267\032\237\332\300\275^\344\230\250\343\034\036r\364cm\333:-\353\023Z\306\245\020\3779\006x\304\001\273\362\344\235S\002s\032\344\t8.\357\322~#\204\354-wJ\001\226"
+	.string	"\211"
+	.string	"\230"
+	.string	"\023\306\030'\260\225G\002\341T\255CY \214\2471L0)\355\037}\007\317y!\016S+\321\222R\255\274\003~\215\247\346\215\307\361\034<\256M^\221N\3545\301\365\202\265\362^3\227\tO\347[\341\351\276\360\374\344\335\241\254]\f\351\\Y\363{.N"
+	.string	"N4X\260t\270\231"
+	.string	"(\311\351?\0212\224\241\342\364\277\0270\362\345t*>\177V:\234\334Y \350H\n\226\316g\312,q\021\345\275K\022:\234\224bM\255\3252\247;q\217\267\275\302v\005{?\004\247\336 \223\317\235\372\262\360\364\373'\\\224Mv\361{\2270\244\251J(\233\327#wg\377PFDa\361\022\331\255#\3750\241\364\313y?\313\322\253\373n\325(\235\232\322c(-\212\322\241(MC\351I\245\227JK*\375\230Up\211\013H\255%\272l\251J\250\020\243\373~\3732\025\346\373\360\177^\311\364\300l\037\315\330cb\374\301$Ha<\275\315\343\367\274\212y\202\331=v^o&R\270\336\024*\265\362\f\234:C\306\375\357\251[\rq\347\276\254\345-H\265\342\236\t]\230\rWr\271E\215\247\tUKw\245\334f"
+	.string	""
+	.string	"^\331\005Jr\222AwG\023\336w\fB\266\337\247\215!\t\254\322T}|\270\322\316KQ\255\265\2027\310\004\024\325j{\2177\020\262I(\177Y;w\271\334bH`\022;\321"
+	.ascii	"R\232\273\363\256\\yC\326\372\335\035 \305\3636\022\262V.}\272"
+	.ascii	"\005\371\310.o\201b\206\216\335\235Y\373\315\300\003\311\217"
+	.ascii	"\324b?IF\240I\255\266\347\374\037\007\346\3700\0029\247y\270"
+	.ascii	"\331\030-\366`z\201\002\034\004\031\030\330 p\005\230\335\334"
+	.ascii	"\304\246m\\\023.D\260\360\242\341h\230\305h/\01691\331\313f\346"
+	.ascii	"\341\345\232\261N\007\234\331\213\246\2433{\255l\233W\277D\276"
+	.ascii	"\020\323\221\374\322;$9\n\347k\341{O\t1\035\255|-\\\255\3265"
+	.ascii	"\266\365\t\212\273\363j\211\266\226\336\230\017r\325\222p\360"
+	.ascii	"\344Gj\3112\244r\215MB}\326Zk\330\332\373>\323\332\337\202\\"
+	.ascii	"\300*M\251\365\213p\320\300*\202\341\357\344\254\204\233Z\nF"
+	.ascii	"@^\326'\"\243HX\202\001= `\002\231\272\353\006b\344\344\345\022"
+	.ascii	"\375\220Dw\037 \025(u\266\253i=\202\236\301\032\001\0350\331"
+	.ascii	"\003f\333\302$/t\344\337\307\331(A\326\026\030\032\314\302\201"
+	.ascii	"P\334\027\n\0173j[%\003Dx-eC\273(\033?\220\346\365\325\327V'"
+	.ascii	"\331\260\363\265\373\313a\240\022\013\207\214k@\344\331\253:"
+	.ascii	"\032`\273\"\013w\324\255\231L\2447\261\216\322\205\016oI\226"
+	.ascii	"\025\016\371\t\262\301\324Z\317\340\033\356 UY\203;Ly\177\235"
+	.ascii	"\311\252\332\276\007"
+	.text
+	.section	.gnu.lto_motorDevInit.58.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`l\002\375\024"
+	.string	"\246\347\213J\260\022R:B!\003\2528`\037\206\261c\030\364\003\242Q\366\276\003\356+\2140\341\340\017I\237\316\354\224\355M\353v\312\007\354\372\204\363\253o\032\024;\266\177a~\t\265\3255\037\200\241}\303y\320M\031\024\357\217\332&{\247\024s"
+	.string	"t"
+	.string	"v"
+	.ascii	"\035\034\264^K&\314G\366i\177\305Y\350n\304\341\001v\201n(\355"
+	.ascii	"\372\016\230l\275\332w\023\326k\353\003X\257\326\331=\356\023"
+	.ascii	"\332\003=\344\374\252v\227\244&<\362\321w\217S\367:\322\251\363"
+	.ascii	"\177\237\"d\324\274\216!7<'Hz7c\314\212\270\264\323\343\3151"
+	.ascii	"E\317\351\205\237LH<\036\302^\317g\b\313\356z\352\364B\334\254"
+	.ascii	"\333\276\331\236`O\236$?N\260\250\341\017\251\235E\333W3i\220"
+	.ascii	"\375\230\220\025\321\024\310v\375\350\257\017\336\224N\317:\375"
+	.ascii	"\027nX\025\025\363\261\313s\005d\207u\t\305\203\277}\230\221"
+	.ascii	"\314\207\341\013\375\202\265\220\331\366\201\217\241{\3205Z5"
+	.ascii	" Z@\240\017qwQ^-\241\365z2\376e\303\210\020$\320\375\210\346"
+	.ascii	"%\313\3231\024\241\365\n+!\243\276\273\320\375\305\206Y\2626"
+	.ascii	"\274,\273Y\374\270\273;\272\350\203?\331\315\242\r\234R\027="
+	.ascii	"\316O\201\017EN\373\032\313\246\235\251f\"\264\273+\2665|\311"
+	.ascii	"\006\340iwcJ\237q\301\037zuLY\262^\t<Q%\251p\332Y\244\024\330"
+	.ascii	"t\323\243F\371\203_0b'\374XDb&\025\235\372HO\242\361\207\234"
+	.ascii	"\0017\257\363\352\343~:R\273y\345\221\323\260*=\255;p\250x\363"
+	.ascii	"\312$D\001\266\347df\312Y\245\341`f\036\320`*\330D\254`\205\246"
+	.ascii	"B!6SI\021P\263Y\220)[ne\256\214yy\226\322\300\205\001\0042G\253"
+	.ascii	"\335^r\244\214\355%\206\234\335pd\312\211K\f\264\033\231+\313"
+	.ascii	"\033\371\362\355)\220\307\251\341\017\342\216\362|\032\367m\274"
+	.ascii	"\251\3662\233\261^M\236\250~w\231R\2524\310\"P\324E)\324D9\245"
+	.ascii	";\266i\013\016\233i\345\323I\237\023d7\257rP\032/ p\002)d\311"
+	.ascii	"\003rd\355\316'\030N\336\204\365\006\257v1\267\203\t\332\214"
+	.ascii	"\b\273\023\333\223{\342a\006\231\306J\034\035^\356\203\374\315"
+	.ascii	"\366\242Wnc\022s\037\305F\234j\350!\206\r\327\352\323\206\322"
+	.ascii	"\216-\332R\265\032\3611J\233\030 \032\370&\201\341\b\337e\264"
+	.ascii	"c|nz\021\027\245\b\333\032j\367\266\232V\207\023y]\364\t"
+	.text
+	.section	.gnu.lto_pwmWriteMotor.59.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\354"
+	.string	"}\f"
+	.string	"\326\327VC"
+	.string	"s\224\0163\221DR\0059\201\354E?\026\317\300\016N\351\317\323\022\277\006\330\207\004\005\236\">j\210B\353\267\250\007\031\262\t6\377\317\220\243\314O\336K\3344D=\225N\366\035g\371[#\233H\231RB"
+	.string	"C"
+	.string	"A"
+	.string	"\006\0345\207\346\354\034\377X{\026,\223\025<v7*\211s\27749\377*\337t\236\352\027\210\353U\340\305\205\216\216Wr}NLtWyz\360V\231\031\006\273\353\354\274\0177\274\355\006\266!\330'\005\231\267~,\323\232\351\274\322\337td\330X\320b\367$\306\307\272\300\027'l\237c\023X\035\305Sp\3778\030\356\216\240\341@s(\340\037\3540\357\301\016=;F\231\366\201\021\367\326\210uWD\253e\367\013\230jFSo\362\003"
+	.string	"K\214\263`^ZTS\214\351\325\264R\243$a\354\257\\\305\210_\302\"\251|w\350\247\260\303k"
+	.string	"\034!H2\306\311\002\343\306f\017\373S\245\246\330\277vw\255(\366\277?Y\312BI\003t\002\004\231\310\244\340$\n\r\330\220Q\b\001\201>\205H\023\036H\210\250\254\302VB\305\020\220\322\205x\332Db\bd\rC\266E\224\246m\221\363\355\025\305\021f\270\220\350\352\332d\252\252\255e\310w\006uP\225\003\023"
+	.ascii	"3\t\332K\276\231\026\357\f\3210\324\341\367\032B\267k\201\024"
+	.ascii	"\326\300\032GP~8\013\3255\340\025Fs\352\25225E\334\345\251\232"
+	.ascii	"\234\242\251="
+	.text
+	.section	.gnu.lto_pwmShutdownPulsesForAllMotors.60.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\303\001M\021"
+	.string	"\266`sH\340\356(\035k\367\274Fi\004l\3202>\311\303\276x\3313\262b<v1\331\201\2401\375&\3631g\343\317\237\013\251\335t\217\352\2127M\320AN%@\007u\370;\212\301\017\004t\260\320\233p\354i\266m\"eJ\001]"
+	.string	"["
+	.string	"_"
+	.ascii	"7&\3369]X\244\230sL`\360t\351\232\035\343#\315\274N\215J\216"
+	.ascii	"\321\234\023\334\031\177wo\274=\255]z\2535\037\347\005l\212B"
+	.ascii	"\361"
+	.string	"\344\3223\335X>h\2107\317\205$\304\363\334uEDQ/D\313\367\271\037\260\361\t\305\226\253\251c\316i\r\305\rw\351\266El{\330O\n:{<\321\225\261\357\242A\022\362\306\330\237\252M\307\335\253j]\365\001\0200r\35103b_\214\223e'c\376H\236\232\343~\373)\027-\237\204\2373*\005\324z\211\217\265\343\334\243J\031\247\330\300f\305\315\352\322\020N\227\252o\224.\275\247J\227G\331\251\236\226\252\255\240U{\336\234sz\337\036w\025\202\357~{\f.(\272\263\201\fE\237\256nZ[vA\037\352\313mO\274kZk8\024`\347\bh\252nWG\305M\\\257~\334\035\274\330T\347\347\356\211\200\001\361\221\222o\3429#\276\007\223\224\350\303K\277\244t\271\001\203\310\246;k\020\001\r(\322p445\261\233\301\002\030\007\005\327\213\203%\200\026B\"{I\277X\021&xH"
+	.string	"i\260\n\263\017\032\030\022\373\260"
+	.ascii	"\276f# Ke\231\bl\006\322d\262\031\210\032\3477\3068?\355\314"
+	.ascii	"\370\261-\212\\\031\177A\373\355\006\351\352\273+\273\272\017"
+	.ascii	"Z\244(\222\277\272WI\362O\034\205I\f\004d?\0166\335\371\300\354"
+	.ascii	"v\330T\367$ P\002a\312\254\007#A;\362E\r{\033)\2348CVk\327b\t"
+	.ascii	"Dq\300`\223m\305\340\242\335\270\266m\261\257\0059\t\324%@\202"
+	.ascii	"\357\323\233\322d\\\214\025!mh\bV\347\343-i]\225\333\355\342"
+	.ascii	"\332\324\353\202E\310{/\314B>\002\252\006yS\356\\\346\t"
+	.text
+	.section	.gnu.lto_pwmCompleteMotorUpdate.61.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\026\001\345\r"
+	.string	"\226Z_E\360\2606\035\362KH\224y\034\313\337\300d\346\336\224\025F\377-\025\223\033(\337\037\252\206ij\315\233R3\007\317\307\272\253qU\317F\017\303\335\017\216\027C\370\2641h\322\351\223\265\306'g\326Mh\023)S\nF"
+	.string	"K"
+	.string	"L"
+	.string	"\217~\352\304\366<\336c\023\200\t\311\264\r\204\224\216\002\203u\027\304\013\325nX\300[\366\350\222m\363p\304\276\205\213\224\0258\273\273\251\210\227\236%\377/\327@\025\323\023c\260\273NPe\303\255\267\375a\273\201}\226\034X>5\371\341;,P\031\r\023.97>\0362\246\303\214\315\034v\370\245\206\260o\355\356Z[\354+\335\261\322ZLg1\215\305\364\025\323\321J["
+	.string	">\037d(\210\331\325\260\322\2614q\246\204\355\373\251\207'\207\261H\215'\035}M\312\216L5M\034\247\030\236\314\277\f\250\031\234\032\251p\355\005\253\225\r\312\256\367\201i\246\030\214K\243b\372\323\211/W\366S\\\205e|\022\226`U\036\264\352z\274T[\2614j\264q\272\361re-\375\260\253\220\007-}Fp@\004\022!\001\007\002\032@2\271\320q\321\034\350\301\210\003\221\215$\"\031\205H\233IIh\302\306\215,l \017w\024D\243\215\324u\243\315\023z\267V[ \240h<\375, \355\020\347\361Y\t\220\035\265IJ\362\240\377\362\221\034\227\234\033\0245Y\323\027"
+	.ascii	"3\t\332K\276\031\323\244d\330\036\355\337Y\266\372\325\3602!"
+	.ascii	"a\b\311T!\0133\371\366B\366%\350'l\212\243\250\004^\271^\270"
+	.ascii	"\314\t\0320\023\342\203\251{\340\232[\b\363\t"
+	.text
+	.section	.gnu.lto_pwmGetMotors.62.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \377\355\006"
+	.string	"\022M04PO\323\001\200\276\252\025\250\306jC\247\336\007"
+	.string	"q3m\275\225\347\252-GkD\030G3"
+	.string	"\033\203\250\242\252\270\270\302\206~s\016\005k\0346\243M\366N)\256&\006\207\205\006\211Y\017\223\302\244\004\004\025!\253I!'\003_\023\326\224\330uM)\325=\324\374$\213v\273S\337\344\265\302\007y\264E\366N\037\375\fzD\330\350\340\205%\216}-v\345\036\354\260\377,\324\330O@d%\201\263\233\361\342\262*1%\304\266fK>\311K4o\005\365#\023\300\351`\240\260\354V\351z\002\3501\372"
+	.string	"\364\b=\276\375m\3767\177F6\035\212\341\376"
+	.string	"\024v\327\217b27\274\355\003\333\223m\215\t"
+	.ascii	"{\3117c\261\2003B\305\027\272\206W#\232\026\202\020w\305\324"
+	.ascii	"N2"
+	.text
+	.section	.gnu.lto_pwmAreMotorsEnabled.63.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \362\245\006"
+	.string	"R\f.4Pm\222\016\2602\262\223\0340\267\324\275\\\251\212b\033\203\271\265\335\267n\330\277\333a\336\024\334Hc\337\031FM\201\342\212\303;x\316\230o!~\373d\313\024c\252\204\005\004\205\207e\030\256\013\366\036\032.\016\017sE\274\312\262\005\221\271\036fY\327\243\266\254\013\241\263t\334\304wTRv5\226\320`\265NWS\351\204. \243\242\203\245)\213D\223\3378\350.\276\224t\241\037G'@\0221\030\311\364\224N2d\372\330\3707OMP\2609\353\206\341\251\b\204\302\243$s{N\324\254\230\335v\224\3021\"\321>\234\"\300Af\216\332\007\324]\377\201\277\372A\001\t"
+	.ascii	"{\311'c1\2003\240\305\001\272\206\377E\214%D\016w\316\324\316"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_IOInitGlobal.64.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \312u\005"
+	.string	"\202\211$/pU\323\001"
+	.string	"\240\214\347T"
+	.string	"\377Xo\243\373\276p\213\337\347\0301\201\232O\211\331)\232u\352\323\341\345A=\306W\033\305\234\230X\264wJ\001\276\252\306\203\341\320\r\203LkSI\304\312\364\232\024\255(k\023l\352\246iS\247p/A\252\"-Fl\034\260\303.J\215\375\301J\320\216\007\021IQ\332\305\024\020\354\210\020\352\330\376d\316\016x\310\331\203"
+	.string	".\037\201\335U\2719\367\310\371\367\334\340}\335ca\261\273\216\336\227\271\345m'lW\266\263\t"
+	.ascii	"{\3117\323b\237\031\f|\277k8Y\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_ledInit.65.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\275\007"
+	.string	"\322\31666Po3\006\200\356x*\234\265dj\333\230\004\300\0257\277\bM\253e\326\224D\315.q\301\276E\220A\225\321\257;T\203k\245@L\255\360H\342\033\032\261R\246\024M@\320B\022\nY\350\032 \225(L\033\303\2046\352.<\314\353>\315\256QD\003\304\3644\022\207y\323T\302*f\306u\363*\350f\241q\323\3336nz\302{s\231\252C\214J\206\324h\\\275\260<\316\264!\030\345G\353\315\377W\246\332\370\201Y\021\251~\216\032\232\253X)\"m\355iA\240\310\261\365\210I>\227`X\340O\255P\376\360\240\263c\253\241\t8\266:\006ql\365k[\034\206\334*\227\215\023\231\377S\202\370s\374j\2338\340\204\002\035\001\026\3767\236P\035\256t[\203\266\017m=\002\t"
+	.ascii	"z\022\266\227|2\246E\317p\234\rt\031\344[\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_timerInit.66.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \312e\005"
+	.string	"\202\t$-pU\323\001"
+	.string	"PcVD\206\213C\007|_\270\305\357s\214\230@\315\247\304\354\024\315:\365\351\360\362\0170\330\013\246bf\244\326\356\235R\266(\206c\321P\355z\314J\323\b\244\302\324\232\023\245&g\222k\252\226eS%p/\277\211\"+>l\024\260A.\312\214}\301\312\317\216\206P\224"
+	.string	"\330\275\f\204\033\032\2008\266/y\263G\0077\373Oh\361\004\354\256J\315\267\307\315\177\347\205\316\343\036\t\212\335u\354<\314-o\033a\233\262\215\005\t"
+	.ascii	"{\3117\323b\237\031\f|\277k8Y\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_timerStart.67.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \312m\005"
+	.string	"\302\t%/pU\323\001"
+	.string	"\240\214g\005\030.\273\344\310\305j1~\333p#\346\0035\202\022\263S4\353\324\247\303s$p\216\2576z\260bX\273\267L\001\276\252\306\203\341\330\r\203Lk[I\304\312\366\232\224\255(k\023l\356\246is\247\360*A\252\"-F<\016\330a\027%\307\326\301\377[\202v<l"
+	.string	"\026\243?S@\360\022\201\364\261\255\2239;@C\317U\204\271\204\004\376\257\354(\247\221\263*H\r\336\327i,(\376;z\237F-\325v\302ve;\013\b"
+	.ascii	"{\3117\323b\237\031\f|?]\306\277\214\013.\335\242\235O"
+	.text
+	.section	.gnu.lto_adcGetChannel.68.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\325\007"
+	.string	"r\216670q\323\001\200\3004\024r\230'9Vh\026\001\323c\2449&N\352\351\032#\323\tH\323\034i\\G"
+	.string	"\007\200\317\037\n/\236/\023\3701X\001\232\233\247f\267L)\006%l\237\b\005\355\203]\025\033\307e\023Z\307\032\346"
+	.string	"\021z\220\337&\341e\237\344(2\013\251y\030\022#pw\261y\362\353:Oz\346>\264\026D4\342\206\257\222\242BfVm\354)\322h\262\317\3318b\353u\"\323@\263\353\221\272\331\230\neb\033\264=\366\005\003\212j\037 \200_\311p\334-\235^v\247\201%\300+\333~\312U@\207:K>,\227\016\216\226\232\335)\003>`\275\322\013X\257\"\311\303k\350\237\345\034\224SjD\022];\f\273k\035\221@\356x\333\005\266C\266M\001\013"
+	.ascii	"5I\332K>\231\026\301\360\325\260G\b\264r\275kx\203EGv\bc\272"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_stackTotalSize.69.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \3375\006"
+	.string	"\"\213*2`M\323\001"
+	.string	"\255\244R\023V(\254#\326(\260(>\2109\347\\\3437\373\220v\025\276U\023\301\030\007\203L8\251@A\002\026\003\030\260\355\266\367N)\226\036\001\002h@VS\301\214*\211`\020\035Hi*\310\3071\2250MYQ\324\224M\335?\315\246\021 b\3411\270\221X7b\327\313\275\t\373p\237f;\n\006\b\344\261\353PB\262\037L\207\205m\313n\374\214kX\246\260Vdq\203h\340\020\331\255\322\271%\236\201\257\3043\217\342\364\216\372\3378\274\330B\260\354\272\233\004\354\256\035\226=\334\357\266/\266\037\3334\t"
+	.ascii	"{\311'\323\342\241F\367*,\327\360iD\313B\220\341\256\230\332"
+	.ascii	"I\006"
+	.text
+	.section	.gnu.lto_stackHighMem.70.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \337M\006"
+	.string	"\"K+4`M\323\001"
+	.string	"\255 \244\376\341|\345\034W\213x\227:\370-\347\\\3437\373\220v\025\276U\023\301\030G"
+	.string	"\024\004P\201m\024$`1\200\001\333n{\357\224\002\236\""
+	.string	"\001M\200\264\250\201)Y\322\200@*\220\323D\220\021\344\352\200\232\322\252\252)\237\272\177\233M#\346!\341)\370\201X7bW\314\275\b\373p\337f;\312G\310Fc\227\241\204dA\034\017\n\333\227\375\370\026\277\270La\235\320\342\206\303B\206\310n\225\320-\361\016|%\336y\022\247w\324?\306a\005GG\246aw\223\314\356\332eZ\303\375n\373b;\262M\003\t"
+	.ascii	"{\311'\323\342\241F\367*,\327\360iD\313B\220\341\256\230\332"
+	.ascii	"I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\275\005\325\022"
+	.string	"F\\jH\320\026Q:\230\224\330X\356ar\t*|1Tx\201\t\273\307\"W\317\321\222N8\262K\232D2\376\203K\341K\266\037\270\350\242\213\256\260\371\020\n\250\026\377\355?\360\337\376\267\2230\322\351\262\360\207y\026!\204\310\275SR"
+	.string	"X"
+	.string	"T"
+	.string	"/\227Q\332c\263\303d\177\315\330]`\006\342\275\336\342rV\313W\256\253h\353)\226\311\263M\305jcu\324\001\225\223\244\356\2426\212\024+T\340\340\270<G\026\243\004\250\267\350\332s\254\004\024xU\024+\217}\333\007\306\354j\255\365\364\023\265\375\361\004\032n%\031\356!\030\356\237\0137\021\013w\221\n\367\217Yk\265\rL\241p\347\246=\001\201'\341\356\021\341\346\001\341&\037\334;\034\334:nw\216\0067\016\333m\030\274f\301i\250\315gj.Ci`\274\231\027O\246V\323\031\022\212y\314|\342BJ\024\230\323j\237\005\242"
+	.string	";E"
+	.string	"k\363\267 \016\325\355W\262\272\375\306\311\"c\247\325\251\272\005\313\023]pD\321\375ps\2478){Rt\347\250\242{\243{c\362\232\270\227\224\270\231\220\270\203F\334FD\334GB\334H@\334=\037n\037\017w\220\016\267\020\016\267\217\r7P\006\311\322\202ci'\215R\016\250E\016\215eg9\247\316\220\320\017\255\300\202\344\2345b\354\210\253\001k\353\004\354\304\255\354Mk%F\"\355$G\262\321l\264$2\\\222H\303\035\221\341\252\224\247pE\3444\224\334\215\031\257\220\3464y\021\364\na\341\336L\341\236\020\251,X\272\002_\250A\020\304\243a\220\202\024T\262\034"
+	.string	"\003\021\242m\016\021`\020\016\"$8\"\022\211\254`\036>\345m\224"
+	.ascii	"n\313@\241\327\024\025z\2225\030\025\245\224\241\341\342f\037"
+	.ascii	"+\021zN\245+\225\251\210+\213ixc`E%\207\t\210\315y&\\&\203\335"
+	.ascii	"m\312$\2465/\314\277\366_\373\257\375\327\376\213\365\353\200"
+	.ascii	"\334a\324\310\003rc-P\250\243\316pU\032\311\266FN\371\006[D\026"
+	.ascii	"!\251\"\335\311\022\251\245\353\373'\023&\\\027x\267\217\221"
+	.ascii	"7\0138\311%H\005\230-\312\013\243\344AR\300\344jdX{\323\370\233"
+	.ascii	"Ez\003U\r"
+	.text
+	.section	.gnu.lto_.refs.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375 \227=\003"
+	.string	"\342G\025\031\2207\351\377\377\377\377\377?\353\361\221\021#O\0213=Z\263m\t\331R\246\3375\202W\351\201\337m\340\211z[,\364\252\027\236\026G\024~\024\t\266 u4\350='|A\257\356\323\361\262\001\203\034\274\270\rn\016`\375\316\246\037\326kmG\374\202\337?\021\005"
+	.ascii	"\255A<\302\214\224\020/\347\343\326|\002"
+	.text
+	.section	.gnu.lto_.decls.6bc6fff6d02c814c,"e",@progbits
+	.string	"(\265/\375`\201@5%\001*\006\246pV LI9\351\372\272\256\376\372\272\252\272\356\253\256\376\372\276\273c/.\356+\257\272\272\343\275\270\347\342c&\251\350\376}:\360\256\032j\025Y\354\323kF\373u\301\217_\333\373\372|~)Qh\364\352\024St\363~\356\"\007O/\232|v\377\277mK\310\336r\247-\006\331\006B\007\375D\350\235fR\271]\351\350\213\343\344\314gdJVY\337>\353n\322h\357\2636{\207\017\317q\352\263\2333S\255\006\330\251\325"
+	.ascii	"&\033\017&%\347\275\231\002\377]\226\001\317\362\205\212\032"
+	.ascii	"L\232\214\313\333SS\337V\322cU,\203^\262\344\321iC\244M^\337"
+	.ascii	"\233M\3705\203\263\356\325\f\316\277\305\2224-1\305\350\373w"
+	.ascii	"\222^\352\300\200\323\363\352\333a\032n\244\266\324M\351\373"
+	.ascii	"\333\006_\321R\273\210P\"\352\007\225\005V\247V\245\234m\307"
+	.ascii	"\251';e\225\t\3058\333\316/g,\271\256\246d]\n\024m\366z\211K"
+	.ascii	"\f\017-\362\274|\251a\270\030\251\233z\241\246\315_\243\324\264"
+	.ascii	"\006\322Lg\253pe&p\241\352\253>\3228\272\253y4\222\036\3229z"
+	.ascii	"G\327h\035\375\243\211t\2206\322\\}\243\213\264V\373h\254\356"
+	.ascii	"\321_\355\325B\332Fg\365V\203U\261\006R\261\274et\3255,\247\\"
+	.ascii	"\254\251\323\253k\032He\263\201]\252a\024Jf4T\257\350'de\253"
+	.ascii	"n\037\203\244\235\232\004TK\261\320\273R\337*\\\323\2211d\252"
+	.ascii	"]\205K\366d'%[]k\36240\341B\303\213\230:'B\211\250\237\211,\""
+	.ascii	"uTd\330\352\224\332\246$\254\316\251D\237H\241\344\t\f\006^W"
+	.ascii	"\316\313F\241\242\237D(\021\365+\221u\242L\207\017\r\244\232"
+	.ascii	"\251j\354\262\313G\326dU\227s\256f\311~\332Y\362\311\271\006"
+	.ascii	"]W\316\313{\370\033\nHG\365\023\006M\310\024~\260\251\313y\371"
+	.ascii	"\232\366W\265\006\3223ZY\341\2229Ki@\004\307\227*\274\2343\007"
+	.ascii	"\03280\273\354X\023E\002\367o\253\267\362\257k\025\212S\316\371"
+	.ascii	"\202\2356-*P}\233\206\320\333\352?8gnl\270\372\376\034\301:\313"
+	.ascii	"\nt\326*\365\347\374\025\202\177\267\360o\025\376\205\302\267"
+	.ascii	"{\370\326\016k\300\005\337N\301\0374\301\267`\370\313\372s\336"
+	.ascii	"\356\300\257b\375\204g\202\020\031r}o\255\360\325N4\02239\221"
+	.ascii	"\222\245\221m\002'\254))\325\367v\n\337\246\300\267N\370pz\370"
+	.ascii	"}\006w>\317"
+	.string	"\233\r9\022}\337s\370\r\207_'\005w\3759\337Kp\317\231\016\037*\236\t\362\005085\355\365\255hj\232W\274z\367\016\037n\227\3042X\316\271\342\201\240\314\231\251\342\361\350\345\314\304S\253\001j5\300-\222\305\325\344\274\357%\026\022z=\363\237\032\226\227\204J\337\267\020\254\301\256\256B\361\252\262\325\367d*]N\036\200\316\330\213\027J\372\276u\340\267\026\256\271\376\234rhgE\234\372\276e\340w\013\374\3270q<h\262xY\306U0\276.uNP\364}\233\300\257mp\215\252]\270X\024*^\200\341R\267\354\244\321`\233\322\367\265\016\277z\301\177\205\313\202\203F\343\013\212\276\377\253X\315R\261,5\360\354\200k\373\352\373z\005\277>\301U\231\004W*\265J\025\273[\265\262\344\331\201b\302\314\255\357k\021\374z\267s\005\365n\347\253\027\256]\365\347|\345\201o\3759\253\262\002\235"
+	.ascii	"\250?g]\326\237"
+	.string	"S\203\nt\376\365IGQ!\244H\337{XR\231`\320\204L\341\013G]\316\371\177=\253N\252XE\253e\257f\265\3115,sF\3139\277\202\375B\025\255\"\251c\025.\271\314,D\300\203\t\024\274\2343\007\0328\250QtTV\316[s\005:{\352\317\371#\262\023j+\005\262\357\201\370!\3005\254.\253\330\257T%gTr\231\313r\316<9GP\334\271\365\375\t8\307\303k\222[ \226?\374\006\257 \357\325_9\337\370\257G\376j\244\202\375\212E>)sY\316K\237K%H\222\245\276_V\240\023\327\237\363o\0207\3521\253~\300\352\357\f\300\370{\250\305_\265\274\377\273\342\357\021\226*\006R`1\360\337\374\357\b\233\301^0t\237\377\272P1p\f\236\363_\021\177oH\341-4\007\340\337\034\210\250\305\277&\375\035\324\013\300\340-\374\365\003\235\200;t\f\376op\021\324\343"
+	.string	"\034\3607X5\241\236`Q\370\253\022"
+	.string	"<\370\253\030[\201\337\377\026\340\365\277\0038\341\257a\265\310u\376{\301\020\337\345\371\255\t\366\002\277\365\331\022\254\005\376\232\303\222\360[\235\277]\030\341\031\376\213S\305\330\n\374\255\205\312R\240\2220\001+\201\277\322h\271\277f\331\b\374m\306B\340\357#\255:\302\003\376v\341\357z\355\222\377V\254\007\177\247\375\266\001\177M\332\016H\250#\\"
+	.string	"\277u\373-\007\277\r\372+\n\354\006\177\317\260\013\370\333\306\177+V\001\177\373\370m\002,\002\376\252\002{\200\277\301\376\272\302\032\300j`\013\360\327\021\236\301o\251\374U\317\022\240\036\177\376v\357\357)6\003\213A\275\373\b\354"
+	.string	"\376z|\317o\363\324\230\331 \315\315o\351\300X\001\\\004\177-s\374[/\377\233\374Wr\264>\372\357\304\006\340\377\357\377\b\376\237}\371\277\363\333\265\337j\370m\206\337\366\374v\347\267\370o\275\277\317\374=\367\367\226\277\255\374M\345o\265\277\311\376>\362\367\217\277o\374M\343o\245\277\205\177\177\340o\020\177s\340\357\025\376\316\300\337C\177\243\360\367\b\177S\340\357\b\374\375\341o\017\177s\370\233\203\277\203\376^\300\337\t\370{"
+	.string	"\177[\3607\317\337:\177\343\374\355\373\333\374\333\376]\377\272\367W6\177U\363\3274\177\275\373k\231\277\322\375u\314_\345\376\032\367W\f\374g\341\257#\374W\362\237\354\377\331_\265\374\225\312_\303\376Z\344\257C\376\352\343\257?\376\212\363\327\035\177\315\361W\255\277f\375\025\353\2574\376J\365\327\344_[\374\267\362\327\250\277\252\340\257(\370\353\007\376j\302_\225\376z\374\353\t\376\252\302_Q\370\353\t\377W\370+\t\377\235\374\007\373_\202\377n\377\t\260\267\267\267\367\373>\370\261\224_\b)+\222\370\334\341\341\267\3516\235\320!\363\365\205\204\024\006\322r\227\356\222\225\233"
+	.string	"\034\316\026\n\261\245\276\277)\201-\310\261\267g\3318\240\013\215\332\327\025T\033T\337\337dlAX^\236e3\001%9\352r2\031\264\203\242\roO\357\226\315\345\022\366%\256\357\357\372\314\377\337\211e\205\336\0322\330\002,j\324\33023\272r2\031\244C\246\305\0134}\377\003\203-\b\223\346i\262W\366\241\331\360z\303;J\017\326L\265ww_\323\260\314<|t\312\334\301\177P\360\327j;\345\314\204"
+	.ascii	"siI\r\261\276\026\234\261\263f\354l\231\232\243\202|t%\203.\225"
+	.ascii	"*H\306\372\226\3513b\206\300q\365\375\357\f\237_\036n\351\304"
+	.ascii	",]'\301MH%\323\225\blT:\332\360r\256\322\301\215\226d\335V\017"
+	.ascii	"\f\224f\314\030+\327\223\233\270\270u\375\262\260\005)\304\210"
+	.ascii	"\261r5\347\234\211\344*f\345N\306\334\002\244G\223\276\377%\261"
+	.ascii	"\005{\036,\027\333\345\326\313\255\027\033\207s\316K\313\274"
+	.ascii	"\342\206k\211F\r/'\243\202\376\337\335\306Y09\030\330.g^\344"
+	.ascii	"\372\332/7"
+	.ascii	"5\332\244\230\351\373\337\n\374\037\t\374\327\367\177f\246\250"
+	.ascii	"\2343\013s\231\243\232r\316\277\276\232\265\006\375:\325\326"
+	.ascii	"\003\374\277\366g\200\nrfJ\353\3129\3273\330+\215I\206\006\331"
+	.ascii	"\204\213B\216a-\215\200%\345\204\005\0039\206%\345\203\034\303"
+	.ascii	"\312KN=\226|\2422\326\022r,g\037'\247\245\013(\245\220cL\331"
+	.ascii	"\0079\226\2452\211-R5/\261\226\262\2232\373d\247\314\224\307"
+	.ascii	"\224R\032 \235\260\244\220cLR>\3101,\251<\206\225{\262\023S\324"
+	.ascii	"\t\247\034\345\223\307\260\354\362\230R\252\0079\246\224B\216"
+	.ascii	"amU\264\0237\212\260x\322\245UU\227\220N\031JE\025ST\017\034"
+	.ascii	"r\251\314q9\327\262\0229*\303\345|\200\234\253\224QqL0\252Z\023"
+	.ascii	"\034T\023\032\223\262.s\316\001P\321\224\245\314NpK5\303!\201"
+	.ascii	"(s\006\322t\224U\344\2343\bKK\270\274U\341\226jT\345\247\022"
+	.ascii	"9\013 /sV\221\363R\315p9\347\245\234\263/\252j\231s\214\036d"
+	.ascii	"\227\n\0259'5\250\310UKk%r\35621jR\310\261,\245\320\032\331X"
+	.ascii	"W6\261\\\252\310'e\356\312qXQxl)I~\3129W3\270K\252E\231-V\313"
+	.ascii	"R\227"
+	.string	"%b\372\302\265\2313\036.\372\036?\301\377-\026\373V\305l\026\353V\263\330+M\266cs\246aD(\213\265b\333*\\2op\225\005\366\225s\326\300\001\007\030\t\n n\347=\326\302\307-p\233u\242'\027\306K\337\343\024U,\225\033\032j\302\232\372NY\302`\003C\245\357}k\360k\332\330V\227]\263i\226\315F\261P\254Z\025\263Rl\331\255\231m\362.\263\004GW]C\326d;K=\271\311\213UW\222_H\212=\263O\354\262\013\005-\035uV\212e\322T\354R\r\233XB\243\316b\375BV\212U\322d \260)\351\2724\3341zZ\322v\354\223\337\366\260b\326I\036\233S\022\213v_\274i\365\350{_\031|\237\034\256Q\025\350\314P\177\316\373\332\360}N\360}`\370\276\034\370>\031\370\276\023\370p\025\350\374\300\036\271]\376\026\211\r\363\241\301\321I\365\255\313\ntj"
+	.string	"\023\272=\242\0242$\253\357\005\365\347\264En\232\200\231B\222g\211\374\212)u,\323\213\267\264 \267_\277\025b\207\330\037\366F\2133\272\276\265\256\002\235\004"
+	.ascii	"\"t\033d\207\310\322\214\036}3\340\272\365\372m\227\365a\177"
+	.ascii	"l\351\242T.\301\326\362\202\270\350\373\270\nt\352\364\020\272"
+	.ascii	"\345\302\3012\245.\254o\316\216[\036hVS2\266\364\265[B\267;\332"
+	.ascii	"\250IQ\206\343V\307o\267l\0167+\\\362\372\036\257\002\235<\365"
+	.ascii	"\347\2647\204nq\340\275\275([}w\352\317\271\343\302\303\255\326"
+	.ascii	"\253\230\325\252h&R\205:5u9*\252\203\237v\370\2675\236d\220a"
+	.ascii	"\315)o\263~{e\261\236\274-\261\3217\250\002\235f\3759k\024\241"
+	.ascii	"[\345\255\201f\305\217\252[\253\337\316\2604r\234\244\351\342"
+	.ascii	"\352\333]\025\350\\\200\f\241\333\252~\353\301d\325W\001\365"
+	.ascii	"\347\214\202\003\353\201\343\305-\325oa\330\344\357Jm\351\244"
+	.ascii	"o\255R\201\316\001\324\237\323\272\020\272}\361\0373qcD\372\n"
+	.ascii	"\300\262\270\235\372m\213Z\246\342]-\032b\254\372\332\372sV="
+	.ascii	"\241[\026VmJ\t\275\276;H\017\267\3716\205}\262*\252\230\3156"
+	.ascii	"\352.\227K'\217:4jx9*\331\201\205Bs\345\306\212\333\250\337>"
+	.ascii	"Y\025Mf\202\234\235~\250\001\353\352k\241\204nW\374p\244\235"
+	.ascii	"\330\322\267\356\355\325\237\263'\347\ntv\316\365\347\264&\354"
+	.ascii	"\t\213\342\377\2316\300\204\351\322\367g\031\276E\376\377m G"
+	.ascii	"\226\263\276\267\236\355\274%aK\374\277\212f\314\022U\337\237"
+	.ascii	"K|\353\364\377\207\325\004\361\361\326\3276\341\022\347\220\r"
+	.ascii	"L<&\034T}\177\313t\333T\306\206G\212,}\355\222\320-\023\001\234"
+	.ascii	"\260\255\365\365\325\237\363\347\016\3747\233\367\336\337O\272"
+	.ascii	"M\207\247\255\033}_\245\002\235\255'\364fs~!\363\212\364\275"
+	.ascii	"\301{\347\375\255\246\327\340\250\330\202\021\245o\253U\240\223"
+	.ascii	"\2034Bo<\024J3&}\031P\177\316\276\273)\322\004\271\322\367'\026"
+	.ascii	"6\263\344\371}13\243\254\357O\2522vtY\306\222\364m\273\277\325"
+	.ascii	"z\255\353r\224=jb\250\3726\235/\211\327\306E\337\237'\260\231"
+	.ascii	"\227\006s\025\024EY\245\317*\\2/\331%`\255\216\256\013\017Ks"
+	.ascii	"\311\322`M\355o2\035\327bzL\207\351\271*\326r\177Ou\2275\177"
+	.ascii	"5\223\353(M\245\302\341\310LK\"D\311t]x9/[\256\255\364\033\006"
+	.ascii	"M\310\314\204\025\264\006G\327\205g&\327P\372\314\227\341\262"
+	.ascii	"\t2-*{dIF\r^\316K\037\f bYv\356\253\330\307\364\227\223\321q"
+	.ascii	"\345\305\221\2767\251\340\233Rp\347\346\322[\316\222z)\372v\226"
+	.ascii	"\206\253bA\255\345?\247e\036\313\031\216\307\324Zr\205\327\367"
+	.ascii	"\346\031~\r:y\202\316\233L\360\337oWjZ\330\024[[\273=\371\210"
+	.ascii	"\"\325\367\246\021\334\366\n\345\203\204[\337\233C\360\315-\334"
+	.ascii	"R\232\255\212m\320Sn2-\3632\347%O\353`c\246\244\357M%~\335\340"
+	.ascii	"\264{{u\203\363&\025\276)\2055\344\nt\332\\\177\316(\252d1\363"
+	.ascii	"n\352u\036\232&A\372\376\356l.\326\214\274\3655\361n\252\371"
+	.ascii	"\1779d\320vp\365=\217\027l\246\201\303>mdn\326\2211\317\3208"
+	.ascii	"\243\374\246\334i\361\260\273y\346\246\231\016\037\372\t\205"
+	.ascii	"\253\0312\312\334\361\f\311K\361\245\257Ig\005\367\254\351r\363"
+	.ascii	"K\027sN\002G\302\264\2312\223PEa\tss\356\246\\\207\017_Cq\345"
+	.ascii	"CNL\234/\231%\306\n\f\227\0166(\372\352\304\031\311[\321\327"
+	.ascii	"\364b\004\373T\231n7\337L7s\213\227\231\2166\333\025Fd\207\251"
+	.ascii	"\345\346\226\263\ti3\245\251\257\tg^\235V\252D\251\351kf\261"
+	.ascii	"1nz\374\270\021\245\257\211\345\n\217\027\366qa\305\212\225c"
+	.ascii	"\262\264\346\313j\211n\212\036\366\261\203\002\305\244R\305\362"
+	.ascii	"\212\n\203J\016J\n\256\220mSnR\371\271\232^h\351kF1\331\376\377"
+	.ascii	"|Y6J\304`3\245\\\335X#\003\0331\243\243M\3372\230'HY\231\251"
+	.ascii	"f\365\352RhH\230\235*S%\312\232\334T\273\231\326\341\303\331"
+	.ascii	"\262\226G\364\372\232O.\235\271\243J\317\211N\331\212')\372\232"
+	.ascii	"hW\356\305X\2276}\315\263\353\205\351ik\254\3577\344\260\301"
+	.ascii	"\201\326\242\257if^\301]\341\221\350{\223\353W;\270X\210\301"
+	.ascii	"<+\302\3760\223\254gJCnr\243\252f\274\314e\231c7\311n.\351\360"
+	.ascii	"\241\266\311p\332\022\245\357\333\354\355\356H_S\314TRF\f\207"
+	.ascii	"\032]\035\036\020<1}\315$K.\270\247\r\310M!@\314#\366K]\346\244"
+	.ascii	"\322\322YA\363\365\225\221\311 \234$)\222h!r\363\310M\260\016"
+	.ascii	"\037>\346K\310\027\246\276\246\221\357$\337\240\324\365\275Y"
+	.ascii	"\344\306Kkl\310\327\3074\2201Ov}\315!gK\202\301\253mX\262\270"
+	.ascii	"4\3655\203\374\240\320\320\302\352{_\223/2\272\226\340\036$N"
+	.ascii	"7{8\231?*2\347\244r\311\356\001R[\367\255\313\034\013\0377\177"
+	.ascii	"\374\035>\230U_\2744i\3655\273L\256&Y\332\312p\345h\ti\353"
+	.ascii	"q\023\027\303D\232\276\246\016\223\007\206\302\241%K_s\207i\025"
+	.ascii	"\246D\257\255\257\231\003G\311\031\023\214\255\377\247#\204H"
+	.ascii	"f\323\367;HpO\322\303\177SySi\336\270u\3124\254N+D\222A6\257"
+	.ascii	"K\336\023\323\306\315\033\265\315-\306\221\267\276f\rS\353\005"
+	.ascii	"\023\362K\237\f\217\327\034\024$}\315\254\332F\247f\304\251\257"
+	.ascii	"\211U\333\306\224\365\250\272\312\242\205E\036\316\032W\232\\"
+	.ascii	"\337\357|\341\036\24647c\2441i\214@\202-\036\251\247,Wf\334\244"
+	.ascii	"\361\237pzkn\364\375\235Y\205\243T\241gV\2312\314\265\032)\272"
+	.ascii	"d\3510*\313\031l\372\232/L\252\033%je\302\372\2320\314\344\316"
+	.ascii	"\032\".\306\266X\230.r\266\266\234\354\3655[\230S;4\224<\232"
+	.ascii	"\364\375\216\322\2042\245\212\364\276(\351k\2560\243:I\224\037"
+	.ascii	"h\246P\230*r\322\204\331\231\3655S\230O\2770\246\272\"*J\230"
+	.ascii	"'x\272\bQ\233\353k\2320\2217)j\244\021\351\373\035\022&\223I"
+	.ascii	"\302g\005HS\211\276f\223\351t\345\254\234 \367\332\230K\225\r"
+	.ascii	"\025\267\035}\357\236\231kY\227\t\263\273\253\367\313\346\377"
+	.ascii	"\361"
+	.string	"\344@rQ\366\275\316\034\376]s\363\376\337\371\326\205D\356{\035.\370\342]57\316\320\254\365\275\216\033\226\202}\304\344~\271{wM\344\344%\261\274\242\0221\323\321\366\225s2\250S4\231s1\346\367\356\367L\207\017g{\303\0215\327\367\226\271f\326\300\024y\322\367\036\210\275\220\222\352\373[w\355\376_=\022\343\214D\337\3538\301\227\356\312\325\310\253r\325\367\222\361`\306\232+\275\276\277s`\\`\260\314\331\037F\246l\354\350{\0352\234\001\206\207\377\267\312\357\225*7\214\006\345\222\235\020\325\t9(x\031\231\f\302'\226nR]~\303\374\306u\370p\266\23492h\340\372\376~\271`\376\037\216\262\346\345\245\357u\266\360\257\027\034[x\004\351\333\365l\347\315r\271\270\265\255\361\352{\341\256\226*v\266\273e\255J\215\225\276\327\261\3020\260\235\276\275\275\275\275\273\213\305D\343\224F\007\226\267"
+	.string	"\270\220\013\362V\313\314&Vh0\372\336\266_\267\377\367ca\202+\006\376\257\225,\022j}\257\303\002_\307\t\353\320y\270R\352\235\362*v\247\364\231\024\362\345\241\206F\355+GU\351\300\346\265\331\220\322\3679g\260\275\"7\225k\23793xE\211b\313\204\261\252aHd\02708\003\222\2655[&F\227\332\224\035RUp\0063'Nn\032\231\331S\235oJ\033%\211'\277iM\305\207b\313\022F\023\234!\356\354,\f\262\263T\315I\205\341\fvffVN\257\353\314\232[\373\352\373\234 8C\0321\261\313\004\f]WNV\005\345$\307l)\311~\231T\225\321\355\365\375\335]\362\377\2473\006\314\311\336\222\261)RK(p?\026V3r(\261n7SV\276\310\372>\207\007\376iq\227wi\345\230\310\361P!\323\252\372>G\211\177\250\216\034\271HR"
+	.string	"@\336\023\257\033XH\372\354\347\303+\353\251\357s\236\360O\215!C\256\221&L\322\352r\262*\310lR%Uu\215\334\"?(\240\246\212\\\"w`x\270}5\235\316\224\027-\222\364\275_8{\370\007H\220 \327+\206|BmI\363\022\207\177\316|\370\270^`\270\272:\212\220\250\260\037\277^F\240,a4\301?cv\354\270\\w?\247\257\251\264\036\277\\7bnH\255\351{y4\331\n\265< }\177w\303\274\2226\372\036\007\f\357T\361\320g\365\346\310\321g\032\362\222\335\007v\312\036xG\314\303/\216*vq\264]\206\250\r\230@\342\334\300;N<\374\332\020\2736\232LC^*\243\201]\324\262\203\343Ta"
+	.string	"D\315\230qk\330-\321\250\341\211\331R$\256\357\255q\203\0067\266\327\367Z]\254\377\277\233\264\030K\037\027\353^I\201\362\3254e9\303\316+\354*m\331oE\227\f\274\276\227FS\371\377\333\231a\366\345\202,\013\315\\Z\337\343\254\300"
+	.string	"HK&\257\214\270\256\2343\031C\342b\374\312\320q\321$I\262\357\245\352\036^2\334\330`\240')\251\373\242s\316\271\313\307d\311\223:4\2574f,~_\\\0278\031\207\247\325\367N\235\311\0308\322\364\375M\335m\201\306\234+ca\245\357o\3400\320\217\273\342\256\260r^\314\360\024-6\346\3300\320\227\n\025 PC\243\366\225\223UA>:\032XV}\177S\206\201\220\334\023\367\304M\341\205GWN~\005\351DM\375\260\272(~S\340PY\262B\254\357\357\254\221\377?\013Fj\207\0210\f\304f\302\004\210\272\257\240\263L\215\355\256\006\006r\273$.\t+\247a\255\356+\350\346\254+?\332\220\006\213C#\017:"
+	.string	"\225\210\"nP\243R\3225*\246\301\233\002\217\036H\"J\201\t\030\016I\030\016\213,\f\203B#\n\"\211(\355\001\361sL\225\222\200Da:\024*\205"
+	.string	"\002w\216\251R\322\375\321\206\242\364($*\rQ\2420%\242G<$Ba@M\242Q)E\215E\"N\2050\240\367\005\"\232\242\"B\b\207EE\305\324\230\036O#\245\020/\244\350\321\367\243\rI\300a*<. \025\022\207\216D\302c\fG,\fS\341\221'\tE\207\307\"1H\374\031\371\214\316\037m\020A\024\032\323\243\005)zDB\221N\244\263(\210\032\215L\244 jL\217H(\022\220\210&\025w\210hR\021\tE2\302\250\320\205b\221\310\b\207\210&\025\213\214N\020B\360\021\321\244\242\221\tB\b?\224(\034\022\205E\"&*\016\207A\264\210\003\214\016\205FIH\251\017=\026\207DFg\032D2\026\215N\243\224(4&\235?\332\200\"\tS"
+	.ascii	"\f\207JDb\221\350K\201E\302\237Q\020\035\336\021E\343QZ$\372"
+	.ascii	"P$"
+	.string	"a\232\242\"\200:.\020\025\207%\240\306b\t x\220P\r\034\211\020\246\220\203\242@\bb\030L\213-\270@\024L\217;C\224H\f\036\225\220\242(\020\025\005uRc0\005aD\221\204\351/\025\022\207\212\320\241o\030\fQ\034\242\220\n\211C+\f\345\030I@\032\221\364sLQ\024\220F$\345\240i\260(\311\003\3500\t\251X\002\322\210$\013\216\303!\t\306\342\tG\3648Tb\2018\242X\224*\035\201@\032\221\224\201\261\230\0265\200\246B#\b\220F$\351\230\240s<S\242R\261\204\233TH\034\312)2\026A\200\0244\212(\032Y\360\001!\"\310\002z\f\032M\340q\201\250\250\002\321\003\300\024@\220\240\302\t98F\264(X\034\246\305\242\005\212-\\\220\242G\264\0038\251R\261(=\236\251\2208\204\204\246\307\030\2167\346\261\210X$B5\020Cp\210\026\371\034\205\303\241\020\351\354"
+	.string	"\210\241_\021\212&\201p\201\2508$\2729\026\215DB\244\363G\033\212\302\242\364\bd4\242E\351\361D_\b\202(\n\026U"
+	.ascii	"!\204c\221\030\334@z,\036\375N$4\242DT\004>\b!x\020\202\b0\370"
+	.ascii	".\002\004>\200\300\007\347E\200\200\220\020\004B\020\302\017"
+	.ascii	"A\310\246?\332P\204\016\201\351\221\b\3410\206Th\f\016\213I\270"
+	.ascii	"\bU\341\250\224\006\323\243\317QD\260\205\"t\350KS\240\357(\""
+	.ascii	"\330BQx\036\201\"\204F\304b\t"
+	.string	"/\240\027@\323`\007r\206E\242bZ4\262\320C,\n\217F\364\005\342\020\322\b\026\214\305\264\210\344\2034\202\205\"\224\210\030\303\221\350\001\364\250\264\023\2031E\221\320!\332BZ<:^"
+	.string	"=*\371\240@\264\250\250\001\324\2504\024\006\215tP$a\013\2511\230\036\177/B\211\"\204\303\240\217X\024\246D\350\321\367\r8\230\006/\200T4&\241\350M\n4\246I)Q\250\364K\201\035<\244\300\324Xda\005\244\021I<?\332\220*%\245JE \322\210$\016G#\372\202\320X\244\301\213I\250\221CZ,\0329\340\244\300\025\206nQ\330)\260\003%\224\200$L\261\221\210\310\032\241\027@\223bh\001\250\201\241\026p\220\204\251\035Q\034\032\031\321\027V@\211\214E#\235\024\030\202PJ\024*\341\242\242\320\210&\235E\3500D\220\210\372\206\305\242\005\200f\n\024!%\n\225|&\2500t\302\375\321\006\023T\030:\301\001\035\212\320\243\022Q\t\210Oc\232\224S\024D\215;\3064I'\025\032G\344\024\021Q\240\221R\b\364\030\f\241\203\036\203!\200IJ.\020\005C"
+	.string	"W\030\002\362\024\021Q \372B\360\b\\a\b\230s4\242.\030\203H@L\024\006\217\210\200g\221\210\016\205F@_\207\243\210\340\320\b\350K\201\276\242a\021\210CDR\032\026\211\200F%\" \016:\f\021L_"
+	.string	"\356\030\203GD\327H)Dj,\036\035\201\277\024\270\302\020\360\306\005\242\342\020h\246@\020B02*\002\201\277\024=\032\031\025\201\276\025\206\2008\351\013DhQ\221\b\210W\030\002\352\004\323`\021\020-\022\216"
+	.string	"\336\230\240\302\320\t\300\025\206\2008=\n\207:FJ!\200G\324\210\242F#`N\nDQ <\236\037\212\202I@\340\211\026\025\221\200\346\2176"
+	.string	"S\"%cz\344pD\223bH9\034Sa\b\016JD\021\036\300\240D\024\016="
+	.string	"!\004`\b\"\300\300\001-R\032\022\021\205\034\214G%\016\021 B\223\216(\2220\305)\020E\022\246@ &B\217\300\027\3223\005\212 \026\207G\340p\030$:\306p\004\002}\356\200\020P\241\020\"\020\tm\310\360\007<\240\004\r<\260\001\0240\321\006\025Z\030\002\301!EE\030\203)\007\2420\210\304\201\310x\344\260\241"
+	.ascii	"D\350\221\b|!\365\375?\317\272N\007-\277\3315I\266)\263d\355"
+	.ascii	"4\273\\t"
+	.string	"'\300\240\372zi\303\006\215\311\222L\026\024=%\006\247\016\265\"]KL=\035.&VY\306,\017\236/6\220`Q\242#'+*\214\226\330\211D\243c*J\222\023JgY5\005\312\322\312]3*\034Ya[|>\270\224xCb\263\300\220]1;bU_\364\340b\005f\316\275h3\2474b\236\231\0226\246\327\367\002\031'\327Y\344\f\302u\022\021.e\013\230\304\3201\265SB\312\221<!?\211\374\374\352\360\341koA~\340\365\3759\344\364\372\t\344\377\345\330\230\3014\246\357}`\340\323\307\317\037\377O\347\316N\bV\337\373\260\300g\227\217\n\374\237=\310~R\312\206\350\361\240j\022t{Ev\250\001A\313\373:s\374\324q\303,!\313lu^\305\241T\302\341\270w<h`U;n\320\310\261\022\307D\304\206y\003'\214\236\030R\313N\365\220$5J\324\350\275\234$+Z"
+	.string	"\3112\177\330 ;[\2366\312)\212\023\214+\363\310\016\\\330\336V\337e\031\222\254\t\207\325-\233\26195lN\032g\325\311\245\207\r\255s\206I%\207\322\206\226\276K40$On2l\234\325\223\211-1n\230\252\0358\256\372\356\210\231\232:\223\032\224\026\314\325\232\257\025\214\305Q9a\374L\356\200\261\325\251\351\373\273\363\305\377\037\220-\007^\337\323E\016\323\213'Z\372\336\307\t\277\247\f\336\341\302\202\205\225\323\240\264rX6\212\340"
+	.string	"\311\021\005M\337\367\200\341\2355g\324\031u\271\244\326|\351\0309\323\004\252\357{p\340\377?Q\234)N\250\233\"\347\246\017\226Mq9'\203,\200\202'\366\364\023\352\247\212\021\332\210\025y\017\025~\317\024\346\361\322\346gns\"\177\300\252\316 [{k\360jD\261\2718\231~\"\177\232\350\360\341l5\224P4\372\236$~\226\370\177&\227\030-i}\317s\006\377t\372\371\230Ck\323\367l:\227\356\\N\226\231\223(s\217\f\346\201\202\346\346\0324\246\336\275\373 \227@\302p\306\213M]F~\005\371\340\002\204?\2503ASjp.\215a\024\214r\314\020\305\024\3316\215\001S\026@P@@$\227\013\323\332\r\023\300EOKT9\021+\306\324\224\210\244\240 I\366\032\003yG"
+	.string	"\rX\bu\357\260\036~\340\316\210\320\256\3318\001\016T\220\017q0\215\3613_\233\025\347\327\311@\345\367ZS\322\017\321\343\260DQ\003\312U\272\355\331Q\346\320\241O\251\275\272&\357\376Wn\334\353\332X\177m\323&\304[\361\330\304\367)K\243-W'-?\225\201\255\311T\026n\033\215\364b\307\254\037\034W\002\350\312\271\306\r\334\267\205\217\027q\265\364&\032\266Z\377\213\006\273\204~9\206\345\352\177\003N\2207\364\365lL\362|\234\200\321\355|\332\240\265%\353ay\244\020WM}P\223\352\317\\\273?_\020|\347\021\004\376\345p6\241\303\276P\204\275\257\232\345\263\177\304\234\263v\275\340\356@\270\225\022\277\037\2001\013-\230\257\2130b\033)c\373\352\223\2708\027\342P\034\023\2058W,t\272\230\274 \275\224\256x:\201F\327O\013^\252\232\035\314"
+	.string	"\200\035K\364@x\227\213`+X\242\324\n\300\311\244\003B\300G$\264\247\201\n7\305\214]Q%\367"
+	.string	"\212\217\217\302\343\240\314\022\001i\343tB\267YlH\267g\210\017\216i-`1p\303\374\004\351E-Y!\377k\277\027\226\363\034-\205\374\224F;0\251\330\314\200\362\370\250iX\001\002\203\217D\303\007\212\371aYxM\026\013\344p!\343-\310\243r\324\305U\351\227-\353l0\016F\302\271\253\233\336e]m\017\232"
+	.string	"A\b\314%\\\300\232"
+	.string	"\222\226'\033\034\217\256\363\226W\263W\036\300\221\206\023\251\032\210\225c\2407;T\3278\340\232\366\211\336\314d\005\276\325OH-\003\322\004\342lT\240ky\251\"\366i B{<\252,!\016\312\237\243\224\360\320\3134\\&\350\\\321\213P\334\027\232\026\350z\305\320>\024;\301\256\332\254\354\030|gS6\\\306|&\325j9m{\232>\237l\177L\r)\226\r\254\230\033+\037\271a\341T\023\250SC\323 \243\244\235\215:\274\026\037\212\270a\222\006\305\204uR\024\322\211\036\037`ux\322\367<\222I\304P\275\243\347\022p\310&\354\264@\234\246BaV\227!\350\\\214\336\345\364Q\226\371\272gY\3019\005\336g\2417\035\004\357F\022\22570\263"
+	.ascii	"\354\366\306\320\216AF\215\237\031\365=\344d\036I\240\267\350"
+	.ascii	"\263\244qa\034\036\021peE\034\204g\315\341\353\317\266\267I\336"
+	.ascii	"7T\345\375\032p\256\270\033\354B\343\210\350~q\240\335@\033\225"
+	.ascii	"\210\235\360\367\001^6'\363\215\300\354\364\306\216\267\305\272"
+	.ascii	"\314i\324\024\013H\227\206\032\254\302\021\335\273\261\375\034"
+	.ascii	"ht\255\005\\ya\2478\030\231\t\373\203U \236/\256\330\232\f\361"
+	.ascii	"U\030"
+	.string	"t\340?\035\303\242$\203\356\244\241\341T\017\3706f!n\210\027O\226*\350\245\300Z\301\006\213 \271\004\276\3057\260C\341\025\303\244\201?\003\301\252\033\341\312\331p\232(B\275\240\215\322\334\006\261\353\246\266@\374\343\340\207\312S\354\213\215z\005\216\222"
+	.string	"\r\222U\261\222\224TaK\353\312\245>ul\327\321[\250N\307\024\t\351\376\356\016`\302*G&\376M\237E#\032ldRm\244\310\2579@%\264\024\236\343\334{V\205>jN\023\201]\205\377\337y\030\302\016&_TE\177\b\005\374r|\207]S\034"
+	.ascii	"9\374\251xT\211\345\206\310Y\\\255\326\316\036\034{\233\002\202"
+	.ascii	"x\215\204\363\265\227!\213)\b\351\267\240\307\352\315\212\365"
+	.ascii	"\336\321\256\037\t\001`\206\244\224\336\375\004X\0048\203O8\376"
+	.ascii	"]\027)~\022\017\020\363m\324K%\277f\013:\t\347\220\236\334L\022"
+	.ascii	"\"\034\241h\337X(}\201\255I\325\224\b\230;\224_V \341/\f\030"
+	.ascii	"\246\246\202\354\320\224\242_Z\244*U5\3441t\031A\024\257t\f\002"
+	.ascii	"\024\223\270\271\002Y<\233"
+	.string	"\036~T\330B\327\273L\277\364To\253\\\017\312{\363D\213B\023\177X2\020=7$\016\301'\361\001P+\353\035\242\007&A5\203\225\220\013\334\346$\322\001\305\037\031BK\260\236\323\357\326a\256\211\332y#(:\306E\275Y\0014\256S\002\003\317\347\336\001\242<\345cI\030H\021\036\233z\013#\327\210\204#]\017\301\263\310\216-Nn\226\202\246\311\312\211\317\205\017\336\3319%\367\351\204\270\361\236\357\232\300\227}\362\321\017\362\312^8\343\352\336\034X\026\314H]\007Cq\202\235q\263\376qg\242\274$i\331\341\316\002S\246\233\372\003I\310\0024\371\367\372P\227\345.\003\f\257\004p\036\t\r\355l\022\275C:\302\323\352\373\035\277\314\330:'\206W1\317I\027\272\f\005e\006\205!\345\\\020\223\252\035\224 \227\215\303\n\343(j\240\312\n5\016\215_\220\023\360\201<\272\216\372\363P\321`\207"
+	.string	"fkX]@\364o\263\351\261\224\331\006\316\270\206\225b\270\233 =*\316\226\374\2153R\021a\017\f\306\001\n\027#\351QD\256K/\312\343\320\302>O\366\353|\246\b\340F\325\244\0340z=J\237\263n\034\252\333\247yHk,{\034\337\025\256\373"
+	.string	"W0i\206\021\251\3570hs\311<|\325\206\013\030\026\356t\305&6S \274\215B\253\\,\264"
+	.ascii	"i\352\310\214\210>\205\001S\312*\221\275\322\376\273\203\341"
+	.ascii	"df\272j\2242\032\321\177\275\235uC%\352\252&\253'i\2248^\251"
+	.ascii	"M\242b\f\203%\306\377\302\023\036\353\301`\2705S\025\353\001"
+	.ascii	"\361\031\263:\231e\305t\325f\327\317\033\237M|;\345\342K\353"
+	.ascii	"x\3577IL\342\203~\335\177\346\367%a\227\0027\2152g\231\024\356"
+	.ascii	"F\203\005\207\216\260Q\341!2\023\341F\251\355\006\f\213\202P"
+	.ascii	"\036\337\307\202\206\371,s\201|p\022\006\265h\006\"\366\240,"
+	.ascii	"\310j\237\234\271L\365\320\245gq6S\336\246b\351V\177\336\255"
+	.ascii	"k\216t\200\371\302\342${\361\354\233\033\fo\224a w\\\223\361"
+	.ascii	"foW\001wha\206\367uZ\177S\272\270\235\263oV\007\220-\f/B\364"
+	.ascii	"\234\"\276xj\202\303\376\264\337?\020\217-+\357\217\345\336G"
+	.ascii	"\250@L\214\225\215\340\330\213\245\306za:\245\320\306\2010\272"
+	.ascii	"\367d\213dIf\342\337\002\322$R\244\017\01321\t\331\3328\017I"
+	.ascii	"kv6\226s:t\350X\246'\334\211\b\277\223\244\355\352]\007\315|"
+	.ascii	"\223\036\310\3341\315G`\335\263\31201\033p\021\"\274Pe\334\214"
+	.ascii	"v\r\027\376\321\340'\332\020\3258u\177\346\300\317\353.\035\314"
+	.ascii	"\307$\023\241\251\357\334*\277\330\377\315x\003\214M8\336Y\320"
+	.ascii	"\020g\205\207\022L|\346\262\226\023\365\224i\361Q\2568\367\330"
+	.ascii	"~\323\363L\246\255D\037a8o7\tn!2~ \370Q=\215\n\302\177\344\212"
+	.ascii	"{\363\037\206S\006\177\365\326o4\267\223\336oU|v-\b\217\267`"
+	.ascii	"7\266SZ`\365,9\237\200\201\031;\020\337-\3634\232c\364\017\370"
+	.ascii	"\333\213\347\3167\246\237\226\277\232<\234\t<V\231\270\245\326"
+	.ascii	"?\323\344/\362\363\"\376nO\034jB\213K|\216\237\252d\016\373\241"
+	.ascii	"\225G\234\362\343\375n\265\177.SKf\243~\245\004\227\371\337,"
+	.ascii	"\300^\256l\304o*!\360\202\301\016\322U\271\213\375'[d\001\216"
+	.ascii	"\237_\363\362\003\351F\202\347\275N\350\313\0172\274\217\220"
+	.ascii	"\206\374U\237\001\371\363\260\322\034\177\373\024d\243\206\332"
+	.ascii	"\370\264@\233\036\220\341\036\271\177\307\335F\243\267\330\277"
+	.ascii	"\321\367\327\365}\343_GC\227\255\031\276zqc\002n.z\320'\346\026"
+	.ascii	"Yc\370\346\264.\334\357\253\373_pz\350\206\257\264q\"\353\003"
+	.ascii	"\276N\005U\037\217\r\362\3127\302\317\263\267\373e\224\215l\336"
+	.ascii	"<2\362\367\345\203\370\2029\267\203\227\271,\343\336y\377\004"
+	.ascii	"\343[Jw\306^\r\203\344>\034E\372[\3302\217\353\363e\325\360R"
+	.ascii	"3q\307\257\216.\270\252\367\003\307\277\355\376\316\365\032U"
+	.ascii	"W"
+	.text
+	.section	.gnu.lto_.symtab.6bc6fff6d02c814c,"e",@progbits
+	.string	"eepromData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"microsISR"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"delayMicroseconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"delay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"motorDevInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"pwmCompleteMotorUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"pwmGetMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"pwmAreMotorsEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"timerStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"adcGetChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\002"
+	.string	""
+	.string	"stackTotalSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"stackHighMem"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\002"
+	.string	""
+	.string	"SystemCoreClock"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\002"
+	.string	""
+	.string	"stderr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"stdout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"clock_gettime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\002"
+	.string	""
+	.string	"fclose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"fread"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"fopen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"nanosleep"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"sitlPhysicsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"setvbuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"strtod"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"getenv"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"sitlPhysicsSetMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"tcpSerialPollAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"sitlPhysicsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6bc6fff6d02c814c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
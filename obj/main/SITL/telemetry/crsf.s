@@ -0,0 +1,12812 @@
+	.file	"crsf.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/streambuf.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/sensors/current.h"
+	.file 7 "./src/main/sensors/voltage.h"
+	.file 8 "./src/main/sensors/battery.h"
+	.file 9 "./src/main/io/gps.h"
+	.file 10 "./src/main/drivers/resource.h"
+	.file 11 "./src/main/fc/runtime_config.h"
+	.file 12 "./src/main/flight/imu.h"
+	.file 13 "./src/main/rx/crsf.h"
+	.file 14 "./src/main/telemetry/crsf.h"
+	.file 15 "./src/main/fc/config.h"
+	.file 16 "./src/main/telemetry/crsf.c"
+	.file 17 "./src/main/common/maths.h"
+	.file 18 "./src/main/config/feature.h"
+	.file 19 "./src/main/fc/rc_controls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	crsf.c.03bf7655
+	.weak	crsf.c.03bf7655
+crsf.c.03bf7655:
+	.long	0xab3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1d
+	.long	.LASF1833
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1599
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1600
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1601
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1602
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1603
+	.uleb128 0x2
+	.long	.LASF1604
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1605
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1606
+	.uleb128 0x2
+	.long	.LASF1607
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1608
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xc
+	.long	0x7c
+	.uleb128 0x2
+	.long	.LASF1609
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1610
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1611
+	.uleb128 0xc
+	.long	0x9b
+	.uleb128 0x2
+	.long	.LASF1612
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1613
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF1614
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xc
+	.long	0xbf
+	.uleb128 0x2
+	.long	.LASF1615
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xc
+	.long	0xd0
+	.uleb128 0x2
+	.long	.LASF1616
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0xc
+	.long	0xe1
+	.uleb128 0x10
+	.long	0xa2
+	.uleb128 0x10
+	.long	0xbf
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1617
+	.uleb128 0x19
+	.long	.LASF1631
+	.byte	0x10
+	.byte	0x4
+	.byte	0x19
+	.long	0x12a
+	.uleb128 0x17
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x1a
+	.byte	0xe
+	.long	0xf7
+	.byte	0
+	.uleb128 0x17
+	.string	"end"
+	.byte	0x4
+	.byte	0x1b
+	.byte	0xe
+	.long	0xf7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1618
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x3
+	.long	0x103
+	.uleb128 0x2
+	.long	.LASF1619
+	.byte	0x5
+	.byte	0x19
+	.byte	0x11
+	.long	0xb3
+	.uleb128 0x2
+	.long	.LASF1620
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0xe1
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x6
+	.byte	0x16
+	.byte	0xe
+	.long	0x179
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1626
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x3
+	.long	0x14e
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x7
+	.byte	0x1a
+	.byte	0xe
+	.long	0x1a4
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1630
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x3
+	.long	0x185
+	.uleb128 0x19
+	.long	.LASF1632
+	.byte	0x14
+	.byte	0x8
+	.byte	0x1b
+	.long	0x24c
+	.uleb128 0x4
+	.long	.LASF1633
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xd
+	.long	0xbf
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1634
+	.byte	0x8
+	.byte	0x1e
+	.byte	0xd
+	.long	0xbf
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1635
+	.byte	0x8
+	.byte	0x1f
+	.byte	0xd
+	.long	0xbf
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1636
+	.byte	0x8
+	.byte	0x20
+	.byte	0xd
+	.long	0xbf
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF1637
+	.byte	0x8
+	.byte	0x22
+	.byte	0x1a
+	.long	0x1a4
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1638
+	.byte	0x8
+	.byte	0x25
+	.byte	0x1a
+	.long	0x179
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1639
+	.byte	0x8
+	.byte	0x26
+	.byte	0xe
+	.long	0xd0
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF1640
+	.byte	0x8
+	.byte	0x29
+	.byte	0x9
+	.long	0x24c
+	.byte	0xe
+	.uleb128 0x4
+	.long	.LASF1641
+	.byte	0x8
+	.byte	0x2a
+	.byte	0x9
+	.long	0x24c
+	.byte	0xf
+	.uleb128 0x4
+	.long	.LASF1642
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xd
+	.long	0xbf
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1643
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xd
+	.long	0xbf
+	.byte	0x11
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1644
+	.uleb128 0x2
+	.long	.LASF1645
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x3
+	.long	0x1b0
+	.uleb128 0xc
+	.long	0x253
+	.uleb128 0xb
+	.long	.LASF1646
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x18
+	.long	0x253
+	.uleb128 0x12
+	.long	0xb3
+	.long	0x280
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1647
+	.byte	0x9
+	.byte	0x69
+	.byte	0x10
+	.long	0x270
+	.uleb128 0xb
+	.long	.LASF1648
+	.byte	0x9
+	.byte	0x6b
+	.byte	0x10
+	.long	0xbf
+	.uleb128 0xb
+	.long	.LASF1649
+	.byte	0x9
+	.byte	0x70
+	.byte	0x11
+	.long	0xd0
+	.uleb128 0xb
+	.long	.LASF1650
+	.byte	0x9
+	.byte	0x71
+	.byte	0x11
+	.long	0xd0
+	.uleb128 0xb
+	.long	.LASF1651
+	.byte	0x9
+	.byte	0x72
+	.byte	0x11
+	.long	0xd0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xa
+	.byte	0x14
+	.byte	0xe
+	.long	0x3e3
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1662
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1671
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1675
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1676
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1677
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1678
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1679
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1680
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1681
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1683
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1684
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1685
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1686
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1687
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1693
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1694
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1695
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1696
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1697
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x10
+	.long	0x3e8
+	.uleb128 0x1f
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xb
+	.byte	0x22
+	.byte	0xe
+	.long	0x43b
+	.uleb128 0x1
+	.long	.LASF1699
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x80
+	.uleb128 0x9
+	.long	.LASF1707
+	.value	0x100
+	.uleb128 0x9
+	.long	.LASF1708
+	.value	0x200
+	.uleb128 0x9
+	.long	.LASF1709
+	.value	0x400
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1710
+	.byte	0xb
+	.byte	0x30
+	.byte	0x11
+	.long	0xd0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xb
+	.byte	0x36
+	.byte	0xe
+	.long	0x472
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0x10
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1716
+	.byte	0xb
+	.byte	0x42
+	.byte	0x10
+	.long	0xbf
+	.uleb128 0x20
+	.byte	0x6
+	.byte	0xc
+	.byte	0x22
+	.byte	0x5
+	.long	0x4af
+	.uleb128 0x4
+	.long	.LASF1717
+	.byte	0xc
+	.byte	0x24
+	.byte	0x11
+	.long	0xa7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1718
+	.byte	0xc
+	.byte	0x25
+	.byte	0x11
+	.long	0xa7
+	.byte	0x2
+	.uleb128 0x17
+	.string	"yaw"
+	.byte	0xc
+	.byte	0x26
+	.byte	0x11
+	.long	0xa7
+	.byte	0x4
+	.byte	0
+	.uleb128 0x21
+	.byte	0x6
+	.byte	0xc
+	.byte	0x20
+	.byte	0x9
+	.long	0x4d1
+	.uleb128 0x22
+	.string	"raw"
+	.byte	0xc
+	.byte	0x21
+	.byte	0xd
+	.long	0x4d1
+	.uleb128 0x23
+	.long	.LASF1719
+	.byte	0xc
+	.byte	0x27
+	.byte	0x7
+	.long	0x47e
+	.byte	0
+	.uleb128 0x12
+	.long	0xa7
+	.long	0x4e1
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1720
+	.byte	0xc
+	.byte	0x28
+	.byte	0x3
+	.long	0x4af
+	.uleb128 0xb
+	.long	.LASF1721
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x4e1
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xd
+	.byte	0x1a
+	.byte	0xe
+	.long	0x52a
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x21
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xd
+	.byte	0x23
+	.byte	0x6
+	.long	0x573
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xd
+	.byte	0x30
+	.byte	0x6
+	.long	0x5c2
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x8a
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0xc4
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0xc8
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0xca
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0xcc
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0xea
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0xec
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0xee
+	.byte	0
+	.uleb128 0x12
+	.long	0xbf
+	.long	0x5d2
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xe
+	.byte	0x16
+	.byte	0xe
+	.long	0x5fd
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1754
+	.byte	0xe
+	.byte	0x1c
+	.byte	0x3
+	.long	0x5d2
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xf
+	.byte	0x23
+	.byte	0xe
+	.long	0x6e6
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1760
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0x80
+	.uleb128 0x9
+	.long	.LASF1762
+	.value	0x100
+	.uleb128 0x9
+	.long	.LASF1763
+	.value	0x200
+	.uleb128 0x9
+	.long	.LASF1764
+	.value	0x400
+	.uleb128 0x9
+	.long	.LASF1765
+	.value	0x1000
+	.uleb128 0x9
+	.long	.LASF1766
+	.value	0x2000
+	.uleb128 0x9
+	.long	.LASF1767
+	.value	0x4000
+	.uleb128 0x9
+	.long	.LASF1768
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF1769
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF1770
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF1771
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF1772
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF1773
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF1774
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF1775
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF1776
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF1777
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF1778
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF1779
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF1780
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF1781
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1782
+	.byte	0x45
+	.byte	0xc
+	.long	0x24c
+	.uleb128 0x6
+	.long	.LASF1783
+	.byte	0x46
+	.byte	0x10
+	.long	0x5c2
+	.uleb128 0x6
+	.long	.LASF1784
+	.byte	0xf8
+	.byte	0x10
+	.long	0xbf
+	.uleb128 0x12
+	.long	0xbf
+	.long	0x717
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1785
+	.byte	0xf9
+	.byte	0x10
+	.long	0x707
+	.uleb128 0x11
+	.long	.LASF1786
+	.byte	0x4
+	.byte	0x26
+	.byte	0x9
+	.long	0xbf
+	.long	0x738
+	.uleb128 0x3
+	.long	0x738
+	.byte	0
+	.uleb128 0x10
+	.long	0x12a
+	.uleb128 0x11
+	.long	.LASF1787
+	.byte	0x11
+	.byte	0x93
+	.byte	0x9
+	.long	0xbf
+	.long	0x758
+	.uleb128 0x3
+	.long	0xbf
+	.uleb128 0x3
+	.long	0x22
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1789
+	.byte	0xd
+	.byte	0x5c
+	.long	0x76e
+	.uleb128 0x3
+	.long	0x3e3
+	.uleb128 0x3
+	.long	0x7c
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1788
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x5
+	.long	0x7c
+	.long	0x784
+	.uleb128 0x3
+	.long	0x738
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1790
+	.byte	0x4
+	.byte	0x30
+	.long	0x79a
+	.uleb128 0x3
+	.long	0x738
+	.uleb128 0x3
+	.long	0xf7
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1792
+	.byte	0xd
+	.byte	0x5e
+	.byte	0x5
+	.long	0x24c
+	.uleb128 0x24
+	.long	.LASF1811
+	.byte	0xd
+	.byte	0x5d
+	.byte	0x6
+	.uleb128 0x11
+	.long	.LASF1791
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x5
+	.long	0x24c
+	.long	0x7c4
+	.uleb128 0x3
+	.long	0xe1
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1793
+	.byte	0xd
+	.byte	0x63
+	.byte	0x5
+	.long	0x24c
+	.uleb128 0xd
+	.long	.LASF1794
+	.byte	0x4
+	.byte	0x24
+	.long	0x7e6
+	.uleb128 0x3
+	.long	0x738
+	.uleb128 0x3
+	.long	0xf2
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1795
+	.byte	0x13
+	.byte	0xc1
+	.byte	0x5
+	.long	0x24c
+	.uleb128 0x11
+	.long	.LASF1796
+	.byte	0x4
+	.byte	0x2c
+	.byte	0xa
+	.long	0xf7
+	.long	0x808
+	.uleb128 0x3
+	.long	0x738
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1797
+	.byte	0x8
+	.byte	0x45
+	.byte	0x9
+	.long	0xbf
+	.uleb128 0xe
+	.long	.LASF1798
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x9
+	.long	0xb3
+	.uleb128 0xe
+	.long	.LASF1799
+	.byte	0x8
+	.byte	0x46
+	.byte	0xa
+	.long	0xd0
+	.uleb128 0xd
+	.long	.LASF1800
+	.byte	0x4
+	.byte	0x21
+	.long	0x842
+	.uleb128 0x3
+	.long	0x738
+	.uleb128 0x3
+	.long	0xd0
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1801
+	.byte	0x4
+	.byte	0x22
+	.long	0x858
+	.uleb128 0x3
+	.long	0x738
+	.uleb128 0x3
+	.long	0xe1
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1802
+	.byte	0x4
+	.byte	0x1e
+	.long	0x86e
+	.uleb128 0x3
+	.long	0x738
+	.uleb128 0x3
+	.long	0xbf
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1803
+	.byte	0x10
+	.value	0x148
+	.byte	0x5
+	.long	0x7c
+	.long	0x8bc
+	.uleb128 0x18
+	.long	.LASF1804
+	.value	0x148
+	.byte	0x1b
+	.long	0xf7
+	.uleb128 0x18
+	.long	.LASF1805
+	.value	0x148
+	.byte	0x32
+	.long	0x5fd
+	.uleb128 0xf
+	.long	.LASF1806
+	.value	0x14a
+	.byte	0xc
+	.long	0x12a
+	.uleb128 0xf
+	.long	.LASF1807
+	.value	0x14b
+	.byte	0xd
+	.long	0x738
+	.uleb128 0xf
+	.long	.LASF1808
+	.value	0x15f
+	.byte	0xf
+	.long	0x83
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1813
+	.value	0x135
+	.long	0x8e0
+	.uleb128 0x18
+	.long	.LASF1809
+	.value	0x135
+	.byte	0x23
+	.long	0x142
+	.uleb128 0xf
+	.long	.LASF1810
+	.value	0x137
+	.byte	0x15
+	.long	0xe1
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1812
+	.byte	0x10
+	.value	0x12d
+	.byte	0x5
+	.long	0x24c
+	.uleb128 0x1a
+	.long	.LASF1814
+	.value	0x11d
+	.long	0x905
+	.uleb128 0xf
+	.long	.LASF1815
+	.value	0x122
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1827
+	.byte	0xfc
+	.long	0x93f
+	.uleb128 0x6
+	.long	.LASF1816
+	.byte	0xfe
+	.byte	0x14
+	.long	0xbf
+	.uleb128 0x6
+	.long	.LASF1817
+	.byte	0xff
+	.byte	0x13
+	.long	0xcb
+	.uleb128 0xf
+	.long	.LASF1818
+	.value	0x101
+	.byte	0xc
+	.long	0x12a
+	.uleb128 0x27
+	.string	"dst"
+	.byte	0x10
+	.value	0x102
+	.byte	0xd
+	.long	0x738
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1819
+	.byte	0xdc
+	.long	0x96c
+	.uleb128 0xa
+	.string	"dst"
+	.byte	0x10
+	.byte	0xdc
+	.byte	0x22
+	.long	0x738
+	.uleb128 0x6
+	.long	.LASF1820
+	.byte	0xdf
+	.byte	0xe
+	.long	0xf7
+	.uleb128 0x6
+	.long	.LASF1821
+	.byte	0xe4
+	.byte	0x11
+	.long	0xf2
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1822
+	.byte	0xce
+	.long	0x983
+	.uleb128 0xa
+	.string	"dst"
+	.byte	0x10
+	.byte	0xce
+	.byte	0x20
+	.long	0x738
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1823
+	.byte	0x97
+	.long	0x9b0
+	.uleb128 0xa
+	.string	"dst"
+	.byte	0x10
+	.byte	0x97
+	.byte	0x25
+	.long	0x738
+	.uleb128 0x6
+	.long	.LASF1639
+	.byte	0xa5
+	.byte	0x14
+	.long	0xed
+	.uleb128 0x6
+	.long	.LASF1824
+	.byte	0xa6
+	.byte	0x13
+	.long	0xcb
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1825
+	.byte	0x80
+	.long	0x9d2
+	.uleb128 0xa
+	.string	"dst"
+	.byte	0x10
+	.byte	0x80
+	.byte	0x1b
+	.long	0x738
+	.uleb128 0x6
+	.long	.LASF1826
+	.byte	0x8a
+	.byte	0x14
+	.long	0xdc
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1834
+	.byte	0x10
+	.byte	0x62
+	.byte	0xc
+	.long	0x7c
+	.long	0xa11
+	.uleb128 0xa
+	.string	"dst"
+	.byte	0x10
+	.byte	0x62
+	.byte	0x24
+	.long	0x738
+	.uleb128 0x1b
+	.long	.LASF1804
+	.byte	0x62
+	.byte	0x32
+	.long	0xf7
+	.uleb128 0x6
+	.long	.LASF1808
+	.byte	0x66
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x1c
+	.uleb128 0x16
+	.string	"ii"
+	.byte	0x67
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1828
+	.byte	0x5a
+	.long	0xa28
+	.uleb128 0xa
+	.string	"dst"
+	.byte	0x10
+	.byte	0x5a
+	.byte	0x22
+	.long	0x738
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1829
+	.byte	0x50
+	.long	0xa6d
+	.uleb128 0xa
+	.string	"dst"
+	.byte	0x10
+	.byte	0x50
+	.byte	0x22
+	.long	0x738
+	.uleb128 0x1b
+	.long	.LASF1830
+	.byte	0x50
+	.byte	0x30
+	.long	0xf7
+	.uleb128 0x16
+	.string	"crc"
+	.byte	0x52
+	.byte	0xd
+	.long	0xbf
+	.uleb128 0x16
+	.string	"end"
+	.byte	0x53
+	.byte	0xe
+	.long	0xf7
+	.uleb128 0x1c
+	.uleb128 0x16
+	.string	"ptr"
+	.byte	0x54
+	.byte	0x13
+	.long	0xf7
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1831
+	.byte	0x48
+	.long	0xa84
+	.uleb128 0xa
+	.string	"dst"
+	.byte	0x10
+	.byte	0x48
+	.byte	0x29
+	.long	0x738
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1835
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x53
+	.long	0xa90
+	.uleb128 0x10
+	.long	0x25f
+	.uleb128 0x2a
+	.long	.LASF1832
+	.byte	0x5
+	.byte	0x25
+	.byte	0x1b
+	.long	0x136
+	.uleb128 0xa
+	.string	"a"
+	.byte	0x5
+	.byte	0x25
+	.byte	0x2e
+	.long	0x142
+	.uleb128 0xa
+	.string	"b"
+	.byte	0x5
+	.byte	0x25
+	.byte	0x3a
+	.long	0x142
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 20 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.file 23 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 25 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 26 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 29 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 36 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 40 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 41 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x29
+	.file 42 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 43 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x2b
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 44 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x2c
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.file 45 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2d
+	.file 46 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.file 47 "./src/main/build/version.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF990
+	.file 48 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x4
+	.byte	0x4
+	.file 49 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x8
+	.file 50 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x32
+	.file 51 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1110
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1111
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.file 52 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x7
+	.file 53 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 54 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x36
+	.file 55 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x37
+	.file 56 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 57 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 58 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 59 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1517
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1518
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0xc
+	.byte	0x4
+	.file 60 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 61 "./src/main/telemetry/telemetry.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1588
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0xf
+	.file 62 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3e
+	.byte	0x4
+	.file 63 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3f
+	.byte	0x4
+	.file 64 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 65 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x41
+	.byte	0x4
+	.file 66 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 67 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1594
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1598
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF978
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.ab1ea5032441cd47c4f3251c83c3755e,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF989
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1072
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1089
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1105
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1109
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1115
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1124
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1126
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1128
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1148
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1516
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.crsf.h.20.5d1ddf160b80638dd6926c0a31784517,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1587
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1590
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1593
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF1836
+	.long	.LASF1837
+	.long	.LASF1838
+	.long	.LASF1839
+	.long	.LASF1840
+	.long	.LASF1841
+	.long	.LASF1842
+	.long	.LASF1843
+	.long	.LASF1844
+	.long	.LASF1845
+	.long	.LASF1846
+	.long	.LASF1847
+	.long	.LASF1848
+	.long	.LASF1849
+	.long	.LASF1850
+	.long	.LASF1851
+	.long	.LASF1852
+	.long	.LASF1853
+	.long	.LASF1854
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x44
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1855
+	.byte	0xf
+	.long	.LASF1856
+	.byte	0xf
+	.long	.LASF1857
+	.byte	0xf
+	.long	.LASF1858
+	.byte	0x2
+	.long	.LASF1859
+	.byte	0x2
+	.long	.LASF1860
+	.byte	0x9
+	.long	.LASF1861
+	.byte	0x9
+	.long	.LASF1862
+	.byte	0x9
+	.long	.LASF1863
+	.byte	0x7
+	.long	.LASF1864
+	.byte	0x4
+	.long	.LASF1865
+	.byte	0x5
+	.long	.LASF1866
+	.byte	0x6
+	.long	.LASF1867
+	.byte	0x8
+	.long	.LASF1867
+	.byte	0xc
+	.long	.LASF1868
+	.byte	0x5
+	.long	.LASF1869
+	.byte	0xc
+	.long	.LASF1870
+	.byte	0x2
+	.long	.LASF1871
+	.byte	0x3
+	.long	.LASF1872
+	.byte	0x5
+	.long	.LASF1873
+	.byte	0x12
+	.long	.LASF1874
+	.byte	0x13
+	.long	.LASF1875
+	.byte	0x13
+	.long	.LASF1875
+	.byte	0x12
+	.long	.LASF1876
+	.byte	0xf
+	.long	.LASF1877
+	.byte	0x12
+	.long	.LASF1878
+	.byte	0x12
+	.long	.LASF1879
+	.byte	0xf
+	.long	.LASF1880
+	.byte	0xf
+	.long	.LASF1881
+	.byte	0x11
+	.long	.LASF1882
+	.byte	0xf
+	.long	.LASF1883
+	.byte	0x10
+	.long	.LASF1884
+	.byte	0x10
+	.long	.LASF1885
+	.byte	0xf
+	.long	.LASF1886
+	.byte	0xf
+	.long	.LASF1887
+	.byte	0xf
+	.long	.LASF1888
+	.byte	0x12
+	.long	.LASF1889
+	.byte	0x13
+	.long	.LASF1890
+	.byte	0xe
+	.long	.LASF1891
+	.byte	0xe
+	.long	.LASF1892
+	.byte	0x12
+	.long	.LASF1893
+	.byte	0xd
+	.long	.LASF1894
+	.byte	0xb
+	.long	.LASF1895
+	.byte	0xa
+	.long	.LASF1896
+	.byte	0xb
+	.long	.LASF1897
+	.byte	0x3
+	.long	.LASF1898
+	.byte	0x1
+	.long	.LASF1899
+	.byte	0x1
+	.long	.LASF1900
+	.byte	0x3
+	.long	.LASF1901
+	.byte	0x2
+	.long	.LASF1902
+	.byte	0x2
+	.long	.LASF1903
+	.byte	0x2
+	.long	.LASF1904
+	.byte	0x9
+	.long	.LASF1905
+	.byte	0x9
+	.long	.LASF1906
+	.byte	0x7
+	.long	.LASF1906
+	.byte	0x4
+	.long	.LASF1907
+	.byte	0x4
+	.long	.LASF1908
+	.byte	0x4
+	.long	.LASF1909
+	.byte	0x4
+	.long	.LASF1910
+	.byte	0x4
+	.long	.LASF1911
+	.byte	0x8
+	.long	.LASF1912
+	.byte	0xc
+	.long	.LASF1913
+	.byte	0x4
+	.long	.LASF1914
+	.byte	0x4
+	.long	.LASF1915
+	.byte	0x4
+	.long	.LASF1916
+	.byte	0x4
+	.long	.LASF1917
+	.byte	0x4
+	.long	.LASF1918
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1508:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1346:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1525:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1537:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1144:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1361:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1440:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1080:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1170:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1264:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1078:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1362:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF897:
+	.string	"USE_PPM"
+.LASF1282:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1755:
+	.string	"FEATURE_RX_PPM"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1512:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1411:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1790:
+	.string	"sbufSwitchToReader"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF956:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1150:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1604:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1644:
+	.string	"_Bool"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1129:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1597:
+	.string	"BV(x) (1 << (x))"
+.LASF1660:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1499:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1372:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1364:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1472:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1540:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1646:
+	.string	"batteryConfig_System"
+.LASF1749:
+	.string	"CRSF_FRAME_START"
+.LASF1133:
+	.string	"IOCFG_AF_OD 0"
+.LASF962:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1201:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1151:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1435:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1381:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF978:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1548:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1140:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF1504:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1028:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1587:
+	.string	"CRSF_PAYLOAD_SIZE_MAX (CRSF_FRAME_SIZE_MAX - 4)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1476:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1821:
+	.string	"flightMode"
+.LASF1451:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1348:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF992:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1754:
+	.string	"crsfFrameType_e"
+.LASF1657:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1712:
+	.string	"GPS_FIX"
+.LASF1511:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1679:
+	.string	"OWNER_FLASH"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1764:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1615:
+	.string	"uint16_t"
+.LASF1204:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1514:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1013:
+	.string	"PG_RX_CONFIG 24"
+.LASF1274:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1443:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1334:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1422:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF1341:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF968:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1410:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1168:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1829:
+	.string	"crsfWriteCrc"
+.LASF1211:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1137:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF1795:
+	.string	"isAirmodeActive"
+.LASF1449:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1563:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1324:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1386:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1024:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1827:
+	.string	"processCrsf"
+.LASF1290:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1277:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1101:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1713:
+	.string	"CALIBRATE_MAG"
+.LASF966:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1163:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1271:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1355:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1662:
+	.string	"OWNER_ADC_RSSI"
+.LASF1521:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1467:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1081:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1193:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1327:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1032:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1748:
+	.string	"CRSF_ADDRESS_CRSF_TRANSMITTER"
+.LASF1402:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1475:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1431:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1503:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1664:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1171:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1136:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF959:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1824:
+	.string	"batteryRemainingPercentage"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1098:
+	.string	"BIT(x) (1 << (x))"
+.LASF1689:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1589:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF961:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1179:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1302:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF981:
+	.string	"FC_VERSION_MINOR 2"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1613:
+	.string	"int32_t"
+.LASF1330:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1454:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1076:
+	.string	"FAST_MATH "
+.LASF883:
+	.string	"BARO "
+.LASF1735:
+	.string	"CRSF_FRAME_LENGTH_TYPE"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1596:
+	.string	"DECIDEGREES_TO_RADIANS10000(angle) ((int16_t)(1000.0f * (angle) * RAD))"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF1479:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1425:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1142:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1246:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1686:
+	.string	"OWNER_BARO_EXTI"
+.LASF1009:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF546:
+	.string	"__always_inline"
+.LASF1262:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1732:
+	.string	"CRSF_FRAME_ATTITUDE_PAYLOAD_SIZE"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF898:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1507:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1719:
+	.string	"values"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1663:
+	.string	"OWNER_SERIAL_TX"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF984:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1029:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1042:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1043:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1249:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1762:
+	.string	"FEATURE_FAILSAFE"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1242:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1365:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1624:
+	.string	"CURRENT_METER_ESC"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1630:
+	.string	"voltageMeterSource_e"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1558:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1405:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1085:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1531:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1478:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1687:
+	.string	"OWNER_USB"
+.LASF1815:
+	.string	"index"
+.LASF1210:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1060:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1734:
+	.string	"CRSF_FRAME_LENGTH_FRAMELENGTH"
+.LASF402:
+	.string	"false 0"
+.LASF1698:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1418:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF1612:
+	.string	"int16_t"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1322:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1699:
+	.string	"ANGLE_MODE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1119:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1453:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1810:
+	.string	"crsfLastCycleTime"
+.LASF1733:
+	.string	"CRSF_FRAME_LENGTH_ADDRESS"
+.LASF1387:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1780:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1584:
+	.string	"CRSF_PORT_MODE MODE_RXTX"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1766:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1325:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1668:
+	.string	"OWNER_SONAR_ECHO"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1428:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1298:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1570:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1021:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1064:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1360:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1656:
+	.string	"OWNER_SERVO"
+.LASF1241:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF881:
+	.string	"ACC "
+.LASF1740:
+	.string	"CRSF_ADDRESS_RESERVED1"
+.LASF1744:
+	.string	"CRSF_ADDRESS_RESERVED2"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1469:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF803:
+	.string	"USE_PWM "
+.LASF1458:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF1594:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1549:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1254:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1768:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1496:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1602:
+	.string	"long unsigned int"
+.LASF1358:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1717:
+	.string	"roll"
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1787:
+	.string	"crc8_dvb_s2"
+.LASF1177:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1244:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1554:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1605:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1607:
+	.string	"__uint16_t"
+.LASF1533:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF1741:
+	.string	"CRSF_ADDRESS_CURRENT_SENSOR"
+.LASF1655:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1261:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1811:
+	.string	"crsfRxSendTelemetryData"
+.LASF1683:
+	.string	"OWNER_RX_SPI_CS"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1702:
+	.string	"BARO_MODE"
+.LASF1522:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1294:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1783:
+	.string	"crsfFrame"
+.LASF1236:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1149:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1636:
+	.string	"batteryNotPresentLevel"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1182:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1180:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1471:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1812:
+	.string	"checkCrsfTelemetryState"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1074:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1571:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1106:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1297:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1094:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1647:
+	.string	"GPS_coord"
+.LASF1794:
+	.string	"sbufWriteString"
+.LASF1730:
+	.string	"CRSF_FRAME_LINK_STATISTICS_PAYLOAD_SIZE"
+.LASF1214:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1763:
+	.string	"FEATURE_SONAR"
+.LASF1489:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1700:
+	.string	"HORIZON_MODE"
+.LASF1599:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1758:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1757:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1071:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1128:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF960:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF1048:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1491:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1022:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1377:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1005:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1052:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1789:
+	.string	"crsfRxWriteTelemetryData"
+.LASF1528:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1617:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1000:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF964:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1468:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1450:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1266:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1709:
+	.string	"FAILSAFE_MODE"
+.LASF1643:
+	.string	"vbathysteresis"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1055:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1796:
+	.string	"sbufPtr"
+.LASF1072:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF1802:
+	.string	"sbufWriteU8"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1639:
+	.string	"batteryCapacity"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1218:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1760:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1797:
+	.string	"calculateBatteryPercentageRemaining"
+.LASF1186:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1286:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1722:
+	.string	"CRSF_FRAMETYPE_GPS"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1107:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1223:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF1141:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1484:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1695:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1834:
+	.string	"crsfFinalizeBuf"
+.LASF1742:
+	.string	"CRSF_ADDRESS_TBS_BLACKBOX"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1550:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1751:
+	.string	"CRSF_FRAME_BATTERY_SENSOR"
+.LASF976:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1284:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1007:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1703:
+	.string	"GPS_HOME_MODE"
+.LASF1628:
+	.string	"VOLTAGE_METER_ADC"
+.LASF1311:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1289:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1378:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1357:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1677:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1474:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1420:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1263:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1135:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1339:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1255:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1566:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF990:
+	.string	"BETAFLIGHT "
+.LASF1173:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1626:
+	.string	"currentMeterSource_e"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1225:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1292:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1373:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF986:
+	.string	"MW_VERSION 231"
+.LASF1538:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1778:
+	.string	"FEATURE_RX_SPI"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF989:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1640:
+	.string	"useVBatAlerts"
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1494:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1423:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1027:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF1637:
+	.string	"voltageMeterSource"
+.LASF1506:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1784:
+	.string	"crsfScheduleCount"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1434:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1037:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1523:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1465:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1251:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1259:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1574:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1688:
+	.string	"OWNER_USB_DETECT"
+.LASF1368:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1345:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1487:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1131:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1126:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1047:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1627:
+	.string	"VOLTAGE_METER_NONE"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1314:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1319:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1708:
+	.string	"SONAR_MODE"
+.LASF1498:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1770:
+	.string	"FEATURE_DASHBOARD"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF958:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1183:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1692:
+	.string	"OWNER_INVERTER"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF1323:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1672:
+	.string	"OWNER_SPI_MOSI"
+.LASF1477:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1701:
+	.string	"MAG_MODE"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1614:
+	.string	"uint8_t"
+.LASF1222:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1726:
+	.string	"CRSF_FRAMETYPE_ATTITUDE"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1075:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF1326:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1096:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF979:
+	.string	"FC_FIRMWARE_NAME \"Betaflight\""
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF1041:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1329:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1598:
+	.string	"CRSF_SCHEDULE_COUNT_MAX 5"
+.LASF1077:
+	.string	"VERY_FAST_MATH "
+.LASF1500:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1127:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1069:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1416:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1595:
+	.string	"CRSF_CYCLETIME_US 100000"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1818:
+	.string	"crsfPayloadBuf"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1335:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1756:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF1739:
+	.string	"CRSF_ADDRESS_TBS_CORE_PNP_PRO"
+.LASF1747:
+	.string	"CRSF_ADDRESS_CRSF_RECEIVER"
+.LASF1221:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1470:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1806:
+	.string	"crsfFrameBuf"
+.LASF1337:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1731:
+	.string	"CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF822:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1530:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1546:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1143:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1801:
+	.string	"sbufWriteU32BigEndian"
+.LASF1654:
+	.string	"OWNER_PPMINPUT"
+.LASF1343:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF949:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1490:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1245:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF1433:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1174:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1430:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1448:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1273:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1340:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF1509:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1555:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1370:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1015:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF977:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF967:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1189:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1581:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1212:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF1725:
+	.string	"CRSF_FRAMETYPE_RC_CHANNELS_PACKED"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1258:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF1209:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1414:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1063:
+	.string	"PG_VCD_CONFIG 514"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF1407:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1389:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1728:
+	.string	"CRSF_FRAME_GPS_PAYLOAD_SIZE"
+.LASF1452:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1208:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1192:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1773:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1729:
+	.string	"CRSF_FRAME_BATTERY_SENSOR_PAYLOAD_SIZE"
+.LASF1318:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1753:
+	.string	"CRSF_FRAME_GPS"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF1147:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1394:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1061:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1455:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1667:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1089:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1446:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1392:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1296:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1299:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1526:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1752:
+	.string	"CRSF_FRAME_FLIGHT_MODE"
+.LASF1642:
+	.string	"consumptionWarningPercentage"
+.LASF1195:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1750:
+	.string	"CRSF_FRAME_ATTITUDE"
+.LASF1737:
+	.string	"CRSF_FRAME_LENGTH_TYPE_CRC"
+.LASF1588:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1338:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1711:
+	.string	"GPS_FIX_HOME"
+.LASF1776:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1466:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF1718:
+	.string	"pitch"
+.LASF1669:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1620:
+	.string	"timeUs_t"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF965:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF499:
+	.string	"__PMT"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1727:
+	.string	"CRSF_FRAMETYPE_FLIGHT_MODE"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1145:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1344:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1481:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1039:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1746:
+	.string	"CRSF_ADDRESS_RADIO_TRANSMITTER"
+.LASF1652:
+	.string	"OWNER_FREE"
+.LASF1793:
+	.string	"crsfRxIsActive"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1376:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1553:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1295:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1309:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1586:
+	.string	"CRSF_FRAME_SIZE_MAX 64"
+.LASF997:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1220:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1350:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1808:
+	.string	"frameSize"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1184:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1110:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF1191:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1293:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF1791:
+	.string	"feature"
+.LASF996:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1375:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF1779:
+	.string	"FEATURE_SOFTSPI"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF1785:
+	.string	"crsfSchedule"
+.LASF1154:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1354:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1833:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1535:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1187:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1175:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1321:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1153:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1828:
+	.string	"crsfFinalize"
+.LASF1464:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1786:
+	.string	"sbufReadU8"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1285:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1645:
+	.string	"batteryConfig_t"
+.LASF1124:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1395:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF1583:
+	.string	"CRSF_PORT_OPTIONS (SERIAL_STOPBITS_1 | SERIAL_PARITY_NO)"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF991:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1437:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1190:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1185:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF802:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1166:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1622:
+	.string	"CURRENT_METER_ADC"
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1704:
+	.string	"GPS_HOLD_MODE"
+.LASF1541:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1240:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1547:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1227:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF998:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1084:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1591:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF1091:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1705:
+	.string	"HEADFREE_MODE"
+.LASF1675:
+	.string	"OWNER_SDCARD"
+.LASF1256:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1409:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1495:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1038:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF985:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1342:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1600:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1303:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1603:
+	.string	"signed char"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF957:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1243:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1424:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1830:
+	.string	"start"
+.LASF766:
+	.string	"__size_t__ "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1206:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1492:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1460:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF1316:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1006:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1035:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1045:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1714:
+	.string	"SMALL_ANGLE"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF1073:
+	.string	"sq(x) ((x)*(x))"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1650:
+	.string	"GPS_speed"
+.LASF1401:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1320:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1545:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1560:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF1219:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1419:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1482:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF1562:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1152:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1100:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1157:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1527:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1014:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1567:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1616:
+	.string	"uint32_t"
+.LASF1398:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1697:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1018:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1232:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF1807:
+	.string	"sbuf"
+.LASF1068:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1690:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1379:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1493:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1200:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1459:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1023:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1125:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF982:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1792:
+	.string	"crsfRxIsTelemetryBufEmpty"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1161:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1551:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1332:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1198:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1798:
+	.string	"getAmperage"
+.LASF1062:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1235:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1176:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF1103:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1524:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1305:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1020:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1436:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1544:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1167:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF963:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF929:
+	.string	"USE_PROFILE "
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1367:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1771:
+	.string	"FEATURE_OSD"
+.LASF1557:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF973:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF821:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1353:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1352:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF1743:
+	.string	"CRSF_ADDRESS_COLIBRI_RACE_FC"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF1716:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1238:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1148:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1017:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1441:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1610:
+	.string	"long int"
+.LASF987:
+	.string	"GIT_SHORT_REVISION_LENGTH 7"
+.LASF1270:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1010:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1083:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1086:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1288:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1665:
+	.string	"OWNER_PINDEBUG"
+.LASF1215:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1809:
+	.string	"currentTimeUs"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1775:
+	.string	"FEATURE_AIRMODE"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1123:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1315:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1001:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1442:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1632:
+	.string	"batteryConfig_s"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1625:
+	.string	"CURRENT_METER_MAX"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1095:
+	.string	"EXPAND_I(x) x"
+.LASF1291:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1564:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1382:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1248:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1649:
+	.string	"GPS_altitude"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1543:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1056:
+	.string	"PG_PPM_CONFIG 507"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1415:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1832:
+	.string	"cmpTimeUs"
+.LASF1036:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1082:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1053:
+	.string	"PG_PID_CONFIG 504"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF1426:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1542:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF522:
+	.string	"__flexarr []"
+.LASF813:
+	.string	"LED_STRIP "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1819:
+	.string	"crsfFrameFlightMode"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1194:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF980:
+	.string	"FC_VERSION_MAJOR 3"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1033:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF975:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF993:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1231:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1280:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1306:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1666:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1034:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1217:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1444:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1390:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF1158:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1582:
+	.string	"CRSF_BAUDRATE 420000"
+.LASF1116:
+	.string	"LAT 0"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1611:
+	.string	"char"
+.LASF1559:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1287:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1224:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1371:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1283:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1532:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF1805:
+	.string	"frameType"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1351:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF888:
+	.string	"USE_UART2 "
+.LASF972:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1445:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1199:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1359:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF1093:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1333:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1385:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1539:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1823:
+	.string	"crsfFrameBatterySensor"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF1575:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1114:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1111:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1565:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF1108:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1202:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1026:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1336:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF1515:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1678:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF983:
+	.string	"STR_HELPER(x) #x"
+.LASF1759:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1031:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1670:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1252:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1070:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1413:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1552:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1230:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1268:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF974:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1205:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1648:
+	.string	"GPS_numSat"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1788:
+	.string	"sbufBytesRemaining"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1578:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1529:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1457:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1393:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1835:
+	.string	"batteryConfig"
+.LASF1356:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1272:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1777:
+	.string	"FEATURE_VTX"
+.LASF1313:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1488:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF1172:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1349:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1510:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1803:
+	.string	"getCrsfFrame"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1307:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1388:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF1216:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1822:
+	.string	"crsfFrameAttitude"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1536:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1044:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF969:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1328:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1046:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF970:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1054:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1404:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1633:
+	.string	"vbatmaxcellvoltage"
+.LASF1585:
+	.string	"CRSF_MAX_CHANNEL 16"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1260:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1826:
+	.string	"altitude"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1066:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1590:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1673:
+	.string	"OWNER_I2C_SCL"
+.LASF1671:
+	.string	"OWNER_SPI_MISO"
+.LASF1165:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1696:
+	.string	"OWNER_COMPASS_CS"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF1102:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1188:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1438:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1781:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF994:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1767:
+	.string	"FEATURE_RX_MSP"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1269:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1331:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1761:
+	.string	"FEATURE_GPS"
+.LASF1694:
+	.string	"OWNER_TRANSPONDER"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1456:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1304:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1608:
+	.string	"__int32_t"
+.LASF1825:
+	.string	"crsfFrameGps"
+.LASF1308:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1674:
+	.string	"OWNER_I2C_SDA"
+.LASF1580:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1609:
+	.string	"__uint32_t"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1247:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1417:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1769:
+	.string	"FEATURE_LED_STRIP"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1011:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1635:
+	.string	"vbatwarningcellvoltage"
+.LASF801:
+	.string	"USE_CLI "
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF1462:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1207:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1619:
+	.string	"timeDelta_t"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF1497:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1040:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1019:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1134:
+	.string	"IOCFG_IPD 0"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1715:
+	.string	"FIXED_WING"
+.LASF1396:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1577:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF1427:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1408:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1573:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1250:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1113:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1275:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF1146:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1164:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1513:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1724:
+	.string	"CRSF_FRAMETYPE_LINK_STATISTICS"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1267:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1383:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1638:
+	.string	"currentMeterSource"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1561:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1159:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1391:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1016:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1226:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1300:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1366:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1691:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1120:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1012:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1710:
+	.string	"flightModeFlags"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF1088:
+	.string	"Q12 (1 << 12)"
+.LASF1253:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF1374:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1572:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1312:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1115:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1520:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1169:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1099:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF879:
+	.string	"GYRO "
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1621:
+	.string	"CURRENT_METER_NONE"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1681:
+	.string	"OWNER_MPU_CS"
+.LASF1684:
+	.string	"OWNER_SPI_CS"
+.LASF1058:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1631:
+	.string	"sbuf_s"
+.LASF1618:
+	.string	"sbuf_t"
+.LASF1203:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1556:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1461:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1723:
+	.string	"CRSF_FRAMETYPE_BATTERY_SENSOR"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1117:
+	.string	"LON 1"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF885:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1399:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1104:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1008:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF1403:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1480:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1463:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF995:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1439:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1817:
+	.string	"currentSchedule"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1105:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1745:
+	.string	"CRSF_ADDRESS_RACE_TAG"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1051:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1659:
+	.string	"OWNER_ADC_BATT"
+.LASF1025:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF1237:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1623:
+	.string	"CURRENT_METER_VIRTUAL"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1641:
+	.string	"useConsumptionAlerts"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1579:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1178:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1109:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1814:
+	.string	"initCrsfTelemetry"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1197:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1653:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1519:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1281:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1502:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1534:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1363:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1121:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1181:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1774:
+	.string	"FEATURE_TRANSPONDER"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1097:
+	.string	"UNUSED(x) (void)(x)"
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF1501:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1155:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1112:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1485:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1257:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1130:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1765:
+	.string	"FEATURE_3D"
+.LASF1782:
+	.string	"crsfTelemetryEnabled"
+.LASF1593:
+	.string	"BEEP_ON do {} while(0)"
+.LASF1568:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF999:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1676:
+	.string	"OWNER_SDCARD_CS"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1196:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1087:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF1721:
+	.string	"attitude"
+.LASF1122:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1162:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1160:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1629:
+	.string	"VOLTAGE_METER_ESC"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF988:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1483:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1369:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1429:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1278:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1234:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1301:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1813:
+	.string	"handleCrsfTelemetry"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1132:
+	.string	"IOCFG_AF_PP 0"
+.LASF1059:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1380:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1265:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1720:
+	.string	"attitudeEulerAngles_t"
+.LASF1138:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1693:
+	.string	"OWNER_LED_STRIP"
+.LASF1397:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1090:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1118:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1569:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1576:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1706:
+	.string	"UNUSED_MODE"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1505:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1003:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1820:
+	.string	"lengthPtr"
+.LASF1030:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1310:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF1799:
+	.string	"getBatteryVoltage"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1156:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1139:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1592:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1213:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1680:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1049:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1239:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1079:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1736:
+	.string	"CRSF_FRAME_LENGTH_CRC"
+.LASF1738:
+	.string	"CRSF_ADDRESS_BROADCAST"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1831:
+	.string	"crsfInitializeFrame"
+.LASF1601:
+	.string	"unsigned int"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF1347:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1317:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF1800:
+	.string	"sbufWriteU16BigEndian"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1092:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1447:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1233:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1065:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1057:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1384:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1658:
+	.string	"OWNER_ADC"
+.LASF1606:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1685:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1816:
+	.string	"crsfScheduleIndex"
+.LASF1517:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1276:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1486:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1432:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1804:
+	.string	"frame"
+.LASF1772:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF1707:
+	.string	"PASSTHRU_MODE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1518:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF1004:
+	.string	"PG_PID_PROFILE 14"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1661:
+	.string	"OWNER_ADC_EXT"
+.LASF1050:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1229:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1682:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1473:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF971:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1651:
+	.string	"GPS_ground_course"
+.LASF1067:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1634:
+	.string	"vbatmincellvoltage"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1516:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1279:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1858:
+	.string	"streambuf.h"
+.LASF1882:
+	.string	"long-double.h"
+.LASF1891:
+	.string	"__locale_t.h"
+.LASF1893:
+	.string	"platform.h"
+.LASF1843:
+	.string	"src/main/rx"
+.LASF1869:
+	.string	"crsf.c"
+.LASF1876:
+	.string	"libc-header-start.h"
+.LASF1862:
+	.string	"battery.h"
+.LASF1860:
+	.string	"current.h"
+.LASF1867:
+	.string	"crsf.h"
+.LASF1852:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1892:
+	.string	"strings.h"
+.LASF1856:
+	.string	"stdint-intn.h"
+.LASF1872:
+	.string	"rc_controls.h"
+.LASF1903:
+	.string	"axis.h"
+.LASF1851:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1854:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1883:
+	.string	"stubs.h"
+.LASF1916:
+	.string	"sdcard.h"
+.LASF1907:
+	.string	"io.h"
+.LASF1845:
+	.string	"src/main/target/SITL"
+.LASF1911:
+	.string	"rx.h"
+.LASF1895:
+	.string	"target.h"
+.LASF1842:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1861:
+	.string	"voltage.h"
+.LASF1850:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1868:
+	.string	"config.h"
+.LASF1866:
+	.string	"imu.h"
+.LASF1888:
+	.string	"string.h"
+.LASF1878:
+	.string	"features-time64.h"
+.LASF1918:
+	.string	"vcd.h"
+.LASF1917:
+	.string	"sound_beeper.h"
+.LASF1855:
+	.string	"types.h"
+.LASF1908:
+	.string	"io_types.h"
+.LASF1865:
+	.string	"runtime_config.h"
+.LASF1886:
+	.string	"time64.h"
+.LASF1839:
+	.string	"src/main/drivers"
+.LASF1853:
+	.string	"/usr/include"
+.LASF1836:
+	.string	"src/main/build"
+.LASF1871:
+	.string	"feature.h"
+.LASF1877:
+	.string	"features.h"
+.LASF1841:
+	.string	"src/main/flight"
+.LASF1885:
+	.string	"typesizes.h"
+.LASF0:
+	.string	"./src/main/telemetry/crsf.c"
+.LASF1837:
+	.string	"src/main/common"
+.LASF1906:
+	.string	"serial.h"
+.LASF1914:
+	.string	"flash.h"
+.LASF1838:
+	.string	"src/main/config"
+.LASF1909:
+	.string	"io_def.h"
+.LASF1880:
+	.string	"timesize.h"
+.LASF1881:
+	.string	"cdefs.h"
+.LASF1857:
+	.string	"stdint-uintn.h"
+.LASF1846:
+	.string	"src/main/target"
+.LASF1901:
+	.string	"utils.h"
+.LASF1848:
+	.string	"src/main"
+.LASF1915:
+	.string	"rx_pwm.h"
+.LASF1844:
+	.string	"src/main/sensors"
+.LASF1864:
+	.string	"resource.h"
+.LASF1912:
+	.string	"telemetry.h"
+.LASF1859:
+	.string	"time.h"
+.LASF1900:
+	.string	"parameter_group_ids.h"
+.LASF1847:
+	.string	"src/main/telemetry"
+.LASF1863:
+	.string	"gps.h"
+.LASF1840:
+	.string	"src/main/fc"
+.LASF1894:
+	.string	"common.h"
+.LASF1870:
+	.string	"maths.h"
+.LASF1874:
+	.string	"stdbool.h"
+.LASF1849:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1890:
+	.string	"locale_t.h"
+.LASF1875:
+	.string	"stdint.h"
+.LASF1898:
+	.string	"build_config.h"
+.LASF1887:
+	.string	"wchar.h"
+.LASF1884:
+	.string	"stubs-64.h"
+.LASF1905:
+	.string	"voltage_ids.h"
+.LASF1879:
+	.string	"wordsize.h"
+.LASF1889:
+	.string	"stddef.h"
+.LASF1899:
+	.string	"version.h"
+.LASF1910:
+	.string	"io_def_generated.h"
+.LASF1896:
+	.string	"common_post.h"
+.LASF1913:
+	.string	"adc.h"
+.LASF1897:
+	.string	"parameter_group.h"
+.LASF1904:
+	.string	"current_ids.h"
+.LASF1873:
+	.string	"stdc-predef.h"
+.LASF1902:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`1"
+	.string	"m\006"
+	.string	"\224\t%\001"
+	.string	"\023"
+	.string	"\310\232\376\376\001\002\002"
+	.string	"\002"
+	.string	"\001\371\322\332\251\n"
+	.string	"\002\240\342\234\212\n\003\236\301\244\300\r\004\370\212\217\275\017\016\002\001\002\002\003\004\002\004\013\262\236\303\237\005\002\002\003\002\005\r\233\355\211\352\007\006\002\017\265\366\276\373\016"
+	.string	"\002"
+	.string	"\021\372\235\305\207\007\030\004\002\007\002\b\002\t\t\002\t\022\352\263\360\321\b\023\024\025\376\234\264\330\005\006\002\n\002\n\n\002\n\026\027\255\303\374\237\007\f\002\013\002\013\004\030\031\350\300\306\254\005\002\032\373\237\213\204\033\370\236\355\277\007\006\t\002\t"
+	.string	"\025"
+	.string	"\024S\214\313h\020\006\251\013w\031\312 \236\347\021\246\232\247\204\205\314m\240\030C"
+	.ascii	"\3667Ch\b*\\\346LX!.\227b\327\374;\205+\300\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`E\0015\005"
+	.string	"\022\304\f\024\240)\035\377\377?V\r\364\267\3374\301\266K\344\275e\222\001$\257\362\t\021\341a\314\342\301n#\330\225];\221\265\377\007\344\235\257s\007H\2604\354\0222 `\202q\250\214\036\002b\342\340\275\bR\330-D\277\f`\245\275e\303\370\006\323 \245C\224E\262X\267\361\203J\006\223\001\340\001$\006\0327\320@\017\034\357am\261\377F\200l\030\373"
+	.string	"\213\210\310\300\341#\213<\006\227\016\301\374\207l\027\212'4\360\247\205,\202\366n\326F\343\304\034`\007\366\026S\215\350B\362\201k\2006-\263\246"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`\207\003\245\r"
+	.string	"\366\220=80\345(\035aa\314\262\244\217r+\202\364\033\353\276\316Q 0\232+\260\256\2667{>H\032\355K\025\341\240\002\006\f\021y\017\354"
+	.string	"\255\321\260kDbBJ\320\336I\246)"
+	.string	"-"
+	.string	"1"
+	.string	"\377\250\005A\230\377\005\315z_v\261\336W\357s[\016\272\366\370\377\263\026\344\020"
+	.string	"\250\225\3466Ef}\264T\233\266k\334\b!\227\374_h\327f\234\255\320D\006\371\357\320\214\005\204\375g\b\301\223\377\017\215\002.\215\225m\272Z\251\221\355\302\247VJ\204S\330r<\261\007\020f\322\177M9[\276\240\274J\003\037\257<N-\231\0328\363\003U\257\222\t\"fBuDh6\351}N\371\257`\225\377\r%\350\270\205\001\225\210\232)\333\305\t\216d\3504I\316\031\251\344\214\221\255\363\223q\326\310"
+	.string	"\226\237\324\321$\214\262\326\003c_"
+	.string	"\227\r\025C\262\322\025\201\302\366\004O\250q\27132c\303\260\220a7`\242Bsu\003\022@\025%\tI\203\0302\002'\260`\002\212\2338\313\2616{\204\340\304\362\013\247u\036]\202\314\375dR\351-f\246F\241Q\336\232\024#A\2454HF\331S\331\310\013\370r\300 un]u^\020\007\207\032\217\272\203\254\025\035\243\301\345\033C\244N\265\366~\035"
+	.ascii	".W(\021\223;n\240N\365)\261\337\265S\355\005\224\370\214\213"
+	.ascii	"]\352\241\301\304\300\214\205'\345\020\325\322X\371\221'\250"
+	.ascii	"U\344\206\023\006\355\032\362h\326\347\270\2354\254\177\271O"
+	.ascii	"\203\022\331D\214\241&+\306\340\273\227 \004n}\274\306\361\207"
+	.ascii	"\021\253\2628\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`\037\006m\f"
+	.string	"\262\315(+pK\222\016\251\252\321%F\320\260q\fUU\025~\037}\265\260\206\306T\365\220 9\034\267\376\367\t\266\246\266\271YB6\221I\006\304h@\031\373\001\271z\337\200, i\261\274\220Z\222\200\253\354\374\300\205E\005\353\027\212\021\233\251\221F+\260\2440\364Ky\017%\027'\023\326F\230f\211\004\365\325\343\3010$\302\005X\253\254\304\215\264\3266NSe\372wE\347\210\207\270OP\034\230\320\231\221F\347\330\225\364\225\324\331"
+	.string	"\351\271\222\251^\377\311\256\307\333\275\206_3Iv\3072\325B\276Tt\b\004f\250\241Q2!-'\205a\fp\"\2412\272\r\022"
+	.ascii	"\0029\210\2021\n\302 \201\344\020B\216PL\005\026H\214J\3278\216"
+	.ascii	"EEL\030281&|\313\244\016\201P\216k\tS\002a\234\202\315`|%\244"
+	.ascii	"\017\275Z\033\317\312\275\305\004\231\306\215\311,\b\302\215"
+	.ascii	"4\310\223\232Q\276D0.^3I\300CU+\355o\232\237\203\232$<ZR\330"
+	.ascii	"\311Z\221\252\205\022:\032\254}U^p\220\321\246\302\026\022\031"
+	.ascii	"\241\312\242k&\031\233Fu\030\200\020\241\262\300\201\307\t\343"
+	.ascii	"&H\224\332\355x\353\201\212z\357\2739\fL\232\035\320\013V\330"
+	.ascii	"\273\330\227\300\320\303\037)\357\007\265ej\207{T\346Cc\002\205"
+	.ascii	"=y\"?\245V\316\273/\00582\312UB\227t\275E)n\333\274\244Cq\215"
+	.ascii	"x\235#\f\202\r\357k|\241"
+	.text
+	.section	.gnu.lto_.pureconst.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\231\004\001\230\004\003\232\004\004\230\004\013\230\004\r\230"
+	.ascii	"\004\017\232\004\021\230\004\025\230\004\027\230\004\031\204"
+	.ascii	"\004\032\230\004\033\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375 \312\225\003"
+	.string	"2\004\017\033\260'\035\200,I2!Q\032\206a\030\246\250w\303\204\020!\023#\324\321\210\224)+Ok\3139M\220g\3451+\312\025W\371\"T9|*7\312"
+	.string	"\340\363\232\2138?\335\205\231\026"
+	.ascii	"$C\220\2323=\031\354v\264\026\232\3419\251\265\373\032l\020\274"
+	.ascii	"\325-0\256\346\204]\f\224\030=\303|\2063\252\230\317\220o\022"
+	.ascii	"\325Y\f\004\271\2016"
+	.text
+	.section	.gnu.lto_.lto.b55c614f25e16635,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crsfWriteCrc.67.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`\261\002\235\025"
+	.string	"\266\350\214J\320\322(\035\232\020T{\222Qg$>)\031\220j\224\357\372\223R\275\204\005G\222\004\236]\260\357\311?\245N\376\277\210f\246\005\004FJ[e\302\337\030$F*v\210V\\G%\263&&U\177\267-\034\002\322\310\336R&\031w"
+	.string	"v"
+	.string	"s"
+	.string	"L\316\354P\tOY&\304\363\356S\\\205\354C\033\276\252\325g\305\213ZI\223-\tO\227\374"
+	.string	"\3604\274"
+	.string	"\360te\273<N\002\325S\017\320\r\357G\255Ul\0202\236\344w\262\354t6\313\366\274\033\370P\332p\263\323y\252\341\b\215\340j3E\351gt\337\371\206\243\341Y\"\347}\337\017\350\350\260\341r\316'\225Z\353\262\r\327\341\013~wevW\302.\347\b7*/\355\2223\356\237\335\247"
+	.string	")\375\266}vW\252\223\277\310u\337\324\207\376\220\360\345\356K)\357\244\274Myy\362>"
+	.ascii	"\370\263A\300E\2558ML5\211\032\215x\371\353\376\335{\367,$q\337"
+	.ascii	"\333\373\026\305J*m8\202\"\204\247?\321y\213b\025)@\221}\027"
+	.ascii	"\013+\211S\331\023\002\002\fqW7\363j\303\001\300\r\221\210_\255"
+	.ascii	"d\311\351\256,kH\f\224yi\301V\241\361\322g\255\265\316U\277L"
+	.ascii	"p\260W}\233\0234\334\264&\252\376\356$(\346\356\336\305\360\302"
+	.ascii	"\267\251\232\244\326\263\245\335\3757\367\201\334\004\331\263"
+	.ascii	"\030ca\320~\006<}O\336M\207\306M\233\352\315\350.\217j\270^\221"
+	.ascii	"~\371\t;\367}\346x\252\214T_w\222\220CzW\303\213oK5\205\235\232"
+	.ascii	"\236-\367\216\036s\260C\343\245\345^\214#L\246[c\253[`\\\r\033"
+	.ascii	"Y`/\272((\f\032\270TX\200\340D\005{\265\364\266N\\^cK\214\215"
+	.ascii	"0\327\213+\203\013&\302\\`y\021[\343K<)\26012\256Q\204\305\304"
+	.ascii	"\214\"\212\254o\237\3359i\207+=\222hM\263#<\333e\201o\333\260"
+	.ascii	"'\357!=$\332?\213B\021\224k\301\"\r\366\355\276\207L\271\032"
+	.ascii	"\255\352\363\036\372\310\t\361\213N\373\226j\260\037\320\250"
+	.ascii	"a%\352\201'6 \200\002\231\262\343\001\376\247\350\321\226\336"
+	.ascii	"\256n|\021Qt\007\361\205v\332\225\300\2107\2348\301\307\020\267"
+	.ascii	"`\224\207B;J\342\227\0200\324\241,\255j\3071\321\033\320\375"
+	.ascii	"\342\022\"%\n\252\340\3370\356\366t\261\260\032\022qgl\351\273"
+	.ascii	"\006\255p\266\253\337\341\207-0\262H\3309\240\027j\304\303\373"
+	.ascii	"&\304\b\371\001\205A\341Q\255+@x`p\231 `\236\027\252\306{\023"
+	.ascii	"\351\\\346\t"
+	.text
+	.section	.gnu.lto_crsfFinalize.68.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"\345\013"
+	.string	"\366\025PB\020Q\225\016\360\030"
+	.string	"Q\321\201\021r$^#~\006\022\240X\274h \003~W\340x\221\305:\231\232@\006\301\001<\307F+"
+	.string	"@\241\247>\362a\306w\335\337D\367\234\343,\361\3376\315\222M\266L);"
+	.string	":"
+	.string	"?"
+	.string	"(\226\212\335\020\200K(\227\016\377\221]R\356\221]\372\263a<\374\260\023\016\".\250b\354\356\214\036\376]?\377%\276\001\232H\327\311\201\335\265\202&\rw\274\355\021\333\006\354\207\002\316X\210$\353J\306\213U\032vH\322\330\301>\266\273\353\210\262\237\372\261\250VU\2772\311\340\002\244\305.\206W\215m\311\025!l\337bc6\314\253\375\021'\361=5\372e7\227\005\034=\250qt\342P\315A\314Tx\261:\221\024\237lFE\037~%R\327n\351\240\211\253@$\256\335-p\342(6\037\304\245#tz\360\322\357\262K\275Yd\227X\264%L\320\203\001\336l\006\020\3600\020\020@\323\341u\r\242;\032O\307u\246\210\3634\220\366@\363&\204\017\0074;\\75!\336B\0327\275m\343\246%\334c\273\273\217(#0\265J\221\2021\372\250\321N\240\300r\n\027"
+	.ascii	"~\231\"3&<l\315\242\201!\204\315;5\206!\317pT\233\207i\027\300"
+	.ascii	"\321\n\001\254S\002\017\030\367\212\305\260h\0050\213\320\346"
+	.ascii	"\202\341\202\341\267\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_crsfFinalizeBuf.69.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`\312\002\275\025"
+	.string	"\346g\213J\320\322(\035\242\244\322\232m!\375f\375%\316\002-\234\364\261\260\031j\276f\366\3669\337\204\3229\377\370\261\267\266\2778\256\246M\326u\335\260{\364\303\241Lp\216\3240\023\031"
+	.string	"\276#\236\005^\265\337$\250 \260\331\275\245L2u"
+	.string	"s"
+	.string	"u"
+	.ascii	"\373\027\207a;\t\342\253Zu\204j\324J.XWx\272d\370\026wa\3335"
+	.ascii	"\232$\017\017\225\223!\343\363Qk\025[7p:\235g\235N\373\304\242"
+	.ascii	"\202\301`\360\223\374N\266\235\316f\333\336\367\311\302\346h"
+	.ascii	"\344\335N'jG\203\"\204\267\233&@\246\242\377\3163\274\034O\237"
+	.ascii	"\232\367\177OP\"8\362j\316"
+	.string	"\250\223Z\353\362\310\023\361=}w[v\267\302.\367\b\255]\337\226\313\021I\225\233v\311\033\367\316\356Mx\200L\333:\273\253\003\375!\357}U'\377\360\345\227\236x'\345m\346\345\311\373\002\250\0259Fn\324J\023\004Rq\320\242\024/\377\236\210N\334\007\355\177\233\022\331\225k\024\203\210Bx\372]\333\336\267)\326\017\361=\227\360\026\",u\f1\325Z]\247;!d\355\020\031\bf\351$<e%\211\347\r\003xz\3660H#\017\221\013(\374\261\033\345\035\322\334\217Q\221\343\340\322~\277\207L\020\034\007WU\372t\227G;^\257\353/\037\001\347\277\317\237\034.oT\375\336[8n\332\025cH\341\217\252n\301\321\331\330\220\035(z\241H\b\340\007\235\b\206\225j\305}\234\361\241\025\004J\265V\023\241\323\210\355{Nw\203\214?\236\356e\247S\376\032\365\356\354\003\177\334\261\030\303^b\026"
+	.ascii	"\300d)4\025\272%%\016\036\250dh\300\200\204@\215EC\357\213D\205"
+	.ascii	"\205\366\022]h5\230\f\306\001V\023;\304Rd\342\213\306\"\222\214"
+	.ascii	"\354\314\003\214&\326f3\232\230\"\353[G\325\020pp\235\333\373"
+	.ascii	"\036\240\374\241\275\263)`\257\272\227\330u\3323;[\302\222\216"
+	.ascii	"\201\263[\272\276!\345\320>\301q\323g\255\265\316U\277Tp\332"
+	.ascii	"\253~\214\t\261\274\351\336\037\275\254\004: `\002\031\302:\017"
+	.ascii	"\023b\371\231\022G+\234;\333RX\271\020\364\265\275p\201\2511"
+	.ascii	"\327b?\255n\225\200\005\361`\316\301\0300\373\316\235\214\370"
+	.ascii	"e\363\264\373\306i+^\\\260\243|\021\3741\312\024\343\343R\344"
+	.ascii	"\206\217\266\013\034=\002\255S\314\303\343^\\\fc\253\245]\264"
+	.ascii	"yG\024\262\360J\252\036b/t\377\243\215.\346F\226\227\305 \006"
+	.ascii	"B\341\227Ut\210'\211\006d}=\343n\252Y,\214\367&\322\271\336\023"
+	.text
+	.section	.gnu.lto_crsfFrameGps.70.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`|\003}\027"
+	.string	"F+\224G\260\030U:\300\241\277\245\310F\202\361\344\022\037\311\266\347\020\255\351\304\207\233\3776\374\f\215\347S\177\240\236\362\200\367\021\220\021\263\372\376\301\272\006\023]\370Q\001\332\211\220\353O\366\233=\310\216\353o@%\215l\"eJ\001~"
+	.string	"o"
+	.string	"\205"
+	.string	"(~\\&\023)T\343>\227d\202\214\357\375G\355@F\210\323\210\310c\202\005\2269{4\227\256\021/O*\3633^\355\363x\217\332}\2208jN\237\035F\346\354\265L#^\272\367"
+	.string	"\341\245x\231\360\3225\373\312{1\346\201N\350\200\262\3149\307\205\361\332\301\325\232/\252\331\331\331\016\222v*\276\246]\t\2205\347\274\357\312\263\303\251\212j\346\234\326\235]\212[\3366\003\333\016\354\225\0229\033\364;\227\376\206\360\362[`H\350\246?\223X(\2117R\324\215$\004\260\266\f\204~\307,\023k\263\006\255p2u\213\335\263\351\276\260\017\3169\247\327\307\016\325+U\253V=s\037?"
+	.ascii	"U\247V\215\n\325\247U\307H\265)T\303\254\372E\252KRMZ\365h\325"
+	.ascii	"\342\252E\253\016\245Z\202jp\325\013\252u\325g\221~\232\020("
+	.ascii	"2gUJ\250\026\353W!\314\256\224|I\004\t66\341%\314\272d\340x)"
+	.ascii	"\355\313^\327\345v\023\222\266\224d\302\213\264#\236\r\001:\263"
+	.ascii	"\024*\334w\032\027\277\337hg\326\252\343\221\304\035mh%\367#"
+	.ascii	"E+n\b\224\353\031\020\256h\237\273\201\323\237\345\206\373\013"
+	.ascii	"\375\310\215?\303\026^\257\360Rnk\210\327\003\356\202\255\027"
+	.ascii	"!\262-N\252\213\003\373\352\266t]n\372+\360!1q\316\271\300\027"
+	.ascii	"\362 \r\376\214K\0071\f!h94\0168\242\021 H\240 \303\205\003\006"
+	.ascii	"\\'\232\016\2065\314\225Ag\006\033E\314h\261\0161\0161\332\350"
+	.ascii	"!\007\247\303\b\233\351\214.\225e\037b\263\221&\223\315\306R"
+	.ascii	"o\036\234\353c\325C\371m\034\241\261\252M-\017\204\035Ln\213"
+	.ascii	"\363HQ{Z\324\224\b\rlN;\322\021\223\332\030\r\312\221\332\003"
+	.ascii	"9\353\246[@PD\345#B\323\252V\243\344zpOn\036\274L{\"C\274\233"
+	.ascii	"\376\256sN\333z\025\256\366\276\217n\370\002J\250a@\311\224\""
+	.ascii	"RB\223\024\244\240\2409\006\300\002\021!\263\016\021`Me\251\244"
+	.ascii	"R\254\006>%!\212\330G\037\3422\250c\210\n8\201\263\340y\370\022"
+	.ascii	"i\225\216\030\270\321i\222/\237}\305\035\f\275_K\020\233BZ\f"
+	.ascii	"ul\026\275r\240&\344X\257O\356\360w%\024\220U\0163\357&1j\332"
+	.ascii	"p\374\263\356\032-\2375\020L\262bD\243.\271\337\377\246\342\007"
+	.ascii	"\225\260\236fO\214\33105(\240\003@<Ah\232\233.\232\300:\016]"
+	.ascii	"o\217\021\366A\353@p\300\360&R*"
+	.text
+	.section	.gnu.lto_crsfFrameBatterySensor.71.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`\231\002\375\023"
+	.string	"Fe\200H\340\320(\035\373\217\016:Pn\341D\354\211\314d\342\352\263\322&\356\311\270\330\017\252\n\363\233E\340\220o\374\365\"\232\315NF5\346\346s<8\351'\202\021\307o\004\017\364\246\214\250~\177\345c\211\376'\215l\"eJ\001h"
+	.string	"c"
+	.string	"j"
+	.ascii	"1\034>\036\231\236\224\3572\244\003m\241m# \211}\274\360\315"
+	.ascii	"\022\243\035\241\0307\346\034S\22761\250!\274\332_q\026\261\347"
+	.ascii	"`\270\2009m=>s\216\"N}\227\036?\300\273\374\016z\227\216\331"
+	.ascii	"6>\216\230\307\335\320pDs\316pE<v\215\371\307\235T\243\211\271"
+	.ascii	"\216L\346\234\326\032M\207{o\333\200\355\n\366:_\tGIK\267\f\317"
+	.ascii	"c\355\226\226\276\346\020\231\215\261\356\f\321\230\232\303\036"
+	.ascii	"g\272!\354ws\316\351\265\331\037o\324o\367I\252\301\347\374\036"
+	.ascii	"R]\222j\322H\375I\365\310S{\235ZJu'\325+\325\332\251\017b\302"
+	.ascii	"\231\221\322\231sCN\307\f\222@7\037\377\333[\034g\023\350\341"
+	.ascii	".\376\"\366\033\354\013\366\t\003}\r\265\377\261\231\361\200"
+	.ascii	"8\355o\017\221i\016\313=\255\n\321\212\354\006\007z\360\315\231"
+	.ascii	"\241\304\367\371O\004\237\304\245%\240H\037\305\273\224[R#\307"
+	.ascii	"\364\001<\356)\233\315\345\272\005\327J\253\271\316w\273\225"
+	.ascii	"C383\315\031T;e\202\276\266\246\232\017\325U\255\276\272\"\264"
+	.ascii	"\"\231\346\f@m\026\226\276\366=\215\315\214(\260\027k\245zQ-"
+	.ascii	"\b \262\250^.\342\312%:`qa\211\020`.\361\365R\251\0200\tI\211"
+	.ascii	"\202\025\225\004\007F>^0\024\326\253\221\025\030\327*\204\271"
+	.ascii	"^b\213hA|\205.,UK\270r\301\204#\005\334z\021]\341\253\325r\205"
+	.ascii	"\246Q\366n\256\315'*\202d;Cmi\237\202\364-I\356\267:D+\222\241"
+	.ascii	"\030\255\267\243\303\370i\275\355v\314\024\315N\244n\002\265"
+	.ascii	"\037A45 \220\002\221\301\242\007n*xY\346\377\0241\361\b\246h"
+	.ascii	" \226W!\262f\200VQ3+\023\241A\247\273\0137\211\214i\217\3602"
+	.ascii	"$J\311x\2702\312\260&\016\333M\020\347\251E\023\261\263A\031"
+	.ascii	"\246\304\250\236m\313RU\002\026LG\264!y\343I\355\320\242v}\031"
+	.ascii	"\213\355\327(\b\331\005'NX\367A\177\314\344\331\306\033\027\025"
+	.ascii	"\365M/'\212nWrV\001\224\274\270:\031"
+	.text
+	.section	.gnu.lto_crsfFrameAttitude.72.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`o\002-\020"
+	.string	"6\237jD\360r\225\016\202^?\343{y\374\366\225x$\205\366\254\375\351\031\205\206\177\264\340\363k\3479\222\027\272Q\361\265H\t\017\241\263\324P\360\312\303\342\262\223\304\3260\360\357\273\205K$\213\312\242\255\244\221M\244L)S"
+	.string	"L"
+	.string	"Y"
+	.ascii	"\267]\0207\";\023m(l\277c\203A\302\247}\025_\321\372l\303E\273"
+	.ascii	"\262\027\230]\332\001\033\360\036M{\200\356\321;\200\356\321"
+	.ascii	"-\333\307i-\373\332\210\025\027!\273\033j\211\267\236-\377,\276"
+	.ascii	"\211\261\270\236\032\006\273\353\214\261\204\270\365\266Il\233"
+	.ascii	"\330\372\335\210\332\031V\371\230\013tP\227\365\203\f\035\233"
+	.ascii	"Cl\232+\225\204}nw\327*\263?\373Gb\032\344\322\242L\2074\r\322"
+	.ascii	"\364\227\351OL{\270t'\323\034Mo4\355eZ\023\323\035\227\216\231"
+	.ascii	"\3464\255\232\316L_\300g#\307\2024\300\354\024B\204\250\235\226"
+	.ascii	"8\215\372\225\"\252\234r20\0341\356\001F\304\2569\034v_$\251"
+	.ascii	"\252\207\245P\311\233\257\251# \260\037\366\311_L\257\265\330"
+	.ascii	"\247\327(\230\360\330\335\022\227\267H\361O<\272\002*\037{\364"
+	.ascii	"Q\335\343\3655\023\263W\336\374\305\020\370l^z\267L.\225J\024"
+	.ascii	"\240HH\200\200\024b\255&\250M$\224\225\312\024jP\261N\250\223"
+	.ascii	"\205\023+\274\220r\202\nM\252UH\032\340\024\206\223*d\245R\252"
+	.ascii	"\260C\333s\25327\2701\363R\025\203\t\212\024\f\251\b\244\241"
+	.ascii	"OA\037\375t\264\303\301cf\330>5<\035\365p\264\263Q\216\247\033"
+	.ascii	"\215z:\352\361\3400^\270\320\004* \020\203\231)9\006~M\021\026"
+	.ascii	"\257`Fc0#\207\270\204s\235\007\275\016'\216#\031(\334\013\rd"
+	.ascii	" \206;\274\342\035\334\341`\"JA\021\336\"!\nxEE\273c\264\202"
+	.ascii	"\273\237\321\266{\004\266\362\276tf\221\271\002$q\202\336\217"
+	.ascii	"\355a\276\1774\300\345E\313\310"
+	.text
+	.section	.gnu.lto_crsfFrameFlightMode.73.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`\001\004%\032"
+	.string	"\226\356\243I\300\226M:\024\230RP\016\200\242\313v|\201\275\224PcBB\027\310OT1\223\223\264`\006\314\240\336\325/\336\027ha[XF\313\213\307@\374\320\2670\266\241/"
+	.string	"03\275\177H\342<+\201\302\236\326\b\331D\312\224\002\213"
+	.string	"\207"
+	.string	"\220"
+	.ascii	"9\"A,\264.i\252d\366\210\342\023\347\344\322\3110\202e\316\361"
+	.ascii	"\346\3229\246)\"\273\332\367\361\037I\007\222\3423sF\375\222"
+	.ascii	"\3149*\360M\353\322\343\007\204\227\255\013\b/\235d[\3718c\236"
+	.ascii	"\210\217\334\020\2549\247le<\351-1\224\340j\222/\346\270t;\245"
+	.ascii	"\267lb<\361.Z9\361^\273\234\2068\251\302\006\207\023O\301\026"
+	.ascii	"_\330\216\t\254\231s\336wm\332\335T\305\2349\247U\267{\272]\267"
+	.ascii	"\315\3026\315^-\001\037"
+	.string	"\364\272/\003\250\333\324\213\027\371A0cN\334u@-\234O\354\362\343{\240bx6\367\2220\346)\200\336\\\210H\257s\215\212\251\335k/\365\232%\345b\030u\255mD\323\353^k\002\212i\225\254H\262\254\246r\261G%\335\236}pn\224-\3253R-#\325\260K\335\257\003\371]\342\307;\024\3252T\203\253^\251VP\375\0011J\236@\2702\347\212\254.\263JR\331\370\370K]\310}~\321,\221B\nruH\356\313kw\301]/8\0357\315\332\365\201b\242*\240\342^\330\t\"\266\230\200\350\341q\316)\316\350\f\017\253\371p{T\227\371r\031\330\212\034r{\226\277\225WQ\244\013\025\257\240\354\b\267\311\261\020\266\367\275e\325\232\217\205\272\260\265\346x7\315\262?\365$\031\374\032\356\361\221\276Ox\251{\200\006oI\263|\337a\246n\204\233\263\004n\357\310\006\002\034Z\270\016\034"
+	.ascii	"L\301\3209\247\322n\317?\021~C\370\2460\351\026\323\250\355!"
+	.ascii	"\216\240\243\241G\272g\202\rh\236\035\n\240y*\350\200\336\341"
+	.ascii	"\221\240#k6\fC6!\022\263\"\327L\004\355\202mH\210\250(\b\306"
+	.ascii	"\r\0328x\020\024\202\301\002\034\031\333\221\2105\020N\320Q\r"
+	.ascii	"H\206T\263\315\214fE3\233\214\004\321\217\221\f\250v$\3031`Z"
+	.ascii	"\211YMf\243\321j\262\3278\017\316\215J\360\023\345\225\025,\203"
+	.ascii	"a\270\362'\375\252\037yU\005kD\354R\376@\337\311\006yE\005k\026"
+	.ascii	"\273\024\267igI\325\322\336,\327o2TA\245\324\360\221\302\313"
+	.ascii	"\353\262\200\033S\25014h\031BC#\221\0042\n\233t\220\002\231\251"
+	.ascii	"\262\016\0210A\253\214\264\305\314\001\276/\356\356|\245\223"
+	.ascii	"`O\320\267\340\227h\243\266s$\3709;\357\333\307\215\262\031\222"
+	.ascii	"A dTN\325\352\0313\245\225\020\201:\303\227\244\321\303\302\224"
+	.ascii	";\002\220\236\337\032lW\033V\252 \3201sxc\341\254\313\252\277"
+	.ascii	"Ls\222A\352\fv\244\320\365\254\253\215G\350\006(w\241\222\263"
+	.ascii	"\267\t \030n\004K\262I\365\272&y \020P\376\332\207\336\037\246"
+	.ascii	"z\003\205\023\031\344n\002P\024\244$\373\023\246\033\267\225"
+	.ascii	"\274QA\205g\234\220\255dc\251\244t\343^\025"
+	.text
+	.section	.gnu.lto_processCrsf.76.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`\262\007\245!"
+	.string	"V7\305I\200\332Q:\267\201\342\367\030\244E\3463\034u\236.\005\367\266\203y\025\324\226\251\330C\272-\013\300\317\246\253\246\013K\236\251F\343\033t\2750\331\251K\b\265]\337\307\325\002e\274\313\007\267\354\326\0065\266\346\023B\b\3312\311\253"
+	.string	"\243"
+	.string	"\265"
+	.string	"O\206\230iG\355\251nu$\323n9\034\360"
+	.ascii	"\177E\264^\"j2LY\223\303z\364\326t\274\023\340\253^\374\"%\315"
+	.ascii	"\236\310\220\321\2747\351\302z\364\027\347V$w\2517\001~\252\350"
+	.ascii	"\274F\234{\244E$r\357Q\347(\353\254G\371x\\zt}\200\364(\003\231"
+	.ascii	"\311\374\370tU\247\261!R\354\336\233\263N\007~US\364\264\r\344"
+	.ascii	"\037\371\031Q\311\350+\202\037K\306\253\357J2\016;\275q\024\t"
+	.ascii	"F\237\305\333SAs\nXM\351\350\304\325\020B<\362=CI\330\255^\270"
+	.ascii	"\367r\023\225\226\316\2633s\0223\227`V\243\002+\322\2435\213"
+	.ascii	"\023\303\274m\373!\031\237y*<~\020\026\352\365\211\275\364\350"
+	.ascii	"-\0041\306`\227\261\215\254\267\332t\335f\303|\024\266mb\376"
+	.ascii	"y-\023s\332\214K\233oi\263\355W\347Z\332<S\233W\265YM\233S\265"
+	.ascii	"\031U\233\317\264\331\252\315\2356?\301\r\214\213\2052\367\326"
+	.ascii	"(\033\273\\(s\310\253\376\253\243m\231\277\334\262E,1e\024[T"
+	.ascii	"F\r\235\306\232O2\323x\350X|-[\334\242\035\315:\336%\nT\\Rb9"
+	.ascii	"a\271\367\263\206>U4\340x\227n\004\307QJ\354\336#\203\243\374"
+	.ascii	"=\0044\363\007\020G\326\210o;\272\244\374\310\237\006S\007WN"
+	.ascii	"\353\\\207\351\211\207\324\275w)bD\237\310\007`X#n,&`z9^_2\277"
+	.ascii	"\313\277\360\f\034\365\302YH`)\341\322\345<\335\033<\221\257"
+	.ascii	"\345[L\364\350tK\336\335\252w\363t\357\215\360/\342\215\345\001"
+	.ascii	"`A}\353k\232#W\r\032\024\t2J\312\017\3340u\374iMsi\271@j\263"
+	.ascii	"G~\355\262\032s\324k\370'Jk\326f\271\207"
+	.string	"Fa\227q3qt\335[\025\341\274\210\237z\205[\221i\243f\177\365\020>\202\315\306\305\257\360 x\335{'\360\253\334\n\n~\220\243\254bE; !\237]\n\335\207\037\213\235\317'\244\263\375\ba\360\351\351\001\021\365t\2501\017O\004\t?'\0364\330\301\371\005\371X\326\355\374\004\371t9\"\337o\307\333\001\355~9\026*zx9\235/(\267C\200{-v\276\334\257\327\363\345h\307\340\317k\231<\204q\005\255\220_\234\367\376\260\320\254\3522\236\331\342\211gV;\263\335fH\246Z\324\256\366H\314\324\252K\031\322\005?-j\217\304\303\332\263\223\254\335\001b\f~\255T4,\263\250\2221\222=l\244d\262\205\035L&\265\262\250\324\333yk\222.\331\220\004\n\2242L\t\366u\306\314\225\312(P\240P\333\204\345\270\306\03599\3340\003\200\225\250aP\346\020233\022D\223\222$\035"
+	.ascii	"\003\021!b\035\022\240T-\b\202\bB\202F\002\t\023\226\250P\273"
+	.ascii	"\030t\020\371\320?\347\216\220\246\373\312y\206I\310X\261\301"
+	.ascii	"5\213`ek\335e\251\024D\322\242\340'j\271\252\036\255\357Yl\377"
+	.ascii	"m\b\325)\321 t\3116\206|\211\274\307\373\342\0357^\366h}\317"
+	.ascii	"b\373gC\251\213\274\200\270&\374\355\270\276DD\274\316&\322\377"
+	.ascii	"\026y7\336q\313\221\337<\356\326\204\330*\305\233\340\024f\310"
+	.ascii	"\365\201\305\325|\026?\373\214\230\363{\372\024\351b\321\r\301"
+	.ascii	"\036\037\321\375H\023DQS`\031\254s\275}\213\006\203\016=\277"
+	.ascii	"M\201\003M\367\260\275,\200q*\036\244\335)2\360 \371\366Aw\320"
+	.ascii	"\277\303\204\266\340\235\247\030\312\203\365\247M?\030\321\360"
+	.ascii	"\247\262\202,\345I\037\217dR\276\217\365\002\334\016\266\215"
+	.ascii	"\246\233,\020\231z\351\023\230\213xR\005\330\207\303\261\312"
+	.ascii	"\230\223\252\232\305\227\310\360\027Y4\002\232\216\244H\002Y"
+	.ascii	"G\370\246\f\231\032"
+	.text
+	.section	.gnu.lto_initCrsfTelemetry.77.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`7\002e\021"
+	.string	"f\237nG\320TQ:\345Z\244\211\f\371\027\016=\2760\021\367\355p '\267\030\254\007\255\207\240\261\300$*\327k\264z*clW+\257\003\221V\330\341\005\327z \212x\030\\\025m\005\334\365 \035\355\r\335M\223M\244L)Y"
+	.string	"S"
+	.string	"]"
+	.string	"D\016\356\342:\261\327|#\311>\220~V"
+	.string	"\t\331\335\322\243K\244\307\223#\350\036\271\033\350\036\035\263\203\234G\305>\206\216\214\017\321\356z\232\342\261s\2321\237$\005 \244\311\316\205\270\016\240\305p'\273\373\235\347\f\r&\223$\265\273\316\220\006\342\216\267=\301\266\004;O\004\263,r\332D\\\375\027\357y\361q\314\341\025\375W\367\250\267ph\226G\216i\267\270\344\303\253\213\r\214\312\2346\032\037\233E6\217,\025\205}nw\327zc\277vs\231\326\247\363\351\233\234&\247\007\005\"\273\036\216\214lP\274\301\342\265\337\376w\\R \265;5\343H\247\347"
+	.string	"\023\340`\300\265\b\260\231\310\335\225\251_\272T\225\236\0371Y\304&\371\375\252\263?\f\3710\025e\023S\202;\330\001\335F\r\323I\244\3513d\344}\353j\016v\266Q\016\003< \264\273\021|\237\377d\360q\036\315j\265\272\307\005BCPT#J\177\355(\233NIy"
+	.string	"aE\005\325\340D\240\303w\201\005\214^\235V^\256\225\347\342\202}\254O\303\007\363X@\013,o\345zy'\005nm\370\\\036\254\325ry%<{n\365\306\007Rc\244\277\375:5<\322tNghr\202f\ncU_\307w\200\025T\252\3561\217\204C\252\2524d\214\276\363"
+	.ascii	"\266\026\3720 \240\002\021!,\017\020\035\b\375\241/K0\260\\M"
+	.ascii	"\255mcd\374\330;\232U4\302\fT\276\251\306\306\317B\312\003f\277"
+	.ascii	"\247\260\260\riA\321\256t\346\024l\367\b!_\204\301\270\301\037"
+	.ascii	"\031\343\212\307h\034\001\017JJ\217!\230\257\332\303%\247)\330"
+	.ascii	"e\031H\301\272)]\210\032\367P\322\316\006x\033\220\332\002\316"
+	.ascii	"\244\003\226Un\273\214\036"
+	.text
+	.section	.gnu.lto_checkCrsfTelemetryState.78.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375 \356\245\006"
+	.string	"\202\214.4Pm\222\016\2602\314 ,M\"\322w\353(p<\315\200\326\326\356[7\354\337\355\325\\\323u\207\021k\205\2502*\"V\336\001\036VE+\025\247Y\262e\nS\226\006\314E\275\314\205U\227\352\241\302\036\204\003\303\345Q\027\346Y\b\266\"\252\353a\226u\275i\313\272\020\272\202\216\223\370v\324#\273\031g4X\255\322\325"
+	.string	"TB' \242\350\340\350\251\"\021\3457\016:\213o%]\350\307\321\r\204\224,\230dzF)I\"\211h\374\233\237FH\330\234u\303\360T42\361q\222\271=w\321\254\230\335r\264\262\0012\322>\234b\200Bf\216\332\007\324]\177\203\377\340\007\005\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_handleCrsfTelemetry.79.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`\007\001U\r"
+	.string	"\306Y]D\020\221\223\016p\222Cq\261PA6\340\2518\200@\2401"
+	.string	"\305\342k\027]\262\204\260\003\362\301h\333\220\277}\320f\331\177\207\232\336U"
+	.string	"N\241\002\2018\3764G\006P:\2317:\217Q{k\311\336R\246\024H"
+	.string	"F"
+	.string	"I"
+	.ascii	"\217\336\354\033\367F\354W\330xQ\241cw1\025\361\355\021jn\276"
+	.ascii	"\247K=v6\034\002\350\\ hw?]K*,\300\362\260\343"
+	.string	"\323\255 \350E\315\313[O\013\235K&\307dw\235\\\227\341\276n\373\3046\003\373\017\002\336*\025\306\276~\337\367YY\366c~N\2465\323\377\030\351\020\243A\216\335\013_\217\255\211.J\330\276}o\263?\266\200\231\005\317\267|\023?\261=\246\202?vC\260h\261\353\035\260\201\316#\350\003\256Gx\221+Pad\256\236\264I\245<\247J\362aD\003'm\323J\2363h\245)'\315\315m@|3j\226\353\212\"S\243%m\354\243x\n\026\237\204)\240\362\334\243\217\272\036\257 48\250\362\263\b\216\267\356\241\201!c\223\207\035.)I\240 \005\205\004A(\200\311AF\032\235\234T2M[\021\205X\024J1i\"\f\245\2352R&!;a*#\b$L\244\231\260\020\001\227&d\032v*\2254\354\343\251\256,\233\250t\005wwcHr\324\2160\312s\206\232\272o0|3\002\024"
+	.ascii	"\230s\240\314\200u\016\301\352\b\264\302\rY\037\0238\214\001"
+	.ascii	"\n\364s\002S\361\rPp\212\020\325C\224\340\352\3512f\334\345\257"
+	.ascii	"\332\253\ns\257-P"
+	.text
+	.section	.gnu.lto_getCrsfFrame.80.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`l\004\r\034"
+	.string	"\006\361\255I\220\232Q:\200\r#\003\203\270\022\266\215\260\337/\\E\007\003\211K\343\031\201`\235g\331\276\022q4\320\351\232YC\370#~\237\333\373\2647\211\252_\032\301\004\036r\242\350>\212fQ\214:\265P\310\355x\322\310&{'\031\224"
+	.string	"\226"
+	.string	"\225"
+	.string	"h\207\362wV\304\306\3744T\366\220\312\2501M\270\272\233\347\2273\224\263#[\255wz\301\260n\037b.\224\2779E\333+\363\231\274\t\357(\321g\335@\200V\335(\003\346)\177\031-\231\231\017|\220\307|5\242K\2777\341\220\001\325\325\335\265\235\023 \177\307\017 \177\255\220\363N\336\321V\036_\302\225\250\363\327;\031\302\311\0051f\374\360\343\021+X\347\317\306-\f#\222"
+	.ascii	"\323U\023\316\257\310\326\227\205\356\346z\376\222\316\2573\363"
+	.ascii	"\0173\247`\036i\004\247\240\344\253l\230\246\244\246I\270te\303"
+	.ascii	"\214\026U\033\204\371\266X,\256a\013\204\371Og\330\321\377u\247"
+	.ascii	"\337\002(\220\264\345CUw\215b\233\326\272R\212\374\351\227\342"
+	.ascii	"O\235\310\034c\335\243\360\255.\025\225\356\216\375VQ\355,\024"
+	.ascii	"\315\350Q\252\n\032\354\322Qc\033\353\253t\247\332\031@;\351"
+	.ascii	"Gr\240\301\256_F\361)\035s\354\367\314<>\324\243>\344\330\354"
+	.ascii	"\306\223C\341]J(\352H\007W7R\210\362\367\2353\373ac\026\356\336"
+	.ascii	"1\220`2\232vpu\007\377\362\277 \177\233\214\264R+8\027f.Sv\367"
+	.ascii	"\316\203\313p=\373\250\207\221\356V\360k\355\216Q}\303\264\340"
+	.ascii	"?<N\n\324\nPy\276`\b\031\036\301\356&\372\230\365'\357\300\260"
+	.ascii	"=\256B`\026\"\235\255\023\231\237u,'\022lu\267\204\337+\234\365"
+	.ascii	"S\205K\250\340t\226\272}?\371\351\261R\360\207\3742\020\256\376"
+	.ascii	"\304\221\277'r\213\017\211dK\335\r\341iN\033\276Z\344\023\217"
+	.ascii	"#Lr\253\227h\220\364\2323\027j\252\253\352;>\340\207;\332\322"
+	.ascii	"yaA:\023\366&t\001\203\354&TB7\232.~4\230,\2066\300\370\301\003"
+	.ascii	"\b\021n%\0344\350\3111\201H\344n\227}zn\272\234Om(\027d\002\231"
+	.ascii	"*\314\240\332\212\037\022@5\237\234\256\326s\200q,\314\\-\b\207"
+	.ascii	"\313\325b\250\357c3\303\354\004%\237-b\241\261\333G\205K\375"
+	.ascii	"\\NX?\230\375\323\021\244\305\002\365e5p\250?av\247\224\026\307"
+	.ascii	"\356n\322\214\007-`^S,7\353C\225.\257)\326(K\257\004Tf\021#\214"
+	.ascii	"l\217e\351\224o9\215\211V\257\2729\323\025Sj\303\360\267*\021"
+	.ascii	"/\034\\\250a8E\240R\b\225\b\005I\n\232\214\001\220\002\231\261"
+	.ascii	"*\017\021pMT\025\024&),cFB;\240\206\247$\033\242\2514@\227\003"
+	.ascii	"\373\222\363\"\016\313J-\016Sh\251\006\301\355\357\362V]EZ\202"
+	.ascii	"Y\252X%\223\"\fy9h\342\264\2427\313\311\352\331n\353\003\241"
+	.ascii	"IN\325C\247\233g\024\354*1 \220\256\363!\321'6P\323\031\034="
+	.ascii	"\320\362b\351\026\217\312\212\350\024w\213-\362\255\035\245O"
+	.ascii	"\024!<\002\341qdA\363\373\276\314}m\262*$\326\037bj\250\206\361"
+	.ascii	"\232\326\036zs\347\033\300\264\347\350Y\201,)\277\342\224\017"
+	.ascii	"\"T\207\245.+\356I&A\305\225\f3\177$:w1\226\350v\363\007"
+	.text
+	.section	.gnu.lto_handleCrsfTelemetry.part.0.113.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`\257\002\375\024"
+	.string	"f\245\204I\300\322Q:#`!\206F:4\374\350\350J\f\025]\251\254g\350\022\374\026BF\241\304\376\037[\226\324\232\315v\333\363\207n\327F\201\254\021\226\3316\\\024\210\242\342t!\007\242\243/1\300E\226\f\261O\374O\366\3362\245j"
+	.string	"n"
+	.string	"o"
+	.string	"\274\034\001E\021v\337\363c\\\006\356A1\026\251u\347(\251\326\036\203S\277X\247&w\205\247\363\004\302S\3730l\313\344\030g\363x\257\247>\350t\363\213\252\265\212\247\322\304q\237r)\316\037\341\315|\356\216\327\341r.x\252\021$"
+	.ascii	"\217f\272pR\354\356\373j\340\351v\007\234\256Pj\255"
+	.string	"fy\270\303\333N\261\335b\257\217\341jM\303\365\244k\371\336\277t}\022\227\002\034\265\342T\r\251:TI\005\222af\005\326\320\324\227m\303\314^\017/\203\357\017\375\350v!\277\350F\255\232\337O\255\265\025\004\242\b\002\201\260\260N\364\213\231\025X\247\317\f\035@Q\265\366^\247.\022D\267\377\016\204d\363\023\225\302:\365\207n\367}2v\313\367\341\354\226e\036\0243{5!\007\235\373F\270\222\267yAe(\177C\245t\033c\213L\026\236Ry\246\023\277\357#9X\350\by\222r\312\002P7T9\271R\312\003P6+t[\345\037\235V\355\030]\304I\304\206\036?\352N\371\362\301\225'\272In\247\354\323xR\005\337\3073\332~G\013O/\357\373\253\346\347\002Dn\253V\362X\322\317*K\330\341z\025\256\003+7\005\3308\223\331D\027\332lF\213\031P\271ON\036@`Yq\320"
+	.ascii	"V\3622a\234\311$\330\\\306Z\rC\f\200c0\226\227ZL\274\325l\343"
+	.ascii	"l\2640\332D\027\231\312L\214\325^D\030\002\323.\2145\321F\243"
+	.ascii	"\325\304\226\355=JN\352f\311\332*\261\375\316&:9c\222\245\020"
+	.ascii	"Mu)\301\216\021$K\037\232\352\337#\365\224$%\217Wr\312m!\304"
+	.ascii	"D\263R\016e= \200\002\231\232\354\001\301\314\347t\200\206\215"
+	.ascii	"\n\3131\220It%<\236\326\260\365n\345Af\332\256v&\033\343\330"
+	.ascii	"M\034\322\200\007\310;\324@%\203\214\r\310r\221\327\236\341\025"
+	.ascii	"\200\tP?\270O\001H\336\2140b\374vQ\b\342\332(\033r\36186j\300"
+	.ascii	"G\002\304\032F\253\260\217;ct\301^\2319\204\201a\220\213\211"
+	.ascii	"%o\331\275\r!Q\260&GtU\272\004S\2179-\030\223\227\232\r\321^"
+	.ascii	"_h\232\214{\327\033\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`x\005\335\023"
+	.string	"&\037nF\360\262&\035T\221c\031\021\001\201\031\021\022\357\204\211\230\241d:\252s\030\340k\355D\266\025X\261\2215d\f\236\201g\340\031x\376\022"
+	.string	""
+	.string	"$\"br\375\377\367\377\315\246\rW\030\320\311$M\017&\221F\022\221)]"
+	.string	"^"
+	.string	"T"
+	.string	"1\353 \027\214G\274\230D\310\305:B-\353\022,\256\261\262\026\241b\031\002\326!\256\024\307@Y\353\\'n\2212\013\224\177N\3661\361\212\224\311)B\266\257On\360\326 J\353\017\327m\235rs\207\020&\245\224\001\326\240\374>\231c\257\275S\24337A@"
+	.ascii	"\254=\\\266\263\013\001\031L|\235'_\265\276aa\215\203fm\243\302"
+	.ascii	":\244\260\2461a\r$a\355\"\302\372\005\2045\214\007k\025\016\326"
+	.ascii	"=\r\326?f\326;"
+	.string	"\030\254y,X\367P\260\236\221`\355C\245\2246\n\301\032\205\n9\260\346\271\336j\265Z\006\326'\256\002\353\035\002\3460`m\342\222q\016\371}3'+\356\252\023w.j\243\353T\215NZq[\004E\241J\274\266\312\300\225\370l\246D\226x\235*S<\211\310\334V1\005\273\226M\354:U&\354\361\327@\224_\301\324O~\032\377\331D\3515<\351\025L\351u\236\350i\024\223\372-4\371\332J\257\363\203!\346l\024\223R\312{\3378\3571z\027\261Tqzp|F\336\265i\362\236\261\324CjZ\341H\351\331\214)i\220\206\226\216L\351\242\227\022\230\222\213l\272\221\243\276\023\213\353\356\205$@$6\261\273\b\270\261\264\373\366\215\272\307\225\352M\020\020\036Sw\022H\232-\3343\027\356\032jo\250A\030\n\242M\nRPi9\360\002\251!N\007\021` \315)\212\"\n%\020\021\351\001"
+	.string	"\342\263BHtC\273\355\357"
+	.ascii	"A\263\370\256\304HmIy\233S\317'>\323`\347K\302^\006\002\006\276"
+	.ascii	"bL|!\371\177\201\272\313\232\020b\310U\307\210\305\324t \274"
+	.ascii	"!%-Tc4\306\306\n\252\220B\254\303\027\251\372\347=\001\002\261"
+	.ascii	"\207\025Z,\023\201%<\303\240<\303\022\016\313\222\362\317(\277"
+	.ascii	"E\346\261C\273\032\001\304e\375\017\004\020WDfb\"\261\025\244"
+	.ascii	"P\316#\246\313G\366\325\321\335\030\022v:[\330.H\344\302\"c\313"
+	.ascii	"bq\202\331~\327\216Y\035\344\txR\316;\335\002\253\002"
+	.text
+	.section	.gnu.lto_.refs.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375 \277-\004"
+	.string	"rK\037\"\220\247\031\016\260|wwwww\267\323\317\364\177\335JF\232\335v\357nK\266\331\266\326zI\333R\246\257\332\223\366\351\250y\301\333\354p\307q\327\370j\\i<i\0345T\244\227\307\225{\276\023\350\023\030\037\301\275\001\373\202v\202v\201\366\200\366\326\316\264\037\355\021\233Qf\210\027\376\326\257\365i}@/\206\025>\240\036\240\360O\362\017\371\225^\035\237\216\r\004u\243\275-\373\037\004\001"
+	.ascii	"J\224%"
+	.text
+	.section	.gnu.lto_.decls.b55c614f25e16635,"e",@progbits
+	.string	"(\265/\375`\237%\235\253"
+	.string	"\312\017\321<W \nIK\035T*\213`\017G\304\255\235\005\274\3117i\030\344gN-\023\361\312e\004\220\350F\334\230\367]\317V\371\356,4l\313.Yk\366F\366s\274\034\357\342\n\324\225\343:gi\231\005P\027\342[L\027i\331\242M\266\227\037\372\305\243Ed\244m)S\nK\003\260\003\331\003\373-\004\377\357\357-\004=Ci\317Mz\303\343\004\203x_\201)\nR\245j\t\n(8\271];P\001\303#\233{\273\267\216uP\245\f\217\007\017\310\324\355\356\251o}\322\240+\b^\333_\371&\017't\276;\252\301\031\017\222g\343\320\306\223\302"
+	.string	"\306\234\334\270\336\312\367\375\337c\371*\257\345\257\237\345\267\274\337\277\177\345\363\374\365~\317\331w\357\242\275\267wH{\2520\357-\3456\265\200C\207\277\362jO\0256\337\255\224\001\023'7\377/w\236\277\362q/e\002\024{Ou\331T]q\362q\335\373\325\220\243A\203\006\240X\033T\213\034\366\245\217\023\274\301m\3321\021\355\270\207v\034\245\035\237\3209\217\023\244\373\272\031\253\023]Y\036\335\333G\371\244*U'\220\351\177\362r\377>\024g\251\322w&;]4A\313\020\034f\b\372\237\240\377\355\235\374K|\253?\223ws\240\363\335/\316\241\205,\f\263\376W\332\237\030\314\177\177O\f\372Gi\232\307\tb\353+i\307{\234\340\263\341_{%\376l\237D\246\350\331\330\275\235\377\024\b\377)"
+	.string	"\256]9\303\202\254?\n\355\256\366\353\343\004\275\002\332\037\240i\374\317.\f_\027I4\214\020u\021\022\263\257\"f!\244Hq\207Y\177\263/\303\322\035\200\230,\027kw\230}\261\037\362\257\257=\021\377\261'\363\227\242wW\377\206\222\346\r\314bx\234 \273\201.\341\362\276\026\344\300\343_\265\tF\237\336=\fr%\231\321\207Y\257\377zj\206\"I\367\330\336o\r~\322\004\351\211\331\007\362`\377^x!\316\241\203\347&u\177\355\375\016g\266\374\330\222\005\263\376A\313\020\335}H\335\035\034k\377\013\301\377\373\013A\177\037'\250\337&\330\001\017}|\356\177\255q\307{\356/\201\274)\271\306\375M\3003\302\001*\3568\217u\317.cw\277\315\260\226\007\244\200\201"
+	.string	"\356\2373%\001\035PB\255\013\242s\3779\367w\272?\024\367\227s\377'\030\370 ?1\356\0173\343\376.\356o\343\3762q\036\202\273\347\220\320\202s\367\276\036N~\353\355\233\270\277\033\006r\203I\233\373c\241\340\356d\356^\206"
+	.ascii	"w'\372"
+	.string	"\005wLcI\005\367W\022B\224\373\303X{\251$\035lx$\216\343\216Y\270?\322\021\367_Rs\377\026i\356>\302\335'\030\272c\025\356\217\346\376F\334\337\314\375\311\334_\314\375\303\334\237\313\375}\270\377\016\367\317r\177\034\356_\345\3763\334_\206\373C\271\277\013\367gr\377$\367\207\272\177\t\367\177\272\377v\177\021\270?\b\334\337\204\3733\335\337\003\356\257t\377\016\270\177\220\373\377\270\277\217\373\223p\377\r\270\277\006\334?\003\356\177\001\367\267\200\373S\300\375G\270\377\b\356/\202\373\207\340\376 \270\377\232\273[\335\237\001\356\217\201\373\177p\177\017\356\177\201\373spw!\356\317\343\376\032\334\237\350\376\007p\177\003\270\177\001\334_\002\367\267\340\3767\356\376\347\356F\334\275\210\273\233\271\273\bw\247\272\273\007\356\316\304\335\205\177\177\177\177\356@.\367\340\224\273\004\035\002D\307mm\017\267\201\225\324\351<"
+	.ascii	"\220}\247'l\273*\213\372\320Z\217\350x\311\213\227<u\203'iS\017"
+	.ascii	"\203\226T\257\355:\305w\345\007f=\230B\003\247D\307ll\017\307"
+	.ascii	":i\336\242g\335\024\310\2245\345\272j \r\242\343$/N\362p\277"
+	.ascii	"\323~CSP\321\341\355\275\244\002\2303'X\370\3564p\023\035\037"
+	.ascii	"y\361\2217\333`L\352\234\302\340\025\275\323\273\356\375T\001"
+	.ascii	"k\325tG\005M\333L\323\322r\324\366\323S\006\031\244\251\347\026"
+	.ascii	"\252\2669bf\206\317\236e\370lM8F\205\322\205Y\\d\207\276Y\"B"
+	.ascii	"\004\223i\232\375|\3225\035sL6\274\016y;2\002J\235\223*}cE\304"
+	.ascii	"@0\230\343 \036\004\213\341\251\013\021*+\274\375\024\315\340"
+	.ascii	"\216\253w2{\177\355\275'\310\177,\366\264`\026\277x\206N\372"
+	.ascii	"\203,\214:\205\261\247\345\206\213\213'\026%\230\305B\260T\024"
+	.ascii	"\223\016+\037\346\356/\231\372e%\bf\035\370\244\035\273\007\267"
+	.ascii	"3\272\367f\002\276;\372\224\361\007\376gp\237\371\374\005"
+	.string	"\330\331\335%\230\300\273\233I\276\252h\036hN(\f\033h\215B\253S\315\r\246\226\212\246\234\240\325\251\335,\302j\326D\367T\023Z\335\273f\027\0255;\220\356\032hu/m\243\270\245\337\357Ts\027Iw\315.\332N\f\320\242\251%h\325\271T\003\255N-\355\352\324\246\331E\316(\212\242\035\255\331\325\251\274]\225.\321@\253\322%hu\352\305S\201\326E\227\320\276\250\244^\013Z\264W$\305pFi\254\320W\272\347\366\376\261\023;Z\200\275cH\243sN\247O{ZW<\2138\245\377&=\251\244\273\310\n\355!\335\273\3073h']\320|\255\373\306[\2334bl\244\023{K\220\264w\363\267u\357\335\334{\273Dc\274{\303\240\201N\223\222\366~\312I\3321\232j'\366\306cuiK\320*\225\224GmHu\272\217\336\346O\367\334TTW\233B6\322\236\236.\261\320\303,\366\262"
+	.ascii	"\203f\366\264\324\344}c\322\244\310\2320\213\271rt\\\f\256;#"
+	.ascii	"'\274D\331\213\032\253f\300=d\234.\316\340\274xhU\3058!\207\331"
+	.ascii	"\231<\242c\035/\326\201\265^\240{3a\320\262\306\371]w4Z\201c"
+	.ascii	"-w|\205\261^\362\242iZ\230\305Y<\216\247O\244\351\t\016\263\r"
+	.ascii	"x\233 \373\262M9p\314\\\361\240>o\344\374\2128$Z0\353l\022\266"
+	.ascii	"!L\321T\244K\013\256Q\305\346\342\305F5F#\303L_\224'\027\025"
+	.ascii	"\353B\212\235\027f\035K\377\305SX\312\037\r\313\360\234w\357"
+	.ascii	"\"_1>L\330\254\331\233\206\327t\nG}\330[\237\336\315\244A\227"
+	.ascii	"\224_\216\006\r\3543\214\316-\310\376\316J\264g$\3323\232v\307"
+	.ascii	"P\037\006\254\266Uy\3030\360\213\272\2523#\314:~\341\216\235"
+	.ascii	"\360\323S7\360LJ\246\2620\233\341q\202\300\267\t\376\030\217"
+	.ascii	"c\027,\r>\245\035\270\005f\021S6\335;\303\354\023'\t\2354{c\241"
+	.ascii	"\3415a\246\1771\013\026X\t/\275\325\212\355\"\303\263\240\201"
+	.ascii	"-\273R\265\005Y\307K\030\372\322\275\213\\\230\222\b9\202\331"
+	.ascii	"g\302\3438\232\323\330N\370\231i\1777\024F\246\356\030\t\257"
+	.ascii	"\300*\376\305I\356\270\211\235\216\237\254\bC\205\300\275\245"
+	.ascii	"gS\013p\022N\201\241#\024\201Jr\335{/\301\252\262h\326\363\225"
+	.ascii	"\366lCc#|\342_\013\370H\317\352\271\204Y\3172\264\bvO[\3322\222"
+	.ascii	"\234\304\027\225\225\217d\246\252\274%Fj\331\305\025\231\265"
+	.ascii	"\nf\2075\320\320\260\235Z\226\337\265\004\216\037Vaz\b\303\210"
+	.ascii	"\221\005\300\345\2626\273\"7\364\260jf\206\201V\226\037\327\320"
+	.ascii	"\356\253\n\016\263.\003C\017\261\210\020\311d9\322,\005.\b\026"
+	.ascii	"\256\031'LhKy\3143\031\333\214\0251+\230\025=\214\""
+	.ascii	"&\226\2377yK`xW\"v1\260\306\3640\255\253+\207\025\221\362\273"
+	.ascii	"\216\300\211\212\227\3529Lx\204\205\002\nf\263\020\031\263\275"
+	.ascii	"'|\371\035neQ\021%\2779\310\320\253\251\206\216\367\353E-\213"
+	.ascii	"\217\026\230\315_\031\210g\260\354\2653\330\005\322\275\235\031"
+	.ascii	"l\350\267\267s\370O\301?\005l\027UVY\220\365\2300\3551<4\215"
+	.ascii	"tk+sm\370}4$l\005^T\331\0135.8"
+	.string	"\230\034BN\314\230\241i\232z\364\310>\236\300\230\206`\313\t\316GY\320\b\314*\246\205\246\201ji\345\035A\252$'\267\353tG\230\222\035tK\\@\3624\rU\207\216\234\345\271hK\225M\205F\233z\207\3459\353e\3135\356\n\207\275Q\f\034S\360V\360M\311\017\013\023M\243\303\206\215\214\203\fO\270\342\250N\310\r\3178\200X}F\254\230\315V8\354\345\004\272!0\036.\b\217\247\032bZ8EE\225\253r\364\376\332q\206\027\263\344\007eF\303s\025\220\005]\222\215.=,\2321\003\213=\315\373\2342\207\207\202\325NjC\013\357\242\242\262\214\034i\256cR\003\f\353J\312\263\214\030\351\214\243+L\223\026.yz\312P9[B\262\200A\214\254S\030\236\241\330+\265\352\021\314\346\027N%\306\312\026\351\325\327Z\250y5\201\242\207zMM\331\305S\267\322\005nR~/M\344\212"
+	.string	"i\341\331\305\207\271P\253\3145\233h!\020%\245\314\224#m\346\035`M\013\253I\223\345}\001Y\362\314\364T\355\006\245V\207\331\034}\252\007\271$\266\0133vgrNN\3204K\210)R\344\244\034i\236\002&\345\227\341\365\246~\240@\362\234t\347\222\343\255\212\t\263Y\005f\215x\370I\237\n\244\342\233\202\206C\323\334e\243l\224\241vOS6\t\254\205\032>\362\f\205Y\301c\t\013f\363\211\017\323Jv\240\355\260\032\016\351\313\261\026\245k\254\331\231\235\371\371"
+	.ascii	"\034(\030\030K\326\230`6?\237\355E\213\007\025\022f\375\305H"
+	.ascii	"\317D!z\336y?[\316n\346m\320J\213\363\273\342\351\232\024\210"
+	.ascii	"[|\013\266\323\333\351\353x\224\325\275\351\032$D\307Y\034\367"
+	.ascii	"a?\274\245\233Qmv\203\212.\242]si\267\202\373\254\340kp\357\177"
+	.ascii	"\245J\321\232/>\334\307\207\257\272i!*-\030\245\033\342\344\212"
+	.ascii	"\343\253\360k\r\257\317G\317\032\216+f]\323\320"
+	.string	"\256Q\350\031?\242\343\275\275\247>\315~J\271N\257h\241\023\321q\336\213\363\360\213\r\0208\352\303s\251\323\025\224\210x\312\343;<\005Sy\252\336S\027\263\243-x;\372V\340.K\264\273T\265\377S\203\025\214\352\352\260\335?\355f\336\005\177o\234\337\325\2558\266\003\306\365\300*\343\322\332\213\350xn\356\341\2420W\033\373\350\252\352\260\322\025\202D\211r\345\235\266\340\253k\322/)\020\035\313\375\213\345\360\027\353\244\356&\b\332\240\222\274\033\237\223\022f\335E\205\2560%.n\317*\\\323\253Z\352\323\254\034\321\261\325\377\305V\374\203-\242\356\346\220\023'\267\240\216\260;\250\234\266y\276\275\255\341\275\344 \362V\215h \022\321\261\233\333S\177O\177\037\225=\231\340i%\252\024\007U\003\237\002\036\244\323\n\035]\013nO\321E\266\035\3040I\030\0222\276\034\335c\022\004\0337y\314>\311VD"
+	.string	"L\270CB\036\374\020\201\260\300\004A\350A:;K\"\267\330\376 \225K\327X\302\3215r\320\372(\205\226G\016\230\307\341\262\030dd\201\222\307\245+bH\001\267\005\252i\201\212\313vH\210\003\267\005\212q\213H\"#\262h4"
+	.string	"\007\013\222\305\243O\322\003\240#\b\017<$\340| \001f\331\372\024\333\021\224#L\020\001\224<\266#0[\327\004\210\n\036Tb\211St\213\035\224\030!g\351\212\340\022\344\026\205$\340\300\354!Q\202O\317\007\343\322\030\363\201\204\230\026HFD\007\214m\2201"
+	.string	">-\222D1\351\201\361\306=&\2175<:\255\320qD\2134\232\b\3412\213\021\260\331\240\343.\213C:#Z\244O\262\030$\201\233$R\206\220\251\331\240S\242\365I\202\320\"\211|\332 \243\210\037\3462\004\223\331\032\225\313\241\230\237a\353\243\224\300\0076\232\203\032!\0217\"@"
+	.ascii	"\300-\212\020\"J\302 \2132\036\244c\354I\022-w\214?\004"
+	.string	"`\002\025\221\037\264n\321e\302\264\314%\221\322\330\343\223$R.\201j|\332v\210\351A:\314!\240\035\345\361\306g\251T\032{D\210\340\200\027\346\220\003d~\210@\f\333\017\034\221\305\344\361\003\3432D\353\036\227\025\220q\343q\331&[ \355\027xP\200\207\017%\\\374C\006\0332\330\020\364\017\031\360\360d\340\201G\273\007\236\354\3660[$P\222\203e\213$\362\240\365!r\217\256[\304q\335\036&\t\255\320\321\325>\301\213\333\366\264C&F\264B\305\345\007C\017\322\371!\"!Tl\227.s'\251\024\022R\032\007\300\354\371!\"\301\f.\335\241\354\223l\263\t\305e\366 \035\"\241\343\216\033\004tD\376\344 \221\312%\033dt\217C@\023\212&2\263%B\026K\bz\220\316\016s\251d&[\346\005W\016\265\313\035W\251\\\356\3040{\200\216?Ie\211b\362(T\001\211l\215&"
+	.string	""
+	.string	"\331\226\320F\300M\266\314v)\202\253\f\001"
+	.string	"m\017RYB\205\266\347\2465.\211\224\"\226\255\333J\300M\266\313%\221\261\202\333\343\201G\233p\217\306\342P1\204\211e\353\272E\022C\267\b\202\002-\223h\006\251T\202\350\0012\335e\213\344 D\313$\272i\201\212n\2625.[\021\200\222\307\344\262X\201\244\362\350\016\t\0211\223J\343\004\314#\263]\266.\323D\220[$Q\202\320\355\341`\201\233<\272\270=\037\334\344\221\310\305;t\360\260\200\037\022\026l\320\241q\f0\b\201\201\204\020\034\240\215:?\314\245q\307\304\322m\205Zd\353\356$\217E\241\035\343\222\271\243#"
+	.ascii	",[\232\354\316\252\002\2638-\366r_\336\313\327\227\246\220N\255"
+	.ascii	"n\307u?5ep\317V<_\363\225:\033km\231o\250\304\212\2144-:W\301"
+	.ascii	">\342\266\\]\221\331\323;\233\361\222\221\202+"
+	.string	"\017_\203[\364\304\324\360\260\035K\366\302\212\212\n\331\234\264\n\351\016\223\245\201\355\245\300\354M\nSr\ny\n&\373\035\345\261e\234\330\205\311`\275\2115\251\243\2031\243*\005f=\323e\260\r\354]=\263\302\201\207\331,\205\307\363\234\0069hta6\347(\371\tB\017\251*C\311r1R\206\270\221e\271\f&s\326D\254\306\223/\r\327\032T\314\306\355\210\301z\217\030\301\341\037B-\347\232\224\325G\020\t\t\220-'\231\013\001GHi\230\275y\332Z!\243\244\224C\352\206#\257\330\242r\304\344\341\202NFY\314\332\262f\220TyKC\241\n\205,{\315\254\344\255\n\337\244D\231c\242\3353\033T\036\032\212#kY\306M\223\212\221$ba\001\2035\250R\311<F\003\025B\b\321\214\310h\222$\035\242\n\020\004Cy\236\350\320\003\022\300T5\327)\307ff\222\024\n;{\007\256T"
+	.ascii	"\217e\264\002\241A\316\234\344\367\200\377\004\366\361\257\202"
+	.ascii	"5\235D\206Q\nS\267\343l\335}\301\371\224\321C\033\217`\017c."
+	.ascii	"\177\354M\373\246Ch\024"
+	.ascii	"+J%b\236\331\210R\234\240)\030\232\021\205\3159\333\375I\037"
+	.ascii	"\361\270\332\0214\022\265\306\037\237\244\374\210\001\313\007"
+	.ascii	"Z\302)\273%/\365\271}\021\026w\005\2415\350\246\250\022\250 "
+	.ascii	"S\004\227$\035\n\305b\333\323\353\323\267\363xoX{)'W$Pr\035t"
+	.ascii	"v1nv\231\356q\330k<\311\036\326\230\021\312\244{\265)\371\254"
+	.ascii	"\221\367;\215!\373t\364@<|M\200\244fC\334\232\\}\264Yx\304X\266"
+	.ascii	"\257d\261\331\207'\201\214}Hp{\035\202\331hB\320\017G\f?\226"
+	.ascii	"\266\245\f\261\354\313J\336\304\360\333\351\301$\306\016\303"
+	.ascii	"\177v7W@\f.\366\214\254\366\342!\b'\002\253\023\333x1rX\230\325"
+	.ascii	"G\341\302j\217\377\342\\Ge\031\340ZO\034\311@W\326\n\307\243"
+	.ascii	")TU%\323\314\264\231\201\0132R\343\344q\263\237\364\365\332\003"
+	.ascii	"2\211(k(\377\351]\036{PD\217\r\212>\235\341\316]\334# \330\320"
+	.ascii	"b\332\270\032\t\264<\363\b\b\031\006\202\345J\237SI\375\2036"
+	.ascii	"\275\"\237\234kGg\272\035\030\356%-\300!\024\364i\326\377\317"
+	.ascii	"\361%\023\364D\325\177\207\273\026\276f\334\340\263\3526\236"
+	.ascii	"\021\361W\b\342\332\345\006w\270]$0L\252T\367\237\353\226\005"
+	.ascii	"\023\301\351@E0\215\201l\013$\212\017\334\300W\323e\001\314\367"
+	.ascii	"\003\034!\3358\222\332U\241N'\t\317:A\373\320\365g\221\343n0"
+	.ascii	"=\217\201\365\217\272\324\001\240\374vC\356\f\f\237A*D\300i\304"
+	.ascii	"i\331 \030\22729v\016\253\227\233e\364\261>\201\242>\306\311"
+	.ascii	"\237y\312\0335b\003\300\275\317b\001\210\337P\373\005\356\303"
+	.ascii	"p\256A\021\327K[\222\361\033\"\330`\330\346\376\031\325)$\177"
+	.ascii	"<\021\305\347\322\247{9l\277/@\035\271\360\302\215\030z\334\310"
+	.ascii	"\037\001^\265\315\034\3168\333]\202E\004 \300\337\337@\311\227"
+	.ascii	"\371\311\n\256\031K\033_q\341\b\030\035\254I?\237\355\361\006"
+	.ascii	"\235w\213\255\2560r\037-\264\313V\037\036\273\013\027\232\340"
+	.ascii	"2{G&a\362\372\273\352\016\001\223\323\327el\315\020-\200\005"
+	.ascii	"\331\241\211B4\314Q\244S\336K\031\246j\023ek\276\205j6\350"
+	.string	"\304\"\343\362\310.T?\001+\233TnoP9\256\314(\321nO\242\320mY@FE\251P\326'\376\375\225}\231\003\341\252\202SQ6K*\246\023\371H};i\3657\364\017\231\273\223Ht\366\311\275\017P\200\322\301\316\232\330=\300\020#\375p\275\b\310\340\"\202\215\\\334\226\261\034\0137\226\232\304\202\316\345dv\244\2032&(\005\314_\213\354e\270\232\376\351\200\223f\0161\354\026\361\n\221/\266.\375\373\321\264\231\212D\253h\220v\246\025-\303\b\210r\262\354p\210\315&S\220q\206s61\203\343\310\300\f\337\022\310y;y\344\300\230\n\3273\344\322\026\310\250\240\223\342\003\326\\\001_\020\326r\221\001\241\005D\311_\004\234\317\224\206.l\212\370;K\003\326*=FW\027\220,\343\323{\314\370\231\204F|\001\325\240\336/\021\027\211\021\212u\226\377Kr\317\223\203G\030\026\243i \360\235"
+	.string	"\234$\347\273Z\342\354\276\320\241$\021\026l\311v\317\211\032)\205\320\b\032\272\334\207#\231S3\307\fa\354"
+	.ascii	"\301h\2758e%\205\332&\254`\335\360\336M\252\255\r\250\2341\220"
+	.ascii	"\275\341\356\332!\344\320\225\217\024\232\346\036\001\255\346"
+	.ascii	"\211P\227\277\216\230\241\ro/\216\375\t\247:\204\324Z\222^|\361"
+	.ascii	"\341>\236\234A\022-\004&\340\323EX\016\\\212ue\356\031\354{\361"
+	.ascii	"\335\321d\311\232\311\240\373\311\321\213\327\261\2511\225%;"
+	.ascii	"\333\273N\302\331i\200\2150\246\007\206\351\313\020\201\361\255"
+	.ascii	" \331\355\277;\342O\026\220\215\367\211\210\320\305\346\310\250"
+	.ascii	"z\001\257\221\372\232\324\346\205*\272\206\026G\305,\332[z\275"
+	.ascii	"PiY\200\234\027S\345W\250\b\306\331\261p\004\335\246\330\213"
+	.ascii	"k\244.G\223w\367\237\333\242\023\301\\q\204\204\312\005\r\303"
+	.ascii	"T\013\344\035\303s\3410\035a\260W\027\200\334\036\351\3407\024"
+	.ascii	"$\342]G*\327*[\241\237qh\337\005r\357\327\f'\232`\261s\005\343"
+	.ascii	"\335\215\220\310\225\201\237\256\310\262sfk!3\242\323.\271I\032"
+	.ascii	"\322g\355\234\333J;bX\255\034\334\263\300\340a\347\314\013\306"
+	.ascii	"\337\024\270\177\355\206\331\202\372&\274\316q:T\032\355\336"
+	.ascii	"^\364\245H\001\374\366\006X\262D\302{\271\016\311\301\325\223"
+	.ascii	"\360~\370\367o\233\206\223\367)\370|J\362J\375KeV+\316\223\322"
+	.ascii	"BO\036:r\264\227\"\013\310\027\374\236\307\243\336\333x\016f"
+	.ascii	"\335\241\206\327\377\206\200Aw\024-\027\371\207xG\007\321\376"
+	.ascii	"_\3662\235\017:\357\257=a=m=\371/Aj1\356\001G\2307\034Q\356\376"
+	.ascii	"jV\355\031\341\313\242h\364\365\370{v\300w\365\352\f\375vBG\321"
+	.ascii	"\236\235\276\177\373\233\237W\220L]OQ\371\366\375S\"\247]\274"
+	.ascii	"m\f\325j5gC\177\027\274\222\262->\356d\301\306\347:p\005\r9\270"
+	.ascii	"pN8*\374g\017\334\363\342S\205\003\367z@c\324\352/\327G\346\353"
+	.ascii	"\343}\216\237U\314\300\360\320t\250\222=\361\177~@\307\260\312"
+	.ascii	"\001\304\255\202\001\307\333\367\377\310\341\370\003\355\357"
+	.ascii	"\227\254A^\243\357\220\356Z{\354\364+\230\016\356J\277f\035\230"
+	.ascii	"'\275\247\325-'\300-\273\367\361\273R\336\n\336\245\362\352-"
+	.ascii	"\345\037e\354d\332\304K\276\215\177\b\352\037\343p\352\336\266"
+	.ascii	"ST\236@\274y\005\3567[\371\t0k\003"
+	.text
+	.section	.gnu.lto_.symtab.b55c614f25e16635,"e",@progbits
+	.string	"crsfFrameGps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"crsfFrameBatterySensor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"crsfFrameAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"crsfFrameFlightMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"initCrsfTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"checkCrsfTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"handleCrsfTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"getCrsfFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"GPS_coord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"GPS_speed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"GPS_ground_course"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"GPS_altitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"GPS_numSat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"crsfRxWriteTelemetryData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"sbufWriteU16BigEndian"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"sbufWriteU32BigEndian"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"isAirmodeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"crsfRxIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"crsfRxIsTelemetryBufEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"crsfRxSendTelemetryData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b55c614f25e16635,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,15529 @@
+	.file	"frsky.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/io_types.h"
+	.file 5 "./src/main/drivers/sensor.h"
+	.file 6 "./src/main/drivers/accgyro.h"
+	.file 7 "./src/main/drivers/accgyro_mpu.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/drivers/serial.h"
+	.file 10 "./src/main/fc/config.h"
+	.file 11 "./src/main/fc/rc_controls.h"
+	.file 12 "./src/main/fc/runtime_config.h"
+	.file 13 "./src/main/sensors/sensors.h"
+	.file 14 "./src/main/sensors/acceleration.h"
+	.file 15 "./src/main/drivers/barometer.h"
+	.file 16 "./src/main/sensors/barometer.h"
+	.file 17 "./src/main/sensors/current.h"
+	.file 18 "./src/main/sensors/voltage.h"
+	.file 19 "./src/main/sensors/battery.h"
+	.file 20 "./src/main/io/serial.h"
+	.file 21 "./src/main/io/gps.h"
+	.file 22 "./src/main/flight/pid.h"
+	.file 23 "./src/main/flight/imu.h"
+	.file 24 "./src/main/flight/altitudehold.h"
+	.file 25 "./src/main/telemetry/telemetry.h"
+	.file 26 "./src/main/telemetry/frsky.h"
+	.file 27 "./src/main/telemetry/frsky.c"
+	.file 28 "./src/main/drivers/system.h"
+	.file 29 "./src/main/config/feature.h"
+	.file 30 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	frsky.c.d76ee49f
+	.weak	frsky.c.d76ee49f
+frsky.c.d76ee49f:
+	.long	0x1466
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x26
+	.long	.LASF2165
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1745
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1746
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1747
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1748
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1749
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1750
+	.uleb128 0x4
+	.long	.LASF1751
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x37
+	.uleb128 0x4
+	.long	.LASF1752
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x6b
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1753
+	.uleb128 0x4
+	.long	.LASF1754
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x3e
+	.uleb128 0x4
+	.long	.LASF1755
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x30
+	.uleb128 0x4
+	.long	.LASF1756
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x45
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1757
+	.uleb128 0x4
+	.long	.LASF1758
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0x4
+	.long	.LASF1759
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7e
+	.uleb128 0x4
+	.long	.LASF1760
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x53
+	.uleb128 0xd
+	.long	0xb7
+	.uleb128 0x29
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF1761
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x4
+	.long	.LASF1762
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1763
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x2a
+	.uleb128 0x4
+	.long	.LASF1764
+	.byte	0x4
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x5
+	.byte	0x19
+	.long	0x141
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1774
+	.byte	0x5
+	.byte	0x23
+	.byte	0x3
+	.long	0xfe
+	.uleb128 0x7
+	.long	.LASF1778
+	.byte	0x8
+	.byte	0x5
+	.byte	0x26
+	.byte	0xc
+	.long	0x168
+	.uleb128 0x2
+	.long	.LASF1780
+	.byte	0x5
+	.byte	0x27
+	.byte	0xe
+	.long	0xf2
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1775
+	.byte	0x8
+	.byte	0x5
+	.byte	0x25
+	.byte	0xf
+	.long	0x182
+	.uleb128 0x20
+	.string	"spi"
+	.byte	0x5
+	.byte	0x28
+	.byte	0x7
+	.long	0x14d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1775
+	.byte	0x5
+	.byte	0x29
+	.byte	0x3
+	.long	0x168
+	.uleb128 0xd
+	.long	0x182
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1776
+	.uleb128 0x4
+	.long	.LASF1777
+	.byte	0x5
+	.byte	0x2f
+	.byte	0x10
+	.long	0x1a6
+	.uleb128 0x5
+	.long	0x1ab
+	.uleb128 0xc
+	.long	0x1b6
+	.uleb128 0x3
+	.long	0x1b6
+	.byte	0
+	.uleb128 0x5
+	.long	0x1bb
+	.uleb128 0x7
+	.long	.LASF1779
+	.byte	0x60
+	.byte	0x6
+	.byte	0x44
+	.byte	0x10
+	.long	0x23e
+	.uleb128 0x2
+	.long	.LASF1781
+	.byte	0x6
+	.byte	0x45
+	.byte	0x1a
+	.long	0x19a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1782
+	.byte	0x6
+	.byte	0x46
+	.byte	0x1a
+	.long	0x23e
+	.byte	0x8
+	.uleb128 0x15
+	.string	"bus"
+	.byte	0x6
+	.byte	0x47
+	.byte	0x11
+	.long	0x182
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1783
+	.byte	0x6
+	.byte	0x48
+	.byte	0xe
+	.long	0xcd
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1784
+	.byte	0x6
+	.byte	0x49
+	.byte	0xd
+	.long	0x3ef
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1785
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xa
+	.long	0x98
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1786
+	.byte	0x6
+	.byte	0x4b
+	.byte	0x14
+	.long	0x141
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1787
+	.byte	0x6
+	.byte	0x4c
+	.byte	0x1a
+	.long	0x3e3
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1788
+	.byte	0x6
+	.byte	0x4d
+	.byte	0x18
+	.long	0x329
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1789
+	.byte	0x5
+	.byte	0x30
+	.byte	0xf
+	.long	0x24a
+	.uleb128 0x5
+	.long	0x24f
+	.uleb128 0xe
+	.long	0x193
+	.long	0x25e
+	.uleb128 0x3
+	.long	0x1b6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1790
+	.byte	0x7
+	.byte	0x7f
+	.byte	0xf
+	.long	0x26a
+	.uleb128 0x5
+	.long	0x26f
+	.uleb128 0xe
+	.long	0x193
+	.long	0x28d
+	.uleb128 0x3
+	.long	0x28d
+	.uleb128 0x3
+	.long	0xb7
+	.uleb128 0x3
+	.long	0xb7
+	.uleb128 0x3
+	.long	0xec
+	.byte	0
+	.uleb128 0x5
+	.long	0x18e
+	.uleb128 0x4
+	.long	.LASF1791
+	.byte	0x7
+	.byte	0x80
+	.byte	0xf
+	.long	0x29e
+	.uleb128 0x5
+	.long	0x2a3
+	.uleb128 0xe
+	.long	0x193
+	.long	0x2bc
+	.uleb128 0x3
+	.long	0x28d
+	.uleb128 0x3
+	.long	0xb7
+	.uleb128 0x3
+	.long	0xb7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1792
+	.byte	0x7
+	.byte	0x81
+	.byte	0xf
+	.long	0x2c8
+	.uleb128 0x5
+	.long	0xf1
+	.uleb128 0x7
+	.long	.LASF1793
+	.byte	0x30
+	.byte	0x7
+	.byte	0x85
+	.byte	0x10
+	.long	0x329
+	.uleb128 0x2
+	.long	.LASF1794
+	.byte	0x7
+	.byte	0x86
+	.byte	0x1a
+	.long	0x25e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1795
+	.byte	0x7
+	.byte	0x87
+	.byte	0x1b
+	.long	0x292
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1796
+	.byte	0x7
+	.byte	0x88
+	.byte	0x1a
+	.long	0x25e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1797
+	.byte	0x7
+	.byte	0x89
+	.byte	0x1b
+	.long	0x292
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1798
+	.byte	0x7
+	.byte	0x8a
+	.byte	0x13
+	.long	0x2bc
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1799
+	.byte	0x7
+	.byte	0x8b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1800
+	.byte	0x7
+	.byte	0x8c
+	.byte	0x3
+	.long	0x2cd
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x7
+	.byte	0xaa
+	.long	0x38a
+	.uleb128 0x1
+	.long	.LASF1801
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1802
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1803
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1804
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1805
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1807
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1808
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1809
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1810
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1811
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1812
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1813
+	.byte	0x7
+	.byte	0xb7
+	.byte	0x3
+	.long	0x335
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x7
+	.byte	0xb9
+	.long	0x3af
+	.uleb128 0x1
+	.long	.LASF1814
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1816
+	.byte	0x7
+	.byte	0xbc
+	.byte	0x3
+	.long	0x396
+	.uleb128 0x7
+	.long	.LASF1817
+	.byte	0x8
+	.byte	0x7
+	.byte	0xbe
+	.byte	0x10
+	.long	0x3e3
+	.uleb128 0x2
+	.long	.LASF1818
+	.byte	0x7
+	.byte	0xbf
+	.byte	0x11
+	.long	0x38a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1819
+	.byte	0x7
+	.byte	0xc0
+	.byte	0x19
+	.long	0x3af
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1820
+	.byte	0x7
+	.byte	0xc1
+	.byte	0x3
+	.long	0x3bb
+	.uleb128 0x16
+	.long	0x9f
+	.long	0x3ff
+	.uleb128 0x17
+	.long	0x29
+	.byte	0x2
+	.byte	0
+	.uleb128 0x16
+	.long	0xab
+	.long	0x40f
+	.uleb128 0x17
+	.long	0x29
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1821
+	.byte	0x6
+	.byte	0x4e
+	.byte	0x3
+	.long	0x1bb
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x8
+	.byte	0x14
+	.long	0x542
+	.uleb128 0x1
+	.long	.LASF1822
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1823
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1824
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1825
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1826
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1828
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1829
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1830
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1831
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1832
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1833
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1834
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1836
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1840
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1841
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1848
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1849
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1850
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1851
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1866
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1867
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1868
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1872
+	.long	0x45
+	.byte	0x9
+	.byte	0x16
+	.long	0x564
+	.uleb128 0x1
+	.long	.LASF1869
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1872
+	.byte	0x9
+	.byte	0x1a
+	.byte	0x3
+	.long	0x542
+	.uleb128 0x1b
+	.long	.LASF1873
+	.long	0x45
+	.byte	0x9
+	.byte	0x1c
+	.long	0x5bc
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1878
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1873
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x3
+	.long	0x570
+	.uleb128 0x4
+	.long	.LASF1884
+	.byte	0x9
+	.byte	0x31
+	.byte	0x10
+	.long	0x5d4
+	.uleb128 0x5
+	.long	0x5d9
+	.uleb128 0xc
+	.long	0x5e4
+	.uleb128 0x3
+	.long	0xcd
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1885
+	.byte	0x9
+	.byte	0x32
+	.byte	0x10
+	.long	0x5f0
+	.uleb128 0x5
+	.long	0x5f5
+	.uleb128 0xc
+	.long	0x605
+	.uleb128 0x3
+	.long	0x605
+	.uleb128 0x3
+	.long	0x30
+	.byte	0
+	.uleb128 0x5
+	.long	0xc3
+	.uleb128 0x7
+	.long	.LASF1886
+	.byte	0x50
+	.byte	0x9
+	.byte	0x34
+	.byte	0x10
+	.long	0x6db
+	.uleb128 0x2
+	.long	.LASF1887
+	.byte	0x9
+	.byte	0x36
+	.byte	0x24
+	.long	0x78a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1888
+	.byte	0x9
+	.byte	0x38
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1889
+	.byte	0x9
+	.byte	0x39
+	.byte	0x10
+	.long	0x564
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1890
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x13
+	.long	0x5bc
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1891
+	.byte	0x9
+	.byte	0x3c
+	.byte	0xe
+	.long	0xd9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1892
+	.byte	0x9
+	.byte	0x3e
+	.byte	0xe
+	.long	0xd9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1893
+	.byte	0x9
+	.byte	0x3f
+	.byte	0xe
+	.long	0xd9
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1894
+	.byte	0x9
+	.byte	0x40
+	.byte	0x17
+	.long	0x78f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1895
+	.byte	0x9
+	.byte	0x41
+	.byte	0x17
+	.long	0x78f
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1896
+	.byte	0x9
+	.byte	0x42
+	.byte	0xe
+	.long	0xd9
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1897
+	.byte	0x9
+	.byte	0x43
+	.byte	0xe
+	.long	0xd9
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF1898
+	.byte	0x9
+	.byte	0x44
+	.byte	0xe
+	.long	0xd9
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1899
+	.byte	0x9
+	.byte	0x45
+	.byte	0xe
+	.long	0xd9
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1900
+	.byte	0x9
+	.byte	0x47
+	.byte	0x1e
+	.long	0x5c8
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1901
+	.byte	0x9
+	.byte	0x48
+	.byte	0x23
+	.long	0x5e4
+	.byte	0x48
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1902
+	.byte	0x60
+	.byte	0x9
+	.byte	0x5a
+	.byte	0x8
+	.long	0x785
+	.uleb128 0x2
+	.long	.LASF1903
+	.byte	0x9
+	.byte	0x5b
+	.byte	0xc
+	.long	0x7ba
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1904
+	.byte	0x9
+	.byte	0x5d
+	.byte	0x10
+	.long	0x7d3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1905
+	.byte	0x9
+	.byte	0x5e
+	.byte	0x10
+	.long	0x7d3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1906
+	.byte	0x9
+	.byte	0x60
+	.byte	0xf
+	.long	0x7e7
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1907
+	.byte	0x9
+	.byte	0x63
+	.byte	0xc
+	.long	0x7fc
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1908
+	.byte	0x9
+	.byte	0x65
+	.byte	0xb
+	.long	0x810
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1909
+	.byte	0x9
+	.byte	0x67
+	.byte	0xc
+	.long	0x825
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1910
+	.byte	0x9
+	.byte	0x69
+	.byte	0xc
+	.long	0x845
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1911
+	.byte	0x9
+	.byte	0x6b
+	.byte	0xc
+	.long	0x855
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1912
+	.byte	0x9
+	.byte	0x6c
+	.byte	0xc
+	.long	0x855
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1913
+	.byte	0x9
+	.byte	0x6f
+	.byte	0xb
+	.long	0x873
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF1914
+	.byte	0x9
+	.byte	0x71
+	.byte	0xb
+	.long	0x88c
+	.byte	0x58
+	.byte	0
+	.uleb128 0xd
+	.long	0x6db
+	.uleb128 0x5
+	.long	0x785
+	.uleb128 0x5
+	.long	0xc8
+	.uleb128 0x4
+	.long	.LASF1915
+	.byte	0x9
+	.byte	0x49
+	.byte	0x3
+	.long	0x60a
+	.uleb128 0xd
+	.long	0x794
+	.uleb128 0xc
+	.long	0x7b5
+	.uleb128 0x3
+	.long	0x7b5
+	.uleb128 0x3
+	.long	0xb7
+	.byte	0
+	.uleb128 0x5
+	.long	0x794
+	.uleb128 0x5
+	.long	0x7a5
+	.uleb128 0xe
+	.long	0xd9
+	.long	0x7ce
+	.uleb128 0x3
+	.long	0x7ce
+	.byte	0
+	.uleb128 0x5
+	.long	0x7a0
+	.uleb128 0x5
+	.long	0x7bf
+	.uleb128 0xe
+	.long	0xb7
+	.long	0x7e7
+	.uleb128 0x3
+	.long	0x7b5
+	.byte	0
+	.uleb128 0x5
+	.long	0x7d8
+	.uleb128 0xc
+	.long	0x7fc
+	.uleb128 0x3
+	.long	0x7b5
+	.uleb128 0x3
+	.long	0xd9
+	.byte	0
+	.uleb128 0x5
+	.long	0x7ec
+	.uleb128 0xe
+	.long	0x193
+	.long	0x810
+	.uleb128 0x3
+	.long	0x7ce
+	.byte	0
+	.uleb128 0x5
+	.long	0x801
+	.uleb128 0xc
+	.long	0x825
+	.uleb128 0x3
+	.long	0x7b5
+	.uleb128 0x3
+	.long	0x564
+	.byte	0
+	.uleb128 0x5
+	.long	0x815
+	.uleb128 0xc
+	.long	0x83f
+	.uleb128 0x3
+	.long	0x7b5
+	.uleb128 0x3
+	.long	0x83f
+	.uleb128 0x3
+	.long	0x30
+	.byte	0
+	.uleb128 0x5
+	.long	0x844
+	.uleb128 0x2c
+	.uleb128 0x5
+	.long	0x82a
+	.uleb128 0xc
+	.long	0x855
+	.uleb128 0x3
+	.long	0x7b5
+	.byte	0
+	.uleb128 0x5
+	.long	0x84a
+	.uleb128 0xe
+	.long	0x30
+	.long	0x873
+	.uleb128 0x3
+	.long	0x7b5
+	.uleb128 0x3
+	.long	0xec
+	.uleb128 0x3
+	.long	0x30
+	.byte	0
+	.uleb128 0x5
+	.long	0x85a
+	.uleb128 0xe
+	.long	0x193
+	.long	0x88c
+	.uleb128 0x3
+	.long	0x7b5
+	.uleb128 0x3
+	.long	0x5e4
+	.byte	0
+	.uleb128 0x5
+	.long	0x878
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0xa
+	.byte	0x23
+	.long	0x96e
+	.uleb128 0x1
+	.long	.LASF1916
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1917
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1918
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1919
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1920
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1921
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1922
+	.byte	0x80
+	.uleb128 0xa
+	.long	.LASF1923
+	.value	0x100
+	.uleb128 0xa
+	.long	.LASF1924
+	.value	0x200
+	.uleb128 0xa
+	.long	.LASF1925
+	.value	0x400
+	.uleb128 0xa
+	.long	.LASF1926
+	.value	0x1000
+	.uleb128 0xa
+	.long	.LASF1927
+	.value	0x2000
+	.uleb128 0xa
+	.long	.LASF1928
+	.value	0x4000
+	.uleb128 0xa
+	.long	.LASF1929
+	.value	0x8000
+	.uleb128 0x8
+	.long	.LASF1930
+	.long	0x10000
+	.uleb128 0x8
+	.long	.LASF1931
+	.long	0x20000
+	.uleb128 0x8
+	.long	.LASF1932
+	.long	0x40000
+	.uleb128 0x8
+	.long	.LASF1933
+	.long	0x80000
+	.uleb128 0x8
+	.long	.LASF1934
+	.long	0x100000
+	.uleb128 0x8
+	.long	.LASF1935
+	.long	0x200000
+	.uleb128 0x8
+	.long	.LASF1936
+	.long	0x400000
+	.uleb128 0x8
+	.long	.LASF1937
+	.long	0x800000
+	.uleb128 0x8
+	.long	.LASF1938
+	.long	0x1000000
+	.uleb128 0x8
+	.long	.LASF1939
+	.long	0x2000000
+	.uleb128 0x8
+	.long	.LASF1940
+	.long	0x4000000
+	.uleb128 0x8
+	.long	.LASF1941
+	.long	0x8000000
+	.uleb128 0x8
+	.long	.LASF1942
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1943
+	.long	0x45
+	.byte	0xb
+	.byte	0x41
+	.long	0x9c6
+	.uleb128 0x1
+	.long	.LASF1944
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1945
+	.byte	0x1
+	.uleb128 0x2d
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1946
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1947
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1950
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1951
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1952
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1953
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1954
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0xb
+	.byte	0x50
+	.long	0x9df
+	.uleb128 0x1
+	.long	.LASF1955
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1956
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1957
+	.byte	0xb
+	.byte	0x53
+	.byte	0x3
+	.long	0x9c6
+	.uleb128 0xd
+	.long	0x9df
+	.uleb128 0x16
+	.long	0x9f
+	.long	0xa00
+	.uleb128 0x17
+	.long	0x29
+	.byte	0x3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1962
+	.byte	0xb
+	.byte	0x9b
+	.byte	0x10
+	.long	0x9f0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0xc
+	.byte	0x15
+	.long	0xa31
+	.uleb128 0x1
+	.long	.LASF1958
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1959
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1960
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1961
+	.byte	0x8
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1963
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0xd
+	.byte	0x14
+	.long	0xa68
+	.uleb128 0x1
+	.long	.LASF1964
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1965
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1966
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1968
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1969
+	.byte	0x78
+	.byte	0xe
+	.byte	0x2c
+	.byte	0x10
+	.long	0xaaa
+	.uleb128 0x15
+	.string	"dev"
+	.byte	0xe
+	.byte	0x2d
+	.byte	0xe
+	.long	0x40f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1970
+	.byte	0xe
+	.byte	0x2e
+	.byte	0xe
+	.long	0xd9
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1971
+	.byte	0xe
+	.byte	0x2f
+	.byte	0xd
+	.long	0x3ff
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF1972
+	.byte	0xe
+	.byte	0x30
+	.byte	0x9
+	.long	0x193
+	.byte	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1973
+	.byte	0xe
+	.byte	0x31
+	.byte	0x3
+	.long	0xa68
+	.uleb128 0x2e
+	.string	"acc"
+	.byte	0xe
+	.byte	0x33
+	.byte	0xe
+	.long	0xaaa
+	.uleb128 0x4
+	.long	.LASF1974
+	.byte	0xf
+	.byte	0x14
+	.byte	0x10
+	.long	0x2c8
+	.uleb128 0x4
+	.long	.LASF1975
+	.byte	0xf
+	.byte	0x15
+	.byte	0x10
+	.long	0xada
+	.uleb128 0x5
+	.long	0xadf
+	.uleb128 0xc
+	.long	0xaef
+	.uleb128 0x3
+	.long	0xaef
+	.uleb128 0x3
+	.long	0xaef
+	.byte	0
+	.uleb128 0x5
+	.long	0xab
+	.uleb128 0x7
+	.long	.LASF1976
+	.byte	0x30
+	.byte	0xf
+	.byte	0x17
+	.byte	0x10
+	.long	0xb5d
+	.uleb128 0x2
+	.long	.LASF1977
+	.byte	0xf
+	.byte	0x18
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1978
+	.byte	0xf
+	.byte	0x19
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1979
+	.byte	0xf
+	.byte	0x1a
+	.byte	0x13
+	.long	0xac2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1980
+	.byte	0xf
+	.byte	0x1b
+	.byte	0x13
+	.long	0xac2
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1981
+	.byte	0xf
+	.byte	0x1c
+	.byte	0x13
+	.long	0xac2
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1982
+	.byte	0xf
+	.byte	0x1d
+	.byte	0x13
+	.long	0xac2
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1983
+	.byte	0xf
+	.byte	0x1e
+	.byte	0x1a
+	.long	0xace
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1984
+	.byte	0xf
+	.byte	0x1f
+	.byte	0x3
+	.long	0xaf4
+	.uleb128 0x7
+	.long	.LASF1985
+	.byte	0x38
+	.byte	0x10
+	.byte	0x2b
+	.byte	0x10
+	.long	0xb9e
+	.uleb128 0x15
+	.string	"dev"
+	.byte	0x10
+	.byte	0x2c
+	.byte	0xf
+	.long	0xb5d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1986
+	.byte	0x10
+	.byte	0x2d
+	.byte	0xd
+	.long	0xab
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1987
+	.byte	0x10
+	.byte	0x2e
+	.byte	0xd
+	.long	0xab
+	.byte	0x34
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1988
+	.byte	0x10
+	.byte	0x2f
+	.byte	0x3
+	.long	0xb69
+	.uleb128 0xf
+	.long	.LASF1989
+	.byte	0x10
+	.byte	0x31
+	.byte	0xf
+	.long	0xb9e
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x11
+	.byte	0x16
+	.long	0xbe1
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1995
+	.byte	0x11
+	.byte	0x1c
+	.byte	0x3
+	.long	0xbb6
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x12
+	.byte	0x1a
+	.long	0xc0c
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1999
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x3
+	.long	0xbed
+	.uleb128 0x7
+	.long	.LASF2000
+	.byte	0x14
+	.byte	0x13
+	.byte	0x1b
+	.byte	0x10
+	.long	0xcb5
+	.uleb128 0x2
+	.long	.LASF2001
+	.byte	0x13
+	.byte	0x1d
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2002
+	.byte	0x13
+	.byte	0x1e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2003
+	.byte	0x13
+	.byte	0x1f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2004
+	.byte	0x13
+	.byte	0x20
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2005
+	.byte	0x13
+	.byte	0x22
+	.byte	0x1a
+	.long	0xc0c
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2006
+	.byte	0x13
+	.byte	0x25
+	.byte	0x1a
+	.long	0xbe1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2007
+	.byte	0x13
+	.byte	0x26
+	.byte	0xe
+	.long	0xcd
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2008
+	.byte	0x13
+	.byte	0x29
+	.byte	0x9
+	.long	0x193
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2009
+	.byte	0x13
+	.byte	0x2a
+	.byte	0x9
+	.long	0x193
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF2010
+	.byte	0x13
+	.byte	0x2b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2011
+	.byte	0x13
+	.byte	0x2c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2012
+	.byte	0x13
+	.byte	0x2d
+	.byte	0x3
+	.long	0xc18
+	.uleb128 0xd
+	.long	0xcb5
+	.uleb128 0xf
+	.long	.LASF2013
+	.byte	0x13
+	.byte	0x2f
+	.byte	0x18
+	.long	0xcb5
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x14
+	.byte	0x1a
+	.long	0xcf1
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2017
+	.byte	0x14
+	.byte	0x1e
+	.byte	0x3
+	.long	0xcd2
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x14
+	.byte	0x20
+	.long	0xd63
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2022
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2023
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2026
+	.byte	0x80
+	.uleb128 0xa
+	.long	.LASF2027
+	.value	0x200
+	.uleb128 0xa
+	.long	.LASF2028
+	.value	0x400
+	.uleb128 0xa
+	.long	.LASF2029
+	.value	0x800
+	.uleb128 0xa
+	.long	.LASF2030
+	.value	0x1000
+	.uleb128 0xa
+	.long	.LASF2031
+	.value	0x2000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2032
+	.byte	0x14
+	.byte	0x2f
+	.byte	0x3
+	.long	0xcfd
+	.uleb128 0x6
+	.byte	0x5
+	.long	0x30
+	.byte	0x14
+	.byte	0x47
+	.long	0xdc4
+	.uleb128 0x2f
+	.long	.LASF2033
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2034
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2035
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2036
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2037
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2038
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2040
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2041
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2042
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2043
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2044
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2045
+	.byte	0x14
+	.byte	0x54
+	.byte	0x3
+	.long	0xd6f
+	.uleb128 0x7
+	.long	.LASF2046
+	.byte	0xc
+	.byte	0x14
+	.byte	0x69
+	.byte	0x10
+	.long	0xe2c
+	.uleb128 0x2
+	.long	.LASF2047
+	.byte	0x14
+	.byte	0x6a
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1888
+	.byte	0x14
+	.byte	0x6b
+	.byte	0x1c
+	.long	0xdc4
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2048
+	.byte	0x14
+	.byte	0x6c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2049
+	.byte	0x14
+	.byte	0x6d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2050
+	.byte	0x14
+	.byte	0x6e
+	.byte	0xd
+	.long	0xb7
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2051
+	.byte	0x14
+	.byte	0x6f
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2052
+	.byte	0x14
+	.byte	0x70
+	.byte	0x3
+	.long	0xdd0
+	.uleb128 0xd
+	.long	0xe2c
+	.uleb128 0x7
+	.long	.LASF2053
+	.byte	0x4
+	.byte	0x15
+	.byte	0x4b
+	.byte	0x10
+	.long	0xe65
+	.uleb128 0x2
+	.long	.LASF2054
+	.byte	0x15
+	.byte	0x4c
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2055
+	.byte	0x15
+	.byte	0x4d
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2056
+	.byte	0x15
+	.byte	0x4e
+	.byte	0x3
+	.long	0xe3d
+	.uleb128 0x16
+	.long	0xab
+	.long	0xe81
+	.uleb128 0x17
+	.long	0x29
+	.byte	0x1
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x16
+	.byte	0x23
+	.long	0xed0
+	.uleb128 0x1
+	.long	.LASF2057
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2058
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2059
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2060
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2061
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2063
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2064
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2065
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2066
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2067
+	.byte	0xa
+	.byte	0
+	.uleb128 0x30
+	.byte	0x6
+	.byte	0x17
+	.byte	0x22
+	.byte	0x5
+	.long	0xf01
+	.uleb128 0x2
+	.long	.LASF2068
+	.byte	0x17
+	.byte	0x24
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2069
+	.byte	0x17
+	.byte	0x25
+	.byte	0x11
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x15
+	.string	"yaw"
+	.byte	0x17
+	.byte	0x26
+	.byte	0x11
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x31
+	.byte	0x6
+	.byte	0x17
+	.byte	0x20
+	.byte	0x9
+	.long	0xf23
+	.uleb128 0x20
+	.string	"raw"
+	.byte	0x17
+	.byte	0x21
+	.byte	0xd
+	.long	0x3ef
+	.uleb128 0x32
+	.long	.LASF2070
+	.byte	0x17
+	.byte	0x27
+	.byte	0x7
+	.long	0xed0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2071
+	.byte	0x17
+	.byte	0x28
+	.byte	0x3
+	.long	0xf01
+	.uleb128 0xf
+	.long	.LASF2072
+	.byte	0x17
+	.byte	0x2a
+	.byte	0x1e
+	.long	0xf23
+	.uleb128 0xf
+	.long	.LASF2073
+	.byte	0x18
+	.byte	0x17
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x19
+	.byte	0x1e
+	.long	0xf60
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2075
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2076
+	.byte	0x19
+	.byte	0x21
+	.byte	0x3
+	.long	0xf47
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x19
+	.byte	0x23
+	.long	0xf85
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2079
+	.byte	0x19
+	.byte	0x26
+	.byte	0x3
+	.long	0xf6c
+	.uleb128 0x7
+	.long	.LASF2080
+	.byte	0x1c
+	.byte	0x19
+	.byte	0x28
+	.byte	0x10
+	.long	0x103b
+	.uleb128 0x2
+	.long	.LASF2081
+	.byte	0x19
+	.byte	0x29
+	.byte	0xb
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2082
+	.byte	0x19
+	.byte	0x2a
+	.byte	0xb
+	.long	0xe5
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2083
+	.byte	0x19
+	.byte	0x2b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2084
+	.byte	0x19
+	.byte	0x2c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2085
+	.byte	0x19
+	.byte	0x2d
+	.byte	0xd
+	.long	0xb7
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2086
+	.byte	0x19
+	.byte	0x2e
+	.byte	0x1b
+	.long	0xf60
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2087
+	.byte	0x19
+	.byte	0x2f
+	.byte	0x11
+	.long	0xf85
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2088
+	.byte	0x19
+	.byte	0x30
+	.byte	0xd
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2089
+	.byte	0x19
+	.byte	0x31
+	.byte	0xd
+	.long	0xb7
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2090
+	.byte	0x19
+	.byte	0x32
+	.byte	0xd
+	.long	0xb7
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2091
+	.byte	0x19
+	.byte	0x33
+	.byte	0xd
+	.long	0xb7
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2092
+	.byte	0x19
+	.byte	0x34
+	.byte	0xd
+	.long	0xb7
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2093
+	.byte	0x19
+	.byte	0x35
+	.byte	0x3
+	.long	0xf91
+	.uleb128 0xd
+	.long	0x103b
+	.uleb128 0xf
+	.long	.LASF2094
+	.byte	0x19
+	.byte	0x37
+	.byte	0x1a
+	.long	0x103b
+	.uleb128 0xf
+	.long	.LASF2095
+	.byte	0x19
+	.byte	0x3b
+	.byte	0x16
+	.long	0x7b5
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x45
+	.byte	0x1a
+	.byte	0x14
+	.long	0x107d
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0x1
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2098
+	.byte	0x47
+	.byte	0x16
+	.long	0x7b5
+	.uleb128 0x10
+	.long	.LASF2099
+	.byte	0x48
+	.byte	0x1c
+	.long	0x1093
+	.uleb128 0x5
+	.long	0xe2c
+	.uleb128 0x10
+	.long	.LASF2100
+	.byte	0x4d
+	.byte	0xc
+	.long	0x193
+	.uleb128 0x10
+	.long	.LASF2101
+	.byte	0x4e
+	.byte	0x16
+	.long	0xcf1
+	.uleb128 0x10
+	.long	.LASF2102
+	.byte	0x82
+	.byte	0x11
+	.long	0xd9
+	.uleb128 0x10
+	.long	.LASF2103
+	.byte	0x83
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2104
+	.byte	0x13
+	.byte	0x4c
+	.byte	0x9
+	.long	0xab
+	.uleb128 0x11
+	.long	.LASF2105
+	.byte	0x13
+	.byte	0x45
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2106
+	.byte	0x13
+	.byte	0x4a
+	.byte	0x9
+	.long	0xab
+	.uleb128 0x11
+	.long	.LASF2107
+	.byte	0x13
+	.byte	0x46
+	.byte	0xa
+	.long	0xcd
+	.uleb128 0x12
+	.long	.LASF2111
+	.byte	0x1d
+	.byte	0x1e
+	.byte	0x5
+	.long	0x193
+	.long	0x110a
+	.uleb128 0x3
+	.long	0xd9
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2108
+	.byte	0xb
+	.byte	0xbb
+	.byte	0x12
+	.long	0x9df
+	.uleb128 0x21
+	.long	.LASF1903
+	.byte	0x9
+	.byte	0x74
+	.long	0x112c
+	.uleb128 0x3
+	.long	0x7b5
+	.uleb128 0x3
+	.long	0xb7
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2109
+	.byte	0x13
+	.byte	0x48
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2110
+	.byte	0x1c
+	.byte	0x1d
+	.byte	0xa
+	.long	0xd9
+	.uleb128 0x12
+	.long	.LASF2112
+	.byte	0x19
+	.byte	0x43
+	.byte	0x5
+	.long	0x193
+	.long	0x115a
+	.uleb128 0x3
+	.long	0xcf1
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2113
+	.byte	0x19
+	.byte	0x3e
+	.byte	0x5
+	.long	0x193
+	.long	0x1170
+	.uleb128 0x3
+	.long	0x1170
+	.byte	0
+	.uleb128 0x5
+	.long	0xe38
+	.uleb128 0x12
+	.long	.LASF2114
+	.byte	0x14
+	.byte	0x92
+	.byte	0xf
+	.long	0x7b5
+	.long	0x11a4
+	.uleb128 0x3
+	.long	0xdc4
+	.uleb128 0x3
+	.long	0xd63
+	.uleb128 0x3
+	.long	0x5c8
+	.uleb128 0x3
+	.long	0xd9
+	.uleb128 0x3
+	.long	0x564
+	.uleb128 0x3
+	.long	0x5bc
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2115
+	.byte	0x14
+	.byte	0x9a
+	.long	0x11b5
+	.uleb128 0x3
+	.long	0x7b5
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2116
+	.byte	0x14
+	.byte	0x89
+	.byte	0xf
+	.long	0xcf1
+	.long	0x11d0
+	.uleb128 0x3
+	.long	0x1170
+	.uleb128 0x3
+	.long	0xd63
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2117
+	.byte	0x14
+	.byte	0x86
+	.byte	0x15
+	.long	0x1093
+	.long	0x11e6
+	.uleb128 0x3
+	.long	0xd63
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2118
+	.value	0x1fd
+	.long	0x11fe
+	.uleb128 0x1c
+	.string	"now"
+	.value	0x203
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2119
+	.value	0x1e8
+	.long	0x1218
+	.uleb128 0x1d
+	.uleb128 0x9
+	.long	.LASF2120
+	.value	0x1f0
+	.byte	0xd
+	.long	0x193
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF2121
+	.byte	0x1b
+	.value	0x1e3
+	.byte	0x5
+	.long	0x193
+	.long	0x1236
+	.uleb128 0x18
+	.long	.LASF2141
+	.value	0x1e3
+	.byte	0x40
+	.long	0xd9
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2122
+	.value	0x1d5
+	.uleb128 0x1e
+	.long	.LASF2123
+	.value	0x1ce
+	.uleb128 0x1e
+	.long	.LASF2124
+	.value	0x1c8
+	.uleb128 0x19
+	.long	.LASF2125
+	.value	0x1c0
+	.uleb128 0x19
+	.long	.LASF2126
+	.value	0x1b5
+	.uleb128 0x19
+	.long	.LASF2127
+	.value	0x1af
+	.uleb128 0x13
+	.long	.LASF2131
+	.value	0x197
+	.long	0x1292
+	.uleb128 0x9
+	.long	.LASF2128
+	.value	0x199
+	.byte	0xe
+	.long	0xcd
+	.uleb128 0x1d
+	.uleb128 0x9
+	.long	.LASF2129
+	.value	0x1a1
+	.byte	0x12
+	.long	0xcd
+	.uleb128 0x9
+	.long	.LASF2130
+	.value	0x1a2
+	.byte	0x12
+	.long	0xcd
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2132
+	.value	0x170
+	.long	0x12ce
+	.uleb128 0x9
+	.long	.LASF2133
+	.value	0x172
+	.byte	0x15
+	.long	0xcd
+	.uleb128 0x9
+	.long	.LASF2134
+	.value	0x173
+	.byte	0xe
+	.long	0xd9
+	.uleb128 0x9
+	.long	.LASF2135
+	.value	0x174
+	.byte	0xe
+	.long	0xcd
+	.uleb128 0x9
+	.long	.LASF2136
+	.value	0x176
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2137
+	.value	0x164
+	.uleb128 0x13
+	.long	.LASF2138
+	.value	0x13a
+	.long	0x12ed
+	.uleb128 0x9
+	.long	.LASF2139
+	.value	0x13d
+	.byte	0xd
+	.long	0xe71
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2140
+	.value	0x126
+	.long	0x1311
+	.uleb128 0x18
+	.long	.LASF2139
+	.value	0x126
+	.byte	0x21
+	.long	0xaef
+	.uleb128 0x9
+	.long	.LASF2142
+	.value	0x128
+	.byte	0x1e
+	.long	0xe65
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2143
+	.value	0x115
+	.long	0x1359
+	.uleb128 0x18
+	.long	.LASF2144
+	.value	0x115
+	.byte	0x25
+	.long	0xab
+	.uleb128 0x18
+	.long	.LASF2145
+	.value	0x115
+	.byte	0x48
+	.long	0x1359
+	.uleb128 0x9
+	.long	.LASF2146
+	.value	0x117
+	.byte	0xd
+	.long	0xab
+	.uleb128 0x1c
+	.string	"deg"
+	.value	0x117
+	.byte	0x15
+	.long	0xab
+	.uleb128 0x1c
+	.string	"min"
+	.value	0x117
+	.byte	0x1a
+	.long	0xab
+	.byte	0
+	.uleb128 0x5
+	.long	0xe65
+	.uleb128 0x13
+	.long	.LASF2147
+	.value	0x107
+	.long	0x1382
+	.uleb128 0x9
+	.long	.LASF2148
+	.value	0x109
+	.byte	0xe
+	.long	0xd9
+	.uleb128 0x9
+	.long	.LASF2149
+	.value	0x10a
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2150
+	.byte	0xd9
+	.uleb128 0x14
+	.long	.LASF2151
+	.byte	0xc6
+	.long	0x13ab
+	.uleb128 0x1d
+	.uleb128 0x10
+	.long	.LASF2152
+	.byte	0xce
+	.byte	0x20
+	.long	0x9eb
+	.uleb128 0x10
+	.long	.LASF2153
+	.byte	0xcf
+	.byte	0x12
+	.long	0xcd
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2154
+	.byte	0xaf
+	.uleb128 0x14
+	.long	.LASF2155
+	.byte	0xa5
+	.long	0x13c5
+	.uleb128 0x23
+	.string	"i"
+	.byte	0xa7
+	.byte	0x9
+	.long	0x30
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2156
+	.byte	0x9c
+	.long	0x13e3
+	.uleb128 0x1a
+	.string	"a"
+	.byte	0x1b
+	.byte	0x9c
+	.byte	0x21
+	.long	0x9f
+	.uleb128 0x23
+	.string	"t"
+	.byte	0x9e
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2157
+	.byte	0x8f
+	.long	0x13fa
+	.uleb128 0x24
+	.long	.LASF2158
+	.byte	0x1b
+	.byte	0x8f
+	.byte	0x24
+	.long	0xb7
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2159
+	.byte	0x8a
+	.uleb128 0x14
+	.long	.LASF2160
+	.byte	0x84
+	.long	0x1416
+	.uleb128 0x1a
+	.string	"id"
+	.byte	0x1b
+	.byte	0x84
+	.byte	0x22
+	.long	0xb7
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2161
+	.byte	0x19
+	.byte	0x37
+	.byte	0x59
+	.long	0x1422
+	.uleb128 0x5
+	.long	0x1047
+	.uleb128 0x25
+	.long	.LASF2162
+	.byte	0x13
+	.byte	0x2f
+	.byte	0x53
+	.long	0x1433
+	.uleb128 0x5
+	.long	0xcc1
+	.uleb128 0x34
+	.long	.LASF2163
+	.byte	0x1e
+	.byte	0x7e
+	.byte	0x13
+	.long	0x30
+	.uleb128 0x1a
+	.string	"amt"
+	.byte	0x1e
+	.byte	0x7e
+	.byte	0x21
+	.long	0x30
+	.uleb128 0x1a
+	.string	"low"
+	.byte	0x1e
+	.byte	0x7e
+	.byte	0x2a
+	.long	0x30
+	.uleb128 0x24
+	.long	.LASF2164
+	.byte	0x1e
+	.byte	0x7e
+	.byte	0x33
+	.long	0x30
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 31 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 32 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x22
+	.file 35 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF461
+	.file 37 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 38 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x26
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF540
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.file 41 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF633
+	.file 43 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x2b
+	.file 44 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF656
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF540
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF716
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF720
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF721
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF817
+	.byte	0x4
+	.file 48 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x30
+	.file 49 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 50 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x32
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 51 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x33
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 52 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 53 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x35
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1d
+	.file 54 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x36
+	.file 55 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 56 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x6
+	.file 57 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x9
+	.file 58 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3a
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 59 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 60 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1583
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xa
+	.file 61 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3d
+	.byte	0x4
+	.file 62 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3e
+	.byte	0x4
+	.file 63 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 64 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x40
+	.byte	0x4
+	.file 65 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 66 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1589
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0xe
+	.byte	0x4
+	.file 67 "./src/main/sensors/gyro.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x43
+	.file 68 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1628
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1629
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1630
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x13
+	.file 69 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1631
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.file 70 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x12
+	.file 71 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1636
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 72 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x48
+	.file 73 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x49
+	.file 74 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4a
+	.file 75 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x18
+	.byte	0x4
+	.file 76 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1701
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1744
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF460
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF478
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF481
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF483
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF484
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF485
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF486
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF495
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF505
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF517
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF530
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF534
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF536
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF553
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF612
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF713
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF719
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF816
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF908
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF961
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF980
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF986
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1009
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1093
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1183
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1192
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1194
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1214
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1582
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1588
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1615
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1635
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1645
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1653
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.8362794d947c339e17997ec0162d97db,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1662
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1672
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1700
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF2166
+	.long	.LASF2167
+	.long	.LASF2168
+	.long	.LASF2169
+	.long	.LASF2170
+	.long	.LASF2171
+	.long	.LASF2172
+	.long	.LASF2173
+	.long	.LASF2174
+	.long	.LASF2175
+	.long	.LASF2176
+	.long	.LASF2177
+	.long	.LASF2178
+	.long	.LASF2179
+	.long	.LASF2180
+	.long	.LASF2181
+	.long	.LASF2182
+	.long	.LASF2183
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2184
+	.byte	0xe
+	.long	.LASF2185
+	.byte	0xe
+	.long	.LASF2186
+	.byte	0xe
+	.long	.LASF2187
+	.byte	0x4
+	.long	.LASF2188
+	.byte	0x4
+	.long	.LASF2189
+	.byte	0x4
+	.long	.LASF2190
+	.byte	0x4
+	.long	.LASF2191
+	.byte	0x4
+	.long	.LASF2192
+	.byte	0x4
+	.long	.LASF2193
+	.byte	0x5
+	.long	.LASF2194
+	.byte	0x5
+	.long	.LASF2195
+	.byte	0x5
+	.long	.LASF2196
+	.byte	0x9
+	.long	.LASF2197
+	.byte	0x9
+	.long	.LASF2198
+	.byte	0x4
+	.long	.LASF2198
+	.byte	0x9
+	.long	.LASF2199
+	.byte	0x9
+	.long	.LASF2200
+	.byte	0x9
+	.long	.LASF2201
+	.byte	0x9
+	.long	.LASF2192
+	.byte	0x7
+	.long	.LASF2202
+	.byte	0x7
+	.long	.LASF2203
+	.byte	0x6
+	.long	.LASF2204
+	.byte	0x6
+	.long	.LASF2205
+	.byte	0x6
+	.long	.LASF2206
+	.byte	0xc
+	.long	.LASF2207
+	.byte	0xc
+	.long	.LASF2208
+	.byte	0xc
+	.long	.LASF2209
+	.byte	0x4
+	.long	.LASF2210
+	.byte	0x3
+	.long	.LASF2211
+	.byte	0x2
+	.long	.LASF2212
+	.byte	0x11
+	.long	.LASF2213
+	.byte	0x12
+	.long	.LASF2214
+	.byte	0x12
+	.long	.LASF2215
+	.byte	0x12
+	.long	.LASF2215
+	.byte	0x11
+	.long	.LASF2216
+	.byte	0xe
+	.long	.LASF2217
+	.byte	0x11
+	.long	.LASF2218
+	.byte	0x11
+	.long	.LASF2219
+	.byte	0xe
+	.long	.LASF2220
+	.byte	0xe
+	.long	.LASF2221
+	.byte	0x10
+	.long	.LASF2222
+	.byte	0xe
+	.long	.LASF2223
+	.byte	0xf
+	.long	.LASF2224
+	.byte	0xf
+	.long	.LASF2225
+	.byte	0xe
+	.long	.LASF2226
+	.byte	0xe
+	.long	.LASF2227
+	.byte	0xe
+	.long	.LASF2228
+	.byte	0xd
+	.long	.LASF2229
+	.byte	0xb
+	.long	.LASF2230
+	.byte	0xa
+	.long	.LASF2231
+	.byte	0xb
+	.long	.LASF2232
+	.byte	0x2
+	.long	.LASF2233
+	.byte	0x2
+	.long	.LASF2234
+	.byte	0x3
+	.long	.LASF2235
+	.byte	0x1
+	.long	.LASF2236
+	.byte	0x3
+	.long	.LASF2237
+	.byte	0x4
+	.long	.LASF2238
+	.byte	0x4
+	.long	.LASF2239
+	.byte	0x4
+	.long	.LASF2240
+	.byte	0x4
+	.long	.LASF2241
+	.byte	0x4
+	.long	.LASF2242
+	.byte	0x4
+	.long	.LASF2243
+	.byte	0x4
+	.long	.LASF2244
+	.byte	0x4
+	.long	.LASF2245
+	.byte	0x4
+	.long	.LASF2246
+	.byte	0x4
+	.long	.LASF2247
+	.byte	0x9
+	.long	.LASF2248
+	.byte	0x2
+	.long	.LASF2249
+	.byte	0x2
+	.long	.LASF2250
+	.byte	0x9
+	.long	.LASF2251
+	.byte	0x9
+	.long	.LASF2252
+	.byte	0x6
+	.long	.LASF2253
+	.byte	0x4
+	.long	.LASF2254
+	.byte	0x4
+	.long	.LASF2255
+	.byte	0x4
+	.long	.LASF2256
+	.byte	0x8
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1574:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1596:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF794:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1608:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1210:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1293:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2121:
+	.string	"hasEnoughTimeLapsedSinceLastTelemetryTransmission"
+.LASF1621:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1793:
+	.string	"mpuConfiguration_s"
+.LASF1800:
+	.string	"mpuConfiguration_t"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF876:
+	.string	"USE_FAKE_BARO "
+.LASF948:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1304:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF547:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1946:
+	.string	"THROTTLE"
+.LASF1743:
+	.string	"DELAY_FOR_BARO_INITIALISATION (5 * 1000)"
+.LASF2058:
+	.string	"PIDPITCH"
+.LASF441:
+	.string	"_WCHAR_T_DEFINED "
+.LASF857:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF802:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF555:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1089:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF517:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1935:
+	.string	"FEATURE_TRANSPONDER"
+.LASF946:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1985:
+	.string	"baro_s"
+.LASF1988:
+	.string	"baro_t"
+.LASF885:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF460:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF2109:
+	.string	"getBatteryCellCount"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF663:
+	.string	"__SQUAD_TYPE long int"
+.LASF889:
+	.string	"USE_PPM"
+.LASF1348:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1909:
+	.string	"setMode"
+.LASF1809:
+	.string	"ICM_20602_SPI"
+.LASF1983:
+	.string	"calculate"
+.LASF1578:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF830:
+	.string	"USE_SERIALRX_CRSF "
+.LASF799:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1477:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF995:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1123:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF987:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF582:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1216:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF606:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1751:
+	.string	"__uint8_t"
+.LASF717:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1887:
+	.string	"vTable"
+.LASF1612:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1478:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1776:
+	.string	"_Bool"
+.LASF2135:
+	.string	"payload"
+.LASF617:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1654:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF869:
+	.string	"U_ID_2 2"
+.LASF2139:
+	.string	"coord"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1195:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF852:
+	.string	"TELEMETRY_SRXL "
+.LASF559:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2149:
+	.string	"minutes"
+.LASF1830:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF599:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1565:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1228:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1430:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1538:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2057:
+	.string	"PIDROLL"
+.LASF1611:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF973:
+	.string	"BIT(x) (1 << (x))"
+.LASF1365:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF546:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1189:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF993:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF1874:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1771:
+	.string	"CW90_DEG_FLIP"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1267:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1217:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF2098:
+	.string	"frskyPort"
+.LASF1501:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2021:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1773:
+	.string	"CW270_DEG_FLIP"
+.LASF1311:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1619:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1206:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF433:
+	.string	"__WCHAR_T__ "
+.LASF1299:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF858:
+	.string	"USE_SENSOR_NAMES "
+.LASF1570:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1055:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1664:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1047:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF2064:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1782:
+	.string	"read"
+.LASF1280:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1175:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF1517:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1414:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1011:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1827:
+	.string	"OWNER_LED"
+.LASF580:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1577:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2122:
+	.string	"configureFrSkyTelemetryPort"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1925:
+	.string	"FEATURE_TELEMETRY"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1798:
+	.string	"resetFn"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1761:
+	.string	"uint16_t"
+.LASF1270:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1580:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF713:
+	.string	"__FD_SETSIZE 1024"
+.LASF671:
+	.string	"__STD_TYPE typedef"
+.LASF2097:
+	.string	"FRSKY_VFAS_PRECISION_HIGH"
+.LASF1032:
+	.string	"PG_RX_CONFIG 24"
+.LASF2028:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1509:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF561:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1488:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF841:
+	.string	"TELEMETRY_HOTT "
+.LASF708:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF999:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1441:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1277:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF494:
+	.string	"_ISOC95_SOURCE"
+.LASF1203:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF403:
+	.string	"_T_PTRDIFF_ "
+.LASF1515:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1163:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF751:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1282:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF660:
+	.string	"__U32_TYPE unsigned int"
+.LASF1682:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1390:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1100:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1043:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1356:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF701:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF770:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF629:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1547:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF2123:
+	.string	"freeFrSkyTelemetryPort"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1343:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1715:
+	.string	"ID_ALTITUDE_AP 0x21"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2131:
+	.string	"sendVoltageAmp"
+.LASF976:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1426:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1732:
+	.string	"ID_ACC_Z 0x26"
+.LASF432:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1413:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1085:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1337:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF472:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1832:
+	.string	"OWNER_ADC_RSSI"
+.LASF1592:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1533:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF949:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1695:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF2125:
+	.string	"sendHeading"
+.LASF618:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1410:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF680:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2066:
+	.string	"PIDVEL"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1393:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1051:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1138:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1589:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1541:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1569:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1834:
+	.string	"OWNER_SERIAL_RX"
+.LASF709:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2023:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1237:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF424:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF807:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF1859:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1584:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1896:
+	.string	"rxBufferHead"
+.LASF755:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1245:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF897:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1454:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF694:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1759:
+	.string	"int32_t"
+.LASF2047:
+	.string	"functionMask"
+.LASF1396:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF557:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1520:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF944:
+	.string	"FAST_MATH "
+.LASF875:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1911:
+	.string	"beginWrite"
+.LASF936:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF1652:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF1156:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF1148:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF443:
+	.string	"___int_wchar_t_h "
+.LASF1545:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1491:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1663:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF463:
+	.string	"__USE_ISOC11"
+.LASF967:
+	.string	"STR_HELPER(x) #x"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2095:
+	.string	"telemetrySharedPort"
+.LASF1734:
+	.string	"ID_VOLTAGE_AMP_BP 0x3A"
+.LASF2140:
+	.string	"sendLatLong"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1618:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF914:
+	.string	"VTX_TRAMP"
+.LASF455:
+	.string	"bool _Bool"
+.LASF628:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1856:
+	.string	"OWNER_BARO_EXTI"
+.LASF1028:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1184:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF754:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1796:
+	.string	"slowreadFn"
+.LASF601:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF810:
+	.string	"INTMAX_WIDTH 64"
+.LASF1869:
+	.string	"MODE_RX"
+.LASF536:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF890:
+	.string	"USE_PWM"
+.LASF811:
+	.string	"UINTMAX_WIDTH 64"
+.LASF2070:
+	.string	"values"
+.LASF725:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1328:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1833:
+	.string	"OWNER_SERIAL_TX"
+.LASF634:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1048:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF718:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1097:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1061:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1062:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1315:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1914:
+	.string	"setRxFrameCallback"
+.LASF747:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF911:
+	.string	"VTX_COMMON"
+.LASF690:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF854:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF584:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1308:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1528:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF417:
+	.string	"_T_SIZE_ "
+.LASF1661:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1729:
+	.string	"ID_SECOND 0x18"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1431:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1969:
+	.string	"acc_s"
+.LASF1973:
+	.string	"acc_t"
+.LASF968:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1923:
+	.string	"FEATURE_FAILSAFE"
+.LASF1706:
+	.string	"PROTOCOL_TAIL 0x5E"
+.LASF1999:
+	.string	"voltageMeterSource_e"
+.LASF853:
+	.string	"USE_DASHBOARD "
+.LASF530:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1134:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1471:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF635:
+	.string	"__stub_chflags "
+.LASF1602:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF2065:
+	.string	"PIDMAG"
+.LASF2119:
+	.string	"checkFrSkyTelemetryState"
+.LASF1857:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1784:
+	.string	"ADCRaw"
+.LASF1079:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF1722:
+	.string	"ID_LATITUDE_AP 0x1B"
+.LASF457:
+	.string	"false 0"
+.LASF1868:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF774:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2144:
+	.string	"mwiigps"
+.LASF428:
+	.string	"_GCC_SIZE_T "
+.LASF639:
+	.string	"__stub_setlogin "
+.LASF1388:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1870:
+	.string	"MODE_TX"
+.LASF496:
+	.string	"_ISOC99_SOURCE"
+.LASF815:
+	.string	"WCHAR_WIDTH 32"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF641:
+	.string	"__stub_stty "
+.LASF1103:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF1640:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1003:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1519:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1770:
+	.string	"CW0_DEG_FLIP"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1617:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF776:
+	.string	"INT32_C(c) c"
+.LASF1186:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1735:
+	.string	"ID_VOLTAGE_AMP_AP 0x3B"
+.LASF1453:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1941:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF1789:
+	.string	"sensorAccReadFuncPtr"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1648:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF483:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1927:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF1801:
+	.string	"MPU_NONE"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2055:
+	.string	"mmmm"
+.LASF2004:
+	.string	"batteryNotPresentLevel"
+.LASF1838:
+	.string	"OWNER_SONAR_ECHO"
+.LASF905:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF613:
+	.string	"__attribute_copy__"
+.LASF1494:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1364:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1924:
+	.string	"FEATURE_SONAR"
+.LASF545:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1689:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1040:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF672:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1083:
+	.string	"PG_VTX_CONFIG 515"
+.LASF990:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1826:
+	.string	"OWNER_SERVO"
+.LASF975:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF873:
+	.string	"ACC "
+.LASF1816:
+	.string	"mpu6050Resolution_e"
+.LASF2062:
+	.string	"PIDPOSR"
+.LASF594:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF849:
+	.string	"TELEMETRY_IBUS "
+.LASF828:
+	.string	"USE_PWM "
+.LASF1524:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1182:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF1544:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1649:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF654:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1235:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1320:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1117:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF989:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1227:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1350:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1238:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1112:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1424:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF2096:
+	.string	"FRSKY_VFAS_PRECISION_LOW"
+.LASF1766:
+	.string	"CW0_DEG"
+.LASF2068:
+	.string	"roll"
+.LASF409:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1005:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1243:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF756:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1310:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1673:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1752:
+	.string	"__int16_t"
+.LASF773:
+	.string	"WINT_MAX (4294967295u)"
+.LASF577:
+	.string	"__flexarr []"
+.LASF1754:
+	.string	"__uint16_t"
+.LASF1604:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF1892:
+	.string	"rxBufferSize"
+.LASF1825:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1327:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF929:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1332:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2026:
+	.string	"FUNCTION_BLACKBOX"
+.LASF953:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF522:
+	.string	"__USE_POSIX 1"
+.LASF1171:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF467:
+	.string	"__USE_POSIX"
+.LASF1853:
+	.string	"OWNER_RX_SPI_CS"
+.LASF444:
+	.string	"__INT_WCHAR_T_H "
+.LASF1769:
+	.string	"CW270_DEG"
+.LASF740:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1593:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1360:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2081:
+	.string	"gpsNoFixLatitude"
+.LASF1215:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF625:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1129:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF502:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1898:
+	.string	"txBufferHead"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1936:
+	.string	"FEATURE_AIRMODE"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1248:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1889:
+	.string	"mode"
+.LASF1246:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1193:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF454:
+	.string	"_STDBOOL_H "
+.LASF1537:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2076:
+	.string	"frskyGpsCoordFormat_e"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF942:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1174:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF1955:
+	.string	"THROTTLE_LOW"
+.LASF644:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF611:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1966:
+	.string	"SENSOR_INDEX_BARO"
+.LASF986:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1965:
+	.string	"SENSOR_INDEX_ACC"
+.LASF1719:
+	.string	"ID_LONGITUDE_AP 0x1A"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF958:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1352:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF650:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2090:
+	.string	"hottAlarmSoundInterval"
+.LASF1363:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1657:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF966:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF2164:
+	.string	"high"
+.LASF1084:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF574:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1778:
+	.string	"deviceSpi_s"
+.LASF1292:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1223:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1529:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF2022:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1747:
+	.string	"unsigned char"
+.LASF721:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1236:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF748:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1919:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF626:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1918:
+	.string	"FEATURE_RX_SERIAL"
+.LASF1090:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1093:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF752:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF410:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1312:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1497:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1557:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1428:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1041:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1443:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1024:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1599:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1160:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1763:
+	.string	"float"
+.LASF1276:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1019:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF465:
+	.string	"__USE_ISOC95"
+.LASF2001:
+	.string	"vbatmaxcellvoltage"
+.LASF464:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1534:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1516:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF775:
+	.string	"INT16_C(c) c"
+.LASF1114:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF1910:
+	.string	"writeBuf"
+.LASF2011:
+	.string	"vbathysteresis"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF855:
+	.string	"USE_MSP_PUSH "
+.LASF1737:
+	.string	"ID_GYRO_X 0x40"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2031:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1197:
+	.string	"IOCFG_OUT_OD 0"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF720:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF850:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF402:
+	.string	"_PTRDIFF_T "
+.LASF919:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1125:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF622:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2007:
+	.string	"batteryCapacity"
+.LASF474:
+	.string	"__USE_XOPEN2K"
+.LASF1284:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1921:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF981:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2105:
+	.string	"calculateBatteryPercentageRemaining"
+.LASF1912:
+	.string	"endWrite"
+.LASF2018:
+	.string	"FUNCTION_NONE"
+.LASF562:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1118:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1765:
+	.string	"ALIGN_DEFAULT"
+.LASF959:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1056:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF512:
+	.string	"_DEFAULT_SOURCE"
+.LASF1289:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF845:
+	.string	"USE_SERVOS "
+.LASF380:
+	.string	"__unix 1"
+.LASF1457:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1247:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1001:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF743:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1550:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1742:
+	.string	"GPS_MAX_HDOP_VAL 9999"
+.LASF1651:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF1865:
+	.string	"OWNER_VTX"
+.LASF600:
+	.string	"__wur "
+.LASF838:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1813:
+	.string	"mpuSensor_e"
+.LASF1064:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF563:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1158:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1452:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1947:
+	.string	"AUX1"
+.LASF1948:
+	.string	"AUX2"
+.LASF1949:
+	.string	"AUX3"
+.LASF1950:
+	.string	"AUX4"
+.LASF1951:
+	.string	"AUX5"
+.LASF1952:
+	.string	"AUX6"
+.LASF1953:
+	.string	"AUX7"
+.LASF1954:
+	.string	"AUX8"
+.LASF1026:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1714:
+	.string	"ID_ALTITUDE_BP 0x10"
+.LASF1997:
+	.string	"VOLTAGE_METER_ADC"
+.LASF1377:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1634:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1781:
+	.string	"init"
+.LASF1993:
+	.string	"CURRENT_METER_ESC"
+.LASF440:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1355:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF682:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1444:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF836:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1803:
+	.string	"MPU_60x0"
+.LASF1423:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1847:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF795:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF843:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1540:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1713:
+	.string	"ID_VOLT 0x06"
+.LASF1094:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1234:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF722:
+	.string	"__intptr_t_defined "
+.LASF800:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF730:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF741:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2103:
+	.string	"cycleNum"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1329:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1201:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF573:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF664:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1405:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1321:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1685:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF637:
+	.string	"__stub_gtty "
+.LASF1787:
+	.string	"mpuDetectionResult"
+.LASF1115:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1239:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1176:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF1938:
+	.string	"FEATURE_VTX"
+.LASF1995:
+	.string	"currentMeterSource_e"
+.LASF1466:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1804:
+	.string	"MPU_60x0_SPI"
+.LASF758:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1358:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1439:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1609:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1726:
+	.string	"ID_DATE_MONTH 0x15"
+.LASF442:
+	.string	"_WCHAR_T_H "
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1907:
+	.string	"serialSetBaudRate"
+.LASF706:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF511:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2008:
+	.string	"useVBatAlerts"
+.LASF1906:
+	.string	"serialRead"
+.LASF1560:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF2099:
+	.string	"portConfig"
+.LASF624:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1489:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2138:
+	.string	"sendFakeLatLongThatAllowsHeadingDisplay"
+.LASF1046:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF825:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF780:
+	.string	"UINT32_C(c) c ## U"
+.LASF2005:
+	.string	"voltageMeterSource"
+.LASF1900:
+	.string	"rxCallback"
+.LASF484:
+	.string	"__USE_GNU"
+.LASF1572:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF734:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2080:
+	.string	"telemetryConfig_s"
+.LASF2093:
+	.string	"telemetryConfig_t"
+.LASF2049:
+	.string	"gps_baudrateIndex"
+.LASF1081:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1187:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1226:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2053:
+	.string	"gpsCoordinateDDDMMmmmm_s"
+.LASF2056:
+	.string	"gpsCoordinateDDDMMmmmm_t"
+.LASF925:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2059:
+	.string	"PIDYAW"
+.LASF1894:
+	.string	"rxBuffer"
+.LASF2155:
+	.string	"sendAccel"
+.LASF1707:
+	.string	"ID_GPS_ALTIDUTE_BP 0x01"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1893:
+	.string	"txBufferSize"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1878:
+	.string	"SERIAL_PARITY_NO"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF486:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF670:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1777:
+	.string	"sensorAccInitFuncPtr"
+.LASF714:
+	.string	"_BITS_TIME64_H 1"
+.LASF1096:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF753:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1325:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1133:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF1693:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF1957:
+	.string	"throttleStatus_e"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF586:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1858:
+	.string	"OWNER_USB_DETECT"
+.LASF1240:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1434:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1411:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1487:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1150:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1194:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1137:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF479:
+	.string	"__USE_LARGEFILE64"
+.LASF1375:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF602:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1066:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF543:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF658:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1705:
+	.string	"PROTOCOL_HEADER 0x5E"
+.LASF1795:
+	.string	"writeFn"
+.LASF597:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1996:
+	.string	"VOLTAGE_METER_NONE"
+.LASF864:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1159:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF587:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF2089:
+	.string	"frsky_vfas_cell_voltage"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1380:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1986:
+	.string	"BaroAlt"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2092:
+	.string	"report_cell_voltage"
+.LASF1684:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF2141:
+	.string	"currentMillis"
+.LASF1385:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF490:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF458:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1564:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1931:
+	.string	"FEATURE_DASHBOARD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF427:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1698:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1249:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF422:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1862:
+	.string	"OWNER_INVERTER"
+.LASF908:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1389:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1842:
+	.string	"OWNER_SPI_MOSI"
+.LASF1340:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1543:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1888:
+	.string	"identifier"
+.LASF1760:
+	.string	"uint8_t"
+.LASF1288:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF636:
+	.string	"__stub_fchflags "
+.LASF2077:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1346:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF2091:
+	.string	"pidValuesAsTelemetry"
+.LASF662:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF943:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF979:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF918:
+	.string	"USE_DSHOT"
+.LASF1392:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF790:
+	.string	"INT64_WIDTH 64"
+.LASF970:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1967:
+	.string	"SENSOR_INDEX_MAG"
+.LASF839:
+	.string	"TELEMETRY "
+.LASF1960:
+	.string	"ARMED"
+.LASF1060:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1135:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1395:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF493:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1945:
+	.string	"PITCH"
+.LASF945:
+	.string	"VERY_FAST_MATH "
+.LASF1566:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1092:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF2085:
+	.string	"sportHalfDuplex"
+.LASF2088:
+	.string	"frsky_vfas_precision"
+.LASF445:
+	.string	"_GCC_WCHAR_T "
+.LASF614:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1136:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF675:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF903:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1088:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF666:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF733:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF621:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1482:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1775:
+	.string	"busDevice_t"
+.LASF382:
+	.string	"unix 1"
+.LASF1401:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1917:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF1287:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1536:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF520:
+	.string	"__USE_ISOC99 1"
+.LASF448:
+	.string	"_BSD_WCHAR_T_"
+.LASF1403:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF643:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1970:
+	.string	"accSamplingInterval"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1306:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF847:
+	.string	"CMS "
+.LASF620:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF420:
+	.string	"_SIZE_T_ "
+.LASF1855:
+	.string	"OWNER_MPU_EXTI"
+.LASF1601:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF2100:
+	.string	"frskyTelemetryEnabled"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1730:
+	.string	"ID_ACC_X 0x24"
+.LASF1668:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF1209:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF431:
+	.string	"__need_size_t"
+.LASF1824:
+	.string	"OWNER_PPMINPUT"
+.LASF2038:
+	.string	"SERIAL_PORT_UART5"
+.LASF2032:
+	.string	"serialPortFunction_e"
+.LASF533:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF806:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF819:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1647:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF604:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF972:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1556:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1049:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1044:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF399:
+	.string	"_STDDEF_H "
+.LASF1499:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF2118:
+	.string	"handleFrSkyTelemetry"
+.LASF768:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF497:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1192:
+	.string	"GYRO_LPF_NONE 7"
+.LASF1151:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF1667:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF1594:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1496:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1514:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2013:
+	.string	"batteryConfig_System"
+.LASF1339:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1987:
+	.string	"baroTemperature"
+.LASF685:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF783:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF473:
+	.string	"__USE_UNIX98"
+.LASF1627:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF1638:
+	.string	"LON 1"
+.LASF673:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1674:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1436:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF534:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1525:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1172:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1069:
+	.string	"PG_OSD_CONFIG 501"
+.LASF566:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1034:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF998:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF910:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1255:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1811:
+	.string	"ICM_20689_SPI"
+.LASF1982:
+	.string	"get_up"
+.LASF1039:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1700:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1980:
+	.string	"get_ut"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF668:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1875:
+	.string	"SERIAL_INVERTED"
+.LASF1278:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1723:
+	.string	"ID_N_S 0x23"
+.LASF425:
+	.string	"_SIZE_T_DECLARED "
+.LASF2075:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1324:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1975:
+	.string	"baroCalculateFuncPtr"
+.LASF1302:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF735:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF710:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF605:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1492:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1082:
+	.string	"PG_VCD_CONFIG 514"
+.LASF900:
+	.string	"LED_STRIP"
+.LASF1473:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF823:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF781:
+	.string	"UINT64_C(c) c ## UL"
+.LASF541:
+	.string	"__USE_MISC 1"
+.LASF1677:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF2113:
+	.string	"telemetryCheckRxPortShared"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF736:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF803:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1518:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1274:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1741:
+	.string	"GPS_BAD_QUALITY 300"
+.LASF1258:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1349:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF544:
+	.string	"__USE_GNU 1"
+.LASF896:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1934:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF1659:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1191:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1384:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1653:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF866:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1335:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF840:
+	.string	"TELEMETRY_FRSKY "
+.LASF1213:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1460:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__GNU_LIBRARY__"
+.LASF1098:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1080:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF542:
+	.string	"__USE_ATFILE 1"
+.LASF1521:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1837:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF2029:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF997:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF957:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1512:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1484:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1371:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1458:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1362:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2024:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1597:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF895:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1427:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF796:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2010:
+	.string	"consumptionWarningPercentage"
+.LASF1261:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF581:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF501:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1701:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF1007:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1294:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF728:
+	.string	"INT16_MAX (32767)"
+.LASF1404:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF2094:
+	.string	"telemetryConfig_System"
+.LASF1937:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF696:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1939:
+	.string	"FEATURE_RX_SPI"
+.LASF2126:
+	.string	"sendFuelLevel"
+.LASF2069:
+	.string	"pitch"
+.LASF1839:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF687:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF2137:
+	.string	"sendVario"
+.LASF554:
+	.string	"__PMT"
+.LASF2050:
+	.string	"blackbox_baudrateIndex"
+.LASF446:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2083:
+	.string	"telemetry_switch"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF789:
+	.string	"UINT32_WIDTH 32"
+.LASF2051:
+	.string	"telemetry_baudrateIndex"
+.LASF917:
+	.string	"USE_SERVOS"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2117:
+	.string	"findSerialPortConfig"
+.LASF962:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1119:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF1805:
+	.string	"MPU_65xx_I2C"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1058:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF822:
+	.string	"I2C2_OVERCLOCK true"
+.LASF2108:
+	.string	"calculateThrottleStatus"
+.LASF1708:
+	.string	"ID_GPS_ALTIDUTE_AP 0x09"
+.LASF2019:
+	.string	"FUNCTION_MSP"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1963:
+	.string	"armingFlags"
+.LASF782:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1442:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF590:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1361:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1359:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1016:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1286:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1620:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1416:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF607:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1250:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1330:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF509:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1631:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1656:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF434:
+	.string	"_WCHAR_T "
+.LASF1104:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF661:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF984:
+	.string	"UNIT_TESTED "
+.LASF2111:
+	.string	"feature"
+.LASF1015:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1407:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2030:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF762:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1971:
+	.string	"accSmooth"
+.LASF927:
+	.string	"USED_TIMERS 0"
+.LASF749:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF729:
+	.string	"INT32_MAX (2147483647)"
+.LASF1940:
+	.string	"FEATURE_SOFTSPI"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1792:
+	.string	"mpuResetFnPtr"
+.LASF1703:
+	.string	"FRSKY_INITIAL_PORT_MODE MODE_TX"
+.LASF1650:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF1368:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1009:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF931:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1420:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF2165:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF564:
+	.string	"__P(args) args"
+.LASF1606:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF761:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF994:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF739:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF818:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF416:
+	.string	"_SYS_SIZE_T_H "
+.LASF686:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF816:
+	.string	"WINT_WIDTH 32"
+.LASF1253:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1672:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1241:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF698:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1219:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF2145:
+	.string	"result"
+.LASF1530:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2133:
+	.string	"currentCell"
+.LASF1127:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF485:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2084:
+	.string	"telemetry_inversion"
+.LASF833:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1351:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1303:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1645:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1461:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1626:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF697:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF727:
+	.string	"INT8_MAX (127)"
+.LASF1254:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF476:
+	.string	"__USE_XOPEN2K8"
+.LASF769:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1010:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF2120:
+	.string	"newTelemetryEnabledValue"
+.LASF452:
+	.string	"__need_NULL"
+.LASF453:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1256:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1962:
+	.string	"rcCommand"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1251:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF489:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF539:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF470:
+	.string	"__USE_POSIX199506"
+.LASF478:
+	.string	"__USE_LARGEFILE"
+.LASF1502:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF665:
+	.string	"__SWORD_TYPE long int"
+.LASF827:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1232:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1991:
+	.string	"CURRENT_METER_ADC"
+.LASF1871:
+	.string	"MODE_RXTX"
+.LASF899:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF2015:
+	.string	"PORTSHARING_NOT_SHARED"
+.LASF1170:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF524:
+	.string	"__USE_POSIX199309 1"
+.LASF1143:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF926:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF2161:
+	.string	"telemetryConfig"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF715:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1961:
+	.string	"WAS_EVER_ARMED"
+.LASF1790:
+	.string	"mpuReadRegisterFnPtr"
+.LASF902:
+	.string	"TELEMETRY_HOTT"
+.LASF745:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1017:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF952:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF498:
+	.string	"_ISOC11_SOURCE"
+.LASF1317:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF570:
+	.string	"__END_DECLS "
+.LASF1586:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF963:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1845:
+	.string	"OWNER_SDCARD"
+.LASF1322:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1712:
+	.string	"ID_TEMPRATURE2 0x05"
+.LASF1739:
+	.string	"ID_GYRO_Z 0x42"
+.LASF578:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1144:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF1475:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1101:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1561:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF683:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1057:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1183:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF2150:
+	.string	"sendTemperature1"
+.LASF450:
+	.string	"NULL"
+.LASF1758:
+	.string	"int16_t"
+.LASF1259:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1408:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1748:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1369:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1750:
+	.string	"signed char"
+.LASF988:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1309:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1490:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1709:
+	.string	"ID_TEMPRATURE1 0x02"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF413:
+	.string	"__size_t__ "
+.LASF817:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF526:
+	.string	"__USE_XOPEN2K 1"
+.LASF844:
+	.string	"USE_RESOURCE_MGMT "
+.LASF2151:
+	.string	"sendThrottleOrBatterySizeAsRpm"
+.LASF1272:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1558:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1526:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1252:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1791:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1025:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF499:
+	.string	"_ISOC11_SOURCE 1"
+.LASF1054:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1794:
+	.string	"readFn"
+.LASF508:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1929:
+	.string	"FEATURE_RSSI_ADC"
+.LASF785:
+	.string	"UINT8_WIDTH 8"
+.LASF655:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF941:
+	.string	"sq(x) ((x)*(x))"
+.LASF763:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF632:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF977:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1467:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1386:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2132:
+	.string	"sendVoltage"
+.LASF1616:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1523:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF462:
+	.string	"_FEATURES_H 1"
+.LASF1679:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF421:
+	.string	"_BSD_SIZE_T_ "
+.LASF608:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1485:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF592:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF909:
+	.string	"USE_DASHBOARD"
+.LASF842:
+	.string	"TELEMETRY_LTM "
+.LASF2124:
+	.string	"initFrSkyTelemetry"
+.LASF1681:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1218:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1333:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1109:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF1202:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1587:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1598:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF633:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1033:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1785:
+	.string	"revisionCode"
+.LASF1145:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF684:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2043:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2044:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF396:
+	.string	"__REVISION__ \"669c324\""
+.LASF1464:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1867:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF930:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1037:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1298:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2025:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF777:
+	.string	"INT64_C(c) c ## L"
+.LASF507:
+	.string	"_XOPEN_SOURCE 700"
+.LASF2159:
+	.string	"sendTelemetryTail"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF676:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1505:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF837:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1731:
+	.string	"ID_ACC_Y 0x25"
+.LASF401:
+	.string	"_ANSI_STDDEF_H "
+.LASF540:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF2114:
+	.string	"openSerialPort"
+.LASF1087:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1860:
+	.string	"OWNER_OSD"
+.LASF558:
+	.string	"__LEAF , __leaf__"
+.LASF1445:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1476:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1559:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1023:
+	.string	"PG_PID_PROFILE 14"
+.LASF519:
+	.string	"__USE_ISOC11 1"
+.LASF1042:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1149:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1807:
+	.string	"MPU_9250_SPI"
+.LASF808:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1257:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF2016:
+	.string	"PORTSHARING_SHARED"
+.LASF1622:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1409:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF920:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1264:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF623:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF750:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2106:
+	.string	"getAmperage"
+.LASF2152:
+	.string	"throttleStatus"
+.LASF831:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1301:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1207:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1099:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF1958:
+	.string	"OK_TO_ARM"
+.LASF1242:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF500:
+	.string	"_ISOC2X_SOURCE"
+.LASF978:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1595:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1671:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF960:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF991:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF678:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1908:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF677:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1199:
+	.string	"IOCFG_AF_OD 0"
+.LASF1881:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1615:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1733:
+	.string	"ID_VOLTAGE_AMP 0x39"
+.LASF1233:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1391:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF627:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2042:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1162:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF568:
+	.string	"__ptr_t void *"
+.LASF1433:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1932:
+	.string	"FEATURE_OSD"
+.LASF1629:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1676:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1004:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF846:
+	.string	"GPS "
+.LASF1630:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF667:
+	.string	"__SLONG32_TYPE int"
+.LASF1419:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1020:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1418:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2034:
+	.string	"SERIAL_PORT_USART1"
+.LASF2035:
+	.string	"SERIAL_PORT_USART2"
+.LASF2036:
+	.string	"SERIAL_PORT_USART3"
+.LASF412:
+	.string	"__need_ptrdiff_t"
+.LASF1275:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2039:
+	.string	"SERIAL_PORT_USART6"
+.LASF2040:
+	.string	"SERIAL_PORT_USART7"
+.LASF2041:
+	.string	"SERIAL_PORT_USART8"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1904:
+	.string	"serialTotalRxWaiting"
+.LASF1214:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1036:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF466:
+	.string	"__USE_ISOCXX11"
+.LASF1507:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1745:
+	.string	"long int"
+.LASF1603:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1336:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1029:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1670:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF560:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF492:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1130:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF954:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF723:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF731:
+	.string	"UINT8_MAX (255)"
+.LASF1190:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF1835:
+	.string	"OWNER_PINDEBUG"
+.LASF1281:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1548:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF726:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF804:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF2086:
+	.string	"frsky_coordinate_format"
+.LASF565:
+	.string	"__PMT(args) args"
+.LASF1644:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF848:
+	.string	"TELEMETRY_CRSF "
+.LASF406:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF553:
+	.string	"_SYS_CDEFS_H 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF971:
+	.string	"UNUSED(x) (void)(x)"
+.LASF2142:
+	.string	"coordinate"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2160:
+	.string	"sendDataHead"
+.LASF1387:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF405:
+	.string	"__PTRDIFF_T "
+.LASF1643:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF861:
+	.string	"VTX_SMARTAUDIO "
+.LASF1260:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF791:
+	.string	"UINT64_WIDTH 64"
+.LASF1381:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1307:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1382:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF693:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF700:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1508:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2000:
+	.string	"batteryConfig_s"
+.LASF2012:
+	.string	"batteryConfig_t"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1994:
+	.string	"CURRENT_METER_MAX"
+.LASF571:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1120:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF969:
+	.string	"EXPAND_I(x) x"
+.LASF1357:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1683:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1188:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF907:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1314:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1762:
+	.string	"uint32_t"
+.LASF1181:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF419:
+	.string	"__SIZE_T "
+.LASF705:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF868:
+	.string	"U_ID_1 1"
+.LASF1614:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1211:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF867:
+	.string	"U_ID_0 0"
+.LASF1897:
+	.string	"rxBufferTail"
+.LASF884:
+	.string	"USE_UART6 "
+.LASF1959:
+	.string	"PREVENT_ARMING"
+.LASF1075:
+	.string	"PG_PPM_CONFIG 507"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2102:
+	.string	"lastCycleTime"
+.LASF1279:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF788:
+	.string	"INT32_WIDTH 32"
+.LASF688:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF704:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1531:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1481:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF2110:
+	.string	"millis"
+.LASF1829:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1725:
+	.string	"ID_COURSE_AP 0x1C"
+.LASF2101:
+	.string	"frskyPortSharing"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF596:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1880:
+	.string	"SERIAL_UNIDIR"
+.LASF1222:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF950:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF523:
+	.string	"__USE_POSIX2 1"
+.LASF1072:
+	.string	"PG_PID_CONFIG 504"
+.LASF447:
+	.string	"__DEFINED_wchar_t "
+.LASF1613:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1438:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF491:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF583:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF656:
+	.string	"_BITS_TYPES_H 1"
+.LASF901:
+	.string	"TELEMETRY_FRSKY"
+.LASF1746:
+	.string	"long unsigned int"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF744:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF801:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF2115:
+	.string	"closeSerialPort"
+.LASF985:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF471:
+	.string	"__USE_XOPEN"
+.LASF579:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF647:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1052:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1006:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF435:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1012:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1297:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1154:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF737:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF504:
+	.string	"_POSIX_C_SOURCE"
+.LASF812:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1372:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1836:
+	.string	"OWNER_TIMER"
+.LASF1779:
+	.string	"accDev_s"
+.LASF1821:
+	.string	"accDev_t"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1053:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1783:
+	.string	"acc_1G"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1527:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2130:
+	.string	"vfasVoltage"
+.LASF1480:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1510:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1717:
+	.string	"ID_GPS_SPEED_AP 0x19"
+.LASF529:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1456:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1224:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1637:
+	.string	"LAT 0"
+.LASF797:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF915:
+	.string	"BLACKBOX"
+.LASF1757:
+	.string	"char"
+.LASF2061:
+	.string	"PIDPOS"
+.LASF1678:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1353:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF679:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF640:
+	.string	"__stub_sigreturn "
+.LASF1290:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1551:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1437:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF659:
+	.string	"__S32_TYPE int"
+.LASF648:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1198:
+	.string	"IOCFG_AF_PP 0"
+.LASF870:
+	.string	"LED0_PIN NONE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF657:
+	.string	"__S16_TYPE short int"
+.LASF1764:
+	.string	"IO_t"
+.LASF1110:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF1417:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF415:
+	.string	"_SIZE_T "
+.LASF505:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF513:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1511:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1108:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1091:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2033:
+	.string	"SERIAL_PORT_NONE"
+.LASF1588:
+	.string	"BEEP_ON do {} while(0)"
+.LASF719:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1848:
+	.string	"OWNER_FLASH_CS"
+.LASF1425:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF898:
+	.string	"USE_SERIALRX_XBUS"
+.LASF856:
+	.string	"USE_RX_MSP "
+.LASF965:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1399:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF456:
+	.string	"true 1"
+.LASF1142:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF603:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF2157:
+	.string	"serializeFrsky"
+.LASF1610:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF691:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF423:
+	.string	"_SIZE_T_DEFINED "
+.LASF1694:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2082:
+	.string	"gpsNoFixLongitude"
+.LASF1573:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF724:
+	.string	"INT16_MIN (-32767-1)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF716:
+	.string	"__STD_TYPE"
+.LASF1628:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF702:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1808:
+	.string	"ICM_20601_SPI"
+.LASF746:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1116:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF674:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF585:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1655:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF1944:
+	.string	"ROLL"
+.LASF430:
+	.string	"__size_t "
+.LASF1879:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF821:
+	.string	"I2C1_OVERCLOCK true"
+.LASF891:
+	.string	"SERIAL_RX"
+.LASF1225:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF940:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1268:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1045:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1788:
+	.string	"mpuConfiguration"
+.LASF1402:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF451:
+	.string	"NULL ((void *)0)"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1772:
+	.string	"CW180_DEG_FLIP"
+.LASF1581:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF792:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF892:
+	.string	"USE_SERIALRX_CRSF"
+.LASF921:
+	.string	"USE_PROFILE "
+.LASF1920:
+	.string	"FEATURE_SERVO_TILT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1050:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF913:
+	.string	"VTX_SMARTAUDIO"
+.LASF832:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1840:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1318:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF589:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF982:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF630:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1479:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF894:
+	.string	"USE_SERIALRX_SBUS"
+.LASF2128:
+	.string	"batteryVoltage"
+.LASF771:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF619:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1623:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1296:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1334:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1740:
+	.string	"ID_VERT_SPEED 0x30"
+.LASF449:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF760:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1271:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF404:
+	.string	"_T_PTRDIFF "
+.LASF556:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1738:
+	.string	"ID_GYRO_Y 0x41"
+.LASF1625:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF645:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1697:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1600:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF510:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1711:
+	.string	"ID_FUEL_LEVEL 0x04"
+.LASF1074:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1459:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF552:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1155:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2037:
+	.string	"SERIAL_PORT_UART4"
+.LASF2078:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF2162:
+	.string	"batteryConfig"
+.LASF1422:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF886:
+	.string	"USE_UART8 "
+.LASF1338:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1802:
+	.string	"MPU_3050"
+.LASF1086:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1767:
+	.string	"CW90_DEG"
+.LASF2014:
+	.string	"PORTSHARING_UNUSED"
+.LASF2046:
+	.string	"serialPortConfig_s"
+.LASF2052:
+	.string	"serialPortConfig_t"
+.LASF1379:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1554:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1774:
+	.string	"sensor_align_e"
+.LASF1500:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1285:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1220:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1562:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1415:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1576:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1876:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1877:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1624:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1483:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1373:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF572:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1899:
+	.string	"txBufferTail"
+.LASF2153:
+	.string	"throttleForRPM"
+.LASF2147:
+	.string	"sendTime"
+.LASF488:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1797:
+	.string	"verifywriteFn"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF531:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1607:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF996:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1063:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF1000:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF480:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1977:
+	.string	"ut_delay"
+.LASF1394:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1065:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF824:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF820:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF1073:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1470:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1710:
+	.string	"ID_RPM 0x03"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF506:
+	.string	"_XOPEN_SOURCE"
+.LASF1326:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1122:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2074:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF1283:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1585:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF1658:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF689:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1718:
+	.string	"ID_LONGITUDE_BP 0x12"
+.LASF1843:
+	.string	"OWNER_I2C_SCL"
+.LASF1841:
+	.string	"OWNER_SPI_MISO"
+.LASF1231:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1866:
+	.string	"OWNER_COMPASS_CS"
+.LASF438:
+	.string	"_WCHAR_T_ "
+.LASF872:
+	.string	"USE_FAKE_GYRO "
+.LASF1152:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1504:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1942:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF1013:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF699:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1928:
+	.string	"FEATURE_RX_MSP"
+.LASF2104:
+	.string	"getMAhDrawn"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF439:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1943:
+	.string	"rc_alias"
+.LASF1354:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1397:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1922:
+	.string	"FEATURE_GPS"
+.LASF742:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1107:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF935:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF591:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1522:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1370:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1755:
+	.string	"__int32_t"
+.LASF1374:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1844:
+	.string	"OWNER_I2C_SDA"
+.LASF1699:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1756:
+	.string	"__uint32_t"
+.LASF461:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1313:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1448:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF468:
+	.string	"__USE_POSIX2"
+.LASF2158:
+	.string	"data"
+.LASF1128:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF1930:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1030:
+	.string	"PG_IMU_CONFIG 22"
+.LASF956:
+	.string	"Q12 (1 << 12)"
+.LASF1660:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2003:
+	.string	"vbatwarningcellvoltage"
+.LASF826:
+	.string	"USE_CLI "
+.LASF1812:
+	.string	"BMI_160_SPI"
+.LASF863:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1273:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1161:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF1989:
+	.string	"baro"
+.LASF588:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1849:
+	.string	"OWNER_FLASH"
+.LASF1891:
+	.string	"baudRate"
+.LASF1563:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1059:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF481:
+	.string	"__USE_MISC"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2045:
+	.string	"serialPortIdentifier_e"
+.LASF1873:
+	.string	"portOptions_t"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF475:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2060:
+	.string	"PIDALT"
+.LASF1462:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF757:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1185:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2048:
+	.string	"msp_baudrateIndex"
+.LASF1696:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1895:
+	.string	"txBuffer"
+.LASF436:
+	.string	"_T_WCHAR "
+.LASF1493:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF429:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF798:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1474:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF732:
+	.string	"UINT16_MAX (65535)"
+.LASF1692:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1316:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1633:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1341:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF707:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF400:
+	.string	"_STDDEF_H_ "
+.LASF1212:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF515:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1230:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1579:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF786:
+	.string	"INT16_WIDTH 16"
+.LASF1503:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2079:
+	.string	"frskyUnit_e"
+.LASF1449:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1981:
+	.string	"start_up"
+.LASF2006:
+	.string	"currentMeterSource"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1680:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1979:
+	.string	"start_ut"
+.LASF2073:
+	.string	"vario"
+.LASF711:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF779:
+	.string	"UINT16_C(c) c"
+.LASF1035:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2143:
+	.string	"GPStoDDDMM_MMMM"
+.LASF1266:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1366:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF765:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1432:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1861:
+	.string	"OWNER_RX_BIND"
+.LASF495:
+	.string	"_ISOC95_SOURCE 1"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF860:
+	.string	"VTX_CONTROL "
+.LASF2116:
+	.string	"determinePortSharing"
+.LASF1468:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1864:
+	.string	"OWNER_TRANSPONDER"
+.LASF1031:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2129:
+	.string	"voltage"
+.LASF1147:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF767:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1180:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1646:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1139:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF787:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1319:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1704:
+	.string	"CYCLETIME 125"
+.LASF407:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF437:
+	.string	"__WCHAR_T "
+.LASF1815:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1440:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1902:
+	.string	"serialPortVTable"
+.LASF1378:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1972:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1591:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF2020:
+	.string	"FUNCTION_GPS"
+.LASF1265:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1575:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1872:
+	.string	"portMode_t"
+.LASF974:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF518:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF871:
+	.string	"GYRO "
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1976:
+	.string	"baroDev_s"
+.LASF1984:
+	.string	"baroDev_t"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1990:
+	.string	"CURRENT_METER_NONE"
+.LASF1153:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF712:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF532:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1665:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF2027:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1851:
+	.string	"OWNER_MPU_CS"
+.LASF1854:
+	.string	"OWNER_SPI_CS"
+.LASF1077:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1269:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1675:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1126:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF2017:
+	.string	"portSharing_e"
+.LASF1105:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF651:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF1106:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1582:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF877:
+	.string	"MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF569:
+	.string	"__BEGIN_DECLS "
+.LASF609:
+	.string	"__restrict_arr __restrict"
+.LASF1465:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF778:
+	.string	"UINT8_C(c) c"
+.LASF459:
+	.string	"_STDINT_H 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1469:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1884:
+	.string	"serialReceiveCallbackPtr"
+.LASF1546:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2087:
+	.string	"frsky_unit"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF418:
+	.string	"_T_SIZE "
+.LASF525:
+	.string	"__USE_POSIX199506 1"
+.LASF1819:
+	.string	"resolution"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF669:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF928:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF638:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF610:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1014:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1716:
+	.string	"ID_GPS_SPEED_BP 0x11"
+.LASF1008:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1724:
+	.string	"ID_COURSE_BP 0x14"
+.LASF922:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF951:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1702:
+	.string	"FRSKY_BAUDRATE 9600"
+.LASF527:
+	.string	"__USE_XOPEN2K8 1"
+.LASF980:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF477:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF834:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1690:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1882:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1070:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1822:
+	.string	"OWNER_FREE"
+.LASF1916:
+	.string	"FEATURE_RX_PPM"
+.LASF937:
+	.string	"EEPROM_SIZE 32768"
+.LASF1992:
+	.string	"CURRENT_METER_VIRTUAL"
+.LASF537:
+	.string	"__WORDSIZE 64"
+.LASF1141:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF2009:
+	.string	"useConsumptionAlerts"
+.LASF1398:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1780:
+	.string	"csnPin"
+.LASF1913:
+	.string	"readBuf"
+.LASF1662:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF514:
+	.string	"_ATFILE_SOURCE"
+.LASF1244:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF961:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF809:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1506:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF631:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1113:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1229:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF469:
+	.string	"__USE_POSIX199309"
+.LASF1263:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1886:
+	.string	"serialPort_s"
+.LASF1915:
+	.string	"serialPort_t"
+.LASF1823:
+	.string	"OWNER_PWMINPUT"
+.LASF652:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1590:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1347:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1095:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1568:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1635:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF1905:
+	.string	"serialTotalTxFree"
+.LASF1605:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1124:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF1121:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF983:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF923:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF503:
+	.string	"_POSIX_SOURCE 1"
+.LASF1429:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1883:
+	.string	"SERIAL_BIDIR_PP"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1208:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1164:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF764:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF813:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF2146:
+	.string	"absgps"
+.LASF408:
+	.string	"___int_ptrdiff_t_h "
+.LASF1744:
+	.string	"BLADE_NUMBER_DIVIDER 5"
+.LASF1885:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF1102:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF612:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF703:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1721:
+	.string	"ID_LATITUDE_BP 0x13"
+.LASF2054:
+	.string	"dddmm"
+.LASF1567:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1810:
+	.string	"ICM_20608_SPI"
+.LASF1038:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1157:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1221:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1728:
+	.string	"ID_HOUR_MINUTE 0x17"
+.LASF1632:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1799:
+	.string	"gyroReadXRegister"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF893:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1727:
+	.string	"ID_YEAR 0x16"
+.LASF851:
+	.string	"TELEMETRY_MAVLINK "
+.LASF549:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1323:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1455:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2112:
+	.string	"telemetryDetermineEnabledState"
+.LASF550:
+	.string	"__GLIBC__ 2"
+.LASF772:
+	.string	"WINT_MIN (0u)"
+.LASF516:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1196:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1926:
+	.string	"FEATURE_3D"
+.LASF1687:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1018:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1846:
+	.string	"OWNER_SDCARD_CS"
+.LASF924:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1165:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1262:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1978:
+	.string	"up_delay"
+.LASF955:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2072:
+	.string	"attitude"
+.LASF1166:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1472:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2134:
+	.string	"cellVoltage"
+.LASF426:
+	.string	"__DEFINED_size_t "
+.LASF829:
+	.string	"SERIAL_RX "
+.LASF1167:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1998:
+	.string	"VOLTAGE_METER_ESC"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF616:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1642:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF879:
+	.string	"USE_UART1 "
+.LASF1720:
+	.string	"ID_E_W 0x22"
+.LASF2136:
+	.string	"cellCount"
+.LASF1168:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1549:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1140:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF1435:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1495:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF593:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1344:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1806:
+	.string	"MPU_65xx_SPI"
+.LASF1901:
+	.string	"rxFrameCallback"
+.LASF2063:
+	.string	"PIDNAVR"
+.LASF1132:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1300:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1367:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1146:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF932:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF482:
+	.string	"__USE_ATFILE"
+.LASF1078:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1666:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1818:
+	.string	"sensor"
+.LASF1446:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1331:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF887:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF615:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1956:
+	.string	"THROTTLE_HIGH"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF835:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1641:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF595:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2071:
+	.string	"attitudeEulerAngles_t"
+.LASF1204:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1863:
+	.string	"OWNER_LED_STRIP"
+.LASF1463:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF759:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF880:
+	.string	"USE_UART2 "
+.LASF859:
+	.string	"VTX_COMMON "
+.LASF487:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF862:
+	.string	"VTX_TRAMP "
+.LASF1817:
+	.string	"mpuDetectionResult_s"
+.LASF1820:
+	.string	"mpuDetectionResult_t"
+.LASF766:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1639:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1688:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF938:
+	.string	"__disable_irq() "
+.LASF2067:
+	.string	"PID_ITEM_COUNT"
+.LASF1542:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF695:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF814:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF912:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1571:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1111:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF692:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF793:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1968:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1022:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1903:
+	.string	"serialWrite"
+.LASF2156:
+	.string	"serialize16"
+.LASF1736:
+	.string	"ID_CURRENT 0x28"
+.LASF1974:
+	.string	"baroOpFuncPtr"
+.LASF1376:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1686:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF992:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF881:
+	.string	"USE_UART3 "
+.LASF2107:
+	.string	"getBatteryVoltage"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1451:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1169:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1814:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF414:
+	.string	"__SIZE_T__ "
+.LASF1205:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF681:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2127:
+	.string	"sendAmperage"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1179:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1850:
+	.string	"OWNER_BARO_CS"
+.LASF575:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF567:
+	.string	"__STRING(x) #x"
+.LASF649:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF1068:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1305:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF947:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF528:
+	.string	"__USE_XOPEN 1"
+.LASF805:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF939:
+	.string	"__enable_irq() "
+.LASF1749:
+	.string	"unsigned int"
+.LASF1964:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF882:
+	.string	"USE_UART4 "
+.LASF1071:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1383:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1486:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1691:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF964:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF653:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF598:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1131:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1173:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1178:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1513:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1177:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF535:
+	.string	"__USE_LARGEFILE 1"
+.LASF551:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1076:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1450:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1828:
+	.string	"OWNER_ADC"
+.LASF1753:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF738:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1786:
+	.string	"accAlign"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1535:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1583:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1342:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1552:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF883:
+	.string	"USE_UART5 "
+.LASF1498:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1021:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1933:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1636:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1831:
+	.string	"OWNER_ADC_EXT"
+.LASF1553:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1067:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1291:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1669:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1295:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF784:
+	.string	"INT8_WIDTH 8"
+.LASF1768:
+	.string	"CW180_DEG"
+.LASF1890:
+	.string	"options"
+.LASF934:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1852:
+	.string	"OWNER_OSD_CS"
+.LASF2163:
+	.string	"constrain"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1539:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF411:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1002:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF646:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF521:
+	.string	"__USE_ISOC95 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1532:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1200:
+	.string	"IOCFG_IPD 0"
+.LASF2002:
+	.string	"vbatmincellvoltage"
+.LASF2154:
+	.string	"sendBaro"
+.LASF642:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1555:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2148:
+	.string	"seconds"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1345:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2207:
+	.string	"frsky.h"
+.LASF2187:
+	.string	"io_types.h"
+.LASF2218:
+	.string	"features-time64.h"
+.LASF2222:
+	.string	"long-double.h"
+.LASF2216:
+	.string	"libc-header-start.h"
+.LASF2173:
+	.string	"src/main/rx"
+.LASF2197:
+	.string	"acceleration.h"
+.LASF2201:
+	.string	"battery.h"
+.LASF2199:
+	.string	"current.h"
+.LASF2214:
+	.string	"stdbool.h"
+.LASF2181:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2239:
+	.string	"io_def.h"
+.LASF2205:
+	.string	"altitudehold.h"
+.LASF2185:
+	.string	"stdint-intn.h"
+.LASF2194:
+	.string	"rc_controls.h"
+.LASF2232:
+	.string	"axis.h"
+.LASF2180:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2183:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2223:
+	.string	"stubs.h"
+.LASF2189:
+	.string	"accgyro.h"
+.LASF2238:
+	.string	"io.h"
+.LASF2175:
+	.string	"src/main/target/SITL"
+.LASF2254:
+	.string	"timer.h"
+.LASF2230:
+	.string	"target.h"
+.LASF2172:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF2203:
+	.string	"pid.h"
+.LASF2179:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2193:
+	.string	"config.h"
+.LASF2204:
+	.string	"imu.h"
+.LASF2206:
+	.string	"telemetry.h"
+.LASF2246:
+	.string	"vcd.h"
+.LASF2245:
+	.string	"sound_beeper.h"
+.LASF2184:
+	.string	"types.h"
+.LASF2227:
+	.string	"wchar.h"
+.LASF2209:
+	.string	"system.h"
+.LASF2195:
+	.string	"runtime_config.h"
+.LASF2169:
+	.string	"src/main/drivers"
+.LASF2182:
+	.string	"/usr/include"
+.LASF2200:
+	.string	"voltage.h"
+.LASF2166:
+	.string	"src/main/build"
+.LASF2210:
+	.string	"feature.h"
+.LASF2255:
+	.string	"rcc_types.h"
+.LASF2217:
+	.string	"features.h"
+.LASF2171:
+	.string	"src/main/flight"
+.LASF2225:
+	.string	"typesizes.h"
+.LASF2253:
+	.string	"pwm_output.h"
+.LASF2237:
+	.string	"exti.h"
+.LASF2192:
+	.string	"serial.h"
+.LASF2242:
+	.string	"flash.h"
+.LASF2168:
+	.string	"src/main/config"
+.LASF2196:
+	.string	"sensors.h"
+.LASF2226:
+	.string	"time64.h"
+.LASF2186:
+	.string	"stdint-uintn.h"
+.LASF2176:
+	.string	"src/main/target"
+.LASF2190:
+	.string	"accgyro_mpu.h"
+.LASF2178:
+	.string	"src/main"
+.LASF2243:
+	.string	"rx_pwm.h"
+.LASF2198:
+	.string	"barometer.h"
+.LASF2174:
+	.string	"src/main/sensors"
+.LASF2248:
+	.string	"time.h"
+.LASF2191:
+	.string	"resource.h"
+.LASF2221:
+	.string	"cdefs.h"
+.LASF2236:
+	.string	"parameter_group_ids.h"
+.LASF2188:
+	.string	"sensor.h"
+.LASF0:
+	.string	"./src/main/telemetry/frsky.c"
+.LASF2177:
+	.string	"src/main/telemetry"
+.LASF2250:
+	.string	"current_ids.h"
+.LASF2256:
+	.string	"rx.h"
+.LASF2202:
+	.string	"gps.h"
+.LASF2170:
+	.string	"src/main/fc"
+.LASF2229:
+	.string	"common.h"
+.LASF2234:
+	.string	"parameter_group.h"
+.LASF2252:
+	.string	"mixer.h"
+.LASF2211:
+	.string	"maths.h"
+.LASF2220:
+	.string	"timesize.h"
+.LASF2167:
+	.string	"src/main/common"
+.LASF2244:
+	.string	"sdcard.h"
+.LASF2233:
+	.string	"utils.h"
+.LASF2215:
+	.string	"stdint.h"
+.LASF2235:
+	.string	"build_config.h"
+.LASF2213:
+	.string	"stddef.h"
+.LASF2224:
+	.string	"stubs-64.h"
+.LASF2251:
+	.string	"voltage_ids.h"
+.LASF2247:
+	.string	"gyro.h"
+.LASF2219:
+	.string	"wordsize.h"
+.LASF2240:
+	.string	"io_def_generated.h"
+.LASF2231:
+	.string	"common_post.h"
+.LASF2241:
+	.string	"adc.h"
+.LASF2208:
+	.string	"frsky.c"
+.LASF2228:
+	.string	"platform.h"
+.LASF2212:
+	.string	"stdc-predef.h"
+.LASF2249:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\t\001\275\013"
+	.string	"\304\021\375\001"
+	.string	"\037"
+	.string	"\326\361\226\245\004\b\002"
+	.string	"\002\001\002\002\002\003\355\201\326)\004\002\003\352\263\360\321\b\004\251\335\273\317\007\005\323\200\315\277\004\006\006\325\301\365\275\013\004\002\005\002\006\002\007\002\006\b\250\350\342\315\007\002\002\005\002\005\n\230\242\205[\b\002\005\002\b\f\315\277\261\313\005\002\002\t\002\t\016\206\233\304\331\003\b\017\331\302\373\304\002\022\002\n\002\n\002\002\002\013\013\002\013\020\202\342\221\312\017"
+	.string	"\021\202\223\317\370\004\006\002\f\002\f\002\002\002\r\002\007\002\016\025\241\323\204\257\007\006\002\007\026\027\260\204\242\302\f\004\002\f\002\001\030\343\346\257\326\004"
+	.string	"\031\274\342\313\241\003\002\032\254\241\214\350\n\017\002\017\034\035\251\352\205\273\013\022\020\002\016\002\005\002\021\021\002\021\004\002\004\036\037\227\322\354\331\016\004\002\022\002\022\002\023\002\023 \240\342\234\212\n!\"\307\354\376\303\t#\262\365\307\310\b\n\024\002\025$\253\235\3708\002\002\026\002\026%&\316\352\207\265\016\016\017\002\017'\353\315\243\273\006\022\026\f\026\002\026\002\004\002\004"
+	.string	") \200\0023Uv0\b(_I\246\266\2154\306("
+	.ascii	",\306\317pi\037d\203\203\035\020\027\210\013\006\325+\302k\264"
+	.ascii	"M\205,\330\005\340\027\343\237I\321L\247 Sn\32175\314\203m\314"
+	.ascii	"\005\024\233\033.\314\302\271\200-\313Y\264\331\360\006 \"\006"
+	.ascii	"-)\344\342\313*\346\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"]\004"
+	.string	"\304\003^\001"
+	.string	"\030"
+	.string	"\002"
+	.string	"\001\002\001\001\002"
+	.string	"\001\004"
+	.string	"\001\005"
+	.string	"\006\b\n\f\016\017\020"
+	.string	"\021\001\025\027"
+	.string	""
+	.string	"\030\001\031"
+	.string	""
+	.string	""
+	.string	"\001\032"
+	.string	"\001\035\037"
+	.string	"\"#$\003&"
+	.string	"'"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"% \220\2022\354\034\025\034\323f8\324\261o\342\242\241DZ\356\322\212\240)n3>\024\254\314%\303\200\202I\271\201\2652\003\025:\336\027\233\300\214\021\371"
+	.ascii	"N\256\021\221#\211C\030\bV\005\326\037\223\207\310Pwa\033\253"
+	.ascii	"\305dR\360!"
+	.text
+	.section	.gnu.lto_.inline.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\314\006E\025"
+	.string	"\366YZD\360\222&\351\240\315\f\227\230\340\377=\364\375\224\351\202MZ\f}\231\324n\375Y!\257\013\335\005=6j\313\231\212P\364\201\221\211L\321\303\224\312\3420u*\"zA-\267\031|\354,\3777\310[ld\223\024>"
+	.string	"E"
+	.string	"G"
+	.ascii	"\031\301\307spi\t\341\221\234\016,nL\036y\353M\335\246\016\004"
+	.ascii	"\377\353]\254\3745\270j\3739\255O\271\323\226t\236.\260-G\362"
+	.ascii	"[\266-\t\374G\371~\277\227\004\321r\242\327\006\260\n\377`2E"
+	.ascii	"[\320\321\324\275\177\237\214\311\256\345H\371P&w\2643\242\257"
+	.ascii	"\261\367Y\026K1;f-\271!\307&\207u,\035K-yaFJ\225G\226\343\003"
+	.ascii	"H\203\"\306\2165\013w\275\204\277T=\376\275xZ\017+hP\206\211"
+	.ascii	" :<\032N\374`\360\350aZ\352i\233\362\311)-\324\300A\241@\016"
+	.ascii	"0Z\214(]\362\006\272i;:{\033\366'\210\"\003\033X\002"
+	.string	"\022;\364{h;`\320\277\267PL\326\264\025\215\375\177\022f\377\177\222\343)1\001\265 \017\241\303ce\005\234\nC\327\223\242A\302E\201\023l\271Z\331\324\231\272\353/\211Bjv\210\230\340d\320a\343\344\003/q\225\177\001,\033\0033*D|(\242B\0015\344\006\202\230\202m0\205\003\310\2128\351\020M\313i\023\b\200\222\250\3211\242!\241M\n5\2461p\242\241\261c\007\022\200Bi\216')\346\bQD!\221@&\020\022\232\222d\030\003\352\240e\302\034B\222IZ\332T\250b\221\313b\210\361@\347\200\027\224\\\216\200\3235N\004z\346C\255\250\"\030Z:\222oH\227\276\341\366\217\235\315\351\207'pD\301m\221M\226\nJ\241b\265\353\364l\365\344\370\216\276+\3357\261\016A\326\341\324;\206\036X\365\347\266\321Vm\2558TL\260\204\035\243\321,Q\343\240l\007\322\\\252\251\\"
+	.string	"W\367\322 \365\254\207\300\\\374\347\203p\257\0360\3326\320\216Is_\253\310%\2151\347\331]=r:E\327Pnz\372\211\300j\341\353`&*\372\301\355\227|\036\232\320\351\202\331"
+	.string	"\332\250\370\030a\004,\312=C)2\265!7W\353:\301xH\033\026V\304\211`\034X\031\201\216;o\t\256L\340\275 \2244;\230[D\251\230T\345\371l .72.\316\232#D{\327"
+	.string	"\004\343\351\0015\3524\365\341\\'\345\245\237\264c\002\351\276\224\213\035\371!"
+	.ascii	"\364$\002\364\201g0\331K\257\025\266\344\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\231\006u\020"
+	.string	"\006\221;6@\245*\035\3030\200Wu\302\260b\227\2555C-`\034\303\230\361\317\343\303\311\362`@b\213!\034\203\233\305wB\212\026\353\320\311gw\234]\365\322\224l\223\224R("
+	.string	"1"
+	.string	","
+	.string	"\206ys\3766\353\013\207B\001\"\321jU\026\313M\345\353\316\361\317T?\223\333\247=^\366\257\307\354\021\263_\255\002\024\001\222J%\223\331@uD\223\322&M<:\022\3316\fF\225\241z\274\227\215\375\005\223\211\305B"
+	.string	"\201\\.\001\f\263U\360\337>:\235\201\215aj\002\357\013\333\355=\n\307i\036\317\347s\303\274@\240\007\2265\323M\035\\\013\243<\203A\263\314\034\3264\220a\032\303w\003\304([\303\222-\007\353\272\256\363\206\242\261\271\254\271\274\355p*\235J\036E\370!\337\230\301\270\345\037\"\021l\341K\030\200\235\260\375\265*J\356v\007\200\232\250Aq5$-H\3327\300B\262\3426\022\340qR\f\342(\244\034sN0\"q\023L\2204)\234\003C\034\t]\206\250D\250\215\200\224\177f;1A%\373\232u\021P/\310xO7\205M3D\246\243E\217\335\3431\263\321\227\177\320\f\3578\001\023\re\r~\362-\224\017\347\222^\366;B\023\376J\366\323\177\346=L<\025>\256\232\242\346\254rx&\252O\371\022\210\230N$\253\255\020\370\326\bP\251\f\"\304"
+	.string	"\020\353:\f6w\3003#\206\2351(H\225\272 \0166\362j_\247~\006\376\327<U\233O\277\034V\324\216\344\317\303\215X\203\200t\205xoci\261\300-1\304R\327"
+	.ascii	"bj\351\217\007\b$U\311\201\324\315\232\312\203\30441\232\205"
+	.ascii	"h\263\202\370\363ovK&:RPi\374\330\372\307:\315A\024v\332$\270"
+	.ascii	"p9\324C`\t\003Q\214M.\312W\017\204I \224P\305$\320B\024\225k"
+	.ascii	"\021\352S3mm:\201\200|@\350\202\025V\277!\n"
+	.text
+	.section	.gnu.lto_.pureconst.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375 M\345\001"
+	.string	"\322\004\016\025\220Mc\307\020\273\273\263\377\247\267\205\201 +\034xC\222\b\031N\371\244%\331\"\207\374q\307\033g\234\371\342\212'\216\330\0167\274p\302\007\027<p\035\360:vwU"
+	.text
+	.section	.gnu.lto_.ipa_modref.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\022\001\265\006"
+	.string	"\002I\032 \220\265\226\003\363wwwwww\267\027`o\240\005w\261\341 \255\277\311\366\277\2577~\3732\245\"\2246\206\353\311`[0w\bRdm\255\371\262]6}\252m\265\001\020l\007v\363p\030\237\366\302P\361\202t\267\361BAm\251\204"
+	.ascii	"b\231\3034g6\245\244\200\034m\205\024\375\r\330B?[g\253\311\201"
+	.ascii	"\323\341\2223 \220\002\252Jn?18\b\201\314f(X\027\212)\0330\306"
+	.ascii	"\255x\2216u\275\272\003\376\236\235\331\316\002\365\212\203U"
+	.ascii	"]\357\024\202(\273\177\264\310\216;\\\267\202Yghm\026\333&\262"
+	.ascii	"\273\035\f.\374\365\341\247\2023\3549\030p\334\206f\260zKs\210"
+	.ascii	"\220\207i\334\316\270\206\313\314\352)\234rG\frWW\013\n\340\006"
+	.text
+	.section	.gnu.lto_.lto.c0b0ecebf4063c13,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sendDataHead.90.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\325\t"
+	.string	"\246RD> \307*\035\007\213@\310\300\265G\201\240\216\230~\300N\032Y$\\\360oF\241\261\201p\364[\364\314 *\023R\303\005\f\001\220(\310\211\005\2239\206!]m@@\033\250\244\221 )S\n1"
+	.string	"/"
+	.string	"2"
+	.string	"\255\030\200\335\220\301\013\3345\177\266\201\207#{yy\250V\020\354nT\221\177\317\317?\3121\340\n\365\274tv\327\t\256@n\275m\005\333\035\373\007\001\231\300\016Q\251/\373\226U\227}\330\277iZ3\235\232>\2271!\2609\260\3731S\2602-@\211\355k\354\r\0303\355\206\207\357\260\r\353n\252*\252\030\326\246\251W-\310\264\270\364\200[\300v\2653Hy\320\t\035\212\262\237\362\360\344\223X\303\224\007\257\371\246\355\332\025\303J\345\314\031\013)\260\001\006I8t\035D\304\207c\360\t\245=\234S\005\311\003\305\223W\352D\235EW\212\027!\nQ\364x\244\310A\360\b\243\363bi4\362\242&\334[V]\023'\262\224r\230\313\f\016"
+	.ascii	"~\3112c\017\203\254\275_K\301\023E`\3422\003\204a\020\204v\\"
+	.ascii	"\030s0V\203\251!\340./\332I\006"
+	.text
+	.section	.gnu.lto_serializeFrsky.92.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\261\001e\017"
+	.string	"v\034gG\360\222(\035\"\301\246\007\030\320\273\374\361\214\364t\305\231\237\037\260\232\t(\344\020N.\370\017\207[\340M\215G\365=\225\322N\230\032p@I|`\023\031\311\311\331\275\252\020.V\006|\362\353?\325P#do)e\nU"
+	.string	"L"
+	.string	"S"
+	.string	"8\364\325\322[\213\304\252\005Nww\214BO\272iS\362\236\256\352R\220PD\351\306R\315#\262tJ\221\025\031!>\342\006\031\300\306\304\215je\207\245,\025\250pF|\304\024\311\345\254h\250K\267\203\230\332\335\"t\3677\024A\350;\372\237\364_\302\2579\0029\337\030\232Yo\217\377\205Zn\375\312\3438\216g\226__T'\357\345\356\231\367\313{\345<;lD\\t\177\030}\264l\302p\371\257\277\302\234\376\220\237\300\r\004\273\352z\002\006'}1\235\273Wdf\272_\006^\240\243\363\247?\312\277\311\311"
+	.ascii	"\025\243~\205)\213\3225\305E\337j\250\363\372i:\225ATPv<\027"
+	.ascii	"\023\233\265\2067-'fL\303'\2141kVqY1Cn\373\2170\254\206gF}r\206"
+	.ascii	"\233\226CJ\326\335\007\3665f`J0\267^\243&m2\005\230\215\224\r"
+	.ascii	"/y\260\300\363\0328 \001\001\b\221B$\362#\240\322\311\b,\351"
+	.ascii	"J \311\023y\025<Rg\301$$\352F\300Q\007\022\360\357\202\007v\244"
+	.ascii	"\357\003\273\220W\253lf\231\300C\206\302)\331\335\2751K\0319"
+	.ascii	"\231YW?t\254\007\230\b\025\332\271\205\260/\326S\303\355cz\032"
+	.ascii	"-\" \320\202\021\261\335\0209\341\244i|1\274\276\225D\201f\203"
+	.ascii	"wr6\225\213\330X(<h\271\305\362D\307/\360\211\t\327*\357U8\330"
+	.ascii	"\023\305\355\016\315,,\332\032\024I]\362Xm\204\026\214\341\366"
+	.ascii	"\272\304y\254\341\r\037\216\306p\366"
+	.text
+	.section	.gnu.lto_sendAccel.94.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\314\003M\032"
+	.string	"v0\245H\300VQ:i\203'V(2BF\312{\312D\352)D\256\214\300H15t)\331\376VD\240\n\315x\323\363\367\307\262l\003\347Q\305\222XN\177\333\247\263\337\300\275F\002\305\003\360\245\363\302\306|\266\021K\b\2212\245\217"
+	.string	"\205"
+	.string	"\225"
+	.string	"v@^d\351\207\f\225\027m\232\274\354\013\361\201\004C\017\022\202\2346RJ\272\335\323\234\274\035\362\342\177\344\322\306\307\353?\016d\366\235\231H\242\023d\222\016\3704\347\274\271h\034\362b\315i\306\213\341g\306\213\236\331W\316\2131S\272\245\033\322\2269'lax\037\362\356Pg\027\303\325\231\2574\260\340rD\027C\326\2343&'\"4\240#r5\ro\240\370\376\350\005h"
+	.string	"q9\024\327\324\316\234\323\212\313\031\335\343m\003\331~`\2071\001\223h}\303\240\005M\241\\\342\320\037\013\247\251P6\257\366\317\325\331\377\334\027v\250\246q\221\352\231P-\363\336\335b}w\257Hu9\252U\243\032fT\223\241:\225R\217\243Z\f\325a\250^Q\255\242\372"
+	.string	"\312\036Qp\264\314i\"\312\313l\022\223\324x\357\337]\355\373C\336\363}.=\033:\317/\262FV\312\213\266gO\022\"\347\021\362\246[\262\001\276B\275\222O\344HCO\022\212@\032\351~\344\\\f_^\344/\341\343\"e\257t\357\250\266\334/\331\240"
+	.string	"\337\305\256\2429i\003`V\265"
+	.ascii	"\220l8\310\025\027fosR\323(\247\226\\1\213\355i\334\324\376\026"
+	.ascii	"\234p&\n:S\354\n_b!\301\024%\343\352P\331\205+\256f\261=\321"
+	.ascii	"4\312\347H.\344,\2601\374\b\017\201\030sN\005F\016\354\361g\\"
+	.ascii	"tL\203\036\247a\314\221\221\244\334\3414u\327\346\360\243\307"
+	.ascii	"\271\246h\211\254\273\373%\002\0171~uo[Q\333\357>\271\005i\032"
+	.ascii	"\345\325O\307\356\234\001<\017\272}\030 \210\305\024\350dx\265"
+	.ascii	"6\334=/!\016 d>0!YP\354'\326!\026\004\363\260\201\347\007\326"
+	.ascii	"#\003\001{\t0\320\207\230\f\026\004\004$\203\225<\332?\367\205"
+	.string	"!\370h\242mM\\\235S*\226\265\353\323\233\257vD\316W\373\240J\221v\361\217\0362q1\025j\3670d\355w8_-+\300/\207\323\364\225\376\243\237\304\217G\023\215\306\2654)\\3\353\"o\246\261\334\231m`\013\326\214d\326\357Ih\255\214\376r\255}\3575\264\3266\270\005UA\337U\276O\25010\343\214sH\231`dffSHcP\002Q\250\214l\003\020xF\233\226Z\003u\352\274\020\"\021m\330z\344\224E] \327?\335C\234\200]\n\312\203\234j\023e\276\204\242\026\252\f\rq\252\006/\257C<\304w\276#3\230\222\301\f\305\205<R\024D\262\332\231\322\343\304!\300\247\305PC\240W\320J\237hlt\364\2719\372\013\264\216\177M\025D<,\353\330\324K\037wl\225\355O\2441\330\236\305\266\334\340\315\013\242\252\035!&s\276\202\342\035\304i,\371\364\002\003_N"
+	.string	"\031D\222\352\324pl"
+	.ascii	"I\246c{\324\037GG\364?"
+	.text
+	.section	.gnu.lto_sendBaro.95.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\\\003]\026"
+	.string	"\266g\211I\320\360(\035\373\035}\002\252\001\235m#\b\f\026\367n\264\037\362\t\345F\2176R\026\240\227\017\211P\344\"\035\321\253\227\323\376&\034\241@\b\263\324\265\017\300\323Oz z_LC\342#'&\232\\\r\374Y-!R\246\024s"
+	.string	"n"
+	.string	"t"
+	.string	"3h\314\355\220F.\212"
+	.ascii	"\265B\375\216\337\273\211\332uh\022\306\231\035\316\322\234\223"
+	.ascii	"\344\242_\343\305\325\007\240.\352AP\027\375\0225\362\242\310"
+	.ascii	"\212\226}\236\0274\250=\347\205\005\263\232\267\027<\2339{#\027"
+	.ascii	"\255`\274\250\244m\366\214\367@\314\216\035R\316\3274\347t\355"
+	.ascii	"\207\333\2566\3777\007\240\223\201\271v\274\346\234V\235\314"
+	.ascii	"\314\275\267\235\300v\004"
+	.string	"{e\004.z\235Y1\013c\375I\2414\365\206\335\273\351\356\354\207sk\354P\375q\337\255\022\325\036\241\232\f\325\251P\215\n\325b\250\016E\365\206j\r\325\007!\215X\264~srx\3021\223D!\021\367\375\366\201~\320\347\244\006\253\\\315\030\rH6\367\371=&m{\316\3138m:~;\336R\3558>\317\t\323\2109'y\321\266\355:\2641\252\375\350\240\332\373\316\362X\325>\3474\356z,\004\234\323m\206\\\337\227\2424\177\322%\327\232\363\240?2\277\f/#\356\276\007\240I9\365<\025\314\241t\236\177C\320F\213\335\357\334\257RoXw\227$\347T\272\370\352.\023\216\304M\237l\303\036Da\234s\226\370'\016\264\342\207\270h\226\230^\027C]\374\022\210\301+\365\311\344\320\250\253\233\bec\b(\267\312\003\0060X\211\203\t-\001\263;\245Ecq\221\251\270h\262\031,\006\253"
+	.string	"\233\271,\254\240\304\\)2\027W+\304-\027`2\327\254\245E\346\"{\345\303\271569J*\367f\037\370+J*G\036\202:0\265>PiP\233Z\253\216F\371#\003\006}\216#;\2400~\367K\\\324\032 \3025\035\305\303\0257\364\341\204\216\214\302-P\204\200T\2414\375\235\377\346&CI\345GJ\250\2414\247\224Q\344$(%\205\305M\007p\002!\2522\017\021\300\255\222J\026\024\262\263\337\001u|\341\330!\207\335\347\033\341\274\230\013\353\324\244a\365YD#\006\3641h\350rxx\212=_\"\020iP\242\254\265?\013\031\246D=b`\003C\004\234\002~\r\300\346S.\236\020\016\200_\235\017E\264\r\n\223\234\376"
+	.ascii	"W\241\002\260\372\322\300\223\257lzSD\331\334\215\344\331\375"
+	.ascii	"\016\305\004\224\376\277\212\374\273\346\310\021A/\f\260:i\362"
+	.ascii	"\026\220;\354\030\210\035\022OoT\375r\034\002\342\\,\235\n"
+	.text
+	.section	.gnu.lto_sendThrottleOrBatterySizeAsRpm.96.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\346\005\r#"
+	.string	"Z@\274\rE\200\236M:\003KWY\235\b\243\2009\337Z\335\247g\243|\227r\243|\256^K\005\333\313\367\236\201\266\313\335<\266\\^\204vZ7\"\3200\230\355\303QU\230\026\022\373Y\215pT\332\030\213\273\021B\344N)\310"
+	.string	"\275"
+	.string	"\312"
+	.ascii	"^x\244\356\345g\331\037b\270j\255A'mO\035KT\215\367\253>,p\025"
+	.ascii	"\275\030\234\\\n\263\215\363@\377\367+R\307\022E\202fiy\025k"
+	.ascii	"\255\016N\232\211\236\034\272Qyr\276\250<\351[\221\n:\271T\306"
+	.ascii	"f\277\212\037D\220:\225\034\265\335\017\001\223\242\027W\255"
+	.ascii	"?\006'\335\200\236\234A\236\262\345\374\247\244\316\266z\364"
+	.ascii	"\202xj\255\267\335\372\324\351\254$\307\235S\376\214\251h\fp"
+	.ascii	"M\027\337\356T\313\357\233\315\230\304>\233\220\361\222r$K\310"
+	.ascii	"\313*\241\325$i\220\217\343\202\242\330\035!_\325h\204\345\344"
+	.ascii	"\352B\035s\205|\275\261Vk}\327\347\016\037\325\2343\246Z\253"
+	.ascii	"\347\225/\353\006\272\355!\266[\330dYc9\374&nr\232\277r*O~\221"
+	.ascii	"\226\b\341\315?\026\232\022`:\270\rC\306\374\225"
+	.string	"kU\273\363\034F)\253s\217\375\243\232\253e\177\254\233\304\236M\033\030\247\013\320i\002\343\264\322\203w\3228\215tD\247\215\306\351\001'\336ED\007\273\207\376u\323\3504\020m\232\322\246gt\272\004\232&\351\364H\247w6\375\004;\206\314\026\326\266\371U\254?|*\031\371\345\311\203?\361\377\372\301>\332'\372bC?l\177\214\321J\244\275\255\036\305,\233\271\\\370\303\346.\3672u0(\272\363A\277\364\210\024K\320\223\265q\211\210\315\366\027\016\024R\360d\240\017\372Z\034\344\251\212e\201I1{\301\312OP\326\200\365\211 \212v\300\364\342+\332\023_+\332\0134?b\247u\351\363\260\323:c~y\350\224\373a9F[&\336\277\256\240\007\0302^\271Z~\215\222\3349\007\bGi\016}Di\22781\177E\356\255\030\251\332\335\035\206\n\227\022r\265\37615H\342\214P\345\320\346\200o"
+	.string	"\f\305\210\366_\343\022\355{~\310+\225\273\343\3161\253)T\363\217\355h\242h\255\225\202o\346gR\370MNZ\305\212\025\345\311]\333\222/"
+	.ascii	"\206V\206\366`\257\361\346\036\013\2306\213\026\363WC{0F\250"
+	.ascii	"v\347\013\177\036C*\263\326\272\333\003\245\201}\327i\031\020"
+	.ascii	"N\325\324\343\361\007\312\257\201\365\354\t\241\232\177\354\207"
+	.ascii	"yP8tM\272\023!H\230\310=q\300\321\320\351\236r1tBM\367\213\n"
+	.ascii	"\020p8\t\023\\\330\210t\267\223-j\006T\356\305-*\247\303\325"
+	.ascii	"\300\321\300\351n6d4\325\2709\345\240n\266\003~\272\201\313\335"
+	.ascii	"t"
+	.string	"OO\271[\320\217\367\261n\022\017\323\220\361\226\312>q\370\013/\"\f\031\360\357:ec\347\227\247\310\243\253\345\002\004\266\300\226\0179\250\325\203\257\361\326\034h\t(\255\037LZ\245\244}\220n\222\226,@{\340\315D\027h\251\234-\335\0131\374\215\006Zk\225\004\277\315\335l\350\340\301Cyr\266\n\336T\351*SVg\253\345\t\305\016\021\322\307Q^\370\017[\212\364\302F\242\245\355\016;\300D:Z$ G{\242\321\036\321{\254,\327(n\250Q f\031BH\221\004#2AA\322\346\200\002\031\2422;\021`\261\224ffS\220L\373\033\213\005\325\377Ko\300>\351\312\351\322\006\tV\363\267$d\003\276\232\226v\017\266K\320R\267z\312V\006D\264\365\303\036\2237$%\307\311\254\310\323\311\322\037O\333g\025\243\317:\004\004\003\223\225JA\276\022H\336\224!\263M\214]\316\372v\352\306"
+	.string	"\316<cV\212\212\226\t\355gD\242\200\256+\232k\210\255\306\356\247\345A|\257\274<\352f\251`"
+	.ascii	"\023\365\252\005\365\374\346N\027\3709\302\3117\327\0038\354"
+	.ascii	"h\277\365\204-\343gl\2148\201\211\232~]\344+\271A\310M\021\301"
+	.ascii	"b\214\210\215\3171\367R\337j\272\317\273Y\013c\275!\304\246\201"
+	.ascii	"\227F\232\364\373\252F\375\370\202\204i~.\024\313\371\364 a\234"
+	.ascii	"m\263*\251fK0\025"
+	.text
+	.section	.gnu.lto_sendTemperature1.97.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\002\002U\022"
+	.string	"\246\"xG\340\320(\035Y \0229\300\264J\021\215!\r\203\233\350\307\221\332n\fH\377\204\023\n\322L\323\2328\313\b\322\237\376\r\254\022}4\017\020\016\306\330\013cl\260<*\231#\3059\245:\340\343\204r\355\263\331\275\245L)c"
+	.string	"^"
+	.string	"g"
+	.string	"#^\337qE\350j36\334\234\323\343\322\"\335e\200\023 ]\352\007\220.}\235\027\352\222\203\205\312~\216?\026\274.B%\025\013\017\324\340l6s\206\035\227N\320]\036e\230\r\343a\207Y\242\t1\273\021\3159\275\2459\354\n\363\217s\023\355%v-\211\3149\255\264\227\332\275\267\215\300\366\003[k\001Fv\270\242;c?\316\225\261\243\372\364\333m\222\352.\252KR\035\243z\243Z\243\372"
+	.ascii	"\326\005\f\315\315\276\bg\313\021\215\031$S\200\370\355\267\357"
+	.ascii	"\353\374\346\373\030e\330l\t\251\301\331\210^\267\371=\022\206"
+	.ascii	"l\346\234\250K\333\260\357\270R`8]BpJ\330:.9P\250\242\236\307"
+	.ascii	"\017\037@/$2\250t\262\337\276\021s\312\371\374\364SC\350=\357"
+	.ascii	"d\254\b\213b\304=\317-\002\252\221w\343z\314r\340\220\356\256"
+	.ascii	"l!\273\371\370\352\306\0322\016+zd\373\273\t\n\335\234\023\304"
+	.ascii	"\3779\220\211\377\341\322'+=mE\272\374\026\360\220\003\352\221"
+	.ascii	"7\\:\325[\005\311\306\220\242\2479\305\2621\353\211\031BS\003"
+	.ascii	"#wI\003\005\337\007\302`\202J@\353&Q\271NRX%\236\213\325\372"
+	.ascii	"V_\205\257\345Y0\031Yy$\254\024Oe\300(\027>\226\327BAay\250\020"
+	.ascii	"|\234+c\b\033\202\300]\261}\236\037\347\261h\022\341\300\223"
+	.ascii	"iO\032L\373\333S\340\232\366\263\\\027\267[\007\262\034\252V"
+	.ascii	"Z\377F\2421,\033\363\217vKk\235\301h+ P\202A\254\354\016uY\204"
+	.ascii	"\366hd\215YY }\307\2247[\0228\340\002\334\375\324\206\316\226"
+	.ascii	"\330{I\\#]X\232\027\365\013\200.\367\362\3625\232\220\224\307"
+	.ascii	"J\273\305\326\0240N\330\021LB<\230\026\f\312BOP\324\1777\033"
+	.ascii	"'&,\tQf\207\214\255\300\034\016\363\323\257\006\353\330_\333"
+	.ascii	"\2059\267\020\326\023"
+	.text
+	.section	.gnu.lto_sendTime.98.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\277\003\205\030"
+	.string	"\226+\230H\260\030U:E\022\017\225\376\030|{0\347@\335n\213J\322\321\326J\003N\364hKa>\376=\205\252\002\244\327\326\203\272\357\336\210O)\336~\250\230s\2418[U\330\256?\017\374\315W\031\353\275#F\b\331D\356\224\002\203"
+	.string	"}"
+	.string	"\202"
+	.string	"\324\034\306\323"
+	.string	"\323\327\201\215N\0338A\331\037b\b\021`\027\0223\315\312ZS\341\206\017\367\3330\236\316\3778\216G\f\242\034\310\203\310^\316\2143\026c\221\035\030>\r\343\251\351\006\302S\360\004\302S\006@(\b\021d\307\305L\263"
+	.string	"\225\026%F\216Z\313\226S;\030O-\263\245\274\254QE\03354:\277Z\353ii\\\366)\363\217s"
+	.string	"\266\333\354S|\251\265z\332n6\367\336\366\002\333\035l0C\263\247\343\247\316 \273\244\315\235a\037\254+\303\246\323%q\232\205N\223^\336\242pZ\024\247C:M\3514\030No8=\303\351\027"
+	.ascii	"\2254\261\361b\237\224\265f\310J\365\241=\034/\177\373<\277\347"
+	.ascii	"\310\007%\246\334\017\307\343:\337\210G\226\301\236\343\363|"
+	.ascii	"\340\361\250\265\216Nm\313\236Ka\"\313\312\242B\356\207k9m\300"
+	.ascii	"C\321\371\035\237\310\213\300\236K\301a\264\231\201\363\325Z"
+	.ascii	"\037<\213\241&4\262i\271\257K\351n?~,\274\356\245\033R\310\310"
+	.ascii	"E<Wx>RaRV\231Rg\220\303\375\316\375B7\334\007#\270t_\263\262"
+	.ascii	"\013\356\356h\204\3109\344\0018\322<p/\tm\0220\3636\233V\370"
+	.ascii	"\370\2519*bc\355\270[\270y\222\317\335\005\201j\275\013\237\t"
+	.ascii	"E;\027\324\231\275\035\242}y\0239\203,B\371L\370\025\355\201"
+	.ascii	"j=hs\310\242i\257X\363\266\357\211\033\332\316\034 \376\272K"
+	.ascii	"D\f+\245r\211\036A\001\245RI\230 \302E\200K\365B\021\003\263"
+	.ascii	"\022\235r\201\225p\265F\234`\255\227j\2452\241z\235b`@\254N\251"
+	.ascii	"\226\353\344\242\300,\031U\353\364b\261Z\247QI\036\254+\303\036"
+	.ascii	"\222\370\220K\263\317\333\271\250?\037\331\344\347\221\326\347"
+	.ascii	"\211K\272!\221\341\365\034y\216L\202\tew\277\210V\334\335\325"
+	.ascii	"z\264\036\004\003\200\354\3748\247-|~>\262\264,[\332\323\b\221"
+	.ascii	":\027\273\020\272\233H&\017\227%J\250\201 \247\230C\244\314P"
+	.ascii	" \022\206\322\264p\200\002\221\261;\017\022@\225I\222\t\220\205"
+	.ascii	"\3312\313\3653CVET\260\226\376\366\312\266\307\220\036\366\031"
+	.ascii	"\274@f-\002\210\343\005\356~,\216\214.\207i\316\302MGK\340\362"
+	.ascii	"\0022\256\277\002)\312EN\365\275\236\355?\354\023E\360F%\373"
+	.ascii	"\224 \030\004\330\237=\026\001cv9\201\320\3727 \023)\2103\177"
+	.ascii	"\361\331fF%\031\250\004G\276)\307]J56*\336T\002\330\366\225\377"
+	.ascii	"zG\020&\202\016u?l:\215\377\246\216\346\006\035\322\206\273\211"
+	.ascii	"\301\371H\026\226'\b\247\205\300\374\001"
+	.text
+	.section	.gnu.lto_GPStoDDDMM_MMMM.99.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\n\004-\032"
+	.string	"\326q\250G\260\326M:\016.\217f\253\335\301\364\214\311\311J\206C\333\022'\024O\002\247},\216\252H`\350\277\305\007\345\371\230\013\026\375\355 La\217{'(\371\020\302\037\005\362\377\001\205{\310\212?\3501m\t\331\204H\231R\225"
+	.string	"\205"
+	.string	"\222"
+	.string	"\273\035\033\312\b\247i\252A\370/g\307\216\375d\024\"}\b{H\271`\262\273\004\376\231\201sV\354\344\3564\216^\243\b\300\313*\331\0301\265\2733`\005\341?\357\302\234\022;O\3732>\343\350NFv\355\236\3401\265\273\006\\ \374\207\363\231\370\317;,\376\363\221\275\344\273\025\013\262h\342p\003\312\356\316T\305\217\376y\232G>\330\343Z\322!\375\013qOE\027\342\332\242S\362pv\367R\317\016\272\244L\260gw\235K:\020w\274m\007\266#\330^\203\231\345"
+	.ascii	"j\243\277\312A\301\345\226c\230$\025\221#\233Y\366.)5\205}o\025"
+	.ascii	"\205\375\032\277\200?\335\262\330\241\356\233G\3356w\372\003"
+	.ascii	"\200\351\032M\323hzF\3232\232\206i:\006L\303\304\364KL\273\304"
+	.ascii	"tKL\263\200\351\225\230~\305\264JL\273b:\374\322\240\227\216"
+	.ascii	"^\372\323\264\247i\325tj\372\003`#\214,x\262\353aK\312\026\371"
+	.ascii	"\250\\\374\351\207\372\243\256\366\177\3438.\345W\016\214(\023"
+	.ascii	"\020\002_j-5y\351\212\212\272\364\245\3171\311T\305H~\213\241"
+	.ascii	"\272B\365\206\254Pi\345\356\"\251\246\360k\021\324\t6\224(e\024"
+	.ascii	"\333@\237\252\205\273J<~\217\373\260\340\267\370\347 \241\374"
+	.ascii	"\322?_(\376\003U\306\302\t\227%\323?=\307c*{\022\213\032\323"
+	.ascii	"'\270\206\370i\364\364\323\253^=M"
+	.string	"\254\034S\221\211\252\275\205\304T\325\347^\334h\252^ibq\230\202\303\272\321CyG\232\366\266\2126z\243\347\221\213\221\224[N*'6\372\250\343\340\002\267!\240\333\004\237\bD\243\240\030jAJt!\303\215f\213\256\200`\207F\3439@A\007\3466\004T\253i\b\002\375\243\263\301\302\315Va\266\301FD\013\242]\240\021\3150\324|\202f?\266\333LGf\241!\232mF$$d\233\275v\270{\253(\036\220(\202\323$\327\250-\341AX\276\324\204Fk4\301$3J\243\237V.\206\214\306\350\214\352U\216\351:\016S\031XLc\252D|0@^\024\306E[\364\305\345\026Y\264\205E=\253*\235\267\242\266\317\255~\302\335\345\361\177\364\320\\\222\354\356[\024\305\007L\250A0\005\025T\244\206$\032\005\0051h\306\260\002!\262\325\003\020P\211\2066\313\034C\252\001\214\205CG)\273w"
+	.string	"\276\021\235\227\177\206\207\310\366\332\246~\260\3454\203&\331S\221A\003q7'%a"
+	.ascii	"M\227\311$:0)\201A\212I/q3u\311`P\347\266\241\324qf\357\034\022"
+	.ascii	"\315;\311\303W9M\177\361\216\016\205\2434\350\002E|\240\207k"
+	.ascii	"\365<}\007\224\323fsG\230)\237(+\250f\356\3765\244\302\"\255"
+	.ascii	")\205\371\230\242\310\203\236\376\335\334\370\017\226t=\036c"
+	.ascii	"\251\255S*"
+	.text
+	.section	.gnu.lto_sendLatLong.100.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`Q\n\345&"
+	.string	":B,\016G\220\332M:\201\220)\311\265\331f\335\251\251O\210\"\254d\265\006"
+	.string	" \031\022\265\222\003\230\204\"z\317i\363{%\031\033\226\365\211K\272+\321yE\"\200\353\340b\335\231\001\265\300\017\016=\267\313-#d\023\"wJ\001\312"
+	.string	"\302"
+	.string	"\323"
+	.ascii	"\037\223~Kt\236\213\257\345[\242\316\005\325\241\254\021dkXk"
+	.ascii	"\205\360\321 \312\217\003\346"
+	.string	"\263D\365|L\002\263d\037\213%P\210\372\025)\333T\257\316\300Pd\270\205Vk\357C\371\221\336\347\036\244\252\245O9\225\335\253\274(\253W\371\313\"6\254\225\206\203\217\346P~\264\211GhK\237>\224G\271\224\335{0N\240V Y\274j\355A0\205\336\r\320\217\345}\350G\373[6\317G?(?zg\253yoH%\211t\311\360\241\325Zo+\344\273\323Q\334\271\363\357;\317U\326\324)\216\2171\254\246h\343+\036\231\375@\023 \213J\f\3421f\343\276O\254\254\2529\311\r\265V\317\253\254\0327y\333)l\207\260k\273%r\245\021\037\006\375\370=\226\016\336\274c\237%\023L\311Y\235t\354\036\325\334 \366\305\272@l:\335@\211\234N\242\323H\007\336Gt\232\201\0219]D\247\027<x\333\350\264\002\"rz\210N'8\331-D\247\203\200\310i\004t\372\300\205\367\317{?"
+	.ascii	":]\243\323<t\272$\247Ir\232\322\351\221N\213\344\364\222\323"
+	.ascii	"\223N\277\202X'\007\221\337\232\351\325\031w\352\324\262\361"
+	.ascii	"\013\311\201\177\360'\373"
+	.string	"\205\177\025\241O\346\214I\r\231_6\206)M\320\037\013\303\004\007\350\213}az\003\346{\371bZc\343\032n9\371\317\367r\217wQ\267\342w1\305\351\331\235\013\312\306\353U\032\030\270\206[\016\002C\236\203KQ\236\365\301\036\246B\312\352`\027\320\2037\351x\371\262\n(\337\352]Dq\203L\367\250>\217\\\3610[\347\250\270?T\306\252\346\034q\347\033,\035Q\214\266\204f^hC^\020\320\006\001\355\205\b\026\350i\276\213\340\300\372\302\237=\360\263\027\336\306\373!s\266{\263\020\373D\310\311Y\365\305\374\276\217;\222\240\ry\n\210V\301\r\242\241%*\347\016m\006\2534\252y\307=5\022\254O&Bh\023\354\347\226,\241=\331m<\241\315 #\255\226V\366\232\026;\037\363\322\r\260'\247\315^\314\275\201\347\021\367A\225\265\326\ns\207\316Di\"`\372\334a\324v\302U\355\224}\230"
+	.ascii	"\230\267r\337\211\253\257\235b\305\374\225m1v\312~\231M\177:"
+	.ascii	"\356\251\211\305\211\232K\\\230\200\303U\260@\"\002\001\022\272"
+	.ascii	"\\\316it\302\265pa3\241k*\355\024A*\205\013]\211\233\224\356"
+	.ascii	"\t\267\002\247\002\367tcq\242i\305\315I\347\342\026a\310\271"
+	.ascii	"\0268\335\355)\227\323\335zz\274\213u\264\317\200V\232h`\315"
+	.ascii	"\003\2332\336R\371\205X\253\017\r\257\362\017\247\314;\366\177"
+	.ascii	"\\\264~\247\363\377j\353\377\272\240\370yu\241\340B\307\005\342"
+	.ascii	"\271\356\372\0168\323`w\030\345Y\2548/\323\3121EcA0Z\f\214\226"
+	.ascii	"\201\321>X\264F\344\026-X?h\333\005\266}\3606\236m,\f\271\007"
+	.ascii	"C\206\t\022\003\206i5P\332\006J{`\322*\321MBZ\037(\342h\221\216"
+	.ascii	"\366\300\333xGb_\350>\214~)\340eL\023\307/\260.C\264\200\274"
+	.ascii	"\250a\\\"\231\232\031\021\005IAA\222\341\020\003\021\241m\036"
+	.ascii	"\022\340\362A\230$\2414$\0204&E\345\207q\300\247\256C\321H\037"
+	.ascii	"\231)\253\370\326\366Y[*\317V\345UN\374n\234\372\342\343\t"
+	.string	"\256\344f\257=\274\006\316\204\031\260E\n\223J\036[\034\326\364\002Af\013\214ZXQc&\315\006S\346\250\220\372\311\222\337&.\334\030\241\036\224\n\210\360b\024(\254E\323\026\002r\214\3244\261\345\034&\245T.\304\356A\231\201\023\253L\201\034X\267s\353\314\202!\340,:\317\264\346\325\272AG9x\326\020/`q\271\222f'\205\341\\n\304`K([ w\227X\236\004\260l\001LC\216\331\003\243\026V\324\330\246\230\202\361A3\360 \020j/0\364\033\025\331\235_\033\004)@~\002\320\240XjB\343\214\031\244\351\343X6\0060\220\037\262i\fw\217\2314\020/\265\327\327\234<\355\364\361\331\353e\367\223L\246\247\r\374\252%x\276+\232\n\203\323\350\320\2203\232B8\252\030]z \254},\207\207a*\034\266\216B*\3737\310\345\013\352\233\034?\364p\tkY99N\351\336\024"
+	.ascii	"\177\305\323\373!+S\322C\r"
+	.text
+	.section	.gnu.lto_sendVario.102.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\311\001\025\021"
+	.string	"\266\037oG\360\260(\035\353\373~\274\373`\345mL$\\\374}\030\243\021\365\3750r\227\276\357\242\225\214U\205[\243K\376\202\377\204\355e?\025\204h\266\251\343#\233y\006\205\226\025\017\244\301\305\323\217\261;O4\b!\233l\231RX"
+	.string	"Y"
+	.string	"["
+	.string	"\265*8\265\307;\rp\002\334\351~"
+	.ascii	"w\352\303\224\276S"
+	.string	"\220\031\240\375\025f\340\240t\025(\235\023y\3005{\241\250\225\f9u\002\357\364\237M\266\215\223$j\347r\221*i\265\326p\216\270\351k\362\377r\017\325\352\364\355<\265V\257j\305\272\347m#\260=\301\336\013\001u\266\330\333\332{ywt\315mkJ\327\273\255\377\321\032-\327\213yC\326\225\232\216\032\2431L\274\374\355\3730/\375\031\1776\325\025\021\327\354E+\375\345\313T\270\371Nm\233\036C\352\214d\375 B#\366\n9\005\201\001n{\230O\236E\3511$\n\036\313\3455\253\001tzS-\324\326\2745\253\026\036P<\225\227\007\300\362\221#\373\314?hv\310\252\314=\0346d\216\033;\017\273=\343\342\370s\347S9>\315kL\374\022>\371\354U\037\356\364\323\2435n\315\005Dx\273\340\226\301\331\035D{\225;)\363\344\265\t!\253\213c\223\250\235.\366\267#wI\204\006\242\370"
+	.string	"\002\006P\300\350&\001I'\242PIH\n\215\304\217\250A\034\205\033LF>!IH\024\202\006\f\342 \206\302\021\b\024\n?r\374Vg\213-\234\210\215\023e\373\260\377\3454\305\2146\033\275nz \272\371\362\035nv\336NnJP\311\371Xt\372e\206eI\231'\277\366\031) @\002c\224\253\036\265\262\210\366hc\215\232\b\333z\232\275\033S\bKg\347\305\006\337r\037]aG2\272\3610\262\200Cf\215b"
+	.ascii	"\3108Fl\355\237\314Z\224\2261\020|\013\356#B!Q\003$\324o\327"
+	.ascii	"Y\207\003\222\204s\026\207\206)\224<\324\026c\371\351g\203\265"
+	.ascii	"\332_\333\205:\267\020\302\023"
+	.text
+	.section	.gnu.lto_sendVoltage.103.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\257\004\275\036"
+	.string	"\206\370\302G\240\230\316p\203\346B\234'\332\ry`\022o\204x?f\253\265\256^\t\326\374\320U\322X\017"
+	.string	""
+	.string	"\206\360\214>\217j8\226\005\031\332\376\320\303S\360b\316I\324\0202\005\305l\307\356A\241\026\237\032m\262\273I\231R\263"
+	.string	"\236"
+	.string	"\253"
+	.string	"\277\323,\301"
+	.string	"\312I,\360\221"
+	.ascii	"\221\"R\317\305\364\255\245\b\345\324\n\"\230i\232\007"
+	.string	">:\303\2030\335>\022hRd\037\210\021\0201\375\307S\016\3524I0\300\002#\212](?\3768\276\343Z\276\t\270\342\361\036\276g5\345\242pf\024\326\025\030\021\312\217\271\031\215\347\270\016\337O\247\322,R\n\271\260\200A(?\342\216C~\324\333\220\037\005\354(B@\344;\361)\007\2053\201W\264\3000\315\263\300G\033(?\332gk\371\331\302\244aU\021j\211\231\246\251[\026\367]}\376\265^\033JA]i\016L\323\264\016\245\246\356\275\355 \333\032\354\361'\372a\316&Y\001\027\3129O\230\344(\371\302\301a5\026fj\027\373\004\352\256\260?3W\205M\252\203\200l\352\037R\235{\361\366\351\341\371y\357<\353\3269\361\316)\3257\244\332\206T\327\224j\232R\215\263\251gJ\265L\251\216\251\251aJ\365\255T\333Ju\255\246.I5\215T\2235\365XS\317j\352\255\251\265T\177"
+	.ascii	"Q\213\252\024XV\226\312i\222\370Bfz\215G^\274\370\023\377\363"
+	.ascii	"\317:MG\373~\220\027\375!\276\331"
+	.string	"\307t\037\276\220q\206X\025\3214\315\333G\256\255\245\\\024,\350\207\316E-\224\325\311\215\036\231\355\231\271\023\031\2632{!\025\314\306\224:\013\2633/\3012`\r\236\333\362\354\263\bM\224\027\"m{\333\007\311t\326\2663/\302\262\030;\373sv!\262\266;\373,A2\340\223\274\313\311w\341\021\030\364C\f\344\307\332\006\270\242r\202\342Kg\237U\356\270:\253\305\240\r\332\226{\275\273Hri\373\240\frw\272f\273;\356\203U9;[\232\226\245\\\210\324\335%\273\2022\200\372\305_]\235\",\373\351\027\343\324\336\031\351\207\337'\034#Vca{\342s?\355\342\030\265;x\b\273+\235\327a\247t\324\233p\333\260\353\0355\355D\320\314aA\002\036\257H\301\206!\032\245\020K\275\007GG<\243\232\215\206\232>$!q\3205!)\361@\360\216xJ\272\020\036v tFHI\272!"
+	.string	"\356\211\340!\351\224z=$\335\355\374}U\270B\227\327o\201\276\331\257\017\303l\366\206\334\232\265\331\007\217\320l\315jQX\206\344N$ni\242\340\366\346\212\252\310\227Y\374\265>\"\361\022\003\373\005\001m\320\t\240}\361g\201\316\3443\373\263\r\202e\267\251\334\372E\t>\233\343\222\362\331\027\237\363\331\006\266\262!\267my\371\272\220\227\\\226\234c[f\366\\\267\203\337\314\016\361FI;_\250A@$\021B\202R4\"\322\224$i\fp\002!\262\262m\021\220=g\224\302\262\031\2170\225\021jl\333(}@\362\255Z\365\335\235B8\312\254\276\024\027\0132\024"
+	.ascii	"*\276\034\341O\006ZE\254\275\023!\237\232T\b\376\223\356\272"
+	.ascii	"\232\006\266\234Rv\246|\214\242\212\231\210\023v>\240\004\207"
+	.ascii	"\230!\"zbr\367,\244q\020\246\217\343\2348\224\027\307\314x1\n"
+	.ascii	"\t\361\215\007\"\330Wx~`\316\302\244\033?U\022@\325\354\267\030"
+	.ascii	"\212=O&`\377\t\027\330tWA\346\013\243\002a\215\240G\026\202\226"
+	.ascii	"y\274g^\350\306\202}\007\020\006\236\016\223\r\364\240o\304+"
+	.ascii	"\251X\031\375\304P\377\355\251 \342\203\230.\222N\005"
+	.text
+	.section	.gnu.lto_sendVoltageAmp.104.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\203\007M("
+	.string	"ZE\004\017E\200\334M:_+\032\206R4\334\323\326\260\361!\234\016\373 M\377\024_\rak\275z\313\257\375\262\240\312o\250\t\232G\013G7\305\373U\377I\334\035\214\225\271H\262\227\356d\210\324\030\332cH\243\335\344N)\336"
+	.string	"\313"
+	.string	"\334"
+	.ascii	"\036\016\346s1\317PNG\372[\326\252\f\357\365KK\215`\021y\362"
+	.ascii	"\270\320&n\213\301\253\2022\245J\377\345t-5:\230=\256\266\340"
+	.ascii	"\316\363t\360j\016\346\253\357\345\304{U\220\246d?\213!Lp:\226"
+	.ascii	"\247`\024\362\334qa\t\334V\234\006\363u\337e\336\221\033\245"
+	.ascii	"o\375\n\324\271l\230g\322\244\032\253\002w\236H\006\257n`\276"
+	.ascii	"\376\016,_\351\007\224\257\206\262\337\216Lr\356\260\262\250"
+	.ascii	"\276\342\316\363LZ$\207\372\256\254\272\245P~\327\203\336\242"
+	.ascii	"\276C\273O\325\021\310\313\237\243\325\253n\001\334\227:\276"
+	.ascii	"\243Q\007\334\321\244\352c7\250\356\\.\300\315\353L\330\021\310"
+	.ascii	"W\027\341F\034\021\337qJ\327\303C\205\346]\2478\216R\224\356"
+	.ascii	"2\234\347iZu\354q\233\267}\332^a\357|\004\364UK\345\353\227H"
+	.ascii	"\tW\221\316\231\252\321\001\356\271\036,\322<\346Q\333\005\f"
+	.ascii	"\372*\340B\031\221\332(S59m'\315c#\245\350^\331\327\235{\304"
+	.ascii	"\256\324H\225\372hG\235\240R#x\3626\252\324\301\242\035\365\201"
+	.ascii	"JM4t\261[\350`w\320\271n\340\303\356_\245\006\252\324\276J\r"
+	.ascii	"\300\244\356\355\250y&\365O\245\366\251\324fI\275+\251\313J]"
+	.ascii	"+\265\256R\357\216\232\226\324oP\276\215\301\242\262j\220\347"
+	.ascii	"\2169='[5\313z\362\007\373\303~\261\237\353g>\032\230\265\202"
+	.ascii	"\023l\023\267E%\351\177!\363\313\326\352\rV\026\334\221\035%"
+	.ascii	"{\371\330Q\234\230\215`\361wN\351\350\342\304\204\371\2124\245"
+	.ascii	"d;\314\006\2107\311\373\260rh\037\346\263C\273c\213\264>\253"
+	.ascii	"#c\324\332\255I\200\332\036>\320W\355\366c\257Cvn\256.\322\232"
+	.ascii	"R\005\361\255\t\271\321\214\030\231\272W\026\226\3456y\265\t"
+	.ascii	"q74\345\026)\3412`\325[\023\332\213\325\025Z\212\006\324m\335"
+	.ascii	"\222\214Q\313o\273\272\275\021\npw\253\333\307n\272\245\361\270"
+	.ascii	"\023g\203da1\243\033@\203E\033\374Qt`\213L\272\007\026\203QN"
+	.ascii	"\212\316\231\327\203h}\260\021AKD\275\034\203\366`\017\006-\206"
+	.ascii	"\0379.\377\t\333\323\366-7\347\210A\336\221C\367_w\206\"\335"
+	.ascii	"S\311\025\220\033@-\334h\245]\302\004}\225\203S\033\345\236\332"
+	.ascii	"\036\253Ir\031\331\013\313o\n/6S\024\217\355\023W\023\232\347"
+	.ascii	"9E\301\037\3634\025>\223W\017\227\002\303%!\361\005\023\215\335"
+	.ascii	"\f!\013\032<\341\2117\013\013\022\206C\n\025V<\b0\\\022\022_"
+	.ascii	"0\211pj\032\022\211\302\024>\253x\340\344bF\023\213$\247&\342"
+	.ascii	"\020\306\360\305\220\230\024\243\205\020F\222\212\246\031I\017"
+	.ascii	"\210\314$c\330\224DdbjJ\342!\213\327\235{\244\204\025\266\342"
+	.ascii	"J\331\007\373\372\273NB\216\255xf\366\336\332\024\266\342n\257"
+	.ascii	"\374\2644:\241\rXbTeuh\177\213\203\301\237J\240\365\317F<\f\212"
+	.ascii	"'\363\354@F\2124\017\032\0302\024C\2755f\276\005\332\272\307"
+	.ascii	"\250U\001\254o+\232\261Ho\001\334\315\177\3333\223\242d J\333"
+	.ascii	"\351\223}\215\307\035\270\342Q\202=2\203\242\362d\032_\346\274"
+	.ascii	"M\200`\375\244\321\"0\332"
+	.string	"'\0374\372R\306\333\223\335\031~\226g4WP\376\366go\324\222\202r\3419\326\236\264\375\002\200\227\250\201$%\025c\210h$(I\222$\035\200\002\221)\253z\022\240%E\315:\207f\244)Ie\2371\213\240\3275t\fb\343\346&\035:\266\277\023;{)\261\004\263sJ\002\020\005\024\270\250\322\275\233a\272=\224\0203g\2655&\331,\253\310WZ\336,b\374\351\022\220\305>\272B\023\256\362\331\275\005\033q\212\bQ\302\324C\201[\r\275Pc\214X\260w7\214\371q\240:\033\222\023\203pM\201\322\225'DRl\036\304\243\273\016r\201}'l \331\021m11c\361\306\246`\235\017\333\341\204<4\202\254d\240L\315\0262{\306;\3015-X\260;\310\320 .\372\035\246'\227\236\372uf\025\324\372jT04F}\022\363_9H\316\345\031\335KT \024\0041\270\003\214\bx"
+	.ascii	"\273\022X\304k+[\006\230'\001V\310\357\214(\331\320\220\221^"
+	.ascii	"D:\251\201\3423\305!Z\256\255\267\342\277Y\001p\314j\267\032"
+	.ascii	"'\002D\213\311?Q\356B\373\332\034ki\235\273\256\314<\023-\217"
+	.ascii	"o\b\314\036\222\351\310K\271\231\006\3637\354\256\206_\316_O"
+	.ascii	"*t\212\004\037cO\032\0258fE\027j"
+	.text
+	.section	.gnu.lto_sendAmperage.105.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\321\001=\021"
+	.string	"\266 rG\340\262(\035\311\247\246@\202,\320\022L\230\206t\270\bs\024_\256 \303\340\341\303\033\365p\323\270\306\3530\322_\355G\227'\204\334\013\036\302\031\302\220a\376\347u\004\206\351\256\230s\2760\235\316\200\304\330\354&R\246\024["
+	.string	"\\"
+	.string	"^"
+	.string	"01\331\234\223\301\245K\334\245\200\027"
+	.string	"]\352\t\200.\375\032\225w\t2\203d\037\205\033<P\375D\312\210%\"\210\221\305f\346\024C.\275\200\273\274\347\225\255\343\"\211\031\222\261\341\032gs\316oG|u]\371\247\271\350\325\302\272\206JsN\353\253\305\345\336\333N`\233\202\255\246s_\354M\335}\274ER\315m\352\220T\357\246\326M}"
+	.string	" \037\03128\366\2068Yj>&\217|Q\342\343o\337\257\371\350\347\330\363j\262\210\304\310b3\325c>\216\005\237\2319\247wi{u\233\324(\024'\b\221\034\263X\310%\210\013\322\246\277\361\305\247P\335&U\201s\t\272\241\265\272D(\213\026\025\037R\270\225\217\017"
+	.string	"\353h9\357V\374\3509\3169\036;b\217\035\273\277\271K\241\376XwW[\270h\241\326\334}u\245\316\212\211\226\326\354\251]b\242\177}S\260\326\262l \006\247\nn\035\220\355\001E\377\362HeYV\0320z\246\376\330bK\027\306\376\026\246\233D\202\003\020\204\020\001\003i"
+	.string	"\352\036!\245JPN$_\352\204\002M\300\r \352\343\240\301d\362\215\234P>\322\001\237t"
+	.string	"O\037\352\344\344\364yb\370m\356\213/\354\360\204\333\262\375\233\237\346\262\006l&\013;\321v{\027-\f!\332\217\037\205+\332s\273\334NX\241\271\204\326\0373(LeY~-& @\002\203\024]\017u\262\210\366hc\215\254,\024=\307\024\315\342\203\374)\214\240\267\213,9wB\030\205{K\263N7"
+	.ascii	"\320\370\215\227\267\243m\bm\2424\n\330\231\002\306a\250\030"
+	.ascii	";E\376}\263ub\201\222\020gvhl\205\346p0?\3757X\313\376\323.\320"
+	.ascii	"\271\205\320\237"
+	.text
+	.section	.gnu.lto_sendFuelLevel.106.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`7\005\325\035"
+	.string	"\2464\266J\220\330Q:\303gr\371\005\344[\024\367\017t\324\003;}\001\310\201\231"
+	.string	"d5\324\367\f0\025\274?\002\375\033\376\234Q\220Q\031m\260\016\275\300\035!\263j\004"
+	.string	"@2b\032\311\325hR4\354lx\265e=b\t![\246\024\240"
+	.string	"\233"
+	.string	"\241"
+	.string	"\276\216\357x\217\326\224,\033\265V\327\021\017#G<\234hFEIFE56\224\037m\363b\277\263\2322TL\206d\037\027\030U\330=\221\217\3439v~\272I<\253\371\037\025O\222\032|4\203\362c\354\003\310\217\342\005\220\037\375\033;\266\353#u\231gS\375|Q[3\234\370\354\240Rk\235Q\027\347}\024\351\362\374\326\f\201\241o\n\311\344\371\310t\026\240\tt\2615\363\364"
+	.string	"I\212\246\220L\240S\230\371\023c\265\326\013}K\230\276\335\326L\255\325\0134\177n\362\2669\330\276\261\307\017\001n\"m\020\267=\320\261\037\345\361\026\201\222\252k\305>}K[\330\027+ea\357\032f\327/\017\336\260r\355\262\353\327\256\311r=\356Z\3345m\255\227\\\177"
+	.string	"9L1\203\212.9\253\211\341\225\0325.\321x\360\267/\364\237\234(\n\254\030\025\223!\331\203>\223]\346\355\226(\n\336\223rb\275\263\236P0D\311\027\362!\273'\345X(\177Z\fU\331\312\2170\033d\347\003Q@\244\202} v"
+	.string	"a\367\037:1\236\263\232\220\211Q5D\245\326S\366\3215\345}\354|(\"%\251\314\013a\217\225o\207\276\217\267 \231=\316\"#\307\324\212(t8\374\221\3547\022\351\211\036+\260\366\005\f{\240x\241\227I\240\316+(\242ke\007\222\272\016\351\372\241\324\027f\370aJ\325\013\377\022\324\222\365\364\026$\254;\275\264\022\236WQH\344\370=o\272gzk\305K)}\020\237,\001kk\330\260\007.\345\005\371(\217_E\244l\255\225\207\232F\236z(j\362\333*\266;\034\t\255\254\365\027\3017\362#4\276\214\217\256\331\354\2016\344\307S\0040p\364v\350\003P\\+>\264\353n\263\271\261\211;\\\b\352\232\t\017j\265\b\022>\304"
+	.string	"\260-\006\307\246\243\335f\"p\267\033\216\306\200\356F\243\246\211\321\001\201\223\253\231\351\344t\265[-DM7\023qC\273\315hr8\263\230\004\306\215\250\345f:\034.7s\235\275\213\225\262\260\006\254\250\036\365\331\0276\375\200UTP\351\343\013\214\276\300\350\203.\024F_\216\324\205R\350\311\362\355\020\206\372\301\f\033\364{Q\030\352\365I\341\333\341\233jt\312Z\353{\036dZ\032\351\225^t\244\353\304?2z\254G\364\013\235\005\013\352\274\252\"\351\213z{\246(yg\250QD\245\230B\204\210F\222$)l\306\220\002\231!J\017\022\340TEW1\264\244 %\232\3663\226\"\275\354:\034\330\317\341$\337\243\311\333\333\273\266\213\361\257\0362E\332\261P\020\260+\020\244\261&\351$;\331/N\303\024\361>\304\005\274\317'"
+	.ascii	"!\243\036p\204\306\274\306\377|9\275\206\002\320(\203x\316i\221"
+	.ascii	"n\035p\311|F\373\036\224\322\2337+nq\212\233l~\363\244l\342}"
+	.ascii	"\006\305\225\305\235XY\013<J\345\344\274\240P\214\313\227\212"
+	.ascii	"J\243\234\237\356\375v\024e\255\334\232VY\bT\327\302\004\025"
+	.ascii	"\004\275\022yF\023C\023vH\274,N\245\320\312\311\240\375p\006"
+	.ascii	"\\;\255R\224\342\202P\330 \b\205k\021@\241z\221\234\004\316\336"
+	.ascii	"4\006\304\337\302\017R\270mn\275\247\006"
+	.text
+	.section	.gnu.lto_sendHeading.107.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\362\002-\024"
+	.string	"V\343|I\340\360&\035\233\257\365\022\245\225\200\352\216\373U\n2C\220\016\3066\026\025w\0063\261G\3415&\334!\204\350>z\016\232\3328\007\341\214\002\002\034\002b\250~\362\2717\204\241\001s\232n\003\246\013/D\032!\264\333\226)\005d"
+	.string	"d"
+	.string	"j"
+	.string	"'_\"v\037\330\003o\346\206f\253\265\202\234\232\304;\005p\002\334\351^"
+	.ascii	"w\352\223\210\201\247\037G+\373=N\260 \366\021,\251\026\022\225"
+	.ascii	"c\243\355\324J\252N\215\300;]\3202;\306I\234\332\351`\200)o\265"
+	.ascii	"\326p~\270\354+\363\317\363\323L\246\345\333\221\324Z\2753\231"
+	.ascii	"\231{\336\366\001\333\016\3549\006-^\0264Hu\223l\322e\347\215"
+	.ascii	"}S\2356\266i\375\235\350\3323\255\273\2277G\327K\327\347\350"
+	.ascii	"\204jt2L\027d\215Y\262Q[\320\024:/\177\3735\237h\250$(u#i;/\375"
+	.ascii	" \203\226\325\030\221\034\033\355\026;\315\007*)\301S\333\262"
+	.ascii	"\373\300R#Y5\210\334H\232\352\364\243he\332\3778#/J\340L7\375"
+	.ascii	"\222\305\315n~M\310p\363\345S#7G`\224>\245\240\177D7\220\016"
+	.ascii	"t\217\306\n\262\306\214\235\377\271I\306M\362\367\002\334\347"
+	.ascii	"N\220\027\021.\273d\333\344(`\036/l\361F\022:pj\255!'^\204\342"
+	.ascii	"\2038uJk"
+	.string	"?kq\247\237\0360z\306]2j\203\267\003n\025\234mae?s\352\302\f\254\373\244\201\002Q\fa\020a\025\340u\233\254`)+\256\223\020\346z\211-q\202\370\n)\240\260Z\241\211k%\\uX\245\202\350\n_**\256\020$\307\233\352\2641\204\016-\306\351b\277&dt\263\2154GW\335\257\261X\270\327\316\341a\334$\242!\030w!\024\007\003\250\032\244\352\377\374<\2472B\334l\343w\232\037\315\311\233'o\2477\003> `\002!tv\033u\262\310\263g8YcvFD/\003A\251\267F\030\243$\204\273\313\273\200\335\005/\003]\216\315\364\262\215\031\304=\2203\373,[\003\226\b\013\b\245\357b\354\316+\264KI\317\235\2564az\002\316=\227\035[\003\316P\236ik\215oa\013\013\324\216\300\262\367Xbo5\226X\375\335\262\025\343\236X<h\232VnrT\203^Z\201"
+	.ascii	"\301dvh\354\302\223\207m1\220\237~\032\254\321\376\241]\030\347"
+	.ascii	"\026\202y\002"
+	.text
+	.section	.gnu.lto_initFrSkyTelemetry.108.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"\215\b"
+	.string	"\026\320:80\3456\035"
+	.string	"\360\3077\311\306Sx\340\244\317\205\200\036*L4\337E\241\223\322\301j_\235\b\260\215\016Ml2\215!`ih4T\320\256\330\2630"
+	.string	"\231!B\244L))"
+	.string	"*"
+	.string	"+"
+	.string	"\267\374\331-\017;\366#\215\013Q\314\356F\345\370\367\374\374\223|"
+	.string	"\374t\236\001\b\273\353\004?\031\267\336\266\201\355\003\333.\001y\360\232"
+	.string	"\252\320\216S\005\204e\023\200\035vR7\354O\273\273\326\220\235\351|\372\002\005\"+\336h\027\243\024`IT\312\207\355(\027\246\321\300X\371\222_\355M\226\007S7\220E\310\3257y8\341{X\333(\177\253N\245\b|\361d\311UN\217\250l\t/\2762\336\206\3031D\217\353\260\fs\300\272\370\320\260\220\305\213\343\304\f\2015\b\214\213\235\246q\321\n\367\323jHa\204\344Q\n\247\372'\017\016"
+	.ascii	"3\241\347\037\030\322\\\005\266\201\024\260\267\020&\300\tAh"
+	.ascii	"u\240V\241\013\326/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_freeFrSkyTelemetryPort.109.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"}\b"
+	.string	"\362O98@o\323\001"
+	.string	"*\320\307v\344\305\370\t;\347\301\320Ng\336\201D\024\200\371\276\247l#\366+C2>=b\326\226\252\242x\262"
+	.string	"\bX\035A\260\211\346\006G\320\226)\005\346l6\006O\2460\267L\263.\253\301\322\246\303B\30259\231gn4\306\036\254lj\030\226\315\314\267\217\243\n$\261\244\204\242\204\375K\372$/]X\247#_iN\250\214\203\344\210\300\tE`:\221\372hCD\350=\027L\304\316~\310E@~\207\267\217\336{\345\177\344\253G\314EHC\017\200\313\262\262\352b\177\235F\r\373"
+	.string	"\033G\366\325\227\007I)\225-\334\255\b_\326\2442y\330\276}\020\316\316\230\263Q\376q\354K0(J\251\335\235q\343\334\225\363\377q\214'\352\256\001\b\273k\365D\026w\274m\003\333\007\266[\002\017"
+	.string	"3\001\223~\306\251\271"
+	.ascii	"\266y!/\f\366\205t\300\022S\361\320\312\006se\241k\270\301\020"
+	.ascii	"\036\270t\213v>\001"
+	.text
+	.section	.gnu.lto_configureFrSkyTelemetryPort.110.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`w\001e\017"
+	.string	"\246\234gF\340\264&\035\350\276\226\327l\354H\265`@\344\324\3079\256\036\007\304\315\301e#\216\320x*X\230\346\265\335\224\263\360\001\272\305\306\352\375\266\033\236\267\301k\021\003OH\f\023\221\201\3710\356\320\020\365C\354\275\245L)T"
+	.string	"N"
+	.string	"S"
+	.ascii	"\253\003\016\235\260}\222[6\220\313v\3665zn^\030\355.\247&\336"
+	.ascii	":|\232-\177@Ws\030\342\357-\360\341@3\351`\217\024dCA\352lR_"
+	.ascii	"\002\234\240\033&\335\353\025\360\341S\342?\317\016\235M&\200"
+	.ascii	"\225\335u\306:\020w\274\355\007\266\021\330"
+	.string	"\377\021<r\207\013ZMM\023\257\025f5X\026\261\277\342@4>\217Q3\371\330\241?\023\017\257%5\034W\336\374\237\273\020\trT\264i\304\226\275Ru\354\277\325\034;\246#L\303\227~\232\326L\347\323/\371\321\007#!\032l\273\036nG\002.\321\207\020\337#D\250\266\204\t\371X\324\267\"\264\3066\205\303x9!\332]\025_\266\241\244`gw\241\nP}\372\233$\256\303\304T\325\223Y\217\0306^y\263m\372\f&\300.L\305g\361\0261>\317\241eN\247x\230J@\305\210\036\240\304a\013.\245\260dT)\013\034+\2652\235L\027L+\016C\314\313\211+\245T\\\n\212Q\031L)n\205B\2458\222\314\365\267\232\263\342\322\027T\235\263\242/\364!\026\003\026\226x\210B4$GGBF\n\241\247\212\321\200M\026\325\247\235\206\252AK\013\222X\321\201|\232w\020=c\037\036"
+	.ascii	"2\241\237\037\360\024\203\250\355\216\221\265\263\262\026\217"
+	.ascii	"M\032\3200\200\032\3648\033\031\nk8\b\b\311\270f\256\231`\273"
+	.ascii	"\2539't\f\315\322\013\372L\360\312\360\325\304^\r\230\005]\310"
+	.ascii	"\305d,\274\f6\2369\b\355\025WSQ"
+	.text
+	.section	.gnu.lto_hasEnoughTimeLapsedSinceLastTelemetryTransmission.111.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\035\n"
+	.string	"V\224J@ \307*\035"
+	.string	"K \004 \221\033X\201\023\021eth\b\fP\023'v0\007\341\177\305:\272\231\3576c\023L\276s*\023\004@\252"
+	.string	""
+	.string	"\002?\257\003\246\326\354\242\263\022\031V5\331d\313\224\0027"
+	.string	"7"
+	.string	"5"
+	.string	"\2333x\237\335\027\274O\333\226\240HY\365q\005vZ"
+	.string	"\027"
+	.string	"\005\273\343'U\256\272\252\374\337>]p\t^\261\325\325 cw\255\257\030\311-o\373\301\266\206m\004\0012\333\352y\333\337I\265J\365\275\006\023\003 \007va9\334\026\230\003h\266o\177L\331\031\333a\206\241\372\233_\373K\3526T\227\260!(#\002v\307\bC\034|\006-\033w\224\247r\312I\300U\273\354\244\312\213\264\2644g\037\3461(\237\305%\223\376\365\351\233\274\317K\315\254\204\2459gNV\027\330\343Je\212\375nw\3272\366\\L\200`\205E\007G\201\364\001\201>\033\242\b\f\303R\007\301\035\316\311\203\024z\276S(\202!\020\004\212\237\350\303\021\372:!\351\343h<\372"
+	.string	"\303O\034\215\302/3\356\273\225\262)7,\031\007"
+	.ascii	"\2513\241\214i\367\033f4\306\f\246\205\013\227\221\246k>\001"
+	.text
+	.section	.gnu.lto_checkFrSkyTelemetryState.112.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`L\003-\030"
+	.string	"6\353\232I\300\026U:\0240$\376\2254 \330\360jM<\324`*\347 \324\264\027pQm\256"
+	.string	"\302\247\302\223x\300\315\213\353S\026\241\306\f6\247\301\366\031\032\022\313B\206\2757\220V\242\215(\340\022\231\351'\r\333\b!D\312$\003\204"
+	.string	"~"
+	.string	"\202"
+	.string	"\373\200\364q_\204\305\356\351\343\367:\327\356i]\273]\236\352\250o\362\003:\022\246\326\252\352\034w\335T\"\225\344(6\273\366\257\233zg1?\335\220RIsc\206\355\244\242\240\232\020\227\"\004%4&(\032\220\b"
+	.string	"H\027\334y_\200\013\2621y\230\355\343qA\266\026,\246j\255'\232\214[$P\363\005Q4\027\342\203`\316v\"\347\030\264\030sISk]\236\321f|O\337\335 \273\373a\267#\004[d,f\367C7\322\332\363X\025,\376\214E~|\233Z\204`<\334\023\271\007\241\215#\243\312\302\3354\306}\333}\017\207\303\3416\216\335\221\027\365\335\327d\336R\344%\231Wd\336n\336\017\270\300\245\006\r\037S\032KZe\f\307T\242\021\212\217\357\376\335\357\213\274\307\342\351\226c~\265V\0305O\257\333\363\030\314jv\317[\b\022\\\337\375\244^i\225a\241L\252\013Sk\352\340cf\227\215\016iyRv\203\035R\314\376\356)\030\013\267"
+	.string	"\223\275\013\"\004\177fvJ\326\257\335/9\023\021#ll\310\217d3Q\215\036\347\235t\205\314\213##\366\005sBd"
+	.string	"\336\3059\371\263\355~}\247\370\202?\306\276!\271\330h\222+\3719\221\223C~\024\033e\002\205\024U\026\356s5_\026\261o\373\037\262\3738\023\277wwV\374Y\267\215\rY\277\316\301\\\315I\367m\337\"\337$\206\002k\242B\204\363\234@\241\304\214\200\323G\347\346C\211S\207\304\rOM\207\025'\217\201\305\231i\241`\241&T-\264\347\3349u\316\036\025O\316\315\216\n\007e\251f\020\354*\305\211\252zV+TuJa\027k\343X\032X\307\304Zk5\365\215\n\202\002`\356C\376\002d\371\222"
+	.ascii	"\312\001F\365\276\207!C\224K\361\321\260a\003\371\021\325\245"
+	.ascii	"\336MV\236\024=}\b/DG^\024\030\2258\244b\375Z\024\020\370XJD"
+	.ascii	"\206d6j\002\253\024\001\275z\302\262o\033F\250a\034\006\231B"
+	.ascii	"\214\261I\242\2444M\033\220\002\2411\263\r\020XgE\031\306E\306"
+	.ascii	"?W\222\345\231&\220 w\346\306\233\303\257\372\274M\310_'\022"
+	.ascii	"R\243\366\033\351\237{\212'\303\227q\243\031\374\016\0244\225"
+	.ascii	"~\372\n\216\271\340\302i\213\212\301f\204b\326\251\316\006%\026"
+	.ascii	"\026\f\031\013\331\n\025\277\f\226;\244\317$o\317 \273N\205`"
+	.ascii	"\231T\245\351o4B\251\361\023\343\257\323\020\261\037=\021E0\234"
+	.ascii	"\323\270V=\374\212-\323C1\341\304f\353\300\236\315\272K\r"
+	.text
+	.section	.gnu.lto_handleFrSkyTelemetry.113.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\232\004e\035"
+	.string	"\306\363\266G\240\330Qc\200\033\322W\b\217\357\240>e\351\035\007\017\264T\3773\316\027\023\337(\276d]\214\227\365DlH+z\327\275>,\006\247!\275\203s\371\362Ok\260\3041\365f\213\323Z\b\373\244\002\307H\223rK\231R\237"
+	.string	"\225"
+	.string	"\246"
+	.ascii	"\257\324/\372"
+	.string	"f\005\2640\260?\345K}\210\357\304\336/\323}\nc\017\025_\367\026\023\274Z\201\354\325\366\033\373J>\200}\265\317\316\362\"\216{%c\224\212\030\357\2757z\343\276\313\310b\266\222t\372\374\031\341\321e\376s\272,\326C\365\t\325%%\204\006\323\360\261\246[\022\301\027\223/5B%\362\206\305\216\340L\2304\353\313\245!i\273\367\316\204(&Y#D\362\261\3444)9\240\206\f\260\231\020H\332\246p)}\352\004\312%\2479c=\367^\317\240\220\351\236\271m\030\2663\330$\215\257\276\316\276\236\322\274\206\277y\364\247\316\341\370\005\266\345\3160v\0218\251\r\373\364x<\036Mk\330\261\351\234\3304\216\235\266\261\3234'\3364;\035\253\323\266N\327:M\326iJN_\307\312\2102j\361\201\271\227\305Q\314\345\252Mx\234\370\333\367\257\236\305{\321?\342`xe\037\353b]R\307\261K\312h"
+	.string	"\212\301\347\261x7\322#\213Wh\227\304D\2212\336[\\\360\352\t\262+\236m53|\022\344T\366\314'^t\203\241\226\361\325'r\302\236\005V\237\311\022RuY\027'O`\\pK8\340\210\345\235v\007\017\363A\333\206\220t\312\203[\376\301RJ\322'\305\320z\224\017 ||\354+\2455@J(7;\345\017\207\345xq\205\024\363\236\245\241\270**H3\354\237\372W$\t\227\200}\331P\032\245\241O\212\002\316\243}&o\322\373\311\345\354\253\r\255Ae\035\204\213\362G^\301\242\214\\\260v\312\027\345\245'\336\366\233aL\2336\320\210\371 \215vx\002\322#\357\224M\345\303f\034\215P\033\331S\\\325\025\244\031f\037\311\223\030\371:,\244\233\017\006D@AA@\030\212\206r\273\235\211\037\032\213\210\340 \227{"
+	.string	"!\004\017"
+	.ascii	"#\335\020\365\017\017o\004\321N\304\215\267+\312\t\345\202rE"
+	.ascii	"\267! \037\241\333\317\216\350\306S\263\216Dnw+\322\351v\267"
+	.ascii	"Y\361\367\236\037\005\222\367\336+C\241\007H\217d:\363\345s\250"
+	.ascii	"O\205%\207\212\310\226\005*\261\013\357*\245\3304%\271\262\324"
+	.ascii	"\206\017\244x\317\306\350\256j\253+Fk^X\245\226\204\026+\274"
+	.ascii	"\324\232\265\024W\345E_\263\225Zz\245\241\225J\005@Uh\361d\334"
+	.ascii	"\2423\275uC\2618\324\267\302\220\001\005=\262_\345\\%4l\330`"
+	.ascii	"_q\250\3140b\250\2214\206\2342DB\"A$IA\322\006\240\002\221\031"
+	.ascii	";\017\020Xf4*4\006\007J\322_;\341ZK\005\352c]\344q\327\272,\004"
+	.ascii	"h\"\250}\037I\0227#\"\251\354Xh\325;(\3242\351\254?\201\251\004"
+	.ascii	"\022\211a2pr\233T\032ri\345z=6\265\253\377\363]\257\262;FB\307"
+	.ascii	"$\360w\221(\355\354G\377\305\342\326\254\367\001\373\240\246"
+	.ascii	"\324\361\250^\352\264ZP\261\244\260q\031\312\230c\206\030\365"
+	.ascii	"D90k\221\025\242\2502C\337\312`2x\035\362\363V/\264\272\0075"
+	.ascii	"1\324\206\246n\226\352wi\037\346\203!\265\204u\312g\032\223\351"
+	.ascii	"\341\323\316;\242\245\320D\0353\t\327\352\2253\347hw\216\322"
+	.ascii	"q0\225e\252\006"
+	.text
+	.section	.gnu.lto_serializeFrsky.part.0.140.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\021\001E\f"
+	.string	"V\326PD\020\215*\035 R\"6\001\320{j\f\314r\tf0,\002\2113[\345\331\212P\343\237\250\311\376\206\261\373\351\tx\023\360\365\312X"
+	.string	""
+	.string	"\204@M,\032\0025\213\221\214G\261N@\370 T\375m\223-S\n:"
+	.string	"?"
+	.string	":"
+	.string	"\034\336\270|\252\355g\260Mj\340\320F\361\321\302ZT\023\020\264T\354\356\366)+<\274\324,\364ET\351\362\254\253\210rp\325<\263\224\354\256/\017\356y\333\034\333'\366\027\004j\235\352W4Z\211]\006\261\025Ka\206\300\360\361\366G\222\317r\3066\351\253\321&\202\306\247?\206v\346\323\200G\232\340\344\332\335\216\214\023\036R\257\301\037!\341W#\313]\t\037@\354\216\001\267\210\312\245\035\352\364\2427\007d\311>\207\267\n\370\027L\340\323\213_\345\363\322\002\202Ic>\353W\340a\304k\325\337\360\217W\205\371\253\333\304\2440\313L\252\354g+S\366\f\006\215\200p\034G\344\243]t\300\316'\263G\023\001\370<\320&\362@.\304\005\340\300M@J'\264y\274o\3230\334\r\340\274\r\354:o\323g+S()\\&y\222\030%\321\016\212!\361Z\205\031\2436\021\033"
+	.ascii	"\217\311\362@\226+\3110\tm\005\357\"\214\f\b\016xL+\027\005\""
+	.ascii	"K\222\261\027\2540\325Ry@\3065<\260\tG\027\037\234\002cW\215"
+	.ascii	"\316\021\332\266\351\262s\001\340\304s\031\035\363\316k\313\030"
+	.text
+	.section	.gnu.lto_checkFrSkyTelemetryState.part.0.169.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`U\001\245\016"
+	.string	"\246\031_G\360\2606\035\"j\315[P\027\026\322\\\232\205\312\334\361l\035h\375p \307\263;\036e\354\306\215\27114\b\213\315\276\315\274\372\335\325l\353\037\306|\022D\343\206\267\021\326\330\256\221=\320\237\221\205\353X\332d\357\224\002H"
+	.string	"G"
+	.string	"N"
+	.ascii	"\331\351el\243\\\374\3318>\216\330\303\300\311p\243\263\273\332"
+	.ascii	"\351\024\361\357\327\224\364\363\001\204)\277$\030r\370\274\006"
+	.ascii	"\274\264X\201\204,\227\310*\346\303\305\313\r\341\212\224\002"
+	.ascii	"N=#\273\353\217\0167v\333\022l\223\330'\021\033\202\3120q\325"
+	.ascii	"o\337\247\371\r\312S\330\323\302\331\335L\365\031\337\006\365"
+	.ascii	"\321\263K\210\006\320U\027\375\232\020\020d\277\306\n\030|\037"
+	.ascii	"\275\003)\343\266@\3501\242\320\331\035\023\234Z\344\343\324"
+	.ascii	"\247A\271/\242\354\314\027?;5r\200\314\220\241\361\311\002\203"
+	.ascii	"\344\001\346t\254QG\316J\226\347\345*\346%\306\234)\373\204}"
+	.ascii	"\312\02366X\344\016\373*\276\342\344\227p\251\223\007;\354\364"
+	.ascii	"\2235s\003\204\350AE\356\310\231\362\244\277v\302\330\227\364"
+	.ascii	"1\002\021Z\273-;\255>y\260\240\326\006\016L>\001j'\n\221\230"
+	.ascii	"T\021\205\020\t4\341TI\005\\\362\361,\224\270\023\315\343LuT"
+	.ascii	"E\325\244\221*\204FZ\tW\322>\006\274]\250\234f\3326N\313l\313"
+	.ascii	"O\030\217\250\314\225k\246\356a\276\213\277\360F\333\206\235"
+	.ascii	"\"\b$ `\002\031s\353\001\305\374'A 2D\216KD\320\b\217s\300j\322"
+	.ascii	"\030\215\234\031b\354&\204\220\204jl\376=\324\2720&K\362\336"
+	.ascii	"\241\260lH\276=<\363YVg\r0;]\013\306\351\177\307K\275\245\264"
+	.ascii	"e\317[c!\254\275\247\320\264\035\367\2560\006"
+	.text
+	.section	.gnu.lto_handleFrSkyTelemetry.part.0.174.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`?\006\305$"
+	.string	"*@(\016F\200ZRc\004\221T\003\204\017k[\360\301\3533\256]\315(\216\302\006\207\f\377\030Mc.`\356\374\314\240\r\241\356\"\005r\347mr\034%\331)\003\025r\207!\215q\327\021\220pqp\033W\310f\367\336[\246\024\303"
+	.string	"\317"
+	.string	"\320"
+	.string	"_\332=3\235\314(\022\312\030\253\257{o\357\t\223u\276\030\321\037s\317\304;i\262\217Qy\221\307\213\025{W\023\250\221`_\351\203=\254x'M\277T\3675\234]6\332\356U>\270j\b\273\253>\347Y\257\246\337Y\257\276\211m\342\321E\033\315\225Z\367\3147RK\347\275\327w\025\035\362\342qv\272UMQ\313+\372N\307Y\376H,*\037\337\245\024\242\234@\336<\372Hs\342\244\306|\354\b\220\034\223Vw\346u\246\220\2119C\366\370j\247\220<\256F\331\224F\017i\264h\352\240\255J\233"
+	.string	"H\251\224'G\221\251\217\335\332@BY\253s\236.\350\336\353?\375\270{\267\315e{h\257;\001c\347\225\365\270\202s\273V\316\242YFyG\237\317\347\033\243B\354\034k\035\317z\315\261Vy\326i\317\032\345Y[\236\365\r\244]r\002\254\356\315\361\234\273W\252\025#\027\373\027\003Y \332(\275\311(\364\f\220\005$\033\025\210B\315\314m\371\362Bt0\b\252FT\212fT>\260=t\260\200R\213jU\003C\303\213\357\352\321\236\332\367\325\336\005\351d>\227\n\3112\233x\315n\272\365d\373r* \"\301\332oA\272\226\246Ty\221\353qn\2132\302U\217\330\251!\331XxI,K\254"
+	.string	"%\2658\207U\226N\346\326\321\3744\367LT\272\222\242\344\237-X;\363\241\334L\351Q\226\25060\331\276\234\367\036=\354\256Z\271\373\316\032N\266j;\334\016\264{K\233\\\367\316\262\036\315\236\3604gq\206"
+	.string	"loi\347]\221k^+\267c\023\344\nnMNY\325\205s[;\350\370@\005\342w\024\301\326|\352x\355\360R\321,_hM\321\2340\003\326&Q\302~*E\327$W\3501\254\245\361JO\254(*$3c\264q\266M\274\314\211\335\275\306\013>\231\263\241\360\267\256:\205\n\025\353U\024\375\330\031\210-\235V`a:/\254S\371qp\205\341`\262fhn\305\220S\307\332,Z\330O\331\007\nu\362\315\232n\232\327\212kc\242h\226\355\236\325\242Cde\2146\316\272\367\254G-z\251$\224}\332_{\030!\177\313?\240\375\024p\275z\364"
+	.string	"\221\344\223}\372\001\216\361\303$\004&%\t\r\371\206\302\340\360\b8\034\022\025\025\021\225H:\002\n\205J?"
+	.string	".\204\301\340O\365\013\r\025\200\300\013\030\\\374\fX\n\036\241\376\3750\311\030\n_\370\230\204I@#`\0210\311wD$d\344\373\t\207\276\237\036\007g"
+	.string	"\205\276\244`P\350\353\331\266\017zB\241\214>\275\367^\234\313]\207\372K\013\245[>\371\271\025\271\304\250i\236\271\277f/\217\326\233\231\0300&C%\354j\327\340B\353\372fEyBT\2559\237\272\006\326_T\324g\026\273\212^Q\250\223}\347\341`\024\223\024\225\024\225\254WU\024'\311<\357\214\311\224\357\336\256\374FY\325\0218\267\245\364^,\016G\373\333\306\354\323\t\354\247<\255\330\204"
+	.string	"\333\224\217V\004+:1\242\001~\250a$\306\024R\312\324\314\210\210\2024\315\001`\002\221Rf\364\0210\261\204\310\246\026\322\034.\217\037H\2041\367j \006\032\360\216\\\325\030t4\317R\243\277\321\026e\204M)N\240\021\001\340\264\214\217\206\300Rw\350\321Gj\374\200\305\213~\221\221?R!u\306:P\276\337@"
+	.ascii	"a\263\344j\336\2227\340A\336a4[\315\210\321\236-5n\321\365\215"
+	.ascii	")\235\216\320d\021@\331\350P\335\031\351\031\345\353\237\201"
+	.ascii	"4z \260\003\247>s\230|\342\034\214\200\351\f5\033\345\226\313"
+	.ascii	"|\370\227\363\207\374\200\207Z\252\271f\352\274yt\366\023\247"
+	.ascii	"ki\205RPx\230\306\232=t\355\2062o\246=i\273\334\213\207\253\267"
+	.ascii	"\206\377\210\005'b\225y1\235)%\344P\231\333}\271\317**\363\313"
+	.ascii	"B\360\220\b\004\344\3602\200\031;\211\322L\261,Y\235\200\223"
+	.ascii	"u\2511\313\333\260e\3464\340\203DP\r\207\b\312z\261va\241,Q~"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\263\be\036"
+	.string	"\326/\252A\200.\247\003\234\202\336\177\210\033X\201g\300\365\221;\257\302\03456o\002\247B\241\271\373M\352\205\370e\230,\225#\\\374\324i\373\241t\261A\021/j\321\032v+\225>\253\310\n\"\273Q\222)\005\231"
+	.string	"\224"
+	.string	"\225"
+	.string	"*\236\377\320\024\317~(\n~\343\235\3406\264\222_L<\367)\301q\266H|k\031\301nDp\"\257\f\361\215\005\304\363\036\372\341Y\317\027\365\234\307C'\361r\317xh\207>\302\241\215x\033\272\210\247\341\331*\303\363I1<c\321\013\317W\026\232\254\360\314\207\002\357\274\t\317v$p\243\b\317Y\020\230QC=\327\241\276\333\355v\017\236\3478\370nB\235\271K\262\001\263a\360,\207\300\002>\3441\363G\326Jza~\3464O\372\210$I\362\351\371\016ef"
+	.ascii	"[\002g\350\271\320g2\033\332\227M\362\034M\362\245Yh\255\353"
+	.ascii	"\202\236\243\240\277\252\313zH\236\243H.\263\341\365>\377j;I"
+	.ascii	"\222E\350\347`\331\324\t\231)_p\236\273\312\317\354f\322\207"
+	.ascii	"\352\n\316\363\256\315x\326\204\251r\344y\233_y\344\215\305\003"
+	.ascii	"G}\352\031\221\324\263\242\035\317\206t<\027\312\361<\b\3073"
+	.ascii	"\241\033\337Kl|3\251\361\255\204\306\363\242\031\337Hd|\327\030"
+	.ascii	"\337%\214g\255&I\222\331\351\305\363V\273x\026\324\3429\020\013"
+	.ascii	"\206\343\255x\006\024\016\272j\336X\rj\236\2435\177Y\327e\362"
+	.ascii	".\02701\371\017\037v\312J\331\001\236\350\342\331.e\313\230+"
+	.ascii	"*\372\f\253\033\311U\025\235'\321\303\013\236\236\350\037\025"
+	.ascii	"=J\201\350\002\252Hs\331\2454\0054o\223\346\003\256\200:;e\265"
+	.ascii	"i\314A\263\231\r\230.T\bb4A\314s1\027\355\022\354\f\317\227U"
+	.ascii	"\362\357R%\217:\240\344m\317?\211\324!U\210\rr\201\\\037g\217"
+	.ascii	":u\245\254\223m\272\342\235\235\260\032V\320z0\357Ka\336\225"
+	.ascii	"a\376\272\256,\336\361\346\242\211\273e\200\342\304P\322\315"
+	.ascii	"g\267\003DAc\006\2749\314\304\335<\254H7"
+	.string	"\326\312Be\317wk-+\2733\007n\036\232P\2666\"\306j\313\200\215Ve\351\244D\260\371g\233\343Teqi\262\321,\335\2245\022l\376\231M\257\312\240\321\003\301\200\363\200*\340m:pz\340\344}\303\321\277\032\033\335U\246'X\001\322=\215\016Z\332\350\340)\216\376\262L\243\277\316\226\351\240\350j\243\303.l\364Y\331M\245\025H\rn\364\245Si\364\246\0227\272x.\325\227\311\240\026\200\253\250A\024\221yK\024\244\240 I\2061\340\002\251!j\033\021\200\030\214\031\220\242\221H$H\333\001w\264R\343\b\322\352\243\221X~j0\037\221\025H8-\221\2418\350\026\022\326\330w\262\003\330\3276\324\300\347H`\272F\003\246R\330\226\327\004\235\024\300\340\363\302\215\350\353\265\021\346\026\266F\026\0052\334\325y\031L\356\240\332\304\353\033\324\235\305I\254q\313\362\f\263+\315\223(]\2720\026"
+	.ascii	"`\341)V\262\322k\274V\212V+\241k\210=\373\023C\372\t\216P\206"
+	.ascii	"\216\362F\024\324wj\323\177\306\312R\303j\260\241\320\376'\036"
+	.ascii	"*\300(k\254\200'\3205'\"\241\023\221i\210It\"d\320\277r\235\331"
+	.ascii	"F\334c\f\024\310\036[\024<\262`:\346,\273D\270S\025\206l\372"
+	.ascii	";\f \2444\234\266h\002\021\260\200d\376\277\023\317\340\3567"
+	.ascii	"\350\r\324\214[;\242\001e&\260\306K@zy\221z\333\312uhL/\360\007"
+	.ascii	"\013y\356\274\033\006l\2065\003\314\013\0310\254\313\374zX\003"
+	.ascii	"\260*"
+	.text
+	.section	.gnu.lto_.refs.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\225\005"
+	.string	"f\320'\021\240t\303\032`t\310;\tZ\023`\342\254\224M\246 "
+	.string	"#"
+	.string	"$"
+	.string	")\325S\225 \235\006\005\266@M\240\006\244\210\273\272\005\027p\251{\272\2234pKW\222:6H\003\226\235\316\032\345\344N\215\022\253\261\001\026\"\035=\254\3501\343\321q?\215+\306\323\242\342\016v2,X%\316\215=X\226pV\272\324L)\313\002\31627\200\261w1\2134t\177.\333\271\326\334\205\306\322\265\022\b\203n\rg\313\265u7.\273\270Npl\305Y\262z\006+\226\245\234\215\334\b\353\n3eu\250\005"
+	.ascii	"vd\2710\024L\2750\306\314\210\006\216\b"
+	.text
+	.section	.gnu.lto_.decls.c0b0ecebf4063c13,"e",@progbits
+	.string	"(\265/\375`*J\r<\001J\0216tU JY*\351\324\317\021v\n+h\037\270\323u\03627]G\035\313x\031\216\nm/8 \371E\307XF\354\314\r\353\321A\232\213\265tZqB\023"
+	.string	"u1\\\027_\r\r\232\3412|_\303z\032\216WkT\024\202\356t\333>\225j\335\226\220\275\345N\001O\0061\007z\007s)L\255\231\367f\026|3\f\037\357\212[\2226w\304\334\254\b\245"
+	.string	"g\206\217\276mJ5/\007\\V\337\233F\360\353\027\037}x)\264\n%h\034\177v\230\341\302S\333q\303,\013\007\262\261r\364\221\250\312(W\201a!\325\200\344\231\242j\034%h\034\177t\254\351h\036\\\275U\202\306\361\347\206\231+\274\037}\254vn(\314\366t\365\220/wF4Y\023\341\323\340\037Q\244\223p\240\272\372\200+N\2635\225Nk\265^\353\261\026k\264\256\322g\235l\263\226\322e=\245&\233\254\225\274\2274\223+5\326\t}\264iGle\315F\223\265W\203U;7\024rv\360\232\007Y\367\350-\016TWy\352K\001O\216zP\370rN\232|rz\310*\270a\035\005\212]\243\204\b[\337\227n\302\240"
+	.ascii	"\271\251\301\305\313\2237\224!\036Uc\336\372v\223F\376\377\031"
+	.ascii	"\352\273\323\307\206tbm\234\355i\351\233\024\322\241c\211\327"
+	.ascii	"\347zl)\253\353\373r\f.sM2/W\217\314\227qI\220\230nio\332$/\024"
+	.ascii	"5Z\234\364\355#m$\231\225L43H\304\364}y\206_\212\341\227K\360"
+	.ascii	"\r\273\002\226\367\325(t\245)\253\321\367\245\027~\t\004\223"
+	.ascii	"\235\241\351\353\333B:\b\321\2159D\356\372\276\304\302/g\340"
+	.ascii	"\337<\370W\016\376\275\303\277a\360\337[ZH'jp\372\332\025\t\355"
+	.ascii	")3\203B\337_9\\A=2\177\327\360\257\030\376M\202\227Z\307OU\262"
+	.ascii	"\350'\315\234 n}\177\275\360\357\tXD=2\373F\r(8\314\312\372\336"
+	.ascii	"\336\301\257\311\266\3215\346\340\214H\256\3365\376\fH<\216P"
+	.ascii	"\316f9g\016\266NI\030[\337\323i\253\377?\227J\030\227\221\276"
+	.ascii	"]\3253j\322C\323H\026\365\022=W\326\372\336\346\341W\017\246"
+	.ascii	"\355\353\253\036\314\3334\370Ic\347\"\035Bz\214\365\355S\"\222"
+	.ascii	"#rfI\337\333,\370\177\315S\365\324d\335S\357t2g6:\325\016\321"
+	.ascii	"\224Q\256\242\352B\346\234G\274\356\251x\252\035\242\251d>\372"
+	.ascii	"\200\005\001\202\307\227sV\372\360\241\271\344\354%1\357m\030"
+	.ascii	"\276\375\201k\235\332BMn\250|\257{u\316\313\251dN\346\234\213"
+	.ascii	"\252\036\022\252\254\276\267;0\br\256\033\314\332\327W7\230\267"
+	.ascii	"8p\327#\323\250&\231\177\325\333\340#e\313\020#}\377\232\367"
+	.ascii	"\206(\007\023\025\224\364\275\006va\360r\316#\310\214\311\022"
+	.ascii	"\327\006Y\253lY\363\3275\225M\215S\333T8\325M=S\323T4UNUS\361"
+	.ascii	"j\262\276\251,\274\336U3\277\311\234\253r\316\327\340\257U\270"
+	.ascii	"\324\271j\347\206\202K\031<-rl\340\376Z\005\213\033\263\277V"
+	.ascii	"i{\243V\346Z\252\235[E\212\211\301\3139\277\212\031S\337\210"
+	.ascii	"l\316B\352\220t\377\210?\003\022\365M\255\253o\325\216K\001S"
+	.ascii	"\350\360rN\276~\371G\3247\025L\r\303\241F\316_e\032\252\300\321"
+	.ascii	"\322\303\227s\362\303\207\017\037\224>\b\341a\023c\213\340V\273"
+	.ascii	"\232dr\250G\346\033\013~\227\341w\022\374\346\302\357*|\267\232"
+	.ascii	"d\276\356\341"
+	.string	"\313\255\325\025n\036Z\223\033}_\311\340\3276|\273\232dV/@z\250\270p\365}\235\202\273\274:\301\257?\360\353\024^\252I\346I\300\"j\222\371\021p\211\232dV+\325\255&'\250W\236\001\211[\243Z6\3139Y4\264\207l\017\236\276\017\001\277N`\326\276:\201\371\004`\243\312\366\327\262jV\327\354\025\016\257\354\226s\362B\271&f\312T\337zV\321j\262\256\3755\255\252\375\252ye\266\234\223CvJ\253NK\337\nj\222y\353\221)\264\364\277\350.\223x\343\327%\263\250\257\257\257\257.\231O\326$\023\327#\363\357#\326\337#,\003~\324\r\340\267\013\3301\243\223\254\002\022\360\333\r\376\026\201\374\360\227\247\222\262#\0228\225b\320\177\325\374\215\374\200\f\251_\251E<T\0256\203\277\026\235\202\277d\262mE\324\036U\313\232!\252\212#\"X\020\377=\244\231\177Ie\200=E\326"
+	.string	"\177\233\370\031\016\376:\001\207\263\322\003L\350\330\002\034\350/K\370\373\002\226"
+	.ascii	"\177\273\261\037\376\226\222\367\267\n;\200\277;P\201\004<\177"
+	.ascii	"\327\277\346\371{\004\273\344\342F\177i\377.c;\320Y\n0\260\036"
+	.ascii	"\376&R~P\306v\370*!\300\346o\016\274\371+\210cP\315o\370K\023"
+	.ascii	"\177s\300V\360w\030\013\200\277\351,\005-\244\232\317\360\227"
+	.ascii	"$F\250u2\346\374\307\223\247\351\257\267\023\\\251\326\375\350"
+	.ascii	"/'\370\217\347\177\236\233\261\034\254\004\377\325~\233\341\377"
+	.ascii	"\005\352\b\277\360_\270\2779\320q6\311C-:v\320\233Q\006\375\215"
+	.ascii	"\201EJ\376\265\310\036\375\355\363\267\326\027\213\241\026\301"
+	.ascii	"\340J\366\302_\315W\360\227\002\230\363Wk\364\242\377\342\251"
+	.ascii	"T*\226\277\266\325\270\277R\340o\026\266\350\357\rX\242\377J"
+	.ascii	"\3771\370\037\302\177\016\377]\330\241k\370\257\233&\332\237"
+	.ascii	"\377T>\364_3\177\303Y\374\267\260\203_\371\317\177\301\374\326"
+	.ascii	"\347\267\366\357\276\277\353\374\255\367\367\233\277\317\374"
+	.ascii	"}\367\267\335\337u\177\213\371\033\314\337[\376\326\3627\226"
+	.ascii	"\277\235\374}\344o\266\277\323\376>\373\273\354o\262\277\245"
+	.ascii	"\374\255\302\337a\177#\377f\362\267\222\277\221\374M\344\357"
+	.ascii	"\257\277\275\376\026\362\367\217\277\271\376\326\372\233\307"
+	.ascii	"\337;\376>\376\235\343\357\031\177S\375m\374;\004\177\177\340"
+	.ascii	"o\017\374-\343\357\022\376\226\372\233\003\177\027\377\026\376"
+	.ascii	"M\302\337N\177\243\177\227\370\033\305\337\027\370\253\212\277"
+	.ascii	"-\360w\005\376\036\341o\027\1775\377f\361\327\016\376\363\375"
+	.ascii	"\357\373{\305\337\"\374\325\202\277\006\375\255\342\277\213\277"
+	.ascii	"\026\375\277\362\327\021\376\216\300\337\020\370\373\203\277"
+	.ascii	"=\370;\305\337#\376\006\361\267\001\376.\300\337\370\357\373"
+	.ascii	"\267\375k\335\337\375W:\177\225\373\253\226\377-\376\352\301"
+	.ascii	"_\377?\357?\336\377\265\377M\377\307\374\337\320\327\327\327"
+	.ascii	"\367\377<\375D!\374\0324\005\367\027\340\340\353\245\325\310"
+	.ascii	"\031\002\245\357/\244\301\227\313\2308\\N\372\376\202\035N\342"
+	.ascii	"\024\302\274\231\365\275Z^\357\252\231\"+&G\032q7K\235\033t\300"
+	.ascii	"\364\375\0052\214\005ni\310N\032\252\261\267+e.\013N\336\025"
+	.ascii	"77+mBmuG\352n\333\255\362C/HZ_63\314\021OM\337_0\202\377\337"
+	.ascii	"\264\233\274h\367\354\252]*5y\327n\331Z\023\271d6\355\210\265"
+	.ascii	"P\215\271afe\220b\242\200\221\271kw\212\030<:\025\352\033\221"
+	.ascii	"\321(S\231\251C\256]1c\336\006ejJ\314\370rN\026\245i\301-\f\321"
+	.ascii	"\275Q\035|#3\370F_\356Xe\263\222\004O\337\033Q\301W\312\363P"
+	.ascii	"P\0219\267\251\2767J\001\337\b\b\276Q\025\376\n\027\312}\022"
+	.ascii	"\202\r\033q\220\277O:\310\211\326\\\234\276\031\214\370E\232"
+	.ascii	"c^P\260\343\344j5y\307\225}\001sK\341\022\251\242\262W\244\357"
+	.ascii	"o\016\035Y$\272\320\360\324z\\\256j\347\206b\357-\310\031\262"
+	.ascii	"\316\001B\005\357\022\271\307\266\272\302\002\016\254%(\364u"
+	.ascii	"]\037\377\210\037\331\2621\366u\215]\260\373u\215\\&\367\310"
+	.ascii	"E\341*\271E.\222\273\344&\251\311K\344\n\371\035r\275~I\330\240"
+	.ascii	"C^\"\367F}\363Y\362\244\257\213"
+	.string	"\357\022\271Y\227\007\321\225-}]|9'\313*b\200\364P\272\325\253&\231H\365\310|\321\027\374\2425\374\"$~\221\017\374\242)\254T\223\314\2735d\267\305\346\255\357\211\340\\-1\367\004\254\275\"b}OT\345\356 \202\202O\364\205O\304\003\037\257\017\237\257&\231\037\272\303\037\352\202\377[\343*\006\027\027\232\325\357\225\235\352\245\201\350\204*c?\372^\032#~\255\024\260\204\310\224\276\266\036\231\377\2351AR\013\213\310\255\252{z\320h\033\323\367\277T\327\030\364\206\234\023\327\267\005\253\207h\312(\347&Z\360\356\324\3155y\215\327h\373\272\205j\207\344N\271\202\367\341\276\361\201\2111\357\207\264\340\3279v\262 \363\330=\026OMZ=U|\325\016Q\231\263W\034\322\352\261w\200\222\244\271\241\343\3139\177P\372\360\201\210V\004\017\276\037z\202?\264\004\177\350\b\376\220\027\376m\235\353\375\330\265"
+	.string	"\307e\365z\214\215\303\201\352\352\242\321ui0u\310\306\322\263\\\032\fQU2g\371,a\241\315\221o\216\335\263tj\322\352Y9\267x6O\251\256\355\251!\206\257M\326$\263D=2/d\007\303\271ah^C\372^H\016^\241,\215ec\325\3307\026\215]c\333\324\244uc\351\306\214y9\303\3139i\335X1mU\355\2208\300\214\f\214\375\302\201\352\312\203/fu\366\f\007\252+\017\366\320\334\3300\366\013\220\032\024\322\240\361\345\234$:3K\002\306\350Z3\365\314\261J\235\276\027\232r\307\302\220\2251?\246\354nY\250C#\317[_[\306\222\261e\364\030\231\"3\204\206T\363\205L\203q\222\303\t\235\276\027B\342\013\031\301\027\n\202/\304\003_\350\006\276P\025~\020\2369\255\035v\200\240\351\373 8\370Ai\360\203\310\340\007\305\341\337n\361P\325\005\316L\356pj\306\336"
+	.ascii	"\351+g\341\232K\257P\355\334\356\2242xrp\035\246\217D?9\177\221"
+	.ascii	"A\346\234\264p=\306Z1\372\300m)\023\343{\203k\270\216#2&\263"
+	.ascii	"\0163\005c\231\030\026\253\305\306\331,5i\341\254\333\355\025"
+	.ascii	"\373\246\024d\003\317\006\034\240\353\223\254I\346\371\352\221"
+	.ascii	"\371\240\"\270m\250\314\0336]\372>\250\013_\203\034\366\004,"
+	.ascii	"<1\177\255b\321\272N\267`\223r\035\200\371@\2633,\326Z\016;\266"
+	.ascii	"\nL\007\036Z\343\365\236M\"}\332\326~\340\345\234-Z\363\265\225"
+	.ascii	"M\312a\2535\036\026\255\337\264\034\233v\304pT@\360\316\254\231"
+	.ascii	"\245b\323,\233MZ5\273f\253\324\244E\2634\336r-\306\242Y\036\266"
+	.ascii	"\254\004\215c\bTA\320\272\256\335\020U%"
+	.string	"\363\016\r\322\244\344\031\3139\327\276\"X\\HwJ\320\024\037Ol\364=\220\033\214\264MrT\311\321\303\372(A\343\370c\003\315\017\274\fH\3300\013\245\276\331$\322\307J\021 N,\221*:\220?,\221\0224\216?9\320\370\260a\266\210m\002\266\324%\357!\303g\245\3301\253\202\215b\305,YM\3320\373\344\215\325t\037>\020U\355\261\221\021\335\003\205\301\007j\303\007\242\202\017$\205\211Ma\211O\231$U4\372\036\350\213\211]\322\200*w\276\224\334.)z\262\302\225Z_\233\304\016)\337\304\251]\365\265H\360\327\217)x}\355\221\212\005\314\354\314\210U3\243C\305H}\253\303A\325\367@[_\026\f\005\237\271\2754i}\017d\374B\241(\216\025\034\035\257[\024\206\332\220q\202\354k\273\354\020\275)miC\254\220\264\033b`\033\206\340\030\257\004\351;\033~\276\266\310\210\351k\201"
+	.ascii	"\271\2213\206K\337\323\251o\377\177J\260:o\264\364\375\317\234"
+	.ascii	"-\313\245e>Y\223\244\017\315\326\255\326\025\037H\300\350\324"
+	.ascii	"\244\325*\357\2424y\353\373\237:\374\037,v\007N\001M\227\227"
+	.ascii	"\276\377\221b\263\354\261\315\270\3455V\307\355\321lc\374r\007"
+	.ascii	"\212\305A\224Gk\213\223\276\377\tboX\033\235%J\r,\266\306\255"
+	.ascii	"\215\216\023\272CG\206G\337\323\261W\377\177\210\322\240i\351"
+	.ascii	"b\257\254\025\326]\376\262V\226\306O\2355z\312\372\376\207\007"
+	.ascii	"\376\217\016\274\241\314*b5\245\257\235j<\326X\355\270\214rU"
+	.ascii	"\334\nx9g\252\232\264S}\347\303\206\336\221\005\t\232{\377\333"
+	.ascii	"\\\223\326\330}J\326\330yzO\265\343J\346\035>W\362\216x\341\313"
+	.ascii	"9\251\364\341\212a\231\245\271\3678\r~M\036N\353y\234\273\204"
+	.ascii	"N\353\254\3571\013\370X\f>\376\202\217\337\360q\033>\246\322"
+	.ascii	"\302\337tj\226j\247\372\354\360\222\306\245\357\361\0306\353"
+	.ascii	"\221\331z=\347\275\327y\271\3676\360\312y\252\367\212\362\344"
+	.ascii	"<UTk\207Z;\334)`N\336\314{\034\206\217\215`8\035\247\232\251"
+	.ascii	"s\247F\337\343-88\007n\243TtB\020+W}\357c\007_\0032\315\202M"
+	.ascii	";\342\267\"}j\232MM\366\232\276sS[\323f:M\265s\313S'\\\220\227"
+	.ascii	"\367\220Q\3720\364\306\207G\313\274g\032M\321\215\024\254\226"
+	.ascii	"\254\235\031\303\367\001k\273\336QEI\215\276\367\331\3522>G|"
+	.ascii	"S\017\266v\260i\242\301\177wy\257\360\367\226\372\245\301\264"
+	.ascii	"\227\006!\271<4\264\372\266\227\236\253\311\317\365\227$`\214"
+	.ascii	"I\372\336\254\303&\344\234s\375\234\351\3639\263\356\215xw92"
+	.ascii	"\217\\\311\354\226s.\262r_h\344\351{\263\013"
+	.string	"\026\252G\346\355\352\221\331q\335YZ\313;\256\261<\003\022\027\252\352\270\233\363T\255\035\210j\355P\006\3675i\352\270n\370\304\240\251\321\327C\025\363\206\231\303\274ab\325|\004c\342\270\211%G\356\310\033;\310=&\306\276\227\340\013\376M\033w\216Y\343%\026:B\244\030\351k\201\030s\2069\303\264\252j\024\354\331\2122&\2064\2561i\334\264*\342\022\023\206\254l\023f\317\215W\337KP\206-`3\215\246\321\244\002\273\261\025\245\372\2503\246fN\335\244\032\"\353q\367\344\322\365\235\0226+}/A\027\266\200\016\037_\331'\242f++h\224\340\345\314\265\344\003&\271Eg\317\313\276\362\355L\212\332\226\276\245\236K&\304\203\314\236\270\276e\236\033\227\247L9\323\267\304\3238\376\377\334\034k`7\372\226w|hl\221\353\321\267\264\323`\377\177\030\300\346X\247\207\224\335\335Y\323\367\022`\341"
+	.string	"\020\331\333+\353\200\371Rbf\267(\351\273C\347e\035 #@\214f}O\347\307\256N\035\267\276\217@\017\016\200\\\234\307)\365D\324l\005W$\007\236\222\036M\254\344\274\324+\363Z\270\261%M\036\336\245\303r\003M\221=a\344\254\301\001P!M\232\362\215\002\272\354Pb\326"
+	.ascii	")g\252\224n^\276\271t\330\n\02225}K5e\2332\f\257\210\226\262"
+	.ascii	"M\311\306N\214\326\027\333\00671Ykn\231\004p\256\262\304\375"
+	.ascii	"\377\021\312\302B[\226.\270\203\334\2313e\035V\020\022\312\032"
+	.ascii	"\030'\270\003\333\335]\027\222\212\227\231\0210\334\201\256L"
+	.ascii	"\231\322\256\032%\251\314\374@\346\314\265\364\001)[,\330\201"
+	.ascii	"1g\240!!\353\373\b\266\260\005L\350\350\312:\0215[\265"
+	.ascii	"\201q\341\331\251:=I\352\352[\020\233\254\261\263\276\217\200"
+	.ascii	"\nwX\023&L)F\311\313\230\267\364\204\205\276\256 o>\266\210i"
+	.ascii	"\253%i4P\310\303\026\330\350\322\245\004\243\344e\324[*\003\305"
+	.ascii	"\215\227\237/dp$\001S~\001\002\202\304R\326\267\234\023\352S"
+	.ascii	"c\206J\337o\260+\275\270\341\016{[\266\224i\365\210\231%bCev"
+	.ascii	"h\311\352\373\r`\330\202\261\270\270R\213i\245\213\222\256 \256"
+	.ascii	"1f_^j\351c\033)vN\372^\251\017[\240\265\364\277l{[\211\245\252"
+	.ascii	"e\035JgI\256\245\333\002\013O\344J\270\227X0\032\276<5\372\226"
+	.ascii	"V\312^\342e+\354\355\345\225\025r\214"
+	.string	"Y\322v\177\300y\tS\272\265\022!!E~\250Q\232\203;4Y*\325j\311\306\326\307\013\266|)\241\301\257}4/\340\242R\252Q)\323<H\262\003\305\247J\024, e\362e\332\020\235*vh}O\247\217\377\177L2:\362\334\351{\2450|\201\330\331\231\325\242\303E\214n,sq-5U\223\033T}\257\264\205/8++\315\312\254\0266\336\231Zl\366\360\350{\245\214;\200-\275$+\311.\235\007yjG\211\260;9\270\303\325\322K)Rn\233\275\312S`\"\302\246\316\340\013\330\226T\270\nV\013\3479CP\214\254m\365\275\206-\270\003\331R\371\244\226aa\365M)\033\365*\330\002\305\r\277\3267\263I\211l\222\306I\211t\322\307\005\337\305\315\031\351{\ra\370\032\266p\007\256\245\216\253%\023&\035\247\224\215y\"\302\270h0\342\nVXz\251DI\2739\200K-\357\300"
+	.string	"\236\255(\346\026\233\273\031}\237\001Ni\244DR\032\261Z\001\330s\244Dr\304ja\343\006<S\\K@?~\f\341\321\367\031\274\340g\210\202/\340B\204\b\034d\006#\370\2020__p\312 }\340\013\354\274\274\346\3642\330\300\002\b\262T\002\251e\220\022H)\244\255p\226\3037\226\264\301K\332\203\237\204\207_\333\312\024\300\216\037?H\234M%\235\301\033\332\226^r\275&K\256\033\206\350F^_\227\311d-\316U\337'i\301Hy\351\245V\251u\257\356\224Z\336A\001(n\274\214\345\314E\200\262\214\216O\254\357\223\220`\244'K/k\262\344Q\337\256Q-\353"
+	.string	"\262Rk\203\344\313y\005\002\330\036rin}\217\224\007{\270\332\261\303jq"
+	.string	"\251\016c@\246<\226G6:\220^\260"
+	.ascii	"\340\224V\245U\231#\231uT\037wbtc\345\325\313\034/\261\202\250"
+	.ascii	"R\360\332\353\373\362F\211\343\377!\252\233\022\246\244\357\221"
+	.ascii	"\262\340\262FiCG\032\033\265\276o$+\036\212\362\324L\301\322"
+	.ascii	"\367\007B\342a\322\244\f{\230\2321c\203\026v(\301\0248YzI\225"
+	.ascii	",\251.\230;\245\226\215Ep(\270\241\253tu\266t\240\200/\200+\215"
+	.ascii	"\245\221D\336T\017\254A\311\322o\337k\362\366\33598Ym\216Eej"
+	.ascii	"\3000\351{\244#\366\260D\217\236\r\306\350!Ya\n\312\226~\361"
+	.ascii	"$/\236\006s\253\324r\026\320\f=*?~\262\364]\231+\203\005\020"
+	.ascii	"g\347v\254V\315\231\004\231\332\034N\022[\372m\3415y[\270]\034"
+	.ascii	"\300\245\226\215>Y\236\224\211U/4mi\372\376h\013\366\360d\211"
+	.ascii	"\316\351X-\234s6\032e*4Y\220V\360\361\256\036\336\235c\346\\"
+	.ascii	"\223^:\216\231\353\270t\347x0\223w\365\362\216]\364\216\306\360"
+	.ascii	"\217\276p\005z\226\356\233z\343$o\234v\263Wy\352\253\304\023"
+	.ascii	"=1:\276|L\022\340G\\\370\265\335\314\245\314\206\315u\263\301"
+	.ascii	"\026\26565y\335\224qIn\035\335\300\025`Y\372U\363\232\274j\256"
+	.ascii	"\334\255R\313\306T\316V\024\276\234\271\b\200\247\314\332\214"
+	.ascii	"}\217a\017c\220\265t\353.\231\3372/s\321\324\234s\346\312\306"
+	.ascii	"<\022=\270\210\321\361e\256\343\322\177\317\374\242!s%%J\337"
+	.ascii	"k\246\301\374\377\371\311[m\236\364=\235{\367\377'HO\2160$w,"
+	.ascii	"\304\0251f\365\225ry\310\200]\273z'(\007\330\\\337ch\303\377"
+	.ascii	"\353\3737\363\3241\347\274\243L\346#\225\220\371\327\327\262"
+	.ascii	"\326\245\177\250\332j\301\377{\020@\220\314Uj\242\344\234\353"
+	.ascii	"\036\016\3232\005\244\202\\\332\035\257\330\276\214\016\370\312"
+	.ascii	"\252\372\332\272b\373\312\272p\305\366\225\215UM\214\027\216"
+	.ascii	"\371\313x\305\226\363\205\252*#\n\257\254+\266\251|\341\212-"
+	.ascii	"g\345\031wY5'\277\214\271\312+_\310Uy*\263yeUpU\365\225u\305"
+	.ascii	"6\225u\341\212\355++\263}e\243\\5u\254Q\225\217\0272\333W^f\363"
+	.ascii	"\3122\272b\363\312\272b\373\302R\263\330\b3\343\221&J\022,5\353"
+	.ascii	"\252*\347\300\352\232:\032\331]%\275\362\232\234\253\033\215"
+	.ascii	"|\314v9[\220s\227\327q\315\324V\225\243\262\313A\205e\312\253"
+	.ascii	"&s\316\033\260\250\300\274r\225\235\261f\273\253(^9G\241z\312"
+	.ascii	"X9\347\274\2011i\227\223T;#\221\256\214\203F\316\021\344d\316"
+	.string	"X9\033k\266\3139\033s\316>\307\256d\316?\214\256\220XX9s)a\345.\343\026\0329\267[\033\271\254+60\257\021[\332\330\220\331*i\254W8\27422\257\371:b6cZ\306\221s\256s02\353\004\275\276nw\214y&\311\2266}\217\341\004\234\f\222\023r\205G\337\025\360]\327X\234\276\307@\205\357\227\r@Z\340\270\262:C2\316`T\021\210\242X\3020\0304\221\236O.P\022N\017A\340\351\342\302\237@\024\237\322\023*\204p\b\005\025\201\020x\022\323\242p\370\373\341`DP\023j\002\013\022~\350\323\211\bPP D\243\206Dhq\030\374\025\265h\022\002a \255@\205@(\"\232\242MHNB\240\020xB\241,\002 ,\341$\242x2\241\"E\235\202R\324)(\025J\rO\004\203\350\211\243\024u\272\2002\245FE\251\364L[h\370\023\210\020(\f\237?\201"
+	.string	"\006\203@(3\b\205\002\272@\203?\031'\322\342\031\034\022\016\201\305\"\020\252(<\211.\322\342\t\002\372\023\002[4\241\305\250\023\004\024\n\350\342\311Ij(\204@\361|\032A\224\222 %\016W\240D\030\031\214R\240\020\210\001J*\0044\370\223\361\303Hh\260Ix>I\320\204\006_\234B\b4\241\304\363\251\205\022\232\236i\013\031$\264 \246 \341\207>\375"
+	.string	"\020D\245R4\t\321\342\020\352d\"\n\312\004Q\220\b\020\301 zbh\204 \244?\201(\006\207\304T8\3741\375\210!~0\232\204'\024\324\360\304\217\370\363'\020?&\024\n\230\n\245\210!~0\234\316`\n'!\020\212x\006AE\261(\232@;"
+	.string	"l\361"
+	.string	"\242\bh0M\207\304'\nP(\240\213b\021\375\375N3\003\031\\@\204\006J'\341\020\204\364\004aD\223\020-\032a'!\260\351D=h\022\242\305\240!\361|q\207\304\363\001MB\264\210\377\004\242)8|\n\236C \361\214Q\016\201\304s\204\337\357\264MB\264\370C$\002DJ<\243R\240\035"
+	.string	"&\245\304\341\212\237\246\023\365\340LO\024MB\264(\004\205\246E\031-2\\\205\n\025*\230\206i\213\025\035\024\375\007$\242B\324\t\177\003\016\f\300A\t\023|^\"\001\"\022 \302|\211\004\214\030\221"
+	.ascii	"\016F\340s0\302\242LNB "
+	.string	"\361|j\221\246LE4\350$4AD\203R\020H\317\244\224)\005R\212a\b\324\240\001\003\t\305S\205P\n\206\020\312\364A\206\250\"T1\312\351\202\th\223\360\0034=\211MR\347\013&\023\206/H\370\235\301\027\031\376\004\302\204S\b\204J\317\02710\004\203\350\257\204\364|\021#C\020\215\201\202\220\n\321\"J\\\221\016C\310\2002a@\231\220\320\037Qj\330\202\210\246\250\212T\210\022\211R?\f2R\340\357\214:O\310 \242iz\276(J\317\007\214\200\026\245\206\212)\021\r\2328\201\026\245\220P\2473\025\242?\"\272\302I\b\024\022O\n@I\025\205\303\037\207\"\260\210\022\321\264(\343)=_\304 *\341$\332?\201\220\202\002\206H\237\234\200A\030J\301\340\220x\237~)0\252,\341\224ac\230E\246!\361|a\246\177\002ADS\024jH<_"
+	.string	"\340\304\220x\276@B\3233(\365\013\236\277\237!\361|\361\223Ja\031g\020mb\212\222\302i\032%\305\224\022\317\264\210\243D\030\022\317\027CQRL)\352d\246A\023C\342\371"
+	.string	"\037\224(\225\236D4\n\nu1$\236/\212\376\004\002\r\242\026\024\231~\277\263L\377\004b\202\264\002M'\312bH\224\341t\241\310\204\301\364i:\221\204)\232N\224X\3020X\004\"\246+\204)\210hZ\004:\241,( \025\005\225$L\201\246@b\t2`"
+	.ascii	"\211h\214!b\272\202\205T\024\324\2200E\212\026Q\242\217p"
+	.string	"\bLO\242\224T\024\224Q\n\024~\220\002\205\300KLW\374\204R)\232N\224\305\357g\002\251\310\024\003E\361\373\235\270\351D\211\367O \210\303\242\260\310\004\214j\321\024\2242\211\360\301\025\002W\b\213?\023\030U\264)\023\372\003\306@Q\024\245^\004\025\245^\330\016F0\375~\247Y\302\311\342\004\n\023&\361|\372]\264ix\"\006J\024B\231\204N\300\340\311D$t\002\006M\374~'N\377\004B*\n\212iH\224\341\364\373\235(\023\013\021$Dp \025\005u$\034\002S\251\340\260\210\022\201\212LH(S\013\251(\250 \342\260(D\213f\032\224*\242,\204C`\372CS\024\205T\024\024\206\030h\223u\022\002\203QPg\213\337\357<\362yJ\207C\250\026\277\337\371\023\034\016\037\300T\242?\241\bi\361DAHM4\241\351\331\0245\201 \372\373\231(\0027\244\177\002\021\242HDc"
+	.string	"\211M\304t\305\004P'1\205\t\304\242\"\223\320\b)q\270\302\b\r\2768]\3040\211(\020\0060\025\242M@\240\224\tm\032\252H\211\303( \264i\buS&\021R\3420j\250(\034\002\323\250\241\017\232\236,\232\244\316\027\030\355"
+	.string	"\260\005\332\001`\013\234\342\246\023\365\200(\324t\242\036\244L\031h\020\004\236.\210(\f\030R\0170!\025\"\246+\320\030@\364\207\262\b\236@\"Z\224\302$\374\316\027\301\340y\302\004\"P\372'\020\305(\247\020C \022\024\024\024\324-2AAAA\251P\201\002\005\n'\245\224\211\203\021\251\020\350\003\005\325\324\324T\376\tD\207\017\243Pb\210t8$\206\b*29\001a\b\207'.\244\247\021\332$\225\002\235\204C\020L"
+	.ascii	"\246\030\206P\214r\272\360\364K\201%\024\215\204C`\221\210\306"
+	.ascii	"\020\002\231\216L@\203QR(`\004O\017R\3420\252X\2042\245h\"\016"
+	.ascii	"\207'\212Q\035$\245'\024q\b\203\tMO!\260\2118\034\376P\246\024"
+	.ascii	"(\234@P\n\024J\001\t\207\300\"\360\207\022\243\220\212'\214\030"
+	.ascii	"L\032\202g\f\"\232\n?h\022J\r[@\021\317\240\2114\035>epQ4QD\245"
+	.ascii	"\202\347\bM\300(\244\224\251"
+	.string	"D*\004J\371\240Ng\032\034\306`\n\006\321\037SJ\034F\241\304\243\303@\300\006(\312\301\001\232@\\8\002\020p\242\202\t\204\320\001\376\201\220AB\221\b#\204\fb\212B\241A4\r!\004\236P!~\304b\b\020\034\376\233T\312\034Z\2143n\364}\373Aw\344\3144[2\243,/9B\313H]\337\245#bf\231\2309%\357\203\233\274\276.s\212Iv\317\214kF\223\314\034\373\232\343\303\315\nEy\324\330L)WH\r\023'W\245\3579\244a\001\314\231QL\025\314(u\310\027\007\037\330\303\035(f\030\024\253\325\345\213\203\025\376\315'&U\320\332\025\022\037H\323j\003o\3104N\372\210\257\304\261\273\321\244\257R\251\300\346$\205\262\016P\2218tH&\227n\314\313\221\313\22278\311\332\0246%zDV\370\250\370Hr\301|\3403\242\326wi\f\314Db\202\231G\352\361\250W"
+	.string	"*f\250\214\361e.\036K\277i\344\346\221\317\321x\263w\327\327,\3629\214\347\n\2253}M\"\237\033C\006l\210\004w\3707\277J;\023G\2273)&\nm\2655\003\017\234\227\030\f\254p\310\r)\353\232$\271\314h!\027MYE\226\233\004\221[s\002\026\033}\315\037&\220\233]7\273\332\354\262}}\346\331\031+\3465\267l\b\372\372\372\372\362\344<en\265\351\303\344\272\271\365\"\2375cWS\246V\251\245\250\206\2208xz\3340DO\246\346\204\360H[\343U\004\307\t%\230,\007mG\313\341\311q%kN\250\316M\035\025\216\267\213\217\266-)\035\205\032\250#\262szH\254\304 \214\344\224R\306T\321\020\2471\223\025@0PL*\226\353\342h\017\023\300\203\313KE\201('\031sHFD$IAAj\fkuC\342`\327\362\222\330s\373\244"
+	.ascii	"\255i\017D>\r\341\"\220U\027\031\342P\020\001L\265\\\206\231"
+	.ascii	"\025\363&\037\"\223\262-\234\b\023\373:\211\345\320\tj!\005\340"
+	.ascii	"\005\365\313\302\246\031\335\"\022\200\347\020\327\246C:\200"
+	.ascii	"H&\320\217\240\265\217\021\034\337\005x\340\re\366\365\307\305"
+	.ascii	"\374\017\177\262\371\316K5\227\334c-*\271yr\224y\215\206~M\304"
+	.ascii	"\234\220S\234\3054{\375\305\261\234M\215xH\372\354\232\203k\316"
+	.ascii	"\236\205\306\201\212t#\205f#\312\265\235Re}rM\240yv\332\206\274"
+	.ascii	"k\304\260c\013\300\311\032\210\025\342\240\363\311\250_\3706"
+	.ascii	"\272\351m@R\346\025\025\341=\243n\246\216\207I\357a\b\373u\n"
+	.ascii	"\207_\250\340\314\222W\231\250\205\201\346\204Ut\372:\321\265"
+	.ascii	"2\fL\255/\205S\342\023q\025\216\020V\222U5\276Z\034,\341U=\223"
+	.ascii	"\036\364m\323D\\\347\253\330\330\036\332L\216\"\232&\306\242"
+	.ascii	"\253o\221\246\\k~\027\375\325M-\324R\214J\357s\316\310\036\215"
+	.ascii	"BF\323\313\200\213].\245\321\241a6\033\247\365,2\026\362/%-\341"
+	.ascii	"\216\365\233Q\346\006\223c\217&O\242.}w\221\325\222\220\314U"
+	.ascii	"O\203\005\360\035&\214\342\376\310\034,l\350b\0138U\027\220\207"
+	.ascii	"\263\030i\034\316=}\252\3635\030\366`]\001\255\034A\026\233\356"
+	.ascii	";\354\341\336\300/q\300f\253\227MF\327`\352R\220\223\2351\021"
+	.ascii	"UQ8\351!\225\031L\\0\353\346\242\357!\370\243&nX\206\276\231"
+	.ascii	"\302\021\333\207F\327\023\274bN\240\357\327\350\355\342\177\031"
+	.ascii	" \036N\266\312@89L\030\312\254!\271d\301\254\215\301\223\330"
+	.ascii	"\024vT.U\016\352\nf\025~\\#\346\236\212\256\334\252\004?\345"
+	.ascii	"\262~\301\277\275\274\341\220\236\354\260\b\252\215\035\217\013"
+	.ascii	"\241\213"
+	.string	"\345\232\213u!9\271r\365\016\315\032\3144\0031\203\235B\207%]\273\t\023\n\016\325j[\200\363\027\277K3\244#\302[@^\263\031+\237\263g\240.\276\034\317\200\361\035\347\323\330\024\243\275\262\221\363\276\355\314.\tK12h\336\230\200\013\023xz\302q\356\r\005\335}\030\243\222\016\226\b"
+	.ascii	"\373Z|\316j\025\034\234\274 \376p\224k[\204\310{\t\320\3326o"
+	.ascii	" \340g\221\316O\254\317=[X\347\035\343\343\205\207\300\245cf"
+	.ascii	"\355C\007\227U\351\200\274\303\322Q\2210\360\220[\202\300i"
+	.string	"\365\332\366>@\345KE\221\326\342\035 \354\326\222\rD\350;D\003\365\024\217\3654|\327\307\221rK\006\214\220\251~\337\341)}\356\341\354\370#\205\226\353\201\244\233\203<\327\225\020\337\3023_\222L\250z\340\275\375\360pg\365\265>\240\0371w\376\f%\f\202\366\275\303)\224\031\224#h\277\235acR\375\343\255\330\233}7\332\262bk\217J=\360\026F\252H\007\026\273\026J5\223c\206\307\262\356\337\354\306\224d\270\363\202ev{\365Cr\021\017\322\261\247\004z6x9\313R7 \203\371[\354\365tr\001\264\177\353\365=\0060\273&\\\304\026[\272\023\247.\233\b\257\025\320\243\025\020.\377\201\331\323\267\tG\262\203Zq\233\372\035q\334nYr\220[\204\210\254B\031\313\271\246>\230}IT\330@\305\353\r\371^\376I\341 \276\032D\2662J\307\257\243!\365\234A\002a\210\200\335\330\313"
+	.string	"\237G#\331\021\242d\200\210Dw\203\250\037;\364\277\"f\030\244\005\363\317 \234\302^XW\231?\257\264\2176L\350\177\262s\337!\307\003\311@\354\314d\231\007\330\221<\321\331\214\0053\303\221"
+	.ascii	"GKU*mu\0070LK7\265b\303&\364Y\300\243t\032\200\267W3w\337>u\321"
+	.ascii	"\3350B\020\020\222\327D\026[\354\200|\324\254\n\327\027\312\225"
+	.ascii	"\036d\251\f\321\"\236ak\312\t\347\251\032d\345\013\242\377R\334"
+	.ascii	"0\n\376\222%\203\260\336\005\333G:\017\307\3074\374\033#\220"
+	.ascii	"Z\231\341\350\3747\233\265G\254\016\215\334\037\321\022#\004"
+	.ascii	"\353\270}\270\265\264\373\"\320\377p<M\003#F\3629$\370\356UD"
+	.ascii	"\335\241wI\330\254\245\006'\214Gn$\361:\313\017\307t\323\002"
+	.ascii	"\332\023\331\211\243\365ps\301B2I\340[\350)\237G\265\373h\023"
+	.ascii	"N\n9J\343\270\315/\211%2\270s\201v3ho\260)\272\354\004Z\0368"
+	.ascii	"\244\006\332kg\024p\271\340\222(\210\321\322A\025!\037a\205\236"
+	.ascii	"D\223~,\321$\356\275?,{\035\360\240\002\322\306\001M\360\270"
+	.ascii	":\327{\r)>\227zR\331\027(W\023H~\314q\202E\004\357{?\340 p\256"
+	.ascii	"\257\236\227\337\021\244\341;\376\244cq[2@O\301\357\177\276\007"
+	.ascii	"@\017T\320Dbb\254z\016\027Q\276v\345\003\300\b0\230K+\002\226"
+	.ascii	"6\021_\350H6\024G\234\321_\327a\230\265\347\251\001&\357\331"
+	.ascii	"\013\237j\255\361\026|(\243\032\264\034P\275\345'p]\377`\313"
+	.ascii	"\2526\276\265_\276O\360\317\377\002*:\370\\\004k|A\266O\303\333"
+	.ascii	"\330\312\244\006/F\227\245\224\200%\321\361\031R\276\364\273"
+	.ascii	"*\330\2772\217\342z\204\353\n\"\330\233\3320\221G\371\340\021"
+	.ascii	"\222\315\212;\006:\260\200\324 \324\221m\244\313z}\027\334\025"
+	.ascii	"m0\205?\220\203\320\366\312\305\2426\by\320\034\004S\003\274"
+	.ascii	"L\252\017\033\027\340z1\224\320\250\334\215\231L\217\321\347"
+	.ascii	"n.H\313%\327\211s5\212\254\342\0136\250#\335wk\232\0312v\231"
+	.ascii	". \325%\3112H9\022\372\335\246\224\276\306\316\331\364\r2\b\217"
+	.ascii	"\313G\230\253\207<\030\372\200f\t\3442\324\210\367\237\313b\337"
+	.ascii	"\020\335\374\004\371\272Q\370.\220\b\030VN%\022\253\374\304\325"
+	.ascii	"\027\244\210\0029"
+	.string	"cM\363\372@\332\260\241\223W\to\231\323\337\270\305p\031\215O9_E\004\214\351m\003\302\312\177#<\\\356lh\025\f\366\311\201qg\004\027\336\345sP\274p\250\315*\030\264\300\311\3236\326I~\276_\237\031D\005T #G\331%\336@\0253\371\237\223\257\007)('IH\200\365uy<L2?\314\310*\331X\0200\262$i\337X\272\037\333\002\023U\216\350\306\373?X\240%\220DG\326\323Z\005\2656h\357g\034+\027%\214\221\003\2679\355 \310d\373\203\237\270IH\240\005\230.\250\300^o\203\366\314\370g\333\213x\243\t\331\005\001\300\327\2374%pY\226\263\230\307\034\370\236a\224\334\331\241\321\271B\326\361\346T\177\200\201\365\360@C\031q\262\037G\205\322\217\233-U\037\313T\223\n\355\360\357\256\242\215\347\002F\235\017\021\023\254\002\211K\350\311A>\364\243\311g\f\367\264\233\350"
+	.string	"\202\b\351\3737\"\236\200\331\3546\310"
+	.string	"X\214\365}B\331\233I\323W\356\332<EO\323\005Qa\320\007\355\332\261+\314\353\305\320#Z\"\311.\232BD\207\315\013]\006\212R\375\021o\221c\013\217F\323\370\350\313\270\220h\261\222\304y\313\006\2047\255\251!\203K\351t\245\260\210\305\210\005\213r\231\213,E\334\30369\327g\265\227\022L\004c\252\300\361o\f\003[\342\371\265"
+	.ascii	"d}\025\2045\341\357\325^\252\364_g\211LN\263\234A=\036V\232\310"
+	.ascii	"\0340\226\222\216$\377L\230`\312Kw#\325\211b\234\202\025\001"
+	.ascii	"\354R g\311\232\363\240\366\222\300}o\234\371\263?O~\035\253"
+	.ascii	"\321\0170=?\003\347r\025&\377g.\033\366\311\2562\342\255cX\264"
+	.ascii	"\002\t\003"
+	.string	"\033\351\254K\316|\301\177\246\204\020<g\036\274\3140e\275rS\324\375\300\035\276\3758\222\304\"(\n\020>n;\375%\253\007\312\315\030\006J\206\364\235\353t\315\323p\245a\004o\303\2204z\226\2208\216I\241\335_\204>gp$\030\002\363\247\023\275u\001\277y\205l\330*\245E(#\222\355cy\3224\030\n-\006\024\270\2504\216\314\233\030\205(\031\240\302a\004\324(\003\316w\\\266\353\225\031\240\002;k\210_\355\262q8\3250\334\367`\252\001`\017J\350\205\362V|\213\f|\271\374\222e\327\031XS}p\347\016\242\027\247\246[^\303-\003r\316.<\0233U:\317 \265\252\361|\261M\252\250\362d\253E\002Y\225\013\350Kc\007\241\235|4\354U\206\274\245q\322=\344\243\226\313\357\0132\376\203\342M\377\337\300\242\f\205;\237c\370Mq\332\307\210;\341\353\032\316*\276\321\307?\323"
+	.ascii	"\254\031\362\333\364\367{6\f\301\264\316\277\322\314\002\333"
+	.ascii	"\257\341?(\025o\032\334#\356\334\r\1770z\306\276\357\347\331"
+	.ascii	"\235VZq\344\376\240\212\370\200\317t\3339\306#\362\301\307\300"
+	.ascii	"\235V~8\363\375\362E\267\213\213\021\0257\006;\220\323\016`\337"
+	.ascii	"\371\005\245\377\004\363T\026G\245\3530\214\236\354\313\303u"
+	.ascii	"\277\251?\374\003\264\275O\356O\232\020h\316\206'qf\236\035\\"
+	.ascii	"\005\347R\224\370\317\312\210\240\034\247\345?\026\333Z\304\356"
+	.ascii	"\343(In\377Z\306\277F*\362\220\345\327\364\034\262\361\256\312"
+	.ascii	"8\223\343U\265M\022m\007\276@\035\364\366\3013u\241\331\370\371"
+	.ascii	"\354\036\217{\2715O_z\334\270\344\232\217\036\371<b\365\322\350"
+	.ascii	"\255\305W\314^f\334\004\004O\230x\346\361\376{\323\253c\343~"
+	.ascii	"\025\306n\274K\367\207T"
+	.ascii	"\335F\334[cR\337:+\030\211{\221\ro\237\257\325\343\344\003\336"
+	.ascii	"~\273m\256\203P\177\342\032r4\207\247/\302\315\003)\244\230\314"
+	.ascii	"\223\232A\234.\\_\242\254\253m\303\322<._\377\320f\267\342\322"
+	.ascii	"g\231\355\367,J\307\253\377\236\257j`C\205O\001\027%\\\350\034"
+	.ascii	"F\211\365\206\234]bo\224\213b\266~\3235\374y\337\220\341W\360"
+	.ascii	"\177\026\306\362\233\235w.\020\331\357\201fW"
+	.text
+	.section	.gnu.lto_.symtab.c0b0ecebf4063c13,"e",@progbits
+	.string	"initFrSkyTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"freeFrSkyTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"configureFrSkyTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"hasEnoughTimeLapsedSinceLastTelemetryTransmission"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"checkFrSkyTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"handleFrSkyTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"vario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\002"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"calculateBatteryPercentageRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c0b0ecebf4063c13,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,13662 @@
+	.file	"hott.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/drivers/serial.h"
+	.file 7 "./src/main/drivers/resource.h"
+	.file 8 "./src/main/io/serial.h"
+	.file 9 "./src/main/sensors/sensors.h"
+	.file 10 "./src/main/sensors/battery.h"
+	.file 11 "./src/main/drivers/barometer.h"
+	.file 12 "./src/main/sensors/barometer.h"
+	.file 13 "./src/main/flight/pid.h"
+	.file 14 "./src/main/flight/altitudehold.h"
+	.file 15 "./src/main/telemetry/telemetry.h"
+	.file 16 "./src/main/telemetry/hott.h"
+	.file 17 "./src/main/telemetry/hott.c"
+	.file 18 "/usr/include/string.h"
+	.file 19 "./src/main/drivers/system.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	hott.c.3f4b8361
+	.weak	hott.c.3f4b8361
+hott.c.3f4b8361:
+	.long	0x12f6
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF1925
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1555
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1556
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1557
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1558
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1559
+	.uleb128 0x5
+	.long	.LASF1561
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1560
+	.uleb128 0x5
+	.long	.LASF1562
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x5
+	.long	.LASF1563
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1564
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1565
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1566
+	.uleb128 0x5
+	.long	.LASF1567
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1568
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xf
+	.long	0x9f
+	.uleb128 0x23
+	.long	0x9f
+	.uleb128 0x5
+	.long	.LASF1569
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0xf
+	.long	0xb5
+	.uleb128 0x5
+	.long	.LASF1570
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x5
+	.long	.LASF1571
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x5
+	.long	.LASF1572
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0xc6
+	.uleb128 0x6
+	.long	0x9f
+	.uleb128 0x24
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0x217
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1623
+	.long	0x30
+	.byte	0x16
+	.long	0x238
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1623
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x3
+	.long	0x217
+	.uleb128 0x1b
+	.long	.LASF1624
+	.long	0x30
+	.byte	0x1c
+	.long	0x28f
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1624
+	.byte	0x6
+	.byte	0x2f
+	.byte	0x3
+	.long	0x244
+	.uleb128 0x5
+	.long	.LASF1635
+	.byte	0x6
+	.byte	0x31
+	.byte	0x10
+	.long	0x2a7
+	.uleb128 0x6
+	.long	0x2ac
+	.uleb128 0xd
+	.long	0x2b7
+	.uleb128 0x4
+	.long	0xb5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1636
+	.byte	0x6
+	.byte	0x32
+	.byte	0x10
+	.long	0x2c3
+	.uleb128 0x6
+	.long	0x2c8
+	.uleb128 0xd
+	.long	0x2d8
+	.uleb128 0x4
+	.long	0x2d8
+	.uleb128 0x4
+	.long	0x70
+	.byte	0
+	.uleb128 0x6
+	.long	0xab
+	.uleb128 0x10
+	.long	.LASF1652
+	.byte	0x50
+	.byte	0x6
+	.byte	0x34
+	.byte	0x10
+	.long	0x3ae
+	.uleb128 0x3
+	.long	.LASF1637
+	.byte	0x6
+	.byte	0x36
+	.byte	0x24
+	.long	0x45d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1638
+	.byte	0x6
+	.byte	0x38
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1639
+	.byte	0x6
+	.byte	0x39
+	.byte	0x10
+	.long	0x238
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1640
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x13
+	.long	0x28f
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1641
+	.byte	0x6
+	.byte	0x3c
+	.byte	0xe
+	.long	0xc6
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1642
+	.byte	0x6
+	.byte	0x3e
+	.byte	0xe
+	.long	0xc6
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1643
+	.byte	0x6
+	.byte	0x3f
+	.byte	0xe
+	.long	0xc6
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF1644
+	.byte	0x6
+	.byte	0x40
+	.byte	0x17
+	.long	0x462
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1645
+	.byte	0x6
+	.byte	0x41
+	.byte	0x17
+	.long	0x462
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1646
+	.byte	0x6
+	.byte	0x42
+	.byte	0xe
+	.long	0xc6
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1647
+	.byte	0x6
+	.byte	0x43
+	.byte	0xe
+	.long	0xc6
+	.byte	0x34
+	.uleb128 0x3
+	.long	.LASF1648
+	.byte	0x6
+	.byte	0x44
+	.byte	0xe
+	.long	0xc6
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1649
+	.byte	0x6
+	.byte	0x45
+	.byte	0xe
+	.long	0xc6
+	.byte	0x3c
+	.uleb128 0x3
+	.long	.LASF1650
+	.byte	0x6
+	.byte	0x47
+	.byte	0x1e
+	.long	0x29b
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1651
+	.byte	0x6
+	.byte	0x48
+	.byte	0x23
+	.long	0x2b7
+	.byte	0x48
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1653
+	.byte	0x60
+	.byte	0x6
+	.byte	0x5a
+	.byte	0x8
+	.long	0x458
+	.uleb128 0x3
+	.long	.LASF1654
+	.byte	0x6
+	.byte	0x5b
+	.byte	0xc
+	.long	0x48d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1655
+	.byte	0x6
+	.byte	0x5d
+	.byte	0x10
+	.long	0x4a6
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1656
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x10
+	.long	0x4a6
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1657
+	.byte	0x6
+	.byte	0x60
+	.byte	0xf
+	.long	0x4ba
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1658
+	.byte	0x6
+	.byte	0x63
+	.byte	0xc
+	.long	0x4cf
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1659
+	.byte	0x6
+	.byte	0x65
+	.byte	0xb
+	.long	0x4ea
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1660
+	.byte	0x6
+	.byte	0x67
+	.byte	0xc
+	.long	0x4ff
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1661
+	.byte	0x6
+	.byte	0x69
+	.byte	0xc
+	.long	0x51f
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1662
+	.byte	0x6
+	.byte	0x6b
+	.byte	0xc
+	.long	0x52f
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1663
+	.byte	0x6
+	.byte	0x6c
+	.byte	0xc
+	.long	0x52f
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF1664
+	.byte	0x6
+	.byte	0x6f
+	.byte	0xb
+	.long	0x54d
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF1665
+	.byte	0x6
+	.byte	0x71
+	.byte	0xb
+	.long	0x566
+	.byte	0x58
+	.byte	0
+	.uleb128 0xf
+	.long	0x3ae
+	.uleb128 0x6
+	.long	0x458
+	.uleb128 0x6
+	.long	0xb0
+	.uleb128 0x5
+	.long	.LASF1666
+	.byte	0x6
+	.byte	0x49
+	.byte	0x3
+	.long	0x2dd
+	.uleb128 0xf
+	.long	0x467
+	.uleb128 0xd
+	.long	0x488
+	.uleb128 0x4
+	.long	0x488
+	.uleb128 0x4
+	.long	0x9f
+	.byte	0
+	.uleb128 0x6
+	.long	0x467
+	.uleb128 0x6
+	.long	0x478
+	.uleb128 0x11
+	.long	0xc6
+	.long	0x4a1
+	.uleb128 0x4
+	.long	0x4a1
+	.byte	0
+	.uleb128 0x6
+	.long	0x473
+	.uleb128 0x6
+	.long	0x492
+	.uleb128 0x11
+	.long	0x9f
+	.long	0x4ba
+	.uleb128 0x4
+	.long	0x488
+	.byte	0
+	.uleb128 0x6
+	.long	0x4ab
+	.uleb128 0xd
+	.long	0x4cf
+	.uleb128 0x4
+	.long	0x488
+	.uleb128 0x4
+	.long	0xc6
+	.byte	0
+	.uleb128 0x6
+	.long	0x4bf
+	.uleb128 0x11
+	.long	0x4e3
+	.long	0x4e3
+	.uleb128 0x4
+	.long	0x4a1
+	.byte	0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1667
+	.uleb128 0x6
+	.long	0x4d4
+	.uleb128 0xd
+	.long	0x4ff
+	.uleb128 0x4
+	.long	0x488
+	.uleb128 0x4
+	.long	0x238
+	.byte	0
+	.uleb128 0x6
+	.long	0x4ef
+	.uleb128 0xd
+	.long	0x519
+	.uleb128 0x4
+	.long	0x488
+	.uleb128 0x4
+	.long	0x519
+	.uleb128 0x4
+	.long	0x70
+	.byte	0
+	.uleb128 0x6
+	.long	0x51e
+	.uleb128 0x25
+	.uleb128 0x6
+	.long	0x504
+	.uleb128 0xd
+	.long	0x52f
+	.uleb128 0x4
+	.long	0x488
+	.byte	0
+	.uleb128 0x6
+	.long	0x524
+	.uleb128 0x11
+	.long	0x70
+	.long	0x54d
+	.uleb128 0x4
+	.long	0x488
+	.uleb128 0x4
+	.long	0xea
+	.uleb128 0x4
+	.long	0x70
+	.byte	0
+	.uleb128 0x6
+	.long	0x534
+	.uleb128 0x11
+	.long	0x4e3
+	.long	0x566
+	.uleb128 0x4
+	.long	0x488
+	.uleb128 0x4
+	.long	0x2b7
+	.byte	0
+	.uleb128 0x6
+	.long	0x552
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x1a
+	.long	0x58a
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1671
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x3
+	.long	0x56b
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x20
+	.long	0x5fc
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1675
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1676
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1677
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1678
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1679
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1680
+	.byte	0x80
+	.uleb128 0x12
+	.long	.LASF1681
+	.value	0x200
+	.uleb128 0x12
+	.long	.LASF1682
+	.value	0x400
+	.uleb128 0x12
+	.long	.LASF1683
+	.value	0x800
+	.uleb128 0x12
+	.long	.LASF1684
+	.value	0x1000
+	.uleb128 0x12
+	.long	.LASF1685
+	.value	0x2000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1686
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x3
+	.long	0x596
+	.uleb128 0xa
+	.byte	0x5
+	.long	0x70
+	.byte	0x8
+	.byte	0x47
+	.long	0x65d
+	.uleb128 0x26
+	.long	.LASF1687
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1694
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1695
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1696
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1697
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1699
+	.byte	0x8
+	.byte	0x54
+	.byte	0x3
+	.long	0x608
+	.uleb128 0x10
+	.long	.LASF1700
+	.byte	0xc
+	.byte	0x8
+	.byte	0x69
+	.byte	0x10
+	.long	0x6c5
+	.uleb128 0x3
+	.long	.LASF1701
+	.byte	0x8
+	.byte	0x6a
+	.byte	0xe
+	.long	0xb5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1638
+	.byte	0x8
+	.byte	0x6b
+	.byte	0x1c
+	.long	0x65d
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1702
+	.byte	0x8
+	.byte	0x6c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1703
+	.byte	0x8
+	.byte	0x6d
+	.byte	0xd
+	.long	0x9f
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1704
+	.byte	0x8
+	.byte	0x6e
+	.byte	0xd
+	.long	0x9f
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1705
+	.byte	0x8
+	.byte	0x6f
+	.byte	0xd
+	.long	0x9f
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1706
+	.byte	0x8
+	.byte	0x70
+	.byte	0x3
+	.long	0x669
+	.uleb128 0xf
+	.long	0x6c5
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x14
+	.long	0x701
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1709
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1712
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x31
+	.long	0x72d
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1717
+	.byte	0xa
+	.byte	0x36
+	.byte	0x3
+	.long	0x708
+	.uleb128 0x5
+	.long	.LASF1718
+	.byte	0xb
+	.byte	0x14
+	.byte	0x10
+	.long	0x745
+	.uleb128 0x6
+	.long	0xef
+	.uleb128 0x5
+	.long	.LASF1719
+	.byte	0xb
+	.byte	0x15
+	.byte	0x10
+	.long	0x756
+	.uleb128 0x6
+	.long	0x75b
+	.uleb128 0xd
+	.long	0x76b
+	.uleb128 0x4
+	.long	0x76b
+	.uleb128 0x4
+	.long	0x76b
+	.byte	0
+	.uleb128 0x6
+	.long	0x93
+	.uleb128 0x10
+	.long	.LASF1720
+	.byte	0x30
+	.byte	0xb
+	.byte	0x17
+	.byte	0x10
+	.long	0x7d9
+	.uleb128 0x3
+	.long	.LASF1721
+	.byte	0xb
+	.byte	0x18
+	.byte	0xe
+	.long	0xb5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1722
+	.byte	0xb
+	.byte	0x19
+	.byte	0xe
+	.long	0xb5
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1723
+	.byte	0xb
+	.byte	0x1a
+	.byte	0x13
+	.long	0x739
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1724
+	.byte	0xb
+	.byte	0x1b
+	.byte	0x13
+	.long	0x739
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1725
+	.byte	0xb
+	.byte	0x1c
+	.byte	0x13
+	.long	0x739
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1726
+	.byte	0xb
+	.byte	0x1d
+	.byte	0x13
+	.long	0x739
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1727
+	.byte	0xb
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x74a
+	.byte	0x28
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1728
+	.byte	0xb
+	.byte	0x1f
+	.byte	0x3
+	.long	0x770
+	.uleb128 0x10
+	.long	.LASF1729
+	.byte	0x38
+	.byte	0xc
+	.byte	0x2b
+	.byte	0x10
+	.long	0x81a
+	.uleb128 0x27
+	.string	"dev"
+	.byte	0xc
+	.byte	0x2c
+	.byte	0xf
+	.long	0x7d9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1730
+	.byte	0xc
+	.byte	0x2d
+	.byte	0xd
+	.long	0x93
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1731
+	.byte	0xc
+	.byte	0x2e
+	.byte	0xd
+	.long	0x93
+	.byte	0x34
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1732
+	.byte	0xc
+	.byte	0x2f
+	.byte	0x3
+	.long	0x7e5
+	.uleb128 0x15
+	.long	.LASF1744
+	.byte	0xc
+	.byte	0x31
+	.byte	0xf
+	.long	0x81a
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x23
+	.long	0x881
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0xa
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1745
+	.byte	0xe
+	.byte	0x17
+	.byte	0x10
+	.long	0x93
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x1e
+	.long	0x8a6
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1748
+	.byte	0xf
+	.byte	0x21
+	.byte	0x3
+	.long	0x88d
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x23
+	.long	0x8cb
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1751
+	.byte	0xf
+	.byte	0x26
+	.byte	0x3
+	.long	0x8b2
+	.uleb128 0x10
+	.long	.LASF1752
+	.byte	0x1c
+	.byte	0xf
+	.byte	0x28
+	.byte	0x10
+	.long	0x981
+	.uleb128 0x3
+	.long	.LASF1753
+	.byte	0xf
+	.byte	0x29
+	.byte	0xb
+	.long	0x701
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1754
+	.byte	0xf
+	.byte	0x2a
+	.byte	0xb
+	.long	0x701
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1755
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1756
+	.byte	0xf
+	.byte	0x2c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1757
+	.byte	0xf
+	.byte	0x2d
+	.byte	0xd
+	.long	0x9f
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1758
+	.byte	0xf
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x8a6
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1759
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x11
+	.long	0x8cb
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1760
+	.byte	0xf
+	.byte	0x30
+	.byte	0xd
+	.long	0x9f
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1761
+	.byte	0xf
+	.byte	0x31
+	.byte	0xd
+	.long	0x9f
+	.byte	0x15
+	.uleb128 0x3
+	.long	.LASF1762
+	.byte	0xf
+	.byte	0x32
+	.byte	0xd
+	.long	0x9f
+	.byte	0x16
+	.uleb128 0x3
+	.long	.LASF1763
+	.byte	0xf
+	.byte	0x33
+	.byte	0xd
+	.long	0x9f
+	.byte	0x17
+	.uleb128 0x3
+	.long	.LASF1764
+	.byte	0xf
+	.byte	0x34
+	.byte	0xd
+	.long	0x9f
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1765
+	.byte	0xf
+	.byte	0x35
+	.byte	0x3
+	.long	0x8d7
+	.uleb128 0xf
+	.long	0x981
+	.uleb128 0x15
+	.long	.LASF1766
+	.byte	0xf
+	.byte	0x37
+	.byte	0x1a
+	.long	0x981
+	.uleb128 0xa
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x31
+	.long	0x9e1
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0x80
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1776
+	.value	0x101
+	.long	0xc29
+	.uleb128 0x2
+	.long	.LASF1777
+	.value	0x102
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1778
+	.value	0x103
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1779
+	.value	0x104
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1780
+	.value	0x119
+	.byte	0xd
+	.long	0x9f
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1781
+	.value	0x11a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1782
+	.value	0x124
+	.byte	0xd
+	.long	0x9f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1783
+	.value	0x12f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1784
+	.value	0x130
+	.byte	0xd
+	.long	0x9f
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1785
+	.value	0x131
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1786
+	.value	0x132
+	.byte	0xd
+	.long	0x9f
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1787
+	.value	0x133
+	.byte	0xd
+	.long	0x9f
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1788
+	.value	0x134
+	.byte	0xd
+	.long	0x9f
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1789
+	.value	0x135
+	.byte	0xd
+	.long	0x9f
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1790
+	.value	0x136
+	.byte	0xd
+	.long	0x9f
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1791
+	.value	0x137
+	.byte	0xd
+	.long	0x9f
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1792
+	.value	0x138
+	.byte	0xd
+	.long	0x9f
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF1793
+	.value	0x139
+	.byte	0xd
+	.long	0x9f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1794
+	.value	0x13a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1795
+	.value	0x13b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1796
+	.value	0x13c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1797
+	.value	0x13e
+	.byte	0xd
+	.long	0x9f
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1798
+	.value	0x13f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1799
+	.value	0x141
+	.byte	0xd
+	.long	0x9f
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1800
+	.value	0x142
+	.byte	0xd
+	.long	0x9f
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF1801
+	.value	0x144
+	.byte	0xd
+	.long	0x9f
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1802
+	.value	0x145
+	.byte	0xd
+	.long	0x9f
+	.byte	0x19
+	.uleb128 0x2
+	.long	.LASF1803
+	.value	0x147
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1804
+	.value	0x148
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF1805
+	.value	0x14a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1806
+	.value	0x14b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF1807
+	.value	0x14d
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1808
+	.value	0x14e
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF1809
+	.value	0x150
+	.byte	0xd
+	.long	0x9f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1810
+	.value	0x151
+	.byte	0xd
+	.long	0x9f
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF1811
+	.value	0x153
+	.byte	0xd
+	.long	0x9f
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1812
+	.value	0x154
+	.byte	0xd
+	.long	0x9f
+	.byte	0x23
+	.uleb128 0x2
+	.long	.LASF1813
+	.value	0x156
+	.byte	0xd
+	.long	0x9f
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1814
+	.value	0x158
+	.byte	0xd
+	.long	0x9f
+	.byte	0x25
+	.uleb128 0x2
+	.long	.LASF1815
+	.value	0x159
+	.byte	0xd
+	.long	0x9f
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1816
+	.value	0x15b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x27
+	.uleb128 0x2
+	.long	.LASF1817
+	.value	0x15c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1818
+	.value	0x15e
+	.byte	0xd
+	.long	0x9f
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF1819
+	.value	0x15f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF1820
+	.value	0x160
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2b
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1821
+	.value	0x161
+	.long	0x9e1
+	.uleb128 0x1c
+	.long	.LASF1822
+	.value	0x164
+	.long	0xe7c
+	.uleb128 0x2
+	.long	.LASF1777
+	.value	0x165
+	.byte	0xb
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1823
+	.value	0x166
+	.byte	0xb
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1779
+	.value	0x167
+	.byte	0xb
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1780
+	.value	0x173
+	.byte	0xb
+	.long	0x9f
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1781
+	.value	0x174
+	.byte	0xb
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1782
+	.value	0x176
+	.byte	0xb
+	.long	0x9f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1824
+	.value	0x179
+	.byte	0xb
+	.long	0x9f
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1825
+	.value	0x17a
+	.byte	0xb
+	.long	0x9f
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1826
+	.value	0x17b
+	.byte	0xb
+	.long	0x9f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1827
+	.value	0x17d
+	.byte	0xb
+	.long	0x9f
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1828
+	.value	0x17e
+	.byte	0xb
+	.long	0x9f
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1829
+	.value	0x17f
+	.byte	0xb
+	.long	0x9f
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1830
+	.value	0x180
+	.byte	0xb
+	.long	0x9f
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1831
+	.value	0x181
+	.byte	0xb
+	.long	0x9f
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1832
+	.value	0x183
+	.byte	0xb
+	.long	0x9f
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1833
+	.value	0x184
+	.byte	0xb
+	.long	0x9f
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF1834
+	.value	0x185
+	.byte	0xb
+	.long	0x9f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1835
+	.value	0x186
+	.byte	0xb
+	.long	0x9f
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1836
+	.value	0x187
+	.byte	0xb
+	.long	0x9f
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1837
+	.value	0x189
+	.byte	0xb
+	.long	0x9f
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1838
+	.value	0x18a
+	.byte	0xb
+	.long	0x9f
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1803
+	.value	0x18c
+	.byte	0xb
+	.long	0x9f
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1804
+	.value	0x18d
+	.byte	0xb
+	.long	0x9f
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1811
+	.value	0x18f
+	.byte	0xb
+	.long	0x9f
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF1812
+	.value	0x190
+	.byte	0xb
+	.long	0x9f
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1813
+	.value	0x192
+	.byte	0xb
+	.long	0x9f
+	.byte	0x19
+	.uleb128 0x2
+	.long	.LASF1839
+	.value	0x194
+	.byte	0xb
+	.long	0x9f
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1840
+	.value	0x195
+	.byte	0xb
+	.long	0x9f
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF1841
+	.value	0x197
+	.byte	0xb
+	.long	0x9f
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1842
+	.value	0x198
+	.byte	0xb
+	.long	0x9f
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF1843
+	.value	0x199
+	.byte	0xb
+	.long	0x9f
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1844
+	.value	0x19a
+	.byte	0xb
+	.long	0x9f
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF1845
+	.value	0x19c
+	.byte	0xb
+	.long	0x9f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1846
+	.value	0x19d
+	.byte	0xb
+	.long	0x9f
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF1847
+	.value	0x19e
+	.byte	0xb
+	.long	0x9f
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1848
+	.value	0x19f
+	.byte	0xb
+	.long	0x9f
+	.byte	0x23
+	.uleb128 0x2
+	.long	.LASF1849
+	.value	0x1a1
+	.byte	0xb
+	.long	0x9f
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1850
+	.value	0x1a2
+	.byte	0xb
+	.long	0x9f
+	.byte	0x25
+	.uleb128 0x2
+	.long	.LASF1851
+	.value	0x1a4
+	.byte	0xb
+	.long	0x9f
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1852
+	.value	0x1a6
+	.byte	0xb
+	.long	0x9f
+	.byte	0x27
+	.uleb128 0x2
+	.long	.LASF1853
+	.value	0x1a7
+	.byte	0xb
+	.long	0x9f
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1854
+	.value	0x1a8
+	.byte	0xb
+	.long	0x9f
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF1855
+	.value	0x1a9
+	.byte	0xb
+	.long	0x9f
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF1820
+	.value	0x1ad
+	.byte	0xb
+	.long	0x9f
+	.byte	0x2b
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1856
+	.value	0x1ae
+	.long	0xc34
+	.uleb128 0x7
+	.long	.LASF1857
+	.byte	0x63
+	.byte	0x11
+	.long	0xc6
+	.uleb128 0x7
+	.long	.LASF1858
+	.byte	0x64
+	.byte	0x11
+	.long	0xc6
+	.uleb128 0x7
+	.long	.LASF1859
+	.byte	0x65
+	.byte	0x11
+	.long	0xc6
+	.uleb128 0x7
+	.long	.LASF1860
+	.byte	0x67
+	.byte	0xc
+	.long	0x4e3
+	.uleb128 0x7
+	.long	.LASF1861
+	.byte	0x69
+	.byte	0x11
+	.long	0xea
+	.uleb128 0x7
+	.long	.LASF1862
+	.byte	0x6a
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x7
+	.long	.LASF1863
+	.byte	0x6b
+	.byte	0x10
+	.long	0x9f
+	.uleb128 0x7
+	.long	.LASF1864
+	.byte	0x72
+	.byte	0x16
+	.long	0x488
+	.uleb128 0x7
+	.long	.LASF1865
+	.byte	0x73
+	.byte	0x1c
+	.long	0xeea
+	.uleb128 0x6
+	.long	0x6c5
+	.uleb128 0x7
+	.long	.LASF1866
+	.byte	0x75
+	.byte	0xc
+	.long	0x4e3
+	.uleb128 0x7
+	.long	.LASF1867
+	.byte	0x76
+	.byte	0x16
+	.long	0x58a
+	.uleb128 0x7
+	.long	.LASF1868
+	.byte	0x78
+	.byte	0x17
+	.long	0xe7c
+	.uleb128 0x7
+	.long	.LASF1869
+	.byte	0x79
+	.byte	0x17
+	.long	0xc29
+	.uleb128 0x16
+	.long	.LASF1654
+	.byte	0x6
+	.byte	0x74
+	.long	0xf31
+	.uleb128 0x4
+	.long	0x488
+	.uleb128 0x4
+	.long	0x9f
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1870
+	.byte	0x6
+	.byte	0x7c
+	.long	0xf47
+	.uleb128 0x4
+	.long	0x488
+	.uleb128 0x4
+	.long	0x238
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1657
+	.byte	0x6
+	.byte	0x78
+	.byte	0x9
+	.long	0x9f
+	.long	0xf5d
+	.uleb128 0x4
+	.long	0x488
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1871
+	.byte	0x6
+	.byte	0x75
+	.byte	0xa
+	.long	0xc6
+	.long	0xf73
+	.uleb128 0x4
+	.long	0x4a1
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1872
+	.byte	0xf
+	.byte	0x43
+	.byte	0x5
+	.long	0x4e3
+	.long	0xf89
+	.uleb128 0x4
+	.long	0x58a
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1873
+	.byte	0x8
+	.byte	0x92
+	.byte	0xf
+	.long	0x488
+	.long	0xfb8
+	.uleb128 0x4
+	.long	0x65d
+	.uleb128 0x4
+	.long	0x5fc
+	.uleb128 0x4
+	.long	0x29b
+	.uleb128 0x4
+	.long	0xc6
+	.uleb128 0x4
+	.long	0x238
+	.uleb128 0x4
+	.long	0x28f
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1874
+	.byte	0x12
+	.byte	0x3d
+	.byte	0xe
+	.long	0x8a
+	.long	0xfd8
+	.uleb128 0x4
+	.long	0x8a
+	.uleb128 0x4
+	.long	0x70
+	.uleb128 0x4
+	.long	0xd2
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1875
+	.byte	0x8
+	.byte	0x89
+	.byte	0xf
+	.long	0x58a
+	.long	0xff3
+	.uleb128 0x4
+	.long	0xff3
+	.uleb128 0x4
+	.long	0x5fc
+	.byte	0
+	.uleb128 0x6
+	.long	0x6d1
+	.uleb128 0xe
+	.long	.LASF1876
+	.byte	0x8
+	.byte	0x86
+	.byte	0x15
+	.long	0xeea
+	.long	0x100e
+	.uleb128 0x4
+	.long	0x5fc
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1877
+	.byte	0x8
+	.byte	0x9a
+	.long	0x101f
+	.uleb128 0x4
+	.long	0x488
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1878
+	.byte	0xa
+	.byte	0x4c
+	.byte	0x9
+	.long	0x93
+	.uleb128 0x13
+	.long	.LASF1879
+	.byte	0xa
+	.byte	0x4a
+	.byte	0x9
+	.long	0x93
+	.uleb128 0x13
+	.long	.LASF1880
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x10
+	.long	0x72d
+	.uleb128 0x13
+	.long	.LASF1881
+	.byte	0x13
+	.byte	0x1d
+	.byte	0xa
+	.long	0xc6
+	.uleb128 0x13
+	.long	.LASF1882
+	.byte	0xa
+	.byte	0x46
+	.byte	0xa
+	.long	0xb5
+	.uleb128 0x17
+	.long	.LASF1884
+	.value	0x208
+	.long	0x107f
+	.uleb128 0x8
+	.long	.LASF1887
+	.value	0x208
+	.byte	0x23
+	.long	0xde
+	.uleb128 0xb
+	.long	.LASF1883
+	.value	0x20a
+	.byte	0x15
+	.long	0xde
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1885
+	.value	0x1fa
+	.long	0x1097
+	.uleb128 0xb
+	.long	.LASF1886
+	.value	0x1fc
+	.byte	0x9
+	.long	0x4e3
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1889
+	.byte	0x11
+	.value	0x1f2
+	.byte	0x13
+	.long	0x4e3
+	.uleb128 0x29
+	.long	.LASF1926
+	.byte	0x11
+	.value	0x1ed
+	.byte	0x13
+	.long	0x4e3
+	.long	0x10c2
+	.uleb128 0x8
+	.long	.LASF1888
+	.value	0x1ed
+	.byte	0x36
+	.long	0xc6
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1890
+	.value	0x1cb
+	.byte	0xd
+	.uleb128 0xc
+	.long	.LASF1892
+	.value	0x1c6
+	.byte	0xd
+	.long	0x10ef
+	.uleb128 0x8
+	.long	.LASF1891
+	.value	0x1c6
+	.byte	0x3d
+	.long	0x488
+	.uleb128 0x8
+	.long	.LASF1639
+	.value	0x1c6
+	.byte	0x52
+	.long	0x238
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1893
+	.value	0x19a
+	.byte	0xd
+	.long	0x1146
+	.uleb128 0x8
+	.long	.LASF1888
+	.value	0x19a
+	.byte	0x2a
+	.long	0xc6
+	.uleb128 0xb
+	.long	.LASF1894
+	.value	0x19c
+	.byte	0x10
+	.long	0x4e3
+	.uleb128 0xb
+	.long	.LASF1895
+	.value	0x19e
+	.byte	0xd
+	.long	0x9f
+	.uleb128 0xb
+	.long	.LASF1896
+	.value	0x1b7
+	.byte	0xd
+	.long	0x9f
+	.uleb128 0xb
+	.long	.LASF1897
+	.value	0x1b8
+	.byte	0xd
+	.long	0x9f
+	.uleb128 0x2a
+	.uleb128 0xb
+	.long	.LASF1898
+	.value	0x1af
+	.byte	0xd
+	.long	0x4e3
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1899
+	.value	0x193
+	.byte	0xd
+	.uleb128 0xc
+	.long	.LASF1900
+	.value	0x16c
+	.byte	0xd
+	.long	0x1167
+	.uleb128 0x8
+	.long	.LASF1897
+	.value	0x16c
+	.byte	0x2e
+	.long	0x9f
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1901
+	.value	0x165
+	.byte	0xd
+	.uleb128 0x14
+	.long	.LASF1902
+	.value	0x160
+	.byte	0x14
+	.uleb128 0xc
+	.long	.LASF1903
+	.value	0x151
+	.byte	0xd
+	.long	0x119c
+	.uleb128 0x8
+	.long	.LASF1904
+	.value	0x151
+	.byte	0x27
+	.long	0xea
+	.uleb128 0x8
+	.long	.LASF1905
+	.value	0x151
+	.byte	0x33
+	.long	0x70
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1906
+	.value	0x142
+	.uleb128 0x18
+	.long	.LASF1907
+	.value	0x13a
+	.uleb128 0x18
+	.long	.LASF1908
+	.value	0x133
+	.uleb128 0xc
+	.long	.LASF1909
+	.value	0x12c
+	.byte	0xd
+	.long	0x11d5
+	.uleb128 0x2b
+	.string	"c"
+	.byte	0x11
+	.value	0x12c
+	.byte	0x25
+	.long	0x9f
+	.uleb128 0xb
+	.long	.LASF1910
+	.value	0x12e
+	.byte	0x14
+	.long	0x9f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1911
+	.value	0x11f
+	.long	0x11ed
+	.uleb128 0x8
+	.long	.LASF1869
+	.value	0x11f
+	.byte	0x2d
+	.long	0x11ed
+	.byte	0
+	.uleb128 0x6
+	.long	0xc29
+	.uleb128 0xc
+	.long	.LASF1912
+	.value	0x118
+	.byte	0x14
+	.long	0x120b
+	.uleb128 0x8
+	.long	.LASF1869
+	.value	0x118
+	.byte	0x3b
+	.long	0x11ed
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1913
+	.value	0x110
+	.byte	0x14
+	.long	0x1230
+	.uleb128 0x8
+	.long	.LASF1869
+	.value	0x110
+	.byte	0x3a
+	.long	0x11ed
+	.uleb128 0xb
+	.long	.LASF1914
+	.value	0x112
+	.byte	0x14
+	.long	0xc1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1915
+	.value	0x109
+	.byte	0x14
+	.long	0x1254
+	.uleb128 0x8
+	.long	.LASF1869
+	.value	0x109
+	.byte	0x46
+	.long	0x11ed
+	.uleb128 0x1e
+	.string	"mAh"
+	.value	0x10b
+	.long	0x93
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1916
+	.value	0x102
+	.byte	0x14
+	.long	0x1278
+	.uleb128 0x8
+	.long	.LASF1869
+	.value	0x102
+	.byte	0x3e
+	.long	0x11ed
+	.uleb128 0x1e
+	.string	"amp"
+	.value	0x104
+	.long	0x93
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1917
+	.byte	0xf8
+	.byte	0x14
+	.long	0x128f
+	.uleb128 0x1a
+	.long	.LASF1869
+	.byte	0xf8
+	.byte	0x39
+	.long	0x11ed
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1918
+	.byte	0xe6
+	.byte	0x14
+	.long	0x12b1
+	.uleb128 0x1a
+	.long	.LASF1869
+	.byte	0xe6
+	.byte	0x3d
+	.long	0x11ed
+	.uleb128 0x7
+	.long	.LASF1919
+	.byte	0xe8
+	.byte	0x14
+	.long	0x72d
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1923
+	.byte	0x11
+	.byte	0xe1
+	.byte	0xc
+	.long	0x4e3
+	.uleb128 0x2c
+	.long	.LASF1920
+	.byte	0x11
+	.byte	0x96
+	.byte	0xd
+	.uleb128 0x19
+	.long	.LASF1921
+	.byte	0x7b
+	.byte	0xd
+	.long	0x12e8
+	.uleb128 0x2d
+	.string	"msg"
+	.byte	0x11
+	.byte	0x7b
+	.byte	0x32
+	.long	0x11ed
+	.uleb128 0x1a
+	.long	.LASF1922
+	.byte	0x7b
+	.byte	0x3e
+	.long	0xd2
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1924
+	.byte	0xf
+	.byte	0x37
+	.byte	0x59
+	.long	0x12f4
+	.uleb128 0x6
+	.long	0x98d
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 44
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 20 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x16
+	.file 23 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 25 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 26 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 29 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 38 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 39 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x27
+	.file 40 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 41 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x29
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 42 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x2a
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.file 43 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 44 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 45 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF965
+	.byte	0x4
+	.file 46 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x2e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 47 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 48 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.file 49 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 50 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 51 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 52 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1481
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1482
+	.byte	0x4
+	.file 53 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0xa
+	.file 54 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1495
+	.byte	0x4
+	.file 55 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x37
+	.file 56 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x4
+	.file 57 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x39
+	.file 58 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1500
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1501
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 59 "./src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x3b
+	.byte	0x4
+	.file 60 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x57
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1521
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1554
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.20.3220b4b93816a5ed17d44e074a1f12c4,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF960
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF964
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF983
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1006
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1088
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1090
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1092
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1100
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1112
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1480
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1491
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1494
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1499
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1511
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1520
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.hott.h.30.6fdec6e013da278855497bec11610729,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1547
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF1927
+	.long	.LASF1928
+	.long	.LASF1929
+	.long	.LASF1930
+	.long	.LASF1931
+	.long	.LASF1932
+	.long	.LASF1933
+	.long	.LASF1934
+	.long	.LASF1935
+	.long	.LASF1936
+	.long	.LASF1937
+	.long	.LASF1938
+	.long	.LASF1939
+	.long	.LASF1940
+	.long	.LASF1941
+	.long	.LASF1942
+	.long	.LASF1943
+	.long	.LASF1944
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1945
+	.byte	0xe
+	.long	.LASF1946
+	.byte	0xe
+	.long	.LASF1947
+	.byte	0xe
+	.long	.LASF1948
+	.byte	0x12
+	.long	.LASF1949
+	.byte	0x2
+	.long	.LASF1950
+	.byte	0x4
+	.long	.LASF1951
+	.byte	0x4
+	.long	.LASF1950
+	.byte	0x7
+	.long	.LASF1952
+	.byte	0x8
+	.long	.LASF1953
+	.byte	0x8
+	.long	.LASF1954
+	.byte	0x4
+	.long	.LASF1954
+	.byte	0x8
+	.long	.LASF1955
+	.byte	0x6
+	.long	.LASF1956
+	.byte	0x6
+	.long	.LASF1957
+	.byte	0xb
+	.long	.LASF1958
+	.byte	0xb
+	.long	.LASF1959
+	.byte	0xb
+	.long	.LASF1960
+	.byte	0x11
+	.long	.LASF1961
+	.byte	0x4
+	.long	.LASF1962
+	.byte	0x11
+	.long	.LASF1963
+	.byte	0x12
+	.long	.LASF1964
+	.byte	0x12
+	.long	.LASF1964
+	.byte	0x11
+	.long	.LASF1965
+	.byte	0xe
+	.long	.LASF1966
+	.byte	0x11
+	.long	.LASF1967
+	.byte	0x11
+	.long	.LASF1968
+	.byte	0xe
+	.long	.LASF1969
+	.byte	0xe
+	.long	.LASF1970
+	.byte	0x10
+	.long	.LASF1971
+	.byte	0xe
+	.long	.LASF1972
+	.byte	0xf
+	.long	.LASF1973
+	.byte	0xf
+	.long	.LASF1974
+	.byte	0xe
+	.long	.LASF1975
+	.byte	0xe
+	.long	.LASF1976
+	.byte	0xe
+	.long	.LASF1977
+	.byte	0xd
+	.long	.LASF1978
+	.byte	0xd
+	.long	.LASF1979
+	.byte	0x11
+	.long	.LASF1980
+	.byte	0xc
+	.long	.LASF1981
+	.byte	0xa
+	.long	.LASF1982
+	.byte	0x9
+	.long	.LASF1983
+	.byte	0xa
+	.long	.LASF1984
+	.byte	0x1
+	.long	.LASF1985
+	.byte	0x1
+	.long	.LASF1986
+	.byte	0x2
+	.long	.LASF1987
+	.byte	0x2
+	.long	.LASF1988
+	.byte	0x3
+	.long	.LASF1989
+	.byte	0x3
+	.long	.LASF1990
+	.byte	0x4
+	.long	.LASF1991
+	.byte	0x4
+	.long	.LASF1992
+	.byte	0x4
+	.long	.LASF1993
+	.byte	0x4
+	.long	.LASF1994
+	.byte	0x5
+	.long	.LASF1995
+	.byte	0x2
+	.long	.LASF1996
+	.byte	0x8
+	.long	.LASF1997
+	.byte	0x8
+	.long	.LASF1998
+	.byte	0x8
+	.long	.LASF1999
+	.byte	0x8
+	.long	.LASF2000
+	.byte	0x6
+	.long	.LASF2001
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1472:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1310:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1108:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1191:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1202:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1134:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1734:
+	.string	"PIDPITCH"
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1086:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1228:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1729:
+	.string	"baro_s"
+.LASF1732:
+	.string	"baro_t"
+.LASF1795:
+	.string	"cell6_H"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF1788:
+	.string	"cell6_L"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_PPM"
+.LASF1246:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1660:
+	.string	"setMode"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1476:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1375:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1776:
+	.string	"HOTT_EAM_MSG_s"
+.LASF1821:
+	.string	"HOTT_EAM_MSG_t"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF1551:
+	.string	"MILLISECONDS_IN_A_SECOND 1000"
+.LASF984:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1114:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1561:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1637:
+	.string	"vTable"
+.LASF1570:
+	.string	"uint32_t"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1376:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1667:
+	.string	"_Bool"
+.LASF1529:
+	.string	"HOTTV4_BUTTON_NEXT 0xEE"
+.LASF1806:
+	.string	"current_H"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF1166:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1805:
+	.string	"current_L"
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1093:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1581:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1463:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1336:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1328:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1436:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1733:
+	.string	"PIDROLL"
+.LASF1263:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1097:
+	.string	"IOCFG_AF_OD 0"
+.LASF990:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF1625:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1165:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1115:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1399:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1541:
+	.string	"HOTT_TELEMETRY_AIRESC_SENSOR_ID 0x8c"
+.LASF1345:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF1006:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1675:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1486:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1104:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF1468:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1899:
+	.string	"flushHottRxBuffer"
+.LASF1839:
+	.string	"gps_satelites"
+.LASF1044:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF1740:
+	.string	"PIDLEVEL"
+.LASF1687:
+	.string	"SERIAL_PORT_NONE"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1723:
+	.string	"start_ut"
+.LASF1829:
+	.string	"pos_NS_dm_H"
+.LASF1178:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1415:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1828:
+	.string	"pos_NS_dm_L"
+.LASF1578:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1475:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1600:
+	.string	"OWNER_FLASH"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1569:
+	.string	"uint16_t"
+.LASF1168:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1478:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1029:
+	.string	"PG_RX_CONFIG 24"
+.LASF1682:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF1849:
+	.string	"msl_altitude_L"
+.LASF1407:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1298:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1386:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF1305:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF996:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1905:
+	.string	"length"
+.LASF1132:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1205:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1175:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF1101:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF1413:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1896:
+	.string	"requestId"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1288:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1350:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1040:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1547:
+	.string	"HOTT_VARIO_MSG_TEXT_LEN 21"
+.LASF1254:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1834:
+	.string	"pos_EW_dm_H"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1833:
+	.string	"pos_EW_dm_L"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1241:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF979:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1324:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1082:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1319:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1871:
+	.string	"serialRxBytesWaiting"
+.LASF1373:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1742:
+	.string	"PIDVEL"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1291:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1048:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF1439:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1545:
+	.string	"HOTT_GPS_SENSOR_TEXT_ID 0xA0"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1395:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1769:
+	.string	"HOTT_EAM_ALARM1_FLAG_BATTERY_1"
+.LASF1770:
+	.string	"HOTT_EAM_ALARM1_FLAG_BATTERY_2"
+.LASF1585:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1677:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1135:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1100:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF987:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF976:
+	.string	"BIT(x) (1 << (x))"
+.LASF1610:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF989:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1143:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1796:
+	.string	"cell7_H"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1789:
+	.string	"cell7_L"
+.LASF957:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1567:
+	.string	"int32_t"
+.LASF1701:
+	.string	"functionMask"
+.LASF1294:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1418:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF883:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1662:
+	.string	"beginWrite"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1453:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF1443:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1389:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1502:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1782:
+	.string	"alarm_invers2"
+.LASF1210:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1852:
+	.string	"free_char1"
+.LASF1853:
+	.string	"free_char2"
+.LASF1854:
+	.string	"free_char3"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF1526:
+	.string	"HOTTV4_BUTTON_INC 0xED"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1607:
+	.string	"OWNER_BARO_EXTI"
+.LASF1025:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF546:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1620:
+	.string	"MODE_RX"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF898:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1183:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1226:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1584:
+	.string	"OWNER_SERIAL_TX"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF972:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1045:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1058:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1815:
+	.string	"rpm_H"
+.LASF1814:
+	.string	"rpm_L"
+.LASF1213:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1665:
+	.string	"setRxFrameCallback"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1206:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1329:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1565:
+	.string	"long int"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1670:
+	.string	"PORTSHARING_SHARED"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1369:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1843:
+	.string	"angle_nick"
+.LASF1741:
+	.string	"PIDMAG"
+.LASF1442:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1608:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1076:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF402:
+	.string	"false 0"
+.LASF1619:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1527:
+	.string	"HOTTV4_BUTTON_SET 0xE9"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1382:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1286:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1621:
+	.string	"MODE_TX"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1515:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1000:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1773:
+	.string	"HOTT_EAM_ALARM1_FLAG_ALTITUDE"
+.LASF1484:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1552:
+	.string	"HOTT_CRC_SIZE (sizeof(hottMsgCrc))"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1861:
+	.string	"hottMsg"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1224:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1820:
+	.string	"stop_byte"
+.LASF1780:
+	.string	"sensor_id"
+.LASF1351:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1779:
+	.string	"warning_beeps"
+.LASF1650:
+	.string	"rxCallback"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1534:
+	.string	"HOTT_EAM_OFFSET_TEMPERATURE 20"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1158:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1736:
+	.string	"PIDALT"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1548:
+	.string	"HOTT_MESSAGE_PREPARATION_FREQUENCY_5_HZ ((1000 * 1000) / 5)"
+.LASF1289:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1817:
+	.string	"electric_sec"
+.LASF1589:
+	.string	"OWNER_SONAR_ECHO"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1392:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1262:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1037:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1080:
+	.string	"PG_VTX_CONFIG 515"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1577:
+	.string	"OWNER_SERVO"
+.LASF978:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF881:
+	.string	"ACC "
+.LASF1738:
+	.string	"PIDPOSR"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF803:
+	.string	"USE_PWM "
+.LASF1422:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1532:
+	.string	"HOTT_EAM_OFFSET_M2S 72"
+.LASF1487:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1218:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1312:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF986:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1460:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1322:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF994:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1141:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1208:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1367:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1562:
+	.string	"__uint16_t"
+.LASF1642:
+	.string	"rxBufferSize"
+.LASF1576:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1225:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1680:
+	.string	"FUNCTION_BLACKBOX"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1604:
+	.string	"OWNER_RX_SPI_CS"
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1258:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1753:
+	.string	"gpsNoFixLatitude"
+.LASF1113:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1209:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1648:
+	.string	"txBufferHead"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1639:
+	.string	"mode"
+.LASF1144:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1867:
+	.string	"hottPortSharing"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF1435:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1748:
+	.string	"frskyGpsCoordFormat_e"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1813:
+	.string	"climbrate3s"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1831:
+	.string	"pos_NS_sec_H"
+.LASF1771:
+	.string	"HOTT_EAM_ALARM1_FLAG_TEMPERATURE_1"
+.LASF1772:
+	.string	"HOTT_EAM_ALARM1_FLAG_TEMPERATURE_2"
+.LASF1830:
+	.string	"pos_NS_sec_L"
+.LASF961:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1250:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1762:
+	.string	"hottAlarmSoundInterval"
+.LASF1261:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1106:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1081:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1190:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1910:
+	.string	"serialWrites"
+.LASF1676:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1555:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1087:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1092:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF988:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF1064:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1455:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1326:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1038:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1341:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF1543:
+	.string	"HOTT_TELEMETRY_EAM_SENSOR_ID 0x8e"
+.LASF1021:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1068:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1712:
+	.string	"float"
+.LASF1638:
+	.string	"identifier"
+.LASF1174:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1777:
+	.string	"start_byte"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1016:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF992:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1432:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1414:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1230:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1661:
+	.string	"writeBuf"
+.LASF879:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1071:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1903:
+	.string	"hottSendResponse"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1862:
+	.string	"hottMsgRemainingBytesToSendCount"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1717:
+	.string	"batteryState_e"
+.LASF1095:
+	.string	"IOCFG_OUT_OD 0"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1182:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1877:
+	.string	"closeSerialPort"
+.LASF1663:
+	.string	"endWrite"
+.LASF1672:
+	.string	"FUNCTION_NONE"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF962:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1187:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1355:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1105:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1448:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1616:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1417:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1488:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1388:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1248:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1898:
+	.string	"enoughTimePassed"
+.LASF1023:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1275:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1498:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF1550:
+	.string	"HOTT_TX_DELAY_US 3000"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1253:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1342:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1321:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1869:
+	.string	"hottEAMMessage"
+.LASF1598:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF1438:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1384:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1227:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1099:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1890:
+	.string	"hottSendTelemetryData"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1303:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF382:
+	.string	"unix 1"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1137:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1364:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1189:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1256:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1337:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1767:
+	.string	"HOTT_EAM_ALARM1_FLAG_NONE"
+.LASF960:
+	.string	"TIME_SECTION_END(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1658:
+	.string	"serialSetBaudRate"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1332:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1458:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1387:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1043:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF1750:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1470:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1053:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1765:
+	.string	"telemetryConfig_t"
+.LASF1703:
+	.string	"gps_baudrateIndex"
+.LASF1078:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1429:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1735:
+	.string	"PIDYAW"
+.LASF1644:
+	.string	"rxBuffer"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1643:
+	.string	"txBufferSize"
+.LASF1781:
+	.string	"alarm_invers1"
+.LASF1629:
+	.string	"SERIAL_PARITY_NO"
+.LASF1902:
+	.string	"hottSendEAMResponse"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1223:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1848:
+	.string	"gps_time_sss"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1609:
+	.string	"OWNER_USB_DETECT"
+.LASF1427:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1309:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1451:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1090:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1922:
+	.string	"size"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1709:
+	.string	"SENSOR_INDEX_BARO"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1063:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1894:
+	.string	"lookingForRequest"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1835:
+	.string	"pos_EW_sec_L"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1841:
+	.string	"home_direction"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1219:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1761:
+	.string	"frsky_vfas_cell_voltage"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1278:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1730:
+	.string	"BaroAlt"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1764:
+	.string	"report_cell_voltage"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1283:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1462:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1147:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1921:
+	.string	"initialiseEAMMessage"
+.LASF1613:
+	.string	"OWNER_INVERTER"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF1571:
+	.string	"size_t"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1287:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1918:
+	.string	"updateAlarmBatteryStatus"
+.LASF1593:
+	.string	"OWNER_SPI_MOSI"
+.LASF1238:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1441:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1568:
+	.string	"uint8_t"
+.LASF1188:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1186:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1749:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1244:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1763:
+	.string	"pidValuesAsTelemetry"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1430:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF1290:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF974:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1919:
+	.string	"batteryState"
+.LASF1710:
+	.string	"SENSOR_INDEX_MAG"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF1057:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1293:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1091:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF1760:
+	.string	"frsky_vfas_precision"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1883:
+	.string	"serialTimer"
+.LASF1085:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1380:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1851:
+	.string	"vibration"
+.LASF1299:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1906:
+	.string	"configureHoTTTelemetryPort"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1185:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1434:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF1689:
+	.string	"SERIAL_PORT_USART2"
+.LASF1301:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF1204:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF822:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1865:
+	.string	"portConfig"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1107:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1691:
+	.string	"SERIAL_PORT_UART4"
+.LASF1692:
+	.string	"SERIAL_PORT_UART5"
+.LASF1686:
+	.string	"serialPortFunction_e"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF1544:
+	.string	"HOTT_EAM_SENSOR_TEXT_ID 0xE0"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF949:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1454:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1041:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF1397:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1138:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1506:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1394:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1895:
+	.string	"bytesWaiting"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1237:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1731:
+	.string	"baroTemperature"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF1494:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1334:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1685:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1031:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF1005:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1900:
+	.string	"processBinaryModeRequest"
+.LASF995:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1153:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1726:
+	.string	"get_up"
+.LASF1539:
+	.string	"HOTT_TELEMETRY_VARIO_SENSOR_ID 0x89"
+.LASF1549:
+	.string	"HOTT_RX_SCHEDULE 4000"
+.LASF1724:
+	.string	"get_ut"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1860:
+	.string	"hottIsSending"
+.LASF1646:
+	.string	"rxBufferHead"
+.LASF1747:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1222:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1719:
+	.string	"baroCalculateFuncPtr"
+.LASF1891:
+	.string	"instance"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1528:
+	.string	"HOTTV4_BUTTON_NIL 0x0F"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF1390:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1079:
+	.string	"PG_VCD_CONFIG 514"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF1371:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1538:
+	.string	"HOTT_TELEMETRY_NO_SENSOR_ID 0x80"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1075:
+	.string	"PG_ADC_CONFIG 510"
+.LASF1353:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1811:
+	.string	"climbrate_L"
+.LASF1416:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1172:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1156:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1247:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1282:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF1111:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1358:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1077:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1419:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1588:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1540:
+	.string	"HOTT_TELEMETRY_GPS_SENSOR_ID 0x8a"
+.LASF1683:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1897:
+	.string	"address"
+.LASF1410:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1356:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1260:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1678:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1325:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1917:
+	.string	"hottEAMUpdateBattery"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1159:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1836:
+	.string	"pos_EW_sec_H"
+.LASF1521:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF1004:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1192:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1302:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1503:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1766:
+	.string	"telemetryConfig_System"
+.LASF1281:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1464:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"__size_t "
+.LASF1590:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF993:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1824:
+	.string	"flight_direction"
+.LASF499:
+	.string	"__PMT"
+.LASF1704:
+	.string	"blackbox_baudrateIndex"
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1755:
+	.string	"telemetry_switch"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1705:
+	.string	"telemetry_baudrateIndex"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1109:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1308:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1445:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1055:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1673:
+	.string	"FUNCTION_MSP"
+.LASF1669:
+	.string	"PORTSHARING_NOT_SHARED"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1340:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1491:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1259:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1926:
+	.string	"shouldPrepareHoTTMessages"
+.LASF1273:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1845:
+	.string	"gps_time_h"
+.LASF1013:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1846:
+	.string	"gps_time_m"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1314:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1847:
+	.string	"gps_time_s"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1148:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1495:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1257:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1826:
+	.string	"gps_speed_H"
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF1522:
+	.string	"HOTTV4_RXTX 4"
+.LASF1012:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1752:
+	.string	"telemetryConfig_s"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1716:
+	.string	"BATTERY_NOT_PRESENT"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1339:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1915:
+	.string	"hottEAMUpdateBatteryDrawnCapacity"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF1266:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1118:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1318:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1925:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF991:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1151:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1511:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1874:
+	.string	"memset"
+.LASF1139:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1285:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1117:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1428:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1507:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1756:
+	.string	"telemetry_inversion"
+.LASF1768:
+	.string	"HOTT_EAM_ALARM1_FLAG_MAH"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1249:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1201:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1520:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1359:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1493:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF1708:
+	.string	"SENSOR_INDEX_ACC"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1007:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1401:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1154:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1333:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1149:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF802:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1130:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1622:
+	.string	"MODE_RXTX"
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1775:
+	.string	"HOTT_EAM_ALARM1_FLAG_MAIN_VOLTAGE"
+.LASF1304:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1714:
+	.string	"BATTERY_WARNING"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1030:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1542:
+	.string	"HOTT_TELEMETRY_GAM_SENSOR_ID 0x8d"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1485:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF1014:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF1215:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF967:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1596:
+	.string	"OWNER_SDCARD"
+.LASF1220:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1790:
+	.string	"cell1_H"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1783:
+	.string	"cell1_L"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1459:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1054:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF958:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1533:
+	.string	"HOTT_EAM_OFFSET_M3S 120"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1157:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1306:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1556:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1267:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1559:
+	.string	"signed char"
+.LASF1235:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF985:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1207:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF766:
+	.string	"__size_t__ "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF1524:
+	.string	"HOTTV4_BINARY_MODE_REQUEST_ID 0x80"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1170:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1456:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF1424:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1150:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1280:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1022:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1051:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1061:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1626:
+	.string	"SERIAL_INVERTED"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1924:
+	.string	"telemetryConfig"
+.LASF1365:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1284:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1483:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1383:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF1512:
+	.string	"LAT 0"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1116:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1231:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1121:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1697:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1698:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1362:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1618:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1034:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1640:
+	.string	"options"
+.LASF1196:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1679:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1403:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1873:
+	.string	"openSerialPort"
+.LASF1816:
+	.string	"electric_min"
+.LASF1084:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1611:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1343:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1374:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1457:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1020:
+	.string	"PG_PID_PROFILE 14"
+.LASF1423:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1039:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1176:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1089:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1072:
+	.string	"PG_PPM_CONFIG 507"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1155:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1125:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1489:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1296:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1162:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1879:
+	.string	"getAmperage"
+.LASF1850:
+	.string	"msl_altitude_H"
+.LASF1199:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1140:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF981:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1510:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF963:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1036:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1827:
+	.string	"pos_NS"
+.LASF1863:
+	.string	"hottMsgCrc"
+.LASF1727:
+	.string	"calculate"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF1632:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1923:
+	.string	"shouldTriggerBatteryAlarmNow"
+.LASF1131:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1696:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF929:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1331:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1500:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1001:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF821:
+	.string	"GPS "
+.LASF1501:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1317:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1316:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1688:
+	.string	"SERIAL_PORT_USART1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1690:
+	.string	"SERIAL_PORT_USART3"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF1173:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1693:
+	.string	"SERIAL_PORT_USART6"
+.LASF1694:
+	.string	"SERIAL_PORT_USART7"
+.LASF1695:
+	.string	"SERIAL_PORT_USART8"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1655:
+	.string	"serialTotalRxWaiting"
+.LASF1112:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1033:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1405:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1234:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1026:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1200:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1509:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1252:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1586:
+	.string	"OWNER_PINDEBUG"
+.LASF1179:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1887:
+	.string	"currentTimeUs"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1446:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1758:
+	.string	"frsky_coordinate_format"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1519:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF1251:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1713:
+	.string	"BATTERY_OK"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1791:
+	.string	"cell2_H"
+.LASF1784:
+	.string	"cell2_L"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1279:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1017:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1718:
+	.string	"baroOpFuncPtr"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF973:
+	.string	"EXPAND_I(x) x"
+.LASF1255:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1838:
+	.string	"home_distance_H"
+.LASF1346:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1837:
+	.string	"home_distance_L"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1212:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1636:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1647:
+	.string	"rxBufferTail"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1177:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1523:
+	.string	"HOTTV4_TEXT_MODE_REQUEST_ID 0x7f"
+.LASF1379:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1881:
+	.string	"millis"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1052:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1659:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1069:
+	.string	"PG_PID_CONFIG 504"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1525:
+	.string	"HOTTV4_BUTTON_DEC 0xEB"
+.LASF522:
+	.string	"__flexarr []"
+.LASF813:
+	.string	"LED_STRIP "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1911:
+	.string	"hottPrepareEAMResponse"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1049:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1003:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1009:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1195:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1270:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1587:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1050:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1181:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1378:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1531:
+	.string	"HOTT_EAM_OFFSET_HEIGHT 500"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1408:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1354:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF1122:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1566:
+	.string	"char"
+.LASF1737:
+	.string	"PIDPOS"
+.LASF1793:
+	.string	"cell4_H"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1858:
+	.string	"lastMessagesPreparedAt"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1786:
+	.string	"cell4_L"
+.LASF1808:
+	.string	"main_voltage_H"
+.LASF1807:
+	.string	"main_voltage_L"
+.LASF1888:
+	.string	"currentMicros"
+.LASF1335:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1096:
+	.string	"IOCFG_AF_PP 0"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1184:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1315:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF888:
+	.string	"USE_UART2 "
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1409:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1088:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1866:
+	.string	"hottTelemetryEnabled"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1008:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1323:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF969:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1297:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1349:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1901:
+	.string	"hottPrepareMessages"
+.LASF1754:
+	.string	"gpsNoFixLongitude"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1471:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF965:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF1909:
+	.string	"hottSerialWrite"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1800:
+	.string	"batt2_voltage_H"
+.LASF765:
+	.string	"__need_NULL "
+.LASF970:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1799:
+	.string	"batt2_voltage_L"
+.LASF1630:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF959:
+	.string	"TIME_SECTION_BEGIN(index) { extern uint32_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1042:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1825:
+	.string	"gps_speed_L"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1300:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF1479:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1599:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF971:
+	.string	"STR_HELPER(x) #x"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1047:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1591:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1216:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1823:
+	.string	"gps_sensor_id"
+.LASF1583:
+	.string	"OWNER_ADC_RSSI"
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1377:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1792:
+	.string	"cell3_H"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF1785:
+	.string	"cell3_L"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1490:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1194:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1232:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF1002:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1169:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1492:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1801:
+	.string	"temp1"
+.LASF1802:
+	.string	"temp2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF1904:
+	.string	"buffer"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1357:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1864:
+	.string	"hottPort"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1320:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1236:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1083:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1668:
+	.string	"PORTSHARING_UNUSED"
+.LASF1700:
+	.string	"serialPortConfig_s"
+.LASF1706:
+	.string	"serialPortConfig_t"
+.LASF1277:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1452:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1398:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1136:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1385:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1313:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1474:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1628:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1536:
+	.string	"HOTT_TEXT_MODE_REQUEST_ID 0x7f"
+.LASF1271:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1913:
+	.string	"hottEAMUpdateAltitude"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1431:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1180:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1649:
+	.string	"txBufferTail"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF975:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1171:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1060:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF997:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1721:
+	.string	"ut_delay"
+.LASF1292:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1870:
+	.string	"serialSetMode"
+.LASF1062:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1889:
+	.string	"shouldCheckForHoTTRequest"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF998:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1554:
+	.string	"HOTT_INITIAL_PORT_MODE MODE_RX"
+.LASF1070:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1535:
+	.string	"HOTT_GPS_ALTITUDE_OFFSET 500"
+.LASF1368:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1728:
+	.string	"baroDev_t"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1746:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF1508:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1594:
+	.string	"OWNER_I2C_SCL"
+.LASF1592:
+	.string	"OWNER_SPI_MISO"
+.LASF1129:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1595:
+	.string	"OWNER_I2C_SDA"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1617:
+	.string	"OWNER_COMPASS_CS"
+.LASF980:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1152:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1402:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1010:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1366:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1878:
+	.string	"getMAhDrawn"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1233:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1295:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1420:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1268:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1563:
+	.string	"__int32_t"
+.LASF1272:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1631:
+	.string	"SERIAL_UNIDIR"
+.LASF1564:
+	.string	"__uint32_t"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1211:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1381:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1027:
+	.string	"PG_IMU_CONFIG 22"
+.LASF801:
+	.string	"USE_CLI "
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1426:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1912:
+	.string	"hottEAMUpdateClimbrate"
+.LASF1307:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1744:
+	.string	"baro"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF1641:
+	.string	"baudRate"
+.LASF1461:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1056:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1035:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1699:
+	.string	"serialPortIdentifier_e"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1098:
+	.string	"IOCFG_IPD 0"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1360:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF968:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1537:
+	.string	"HOTT_BINARY_MODE_REQUEST_ID 0x80"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1702:
+	.string	"msp_baudrateIndex"
+.LASF1892:
+	.string	"workAroundForHottTelemetryOnUsart"
+.LASF1645:
+	.string	"txBuffer"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF1391:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1372:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1214:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1497:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF1239:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF1110:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1128:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1477:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1146:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1751:
+	.string	"frskyUnit_e"
+.LASF1880:
+	.string	"getBatteryState"
+.LASF1347:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1725:
+	.string	"start_up"
+.LASF1842:
+	.string	"angle_roll"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1123:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1745:
+	.string	"vario"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1032:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1804:
+	.string	"altitude_H"
+.LASF1164:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1803:
+	.string	"altitude_L"
+.LASF1264:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1330:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1612:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF1875:
+	.string	"determinePortSharing"
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1615:
+	.string	"OWNER_TRANSPONDER"
+.LASF1028:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF1778:
+	.string	"eam_sensor_id"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1352:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1217:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF1338:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1553:
+	.string	"HOTT_BAUDRATE 19200"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1653:
+	.string	"serialPortVTable"
+.LASF1276:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1715:
+	.string	"BATTERY_CRITICAL"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1627:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1674:
+	.string	"FUNCTION_GPS"
+.LASF1163:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1623:
+	.string	"portMode_t"
+.LASF1133:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF977:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1572:
+	.string	"timeUs_t"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF1720:
+	.string	"baroDev_s"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1504:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1681:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1602:
+	.string	"OWNER_MPU_CS"
+.LASF1605:
+	.string	"OWNER_SPI_CS"
+.LASF1074:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1167:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1884:
+	.string	"handleHoTTTelemetry"
+.LASF1425:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1671:
+	.string	"portSharing_e"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1513:
+	.string	"LON 1"
+.LASF1885:
+	.string	"checkHoTTTelemetryState"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF885:
+	.string	"MAG "
+.LASF1920:
+	.string	"initialiseMessages"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1363:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF982:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1024:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF1857:
+	.string	"lastHoTTRequestCheckAt"
+.LASF1774:
+	.string	"HOTT_EAM_ALARM1_FLAG_CURRENT"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1635:
+	.string	"serialReceiveCallbackPtr"
+.LASF1444:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1759:
+	.string	"frsky_unit"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1011:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1844:
+	.string	"angle_compass"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF983:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF956:
+	.string	"DEBUG16_VALUE_COUNT 4"
+.LASF1067:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1580:
+	.string	"OWNER_ADC_BATT"
+.LASF1573:
+	.string	"OWNER_FREE"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1657:
+	.string	"serialRead"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1059:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1664:
+	.string	"readBuf"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1142:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF964:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1404:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1127:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1161:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1652:
+	.string	"serialPort_s"
+.LASF1666:
+	.string	"serialPort_t"
+.LASF1574:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1245:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1832:
+	.string	"pos_EW"
+.LASF1466:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1499:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF1656:
+	.string	"serialTotalTxFree"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1327:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1634:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1546:
+	.string	"HOTT_TEXTMODE_MSG_TEXT_LEN 168"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1145:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1819:
+	.string	"speed_H"
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF1818:
+	.string	"speed_L"
+.LASF1859:
+	.string	"lastHottAlarmSoundTime"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1465:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1119:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1496:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1876:
+	.string	"findSerialPortConfig"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1449:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1221:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1872:
+	.string	"telemetryDetermineEnabledState"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1094:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1624:
+	.string	"portOptions_t"
+.LASF1893:
+	.string	"hottCheckSerialData"
+.LASF1015:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1597:
+	.string	"OWNER_SDCARD_CS"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1160:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1722:
+	.string	"up_delay"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1518:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF1370:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1126:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1124:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1467:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1517:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1794:
+	.string	"cell5_H"
+.LASF1447:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1787:
+	.string	"cell5_L"
+.LASF1393:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1242:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1651:
+	.string	"rxFrameCallback"
+.LASF1739:
+	.string	"PIDNAVR"
+.LASF1198:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1265:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF1916:
+	.string	"hottEAMUpdateCurrentMeter"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1505:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1344:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1684:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1229:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF1516:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1558:
+	.string	"long unsigned int"
+.LASF1102:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1614:
+	.string	"OWNER_LED_STRIP"
+.LASF1361:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF966:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF1907:
+	.string	"initHoTTTelemetry"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1514:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1743:
+	.string	"PID_ITEM_COUNT"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1812:
+	.string	"climbrate_H"
+.LASF1469:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1711:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1019:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1654:
+	.string	"serialWrite"
+.LASF1046:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1757:
+	.string	"sportHalfDuplex"
+.LASF1274:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF1882:
+	.string	"getBatteryVoltage"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1886:
+	.string	"newTelemetryEnabledValue"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1120:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1822:
+	.string	"HOTT_GPS_MSG_s"
+.LASF1856:
+	.string	"HOTT_GPS_MSG_t"
+.LASF1530:
+	.string	"HOTTV4_BUTTON_PREV 0xE7"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1103:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1868:
+	.string	"hottGPSMessage"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1798:
+	.string	"batt1_voltage_H"
+.LASF1601:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1855:
+	.string	"version"
+.LASF1797:
+	.string	"batt1_voltage_L"
+.LASF1065:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1203:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1557:
+	.string	"unsigned int"
+.LASF1707:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF1311:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1473:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1810:
+	.string	"batt_cap_H"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1809:
+	.string	"batt_cap_L"
+.LASF1411:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1197:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1633:
+	.string	"SERIAL_BIDIR_OD"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1073:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1348:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1579:
+	.string	"OWNER_ADC"
+.LASF1560:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1606:
+	.string	"OWNER_MPU_EXTI"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1433:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1481:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1240:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1450:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1396:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1018:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1840:
+	.string	"gps_fix_char"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1482:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1582:
+	.string	"OWNER_ADC_EXT"
+.LASF1066:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1193:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF1575:
+	.string	"OWNER_PPMINPUT"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1603:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1437:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF999:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1914:
+	.string	"hottEamAltitude"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1908:
+	.string	"freeHoTTTelemetryPort"
+.LASF1440:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1480:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1243:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1991:
+	.string	"io_types.h"
+.LASF1967:
+	.string	"features-time64.h"
+.LASF1971:
+	.string	"long-double.h"
+.LASF1978:
+	.string	"__locale_t.h"
+.LASF1980:
+	.string	"platform.h"
+.LASF1930:
+	.string	"src/main/drivers"
+.LASF1953:
+	.string	"battery.h"
+.LASF1965:
+	.string	"libc-header-start.h"
+.LASF1970:
+	.string	"cdefs.h"
+.LASF1942:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1956:
+	.string	"altitudehold.h"
+.LASF1946:
+	.string	"stdint-intn.h"
+.LASF1982:
+	.string	"target.h"
+.LASF1986:
+	.string	"axis.h"
+.LASF1941:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1944:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1972:
+	.string	"stubs.h"
+.LASF1976:
+	.string	"wchar.h"
+.LASF1990:
+	.string	"io.h"
+.LASF1935:
+	.string	"src/main/target/SITL"
+.LASF1933:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1955:
+	.string	"pid.h"
+.LASF1940:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1999:
+	.string	"voltage_ids.h"
+.LASF1979:
+	.string	"strings.h"
+.LASF1957:
+	.string	"telemetry.h"
+.LASF1945:
+	.string	"types.h"
+.LASF1961:
+	.string	"system.h"
+.LASF1969:
+	.string	"timesize.h"
+.LASF1963:
+	.string	"stdbool.h"
+.LASF1943:
+	.string	"/usr/include"
+.LASF1998:
+	.string	"voltage.h"
+.LASF1927:
+	.string	"src/main/build"
+.LASF1966:
+	.string	"features.h"
+.LASF1932:
+	.string	"src/main/flight"
+.LASF1974:
+	.string	"typesizes.h"
+.LASF1958:
+	.string	"hott.h"
+.LASF1950:
+	.string	"serial.h"
+.LASF1929:
+	.string	"src/main/config"
+.LASF1952:
+	.string	"sensors.h"
+.LASF1975:
+	.string	"time64.h"
+.LASF1947:
+	.string	"stdint-uintn.h"
+.LASF1936:
+	.string	"src/main/target"
+.LASF1987:
+	.string	"utils.h"
+.LASF2001:
+	.string	"gps.h"
+.LASF1938:
+	.string	"src/main"
+.LASF1954:
+	.string	"barometer.h"
+.LASF1934:
+	.string	"src/main/sensors"
+.LASF1996:
+	.string	"current.h"
+.LASF1951:
+	.string	"resource.h"
+.LASF1949:
+	.string	"time.h"
+.LASF1989:
+	.string	"parameter_group_ids.h"
+.LASF2000:
+	.string	"navigation.h"
+.LASF1985:
+	.string	"debug.h"
+.LASF1937:
+	.string	"src/main/telemetry"
+.LASF1994:
+	.string	"runtime_config.h"
+.LASF1992:
+	.string	"io_def.h"
+.LASF1931:
+	.string	"src/main/fc"
+.LASF1981:
+	.string	"common.h"
+.LASF1928:
+	.string	"src/main/common"
+.LASF1960:
+	.string	"string.h"
+.LASF1939:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1977:
+	.string	"locale_t.h"
+.LASF1964:
+	.string	"stdint.h"
+.LASF1984:
+	.string	"build_config.h"
+.LASF1948:
+	.string	"stddef.h"
+.LASF1973:
+	.string	"stubs-64.h"
+.LASF1968:
+	.string	"wordsize.h"
+.LASF1959:
+	.string	"hott.c"
+.LASF1993:
+	.string	"io_def_generated.h"
+.LASF1983:
+	.string	"common_post.h"
+.LASF0:
+	.string	"./src/main/telemetry/hott.c"
+.LASF1988:
+	.string	"parameter_group.h"
+.LASF1997:
+	.string	"current_ids.h"
+.LASF1962:
+	.string	"stdc-predef.h"
+.LASF1995:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`E\001\365\t"
+	.string	"t\f9\002"
+	.string	"\035"
+	.string	"\211\201\356%\016\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\001\352\263\360\321\b\003\205\375\221\362\004\b\004\277\267\235\311\b\006\002\004\002\004\002\001\002\005\005\006\262\346\207\376\004\007\204\357\326\226\t\030\006\007\002\007\002\001\002\001\b\242\302\263\302\013\t\n\013\f\240\342\234\212\n\r\016\331\351\230\305\0068\b\002\b\002\t\002\n\001\013\002\013\004\002\004\017\020\021\022\316\360\265\355\b\023\024\212\356\204\207\t"
+	.string	"\002"
+	.string	"\025\026\220\344\264\326\004\032\f\002\r\f\002\f\001\002\003\031\307\354\376\303\t\032\215\343\266\351\003\f\016\002\016\002\001\002\017\033\034\211\373\247\364\017\006\002\006\035\366\271\244\326\006\004\006\002\006\036\215\211\331\313\r\n\007\002\007\037\352\263\360\321\b"
+	.string	"5 P\202RG\326\001\267"
+	.string	"jd\264\253a\202"
+	.string	"8\020+\033\302]l\310m\r\3749\2732*3P"
+	.string	",\241\tp\t\276-N{\227\273\362\354\356\215\031,\362\240\230\003H\250\231\f`4\200\304\3010\200\227\005\013\013\222\273\322\332h*\3633\267\313\205\255vz[\200%\030\002\036p\004\334\t\320\362\202\232\225"
+	.ascii	"]\324\364]\253\325\255\225\305\375\341\354\234k\001\334"
+	.text
+	.section	.gnu.lto_.ipa_sra.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375 \3075\003"
+	.string	"\324\002\273"
+	.string	"\016"
+	.string	"\001\001"
+	.string	""
+	.string	"\003\001\001\001\200\004"
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	""
+	.string	"\005\006\001\006\001\007\001\022\024\001\026\031\032\034\035\001"
+	.string	""
+	.string	"\036"
+	.string	"\001"
+	.string	"\001"
+	.string	"\030"
+	.string	"\251"
+	.ascii	"<\206(\346\235\312\330\nf(\306|Z\"*\216H%\223iI~\200\214q\251"
+	.ascii	"0\234\204\213.\0246\017\200\005\234uy^~\263\364\312\r\260\373"
+	.ascii	"b\307\006\260"
+	.text
+	.section	.gnu.lto_.inline.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`b\002=\f"
+	.string	"\362\217:9 \223\322\030p\304\313J'\372b\266\t\360Y\354R\020A4\033\264\016b\013\271J\005\332\221\017"
+	.string	"b\343C!\222\f\fH\021\200,\230:\0318\327\267\210d\327\"\263[\356\024\377\n%\243fK\315\013\215\221\036\324\tj\303\352py\263$F\004\367\215 \377e\375\320d*\024\260\233\351\324K\371\013\200\326\023UgwO\037\030\224^\245&\273\273 \263\273\n\023\270|H,H\023532\357S8\037"
+	.string	"G]M\033\317\353\344a'\347\003\344\331\337?\222G(\214\343\245\325P\303\240y1\034\222\336\f\273\027\265\225\213\265HL\230\\\214\346\335\311\227\340\330\375%Q\350CM\331]"
+	.string	"\255\330]\322 p\224\272\273+\322\227\342\364\331]\3233@\377u\r\325c\343\306\032=\304\304q\271\t)\320\227\252\271\202\233\261\240\376{:\004F\250\221\251a\244\246\212\f\033\233\001\240\242\022*\363\022@\223\251\232\201\206Q3S\265\365\255\237\001Ta\343\362D\363:\326\335R\320Pquzt$\261\213\372\255qlM\024\321\367\357\277)\355\240\332\b\b\254I\332\327v\314\017\210nNe\242\341SO0\353f`R\r\275p\303]g\252\201hm\365YcW\373\037\352\377\f\357\272\261\204\336O\252\026\262\230OG\312\300\326\221\271\357Fr\334\023q\256p\352\236\004O\316/vB,\224s\026\364\017\211xVV\037m!"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_.jmpfuncs.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`#\002\365\b"
+	.string	"\022\313\"+\200)I\0073\260\314\210\342\377\342\237a\006B6\250\002\216\341\260\017\317`\006\200\270\343'b\333\232e\213\325\n\2454\273-!2\311<\342!f\b8@\356p\033\236\341\222\221\002U\026\034N\234s\331\320=t\235\tm\252\216\f"
+	.string	"h\310H \235\332\237{\270?\327\333\213\\\"\213+Yp\245\243\265\326f\213R\264\024m\240\320\017\256T\224\021\256\267)q\316\375v\343\321\025%\343\273HvM|M\223d\253\252L=\027\252I= @\002B\250\223\352\001\013 p\241\320E/ \370N\301.\013If\241;z\272\230\234\357@\210H$1\021\302\004\021\3251\214\214\031\367\271\261c\242\r\004\367\022r"
+	.string	"\267\300\222,v\b\263Bn\2303,\363\215}\302\021\207\314W>\234\3273\323m\0060\034\214!\334"
+	.ascii	"\276\007\372:\340\260\201\013@\352\240\201\016B\031\320\362\214"
+	.ascii	"\005\216d#\"?\n\026.\3434\350\264\203o\330(\232\030p\263\324"
+	.ascii	"#\030\355\265\001\254\372<h\231[\024L\001\206"
+	.text
+	.section	.gnu.lto_.pureconst.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\232\004\003\232\004\004\231\004\006\270\004\007\230\004\016"
+	.ascii	"\231\004\022\230\004\024\230\004\026\232\004\031\230\004\032"
+	.ascii	"\230\004\034\231\004\035\230\004\036\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\035\001M\007"
+	.string	"B\313\037&\220'I\007\377\217=W\337i\377\207wc6f\267\260WB\275!\333\r5\263\377\366\375\207@\343\375mkM\246\024*,0$(*\263e\034\372\034l\035s\020t\306\374\331>\363e\2734\r\243\b\212j\r.TGx\342\314\235\255\001\201\213\355B\027P\367f\333 "
+	.string	"S\b\367\306\\\331*:\260\304\224\322\217T;\270\251~\254\210VAnUre\\0Wl\025\333\303\006\230\3201\001- `\242a\256\356\225\004\bl\212\316\027"
+	.ascii	"|`\034\217?\005\202\022h\270f+}\213\001\b!#\214\200y22\214\365"
+	.ascii	"z?\260\303\344&v\032\347 \t\326\n\004\005\375\223\020p\306\247"
+	.ascii	"\034\351\006N\267\030\364+\304\252\333\021f4\200q\2065\001\354"
+	.ascii	"(\217s5pqFD\360\302=\330M\225\202\026\310\364\263y(E"
+	.text
+	.section	.gnu.lto_.lto.45e8a6595cc5f0c3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_updateAlarmBatteryStatus.50.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\"\003\215\027"
+	.string	"\226+\232E\260\032Uc(\343\211&\204\352\032\320\305\316\212\371\344\020\212\236\315\272\235\364\006\246\017\3402\267'\233\267\360\2702=\035\323s\260\177g\214[\033\345\035\305s\027K\242'\355\275\360\245\327\377\037\325\272\321\226R\312\224\002\204"
+	.string	"|"
+	.string	"\210"
+	.ascii	"\271,L\367\366\024\334\332\302x{\240\362\340\200\360i\037\311"
+	.ascii	"\223\324~\304\342\253{\213\232\250\334\333[`\005\343\255{\007"
+	.ascii	" \336\216g\211\267\256\331e\336\343qO\271)9`\232{\357\213\356"
+	.ascii	"x\355\242\255t\326\374\377\216\243\333\005]\254q\233\263\253"
+	.ascii	"\361Zy\222t\220A\355Z\324\001D[f\234vB\223\326\004LU\320\240"
+	.ascii	"v\270\n`\310\207\356\277O\027\273\333\2347\023\356\275\236\272"
+	.ascii	"]\214\373\346\266I\333\033l\332!\262\237y\035\212J\310q\243A"
+	.ascii	"~\3609B\033`\016\374_\f\311\b\223\0322\205A\300\334\271\306\356"
+	.ascii	"\335&\345\331\257\227\026\331u\272%N\263\304\351\035;\275\252"
+	.ascii	"\323\252:\235\252\323\250\037\3758\367\335c\235\236u\372\001"
+	.ascii	"R[\222\"\f\357\035\032\262\271_\254\225\037\367\375\366}\340"
+	.ascii	"\203\366\311\26431\225\261T\344\336{\272\365\2014\373t\373\377"
+	.ascii	"|\342\341Ax\357Kj\367\255\030\203`\214P\002\223\332%\034\221"
+	.ascii	"\216\360\310H\357\373\001\333\\\343\326\2649x\230\327\215\364"
+	.ascii	"\307\b\265R\201:3\226\375\320\323\320\021\0229\0175LT(\345\271"
+	.ascii	"EU\364\006\321\230\237\027\241\251\306,\332\272Q\272\261\210"
+	.ascii	";\224E\t4\341\204\254\350\016}\256\315\203\376\360) \306{\205"
+	.ascii	"z\374(\227\002\363\215n\035#I\361vE\337\244\307Q\212\242\250"
+	.ascii	"\212\036\007\3446\207\366\235\374\311\b\337\310%L\314\353L\210"
+	.ascii	"\267)*@\314\r\333\034\032g\372\301d\t+}h3\262,a!t\314\240\247"
+	.ascii	"\301\203\020\016D4p\305\\*r\004\f\b\210\274p\201B\005\224c\256"
+	.ascii	"\262\224\221x\321f%\211\202<A\226\257\024%`(^\261\031\320\313"
+	.ascii	"U\3002\025\344\354U\312d\263\327\251g{\275\264\310\030\270|\261"
+	.ascii	"\321\233Hy^\236\204\344.X\302 -5\331\211\341Z\224\250\356#\332"
+	.ascii	"\031\236\305g\274\367\366\370H'4\030P2b!\336.P:\203\022&1P\207"
+	.ascii	"\355J\245<\037\2018\351\354\307%5\034\016\207G \21648 `\002!"
+	.ascii	"r\265\033\362\360\032\2162\307c\026\256\335\001\032i\035\226"
+	.ascii	"\326\260\344\367*\230z&\236\0362\227\253\260\033S\360Wo\325\306"
+	.ascii	"\274w\"S\232\230\300\214\022;*\\\007\236\3432\330\022\261\r\036"
+	.ascii	"\264\306\270\333\033Y\226\340\301\311\220\034\251l\fk#\334\224"
+	.ascii	"3\246/\310&@\244\224\303(\031F4;ps\376\321\336\321\270bxj\336"
+	.ascii	"\210\254\"\315\316j\333t6\267]\306\356\n\230B\372W\006(w\324"
+	.ascii	"KD\001"
+	.text
+	.section	.gnu.lto_hottEAMUpdateBattery.51.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\231\001\375\r"
+	.string	"&\233^C"
+	.string	"\223\223\016`\230\3048\321\263l\021\2115\035\n\rI\017p'\275L=\001\344Rp\253Rd[\0353\030*\bU"
+	.string	"~\311:\377w\321Yh\361\267lE,\370\243\025V\231+SkF,\331[\312\224\002I"
+	.string	"E"
+	.string	"K"
+	.string	"6\202\315\301\323~\213\273 }%\345\002vQ25v=\005N`=\332{H\365h\235@\365h\222\275\343\236\212\355p1\034K\314\356^\232\342\244'\311\377\213o\272S\351\251\201\260\273\316\356D\342\326\333>`{\202\235\"\001\266\207\017\371\356\372\022'6-9[z\344\330\234\261\275R*\n\373pw\327\212\262\277\362{4\315\311\364&\323\226\2465\231\2564\0353\r3\255\232\316L\277\300\200\0218\036\264\354\212H\375X\227h\203\205\355w\002\267t\243\020F\345\333\254\031\215\332(\237Q\251F!\f\367\231*\275\t\231\250v\206\313\200\032\365\334g\3357*U\250\360E\345\333\324G\252\035z\214\314\332]\022\037\206\205\016!:V<\372)\325\343;\036\327T\370\302}\246L\271\312^@2\322\240\002\203\013#\037\320'"
+	.string	"vb2\032a%%\021$\200\030\364\321\264\f\303\005B\244a!L\003\246]\033PLB\027H4\272>\006\234q\300D\227\226e\242\253\343\355\341*\312\024N.&\335\f =j\203\260|g\221\020)\216\332'\247\261Q\316Y\002\034"
+	.string	"2\303k%\212L<\034\032\r.\0048\001Z\003a\204\314\233\200\037X\006\355^Bx"
+	.ascii	"'\220\027Z\333\302\2030\312\260B\240\200\037,\023E\337\267Y\232"
+	.ascii	"\227\245#\027\034\277\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_hottPrepareEAMResponse.56.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\203\007\375%"
+	.string	"JBp\016E\200\236M:O\032\216d\240\243\245$\207\275~\321\236\025{\003bx+a7(p\325;\002p\343\254\\G\363\216\361\02604\303vO\315\206\230V\240\326\314\2623\324Ktd\224\321\300\275\320\244d\020ir\247\024\315"
+	.string	"\307"
+	.string	"\330"
+	.ascii	"\346\311\"z\\\t\366\242/\006\314\027-\2520Np\320\302\260\204"
+	.ascii	"Q\235\353\252D=\0166\304\037`T>\230!\030\252\177\261R\212QTc"
+	.ascii	"$"
+	.string	"\321j\342\301\374\320'\372f_\325\205\376\227\023\034*\265\326\333\275X\370\315\320@\354\272S\253p\351$\203{\251:\327U\211\303&\204\030\274s\322\367\252\272\235dpV\301~\027_\313\267T\235\213\225\211\205\303\374Jb\343N\255u\351\2447\230'\225j\265\233\275\340X\341\324>\226g\361\235\353\352F\265\0261+\326*t\340%\363\244\205\317\225'\315\343\312\223\366\331v.DRO\354\222\341\205Vk\325\355\221\373N}\376\273n\013\346\300:\025\262Pk5\r\346\320q\357m/\260]\302\026\312\023=\276+m\250\263\331\231\265\326\t\376\032\030(rq\226\\\225'\033\304\331\223E\007\231\212\355XS) [\370\243k\304~\255n\021\373\244V`R'8\251\021|x'\231\324\007Nj\003&u\201\223\232\300\2137\222I=\340\244\316\335\250\005\234\324\270\227\335G7j#\223\272\310\244&:\251\207N\352"
+	.ascii	"&5\200\223\372fR\237&\265\315Fm\332\250\205L\352\362\\?]\302"
+	.ascii	"EQ\303\341\253\326\033\203\002\325#id\362\341_\374\313\276\366"
+	.ascii	"}\263\037]\244q:CC\263 \r\215\213-9T\314\\\330\267\227\371g|"
+	.ascii	"\263\217g\306\351\214\254\007\031o\213\210\244\f\317'C\204\214"
+	.ascii	"/\3661\274\217\2750k\321\254AC\t\210F{\264\324\rp\253h\215V\310"
+	.ascii	"\314m\210\266hK7@+\2772_\270\037+>\357\203\301\0314\320\0075"
+	.ascii	"\224'\211\326\201\034\2563?\215cf\304\2205)\206\t9\032\330p="
+	.ascii	"\005\326\300\317\216\264\005\266\306"
+	.string	"\347\n\201}\321\035\216\007i\tl\315\253\n\322\276x\245,9\037\260HE\017\003\304\3744N\t\003%lk\370w\375\024\013rT\360\341v\022\254\0023i\023l\255\0160\355g\f\202`?4\210\323\331\345\342\370\301<I\213`W\220\2144\243\326\232\244\375\360\274\307\312\003\233\264\257\003\264\362\243\203\234\243\3760\204\b\372\340\201\r1\344\267X>\361\247\361\307\327\317C\307\0166t\357\345JY\024\220q@\216(]{\004\t\372\240\225b,\226\251\230\326\333\334~\372\233;\023/z*z+\232\242\2360\020\245h\212\332\026QOk\b\023\"P(!\341D\004&(\246\242\035\212'\036o\327\241C\023\206!C1\365zR)tUS\275]\324n\305\256\247c\241\342)J\0075\305\3231%Y\252\305nJ\327\223\222\232\322\335\204Y\257\325-b\020R\216Y\373\203r\034\222Bi\030\355\2732\300\016\001\330"
+	.ascii	"[\023\204\366r\001l\351\005\264\362\3476\205\002\317\275m\r\314"
+	.ascii	"\266\347\226f\300\264\317ir\253\262\\\333\222c\300\255\237\037"
+	.ascii	"s\177\264\257\n\375\325\300\202y\036<\252\024Zs_\256\320\376"
+	.ascii	"\203h\265\362\227\330w\305\227\305\227\245<Y\256\203$>\216?\215"
+	.ascii	"|\322\340A\363\244\214\314\3111\347\353\272 \001\233\333\037"
+	.ascii	"\255\200\255y\235\301\355\313\334t@G\2133s\264/\333=\177Q\006"
+	.ascii	"\200\234\2501P\306\020S\244FF\222\024\244\220\326\320\002\021"
+	.ascii	"\231\252n\02109d\314\244 %)J\033Y\360\"\342\265\225\212\020\226"
+	.ascii	"\244\021h\031\254p\233\n\227\001\023w\251\250\245\217\207\250"
+	.ascii	"\035\313\222\037\357\025\244O\311\334\320\267-\031\314\355\n"
+	.ascii	"X;p\212\004GId\315\364`\t\242\275bHO\200gp\333\021\377\030X("
+	.ascii	"\3755\326K\310\023\327\317/5!\377\215I\214f\257\346\337\306L"
+	.ascii	"x\r| !\260U,\357\326^S\237\032\332\330)\341?OF\006Y\341&\203"
+	.ascii	"\001Z\367\236\264P\313uY}\245\317\f\262/\177\020\2525\003\037"
+	.ascii	"'\350\020u\274v\021gj\2019\270\324\f\317Ipb\345\340q\372\341"
+	.ascii	"\017\272V\310\261\223\343\360\227^J\013Q\031\222\233\031O\227"
+	.ascii	"\350 \366\277$\307\361\370@\2070\002R\351\032G\032\244\247\226"
+	.ascii	"\225S\300\203\225l\237m\245\"4\245V\234\306\240\214\377%\020"
+	.ascii	"\361\003\366r.\300Xl>\240oQ\r\307\177z\314>!V\234\273c\300y\361"
+	.ascii	"\235U\201B-d\361\007"
+	.text
+	.section	.gnu.lto_freeHoTTTelemetryPort.58.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"\305\b"
+	.string	"\006\320;:@\345&\035"
+	.string	"\264F%\236\315\b\210\306\310\347\225\206\231\330\354\360\206s\316\311\002m\230\321\b\322\2757\020\305\206\254\031R\343\262\262\272\206\327\327\273N\ffl\355\306n\273eJ\001("
+	.string	"+"
+	.string	"+"
+	.string	"\033o\266\313?oo\322raJ\355\356\204\035\337\256\233\177\220k\272\021w\rP\330]k7\312\270\341m#\330N\260\035\023P\243!\322\225\t6NT0\253"
+	.string	"\354\217S\310a?\263\260d_}y\322\246^\026Xv1V\001V%\242|\330\276\375\220\315\0167]\230\307#\037\r<\324\351!I\"\340\241\006RV\244\036\332\023\024\372\316\007\026\220\263/\362\221\220\357\341\017H\337=\372 \371\370\356p4\rk\230\237L\263.\353\301\322&\204\003\3035;\231\304\344\024\030\213\260\262\251aX67\337>\263\260\024I\253:\211`\205\375K\372%\001\017"
+	.string	"3\241\375\037\370\324\\"
+	.ascii	"\333\274\220\027\006\373B:`\211\251xhe\203\271\262\3205\334`"
+	.ascii	"\b\017\\\272E;\237"
+	.text
+	.section	.gnu.lto_initHoTTTelemetry.59.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\324\002\005\024"
+	.string	"&\342|J\300\226Qc\310Bq\206\227\212L\035%\307I\200\253\237)V\006\203\213\230\232\031\002\354\032BQ\313n\365\255\244\204\266Ew]\225X\216\370-|\b`\036c\200(\376\207\240,\353\0061\005\322\353\356\300\354\215\264\351n\"eJ\001`"
+	.string	"g"
+	.string	"h"
+	.string	"\254\213\n~\224\266\276\347\353\370\016\333\201N\004\351\335\375\b\306\020\037\250{S\006\027\315\"/:}\312x\221\274\201\361<\333\346>\216\031\346\260\361\177l\366\352\342W\276\331M\236\356\334\377\240\250\b\202\272\367\226V\306o\2577\377=\017\200\352p\257"
+	.ascii	"^\356\275\256\250nw\333\333N`[\202mg\002>J\370<\246\201\325\243"
+	.ascii	"\260\361b\rB\235ruhU%\037\033m\031\211z\364V&\347\204\305\271"
+	.ascii	"\032\005\227n\025\332\351M\2651\354\247\256\325\261\307\352*"
+	.ascii	"V\177\200\330\303\231!\264L\351e1\214\272@\261\250\206\377\363"
+	.ascii	"\237\355\251\037\364!\fJ8|B5Je\252\336'T\023\365b\337\016t\246"
+	.ascii	".Nzw\020h4\005@(\247\003\225\305\372\323'\235)\300\027.\210\374"
+	.ascii	"2\310\324\243fIaq\376\357*\237p\351\016\235|\342\331\b>Yp"
+	.string	"'\215\367\245\017r\222\367\346\216\372GG\322\340\363\\\364\206\363\034/\276w\226\034\357*\"'\344\023\0220\370\304hX\255\017\344E\034:\270\\L\b\324\363\370\255\3752\353\321j]9(\204\267~\217\007\246\t\030-\345\006.-\017<8\370\320\322*@C\213Y\277Z\265\232\fDy\316jf\314\fa\326J\021\260\231X\371\232\321\312\326\212e#\314YY\223\311f\345*\315\335\352\274\347\023n\330\033\333\357\375\274\307\b\271\301\246\\\024\n_\242\244\005\260\302\231\220\250\020\351\276\302\302\217,\255\354T\3370\3520\343\177\276p#0\002v\356\275.ET\222<E\bB\250AD\n\021BB\"\023&M\n\232\016\360\002\031\242\332\006\021\200\271\224\242P\211a\330\f>\320\234UG:\325\231\315\276\005\240\205OC\027i\255\243/sL\345\r\361\335\253\242\273\036\026p\246U\236\tj4\363\247\206\262\247O?"
+	.string	"\222\247\362\007=\030b<\300'\332\212\251\310N\266\360\274=0%\326,\224\323\223gS\371\361\266\031\230"
+	.ascii	"\335%\031o\266\016X\022\215\2371j\253\033\347\230\236!\314~\366"
+	.ascii	"\003\221.\354\372\007"
+	.text
+	.section	.gnu.lto_configureHoTTTelemetryPort.60.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\"\001e\r"
+	.string	"\206XZD\360\262&\035\240\222\242\205\277t\234\324\030\034\323\205\260\\\006\224\035v\351N\356\233\332\317f\301\276x\006\"\032c\240S \313\020\341\201\251\372+\2173\232\201\227\200\225\350\204\203\315p\"[\373\242e\264\367\2262\245H"
+	.string	"B"
+	.string	"E"
+	.ascii	"\247=\213M\303\n\237\335\275\224\304K\207O\263\344\013\340L\207"
+	.ascii	"\037\376\236\002\234\r*\021\016\346Y"
+	.string	"\251\036(\213\213I}$3\251\030\"\334\313+`\003g\304s\236\034\270\230\314\020\223\335un\234\207;\3366\003\333\t\354\313\004\337i\361m\214\201%\277\035\372,\361\360:`5\343\222?~\316A7\235\217\236M vgJ\255\261\377VilMk\246\363\351\0078*\207\217\016\0072v;\374\004\331\031\360\205\t\333\267\\\262q\274\013=\004\322O\211\177(^f\217E?B\004p\225\230jO\020\3457\325\267 \324d;;\212\013#\247\335]\340w\031VHn\354\356m\016SGJ\354$\214\233\032IC\205j\245n\211W\b)V0\371\303\276N\016\225hZ&\341\"\2154L\204Q\300\264\253\202J\212\350\n\215V\256\222\003\316,`\243K\313\262\321eu\373\267Jc\342\242/Pk\016\212\276\352-@\rNN\342!\202\323\016\035\021<'\\<RT\003\250\020\252~\352<\244\007((<\266\032"
+	.string	"2\241\243\037\360\024\203\210\354\216\255\261\003\026\217M60.\330\032\312\370\030\031B3\034\004\204d\0243\207<a1\t\226"
+	.ascii	"U\023q\265\016\001\272\206[c\302\277\214;\236.\bM\213\253\251"
+	.ascii	"3"
+	.text
+	.section	.gnu.lto_flushHottRxBuffer.66.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\245\n"
+	.string	"\266\323G:0\257\322\001\2206\230z+\330R\374?\022\372\201\313\321\370\351\351skT/\2109\205\377\377^C\220$\246\\\264B\242g\"\"\222\003\002fm\004\227QP\2016\371dK)S7"
+	.string	"5"
+	.string	"7"
+	.string	"\335\344%]\327\005F\226%\355\246\227R\201p\312\324\364\340n1u\351^\224\247\235\"+eu\351\034\251\275\220\345J\327S\350\356/Yb\3505\372\277\341?\302\257\007\0012\377\253\264\254\361\253\247\205\273\235Y\377\356Y\367\253{\005 \270\255<\264t\253r3M\353b!\377us\322o\323W\253\275\217\016\013\224\230\356\376x\343sI\032l\262\314\341H\220\315fw\367\364V\371\027M\254\2227@q\351W\022-\251\270z\234b\264Jjw\035i\264S\016\3100m\356\0032\025\206\245\244J\376\312f,\275\001\377t\3061t\370F\342\b\206@\bp\374\"@\f\241\357#\212\276N\301C\tP\374\3060\024\277\315\253\225Y_\200\241\231\370\324\2014\314k;\251\241\026w\201]\376C\341*\311\001\024"
+	.ascii	"2\003\353<\222ck\366uV\\\bk\354\200B\024\201\th\003\264\214\022"
+	.ascii	"\032\324\251%\247\245\267\264\362\202E\220\031n\223R5\007\324"
+	.ascii	"#&a>\001"
+	.text
+	.section	.gnu.lto_hottCheckSerialData.67.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\320\007E."
+	.string	"\252O\324\021F`\034R:\375\356\217\231mv\246\360\031\302\232\033\276<\366$4)\227\026\024\312\367F\313\037\035y\255i\341\025\266~J\232uj_&\337w\263\f;G\3363*\330\221\\\300\371:\276\bU\355\227|B\310\336I\006\n\001\365"
+	.string	"\r\001[w\306\3119\367\300 \277\314\350{\251\352\016^\275\337r.?\353`\321\016\263\004vxN2\026A\312\254\206X@YyGg\f\005{\265(\311\021\205\013Wo\255\206Xm\336\322@\247u\356\345\334>\270\332#\330\253\335Dz\216~\273\357<\226\253g\241\321\277\234\207\300\245\345\334F\350\007\354\325\341\007\254W\323\013X\257\366U\367\234\267H\262o\211\225\345\331^\316\331\b\037\371\325\205A\340\217\365\255j\212\357U\037\310\205u!Q\360\320&\2203\300?i\376h\"h\363\353\376\240\315\257t\230s\376\231\217\313\246\n\212\004\211\036\332\364J\207O\271\345\237\276(:g\2255u"
+	.string	"\226\206\307\017\3272\035\300\206\210\234 \227\326U)\310\331sF\207t}=M\035\340\251\341\371\341\252\221\016\330b\302\fre]\234\0325\321\232\374p)S :Q\324~v\242'\315\257{}\035r\316}\231\\]o"
+	.ascii	"\357\3567\335\275\354\366)\005g^<\314\302X\335\217\273\032\030"
+	.ascii	"}%M|\272g>\255W\217\023\210y%o\237\376\233\334\336\317\236\364"
+	.ascii	"\326F\365\362\325\323\335*/\016\353~\232q\221n\366\366\320\333"
+	.ascii	"\267\320\313\336A\317\362\007\270\331\373\207\275\rdo\377\330"
+	.ascii	"\333,\360\266\017x{\r\336V\203\267S\3666\016\336\276\300\333"
+	.ascii	"?\300a\f\354k\311\025\f"
+	.string	"\247\315[}\366d9u\255\311\333\277\3547\373\357\246\335/\242r\324\317\016\026\221\301\025\357\366f\260^~\246;\330U/\3237\363\267\2449\262+\026\253\311\242\345-\267\252\267u\333\233,\234\235\030^\316Y\006{\365\265\251g\255\346\357\306\215/x\013\224G\276{\266~\332\325\252\2766U\240\315]\007\203\373\002\325\262\027\260\236L\367\214\217i\004Q\224\\L7\362]\372hCN$`\316\234s\360a\354\322\212\340\216\326\3730M\341\002\362\255\325\333\034hg\357\\i\243u\302\274;\b\325\364h\260\346\371\343\207\303\200?\314b \306mK\036\312\374\303\352\331r\315j\r\302,\276s\3135\345\035!\374\326'\024\365a\002y\320 \374\262\017\207\356\212\273K\234\270g\006\341Y\361\201\2728\2747v\320\250i\231\022\205\305ayW\261\221K\234\360\311\006Ms\275c\221\3159#\025\0049\r\270o\020\222\342"
+	.ascii	"X\305\327\032S\336>\215\267\007\266\344y\226\315s/\252g$M\336"
+	.ascii	"\024\3373\255\356s\252@\003\340\276\335\345\320H\221\224\264"
+	.ascii	"^e \366%|Ri\313\233\333ZqX\027WL\207\261\260\316\353>\245|\017"
+	.ascii	"\031\2673\225\210\006/\252\367\027\327\276\233\317\025\243\224"
+	.ascii	"\224\326\253\b\350\354\030\370\022p\273W\264\270g\366P\211\261"
+	.ascii	"Z\370\004\322{\246dAIo\034\037\320\033\315\202\213b\034\326}"
+	.ascii	"\253\365\0073q\211\313\272y\372>\271\240?\370f\037&\257\236\276"
+	.ascii	"\370\007\377n\311\007\350\036w/5\335ND*\252%\023\304("
+	.string	"(\025/\236\220E)\"\320\213\343\223\0241\306j$\272p\201dZ\237\244\240\216PKJT\304c\025\223\320I\304\221\212\210\234\"\032\177TTD\243\223\323\222\257'`\250\220\201\311\202\213\n\022\200\250\212\306&(\022G)\242\321\210l\002\320M\022\216\307\342\013\243*\343\221\030E\214A<\032IA-E\0315\031\251\214$\034\350\242\f\242\321\350X,\032\215\202m\362\035\222X\371\237\235\235\313\023\022\305s\3730y\266\313%\205\021\216`\355\213\343\346\260\272\32225\265^M\3570\365\362\240\231\211\364\3531Gf\343j\335\345\224\207\017\037\326\253?u_I\2675\277.(y\202C8\301\315*\202P\032\302B1\257\344\231\003\335\336\240\371\355\327\341\306\326\006\302\273m\275\333\203B\312\\,$\006t9'\317\354\367\2719D_\311\325\026\201\204\304\366a\222\314\201o=\306\374\347\244J\216\326A\252\215E\365"
+	.string	"\334%\241\003\342\260\276\216[\255B\370C\335\305\034\370\206&\200\247\250q0\251\230B\212\204D\222\264R\030\016p\002\221\241\313:\020Xg\264)4\006\230_2\313Q4ik\r\3051\331\030n%a0\032\334\2204\025'\313\310t\371W\322,\315\262\315\2501Q\234\344\365h\305\265\2403\232b\212(\036q\243\231\367\273\345\231AC\320P\b\265\277S\b\376\3450/^:(\016\373\254\236\276L\034\345k\302\356\b\0315!\016\201\363\341\013M\022\023\207\rD8\352\215\302\220\005B,\320x4_\310b8l\264"
+	.ascii	"\242\226\345\022\255\221\003\\\310\315\356\377\330\327\310\374"
+	.ascii	"S\244\233O\215cm\\D\376\331)\373\036\023\205\245\351\270En\225"
+	.ascii	"\036\\\216\024:\007/\335\300\003\363l\364=\b\360\025:\265\016"
+	.ascii	"T\314\334\207gj\203\343\314)\335bv\230\312f\030&\035L\024\234"
+	.ascii	"\246\372_\237`z\0209\370\250\241\274\366\212T\356f\3526&\213"
+	.ascii	"\341\022\201`\207\206\3251\bp\036\205\024\201\261\242\2228\f"
+	.ascii	"\024 \024jU\n\360n\007\351\007.;J}\320+\212l\230\230\253<R\227"
+	.ascii	"e\266\210\353\376\240\254\261\353p\267\320\034\201\204\225\261"
+	.ascii	"?\307\003\267u\353\350\032@\215!\207\302\"$\fc\375\321|\016\003"
+	.ascii	"\022\322gt6U"
+	.text
+	.section	.gnu.lto_workAroundForHottTelemetryOnUsart.68.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\013\001]\r"
+	.string	"\266\332]C\020q\224\016\377\302h\210\244\342@\240\3007\326}G\231\f\240\026\210N\016\220\311\324\315\005\032\003~\303\366c\202\267\021\314N\256s\323X\001"
+	.string	"\nE\250\204&\024\031\250aQM!\004\266\335\222O\366\2262\245H"
+	.string	"I"
+	.string	"H"
+	.string	"#2<O\373'\216\242\373\312\364\217]\025\217\027\273\237\001\027\300\036\375=\344z\304\016r=\272\263k\374#\261\031\026\r)V\216\335\315t\304\273g\347_\3055^\312\351\231I\260\273N/\245\303\255\267=\300\366\002\373\036\002\032\020\250l9\304\306K\f\314\246\016\373;\245\212\260\017ww\255*\373-?\366\325\237y\032\302\264j:\237\376&SI\271"
+	.string	"\300\332\335\320\332\2613b\f\026\333\337\330#.\236\374\236\242{\013\006\310Y\224\020%\024`\217\"0\016.\354\237K\325\006iy\017*\\\025=9U5Y\251\036\266\204\267\ba\273[\342\2630\241\200\255\230\256\307T\0024V\250lY\200\t\027M^\355\315B\336\263\b\212\236\354\263\276\302\344\257\270t\222\367\036\375\223\353\361\032\032\204M\004}\240\204\004\301\003O\004\222\016G\003\215>\\i\024\302\f\352p\3346!\273@\3424\221VA\343\262Q\350#\312@\244R\326\t\340\315D#e\334\266\221\262\315\267\207\253*\307\033\034b^P\232\301Pa\034\207\007\003\222>\203\013\323\177\3307\270\374\023"
+	.string	"Cs\240Lh\033\007\306EBp\035\206\311\255\262R\251\001\222e\302V\266\230+\013\3375\240\031\306"
+	.ascii	"\341;5\n\216\361\251\246\301I^\\\223\f"
+	.text
+	.section	.gnu.lto_hottSendTelemetryData.69.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\021\b\305'"
+	.string	"\032@T\016Hp\334Q:\313GK\231\264y\021\020/\201\004\335$^.`\342VW%\226!\313\251\025\312\244\372\276\322\3241 U\211f3\216_\022\355\245Y\006\212\224\335\327\373\n\2257\210\2026\341\007\255\366\2775B\b!d\313$\003\317"
+	.string	"\301"
+	.string	"\330"
+	.ascii	"K>f\365/~\022\r;\323\365u\224\231\203\017\003\026]%\333\254\007"
+	.ascii	"L/JG\215\300z\267/\306\b\026X=\f\370d\233\365\255\262\264\257"
+	.ascii	":m\233\354\035e\245\365(\037\314\212\371v\264o\034df\363d\220"
+	.ascii	"V5\302E\204R\247m[\337\005\362\340w\272\034\356fcW5E\317\333"
+	.ascii	"A\376\325wc/`e\312\027S\267\263\202$\327\225\243q}'\371\325\344"
+	.ascii	"F\300\2466\361\320\342:\2534n\235EI\2147z\275\322\210#\211\021"
+	.ascii	"\331\352\275~&\261\223\366\305\344\241\245\343i\215\243\266c"
+	.ascii	"\215\237\272#\326Y\324\266\355\355\330\242\357\231\324\025\206"
+	.ascii	"\306\355H<\203\306\364Ps\257\267\214\343\260[mj\333\226\273x"
+	.ascii	"\324:\367\234\371\227\231!0\253P\002\f\370WX\200X\211\250H\217"
+	.ascii	"\336\313\206\361\313nE\305\323\357\227\036\355\033@\b\362\007"
+	.ascii	"\307\315_\225R\031:\023\007w\346\245|\221bW\332\345\252\364\327"
+	.ascii	"\211\fM\213\266\303\374(\227R\305'\302\"\240\372E\250\364\350"
+	.ascii	"/"
+	.string	"n\211\024v\223\357\365\fp\222L\265\266\327\230\223\303\276?\232\315f\223\257\017\346\265\271\3076/\261\315Jks\022\333\214\3046\037\335f![s\020\333\314c\233\201\330\346\037[\263\317m\356a\233wl\263\216m\316\255\315\270\265\371\2466\333\322f\026m^\331fumN\327fTm>\323\346\2136\367\331|\004Ck\310\314p1\302u\315$\333\254\346\2356\r\305b\344\t\031\200\260\272k`\211D\343\252\202FKI.w\007\020!s7\316\213j\315\003S\365\346\356]t\r\321l\034m\bV\206#2*\211\2329\202\204\341\275b\334Y\363\266\346\2706\270;\266\037CzKsc:hr\\\262Xnc\257mi\2025\263\036\231\3622t\214`\316W\236L\324\004\n\024\322\243\2747jj=\260\254\367\307\331\325\353D\266L\253\240\336\236\020d\237\241\265\231\2341;T\334\331\027\345\201)?\314\305"
+	.ascii	"-DE\245G\205\202tI\337\345\351e\276\360%\275,r\200\026t\250\373"
+	.ascii	"\030R\3642g\320\320/r\021\326\275b\276\226o\221\332\300\241_"
+	.ascii	"\344\220\036E/\213\324\235\231q\027\254\254#g\037Ez\336)21\367"
+	.ascii	"\236W\200\034b\036\366p\263\017k\333\266\001|\200A\202\006N\n"
+	.ascii	"B$`\352y:?1QQI\215\360\255\230\242\372\225\370\221\370Q\371L"
+	.ascii	"@\201(\341{\232J\341c\n\300R'~S>*)\251)\337-)|\223\360\016\231"
+	.ascii	"/\206\256\355\250\343Fx\266F-t{\227?\326Y\275\245\216\241t\227"
+	.ascii	"\032\206\322X\362b\347\246\237+t{\304<A\367\305\201\373\334\240"
+	.ascii	"{\327\270X\302\204\327D\240\373sy\215\005tyB\220\302\016\300"
+	.ascii	"\237{\030[Be\013}n\320\022)T2\343\306\220-\035\016'\277\327\327"
+	.ascii	"2\314+L7F\335s\223.\377I\320+\b\326L\272l\0263%\322\305C\347"
+	.ascii	"G\027i\r\030\024;\272\274%\022(\354\311mY\300\224d_\345p%\231"
+	.ascii	"p\332;97\t{\215u\267\347\276\214\230g\307\264p`\252\273\2739"
+	.ascii	"\001\200\262\250a8\t\rd3#I\n\212Rh\f\240\002\021!#"
+	.string	"\363\021\020-dJ\215\330(\205\215\375\f\254\351\322\232\022\256\316\270t\217}\f\230\326\354\346S \356-\023F\254h\261\032\341\245\241\257:\260-6\215\313D7\030\006<+\006L\377\274\021\220\214\267T\374eK \fUB\235\2763-\314\032\234\234\324\236:\237\321\213\222I(0\022I\177\224\214m:WW\332\360\231\366\325\221B\363n\263\320\255\371\374\213o\261\341\331\035W~<+\017\025\204\2249\245S\0277.\013l^s\r\027J\006\3225&p$\211\241M(\207\360<\270\ngx\320U\035\006\231\373\347+\271\364\235\222x\207\030\3358\273LnP\264\273\353H\325\363\326\036\266\201\327\314\262\243\016h\273\002\277\bhyE%\201%\300\201\222BI\b\317\212\006u\003q\354\302\2453\214W\020\036\251K\247\234\364\360z\245\314\361v+\202\365\314A\353.m\267X\211P6\356\341\270i\220\375q\275F"
+	.ascii	"AB\232\2449\260[\232\342\204J\333\257aE\326\005\b%\316\362Jn"
+	.ascii	"c\322i)D\241\207@\251\233\013\341\366&e\242j@U]\220\360\031}"
+	.ascii	"D\341*\300'\021G6\016\375\211\235I{\221\033\neA\346Ut\354\035"
+	.ascii	"F\r"
+	.text
+	.section	.gnu.lto_checkHoTTTelemetryState.72.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`Z\001\325\016"
+	.string	"V[dF"
+	.string	"\221(\035\354\206x\016\024{JC\225\027\256\031J%\305\213/\2349\375\0170j=\315M\375\021\357f\255e\340\326"
+	.string	"\312\271\265\013\206\260l^VeU\307\324\317\251\001\242\365)x\202\n\232\307e5D6\2212\245O"
+	.string	"O"
+	.string	"N"
+	.string	"\026\341\\:\264k>\272\314\313\270\331\360\302f\316\351m\211\207\347\344\266\032\372\252s\234\225\313"
+	.ascii	"\342\312\267\0201\303\326\3159;bKw\373\314\2101BD\326\006\262"
+	.ascii	"\242F\305cW\016\242\006\325\017\2229\247\325%z"
+	.string	"\270?n;\202\355\022\373#\002_M\301\202B\304Jk~\354\017j2;tL\245\331#K\367e\177\233\333b\037v\313\253U\325\007\360\030\030\026\022/\264\2651N\225\032\217I#i\274\034v\373-\302N\001W\003\3731\177\024\204\207\245:\3258U>5\032\230\315\234\243\310e.0`\266}\331OqrC2\034\007f f\373aF\207\034\273/\271\272!\331\215\226\336\330\227=&e\201D\342.u\r\230\320\032=fr\017{\267R\2329\372\2651\234\350]r\273\326\252\354\273\370\210\342\237p\nJ\357\272\364Q\334eF\260`\204A(\301\204\021\217\200\017e\004\202 \341\033\205@%\007%)_i\200E\036\0204U\360P'\360#}\243\017\364J& \222':\235x\036\0026]\370N\036h2\235\274\316\270\372\266\230d\265,N\264\253b!A\324\246`\242w\271c\255\312\227\231\205\370L\034"
+	.ascii	"D\215o\234Td\206\2463\271\303K\373\267\017\024\003\352:P\255"
+	.ascii	"R\327&U\035\004?\032H\304\210\237\233[`\361\021\311\223hj\232"
+	.ascii	"\260\214\013#&\306\264\316\036Y,\001.\223\233\331}5\271\252\323"
+	.ascii	"\275\266@\001"
+	.text
+	.section	.gnu.lto_handleHoTTTelemetry.73.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\247\003u\032"
+	.string	"6\356\247G\240\\Qc\024\315\021\311\3032I\201t\372D\372\232\241\177/\317\033\305ve\231\350\263\334\035\247jl\013i\321/Z\205U\300\255L\304s&\036h\001\227c|\232L\"\345\352\002\006\034\005\031\b#d\357\275\267\224)\005\221"
+	.string	"\212"
+	.string	"\222"
+	.string	"g\302{\223\022n\335\213\003J\352\3364\201\201\316\223\260\357\224'\307\017(O\232g\227y\332\343\362\020\t\242hbs\357\215Y\036\347\275u\232%9\332\312\363]\250\321[\357!\375\034\031 I\021\365\341Qp|=\2551r\341{\212\034!US\306K\035\364\304\322\353\n\024E%c|\034\177\316L\251\321AM\214;-\202"
+	.string	"_\350\257\332\361\307\006\025\214\027\352\033w\276\344 s\341{\206GH\265\232\020\356\275\256@\324\305\355\272m\033\2661\330vGI.\374{\f\217\fo\315\262S_\265J\366m\261X,\332\352\260\313\352\234\263\332uV\237o\362\233f\265-\253\017"
+	.ascii	"\247\b\031\364*\250\334\333\242\350\346Z\221U\204\370Q\016E\364"
+	.ascii	"\324\227\"\024\274\222\344ON;\330\217IE\nt\262\347\310\003\262"
+	.ascii	"\376\211\350N\2731\275\350\251\336\204Y\302\346\244#\234Q\210"
+	.ascii	"\236\274\251\350\251y\256hyRd\177\211\304S\013\005\261\274N\372"
+	.ascii	"NH\330\257\223\326Oy\366\313\206]=x\275\320_\022\347\275\275"
+	.ascii	"\003},\317\242\301\377q\322\033\206\352\201Ce\323\214V\0174\354"
+	.ascii	"g\215\374\246\273\262\3248\323(\221\"b9\r\255\330\214\023/W\243"
+	.ascii	"U2\316\f\341w\345ieL^~\265\315Y@\211q\211g\\\326\264\247\375"
+	.ascii	"\211!\276Z\264?\365*\273\016\265Zy\322e\017\3708\324]UB)o\001"
+	.ascii	"\311\222\"b\231\366O\207\365j\226}\206Su*\315\227$\353\\y+c\032"
+	.ascii	"\363\253m\354G}J\316\377\341\017\266z\240"
+	.string	"\255<y\213#&\330\253E\313\002\271\033nV\233\240\240\301\002\0072\006\034\026\004\005\310]\240\331j\026t!h8\334n\226\343Y\220Nw\363\020+\302\351h6\032\b\232.\026\2426d\213\315p\271X\220\001\337D\320p1\335\355\206\213\275\322\336\255\016\b=\353\033\357\275\267U@\302\204z\240Gk\004\003\314\213\253\323*yDi\255\214IL\325\255FP\250P\241<i}\206X&\201jZ\373\002\006+\"\232W\371\230D\225V\211\312s\250r\031l9KwUmi\001y\223D\304\272]n\220\246\345\202\300\007\215$\"\032\001\365P\256e(P\250q\034'\221R\210\231\211d&,i\212\r\200\002\231\251\343\r\020`h\333J\007Bx\230&\305t\3651\253\314yFk\037\337\031\265M\016Z`?\026\336\212\r\021\340T\237\bos\307\324\201\333E9\334\355D`&\007\372\230\304\371\031\206\352\241"
+	.ascii	"[\017\030\017\212\305\025\202\024\216e\217\332{\360Ct\317>\017"
+	.ascii	"\243\336\302\004dv\013\241\204=\224\340:\354\004\2446l\214\342"
+	.ascii	"\301\204\2424\311\377\344\353\363`5\3152\034\0249\335\204\203"
+	.ascii	"\034\264\350\267\233\341\342\231 \212A\217\266\035y\005\356\254"
+	.ascii	"\216Hv\001S\027\032)`R\\\"\324"
+	.text
+	.section	.gnu.lto_checkHoTTTelemetryState.part.0.97.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`@\001\r\016"
+	.string	"F\030[G\360\2208\035@\221\022\252\356@\275Cm\301{\030\214i\206<\317\303\315\232<\261\027\330[A\347\033N\213\246\274~\370\2479\362\303\334\271RR\262*\340\371\341B\223\213\356iRXj\315\311\343\005&\030\016\332d\357\224\002B"
+	.string	"C"
+	.string	"I"
+	.ascii	"'bvI\317\253=\232\327\233\260\275:\261h\3378\271\262w\261c\203"
+	.ascii	"K\314\356r\257T\304\305\323\231\211\376\034[\254\323\227/0Sb"
+	.ascii	"cE\253\303\347\200g\036\242\335\265\306\303]o\033\202\355\221"
+	.ascii	"\375\020\001 \354l\372\332DQ\360\262k\022\233\331\017\025\006"
+	.ascii	"\211\273~\373~\313K{\263\352)\314y\311\330\335\255E\345\373"
+	.string	"\256\225Oz\363\352,\241O\356\022\267\327\004c\004\373(\fj \236%\354\260\3105\001\305h\004)8`0~JS\021`E\007\201\227\315<\365K/\303\374\350\216\006\312\262\357\362W\312\037\341\021\324\374\210\322^O7($3\346\227\007\020cF\215\2352\024RJ\300r\234\3749\274Z/`0;e&U1\315\236-\r^\340 \364\240\304\300B\350#\240C\231H\023*t\246\022\351$a\224\352N\034\177|@\320\273\300\251>\260\023\351L\035\310\235@H\"\334\3077\302}\016\330\303\320}\034\350y\037\267\331\236\027\221\320\022JUB\315g\361\026!HH\210\366\212\300@# `\002!\266\353\304\361\005I\240\303T\n\233\226@hM\303*\307\301\342\217\254\221\321&A\006\227\346\2613\234\217~\020\266M\373j\361\365yz\310\034s\"e\373i.bg\232\017\331\004\013\037v\373\224\253l~kV"
+	.ascii	"\213\207\236B}\351\265a\f"
+	.text
+	.section	.gnu.lto_handleHoTTTelemetry.part.0.98.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`\271\002u\025"
+	.string	"f&\212I\260\324Uc\226\214\206B\023\224;PdF\226\224\036\031w\004C{8L\241\354\314\345\334#\260\317\0060\341A\214n\254o4%8()\212\274;\003N{\377\311\236\354\304\367/\355(o\231\231\"Ap{\204l\271\245L)s"
+	.string	"s"
+	.string	"r"
+	.string	":\223\334\233Cdt\357\351\340\326(\253\333\326K\312[\362\007\312[\3731l\357n\314\263\177\374\034^\223\026B\020@Q\367^\363\266\2468\357\245%+U\361|"
+	.ascii	"A\231\227\324\252tl\206\374\202#N\222'&\226pJv\350\370`\005}"
+	.ascii	"\264\222%@\236\337\200 \ry\002\344\b\352\304S\233`\217R\003W"
+	.ascii	"\251Z\356\275^\221\270W\267\375b\033\203M\237\002C\240\357D\261"
+	.ascii	"m\327J\316\264\237C\340\205#F\346-\265\357\017\335\006\356E\277"
+	.ascii	"\206K\230\004\343\336\373\"\"[\313W\2549}\242\356=Qn\031\270"
+	.ascii	"`)\351\213p'\262}i\252\311'j\302j\b\027t\241\230\027m\222\244"
+	.ascii	"\024\024c\037(\367\242]B\034\254[\237F\256\372\304\235\315\362"
+	.ascii	"\211<\233\345\335\177t\344y\2037\255\036,\224\376\364e|\006"
+	.string	"\357?\001\265\222\365\037zz\364h_\351:t\033b\261\362\226\326\005*\204\214R4\007\r\260\247\326\035\333\264\362\325\245\370\344\243E\354'\375\006\315_\341\0162\372\237\254\274}\r\340$\234\241G\237\370\017\215D\214\227J\321\272\343\252z=\036\217GW\024\366\212\232\374\371\327\0255UQ\237\204\n]F\356\005\036\215\334\023\026\211\005\022n\252\311\310\256\225\235i-\2313\266Y\355\025\243\360 \202\212\004\027\b\032TR\n\330,\300d\261\n7\030X\255\206{\t\360+\345v\233q0s\265\033L\006{\201\335L\230X\006\231\371\252\331\314\024\005\236y\200\325\314\333lV3Y\266\351[fj\317\365\344\275\367\226\2652!p*\361\302!@\355\027\214\376\347V\257\312\270\001\017\021\325\206'H\215%\205n\315\361\233\214S\026r\024\002\212\254;N\360\342\272\222\2540E&Z\003; \220\002\221+\365\342r89"
+	.ascii	"\305\360Ga\335\305G<\334\362\377\264\304\365`naV\021\230P\276"
+	.ascii	"u\013?-Z\261\301\325r\021\001\273\3059\225I\303\020eq\344\205"
+	.ascii	"\021\363Q\f\244p\343\260\216\203\304H+g\3705\235~}\3200\026-"
+	.ascii	"\211\241\005v\016l\225\313\216_x>D\227\031}D\205x\334\214\004"
+	.ascii	"3\210\256\312\227`\365\230\323\202\231\274\313\354@{\251\320"
+	.ascii	"\206a\321\020\262O]\306\334k\337\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`Y\004\335\022"
+	.string	"\346]pJ\300TU:d\2706\177\255\3462Q$&\220)\310("
+	.string	"B"
+	.string	"8 \231OzTPl\2078\006s\263 \221\250u\333\024ECI\024E\025D\025A\002"
+	.string	"L\222"
+	.string	"\026\200c\333\266m\333\216M\352"
+	.string	"\005H\343+\204\004\311-SY"
+	.string	"Z"
+	.string	"\\"
+	.string	"6\003\337\221\322\377\241\314P\265,\315\002\375\035J\340@\006\300j\262\220\203\301`\360\244\017\203\322^\244\332\314%k\305T\260\367x\365_P\233\316\210\217\253\317\243\255\030\253\177\322U\247\240T\357\205\374\257YS\254\360\277X\313\262\356\376\376m@,\250\326ZQ\215B\377\207\032\002>7\251\363\346R\347\f}\037\206\376\215\013}\034\026\3729*\364m(\364mL\350\377\220\320\327\211\320\367\341\322\347\001\241\237\363\240\257\303A\237\246A\277fk\255\277\t\203~\215]\260R\320\247A[\3723(K\267\254\320B\225f\241\266^\241\t\216\203\3407\341\177Z\326\025\007:!d^$\217~\373\237\237\0229\"\311\243\034\214d\021oUv0= \222C&\214\344\021\267\367\275|@\001\"y$:\3678-fR\270F\036\313\375\221\031SF\034y\315\261%\362\232\3132|/0.\221\027\b\342\033\013\304"
+	.ascii	"\3123\217\"pO\027\025s(\207:\217\347\256\316H\017\200[*BH\f\017"
+	.ascii	"\311\211I\334n\020\016,z\343\211C\345\236\210\013\035\036\322"
+	.ascii	"\211\307r'2-\215.\206\212\022\023\337j&\272s\366zV%<\236\263"
+	.ascii	"\022o\216V:)\361\215%\200\311\030\211E\240\214\304\313c\022\213"
+	.ascii	"\277e\017'\212t IX\"\336p\356\306\2140A\342E\262\211\271\257"
+	.ascii	"\031\022M\250A\020\213\202,\234QP\330\322p\320\002\241!\343\006"
+	.ascii	"\021\200\020g\2152\321L4\021\005B\017v\306\265\324\205\214ii"
+	.ascii	"\216\303!\251\235\346\t\217\232O\241z\317\361i\337[A\236\263"
+	.ascii	"|\037.S\303\311S1\2517\313\223/\341\241\310\262L\222K\222D\226"
+	.ascii	"/\375\365\256-\357\310\006D\0139k$-]\323\231\323\025\021 \003"
+	.ascii	"[(-B\213mQZ\027\fHm\331\336\223\207\300B\006\021+\314X\220\020"
+	.ascii	"|\231%|,\252\021\245\t\216\203u\266I\346m\033uk\255\002"
+	.text
+	.section	.gnu.lto_.refs.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"U\007"
+	.string	"\326R4*pi\222\016`\277\002\201\252\252\252\252\252\252\022\350\021\221\3711\207\247\350G4\373\377\330\326\266\326\bi\215\220\326H\243m\t\221)&"
+	.string	")"
+	.string	")"
+	.string	"S\232/\310\037\310\227\264\356`~j}\301t\250\375\323\2728\263\374\2253u\313\256r\205\032\2667\365\254\277\276\f\001O\201:\002\364\007\261\033\304\2378\235 \002\377\321\364\206\353\f\347\243\330a\376\313_\340g\323U\363\343x\301\351\225\247\256\270\006\247c\255\320\370\t\300\223\332a\364d\274X3R_\262+\362h\375D\376\022P?\002\372!\\\377!\366\035\342\337\340>!\003\017q?5\037I\324\214\344\227\264"
+	.string	"\233I\257 \007\250\035<\262\236^_\274\036\275\036_\177\236\232A\372\202},/R\003\007"
+	.string	"\253FW!"
+	.ascii	"\236\206\002ls\033?BdE\310\203ZE\017"
+	.text
+	.section	.gnu.lto_.decls.45e8a6595cc5f0c3,"e",@progbits
+	.string	"(\265/\375`Z=\025\376"
+	.string	"\232\200IVU JQ:\215\001\224x\357\363\302\255\325\225\361\323\030<\223'\030\300\250oEv\351\300\355\025\225\302\230\344\201\036?\25140\354v\337\346\f\215\004\034\234\275\006)\332\266\255\022\204\310\031\277\367\274r\363\034\302\205[\226\262\367\215\351\234\361\333]\265&\265m)\245L\001\250\004Q\005\207\005\032t\316P\215\345\270\3717L}\022@\244\332\024v\315\360a\306\252\351;R\343\371\366c\307\326\023MU\030\333\r\033uO7\234m\236fv\337\020\033}QB\267\007\0300BV`\372\314p\36499m4UaBZR%n\n`\bo\223\225\n\203f,\233\276\"sg\314\236Ub\236f,a_\330e\372\205\246\306<\315t\200Ic\306\242\351#\253\023t\362\274\315\245\257;4UaXXh\252\302\336\242\n/\r\252?6;8\306\003L\23069\324\270]\331\t\355"
+	.ascii	"\343WFH\333\205\202\262i\372\232\370\370\331K`\370\326H\375\200"
+	.ascii	"\242\251\n\273\317\013\275bw\354.\271G\256\223[\345\236\335+"
+	.ascii	"\367\355\016\271M\256\225\013w\323\356\332}r\243\\$W\312e\273"
+	.ascii	"`\027\312-r\277n\364\222]\264[v\231\\\263\353u\333\256\222\353"
+	.ascii	"v\215\334$\227\312\r\273D\256\332\235r\343l\364v\335 \277\\w"
+	.ascii	"\205[\273\346\027\312\262k=L\350\216\262TN4Ua{C\315\334\256\313"
+	.ascii	"\334\314\300\022K"
+	.string	"6\232\252\0335tR\314L \177\270E\337\003\f\337\364\207P\375a\022\375!\020\375\241\225\376\020J?m\243\237\n\352\247\177\372\251\236~\312E?\225\323O\245\350\247k\372\251\023\375\224\211~zD?\345\322O\257\364\323)\375\024\207~n\243\237\377\3643\027\375,E?\267\351g4\375\f\246\237\213\350g-\375\\\245\317\227\235\364\001\t\365\007\307\350c/\3728\213\376\201\2425`\250>\026\323\307J\364\361\n\372\330J\037\347\320\30764\207,\267d\254\230\036\034E\226\020\271\371$\360\264\b\331\315\271=\t\363\224\302g\303\3301\266\317\376Y?\373\305\356Y=\013h\371l\240\215Z1\266\313m\236\365\362\f\335\233\211\004\025\033g\357\332:\250b\007\370\006\005\f[[\337so\250\031\324/\312\335\247\330\2736\373d\262\005p\357};Gg\327z\360\336Wu\317\272\021%\254\030\313\305\256\331\273*\r\304\350"
+	.ascii	"\367\206\336\312\375"
+	.string	"BV\214\305b\267lp\332[k\354\0015\277\2514\203{C5\024`GM\224I4\202l7\334'\372\267\211\376]A\377N\351\337\246~\033\031}*Y\254\226\034\350\344\310\023]\226\250\376\235\3050\264Wr\330,U\251\n\323\026\316V\261Qk\345\267Sl\224g4\254\035\335\033\312\203\233SuSn\276\3750\264\037\206\267Ft\266U\232\203\335\372\203Q\213\260\030\206o\241MX\fC{f\321l4\310\252}D\211c&\332&\333\033\352\303\323\246I\03357_\205\336\031\272M{\004h\273\3043\350\333\240\241-\264A\303_\375c-\f\203|\240S7\200\334l\311>\340&(\254\335\2667\024\210'\215\336R\330\315\207Z\fCm-\f?\360m\300\274\300\177\025\260\007\201\336e\361\345\277x\377\265\273\013\310\033 !\310\034\006\177N\376\027\003[\004\360\243\245\203\334G\334\303\237I\220*\362\013\177\256"
+	.string	"\002k\226-\356\277V\376\013\367\016\177.q\001(\377Uz\373\316\237\021p\215\236\3746\254\3103\374y\353\267!~K\200\337\206\360\333\024\334\332\376\313\203\355f\255\3756\314}R\373o\332\203\376\314\343\236\340\3449\177\246\372-\t\277\335\340\267p\277\365\340\267 \374v\257\001\277\375`G\370-\007\377\335"
+	.string	"\031\316\025\273a\377e\362_%\377\375\372\257W~\372\257\275H~{\301o\035\360[\023\277-\301\002G\004\360\237?[\370-\006\277\355\340\277\332\215\200\221\377\177\277\235Q\344v\375\227\002D\376\267\370\277\341\377"
+	.ascii	"\376;\344\277\0208\004\177\346\372\257\326\177{\374W\307\177"
+	.ascii	"\233\377\335\377\325\300\1773\360_\030\377U\376\367\370\337\243"
+	.ascii	"\377\022\377[\201\377J\340\277,\376\273\200\377b\360_\022\376"
+	.ascii	"+\302\177W\374\327\001\377\005\341\277\f\370\257\007\377E\361"
+	.ascii	"\337\r\376\233\301\177M\374\327\202\377\036\340\277\005\370\357"
+	.ascii	"\207\377\n\340\277\036\376\333\341\277\023\3747\350\277\021\374"
+	.ascii	"7\303\177/\374\027\350\2778\377\275\371o\372\337\373\333#\277"
+	.ascii	"\035\373m\232\337\236\375\026\315o\265~\353\343\267\017\370\355"
+	.ascii	"\231\337\226\371m\340o\225~k\364[\242\337\216\371\255\214\337"
+	.ascii	"\372\375\266\357\267`\376\263\370m\220\337\222\375\326\311o\313"
+	.ascii	"~\313\365[ \277\275\372\355\217\337B\340\177\340\377\262\377"
+	.ascii	"d\377C\370?\367\337\247\260\260\260\360\037\352\370w\\\374\006"
+	.ascii	"h\021CX\r^s\314\346lr\323Vm&\031\021i\360\252\234\037r3\212\220"
+	.ascii	"\245\251\274\373\334\264\340\270\371\205\316*%\\\344\266O\034"
+	.ascii	"S\f\032ns\203\364P\211m}\271\371=P\372\367\037\356\246s\357\235"
+	.ascii	"#\205n\347\322\316mj\355\207\237\307bK\301\377\374_\003\017\240"
+	.ascii	"{\311\316\317\214\376\232\322\344q\016\373\351\235\263)\252\305"
+	.ascii	"\334@K\212I\213\252)\252\265\231LG\230@\316\255\305l\212\356"
+	.ascii	"\r\264\231\230\230\035`m\240\246\350\226\3323\272H\331\r\325"
+	.ascii	"bn&\254\r\264\231v\223C\023\223\226TS\264)\005\324\024\325\222"
+	.ascii	"\332Q\255\375\263\231\232N'\246\355\004\332Q\255\300\035\305"
+	.ascii	"\222\372i\212bI5E\265"
+	.string	"\306\354\234\323\230,)p\361[\201\314\00661m\0347z4\235?wMP\254\315\267\267m\243\261\235\024\354\335\003\313\311\327\244\262T\226\356p,AibY\bn,mam\246\273&%X{+Y:\3327,`B\357\366\020{\307\004\322cC\321\330;\202\033{3\355\276\333{3\367\3367\316\036\320\275\255~\232\2367n\354]\245\341\306\356\301\204\243\261\367m\013CE\252)\272\205%\004\267\026}\356\032P\246}n>-\247\2162\3176T\031\375\224J\201\314\315}8\315\320\313\020\2700Z4\232\2737\346G\222*\032\237\361\251Q\304I\003\252%p\016\035\227\271\215\3422\027\013N\323\336940\223\352\233\032\334N\247\001\316\243\003\007\3564\247\244\340\335|\236'<F\360\351\f\026A\375'\346vi\247#`\350\374\372\322\266\2105o\306}a\364p\356\320\274U\335\254\206\273lXj\312N\350"
+	.ascii	"\3230Z\017\316\336ZuO=\f\305h=L\320-u\323\205\247G7\270\367\336"
+	.ascii	"\303|\030\214\215b=\234w\354\005\177\261im\234\230\350\214M\354"
+	.ascii	"L\321x\371\313\t\326\0175m\006el\013\256\303s\370\016k\301t\230"
+	.ascii	"\213\215b;L\345\367\013\216N\t[+\003\264\303R\256\235\275\023"
+	.ascii	"\262\001Y\023\2637\374D\216\f\016g\331\260\324\224\302\214\023"
+	.ascii	";\034\005?\261wU\320\235#g/+\317\252\247\214l\b\226\237\214\261"
+	.ascii	"\304Y/N5A\247\\\034\017\333\234U\363\312q\334\216 \2155Vp\025"
+	.ascii	"l\307\206\253\211\2538y\356\311U\301hHp 9s\363wh\350\353\254"
+	.ascii	"\321\327)\243\257\023F_\007O_g\213\276\016\034vc\313\221\206"
+	.ascii	"\307\227\26466\267\035B\266\316\330(fK\273(9\362\204L_'Lc\235"
+	.ascii	"\347\343\360\331\366\261C\2600\207\b\321\327\25123\222\343\244"
+	.ascii	"\304\004:)\333Y"
+	.string	"\253[\241\256\f\223Y\221\361qv\363\330P\213\023p\357\346\353\314\320a\030\f/\301Jp\023\314\304F\261\030\366:Nb\345\236\205\304\256\032\214d\312\322\034`\231/\273\347\234\020\273\206\241\317\033\266-.X\f?\257\035\206R\3215\322\266"
+	.string	"\326\r\311\253\303b\230\210\005cg`b\032|\364\320\264i\351\311\317\211\323;9h\3729K\360\021\033e\033\222s\245q\027.b\243\330\3107\217N\020*m\315\233c\334<n\370\034(}\034B}\234\274\0250W\032\335b\206\013\227]\273yuPKA\266\306\344\266\332n\306[\027ka \307[8k\207\t\212\267\362\336Mk;\364X\333!\2153\322L\033\346\343\324a\375\270\031\022\206\220\311\217_\355\030\0213c\307\315>l \2167)*\372V\016\260\020\0203a\250\034yU\200Q\302<\221\201\201\322\273|=L?\233i\353\3063\n\2315[\256\227\250\264(\3001\367\317\004\r'\316S^S\340\345#k\003X\346\n\332\273\266\016\344\b\001\311\260\363\252\031\024Z\203\367\206\245&\020\252\376"
+	.string	"1\017<\205\253\360\016l\205\243\360\r\254\002\356\201u`*\234\002\306\201s`)\033\305N\314<n\342\245k\270_\372.\037>sj\2664\033\330y\321\\B*i"
+	.string	"\235\327\357\376mXj\332M-\r\274\244\272\344\n0\034\244\302\246\t\207\214\237\234\370\210"
+	.ascii	"\211\252\200m`\247\234>\247*Wp\323\261\023\217\016\246\271'7"
+	.ascii	"\343\031\270\006O!aa\024\327\3004\260\21523Sn\206\222\355DEu"
+	.ascii	"a=N\005\270\261\272\233\2173C\247\233\212\036\324?\336\205\303"
+	.ascii	"\2663\2770\320\234do\n\2226\227\315\377=t\222'd\313\236\276\276"
+	.ascii	"\323\327q:\177\271m\005\246\271\203="
+	.string	"\364\306\234\236\350k5\335\244\354K\341\315\367\3145\323\363T\006H\227\233\257\301\3645\022}\315\245\257w\350k(}\275\244\377\373'\346\211\004M\314\315w>;m\306\362\262\b\365o\304\350\337\334\351\337X\371p\367p\230\240;\212\243W\306G\333\023\375\2332-\302Z\030\336\274$Pdc@\364m\364v\301K\343\336\230B\356\335\337\316\336\033p\035\221\257\350\315?s\355\376\343d\263\257*\256\233\357\334\245\263\321\001\334\272_.\266\315\323&tCo\027\033\267\264\233\357\r\017};\200!.,\264\003\030\376\306\251\017\275Y.\026\335DK\256\355f\271`7\247c7\025K\311\236\216\035\232\216M\260f\357\246\265\035|\254\336\262$\031\346\n\310\204\245M\302\302\256\264\207'&)\030\023!\317\007\2324\024\252C\345\312M\307\315\036\236_\251\222\257\334\304a\356\275\343\251\247=\\\361J\223x\345\346\305\302\3326"
+	.string	"3@\321\177\372l\362\274\021Y\002\202$\333\t\240\006\024\225#YK\216\030\026\227\021,\310\227\002\024\033i\021>\267\277\273\247\256L\347\343t\365\247\346\346"
+	.string	"\244BR\"\251\220t\210\2104Cp\274\276\266\240\220h\t\312\244@R )\227\335z\242z\016\332\035\202ahA\236r\341\255&*t\361\302\204\267\013\221(\333\315\317\340\324\023\f\246W\351U\252\365\026\004\007 \017\021\025\216\324\370\361T+\315B\363\004\247\227\205\225\351\240<}\t\322F\313\0305z\202,\351T:\225\366\260\"\005&6\270"
+	.string	"0/j<\236\366\300\204\232MH\223\275\233S\252\324\352\0130\310\224\324*\335q\267eJk\f\202\266-Ri\025\366\002\200\230\246(\200Q\360\326\242\350\351\t\302\230\23661\245:\260\336\316f\242\355\250\233)[\376\234\f\356\246\252\017:gOgxi\324S\035OS\030Q\342b\302\230\3505oNs\274\247\252\256\n\340\315O\235\251\324W\220(\030\233>\0024\332\224\224\324\315)\216\213Q\"\006*\360\346\364\306\343\252\366\006WH\241\270l\345-\335\234:\2456l\364s\351\323\207\316*\350n\353\251R\303m\016\252\277\001\373\271aJ\343i\215*WA\264\302\364\237\316\370qn\236\350\361x~\351c(\2429t\245\315\264\231n\373\003]\312\263zj"
+	.ascii	"\214\n\017Ks\370QX\230n\017_fXd\\\351\306h\303\031N\2044\321"
+	.ascii	"\241%\360b\303&K-\340\254K.\fjM\024\003\r-\001\217\301\301\254"
+	.ascii	"&\315/\243\301\363\242B\370\254F\177"
+	.string	"\031\\\343tsNs\273\256P}\021j\t\330\314\230\311\202\"\354\256\261\2665(\030\245\204\352\314\263\240]\323\241\005\215k\214\226\240\356\357/\223\371P\006\327%\207s#\353\314*\007>\223\331\t\222Wd\013p\007\312\334\177\200cp\310\370\3651\365,\361x\256\260Es\300\021&L\366\323\240w\231\232\030 \206#RH\330\367\354\227\303\305\203I\026\205s'(\330\366DO\340\204\207\227\3714`1\0035\210\313\002\023\273\301\002\245:\263\367\314\227\243\312\300\320\340n\316z\030\311\216\016.m\244\334\234\277`\300-&\346\345\346\354\345z\3118\322\266\236n\316y\227\357\206\006\034\025\025n\316].\241\002\3008\005\257\240\316X\027B\2761\315a\n\027.\331N\250\213\331U\030\216\217';\340\354\354r\272\316hd\r\321\034\322\346\3462\335\220\255J\2270\235\252929\272\313\027\006\354\016\311\315\2770Cs"
+	.ascii	"\033\212{\\\326b\321vTN\024\232\331\325\207\213$\t\224\333\263"
+	.ascii	"\226\234\305\307\212\232\272\251\2333\026\235\271*J\n\263d9\013"
+	.ascii	"m:(\207\025+g^\272\202\036pp^Y\230\255\315L\336\315\2670\245"
+	.ascii	"\203\b\207\236\247L\301\204)v3\207\2112<\0134t\005[Q\242`\266"
+	.ascii	"\254\276\2510\0353lJf\230\321\025\020y\313P\336|x\371\244\225"
+	.ascii	"Y\303\204\213\006b\016=\273\271a4\251\234\031d\276\006q\242\024"
+	.ascii	"\272\3051\321?\\C\317l\267\321\314\206\0077\250B\333\314\033"
+	.ascii	"1Rzt>c{X\212x\351\n\342\324\256\226\233zS\005\352l\331\261\035"
+	.ascii	"\260\322\034\310\f=\243ehN\303d\354\316\261\255\223\022/+@\007"
+	.ascii	"p\350;\260\3112\224,\233\315\225ehY6\023\034\246\300\324n^\360"
+	.ascii	"\2728y6\353!\213\003L\203\311\020\343\210\f\372\351\003\301\351"
+	.ascii	"\2401bbep@d\372L\230`\266\341\336\026\212\025\345\344P\b\226"
+	.ascii	"\303\3000\233f\356\rAaV\325\007\022\376\254\2367\037\b\210>\320"
+	.ascii	"\f]A\333P6b3\222\257\254\304\256\351\375\274ys\342\0028\250+"
+	.ascii	"\360z\346\257gNb\267\223\307\231\227\215\346$\351X\025(\225]"
+	.ascii	"K\267\004\375~\370\364\177\264\350[\2736\fr\033z.RD\212\016\262"
+	.ascii	"\033z&B\004\227m\211(\363J\323\035\320\204\b)\363cD\0079\031"
+	.ascii	"z\346\342\262k\0326\223\f\207\261,(\035\3645\224\265l\006\002"
+	.ascii	"\004sy\030\223\372a\342\032\006\t\031\302[6g\331h\316\302[\032"
+	.ascii	"63PD\223@A\035T\343\307\017/;MA\215!\234es\217\314#\373\300["
+	.ascii	"\271\003\226\263(\372>Mt\2071UU\331J\357\275\305\210=w<[\345"
+	.ascii	"<3=>\276!\227\2505\2047\337'\210\246`mj\n\263\305y\371\244\240"
+	.ascii	"\203\256\f\345\0346\353\210f\035\370\0076Q\226\345cC\337\342"
+	.ascii	"\037\303\016O\362S~\312Rv\007\226\bt>K\245^\242\266\256n\316"
+	.ascii	"P9*\207\251\314\024\253\250g\034Yp\314u\371\310VoW\264\344\033"
+	.ascii	"\230\271s\025\304j\217\320gM"
+	.string	"`\230/>\355a0;e\247Bf\217\025m!\307\320s\215\333h\256\201\0053\023\332f\256c\250\236\203{W\031@7\311\326\230d:\310\307P^\262yF4\317\270|)v3\207\207&pP\003\274'\210\276\275|\303"
+	.ascii	"D\005K\325\250\270\\\252+,@ CYD\0329X.U\242\2442I\203\205\037"
+	.ascii	"\007\324\245\361X4^@\221\341\004\006\031\253\221\250\230TD\321"
+	.ascii	"a\005\n\bPH\206\240T\215\214\214\312\026EG\245\344\321rC\007"
+	.ascii	"\022\024!\215/.\214\240\"\215HE\027~\004b]\206P\213\224\216D"
+	.ascii	"Hc\b\345R)D\206\343Q\t\211L\"oV\242\212\001\343r\210BRy\264&"
+	.ascii	"\2217/\212\3521\257\352\022IE\032\252F'\220(\024\225\035\034"
+	.ascii	"\235X\261\252F:*\013\235\242b\216\021\322\270\032\213\020\210"
+	.ascii	"Q\202\272L\036\211|X \325\244d\317\003\200~\004b\2714\036\217"
+	.ascii	"F\244\341\217@\004\251D\027=\352\252\032\371\254'\212\226J%\242"
+	.ascii	"\b|V#\322\250*_`\370\021\210\242c\362(\304zdd<\276\350\2204*"
+	.ascii	"\2130\322\254.\221\311\244\245Z\302\212\023\036\250\312b\222"
+	.ascii	"\252\034Ag\004\b%\217\005\365X\204,\036EP\204\364\340\001\021"
+	.ascii	" Ve1\t\204\332\242E2\005\221\004;,|D\200X\252\253Q\t\201\036"
+	.ascii	"\"%\n\243\345\212\034\f+R)\211\"\331b\251\256280B\032\325\022"
+	.ascii	"8\030-W\334\030!\215EH\225\305\022\004\236\365D\213\026@B \326"
+	.ascii	"\245\252t\001\265\004e\362\003#\244\361\204d\362h\241\270\026"
+	.ascii	";`q\002\221z\204\302B\tGK\245\343\013 \275*\213K\023\220\"(\223"
+	.ascii	"\037(O\234\240L\242\320\301\204\013H\352\272\224\301\"\203\212"
+	.ascii	"dl\221b]\026\217\031\226Jkqe!C\251\256k\221\003u-\026%)i8\221"
+	.ascii	"Q\251\"U#}\013.@\300\005&b\334\334D\006\"2\0201\274\211\f\204"
+	.ascii	"\2042\270@H\377\002!\254*\213G,\326\023\251F\305\345R]\261\342"
+	.ascii	"\204\007=+qi\202\212d\\\265J\274\260$\016\327\037\201P\252\253"
+	.ascii	"\2124\001\212\013\352Z<*\021\035\213"
+	.string	"D8K\"\f\265\003\234UI\313(\036\325\"b\222\222^\327$%\255\\G B*}\220$\002O\222\022qU\215\2060\324\"\274\036O$\225E\016nnT\245\322ZT\252IHj\213\244\262\350\302gu i|\340\001\007NX\026W\020!\225^\354\250D\0202$-\221b\250EH\020\324\265\250$\306H\2728\201\250xt\221\341\230Lr@L\327\037\201\baT\026)\327\021\202\220\212\312\017b(}\226\304\235\007\254\312\344\b?\352\321E\261\005\214\241R5\2760\256H\265\310\230\263\022\325\242\344\212\034\265(\211\224W\242\b<Kd\322\270&%o\324\265XB\221R\321\205V1`d\241W\255\334)*\252)V\342\b\022Gc\261\205R}\361B\211\203\030\353\216r\035A\205aT\211\324\022\216E\243R]jX\211\027\b\351\023\210\212.\216\307\"\212\030\312\234\365G\033\222\222\353\022gId"
+	.ascii	"\213\025\304\025'< \266h!B\212\036u\225\341\202\270*\213\353"
+	.ascii	"2\207\210TTy\226I\252\352\202h\2044\"\225E\024x\212\214Der\211"
+	.ascii	"T\2278B#\212<*\210B#HXP\342\002\f\204F\220\260\240\304\005)\210"
+	.ascii	"\030\334\250H!\244"
+	.string	"b\204\217\320\210$$uMU\244 \036\2139*R\020W\244\252T*\021\341\250HA\354Q\221\202\230T$\"\256k\321E\216\212\024\304%\tu-*] \031\217D:*R\020\221\222\224)\322\210D\244.\211DF\345J\244\036\325\035\025)\210E\252\232\264\274\371\021\210\016\017\261&\223\312\020:K\242\221\361\0052\211\002h-\376\250EJ\253\321\b\231T\021\303\370A2\204e\222\021\320\021\321jDa\371\243Ta \215D\0131\324c\222R\007/\216\305\024K\037\225\370\001\212e\022\0030\254E$e\362\005Q]\213Hc\2212\231$R\211\253\021i\202\316jD*\345 \223\306\245\221HU&]X\026_\300 \3128a\251|\361\300\261\bC\251\256H\020\212\220JI\026H\312\342\361D\206\026\313\023KU\351X|@\2211\351\302J4\261\"\215J7\027\272\200\204\t\027\026\274 \001\342\347\tH"
+	.string	"\n\016&\204\300"
+	.string	"M\004b]\223G!d(W\025I=\252k\b\244\261\210\024\202H\271\f\001\002"
+	.ascii	"\252Qq=&a\020\217G\225\210\270*\223I\252\322\002\0302:thk\344"
+	.ascii	"\370\262Y\0332jp{\331*\352\227\206\315\315\035\200\344\245zy"
+	.ascii	"\351\0275p^\236~\3419\243v\347D\203\233\246`\017/\355\202\207"
+	.ascii	"\331J4\201\323\260Dw\240\252K\357\352R;\034\247s#\200\315\240"
+	.ascii	"\324]\231\233\317EP\356j\315\315\327\300\203.\345\322Ik\022\262"
+	.ascii	"cNM\317\231+0\256-R:e\312D\321nN\261\340\r\244Xn\252%\315\362"
+	.ascii	"\024\313\241\326v\270\341\013kj\0163\005R\342R\271\270\234\344"
+	.ascii	"n\266.:@\rMM\301\030+\351\025+\230\355\251\r\360OS\200FJZEJ"
+	.string	"\ng\227H\365M\205Qy\n\247\203\007\206+\314\315\351\024\314u\303\253\311V\027%\223\311\251bs\244\016J\026\034\241\367\274\361\226\371\354\322\222(\222'\251\216\236;\263\302!n\2300\354\212\263J[\332C\017I\023\213\262\245Zl\203f;n\016@Y\252\226\256\245j&\340\365M\205=\321\001P\203\246Qh\232f\201\231W\212\3664-\315\312\b\222\233\323\263\2741\324 \334\335\037X\222\375r\202\374\321=\323\301\272>\301%i\272\241\254\224\005\205N\250\343B\024r`\3279\245\240B#B$M\222\306\243\025@P`L&\230,\224\316\003\023\200O\310\263\232\036\211\025S$\"\"\222$)\225\3323PPi'\362\356\005\344\361\337$R\276E\242\rC\336\320^\370\004\210\177\0215+\bw`z\263\037\212H\021\245$\225\234D\212'\236\"\246\246\260t\202\025\311c\221\372\224:\253xC'M\346\017"
+	.ascii	"\r\303\027\235\250J\026.v\331O\327\257\027\303\331\314\374\f"
+	.ascii	"\034n\305|U\001<N\350\36681D\246H<\316\002\263Tw\274\222\344"
+	.ascii	"\317\003\356\243S\314i\212\377\003\344\2515'\352\3175\266\017"
+	.ascii	"\027$\224\303KWoA\357\272u\"2\327q\272\272\371\f\254k\204aZ\235"
+	.ascii	"\375\003\373\254\212\034H\346\030\252\032\353 '\317/\006\r-\020"
+	.ascii	"\320\260J\007R\221\037.\321b\323\006]c#\225z\234-\230\b\341\301"
+	.ascii	"\227D\216\372W\037DB\033\276};\346S\344\364\256G\374q\033&\377"
+	.ascii	"D\004T\022\255\324.\017\3615Z\030@\246\210!.N\343\236\361\324"
+	.ascii	";naQ\325\301&\213\311\304\223\334\006-\275co<\266\363\367\002"
+	.ascii	"&6\222\255\360\275\363#\264?l\212\253\250J\342m^\n\225\301;\311"
+	.ascii	"\313\203P.\270*\202y\t\362\350\336\t\211\311u\303\256\334.\265"
+	.ascii	"\210\362\245\217#C\275\364\253\243\271\273r\231)^\322\351\360"
+	.ascii	"6?R\177\240\f\202Ai\263p\\\021p\027\343;l\\-=\025Df\333\036\233"
+	.ascii	"\277Y\237\203\026\002\266R\0239\330\207PH\266.\251I\234g\273"
+	.ascii	"A!\263\235\332\245p\262\233A\267\007x\rCM\215_\306n\261\376\334"
+	.ascii	"\351\216\242\007\363P\347\271\346cA\217#|1&\266\223"
+	.string	"\357\223\3563\201\377R\023~\026\035tL\377\227\327\314\020]|\206\f\334}\326\2246\211\307\036\030\251!\214\001\224\213\223\204\371!B\264n;!c-\266\257\035\363s7}\225;\026\266\364\222`EO\"\374\271\305#|aN\365\f\025g"
+	.string	"\255\354\004v\206\250\342s\306D\272.&|Q5\340\3734K$\311\332\313\353\036sm3\035~\004iS_\204\3232\325\253"
+	.string	"\351=\016"
+	.string	"]t\300\"\260\201\261\251\036\365e\240\213\216\315/\210\2172 ac\201\202\276\264Js\200\3546\315\214\020\003\344\226\233#\213\217,\202\273k\364\313\037\222jd\351\201\276F@\265e\211\362?GN\321+\230\370\205K\036:C*\262\253Wl\361=BRo\360g,\001\202\317\346\231\240W\270"
+	.string	"\036\025a\031H]\271\353\007\253,J\345\311\004\255\313\346\233$\373\247Lv\346\377]\353{i\336?\300A\307\232\220\306\217\304\313tx\3709\236\342\002\342,\033\217\205\001IM\231\252]\362]\005\344\267\b\\\351+d8BN\241q\313\345\210\232n\177\342]0\375\302\b\373\376BC\224Ui\231\2141y\214-\275\232.P\226\265K\270\343-\031fa\233\034\021SsIh\342\033\271\361\256.\317?\340\304\263\316,\376\372\3532\204\272=\216vz\231\226\333.\020u\337\354\036\022\013\373\274\222w\026\253\321m\341T\352\335\321\325\331\243\334\2744\250\035\023\313\022\313QU\221\251v\235/D1\210\226[\300\223\177\310P\037l+K\367\t\251I\232\260?\264Iv7\376\204\217\260P^*j\031\275r\355\264\272\316"
+	.string	"p\255\376\257\005$x{,\210\005p\335\350\024e\376\246z\300P*\200\364\fq/`\340Z\373\"\2704_\200\"\305M%!D\251\212K\200\002\265\261mUH\306 \253"
+	.string	"t\236\265\263B\212I\r\255]\300\314\314\330u\334\233\237\250\310\246\016R\333AH&\205I\371\034l\356\317\005\3608{\353{\026\036\320\334o\005\235\231c\033\244\331\234\016HNx\037#\234\250\210f\006iR\311\002\366\226\006\216\242\204{\263\307`\306\205\353\274Ie\034\264\370\373\315#\370\307\273\313\344\271\331Y\004\"\214\351\227<\336\024\267yt\n\372\324\005?i<<\331\203\321!\333Q\031\352\303M\307\360xxj\335\204d\007\r3\372"
+	.string	"\211\377\243\002Bbm\301\344\261\212\310vC6n\306\025\336)\0338\327\232\266>\325&0c\301^\236\200\304e\363\274\330\372\335n\234\002\2611(\323\317\037m\002A\342\357\237g%\214(A\234\314\325\223\304\235=\255\313H\264\337\030\223\214\257\2512\364\341\215dw\001\314\371\236\3167\2468\262\312\177\333\232e\272#,\275\204\016\252\017\026\220\317\031.\013\222\340S\351\n\366\025#C\231d\230T(\301\246\226\230\220V&\336\231\tE9\341\205D\350F'\302P\257\224\037\232\006\310T\333\0040\035=\004\034\300\365\004\r\366\300?\227\035ju\r\224e\363(A\215\001\267K\232\301\342`U\2246\006,h\270\213\220\352\315\2764"
+	.string	"\003\372\017*\317S\016\244\001\235Mv\0054\203^\022@v\275\235J\240q2\222\005Cp"
+	.ascii	"a7\2070D\267\r\026\315\224P\375x=Oe\325e\263\005\bc4\036y\375"
+	.ascii	"\301\210\240w\361xa\240Z\007\240>\233\260\374\b\227_rz\312X}"
+	.ascii	"\211\234\2466\"=$;\235\326%x\326\211\324\2447%\311\254\347\020"
+	.ascii	"\242?'\325\225F.\\\252hg\"\255\252E\3561\367\3722\267\242\262"
+	.ascii	"\313\366\235\272\260\345D\300W\304\361{\213\223\2759\231p/-\033"
+	.ascii	"\024\250\242\016\363\241Y\322>~\345(:j5A \334\316\334\005\340"
+	.ascii	"\276\243D\023\2111\003\207|\362\245\\\001p\343u\bQ\267\003\347"
+	.ascii	"R\t\020\313w\362\313!\375+\214\025\220p\255\211\\\242O\351oX"
+	.ascii	"\032B\2634\304$\223}\371k\002\301%\316\261\231\300y\217>2\325"
+	.ascii	"~y\260 )\366g\r\005\001\006\210\324\250\305~!m\030\006\034\273"
+	.ascii	"{\345x\030\r\"\f\212]\237\367\227vR|2\235I\210$\2420\242\204"
+	.ascii	";\365\317_\202=c\212\242\214b\025\316\267\325\207\212]\234\026"
+	.ascii	"\r\301\352OM-\003.\353\346\357!bw\r\001\265\204\262I\320\004"
+	.ascii	"d\277=\255Fc\325\202I\351\306OZ\205\324v\022\377\343?\357\246"
+	.ascii	"h\223\312\326Tn~\351n1\026\277\020-:\352\261\233\260\303a\240"
+	.ascii	"\231\310k\3737\322\b\2061`\351<\215\006\332L?\345\256&\216\f"
+	.ascii	"\240Hz\347\372\337\204Px\232 \\\214&\233&\227\236\374\033\207"
+	.ascii	"\352L\2021\312n\030?jE\301d\220\177\005\317\037\004F\373\204"
+	.ascii	"\243\250\230\276\277\346(."
+	.string	"Mo\245*\364*\001\240\302\274\032\342\001\305ZHBK\f\377~\363\223A\376\274\263k\310\322\234\333'\376 \347\\\247\022\227\264K\233\202L\223\300u\234\260\314\030\2354\230:\005.p:\244\321K\227\374+\205\017\035\bq \236\001\220\252\314/\2276\236Y\327\257O)p\007\205<`\326\342\264\267YW\337r\220\023\201\314\317\226\217\022\375\311A\033|\030\235`P\260]1\211%/\307}0\356\251\353\253\037\3522\331\241\315\222Q\f\016\242\234\230\354QT\353\317qg\305(\346#\345\214\351\240\2175\372u\251\230\225\262\375\356T\233G\201\002\257\022U:z\265Sy\t\351\323\323\306\321\205>\312N\235\335\006\372\336\023\265tK\035\275Be7;x\213Kp\310\265N\261\212k\326\177\315.\225\203\362\004\235vX;\320bE*\301\357\217\326\360Q\016\026E\205 \031\337\355\364G\3427\211\003R\277\345\252\225"
+	.ascii	"X\250K\213\022+\307\267\r\373\360c\355^\"\277\253\367\"K\017"
+	.ascii	"o\326\232\366\331\024}&\030?Y\342UZL\263\202\214\324w\224\032"
+	.ascii	"\257\253\342\242n\322\r&\255N\325\2150E\023?\211\244\002<\017"
+	.ascii	"\303\270\346\037}z\327\031b\354\036\032\300\277/\234gx\275\300"
+	.ascii	"Wr@\307\333\033\373\377\250\327\331>\267j\237v\177Y<'Q\376\216"
+	.ascii	"4\347e\265n=t\272\214yV\025\320\344A\002\242\031\226I@\232\240"
+	.ascii	"\007\f \353\372d/\272^eK\263MZ\241\336!3\262wJ\177\201\224\312"
+	.ascii	"\200|;J@K^\346"
+	.string	"\204B\362sG\337\360\002{1\374S\325\313OR\361\247\204N\200!\331\340\243\035\305\364\347\330j\270\357\035\b3\345\221\312Kw\022\2522\321\201\023\234\224\203)f\357.\032]Y\\-en\212\330\257\201\323HCn\352\365\254E\024\004\374\304\346\2604\353\327\240\243\245\365u\352x\367\341\327)\357\310\263\212T\250\003\372\016\256^@\260v\361\337\266\232\277\207n|\270\255f\227?q\340/\256Y\337.\274?\315s\036\334\224\322\323=\225\237\275t\177B\313\314}\307\365\276\341&\374\031\321\0230S\252\325\306\305\270T\254'\021\313X\216I\225e\251\177`\203/\277Aaw>\351+\235\027h\3751\322\013\001l\331\316`\036\240\376jb\020\335[\310v\264\311\200\374\257\255y\257y\373\325\356\021\364:\344\350\307\027p\342L7\271\321\234u^\201J~7\256`\275\333V\013\\\347qu\315\r_\247=\275A\331"
+	.ascii	"\372\261\3551\203\t\342\033\330\360\211\346~\206\257\224\r\235"
+	.ascii	"\226k\351[\366\217\370F(\177^~\311z\353w*\f\013\263%\361a \013"
+	.ascii	"]\373\267\266\365\373e"
+	.ascii	"\355N\253\255\264a\214\241qn\037\357\235N\337t\322+Q\323\230"
+	.ascii	"\233\341\036d\216\334e\264\311\313\b\333\323g?\206L\303\235:"
+	.ascii	"{+\307,o\333\206\031'My\372\016\305\246\330g\353\001\362\243"
+	.ascii	"\302\241_\370\026`\261\245\361\206\377\331\217\037C\306\345\246"
+	.ascii	"\312H\252t\005\243\223\247\331\211\245\205\372i\177\304/\244"
+	.ascii	"Fj\351\353M'=\\\300\357\376i\361\236\035FP\336\324\322\344\316"
+	.ascii	"H=\377\352\304\277\273\260\216\216v\\\r\257\316\250\033uOW"
+	.text
+	.section	.gnu.lto_.symtab.45e8a6595cc5f0c3,"e",@progbits
+	.string	"hottPrepareEAMResponse"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"freeHoTTTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"initHoTTTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.string	"configureHoTTTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\002"
+	.string	""
+	.string	"checkHoTTTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"handleHoTTTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"vario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"getBatteryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.45e8a6595cc5f0c3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
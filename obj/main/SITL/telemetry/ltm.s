@@ -0,0 +1,13500 @@
+	.file	"ltm.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/color.h"
+	.file 5 "./src/main/drivers/resource.h"
+	.file 6 "./src/main/drivers/serial.h"
+	.file 7 "./src/main/fc/runtime_config.h"
+	.file 8 "./src/main/sensors/sensors.h"
+	.file 9 "./src/main/io/serial.h"
+	.file 10 "./src/main/io/ledstrip.h"
+	.file 11 "./src/main/rx/rx.h"
+	.file 12 "./src/main/flight/pid.h"
+	.file 13 "./src/main/flight/imu.h"
+	.file 14 "./src/main/telemetry/telemetry.h"
+	.file 15 "./src/main/telemetry/ltm.c"
+	.file 16 "./src/main/sensors/battery.h"
+	.file 17 "./src/main/flight/failsafe.h"
+	.file 18 "./src/main/drivers/system.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	ltm.c.abf0db70
+	.weak	ltm.c.abf0db70
+ltm.c.abf0db70:
+	.long	0xc3b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1e
+	.long	.LASF1951
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1688
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1689
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1690
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1691
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1692
+	.uleb128 0x5
+	.long	.LASF1693
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.long	.LASF1694
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1695
+	.uleb128 0x5
+	.long	.LASF1696
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1697
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1698
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1699
+	.uleb128 0x5
+	.long	.LASF1700
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF1701
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xa
+	.long	0x9d
+	.uleb128 0x20
+	.long	0x9d
+	.uleb128 0x5
+	.long	.LASF1702
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1703
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0xa
+	.long	0xbf
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1704
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x15
+	.long	0xf6
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1774
+	.byte	0x4
+	.byte	0x4
+	.byte	0x34
+	.byte	0x10
+	.long	0x125
+	.uleb128 0x11
+	.string	"h"
+	.byte	0x4
+	.byte	0x35
+	.byte	0xe
+	.long	0xb3
+	.byte	0
+	.uleb128 0x11
+	.string	"s"
+	.byte	0x4
+	.byte	0x36
+	.byte	0xd
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0x11
+	.string	"v"
+	.byte	0x4
+	.byte	0x37
+	.byte	0xd
+	.long	0x9d
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1708
+	.byte	0x4
+	.byte	0x38
+	.byte	0x3
+	.long	0xf6
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1709
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x12
+	.long	0x91
+	.long	0x14d
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	0x15d
+	.uleb128 0x3
+	.long	0x15d
+	.uleb128 0x3
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0xa9
+	.uleb128 0x4
+	.long	0x14d
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x14
+	.long	0x28e
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1760
+	.long	0x30
+	.byte	0x16
+	.long	0x2af
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1760
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x3
+	.long	0x28e
+	.uleb128 0x17
+	.long	.LASF1761
+	.long	0x30
+	.byte	0x1c
+	.long	0x306
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1761
+	.byte	0x6
+	.byte	0x2f
+	.byte	0x3
+	.long	0x2bb
+	.uleb128 0x5
+	.long	.LASF1772
+	.byte	0x6
+	.byte	0x31
+	.byte	0x10
+	.long	0x31e
+	.uleb128 0x4
+	.long	0x323
+	.uleb128 0xb
+	.long	0x32e
+	.uleb128 0x3
+	.long	0xb3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1773
+	.byte	0x6
+	.byte	0x32
+	.byte	0x10
+	.long	0x162
+	.uleb128 0xd
+	.long	.LASF1775
+	.byte	0x50
+	.byte	0x6
+	.byte	0x34
+	.byte	0x10
+	.long	0x40b
+	.uleb128 0x2
+	.long	.LASF1776
+	.byte	0x6
+	.byte	0x36
+	.byte	0x24
+	.long	0x4ba
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1777
+	.byte	0x6
+	.byte	0x38
+	.byte	0xd
+	.long	0x9d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1778
+	.byte	0x6
+	.byte	0x39
+	.byte	0x10
+	.long	0x2af
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1779
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x13
+	.long	0x306
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1780
+	.byte	0x6
+	.byte	0x3c
+	.byte	0xe
+	.long	0xbf
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1781
+	.byte	0x6
+	.byte	0x3e
+	.byte	0xe
+	.long	0xbf
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1782
+	.byte	0x6
+	.byte	0x3f
+	.byte	0xe
+	.long	0xbf
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1783
+	.byte	0x6
+	.byte	0x40
+	.byte	0x17
+	.long	0x4bf
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1784
+	.byte	0x6
+	.byte	0x41
+	.byte	0x17
+	.long	0x4bf
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1785
+	.byte	0x6
+	.byte	0x42
+	.byte	0xe
+	.long	0xbf
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1786
+	.byte	0x6
+	.byte	0x43
+	.byte	0xe
+	.long	0xbf
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF1787
+	.byte	0x6
+	.byte	0x44
+	.byte	0xe
+	.long	0xbf
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1788
+	.byte	0x6
+	.byte	0x45
+	.byte	0xe
+	.long	0xbf
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1789
+	.byte	0x6
+	.byte	0x47
+	.byte	0x1e
+	.long	0x312
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1790
+	.byte	0x6
+	.byte	0x48
+	.byte	0x23
+	.long	0x32e
+	.byte	0x48
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1791
+	.byte	0x60
+	.byte	0x6
+	.byte	0x5a
+	.byte	0x8
+	.long	0x4b5
+	.uleb128 0x2
+	.long	.LASF1792
+	.byte	0x6
+	.byte	0x5b
+	.byte	0xc
+	.long	0x4ea
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1793
+	.byte	0x6
+	.byte	0x5d
+	.byte	0x10
+	.long	0x503
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1794
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x10
+	.long	0x503
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1795
+	.byte	0x6
+	.byte	0x60
+	.byte	0xf
+	.long	0x517
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1796
+	.byte	0x6
+	.byte	0x63
+	.byte	0xc
+	.long	0x52c
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1797
+	.byte	0x6
+	.byte	0x65
+	.byte	0xb
+	.long	0x540
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1798
+	.byte	0x6
+	.byte	0x67
+	.byte	0xc
+	.long	0x555
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1799
+	.byte	0x6
+	.byte	0x69
+	.byte	0xc
+	.long	0x575
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1800
+	.byte	0x6
+	.byte	0x6b
+	.byte	0xc
+	.long	0x585
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1801
+	.byte	0x6
+	.byte	0x6c
+	.byte	0xc
+	.long	0x585
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1802
+	.byte	0x6
+	.byte	0x6f
+	.byte	0xb
+	.long	0x5a3
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF1803
+	.byte	0x6
+	.byte	0x71
+	.byte	0xb
+	.long	0x5bc
+	.byte	0x58
+	.byte	0
+	.uleb128 0xa
+	.long	0x40b
+	.uleb128 0x4
+	.long	0x4b5
+	.uleb128 0x4
+	.long	0xae
+	.uleb128 0x5
+	.long	.LASF1804
+	.byte	0x6
+	.byte	0x49
+	.byte	0x3
+	.long	0x33a
+	.uleb128 0xa
+	.long	0x4c4
+	.uleb128 0xb
+	.long	0x4e5
+	.uleb128 0x3
+	.long	0x4e5
+	.uleb128 0x3
+	.long	0x9d
+	.byte	0
+	.uleb128 0x4
+	.long	0x4c4
+	.uleb128 0x4
+	.long	0x4d5
+	.uleb128 0xe
+	.long	0xbf
+	.long	0x4fe
+	.uleb128 0x3
+	.long	0x4fe
+	.byte	0
+	.uleb128 0x4
+	.long	0x4d0
+	.uleb128 0x4
+	.long	0x4ef
+	.uleb128 0xe
+	.long	0x9d
+	.long	0x517
+	.uleb128 0x3
+	.long	0x4e5
+	.byte	0
+	.uleb128 0x4
+	.long	0x508
+	.uleb128 0xb
+	.long	0x52c
+	.uleb128 0x3
+	.long	0x4e5
+	.uleb128 0x3
+	.long	0xbf
+	.byte	0
+	.uleb128 0x4
+	.long	0x51c
+	.uleb128 0xe
+	.long	0x131
+	.long	0x540
+	.uleb128 0x3
+	.long	0x4fe
+	.byte	0
+	.uleb128 0x4
+	.long	0x531
+	.uleb128 0xb
+	.long	0x555
+	.uleb128 0x3
+	.long	0x4e5
+	.uleb128 0x3
+	.long	0x2af
+	.byte	0
+	.uleb128 0x4
+	.long	0x545
+	.uleb128 0xb
+	.long	0x56f
+	.uleb128 0x3
+	.long	0x4e5
+	.uleb128 0x3
+	.long	0x56f
+	.uleb128 0x3
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x574
+	.uleb128 0x21
+	.uleb128 0x4
+	.long	0x55a
+	.uleb128 0xb
+	.long	0x585
+	.uleb128 0x3
+	.long	0x4e5
+	.byte	0
+	.uleb128 0x4
+	.long	0x57a
+	.uleb128 0xe
+	.long	0x70
+	.long	0x5a3
+	.uleb128 0x3
+	.long	0x4e5
+	.uleb128 0x3
+	.long	0x138
+	.uleb128 0x3
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x58a
+	.uleb128 0xe
+	.long	0x131
+	.long	0x5bc
+	.uleb128 0x3
+	.long	0x4e5
+	.uleb128 0x3
+	.long	0x32e
+	.byte	0
+	.uleb128 0x4
+	.long	0x5a8
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x15
+	.long	0x5e6
+	.uleb128 0x1
+	.long	.LASF1805
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1806
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1807
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1808
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1820
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x22
+	.long	0x644
+	.uleb128 0x1
+	.long	.LASF1809
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1810
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1811
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1812
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1813
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1814
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1816
+	.byte	0x80
+	.uleb128 0x9
+	.long	.LASF1817
+	.value	0x100
+	.uleb128 0x9
+	.long	.LASF1818
+	.value	0x200
+	.uleb128 0x9
+	.long	.LASF1819
+	.value	0x400
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1821
+	.byte	0x7
+	.byte	0x30
+	.byte	0x11
+	.long	0xb3
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x36
+	.long	0x67b
+	.uleb128 0x1
+	.long	.LASF1822
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1823
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1824
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1825
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1826
+	.byte	0x10
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1827
+	.byte	0x7
+	.byte	0x42
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x14
+	.long	0x6b2
+	.uleb128 0x1
+	.long	.LASF1828
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1829
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1830
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1831
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1832
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x1a
+	.long	0x6d1
+	.uleb128 0x1
+	.long	.LASF1833
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1834
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1836
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x3
+	.long	0x6b2
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x20
+	.long	0x743
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1840
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1841
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0x80
+	.uleb128 0x9
+	.long	.LASF1846
+	.value	0x200
+	.uleb128 0x9
+	.long	.LASF1847
+	.value	0x400
+	.uleb128 0x9
+	.long	.LASF1848
+	.value	0x800
+	.uleb128 0x9
+	.long	.LASF1849
+	.value	0x1000
+	.uleb128 0x9
+	.long	.LASF1850
+	.value	0x2000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1851
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x3
+	.long	0x6dd
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x31
+	.long	0x7bc
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1866
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1867
+	.byte	0xf
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1868
+	.byte	0x9
+	.byte	0x42
+	.byte	0x3
+	.long	0x74f
+	.uleb128 0x12
+	.long	0xcb
+	.long	0x7d3
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0xa
+	.long	0x7c8
+	.uleb128 0xc
+	.long	.LASF1869
+	.byte	0x9
+	.byte	0x44
+	.byte	0x17
+	.long	0x7d3
+	.uleb128 0x6
+	.byte	0x5
+	.long	0x70
+	.byte	0x9
+	.byte	0x47
+	.long	0x839
+	.uleb128 0x23
+	.long	.LASF1870
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1873
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1878
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1882
+	.byte	0x9
+	.byte	0x54
+	.byte	0x3
+	.long	0x7e4
+	.uleb128 0xd
+	.long	.LASF1883
+	.byte	0xc
+	.byte	0x9
+	.byte	0x69
+	.byte	0x10
+	.long	0x8a1
+	.uleb128 0x2
+	.long	.LASF1884
+	.byte	0x9
+	.byte	0x6a
+	.byte	0xe
+	.long	0xb3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1777
+	.byte	0x9
+	.byte	0x6b
+	.byte	0x1c
+	.long	0x839
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1885
+	.byte	0x9
+	.byte	0x6c
+	.byte	0xd
+	.long	0x9d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1886
+	.byte	0x9
+	.byte	0x6d
+	.byte	0xd
+	.long	0x9d
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1887
+	.byte	0x9
+	.byte	0x6e
+	.byte	0xd
+	.long	0x9d
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1888
+	.byte	0x9
+	.byte	0x6f
+	.byte	0xd
+	.long	0x9d
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1889
+	.byte	0x9
+	.byte	0x70
+	.byte	0x3
+	.long	0x845
+	.uleb128 0xa
+	.long	0x8a1
+	.uleb128 0xd
+	.long	.LASF1890
+	.byte	0x6
+	.byte	0xa
+	.byte	0x7c
+	.byte	0x10
+	.long	0x8cd
+	.uleb128 0x2
+	.long	.LASF1891
+	.byte	0xa
+	.byte	0x7d
+	.byte	0xd
+	.long	0x8cd
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x9d
+	.long	0x8dd
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1892
+	.byte	0xa
+	.byte	0x7e
+	.byte	0x3
+	.long	0x8b2
+	.uleb128 0xa
+	.long	0x8dd
+	.uleb128 0xd
+	.long	.LASF1893
+	.byte	0xb
+	.byte	0xa
+	.byte	0x80
+	.byte	0x10
+	.long	0x909
+	.uleb128 0x2
+	.long	.LASF1891
+	.byte	0xa
+	.byte	0x81
+	.byte	0xd
+	.long	0x909
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	0x9d
+	.long	0x919
+	.uleb128 0x13
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1894
+	.byte	0xa
+	.byte	0x82
+	.byte	0x3
+	.long	0x8ee
+	.uleb128 0x14
+	.long	.LASF1895
+	.byte	0x99
+	.byte	0xd
+	.long	0x930
+	.uleb128 0x4
+	.long	0x125
+	.uleb128 0x14
+	.long	.LASF1896
+	.byte	0x9a
+	.byte	0x1b
+	.long	0x940
+	.uleb128 0x4
+	.long	0x8e9
+	.uleb128 0x14
+	.long	.LASF1897
+	.byte	0x9b
+	.byte	0x17
+	.long	0x919
+	.uleb128 0xc
+	.long	.LASF1898
+	.byte	0xb
+	.byte	0x4c
+	.byte	0x11
+	.long	0xb3
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x23
+	.long	0x9ab
+	.uleb128 0x1
+	.long	.LASF1899
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1900
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1901
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1902
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1903
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1905
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1906
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1907
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1908
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1909
+	.byte	0xa
+	.byte	0
+	.uleb128 0x24
+	.byte	0x6
+	.byte	0xd
+	.byte	0x22
+	.byte	0x5
+	.long	0x9dc
+	.uleb128 0x2
+	.long	.LASF1910
+	.byte	0xd
+	.byte	0x24
+	.byte	0x11
+	.long	0x91
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1911
+	.byte	0xd
+	.byte	0x25
+	.byte	0x11
+	.long	0x91
+	.byte	0x2
+	.uleb128 0x11
+	.string	"yaw"
+	.byte	0xd
+	.byte	0x26
+	.byte	0x11
+	.long	0x91
+	.byte	0x4
+	.byte	0
+	.uleb128 0x25
+	.byte	0x6
+	.byte	0xd
+	.byte	0x20
+	.byte	0x9
+	.long	0x9fe
+	.uleb128 0x26
+	.string	"raw"
+	.byte	0xd
+	.byte	0x21
+	.byte	0xd
+	.long	0x13d
+	.uleb128 0x27
+	.long	.LASF1912
+	.byte	0xd
+	.byte	0x27
+	.byte	0x7
+	.long	0x9ab
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1913
+	.byte	0xd
+	.byte	0x28
+	.byte	0x3
+	.long	0x9dc
+	.uleb128 0xc
+	.long	.LASF1914
+	.byte	0xd
+	.byte	0x2a
+	.byte	0x1e
+	.long	0x9fe
+	.uleb128 0xc
+	.long	.LASF1915
+	.byte	0xe
+	.byte	0x3b
+	.byte	0x16
+	.long	0x4e5
+	.uleb128 0x8
+	.long	.LASF1916
+	.byte	0x52
+	.byte	0x16
+	.long	0x4e5
+	.uleb128 0x8
+	.long	.LASF1917
+	.byte	0x53
+	.byte	0x1c
+	.long	0xa38
+	.uleb128 0x4
+	.long	0x8a1
+	.uleb128 0x8
+	.long	.LASF1918
+	.byte	0x54
+	.byte	0xc
+	.long	0x131
+	.uleb128 0x8
+	.long	.LASF1919
+	.byte	0x55
+	.byte	0x16
+	.long	0x6d1
+	.uleb128 0x8
+	.long	.LASF1920
+	.byte	0x56
+	.byte	0x10
+	.long	0x9d
+	.uleb128 0xf
+	.long	.LASF1921
+	.byte	0xe
+	.byte	0x43
+	.byte	0x5
+	.long	0x131
+	.long	0xa74
+	.uleb128 0x3
+	.long	0x6d1
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1922
+	.byte	0xe
+	.byte	0x3e
+	.byte	0x5
+	.long	0x131
+	.long	0xa8a
+	.uleb128 0x3
+	.long	0xa8a
+	.byte	0
+	.uleb128 0x4
+	.long	0x8ad
+	.uleb128 0xf
+	.long	.LASF1923
+	.byte	0x9
+	.byte	0x92
+	.byte	0xf
+	.long	0x4e5
+	.long	0xabe
+	.uleb128 0x3
+	.long	0x839
+	.uleb128 0x3
+	.long	0x743
+	.uleb128 0x3
+	.long	0x312
+	.uleb128 0x3
+	.long	0xbf
+	.uleb128 0x3
+	.long	0x2af
+	.uleb128 0x3
+	.long	0x306
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1924
+	.byte	0x9
+	.byte	0x89
+	.byte	0xf
+	.long	0x6d1
+	.long	0xad9
+	.uleb128 0x3
+	.long	0xa8a
+	.uleb128 0x3
+	.long	0x743
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1925
+	.byte	0x9
+	.byte	0x86
+	.byte	0x15
+	.long	0xa38
+	.long	0xaef
+	.uleb128 0x3
+	.long	0x743
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1928
+	.byte	0x9
+	.byte	0x9a
+	.long	0xb00
+	.uleb128 0x3
+	.long	0x4e5
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1926
+	.byte	0x10
+	.byte	0x46
+	.byte	0xa
+	.long	0xb3
+	.uleb128 0x15
+	.long	.LASF1927
+	.byte	0x11
+	.byte	0x55
+	.byte	0x5
+	.long	0x131
+	.uleb128 0x18
+	.long	.LASF1792
+	.byte	0x6
+	.byte	0x74
+	.long	0xb2e
+	.uleb128 0x3
+	.long	0x4e5
+	.uleb128 0x3
+	.long	0x9d
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1929
+	.byte	0x12
+	.byte	0x1d
+	.byte	0xa
+	.long	0xbf
+	.uleb128 0x19
+	.long	.LASF1931
+	.value	0x124
+	.long	0xb54
+	.uleb128 0x28
+	.uleb128 0x1a
+	.long	.LASF1930
+	.value	0x12c
+	.byte	0xd
+	.long	0x131
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1932
+	.value	0x115
+	.long	0xb6c
+	.uleb128 0x1a
+	.long	.LASF1933
+	.value	0x11a
+	.byte	0x10
+	.long	0x7bc
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1934
+	.value	0x10f
+	.uleb128 0x1b
+	.long	.LASF1935
+	.value	0x108
+	.uleb128 0x29
+	.long	.LASF1936
+	.byte	0xf
+	.byte	0xf9
+	.byte	0x6
+	.long	0xb9e
+	.uleb128 0x8
+	.long	.LASF1937
+	.byte	0xfb
+	.byte	0x15
+	.long	0xbf
+	.uleb128 0x2a
+	.string	"now"
+	.byte	0xf
+	.byte	0xfc
+	.byte	0xe
+	.long	0xbf
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1941
+	.byte	0xeb
+	.long	0xbb4
+	.uleb128 0x8
+	.long	.LASF1938
+	.byte	0xed
+	.byte	0x14
+	.long	0x9d
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1939
+	.byte	0xdb
+	.uleb128 0x1c
+	.long	.LASF1940
+	.byte	0xcd
+	.uleb128 0x10
+	.long	.LASF1942
+	.byte	0xa8
+	.long	0xbe1
+	.uleb128 0x8
+	.long	.LASF1943
+	.byte	0xaa
+	.byte	0xd
+	.long	0x9d
+	.uleb128 0x8
+	.long	.LASF1944
+	.byte	0xab
+	.byte	0xd
+	.long	0x9d
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1945
+	.byte	0x7d
+	.uleb128 0x1d
+	.long	.LASF1946
+	.byte	0x74
+	.uleb128 0x10
+	.long	.LASF1947
+	.byte	0x6c
+	.long	0xc01
+	.uleb128 0x16
+	.string	"v"
+	.byte	0x6c
+	.byte	0x27
+	.long	0xbf
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1948
+	.byte	0x66
+	.long	0xc15
+	.uleb128 0x16
+	.string	"v"
+	.byte	0x66
+	.byte	0x27
+	.long	0xb3
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1949
+	.byte	0x60
+	.long	0xc29
+	.uleb128 0x16
+	.string	"v"
+	.byte	0x60
+	.byte	0x25
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1952
+	.byte	0xf
+	.byte	0x58
+	.byte	0xd
+	.uleb128 0x2c
+	.long	.LASF1950
+	.byte	0xf
+	.byte	0x58
+	.byte	0x2b
+	.long	0x9d
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 19 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x15
+	.file 22 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 24 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 25 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 28 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 35 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 36 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 39 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 40 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x28
+	.file 41 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 42 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 43 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x2b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.file 44 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 45 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 46 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 47 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x12
+	.byte	0x4
+	.file 48 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x30
+	.file 49 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.file 50 "./src/main/drivers/accgyro.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x32
+	.file 51 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x33
+	.byte	0x4
+	.file 52 "./src/main/drivers/accgyro_mpu.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 53 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x35
+	.file 54 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 55 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x38
+	.byte	0x4
+	.file 57 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 58 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6
+	.file 59 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 60 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 61 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1516
+	.byte	0x4
+	.file 62 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 63 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1520
+	.byte	0x4
+	.file 64 "./src/main/fc/rc_controls.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 65 "./src/main/sensors/acceleration.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x41
+	.byte	0x4
+	.file 66 "./src/main/sensors/gyro.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x42
+	.file 67 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1559
+	.byte	0x4
+	.byte	0x4
+	.file 68 "./src/main/sensors/barometer.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x44
+	.file 69 "./src/main/drivers/barometer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1560
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1561
+	.byte	0x4
+	.file 70 "./src/main/sensors/boardalignment.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x10
+	.file 71 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1562
+	.byte	0x4
+	.file 72 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x48
+	.file 73 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x4
+	.file 74 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4a
+	.file 75 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1567
+	.byte	0x4
+	.file 76 "./src/main/io/gimbal.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1568
+	.byte	0x4
+	.file 77 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 78 "./src/main/io/beeper.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 79 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x4f
+	.file 80 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x50
+	.file 81 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x51
+	.file 82 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 83 "./src/main/flight/altitudehold.h"
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x53
+	.byte	0x4
+	.file 84 "./src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1685
+	.byte	0x4
+	.file 85 "./src/main/telemetry/ltm.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1687
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF972
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF976
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF981
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF999
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1001
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1100
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1123
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1125
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1127
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1135
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1147
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1515
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1519
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1558
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.25.44d42bc8a2509f001b7da5aa9bee7ce3,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1621
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1649
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1657
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.8362794d947c339e17997ec0162d97db,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1666
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1676
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1684
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF1953
+	.long	.LASF1954
+	.long	.LASF1955
+	.long	.LASF1956
+	.long	.LASF1957
+	.long	.LASF1958
+	.long	.LASF1959
+	.long	.LASF1960
+	.long	.LASF1961
+	.long	.LASF1962
+	.long	.LASF1963
+	.long	.LASF1964
+	.long	.LASF1965
+	.long	.LASF1966
+	.long	.LASF1967
+	.long	.LASF1968
+	.long	.LASF1969
+	.long	.LASF1970
+	.long	.LASF1971
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x56
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1972
+	.byte	0xf
+	.long	.LASF1973
+	.byte	0xf
+	.long	.LASF1974
+	.byte	0xf
+	.long	.LASF1975
+	.byte	0x2
+	.long	.LASF1976
+	.byte	0x4
+	.long	.LASF1977
+	.byte	0x4
+	.long	.LASF1978
+	.byte	0x5
+	.long	.LASF1979
+	.byte	0x9
+	.long	.LASF1977
+	.byte	0x7
+	.long	.LASF1980
+	.byte	0x7
+	.long	.LASF1981
+	.byte	0x8
+	.long	.LASF1982
+	.byte	0x6
+	.long	.LASF1983
+	.byte	0x6
+	.long	.LASF1984
+	.byte	0xc
+	.long	.LASF1985
+	.byte	0xc
+	.long	.LASF1986
+	.byte	0x9
+	.long	.LASF1987
+	.byte	0x6
+	.long	.LASF1988
+	.byte	0x4
+	.long	.LASF1989
+	.byte	0x12
+	.long	.LASF1990
+	.byte	0x13
+	.long	.LASF1991
+	.byte	0x13
+	.long	.LASF1991
+	.byte	0x12
+	.long	.LASF1992
+	.byte	0xf
+	.long	.LASF1993
+	.byte	0x12
+	.long	.LASF1994
+	.byte	0x12
+	.long	.LASF1995
+	.byte	0xf
+	.long	.LASF1996
+	.byte	0xf
+	.long	.LASF1997
+	.byte	0x11
+	.long	.LASF1998
+	.byte	0xf
+	.long	.LASF1999
+	.byte	0x10
+	.long	.LASF2000
+	.byte	0x10
+	.long	.LASF2001
+	.byte	0xf
+	.long	.LASF2002
+	.byte	0xf
+	.long	.LASF2003
+	.byte	0xf
+	.long	.LASF2004
+	.byte	0x12
+	.long	.LASF2005
+	.byte	0x13
+	.long	.LASF2006
+	.byte	0xe
+	.long	.LASF2007
+	.byte	0xe
+	.long	.LASF2008
+	.byte	0x12
+	.long	.LASF2009
+	.byte	0xd
+	.long	.LASF2010
+	.byte	0xb
+	.long	.LASF2011
+	.byte	0xa
+	.long	.LASF2012
+	.byte	0xb
+	.long	.LASF2013
+	.byte	0x1
+	.long	.LASF2014
+	.byte	0x2
+	.long	.LASF2015
+	.byte	0x2
+	.long	.LASF2016
+	.byte	0x2
+	.long	.LASF2017
+	.byte	0x4
+	.long	.LASF2018
+	.byte	0x4
+	.long	.LASF2019
+	.byte	0x4
+	.long	.LASF2020
+	.byte	0x4
+	.long	.LASF2021
+	.byte	0x4
+	.long	.LASF2022
+	.byte	0x5
+	.long	.LASF2023
+	.byte	0x3
+	.long	.LASF2024
+	.byte	0x4
+	.long	.LASF2025
+	.byte	0x4
+	.long	.LASF2026
+	.byte	0x4
+	.long	.LASF2027
+	.byte	0x4
+	.long	.LASF2028
+	.byte	0x4
+	.long	.LASF2029
+	.byte	0x4
+	.long	.LASF2030
+	.byte	0x4
+	.long	.LASF2031
+	.byte	0x4
+	.long	.LASF2032
+	.byte	0x4
+	.long	.LASF2033
+	.byte	0x5
+	.long	.LASF2034
+	.byte	0x9
+	.long	.LASF2035
+	.byte	0x9
+	.long	.LASF2036
+	.byte	0x2
+	.long	.LASF2037
+	.byte	0x9
+	.long	.LASF2037
+	.byte	0x4
+	.long	.LASF2038
+	.byte	0x9
+	.long	.LASF2039
+	.byte	0x2
+	.long	.LASF2040
+	.byte	0x9
+	.long	.LASF2041
+	.byte	0x9
+	.long	.LASF2042
+	.byte	0x9
+	.long	.LASF2043
+	.byte	0x9
+	.long	.LASF2044
+	.byte	0x7
+	.long	.LASF2045
+	.byte	0x7
+	.long	.LASF2046
+	.byte	0x7
+	.long	.LASF2047
+	.byte	0x6
+	.long	.LASF2048
+	.byte	0x4
+	.long	.LASF2049
+	.byte	0x4
+	.long	.LASF2050
+	.byte	0x4
+	.long	.LASF2051
+	.byte	0x6
+	.long	.LASF2052
+	.byte	0x6
+	.long	.LASF2053
+	.byte	0xc
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1507:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1527:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1539:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF980:
+	.string	"HSV_VALUE_MAX 255"
+.LASF1226:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1141:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF963:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1589:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF1706:
+	.string	"RGB_GREEN"
+.LASF1102:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1918:
+	.string	"ltmEnabled"
+.LASF1900:
+	.string	"PIDPITCH"
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1568:
+	.string	"GIMBAL_MODE_MAX (GIMBAL_MODE_MIXTILT)"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1263:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF961:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1361:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1816:
+	.string	"UNUSED_MODE"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_PPM"
+.LASF1281:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1890:
+	.string	"modeColorIndexes_s"
+.LASF1798:
+	.string	"setMode"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1511:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF1410:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1031:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF1101:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1149:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1693:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1776:
+	.string	"vTable"
+.LASF1543:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1709:
+	.string	"_Bool"
+.LASF1941:
+	.string	"process_ltm"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1658:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1128:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1718:
+	.string	"OWNER_ADC_CURR"
+.LASF764:
+	.string	"__need_size_t "
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1498:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1161:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1471:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1899:
+	.string	"PIDROLL"
+.LASF1542:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF992:
+	.string	"BIT(x) (1 << (x))"
+.LASF1298:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1097:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF1107:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF1762:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1200:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1150:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1944:
+	.string	"lt_statemode"
+.LASF1434:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1919:
+	.string	"ltmPortSharing"
+.LASF1840:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1550:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1139:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF1232:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF1503:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1594:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF1906:
+	.string	"PIDLEVEL"
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1475:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1347:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1108:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1715:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1510:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1707:
+	.string	"RGB_BLUE"
+.LASF1702:
+	.string	"uint16_t"
+.LASF1203:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1513:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1652:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF1868:
+	.string	"baudRate_e"
+.LASF1847:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1442:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1421:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1113:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1374:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF1448:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1071:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1631:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1323:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1008:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF1289:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1588:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF995:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1824:
+	.string	"CALIBRATE_MAG"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1162:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1720:
+	.string	"OWNER_ADC_RSSI"
+.LASF1548:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1523:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1466:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF1644:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1343:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1908:
+	.string	"PIDVEL"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1326:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1046:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF1474:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1586:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF1502:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1722:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1842:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1170:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1686:
+	.string	"TELEMETRY_LTM_INITIAL_PORT_MODE MODE_TX"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF1747:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1124:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1557:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF1785:
+	.string	"rxBufferHead"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1178:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1884:
+	.string	"functionMask"
+.LASF1329:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF959:
+	.string	"FAST_MATH "
+.LASF883:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1800:
+	.string	"beginWrite"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF1656:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF1894:
+	.string	"specialColorIndexes_t"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1056:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF1478:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1424:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1667:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF987:
+	.string	"STR_HELPER(x) #x"
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1915:
+	.string	"telemetrySharedPort"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1744:
+	.string	"OWNER_BARO_EXTI"
+.LASF1092:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__always_inline"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1757:
+	.string	"MODE_RX"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF898:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1912:
+	.string	"values"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1585:
+	.string	"LED_POS_OFFSET 0"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1721:
+	.string	"OWNER_SERIAL_TX"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1942:
+	.string	"ltm_sframe"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1005:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1002:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1248:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1866:
+	.string	"BAUD_2000000"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1803:
+	.string	"setRxFrameCallback"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1241:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1461:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF1665:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1684:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF1364:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF988:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1835:
+	.string	"PORTSHARING_SHARED"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1042:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF1404:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1533:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1907:
+	.string	"PIDMAG"
+.LASF1477:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1745:
+	.string	"OWNER_USB"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF402:
+	.string	"false 0"
+.LASF1756:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1321:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1758:
+	.string	"MODE_TX"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF1809:
+	.string	"ANGLE_MODE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1011:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1572:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF1117:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1452:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1946:
+	.string	"ltm_finalise"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF1094:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1386:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1193:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1902:
+	.string	"PIDALT"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1167:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1726:
+	.string	"OWNER_SONAR_ECHO"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1427:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1638:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1144:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1104:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1714:
+	.string	"OWNER_SERVO"
+.LASF994:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF881:
+	.string	"ACC "
+.LASF1904:
+	.string	"PIDPOSR"
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1468:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF803:
+	.string	"USE_PWM "
+.LASF1457:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1520:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1653:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1253:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1501:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1025:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1103:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1495:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1171:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1020:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1111:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF1910:
+	.string	"roll"
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1119:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1176:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1622:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1694:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF522:
+	.string	"__flexarr []"
+.LASF1696:
+	.string	"__uint16_t"
+.LASF1535:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF1781:
+	.string	"rxBufferSize"
+.LASF1713:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1260:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1265:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1845:
+	.string	"FUNCTION_BLACKBOX"
+.LASF968:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF1079:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1741:
+	.string	"OWNER_RX_SPI_CS"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1524:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1293:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1607:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1148:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1037:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1787:
+	.string	"txBufferHead"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1858:
+	.string	"BAUD_230400"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1778:
+	.string	"mode"
+.LASF1179:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1126:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF1470:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1935:
+	.string	"freeLtmTelemetryPort"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF957:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1830:
+	.string	"SENSOR_INDEX_BARO"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1829:
+	.string	"SENSOR_INDEX_ACC"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF973:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1590:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1296:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1661:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF986:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1552:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1301:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1488:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1810:
+	.string	"HORIZON_MODE"
+.LASF1841:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1688:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1169:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1001:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1430:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1490:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1619:
+	.string	"LO(name) LED_FLAG_OVERLAY(LED_OVERLAY_ ## name)"
+.LASF1090:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF1376:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF1530:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1704:
+	.string	"float"
+.LASF1209:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1109:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1467:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1449:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1022:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF1799:
+	.string	"writeBuf"
+.LASF879:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1850:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1130:
+	.string	"IOCFG_OUT_OD 0"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF1033:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1217:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1928:
+	.string	"closeSerialPort"
+.LASF1801:
+	.string	"endWrite"
+.LASF1837:
+	.string	"FUNCTION_NONE"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF1026:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF974:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF380:
+	.string	"__unix 1"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1483:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1655:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF1753:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF813:
+	.string	"LED_STRIP "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1066:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF1385:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1283:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1310:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1565:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1288:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1377:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1356:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1854:
+	.string	"BAUD_19200"
+.LASF1735:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1893:
+	.string	"specialColorIndexes_s"
+.LASF1862:
+	.string	"BAUD_500000"
+.LASF1419:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1262:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1865:
+	.string	"BAUD_1500000"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1338:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1254:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1634:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1172:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1084:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF981:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1860:
+	.string	"BAUD_400000"
+.LASF1540:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1819:
+	.string	"FAILSAFE_MODE"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1796:
+	.string	"serialSetBaudRate"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1367:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1795:
+	.string	"serialRead"
+.LASF1493:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF1917:
+	.string	"portConfig"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1422:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF1789:
+	.string	"rxCallback"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF1505:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1886:
+	.string	"gps_baudrateIndex"
+.LASF1095:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1159:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1525:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1901:
+	.string	"PIDYAW"
+.LASF1783:
+	.string	"rxBuffer"
+.LASF1601:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1782:
+	.string	"txBufferSize"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1766:
+	.string	"SERIAL_PARITY_NO"
+.LASF1605:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1004:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1616:
+	.string	"LED_XY_MASK 0x0F"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1041:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF1642:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1746:
+	.string	"OWNER_USB_DETECT"
+.LASF1173:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1950:
+	.string	"ltm_id"
+.LASF1344:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1486:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1058:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF1127:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1045:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF1308:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF1812:
+	.string	"BARO_MODE"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1016:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1067:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1579:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1313:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1818:
+	.string	"SONAR_MODE"
+.LASF1497:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1156:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1595:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF1182:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1750:
+	.string	"OWNER_INVERTER"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1322:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1602:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF1730:
+	.string	"OWNER_SPI_MOSI"
+.LASF1476:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1811:
+	.string	"MAG_MODE"
+.LASF1777:
+	.string	"identifier"
+.LASF1701:
+	.string	"uint8_t"
+.LASF1221:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF1599:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF1668:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF1620:
+	.string	"LD(name) LED_FLAG_DIRECTION(LED_DIRECTION_ ## name)"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF958:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF998:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF1325:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF990:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1831:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1927:
+	.string	"failsafeIsActive"
+.LASF814:
+	.string	"TELEMETRY "
+.LASF1807:
+	.string	"ARMED"
+.LASF1227:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1043:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF1328:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF960:
+	.string	"VERY_FAST_MATH "
+.LASF1499:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1000:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1044:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1415:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1334:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF977:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF1220:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1239:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF822:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1878:
+	.string	"SERIAL_PORT_USART8"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF1743:
+	.string	"OWNER_MPU_EXTI"
+.LASF1532:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1672:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF1142:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1359:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1712:
+	.string	"OWNER_PPMINPUT"
+.LASF1875:
+	.string	"SERIAL_PORT_UART5"
+.LASF1851:
+	.string	"serialPortFunction_e"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1651:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF949:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1489:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1244:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF1432:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1100:
+	.string	"GYRO_LPF_NONE 7"
+.LASF1059:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF1671:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1272:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF1558:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1623:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1080:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1122:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1112:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF1188:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF1649:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1763:
+	.string	"SERIAL_INVERTED"
+.LASF1211:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1257:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1235:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1425:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1371:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF1406:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1388:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1626:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1922:
+	.string	"telemetryCheckRxPortShared"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF1596:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF1451:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1191:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1853:
+	.string	"BAUD_9600"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1531:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1663:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1099:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1578:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF1317:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1657:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1268:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF1146:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1006:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF1469:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1454:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1725:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1848:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF972:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1445:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1304:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1391:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1295:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1843:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1528:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF1017:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF1896:
+	.string	"modeColors"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1194:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1134:
+	.string	"IOCFG_IPU 0"
+.LASF1685:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF1121:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1337:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1678:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1822:
+	.string	"GPS_FIX_HOME"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1465:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF1911:
+	.string	"pitch"
+.LASF1727:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1598:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF499:
+	.string	"__PMT"
+.LASF1887:
+	.string	"blackbox_baudrateIndex"
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF1888:
+	.string	"telemetry_baudrateIndex"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF982:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1027:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF1480:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1859:
+	.string	"BAUD_250000"
+.LASF1838:
+	.string	"FUNCTION_MSP"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1820:
+	.string	"armingFlags"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1292:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF979:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1349:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1373:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1070:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1562:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1660:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF1012:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF1618:
+	.string	"LF(name) LED_FUNCTION_ ## name"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1340:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1617:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF1849:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1068:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF1932:
+	.string	"configureLtmTelemetryPort"
+.LASF1654:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF1123:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1353:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1951:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1537:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1014:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF1834:
+	.string	"PORTSHARING_NOT_SHARED"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1676:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1174:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1152:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1463:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1564:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1284:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1236:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1577:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1394:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF1948:
+	.string	"ltm_serialise_16"
+.LASF1187:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF1949:
+	.string	"ltm_serialise_8"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1823:
+	.string	"GPS_FIX"
+.LASF1930:
+	.string	"newTelemetryEnabledValue"
+.LASF787:
+	.string	"__need_NULL"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1184:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF978:
+	.string	"HSV_HUE_MAX 359"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF802:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1165:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1759:
+	.string	"MODE_RXTX"
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1814:
+	.string	"GPS_HOLD_MODE"
+.LASF1078:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1051:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1808:
+	.string	"WAS_EVER_ARMED"
+.LASF1549:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1538:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF967:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF1933:
+	.string	"baudRateIndex"
+.LASF1250:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1517:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF983:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1815:
+	.string	"HEADFREE_MODE"
+.LASF1733:
+	.string	"OWNER_SDCARD"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1052:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1009:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1494:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1091:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1700:
+	.string	"int16_t"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1341:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1689:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1947:
+	.string	"ltm_serialise_32"
+.LASF1302:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1692:
+	.string	"signed char"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1242:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF766:
+	.string	"__size_t__ "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1205:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1491:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF1315:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1916:
+	.string	"ltmPort"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF1545:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1492:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF956:
+	.string	"sq(x) ((x)*(x))"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1600:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF996:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1400:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1547:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1628:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1418:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1592:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF1630:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1151:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1168:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1135:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1945:
+	.string	"ltm_gframe"
+.LASF1518:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1529:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1938:
+	.string	"ltm_scheduler"
+.LASF1053:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1880:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1881:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF396:
+	.string	"__REVISION__ \"669c324\""
+.LASF1397:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1755:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1603:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1844:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1580:
+	.string	"LED_MODE_COUNT 6"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1923:
+	.string	"openSerialPort"
+.LASF1748:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1409:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1199:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1458:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1057:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1190:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1160:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1553:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1331:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1197:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1234:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1140:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1007:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF1805:
+	.string	"OK_TO_ARM"
+.LASF1175:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF997:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1675:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF975:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1105:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1797:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1931:
+	.string	"checkLtmTelemetryState"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1132:
+	.string	"IOCFG_AF_OD 0"
+.LASF1769:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF1546:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1166:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1664:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1879:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF929:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1526:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1560:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF1118:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF821:
+	.string	"GPS "
+.LASF1561:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1352:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1871:
+	.string	"SERIAL_PORT_USART1"
+.LASF1872:
+	.string	"SERIAL_PORT_USART2"
+.LASF1873:
+	.string	"SERIAL_PORT_USART3"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1208:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1876:
+	.string	"SERIAL_PORT_USART6"
+.LASF1877:
+	.string	"SERIAL_PORT_USART7"
+.LASF1827:
+	.string	"stateFlags"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1793:
+	.string	"serialTotalRxWaiting"
+.LASF1147:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1440:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1698:
+	.string	"long int"
+.LASF1534:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1269:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1674:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF1943:
+	.string	"lt_flightmode"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1920:
+	.string	"ltm_crc"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1038:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF1604:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF969:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1098:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF1723:
+	.string	"OWNER_PINDEBUG"
+.LASF1214:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1481:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1682:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1551:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1576:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF1855:
+	.string	"BAUD_38400"
+.LASF991:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF1575:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1314:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1680:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1581:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1610:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF1028:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF989:
+	.string	"EXPAND_I(x) x"
+.LASF1290:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1952:
+	.string	"ltm_initialise_packet"
+.LASF1632:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1096:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1247:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1703:
+	.string	"uint32_t"
+.LASF1089:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF1164:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1677:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1786:
+	.string	"rxBufferTail"
+.LASF1806:
+	.string	"PREVENT_ARMING"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1212:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1464:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1929:
+	.string	"millis"
+.LASF1717:
+	.string	"OWNER_ADC_BATT"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1768:
+	.string	"SERIAL_UNIDIR"
+.LASF965:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF1544:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF1691:
+	.string	"long unsigned int"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1597:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1120:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1230:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1062:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1591:
+	.string	"LED_POS_BITCNT 8"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1305:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1724:
+	.string	"OWNER_TIMER"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1683:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1460:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1413:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1443:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1389:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1157:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1569:
+	.string	"LAT 0"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1897:
+	.string	"specialColors"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF1699:
+	.string	"char"
+.LASF1903:
+	.string	"PIDPOS"
+.LASF1627:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1286:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1584:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1223:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1484:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1370:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1245:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1869:
+	.string	"baudRates"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1131:
+	.string	"IOCFG_AF_PP 0"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF1774:
+	.string	"hsvColor_s"
+.LASF1708:
+	.string	"hsvColor_t"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1018:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF1350:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1023:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1870:
+	.string	"SERIAL_PORT_NONE"
+.LASF1519:
+	.string	"BEEP_ON do {} while(0)"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1736:
+	.string	"OWNER_FLASH_CS"
+.LASF1358:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF985:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1332:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1891:
+	.string	"color"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1583:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF1541:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1643:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1506:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1559:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1633:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1024:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF1898:
+	.string	"rssi"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1659:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1613:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF1767:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1937:
+	.string	"ltm_lastCycleTime"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1335:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF1867:
+	.string	"BAUD_2470000"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1514:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1813:
+	.string	"GPS_HOME_MODE"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1728:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1251:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1412:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1554:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1229:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1621:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1556:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF1609:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1646:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1456:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1392:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1063:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1874:
+	.string	"SERIAL_PORT_UART4"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1355:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF1271:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1833:
+	.string	"PORTSHARING_UNUSED"
+.LASF1883:
+	.string	"serialPortConfig_s"
+.LASF1889:
+	.string	"serialPortConfig_t"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1487:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1433:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1218:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1153:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1509:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1764:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1765:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1555:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1416:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1788:
+	.string	"txBufferTail"
+.LASF1687:
+	.string	"LTM_CYCLETIME 100"
+.LASF1215:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF1939:
+	.string	"ltm_oframe"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF1110:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1114:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1606:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF1115:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1403:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1259:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1030:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1050:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF1125:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF1662:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1731:
+	.string	"OWNER_I2C_SCL"
+.LASF1729:
+	.string	"OWNER_SPI_MISO"
+.LASF1940:
+	.string	"ltm_aframe"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1754:
+	.string	"OWNER_COMPASS_CS"
+.LASF1679:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF1060:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1437:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1593:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF1320:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF966:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1287:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1825:
+	.string	"SMALL_ANGLE"
+.LASF1143:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1015:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1455:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1029:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF1307:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1732:
+	.string	"OWNER_I2C_SDA"
+.LASF1648:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1697:
+	.string	"__uint32_t"
+.LASF1608:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1036:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF971:
+	.string	"Q12 (1 << 12)"
+.LASF801:
+	.string	"USE_CLI "
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1206:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1863:
+	.string	"BAUD_921600"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1737:
+	.string	"OWNER_FLASH"
+.LASF1780:
+	.string	"baudRate"
+.LASF1496:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1882:
+	.string	"serialPortIdentifier_e"
+.LASF1761:
+	.string	"portOptions_t"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1826:
+	.string	"FIXED_WING"
+.LASF1395:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1895:
+	.string	"colors"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1093:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1885:
+	.string	"msp_baudrateIndex"
+.LASF1645:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1784:
+	.string	"txBuffer"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF1426:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1407:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1641:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1069:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF1274:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF1145:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1615:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF1163:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1512:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1181:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1436:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1266:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1382:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1629:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1158:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1299:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1365:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1749:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF1924:
+	.string	"determinePortSharing"
+.LASF1401:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1752:
+	.string	"OWNER_TRANSPONDER"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF1055:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1088:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF1650:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1047:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF1821:
+	.string	"flightModeFlags"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF1857:
+	.string	"BAUD_115200"
+.LASF1064:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1791:
+	.string	"serialPortVTable"
+.LASF1311:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1522:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1839:
+	.string	"FUNCTION_GPS"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1508:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1760:
+	.string	"portMode_t"
+.LASF993:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1061:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1669:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF1846:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1739:
+	.string	"OWNER_MPU_CS"
+.LASF1742:
+	.string	"OWNER_SPI_CS"
+.LASF1136:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1202:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1624:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1034:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1836:
+	.string	"portSharing_e"
+.LASF1013:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1570:
+	.string	"LON 1"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF885:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1398:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1116:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1772:
+	.string	"serialReceiveCallbackPtr"
+.LASF1479:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF1681:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF999:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1934:
+	.string	"initLtmTelemetry"
+.LASF1639:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1770:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1710:
+	.string	"OWNER_FREE"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF1049:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1647:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1802:
+	.string	"readBuf"
+.LASF1666:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1705:
+	.string	"RGB_RED"
+.LASF976:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1439:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1021:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1196:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1775:
+	.string	"serialPort_s"
+.LASF1804:
+	.string	"serialPort_t"
+.LASF1711:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1521:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1280:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1003:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF1852:
+	.string	"BAUD_AUTO"
+.LASF1566:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF1794:
+	.string	"serialTotalTxFree"
+.LASF1536:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1032:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1362:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1771:
+	.string	"SERIAL_BIDIR_PP"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1072:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF1773:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF1010:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF1473:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1500:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1065:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF1154:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1563:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1925:
+	.string	"findSerialPortConfig"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1256:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1921:
+	.string	"telemetryDetermineEnabledState"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1129:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1636:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1734:
+	.string	"OWNER_SDCARD_CS"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1073:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF970:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF1914:
+	.string	"attitude"
+.LASF1074:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF1075:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1574:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1076:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF1482:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1048:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF1368:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1428:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1277:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1790:
+	.string	"rxFrameCallback"
+.LASF1905:
+	.string	"PIDNAVR"
+.LASF1040:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1233:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1054:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1670:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1379:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1864:
+	.string	"BAUD_1000000"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1573:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1913:
+	.string	"attitudeEulerAngles_t"
+.LASF1137:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1751:
+	.string	"OWNER_LED_STRIP"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF888:
+	.string	"USE_UART2 "
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1571:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1637:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF1909:
+	.string	"PID_ITEM_COUNT"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1504:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1019:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1832:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1936:
+	.string	"handleLtmTelemetry"
+.LASF1625:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1792:
+	.string	"serialWrite"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1635:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF1106:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF1926:
+	.string	"getBatteryVoltage"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF1384:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1077:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1155:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1138:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1082:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF1861:
+	.string	"BAUD_460800"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1087:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1738:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1238:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF962:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1856:
+	.string	"BAUD_57600"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF1612:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF1690:
+	.string	"unsigned int"
+.LASF1828:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF1346:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1582:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF1316:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1640:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1614:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF984:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1039:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF1081:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF1086:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF1446:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1085:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1611:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1383:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1716:
+	.string	"OWNER_ADC"
+.LASF1695:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1516:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1275:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1485:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1431:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1817:
+	.string	"PASSTHRU_MODE"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1567:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1719:
+	.string	"OWNER_ADC_EXT"
+.LASF1185:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1587:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF1224:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1673:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1779:
+	.string	"options"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1740:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1472:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1083:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1133:
+	.string	"IOCFG_IPD 0"
+.LASF1892:
+	.string	"modeColorIndexes_t"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1515:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1278:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2026:
+	.string	"rx_pwm.h"
+.LASF2048:
+	.string	"pwm_output.h"
+.LASF1970:
+	.string	"/usr/include"
+.LASF1985:
+	.string	"ltm.c"
+.LASF1991:
+	.string	"stdint.h"
+.LASF2053:
+	.string	"ltm.h"
+.LASF1953:
+	.string	"src/main/build"
+.LASF1967:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2037:
+	.string	"barometer.h"
+.LASF1990:
+	.string	"stdbool.h"
+.LASF2025:
+	.string	"flash.h"
+.LASF2036:
+	.string	"time.h"
+.LASF1995:
+	.string	"wordsize.h"
+.LASF1975:
+	.string	"color.h"
+.LASF2052:
+	.string	"navigation.h"
+.LASF1962:
+	.string	"src/main/target/SITL"
+.LASF2031:
+	.string	"sound_beeper.h"
+.LASF2012:
+	.string	"common_post.h"
+.LASF1992:
+	.string	"libc-header-start.h"
+.LASF1987:
+	.string	"failsafe.h"
+.LASF2009:
+	.string	"platform.h"
+.LASF1971:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2043:
+	.string	"voltage_ids.h"
+.LASF1976:
+	.string	"resource.h"
+.LASF2038:
+	.string	"boardalignment.h"
+.LASF1958:
+	.string	"src/main/flight"
+.LASF1983:
+	.string	"imu.h"
+.LASF1989:
+	.string	"stdc-predef.h"
+.LASF2019:
+	.string	"accgyro.h"
+.LASF1966:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2039:
+	.string	"filter.h"
+.LASF2029:
+	.string	"io_def.h"
+.LASF1993:
+	.string	"features.h"
+.LASF1965:
+	.string	"src/main"
+.LASF1959:
+	.string	"src/main/io"
+.LASF2002:
+	.string	"time64.h"
+.LASF1955:
+	.string	"src/main/config"
+.LASF1994:
+	.string	"features-time64.h"
+.LASF2008:
+	.string	"strings.h"
+.LASF2020:
+	.string	"exti.h"
+.LASF2046:
+	.string	"beeper.h"
+.LASF1978:
+	.string	"runtime_config.h"
+.LASF2022:
+	.string	"config.h"
+.LASF1999:
+	.string	"stubs.h"
+.LASF2035:
+	.string	"gyro.h"
+.LASF2004:
+	.string	"string.h"
+.LASF2011:
+	.string	"target.h"
+.LASF1984:
+	.string	"telemetry.h"
+.LASF2014:
+	.string	"maths.h"
+.LASF1957:
+	.string	"src/main/fc"
+.LASF2003:
+	.string	"wchar.h"
+.LASF1996:
+	.string	"timesize.h"
+.LASF1954:
+	.string	"src/main/common"
+.LASF2042:
+	.string	"voltage.h"
+.LASF1981:
+	.string	"rx.h"
+.LASF2040:
+	.string	"current.h"
+.LASF1969:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2050:
+	.string	"rcc_types.h"
+.LASF2045:
+	.string	"gps.h"
+.LASF2034:
+	.string	"acceleration.h"
+.LASF2005:
+	.string	"stddef.h"
+.LASF1980:
+	.string	"ledstrip.h"
+.LASF2010:
+	.string	"common.h"
+.LASF2049:
+	.string	"timer.h"
+.LASF2000:
+	.string	"stubs-64.h"
+.LASF2027:
+	.string	"sdcard.h"
+.LASF2023:
+	.string	"parameter_group.h"
+.LASF1982:
+	.string	"pid.h"
+.LASF2051:
+	.string	"altitudehold.h"
+.LASF2030:
+	.string	"io_def_generated.h"
+.LASF2041:
+	.string	"current_ids.h"
+.LASF2047:
+	.string	"mixer.h"
+.LASF1979:
+	.string	"sensors.h"
+.LASF2032:
+	.string	"vcd.h"
+.LASF2021:
+	.string	"accgyro_mpu.h"
+.LASF2028:
+	.string	"io.h"
+.LASF1974:
+	.string	"stdint-uintn.h"
+.LASF0:
+	.string	"./src/main/telemetry/ltm.c"
+.LASF2024:
+	.string	"adc.h"
+.LASF1998:
+	.string	"long-double.h"
+.LASF2033:
+	.string	"rc_controls.h"
+.LASF1986:
+	.string	"battery.h"
+.LASF1997:
+	.string	"cdefs.h"
+.LASF1960:
+	.string	"src/main/rx"
+.LASF2001:
+	.string	"typesizes.h"
+.LASF2017:
+	.string	"sensor.h"
+.LASF2006:
+	.string	"locale_t.h"
+.LASF1963:
+	.string	"src/main/target"
+.LASF2015:
+	.string	"axis.h"
+.LASF1988:
+	.string	"system.h"
+.LASF1956:
+	.string	"src/main/drivers"
+.LASF1977:
+	.string	"serial.h"
+.LASF2016:
+	.string	"utils.h"
+.LASF2013:
+	.string	"build_config.h"
+.LASF2044:
+	.string	"gimbal.h"
+.LASF1961:
+	.string	"src/main/sensors"
+.LASF1973:
+	.string	"stdint-intn.h"
+.LASF2007:
+	.string	"__locale_t.h"
+.LASF1972:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1964:
+	.string	"src/main/telemetry"
+.LASF2018:
+	.string	"io_types.h"
+.LASF1968:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\r\b"
+	.string	"d\n\312\001"
+	.string	"\030"
+	.string	"\253\273\370M\b\002"
+	.string	"\002"
+	.string	"\002\001\001\240\342\234\212\n\002\003\265\373\223\204\004\f"
+	.string	"\002"
+	.string	"\004\254\333\233\324\017\030\005\277\205\366\315\002\n\002\001\002\001\007\317\274\356\345\005\020\t\230\371\377\324\006\026\002\003\002\003\r\377\336\234\275\r\016\017\212\346\242)\004\002\020\021\254\241\214\350\n\006\002\005\002\005\023\024\316\300\362\216\016\004\025\307\354\376\303\t\026\270\221\253\372\n\004\002\006\002\006\002\007\002\007\027\030\031\210\251\302\205\013\f"
+	.string	"\002\b\002\004\002\t\002\n\002\b\005\002\005\033\316\352\207\265\016\016\005\002\005\034\035\036\240\342\234\212\n"
+	.string	"( @\002\304\034\332\006Id\361=\020\026\353@\240\r\341\206\202\304{\317b\273t\302ZzE"
+	.string	"B\030\026WkDvyo\225\266\226v\327\303\027\210\013V4|\013l\031\246\001A\373w\r\274\016\364\036N\b"
+	.string	"\344x\007\203\b\340\\\340xP]\300\025\223_#\336\277"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375 \276\255\002"
+	.string	"4\002\262"
+	.string	"\016"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\002"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\004\005\007\t\r\017"
+	.string	"\001\021"
+	.string	"\001\024\025\026"
+	.string	"\031\033"
+	.string	"\025"
+	.ascii	"Y\261P1\274\331\fe\005\315\255\230\353d\036\273X\030\310\301"
+	.ascii	"B\016\220`!\227\243\320*8\242\270\260\351\035\316c-\361.gk\332"
+	.ascii	"\263\001,"
+	.text
+	.section	.gnu.lto_.inline.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\333\002\025\f"
+	.string	"\342M260\217\222\016\200\252i\314[\2732\210\027\330\375\351\364\224n2\204\351\333\005\202\264\205\017\006\\\003\241\376\246\240\030\n\n\nH{\225\320\3079\334\243\275Q\377\250\221MR\203B2b\313C>\022\351"
+	.ascii	"ax!\363o\230J\3114\242"
+	.string	"P:\241X\020N\370w]*N\007b\037\200P+\215\223\346I\027\321\312K\266A\007G)\226\t{\333\300\360\beY\022\342Xi\036\310\336\007\242\244X\037\333\233\177\360\204\324F\344\277\212\274h\265\223\034\360)\255\266\r\003\374\313-\332r\306\314\305\016j\037\207\rE\222\332B|\315\305k\211\364d\241\250m\301\360\2718\0275\230g'\363]\266-\226\277&\337\3577\221\252\266\004/04\tO\250\321\271\"!\031qag\rP\"\"\346\222\007\022`\003R\216\303\220q\b13\026\f\305\005\326\272\001\222\\\300\255F\372a\234\330\371w/q\306D\272\313\351N\276\317E\335\307\031\363PLR\020\241\265k\221WVd\274\236\b\f\214l@Y;\215\215\204\246\2439\235\367\026<5s-\230-2\332\314G;\\y\274Cs\340\247\263\274N\004 \254\331\330\034\234m>OF\226\025\255e\317\257\265\237"
+	.string	";\024\322Z"
+	.string	"9$\234$~t5\207\232\375@\250(mnw0\200\277\241\201\257\205\267\335"
+	.ascii	"\201Ey\220\031t\326\232\232_\026\274|\032h\316\226\305\351\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\262\002\275\b"
+	.string	"\"\212 )\200)I\007\230\ty\n\361P\021\355#1)\212\016\027\230\340\3413\344\261\320\020\225\240\357\030\210Q\333\357\303\372\333\022\"e\n\377j\302\323\301Z>XO\356n\242\204\260\276>\036\201\027l\225\025FX\017\f\376\202'HF\206\240t\031l\347\255\3002p1V\260l\bx\036Z\220\022\326\276\300\222\213\315\305J*"
+	.string	"\307Iw\354\r\344H\fs\024q\f\353<\256\252f\252\206\257\004\272\022\371\300\211\"A\250!Y\306n\f\212\331\016\200\002\021\273\252\007\022\340r\211\212\341)e\21455\321\3043\225\226[:\345\307X/|*y1\225\035'\021d\204\324\245r\342Tq)\\\345X\220ug$\343\341\217\370\330^\t\230\243\030\022\264\2724\203\0235q\323\334\027!\"^\0066W\tkLN\303vz\350\204\233l\3432\220&\315E\236r\2214\277\036C\003ie\025\307\240\254\216\035`"
+	.ascii	"`\254\310\303\226\267\200\266z'l3\210;g\033\326\326\233R\252"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_.pureconst.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\230\004\003\230\004\004\230\004\005\230\004\007\230\004\t\230"
+	.ascii	"\004\r\230\004\017\230\004\021\230\004\024\230\004\025\230\004"
+	.ascii	"\026\230\004\031\231\004\033\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\235\003"
+	.string	"\004\003\020\001"
+	.string	"\t"
+	.string	"\001\002\022\001"
+	.string	"\005\017\001\002\r\001"
+	.string	"\021"
+	.string	"\002\002\023"
+	.string	"\001\002\023\024\002\025\026\b"
+	.string	"\001\002\b\001"
+	.string	"\002\024"
+	.string	"\001\002\024\031\025\033\004"
+	.string	"\034"
+	.string	"9K\360\260\002I\020\270X\206 \324A\300\376\240\310N\271\200?\b\033`\275\257\206q\313\206z1\363\257\350\262 \026\034\302\333\262:Z\013\213\235M\212\235\316\016\232{{.\336\355"
+	.ascii	"\013k`\b"
+	.text
+	.section	.gnu.lto_.lto.3aca320fc43dfc8,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ltm_initialise_packet.112.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\347"
+	.string	"U\013"
+	.string	"\326\024L@ o\\8\333&m\024@\255\021\311\227\203\204\037\360\223\230_\341\3026#\021\207\013\324\370f\366\362\007\276\315\337\372T\213\265%$"
+	.string	"b\022`\210\036X*w\321b\353\033\021Z\263\215^\262\245L)8"
+	.string	"6"
+	.string	":"
+	.string	"\"\341S\"\353.\003\021\036v\307\017{\\\034sh\233\370\ba%\r(\2242\254vw\323\007\017\237\241\377\n\327D\323\350)\301\354\256S4-\270\365\2669lc\354\037\b'H\331rj@Abs\205=\216R\035\330\277vw\255(\373\251_\323\364\225i\325tj\372\224\2145\242\322aWA\213\265*\354\203\004\333\247\330\032\023@2\355\220\252\372R\013\025\006\221\033R\265S\266\232d\307\035\"\273\332\235\227\027\275\221@G\366/\034C\250\300\347\223\035\273j\247\024\027e\276\205\217\"?\202\r\200\362\3421\037\224\035\303(\021\276\214h8\027\001\232\214%\203\323\t\320\201\236\314\033K\007z\266\320\007r\035\347\341\300m@'\323m\233\357\263Y*\366\bp\337\006z\336\267Q\306\275\242"
+	.string	"\260P\221\024\201'\251zq\270T;i\001\026"
+	.ascii	"\020S\340L\300\0024c\212^\t\336-\002\023\0273\320\256V\216`e"
+	.ascii	"\300\023Y\231\244a\0305\264\003\013;\345\030`\306\246\206N\227"
+	.ascii	"\261\301\324\020p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_ltm_serialise_16.114.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`[\002\275\021"
+	.string	"\366\340qF\340\322&\035CMh4\025\240\027$\306W\274\\\307W\021D\261dw:(\342\240"
+	.string	"S\262J%T\352\206\312c\344\206\220U\255)\37600\317\020n0\3164mN\316\220<[\312\354\366tSk\204\220M\244L)["
+	.string	"Z"
+	.string	"_"
+	.ascii	"\fT\207\275\234l>31\204\036}\030*\273{\314\316\026\331@\222i"
+	.ascii	"\337\305_\254\016\303\340\270+\242F\317.Xb\005\334\243\200\027"
+	.ascii	"\320\036\363\004\264G\257l\037\007K\3546\303\343\322\031\332"
+	.ascii	"]OI|\365\\\371\267\371\350\025\003\363\334Pv\327\371\212\361"
+	.ascii	"p\353m'\260\355\300\316\037\001\006[\251#\354g\273\273V\032;"
+	.ascii	"\246Cb\272\264\245\273\230&\305\364hKs\207\375Z\246cLgZZ3\235"
+	.ascii	"1\375\001\333\n\035\007b\273\035bA\366'\3328\021\356\244\004"
+	.ascii	"\r\215<Gu\320\307I\tj\261\273\335\352\260\027nQl\341\f\217\320"
+	.ascii	".8\362(\022\202$\3637^\0205?!\332\363\027\220\222^C\364.\231"
+	.ascii	"V\306\354\3238\317\013\313\367i\217%\005\300c\223)ej\247~N\213"
+	.ascii	"\204\374\313\b2(\214}\031\237Q\3017a\323)\377:i\217\235\216@"
+	.ascii	"<\347\244\360\003\320\342\374\034\302\230\035\373\233\033\205"
+	.ascii	"\225D\276\246\226hz\315\036\256\"V\306\234a\r\320&\221\003>i"
+	.ascii	"\260\002\341$\302\212\212I\200\0137\213\211)\345\342\251P\251"
+	.ascii	"\317\364\271|)oB\213\212\311cAY\360L\f\370D\341Cy\251\323\t\345"
+	.ascii	"u \353\331*\215\037\260\370ai\313\276\216\nR\216\221fJ\3021\212"
+	.ascii	"\312\251\037\372p\341N\246\327\271QT\243j\246w\025q\367\rMS\325"
+	.ascii	"k(j\245\370\315osR\0301 \220\002!:\253\003\243\245\310\212W/"
+	.ascii	"E\2030\037\371\316\226)\27552\005,\026'\234\255\335q\341,\"\330"
+	.ascii	"W\314\232_vX2\206\307\203\t\214\352\351&\003\02704\2730\263\263"
+	.ascii	"\315\237\261\267\265\005H\210\213\"\302G\324E\354\276\352=:\362"
+	.ascii	"\307\242\303\b\214\"+\033\216\373|\330%{:Z\360+/\"\222\365\271"
+	.ascii	"\002\330\362B\020d"
+	.text
+	.section	.gnu.lto_ltm_serialise_32.115.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\337\004-\030"
+	.string	"\326\353\225I\300\222U:\303\317\221\020M\001)'Jl\263\366"
+	.string	"\363\275\322}1Y\024\302\207b\232\205\021\377\2651\005\331\342'\r$L\200\001\b\300IWQ\020d\323\365/\214bQ\360\263G\366\34776\275Kg\030n\226\220M\244L)\202"
+	.string	"y"
+	.string	"~"
+	.string	"E*\347\2519\320G!\033*Q\226\345)w\037\216T\222 \20595\210\312\022\250\362\371\332\260\"\352w\\\300@\315}8\027\022FN\017\321\247\177\242\306>}\212'\333\025d\345j\337\304ur\367\331\270T\226\034Z"
+	.string	"\225%\220\305\004H\237)o\215\237\342Y\343\247s\266\217\003A\224dN\r^\260\250,\313\330~x\356\232\363\377{\251w3\341J\276\224ei\355\335`\270\367\266\003\330F`\317\b\001GF\355W{\360\214tzd\025\352\b\225*\304\006\356t=\330\027\313\355`O5\312T\303H\365\311\2506\231\352\327T\273Hu\311T\267\246\232\204T\263F\365\310T\213L\365\212T\253Fu\352\276\037%\252OSm\032\325%QM\232jrT\217\242zN\2658\252WT\353T_"
+	.ascii	"\031\343\006\200\241\262\274p4\244\034\316\027#~X\310\200\024"
+	.ascii	"\371\250\220\001)!L!\033\n\017\336/#;w\300\270;\262+.\013\317"
+	.ascii	"\210t\007\215\250\335\335`\005\243\235\357;\377\357&\241\316"
+	.ascii	"\020ee\274\367\003\266_\224=O\203\037\343A8\231\331l\374\204"
+	.ascii	"mj\007\016\251A\b\245\272'\353\363\3140\320\367\234Ba'\330\007"
+	.ascii	"\272\213\007~\b\323j\372\336\247_\033?O\266\204\303s\2230\203"
+	.ascii	"\020\212\337\202\360\006\307\367;\367\213N\205\330du\377\373"
+	.ascii	"E\374\3506#jM\326\312\303\331iv9\020\243\300eA\fL\213J\302-\323"
+	.ascii	"B\273\321\304p\266\333\2146"
+	.string	"\243\231\335b\rf`h1\031\033\204X\013\3145\0073[\354V\253\331b'\240\356b\271\035\234 h\250\333\235\375\0250D\210VkZ\021\037\253\323\252\326\377\341\241\372aa\332\257(\355i\3173*\255\351Uz\321\343\242\245\203d\311m\345 !-k}\037\034,\037\025\344\276'\265\244\031\03775.\271\032\201\202\277\327\320\265\342\276l\270\346\226\254/\244Q\"L!n^\250Qp\204\224\022\023\221$E%i5\020\003\021!\252\016\022`T1I\222X\320\242\n\025\332\251\367\343\241\342!y%\027\200\240p\021\210\317x\213\007\370\234J\357,\252&\004\245\210i\3069\240\317\223\245-u.8\234>\220;^\272\001\t3\225\021\272\257\247l\374\225\317\215\367!\355\367\027(\264\030\324\266\031\274Q\0228(s\351sL\337\206h\333\220\370O\177\004\372\232\273\230\275\321\250t\370\377\235\020\356\001\006~\237\243"
+	.string	"\367\256\332\376\303\247i\320\001#\260fB\237h\271"
+	.ascii	"\322Z\226\337\241\342\324\255\231?\300\244\213\227\247\002"
+	.text
+	.section	.gnu.lto_ltm_sframe.118.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\354\b]+"
+	.string	"\212K\030\020H\220XN:\205C=\025'E\001t\246\341\306\016\247\230\333\353\344\006S\316\006\215\257\346\177\320xz\312\326\372\367f/\177\312C\353c-\226\234\fd\200-F\004h\022\362\256\0038c\321\241;\323\321\326\214X\"M\356\224\002\357"
+	.string	"\330"
+	.string	"\354"
+	.ascii	"kR\323\222\372L\276\032^\222\236\324\352\342\215M\355RJ\371\361"
+	.ascii	"\343\377uj\337w\3622\024Gz\311\214NP\330\274d\023\013ckK\310"
+	.ascii	",\214\0219+\220\034\231W\025\264\213\331<\2538\322Wb\201\367"
+	.ascii	"\322\366\303\222\b\177W\310\352\242\201\017\344q\355\307\006"
+	.ascii	"\203\245\017\263\002&\025O\"<\262\2728W\027\362\270V+2\351\245"
+	.ascii	"1\034\211\n\233\367\022\367#\0073\317\247\311\327\225\b\347K"
+	.ascii	"\0373\006\n\230\254~\024\376\256r*\021\f\026 \265\"\221^\372"
+	.ascii	"\350|i+\273\314\221;j\316\253JQl\255\326\272\264:n\365\036o\247"
+	.ascii	";sf\211[j\345\347\232tYZW\357u\235\327E\203\356\n\340\200\301"
+	.ascii	"u\335\214\363\354\2051W4\261J\026\270\025\353\323\"\342~\265"
+	.ascii	"\326\203\275@\220\027\\\224\346\232j\255\246YZ0\356\233\333\016"
+	.ascii	"c;\203}\346\bm\356%\325\350\006\320\001ig\255\365\fz\220\226"
+	.ascii	"\234ZkN\300"
+	.string	")\300\212\td$\220\231\221\265\326\362\347\367\023\345\270\365\232r\037\265\034\237\233\026Gh\255\365j]d\366\354\301~\236\205\215YA\327\230\326\027\231\337\2365-\032\211\364\315>\224G\211\362{X\304\024}\326\224\371\362+\304\3038\244o\346\021\341\r\241I!g\225\266\331H\"]/\373\270Zk\365\346\260Mj%\223:\351\244FpR#\231\324G&\265\221I}\340\244.:\251\211\226\332\300oh\251\205J\352\001%uPI-\240\244\006*\251\177Jj\237\222\272\347\307\233\347_\367\316R\0030\251u\226:g\251qLj\337R\337,uo\251y%\365n\251u%\365YR\347r\324\246I].5n\251\003\022\314\227\bVg\034\212}G&\343\254*\371\211\246He;\343\333\207\235\336\254\320\372\226\222)\272\345\336z{\263%\030,#D7\336\366\366XAv\313C\233\260[\"1\276-\244\373b"
+	.string	"Q\335\332\024*\234\253\363\227G\231\271=7\t+H\017\2651h\240\317\312-\007\037\f\352)\267\231io\340@\237\345\337\212\275*\323\342\331\037{?z!sh\177K\323\024c\364\222o\274\365\262\323\020\335\257\334i\353\\\265\034\245b\236CJ\334\205&\207-\234\356Bs\203\332\336\034\261l\241\276\320\334\331\026v\t\323\334\016\324~\362@\237e\356\202\033\304\2752M\266\031\332\037\377\373\225\227;\264\324\254h\304my\233\231\273\270=\226\033\335\335\027\335\206Y\256E\b\204\2022_\322e:\330w\311\266\235m\032\356\326\353B\363_w\2721\244\001'\016\374@5\025\f\001\025%\005\302)(u\343\004\f:|H"
+	.string	"\242\303\223\022\016\360\003\325\0240\370\0244\341\024\224\352\331\203\322TPj)EU\0208\005\224\002\006\227FD=M-y\2502\261\244\024d*\022\300\252\245 \025U\325\022\0179\374\346\360\211pq\343\375\366;\270l\331\r-\317\203446\264\341\022M\200\032X\242\365\313\212D\2533Z\003/\373\216L\313\231\223\237h\216 \331\316\324.&P\214(\213\003\253\263F\224x"
+	.ascii	"\300\026\255\237\244\265(\331\344L\356&\235\005\260IG\313\263"
+	.ascii	":\001\314\2121r\366hM\213n[\216\2639{,6;\213\26380E7\2561\\\032"
+	.ascii	"r\rmH\333\220\216\264\376\2226HK\310\356\345\037\373\317g\374"
+	.ascii	"\301~!\r\b\033\232\322\266=\313L\322\372Vi_\334\"\262\t\255\300"
+	.ascii	"\240\222\326'\306\270uF\200\n-\202\365\305\034@`\261W\366\323"
+	.ascii	"\\\215*\202\204\200\274\250QP\350\f2D#\"IRRHc\300\002\221!\252"
+	.ascii	"n\022`\205-\213I\313\216\222\302\260\377\006v\"\002K_\274\373"
+	.ascii	"\371}5u\214\016L\333\002\314\b\355\3253s\307\223"
+	.string	"]\302\364j\244\030\203\254Y2\2677#p\354U\215\034&\004G4\310\n\\\262\333\002\242\315\214;\030\325\335\305\021\226[\200\326\020\330\253\016M\025\334\f\200\204i\327\034W\t\330\244\230@\331\rCdqR\236u\216\347C>\032^\2770\024\363\251Jd\246\224s\200\250R\366\027\276\227\250\314\316\263<;\227C\256\331\255$\245\324R\276\352-\350\272\324\226>=\230G\2479\017\373\243\304\341 L\322\272\230\274\b*b\324\233\023\026\237\202IX\001\036\336\356[2*`\304\372\002Fq=\301\343k7\217\327\373\356\207\213\006\3436\3543\345\327\245<\207\354\242\372\031\221\250\21407\220k-\236\335\377\363\307\316G&8k\002sy\332\277\364u\202v@T\036\2609\333\217?\273\277\302\002\321\322\243\347\321TA`\022te\330\211\330u\\\235\202\213\266\300\211+V*niDd\270~{NT\234^\236\231"
+	.ascii	"\244\243\033\371)\234LA\374\361p0\267\\W&\312\333\032=\034\203"
+	.ascii	"\270\262T\330g\343}\322\344\024h7\017\375\003"
+	.text
+	.section	.gnu.lto_ltm_aframe.119.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\030\002\355\017"
+	.string	"\026]eE"
+	.string	"\223\223\016s6\313\266^{E\267\b\177\034\254>3\240\n\334RGg\262\244\375-S\001\307\274o\326\302\212\3679V\006\356\255%\371\253]M\362\021\326 D\270\276\211WF\n\026l\317\210\221md\023\231R\nN"
+	.string	"G"
+	.string	"["
+	.string	"\371\367\177\r`D\343F\202\0371z\350\021\022m@\034\022m]\3238\266b\023=\351p\2065\315J\313\031\232\253\253\325\341/&~`@\264\324"
+	.string	"\2111v\tc\227\357\252=\343\315sy\371\037\0051\306\336s\371\340\246\333\026hk\240\375\027\267gX\243h\206\316\221\0211\330{:\272\331^\024\256\216\326\2562\334^E6\344\253\2679\201#>H\373\261<E\264\316b\206h\265\327\224\275%\370\222\262W\224/\3677\364w\313^P\276\237\277\332_\230\275Y\276\001\333K\314\241\0265@=h>\036\036\243\035\021\227\242Pr[\206\"\370&\206\315\226\003\372$H\313\217Y\030\246&\3010^\270\2008\245g\331N\240\220\231=3\3352$\344"
+	.string	"\232\363y\240C\t\226\367\264\255\340\032\223\221\230\026\345\025)\0029b\214\bRX\205\205Z\306\260'(\001E\221\250Z)\235\006V+\245J\245\244Z\335\205\023\023U\207b\251t$\002\272\302\220bu\255\325\212\325q\037\3143^\340\343\343\331\001K\226\016x)MY\307\0304\270\275\212p\310W\353\035\317PqPR\242\031\232r{!e\251\226\341\234\007\265L!\234n\357\244\031\2222- \260\002\251\241\352\006B\300\032\016\221a\333\246x\b\2705\371\315vx\032U\262E\334\375}\344\232\335\237\025\367\026\317X\351~nt@g,\217[\262Z\220\335Zr\270o\250\276\"\234\361\355`vR\252\227_\343"
+	.ascii	"\350\341\221\3510\3327\222\f\342\001\374>k8\243!N\360\200\337"
+	.ascii	"\343/.\003\313\274h!\031"
+	.text
+	.section	.gnu.lto_ltm_oframe.120.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\033\003\275\024"
+	.string	"\306#~I\300\322Q:\203/\031\"L\277\251"
+	.string	"\224\237L\315 \367\200.\207_D\361\017\251\303\r\236?\334\231e\033;\332\037\2758]o\263\n\356\277\234\322d\021\3316\262\342\246\246O\032\340\r\027\256\327\333\221o\313\267\326\330G\312\224\002e"
+	.string	"e"
+	.string	"j"
+	.ascii	"?2\337\361\307\224\244\025s\316\360\322\266\355=5\221\3338i\026"
+	.ascii	"\360j\034\270\024 bd\365>N\240@\346=\265\217\223\34678\343\016"
+	.ascii	"\323\234#\202K\033H]\372<2vx\271\241mv\217\217%&*\207\227k\301"
+	.ascii	"4\347|m\316mW\233\177\336U\272\232\333\025\2052\347\264"
+	.string	"\352j<\334{\333\005l\237\330\233\"\024@\273\245\202\370A\245~q\027\201\266\f\203^g\221\r{\263\0225!Mm\262\307\031]\022\366\001\314\035aK5\210T\213\240\332%\325-\251fIu\b\252W\240Z\265\352\324\252U\252\037@Tqt\2224'\315\323\217i$e\240\360\207\336\213\371\216\227\307n(\306\016\205\202R\222\230RS\007\325\313\341\371\036\337\326Zs;\033\016\326D\fq\237\237\367\006?\243\237\017di\\\347\203\350\342\202\354s63\372d\177\306\213j\017TT\300Kq];P6H!:r\327\372?\020\"p\330\233}\030\217\001\343\233\360\nL\257\203\201\227\256U\355p\372\344\377|\325\003\2014>\265\304b\376\224\376\032x\237\213\340\264\311\"\316\315]\334\246\245~.1a\221P2\201e\205D\314p\303H^h./\r3Z\354%\346\022\243\275,\264\254\274\274`3\230\027\311"
+	.string	"\313.\304f/\232L6{\205#\356\2743h\352\360\363\341v\306!\232Z\325\372=\035\252U\355X\233\332\347\234\336\373\252\207#\265\3043\376\224\246\016\220\217u\324\332pY9B\335\325\372B7VBA\007\272Qp\253{\336\177\"\347t\002`F\250qD\207\f2J\005C\022$\225\222\246\003\240\002\031*\263\r\021\200\271c4\022*h!m\006\243\275\274\002\204\224Z\230\245/\215\314"
+	.string	"\367`\342\376\250\370\223C5\323\037\301}\262\206\n6\2405\212\212\2642\371\350!\315\205'\254\r&\243\212\307\3402\360\305FG\214f\312\266T\351Q\372\277\352\315\350\023\357\366N\330.\244S\210\r*\177\003\240\"\357\230I\017\324S\004\220F\356\017`\263\013N\243\b\255\213\212M\241kB\375t\027\232jb\235:\202"
+	.ascii	"\372N\034\034\277\260i\032"
+	.text
+	.section	.gnu.lto_process_ltm.121.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\212\001\245\r"
+	.string	"v\030WB \217\223\016\300bI\227 \354\305\320\247\276\221\031\b\347\220\276\f \016\342O.X\034\203\023\222A\353f\213>f\203\356\332\355,\324h\004@\032\002E"
+	.string	"\241\265\006\241\026\270\b\334<\230\337\366\3362\245\024E"
+	.string	">"
+	.string	"D"
+	.ascii	"eaTJ\324\240\264\214\200x\021c\264\022\305#\303\347\362\243\332"
+	.ascii	"'\003\3206\021\303\013~\233\3154\341\316\202\323q\220l\3206["
+	.ascii	"\346\016\314\220p\341\223Oa+\375\232\0041\306^\333*\270\032\267"
+	.ascii	"u\320\326@k\2311%\244\257\312Qyo#\204\334Z\013d)RN\207\247N0"
+	.ascii	"\3610ZT\366<i\355b\232\264\177\341\337\367\327\375\315\277\377"
+	.ascii	"\353\r\007\205\n\004+b$Y\305\210/\217\205\203\357\326\033\035"
+	.ascii	"5m\203\217\023\357\003\237\fVbJW}\370S&\234\306[\314\023 U\302"
+	.ascii	")\252\231\021\231'u\007\272\364\311\0310+2\245\253jw\240\323"
+	.ascii	"e?R\222}\325Z\305\036>\265\206J\b\335\232_\035\202~\316\001\001"
+	.ascii	"\365\350\300D V\bHta\027\310%\262\036|,\300,\017P\310\352 P\017"
+	.ascii	"\204\013d\211<\036\220\265\201\"\331\3054Q\220\342\205\224Ya"
+	.ascii	"\212\260\326B\303\035\370\022\346]L,\231\213\375\201\231/m\302"
+	.ascii	"\220}\025\"\223#C\013\024\360$ \220\002\241)\353\001\263\241"
+	.ascii	"\345\013L\352N\353\242\344Au{\r56#\321\256\033'\262C2\004\304"
+	.ascii	"\020\344MU|{=\234\r$\034\350R\244\2102\267\f\235:agg&50\213\351"
+	.ascii	"'\312\316\302\276\031\002 _\325v\nt4h\323\b\2601\246\024\020"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_handleLtmTelemetry.122.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"\345\f"
+	.string	"\326\027YD\020\221\223\016 \006K\332\340\"l\217S\345\225\n\203~\f1@\2007\271\256\021\032\r\r;4\b\377\310\"\177\353\270\251w\302\307\277\367\025A\004"
+	.string	"\330$(\fPV\231\024\207\036/\\\261G\320\336[\312\224\002G"
+	.string	"B"
+	.string	"F"
+	.string	"+\035\024`fv\027S\020\327\016\237\246\346o6\324\341\245\341\357\035`a\001#\300\246\362<3J\264p\266\225\324\007\302A&\003gKy\037\254\226\032W=+l+\231\036\"\273\353Lm\030\356x\333\013l'\260\317 V\027[\323\232\351G\001\033X\n^\354Z\350j6\006tA\302\366\355s\032g\300\366\261\257\362M\374\204v\024\023.\324\205k\265\252\271\261\313\03184\310uX\340\037\361\360\335\023\017\255\3316\316\205\330\007\240\227\026\314W\234\"\220H\361P3\246\313\0268X\035\324'\361\nz\241\241\2224\366S\\\305\211?\302\022L\371\324\241o\212\207W"
+	.string	"-\026\224\354\334\241\351\314\\\365ML\016\031\233;l\016\225\352\301\276v]\327\005\016A"
+	.string	"j\020\342"
+	.string	"4\362\351\2302\0235\311GT*\301N\243RH\024*\t\2250\223\007#\"\214dD\302>\004\234A\b\215\260R\226\2150\016\267W\027\021\024My\273\273p\223\266(\313\247\254\212zK\204\314\207w\212\252\001\026"
+	.ascii	"u\221\"34\235\303]5\031\2560C\373@\024P\f\030\002\002\206\254"
+	.ascii	"\223@\006Ti\021\267|\210R\363Z\320T\270 \004\026\013\307\245"
+	.ascii	"\373\252\251Q1u\006"
+	.text
+	.section	.gnu.lto_freeLtmTelemetryPort.123.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\245\b"
+	.string	"6P;7@\217\322\001"
+	.string	"um\007\374\004S\205\007+\026 3,R\332\022\353\274-9\255EK\220\365cJ\206\r\231\"\2601\216\252\013\213\356\266F\240\f\bbSzw\3332\245("
+	.string	"+"
+	.string	"-"
+	.string	"\326\230\263S\376\235\366#%\n\324jw'\3148w\345\374w<\343\215\272+@\302\356Z\275\221\305\ro\373\3006\202\355\226%\221\266L@\272`\261\254\272\330_\247\020\303>fw\327\320d_}yRj\265\242@\262[\321zY\223X\262a\373\366=8\007(,\363x\344\343\300I\365=$C\002PT\002\034'R\017m\210\b\275g\203\t\330\331\3778H\310\327\360\007\244\367\036}\220|<\314\004\346l\260\2553?\332vaW\347\332f\003\303\00269\332\303\334\0248s\270\264\271e\23165\337\036\263\320\024I)\226\212\bJ\330\307\244/\362\016"
+	.string	"3\241\375\037\370\324\\"
+	.ascii	"\333\274\220\027\006\373B:`\211\251xhe\203\271\262P\\\006\004"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_initLtmTelemetry.124.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"5\b"
+	.string	"\262\21776@s\322\001@\004\210)\215\360\325\025&b\316\037\007\307\243\370g\002\271\312G\303ZP\2339\031\032\244\200bw\220\340\2661\t\327\330F7O\340\313\374J\244I\231R\3068\031\347\201\240\215\213Y\364D\016B84d\020\333$ \247\300ZD\334 \247i\033\274\276\375f\265\244\300\202\022\251\205S\375\222\233`\261\323y\271\362#\277\332\017Y\336Ke a\250\\}\222\177\025>\210\265O\345\177\254Wi\362dD\231\262\225\003\237\260l\nP\336\273.\220.4\344<\245\270l\322\330_(\265\303\376f\265dg:\237~"
+	.string	"\301JK\302\311\256F\252fQ\325)\304\366/w6\314\277\217=\nG\206ifw\241z\274{v\376E.\340\215BO"
+	.string	"\204\335uz\243\215[o\333\300\366\201\355\230\017"
+	.ascii	"3\241\347\037\030\322\\\005\266\201\024\260\267\020&\300\tAh"
+	.ascii	"u\240VqaD\030,y\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_configureLtmTelemetryPort.125.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\200\002\215\024"
+	.string	"\366%\207G\300\222.t\352\376qX|\3454pm\366E\336\256'\333\215\310|[\200\352xd\234\367\241\337\314zm-1\242\227f&`\310P\030p\273\005pp\230\351\255p\314!\272-\213#x/$\363\364\324\310\336[\312$\003q"
+	.string	"j"
+	.string	"s"
+	.string	"RZ\033\200c\345+\036\345\273\260g\366#\232a\005AuuO\035\270T\003\263K\224\237\314\313\370"
+	.ascii	"\363R}"
+	.string	"\252<>\305\324\277r\002\262\002\353n\033\227\270\357\262)#\257O/\022\374]f\364\351A\026=\226\004;D\224\356\256\005\177\226\243\002\025\037\262J\202>\261v\365\365t\251\357P\020hW\306\322\335\272B\301\020\327\331U\225\203\252\272\250\356SU<\272Yw\277\351r9\201\t\341\016\177l1\t\024U\\\2743\317\270\026\\?\013D\365Tg\261\243o\322]\316^\350R\2373/\317#\\\"\200;\246\227zLQW\230W\257\230\352\324oyI\365\261\273[YI\225v\341u\316U)Wc\\e^\335]=\311\217\222\300z4\370\352\0061\026\244s\310\341\211\013\177\325?B^\004V\377`\356#Lf}\314\004p\t3\262\352\004\n{!\311\261\217\370\247\252\025\236%c\242\003\001SwG\346Ar\022\002w\214\367\027\267Y\367\317\212\376\352X3Qs5\263f^2\223t!9\rE\206B&\263"
+	.string	"\345\276g^x\231\244\221a\330eh\215H\021{&m\207_[4\276\360(\300\025\323e\032\257\025\320\020U\233[]X\240\017\252\302"
+	.string	"G\243b\001wK1\321\220\243\301y\311\365n\020h2\334p$:\223\242\353\335\3306\360z9]\356&\327\263\341\330\334t\266\031\236\216-\245\200\3560\344x\266\336n\307\263\325\246\372\261YIY\200\354#\343\245\267L\275\326m\264\350\233\324\345e_\346\245"
+	.string	"&\037'GD[\203\352\006\322\344%}\224\021\214x\027\027\t\202\002\212\3014\236<\2443\345\211\221d\375\214\323\320q"
+	.string	"\003\263#0 p\002!\261\343\003\207F\240\030:\\\214\323/\321\317\016\263\263\213\313\230\023\302"
+	.ascii	"\270\355\036\303\377\004\033\226\374\026\221\fK\346\312l5\023"
+	.ascii	"\365\210!\361\004P\031\262\370\303\203\311\201\321\030\257\025"
+	.ascii	"c\306h\313\355rj\310\342\320)c4\002Q\300=l\342\220\243j\b\240"
+	.ascii	"\033\275\2203k\360\200\3373\177\331\276`\276\261M\227\365<;\016"
+	.ascii	"\273Y\256w\205="
+	.text
+	.section	.gnu.lto_checkLtmTelemetryState.126.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`H\003%\030"
+	.string	"V\253\232H\260\030U:D\330Vy\353-\340pq\004\bt9\311\231\002\013m\2204\231\020\216N\314\367o\260\227n\320\266^?\236\260\267\tu\256\201\305;\223\t\301\267\203B\317\327\321\227\343\353\n\361u\265"
+	.string	"\326\265\215\020B\344N)\203"
+	.string	"\177"
+	.string	"\202"
+	.string	"\244\027\220N\372BR\330\247\223\367{h\366\3114\333\312O\034\365@\302\034\"Zj\255\253\275q\332M%\222Y\222\343R\232_\273)x\nD\324\023\244d\302\324p\321;iH\207\267\243\346\370"
+	.string	"\211.IJ\2273\002\370a\345w\340\023\374tz\264\274\255w\362?\235\236\n:\252j\255'\035\216\3568\200'$\246t+\306\006\304\235\336yNY\350n\224\2320\265V\323\234\316\305}\272m \2665\330\013!\255\237*8\272\305\376\317\207\334\370:|\242\206>WS\236\374\242\250\354l\264\350\363\274\003ohTT\351\221}\336\350\372\354o\261X,zm\330$u\352>7\212R\233#uI\251GJ\275K}\001\nz\310\210\221#h\247\234\265E\221K\035\222Lx\334\347\267\357\013y0\305O\217Yv\265V\"\024~\276\307\007\032(B\301>\320\017\"\320\356\203\243\252\235\265\305\204\240a\217\226ZO\006\017\3533j\315\225\375PYb\256\202\034<\250\275\317U6z\344\002\264\\\373\003\b\372\034jU\270\255\331\017z\222\020\"bb\312\223\345\322\241\214\035\007\236$\005\306\021\243\"*$\356\354\312"
+	.string	"\324\226q\321\347\274[\273\241\b\211>\310\365\031\371\2702\240#\301)13S\236\0347\205\022\2321T\351\221\277\303\023\022\215\353\363q\312\335\377L\364k\303b\364\271\335\030\032\270\255\235\022wxJv}\376M\371\rv \2415\302\001\211\026\353%\200\313\346\305\3620\302\365j\261h*p@\341\2429`\231\027\330\354\265\272\221\315\\0\327\3135[\321\314\260`+\031Y\315\352\005\201c&\\\262\325,\026\223\255N\247\355c]\033\206\261\355m\254\265V\323\372\242\020\300Q\340\305iTt\233\362I\212\b\213"
+	.ascii	" \bhj\375\240\205\013M\356\304\006C\206\f\345\311\324\226\202"
+	.ascii	"71\3711\364\363 ^T\243+\003\232\2246\250n[sJh\311o\347\260\013"
+	.ascii	"\t\2652\224\020p(\247\026<2\003F\250a\030\006\031C\214\261I\242"
+	.ascii	"\2444M\033\200\002\2411\273\r\020X\310j2\214\001C\204\357Q$}"
+	.ascii	"\230\346O\220H\346J\233+\b\373\205\305\321j\223\237\203.\357"
+	.ascii	"\304\277\325\033\026\020_6\032\315\360?P\225\211\244\203W\266"
+	.ascii	"i\030e\316\336+\304\204\201\020GOum\220\232\b\301 m&\237P\203"
+	.ascii	"\247`\331\016\341\363\350\206Q\300]\263~\271M*\322\2507\032("
+	.ascii	"5\343\304X\352\344#\372\243\267\252H\3109M\013\305\203\335\371"
+	.ascii	"\342=\215\211.z\323\327a+\313\365?"
+	.text
+	.section	.gnu.lto_handleLtmTelemetry.part.0.158.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`<\001\345\r"
+	.string	"\026Z\\D\020\2176\035@\204]\300\n\222\254\n\200~"
+	.string	"[\250\276\3273@x.\3536H\374c\232\237\355\253\336\376\353\366?\363\363\372\016\233\0266\340\252\252\256"
+	.string	"bI\261\253\216Q\224\307J*\022l\004z\320&R\246\024H"
+	.string	"G"
+	.string	"F"
+	.string	"'p=>\204\355\017\311\236\355\342\246\225=*\206\005\027\030\273\313=*\207{\2674\243\347g\200\240[\371\201\031\256V\207\n\305\213\001\340\310\3428\361\360\375\364\274"
+	.string	"\21227\036\001\200\354\2561\224\373\272m\006\266\027\330g\t\326\r\266\246U\323\371\360~\200\002\tR\354\236\254bV%\246><\274\375\360\343\237\234\371\363\026\217\265\221iA\322C/{4"
+	.string	"n\366M\276\210\217\360\336\342\301@$\f\205\212Q\355\232\024<\272\003{\324\316q=Z\001\367\\\252\031\022*F\371\342\324\253\352+\200\020\345\312\276\313Kx\374\016\356J\362_\311\365\230\252\301\222\022\312\2253\205r}x-\2240\276\322\236`\222\377\256\037*\"\005\371\247g\2440\254\330\204I-Y\343\255\335\335\366\370\3104\360p\220\t\3314L:\022\265\310\266\351\214p\0248\035\315F3\242\351p$\017B6\234\bG\002\267\035p\027A\303\341:]\307\3412\333y\220\220\212\254\226\226\324\004\202\026\033)Y\332\0206\371\317\232\200\224\006\375W^T'TK6\213\035"
+	.string	"\341\""
+	.ascii	"\206\301\026v\213P\2546\243\265\342 `cp[Ck:2q\fW\341\321H\220"
+	.ascii	"i\251g\240I5\002\336\003(\342bEg\347Re2\225N\\l\353\264\320f"
+	.ascii	"\312N\003\301\265\327\"4M\215{W\031\003"
+	.text
+	.section	.gnu.lto_checkLtmTelemetryState.part.0.160.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`Q\001\245\016"
+	.string	"\006\332_F\360\262&\035\240B\323\037\305\031+\233AM\312H\314j\347\017\221\377\\S\217\253\325\013efE\351\360\361#\242b\322\337.\310\324\0377|D\016'\f(?\022rl\\A;\213\337\377\360XAT\214do\271S\nH"
+	.string	"J"
+	.string	"N"
+	.string	"\316>\217\3026\n\306\237\235\343!\315\336E\216\006\027\317\356j\237J\342\337\245\306\371\371"
+	.string	"T+\2271\245\342p\225\003dr^\"*\027\271\340\305\362p\360q\203\252%F\001\237 %\273\353\220\0167v\333\022lO\260_\"=?V\304\224q\342\255\337\276os\227\312UX\356\210\331\335\254\365\024>\016\352\241g\230\021\227\311[\007\375\233\221\025&\366o\314\240\301\367\320C\260\022\356\313\003\035\0325<\273\241\202O'\b\371\364mT\356\203(;\363\301\317\001\237\007ht\210\314`\325\270\276\310\020q\244vL\037\226\307\316F\037\326\307\027K&\206\352\312>a\327\277pn\270\304\036\366Y\274\305\3117\341\024S|\312\204}^m\214\250\t\001\306\260\304\236\250+\353\274\\\235\261e\3641\002\020@\354\276\004&q"
+	.string	"B!\261"
+	.string	"\332>\0018Sh\253\200\302\205@\333(\002\205\0237*\340\223\217\250\024\322<R\211\023q!\256\244\215.l\"\355\204\224\242}\f\270\303\300\221\264R\327\221\264\314v\274\316\270\204E[\254\227\273\273RW\3670_\3470<Q\327a\001# `\002\031s\274\001C\361\343@ 2\204\314\325\020\223\330\246&\267\321\310\231!\306nB"
+	.ascii	"I\210\214\315\267\207\212\026\306dI\336;\024V\033\222k\017\307"
+	.ascii	"|\326\352t\003L\247k\2021\375o\361\222\267\264\266\214y\373,"
+	.ascii	"\204\265\367\024\232\266\343\336\025\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\021\004\265\020"
+	.string	"\306Y`E\360\224\223\016\3608U\341\204J\003/\3730\334N\320{\007\336\t|\345i\017.\373[\005p\276c\243!\023\241Y\361\"\262\211l\004p\027\301XY\004\034\361\300?\022\004\351\316<\275n\250\033\3426\311&\267L\001G"
+	.string	"O"
+	.string	"J"
+	.ascii	"RN\226V\030+:\303*}$/EK0\212\212\340\223N\255_\304\200\232(\320"
+	.ascii	"?r\"\240\222\263\276\221\223>\221g\352\017y\003\356\203\367\327"
+	.ascii	"\031K\027\302\377\255(e\304\361\367\257\243F?1\306H\352\357\274"
+	.ascii	"\377\214\005\212\002Ck\212\013\255',\364\273\n\255#(\264\222"
+	.ascii	"\320\030\343\257Mh\245Q\t0\0218\360g \374\206\037\364\227<\007"
+	.ascii	"\252\202\033\364{\036\203\007\341\005\377\301\n\372J\022\364"
+	.ascii	"\223<\031sl\327u\035\202>\317\201\003y\321\032\227\326\030-\032"
+	.ascii	"9\006\0378\231\251]\233\311\223\324^[\342N\327\226P\277v\264"
+	.ascii	"\241\\;\342D\023\2524\270\226L\351\007n\314\341\2068\215\027"
+	.ascii	"$a\312\222\313\033s\336l\033q\241im\237\005\251\254]hM\335\276"
+	.ascii	"0\255,6\264\266\320\320\272\"C\007\017m*\331\202\244*\315M\217"
+	.ascii	"\036S\266p\352\303Y\331\270p\311\276\003gu\003@\266:\365\255"
+	.ascii	"l^\344\274dk\262\351\312\260\241\322i1\255\220XH\353A\200N\r"
+	.ascii	"\0363D\001\266C\212h-\024&Z\230\202\330Z(U\032<;9\027\2662\214"
+	.ascii	"m\b\016\304\fV\2501\024L\261r\222:5\032\003\020\003!)\325\001"
+	.ascii	"\021\240\220\006\0216\321H\334\204\251\003\370\360\207\375\352"
+	.ascii	"SNDL\363\314\313a\247mzb\343\216\b\342\320\211\024/\364\327a"
+	.ascii	"\337\214\"\035\263_y\024r\341\004\262a\211\345z\342\211\221\276"
+	.ascii	"\326\353<\r\374g\335\265\340\b)\f8N\274\350l\032p\260\334\330"
+	.ascii	"Y\311\023\331E\177\013\212\"\022\253\326\322MY)d(\367\240\341"
+	.ascii	"\207B\335\327\241/{w\357\226\031\220\230S\324BH\334N\204\004"
+	.ascii	"%\367\360U"
+	.text
+	.section	.gnu.lto_.refs.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"\325\006"
+	.string	"f\0220+pI\2224\006\2543\240\036\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340!\001"
+	.string	"\214\024\006\b\037!k\250\331o\177\255n\266Y[\253mk\215\264-S\037"
+	.string	"%"
+	.string	"%"
+	.string	"\033\250\007l\243\355\250\025[f\037jJ\214\266\320n\324\211-b\210\222\251\227:\325\265M\317A\r\314\t\021"
+	.string	"S`\333\260\037u\3430c\353lE]\016\243\352(#\224\2232I2\330.\330\tj\004\333\003\013\225gS\355\030\003 \031g\023\347\242.4\35343\315IS\221\256@a\302.!B\035\302\366\203\335\240V\2208\023x\366Q\013\325\213g\006zy\036K\206g\031\265\213\350r\024\220*\320\"\2161\324\345\331\244\266j\003y.T\b"
+	.ascii	"\254\021%\350o6\bq3\312\250py\342^ZB3T(x"
+	.text
+	.section	.gnu.lto_.decls.3aca320fc43dfc8,"e",@progbits
+	.string	"(\265/\375`\325'm\256"
+	.string	"J\017M<X \fIJ\035\363Y%!\341P4\320u5]$\231dt\266\372\341\365Eo\262\3643\351\320\335\367?\360\362\323\210\325\210\360\r\310\262\267t\017\0204mDF\001\202\341\327\302H\277\335\304\3055\223+L\227\025r\\w\034\202A@m\034\375\277\365R\030e\242\267L)\005K\003\245\003\312\003V~"
+	.string	"q!K[Kj.GM\230L\232\270Y\226\036\233\273\031\301\013>\221\277y\325\325\234\f\270\272\013\3029\035\006D\314\021\234\325\356W\372\023\177\364H\237\364\312\317\317\374\2457z\024_\364\3117\361K\227>\221\327\265Oq\273\306\211\346\274\31497\002\272}\b\0227\273\322&\366\332B\021\354'\362\027\\\212\253}E\200Z%.\347h{V\267'\351'\3623w\001DQ3/\271\344\004"
+	.ascii	"U=\222\342.\347"
+	.string	"\350\007\234\017\037>\370\356\250W\254:\254\256g\305\355\006\215\351\026\276b\345%\312\t\"e\277\272\025\030\025K%a\277\372\235\343\301\354\341\355M\177\255rQ\370\250\033\3735\n\\Z\302\361l\263\025dXKt`\226L\375\032ts\276/\251\024(\321\265\205'c,\310y\\\306\361\375h\022u\266\002\367+a\030=+\275\274_\373\211\360\252\003\354I.\212C\211\321\206u\342\016\267\323\341\027+\037l{\277\372\023o[\265\23601Gt4\326\330p\373\022\334^\206\333\275p\373\025\236\231\302\335\356B\032\224\005\255\267_]\211\243\271\224\203/\271I-5\031\240\036V\223\025\374\332n\003\267s\360\371\236s\360\265?q\007O\201\333\213p\247\200\235\210\027q\251\007/k\037sj\273,\243y\352\322F'\343\353\327\026\302\355\036|\356\301\327C\334\301m|\253g\360\355\250\271\215\317\203\264\200\224\205\365kW"
+	.string	"\267K=\314\301X\314\202$\243\2768H@W\2019g\345\2341\270Kn\350\230\376\332S\332e\005\242\303Y\343W\327\362-\227j\340\323v.\357j\026e4Gs\216\312<\216+`[\277\316\270\215\357!\200\3335\360\335\275=\327\300\007\f\266G\373F\231\023\3200\270\037w\3243`y\026\207\313Dz\346\257\234\24342Q\026I4~\355\250\333\370\260g\360\201\200Ic\202\227\351\366\261\217\001v\337[}\030\346\334\003\rpe\240\374\257\333Ct\373\002\272\335\331\355.\376\245\333Cp\005\274\313=\300\373\272]\311\263t{\023\223_\273}\204\233A\221\2774\375\322}9$\221\312\256w{\361\277\333I\360\316~wL\367Oq\241\357\365M\367+\001@\267s\350\320\355\026t{"
+	.string	"\272\235\250G\203\323"
+	.string	"\350~\261\376\002\353v\260+\335\336\001+\335.$\017\317\253t\006\335\317\246A\031\027\001\272\033\003*\335\357\243\333\273\246\324\235\320\277\356\247\353v\270n\217\322\355k\335\216\326\355e\335N\355v\261n\017\353v\257n\007\322\355S\335^\243\333\215\272\375E\267\263\350v\025\335\336\324\355\315nW\352\366\334\355H\335\216\242\333\231\335\276\354\366d\267\243\240\333M\320\355C\335^\242\333\333n?v\273\261\333\201\272}\004\335\356\323\355\"\272=\004\335\016\202n\377@\267{\240\333E\350\366\022\272\335"
+	.ascii	"\335N\323\335O\272;Jw\007"
+	.string	"\351v\022\272\273\254\273\273\272\373\255\3331\320\355\027\350\366\tt{\005\272\235\002\335\236\323\355\005\350v\017\335\256A\267c\350\356\254\356~@w+\351n\231\275\275\275\275n\226\241\356\026\016\2721\270 \357\346\322w{(\253R+'Op\346\334\300\321\354Z,\375\372/lx\031\013\342d\022\303\355\233b\rWN\234|[4/!\251pU=\236dqlkM/d+\254\341MM\355\327p\316\031\r\312\244\177mm\002\244\315\315\314\227\266d\005\357\327\366Ea\234dZ\232\203Y\251\371Z\340\032\247`?\232\364\321\276\3512\263\322\t\004\325\023\256\352n\t\327\024\t\366\237\271\364\317\274\272\323\022F\224#.7\243\033\264\317\b\343\330\b~\331\233\365\033\221\276\221G\342<2\\\325]v6=t\377\021\227>\022\026,\"\321\026U\226';)cf\270}Y\331\31497\261Ds\223\b\330\316\3420~]"
+	.ascii	"\335\275\346\333\335\027d \347$\032\264\016\353\030S\302\350"
+	.ascii	"\220Y\324\232\314\251S\022\004'\246\245S\013\346\324)'\2279\222"
+	.ascii	"4\315\354\224dNs\246\311\313e2\002\317L\303\234f\246lb\215\311"
+	.ascii	"s\324)\231\227\317L\223\227Y\331\201\271tbbN\225L4\314\251\023"
+	.ascii	"S\236:\345\231\274T6O,s\223&O\235\344\362\364\3114\303\234>\231"
+	.ascii	"\230S\247\027.\205\031\005\217\351\b\364)\207'\231\313\254\224"
+	.ascii	"\024C\331\234QcF\237\331-g\377*\312M\001\344\034\343\331tS\266"
+	.ascii	"p*\221\232\022\221\020\345\3237$\021==\363R\215\271\343\231\363"
+	.ascii	"\016\242\237\234\324A2\252\226m\270Z\222F\214\214T\224\263\005"
+	.ascii	"I9'=\253\345\234\2239\347\226f\214h\316/f\230\320\244\244\234"
+	.ascii	"\2358I9F\222\254(\347\377\202BebN\237\236A\262\256)4\033E\223"
+	.ascii	"\016\315nNM<MJ3"
+	.string	"\022\035\2062\245\230\3735\354\211\370\234\330 \203\342\364T\273\243)G~m\226$<6\244\307j\306\364&\367\353\013\371!V=\204\264\331?\233>6\3522\310\207m\235])?\254\257\222\305\2221\260/`\327\022\025\226|\275\327\2139\031\322_\273|I\232qO\360\360\326k}\364\201\374\364\245.}\256\317\352\367\341b\275r\371\333_\215\021)\211{\350\017\027\240S-x\365F\241-^Oi\\\217\345^7J\305F[gq\257c\207Wc\2223\231\250\311\022(\327S\345\244\\\007X\321'*pd\332\250|%\211Y{\r\303\300\225\007\356\365\306[\371\324\313\306\232\002\177\325\363p\351\367\350\f\363\203\242~)\177\035ji3_\257I\334\027\016\367\327E\202\233\212\304mX\220\3022\362\364\365\353K\375\257\3609\372\245\036\007p\371Rk\316J\367\fb\3343`1\223Rn\371\326\276Dp\367\337\360"
+	.ascii	"S\245\215\250\207\r\r\360\262H\220\254\217\252\361\013\203\322"
+	.ascii	"\r\371\225\305?c\22439\347\030\213S\341\241\\\3725j\274\323\323"
+	.ascii	"p\265\250\365\n,n\303\2075\354\356\351\314\267\366\323x\030\376"
+	.ascii	"\324\320\322T&%\362\253s\005\373\2372\370\232\316h\376\272T#"
+	.ascii	"EV\206\340\366\256\030b*\370\025\374\f\227\376\263\373U\374\212"
+	.ascii	"~\247\266x\0301,9?\207@\377\3712\036F\2142\232\233%\b\201qv\227"
+	.ascii	"s>\376\200\312\303k_(\356{\003\277\363]\270t\303\277\3102>\027"
+	.ascii	"E\344\204S\220\263o\360\371\336\236o\360\365\235\201\373\266"
+	.ascii	"\300;n\343\363\365\247hj\261\001\005\257\352\233\372\231\200"
+	.ascii	"Ro&\\\374\372M\034\227S\n\302\364k_\024\270]lm/\216\212\3575"
+	.ascii	"5q\306Q\217\034e\031A\202\222\271Y\314r&/\237\222\240T'\001w"
+	.ascii	"m\307\263Q\020(\2458\230\033+r\030\271\320w\3552\241rD\326\306"
+	.ascii	"DmE\023r\304\006\245\227\004N\n\333\3740b\344\2421\240H\363\211"
+	.ascii	"\212\007\360p\302\245\244/\332\027\301^QVO~\275G\356\231\216"
+	.ascii	"8\250\261{v\223\250\235\261p\352\332\360u\306\204\344\263.xc"
+	.ascii	"\212=\031P\214I\227\230\023\333\300\021!r\313p\216<\237\250\270"
+	.ascii	"d7\366\360\212"
+	.ascii	"\364-{\251\001#\231\345\242fg\007\303\30479\306\306.\325\347"
+	.ascii	"E\366\244\352\347T\222e\204jv\241\360Pc\301\t\276A\022\"\344"
+	.ascii	"\212\325P\221\265\305x%Jcb/\3452\245\343\t\211\n\337d0\260\033"
+	.ascii	"\206\363L\312y\230b\262\226\346\"#\314\005\331\257}\303\334\353"
+	.ascii	"\005\207\264\bh\002\3378\203\322\226^/\327\312K\276%\245\305"
+	.ascii	"\225\207\225\n\223)jW_/\314vg\345\304\257W\353r=\216\262\026"
+	.ascii	":\270\372N\221()\301\361\315\374\"HY\222\273\345u\300\031P/\236"
+	.ascii	"\374\252`\fP\301\276:t\\  8\243\271\251\003LUu=\300\250\2222"
+	.ascii	"\220\373\303(IE\325\257>\256\227\221\026\362\252\270\357\216"
+	.ascii	"\036^\215\2719\317\200\203v]\253KU\275V\267\312\275Z\304\310"
+	.ascii	"~\030\311\272X\367\312\245\327\352\362X\343\224\200\324\341\265"
+	.ascii	"\177d\270\177]\270\177S\334?-\214\363\303\302\030\250\202}\243"
+	.ascii	"\242\356\324LQ\323E\211\355*.7\221l\3402\247\202\305\335\235"
+	.ascii	"\272P\227f\265\311\332\257,D_\005+Z\277(|\245\256\n\356\n7\n"
+	.ascii	"\235\300\323\225\270\234s\016\227^\251k\303\201Sd$a\254k\337"
+	.ascii	"\025\252\"p\221!c\215\350\327{#\330\027\207\033\023\331\212_"
+	.ascii	"Y~+p\377P`\f\\\301\2761\2447\306\255\341\031j\0016\254\270\334"
+	.ascii	"tn\020Se\b\023\372+T\f\025\332\221\264:\374\344\322K\343\316"
+	.ascii	"h\2774\256\n\256Sf\352\200\214\251\252\356\356\0030\312\t\253"
+	.ascii	"\260u\355\353\324}e<\324\253\"\310$Ti!\353\327\373\f\366]\201"
+	.ascii	"\257\0073\357\352\327\2272\334/?\360\357\005\212e\220\004\373"
+	.ascii	":\333y_\200\360\365\314M\f\230\212\261\301\372\365\302\210\312"
+	.ascii	"u\341]\321\255\262_\243\323\032'\017\245\032\370\246\214\005"
+	.ascii	"\213\025T\234V\205j\341\327~A\3025_\301\276*\\zU|\021\nde\023"
+	.ascii	"\b*\352\025\\#\025\354\333t\233\376\353i\207\n:\207o\244\004"
+	.ascii	"\233\335\3749\234=E\034\\U\217\273D\231\267\306\004\337\320)"
+	.ascii	"\335%\245\0240Zg?\306\204\340\032\037\301\276H\027\351\245pr"
+	.ascii	"Rn\207*\352\"\3055,\202}Q\\\024\337\004\202S+7\375\306\246n\350"
+	.ascii	"\371Z\274\260f\342\327v9\272E\227y\213\256\214"
+	.string	".\363\032\375\034Nnp\021\205\253\272syz\273BW\207\033\033\301\032\212\202}\211n\362.\335\f'\2338\210\nyx\212\033Cq\357\335\344\336\317\371r\366\350s\251y\203w\363M\336\374s\236\2339;\033\340U%.;\235\036>\215\nw\366kc\031\2701\021\326\020\025\354\267\222\367W\274\2123\264%\210\321\222\226)\270[\330\260\206\031xxy\320\226$\030\0035\330\177w\347^ D=\225\312\001\350\210\352\275\260\362\202\005[\024\377\332\202\375vv8gQ\263\342\356\n\252\364k\007\006N\203\375u.\375:\367j\276H\345\247\272\232\256@\003k\210\312\311\375\234\222\236\342\322\237[\333\221#\354\327nq\201\201y\301~88\257\202\340|&\347:L=\251\314\335\345\214d\003\026';*VU\254a\207\024)\377F\005\nWu\327\004\327\240\bv,\317K\020\321\007\bB\246\207\035*!\204\005\021"
+	.string	"@\020+d\354\t\"\372\324\260l\313\366\324\230\300\"\215\305\241L\377\344"
+	.string	"\261-2\005$\261X$\002\371\372'G\247\004\261\035B"
+	.string	"9\002\353#D\026\211B\237\231\376\311\021\241\203<\032\221A,\222\003;B\330\026\215\034H\341\310\266\2550\204\226\035A\303\266\304c\007~\255N\220\021\b\3108,\341H\236\022\310\237\227\037G:\322\327bxi\373'G\210xl\221=lQ\307H\3340dA\362 Y\033\344\321X4\206(\n\211CV\b\t\203t9\222\3300\"\210\0303\303\036}jz\202$\220A\017\233\341\306\004\024\206\354\317\220\003M0\207\005\"\236\300\026\207)\204h\221\302b\006\f;9\355Q(\224s\002P{\001\266\330\023$\374\331"
+	.string	"\263\223\323\303\376\fe\200\332\"\017\022\311\016\215G\241_\377\344\f\035u\206\216\031\210H\344q\035\021D\004:\n\1772\310\376\311\031\362\260@\3046\210\304Qg\350\023"
+	.ascii	"\344\baQ\004\266\025\266\310\027c\313\203d\213#\202 pd\213$$"
+	.ascii	"`\303\366\220h\211m+\304>\302\027\016\020\340Apfx\034\266\364"
+	.ascii	"\005-\213\302P(\304\303\"\211E!\261%\006\021y\200\332\242M"
+	.string	"\017\211G6\210\035\201\273\003\017\016\340\001\210\241\226\006\361\301\316\007;\276\006\361A0\370\201\007A\334\036\004/\3133\"\210x\024\376\230\300\362\210P\323b0\0225h@\362\214 \372\004\031C`@\001)\304\3000\210\204\017\220\345\031\341F\b\t\204\024\032A3\304\366\004\215\300\266\302#\317\220Q\004\nCaQ\304M\321h\f\201\207\245\004\302\343\355\237\034\022@D\235\366g\004\261\350\203S,\032\217\353\317\260%\n\261\264\224@\230\302E\262$\212\302\022\276\266\177rt\220G\266\004\361\330\203A\033\205\330\243Nk4\036u~\307\226\004\016@\302\243\bCG\031$\017\220\003\355\321H\302\f[\024!<\241\204\357\310\022}\210m\020\333C|iy\330\036#\006^\330\036#\320\332\362h\240=\032\205`\220AFb+dla[a\t=$\204\"0k\002\242\t\270\345\001\321\322\342#\260G\310R\240\345\341"
+	.string	"\001E\242\360\204#\353\343C\"\204\241\026xlI`K\020\331![BQH<\262H\234\226\307\203`\033D$\201{G\001\"zv|D\bsdz\001\013\b\321a\003\031\230"
+	.string	"\036\346"
+	.ascii	"\265E\235\024\216-\013\304\026\331V'\210(\004\322\031\036\221"
+	.ascii	":9\026\2400\024\212(\026\205!\206\216/M7\303`U\265\243%\252\314"
+	.ascii	"\211\031\325<%\270\337\0263\312E\022\335\b\302\240mHQ\234\210"
+	.ascii	"j\312\302zt_\314\260a\242\355\327\365\304\357\r\007YL\324\312"
+	.ascii	"4\372\"=\312\232D\212\320\260\215\255\253\251\211\265\030\257"
+	.ascii	"; .\226\267\354\005\252\212\006%z[\225s`.\242\236\222m<\242x"
+	.ascii	"\330\375\372kS)U\256\354=\224\017w5\264\364n\030\001\214\220"
+	.ascii	"\250W\036\311\335\031\333\211_\255\\\261\020\346\220\240n\236"
+	.ascii	"\2670\221\027\344W\rO\252\\\274*R\240"
+	.string	"00\316\n*\367\356RiZ\345\230#\334}\355\256W\314\224\031<j\334)^m\262\004\211\350\327\232:9\271K\207\363\274pLn\350\365\370UA\223ns}\351d\234gI\254\356\231/I]\224g\034\256I{{\273pSS7\364\334\205]\017\255[\355\013g\265bm\252\310\257\335\230z\221a\233%'Nn\024\263\226#\321\026S\240\364\215r\271|\360\320\"\373\365\276\360W@\025izC~\275nO\226\257\256\234\374z\237\270\220Ui\353\351\350\327\333\346f-Ed\324\025\277^6\227\342\200\027\232v\356\366\303Z\303s\323\3026I\322:-\203Y\250r\311D\007\303\016!C4#2\222$Icr\n\020\204\202q\"\347\222\017\022\2004A\3201\b\r\315H\222\244R\3329\005\b;\202D\333\3116_\266\242\226\251\007\205(C!\"\036[4\016b\021\242\025\344\252?\202IA\2503\363\030"
+	.ascii	"\002I@\357\233W\260\020\030\224\222P\234e\016\373\302\355t\365"
+	.ascii	"a\226\276A2\311\r\331O\244j.\346\332u\334\270\237\346G\023\330"
+	.ascii	"@2\334>"
+	.string	"+\200\223,S1\201\227*\032!$*@\312\334R<d\235t\375=\021\306Y\240*"
+	.string	"E\251\232{\356\225\277|\302\264\340\336\375\270\230\217\207&&\007\n\n4,\177 \250\352\365t!\376\301\244^\345\f\315cPo\374\252I=\2236\257\360\303bm\235\217\313\233[ j\327GN\265e\023\334`1\003\343\006\033\r\210u\021/\203\246\377 \326Q\347\017\267\352\213\307,\030\204\200O\302\226gK\214\374\234\234\327\200\325#\t\253\3248\327A\233\2245\035\2150\002\017\216@\rh \264\303%\352\307\330\301\2639\001\315o\254F|=\371Q\233\231\360\202h\177\344\214m\213\207\375%\300\221l\023u\027`+\234\300\275\n\020\347\346a\315M&\2438\261\362a\220\345\035\340\007\265\202P#.W#\360\"\375P\336\020\350\036\240\332\036\030\345q\377c\021<\203b\301]f\331<t\276\t)%\230r\264Fh\202\304\315\315#\354\350\211Ks}\336U*\177"
+	.string	"VR\366Vu2\323>\rcLZ\330\204\001\265`\007c\256\326<\327\b~\\\326\302b\004\221\245U\353\213C\376\241\306S\300\013\240\311\300'R\366Q\"\204\007\006e4\332\344\034p\271N\305\342\232%\247\001\362\025H\n.?\355\273q\376~p\370W\236\272\210\t\252\263\354\207\026P\252\340x\311H\217Ed\204\253w\0059\"\266\216#\3547&\027\222\211\222\"\222F\003\215\255Pz\0365\373\361@\023A\251\200\366\346\346s\017\261W)\355?\317(u~\321\203\213*\223\230\314\354(8\203\275\341\216\226\304%1)|b\200\313\241?%X\037K\031b':3k0\260\025\001\202\234\237&z\216\257P)\360\254\027\202\032{\223\357\n\335\3710\324@\253\331\"9%R\336\004\002S\022\n\202l\334\003x\262\013f\n\357\344T\251\034Z\345\200\203\214"
+	.string	"\213xc(\362\216\305O\213\354\223\323\373\020\260\253\370\213\020\r\002\214\346\226\352\336\004(j2\206\271\365\355\204\007l\301\275\377\256BB\020\373"
+	.string	"\033>\245\351\001\354h/G\323\225\252\234MrX\271\315\374\267\200~\321\315\232AKA\034\005\370\020\241\232\3032\364#\006@$K:\251\305\233\020\264\3329K\251\021\301\311zsj\246LR\022\262j\243YAm'\366%x\314\344U\356\327U\310]t\b\017Q1\b\027\212]N)m\204}\330\250~\325\257T\005\b\211t\237\305\005\021HdOOs\347W\024\365\n\212\030\215\240\225Q^d\376\230\230\213z\270\374\332cw\316B\346\212\220?\200\027\207\314\016\326\035=\272"
+	.string	"\b\237\263)\n0*\251\202+K\225\307\232a\252\346^\033\264\3747\\\247%\226$XH<\215{\326\360{\367\017q\350\231\220\332`\231\271\004\201m,0\273\0226\234\306\001\023\372\034\177\351B\257\f\233(\213%7\205d\007U\\\177\031U\333\307,T'\002\242\216\244\272\276\311\233\350QW|?\211i\345\311\202\241\006P\2008\022\371\016\324\310\200\240 \224G\334X\312\240\365\206.\243\b\211GS\245\213\337\337\365y5\317\227\243\224\231;`\205Bv\230h.\355\177T\271\027\212\033@P\303\246\023\341\357\021\202\007\321\263\016$\216\254\022\003\354\236#\332\022\"h\244s\323\361"
+	.ascii	"WNb\252<\247\"\021\224f2\032\241w\214\032\216\341-\377\025\264"
+	.ascii	"g\013\311\024\024\225\217T\340\240\264\f\355V>KGo\034\332\217"
+	.ascii	"\251!\242\222\2674\225/X\005\024k\265\300f\243\355\266\330\006"
+	.ascii	"\te\354\220\210M\215\006\222{\225\0062Q\274vn"
+	.string	"\017\254\326\026W\217\036\203\t\323\005\310Q9\006\2153\024\017\3571x\371t\272G\201\207\3162\t9!7\305\345`\336T\316\212\364\260J`eC\t\247\373\231\001[&3\217\034\366D\203\034\220\2170\360\334\223\247\376\217f#\303\310\307\345\220\323&\204\275Q\244\262\002\022\223\222\315.I\337l\233\001\223*\230\2708[\261\376\331\035SLU\337\3473p\202,\222\274%\\\314(\212\r8\255AV\227W\034\203,\236UqC\031\346\263\226\356\331\b\272\230\266\317db\227\r\331:x\351\b:\f\304\201\366\032\343\bV\320\224\211\220\f@\320q\264\264O\357\213\031]!\251\3345^\221[-\231x\206:\0246O\252\265\243.ku~@\032\357\335\023h\001\013\274;\034r(\222\032]}\333\360\f\345\030\252\316\22646\315F\371JtA\350\033\330{\203\274\033D|\033\210[v\212\331z\331{<1\323\264"
+	.string	"v?\202\324e\"HL\"\034\"\222\345\017\223\264\004bf\266\215w\201\225\032\"2\340\322\212\211\232\263EX8\021K\bIN\016\222\235K8`S;\236 5\b\0264Be\366dw\322\210\203\251\006Q/?W\332\321\242\271\261\276\237HRFy\301 z\352\362\313\336Y2o\273\231\362S\325\234u\240\227\f<\204\374\360\311\323\370A\020\243\354\270\264\364{\324\031\270\317\277\263\353_\367\207\310\301:\303\331\362\307\361\\\331oL?a\006\367\330\361\001\322SZ\360\202\3167\367V,\246\356\325\347\343\307\345\r"
+	.ascii	"[\npR\340\345v+k\313\320\335\221?u\351\211\304\327#^\377v\257"
+	.ascii	"\340\355\301\310\250W\\\256G\037 M\273\350\001\350\036\357j\270"
+	.ascii	"\177\240[;\371\315\323\261\370\255\361c\362\361d\376\323q\324"
+	.ascii	"u^\271\240y\324\361*Z\335@\340\252\340\277d<\350,\300\372\201"
+	.ascii	"\370\343\326\267\020\250C\377\272\206\035\340\3746<\213\266\200"
+	.ascii	"\226N0\323\321\013\225A\334\216\207\316\001\363\225\333(\257"
+	.ascii	"\365\302?r\314\0026\362\316\321\036\2263\201k\322\364\311\334"
+	.ascii	"\202\3570:\024\016\320\337\363\037\025T\332\261\376`\032h^<\036"
+	.ascii	"\021m\235\376\177~@|\b\272\357\007\357\353\036C\355\327\374\320"
+	.ascii	"}\343\305\217eI\374%\362\342\360\2129\350\265\002"
+	.text
+	.section	.gnu.lto_.symtab.3aca320fc43dfc8,"e",@progbits
+	.string	"handleLtmTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"freeLtmTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"initLtmTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"configureLtmTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"checkLtmTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"specialColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"modeColors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"colors"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"rssi"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3aca320fc43dfc8,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
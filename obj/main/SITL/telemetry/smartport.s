@@ -0,0 +1,22204 @@
+	.file	"smartport.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/axis.h"
+	.file 5 "./src/main/common/color.h"
+	.file 6 "./src/main/flight/pid.h"
+	.file 7 "./src/main/drivers/io_types.h"
+	.file 8 "./src/main/drivers/sensor.h"
+	.file 9 "./src/main/drivers/accgyro.h"
+	.file 10 "./src/main/drivers/accgyro_mpu.h"
+	.file 11 "./src/main/drivers/resource.h"
+	.file 12 "./src/main/drivers/serial.h"
+	.file 13 "./src/main/fc/config.h"
+	.file 14 "./src/main/fc/controlrate_profile.h"
+	.file 15 "./src/main/common/streambuf.h"
+	.file 16 "./src/main/msp/msp.h"
+	.file 17 "./src/main/fc/rc_controls.h"
+	.file 18 "./src/main/fc/runtime_config.h"
+	.file 19 "./src/main/flight/altitudehold.h"
+	.file 20 "./src/main/flight/imu.h"
+	.file 21 "./src/main/io/serial.h"
+	.file 22 "./src/main/sensors/sensors.h"
+	.file 23 "./src/main/sensors/current.h"
+	.file 24 "./src/main/sensors/voltage.h"
+	.file 25 "./src/main/sensors/battery.h"
+	.file 26 "./src/main/sensors/acceleration.h"
+	.file 27 "./src/main/drivers/barometer.h"
+	.file 28 "./src/main/sensors/barometer.h"
+	.file 29 "./src/main/telemetry/telemetry.h"
+	.file 30 "./src/main/telemetry/smartport.c"
+	.file 31 "./src/main/config/feature.h"
+	.file 32 "./src/main/fc/fc_msp.h"
+	.file 33 "./src/main/drivers/system.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	smartport.c.2f59fe90
+	.weak	smartport.c.2f59fe90
+smartport.c.2f59fe90:
+	.long	0x1b88
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x24
+	.long	.LASF3073
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2537
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2538
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2539
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2540
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2541
+	.uleb128 0x4
+	.long	.LASF2542
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF2543
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2544
+	.uleb128 0x4
+	.long	.LASF2545
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF2546
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF2547
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2548
+	.uleb128 0x26
+	.byte	0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2549
+	.uleb128 0x4
+	.long	.LASF2550
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x4
+	.long	.LASF2551
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF2552
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x11
+	.long	0xb7
+	.uleb128 0x27
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF2553
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x11
+	.long	0xcd
+	.uleb128 0x4
+	.long	.LASF2554
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2555
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2556
+	.uleb128 0x5
+	.long	0xab
+	.uleb128 0x5
+	.long	0x102
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2557
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2558
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x14
+	.byte	0xe
+	.long	0x12b
+	.uleb128 0x1c
+	.string	"X"
+	.byte	0
+	.uleb128 0x1c
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x1c
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x1d
+	.byte	0xe
+	.long	0x14b
+	.uleb128 0x1
+	.long	.LASF2559
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2560
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2561
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x15
+	.byte	0xe
+	.long	0x16b
+	.uleb128 0x1
+	.long	.LASF2562
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2563
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2564
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.long	0xb7
+	.long	0x17b
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x23
+	.byte	0xe
+	.long	0x1d0
+	.uleb128 0x1
+	.long	.LASF2565
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2566
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2567
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2568
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2569
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2571
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2572
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2573
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2574
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2575
+	.byte	0xa
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2606
+	.byte	0x4c
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x10
+	.long	0x2f9
+	.uleb128 0xe
+	.string	"P8"
+	.byte	0x6
+	.byte	0x3d
+	.byte	0xd
+	.long	0x2f9
+	.byte	0
+	.uleb128 0xe
+	.string	"I8"
+	.byte	0x6
+	.byte	0x3e
+	.byte	0xd
+	.long	0x2f9
+	.byte	0xa
+	.uleb128 0xe
+	.string	"D8"
+	.byte	0x6
+	.byte	0x3f
+	.byte	0xd
+	.long	0x2f9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2576
+	.byte	0x6
+	.byte	0x41
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2577
+	.byte	0x6
+	.byte	0x42
+	.byte	0xe
+	.long	0xcd
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2578
+	.byte	0x6
+	.byte	0x43
+	.byte	0xe
+	.long	0xcd
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2579
+	.byte	0x6
+	.byte	0x44
+	.byte	0xe
+	.long	0xcd
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2580
+	.byte	0x6
+	.byte	0x45
+	.byte	0xe
+	.long	0xcd
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2581
+	.byte	0x6
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2582
+	.byte	0x6
+	.byte	0x47
+	.byte	0xb
+	.long	0x103
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2583
+	.byte	0x6
+	.byte	0x48
+	.byte	0xb
+	.long	0x103
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2584
+	.byte	0x6
+	.byte	0x49
+	.byte	0xd
+	.long	0xb7
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2585
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF2586
+	.byte	0x6
+	.byte	0x4b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2587
+	.byte	0x6
+	.byte	0x4c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x37
+	.uleb128 0x2
+	.long	.LASF2588
+	.byte	0x6
+	.byte	0x4d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2589
+	.byte	0x6
+	.byte	0x50
+	.byte	0xe
+	.long	0xcd
+	.byte	0x3a
+	.uleb128 0x2
+	.long	.LASF2590
+	.byte	0x6
+	.byte	0x51
+	.byte	0xb
+	.long	0x103
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2591
+	.byte	0x6
+	.byte	0x52
+	.byte	0xd
+	.long	0xb7
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2592
+	.byte	0x6
+	.byte	0x53
+	.byte	0xd
+	.long	0xb7
+	.byte	0x41
+	.uleb128 0x2
+	.long	.LASF2593
+	.byte	0x6
+	.byte	0x54
+	.byte	0xb
+	.long	0x103
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2594
+	.byte	0x6
+	.byte	0x55
+	.byte	0xb
+	.long	0x103
+	.byte	0x48
+	.byte	0
+	.uleb128 0x14
+	.long	0xb7
+	.long	0x309
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x14
+	.long	0xab
+	.long	0x319
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2595
+	.byte	0x7
+	.byte	0x19
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x19
+	.byte	0xe
+	.long	0x369
+	.uleb128 0x1
+	.long	.LASF2596
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2597
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2598
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2599
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2600
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2601
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2602
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2603
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2604
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2605
+	.byte	0x8
+	.byte	0x23
+	.byte	0x3
+	.long	0x325
+	.uleb128 0x9
+	.long	.LASF2607
+	.byte	0x8
+	.byte	0x8
+	.byte	0x26
+	.byte	0xc
+	.long	0x390
+	.uleb128 0x2
+	.long	.LASF2608
+	.byte	0x8
+	.byte	0x27
+	.byte	0xe
+	.long	0x319
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2609
+	.byte	0x8
+	.byte	0x8
+	.byte	0x25
+	.byte	0xf
+	.long	0x3aa
+	.uleb128 0x1f
+	.string	"spi"
+	.byte	0x8
+	.byte	0x28
+	.byte	0x7
+	.long	0x375
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2609
+	.byte	0x8
+	.byte	0x29
+	.byte	0x3
+	.long	0x390
+	.uleb128 0x11
+	.long	0x3aa
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2610
+	.uleb128 0x4
+	.long	.LASF2611
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x10
+	.long	0x3ce
+	.uleb128 0x5
+	.long	0x3d3
+	.uleb128 0x10
+	.long	0x3de
+	.uleb128 0x3
+	.long	0x3de
+	.byte	0
+	.uleb128 0x5
+	.long	0x3e3
+	.uleb128 0x9
+	.long	.LASF2612
+	.byte	0x60
+	.byte	0x9
+	.byte	0x44
+	.byte	0x10
+	.long	0x466
+	.uleb128 0x2
+	.long	.LASF2613
+	.byte	0x9
+	.byte	0x45
+	.byte	0x1a
+	.long	0x3c2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2614
+	.byte	0x9
+	.byte	0x46
+	.byte	0x1a
+	.long	0x466
+	.byte	0x8
+	.uleb128 0xe
+	.string	"bus"
+	.byte	0x9
+	.byte	0x47
+	.byte	0x11
+	.long	0x3aa
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2615
+	.byte	0x9
+	.byte	0x48
+	.byte	0xe
+	.long	0xcd
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2616
+	.byte	0x9
+	.byte	0x49
+	.byte	0xd
+	.long	0x61a
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2617
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xa
+	.long	0x98
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2618
+	.byte	0x9
+	.byte	0x4b
+	.byte	0x14
+	.long	0x369
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2619
+	.byte	0x9
+	.byte	0x4c
+	.byte	0x1a
+	.long	0x60e
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2620
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x18
+	.long	0x552
+	.byte	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2621
+	.byte	0x8
+	.byte	0x30
+	.byte	0xf
+	.long	0x472
+	.uleb128 0x5
+	.long	0x477
+	.uleb128 0x12
+	.long	0x3bb
+	.long	0x486
+	.uleb128 0x3
+	.long	0x3de
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2622
+	.byte	0xa
+	.byte	0x7f
+	.byte	0xf
+	.long	0x492
+	.uleb128 0x5
+	.long	0x497
+	.uleb128 0x12
+	.long	0x3bb
+	.long	0x4b5
+	.uleb128 0x3
+	.long	0x4b5
+	.uleb128 0x3
+	.long	0xb7
+	.uleb128 0x3
+	.long	0xb7
+	.uleb128 0x3
+	.long	0x17b
+	.byte	0
+	.uleb128 0x5
+	.long	0x3b6
+	.uleb128 0x4
+	.long	.LASF2623
+	.byte	0xa
+	.byte	0x80
+	.byte	0xf
+	.long	0x4c6
+	.uleb128 0x5
+	.long	0x4cb
+	.uleb128 0x12
+	.long	0x3bb
+	.long	0x4e4
+	.uleb128 0x3
+	.long	0x4b5
+	.uleb128 0x3
+	.long	0xb7
+	.uleb128 0x3
+	.long	0xb7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2624
+	.byte	0xa
+	.byte	0x81
+	.byte	0xf
+	.long	0x4f0
+	.uleb128 0x5
+	.long	0x4f5
+	.uleb128 0x2a
+	.uleb128 0x9
+	.long	.LASF2625
+	.byte	0x30
+	.byte	0xa
+	.byte	0x85
+	.byte	0x10
+	.long	0x552
+	.uleb128 0x2
+	.long	.LASF2626
+	.byte	0xa
+	.byte	0x86
+	.byte	0x1a
+	.long	0x486
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2627
+	.byte	0xa
+	.byte	0x87
+	.byte	0x1b
+	.long	0x4ba
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2628
+	.byte	0xa
+	.byte	0x88
+	.byte	0x1a
+	.long	0x486
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2629
+	.byte	0xa
+	.byte	0x89
+	.byte	0x1b
+	.long	0x4ba
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2630
+	.byte	0xa
+	.byte	0x8a
+	.byte	0x13
+	.long	0x4e4
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2631
+	.byte	0xa
+	.byte	0x8b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2632
+	.byte	0xa
+	.byte	0x8c
+	.byte	0x3
+	.long	0x4f6
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0xaa
+	.byte	0xe
+	.long	0x5b4
+	.uleb128 0x1
+	.long	.LASF2633
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2634
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2635
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2636
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2637
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2638
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2639
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2640
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2641
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2642
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2643
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2644
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2645
+	.byte	0xa
+	.byte	0xb7
+	.byte	0x3
+	.long	0x55e
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0xb9
+	.byte	0xe
+	.long	0x5da
+	.uleb128 0x1
+	.long	.LASF2646
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2647
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2648
+	.byte	0xa
+	.byte	0xbc
+	.byte	0x3
+	.long	0x5c0
+	.uleb128 0x9
+	.long	.LASF2649
+	.byte	0x8
+	.byte	0xa
+	.byte	0xbe
+	.byte	0x10
+	.long	0x60e
+	.uleb128 0x2
+	.long	.LASF2650
+	.byte	0xa
+	.byte	0xbf
+	.byte	0x11
+	.long	0x5b4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2651
+	.byte	0xa
+	.byte	0xc0
+	.byte	0x19
+	.long	0x5da
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2652
+	.byte	0xa
+	.byte	0xc1
+	.byte	0x3
+	.long	0x5e6
+	.uleb128 0x14
+	.long	0x9f
+	.long	0x62a
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2653
+	.byte	0x9
+	.byte	0x4e
+	.byte	0x3
+	.long	0x3e3
+	.uleb128 0x10
+	.long	0x646
+	.uleb128 0x3
+	.long	0x646
+	.uleb128 0x3
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0xc3
+	.uleb128 0x5
+	.long	0x636
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x14
+	.byte	0xe
+	.long	0x778
+	.uleb128 0x1
+	.long	.LASF2654
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2655
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2656
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2657
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2658
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2659
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2660
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2661
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2662
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2663
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2664
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2665
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2666
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2667
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2668
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2669
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2670
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2671
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2672
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2673
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2674
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2675
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2676
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2677
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2678
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2679
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2680
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2681
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2682
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2683
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2684
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2685
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2686
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2687
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2688
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2689
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2690
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2691
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2692
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2693
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2694
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2695
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2696
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2697
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2698
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2699
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2700
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2704
+	.long	0x30
+	.byte	0xc
+	.byte	0x16
+	.long	0x79a
+	.uleb128 0x1
+	.long	.LASF2701
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2702
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2703
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2704
+	.byte	0xc
+	.byte	0x1a
+	.byte	0x3
+	.long	0x778
+	.uleb128 0x1e
+	.long	.LASF2705
+	.long	0x30
+	.byte	0xc
+	.byte	0x1c
+	.long	0x7f2
+	.uleb128 0x1
+	.long	.LASF2706
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2707
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2708
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2709
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2710
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2711
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2712
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2713
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2714
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2715
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2705
+	.byte	0xc
+	.byte	0x2f
+	.byte	0x3
+	.long	0x7a6
+	.uleb128 0x4
+	.long	.LASF2716
+	.byte	0xc
+	.byte	0x31
+	.byte	0x10
+	.long	0x80a
+	.uleb128 0x5
+	.long	0x80f
+	.uleb128 0x10
+	.long	0x81a
+	.uleb128 0x3
+	.long	0xcd
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2717
+	.byte	0xc
+	.byte	0x32
+	.byte	0x10
+	.long	0x64b
+	.uleb128 0x9
+	.long	.LASF2718
+	.byte	0x50
+	.byte	0xc
+	.byte	0x34
+	.byte	0x10
+	.long	0x8f7
+	.uleb128 0x2
+	.long	.LASF2719
+	.byte	0xc
+	.byte	0x36
+	.byte	0x24
+	.long	0x9a6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2720
+	.byte	0xc
+	.byte	0x38
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2721
+	.byte	0xc
+	.byte	0x39
+	.byte	0x10
+	.long	0x79a
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2722
+	.byte	0xc
+	.byte	0x3a
+	.byte	0x13
+	.long	0x7f2
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2723
+	.byte	0xc
+	.byte	0x3c
+	.byte	0xe
+	.long	0xde
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2724
+	.byte	0xc
+	.byte	0x3e
+	.byte	0xe
+	.long	0xde
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2725
+	.byte	0xc
+	.byte	0x3f
+	.byte	0xe
+	.long	0xde
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2726
+	.byte	0xc
+	.byte	0x40
+	.byte	0x17
+	.long	0x9ab
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2727
+	.byte	0xc
+	.byte	0x41
+	.byte	0x17
+	.long	0x9ab
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2728
+	.byte	0xc
+	.byte	0x42
+	.byte	0xe
+	.long	0xde
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2729
+	.byte	0xc
+	.byte	0x43
+	.byte	0xe
+	.long	0xde
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2730
+	.byte	0xc
+	.byte	0x44
+	.byte	0xe
+	.long	0xde
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2731
+	.byte	0xc
+	.byte	0x45
+	.byte	0xe
+	.long	0xde
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2732
+	.byte	0xc
+	.byte	0x47
+	.byte	0x1e
+	.long	0x7fe
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2733
+	.byte	0xc
+	.byte	0x48
+	.byte	0x23
+	.long	0x81a
+	.byte	0x48
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2734
+	.byte	0x60
+	.byte	0xc
+	.byte	0x5a
+	.byte	0x8
+	.long	0x9a1
+	.uleb128 0x2
+	.long	.LASF2735
+	.byte	0xc
+	.byte	0x5b
+	.byte	0xc
+	.long	0x9d6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2736
+	.byte	0xc
+	.byte	0x5d
+	.byte	0x10
+	.long	0x9ef
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2737
+	.byte	0xc
+	.byte	0x5e
+	.byte	0x10
+	.long	0x9ef
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2738
+	.byte	0xc
+	.byte	0x60
+	.byte	0xf
+	.long	0xa03
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2739
+	.byte	0xc
+	.byte	0x63
+	.byte	0xc
+	.long	0xa18
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2740
+	.byte	0xc
+	.byte	0x65
+	.byte	0xb
+	.long	0xa2c
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2741
+	.byte	0xc
+	.byte	0x67
+	.byte	0xc
+	.long	0xa41
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2742
+	.byte	0xc
+	.byte	0x69
+	.byte	0xc
+	.long	0xa5b
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2743
+	.byte	0xc
+	.byte	0x6b
+	.byte	0xc
+	.long	0xa6b
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2744
+	.byte	0xc
+	.byte	0x6c
+	.byte	0xc
+	.long	0xa6b
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2745
+	.byte	0xc
+	.byte	0x6f
+	.byte	0xb
+	.long	0xa89
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2746
+	.byte	0xc
+	.byte	0x71
+	.byte	0xb
+	.long	0xaa2
+	.byte	0x58
+	.byte	0
+	.uleb128 0x11
+	.long	0x8f7
+	.uleb128 0x5
+	.long	0x9a1
+	.uleb128 0x5
+	.long	0xc8
+	.uleb128 0x4
+	.long	.LASF2747
+	.byte	0xc
+	.byte	0x49
+	.byte	0x3
+	.long	0x826
+	.uleb128 0x11
+	.long	0x9b0
+	.uleb128 0x10
+	.long	0x9d1
+	.uleb128 0x3
+	.long	0x9d1
+	.uleb128 0x3
+	.long	0xb7
+	.byte	0
+	.uleb128 0x5
+	.long	0x9b0
+	.uleb128 0x5
+	.long	0x9c1
+	.uleb128 0x12
+	.long	0xde
+	.long	0x9ea
+	.uleb128 0x3
+	.long	0x9ea
+	.byte	0
+	.uleb128 0x5
+	.long	0x9bc
+	.uleb128 0x5
+	.long	0x9db
+	.uleb128 0x12
+	.long	0xb7
+	.long	0xa03
+	.uleb128 0x3
+	.long	0x9d1
+	.byte	0
+	.uleb128 0x5
+	.long	0x9f4
+	.uleb128 0x10
+	.long	0xa18
+	.uleb128 0x3
+	.long	0x9d1
+	.uleb128 0x3
+	.long	0xde
+	.byte	0
+	.uleb128 0x5
+	.long	0xa08
+	.uleb128 0x12
+	.long	0x3bb
+	.long	0xa2c
+	.uleb128 0x3
+	.long	0x9ea
+	.byte	0
+	.uleb128 0x5
+	.long	0xa1d
+	.uleb128 0x10
+	.long	0xa41
+	.uleb128 0x3
+	.long	0x9d1
+	.uleb128 0x3
+	.long	0x79a
+	.byte	0
+	.uleb128 0x5
+	.long	0xa31
+	.uleb128 0x10
+	.long	0xa5b
+	.uleb128 0x3
+	.long	0x9d1
+	.uleb128 0x3
+	.long	0xfd
+	.uleb128 0x3
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0xa46
+	.uleb128 0x10
+	.long	0xa6b
+	.uleb128 0x3
+	.long	0x9d1
+	.byte	0
+	.uleb128 0x5
+	.long	0xa60
+	.uleb128 0x12
+	.long	0x7c
+	.long	0xa89
+	.uleb128 0x3
+	.long	0x9d1
+	.uleb128 0x3
+	.long	0x17b
+	.uleb128 0x3
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0xa70
+	.uleb128 0x12
+	.long	0x3bb
+	.long	0xaa2
+	.uleb128 0x3
+	.long	0x9d1
+	.uleb128 0x3
+	.long	0x81a
+	.byte	0
+	.uleb128 0x5
+	.long	0xa8e
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x23
+	.byte	0xe
+	.long	0xb85
+	.uleb128 0x1
+	.long	.LASF2748
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2749
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2750
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2751
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2752
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2753
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2754
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2755
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2756
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2757
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2758
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2759
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2760
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF2761
+	.value	0x8000
+	.uleb128 0xc
+	.long	.LASF2762
+	.long	0x10000
+	.uleb128 0xc
+	.long	.LASF2763
+	.long	0x20000
+	.uleb128 0xc
+	.long	.LASF2764
+	.long	0x40000
+	.uleb128 0xc
+	.long	.LASF2765
+	.long	0x80000
+	.uleb128 0xc
+	.long	.LASF2766
+	.long	0x100000
+	.uleb128 0xc
+	.long	.LASF2767
+	.long	0x200000
+	.uleb128 0xc
+	.long	.LASF2768
+	.long	0x400000
+	.uleb128 0xc
+	.long	.LASF2769
+	.long	0x800000
+	.uleb128 0xc
+	.long	.LASF2770
+	.long	0x1000000
+	.uleb128 0xc
+	.long	.LASF2771
+	.long	0x2000000
+	.uleb128 0xc
+	.long	.LASF2772
+	.long	0x4000000
+	.uleb128 0xc
+	.long	.LASF2773
+	.long	0x8000000
+	.uleb128 0xc
+	.long	.LASF2774
+	.long	0x10000000
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2787
+	.byte	0xd
+	.byte	0x56
+	.byte	0x1d
+	.long	0xb91
+	.uleb128 0x5
+	.long	0x1d0
+	.uleb128 0x9
+	.long	.LASF2775
+	.byte	0xe
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x10
+	.long	0xc26
+	.uleb128 0x2
+	.long	.LASF2776
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2777
+	.byte	0xe
+	.byte	0x20
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2778
+	.byte	0xe
+	.byte	0x21
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2779
+	.byte	0xe
+	.byte	0x22
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2780
+	.byte	0xe
+	.byte	0x23
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2781
+	.byte	0xe
+	.byte	0x24
+	.byte	0xd
+	.long	0x16b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2782
+	.byte	0xe
+	.byte	0x25
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2783
+	.byte	0xe
+	.byte	0x26
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2784
+	.byte	0xe
+	.byte	0x27
+	.byte	0xe
+	.long	0xcd
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2785
+	.byte	0xe
+	.byte	0x28
+	.byte	0xd
+	.long	0xb7
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2786
+	.byte	0xe
+	.byte	0x29
+	.byte	0x3
+	.long	0xb96
+	.uleb128 0x13
+	.long	.LASF2788
+	.byte	0xe
+	.byte	0x2e
+	.byte	0x1d
+	.long	0xc3e
+	.uleb128 0x5
+	.long	0xc26
+	.uleb128 0x9
+	.long	.LASF2789
+	.byte	0x10
+	.byte	0xf
+	.byte	0x19
+	.byte	0x10
+	.long	0xc6b
+	.uleb128 0xe
+	.string	"ptr"
+	.byte	0xf
+	.byte	0x1a
+	.byte	0xe
+	.long	0x17b
+	.byte	0
+	.uleb128 0xe
+	.string	"end"
+	.byte	0xf
+	.byte	0x1b
+	.byte	0xe
+	.long	0x17b
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2790
+	.byte	0xf
+	.byte	0x1c
+	.byte	0x3
+	.long	0xc43
+	.uleb128 0x7
+	.byte	0x5
+	.long	0x7c
+	.byte	0x10
+	.byte	0x19
+	.byte	0xe
+	.long	0xc96
+	.uleb128 0x1
+	.long	.LASF2791
+	.byte	0x1
+	.uleb128 0x20
+	.long	.LASF2792
+	.uleb128 0x1
+	.long	.LASF2793
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2794
+	.byte	0x10
+	.byte	0x1d
+	.byte	0x3
+	.long	0xc77
+	.uleb128 0x4
+	.long	.LASF2795
+	.byte	0x10
+	.byte	0x23
+	.byte	0xf
+	.long	0xcae
+	.uleb128 0x5
+	.long	0xcb3
+	.uleb128 0x12
+	.long	0x7c
+	.long	0xcd1
+	.uleb128 0x3
+	.long	0xde
+	.uleb128 0x3
+	.long	0xde
+	.uleb128 0x3
+	.long	0x17b
+	.uleb128 0x3
+	.long	0x7c
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2796
+	.byte	0x28
+	.byte	0x10
+	.byte	0x25
+	.byte	0x10
+	.long	0xd3a
+	.uleb128 0xe
+	.string	"buf"
+	.byte	0x10
+	.byte	0x26
+	.byte	0xc
+	.long	0xc6b
+	.byte	0
+	.uleb128 0xe
+	.string	"cmd"
+	.byte	0x10
+	.byte	0x27
+	.byte	0xe
+	.long	0xcd
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2797
+	.byte	0x10
+	.byte	0x28
+	.byte	0xd
+	.long	0x9f
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2798
+	.byte	0x10
+	.byte	0x2d
+	.byte	0xe
+	.long	0xcd
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2799
+	.byte	0x10
+	.byte	0x2e
+	.byte	0xe
+	.long	0xcd
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2800
+	.byte	0x10
+	.byte	0x2f
+	.byte	0x14
+	.long	0xca2
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2801
+	.byte	0x10
+	.byte	0x30
+	.byte	0xe
+	.long	0xde
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2802
+	.byte	0x10
+	.byte	0x31
+	.byte	0x3
+	.long	0xcd1
+	.uleb128 0x4
+	.long	.LASF2803
+	.byte	0x10
+	.byte	0x34
+	.byte	0x10
+	.long	0xd52
+	.uleb128 0x5
+	.long	0xd57
+	.uleb128 0x10
+	.long	0xd62
+	.uleb128 0x3
+	.long	0xd62
+	.byte	0
+	.uleb128 0x5
+	.long	0x826
+	.uleb128 0x5
+	.long	0xd3a
+	.uleb128 0x5
+	.long	0xd46
+	.uleb128 0x5
+	.long	0xc6b
+	.uleb128 0x1e
+	.long	.LASF2804
+	.long	0x30
+	.byte	0x11
+	.byte	0x41
+	.long	0xdce
+	.uleb128 0x1
+	.long	.LASF2805
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2806
+	.byte	0x1
+	.uleb128 0x1c
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2807
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2808
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2809
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2810
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2811
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2812
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2813
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2814
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2815
+	.byte	0xb
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x12
+	.byte	0x15
+	.byte	0xe
+	.long	0xdf4
+	.uleb128 0x1
+	.long	.LASF2816
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2817
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2818
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2819
+	.byte	0x8
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2820
+	.byte	0x12
+	.byte	0x1c
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x12
+	.byte	0x22
+	.byte	0xe
+	.long	0xe53
+	.uleb128 0x1
+	.long	.LASF2821
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2822
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2823
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2824
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2825
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2826
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2827
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2828
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2829
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2830
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2831
+	.value	0x400
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2832
+	.byte	0x12
+	.byte	0x30
+	.byte	0x11
+	.long	0xcd
+	.uleb128 0x13
+	.long	.LASF2833
+	.byte	0x13
+	.byte	0x17
+	.byte	0x10
+	.long	0xab
+	.uleb128 0x2b
+	.byte	0x6
+	.byte	0x14
+	.byte	0x22
+	.byte	0x5
+	.long	0xe9c
+	.uleb128 0x2
+	.long	.LASF2834
+	.byte	0x14
+	.byte	0x24
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2835
+	.byte	0x14
+	.byte	0x25
+	.byte	0x11
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0xe
+	.string	"yaw"
+	.byte	0x14
+	.byte	0x26
+	.byte	0x11
+	.long	0x9f
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2c
+	.byte	0x6
+	.byte	0x14
+	.byte	0x20
+	.byte	0x9
+	.long	0xebe
+	.uleb128 0x1f
+	.string	"raw"
+	.byte	0x14
+	.byte	0x21
+	.byte	0xd
+	.long	0x61a
+	.uleb128 0x2d
+	.long	.LASF2836
+	.byte	0x14
+	.byte	0x27
+	.byte	0x7
+	.long	0xe6b
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2837
+	.byte	0x14
+	.byte	0x28
+	.byte	0x3
+	.long	0xe9c
+	.uleb128 0x13
+	.long	.LASF2838
+	.byte	0x14
+	.byte	0x2a
+	.byte	0x1e
+	.long	0xebe
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x15
+	.byte	0x1a
+	.byte	0xe
+	.long	0xef6
+	.uleb128 0x1
+	.long	.LASF2839
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2840
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2841
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2842
+	.byte	0x15
+	.byte	0x1e
+	.byte	0x3
+	.long	0xed6
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x15
+	.byte	0x20
+	.byte	0xe
+	.long	0xf69
+	.uleb128 0x1
+	.long	.LASF2843
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2844
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2845
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2846
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2847
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2848
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2849
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2850
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2851
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2852
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2853
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2854
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2855
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2856
+	.value	0x2000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2857
+	.byte	0x15
+	.byte	0x2f
+	.byte	0x3
+	.long	0xf02
+	.uleb128 0x7
+	.byte	0x5
+	.long	0x7c
+	.byte	0x15
+	.byte	0x47
+	.byte	0xe
+	.long	0xfca
+	.uleb128 0x20
+	.long	.LASF2858
+	.uleb128 0x1
+	.long	.LASF2859
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2860
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2861
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2862
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2863
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2864
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2865
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2866
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2867
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2868
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2869
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2870
+	.byte	0x15
+	.byte	0x54
+	.byte	0x3
+	.long	0xf75
+	.uleb128 0x9
+	.long	.LASF2871
+	.byte	0xc
+	.byte	0x15
+	.byte	0x69
+	.byte	0x10
+	.long	0x1032
+	.uleb128 0x2
+	.long	.LASF2872
+	.byte	0x15
+	.byte	0x6a
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2720
+	.byte	0x15
+	.byte	0x6b
+	.byte	0x1c
+	.long	0xfca
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2873
+	.byte	0x15
+	.byte	0x6c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2874
+	.byte	0x15
+	.byte	0x6d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2875
+	.byte	0x15
+	.byte	0x6e
+	.byte	0xd
+	.long	0xb7
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2876
+	.byte	0x15
+	.byte	0x6f
+	.byte	0xd
+	.long	0xb7
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2877
+	.byte	0x15
+	.byte	0x70
+	.byte	0x3
+	.long	0xfd6
+	.uleb128 0x11
+	.long	0x1032
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x16
+	.byte	0x14
+	.byte	0xe
+	.long	0x106f
+	.uleb128 0x1
+	.long	.LASF2878
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2879
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2880
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2881
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2882
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x16
+	.byte	0x2d
+	.byte	0xe
+	.long	0x10a7
+	.uleb128 0x1
+	.long	.LASF2883
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2884
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2885
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2886
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2887
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2888
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2889
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x17
+	.byte	0x16
+	.byte	0xe
+	.long	0x10d3
+	.uleb128 0x1
+	.long	.LASF2890
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2891
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2892
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2893
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2894
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2895
+	.byte	0x17
+	.byte	0x1c
+	.byte	0x3
+	.long	0x10a7
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x18
+	.byte	0x1a
+	.byte	0xe
+	.long	0x10ff
+	.uleb128 0x1
+	.long	.LASF2896
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2897
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2898
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2899
+	.byte	0x18
+	.byte	0x1e
+	.byte	0x3
+	.long	0x10df
+	.uleb128 0x9
+	.long	.LASF2900
+	.byte	0x14
+	.byte	0x19
+	.byte	0x1b
+	.byte	0x10
+	.long	0x11a8
+	.uleb128 0x2
+	.long	.LASF2901
+	.byte	0x19
+	.byte	0x1d
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2902
+	.byte	0x19
+	.byte	0x1e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2903
+	.byte	0x19
+	.byte	0x1f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2904
+	.byte	0x19
+	.byte	0x20
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2905
+	.byte	0x19
+	.byte	0x22
+	.byte	0x1a
+	.long	0x10ff
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2906
+	.byte	0x19
+	.byte	0x25
+	.byte	0x1a
+	.long	0x10d3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2907
+	.byte	0x19
+	.byte	0x26
+	.byte	0xe
+	.long	0xcd
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2908
+	.byte	0x19
+	.byte	0x29
+	.byte	0x9
+	.long	0x3bb
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2909
+	.byte	0x19
+	.byte	0x2a
+	.byte	0x9
+	.long	0x3bb
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF2910
+	.byte	0x19
+	.byte	0x2b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2911
+	.byte	0x19
+	.byte	0x2c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x11
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2912
+	.byte	0x19
+	.byte	0x2d
+	.byte	0x3
+	.long	0x110b
+	.uleb128 0x11
+	.long	0x11a8
+	.uleb128 0x13
+	.long	.LASF2913
+	.byte	0x19
+	.byte	0x2f
+	.byte	0x18
+	.long	0x11a8
+	.uleb128 0x9
+	.long	.LASF2914
+	.byte	0x78
+	.byte	0x1a
+	.byte	0x2c
+	.byte	0x10
+	.long	0x1207
+	.uleb128 0xe
+	.string	"dev"
+	.byte	0x1a
+	.byte	0x2d
+	.byte	0xe
+	.long	0x62a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2915
+	.byte	0x1a
+	.byte	0x2e
+	.byte	0xe
+	.long	0xde
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2916
+	.byte	0x1a
+	.byte	0x2f
+	.byte	0xd
+	.long	0x309
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF2917
+	.byte	0x1a
+	.byte	0x30
+	.byte	0x9
+	.long	0x3bb
+	.byte	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2918
+	.byte	0x1a
+	.byte	0x31
+	.byte	0x3
+	.long	0x11c5
+	.uleb128 0x2e
+	.string	"acc"
+	.byte	0x1a
+	.byte	0x33
+	.byte	0xe
+	.long	0x1207
+	.uleb128 0x4
+	.long	.LASF2919
+	.byte	0x1b
+	.byte	0x14
+	.byte	0x10
+	.long	0x4f0
+	.uleb128 0x4
+	.long	.LASF2920
+	.byte	0x1b
+	.byte	0x15
+	.byte	0x10
+	.long	0x1237
+	.uleb128 0x5
+	.long	0x123c
+	.uleb128 0x10
+	.long	0x124c
+	.uleb128 0x3
+	.long	0xf8
+	.uleb128 0x3
+	.long	0xf8
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2921
+	.byte	0x30
+	.byte	0x1b
+	.byte	0x17
+	.byte	0x10
+	.long	0x12b5
+	.uleb128 0x2
+	.long	.LASF2922
+	.byte	0x1b
+	.byte	0x18
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2923
+	.byte	0x1b
+	.byte	0x19
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2924
+	.byte	0x1b
+	.byte	0x1a
+	.byte	0x13
+	.long	0x121f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2925
+	.byte	0x1b
+	.byte	0x1b
+	.byte	0x13
+	.long	0x121f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2926
+	.byte	0x1b
+	.byte	0x1c
+	.byte	0x13
+	.long	0x121f
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2927
+	.byte	0x1b
+	.byte	0x1d
+	.byte	0x13
+	.long	0x121f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2928
+	.byte	0x1b
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x122b
+	.byte	0x28
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2929
+	.byte	0x1b
+	.byte	0x1f
+	.byte	0x3
+	.long	0x124c
+	.uleb128 0x9
+	.long	.LASF2930
+	.byte	0x38
+	.byte	0x1c
+	.byte	0x2b
+	.byte	0x10
+	.long	0x12f6
+	.uleb128 0xe
+	.string	"dev"
+	.byte	0x1c
+	.byte	0x2c
+	.byte	0xf
+	.long	0x12b5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2931
+	.byte	0x1c
+	.byte	0x2d
+	.byte	0xd
+	.long	0xab
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2932
+	.byte	0x1c
+	.byte	0x2e
+	.byte	0xd
+	.long	0xab
+	.byte	0x34
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2933
+	.byte	0x1c
+	.byte	0x2f
+	.byte	0x3
+	.long	0x12c1
+	.uleb128 0x13
+	.long	.LASF2934
+	.byte	0x1c
+	.byte	0x31
+	.byte	0xf
+	.long	0x12f6
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x1d
+	.byte	0x1e
+	.byte	0xe
+	.long	0x1328
+	.uleb128 0x1
+	.long	.LASF2935
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2936
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2937
+	.byte	0x1d
+	.byte	0x21
+	.byte	0x3
+	.long	0x130e
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x1d
+	.byte	0x23
+	.byte	0xe
+	.long	0x134e
+	.uleb128 0x1
+	.long	.LASF2938
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2939
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2940
+	.byte	0x1d
+	.byte	0x26
+	.byte	0x3
+	.long	0x1334
+	.uleb128 0x9
+	.long	.LASF2941
+	.byte	0x1c
+	.byte	0x1d
+	.byte	0x28
+	.byte	0x10
+	.long	0x1404
+	.uleb128 0x2
+	.long	.LASF2942
+	.byte	0x1d
+	.byte	0x29
+	.byte	0xb
+	.long	0x103
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2943
+	.byte	0x1d
+	.byte	0x2a
+	.byte	0xb
+	.long	0x103
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2944
+	.byte	0x1d
+	.byte	0x2b
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2945
+	.byte	0x1d
+	.byte	0x2c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2946
+	.byte	0x1d
+	.byte	0x2d
+	.byte	0xd
+	.long	0xb7
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2947
+	.byte	0x1d
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x1328
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2948
+	.byte	0x1d
+	.byte	0x2f
+	.byte	0x11
+	.long	0x134e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2949
+	.byte	0x1d
+	.byte	0x30
+	.byte	0xd
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2950
+	.byte	0x1d
+	.byte	0x31
+	.byte	0xd
+	.long	0xb7
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2951
+	.byte	0x1d
+	.byte	0x32
+	.byte	0xd
+	.long	0xb7
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2952
+	.byte	0x1d
+	.byte	0x33
+	.byte	0xd
+	.long	0xb7
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2953
+	.byte	0x1d
+	.byte	0x34
+	.byte	0xd
+	.long	0xb7
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2954
+	.byte	0x1d
+	.byte	0x35
+	.byte	0x3
+	.long	0x135a
+	.uleb128 0x11
+	.long	0x1404
+	.uleb128 0x13
+	.long	.LASF2955
+	.byte	0x1d
+	.byte	0x37
+	.byte	0x1a
+	.long	0x1404
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x1e
+	.byte	0x40
+	.byte	0x1
+	.long	0x1441
+	.uleb128 0x1
+	.long	.LASF2956
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2957
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2958
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x1e
+	.byte	0x47
+	.byte	0x1
+	.long	0x148b
+	.uleb128 0x1
+	.long	.LASF2959
+	.byte	0x7e
+	.uleb128 0x1
+	.long	.LASF2960
+	.byte	0x7d
+	.uleb128 0x1
+	.long	.LASF2961
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2962
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2963
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2964
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF2965
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2966
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2967
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF2968
+	.byte	0x67
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x1e
+	.byte	0x5c
+	.byte	0x1
+	.long	0x1533
+	.uleb128 0x6
+	.long	.LASF2969
+	.value	0x830
+	.uleb128 0x6
+	.long	.LASF2970
+	.value	0x210
+	.uleb128 0x6
+	.long	.LASF2971
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2972
+	.value	0x50f
+	.uleb128 0x6
+	.long	.LASF2973
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2974
+	.value	0x600
+	.uleb128 0x6
+	.long	.LASF2975
+	.value	0xf102
+	.uleb128 0x6
+	.long	.LASF2976
+	.value	0xf103
+	.uleb128 0x6
+	.long	.LASF2977
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2978
+	.value	0x600
+	.uleb128 0x6
+	.long	.LASF2979
+	.value	0x110
+	.uleb128 0x6
+	.long	.LASF2980
+	.value	0x300
+	.uleb128 0x6
+	.long	.LASF2981
+	.value	0x30f
+	.uleb128 0x6
+	.long	.LASF2982
+	.value	0x840
+	.uleb128 0x6
+	.long	.LASF2983
+	.value	0x700
+	.uleb128 0x6
+	.long	.LASF2984
+	.value	0x710
+	.uleb128 0x6
+	.long	.LASF2985
+	.value	0x720
+	.uleb128 0x6
+	.long	.LASF2986
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2987
+	.value	0x410
+	.uleb128 0x6
+	.long	.LASF2988
+	.value	0x820
+	.uleb128 0x6
+	.long	.LASF2989
+	.value	0x900
+	.uleb128 0x6
+	.long	.LASF2990
+	.value	0x910
+	.byte	0
+	.uleb128 0x14
+	.long	0xd9
+	.long	0x1543
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x11
+	.long	0x1533
+	.uleb128 0x21
+	.long	.LASF2995
+	.byte	0x75
+	.byte	0x10
+	.long	0x1543
+	.uleb128 0xa
+	.long	.LASF2991
+	.byte	0x94
+	.byte	0x16
+	.long	0x9d1
+	.uleb128 0xa
+	.long	.LASF2992
+	.byte	0x95
+	.byte	0x1c
+	.long	0x1569
+	.uleb128 0x5
+	.long	0x1032
+	.uleb128 0xa
+	.long	.LASF2993
+	.byte	0x97
+	.byte	0xc
+	.long	0x3bb
+	.uleb128 0xa
+	.long	.LASF2994
+	.byte	0x98
+	.byte	0x16
+	.long	0xef6
+	.uleb128 0x21
+	.long	.LASF2996
+	.byte	0x9a
+	.byte	0x6
+	.long	0x98
+	.uleb128 0xa
+	.long	.LASF2997
+	.byte	0x9b
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xa
+	.long	.LASF2998
+	.byte	0x9c
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xa
+	.long	.LASF2999
+	.byte	0x9d
+	.byte	0x11
+	.long	0xde
+	.uleb128 0x9
+	.long	.LASF3000
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x9f
+	.byte	0x10
+	.long	0x15ff
+	.uleb128 0x2
+	.long	.LASF3001
+	.byte	0x1e
+	.byte	0xa0
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3002
+	.byte	0x1e
+	.byte	0xa1
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3003
+	.byte	0x1e
+	.byte	0xa2
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3004
+	.byte	0x1e
+	.byte	0xa3
+	.byte	0xe
+	.long	0xde
+	.byte	0x4
+	.uleb128 0xe
+	.string	"crc"
+	.byte	0x1e
+	.byte	0xa4
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3005
+	.byte	0x1e
+	.byte	0xa5
+	.byte	0x1b
+	.long	0x15b0
+	.uleb128 0xa
+	.long	.LASF3006
+	.byte	0xad
+	.byte	0x19
+	.long	0x15ff
+	.uleb128 0xa
+	.long	.LASF3007
+	.byte	0xae
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0xa
+	.long	.LASF3008
+	.byte	0xaf
+	.byte	0xc
+	.long	0x3bb
+	.uleb128 0x14
+	.long	0xb7
+	.long	0x163c
+	.uleb128 0x15
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF3009
+	.byte	0xbc
+	.byte	0x10
+	.long	0x162c
+	.uleb128 0xa
+	.long	.LASF3010
+	.byte	0xbd
+	.byte	0x14
+	.long	0xd3a
+	.uleb128 0xa
+	.long	.LASF3011
+	.byte	0xbe
+	.byte	0xc
+	.long	0x3bb
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x1e
+	.byte	0xc2
+	.byte	0x6
+	.long	0x167d
+	.uleb128 0x1
+	.long	.LASF3012
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3013
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3014
+	.byte	0x2
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3015
+	.byte	0x1f
+	.byte	0x1e
+	.byte	0x5
+	.long	0x3bb
+	.long	0x1693
+	.uleb128 0x3
+	.long	0xde
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3017
+	.byte	0x19
+	.byte	0x4c
+	.byte	0x9
+	.long	0xab
+	.uleb128 0xf
+	.long	.LASF3016
+	.byte	0x12
+	.byte	0x47
+	.byte	0x5
+	.long	0x3bb
+	.long	0x16b5
+	.uleb128 0x3
+	.long	0xde
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3018
+	.byte	0x19
+	.byte	0x4a
+	.byte	0x9
+	.long	0xab
+	.uleb128 0x17
+	.long	.LASF3019
+	.byte	0x19
+	.byte	0x46
+	.byte	0xa
+	.long	0xcd
+	.uleb128 0x17
+	.long	.LASF3020
+	.byte	0x19
+	.byte	0x48
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0xf
+	.long	.LASF3021
+	.byte	0xc
+	.byte	0x75
+	.byte	0xa
+	.long	0xde
+	.long	0x16ef
+	.uleb128 0x3
+	.long	0x9ea
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2738
+	.byte	0xc
+	.byte	0x78
+	.byte	0x9
+	.long	0xb7
+	.long	0x1705
+	.uleb128 0x3
+	.long	0x9d1
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3022
+	.byte	0x20
+	.byte	0x17
+	.byte	0xd
+	.long	0xc96
+	.long	0x1725
+	.uleb128 0x3
+	.long	0xd67
+	.uleb128 0x3
+	.long	0xd67
+	.uleb128 0x3
+	.long	0xd6c
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3023
+	.byte	0xf
+	.byte	0x30
+	.long	0x173b
+	.uleb128 0x3
+	.long	0xd71
+	.uleb128 0x3
+	.long	0x17b
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3024
+	.byte	0xf
+	.byte	0x1e
+	.long	0x1751
+	.uleb128 0x3
+	.long	0xd71
+	.uleb128 0x3
+	.long	0xb7
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2735
+	.byte	0xc
+	.byte	0x74
+	.long	0x1767
+	.uleb128 0x3
+	.long	0x9d1
+	.uleb128 0x3
+	.long	0xb7
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3025
+	.byte	0xf
+	.byte	0x26
+	.byte	0x9
+	.long	0xb7
+	.long	0x177d
+	.uleb128 0x3
+	.long	0xd71
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3026
+	.byte	0xf
+	.byte	0x2b
+	.byte	0x5
+	.long	0x7c
+	.long	0x1793
+	.uleb128 0x3
+	.long	0xd71
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3027
+	.byte	0x1d
+	.byte	0x43
+	.byte	0x5
+	.long	0x3bb
+	.long	0x17a9
+	.uleb128 0x3
+	.long	0xef6
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3028
+	.byte	0x21
+	.byte	0x1d
+	.byte	0xa
+	.long	0xde
+	.uleb128 0xf
+	.long	.LASF3029
+	.byte	0x15
+	.byte	0x92
+	.byte	0xf
+	.long	0x9d1
+	.long	0x17e4
+	.uleb128 0x3
+	.long	0xfca
+	.uleb128 0x3
+	.long	0xf69
+	.uleb128 0x3
+	.long	0x7fe
+	.uleb128 0x3
+	.long	0xde
+	.uleb128 0x3
+	.long	0x79a
+	.uleb128 0x3
+	.long	0x7f2
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3030
+	.byte	0x15
+	.byte	0x9a
+	.long	0x17f5
+	.uleb128 0x3
+	.long	0x9d1
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3031
+	.byte	0x15
+	.byte	0x89
+	.byte	0xf
+	.long	0xef6
+	.long	0x1810
+	.uleb128 0x3
+	.long	0x1810
+	.uleb128 0x3
+	.long	0xf69
+	.byte	0
+	.uleb128 0x5
+	.long	0x103e
+	.uleb128 0xf
+	.long	.LASF3032
+	.byte	0x15
+	.byte	0x86
+	.byte	0x15
+	.long	0x1569
+	.long	0x182b
+	.uleb128 0x3
+	.long	0xf69
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3039
+	.value	0x22a
+	.long	0x189e
+	.uleb128 0x8
+	.long	.LASF3033
+	.value	0x22c
+	.byte	0xe
+	.long	0xde
+	.uleb128 0x2f
+	.long	0x1852
+	.uleb128 0xd
+	.string	"c"
+	.value	0x237
+	.byte	0x11
+	.long	0xb7
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.string	"id"
+	.value	0x254
+	.byte	0x12
+	.long	0xcd
+	.uleb128 0x8
+	.long	.LASF3034
+	.value	0x25b
+	.byte	0x11
+	.long	0xab
+	.uleb128 0x8
+	.long	.LASF3035
+	.value	0x25c
+	.byte	0x12
+	.long	0xde
+	.uleb128 0x8
+	.long	.LASF3036
+	.value	0x25d
+	.byte	0x18
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF3037
+	.value	0x25e
+	.byte	0x18
+	.long	0xb7
+	.uleb128 0x19
+	.uleb128 0x8
+	.long	.LASF3038
+	.value	0x26e
+	.byte	0x1e
+	.long	0xcd
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3040
+	.value	0x1e4
+	.long	0x193a
+	.uleb128 0x16
+	.long	.LASF3049
+	.value	0x1e4
+	.byte	0x30
+	.long	0x193a
+	.uleb128 0x8
+	.long	.LASF3041
+	.value	0x1e6
+	.byte	0x14
+	.long	0x193f
+	.uleb128 0x8
+	.long	.LASF3042
+	.value	0x1e7
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF3043
+	.value	0x1e8
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF3044
+	.value	0x1e9
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0xd
+	.string	"cmd"
+	.value	0x1ea
+	.byte	0x18
+	.long	0xd3a
+	.uleb128 0xd
+	.string	"p"
+	.value	0x1ed
+	.byte	0xe
+	.long	0x17b
+	.uleb128 0xd
+	.string	"end"
+	.value	0x1ee
+	.byte	0xe
+	.long	0x17b
+	.uleb128 0x8
+	.long	.LASF3045
+	.value	0x1f0
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0xd
+	.string	"seq"
+	.value	0x1f1
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF3046
+	.value	0x1f2
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x19
+	.uleb128 0x8
+	.long	.LASF3047
+	.value	0x1fe
+	.byte	0x11
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x15ff
+	.uleb128 0x14
+	.long	0xb7
+	.long	0x194f
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3048
+	.value	0x1cd
+	.long	0x1973
+	.uleb128 0x16
+	.long	.LASF3050
+	.value	0x1cd
+	.byte	0x26
+	.long	0xb7
+	.uleb128 0x1a
+	.string	"cmd"
+	.value	0x1cd
+	.byte	0x35
+	.long	0x9f
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF3051
+	.byte	0x1e
+	.value	0x197
+	.byte	0x5
+	.long	0x3bb
+	.long	0x19e5
+	.uleb128 0x8
+	.long	.LASF3044
+	.value	0x199
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0xd
+	.string	"seq"
+	.value	0x19a
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF3052
+	.value	0x19c
+	.byte	0xd
+	.long	0x19e5
+	.uleb128 0xd
+	.string	"p"
+	.value	0x19d
+	.byte	0xe
+	.long	0x17b
+	.uleb128 0xd
+	.string	"end"
+	.value	0x19e
+	.byte	0xe
+	.long	0x17b
+	.uleb128 0x8
+	.long	.LASF3053
+	.value	0x1a0
+	.byte	0xd
+	.long	0xd71
+	.uleb128 0x19
+	.uleb128 0x8
+	.long	.LASF3045
+	.value	0x1a6
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF3054
+	.value	0x1ac
+	.byte	0x11
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0xb7
+	.long	0x19f5
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3055
+	.value	0x175
+	.long	0x1a0d
+	.uleb128 0x16
+	.long	.LASF3052
+	.value	0x175
+	.byte	0x2b
+	.long	0xd67
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3056
+	.value	0x16c
+	.long	0x1a25
+	.uleb128 0x1a
+	.string	"cmd"
+	.value	0x16c
+	.byte	0x2b
+	.long	0x9f
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3057
+	.value	0x15f
+	.long	0x1a3d
+	.uleb128 0x8
+	.long	.LASF3058
+	.value	0x161
+	.byte	0x9
+	.long	0x3bb
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF3074
+	.byte	0x1e
+	.value	0x15a
+	.byte	0x5
+	.long	0x3bb
+	.uleb128 0x18
+	.long	.LASF3059
+	.value	0x13f
+	.long	0x1a62
+	.uleb128 0x8
+	.long	.LASF3060
+	.value	0x145
+	.byte	0x13
+	.long	0x7f2
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3061
+	.value	0x136
+	.uleb128 0x22
+	.long	.LASF3062
+	.value	0x130
+	.uleb128 0x1b
+	.long	.LASF3063
+	.value	0x122
+	.long	0x1aab
+	.uleb128 0x1a
+	.string	"id"
+	.value	0x122
+	.byte	0x2b
+	.long	0xcd
+	.uleb128 0x1a
+	.string	"val"
+	.value	0x122
+	.byte	0x38
+	.long	0xde
+	.uleb128 0x8
+	.long	.LASF3064
+	.value	0x124
+	.byte	0xd
+	.long	0x19e5
+	.uleb128 0xd
+	.string	"dst"
+	.value	0x125
+	.byte	0xe
+	.long	0x17b
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3065
+	.value	0x118
+	.long	0x1ae7
+	.uleb128 0x16
+	.long	.LASF3002
+	.value	0x118
+	.byte	0x2c
+	.long	0xb7
+	.uleb128 0x16
+	.long	.LASF3004
+	.value	0x118
+	.byte	0x3e
+	.long	0x17b
+	.uleb128 0xd
+	.string	"crc"
+	.value	0x11a
+	.byte	0xe
+	.long	0xcd
+	.uleb128 0x19
+	.uleb128 0xd
+	.string	"i"
+	.value	0x11c
+	.byte	0x12
+	.long	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3066
+	.value	0x103
+	.long	0x1b15
+	.uleb128 0x1a
+	.string	"c"
+	.value	0x103
+	.byte	0x27
+	.long	0xb7
+	.uleb128 0x16
+	.long	.LASF3067
+	.value	0x103
+	.byte	0x34
+	.long	0x1b15
+	.uleb128 0xd
+	.string	"crc"
+	.value	0x111
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0x5
+	.long	0xcd
+	.uleb128 0x32
+	.long	.LASF3068
+	.byte	0x1e
+	.byte	0xc8
+	.byte	0xd
+	.long	0x1b69
+	.uleb128 0x33
+	.string	"c"
+	.byte	0x1e
+	.byte	0xc8
+	.byte	0x2b
+	.long	0xcd
+	.uleb128 0xa
+	.long	.LASF3069
+	.byte	0xca
+	.byte	0x10
+	.long	0x3bb
+	.uleb128 0xa
+	.long	.LASF3070
+	.byte	0xcb
+	.byte	0x10
+	.long	0x3bb
+	.uleb128 0xa
+	.long	.LASF3044
+	.byte	0xcc
+	.byte	0x15
+	.long	0xcd
+	.uleb128 0x34
+	.string	"now"
+	.byte	0x1e
+	.byte	0xce
+	.byte	0xe
+	.long	0xde
+	.uleb128 0xa
+	.long	.LASF2726
+	.byte	0xd9
+	.byte	0xe
+	.long	0x17b
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3071
+	.byte	0x1d
+	.byte	0x37
+	.byte	0x59
+	.long	0x1b75
+	.uleb128 0x5
+	.long	0x1410
+	.uleb128 0x23
+	.long	.LASF3072
+	.byte	0x19
+	.byte	0x2f
+	.byte	0x53
+	.long	0x1b86
+	.uleb128 0x5
+	.long	0x11b4
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x21
+	.sleb128 -1
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 34 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 36 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x24
+	.file 37 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x26
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 39 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 40 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 43 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 45 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x2d
+	.file 46 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 50 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 51 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF806
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF842
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0x111
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF870
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF871
+	.byte	0x4
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF888
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF889
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF890
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF891
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF894
+	.file 63 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF895
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF912
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF925
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF930
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF933
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF934
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF950
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF951
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF952
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF964
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF971
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF972
+	.byte	0x4
+	.byte	0x4
+	.file 80 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF976
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x51
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x52
+	.byte	0x4
+	.byte	0x4
+	.file 83 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x54
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1376
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x59
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x1c2
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x1d3
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e4
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x3
+	.uleb128 0x1f5
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x3
+	.uleb128 0x206
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/mathcalls-narrow.h"
+	.byte	0x3
+	.uleb128 0x236
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x3
+	.uleb128 0x268
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x3
+	.uleb128 0x2b9
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x3
+	.uleb128 0x2c3
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x3
+	.uleb128 0x2cd
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x3
+	.uleb128 0x2d7
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x3
+	.uleb128 0x2eb
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x3
+	.uleb128 0x2f5
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x3
+	.uleb128 0x2ff
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x3
+	.uleb128 0x313
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x3
+	.uleb128 0x31d
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x3
+	.uleb128 0x331
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/iscanonical.h"
+	.byte	0x3
+	.uleb128 0x41e
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.file 93 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x5d
+	.file 94 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.file 95 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x5f
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.file 96 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x60
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1744
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.file 97 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 98 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x11
+	.uleb128 0x62
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 99 "./src/main/config/config_profile.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x63
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.file 100 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x64
+	.file 101 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x4
+	.file 102 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.file 103 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x67
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.file 104 "./src/main/drivers/compass.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x68
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2011
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.file 105 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x69
+	.byte	0x4
+	.file 106 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6a
+	.byte	0x4
+	.file 107 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.file 108 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.file 109 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6d
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.file 110 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.file 111 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x6f
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2404
+	.byte	0x4
+	.file 112 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.file 113 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x71
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2408
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2409
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x13
+	.file 114 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x72
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2445
+	.byte	0x4
+	.byte	0x4
+	.file 115 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x14
+	.byte	0x4
+	.file 116 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x74
+	.file 117 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x75
+	.file 118 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x76
+	.file 119 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x77
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro98
+	.byte	0x4
+	.file 120 "./src/main/flight/navigation.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x78
+	.byte	0x4
+	.file 121 "./src/main/io/beeper.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x79
+	.byte	0x4
+	.file 122 "./src/main/io/motors.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x7a
+	.byte	0x4
+	.file 123 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x7b
+	.byte	0x7
+	.long	.Ldebug_macro99
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2480
+	.byte	0x4
+	.file 124 "./src/main/sensors/boardalignment.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x7c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro100
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x19
+	.file 125 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x7d
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2484
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x17
+	.file 126 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7e
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x18
+	.file 127 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro101
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2489
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2490
+	.byte	0x4
+	.file 128 "./src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x80
+	.byte	0x4
+	.file 129 "./src/main/sensors/gyro.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x81
+	.byte	0x4
+	.file 130 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x82
+	.byte	0x7
+	.long	.Ldebug_macro102
+	.byte	0x4
+	.file 131 "./src/main/rx/msp.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x83
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2519
+	.byte	0x4
+	.file 132 "./src/main/telemetry/smartport.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x84
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2532
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2536
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF800
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF801
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF815
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF834
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF863
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF869
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.526987f9f8e61fa953f503f76de36390,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF887
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.135.9eeb6b52c2522ad7aff16ad95342972e,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF903
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF911
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF929
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF932
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.52.4f882364bb7424384ae71496b52638dc,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF945
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF949
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF970
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mathvector.h.33.426307abd837c7578aa345ec75a935fe,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1251
+	.byte	0x6
+	.uleb128 0x27
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1253
+	.byte	0x6
+	.uleb128 0x29
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1255
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1257
+	.byte	0x6
+	.uleb128 0x2d
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1261
+	.byte	0x6
+	.uleb128 0x31
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1263
+	.byte	0x6
+	.uleb128 0x33
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1265
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x37
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1275
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1289
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1291
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1293
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1299
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1301
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1303
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1305
+	.byte	0x6
+	.uleb128 0x5d
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1307
+	.byte	0x6
+	.uleb128 0x5f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x61
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x63
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x65
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1317
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1319
+	.byte	0x6
+	.uleb128 0x6b
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1321
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1323
+	.byte	0x6
+	.uleb128 0x6f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x71
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x73
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x79
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x7d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1345
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1357
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.8f028c1ee8ac6c4f398e013d5427dec4,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1375
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1378
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.3c4d791114d5c338fc474a7612093511,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1383
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.254.ca3e7de6532deca40dba67e461d6dad5,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1413
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6de2485345d5b6379490716b4dace964,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.452.8184d66ba73c125c8bd28dea80a4c9d9,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.469.218877c78015b1717ae5766356baf1a8,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.f0f1ddcb32c8684175f314b5552c764a,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.503.050aa19ee7278d4441b344df6421b993,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.520.aa2763ba954af5f900a4ba25ce66531c,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1404
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1405
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1425
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1426
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1427
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1428
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1438
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.567.81c9ab127e7a32cc86f4982011270879,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x237
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x238
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x239
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1443
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.588.ee8626d99181ddd9f3386a3943164191,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x24c
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x24d
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x24e
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.617.4c4ee889cca4bba991ad584a38c908c9,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x269
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x26a
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x26b
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.698.c0fd40a14c94aa85ac678802398b8163,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ba
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2bb
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2bc
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.708.123cfa20a6765b130031cd90bac0946c,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2c4
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2c5
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2c6
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.718.88328fbbe76fed221cf679e8a32a9128,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ce
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2cf
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2d0
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1454
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.728.aa32b6ae2a5e1fce7cfe1b61ae659f74,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2d8
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2d9
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2da
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.748.8c0ada1d64801cca74e295902a72352e,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2ec
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2ed
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2ee
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1457
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.758.ca5ad212d737e9bbf4d6c34c6424f067,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2f6
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x2f7
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x2f8
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.768.285ce50c9a4f9cb6fa63b3fee0d3991e,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x300
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x301
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x302
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1460
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.788.22540c05913604c20c130273e45d65c9,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x314
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x315
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x316
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.798.491ca2ec604688a881269797dc995557,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x31e
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x31f
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x320
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1463
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.818.5469a4aa26b4750070c385ee36567e12,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x332
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x333
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x334
+	.long	.LASF1441
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1464
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1465
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1466
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1467
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1468
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1486
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.iscanonical.h.25.c8e56749b8820735a14b3e9cb9067900,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1490
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.1058.b4b815d1e75233b45ee1f6d02c7d4101,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x4d9
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x4da
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x4de
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x4df
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x4e0
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x4e1
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x4e2
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x4e3
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x4e4
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x4e5
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x4e6
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x4e7
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x4e8
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x4e9
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x4ea
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x4ee
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x4ef
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x4f0
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x4f1
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x4f2
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x4f3
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x4f4
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x4f5
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x4f6
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x4f7
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x4f9
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x4fa
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x4fe
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x4ff
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x500
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x501
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x502
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x503
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x504
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x505
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x506
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x507
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x508
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x509
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x50a
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x53e
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x546
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1651
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1664
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1665
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF804
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1666
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1667
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1612
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1692
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF1693
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF1694
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1695
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF1696
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF1697
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF1698
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1699
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1700
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1701
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1702
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1703
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1704
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1705
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1706
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1707
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1708
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1709
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1710
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1711
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1712
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1713
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1714
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1715
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1716
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1718
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1720
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF1721
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF1722
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1748
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1753
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.21.cc7e12bcb06edb555dbd4e0d50270bbb,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1769
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1788
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1794
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.6bd9c420984336bb9620be44e9be8ea2,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1909
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1911
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro_mpu.h.30.9b00f6f872a4dc829e119a0276665458,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2001
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.00620d83615fdf1f066772bb9c10c680,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2010
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2015
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2023
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2407
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2435
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2444
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_output.h.26.15d08cf8c75e338f934cf45ce99c24db,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.24.8362794d947c339e17997ec0162d97db,comdat
+.Ldebug_macro98:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2470
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro99:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2479
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.41.4f551b2493a924eb974077f3ca4c0645,comdat
+.Ldebug_macro100:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2483
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro101:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2488
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro102:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2518
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x15
+	.long	.LASF1
+	.long	.LASF3075
+	.long	.LASF3076
+	.long	.LASF3077
+	.long	.LASF3078
+	.long	.LASF3079
+	.long	.LASF3080
+	.long	.LASF3081
+	.long	.LASF3082
+	.long	.LASF3083
+	.long	.LASF3084
+	.long	.LASF3085
+	.long	.LASF3086
+	.long	.LASF3087
+	.long	.LASF3088
+	.long	.LASF3089
+	.long	.LASF3090
+	.long	.LASF3091
+	.long	.LASF3092
+	.long	.LASF3093
+	.long	.LASF3094
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x85
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3095
+	.byte	0x10
+	.long	.LASF3096
+	.byte	0x10
+	.long	.LASF3097
+	.byte	0x10
+	.long	.LASF3098
+	.byte	0x2
+	.long	.LASF3099
+	.byte	0x2
+	.long	.LASF3100
+	.byte	0x6
+	.long	.LASF3101
+	.byte	0x4
+	.long	.LASF3102
+	.byte	0x4
+	.long	.LASF3103
+	.byte	0x4
+	.long	.LASF3104
+	.byte	0x4
+	.long	.LASF3105
+	.byte	0x4
+	.long	.LASF3106
+	.byte	0x4
+	.long	.LASF3107
+	.byte	0x5
+	.long	.LASF3108
+	.byte	0x5
+	.long	.LASF3109
+	.byte	0x2
+	.long	.LASF3110
+	.byte	0x8
+	.long	.LASF3111
+	.byte	0x5
+	.long	.LASF3112
+	.byte	0x5
+	.long	.LASF3113
+	.byte	0x6
+	.long	.LASF3114
+	.byte	0x6
+	.long	.LASF3106
+	.byte	0x7
+	.long	.LASF3115
+	.byte	0xa
+	.long	.LASF3116
+	.byte	0xa
+	.long	.LASF3117
+	.byte	0xa
+	.long	.LASF3118
+	.byte	0xa
+	.long	.LASF3119
+	.byte	0xa
+	.long	.LASF3120
+	.byte	0x4
+	.long	.LASF3120
+	.byte	0xa
+	.long	.LASF3121
+	.byte	0xd
+	.long	.LASF3122
+	.byte	0xd
+	.long	.LASF3123
+	.byte	0x3
+	.long	.LASF3124
+	.byte	0x5
+	.long	.LASF3125
+	.byte	0x4
+	.long	.LASF3126
+	.byte	0x13
+	.long	.LASF3127
+	.byte	0x14
+	.long	.LASF3128
+	.byte	0x14
+	.long	.LASF3128
+	.byte	0x13
+	.long	.LASF3129
+	.byte	0x10
+	.long	.LASF3130
+	.byte	0x13
+	.long	.LASF3131
+	.byte	0x13
+	.long	.LASF3132
+	.byte	0x10
+	.long	.LASF3133
+	.byte	0x10
+	.long	.LASF3134
+	.byte	0x12
+	.long	.LASF3135
+	.byte	0x10
+	.long	.LASF3136
+	.byte	0x11
+	.long	.LASF3137
+	.byte	0x11
+	.long	.LASF3138
+	.byte	0x10
+	.long	.LASF3139
+	.byte	0x10
+	.long	.LASF3140
+	.byte	0x10
+	.long	.LASF3141
+	.byte	0x13
+	.long	.LASF3142
+	.byte	0x14
+	.long	.LASF3143
+	.byte	0x10
+	.long	.LASF3144
+	.byte	0x10
+	.long	.LASF3145
+	.byte	0x10
+	.long	.LASF3146
+	.byte	0x10
+	.long	.LASF3147
+	.byte	0xf
+	.long	.LASF3148
+	.byte	0xf
+	.long	.LASF3095
+	.byte	0x12
+	.long	.LASF3149
+	.byte	0xf
+	.long	.LASF3150
+	.byte	0xf
+	.long	.LASF3151
+	.byte	0xf
+	.long	.LASF3152
+	.byte	0xf
+	.long	.LASF3153
+	.byte	0x13
+	.long	.LASF3153
+	.byte	0x10
+	.long	.LASF3154
+	.byte	0x10
+	.long	.LASF3155
+	.byte	0x10
+	.long	.LASF3156
+	.byte	0x10
+	.long	.LASF3157
+	.byte	0x12
+	.long	.LASF3157
+	.byte	0x10
+	.long	.LASF3158
+	.byte	0xf
+	.long	.LASF3159
+	.byte	0xf
+	.long	.LASF3160
+	.byte	0xf
+	.long	.LASF3161
+	.byte	0xf
+	.long	.LASF3162
+	.byte	0x10
+	.long	.LASF3163
+	.byte	0x10
+	.long	.LASF3164
+	.byte	0x10
+	.long	.LASF3165
+	.byte	0x10
+	.long	.LASF3166
+	.byte	0x10
+	.long	.LASF3167
+	.byte	0x10
+	.long	.LASF3168
+	.byte	0x13
+	.long	.LASF3169
+	.byte	0x10
+	.long	.LASF3170
+	.byte	0x10
+	.long	.LASF3171
+	.byte	0x13
+	.long	.LASF3172
+	.byte	0x10
+	.long	.LASF3173
+	.byte	0x10
+	.long	.LASF3174
+	.byte	0x10
+	.long	.LASF3175
+	.byte	0x10
+	.long	.LASF3176
+	.byte	0x10
+	.long	.LASF3177
+	.byte	0x10
+	.long	.LASF3178
+	.byte	0x10
+	.long	.LASF3179
+	.byte	0x10
+	.long	.LASF3180
+	.byte	0x10
+	.long	.LASF3181
+	.byte	0xe
+	.long	.LASF3182
+	.byte	0xc
+	.long	.LASF3183
+	.byte	0xb
+	.long	.LASF3184
+	.byte	0xc
+	.long	.LASF3185
+	.byte	0x2
+	.long	.LASF3186
+	.byte	0x2
+	.long	.LASF3187
+	.byte	0x3
+	.long	.LASF3188
+	.byte	0x3
+	.long	.LASF3189
+	.byte	0x1
+	.long	.LASF3190
+	.byte	0x3
+	.long	.LASF3191
+	.byte	0x4
+	.long	.LASF3192
+	.byte	0x4
+	.long	.LASF3193
+	.byte	0x4
+	.long	.LASF3194
+	.byte	0x4
+	.long	.LASF3195
+	.byte	0x4
+	.long	.LASF3196
+	.byte	0x4
+	.long	.LASF3197
+	.byte	0x4
+	.long	.LASF3198
+	.byte	0x4
+	.long	.LASF3199
+	.byte	0x4
+	.long	.LASF3200
+	.byte	0x4
+	.long	.LASF3201
+	.byte	0x4
+	.long	.LASF3202
+	.byte	0x2
+	.long	.LASF3203
+	.byte	0x6
+	.long	.LASF3204
+	.byte	0x6
+	.long	.LASF3205
+	.byte	0x4
+	.long	.LASF3206
+	.byte	0x4
+	.long	.LASF3207
+	.byte	0x4
+	.long	.LASF3208
+	.byte	0x6
+	.long	.LASF3209
+	.byte	0x7
+	.long	.LASF3210
+	.byte	0x7
+	.long	.LASF3211
+	.byte	0x7
+	.long	.LASF3212
+	.byte	0xa
+	.long	.LASF3213
+	.byte	0x2
+	.long	.LASF3214
+	.byte	0xa
+	.long	.LASF3215
+	.byte	0xa
+	.long	.LASF3192
+	.byte	0xa
+	.long	.LASF3216
+	.byte	0xa
+	.long	.LASF3217
+	.byte	0x9
+	.long	.LASF3110
+	.byte	0x9
+	.long	.LASF3218
+	.byte	0xd
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2168:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1962:
+	.string	"MPU_RA_I2C_MST_STATUS 0x36"
+.LASF2555:
+	.string	"long long int"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1091:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2942:
+	.string	"gpsNoFixLatitude"
+.LASF871:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1660:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF2728:
+	.string	"rxBufferHead"
+.LASF1173:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF2992:
+	.string	"portConfig"
+.LASF2354:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2062:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1439:
+	.string	"_Mret_"
+.LASF1086:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF2516:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF789:
+	.string	"_T_WCHAR "
+.LASF2969:
+	.string	"FSSP_DATAID_SPEED"
+.LASF2401:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF1387:
+	.string	"FP_INT_TONEARESTFROMZERO 3"
+.LASF2386:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF2305:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1155:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2614:
+	.string	"read"
+.LASF2521:
+	.string	"SMARTPORT_BAUD 57600"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF806:
+	.string	"_STDLIB_H 1"
+.LASF1398:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1728:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF2563:
+	.string	"RGB_GREEN"
+.LASF1542:
+	.string	"M_1_PIf32 __f32 (0.318309886183790671537767526745028724)"
+.LASF1579:
+	.string	"M_PI_2f32x __f32x (1.570796326794896619231321691639751442)"
+.LASF2625:
+	.string	"mpuConfiguration_s"
+.LASF2632:
+	.string	"mpuConfiguration_t"
+.LASF2540:
+	.string	"long unsigned int"
+.LASF3002:
+	.string	"frameId"
+.LASF785:
+	.string	"__wchar_t__ "
+.LASF2847:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF992:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1804:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF2827:
+	.string	"HEADFREE_MODE"
+.LASF2056:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF2267:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2760:
+	.string	"FEATURE_RX_MSP"
+.LASF2259:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1040:
+	.string	"__DECL_SIMD_acosf "
+.LASF2562:
+	.string	"RGB_RED"
+.LASF1983:
+	.string	"MPU_RA_I2C_SLV0_DO 0x63"
+.LASF1913:
+	.string	"MPU_RA_WHO_AM_I_LEGACY 0x00"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2790:
+	.string	"sbuf_t"
+.LASF2190:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1949:
+	.string	"MPU_RA_I2C_SLV1_REG 0x29"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF3046:
+	.string	"version"
+.LASF1694:
+	.string	"USE_PWM"
+.LASF2583:
+	.string	"pidSumLimitYaw"
+.LASF1045:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1077:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1285:
+	.string	"__DECL_SIMD_asinf __DECL_SIMD_x86_64"
+.LASF1761:
+	.string	"DECIDEGREES_TO_DEGREES(angle) (angle / 10)"
+.LASF2231:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2472:
+	.string	"LON 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1262:
+	.string	"__DECL_SIMD_log"
+.LASF982:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF897:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF2466:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF380:
+	.string	"__unix 1"
+.LASF1801:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF1716:
+	.string	"VTX_CONTROL"
+.LASF833:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF2782:
+	.string	"dynThrPID"
+.LASF1584:
+	.string	"M_SQRT2f32x __f32x (1.414213562373095048801688724209698079)"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2871:
+	.string	"serialPortConfig_s"
+.LASF2877:
+	.string	"serialPortConfig_t"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF1128:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF2957:
+	.string	"SPSTATE_INITIALIZED"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1068:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2890:
+	.string	"CURRENT_METER_NONE"
+.LASF396:
+	.string	"__REVISION__ \"669c324\""
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2470:
+	.string	"CHANNEL_FORWARDING_DISABLED (uint8_t)0xFF"
+.LASF1463:
+	.string	"__MATHCALL_NAME(name) f64x ## name ## f128"
+.LASF1189:
+	.string	"__DECL_SIMD_acosh "
+.LASF2826:
+	.string	"GPS_HOLD_MODE"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF2500:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1049:
+	.string	"__DECL_SIMD_atan "
+.LASF1441:
+	.string	"__MATHCALL_NAME"
+.LASF1293:
+	.string	"__DECL_SIMD_exp2f __DECL_SIMD_x86_64"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1960:
+	.string	"MPU_RA_I2C_SLV4_CTRL 0x34"
+.LASF3058:
+	.string	"newTelemetryEnabledValue"
+.LASF2816:
+	.string	"OK_TO_ARM"
+.LASF1639:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF1314:
+	.string	"__DECL_SIMD_atan2"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1211:
+	.string	"__DECL_SIMD_tanhl "
+.LASF2301:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2441:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF2841:
+	.string	"PORTSHARING_SHARED"
+.LASF2574:
+	.string	"PIDVEL"
+.LASF1468:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1723:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF2260:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF2651:
+	.string	"resolution"
+.LASF1934:
+	.string	"MPU_RA_CONFIG 0x1A"
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1818:
+	.string	"MAX_PID_PROCESS_DENOM 16"
+.LASF1085:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1280:
+	.string	"__DECL_SIMD_atanf"
+.LASF1330:
+	.string	"__DECL_SIMD_atanh"
+.LASF1472:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1548:
+	.string	"M_LOG2Ef64 __f64 (1.442695040888963407359924681001892137)"
+.LASF3047:
+	.string	"p_size"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF2506:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2293:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2846:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1496:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1313:
+	.string	"__DECL_SIMD_cbrtf __DECL_SIMD_x86_64"
+.LASF1022:
+	.string	"__DECL_SIMD_expf16 "
+.LASF898:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1966:
+	.string	"MPU_RA_INT_STATUS 0x3A"
+.LASF2592:
+	.string	"dtermSetpointWeight"
+.LASF1787:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF870:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF2700:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1389:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF2185:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1353:
+	.string	"__DECL_SIMD_erfcf __DECL_SIMD_x86_64"
+.LASF1038:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2797:
+	.string	"result"
+.LASF2371:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1765:
+	.string	"MIN(a,b) ((a) < (b) ? (a) : (b))"
+.LASF3031:
+	.string	"determinePortSharing"
+.LASF1714:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF2999:
+	.string	"smartPortLastRequestTime"
+.LASF1253:
+	.string	"__DECL_SIMD_cosf __DECL_SIMD_x86_64"
+.LASF1218:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2024:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1600:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF2240:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2468:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1759:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1863:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1981:
+	.string	"MPU_RA_EXT_SENS_DATA_00 0x49"
+.LASF2932:
+	.string	"baroTemperature"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF947:
+	.string	"__blkcnt_t_defined "
+.LASF1632:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF1522:
+	.string	"M_LOG2El 1.442695040888963407359924681001892137L"
+.LASF1453:
+	.string	"_Marg_ _Float128"
+.LASF916:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF2227:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF2952:
+	.string	"pidValuesAsTelemetry"
+.LASF1713:
+	.string	"USE_DASHBOARD"
+.LASF2206:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1041:
+	.string	"__DECL_SIMD_acosl "
+.LASF2611:
+	.string	"sensorAccInitFuncPtr"
+.LASF1329:
+	.string	"__DECL_SIMD_log1pf __DECL_SIMD_x86_64"
+.LASF1435:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1526:
+	.string	"M_PIl 3.141592653589793238462643383279502884L"
+.LASF1374:
+	.string	"SNANF32X (__builtin_nansf32x (\"\"))"
+.LASF1780:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2215:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF820:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2378:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2669:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1050:
+	.string	"__DECL_SIMD_atanf "
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF2554:
+	.string	"uint32_t"
+.LASF2026:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2132:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2923:
+	.string	"up_delay"
+.LASF2988:
+	.string	"FSSP_DATAID_GPS_ALT"
+.LASF1311:
+	.string	"__DECL_SIMD_cbrt __DECL_SIMD_x86_64"
+.LASF2573:
+	.string	"PIDMAG"
+.LASF2139:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF993:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2523:
+	.string	"SMARTPORT_SERVICE_TIMEOUT_MS 1"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF2427:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2384:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF2202:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1832:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF2070:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF912:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF2646:
+	.string	"MPU_HALF_RESOLUTION"
+.LASF1896:
+	.string	"PG_ADC_CONFIG 510"
+.LASF1764:
+	.string	"CM_S_TO_KM_H(centimetersPerSecond) (centimetersPerSecond * 36 / 1000)"
+.LASF2922:
+	.string	"ut_delay"
+.LASF2832:
+	.string	"flightModeFlags"
+.LASF1376:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1946:
+	.string	"MPU_RA_I2C_SLV0_REG 0x26"
+.LASF2181:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF2435:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF983:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF2684:
+	.string	"OWNER_OSD_CS"
+.LASF2491:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2524:
+	.string	"SMARTPORT_FRAME_SIZE sizeof(smartPortFrame_t)"
+.LASF1096:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1662:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1580:
+	.string	"M_PI_4f32x __f32x (0.785398163397448309615660845819875721)"
+.LASF1573:
+	.string	"M_Ef32x __f32x (2.718281828459045235360287471352662498)"
+.LASF2177:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF856:
+	.string	"__f32(x) x ##f32"
+.LASF1988:
+	.string	"MPU_RA_SIGNAL_PATH_RESET 0x68"
+.LASF3015:
+	.string	"feature"
+.LASF2283:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1278:
+	.string	"__DECL_SIMD_atan"
+.LASF1894:
+	.string	"PG_PWM_CONFIG 508"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1250:
+	.string	"__DECL_SIMD_cos"
+.LASF2130:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2112:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2849:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1866:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1781:
+	.string	"BIT(x) (1 << (x))"
+.LASF2099:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF1730:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF3020:
+	.string	"getBatteryCellCount"
+.LASF2321:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1152:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2747:
+	.string	"serialPort_t"
+.LASF989:
+	.string	"__DECL_SIMD_sin "
+.LASF1641:
+	.string	"TELEMETRY_SRXL "
+.LASF938:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF2374:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF2318:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1391:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1388:
+	.string	"FP_INT_TONEAREST 4"
+.LASF2310:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1450:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64"
+.LASF878:
+	.string	"__mode_t_defined "
+.LASF2837:
+	.string	"attitudeEulerAngles_t"
+.LASF1159:
+	.string	"__DECL_SIMD_log2 "
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1927:
+	.string	"MPU_RA_XG_OFFS_USRH 0x13"
+.LASF988:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1617:
+	.string	"USE_PWM "
+.LASF1865:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF933:
+	.string	"__timeval_defined 1"
+.LASF2013:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF2436:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF2462:
+	.string	"QUAD_MOTOR_COUNT 4"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1256:
+	.string	"__DECL_SIMD_sinf"
+.LASF2915:
+	.string	"accSamplingInterval"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1179:
+	.string	"__DECL_SIMD_atanh "
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1569:
+	.string	"M_2_PIf128 __f128 (0.636619772367581343075535053490057448)"
+.LASF1505:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2150:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2324:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1696:
+	.string	"USE_SERIALRX_CRSF"
+.LASF2382:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1360:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2663:
+	.string	"OWNER_ADC_EXT"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1842:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF2535:
+	.string	"SMARTPORT_MSP_RX_BUF_SIZE 64"
+.LASF1148:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF2297:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1752:
+	.string	"HSV_VALUE_MAX 255"
+.LASF545:
+	.string	"__wur "
+.LASF2444:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1871:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF1089:
+	.string	"__DECL_SIMD_exp10 "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF2703:
+	.string	"MODE_RXTX"
+.LASF2021:
+	.string	"IOCFG_IPD 0"
+.LASF1910:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF1610:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1469:
+	.string	"__MATHCALL_NARROW"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF868:
+	.string	"EXIT_SUCCESS 0"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1630:
+	.string	"TELEMETRY_HOTT "
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1930:
+	.string	"MPU_RA_YG_OFFS_USRL 0x16"
+.LASF2344:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2224:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF840:
+	.string	"__f128(x) x ##f128"
+.LASF1534:
+	.string	"M_Ef32 __f32 (2.718281828459045235360287471352662498)"
+.LASF1684:
+	.string	"USE_UART2 "
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF2399:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1993:
+	.string	"MPU_RA_BANK_SEL 0x6D"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF3054:
+	.string	"size"
+.LASF1030:
+	.string	"__DECL_SIMD_powf "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF2281:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF3028:
+	.string	"millis"
+.LASF1901:
+	.string	"PG_VTX_CONFIG 515"
+.LASF2255:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1095:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF2348:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1779:
+	.string	"UNUSED(x) (void)(x)"
+.LASF920:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1495:
+	.string	"M_E 2.7182818284590452354"
+.LASF3025:
+	.string	"sbufReadU8"
+.LASF1950:
+	.string	"MPU_RA_I2C_SLV1_CTRL 0x2A"
+.LASF1223:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF975:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF2107:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1517:
+	.string	"M_2_PIf 0.63661977236758134308f"
+.LASF2488:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2784:
+	.string	"tpa_breakpoint"
+.LASF2824:
+	.string	"BARO_MODE"
+.LASF1921:
+	.string	"MPU_RA_XA_OFFS_L_TC 0x07"
+.LASF1879:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2133:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1893:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1895:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF895:
+	.string	"_ENDIAN_H 1"
+.LASF1014:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1727:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF804:
+	.string	"NULL ((void *)0)"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2016:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2727:
+	.string	"txBuffer"
+.LASF949:
+	.string	"__fsfilcnt_t_defined "
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1642:
+	.string	"USE_DASHBOARD "
+.LASF2687:
+	.string	"OWNER_MPU_EXTI"
+.LASF1025:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1015:
+	.string	"__DECL_SIMD_logf128 "
+.LASF586:
+	.string	"__stub_stty "
+.LASF979:
+	.string	"__DECL_SIMD_cos "
+.LASF2735:
+	.string	"serialWrite"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1559:
+	.string	"M_SQRT1_2f64 __f64 (0.707106781186547524400844362104849039)"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2904:
+	.string	"batteryNotPresentLevel"
+.LASF827:
+	.string	"__WCOREFLAG 0x80"
+.LASF1612:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1735:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2411:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF2630:
+	.string	"resetFn"
+.LASF1899:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF2095:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2618:
+	.string	"accAlign"
+.LASF2248:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF2416:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF2657:
+	.string	"OWNER_MOTOR"
+.LASF1943:
+	.string	"MPU_RA_FIFO_EN 0x23"
+.LASF2977:
+	.string	"FSSP_DATAID_LATLONG"
+.LASF2003:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1538:
+	.string	"M_LN10f32 __f32 (2.302585092994045684017991454684364208)"
+.LASF1166:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2743:
+	.string	"beginWrite"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF805:
+	.string	"__need_NULL"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF2158:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1168:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF378:
+	.string	"__linux__ 1"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1837:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF2637:
+	.string	"MPU_65xx_I2C"
+.LASF1244:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1004:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2359:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF823:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF2662:
+	.string	"OWNER_ADC_CURR"
+.LASF1986:
+	.string	"MPU_RA_I2C_SLV3_DO 0x66"
+.LASF2955:
+	.string	"telemetryConfig_System"
+.LASF2913:
+	.string	"batteryConfig_System"
+.LASF1686:
+	.string	"USE_UART4 "
+.LASF1861:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF2822:
+	.string	"HORIZON_MODE"
+.LASF1062:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF509:
+	.string	"__P(args) args"
+.LASF2821:
+	.string	"ANGLE_MODE"
+.LASF1850:
+	.string	"PG_RX_CONFIG 24"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF852:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF906:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF2086:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1963:
+	.string	"MPU_RA_INT_PIN_CFG 0x37"
+.LASF1153:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF2044:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2585:
+	.string	"vbatPidCompensation"
+.LASF1182:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF2154:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF2648:
+	.string	"mpu6050Resolution_e"
+.LASF2998:
+	.string	"smartPortIdCnt"
+.LASF2802:
+	.string	"mspPacket_t"
+.LASF1434:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2495:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1258:
+	.string	"__DECL_SIMD_sincos"
+.LASF2037:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF961:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1553:
+	.string	"M_PI_2f64 __f64 (1.570796326794896619231321691639751442)"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF2443:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1042:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2244:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF3017:
+	.string	"getMAhDrawn"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1828:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1447:
+	.string	"_Marg_ _Float32x"
+.LASF1536:
+	.string	"M_LOG10Ef32 __f32 (0.434294481903251827651128918916605082)"
+.LASF2667:
+	.string	"OWNER_PINDEBUG"
+.LASF968:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF2039:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1510:
+	.string	"M_LOG10Ef 0.43429448190325182765f"
+.LASF860:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1519:
+	.string	"M_SQRT2f 1.41421356237309504880f"
+.LASF2903:
+	.string	"vbatwarningcellvoltage"
+.LASF1874:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF2525:
+	.string	"SMARTPORT_TX_BUF_SIZE 256"
+.LASF2656:
+	.string	"OWNER_PPMINPUT"
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1503:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1625:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1876:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF2170:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2084:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1889:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF1306:
+	.string	"__DECL_SIMD_sinh"
+.LASF969:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF2742:
+	.string	"writeBuf"
+.LASF2361:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1382:
+	.string	"FP_LLOGB0 (-__FP_LONG_MAX - 1)"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2353:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2015:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF2082:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2292:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2282:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF927:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1648:
+	.string	"VTX_COMMON "
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF2228:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1596:
+	.string	"M_2_SQRTPIf64x __f64x (1.128379167095512573896158903121545172)"
+.LASF2334:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2186:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2212:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF2395:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2314:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1996:
+	.string	"MPU_RA_DMP_CFG_1 0x70"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2565:
+	.string	"PIDROLL"
+.LASF838:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2309:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1220:
+	.string	"__DECL_SIMD_asinhf "
+.LASF2274:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1036:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1006:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF2953:
+	.string	"report_cell_voltage"
+.LASF892:
+	.string	"__useconds_t_defined "
+.LASF2033:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF824:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1862:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF2948:
+	.string	"frsky_unit"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2894:
+	.string	"CURRENT_METER_MAX"
+.LASF1976:
+	.string	"MPU_RA_GYRO_XOUT_L 0x44"
+.LASF2047:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF3008:
+	.string	"smartPortFrameReceived"
+.LASF1554:
+	.string	"M_PI_4f64 __f64 (0.785398163397448309615660845819875721)"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF2739:
+	.string	"serialSetBaudRate"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1130:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF2423:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF879:
+	.string	"__nlink_t_defined "
+.LASF2542:
+	.string	"__uint8_t"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2124:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF2009:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF2410:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1197:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF803:
+	.string	"NULL"
+.LASF2235:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF2713:
+	.string	"SERIAL_BIDIR"
+.LASF960:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1177:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF2153:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2421:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1667:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF958:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1267:
+	.string	"__DECL_SIMD_exp __DECL_SIMD_x86_64"
+.LASF2606:
+	.string	"pidProfile_s"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2566:
+	.string	"PIDPITCH"
+.LASF382:
+	.string	"unix 1"
+.LASF2053:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1998:
+	.string	"MPU_RA_FIFO_COUNTH 0x72"
+.LASF2905:
+	.string	"voltageMeterSource"
+.LASF1133:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1701:
+	.string	"USE_SERIALRX_SUMH"
+.LASF3029:
+	.string	"openSerialPort"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF3056:
+	.string	"initSmartPortMspReply"
+.LASF913:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF2166:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1493:
+	.string	"iszero(x) (((__typeof (x)) (x)) == 0)"
+.LASF2711:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF2696:
+	.string	"OWNER_TRANSPONDER"
+.LASF2011:
+	.string	"MAG_I2C_INSTANCE I2C_DEVICE"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF946:
+	.string	"__blksize_t_defined "
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2752:
+	.string	"FEATURE_SERVO_TILT"
+.LASF928:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF2798:
+	.string	"streamLimit"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF959:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1423:
+	.string	"_Mdouble_ _Float64x"
+.LASF2000:
+	.string	"MPU_RA_FIFO_R_W 0x74"
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF1026:
+	.string	"__DECL_SIMD_expf32x "
+.LASF865:
+	.string	"__lldiv_t_defined 1"
+.LASF2129:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF1609:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF2072:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF886:
+	.string	"__daddr_t_defined "
+.LASF2208:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF2460:
+	.string	"PWM_BRUSHED_TIMER_MHZ 24"
+.LASF1884:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF812:
+	.string	"WNOWAIT 0x01000000"
+.LASF2002:
+	.string	"MPU_I2C_INSTANCE I2C_DEVICE"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF1063:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF2636:
+	.string	"MPU_60x0_SPI"
+.LASF2452:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF1566:
+	.string	"M_PI_2f128 __f128 (1.570796326794896619231321691639751442)"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1395:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF2690:
+	.string	"OWNER_USB_DETECT"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF2269:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2450:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1157:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1512:
+	.string	"M_LN10f 2.30258509299404568402f"
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1162:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1623:
+	.string	"USE_SERIALRX_SUMD "
+.LASF3009:
+	.string	"smartPortMspTxBuffer"
+.LASF2874:
+	.string	"gps_baudrateIndex"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF2677:
+	.string	"OWNER_SDCARD"
+.LASF1571:
+	.string	"M_SQRT2f128 __f128 (1.414213562373095048801688724209698079)"
+.LASF924:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1706:
+	.string	"TELEMETRY_HOTT"
+.LASF2110:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1043:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF2695:
+	.string	"OWNER_LED_STRIP"
+.LASF1035:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1005:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF3036:
+	.string	"t1Cnt"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2793:
+	.string	"MSP_RESULT_NO_REPLY"
+.LASF1323:
+	.string	"__DECL_SIMD_log2 __DECL_SIMD_x86_64"
+.LASF2763:
+	.string	"FEATURE_DASHBOARD"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2298:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF2020:
+	.string	"IOCFG_AF_OD 0"
+.LASF2645:
+	.string	"mpuSensor_e"
+.LASF2376:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1069:
+	.string	"__DECL_SIMD_hypot "
+.LASF2200:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF377:
+	.string	"__linux 1"
+.LASF2898:
+	.string	"VOLTAGE_METER_ESC"
+.LASF2302:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1854:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1047:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1827:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2778:
+	.string	"rcExpo8"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2380:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1982:
+	.string	"MPU_RA_MOT_DETECT_STATUS 0x61"
+.LASF2730:
+	.string	"txBufferHead"
+.LASF1108:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1831:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF2623:
+	.string	"mpuWriteRegisterFnPtr"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1529:
+	.string	"M_1_PIl 0.318309886183790671537767526745028724L"
+.LASF2508:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1221:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2928:
+	.string	"calculate"
+.LASF1170:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1619:
+	.string	"USE_SERIALRX_CRSF "
+.LASF2716:
+	.string	"serialReceiveCallbackPtr"
+.LASF2042:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF798:
+	.string	"_GCC_WCHAR_T "
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2326:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1288:
+	.string	"__DECL_SIMD_hypotf"
+.LASF1339:
+	.string	"__DECL_SIMD_erf __DECL_SIMD_x86_64"
+.LASF1058:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF3049:
+	.string	"sp_frame"
+.LASF2196:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF2818:
+	.string	"ARMED"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF2349:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1552:
+	.string	"M_PIf64 __f64 (3.141592653589793238462643383279502884)"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1408:
+	.string	"_Mdouble_ float"
+.LASF2232:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1102:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF2106:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2654:
+	.string	"OWNER_FREE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF2379:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1430:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2629:
+	.string	"verifywriteFn"
+.LASF2852:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF2486:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF2471:
+	.string	"LAT 0"
+.LASF2473:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF899:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1540:
+	.string	"M_PI_2f32 __f32 (1.570796326794896619231321691639751442)"
+.LASF2108:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1327:
+	.string	"__DECL_SIMD_log1p __DECL_SIMD_x86_64"
+.LASF1034:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1294:
+	.string	"__DECL_SIMD_exp10"
+.LASF929:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1588:
+	.string	"M_LOG10Ef64x __f64x (0.434294481903251827651128918916605082)"
+.LASF2647:
+	.string	"MPU_FULL_RESOLUTION"
+.LASF1656:
+	.string	"_T_PTRDIFF_ "
+.LASF797:
+	.string	"__INT_WCHAR_T_H "
+.LASF3030:
+	.string	"closeSerialPort"
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF987:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1977:
+	.string	"MPU_RA_GYRO_YOUT_H 0x45"
+.LASF1786:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF905:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF2474:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF2400:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2010:
+	.string	"GYRO_LPF_NONE 7"
+.LASF1888:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1131:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1103:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1079:
+	.string	"__DECL_SIMD_exp2 "
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF2744:
+	.string	"endWrite"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF1087:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1784:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF3023:
+	.string	"sbufSwitchToReader"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1072:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1457:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64x"
+.LASF1404:
+	.string	"_Mdouble_"
+.LASF2333:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1266:
+	.string	"__DECL_SIMD_exp"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF2325:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1722:
+	.string	"USE_DSHOT"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1650:
+	.string	"VTX_SMARTAUDIO "
+.LASF2587:
+	.string	"levelAngleLimit"
+.LASF1023:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2829:
+	.string	"PASSTHRU_MODE"
+.LASF2530:
+	.string	"SMARTPORT_MSP_VER_MASK (0x7 << SMARTPORT_MSP_VER_SHIFT)"
+.LASF2057:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1616:
+	.string	"USE_PPM "
+.LASF2140:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2825:
+	.string	"GPS_HOME_MODE"
+.LASF923:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF2162:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1671:
+	.string	"U_ID_0 0"
+.LASF2671:
+	.string	"OWNER_SYSTEM"
+.LASF1292:
+	.string	"__DECL_SIMD_exp2f"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF2881:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1345:
+	.string	"__DECL_SIMD_tanhf __DECL_SIMD_x86_64"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF2843:
+	.string	"FUNCTION_NONE"
+.LASF2972:
+	.string	"FSSP_DATAID_RPM"
+.LASF1856:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1708:
+	.string	"TELEMETRY_CRSF"
+.LASF2105:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF2947:
+	.string	"frsky_coordinate_format"
+.LASF2360:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1720:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1805:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1914:
+	.string	"MPU_RA_XG_OFFS_TC 0x00"
+.LASF1019:
+	.string	"__DECL_SIMD_exp "
+.LASF2902:
+	.string	"vbatmincellvoltage"
+.LASF2494:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1951:
+	.string	"MPU_RA_I2C_SLV2_ADDR 0x2B"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1669:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1180:
+	.string	"__DECL_SIMD_atanhf "
+.LASF954:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1116:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1290:
+	.string	"__DECL_SIMD_exp2"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2383:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2984:
+	.string	"FSSP_DATAID_ACCY"
+.LASF2985:
+	.string	"FSSP_DATAID_ACCZ"
+.LASF957:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1628:
+	.string	"TELEMETRY "
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1237:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1425:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1908:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2352:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2511:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF1268:
+	.string	"__DECL_SIMD_expf"
+.LASF3065:
+	.string	"smartPortSendPackageEx"
+.LASF2370:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2771:
+	.string	"FEATURE_RX_SPI"
+.LASF1214:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF2025:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2273:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1225:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF3042:
+	.string	"mspStarted"
+.LASF1788:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1864:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1973:
+	.string	"MPU_RA_TEMP_OUT_H 0x41"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1627:
+	.string	"LED_STRIP "
+.LASF818:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF2048:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF2658:
+	.string	"OWNER_SERVO"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2804:
+	.string	"rc_alias"
+.LASF1606:
+	.string	"iseqsig(x,y) __MATH_TG (__MATH_EVAL_FMT2 (x, y), __iseqsig, ((x), (y)))"
+.LASF2859:
+	.string	"SERIAL_PORT_USART1"
+.LASF2860:
+	.string	"SERIAL_PORT_USART2"
+.LASF2861:
+	.string	"SERIAL_PORT_USART3"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1410:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1402:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF2866:
+	.string	"SERIAL_PORT_USART8"
+.LASF2475:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1076:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1171:
+	.string	"__DECL_SIMD_log1pl "
+.LASF846:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2265:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2113:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2210:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2754:
+	.string	"FEATURE_GPS"
+.LASF1810:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF909:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF794:
+	.string	"_WCHAR_T_DEFINED "
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF2995:
+	.string	"frSkyDataIdTable"
+.LASF2534:
+	.string	"SMARTPORT_MSP_SEQ_MASK 0x0F"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF2917:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF1354:
+	.string	"__DECL_SIMD_tan"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF2838:
+	.string	"attitude"
+.LASF2195:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1567:
+	.string	"M_PI_4f128 __f128 (0.785398163397448309615660845819875721)"
+.LASF1560:
+	.string	"M_Ef128 __f128 (2.718281828459045235360287471352662498)"
+.LASF2136:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1009:
+	.string	"__DECL_SIMD_log "
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF911:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF2397:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1322:
+	.string	"__DECL_SIMD_log2"
+.LASF2514:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF2938:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1321:
+	.string	"__DECL_SIMD_log10f __DECL_SIMD_x86_64"
+.LASF2710:
+	.string	"SERIAL_PARITY_NO"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1054:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF880:
+	.string	"__uid_t_defined "
+.LASF1658:
+	.string	"__PTRDIFF_T "
+.LASF1029:
+	.string	"__DECL_SIMD_pow "
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2504:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF2067:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1968:
+	.string	"MPU_RA_ACCEL_XOUT_L 0x3C"
+.LASF2704:
+	.string	"portMode_t"
+.LASF2294:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF953:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1264:
+	.string	"__DECL_SIMD_logf"
+.LASF1848:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1673:
+	.string	"U_ID_2 2"
+.LASF2178:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2402:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2724:
+	.string	"rxBufferSize"
+.LASF1506:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF990:
+	.string	"__DECL_SIMD_sinf "
+.LASF1940:
+	.string	"MPU_RA_MOT_DUR 0x20"
+.LASF1614:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF2875:
+	.string	"blackbox_baudrateIndex"
+.LASF1524:
+	.string	"M_LN2l 0.693147180559945309417232121458176568L"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1952:
+	.string	"MPU_RA_I2C_SLV2_REG 0x2C"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2152:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF970:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1272:
+	.string	"__DECL_SIMD_powf"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2299:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF875:
+	.string	"__ino64_t_defined "
+.LASF1206:
+	.string	"__DECL_SIMD_erff32x "
+.LASF1115:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1106:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF2560:
+	.string	"FD_PITCH"
+.LASF2688:
+	.string	"OWNER_BARO_EXTI"
+.LASF2388:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF2252:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1991:
+	.string	"MPU_RA_PWR_MGMT_1 0x6B"
+.LASF2603:
+	.string	"CW180_DEG_FLIP"
+.LASF2242:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2545:
+	.string	"__uint16_t"
+.LASF2558:
+	.string	"double"
+.LASF2257:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1349:
+	.string	"__DECL_SIMD_asinhf __DECL_SIMD_x86_64"
+.LASF1124:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2345:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1852:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF2405:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF2680:
+	.string	"OWNER_FLASH_CS"
+.LASF1372:
+	.string	"SNANF64 (__builtin_nansf64 (\"\"))"
+.LASF1455:
+	.string	"_Mret_ _Float32x"
+.LASF2788:
+	.string	"currentControlRateProfile"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF885:
+	.string	"__ssize_t_defined "
+.LASF2071:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1364:
+	.string	"HUGE_VAL_F32X (__builtin_huge_valf32x ())"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF936:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1181:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1647:
+	.string	"USE_SENSOR_NAMES "
+.LASF2290:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF839:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2220:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1904:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1760:
+	.string	"DEGREES_TO_DECIDEGREES(angle) (angle * 10)"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF2901:
+	.string	"vbatmaxcellvoltage"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1073:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF811:
+	.string	"WCONTINUED 8"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF2873:
+	.string	"msp_baudrateIndex"
+.LASF1535:
+	.string	"M_LOG2Ef32 __f32 (1.442695040888963407359924681001892137)"
+.LASF1075:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF2644:
+	.string	"BMI_160_SPI"
+.LASF1683:
+	.string	"USE_UART1 "
+.LASF1452:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f64x"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2148:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1401:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF873:
+	.string	"__u_char_defined "
+.LASF2413:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1066:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2396:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2576:
+	.string	"dterm_filter_type"
+.LASF2598:
+	.string	"CW90_DEG"
+.LASF2513:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF3061:
+	.string	"freeSmartPortTelemetryPort"
+.LASF2368:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1734:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1935:
+	.string	"MPU_RA_GYRO_CONFIG 0x1B"
+.LASF2930:
+	.string	"baro_s"
+.LASF2933:
+	.string	"baro_t"
+.LASF2238:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF400:
+	.string	"bool _Bool"
+.LASF3032:
+	.string	"findSerialPortConfig"
+.LASF2040:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1514:
+	.string	"M_PI_2f 1.57079632679489661923f"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF1912:
+	.string	"MPU_RA_WHO_AM_I 0x75"
+.LASF1602:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1937:
+	.string	"MPU_RA_FF_THR 0x1D"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF999:
+	.string	"__DECL_SIMD_sincos "
+.LASF807:
+	.string	"WNOHANG 1"
+.LASF2440:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1843:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF2284:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2719:
+	.string	"vTable"
+.LASF784:
+	.string	"__need_size_t"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1984:
+	.string	"MPU_RA_I2C_SLV1_DO 0x64"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1183:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1097:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1230:
+	.string	"__DECL_SIMD_erfcf "
+.LASF355:
+	.string	"__amd64 1"
+.LASF1100:
+	.string	"__DECL_SIMD_coshf "
+.LASF2736:
+	.string	"serialTotalRxWaiting"
+.LASF834:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1692:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2916:
+	.string	"accSmooth"
+.LASF1817:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1685:
+	.string	"USE_UART3 "
+.LASF2610:
+	.string	"_Bool"
+.LASF808:
+	.string	"WUNTRACED 2"
+.LASF2633:
+	.string	"MPU_NONE"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1260:
+	.string	"__DECL_SIMD_sincosf"
+.LASF2406:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF2564:
+	.string	"RGB_BLUE"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2876:
+	.string	"telemetry_baudrateIndex"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2225:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2477:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF2467:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1655:
+	.string	"_PTRDIFF_T "
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF791:
+	.string	"_WCHAR_T_ "
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1361:
+	.string	"HUGE_VAL_F32 (__builtin_huge_valf32 ())"
+.LASF1105:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1928:
+	.string	"MPU_RA_XG_OFFS_USRL 0x14"
+.LASF2005:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1093:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF1017:
+	.string	"__DECL_SIMD_logf64x "
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF3062:
+	.string	"initSmartPortTelemetry"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1406:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1816:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF2126:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1590:
+	.string	"M_LN10f64x __f64x (2.302585092994045684017991454684364208)"
+.LASF1824:
+	.string	"PTERM_SCALE 0.032029f"
+.LASF2733:
+	.string	"rxFrameCallback"
+.LASF2018:
+	.string	"IOCFG_OUT_OD 0"
+.LASF810:
+	.string	"WEXITED 4"
+.LASF1859:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF2156:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2518:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF2175:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1644:
+	.string	"USE_MSP_PUSH "
+.LASF2580:
+	.string	"dterm_notch_cutoff"
+.LASF2431:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF546:
+	.string	"__always_inline"
+.LASF1687:
+	.string	"USE_UART5 "
+.LASF1010:
+	.string	"__DECL_SIMD_logf "
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF1645:
+	.string	"USE_RX_MSP "
+.LASF2059:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2927:
+	.string	"get_up"
+.LASF2031:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF2497:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF2925:
+	.string	"get_ut"
+.LASF2316:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF3043:
+	.string	"lastSeq"
+.LASF874:
+	.string	"__ino_t_defined "
+.LASF2171:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1969:
+	.string	"MPU_RA_ACCEL_YOUT_H 0x3D"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2323:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1378:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2484:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF1240:
+	.string	"__DECL_SIMD_tanf "
+.LASF2622:
+	.string	"mpuReadRegisterFnPtr"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1488:
+	.string	"__iscanonical(x) ((void) (__typeof (x)) (x), 1)"
+.LASF1887:
+	.string	"PG_OSD_CONFIG 501"
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF402:
+	.string	"false 0"
+.LASF2867:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1589:
+	.string	"M_LN2f64x __f64x (0.693147180559945309417232121458176568)"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF864:
+	.string	"__ldiv_t_defined 1"
+.LASF986:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF915:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1261:
+	.string	"__DECL_SIMD_sincosf __DECL_SIMD_x86_64"
+.LASF1689:
+	.string	"USE_UART7 "
+.LASF1830:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2308:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF2449:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF2083:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2884:
+	.string	"SENSOR_ACC"
+.LASF2991:
+	.string	"smartPortSerialPort"
+.LASF1460:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f64x"
+.LASF829:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1437:
+	.string	"_Marg_ double"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2714:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1872:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF1380:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2264:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1578:
+	.string	"M_PIf32x __f32x (3.141592653589793238462643383279502884)"
+.LASF3073:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF1209:
+	.string	"__DECL_SIMD_tanh "
+.LASF2278:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF2135:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1587:
+	.string	"M_LOG2Ef64x __f64x (1.442695040888963407359924681001892137)"
+.LASF1690:
+	.string	"USE_UART8 "
+.LASF802:
+	.string	"__need_wchar_t"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1164:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2041:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2341:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF2125:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF801:
+	.string	"_BSD_WCHAR_T_"
+.LASF2845:
+	.string	"FUNCTION_GPS"
+.LASF1338:
+	.string	"__DECL_SIMD_erf"
+.LASF1502:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2369:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF965:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF2256:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1783:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1101:
+	.string	"__DECL_SIMD_coshl "
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2034:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF831:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1344:
+	.string	"__DECL_SIMD_tanhf"
+.LASF364:
+	.string	"__k8 1"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2931:
+	.string	"BaroAlt"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1471:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2943:
+	.string	"gpsNoFixLongitude"
+.LASF1700:
+	.string	"USE_SERIALRX_SUMD"
+.LASF853:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF830:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2104:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1820:
+	.string	"PID_MIXER_SCALING 1000.0f"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2418:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF2194:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2093:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1749:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF1167:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1757:
+	.string	"FAST_MATH "
+.LASF1803:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF2960:
+	.string	"FSSP_DLE"
+.LASF1165:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF2705:
+	.string	"portOptions_t"
+.LASF2061:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF2167:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF29:
+	.string	"_LP64 1"
+.LASF2911:
+	.string	"vbathysteresis"
+.LASF1336:
+	.string	"__DECL_SIMD_acoshf"
+.LASF991:
+	.string	"__DECL_SIMD_sinl "
+.LASF1621:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1373:
+	.string	"SNANF128 (__builtin_nansf128 (\"\"))"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF2619:
+	.string	"mpuDetectionResult"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF1347:
+	.string	"__DECL_SIMD_asinh __DECL_SIMD_x86_64"
+.LASF926:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF1139:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1855:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2079:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF1011:
+	.string	"__DECL_SIMD_logl "
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF985:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF863:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF3050:
+	.string	"error"
+.LASF1358:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1665:
+	.string	"__need_ptrdiff_t"
+.LASF1012:
+	.string	"__DECL_SIMD_logf16 "
+.LASF815:
+	.string	"__WCLONE 0x80000000"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2670:
+	.string	"OWNER_SONAR_ECHO"
+.LASF837:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2100:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2253:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF2209:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1920:
+	.string	"MPU_RA_XA_OFFS_H 0x06"
+.LASF1870:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1241:
+	.string	"__DECL_SIMD_tanl "
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1316:
+	.string	"__DECL_SIMD_atan2f"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2295:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2509:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2121:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2375:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2767:
+	.string	"FEATURE_TRANSPONDER"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1953:
+	.string	"MPU_RA_I2C_SLV2_CTRL 0x2D"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2578:
+	.string	"yaw_lpf_hz"
+.LASF2945:
+	.string	"telemetry_inversion"
+.LASF835:
+	.string	"_BITS_FLOATN_H "
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1906:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF1487:
+	.string	"__iscanonicalf(x) ((void) (__typeof (x)) (x), 1)"
+.LASF1546:
+	.string	"M_SQRT1_2f32 __f32 (0.707106781186547524400844362104849039)"
+.LASF1118:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1666:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1357:
+	.string	"__DECL_SIMD_tanf __DECL_SIMD_x86_64"
+.LASF2448:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF2385:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2346:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2028:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF2356:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1422:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF2510:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1594:
+	.string	"M_1_PIf64x __f64x (0.318309886183790671537767526745028724)"
+.LASF1060:
+	.string	"__DECL_SIMD_asinf "
+.LASF1242:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1002:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF2296:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF2461:
+	.string	"MOTOR_DMA_BUFFER_SIZE 18"
+.LASF2773:
+	.string	"FEATURE_ESC_SENSOR"
+.LASF2757:
+	.string	"FEATURE_TELEMETRY"
+.LASF1239:
+	.string	"__DECL_SIMD_tan "
+.LASF2772:
+	.string	"FEATURE_SOFTSPI"
+.LASF951:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF935:
+	.string	"__NFDBITS"
+.LASF1844:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2853:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF2717:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF2531:
+	.string	"SMARTPORT_MSP_VERSION_S (SMARTPORT_MSP_VERSION << SMARTPORT_MSP_VER_SHIFT)"
+.LASF2412:
+	.string	"AIRMODEDEADBAND 12"
+.LASF881:
+	.string	"__off_t_defined "
+.LASF1917:
+	.string	"MPU_RA_X_FINE_GAIN 0x03"
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF2668:
+	.string	"OWNER_TIMER"
+.LASF1375:
+	.string	"SNANF64X (__builtin_nansf64x (\"\"))"
+.LASF2022:
+	.string	"IOCFG_IPU 0"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2936:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1773:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2163:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2600:
+	.string	"CW270_DEG"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1315:
+	.string	"__DECL_SIMD_atan2 __DECL_SIMD_x86_64"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF974:
+	.string	"alloca"
+.LASF1732:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1234:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2081:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1356:
+	.string	"__DECL_SIMD_tanf"
+.LASF1342:
+	.string	"__DECL_SIMD_tanh"
+.LASF1351:
+	.string	"__DECL_SIMD_erfc __DECL_SIMD_x86_64"
+.LASF1916:
+	.string	"MPU_RA_ZG_OFFS_TC 0x02"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF900:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF2012:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2001:
+	.string	"MPU_RF_DATA_RDY_EN (1 << 0)"
+.LASF1037:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1007:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1478:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF2367:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1299:
+	.string	"__DECL_SIMD_cosh __DECL_SIMD_x86_64"
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF977:
+	.string	"_MATH_H 1"
+.LASF836:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2498:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1663:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2769:
+	.string	"FEATURE_SDCARD_UNUSED"
+.LASF1219:
+	.string	"__DECL_SIMD_asinh "
+.LASF2201:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF2746:
+	.string	"setRxFrameCallback"
+.LASF2635:
+	.string	"MPU_60x0"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1936:
+	.string	"MPU_RA_ACCEL_CONFIG 0x1C"
+.LASF2481:
+	.string	"CALIBRATING_GYRO_CYCLES 1000"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1414:
+	.string	"_Mdouble_ _Float32"
+.LASF2538:
+	.string	"short unsigned int"
+.LASF1419:
+	.string	"_Mdouble_ _Float128"
+.LASF1365:
+	.string	"HUGE_VAL_F64X (__builtin_huge_valf64x ())"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF2111:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1078:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2180:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1677:
+	.string	"ACC "
+.LASF1186:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2823:
+	.string	"MAG_MODE"
+.LASF1348:
+	.string	"__DECL_SIMD_asinhf"
+.LASF1702:
+	.string	"USE_SERIALRX_XBUS"
+.LASF2803:
+	.string	"mspPostProcessFnPtr"
+.LASF1156:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2280:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2722:
+	.string	"options"
+.LASF2447:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2749:
+	.string	"FEATURE_INFLIGHT_ACC_CAL"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF2543:
+	.string	"__int16_t"
+.LASF2698:
+	.string	"OWNER_COMPASS_CS"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF2620:
+	.string	"mpuConfiguration"
+.LASF2439:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1967:
+	.string	"MPU_RA_ACCEL_XOUT_H 0x3B"
+.LASF1432:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2492:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2392:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2311:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF3027:
+	.string	"telemetryDetermineEnabledState"
+.LASF2315:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF2883:
+	.string	"SENSOR_GYRO"
+.LASF1885:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF2990:
+	.string	"FSSP_DATAID_A4"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2777:
+	.string	"rcYawRate8"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1516:
+	.string	"M_1_PIf 0.31830988618379067154f"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1169:
+	.string	"__DECL_SIMD_log1p "
+.LASF826:
+	.string	"__W_CONTINUED 0xffff"
+.LASF2507:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2854:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF921:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF3022:
+	.string	"mspFcProcessCommand"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2438:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF888:
+	.string	"__clock_t_defined 1"
+.LASF1027:
+	.string	"__DECL_SIMD_expf64x "
+.LASF2223:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF2591:
+	.string	"setpointRelaxRatio"
+.LASF2758:
+	.string	"FEATURE_3D"
+.LASF1474:
+	.string	"FP_INFINITE 1"
+.LASF1368:
+	.string	"SNANF (__builtin_nansf (\"\"))"
+.LASF1793:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2741:
+	.string	"setMode"
+.LASF1381:
+	.string	"__FP_LONG_MAX 0x7fffffffffffffffL"
+.LASF1638:
+	.string	"TELEMETRY_IBUS "
+.LASF1605:
+	.string	"__MATH_EVAL_FMT2(x,y) ((x) + (y) + 0.0f)"
+.LASF2723:
+	.string	"baudRate"
+.LASF2848:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF1328:
+	.string	"__DECL_SIMD_log1pf"
+.LASF1228:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF943:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1417:
+	.string	"_Mdouble_ _Float64"
+.LASF1681:
+	.string	"MAG "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF1013:
+	.string	"__DECL_SIMD_logf32 "
+.LASF2594:
+	.string	"rateAccelLimit"
+.LASF2552:
+	.string	"uint8_t"
+.LASF1541:
+	.string	"M_PI_4f32 __f32 (0.785398163397448309615660845819875721)"
+.LASF1629:
+	.string	"TELEMETRY_FRSKY "
+.LASF844:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1445:
+	.string	"__MATHCALL_NAME(name) d ## name ## l"
+.LASF967:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF2146:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF2069:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF2653:
+	.string	"accDev_t"
+.LASF1738:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2954:
+	.string	"telemetryConfig_t"
+.LASF1263:
+	.string	"__DECL_SIMD_log __DECL_SIMD_x86_64"
+.LASF973:
+	.string	"_ALLOCA_H 1"
+.LASF2595:
+	.string	"IO_t"
+.LASF1532:
+	.string	"M_SQRT2l 1.414213562373095048801688724209698079L"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2878:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1635:
+	.string	"GPS "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2950:
+	.string	"frsky_vfas_cell_voltage"
+.LASF854:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2817:
+	.string	"PREVENT_ARMING"
+.LASF1494:
+	.string	"MAXFLOAT 3.40282347e+38F"
+.LASF1613:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1317:
+	.string	"__DECL_SIMD_atan2f __DECL_SIMD_x86_64"
+.LASF2004:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1838:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF2116:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF2661:
+	.string	"OWNER_ADC_BATT"
+.LASF2596:
+	.string	"ALIGN_DEFAULT"
+.LASF2128:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1185:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1243:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1003:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF2799:
+	.string	"streamLength"
+.LASF2870:
+	.string	"serialPortIdentifier_e"
+.LASF1902:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF814:
+	.string	"__WALL 0x40000000"
+.LASF2557:
+	.string	"float"
+.LASF2291:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1836:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF2266:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2602:
+	.string	"CW90_DEG_FLIP"
+.LASF1227:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF2142:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2483:
+	.string	"CALIBRATING_BARO_CYCLES 200"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF2537:
+	.string	"unsigned char"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF1458:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f128"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF2575:
+	.string	"PID_ITEM_COUNT"
+.LASF1941:
+	.string	"MPU_RA_ZRMOT_THR 0x21"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF2419:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1109:
+	.string	"__DECL_SIMD_expm1 "
+.LASF910:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1808:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF2205:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF2068:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF2222:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2899:
+	.string	"voltageMeterSource_e"
+.LASF1428:
+	.string	"__MATHDECL"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1236:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF887:
+	.string	"__key_t_defined "
+.LASF1997:
+	.string	"MPU_RA_DMP_CFG_2 0x71"
+.LASF1188:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2179:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2729:
+	.string	"rxBufferTail"
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF1520:
+	.string	"M_SQRT1_2f 0.70710678118654752440f"
+.LASF2123:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2096:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1978:
+	.string	"MPU_RA_GYRO_YOUT_L 0x46"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF2159:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2091:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1304:
+	.string	"__DECL_SIMD_expm1f"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1084:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1390:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF3064:
+	.string	"payload"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF763:
+	.string	"__need_size_t "
+.LASF2909:
+	.string	"useConsumptionAlerts"
+.LASF2774:
+	.string	"FEATURE_RX_SPI_CROS"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF2377:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2432:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF379:
+	.string	"linux 1"
+.LASF2762:
+	.string	"FEATURE_LED_STRIP"
+.LASF2759:
+	.string	"FEATURE_RX_PARALLEL_PWM"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2910:
+	.string	"consumptionWarningPercentage"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF2643:
+	.string	"ICM_20689_SPI"
+.LASF1204:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1815:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1583:
+	.string	"M_2_SQRTPIf32x __f32x (1.128379167095512573896158903121545172)"
+.LASF1341:
+	.string	"__DECL_SIMD_erff __DECL_SIMD_x86_64"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF2138:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2839:
+	.string	"PORTSHARING_UNUSED"
+.LASF3066:
+	.string	"smartPortSendByte"
+.LASF799:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2856:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1618:
+	.string	"SERIAL_RX "
+.LASF2682:
+	.string	"OWNER_BARO_CS"
+.LASF1442:
+	.string	"_Marg_ long double"
+.LASF1849:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF2221:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2393:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1989:
+	.string	"MPU_RA_MOT_DETECT_CTRL 0x69"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1556:
+	.string	"M_2_PIf64 __f64 (0.636619772367581343075535053490057448)"
+.LASF2750:
+	.string	"FEATURE_RX_SERIAL"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1539:
+	.string	"M_PIf32 __f32 (3.141592653589793238462643383279502884)"
+.LASF2503:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2465:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1117:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2697:
+	.string	"OWNER_VTX"
+.LASF1725:
+	.string	"USE_PROFILE "
+.LASF2019:
+	.string	"IOCFG_AF_PP 0"
+.LASF2458:
+	.string	"ONESHOT42_TIMER_MHZ 24"
+.LASF1134:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2944:
+	.string	"telemetry_switch"
+.LASF1032:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1922:
+	.string	"MPU_RA_YA_OFFS_H 0x08"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF1795:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF931:
+	.string	"____sigset_t_defined "
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF2420:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1769:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2064:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF3048:
+	.string	"smartPortSendErrorReply"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF2810:
+	.string	"AUX3"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1974:
+	.string	"MPU_RA_TEMP_OUT_L 0x42"
+.LASF2980:
+	.string	"FSSP_DATAID_CELLS"
+.LASF2631:
+	.string	"gyroReadXRegister"
+.LASF1257:
+	.string	"__DECL_SIMD_sinf __DECL_SIMD_x86_64"
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2331:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1900:
+	.string	"PG_VCD_CONFIG 514"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2615:
+	.string	"acc_1G"
+.LASF1959:
+	.string	"MPU_RA_I2C_SLV4_DO 0x33"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2981:
+	.string	"FSSP_DATAID_CELLS_LAST"
+.LASF1774:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1704:
+	.string	"LED_STRIP"
+.LASF1491:
+	.string	"issignaling(x) __MATH_TG ((x), __issignaling, (x))"
+.LASF1057:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF3039:
+	.string	"handleSmartPortTelemetry"
+.LASF3060:
+	.string	"portOptions"
+.LASF2725:
+	.string	"txBufferSize"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1235:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1707:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF3013:
+	.string	"SMARTPORT_MSP_CRC_ERROR"
+.LASF904:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1276:
+	.string	"__DECL_SIMD_acosf"
+.LASF1386:
+	.string	"FP_INT_TOWARDZERO 2"
+.LASF2366:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2358:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2332:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2014:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF2502:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF1407:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2770:
+	.string	"FEATURE_VTX"
+.LASF2279:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1652:
+	.string	"_STDDEF_H "
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1847:
+	.string	"PG_SERVO_MIXER 21"
+.LASF2939:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF1277:
+	.string	"__DECL_SIMD_acosf __DECL_SIMD_x86_64"
+.LASF1598:
+	.string	"M_SQRT1_2f64x __f64x (0.707106781186547524400844362104849039)"
+.LASF2480:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF2694:
+	.string	"OWNER_INVERTER"
+.LASF3024:
+	.string	"sbufWriteU8"
+.LASF2685:
+	.string	"OWNER_RX_SPI_CS"
+.LASF2613:
+	.string	"init"
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2189:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF851:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1792:
+	.string	"UNIT_TESTED "
+.LASF980:
+	.string	"__DECL_SIMD_cosf "
+.LASF1114:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF2795:
+	.string	"mspStreamFnPtr"
+.LASF901:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF955:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF866:
+	.string	"RAND_MAX 2147483647"
+.LASF1421:
+	.string	"_Mdouble_ _Float32x"
+.LASF1297:
+	.string	"__DECL_SIMD_exp10f __DECL_SIMD_x86_64"
+.LASF2054:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF3018:
+	.string	"getAmperage"
+.LASF2063:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2271:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1399:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1682:
+	.string	"USE_FAKE_MAG "
+.LASF3021:
+	.string	"serialRxBytesWaiting"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF1212:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1477:
+	.string	"FP_NORMAL 4"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1557:
+	.string	"M_2_SQRTPIf64 __f64 (1.128379167095512573896158903121545172)"
+.LASF2038:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1337:
+	.string	"__DECL_SIMD_acoshf __DECL_SIMD_x86_64"
+.LASF1412:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1839:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF2547:
+	.string	"__uint32_t"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF2693:
+	.string	"OWNER_RX_BIND"
+.LASF2306:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1405:
+	.string	"__MATH_PRECNAME"
+.LASF2609:
+	.string	"busDevice_t"
+.LASF1603:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1331:
+	.string	"__DECL_SIMD_atanh __DECL_SIMD_x86_64"
+.LASF2582:
+	.string	"pidSumLimit"
+.LASF2673:
+	.string	"OWNER_SPI_MISO"
+.LASF2098:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1454:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f128"
+.LASF2251:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2528:
+	.string	"SMARTPORT_MSP_VERSION 1"
+.LASF2088:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1979:
+	.string	"MPU_RA_GYRO_ZOUT_H 0x47"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1099:
+	.string	"__DECL_SIMD_cosh "
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1867:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF2043:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1415:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1485:
+	.string	"MATH_ERREXCEPT 2"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF1144:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1595:
+	.string	"M_2_PIf64x __f64x (0.636619772367581343075535053490057448)"
+.LASF998:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF795:
+	.string	"_WCHAR_T_H "
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF2094:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2789:
+	.string	"sbuf_s"
+.LASF1136:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2350:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF1305:
+	.string	"__DECL_SIMD_expm1f __DECL_SIMD_x86_64"
+.LASF1533:
+	.string	"M_SQRT1_2l 0.707106781186547524400844362104849039L"
+.LASF1857:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1300:
+	.string	"__DECL_SIMD_coshf"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2959:
+	.string	"FSSP_START_STOP"
+.LASF2655:
+	.string	"OWNER_PWMINPUT"
+.LASF2157:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1052:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1289:
+	.string	"__DECL_SIMD_hypotf __DECL_SIMD_x86_64"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF2712:
+	.string	"SERIAL_UNIDIR"
+.LASF1176:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF843:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1585:
+	.string	"M_SQRT1_2f32x __f32x (0.707106781186547524400844362104849039)"
+.LASF2478:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1039:
+	.string	"__DECL_SIMD_acos "
+.LASF2834:
+	.string	"roll"
+.LASF1194:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2247:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1511:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1954:
+	.string	"MPU_RA_I2C_SLV3_ADDR 0x2E"
+.LASF1067:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2807:
+	.string	"THROTTLE"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1736:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF2027:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF2428:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1591:
+	.string	"M_PIf64x __f64x (3.141592653589793238462643383279502884)"
+.LASF2621:
+	.string	"sensorAccReadFuncPtr"
+.LASF1624:
+	.string	"USE_SERIALRX_SUMH "
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1710:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF948:
+	.string	"__fsblkcnt_t_defined "
+.LASF1565:
+	.string	"M_PIf128 __f128 (3.141592653589793238462643383279502884)"
+.LASF1903:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1575:
+	.string	"M_LOG10Ef32x __f32x (0.434294481903251827651128918916605082)"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1033:
+	.string	"__DECL_SIMD_powf32 "
+.LASF2858:
+	.string	"SERIAL_PORT_NONE"
+.LASF2568:
+	.string	"PIDALT"
+.LASF1909:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF2182:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF766:
+	.string	"__size_t__ "
+.LASF1367:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1640:
+	.string	"TELEMETRY_MAVLINK "
+.LASF2726:
+	.string	"rxBuffer"
+.LASF907:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF2794:
+	.string	"mspResult_e"
+.LASF2207:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2482:
+	.string	"CALIBRATING_ACC_CYCLES 400"
+.LASF2287:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1440:
+	.string	"_Marg_"
+.LASF1146:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1080:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1955:
+	.string	"MPU_RA_I2C_SLV3_REG 0x2F"
+.LASF1334:
+	.string	"__DECL_SIMD_acosh"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1400:
+	.string	"_Mdouble_ double"
+.LASF2756:
+	.string	"FEATURE_SONAR"
+.LASF2956:
+	.string	"SPSTATE_UNINITIALIZED"
+.LASF2780:
+	.string	"thrExpo8"
+.LASF1222:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1980:
+	.string	"MPU_RA_GYRO_ZOUT_L 0x48"
+.LASF981:
+	.string	"__DECL_SIMD_cosl "
+.LASF2831:
+	.string	"FAILSAFE_MODE"
+.LASF2409:
+	.string	"CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1525:
+	.string	"M_LN10l 2.302585092994045684017991454684364208L"
+.LASF2030:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF2836:
+	.string	"values"
+.LASF1705:
+	.string	"TELEMETRY_FRSKY"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1860:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1715:
+	.string	"VTX_COMMON"
+.LASF2365:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF2080:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1248:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1397:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1126:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1646:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1282:
+	.string	"__DECL_SIMD_asin"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1008:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF2429:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF1975:
+	.string	"MPU_RA_GYRO_XOUT_H 0x43"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1482:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF3055:
+	.string	"processMspPacket"
+.LASF2896:
+	.string	"VOLTAGE_METER_NONE"
+.LASF1741:
+	.string	"EEPROM_SIZE 32768"
+.LASF1751:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF1135:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF2532:
+	.string	"SMARTPORT_MSP_ERROR_FLAG (1 << 5)"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1970:
+	.string	"MPU_RA_ACCEL_YOUT_L 0x3E"
+.LASF1461:
+	.string	"__MATHCALL_NAME(name) f64 ## name ## f128"
+.LASF2820:
+	.string	"armingFlags"
+.LASF2122:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF2343:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1599:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1296:
+	.string	"__DECL_SIMD_exp10f"
+.LASF2604:
+	.string	"CW270_DEG_FLIP"
+.LASF2855:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF2329:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2233:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF2986:
+	.string	"FSSP_DATAID_T1"
+.LASF2987:
+	.string	"FSSP_DATAID_T2"
+.LASF1750:
+	.string	"HSV_HUE_MAX 359"
+.LASF2445:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF855:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF2895:
+	.string	"currentMeterSource_e"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2581:
+	.string	"itermWindupPointPercent"
+.LASF1213:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF2850:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1826:
+	.string	"DTERM_SCALE 0.000529f"
+.LASF1497:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF522:
+	.string	"__flexarr []"
+.LASF2051:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF2768:
+	.string	"FEATURE_AIRMODE"
+.LASF3038:
+	.string	"vfasVoltage"
+.LASF934:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1744:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF2029:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2699:
+	.string	"OWNER_CROS_EC"
+.LASF972:
+	.string	"__have_pthread_attr_t 1"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2962:
+	.string	"FSSP_DATA_FRAME"
+.LASF1110:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1427:
+	.string	"__MATHDECL_ALIAS"
+.LASF1649:
+	.string	"VTX_CONTROL "
+.LASF2164:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2691:
+	.string	"OWNER_BEEPER"
+.LASF1273:
+	.string	"__DECL_SIMD_powf __DECL_SIMD_x86_64"
+.LASF1449:
+	.string	"_Marg_ _Float64"
+.LASF1501:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2330:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1611:
+	.string	"I2C2_OVERCLOCK true"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2008:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1883:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1992:
+	.string	"MPU_RA_PWR_MGMT_2 0x6C"
+.LASF2394:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2165:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1531:
+	.string	"M_2_SQRTPIl 1.128379167095512573896158903121545172L"
+.LASF3069:
+	.string	"skipUntilStart"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1251:
+	.string	"__DECL_SIMD_cos __DECL_SIMD_x86_64"
+.LASF1931:
+	.string	"MPU_RA_ZG_OFFS_USRH 0x17"
+.LASF2737:
+	.string	"serialTotalTxFree"
+.LASF2835:
+	.string	"pitch"
+.LASF925:
+	.string	"_SYS_SELECT_H 1"
+.LASF1111:
+	.string	"__DECL_SIMD_expm1l "
+.LASF792:
+	.string	"_BSD_WCHAR_T_ "
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2941:
+	.string	"telemetryConfig_s"
+.LASF2322:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2608:
+	.string	"csnPin"
+.LASF1145:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1742:
+	.string	"__disable_irq() "
+.LASF1409:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF2076:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF2748:
+	.string	"FEATURE_RX_PPM"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF2559:
+	.string	"FD_ROLL"
+.LASF2745:
+	.string	"readBuf"
+.LASF2187:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF1675:
+	.string	"GYRO "
+.LASF2489:
+	.string	"BARO_I2C_INSTANCE I2C_DEVICE"
+.LASF2320:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF2891:
+	.string	"CURRENT_METER_ADC"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1053:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2357:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1508:
+	.string	"M_Ef 2.7182818284590452354f"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2120:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1999:
+	.string	"MPU_RA_FIFO_COUNTL 0x73"
+.LASF1028:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1498:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1634:
+	.string	"USE_SERVOS "
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF2270:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2118:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1688:
+	.string	"USE_UART6 "
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1081:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1138:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1125:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF2141:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2229:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1205:
+	.string	"__DECL_SIMD_erff128 "
+.LASF2463:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF2203:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2529:
+	.string	"SMARTPORT_MSP_VER_SHIFT 5"
+.LASF2588:
+	.string	"levelSensitivity"
+.LASF793:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2258:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"FP_NAN 0"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1470:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1550:
+	.string	"M_LN2f64 __f64 (0.693147180559945309417232121458176568)"
+.LASF2017:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1031:
+	.string	"__DECL_SIMD_powl "
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF2262:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1994:
+	.string	"MPU_RA_MEM_START_ADDR 0x6E"
+.LASF2501:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2567:
+	.string	"PIDYAW"
+.LASF2160:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1065:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1961:
+	.string	"MPU_RA_I2C_SLV4_DI 0x35"
+.LASF1123:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1945:
+	.string	"MPU_RA_I2C_SLV0_ADDR 0x25"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1518:
+	.string	"M_2_SQRTPIf 1.12837916709551257390f"
+.LASF1890:
+	.string	"PG_PID_CONFIG 504"
+.LASF1275:
+	.string	"__DECL_SIMD_acos __DECL_SIMD_x86_64"
+.LASF1654:
+	.string	"_ANSI_STDDEF_H "
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF2338:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2090:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF1489:
+	.string	"__iscanonicalf128(x) ((void) (__typeof (x)) (x), 1)"
+.LASF2219:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF2109:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1521:
+	.string	"M_El 2.718281828459045235360287471352662498L"
+.LASF2914:
+	.string	"acc_s"
+.LASF2918:
+	.string	"acc_t"
+.LASF2544:
+	.string	"short int"
+.LASF1429:
+	.string	"__MATHCALL"
+.LASF903:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2791:
+	.string	"MSP_RESULT_ACK"
+.LASF1174:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1737:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF932:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1150:
+	.string	"__DECL_SIMD_log10f "
+.LASF1530:
+	.string	"M_2_PIl 0.636619772367581343075535053490057448L"
+.LASF2199:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1448:
+	.string	"__MATHCALL_NAME(name) f32 ## name ## f32x"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1443:
+	.string	"__MATHCALL_NAME(name) f ## name ## l"
+.LASF3026:
+	.string	"sbufBytesRemaining"
+.LASF1094:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1721:
+	.string	"USE_SERVOS"
+.LASF2830:
+	.string	"SONAR_MODE"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF2045:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1770:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF1558:
+	.string	"M_SQRT2f64 __f64 (1.414213562373095048801688724209698079)"
+.LASF1697:
+	.string	"USE_SERIALRX_IBUS"
+.LASF2049:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2275:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1971:
+	.string	"MPU_RA_ACCEL_ZOUT_H 0x3F"
+.LASF2527:
+	.string	"SMARTPORT_PAYLOAD_SIZE (SMARTPORT_FRAME_SIZE - SMARTPORT_PAYLOAD_OFFSET - 1)"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF825:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1814:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2342:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1500:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2288:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1717:
+	.string	"VTX_SMARTAUDIO"
+.LASF1325:
+	.string	"__DECL_SIMD_log2f __DECL_SIMD_x86_64"
+.LASF1140:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1456:
+	.string	"__MATHCALL_NAME(name) f32x ## name ## f64"
+.LASF1286:
+	.string	"__DECL_SIMD_hypot"
+.LASF1198:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1846:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2046:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1287:
+	.string	"__DECL_SIMD_hypot __DECL_SIMD_x86_64"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1249:
+	.string	"__DECL_SIMD_x86_64 __attribute__ ((__simd__ (\"notinbranch\")))"
+.LASF2442:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1604:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1265:
+	.string	"__DECL_SIMD_logf __DECL_SIMD_x86_64"
+.LASF1592:
+	.string	"M_PI_2f64x __f64x (1.570796326794896619231321691639751442)"
+.LASF862:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1020:
+	.string	"__DECL_SIMD_expf "
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2720:
+	.string	"identifier"
+.LASF1269:
+	.string	"__DECL_SIMD_expf __DECL_SIMD_x86_64"
+.LASF2971:
+	.string	"FSSP_DATAID_CURRENT"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1766:
+	.string	"MAX(a,b) ((a) > (b) ? (a) : (b))"
+.LASF2102:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1259:
+	.string	"__DECL_SIMD_sincos __DECL_SIMD_x86_64"
+.LASF1577:
+	.string	"M_LN10f32x __f32x (2.302585092994045684017991454684364208)"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2246:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF2996:
+	.string	"smartPortState"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF828:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF3051:
+	.string	"smartPortSendMspReply"
+.LASF2339:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1833:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF2919:
+	.string	"baroOpFuncPtr"
+.LASF1597:
+	.string	"M_SQRT2f64x __f64x (1.414213562373095048801688724209698079)"
+.LASF393:
+	.string	"SITL 1"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF859:
+	.string	"__f64x(x) x ##f64x"
+.LASF917:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF3033:
+	.string	"smartPortLastServiceTime"
+.LASF1747:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF1740:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF930:
+	.string	"__sigset_t_defined 1"
+.LASF832:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF790:
+	.string	"__WCHAR_T "
+.LASF872:
+	.string	"_SYS_TYPES_H 1"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF1196:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF3067:
+	.string	"crcp"
+.LASF919:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF2417:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1615:
+	.string	"USE_CLI "
+.LASF867:
+	.string	"EXIT_FAILURE 1"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1772:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF2764:
+	.string	"FEATURE_OSD"
+.LASF1576:
+	.string	"M_LN2f32x __f32x (0.693147180559945309417232121458176568)"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF877:
+	.string	"__gid_t_defined "
+.LASF2548:
+	.string	"long int"
+.LASF849:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2457:
+	.string	"ONESHOT125_TIMER_MHZ 8"
+.LASF2844:
+	.string	"FUNCTION_MSP"
+.LASF2078:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF2634:
+	.string	"MPU_3050"
+.LASF2549:
+	.string	"char"
+.LASF2601:
+	.string	"CW0_DEG_FLIP"
+.LASF2666:
+	.string	"OWNER_SERIAL_RX"
+.LASF1926:
+	.string	"MPU_RA_PRODUCT_ID 0x0C"
+.LASF1802:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF2546:
+	.string	"__int32_t"
+.LASF971:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF2390:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2787:
+	.string	"currentPidProfile"
+.LASF2092:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1059:
+	.string	"__DECL_SIMD_asin "
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF2456:
+	.string	"PWM_TIMER_MHZ 1"
+.LASF2415:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1187:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF2650:
+	.string	"sensor"
+.LASF2766:
+	.string	"FEATURE_CHANNEL_FORWARDING"
+.LASF2908:
+	.string	"useVBatAlerts"
+.LASF2381:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2879:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2686:
+	.string	"OWNER_SPI_CS"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF922:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF842:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1394:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF2579:
+	.string	"dterm_notch_hz"
+.LASF1601:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1392:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1098:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1483:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1777:
+	.string	"EXPAND_I(x) x"
+.LASF1284:
+	.string	"__DECL_SIMD_asinf"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1346:
+	.string	"__DECL_SIMD_asinh"
+.LASF1190:
+	.string	"__DECL_SIMD_acoshf "
+.LASF2872:
+	.string	"functionMask"
+.LASF1574:
+	.string	"M_LOG2Ef32x __f32x (1.442695040888963407359924681001892137)"
+.LASF786:
+	.string	"__WCHAR_T__ "
+.LASF1232:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1868:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF3072:
+	.string	"batteryConfig"
+.LASF2892:
+	.string	"CURRENT_METER_VIRTUAL"
+.LASF2373:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF3059:
+	.string	"configureSmartPortTelemetryPort"
+.LASF2885:
+	.string	"SENSOR_BARO"
+.LASF893:
+	.string	"__suseconds_t_defined "
+.LASF2218:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1426:
+	.string	"__MATHDECL_1"
+.LASF1291:
+	.string	"__DECL_SIMD_exp2 __DECL_SIMD_x86_64"
+.LASF2715:
+	.string	"SERIAL_BIDIR_PP"
+.LASF2708:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2709:
+	.string	"SERIAL_STOPBITS_2"
+.LASF822:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF2665:
+	.string	"OWNER_SERIAL_TX"
+.LASF1924:
+	.string	"MPU_RA_ZA_OFFS_H 0x0A"
+.LASF1809:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1891:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF996:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1797:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF2779:
+	.string	"thrMid8"
+.LASF2800:
+	.string	"streamFn"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF2134:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2453:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF2828:
+	.string	"UNUSED_MODE"
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1245:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2515:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF1570:
+	.string	"M_2_SQRTPIf128 __f128 (1.128379167095512573896158903121545172)"
+.LASF1768:
+	.string	"Q12 (1 << 12)"
+.LASF1880:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1490:
+	.string	"iscanonical(x) __MATH_TG ((x), __iscanonical, (x))"
+.LASF1309:
+	.string	"__DECL_SIMD_sinhf __DECL_SIMD_x86_64"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF1271:
+	.string	"__DECL_SIMD_pow __DECL_SIMD_x86_64"
+.LASF1958:
+	.string	"MPU_RA_I2C_SLV4_REG 0x32"
+.LASF1163:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF401:
+	.string	"true 1"
+.LASF2706:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2593:
+	.string	"yawRateAccelLimit"
+.LASF2430:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2174:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2155:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1509:
+	.string	"M_LOG2Ef 1.4426950408889634074f"
+.LASF2946:
+	.string	"sportHalfDuplex"
+.LASF1905:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1141:
+	.string	"__DECL_SIMD_atan2l "
+.LASF2065:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1956:
+	.string	"MPU_RA_I2C_SLV3_CTRL 0x30"
+.LASF2404:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF845:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1481:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1476:
+	.string	"FP_SUBNORMAL 3"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2176:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF883:
+	.string	"__pid_t_defined "
+.LASF918:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF2245:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF861:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1088:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF978:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF3001:
+	.string	"sensorId"
+.LASF1555:
+	.string	"M_1_PIf64 __f64 (0.318309886183790671537767526745028724)"
+.LASF1021:
+	.string	"__DECL_SIMD_expl "
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2880:
+	.string	"SENSOR_INDEX_BARO"
+.LASF2313:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2550:
+	.string	"int16_t"
+.LASF2389:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2303:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2731:
+	.string	"txBufferTail"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF2407:
+	.string	"BEEP_ON do {} while(0)"
+.LASF1048:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1925:
+	.string	"MPU_RA_ZA_OFFS_L_TC 0x0B"
+.LASF1743:
+	.string	"__enable_irq() "
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF2973:
+	.string	"FSSP_DATAID_ALTITUDE"
+.LASF994:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF429:
+	.string	"__USE_GNU"
+.LASF2066:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF1923:
+	.string	"MPU_RA_YA_OFFS_L_TC 0x09"
+.LASF1771:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF942:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF821:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF2734:
+	.string	"serialPortVTable"
+.LASF1944:
+	.string	"MPU_RA_I2C_MST_CTRL 0x24"
+.LASF1444:
+	.string	"_Mret_ double"
+.LASF2649:
+	.string	"mpuDetectionResult_s"
+.LASF1302:
+	.string	"__DECL_SIMD_expm1"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2672:
+	.string	"OWNER_SPI_SCK"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2151:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2868:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2869:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1813:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2505:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF2974:
+	.string	"FSSP_DATAID_FUEL"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF2652:
+	.string	"mpuDetectionResult_t"
+.LASF984:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1403:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1416:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2241:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1523:
+	.string	"M_LOG10El 0.434294481903251827651128918916605082L"
+.LASF2493:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1051:
+	.string	"__DECL_SIMD_atanl "
+.LASF1593:
+	.string	"M_PI_4f64x __f64x (0.785398163397448309615660845819875721)"
+.LASF1586:
+	.string	"M_Ef64x __f64x (2.718281828459045235360287471352662498)"
+.LASF2499:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1420:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF2833:
+	.string	"vario"
+.LASF2422:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF956:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1651:
+	.string	"VTX_TRAMP "
+.LASF940:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF2819:
+	.string	"WAS_EVER_ARMED"
+.LASF1695:
+	.string	"SERIAL_RX"
+.LASF765:
+	.string	"__need_NULL "
+.LASF1362:
+	.string	"HUGE_VAL_F64 (__builtin_huge_valf64 ())"
+.LASF902:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF857:
+	.string	"__f64(x) x ##f64"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1633:
+	.string	"USE_RESOURCE_MGMT "
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1672:
+	.string	"U_ID_1 1"
+.LASF995:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF2172:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1191:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1756:
+	.string	"power5(x) ((x)*(x)*(x)*(x)*(x))"
+.LASF1892:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1295:
+	.string	"__DECL_SIMD_exp10 __DECL_SIMD_x86_64"
+.LASF1800:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF1622:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1151:
+	.string	"__DECL_SIMD_log10l "
+.LASF1841:
+	.string	"PG_PID_PROFILE 14"
+.LASF1821:
+	.string	"PID_SERVO_MIXER_SCALING 0.7f"
+.LASF1581:
+	.string	"M_1_PIf32x __f32x (0.318309886183790671537767526745028724)"
+.LASF3053:
+	.string	"txBuf"
+.LASF1643:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2707:
+	.string	"SERIAL_INVERTED"
+.LASF1018:
+	.string	"__DECL_SIMD_logf128x "
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2263:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1911:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2214:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF2446:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF962:
+	.string	"__LOCK_ALIGNMENT "
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2536:
+	.string	"SMARTPORT_MSP_RES_ERROR (-10)"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2888:
+	.string	"SENSOR_GPS"
+.LASF2577:
+	.string	"dterm_lpf_hz"
+.LASF1964:
+	.string	"MPU_RA_INT_ENABLE 0x38"
+.LASF1475:
+	.string	"FP_ZERO 2"
+.LASF2982:
+	.string	"FSSP_DATAID_HEADING"
+.LASF1840:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1226:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1233:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1799:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2983:
+	.string	"FSSP_DATAID_ACCX"
+.LASF1631:
+	.string	"TELEMETRY_LTM "
+.LASF2926:
+	.string	"start_up"
+.LASF2426:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF3071:
+	.string	"telemetryConfig"
+.LASF2924:
+	.string	"start_ut"
+.LASF3003:
+	.string	"valueId"
+.LASF2906:
+	.string	"currentMeterSource"
+.LASF3004:
+	.string	"data"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF3052:
+	.string	"packet"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF2842:
+	.string	"portSharing_e"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1312:
+	.string	"__DECL_SIMD_cbrtf"
+.LASF1082:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF889:
+	.string	"__clockid_t_defined 1"
+.LASF2117:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF3014:
+	.string	"SMARTPORT_MSP_ERROR"
+.LASF2237:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2469:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1572:
+	.string	"M_SQRT1_2f128 __f128 (0.707106781186547524400844362104849039)"
+.LASF1653:
+	.string	"_STDDEF_H_ "
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2805:
+	.string	"ROLL"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2640:
+	.string	"ICM_20601_SPI"
+.LASF1202:
+	.string	"__DECL_SIMD_erff16 "
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1270:
+	.string	"__DECL_SIMD_pow"
+.LASF2840:
+	.string	"PORTSHARING_NOT_SHARED"
+.LASF2889:
+	.string	"SENSOR_GPSMAG"
+.LASF1384:
+	.string	"FP_INT_UPWARD 0"
+.LASF2289:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2740:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF2052:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2541:
+	.string	"signed char"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF891:
+	.string	"__timer_t_defined 1"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF2526:
+	.string	"SMARTPORT_PAYLOAD_OFFSET offsetof(smartPortFrame_t, valueId)"
+.LASF2951:
+	.string	"hottAlarmSoundInterval"
+.LASF1562:
+	.string	"M_LOG10Ef128 __f128 (0.434294481903251827651128918916605082)"
+.LASF1431:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1812:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1369:
+	.string	"SNAN (__builtin_nans (\"\"))"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1947:
+	.string	"MPU_RA_I2C_SLV0_CTRL 0x27"
+.LASF1825:
+	.string	"ITERM_SCALE 0.244381f"
+.LASF1246:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF2701:
+	.string	"MODE_RX"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF2997:
+	.string	"smartPortHasRequest"
+.LASF1965:
+	.string	"MPU_RA_DMP_INT_STATUS 0x39"
+.LASF2627:
+	.string	"writeFn"
+.LASF1178:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF966:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF2887:
+	.string	"SENSOR_SONAR"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1919:
+	.string	"MPU_RA_Z_FINE_GAIN 0x05"
+.LASF1543:
+	.string	"M_2_PIf32 __f32 (0.636619772367581343075535053490057448)"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF3012:
+	.string	"SMARTPORT_MSP_VER_MISMATCH"
+.LASF1513:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2520:
+	.string	"__USE_C99_MATH "
+.LASF1310:
+	.string	"__DECL_SIMD_cbrt"
+.LASF2451:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF1995:
+	.string	"MPU_RA_MEM_R_W 0x6F"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1056:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2340:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2372:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1385:
+	.string	"FP_INT_DOWNWARD 1"
+.LASF869:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1507:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1343:
+	.string	"__DECL_SIMD_tanh __DECL_SIMD_x86_64"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2570:
+	.string	"PIDPOSR"
+.LASF1709:
+	.string	"TELEMETRY_SRXL"
+.LASF1939:
+	.string	"MPU_RA_MOT_THR 0x1F"
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF3063:
+	.string	"smartPortSendPackage"
+.LASF2590:
+	.string	"itermAcceleratorGain"
+.LASF2993:
+	.string	"smartPortTelemetryEnabled"
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1254:
+	.string	"__DECL_SIMD_sin"
+.LASF858:
+	.string	"__f32x(x) x ##f32x"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF2485:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF2058:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1418:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF3010:
+	.string	"smartPortMspReply"
+.LASF2364:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1438:
+	.string	"__MATHCALL_NAME(name) f ## name"
+.LASF2702:
+	.string	"MODE_TX"
+.LASF2197:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1873:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF2776:
+	.string	"rcRate8"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1724:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF2755:
+	.string	"FEATURE_FAILSAFE"
+.LASF1216:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF2975:
+	.string	"FSSP_DATAID_ADC1"
+.LASF2976:
+	.string	"FSSP_DATAID_ADC2"
+.LASF2285:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1789:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1120:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2277:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2391:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1154:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2796:
+	.string	"mspPacket_s"
+.LASF2261:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1670:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1608:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF2490:
+	.string	"BARO_SAMPLE_COUNT_MAX 48"
+.LASF1745:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1796:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1467:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF2183:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2216:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1886:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF2312:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2077:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1703:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF1137:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2675:
+	.string	"OWNER_I2C_SCL"
+.LASF2193:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF2572:
+	.string	"PIDLEVEL"
+.LASF1396:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1778:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1112:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1451:
+	.string	"_Marg_ _Float64x"
+.LASF2425:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1938:
+	.string	"MPU_RA_FF_DUR 0x1E"
+.LASF1383:
+	.string	"FP_LLOGBNAN (-__FP_LONG_MAX - 1)"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF2553:
+	.string	"uint16_t"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1987:
+	.string	"MPU_RA_I2C_MST_DELAY_CTRL 0x67"
+.LASF1712:
+	.string	"TELEMETRY_IBUS"
+.LASF2103:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2921:
+	.string	"baroDev_s"
+.LASF3045:
+	.string	"head"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF2137:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1882:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF848:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1798:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1370:
+	.string	"SNANL (__builtin_nansl (\"\"))"
+.LASF2304:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2801:
+	.string	"streamContext"
+.LASF1061:
+	.string	"__DECL_SIMD_asinl "
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1933:
+	.string	"MPU_RA_SMPLRT_DIV 0x19"
+.LASF1499:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2556:
+	.string	"long long unsigned int"
+.LASF2599:
+	.string	"CW180_DEG"
+.LASF2569:
+	.string	"PIDPOS"
+.LASF2517:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2900:
+	.string	"batteryConfig_s"
+.LASF2912:
+	.string	"batteryConfig_t"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1544:
+	.string	"M_2_SQRTPIf32 __f32 (1.128379167095512573896158903121545172)"
+.LASF1436:
+	.string	"_Mret_ float"
+.LASF2192:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1217:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1070:
+	.string	"__DECL_SIMD_hypotf "
+.LASF2676:
+	.string	"OWNER_I2C_SDA"
+.LASF1527:
+	.string	"M_PI_2l 1.570796326794896619231321691639751442L"
+.LASF2512:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF2761:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1424:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1719:
+	.string	"BLACKBOX"
+.LASF2935:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF1659:
+	.string	"_PTRDIFF_T_ "
+.LASF1547:
+	.string	"M_Ef64 __f64 (2.718281828459045235360287471352662498)"
+.LASF1255:
+	.string	"__DECL_SIMD_sin __DECL_SIMD_x86_64"
+.LASF3006:
+	.string	"smartPortRxBuffer"
+.LASF2119:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF1637:
+	.string	"TELEMETRY_CRSF "
+.LASF2479:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2403:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF2230:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF2664:
+	.string	"OWNER_ADC_RSSI"
+.LASF3044:
+	.string	"checksum"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF1359:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1083:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1142:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF2979:
+	.string	"FSSP_DATAID_VARIO"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF2347:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2414:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1147:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1898:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF3040:
+	.string	"handleSmartPortMspFrame"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2674:
+	.string	"OWNER_SPI_MOSI"
+.LASF1464:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1465:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1466:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF2907:
+	.string	"batteryCapacity"
+.LASF1504:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF2496:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1729:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF2597:
+	.string	"CW0_DEG"
+.LASF2161:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1203:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2785:
+	.string	"ratesType"
+.LASF1333:
+	.string	"__DECL_SIMD_atanhf __DECL_SIMD_x86_64"
+.LASF884:
+	.string	"__id_t_defined "
+.LASF2434:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1208:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1000:
+	.string	"__DECL_SIMD_sincosf "
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF2476:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF2073:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1215:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1990:
+	.string	"MPU_RA_USER_CTRL 0x6A"
+.LASF1192:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1332:
+	.string	"__DECL_SIMD_atanhf"
+.LASF1869:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF2184:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2605:
+	.string	"sensor_align_e"
+.LASF2934:
+	.string	"baro"
+.LASF2781:
+	.string	"rates"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF876:
+	.string	"__dev_t_defined "
+.LASF1127:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1698:
+	.string	"USE_SERIALRX_SBUS"
+.LASF1366:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF1726:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1711:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1207:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2234:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1393:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF2989:
+	.string	"FSSP_DATAID_A3"
+.LASF1897:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF2792:
+	.string	"MSP_RESULT_ERROR"
+.LASF2036:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF2074:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF944:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF841:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF2642:
+	.string	"ICM_20608_SPI"
+.LASF1055:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF816:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF2115:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1620:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1229:
+	.string	"__DECL_SIMD_erfc "
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1121:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2487:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF890:
+	.string	"__time_t_defined 1"
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1748:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF1551:
+	.string	"M_LN10f64 __f64 (2.302585092994045684017991454684364208)"
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF2612:
+	.string	"accDev_s"
+.LASF1929:
+	.string	"MPU_RA_YG_OFFS_USRH 0x15"
+.LASF2198:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2006:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1829:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF1107:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF3011:
+	.string	"smartPortMspReplyPending"
+.LASF2243:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1303:
+	.string	"__DECL_SIMD_expm1 __DECL_SIMD_x86_64"
+.LASF1352:
+	.string	"__DECL_SIMD_erfcf"
+.LASF2683:
+	.string	"OWNER_MPU_CS"
+.LASF2226:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1763:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * 0.0174532925f)"
+.LASF1283:
+	.string	"__DECL_SIMD_asin __DECL_SIMD_x86_64"
+.LASF2437:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF796:
+	.string	"___int_wchar_t_h "
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2638:
+	.string	"MPU_65xx_SPI"
+.LASF2362:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF2336:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1064:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2732:
+	.string	"rxCallback"
+.LASF914:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1877:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF764:
+	.string	"__need_wchar_t "
+.LASF2929:
+	.string	"baroDev_t"
+.LASF1767:
+	.string	"ABS(x) ((x) > 0 ? (x) : -(x))"
+.LASF2753:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1932:
+	.string	"MPU_RA_ZG_OFFS_USRL 0x18"
+.LASF813:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1853:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2626:
+	.string	"readFn"
+.LASF2660:
+	.string	"OWNER_ADC"
+.LASF894:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1184:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1733:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2994:
+	.string	"smartPortPortSharing"
+.LASF2522:
+	.string	"SMARTPORT_UART_MODE MODE_RXTX"
+.LASF939:
+	.string	"__FDS_BITS(set) ((set)->fds_bits)"
+.LASF1776:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1607:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF787:
+	.string	"_WCHAR_T "
+.LASF1775:
+	.string	"STR_HELPER(x) #x"
+.LASF2533:
+	.string	"SMARTPORT_MSP_START_FLAG (1 << 4)"
+.LASF2679:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1411:
+	.string	"_Mdouble_ long double"
+.LASF2217:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF1016:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1549:
+	.string	"M_LOG10Ef64 __f64 (0.434294481903251827651128918916605082)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1044:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1071:
+	.string	"__DECL_SIMD_hypotl "
+.LASF1274:
+	.string	"__DECL_SIMD_acos"
+.LASF1238:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1823:
+	.string	"PIDSUM_LIMIT_YAW 0.4f"
+.LASF950:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1200:
+	.string	"__DECL_SIMD_erff "
+.LASF1113:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1132:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1668:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF1413:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF809:
+	.string	"WSTOPPED 2"
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2387:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1564:
+	.string	"M_LN10f128 __f128 (2.302585092994045684017991454684364208)"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2455:
+	.string	"MAX_SUPPORTED_SERVOS 8"
+.LASF1210:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2149:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2965:
+	.string	"FSSP_SENSOR_ID1"
+.LASF2966:
+	.string	"FSSP_SENSOR_ID2"
+.LASF2967:
+	.string	"FSSP_SENSOR_ID3"
+.LASF2968:
+	.string	"FSSP_SENSOR_ID4"
+.LASF1858:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF3019:
+	.string	"getBatteryVoltage"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1515:
+	.string	"M_PI_4f 0.78539816339744830962f"
+.LASF2147:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2738:
+	.string	"serialRead"
+.LASF2239:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF1811:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2328:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF1835:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF1806:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2765:
+	.string	"FEATURE_BLACKBOX_UNUSED"
+.LASF1582:
+	.string	"M_2_PIf32x __f32x (0.636619772367581343075535053490057448)"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1199:
+	.string	"__DECL_SIMD_erf "
+.LASF3007:
+	.string	"smartPortRxBytes"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF2433:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF3074:
+	.string	"canSendSmartPortTelemetry"
+.LASF2806:
+	.string	"PITCH"
+.LASF1001:
+	.string	"__DECL_SIMD_sincosl "
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2862:
+	.string	"SERIAL_PORT_UART4"
+.LASF2863:
+	.string	"SERIAL_PORT_UART5"
+.LASF1563:
+	.string	"M_LN2f128 __f128 (0.693147180559945309417232121458176568)"
+.LASF2363:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2355:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2055:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1657:
+	.string	"_T_PTRDIFF "
+.LASF2188:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1881:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF896:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF2060:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1350:
+	.string	"__DECL_SIMD_erfc"
+.LASF2236:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1340:
+	.string	"__DECL_SIMD_erff"
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF2964:
+	.string	"FSSP_MSPS_FRAME"
+.LASF1143:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2519:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF2584:
+	.string	"dterm_average_count"
+.LASF2937:
+	.string	"frskyGpsCoordFormat_e"
+.LASF2424:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2145:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1528:
+	.string	"M_PI_4l 0.785398163397448309615660845819875721L"
+.LASF1281:
+	.string	"__DECL_SIMD_atanf __DECL_SIMD_x86_64"
+.LASF2398:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2317:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1371:
+	.string	"SNANF32 (__builtin_nansf32 (\"\"))"
+.LASF1355:
+	.string	"__DECL_SIMD_tan __DECL_SIMD_x86_64"
+.LASF2616:
+	.string	"ADCRaw"
+.LASF2087:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF499:
+	.string	"__PMT"
+.LASF1755:
+	.string	"power3(x) ((x)*(x)*(x))"
+.LASF1158:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1739:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2276:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2268:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"__DECL_SIMD_sinh __DECL_SIMD_x86_64"
+.LASF819:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1122:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF2857:
+	.string	"serialPortFunction_e"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2897:
+	.string	"VOLTAGE_METER_ADC"
+.LASF1561:
+	.string	"M_LOG2Ef128 __f128 (1.442695040888963407359924681001892137)"
+.LASF2659:
+	.string	"OWNER_LED"
+.LASF1193:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF3041:
+	.string	"mspBuffer"
+.LASF1680:
+	.string	"USE_FAKE_BARO "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1486:
+	.string	"math_errhandling 0"
+.LASF1972:
+	.string	"MPU_RA_ACCEL_ZOUT_L 0x40"
+.LASF2050:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2144:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF1024:
+	.string	"__DECL_SIMD_expf64 "
+.LASF2300:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1790:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF2958:
+	.string	"SPSTATE_WORKING"
+.LASF2783:
+	.string	"rcYawExpo8"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF3000:
+	.string	"smartPortFrame_s"
+.LASF3005:
+	.string	"smartPortFrame_t"
+.LASF1674:
+	.string	"LED0_PIN NONE"
+.LASF1794:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1479:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1224:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1318:
+	.string	"__DECL_SIMD_log10"
+.LASF2721:
+	.string	"mode"
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1160:
+	.string	"__DECL_SIMD_log2f "
+.LASF2089:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1363:
+	.string	"HUGE_VAL_F128 (__builtin_huge_valf128 ())"
+.LASF1335:
+	.string	"__DECL_SIMD_acosh __DECL_SIMD_x86_64"
+.LASF2114:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1537:
+	.string	"M_LN2f32 __f32 (0.693147180559945309417232121458176568)"
+.LASF1985:
+	.string	"MPU_RA_I2C_SLV2_DO 0x65"
+.LASF1676:
+	.string	"USE_FAKE_GYRO "
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF3068:
+	.string	"smartPortDataReceive"
+.LASF2571:
+	.string	"PIDNAVR"
+.LASF2920:
+	.string	"baroCalculateFuncPtr"
+.LASF2940:
+	.string	"frskyUnit_e"
+.LASF2864:
+	.string	"SERIAL_PORT_USART6"
+.LASF2865:
+	.string	"SERIAL_PORT_USART7"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1247:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1252:
+	.string	"__DECL_SIMD_cosf"
+.LASF1298:
+	.string	"__DECL_SIMD_cosh"
+.LASF941:
+	.string	"NFDBITS __NFDBITS"
+.LASF2335:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1875:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1878:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2459:
+	.string	"MULTISHOT_TIMER_MHZ 72"
+.LASF1326:
+	.string	"__DECL_SIMD_log1p"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF976:
+	.string	"__COMPAR_FN_T "
+.LASF1446:
+	.string	"_Mret_ _Float32"
+.LASF2035:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2351:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1915:
+	.string	"MPU_RA_YG_OFFS_TC 0x01"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2886:
+	.string	"SENSOR_MAG"
+.LASF1753:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF1201:
+	.string	"__DECL_SIMD_erfl "
+.LASF2131:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1149:
+	.string	"__DECL_SIMD_log10 "
+.LASF1172:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1834:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1918:
+	.string	"MPU_RA_Y_FINE_GAIN 0x04"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2641:
+	.string	"ICM_20602_SPI"
+.LASF2007:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1324:
+	.string	"__DECL_SIMD_log2f"
+.LASF2961:
+	.string	"FSSP_DLE_XOR"
+.LASF1661:
+	.string	"___int_ptrdiff_t_h "
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF1718:
+	.string	"VTX_TRAMP"
+.LASF1758:
+	.string	"VERY_FAST_MATH "
+.LASF1092:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1845:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2963:
+	.string	"FSSP_MSPC_FRAME"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2272:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF381:
+	.string	"__unix__ 1"
+.LASF3035:
+	.string	"tmp2"
+.LASF3037:
+	.string	"t2Cnt"
+.LASF1320:
+	.string	"__DECL_SIMD_log10f"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1379:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1279:
+	.string	"__DECL_SIMD_atan __DECL_SIMD_x86_64"
+.LASF3057:
+	.string	"checkSmartPortTelemetryState"
+.LASF2624:
+	.string	"mpuResetFnPtr"
+.LASF2678:
+	.string	"OWNER_SDCARD_CS"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF2808:
+	.string	"AUX1"
+.LASF2809:
+	.string	"AUX2"
+.LASF1545:
+	.string	"M_SQRT2f32 __f32 (1.414213562373095048801688724209698079)"
+.LASF2811:
+	.string	"AUX4"
+.LASF2812:
+	.string	"AUX5"
+.LASF2813:
+	.string	"AUX6"
+.LASF2814:
+	.string	"AUX7"
+.LASF2815:
+	.string	"AUX8"
+.LASF1090:
+	.string	"__DECL_SIMD_exp10f "
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2032:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF3034:
+	.string	"tmpi"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF2893:
+	.string	"CURRENT_METER_ESC"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1699:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2173:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF800:
+	.string	"__DEFINED_wchar_t "
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1433:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1626:
+	.string	"BLACKBOX "
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2204:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2639:
+	.string	"MPU_9250_SPI"
+.LASF2085:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1459:
+	.string	"_Mret_ _Float64"
+.LASF1636:
+	.string	"CMS "
+.LASF2075:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF1907:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1480:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF964:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF2692:
+	.string	"OWNER_OSD"
+.LASF1693:
+	.string	"USE_PPM"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF963:
+	.string	"__ONCE_ALIGNMENT "
+.LASF788:
+	.string	"_T_WCHAR_ "
+.LASF2607:
+	.string	"deviceSpi_s"
+.LASF1301:
+	.string	"__DECL_SIMD_coshf __DECL_SIMD_x86_64"
+.LASF2689:
+	.string	"OWNER_USB"
+.LASF2586:
+	.string	"pidAtMinThrottle"
+.LASF1948:
+	.string	"MPU_RA_I2C_SLV1_ADDR 0x28"
+.LASF2628:
+	.string	"slowreadFn"
+.LASF1664:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1957:
+	.string	"MPU_RA_I2C_SLV4_ADDR 0x31"
+.LASF1104:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF783:
+	.string	"__size_t "
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF850:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF3070:
+	.string	"byteStuffing"
+.LASF2127:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF997:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2249:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2681:
+	.string	"OWNER_FLASH"
+.LASF847:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1568:
+	.string	"M_1_PIf128 __f128 (0.318309886183790671537767526745028724)"
+.LASF2949:
+	.string	"frsky_vfas_precision"
+.LASF908:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1746:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF3016:
+	.string	"sensors"
+.LASF1819:
+	.string	"PID_CONTROLLER_BETAFLIGHT 1"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF1791:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2751:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2191:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF817:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1762:
+	.string	"DECIDEGREES_TO_RADIANS(angle) ((angle / 10.0f) * 0.0174532925f)"
+.LASF1492:
+	.string	"issubnormal(x) (fpclassify (x) == FP_SUBNORMAL)"
+.LASF1754:
+	.string	"sq(x) ((x)*(x))"
+.LASF1691:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2561:
+	.string	"FD_YAW"
+.LASF2454:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2882:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF1119:
+	.string	"__DECL_SIMD_sinh "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2589:
+	.string	"itermThrottleThreshold"
+.LASF1161:
+	.string	"__DECL_SIMD_log2l "
+.LASF2101:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2551:
+	.string	"int32_t"
+.LASF2254:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1462:
+	.string	"_Mret_ _Float64x"
+.LASF2169:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1484:
+	.string	"MATH_ERRNO 1"
+.LASF2464:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 480"
+.LASF1046:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF2286:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF2143:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1074:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2213:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF2718:
+	.string	"serialPort_s"
+.LASF882:
+	.string	"__off64_t_defined "
+.LASF1851:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1308:
+	.string	"__DECL_SIMD_sinhf"
+.LASF1195:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1377:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1319:
+	.string	"__DECL_SIMD_log10 __DECL_SIMD_x86_64"
+.LASF1175:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2307:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF937:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1942:
+	.string	"MPU_RA_ZRMOT_DUR 0x22"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF2978:
+	.string	"FSSP_DATAID_CAP_USED"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1731:
+	.string	"USED_TIMERS 0"
+.LASF2408:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF2617:
+	.string	"revisionCode"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2851:
+	.string	"FUNCTION_BLACKBOX"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF2970:
+	.string	"FSSP_DATAID_VFAS"
+.LASF1785:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1678:
+	.string	"USE_FAKE_ACC "
+.LASF1807:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF952:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2539:
+	.string	"unsigned int"
+.LASF2337:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1822:
+	.string	"PIDSUM_LIMIT 0.5f"
+.LASF1679:
+	.string	"BARO "
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2097:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF2211:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF2250:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF2327:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF2319:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2023:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2775:
+	.string	"controlRateConfig_s"
+.LASF2786:
+	.string	"controlRateConfig_t"
+.LASF1782:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF945:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3195:
+	.string	"rx_pwm.h"
+.LASF3163:
+	.string	"thread-shared-types.h"
+.LASF3205:
+	.string	"pwm_output.h"
+.LASF3091:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF3173:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3093:
+	.string	"/usr/include"
+.LASF3177:
+	.string	"mathcalls-helper-functions.h"
+.LASF3146:
+	.string	"floatn-common.h"
+.LASF3128:
+	.string	"stdint.h"
+.LASF3124:
+	.string	"fc_msp.h"
+.LASF3075:
+	.string	"src/main/build"
+.LASF3090:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3120:
+	.string	"barometer.h"
+.LASF3127:
+	.string	"stdbool.h"
+.LASF3194:
+	.string	"flash.h"
+.LASF3180:
+	.string	"iscanonical.h"
+.LASF3202:
+	.string	"time.h"
+.LASF3157:
+	.string	"select.h"
+.LASF3099:
+	.string	"color.h"
+.LASF3208:
+	.string	"navigation.h"
+.LASF3085:
+	.string	"src/main/target/SITL"
+.LASF3178:
+	.string	"mathcalls.h"
+.LASF3166:
+	.string	"struct_mutex.h"
+.LASF3211:
+	.string	"gps.h"
+.LASF3162:
+	.string	"pthreadtypes.h"
+.LASF3200:
+	.string	"sound_beeper.h"
+.LASF3184:
+	.string	"common_post.h"
+.LASF3190:
+	.string	"parameter_group_ids.h"
+.LASF3089:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3129:
+	.string	"libc-header-start.h"
+.LASF3152:
+	.string	"timer_t.h"
+.LASF3203:
+	.string	"failsafe.h"
+.LASF3181:
+	.string	"platform.h"
+.LASF3094:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3215:
+	.string	"voltage_ids.h"
+.LASF3213:
+	.string	"filter.h"
+.LASF3105:
+	.string	"resource.h"
+.LASF3165:
+	.string	"atomic_wide_counter.h"
+.LASF3212:
+	.string	"boardalignment.h"
+.LASF3080:
+	.string	"src/main/flight"
+.LASF3114:
+	.string	"imu.h"
+.LASF3201:
+	.string	"vcd.h"
+.LASF3126:
+	.string	"stdc-predef.h"
+.LASF3196:
+	.string	"sdcard.h"
+.LASF3171:
+	.string	"math.h"
+.LASF3153:
+	.string	"endian.h"
+.LASF3191:
+	.string	"exti.h"
+.LASF3198:
+	.string	"io_def.h"
+.LASF3082:
+	.string	"src/main/msp"
+.LASF3130:
+	.string	"features.h"
+.LASF3088:
+	.string	"src/main"
+.LASF3081:
+	.string	"src/main/io"
+.LASF3139:
+	.string	"time64.h"
+.LASF3187:
+	.string	"config_profile.h"
+.LASF3122:
+	.string	"smartport.c"
+.LASF3132:
+	.string	"wordsize.h"
+.LASF3113:
+	.string	"altitudehold.h"
+.LASF3218:
+	.string	"smartport.h"
+.LASF3109:
+	.string	"streambuf.h"
+.LASF3131:
+	.string	"features-time64.h"
+.LASF3123:
+	.string	"feature.h"
+.LASF3209:
+	.string	"beeper.h"
+.LASF3112:
+	.string	"runtime_config.h"
+.LASF3107:
+	.string	"config.h"
+.LASF3136:
+	.string	"stubs.h"
+.LASF3216:
+	.string	"gyro.h"
+.LASF3143:
+	.string	"waitflags.h"
+.LASF3103:
+	.string	"accgyro.h"
+.LASF3121:
+	.string	"telemetry.h"
+.LASF3183:
+	.string	"target.h"
+.LASF3185:
+	.string	"maths.h"
+.LASF0:
+	.string	"./src/main/telemetry/smartport.c"
+.LASF3079:
+	.string	"src/main/fc"
+.LASF3140:
+	.string	"wchar.h"
+.LASF3133:
+	.string	"timesize.h"
+.LASF3076:
+	.string	"src/main/common"
+.LASF3117:
+	.string	"voltage.h"
+.LASF3217:
+	.string	"rx.h"
+.LASF3092:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3155:
+	.string	"byteswap.h"
+.LASF3207:
+	.string	"rcc_types.h"
+.LASF3192:
+	.string	"compass.h"
+.LASF3151:
+	.string	"time_t.h"
+.LASF3119:
+	.string	"acceleration.h"
+.LASF3142:
+	.string	"stddef.h"
+.LASF3176:
+	.string	"fp-fast.h"
+.LASF3100:
+	.string	"pid.h"
+.LASF3145:
+	.string	"floatn.h"
+.LASF3182:
+	.string	"common.h"
+.LASF3206:
+	.string	"timer.h"
+.LASF3137:
+	.string	"stubs-64.h"
+.LASF3197:
+	.string	"io.h"
+.LASF3188:
+	.string	"parameter_group.h"
+.LASF3108:
+	.string	"controlrate_profile.h"
+.LASF3116:
+	.string	"current.h"
+.LASF3199:
+	.string	"io_def_generated.h"
+.LASF3214:
+	.string	"current_ids.h"
+.LASF3186:
+	.string	"utils.h"
+.LASF3156:
+	.string	"uintn-identity.h"
+.LASF3204:
+	.string	"mixer.h"
+.LASF3115:
+	.string	"sensors.h"
+.LASF3150:
+	.string	"clockid_t.h"
+.LASF3104:
+	.string	"accgyro_mpu.h"
+.LASF3172:
+	.string	"math-vector.h"
+.LASF3154:
+	.string	"endianness.h"
+.LASF3097:
+	.string	"stdint-uintn.h"
+.LASF3149:
+	.string	"clock_t.h"
+.LASF3175:
+	.string	"fp-logb.h"
+.LASF3193:
+	.string	"adc.h"
+.LASF3135:
+	.string	"long-double.h"
+.LASF3111:
+	.string	"rc_controls.h"
+.LASF3118:
+	.string	"battery.h"
+.LASF3134:
+	.string	"cdefs.h"
+.LASF3174:
+	.string	"flt-eval-method.h"
+.LASF3083:
+	.string	"src/main/rx"
+.LASF3138:
+	.string	"typesizes.h"
+.LASF3077:
+	.string	"src/main/config"
+.LASF3110:
+	.string	"msp.h"
+.LASF3102:
+	.string	"sensor.h"
+.LASF3147:
+	.string	"locale_t.h"
+.LASF3086:
+	.string	"src/main/target"
+.LASF3098:
+	.string	"axis.h"
+.LASF3125:
+	.string	"system.h"
+.LASF3078:
+	.string	"src/main/drivers"
+.LASF3158:
+	.string	"sigset_t.h"
+.LASF3106:
+	.string	"serial.h"
+.LASF3170:
+	.string	"stdlib-float.h"
+.LASF3141:
+	.string	"stdlib.h"
+.LASF3161:
+	.string	"struct_timespec.h"
+.LASF3189:
+	.string	"build_config.h"
+.LASF3160:
+	.string	"struct_timeval.h"
+.LASF3084:
+	.string	"src/main/sensors"
+.LASF3096:
+	.string	"stdint-intn.h"
+.LASF3168:
+	.string	"alloca.h"
+.LASF3179:
+	.string	"mathcalls-narrow.h"
+.LASF3144:
+	.string	"waitstatus.h"
+.LASF3210:
+	.string	"motors.h"
+.LASF3148:
+	.string	"__locale_t.h"
+.LASF3095:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3167:
+	.string	"struct_rwlock.h"
+.LASF3169:
+	.string	"stdlib-bsearch.h"
+.LASF3087:
+	.string	"src/main/telemetry"
+.LASF3164:
+	.string	"pthreadtypes-arch.h"
+.LASF3101:
+	.string	"io_types.h"
+.LASF3159:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\030\003\315\016"
+	.string	"D\021\f\004"
+	.string	"+"
+	.string	"\262\223\326\254\006\n\002"
+	.ascii	"\001\001\352\263\360\321"
+	.string	"\b\002\353\244\313\346\t\b\002\003\002\003\002\003\221\332\200\244\004\016\004\002\004\004\235\307\215\326\n\n\002\005\002\006\002\002\006\002\007\002\006\002\b\002\b\005\240\342\234\212\n\006\007\b\264\345\206\245\002.\002\t\b\n\002\n\t\n\013\242\302\263\302\013\f\r\016\017\020\021\301\265\207d\006\002\013\002\013\n\002\n\022\023\024\264\323\233\314\007\b\025\301\206\307\333\b\004\002\f\002\f\002\r\002\r\026\027\030\231\341\314\324\004\031\315\236\361\324\003\n\t\002\016\017\002\020\033\270\237\251\345\013\004\034\366\271\244\326\006\004\035\373\306\310\231\002$\002\005\002\021\007\002\006\t\036\037 \332\232\271\214\006\f\b\002\b!\310\346\375\343\017,\t\002\t\"#$%&'\312\202\304\253\005\234\001\022\002\002\023\024\002\025\026\t\002\027\002\030\027\031\002\031\032\002\002\002\032\004\002\004\033\002\033\002\t\002\034\035\002\035\002\t\002\036\t\t()\276\225\250\364\n/2\352\263\360\321\b"
+	.string	"d\250\241\301\340\214\310IS\031\016`\202R&F\017\021\320T\302\244\023MAZ\331g\r\267\222\200,\\\003\002dw\032\264\217\232\240<\334\r\336\2735\030\f\363\320\376\n\340t2\237\213\317@\267\305/"
+	.ascii	"\365\b(I\024\005\341WM\035]`<R\324:\177\234\272\207\307!\342"
+	.ascii	",\374\\[p\332(\332\257|\226\304(\242\023\007\342K\214\2575\312"
+	.ascii	"jiYa/\215\326Js\f \2719\007S\361vc\307I\313\326\364cr'\252f\351"
+	.ascii	"\304\027A\345\b\31605w\350p;\252\022>\305\365\355\364\331Xf\373"
+	.ascii	"_!,\017\007\342\034\036\332\007\034\315\357k\257\022O\276Z\361"
+	.ascii	"i\233n\276\316\260\027Lu\t]'"
+	.text
+	.section	.gnu.lto_.ipa_sra.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\335\003"
+	.string	"\022\304\013\023\240)\035\377\377\377\217\003\363\r\205\204\004+\bG\266L)\352\312\311\"\345\241\033e\322\202\320aW\b"
+	.ascii	"\263\\\037\221\233\225\372\366\267\023y\n% \240\202J\252\007"
+	.ascii	"\b\240\334\275\321\263\200X\330\016:\360{\265\r\373t-^\204\244"
+	.ascii	"P\3418!\346`\311\224r\005\354\036\033\305J\330\201-\210\211\243"
+	.ascii	"\t_jm`[\213X0#\311\266V\030\024\263E\263\222\343\312\244\300"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.inline.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`r\005\335\027"
+	.string	"fauI\320\322(\035R\347\001_\340~\222\250$\2463\300\021\344\247\352f\303'ME\323\224\250\316\004\025\363\271D\rZG\023\027nLf\330\030\345\016\206\026\217\204\036\b\017\326\003\364\245\017UO'\200\n\020\261\261\354\315\315\366N2\005X"
+	.string	"`"
+	.string	"e"
+	.string	")\377\363\277X\274\345\270H\272_\006/-[\226+\267\264\214\305\333NH'MMc_\301\301\304\216\273e0\336\007_k\255\323\316Pk\245\331\250\357\332f}\027\303\334\303\354\376\254\317\262n\301+\263)\323\255;X\357\246L\326+\230\304\353\022\225p2~V\366\347\331\022\036\030\205\360\320\321y\246\325\340%\315\323\031\t\n"
+	.ascii	"\264\312\255\3530GVCn\272~\301(\232!\242\235\006\246k\253Ht\265"
+	.ascii	"V\325\3548<\035j\234XRi\226_\346I\333\007\\_\377\233^/\256g'"
+	.ascii	"\341Ts\342\373z_^{\002\022\303\344\267%,4,\274\251\355E\373\223"
+	.ascii	"}\203\r'&o\242\3711\002\245\326\223\363Q\300\004"
+	.string	"\006\330ky\023\371Dv\032\326ZQ6q9u\t\200\033\026\256\351w!\0176ZL\323\227\351k%&\321\bm<\323\255*\307\355z\034\335\3643\375Tb\316\316\216\2262}\215\020u1!P\234V\t\321\306\246\242\347\246\262\202\2216\224\223[`J\253)K\224\251\001\335\004\336\365\256\215\246\375r\026N57qH\221\031\035An4\025\254\275\340o\226\212\236\224\226\212\210\240\354Y\264)\0051AH\340\203\003\201\363\013\273\f\013\217\340\273\367\316\004\270\345\335\332\264'D&\233\0249\036P\370\215\0173\220\030L\003G\"n%<\036\034:;\225QT\262\3304\003\003)\345\225a\341\264]BS\333\022\200\205\2501Ae\310\f\311\314HKR\314\001p\002)3U\346\001\022\200\3450\ts\2161D4\201A\n\365\330c\f\237\tj\203\363c\226\037\203\376\003\037/<:L\227\023\3235\207\222kc"
+	.ascii	"G\031\030\034LS\310\366\200\314\251Dm.\361\347[6\372\235X.\340"
+	.ascii	"\362o\225\214|\202I\213 -\240\002\310\345\206\fWH^\350\271y\361"
+	.ascii	"\373\273\n\235\245n?\226H\213\017\361\241\235^\200X\373Q)\n\036"
+	.ascii	"w\001p\030Hl\312C\357\bqrh\351\310\341\bN$D\002\345\276*\013"
+	.ascii	"!\027\244y:\243U\366P\254\032\f%\0048\335J\251\203 \202Khe\242"
+	.ascii	"\r|\006l\316\005B\035\272\304\270\243Y\357\330\236\342\2578\326"
+	.ascii	":x\254)k\366G\220jw\352\00270a\022\234[G\031V \031G7\203\021"
+	.ascii	"Y\332q\013E\031W\266\0020\234\377\307\253\230\362\277te\264\234"
+	.ascii	"\211{W\227\213\244q\312\001*\247O\017\251\373\203hTR\027|\022"
+	.ascii	"8\222U\376;\037\016\225\337\024\274\205d\323U_\021E\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\375\006\225\025"
+	.string	"\006\234X= s\222\016|\3479\221\021&>k\027\326\343\330\333\266@\300\324\244x\261\375F(*\263pb\201\200\021\002\020\004\b\324@\221\270JU\274\035\004\251"
+	.string	"N\360\021\321\266\272y\331\344N)\005B"
+	.string	"E"
+	.string	"J"
+	.string	"I\"K$\250\021\330)\270o_^\222\016\301\263b^a\253\2603\005\272\325\355\264\323\304\206\327\302\255\001\317\336\262\260\2704\3606\274\301\326\360\006\357\336\250\233\363\027\252/\344\366\374\234\236\221\375J\005\300#o:\323\266\200\210S(\312\031\002O\240\035\3206\300\253'\2631)\002\3579\201\366g\3445\007\355\253z\355\"\303M\322\"O*T\202/\277\\\025\364\305\024\330\233'9\342&q\331}\234\2636\017\177\317\2023Of\341\037\006SN\353a\013-\303\367\204\326B>!\037N\313\300?7\360\357\301\231\007\007gOPy\f\303*\354\202=B\2753\303\357t\332M\243\326Zs{\2405"
+	.string	"b\013k\013o\0203\347\007d(\027C\271\234(\360 0m{a\f\207p\366\026\207[\356JRV@+\240\222\030w;\242\366G-\223\271\373\243\246\2435[(\240\371\260\205\314-RH\n]\227F\0235\215\211\306\304\0358\374\360uQ\327\323\242\246;\207-2\275\322\364\303L\227\274Aw\2721\200\236\250\001U\250jD\nRP\220\024Z\003\260\"\241\"\242\007\022\200\"\231\b$:\306\214rD\210DA\n\n\222V\366\fH\\\3020\352\017\261\220d\351\321M\216\260\345\361U\303w\272\201\t\353\2068\204"
+	.string	"\232\344\025\245,\007\202+,\207^\261\345\323\361\254\320A\367\006\273\001\\\375\221\016>\326\356\245a\226\311\242\342\"\317x\316\352 \216y<\037_:\037e\213\267o\356{V*,\260\322\221rA\027\251\342&F\236>#'\036i|2\371VYB\272c\345Qf\202;A\214\231)\236\316\310\2445\331\020\356\n\016\201v\323\\\022qx\344\006:\t\254TDD\235%*\340\360`\217f\211\220T\364s\221\035JjVC\367:\221R\246\nK@+;n\024e:\002\377\246.\t\203\216"
+	.ascii	"W\317\020\207`\334\254\t+\375\244N2\032>U\035V\337\fR\247w8V"
+	.ascii	"\233\233J\005\246\0350\367\027\212+n\210\332\356@i\360\376\301"
+	.ascii	"\2336\214\212\310\203\350\304\204\352\375\366cOP(|\3007\246\201"
+	.ascii	"\204\344\211D?\371\274\256\312V\202>\254\322\305aZ\334\264S "
+	.ascii	"\032\032]n\300\376q\024c\345|\312\305\370jP\254\214\244\fG\006"
+	.text
+	.section	.gnu.lto_.pureconst.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\232\004\002\231\004\003\230\004\004\230\004\b\232\004\021\230"
+	.ascii	"\004\024\230\004\025\230\004\030\230\004\031\231\004\033\204"
+	.ascii	"\004\034\230\004\035\231\004 \230\004!\231\004'\271\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`+"
+	.string	"\r\004"
+	.string	"b\006\017\020@\223\326[-\307?\321$\261G\314\303M\231\002U\212 jC\331\330\030\347\302\024\b\313\266\234\347\033x\b\224M9\023\247\331\244\370"
+	.string	"\246\216\276sJ\r9\223-\371\352t\201<\004\035"
+	.string	"d\023p\313\306$\f\302\022\177\251\260\306R\021\233\322\003\026?u\006\202\365\204\234q8p\362ca\306t-\301[\235\re,\252\321$\330\006\rq\022\020n\021\206\315L"
+	.string	"\026\274L\271\013\254"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.lto.e04479f24480c908,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_frSkyDataIdTable.108.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"\255\005"
+	.string	"\002\310\035(`o\032\003\237|\342\3621\354|\244\237a\200@`\241\221\350V\020\004A\320r\274\020Y\203\331\355\035\344\017\022\332d\247\035\360\307\220#K\236\334M\271\262\345\313\2303k\366\336\314\271\223\330\363\347o\320\337\241E\217&]\332\364i\024\342\324a\021\275\332`(\246c\272SYE\231Y\327[\005\304\235v\202:XL\343\262J\b\2546\271\202a\347\333\364\332\202C8\026\036"
+	.string	"0c@"
+	.string	"\270\007\206\201+0\347\300e6G\244\334"
+	.string	";\320\330\215d\204\203\201+`\016\\\006F\300]\320\020\b\006F\300]\320\020\b\003\327@\0230\005\277\334H\261z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_smartPortDataReceive.123.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`Q\t\0051"
+	.string	"*Q\f\022D`\246\326\030\007\227\236\273\257\315\006j\024\272\3748\024\253\345\323\r\307\217\307\253\030\214\341h \362\033\243)\310\371| \226fe\034Og\216\353\354\020\273g\275\315\275[\020,r\033\006\255\334r\033\221R\246\224R\023\001\371"
+	.string	"\024\001V\244\332\354\tY%\035\340\344\315X\223\020\275n\221\254\2046\242\226\366\024\251\246\002\305\276P\351k\243\002\224+ct\357+U\320-s\350u\313\322\236\204!D\356\314=\326Q\244\232,\212\333\367\345\002\303\345}\245\f\330A\257[b\037\335n\275\213n\267,\305\334\246\245^/\257\013\312\264B\367\276\357\320w\265T\373\034\215\305\036\036\342\316P\030\004\376|=\236\333\262\357R\334\277\347T\373\034\303\214\270\221W4\355b\221\356)B\304y\300\276\234\350\325;^?|H!\212\260\251\316-\001bN\037\036\024"
+	.ascii	"\344\025\375\232\352\344\261\303}=]R\340\364\264\304\234P\347"
+	.ascii	"\261\017\254\350z4\325\251\305\006\3510\335\200O\246\273Mu\366"
+	.ascii	"`\221\357\373\002\237W\336\262\t\266\302\340\030>\255\330c\231"
+	.ascii	" kZ\314\031\346,\321\0232cV 6\302\372Y\",\317\263\341\263\212"
+	.ascii	"\025.i#\326\323v\254\347\322\235W\364\276/{\363i\243\371\247"
+	.ascii	"\231{\0063\217`\356\245\bj\335/\243,\315Z\022\306Q\277\361\013"
+	.ascii	":\244\001\346q\244e\271aQ\304\221Z\253I\227;\255\273$a\034\035"
+	.ascii	"\271\335\006`\243ni4\022Apk\324Fr\271\263\264\026$n0.\001\345"
+	.ascii	"\335\354\226\033\312\355\026\310k\216\312\257\034<S\243\262\232"
+	.ascii	"09\347\337u\224+\364'\312\342\252\234\016\373YZ\320\267Y#\251"
+	.ascii	"\274\216\211\316l\"\311\273\031\364$\270\226?\305\3031\252\264"
+	.ascii	"\t\t]O{\204\034\227\265\372z\035\263t\312?\312\334\177\275^\257"
+	.ascii	"\374B\230\221M\326-\324f\315AM\326\374#t\366\021:\037\205\316"
+	.ascii	"F\241sQ\350\334\343\316<\356L\024:\357\270\363\320"
+	.string	"\347,|\347`\320\031\350s\376\365\234}\357\334\013:\363|\316\256\317\271\005:\263?\347\3679{\317\271\211\n\b\331\352\321\245\365o\322\267\306\265\316K\246\355r\244\315\232\347\256\267\3162w\227\365\224\201\022\322\252t\310>\340\n=\362\333\216\251c\231\006\241\314\031\266\035\337+\313\322\330\371~\030\007E\223B\345\270\262,F\206NuRk\225\256\353\232\200\230\004x\237;\204\037e;\024u\\\326j0\351\316\t\362\232\343\201\266\303\252\005\374(G\271\334r=\027\365\342\302\005\267\333\037\257\271\034\302\006bB\362\201\003k%ch\315*\357\271\335\030\371\222\204\241k\323{gs\245\244}\3367\363\316\3755\335\254\366[\267\357~_m-\375\232\246}\264\033\b\336\262\226?a\207\031k<\351\250\254x\370>\332H.\232\002psWn3\355\366\224A\203\006\267\333\003gv\302)l`\275\217r?\271\354\273X"
+	.string	"\377g\356\340\301\273\311>\262\352\247\230[L\217Y\361\001\004\b\267\333\377\005\r`\031\346\205\367Q"
+	.string	"\312\340\331\234\266*\0133u?\352`\374\201\276\240~\026\347\213\221\001\270\367\245\352&7[{\t\301\r\326-\21302r\273m*m\201\313\317\344\034\213\351\244F\373Q\356OI\246W*--\301\300\020C\331c\007\023\224\226&DX\"jpLjNj\340\244L\272pR\232h\3214\004\245tRj\241\304B\311i\210I\205\211\026CI\312\246\241\006\0028\351BI9\344\224L*\207\200\322\267\213\250~\331\354\373\276\257\217\317\347\270v\224{|\237\3678L\250\235\361\213\177\354\025\337\370\036\347\352nYG\355\371\342\263\347\177\254\324\001qR\263\343G\271\327\326\\W$\326\252\025\265),#\215+W\221.+)%\345h\201\327\234\021\rNP+JV\017\317\017\277\201\224\305\021\277\257\315k.\317\367\025\222\235'r\313\371\214\235\017\372\202\016\337\333\230wNvo\254U\002o\260"
+	.string	"\341\371(\367\2647\274\3011\321v\220\317\354P\350\177\036\313\327H\356\357\231\320\332\226\220\214\315\352\317\013\337gF\316\362mz\007|v+#\017>\334\266\306\274*\370\276\305\037\370s*\377\337\263kW[=\355\236\233\335\317\027Q\021?\352o\023\220\032\365\375&kd\200\325\250a0J\215CC\"\"\005)I\222\306\220\002\021!3z\021@9t\220$J\333\001\001\220\030SM\3528\327u\254\351\244\323\004\235\312\327\t\360i\211H{Yd\354\256\264\334\007\177v|\246:I\224:\373\307k\\Yv\n\270\343\205\034;\262AN\345\324\231T>\302\371\303\221\263\201\201\220M2D\371\306\004MB\235pqO\020\306\245\243\f\312\314\002\276Qd\016"
+	.string	"PGa$\200d\210\362&\307!\370\333\301n\020\353-\b\206\202\033\243\227T+\313\324\222\036\315\357\b<k\375\221dS\347\274NV\244\361=\016"
+	.string	"\004\244\3754.\365~\362B\004L\002\273\270\347\003(="
+	.string	"a0\240j~\360^\265T?\025>C;\037o\272\236\370Sv\030&\353:\211OW\213\235\355\277mX\022\275\254\263j\034\303\007\263O\225*\223\020qUP\007\277\214p-\257\235&\310\b\220i\272\3426\374K\245#e\223\001 e\365\245\027\315\245l6\240m\275\035\300\271\214GL\025\002\212m\316eN\323i\005\203\013\277\307\246\265\340\223U\203\341\234\226\360\241\250o\202\242\245\212\227\356i\246\215\256\222\2138\321d\331\301PK\207\223=\353?\352\371E\021\"\312\243\330\343\240iE+\342\017\340\020y\007\251?"
+	.ascii	"u\234\031\027\250\226\250\253\013c\204\252\327yjf\2757\252\224"
+	.ascii	"O\342\211\232\312N;\216\374\242\202\256kP\377\347\216\262\361"
+	.ascii	"g\204\275\027\363\001W\003F\350\371\341I)B\272\032"
+	.text
+	.section	.gnu.lto_smartPortSendByte.124.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\026\003M\026"
+	.string	"\226\350\216J\320\360(\035\317l\350\316\350\314\275\342\220d\230P+1\352\343I\246\0241=\341\212!\34469J\252\214i_V\257+\216M\232%\264\366\257\266h\235;,\007`\312\033\325\372\244\007D\005\027\240\332\303g\341\277\221\275\211\224I\006z"
+	.string	"s"
+	.string	"y"
+	.string	"\270\227+\357\250\265\006i\244\274\213~\242\316\242\237\262\244\030\363nL\206;\017\313v\255@\241\024\265\226\t\026\004\365\271\270]\031/o\352\210\003\303\363Y\252\265\302\372\303q\037\351\024\233q\373\226\217\033NE\005;/A\034\276\235\270\3613C\004\217\247\314E"
+	.string	">\231\267\350QD\203\304\341s\021\013"
+	.string	"]d\270\317\031\306\247c\036Ej\255\313=\037\206/\352\273K\356\356\203\335\036\t@\035\017\367>\207\340#bJ\252\\c\267l\341\266\331\275X\273f\327\325b=\370]\275\374;\316\363\253F\336\324\310\213\242\274#\363R\312;\231W\234\274Myy\362\236\200\307\b`\007\034\013\r\243\254\027\206M\225h\nC<\370\357\376>\273\261\340%\366\023\357\301=\250\362\312\2255\206\001\020\n\236\245ZK\004\237\353"
+	.ascii	"\365)\200weM\261\346\335\227\270\21121LIM\243\023<\242m\263+"
+	.ascii	"\264\243Kz\216XH\302h\322\036\205\243\252\351j\207A\364\200E"
+	.ascii	"\242\212\305\236B\263S\277n\261\317{\312\361p_7@U\335}\236\206"
+	.ascii	"\225\216\221\212\327\351;D\271wO$\360{\373\252\320-\273\3779"
+	.ascii	"P\312>gk6~\357so\353\324/\307\303U\t=\030]\205R\321L\267\315"
+	.ascii	"\236\205\276Kz^\2700\215\275\356,T\325ov\332\0053r\326(3r&.H"
+	.ascii	"\b\315$Df\022\373p\315\276\263\217\033iC\271\221$\265\024\330"
+	.ascii	"\ny\243\325h\023h7\030\205\023\222\032lF\246\300>\016\254\r\205"
+	.ascii	"F\302n6\033\t\333(\353\305\3325+\222k\335\350j\216\021\340\350"
+	.ascii	"\227k\341\372\360*\264\325\256\037\213V\013\305\352T?h\367\244"
+	.ascii	"[\301z\345P\315\352\357\200:T?\210\367\304\302\241U?\370\006"
+	.ascii	"3\271\017EP\031pSk}\316\252\257\004\303\301\025? \240\002\031"
+	.ascii	"9\272\003\001\f\nCC\211\321\326\245~\367*\325p\202O\035\331."
+	.ascii	"\301\314*z\005q\256\313\240\254\030\330\024\211!\342\334\241"
+	.ascii	"\231{5\002\211\"\016\262\230\343\267\343\227\026\350\264\036"
+	.ascii	"\304\236|\030n\210YT\362\271g\243w9\303\354\240\244\261`\247"
+	.ascii	"\353\325\023\0243a[\273ic|\255\330\261\323\207$e}\265=q\215H"
+	.ascii	"\3010\304A\303(z[>s\333\035\025\375\271i\"J\370\222\355\354\224"
+	.ascii	"\013`\270w\271\032W\336\003"
+	.text
+	.section	.gnu.lto_smartPortSendPackageEx.125.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\377\002M\027"
+	.string	"\306,\232G\300\332(\035"
+	.string	"\024\302j\231\210\313M?\322s\245\263\244;\224\364\275\253\201z\ny\217<\357\347\251'U\333\037\2568a+z\324\315\252\227\205\324u\346\025\205\365\037U\327\216\310U\213\002\332P\205\321\2364\262\267\224I\006\204"
+	.string	"}"
+	.string	"\211"
+	.string	"\027\300S\001\274\253\352Y5\357\236\310\213\210'q>\240\326\2351\025\310\237\276S\360\004\276S\025\220\025\363n\003\225\370\333\210\355ZeH\331\325J*\330\005\340\351\212\273[N\332\250\242\033A\306\\P\2555\3255\366\373$\277\223\305\323\331,\356sg\035+\262\3239b\341\304H"
+	.string	"[\211\351@K\216\"5\033\215'\017\235\367u\347'ThXt6\235\263(B\255u9\307\306\342\373}wE\354\256\206\335>\020B]*\017\355\2222n\236\335o\331\"\305\211\355\235]S\351\344?\363\333\017\340\345wt\362\0132\257\210\362~\224\227~\274\223y\233\3622\363\376t\0305\210\013\005\237ZU\364\304\324*\224\247\343\345\217;\357^\005e\265G\262\327\255\214*J\222+\021_\322\200\262\025\240\256\274\001\325Jf"
+	.ascii	"OQ\363\273\342>\2672\252&\253\335\335\367\374\210x\334\rXw\340"
+	.ascii	"X\n\001\252u\227\340t\003<\323`\327$d!\301a\020\354\020\352\001"
+	.ascii	"2\017\355h#\314x\350\263\326Z\247\251_\036u\232o\324\246\276"
+	.ascii	"\t\031\007xBK\232\273\373L\3061\373\235\207\0218\3668\335Sj1"
+	.ascii	"J}\362(\006\007\273\3243g\342\007\215{\353r\261\353\006\222\305"
+	.ascii	"K\230n\036\232\357\3451\314\230\361\320^\367\351\203F)\350\207"
+	.ascii	"\304G\362\334\013\314y\357\302@\360s\026U\242e\013\240\337\037"
+	.ascii	"\3070\017\314\317o\276\343>c\343\313\214{{r1#\034\336\n[\315"
+	.ascii	"\212\2616\314]\360\300e\363@e\323\240\346\264a\202\353\305\n"
+	.ascii	"mD\333\252\211\205\260\017\261\220\365\n\221\302\tc\256\227\253"
+	.ascii	"\203+\226\362\300\201\365J\265\302\020\251\032\003\013\373\340"
+	.ascii	"\nS1\030,L\311\220\365\275\263\024F\025\002\2325mof\2554 \034"
+	.ascii	"\367\003\365poI\274\177}\242\257E\255\200\366\327}e\2141\233"
+	.ascii	"\036\367\331\005n\274x\356$^\357\2076\317R\030\227\264\251I\345"
+	.ascii	"m\364\3417\371\250k\327\335\002\212!\243O\227zg7 \200\002\031"
+	.ascii	"\2532\017\207\032\024\006\254\327\031\240\340\245\225\232\310"
+	.ascii	"uv\214\215\3701\002\2235r\005(g\017\266\226b)\212\275\n\254n"
+	.ascii	"\267\264\312\345R49df\207\344(\030\305\022\335\354\271\223\254"
+	.ascii	"\247\320x\243\264\211\305]{\306{H/aG\242\313w\263-\273H\272b"
+	.ascii	"\360\003\026\242\235\301p\254\361v\202:\255@\304\370m\315M#\312"
+	.ascii	"{/1D\274\327F\273\211\325\013:\200\310\3532O"
+	.text
+	.section	.gnu.lto_smartPortSendPackage.126.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`-\004\375\026"
+	.string	"\206i\221J\260\022R:\202\033\314]D\024g0H\327M\261\t\031\330/\022!tg\r\336\327\032.\325\340\335x\372\246\215\330\267_\366F\310\310\266\246j\364\007\213\370\340\305o@\305\311\314\300\231\356 \025\236U+\210\256~\322\310&r\247\024w"
+	.string	"x"
+	.string	"{"
+	.ascii	"G\342=i&\254\033\310\252\223 h5T\326J\0228\365\203\361\324\344"
+	.ascii	"X\273\241\355\274\n\237|\n\336\215h\354\252\365\247l0\236\236"
+	.ascii	"\204\007\260hs\036\205?t\"\336\213.\230\326\352\003\305T+Y\300"
+	.ascii	"(\343)\311K\304\323\371\230xj\236\315\343dPm\205X\302A*k\255"
+	.ascii	"\263\005q\336'\317?\360._N\357\263\305\240\326\352\351\313\321"
+	.ascii	"\271\367\266\007\330\236`\207\037\002\035\250\352\304\302\231"
+	.ascii	"\004\371\236t\005>5\023\313\347a*Kx\310!?\352\304\262\311\336"
+	.ascii	"\\\017\366\303\272@\366\215~\330\213\376\2278=2"
+	.string	"N\273\304\351q\234n\211\323\3428M\305\351P\234\336\326\364\024\247or\016S\245\017\007R\265f\310\"R\247h\223\210/\335~\220\347+\035\350WM\007\350\2578\013\336\227dNzd\355!\bNi\2000\236\242\210\265\036\232}%\377(\277\035\277\242$\260m\225\020\327\267z\216\245+\336(m\274*\374\213\303\226\356\214\"\021\256_\343T\023\266\241\024nwv\374\242Ncc#v\375\031\207r\231V\376\334\225Q\302x\2149\336O\342k\347\276\352\246\210\315\314r\254\207\252\256\337t'\027\t8~B3\276\037\257\375\276\n\247H\315\314\362\203g\302\355\016\216\237\337\342.d|\241Szt\243\244\277\257\304\323'\2356\235\002+\266\334\013\215\r\246\265\213Y\331\027\233\2055J\312\215%\245\306b@V\262\3222\255\"\333\351r0;\235\r\0273\243\321\355n\270\333\313m7\253\320b\303\315Tt13\231"
+	.string	"\347`n\272\331.\227\323\315^d}X\027(\002\321T\315\332X&\254\365gA\017\243\231e"
+	.string	"\363\301\003q\262 \035\267)\264\314\373|\202a{\216\235\030Y\277\374\020\352\332\021!%\220\007\021\003\270v\237L\214\353\367\270\217\260\265#\017\334\356\\\005O\2501TC\2151\212\310\310\310\004i\n\322\034"
+	.string	"\003\021!\352\034\021@\271r\"\221\224P\201y\002RsC\253\313\201$\306\263"
+	.ascii	"?\356\203K\234\340\t\024\341 `\034\300\367\273\253\367\233\264"
+	.ascii	"\346\034\343R\3378\276\030\357\023\0024\364\031\3378p\2779\225"
+	.ascii	"Yw\376\373\n\307\370\373\303\230\013Q|\001\320\243\032\251\220"
+	.ascii	"\211\241\326\273\030\373\003Q`\213*\267\210\265\177\320\301&"
+	.ascii	"\035\231\023\352n\230/Q\233j\022\241jBu\b\004\231\247\232.N&"
+	.ascii	" _\355\207<\177\201\2344"
+	.text
+	.section	.gnu.lto_initSmartPortTelemetry.127.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\225\b"
+	.string	"\226\220;6Po\322\001\200~\001B\277\321Y\276\370\330"
+	.string	"(`)\033K\324i:w\324\243m5\023?\244\267\231\214\314\226\320\256\247\023u\246v\213)\200\013\203\214A\244I\231R)"
+	.string	","
+	.string	"-"
+	.string	"\366/\203l\226\177\032{\221\225\n\323\313\356B\3158\350\t\362\337q\001o\024z\002\034\354\256\323\033]\334z\333\006\266\241\355\2266D\227\367\256\n\244\t\r9KN*\2330\366\027J\305\260\237\331\335\265\226\354L\347\323\017\0308IA\030\331\265H\305,\252\"\341p \017\3012\016\307z\245\247+\357\361\253\315\240\345\275\324\216Dar\365?\376E\370\033\336<\225\357\261^\245\311s\021e\312V\022\374\301\n\3064\\\334:\\\334h\037\330E.\323\262\206\214\203\016\013\033\rb\361\0035\005\336:Y\204\334\266Ex}\373\314j)\001\005%R\t\247\372\001\r"
+	.ascii	"3\241\347\037\030\322\\\005\266A\206\2050\026N\bB\253\003\265"
+	.ascii	"\n]\260~\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_freeSmartPortTelemetryPort.128.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"\245\t"
+	.string	"\206Q@:0\305*\035"
+	.string	"\360\373\275\326\214\302`2<}{\337\004F\352\344;\007\343\005u\030M\264\004ckXbZ\220\031\2721d0\310@\203\003u\007DZ\350\262\001Z\332\366\337;\245+"
+	.string	"."
+	.string	"3"
+	.string	">\307g_\374\331\256\247P\373\225KB\025\333\335*/\376=~\3767n\tK\340cEaw\035\303\022\305-o\033\301v\265\237\020\361\341\247/\242\237\227\226\nR\234Y\300\264\262\327F"
+	.string	"v\n\214\322\302>e\345\311~\364+7\261b'\013\263\335\211Y\200%\231\"\031\266\357\253\r\247\323\241\237\005qD\326\332\250\017r\325\306}>\364s"
+	.string	"\005\323\370\210~\020\224\300\002^-\032/m\207\207\370\320\006\021\022\264\337q\217\221\217\341\220(\326`\274\216\363x]f\003\325P\347i\233\306\240y\265\201\223\331\252\246\003U\314\2019\217\326U\217\343\272zI\355)+O\323\304\222\231\220$\204\375\r\365C\036\023"
+	.string	"3\241Q(\360\376\273"
+	.ascii	"lk\232\237\024Fvj8\004\354\205l0\356\027r\200u\247\342\241\225"
+	.ascii	"\r\346\312B\327p\203!<p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_configureSmartPortTelemetryPort.129.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\n\003\245\026"
+	.string	"6\351\222K\240\024R:\b\362K\2542P\301J\214\323\205\234\233;X\324\036\246\241v\030C\027\271C\\\262\265|\323?\261\377\35768\325\376\215<\361\347\301\225\004\275\207\341\025^\317\027?E\252\205\361\314\315Ex\\\314\320\214\220\275\267\334I\006}"
+	.string	"w"
+	.string	"~"
+	.ascii	"\344\224\020\rE\356\035\022xe\027\362\365u\025\373J\237b_\031"
+	.ascii	"\307L\344"
+	.string	"\303\243{b\027o\206\326\275\027\326(\216{\t9\332J{\342\370&\277\334K\256#:I\013\f\021y\374\3127DS~4\025\215 ny\027~\n\3750\314\372\341\024\345w\201\276\356\275\345/h6}i\312@\205\362\333\321\222xD\351\302\263\270\360\021\3159\312\334{y\366~\035\316&g\346\021\314\274\200\271\001\004\301\333\224\320M.\236\305\020W]\324\"\n\253\033\310\377\261\357\034(\254\240\211\204\3712\376\364\303Gb\n\266\371\336+\337f_\337'XC\272\331\305\027\276&\311\267\225u'\027\363p7\033\310|z\333\210\271$\037<\217u\262\245\223kO\246=\271\347\344\243\334\351j\031i u/\207\256$\327G\315\301\342\3013\177\210+_t `\276\220\017\3431p\017\002\2219_\017\346{\266\351%\352\0343C8\016\234\025 \367^\030~\224\005\035\230\243{o\355\025,!9\226\375\340_\377"
+	.ascii	";v\331s\b\317\303nv\361I\361\205m \237Ii\003\375\324\277\"\251"
+	.ascii	"G?\352c\013\021Oc\247\262AM\212NWc\313\350*"
+	.string	"ysRLz\225\325\211%*\263\3359PA8\302k\310\310{\203`\3704.%\201\217\364\3123\032\315\276v\257\244\b\316\"\211\253\003\331\007\354\022\023\333\2119\260c\240E\305\306C\223\335zhJ\326i\271\325h=\267\032\316\314\006\253P\273\305f\261\t\261\033\214G\2063\203\351\324l\260\026\026\246\365\304j\260\033\215V\203\225C\335\351m#\226\321\365\256D\300dN03\337\343\356\33441\265TE6pF\205\b\336\r[6\323:6\331B>\326\2520\371\266\262l\363w\334\312G\001\r\rU/+\300$\273\317\300\366\323}\215\345\333\330\327\035\330\332\3147\001; \220\202!\221J\017<\343_\217\"\3073&\234\222o>i\331m\332G\257p9\204\325\030\325&}\321\340\312\004,\331\233\346z}\333\030\332t\231\255\2247\304+\031\260B\nR(\\\333\265E@A\267;\204l\030\237\204\f\303"
+	.ascii	"X\030\263\007M\302[\033\350\2022\254\337\221\224\336-\023\337"
+	.ascii	"Vs\2173\027\320\035n;\bq\017\212\"\306\003Z\330\343$\205\266"
+	.ascii	"w\017\266\231D\3602E\344\355\325\316\225\216^K\241"
+	.text
+	.section	.gnu.lto_canSendSmartPortTelemetry.130.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"%\f"
+	.string	"V\227SA Q\224\016s\"\001\334\362\t\212\006`(0\244Fj\254\243T\352\354gA\016\013T&)\230\323j\377\357\337\277Q\0042\211-\201L\016+\b\220\003\020\374\366\006\362,U\346\212\340\t\331[\312\224\002E"
+	.string	"@"
+	.string	"?"
+	.string	"4\346\364\344jx\347\021\256v\374\213<RX\001c\324y\036;\016\241\001\222\f2\006|\260\260`u\022ta"
+	.string	"\217\023\247I\027\202\224S\b\206\213\\I\035H\265R0\347\264\216\272\n7u\333\rlK\373\013\002\034.|\364\263\0052\265\206\355ytM\366\341\334\222mu\025\325\021\252!T\357\252U\325\007 \240\204\204\201\21399>\033\363ET\361\301\366\355\207\340\330\226\021$\340\270so\003\307;\200\020\231\b\317P\260\305\277g\250]\270\237\360\001\322\317\272\273\027\335\360I\274\204\006\3132\352Q\367(\256\247\020\217\024\273&\333\033\352\253 #1BZb_\304Gl|\017\216\260\351G\217\376F=~'\001\276T8-\303p\232\005\333\244F\343.\354zpq\022\202\003\013&/\332&+\005\234a.MrY\246I\313\233\207sKVx\340\272\224\307%\331\256\226\300gA\216[QqMp\206\250c\004n\351\001\024"
+	.ascii	"L\204~i\303P\"\013\230)\002\316\200VX\326\213\025cX\b\253\r\341"
+	.ascii	"\242\020\"\220\b_z\b\3205\034W& \360{Hh\351*\345Y\326\204\002"
+	.text
+	.section	.gnu.lto_checkSmartPortTelemetryState.131.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`b\001\365\016"
+	.string	"\206\233eG"
+	.string	"\221(\035\340\030\241\255\r+\021/ \027]!<\007\301\033\253\250\313\344\033\340\326JHn\222\037\361n\326\372\313?\2426V\2642)#\246\315\007\372\004B\265$\033\032[p\364\037\344+\353V\334\313\"\262\211\224)\005O"
+	.string	"Q"
+	.string	"N"
+	.string	"\016\351\\ze\333||\231o!ca\305\315\234\323[\020_\235\223\333\352\312g\235\353\254\\\006\020W\276\201\210\024\266n\316\351\021_\272\033\210Ft\001\"\272\266\217\0236&>\273^\020+\250z\220\3149\25501\303\355q\333\017l;\260\317!\362\2530-$XZ\232\343\317\276 \206%\007\216\2518\366\350\322\215\331\337\346\272\330\227\335\362jU\365\001|h\264t\0201\2633\306\251\222\263c\312\2200J\\v\373)V\036\0040\n\354\317\f\022Y]\246\352X\343T\001\305\230\221\335\3149\036\270\f4/,Pl\033\263\257\342\344\212h6\264\346\241f5\274\300pc7&WWD\253\361R\035\366iW\241\222"
+	.string	"\202\334\245\256\201\020Z\333P#\367\262w-\305qG\277\366\204\223\036&\267{-\313\276\314G\024\177\204SRz\330\245\237\342\036\016\031\371JFDJ@\237\001\037\n)\324"
+	.string	"\302G\022\205J\t\030\244|%\002\036}P\241\351\004\025\206\300\223\227\nQ\037\370\221>\224W2\t\201\336(<y\237\0026\235|\241\2072\231B\3173\266\276.&i\255\213\033\355\262b\344\207\332\021L\3640w\256eY@\355\303\003\034"
+	.ascii	"I\231?=\t\312\fXg\b\207\227\364o\037(\006\324u\240\032pmR\325"
+	.ascii	"A\360\243\201D\214x\271\271\005\026\037\221<\211\246\246\t\313"
+	.ascii	"\2700^b\214\350\354\221\305\022\3402\271\231\335W\223\253:\335"
+	.ascii	"k\013\024"
+	.text
+	.section	.gnu.lto_processMspPacket.133.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`p\003E\027"
+	.string	"\026)\223J\260TRc,+\003Z\004OD\003]8ah\033\253\333\006L\215\263yJ\362\252\031d\"\377\212\241\363\337>\267\310\r\324\016$W\374v5H\315\032~\310\3429\364\375A\301\306\313\332\001i\004o\276\300M5a{\357-S\nw"
+	.string	"|"
+	.string	"\202"
+	.string	"'\367Gh\252\305\275\267\345\247k`?O\354\225x\354\330\317\307\354\230+sk\377\305\201\351\223x\037p/\221\024\361\336\265\305/\260\237^\217\202\376\204\235"
+	.string	"\372\323\251M\344\353\357\222\030a\005\t\223\367^Y\271\342\351\315\322\246\376\203\007\240\372zn\236xi\302"
+	.ascii	"%U\b\360\375\230&]AW\017\336\n\371|\254%\201p\357\265U}&\356"
+	.ascii	"\363\266'\330\266`\227N\001C\337N\003\227\362\273\3676\220\361"
+	.ascii	"\031\"\374\243\237\336\341\331\253<\364gyDE\321\263_\376\360"
+	.ascii	"%E\240\325\233~\022E\027=\276C/\374J\317z\031\005x\344B^\353"
+	.ascii	"e\257>\266,\262o\336\222\310~\322o\236\326\017\360\247\233\314"
+	.ascii	"\342\260uo\211/#\267\352\264\301\302W\372\220\347\253\337d\263"
+	.ascii	"\025K\317\264\203]\",\310\b\353x\357U\3603&\205\214i/\364a|\211"
+	.ascii	"\347L;\033^\001*{\\\013\016\371\0071i\250,\213^\001}\351a\t\310"
+	.ascii	"\217\355r\212\365/\240_\357\203\007\2732K\333\006\203\275\372"
+	.ascii	"\022fhD\331\343\024\244\360\017\276\244\270\243\252\027\343\037"
+	.ascii	":\303y\354\252T~ZQV,\350\207\326p\252\rST*\022JGN\202\337\213"
+	.ascii	"\317\321\341\201\361\336\353\340'\016{o\251\331\243n@\331bp\370"
+	.ascii	"'\033\002\343\275\275\253~\215\023i5\233\275jC\177~h\234;\345"
+	.ascii	"\030\b\037n\264\322/3\265\233\031\0067\013\\Pt\265\034\332L\007"
+	.ascii	"5\315E\227\303\351\350r\263\333\216l\227\323\325n5\0205\235,"
+	.ascii	"\004\316\354&\243\345vd.\007\214\323\251\345d:\034.'\213\255"
+	.ascii	"\275\233\267$\362\371t\271\216\275\322\307\177\212\204\372[O"
+	.ascii	"\246H\376\221S`\032L\203\350\227\212\375\372\"\266\230\237\326"
+	.ascii	"\327#il\026\256\345w\214 \301\026\217X\231.`\355\0355\204\306"
+	.ascii	"\304\350\333\205\340X\214AL\241\306^\rB\250q8\304\224\"F1\tF"
+	.ascii	"\202\321\202\304p\220\002\221\251\253\016\020@\346FD\222\346"
+	.ascii	"v\366\022\003LO\235\240\246\016\325\264|\317\360\017\266_[\247"
+	.ascii	"\214c\2213\335\326h\30204\253?\245\b\305<[\211\353F\204T\270"
+	.ascii	"WN\025\033\223D\274\002\303\027\323\nt\001|R\315\355u\253H`\224"
+	.ascii	"\316\256\233R\2054l\250\3266\2355k\007\t\223\207g-\333\006c\233"
+	.ascii	"\347\257`\223\005\217\006\350?\376h\351\025Z|I\377\305\rT\250"
+	.ascii	"\335\r\006\347[\370\005\245\231\347\246\214\\\005"
+	.text
+	.section	.gnu.lto_smartPortSendMspReply.134.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\212\013\2459"
+	.string	"\312]"
+	.string	"\025?@\246\326\030\314s*\026\260\2537N~0\352,\202\241\004\227\363i\205D\025`\240\260\261\264\002r\212\370\336\243\n{J\317:\372U?\263'\215\230\tP#\346\255\340\272-YI\331dJ)\005C\001&\001A\001Vj\256\270\345\270\325t\035\027\255\350\350\226O\\\311\327k\217\r\227\027wW=\267\0243\261\227\307\302\355`3\017\341.\323f:\256\253\\\2642;\323h\206t\232\037O\\\323\227\213B\240<\250\t\267\203U\255U\032\225\311\276\321\344\373\265\346\215\013\t\266)\323B \276\020n\007\255\340\256\332\255\337\2064\234\020\366\215N_2\n\202\246nR\035\344*\267\203<m\246\266\203n+\265\035t"
+	.string	"a\b7{\232&\326Y\2668\321\374\275\357\224\352\255\020A6\235\2356\017\277\331HI\344\361\310X$\016]a\033d\337\233\334\\\215\304\214\3436&\311\n\213\210i\351+4\215\225\220\210\357\215\324\221PU\310\316\372x\365\307w\326G\030\b\371\271\001J!Sk#;\341\216\226:}\205Ba\333)n\2544\033\324\314\213l\320\250\023\331\247V\357\372\n-c-\274\265\251u\265\241\330\240O|X\205\314I\273\356\244\205\355s\254I\007\2274\313\"\3203E\320q\254\b\033@zGI\327}\371\263\013\374xyr\034\003c\225\234\324\371\351j{\330\230\227\273P\303\373\276\354\3171\262\346\244fn\022\314\034\203\231X\027\255\277\323\263;\243\377|\372\331\327\313\326\377\277\301\244^\036\310\334y\255g\311\275\306=\230\314\266\203\376\n"
+	.ascii	"E\273\256\033\211\025\3125)\246\314\313\343\261hJ{\337\256;\215"
+	.ascii	"\007\005\253`\301\"F\034\240/O\304\314-\332\016\323\345\246\323"
+	.ascii	"u`\270\357\373\ny\244\032\\\227\007\262[\233\314\021\322\244"
+	.ascii	"\367\276]\375dv\321r`(\320\203\323q\260d(\275\237J\270\256\300"
+	.ascii	"T\347\005\354{\345\332M\326\373\311\323\306m\327m~p\257u0X\005"
+	.ascii	"\357\217\367\332\016\366\324\3550\272v5\213)\355}\337~6\265/"
+	.ascii	"D\351\272k\363\327\367\027\300\357\332\325Fq\007\005\354{]\021"
+	.ascii	"\363\224\313\037\215\271\257\256\326+\374T\230\253\030HE\365"
+	.ascii	"\\\363\001(\327Y\200\353\354\304\316MM\327\314\264\244\344:'"
+	.ascii	"\021\235\221\\\347\244\353\214t\235\217\256\363\221\353lt\235"
+	.ascii	"\213\2563\321u\036\026\235]"
+	.string	"\242\263p\350\3346\265\231u\235\337u\366w\356\007\026\004I\315\262\264\375\237\351+\026\270\350\315\013\276\331\322s\335t\335\324\3564-\364\326[\346\016\3117k\344\037?\371\004\371Lj\321\250oj?5h\245\217zg\004\366\305\213\357\270B\302\240\300g_\001go\342L|\t\207\016\336\317\343_0Z\363\374\034\024*t\334j'\265-\347dcu\235\024\3545.\366\347I\330\017c\341\021\222%\003\020\263&u3\364\354\353Z\266\305?zg\344\214z\311\371\221,'1k{n\344\207\203]\273\370F\377*~\223Z\264\253w\t\260\224A\324>\032\267\2325\t\013\365\215Vg\320\013x\246\017c&z\227\017\246\313y\366\035\370\341\023\277\235L\334\037\376\257q6b\366\340\357\207@\367\247\324\340\234\340\270\0275\243\245Q\217\231m\242,\2470~\177\r\350F+\231\003\337s\375$\374\003ob\357\217\263Q"
+	.string	"\347>d\b\306\360\020\2376?,f\021#\274\237\302\357\021\345\353\271\330\251\255\320\222\001\204\321[C\252E\3274\241,\2470zR\267\275\036\024\005\306O\352\326\324\216"
+	.string	"\346\372\276\206\256 \3247]?UA\275\313q\036\255]Z\274\2649\354\211\266}\255\270;%\032\320\t=,n\277\200\321z&\340\353\232\205\223\354\001\255\323\013x\241\022d\017\b3\260\2245Xe\020\033>\330-\345\r\031X<Z\036=C\207\362\271j\202\222\306\004\b4\034L1\321Xn"
+	.string	"\262\025d\031S[Z;xlia\345\360A\305\324\332R\346P\342PnQ\351\260\201\225\203J\206\226\017\252)(\336\301C\251E\265\265c\207\026Uq\372\366S\341\226\320\223\252]\222\273\331v\265=\3545\252\332\031\273\233mS\323\263\206\256\367\342\037\354\373J\311\320i\272\371\250\036\270\206\344x`\246\\\255\035\317\3135\371h\234\243P\243c\3257\2410\247\335\021\203_Zb\353\"&\205\262d\346\310\333\031\362\321\226-w^\nd\232_\325\322W}\3431\342\235\211\315\241\0269\0220Kj\246-}-\351\217\030H=\203\277"
+	.ascii	"\366\205\251\020\027\300\276\006l\212\312\216\214VF\006\274\345"
+	.ascii	"\272\232\365 \315A\263\234\226\271\371\326,\343\375\344\247\""
+	.ascii	"\317\345\366\311\323\006\260/\270%\017j$*=\263C\245\227\222\262"
+	.ascii	"R%F\034 \267\002b)>\032K5\322O\211!\023\347T|\212KA\372\001e"
+	.ascii	"x\362\276\236\253\367\004\242\252!\202\330\373s\332\271Q\317"
+	.ascii	"\254\220}\245\017cf9?\263s)\007\274/O\324\244\f\217\3227\265"
+	.ascii	"\331\367}\337a\200\370\250\201(G\225C3#\"A\322$Y\016\220\002"
+	.ascii	"\221!\243\362\021 =\307\020\311\220&\251\244\275\003eV\201\200"
+	.ascii	"\301`\177x?\343\215"
+	.string	"\037}\262\312\242X\236\025C\336\240\270hJ\351Q\240C\342y\005#\007'+Q\3516\324K3\rD\313)\376b\273H\310\240b\\\302\305\250\305\032\277\264&\226\036\035!\026N\363\211nI-\253\361\034n4?UHA\310\022\202\022\352\243\031\202`\231H\177\320\346\226\263:`\3009\305\325\266\231\023\330\t\r\345\2207\342\257\374\237\240Y\210\374*7\250\026\257\317\234bFH\026\003\207\306\tH\244C\240\270\031\326GX\203x\262\0079\236\300\252\332 W_\364U\224\\\352\335\231\313\302c\227\214\305\275\304\267<\370\266F\253\333\365\b\335g\227<\247\234\022FOL\305\303t\225\342\256\232Sj\221\274\270\200/\363\375\366&\205!\365sC\322\277(\351^\264\326\203\204\b%W\253.\367\370l\006\002aT\035Ug\362\t\036\247\243\260\r\335\032:=C\020\002\336\3223\002'\323\242\001\250\035\247\013\200\342Q"
+	.ascii	"\250\002(\001[\0068\336,5\222X\r\310\370\266\037i\r\\D\364\023"
+	.ascii	"\2528\343&\326\350\347\250\364\224\275\024\320$0\2473\363\241"
+	.ascii	"W\213#\335S\352\224 \237\324\341\214\021C\304\277Vh\321;\367"
+	.ascii	"y\\l\b\306\031=\254^H\300\f\343C\024\030\224\200\343\002\364"
+	.ascii	"mB)\240\261,#\364\375\232\026[\305\001\351\251\374%ud\312\307"
+	.ascii	"\315Ae\324\001?\3439i5Tc\260x\351jo%`\005\313\337_\345\3259\321"
+	.ascii	"\303\304\013\026\305\373\231Y\212\026!\t4\224\372\335\200\247"
+	.ascii	"1yx\314\005LW\271xL\313\320m\002\025\013\220\200\037X1E\316\221"
+	.ascii	"\237\353\375\2206\352U\216\3218I\036`\2664MbF\r"
+	.text
+	.section	.gnu.lto_smartPortSendErrorReply.135.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`8\003\335\025"
+	.string	"&f\207J\260\022R:\013o\177\342\2343i\260\003\004\234\350\352\272\373\332o\220\021J\371\271\330\177\370\301\273S\364\366\315\247\2466\344\253\2631\376\206\367\210\252[\226\315\300\007\037z\245T\017\217G\330@\353\006}\275\266\241}tn\273wJ\001j"
+	.string	"q"
+	.string	"w"
+	.string	"\013\342*\232\236xV\257\376P\216\375z\375\313\216E\335\305\203p/o\256\273&\244~\273k\342\b\"\257\003>\"\276\316\023\020_cK+s\3321\025\334y:\246\273%\214~\273\245\211QD^\215\263{\274\334\355\217H\364\024Y\355.\214\2428\356\023\347_\350.\235\317\316'\200\226\335\365\324\371\204\270\351m/\260\rc\323\025\0010h>\320\2537\324\346u5\361\225\016\321\211\310\315,\337\367"
+	.ascii	"\300\026P/\272H\025\213rH5\351\211\356\226\334\274\362\b\225"
+	.ascii	"p8\265\363\312.y&=a\277\265\364\307\256\323\256\363\376\326\313"
+	.ascii	"\177\316\351\013x\325\317\352\307-\310\356\207,!\373T\221R\370"
+	.ascii	"C\367\345\274\347\027\311\034\275N\324\332\335\266<\f\203\274"
+	.ascii	"\006\257)#V\346<Q\316\313\333,\0038f%A(\307\310\314\353\234\240"
+	.ascii	"\003\335q\213\236\276\007\353\300\357\027z\f\225p(\314\375&\336"
+	.ascii	"\347\231;\335\232\020\354\200(\271\350}\246p\246\nK\327MQ\027"
+	.ascii	"\245M=XI6lJvW:P\347Apw\035\274\326\230{3Yx\022\022\215\t\f\202"
+	.string	"\332yu42\b\356\346\256\363g\334\210F6\316\353F\361\365>c\270\f\033\003>\337<\306\214d\267\273+/\036\027f2j\024\226\261\206E\245&v2B\322Hr\254\226\235\330H\032\216\215\244\231\325`7\3226\316\306\f\243\r\246\301\206f\006\223\2215\330\211\002\323pF\022f\243\321H\330\253\314\275\265\364\307\265\3527\024\346(\217\177\027\321\237:\225\213\017d\b//\242\323\215\002\363\275\013\307\024\037\357]\212\307\314d\267C\002\314t\002r\370M\264g\256#\n\211d\236\276\367\034\023\246o\036C\250q,\247\020\023 \244* \221\t\013\222\244\003\240\002\021*+\017\020H\247Dd4M\007eK\245;\337IN^q\t\361\253TknW\306!\324\016\2420\206O\232N\220\336E\374\n\021t\322\"F;\323o\233\356\274\277\336\333\270$<\265\032\242\023\3507\034\317\235B\013\221\2764\210(\3515"
+	.ascii	"\262\b\224& \032\301\266\363\267V\332\262?\f\266\200\rlhM\246"
+	.ascii	">\b\003\177\035c{\203\202\374\223\017\311\303\301\006/\250\221"
+	.ascii	"\027\250\323\303\243\207K*\201\313\254\340\246\013\332\251"
+	.text
+	.section	.gnu.lto_handleSmartPortMspFrame.136.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`u\013-:"
+	.ascii	"\232_,\025?@\350\316\0300\374bZ\256\370\034\315\231y\004\214"
+	.ascii	"\231\215\343\357\246B\261\304\3128\035f\2020\002\307\321o\344"
+	.ascii	"\354*\354\242\025\"\335\217\212\252\002\tM\367\230\354z\034l"
+	.ascii	"\253\273{\345\226R\246\224RF\001'\001B\001ST\250\270\353\270"
+	.ascii	"\3150q\252\212\335\211@>\031m\257\335c:\256\311t\231\246c\242"
+	.ascii	"\224\240\351\323\237^\333\227\030m\257R\212\250\230\347\272T"
+	.ascii	"\267L\352\222a\370\343k;\364\"LN\217E\021\270e\322\353\350~\005"
+	.ascii	"\342\203EE\333\353\024\032\325\024\005fK\227I/\251K\304\002`"
+	.ascii	"\232\266C\256+}\320+\233`\2515\252v\346nk7f\277\365h$\327M\323"
+	.ascii	"K\343\272\322\b\034\325\366\312\322F\262\275\266\255\304\366"
+	.ascii	"\312Lf@-Us\033\215\23102\207\\\327\205z)LW\245\315Dgv\022\322"
+	.ascii	"\361\310hT$\016\205m\220]\325w&\267W'!M\217/tM\315\217\300\030"
+	.ascii	"\325\t]\200\334\365\013ES\211t\206\2644\033\364\314\215\330\240"
+	.ascii	"K\274\250>\\\0318\375B\233\250\030\334\276\2541q\"\202(df=\224"
+	.ascii	"j\222E\350l6\250\022oU\007gt\214\364\013-S\221w\240\374i\272"
+	.ascii	"F\300\006\235\342\301n\2325;\034C\322\253q,LM\272\256K\034\373"
+	.ascii	"\341*{%\220\240'dS\372U\007|j\n\031\307\300T$\021+\317\246k\027"
+	.ascii	"\033\373r\017np]\227\3759F\326\254\324\314M\202\231k0\017\263"
+	.ascii	"\004\375\354\225\231\324\374\212xs^\006S9\277\377(w/\331\247"
+	.ascii	"\207\021\327\007\314\023\261\343\311y\372\226\256\315nX\247\177"
+	.ascii	"\372\336s\002\272I\360\rw\324K\326\351\023|\357\205\2259\036"
+	.ascii	"\033\247o\271\276\340\244\331j:,\231\324\252xw\261\275:}\357"
+	.ascii	"\211-iz '\277\247\235\374Vb\r|\362\375\317E\324\367=\327\311"
+	.ascii	"\246\2306\360\007\276\t9\267|y #\025\345!\352\253\3533\035\272"
+	.ascii	"Z\327u\253\274\247\235\301I3\314\0266,\007\316\336\246\353\024"
+	.ascii	"\210\362\020\365\271\256\210Y\352\345\037enNTH\221\033\177\032"
+	.ascii	"s\324\202\266kV\320\322\346\247\206kN\320r\315N\311\236k"
+	.string	">\320o\335\006\232\212\316\002\214\234\003\f\235\001\b\235\231\204\316\310\242\363R\321YI\350\234$tF\022:\037\213\316GEgc\321\331\250\350\\\024:\023\205\316C\241\263\260}\347 \321\231\035:\257Bg\265\247\315.tn\013=\227w\306\344\312\335\357\221\272D\002\027\271y\353\232+m\327-\355\206\353\226\353\236\353\236v\353Ag}u\325\211\314\035H\021\313\366\370\276'\266\004F\233\247k\222\366f(\346u\343\370\027\030#;\251S\370Q>z\343\373\210\353\223\340\217^\375;2z\343\377_X\031\204.\276\321\267\363\214\370Ew\267\210_\200\313\200$\256X\033\247\207\357#\216\017\340\360\227\326\312\362^\264\340G\205`\376\206\264\311o.\201\200\353\202\367\027\343\n\357\234)\354G\333\364\242&\302O\204\243\313\315\263\257\251\276\360\277N\030\222/\263\3403\203\350C\206\n\261\317\3557(\370\255\340\331W\357\302"
+	.string	"\223\b\032\001@\317u\233\375\344\016\324|!v\214\030\301\226\350\275\256%6\321\177\252z\365\343{O$GR\260\314(Z/\305\236\351;\366\272\317\254\242\365\2540V\340\306\323yXpW\351\225\261Z\264`{\365\273g\237\372\353w\030 \367\235\016\313V\255\263`]\360\276\347\334\362\025\250\340\333\256Q\330\351\260,\360\n\336\357\304\226\364\335\024\363\255\247\335\345\304Lw\020\274\277\006I\314\242\353G\271"
+	.string	"\333\337t\335\276\307~vC\357\032+]\350\324\003v\216\376\240\0374\263\325\225\367\223\223?\336\213\213xu^w\311r\277i8K\356*\234\243\313\003J\0364\266\\d\261Y\035\343\206\362cX)g\2508\224[\177\003\213\306\226\226RG\220\243\250\2242\250(\310\230\222\200T\332\260\322\222\341\"k\253\345+\t\\ZXY\\ZV6\266\240\272\264\270\2246\2245\224\\P7hX\331\200\272\322\332\202\222\200\200\261\262\224ZP\\XXZPDv\373\323xC\363\277\336\222\032Pi\321N\271\302\314\002\206&e\304\223G\351:O\343\340P\252\f<\341\302\364\302"
+	.string	"\217\031Z\0165?<J\220\256\240\002\036B3[]\005x\001"
+	.string	">"
+	.string	"\253p&+Z3"
+	.string	"\257a\355\255\351\201\201J\376\230\274\234y9~\224\231\036\3710\2220\335@2x\025A"
+	.ascii	"\324\006\350h\220\221%>H\323W\220\320\357\314\315XlzV\211M\337"
+	.ascii	"\266\017#\216\017\203\027\217\212\321G\371A/}\207\361\256s2\016"
+	.ascii	"\004\306\252&\250A\231b\230n\336\317\245\377\351\313&\017\354"
+	.ascii	"\275\032\217\0378\272\342G;\315y\344m\030\365\254\262\376M/\306"
+	.ascii	"\337\364\036\350\200y\242$\276\227M\323oh\266\352&]\351\273\316"
+	.ascii	"\205p(\262\t\017RE@\317\305\330\303\207\343+}\337\205\001FIu"
+	.ascii	"\323G\275J"
+	.string	"\306\271\345\013N\222\003\351g\037\322\037?\351\333\2358\220>\200\375\250q4\006\221R\210FDD\222$)t\200\002\021\241\252\352\006\0210\271t\350\244I\322f\231\237\204\221\034}A\036\272\024\0215\006\250\373\314\265Fs\242\004]EIA\374Bg\362?K\205\264\366\314\236\306\r\241\b\221n\033C\260\321\234c\301\034\304!G\007\272\201\373\032)AE\334E\241\3228N\331y_\225\035\253pW\331\351\233\373\3519B\0178=\224\351M\021|\013\377\346\230j/ae\2452.\030?\034O0z\213\367\355\370HR\222F\303\243\016\340$\255\367\261>]\201\301{z3\340\036\314\221_Zz\277\352\270G!\311\331\304\025\234\267\2028\203\301Fi\213\342TuH\025 \205\"\004\350j\346 \253\264\303\375Z\t\375\307\335\210\2400\0019\213\2243\260\307\376\033\020s\373\231\250\341k\005\237\027\225\313!\231\220S"
+	.string	"\223\244S\211\021Fq\235`\360\032\245~\330\227\350EYFh\"#\247\177\312\216U\217d\232&\242i\245\177|\303\347\264\177\376kz(\350~\250\276\363\034\227\352\242\224R\361\346\nW\024\2631S\201\013\340ujY\365\212\324\311Ro\253\271\252\033D\371\bN\371\030kC?s\264\3020\354\027\354EJ\275\326r\321\2114U\366\345uE\343\212\260\315\345\314\263\024L\262q\n\351K\237\266.\223\303\177JD\227!\316aU\021\364"
+	.ascii	"\326}\256\030CY\245\003\231\0307;\304i\313\342\023\236\307\362"
+	.ascii	"\225\342u\0235\367\241\3004\031\361\313\213<`\302%\307\225\030"
+	.ascii	"_`E~M\362\314\202Y\252\r\377\206\017\344+\366;\341\\1\306BE "
+	.ascii	"\306\247\344{\277\317\300\337A\273\213u\2004-\241\177n#\324j"
+	.ascii	"PRM\346s\204\363\f1<\021h\317\001\332Mt\323\233\030\310\200X"
+	.ascii	"`DH\001\362\246\rr\004\374\257e(>\317a\324"
+	.text
+	.section	.gnu.lto_handleSmartPortTelemetry.137.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`U6E\303"
+	.string	"\n%\035AK\020\020\246\355\214\001\227\"\276\033\353\f}G\023-Iz\004\021<U\"1g4NoR[\310=<\013?\342r)|\307\224l=\323\263\306\013"
+	.string	"\\"
+	.string	"_?\363\374\355F\313\300\202\r.\030`\f"
+	.string	"\230\321\262\240w\310-SJ)\377\003\312\003\373\003\\"
+	.ascii	"\3239\204\322"
+	.string	"\371H\351\fB\310\371\003\323\331\203\322\271\203\322\231\203\322y\203\322Y\303\322\331H\351\234!\310\271h\351L\264t\036\002r\306\260t\026Z:\007-\235\201\224\316\314\245\363\217\217\363\322\307\331\207\351\334\303t\276\260tV\3728'\231\316<?\316\255\322\031\371\343\314.\235\337\307\271\235\252\203\033(\240\030\262\276\177C}\235<\336y\377\220U\024\232M\267\265{\374\202\367]w\265{\257[L7[+\231\333E\223'\006\344\036\027N\254L\270\256B\267\327p\263\351?\356a\247\323H\253\300\275B\373!\361\326\334\361RS\323\247\024}jo5F\272\017\tK}\263\272\220CH6\222\357\350\t7\302]\f\306'\2457\237\221\336\213r\352\213\325^\346\356\250,\032\231T\305\353\274N\223\224\207\246\365\234\275\027\325\257\364m*1\263-G\222\215\004\3625U\"K\260\230\245\025\276\357+%x\207\344(\t\365\315\272"
+	.ascii	"g\345OH\322\316\b\267\231\256SzR\307}\246\347\2144]\221#*\352"
+	.ascii	"KUc\356OM\361}\261\240\222\215Lj\225\274\236\230\333\f7\231\226"
+	.ascii	"3\322e\216\260\257\026\365}\3024wUS\354AM&\275=qS\271\307pO\022"
+	.ascii	"\231\027J\316\026\323\3547\3726\261\220\021b\220\3547\346\036"
+	.ascii	"\026\241\251\034C\013\361\313\373\276=\215\344v\023\201\271\247"
+	.ascii	"\221l\267qO\222\227\247V\3535g\263!\351\367\311\333J\024\311"
+	.ascii	"\324\024\276/UE#9)\331\310\243&j\033\3116\206\266\221\354d\036"
+	.ascii	"l\252\330kD\266\202\325\030\305\367}\221\336\004\316\343\344"
+	.ascii	";\233\321p\036W\031\217\357\330\216\353\230\216\347\370\f\233"
+	.ascii	"\3412,\307d8\216\307\260\030\206\3437vc*\216\033ML6j\320\230"
+	.ascii	"!cI)\006\214\027.\222\220Z\260X\241\"\005\212\023&J\220\030!"
+	.ascii	"\242\200\020G >x\350\300a\203\006\243\fEDC\030\204\202\200\230"
+	.ascii	"?K\237\236\013\312$\017\353\265H\366\335\311M\325\214\246C\030"
+	.ascii	"tK[\227s\236\006W\2644W\361\262\2149\337\2119\333\325y5\323u"
+	.ascii	"\b\203z\025\205A\273\234\347\334\234\341\311\232b\3461\256Ls"
+	.ascii	"\3055:F\t\273\302\325,g\245\312\326P\030T\253\365qcV\005\312"
+	.ascii	"\205d2EaP'\316q<\246IQ\030t\004g1\035\302\240L\212\302\240Y\234"
+	.ascii	"\341\022Xt\303o\322f7){\304N\t\203.q\246*i\034J\036\375\206c"
+	.ascii	"796:\323\235\266q\207\321k\330i\032v\026}\206b\313P$\364\245"
+	.ascii	"\301V\032\224\3431\3424\2148p\374\205`\273\020\f\364\244k#]\331"
+	.ascii	"x\2135\315b\215\237\257P\323*\324\364y\212\025\032\305\n|~B\205"
+	.ascii	"6\241\202\235\227`3\205\304\336\b\277)\"\322\264\320\2103?+\273"
+	.ascii	"\002B\224\361#\020m\376\301\303\232w`\243pH\363\rCaW\262\264"
+	.ascii	"\006#\036\247\260'`:\303\027@\024\274\210\213\023\261)\n\361"
+	.ascii	"\352t\b\203fa\211\234p\221\236\340C_"
+	.string	"f\350\346\316\260]\325m\t#\327aXj-[\007\n\337P\0304\313\022\203\226\026\322\222\305\203\332\263(\320X\031\226\2303y\234b\230U\261\262\213\022veK\377\260Mh\2468i+\326\027\353Z\002\347t\232\016Q\206\345\345K\021Z\332'D\330\023\256\356aaT)r\371\330\261j\323eXV\374\202\025\213\213=*\303\252\342J\226\247\312\t\227\266bm\2613\354\024V\273\315\312\223]\302\023\255\346\351\247V\263^Q\030\364\204vJ#Y\022,\\\211\263!\352,\213ak\316\315OV\025\273\302\215Y\225~k\277\312J\342\317\246\360R\023\245'\013\312\022\261p%N\2675\313\025\006\335\342\316\343\364\276/\2734\353Is\005\315\334\3321\363\022f\2449\001^.}Q4\022\311\263\257\227;\362\017,\353{\207q\261\373\256yp\240\230(\364a-5\354f\013\364B_@\237!\360\020\311;=1"
+	.ascii	"ui\023m\357u\004l\270\262>\210\371u\033:P\264\b\375\224;\252"
+	.ascii	"m\256\227\352\263r}\3575\017\260\2473f\340[\316%&\256\357\233"
+	.ascii	"d\006;\025\327r^\261#8\235\264N\270\236h\254\372\363L)\315\254"
+	.ascii	"#?o\"\220\257\314\265\204\275 <g\322P\332\254\313\317B\224\032"
+	.ascii	".9\263S\212\223\212\267t\371M\266\026T\006\006\006\344\363\037"
+	.ascii	"x\223\037[O>rn\322\372\252\304\325a\236Y\273\331\262K\375\252"
+	.ascii	"i\345\310\221\266\221#\256t"
+	.string	"\236\376h&\024\025|\376 i{^\nn\315\224\277\360=\357\215\321.P\177\274\360M`\3204\035$\347\206L\016\t]\024\227?\365q\341M\365\250s,\371\276\317\226V\261\363\313I\302\325\215\024\344\232aW\317O9\251\233\255\362?\200\013d\347\025\247j&\337\367]\342~\364\3279\345\336\322Hv\232\340\034s\216\265\215T\376\207@6\237\270\257\302\306\021bt\0269\\\305q\273\360\323k'\377\003\343\017-O\311\367\031KT\"iy\376\303\300\241\360\026\005'\231\267\224'\261\375\237\261\242B@?k\2343\200i\311\022\216<s\242yK\031\331r\200s\f\277\305\210p\366\231\235i\3165\303?J\362T\207\354\027\005j=\307t3\211\353*\\4|/)H\301\360\374\224\273\227\250\360=y<\026v\244\212\356\267\226\340J\315\312\216]q\245\242\273\357\265\230\204q;\004l\177ZCL\236\034\362\261"
+	.string	"\372\365cO\320\002~G\275\240\376\310\\\276\255\034{\260\t#p\266\345\310\221\3027\335\030\r\265\252*l\373h\033\354=L\260\341\370\320\201"
+	.ascii	"\002`\3773\326o]\201\242\365uF$\032\230\342\341\t@=k\225\311"
+	.ascii	"\235\231\347\037m\277\006p\202I\334\016s\273\3517?\270\267\260"
+	.string	"\002O\336\322\247\266\221\375>\201ZO\177\344\023\200kV\266>z:#op\346\035\017xK{\312\267\031\030\364\251.\304Y\241.\032\276\316\310L\205\372O\231\233\357\224I\371\342\307\302\254\230Xg\351\334\210tZLs\033\002\376\371)\235\273oO\017M^\025\357\316\256\216n\356\214\2312n\3246\2665\265\2640`\276\240y9\313\340\334)\02497\227\037\347\006\373\352\275\346\346\nrn*\315\326\334S\332\332\334L\372\256\271\257\244K\224XE\253\222@\237T\375v\265\331\331\325f\267\367\232\221,\235\023\300t\026A\351\034\202\322\271\271tF\200\322\371\210\322\031\204 g#K\347) \347\"A\316RKg\"A\316C\230\316QL\347\017\230\316B\230\316A\226\316\0360\235;`:\003Y:\037`\351\374\203\310\231\003\2463\024\323y\203\245\263\017\246\263\006L\347\036K\347\f\226\316\030\f9\033\200\351\\"
+	.string	"\2463\001\226\316\0270\235\007\300t\026\300\3229"
+	.ascii	"Kg\013\206\234+`:\363`:S\260t\236\200\351,\001\3239\202\2453"
+	.ascii	"\004K\347\007\206\234\001\260t\336\261tv \310\271\001\037g\006"
+	.ascii	"|\234\237\230\316\013\0049+\260tN@\351\214\300\322\371\200\245"
+	.ascii	"\263\216\245\263\001L\347\034Jg'"
+	.ascii	"\2453\216 \347\033J\347&\2453\023\323\331\206\322\271\206\322"
+	.ascii	"\231F\220\363\f\245\263\f\245\363\022\323YI\351\034C\351\f#\310"
+	.ascii	"\371\205\322\331\205\3229\211\351\214\244tn\241tf\201\301y\005"
+	.ascii	"\323Y\205\3229\205\2173\n\246\363\t\245\263\t!\347\022A\316$"
+	.ascii	"\230\316#\224\316\"|<$\374\222,\335\311uC\277\357\370\224\270"
+	.ascii	"\300h\273g\366\0054\361ML\003\215aw\342\371m\247\007\003\261"
+	.ascii	"\211\213\256{f\223\236R\257T\336\363E\335\020\325w\035\236\213"
+	.ascii	"A\244\246{f[P\375\325\213\351\256\343u\332\250\222\350\372\375"
+	.ascii	"\246[Cbc\321s\317\354\n\347\367\373W_&Z\005\276\277\336\355\337"
+	.ascii	"\242\256\270\323i\333H\005\336\304\230\3263\355m1\307:\277\347"
+	.ascii	"\320X\374\264+z\350\245\242\317<\263)\334w\006\261Ag\316\025"
+	.ascii	"g>\254\335\3573f*~\312\036\242s\034Q\264\231\317\020\235\303"
+	.ascii	"\345D\227y\367\257\324\372\375\007\311\334\357j\212\237\362\212"
+	.ascii	"6\363\257\027\365\202~\241\360\3206\342w\232V\226\301\t\266\207"
+	.ascii	"6\201o\304g\267\322\n\3234!\201'\321U\346\273\332G\317:,\004"
+	.ascii	"\276\313\274\037\360\b\240\035\360 \306\264\344\006\245\2348"
+	.ascii	"\363p\2453\230E'\347\215\211\237\362w\263\325\361]\366\250\343"
+	.ascii	"\313\034\254\rx\035\337\245\351\301\021\003>\303\230V#\031b\211"
+	.ascii	"C.\2059\376\007\314\351s\340\370\246w\272\3618\262\214\211\335"
+	.ascii	"`\372\246\277\362%L\261\260^\333H&6T?\022}$\250`\343\177\260"
+	.ascii	"j\274\r\032/\343k\314x\032]\\"
+	.string	"Vf\374\b\275\3642X\374\226\026\225\2454kz#\362\244\334)\375\317\033\343\225`\274\213\217\361Ft\3210/\036\306\330gE5\235\230\226\307rOh2bN^\260=\3334\2216\351]<\022q\3053!rc\006\263\213\302_\271dJ\327%/u\315\316\\4\264\277\021Xm\013\263&\"\355\255Jx\360\005\351\201\250-\036\351\235\216\305\267x\036\304h\331\212g\361\r\346\241n\032\323\225\335\265\177\272mJb\215\344\177\237\312u\203s\307\214i\033\271\342\231\002\321\340\272\257p\316\n\370);z\340\245\342=\305\253Xt;D\\2n\2312m#S\274R\013NW\b\024\356\246Q\300\261\"\326?q|\324\305\302\243:]N\274\217\211?q\306\304\367\332\027\b6]bNa\t\301.\264f\247\017\203\035D\031\361.\342G\320\271 \021\277z\240k\207\347\346\345\265\215\024\361Jcl~\025\204\342\241"
+	.string	"\036\3166\222\226\331M\343\362yK\013\370\013\300\222\310\tfY\247\335\3277\217\177\035~\312m\352\204x\366=\372\020\236\246A\374\321\363\264\020\r#\201\237\313\306[\n\342{\315\257o\0209\270\200\355\007\026|\215\013\350'$\367\346\320\252e\303O\331D\334\032\027\243\366\373\022qkM20\371+\356[q\245\263\302\016\367\360,\026\263\021\367M\325Sq\207\367\360.\347B\263^\313\341;|G\313\240\376\310\341y\364\370\230|[5\370\265\237\236\321O\377\276\255\337\177\317\312\321\360\031~\303\363\370E\303\030\275\006\243o\306\242\317\320"
+	.ascii	"\034W\216\267\264\350\373\353\345\336\340\371\341\234\265\f\356"
+	.ascii	"\234\226\350\333J"
+	.string	"\350Uw\316\235\343\271\207.\242\233\350&\266\215$z\026?\330\204\256o\326\336X\355\024\375t\350}\034u8\263\313\3506zK\207\276\325\353\036\2731\210D\355\244j1|\227\301\t\272\217>\347\244J\276o\222%v3~\306\t\255rZY\265\215\304\360%\306\330\242\304\245\335-\032riv\242\362F\021V\372\352\206~\312C\3213G!\357\352\0263\333be\027\324\\\217\344\257\234\f\273\034\017v\013m\204\260\304\260\217\001\242\256\340\306\376\0066\330\345\005cco\3739\023\354\222\306\256\366sB\341\027v0<\330hR\3609c\367\222\304j\260\027\315\256\313\013V\306n\226|Q\270C\201\275\013\017j\030\324\302\332\302~\002\017\266\335\237\027\027;\306\236\005k\313_\t\354&\360`\322_d\325\177)\252}y\301^\024\216\205\231\007\037\257\005\252\016P?zL\005\211\252\240H\017\016@\350\t\322\003\204\337"
+	.string	"\210\003y1D\310\024\273A\217\250 \315\036Cx\246\212l\360>\232\223h@q@C\211\203\027-\210\240\204"
+	.string	"\241"
+	.string	"\312\007\020\020\244\240&\230*\322\303\201)\251(\b\214\330G\213)\251\250!SR=\204\024AjJMA\t\201\n\0025\205\364\001\220\036B\220|H\025Aj\021\202\243\206@I!MEEI!\365P\237r\355\364|\250\034\005\tx\035\202-$\340\225\335$J\366\267h\3706;\301O\2574;\265\242\004\200\212\"\274P\b/\302{\363\217|\bo\324\210\200o\"\340[3\020\376\310\033\351E\313\214<\b\337F\f\023#\230\232\202\200\256\213<\262j\234Tl_\0212T\300\026\r\337\270f\247\007~\312,\237\224Z\273}2\r"
+	.string	"?\325\003qE\033C\363\332\361S\346\311\332k\240\321\236'+\312@\207\371\366\321\313S\257\275\213\241\rZ\331-\320\324o135+;\005\256\376\212\355fK\344\333zF\204\255\002\331\361D\f\315\334\242\276\335\376\215>\370\250\035\377\301\325\220\314\372^\275\3233J\2677::\320\205\346\345\205|\243\005y!\036|\220\327\200hW\347\201\025/\035|{\001\362\035\034\340\201\374\2061s\315&s\006\307\001\276\311\214\031n\235\375\370>+\323\35481$\217\254\234KE\306-s\2417x\264\215\374\361\0357V}\262b\3301<\252\\\227\203\277aH\205\253\245\2424`\b%\f\230\207\372\016\263\301C\371\370\r\336\334\336|\030f\201\321\340\033L\217\327 \203\357\321\326lb{\313\340\361\013\006\337_\324\226\260io\030\2001@c\225\216\262\303\300\342\232\332\027\340{\215"
+	.string	"_\200\013\236"
+	.string	"h^\252\027$\252\r\340[m\254\005\360\003\b\300\013 \205f\223Y5"
+	.string	"\210i\026|\247\2215\231\256\330.U7k\311\002.\025\034juT\341\323O\345\b\331Py|SYiS\360<&x\n\336h\214\225\343\223\335\242e\002\277\266\266g\365\242^\311\b^\202\357\350\035\b>\2027b\301\2125\233L\220\001\3017\005V\373\330\276\357\036\370f{\226\2356\231F`\261\270N\222\354\025\327\352f-]\267X\3206\362\201g\n\254>Y0\226\004\013\240\270R\244\264\215\004\300/\005j]\t\371\330)\035\265\367\307\200z[\013\374\224\331.f\275\036\tFj\205\237\255q\213_M\261\013K\205\177-\204\023U\03348\205\254\024\366J\212\275X/\365E\321\272#\013\005\310\221\035\257\324{\303\261F\005\362\332\201\357A*l\026\213\345\300\267\b\314\343i\223\307\230"
+	.string	"\333$\352\256\247\3041\026.\026\026a\3377\fG\263\351.|\363G.\342\315B\0131\240^\343Zq\273</\315\212U\202d\253\024Y(\233\244Ec_\226\212u\224\363\345\3167\"\317\026\337\316'*\"~\035\326\214\337\360\017\2750\316\227\301'|2\353\313\326\374p>\016\037i\003\025\337\374\325\277\254@\355\241m\323\202\324\360\311\302[\335\257\217\362\346\013\377\337\263P\004)\306\215\342\373\276\335,gM\303"
+	.ascii	"\313\353\262\276k\372\317\375*\022\223\366\232n\002{n\335)^\310"
+	.ascii	"\333\262\276~\235D\334\002[<T\323\316\327\366\202s\354 \300\300"
+	.string	"\367`\277$0\360\315\247\022\256\035\360t\324H\332'B2O\241\373J\370\365G\345\215:\270\344\350\275g\326I\372W\204]|QU\026\370\344\273\300\226\324\200=\020`K\276\367\244\344Xl\202\243\365\236\331\033K\350P\351\020BY\342\244\307\274S\362\255G\230\205c\260\251\321<\263LJ\250"
+	.ascii	"QyTr\003\r\317\325\352\033Mc\023\233\215\316{fkX\r9\032\302h"
+	.ascii	"\305\224\367X\321\357\274D\033\211^4\272\372\314\316\2106\300"
+	.ascii	"6\200\030\255Qm\271\252\357\352!\rG\031\215\367\314.U)&\025\347"
+	.ascii	"T\315\370)^\233$\337xld\324)\365\3353\033#\t\211\204\244\250"
+	.ascii	"\303!f\361\\\216B\247\324\210\210\214$I\2065\303\027@P0(,\232"
+	.ascii	"\005\255\305\007\023\200N\312\343\320T\217\362,\252"
+	.string	"\031\023\027\2065AC\264D\210~0\270\354\333\f8i\245\205M<\223\316\236\016\234\327\262o\266\311\311.\312\363:w\301\263\266\210\320\272@\032\272\320\310v<\255\236\322T}N8iFf\300\277\b6\374\317\304\033#cF`\337C\230\004\235\377,\2670\")Y~\367\330\177)\333h\r\206\346\340\361\375\321\013^\266\247\375h\032s\310E\361\022\313\230F\3360\035\303\350\240\261\211/#<%\320\211[\275\360I\033\224\305jc\204\366+;\337\227\002\241\267\"F\341\207\336\321j\350C\032\347,{e\372\262\252|\007O\273mp\326(rq~\246s\257\202X\016\3406\367;\214\201UH\177\255\265\361\025fC\325\036\265\330\n\035\207\357V\270\221pF/\033\0067\300\262<\t\004\035\017\023\320\365\322c\336\257\371\253\264\204\267\301\334\373\332o\243\037\356\t\211/k\351DG\354\363\232\001\263\311\213\235\2545"
+	.ascii	"\246@\b\357\322\242\276\354\022D8\352k\317F\177\350\311\217\376"
+	.ascii	"\346\327\331\"A\022u\177\213e\264\340\023\364\310~\376\214N/"
+	.ascii	"\245\274C\026\216\255\250Cd\030\306\312X\021b\336a;\375\216f"
+	.ascii	"\371\314\365\201eV:\357\r\336m\233\r7h\314n\251\262\230\341l"
+	.ascii	"\20174f \005\356\227\214\311\0070.\325\036\023\004j k\247FT\033"
+	.ascii	"\322\037P\244"
+	.string	"H\210\217\345\2423\227\032\237\001\030K\035\256B\277M\002\\5\374ic\022\326\260\215\3568\3671\271\345\262_\246\347\212\201N\3474t\233zk\345\251\006\224!\377\323+\332\266\242?\225\231=\2563\302JL\321\214\372\r\216\327N5NQ\354\307\303Xd\223\352\214\263B\340\262n\034\361\031\310Dk\264\331\nJ[5\021\355\225\003\037\227p|\nV.\032\362E$\205\203\211\213f\351\317\210\226\200^:\223\337K>\347\275h\031\314\305\253\370\263`\2205\372\\\264t\177\3750\321\205Y\276E\376p(s\275\225\2121Ry\302\312\230\032\b\230dT\277\333\371e\200iLo\217kP\3539\307%u\354a\330\"\247\2602\356\254t-\360\030\247\302\020\326@u\375_\346.Y:u\346\036\034\013\214\203\2551~\357\375/&\233\370\002\037t\244\3514\204\3302(B\275\370j\026\264^\307\031GcG\233\315B"
+	.ascii	"\276\330J\343\356+(\253\253\027>\356\007B\346\3534\314\210\302"
+	.ascii	"\377BqU\241\362#\200\365\245\266\354eq\277%\004e\317\f|\200\340"
+	.ascii	"6a\214\254\371\205Z\253<\315\212\225\262\236\217\b\2063\365\263"
+	.ascii	"\017*$\030f+\227\303\227r\246\204\221O\032\200R\253\257O\024"
+	.ascii	"\246(\270\210\007\345\\\006\265\244\225\347);,\262?,"
+	.string	"\230\300\031@\246\346i\"o\031\303B\22197PB\346p\352\027\274\304\367r\260\302\257\362:f\331}\365 \247\036?S\342:\235Ev2x\256\266\350W\275,|\215\320\271\017V\324\341\r\200\350,\003\326\267\324\324\036\360\355\326\364\333\364\2410\033\373\331z\304\334\324\336\fRO(A\2253t\346\206Y\340%N\341\3033\251f\300\177\374W\257\243\211\221\211\333\031\326dy\355I\002\366\273\214\033?\2621`\263\202\317\215Y:\365l\316J\262CL\204\020\237\006\235ev\210\342\256w\247f\035n\\\326lVY\335\213\232\253\317\213\324,#\361tc\274\205\274T\347\374Q\322\346\030\246\357 fHT\331\210\206NW\333\277\230\235\260\313R\r\301\317\344s\201\017\341i\016d\261\343\002\351\337:f@\330\352+\262\243\351D0\026\360c\302\331\200e\240\332\372\332\370\347\252i\232\336\266|\236\200\276k\024\"\016"
+	.string	"8\036\253w\217\354-\036\r\r\315\320\236\266\302\004\312=c%\007\301\251\251j\321\235\230`*\020\020\023\206f\030\265^\302\233[B\t\341Ex\022\302\363\336$)\242\216\f\225\341\224\"_\344\306Vi\022\313\350L\376\261h\357\244-\205\016\t;\036\346p\325\211\355@?\253\n,\255\177\273\362\006lE\035A\212S\037\270\335\f\nLn\343(A\367\255\264\017\020z\025f\271J\224o\361.\325\\\260\332\256\003*%G\225\330V\246\257\211\213\330\345\204R\305\215\020v\263\t=r&{4\235#1\274%\177\371GJ\244h\357\034"
+	.ascii	"R_\223\320\244\032\302\207R0\333\2262\177\023\340\245*r\316Z"
+	.ascii	"\341\360\020!\353\241\302\026\n\352\310\251Fv\232\274O#\207Y"
+	.ascii	"\276h$\263\244\205\376G\f\313O\370\" L\307\202g\300E\271]\212"
+	.ascii	"\240\204\004\006\335\254E\304\255Z\215\340\334\251\322\256\243"
+	.ascii	"\375LQfL\302\214a.\275#\303\262\f\016\221)\2642\273\324\301\352"
+	.ascii	"\272]^\210\"\363Dw\326\3628\023(p<P\312\006T@k\272D9\365\311"
+	.ascii	"\213\262\310\207\001\270\334\f2\274\332\261\211"
+	.string	"\205\2757S\237~\006\271\001\363\255\37682(u\364<\262\336\210\004*HE?\255\345\250\273\327\226[\302\306\354\231\374\027\236:}\353\334z-\322:M.|K\307\033\306P\214\310\036=\273f\030\031\030\267'\351\266\224\347\245\220Arc\3366\320\245\256\200\356\212\306\240\t\364\201Z\334k\263\336\222\260*!\027+\024n\260q\230\241i\212\02403B\273]1\344\320\267\007\222\336\235 \330#\337\007\275\233`\344\336\337\020Z\245\016\261@Nr#\034\353\271d\375\367\245\330\304\335H%\324\2564\215\301I\234\337m!/F\336^l\024om\031\350\305'\215n\312\204h\346ni\234\021\3215\265\353u\370\342\355GF\256B\203\323x\020\\s~\3105\007\356\240\317I\262\023U\222\227\332\266\327D\\j\"X\216\242\177Mv\354\244\320\221\242\030T&.\220Rs3e\321\246\b\341\317|\214\"\313\001\240\030"
+	.ascii	"&\027\334\033C(\366\034\374\026.\013\203%\243\237\212\270=\006"
+	.ascii	"\353\361\276\352#\221\0077\021\314Je\363\034\224+\255\235\341"
+	.ascii	"\347\033$\244\227k\207'\263\026|I\003,\024\370&R\2042\226\230"
+	.ascii	"\376\340R(E\2245\326nA\200`\350\333\313%|d\301H\253\265\035\204"
+	.ascii	"w\205\353I\356E\275\233.B7\026\236\245\320\rJ\022\325\007pK:"
+	.ascii	"\240\212JI\274fU\262.9\215\214(rQ\230H\230\324\204X\264>(\211"
+	.ascii	"\250\326\310[\340mp7\003\345\214\264\255\263\262z\223\362\313"
+	.ascii	"v\303\202\220\270>\002\204\313:\220;\211a\016\263Vv\331z\364"
+	.ascii	"\324\322\226\216\356\225\037\212\217\301'(w\212)\246n*\376\350"
+	.ascii	"\t.\035\241D\324\021@\257(\250$.\260\306\230\270\207\340\\\352"
+	.ascii	"6\337,&\225V\353\212\227\233"
+	.string	"m\342\234o\367\t\221X4\362\t\031\244TK\024\320(\"\353E\022\231\024P&\236\302W@*<\201\332\331b\250j\376|Q\025MtIE\204\305N\021*\357\326={\tR\215\361\316\266\021\001\210X\365\212\237\227\t\241\354\311\226)\221\202\t\3164ue*HAA\355F\343\352O\256\363jQ\226c\305\354\031,TE\202D\342\002\244#GGa9\251gr2\023\031\315\204\210\314D^v\"\253\235\022\225\317\344eg\262\332)Q\371L^\226\3238\303\001\256\0311\276\345\001q\036\262KWbl"
+	.ascii	"\313\300\345\301\267\311\203Q\263l\212c\231O\340\327\001\225"
+	.ascii	"mx\202s\223\3254@l\337\374\024\270\362v\312\026^\246\036\333"
+	.ascii	"=y\347\371\210\314l\2626\253\024O\016\345\264\275s\024N\033\346"
+	.ascii	"\205-\344j\211\322\322eF\262\f\355\215'\352<\027\212f\344\373"
+	.ascii	"a\221\033{\"lO\247\243\314\177\312\320~\325\r"
+	.text
+	.section	.gnu.lto_configureSmartPortTelemetryPort.part.0.183.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\250\001U\017"
+	.string	"\346ZbF"
+	.string	"\2216\035\360\326e\f2\330n\025\\"
+	.string	"#\255\347\262O-\302\020\nJ\317\261\242\001\371\314\262\f9\031\246_\263\310"
+	.string	"J\020\033\001\336t\245\377\253\365/\375\026G{r\350\333\375ry\1775f\246\355H\233\354\235RH"
+	.string	"Q"
+	.string	"P"
+	.string	"\207A\311L\250\314\305\r\r8\273\242\347\324\"\331i\310;\330\351\365\001\330\351K\330.\241\034\3328.\252\366-Z\030T\214\273[Og\210\207\237\362\n}\323'H\252\303\245\200_\037\240\335u\346\341\246\267\215\300\366g\177\f4\306\210\257.Q,J>\001\2352X\270fhF\023\343\252\210\236\025\227!\371\244\200\250\342\200\261r\\\260\031w\305zj1\233\366\251\314\f\223\236\302\363\003\fM\372\253\222\037c\315\245\303\2408DE\334\024\352\253P;Up\303\300\276\350\2378\2120,\247ir\347\005'\207%\302|\232\327\210&p\034vj\300\206\224A\243\306\337a\376\213\317t\276\bW\370\344WN\375\017;%\240\322\221\"[~\314\035\274\324\344\260V\362\220\323\305\363\372\265\273\353\331bS\351\177xH\004"
+	.string	"\261\273\241\325cY\002\226\360\021\031\331JF\026\224$\370t>\223N\004\216\032h&\371\200^7\002\275\020\367U\222\007n\334Fa\003\253\211(\304U\022\357\253\237\003\356F\233W\301\256\363\252f[~\266\030\2242O\236s\272L\337\3467\017 \204B;VX"
+	.string	"\244\275E\230O\005* p\2021X\365\021\npT\0177\370l\006\261p\240ft\213#\215\231Y\\m2\210\230\003j\260\224\375\034^\300\313\322\322\2441\253\360\236Q\304Z\257\273\223\004{a\357`Y\0078\251a\210\370q\344\366\200-\207l\245%\355\231r\2101\250\266e\346\355Y"
+	.ascii	"\265g7\252\350w\3651"
+	.text
+	.section	.gnu.lto_checkSmartPortTelemetryState.part.0.185.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`r\001\305\016"
+	.string	"\246\031_G\360\2606\035\342\214\254w\203\027\013\336\223i\2661\303\207(\347\342\347\264[z\363\241\314\333\210\215\324>\214\327\230n\376\237N\0312\237i|\177\037\330\f\266pW\204\356\347\356\370\313\314\224\217\217\372\025\372~\364&{\247\024G"
+	.string	"F"
+	.string	"Q"
+	.string	"\342\256\204jN\214\310\331\025\023\234:\304sz\030\333\252\226C\333\306E\227\275\n\027\206\231\234\335\335N'\210\207\237\022\013}\311bY}~\374\200\035\343\214\024,\031.\003\034\363 \331]{4\334\364\266\031\330\226`\277E+u\344l\361\304\216\355\374`c\322\367\370,\250\331]\331\321\261\036(\f\021w\375\366}\231\217\266\346\324K\230\326\210\261\273\232L\312\367]*_\264f\325c@\267\356\n\265S\005/\016\354\223pH$|\f\b\262\n7\222\346ec\222\371+\316\302\344\004\005%;%\340\362\351\360\342\2432\024\006nr\b\300\371\220\237\376\330U\220g\031\344\302\\\331\237\271\t\224\037\302\246\223<\353\224\235~~lP\221;\376x"
+	.string	"47lV\352D\340 \343\205\343\342=4`Z/\234\016\031\251%#\"%!\320\247\236F\034\004\nu4\201+5x\200\252\245\002\026\201>\257K\371<\216d\332R\336WIuT\277\255t\302\2216\221g\332@\b\334\245To\373\272\316\3334\333\362$*\323\302\234-`\346\273\370\013PTkvz ' p\002!Svi\363\257I"
+	.ascii	"\303\375\016\033\231@\272K\303O\307\261\330,\215F\034\310\331"
+	.ascii	"\342\217,\350m\354Fb]*\217\235\341\374\350\307\300m\230W\203"
+	.ascii	"+\355)\220\371\346\"\272\355\227\271\230\235\211|\210&\030\370"
+	.ascii	"\260\333\247\\e\372m_\001(\036z\n\365\245\327\2061"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\030\007\225\035"
+	.string	"v\260\257?P\252I:\244\207H\204\031j\343\007\2501\370\321U\2038\345\232\033\210\034\237MM!\345<\367&\021A\204n\311\033\372\342\2137\236\367\277'\366\240\302;\227=\275O\3063\026\216\210H\223;\311\231"
+	.string	"\232"
+	.string	"\245"
+	.ascii	"\375*+\372TT\334K\212s\2712\026:C\321\237r\242\037\245\232\350"
+	.ascii	"\237\265\304\267\220$\372^uD\337\254\"\026\022\031b\035\325\323"
+	.ascii	"\234\003\2427\257~\350\273U\017\373\210\\\257\016K\3673\317\023"
+	.ascii	"\345\320o\253\033v\222\206\257m\375\315\203\275\313\260\2210"
+	.ascii	"\\\215\274\260u\026V\022\311yyyy\025z-U\n\213\307`)\221\345V"
+	.ascii	"\"'\364\245T\t\275\231\352\302\205a\251\242\325\213\251\362\356"
+	.ascii	"Q3\270\215\310\335m2\317\323t\333\355\335?`\357\231\246if\365"
+	.ascii	"^\252\273\373D\025[\371\303\255\354t|E\373\";\004a\271\351\370"
+	.ascii	"\364\027twH\ba\371I\237\314I\177\330\244\177\206I\337lI\277\215"
+	.ascii	"\222~YW_\230\244\377\005I\277\313\221>\230\221~\226\"\375/\""
+	.ascii	"\375+C\372X\204\364\265\004\351\233\001\322\037\373\321\007\343"
+	.ascii	"\243\037\346\246i\356&\350\321\017;\217\247\3558\232\216\273"
+	.ascii	"\311q6\\?\303\36157\256\306\306\323\3248\032\032'\2223\016\207"
+	.ascii	"\\/\031\313(\306\332]Z\0133\003\243o\245\276x\031\027\027sp2"
+	.ascii	"\r>\206lq1\213'\311\322\033\213\354\343\b\267w\200\274#\035\204"
+	.ascii	"\005\\\320'"
+	.string	"\215\364\003r\024\372c(\024\353\307?\214\177\260fI\254\372\030G\361d\232!\260\352\343\033\350YnQ1\016\001z\206\033#\022Z<>\026\200>@\233\030\234\275\343c\247\323\215\312\212\233\214\177\234\232=r\252\254\230\253\202\025K\031_\313\342\342\b\232\252\342\250\343\331L-UD\241\212\271\264\fH \300[\023\b\360\211ZT\37448\305R\307#\210\202F(\353\211O<\007\237\030\352x\325c(\3427Q\240:B\254\036;\245\021z,`X\231\001\024\317lsvx\001\313\217\316\363\034\035;B\027\021y.eD\306s\335\232L\\r\2553\236\347\350\360jZr\225C\253\235\242\221\016[\332yfLs4\303\233\035\367\224\334F(\351\025\210\025\372\263zJv2\344\222\233\244|J\356*\236Ld\304\343\222\215\fA\213%\013I_\355\350\3366O\031\005H\317\335\026K>P\374\324\232P\350+\271"
+	.string	"znT\246F)X\362\200\342\311\267\2721`\311\214\374\310\321\311*Y\352|*\231-\316\227\333\366)y+X\262\222\263\007\344\256\364\n\310G\206/\320F\326\366\003\006\200\200\250A\020\304\303\230\210\314\210$-(\2441\300\002\251\"R\007\021\240(*\rB\022\210\0042\321\310\350\001n2\327m\257f\030ak\005;\233."
+	.string	"t\344\021\22143\342~\246\265\002\001OPA\360\346\224\347\215fD\240\003\306\263dO[p*\371FU&\273q.0\324hX \261\001\365\344DDG\201\032\3515\370O!e\372\244[:\026\221\241-\204\203Z\341\n\331\332\024*-#\311\232\003\245D\337\033\242\"\020\030\004\006\201A`\020\030\004\006\201A\210=\244qw!d?\350W\215%\261ln\262\021\002\254\347\0318\355\372\004g:\234\013\312\321\335\335\253\310\251sx[\325\3062\013jL\331cd~\246v\006c\270\205U\002^i\302\335\t2\177\002Y\360\311\327\037\325*\310\253\317\226KJ\016\345\252\202\027\003\257\323"
+	.ascii	"~\023*u\025"
+	.text
+	.section	.gnu.lto_.refs.e04479f24480c908,"e",@progbits
+	.string	"(\265/\375`\002\002m\020"
+	.string	"\206&oE\360\2566\351\270\022m\035}\275\202/~4Pjc\036\2407G\227\r\207G~\315WbV\016f\340\031x\006\236\201g\340.Y\372'\214\3438\036\016\207\341\202\231\342\377t?\337\206\217\206\326niM\255m\231\002V"
+	.string	"V"
+	.string	"^"
+	.string	"!n8l\375\232O\177\246\373-t\362\226\254\257xz\312\363'\236>\262\365\220\256\237:\271)\353\035\331oh\035\344\372\250/\312\036\264}\267uN\353ZV"
+	.ascii	"\030_`\375\273\362/\346\240\230w1\337b\317b\307\256\034\213="
+	.ascii	"^y\214\265\266\273\276\326\217\375\352\263E\032H?L\314\017\220"
+	.ascii	"\272\n\351S1'\001\273\b\370(R\377\210\277\021\363\213\370\037"
+	.ascii	"\260w\340s\327\003<_\337'\306\002r\313;@\236\321\336\215\036"
+	.ascii	"\033}\212\326\260\316\276\216y=\266g\317\260\2760z%\352E\276"
+	.ascii	"}=\363:\326n\365\2205\306u\353\353\351\025T}\004\264\236\202"
+	.ascii	"\365\022\354E\264n\352\344a\3479>\035\374\374\3659\357\373\203"
+	.ascii	"\345s\302\216\374\0238&\302\237D\251/\002\204\311&\314\247\361"
+	.ascii	"\350\313x\374\030J\235\305\364*\245/P\352)\217~\022v\223\216"
+	.ascii	"|$\354!a\007\t\273F\251\034\031\213\260\036\272\362P\314\275"
+	.ascii	"\330?1\347b\3276\266\017_\225\320\276\032\321\001\365U\215\326"
+	.ascii	"+\232\030\224^\275\244\276b\220\362\225\213\212\224O\024(\237"
+	.ascii	"'F\2378ZO\230\234\223\357\215\311\327f\303LIo\206\222\357\205"
+	.ascii	"\n\024&H\210\360\002\341\001\311\327A\203\221\357\002\005\"\337"
+	.ascii	"\004Z\257\013\352\213\200E\310\277\"E\316\207\321\357\001\365"
+	.ascii	"\313\234\3721\247o9\365\025\2207p\372\" \200\002IV\332\0015\274"
+	.ascii	"b\205\203\325\303\245`@LB\212S09\004\306\325\301\314!`\224\242"
+	.ascii	"0\226Q}\234\234`.=\266\350.\024?#b/h\2421\3170\374\320\002@\255"
+	.ascii	"\370Xzo\310\367q\rL\007-&5\206\021\353\240\001"
+	.text
+	.section	.gnu.lto_.decls.e04479f24480c908,"e",@progbits
+	.ascii	"(\265/\375`\f_%\230\001\212\242\352\224T \nY:\215\001\202\247"
+	.ascii	"\006s\345!x\"9\017\252\225y\243l}}j\333\f|\317)Zi\3732'F\255"
+	.ascii	"|\337s).+\206F\215\343\265\217\033((\332\266A0\303\2622\327U"
+	.ascii	"\333R4qz\260R\201\225A\2524F\nHGD\254\312\275\267\224R\246&\b"
+	.ascii	",\t\232\tP5\270\310\2351\303\303\306\345\007\0273\267\f\227_"
+	.ascii	"\016\264\233\365\320,XM27\377\024\024s\303\334/\327\313\035s"
+	.ascii	"\301X\346%s\273\374\342Y)\317d\354\336\335\202\321\260\264\\"
+	.ascii	"\324\035\225<\274e\025+\226\0173\227i\024\260.d.\027\313\206"
+	.ascii	"\231s\272\005\024-\315[w\305\362\371(\201v\024\030.K2\027\313"
+	.ascii	"V\366\2050c\246\341\002\374\031\323\246-\213O\376\031\247y\254"
+	.ascii	"\020\372\263L\377$r\357\254Z\224 on\376YC_\273\233\305"
+	.string	"2\257\226\357\236\235\260\2716\250\233Q\330{o\373:4}\035\372SJ?\373\351\267\331!\364\371N\177\316\016\241\267\273ts\tX\202\343\314\315w\312\225\373\235\273q\373\316\205\360\332\033\352\316\375\300\331\033\352\307\332\n\254\255 \227\201\031yC\363\363\025\375_)\034z\334\214\211\032\203\223\340\207Y\303\252\307[\233\331\025\260\266\233o\333\275Q\256\333o\333e;\007\035\234G\352\266\345\275\241\254\255\300\307\332\n\316:\"PP\320\374<\247\377\273\226!eB\267\303\207Z\0343D\272n\266C\2739\364\326\202\\\"6\017\310\001\312\354\376\013\345:\271g\227y\323\356\223\333\3042/\332%\373-\273fV\016\210e\3639\367\366\342\262,r\2003\271<\264\253\343\372\320\020E%\202\035\336E\273\313;\246!\212\212\001cS\232{\357\337\033\027\355\376\260l6\017\310\3160\362\300\254\031\333\233\331\241\003\321\216\333^\362"
+	.string	"\312\227i\207P\016V\b}.\302DJ\214/U\004o~\376\241\377_%7\211e\336%\367\310m\3365\"e\357}{\206\344\322\360Q\006\355\335\303l\271\344\212]\032\032\242\250v\216\342\365e9\2667\223\250C\207\034\005\245\314\0264?K\351cA}\354F\037\263\321\026\367\351+\344\016\261\314\f7\205\375c\375\200D\225\321\036\330\333f@\355\340\240\315\200\036\177\321\307W\364\261\333\r\313\241\373\241\204\273\371\270\354\366\270`=F\254lE\335\257_\260:+\270\206\214\354\346\313\003\345\322'e\315\315\327\313ZIbV\346v\363\335qiX\211AE\301b\372\030L\377\267\353\3228\325\264\254\351\202\203\013\214\225$Gl\334\255{\303\362]"
+	.string	"CN\216\034_\242n\376`\207P\324\n\241\267\206\321\257\r!\024k\213\271\333\366\336?X/\213\216\306\315\247\025B\377K\203\357\202\341R\0255#"
+	.string	"Z\252\n\334\231\f\313\206\332`\361\006N++\rb&p\311\315\027\213\207\b\037\213\0337\337+\"\333\027\003.\353\346\343\032\372V\212\227\301\346\237\215#b\n+G\013\314VS\356\n\214\263\272\252\245\215\233\263V|\244\200\266\024\230\325R\016\f\234&N,\234\210)\254\234+(Wx90\300P}\261Vl^[\211\2638\315\275\231ya,\031\233\327V\342J\340\031\007\035\\(\273g\371l\336\326"
+	.string	"\312"
+	.ascii	"A\374Fh\254\237\206(\252\021\266\320\374\327\352R\335\027\027"
+	.ascii	"\306\255\272J;x[\334\030w\352\272\270,\356\276R7\3122/\224Us"
+	.ascii	"\273\306\2629\021so\251\275\367A\3746\016\213\265\202\321\260"
+	.ascii	"t\024(/\244\374F\277PV\317\236\261ym%\346\3344\367f\336\236\375"
+	.ascii	"\326\356\027\312f\261]DLam\251\265>\013\302\340`1\003\334\233"
+	.ascii	"\331\201\250C\207\016(\340\234 \331\206l\005\337\350\t\351\241"
+	.ascii	"v\363\257\034\2347:g\\P\261\022x\373\246g\206\324\335\333\315"
+	.ascii	"\266MN\317`\340\240\232\033@\374\242\311\032\271\233\231<WWC"
+	.ascii	"\274^G\203\316\214\313\315\277O\364\271\355\020\372\271{\304"
+	.ascii	"\257\017mC\3333\303\314G\310\310\031\271\3316m\032\346&B\235"
+	.ascii	"\200\001\242\345\346_\036\372\227K3\177z\342\220\305ys\363\357"
+	.ascii	"\225\316H\334\300\372\314\3302]c\314\\\334\374+"
+	.string	"\245o\007\265\016Y\0231\2037\3331VLN\363\352\361\201\241\246\307\227\233o\373\364m\031}\233\247o\253\350[6\r\324D\377\266\013\227\245\2214\276\233\255\026{g\231\022\330-\347\240\203ce\332>\333;\357\207'\216\031\030\0367\337*\321\267\022\240v\320J\200\336\246\2407X!\364v\207\276\325\322\267,\264\245\263T,\223\203\255r;\305\312=G\212\271\325\366f\376\344\214Q\223\243\355\346s@\337r@\177\006\007\007\007-\007\364G\275\301\016\241\331\n\241\037\254\020\372<;\204\332\267\237#Ugf7?\002\372\226i\335~kf\317l\033\246\252\362\332m{3\203\316:8%\220\233\177\033\345\266\355\347\240\203\243\341\331\373l\357\255\001s\021\202D\355\346\263\261l\377s\362\023$[>n\266h6\3152\003`\241\334\252\331\265\237P\314\315\334\233\371s\207\b\272A\271\031\310\016\241\327\n\241'A\337\006"
+	.string	"\305\203\2036"
+	.ascii	"(\317\321\355\223cH\333\035\274G\377\3523\255\020z\246\035B\265"
+	.ascii	"\025B\t\260\201\377U\262\004\177\216\340\377\030\020(\361\277"
+	.ascii	"k\377U\362\337\267\037Su\375\027\354\277;\376\233\365_\256\037"
+	.ascii	"OY\027\030\317V\270\030\370\357\t\377\315\300\177W\374\267\347"
+	.ascii	"\307+\362\320o\007o\372\337\377\370)[\260^~\034\346\267m~|\314"
+	.ascii	"B?\356\222+\374\030L\016\372-\332\237\201~\f\364\347\237\037"
+	.ascii	"k\311>\277}\201\345\307v\177\356\371\355\333\237"
+	.string	"y~lB\336\371\261\322\217\227\262\016\t9\347\307\020\334f\326\277\345\201?<J\333\217\313\344\024\260\210Eb\203t\300\322\341\240\275W\271\362G\327~\214!\243\200\177>\177\013\302\036]:\t\344\374\237\250\202\006l\201\nX\013r\357\360\237`\354\b\033\302\3021\260\032|\202\037\025\303V2\306s\371jp\251\034\003\"\374\200\357Y\0316\204\034\020\324\310\366\3078~+#\377\307`?\356\361\3370\203\277\035\361\333\002\374_\013\361_-\377\275\263 \006@\207y\374/\001\307\371/\225\003\340G\215\354\025\213\005K\t\034\300\n\f\370[\007(\340:?J\343\267W,\026\334V\345\357\267\252e\361\333\251\377m\376;\310\306R\340\277\206\217\3711\210\377\022\374\350\022\376\300\001?>\302bkp\002`\374WP\315\217\311\374~<\002?\371/\231\276\337\232\360[\342\177~\364\003?\336iZ\b\216A\206*\367\371Q"
+	.string	"\374\030\377\266\002N\363\037\003\013\337\371\321\f?\216\201\346\030\330\n{\357\371\321\034[\201\357\307B\366~\234\336)\377}3\302\367\210\234\371\217\301\377\n\377\003\360[ \033B\321\253\274\204\377k?\326\360\277\202\037\375\340\307K\377\355\217\322\375\330\314\217\307\3748\314\217\275\374\030\357\307w?\266\373q\335\217\351~\034\367c\267\0373\177\\\366\343#?.\362\343!?\016\373q\327\217m\374\370\352\307T?\236\372\261\324\217\225?\376\300\217;\360c\r\374X\305\217\221?v\372q\361\307L?N\372q\212\037_\340\307\026\370q\005\376\333\367\343\t\374\030\305\217\037\360\343\006\374x"
+	.ascii	"?V\300\217C\3701\210\037'\340\307$~<\342\307\006\3701\001~\374"
+	.ascii	"\301\217\217~\034\342\307\037~"
+	.ascii	"\\\364\343\f~\034\200\037_\360\343\n~L\301\2175\374\030\202\037"
+	.ascii	"\023\3758\350\307<?N\177\234\177[\201\3372\375w\360\277\202\277"
+	.ascii	"\r\341\277t\277\005\372\357\233\377\272\371\257\337\1773\377"
+	.ascii	"\337\376K\346\277a\376\273\345\277w\277\035\300\177\255\374\366"
+	.ascii	"\350\277T\376+\367[\r\376W\371\277\366_\303\377\275\377\302\375"
+	.ascii	"W\312\177\213\374\327\310\1775\360_\375[7\377Q\374v\312o\343"
+	.ascii	"~+\344\267@~\013\366[\031\277%\376V\353\267Y\277-\376\026\003"
+	.ascii	"\2775\361\333\005\374V\001\277\035\341\267%~K\342\267\021\374"
+	.ascii	"\026\202\337Z\370\255\320o+\3746\350\177\007\376\337\375\257"
+	.ascii	"0888\370\347,\377\n.~\022P\002W\316\273\nX\n`\001\247\371S\313"
+	.ascii	"\317\273\377\304r\332e>%E\\\334|f1\372\251\205\347\305\013\261"
+	.ascii	"57\333A+\204\002m;\204\336m\205\320ch\323\032D9\372i\345\226"
+	.ascii	"yZ9\251\344P\355\255\365\001\217N\310\022pcaep\fK\364\177V9\251"
+	.ascii	"\350\t\212)\273\371\244\313\331\312j\301\345\346c\020\242\377"
+	.ascii	"sN\016F\f\0273n>\247\020\235\315\036upn>\206\033qRr\r\25254)"
+	.ascii	"'\234`\n\203-n~\3731\013\244!\345\346c`\241\217\313\306\336\316"
+	.ascii	"\2643\312\251v\256\235l'\224\323\355D;\237\234L\313<\333\316"
+	.ascii	"\263\237M\360\362\227\271\267\324\331v\212\031\235m\247\222s"
+	.ascii	"\211\224%\222\270#S\344\230\300-\355\226dnK\263'\313\263\355"
+	.ascii	",\203j\2035\226\363\342\005\334\231\013\371\027\256h\2374\375"
+	.ascii	"\013e\372\027\214\350_\370\241\177a\207\376\205\032\372\\\362"
+	.ascii	"\237Ip\031\322\310\r\266\233\177\001Kc+\204\376\302\224\376\320"
+	.ascii	"\033\375\241=\375\237\313\323\310\0162\0356n\376O#'\016\0356"
+	.ascii	"]\202L\231\272\261\264Mr\234!qJ M\274\374m^\f\027\315\270\263"
+	.ascii	"\305V3MT\327\322E\214\246\325\213\270S\n\3072\017\nY\032\311"
+	.ascii	"\210\323l\222\005Sh\256U\301h\356\315\264\243\272j\3168\265|"
+	.ascii	"\360\336P\202\313\353\307\202\253\371\302\252y\3428\261N-\233"
+	.ascii	"\267\225\313\006\233{\357s\0079o\234`'\2213\354\354:S8\267\316"
+	.ascii	" \247\217s\307Y\344\024r\3628\201\234:N\256\363\353\374q\016"
+	.ascii	"9s\234=N/\313<q\2344~\3268m<\2378N\030UMN\034\031\316\3450\032"
+	.ascii	"\326\205)0D\342N\034'\224\345\003A\005\315\225\261\275\231\332"
+	.ascii	"kL\263HQ\316R\330\364\207\240\350\0171\365\177f\375\324\372\317"
+	.ascii	"\253[\305\362]\340g/\354\r\357f\234\303\350g\326\216\324\214"
+	.ascii	"\267\"7\177\250\211\326\261B\350\207\206\350\017\351\320\037"
+	.ascii	"\222\241?$\245o\241O\337B\026}\013q\372\026\234\350[\020\242"
+	.ascii	"o\241\206\276\005\026\372Bl\364\205\302\350\013\305\351\013\215"
+	.ascii	"\351\013\205\351\013e\351W\030\324\257\320\324\177~\363\374G"
+	.ascii	"fl\017\307\315\271*\377e\253\034\303\346\265\3452\274\\\225\377"
+	.ascii	"\362\225\265\322e\231\377p]\366S\246pT\226\224\001\346\027\371"
+	.ascii	"/\303 \002\265\244\254M\016\314n2\240e\346\277\254\346yMfC\264"
+	.ascii	"\363\242\371\202O'\247L;\204\036\320\n\241\257\020E\367\365\340"
+	.ascii	"\355\225\251r\363+8\321\007q\226\321\254\2326\257L\016\313,0"
+	.ascii	"s.\004\260\033H\262\031\224\030\315\037\371\b\330U\263L\356q"
+	.ascii	"\3470s\231\262A\341\312\313e\262\217\255\246]\231\354\225\301"
+	.ascii	"\340\242p\350e2\331L\336\313i\362\231\314\227\321\344\246e\346"
+	.ascii	"29\311sU\306\312erZ\036#b\n\253\001Q9\232erV\336\341#\305\334"
+	.ascii	"Z \322\220`\215\355\275\355`\230\325\226\205,f\247\354\206\330"
+	.ascii	"\213\233_\301J\337\345,k1\240\3445\021SX9/\304p\345.\231\013"
+	.ascii	"\016-yn\355j\311\226\347DLa\345\304\020s\243\231\273d\272\234"
+	.ascii	"EC\024\325\206\002\343PE\331\006\016\340\227\f&\347e\274\354"
+	.ascii	"%\207\261\314\334%o\361\221Z\243F\346\223\037\364F?HO?\310\213"
+	.ascii	"~P\026,\331\356J\212\027Dj\352\346\007\251a\271b\200\265\300"
+	.ascii	"\257\272\347+?bvTi7g+\031\356\334\233\222Fus\256\242\277\270"
+	.ascii	"\312\2327g*V\n\330Y\223K\003\247\235\261yr\363\203\310\246d\271"
+	.ascii	"\270\264n\315\030\264\233\037\0046%\356\007M\01386R\236\343z"
+	.ascii	"\314t1\262\2749\267e8\277264\270\374\206\006c\tX\206\036>\245"
+	.ascii	"\233[\006\222!\347\313F\027-7\347(:g\322\334Q\341\373\237s\202"
+	.ascii	"\375\355\311\335\374 \032YML/\310\340\315\017j\241\0174\250\017"
+	.ascii	"\204\346If:\321D\304tY\311\362\304\t\230\266\255\327\344\331"
+	.ascii	"\tjFy%\320J.\363\201S\203\316\310\315\007z\222\311\362\330\215"
+	.ascii	"K\342BJf\362<v\333\002\267t\231q\363\331\344%\377s|\3068\221"
+	.ascii	"\253\222\227d%V_\366WV\222\223\344\374\351\t\232\335|\240%\372"
+	.ascii	"@bzg8\263\302Z\224\345e\016\222\215\330\274-\240-5\305\256\271"
+	.ascii	"\367\026\263\314\274\314@\256V\034\0201\271\210ef#\231\b\021"
+	.ascii	"\210l$\013\311)\244n~_vy\211\325\331\230\234\017D\245o\231\347"
+	.ascii	"\313C\216f\310\226\032Mn>P\224\376\017\034\375\037@\375\237="
+	.ascii	"\375\037=\375\037/\372?Z\364\177\3424\217\374e\301\374\005\272"
+	.ascii	"\270\371?Nx\374(\321:\210~d\344\210Bu\363\177\274\364Ahe\032"
+	.ascii	"\030"
+	.string	"\rK\277\205\rf\0349\207e\346\256\\\243-we\033\231\313\346\265m(\031\027\364)\333\300\351y\003|S\003\315[\371\306\017\f\"-\206\230\331\302\323\367y\3133\256\326\232\020\0277\337\307I\226\341\303D\337\247\207F}\260t\214c*\227g\016\316T\215\233\3573\245\237\267\247\337\314.r\213\267\245\232)7\3437Y\351\003\005\264w\021\271&U\236\262\314\334\"\267\310Q\231\205\315\003\222\313\334\232{\357\016\031:\3447@0-h\376\263\3243\213K$\325\262\202F\345f\253f\364,5we\n\316\315\357\321\323\267k\202q\313\2743\024\036\264\314\254\374\205s\211LYf%\216s\211\350\004AC\343\004p\357\335\201\250C\007\244\223\2607:\277\347M\277GM\277\207\251\337C\246\361_^\033\270\255\233\361\037\256\303~\032\242\250\262\223-\315*\230\212O\316\336_\\\2266\356\017\317a*\351\020/f\374"
+	.ascii	"q\033\f\210\335X&\376\303j\216\327`6\035:t \262P\342\270X\242"
+	.ascii	"3f\332!T\204\025B\337\243\245\3732\022'^;n~\017\225\316\333b"
+	.ascii	"f\006\363\3413\270\211\313\340=\214\3062q\032\234w\033\207\255"
+	.ascii	"\340\2155\355\2564i\3424\270\013Y\336\035\326\242!\212J\204+"
+	.ascii	"g^\260\236\206(*\021\3268i\3424\230\013\326b\363\266\230[K\207"
+	.ascii	"\f\0172K\300\275\231>M\316\202`\001\312c0\03116\f\326\332_\225"
+	.ascii	"1XL\224;.\250\233\261\030\236\277)8o7c0\370\013\306\023\364\001"
+	.ascii	"u\363\331\340/N\226d\256|\301T\214\3040\302\346\346\363\270\351"
+	.ascii	"\363<\321\347Y\242\317CD\237\247\207>O\016}\236\0318\213\226"
+	.ascii	"\033\034bn>\317\224\276eb;\214\305\355\006\02006\226\211\261"
+	.ascii	"\2409\277$\331\031\324\337y\243\361\216\232\327a\272 X\224An"
+	.ascii	"\376\316\031\375\235;\271$x\n^\223z\262&\354\346\343\245X\226"
+	.ascii	"Y `\023'M9&\230\314\346\265\225X\363\346\244\311\362\354\311"
+	.ascii	"\032>b\331|"
+	.ascii	"\240\230\033+u\363bd\344\266\241Cx\340\262\337\310\f\227Q\232"
+	.ascii	"\005\216\251a(8\n\216\303m8\r\303a6\354\206\245\3407\313\304"
+	.ascii	"k\370\3111\023\243u\220\302\226\345\032&b\371|\224\314}\225\016"
+	.ascii	"\0213\013\004<[\303H\360\0227:\263@\300\275\231\347\232\026\034"
+	.ascii	"4\210\262\365\262C\250\005+\204~\207\210\376\016\227\376N\013"
+	.ascii	"}\235\246\276N\026Md\207P<\326\223g\243\314\333\315\327Q\323"
+	.ascii	"\327\021\303J\254\325\232\260%7_\247\013'\321q\241\237\343F?"
+	.ascii	"\347\214~\363\212>\240\035B\237C\246\237#D\377x\b\026\202\205"
+	.ascii	"\004\001\"\005\253I\217\2331\220\037\373\300?,\233\365\002\022"
+	.ascii	"\313{q\363\305\262C\250\005V\b\265yF\307a:S\232fW=0\217\235."
+	.ascii	"\263\"o7\337\256a\036\330\206e\303jK\335b\355\255\203-1nK\035"
+	.ascii	"x\007\006\303_\330\31321\017\314\205\273p\216[w\313\334T7\302"
+	.ascii	"\332x\340\032\326\nV[\352(kpM\314\003\323\310\202&d\t\370\223"
+	.ascii	"F\345\211\024O\316\261Bh\216\016\22767\2267?G\251\257\233\372"
+	.ascii	"\232"
+	.string	"\214\276\306\323\327X\3645\025}=E\377x\306X\017\021$iQ2\256\226\\\227\305\327w\363\217\265\260\225O\214\024\224\b\271\371 \224Y\232{\357\301\273\345\215>3K\233\267F\017\273\300/\360\025\206\201c\340*\314\002\267\300S\030\013S\341,\313\304V\030\3528\nK=\347\261\271\2006\257\255\004\025\274\246\237\2322\3134\277\315k\236Y\242\331\223\303\373r6\257\315.\227h\251\"h\371|\360\336:\270,\261\325\215\263\245\211\255\256\233\013\307G\212\271\263|\316x\001\033\003\334\233\311\363Fm\211\032\004\331\346\331!T\203\025B\257\271\364\265\013\375\264\215~:F?\245\242\237\246\005\3367\271\317I\021\030)\004\316\270m\004\243\250l\335\374\224J\377\241\202\372\250\236>:\2479\220\351\243=\264\b;\204\036\305\342\333\203\242\245\f\352\356\035\007v\267`\203\022\243\231\223\343\355\006\335\235e\033\2026\305\343\346_"
+	.string	"\2457\210\303\202%\265\003\2414\013\304P\\\004\203\330\225\311\032k\202F\027\221\251R%\255#\322\373\354\310\224\346N\026\034\034pV\236\326Y\276SF\031\253\037`t\221\240\234\\JG\344\205\317,\277,\307|8)Bd\356)]\335\216\027\217\026\2007\237M\tb\314\340\315i\0172\340\340\3228\233\266\257,\210\211\201\215\331\033\177ciR\236\222\321\370\"\026\347~\021\242\026EL{P\222\226\226\272\325y\245\341\002L\2610m\260i{\352\226Z5a\222Fws\032\345n\231\321%\316\224\233S\266S/\357\262\26207\247k\026.\307\200\002\006\343\346T\315Z\231\242\233\243qs\n\305\236\371\237S\2002X\177dv\314\276\004\352\335|"
+	.ascii	"|\351\0174\316~\2262?\330\335\002.,Fs\357-\016"
+	.string	"=Bh\024i\2216y\312L\237\264\201A7\346\211\223\274E\n\f1aq\262\244\001\200\225\366\300&I\222\264\214\310K\3317\200*Xi\270\f\300$\314\032\331\323\2623N\024 ddnN\225\244cH\232arc)\223<-5\276\3642\264i\311Zr\273D\300G\025w\352\361\304ya\213\003\324\036\302,\227\351\021\233\266\257\210\260x\245\341\002\304tB\006\003\305\236\036\321\361\201Cyf\225\367\367\327\246\247=\004!B$-b\323\366\225\006\252\226,\331\331\272;\273\222\0261\303$\317\310\315\267@Mo\220\345\307\217t\b\n\205/\307\212\007\032\227\220\247C\254\025\23600)\200\335|6i\020\036\246r\243\t\002$\307o\357\214\224O\024\216\345\217\233o\201\021]\304B\207\2164\214\310K\331\027\242K\325\221.\200\030\310\22143<\236\206\245=|\226_\252\242\334\234\202\371\304\261H\343\346\346["
+	.ascii	"#\375J\275\320\032F\304\342b\334\234\356@k\344\314\tv\021r\212"
+	.ascii	"I\257\354]\201\322F\027\231\335\270\221v\035Km\035N\226\326\357"
+	.ascii	"\213\314\005\216\247]\351\220."
+	.string	"aZ7\247\\\231\005\0228^gtQX\326\263R\033D^\230ooq\320Y\362\316x\325xjcP\206\032\301\233S\255\224F\031/27\032\351\214%\227\032A&i\215\250@,\251\214{\304\346\320J\341I\005v\272\210\356\350\177\372\342\351\213\364\312\246\355+\013e\317\206\037\340\336[\034r\033/bsi\214\247WZ\f \034\0277\2470R\253;\304\212\r$\251UZ\205\355b\334\r\271W\231\013\316J\026)\232\350\310\321S*\252S\212\216\242\362\312p_\332`\215\355m\227A\017\363k0\360\346WpDc`q\364t*\235:\215\330-&\265{4A\267T\tY\243#(\365\204\354\346W@\245\215\240\322\250T\312K\005P\372\033\002\265\206*GO\225\226\231*-\333\001\200\350\315\244\242\327\334\333.\203\253\244L-\205\233\277\301\214\216`\315\321\321\301A\313w\200-/\245\337\006\300*\037I"
+	.string	"\367\266\313"
+	.string	"\323\230Ck\273\371\033\234\350\017\177p\300\240\202\226\357"
+	.string	"Q{\353\030C\231\320m\030\323\337\260\324\027\3108:\n\370\3475\031\020\r\214;\262\244\314K\f\333\230\233Q7wh\266\214\334\374\rB\3647\370\320\022\274\035\035]\303D\327\240\177\031*m+\177\340x\240qb\267\374\331\270\272\031e\223AG\016n+\353\346o\300\322\337\320Bk\300;:\352\347\207\251d\251\264\235\245\303B\315 WN\334\240[\335\315\247"
+	.string	"Oc"
+	.string	"ut\024\315-\023E\2036\017\260\225\266\225)_\226\031\277\03732XR\270\031Ms\311\244\331q\344\346S`\247OA\025\r"
+	.string	"\262\243\243fn\231\250\031t\017F\237Y \232\002\0244T7\243g\364\227\256147\237\002(\372\024\024\321\035\332\216,\231E\307X&:\006\325\023\201\271\225\004\240\353\312 \007\312\232\036\201(\031k\375\324\212\374`\356\314\351p\233q\363)\310\2413\340\n\023\006\013\032\0051\364\207!_\276`,\177(\016\036in|\214\335\374\t\330h\2438\274<\273%\237\376\004`\264Q\026.i\262\330i#4-\247\037zg\371\214\334\364M\020\247?\001Ss W\367:\324N\357\fj\350~n\264"
+	.string	"\302\304r\324N\027\021\263\263r3z\345\276\0202\246\t\221\345\232\024\2247\177\002 \032\204T\225!\226o\203\022hG\361\221M\320\245A`\315\311\241t\226O\357e\ngU\326\234`K\177\202,\315\201\032)R\320)u}>~xX\210"
+	.string	"f\345\2519\032\367wE\007\2347:D\0237\024\316\r}\023a\210\t\017\235\032db\3049\372&\206\004\254\352\346K\340Es\240qt4\312-\023\215\202\356,\225\266\225>q}[\031h\25036\345\315\227\340M\207\370\262\206\262\255\345\360\322\223vw\366w\363%0\242;\2709:\n\005\312\031G\204\r\245%\002\213\222Kw\350rt\024\r\355\232\301T\033\n\354C\035\235\004W:D\231'O0\226\034J!\313\261\275\265\305\001\035\342D0\314\315\327"
+	.ascii	"\250\315\320&fagh\2233&v/\f\307\224\233\257\341N_\003\023\335"
+	.ascii	"\001\r\031Y\235\206\034:\003\251#T\211E\2310\271s\226\271\257"
+	.ascii	"$\260\225\301\216\227\330\026\265\233\257!\206\276\275s\350\217"
+	.ascii	"\034\301X\320\275-\323\353\nkoaq\b\361\206\004M\202\"\301X"
+	.ascii	"\264rG\337\216\326\013\300$7?\0024\372\021D\321\032\360X.\357"
+	.ascii	"\372\226\332\0033\"En[\336[[\351\267A\215\030\230~\0043\264\007"
+	.ascii	"lG(\020\213\nAs\240C,[\336@6\024T\b5h\021\300\320\217`\353[\313"
+	.ascii	"\206f\020v\204\206Y\364\207e\242?\254\025\0216\224\326\005X\350"
+	.ascii	"\310\350[k\005\365`yt\331,\n\366s\320\001\232\003\355q\3336("
+	.ascii	"\231\373*\311C\310r\314N\037\202(:\203+\036<,\237\005\332Qb\314"
+	.ascii	"\226H\264\0065\216\320\034\026\335\261\303\362\021m\245\337\206"
+	.ascii	";/\020|\351[\313\207z\300\325\325e\333B\250QB`\2455\240rt\333"
+	.ascii	",\312\365s\320\201e\242\\\267\215h+\373>\340yY\243A\260Ae\240"
+	.ascii	"2\320-\333\204N\310r\314\306\321-8\201a\320\032d\202d\246\320"
+	.ascii	"\032(\r\262\2735]'\035\006\300\316pAg\\2\255\025fS\335\374\f"
+	.ascii	"`t\210f\fT\013\215\201fi\245\275\301C\310r\f\353hVN\034&gl\334"
+	.ascii	"\214^Y6)]\312\316\334|6]\256\340\004\336\374\fSt\007C\\\270@"
+	.ascii	"\253l(\321*/\201?\356nF_d`\242;T9BYX\264\005\023mq\2630\325\206"
+	.ascii	"\372\022Q\207\306\314\340\031\300\364\355\315B; \203*\217*Q)"
+	.ascii	"\273\367\336[[\331\327A\226\030\026\207\037\215:*\225#\246+\213"
+	.ascii	"\334\315(T\216\032\036\263)\303\013"
+	.string	"`\022\275\233\237!K\237\203-R\300\232\272\371D\203\372\024D\303\004\2413s\363\211\372\264\0060\216~\276\371q\216[g\231\347\233S\016S\355-\343\202;\"<m\244\344\350\347\232\323\357\374;\335\330\255\205\265\200\253)\200?\335\374\266\311\311&\247\017kN\354\346\263\215\321O@\033e\306\226\227\233\r`\205\320\023\325\351L\344\246\215\304\034\375,s\372\335\"'\025\273\265\260\032p\245\245\271\261\26020\322qt\2329\317\374\334\373\336\331\247\367\336J\346\276\312\340fk\213\003\217\214\026g\\4\177\366\351\324\250\362\362J\363?\347\242\305y\323\225\346'\232\033c\252\310\235SN0b\226\374\361a.\334\365\357\2757Q\t-h\332n>\221\230\376\355\357\217n(\254\275\267\326\311\334XQ<\350ooOk9\374=\026[\013\376\347\237\251\270\367\024\233\327\336\333\256\321H\344\240pl\330g\036\026\225\332\227\362"
+	.ascii	"_YR_6\250\324\276\262\202\250\324\276\266R\252\2102\bk\177)\251"
+	.ascii	"\324\366\016\222\222R\226\360\332ATj;k\263\370\222e7\363K\271"
+	.ascii	"\245\274v\320\226\332P\033\250\244\276\262\250\324\240\262\202"
+	.ascii	"\250\324\276\262\266\332\327\006\332RPX.\2446V\320V\373\352\333"
+	.ascii	"j^Y@Tj^YTj_z\026\b\214/\277\032k^D\\X4*\251\035\303\252\013\n"
+	.ascii	"\013(\217\212\351\265\365\366\266mS\033k\347\355m\301\336]^X"
+	.ascii	"zP6\354\\T^\214()P^\226\271\367\316`\025\005\346\265\245\362"
+	.ascii	"\224v\347Q%\361\332;I\024\323\266\332{\357\020Jf\336\016b\363"
+	.ascii	"\224=\272v\325\324\336\020l\346\336V{+\355\316\333{+\367\336"
+	.ascii	")V\027so. \252\245\225\325\336[DV\273KI7\265\367m33\227E\245"
+	.ascii	"\006\346eD\307\246\266\334-\230JKU\345\265\227[\357\013K\253"
+	.ascii	")\321v\325\336\333\252\321\313,\031~7\237h\352$\343\363\007\203"
+	.ascii	"M\237>\307\210\t\343\303\207[\333\315'\230\030\202SXn>\006.\372"
+	.ascii	"\226y~\361B\202\21695g\336O/\271\f\013\0272N<\2351f\336\344\235"
+	.ascii	"xg\227\224E\240\026\265\263\213U\303\243#\214\213\f\227;&yR\330"
+	.ascii	"n\326\340\354\350\347\025\346\031KD%\343\221\304\317P\222PG]"
+	.ascii	"\032\261\252K;\306\023\204\310\022L#HX\325\245\235\364LE\036"
+	.ascii	"T\2454\002A\253\361\351H\242XT\021\260\252KB\" \220$TO(=\245"
+	.ascii	"H\352,\031\211F"
+	.string	"\242\260I=Qb\002\243\352t\364I2\022\225,\250Fb\023R]\325$\013j\362X\034\376\234\251\210X,\022\233\320%#q%\n%\2004TBrJ6\355$\031\205MMG\022C\020\234\222MB\" \240\364\224\"\271\203TK@\241\364\224\"Ya\207D\2063\025-\021\225L\004\235 \212V#\t\016\326TM:\222\360s\246\"$\265\211\270\032\237\220\036\206JK\302\"\bKFb\023R\270s\206(Z\215$\214\326t\035\016\205xEJ\"\325\342S\002\206\326\244\342\221\251(<\022\221B\025\347zD\nS\344\325B\322\b\302UXb\205\t(\220J@\253\221D\322\bDi\007E\031PQ\254Ia1\307\003\235\017\212\222\324\025)\344A\036\221\310\004`\370`T\264\223\0015\211\215\214\2122\240&\321$\243\212b(\311\250\2420\n\207\031\232\3245\271\002\305\005\025\251\004\201\211\225h$^\320"
+	.string	"\200$\265\230BhL@\006u\025\256(|(\370P\264\"\205NE+\362h\002\3714\304 \211\347C\321\222\221\250\244\364\264\242P\327\025)|\264QQ\323S\322\204\241\3124\324Q\233\210%\254I!\003|8(Z\221\302\025E\221\270\032!\340D4!\t\264&\325\247\f\250'\222B\021\222\352\272\002\001(\234\020\256\302\022KFb\222Q5AD\202\023\020\n\tP\227\204&\f\205&.\240\020R\327\025\bH2\252(\220\226\214D\244\220\t\305\211\234\243\"\247d\323\016\n\265\230d\0242a\370\220\210T\215\352\222~\b\0176\360@\004\n\351E\b\340\203"
+	.string	">\240\027!"
+	.ascii	"##\001x`\244\357\201\021\026Q\224\3244<U$\020,$\223\352\360\210"
+	.ascii	"4\261&\217&\234\222MB%XXQtRO8%I\bZ\3273\0259!\251\253\020\351"
+	.ascii	"ax\201\352\264\242\204\234$\222\272\nO\024\217\310\325x\034\n"
+	.ascii	"\r\221\251\bu\025\236\030\"S\021ID\022\220Lk\212dZuR]\205\310"
+	.ascii	"\263\304\b&\220L%\030W$\345\2108:\241\220\200\023\204\024\030"
+	.ascii	"\"uL\020\252\310\024HB\247\325\347LEID\247$\222Z$*\035\221&\222"
+	.ascii	"\210N<\"L\\\021#\\\021%\256\352\264bEB\252k\221\250\024\304\243"
+	.ascii	"\001&$%\247\"\322\t\302\025:\032`\362QR:\256OC$\246\341z4\"U"
+	.ascii	"X\215\304\243\t\247\247$#Q\002\030vN\020R\240\351\tE\022\321"
+	.ascii	"\311g5>\035\207H\352\222\020\251\252\020\"%\215\252S\323\221"
+	.ascii	"D\022\321\304*L\241B\310H$a\035\221Dt\002R\213K\306\021?+V\242"
+	.ascii	"\n\342JL\032U\024EU\205Z\004J*\036\231\222*\222\251\004\265\270"
+	.ascii	"\256G$S\t\027\214Da\b\310\343\210&\244\272\022-\034\211\253\360"
+	.ascii	"\004\n\302\242z\"YaeZ\"\252\022X\215\304\243\323\252\242hB\252"
+	.ascii	"k\222\320\211\023\204+\202\324U\210\3649S\221ZT\207C\241\005"
+	.ascii	"I\244\341Px\256g*Z'\220$TO\034\221+\226\202\222H\025\3204Ih\301"
+	.ascii	"\bB\222PE\236p,&u\220\352\232$.\251'$\360\344\3244d\004A]\211"
+	.ascii	"\310\023V(\021\221\252\212\036\344j\342\304\223SS\217\021\204"
+	.ascii	"UM\252\310\324x$\256B\344\323\223S\023\320J4\216\260\022\215"
+	.ascii	"\304\234$TO\f\207#,\f\207B\235$T\221\371LE\310c\322\230D\":\241"
+	.ascii	"H\332Y\221\0340B6\022M\030\223C\224\350\224\304+\222:$\252P"
+	.ascii	"K$\237R\354$\237R\340\020\214\220\206C!z\202\360\004\211\022"
+	.ascii	"#P5\351HB\205\212\344Q\221\214K\304\242\020\311\307\270D,\216"
+	.ascii	"\030\016\205z=S\321\223S\023\322\021\271bi8\024\252H'>t\360\301"
+	.ascii	"\203'\247&!\343\221\270>\025\217I\025\251\223D\262\240\"\241"
+	.ascii	"xrj\332AO\250\253Z\342\311\251\251\302\222\221Xtj\022\242\030"
+	.ascii	"\016\205BL\353\361\330\204b8\024\346\250C\243\003\326\244Pe\300"
+	.ascii	":\"I]\205IN\020(\252\303\341\210$1\303\tB$>S\321S\023\321\303"
+	.ascii	"\312\264D,*\021\025\213Gdf\032\256D\247\363\004\341\n\234D\223"
+	.ascii	"HG\2440\005\272\236\251\b\251\256j\323\021)LA\001\211#R\230\302"
+	.ascii	"\202\272\n\213O\303\242p\230\223DR\241\2268\"\205)r\326'\275"
+	.ascii	"BXT\223\220\234\236\364\272:=!\255H\341\232\324\310\325\304\320"
+	.ascii	"\370\004\202\223\003\216Ha\212\036\247'\244U]BU\250Ix-\2168\""
+	.ascii	"\205\bHS\025\371\264\n\221\252S\223Z\302\021)L\361s\246\"\017"
+	.ascii	"I\tP\020\032\211M\2530\205\212\n\305\242:<a\025\246Pq\241\250"
+	.ascii	"\252P\031\260\032\325\244\2124\261\036\033pAE\252\240\"YP\207"
+	.ascii	"\310\247#\n\244\272\252$\254F\025\211|\032VX\261\022\207B'!\211"
+	.ascii	"\025Hu]\205)~V!\002\"\240&\237z\222+R-\216 \241&\237\214\352"
+	.ascii	"\020\251\232X2\022\215H\241\004\232\236\222\306\343PC\222\230"
+	.ascii	"T\221\352\232\\\301\264\nS\250\360y\222j\302P\350\204&\221V\344"
+	.ascii	"\321\004P\322\b\310c\322\250&u"
+	.string	"\322\bj\223\020\251\224&\215\240>\025\205*R\341*L\312C\344\020\237\251\250\202\240U\b\244&=\255\304%\343\221\001(\020A86 \351\264\024\3044\\\211'$\201\214Gb\022\251\2520\022\205PP\213NO%\224\212B\021V\344\321)\371\243\"\201\220\204<\036I$\235B\030Z\205M\310\243\022\222\272\n\215\304$\344\3618T\221V\242\021\002;+\321\370\244c<\022\223\304\241\212tJ\n\225T \2550!\211T\302P\024\252@\252\253q\204$\343\323\021E\023RX\034\261\256G\246\013%$G$\325\247\2420\002ID'\013\352\222p-\036U \025\213\352\020iE\036\235T\244\320Z\341H\304\200!\211\264DT2\036IT0!)$\301x$\256C\343\223\022\217\2124\302\005\247dS\322i)\b\0055\3118\202\272\n\221IO\302\024H(\034S\2300\024\026S\\@\n\231\206\271x<\""
+	.ascii	"\351<S\221S\262\311\203S\262i(\211\264\252&\f\205&\234\222M;"
+	.ascii	"\353\231\212\224\236Rx0\036\233\232\216\303\t\222\214*N\")=\245"
+	.ascii	"H\242\310\325\t+=\245\300IMC\234\256\305\247\244\212DWb\023q"
+	.ascii	"\207i]2\252\f\340A\256&\214 \240pJ6\371\030A\320+\n\352j<\222"
+	.ascii	"h\022\252\3105\331\263\236\251"
+	.string	"\310C\022\251\252 \"\2234\374\350\244\"=\254\307#\322\303\016r5!A\223\020\t\002\n\310\237$\022O\004V\344\321\004\220ZL!,A\005\212T\211J\304\325\250&\021uV$5\351H\302\212<:\351\250I\307\246\274\"9`E\036\235z\222\306#qu:\246\352*<\221\364$L\241U\r\020Q\250\032 \242\320+\222\210\325H|JW\235$TE@\362$\tU\021V$\016@\024\211\302\022\220\252\222\322\023\002PXy\220\253\tU\005Q\035\252'\212B\"RM\022\255H\036\030\255F\342\223\376\207\017T\245\017:P\342\240h\350\037|@b\003\004\032\020\202\036\026\255\310\243\323\212\0246%=\254@\256j\223ZTW\017F\242\260\311\303\020\231\364P\264\301\204\2410E\261($\201\002R\347\277\326\241s\260q\343&\343f&\031\215\272\277\233=(\243m\350.mC\343\260XXED\372\300\306"
+	.ascii	"\367\326\f\016\032\207\346J\177\300Y1\243\271\364\r1j}f\347`"
+	.ascii	"\031\327\031/z\013C\325\251\371\350\273\371\027\004\352_\327"
+	.ascii	"@\003o\260\331`B\343\257\003\240\2174=\243\311\345\314\237\022"
+	.ascii	"\031)\336\217\236WX\225V\032\246\252J\023&7k&b?\336`\241Y\027"
+	.ascii	"n\347\200qu\207A\213\252\271\030vE\230TX\334\314|\343\332\362"
+	.ascii	"\243j\317G\f\252N\007\fTO\r\233A\273\027S\336\302\240y\342\242"
+	.ascii	"/G\306\f\2632T\251\031\016\306,\255Z\240[9\233L\022\300\251\323"
+	.ascii	"M\016\353\232\n\243Y\330\r\202\231\265I\325ey\243F\031EgA\231"
+	.ascii	"&\016*\265\001e+\216\226\233\177\255\354\372\313aD\3574\254\353"
+	.ascii	"\317\306\315!\254R8\351`\n'\215c7\226\031\232\220%`*\3704N\232"
+	.ascii	"\271\037{\027\204\321\177\372&\016\n\025\220\0337\247nn\n\230"
+	.ascii	"\006>usf\352\206\0028?\326V\360\303\005gw\004m\223\272\331(%"
+	.ascii	"jF\376\320\355\243'C\312\0136\351\021\23504[\226k\3168cV\260"
+	.ascii	"\250\250)\323A\240\224\251\371\245L\237(\200On\364U\361\204i"
+	.ascii	"\361D\253\211Je@-b\256\322\244W>lt0\361\201\306Z\321nh\362`\244"
+	.ascii	"|\351\220-\301\"\\\366\322\".t\240ys\363\006i\364\364R3D^\030"
+	.ascii	"\f\240\r\277\277\253$"
+	.string	"6\3222O\315\314\310\222\346#\213\336@\311\2301i\030\013\304\214\002\303\265\334{\213C\007\230\330\360\022\2477\220\001\006L\032\206\310K\331w\001\0224\263@\300\234'^g>\302`*(\013'@\310n\376\005hz\203\035^\274\244x:\252|$)s1f\307\315\277\200Lk \310\205K\212\007\247\352\013`\017\236\226\\V\227\247xl\326\362\234\\0Co\200\246EKz\367!\206\265\250\023\222sbT*\305(\f\305\230C\206\241!\032%\215\001s\025@0XH$\026)\323\246\363\023\300\303L+E\211,\307\234bFFD$IA\n5\2061\314bl\235\300\373\241\240!\274q\216\274\223\243c\023\245<\017\251\313\240a\341\274\273\305#K\305\210\001\275\333\313\373\273\356\362\317\205\342\352\214\016\215\026j\364\341b\341^\0301Y\207\222Z\350\344\237\006\204\006uUq\357\033@?\303s\3437\nG"
+	.string	"E\337=\337)\365\005\322\336\260\257\334\3374\271ZtO\331\037\267#\230\373y\233\234\350@\346\310{n\255\003}\322\206U;p\230\233\316D\246\303\"\346\005\263h\322\267(#\343\252j\340]R\270:C\375\313\022G\240=\370\317\303\0166)\314\nG\r\361-\3616M\017\340\022\313m/\241\201g\233\222Z\016\226\"\335\252\3025\337I\024\311\374B\215\313 /'u\343X\372}\030\350\034y\230\f\2750\2745\360\322\002\024%\n !\363\0315\264V=\311\031m\013"
+	.string	"t\222\236g\017\377\247G\372\3563$xT\233\217\031\250\277\230\024\206\361)\230\007\231`\367\240\250\223y\277\022#P\035\nt$\374\231\246\361\231\241\262\274 \024\320"
+	.ascii	"cp\331.{\260\276\350/\013r\234\232\377\275+\371AT\224\353d\305"
+	.ascii	"\356\244\0361P\220\262(x\002\177\341j\226O\361\031\351\240\321"
+	.ascii	"x\202\006\222\350\344\030\337\364\226\253v\237\250\001>\263*"
+	.ascii	"\202\222\353-\007\024j\003\003\326\227&,~,\220\241m?\204S\274"
+	.ascii	"\337\310\022\347\300p\215=\336\376\t\306\034E\027\244\273\202"
+	.ascii	"\177\0259=\0258\350\"KD\201\370\364\267v`\310"
+	.string	"\005\013\252\265t\266\231\005JQ\006\360\341\271gq\372\00302\316\005\204\316\274\352\230m\013\203\005\246^\264\2755\357\252\b\254.\337\033\350i<\033\361\241\271\300.\305~\3603\311e\234M>G\210\272\323L\231\335\254Zf\243ro~\210@\301u\222w\376\224\361\017\311\227\274\224jG\206\034\362\310qUp\361\362\214>8\261\237\335]\241\034\025\227$}=\031\2268\320\3163\365m\2435/\346\201\207\033g\377\036\313\342\3263\027\030\030\026Q\247u,\342<#\326jO\234\271\033ix\271\364\371\037\344!\315Cz,P\022\220\243\024\b\261m\256\037t\277\252\342\362#\004\021\206\316\303\213{\016\343\353\342\206\367\330\200\021\035L\264\312\272\rO\202\325\254q\235 \322\371\341:3\216FJD\007(0\220\245\240\216\350\0327M-\007%\027\211\374{2 p\277\033\375M\323\205k\362\2340"
+	.string	"\021\360\206s\235L\371To\336\3729aB\235G\271\277\3125\211\356#\244\020\007B,\263e\263SI\300*\242\356\342b%5\266\323'cp\026cF\210\001M\333\326\003\007\254m\345\213"
+	.string	"\365!\234\275|\026\001\022p9\005\272D\335A(\t\366\201\356?\n\277i\002\322\266=\266Z\202%djy\220\212\227\244\267\200\341\020>\342\271fI\200\372d\343,\3644\004\370\004\274O\240&p5AaXe\006\022\370\340]sX\006f\341v\002ZP\b\253H\332n\371\324-ltd\024\017\tP\fA<f\263\022J-\233\b\366\225/\317\364\254\225\305\321]\221\005\333\254\025\366\253#\216\356\351v\334\264>\327\357\213\325}\\\254\250]\222\232\3032\314\302#\334\230\270\242e\006\003\\\325j\320$\274e\013A"
+	.string	"\260\300\217\311\271[V E5\301\345\203\033\303^s\004\0330\3325\221Z\330\273\356\205\362\2175\324%\315\222\206\3446\256\2625\202R\221\271s\232\255\374\"&.Q\021\341\275.\216?\234$,bWn\363\344\344\201\213\300\370\035\374\326T\233\333\\\375{\032\021\362\237\254_\345\202\316\344kTrO\251\216\027\217\3541\177\310\224`\251\375\367\247\034\177\264(A1\016_\032\252\251}\036\240\223P\372F\372\252\214\322z9C\036\3378\366\2519\211L\334\215zA\242CkChR\376\274o\325-\273U\021\350\020\357\016\353LX\215f\214\305Q\304\373\353\254\035(\0369\003\375\327\037\004\222\355H_0b5\300\2070\201\213\342\206gA\213_\363\005\302\025\324\027o\275\273"
+	.string	"\254\200\311p\374E\200\367\267\314\320|Oa\025\263\352B\210\352\334\020\032%>\331+e\024&\256\221\304\321$\200\363\302t\361\2162\"\240\033\323cB\023.\210\352z\330\233\300\003\024\2763.\316q\216\312|Aw3\210S&T\352|\f)\b\334FQ\004\t<P"
+	.ascii	"\304\224\2667\271\376[\233\223\336u_\373B@\177c\025\252\310X"
+	.ascii	"\316\342\020\226\374F(\n\200\003\340x\317\306\350\251;\347Uk"
+	.ascii	"\371\240\004=\277\314.D#p\262\246\262\250m\245\267\202\305\005"
+	.ascii	"\217U\326N\335\377J\317\274\322-\230\341\343\276G&\004z\273b"
+	.ascii	":;\210r\334\017j\302\301\207\242\004\006\023\234\032\207\227"
+	.ascii	"W\004M\253v\207=\3208\200A"
+	.string	"\313\325\245D&m\256D\207\231}\352n\224\344N5@\2135\f\361\344\237$\344\017\343gI\226a\320yT\t\307\351i<\254B/l\024z0y\306\211rE1RMHl\354Pqb\230\026\371\327,m\260\222\263\"\371\027\305\356\020e8\204\343\211\213\fJ*\254\017\325SAE}\037{v'\2306\373\326@Wc\005'\024\007~\355 |ng\365\373\370\r\332\037q\370\277\372\310a\340\304-\3679W\321\215J\342/W\330\225\230\317r\306e\230L\231\024\212t\261u\356\264e\341\374(\271\224&0\001H\"\310\371.\303eOc\221f\023\253(h5\316E\207K\b\215\017+\\d`\223\004\366\0050\277$\237;\300\024\262\330I\262T\377\352\341\327\271t\324D\\D\243\331*V\310\377\365\321\326qJ\317s\222\255\032\375\250\206\315\1777!t\235E+\244\341%\245\231j\362\376>2x\313\020"
+	.string	"1\031\304\350\367_)\252;\030\004\376\215\216*\b#1u\250"
+	.string	"q\357\223\350\351\341\210\253\006\202\344\255[\362ss\242Lt\221\210\030\241\265\017\354\274\375Wm\004\323H\n\340*mv\237lj23\234\f\324\023\276i\034\037\034\304\006K\265J\0237\251{\\\200\305;\354\303\225\332\225\310\235\030D\b9\321\252\262e\005\233\005\372\207Kt\244\330\002\347I\204\232o\210\007X\bm\201\225q\\\3004\202\331_\223\260'iaz\364\0176\254\231C\264\024e\232\301\214VK\222\216\013,\370\271!1\2442dmQk\213$\315\262\314\262\021[\335f~\201\322\266\322|j\211\314z\311\346\202\026\004\n\2569\036\022\232\212K\257\264\0310\221,\322H\261\231\340\327c\222|\2153Pr\006\230`'\320\177\272\016#7\005w\247f\221\271O\264=g\222\2065{F>\362\376\321\302\254\231\215m\001H\206e\303$9Y\362X\177\217a\353\317\t\220,\215R"
+	.string	"\205ll\2102_\0223\353\320=`\210\020\355\206\217\363.\2335\210\367#\003\2565\213!\035Q!8)\n\304X\t\254\n\302\364\275\022\254\242\370\366\255d\321\371\361\001\016\201\370\036EZ=\236\223\2078*\363S\242M^\036\375\267pKWi\264O\357yL\330\327W\241\327\206px\337\224\252ih\033\324d\374\320\2516\323\311C\245Y\366\032A\340\211%\364k,\226j,W\261\312\267Fq,J\353\250\376\344;\336\222%\b\225\367\360\320\3378\234>\347?\n\36077R\253\203\\lH(\032\202i\222\323O\372W\334\237\372X-\250\225\022\r\262rJN;I\222\221\020Kk\251W\240\373\311yA\242^\323\355<\207\364\205\367\202m\007\216\203Cs\225\016H\257V\034\3305\205\3619\025\t\237\376x\215\020\201"
+	.string	"QUf)\324A\257W\n\306\037Y|\230\321\210\277& yX\221#\247f\330\304\024^\253\340\303\233\202\350\361(ycU\330\323K\037Gn\2038\301bi\301\3004\003\333\\\364\241$\217\fb\037\267\347\256\ni9\300\365\236@\235\251\037\020\373<O\211# \342\257L\262a\264\257~O\371\314\254\003z)V\375op\tM%\273\264_\022\230\r\215|\357\371dV\215\002A\242u\343H:R\365\321+\007\261\353\006\326D\264\363"
+	.string	"\275C\003\344\\\374\272I\277\234\261c\2169\272\320(_%\307\252y\242\203j\035\351\366V\213A\251\231T\236J\016\241\230\002\364iu{\344\305e\212\251\256\374s \370\363\021_\361u\274\300\203\025%<\245hQ\206!5m\035Z\365\220\301\217-C\274+\331\321\025k{B3\215\230\271f:\207\037q2\036\251\310]e\354\370\314\"b\001i\211\3654\276\256\234\330>-\333\324\210\231\204|\264\017\021\271\004K\034u\314L\277W-\341\006\004\020\222n\007\323%Z\300\330\371\322Lsh\317RCo\305\227\013\201o\226e\273\267\264\001\273|\312\320\311\263\226\002~\b%\033\337#\002B]\231\354\007\210\020\376P\223I\377\f\023\3679g\311w\2067AI\202-Lj\020"
+	.ascii	"\276\b="
+	.string	"xV\022\3746\004A\230"
+	.ascii	"b\232\374E\177\335\324\252T)6S\227\225\314\005\270\341K\034&"
+	.ascii	"\354L\n9\024WMm\006\365\200\373\311\363|\326?\263\275\3641Z'"
+	.ascii	"\341\242L`\311\007\216{\b\2210X\231\310\234\2447\250\301\203"
+	.ascii	"\210%\346B,\222B&9\033\0313\246\016\235\024CrC\244#\266\2400"
+	.ascii	")\022\013\031=5\375U\311\023\252m\215x>|\370\313\231a\2532\351"
+	.ascii	"!\352[\241\251\241&\303z\001;\310\3041\241\326\207&D\216\312"
+	.ascii	"B\331a\333Z\311\001\3748\336\253\227VYJ I;+\225\244\202%A-*K"
+	.ascii	"\006\342+\310`\r\355hU\f\246U\313\231d5\214\313\234\245"
+	.string	"\354q'\356\303\226$\223\276~\034n\t\031\363\252\321\335\324\033\236\b\207\275\262o\024\204\027\030V]\242\t@\216\246u\357\372R \221\rx\0044\222A2&Qcx\226j\t\001[\035@\022\276\243\032#:\274\021\243\005!\f\2458\t\300\212\237U\034\023\231\252N\f\247\2027\254\323.5\305e|J\364\016\303\200\235r\333\336\364\265\307\246^\273E\234\243\346\225\f\227\317\021\360[N\f<_1\347\205G01\253\236\033\241P8b\203\005\261\272\373\222\352W(\315\226\315\376\007<W\362\024\200<\377\275\357\002\233j\352\bM\004U\027\242\260\276\030\365\322a\230\257MP\336\032H\243;vp\214\373me\250\241\3752\244]\020\227\222\261b{\277\335|\220\357KL\255\317E\312\2028\"\227\265=\275(\306#\306\323\225\r\210\351\217\300\230\361\256\271-=`\301\2443\3318\204\006L\247?b\b\"\306X"
+	.ascii	"\207\f\0237\021\r\353"
+	.string	"zx\323\002\021#@w\256\r\362\353\252B=\254j\213\017\344\212?\261me\237\310\036\217\320\311\272\320\003\002\315\221\362\022\334%\\m\303\350\344\217\3272\347\031\344\330\316\204V\201\031\240\332K|\346\033K\310\326\210~\236\035{\241\322\016G>E$g},\n\322\227\331\007T\231\366\251\027\332\363J\245\230z_B\270\244y7\337|\336\b\031\3001\006\270\030U+m\r\030@\017\371s\352\374\372\210q\017\317\367\021n\302\347&\n\374\270\2439\254Z\215\231(h\302\367\020\013\3049\234X-\202\r\235<m\275G\346\374\020\242\210|4\204\372e\247\241\036\330\345\202h7y\220P\034\353\021N\326$\214\240UZ3B\214*a\032\265<\323U\351\250\372Z@q\030\207h0\242\2722R\261\364\2211\303p\255\362\031}\t\242\265\264\034H\244{O\365\206\267\367\331\324\266R\372]\347\036\363\3334\322\336\367{"
+	.ascii	"\274\317\267O\342E\310\335A=\027\006\272\352}f\003\362r\0027"
+	.ascii	">\347u\344\003\037\347_\237yW\257=\277\2313w\333R\333\371;\274"
+	.ascii	"jQ\r\177\036\366\364\213K\307\203\371\300\334\036\276Zv;\251"
+	.ascii	"\335\354\331\323\304\304J\322,G\307K7\277G\256\233\263,\326\226"
+	.ascii	"\213H\032-\373\204\337\036\320Z\340j\332\304\217\026\261\204"
+	.ascii	"\202\034o\234\235\241\340\264\302\337\276\037\206`\242\344\213"
+	.ascii	"\326:V\375\344\177\360\227pc8\311C\247^\333\266\236\024\003}"
+	.ascii	"\252_\214\362\346U\376\260`\327s\306\326\207\266\035\262j7]~"
+	.ascii	"\277\370\247\356\373\344)\216\231\355\314\333\303k\315^\343\365"
+	.ascii	"3\375\201gC\246\036 u\251\273\2240\332\341\360\3043\027\216\255"
+	.ascii	"\314{y\357\207e\323\350\374\360I3\350\177\303\211\206O\f\266"
+	.ascii	"\356\333\354\234}XDY@\365\371\255\361b\330\357\032\227\205%\265"
+	.ascii	"~\354\026/^\004}\251q\366\250\261K;r\236#\247\255\302\370\317"
+	.ascii	"\366C\342<\276[\267\321\344G{g\306\267\2652\353x\377\375\373"
+	.ascii	"#0y-l\346\330\232\334dC\264%\224f\231\317\346\233\006\\\373_"
+	.ascii	"\200\013\177\372\204N\376\365}>\375\203\345'\252\277\350\021"
+	.ascii	"3\217\251\230u=g\301\335\003\303\234\254\211\364\354=\205\357"
+	.ascii	"\t\234~\004{\345\325\2728\026\\,H\275\352\n"
+	.text
+	.section	.gnu.lto_.symtab.e04479f24480c908,"e",@progbits
+	.string	"smartPortState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\003"
+	.string	""
+	.string	"initSmartPortTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"freeSmartPortTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"configureSmartPortTelemetryPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\003"
+	.string	""
+	.string	"canSendSmartPortTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"checkSmartPortTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"smartPortSendMspReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"smartPortSendErrorReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"handleSmartPortMspFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.string	"handleSmartPortTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\003"
+	.string	""
+	.string	"frSkyDataIdTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"batteryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\003"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"vario"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"currentPidProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\003"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\003"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\003"
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\003"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\003"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\003"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e04479f24480c908,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10709 @@
+	.file	"srxl.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/streambuf.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/telemetry/srxl.c"
+	.file 7 "./src/main/rx/spektrum.h"
+	.file 8 "./src/main/sensors/battery.h"
+	.file 9 "./src/main/drivers/resource.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	srxl.c.878b8772
+	.weak	srxl.c.878b8772
+srxl.c.878b8772:
+	.long	0x4a8
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x12
+	.long	.LASF1606
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1510
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1511
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1512
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1513
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1514
+	.uleb128 0x2
+	.long	.LASF1516
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1515
+	.uleb128 0x2
+	.long	.LASF1517
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1518
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1519
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1520
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1521
+	.uleb128 0x2
+	.long	.LASF1522
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1523
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1524
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF1525
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x8
+	.long	0x9d
+	.uleb128 0x14
+	.long	.LASF1607
+	.byte	0x10
+	.byte	0x4
+	.byte	0x19
+	.byte	0x10
+	.long	0xea
+	.uleb128 0xc
+	.string	"ptr"
+	.byte	0x1a
+	.long	0xc1
+	.byte	0
+	.uleb128 0xc
+	.string	"end"
+	.byte	0x1b
+	.long	0xc1
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1526
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x3
+	.long	0xc6
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1527
+	.uleb128 0x2
+	.long	.LASF1528
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0xb5
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1529
+	.uleb128 0x15
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x9
+	.byte	0x14
+	.byte	0xe
+	.long	0x239
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1534
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1536
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1537
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1538
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1541
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1542
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1543
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1544
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1545
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1546
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1547
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x8
+	.long	0x23e
+	.uleb128 0x16
+	.uleb128 0x6
+	.long	.LASF1577
+	.byte	0x3f
+	.byte	0xc
+	.long	0x109
+	.uleb128 0x6
+	.long	.LASF1578
+	.byte	0x40
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0xd
+	.long	0x9d
+	.long	0x265
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x14
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1579
+	.byte	0x41
+	.byte	0x10
+	.long	0x255
+	.uleb128 0x2
+	.long	.LASF1580
+	.byte	0x6
+	.byte	0xd9
+	.byte	0x10
+	.long	0x281
+	.uleb128 0xf
+	.long	0x270
+	.uleb128 0x8
+	.long	0x286
+	.uleb128 0x17
+	.long	0x291
+	.uleb128 0x3
+	.long	0x291
+	.byte	0
+	.uleb128 0x8
+	.long	0xea
+	.uleb128 0xd
+	.long	0x27c
+	.long	0x2a6
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xf
+	.long	0x296
+	.uleb128 0x18
+	.long	.LASF1608
+	.byte	0x6
+	.byte	0xda
+	.byte	0x17
+	.long	0x2a6
+	.uleb128 0x9
+	.long	.LASF1583
+	.byte	0x7
+	.byte	0x1e
+	.long	0x2cd
+	.uleb128 0x3
+	.long	0x239
+	.uleb128 0x3
+	.long	0x70
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1581
+	.byte	0x2c
+	.byte	0xa
+	.long	0xc1
+	.long	0x2e2
+	.uleb128 0x3
+	.long	0x291
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1582
+	.byte	0x2b
+	.byte	0x5
+	.long	0x70
+	.long	0x2f7
+	.uleb128 0x3
+	.long	0x291
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1584
+	.byte	0x4
+	.byte	0x30
+	.long	0x30d
+	.uleb128 0x3
+	.long	0x291
+	.uleb128 0x3
+	.long	0xc1
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1585
+	.byte	0x4
+	.byte	0x1f
+	.long	0x323
+	.uleb128 0x3
+	.long	0x291
+	.uleb128 0x3
+	.long	0xa9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1586
+	.byte	0x7
+	.byte	0x1f
+	.byte	0x5
+	.long	0x109
+	.uleb128 0xa
+	.long	.LASF1587
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x9
+	.long	0x91
+	.uleb128 0xa
+	.long	.LASF1588
+	.byte	0x8
+	.byte	0x46
+	.byte	0xa
+	.long	0xa9
+	.uleb128 0x9
+	.long	.LASF1589
+	.byte	0x4
+	.byte	0x1e
+	.long	0x35d
+	.uleb128 0x3
+	.long	0x291
+	.uleb128 0x3
+	.long	0x9d
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1594
+	.byte	0x6
+	.value	0x100
+	.byte	0x6
+	.long	0x385
+	.uleb128 0x1a
+	.long	.LASF1596
+	.byte	0x6
+	.value	0x100
+	.byte	0x23
+	.long	0xfd
+	.uleb128 0x1b
+	.long	.LASF1590
+	.byte	0x6
+	.value	0x102
+	.byte	0x15
+	.long	0xb5
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1609
+	.byte	0x6
+	.byte	0xf8
+	.byte	0x5
+	.long	0x109
+	.uleb128 0x1d
+	.long	.LASF1610
+	.byte	0x6
+	.byte	0xf1
+	.byte	0x6
+	.uleb128 0x7
+	.long	.LASF1599
+	.byte	0xe1
+	.long	0x3d0
+	.uleb128 0x6
+	.long	.LASF1591
+	.byte	0xe3
+	.byte	0x14
+	.long	0x9d
+	.uleb128 0x6
+	.long	.LASF1592
+	.byte	0xe5
+	.byte	0xc
+	.long	0xea
+	.uleb128 0x11
+	.string	"dst"
+	.byte	0xe6
+	.byte	0xd
+	.long	0x291
+	.uleb128 0x6
+	.long	.LASF1593
+	.byte	0xe8
+	.byte	0x15
+	.long	0x270
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1595
+	.byte	0xc7
+	.long	0x3e6
+	.uleb128 0x5
+	.string	"dst"
+	.byte	0xc7
+	.byte	0x20
+	.long	0x291
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1597
+	.byte	0x9f
+	.long	0x3fc
+	.uleb128 0x5
+	.string	"dst"
+	.byte	0x9f
+	.byte	0x1b
+	.long	0x291
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1598
+	.byte	0x85
+	.long	0x412
+	.uleb128 0x5
+	.string	"dst"
+	.byte	0x85
+	.byte	0x1b
+	.long	0x291
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1600
+	.byte	0x69
+	.long	0x428
+	.uleb128 0x5
+	.string	"dst"
+	.byte	0x69
+	.byte	0x22
+	.long	0x291
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1601
+	.byte	0x62
+	.long	0x447
+	.uleb128 0x5
+	.string	"dst"
+	.byte	0x62
+	.byte	0x25
+	.long	0x291
+	.uleb128 0x5
+	.string	"v"
+	.byte	0x62
+	.byte	0x33
+	.long	0xa9
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1602
+	.byte	0x5c
+	.long	0x466
+	.uleb128 0x5
+	.string	"dst"
+	.byte	0x5c
+	.byte	0x24
+	.long	0x291
+	.uleb128 0x5
+	.string	"v"
+	.byte	0x5c
+	.byte	0x31
+	.long	0x9d
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1603
+	.byte	0x51
+	.long	0x47c
+	.uleb128 0x5
+	.string	"dst"
+	.byte	0x51
+	.byte	0x29
+	.long	0x291
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1604
+	.byte	0x6
+	.byte	0x44
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x5
+	.string	"crc"
+	.byte	0x44
+	.byte	0x24
+	.long	0xa9
+	.uleb128 0x1f
+	.long	.LASF1605
+	.byte	0x6
+	.byte	0x44
+	.byte	0x31
+	.long	0x9d
+	.uleb128 0x20
+	.uleb128 0x11
+	.string	"i"
+	.byte	0x47
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 10 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.file 13 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF560
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF578
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF485
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF762
+	.byte	0x4
+	.file 26 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF788
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 30 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 33 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 34 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x22
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x4
+	.file 35 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x23
+	.file 36 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.file 37 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.file 38 "./src/main/build/version.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x4
+	.file 39 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x8
+	.file 40 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x28
+	.file 41 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1010
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1011
+	.byte	0x4
+	.file 42 "./src/main/sensors/current.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2a
+	.file 43 "./src/main/sensors/current_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x4
+	.file 44 "./src/main/sensors/voltage.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2c
+	.file 45 "./src/main/sensors/voltage_ids.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.file 46 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 47 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2f
+	.file 48 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x30
+	.file 49 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 50 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 51 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 52 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1417
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1418
+	.byte	0x4
+	.file 53 "./src/main/fc/rc_controls.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 54 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 55 "./src/main/flight/imu.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 57 "./src/main/telemetry/telemetry.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1487
+	.byte	0x4
+	.file 58 "./src/main/telemetry/srxl.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x3a
+	.byte	0x4
+	.file 59 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x3b
+	.file 60 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3c
+	.byte	0x4
+	.file 61 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3d
+	.byte	0x4
+	.file 62 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 63 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3f
+	.byte	0x4
+	.file 64 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 65 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1493
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1509
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF428
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF484
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF498
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF545
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF559
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF577
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.b7a4729c1073310331157d0d7c0b7649,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF592
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF594
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF596
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF598
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF783
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.201.8b38d8493bb01a2e7497259d1f7bbb2e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF837
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF850
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF851
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF870
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF916
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF978
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.ab1ea5032441cd47c4f3251c83c3755e,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF989
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1005
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.31fb1e83fe3d83410c4c6c22c2adb436,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1009
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.voltage.h.54.5495ac5e2d82cbc94d05d11f3e14d280,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1015
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.24.e017ef80d2ce896adf6bb35ffa902a57,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1024
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1036
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1048
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1444
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1481
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.spektrum.h.20.7eabd3dc96720430f10f642c53b6edaf,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1486
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1489
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1492
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF1611
+	.long	.LASF1612
+	.long	.LASF1613
+	.long	.LASF1614
+	.long	.LASF1615
+	.long	.LASF1616
+	.long	.LASF1617
+	.long	.LASF1618
+	.long	.LASF1619
+	.long	.LASF1620
+	.long	.LASF1621
+	.long	.LASF1622
+	.long	.LASF1623
+	.long	.LASF1624
+	.long	.LASF1625
+	.long	.LASF1626
+	.long	.LASF1627
+	.long	.LASF1628
+	.long	.LASF1629
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x42
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1630
+	.byte	0xf
+	.long	.LASF1631
+	.byte	0xf
+	.long	.LASF1632
+	.byte	0xf
+	.long	.LASF1633
+	.byte	0x2
+	.long	.LASF1634
+	.byte	0x2
+	.long	.LASF1635
+	.byte	0xc
+	.long	.LASF1636
+	.byte	0x8
+	.long	.LASF1637
+	.byte	0x9
+	.long	.LASF1638
+	.byte	0x4
+	.long	.LASF1639
+	.byte	0x12
+	.long	.LASF1640
+	.byte	0x13
+	.long	.LASF1641
+	.byte	0x13
+	.long	.LASF1641
+	.byte	0x12
+	.long	.LASF1642
+	.byte	0xf
+	.long	.LASF1643
+	.byte	0x12
+	.long	.LASF1644
+	.byte	0x12
+	.long	.LASF1645
+	.byte	0xf
+	.long	.LASF1646
+	.byte	0xf
+	.long	.LASF1647
+	.byte	0x11
+	.long	.LASF1648
+	.byte	0xf
+	.long	.LASF1649
+	.byte	0x10
+	.long	.LASF1650
+	.byte	0x10
+	.long	.LASF1651
+	.byte	0xf
+	.long	.LASF1652
+	.byte	0xf
+	.long	.LASF1653
+	.byte	0xf
+	.long	.LASF1654
+	.byte	0x12
+	.long	.LASF1655
+	.byte	0x13
+	.long	.LASF1656
+	.byte	0xe
+	.long	.LASF1657
+	.byte	0xe
+	.long	.LASF1658
+	.byte	0x12
+	.long	.LASF1659
+	.byte	0xd
+	.long	.LASF1660
+	.byte	0xb
+	.long	.LASF1661
+	.byte	0xa
+	.long	.LASF1662
+	.byte	0xb
+	.long	.LASF1663
+	.byte	0x3
+	.long	.LASF1664
+	.byte	0x3
+	.long	.LASF1665
+	.byte	0x1
+	.long	.LASF1666
+	.byte	0x1
+	.long	.LASF1667
+	.byte	0x2
+	.long	.LASF1668
+	.byte	0x2
+	.long	.LASF1669
+	.byte	0x2
+	.long	.LASF1670
+	.byte	0x9
+	.long	.LASF1671
+	.byte	0x9
+	.long	.LASF1672
+	.byte	0x9
+	.long	.LASF1673
+	.byte	0x9
+	.long	.LASF1674
+	.byte	0x7
+	.long	.LASF1675
+	.byte	0x7
+	.long	.LASF1675
+	.byte	0x4
+	.long	.LASF1676
+	.byte	0x4
+	.long	.LASF1677
+	.byte	0x4
+	.long	.LASF1678
+	.byte	0x4
+	.long	.LASF1679
+	.byte	0x4
+	.long	.LASF1680
+	.byte	0x5
+	.long	.LASF1681
+	.byte	0x5
+	.long	.LASF1682
+	.byte	0x6
+	.long	.LASF1683
+	.byte	0x8
+	.long	.LASF1684
+	.byte	0xc
+	.long	.LASF1685
+	.byte	0xc
+	.long	.LASF1686
+	.byte	0x5
+	.long	.LASF1687
+	.byte	0x4
+	.long	.LASF1688
+	.byte	0x4
+	.long	.LASF1689
+	.byte	0x4
+	.long	.LASF1690
+	.byte	0x4
+	.long	.LASF1691
+	.byte	0x4
+	.long	.LASF1692
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1408:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1425:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF739:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1437:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1044:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1127:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1340:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1070:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF861:
+	.string	"_WCHAR_T_DEFINED "
+.LASF832:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF747:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF500:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF462:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF801:
+	.string	"USE_CLI "
+.LASF1164:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1262:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF527:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF893:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF405:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF731:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF897:
+	.string	"USE_PPM"
+.LASF1182:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF486:
+	.string	"__USE_MISC 1"
+.LASF1412:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"USE_SERIALRX_CRSF "
+.LASF982:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF1311:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1584:
+	.string	"sbufSwitchToReader"
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF880:
+	.string	"USE_FAKE_GYRO "
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF956:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1050:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF551:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF899:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1516:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF957:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1529:
+	.string	"_Bool"
+.LASF572:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF894:
+	.string	"USE_UART8 "
+.LASF877:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1029:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF827:
+	.string	"TELEMETRY_SRXL "
+.LASF504:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1538:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1440:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1033:
+	.string	"IOCFG_AF_OD 0"
+.LASF962:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1101:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1051:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF428:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1335:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1502:
+	.string	"SRXL_POLY 0x1021"
+.LASF1281:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF978:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1145:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1448:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1040:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF853:
+	.string	"__WCHAR_T__ "
+.LASF833:
+	.string	"USE_SENSOR_NAMES "
+.LASF1404:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF399:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1376:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1114:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1322:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1535:
+	.string	"OWNER_LED"
+.LASF525:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1600:
+	.string	"srxlFinalize"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1524:
+	.string	"uint16_t"
+.LASF1104:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1414:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF506:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF816:
+	.string	"TELEMETRY_HOTT "
+.LASF968:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1310:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1068:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF941:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1111:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF439:
+	.string	"_ISOC95_SOURCE"
+.LASF842:
+	.string	"_T_PTRDIFF_ "
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1463:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1224:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1190:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF426:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1001:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1260:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF966:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF852:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1063:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF417:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1421:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1367:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1093:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF563:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1593:
+	.string	"srxlPtr"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1227:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF540:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1403:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1542:
+	.string	"OWNER_SERIAL_RX"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF523:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1071:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1036:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF959:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF998:
+	.string	"BIT(x) (1 << (x))"
+.LASF1567:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1488:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF961:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1079:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF981:
+	.string	"FC_VERSION_MINOR 2"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1522:
+	.string	"int32_t"
+.LASF976:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1579:
+	.string	"srxlFrame"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF502:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF883:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF789:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF863:
+	.string	"___int_wchar_t_h "
+.LASF1379:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1325:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1507:
+	.string	"TELE_PBOX_ALARM_RESERVED_1 (0x40)"
+.LASF408:
+	.string	"__USE_ISOC11"
+.LASF1042:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF972:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1146:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF924:
+	.string	"USE_RESOURCE_MGMT"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF922:
+	.string	"VTX_TRAMP"
+.LASF1485:
+	.string	"SRXL_FRAME_OVERHEAD 5"
+.LASF573:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1564:
+	.string	"OWNER_BARO_EXTI"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF546:
+	.string	"__always_inline"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF481:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF898:
+	.string	"USE_PWM"
+.LASF756:
+	.string	"UINTMAX_WIDTH 64"
+.LASF1407:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1208:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1541:
+	.string	"OWNER_SERIAL_TX"
+.LASF906:
+	.string	"USE_SERIALRX_XBUS"
+.LASF984:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1149:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1601:
+	.string	"srxlSerialize16"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF829:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF529:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1142:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1504:
+	.string	"TELE_PBOX_ALARM_VOLTAGE_2 (0x02)"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1265:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF519:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF828:
+	.string	"USE_DASHBOARD "
+.LASF475:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1458:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1305:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF580:
+	.string	"__stub_chflags "
+.LASF1431:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1565:
+	.string	"OWNER_USB"
+.LASF1110:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF402:
+	.string	"false 0"
+.LASF1576:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF781:
+	.string	"_GCC_SIZE_T "
+.LASF584:
+	.string	"__stub_setlogin "
+.LASF1222:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF441:
+	.string	"_ISOC99_SOURCE"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF586:
+	.string	"__stub_stty "
+.LASF1019:
+	.string	"GPS_PROVIDER_MAX GPS_UBLOX"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF482:
+	.string	"__WORDSIZE 64"
+.LASF587:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1287:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1094:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1546:
+	.string	"OWNER_SONAR_ECHO"
+.LASF913:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF558:
+	.string	"__attribute_copy__"
+.LASF1328:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF778:
+	.string	"_SIZE_T_DECLARED "
+.LASF1274:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF588:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1045:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1534:
+	.string	"OWNER_SERVO"
+.LASF1141:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF881:
+	.string	"ACC "
+.LASF539:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF824:
+	.string	"TELEMETRY_IBUS "
+.LASF803:
+	.string	"USE_PWM "
+.LASF1358:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF854:
+	.string	"_WCHAR_T "
+.LASF1493:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF599:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1449:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1154:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF958:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1561:
+	.string	"OWNER_RX_SPI_CS"
+.LASF1483:
+	.string	"SPEKTRUM_SAT_BIND_MAX 10"
+.LASF848:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1077:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1454:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1368:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1517:
+	.string	"__uint16_t"
+.LASF1433:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1533:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1161:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF937:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF467:
+	.string	"__USE_POSIX 1"
+.LASF412:
+	.string	"__USE_POSIX"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF873:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1194:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1136:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1049:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF570:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF447:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1080:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1371:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF589:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF949:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1419:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1006:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF595:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1197:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF556:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF994:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1202:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1389:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1388:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1510:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF571:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1028:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF960:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF849:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1331:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1391:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1277:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF364:
+	.string	"__k8 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1428:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1527:
+	.string	"float"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF410:
+	.string	"__USE_ISOC95"
+.LASF964:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF409:
+	.string	"__USE_ISOC99"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1350:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1166:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1577:
+	.string	"srxlTelemetryEnabled"
+.LASF879:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF830:
+	.string	"USE_MSP_PUSH "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1211:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF825:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF841:
+	.string	"_PTRDIFF_T "
+.LASF1589:
+	.string	"sbufWriteU8"
+.LASF567:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_XOPEN2K"
+.LASF1118:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF415:
+	.string	"__USE_POSIX199506"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1086:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF770:
+	.string	"_T_SIZE_ "
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF792:
+	.string	"_STRINGS_H 1"
+.LASF1007:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF457:
+	.string	"_DEFAULT_SOURCE"
+.LASF1123:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1108:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1573:
+	.string	"OWNER_VTX"
+.LASF545:
+	.string	"__wur "
+.LASF1353:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1450:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF508:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF940:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1184:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF458:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF860:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1189:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1278:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1268:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF811:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1257:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1555:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF740:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1374:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1320:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF561:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1163:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1035:
+	.string	"IOCFG_IPU 0"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF518:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1239:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1155:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1466:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF582:
+	.string	"__stub_gtty "
+.LASF1073:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1499:
+	.string	"SRXL_FRAMETYPE_TELE_RPM 0x7E"
+.LASF422:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1085:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF1125:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF986:
+	.string	"MW_VERSION 231"
+.LASF1438:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF485:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF456:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF989:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF871:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1394:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF1280:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1323:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF800:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1406:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1498:
+	.string	"SRXL_FRAMETYPE_TELE_QOS 0x7F"
+.LASF1060:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1423:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF1128:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1151:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF431:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1352:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1159:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1474:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF944:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF531:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1566:
+	.string	"OWNER_USB_DETECT"
+.LASF1245:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1031:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1026:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF424:
+	.string	"__USE_LARGEFILE64"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF547:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF488:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF542:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF872:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF576:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF532:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1214:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF435:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF874:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF780:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF775:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1570:
+	.string	"OWNER_INVERTER"
+.LASF916:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1223:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1550:
+	.string	"OWNER_SPI_MOSI"
+.LASF1377:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1523:
+	.string	"uint8_t"
+.LASF1122:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF581:
+	.string	"__stub_fchflags "
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF926:
+	.string	"USE_DSHOT"
+.LASF996:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF979:
+	.string	"FC_FIRMWARE_NAME \"Betaflight\""
+.LASF814:
+	.string	"TELEMETRY "
+.LASF416:
+	.string	"__USE_XOPEN"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1229:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF438:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1470:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF483:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1027:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF574:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF865:
+	.string	"_GCC_WCHAR_T "
+.LASF559:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF911:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF566:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1316:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1343:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF764:
+	.string	"__need_size_t "
+.LASF1235:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1121:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF465:
+	.string	"__USE_ISOC99 1"
+.LASF868:
+	.string	"_BSD_WCHAR_T_"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF912:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF822:
+	.string	"CMS "
+.LASF565:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF773:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1430:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1446:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1043:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF784:
+	.string	"__need_size_t"
+.LASF1532:
+	.string	"OWNER_PPMINPUT"
+.LASF895:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF851:
+	.string	"__need_ptrdiff_t"
+.LASF478:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF751:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF794:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF1602:
+	.string	"srxlSerialize8"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1023:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF838:
+	.string	"_STDDEF_H "
+.LASF886:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF442:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1074:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF762:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1173:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF418:
+	.string	"__USE_UNIX98"
+.LASF1455:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF479:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF1000:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF511:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF977:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF967:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1089:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF796:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1481:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1112:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1158:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF923:
+	.string	"BLACKBOX"
+.LASF1326:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1272:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF908:
+	.string	"LED_STRIP"
+.LASF1307:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF748:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF553:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1092:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1183:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF489:
+	.string	"__USE_GNU 1"
+.LASF904:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF905:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1429:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1218:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF815:
+	.string	"TELEMETRY_FRSKY "
+.LASF1047:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF493:
+	.string	"__GNU_LIBRARY__"
+.LASF1370:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1545:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1346:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1292:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1196:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1199:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1426:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF1586:
+	.string	"srxlRxIsActive"
+.LASF903:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1095:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF526:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF446:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1487:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF406:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF1238:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF785:
+	.string	"NULL"
+.LASF1217:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1400:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1547:
+	.string	"OWNER_SYSTEM"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF965:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF930:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF499:
+	.string	"__PMT"
+.LASF866:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1333:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF734:
+	.string	"UINT32_WIDTH 32"
+.LASF925:
+	.string	"USE_SERVOS"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1244:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF797:
+	.string	"I2C2_OVERCLOCK true"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1453:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1209:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1120:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1250:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1508:
+	.string	"TELE_PBOX_ALARM_RESERVED_2 (0x80)"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF552:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1084:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF856:
+	.string	"_T_WCHAR "
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF454:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1010:
+	.string	"MAX_FIR_DENOISE_WINDOW_SIZE 120"
+.LASF1091:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1193:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF495:
+	.string	"__GLIBC__ 2"
+.LASF1275:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1604:
+	.string	"srxlCrc16"
+.LASF1015:
+	.string	"MAX_VOLTAGE_SENSOR_ADC 1"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF858:
+	.string	"_WCHAR_T_ "
+.LASF1054:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF939:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1254:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1606:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF509:
+	.string	"__P(args) args"
+.LASF1435:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF820:
+	.string	"USE_SERVOS "
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF963:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF793:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF769:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF761:
+	.string	"WINT_WIDTH 32"
+.LASF1087:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1075:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1230:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1053:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1364:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF430:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF808:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1137:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1024:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1295:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF421:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1337:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"__need_NULL"
+.LASF870:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1090:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF434:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF484:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF423:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF802:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1066:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF516:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF907:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF900:
+	.string	"USE_SERIALRX_CRSF"
+.LASF1441:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF469:
+	.string	"__USE_POSIX199309 1"
+.LASF1175:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF934:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1140:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1447:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1581:
+	.string	"sbufPtr"
+.LASF1436:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF443:
+	.string	"_ISOC11_SOURCE"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF515:
+	.string	"__END_DECLS "
+.LASF1490:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF991:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1553:
+	.string	"OWNER_SDCARD"
+.LASF1156:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF763:
+	.string	"_STRING_H 1"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1395:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF985:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF569:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1242:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1511:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1514:
+	.string	"signed char"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1143:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1497:
+	.string	"SRXL_PACKET_LENGTH 0x15"
+.LASF1509:
+	.string	"SRXL_SCHEDULE_COUNT_MAX 3"
+.LASF1355:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF766:
+	.string	"__size_t__ "
+.LASF818:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF471:
+	.string	"__USE_XOPEN2K 1"
+.LASF819:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1106:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1392:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF862:
+	.string	"_WCHAR_T_H "
+.LASF1338:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF535:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF453:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF730:
+	.string	"UINT8_WIDTH 8"
+.LASF600:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF579:
+	.string	"__stub___compat_bdflush "
+.LASF1486:
+	.string	"SRXL_FRAME_SIZE_MAX (SPEK_FRAME_SIZE + SRXL_FRAME_OVERHEAD)"
+.LASF1506:
+	.string	"TELE_PBOX_ALARM_CAPACITY_2 (0x08)"
+.LASF1301:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1220:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1592:
+	.string	"srxlPayloadBuf"
+.LASF1445:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF407:
+	.string	"_FEATURES_H 1"
+.LASF1460:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF774:
+	.string	"_BSD_SIZE_T_ "
+.LASF1119:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1319:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF920:
+	.string	"VTX_CONTROL"
+.LASF537:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF917:
+	.string	"USE_DASHBOARD"
+.LASF817:
+	.string	"TELEMETRY_LTM "
+.LASF1462:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1052:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1057:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF777:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1427:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF578:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1467:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1525:
+	.string	"uint32_t"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1298:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1575:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF938:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1132:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF445:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF452:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF812:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF840:
+	.string	"_ANSI_STDDEF_H "
+.LASF1568:
+	.string	"OWNER_OSD"
+.LASF503:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1100:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1359:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1025:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1061:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1451:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF928:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1098:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF568:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1587:
+	.string	"getAmperage"
+.LASF806:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1135:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1041:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1076:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF836:
+	.string	"VTX_SMARTAUDIO "
+.LASF1003:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1205:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1444:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1067:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1185:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF929:
+	.string	"USE_PROFILE "
+.LASF513:
+	.string	"__ptr_t void *"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1424:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF973:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF821:
+	.string	"GPS "
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1253:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF919:
+	.string	"VTX_COMMON"
+.LASF1109:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF365:
+	.string	"__k8__ 1"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1048:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF411:
+	.string	"__USE_ISOCXX11"
+.LASF1341:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1520:
+	.string	"long int"
+.LASF987:
+	.string	"GIT_SHORT_REVISION_LENGTH 7"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF1170:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF437:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1188:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1543:
+	.string	"OWNER_PINDEBUG"
+.LASF1115:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1596:
+	.string	"currentTimeUs"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1382:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF749:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF510:
+	.string	"__PMT(args) args"
+.LASF823:
+	.string	"TELEMETRY_CRSF "
+.LASF845:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1595:
+	.string	"srxlFramePowerBox"
+.LASF844:
+	.string	"__PTRDIFF_T "
+.LASF1496:
+	.string	"SRXL_ADDRESS_SECOND 0x80"
+.LASF736:
+	.string	"UINT64_WIDTH 64"
+.LASF1215:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF741:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF498:
+	.string	"_SYS_CDEFS_H 1"
+.LASF995:
+	.string	"EXPAND_I(x) x"
+.LASF1191:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1464:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1148:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF745:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF772:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1443:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF436:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF355:
+	.string	"__amd64 1"
+.LASF733:
+	.string	"INT32_WIDTH 32"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1608:
+	.string	"srxlScheduleFuncs"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF771:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1603:
+	.string	"srxlInitializeFrame"
+.LASF468:
+	.string	"__USE_POSIX2 1"
+.LASF867:
+	.string	"__DEFINED_wchar_t "
+.LASF1442:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF522:
+	.string	"__flexarr []"
+.LASF813:
+	.string	"LED_STRIP "
+.LASF528:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF909:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF746:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1365:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF980:
+	.string	"FC_VERSION_MAJOR 3"
+.LASF592:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF975:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF855:
+	.string	"_T_WCHAR_ "
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1131:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF449:
+	.string	"_POSIX_C_SOURCE"
+.LASF757:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1206:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1544:
+	.string	"OWNER_TIMER"
+.LASF935:
+	.string	"USED_TIMERS 0"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1117:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1314:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1344:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1290:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF947:
+	.string	"__enable_irq() "
+.LASF1349:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1016:
+	.string	"LAT 0"
+.LASF742:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1521:
+	.string	"char"
+.LASF1459:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1187:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF585:
+	.string	"__stub_sigreturn "
+.LASF1124:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1271:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF491:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF752:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1032:
+	.string	"IOCFG_AF_PP 0"
+.LASF1432:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF878:
+	.string	"LED0_PIN NONE"
+.LASF544:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1251:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF768:
+	.string	"_SIZE_T "
+.LASF888:
+	.string	"USE_UART2 "
+.LASF450:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF541:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1099:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF487:
+	.string	"__USE_ATFILE 1"
+.LASF1259:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF831:
+	.string	"USE_RX_MSP "
+.LASF993:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1233:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF401:
+	.string	"true 1"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1439:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1580:
+	.string	"srxlSchedulePtr"
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF776:
+	.string	"_SIZE_T_DEFINED "
+.LASF1475:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1014:
+	.string	"VBATT_LPF_FREQ 1.0f"
+.LASF461:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF1011:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1465:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF403:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF783:
+	.string	"__size_t "
+.LASF765:
+	.string	"__need_NULL "
+.LASF1495:
+	.string	"SRXL_ADDRESS_FIRST 0xA5"
+.LASF1008:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF948:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1102:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1591:
+	.string	"srxlScheduleIndex"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1236:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF786:
+	.string	"NULL ((void *)0)"
+.LASF1415:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1556:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF737:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF983:
+	.string	"STR_HELPER(x) #x"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF921:
+	.string	"VTX_SMARTAUDIO"
+.LASF807:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1548:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1152:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF534:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1540:
+	.string	"OWNER_ADC_RSSI"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF1313:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"USE_SERIALRX_SBUS"
+.LASF884:
+	.string	"USE_FAKE_BARO "
+.LASF564:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1452:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1130:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF549:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF869:
+	.string	"__need_wchar_t"
+.LASF974:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1105:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF843:
+	.string	"_T_PTRDIFF "
+.LASF501:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF480:
+	.string	"__USE_LARGEFILE 1"
+.LASF1582:
+	.string	"sbufBytesRemaining"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF590:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1478:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF882:
+	.string	"USE_FAKE_ACC "
+.LASF455:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1293:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1598:
+	.string	"srxlFrameQos"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF575:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF577:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1256:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF931:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1172:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1500:
+	.string	"SRXL_FRAMETYPE_POWERBOX 0x0A"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1398:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1334:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1072:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF464:
+	.string	"__USE_ISOC11 1"
+.LASF1410:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF517:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1578:
+	.string	"srxlCrc"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF382:
+	.string	"unix 1"
+.LASF1116:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF433:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF476:
+	.string	"_LARGEFILE_SOURCE"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF969:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF425:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF799:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF795:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF970:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1304:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1494:
+	.string	"SRXL_CYCLETIME_US 100000"
+.LASF451:
+	.string	"_XOPEN_SOURCE"
+.LASF1160:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1489:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1551:
+	.string	"OWNER_I2C_SCL"
+.LASF1549:
+	.string	"OWNER_SPI_MISO"
+.LASF1065:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1574:
+	.string	"OWNER_COMPASS_CS"
+.LASF1002:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1088:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF460:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1221:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF859:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1169:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF943:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF536:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1518:
+	.string	"__int32_t"
+.LASF1552:
+	.string	"OWNER_I2C_SDA"
+.LASF1480:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1519:
+	.string	"__uint32_t"
+.LASF429:
+	.string	"__USE_GNU"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF413:
+	.string	"__USE_POSIX2"
+.LASF1605:
+	.string	"data"
+.LASF1317:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1583:
+	.string	"srxlRxWriteTelemetryData"
+.LASF910:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1362:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1107:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF533:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1557:
+	.string	"OWNER_FLASH"
+.LASF1397:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF1034:
+	.string	"IOCFG_IPD 0"
+.LASF420:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1296:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1572:
+	.string	"OWNER_TRANSPONDER"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1477:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1422:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF743:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1308:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1473:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1083:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1013:
+	.string	"VBAT_SCALE_MAX 255"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF839:
+	.string	"_STDDEF_H_ "
+.LASF1046:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1064:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1413:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1082:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1167:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1283:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1461:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1059:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF1126:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1200:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1266:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1569:
+	.string	"OWNER_RX_BIND"
+.LASF735:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF835:
+	.string	"VTX_CONTROL "
+.LASF1302:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1020:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF414:
+	.string	"__USE_POSIX199309"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF1491:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF732:
+	.string	"UINT16_WIDTH 16"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF846:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF857:
+	.string	"__WCHAR_T "
+.LASF593:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1212:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF448:
+	.string	"_POSIX_SOURCE 1"
+.LASF1482:
+	.string	"SPEKTRUM_SAT_BIND_DISABLED 0"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1420:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1610:
+	.string	"initSrxlTelemetry"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1069:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF999:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF463:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF1528:
+	.string	"timeUs_t"
+.LASF876:
+	.string	"U_ID_1 1"
+.LASF875:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF927:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF477:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1559:
+	.string	"OWNER_MPU_CS"
+.LASF1562:
+	.string	"OWNER_SPI_CS"
+.LASF1037:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1607:
+	.string	"sbuf_s"
+.LASF1526:
+	.string	"sbuf_t"
+.LASF1103:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1456:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1361:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF918:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1017:
+	.string	"LON 1"
+.LASF744:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF885:
+	.string	"MAG "
+.LASF514:
+	.string	"__BEGIN_DECLS "
+.LASF554:
+	.string	"__restrict_arr __restrict"
+.LASF1597:
+	.string	"srxlFrameRpm"
+.LASF1299:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1004:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF404:
+	.string	"_STDINT_H 1"
+.LASF524:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF946:
+	.string	"__disable_irq() "
+.LASF1303:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1380:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1484:
+	.string	"SPEK_FRAME_SIZE 16"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF470:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1226:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF936:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF583:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF555:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"strdupa(s) (__extension__ ({ const char *__old = (s); size_t __len = strlen (__old) + 1; char *__new = (char *) __builtin_alloca (__len); (char *) memcpy (__new, __old, __len); }))"
+.LASF472:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1005:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF521:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF809:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1471:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1537:
+	.string	"OWNER_ADC_BATT"
+.LASF1530:
+	.string	"OWNER_FREE"
+.LASF945:
+	.string	"EEPROM_SIZE 32768"
+.LASF1203:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF755:
+	.string	"INTMAX_WIDTH 64"
+.LASF1232:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1479:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF459:
+	.string	"_ATFILE_SOURCE"
+.LASF1078:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1009:
+	.string	"GET_DIRECTION(isReversed) ((isReversed) ? -1 : 1)"
+.LASF754:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1058:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1286:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF492:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1097:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1531:
+	.string	"OWNER_PWMINPUT"
+.LASF597:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1181:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1434:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1594:
+	.string	"handleSrxlTelemetry"
+.LASF530:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF753:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1263:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1021:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1599:
+	.string	"processSrxl"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF758:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF400:
+	.string	"bool _Bool"
+.LASF847:
+	.string	"___int_ptrdiff_t_h "
+.LASF444:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1081:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF557:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF791:
+	.string	"strndupa(s,n) (__extension__ ({ const char *__old = (s); size_t __len = strnlen (__old, (n)); char *__new = (char *) __builtin_alloca (__len + 1); __new[__len] = '\\0'; (char *) memcpy (__new, __old, __len); }))"
+.LASF997:
+	.string	"UNUSED(x) (void)(x)"
+.LASF804:
+	.string	"SERIAL_RX "
+.LASF1401:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1055:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1012:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1385:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"TELEMETRY_MAVLINK "
+.LASF494:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1157:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1030:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1590:
+	.string	"srxlLastCycleTime"
+.LASF864:
+	.string	"__INT_WCHAR_T_H "
+.LASF1492:
+	.string	"BEEP_ON do {} while(0)"
+.LASF1468:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF1554:
+	.string	"OWNER_SDCARD_CS"
+.LASF932:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1505:
+	.string	"TELE_PBOX_ALARM_CAPACITY_1 (0x04)"
+.LASF1096:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1022:
+	.string	"GPS_PACKET_LOG_ENTRY_COUNT 21"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"__DEFINED_size_t "
+.LASF1062:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1248:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF988:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF887:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1383:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1329:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1178:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1609:
+	.string	"checkSrxlTelemetryState"
+.LASF1134:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF760:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF427:
+	.string	"__USE_ATFILE"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1356:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF380:
+	.string	"__unix 1"
+.LASF560:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF933:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF1585:
+	.string	"sbufWriteU16"
+.LASF1513:
+	.string	"long unsigned int"
+.LASF1038:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1571:
+	.string	"OWNER_LED_STRIP"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF990:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF834:
+	.string	"VTX_COMMON "
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF837:
+	.string	"VTX_TRAMP "
+.LASF594:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF596:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1018:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1469:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1476:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF759:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1289:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF788:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF738:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1457:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF889:
+	.string	"USE_UART3 "
+.LASF1503:
+	.string	"TELE_PBOX_ALARM_VOLTAGE_1 (0x01)"
+.LASF1588:
+	.string	"getBatteryVoltage"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1056:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1241:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF767:
+	.string	"__SIZE_T__ "
+.LASF1039:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1113:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1558:
+	.string	"OWNER_BARO_CS"
+.LASF520:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF512:
+	.string	"__STRING(x) #x"
+.LASF1139:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF490:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF473:
+	.string	"__USE_XOPEN 1"
+.LASF750:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1512:
+	.string	"unsigned int"
+.LASF890:
+	.string	"USE_UART4 "
+.LASF1247:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1409:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF1472:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF992:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF598:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF543:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1501:
+	.string	"SRXL_FRAMETYPE_SID 0x00"
+.LASF1347:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1133:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF496:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1284:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1536:
+	.string	"OWNER_ADC"
+.LASF1515:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1563:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF507:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1417:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1176:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1386:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF29:
+	.string	"_LP64 1"
+.LASF891:
+	.string	"USE_UART5 "
+.LASF1332:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1418:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF914:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1539:
+	.string	"OWNER_ADC_EXT"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1129:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF729:
+	.string	"INT8_WIDTH 8"
+.LASF562:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF942:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1560:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1373:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF850:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF971:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF591:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF466:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1416:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF892:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF1179:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1685:
+	.string	"srxl.h"
+.LASF1633:
+	.string	"streambuf.h"
+.LASF1682:
+	.string	"imu.h"
+.LASF1648:
+	.string	"long-double.h"
+.LASF1657:
+	.string	"__locale_t.h"
+.LASF1659:
+	.string	"platform.h"
+.LASF1618:
+	.string	"src/main/rx"
+.LASF1636:
+	.string	"spektrum.h"
+.LASF1614:
+	.string	"src/main/drivers"
+.LASF1637:
+	.string	"battery.h"
+.LASF1642:
+	.string	"libc-header-start.h"
+.LASF1627:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1678:
+	.string	"io_def.h"
+.LASF1631:
+	.string	"stdint-intn.h"
+.LASF1661:
+	.string	"target.h"
+.LASF1669:
+	.string	"axis.h"
+.LASF1626:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1629:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1649:
+	.string	"stubs.h"
+.LASF1676:
+	.string	"io.h"
+.LASF1620:
+	.string	"src/main/target/SITL"
+.LASF1683:
+	.string	"rx.h"
+.LASF1617:
+	.string	"src/main/io"
+.LASF1635:
+	.string	"srxl.c"
+.LASF1647:
+	.string	"cdefs.h"
+.LASF1625:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1686:
+	.string	"config.h"
+.LASF0:
+	.string	"./src/main/telemetry/srxl.c"
+.LASF1658:
+	.string	"strings.h"
+.LASF1644:
+	.string	"features-time64.h"
+.LASF1692:
+	.string	"vcd.h"
+.LASF1680:
+	.string	"rc_controls.h"
+.LASF1630:
+	.string	"types.h"
+.LASF1677:
+	.string	"io_types.h"
+.LASF1646:
+	.string	"timesize.h"
+.LASF1640:
+	.string	"stdbool.h"
+.LASF1628:
+	.string	"/usr/include"
+.LASF1672:
+	.string	"voltage.h"
+.LASF1611:
+	.string	"src/main/build"
+.LASF1663:
+	.string	"feature.h"
+.LASF1643:
+	.string	"features.h"
+.LASF1616:
+	.string	"src/main/flight"
+.LASF1651:
+	.string	"typesizes.h"
+.LASF1612:
+	.string	"src/main/common"
+.LASF1675:
+	.string	"serial.h"
+.LASF1613:
+	.string	"src/main/config"
+.LASF1690:
+	.string	"sdcard.h"
+.LASF1688:
+	.string	"flash.h"
+.LASF1652:
+	.string	"time64.h"
+.LASF1691:
+	.string	"sound_beeper.h"
+.LASF1632:
+	.string	"stdint-uintn.h"
+.LASF1621:
+	.string	"src/main/target"
+.LASF1667:
+	.string	"utils.h"
+.LASF1623:
+	.string	"src/main"
+.LASF1689:
+	.string	"rx_pwm.h"
+.LASF1619:
+	.string	"src/main/sensors"
+.LASF1:
+	.string	"/root/repo"
+.LASF1638:
+	.string	"resource.h"
+.LASF1684:
+	.string	"telemetry.h"
+.LASF1634:
+	.string	"time.h"
+.LASF1622:
+	.string	"src/main/telemetry"
+.LASF1681:
+	.string	"runtime_config.h"
+.LASF1674:
+	.string	"gps.h"
+.LASF1615:
+	.string	"src/main/fc"
+.LASF1660:
+	.string	"common.h"
+.LASF1670:
+	.string	"current.h"
+.LASF1654:
+	.string	"string.h"
+.LASF1624:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1656:
+	.string	"locale_t.h"
+.LASF1641:
+	.string	"stdint.h"
+.LASF1665:
+	.string	"build_config.h"
+.LASF1653:
+	.string	"wchar.h"
+.LASF1650:
+	.string	"stubs-64.h"
+.LASF1673:
+	.string	"voltage_ids.h"
+.LASF1645:
+	.string	"wordsize.h"
+.LASF1655:
+	.string	"stddef.h"
+.LASF1666:
+	.string	"version.h"
+.LASF1679:
+	.string	"io_def_generated.h"
+.LASF1662:
+	.string	"common_post.h"
+.LASF1687:
+	.string	"adc.h"
+.LASF1664:
+	.string	"parameter_group.h"
+.LASF1671:
+	.string	"current_ids.h"
+.LASF1639:
+	.string	"stdc-predef.h"
+.LASF1668:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\b"
+	.text
+	.section	.gnu.lto_.icf.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375 \276\375\004"
+	.string	"\364\007\262"
+	.string	"\021"
+	.string	"\340\270\300\362\017\004\002"
+	.string	"\001\240\342\234\212\n\002\343\311\217\315\007"
+	.string	"\003\370\362\343\212\007\006\002\001\002\002\004\005\320\236\341\231\007"
+	.string	"\006\205\234\363\223\013"
+	.string	"\007\342\361\332\310\t\002\b\323\212\335\337\001\n\002\003\002\003\002\004\002\005\006\002\006\t\352\263\360\321\b\n\240\342\325\376\006\013\343\240\320\373\n\004\002\007\f\r\251\264\365;\002\002\b\002\b\016\017\350\300\306\254\005\020\347\331\350\325\002\002\002\b\002\b"
+	.string	"\f"
+	.ascii	"4\245\314\234\343\2701r\210/\266\256t\255\324\272C\211\330\005"
+	.ascii	"\2613\260\334@\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`\325\001%\004"
+	.string	"\344\003\311\002"
+	.string	"\013"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007\001\002\001\200\f"
+	.string	""
+	.string	"\t\002\001\004\f\t\003\001\004\005"
+	.string	""
+	.string	"\f\t\006\f\t\007\001\001\002\b"
+	.string	"\001\013"
+	.string	"\001\r"
+	.string	"\001"
+	.string	""
+	.string	"\017"
+	.string	"\003\020\001\001\001\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\034"
+	.string	"4\301\277\351`\271\301\033\211n`\260J\266W\304 \210\200"
+	.string	"\200&#\030\370Ni\246\007C\344\231\204\200\261]K\266\203\330P\002*"
+	.ascii	"\276LC\006\f\267q\241\001\346jF\310\031\232%\264\314`\n0\004"
+	.text
+	.section	.gnu.lto_.inline.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`k\003%\t"
+	.string	"\322L+0`M\222\016\230\005"
+	.ascii	"\353\242\0209\373\266\t\244\360\317_\373\266\246i!!ph\253\233"
+	.ascii	"M\017\026\201\260\225 \230\327\355\253G\272\331\266\321l\333"
+	.ascii	"{\247\317\332i\240\257\022z\350\224\210DSU^\331\312K\200r\030"
+	.ascii	"\234\200\310\330P,\324\220\340\330\220\236\250\347>\013/\332"
+	.ascii	"Z\024r\204\323\261)\240\242Y\273\013&I[\202\001\016\223W\333"
+	.ascii	"\201\220\266_C\337\304\232E[\204'\031}\365d\360\243m\345\374"
+	.ascii	"\032\332j\036\377\030\322\241\355\3018k\263\206\177@~\301q\254"
+	.ascii	"\260m\241\317\244\007\006\b\205A\376\022\336\335\267\200\025"
+	.ascii	"\021\035\216\345\247\237\2041 \220\242\222\"\273\001L\201\335"
+	.ascii	"\250\230i0`U\221\t}\001!\013\223\224\273M\200\203\346\033\016"
+	.ascii	"\006\2364\237^`h\220\b\351\245\301\002 \316\313\177\203\331\275"
+	.ascii	"y,B\332\250\355\330\004%S&\3068]Y\003\036\037\266\263u`\373\316"
+	.ascii	"\230\020\204n(8\032\310\005px\260W\bDL.\033\324\347\335\353\026"
+	.ascii	"\261\035\306\246b\212\003\350\272\367uX\266\025-\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`\324\006\275\b"
+	.string	"r\311\033!\2405\031\016\373\037-4\334Z\265\342\372\027fQ\262UU\325\204\203\261&jy\3116\332mo\231ddrw\367\352}\205LH\022\270\226\201\335x\306\235\211\222\002\242c3\352\031\325\211@\212R\311R\233\372\007\202\334\250Z\273\333\\\004\034\347\346\206\313\302\320#\362\203b\362\030\240\312V\3517kzxz\346d)\r\312\332\013_.\036"
+	.ascii	"\001@\250aeuS\220Ba\232\003\220\"\231\"\262\016\022`\022Y\216"
+	.ascii	"\2419\002\343\030\201SNh\224\240L4q\023N0\251\302vlL\335*\323"
+	.ascii	"(z(E}~\314r\037\255bL\336\366\327s\262R\254\306\206\240\0168"
+	.ascii	"\316\221n^\340O\214W`S\322\367\2641\357\324\004\025\351\202\213"
+	.ascii	"\"|\223\247\205\243m\377\207\334\203\"\336\265\233\007\315\247"
+	.ascii	"\323\247.\220\2228Y3\352\243\345\350!9\331\033\212\027\013\n"
+	.ascii	"\2028<\250o\377\374<\326\263\306\020\314j*i\377\351\f<v\220\361"
+	.ascii	"@KH\303%,\030\360F\364\005\366"
+	.text
+	.section	.gnu.lto_.pureconst.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\230\004\002\230\004\003\232\004\005\230\004\006\230\004\007"
+	.ascii	"\230\004\b\230\004\013\230\004\r\230\004\017\204\004\020\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375 \325u\003"
+	.string	"\364\003\311"
+	.string	"\n"
+	.string	"\001\002\f\001"
+	.string	"\002"
+	.string	"\003"
+	.string	"\002\002\r"
+	.string	"\001\002\016"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\300"
+	.string	"\200\001\200\001\200\001"
+	.string	"\005"
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	"\013\001\002\017\001"
+	.string	"\r\001\002\020\001"
+	.string	""
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	"\020"
+	.string	"\024"
+	.string	"5\3471\263\365\316\016\253\006la\2663\007\326\275`\026\304\200"
+	.ascii	" \f\253\250`\271\253\024]p1\256\230\026\276;\033\300\342\r`\001"
+	.text
+	.section	.gnu.lto_.lto.fa75e1b1f8237359,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_srxlInitializeFrame.66.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`>\001\335\f"
+	.string	"F\327TB\020Q\225\016p\211\265Z\b\212\216\332EQ\230n\337\263\3740\232\006@\357\316u"
+	.string	"b\026)\364A\3240v\325\255\004\030,\320~\232\006"
+	.string	""
+	.string	"Pz\004\302\273\337\027i\350\n\001\305\352\375\344o\377\275S\n>"
+	.string	">"
+	.string	"F"
+	.ascii	"\244\017\330E}\270v\303\005V\200"
+	.string	"}:|\206~b'@?\375\3315\036\252\226\002B\004\207\216\033\273[e\210\177\217\237\177\023\257\200\247\322#\345\301\356:\202'\017\267\274\355\004\266\035\330w\005\376\312\242Q<\370\351\217\350g\200\327\210)\2268\266<hl\304a\207\245(S\366'\273\273\226(\373\254_V\350\310\214\002\036\273\035Jrl\310\2041\302\366-6&R\037\355\223x\211\357\254\007\215`\203,9\266d\274\3500\257\026wQ8\360\332\335\354\323E\346\006\351\234\005\310\212\r\243\3325\035\364S\\E\005\177\266xp\303\360V\207\355n\003\277#\224\001\200jE\242\237'\001?|\034D\375\023G\001\nf\260\331d\022\262M\246\021\340u\023\2449\032O\210\353\252\210\363\264\217\346\321\274j\241\023\341S9\\W5\006\274]\320\270\352m\033W-\341~\262\022e\b$!&\251\301\227\230\261\261T\344\022\237\272cP)m\216\026\003\034"
+	.ascii	"~\231\"\023o\200F\303\005\023P\001\357\r\232\330\251\271\003"
+	.ascii	"2\303\350\020\2606a\275Q\220\004\204\201\202\007\300/+\344R\252"
+	.ascii	"U\350b\206&\200jB8\025\030\f\306\246\206\216\313\320\337j4\270"
+	.ascii	"\313\213v\222\001"
+	.text
+	.section	.gnu.lto_srxlSerialize8.67.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`\251\004E\037"
+	.string	"\026\372\306I\240VN:\013\304\250\310\2757\260O\240\267\252\372.\357\351\210\021\264\322\\\277\203\35719\017u|\377\355@i\177\337\016\027\3132\336\034\256\034/\307Ip\003\226e8\336\034\366\360\267p\003\222\364P\250\366-!\204\020\271S\n\255"
+	.string	"\255"
+	.string	"\263"
+	.string	"\265\352|\264\003\363c\216\370\256$\273\366\3615\333\024;\227\332<\fp\357)yk\255z\362c~4\303\316S\373\\\277\201;\216\017\237\251\025\013\bVk/\201u\314\217\356\375\206\374h\276\206\374h\234=\345\275\027\265\274\342r\342\201\245\326z\256\013\233\027{wIq7Kr\024\227\342\374\034'\220\342\267\343-\335\024\313\021QN>\214\242\022}\252PAq\341\351\023OGK\255\251\223R\037]xR\027\305\002J\256\242\300\360@\210\001\252\304L\324xLt/\374\001\252\263\035o\352\264\374\251\265\232\356x$n\332m\247\260=\301\026\267\002Y\366}\2524\311\360b\33187\017\336654%\365LI-\263\3241K\rSR\277\330j$\265\313R\323\216\343'\337\373E\222z\017\274\351R\037@\031\245D"
+	.ascii	"\225Z\241\316\312j\2221\030\343\301\037\350\367x\320\027\272"
+	.ascii	"f\334\303\354\244\353\360\275\016\266U\220\324\276\202(\231U"
+	.ascii	"F\371+\361e\036\006I\017\242\244\2404r%\301\306\035\b\222Y\301"
+	.ascii	"L\247+\256\261Z{:\037i!\316\245\007\372>\376#\351@\220(\230%"
+	.ascii	"t\"\306>\032\202\371Q\206\322\254\316\367x\227\377\243\2558\355"
+	.ascii	"\377\374\035\347\221t\237\205\230KQ\346\257\013j\254\0065\250"
+	.ascii	"\b\035[c#\315\314\322,\365\312a\361\r\244\314\316\354cVf\267"
+	.ascii	"\t\202\303l\314\276\251L\2670K\267\300\370f\334\006\260k(n _"
+	.ascii	"\366\326%\306D\265\330\266/{)6\237\326\376Fd\t[\353\374\3017"
+	.ascii	"X\221\023^\334jA}V\265\234\334\356\326\366a\237\361r\222\242"
+	.ascii	"\255\313\232:\231\231\267\020\362K[z\245\251LG\317\374\260\273"
+	.ascii	"\370T\f\017\366\233\360\235XR)\331\327)%\363\356O\356CN\004\311"
+	.ascii	"\207\341\013C\364\273!\362\343n\314\023*\322\314\205~\311\265"
+	.ascii	"\211\212\350w\316\001\261K\026\367{'\263\034=3\365m\031VJf\367"
+	.ascii	"tt\003@G@\026\304\240[\320\016\235\303\315\323\323\343S\301\247"
+	.ascii	"\307gG\346\310\310\302:h\007"
+	.string	"C\207\233\321\351\341v$D$\204A\350\350\3140\004Dt\006\335\214\316\235\001.\322 t;\217\212\212ng\255\227\273X\332\226\356S\004^\222\334\352L\367\310\245\354\254\370\301\257\347\370\241|gIr\224\354\206\271Y.\215\2207{\341M,ZfT\3476\373d\221\3041\231hM\241\265\265\355S\221\333\354\003(LT\313\224\317jh\333\003m\366A\261\326Z\313\315\362\002\032c\315\036kF\225H\2638\373d\337\354\203\bn\2637\373\246*\035={\225\317j\210#$k~\003\244mk\226z5\225\351\002\\\250Q<\245\224Q\304(4$\"\205I\232\003p\002\031*3\017\020P\311$JZ\003~\252\016<\026XfPl\026D\222=\206f,\026k,\240 qr\\\237D\317\210\377\261\033\303I9j\371\220\003R\240\024\033\230O\336\001\356\n\035\310c]PMJB\2115\r\017_~o\352\221"
+	.string	".6\326\352X7c\331\372\013\301\273\003\253j`\006HE\261\3016@o\276\312\037t\004\016\3461\264\254\274\210B\234\224\251\305\026\3671\340\226\215\"\017\345\267\372\260\366\375\211\f\374m\322\341\bsBXy<\364\354"
+	.ascii	":\3309\003AUG?\204sHy|\033\317708\201`5 \350yP{\270\372\323E"
+	.ascii	"[\314\377\317\316\352T"
+	.text
+	.section	.gnu.lto_srxlFinalize.69.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"%\f"
+	.string	"\326\027TA\020Q\234\016s\031D\n\360OF\205h}\017N\343\237G"
+	.string	"\233\2471[ \252%\200\225>\226\220\177\224\330\300\344s\b\366\247\020\254\214\020Q\303T\\d\376\366E*\034\002n\377\320Ho\"eJ\001@"
+	.string	">"
+	.string	"A"
+	.string	"\334M\037\027\260[\212!c\367[`\005\224C\177\037P\035R\216\251\016\315\3319\376\235X\213D\r\020\027:v7\252\211sO\316\177\311+^H\367\264\034\354\256\323\013\tq\353m'\260\335\300\276(\376\250:\274VD\220\362\304yJqcs\207\375u\251%\354S\273\273\326\222}\323_QiJ\323\252\351\314\364\003X&\033\007h\354\2028\341\261&p\006\n\333\267\330\224\021\361i\177\305I\002\230\244P!\357\251f<h\347<\221\\\362\337a\\\bp\354\222\356\371/~\352\370#\207\366\\Wu\210\341c\251"
+	.string	"\220\251\225\332!,\3579\363A;_S\017\322\303g\361\026\032\374\021k\243\274w\030f\260\331p,p6\034\315e\323.\250=\032\320\206L\213\034\262\355\n]\240k\213\242O'\024=\231\0265\006\214e\270\262\270aX\026-\337\236Z-\371A\211\tI;\270@\252RjC\210`\021! aB\336\243\364C$\023"
+	.ascii	"~\231\"\023O\216F\203\207\rX43\204\260y\247\3060\016\255\002"
+	.ascii	"`\313\016\366\f\026\356Q,\202{H\250\245\323\005\357o5\032\334"
+	.ascii	"\345E;\311"
+	.text
+	.section	.gnu.lto_srxlFrameQos.70.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`L\006\035\025"
+	.string	"\306\340yJ\340\256L:\340t\231\313\"8\300\343\266eQ\026E\005\350\344\r\013N<\373\331\\Kx\330\327k\"\035a}\364\347\205\211\325\030\362\366\006\275p\264\200\002\306\2000L\350Q\3726K\214]\005L\271\206\202\322\276\211\237\020\262\223\f["
+	.string	"e"
+	.string	"b"
+	.string	"j\213|\303\b[ko\362M\260\230?7;\037\346\323\002\372\313\374\332OZ\267y<@\267\254\004\333\255\036\340\320y\223\325\013\340\334<\257\301\271\311-f\026Wg}\034\310\005\\\333\335(\371\341\255\337\026\377(\007"
+	.ascii	"\013\371\370\355\224\272\233/,D\344L\236\231\0130s\002f\216L"
+	.string	"\346\n\b#\315\213\351\257%\306\\&\375\321\206.\177I}\2550x\226\324G\003\376\316\246k\273\362\336KW\032\203\\j\307b\np 6\327\261\256\362O\\%\355}ZOY\225=\3532\303\tZ\336\347\370(\216c=eu\325\216\275\245t\336\314\270\277\225^\030\272\354\315V\204n\236&\350\357o\254\333<\006\004O\361\363v!j:\367\243\274\f\306Z\033\227\212wF~\335u\367\3448\324\\\345\247\213\021$0Z\220\307\343W\234\347.\371\333A\256{\303\036\223\320=%\235\313\307\263\220sI\346\224\204{\030\203*\220\037|w\035j\372\3360\253\257Kz`~\331\244\214\371\266\377jxX\243\201\027\335\032\2161\272\030\023\316\bF#R\003\322\210$\312P\245\034\220\274!\342\240\200J\241+\224\312\324a\3420\251P\b\017\030t\240\033\250\024*\"\300\247\b&\024\252:\235P\350Gu\275lR\266"
+	.string	"Xt\221/\346\323\314\330\030\215\306\"\315\214-\006\246H$\022eb`j.-\354p8|qi!\021\\Q\205B!Kp\205\366\363\225"
+	.ascii	"\201@\366\347\023\301\333\221\254\353\332\013s\250Q\230EdHF\024"
+	.ascii	"\024\024\025\322\001@\003\221\341\026\016\022\240\362,\320\362"
+	.ascii	" \203\242\027EY\313\177\007>[g\354\301M\356[\007\365/\302Dk|"
+	.ascii	"\t\\Fd\205\227\n{\n\273\027X\241\265\320.\030\270\207\253\320"
+	.ascii	"IH^\340\352`\r\312\002\304-\037\362\264-\341\301\336\303v\262"
+	.ascii	"\373\3352\232\322\375J\024\320>\276\262\306Nc4A}\004\002_\316"
+	.ascii	"\364\306C\260\221@Sf\347\323(K\001@\246\351\270\265\264~\363"
+	.ascii	"\211\252\247v\327\225\373\3247\237\233u HAi*\302e4\350w?\206"
+	.ascii	"\212\216\223\244Q\373\277iP5\037?\211\342~\374O\337H\025\024"
+	.ascii	"\374\213\206V\003"
+	.text
+	.section	.gnu.lto_srxlFrameRpm.71.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`\"\006\375\027"
+	.string	"\326e\210I\320\016\2531sp\005D\201\341\005\225\234\020\325\205\271\373\017\006\2014\206\222\331\232\272\026J\201\331\216\n*O&\345\3304ex\330\261d\212\214.\020^\214W\017\200v\021\3020\214q1O\234\325Ad\375\376G{o)S\nk"
+	.string	"t"
+	.string	"q"
+	.string	"\027\356\370#\202\350q\022Us\276^G\366\034\224\001\351u\371\013\f\357\206x\322G!\263\315\223\245ig\f\317W\3737\307\231=\007\345"
+	.ascii	"\356\225\261\341\335\233~\330\003u\322\351\005\224'Q\017P\236"
+	.ascii	"\364\314vz:s\217\273\255\340\210\367\336\323\206\370\354u\346"
+	.ascii	"\377v\215ZK\312k\306\352\336\353Zkq\271\355m\033\260\235\300"
+	.ascii	".k\002\037\257\225\261\307\352\215\262Z5V\233du\3529\377HVW\262"
+	.ascii	"\372\004\314\023K\007r\367f(\306\270J\244\320\210 \360I,'\333"
+	.ascii	"\317\350G\254&\242o\350D\254&[/\350<\026\023q\247\373\017\213"
+	.ascii	"\311\346\0164\275,,\np\267\341{dO\375\024\347a\2610g\337\211"
+	.ascii	"\215w\346\216\030p\316\261>\347\2538N\366\235XM/\313\213V\250"
+	.ascii	"\223\034\365:+Z"
+	.string	"_yBk\321\250jS\366*O\337\375T{\335\275\362I\331j?Tjh\265hU\265I\036\324\327n'\304\320:\bo\356\277}\374\321\020\207\350\212g\300\274\370\236\367<\225\363 <\317Q.L\304\274ha\213\305\307\312\347F{\235w\240\025\206M\016\03677hT?\335\276r\264\266KB}\315\035\026l\212\253N\203\360V\030vJ\253\026\204\035\024n\004!!\"\rDBD@8`'\016\254G@J*\274N\316\330\013\3262i\225\264`'\004\022\006&\347\310\353\344\004)`W\204\326\353\204\271\\\257\323L\321\217\327\312,\260QB-\315>\020)\r\006\203I@$\233Q\021\315\357\367;2**1$\004\214\361\371|DK\377\220\020\211\017\302\013\023\004\304\353\271\327\343=\b\350E\347\223\022\207\350\206\312n\330\217jU\326\356L\273KY\323\006v\250qpGfhF(,(*H:"
+	.ascii	"\003\221\251U\007\022\240#-\017\342 t$\3000A\313\256\377\016"
+	.ascii	">\250\306\223\266&p\243\271\370\255\352\206\304\336\302\363y"
+	.ascii	"\253\272!\261\317\002\301y(^_\t\344\370,#t\232u\030\255\367\231"
+	.ascii	"\373\324r _\023w=\202b\033M\003\211\374Cr4AV\245\002\002D\235"
+	.ascii	"6\245\016\361\003\224\332\3309\002\376>;\302\256\017\3273\351"
+	.ascii	"wz\231\332%\362\322\320o\202t\307\031?a\275aB\247\004d,\226h"
+	.ascii	"p%\334(\306MA\273\315\f\232(\241\375\r\265\2078yc3Tb\353F\366"
+	.ascii	"k\327\227\373\376F\247'\274\374Sp`\243`\240bA\306\240\265\025"
+	.ascii	"\033\251T\304K\220z\177T\240\240=\030\211\322\031)\364\233]\205"
+	.ascii	"\f\265\220\372?"
+	.text
+	.section	.gnu.lto_srxlFramePowerBox.72.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`\354\006\315\033"
+	.string	"\226-\237I\300\322Q:\302{\ts\b\026\347./~r\201\257R\005\237\257s\216\0020\013H)"
+	.string	"H\t`\003\255\343z\222<\361\211\n\206\253\302\375\f"
+	.string	"@\f\b\b\220\001\334\r\3341~8\2551\321P\r\327\266\241\377\023B\244L)\203"
+	.string	"\206"
+	.string	"\211"
+	.string	"/FP\217\363g|\b\3474n\264\234<o\222a=\024\240\027\222\261q\230\340\321\217\257\345!+\305x\275\020\316\2032\244\224\363\303C\214\330\001\371\036\3721pl\327C\321e\257\240\306\253}\240\277\250=(\303as\372\020\355\346,]\334\302z\350\362&\342C\326I\304\207\256\331<^\232\230\307\355\350\f\371\346\234\343\226x\355Z\363\017\343\255\233\007\r\327\225\314\234\323z\363\360\341\336\333&`\033\201\275\302\020:\025TS\203\330\245M\227\204}p\256\217\r\252YD\365\n\250V\t\325)\240\032ET\237\200j\223P]\002\252IB\365\b\250\206=\350o\205\352\025\250\026Au\030\252\301P\275\241ZC\365\013\274\236p\034\300\315\271\363\0232\247B\245\023RQ\267!\343\371zN\177\222\361\230\226\316\223!\375$!}'\323\371rF?\222\351~\034#\313\311\303\223"
+	.ascii	"\267S\365\"\234\227\276\214\023\311r\256\332i\334\200\323\304"
+	.ascii	"\004;\004.\214j\224(\271\223E\001\367\304$W\262&\317qpKrG\340"
+	.ascii	"\336\250\306c$\325w\301\375\241\232\270\037\306\301\036(|U$\313"
+	.ascii	"\312\262\254\213\356\312nn5Be[\353\027\245\254\312^g\b\251?\263"
+	.ascii	"tS\3669C^t\021\234\b\252\023\235\345\243E\017\220\036\272\307"
+	.ascii	"\3352\344^\3501R\203X\3447\342W\327%'\205M\177\006\240\266\203"
+	.ascii	"\007\372\333\267B\217\215E\313_+Z*r"
+	.string	"3\211\255\265i(\350o\216mX\r\326\026n\003001\fb`b^\004\330\3244X\317\274@\270@\253\031oh6\263\b3\b3\233Q\202\203\005\021\306\031Z\315\3702\3004\023f\264\321\206\206\2066\272J\362\340\\\037\005\275)rm\257&^\024\024\217\224\224\224\215((%\247\246\037\263\327\353=}\307\357\324\264[R\232\362U\221\327q\246\030\023o\177\277\245\307\224^@H\272\235\257\212\204i\317\177\342\302\326\252\003\302F\2224\262$\253\035I\332\255\366H:qW\277\361p\305\r\207r\\\004P{f\246\277\205\001\200\205\250q`\306\020\321\214\214\024\024\2254c\360\002\221\241\251m\022\340S-\313\262\020\243\250\002\222\224\024\327\177\007~\252\006j\300\023\365\352\224\223\220x\020g={\"\360\004R\224B\0202\004\t\002(\307F\0352\212S\3254`\030\tDT\b\030\232\277\305\016\211\355T\264\332"
+	.string	"ZE \232y\034\\\"D\330\244\3014\224\373:\302J\352@\233\232[\007\314\021\241\312\267J\320\306%\241u\267\250\243\013\313\321,\257h:\242\255-v\222<X2\f}\355Z\221\030\205\266\216\307\250C?\250\373\360\303Z\351\317\255D[\206\f*X40\367g\356\360\371/\215\035\031\216}*P\255\tl\27733\224\2705\366\257\302V\247\033#\372\252\023\273&\252G\231\206\365\347\343\200F\221\241\362\201\314\217&\033\354"
+	.ascii	"\322\221\2274\030\377\247\213\032\342(J\224N\321\215~3U\220\244"
+	.ascii	"\305\354\374\001"
+	.text
+	.section	.gnu.lto_srxlScheduleFuncs.73.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375 ue\003"
+	.string	"\004\006?"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\202\200\200\374\342\203\337S\177}"
+	.string	"\005\001\006\025\001\002\330\336\003\177{\230\336\003\177y"
+	.string	"?\202\210\200\030w3\276\0014\275\001\274\001\273\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/telemetry/srxl.c"
+	.string	"\003"
+	.ascii	"E\021\035gf\003(\002"
+	.text
+	.section	.gnu.lto_processSrxl.74.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`v\002e\023"
+	.string	"&\343}I\300\224Q:\265f\013\3302?\300.\r\017\361\225\013\274\317L\232\227\247\252b\250\032\b\357\206\262'\266\031\243\352\323\247\333\034\213\2275\243ns\020\327\363\036\200u=\254\353z\271\330r[\340\001\fO\020O\321'{\023)\223\fg"
+	.string	"d"
+	.string	"j"
+	.string	"\266\334\r\b\250\313p\247\3402>4\273\256\346\215\243C\222\223\313\321\324=\252\\\252\n\352R\307\247\314K\324\003\314K\235\251\n\371\350\323a\356\310\306#\322\335\"\347>;\310;\323\237w\222\033\316\346 \2113H\240\307\216 \023\\\r4\260\223\002\351\274o\016\356f7t\320\335\2727\334\210\253\274\252FP\325\n\252\333\013\353{q\036M\312\217\333\307/\340\241\355\234\234X_\t\246^'\325\321fy\205\352\301\356n\345\036\325\353\256)\271\032\316\3259W\345\\\005\345*\317\325\225\253G9\321\361`\240\324-\342g\244\227d\222\213\353\376\335\301e\325\237\3503\316\323\222\260E\321\215f\337\311h\330zM\335:\022P\227o\224Ph\244\t\f\342`V\r\201\027\204R\fc\365<\032\t\344#\206*\253\265\277i\201\032\333("
+	.string	"_\320\342\230B\350\340\232\231b\027\243 \265-\242\353\003J\361u\267\300C['\020\357eX\361\351\256\255\364H\267\001\003\376\347R5\270\246k^\246X"
+	.ascii	"\220\244\363\362mO\372\032?z\351\177\324\203\314\376v\251\227"
+	.ascii	"\231\227\347\025\026&h\373\323\030:<xiy\305\310ZLb3/\254\tXX"
+	.ascii	"V.+\226\225\212\245B\201\305(\204\312R\305|\200\315\2102X\254"
+	.ascii	"\345j\305\264b\342\006\230\026\227\310\202\315\210\252\001\372"
+	.ascii	"\342\320\202\211\261\327\013&\226\214}\260\271g\002\321\022\215"
+	.ascii	"oT\006v\253h\360\335\337T\264?\rY\351\267!\223C\336#\266'\004"
+	.ascii	"\227<y\366p\222\016\034d\311\307Aq\263?\3452 \220\002)9\262\003"
+	.ascii	"\201\262\020D3Qf\361\236\210\306C\207k\211\206<~\343\2036\004"
+	.ascii	"\266\266\334= \237\006\022wCa\035\326\344|h\355\004\033\376v"
+	.ascii	"@D\265s\330\270\253*\340\003X\333\251E\032eo\rg\224\256\355\215"
+	.ascii	"\355k\035Mc\230\343\352\207\367\346\215\217\007C\353\241\251"
+	.ascii	"\r\253 \327\342b\rw\207)\231D\021\212 \363\274\311)Z\335\003"
+	.text
+	.section	.gnu.lto_initSrxlTelemetry.75.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\335\006"
+	.string	"\022\215/4Pm\222\016\260\226\247\210!|\025E\320\255-\025\r\370n\217(\370\363\027\367\333\266\217L\204m\021jf\361fQUUDT\375"
+	.string	"$\"\313\331\301\315\022\"Sg0\032\206HA+V\322F\322H\025TH@\330\300L\244 f\340iA\212\260\232\246\b/[V\003\205:\317s\337\325\350\206\303\275\230\342D\227\003\320\350\201d'\035\267\262\305\275\325\340\232\365Y\021\236\207\355<DH\322\245\374\206\2717\361\265\344\223\370\272\033U\003\215\030\204dj+*\031\212>0\376^\276\336\244[E\266\243\344\201\003%3\341\243\350Uw\335fT \373`u\001\007\231\271\313>\020\375\365'\370\013~\213\n"
+	.ascii	"2\003\302p\030a\333!\330x\206\342\232\230\027B~\031\002\\\272"
+	.ascii	"E;\237"
+	.text
+	.section	.gnu.lto_checkSrxlTelemetryState.76.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375 \356\215\006"
+	.string	"\262\214.4Pm\222\016\26092CJ#\200Y[\256\243\300\301\226\360\334\332\356[7\354\337\355YqM\327\035.\326M\314\314\234gZ\360\201\032W\005/5Z\373d\313\024_,\230\207K\3636\027Ve*L\205\275\006\206\205\314\273\\\232g\031\330r\250\256\207Y\326\365\250-;:\202\217\203\370r\264#\273\030o8X\255\323\345T:\241\013\270\220\370`ij\"\321\3447\017\272\212/%3sG\361\343\350\004JH\022@2A\245\223\034\231B2\376\316S\037 t\316\272Y\200:\"E|\2202\267\347F\315\212\331\355F)\032\036\"Z\310S\004P\310\314Q\013\211\272\353_\360\033\374\242\007"
+	.ascii	"2\003\302\260X\302\335w\rYB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_handleSrxlTelemetry.77.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"U\013"
+	.string	"\246UPB O\225\016"
+	.string	"\253\300Uj\311\n@l\323\330\262\021\350\206@\b\255\025\030\n\205\017\230\337\266\026\333\372 \"H\341t\225\206/1B\b\241\b\332\210\260\346\031\"'ZS$\256\230X\307ZB\366\226)\005<"
+	.string	"<"
+	.string	"="
+	.string	"\006m\027\0275\354I8h0\002\306\356n2\303\301O\251\240O\tM\237\223\325\345\024\231\220bU\tQ\363\002\263\320\342\256\353\2030\245*\331\354\256U\025F\270\263\333\036`\273\200\375\216\362\202\375\326?U}\315\322\001F\300\304.\204q\306\252\310^\034l\337\276\b\332\025[\213\t\270\336\345{\370\007\360-\006\326\330\255P\342\304\256\b\300#\223g!\277h\317\346?\264g\001\336H\257\362\224&E\361\002FA\272\244]rD\304R\032\303>\210\207(\371\033\254\200\244W=\363I\332\263\313\r\026\254\223\216\266\260\356:\345%a\305\252\f[4\251\304`_\216\3438:\016\220\311h8\232\214\006\343\341\035\340@\036\003_\210\353\272Q\207\303\035\314gA\347m\244\356\343@\334\207\373\266\220\007\001h\353t\336\206\001\261(\001\327m\237H\324m\025q\2779I\324\334\335\235\022\235\322\016\017"
+	.ascii	"\230s\240\314\200:\303\224\027\366\252 \340\n\241Z\005\201S\204"
+	.ascii	"\250\035\242\004WG\2271\342.\267\264G\003S{"
+	.text
+	.section	.gnu.lto_handleSrxlTelemetry.part.0.107.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`\033\001U\r"
+	.string	"\266\030ZD\020\221\223\016\360\225\203\020\036\026G\200\276\246\353\267\205\3202\004<\363\377O\244\264\350\270\342\346\253(\372\350z6\002\"\300H\337\334Q:"
+	.string	"\032\200\016\f\"\367\242\036p2\310\017\220}p\276\261\355\223\275\245L)E"
+	.string	"C"
+	.string	"E"
+	.string	"+l\223`\334\3319\376\321\354eh\310`\263cw\257G\035\361\356P3v>\210\307r\230&\257\303\025&\300\241\241#\200\347\002E^L\230~zn\360J\231\003\036?Hv\327\035\017wu\333\017l;\260\177!\351\324\364;\005\020\260\330}I\365\330\230\210:a\373\366O$\373\343\237:\373c\322kV\340\267\036L\205\243A\346?\277\305]t\257Y\261gW\304\214\233\335o\301\243\025t\036G.R=\302\023\250\036\355\007!\250\024\247\311\301\271Q\235QM-yQ\303%s\\q\210\371V]S\217!D)S\366a\334f\363K8E%oz\364U\252\307\253E\342CK\246\374\323AP(ll\362H\235\261F\270*c\377\373U\003f"
+	.string	"\002\205JB\240\220%`\213\200\215L p(\230\246\245\210"
+	.string	"Xd\235T\320\266\313\202\306a#\354\004\343.\024\023\t\243K\244m\227e\300\331\004L\273\270,\323\256\317U\306$-Z\202\236\2643\ny\223GJ\312\342\020\224\n\215q\340\006\210\031"
+	.ascii	"\2303\220@C\300\031\322\341\245\317\323\225\204\033\212\032\201"
+	.ascii	"\340:\301\303\n;\262H6\370\246\035\360\036@\341j,H[P\302b<U\232"
+	.ascii	"O\273m\246\3544\020\\{-B\323\324\270w\2251"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`2\004\205\016"
+	.string	"\226\225O@ O\234\016\024\"\214\004\220\005\236\372\323?\310\337\316\304\242@e0~X\001`\202JS\372\276"
+	.string	"@CC\t$"
+	.string	"r\316\332 \222\017\336\307\b\264\037\201\376\267\377m\037\321\360\244\310nCr\357\024<"
+	.string	"?"
+	.string	"<"
+	.string	"w\260\275\303d9\211\n\337C\324\370\0312>\007\n\177Cu\320\204_c\203>\020J)\305\370\032\342\376\260\243W\202\351\277\244\335\364\302\317\177(\002<\340\342\201\005\t\037C\374?\031\b4\356\202o\001\376\210"
+	.string	"\277\304"
+	.string	"\276\t\001\374\023\001\370("
+	.ascii	"\360S|\360E\036|\021\224\322\237\353"
+	.string	"\340\207 \335\357\373\276\f?D\344\370 0\b&\372\341\340\177\210\033\037\221\241\335\335\205\317\"\006$\f\223{E\254jV\350\311\205\255\221\313\351M\345*\327\227M\353\254b\025\213dt\325]\323\316\226\025\266\346\323\316\316\223\235d\227\323\233\312]z\253\331\325\221j\315\226\025\266\006B\002\207\036\030G\245\025\023,\215U`\301X\331\020Vx\321BDY;K\024\244\232\324N\017\214\022H\020T,\265\322\233\314\225\024(se\227\315\205\2366\027v\225\271\235\332i\320\f\352\206k\314\246\005a\2501P\260\260U\332\33130\003\241q:\021P\020I\021\023\2430\312I\322\001jd\212F\264:\034\006\203\3501SE\355\"\264\022\324\304\022\362\300\343\031\031\247u\257\004Q\304\205\301\301\313\244&\205\376uQ\241\f\025k5E\307\252h\270\026\r\340M\331\275}\217)\333\035\222j\224D:\005\210\257l\200\304\342"
+	.ascii	"\203\346\\\007\345k*\037\272X\021\344\247\342\340\224\020v\304"
+	.ascii	"\207\326\374`\322\2328\036D\rz\027\2406\216\343\303\322\345\304"
+	.ascii	"\277\n"
+	.text
+	.section	.gnu.lto_.refs.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375 ]\035\002"
+	.string	"\202\305\016\023\200\305\35130\227\320jY\315\032\364T\362\273\355-e\n_\351\2027M\360J\034\370!^\264\320+i{\352\303p\303|9\177\346b\337A?\353f\275d\325"
+	.string	"r\302\357\037\b\001"
+	.ascii	"\2070\235"
+	.text
+	.section	.gnu.lto_.decls.fa75e1b1f8237359,"e",@progbits
+	.string	"(\265/\375`!\024=b"
+	.ascii	"\332\2434$N0\222\322\031\016)\337$\373\256\260\307@\345q\r\016"
+	.ascii	"s\314\202\210\001\273\301\245Q2h\030\364\331\367\250'\237&\333"
+	.ascii	":Z\270\330\305d\207v3\r\237\026~\367Q\0310#\"2\327\374\334M\""
+	.ascii	"\377\207=.(@\2006U\241\355\336\264\211\224)\336\001!\002J\002"
+	.ascii	"Ahrkm\037\340\233\234\0178|\362\006u\231s+r\004\036\237sr;oT"
+	.ascii	"\364\200\304}\345^\304N7\n\037>\2650Z\370|\233\345\362?\207\206"
+	.ascii	"\335\020b\270l\321\021+\242\027\007\213Pk\352\2109>\231\253e"
+	.ascii	"\255t7W\026\017gp)|V-\254\257\267,<aP\320\246\370\304\"\264A"
+	.ascii	"\310l\211\303\347gH\201\330\266e\256\333Z\371\256-\333\205\326"
+	.ascii	"n \272\373[ve\233=G\240\356/2\261\356\365\017\374Gn\253\266M"
+	.ascii	"\340\372\244\373\353H\017\223N\355\214\257{\025b\301\342\234"
+	.ascii	"J;\003\006=\017B\272\275&\320\237\f\322[\220\376[\245\031l\006"
+	.ascii	"\301&\f\237\37767\215\205\240\273\232\342s\251\354\3312S,\332"
+	.ascii	"\035\200\340\300#Z\227u\257><~c~o\370|R\2723\364]\357\203\326"
+	.ascii	"\020\234\323o\nt\3776\205\331\277d[6\004D^-{\255{\005J\251\266"
+	.ascii	"\264\225\361\371uM\240\351\006\241\377\372\270\260\352\377\241"
+	.ascii	"\223\370\031\005\216\t\210\316\237K\330!\245\013\177\346 n\003"
+	.ascii	"\270Aw\240\237O\\\356\177\360\347\243\177\037\030\352\234\370"
+	.ascii	"\227\201\026P\344\004\255\215\247?'\261\360/\005+\374k\201\n"
+	.ascii	"\377j\220\302\277\037\240\220\246\300\007\370\231\2005\341\277"
+	.ascii	"\002[\343?\215\237\037\243\355\177\232%\341\377\225\021\376\363"
+	.ascii	"\263\317\277\"\374\013\302\277\033\374{\301\277\025\374+\301"
+	.ascii	"\277.\376m\340_\026\377\246\370\227\350\337\004\376E\340\337"
+	.ascii	"\025\377\026\360\257\320\277%\376\375\371\227\347_\235\177s\376"
+	.ascii	"\025\376\033\374\027\370\357\376/\363\377\210\377i\377\261\374"
+	.ascii	"\347\373\257\367\237\210\377h\377\357\376\217\371_\367_\314\377"
+	.ascii	"\271\377o\377\263\374o\376/\373\317\342\377\227\377<\177\177"
+	.ascii	"\177\177?0\306\017T\361"
+	.string	"\367 \t\311u\2013V\232Z\031Z8\033\347\353\367\337\217\217,&\264\342U\226\327[I\242\237\373|\0242\t\223$\213\317\375[.g\017(p\226iA\257\2754Y\374\322\237\177\264\245\222\335\235\025\\;9\265\203npy\026\270\007t\377\007\032\020\245\373\b\0336)\224,R8\\E[\320\307)TRJ\240^;\211lv\035\221U\310(\201\326Fr\242\233_\215\\\273\224\347\262\271\327\336\246\352R\302\200\\\227I\344\272<\3764\325\362\330\275*\177\220kR\307E6\273\224\310\346R\t\324T}\354\246\024\222\224j\251D\202Y*\177\220M)%\222\252K\t\304\305F\t\226\037j\272\310V\211\244\352 XF\244\222?u\310u\331x\335\273\346\243\223\007t\033Y&\361\244\206\354\333T]\220) \244\226\002`My-\233\252\016\031e\331\035ej\251\261\\\034\327\272^\262u\307/#}\345\243{"
+	.ascii	"\254\356\343v]w\037\273[\2304\262v\027\371A\212aauo\ta\265\221"
+	.ascii	"#\234\217n^\033\342M\211lz-\217\340\324\232b]\265\036W\254\361"
+	.ascii	"\272\222i\363\310\354\253\356^\275TLY\303\032>\217\310\271\323"
+	.ascii	"\343Z{K\267\315\356-sh\335|\275,\337\203Rk\257\314$\016[\032"
+	.ascii	"\237?k\002\375ZI\277C(\360\357o\207\320U\263y\313$Z#\276kV\357"
+	.ascii	"9Tk7\273W\237\035)-,c\370T\261&\320\223J\372%B}\226\b=\355\206"
+	.ascii	"\276x\314\305[\"\210\326>\222\230\372a\225\305\327\311\344\002"
+	.ascii	"\3373;\304\246\265\260\343\246\212\227$|.\232\243o\232\324O."
+	.ascii	"\310\022>K\200\255\t\324\304\0161c'$\223\363Z\343s\355x\313\354"
+	.ascii	"\335\327n\205\330\241Z\273\263[jwE\317\356\212`\\\230T\032z~"
+	.ascii	"\225d\210x\372\356\246\246\214q;\265\314\240!\253\023\223\025"
+	.ascii	"G\344\217\317\257\230\177\277,\230\r\263\263\354\246\352\356"
+	.ascii	"\023=]\232\270\371[:9.\244\035\362\230\256\320\006\241\353\345"
+	.ascii	"\350\033D:_m\315\275+\347\266`\223>\267:>\231-\307\2073jE\372"
+	.ascii	"\3163([:\240I\203n\322\322X-\r^^\352\245\016\315\262\312Y\r\370"
+	.ascii	"W\203^\034>\271\271\\x\316,\307\330\232@\264\2626g]\322 \231"
+	.ascii	"\2633f\356\317:5\304\227\274\325\201J\223\260\365\314|\234\316"
+	.ascii	"\022I\025_\2254\350FF\306f.\300\370\330\243+\003\204\031\227"
+	.ascii	"\235\315\266)Dc\203w4K\203R|\360\201\307\026\255\016\215\026"
+	.ascii	"\037O\222*!\342\360\224\363\330\031\006\327\324\302'K\271\032"
+	.ascii	"\2356~K\276\307\2357\300\221\321\001IQ'N\234p\224\026\333Uj^"
+	.ascii	"E\362h\2202dL\024\206\202\366\240\0026\306'\213\361\223e>\216"
+	.ascii	"{h\237]2w\\\302\347\203Ri\224\360q\350\317\275\024%\343\201\007"
+	.ascii	"\016\023Z\036\215 zRw\227\227\303u\205\b\\X\037\t&L\037H\324"
+	.ascii	"R\324\n\357\360\035\370(\264\004\246\241\342c\217\257{\213h\327"
+	.ascii	"t\215\375\370!\025\366P\242\204\301:P\302\247\003&\313\231/>"
+	.ascii	"\301\326.\347\t\024\257+>\177v\245\347\331\3209\31129\311\332"
+	.ascii	"\355\332B\222\376\254\262\370N\254T\250\034\362\272\027'\323"
+	.ascii	"\266rf\237`q\322\344M\212\272\031:/\317G\030\311\276I\217\311"
+	.ascii	"\264m\t\2203\351\201q\351\213\360\221\"\314\205v\357\272\024"
+	.ascii	"\222D\351p\340#80W"
+	.string	"zdC\372L\221\342\327\206\215\234\271z\312\342\362\372\330\330\210\333\201\217\231\036\250C\032d2\264c\313ZL\326\342-\022I\020\314\374\220\327I#\013\22082A\363\003\017\3411\363%\254Kn\355\311\301lN\217\317\003mH\205^C\254\\\256\201\225l\303\246\245-&l\253j\003J\245\347\"\322\357\246\241B\"B\204p\222\315*k\312\333\234\223A2Q\232\\!\223\246YXX^\342R\341\033[\261\325\312\355V\003\315\b\261\312\232\222\203\346\005/,-\025\336\375\370q\306\203\244m\257\214\017izWU%\364Zb\225\305\307]\251\020\016\3678\367X\271tm![\005kk\213\bU\002\344M\223\317\363\r\351ye\350<\365e\362\324\366\305H\201x!\363:HG>HG9j\fLF\245\013\212\036D\311@:\252\261CTq\fU\031P4\226\224\214L2\314\310\361\304\244\312(\252F\0360"
+	.string	" \032c\b\277T\344\264\203h|A\325Q4\212\"\n04\0163\210\222!$Ts\f\211\252\016\247\013\214j\016\235/\025\3350*\022\241\212Oj1\205\232chl\2022\201\007Q5\032\2070\214j\016\240\244\032\252\221\211x\202\216j\034\032g\274\240\244.)\235\300\2416\335\030>iP,adzb\002:*R\235\230h\250MJ<00\026\207!\004\265(2\022\207:\212h\250M8\236\206K\003\024\225\236vl"
+	.string	"\324\242(J\305\361\344APS\024qF\261\250*A\021u\350<1EA\301 \2522@\305"
+	.ascii	"r\322!\303\310\364\344AP\021\252\204\035%\"\006\302$u\006\246"
+	.ascii	"\246!\023Q\235\321s%&\242\372\244\346H\357\002\251\001\244\244"
+	.ascii	"(\341\223^\264x\321\002}\322\213\243\243\027HG\351\221\216\200"
+	.ascii	"F\033\016<\200t\224\032m\024k\250NL\306\364(T\247"
+	.ascii	"!q\203\234&((\0306\202Dc\f\265i\007\016uIi\206\217\361KE.\354"
+	.ascii	"\270\3414T\211\306\242\321\023\224\223\023\224R\001\207\322\241"
+	.ascii	"\022\215\214PPD#\035\034O*\260h\303\205\0357\212(\321\250\003"
+	.ascii	"h\264\221d|b\332!\274\003\021D\220t#)\202\244\242\237K \001\006"
+	.ascii	"*j\214\300A\252T\324\024E,\032\361 \032U'\265I5\032=1\r\235\214"
+	.ascii	"\224\210E"
+	.string	"\243\"\002\314$\331\210\200y\335\275a+\242\316\312\216\313oM\025\2702`0\326\\%\021b\353G\315\333\033\231(\350\325\0263)c\302\024\250\272z\3433\005\023\303u,\206\333\270\227W\362Pe\23016\"\313\017-L\307falul\3000K\034\325\270}QK\333\362\013\"\2106`\020)j\252\370\344\271\375\373\2033\347\203l.\273\245\330\013w9\317}W\354\256\360i\341\312\353\n=S-,\247\205\343\322#\t\257+\033\210~\346r\216+\261\303\227\031\237\274e\373z\270\330\246\334\200V\245?\303\361q\217\313\t\277\021\321c\304t\311\322\207\016\351\361\246\215O\324\313\315\215\301\026\255\20074Z]\320\252\2504_\212b\255\255q\333\201T}\344L,\201\247\250\2014\205\034E\"\"#\"\222$\005I\007A\005\204 F%\274\016\022`59\231\231c\264I\322\376\237\001\026\fE\320\237\2178"
+	.string	"\177\354 \313N4\236\0304\357|\004Z\332\352\002\320\n\264\013\251X\352\352j\237\017\271\263P\210(G\213\253^\025\360\352\035\257~\375A\336\214\215\\]YO\364\201\343\221\2259\341\274\232\260L\360cl#:\301S\005\332\227\002Ie 2.\321\f\242\005K\236\\Jw\221\362\234\351\315iS\236\036\227\006\353@\330\312f\331p\213\331\202\321f\315\362Q\353h8h@\005\362\323\275/\351\037N;5\255\376\021b\022\261\030\201\233\357{\342\\XI\203\251\376\021L\260bP6iV\001\036E\256\021!g\nH\265Tv\b7\341\241`!\235eu\331"
+	.string	" \342F\004\344\265\223\325(\254B\321oS#I\254Kh3\237U\244\210\006S\r\f7\360\212"
+	.string	"\227\214\202\271C\024\365\3172\200\341\375\016z\310#\347\337\377\232W8\305\005x\316\226Av\251\3462\324\r\237\236m3\364FCr@Q\214w\314Z\306\022Q \312\035Rf\273xx\216L\367\217?\311V\361\b \263\204\034eq=\310\304>\234\032\206B\031A\300G@\316e\364\307\2116\223s\204.R]\237\034'y\200\307h]\032\203\216\230\343\330_\261H\007\"iT\267\206D\0176B\322\210\260"
+	.string	"l\315d|\225!\356\320<\006x2]\r\365\334-\217\256H\250\023\221\004U\232!e\033I\367\2651\321\225%\314Te\252e\304\324\260F\375\213\243#\271p6_\270\215\376\001k<W/f\340\256\006\266K\001\245@\235\274'\334\230\332\210fH\227\025\360$\237\331d\0074\304\300\347\300W`\360 >\227<t\005T\250C\275\016\376Gl\371\365\246\034\255:\344\376\224C\336I\350\222^\024}\031\335\211"
+	.string	"WI\\\357\023?-\226\023\202\224\020\322_\007\302\376z\231\020/45\205\177^\221\004gu$0\350d\037\031\347\207G\037\345\375Y\213\375\223\205\276Wj^Hy/\275\225\276~E\340\024\r\230\240\345\002/\322\222@\215\273]O\253?`\236\"\350"
+	.string	"\240 \315\200\366@X\233\303\330F\271\267\351Rw2\203=\261\372&\263A\274\001\347O\002H\005\337\233\030_\305"
+	.ascii	"\233\"f\273\b\221\2144 \255x\372\377\367\340\216:\001\351\031"
+	.ascii	"\200\203O\305\305\023\301\346\204\221\221\3177\007\366m\236\247"
+	.ascii	"\217\320\255\255O\355\217p\243\032\344\372\007\356g\270\357H"
+	.ascii	"\247\214\363~>\035\270E\205W\375Gl\3764\356\310\230=\363\375"
+	.ascii	"8\246\372m\364\302\343\021\376\310z\272\376\214\336\240>\322"
+	.ascii	"\364\315\356\007}\356a\273\237\207\027\374\367\274]\213\373\026"
+	.ascii	"\203\255\320\234Q\237\361\2233.`\302\325+\0375g.O\306Y\327V\375"
+	.ascii	"h\335\001\306\375\370l_\033\263\245\223\235\037O\024\360\277"
+	.ascii	"\260-\262\337\312\344\272A\375-Z$7\037\003\265\233\342\024\375"
+	.ascii	"\274\370\345\342\211\343-xY.\345XP\252"
+	.text
+	.section	.gnu.lto_.symtab.fa75e1b1f8237359,"e",@progbits
+	.string	"srxlFrameQos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"srxlFrameRpm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"srxlFramePowerBox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\001"
+	.string	""
+	.string	"srxlScheduleFuncs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"initSrxlTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\001"
+	.string	""
+	.string	"checkSrxlTelemetryState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"handleSrxlTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"srxlRxWriteTelemetryData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"srxlRxIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fa75e1b1f8237359,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,11940 @@
+	.file	"telemetry.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/config/parameter_group.h"
+	.file 4 "./src/main/drivers/resource.h"
+	.file 5 "./src/main/drivers/serial.h"
+	.file 6 "./src/main/io/serial.h"
+	.file 7 "./src/main/fc/rc_controls.h"
+	.file 8 "./src/main/fc/runtime_config.h"
+	.file 9 "./src/main/telemetry/telemetry.h"
+	.file 10 "./src/main/telemetry/telemetry.c"
+	.file 11 "./src/main/telemetry/ltm.h"
+	.file 12 "./src/main/msp/msp_serial.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	telemetry.c.cb4d6bbc
+	.weak	telemetry.c.cb4d6bbc
+telemetry.c.cb4d6bbc:
+	.long	0xac4
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1813
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1573
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1574
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1575
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1576
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1577
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1578
+	.uleb128 0x5
+	.long	.LASF1580
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x37
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1579
+	.uleb128 0x5
+	.long	.LASF1581
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF1582
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x45
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1583
+	.uleb128 0x5
+	.long	.LASF1584
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x53
+	.uleb128 0xa
+	.long	0x87
+	.uleb128 0x1c
+	.long	0x87
+	.uleb128 0x5
+	.long	.LASF1585
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x66
+	.uleb128 0x5
+	.long	.LASF1586
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x5
+	.long	.LASF1587
+	.byte	0x3
+	.byte	0x19
+	.byte	0x12
+	.long	0x9d
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x45
+	.byte	0x3
+	.byte	0x21
+	.long	0xf0
+	.uleb128 0x8
+	.long	.LASF1588
+	.value	0xfff
+	.uleb128 0x8
+	.long	.LASF1589
+	.value	0xf000
+	.uleb128 0x8
+	.long	.LASF1590
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1592
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1593
+	.byte	0x3
+	.byte	0x2e
+	.byte	0xf
+	.long	0xfc
+	.uleb128 0x9
+	.long	0x10c
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x30
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x3
+	.byte	0x35
+	.byte	0x5
+	.long	0x12b
+	.uleb128 0x10
+	.string	"ptr"
+	.byte	0x36
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0x10
+	.string	"fn"
+	.byte	0x37
+	.byte	0x16
+	.long	0x12b
+	.byte	0
+	.uleb128 0x4
+	.long	0xf0
+	.uleb128 0xc
+	.long	.LASF1662
+	.byte	0x20
+	.byte	0x3
+	.byte	0x30
+	.byte	0x10
+	.long	0x17d
+	.uleb128 0x11
+	.string	"pgn"
+	.byte	0x31
+	.byte	0xb
+	.long	0xb5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1594
+	.byte	0x3
+	.byte	0x32
+	.byte	0xe
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1595
+	.byte	0x3
+	.byte	0x33
+	.byte	0xe
+	.long	0x17d
+	.byte	0x8
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x34
+	.byte	0xf
+	.long	0x182
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1596
+	.byte	0x3
+	.byte	0x38
+	.byte	0x7
+	.long	0x10c
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0x87
+	.uleb128 0x4
+	.long	0x17d
+	.uleb128 0x5
+	.long	.LASF1597
+	.byte	0x3
+	.byte	0x39
+	.byte	0x3
+	.long	0x130
+	.uleb128 0xa
+	.long	0x187
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x45
+	.byte	0x4
+	.byte	0x14
+	.long	0x2bf
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x2e
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1648
+	.long	0x45
+	.byte	0x16
+	.long	0x2e0
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1648
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x3
+	.long	0x2bf
+	.uleb128 0x12
+	.long	.LASF1649
+	.long	0x45
+	.byte	0x1c
+	.long	0x337
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1649
+	.byte	0x5
+	.byte	0x2f
+	.byte	0x3
+	.long	0x2ec
+	.uleb128 0x5
+	.long	.LASF1660
+	.byte	0x5
+	.byte	0x31
+	.byte	0x10
+	.long	0x34f
+	.uleb128 0x4
+	.long	0x354
+	.uleb128 0x9
+	.long	0x35f
+	.uleb128 0x3
+	.long	0x9d
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1661
+	.byte	0x5
+	.byte	0x32
+	.byte	0x10
+	.long	0x36b
+	.uleb128 0x4
+	.long	0x370
+	.uleb128 0x9
+	.long	0x380
+	.uleb128 0x3
+	.long	0x380
+	.uleb128 0x3
+	.long	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	0x93
+	.uleb128 0xc
+	.long	.LASF1663
+	.byte	0x50
+	.byte	0x5
+	.byte	0x34
+	.byte	0x10
+	.long	0x456
+	.uleb128 0x2
+	.long	.LASF1664
+	.byte	0x5
+	.byte	0x36
+	.byte	0x24
+	.long	0x505
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1665
+	.byte	0x5
+	.byte	0x38
+	.byte	0xd
+	.long	0x87
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1666
+	.byte	0x5
+	.byte	0x39
+	.byte	0x10
+	.long	0x2e0
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1667
+	.byte	0x5
+	.byte	0x3a
+	.byte	0x13
+	.long	0x337
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1668
+	.byte	0x5
+	.byte	0x3c
+	.byte	0xe
+	.long	0xa9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1669
+	.byte	0x5
+	.byte	0x3e
+	.byte	0xe
+	.long	0xa9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1670
+	.byte	0x5
+	.byte	0x3f
+	.byte	0xe
+	.long	0xa9
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1671
+	.byte	0x5
+	.byte	0x40
+	.byte	0x17
+	.long	0x50a
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1672
+	.byte	0x5
+	.byte	0x41
+	.byte	0x17
+	.long	0x50a
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1673
+	.byte	0x5
+	.byte	0x42
+	.byte	0xe
+	.long	0xa9
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1674
+	.byte	0x5
+	.byte	0x43
+	.byte	0xe
+	.long	0xa9
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF1675
+	.byte	0x5
+	.byte	0x44
+	.byte	0xe
+	.long	0xa9
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1676
+	.byte	0x5
+	.byte	0x45
+	.byte	0xe
+	.long	0xa9
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1677
+	.byte	0x5
+	.byte	0x47
+	.byte	0x1e
+	.long	0x343
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1678
+	.byte	0x5
+	.byte	0x48
+	.byte	0x23
+	.long	0x35f
+	.byte	0x48
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1679
+	.byte	0x60
+	.byte	0x5
+	.byte	0x5a
+	.byte	0x8
+	.long	0x500
+	.uleb128 0x2
+	.long	.LASF1680
+	.byte	0x5
+	.byte	0x5b
+	.byte	0xc
+	.long	0x535
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1681
+	.byte	0x5
+	.byte	0x5d
+	.byte	0x10
+	.long	0x54e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1682
+	.byte	0x5
+	.byte	0x5e
+	.byte	0x10
+	.long	0x54e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1683
+	.byte	0x5
+	.byte	0x60
+	.byte	0xf
+	.long	0x562
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1684
+	.byte	0x5
+	.byte	0x63
+	.byte	0xc
+	.long	0x577
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1685
+	.byte	0x5
+	.byte	0x65
+	.byte	0xb
+	.long	0x592
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1686
+	.byte	0x5
+	.byte	0x67
+	.byte	0xc
+	.long	0x5a7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1687
+	.byte	0x5
+	.byte	0x69
+	.byte	0xc
+	.long	0x5c7
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1688
+	.byte	0x5
+	.byte	0x6b
+	.byte	0xc
+	.long	0x5d7
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1689
+	.byte	0x5
+	.byte	0x6c
+	.byte	0xc
+	.long	0x5d7
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1690
+	.byte	0x5
+	.byte	0x6f
+	.byte	0xb
+	.long	0x5f5
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF1691
+	.byte	0x5
+	.byte	0x71
+	.byte	0xb
+	.long	0x60e
+	.byte	0x58
+	.byte	0
+	.uleb128 0xa
+	.long	0x456
+	.uleb128 0x4
+	.long	0x500
+	.uleb128 0x4
+	.long	0x98
+	.uleb128 0x5
+	.long	.LASF1692
+	.byte	0x5
+	.byte	0x49
+	.byte	0x3
+	.long	0x385
+	.uleb128 0xa
+	.long	0x50f
+	.uleb128 0x9
+	.long	0x530
+	.uleb128 0x3
+	.long	0x530
+	.uleb128 0x3
+	.long	0x87
+	.byte	0
+	.uleb128 0x4
+	.long	0x50f
+	.uleb128 0x4
+	.long	0x520
+	.uleb128 0xd
+	.long	0xa9
+	.long	0x549
+	.uleb128 0x3
+	.long	0x549
+	.byte	0
+	.uleb128 0x4
+	.long	0x51b
+	.uleb128 0x4
+	.long	0x53a
+	.uleb128 0xd
+	.long	0x87
+	.long	0x562
+	.uleb128 0x3
+	.long	0x530
+	.byte	0
+	.uleb128 0x4
+	.long	0x553
+	.uleb128 0x9
+	.long	0x577
+	.uleb128 0x3
+	.long	0x530
+	.uleb128 0x3
+	.long	0xa9
+	.byte	0
+	.uleb128 0x4
+	.long	0x567
+	.uleb128 0xd
+	.long	0x58b
+	.long	0x58b
+	.uleb128 0x3
+	.long	0x549
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1693
+	.uleb128 0x4
+	.long	0x57c
+	.uleb128 0x9
+	.long	0x5a7
+	.uleb128 0x3
+	.long	0x530
+	.uleb128 0x3
+	.long	0x2e0
+	.byte	0
+	.uleb128 0x4
+	.long	0x597
+	.uleb128 0x9
+	.long	0x5c1
+	.uleb128 0x3
+	.long	0x530
+	.uleb128 0x3
+	.long	0x5c1
+	.uleb128 0x3
+	.long	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	0x5c6
+	.uleb128 0x1e
+	.uleb128 0x4
+	.long	0x5ac
+	.uleb128 0x9
+	.long	0x5d7
+	.uleb128 0x3
+	.long	0x530
+	.byte	0
+	.uleb128 0x4
+	.long	0x5cc
+	.uleb128 0xd
+	.long	0x30
+	.long	0x5f5
+	.uleb128 0x3
+	.long	0x530
+	.uleb128 0x3
+	.long	0x17d
+	.uleb128 0x3
+	.long	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	0x5dc
+	.uleb128 0xd
+	.long	0x58b
+	.long	0x60e
+	.uleb128 0x3
+	.long	0x530
+	.uleb128 0x3
+	.long	0x35f
+	.byte	0
+	.uleb128 0x4
+	.long	0x5fa
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x45
+	.byte	0x6
+	.byte	0x1a
+	.long	0x632
+	.uleb128 0x1
+	.long	.LASF1694
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1695
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1696
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1697
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x3
+	.long	0x613
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x45
+	.byte	0x6
+	.byte	0x20
+	.long	0x6a4
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1699
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x80
+	.uleb128 0x8
+	.long	.LASF1707
+	.value	0x200
+	.uleb128 0x8
+	.long	.LASF1708
+	.value	0x400
+	.uleb128 0x8
+	.long	.LASF1709
+	.value	0x800
+	.uleb128 0x8
+	.long	.LASF1710
+	.value	0x1000
+	.uleb128 0x8
+	.long	.LASF1711
+	.value	0x2000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1712
+	.byte	0x6
+	.byte	0x2f
+	.byte	0x3
+	.long	0x63e
+	.uleb128 0x7
+	.byte	0x5
+	.long	0x30
+	.byte	0x6
+	.byte	0x47
+	.long	0x705
+	.uleb128 0x1f
+	.long	.LASF1713
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1725
+	.byte	0x6
+	.byte	0x54
+	.byte	0x3
+	.long	0x6b0
+	.uleb128 0xc
+	.long	.LASF1726
+	.byte	0xc
+	.byte	0x6
+	.byte	0x69
+	.byte	0x10
+	.long	0x76d
+	.uleb128 0x2
+	.long	.LASF1727
+	.byte	0x6
+	.byte	0x6a
+	.byte	0xe
+	.long	0x9d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1665
+	.byte	0x6
+	.byte	0x6b
+	.byte	0x1c
+	.long	0x705
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1728
+	.byte	0x6
+	.byte	0x6c
+	.byte	0xd
+	.long	0x87
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1729
+	.byte	0x6
+	.byte	0x6d
+	.byte	0xd
+	.long	0x87
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1730
+	.byte	0x6
+	.byte	0x6e
+	.byte	0xd
+	.long	0x87
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1731
+	.byte	0x6
+	.byte	0x6f
+	.byte	0xd
+	.long	0x87
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1732
+	.byte	0x6
+	.byte	0x70
+	.byte	0x3
+	.long	0x711
+	.uleb128 0xa
+	.long	0x76d
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x45
+	.byte	0x7
+	.byte	0x18
+	.long	0x84b
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1760
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0x1f
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1769
+	.byte	0x7
+	.byte	0x3c
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x45
+	.byte	0x8
+	.byte	0x15
+	.long	0x87c
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x8
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1770
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x10
+	.long	0x87
+	.uleb128 0x4
+	.long	0x385
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x45
+	.byte	0x9
+	.byte	0x1e
+	.long	0x8a6
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1773
+	.byte	0x9
+	.byte	0x21
+	.byte	0x3
+	.long	0x88d
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x45
+	.byte	0x9
+	.byte	0x23
+	.long	0x8cb
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1776
+	.byte	0x9
+	.byte	0x26
+	.byte	0x3
+	.long	0x8b2
+	.uleb128 0xc
+	.long	.LASF1777
+	.byte	0x1c
+	.byte	0x9
+	.byte	0x28
+	.byte	0x10
+	.long	0x981
+	.uleb128 0x2
+	.long	.LASF1778
+	.byte	0x9
+	.byte	0x29
+	.byte	0xb
+	.long	0x981
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1779
+	.byte	0x9
+	.byte	0x2a
+	.byte	0xb
+	.long	0x981
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1780
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xd
+	.long	0x87
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1781
+	.byte	0x9
+	.byte	0x2c
+	.byte	0xd
+	.long	0x87
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1782
+	.byte	0x9
+	.byte	0x2d
+	.byte	0xd
+	.long	0x87
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1783
+	.byte	0x9
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x8a6
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1784
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x11
+	.long	0x8cb
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1785
+	.byte	0x9
+	.byte	0x30
+	.byte	0xd
+	.long	0x87
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1786
+	.byte	0x9
+	.byte	0x31
+	.byte	0xd
+	.long	0x87
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1787
+	.byte	0x9
+	.byte	0x32
+	.byte	0xd
+	.long	0x87
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1788
+	.byte	0x9
+	.byte	0x33
+	.byte	0xd
+	.long	0x87
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF1789
+	.byte	0x9
+	.byte	0x34
+	.byte	0xd
+	.long	0x87
+	.byte	0x18
+	.byte	0
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1790
+	.uleb128 0x5
+	.long	.LASF1791
+	.byte	0x9
+	.byte	0x35
+	.byte	0x3
+	.long	0x8d7
+	.uleb128 0xa
+	.long	0x988
+	.uleb128 0xb
+	.long	.LASF1792
+	.byte	0x9
+	.byte	0x37
+	.byte	0x1a
+	.long	0x988
+	.uleb128 0xb
+	.long	.LASF1793
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x16
+	.long	0x530
+	.uleb128 0xb
+	.long	.LASF1794
+	.byte	0xa
+	.byte	0x39
+	.byte	0x20
+	.long	0x994
+	.uleb128 0x13
+	.long	0x999
+	.byte	0x39
+	.byte	0x53
+	.uleb128 0xb
+	.long	.LASF1795
+	.byte	0xa
+	.byte	0x39
+	.byte	0x85
+	.long	0x193
+	.uleb128 0x20
+	.long	0x9c4
+	.byte	0xb2
+	.uleb128 0x21
+	.long	0x9b1
+	.byte	0x41
+	.byte	0x19
+	.uleb128 0x13
+	.long	0x9a5
+	.byte	0x8f
+	.byte	0xf
+	.uleb128 0x14
+	.long	.LASF1796
+	.byte	0x64
+	.long	0x530
+	.long	0x9fd
+	.uleb128 0x3
+	.long	0x9d
+	.uleb128 0x3
+	.long	0x6a4
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1803
+	.byte	0xc
+	.byte	0x89
+	.byte	0x6
+	.long	0xa0f
+	.uleb128 0x3
+	.long	0x888
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1797
+	.byte	0x63
+	.long	0x530
+	.long	0xa28
+	.uleb128 0x3
+	.long	0x9d
+	.uleb128 0x3
+	.long	0x6a4
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1798
+	.byte	0x17
+	.uleb128 0xe
+	.long	.LASF1799
+	.byte	0x18
+	.uleb128 0xe
+	.long	.LASF1800
+	.byte	0x16
+	.uleb128 0x15
+	.long	.LASF1801
+	.byte	0xd3
+	.long	0xa50
+	.uleb128 0x16
+	.long	.LASF1809
+	.byte	0xd4
+	.byte	0x13
+	.long	0x530
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1802
+	.byte	0xb0
+	.long	0xa66
+	.uleb128 0xf
+	.long	.LASF1805
+	.byte	0xb0
+	.byte	0x20
+	.long	0xa9
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1811
+	.byte	0x91
+	.uleb128 0x18
+	.long	.LASF1804
+	.byte	0x7f
+	.long	0x58b
+	.long	0xa86
+	.uleb128 0xf
+	.long	.LASF1806
+	.byte	0x7f
+	.byte	0x3a
+	.long	0xa86
+	.byte	0
+	.uleb128 0x4
+	.long	0x779
+	.uleb128 0x18
+	.long	.LASF1807
+	.byte	0x71
+	.long	0x58b
+	.long	0xab0
+	.uleb128 0xf
+	.long	.LASF1808
+	.byte	0x71
+	.byte	0x32
+	.long	0x632
+	.uleb128 0x16
+	.long	.LASF1810
+	.byte	0x73
+	.byte	0x9
+	.long	0x58b
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1812
+	.byte	0x50
+	.uleb128 0x23
+	.long	.LASF1814
+	.byte	0x9
+	.byte	0x37
+	.byte	0x59
+	.long	0xac2
+	.uleb128 0x4
+	.long	0x994
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF392
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF396
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.file 17 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF461
+	.file 19 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 20 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF540
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF633
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF656
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF540
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF716
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF720
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF721
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF817
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 33 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 34 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x22
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF940
+	.byte	0x4
+	.byte	0x4
+	.file 35 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3
+	.file 36 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 37 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 38 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x26
+	.file 39 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 40 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.file 41 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 42 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x60
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 43 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1463
+	.byte	0x4
+	.file 44 "./src/main/drivers/serial_softserial.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1464
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1465
+	.byte	0x4
+	.file 45 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2d
+	.file 46 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x4
+	.file 47 "./src/main/drivers/flash.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2f
+	.byte	0x4
+	.file 48 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 49 "./src/main/drivers/sdcard.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x31
+	.byte	0x4
+	.file 50 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 51 "./src/main/drivers/vcd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1471
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xc
+	.file 52 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1507
+	.byte	0x4
+	.file 53 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x35
+	.file 54 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 55 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1544
+	.byte	0x4
+	.file 56 "./src/main/telemetry/frsky.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x38
+	.byte	0x4
+	.file 57 "./src/main/telemetry/hott.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 58 "./src/main/telemetry/smartport.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0xb
+	.byte	0x4
+	.file 59 "./src/main/telemetry/jetiexbus.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x3b
+	.byte	0x4
+	.file 60 "./src/main/telemetry/mavlink.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x3c
+	.byte	0x4
+	.file 61 "./src/main/telemetry/crsf.h"
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x3d
+	.byte	0x4
+	.file 62 "./src/main/telemetry/srxl.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x3e
+	.byte	0x4
+	.file 63 "./src/main/telemetry/ibus.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1572
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.4da03ef923d6408c0c4a39663d2b5db9,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF449
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF460
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.fa1d490f015ef3aa7c96f38a7fe30e3a,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF478
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF479
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF480
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF481
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF483
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF484
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF485
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF486
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0xc9
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF495
+	.byte	0x6
+	.uleb128 0xcb
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0xcd
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0xcf
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0xd1
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0xd3
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF505
+	.byte	0x6
+	.uleb128 0xd5
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0xd7
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0xd9
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0xdb
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0xdd
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0xdf
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF517
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF527
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF530
+	.byte	0x6
+	.uleb128 0x167
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF534
+	.byte	0x6
+	.uleb128 0x170
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x172
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF536
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.61f49010091828b1aab1704e03e29717,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF553
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF612
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.2d9ac158e6f2ac2bd2ede1a2a422177c,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF713
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF719
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.6ff07ffbf70a79f26306bf407029e1a8,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF816
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.20.8418f70c8671eb8420ce843250a83aa7,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.25.cda4ebfc983af4fd83471128ac45cb56,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF823
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x3b
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x3c
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x3e
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x40
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF899
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF900
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF901
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF902
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF904
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF905
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF906
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF907
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF908
+	.byte	0x2
+	.uleb128 0x4f
+	.string	"GPS"
+	.byte	0x2
+	.uleb128 0x50
+	.string	"CMS"
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF910
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF912
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF913
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x59
+	.long	.LASF917
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x5b
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF939
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.b47b2eb400b2b8bba12125c599066519,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.10478805e621a17278ca187c5a37188b,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF965
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.65.17f5a58e92aec89ebb02138c5216ba7f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF988
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.1f25cc6f05b3e7fabd99f7a316235d58,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1070
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.28.2f4368210fb046730407614829040bb4,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1072
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.resource.h.72.c1b938e27e37862bf45214d6deebe8b7,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1074
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.33.6114369236de4bd4e510a2370b5ad523,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1082
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.24.5f400dee3b66ce637b67d2e4bd039f64,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1094
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.26.208640a71bda687db628f4cefe5a7aef,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1462
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_pwm.h.27.10f7a49998cf0b50bef24d662cc37744,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.9e2e467517359f40e8839021af4ad801,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1470
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_controls.h.62.b4f4cf84e505b1613fd081dda1c2af03,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.30.be9fddd79851a12b8ae6dc88cf52cb35,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1506
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.27.07521096acbd1fc23b5da89615487a6f,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1515
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.23.019bbc905a4abce23c470453ada22eab,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1543
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.hott.h.30.6fdec6e013da278855497bec11610729,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1570
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF1815
+	.long	.LASF1816
+	.long	.LASF1817
+	.long	.LASF1818
+	.long	.LASF1819
+	.long	.LASF1820
+	.long	.LASF1821
+	.long	.LASF1822
+	.long	.LASF1823
+	.long	.LASF1824
+	.long	.LASF1825
+	.long	.LASF1826
+	.long	.LASF1827
+	.long	.LASF1828
+	.long	.LASF1829
+	.long	.LASF1830
+	.long	.LASF1831
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x40
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1832
+	.byte	0xd
+	.long	.LASF1833
+	.byte	0xd
+	.long	.LASF1834
+	.byte	0x3
+	.long	.LASF1835
+	.byte	0x4
+	.long	.LASF1836
+	.byte	0x4
+	.long	.LASF1836
+	.byte	0x6
+	.long	.LASF1837
+	.byte	0x5
+	.long	.LASF1838
+	.byte	0x5
+	.long	.LASF1839
+	.byte	0xb
+	.long	.LASF1840
+	.byte	0xb
+	.long	.LASF1841
+	.byte	0xb
+	.long	.LASF1842
+	.byte	0x7
+	.long	.LASF1843
+	.byte	0x10
+	.long	.LASF1844
+	.byte	0x11
+	.long	.LASF1845
+	.byte	0x11
+	.long	.LASF1846
+	.byte	0x11
+	.long	.LASF1846
+	.byte	0x10
+	.long	.LASF1847
+	.byte	0xd
+	.long	.LASF1848
+	.byte	0x10
+	.long	.LASF1849
+	.byte	0x10
+	.long	.LASF1850
+	.byte	0xd
+	.long	.LASF1851
+	.byte	0xd
+	.long	.LASF1852
+	.byte	0xf
+	.long	.LASF1853
+	.byte	0xd
+	.long	.LASF1854
+	.byte	0xe
+	.long	.LASF1855
+	.byte	0xe
+	.long	.LASF1856
+	.byte	0xd
+	.long	.LASF1857
+	.byte	0xd
+	.long	.LASF1858
+	.byte	0xd
+	.long	.LASF1859
+	.byte	0xd
+	.long	.LASF1860
+	.byte	0xc
+	.long	.LASF1861
+	.byte	0xa
+	.long	.LASF1862
+	.byte	0x9
+	.long	.LASF1863
+	.byte	0xa
+	.long	.LASF1864
+	.byte	0x2
+	.long	.LASF1865
+	.byte	0x1
+	.long	.LASF1866
+	.byte	0x3
+	.long	.LASF1867
+	.byte	0x4
+	.long	.LASF1868
+	.byte	0x4
+	.long	.LASF1869
+	.byte	0x4
+	.long	.LASF1870
+	.byte	0x4
+	.long	.LASF1871
+	.byte	0x4
+	.long	.LASF1872
+	.byte	0x4
+	.long	.LASF1873
+	.byte	0x4
+	.long	.LASF1874
+	.byte	0x5
+	.long	.LASF1875
+	.byte	0x4
+	.long	.LASF1876
+	.byte	0x4
+	.long	.LASF1877
+	.byte	0x4
+	.long	.LASF1878
+	.byte	0x4
+	.long	.LASF1879
+	.byte	0x4
+	.long	.LASF1880
+	.byte	0x4
+	.long	.LASF1881
+	.byte	0x2
+	.long	.LASF1882
+	.byte	0x7
+	.long	.LASF1883
+	.byte	0x2
+	.long	.LASF1884
+	.byte	0x8
+	.long	.LASF1885
+	.byte	0xb
+	.long	.LASF1886
+	.byte	0xb
+	.long	.LASF1887
+	.byte	0xb
+	.long	.LASF1888
+	.byte	0xb
+	.long	.LASF1889
+	.byte	0xb
+	.long	.LASF1890
+	.byte	0xb
+	.long	.LASF1891
+	.byte	0xb
+	.long	.LASF1892
+	.byte	0xb
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1454:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1292:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1478:
+	.string	"PIT_LO (1 << (2 * PITCH))"
+.LASF794:
+	.string	"INT_LEAST16_WIDTH 16"
+.LASF1490:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + 25 * step)"
+.LASF1090:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1307:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF305:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF45:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1184:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1116:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF228:
+	.string	"__FLT32_DIG__ 6"
+.LASF441:
+	.string	"_WCHAR_T_DEFINED "
+.LASF857:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF555:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF517:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE 1"
+.LASF1210:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1308:
+	.string	"DEFIO_REC__PD13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF582:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF885:
+	.string	"USE_UART7 "
+.LASF243:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF460:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF786:
+	.string	"INT16_WIDTH 16"
+.LASF167:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF663:
+	.string	"__SQUAD_TYPE long int"
+.LASF889:
+	.string	"USE_PPM"
+.LASF229:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1228:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1686:
+	.string	"setMode"
+.LASF541:
+	.string	"__USE_MISC 1"
+.LASF1458:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF830:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1357:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF872:
+	.string	"USE_FAKE_GYRO "
+.LASF1464:
+	.string	"SOFTSERIAL_BUFFER_SIZE 256"
+.LASF966:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1096:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF606:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF246:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF891:
+	.string	"SERIAL_RX"
+.LASF94:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1580:
+	.string	"__uint8_t"
+.LASF717:
+	.string	"_BITS_WCHAR_H 1"
+.LASF51:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1664:
+	.string	"vTable"
+.LASF1586:
+	.string	"uint32_t"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1358:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1693:
+	.string	"_Bool"
+.LASF627:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1552:
+	.string	"HOTTV4_BUTTON_NEXT 0xEE"
+.LASF886:
+	.string	"USE_UART8 "
+.LASF869:
+	.string	"U_ID_2 2"
+.LASF191:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF150:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF322:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1075:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1797:
+	.string	"findSharedSerialPort"
+.LASF852:
+	.string	"TELEMETRY_SRXL "
+.LASF559:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1606:
+	.string	"OWNER_ADC_CURR"
+.LASF183:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1445:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1318:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1310:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1418:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1493:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / 25)"
+.LASF1245:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1079:
+	.string	"IOCFG_AF_OD 0"
+.LASF972:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while(0)"
+.LASF1650:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF195:
+	.string	"__LDBL_DIG__ 18"
+.LASF1147:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1097:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF483:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1381:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1564:
+	.string	"HOTT_TELEMETRY_AIRESC_SENSOR_ID 0x8c"
+.LASF1327:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF459:
+	.string	"_STDINT_H 1"
+.LASF988:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1701:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1501:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1086:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF433:
+	.string	"__WCHAR_T__ "
+.LASF858:
+	.string	"USE_SENSOR_NAMES "
+.LASF1450:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF169:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1026:
+	.string	"PG_THROTTLE_CORRECTION_CONFIG 39"
+.LASF454:
+	.string	"_STDBOOL_H "
+.LASF97:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1422:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1160:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1397:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1294:
+	.string	"DEFIO_TAG__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1603:
+	.string	"OWNER_LED"
+.LASF580:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1457:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF175:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF262:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1585:
+	.string	"uint16_t"
+.LASF1150:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF91:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1460:
+	.string	"DEFIO_PORT_USED_COUNT 4"
+.LASF379:
+	.string	"linux 1"
+.LASF315:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF713:
+	.string	"__FD_SETSIZE 1024"
+.LASF671:
+	.string	"__STD_TYPE typedef"
+.LASF1062:
+	.string	"PG_VTX_CONFIG 515"
+.LASF1011:
+	.string	"PG_RX_CONFIG 24"
+.LASF1708:
+	.string	"FUNCTION_ESC_SENSOR"
+.LASF1220:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1389:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1280:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF561:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF221:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1368:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF841:
+	.string	"TELEMETRY_HOTT "
+.LASF1287:
+	.string	"DEFIO_REC__PD6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF978:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF423:
+	.string	"_SIZE_T_DEFINED "
+.LASF1811:
+	.string	"telemetryCheckState"
+.LASF1321:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF933:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1157:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF494:
+	.string	"_ISOC95_SOURCE"
+.LASF1083:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF403:
+	.string	"_T_PTRDIFF_ "
+.LASF1395:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF751:
+	.string	"INT_FAST8_MAX (127)"
+.LASF660:
+	.string	"__U32_TYPE unsigned int"
+.LASF1525:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1270:
+	.string	"DEFIO_TAG__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1332:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1022:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1570:
+	.string	"HOTT_VARIO_MSG_TEXT_LEN 21"
+.LASF1236:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF126:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF629:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF481:
+	.string	"__USE_MISC"
+.LASF152:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF223:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1223:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF321:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF86:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF955:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1306:
+	.string	"DEFIO_TAG__PD13 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 13)"
+.LASF976:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## "
+	.string	"_System; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .ptr = 0, _reset, }"
+.LASF432:
+	.string	"__wchar_t__ "
+.LASF238:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF124:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1109:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1217:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF472:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1301:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF778:
+	.string	"UINT8_C(c) c"
+.LASF1474:
+	.string	"AIRMODEDEADBAND 12"
+.LASF1413:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1538:
+	.string	"RSSI_SCALE_MIN 1"
+.LASF1139:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF618:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF680:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF69:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF115:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF268:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1273:
+	.string	"DEFIO_TAG__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF1030:
+	.string	"PG_RX_FAILSAFE_CHANNEL_CONFIG 43"
+.LASF95:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1348:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF336:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1805:
+	.string	"currentTime"
+.LASF1568:
+	.string	"HOTT_GPS_SENSOR_TEXT_ID 0xA0"
+.LASF259:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1377:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF80:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1449:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1610:
+	.string	"OWNER_SERIAL_RX"
+.LASF709:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1630:
+	.string	"OWNER_SPI_CS"
+.LASF31:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1703:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF280:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1117:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1082:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF57:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF424:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF40:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF219:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF952:
+	.string	"BIT(x) (1 << (x))"
+.LASF1635:
+	.string	"OWNER_BEEPER"
+.LASF144:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1466:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF971:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if(pgIsSystem(_name)) continue; else"
+.LASF755:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1125:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1142:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1334:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF136:
+	.string	"__UINT16_C(c) c"
+.LASF350:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1727:
+	.string	"functionMask"
+.LASF1276:
+	.string	"DEFIO_TAG__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF557:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF875:
+	.string	"BARO "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1688:
+	.string	"beginWrite"
+.LASF443:
+	.string	"___int_wchar_t_h "
+.LASF1425:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF348:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1371:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF463:
+	.string	"__USE_ISOC11"
+.LASF1088:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF865:
+	.string	"SCHEDULER_DELAY_LIMIT"
+.LASF1192:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF916:
+	.string	"USE_RESOURCE_MGMT"
+.LASF1500:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF787:
+	.string	"UINT16_WIDTH 16"
+.LASF188:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF914:
+	.string	"VTX_TRAMP"
+.LASF1549:
+	.string	"HOTTV4_BUTTON_INC 0xED"
+.LASF628:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1632:
+	.string	"OWNER_BARO_EXTI"
+.LASF1007:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF282:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF601:
+	.string	"__always_inline"
+.LASF1208:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF810:
+	.string	"INTMAX_WIDTH 64"
+.LASF1645:
+	.string	"MODE_RX"
+.LASF536:
+	.string	"__USE_LARGEFILE64 1"
+.LASF230:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF890:
+	.string	"USE_PWM"
+.LASF811:
+	.string	"UINTMAX_WIDTH 64"
+.LASF725:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF261:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1609:
+	.string	"OWNER_SERIAL_TX"
+.LASF898:
+	.string	"USE_SERIALRX_XBUS"
+.LASF1737:
+	.string	"BOXMAG"
+.LASF947:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1027:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF718:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF201:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF82:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1040:
+	.string	"PG_IBUS_TELEMETRY_CONFIG 53"
+.LASF1041:
+	.string	"PG_DRIVER_PWM_RX_CONFIG 100"
+.LASF1590:
+	.string	"PGR_SIZE_MASK"
+.LASF1195:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF63:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1691:
+	.string	"setRxFrameCallback"
+.LASF747:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF690:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF854:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1762:
+	.string	"BOXFPVANGLEMIX"
+.LASF1188:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1253:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1665:
+	.string	"identifier"
+.LASF1319:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF288:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1311:
+	.string	"DEFIO_REC__PD14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF574:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1696:
+	.string	"PORTSHARING_SHARED"
+.LASF853:
+	.string	"USE_DASHBOARD "
+.LASF530:
+	.string	"__USE_UNIX98 1"
+.LASF226:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1520:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1351:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF122:
+	.string	"__INT8_C(c) c"
+.LASF635:
+	.string	"__stub_chflags "
+.LASF1747:
+	.string	"BOXLEDLOW"
+.LASF1424:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1633:
+	.string	"OWNER_USB"
+.LASF1156:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF240:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1058:
+	.string	"PG_SDCARD_CONFIG 511"
+.LASF395:
+	.string	"__TARGET__ \"SITL\""
+.LASF457:
+	.string	"false 0"
+.LASF1644:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF166:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1550:
+	.string	"HOTTV4_BUTTON_SET 0xE9"
+.LASF774:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1364:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF428:
+	.string	"_GCC_SIZE_T "
+.LASF639:
+	.string	"__stub_setlogin "
+.LASF1268:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF1646:
+	.string	"MODE_TX"
+.LASF496:
+	.string	"_ISOC99_SOURCE"
+.LASF1735:
+	.string	"BOXHORIZON"
+.LASF1512:
+	.string	"MSP_PORT_MAX_HEADER_SIZE 8"
+.LASF299:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF227:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF641:
+	.string	"__stub_stty "
+.LASF982:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF537:
+	.string	"__WORDSIZE 64"
+.LASF264:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1499:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF106:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1554:
+	.string	"HOTT_EAM_OFFSET_HEIGHT 500"
+.LASF776:
+	.string	"INT32_C(c) c"
+.LASF123:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1333:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"PG_PID_PROFILE 14"
+.LASF1677:
+	.string	"rxCallback"
+.LASF168:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF157:
+	.string	"__GCC_IEC_559_COMPLEX 0"
+.LASF1557:
+	.string	"HOTT_EAM_OFFSET_TEMPERATURE 20"
+.LASF390:
+	.string	"FLASH_SIZE 2048"
+.LASF1140:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1063:
+	.string	"PG_SONAR_CONFIG 516"
+.LASF225:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1748:
+	.string	"BOXLLIGHTS"
+.LASF1271:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 1)"
+.LASF1614:
+	.string	"OWNER_SONAR_ECHO"
+.LASF905:
+	.string	"TELEMETRY_SRXL"
+.LASF329:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF613:
+	.string	"__attribute_copy__"
+.LASF1374:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF425:
+	.string	"_SIZE_T_DECLARED "
+.LASF545:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF200:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF643:
+	.string	"__GLIBC_USE_LIB_EXT2 1"
+.LASF1019:
+	.string	"PG_FRSKY_TELEMETRY_CONFIG 32"
+.LASF724:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1736:
+	.string	"BOXBARO"
+.LASF969:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF214:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1602:
+	.string	"OWNER_SERVO"
+.LASF1187:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF873:
+	.string	"ACC "
+.LASF594:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF849:
+	.string	"TELEMETRY_IBUS "
+.LASF828:
+	.string	"USE_PWM "
+.LASF1404:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF334:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF434:
+	.string	"_WCHAR_T "
+.LASF1471:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF160:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF654:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1555:
+	.string	"HOTT_EAM_OFFSET_M2S 72"
+.LASF1502:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1200:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1155:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF968:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\".pg_resetdata\"), used, aligned(2)))"
+.LASF1442:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF272:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1304:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF181:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF409:
+	.string	"_GCC_PTRDIFF_T "
+.LASF286:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1123:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF756:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1190:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF165:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1516:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF773:
+	.string	"WINT_MAX (4294967295u)"
+.LASF83:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1473:
+	.string	"ACTIVATE_RC_MODE(modeId) (rcModeActivationMask |= (1 << modeId))"
+.LASF1581:
+	.string	"__uint16_t"
+.LASF1486:
+	.string	"THR_HI (2 << (2 * THROTTLE))"
+.LASF1669:
+	.string	"rxBufferSize"
+.LASF1601:
+	.string	"OWNER_MOTOR"
+.LASF178:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1207:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF929:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1706:
+	.string	"FUNCTION_BLACKBOX"
+.LASF364:
+	.string	"__k8 1"
+.LASF522:
+	.string	"__USE_POSIX 1"
+.LASF467:
+	.string	"__USE_POSIX"
+.LASF1629:
+	.string	"OWNER_RX_SPI_CS"
+.LASF444:
+	.string	"__INT_WCHAR_T_H "
+.LASF203:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1475:
+	.string	"ROL_LO (1 << (2 * ROLL))"
+.LASF312:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1240:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1182:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1778:
+	.string	"gpsNoFixLatitude"
+.LASF1095:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF625:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1367:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF502:
+	.string	"_POSIX_SOURCE"
+.LASF283:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1675:
+	.string	"txBufferHead"
+.LASF754:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF172:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1666:
+	.string	"mode"
+.LASF1126:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF98:
+	.string	"__INT_WIDTH__ 32"
+.LASF1417:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF294:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1773:
+	.string	"frskyGpsCoordFormat_e"
+.LASF344:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF139:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1226:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF611:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF134:
+	.string	"__UINT8_C(c) c"
+.LASF965:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1533:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF234:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF650:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1787:
+	.string	"hottAlarmSoundInterval"
+.LASF1243:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF945:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF53:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1248:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF738:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1435:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF355:
+	.string	"__amd64 1"
+.LASF1409:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1702:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1575:
+	.string	"unsigned char"
+.LASF721:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF748:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF626:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1069:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1072:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF970:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF41:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF410:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1046:
+	.string	"PG_BETAFLIGHT_START 500"
+.LASF1437:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1020:
+	.string	"PG_HOTT_TELEMETRY_CONFIG 33"
+.LASF1323:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF674:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1566:
+	.string	"HOTT_TELEMETRY_EAM_SENSOR_ID 0x8e"
+.LASF1582:
+	.string	"__uint32_t"
+.LASF1050:
+	.string	"PG_BEEPER_DEV_CONFIG 503"
+.LASF85:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1481:
+	.string	"YAW_LO (1 << (2 * YAW))"
+.LASF1790:
+	.string	"float"
+.LASF1802:
+	.string	"telemetryProcess"
+.LASF182:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF998:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF465:
+	.string	"__USE_ISOC95"
+.LASF974:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF464:
+	.string	"__USE_ISOC99"
+.LASF1733:
+	.string	"BOXARM"
+.LASF1414:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1396:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF775:
+	.string	"INT16_C(c) c"
+.LASF1212:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1687:
+	.string	"writeBuf"
+.LASF871:
+	.string	"GYRO "
+.LASF279:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF855:
+	.string	"USE_MSP_PUSH "
+.LASF110:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF38:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF325:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1711:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1077:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1070:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF720:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF358:
+	.string	"__x86_64__ 1"
+.LASF850:
+	.string	"TELEMETRY_JETIEXBUS "
+.LASF402:
+	.string	"_PTRDIFF_T "
+.LASF1749:
+	.string	"BOXCALIB"
+.LASF1662:
+	.string	"pgRegistry_s"
+.LASF622:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF103:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF474:
+	.string	"__USE_XOPEN2K"
+.LASF1164:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF470:
+	.string	"__USE_POSIX199506"
+.LASF960:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1689:
+	.string	"endWrite"
+.LASF1698:
+	.string	"FUNCTION_NONE"
+.LASF417:
+	.string	"_T_SIZE_ "
+.LASF381:
+	.string	"__unix__ 1"
+.LASF388:
+	.string	"__FPU_PRESENT 1"
+.LASF1745:
+	.string	"BOXBEEPERON"
+.LASF512:
+	.string	"_DEFAULT_SOURCE"
+.LASF1169:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1592:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1154:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF73:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1430:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1641:
+	.string	"OWNER_VTX"
+.LASF600:
+	.string	"__wur "
+.LASF1399:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF33:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1503:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF563:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1370:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF932:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1800:
+	.string	"initLtmTelemetry"
+.LASF233:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1230:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1005:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF808:
+	.string	"INTPTR_WIDTH __WORDSIZE"
+.LASF1403:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF513:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF440:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1235:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF682:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1324:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF836:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1303:
+	.string	"DEFIO_TAG__PD12 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 12)"
+.LASF1623:
+	.string	"OWNER_SDCARD_DETECT"
+.LASF795:
+	.string	"UINT_LEAST16_WIDTH 16"
+.LASF1420:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF112:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1114:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF560:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF722:
+	.string	"__intptr_t_defined "
+.LASF730:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF741:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF616:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF162:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1209:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF23:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF573:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1285:
+	.string	"DEFIO_TAG__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF1201:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1528:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF257:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF664:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1119:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF477:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1346:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1171:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF758:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1238:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF104:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1588:
+	.string	"PGR_PGN_MASK"
+.LASF1755:
+	.string	"BOXSERVO1"
+.LASF1756:
+	.string	"BOXSERVO2"
+.LASF1757:
+	.string	"BOXSERVO3"
+.LASF1491:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / 25)"
+.LASF540:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF310:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF164:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1684:
+	.string	"serialSetBaudRate"
+.LASF511:
+	.string	"_LARGEFILE64_SOURCE 1"
+.LASF44:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1314:
+	.string	"DEFIO_REC__PD15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF863:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1440:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF161:
+	.string	"__FLT_RADIX__ 2"
+.LASF128:
+	.string	"__INT32_C(c) c"
+.LASF624:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1369:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF210:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1025:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF276:
+	.string	"__FLT32X_DIG__ 15"
+.LASF825:
+	.string	"DEFAULT_AUX_CHANNEL_COUNT MAX_AUX_CHANNEL_COUNT"
+.LASF780:
+	.string	"UINT32_C(c) c ## U"
+.LASF1775:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF484:
+	.string	"__USE_GNU"
+.LASF1452:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF734:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF159:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1035:
+	.string	"PG_MSP_SERVER_CONFIG 48"
+.LASF1791:
+	.string	"telemetryConfig_t"
+.LASF1729:
+	.string	"gps_baudrateIndex"
+.LASF1060:
+	.string	"PG_DISPLAY_PORT_MAX7456_CONFIG 513"
+.LASF1476:
+	.string	"ROL_CE (3 << (2 * ROLL))"
+.LASF719:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1411:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1174:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1671:
+	.string	"rxBuffer"
+.LASF777:
+	.string	"INT64_C(c) c ## L"
+.LASF1670:
+	.string	"txBufferSize"
+.LASF1654:
+	.string	"SERIAL_PARITY_NO"
+.LASF313:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF486:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF54:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF670:
+	.string	"__U64_TYPE unsigned long int"
+.LASF275:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF714:
+	.string	"_BITS_TIME64_H 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF753:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF78:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1205:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF56:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1536:
+	.string	"MAX_SUPPORTED_RX_PARALLEL_PWM_OR_PPM_CHANNEL_COUNT MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT"
+.LASF694:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF936:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF1801:
+	.string	"releaseSharedTelemetryPorts"
+.LASF1634:
+	.string	"OWNER_USB_DETECT"
+.LASF1754:
+	.string	"BOXSONAR"
+.LASF1291:
+	.string	"DEFIO_TAG__PD8 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 8)"
+.LASF1433:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1074:
+	.string	"RESOURCE_SOFT_OFFSET 10"
+.LASF1594:
+	.string	"size"
+.LASF479:
+	.string	"__USE_LARGEFILE64"
+.LASF1255:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF242:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF602:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1045:
+	.string	"PG_VOLTAGE_SENSOR_ADC_CONFIG 258"
+.LASF30:
+	.string	"__LP64__ 1"
+.LASF543:
+	.string	"__USE_DYNAMIC_STACK_SIZE 1"
+.LASF658:
+	.string	"__U16_TYPE unsigned short int"
+.LASF597:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF864:
+	.string	"TASK_GYROPID_DESIRED_PERIOD"
+.LASF631:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF206:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF374:
+	.string	"__SEG_FS 1"
+.LASF587:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1786:
+	.string	"frsky_vfas_cell_voltage"
+.LASF281:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1260:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1789:
+	.string	"report_cell_voltage"
+.LASF59:
+	.string	"__INT16_TYPE__ short int"
+.LASF260:
+	.string	"__FLT128_DIG__ 33"
+.LASF1265:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF490:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF866:
+	.string	"SCHEDULER_DELAY_LIMIT 10"
+.LASF1444:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF76:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF427:
+	.string	"___int_size_t_h "
+.LASF370:
+	.string	"__FXSR__ 1"
+.LASF72:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1541:
+	.string	"RX_FAILSAFE_MODE_COUNT 3"
+.LASF1129:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF422:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1638:
+	.string	"OWNER_INVERTER"
+.LASF908:
+	.string	"TELEMETRY_IBUS"
+.LASF342:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1269:
+	.string	"DEFIO_REC__PD0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1618:
+	.string	"OWNER_SPI_MOSI"
+.LASF1423:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1593:
+	.string	"pgResetFunc"
+.LASF696:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1584:
+	.string	"uint8_t"
+.LASF1170:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1168:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF636:
+	.string	"__stub_fchflags "
+.LASF1774:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1788:
+	.string	"pidValuesAsTelemetry"
+.LASF662:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF323:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF918:
+	.string	"USE_DSHOT"
+.LASF1272:
+	.string	"DEFIO_REC__PD1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF949:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF839:
+	.string	"TELEMETRY "
+.LASF1767:
+	.string	"ARMED"
+.LASF1039:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF356:
+	.string	"__amd64__ 1"
+.LASF1275:
+	.string	"DEFIO_REC__PD2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF493:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1761:
+	.string	"BOX3DDISABLESWITCH"
+.LASF1532:
+	.string	"MAX_SUPPORTED_RC_PARALLEL_PWM_CHANNEL_COUNT 8"
+.LASF538:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1071:
+	.string	"IO_TAG_NONE IO_TAG(NONE)"
+.LASF1785:
+	.string	"frsky_vfas_precision"
+.LASF445:
+	.string	"_GCC_WCHAR_T "
+.LASF614:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1515:
+	.string	"MSP_PUSH_MAX_RATE_HZ 200"
+.LASF675:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF903:
+	.string	"TELEMETRY_SMARTPORT"
+.LASF1067:
+	.string	"PG_OSD_ELEMENT_CONFIG 2045"
+.LASF770:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF733:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF148:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF621:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1362:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF24:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF382:
+	.string	"unix 1"
+.LASF1769:
+	.string	"rcModeActivationMask"
+.LASF1416:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF196:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF520:
+	.string	"__USE_ISOC99 1"
+.LASF1715:
+	.string	"SERIAL_PORT_USART2"
+.LASF1283:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF904:
+	.string	"TELEMETRY_CRSF"
+.LASF349:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF847:
+	.string	"CMS "
+.LASF620:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF420:
+	.string	"_SIZE_T_ "
+.LASF701:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1483:
+	.string	"YAW_HI (2 << (2 * YAW))"
+.LASF1806:
+	.string	"portConfig"
+.LASF216:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1089:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF431:
+	.string	"__need_size_t"
+.LASF1717:
+	.string	"SERIAL_PORT_UART4"
+.LASF1718:
+	.string	"SERIAL_PORT_UART5"
+.LASF1712:
+	.string	"serialPortFunction_e"
+.LASF412:
+	.string	"__need_ptrdiff_t"
+.LASF1567:
+	.string	"HOTT_EAM_SENSOR_TEXT_ID 0xE0"
+.LASF533:
+	.string	"__USE_XOPEN2K8XSI 1"
+.LASF806:
+	.string	"INT_FAST64_WIDTH 64"
+.LASF114:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF819:
+	.string	"DEBUG_MODE DEBUG_NONE"
+.LASF951:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1436:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1191:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1172:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1379:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF878:
+	.string	"USE_FAKE_MAG "
+.LASF324:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF768:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF497:
+	.string	"_ISOC99_SOURCE 1"
+.LASF61:
+	.string	"__INT64_TYPE__ long int"
+.LASF1120:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF314:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1376:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF176:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1394:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF817:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1219:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF685:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF783:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF473:
+	.string	"__USE_UNIX98"
+.LASF1455:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1517:
+	.string	"PWM_RANGE_ZERO 0"
+.LASF1316:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF534:
+	.string	"__USE_XOPEN2KXSI 1"
+.LASF566:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1013:
+	.string	"PG_MOTOR_3D_CONFIG 26"
+.LASF987:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF220:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF977:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1135:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF96:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF637:
+	.string	"__stub_gtty "
+.LASF1562:
+	.string	"HOTT_TELEMETRY_VARIO_SENSOR_ID 0x89"
+.LASF1543:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF43:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF708:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1158:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF89:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1673:
+	.string	"rxBufferHead"
+.LASF1772:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF354:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1204:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF369:
+	.string	"__SSE2__ 1"
+.LASF1763:
+	.string	"BOXBLACKBOXERASE"
+.LASF735:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1551:
+	.string	"HOTTV4_BUTTON_NIL 0x0F"
+.LASF710:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF915:
+	.string	"BLACKBOX"
+.LASF1372:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1031:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1061:
+	.string	"PG_VCD_CONFIG 514"
+.LASF900:
+	.string	"LED_STRIP"
+.LASF1353:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"HOTT_TELEMETRY_NO_SENSOR_ID 0x80"
+.LASF823:
+	.string	"TASK_GYROPID_DESIRED_PERIOD 1000"
+.LASF781:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1335:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1804:
+	.string	"telemetryCheckRxPortShared"
+.LASF211:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF736:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF803:
+	.string	"UINT_FAST16_WIDTH __WORDSIZE"
+.LASF608:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1398:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF109:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF130:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1138:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1229:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF544:
+	.string	"__USE_GNU 1"
+.LASF896:
+	.string	"USE_SERIALRX_SUMD"
+.LASF132:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF897:
+	.string	"USE_SERIALRX_SUMH"
+.LASF1482:
+	.string	"YAW_CE (3 << (2 * YAW))"
+.LASF1264:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF301:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF840:
+	.string	"TELEMETRY_FRSKY "
+.LASF1093:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF107:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1340:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF548:
+	.string	"__GNU_LIBRARY__"
+.LASF1059:
+	.string	"PG_DISPLAY_PORT_MSP_CONFIG 512"
+.LASF743:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF62:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1401:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1613:
+	.string	"OWNER_SONAR_TRIGGER"
+.LASF1563:
+	.string	"HOTT_TELEMETRY_GPS_SENSOR_ID 0x8a"
+.LASF1709:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1595:
+	.string	"address"
+.LASF1392:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1338:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1242:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1704:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1479:
+	.string	"PIT_CE (3 << (2 * PITCH))"
+.LASF189:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF895:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF156:
+	.string	"__GCC_IEC_559 0"
+.LASF745:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1141:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF581:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1081:
+	.string	"IOCFG_IPU 0"
+.LASF1544:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK)"
+.LASF986:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF728:
+	.string	"INT16_MAX (32767)"
+.LASF1284:
+	.string	"DEFIO_REC__PD5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF450:
+	.string	"NULL"
+.LASF1792:
+	.string	"telemetryConfig_System"
+.LASF1263:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1446:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1615:
+	.string	"OWNER_SYSTEM"
+.LASF143:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF975:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF922:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF554:
+	.string	"__PMT"
+.LASF1730:
+	.string	"blackbox_baudrateIndex"
+.LASF446:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1780:
+	.string	"telemetry_switch"
+.LASF391:
+	.string	"HSE_VALUE 8000000"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF116:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF789:
+	.string	"UINT32_WIDTH 32"
+.LASF1731:
+	.string	"telemetry_baudrateIndex"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF371:
+	.string	"__SSE_MATH__ 1"
+.LASF941:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1091:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((ioTag_t)((((gpioid) + 1) << 4) | (pin)))"
+.LASF1290:
+	.string	"DEFIO_REC__PD7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1427:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1771:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF146:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF298:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1037:
+	.string	"PG_AMPERAGE_METER_CONFIG 50"
+.LASF397:
+	.string	"_STDC_PREDEF_H 1"
+.LASF822:
+	.string	"I2C2_OVERCLOCK true"
+.LASF1699:
+	.string	"FUNCTION_MSP"
+.LASF1598:
+	.string	"OWNER_FREE"
+.LASF129:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1770:
+	.string	"armingFlags"
+.LASF782:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1808:
+	.string	"portSharing"
+.LASF1322:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF193:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1506:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF353:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1591:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF271:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF995:
+	.string	"PG_SENSOR_SELECTION_CONFIG 7"
+.LASF1432:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1166:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF300:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1296:
+	.string	"DEFIO_REC__PD9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF296:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF87:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1167:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1130:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF66:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1514:
+	.string	"MSP_PUSH_MAX_COMMANDS 8"
+.LASF84:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF509:
+	.string	"_XOPEN_SOURCE_EXTENDED 1"
+.LASF1137:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF92:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1239:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF661:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF963:
+	.string	"UNIT_TESTED "
+.LASF1545:
+	.string	"HOTTV4_RXTX 4"
+.LASF994:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1777:
+	.string	"telemetryConfig_s"
+.LASF258:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF204:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF352:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF158:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF762:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF550:
+	.string	"__GLIBC__ 2"
+.LASF1003:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF93:
+	.string	"__WINT_MIN__ 0U"
+.LASF927:
+	.string	"USED_TIMERS 0"
+.LASF749:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF113:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF729:
+	.string	"INT32_MAX (2147483647)"
+.LASF438:
+	.string	"_WCHAR_T_ "
+.LASF1100:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF931:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1300:
+	.string	"DEFIO_TAG__PD11 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 11)"
+.LASF1813:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -Ofast -std=gnu99 -ffunction-sections -fdata-sections -fcommon -flto -fuse-linker-plugin -ffast-math -fasynchronous-unwind-tables"
+.LASF564:
+	.string	"__P(args) args"
+.LASF1488:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF845:
+	.string	"USE_SERVOS "
+.LASF761:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF973:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF739:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF818:
+	.string	"USE_PARAMETER_GROUPS "
+.LASF416:
+	.string	"_SYS_SIZE_T_H "
+.LASF686:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF816:
+	.string	"WINT_WIDTH 32"
+.LASF1133:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1121:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF250:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1267:
+	.string	"DEFIO_TAG__PD0 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 0)"
+.LASF357:
+	.string	"__x86_64 1"
+.LASF1099:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1410:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF485:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1781:
+	.string	"telemetry_inversion"
+.LASF833:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1183:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF516:
+	.string	"_DYNAMIC_STACK_SIZE_SOURCE"
+.LASF1341:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF586:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF766:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF697:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF727:
+	.string	"INT8_MAX (127)"
+.LASF476:
+	.string	"__USE_XOPEN2K8"
+.LASF769:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF989:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1383:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF698:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF452:
+	.string	"__need_NULL"
+.LASF453:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1136:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF392:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1131:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF489:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF539:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF368:
+	.string	"__SSE__ 1"
+.LASF478:
+	.string	"__USE_LARGEFILE"
+.LASF308:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF827:
+	.string	"USE_PPM "
+.LASF331:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1112:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF571:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1647:
+	.string	"MODE_RXTX"
+.LASF899:
+	.string	"USE_SERIALRX_JETIEXBUS"
+.LASF1695:
+	.string	"PORTSHARING_NOT_SHARED"
+.LASF1494:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 100"
+.LASF524:
+	.string	"__USE_POSIX199309 1"
+.LASF771:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF64:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF926:
+	.string	"USABLE_TIMER_CHANNEL_COUNT 0"
+.LASF1286:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 6)"
+.LASF589:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1186:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1565:
+	.string	"HOTT_TELEMETRY_GAM_SENSOR_ID 0x8d"
+.LASF88:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1768:
+	.string	"WAS_EVER_ARMED"
+.LASF1596:
+	.string	"reset"
+.LASF1173:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF996:
+	.string	"PG_SENSOR_ALIGNMENT_CONFIG 8"
+.LASF498:
+	.string	"_ISOC11_SOURCE"
+.LASF1197:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF199:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF570:
+	.string	"__END_DECLS "
+.LASF942:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF319:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1621:
+	.string	"OWNER_SDCARD"
+.LASF1202:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF578:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1355:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF309:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1441:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF683:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF290:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1036:
+	.string	"PG_VOLTAGE_METER_CONFIG 49"
+.LASF1556:
+	.string	"HOTT_EAM_OFFSET_M3S 120"
+.LASF712:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF387:
+	.string	"_GNU_SOURCE 1"
+.LASF1288:
+	.string	"DEFIO_TAG__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF269:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF351:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1576:
+	.string	"short unsigned int"
+.LASF274:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1578:
+	.string	"signed char"
+.LASF967:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\".pg_registry\"), used, aligned(4)))"
+.LASF186:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1189:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF386:
+	.string	"SIMULATOR_BUILD 1"
+.LASF413:
+	.string	"__size_t__ "
+.LASF843:
+	.string	"TELEMETRY_SMARTPORT "
+.LASF526:
+	.string	"__USE_XOPEN2K 1"
+.LASF1547:
+	.string	"HOTTV4_BINARY_MODE_REQUEST_ID 0x80"
+.LASF844:
+	.string	"USE_RESOURCE_MGMT "
+.LASF1152:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1438:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"DEFAULT_RX_FEATURE FEATURE_RX_MSP"
+.LASF442:
+	.string	"_WCHAR_T_H "
+.LASF1262:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF304:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1004:
+	.string	"PG_TRANSPONDER_CONFIG 17"
+.LASF590:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1033:
+	.string	"PG_SPECIAL_COLOR_CONFIG 46"
+.LASF39:
+	.string	"__CHAR_BIT__ 8"
+.LASF508:
+	.string	"_XOPEN_SOURCE_EXTENDED"
+.LASF1043:
+	.string	"PG_CURRENT_SENSOR_ADC_CONFIG 256"
+.LASF1651:
+	.string	"SERIAL_INVERTED"
+.LASF785:
+	.string	"UINT8_WIDTH 8"
+.LASF655:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 1"
+.LASF763:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF634:
+	.string	"__stub___compat_bdflush "
+.LASF1803:
+	.string	"mspSerialReleasePortIfAllocated"
+.LASF1814:
+	.string	"telemetryConfig"
+.LASF1347:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1266:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1764:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF462:
+	.string	"_FEATURES_H 1"
+.LASF1522:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF302:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF421:
+	.string	"_BSD_SIZE_T_ "
+.LASF1165:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1365:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF592:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF909:
+	.string	"USE_DASHBOARD"
+.LASF842:
+	.string	"TELEMETRY_LTM "
+.LASF1524:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF60:
+	.string	"__INT32_TYPE__ int"
+.LASF1098:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1213:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1740:
+	.string	"BOXCAMSTAB"
+.LASF954:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1103:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1469:
+	.string	"BEEP_OFF do {} while(0)"
+.LASF347:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1480:
+	.string	"PIT_HI (2 << (2 * PITCH))"
+.LASF633:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1012:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1529:
+	.string	"DEFAULT_SERVO_MIN_ANGLE 90"
+.LASF684:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1723:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1724:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1344:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1643:
+	.string	"OWNER_CROS_EC"
+.LASF232:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1760:
+	.string	"BOXAIRMODE"
+.LASF394:
+	.string	"__FORKNAME__ \"betaflight\""
+.LASF253:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF930:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1016:
+	.string	"PG_AIRPLANE_CONFIG 29"
+.LASF1667:
+	.string	"options"
+.LASF1178:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF500:
+	.string	"_ISOC2X_SOURCE"
+.LASF316:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1705:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF507:
+	.string	"_XOPEN_SOURCE 700"
+.LASF102:
+	.string	"__WINT_WIDTH__ 32"
+.LASF676:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF153:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF837:
+	.string	"BLACKBOX "
+.LASF207:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF401:
+	.string	"_ANSI_STDDEF_H "
+.LASF1809:
+	.string	"sharedPort"
+.LASF1559:
+	.string	"HOTT_TEXT_MODE_REQUEST_ID 0x7f"
+.LASF1066:
+	.string	"PG_OSD_VIDEO_CONFIG 2046"
+.LASF1636:
+	.string	"OWNER_OSD"
+.LASF558:
+	.string	"__LEAF , __leaf__"
+.LASF70:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1325:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1356:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1439:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1589:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1146:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1405:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1021:
+	.string	"PG_NAVIGATION_CONFIG 34"
+.LASF1794:
+	.string	"pgResetTemplate_telemetryConfig"
+.LASF1073:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF247:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF145:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1054:
+	.string	"PG_PPM_CONFIG 507"
+.LASF1738:
+	.string	"BOXHEADFREE"
+.LASF328:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1795:
+	.string	"telemetryConfig_Registry"
+.LASF1107:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1504:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1289:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 7)"
+.LASF920:
+	.string	"USE_SCHEDULER_TRACE "
+.LASF1144:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF623:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF750:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF831:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1181:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1087:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1765:
+	.string	"OK_TO_ARM"
+.LASF1122:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF861:
+	.string	"VTX_SMARTAUDIO "
+.LASF957:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1251:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1018:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF678:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1799:
+	.string	"checkLtmTelemetryState"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF677:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1343:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1657:
+	.string	"SERIAL_BIDIR"
+.LASF378:
+	.string	"__linux__ 1"
+.LASF1497:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1113:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1231:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1722:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF921:
+	.string	"USE_PROFILE "
+.LASF568:
+	.string	"__ptr_t void *"
+.LASF1313:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1477:
+	.string	"ROL_HI (2 << (2 * ROLL))"
+.LASF1519:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF983:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF846:
+	.string	"GPS "
+.LASF667:
+	.string	"__SLONG32_TYPE int"
+.LASF1299:
+	.string	"DEFIO_REC__PD10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF90:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1298:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1714:
+	.string	"SERIAL_PORT_USART1"
+.LASF320:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1716:
+	.string	"SERIAL_PORT_USART3"
+.LASF911:
+	.string	"VTX_COMMON"
+.LASF1719:
+	.string	"SERIAL_PORT_USART6"
+.LASF1720:
+	.string	"SERIAL_PORT_USART7"
+.LASF1721:
+	.string	"SERIAL_PORT_USART8"
+.LASF359:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1681:
+	.string	"serialTotalRxWaiting"
+.LASF1094:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1015:
+	.string	"PG_COLOR_CONFIG 28"
+.LASF127:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF231:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF466:
+	.string	"__USE_ISOCXX11"
+.LASF1387:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1573:
+	.string	"long int"
+.LASF1485:
+	.string	"THR_CE (3 << (2 * THROTTLE))"
+.LASF1216:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1008:
+	.string	"PG_SERVO_MIXER 21"
+.LASF190:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF119:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF248:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF217:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF492:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF723:
+	.string	"INT8_MIN (-128)"
+.LASF337:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF731:
+	.string	"UINT8_MAX (255)"
+.LASF1234:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1611:
+	.string	"OWNER_PINDEBUG"
+.LASF1161:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF330:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1428:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF285:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF726:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF804:
+	.string	"INT_FAST32_WIDTH __WORDSIZE"
+.LASF1751:
+	.string	"BOXOSD"
+.LASF1783:
+	.string	"frsky_coordinate_format"
+.LASF565:
+	.string	"__PMT(args) args"
+.LASF1508:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF848:
+	.string	"TELEMETRY_CRSF "
+.LASF406:
+	.string	"_PTRDIFF_T_ "
+.LASF393:
+	.string	"SITL 1"
+.LASF101:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF740:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF252:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF405:
+	.string	"__PTRDIFF_T "
+.LASF791:
+	.string	"UINT64_WIDTH 64"
+.LASF1261:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF362:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF25:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF700:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF999:
+	.string	"PG_BATTERY_CONFIG 11"
+.LASF1388:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF796:
+	.string	"INT_LEAST32_WIDTH 32"
+.LASF239:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF553:
+	.string	"_SYS_CDEFS_H 1"
+.LASF948:
+	.string	"EXPAND_I(x) x"
+.LASF1237:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1382:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1526:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1328:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF907:
+	.string	"TELEMETRY_MAVLINK"
+.LASF1194:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF800:
+	.string	"INT_FAST8_WIDTH 8"
+.LASF1661:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF419:
+	.string	"__SIZE_T "
+.LASF705:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1496:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1674:
+	.string	"rxBufferTail"
+.LASF1766:
+	.string	"PREVENT_ARMING"
+.LASF340:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF491:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF788:
+	.string	"INT32_WIDTH 32"
+.LASF688:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF363:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF704:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF267:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1361:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF418:
+	.string	"_T_SIZE "
+.LASF291:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1743:
+	.string	"BOXGPSHOLD"
+.LASF1034:
+	.string	"PG_PILOT_CONFIG 47"
+.LASF389:
+	.string	"__FPU_USED 1"
+.LASF1685:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF523:
+	.string	"__USE_POSIX2 1"
+.LASF1051:
+	.string	"PG_PID_CONFIG 504"
+.LASF447:
+	.string	"__DEFINED_wchar_t "
+.LASF1495:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 255"
+.LASF1548:
+	.string	"HOTTV4_BUTTON_DEC 0xEB"
+.LASF577:
+	.string	"__flexarr []"
+.LASF838:
+	.string	"LED_STRIP "
+.LASF583:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF656:
+	.string	"_BITS_TYPES_H 1"
+.LASF901:
+	.string	"TELEMETRY_FRSKY"
+.LASF256:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF345:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF744:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF801:
+	.string	"UINT_FAST8_WIDTH 8"
+.LASF1739:
+	.string	"BOXHEADADJ"
+.LASF471:
+	.string	"__USE_XOPEN"
+.LASF579:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF28:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF647:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 1"
+.LASF1281:
+	.string	"DEFIO_REC__PD4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF295:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF985:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF435:
+	.string	"_T_WCHAR_ "
+.LASF365:
+	.string	"__k8__ 1"
+.LASF48:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF991:
+	.string	"PG_GIMBAL_CONFIG 3"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1177:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF737:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF292:
+	.string	"__FLT64X_DIG__ 18"
+.LASF504:
+	.string	"_POSIX_C_SOURCE"
+.LASF812:
+	.string	"PTRDIFF_WIDTH __WORDSIZE"
+.LASF1742:
+	.string	"BOXGPSHOME"
+.LASF1252:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1612:
+	.string	"OWNER_TIMER"
+.LASF659:
+	.string	"__S32_TYPE int"
+.LASF155:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1032:
+	.string	"PG_MODE_COLOR_CONFIG 45"
+.LASF343:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1163:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1360:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1390:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF529:
+	.string	"__USE_XOPEN_EXTENDED 1"
+.LASF1336:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF939:
+	.string	"__enable_irq() "
+.LASF1104:
+	.string	"DEFIO_PORT_D_USED_MASK TARGET_IO_PORTD"
+.LASF100:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF752:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF797:
+	.string	"UINT_LEAST32_WIDTH 32"
+.LASF1583:
+	.string	"char"
+.LASF1521:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1233:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF679:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF640:
+	.string	"__stub_sigreturn "
+.LASF1810:
+	.string	"enabled"
+.LASF215:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1317:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF546:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 0"
+.LASF807:
+	.string	"UINT_FAST64_WIDTH 64"
+.LASF71:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1078:
+	.string	"IOCFG_AF_PP 0"
+.LASF870:
+	.string	"LED0_PIN NONE"
+.LASF599:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF657:
+	.string	"__S16_TYPE short int"
+.LASF1297:
+	.string	"DEFIO_TAG__PD10 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 10)"
+.LASF254:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF415:
+	.string	"_SIZE_T "
+.LASF1746:
+	.string	"BOXLEDMAX"
+.LASF1758:
+	.string	"BOXBLACKBOX"
+.LASF505:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF596:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1391:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1145:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1713:
+	.string	"SERIAL_PORT_NONE"
+.LASF138:
+	.string	"__UINT32_C(c) c ## U"
+.LASF990:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF542:
+	.string	"__USE_ATFILE 1"
+.LASF1305:
+	.string	"DEFIO_REC__PD12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1759:
+	.string	"BOXFAILSAFE"
+.LASF856:
+	.string	"USE_RX_MSP "
+.LASF944:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1279:
+	.string	"DEFIO_TAG__PD4 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 4)"
+.LASF456:
+	.string	"true 1"
+.LASF1331:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF603:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF222:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1492:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF691:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF501:
+	.string	"_ISOC2X_SOURCE 1"
+.LASF1537:
+	.string	"MAX_MAPPABLE_RX_INPUTS 8"
+.LASF205:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1779:
+	.string	"gpsNoFixLongitude"
+.LASF266:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1453:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF716:
+	.string	"__STD_TYPE"
+.LASF1507:
+	.string	"TIMEUS_MAX UINT32_MAX"
+.LASF702:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1527:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF746:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF458:
+	.string	"__bool_true_false_are_defined 1"
+.LASF668:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF77:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF430:
+	.string	"__size_t "
+.LASF1655:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF821:
+	.string	"I2C1_OVERCLOCK true"
+.LASF1812:
+	.string	"telemetryInit"
+.LASF940:
+	.string	"USE_FLASHFS_LOG_INDEX"
+.LASF1148:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF32:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF194:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1753:
+	.string	"BOXGTUNE"
+.LASF1024:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF81:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1282:
+	.string	"DEFIO_TAG__PD5 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 5)"
+.LASF451:
+	.string	"NULL ((void *)0)"
+.LASF1461:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK,DEFIO_PORT_D_USED_MASK"
+.LASF1624:
+	.string	"OWNER_FLASH_CS"
+.LASF42:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF792:
+	.string	"INT_LEAST8_WIDTH 8"
+.LASF376:
+	.string	"__gnu_linux__ 1"
+.LASF892:
+	.string	"USE_SERIALRX_CRSF"
+.LASF946:
+	.string	"STR_HELPER(x) #x"
+.LASF1511:
+	.string	"MSP_PORT_STREAM_LIMIT 0xffff"
+.LASF332:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF303:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1509:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF1029:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF913:
+	.string	"VTX_SMARTAUDIO"
+.LASF832:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1616:
+	.string	"OWNER_SPI_SCK"
+.LASF111:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1198:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1068:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1608:
+	.string	"OWNER_ADC_RSSI"
+.LASF961:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1359:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF894:
+	.string	"USE_SERIALRX_SBUS"
+.LASF876:
+	.string	"USE_FAKE_BARO "
+.LASF488:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF619:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1505:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1176:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1214:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF604:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF449:
+	.string	"__need_wchar_t"
+.LASF984:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[PG_PROFILE_COUNT]; _P"
+	.ascii	"G_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry"
+	.ascii	"_t _nam"
+	.string	"e ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF760:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1151:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF404:
+	.string	"_T_PTRDIFF "
+.LASF556:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF535:
+	.string	"__USE_LARGEFILE 1"
+.LASF177:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF645:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 1"
+.LASF1540:
+	.string	"RSSI_SCALE_DEFAULT 30"
+.LASF874:
+	.string	"USE_FAKE_ACC "
+.LASF510:
+	.string	"_LARGEFILE64_SOURCE"
+.LASF377:
+	.string	"__linux 1"
+.LASF1053:
+	.string	"PG_FLASH_CONFIG 506"
+.LASF1339:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF552:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF270:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF630:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF632:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1302:
+	.string	"DEFIO_REC__PD11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF923:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1218:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1065:
+	.string	"PG_OSD_FONT_CONFIG 2047"
+.LASF1694:
+	.string	"PORTSHARING_UNUSED"
+.LASF1726:
+	.string	"serialPortConfig_s"
+.LASF1732:
+	.string	"serialPortConfig_t"
+.LASF1498:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1259:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1434:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF495:
+	.string	"_ISOC95_SOURCE 1"
+.LASF1380:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1118:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF519:
+	.string	"__USE_ISOC11 1"
+.LASF1295:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 9)"
+.LASF1456:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF605:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1232:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF572:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF297:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF383:
+	.string	"__ELF__ 1"
+.LASF1162:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1752:
+	.string	"BOXTELEMETRY"
+.LASF244:
+	.string	"__FLT64_DIG__ 15"
+.LASF335:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1676:
+	.string	"txBufferTail"
+.LASF318:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1572:
+	.string	"TELEMETRY_FUNCTION_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_HOTT | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_SMARTPORT)"
+.LASF531:
+	.string	"_LARGEFILE_SOURCE"
+.LASF666:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1489:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1042:
+	.string	"PG_DRIVER_FLASHCHIP_CONFIG 101"
+.LASF979:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF480:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1274:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 2)"
+.LASF187:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1044:
+	.string	"PG_CURRENT_SENSOR_VIRTUAL_CONFIG 257"
+.LASF27:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF824:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF820:
+	.string	"USE_SCHEDULER_DEADLINE_QUEUE "
+.LASF980:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; extern"
+	.string	" const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .ptr = 0, _reset, }"
+.LASF1052:
+	.string	"PG_STATUS_LED_CONFIG 505"
+.LASF1558:
+	.string	"HOTT_GPS_ALTITUDE_OFFSET 500"
+.LASF1350:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF506:
+	.string	"_XOPEN_SOURCE"
+.LASF1206:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF224:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1064:
+	.string	"PG_BETAFLIGHT_END 516"
+.LASF1467:
+	.string	"PWM_INPUT_PORT_COUNT 8"
+.LASF689:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1619:
+	.string	"OWNER_I2C_SCL"
+.LASF1617:
+	.string	"OWNER_SPI_MISO"
+.LASF1111:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1620:
+	.string	"OWNER_I2C_SDA"
+.LASF346:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1642:
+	.string	"OWNER_COMPASS_CS"
+.LASF956:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1134:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF36:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1384:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF992:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF699:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF515:
+	.string	"_ATFILE_SOURCE 1"
+.LASF236:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF439:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1215:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1277:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 3)"
+.LASF399:
+	.string	"_STDDEF_H "
+.LASF742:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF935:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF591:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1402:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1254:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1656:
+	.string	"SERIAL_UNIDIR"
+.LASF1542:
+	.string	"RX_FAILSAFE_TYPE_COUNT 2"
+.LASF1750:
+	.string	"BOXGOV"
+.LASF461:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF251:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1193:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF468:
+	.string	"__USE_POSIX2"
+.LASF1363:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"TELEMETRY_HOTT"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1009:
+	.string	"PG_IMU_CONFIG 22"
+.LASF826:
+	.string	"USE_CLI "
+.LASF1408:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1153:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1625:
+	.string	"OWNER_FLASH"
+.LASF1668:
+	.string	"baudRate"
+.LASF1443:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1038:
+	.string	"PG_DEBUG_CONFIG 51"
+.LASF1017:
+	.string	"PG_GPS_CONFIG 30"
+.LASF366:
+	.string	"__code_model_small__ 1"
+.LASF1725:
+	.string	"serialPortIdentifier_e"
+.LASF665:
+	.string	"__SWORD_TYPE long int"
+.LASF1080:
+	.string	"IOCFG_IPD 0"
+.LASF475:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1342:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF757:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1560:
+	.string	"HOTT_BINARY_MODE_REQUEST_ID 0x80"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1728:
+	.string	"msp_baudrateIndex"
+.LASF1539:
+	.string	"RSSI_SCALE_MAX 255"
+.LASF1672:
+	.string	"txBuffer"
+.LASF436:
+	.string	"_T_WCHAR "
+.LASF1373:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF429:
+	.string	"_SIZET_ "
+.LASF58:
+	.string	"__INT8_TYPE__ signed char"
+.LASF798:
+	.string	"INT_LEAST64_WIDTH 64"
+.LASF1354:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF732:
+	.string	"UINT16_MAX (65535)"
+.LASF1535:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF372:
+	.string	"__SSE2_MATH__ 1"
+.LASF333:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1196:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF367:
+	.string	"__MMX__ 1"
+.LASF1221:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF707:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF400:
+	.string	"_STDDEF_H_ "
+.LASF1092:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF715:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1110:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1459:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1128:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF672:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1776:
+	.string	"frskyUnit_e"
+.LASF1329:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1523:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1105:
+	.string	"DEFIO_PORT_D_USED_COUNT BITCOUNT(DEFIO_PORT_D_USED_MASK)"
+.LASF1337:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF711:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF779:
+	.string	"UINT16_C(c) c"
+.LASF1014:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1246:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF765:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1312:
+	.string	"DEFIO_TAG__PD15 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 15)"
+.LASF1637:
+	.string	"OWNER_RX_BIND"
+.LASF790:
+	.string	"INT64_WIDTH 64"
+.LASF74:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF860:
+	.string	"VTX_CONTROL "
+.LASF448:
+	.string	"_BSD_WCHAR_T_"
+.LASF1640:
+	.string	"OWNER_TRANSPONDER"
+.LASF1010:
+	.string	"PG_PROFILE_SELECTION 23"
+.LASF469:
+	.string	"__USE_POSIX199309"
+.LASF767:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1546:
+	.string	"HOTTV4_TEXT_MODE_REQUEST_ID 0x7f"
+.LASF375:
+	.string	"__SEG_GS 1"
+.LASF22:
+	.string	"__FAST_MATH__ 1"
+.LASF277:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1199:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF407:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF437:
+	.string	"__WCHAR_T "
+.LASF1320:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF648:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1679:
+	.string	"serialPortVTable"
+.LASF1258:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF361:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF317:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF125:
+	.string	"__INT16_C(c) c"
+.LASF1652:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1700:
+	.string	"FUNCTION_GPS"
+.LASF1653:
+	.string	"SERIAL_STOPBITS_2"
+.LASF141:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1648:
+	.string	"portMode_t"
+.LASF1115:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF953:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF518:
+	.string	"__GLIBC_USE_ISOC2X 1"
+.LASF868:
+	.string	"U_ID_1 1"
+.LASF867:
+	.string	"U_ID_0 0"
+.LASF34:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF919:
+	.string	"USE_GYRO_DATA_ANALYSE"
+.LASF79:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF532:
+	.string	"_LARGEFILE_SOURCE 1"
+.LASF99:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1707:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF117:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1627:
+	.string	"OWNER_MPU_CS"
+.LASF1587:
+	.string	"pgn_t"
+.LASF1056:
+	.string	"PG_SERIAL_PIN_CONFIG 509"
+.LASF1149:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF384:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1518:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1407:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1697:
+	.string	"portSharing_e"
+.LASF910:
+	.string	"USE_MSP_DISPLAYPORT"
+.LASF917:
+	.string	"USE_SERVOS"
+.LASF149:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF799:
+	.string	"UINT_LEAST64_WIDTH 64"
+.LASF877:
+	.string	"MAG "
+.LASF569:
+	.string	"__BEGIN_DECLS "
+.LASF609:
+	.string	"__restrict_arr __restrict"
+.LASF1345:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF958:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1006:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF137:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF938:
+	.string	"__disable_irq() "
+.LASF1510:
+	.string	"MSP_PORT_OUTBUF_SIZE 256"
+.LASF1349:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF249:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1660:
+	.string	"serialReceiveCallbackPtr"
+.LASF1426:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1784:
+	.string	"frsky_unit"
+.LASF525:
+	.string	"__USE_POSIX199506 1"
+.LASF237:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF140:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF928:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF638:
+	.string	"__stub_revoke "
+.LASF67:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF610:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF993:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1385:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF209:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF527:
+	.string	"__USE_XOPEN2K8 1"
+.LASF959:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF687:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF834:
+	.string	"USE_SERIALRX_SUMD "
+.LASF339:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF68:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1658:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1049:
+	.string	"PG_BEEPER_CONFIG 502"
+.LASF1605:
+	.string	"OWNER_ADC_BATT"
+.LASF1023:
+	.string	"PG_RATE_PROFILE_SELECTION 36"
+.LASF937:
+	.string	"EEPROM_SIZE 32768"
+.LASF584:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1249:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1683:
+	.string	"serialRead"
+.LASF284:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF706:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1278:
+	.string	"DEFIO_REC__PD3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1690:
+	.string	"readBuf"
+.LASF289:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF26:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF212:
+	.string	"__FLT16_DIG__ 3"
+.LASF47:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF514:
+	.string	"_ATFILE_SOURCE"
+.LASF1124:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF809:
+	.string	"UINTPTR_WIDTH __WORDSIZE"
+.LASF1386:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF802:
+	.string	"INT_FAST16_WIDTH __WORDSIZE"
+.LASF180:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF547:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1143:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1663:
+	.string	"serialPort_s"
+.LASF1692:
+	.string	"serialPort_t"
+.LASF1599:
+	.string	"OWNER_PWMINPUT"
+.LASF652:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1472:
+	.string	"IS_RC_MODE_ACTIVE(modeId) ((1 << (modeId)) & rcModeActivationMask)"
+.LASF1227:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1448:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1682:
+	.string	"serialTotalTxFree"
+.LASF1487:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF585:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF962:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1241:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF503:
+	.string	"_POSIX_SOURCE 1"
+.LASF1309:
+	.string	"DEFIO_TAG__PD14 DEFIO_TAG_MAKE(DEFIO_GPIOID__D, 14)"
+.LASF1659:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1569:
+	.string	"HOTT_TEXTMODE_MSG_TEXT_LEN 168"
+.LASF311:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF764:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF813:
+	.string	"SIG_ATOMIC_WIDTH 32"
+.LASF455:
+	.string	"bool _Bool"
+.LASF408:
+	.string	"___int_ptrdiff_t_h "
+.LASF499:
+	.string	"_ISOC11_SOURCE 1"
+.LASF273:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1127:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF612:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF703:
+	.string	"__TIMER_T_TYPE void *"
+.LASF950:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1447:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF835:
+	.string	"USE_SERIALRX_SUMH "
+.LASF287:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1101:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF241:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF893:
+	.string	"USE_SERIALRX_IBUS"
+.LASF1431:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1484:
+	.string	"THR_LO (1 << (2 * THROTTLE))"
+.LASF851:
+	.string	"TELEMETRY_MAVLINK "
+.LASF549:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1203:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1807:
+	.string	"telemetryDetermineEnabledState"
+.LASF693:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF772:
+	.string	"WINT_MIN (0u)"
+.LASF1244:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1076:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1649:
+	.string	"portOptions_t"
+.LASF1470:
+	.string	"BEEP_ON do {} while(0)"
+.LASF1530:
+	.string	"DEFAULT_SERVO_MAX_ANGLE 90"
+.LASF997:
+	.string	"PG_SENSOR_TRIMS 9"
+.LASF1622:
+	.string	"OWNER_SDCARD_CS"
+.LASF924:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF327:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF964:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF213:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1352:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF426:
+	.string	"__DEFINED_size_t "
+.LASF1108:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF135:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1106:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF105:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF879:
+	.string	"USE_UART1 "
+.LASF118:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1429:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1315:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1375:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF593:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1224:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF185:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1678:
+	.string	"rxFrameCallback"
+.LASF1180:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1798:
+	.string	"handleLtmTelemetry"
+.LASF1247:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF815:
+	.string	"WCHAR_WIDTH 32"
+.LASF192:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF307:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF482:
+	.string	"__USE_ATFILE"
+.LASF1057:
+	.string	"PG_ADC_CONFIG 510"
+.LASF173:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1326:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1710:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF278:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1211:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF887:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF380:
+	.string	"__unix 1"
+.LASF615:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF306:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF208:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF163:
+	.string	"__FLT_DIG__ 6"
+.LASF925:
+	.string	"TARGET_IO_PORTD 0xffff"
+.LASF595:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1574:
+	.string	"long unsigned int"
+.LASF1084:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1639:
+	.string	"OWNER_LED_STRIP"
+.LASF1796:
+	.string	"findNextSharedSerialPort"
+.LASF759:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF880:
+	.string	"USE_UART2 "
+.LASF859:
+	.string	"VTX_COMMON "
+.LASF487:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF862:
+	.string	"VTX_TRAMP "
+.LASF649:
+	.string	"__GLIBC_USE_IEC_60559_EXT 1"
+.LASF651:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 1"
+.LASF170:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1531:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 12"
+.LASF1468:
+	.string	"BEEP_TOGGLE do {} while(0)"
+.LASF695:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF293:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF814:
+	.string	"SIZE_WIDTH __WORDSIZE"
+.LASF1513:
+	.string	"MSP_SERIAL_PROCESS_TIME_US 250"
+.LASF37:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF912:
+	.string	"VTX_CONTROL"
+.LASF75:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1451:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF692:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF793:
+	.string	"UINT_LEAST8_WIDTH 8"
+.LASF255:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF265:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF174:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1001:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1680:
+	.string	"serialWrite"
+.LASF1028:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1782:
+	.string	"sportHalfDuplex"
+.LASF1256:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF881:
+	.string	"USE_UART3 "
+.LASF829:
+	.string	"SERIAL_RX "
+.LASF1793:
+	.string	"telemetrySharedPort"
+.LASF1571:
+	.string	"TELEMETRY_DEFAULT_INVERSION 0"
+.LASF202:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1102:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF35:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1553:
+	.string	"HOTTV4_BUTTON_PREV 0xE7"
+.LASF326:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF414:
+	.string	"__SIZE_T__ "
+.LASF1085:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1159:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF681:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF398:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF197:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1626:
+	.string	"OWNER_BARO_CS"
+.LASF575:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF567:
+	.string	"__STRING(x) #x"
+.LASF1047:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 500"
+.LASF1185:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF55:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF528:
+	.string	"__USE_XOPEN 1"
+.LASF805:
+	.string	"UINT_FAST32_WIDTH __WORDSIZE"
+.LASF1577:
+	.string	"unsigned int"
+.LASF882:
+	.string	"USE_UART4 "
+.LASF1293:
+	.string	"DEFIO_REC__PD8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_D_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF644:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1366:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__REVISION__ \"6d9f4e0\""
+.LASF1534:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF588:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF943:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF653:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 1"
+.LASF598:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1393:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1179:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF171:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1744:
+	.string	"BOXPASSTHRU"
+.LASF673:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF551:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1055:
+	.string	"PG_PWM_CONFIG 508"
+.LASF49:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF198:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1330:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1604:
+	.string	"OWNER_ADC"
+.LASF1579:
+	.string	"short int"
+.LASF373:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1631:
+	.string	"OWNER_MPU_EXTI"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1597:
+	.string	"pgRegistry_t"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF562:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1415:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1463:
+	.string	"SERIAL_PORT_MAX_INDEX RESOURCE_SOFT_OFFSET"
+.LASF1222:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1741:
+	.string	"BOXCAMTRIG"
+.LASF29:
+	.string	"_LP64 1"
+.LASF883:
+	.string	"USE_UART5 "
+.LASF1378:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1734:
+	.string	"BOXANGLE"
+.LASF1000:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF669:
+	.string	"__S64_TYPE long int"
+.LASF151:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1465:
+	.string	"SERIAL_PORT_IDENTIFIER_TO_RESOURCE_INDEX(x) (((x) <= SERIAL_PORT_USART8) ? (x) : (RESOURCE_SOFT_OFFSET + ((x) - SERIAL_PORT_SOFTSERIAL1)))"
+.LASF906:
+	.string	"TELEMETRY_JETIEXBUS"
+.LASF385:
+	.string	"DEBUG 1"
+.LASF1607:
+	.string	"OWNER_ADC_EXT"
+.LASF1132:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1048:
+	.string	"PG_OSD_CONFIG 501"
+.LASF142:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF108:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1175:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF784:
+	.string	"INT8_WIDTH 8"
+.LASF1600:
+	.string	"OWNER_PPMINPUT"
+.LASF617:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF147:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF934:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1628:
+	.string	"OWNER_OSD_CS"
+.LASF50:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1419:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF411:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF981:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF133:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF235:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF646:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF521:
+	.string	"__USE_ISOC95 1"
+.LASF121:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF131:
+	.string	"__INT64_C(c) c ## L"
+.LASF642:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1462:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET,DEFIO_PORT_D_OFFSET"
+.LASF884:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF179:
+	.string	"__DBL_DIG__ 15"
+.LASF607:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1225:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1885:
+	.string	"frsky.h"
+.LASF1859:
+	.string	"stdint-intn.h"
+.LASF1853:
+	.string	"long-double.h"
+.LASF1860:
+	.string	"platform.h"
+.LASF1822:
+	.string	"src/main/rx"
+.LASF1818:
+	.string	"src/main/drivers"
+.LASF1867:
+	.string	"timer.h"
+.LASF1877:
+	.string	"rx_pwm.h"
+.LASF1847:
+	.string	"libc-header-start.h"
+.LASF1890:
+	.string	"crsf.h"
+.LASF1829:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1820:
+	.string	"src/main/io"
+.LASF1850:
+	.string	"wordsize.h"
+.LASF1837:
+	.string	"rc_controls.h"
+.LASF1828:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1831:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1854:
+	.string	"stubs.h"
+.LASF1823:
+	.string	"src/main/target/SITL"
+.LASF1842:
+	.string	"msp_serial.h"
+.LASF1862:
+	.string	"target.h"
+.LASF1851:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1872:
+	.string	"io_def_generated.h"
+.LASF1827:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1840:
+	.string	"telemetry.c"
+.LASF1874:
+	.string	"config.h"
+.LASF1891:
+	.string	"srxl.h"
+.LASF1873:
+	.string	"serial_softserial.h"
+.LASF1849:
+	.string	"features-time64.h"
+.LASF1880:
+	.string	"vcd.h"
+.LASF1879:
+	.string	"sound_beeper.h"
+.LASF1832:
+	.string	"types.h"
+.LASF1868:
+	.string	"io_types.h"
+.LASF1838:
+	.string	"runtime_config.h"
+.LASF1845:
+	.string	"stdbool.h"
+.LASF1830:
+	.string	"/usr/include"
+.LASF1815:
+	.string	"src/main/build"
+.LASF1869:
+	.string	"rcc_types.h"
+.LASF1848:
+	.string	"features.h"
+.LASF1861:
+	.string	"common.h"
+.LASF1856:
+	.string	"typesizes.h"
+.LASF1816:
+	.string	"src/main/common"
+.LASF1836:
+	.string	"serial.h"
+.LASF1889:
+	.string	"mavlink.h"
+.LASF1817:
+	.string	"src/main/config"
+.LASF0:
+	.string	"./src/main/telemetry/telemetry.c"
+.LASF1876:
+	.string	"flash.h"
+.LASF1857:
+	.string	"time64.h"
+.LASF1886:
+	.string	"hott.h"
+.LASF1833:
+	.string	"stdint-uintn.h"
+.LASF1824:
+	.string	"src/main/target"
+.LASF1864:
+	.string	"utils.h"
+.LASF1883:
+	.string	"streambuf.h"
+.LASF1878:
+	.string	"sdcard.h"
+.LASF1888:
+	.string	"jetiexbus.h"
+.LASF1826:
+	.string	"src/main"
+.LASF1839:
+	.string	"telemetry.h"
+.LASF1881:
+	.string	"time.h"
+.LASF1866:
+	.string	"parameter_group_ids.h"
+.LASF1825:
+	.string	"src/main/telemetry"
+.LASF1884:
+	.string	"rx.h"
+.LASF1841:
+	.string	"ltm.h"
+.LASF1871:
+	.string	"io_def.h"
+.LASF1819:
+	.string	"src/main/fc"
+.LASF1870:
+	.string	"io.h"
+.LASF1882:
+	.string	"msp.h"
+.LASF1821:
+	.string	"src/main/msp"
+.LASF1852:
+	.string	"cdefs.h"
+.LASF1846:
+	.string	"stdint.h"
+.LASF1865:
+	.string	"build_config.h"
+.LASF1858:
+	.string	"wchar.h"
+.LASF1855:
+	.string	"stubs-64.h"
+.LASF1844:
+	.string	"stddef.h"
+.LASF1892:
+	.string	"ibus.h"
+.LASF1863:
+	.string	"common_post.h"
+.LASF1875:
+	.string	"adc.h"
+.LASF1834:
+	.string	"parameter_group.h"
+.LASF1835:
+	.string	"resource.h"
+.LASF1843:
+	.string	"stdc-predef.h"
+.LASF1887:
+	.string	"smartport.h"
+	.text
+	.section	.gnu.lto_.profile.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"["
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013"
+	.string	"\263\361\376\217\017\002\002"
+	.string	"\002"
+	.string	"\002\253\304\372\354\016"
+	.string	"\003\276\363\367\210\f\004\002\001\002\002\002\001\002\001\004\240\342\234\212\n\006\224\331\374\302\007\002\002\003\002\004\007\262\374\202\245\005"
+	.string	"\b\312\336\235\231\b"
+	.string	"\t\310\326\303\367\006"
+	.string	"\n\352\263\360\321\b\013\225\370\327\211\013\f\271\344\251\232\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375 F\335\001"
+	.string	"\304\002:"
+	.string	"\007"
+	.string	""
+	.string	"\003\002"
+	.string	"\001\003\001\003"
+	.string	"\002\006\001\001\002\005\002\003"
+	.string	"\002\001\020\002\006\003\007\b\001\001"
+	.string	"\001\t"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	" \204\237\021rF\313\205\275\001,"
+	.text
+	.section	.gnu.lto_.inline.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375`\275"
+	.string	"\365\006"
+	.string	"\002\314&,`k\222\0160tA|AgG\305\002;\002\251p\241\256k\\\344\200\226\352\355\363"
+	.string	"&"
+	.string	""
+	.string	"\034@pV\204\341M\177B\032\331R\246\377O\320\004\020|J\372\023\204)\305G\205\0062\260\214\016\007\216\201\001 \227C\253gTYH?/S\367\271\005\245\363\266S\216\"\210\3015\244\244U\027)I\025a\233\026\333\334e\"'I\037U\254a\203A\"`\b\372S\311\204\224zp\347\245\017\036\027\023\002[\204\nw\227\231\230n\356\316\271\377\275\253\267\354\372\264Tsw\351\325\264\b\032"
+	.string	"1\341\323x\300"
+	.ascii	"\r\bNS\350\362f\030\315\312?\nA|\030\201\025\f\001\223\003\235"
+	.ascii	"6\301\335\344\216e\005\252$/\r\310\007\001\210 s\t,\244\300\355"
+	.ascii	"(\204^\302\2759\256KP\005\030\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375 \203u\002"
+	.string	"R\004\r\026\260%\351L\235KI\222:@\t\303B\207Q`#\033o\"S\n\002\276x\244ft\364\037\212N\231\316\226\r\324H\005\311\364\t\315\361e\315\214\037S\003\211\t"
+	.string	"Pq8*N\230\355"
+	.ascii	"\262\231\235\005;\356\334\032s=\030\264\001"
+	.text
+	.section	.gnu.lto_.pureconst.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\204\004\002\230\004\003\204\004\006\205\004\007\230\004\b\230"
+	.ascii	"\004\t\270\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375 o\025\002"
+	.string	"4\002c"
+	.string	"\007"
+	.string	"\001\002\b\001\002\003\001\300\007"
+	.string	""
+	.string	"\006\001\300\005\n"
+	.string	"\001\002\005"
+	.string	"\001\020\020\007"
+	.string	"\b\001\t\002"
+	.string	"\f"
+	.ascii	",D|UF*\272=\003\353\f\323\324%9G\001U\007\363\330\316\034\260"
+	.ascii	"m\003m"
+	.text
+	.section	.gnu.lto_.lto.24767c63f7f5559c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_telemetryConfig_Registry.49.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375 \212\355\003"
+	.string	"\304\006O"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\303\274\334\r\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\364\005us"
+	.string	"\005\001\006'\001\034\037(qo\300\001m\277\001k\276\001i\275\001g\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/telemetry.c"
+	.string	"\005"
+	.string	"\323\262\260\224\261)\255\202(A\006"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_pgResetTemplate_telemetryConfig.51.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375 h\305\002"
+	.string	"\224\004["
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\005\005\001\006\177}\035\001\001\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	"?\202\210\200\340\001{y\301\001w\300\001u\273\001s\273\001q\277\001o\276\001m\275\001k\273\001i\273\001g\274\001e\273\001c\273\001"
+	.string	"\005"
+	.string	",\225)w_\232N\301z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_telemetryInit.52.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\355\007"
+	.string	"\"N46Pm\323\001\200\330oc()+\242\200$\372R\277]\204\205/\220\263U\016\370\342\2665m\330\374\216\211h`3\241'\322\270\"\260\037\225\371%\t\b\007\262\267L)\306\\4\027Ve*\207\n\223\017\r\f\031\211\271\"\344\245\300\026DuI\314\262.I\315\316\271'p\244\217\324\201\232\243\372\235\304\273+\230\214,\224\\|+\007#/\252\255\231\320o&\320 \307\003 \363SYe\261\247\246\220\303~\\\270aG\201\322'C\303\003\242\314\265h)\355h\"\371\260}_\364n\363\220\247\n\357\023\332]\352\223/\332\330\324\247S\316\354\224O\320>\004D!\342\355\256\204\035\317\256\231\177\356\001\233\207s\005@\330]\353\346\301\270\341m\033\330\226\266O\002\020"
+	.ascii	"i\331'\323\"\f\317\021\266\301\204%\325\326\323\006`X\275\262"
+	.ascii	"\306;\305pMD\037\2024T\340\227+\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.53.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375`\024\002\355\022"
+	.string	"\306\244\200H\320\360(\0350K\2361&\n\b\325\217\344\3426\357A\211(\273\025cyR\217\273\330P\026\365\217\362\373io\370Y\306\240\237\274\204sL\3301\213\037\006:u\345\362+s\235w\005\252\017\304\025{\346\362\037\221\275\245L)l"
+	.string	"h"
+	.string	"j"
+	.string	"1F\315\351A)\305\234a\002\217\234.WW}\227\361\003\276K\333&Y \343\331C\020\270\353$\325\020\335\2303d\355\207\317\376\311\270:\363\317{\374\351\200t\313\315\374\363\310\335\\\236n\036Ar4q5\347L\345l\272\361\200\316\205\006\220\334\205\250\202\241#\343\274\253M\256\246\332q2\347\264\336r\031\356\216\333\216`\033\202\255\r\002+\2322\371\217\371\344~\3731\024\243WT\323&\007\b\372Y\2421\225\311\016k\272<\366\343\234szwl\324\252O\337w\277|x\307\207\367\256ZW}\017"
+	.ascii	"6t\034t\224\026)\234\270\246\034\323H\026\211xx\373%dR\252\035"
+	.ascii	"\023\373\274\207\263\325L8q$:\026@\b.\355\340\244\332`\242z!"
+	.ascii	"\037\350A2\337\005\376\211\243h\371>~\201\340w\251k\240\007\007"
+	.ascii	"\244W\343h\312\017\265S(\350oqwg,\327+\216Q\f\266\2349\347\210"
+	.ascii	"z\005\rnD\364]\276olH\311\206\275\347r\232\323V\342\023\335\304"
+	.ascii	"\213\357s\351\n0\372\333\245\017\363]~\t\364\354h\332\344\217"
+	.ascii	"\336\213\243\207\270\351\214vy\254\256\241$\233\342\260\366Z"
+	.ascii	"\034}\373\360\001(\240\212\253\305\002v\370\345r\225\240(p\275"
+	.ascii	"DT\022XRb\255\t\017d1XK\312/\021\0131\031\270\002\252\2002\026"
+	.ascii	"KJk\205\365\212\275\260D\n\030\326\002\306X2\030,\306J\205\264"
+	.ascii	"\357\016\212\204\220N\242\3261\306E\t\332\351\267\2736\266w\031"
+	.ascii	"\344\320\266\346\363\356\321[\332=\241}(?\344;-j\317\273\200"
+	.ascii	"\0315*\342C>\335\323Zkpj\332\344# @\002\302L\262\036X\263R\356"
+	.ascii	"\213\336\342\244\0316\214\367\241\303Z\262\020G\314N6\241 \265"
+	.ascii	"2\266\331)\025Y\357\202\005\205\035D.\n\007\3552\254\327n\372"
+	.ascii	"r\356\022\"\361?\r\2177\213\n\355\206(\026\217\214\b%\350C@("
+	.ascii	"BD\372\322\247\351J$\275VA\001"
+	.text
+	.section	.gnu.lto_telemetryCheckRxPortShared.54.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375`/\001\315\r"
+	.string	"\326\232_D"
+	.string	"\223\223\0160\367\210\207t\033\333B\313})\321G\350d\221KFz\022a\324\2073\030\021\305\003\266\177CzTu\213*H\203\231\256\020L\265\002\240R\r%\020\205\320\026\r*,z\334@\202\366\336R\246\024M"
+	.string	"F"
+	.string	"O"
+	.string	"\361\320\266\0318\030\231{w\342\364\324\253E\346f\267\313\324\304\271\303\247\311\371\244C\265\221I\351\230A\301\374\275\004$l\274tp\244zpP\246T\001(\226g`w\317z\272\240J\231!$\273\353\374\200\nq\307\333\246`;\202\375\016\001vGJ\215\261\377vw\255*[\323Q\323\360\253\3779\235\232~\210\004\232\033\037\bZ\273\247W\220\275\001i\244\260=\2629v\001\327\203L\373+\316b\364\225\312\007\354\252\\4\273\235\002/\300\016\335\275\023\017\261\023\b%\030`\006\246\3065XN*\236\306\300x\344\254\336K|\356.I-\022\241\236u\254\346\005\017S\272\354\356\"\361\n\325\331\"\242\224/\333)w\241\001\3335\215\370-6p\300P\034\372*\361\360\332\331\261Z\311\227\317\372\204\031 ~\330l\002\t\006}>#\026\032|@\236\016\206\222\013'\032\004\321\246\241"
+	.string	"0\310\343a\023\205LB\031B\242\354\244\244\202I\006\332R2\317\001k(\241-\023i\332\226q\272\375[U9\365\255\307\034#Z2\322\347\342Y\317\022\255\030\357\347b\252\213\355T\223\254h\026"
+	.ascii	";MMk\t\030\366\0064\253e\266\202\211F6\346q\200\003X\f\006\301"
+	.ascii	"eV\221\200\2504\342F\306\002\346n\302K\327@\305\262p\214P\256"
+	.ascii	"VWk\232\334\332\242\007"
+	.text
+	.section	.gnu.lto_telemetryCheckState.56.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375 \344\035\006"
+	.string	"\222\313*3Pm\222\0160\254s\240\302\254\233\365&\322\254\212 \001C\253\006/|F\277n\272\344\331"
+	.string	"\324401I\314\214&S\346"
+	.string	" \246\242\237&\330\266\311N\001_,\017Or\030\267\340\244\306\240\220\200i\227\347\320,\004G\r\3565)\212^\253X\305\334@ \327GD\"3'{\210\b\206\325\003\231\244\026\350x|H\312J\336\242X^<Bm{n>\021.\317\210A\247\25581\351E\371\330\370\361\261c\372\312\323\207\240\225Q\344hPp<m[b\340\204l\032\221\003\003*\r\205\f\340\240\355\254\322X\340\211\177\301\337\376\211\007"
+	.ascii	"i\3317\323\342\2523\370\205\373\3522\n\270\314\213v\222\001"
+	.text
+	.section	.gnu.lto_telemetryProcess.57.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"%\b"
+	.string	"\302\21798@o\323\001\200\0134\021\371\001X\377C\236\3514,\273\017\3745\323X\320\257V\0332\325\224\034a\273M\335*Z\200X\241\005\201\231\231\316#\323\017>i\235'm\357\224\002\3160\f\301\341"
+	.string	"\313.\016\325<\f\334\207\326\032\221Y\316\256P\345\250F\037(7?\236\006mf\0254\257\001o\020\264Nn\333\352\264\300=\265\222d\312%<\205\024Rd*\332!\211\370\317\035\221\364l\301\244lN\366\324\262\361\305\006\275(3\354S\273\273\226$[\202B\023\3135\262k\021\003\263(U\t\207\355[\366\306$\341\321\276\307?\272\203LX\263\213!B\262\013\026\330 \340U\347\234\314+\352\002\231W\356\354\225\203\033\373\222JE\311\264\273Sj\274{\354\374\207\\\363\215\274G"
+	.string	"\205\335u\374F\027\267\274m\002\333\013\266;\002\n"
+	.ascii	"x\232\225\226}2\246w\31708s,6\325e<k5\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_releaseSharedTelemetryPorts.58.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375`D\001\365\r"
+	.string	"\246\231]E"
+	.string	"\261&\035\343\344&\323\251\212\300\030\346c\326\223\377\364G\265\214/\013\377\334\207\372o!\034R]\262[\2331\035"
+	.string	"\323\304\261\b\026F\335}\372\277\323w\240\210\377>6\372\377!!)\034\252M4\331[\312\224\002H"
+	.string	"I"
+	.string	"G"
+	.string	"\366\315\277\230\375\314\206\013(l\354\256\246\032\f\323\364\b5M~\216H\321y\247G\330\241b\351"
+	.string	"\342\251\340\310\313Es\326S\305KI\370\241\345z\326!\b\0214:\257\345\331A\262\273\316\316\313pc\267\035\262]b?\025\2339\366wJ\205\261?\022\363rY_\354,~u\277\323\271\221a\201 \306.K\216\033[\023i<|\365\333?\313\037\002N$\270\314I\230\276B\371Z\300\320\351dpp\355~\004\036] {\364\367\020\3541{"
+	.string	"\354\321\246>\353_Y\271IPpw\027f&\376\022\267E\2316"
+	.string	"\201\221\345\325\236@\312w\026I\351\311"
+	.string	"Z/tf\205\312Sg\313\205\315\352W\027Ae\216c\376\0240\005\267\n\314>\251\220\357\242\336sQ\351\311\331ja\023\006}>\007B\006> OH\211\033\225\2046\316\304\001\311\303 \317\tW\332D\033\204\255\244Ex`\"\322@\034I\363\f\360H\302\306i\245\321\210\323>\276\275\276\230A\215\032\224\246D\205\361C\340\340\320L\323\005\247\225Q\257*F\301\256\013f\244\362\025\034"
+	.ascii	";MM\313\022\231\326tv^\272\212\255is\260\332\002\336:\330\001"
+	.ascii	"YS\264w\013\346^\330\370B\303\246\nvD\025#D9\210\262\345*0!\312"
+	.ascii	"\\\020\332D\252U\002wq\220*\225\310@Q6]\363\t"
+	.text
+	.section	.gnu.lto_telemetryDetermineEnabledState.part.0.67.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375`\375\001\375\020"
+	.string	"\266_pH\340\262(\035\312\032\"\310\372\260J\270\003\021Q\b\203\347\301~\nb\036(g`\314@r\317C\323\206bm\254\226\244\t\233w\264-q\2053\233\030\215\201a\376\215\305\222\272\007\177\020\f\201\371\243\344,\267\215\220-wJ\001X"
+	.string	"_"
+	.string	"Z"
+	.ascii	"\317\371\t\331ub\006\260\313\341\306\213\335\021\201ED\347J'"
+	.ascii	"u\347\346\tt\347\244\355\233\360iD\264`\333\247\021\231g\037"
+	.ascii	"od\336\301\306\313\255\307\356\350\235\323\017\237]\345\234\371"
+	.ascii	"$\033j\304\314\260\\\277s\0313\203\341r\300g\b\265\273\026e\270"
+	.ascii	"\271\333&\261-\332\222A>\265\036\234\036\3532\206X\305}V\374"
+	.ascii	"*0\336\\\350t\344\230\260\303\243\350\266\253}\257\234\307\n"
+	.ascii	"\203G\211\335\035\335\267\211\376\355;\036Y\024\257\023\233\333"
+	.ascii	"\2633D\255\3476\331\350\034\311\246\304~\212\243\230\225X\306"
+	.ascii	"\2259\325f\340\204\234\263\003\3219GpL\302\270\324\354\256\b"
+	.ascii	"IC\211\312\217\016/2J\273guW\251\177\241i\221A\366[\334\005\313"
+	.ascii	"\027\341\026(\037\003v\347\256\036\b\032\232\f\362w\376\n<4~"
+	.ascii	"V\372,~\333\245\004\362u\356\0064\td\235\352\301\376\\\265\261"
+	.ascii	"\247\206\244eH\372\335\001 \002j\2732A?\266\206\2131\342\267"
+	.ascii	"\257\020\375B\265\300H\230\001>1\371RT)\327\027\362J\245R`\222"
+	.ascii	"@\2652\221 \270P\302\324\311\003X\b\252\214\2742\305B\330\327"
+	.ascii	"\372R>\230\347BI\265\274U\370\362L\006\f\252|\241\007\003\301"
+	.ascii	"\320\033\331\226W\033\237DN\020\251:\225\202\355\251\013jh\332"
+	.ascii	"\022\200\307\307\317J OE\321T\365\267\227|V'UU\342\b& P\"\242"
+	.ascii	"(y\2368\340\216\240\025$4E\034\277\365\033-\262\354DC\200KA_"
+	.ascii	"\302dK\034\b\363\254\372\020d\254\341\224\033D\036w1\276\020"
+	.ascii	"\230\013\315\267U \331\332D\216\025_v\n3\236\004\b?'\366\032"
+	.ascii	">\320\254H\362q\301D0e\004\265x\300\361\240v\236\240\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\365\007"
+	.string	"$\013\357\001"
+	.string	""
+	.string	""
+	.string	"\002\303"
+	.string	"\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\204\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005<\f\0024\177\r\272\200\202\0025\177\016\005/\017\201\204\005=\0206\177\0218\177\022\0029\177\023\002:\177\024\360\372\2508\0057\0253\026\205\204\001"
+	.string	".pg_resetdata"
+	.string	""
+	.string	"\0051\027gistry"
+	.string	""
+	.string	"\001>\177\030\377\037"
+	.string	""
+	.string	"\200\200\200\001;\177\031?\177\032\302"
+	.string	"\177\033\301"
+	.string	"\177\034\300"
+	.string	"\177\035\003\002D\003\002\304\001\003\003"
+	.string	"\260\217\205\327"
+	.string	"\001\302\006\003\007\r\b\017d\003\t\022D\003\t\021\221\205\327\307\003\t\020\204\006"
+	.string	"\036"
+	.string	".\203\255\3061Y\227\200\201\r%\213p\363\020[\031\0065\375\234"
+	.string	"\\\252\302\004\300%"
+	.ascii	"\034>@\262\277to\004\213\313\237\234=d\314\256\370lWF\360-\320"
+	.ascii	"\004\320\003~\f\321\303\013\253\336I\243+\226\020ud\n\312\023"
+	.text
+	.section	.gnu.lto_.refs.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375 \033\331"
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\004"
+	.string	"\002\003"
+	.string	"\004\007"
+	.string	""
+	.string	"\005\f"
+	.string	"\002\f\002\004\002\013"
+	.text
+	.section	.gnu.lto_.decls.24767c63f7f5559c,"e",@progbits
+	.string	"(\265/\375`\241\037U\221"
+	.ascii	"j\354\2244S0\220\312I\007TR\271O\242\370\203\3523\254^\243\373"
+	.ascii	">cF\365\300\217\240\345gq}\027zr\336\251\312\247C"
+	.string	"Q\267\037>\2447T\023\232,\316(\3354\213\201\203aM\227\3068w\260\007\202PAT\201\024!\210\024+M\026\360\b\363\255\326\223-w\n\324\0029\003E\003F\266\n\323\215W\243G\257\340\377=\325Rm\243\223M\3257\354\332UM\343\035e\273X\263\256\262x\026\316\235\242\304gPkw]c\fs\215\215\025\273M\246\216\025!bPtU\347F\336\246\023\327\240\242F\307v\203\025\003:\ne(\267\257\256\2628\344c\335\003P\232nhF%\202\336p\030\003\003\204\036\345\201}\320\032\270\217\375d\327\021\ru\033\307\346=\347\251\231\233\315\005\207\214J\034|;\242w\363\362\354\210\336o\035\026\262E\275\266C=\373\306\256V\212\\5ls\260m\354j\335\344\237\236\030\234cO\215\316\320yZ\357\367\f\377\202\341_.\374\233\003\377\213-Z3\002#\271\224}\331\3319\240\252\031h0\322\350Q\330"
+	.string	"\346\304\2305\262+q\314,pgl\234Uc\345l\032\213\306\226\261f\354\233\245\263p\266\316\256v\316\266\335\272Y2G\2339#Q8m\232}\216]\260e\f]\031\2263V\306\344\230_M4f\317\237\331\347\230e6Q\243\3139\337\256\205\261b@7g lL6\007 \260sV\214\025\263\317\245\004^a\350rn\336v\371O\3309\353\305\252\201\260\221\263\026\224\017U\330`\375\300\313\271iT\302\307\315\332d\025"
+	.ascii	"\265 \032\r\277\251\340w\022\374\316\302\357)\374\2617\370\316"
+	.ascii	"/\026\fZ\027\005\211\324\333\227,\370O[\324\263h<p\240\266,\303"
+	.ascii	"\260\325b\267\330\325r\261fG\303\262\362\232s\363\347>\275\300"
+	.ascii	"v\326\350-\211^\220%\321\273\255\001\243V\013\207\26070\t#n\300"
+	.ascii	"\026\365^"
+	.string	"\002Va\213zv\212\r\263+\001\266\312\035\200\340\367\030\226\277rn\006\375\304y\022\307M\243\027\001\373\260\270\245\362\001\3322\004\367\200o\t\350\331<K@\357\215\205\354P\217\200\240\346\013TC\032\265_$nr*+\217\345\334\354\360\223\303\033\224\223F\337\264E=l\207z#\254[\317\337\034\240\261\375\366,\314o\363\337\307\261\347\374\315\302z\364o\247\337\3564\n\377\253\310\360\333\004\250X\245\337\036\035\204\210\377B\177\273(\241\366\336\337#\374\207\373\177\346\177\232\377q\377\347\376\313\375'\363\377\355\177\231\377j\376\233\371O\367\333\345\177/\377\267\374\017\372/\212\337z\375\026\354\267Q~\013\345\267R~;\005\314o\267~\373\344\2675|\371\377\363_\032\277\365\362\333\264\337:\177;\366[\261\337\256\277\r\373\355\216\337B\375\226\305o'\370\355\212\337\252\370\355\211\337\232\370-\002\277]\340\267$~\033\364\333"
+	.ascii	"~\353\341\277\002\277%\372m\207\337\n\375\267\373_\367\037\354"
+	.ascii	"\377\327\377\002\376\257\375\347\311\313\313\313\373\233\304"
+	.ascii	"\257\363\377C0S\320\304\241J\314\234u={L/\212\333\226\232\030"
+	.ascii	"\376\216\024\214.!\023R\027\246\327|\274A\261\301\004\177\247"
+	.ascii	"\013?\001+\223\367\245\275H\255\031\322\326\350w\202\340\357"
+	.ascii	"\354\300\337Q\342\357@\341\343\033\360\361\034\376[\213\223\331"
+	.ascii	"\0256\327\3503\310'\016\024\267 dp\b\354\005\037_\301\307`\370"
+	.ascii	"\230\211\033\260C\275\266\242d\352\013\n\026\026\253\222Vv\334"
+	.ascii	"Z\337U.\233\221%+\022\225\262dI\244\321\343)\374\246\035\352"
+	.ascii	"\021y5\233\315\345\304Tc\347\344r\231\263\273\243\303D\316\257"
+	.ascii	"\257\216\202I\310j\354\234\360\354\240\322cI\203\275\243\240"
+	.ascii	"nR\336\340\260\304X\275i3\006\023\275y5\024\257\346\302Fi)\206"
+	.ascii	"\244\225a\"4K\276\244\235\264\310R\350\306\244\224\205\325\360"
+	.ascii	"v\022\264T\003\363\244\321\263\351&=0wrYMh\310y\252\275\240e"
+	.ascii	"\325\f`L\355\252Q&Mc\200\271\244\031\023\013\275a\361N\262v\022"
+	.ascii	"+\206\036\303"
+	.string	"\262\025O\215f\233\253\3039E\007\211\207\300X\274\217\334\256}\244\273X\214\345|UB\215r\271@\017\331\221$[\032m$FA5fPF\331\341\367\326p\021\323\310\2154\027\316F4d\333\303LT\232F\271\236&\247\215\t\222+fX\250\214\305{k\355\255\306B\221a\371\212\247\253\271\306\211\227\363\227\005\320\252\034\274\214i\364\275\036\370?~4\021\005r\266\315,+e^*I\374g\363&\262\223d\211\220\251F\213\244Xt\217\366\361\006\3221\274\201\364\220\026\307\234\217\315lE\004\246Tc\207\227\227K\022<\317+=\246`x\017\321\362\311\031\304\317\023\035mI\032m\255\356 -\344\255\325Y>\310\326Bs~\262V\004\220\265\"r\322\216<Q\351\241\317Y\203\317\246u\374\337\3516#\253\225F\237\203\206\237\203\004\277\377^~R\346\234]\310if%\224O\357\267\2679\366\307^{@\276\277"
+	.string	"I\315|L\273\273\303K\316\236z<D~\316S\231\\\265\216,\264\256\220ZX\311U+\037\221H\216\035\224Y\353\230\\s\356\220\221\310\343\005Y\271Cr\315W\231F\333\225\315M\255cFf\345\016\031\231\237B$\221ZW\311\365\351\252Cr\325\272\312\253V\026\312\310'\245\rdVv\310\253V]^\263\256\204\222k\326Ur\325\342a\177$\343\302\\\241\335\t)b\257\222\310\\E\345\343I)\364L6\2632\\\316v,*+\017\310\331G\226\022\356\t\313:\241\236UPX\236\262l3\347\034"
+	.ascii	"\025\224\220\254\214|&\231d\345\314\004j)S=pl>s\021\373<\016"
+	.ascii	"\361\221\247\242r\026\200*\347\243\315\317\234\3631\347\254\243"
+	.ascii	"\364\321\314\231\207P\222IE\225\363\322\210*\3738j\211\312\271"
+	.ascii	"\307\342\234W\311UH\326\t-b+3\327h\036-3\303i)\361z\234\222\247"
+	.ascii	"\326`\346\025\016\273F\227\275\003\350\006)6^\356\226$\372\205"
+	.ascii	"\035d3h\347m\315\2171\271\316\321#SDK\034[\343h\3668\201\220"
+	.ascii	"\345\350\253Vf\345sI\243V\315[\332\316~\263|\251Z\343\312\313"
+	.ascii	"<\312\320\300\\\263v\363\001\022\003\0173\215\336\262F\236\214"
+	.ascii	"\231\257-\036>f6\210\2315\372\237(L\26456\326\025dW\305\245\310"
+	.ascii	"\032L\304DL\254\271~\221\031\b\022\346\016\030\036^e\3320\021"
+	.ascii	"\222\273\376\256\315e\303\262\225\265r|\363\201\227\363\222D"
+	.ascii	"O\031\2205\307.<\344\354\361\033\203]o\217\033v\223\313\354\302"
+	.ascii	"\2123\333\204b\202\327\350\024\235\251#Ro\032\275\217\026>\212"
+	.ascii	"\031.\222&gN\030\271[_r2\334\"h\350\240\334(W\312\375\272M\273"
+	.ascii	"^\260\333\365\316r\211\334(\357\202]\256F\332\347\026\213\257"
+	.ascii	"8:\260\313\274N\354s)\224\221Y\360~\202\324 \203\301\007\225"
+	.ascii	"\341s \240\222-\242\244\271Nn\222[\203}.\233\331\205\036\263"
+	.ascii	":)m\236\\/\273^'7j\346\022%\002\370qs\006/J\257\206&\316\033"
+	.ascii	"=j4zi\260\353\232\324\220\272%v\275Lj(\201\203\244\321\253\344"
+	.ascii	"s6\2167\244z\322\340\367\300\341\367\254\335#\270\f\335\0171"
+	.ascii	"i\370=Z\360{\260\340\367\254\370\277E\356\326\252v'f\313\212"
+	.ascii	"\265\033\333\024T\023w\266E\275\253u\207\004y9\211\224\t\351"
+	.ascii	"\300\310\230\262F\321 \2778\326\272\230TY@pH"
+	.string	"\310\246\300\220S\226w\267\243\321\013\004G\365(\031\301\363#\013\f=\032\375\005\362\337\250\373c\205<884z8\037=b\272\320I\331\201\207\272\260\260O\354\245\361\273\2744\356\216\026\313\214\003\201$>\026"
+	.ascii	"*C{C\365\363DG\332\r\215\336\034\367\205\213\365\357\354p\231"
+	.ascii	"r\363q\205\177u\360l\265\035\241\241\321\276.\374\342\370wt\276"
+	.ascii	"\224H\262)\374\253\274W\377\316\205\023\206\213\215F\337\203"
+	.ascii	"\304\277V-\310\005y\322\350\255\302Q<lF\354\304\205\315q5\372"
+	.ascii	"[\365\337\344\265q\251L\370\320S=\226j\032\275Rw\352\227\352"
+	.ascii	"\336\310\227\352\201\254\234\237.U\320\233\234\237\202\254\025"
+	.ascii	"a\255\b\324KH\327\225\036z\036:|:[\324\003\262C\275\033u\342"
+	.ascii	"\267\306\207z\312e3\007u\327\330\332Z\243?<N<\304\306\342\036"
+	.ascii	"\355\205Z/\324=\336d~\n\"\001\027\272/\013\240\312.\346\232/"
+	.ascii	"|{\217\275\377\036\177\263\317\2219\032;\032\315\263uUe<]\370"
+	.ascii	"\266\013\227<\272\267N\343\202\333\222\316\f\213\324"
+	.string	"W\331\024\363Jc\001!\2052R\b\025\323,\355M\030\225\036\263\242b\265\245\265\250\210R\356H\271%\321\032\353+N\227\006\323\245\r\335W\333Y<<1\335\006\002*\351b\231\206\356o8\215\327m\332M\277\351\272V\3238t\234\276\241sh6M\327w\275\306\256m\327no2]\346FMf\326XV\250\334h\273Vk6g\016t\235\305\256\317Z\013\b\250d~\322\222 \311\225\0224\274\234\233=<'\234'!\320\236\223\20332d\275C#\307#gc\013Z\334[\356'\007r\355J\243m\246\317\374\344\265\311[\317\300\335\033`wg\2156\277|\254\254\270\262\236\246C\013\024628';w\274\264\331\320\033\013J\301\244!\321\202 \"_\223\221\t)U\177@\242PHA\222\213\027MF&\003`\314H;@\032\006\223\214R!\322\360\267\004\200\032\034\006\205\276t\304\244\nM\f\300\244n"
+	.string	"\364\240~\351\250\311\211XT\362\025S\365\327d\002\201\324\3303L\352\034\243\317G\365\r\225\232r\206JM7]!hD\215\306\264\210\204\364\323)\252M\367?*\024UcP)}\3413BJ\207JA\341O\007)5:\241\251Q\347?\365\207T\364)5\035\001\025\177K@T\330\304\224\202\240\246\306\364\205R\223\001\252\317'XD*\252\037\020\300\364+f0\243\030d\364\371\210 \004\202\214\236\352\343I\221\210L\250\352\363\300\330D\324I\325\337\013\234\256\020\204\201U\\\364A\372\245-\204\301\037\b\3054)\311\251\202\031\252OQ\375 \225\021L\201\351\013\243\023\200\277\030B\341\317\202\031E\036cj\374\245\302\2648\200\321\230\002\211\305\017\220\322\031/N"
+	.string	"\246K\002|\351H)\230\2242\005\325\241\223\001F\245\2370\003\245_\217\312\224\252F\025`xP\203C\027?_:2\n\211EuH\004\372\200E\023\300$\020?\031A\025HA\212D\344"
+	.string	"X$:PH$V\340\313)\240\201#\265\370k:J\325\237\n\003)\025\306\370\r1H\207A\246b\252\246\027$p`\260\230\016S%\374\007R0\220B\305\f\235\253X\321\300\212\006zW\261\342\304\211\025)N\340\2478qS_\006D\252\317\001\024\251Oi\030,\376\226`\374\250_:2A\f~\370"
+	.string	"\200\352Kq\002\237`\374q0$\006U\340\320)\311'\365\271P\213\304\017\204\277`15z(\246\301\244\240:L\221\202<MF\246\031)\322\320E\252\376\212HN\277\030\276\031\304\030'"
+	.ascii	"\177\302\030\036\276$\342&T\"\261h\242\307\350S\n&\r\211\026"
+	.ascii	"tP\177B)\222\223\032T\032\0227\230\021\314\200\330\201\261I\251"
+	.ascii	"\303\022P\r\246`\024*\2462\206A\337\320\214T\330\344tA\222\360"
+	.ascii	"\327\302\030\224\3722\260\300\330\244A\221\372c*\022\223|\251"
+	.ascii	"\372\033\006\221\212D\"0\365\251\301a\b=jp\350\3043$\006\215"
+	.ascii	"A`Zl\"2\376\222d\370T8\301XL\372 \374\311(\246\352\320\005\322"
+	.ascii	"\320\211\b\203\251\370\023R\240\252\304%\017 \030)0\246N\302"
+	.ascii	"\237\bH\301&\"\325\247B\035\006\235t\016\214\021#\005\322\003"
+	.ascii	"1\200GE\217 \002\013B\204\320\201\006\030x\244BQM\231Ra\252\232"
+	.ascii	"\030\006\177L&\200E\243\211\243\020\251\322O\025\022e\370\204"
+	.ascii	"\302\024\350S\213\304\246\2648T\006\213,\315S\252\321\242&w\314"
+	.ascii	"%s\307\\\267\235c\317N\r\026\032^^\346\270nm"
+	.string	":2\224\241\305\265\331Pf\255\203\322H\274x\310\331\360\264m:i+\221\272:,&\215\003 \3165lN\267\037p;\302\020\251\300n*\2065.\224l\307\226\220\253\326\005\207\003\313\r0;v\330\344@\206\243Q\"+/^\230nh([\226\226\033a\360\020\234-[n\232\021\227+\2718@G4RC.\332o\032z\206\206\r\034\227\313[\234\233'\0273\035\032m\324V\030\360\020\231+W\256\323(\353X'\301\223\246\033\232\365z\343\372q\261\374:\357\031\032T\202z\2502\0011\t\303L!S#$\"\232&\351\222\n\020\206\204i\232\310\316\007\022`45\021J\311\f\315H\nJ\n\312H\246\003\243\007\254\364\231!X\361?\030\032V\377L\361]\241\210>h\377\333\214\310o \214\265H;GLzjH\323\003\233<L5\312h\2133e\032\355\346\355[L\352V\236D\225\237\034\226\300\275"
+	.string	")\340\270h#\3042%\200"
+	.string	"\177Gf\b\321Cr\214\262\013\235\366M\350\274\277"
+	.ascii	"u-\007\"74\370\264Qr\016&\200\177\256\bP\360\214\223\026\017"
+	.ascii	"}\357\221"
+	.string	"\235\356\220\322\340\341\202\321\270\350\323k\376$L7\221r\201\b\2361\320\036\233(z\331\353\263\241\b\353P!\201+M\230\264\231\305q\203\016\376\211rv\243\260\346QN\210\350V\005\212\326\020\337n\215\305\327\330\222\024}8\2256\302\270pCB\250\033\\k\214Sh\254\311\3131t<<C\322\2577\316!\025[\035\345\304\\\214\261E0\365\245\354W\020\264%\273w!\202\260\"\364\310c\253\372\223\217\357\342\"v\364\013\277\243\220\355\206x\325}T\353\241\2356\313\017#\344\252\324\235\321\003>\264`\307P\3479\231\345Im2T\n\257\334S0\246\314^\361@\334<\352\234\007z&k\353\205\315j\376\205\3628 \260\330\003>&\3775\030\001\272=/Q3Z\267\016+\217\225\320\227\316\201]\215\364&xk\203\260V\225e\335\221\216s\233\202S\357\257\241Y\253\036\006\253\022\241\253R\337/\271<\374\017"
+	.string	"_\354>}\222)J5\220\267\3036\263\020\254\364\037R\252\025\256\331\037\307\215\345\247\235TW\301-7\207\324\277W\243\341\264\335\017<p\343|\207\234\343\253\372\026FwSiA:,\035\274\227\223>\303^\252+N\243\315D\253\332\212R#_\353f7\334\254\372\250\305\005\026\306\017\320\231"
+	.string	"\356\033\334\254z\332\342\031}]b\227\020\t*r\240+\347\315\261p\271pbLfS\301\274\262\214\3604\371\313!\321\305\205l-;\302\020\024C\202\001\242It\302\306\f\251d\312\006I\343\006\036\330\206\036^\206\330\357Y\237\246*\331\324\003\037\004\200\242\242\274"
+	.ascii	"\324f\376A\303\306\253LT\025\302\306\036\262\254\302'B\272\005"
+	.ascii	"Np\223\353\256a7y"
+	.string	"\341J%\267<@]\205\246Y\232\332d\200>\321\223a;:\220\362&\263\212\361\371\337\202\204\313g:\020H\004\272\206\273)\335Aj\254]\nj\002\221!\003\202\352\356\376\213\310\"s\276\213\360\363\344\023\tr\341,3\235:\376\f\243Oys\374\016\276\250aH~j\204\006D\310\310\311\351\027\306\b\233\351O-\232\212\033\264F\341\233\347\241\315\340\374\330n2p\252q,\244B\362C\035B\016\253\364\326\3307\254\303r\214\026\353\027,\016\373$\221~D\r\004\220\003^:\270\212=\354\233\334K\177\231\344\021q\230\027"
+	.string	"\216d_\267~\331\355D\3429lB\257\270\323-c\336;>\372\233\030\305e\316\265\021\252FQ\276s6\212j\022\203`Q|\344\013\2534\251\202\020>\225\026\035\231ZN\321i\365\365?>NGEV\245-\205"
+	.string	"\232\306\242\344\361\257;\375\321?\336E\237):\233h\241\244\324\b-\217\304M\336;\204\277\212\036}5\0366\342\264\215c\371Z\212E\320I682c&\327\024\bE\001r[\346\366j\334F\345\270.P_\216\r\003\025\243A"
+	.string	"<\250\246\026\346\303\261\310\260\232J\246\342\334\230\271U\2209\251\253\360K\320<q\316^Z\223\036lEs2\377"
+	.ascii	"\356*\222\274\347z\222T\262H\004\357\236\303\265\226xh\236\367"
+	.ascii	"\271\315\3113\020"
+	.string	"\215;v\035rI\241\b9\036R[\033\326\240\271i=;\320&\203FD\235\304\202;[\246Re\035Yz\027\201\351\213%1\365\310DK(\312\324\251<\274\3238\337\211\255d\332\332\363\337K\032Uy%b\016\360qT\217\302\253wGO\370P\352\3461\035\333'\253\342\023\022H\207\337\224\200\213\017\032\004?z\362\rC\267\021\003S\352\201DK\230\365CT\347\222\221\332\270\341\367\206\032\340\206\305.\002\260\r\341X\001t\237\276\252\301;\304xQ\024lw\247\034\247\217)\272vV\375\312\022\036\250\265\334\"c\275q4\263(\225<\366\310\355`\005\030F\340\\$\367\r\377l\353\226\225\327\236\bT\240h\215\330\354\211)\215)L;s\333\363\340M\316\305\260\037\357\325\372Y\321\247\214{\227\277\335\276\336\333:\234\373_>o\235(\027\017\270\365\303\266Ex\215h\212m\213~\214\260Bza\210\037\350\r"
+	.ascii	"#\340)<\317\242\177\376&\206\305\233\357\226hU\370\013\356\212"
+	.ascii	"O\253}\331>\365d\253\230<\244\025"
+	.text
+	.section	.gnu.lto_.symtab.24767c63f7f5559c,"e",@progbits
+	.string	"telemetryInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"telemetryDetermineEnabledState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\004"
+	.string	""
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"telemetryCheckRxPortShared"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"releaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"telemetrySharedPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"pgResetTemplate_telemetryConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"telemetryConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"checkLtmTelemetryState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"initLtmTelemetry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"handleLtmTelemetry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"findNextSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.24767c63f7f5559c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-Ofast' '-ffunction-sections' '-fdata-sections' '-fcommon' '-flto' '-fuse-linker-plugin' '-ffast-math' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
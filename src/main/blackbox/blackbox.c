@@ -1245,6 +1245,7 @@ static bool blackboxWriteSysinfo()
         BLACKBOX_PRINT_HEADER_LINE("rates", "%d,%d,%d",                      currentControlRateProfile->rates[ROLL],
                                                                           currentControlRateProfile->rates[PITCH],
                                                                           currentControlRateProfile->rates[YAW]);
+        BLACKBOX_PRINT_HEADER_LINE("rates_type", "%d",                       currentControlRateProfile->ratesType);
         BLACKBOX_PRINT_HEADER_LINE("rollPID", "%d,%d,%d",                    currentPidProfile->P8[ROLL],
                                                                           currentPidProfile->I8[ROLL],
                                                                           currentPidProfile->D8[ROLL]);
@@ -1302,6 +1303,11 @@ static bool blackboxWriteSysinfo()
                                                                           gyroConfig()->gyro_soft_notch_hz_2);
         BLACKBOX_PRINT_HEADER_LINE("gyro_notch_cutoff", "%d,%d",             gyroConfig()->gyro_soft_notch_cutoff_1,
                                                                           gyroConfig()->gyro_soft_notch_cutoff_2);
+#ifdef USE_GYRO_DATA_ANALYSE
+        BLACKBOX_PRINT_HEADER_LINE("gyro_dyn_notch", "%d,%d,%d",             gyroConfig()->gyro_dyn_notch,
+                                                                          gyroConfig()->gyro_dyn_notch_q,
+                                                                          gyroConfig()->gyro_dyn_notch_min_hz);
+#endif
         BLACKBOX_PRINT_HEADER_LINE("acc_lpf_hz", "%d",                  (int)(accelerometerConfig()->acc_lpf_hz * 100.0f));
         BLACKBOX_PRINT_HEADER_LINE("acc_hardware", "%d",                     accelerometerConfig()->acc_hardware);
         BLACKBOX_PRINT_HEADER_LINE("baro_hardware", "%d",                    barometerConfig()->baro_hardware);
@@ -1309,6 +1315,8 @@ static bool blackboxWriteSysinfo()
         BLACKBOX_PRINT_HEADER_LINE("gyro_cal_on_first_arm", "%d",            armingConfig()->gyro_cal_on_first_arm);
         BLACKBOX_PRINT_HEADER_LINE("rc_interp", "%d",                        rxConfig()->rcInterpolation);
         BLACKBOX_PRINT_HEADER_LINE("rc_interp_int", "%d",                    rxConfig()->rcInterpolationInterval);
+        BLACKBOX_PRINT_HEADER_LINE("rc_smoothing_filter", "%d",              rxConfig()->rcSmoothingFilterType);
+        BLACKBOX_PRINT_HEADER_LINE("rc_smoothing_hz", "%d",                  rxConfig()->rcSmoothingCutoffHz);
         BLACKBOX_PRINT_HEADER_LINE("airmode_activate_throttle", "%d",        rxConfig()->airModeActivateThreshold);
         BLACKBOX_PRINT_HEADER_LINE("serialrx_provider", "%d",                rxConfig()->serialrx_provider);
         BLACKBOX_PRINT_HEADER_LINE("use_unsynced_pwm", "%d",                 motorConfig()->dev.useUnsyncedPwm);
@@ -22,6 +22,8 @@
 #include "config/parameter_group.h"
 #include "config/parameter_group_ids.h"
 
+#include "drivers/system.h"
+
 #include "fc/config.h"
 #include "fc/rc_controls.h"
 
@@ -35,6 +37,17 @@
 
 #define BLACKBOX_SERIAL_PORT_MODE MODE_TX
 
+/*
+ * Encoded bytes are collected in this buffer and handed to the device in one write per logging iteration (or when it
+ * fills up), rather than going through the device's single byte write for every byte.
+ */
+#define BLACKBOX_WRITE_BUFFER_SIZE 128
+
+static uint8_t blackboxWriteBuffer[BLACKBOX_WRITE_BUFFER_SIZE];
+static int blackboxWriteBufferCount;
+
+typedef void blackboxDeviceWriteFn(const uint8_t *data, int length);
+
 // How many bytes can we transmit per loop iteration when writing headers?
 static uint8_t blackboxMaxHeaderBytesPerIteration;
 
@@ -44,6 +57,11 @@ int32_t blackboxHeaderBudget;
 static serialPort_t *blackboxPort = NULL;
 static portSharing_e blackboxPortSharing;
 
+#ifdef USE_FLASHFS_LOG_INDEX
+// When the log being written to the flash began, its duration is recorded in the log index
+static uint32_t blackboxFlashLogStartMs;
+#endif
+
 #ifdef USE_SDCARD
 
 static struct {
@@ -75,24 +93,81 @@ void blackboxOpen()
     }
 }
 
-void blackboxWrite(uint8_t value)
+static void blackboxSerialWrite(const uint8_t *data, int length)
 {
-    switch (blackboxConfig()->device) {
+    serialWriteBuf(blackboxPort, data, length);
+}
+
 #ifdef USE_FLASHFS
-        case BLACKBOX_DEVICE_FLASH:
-            flashfsWriteByte(value); // Write byte asynchronously
-        break;
+static void blackboxFlashWrite(const uint8_t *data, int length)
+{
+    flashfsWrite(data, length, false); // Write asynchronously
+}
 #endif
+
 #ifdef USE_SDCARD
-        case BLACKBOX_DEVICE_SDCARD:
-            afatfs_fputc(blackboxSDCard.logFile, value);
-        break;
+static void blackboxSDCardWrite(const uint8_t *data, int length)
+{
+    afatfs_fwrite(blackboxSDCard.logFile, data, length); // Ignore failures due to buffers filling up
+}
 #endif
-        case BLACKBOX_DEVICE_SERIAL:
-        default:
-            serialWrite(blackboxPort, value);
-        break;
+
+static void blackboxNullWrite(const uint8_t *data, int length)
+{
+    UNUSED(data);
+    UNUSED(length);
+}
+
+// resolved by blackboxDeviceOpen()
+static blackboxDeviceWriteFn *blackboxDeviceWrite = blackboxNullWrite;
+
+/**
+ * Hand everything written so far to the device.
+ */
+static void blackboxWriteBufferFlush(void)
+{
+    if (blackboxWriteBufferCount > 0) {
+        blackboxDeviceWrite(blackboxWriteBuffer, blackboxWriteBufferCount);
+        blackboxWriteBufferCount = 0;
+    }
+}
+
+/**
+ * Returns a pointer to room for at least `bytes` bytes in the write buffer, the encoder writes there directly and
+ * passes its final write position to blackboxWriteBufferCommit().
+ */
+static uint8_t *blackboxWriteBufferClaim(int bytes)
+{
+    if (blackboxWriteBufferCount + bytes > BLACKBOX_WRITE_BUFFER_SIZE) {
+        blackboxWriteBufferFlush();
+    }
+    return &blackboxWriteBuffer[blackboxWriteBufferCount];
+}
+
+static void blackboxWriteBufferCommit(const uint8_t *end)
+{
+    blackboxWriteBufferCount = end - blackboxWriteBuffer;
+}
+
+void blackboxWrite(uint8_t value)
+{
+    if (blackboxWriteBufferCount == BLACKBOX_WRITE_BUFFER_SIZE) {
+        blackboxWriteBufferFlush();
+    }
+    blackboxWriteBuffer[blackboxWriteBufferCount++] = value;
+}
+
+static void blackboxWriteBytes(const uint8_t *data, int length)
+{
+    if (length > BLACKBOX_WRITE_BUFFER_SIZE - blackboxWriteBufferCount) {
+        blackboxWriteBufferFlush();
+        if (length > BLACKBOX_WRITE_BUFFER_SIZE) {
+            blackboxDeviceWrite(data, length);
+            return;
+        }
     }
+    memcpy(&blackboxWriteBuffer[blackboxWriteBufferCount], data, length);
+    blackboxWriteBufferCount += length;
 }
 
 static void _putc(void *p, char c)
@@ -148,36 +223,9 @@ void blackboxPrintfHeaderLine(const char *name, const char *fmt, ...)
 // Print the null-terminated string 's' to the blackbox device and return the number of bytes written
 int blackboxPrint(const char *s)
 {
-    int length;
-    const uint8_t *pos;
+    const int length = strlen(s);
 
-    switch (blackboxConfig()->device) {
-
-#ifdef USE_FLASHFS
-        case BLACKBOX_DEVICE_FLASH:
-            length = strlen(s);
-            flashfsWrite((const uint8_t*) s, length, false); // Write asynchronously
-        break;
-#endif
-
-#ifdef USE_SDCARD
-        case BLACKBOX_DEVICE_SDCARD:
-            length = strlen(s);
-            afatfs_fwrite(blackboxSDCard.logFile, (const uint8_t*) s, length); // Ignore failures due to buffers filling up
-        break;
-#endif
-
-        case BLACKBOX_DEVICE_SERIAL:
-        default:
-            pos = (uint8_t*) s;
-            while (*pos) {
-                serialWrite(blackboxPort, *pos);
-                pos++;
-            }
-
-            length = pos - (uint8_t*) s;
-        break;
-    }
+    blackboxWriteBytes((const uint8_t*) s, length);
 
     return length;
 }
@@ -187,12 +235,16 @@ int blackboxPrint(const char *s)
  */
 void blackboxWriteUnsignedVB(uint32_t value)
 {
+    uint8_t *pos = blackboxWriteBufferClaim(5);
+
     //While this isn't the final byte (we can only write 7 bits at a time)
     while (value > 127) {
-        blackboxWrite((uint8_t) (value | 0x80)); // Set the high bit to mean "more bytes follow"
+        *pos++ = (uint8_t) (value | 0x80); // Set the high bit to mean "more bytes follow"
         value >>= 7;
     }
-    blackboxWrite(value);
+    *pos++ = value;
+
+    blackboxWriteBufferCommit(pos);
 }
 
 /**
@@ -220,8 +272,12 @@ void blackboxWriteSigned16VBArray(int16_t *array, int count)
 
 void blackboxWriteS16(int16_t value)
 {
-    blackboxWrite(value & 0xFF);
-    blackboxWrite((value >> 8) & 0xFF);
+    uint8_t *pos = blackboxWriteBufferClaim(2);
+
+    *pos++ = value & 0xFF;
+    *pos++ = (value >> 8) & 0xFF;
+
+    blackboxWriteBufferCommit(pos);
 }
 
 /**
@@ -278,18 +334,21 @@ void blackboxWriteTag2_3S32(int32_t *values) {
         }
     }
 
+    // selector byte and up to 4 bytes per field
+    uint8_t *pos = blackboxWriteBufferClaim(1 + NUM_FIELDS * 4);
+
     switch (selector) {
         case BITS_2:
-            blackboxWrite((selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03));
+            *pos++ = (selector << 6) | ((values[0] & 0x03) << 4) | ((values[1] & 0x03) << 2) | (values[2] & 0x03);
         break;
         case BITS_4:
-            blackboxWrite((selector << 6) | (values[0] & 0x0F));
-            blackboxWrite((values[1] << 4) | (values[2] & 0x0F));
+            *pos++ = (selector << 6) | (values[0] & 0x0F);
+            *pos++ = (values[1] << 4) | (values[2] & 0x0F);
         break;
         case BITS_6:
-            blackboxWrite((selector << 6) | (values[0] & 0x3F));
-            blackboxWrite((uint8_t)values[1]);
-            blackboxWrite((uint8_t)values[2]);
+            *pos++ = (selector << 6) | (values[0] & 0x3F);
+            *pos++ = (uint8_t)values[1];
+            *pos++ = (uint8_t)values[2];
         break;
         case BITS_32:
             /*
@@ -319,33 +378,35 @@ void blackboxWriteTag2_3S32(int32_t *values) {
             }
 
             //Write the selectors
-            blackboxWrite((selector << 6) | selector2);
+            *pos++ = (selector << 6) | selector2;
 
             //And now the values according to the selectors we picked for them
             for (x = 0; x < NUM_FIELDS; x++, selector2 >>= 2) {
                 switch (selector2 & 0x03) {
                     case BYTES_1:
-                        blackboxWrite(values[x]);
+                        *pos++ = values[x];
                     break;
                     case BYTES_2:
-                        blackboxWrite(values[x]);
-                        blackboxWrite(values[x] >> 8);
+                        *pos++ = values[x];
+                        *pos++ = values[x] >> 8;
                     break;
                     case BYTES_3:
-                        blackboxWrite(values[x]);
-                        blackboxWrite(values[x] >> 8);
-                        blackboxWrite(values[x] >> 16);
+                        *pos++ = values[x];
+                        *pos++ = values[x] >> 8;
+                        *pos++ = values[x] >> 16;
                     break;
                     case BYTES_4:
-                        blackboxWrite(values[x]);
-                        blackboxWrite(values[x] >> 8);
-                        blackboxWrite(values[x] >> 16);
-                        blackboxWrite(values[x] >> 24);
+                        *pos++ = values[x];
+                        *pos++ = values[x] >> 8;
+                        *pos++ = values[x] >> 16;
+                        *pos++ = values[x] >> 24;
                     break;
                 }
             }
         break;
     }
+
+    blackboxWriteBufferCommit(pos);
 }
 
 /**
@@ -381,7 +442,10 @@ void blackboxWriteTag8_4S16(int32_t *values) {
         }
     }
 
-    blackboxWrite(selector);
+    // selector byte and up to 2 bytes per field
+    uint8_t *pos = blackboxWriteBufferClaim(1 + 4 * 2);
+
+    *pos++ = selector;
 
     nibbleIndex = 0;
     buffer = 0;
@@ -396,16 +460,16 @@ void blackboxWriteTag8_4S16(int32_t *values) {
                     buffer = values[x] << 4;
                     nibbleIndex = 1;
                 } else {
-                    blackboxWrite(buffer | (values[x] & 0x0F));
+                    *pos++ = buffer | (values[x] & 0x0F);
                     nibbleIndex = 0;
                 }
             break;
             case FIELD_8BIT:
                 if (nibbleIndex == 0) {
-                    blackboxWrite(values[x]);
+                    *pos++ = values[x];
                 } else {
                     //Write the high bits of the value first (mask to avoid sign extension)
-                    blackboxWrite(buffer | ((values[x] >> 4) & 0x0F));
+                    *pos++ = buffer | ((values[x] >> 4) & 0x0F);
                     //Now put the leftover low bits into the top of the next buffer entry
                     buffer = values[x] << 4;
                 }
@@ -413,13 +477,13 @@ void blackboxWriteTag8_4S16(int32_t *values) {
             case FIELD_16BIT:
                 if (nibbleIndex == 0) {
                     //Write high byte first
-                    blackboxWrite(values[x] >> 8);
-                    blackboxWrite(values[x]);
+                    *pos++ = values[x] >> 8;
+                    *pos++ = values[x];
                 } else {
                     //First write the highest 4 bits
-                    blackboxWrite(buffer | ((values[x] >> 12) & 0x0F));
+                    *pos++ = buffer | ((values[x] >> 12) & 0x0F);
                     // Then the middle 8
-                    blackboxWrite(values[x] >> 4);
+                    *pos++ = values[x] >> 4;
                     //Only the smallest 4 bits are still left to write
                     buffer = values[x] << 4;
                 }
@@ -428,8 +492,10 @@ void blackboxWriteTag8_4S16(int32_t *values) {
     }
     //Anything left over to write?
     if (nibbleIndex == 1) {
-        blackboxWrite(buffer);
+        *pos++ = buffer;
     }
+
+    blackboxWriteBufferCommit(pos);
 }
 
 /**
@@ -474,10 +540,14 @@ void blackboxWriteTag8_8SVB(int32_t *values, int valueCount)
 /** Write unsigned integer **/
 void blackboxWriteU32(int32_t value)
 {
-    blackboxWrite(value & 0xFF);
-    blackboxWrite((value >> 8) & 0xFF);
-    blackboxWrite((value >> 16) & 0xFF);
-    blackboxWrite((value >> 24) & 0xFF);
+    uint8_t *pos = blackboxWriteBufferClaim(4);
+
+    *pos++ = value & 0xFF;
+    *pos++ = (value >> 8) & 0xFF;
+    *pos++ = (value >> 16) & 0xFF;
+    *pos++ = (value >> 24) & 0xFF;
+
+    blackboxWriteBufferCommit(pos);
 }
 
 /** Write float value in the integer form **/
@@ -493,20 +563,13 @@ void blackboxWriteFloat(float value)
  */
 void blackboxDeviceFlush(void)
 {
-    switch (blackboxConfig()->device) {
-#ifdef USE_FLASHFS
-        /*
-         * This is our only output device which requires us to call flush() in order for it to write anything. The other
-         * devices will progressively write in the background without Blackbox calling anything.
-         */
-        case BLACKBOX_DEVICE_FLASH:
-            flashfsFlushAsync();
-        break;
-#endif
+    blackboxWriteBufferFlush();
 
-        default:
-            ;
-    }
+    /*
+     * Flash is our only output device which requires flushing in order for it to write anything, that is done a page
+     * at a time by flashfsUpdate() from the scheduler so that logging never waits for the flash here.
+     * The other devices will progressively write in the background without Blackbox calling anything.
+     */
 }
 
 /**
@@ -516,6 +579,8 @@ void blackboxDeviceFlush(void)
  */
 bool blackboxDeviceFlushForce(void)
 {
+    blackboxWriteBufferFlush();
+
     switch (blackboxConfig()->device) {
         case BLACKBOX_DEVICE_SERIAL:
             // Nothing to speed up flushing on serial, as serial is continuously being drained out of its buffer
@@ -544,6 +609,9 @@ bool blackboxDeviceFlushForce(void)
  */
 bool blackboxDeviceOpen(void)
 {
+    blackboxWriteBufferCount = 0;
+    blackboxDeviceWrite = blackboxNullWrite;
+
     switch (blackboxConfig()->device) {
         case BLACKBOX_DEVICE_SERIAL:
             {
@@ -583,7 +651,12 @@ bool blackboxDeviceOpen(void)
                  */
                 blackboxMaxHeaderBytesPerIteration = constrain((targetPidLooptime * 3) / 500, 1, BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION);
 
-                return blackboxPort != NULL;
+                if (!blackboxPort) {
+                    return false;
+                }
+                blackboxDeviceWrite = blackboxSerialWrite;
+
+                return true;
             }
             break;
 #ifdef USE_FLASHFS
@@ -591,8 +664,15 @@ bool blackboxDeviceOpen(void)
             if (flashfsGetSize() == 0 || isBlackboxDeviceFull()) {
                 return false;
             }
+#ifdef USE_FLASHFS_LOG_INDEX
+            // There has to be room in the index for the log, otherwise the oldest logs need erasing first
+            if (flashfsLogIndexIsFull()) {
+                return false;
+            }
+#endif
 
             blackboxMaxHeaderBytesPerIteration = BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION;
+            blackboxDeviceWrite = blackboxFlashWrite;
 
             return true;
         break;
@@ -604,6 +684,7 @@ bool blackboxDeviceOpen(void)
             }
 
             blackboxMaxHeaderBytesPerIteration = BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION;
+            blackboxDeviceWrite = blackboxSDCardWrite;
 
             return true;
         break;
@@ -653,6 +734,9 @@ bool isBlackboxErased(void)
  */
 void blackboxDeviceClose(void)
 {
+    blackboxWriteBufferCount = 0;
+    blackboxDeviceWrite = blackboxNullWrite;
+
     switch (blackboxConfig()->device) {
         case BLACKBOX_DEVICE_SERIAL:
             // Since the serial port could be shared with other processes, we have to give it back here
@@ -801,6 +885,14 @@ bool blackboxDeviceBeginLog(void)
 #ifdef USE_SDCARD
         case BLACKBOX_DEVICE_SDCARD:
             return blackboxSDCardBeginLog();
+#endif
+#ifdef USE_FLASHFS_LOG_INDEX
+        case BLACKBOX_DEVICE_FLASH:
+            if (flashfsLogBegin()) {
+                blackboxFlashLogStartMs = millis();
+                return true;
+            }
+            return false;
 #endif
         default:
             return true;
@@ -821,6 +913,8 @@ bool blackboxDeviceEndLog(bool retainLog)
     (void) retainLog;
 #endif
 
+    blackboxWriteBufferFlush();
+
     switch (blackboxConfig()->device) {
 #ifdef USE_SDCARD
         case BLACKBOX_DEVICE_SDCARD:
@@ -835,6 +929,11 @@ bool blackboxDeviceEndLog(bool retainLog)
                 return true;
             }
             return false;
+#endif
+#ifdef USE_FLASHFS_LOG_INDEX
+        case BLACKBOX_DEVICE_FLASH:
+            flashfsLogEnd(millis() - blackboxFlashLogStartMs);
+            return true;
 #endif
         default:
             return true;
@@ -843,6 +942,8 @@ bool blackboxDeviceEndLog(bool retainLog)
 
 bool isBlackboxDeviceFull(void)
 {
+    blackboxWriteBufferFlush();
+
     switch (blackboxConfig()->device) {
         case BLACKBOX_DEVICE_SERIAL:
             return false;
@@ -870,6 +971,8 @@ void blackboxReplenishHeaderBudget()
 {
     int32_t freeSpace;
 
+    blackboxWriteBufferFlush();
+
     switch (blackboxConfig()->device) {
         case BLACKBOX_DEVICE_SERIAL:
             freeSpace = serialTxBytesFree(blackboxPort);
@@ -911,6 +1014,9 @@ void blackboxReplenishHeaderBudget()
  */
 blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
 {
+    // the budget is measured against the device buffers, so they must hold everything written so far
+    blackboxWriteBufferFlush();
+
     if (bytes <= blackboxHeaderBudget) {
         return BLACKBOX_RESERVE_SUCCESS;
     }
@@ -64,5 +64,9 @@ typedef enum {
     DEBUG_STACK,
     DEBUG_ESC_SENSOR_RPM,
     DEBUG_ESC_SENSOR_TMP,
+    DEBUG_FFT,
+    DEBUG_DYN_NOTCH,
+    DEBUG_GYRO_TO_MOTOR,
+    DEBUG_DSHOT_RPM_TELEMETRY,
     DEBUG_COUNT
 } debugType_e;
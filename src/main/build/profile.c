@@ -0,0 +1,84 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#if defined(UNIT_TEST) || defined(SIMULATOR_BUILD)
+#include <time.h>
+#endif
+
+#include "build/profile.h"
+
+#ifdef USE_PROFILE
+profileProbe_t profileProbes[PROFILE_PROBE_COUNT];
+
+static const char * const profileProbeNames[PROFILE_TASK_FIRST] = {
+    "gyroUpdate",
+    "pidController",
+    "mixTable",
+    "handleBlackbox",
+    "checkFunc",
+    "scheduler",
+};
+#endif
+
+#if defined(UNIT_TEST) || defined(SIMULATOR_BUILD)
+profileTicks_t profileTicks(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (profileTicks_t)((uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+#endif
+
+void profileInit(void)
+{
+#if !defined(UNIT_TEST) && !defined(SIMULATOR_BUILD)
+    // enable the DWT cycle counter, the F7 requires the DWT registers to be unlocked first
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#ifdef STM32F7
+    DWT->LAR = 0xC5ACCE55;
+#endif
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    profileReset();
+}
+
+void profileReset(void)
+{
+#ifdef USE_PROFILE
+    memset(profileProbes, 0, sizeof(profileProbes));
+#endif
+}
+
+// Names of the fixed probes, NULL for task probes which are named after the task
+const char *profileProbeName(profileProbe_e probe)
+{
+#ifdef USE_PROFILE
+    if (probe < PROFILE_TASK_FIRST) {
+        return profileProbeNames[probe];
+    }
+#else
+    (void)probe;
+#endif
+    return NULL;
+}
@@ -0,0 +1,102 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "scheduler/scheduler.h"
+
+/*
+ * Low overhead execution time probes.
+ *
+ * On the MCU ticks are cycles of the Cortex-M DWT cycle counter, reading it is a single load.
+ * Host builds (unit tests and SITL) count nanoseconds from clock_gettime(), so benchmarks and
+ * firmware share the same probe code.
+ *
+ * profileTicks() is always available. With USE_PROFILE defined the probes also aggregate
+ * count, total and maximum per probe for the CLI `perf` command.
+ */
+
+typedef uint32_t profileTicks_t;
+
+typedef enum {
+    PROFILE_GYRO_UPDATE = 0,
+    PROFILE_PID_CONTROLLER,
+    PROFILE_MIX_TABLE,
+    PROFILE_HANDLE_BLACKBOX,
+    PROFILE_CHECK_FUNC,         // event task check functions that signalled
+    PROFILE_SCHEDULER,          // scheduler() excluding the task it runs
+    PROFILE_TASK_FIRST,
+    PROFILE_PROBE_COUNT = PROFILE_TASK_FIRST + TASK_COUNT
+} profileProbe_e;
+
+#define PROFILE_TASK(taskId) ((profileProbe_e)(PROFILE_TASK_FIRST + (taskId)))
+
+typedef struct profileProbe_s {
+    uint32_t count;
+    profileTicks_t maxTicks;
+    uint64_t totalTicks;
+} profileProbe_t;
+
+#if defined(UNIT_TEST) || defined(SIMULATOR_BUILD)
+#define PROFILE_TICKS_PER_US    1000
+profileTicks_t profileTicks(void);
+#else
+#if defined(STM32F1) && !defined(DWT)
+// The F1 CMSIS predates the DWT definitions, the cycle counter is the second register of the unit
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} profileDwt_t;
+#define DWT                     ((profileDwt_t *)0xE0001000)
+#define DWT_CTRL_CYCCNTENA_Msk  (1UL << 0)
+#endif
+
+#define PROFILE_TICKS_PER_US    (SystemCoreClock / 1000000)
+static inline profileTicks_t profileTicks(void) { return DWT->CYCCNT; }
+#endif
+
+#ifdef USE_PROFILE
+extern profileProbe_t profileProbes[PROFILE_PROBE_COUNT];
+#endif
+
+// Returns the ticks elapsed since startTicks, and aggregates them into the probe with USE_PROFILE
+static inline profileTicks_t profileRecord(profileProbe_e probe, profileTicks_t startTicks)
+{
+    const profileTicks_t ticks = profileTicks() - startTicks;
+#ifdef USE_PROFILE
+    profileProbe_t *p = &profileProbes[probe];
+    p->count++;
+    p->totalTicks += ticks;
+    if (ticks > p->maxTicks) {
+        p->maxTicks = ticks;
+    }
+#else
+    (void)probe;
+#endif
+    return ticks;
+}
+
+static inline uint32_t profileTicksToUs(profileTicks_t ticks)
+{
+    return ticks / PROFILE_TICKS_PER_US;
+}
+
+void profileInit(void);
+void profileReset(void);
+const char *profileProbeName(profileProbe_e probe);
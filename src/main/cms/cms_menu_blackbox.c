@@ -145,9 +145,8 @@ static void cmsx_Blackbox_GetDeviceStatus()
         if (storageDeviceIsWorking) {
             snprintf(cmsx_BlackboxStatus, CMS_BLACKBOX_STRING_LENGTH, "READY");
 
-            const flashGeometry_t *geometry = flashfsGetGeometry();
-            storageUsed = flashfsGetOffset() / 1024;
-            storageFree = (geometry->totalSize / 1024) - storageUsed;
+            storageUsed = flashfsGetUsedSize() / 1024;
+            storageFree = (flashfsGetSize() / 1024) - storageUsed;
         } else {
             snprintf(cmsx_BlackboxStatus, CMS_BLACKBOX_STRING_LENGTH, "FAULT");
         }
@@ -43,6 +43,7 @@
 
 #include "fc/config.h"
 #include "fc/controlrate_profile.h"
+#include "fc/fc_rc.h"
 #include "fc/rc_controls.h"
 #include "fc/runtime_config.h"
 
@@ -186,6 +187,8 @@ static long cmsx_RateProfileWriteback(const OSD_Entry *self)
     UNUSED(self);
 
     memcpy(controlRateProfilesMutable(rateProfileIndex), &rateProfile, sizeof(controlRateConfig_t));
+    // the rates are only read through the curves
+    generateRcCurves();
 
     return 0;
 }
@@ -39,6 +39,12 @@ float nullFilterApply(void *filter, float input)
     return input;
 }
 
+void nullFilter3Apply(void *filter, float *input)
+{
+    UNUSED(filter);
+    UNUSED(input);
+}
+
 
 // PT1 Low Pass filter
 
@@ -69,11 +75,60 @@ float pt1FilterApply4(pt1Filter_t *filter, float input, uint8_t f_cut, float dT)
     return filter->state;
 }
 
+// PT1 Low Pass filter, all axes
+
+void pt1Filter3Init(pt1Filter3_t *filter, uint8_t f_cut, float dT)
+{
+    const float RC = 1.0f / ( 2.0f * M_PI_FLOAT * f_cut );
+    filter->k = dT / (RC + dT);
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        filter->state[axis] = 0;
+    }
+}
+
+void pt1Filter3Apply(pt1Filter3_t *filter, float *input)
+{
+    const float k = filter->k;
+    filter->state[X] += k * (input[X] - filter->state[X]);
+    filter->state[Y] += k * (input[Y] - filter->state[Y]);
+    filter->state[Z] += k * (input[Z] - filter->state[Z]);
+    input[X] = filter->state[X];
+    input[Y] = filter->state[Y];
+    input[Z] = filter->state[Z];
+}
+
 float filterGetNotchQ(uint16_t centerFreq, uint16_t cutoff) {
     float octaves = log2f((float) centerFreq  / (float) cutoff) * 2;
     return sqrtf(powf(2, octaves)) / (powf(2, octaves) - 1);
 }
 
+// sine of [0, pi], used for cheap retuning of notch filters
+#define BIQUAD_SIN_TABLE_SIZE 256
+static float biquadSinTable[BIQUAD_SIN_TABLE_SIZE + 1];
+static bool biquadSinTableInitialised = false;
+
+static void biquadInitSinTable(void)
+{
+    if (biquadSinTableInitialised) {
+        return;
+    }
+    for (int i = 0; i <= BIQUAD_SIN_TABLE_SIZE; i++) {
+        biquadSinTable[i] = sinf(M_PI_FLOAT * i / BIQUAD_SIN_TABLE_SIZE);
+    }
+    biquadSinTableInitialised = true;
+}
+
+// linear interpolation in the sine table, x must be in [-pi/2, pi]
+static float biquadSin(float x)
+{
+    const bool negative = x < 0;
+    const float pos = (negative ? -x : x) * (BIQUAD_SIN_TABLE_SIZE / M_PI_FLOAT);
+    const int idx = MIN((int)pos, BIQUAD_SIN_TABLE_SIZE - 1);
+    const float frac = pos - idx;
+    const float result = biquadSinTable[idx] + frac * (biquadSinTable[idx + 1] - biquadSinTable[idx]);
+    return negative ? -result : result;
+}
+
 /* sets up a biquad Filter */
 void biquadFilterInitLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate)
 {
@@ -118,6 +173,75 @@ void biquadFilterInit(biquadFilter_t *filter, float filterFreq, uint32_t refresh
 
     // zero initial samples
     filter->d1 = filter->d2 = 0;
+
+    if (filterType == FILTER_NOTCH) {
+        biquadInitSinTable();
+    }
+}
+
+/*
+ * Retune the cutoff of a low pass filter set up by biquadFilterInitLPF(). Unlike biquadFilterInitLPF() the filter
+ * state is kept, so the output carries on from where it was when the cutoff follows a changing input rate.
+ */
+void biquadFilterUpdateLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate)
+{
+    const float d1 = filter->d1;
+    const float d2 = filter->d2;
+    biquadFilterInitLPF(filter, filterFreq, refreshRate);
+    filter->d1 = d1;
+    filter->d2 = d2;
+}
+
+/*
+ * Retune the centre frequency of a notch filter set up by biquadFilterInit().
+ * Uses the sine table instead of sinf/cosf and keeps the filter state, so it is cheap
+ * enough to be called continuously while the filter is running.
+ */
+void biquadFilterUpdateNotch(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q)
+{
+    const float omega = 2 * M_PI_FLOAT * filterFreq * refreshRate * 0.000001f;
+    const float sn = biquadSin(omega);
+    const float cs = biquadSin(0.5f * M_PI_FLOAT - omega);
+    const float alpha = sn / (2 * Q);
+    const float a0inv = 1 / (1 + alpha);
+
+    filter->b0 = a0inv;
+    filter->b1 = -2 * cs * a0inv;
+    filter->b2 = a0inv;
+    filter->a1 = filter->b1;
+    filter->a2 = (1 - alpha) * a0inv;
+}
+
+/* sets up a biquad filter for all axes */
+void biquadFilter3Init(biquadFilter3_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType)
+{
+    biquadFilter_t axisFilter;
+    biquadFilterInit(&axisFilter, filterFreq, refreshRate, Q, filterType);
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        filter->b0[axis] = axisFilter.b0;
+        filter->b1[axis] = axisFilter.b1;
+        filter->b2[axis] = axisFilter.b2;
+        filter->a1[axis] = axisFilter.a1;
+        filter->a2[axis] = axisFilter.a2;
+        filter->d1[axis] = filter->d2[axis] = 0;
+    }
+}
+
+void biquadFilter3InitLPF(biquadFilter3_t *filter, float filterFreq, uint32_t refreshRate)
+{
+    biquadFilter3Init(filter, filterFreq, refreshRate, BIQUAD_Q, FILTER_LPF);
+}
+
+/* retunes the notch of one axis, see biquadFilterUpdateNotch() */
+void biquadFilter3UpdateNotch(biquadFilter3_t *filter, int axis, float filterFreq, uint32_t refreshRate, float Q)
+{
+    biquadFilter_t axisFilter;
+    biquadFilterUpdateNotch(&axisFilter, filterFreq, refreshRate, Q);
+    filter->b0[axis] = axisFilter.b0;
+    filter->b1[axis] = axisFilter.b1;
+    filter->b2[axis] = axisFilter.b2;
+    filter->a1[axis] = axisFilter.a1;
+    filter->a2[axis] = axisFilter.a2;
 }
 
 /* Computes a biquadFilter_t filter on a sample */
@@ -129,6 +253,30 @@ float biquadFilterApply(biquadFilter_t *filter, float input)
     return result;
 }
 
+/* Computes a biquadFilter3_t filter on a sample of each axis, written out so the FPU pipeline can interleave the axes */
+void biquadFilter3Apply(biquadFilter3_t *filter, float *input)
+{
+    const float x = input[X];
+    const float y = input[Y];
+    const float z = input[Z];
+
+    const float resultX = filter->b0[X] * x + filter->d1[X];
+    const float resultY = filter->b0[Y] * y + filter->d1[Y];
+    const float resultZ = filter->b0[Z] * z + filter->d1[Z];
+
+    filter->d1[X] = filter->b1[X] * x - filter->a1[X] * resultX + filter->d2[X];
+    filter->d1[Y] = filter->b1[Y] * y - filter->a1[Y] * resultY + filter->d2[Y];
+    filter->d1[Z] = filter->b1[Z] * z - filter->a1[Z] * resultZ + filter->d2[Z];
+
+    filter->d2[X] = filter->b2[X] * x - filter->a2[X] * resultX;
+    filter->d2[Y] = filter->b2[Y] * y - filter->a2[Y] * resultY;
+    filter->d2[Z] = filter->b2[Z] * z - filter->a2[Z] * resultZ;
+
+    input[X] = resultX;
+    input[Y] = resultY;
+    input[Z] = resultZ;
+}
+
 /*
  * FIR filter
  */
@@ -246,3 +394,10 @@ float firFilterDenoiseUpdate(firFilterDenoise_t *filter, float input)
         return filter->movingSum / ++filter->filledCount + 1;
 }
 
+// filter must point to an array of XYZ_AXIS_COUNT filters
+void firFilterDenoise3Update(firFilterDenoise_t *filter, float *input)
+{
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        input[axis] = firFilterDenoiseUpdate(&filter[axis], input[axis]);
+    }
+}
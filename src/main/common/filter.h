@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "common/axis.h"
+
 #ifdef STM32F10X
 #define MAX_FIR_DENOISE_WINDOW_SIZE 60
 #else
@@ -36,6 +38,17 @@ typedef struct biquadFilter_s {
     float d1, d2;
 } biquadFilter_t;
 
+/* struct-of-arrays variants filtering all three axes in one call */
+typedef struct pt1Filter3_s {
+    float state[XYZ_AXIS_COUNT];
+    float k;
+} pt1Filter3_t;
+
+typedef struct biquadFilter3_s {
+    float b0[XYZ_AXIS_COUNT], b1[XYZ_AXIS_COUNT], b2[XYZ_AXIS_COUNT], a1[XYZ_AXIS_COUNT], a2[XYZ_AXIS_COUNT];
+    float d1[XYZ_AXIS_COUNT], d2[XYZ_AXIS_COUNT];
+} biquadFilter3_t;
+
 typedef struct firFilterDenoise_s{
     int filledCount;
     int targetCount;
@@ -66,11 +79,15 @@ typedef struct firFilter_s {
 } firFilter_t;
 
 typedef float (*filterApplyFnPtr)(void *filter, float input);
+typedef void (*filter3ApplyFnPtr)(void *filter, float *input);  // filters XYZ_AXIS_COUNT values in place
 
 float nullFilterApply(void *filter, float input);
+void nullFilter3Apply(void *filter, float *input);
 
 void biquadFilterInitLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate);
 void biquadFilterInit(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilterUpdateLPF(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate);
+void biquadFilterUpdateNotch(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q);
 float biquadFilterApply(biquadFilter_t *filter, float input);
 float filterGetNotchQ(uint16_t centerFreq, uint16_t cutoff);
 
@@ -78,6 +95,13 @@ void pt1FilterInit(pt1Filter_t *filter, uint8_t f_cut, float dT);
 float pt1FilterApply(pt1Filter_t *filter, float input);
 float pt1FilterApply4(pt1Filter_t *filter, float input, uint8_t f_cut, float dT);
 
+void biquadFilter3Init(biquadFilter3_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilter3InitLPF(biquadFilter3_t *filter, float filterFreq, uint32_t refreshRate);
+void biquadFilter3UpdateNotch(biquadFilter3_t *filter, int axis, float filterFreq, uint32_t refreshRate, float Q);
+void biquadFilter3Apply(biquadFilter3_t *filter, float *input);
+void pt1Filter3Init(pt1Filter3_t *filter, uint8_t f_cut, float dT);
+void pt1Filter3Apply(pt1Filter3_t *filter, float *input);
+
 void firFilterInit(firFilter_t *filter, float *buf, uint8_t bufLength, const float *coeffs);
 void firFilterInit2(firFilter_t *filter, float *buf, uint8_t bufLength, const float *coeffs, uint8_t coeffsLength);
 void firFilterUpdate(firFilter_t *filter, float input);
@@ -90,4 +114,5 @@ float firFilterLastInput(const firFilter_t *filter);
 
 void firFilterDenoiseInit(firFilterDenoise_t *filter, uint8_t gyroSoftLpfHz, uint16_t targetLooptime);
 float firFilterDenoiseUpdate(firFilterDenoise_t *filter, float input);
+void firFilterDenoise3Update(firFilterDenoise_t *filter, float *input);
 
@@ -0,0 +1,119 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+#include "huffman.h"
+
+/*
+ * Static Huffman coding with a fixed table, codes are written most significant bit first.
+ *
+ * The encoder can be fed in pieces and stops at the first symbol that no longer fits the output buffer, so the
+ * caller knows how many input bytes the output holds. The last byte is padded with zero bits, the decoder must
+ * be told how many bytes to decode.
+ */
+
+void huffmanEncodeInit(huffmanState_t *state, uint8_t *outBuf, int outBufLen)
+{
+    state->outBuf = outBuf;
+    state->outBufLen = outBufLen;
+    state->bytesWritten = 0;
+    state->bitBuffer = 0;
+    state->bitCount = 0;
+}
+
+/*
+ * Returns the number of bytes of inBuf that were encoded, less than inLen if the output buffer is full.
+ */
+int huffmanEncode(huffmanState_t *state, const huffmanTable_t *table, const uint8_t *inBuf, int inLen)
+{
+    const int outBits = state->outBufLen * 8;
+    int i;
+    for (i = 0; i < inLen; i++) {
+        const huffmanTable_t *entry = &table[inBuf[i]];
+        if (state->bytesWritten * 8 + state->bitCount + entry->codeLen > outBits) {
+            break;
+        }
+        state->bitBuffer = (state->bitBuffer << entry->codeLen) | entry->code;
+        state->bitCount += entry->codeLen;
+        while (state->bitCount >= 8) {
+            state->bitCount -= 8;
+            state->outBuf[state->bytesWritten++] = state->bitBuffer >> state->bitCount;
+        }
+    }
+    return i;
+}
+
+/*
+ * Writes out any remaining bits, returns the total length of the encoded data.
+ */
+int huffmanEncodeFinish(huffmanState_t *state)
+{
+    if (state->bitCount > 0) {
+        state->outBuf[state->bytesWritten++] = state->bitBuffer << (8 - state->bitCount);
+        state->bitCount = 0;
+    }
+    return state->bytesWritten;
+}
+
+/*
+ * Reference decoder, table must hold canonical codes.
+ * Returns outCount, or -1 if inBuf ends early or holds a code that is not in the table.
+ */
+int huffmanDecode(uint8_t *outBuf, int outCount, const uint8_t *inBuf, int inLen, const huffmanTable_t *table)
+{
+    // canonical codes of each length are consecutive, ordered by symbol
+    uint16_t lengthCount[HUFFMAN_MAX_CODE_LEN + 1] = { 0 };
+    for (int i = 0; i < HUFFMAN_TABLE_SIZE; i++) {
+        lengthCount[table[i].codeLen]++;
+    }
+    uint16_t firstCode[HUFFMAN_MAX_CODE_LEN + 1];
+    uint16_t firstSymbol[HUFFMAN_MAX_CODE_LEN + 1];
+    uint8_t symbols[HUFFMAN_TABLE_SIZE];
+    uint16_t code = 0;
+    int symbolIndex = 0;
+    for (int len = 1; len <= HUFFMAN_MAX_CODE_LEN; len++) {
+        firstCode[len] = code;
+        firstSymbol[len] = symbolIndex;
+        for (int i = 0; i < HUFFMAN_TABLE_SIZE; i++) {
+            if (table[i].codeLen == len) {
+                symbols[symbolIndex++] = i;
+            }
+        }
+        code = (code + lengthCount[len]) << 1;
+    }
+
+    int inBit = 0;
+    for (int out = 0; out < outCount; out++) {
+        code = 0;
+        int len = 0;
+        for (;;) {
+            if (inBit >= inLen * 8 || len == HUFFMAN_MAX_CODE_LEN) {
+                return -1;
+            }
+            code = (code << 1) | ((inBuf[inBit / 8] >> (7 - inBit % 8)) & 1);
+            inBit++;
+            len++;
+            const int index = code - firstCode[len];
+            if (index >= 0 && index < lengthCount[len]) {
+                outBuf[out] = symbols[firstSymbol[len] + index];
+                break;
+            }
+        }
+    }
+    return outCount;
+}
@@ -0,0 +1,44 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define HUFFMAN_TABLE_SIZE      256
+#define HUFFMAN_MAX_CODE_LEN    12
+
+typedef struct huffmanTable_s {
+    uint16_t code;
+    uint8_t codeLen;
+} huffmanTable_t;
+
+typedef struct huffmanState_s {
+    uint8_t *outBuf;
+    int outBufLen;
+    int bytesWritten;
+    uint32_t bitBuffer;
+    int bitCount;                           // bits in bitBuffer not yet written to outBuf
+} huffmanState_t;
+
+extern const huffmanTable_t huffmanTable[HUFFMAN_TABLE_SIZE];
+
+void huffmanEncodeInit(huffmanState_t *state, uint8_t *outBuf, int outBufLen);
+int huffmanEncode(huffmanState_t *state, const huffmanTable_t *table, const uint8_t *inBuf, int inLen);
+int huffmanEncodeFinish(huffmanState_t *state);
+
+int huffmanDecode(uint8_t *outBuf, int outCount, const uint8_t *inBuf, int inLen, const huffmanTable_t *table);
@@ -0,0 +1,92 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+#include "huffman.h"
+
+/*
+ * Canonical Huffman codes, { code, codeLen } indexed by byte value, built from the byte frequencies of blackbox logs.
+ * Logs are mostly zeros and small zigzag encoded deltas, so those get the short codes. Code lengths are limited to
+ * HUFFMAN_MAX_CODE_LEN and every byte value has a code.
+ */
+const huffmanTable_t huffmanTable[HUFFMAN_TABLE_SIZE] = {
+    { 0x000,  2 }, { 0x004,  4 }, { 0x00a,  5 }, { 0x00b,  5 }, // 0x00
+    { 0x00c,  5 }, { 0x01c,  6 }, { 0x01d,  6 }, { 0x01e,  6 }, // 0x04
+    { 0x01f,  6 }, { 0x020,  6 }, { 0x021,  6 }, { 0x022,  6 }, // 0x08
+    { 0x023,  6 }, { 0x024,  6 }, { 0x04c,  7 }, { 0x04d,  7 }, // 0x0c
+    { 0x025,  6 }, { 0x04e,  7 }, { 0x04f,  7 }, { 0x050,  7 }, // 0x10
+    { 0x051,  7 }, { 0x052,  7 }, { 0x053,  7 }, { 0x054,  7 }, // 0x14
+    { 0x055,  7 }, { 0x056,  7 }, { 0x057,  7 }, { 0x058,  7 }, // 0x18
+    { 0x059,  7 }, { 0x05a,  7 }, { 0x05b,  7 }, { 0x05c,  7 }, // 0x1c
+    { 0x05d,  7 }, { 0x0be,  8 }, { 0x0bf,  8 }, { 0x0c0,  8 }, // 0x20
+    { 0x0c1,  8 }, { 0x0c2,  8 }, { 0x0c3,  8 }, { 0x0c4,  8 }, // 0x24
+    { 0x0c5,  8 }, { 0x0c6,  8 }, { 0x0c7,  8 }, { 0x0c8,  8 }, // 0x28
+    { 0x0c9,  8 }, { 0x0ca,  8 }, { 0x0cb,  8 }, { 0x0cc,  8 }, // 0x2c
+    { 0x05e,  7 }, { 0x0cd,  8 }, { 0x0ce,  8 }, { 0x0cf,  8 }, // 0x30
+    { 0x0d0,  8 }, { 0x0d1,  8 }, { 0x0d2,  8 }, { 0x0d3,  8 }, // 0x34
+    { 0x0d4,  8 }, { 0x1ae,  9 }, { 0x1af,  9 }, { 0x1b0,  9 }, // 0x38
+    { 0x0d5,  8 }, { 0x1b1,  9 }, { 0x1b2,  9 }, { 0x1b3,  9 }, // 0x3c
+    { 0x1b4,  9 }, { 0x1b5,  9 }, { 0x1b6,  9 }, { 0x1b7,  9 }, // 0x40
+    { 0x1b8,  9 }, { 0x1b9,  9 }, { 0x1ba,  9 }, { 0x1bb,  9 }, // 0x44
+    { 0x1bc,  9 }, { 0x0d6,  8 }, { 0x1bd,  9 }, { 0x1be,  9 }, // 0x48
+    { 0x1bf,  9 }, { 0x1c0,  9 }, { 0x1c1,  9 }, { 0x1c2,  9 }, // 0x4c
+    { 0x00d,  5 }, { 0x1c3,  9 }, { 0x1c4,  9 }, { 0x1c5,  9 }, // 0x50
+    { 0x1c6,  9 }, { 0x1c7,  9 }, { 0x1c8,  9 }, { 0x1c9,  9 }, // 0x54
+    { 0x1ca,  9 }, { 0x1cb,  9 }, { 0x1cc,  9 }, { 0x39c, 10 }, // 0x58
+    { 0x39d, 10 }, { 0x39e, 10 }, { 0x39f, 10 }, { 0x3a0, 10 }, // 0x5c
+    { 0x3a1, 10 }, { 0x3a2, 10 }, { 0x3a3, 10 }, { 0x3a4, 10 }, // 0x60
+    { 0x3a5, 10 }, { 0x3a6, 10 }, { 0x3a7, 10 }, { 0x3a8, 10 }, // 0x64
+    { 0x3a9, 10 }, { 0x3aa, 10 }, { 0x3ab, 10 }, { 0x3ac, 10 }, // 0x68
+    { 0x3ad, 10 }, { 0x3ae, 10 }, { 0x3af, 10 }, { 0x3b0, 10 }, // 0x6c
+    { 0x3b1, 10 }, { 0x3b2, 10 }, { 0x3b3, 10 }, { 0x3b4, 10 }, // 0x70
+    { 0x3b5, 10 }, { 0x3b6, 10 }, { 0x3b7, 10 }, { 0x3b8, 10 }, // 0x74
+    { 0x3b9, 10 }, { 0x3ba, 10 }, { 0x3bb, 10 }, { 0x3bc, 10 }, // 0x78
+    { 0x3bd, 10 }, { 0x3be, 10 }, { 0x3bf, 10 }, { 0x3c0, 10 }, // 0x7c
+    { 0x3c1, 10 }, { 0x3c2, 10 }, { 0x3c3, 10 }, { 0x3c4, 10 }, // 0x80
+    { 0x3c5, 10 }, { 0x3c6, 10 }, { 0x3c7, 10 }, { 0x3c8, 10 }, // 0x84
+    { 0x3c9, 10 }, { 0x3ca, 10 }, { 0x3cb, 10 }, { 0x3cc, 10 }, // 0x88
+    { 0x3cd, 10 }, { 0x3ce, 10 }, { 0x3cf, 10 }, { 0x3d0, 10 }, // 0x8c
+    { 0x3d1, 10 }, { 0x3d2, 10 }, { 0x3d3, 10 }, { 0x7b0, 11 }, // 0x90
+    { 0x3d4, 10 }, { 0x7b1, 11 }, { 0x3d5, 10 }, { 0x7b2, 11 }, // 0x94
+    { 0x3d6, 10 }, { 0x7b3, 11 }, { 0x7b4, 11 }, { 0x7b5, 11 }, // 0x98
+    { 0x7b6, 11 }, { 0x7b7, 11 }, { 0x7b8, 11 }, { 0x7b9, 11 }, // 0x9c
+    { 0x3d7, 10 }, { 0x7ba, 11 }, { 0x7bb, 11 }, { 0x7bc, 11 }, // 0xa0
+    { 0x7bd, 11 }, { 0x7be, 11 }, { 0x7bf, 11 }, { 0x7c0, 11 }, // 0xa4
+    { 0x7c1, 11 }, { 0x7c2, 11 }, { 0x7c3, 11 }, { 0x7c4, 11 }, // 0xa8
+    { 0x7c5, 11 }, { 0x7c6, 11 }, { 0x7c7, 11 }, { 0x7c8, 11 }, // 0xac
+    { 0x7c9, 11 }, { 0x7ca, 11 }, { 0x7cb, 11 }, { 0x7cc, 11 }, // 0xb0
+    { 0x7cd, 11 }, { 0x7ce, 11 }, { 0x7cf, 11 }, { 0x7d0, 11 }, // 0xb4
+    { 0x7d1, 11 }, { 0x7d2, 11 }, { 0x7d3, 11 }, { 0x7d4, 11 }, // 0xb8
+    { 0x7d5, 11 }, { 0x7d6, 11 }, { 0x7d7, 11 }, { 0x7d8, 11 }, // 0xbc
+    { 0x7d9, 11 }, { 0xfd0, 12 }, { 0x7da, 11 }, { 0xfd1, 12 }, // 0xc0
+    { 0x7db, 11 }, { 0xfd2, 12 }, { 0x7dc, 11 }, { 0x7dd, 11 }, // 0xc4
+    { 0x7de, 11 }, { 0xfd3, 12 }, { 0x7df, 11 }, { 0xfd4, 12 }, // 0xc8
+    { 0x7e0, 11 }, { 0xfd5, 12 }, { 0xfd6, 12 }, { 0xfd7, 12 }, // 0xcc
+    { 0x7e1, 11 }, { 0xfd8, 12 }, { 0xfd9, 12 }, { 0xfda, 12 }, // 0xd0
+    { 0xfdb, 12 }, { 0xfdc, 12 }, { 0xfdd, 12 }, { 0xfde, 12 }, // 0xd4
+    { 0xfdf, 12 }, { 0xfe0, 12 }, { 0xfe1, 12 }, { 0xfe2, 12 }, // 0xd8
+    { 0xfe3, 12 }, { 0xfe4, 12 }, { 0xfe5, 12 }, { 0xfe6, 12 }, // 0xdc
+    { 0x7e2, 11 }, { 0xfe7, 12 }, { 0xfe8, 12 }, { 0xfe9, 12 }, // 0xe0
+    { 0xfea, 12 }, { 0xfeb, 12 }, { 0xfec, 12 }, { 0xfed, 12 }, // 0xe4
+    { 0x7e3, 11 }, { 0xfee, 12 }, { 0xfef, 12 }, { 0xff0, 12 }, // 0xe8
+    { 0xff1, 12 }, { 0xff2, 12 }, { 0xff3, 12 }, { 0xff4, 12 }, // 0xec
+    { 0xff5, 12 }, { 0xff6, 12 }, { 0xff7, 12 }, { 0xff8, 12 }, // 0xf0
+    { 0x7e4, 11 }, { 0xff9, 12 }, { 0x7e5, 11 }, { 0xffa, 12 }, // 0xf4
+    { 0x7e6, 11 }, { 0xffb, 12 }, { 0x7e7, 11 }, { 0xffc, 12 }, // 0xf8
+    { 0xffd, 12 }, { 0xffe, 12 }, { 0xfff, 12 }, { 0x1cd,  9 }, // 0xfc
+};
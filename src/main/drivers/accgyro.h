@@ -58,6 +58,7 @@ typedef struct gyroDev_s {
     gyroRateKHz_e gyroRateKHz;
     uint8_t mpuDividerDrops;
     volatile bool dataReady;
+    volatile uint32_t dataReadyAtUs;                        // time of the last data ready interrupt
     sensor_align_e gyroAlign;
     mpuDetectionResult_t mpuDetectionResult;
     const extiConfig_t *mpuIntExtiConfig;
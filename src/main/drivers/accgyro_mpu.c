@@ -51,6 +51,9 @@
 
 mpuResetFnPtr mpuResetFn;
 
+// Raised by mpuIntExtiSetPriority()
+static uint8_t mpuIntExtiPriority = NVIC_PRIO_MPU_INT_EXTI;
+
 #ifndef MPU_I2C_INSTANCE
 #define MPU_I2C_INSTANCE I2C_DEVICE
 #endif
@@ -115,6 +118,7 @@ static void mpuIntExtiHandler(extiCallbackRec_t *cb)
     lastCalledAtUs = nowUs;
 #endif
     gyroDev_t *gyro = container_of(cb, gyroDev_t, exti);
+    gyro->dataReadyAtUs = micros();
     gyro->dataReady = true;
     if (gyro->update) {
         gyro->update(gyro);
@@ -193,11 +197,45 @@ bool mpuAccRead(accDev_t *acc)
 
 void mpuGyroSetIsrUpdate(gyroDev_t *gyro, sensorGyroUpdateFuncPtr updateFn)
 {
-    ATOMIC_BLOCK(NVIC_PRIO_MPU_INT_EXTI) {
+    ATOMIC_BLOCK(mpuIntExtiPriority) {
         gyro->update = updateFn;
     }
 }
 
+/*
+ * Raise the priority of the data ready interrupt, for when more than the gyro read is done from it.
+ */
+void mpuIntExtiSetPriority(gyroDev_t *gyro, uint8_t irqPriority)
+{
+#if defined(MPU_INT_EXTI)
+    if (!gyro->mpuIntExtiConfig || !gyro->exti.fn) {
+        return;
+    }
+
+    mpuIntExtiPriority = irqPriority;
+    EXTISetPriority(IOGetByTag(gyro->mpuIntExtiConfig->tag), irqPriority);
+#else
+    UNUSED(gyro);
+    UNUSED(irqPriority);
+#endif
+}
+
+/*
+ * Keep the data ready interrupt from running until mpuIntExtiRelease() is called with the value returned, it runs then
+ * if it became pending in the meantime. Calls can be nested.
+ */
+uint8_t mpuIntExtiHold(void)
+{
+    const uint8_t basePri = __get_BASEPRI();
+    __set_BASEPRI_MAX(mpuIntExtiPriority);
+    return basePri;
+}
+
+void mpuIntExtiRelease(uint8_t basePri)
+{
+    __set_BASEPRI(basePri);
+}
+
 bool mpuGyroRead(gyroDev_t *gyro)
 {
     uint8_t data[6];
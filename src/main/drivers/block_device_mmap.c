@@ -0,0 +1,453 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * A disk image mapped into memory that can stand in for the flash chip under flashfs or the SD card under asyncfatfs
+ * on the host, so both filesystems can be run and benchmarked without hardware.
+ *
+ * The flash side behaves like NOR flash: programming only clears bits and wraps around within a page, erasing sets
+ * a whole sector back to 0xFF. The SD card side models a card on an SPI bus: a block takes a while to transmit, the
+ * card is busy while it programs the block, and the blocks of a pre-erased multi-block write program much quicker
+ * than blocks written by themselves.
+ *
+ * Busy times are measured against micros() and blocking waits call delayMicroseconds(), so the device runs in
+ * whatever time the test harness provides.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+
+#ifdef USE_BLOCK_DEVICE_MMAP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/maths.h"
+
+#include "drivers/system.h"
+
+#include "block_device_mmap.h"
+
+#define DEFAULT_TIMEOUT_MILLIS 1000
+
+static uint8_t *image = NULL;
+static uint32_t imageSize;
+static int imageFd = -1;
+
+static flashGeometry_t geometry = {
+    .pageSize = BLOCK_DEVICE_MMAP_PAGE_SIZE
+};
+
+static blockDeviceTiming_t timing;
+static blockDeviceStats_t stats;
+static uint32_t operationCount;
+
+static uint32_t busyUntilUs;
+
+static uint32_t programAddress;
+static bool programFailed;
+
+static struct {
+    bool pending;
+    bool failed;
+    sdcardBlockOperation_e operation;
+    uint32_t blockIndex;
+    uint8_t *buffer;
+    sdcard_operationCompleteCallback_c callback;
+    uint32_t callbackData;
+    uint32_t completeAtUs;
+    uint32_t busyAfterUs;
+} cardOperation;
+
+static bool multiWrite;
+static uint32_t multiWriteNextBlock;
+static uint32_t multiWriteBlocksRemain;
+
+static bool deviceIsIdle(void)
+{
+    return (int32_t)(micros() - busyUntilUs) >= 0;
+}
+
+static void deviceBusyFor(uint32_t us)
+{
+    const uint32_t now = micros();
+
+    if ((int32_t)(now - busyUntilUs) > 0) {
+        busyUntilUs = now;
+    }
+    busyUntilUs += us;
+}
+
+static bool operationFails(void)
+{
+    if (timing.failEvery > 0 && ++operationCount % timing.failEvery == 0) {
+        stats.failures++;
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Flash
+ */
+
+static bool flashIsReady(void)
+{
+    return deviceIsIdle();
+}
+
+static bool flashWaitForReady(uint32_t timeoutMillis)
+{
+    const int32_t remainingUs = busyUntilUs - micros();
+
+    if (remainingUs > 0) {
+        if ((uint32_t)remainingUs > timeoutMillis * 1000) {
+            delayMicroseconds(timeoutMillis * 1000);
+            return false;
+        }
+        delayMicroseconds(remainingUs);
+    }
+    return true;
+}
+
+static void flashEraseSector(uint32_t address)
+{
+    flashWaitForReady(DEFAULT_TIMEOUT_MILLIS);
+
+    stats.erases++;
+    if (!operationFails() && address < geometry.totalSize) {
+        memset(image + address - address % geometry.sectorSize, 0xFF, geometry.sectorSize);
+    }
+    deviceBusyFor(timing.eraseUs);
+}
+
+static void flashEraseCompletely(void)
+{
+    flashWaitForReady(DEFAULT_TIMEOUT_MILLIS);
+
+    stats.erases++;
+    memset(image, 0xFF, geometry.totalSize);
+    deviceBusyFor(timing.eraseUs * geometry.sectors);
+}
+
+static void flashPageProgramBegin(uint32_t address)
+{
+    flashWaitForReady(DEFAULT_TIMEOUT_MILLIS);
+
+    programAddress = address;
+    programFailed = operationFails();
+}
+
+static void flashPageProgramContinue(const uint8_t *data, int length)
+{
+    for (int i = 0; i < length && !programFailed; i++) {
+        // Programming only clears bits, and wraps around within the page
+        const uint32_t address = programAddress - programAddress % BLOCK_DEVICE_MMAP_PAGE_SIZE + (programAddress + i) % BLOCK_DEVICE_MMAP_PAGE_SIZE;
+
+        if (address >= geometry.totalSize) {
+            break;
+        }
+        if ((image[address] & data[i]) != data[i]) {
+            stats.programErrors++;
+        }
+        image[address] &= data[i];
+    }
+    programAddress += length;
+}
+
+static void flashPageProgramFinish(void)
+{
+    stats.writes++;
+    deviceBusyFor(timing.writeUs);
+}
+
+static void flashPageProgram(uint32_t address, const uint8_t *data, int length)
+{
+    flashPageProgramBegin(address);
+    flashPageProgramContinue(data, length);
+    flashPageProgramFinish();
+}
+
+static int flashReadBytes(uint32_t address, uint8_t *buffer, int length)
+{
+    if (!flashWaitForReady(DEFAULT_TIMEOUT_MILLIS)) {
+        return 0;
+    }
+
+    stats.reads++;
+    if (operationFails() || address >= geometry.totalSize) {
+        return 0;
+    }
+    length = MIN((uint32_t)length, geometry.totalSize - address);
+    memcpy(buffer, image + address, length);
+
+    // Reads are clocked out by the CPU, so the caller waits for them
+    delayMicroseconds(timing.readUs);
+
+    return length;
+}
+
+static const flashGeometry_t *flashGetGeometry(void)
+{
+    return &geometry;
+}
+
+const flashVTable_t blockDeviceMmapFlashVTable = {
+    .isReady = flashIsReady,
+    .waitForReady = flashWaitForReady,
+    .eraseSector = flashEraseSector,
+    .eraseCompletely = flashEraseCompletely,
+    .pageProgramBegin = flashPageProgramBegin,
+    .pageProgramContinue = flashPageProgramContinue,
+    .pageProgramFinish = flashPageProgramFinish,
+    .pageProgram = flashPageProgram,
+    .pageProgramStart = flashPageProgram,
+    .readBytes = flashReadBytes,
+    .getGeometry = flashGetGeometry,
+};
+
+/*
+ * SD card
+ */
+
+static bool sdcardIsReady(void)
+{
+    return !cardOperation.pending && deviceIsIdle();
+}
+
+static void sdcardEndMultiWrite(void)
+{
+    multiWrite = false;
+    deviceBusyFor(timing.stopUs);
+}
+
+static void sdcardStartOperation(sdcardBlockOperation_e operation, uint32_t blockIndex, uint8_t *buffer,
+    sdcard_operationCompleteCallback_c callback, uint32_t callbackData, uint32_t durationUs)
+{
+    cardOperation.pending = true;
+    cardOperation.failed = operationFails() || blockIndex >= imageSize / BLOCK_DEVICE_MMAP_BLOCK_SIZE;
+    cardOperation.operation = operation;
+    cardOperation.blockIndex = blockIndex;
+    cardOperation.buffer = buffer;
+    cardOperation.callback = callback;
+    cardOperation.callbackData = callbackData;
+    cardOperation.completeAtUs = micros() + durationUs;
+    cardOperation.busyAfterUs = 0;
+}
+
+static bool sdcardPoll(void)
+{
+    if (cardOperation.pending && (int32_t)(micros() - cardOperation.completeAtUs) >= 0) {
+        cardOperation.pending = false;
+        deviceBusyFor(cardOperation.busyAfterUs);
+
+        uint8_t *block = image + cardOperation.blockIndex * BLOCK_DEVICE_MMAP_BLOCK_SIZE;
+
+        if (!cardOperation.failed) {
+            if (cardOperation.operation == SDCARD_BLOCK_OPERATION_READ) {
+                memcpy(cardOperation.buffer, block, BLOCK_DEVICE_MMAP_BLOCK_SIZE);
+            } else {
+                memcpy(block, cardOperation.buffer, BLOCK_DEVICE_MMAP_BLOCK_SIZE);
+            }
+        }
+        if (cardOperation.callback) {
+            cardOperation.callback(cardOperation.operation, cardOperation.blockIndex,
+                cardOperation.failed ? NULL : cardOperation.buffer, cardOperation.callbackData);
+        }
+    }
+
+    return sdcardIsReady();
+}
+
+static bool sdcardReadBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (!sdcardIsReady()) {
+        return false;
+    }
+    if (multiWrite) {
+        sdcardEndMultiWrite();
+        return false;
+    }
+
+    stats.reads++;
+    sdcardStartOperation(SDCARD_BLOCK_OPERATION_READ, blockIndex, buffer, callback, callbackData, timing.readUs);
+
+    return true;
+}
+
+static sdcardOperationStatus_e sdcardBeginWriteBlocks(uint32_t blockIndex, uint32_t blockCount)
+{
+    if (!sdcardIsReady()) {
+        return SDCARD_OPERATION_BUSY;
+    }
+    if (multiWrite) {
+        if (blockIndex == multiWriteNextBlock) {
+            return SDCARD_OPERATION_SUCCESS;
+        }
+        sdcardEndMultiWrite();
+        return SDCARD_OPERATION_BUSY;
+    }
+
+    multiWrite = true;
+    multiWriteNextBlock = blockIndex;
+    multiWriteBlocksRemain = blockCount;
+
+    return SDCARD_OPERATION_SUCCESS;
+}
+
+static sdcardOperationStatus_e sdcardWriteBlock(uint32_t blockIndex, uint8_t *buffer, sdcard_operationCompleteCallback_c callback, uint32_t callbackData)
+{
+    if (!sdcardIsReady()) {
+        return SDCARD_OPERATION_BUSY;
+    }
+    if (multiWrite && blockIndex != multiWriteNextBlock) {
+        sdcardEndMultiWrite();
+        return SDCARD_OPERATION_BUSY;
+    }
+
+    sdcardStartOperation(SDCARD_BLOCK_OPERATION_WRITE, blockIndex, buffer, callback, callbackData, timing.transmitUs);
+
+    if (multiWrite) {
+        stats.multiWrites++;
+        cardOperation.busyAfterUs = timing.multiWriteUs;
+        multiWriteNextBlock++;
+        if (--multiWriteBlocksRemain == 0) {
+            multiWrite = false;
+            cardOperation.busyAfterUs += timing.stopUs;
+        }
+    } else {
+        stats.writes++;
+        cardOperation.busyAfterUs = timing.writeUs;
+    }
+
+    return SDCARD_OPERATION_IN_PROGRESS;
+}
+
+const sdcardVTable_t blockDeviceMmapSdcardVTable = {
+    .poll = sdcardPoll,
+    .readBlock = sdcardReadBlock,
+    .beginWriteBlocks = sdcardBeginWriteBlocks,
+    .writeBlock = sdcardWriteBlock,
+};
+
+/*
+ * Image
+ */
+
+/**
+ * Map the image file `filename` of `size` bytes, growing the file if it is shorter, or an anonymous image if
+ * `filename` is NULL. A new image reads as zeros, erase it before using it as flash.
+ *
+ * The flash geometry splits the image into sectors of `flashSectorSize` bytes, a multiple of the page size.
+ */
+bool blockDeviceMmapOpen(const char *filename, uint32_t size, uint32_t flashSectorSize)
+{
+    blockDeviceMmapClose();
+
+    void *mapping;
+
+    if (filename) {
+        imageFd = open(filename, O_RDWR | O_CREAT, 0644);
+        if (imageFd < 0) {
+            return false;
+        }
+
+        struct stat fileStat;
+        if (fstat(imageFd, &fileStat) < 0 || (fileStat.st_size < (off_t)size && ftruncate(imageFd, size) < 0)) {
+            close(imageFd);
+            imageFd = -1;
+            return false;
+        }
+
+        mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, imageFd, 0);
+    } else {
+        mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+
+    if (mapping == MAP_FAILED) {
+        if (imageFd >= 0) {
+            close(imageFd);
+            imageFd = -1;
+        }
+        return false;
+    }
+
+    image = mapping;
+    imageSize = size;
+
+    geometry.sectorSize = flashSectorSize;
+    geometry.sectors = size / flashSectorSize;
+    geometry.pagesPerSector = flashSectorSize / BLOCK_DEVICE_MMAP_PAGE_SIZE;
+    geometry.totalSize = geometry.sectors * flashSectorSize;
+
+    memset(&cardOperation, 0, sizeof(cardOperation));
+    multiWrite = false;
+    busyUntilUs = micros();
+    operationCount = 0;
+    blockDeviceMmapResetStats();
+
+    return true;
+}
+
+/**
+ * Write the image back to its file and unmap it.
+ */
+void blockDeviceMmapClose(void)
+{
+    if (image) {
+        if (imageFd >= 0) {
+            msync(image, imageSize, MS_SYNC);
+        }
+        munmap(image, imageSize);
+        image = NULL;
+    }
+    if (imageFd >= 0) {
+        close(imageFd);
+        imageFd = -1;
+    }
+    imageSize = 0;
+    geometry.sectors = 0;
+    geometry.totalSize = 0;
+}
+
+void blockDeviceMmapSetTiming(const blockDeviceTiming_t *newTiming)
+{
+    timing = *newTiming;
+    operationCount = 0;
+}
+
+uint8_t *blockDeviceMmapGetImage(void)
+{
+    return image;
+}
+
+const blockDeviceStats_t *blockDeviceMmapGetStats(void)
+{
+    return &stats;
+}
+
+void blockDeviceMmapResetStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+#endif
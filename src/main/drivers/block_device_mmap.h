@@ -0,0 +1,62 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "drivers/flash.h"
+#include "drivers/sdcard.h"
+
+#define BLOCK_DEVICE_MMAP_PAGE_SIZE     256
+#define BLOCK_DEVICE_MMAP_BLOCK_SIZE    512
+
+/*
+ * How long the device is busy for each operation, measured against micros(). All zero makes every operation
+ * complete immediately.
+ */
+typedef struct blockDeviceTiming_s {
+    uint32_t readUs;        // Reading a flash span or an SD card block
+    uint32_t transmitUs;    // Sending an SD card block to the card
+    uint32_t writeUs;       // Programming a flash page or an SD card block written by itself
+    uint32_t multiWriteUs;  // Programming an SD card block of a pre-erased multi-block write
+    uint32_t stopUs;        // Finishing an SD card multi-block write
+    uint32_t eraseUs;       // Erasing a flash sector
+    uint32_t failEvery;     // Fail every n-th read, write or erase, 0 to never fail
+} blockDeviceTiming_t;
+
+typedef struct blockDeviceStats_s {
+    uint32_t reads;
+    uint32_t writes;        // Flash page programs and SD card blocks written by themselves
+    uint32_t multiWrites;   // SD card blocks written as part of a multi-block write
+    uint32_t erases;
+    uint32_t failures;      // Operations failed on purpose by failEvery
+    uint32_t programErrors; // Flash bytes programmed that would have needed bits set back to 1 without an erase
+} blockDeviceStats_t;
+
+bool blockDeviceMmapOpen(const char *filename, uint32_t size, uint32_t flashSectorSize);
+void blockDeviceMmapClose(void);
+
+void blockDeviceMmapSetTiming(const blockDeviceTiming_t *timing);
+uint8_t *blockDeviceMmapGetImage(void);
+
+const blockDeviceStats_t *blockDeviceMmapGetStats(void);
+void blockDeviceMmapResetStats(void);
+
+extern const flashVTable_t blockDeviceMmapFlashVTable;
+extern const sdcardVTable_t blockDeviceMmapSdcardVTable;
@@ -0,0 +1,155 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef USE_DSHOT
+
+#include "common/maths.h"
+
+#include "dshot.h"
+
+/*
+ * DShot frames and bidirectional DShot telemetry.
+ *
+ * A DShot frame is 11 bits of throttle/command, the telemetry request bit and a 4 bit checksum.
+ * Bidirectional ESCs are driven with an inverted signal and an inverted checksum, and answer
+ * each frame on the same wire with 21 bits at 5/4 of the DShot bit rate: a start transition
+ * followed by 20 bits of GCR where every 1 is a level change. The 4 GCR quintets decode to 16
+ * bits, the eRPM period (3 bit exponent, 9 bit mantissa in us) and an inverted checksum.
+ */
+
+uint16_t prepareDshotPacket(uint16_t value, bool requestTelemetry, bool inverted)
+{
+    uint16_t packet = (value << 1) | (requestTelemetry ? 1 : 0);
+
+    // xor data by nibbles
+    int csum = packet ^ (packet >> 4) ^ (packet >> 8);
+    if (inverted) {
+        // bidirectional ESCs only answer frames carrying the inverted checksum
+        csum = ~csum;
+    }
+
+    return (packet << 4) | (csum & 0xf);
+}
+
+/*
+ * Rebuild the GCR frame from the timer captures of every edge on the line, in timer ticks.
+ * bitTicks is the length of one telemetry bit in the same ticks.
+ * Returns the 21 bit frame with the start bit set, or 0 if the edges do not form a frame.
+ */
+uint32_t dshotTelemetryEdgesToGcr(const uint32_t *edges, int count, uint32_t bitTicks)
+{
+    if (count < 2) {
+        return 0;
+    }
+
+    uint32_t gcr = 0;
+    int bits = 0;
+    // each edge starts a run of bits at the same level, the edge itself is the 1 of that run
+    for (int i = 1; i < count && bits < DSHOT_TELEMETRY_GCR_BITS; i++) {
+        // the capture timer runs with a 16 bit period while listening
+        const uint32_t ticks = (edges[i] - edges[i - 1]) & 0xffff;
+        const int len = (ticks + bitTicks / 2) / bitTicks;
+        if (len == 0) {
+            // glitch shorter than half a bit
+            return 0;
+        }
+        gcr = (gcr << len) | (1 << (len - 1));
+        bits += len;
+    }
+
+    if (bits > DSHOT_TELEMETRY_GCR_BITS) {
+        return 0;
+    }
+    if (bits < DSHOT_TELEMETRY_GCR_BITS) {
+        // the line returns to idle without an edge if the frame ends high, the last run fills the frame
+        const int len = DSHOT_TELEMETRY_GCR_BITS - bits;
+        gcr = (gcr << len) | (1 << (len - 1));
+    }
+
+    return gcr;
+}
+
+#define GCR_INVALID 0xff
+
+static const uint8_t gcrToNibble[32] = {
+    GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID, GCR_INVALID,
+    GCR_INVALID, 0x9,         0xa,         0xb,         GCR_INVALID, 0xd,         0xe,         0xf,
+    GCR_INVALID, GCR_INVALID, 0x2,         0x3,         GCR_INVALID, 0x5,         0x6,         0x7,
+    GCR_INVALID, 0x0,         0x8,         0x1,         GCR_INVALID, 0x4,         0xc,         GCR_INVALID
+};
+
+/*
+ * Returns the 16 bit telemetry value including its checksum, or DSHOT_TELEMETRY_INVALID.
+ */
+uint16_t dshotTelemetryGcrToValue(uint32_t gcr)
+{
+    uint16_t value = 0;
+    for (int shift = 15; shift >= 0; shift -= 5) {
+        const uint8_t nibble = gcrToNibble[(gcr >> shift) & 0x1f];
+        if (nibble == GCR_INVALID) {
+            return DSHOT_TELEMETRY_INVALID;
+        }
+        value = (value << 4) | nibble;
+    }
+
+    // the checksum is inverted, so the xor of all nibbles including it is 0xf
+    const uint16_t csum = value ^ (value >> 4) ^ (value >> 8) ^ (value >> 12);
+    if ((csum & 0xf) != 0xf) {
+        return DSHOT_TELEMETRY_INVALID;
+    }
+
+    return value;
+}
+
+/*
+ * Returns eRPM / 100 for a valid telemetry value.
+ */
+uint16_t dshotTelemetryValueToErpm(uint16_t value)
+{
+    const uint16_t data = value >> 4;
+    if (data == 0xfff) {
+        // longest period that can be encoded, motor stopped
+        return 0;
+    }
+
+    const uint32_t periodUs = (data & 0x1ff) << (data >> 9);
+    if (periodUs == 0) {
+        return DSHOT_TELEMETRY_INVALID;
+    }
+
+    const uint32_t erpm = (60 * 1000000 / 100 + periodUs / 2) / periodUs;
+    return MIN(erpm, DSHOT_TELEMETRY_INVALID - 1);
+}
+
+/*
+ * Returns eRPM / 100 from the edges of one telemetry frame, or DSHOT_TELEMETRY_INVALID.
+ */
+uint16_t dshotTelemetryDecode(const uint32_t *edges, int count, uint32_t bitTicks)
+{
+    const uint16_t value = dshotTelemetryGcrToValue(dshotTelemetryEdgesToGcr(edges, count, bitTicks));
+    if (value == DSHOT_TELEMETRY_INVALID) {
+        return DSHOT_TELEMETRY_INVALID;
+    }
+
+    return dshotTelemetryValueToErpm(value);
+}
+#endif
@@ -0,0 +1,29 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#define DSHOT_TELEMETRY_GCR_BITS    21      // start transition followed by 4 GCR encoded nibbles
+#define DSHOT_TELEMETRY_INPUT_LEN   32      // edge timestamps captured per telemetry frame
+#define DSHOT_TELEMETRY_INVALID     0xffff
+
+uint16_t prepareDshotPacket(uint16_t value, bool requestTelemetry, bool inverted);
+
+uint32_t dshotTelemetryEdgesToGcr(const uint32_t *edges, int count, uint32_t bitTicks);
+uint16_t dshotTelemetryGcrToValue(uint32_t gcr);
+uint16_t dshotTelemetryValueToErpm(uint16_t value);
+uint16_t dshotTelemetryDecode(const uint32_t *edges, int count, uint32_t bitTicks);
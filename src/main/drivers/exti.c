@@ -72,6 +72,27 @@ void EXTIHandlerInit(extiCallbackRec_t *self, extiHandlerCallback *fn)
     self->fn = fn;
 }
 
+// The lines of a group share an interrupt, it runs at the highest priority any of them asked for
+static void extiGroupRaisePriority(int group, int irqPriority)
+{
+    if (extiGroupPriority[group] <= irqPriority) {
+        return;
+    }
+    extiGroupPriority[group] = irqPriority;
+
+#if defined(STM32F7)
+    HAL_NVIC_SetPriority(extiGroupIRQn[group], NVIC_PRIORITY_BASE(irqPriority), NVIC_PRIORITY_SUB(irqPriority));
+    HAL_NVIC_EnableIRQ(extiGroupIRQn[group]);
+#else
+    NVIC_InitTypeDef NVIC_InitStructure;
+    NVIC_InitStructure.NVIC_IRQChannel = extiGroupIRQn[group];
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = NVIC_PRIORITY_BASE(irqPriority);
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = NVIC_PRIORITY_SUB(irqPriority);
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+#endif
+}
+
 #if defined(STM32F7)
 void EXTIConfig(IO_t io, extiCallbackRec_t *cb, int irqPriority, ioConfig_t config)
 {
@@ -96,11 +117,7 @@ void EXTIConfig(IO_t io, extiCallbackRec_t *cb, int irqPriority, ioConfig_t conf
 
     //EXTI_ClearITPendingBit(extiLine);
 
-    if(extiGroupPriority[group] > irqPriority) {
-        extiGroupPriority[group] = irqPriority;
-        HAL_NVIC_SetPriority(extiGroupIRQn[group], NVIC_PRIORITY_BASE(irqPriority), NVIC_PRIORITY_SUB(irqPriority));
-        HAL_NVIC_EnableIRQ(extiGroupIRQn[group]);
-    }
+    extiGroupRaisePriority(group, irqPriority);
 }
 #else
 
@@ -134,19 +151,22 @@ void EXTIConfig(IO_t io, extiCallbackRec_t *cb, int irqPriority, EXTITrigger_Typ
     EXTIInit.EXTI_LineCmd = ENABLE;
     EXTI_Init(&EXTIInit);
 
-    if(extiGroupPriority[group] > irqPriority) {
-        extiGroupPriority[group] = irqPriority;
-
-        NVIC_InitTypeDef NVIC_InitStructure;
-        NVIC_InitStructure.NVIC_IRQChannel = extiGroupIRQn[group];
-        NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = NVIC_PRIORITY_BASE(irqPriority);
-        NVIC_InitStructure.NVIC_IRQChannelSubPriority = NVIC_PRIORITY_SUB(irqPriority);
-        NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
-        NVIC_Init(&NVIC_InitStructure);
-    }
+    extiGroupRaisePriority(group, irqPriority);
 }
 #endif
 
+/*
+ * Raise the priority of the interrupt of a line set up with EXTIConfig(), it can't be lowered again.
+ */
+void EXTISetPriority(IO_t io, int irqPriority)
+{
+    int chIdx = IO_GPIOPinIdx(io);
+    if (chIdx < 0)
+        return;
+
+    extiGroupRaisePriority(extiGroups[chIdx], irqPriority);
+}
+
 void EXTIRelease(IO_t io)
 {
     // don't forget to match cleanup with config
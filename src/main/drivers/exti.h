@@ -42,5 +42,6 @@ void EXTIConfig(IO_t io, extiCallbackRec_t *cb, int irqPriority, ioConfig_t conf
 #else
 void EXTIConfig(IO_t io, extiCallbackRec_t *cb, int irqPriority, EXTITrigger_TypeDef trigger);
 #endif
+void EXTISetPriority(IO_t io, int irqPriority);
 void EXTIRelease(IO_t io);
 void EXTIEnable(IO_t io, bool enable);
@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
+
 #include "drivers/io_types.h"
 
 typedef struct flashGeometry_s {
@@ -31,6 +33,28 @@ typedef struct flashGeometry_s {
     uint32_t totalSize;  // This is just sectorSize * sectors
 } flashGeometry_t;
 
+/*
+ * Operations of a flash chip, so that flashfs can be used with any chip (or a disk image on the host) that
+ * provides them. pageProgramStart may be NULL when the chip can't program a page in the background.
+ */
+typedef struct flashVTable_s {
+    bool (*isReady)(void);
+    bool (*waitForReady)(uint32_t timeoutMillis);
+
+    void (*eraseSector)(uint32_t address);
+    void (*eraseCompletely)(void);
+
+    void (*pageProgramBegin)(uint32_t address);
+    void (*pageProgramContinue)(const uint8_t *data, int length);
+    void (*pageProgramFinish)(void);
+    void (*pageProgram)(uint32_t address, const uint8_t *data, int length);
+    void (*pageProgramStart)(uint32_t address, const uint8_t *data, int length);
+
+    int (*readBytes)(uint32_t address, uint8_t *buffer, int length);
+
+    const flashGeometry_t *(*getGeometry)(void);
+} flashVTable_t;
+
 typedef struct flashConfig_s {
     ioTag_t csTag;
 } flashConfig_t;
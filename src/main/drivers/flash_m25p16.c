@@ -26,6 +26,7 @@
 #include "flash_m25p16.h"
 #include "io.h"
 #include "bus_spi.h"
+#include "dma.h"
 #include "system.h"
 
 #define M25P16_INSTRUCTION_RDID             0x9F
@@ -72,6 +73,14 @@ static IO_t m25p16CsPin = IO_NONE;
  */
 static bool couldBeBusy = false;
 
+#ifdef USE_FLASH_M25P16_DMA
+// A page program is being sent by DMA, chip select stays asserted until the transfer completes
+static bool dmaInProgress = false;
+#if defined(USE_HAL_DRIVER)
+static DMA_HandleTypeDef *m25p16DMAHandle;
+#endif
+#endif
+
 /**
  * Send the given command byte to the device.
  */
@@ -110,8 +119,66 @@ static uint8_t m25p16_readStatus()
     return in[1];
 }
 
+#ifdef USE_FLASH_M25P16_DMA
+/**
+ * Complete the page program started by m25p16_pageProgramStart() once its DMA transfer is done.
+ *
+ * Returns true if the transfer has finished and the flash has been released to program the page.
+ */
+static bool m25p16_pageProgramDMAComplete(void)
+{
+#if defined(USE_HAL_DRIVER)
+    if (m25p16DMAHandle->State != HAL_DMA_STATE_READY) {
+        return false;
+    }
+
+    // Drain anything left in the Rx FIFO (we didn't read it during the write)
+    while (__HAL_SPI_GET_FLAG(spiHandleByInstance(M25P16_SPI_INSTANCE), SPI_FLAG_RXNE) == SET) {
+        M25P16_SPI_INSTANCE->DR;
+    }
+
+    // Wait for the final bit to be transmitted
+    while (spiIsBusBusy(M25P16_SPI_INSTANCE)) {
+    }
+
+    HAL_SPI_DMAStop(spiHandleByInstance(M25P16_SPI_INSTANCE));
+#else
+    if (DMA_GetFlagStatus(M25P16_DMA_CHANNEL_TX, M25P16_DMA_CHANNEL_TX_COMPLETE_FLAG) == RESET) {
+        return false;
+    }
+    DMA_ClearFlag(M25P16_DMA_CHANNEL_TX, M25P16_DMA_CHANNEL_TX_COMPLETE_FLAG);
+
+    DMA_Cmd(M25P16_DMA_CHANNEL_TX, DISABLE);
+
+    // Drain anything left in the Rx FIFO (we didn't read it during the write)
+    while (SPI_I2S_GetFlagStatus(M25P16_SPI_INSTANCE, SPI_I2S_FLAG_RXNE) == SET) {
+        M25P16_SPI_INSTANCE->DR;
+    }
+
+    // Wait for the final bit to be transmitted
+    while (spiIsBusBusy(M25P16_SPI_INSTANCE)) {
+    }
+
+    SPI_I2S_DMACmd(M25P16_SPI_INSTANCE, SPI_I2S_DMAReq_Tx, DISABLE);
+#endif
+
+    // Raising chip select starts the page program
+    DISABLE_M25P16;
+
+    dmaInProgress = false;
+
+    return true;
+}
+#endif
+
 bool m25p16_isReady()
 {
+#ifdef USE_FLASH_M25P16_DMA
+    if (dmaInProgress && !m25p16_pageProgramDMAComplete()) {
+        return false;
+    }
+#endif
+
     // If couldBeBusy is false, don't bother to poll the flash chip for its status
     couldBeBusy = couldBeBusy && ((m25p16_readStatus() & M25P16_STATUS_FLAG_WRITE_IN_PROGRESS) != 0);
 
@@ -228,6 +295,10 @@ bool m25p16_init(const flashConfig_t *flashConfig)
 
     DISABLE_M25P16;
 
+#ifdef USE_FLASH_M25P16_DMA
+    dmaInit(dmaGetIdentifier(M25P16_DMA_CHANNEL_TX), OWNER_FLASH, 0);
+#endif
+
 #ifndef M25P16_SPI_SHARED
     //Maximum speed for standard READ command is 20mHz, other commands tolerate 25mHz
     spiSetDivisor(M25P16_SPI_INSTANCE, SPI_CLOCK_FAST);
@@ -286,6 +357,56 @@ void m25p16_pageProgramFinish()
     DISABLE_M25P16;
 }
 
+/**
+ * Begin writing bytes to a flash page without waiting for the transfer to finish. Address must not cross a page
+ * boundary.
+ *
+ * With a DMA stream for the flash the data is sent in the background and this returns as soon as the transfer
+ * has been queued. The data must stay untouched until m25p16_isReady() returns true. Without DMA the data is
+ * sent before returning, as m25p16_pageProgram() does.
+ */
+void m25p16_pageProgramStart(uint32_t address, const uint8_t *data, int length)
+{
+#ifdef USE_FLASH_M25P16_DMA
+    m25p16_pageProgramBegin(address);
+
+    dmaInProgress = true;
+
+#if defined(USE_HAL_DRIVER)
+    m25p16DMAHandle = spiSetDMATransmit(M25P16_DMA_CHANNEL_TX, M25P16_DMA_CHANNEL, M25P16_SPI_INSTANCE, (uint8_t *)data, length);
+#else
+#ifdef M25P16_DMA_CLK
+    RCC_AHB1PeriphClockCmd(M25P16_DMA_CLK, ENABLE);
+#endif
+    DMA_InitTypeDef DMA_InitStructure;
+
+    DMA_StructInit(&DMA_InitStructure);
+    DMA_InitStructure.DMA_Channel = M25P16_DMA_CHANNEL;
+    DMA_InitStructure.DMA_Memory0BaseAddr = (uint32_t) data;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) &M25P16_SPI_INSTANCE->DR;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+
+    DMA_InitStructure.DMA_BufferSize = length;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+
+    DMA_DeInit(M25P16_DMA_CHANNEL_TX);
+    DMA_Init(M25P16_DMA_CHANNEL_TX, &DMA_InitStructure);
+
+    DMA_Cmd(M25P16_DMA_CHANNEL_TX, ENABLE);
+
+    SPI_I2S_DMACmd(M25P16_SPI_INSTANCE, SPI_I2S_DMAReq_Tx, ENABLE);
+#endif
+#else
+    m25p16_pageProgram(address, data, length);
+#endif
+}
+
 /**
  * Write bytes to a flash page. Address must not cross a page boundary.
  *
@@ -346,4 +467,18 @@ const flashGeometry_t* m25p16_getGeometry()
     return &geometry;
 }
 
+const flashVTable_t m25p16VTable = {
+    .isReady = m25p16_isReady,
+    .waitForReady = m25p16_waitForReady,
+    .eraseSector = m25p16_eraseSector,
+    .eraseCompletely = m25p16_eraseCompletely,
+    .pageProgramBegin = m25p16_pageProgramBegin,
+    .pageProgramContinue = m25p16_pageProgramContinue,
+    .pageProgramFinish = m25p16_pageProgramFinish,
+    .pageProgram = m25p16_pageProgram,
+    .pageProgramStart = m25p16_pageProgramStart,
+    .readBytes = m25p16_readBytes,
+    .getGeometry = m25p16_getGeometry,
+};
+
 #endif
@@ -22,6 +22,11 @@
 
 #define M25P16_PAGESIZE 256
 
+// Page programs are sent by DMA when the target provides a transmit stream and the flash has the bus to itself
+#if defined(M25P16_DMA_CHANNEL_TX) && !defined(M25P16_SPI_SHARED)
+#define USE_FLASH_M25P16_DMA
+#endif
+
 bool m25p16_init(const flashConfig_t *flashConfig);
 
 void m25p16_eraseSector(uint32_t address);
@@ -33,6 +38,8 @@ void m25p16_pageProgramBegin(uint32_t address);
 void m25p16_pageProgramContinue(const uint8_t *data, int length);
 void m25p16_pageProgramFinish();
 
+void m25p16_pageProgramStart(uint32_t address, const uint8_t *data, int length);
+
 int m25p16_readBytes(uint32_t address, uint8_t *buffer, int length);
 
 bool m25p16_isReady();
@@ -40,3 +47,5 @@ bool m25p16_waitForReady(uint32_t timeoutMillis);
 
 struct flashGeometry_s;
 const struct flashGeometry_s* m25p16_getGeometry();
+
+extern const flashVTable_t m25p16VTable;
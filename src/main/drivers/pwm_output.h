@@ -19,6 +19,9 @@
 
 #include "io_types.h"
 #include "timer.h"
+#ifdef USE_DSHOT
+#include "dshot.h"
+#endif
 
 #define MAX_SUPPORTED_MOTORS 12
 
@@ -56,6 +59,11 @@ typedef enum {
 #define MOTOR_BIT_0           7
 #define MOTOR_BIT_1           14
 #define MOTOR_BITLENGTH       19
+
+// telemetry frames are sent at 5/4 of the DShot bit rate
+#define DSHOT_TELEMETRY_BIT_TICKS   ((MOTOR_BITLENGTH + 1) * 4 / 5)
+// consecutive bad frames after which the last value is dropped, 12ms at an 8kHz motor update
+#define DSHOT_TELEMETRY_MAX_BAD_FRAMES  100
 #endif
 
 #if defined(STM32F40_41xxx) // must be multiples of timer clock
@@ -97,11 +105,25 @@ typedef struct {
     TIM_HandleTypeDef TimHandle;
     DMA_HandleTypeDef hdma_tim;
 #endif
+#ifdef USE_DSHOT_TELEMETRY
+    bool useTelemetry;
+    volatile bool isInput;
+    uint16_t dshotTelemetryValue;           // eRPM / 100
+    uint16_t dshotTelemetryErrors;
+    uint8_t dshotTelemetryBadFrames;        // consecutive frames that failed to decode
+    TIM_OCInitTypeDef ocInitStruct;
+    TIM_ICInitTypeDef icInitStruct;
+    DMA_InitTypeDef dmaInitStruct;
+    uint32_t dmaInputBuffer[DSHOT_TELEMETRY_INPUT_LEN];
+#endif
 } motorDmaOutput_t;
 
 motorDmaOutput_t *getMotorDmaOutput(uint8_t index);
 
 extern bool pwmMotorsEnabled;
+#ifdef USE_DSHOT_TELEMETRY
+extern bool useDshotTelemetry;
+#endif
 
 struct timerHardware_s;
 typedef void(*pwmWriteFuncPtr)(uint8_t index, uint16_t value);  // function pointer used to write motors
@@ -121,6 +143,7 @@ typedef struct motorDevConfig_s {
     uint8_t  motorPwmProtocol;              // Pwm Protocol
     uint8_t  motorPwmInversion;             // Active-High vs Active-Low. Useful for brushed FCs converted for brushless operation
     uint8_t  useUnsyncedPwm;
+    uint8_t  useDshotTelemetry;             // bidirectional DShot, read eRPM back from the ESC on the motor line
     ioTag_t  ioTags[MAX_SUPPORTED_MOTORS];
 } motorDevConfig_t;
 
@@ -144,6 +167,10 @@ void pwmWriteDigital(uint8_t index, uint16_t value);
 void pwmDigitalMotorHardwareConfig(const timerHardware_t *timerHardware, uint8_t motorIndex, motorPwmProtocolTypes_e pwmProtocolType, uint8_t output);
 void pwmCompleteDigitalMotorUpdate(uint8_t motorCount);
 #endif
+#ifdef USE_DSHOT_TELEMETRY
+uint16_t getDshotTelemetry(uint8_t index);
+uint16_t getDshotTelemetryErrors(uint8_t index);
+#endif
 
 void pwmWriteMotor(uint8_t index, uint16_t value);
 void pwmShutdownPulsesForAllMotors(uint8_t motorCount);
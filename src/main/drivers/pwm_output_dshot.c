@@ -22,6 +22,8 @@
 
 #ifdef USE_DSHOT
 
+#include "build/debug.h"
+
 #include "io.h"
 #include "timer.h"
 #if defined(STM32F4)
@@ -39,6 +41,10 @@ static uint8_t dmaMotorTimerCount = 0;
 static motorDmaTimer_t dmaMotorTimers[MAX_DMA_TIMERS];
 static motorDmaOutput_t dmaMotors[MAX_SUPPORTED_MOTORS];
 
+#ifdef USE_DSHOT_TELEMETRY
+bool useDshotTelemetry = false;
+#endif
+
 motorDmaOutput_t *getMotorDmaOutput(uint8_t index)
 {
     return &dmaMotors[index];
@@ -55,6 +61,78 @@ uint8_t getTimerIndex(TIM_TypeDef *timer)
     return dmaMotorTimerCount-1;
 }
 
+#ifdef USE_DSHOT_TELEMETRY
+/*
+ * Bidirectional DShot: once a frame has been sent the motor channel is switched to input capture on
+ * both edges and the same DMA stream records the timer count of every edge of the ESC's answer.
+ * The answer is decoded and the channel switched back to output when the next frame is written.
+ */
+static void pwmDshotSetDirectionOutput(motorDmaOutput_t * const motor, bool output)
+{
+    const timerHardware_t * const timerHardware = motor->timerHardware;
+    TIM_TypeDef *timer = timerHardware->tim;
+    DMA_Stream_TypeDef *dmaRef = timerHardware->dmaRef;
+
+    DMA_DeInit(dmaRef);
+
+    motor->isInput = !output;
+    if (output) {
+        timerOCInit(timer, timerHardware->channel, &motor->ocInitStruct);
+        timerOCPreloadConfig(timer, timerHardware->channel, TIM_OCPreload_Enable);
+        motor->dmaInitStruct.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+        motor->dmaInitStruct.DMA_Memory0BaseAddr = (uint32_t)motor->dmaBuffer;
+        motor->dmaInitStruct.DMA_BufferSize = MOTOR_DMA_BUFFER_SIZE;
+    } else {
+        timerOCPreloadConfig(timer, timerHardware->channel, TIM_OCPreload_Disable);
+        TIM_ICInit(timer, &motor->icInitStruct);
+        motor->dmaInitStruct.DMA_DIR = DMA_DIR_PeripheralToMemory;
+        motor->dmaInitStruct.DMA_Memory0BaseAddr = (uint32_t)motor->dmaInputBuffer;
+        motor->dmaInitStruct.DMA_BufferSize = DSHOT_TELEMETRY_INPUT_LEN;
+    }
+
+    DMA_Init(dmaRef, &motor->dmaInitStruct);
+    DMA_ITConfig(dmaRef, DMA_IT_TC, ENABLE);
+}
+
+static void pwmDshotDecodeTelemetry(uint8_t index, motorDmaOutput_t * const motor)
+{
+    DMA_Stream_TypeDef *dmaRef = motor->timerHardware->dmaRef;
+
+    DMA_Cmd(dmaRef, DISABLE);
+    TIM_DMACmd(motor->timerHardware->tim, motor->timerDmaSource, DISABLE);
+
+    const int edges = DSHOT_TELEMETRY_INPUT_LEN - DMA_GetCurrDataCounter(dmaRef);
+    const uint16_t erpm = dshotTelemetryDecode(motor->dmaInputBuffer, edges, DSHOT_TELEMETRY_BIT_TICKS);
+    if (erpm != DSHOT_TELEMETRY_INVALID) {
+        motor->dshotTelemetryValue = erpm;
+        motor->dshotTelemetryBadFrames = 0;
+    } else {
+        motor->dshotTelemetryErrors++;
+        // an ESC that stopped answering must not keep reporting its last speed
+        if (motor->dshotTelemetryBadFrames < DSHOT_TELEMETRY_MAX_BAD_FRAMES) {
+            motor->dshotTelemetryBadFrames++;
+        } else {
+            motor->dshotTelemetryValue = 0;
+        }
+    }
+    if (index < DEBUG16_VALUE_COUNT) {
+        DEBUG_SET(DEBUG_DSHOT_RPM_TELEMETRY, index, erpm);
+    }
+
+    pwmDshotSetDirectionOutput(motor, true);
+}
+
+uint16_t getDshotTelemetry(uint8_t index)
+{
+    return dmaMotors[index].dshotTelemetryValue;
+}
+
+uint16_t getDshotTelemetryErrors(uint8_t index)
+{
+    return dmaMotors[index].dshotTelemetryErrors;
+}
+#endif
+
 void pwmWriteDigital(uint8_t index, uint16_t value)
 {
 
@@ -68,19 +146,19 @@ void pwmWriteDigital(uint8_t index, uint16_t value)
         return;
     }
 
-    uint16_t packet = (value << 1) | (motor->requestTelemetry ? 1 : 0);
+    bool inverted = false;
+#ifdef USE_DSHOT_TELEMETRY
+    if (motor->useTelemetry) {
+        if (motor->isInput) {
+            pwmDshotDecodeTelemetry(index, motor);
+        }
+        inverted = true;
+    }
+#endif
+
+    uint16_t packet = prepareDshotPacket(value, motor->requestTelemetry, inverted);
     motor->requestTelemetry = false;    // reset telemetry request to make sure it's triggered only once in a row
 
-    // compute checksum
-    int csum = 0;
-    int csum_data = packet;
-    for (int i = 0; i < 3; i++) {
-        csum ^=  csum_data;   // xor data by nibbles
-        csum_data >>= 4;
-    }
-    csum &= 0xf;
-    // append checksum
-    packet = (packet << 4) | csum;
     // generate pulses for whole packet
     for (int i = 0; i < 16; i++) {
         motor->dmaBuffer[i] = (packet & 0x8000) ? MOTOR_BIT_1 : MOTOR_BIT_0;  // MSB first
@@ -100,6 +178,13 @@ void pwmCompleteDigitalMotorUpdate(uint8_t motorCount)
     }
 
     for (int i = 0; i < dmaMotorTimerCount; i++) {
+#ifdef USE_DSHOT_TELEMETRY
+        if (useDshotTelemetry) {
+            // the period was extended for capturing, auto-reload preload is off so this takes effect immediately
+            TIM_SetAutoreload(dmaMotorTimers[i].timer, MOTOR_BITLENGTH);
+            TIM_ARRPreloadConfig(dmaMotorTimers[i].timer, ENABLE);
+        }
+#endif
         TIM_SetCounter(dmaMotorTimers[i].timer, 0);
         TIM_DMACmd(dmaMotorTimers[i].timer, dmaMotorTimers[i].timerDmaSources, ENABLE);
     }
@@ -112,6 +197,19 @@ static void motor_DMA_IRQHandler(dmaChannelDescriptor_t *descriptor)
         DMA_Cmd(motor->timerHardware->dmaRef, DISABLE);
         TIM_DMACmd(motor->timerHardware->tim, motor->timerDmaSource, DISABLE);
         DMA_CLEAR_FLAG(descriptor, DMA_IT_TCIF);
+#ifdef USE_DSHOT_TELEMETRY
+        // a full input buffer is left for pwmDshotDecodeTelemetry()
+        if (motor->useTelemetry && !motor->isInput) {
+            // the last two slots of the frame are idle, so the answer cannot have started yet.
+            // all motors on this timer end their frame together, let the counter run over the whole answer
+            TIM_ARRPreloadConfig(motor->timerHardware->tim, DISABLE);
+            TIM_SetAutoreload(motor->timerHardware->tim, 0xffff);
+
+            pwmDshotSetDirectionOutput(motor, false);
+            DMA_Cmd(motor->timerHardware->dmaRef, ENABLE);
+            TIM_DMACmd(motor->timerHardware->tim, motor->timerDmaSource, ENABLE);
+        }
+#endif
     }
 }
 
@@ -123,6 +221,15 @@ void pwmDigitalMotorHardwareConfig(const timerHardware_t *timerHardware, uint8_t
     motorDmaOutput_t * const motor = &dmaMotors[motorIndex];
     motor->timerHardware = timerHardware;
 
+#ifdef USE_DSHOT_TELEMETRY
+    // complementary outputs cannot capture, those motors stay unidirectional
+    motor->useTelemetry = useDshotTelemetry && !(output & TIMER_OUTPUT_N_CHANNEL) && timerHardware->dmaRef != NULL;
+    if (motor->useTelemetry) {
+        // bidirectional DShot idles high
+        output ^= TIMER_OUTPUT_INVERTED;
+    }
+#endif
+
     TIM_TypeDef *timer = timerHardware->tim;
     const IO_t motorIO = IOGetByTag(timerHardware->tag);
 
@@ -162,6 +269,16 @@ void pwmDigitalMotorHardwareConfig(const timerHardware_t *timerHardware, uint8_t
 
     timerOCInit(timer, timerHardware->channel, &TIM_OCInitStructure);
     timerOCPreloadConfig(timer, timerHardware->channel, TIM_OCPreload_Enable);
+#ifdef USE_DSHOT_TELEMETRY
+    motor->ocInitStruct = TIM_OCInitStructure;
+
+    TIM_ICStructInit(&motor->icInitStruct);
+    motor->icInitStruct.TIM_Channel = timerHardware->channel;
+    motor->icInitStruct.TIM_ICPolarity = TIM_ICPolarity_BothEdge;
+    motor->icInitStruct.TIM_ICSelection = TIM_ICSelection_DirectTI;
+    motor->icInitStruct.TIM_ICPrescaler = TIM_ICPSC_DIV1;
+    motor->icInitStruct.TIM_ICFilter = 2;
+#endif
     motor->timerDmaSource = timerDmaSource(timerHardware->channel);
     dmaMotorTimers[timerIndex].timerDmaSources |= motor->timerDmaSource;
 
@@ -216,6 +333,9 @@ void pwmDigitalMotorHardwareConfig(const timerHardware_t *timerHardware, uint8_t
 
     DMA_Init(dmaRef, &DMA_InitStructure);
     DMA_ITConfig(dmaRef, DMA_IT_TC, ENABLE);
+#ifdef USE_DSHOT_TELEMETRY
+    motor->dmaInitStruct = DMA_InitStructure;
+#endif
 }
 
 #endif
@@ -22,6 +22,11 @@
 
 #ifdef USE_DSHOT
 
+#ifdef USE_DSHOT_TELEMETRY
+// Only the F4 standard peripheral driver captures the answers of the ESCs, see pwm_output_dshot.c
+#error "Bidirectional DShot is not implemented for the HAL driver"
+#endif
+
 #include "io.h"
 #include "timer.h"
 #include "pwm_output.h"
@@ -62,19 +67,9 @@ void pwmWriteDigital(uint8_t index, uint16_t value)
         return;
     }
 
-    uint16_t packet = (value << 1) | (motor->requestTelemetry ? 1 : 0);
+    uint16_t packet = prepareDshotPacket(value, motor->requestTelemetry, false);
     motor->requestTelemetry = false;    // reset telemetry request to make sure it's triggered only once in a row
 
-    // compute checksum
-    int csum = 0;
-    int csum_data = packet;
-    for (int i = 0; i < 3; i++) {
-        csum ^=  csum_data;   // xor data by nibbles
-        csum_data >>= 4;
-    }
-    csum &= 0xf;
-    // append checksum
-    packet = (packet << 4) | csum;
     // generate pulses for whole packet
     for (int i = 0; i < 16; i++) {
         motor->dmaBuffer[i] = (packet & 0x8000) ? MOTOR_BIT_1 : MOTOR_BIT_0;  // MSB first
@@ -45,6 +45,7 @@ const char * const ownerNames[OWNER_TOTAL_COUNT] = {
     "SDCARD_CS",
     "SDCARD_DETECT",
     "FLASH_CS",
+    "FLASH",
     "BARO_CS",
     "MPU_CS",
     "OSD_CS",
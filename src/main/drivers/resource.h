@@ -45,6 +45,7 @@ typedef enum {
     OWNER_SDCARD_CS,
     OWNER_SDCARD_DETECT,
     OWNER_FLASH_CS,
+    OWNER_FLASH,
     OWNER_BARO_CS,
     OWNER_MPU_CS,
     OWNER_OSD_CS,
@@ -1125,6 +1125,13 @@ const sdcardMetadata_t* sdcard_getMetadata(void)
     return &sdcard.metadata;
 }
 
+const sdcardVTable_t sdcardVTable = {
+    .poll = sdcard_poll,
+    .readBlock = sdcard_readBlock,
+    .beginWriteBlocks = sdcard_beginWriteBlocks,
+    .writeBlock = sdcard_writeBlock,
+};
+
 #ifdef SDCARD_PROFILING
 
 void sdcard_setProfilerCallback(sdcard_profilerCallback_c callback)
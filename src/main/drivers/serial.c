@@ -20,6 +20,8 @@
 
 #include "platform.h"
 
+#include "common/maths.h"
+
 #include "serial.h"
 
 void serialPrint(serialPort_t *instance, const char *str)
@@ -71,6 +73,30 @@ uint8_t serialRead(serialPort_t *instance)
     return instance->vTable->serialRead(instance);
 }
 
+int serialReadBuf(serialPort_t *instance, uint8_t *data, int count)
+{
+    if (instance->vTable->readBuf) {
+        return instance->vTable->readBuf(instance, data, count);
+    }
+
+    count = MIN(count, (int)serialRxBytesWaiting(instance));
+    for (int i = 0; i < count; i++) {
+        data[i] = serialRead(instance);
+    }
+    return count;
+}
+
+/*
+ * Returns false if the port can't tell where frames end, the receive callback then keeps being called byte by byte.
+ */
+bool serialSetRxFrameCallback(serialPort_t *instance, serialReceiveFrameCallbackPtr callback)
+{
+    if (instance->vTable->setRxFrameCallback) {
+        return instance->vTable->setRxFrameCallback(instance, callback);
+    }
+    return false;
+}
+
 void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate)
 {
     instance->vTable->serialSetBaudRate(instance, baudRate);
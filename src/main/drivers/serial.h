@@ -47,6 +47,7 @@ typedef enum portOptions_t {
 } portOptions_t;
 
 typedef void (*serialReceiveCallbackPtr)(uint16_t data);   // used by serial drivers to return frames to app
+typedef void (*serialReceiveFrameCallbackPtr)(const uint8_t *data, int length);    // the bytes received before the line went idle
 
 typedef struct serialPort_s {
 
@@ -68,6 +69,7 @@ typedef struct serialPort_s {
     uint32_t txBufferTail;
 
     serialReceiveCallbackPtr rxCallback;
+    serialReceiveFrameCallbackPtr rxFrameCallback;
 } serialPort_t;
 
 #if defined(USE_SOFTSERIAL1) || defined(USE_SOFTSERIAL2)
@@ -104,6 +106,11 @@ struct serialPortVTable {
     // Optional functions used to buffer large writes.
     void (*beginWrite)(serialPort_t *instance);
     void (*endWrite)(serialPort_t *instance);
+
+    // Optional, reads up to count bytes that are waiting and returns how many were read.
+    int (*readBuf)(serialPort_t *instance, uint8_t *data, int count);
+    // Optional, replaces the receive callback with one called once per frame, when the line goes idle after it.
+    bool (*setRxFrameCallback)(serialPort_t *instance, serialReceiveFrameCallbackPtr callback);
 };
 
 void serialWrite(serialPort_t *instance, uint8_t ch);
@@ -111,6 +118,8 @@ uint32_t serialRxBytesWaiting(const serialPort_t *instance);
 uint32_t serialTxBytesFree(const serialPort_t *instance);
 void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
 uint8_t serialRead(serialPort_t *instance);
+int serialReadBuf(serialPort_t *instance, uint8_t *data, int count);
+bool serialSetRxFrameCallback(serialPort_t *instance, serialReceiveFrameCallbackPtr callback);
 void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
 void serialSetMode(serialPort_t *instance, portMode_t mode);
 bool isSerialTransmitBufferEmpty(const serialPort_t *instance);
@@ -32,6 +32,7 @@
 
 #include "build/debug.h"
 
+#include "common/maths.h"
 #include "common/utils.h"
 
 #include "nvic.h"
@@ -581,6 +582,20 @@ uint8_t softSerialReadByte(serialPort_t *instance)
     return ch;
 }
 
+static int softSerialReadBuf(serialPort_t *instance, uint8_t *data, int count)
+{
+    count = MIN(count, (int)softSerialRxBytesWaiting(instance));
+
+    uint32_t tail = instance->rxBufferTail;
+    for (int i = 0; i < count; i++) {
+        data[i] = instance->rxBuffer[tail];
+        tail = (tail + 1) % instance->rxBufferSize;
+    }
+    instance->rxBufferTail = tail;
+
+    return count;
+}
+
 void softSerialWriteByte(serialPort_t *s, uint8_t ch)
 {
     if ((s->mode & MODE_TX) == 0) {
@@ -620,7 +635,8 @@ static const struct serialPortVTable softSerialVTable = {
     .setMode = softSerialSetMode,
     .writeBuf = NULL,
     .beginWrite = NULL,
-    .endWrite = NULL
+    .endWrite = NULL,
+    .readBuf = softSerialReadBuf,
 };
 
 #endif
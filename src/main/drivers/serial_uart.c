@@ -27,6 +27,7 @@
 
 #include "build/build_config.h"
 
+#include "common/maths.h"
 #include "common/utils.h"
 #include "gpio.h"
 #include "inverter.h"
@@ -141,11 +142,13 @@ serialPort_t *uartOpen(USART_TypeDef *USARTx, serialReceiveCallbackPtr rxCallbac
     s->port.txBufferHead = s->port.txBufferTail = 0;
     // callback works for IRQ-based RX ONLY
     s->port.rxCallback = rxCallback;
+    s->port.rxFrameCallback = NULL;
     s->port.mode = mode;
     s->port.baudRate = baudRate;
     s->port.options = options;
 
     uartReconfigure(s);
+    USART_ITConfig(s->USARTx, USART_IT_IDLE, DISABLE);
 
     // Receive DMA or IRQ
     DMA_InitTypeDef DMA_InitStructure;
@@ -407,6 +410,72 @@ uint8_t uartRead(serialPort_t *instance)
     return ch;
 }
 
+int uartReadBuf(serialPort_t *instance, uint8_t *data, int count)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+
+    count = MIN(count, (int)uartTotalRxBytesWaiting(instance));
+
+#ifdef STM32F4
+    if (s->rxDMAStream) {
+#else
+    if (s->rxDMAChannel) {
+#endif
+        uint32_t pos = s->rxDMAPos;
+        for (int i = 0; i < count; i++) {
+            data[i] = s->port.rxBuffer[s->port.rxBufferSize - pos];
+            if (--pos == 0) {
+                pos = s->port.rxBufferSize;
+            }
+        }
+        s->rxDMAPos = pos;
+    } else {
+        uint32_t tail = s->port.rxBufferTail;
+        for (int i = 0; i < count; i++) {
+            data[i] = s->port.rxBuffer[tail];
+            if (++tail >= s->port.rxBufferSize) {
+                tail = 0;
+            }
+        }
+        s->port.rxBufferTail = tail;
+    }
+
+    return count;
+}
+
+/*
+ * Received bytes are buffered, by DMA or the receive interrupt, and the idle line interrupt hands them over in one go.
+ * Frame based protocols then need a single callback and timestamp per frame instead of one per byte.
+ */
+bool uartSetRxFrameCallback(serialPort_t *instance, serialReceiveFrameCallbackPtr callback)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+
+    if (!(s->port.mode & MODE_RX)) {
+        return false;
+    }
+
+    USART_ITConfig(s->USARTx, USART_IT_IDLE, DISABLE);
+    s->port.rxFrameCallback = callback;
+    if (callback) {
+        s->port.rxCallback = NULL;
+        USART_ITConfig(s->USARTx, USART_IT_IDLE, ENABLE);
+    }
+
+    return true;
+}
+
+// Called from the USART interrupt handler once the idle line flag has been cleared
+void uartRxFrameIdle(uartPort_t *s)
+{
+    uint8_t frame[UART_RX_FRAME_CHUNK_SIZE];
+    int length;
+
+    while ((length = uartReadBuf(&s->port, frame, sizeof(frame))) > 0) {
+        s->port.rxFrameCallback(frame, length);
+    }
+}
+
 void uartWrite(serialPort_t *instance, uint8_t ch)
 {
     uartPort_t *s = (uartPort_t *)instance;
@@ -442,5 +511,7 @@ const struct serialPortVTable uartVTable[] = {
         .writeBuf = NULL,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .readBuf = uartReadBuf,
+        .setRxFrameCallback = uartSetRxFrameCallback,
     }
 };
@@ -40,6 +40,9 @@
 #define UART8_RX_BUFFER_SIZE    256
 #define UART8_TX_BUFFER_SIZE    256
 
+// Bytes handed to the receive frame callback at a time, large enough for a whole frame of the RX protocols
+#define UART_RX_FRAME_CHUNK_SIZE    64
+
 typedef struct {
     serialPort_t port;
 
@@ -79,5 +82,8 @@ void uartWrite(serialPort_t *instance, uint8_t ch);
 uint32_t uartTotalRxBytesWaiting(const serialPort_t *instance);
 uint32_t uartTotalTxBytesFree(const serialPort_t *instance);
 uint8_t uartRead(serialPort_t *instance);
+int uartReadBuf(serialPort_t *instance, uint8_t *data, int count);
+bool uartSetRxFrameCallback(serialPort_t *instance, serialReceiveFrameCallbackPtr callback);
+void uartRxFrameIdle(uartPort_t *s);
 void uartSetBaudRate(serialPort_t *s, uint32_t baudRate);
 bool isUartTransmitBufferEmpty(const serialPort_t *s);
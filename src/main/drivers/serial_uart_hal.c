@@ -28,6 +28,7 @@
 
 #include "build/build_config.h"
 
+#include "common/maths.h"
 #include "common/utils.h"
 #include "io.h"
 #include "nvic.h"
@@ -359,6 +360,35 @@ uint8_t uartRead(serialPort_t *instance)
     return ch;
 }
 
+int uartReadBuf(serialPort_t *instance, uint8_t *data, int count)
+{
+    uartPort_t *s = (uartPort_t *)instance;
+
+    count = MIN(count, (int)uartTotalRxBytesWaiting(instance));
+
+    if (s->rxDMAStream) {
+        uint32_t pos = s->rxDMAPos;
+        for (int i = 0; i < count; i++) {
+            data[i] = s->port.rxBuffer[s->port.rxBufferSize - pos];
+            if (--pos == 0) {
+                pos = s->port.rxBufferSize;
+            }
+        }
+        s->rxDMAPos = pos;
+    } else {
+        uint32_t tail = s->port.rxBufferTail;
+        for (int i = 0; i < count; i++) {
+            data[i] = s->port.rxBuffer[tail];
+            if (++tail >= s->port.rxBufferSize) {
+                tail = 0;
+            }
+        }
+        s->port.rxBufferTail = tail;
+    }
+
+    return count;
+}
+
 void uartWrite(serialPort_t *instance, uint8_t ch)
 {
     uartPort_t *s = (uartPort_t *)instance;
@@ -389,5 +419,6 @@ const struct serialPortVTable uartVTable[] = {
         .writeBuf = NULL,
         .beginWrite = NULL,
         .endWrite = NULL,
+        .readBuf = uartReadBuf,
     }
 };
@@ -74,6 +74,11 @@ void uartIrqCallback(uartPort_t *s)
             USART_ITConfig(s->USARTx, USART_IT_TXE, DISABLE);
         }
     }
+    if ((SR & USART_FLAG_IDLE) && s->port.rxFrameCallback) {
+        // reading SR then DR clears the flag
+        (void)s->USARTx->DR;
+        uartRxFrameIdle(s);
+    }
 }
 
 // USART1 Tx DMA Handler
@@ -408,6 +408,11 @@ void usartIrqHandler(uartPort_t *s)
     {
         USART_ClearITPendingBit (s->USARTx, USART_IT_ORE);
     }
+
+    if ((ISR & USART_FLAG_IDLE) && s->port.rxFrameCallback) {
+        USART_ClearITPendingBit(s->USARTx, USART_IT_IDLE);
+        uartRxFrameIdle(s);
+    }
 }
 
 #ifdef USE_UART1
@@ -243,6 +243,14 @@ void uartIrqHandler(uartPort_t *s)
     {
         USART_ClearITPendingBit (s->USARTx, USART_IT_ORE);
     }
+
+    if (USART_GetITStatus(s->USARTx, USART_IT_IDLE) == SET) {
+        // reading SR then DR clears the flag
+        (void)s->USARTx->DR;
+        if (s->port.rxFrameCallback) {
+            uartRxFrameIdle(s);
+        }
+    }
 }
 
 static void handleUsartTxDma(uartPort_t *s)
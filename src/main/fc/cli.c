@@ -37,6 +37,7 @@ extern uint8_t __config_end;
 
 #include "build/build_config.h"
 #include "build/debug.h"
+#include "build/profile.h"
 #include "build/version.h"
 
 #include "cms/cms.h"
@@ -113,6 +114,7 @@ extern uint8_t __config_end;
 #include "sensors/boardalignment.h"
 #include "sensors/compass.h"
 #include "sensors/gyro.h"
+#include "sensors/gyroanalyse.h"
 #include "sensors/sensors.h"
 
 #include "telemetry/frsky.h"
@@ -126,6 +128,9 @@ static uint8_t cliWriteBuffer[sizeof(*cliWriter) + 128];
 static char cliBuffer[64];
 static uint32_t bufferIndex = 0;
 
+// Bytes read from the port at a time, pasted configurations arrive faster than they are echoed
+#define CLI_RX_CHUNK_SIZE 32
+
 static const char* const emptyName = "-";
 
 #ifndef USE_QUAD_MIXER_ONLY
@@ -325,7 +330,11 @@ static const char * const lookupTableDebug[DEBUG_COUNT] = {
     "SCHEDULER",
     "STACK",
     "ESC_SENSOR_RPM",
-    "ESC_SENSOR_TMP"
+    "ESC_SENSOR_TMP",
+    "FFT",
+    "DYN_NOTCH",
+    "GYRO_TO_MOTOR",
+    "DSHOT_RPM_TELEMETRY"
 };
 
 #ifdef OSD
@@ -348,13 +357,21 @@ static const char * const lookupTablePwmProtocol[] = {
 };
 
 static const char * const lookupTableRcInterpolation[] = {
-    "OFF", "PRESET", "AUTO", "MANUAL"
+    "OFF", "PRESET", "AUTO", "MANUAL", "FILTER"
 };
 
 static const char * const lookupTableRcInterpolationChannels[] = {
     "RP", "RPY", "RPYT"
 };
 
+static const char * const lookupTableRatesType[] = {
+    "BETAFLIGHT", "ACTUAL"
+};
+
+static const char * const lookupTableRcSmoothingFilter[] = {
+    "PT1", "BIQUAD"
+};
+
 static const char * const lookupTableLowpassType[] = {
     "PT1", "BIQUAD", "FIR"
 };
@@ -403,6 +420,8 @@ typedef enum {
     TABLE_MOTOR_PWM_PROTOCOL,
     TABLE_RC_INTERPOLATION,
     TABLE_RC_INTERPOLATION_CHANNELS,
+    TABLE_RC_SMOOTHING_FILTER,
+    TABLE_RATES_TYPE,
     TABLE_LOWPASS_TYPE,
     TABLE_FAILSAFE,
 #ifdef OSD
@@ -446,6 +465,8 @@ static const lookupTableEntry_t lookupTables[] = {
     { lookupTablePwmProtocol, sizeof(lookupTablePwmProtocol) / sizeof(char *) },
     { lookupTableRcInterpolation, sizeof(lookupTableRcInterpolation) / sizeof(char *) },
     { lookupTableRcInterpolationChannels, sizeof(lookupTableRcInterpolationChannels) / sizeof(char *) },
+    { lookupTableRcSmoothingFilter, sizeof(lookupTableRcSmoothingFilter) / sizeof(char *) },
+    { lookupTableRatesType, sizeof(lookupTableRatesType) / sizeof(char *) },
     { lookupTableLowpassType, sizeof(lookupTableLowpassType) / sizeof(char *) },
     { lookupTableFailsafe, sizeof(lookupTableFailsafe) / sizeof(char *) },
 #ifdef OSD
@@ -513,6 +534,11 @@ static const clivalue_t valueTable[] = {
     { "gyro_notch1_cutoff",         VAR_UINT16 | MASTER_VALUE, .config.minmax = { 1, 16000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_soft_notch_cutoff_1) },
     { "gyro_notch2_hz",             VAR_UINT16 | MASTER_VALUE, .config.minmax = { 0, 16000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_soft_notch_hz_2) },
     { "gyro_notch2_cutoff",         VAR_UINT16 | MASTER_VALUE, .config.minmax = { 1, 16000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_soft_notch_cutoff_2) },
+#ifdef USE_GYRO_DATA_ANALYSE
+    { "gyro_dyn_notch",             VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_dyn_notch) },
+    { "gyro_dyn_notch_q",           VAR_UINT16 | MASTER_VALUE, .config.minmax = { 50, 1000 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_dyn_notch_q) },
+    { "gyro_dyn_notch_min_hz",      VAR_UINT16 | MASTER_VALUE, .config.minmax = { FFT_MIN_FREQ, FFT_SAMPLING_RATE / 2 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyro_dyn_notch_min_hz) },
+#endif
     { "moron_threshold",            VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0,  200 }, PG_GYRO_CONFIG, offsetof(gyroConfig_t, gyroMovementCalibrationThreshold) },
 #if defined(GYRO_USES_SPI)
 #if defined(USE_GYRO_SPI_MPU6500) || defined(USE_GYRO_SPI_MPU9250) || defined(USE_GYRO_SPI_ICM20689)
@@ -562,6 +588,8 @@ static const clivalue_t valueTable[] = {
     { "rc_interp",                  VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RC_INTERPOLATION }, PG_RX_CONFIG, offsetof(rxConfig_t, rcInterpolation) },
     { "rc_interp_ch",               VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RC_INTERPOLATION_CHANNELS }, PG_RX_CONFIG, offsetof(rxConfig_t, rcInterpolationChannels) },
     { "rc_interp_int",              VAR_UINT8  | MASTER_VALUE, .config.minmax = { 1, 50 }, PG_RX_CONFIG, offsetof(rxConfig_t, rcInterpolationInterval) },
+    { "rc_smoothing_filter",        VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RC_SMOOTHING_FILTER }, PG_RX_CONFIG, offsetof(rxConfig_t, rcSmoothingFilterType) },
+    { "rc_smoothing_hz",            VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, 255 }, PG_RX_CONFIG, offsetof(rxConfig_t, rcSmoothingCutoffHz) },
     { "fpv_mix_degrees",            VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, 50 }, PG_RX_CONFIG, offsetof(rxConfig_t, fpvCamAngleDegrees) },
     { "max_aux_channels",           VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0, MAX_AUX_CHANNEL_COUNT }, PG_RX_CONFIG, offsetof(rxConfig_t, max_aux_channel) },
 #ifdef SERIAL_RX
@@ -603,6 +631,10 @@ static const clivalue_t valueTable[] = {
     { "motor_pwm_protocol",         VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MOTOR_PWM_PROTOCOL }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, dev.motorPwmProtocol) },
     { "motor_pwm_rate",             VAR_UINT16 | MASTER_VALUE, .config.minmax = { 200, 32000 }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, dev.motorPwmRate) },
     { "motor_pwm_inversion",        VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, dev.motorPwmInversion) },
+#ifdef USE_DSHOT_TELEMETRY
+    { "dshot_bidir",                VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, dev.useDshotTelemetry) },
+    { "motor_poles",                VAR_UINT8  | MASTER_VALUE, .config.minmax = { 2, UINT8_MAX }, PG_MOTOR_CONFIG, offsetof(motorConfig_t, motorPoleCount) },
+#endif
 
 // PG_THROTTLE_CORRECTION_CONFIG
     { "thr_corr_value",             VAR_UINT8  | MASTER_VALUE, .config.minmax = { 0,  150 }, PG_THROTTLE_CORRECTION_CONFIG, offsetof(throttleCorrectionConfig_t, throttle_correction_value) },
@@ -685,6 +717,7 @@ static const clivalue_t valueTable[] = {
     { "yaw_srate",                  VAR_UINT8  | PROFILE_RATE_VALUE, .config.minmax = { 0, CONTROL_RATE_CONFIG_YAW_RATE_MAX }, PG_CONTROL_RATE_PROFILES, offsetof(controlRateConfig_t, rates[FD_YAW]) },
     { "tpa_rate",                   VAR_UINT8  | PROFILE_RATE_VALUE, .config.minmax = { 0, CONTROL_RATE_CONFIG_TPA_MAX}, PG_CONTROL_RATE_PROFILES, offsetof(controlRateConfig_t, dynThrPID) },
     { "tpa_breakpoint",             VAR_UINT16 | PROFILE_RATE_VALUE, .config.minmax = { PWM_RANGE_MIN,  PWM_RANGE_MAX}, PG_CONTROL_RATE_PROFILES, offsetof(controlRateConfig_t, tpa_breakpoint) },
+    { "rates_type",                 VAR_UINT8  | PROFILE_RATE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RATES_TYPE }, PG_CONTROL_RATE_PROFILES, offsetof(controlRateConfig_t, ratesType) },
 
 // PG_SERIAL_CONFIG
     { "reboot_character",           VAR_UINT8  | MASTER_VALUE, .config.minmax = { 48, 126 }, PG_SERIAL_CONFIG, offsetof(serialConfig_t, reboot_character) },
@@ -733,6 +766,9 @@ static const clivalue_t valueTable[] = {
 
 // PG_PID_CONFIG
     { "pid_process_denom",          VAR_UINT8  | MASTER_VALUE,  .config.minmax = { 1, MAX_PID_PROCESS_DENOM }, PG_PID_CONFIG, offsetof(pidConfig_t, pid_process_denom) },
+#if defined(GYRO_USES_SPI) && defined(USE_MPU_DATA_READY_SIGNAL)
+    { "pid_in_gyro_isr",            VAR_UINT8  | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, PG_PID_CONFIG, offsetof(pidConfig_t, pid_in_gyro_isr) },
+#endif
 
 // PG_PID_PROFILE
     { "d_lowpass_type",             VAR_UINT8  | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LOWPASS_TYPE }, PG_PID_PROFILE, offsetof(pidProfile_t, dterm_filter_type) },
@@ -1590,6 +1626,166 @@ static void cliSetVar(const clivalue_t *var, const int_float_value_t value)
     }
 }
 
+static uint8_t valueSize(const clivalue_t *var)
+{
+    switch (var->type & VALUE_TYPE_MASK) {
+    case VAR_UINT8:
+    case VAR_INT8:
+        return sizeof(uint8_t);
+    case VAR_UINT16:
+    case VAR_INT16:
+        return sizeof(uint16_t);
+    case VAR_FLOAT:
+        return sizeof(float);
+    }
+    return 0;
+}
+
+// Compares `length` characters of `name` with the name of a setting, the same way strcasecmp() does
+static int valueNameCompare(const char *name, int length, const clivalue_t *var)
+{
+    const int result = strncasecmp(name, var->name, length);
+    if (result == 0 && var->name[length] != '\0') {
+        return -1;
+    }
+    return result;
+}
+
+#ifdef USE_CLI_SETTING_NAME_INDEX
+/*
+ * Indices of valueTable sorted by name, ignoring case, so that settings can be found by a binary search. Built by
+ * cliInit(), lookups can arrive over MSP while armed.
+ */
+static uint16_t valueNameIndex[ARRAYLEN(valueTable)];
+
+static void buildValueNameIndex(void)
+{
+    for (uint32_t i = 0; i < ARRAYLEN(valueTable); i++) {
+        const clivalue_t *var = &valueTable[i];
+        const int length = strlen(var->name);
+        uint32_t j = i;
+        // the table is grouped by feature rather than by name, so this moves most entries a long way
+        while (j > 0 && valueNameCompare(var->name, length, &valueTable[valueNameIndex[j - 1]]) < 0) {
+            valueNameIndex[j] = valueNameIndex[j - 1];
+            j--;
+        }
+        valueNameIndex[j] = i;
+    }
+}
+#endif
+
+int cliSettingCount(void)
+{
+    return ARRAYLEN(valueTable);
+}
+
+int cliSettingFind(const char *name, int length)
+{
+#ifdef USE_CLI_SETTING_NAME_INDEX
+    int low = 0;
+    int high = ARRAYLEN(valueTable) - 1;
+    while (low <= high) {
+        const int middle = (low + high) / 2;
+        const int result = valueNameCompare(name, length, &valueTable[valueNameIndex[middle]]);
+        if (result == 0) {
+            return valueNameIndex[middle];
+        } else if (result < 0) {
+            high = middle - 1;
+        } else {
+            low = middle + 1;
+        }
+    }
+#else
+    for (uint32_t i = 0; i < ARRAYLEN(valueTable); i++) {
+        if (valueNameCompare(name, length, &valueTable[i]) == 0) {
+            return i;
+        }
+    }
+#endif
+    return CLI_SETTING_NOT_FOUND;
+}
+
+bool cliSettingGetInfo(int index, cliSettingInfo_t *info)
+{
+    if (index < 0 || index >= (int)ARRAYLEN(valueTable)) {
+        return false;
+    }
+    const clivalue_t *var = &valueTable[index];
+
+    info->name = var->name;
+    info->type = var->type;
+    info->size = valueSize(var);
+    if ((var->type & VALUE_MODE_MASK) == MODE_LOOKUP) {
+        info->min = 0;
+        info->max = lookupTables[var->config.lookup.tableIndex].valueCount - 1;
+    } else {
+        info->min = var->config.minmax.min;
+        info->max = var->config.minmax.max;
+    }
+    return true;
+}
+
+uint32_t cliSettingGetValue(int index)
+{
+    const clivalue_t *var = &valueTable[index];
+    const void *ptr = getValuePointer(var);
+
+    switch (var->type & VALUE_TYPE_MASK) {
+    case VAR_UINT8:
+    case VAR_INT8:
+        return *(uint8_t *)ptr;
+    case VAR_UINT16:
+    case VAR_INT16:
+        return *(uint16_t *)ptr;
+    case VAR_FLOAT: {
+        uint32_t value;
+        memcpy(&value, ptr, sizeof(value));
+        return value;
+    }
+    }
+    return 0;
+}
+
+bool cliSettingSetValue(int index, uint32_t value)
+{
+    const clivalue_t *var = &valueTable[index];
+    cliSettingInfo_t info;
+    cliSettingGetInfo(index, &info);
+
+    int_float_value_t tmp;
+    float rangeValue;
+    switch (var->type & VALUE_TYPE_MASK) {
+    case VAR_UINT8:
+        tmp.int_value = (uint8_t)value;
+        rangeValue = tmp.int_value;
+        break;
+    case VAR_INT8:
+        tmp.int_value = (int8_t)value;
+        rangeValue = tmp.int_value;
+        break;
+    case VAR_UINT16:
+        tmp.int_value = (uint16_t)value;
+        rangeValue = tmp.int_value;
+        break;
+    case VAR_INT16:
+        tmp.int_value = (int16_t)value;
+        rangeValue = tmp.int_value;
+        break;
+    case VAR_FLOAT:
+        memcpy(&tmp.float_value, &value, sizeof(float));
+        rangeValue = tmp.float_value;
+        break;
+    default:
+        return false;
+    }
+    if (!(rangeValue >= info.min && rangeValue <= info.max)) {
+        return false;
+    }
+
+    cliSetVar(var, tmp);
+    return true;
+}
+
 #ifndef MINIMAL_CLI
 static void cliRepeat(char ch, uint8_t len)
 {
@@ -2831,7 +3027,7 @@ static void cliFlashInfo(char *cmdline)
     UNUSED(cmdline);
 
     cliPrintf("Flash sectors=%u, sectorSize=%u, pagesPerSector=%u, pageSize=%u, totalSize=%u, usedSize=%u\r\n",
-            layout->sectors, layout->sectorSize, layout->pagesPerSector, layout->pageSize, layout->totalSize, flashfsGetOffset());
+            layout->sectors, layout->sectorSize, layout->pagesPerSector, layout->pageSize, layout->totalSize, flashfsGetUsedSize());
 }
 
 
@@ -3706,59 +3902,58 @@ static void cliSet(char *cmdline)
             eqptr++;
         }
 
-        for (uint32_t i = 0; i < ARRAYLEN(valueTable); i++) {
+        // an exact match, to prevent setting variables with shorter names
+        const int i = cliSettingFind(cmdline, variableNameLength);
+        if (i != CLI_SETTING_NOT_FOUND) {
             val = &valueTable[i];
-            // ensure exact match when setting to prevent setting variables with shorter names
-            if (strncasecmp(cmdline, valueTable[i].name, strlen(valueTable[i].name)) == 0 && variableNameLength == strlen(valueTable[i].name)) {
 
-                bool changeValue = false;
-                int_float_value_t tmp = { 0 };
-                switch (valueTable[i].type & VALUE_MODE_MASK) {
-                    case MODE_DIRECT: {
-                            int32_t value = 0;
-                            float valuef = 0;
+            bool changeValue = false;
+            int_float_value_t tmp = { 0 };
+            switch (valueTable[i].type & VALUE_MODE_MASK) {
+                case MODE_DIRECT: {
+                        int32_t value = 0;
+                        float valuef = 0;
 
-                            value = atoi(eqptr);
-                            valuef = fastA2F(eqptr);
+                        value = atoi(eqptr);
+                        valuef = fastA2F(eqptr);
 
-                            if (valuef >= valueTable[i].config.minmax.min && valuef <= valueTable[i].config.minmax.max) { // note: compare float value
+                        if (valuef >= valueTable[i].config.minmax.min && valuef <= valueTable[i].config.minmax.max) { // note: compare float value
 
-                                if ((valueTable[i].type & VALUE_TYPE_MASK) == VAR_FLOAT)
-                                    tmp.float_value = valuef;
-                                else
-                                    tmp.int_value = value;
+                            if ((valueTable[i].type & VALUE_TYPE_MASK) == VAR_FLOAT)
+                                tmp.float_value = valuef;
+                            else
+                                tmp.int_value = value;
 
-                                changeValue = true;
-                            }
+                            changeValue = true;
                         }
-                        break;
-                    case MODE_LOOKUP: {
-                            const lookupTableEntry_t *tableEntry = &lookupTables[valueTable[i].config.lookup.tableIndex];
-                            bool matched = false;
-                            for (uint32_t tableValueIndex = 0; tableValueIndex < tableEntry->valueCount && !matched; tableValueIndex++) {
-                                matched = strcasecmp(tableEntry->values[tableValueIndex], eqptr) == 0;
-
-                                if (matched) {
-                                    tmp.int_value = tableValueIndex;
-                                    changeValue = true;
-                                }
+                    }
+                    break;
+                case MODE_LOOKUP: {
+                        const lookupTableEntry_t *tableEntry = &lookupTables[valueTable[i].config.lookup.tableIndex];
+                        bool matched = false;
+                        for (uint32_t tableValueIndex = 0; tableValueIndex < tableEntry->valueCount && !matched; tableValueIndex++) {
+                            matched = strcasecmp(tableEntry->values[tableValueIndex], eqptr) == 0;
+
+                            if (matched) {
+                                tmp.int_value = tableValueIndex;
+                                changeValue = true;
                             }
                         }
-                        break;
-                }
-
-                if (changeValue) {
-                    cliSetVar(val, tmp);
+                    }
+                    break;
+            }
 
-                    cliPrintf("%s set to ", valueTable[i].name);
-                    cliPrintVar(val, 0);
-                } else {
-                    cliPrint("Invalid value\r\n");
-                    cliPrintVarRange(val);
-                }
+            if (changeValue) {
+                cliSetVar(val, tmp);
 
-                return;
+                cliPrintf("%s set to ", valueTable[i].name);
+                cliPrintVar(val, 0);
+            } else {
+                cliPrint("Invalid value\r\n");
+                cliPrintVarRange(val);
             }
+
+            return;
         }
         cliPrint("Invalid name\r\n");
     } else {
@@ -3825,9 +4020,50 @@ static void cliStatus(char *cmdline)
 }
 
 #ifndef SKIP_TASK_STATISTICS
+#ifdef USE_SCHEDULER_TRACE
+static void cliTasksHistogramRow(const char *name, const uint16_t *histogram)
+{
+    cliPrintf("%s", name);
+    for (int i = 0; i < SCHEDULER_HISTOGRAM_BUCKETS; i++) {
+        cliPrintf("%6d", histogram[i]);
+    }
+    cliPrintf("\r\n");
+}
+
+static void cliTasksHistogram(void)
+{
+    cliPrintf("Task histograms        from us");
+    for (int i = 0; i < SCHEDULER_HISTOGRAM_BUCKETS; i++) {
+        const int bucketStartUs = i == 0 ? 0 : 1 << (i - 1);
+        if (bucketStartUs < 1000) {
+            cliPrintf("%6d", bucketStartUs);
+        } else {
+            cliPrintf("%5dk", bucketStartUs / 1000);
+        }
+    }
+    cliPrintf("\r\n");
+    for (cfTaskId_e taskId = 0; taskId < TASK_COUNT; taskId++) {
+        cfTaskInfo_t taskInfo;
+        getTaskInfo(taskId, &taskInfo);
+        if (taskInfo.isEnabled) {
+            cliPrintf("%02d - (%15s) ", taskId, taskInfo.taskName);
+            cliTasksHistogramRow("late   ", getTaskLatenessHistogram(taskId));
+            cliTasksHistogramRow("                       exec   ", getTaskExecutionHistogram(taskId));
+        }
+    }
+}
+#endif
+
 static void cliTasks(char *cmdline)
 {
+#ifdef USE_SCHEDULER_TRACE
+    if (strncasecmp(cmdline, "histo", 5) == 0) {
+        cliTasksHistogram();
+        return;
+    }
+#else
     UNUSED(cmdline);
+#endif
     int maxLoadSum = 0;
     int averageLoadSum = 0;
 
@@ -3884,6 +4120,35 @@ static void cliTasks(char *cmdline)
 }
 #endif
 
+#ifdef USE_PROFILE
+static void cliPerf(char *cmdline)
+{
+    if (strncasecmp(cmdline, "reset", 5) == 0) {
+        profileReset();
+        cliPrintf("Probes reset\r\n");
+        return;
+    }
+
+    const uint32_t ticksPerUs = PROFILE_TICKS_PER_US;
+    cliPrintf("Probe                  count  avg/us  max/us  total/ms\r\n");
+    for (int probe = 0; probe < PROFILE_PROBE_COUNT; probe++) {
+        const profileProbe_t *p = &profileProbes[probe];
+        if (p->count == 0) {
+            continue;
+        }
+        const char *name = profileProbeName(probe);
+        if (name) {
+            cliPrintf("%17s", name);
+        } else {
+            cliPrintf("%02d - (%10s)", probe - PROFILE_TASK_FIRST, cfTasks[probe - PROFILE_TASK_FIRST].taskName);
+        }
+        const uint32_t averageTenthsUs = p->totalTicks * 10 / p->count / ticksPerUs;
+        cliPrintf("%10d %5d.%1d %7d %9d\r\n", p->count, averageTenthsUs / 10, averageTenthsUs % 10,
+            p->maxTicks / ticksPerUs, (uint32_t)(p->totalTicks / ticksPerUs / 1000));
+    }
+}
+#endif
+
 static void cliVersion(char *cmdline)
 {
     UNUSED(cmdline);
@@ -4433,6 +4698,9 @@ const clicmd_t cmdTable[] = {
 #endif
     CLI_COMMAND_DEF("motor",  "get/set motor", "<index> [<value>]", cliMotor),
     CLI_COMMAND_DEF("name", "name of craft", NULL, cliName),
+#ifdef USE_PROFILE
+    CLI_COMMAND_DEF("perf", "show execution time probes", "[reset]", cliPerf),
+#endif
 #ifndef MINIMAL_CLI
     CLI_COMMAND_DEF("play_sound", NULL, "[<index>]", cliPlaySound),
 #endif
@@ -4463,7 +4731,11 @@ const clicmd_t cmdTable[] = {
 #endif
     CLI_COMMAND_DEF("status", "show status", NULL, cliStatus),
 #ifndef SKIP_TASK_STATISTICS
+#ifdef USE_SCHEDULER_TRACE
+    CLI_COMMAND_DEF("tasks", "show task stats", "[histo]", cliTasks),
+#else
     CLI_COMMAND_DEF("tasks", "show task stats", NULL, cliTasks),
+#endif
 #endif
     CLI_COMMAND_DEF("version", "show version", NULL, cliVersion),
 #ifdef VTX
@@ -4497,8 +4769,18 @@ void cliProcess(void)
     // Be a little bit tricky.  Flush the last inputs buffer, if any.
     bufWriterFlush(cliWriter);
 
-    while (serialRxBytesWaiting(cliPort)) {
-        uint8_t c = serialRead(cliPort);
+    uint8_t rxBuf[CLI_RX_CHUNK_SIZE];
+    int rxCount = 0;
+    int rxIndex = 0;
+    while (true) {
+        if (rxIndex == rxCount) {
+            rxCount = serialReadBuf(cliPort, rxBuf, sizeof(rxBuf));
+            rxIndex = 0;
+            if (rxCount == 0) {
+                break;
+            }
+        }
+        uint8_t c = rxBuf[rxIndex++];
         if (c == '\t' || c == '?') {
             // do tab completion
             const clicmd_t *cmd, *pstart = NULL, *pend = NULL;
@@ -4621,5 +4903,8 @@ void cliInit(const serialConfig_t *serialConfig)
 {
     UNUSED(serialConfig);
     BUILD_BUG_ON(LOOKUP_TABLE_COUNT != ARRAYLEN(lookupTables));
+#ifdef USE_CLI_SETTING_NAME_INDEX
+    buildValueNameIndex();
+#endif
 }
 #endif // USE_CLI
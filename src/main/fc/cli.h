@@ -24,3 +24,23 @@ void cliInit(const struct serialConfig_s *serialConfig);
 void cliProcess(void);
 struct serialPort_s;
 void cliEnter(struct serialPort_s *serialPort);
+
+/*
+ * The settings of the CLI `set` command by index, for binary access over MSP. Values are read and written in the
+ * parameter group storage, profile settings in the current profile.
+ */
+#define CLI_SETTING_NOT_FOUND -1
+
+typedef struct cliSettingInfo_s {
+    const char *name;
+    uint8_t type;       // value type in bits 0-3, section in bits 4-5, mode (0 direct, 1 lookup) in bits 6-7
+    uint8_t size;       // bytes of the value, 1, 2 or 4 for floats
+    int16_t min;        // allowed range, for lookup values the range of the table index
+    int16_t max;
+} cliSettingInfo_t;
+
+int cliSettingCount(void);
+int cliSettingFind(const char *name, int length);
+bool cliSettingGetInfo(int index, cliSettingInfo_t *info);
+uint32_t cliSettingGetValue(int index);
+bool cliSettingSetValue(int index, uint32_t value);
@@ -810,7 +810,7 @@ void resetConfigs(void)
 
 void activateConfig(void)
 {
-    generateThrottleCurve();
+    generateRcCurves();
 
     resetAdjustmentStates();
 
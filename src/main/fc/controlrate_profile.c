@@ -34,7 +34,7 @@
 controlRateConfig_t *currentControlRateProfile;
 
 
-PG_REGISTER_ARRAY_WITH_RESET_FN(controlRateConfig_t, CONTROL_RATE_PROFILE_COUNT, controlRateProfiles, PG_CONTROL_RATE_PROFILES, 0);
+PG_REGISTER_ARRAY_WITH_RESET_FN(controlRateConfig_t, CONTROL_RATE_PROFILE_COUNT, controlRateProfiles, PG_CONTROL_RATE_PROFILES, 1);
 
 void pgResetFn_controlRateProfiles(controlRateConfig_t *controlRateConfig)
 {
@@ -50,7 +50,8 @@ void pgResetFn_controlRateProfiles(controlRateConfig_t *controlRateConfig)
             .tpa_breakpoint = 1650,
             .rates[FD_ROLL] = 70,
             .rates[FD_PITCH] = 70,
-            .rates[FD_YAW] = 70
+            .rates[FD_YAW] = 70,
+            .ratesType = RATES_TYPE_BETAFLIGHT
         );
     }
 }
@@ -69,5 +70,5 @@ void changeControlRateProfile(uint8_t controlRateProfileIndex)
         controlRateProfileIndex = CONTROL_RATE_PROFILE_COUNT - 1;
     }
     setControlRateProfile(controlRateProfileIndex);
-    generateThrottleCurve();
+    generateRcCurves();
 }
@@ -22,6 +22,11 @@
 #include "config/parameter_group.h"
 
 
+typedef enum {
+    RATES_TYPE_BETAFLIGHT = 0,
+    RATES_TYPE_ACTUAL
+} ratesType_e;
+
 typedef struct controlRateConfig_s {
     uint8_t rcRate8;
     uint8_t rcYawRate8;
@@ -32,6 +37,7 @@ typedef struct controlRateConfig_s {
     uint8_t dynThrPID;
     uint8_t rcYawExpo8;
     uint16_t tpa_breakpoint;                // Breakpoint where TPA is activated
+    uint8_t ratesType;                      // model the setpoint rate curves are built with
 } controlRateConfig_t;
 
 #define CONTROL_RATE_PROFILE_COUNT  3
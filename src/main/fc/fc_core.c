@@ -21,6 +21,7 @@
 #include "platform.h"
 
 #include "build/debug.h"
+#include "build/profile.h"
 
 #include "blackbox/blackbox.h"
 
@@ -34,6 +35,7 @@
 #include "config/parameter_group.h"
 #include "config/parameter_group_ids.h"
 
+#include "drivers/accgyro_mpu.h"
 #include "drivers/light_led.h"
 #include "drivers/system.h"
 #include "drivers/gyro_sync.h"
@@ -477,17 +479,16 @@ void processRx(timeUs_t currentTimeUs)
 
 static void subTaskPidController(void)
 {
-    uint32_t startTime;
-    if (debugMode == DEBUG_PIDLOOP) {startTime = micros();}
+    const profileTicks_t startTicks = profileTicks();
     // PID - note this is function pointer set by setPIDController()
     pidController(currentPidProfile, &accelerometerConfig()->accelerometerTrims);
-    DEBUG_SET(DEBUG_PIDLOOP, 1, micros() - startTime);
+    const profileTicks_t pidTicks = profileRecord(PROFILE_PID_CONTROLLER, startTicks);
+    DEBUG_SET(DEBUG_PIDLOOP, 1, profileTicksToUs(pidTicks));
 }
 
 static void subTaskMainSubprocesses(timeUs_t currentTimeUs)
 {
-    uint32_t startTime;
-    if (debugMode == DEBUG_PIDLOOP) {startTime = micros();}
+    const profileTicks_t startTicks = profileTicks();
 
     // Read out gyro temperature if used for telemmetry
     if (feature(FEATURE_TELEMETRY)) {
@@ -510,6 +511,9 @@ static void subTaskMainSubprocesses(timeUs_t currentTimeUs)
     }
 #endif
 
+    // With pid_in_gyro_isr the PID loop and mixer must only see the setpoints and throttle once they are complete
+    const uint8_t gyroIsrHeld = gyroIsrHold();
+
     // If we're armed, at minimum throttle, and we do arming via the
     // sticks, do not process yaw input from the rx.  We do this so the
     // motors do not spin up while we are trying to arm or disarm.
@@ -532,6 +536,8 @@ static void subTaskMainSubprocesses(timeUs_t currentTimeUs)
 
     processRcCommand();
 
+    gyroIsrRelease(gyroIsrHeld);
+
 #ifdef GPS
     if (sensors(SENSOR_GPS)) {
         if ((FLIGHT_MODE(GPS_HOME_MODE) || FLIGHT_MODE(GPS_HOLD_MODE)) && STATE(GPS_FIX_HOME)) {
@@ -546,7 +552,9 @@ static void subTaskMainSubprocesses(timeUs_t currentTimeUs)
 
 #ifdef BLACKBOX
     if (!cliMode && blackboxConfig()->device) {
+        const profileTicks_t blackboxStartTicks = profileTicks();
         handleBlackbox(currentTimeUs);
+        profileRecord(PROFILE_HANDLE_BLACKBOX, blackboxStartTicks);
     }
 #else
     UNUSED(currentTimeUs);
@@ -555,24 +563,23 @@ static void subTaskMainSubprocesses(timeUs_t currentTimeUs)
 #ifdef TRANSPONDER
     transponderUpdate(currentTimeUs);
 #endif
-    DEBUG_SET(DEBUG_PIDLOOP, 2, micros() - startTime);
+    DEBUG_SET(DEBUG_PIDLOOP, 2, profileTicksToUs(profileTicks() - startTicks));
 }
 
 static void subTaskMotorUpdate(void)
 {
-    uint32_t startTime;
     if (debugMode == DEBUG_CYCLETIME) {
-        startTime = micros();
+        const uint32_t startTime = micros();
         static uint32_t previousMotorUpdateTime;
         const uint32_t currentDeltaTime = startTime - previousMotorUpdateTime;
         debug[2] = currentDeltaTime;
         debug[3] = currentDeltaTime - targetPidLooptime;
         previousMotorUpdateTime = startTime;
-    } else if (debugMode == DEBUG_PIDLOOP) {
-        startTime = micros();
     }
 
+    const profileTicks_t startTicks = profileTicks();
     mixTable(currentPidProfile);
+    profileRecord(PROFILE_MIX_TABLE, startTicks);
 
 #ifdef USE_SERVOS
     // motor outputs are used as sources for servo mixing, so motors must be calculated using mixTable() before servos.
@@ -584,7 +591,7 @@ static void subTaskMotorUpdate(void)
     if (motorControlEnable) {
         writeMotors();
     }
-    DEBUG_SET(DEBUG_PIDLOOP, 3, micros() - startTime);
+    DEBUG_SET(DEBUG_PIDLOOP, 3, profileTicksToUs(profileTicks() - startTicks));
 }
 
 uint8_t setPidUpdateCountDown(void)
@@ -596,12 +603,87 @@ uint8_t setPidUpdateCountDown(void)
     }
 }
 
+// DEBUG_GYRO_TO_MOTOR:
+// 0 - time from gyro data ready to motor update complete
+// 1 - maximum of 0 over the last second
+// 2 - time between gyro data ready interrupts
+// 3 - time from gyro data ready to start of pidController()
+static void debugGyroToMotorLatency(timeUs_t pidStartTimeUs)
+{
+    static timeUs_t previousDataReadyAtUs;
+    static timeUs_t maxLatencyResetAtUs;
+    static timeDelta_t maxLatencyUs;
+
+    const timeUs_t currentTimeUs = micros();
+    const timeUs_t dataReadyAtUs = gyroDataReadyAtUs();
+    const timeDelta_t latencyUs = cmpTimeUs(currentTimeUs, dataReadyAtUs);
+
+    if (cmpTimeUs(currentTimeUs, maxLatencyResetAtUs) >= 0) {
+        maxLatencyResetAtUs = currentTimeUs + 1000000;
+        maxLatencyUs = 0;
+    }
+    maxLatencyUs = MAX(maxLatencyUs, latencyUs);
+
+    debug[0] = latencyUs;
+    debug[1] = maxLatencyUs;
+    debug[2] = cmpTimeUs(dataReadyAtUs, previousDataReadyAtUs);
+    debug[3] = cmpTimeUs(pidStartTimeUs, dataReadyAtUs);
+    previousDataReadyAtUs = dataReadyAtUs;
+}
+
+static void subTaskPidAndMotorUpdate(void)
+{
+    timeUs_t pidStartTimeUs = 0;
+    if (debugMode == DEBUG_GYRO_TO_MOTOR) {
+        pidStartTimeUs = micros();
+    }
+
+    subTaskPidController();
+    subTaskMotorUpdate();
+
+    if (debugMode == DEBUG_GYRO_TO_MOTOR) {
+        debugGyroToMotorLatency(pidStartTimeUs);
+    }
+}
+
+static volatile bool runTaskMainSubprocesses;
+static uint8_t pidUpdateCountdown;
+
+#if defined(GYRO_USES_SPI) && defined(USE_MPU_DATA_READY_SIGNAL)
+static bool pidLoopInGyroIsr;
+
+/*
+ * Called from the gyro data ready interrupt with pid_in_gyro_isr set, so that the time from
+ * gyro sample to motor output does not depend on which task the scheduler happens to be running.
+ * The interrupt is raised to NVIC_PRIO_MPU_INT_EXTI_PID and preempts the scheduler, subTaskMainSubprocesses()
+ * is left to TASK_GYROPID. Thread mode holds the interrupt off with gyroIsrHold() while it updates the
+ * setpoints or the PID settings.
+ */
+static void taskMainPidLoopGyroIsr(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
+
+    if (pidUpdateCountdown) {
+        pidUpdateCountdown--;
+    } else {
+        pidUpdateCountdown = setPidUpdateCountDown();
+        subTaskPidAndMotorUpdate();
+        runTaskMainSubprocesses = true;
+    }
+}
+#endif
+
+void taskMainPidLoopInit(void)
+{
+#if defined(GYRO_USES_SPI) && defined(USE_MPU_DATA_READY_SIGNAL)
+    pidLoopInGyroIsr = pidConfig()->pid_in_gyro_isr;
+    gyroSetIsrCallback(pidLoopInGyroIsr ? taskMainPidLoopGyroIsr : NULL);
+#endif
+}
+
 // Function for loop trigger
 void taskMainPidLoop(timeUs_t currentTimeUs)
 {
-    static bool runTaskMainSubprocesses;
-    static uint8_t pidUpdateCountdown;
-
     if (debugMode == DEBUG_CYCLETIME) {
         debug[0] = getTaskDeltaTime(TASK_SELF);
         debug[1] = averageSystemLoadPercent;
@@ -612,22 +694,33 @@ void taskMainPidLoop(timeUs_t currentTimeUs)
         runTaskMainSubprocesses = false;
     }
 
+#if defined(GYRO_USES_SPI) && defined(USE_MPU_DATA_READY_SIGNAL)
+    if (pidLoopInGyroIsr && gyroIsrUpdateActive()) {
+        // gyro, PID and motors are now updated from the gyro interrupt, only the subprocesses remain
+        static bool rescheduled = false;
+        if (!rescheduled) {
+            rescheduleTask(TASK_SELF, targetPidLooptime);
+            rescheduled = true;
+        }
+        return;
+    }
+#endif
+
     // DEBUG_PIDLOOP, timings for:
     // 0 - gyroUpdate()
     // 1 - pidController()
     // 2 - subTaskMainSubprocesses()
     // 3 - subTaskMotorUpdate()
-    uint32_t startTime;
-    if (debugMode == DEBUG_PIDLOOP) {startTime = micros();}
+    const profileTicks_t startTicks = profileTicks();
     gyroUpdate();
-    DEBUG_SET(DEBUG_PIDLOOP, 0, micros() - startTime);
+    const profileTicks_t gyroTicks = profileRecord(PROFILE_GYRO_UPDATE, startTicks);
+    DEBUG_SET(DEBUG_PIDLOOP, 0, profileTicksToUs(gyroTicks));
 
     if (pidUpdateCountdown) {
         pidUpdateCountdown--;
     } else {
         pidUpdateCountdown = setPidUpdateCountDown();
-        subTaskPidController();
-        subTaskMotorUpdate();
+        subTaskPidAndMotorUpdate();
         runTaskMainSubprocesses = true;
     }
 }
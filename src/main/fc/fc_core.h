@@ -47,4 +47,5 @@ void processRx(timeUs_t currentTimeUs);
 void updateLEDs(void);
 void updateRcCommands(void);
 
+void taskMainPidLoopInit(void);
 void taskMainPidLoop(timeUs_t currentTimeUs);
@@ -126,6 +126,7 @@
 
 #include "build/build_config.h"
 #include "build/debug.h"
+#include "build/profile.h"
 
 #ifdef TARGET_PREINIT
 void targetPreInit(void);
@@ -165,6 +166,7 @@ void init(void)
     printfSupportInit();
 
     systemInit();
+    profileInit();
 
     // initialize IO (needed for all IO operations)
     IOInitGlobal();
@@ -499,15 +501,15 @@ void init(void)
 #ifdef USE_FLASHFS
 #if defined(USE_FLASH_M25P16)
     m25p16_init(flashConfig());
+    flashfsInit(&m25p16VTable);
 #endif
-    flashfsInit();
 #endif
 
 #ifdef USE_SDCARD
     if (blackboxConfig()->device == BLACKBOX_DEVICE_SDCARD) {
         sdcardInsertionDetectInit();
         sdcard_init(sdcardConfig()->useDma);
-        afatfs_init();
+        afatfs_init(&sdcardVTable);
     }
 #endif
 
@@ -30,6 +30,7 @@
 
 #include "common/axis.h"
 #include "common/color.h"
+#include "common/huffman.h"
 #include "common/maths.h"
 #include "common/streambuf.h"
 
@@ -54,6 +55,7 @@
 #include "drivers/vtx_common.h"
 #include "drivers/vtx_soft_spi_rtc6705.h"
 
+#include "fc/cli.h"
 #include "fc/config.h"
 #include "fc/controlrate_profile.h"
 #include "fc/fc_core.h"
@@ -511,8 +513,8 @@ static void serializeDataflashSummaryReply(sbuf_t *dst)
 
     sbufWriteU8(dst, flags);
     sbufWriteU32(dst, geometry->sectors);
-    sbufWriteU32(dst, geometry->totalSize);
-    sbufWriteU32(dst, flashfsGetOffset()); // Effectively the current number of bytes stored on the volume
+    sbufWriteU32(dst, flashfsGetSize()); // The usable volume, without the sectors holding the log index
+    sbufWriteU32(dst, flashfsGetUsedSize());
 #else
     sbufWriteU8(dst, 0); // FlashFS is neither ready nor supported
     sbufWriteU32(dst, 0);
@@ -522,25 +524,93 @@ static void serializeDataflashSummaryReply(sbuf_t *dst)
 }
 
 #ifdef USE_FLASHFS
-static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uint16_t size, bool useLegacyFormat)
+#define MSP_DATAFLASH_COMPRESSION_NONE      0
+#define MSP_DATAFLASH_COMPRESSION_HUFFMAN   1
+
+/*
+ * Huffman compressed read reply, after the address: data size, compression format, number of flash bytes encoded
+ * and the encoded data. The data size counts everything after the compression format.
+ * As many of the size bytes requested as fit the reply buffer are encoded, returns the number encoded.
+ */
+static int serializeDataflashCompressedReply(sbuf_t *dst, uint32_t address, int size)
+{
+    sbuf_t header = *dst;
+    sbufAdvance(dst, sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t));
+
+    huffmanState_t state;
+    huffmanEncodeInit(&state, sbufPtr(dst), sbufBytesRemaining(dst) - MSP_PORT_DATAFLASH_INFO_SIZE);
+
+    // stream the flash contents through the encoder straight into the reply
+    uint8_t chunk[32];
+    int bytesEncoded = 0;
+    while (bytesEncoded < size) {
+        const int chunkLen = flashfsReadAbs(address + bytesEncoded, chunk, MIN((int)sizeof(chunk), size - bytesEncoded));
+        const int chunkEncoded = huffmanEncode(&state, huffmanTable, chunk, chunkLen);
+        bytesEncoded += chunkEncoded;
+        if (chunkEncoded < chunkLen || chunkLen == 0) {
+            break;
+        }
+    }
+    const int encodedLen = huffmanEncodeFinish(&state);
+    sbufAdvance(dst, encodedLen);
+
+    sbufWriteU16(&header, sizeof(uint16_t) + encodedLen);
+    sbufWriteU8(&header, MSP_DATAFLASH_COMPRESSION_HUFFMAN);
+    sbufWriteU16(&header, bytesEncoded);
+
+    return bytesEncoded;
+}
+
+/*
+ * Streams the flash for a reply too large for the reply buffer, the context is the flash address the streamed part
+ * starts at. Reads wrap around the end of the volume like the logs do.
+ */
+static int mspFcDataflashStream(uint32_t context, uint32_t offset, uint8_t *data, int len)
+{
+    const uint32_t address = (context + offset) % flashfsGetSize();
+
+    return flashfsReadAbs(address, data, MIN((uint32_t)len, flashfsGetSize() - address));
+}
+
+static void serializeDataflashReadReply(mspPacket_t *reply, uint32_t address, const uint16_t size, bool useLegacyFormat, bool allowCompression)
 {
     BUILD_BUG_ON(MSP_PORT_DATAFLASH_INFO_SIZE < 16);
 
+    sbuf_t *dst = &reply->buf;
     uint16_t readLen = size;
     const int bytesRemainingInBuf = sbufBytesRemaining(dst) - MSP_PORT_DATAFLASH_INFO_SIZE;
-    if (readLen > bytesRemainingInBuf) {
-        readLen = bytesRemainingInBuf;
-    }
     // size will be lower than that requested if we reach end of volume
     if (readLen > flashfsGetSize() - address) {
         // truncate the request
         readLen = flashfsGetSize() - address;
     }
     sbufWriteU32(dst, address);
+
+    // a read too large for the reply buffer is streamed when the port can do that
+    const bool streamed = !useLegacyFormat && readLen > bytesRemainingInBuf && reply->streamLimit > 0;
+    const uint16_t uncompressedLen = MIN(readLen, streamed ? reply->streamLimit : bytesRemainingInBuf);
+
+    if (allowCompression && !useLegacyFormat) {
+        const sbuf_t compressedReply = *dst;
+        // keep the compressed reply if it carries as much of the flash as an uncompressed one could, in fewer bytes
+        if (serializeDataflashCompressedReply(dst, address, readLen) >= uncompressedLen) {
+            return;
+        }
+        *dst = compressedReply;
+    }
+
+    readLen = uncompressedLen;
     if (!useLegacyFormat) {
         // new format supports variable read lengths
         sbufWriteU16(dst, readLen);
-        sbufWriteU8(dst, 0); // placeholder for compression format
+        sbufWriteU8(dst, MSP_DATAFLASH_COMPRESSION_NONE);
+    }
+
+    if (streamed) {
+        reply->streamFn = mspFcDataflashStream;
+        reply->streamContext = address;
+        reply->streamLength = readLen;
+        return;
     }
 
     // bytesRead will equal readLen
@@ -560,7 +630,7 @@ static void serializeDataflashReadReply(sbuf_t *dst, uint32_t address, const uin
  * Returns true if the command was processd, false otherwise.
  * May set mspPostProcessFunc to a function to be called once the command has been processed
  */
-static bool mspFcProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
+static bool mspFcProcessOutCommand(uint16_t cmdMSP, sbuf_t *dst, mspPostProcessFnPtr *mspPostProcessFn)
 {
     switch (cmdMSP) {
     case MSP_API_VERSION:
@@ -688,6 +758,16 @@ static bool mspFcProcessOutCommand(uint8_t cmdMSP, sbuf_t *dst, mspPostProcessFn
         }
         break;
 
+#ifdef USE_DSHOT_TELEMETRY
+    case MSP_MOTOR_TELEMETRY:
+        sbufWriteU8(dst, getMotorCount());
+        for (unsigned i = 0; i < getMotorCount(); i++) {
+            sbufWriteU32(dst, getMotorRpm(i));
+            sbufWriteU16(dst, useDshotTelemetry ? getDshotTelemetryErrors(i) : 0);
+        }
+        break;
+#endif
+
     case MSP_RC:
         for (int i = 0; i < rxRuntimeConfig.channelCount; i++) {
             sbufWriteU16(dst, rcData[i]);
@@ -1271,7 +1351,7 @@ static void mspFcWpCommand(sbuf_t *dst, sbuf_t *src)
 #endif
 
 #ifdef USE_FLASHFS
-static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
+static void mspFcDataFlashReadCommand(mspPacket_t *reply, sbuf_t *src)
 {
     const unsigned int dataSize = sbufBytesRemaining(src);
     const uint32_t readAddress = sbufReadU32(src);
@@ -1284,12 +1364,260 @@ static void mspFcDataFlashReadCommand(sbuf_t *dst, sbuf_t *src)
         readLength = 128;
         useLegacyFormat = true;
     }
+    // clients that can decode compressed replies say so with a trailing byte
+    bool allowCompression = false;
+    if (dataSize >= sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint8_t)) {
+        allowCompression = sbufReadU8(src);
+    }
+
+    serializeDataflashReadReply(reply, readAddress, readLength, useLegacyFormat, allowCompression);
+}
+#endif
+
+#ifdef USE_FLASHFS_LOG_INDEX
+#define MSP_DATAFLASH_LOG_OPEN  (1 << 0)
+
+/*
+ * Request: index of the first log wanted, omit for the oldest log.
+ * Reply: log count, index of the first log returned, then start, length, duration and flags of as many logs as fit.
+ */
+static void mspFcDataFlashLogListCommand(sbuf_t *dst, sbuf_t *src)
+{
+    uint16_t index = 0;
+    if (sbufBytesRemaining(src) >= (int)sizeof(uint16_t)) {
+        index = sbufReadU16(src);
+    }
 
-    serializeDataflashReadReply(dst, readAddress, readLength, useLegacyFormat);
+    const int count = flashfsGetLogCount();
+    sbufWriteU16(dst, count);
+    sbufWriteU16(dst, index);
+
+    flashfsLog_t log;
+    while (sbufBytesRemaining(dst) >= 3 * (int)sizeof(uint32_t) + (int)sizeof(uint8_t) && flashfsGetLog(index++, &log)) {
+        sbufWriteU32(dst, log.start);
+        sbufWriteU32(dst, log.length);
+        sbufWriteU32(dst, log.durationMs);
+        sbufWriteU8(dst, log.open ? MSP_DATAFLASH_LOG_OPEN : 0);
+    }
+}
+
+/*
+ * Request: log index, offset in the log and number of bytes wanted.
+ * Reply: log index, offset, number of bytes returned and the data, fewer bytes than requested at the end of the log.
+ */
+static mspResult_e mspFcDataFlashLogReadCommand(mspPacket_t *reply, sbuf_t *src)
+{
+    sbuf_t *dst = &reply->buf;
+    const uint16_t index = sbufReadU16(src);
+    const uint32_t offset = sbufReadU32(src);
+    const uint16_t size = sbufReadU16(src);
+
+    flashfsLog_t log;
+    if (!flashfsGetLog(index, &log)) {
+        return MSP_RESULT_ERROR;
+    }
+
+    sbufWriteU16(dst, index);
+    sbufWriteU32(dst, offset);
+
+    const int bytesRemainingInBuf = sbufBytesRemaining(dst) - sizeof(uint16_t) - MSP_PORT_DATAFLASH_INFO_SIZE;
+    if (size > bytesRemainingInBuf && reply->streamLimit > 0) {
+        // too large for the reply buffer, stream it out of the flash instead
+        const uint16_t streamLength = offset < log.length ? MIN(MIN(size, log.length - offset), reply->streamLimit) : 0;
+        sbufWriteU16(dst, streamLength);
+        reply->streamFn = mspFcDataflashStream;
+        reply->streamContext = (log.start + offset) % flashfsGetSize();
+        reply->streamLength = streamLength;
+        return MSP_RESULT_ACK;
+    }
+
+    sbuf_t lengthField = *dst;
+    sbufAdvance(dst, sizeof(uint16_t));
+
+    const int bytesRead = flashfsReadLog(index, offset, sbufPtr(dst), MIN(size, sbufBytesRemaining(dst) - MSP_PORT_DATAFLASH_INFO_SIZE));
+    sbufAdvance(dst, bytesRead);
+    sbufWriteU16(&lengthField, bytesRead);
+
+    return MSP_RESULT_ACK;
 }
 #endif
 
-static mspResult_e mspFcProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
+#ifdef USE_SCHEDULER_TRACE
+#define MSP_SCHEDULER_TRACE_MAX_ENTRIES 24  // keeps the reply within a non-jumbo frame
+
+static mspResult_e mspFcTaskHistogramCommand(sbuf_t *dst, sbuf_t *src)
+{
+    if (sbufBytesRemaining(src) < 1) {
+        return MSP_RESULT_ERROR;
+    }
+    const uint8_t taskId = sbufReadU8(src);
+    if (taskId >= TASK_COUNT) {
+        return MSP_RESULT_ERROR;
+    }
+
+    sbufWriteU8(dst, taskId);
+    sbufWriteU8(dst, SCHEDULER_HISTOGRAM_BUCKETS);
+    const uint16_t *latenessHistogram = getTaskLatenessHistogram(taskId);
+    for (int i = 0; i < SCHEDULER_HISTOGRAM_BUCKETS; i++) {
+        sbufWriteU16(dst, latenessHistogram[i]);
+    }
+    const uint16_t *executionHistogram = getTaskExecutionHistogram(taskId);
+    for (int i = 0; i < SCHEDULER_HISTOGRAM_BUCKETS; i++) {
+        sbufWriteU16(dst, executionHistogram[i]);
+    }
+    return MSP_RESULT_ACK;
+}
+
+/*
+ * Request: sequence number of the first entry wanted, omit for the oldest entry held.
+ * Reply: sequence number of the first entry returned, sequence number of the next entry to be written, entry count, entries.
+ * Entries are returned from the requested sequence number onwards, a gap between the requested and returned
+ * sequence numbers is the count of entries lost to overwrite.
+ */
+static void mspFcSchedulerTraceCommand(sbuf_t *dst, sbuf_t *src)
+{
+    uint32_t sequence;
+    if (sbufBytesRemaining(src) >= (int)sizeof(uint32_t)) {
+        sequence = sbufReadU32(src);
+    } else {
+        sequence = schedulerTraceSequence() - SCHEDULER_TRACE_SIZE;
+    }
+
+    schedulerTraceEntry_t entries[MSP_SCHEDULER_TRACE_MAX_ENTRIES];
+    const int count = schedulerTraceRead(&sequence, entries, MSP_SCHEDULER_TRACE_MAX_ENTRIES);
+
+    sbufWriteU32(dst, sequence);
+    sbufWriteU32(dst, schedulerTraceSequence());
+    sbufWriteU8(dst, count);
+    for (int i = 0; i < count; i++) {
+        sbufWriteU8(dst, entries[i].taskId);
+        sbufWriteU32(dst, entries[i].startedAt);
+        sbufWriteU16(dst, entries[i].executionTime);
+        sbufWriteU16(dst, entries[i].lateness);
+    }
+}
+#endif
+
+#ifdef USE_CLI
+static void mspFcWriteSettingValue(sbuf_t *dst, uint8_t size, uint32_t value)
+{
+    switch (size) {
+    case sizeof(uint8_t):
+        sbufWriteU8(dst, value);
+        break;
+    case sizeof(uint16_t):
+        sbufWriteU16(dst, value);
+        break;
+    default:
+        sbufWriteU32(dst, value);
+        break;
+    }
+}
+
+static uint32_t mspFcReadSettingValue(sbuf_t *src, uint8_t size)
+{
+    switch (size) {
+    case sizeof(uint8_t):
+        return sbufReadU8(src);
+    case sizeof(uint16_t):
+        return sbufReadU16(src);
+    default:
+        return sbufReadU32(src);
+    }
+}
+
+/*
+ * Request: index of the first setting wanted, omit for the first setting.
+ * Reply: setting count, index of the first setting returned, then for as many settings as fit the reply: type, value
+ * size, minimum, maximum, name length and name.
+ */
+static void mspFcSettingInfoCommand(sbuf_t *dst, sbuf_t *src)
+{
+    uint16_t index = 0;
+    if (sbufBytesRemaining(src) >= (int)sizeof(uint16_t)) {
+        index = sbufReadU16(src);
+    }
+
+    sbufWriteU16(dst, cliSettingCount());
+    sbufWriteU16(dst, index);
+
+    cliSettingInfo_t info;
+    while (cliSettingGetInfo(index, &info)) {
+        const int nameLength = strlen(info.name);
+        if (sbufBytesRemaining(dst) < 3 * (int)sizeof(uint8_t) + 2 * (int)sizeof(int16_t) + nameLength) {
+            break;
+        }
+        sbufWriteU8(dst, info.type);
+        sbufWriteU8(dst, info.size);
+        sbufWriteU16(dst, info.min);
+        sbufWriteU16(dst, info.max);
+        sbufWriteU8(dst, nameLength);
+        sbufWriteData(dst, info.name, nameLength);
+        index++;
+    }
+}
+
+/*
+ * Request: index of the first setting wanted and the number of settings, omit the number for all that fit.
+ * Reply: index of the first setting returned, number of settings returned and their values, each in the size given
+ * by MSP_SETTING_INFO.
+ */
+static void mspFcSettingValuesCommand(sbuf_t *dst, sbuf_t *src)
+{
+    const uint16_t index = sbufReadU16(src);
+    uint16_t count = cliSettingCount();
+    if (sbufBytesRemaining(src) >= (int)sizeof(uint16_t)) {
+        count = sbufReadU16(src);
+    }
+
+    sbufWriteU16(dst, index);
+    uint8_t *countPtr = sbufPtr(dst);
+    sbufWriteU16(dst, 0);
+
+    uint16_t returned = 0;
+    cliSettingInfo_t info;
+    while (returned < count && cliSettingGetInfo(index + returned, &info) && sbufBytesRemaining(dst) >= info.size) {
+        mspFcWriteSettingValue(dst, info.size, cliSettingGetValue(index + returned));
+        returned++;
+    }
+    countPtr[0] = returned & 0xff;
+    countPtr[1] = returned >> 8;
+}
+
+// Request: setting name. Reply: index of the setting.
+static mspResult_e mspFcSettingFindCommand(sbuf_t *dst, sbuf_t *src)
+{
+    const int index = cliSettingFind((const char *)sbufPtr(src), sbufBytesRemaining(src));
+    if (index == CLI_SETTING_NOT_FOUND) {
+        return MSP_RESULT_ERROR;
+    }
+    sbufWriteU16(dst, index);
+    return MSP_RESULT_ACK;
+}
+
+/*
+ * Request: pairs of setting index and value, each value in the size given by MSP_SETTING_INFO. Settings are set in
+ * order up to the first unknown setting or value out of range, which fails the command.
+ */
+static mspResult_e mspFcSetSettingValuesCommand(sbuf_t *src)
+{
+    mspResult_e result = MSP_RESULT_ACK;
+    while (sbufBytesRemaining(src) >= (int)sizeof(uint16_t)) {
+        const uint16_t index = sbufReadU16(src);
+        cliSettingInfo_t info;
+        if (!cliSettingGetInfo(index, &info) || sbufBytesRemaining(src) < info.size
+            || !cliSettingSetValue(index, mspFcReadSettingValue(src, info.size))) {
+            result = MSP_RESULT_ERROR;
+            break;
+        }
+    }
+    // rate profile settings only take effect through the curves built from them
+    generateRcCurves();
+    return result;
+}
+#endif
+
+static mspResult_e mspFcProcessInCommand(uint16_t cmdMSP, sbuf_t *src)
 {
     uint32_t i;
     uint8_t value;
@@ -1421,7 +1749,7 @@ static mspResult_e mspFcProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
             if (dataSize >= 12) {
                 currentControlRateProfile->rcYawRate8 = sbufReadU8(src);
             }
-            generateThrottleCurve();
+            generateRcCurves();
         } else {
             return MSP_RESULT_ERROR;
         }
@@ -1729,6 +2057,19 @@ static mspResult_e mspFcProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
         break;
 #endif
 
+#ifdef USE_FLASHFS_LOG_INDEX
+    case MSP_DATAFLASH_LOG_ERASE:
+        if (!flashfsEraseOldestLogs(sbufReadU16(src))) {
+            return MSP_RESULT_ERROR;
+        }
+        break;
+#endif
+
+#ifdef USE_CLI
+    case MSP_SET_SETTING_VALUES:
+        return mspFcSetSettingValuesCommand(src);
+#endif
+
 #ifdef GPS
     case MSP_SET_RAW_GPS:
         if (sbufReadU8(src)) {
@@ -1989,6 +2330,14 @@ static mspResult_e mspFcProcessInCommand(uint8_t cmdMSP, sbuf_t *src)
     return MSP_RESULT_ACK;
 }
 
+/*
+ * Only commands without a request can be pushed, and nothing is run after their reply is sent
+ */
+bool mspFcProcessPushCommand(uint16_t cmdMSP, sbuf_t *dst)
+{
+    return mspFcProcessOutCommand(cmdMSP, dst, NULL);
+}
+
 /*
  * Returns MSP_RESULT_ACK, MSP_RESULT_ERROR or MSP_RESULT_NO_REPLY
  */
@@ -1997,7 +2346,7 @@ mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostPro
     int ret = MSP_RESULT_ACK;
     sbuf_t *dst = &reply->buf;
     sbuf_t *src = &cmd->buf;
-    const uint8_t cmdMSP = cmd->cmd;
+    const uint16_t cmdMSP = cmd->cmd;
     // initialize reply by default
     reply->cmd = cmd->cmd;
 
@@ -2015,7 +2364,31 @@ mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostPro
 #endif
 #ifdef USE_FLASHFS
     } else if (cmdMSP == MSP_DATAFLASH_READ) {
-        mspFcDataFlashReadCommand(dst, src);
+        mspFcDataFlashReadCommand(reply, src);
+        ret = MSP_RESULT_ACK;
+#endif
+#ifdef USE_FLASHFS_LOG_INDEX
+    } else if (cmdMSP == MSP_DATAFLASH_LOG_LIST) {
+        mspFcDataFlashLogListCommand(dst, src);
+        ret = MSP_RESULT_ACK;
+    } else if (cmdMSP == MSP_DATAFLASH_LOG_READ) {
+        ret = mspFcDataFlashLogReadCommand(reply, src);
+#endif
+#ifdef USE_CLI
+    } else if (cmdMSP == MSP_SETTING_INFO) {
+        mspFcSettingInfoCommand(dst, src);
+        ret = MSP_RESULT_ACK;
+    } else if (cmdMSP == MSP_SETTING_VALUES) {
+        mspFcSettingValuesCommand(dst, src);
+        ret = MSP_RESULT_ACK;
+    } else if (cmdMSP == MSP_SETTING_FIND) {
+        ret = mspFcSettingFindCommand(dst, src);
+#endif
+#ifdef USE_SCHEDULER_TRACE
+    } else if (cmdMSP == MSP_TASK_HISTOGRAM) {
+        ret = mspFcTaskHistogramCommand(dst, src);
+    } else if (cmdMSP == MSP_SCHEDULER_TRACE) {
+        mspFcSchedulerTraceCommand(dst, src);
         ret = MSP_RESULT_ACK;
 #endif
     } else {
@@ -21,3 +21,4 @@
 
 void mspFcInit(void);
 mspResult_e mspFcProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
+bool mspFcProcessPushCommand(uint16_t cmdMSP, sbuf_t *dst);
@@ -67,15 +67,15 @@ float getThrottlePIDAttenuation(void) {
     return throttlePIDAttenuation;
 }
 
-#define THROTTLE_LOOKUP_LENGTH 12
+// throttle curve in steps of 1% of the stick, with an extra point so full throttle can be interpolated too
+#define THROTTLE_LOOKUP_STEP 10
+#define THROTTLE_LOOKUP_LENGTH (1000 / THROTTLE_LOOKUP_STEP + 2)
 static int16_t lookupThrottleRC[THROTTLE_LOOKUP_LENGTH];    // lookup table for expo & mid THROTTLE
 
-void generateThrottleCurve(void)
+static void generateThrottleCurve(void)
 {
-    uint8_t i;
-
-    for (i = 0; i < THROTTLE_LOOKUP_LENGTH; i++) {
-        int16_t tmp = 10 * i - currentControlRateProfile->thrMid8;
+    for (int i = 0; i < THROTTLE_LOOKUP_LENGTH; i++) {
+        const int16_t tmp = i * THROTTLE_LOOKUP_STEP / 10 - currentControlRateProfile->thrMid8;
         uint8_t y = 1;
         if (tmp > 0)
             y = 100 - currentControlRateProfile->thrMid8;
@@ -88,15 +88,24 @@ void generateThrottleCurve(void)
 
 int16_t rcLookupThrottle(int32_t tmp)
 {
-    const int32_t tmp2 = tmp / 100;
+    const int32_t tmp2 = tmp / THROTTLE_LOOKUP_STEP;
     // [0;1000] -> expo -> [MINTHROTTLE;MAXTHROTTLE]
-    return lookupThrottleRC[tmp2] + (tmp - tmp2 * 100) * (lookupThrottleRC[tmp2 + 1] - lookupThrottleRC[tmp2]) / 100;
+    return lookupThrottleRC[tmp2] + (tmp - tmp2 * THROTTLE_LOOKUP_STEP) * (lookupThrottleRC[tmp2 + 1] - lookupThrottleRC[tmp2]) / THROTTLE_LOOKUP_STEP;
 }
 
 #define SETPOINT_RATE_LIMIT 1998.0f
 #define RC_RATE_INCREMENTAL 14.54f
 
-static void calculateSetpointRate(int axis)
+// setpoint rate curves from centre to full stick, linearly interpolated
+#ifdef STM32F10X
+#define SETPOINT_RATE_CURVE_LENGTH 64
+#else
+#define SETPOINT_RATE_CURVE_LENGTH 256
+#endif
+static float setpointRateCurve[3][SETPOINT_RATE_CURVE_LENGTH + 1];
+
+// stick deflection in [0;1] -> deg/s
+static float calculateRateBetaflight(int axis, float rcCommandfAbs)
 {
     uint8_t rcExpo;
     float rcRate;
@@ -111,11 +120,7 @@ static void calculateSetpointRate(int axis)
         rcRate += RC_RATE_INCREMENTAL * (rcRate - 2.0f);
     }
 
-    float rcCommandf = rcCommand[axis] / 500.0f;
-    rcDeflection[axis] = rcCommandf;
-    const float rcCommandfAbs = ABS(rcCommandf);
-    rcDeflectionAbs[axis] = rcCommandfAbs;
-
+    float rcCommandf = rcCommandfAbs;
     if (rcExpo) {
         const float expof = rcExpo / 100.0f;
         rcCommandf = rcCommandf * power3(rcCommandfAbs) * expof + rcCommandf * (1-expof);
@@ -126,6 +131,76 @@ static void calculateSetpointRate(int axis)
         const float rcSuperfactor = 1.0f / (constrainf(1.0f - (rcCommandfAbs * (currentControlRateProfile->rates[axis] / 100.0f)), 0.01f, 1.00f));
         angleRate *= rcSuperfactor;
     }
+    return angleRate;
+}
+
+/*
+ * rc_rate is the rate around centre stick and the superrate the rate at full stick, both in tens of deg/s,
+ * expo bends the curve between the two.
+ */
+static float calculateRateActual(int axis, float rcCommandf)
+{
+    uint8_t rcExpo;
+    uint8_t rcRate;
+    if (axis != YAW) {
+        rcExpo = currentControlRateProfile->rcExpo8;
+        rcRate = currentControlRateProfile->rcRate8;
+    } else {
+        rcExpo = currentControlRateProfile->rcYawExpo8;
+        rcRate = currentControlRateProfile->rcYawRate8;
+    }
+
+    const float expof = rcExpo / 100.0f;
+    const float expoCommandf = rcCommandf * (power5(rcCommandf) * expof + rcCommandf * (1 - expof));
+    const float centreSensitivity = rcRate * 10.0f;
+    const float stickMovement = MAX(0, currentControlRateProfile->rates[axis] * 10.0f - centreSensitivity);
+    return rcCommandf * centreSensitivity + stickMovement * expoCommandf;
+}
+
+static void generateSetpointRateCurves(void)
+{
+    for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+        for (int i = 0; i <= SETPOINT_RATE_CURVE_LENGTH; i++) {
+            const float rcCommandf = (float)i / SETPOINT_RATE_CURVE_LENGTH;
+            float angleRate;
+            switch (currentControlRateProfile->ratesType) {
+            case RATES_TYPE_ACTUAL:
+                angleRate = calculateRateActual(axis, rcCommandf);
+                break;
+            case RATES_TYPE_BETAFLIGHT:
+            default:
+                angleRate = calculateRateBetaflight(axis, rcCommandf);
+                break;
+            }
+            // limited after interpolating so the knee where the curve reaches the limit stays sharp
+            setpointRateCurve[axis][i] = angleRate;
+        }
+    }
+}
+
+/*
+ * Builds the throttle and setpoint rate curves of the current rate profile, call whenever it changes.
+ */
+void generateRcCurves(void)
+{
+    generateThrottleCurve();
+    generateSetpointRateCurves();
+}
+
+static void calculateSetpointRate(int axis)
+{
+    const float rcCommandf = rcCommand[axis] * (1.0f / 500);
+    rcDeflection[axis] = rcCommandf;
+    const float rcCommandfAbs = ABS(rcCommandf);
+    rcDeflectionAbs[axis] = rcCommandfAbs;
+
+    const float position = MIN(rcCommandfAbs, 1.0f) * SETPOINT_RATE_CURVE_LENGTH;
+    const int index = MIN((int)position, SETPOINT_RATE_CURVE_LENGTH - 1);
+    const float *curve = setpointRateCurve[axis];
+    float angleRate = curve[index] + (position - index) * (curve[index + 1] - curve[index]);
+    if (rcCommandf < 0) {
+        angleRate = -angleRate;
+    }
 
     DEBUG_SET(DEBUG_ANGLERATE, axis, angleRate);
 
@@ -172,6 +247,136 @@ static void scaleRcCommandToFpvCamAngle(void) {
         pidSetItermAccelerator(1.0f);
 }
 
+#define RC_FRAME_INTERVAL_MIN_US            1000
+#define RC_FRAME_INTERVAL_MAX_US            50000
+#define RC_FRAME_INTERVAL_OUTLIER_COUNT     10  // consecutive outliers taken as a change of frame rate
+
+#define RC_SMOOTHING_AUTO_CUTOFF_DIVIDER    4   // automatic cutoff is this fraction of the frame rate
+#define RC_SMOOTHING_CUTOFF_MIN_HZ          5
+#define RC_SMOOTHING_CUTOFF_MAX_HZ          255
+#define RC_SMOOTHING_CHANNEL_COUNT          4   // roll, pitch, yaw and throttle
+
+static uint16_t rcFrameIntervalUs; // 0 until measured
+
+uint16_t getRcFrameIntervalUs(void)
+{
+    return rcFrameIntervalUs;
+}
+
+/*
+ * Measures the interval between RX frames from the times the receiver drivers stamped on them.
+ * Lost frames and late pickups are rejected as outliers, a steady run of them means the rate changed.
+ */
+static void updateRcFrameInterval(timeUs_t frameTimeUs)
+{
+    static timeUs_t lastFrameTimeUs;
+    static uint8_t outlierCount;
+
+    const timeDelta_t intervalUs = cmpTimeUs(frameTimeUs, lastFrameTimeUs);
+    lastFrameTimeUs = frameTimeUs;
+    if (intervalUs < RC_FRAME_INTERVAL_MIN_US || intervalUs > RC_FRAME_INTERVAL_MAX_US) {
+        return;
+    }
+
+    if (rcFrameIntervalUs && ABS(intervalUs - rcFrameIntervalUs) > rcFrameIntervalUs / 2) {
+        if (++outlierCount < RC_FRAME_INTERVAL_OUTLIER_COUNT) {
+            return;
+        }
+        rcFrameIntervalUs = 0;
+    }
+    outlierCount = 0;
+
+    if (rcFrameIntervalUs) {
+        rcFrameIntervalUs += (intervalUs - rcFrameIntervalUs) / 8;
+    } else {
+        rcFrameIntervalUs = intervalUs;
+    }
+}
+
+static uint16_t rcSmoothingCutoffHz(void)
+{
+    uint16_t cutoffHz = rxConfig()->rcSmoothingCutoffHz;
+    if (!cutoffHz) {
+        const uint16_t intervalUs = MAX(rcFrameIntervalUs ? rcFrameIntervalUs : rxGetRefreshRate(), RC_FRAME_INTERVAL_MIN_US);
+        cutoffHz = 1000000 / (intervalUs * RC_SMOOTHING_AUTO_CUTOFF_DIVIDER);
+    }
+    // keep well clear of the Nyquist frequency of the PID loop
+    return constrain(cutoffHz, RC_SMOOTHING_CUTOFF_MIN_HZ, MIN(RC_SMOOTHING_CUTOFF_MAX_HZ, 250000 / targetPidLooptime));
+}
+
+static bool rcSmoothingFilterInitialised;
+
+/*
+ * Runs every PID loop: the setpoints (and throttle) of each new RX frame are the input of a low pass filter,
+ * so the output moves smoothly however irregularly the frames arrive. The filter state is seeded with the
+ * first frame and kept when the cutoff is retuned, so neither causes a step.
+ */
+static void processRcSmoothingFilter(void)
+{
+    static pt1Filter_t pt1Filter[RC_SMOOTHING_CHANNEL_COUNT];
+    static biquadFilter_t biquadFilter[RC_SMOOTHING_CHANNEL_COUNT];
+    static float rcTarget[RC_SMOOTHING_CHANNEL_COUNT];
+    static uint16_t filterCutoffHz;
+    static uint32_t filterLooptime;
+    static uint8_t filterType;
+    const uint8_t smoothingChannels = rxConfig()->rcInterpolationChannels + 2;
+
+    if (isRXDataNew) {
+        for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+            calculateSetpointRate(axis);
+        }
+        // Scaling of AngleRate to camera angle (Mixing Roll and Yaw)
+        if (rxConfig()->fpvCamAngleDegrees && IS_RC_MODE_ACTIVE(BOXFPVANGLEMIX) && !FLIGHT_MODE(HEADFREE_MODE)) {
+            scaleRcCommandToFpvCamAngle();
+        }
+        for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+            rcTarget[axis] = setpointRate[axis];
+        }
+        rcTarget[THROTTLE] = rcCommand[THROTTLE];
+        isRXDataNew = false;
+    } else if (!rcSmoothingFilterInitialised) {
+        return;
+    }
+
+    const uint16_t cutoffHz = rcSmoothingCutoffHz();
+    if (!rcSmoothingFilterInitialised || filterType != rxConfig()->rcSmoothingFilterType) {
+        filterType = rxConfig()->rcSmoothingFilterType;
+        for (int channel = 0; channel < RC_SMOOTHING_CHANNEL_COUNT; channel++) {
+            pt1FilterInit(&pt1Filter[channel], cutoffHz, targetPidLooptime * 1e-6f);
+            pt1Filter[channel].state = rcTarget[channel];
+            biquadFilter_t *filter = &biquadFilter[channel];
+            biquadFilterInitLPF(filter, cutoffHz, targetPidLooptime);
+            // steady state of a constant input
+            filter->d1 = rcTarget[channel] * (1 - filter->b0);
+            filter->d2 = rcTarget[channel] * (filter->b2 - filter->a2);
+        }
+        rcSmoothingFilterInitialised = true;
+    } else if (cutoffHz != filterCutoffHz || targetPidLooptime != filterLooptime) {
+        for (int channel = 0; channel < RC_SMOOTHING_CHANNEL_COUNT; channel++) {
+            pt1FilterInit(&pt1Filter[channel], cutoffHz, targetPidLooptime * 1e-6f);
+            biquadFilterUpdateLPF(&biquadFilter[channel], cutoffHz, targetPidLooptime);
+        }
+    }
+    filterCutoffHz = cutoffHz;
+    filterLooptime = targetPidLooptime;
+
+    for (int channel = ROLL; channel < smoothingChannels; channel++) {
+        const float value = filterType == FILTER_BIQUAD ? biquadFilterApply(&biquadFilter[channel], rcTarget[channel]) : pt1FilterApply(&pt1Filter[channel], rcTarget[channel]);
+        if (channel == THROTTLE) {
+            rcCommand[THROTTLE] = lrintf(value);
+        } else {
+            setpointRate[channel] = value;
+        }
+    }
+
+    if (debugMode == DEBUG_RC_INTERPOLATION) {
+        debug[0] = lrintf(rcTarget[ROLL]);
+        debug[1] = lrintf(setpointRate[ROLL]);
+        debug[2] = cutoffHz;
+        debug[3] = rcFrameIntervalUs;
+    }
+}
+
 void processRcCommand(void)
 {
     static int16_t lastCommand[4] = { 0, 0, 0, 0 };
@@ -184,11 +389,18 @@ void processRcCommand(void)
     uint8_t readyToCalculateRateAxisCnt = 0;
 
     if (isRXDataNew) {
-        currentRxRefreshRate = constrain(getTaskDeltaTime(TASK_RX),1000,20000);
+        updateRcFrameInterval(rxFrameTimeUs());
+        currentRxRefreshRate = constrain(rcFrameIntervalUs ? rcFrameIntervalUs : getTaskDeltaTime(TASK_RX), 1000, 20000);
         if (currentPidProfile->itermAcceleratorGain > 1.0f)
             checkForThrottleErrorResetState(currentRxRefreshRate);
     }
 
+    if (rxConfig()->rcInterpolation == RC_SMOOTHING_FILTER) {
+        processRcSmoothingFilter();
+        return;
+    }
+    rcSmoothingFilterInitialised = false;
+
     if (rxConfig()->rcInterpolation || flightModeFlags) {
          // Set RC refresh rate for sampling and channels to filter
         switch(rxConfig()->rcInterpolation) {
@@ -17,10 +17,11 @@
 #pragma once
 
 void processRcCommand(void);
+uint16_t getRcFrameIntervalUs(void);
 float getSetpointRate(int axis);
 float getRcDeflection(int axis);
 float getRcDeflectionAbs(int axis);
 float getThrottlePIDAttenuation(void);
 void updateRcCommands(void);
 void resetYawAxis(void);
-void generateThrottleCurve(void);
+void generateRcCurves(void);
@@ -58,6 +58,7 @@
 
 #include "io/beeper.h"
 #include "io/dashboard.h"
+#include "io/flashfs.h"
 #include "io/gps.h"
 #include "io/ledstrip.h"
 #include "io/osd.h"
@@ -109,7 +110,32 @@ static void taskHandleSerial(timeUs_t currentTimeUs)
     }
 #endif
     mspSerialProcess(ARMING_FLAG(ARMED) ? MSP_SKIP_NON_MSP_DATA : MSP_EVALUATE_NON_MSP_DATA, mspFcProcessCommand);
+
+#ifdef USE_MSP_PUSH
+    // the push task only runs while a port is subscribed, at the rate of the fastest subscription
+    static timeDelta_t pushPeriodUs = 0;
+    const timeDelta_t periodUs = mspSerialPushPeriod();
+    if (periodUs != pushPeriodUs) {
+        pushPeriodUs = periodUs;
+        if (periodUs > 0) {
+            rescheduleTask(TASK_MSP_PUSH, periodUs);
+        }
+        setTaskEnabled(TASK_MSP_PUSH, periodUs > 0);
+    }
+#endif
+}
+
+#ifdef USE_MSP_PUSH
+static void taskMspPush(timeUs_t currentTimeUs)
+{
+#ifdef USE_CLI
+    if (cliMode) {
+        return;
+    }
+#endif
+    mspSerialPushSubscriptions(currentTimeUs, mspFcProcessPushCommand);
 }
+#endif
 
 void taskBatteryAlerts(timeUs_t currentTimeUs)
 {
@@ -215,6 +241,7 @@ void fcTasksInit(void)
     schedulerInit();
     rescheduleTask(TASK_GYROPID, gyro.targetLooptime);
     setTaskEnabled(TASK_GYROPID, true);
+    taskMainPidLoopInit();
 
     if (sensors(SENSOR_ACC)) {
         setTaskEnabled(TASK_ACCEL, true);
@@ -310,6 +337,9 @@ void fcTasksInit(void)
 #ifdef USE_GYRO_DATA_ANALYSE
     setTaskEnabled(TASK_GYRO_DATA_ANALYSE, true);
 #endif
+#ifdef USE_FLASHFS
+    setTaskEnabled(TASK_FLASHFS, flashfsGetSize() > 0);
+#endif
 }
 
 cfTask_t cfTasks[TASK_COUNT] = {
@@ -539,8 +569,26 @@ cfTask_t cfTasks[TASK_COUNT] = {
     [TASK_GYRO_DATA_ANALYSE] = {
         .taskName = "GYROFFT",
         .taskFunc = gyroDataAnalyseUpdate,
-        .desiredPeriod = TASK_PERIOD_HZ(100),        // 100 Hz, 10ms
+        .desiredPeriod = TASK_PERIOD_HZ(FFT_UPDATE_RATE_HZ),
         .staticPriority = TASK_PRIORITY_MEDIUM,
     },
 #endif
+
+#ifdef USE_FLASHFS
+    [TASK_FLASHFS] = {
+        .taskName = "FLASHFS",
+        .taskFunc = flashfsUpdate,
+        .desiredPeriod = TASK_PERIOD_HZ(1000),      // 1000 Hz, a page every 1ms keeps up with 4kHz logging
+        .staticPriority = TASK_PRIORITY_MEDIUM,
+    },
+#endif
+
+#ifdef USE_MSP_PUSH
+    [TASK_MSP_PUSH] = {
+        .taskName = "MSP_PUSH",
+        .taskFunc = taskMspPush,
+        .desiredPeriod = TASK_PERIOD_HZ(100),       // rescheduled to the rate of the fastest subscription
+        .staticPriority = TASK_PRIORITY_LOW,
+    },
+#endif
 };
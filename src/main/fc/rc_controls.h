@@ -93,7 +93,8 @@ typedef enum {
     RC_SMOOTHING_OFF = 0,
     RC_SMOOTHING_DEFAULT,
     RC_SMOOTHING_AUTO,
-    RC_SMOOTHING_MANUAL
+    RC_SMOOTHING_MANUAL,
+    RC_SMOOTHING_FILTER
 } rcSmoothing_t;
 
 #define ROL_LO (1 << (2 * ROLL))
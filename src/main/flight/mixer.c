@@ -70,7 +70,7 @@ PG_RESET_TEMPLATE(mixerConfig_t, mixerConfig,
     .yaw_motors_reversed = false,
 );
 
-PG_REGISTER_WITH_RESET_FN(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 0);
+PG_REGISTER_WITH_RESET_FN(motorConfig_t, motorConfig, PG_MOTOR_CONFIG, 2);
 
 void pgResetFn_motorConfig(motorConfig_t *motorConfig)
 {
@@ -97,6 +97,7 @@ void pgResetFn_motorConfig(motorConfig_t *motorConfig)
     motorConfig->maxthrottle = 2000;
     motorConfig->mincommand = 1000;
     motorConfig->digitalIdleOffsetPercent = 4.5f;
+    motorConfig->motorPoleCount = 14;
 
     int motorIndex = 0;
     for (int i = 0; i < USABLE_TIMER_CHANNEL_COUNT && motorIndex < MAX_SUPPORTED_MOTORS; i++) {
@@ -304,6 +305,21 @@ float getMotorMixRange()
     return motorMixRange;
 }
 
+#ifdef USE_DSHOT_TELEMETRY
+/*
+ * RPM of a motor from the last valid answer of its ESC with dshot_bidir, 0 once it stops answering.
+ */
+uint32_t getMotorRpm(uint8_t motorIndex)
+{
+    if (!useDshotTelemetry || motorIndex >= motorCount) {
+        return 0;
+    }
+
+    // The ESC reports eRPM / 100, an electrical revolution is one pair of poles
+    return (uint32_t)getDshotTelemetry(motorIndex) * 100 * 2 / motorConfig()->motorPoleCount;
+}
+#endif
+
 bool isMotorProtocolDshot(void) {
 #ifdef USE_DSHOT
     switch(motorConfig()->dev.motorPwmProtocol) {
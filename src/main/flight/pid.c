@@ -61,7 +61,7 @@ static float previousGyroIf[3];
 
 static float dT;
 
-PG_REGISTER_WITH_RESET_TEMPLATE(pidConfig_t, pidConfig, PG_PID_CONFIG, 0);
+PG_REGISTER_WITH_RESET_TEMPLATE(pidConfig_t, pidConfig, PG_PID_CONFIG, 1);
 
 #ifdef STM32F10X
 #define PID_PROCESS_DENOM_DEFAULT       1
@@ -71,7 +71,8 @@ PG_REGISTER_WITH_RESET_TEMPLATE(pidConfig_t, pidConfig, PG_PID_CONFIG, 0);
 #define PID_PROCESS_DENOM_DEFAULT       2
 #endif
 PG_RESET_TEMPLATE(pidConfig_t, pidConfig,
-    .pid_process_denom = PID_PROCESS_DENOM_DEFAULT
+    .pid_process_denom = PID_PROCESS_DENOM_DEFAULT,
+    .pid_in_gyro_isr = false
 );
 
 PG_REGISTER_ARRAY_WITH_RESET_FN(pidProfile_t, MAX_PROFILE_COUNT, pidProfiles, PG_PID_PROFILE, 0);
@@ -181,6 +182,9 @@ void pidInitFilters(const pidProfile_t *pidProfile)
 
     BUILD_BUG_ON(FD_YAW != 2); // only setting up Dterm filters on roll and pitch axes, so ensure yaw axis is 2
 
+    // The PID loop may run from the gyro interrupt, it must not see a filter that is only partly set up
+    const uint8_t gyroIsrHeld = gyroIsrHold();
+
     if (pidProfile->dterm_notch_hz == 0 || pidProfile->dterm_notch_hz > pidFrequencyNyquist) {
         dtermNotchFilterApplyFn = nullFilterApply;
     } else {
@@ -230,6 +234,8 @@ void pidInitFilters(const pidProfile_t *pidProfile)
         ptermYawFilter = &pt1FilterYaw;
         pt1FilterInit(ptermYawFilter, pidProfile->yaw_lpf_hz, dT);
     }
+
+    gyroIsrRelease(gyroIsrHeld);
 }
 
 static float Kp[3], Ki[3], Kd[3], maxVelocity[3];
@@ -238,6 +244,8 @@ static float dtermSetpointWeight;
 static float levelGain, horizonGain, horizonTransition, ITermWindupPoint, ITermWindupPointInv;
 
 void pidInitConfig(const pidProfile_t *pidProfile) {
+    // Changed from MSP and adjustments while the PID loop may be running from the gyro interrupt
+    const uint8_t gyroIsrHeld = gyroIsrHold();
     for(int axis = FD_ROLL; axis <= FD_YAW; axis++) {
         Kp[axis] = PTERM_SCALE * pidProfile->P8[axis];
         Ki[axis] = ITERM_SCALE * pidProfile->I8[axis];
@@ -252,13 +260,16 @@ void pidInitConfig(const pidProfile_t *pidProfile) {
     maxVelocity[FD_YAW] = pidProfile->yawRateAccelLimit * 1000 * dT;
     ITermWindupPoint = (float)pidProfile->itermWindupPointPercent / 100.0f;
     ITermWindupPointInv = 1.0f / (1.0f - ITermWindupPoint);
+    gyroIsrRelease(gyroIsrHeld);
 }
 
 void pidInit(const pidProfile_t *pidProfile)
 {
+    const uint8_t gyroIsrHeld = gyroIsrHold();
     pidSetTargetLooptime(gyro.targetLooptime * pidConfig()->pid_process_denom); // Initialize pid looptime
     pidInitFilters(pidProfile);
     pidInitConfig(pidProfile);
+    gyroIsrRelease(gyroIsrHeld);
 }
 
 static float calcHorizonLevelStrength(void) {
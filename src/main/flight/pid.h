@@ -94,6 +94,7 @@ PG_DECLARE_ARRAY(pidProfile_t, MAX_PROFILE_COUNT, pidProfiles);
 
 typedef struct pidConfig_s {
     uint8_t pid_process_denom;              // Processing denominator for PID controller vs gyro sampling rate
+    uint8_t pid_in_gyro_isr;                // Run PID controller and motor update from the gyro data ready interrupt
 } pidConfig_t;
 
 PG_DECLARE(pidConfig_t, pidConfig);
@@ -103,7 +104,6 @@ void pidController(const pidProfile_t *pidProfile, const union rollAndPitchTrims
 
 extern float axisPIDf[3];
 extern int32_t axisPID_P[3], axisPID_I[3], axisPID_D[3];
-bool airmodeWasActivated;
 extern uint32_t targetPidLooptime;
 
 // PIDweight is a scale factor for PIDs which is derived from the throttle and TPA setting, and 100 = 100% scale means no PID reduction
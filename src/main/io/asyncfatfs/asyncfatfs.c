@@ -35,7 +35,13 @@
     #define ONLY_EXPOSE_FOR_TESTING static
 #endif
 
+/*
+ * Sectors of the cache, data appended to a file is buffered here while the card is busy. Targets with the RAM to spare
+ * can set more so that logging rides out slow card writes.
+ */
+#ifndef AFATFS_NUM_CACHE_SECTORS
 #define AFATFS_NUM_CACHE_SECTORS 8
+#endif
 
 // FAT filesystems are allowed to differ from these parameters, but we choose not to support those weird filesystems:
 #define AFATFS_SECTOR_SIZE  512
@@ -443,6 +449,8 @@ typedef struct afatfs_t {
 
     int cacheDirtyEntries; // The number of cache entries in the AFATFS_CACHE_STATE_DIRTY state
     bool cacheFlushInProgress;
+    uint32_t cacheFlushNextSector; // Writing this sector next continues the card's multi-block write
+    afatfsCacheStats_t cacheStats;
 
     afatfsFile_t openFiles[AFATFS_MAX_OPEN_FILES];
 
@@ -489,6 +497,8 @@ typedef struct afatfs_t {
 
 static afatfs_t afatfs;
 
+static const sdcardVTable_t *sdcardDevice;
+
 static void afatfs_fileOperationContinue(afatfsFile_t *file);
 static uint8_t* afatfs_fileLockCursorSectorForWrite(afatfsFilePtr_t file);
 static uint8_t* afatfs_fileRetainCursorSectorForRead(afatfsFilePtr_t file);
@@ -683,22 +693,24 @@ static void afatfs_cacheFlushSector(int cacheIndex)
 
 #ifdef AFATFS_MIN_MULTIPLE_BLOCK_WRITE_COUNT
     if (cacheDescriptor->consecutiveEraseBlockCount) {
-        sdcard_beginWriteBlocks(cacheDescriptor->sectorIndex, cacheDescriptor->consecutiveEraseBlockCount);
+        sdcardDevice->beginWriteBlocks(cacheDescriptor->sectorIndex, cacheDescriptor->consecutiveEraseBlockCount);
     }
 #endif
 
-    switch (sdcard_writeBlock(cacheDescriptor->sectorIndex, afatfs_cacheSectorGetMemory(cacheIndex), afatfs_sdcardWriteComplete, 0)) {
+    switch (sdcardDevice->writeBlock(cacheDescriptor->sectorIndex, afatfs_cacheSectorGetMemory(cacheIndex), afatfs_sdcardWriteComplete, 0)) {
         case SDCARD_OPERATION_IN_PROGRESS:
             // The card will call us back later when the buffer transmission finishes
             afatfs.cacheDirtyEntries--;
             cacheDescriptor->state = AFATFS_CACHE_STATE_WRITING;
             afatfs.cacheFlushInProgress = true;
+            afatfs.cacheFlushNextSector = cacheDescriptor->sectorIndex + 1;
             break;
 
         case SDCARD_OPERATION_SUCCESS:
             // Buffer is already transmitted
             afatfs.cacheDirtyEntries--;
             cacheDescriptor->state = AFATFS_CACHE_STATE_IN_SYNC;
+            afatfs.cacheFlushNextSector = cacheDescriptor->sectorIndex + 1;
             break;
 
         case SDCARD_OPERATION_BUSY:
@@ -816,11 +828,21 @@ bool afatfs_flush()
         int earliestSectorIndex = -1;
 
         for (int i = 0; i < AFATFS_NUM_CACHE_SECTORS; i++) {
-            if (afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_DIRTY && !afatfs.cacheDescriptor[i].locked
-                && (earliestSectorIndex == -1 || afatfs.cacheDescriptor[i].writeTimestamp < earliestSectorTime)
-            ) {
-                earliestSectorIndex = i;
-                earliestSectorTime = afatfs.cacheDescriptor[i].writeTimestamp;
+            if (afatfs.cacheDescriptor[i].state == AFATFS_CACHE_STATE_DIRTY && !afatfs.cacheDescriptor[i].locked) {
+                /*
+                 * Unless the sector follows the last one written, the card's multi-block write would have to be
+                 * stopped for it. Appended data is flushed in order ahead of FAT and directory sectors so that the
+                 * card can keep streaming it.
+                 */
+                if (afatfs.cacheDescriptor[i].sectorIndex == afatfs.cacheFlushNextSector) {
+                    earliestSectorIndex = i;
+                    break;
+                }
+
+                if (earliestSectorIndex == -1 || afatfs.cacheDescriptor[i].writeTimestamp < earliestSectorTime) {
+                    earliestSectorIndex = i;
+                    earliestSectorTime = afatfs.cacheDescriptor[i].writeTimestamp;
+                }
             }
         }
 
@@ -916,8 +938,9 @@ static afatfsOperationStatus_e afatfs_cacheSector(uint32_t physicalSectorIndex,
 
         case AFATFS_CACHE_STATE_EMPTY:
             if ((sectorFlags & AFATFS_CACHE_READ) != 0) {
-                if (sdcard_readBlock(physicalSectorIndex, afatfs_cacheSectorGetMemory(cacheSectorIndex), afatfs_sdcardReadComplete, 0)) {
+                if (sdcardDevice->readBlock(physicalSectorIndex, afatfs_cacheSectorGetMemory(cacheSectorIndex), afatfs_sdcardReadComplete, 0)) {
                     afatfs.cacheDescriptor[cacheSectorIndex].state = AFATFS_CACHE_STATE_READING;
+                    afatfs.cacheStats.misses++;
                 }
                 return AFATFS_OPERATION_IN_PROGRESS;
             }
@@ -946,6 +969,10 @@ static afatfsOperationStatus_e afatfs_cacheSector(uint32_t physicalSectorIndex,
             // Fall through
 
         case AFATFS_CACHE_STATE_DIRTY:
+            // A read of an EMPTY sector never gets here, so this read was served from the cache
+            if ((sectorFlags & AFATFS_CACHE_READ) != 0) {
+                afatfs.cacheStats.hits++;
+            }
             if ((sectorFlags & AFATFS_CACHE_LOCK) != 0) {
                 afatfs.cacheDescriptor[cacheSectorIndex].locked = 1;
             }
@@ -1881,6 +1908,9 @@ static uint8_t* afatfs_fileLockCursorSectorForWrite(afatfsFilePtr_t file)
             uint32_t cursorOffsetInSupercluster = file->cursorOffset & (afatfs_superClusterSize() - 1);
 
             eraseBlockCount = afatfs_fatEntriesPerSector() * afatfs.sectorsPerCluster - cursorOffsetInSupercluster / AFATFS_SECTOR_SIZE;
+        } else if ((file->mode & AFATFS_FILE_MODE_APPEND) != 0 && file->type == AFATFS_FILE_TYPE_NORMAL) {
+            // Other appended files are only known to continue consecutively to the end of the cluster
+            eraseBlockCount = afatfs.sectorsPerCluster - afatfs_sectorIndexInCluster(file->cursorOffset);
         } else {
             eraseBlockCount = 0;
         }
@@ -3496,7 +3526,7 @@ static void afatfs_initContinue()
 void afatfs_poll()
 {
     // Only attempt to continue FS operations if the card is present & ready, otherwise we would just be wasting time
-    if (sdcard_poll()) {
+    if (sdcardDevice->poll()) {
         afatfs_flush();
 
         switch (afatfs.filesystemState) {
@@ -3566,8 +3596,23 @@ afatfsError_e afatfs_getLastError()
     return afatfs.lastError;
 }
 
-void afatfs_init()
+/**
+ * Counts of the sector reads that were served from the cache and those that had to go to the card, since the
+ * filesystem was initialised.
+ */
+void afatfs_getCacheStats(afatfsCacheStats_t *stats)
+{
+    *stats = afatfs.cacheStats;
+}
+
+/**
+ * Begin mounting the filesystem on the given card, the card must already have been initialised. Call afatfs_poll()
+ * until afatfs_getFilesystemState() reports that the filesystem is ready.
+ */
+void afatfs_init(const sdcardVTable_t *device)
 {
+    sdcardDevice = device;
+
     afatfs.filesystemState = AFATFS_FILESYSTEM_STATE_INITIALIZATION;
     afatfs.initPhase = AFATFS_INITIALIZATION_READ_MBR;
     afatfs.lastClusterAllocated = FAT_SMALLEST_LEGAL_CLUSTER_NUMBER;
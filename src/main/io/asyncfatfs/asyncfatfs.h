@@ -22,6 +22,8 @@
 
 #include "fat_standard.h"
 
+#include "drivers/sdcard.h"
+
 typedef struct afatfsFile_t *afatfsFilePtr_t;
 
 typedef enum {
@@ -57,6 +59,11 @@ typedef enum {
     AFATFS_SEEK_END
 } afatfsSeek_e;
 
+typedef struct afatfsCacheStats_t {
+    uint32_t hits;   // Sector reads served from the cache
+    uint32_t misses; // Sector reads that went to the card
+} afatfsCacheStats_t;
+
 typedef void (*afatfsFileCallback_t)(afatfsFilePtr_t file);
 typedef void (*afatfsCallback_t)();
 
@@ -80,7 +87,7 @@ afatfsOperationStatus_e afatfs_findNext(afatfsFilePtr_t directory, afatfsFinder_
 void afatfs_findLast(afatfsFilePtr_t directory);
 
 bool afatfs_flush();
-void afatfs_init();
+void afatfs_init(const sdcardVTable_t *device);
 bool afatfs_destroy(bool dirty);
 void afatfs_poll();
 
@@ -90,3 +97,4 @@ bool afatfs_isFull();
 
 afatfsFilesystemState_e afatfs_getFilesystemState();
 afatfsError_e afatfs_getLastError();
+void afatfs_getCacheStats(afatfsCacheStats_t *stats);
@@ -18,26 +18,38 @@
 /**
  * This provides a stream interface to a flash chip if one is present.
  *
- * On statup, call flashfsInit() after initialising the flash chip in order to init the filesystem. This will
+ * On statup, call flashfsInit() with the flash chip's vtable after initialising the chip in order to init the filesystem. This will
  * result in the file pointer being pointed at the first free block found, or at the end of the device if the
  * flash chip is full.
  *
  * Note that bits can only be set to 0 when writing, not back to 1 from 0. You must erase sectors in order
  * to bring bits back to 1 again.
  *
- * In future, we can add support for multiple different flash chips by adding a flash device driver vtable
- * and make calls through that, at the moment flashfs just calls m25p16_* routines explicitly.
+ * Writes are buffered and flashfsUpdate() is called from the scheduler to program the buffered data a page at a time
+ * whenever the flash is idle, so that the writer never has to wait for the flash.
+ *
+ * With USE_FLASHFS_LOG_INDEX the last two sectors hold an index of the logs on the volume, see below.
+ *
+ * All access to the chip goes through the flashVTable_t given to flashfsInit(), so the same code runs against a
+ * disk image on the host (see drivers/block_device_mmap.c).
  */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
 
+#include "platform.h"
+
+#include "common/maths.h"
+#include "common/utils.h"
+
 #include "drivers/flash.h"
-#include "drivers/flash_m25p16.h"
 
 #include "io/flashfs.h"
 
+static const flashVTable_t *flashDevice;
+
 static uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
 
 /* The position of our head and tail in the circular flash write buffer.
@@ -47,11 +59,81 @@ static uint8_t flashWriteBuffer[FLASHFS_WRITE_BUFFER_SIZE];
  *
  * When the circular buffer is empty, head == tail
  */
-static uint8_t bufferHead = 0, bufferTail = 0;
+static uint16_t bufferHead = 0, bufferTail = 0;
 
 // The position of the buffer's tail in the overall flash address space:
 static uint32_t tailAddress = 0;
 
+// The number of erased bytes that can be written from the tail address onwards:
+static uint32_t freeSpace = 0;
+
+#ifdef USE_FLASHFS_LOG_INDEX
+// The log index alternates between the last two sectors of the flash
+#define FLASHFS_LOG_INDEX_SECTORS 2
+
+static bool logIndexEnabled = false;
+
+// Sectors queued for erasing by flashfsEraseOldestLogs(), erased one at a time by flashfsUpdate()
+static uint32_t eraseAddress;
+static uint16_t eraseSectorsPending = 0;
+
+static void flashfsLogIndexReset(void);
+#endif
+
+// From the geometry of the device, set by flashfsInit()
+static uint16_t flashPageSize;
+
+#ifdef USE_FLASH_M25P16_DMA
+#define FLASHFS_PAGE_BUFFER_SIZE 256 // the largest page that can be programmed from the page buffers
+
+/*
+ * Pages are gathered from the write buffer into one of these and sent to the flash by DMA from there, the other one
+ * is free to be filled with the next page while the first is still being transferred. Only used when the device can
+ * program a page in the background and its pages fit.
+ */
+static bool flashPageBuffered = false;
+static uint8_t flashPageBuffer[2][FLASHFS_PAGE_BUFFER_SIZE];
+static uint8_t flashPageBufferIndex = 0;
+static uint16_t flashPageLength;
+static uint32_t flashPageAddress;
+#endif
+
+static void flashfsPageProgramBegin(uint32_t address)
+{
+#ifdef USE_FLASH_M25P16_DMA
+    if (flashPageBuffered) {
+        flashPageAddress = address;
+        flashPageLength = 0;
+        return;
+    }
+#endif
+    flashDevice->pageProgramBegin(address);
+}
+
+static void flashfsPageProgramContinue(const uint8_t *data, int length)
+{
+#ifdef USE_FLASH_M25P16_DMA
+    if (flashPageBuffered) {
+        memcpy(flashPageBuffer[flashPageBufferIndex] + flashPageLength, data, length);
+        flashPageLength += length;
+        return;
+    }
+#endif
+    flashDevice->pageProgramContinue(data, length);
+}
+
+static void flashfsPageProgramFinish(void)
+{
+#ifdef USE_FLASH_M25P16_DMA
+    if (flashPageBuffered) {
+        flashDevice->pageProgramStart(flashPageAddress, flashPageBuffer[flashPageBufferIndex], flashPageLength);
+        flashPageBufferIndex ^= 1;
+        return;
+    }
+#endif
+    flashDevice->pageProgramFinish();
+}
+
 static void flashfsClearBuffer()
 {
     bufferTail = bufferHead = 0;
@@ -65,14 +147,34 @@ static bool flashfsBufferIsEmpty()
 static void flashfsSetTailAddress(uint32_t address)
 {
     tailAddress = address;
+    freeSpace = address < flashfsGetSize() ? flashfsGetSize() - address : 0;
+}
+
+/**
+ * Advance the tail past bytes that have been written to the flash. With a log index the volume is a ring, writing
+ * continues at the start of the volume if the free space carries on there.
+ */
+static void flashfsAdvanceTailAddress(uint32_t delta)
+{
+    tailAddress += delta;
+    freeSpace -= delta;
+
+    if (tailAddress >= flashfsGetSize() && freeSpace > 0) {
+        tailAddress -= flashfsGetSize();
+    }
 }
 
 void flashfsEraseCompletely()
 {
-    m25p16_eraseCompletely();
+    flashDevice->eraseCompletely();
 
     flashfsClearBuffer();
 
+#ifdef USE_FLASHFS_LOG_INDEX
+    // The index sectors are erased along with the rest, so it can be used from now on
+    flashfsLogIndexReset();
+#endif
+
     flashfsSetTailAddress(0);
 }
 
@@ -82,7 +184,7 @@ void flashfsEraseCompletely()
  */
 void flashfsEraseRange(uint32_t start, uint32_t end)
 {
-    const flashGeometry_t *geometry = m25p16_getGeometry();
+    const flashGeometry_t *geometry = flashDevice->getGeometry();
 
     if (geometry->sectorSize <= 0)
         return;
@@ -99,7 +201,7 @@ void flashfsEraseRange(uint32_t start, uint32_t end)
     }
 
     for (int i = startSector; i < endSector; i++) {
-        m25p16_eraseSector(i * geometry->sectorSize);
+        flashDevice->eraseSector(i * geometry->sectorSize);
     }
 }
 
@@ -108,12 +210,24 @@ void flashfsEraseRange(uint32_t start, uint32_t end)
  */
 bool flashfsIsReady()
 {
-    return m25p16_isReady();
+#ifdef USE_FLASHFS_LOG_INDEX
+    if (eraseSectorsPending > 0) {
+        return false;
+    }
+#endif
+
+    return flashDevice->isReady();
 }
 
 uint32_t flashfsGetSize()
 {
-    return m25p16_getGeometry()->totalSize;
+#ifdef USE_FLASHFS_LOG_INDEX
+    if (logIndexEnabled) {
+        return flashDevice->getGeometry()->totalSize - FLASHFS_LOG_INDEX_SECTORS * flashDevice->getGeometry()->sectorSize;
+    }
+#endif
+
+    return flashDevice->getGeometry()->totalSize;
 }
 
 static uint32_t flashfsTransmitBufferUsed()
@@ -142,7 +256,7 @@ uint32_t flashfsGetWriteBufferFreeSpace()
 
 const flashGeometry_t* flashfsGetGeometry()
 {
-    return m25p16_getGeometry();
+    return flashDevice->getGeometry();
 }
 
 /**
@@ -174,7 +288,7 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
         bytesTotal += bufferSizes[i];
     }
 
-    if (!sync && !m25p16_isReady()) {
+    if (!sync && !flashDevice->isReady()) {
         return 0;
     }
 
@@ -188,8 +302,8 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
          * Each page needs to be saved in a separate program operation, so
          * if we would cross a page boundary, only write up to the boundary in this iteration:
          */
-        if (tailAddress % M25P16_PAGESIZE + bytesTotalRemaining > M25P16_PAGESIZE) {
-            bytesTotalThisIteration = M25P16_PAGESIZE - tailAddress % M25P16_PAGESIZE;
+        if (tailAddress % flashPageSize + bytesTotalRemaining > flashPageSize) {
+            bytesTotalThisIteration = flashPageSize - tailAddress % flashPageSize;
         } else {
             bytesTotalThisIteration = bytesTotalRemaining;
         }
@@ -202,7 +316,7 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
             break;
         }
 
-        m25p16_pageProgramBegin(tailAddress);
+        flashfsPageProgramBegin(tailAddress);
 
         bytesRemainThisIteration = bytesTotalThisIteration;
 
@@ -210,7 +324,7 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
             if (bufferSizes[i] > 0) {
                 // Is buffer larger than our write limit? Write our limit out of it
                 if (bufferSizes[i] >= bytesRemainThisIteration) {
-                    m25p16_pageProgramContinue(buffers[i], bytesRemainThisIteration);
+                    flashfsPageProgramContinue(buffers[i], bytesRemainThisIteration);
 
                     buffers[i] += bytesRemainThisIteration;
                     bufferSizes[i] -= bytesRemainThisIteration;
@@ -219,7 +333,7 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
                     break;
                 } else {
                     // We'll still have more to write after finishing this buffer off
-                    m25p16_pageProgramContinue(buffers[i], bufferSizes[i]);
+                    flashfsPageProgramContinue(buffers[i], bufferSizes[i]);
 
                     bytesRemainThisIteration -= bufferSizes[i];
 
@@ -229,12 +343,12 @@ static uint32_t flashfsWriteBuffers(uint8_t const **buffers, uint32_t *bufferSiz
             }
         }
 
-        m25p16_pageProgramFinish();
+        flashfsPageProgramFinish();
 
         bytesTotalRemaining -= bytesTotalThisIteration;
 
         // Advance the cursor in the file system to match the bytes we wrote
-        flashfsSetTailAddress(tailAddress + bytesTotalThisIteration);
+        flashfsAdvanceTailAddress(bytesTotalThisIteration);
 
         /*
          * We'll have to wait for that write to complete before we can issue the next one, so if
@@ -279,7 +393,15 @@ uint32_t flashfsGetOffset()
 
     flashfsGetDirtyDataBuffers(buffers, bufferSizes);
 
-    return tailAddress + bufferSizes[0] + bufferSizes[1];
+    uint32_t offset = tailAddress + bufferSizes[0] + bufferSizes[1];
+
+#ifdef USE_FLASHFS_LOG_INDEX
+    if (logIndexEnabled && offset >= flashfsGetSize()) {
+        offset -= flashfsGetSize();
+    }
+#endif
+
+    return offset;
 }
 
 /**
@@ -476,15 +598,16 @@ int flashfsReadAbs(uint32_t address, uint8_t *buffer, unsigned int len)
     // Since the read could overlap data in our dirty buffers, force a sync to clear those first
     flashfsFlushSync();
 
-    bytesRead = m25p16_readBytes(address, buffer, len);
+    bytesRead = flashDevice->readBytes(address, buffer, len);
 
     return bytesRead;
 }
 
 /**
- * Find the offset of the start of the free space on the device (or the size of the device if it is full).
+ * Find the offset of the first erased block in `length` bytes of the volume from `start`, wrapping around the end of
+ * the volume, or `length` if there is none.
  */
-int flashfsIdentifyStartOfFreeSpace()
+static uint32_t flashfsFindStartOfFreeSpace(uint32_t start, uint32_t length)
 {
     /* Find the start of the free space on the device by examining the beginning of blocks with a binary search,
      * looking for ones that appear to be erased. We can achieve this with good accuracy because an erased block
@@ -512,7 +635,7 @@ int flashfsIdentifyStartOfFreeSpace()
     } testBuffer;
 
     int left = 0; // Smallest block index in the search region
-    int right = flashfsGetSize() / FREE_BLOCK_SIZE; // One past the largest block index in the search region
+    int right = (length + FREE_BLOCK_SIZE - 1) / FREE_BLOCK_SIZE; // One past the largest block index in the search region
     int mid;
     int result = right;
     int i;
@@ -521,7 +644,7 @@ int flashfsIdentifyStartOfFreeSpace()
     while (left < right) {
         mid = (left + right) / 2;
 
-        if (m25p16_readBytes(mid * FREE_BLOCK_SIZE, testBuffer.bytes, FREE_BLOCK_TEST_SIZE_BYTES) < FREE_BLOCK_TEST_SIZE_BYTES) {
+        if (flashDevice->readBytes((start + mid * FREE_BLOCK_SIZE) % flashfsGetSize(), testBuffer.bytes, FREE_BLOCK_TEST_SIZE_BYTES) < FREE_BLOCK_TEST_SIZE_BYTES) {
             // Unexpected timeout from flash, so bail early (reporting the device fuller than it really is)
             break;
         }
@@ -547,23 +670,572 @@ int flashfsIdentifyStartOfFreeSpace()
         }
     }
 
-    return result * FREE_BLOCK_SIZE;
+    return MIN((uint32_t)result * FREE_BLOCK_SIZE, length);
+}
+
+/**
+ * Find the offset of the start of the free space on the device (or the size of the device if it is full).
+ */
+int flashfsIdentifyStartOfFreeSpace()
+{
+    return flashfsFindStartOfFreeSpace(0, flashfsGetSize());
 }
 
 /**
  * Returns true if the file pointer is at the end of the device.
  */
 bool flashfsIsEOF() {
-    return tailAddress >= flashfsGetSize();
+#ifdef USE_FLASHFS_LOG_INDEX
+    if (logIndexEnabled) {
+        // The ring is never filled completely, so that the end of the newest log never meets the start of the oldest
+        return freeSpace <= flashPageSize;
+    }
+#endif
+
+    return freeSpace == 0;
+}
+
+#ifdef USE_FLASHFS_LOG_INDEX
+/*
+ * The log index is a journal in one of the last two sectors of the flash with an entry for each log, in the order the
+ * logs were written. An entry is written when a log begins and its length is programmed into it when the log ends.
+ *
+ * The oldest logs can be erased to make room for new ones, which makes the rest of the flash a ring: writing carries
+ * on at the start of the volume once the end is reached. Entries are never rewritten, bits are only ever cleared in
+ * them, so the journal is always made up of:
+ *
+ *   [0]                                 the header, with the sequence number of this copy of the journal
+ *   [1, logIndexFirst)                  entries of logs that have been erased
+ *   [logIndexFirst, logIndexEnd)        the logs on the volume, oldest first
+ *   [logIndexEnd, logIndexCapacity)     erased entries
+ *
+ * Both boundaries are found by binary search at startup, and the end of the newest log is the start of the free
+ * space which runs up to the sector holding the start of the oldest log.
+ *
+ * Once most of the journal is used it is compacted into the other sector, and the header with the next sequence
+ * number is programmed only after all the entries. The copy with the highest sequence number among those with a
+ * complete header is used, the previous copy is left alone until the next compaction erases it. So a power loss at
+ * any point leaves a whole journal on the flash.
+ */
+
+#define FLASHFS_LOG_ENTRY_MAGIC         0x474c
+#define FLASHFS_LOG_HEADER_MAGIC        0x4947
+#define FLASHFS_LOG_FLAG_ERASED         0x0001  // cleared once the log is erased
+#define FLASHFS_LOG_LENGTH_OPEN         0xffffffff
+
+// When compacting the journal, logs beyond this many are merged into the oldest one
+#define FLASHFS_LOG_COMPACT_MAX_LOGS    16
+
+#define FLASHFS_SECTOR_ERASE_TIMEOUT_MILLIS 5000
+
+typedef struct flashfsLogEntry_s {
+    uint16_t magic;
+    uint16_t flags;
+    uint32_t start;
+    uint32_t length;
+    uint32_t durationMs;
+} flashfsLogEntry_t;
+
+// Takes the first entry of the journal
+typedef struct flashfsLogHeader_s {
+    uint16_t magic;
+    uint16_t flags;
+    uint32_t sequence;
+    uint32_t sequenceCheck;     // ~sequence, so that a header that was only partly programmed is not used
+    uint32_t reserved;
+} flashfsLogHeader_t;
+
+static uint16_t logIndexCapacity;
+static uint16_t logIndexFirst;
+static uint16_t logIndexEnd;
+
+// Which of the index sectors holds the journal in use, and its sequence number
+static uint8_t logIndexSector;
+static uint32_t logIndexSequence;
+// The header of an empty journal is only programmed along with its first entry
+static bool logIndexHeaderWritten;
+
+// The newest log is still being written
+static bool logOpen = false;
+static uint32_t logOpenStart;
+
+static void flashfsLogIndexReset(void)
+{
+    logIndexEnabled = true;
+    logIndexCapacity = flashDevice->getGeometry()->sectorSize / sizeof(flashfsLogEntry_t);
+    logIndexFirst = 1;
+    logIndexEnd = 1;
+    logIndexSector = 0;
+    logIndexSequence = 0;
+    logIndexHeaderWritten = false;
+    logOpen = false;
+    eraseSectorsPending = 0;
+}
+
+static uint32_t flashfsLogIndexAddress(int sector, int index)
+{
+    // The index sectors follow the end of the volume
+    return flashfsGetSize() + sector * flashDevice->getGeometry()->sectorSize + index * sizeof(flashfsLogEntry_t);
+}
+
+static uint32_t flashfsLogEntryAddress(int index)
+{
+    return flashfsLogIndexAddress(logIndexSector, index);
+}
+
+/**
+ * Distance from one address to another going forwards around the ring.
+ */
+static uint32_t flashfsRingDistance(uint32_t from, uint32_t to)
+{
+    return to >= from ? to - from : flashfsGetSize() - from + to;
+}
+
+static uint32_t flashfsSectorStart(uint32_t address)
+{
+    return address - address % flashDevice->getGeometry()->sectorSize;
+}
+
+static void flashfsReadLogEntry(int index, flashfsLogEntry_t *entry)
+{
+    if (flashDevice->readBytes(flashfsLogEntryAddress(index), (uint8_t *)entry, sizeof(*entry)) < (int)sizeof(*entry)) {
+        // Timeout from the flash, treat the entry as unwritten
+        memset(entry, 0xff, sizeof(*entry));
+    }
+}
+
+/**
+ * Read the header of the journal in the given index sector, returns true if it is complete.
+ */
+static bool flashfsReadLogHeader(int sector, flashfsLogHeader_t *header)
+{
+    if (flashDevice->readBytes(flashfsLogIndexAddress(sector, 0), (uint8_t *)header, sizeof(*header)) < (int)sizeof(*header)) {
+        memset(header, 0xff, sizeof(*header));
+    }
+
+    return header->magic == FLASHFS_LOG_HEADER_MAGIC && header->sequenceCheck == ~header->sequence;
+}
+
+static void flashfsWriteLogHeader(void)
+{
+    const flashfsLogHeader_t header = {
+        .magic = FLASHFS_LOG_HEADER_MAGIC,
+        .flags = 0xffff,
+        .sequence = logIndexSequence,
+        .sequenceCheck = ~logIndexSequence,
+        .reserved = 0xffffffff,
+    };
+    flashDevice->pageProgram(flashfsLogEntryAddress(0), (const uint8_t *)&header, sizeof(header));
+    logIndexHeaderWritten = true;
+}
+
+static bool flashfsAppendLogEntry(uint32_t start, uint32_t length, uint32_t durationMs)
+{
+    if (logIndexEnd >= logIndexCapacity) {
+        return false;
+    }
+
+    if (!logIndexHeaderWritten) {
+        flashfsWriteLogHeader();
+    }
+
+    const flashfsLogEntry_t entry = {
+        .magic = FLASHFS_LOG_ENTRY_MAGIC,
+        .flags = 0xffff,
+        .start = start,
+        .length = length,
+        .durationMs = durationMs,
+    };
+    flashDevice->pageProgram(flashfsLogEntryAddress(logIndexEnd), (const uint8_t *)&entry, sizeof(entry));
+    logIndexEnd++;
+
+    return true;
+}
+
+static void flashfsCloseLogEntry(int index, uint32_t length, uint32_t durationMs)
+{
+    // The length and duration of an open entry are still erased, so they can be programmed in place
+    const uint32_t closing[2] = { length, durationMs };
+    flashDevice->pageProgram(flashfsLogEntryAddress(index) + offsetof(flashfsLogEntry_t, length), (const uint8_t *)closing, sizeof(closing));
+}
+
+/**
+ * Binary search for the first entry in [left, right) that is unwritten (findEnd) or else whose log has not been
+ * erased.
+ */
+static int flashfsSearchLogIndex(int left, int right, bool findEnd)
+{
+    while (left < right) {
+        const int mid = (left + right) / 2;
+        flashfsLogEntry_t entry;
+
+        flashfsReadLogEntry(mid, &entry);
+
+        const bool found = findEnd ? entry.magic != FLASHFS_LOG_ENTRY_MAGIC : (entry.flags & FLASHFS_LOG_FLAG_ERASED) != 0;
+        if (found) {
+            right = mid;
+        } else {
+            left = mid + 1;
+        }
+    }
+
+    return left;
+}
+
+/**
+ * Rewrite the journal with only the logs still on the volume into the other index sector. This erases that sector, so
+ * it is only done at startup once most of the journal has been used.
+ */
+static void flashfsCompactLogIndex(void)
+{
+    flashfsLogEntry_t entries[FLASHFS_LOG_COMPACT_MAX_LOGS];
+    const int count = logIndexEnd - logIndexFirst;
+    // The oldest logs are merged into one if there are too many to keep
+    const int merged = count > FLASHFS_LOG_COMPACT_MAX_LOGS ? count - FLASHFS_LOG_COMPACT_MAX_LOGS + 1 : 1;
+
+    flashfsReadLogEntry(logIndexFirst, &entries[0]);
+    if (merged > 1) {
+        flashfsLogEntry_t last;
+        flashfsReadLogEntry(logIndexFirst + merged - 1, &last);
+
+        entries[0].length = flashfsRingDistance(entries[0].start, (last.start + last.length) % flashfsGetSize());
+        entries[0].durationMs = FLASHFS_LOG_DURATION_UNKNOWN;
+    }
+    int kept = 1;
+    for (int i = logIndexFirst + merged; i < logIndexEnd; i++) {
+        flashfsReadLogEntry(i, &entries[kept++]);
+    }
+
+    // The journal in use stays as it is, the sector it is compacted into holds the copy before it
+    logIndexSector ^= 1;
+    logIndexSequence++;
+
+    flashDevice->eraseSector(flashfsLogEntryAddress(0));
+    flashDevice->waitForReady(FLASHFS_SECTOR_ERASE_TIMEOUT_MILLIS);
+
+    logIndexFirst = 1;
+    logIndexEnd = 1;
+    // Entries first, the new copy is only used once its header has been programmed after them
+    logIndexHeaderWritten = true;
+    for (int i = 0; i < kept; i++) {
+        flashfsAppendLogEntry(entries[i].start, entries[i].length, entries[i].durationMs);
+    }
+    flashfsWriteLogHeader();
+}
+
+/**
+ * Find the logs and the free space on the volume from the index.
+ *
+ * Returns false if the index can't be used because the index sectors hold log data written without an index, the
+ * whole flash has to be erased before the index can be used then.
+ */
+static bool flashfsLogIndexInit(void)
+{
+    flashfsLogIndexReset();
+
+    flashfsLogHeader_t headers[FLASHFS_LOG_INDEX_SECTORS];
+    const bool valid[FLASHFS_LOG_INDEX_SECTORS] = { flashfsReadLogHeader(0, &headers[0]), flashfsReadLogHeader(1, &headers[1]) };
+
+    if (!valid[0] && !valid[1]) {
+        /*
+         * No index yet, look for logs written without one. A journal is never without a complete copy once it has
+         * been written, so the flash has only been used from the start up.
+         */
+        logIndexEnabled = false;
+
+        const uint32_t freeStart = flashfsIdentifyStartOfFreeSpace();
+        if (headers[0].magic != 0xffff || headers[1].magic != 0xffff
+            || freeStart > flashfsGetSize() - FLASHFS_LOG_INDEX_SECTORS * flashDevice->getGeometry()->sectorSize) {
+            return false;
+        }
+
+        logIndexEnabled = true;
+        if (freeStart > 0) {
+            // Keep whatever is there as a single log so that it can still be downloaded
+            flashfsAppendLogEntry(0, freeStart, FLASHFS_LOG_DURATION_UNKNOWN);
+        }
+        flashfsSetTailAddress(freeStart);
+
+        return true;
+    }
+
+    // The sequence numbers are compared so that they can wrap
+    logIndexSector = valid[1] && (!valid[0] || (int32_t)(headers[1].sequence - headers[0].sequence) > 0) ? 1 : 0;
+    logIndexSequence = headers[logIndexSector].sequence;
+    logIndexHeaderWritten = true;
+
+    logIndexEnd = flashfsSearchLogIndex(1, logIndexCapacity, true);
+    if (logIndexEnd == 1) {
+        // Power was lost between the header of an empty journal and its first entry, nothing was logged
+        flashfsSetTailAddress(0);
+        return true;
+    }
+    logIndexFirst = flashfsSearchLogIndex(1, logIndexEnd, false);
+    if (logIndexFirst == logIndexEnd) {
+        // Only happens if the journal is damaged, keep the space of the newest log reserved
+        logIndexFirst = logIndexEnd - 1;
+    }
+
+    flashfsLogEntry_t oldest, newest;
+    flashfsReadLogEntry(logIndexFirst, &oldest);
+    flashfsReadLogEntry(logIndexEnd - 1, &newest);
+
+    const uint32_t freeEnd = flashfsSectorStart(oldest.start);
+    bool full = false;
+
+    if (newest.length == FLASHFS_LOG_LENGTH_OPEN) {
+        // Power was lost while logging, the log runs up to the erased space that follows it
+        uint32_t searchLength = flashfsRingDistance(newest.start, freeEnd);
+        if (searchLength == 0) {
+            searchLength = flashfsGetSize();
+        }
+        newest.length = flashfsFindStartOfFreeSpace(newest.start, searchLength);
+        full = newest.length == searchLength;
+
+        flashfsCloseLogEntry(logIndexEnd - 1, newest.length, FLASHFS_LOG_DURATION_UNKNOWN);
+    }
+
+    tailAddress = (newest.start + newest.length) % flashfsGetSize();
+    if (full) {
+        freeSpace = 0;
+    } else if (tailAddress == freeEnd) {
+        // The ring is never filled completely, so the logs left are all empty
+        freeSpace = flashfsGetSize();
+    } else {
+        freeSpace = flashfsRingDistance(tailAddress, freeEnd);
+    }
+
+    if (logIndexEnd > logIndexCapacity * 3 / 4) {
+        flashfsCompactLogIndex();
+    }
+
+    return true;
+}
+
+/**
+ * Returns true if there is no room in the index for another log.
+ */
+bool flashfsLogIndexIsFull(void)
+{
+    return logIndexEnabled && logIndexEnd >= logIndexCapacity;
+}
+
+int flashfsGetLogCount(void)
+{
+    return logIndexEnabled ? logIndexEnd - logIndexFirst : 0;
+}
+
+/**
+ * Fetch the log at the given index, 0 is the oldest log on the volume.
+ */
+bool flashfsGetLog(int index, flashfsLog_t *log)
+{
+    if (index < 0 || index >= flashfsGetLogCount()) {
+        return false;
+    }
+
+    flashfsLogEntry_t entry;
+    flashfsReadLogEntry(logIndexFirst + index, &entry);
+
+    log->start = entry.start;
+    log->open = entry.length == FLASHFS_LOG_LENGTH_OPEN;
+    // The open log runs up to everything written so far
+    log->length = log->open ? flashfsRingDistance(entry.start, flashfsGetOffset()) : entry.length;
+    log->durationMs = entry.durationMs;
+
+    return true;
+}
+
+/**
+ * Read `len` bytes from `offset` in the log at the given index into the supplied buffer.
+ *
+ * Returns the number of bytes actually read, which is less than that requested at the end of the log.
+ */
+int flashfsReadLog(int index, uint32_t offset, uint8_t *buffer, unsigned int len)
+{
+    flashfsLog_t log;
+
+    if (!flashfsGetLog(index, &log) || offset >= log.length) {
+        return 0;
+    }
+
+    len = MIN(len, log.length - offset);
+
+    const uint32_t address = (log.start + offset) % flashfsGetSize();
+    int bytesRead = flashfsReadAbs(address, buffer, len);
+
+    // Logs wrap around the end of the volume
+    if (address + bytesRead == flashfsGetSize() && (unsigned int)bytesRead < len) {
+        bytesRead += flashfsReadAbs(0, buffer + bytesRead, len - bytesRead);
+    }
+
+    return bytesRead;
+}
+
+/**
+ * Start a new log at the current offset.
+ *
+ * Returns false if the flash is busy, call again later.
+ */
+bool flashfsLogBegin(void)
+{
+    if (!logIndexEnabled) {
+        return true;
+    }
+
+    if (!flashfsIsReady()) {
+        return false;
+    }
+
+    // A log that was never closed ends where this one starts
+    flashfsLogEnd(FLASHFS_LOG_DURATION_UNKNOWN);
+
+    logOpenStart = flashfsGetOffset();
+    logOpen = flashfsAppendLogEntry(logOpenStart, FLASHFS_LOG_LENGTH_OPEN, FLASHFS_LOG_LENGTH_OPEN);
+
+    return true;
+}
+
+/**
+ * Close the log being written, once all of it has been written to the flash.
+ */
+void flashfsLogEnd(uint32_t durationMs)
+{
+    if (!logIndexEnabled || !logOpen) {
+        return;
+    }
+
+    // The length has to match what made it to the flash, data that doesn't fit is dropped when flushing
+    flashfsFlushSync();
+
+    flashfsCloseLogEntry(logIndexEnd - 1, flashfsRingDistance(logOpenStart, tailAddress), durationMs);
+    logOpen = false;
+}
+
+/**
+ * Erase the oldest `count` logs to make room for new ones. The sectors they occupy are erased in the background by
+ * flashfsUpdate(), erasing every log erases the whole flash.
+ *
+ * Returns false if there are not that many logs, a log is being written or an erase is already in progress.
+ */
+bool flashfsEraseOldestLogs(int count)
+{
+    if (count <= 0 || count > flashfsGetLogCount() || logOpen || eraseSectorsPending > 0) {
+        return false;
+    }
+
+    if (count == flashfsGetLogCount()) {
+        flashfsEraseCompletely();
+        return true;
+    }
+
+    flashfsLogEntry_t oldest, next;
+    flashfsReadLogEntry(logIndexFirst, &oldest);
+    flashfsReadLogEntry(logIndexFirst + count, &next);
+
+    const uint16_t erasedFlags = (uint16_t)~FLASHFS_LOG_FLAG_ERASED;
+    for (int i = 0; i < count; i++) {
+        flashDevice->pageProgram(flashfsLogEntryAddress(logIndexFirst + i) + offsetof(flashfsLogEntry_t, flags), (const uint8_t *)&erasedFlags, sizeof(erasedFlags));
+    }
+    logIndexFirst += count;
+
+    // The sector holding the start of the next log is kept, along with the end of the last log erased
+    eraseAddress = flashfsSectorStart(oldest.start);
+    eraseSectorsPending = flashfsRingDistance(eraseAddress, flashfsSectorStart(next.start)) / flashDevice->getGeometry()->sectorSize;
+
+    return true;
 }
 
 /**
- * Call after initializing the flash chip in order to set up the filesystem.
+ * Erase the next sector queued by flashfsEraseOldestLogs() once the flash is idle.
  */
-void flashfsInit()
+static void flashfsEraseNextSector(void)
 {
+    if (!flashDevice->isReady()) {
+        return;
+    }
+
+    const uint32_t sectorSize = flashDevice->getGeometry()->sectorSize;
+
+    flashDevice->eraseSector(eraseAddress);
+    eraseAddress = (eraseAddress + sectorSize) % flashfsGetSize();
+    eraseSectorsPending--;
+
+    // The free space runs up to the sectors being erased, so it grows by each one
+    freeSpace += sectorSize;
+    if (tailAddress >= flashfsGetSize()) {
+        tailAddress -= flashfsGetSize();
+    }
+}
+#endif
+
+/**
+ * Get the number of bytes stored on the volume. With a log index that is the span of the ring from the start of the
+ * oldest log up to the file pointer, which is not the same as the offset once the ring has wrapped.
+ */
+uint32_t flashfsGetUsedSize()
+{
+#ifdef USE_FLASHFS_LOG_INDEX
+    if (logIndexEnabled) {
+        if (flashfsGetLogCount() == 0) {
+            return 0;
+        }
+
+        flashfsLogEntry_t oldest;
+        flashfsReadLogEntry(logIndexFirst, &oldest);
+
+        const uint32_t used = flashfsRingDistance(oldest.start, flashfsGetOffset());
+        // The file pointer only meets the start of the oldest log again when the volume is full
+        return used == 0 && freeSpace == 0 ? flashfsGetSize() : used;
+    }
+#endif
+
+    return flashfsGetOffset();
+}
+
+/**
+ * Called from the scheduler to program buffered data once the flash is idle.
+ */
+void flashfsUpdate(timeUs_t currentTimeUs)
+{
+    UNUSED(currentTimeUs);
+
+#ifdef USE_FLASHFS_LOG_INDEX
+    if (eraseSectorsPending > 0) {
+        flashfsEraseNextSector();
+        return;
+    }
+#endif
+
+    /*
+     * Only program whole pages here, a partial page takes nearly as long to program as a whole one. Whatever is left
+     * at the end of a log is written by an explicit flush. A buffer smaller than a page is programmed once it is past
+     * the auto flush length instead, or it would never be drained while the writer is dropping data.
+     */
+    const uint32_t bufferUsed = flashfsTransmitBufferUsed();
+    if (bufferUsed >= flashPageSize - tailAddress % flashPageSize || bufferUsed >= FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN) {
+        flashfsFlushAsync();
+    }
+}
+
+/**
+ * Call after initializing the flash chip in order to set up the filesystem on it.
+ */
+void flashfsInit(const flashVTable_t *device)
+{
+    flashDevice = device;
+    flashPageSize = device->getGeometry()->pageSize;
+#ifdef USE_FLASH_M25P16_DMA
+    flashPageBuffered = device->pageProgramStart && flashPageSize <= FLASHFS_PAGE_BUFFER_SIZE;
+#endif
+
     // If we have a flash chip present at all
     if (flashfsGetSize() > 0) {
+#ifdef USE_FLASHFS_LOG_INDEX
+        if (flashfsLogIndexInit()) {
+            return;
+        }
+#endif
         // Start the file pointer off at the beginning of free space so caller can start writing immediately
         flashfsSeekAbs(flashfsIdentifyStartOfFreeSpace());
     }
@@ -17,17 +17,31 @@
 
 #pragma once
 
+#include "common/time.h"
+
+#include "drivers/flash.h"
+
+#ifndef FLASHFS_WRITE_BUFFER_SIZE
 #define FLASHFS_WRITE_BUFFER_SIZE 128
+#endif
 #define FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)
 
-// Automatically trigger a flush when this much data is in the buffer
+/*
+ * Automatically trigger a flush from the writer when this much data is in the buffer. Buffers that can hold several
+ * pages are drained by flashfsUpdate() instead, the writer only writes through when they are about to overflow.
+ */
+#if FLASHFS_WRITE_BUFFER_SIZE >= 1024
+#define FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN (FLASHFS_WRITE_BUFFER_SIZE - 256)
+#else
 #define FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64
+#endif
 
 void flashfsEraseCompletely();
 void flashfsEraseRange(uint32_t start, uint32_t end);
 
 uint32_t flashfsGetSize();
 uint32_t flashfsGetOffset();
+uint32_t flashfsGetUsedSize();
 uint32_t flashfsGetWriteBufferFreeSpace();
 uint32_t flashfsGetWriteBufferSize();
 int flashfsIdentifyStartOfFreeSpace();
@@ -45,7 +59,28 @@ int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
 bool flashfsFlushAsync();
 void flashfsFlushSync();
 
-void flashfsInit();
+void flashfsInit(const flashVTable_t *device);
+void flashfsUpdate(timeUs_t currentTimeUs);
 
 bool flashfsIsReady();
 bool flashfsIsEOF();
+
+#ifdef USE_FLASHFS_LOG_INDEX
+#define FLASHFS_LOG_DURATION_UNKNOWN 0xffffffff
+
+typedef struct flashfsLog_s {
+    uint32_t start;         // address of the first byte of the log, logs wrap around the end of the volume
+    uint32_t length;
+    uint32_t durationMs;    // FLASHFS_LOG_DURATION_UNKNOWN if the log was not closed
+    bool open;              // still being written
+} flashfsLog_t;
+
+bool flashfsLogIndexIsFull(void);
+int flashfsGetLogCount(void);
+bool flashfsGetLog(int index, flashfsLog_t *log);
+int flashfsReadLog(int index, uint32_t offset, uint8_t *buffer, unsigned int len);
+
+bool flashfsLogBegin(void);
+void flashfsLogEnd(uint32_t durationMs);
+bool flashfsEraseOldestLogs(int count);
+#endif
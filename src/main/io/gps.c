@@ -97,6 +97,8 @@ uint8_t GPS_svinfo_cno[GPS_SV_MAXSATS];     // Carrier to Noise Ratio (Signal St
 // How many entries in gpsInitData array below
 #define GPS_INIT_ENTRIES (GPS_BAUDRATE_MAX + 1)
 #define GPS_BAUDRATE_CHANGE_DELAY (200)
+// Bytes read from the port at a time
+#define GPS_RX_CHUNK_SIZE (32)
 
 static serialPort_t *gpsPort;
 
@@ -414,8 +416,13 @@ void gpsUpdate(timeUs_t currentTimeUs)
 {
     // read out available GPS bytes
     if (gpsPort) {
-        while (serialRxBytesWaiting(gpsPort))
-            gpsNewData(serialRead(gpsPort));
+        uint8_t buf[GPS_RX_CHUNK_SIZE];
+        int count;
+        while ((count = serialReadBuf(gpsPort, buf, sizeof(buf))) > 0) {
+            for (int i = 0; i < count; i++) {
+                gpsNewData(buf[i]);
+            }
+        }
     }
 
     switch (gpsData.state) {
@@ -722,9 +722,8 @@ static void osdGetBlackboxStatusString(char * buff, uint8_t len)
     case BLACKBOX_DEVICE_FLASH:
         storageDeviceIsWorking = flashfsIsReady();
         if (storageDeviceIsWorking) {
-            const flashGeometry_t *geometry = flashfsGetGeometry();
-            storageTotal = geometry->totalSize / 1024;
-            storageUsed = flashfsGetOffset() / 1024;
+            storageTotal = flashfsGetSize() / 1024;
+            storageUsed = flashfsGetUsedSize() / 1024;
         }
         break;
 #endif
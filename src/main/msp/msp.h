@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <stdbool.h>
+
 #include "common/streambuf.h"
 
 // return positive for ACK, negative on error, zero for no reply
@@ -26,12 +28,28 @@ typedef enum {
     MSP_RESULT_NO_REPLY = 0
 } mspResult_e;
 
+/*
+ * Produces `len` bytes of a streamed reply starting `offset` bytes into the streamed part, returns the number produced.
+ * `context` is the value the command handler stored in the reply.
+ */
+typedef int (*mspStreamFnPtr)(uint32_t context, uint32_t offset, uint8_t *data, int len);
+
 typedef struct mspPacket_s {
     sbuf_t buf;
-    int16_t cmd;
+    uint16_t cmd;
     int16_t result;
+    /*
+     * A reply too large for buf can be streamed: the transport sends buf, then calls streamFn for streamLength more
+     * bytes as its transmit buffer frees up. Transports that can stream set streamLimit, the most bytes they accept.
+     */
+    uint16_t streamLimit;
+    uint16_t streamLength;
+    mspStreamFnPtr streamFn;
+    uint32_t streamContext;
 } mspPacket_t;
 
 struct serialPort_s;
 typedef void (*mspPostProcessFnPtr)(struct serialPort_s *port); // msp post process function, used for gracefully handling reboots, etc.
 typedef mspResult_e (*mspProcessCommandFnPtr)(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
+// Writes the reply of a command that takes no request, for push subscriptions. Returns false for other commands.
+typedef bool (*mspPushCommandFnPtr)(uint16_t cmd, sbuf_t *dst);
@@ -265,6 +265,14 @@
 #define MSP_MOTOR_CONFIG         131    //out message         Motor configuration (min/max throttle, etc)
 #define MSP_GPS_CONFIG           132    //out message         GPS configuration
 #define MSP_COMPASS_CONFIG       133    //out message         Compass configuration
+#define MSP_TASK_HISTOGRAM       134    //in/out message      Lateness and execution time histograms of a task
+#define MSP_SCHEDULER_TRACE      135    //in/out message      Recent task executions from the scheduler trace ring
+#define MSP_DATAFLASH_LOG_LIST   136    //in/out message      Logs in the dataflash log index, oldest first
+#define MSP_DATAFLASH_LOG_READ   137    //in/out message      Content of a log in the dataflash log index
+#define MSP_SETTING_INFO         138    //in/out message      Name, type and range of CLI settings by index
+#define MSP_SETTING_VALUES       139    //in/out message      Values of a range of CLI settings
+#define MSP_SETTING_FIND         140    //in/out message      Index of a CLI setting by name
+#define MSP_MOTOR_TELEMETRY      141    //out message         RPM and telemetry error count per motor from bidirectional DShot
 
 #define MSP_SET_RAW_RC           200    //in message          8 rc chan
 #define MSP_SET_RAW_GPS          201    //in message          fix, numsat, lat, lon, alt, speed
@@ -291,6 +299,9 @@
 #define MSP_SET_MOTOR_CONFIG     222    //out message         Motor configuration (min/max throttle, etc)
 #define MSP_SET_GPS_CONFIG       223    //out message         GPS configuration
 #define MSP_SET_COMPASS_CONFIG   224    //out message         Compass configuration
+#define MSP_DATAFLASH_LOG_ERASE  225    //in message          Erase the oldest logs in the dataflash log index
+#define MSP_SET_SETTING_VALUES   226    //in message          Set CLI settings by index
+#define MSP_SET_PUSH_SUBSCRIPTION 227   //in message          Replies the port gets pushed at a fixed rate
 
 // #define MSP_BIND                 240    //in message          no param
 // #define MSP_ALARMS               242
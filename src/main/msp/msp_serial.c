@@ -21,12 +21,20 @@
 
 #include "platform.h"
 
+#include "common/maths.h"
 #include "common/streambuf.h"
+#include "common/time.h"
 #include "common/utils.h"
 
+#include "drivers/serial.h"
+#include "drivers/system.h"
+
+#include "fc/fc_dispatch.h"
+
 #include "io/serial.h"
 
 #include "msp/msp.h"
+#include "msp/msp_protocol.h"
 #include "msp/msp_serial.h"
 
 static mspPort_t mspPorts[MAX_MSP_PORT_COUNT];
@@ -71,6 +79,20 @@ void mspSerialReleasePortIfAllocated(serialPort_t *serialPort)
     }
 }
 
+static uint8_t mspSerialChecksumBuf(mspVersion_e version, uint8_t checksum, const uint8_t *data, int len)
+{
+    if (version == MSP_V2) {
+        while (len-- > 0) {
+            checksum = crc8_dvb_s2(checksum, *data++);
+        }
+    } else {
+        while (len-- > 0) {
+            checksum ^= *data++;
+        }
+    }
+    return checksum;
+}
+
 static bool mspSerialProcessReceivedData(mspPort_t *mspPort, uint8_t c)
 {
     if (mspPort->c_state == MSP_IDLE) {
@@ -80,7 +102,15 @@ static bool mspSerialProcessReceivedData(mspPort_t *mspPort, uint8_t c)
             return false;
         }
     } else if (mspPort->c_state == MSP_HEADER_START) {
-        mspPort->c_state = (c == 'M') ? MSP_HEADER_M : MSP_IDLE;
+        if (c == 'M') {
+            mspPort->mspVersion = MSP_V1;
+            mspPort->c_state = MSP_HEADER_M;
+        } else if (c == 'X') {
+            mspPort->mspVersion = MSP_V2;
+            mspPort->c_state = MSP_HEADER_X;
+        } else {
+            mspPort->c_state = MSP_IDLE;
+        }
     } else if (mspPort->c_state == MSP_HEADER_M) {
         mspPort->c_state = (c == '<') ? MSP_HEADER_ARROW : MSP_IDLE;
     } else if (mspPort->c_state == MSP_HEADER_ARROW) {
@@ -95,6 +125,7 @@ static bool mspSerialProcessReceivedData(mspPort_t *mspPort, uint8_t c)
         }
     } else if (mspPort->c_state == MSP_HEADER_SIZE) {
         mspPort->cmdMSP = c;
+        mspPort->cmdFlags = 0;
         mspPort->checksum ^= c;
         mspPort->c_state = MSP_HEADER_CMD;
     } else if (mspPort->c_state == MSP_HEADER_CMD && mspPort->offset < mspPort->dataSize) {
@@ -106,52 +137,256 @@ static bool mspSerialProcessReceivedData(mspPort_t *mspPort, uint8_t c)
         } else {
             mspPort->c_state = MSP_IDLE;
         }
+    } else if (mspPort->c_state == MSP_HEADER_X) {
+        if (c == '<') {
+            mspPort->offset = 0;
+            mspPort->checksum = 0;
+            mspPort->c_state = MSP_HEADER_V2;
+        } else {
+            mspPort->c_state = MSP_IDLE;
+        }
+    } else if (mspPort->c_state == MSP_HEADER_V2) {
+        // The header is gathered at the start of the receive buffer, the payload replaces it
+        mspPort->inBuf[mspPort->offset++] = c;
+        mspPort->checksum = crc8_dvb_s2(mspPort->checksum, c);
+        if (mspPort->offset == sizeof(mspHeaderV2_t)) {
+            const mspHeaderV2_t *hdr = (const mspHeaderV2_t *)mspPort->inBuf;
+            if (hdr->size > MSP_PORT_INBUF_SIZE) {
+                mspPort->c_state = MSP_IDLE;
+            } else {
+                mspPort->cmdMSP = hdr->cmd;
+                mspPort->cmdFlags = hdr->flags;
+                mspPort->dataSize = hdr->size;
+                mspPort->offset = 0;
+                mspPort->c_state = mspPort->dataSize > 0 ? MSP_PAYLOAD_V2 : MSP_CHECKSUM_V2;
+            }
+        }
+    } else if (mspPort->c_state == MSP_PAYLOAD_V2) {
+        mspPort->inBuf[mspPort->offset++] = c;
+        mspPort->checksum = crc8_dvb_s2(mspPort->checksum, c);
+        if (mspPort->offset == mspPort->dataSize) {
+            mspPort->c_state = MSP_CHECKSUM_V2;
+        }
+    } else if (mspPort->c_state == MSP_CHECKSUM_V2) {
+        if (mspPort->checksum == c) {
+            mspPort->c_state = MSP_COMMAND_RECEIVED;
+        } else {
+            mspPort->c_state = MSP_IDLE;
+        }
     }
     return true;
 }
 
-static uint8_t mspSerialChecksumBuf(uint8_t checksum, const uint8_t *data, int len)
+#define MSP_SERIAL_RX_CHUNK_SIZE 64
+
+/*
+ * How many bytes can be read without going past the end of the frame being received. The bytes after it are left in
+ * the port for the next command, or for the CLI when they aren't MSP at all.
+ */
+static int mspSerialFrameBytesRemaining(const mspPort_t *mspPort)
 {
-    while (len-- > 0) {
-        checksum ^= *data++;
+    switch (mspPort->c_state) {
+    case MSP_HEADER_CMD:
+    case MSP_PAYLOAD_V2:
+        return mspPort->dataSize - mspPort->offset + 1;
+    case MSP_HEADER_V2:
+        return sizeof(mspHeaderV2_t) - mspPort->offset;
+    default:
+        return 1;
     }
-    return checksum;
+}
+
+#define MSP_STREAM_CHUNK_SIZE 64
+
+/*
+ * Send as much of a pending reply as the transmit buffer has room for, followed by the checksum once all of it is
+ * out. Returns true when the reply is complete.
+ */
+static bool mspSerialStreamReply(mspPort_t *msp)
+{
+    mspStream_t *stream = &msp->stream;
+    uint8_t chunk[MSP_STREAM_CHUNK_SIZE];
+
+    serialBeginWrite(msp->port);
+    while (stream->offset < stream->length) {
+        int len = serialTxBytesFree(msp->port);
+        if (len == 0) {
+            break;
+        }
+        const uint8_t *data;
+        if (stream->offset < stream->bufLength) {
+            data = stream->buf + stream->offset;
+            len = MIN(len, stream->bufLength - stream->offset);
+        } else {
+            data = chunk;
+            len = MIN(len, (int)sizeof(chunk));
+            len = MIN(len, stream->length - stream->offset);
+            const int produced = stream->fn(stream->context, stream->offset - stream->bufLength, chunk, len);
+            if (produced <= 0) {
+                // The size has been sent already, so a reply that can't be produced is padded out
+                memset(chunk, 0, len);
+            } else {
+                len = produced;
+            }
+        }
+        serialWriteBuf(msp->port, data, len);
+        stream->checksum = mspSerialChecksumBuf(stream->version, stream->checksum, data, len);
+        stream->offset += len;
+    }
+    if (stream->offset == stream->length && serialTxBytesFree(msp->port) > 0) {
+        serialWriteBuf(msp->port, &stream->checksum, 1);
+        stream->pending = false;
+    }
+    serialEndWrite(msp->port);
+
+    return !stream->pending;
 }
 
 #define JUMBO_FRAME_SIZE_LIMIT 255
 
-static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet)
+/*
+ * Encode a packet. With `stream` set only the header has to fit the transmit buffer, the rest of the packet follows
+ * as the buffer frees up and packet->buf has to stay valid until it has been sent. Otherwise the whole packet is
+ * written at once.
+ */
+static int mspSerialEncode(mspPort_t *msp, mspPacket_t *packet, mspVersion_e version, bool stream)
 {
     serialBeginWrite(msp->port);
-    const int len = sbufBytesRemaining(&packet->buf);
-    const int mspLen = len < JUMBO_FRAME_SIZE_LIMIT ? len : JUMBO_FRAME_SIZE_LIMIT;
-    uint8_t hdr[8] = {'$', 'M', packet->result == MSP_RESULT_ERROR ? '!' : '>', mspLen, packet->cmd};
-    int hdrLen = 5;
-#define CHECKSUM_STARTPOS 3  // checksum starts from mspLen field
-    if (len >= JUMBO_FRAME_SIZE_LIMIT) {
-        hdrLen += 2;
-        hdr[5] = len & 0xff;
-        hdr[6] = (len >> 8) & 0xff;
+    const int bufLen = sbufBytesRemaining(&packet->buf);
+    const int streamLen = packet->streamFn ? packet->streamLength : 0;
+    const int len = bufLen + streamLen;
+    const uint8_t direction = packet->result == MSP_RESULT_ERROR ? '!' : '>';
+    uint8_t hdr[MSP_PORT_MAX_HEADER_SIZE] = {'$', version == MSP_V2 ? 'X' : 'M', direction};
+    int hdrLen;
+#define CHECKSUM_STARTPOS 3  // checksum starts after the direction
+    if (version == MSP_V2) {
+        mspHeaderV2_t *hdrV2 = (mspHeaderV2_t *)&hdr[CHECKSUM_STARTPOS];
+        hdrV2->flags = 0;
+        hdrV2->cmd = packet->cmd;
+        hdrV2->size = len;
+        hdrLen = CHECKSUM_STARTPOS + sizeof(mspHeaderV2_t);
+    } else {
+        hdr[3] = len < JUMBO_FRAME_SIZE_LIMIT ? len : JUMBO_FRAME_SIZE_LIMIT;
+        hdr[4] = packet->cmd;
+        hdrLen = 5;
+        if (len >= JUMBO_FRAME_SIZE_LIMIT) {
+            hdrLen += 2;
+            hdr[5] = len & 0xff;
+            hdr[6] = (len >> 8) & 0xff;
+        }
     }
     serialWriteBuf(msp->port, hdr, hdrLen);
-    uint8_t checksum = mspSerialChecksumBuf(0, hdr + CHECKSUM_STARTPOS, hdrLen - CHECKSUM_STARTPOS);
-    if (len > 0) {
-        serialWriteBuf(msp->port, sbufPtr(&packet->buf), len);
-        checksum = mspSerialChecksumBuf(checksum, sbufPtr(&packet->buf), len);
+    uint8_t checksum = mspSerialChecksumBuf(version, 0, hdr + CHECKSUM_STARTPOS, hdrLen - CHECKSUM_STARTPOS);
+    if (stream || streamLen > 0) {
+        msp->stream.pending = true;
+        msp->stream.buf = sbufPtr(&packet->buf);
+        msp->stream.bufLength = bufLen;
+        msp->stream.fn = packet->streamFn;
+        msp->stream.context = packet->streamContext;
+        msp->stream.offset = 0;
+        msp->stream.length = len;
+        msp->stream.checksum = checksum;
+        msp->stream.version = version;
+        serialEndWrite(msp->port);
+        mspSerialStreamReply(msp);
+    } else {
+        if (bufLen > 0) {
+            serialWriteBuf(msp->port, sbufPtr(&packet->buf), bufLen);
+            checksum = mspSerialChecksumBuf(version, checksum, sbufPtr(&packet->buf), bufLen);
+        }
+        serialWriteBuf(msp->port, &checksum, 1);
+        serialEndWrite(msp->port);
     }
-    serialWriteBuf(msp->port, &checksum, 1);
-    serialEndWrite(msp->port);
-    return sizeof(hdr) + len + 1; // header, data, and checksum
+    return hdrLen + len + 1; // header, data, and checksum
+}
+
+static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
+
+// Post process functions wait in the dispatcher until the reply that asked for them is out
+#define MSP_POST_PROCESS_POLL_US 1000
+
+static dispatchEntry_t mspPostProcessDispatch[MAX_MSP_PORT_COUNT];
+static bool mspPostProcessQueued[MAX_MSP_PORT_COUNT];
+
+static void mspSerialPostProcess(dispatchEntry_t *self)
+{
+    const int portIndex = self - mspPostProcessDispatch;
+    mspPort_t *mspPort = &mspPorts[portIndex];
+
+    if (!mspPort->port || !mspPort->postProcessFn) {
+        // the port has been released
+        mspPostProcessQueued[portIndex] = false;
+        return;
+    }
+    if (mspPort->stream.pending || !isSerialTransmitBufferEmpty(mspPort->port)) {
+        dispatchAdd(self, MSP_POST_PROCESS_POLL_US);
+        return;
+    }
+
+    mspPostProcessQueued[portIndex] = false;
+    const mspPostProcessFnPtr mspPostProcessFn = mspPort->postProcessFn;
+    mspPort->postProcessFn = NULL;
+    mspPostProcessFn(mspPort->port);
+}
+
+#ifdef USE_MSP_PUSH
+/*
+ * Request: rate in Hz and the commands to push, each 16 bits. A rate of 0 or no commands ends the subscription.
+ * Replies are pushed in the MSP version of the request.
+ */
+static mspResult_e mspSerialSubscribe(mspPort_t *msp, sbuf_t *src)
+{
+    mspPushSubscription_t *push = &msp->push;
+
+    const uint16_t rateHz = sbufBytesRemaining(src) >= (int)sizeof(uint16_t) ? sbufReadU16(src) : 0;
+    const int count = sbufBytesRemaining(src) / (int)sizeof(uint16_t);
+    if (rateHz > MSP_PUSH_MAX_RATE_HZ || count > MSP_PUSH_MAX_COMMANDS) {
+        return MSP_RESULT_ERROR;
+    }
+
+    push->count = 0;
+    if (rateHz == 0) {
+        return MSP_RESULT_ACK;
+    }
+    for (int i = 0; i < count; i++) {
+        const uint16_t cmd = sbufReadU16(src);
+        if (msp->mspVersion == MSP_V1 && cmd > UINT8_MAX) {
+            return MSP_RESULT_ERROR;
+        }
+        push->cmds[i] = cmd;
+    }
+    push->count = count;
+    push->version = msp->mspVersion;
+    push->periodUs = 1000000 / rateHz;
+    push->nextPushAt = micros();
+    push->skipped = 0;
+
+    return MSP_RESULT_ACK;
 }
+#endif
 
-static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+static mspResult_e mspSerialProcessCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn, mspPacket_t *command, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
 {
-    static uint8_t outBuf[MSP_PORT_OUTBUF_SIZE];
+#ifdef USE_MSP_PUSH
+    // Subscriptions belong to the port rather than the flight controller
+    if (command->cmd == MSP_SET_PUSH_SUBSCRIPTION) {
+        reply->cmd = command->cmd;
+        reply->result = mspSerialSubscribe(msp, &command->buf);
+        return reply->result;
+    }
+#else
+    UNUSED(msp);
+#endif
+    return mspProcessCommandFn(command, reply, mspPostProcessFn);
+}
 
+static void mspSerialProcessReceivedCommand(mspPort_t *msp, mspProcessCommandFnPtr mspProcessCommandFn)
+{
     mspPacket_t reply = {
         .buf = { .ptr = outBuf, .end = ARRAYEND(outBuf), },
-        .cmd = -1,
+        .cmd = 0,
         .result = 0,
+        .streamLimit = MSP_PORT_STREAM_LIMIT - MSP_PORT_OUTBUF_SIZE,
     };
     uint8_t *outBufHead = reply.buf.ptr;
 
@@ -162,48 +397,88 @@ static mspPostProcessFnPtr mspSerialProcessReceivedCommand(mspPort_t *msp, mspPr
     };
 
     mspPostProcessFnPtr mspPostProcessFn = NULL;
-    const mspResult_e status = mspProcessCommandFn(&command, &reply, &mspPostProcessFn);
+    const mspResult_e status = mspSerialProcessCommand(msp, mspProcessCommandFn, &command, &reply, &mspPostProcessFn);
 
     if (status != MSP_RESULT_NO_REPLY) {
         sbufSwitchToReader(&reply.buf, outBufHead); // change streambuf direction
-        mspSerialEncode(msp, &reply);
+        mspSerialEncode(msp, &reply, msp->mspVersion, true);
     }
 
     msp->c_state = MSP_IDLE;
-    return mspPostProcessFn;
+
+    if (mspPostProcessFn) {
+        const int portIndex = msp - mspPorts;
+        msp->postProcessFn = mspPostProcessFn;
+        if (!mspPostProcessQueued[portIndex]) {
+            mspPostProcessQueued[portIndex] = true;
+            dispatchAdd(&mspPostProcessDispatch[portIndex], 0);
+        }
+    }
+}
+
+// All ports share the output buffer, so a reply still being sent from it has to finish before it is reused
+static bool mspSerialOutBufInUse(void)
+{
+    for (int portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        const mspStream_t *stream = &mspPorts[portIndex].stream;
+        if (stream->pending && stream->offset < stream->bufLength) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool mspSerialCanProcessCommand(const mspPort_t *mspPort)
+{
+    if (mspPort->stream.pending || mspPort->postProcessFn) {
+        return false;
+    }
+    if (serialTxBytesFree(mspPort->port) < MSP_PORT_MAX_HEADER_SIZE) {
+        return false;
+    }
+    return !mspSerialOutBufInUse();
 }
 
 /*
  * Process MSP commands from serial ports configured as MSP ports.
  *
- * Called periodically by the scheduler.
+ * Called periodically by the scheduler. Commands are taken for MSP_SERIAL_PROCESS_TIME_US, and only while the
+ * transmit buffer has room for the reply header, so a call never waits for a port.
  */
 void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessCommandFnPtr mspProcessCommandFn)
 {
+    const timeUs_t startTimeUs = micros();
+
     for (uint8_t portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
         mspPort_t * const mspPort = &mspPorts[portIndex];
         if (!mspPort->port) {
             continue;
         }
-        mspPostProcessFnPtr mspPostProcessFn = NULL;
-        while (serialRxBytesWaiting(mspPort->port)) {
-
-            const uint8_t c = serialRead(mspPort->port);
-            const bool consumed = mspSerialProcessReceivedData(mspPort, c);
-
-            if (!consumed && evaluateNonMspData == MSP_EVALUATE_NON_MSP_DATA) {
-                serialEvaluateNonMspData(mspPort->port, c);
+        if (mspPort->stream.pending && !mspSerialStreamReply(mspPort)) {
+            // commands wait until the reply being sent is out
+            continue;
+        }
+        do {
+            while (mspPort->c_state != MSP_COMMAND_RECEIVED) {
+                uint8_t buf[MSP_SERIAL_RX_CHUNK_SIZE];
+                const int count = serialReadBuf(mspPort->port, buf, MIN(mspSerialFrameBytesRemaining(mspPort), (int)sizeof(buf)));
+                if (count == 0) {
+                    break;
+                }
+                for (int i = 0; i < count; i++) {
+                    const bool consumed = mspSerialProcessReceivedData(mspPort, buf[i]);
+
+                    if (!consumed && evaluateNonMspData == MSP_EVALUATE_NON_MSP_DATA) {
+                        serialEvaluateNonMspData(mspPort->port, buf[i]);
+                    }
+                }
             }
-
-            if (mspPort->c_state == MSP_COMMAND_RECEIVED) {
-                mspPostProcessFn = mspSerialProcessReceivedCommand(mspPort, mspProcessCommandFn);
-                break; // process one command at a time so as not to block.
+            if (mspPort->c_state != MSP_COMMAND_RECEIVED || !mspSerialCanProcessCommand(mspPort)) {
+                // a received command is kept until there is room for its reply
+                break;
             }
-        }
-        if (mspPostProcessFn) {
-            waitForSerialPortToFinishTransmitting(mspPort->port);
-            mspPostProcessFn(mspPort->port);
-        }
+            mspSerialProcessReceivedCommand(mspPort, mspProcessCommandFn);
+        } while (cmpTimeUs(micros(), startTimeUs) < MSP_SERIAL_PROCESS_TIME_US);
     }
 }
 
@@ -211,6 +486,11 @@ void mspSerialInit(void)
 {
     memset(mspPorts, 0, sizeof(mspPorts));
     mspSerialAllocatePorts();
+
+    for (int portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        mspPostProcessDispatch[portIndex].dispatch = mspSerialPostProcess;
+    }
+    dispatchEnable();
 }
 
 int mspSerialPush(uint8_t cmd, const uint8_t *data, int datalen)
@@ -235,15 +515,77 @@ int mspSerialPush(uint8_t cmd, const uint8_t *data, int datalen)
             continue;
         }
 
+        // a push can't be sent in the middle of a reply
+        if (mspPort->stream.pending) {
+            continue;
+        }
+
         sbufWriteData(&push.buf, data, datalen);
 
         sbufSwitchToReader(&push.buf, pushBuf);
 
-        ret = mspSerialEncode(mspPort, &push);
+        ret = mspSerialEncode(mspPort, &push, MSP_V1, false);
     }
     return ret; // return the number of bytes written
 }
 
+#ifdef USE_MSP_PUSH
+// Shortest period of the push subscriptions, 0 without subscriptions
+timeDelta_t mspSerialPushPeriod(void)
+{
+    timeDelta_t periodUs = 0;
+    for (int portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        const mspPort_t *mspPort = &mspPorts[portIndex];
+        if (mspPort->port && mspPort->push.count > 0 && (periodUs == 0 || mspPort->push.periodUs < periodUs)) {
+            periodUs = mspPort->push.periodUs;
+        }
+    }
+    return periodUs;
+}
+
+/*
+ * Push the replies of the subscribed commands to each port that is due, back to back. A batch is cut short rather
+ * than waiting for the transmit buffer, the next one goes out on time.
+ */
+void mspSerialPushSubscriptions(timeUs_t currentTimeUs, mspPushCommandFnPtr mspPushCommandFn)
+{
+    for (int portIndex = 0; portIndex < MAX_MSP_PORT_COUNT; portIndex++) {
+        mspPort_t * const mspPort = &mspPorts[portIndex];
+        mspPushSubscription_t *push = &mspPort->push;
+        // the task runs at the rate of the fastest subscription, so allow for it running a little early
+        if (!mspPort->port || push->count == 0 || cmpTimeUs(push->nextPushAt, currentTimeUs) > push->periodUs / 2) {
+            continue;
+        }
+        push->nextPushAt += push->periodUs;
+        if (cmpTimeUs(currentTimeUs, push->nextPushAt) >= 0) {
+            // don't try to catch up on batches that are already late
+            push->nextPushAt = currentTimeUs + push->periodUs;
+        }
+
+        if (mspPort->stream.pending || mspPort->postProcessFn || mspSerialOutBufInUse()) {
+            push->skipped++;
+            continue;
+        }
+        for (int i = 0; i < push->count; i++) {
+            mspPacket_t packet = {
+                .buf = { .ptr = outBuf, .end = ARRAYEND(outBuf), },
+                .cmd = push->cmds[i],
+                .result = MSP_RESULT_ACK,
+            };
+            if (!mspPushCommandFn(packet.cmd, &packet.buf)) {
+                continue;
+            }
+            sbufSwitchToReader(&packet.buf, outBuf);
+            if (serialTxBytesFree(mspPort->port) < MSP_PORT_MAX_HEADER_SIZE + (uint32_t)sbufBytesRemaining(&packet.buf) + 1) {
+                push->skipped++;
+                break;
+            }
+            mspSerialEncode(mspPort, &packet, push->version, false);
+        }
+    }
+}
+#endif
+
 uint32_t mspSerialTxBytesFree()
 {
     uint32_t ret = UINT32_MAX;
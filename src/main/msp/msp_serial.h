@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <stdbool.h>
+
+#include "common/time.h"
+
 #include "msp/msp.h"
 
 // Each MSP port requires state and a receive buffer, revisit this default if someone needs more than 3 MSP ports.
@@ -29,9 +33,25 @@ typedef enum {
     MSP_HEADER_ARROW,
     MSP_HEADER_SIZE,
     MSP_HEADER_CMD,
+    MSP_HEADER_X,
+    MSP_HEADER_V2,
+    MSP_PAYLOAD_V2,
+    MSP_CHECKSUM_V2,
     MSP_COMMAND_RECEIVED
 } mspState_e;
 
+typedef enum {
+    MSP_V1 = 1, // $M, 8-bit command and size, XOR checksum
+    MSP_V2 = 2  // $X, 16-bit command and size, CRC8 DVB-S2
+} mspVersion_e;
+
+// MSPv2 header, following the '$', 'X' and direction bytes
+typedef struct mspHeaderV2_s {
+    uint8_t flags;
+    uint16_t cmd;
+    uint16_t size;
+} __attribute__((packed)) mspHeaderV2_t;
+
 typedef enum {
     MSP_EVALUATE_NON_MSP_DATA,
     MSP_SKIP_NON_MSP_DATA
@@ -50,14 +70,63 @@ typedef enum {
 #define MSP_PORT_OUTBUF_SIZE 256
 #endif
 
+// Largest reply an MSP port streams, the size field of both versions is 16 bits
+#define MSP_PORT_STREAM_LIMIT 0xffff
+
+// Longest reply header, '$', 'X', direction and the MSPv2 header
+#define MSP_PORT_MAX_HEADER_SIZE 8
+
+/*
+ * Time mspSerialProcess() keeps taking commands for. Every port gets at least one command per call, pipelined
+ * requests beyond that are taken while the budget lasts.
+ */
+#ifndef MSP_SERIAL_PROCESS_TIME_US
+#define MSP_SERIAL_PROCESS_TIME_US 250
+#endif
+
+// A reply that is still being sent, the buffered part first and then the output of the stream function
+typedef struct mspStream_s {
+    bool pending;
+    const uint8_t *buf;
+    uint16_t bufLength;
+    mspStreamFnPtr fn;
+    uint32_t context;
+    uint16_t offset;
+    uint16_t length;
+    uint8_t checksum;
+    mspVersion_e version;
+} mspStream_t;
+
+#ifdef USE_MSP_PUSH
+#define MSP_PUSH_MAX_COMMANDS   8
+#define MSP_PUSH_MAX_RATE_HZ    200
+
+// Commands whose replies are pushed to a port at a fixed rate, set up by MSP_SET_PUSH_SUBSCRIPTION
+typedef struct mspPushSubscription_s {
+    uint16_t cmds[MSP_PUSH_MAX_COMMANDS];
+    uint8_t count;
+    mspVersion_e version;
+    timeDelta_t periodUs;
+    timeUs_t nextPushAt;
+    uint16_t skipped;       // batches cut short because the transmit buffer was full or the port busy
+} mspPushSubscription_t;
+#endif
+
 struct serialPort_s;
 typedef struct mspPort_s {
     struct serialPort_s *port; // null when port unused.
-    uint8_t offset;
-    uint8_t dataSize;
+    uint16_t offset;
+    uint16_t dataSize;
     uint8_t checksum;
-    uint8_t cmdMSP;
+    uint16_t cmdMSP;
+    uint8_t cmdFlags;
+    mspVersion_e mspVersion;
     mspState_e c_state;
+    mspStream_t stream;
+    mspPostProcessFnPtr postProcessFn; // run from the dispatcher once the reply is out
+#ifdef USE_MSP_PUSH
+    mspPushSubscription_t push;
+#endif
     uint8_t inBuf[MSP_PORT_INBUF_SIZE];
 } mspPort_t;
 
@@ -68,3 +137,7 @@ void mspSerialAllocatePorts(void);
 void mspSerialReleasePortIfAllocated(struct serialPort_s *serialPort);
 int mspSerialPush(uint8_t cmd, const uint8_t *data, int datalen);
 uint32_t mspSerialTxBytesFree(void);
+#ifdef USE_MSP_PUSH
+timeDelta_t mspSerialPushPeriod(void);
+void mspSerialPushSubscriptions(timeUs_t currentTimeUs, mspPushCommandFnPtr mspPushCommandFn);
+#endif
@@ -68,6 +68,10 @@
 
 #define STM32F1
 
+#elif defined(SIMULATOR_BUILD)
+
+// host process, target.h provides stand-ins for the MCU definitions
+
 #else // STM32F10X
 #error "Invalid chipset specified. Update platform.h"
 #endif
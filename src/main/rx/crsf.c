@@ -28,6 +28,7 @@
 #include "build/debug.h"
 
 #include "common/maths.h"
+#include "common/time.h"
 #include "common/utils.h"
 
 #include "drivers/system.h"
@@ -38,9 +39,19 @@
 
 #include "rx/rx.h"
 #include "rx/crsf.h"
+#include "rx/packed_channels.h"
 
-#define CRSF_TIME_NEEDED_PER_FRAME_US   1000
-#define CRSF_TIME_BETWEEN_FRAMES_US     4000 // a frame is sent by the transmitter every 4 milliseconds
+#define CRSF_TIME_PER_BYTE_US           22   // 10 bits at 420000 baud, rounded down
+#define CRSF_TIME_NEEDED_PER_FRAME_US   (CRSF_FRAME_SIZE_MAX * CRSF_TIME_PER_BYTE_US) // 1408us for the largest frame
+#define CRSF_TIME_BETWEEN_BYTES_MAX_US  250  // the bytes of a frame arrive back to back, a longer gap ends the frame
+#define CRSF_TIME_BETWEEN_FRAMES_US     4000 // until measured, assume the transmitter sends a frame every 4 milliseconds
+#define CRSF_FRAME_PERIOD_MIN_US        1000
+#define CRSF_FRAME_PERIOD_MAX_US        50000
+#define CRSF_TIME_TURNAROUND_US         100  // allowed for the receiver to switch the line around, each way
+#define CRSF_LINK_STATISTICS_TIMEOUT_US 1000000
+
+#define CRSF_FRAME_LENGTH_MIN           CRSF_FRAME_LENGTH_TYPE_CRC
+#define CRSF_FRAME_LENGTH_MAX           (CRSF_FRAME_SIZE_MAX - CRSF_FRAME_LENGTH_ADDRESS - CRSF_FRAME_LENGTH_FRAMELENGTH)
 
 #define CRSF_DIGITAL_CHANNEL_MIN 172
 #define CRSF_DIGITAL_CHANNEL_MAX 1811
@@ -50,17 +61,29 @@ STATIC_UNIT_TESTED crsfFrame_t crsfFrame;
 
 STATIC_UNIT_TESTED uint32_t crsfChannelData[CRSF_MAX_CHANNEL];
 
+STATIC_UNIT_TESTED crsfLinkStatistics_t crsfLinkStatistics;
+
 static serialPort_t *serialPort;
+static bool crsfHalfDuplex = false;
 static uint32_t crsfFrameStartAt = 0;
+static uint32_t crsfFrameDoneAt = 0;
+static uint32_t crsfLinkStatisticsAt = 0;
+static bool crsfLinkStatisticsValid = false;
 static uint8_t telemetryBuf[CRSF_FRAME_SIZE_MAX];
 static uint8_t telemetryBufLen = 0;
 
+// Response window after the last RC frame, see crsfRxSendTelemetryData()
+static uint32_t crsfRcFrameDoneAt = 0;
+static uint8_t crsfRcFrameSize = CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE + CRSF_FRAME_LENGTH_TYPE_CRC + CRSF_FRAME_LENGTH_ADDRESS + CRSF_FRAME_LENGTH_FRAMELENGTH;
+STATIC_UNIT_TESTED uint32_t crsfRcFramePeriodUs = CRSF_TIME_BETWEEN_FRAMES_US;
+static bool crsfTelemetryWindowUsed = true;
+
 
 /*
  * CRSF protocol
  *
  * CRSF protocol uses a single wire half duplex uart connection.
- * The master sends one frame every 4ms and the slave replies between two frames from the master.
+ * The master sends one frame every 4ms (or faster, down to 2ms) and the slave replies between two frames from the master.
  *
  * 420000 baud
  * not inverted
@@ -68,10 +91,8 @@ static uint8_t telemetryBufLen = 0;
  * 1 Stop bit
  * Big endian
  * 420000 bit/s = 46667 byte/s (including stop bit) = 21.43us per byte
- * Assume a max payload of 32 bytes (needs confirming with TBS), so max frame size of 36 bytes
- * A 36 byte frame can be transmitted in 771 microseconds.
- *
- * CRSF_TIME_NEEDED_PER_FRAME_US is set conservatively at 1000 microseconds
+ * The max frame size is 64 bytes, which takes 1408 microseconds to transmit, so frames are delimited by the
+ * gap between them rather than by a fixed frame time.
  *
  * Every frame has the structure:
  * <Device address> <Frame length> < Type> <Payload> < CRC>
@@ -83,58 +104,69 @@ static uint8_t telemetryBufLen = 0;
  *
  */
 
-struct crsfPayloadRcChannelsPacked_s {
-    // 176 bits of data (11 bits per channel * 16 channels) = 22 bytes.
-    unsigned int chan0 : 11;
-    unsigned int chan1 : 11;
-    unsigned int chan2 : 11;
-    unsigned int chan3 : 11;
-    unsigned int chan4 : 11;
-    unsigned int chan5 : 11;
-    unsigned int chan6 : 11;
-    unsigned int chan7 : 11;
-    unsigned int chan8 : 11;
-    unsigned int chan9 : 11;
-    unsigned int chan10 : 11;
-    unsigned int chan11 : 11;
-    unsigned int chan12 : 11;
-    unsigned int chan13 : 11;
-    unsigned int chan14 : 11;
-    unsigned int chan15 : 11;
-} __attribute__ ((__packed__));
-
-typedef struct crsfPayloadRcChannelsPacked_s crsfPayloadRcChannelsPacked_t;
-
-
-// Receive ISR callback, called back from serial port
-STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c)
+static void crsfReceiveByte(uint8_t c, uint32_t now)
 {
     static uint8_t crsfFramePosition = 0;
-    const uint32_t now = micros();
+    static uint32_t crsfLastByteAt = 0;
 
 #ifdef DEBUG_CRSF_PACKETS
     debug[2] = now - crsfFrameStartAt;
 #endif
 
-    if (now > crsfFrameStartAt + CRSF_TIME_NEEDED_PER_FRAME_US) {
-        // We've received a character after max time needed to complete a frame,
+    if (cmpTimeUs(now, crsfLastByteAt) > CRSF_TIME_BETWEEN_BYTES_MAX_US
+        || cmpTimeUs(now, crsfFrameStartAt) > CRSF_TIME_NEEDED_PER_FRAME_US) {
+        // The line was quiet or we've received a character after the max time needed to complete a frame,
         // so this must be the start of a new frame.
         crsfFramePosition = 0;
     }
+    crsfLastByteAt = now;
 
     if (crsfFramePosition == 0) {
         crsfFrameStartAt = now;
     }
     // assume frame is 5 bytes long until we have received the frame length
     // full frame length includes the length of the address and framelength fields
-    const int fullFrameLength = crsfFramePosition < 3 ? 5 : crsfFrame.frame.frameLength + CRSF_FRAME_LENGTH_ADDRESS + CRSF_FRAME_LENGTH_FRAMELENGTH;
+    int fullFrameLength = crsfFramePosition < 3 ? 5 : crsfFrame.frame.frameLength + CRSF_FRAME_LENGTH_ADDRESS + CRSF_FRAME_LENGTH_FRAMELENGTH;
+    if (crsfFramePosition >= 2 && (crsfFrame.frame.frameLength < CRSF_FRAME_LENGTH_MIN || crsfFrame.frame.frameLength > CRSF_FRAME_LENGTH_MAX)) {
+        // not a frame, drop the rest of it until the next one starts
+        fullFrameLength = 0;
+    }
 
     if (crsfFramePosition < fullFrameLength) {
-        crsfFrame.bytes[crsfFramePosition++] = (uint8_t)c;
+        crsfFrame.bytes[crsfFramePosition++] = c;
         crsfFrameDone = crsfFramePosition < fullFrameLength ? false : true;
+        if (crsfFrameDone) {
+            crsfFrameDoneAt = now;
+        }
+    }
+}
+
+// Receive ISR callback, called back from serial port
+STATIC_UNIT_TESTED void crsfDataReceive(uint16_t c)
+{
+    crsfReceiveByte((uint8_t)c, micros());
+}
+
+// Idle line ISR callback, called back from serial port with the whole frame
+STATIC_UNIT_TESTED void crsfFrameReceive(const uint8_t *data, int length)
+{
+    // the chunk started as long ago as it took to receive it, and its bytes arrived back to back from then
+    const uint32_t now = micros();
+    const uint32_t startAt = now - length * CRSF_TIME_PER_BYTE_US;
+    for (int i = 0; i < length; i++) {
+        crsfReceiveByte(data[i], startAt + i * CRSF_TIME_PER_BYTE_US);
+    }
+    if (crsfFrameDone) {
+        // the line has to stay idle for a character time before the interrupt fires
+        crsfFrameDoneAt = now - CRSF_TIME_PER_BYTE_US;
     }
 }
 
+static timeUs_t crsfFrameTimeUs(void)
+{
+    return crsfFrameDoneAt;
+}
+
 STATIC_UNIT_TESTED uint8_t crsfFrameCRC(void)
 {
     // CRC includes type and payload
@@ -145,38 +177,66 @@ STATIC_UNIT_TESTED uint8_t crsfFrameCRC(void)
     return crc;
 }
 
+static void crsfHandleLinkStatistics(void)
+{
+    if (crsfFrame.frame.frameLength != CRSF_FRAME_LINK_STATISTICS_PAYLOAD_SIZE + CRSF_FRAME_LENGTH_TYPE_CRC
+        || crsfFrameCRC() != crsfFrame.frame.payload[CRSF_FRAME_LINK_STATISTICS_PAYLOAD_SIZE]) {
+        return;
+    }
+    memcpy(&crsfLinkStatistics, crsfFrame.frame.payload, sizeof(crsfLinkStatistics));
+    crsfLinkStatisticsAt = crsfFrameDoneAt;
+    crsfLinkStatisticsValid = true;
+
+    // the uplink quality is the percentage of transmitter packets received, which is what RSSI is used for
+    rxSetLinkRssi(scaleRange(MIN(crsfLinkStatistics.uplinkLQ, 100), 0, 100, 0, 1023));
+}
+
+static void crsfUpdateRcFrameTiming(void)
+{
+    const timeDelta_t periodUs = cmpTimeUs(crsfFrameDoneAt, crsfRcFrameDoneAt);
+    crsfRcFrameDoneAt = crsfFrameDoneAt;
+    crsfRcFrameSize = crsfFrame.frame.frameLength + CRSF_FRAME_LENGTH_ADDRESS + CRSF_FRAME_LENGTH_FRAMELENGTH;
+    // the first frame after a gap doesn't tell when the next one is due, so it gets no response window
+    crsfTelemetryWindowUsed = periodUs < CRSF_FRAME_PERIOD_MIN_US || periodUs > CRSF_FRAME_PERIOD_MAX_US;
+    if (!crsfTelemetryWindowUsed) {
+        // The next frame must not be talked over, so a shorter period is taken straight away and a
+        // longer one, which may just be a lost frame, only slowly
+        if ((uint32_t)periodUs < crsfRcFramePeriodUs) {
+            crsfRcFramePeriodUs = periodUs;
+        } else {
+            crsfRcFramePeriodUs += (periodUs - crsfRcFramePeriodUs) / 8;
+        }
+    }
+}
+
 STATIC_UNIT_TESTED uint8_t crsfFrameStatus(void)
 {
     if (crsfFrameDone) {
         crsfFrameDone = false;
-        if (crsfFrame.frame.type == CRSF_FRAMETYPE_RC_CHANNELS_PACKED) {
+        if (crsfFrame.frame.type == CRSF_FRAMETYPE_LINK_STATISTICS) {
+            crsfHandleLinkStatistics();
+        } else if (crsfFrame.frame.type == CRSF_FRAMETYPE_RC_CHANNELS_PACKED) {
             // CRC includes type and payload of each frame
             const uint8_t crc = crsfFrameCRC();
             if (crc != crsfFrame.frame.payload[CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE]) {
                 return RX_FRAME_PENDING;
             }
             crsfFrame.frame.frameLength = CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE + CRSF_FRAME_LENGTH_TYPE_CRC;
-            // unpack the RC channels
-            const crsfPayloadRcChannelsPacked_t* rcChannels = (crsfPayloadRcChannelsPacked_t*)&crsfFrame.frame.payload;
-            crsfChannelData[0] = rcChannels->chan0;
-            crsfChannelData[1] = rcChannels->chan1;
-            crsfChannelData[2] = rcChannels->chan2;
-            crsfChannelData[3] = rcChannels->chan3;
-            crsfChannelData[4] = rcChannels->chan4;
-            crsfChannelData[5] = rcChannels->chan5;
-            crsfChannelData[6] = rcChannels->chan6;
-            crsfChannelData[7] = rcChannels->chan7;
-            crsfChannelData[8] = rcChannels->chan8;
-            crsfChannelData[9] = rcChannels->chan9;
-            crsfChannelData[10] = rcChannels->chan10;
-            crsfChannelData[11] = rcChannels->chan11;
-            crsfChannelData[12] = rcChannels->chan12;
-            crsfChannelData[13] = rcChannels->chan13;
-            crsfChannelData[14] = rcChannels->chan14;
-            crsfChannelData[15] = rcChannels->chan15;
+            packedChannelsUnpack(crsfChannelData, crsfFrame.frame.payload);
+
+            // the response window opens now, so a waiting telemetry frame goes out without waiting for the telemetry task
+            crsfUpdateRcFrameTiming();
+            crsfRxSendTelemetryData();
+
+            // the receiver keeps sending its failsafe channel values when the uplink is lost
+            if (crsfLinkStatisticsValid && crsfLinkStatistics.uplinkLQ == 0
+                && cmpTimeUs(crsfFrameDoneAt, crsfLinkStatisticsAt) < CRSF_LINK_STATISTICS_TIMEOUT_US) {
+                return RX_FRAME_COMPLETE | RX_FRAME_FAILSAFE;
+            }
             return RX_FRAME_COMPLETE;
         }
     }
+    crsfRxSendTelemetryData();
     return RX_FRAME_PENDING;
 }
 
@@ -191,7 +251,7 @@ STATIC_UNIT_TESTED uint16_t crsfReadRawRC(const rxRuntimeConfig_t *rxRuntimeConf
      * scale factor = (2012-988) / (1811-172) = 0.62477120195241
      * offset = 988 - 172 * 0.62477120195241 = 880.53935326418548
      */
-    return (0.62477120195241f * crsfChannelData[chan]) + 881;
+    return packedChannelToPwm(PACKED_CHANNELS_CRSF, crsfChannelData[chan]);
 }
 
 void crsfRxWriteTelemetryData(const void *data, int len)
@@ -201,18 +261,30 @@ void crsfRxWriteTelemetryData(const void *data, int len)
     telemetryBufLen = len;
 }
 
+bool crsfRxIsTelemetryBufEmpty(void)
+{
+    return telemetryBufLen == 0;
+}
+
+/*
+ * On the half duplex line the receiver only listens between the end of one RC frame and the start of the next,
+ * so one telemetry frame is sent per RC frame, when it can be transmitted completely inside that window.
+ */
 void crsfRxSendTelemetryData(void)
 {
     // if there is telemetry data to write
     if (telemetryBufLen > 0) {
-        // check that we are not in bi dir mode or that we are not currently receiving data (ie in the middle of an RX frame)
-        // and that there is time to send the telemetry frame before the next RX frame arrives
-        if (CRSF_PORT_OPTIONS & SERIAL_BIDIR) {
-            const uint32_t timeSinceStartOfFrame = micros() - crsfFrameStartAt;
-            if ((timeSinceStartOfFrame < CRSF_TIME_NEEDED_PER_FRAME_US) ||
-                (timeSinceStartOfFrame > CRSF_TIME_BETWEEN_FRAMES_US - CRSF_TIME_NEEDED_PER_FRAME_US)) {
+        if (crsfHalfDuplex) {
+            if (crsfTelemetryWindowUsed) {
                 return;
             }
+            const timeDelta_t timeSinceRcFrameUs = cmpTimeUs(micros(), crsfRcFrameDoneAt);
+            const timeDelta_t windowEndUs = (timeDelta_t)crsfRcFramePeriodUs - crsfRcFrameSize * CRSF_TIME_PER_BYTE_US - CRSF_TIME_TURNAROUND_US;
+            if (timeSinceRcFrameUs < CRSF_TIME_TURNAROUND_US
+                || timeSinceRcFrameUs + telemetryBufLen * CRSF_TIME_PER_BYTE_US > windowEndUs) {
+                return;
+            }
+            crsfTelemetryWindowUsed = true;
         }
         serialWriteBuf(serialPort, telemetryBuf, telemetryBufLen);
         telemetryBufLen = 0; // reset telemetry buffer
@@ -230,11 +302,13 @@ bool crsfRxInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
 
     rxRuntimeConfig->rcReadRawFn = crsfReadRawRC;
     rxRuntimeConfig->rcFrameStatusFn = crsfFrameStatus;
+    rxRuntimeConfig->rcFrameTimeUsFn = crsfFrameTimeUs;
 
     const serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_RX_SERIAL);
     if (!portConfig) {
         return false;
     }
+    crsfHalfDuplex = rxConfig->halfDuplex;
 
     serialPort = openSerialPort(portConfig->identifier, 
         FUNCTION_RX_SERIAL, 
@@ -243,6 +317,10 @@ bool crsfRxInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
         CRSF_PORT_MODE, 
         CRSF_PORT_OPTIONS | (rxConfig->halfDuplex ? SERIAL_BIDIR : 0)
         );
+    if (serialPort) {
+        // frames are decoded in one go when the port can tell where they end
+        serialSetRxFrameCallback(serialPort, crsfFrameReceive);
+    }
 
     return serialPort != NULL;
 }
@@ -59,8 +59,8 @@ enum {
     CRSF_ADDRESS_CRSF_TRANSMITTER = 0xEE
 };
 
-#define CRSF_PAYLOAD_SIZE_MAX   32 // !!TODO needs checking
-#define CRSF_FRAME_SIZE_MAX     (CRSF_PAYLOAD_SIZE_MAX + 4)
+#define CRSF_FRAME_SIZE_MAX     64 // the largest frame the protocol allows, including address, length, type and CRC
+#define CRSF_PAYLOAD_SIZE_MAX   (CRSF_FRAME_SIZE_MAX - 4)
 
 typedef struct crsfFrameDef_s {
     uint8_t deviceAddress;
@@ -74,9 +74,24 @@ typedef union crsfFrame_u {
     crsfFrameDef_t frame;
 } crsfFrame_t;
 
+// Sent by the receiver about every 200ms, RSSI values are in -dBm and link qualities in percent
+typedef struct crsfLinkStatistics_s {
+    uint8_t uplinkRSSIAnt1;
+    uint8_t uplinkRSSIAnt2;
+    uint8_t uplinkLQ;
+    int8_t uplinkSNR;
+    uint8_t activeAntenna;
+    uint8_t rfMode;
+    uint8_t uplinkTXPower;
+    uint8_t downlinkRSSI;
+    uint8_t downlinkLQ;
+    int8_t downlinkSNR;
+} __attribute__ ((__packed__)) crsfLinkStatistics_t;
+
 
 void crsfRxWriteTelemetryData(const void *data, int len);
 void crsfRxSendTelemetryData(void);
+bool crsfRxIsTelemetryBufEmpty(void);
 
 struct rxConfig_s;
 struct rxRuntimeConfig_s;
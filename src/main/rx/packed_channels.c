@@ -0,0 +1,59 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "platform.h"
+
+#ifdef SERIAL_RX
+
+#include "rx/packed_channels.h"
+
+#define CHANNEL_MASK 0x7FF
+
+const packedChannelsPwmScale_t packedChannelsPwmScale[PACKED_CHANNELS_PROTOCOL_COUNT] = {
+    // Linear fitting values read from OpenTX-ppmus and comparing with values received by X4R, 5/8 per step + 880
+    // http://www.wolframalpha.com/input/?i=linear+fit+%7B173%2C+988%7D%2C+%7B1812%2C+2012%7D%2C+%7B993%2C+1500%7D
+    [PACKED_CHANNELS_SBUS] = { .scale = 40960, .offset = 880 << 16 },
+    // 172 -> 988us, 992 -> 1500us, 1811 -> 2012us, which is 0.62477120195241 per step + 881 truncated.
+    // The offset is rounded so the result is the same as that float conversion over the whole 11 bit range.
+    [PACKED_CHANNELS_CRSF] = { .scale = 40945, .offset = (881 << 16) + 32 },
+};
+
+// 8 channels take exactly 11 bytes, so the frame is unpacked in two identical halves from three words each
+void packedChannelsUnpack(uint32_t *channels, const uint8_t *packed)
+{
+    for (int half = 0; half < 2; half++) {
+        const uint32_t w0 = packed[0] | (packed[1] << 8) | (packed[2] << 16) | ((uint32_t)packed[3] << 24); // bits 0-31
+        const uint32_t w1 = packed[4] | (packed[5] << 8) | (packed[6] << 16) | ((uint32_t)packed[7] << 24); // bits 32-63
+        const uint32_t w2 = packed[8] | (packed[9] << 8) | (packed[10] << 16);                           // bits 64-87
+
+        channels[0] = w0 & CHANNEL_MASK;
+        channels[1] = (w0 >> 11) & CHANNEL_MASK;
+        channels[2] = ((w0 >> 22) | (w1 << 10)) & CHANNEL_MASK;
+        channels[3] = (w1 >> 1) & CHANNEL_MASK;
+        channels[4] = (w1 >> 12) & CHANNEL_MASK;
+        channels[5] = ((w1 >> 23) | (w2 << 9)) & CHANNEL_MASK;
+        channels[6] = (w2 >> 2) & CHANNEL_MASK;
+        channels[7] = (w2 >> 13) & CHANNEL_MASK;
+
+        channels += 8;
+        packed += PACKED_CHANNELS_SIZE / 2;
+    }
+}
+#endif
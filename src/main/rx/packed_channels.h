@@ -0,0 +1,47 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*
+ * SBUS and CRSF both send 16 channels of 11 bits packed LSB first into 22 bytes.
+ */
+
+#define PACKED_CHANNELS_COUNT   16
+#define PACKED_CHANNELS_SIZE    22 // 11 bits per channel * 16 channels = 22 bytes
+
+typedef enum {
+    PACKED_CHANNELS_SBUS = 0,
+    PACKED_CHANNELS_CRSF,
+    PACKED_CHANNELS_PROTOCOL_COUNT
+} packedChannelsProtocol_e;
+
+// PWM microseconds = value * scale + offset, both in 16.16 fixed point
+typedef struct packedChannelsPwmScale_s {
+    uint32_t scale;
+    uint32_t offset;
+} packedChannelsPwmScale_t;
+
+extern const packedChannelsPwmScale_t packedChannelsPwmScale[PACKED_CHANNELS_PROTOCOL_COUNT];
+
+void packedChannelsUnpack(uint32_t *channels, const uint8_t *packed);
+
+static inline uint16_t packedChannelToPwm(packedChannelsProtocol_e protocol, uint32_t value)
+{
+    const packedChannelsPwmScale_t *pwmScale = &packedChannelsPwmScale[protocol];
+    return (value * pwmScale->scale + pwmScale->offset) >> 16;
+}
@@ -26,6 +26,7 @@
 #include "build/build_config.h"
 #include "build/debug.h"
 
+#include "common/filter.h"
 #include "common/maths.h"
 #include "common/utils.h"
 
@@ -75,6 +76,7 @@ static bool rxIsInFailsafeModeNotDataDriven = true;
 
 static uint32_t rxUpdateAt = 0;
 static uint32_t needRxSignalBefore = 0;
+static timeUs_t lastRxFrameTimeUs = 0;
 static uint32_t needRxSignalMaxDelayUs;
 static uint32_t suspendRxSignalUntil = 0;
 static uint8_t  skipRxSamples = 0;
@@ -106,7 +108,7 @@ static uint8_t rcSampleIndex = 0;
 #define RX_MAX_USEC 2115
 #define RX_MID_USEC 1500
 
-PG_REGISTER_WITH_RESET_FN(rxConfig_t, rxConfig, PG_RX_CONFIG, 0);
+PG_REGISTER_WITH_RESET_FN(rxConfig_t, rxConfig, PG_RX_CONFIG, 1);
 void pgResetFn_rxConfig(rxConfig_t *rxConfig)
 {
     RESET_CONFIG_2(rxConfig_t, rxConfig,
@@ -127,6 +129,8 @@ void pgResetFn_rxConfig(rxConfig_t *rxConfig)
         .rcInterpolation = RC_SMOOTHING_AUTO,
         .rcInterpolationChannels = 0,
         .rcInterpolationInterval = 19,
+        .rcSmoothingFilterType = FILTER_PT1,
+        .rcSmoothingCutoffHz = 0,
         .fpvCamAngleDegrees = 0,
         .max_aux_channel = DEFAULT_AUX_CHANNEL_COUNT,
         .airModeActivateThreshold = 1350
@@ -270,6 +274,7 @@ void rxInit(void)
 {
     rxRuntimeConfig.rcReadRawFn = nullReadRawRC;
     rxRuntimeConfig.rcFrameStatusFn = nullFrameStatus;
+    rxRuntimeConfig.rcFrameTimeUsFn = NULL;
     rcSampleIndex = 0;
     needRxSignalMaxDelayUs = DELAY_10_HZ;
 
@@ -386,6 +391,7 @@ bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime)
             rxSignalReceivedNotDataDriven = true;
             rxIsInFailsafeModeNotDataDriven = false;
             needRxSignalBefore = currentTimeUs + needRxSignalMaxDelayUs;
+            lastRxFrameTimeUs = currentTimeUs;
             resetPPMDataReceivedState();
         }
     } else if (feature(FEATURE_RX_PARALLEL_PWM)) {
@@ -393,6 +399,7 @@ bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime)
             rxSignalReceivedNotDataDriven = true;
             rxIsInFailsafeModeNotDataDriven = false;
             needRxSignalBefore = currentTimeUs + needRxSignalMaxDelayUs;
+            lastRxFrameTimeUs = currentTimeUs;
         }
     } else
 #endif
@@ -404,6 +411,8 @@ bool rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime)
             rxIsInFailsafeMode = (frameStatus & RX_FRAME_FAILSAFE) != 0;
             rxSignalReceived = !rxIsInFailsafeMode;
             needRxSignalBefore = currentTimeUs + needRxSignalMaxDelayUs;
+            // Drivers that timestamp the end of the frame in their ISR keep the scheduling delay out of the interval
+            lastRxFrameTimeUs = rxRuntimeConfig.rcFrameTimeUsFn ? rxRuntimeConfig.rcFrameTimeUsFn() : currentTimeUs;
         }
     }
     return rxDataReceived || (currentTimeUs >= rxUpdateAt); // data driven or 50Hz
@@ -662,6 +671,14 @@ static void updateRSSIADC(timeUs_t currentTimeUs)
 #endif
 }
 
+// For receivers that report the link quality in band, an RSSI channel or ADC input takes precedence
+void rxSetLinkRssi(uint16_t linkRssi)
+{
+    if (rxConfig()->rssi_channel == 0 && !feature(FEATURE_RSSI_ADC)) {
+        rssi = MIN(linkRssi, 1023);
+    }
+}
+
 void updateRSSI(timeUs_t currentTimeUs)
 {
 
@@ -676,3 +693,8 @@ uint16_t rxGetRefreshRate(void)
 {
     return rxRuntimeConfig.rxRefreshRate;
 }
+
+timeUs_t rxFrameTimeUs(void)
+{
+    return lastRxFrameTimeUs;
+}
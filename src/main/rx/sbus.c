@@ -34,6 +34,7 @@
 #endif
 #include "rx/rx.h"
 #include "rx/sbus.h"
+#include "rx/packed_channels.h"
 
 /*
  * Observations
@@ -48,6 +49,7 @@
  */
 
 #define SBUS_TIME_NEEDED_PER_FRAME 3000
+#define SBUS_TIME_PER_BYTE_US 120 // 12 bits at 100000 baud
 
 #ifndef CJMCU
 //#define DEBUG_SBUS_PACKETS
@@ -76,6 +78,7 @@ static uint16_t sbusStateFlags = 0;
 #define SBUS_DIGITAL_CHANNEL_MAX 1812
 
 static bool sbusFrameDone = false;
+static uint32_t sbusFrameDoneAt = 0;
 
 static uint32_t sbusChannelData[SBUS_MAX_CHANNEL];
 
@@ -87,22 +90,7 @@ static uint32_t sbusChannelData[SBUS_MAX_CHANNEL];
 struct sbusFrame_s {
     uint8_t syncByte;
     // 176 bits of data (11 bits per channel * 16 channels) = 22 bytes.
-    unsigned int chan0 : 11;
-    unsigned int chan1 : 11;
-    unsigned int chan2 : 11;
-    unsigned int chan3 : 11;
-    unsigned int chan4 : 11;
-    unsigned int chan5 : 11;
-    unsigned int chan6 : 11;
-    unsigned int chan7 : 11;
-    unsigned int chan8 : 11;
-    unsigned int chan9 : 11;
-    unsigned int chan10 : 11;
-    unsigned int chan11 : 11;
-    unsigned int chan12 : 11;
-    unsigned int chan13 : 11;
-    unsigned int chan14 : 11;
-    unsigned int chan15 : 11;
+    uint8_t channels[PACKED_CHANNELS_SIZE];
     uint8_t flags;
     /**
      * The endByte is 0x00 on FrSky and some futaba RX's, on Some SBUS2 RX's the value indicates the telemetry byte that is sent after every 4th sbus frame.
@@ -121,12 +109,10 @@ typedef union {
 
 static sbusFrame_t sbusFrame;
 
-// Receive ISR callback
-static void sbusDataReceive(uint16_t c)
+static void sbusReceiveByte(uint8_t c, uint32_t now)
 {
     static uint8_t sbusFramePosition = 0;
     static uint32_t sbusFrameStartAt = 0;
-    uint32_t now = micros();
 
     int32_t sbusFrameTime = now - sbusFrameStartAt;
 
@@ -142,11 +128,12 @@ static void sbusDataReceive(uint16_t c)
     }
 
     if (sbusFramePosition < SBUS_FRAME_SIZE) {
-        sbusFrame.bytes[sbusFramePosition++] = (uint8_t)c;
+        sbusFrame.bytes[sbusFramePosition++] = c;
         if (sbusFramePosition < SBUS_FRAME_SIZE) {
             sbusFrameDone = false;
         } else {
             sbusFrameDone = true;
+            sbusFrameDoneAt = now;
 #ifdef DEBUG_SBUS_PACKETS
         debug[2] = sbusFrameTime;
 #endif
@@ -154,6 +141,30 @@ static void sbusDataReceive(uint16_t c)
     }
 }
 
+// Receive ISR callback
+static void sbusDataReceive(uint16_t c)
+{
+    sbusReceiveByte((uint8_t)c, micros());
+}
+
+// Idle line ISR callback with the whole frame
+static void sbusFrameReceive(const uint8_t *data, int length)
+{
+    const uint32_t now = micros();
+    for (int i = 0; i < length; i++) {
+        sbusReceiveByte(data[i], now);
+    }
+    if (sbusFrameDone) {
+        // the line has to stay idle for a character time before the interrupt fires
+        sbusFrameDoneAt = now - SBUS_TIME_PER_BYTE_US;
+    }
+}
+
+static timeUs_t sbusFrameTimeUs(void)
+{
+    return sbusFrameDoneAt;
+}
+
 static uint8_t sbusFrameStatus(void)
 {
     if (!sbusFrameDone) {
@@ -166,22 +177,7 @@ static uint8_t sbusFrameStatus(void)
     debug[1] = sbusFrame.frame.flags;
 #endif
 
-    sbusChannelData[0] = sbusFrame.frame.chan0;
-    sbusChannelData[1] = sbusFrame.frame.chan1;
-    sbusChannelData[2] = sbusFrame.frame.chan2;
-    sbusChannelData[3] = sbusFrame.frame.chan3;
-    sbusChannelData[4] = sbusFrame.frame.chan4;
-    sbusChannelData[5] = sbusFrame.frame.chan5;
-    sbusChannelData[6] = sbusFrame.frame.chan6;
-    sbusChannelData[7] = sbusFrame.frame.chan7;
-    sbusChannelData[8] = sbusFrame.frame.chan8;
-    sbusChannelData[9] = sbusFrame.frame.chan9;
-    sbusChannelData[10] = sbusFrame.frame.chan10;
-    sbusChannelData[11] = sbusFrame.frame.chan11;
-    sbusChannelData[12] = sbusFrame.frame.chan12;
-    sbusChannelData[13] = sbusFrame.frame.chan13;
-    sbusChannelData[14] = sbusFrame.frame.chan14;
-    sbusChannelData[15] = sbusFrame.frame.chan15;
+    packedChannelsUnpack(sbusChannelData, sbusFrame.frame.channels);
 
     if (sbusFrame.frame.flags & SBUS_FLAG_CHANNEL_17) {
         sbusChannelData[16] = SBUS_DIGITAL_CHANNEL_MAX;
@@ -220,9 +216,7 @@ static uint8_t sbusFrameStatus(void)
 static uint16_t sbusReadRawRC(const rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan)
 {
     UNUSED(rxRuntimeConfig);
-    // Linear fitting values read from OpenTX-ppmus and comparing with values received by X4R
-    // http://www.wolframalpha.com/input/?i=linear+fit+%7B173%2C+988%7D%2C+%7B1812%2C+2012%7D%2C+%7B993%2C+1500%7D
-    return (5 * sbusChannelData[chan] / 8) + 880;
+    return packedChannelToPwm(PACKED_CHANNELS_SBUS, sbusChannelData[chan]);
 }
 
 bool sbusInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
@@ -236,6 +230,7 @@ bool sbusInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
 
     rxRuntimeConfig->rcReadRawFn = sbusReadRawRC;
     rxRuntimeConfig->rcFrameStatusFn = sbusFrameStatus;
+    rxRuntimeConfig->rcFrameTimeUsFn = sbusFrameTimeUs;
 
     const serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_RX_SERIAL);
     if (!portConfig) {
@@ -255,6 +250,9 @@ bool sbusInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig)
         portShared ? MODE_RXTX : MODE_RX, 
         SBUS_PORT_OPTIONS | (rxConfig->sbus_inversion ? SERIAL_INVERTED : 0) | (rxConfig->halfDuplex ? SERIAL_BIDIR : 0)
         );
+    if (sBusPort) {
+        serialSetRxFrameCallback(sBusPort, sbusFrameReceive);
+    }
 
 #ifdef TELEMETRY
     if (portShared) {
@@ -24,6 +24,7 @@
 #include "platform.h"
 
 #include "build/debug.h"
+#include "build/profile.h"
 
 #include "scheduler/scheduler.h"
 
@@ -54,11 +55,132 @@ static int taskQueueSize = 0;
 
 static cfTask_t* taskQueueArray[TASK_COUNT + 1]; // extra item for NULL pointer at end of queue
 
+// Whole periods elapsed. Tasks are seldom more than a period late, so the division is seldom needed.
+static uint16_t periodsElapsed(timeUs_t elapsedUs, timeDelta_t period)
+{
+    if (elapsedUs < (timeUs_t)period) {
+        return 0;
+    } else if (elapsedUs < 2 * (timeUs_t)period) {
+        return 1;
+    }
+    return elapsedUs / period;
+}
+
+#ifdef USE_SCHEDULER_DEADLINE_QUEUE
+// Time-driven tasks are kept in a binary min-heap ordered on nextExecuteAt, so each cycle only
+// visits the tasks that are due. Event-driven tasks have to be polled and are kept apart.
+static cfTask_t *deadlineQueueArray[TASK_COUNT];
+static int deadlineQueueSize = 0;
+static cfTask_t *eventTaskArray[TASK_COUNT];
+static int eventTaskCount = 0;
+
+static bool deadlineBefore(const cfTask_t *a, const cfTask_t *b)
+{
+    return cmpTimeUs(a->nextExecuteAt, b->nextExecuteAt) < 0;
+}
+
+static void deadlineQueueSet(int pos, cfTask_t *task)
+{
+    deadlineQueueArray[pos] = task;
+    task->deadlineQueuePos = pos;
+}
+
+static void deadlineQueueSiftUp(int pos)
+{
+    cfTask_t *task = deadlineQueueArray[pos];
+    while (pos > 0) {
+        const int parent = (pos - 1) / 2;
+        if (!deadlineBefore(task, deadlineQueueArray[parent])) {
+            break;
+        }
+        deadlineQueueSet(pos, deadlineQueueArray[parent]);
+        pos = parent;
+    }
+    deadlineQueueSet(pos, task);
+}
+
+static void deadlineQueueSiftDown(int pos)
+{
+    cfTask_t *task = deadlineQueueArray[pos];
+    for (;;) {
+        int child = 2 * pos + 1;
+        if (child >= deadlineQueueSize) {
+            break;
+        }
+        if (child + 1 < deadlineQueueSize && deadlineBefore(deadlineQueueArray[child + 1], deadlineQueueArray[child])) {
+            child++;
+        }
+        if (!deadlineBefore(deadlineQueueArray[child], task)) {
+            break;
+        }
+        deadlineQueueSet(pos, deadlineQueueArray[child]);
+        pos = child;
+    }
+    deadlineQueueSet(pos, task);
+}
+
+static void deadlineQueueUpdate(cfTask_t *task)
+{
+    task->nextExecuteAt = task->lastExecutedAt + task->desiredPeriod;
+    if (task->deadlineQueuePos >= 0 && task->deadlineQueuePos < deadlineQueueSize && deadlineQueueArray[task->deadlineQueuePos] == task) {
+        deadlineQueueSiftUp(task->deadlineQueuePos);
+        deadlineQueueSiftDown(task->deadlineQueuePos);
+    }
+}
+
+static void schedulerQueueAdded(cfTask_t *task)
+{
+    if (task->checkFunc) {
+        task->deadlineQueuePos = -1;
+        eventTaskArray[eventTaskCount++] = task;
+    } else {
+        task->nextExecuteAt = task->lastExecutedAt + task->desiredPeriod;
+        deadlineQueueSet(deadlineQueueSize++, task);
+        deadlineQueueSiftUp(task->deadlineQueuePos);
+    }
+}
+
+static void schedulerQueueRemoved(cfTask_t *task)
+{
+    if (task->checkFunc) {
+        for (int ii = 0; ii < eventTaskCount; ++ii) {
+            if (eventTaskArray[ii] == task) {
+                eventTaskArray[ii] = eventTaskArray[--eventTaskCount];
+                break;
+            }
+        }
+    } else if (task->deadlineQueuePos >= 0) {
+        const int pos = task->deadlineQueuePos;
+        cfTask_t *last = deadlineQueueArray[--deadlineQueueSize];
+        task->deadlineQueuePos = -1;
+        if (last != task) {
+            deadlineQueueSet(pos, last);
+            deadlineQueueSiftUp(pos);
+            deadlineQueueSiftDown(last->deadlineQueuePos);
+        }
+    }
+}
+
+static void schedulerQueueRenumber(void)
+{
+    for (int ii = 0; ii < taskQueueSize; ++ii) {
+        taskQueueArray[ii]->taskQueuePos = ii;
+    }
+}
+#endif
+
 void queueClear(void)
 {
     memset(taskQueueArray, 0, sizeof(taskQueueArray));
     taskQueuePos = 0;
     taskQueueSize = 0;
+#ifdef USE_SCHEDULER_DEADLINE_QUEUE
+    for (int ii = 0; ii < deadlineQueueSize; ++ii) {
+        deadlineQueueArray[ii]->deadlineQueuePos = -1;
+    }
+    deadlineQueueSize = 0;
+    eventTaskCount = 0;
+#endif
 }
 
 bool queueContains(cfTask_t *task)
@@ -81,6 +203,10 @@ bool queueAdd(cfTask_t *task)
             memmove(&taskQueueArray[ii+1], &taskQueueArray[ii], sizeof(task) * (taskQueueSize - ii));
             taskQueueArray[ii] = task;
             ++taskQueueSize;
+#ifdef USE_SCHEDULER_DEADLINE_QUEUE
+            schedulerQueueAdded(task);
+            schedulerQueueRenumber();
+#endif
             return true;
         }
     }
@@ -93,6 +219,10 @@ bool queueRemove(cfTask_t *task)
         if (taskQueueArray[ii] == task) {
             memmove(&taskQueueArray[ii], &taskQueueArray[ii+1], sizeof(task) * (taskQueueSize - ii));
             --taskQueueSize;
+#ifdef USE_SCHEDULER_DEADLINE_QUEUE
+            schedulerQueueRemoved(task);
+            schedulerQueueRenumber();
+#endif
             return true;
         }
     }
@@ -155,14 +285,107 @@ void getTaskInfo(cfTaskId_e taskId, cfTaskInfo_t * taskInfo)
 }
 #endif
 
+#ifdef USE_SCHEDULER_TRACE
+/*
+ * Trace of recent task executions plus per task histograms of lateness and execution time.
+ *
+ * The trace ring has a single writer, the scheduler. traceSequence counts every entry ever written,
+ * an entry is valid for readers while it is less than SCHEDULER_TRACE_SIZE behind traceSequence.
+ */
+static schedulerTraceEntry_t traceRing[SCHEDULER_TRACE_SIZE];
+static volatile uint32_t traceSequence;
+
+static uint8_t histogramBucket(timeDelta_t timeUs)
+{
+    if (timeUs <= 0) {
+        return 0;
+    }
+    const int bucket = 32 - __builtin_clz(timeUs);
+    return MIN(bucket, SCHEDULER_HISTOGRAM_BUCKETS - 1);
+}
+
+static void histogramAdd(uint16_t *histogram, timeDelta_t timeUs)
+{
+    const uint8_t bucket = histogramBucket(timeUs);
+    if (histogram[bucket] == UINT16_MAX) {
+        // keep the shape of the distribution rather than stop counting
+        for (int i = 0; i < SCHEDULER_HISTOGRAM_BUCKETS; i++) {
+            histogram[i] >>= 1;
+        }
+    }
+    histogram[bucket]++;
+}
+
+static void schedulerTraceAdd(cfTask_t *task, timeUs_t startedAt, timeDelta_t lateness, timeUs_t executionTime)
+{
+    histogramAdd(task->latenessHistogram, lateness);
+    histogramAdd(task->executionHistogram, executionTime);
+
+    const uint32_t sequence = traceSequence;
+    schedulerTraceEntry_t *entry = &traceRing[sequence & (SCHEDULER_TRACE_SIZE - 1)];
+    entry->startedAt = startedAt;
+    entry->executionTime = MIN(executionTime, UINT16_MAX);
+    entry->lateness = constrain(lateness, 0, UINT16_MAX);
+    entry->taskId = task - cfTasks;
+    traceSequence = sequence + 1;
+}
+
+const uint16_t *getTaskLatenessHistogram(cfTaskId_e taskId)
+{
+    return cfTasks[taskId].latenessHistogram;
+}
+
+const uint16_t *getTaskExecutionHistogram(cfTaskId_e taskId)
+{
+    return cfTasks[taskId].executionHistogram;
+}
+
+uint32_t schedulerTraceSequence(void)
+{
+    return traceSequence;
+}
+
+/*
+ * Copy up to maxEntries trace entries starting at *sequence, or the oldest entry still held if that has been overwritten.
+ * On return *sequence is the sequence number of the first entry copied. Returns the number of entries copied.
+ */
+int schedulerTraceRead(uint32_t *sequence, schedulerTraceEntry_t *entries, int maxEntries)
+{
+    const uint32_t end = traceSequence;
+    const uint32_t held = MIN(end, SCHEDULER_TRACE_SIZE);
+    uint32_t start = *sequence;
+    if (end - start > held) {
+        start = end - held;
+    }
+    const int count = MIN(end - start, (uint32_t)maxEntries);
+    for (int i = 0; i < count; i++) {
+        entries[i] = traceRing[(start + i) & (SCHEDULER_TRACE_SIZE - 1)];
+    }
+    // drop entries the scheduler overwrote while they were being copied, possible when reading from an interrupt
+    const uint32_t overwritten = traceSequence - start;
+    int dropped = 0;
+    if (overwritten > SCHEDULER_TRACE_SIZE) {
+        dropped = MIN(overwritten - SCHEDULER_TRACE_SIZE, (uint32_t)count);
+        memmove(entries, entries + dropped, (count - dropped) * sizeof(*entries));
+    }
+    *sequence = start + dropped;
+    return count - dropped;
+}
+#endif
+
 void rescheduleTask(cfTaskId_e taskId, uint32_t newPeriodMicros)
 {
+    cfTask_t *task = NULL;
     if (taskId == TASK_SELF) {
-        cfTask_t *task = currentTask;
-        task->desiredPeriod = MAX(SCHEDULER_DELAY_LIMIT, newPeriodMicros);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
+        task = currentTask;
     } else if (taskId < TASK_COUNT) {
-        cfTask_t *task = &cfTasks[taskId];
+        task = &cfTasks[taskId];
+    }
+    if (task) {
         task->desiredPeriod = MAX(SCHEDULER_DELAY_LIMIT, newPeriodMicros);  // Limit delay to 100us (10 kHz) to prevent scheduler clogging
+#ifdef USE_SCHEDULER_DEADLINE_QUEUE
+        deadlineQueueUpdate(task);
+#endif
     }
 }
 
@@ -199,14 +422,20 @@ void schedulerResetTaskStatistics(cfTaskId_e taskId)
 #ifdef SKIP_TASK_STATISTICS
     UNUSED(taskId);
 #else
+    cfTask_t *task = NULL;
     if (taskId == TASK_SELF) {
-        currentTask->movingSumExecutionTime = 0;
-        currentTask->totalExecutionTime = 0;
-        currentTask->maxExecutionTime = 0;
+        task = currentTask;
     } else if (taskId < TASK_COUNT) {
-        cfTasks[taskId].movingSumExecutionTime = 0;
-        cfTasks[taskId].totalExecutionTime = 0;
-        cfTasks[taskId].totalExecutionTime = 0;
+        task = &cfTasks[taskId];
+    }
+    if (task) {
+        task->movingSumExecutionTime = 0;
+        task->totalExecutionTime = 0;
+        task->maxExecutionTime = 0;
+#ifdef USE_SCHEDULER_TRACE
+        memset(task->latenessHistogram, 0, sizeof(task->latenessHistogram));
+        memset(task->executionHistogram, 0, sizeof(task->executionHistogram));
+#endif
     }
 #endif
 }
@@ -218,10 +447,74 @@ void schedulerInit(void)
     queueAdd(&cfTasks[TASK_SYSTEM]);
 }
 
+/*
+ * Event-driven tasks: poll checkFunc until it signals, then age from the time of the signal.
+ * Returns true if the task is waiting to be run.
+ */
+static bool updateEventTaskPriority(cfTask_t *task, timeUs_t currentTimeUs)
+{
+    // Increase priority for event driven tasks
+    if (task->dynamicPriority > 0) {
+        task->taskAgeCycles = 1 + periodsElapsed(currentTimeUs - task->lastSignaledAt, task->desiredPeriod);
+        task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+        return true;
+    }
+
+    const profileTicks_t checkFuncStartTicks = profileTicks();
+    if (task->checkFunc(currentTimeUs, currentTimeUs - task->lastExecutedAt)) {
+        const profileTicks_t checkFuncTicks = profileRecord(PROFILE_CHECK_FUNC, checkFuncStartTicks);
+        UNUSED(checkFuncTicks);
+#if defined(SCHEDULER_DEBUG)
+        DEBUG_SET(DEBUG_SCHEDULER, 3, profileTicksToUs(checkFuncTicks));
+#endif
+#ifndef SKIP_TASK_STATISTICS
+        if (calculateTaskStatistics) {
+            const uint32_t checkFuncExecutionTime = profileTicksToUs(checkFuncTicks);
+            checkFuncMovingSumExecutionTime += checkFuncExecutionTime - checkFuncMovingSumExecutionTime / MOVING_SUM_COUNT;
+            checkFuncTotalExecutionTime += checkFuncExecutionTime;   // time consumed by scheduler + task
+            checkFuncMaxExecutionTime = MAX(checkFuncMaxExecutionTime, checkFuncExecutionTime);
+        }
+#endif
+        task->lastSignaledAt = currentTimeUs;
+        task->taskAgeCycles = 1;
+        task->dynamicPriority = 1 + task->staticPriority;
+        return true;
+    } else {
+        task->taskAgeCycles = 0;
+        return false;
+    }
+}
+
+/*
+ * Highest dynamic priority wins. Within the realtime guard interval only realtime tasks and tasks
+ * that have missed a whole period may be chosen. Ties go to the task earlier in the task queue.
+ */
+static bool taskIsPreferred(const cfTask_t *task, const cfTask_t *selectedTask, uint16_t selectedTaskDynamicPriority, bool outsideRealtimeGuardInterval)
+{
+    const bool taskCanBeChosenForScheduling =
+        (outsideRealtimeGuardInterval) ||
+        (task->taskAgeCycles > 1) ||
+        (task->staticPriority == TASK_PRIORITY_REALTIME);
+    if (!taskCanBeChosenForScheduling) {
+        return false;
+    }
+#ifdef USE_SCHEDULER_DEADLINE_QUEUE
+    // tasks are not visited in queue order
+    if (selectedTask && task->dynamicPriority == selectedTaskDynamicPriority) {
+        return task->taskQueuePos < selectedTask->taskQueuePos;
+    }
+#else
+    UNUSED(selectedTask);
+#endif
+    return task->dynamicPriority > selectedTaskDynamicPriority;
+}
+
 void scheduler(void)
 {
     // Cache currentTime
     const timeUs_t currentTimeUs = micros();
+    const profileTicks_t schedulerStartTicks = profileTicks();
+    profileTicks_t taskTicks = 0;
 
     // Check for realtime tasks
     timeUs_t timeToNextRealtimeTask = TIMEUS_MAX;
@@ -242,59 +535,71 @@ void scheduler(void)
 
     // Update task dynamic priorities
     uint16_t waitingTasks = 0;
+#ifdef USE_SCHEDULER_DEADLINE_QUEUE
+    for (int ii = 0; ii < eventTaskCount; ++ii) {
+        cfTask_t *task = eventTaskArray[ii];
+        if (updateEventTaskPriority(task, currentTimeUs)) {
+            waitingTasks++;
+        }
+        if (taskIsPreferred(task, selectedTask, selectedTaskDynamicPriority, outsideRealtimeGuardInterval)) {
+            selectedTaskDynamicPriority = task->dynamicPriority;
+            selectedTask = task;
+        }
+    }
+
+    // Walk the part of the deadline queue that is due, a subtree whose root is not yet due can be skipped entirely
+    int dueStack[TASK_COUNT];
+    int dueStackSize = 0;
+    if (deadlineQueueSize > 0) {
+        dueStack[dueStackSize++] = 0;
+    }
+    while (dueStackSize > 0) {
+        const int pos = dueStack[--dueStackSize];
+        cfTask_t *task = deadlineQueueArray[pos];
+        if (cmpTimeUs(currentTimeUs, task->nextExecuteAt) < 0) {
+            task->taskAgeCycles = 0;
+            continue;
+        }
+        // Task is time-driven, dynamicPriority is last execution age (measured in desiredPeriods)
+        task->taskAgeCycles = 1 + periodsElapsed(currentTimeUs - task->nextExecuteAt, task->desiredPeriod);
+        task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
+        waitingTasks++;
+        if (taskIsPreferred(task, selectedTask, selectedTaskDynamicPriority, outsideRealtimeGuardInterval)) {
+            selectedTaskDynamicPriority = task->dynamicPriority;
+            selectedTask = task;
+        }
+
+        const int child = 2 * pos + 1;
+        if (child < deadlineQueueSize) {
+            dueStack[dueStackSize++] = child;
+        }
+        if (child + 1 < deadlineQueueSize) {
+            dueStack[dueStackSize++] = child + 1;
+        }
+    }
+#else
     for (cfTask_t *task = queueFirst(); task != NULL; task = queueNext()) {
         // Task has checkFunc - event driven
         if (task->checkFunc) {
-#if defined(SCHEDULER_DEBUG)
-            const timeUs_t currentTimeBeforeCheckFuncCall = micros();
-#else
-            const timeUs_t currentTimeBeforeCheckFuncCall = currentTimeUs;
-#endif
-            // Increase priority for event driven tasks
-            if (task->dynamicPriority > 0) {
-                task->taskAgeCycles = 1 + ((currentTimeUs - task->lastSignaledAt) / task->desiredPeriod);
-                task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
-                waitingTasks++;
-            } else if (task->checkFunc(currentTimeBeforeCheckFuncCall, currentTimeBeforeCheckFuncCall - task->lastExecutedAt)) {
-#if defined(SCHEDULER_DEBUG)
-                DEBUG_SET(DEBUG_SCHEDULER, 3, micros() - currentTimeBeforeCheckFuncCall);
-#endif
-#ifndef SKIP_TASK_STATISTICS
-                if (calculateTaskStatistics) {
-                    const uint32_t checkFuncExecutionTime = micros() - currentTimeBeforeCheckFuncCall;
-                    checkFuncMovingSumExecutionTime += checkFuncExecutionTime - checkFuncMovingSumExecutionTime / MOVING_SUM_COUNT;
-                    checkFuncTotalExecutionTime += checkFuncExecutionTime;   // time consumed by scheduler + task
-                    checkFuncMaxExecutionTime = MAX(checkFuncMaxExecutionTime, checkFuncExecutionTime);
-                }
-#endif
-                task->lastSignaledAt = currentTimeBeforeCheckFuncCall;
-                task->taskAgeCycles = 1;
-                task->dynamicPriority = 1 + task->staticPriority;
+            if (updateEventTaskPriority(task, currentTimeUs)) {
                 waitingTasks++;
-            } else {
-                task->taskAgeCycles = 0;
             }
         } else {
             // Task is time-driven, dynamicPriority is last execution age (measured in desiredPeriods)
             // Task age is calculated from last execution
-            task->taskAgeCycles = ((currentTimeUs - task->lastExecutedAt) / task->desiredPeriod);
+            task->taskAgeCycles = periodsElapsed(currentTimeUs - task->lastExecutedAt, task->desiredPeriod);
             if (task->taskAgeCycles > 0) {
                 task->dynamicPriority = 1 + task->staticPriority * task->taskAgeCycles;
                 waitingTasks++;
             }
         }
 
-        if (task->dynamicPriority > selectedTaskDynamicPriority) {
-            const bool taskCanBeChosenForScheduling =
-                (outsideRealtimeGuardInterval) ||
-                (task->taskAgeCycles > 1) ||
-                (task->staticPriority == TASK_PRIORITY_REALTIME);
-            if (taskCanBeChosenForScheduling) {
-                selectedTaskDynamicPriority = task->dynamicPriority;
-                selectedTask = task;
-            }
+        if (taskIsPreferred(task, selectedTask, selectedTaskDynamicPriority, outsideRealtimeGuardInterval)) {
+            selectedTaskDynamicPriority = task->dynamicPriority;
+            selectedTask = task;
         }
     }
+#endif
 
     totalWaitingTasksSamples++;
     totalWaitingTasks += waitingTasks;
@@ -303,30 +608,49 @@ void scheduler(void)
 
     if (selectedTask) {
         // Found a task that should be run
+#ifdef USE_SCHEDULER_TRACE
+        const timeDelta_t taskLateness = selectedTask->checkFunc
+            ? cmpTimeUs(currentTimeUs, selectedTask->lastSignaledAt)
+            : cmpTimeUs(currentTimeUs, selectedTask->lastExecutedAt + selectedTask->desiredPeriod);
+#endif
         selectedTask->taskLatestDeltaTime = currentTimeUs - selectedTask->lastExecutedAt;
         selectedTask->lastExecutedAt = currentTimeUs;
         selectedTask->dynamicPriority = 0;
+#ifdef USE_SCHEDULER_DEADLINE_QUEUE
+        if (!selectedTask->checkFunc) {
+            deadlineQueueUpdate(selectedTask);
+        }
+#endif
 
         // Execute task
-#ifdef SKIP_TASK_STATISTICS
-        selectedTask->taskFunc(currentTimeUs);
-#else
+        timeUs_t taskStartedAt = currentTimeUs;
+#ifndef SKIP_TASK_STATISTICS
         if (calculateTaskStatistics) {
-            const timeUs_t currentTimeBeforeTaskCall = micros();
-            selectedTask->taskFunc(currentTimeBeforeTaskCall);
-            const timeUs_t taskExecutionTime = micros() - currentTimeBeforeTaskCall;
+            // check functions may have taken a while, so give the task an accurate time
+            taskStartedAt = micros();
+        }
+#endif
+        const profileTicks_t taskStartTicks = profileTicks();
+        selectedTask->taskFunc(taskStartedAt);
+        taskTicks = profileRecord(PROFILE_TASK(selectedTask - cfTasks), taskStartTicks);
+
+#ifndef SKIP_TASK_STATISTICS
+        if (calculateTaskStatistics) {
+            const timeUs_t taskExecutionTime = profileTicksToUs(taskTicks);
             selectedTask->movingSumExecutionTime += taskExecutionTime - selectedTask->movingSumExecutionTime / MOVING_SUM_COUNT;
             selectedTask->totalExecutionTime += taskExecutionTime;   // time consumed by scheduler + task
             selectedTask->maxExecutionTime = MAX(selectedTask->maxExecutionTime, taskExecutionTime);
-        } else {
-            selectedTask->taskFunc(currentTimeUs);
+#ifdef USE_SCHEDULER_TRACE
+            schedulerTraceAdd(selectedTask, taskStartedAt, taskLateness, taskExecutionTime);
+#endif
         }
-
 #endif
+    }
+
+    // time spent in the scheduler itself
+    const profileTicks_t schedulerTicks = profileRecord(PROFILE_SCHEDULER, schedulerStartTicks + taskTicks);
+    UNUSED(schedulerTicks);
 #if defined(SCHEDULER_DEBUG)
-        DEBUG_SET(DEBUG_SCHEDULER, 2, micros() - currentTimeUs - taskExecutionTime); // time spent in scheduler
-    } else {
-        DEBUG_SET(DEBUG_SCHEDULER, 2, micros() - currentTimeUs);
+    DEBUG_SET(DEBUG_SCHEDULER, 2, profileTicksToUs(schedulerTicks));
 #endif
-    }
 }
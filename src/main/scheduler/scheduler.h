@@ -47,6 +47,16 @@ typedef struct {
     timeUs_t     averageExecutionTime;
 } cfTaskInfo_t;
 
+#define SCHEDULER_HISTOGRAM_BUCKETS 16  // bucket n counts times of 2^(n-1) to 2^n-1 us, the last bucket is open ended
+#define SCHEDULER_TRACE_SIZE        64  // must be a power of 2
+
+typedef struct {
+    timeUs_t     startedAt;
+    uint16_t     executionTime;  // saturates at UINT16_MAX
+    uint16_t     lateness;       // time since the task became due, saturates at UINT16_MAX
+    uint8_t      taskId;
+} schedulerTraceEntry_t;
+
 typedef enum {
     /* Actual tasks */
     TASK_SYSTEM = 0,
@@ -113,6 +123,12 @@ typedef enum {
 #ifdef USE_GYRO_DATA_ANALYSE
     TASK_GYRO_DATA_ANALYSE,
 #endif
+#ifdef USE_FLASHFS
+    TASK_FLASHFS,
+#endif
+#ifdef USE_MSP_PUSH
+    TASK_MSP_PUSH,
+#endif
 
     /* Count of real tasks */
     TASK_COUNT,
@@ -137,12 +153,21 @@ typedef struct {
     timeDelta_t taskLatestDeltaTime;
     timeUs_t lastExecutedAt;        // last time of invocation
     timeUs_t lastSignaledAt;        // time of invocation event for event-driven tasks
+#ifdef USE_SCHEDULER_DEADLINE_QUEUE
+    timeUs_t nextExecuteAt;         // lastExecutedAt + desiredPeriod, deadline queue key of time-driven tasks
+    int8_t deadlineQueuePos;        // position in the deadline queue, -1 for event-driven or disabled tasks
+    uint8_t taskQueuePos;           // position in the task queue, breaks ties between equal dynamic priorities
+#endif
 
 #ifndef SKIP_TASK_STATISTICS
     // Statistics
     timeUs_t movingSumExecutionTime;  // moving sum over 32 samples
     timeUs_t maxExecutionTime;
     timeUs_t totalExecutionTime;    // total time consumed by task since boot
+#ifdef USE_SCHEDULER_TRACE
+    uint16_t latenessHistogram[SCHEDULER_HISTOGRAM_BUCKETS];    // halved when a bucket saturates
+    uint16_t executionHistogram[SCHEDULER_HISTOGRAM_BUCKETS];
+#endif
 #endif
 } cfTask_t;
 
@@ -156,6 +181,12 @@ void setTaskEnabled(cfTaskId_e taskId, bool newEnabledState);
 timeDelta_t getTaskDeltaTime(cfTaskId_e taskId);
 void schedulerSetCalulateTaskStatistics(bool calculateTaskStatistics);
 void schedulerResetTaskStatistics(cfTaskId_e taskId);
+#ifdef USE_SCHEDULER_TRACE
+const uint16_t *getTaskLatenessHistogram(cfTaskId_e taskId);
+const uint16_t *getTaskExecutionHistogram(cfTaskId_e taskId);
+uint32_t schedulerTraceSequence(void);
+int schedulerTraceRead(uint32_t *sequence, schedulerTraceEntry_t *entries, int maxEntries);
+#endif
 
 void schedulerInit(void);
 void scheduler(void);
@@ -23,10 +23,12 @@
 #include "platform.h"
 
 #include "build/debug.h"
+#include "build/profile.h"
 
 #include "common/axis.h"
 #include "common/maths.h"
 #include "common/filter.h"
+#include "common/utils.h"
 
 #include "config/parameter_group.h"
 #include "config/parameter_group_ids.h"
@@ -51,6 +53,7 @@
 #include "drivers/bus_spi.h"
 #include "drivers/gyro_sync.h"
 #include "drivers/io.h"
+#include "drivers/nvic.h"
 #include "drivers/system.h"
 
 #include "fc/runtime_config.h"
@@ -73,15 +76,28 @@ gyro_t gyro;
 
 STATIC_UNIT_TESTED gyroDev_t gyroDev0;
 static int16_t gyroTemperature0;
+#if defined(GYRO_USES_SPI) && defined(USE_MPU_DATA_READY_SIGNAL)
+static gyroIsrCallbackFn *gyroIsrCallback;
+#endif
 
 static uint16_t calibratingG = 0;
 
-static filterApplyFnPtr softLpfFilterApplyFn;
-static void *softLpfFilter[3];
-static filterApplyFnPtr notchFilter1ApplyFn;
-static void *notchFilter1[3];
-static filterApplyFnPtr notchFilter2ApplyFn;
-static void *notchFilter2[3];
+// each filter stage processes all three axes in one call
+static filter3ApplyFnPtr softLpfFilterApplyFn;
+static void *softLpfFilter;
+static filter3ApplyFnPtr notchFilter1ApplyFn;
+static biquadFilter3_t notchFilter1;
+static filter3ApplyFnPtr notchFilter2ApplyFn;
+static biquadFilter3_t notchFilter2;
+#ifdef USE_GYRO_DATA_ANALYSE
+static filter3ApplyFnPtr notchFilterDynApplyFn;
+static biquadFilter3_t notchFilterDyn;
+static pt1Filter_t notchFilterDynCenterLpf[XYZ_AXIS_COUNT];
+static float notchFilterDynQ;
+static uint16_t notchFilterDynMaxHz;    // 0 while the tracking notch is off
+
+#define DYN_NOTCH_CENTER_LPF_HZ 10  // smoothing of the tracked frequency, the analysis updates each axis every 30ms
+#endif
 
 #define DEBUG_GYRO_CALIBRATION 3
 
@@ -93,7 +109,7 @@ static void *notchFilter2[3];
 #define GYRO_SYNC_DENOM_DEFAULT 4
 #endif
 
-PG_REGISTER_WITH_RESET_TEMPLATE(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 0);
+PG_REGISTER_WITH_RESET_TEMPLATE(gyroConfig_t, gyroConfig, PG_GYRO_CONFIG, 1);
 
 PG_RESET_TEMPLATE(gyroConfig_t, gyroConfig,
     .gyro_align = ALIGN_DEFAULT,
@@ -108,7 +124,10 @@ PG_RESET_TEMPLATE(gyroConfig_t, gyroConfig,
     .gyro_soft_notch_hz_1 = 400,
     .gyro_soft_notch_cutoff_1 = 300,
     .gyro_soft_notch_hz_2 = 200,
-    .gyro_soft_notch_cutoff_2 = 100
+    .gyro_soft_notch_cutoff_2 = 100,
+    .gyro_dyn_notch = false,
+    .gyro_dyn_notch_q = 250,
+    .gyro_dyn_notch_min_hz = 120
 );
 
 #if defined(USE_GYRO_MPU6050) || defined(USE_GYRO_MPU3050) || defined(USE_GYRO_MPU6500) || defined(USE_GYRO_SPI_MPU6500) || defined(USE_GYRO_SPI_MPU6000) || defined(USE_ACC_MPU6050) || defined(USE_GYRO_SPI_MPU9250) || defined(USE_GYRO_SPI_ICM20601) || defined(USE_GYRO_SPI_ICM20689)
@@ -340,35 +359,30 @@ bool gyroInit(void)
 
 void gyroInitFilterLpf(uint8_t lpfHz)
 {
-    static biquadFilter_t gyroFilterLPF[XYZ_AXIS_COUNT];
-    static pt1Filter_t gyroFilterPt1[XYZ_AXIS_COUNT];
+    static biquadFilter3_t gyroFilterLPF;
+    static pt1Filter3_t gyroFilterPt1;
     static firFilterDenoise_t gyroDenoiseState[XYZ_AXIS_COUNT];
 
-    softLpfFilterApplyFn = nullFilterApply;
+    softLpfFilterApplyFn = nullFilter3Apply;
     const uint32_t gyroFrequencyNyquist = (1.0f / (gyro.targetLooptime * 0.000001f)) / 2; // No rounding needed
 
     if (lpfHz && lpfHz <= gyroFrequencyNyquist) {  // Initialisation needs to happen once samplingrate is known
         switch (gyroConfig()->gyro_soft_lpf_type) {
         case FILTER_BIQUAD:
-            softLpfFilterApplyFn = (filterApplyFnPtr)biquadFilterApply;
-            for (int axis = 0; axis < 3; axis++) {
-                softLpfFilter[axis] = &gyroFilterLPF[axis];
-                biquadFilterInitLPF(softLpfFilter[axis], lpfHz, gyro.targetLooptime);
-            }
+            softLpfFilterApplyFn = (filter3ApplyFnPtr)biquadFilter3Apply;
+            softLpfFilter = &gyroFilterLPF;
+            biquadFilter3InitLPF(&gyroFilterLPF, lpfHz, gyro.targetLooptime);
             break;
         case FILTER_PT1:
-            softLpfFilterApplyFn = (filterApplyFnPtr)pt1FilterApply;
-            const float gyroDt = (float) gyro.targetLooptime * 0.000001f;
-            for (int axis = 0; axis < 3; axis++) {
-                softLpfFilter[axis] = &gyroFilterPt1[axis];
-                pt1FilterInit(softLpfFilter[axis], lpfHz, gyroDt);
-            }
+            softLpfFilterApplyFn = (filter3ApplyFnPtr)pt1Filter3Apply;
+            softLpfFilter = &gyroFilterPt1;
+            pt1Filter3Init(&gyroFilterPt1, lpfHz, (float) gyro.targetLooptime * 0.000001f);
             break;
         default:
-            softLpfFilterApplyFn = (filterApplyFnPtr)firFilterDenoiseUpdate;
-            for (int axis = 0; axis < 3; axis++) {
-                softLpfFilter[axis] = &gyroDenoiseState[axis];
-                firFilterDenoiseInit(softLpfFilter[axis], lpfHz, gyro.targetLooptime);
+            softLpfFilterApplyFn = (filter3ApplyFnPtr)firFilterDenoise3Update;
+            softLpfFilter = gyroDenoiseState;
+            for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+                firFilterDenoiseInit(&gyroDenoiseState[axis], lpfHz, gyro.targetLooptime);
             }
             break;
         }
@@ -377,41 +391,86 @@ void gyroInitFilterLpf(uint8_t lpfHz)
 
 void gyroInitFilterNotch1(uint16_t notchHz, uint16_t notchCutoffHz)
 {
-    static biquadFilter_t gyroFilterNotch[XYZ_AXIS_COUNT];
-
-    notchFilter1ApplyFn = nullFilterApply;
+    notchFilter1ApplyFn = nullFilter3Apply;
     const uint32_t gyroFrequencyNyquist = (1.0f / (gyro.targetLooptime * 0.000001f)) / 2; // No rounding needed
     if (notchHz && notchHz <= gyroFrequencyNyquist) {
-        notchFilter1ApplyFn = (filterApplyFnPtr)biquadFilterApply;
+        notchFilter1ApplyFn = (filter3ApplyFnPtr)biquadFilter3Apply;
         const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
-        for (int axis = 0; axis < 3; axis++) {
-            notchFilter1[axis] = &gyroFilterNotch[axis];
-            biquadFilterInit(notchFilter1[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
-        }
+        biquadFilter3Init(&notchFilter1, notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
     }
 }
 
 void gyroInitFilterNotch2(uint16_t notchHz, uint16_t notchCutoffHz)
 {
-    static biquadFilter_t gyroFilterNotch[XYZ_AXIS_COUNT];
-
-    notchFilter2ApplyFn = nullFilterApply;
+    notchFilter2ApplyFn = nullFilter3Apply;
     const uint32_t gyroFrequencyNyquist = (1.0f / (gyro.targetLooptime * 0.000001f)) / 2; // No rounding needed
     if (notchHz && notchHz <= gyroFrequencyNyquist) {
-        notchFilter2ApplyFn = (filterApplyFnPtr)biquadFilterApply;
+        notchFilter2ApplyFn = (filter3ApplyFnPtr)biquadFilter3Apply;
         const float notchQ = filterGetNotchQ(notchHz, notchCutoffHz);
-        for (int axis = 0; axis < 3; axis++) {
-            notchFilter2[axis] = &gyroFilterNotch[axis];
-            biquadFilterInit(notchFilter2[axis], notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
-        }
+        biquadFilter3Init(&notchFilter2, notchHz, gyro.targetLooptime, notchQ, FILTER_NOTCH);
     }
 }
 
+#ifdef USE_GYRO_DATA_ANALYSE
+void gyroInitFilterDynamicNotch(void)
+{
+    notchFilterDynApplyFn = nullFilter3Apply;
+    notchFilterDynMaxHz = 0;
+    if (!gyroConfig()->gyro_dyn_notch) {
+        return;
+    }
+    // at low gyro rates the range left below Nyquist can be empty, a notch placed beyond it becomes unstable
+    const uint16_t maxHz = gyroFftMaxFreq(gyro.targetLooptime);
+    if (maxHz < gyroConfig()->gyro_dyn_notch_min_hz) {
+        return;
+    }
+    notchFilterDynMaxHz = maxHz;
+    notchFilterDynApplyFn = (filter3ApplyFnPtr)biquadFilter3Apply;
+    notchFilterDynQ = gyroConfig()->gyro_dyn_notch_q / 100.0f;
+    // start at the top of the range, where the filter adds the least delay in the flight band
+    const float updateDt = 1.0f / FFT_AXIS_UPDATE_HZ;
+    biquadFilter3Init(&notchFilterDyn, maxHz, gyro.targetLooptime, notchFilterDynQ, FILTER_NOTCH);
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        pt1FilterInit(&notchFilterDynCenterLpf[axis], DYN_NOTCH_CENTER_LPF_HZ, updateDt);
+        notchFilterDynCenterLpf[axis].state = maxHz;
+    }
+}
+
+/*
+ * Called from the gyro analysis whenever a new peak estimate is available for an axis.
+ */
+void gyroUpdateDynamicNotch(int axis, const gyroFftData_t *fftData)
+{
+    if (!notchFilterDynMaxHz) {
+        return;
+    }
+    // ignore estimates without a clear peak, motor noise stands well out of the noise floor
+    if (!fftData->centerFreq || fftData->peakAmplitude < 2 * fftData->meanAmplitude) {
+        return;
+    }
+    const float centerFreq = constrain(fftData->centerFreq, gyroConfig()->gyro_dyn_notch_min_hz, notchFilterDynMaxHz);
+    const float notchHz = pt1FilterApply(&notchFilterDynCenterLpf[axis], centerFreq);
+    biquadFilter3UpdateNotch(&notchFilterDyn, axis, notchHz, gyro.targetLooptime, notchFilterDynQ);
+    DEBUG_SET(DEBUG_DYN_NOTCH, axis, lrintf(notchHz));
+}
+
+uint16_t gyroDynamicNotchHz(int axis)
+{
+    return notchFilterDynMaxHz ? lrintf(notchFilterDynCenterLpf[axis].state) : 0;
+}
+#endif
+
 void gyroInitFilters(void)
 {
+    // The filters are applied from the data ready interrupt with gyro_isr_update or pid_in_gyro_isr
+    const uint8_t gyroIsrHeld = gyroIsrHold();
     gyroInitFilterLpf(gyroConfig()->gyro_soft_lpf_hz);
     gyroInitFilterNotch1(gyroConfig()->gyro_soft_notch_hz_1, gyroConfig()->gyro_soft_notch_cutoff_1);
     gyroInitFilterNotch2(gyroConfig()->gyro_soft_notch_hz_2, gyroConfig()->gyro_soft_notch_cutoff_2);
+#ifdef USE_GYRO_DATA_ANALYSE
+    gyroInitFilterDynamicNotch();
+#endif
+    gyroIsrRelease(gyroIsrHeld);
 }
 
 bool isGyroCalibrationComplete(void)
@@ -482,9 +541,33 @@ STATIC_UNIT_TESTED void performGyroCalibration(gyroDev_t *gyroDev, uint8_t gyroM
 
 }
 
+/*
+ * Runs the filter chain on all axes and stores the result in gyro.gyroADCf.
+ */
+static void gyroApplyFilters(float *gyroADCf)
+{
+    // Apply LPF
+    softLpfFilterApplyFn(softLpfFilter, gyroADCf);
+
+    // Apply Notch filtering
+    DEBUG_SET(DEBUG_NOTCH, X, lrintf(gyroADCf[X]));
+    DEBUG_SET(DEBUG_NOTCH, Y, lrintf(gyroADCf[Y]));
+    DEBUG_SET(DEBUG_NOTCH, Z, lrintf(gyroADCf[Z]));
+    notchFilter1ApplyFn(&notchFilter1, gyroADCf);
+    notchFilter2ApplyFn(&notchFilter2, gyroADCf);
+#ifdef USE_GYRO_DATA_ANALYSE
+    notchFilterDynApplyFn(&notchFilterDyn, gyroADCf);
+#endif
+
+    gyro.gyroADCf[X] = gyroADCf[X];
+    gyro.gyroADCf[Y] = gyroADCf[Y];
+    gyro.gyroADCf[Z] = gyroADCf[Z];
+}
+
 #if defined(GYRO_USES_SPI) && defined(USE_MPU_DATA_READY_SIGNAL)
 static bool gyroUpdateISR(gyroDev_t* gyroDev)
 {
+    const profileTicks_t startTicks = profileTicks();
     if (!gyroDev->dataReady || !gyroDev->read(gyroDev)) {
         return false;
     }
@@ -499,22 +582,74 @@ static bool gyroUpdateISR(gyroDev_t* gyroDev)
 
     alignSensors(gyroDev->gyroADC, gyroDev->gyroAlign);
 
+    float gyroADCf[XYZ_AXIS_COUNT];
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
         gyroDev->gyroADC[axis] -= gyroDev->gyroZero[axis];
         // scale gyro output to degrees per second
-        float gyroADCf = (float)gyroDev->gyroADC[axis] * gyroDev->scale;
-        gyroADCf = softLpfFilterApplyFn(softLpfFilter[axis], gyroADCf);
-        gyroADCf = notchFilter1ApplyFn(notchFilter1[axis], gyroADCf);
-        gyroADCf = notchFilter2ApplyFn(notchFilter2[axis], gyroADCf);
-        gyro.gyroADCf[axis] = gyroADCf;
+        gyroADCf[axis] = (float)gyroDev->gyroADC[axis] * gyroDev->scale;
     }
+    gyroApplyFilters(gyroADCf);
 #ifdef USE_GYRO_DATA_ANALYSE
     gyroDataAnalyse(gyroDev, &gyro);
 #endif
+    profileRecord(PROFILE_GYRO_UPDATE, startTicks);
+    if (gyroIsrCallback) {
+        gyroIsrCallback(micros());
+    }
     return true;
 }
 #endif
 
+/*
+ * Set a function to be called from the gyro data ready interrupt once the filtered gyro data is available.
+ * Setting a callback forces gyro reads into the interrupt once calibration is complete, as with gyro_isr_update.
+ */
+void gyroSetIsrCallback(gyroIsrCallbackFn *callback)
+{
+#if defined(GYRO_USES_SPI) && defined(USE_MPU_DATA_READY_SIGNAL)
+    gyroIsrCallback = callback;
+    if (callback) {
+        // Otherwise the callback would wait for every other interrupt at the lowest priority
+        mpuIntExtiSetPriority(&gyroDev0, NVIC_PRIO_MPU_INT_EXTI_PID);
+    }
+#else
+    UNUSED(callback);
+#endif
+}
+
+/*
+ * Keep the gyro data ready interrupt from running while thread mode updates state that is used from it, such as the
+ * filters, or the setpoints and PID settings with pid_in_gyro_isr. Pass the value returned to gyroIsrRelease(), the
+ * interrupt runs then if it became pending in the meantime. Calls can be nested.
+ */
+uint8_t gyroIsrHold(void)
+{
+#if defined(GYRO_USES_SPI) && defined(USE_MPU_DATA_READY_SIGNAL)
+    return mpuIntExtiHold();
+#else
+    return 0;
+#endif
+}
+
+void gyroIsrRelease(uint8_t held)
+{
+#if defined(GYRO_USES_SPI) && defined(USE_MPU_DATA_READY_SIGNAL)
+    mpuIntExtiRelease(held);
+#else
+    UNUSED(held);
+#endif
+}
+
+bool gyroIsrUpdateActive(void)
+{
+    return gyroDev0.update != NULL;
+}
+
+timeUs_t gyroDataReadyAtUs(void)
+{
+    return gyroDev0.dataReadyAtUs;
+}
+
 void gyroUpdate(void)
 {
     // range: +/- 8192; +/- 2000 deg/sec
@@ -522,6 +657,10 @@ void gyroUpdate(void)
         // if the gyro update function is set then return, since the gyro is read in gyroUpdateISR
         return;
     }
+#if !defined(MPU_INT_EXTI)
+    // no data ready interrupt to timestamp the sample, so use the time it is read
+    gyroDev0.dataReadyAtUs = micros();
+#endif
     if (!gyroDev0.read(&gyroDev0)) {
         return;
     }
@@ -537,7 +676,7 @@ void gyroUpdate(void)
     if (calibrationComplete) {
 #if defined(GYRO_USES_SPI) && defined(USE_MPU_DATA_READY_SIGNAL)
         // SPI-based gyro so can read and update in ISR
-        if (gyroConfig()->gyro_isr_update) {
+        if (gyroConfig()->gyro_isr_update || gyroIsrCallback) {
             mpuGyroSetIsrUpdate(&gyroDev0, gyroUpdateISR);
             return;
         }
@@ -549,21 +688,14 @@ void gyroUpdate(void)
         performGyroCalibration(&gyroDev0, gyroConfig()->gyroMovementCalibrationThreshold);
     }
 
+    float gyroADCf[XYZ_AXIS_COUNT];
     for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
         gyroDev0.gyroADC[axis] -= gyroDev0.gyroZero[axis];
         // scale gyro output to degrees per second
-        float gyroADCf = (float)gyroDev0.gyroADC[axis] * gyroDev0.scale;
-
-        // Apply LPF
-        DEBUG_SET(DEBUG_GYRO, axis, lrintf(gyroADCf));
-        gyroADCf = softLpfFilterApplyFn(softLpfFilter[axis], gyroADCf);
-
-        // Apply Notch filtering
-        DEBUG_SET(DEBUG_NOTCH, axis, lrintf(gyroADCf));
-        gyroADCf = notchFilter1ApplyFn(notchFilter1[axis], gyroADCf);
-        gyroADCf = notchFilter2ApplyFn(notchFilter2[axis], gyroADCf);
-        gyro.gyroADCf[axis] = gyroADCf;
+        gyroADCf[axis] = (float)gyroDev0.gyroADC[axis] * gyroDev0.scale;
+        DEBUG_SET(DEBUG_GYRO, axis, lrintf(gyroADCf[axis]));
     }
+    gyroApplyFilters(gyroADCf);
 
     if (!calibrationComplete) {
         gyroDev0.gyroADC[X] = lrintf(gyro.gyroADCf[X] / gyroDev0.scale);
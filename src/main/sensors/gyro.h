@@ -19,6 +19,7 @@
 
 #include "config/parameter_group.h"
 #include "common/axis.h"
+#include "common/time.h"
 #include "drivers/io_types.h"
 #include "drivers/sensor.h"
 
@@ -61,6 +62,9 @@ typedef struct gyroConfig_s {
     uint16_t gyro_soft_notch_cutoff_1;
     uint16_t gyro_soft_notch_hz_2;
     uint16_t gyro_soft_notch_cutoff_2;
+    bool     gyro_dyn_notch;                   // track the strongest gyro noise peak with a notch per axis
+    uint16_t gyro_dyn_notch_q;                 // Q of the tracking notch * 100
+    uint16_t gyro_dyn_notch_min_hz;            // lowest frequency the tracking notch may move to
 } gyroConfig_t;
 
 PG_DECLARE(gyroConfig_t, gyroConfig);
@@ -68,6 +72,12 @@ PG_DECLARE(gyroConfig_t, gyroConfig);
 bool gyroInit(void);
 void gyroInitFilters(void);
 void gyroUpdate(void);
+typedef void gyroIsrCallbackFn(timeUs_t currentTimeUs);
+void gyroSetIsrCallback(gyroIsrCallbackFn *callback);
+uint8_t gyroIsrHold(void);
+void gyroIsrRelease(uint8_t held);
+bool gyroIsrUpdateActive(void);
+timeUs_t gyroDataReadyAtUs(void);
 const busDevice_t *gyroSensorBus(void);
 struct mpuConfiguration_s;
 const struct mpuConfiguration_s *gyroMpuConfiguration(void);
@@ -78,3 +88,6 @@ bool isGyroCalibrationComplete(void);
 void gyroReadTemperature(void);
 int16_t gyroGetTemperature(void);
 int16_t gyroRateDps(int axis);
+struct gyroFftData_s;
+void gyroUpdateDynamicNotch(int axis, const struct gyroFftData_s *fftData);
+uint16_t gyroDynamicNotchHz(int axis);
@@ -1,4 +1,23 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
 #include <stdint.h>
+#include <string.h>
+#include <math.h>
 
 #include "platform.h"
 
@@ -17,19 +36,188 @@
 #include "sensors/gyro.h"
 #include "sensors/gyroanalyse.h"
 
+/*
+ * Gyro spectrum analysis.
+ *
+ * gyroDataAnalyse() runs at gyro rate (possibly from the gyro ISR) and only decimates
+ * the unfiltered gyro signal down to FFT_SAMPLING_RATE into a circular buffer per axis.
+ *
+ * gyroDataAnalyseUpdate() runs from TASK_GYRO_DATA_ANALYSE and performs one step of the
+ * analysis of one axis per call, so the cost of the FFT is spread over several scheduler
+ * ticks and no single tick takes more than a few microseconds.
+ */
+
+typedef enum {
+    STEP_WINDOW,        // copy circular buffer into linear order and apply Hanning window
+    STEP_RFFT,          // real FFT of the windowed data
+    STEP_PEAK,          // magnitudes and peak search
+    STEP_COUNT          // must match FFT_STEPS_PER_AXIS
+} fftStep_e;
+
+static uint16_t fftSamplingScale;           // gyro samples per analysed sample
+static uint16_t fftSampleCount;
+static float fftAccumulator[XYZ_AXIS_COUNT];
+static float gyroData[XYZ_AXIS_COUNT][FFT_WINDOW_SIZE];
+static volatile uint8_t fftIdx;             // next write position in gyroData
+
+static float hanningWindow[FFT_WINDOW_SIZE];
+static float fftData[FFT_WINDOW_SIZE];
+static float rfftData[FFT_WINDOW_SIZE];
+static float fftMagnitude[FFT_BIN_COUNT];
+static arm_rfft_fast_instance_f32 fftInstance;
 
-void gyroDataAnalyseInit(void)
+static float fftResolution;                 // Hz per bin
+static uint8_t fftBinMin;                   // first bin considered for peak search
+
+static fftStep_e fftUpdateStep;
+static uint8_t fftUpdateAxis;
+
+static gyroFftData_t fftResult[XYZ_AXIS_COUNT];
+
+void gyroDataAnalyseInit(uint32_t targetLooptimeUs)
 {
+    const float gyroSamplingRate = 1000000.0f / targetLooptimeUs;
+    fftSamplingScale = MAX(1, lrintf(gyroSamplingRate / FFT_SAMPLING_RATE));
+    fftResolution = gyroSamplingRate / fftSamplingScale / FFT_WINDOW_SIZE;
+    fftBinMin = MAX(1, lrintf(ceilf(FFT_MIN_FREQ / fftResolution)));
+
+    arm_rfft_fast_init_f32(&fftInstance, FFT_WINDOW_SIZE);
+
+    for (int i = 0; i < FFT_WINDOW_SIZE; i++) {
+        hanningWindow[i] = 0.5f - 0.5f * cosf(2.0f * M_PIf * i / (FFT_WINDOW_SIZE - 1));
+    }
+
+    fftSampleCount = 0;
+    fftIdx = 0;
+    fftUpdateStep = STEP_WINDOW;
+    fftUpdateAxis = 0;
+    memset(fftAccumulator, 0, sizeof(fftAccumulator));
+    memset(gyroData, 0, sizeof(gyroData));
+    memset(fftResult, 0, sizeof(fftResult));
 }
 
+/*
+ * Collect gyro samples, called at gyro rate.
+ */
 void gyroDataAnalyse(const gyroDev_t *gyroDev, const gyro_t *gyro)
 {
-    UNUSED(gyroDev);
     UNUSED(gyro);
+
+    // analyse the unfiltered signal, so that filters driven by the analysis do not hide the peak they track
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        fftAccumulator[axis] += gyroDev->gyroADC[axis] * gyroDev->scale;
+    }
+
+    if (++fftSampleCount < fftSamplingScale) {
+        return;
+    }
+
+    const float scale = 1.0f / fftSamplingScale;
+    const uint8_t idx = fftIdx;
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        gyroData[axis][idx] = fftAccumulator[axis] * scale;
+        fftAccumulator[axis] = 0;
+    }
+    DEBUG_SET(DEBUG_FFT, 0, lrintf(gyroData[FD_ROLL][idx]));
+
+    fftIdx = (idx + 1) % FFT_WINDOW_SIZE;
+    fftSampleCount = 0;
 }
 
+static void fftFindPeak(gyroFftData_t *result)
+{
+    float peak = 0;
+    uint8_t peakBin = 0;
+    float sum = 0;
+    for (int bin = fftBinMin; bin < FFT_BIN_COUNT; bin++) {
+        sum += fftMagnitude[bin];
+        if (fftMagnitude[bin] > peak) {
+            peak = fftMagnitude[bin];
+            peakBin = bin;
+        }
+    }
+    result->meanAmplitude = sum / (FFT_BIN_COUNT - fftBinMin);
+    result->peakAmplitude = peak;
+
+    if (peakBin == 0) {
+        result->centerFreq = 0;
+        return;
+    }
+
+    // weighted mean of the peak and its neighbours gives sub-bin resolution
+    float weightedSum = peakBin * peak;
+    float weight = peak;
+    if (peakBin > fftBinMin) {
+        weightedSum += (peakBin - 1) * fftMagnitude[peakBin - 1];
+        weight += fftMagnitude[peakBin - 1];
+    }
+    if (peakBin < FFT_BIN_COUNT - 1) {
+        weightedSum += (peakBin + 1) * fftMagnitude[peakBin + 1];
+        weight += fftMagnitude[peakBin + 1];
+    }
+    result->centerFreq = lrintf(weightedSum / weight * fftResolution);
+}
+
+/*
+ * Advance the analysis by one step, called from TASK_GYRO_DATA_ANALYSE.
+ * A full update of all three axes takes XYZ_AXIS_COUNT * STEP_COUNT calls.
+ */
 void gyroDataAnalyseUpdate(timeUs_t currentTimeUs)
 {
     UNUSED(currentTimeUs);
+
+    const uint8_t axis = fftUpdateAxis;
+
+    switch (fftUpdateStep) {
+    case STEP_WINDOW: {
+        // oldest sample first
+        const uint8_t start = fftIdx;
+        for (int i = 0; i < FFT_WINDOW_SIZE; i++) {
+            fftData[i] = gyroData[axis][(start + i) % FFT_WINDOW_SIZE] * hanningWindow[i];
+        }
+        break;
+    }
+    case STEP_RFFT:
+        // note fftData is used as scratch space by arm_rfft_fast_f32
+        arm_rfft_fast_f32(&fftInstance, fftData, rfftData, 0);
+        break;
+    case STEP_PEAK:
+        // rfftData[0..1] holds the purely real DC and Nyquist terms, bin 0 is never used for peak search
+        arm_cmplx_mag_f32(rfftData, fftMagnitude, FFT_BIN_COUNT);
+        fftFindPeak(&fftResult[axis]);
+        DEBUG_SET(DEBUG_FFT, axis + 1, fftResult[axis].centerFreq);
+        gyroUpdateDynamicNotch(axis, &fftResult[axis]);
+        break;
+    default:
+        break;
+    }
+
+    if (++fftUpdateStep >= STEP_COUNT) {
+        fftUpdateStep = STEP_WINDOW;
+        fftUpdateAxis = (fftUpdateAxis + 1) % XYZ_AXIS_COUNT;
+    }
+}
+
+const gyroFftData_t *gyroFftData(int axis)
+{
+    return &fftResult[axis];
+}
+
+float gyroFftResolution(void)
+{
+    return fftResolution;
+}
+
+/*
+ * Highest frequency a notch driven by the analysis may be placed at for the given gyro loop.
+ * The analysis runs at the gyro rate when that is below FFT_SAMPLING_RATE, so the limit is the lower
+ * of the two Nyquist frequencies, less one bin to keep the notch clear of Nyquist.
+ */
+uint16_t gyroFftMaxFreq(uint32_t targetLooptimeUs)
+{
+    const float gyroSamplingRate = 1000000.0f / targetLooptimeUs;
+    const float analyseSamplingRate = gyroSamplingRate / MAX(1, lrintf(gyroSamplingRate / FFT_SAMPLING_RATE));
+    const float nyquist = MIN(FFT_SAMPLING_RATE, analyseSamplingRate) / 2;
+    return (uint16_t)(nyquist - analyseSamplingRate / FFT_WINDOW_SIZE);
 }
 #endif // USE_GYRO_DATA_ANALYSE
@@ -17,10 +17,28 @@
 
 #pragma once
 
+#include "common/axis.h"
 #include "common/time.h"
 
-void gyroDataAnalyseInit(void);
+#define FFT_WINDOW_SIZE       32    // samples per analysis window, 32 keeps a single step well below 10us on F4
+#define FFT_BIN_COUNT         (FFT_WINDOW_SIZE / 2)
+#define FFT_SAMPLING_RATE     1000  // Hz, allows analysis up to 500Hz which covers the motor noise the lowpass filters pass
+#define FFT_MIN_FREQ          100   // Hz, frame resonance and stick input live below this
+#define FFT_UPDATE_RATE_HZ    300   // TASK_GYRO_DATA_ANALYSE rate, one analysis step per run
+#define FFT_STEPS_PER_AXIS    3
+#define FFT_AXIS_UPDATE_HZ    ((float)FFT_UPDATE_RATE_HZ / (FFT_STEPS_PER_AXIS * XYZ_AXIS_COUNT))
+
+typedef struct gyroFftData_s {
+    uint16_t centerFreq;            // Hz, frequency of the strongest peak above FFT_MIN_FREQ, 0 if none found yet
+    float peakAmplitude;            // magnitude of the strongest peak
+    float meanAmplitude;            // mean magnitude of the analysed bins, for judging peak significance
+} gyroFftData_t;
+
+void gyroDataAnalyseInit(uint32_t targetLooptimeUs);
 struct gyroDev_s;
 struct gyro_s;
 void gyroDataAnalyse(const struct gyroDev_s *gyroDev, const struct gyro_s *gyro);
 void gyroDataAnalyseUpdate(timeUs_t currentTimeUs);
+const gyroFftData_t *gyroFftData(int axis);
+float gyroFftResolution(void);
+uint16_t gyroFftMaxFreq(uint32_t targetLooptimeUs);
@@ -175,6 +175,11 @@
 #define USE_FLASHFS
 #define USE_FLASH_M25P16
 
+#define M25P16_DMA_CHANNEL_TX               DMA1_Stream5
+#define M25P16_DMA_CHANNEL_TX_COMPLETE_FLAG DMA_FLAG_TCIF5
+#define M25P16_DMA_CLK                      RCC_AHB1Periph_DMA1
+#define M25P16_DMA_CHANNEL                  DMA_Channel_0
+
 #endif // AIRBOTF4SD
 
 
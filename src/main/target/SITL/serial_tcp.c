@@ -0,0 +1,291 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Serial ports of the SITL target, each one a non-blocking TCP server on localhost.
+ *
+ * Only one client is served per port, a new connection replaces the previous one.
+ * Sockets are polled when the flight code asks for received data, ports with a
+ * receive callback are also polled once per PID loop through tcpSerialPollAll().
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "drivers/serial.h"
+#include "drivers/serial_uart.h"
+
+#include "serial_tcp.h"
+
+static tcpPort_t tcpPorts[SERIAL_PORT_COUNT];
+
+static void tcpSetNonBlocking(int fd)
+{
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+}
+
+static bool tcpListen(tcpPort_t *s, int index)
+{
+    s->listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (s->listenFd < 0) {
+        return false;
+    }
+    const int one = 1;
+    setsockopt(s->listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    tcpSetNonBlocking(s->listenFd);
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(s->tcpPort);
+    if (bind(s->listenFd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(s->listenFd, 1) < 0) {
+        fprintf(stderr, "[SITL] unable to listen on port %u: %s\n", s->tcpPort, strerror(errno));
+        close(s->listenFd);
+        s->listenFd = -1;
+        return false;
+    }
+    printf("[SITL] UART%d listening on tcp://127.0.0.1:%u\n", index + 1, s->tcpPort);
+    return true;
+}
+
+static void tcpFlush(tcpPort_t *s)
+{
+    serialPort_t *port = &s->port;
+    while (port->txBufferTail != port->txBufferHead) {
+        if (s->clientFd < 0) {
+            // nobody listening, data is lost as it would be on an unconnected wire
+            port->txBufferTail = port->txBufferHead;
+            return;
+        }
+        const uint32_t head = port->txBufferHead;
+        const uint32_t tail = port->txBufferTail;
+        const uint32_t count = (head > tail) ? head - tail : port->txBufferSize - tail;
+        const ssize_t sent = send(s->clientFd, (const void *)&port->txBuffer[tail], count, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                close(s->clientFd);
+                s->clientFd = -1;
+            }
+            return;
+        }
+        port->txBufferTail = (tail + sent) % port->txBufferSize;
+    }
+}
+
+static void tcpPoll(tcpPort_t *s)
+{
+    if (s->listenFd < 0) {
+        return;
+    }
+
+    const int fd = accept(s->listenFd, NULL, NULL);
+    if (fd >= 0) {
+        if (s->clientFd >= 0) {
+            close(s->clientFd);
+        }
+        const int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        tcpSetNonBlocking(fd);
+        s->clientFd = fd;
+    }
+
+    if (s->clientFd < 0) {
+        return;
+    }
+
+    serialPort_t *port = &s->port;
+    uint8_t buf[TCP_SERIAL_RX_BUFFER_SIZE];
+    const uint32_t free = (port->rxBufferTail + port->rxBufferSize - port->rxBufferHead - 1) % port->rxBufferSize;
+    if (free == 0) {
+        return;
+    }
+    const ssize_t received = recv(s->clientFd, buf, free, 0);
+    if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        close(s->clientFd);
+        s->clientFd = -1;
+        return;
+    }
+    for (ssize_t i = 0; i < received; i++) {
+        if (port->rxCallback) {
+            port->rxCallback(buf[i]);
+        } else {
+            port->rxBuffer[port->rxBufferHead] = buf[i];
+            port->rxBufferHead = (port->rxBufferHead + 1) % port->rxBufferSize;
+        }
+    }
+}
+
+static uint32_t tcpTotalRxBytesWaiting(const serialPort_t *instance)
+{
+    tcpPort_t *s = (tcpPort_t *)instance;
+    tcpFlush(s);
+    tcpPoll(s);
+    return (instance->rxBufferHead - instance->rxBufferTail + instance->rxBufferSize) % instance->rxBufferSize;
+}
+
+static uint32_t tcpTotalTxBytesFree(const serialPort_t *instance)
+{
+    tcpPort_t *s = (tcpPort_t *)instance;
+    if (!s->buffering) {
+        tcpFlush(s);
+    }
+    const uint32_t used = (instance->txBufferHead - instance->txBufferTail + instance->txBufferSize) % instance->txBufferSize;
+    return (instance->txBufferSize - 1) - used;
+}
+
+static bool tcpIsTransmitBufferEmpty(const serialPort_t *instance)
+{
+    tcpPort_t *s = (tcpPort_t *)instance;
+    tcpFlush(s);
+    return instance->txBufferHead == instance->txBufferTail;
+}
+
+static uint8_t tcpRead(serialPort_t *instance)
+{
+    const uint8_t ch = instance->rxBuffer[instance->rxBufferTail];
+    instance->rxBufferTail = (instance->rxBufferTail + 1) % instance->rxBufferSize;
+    return ch;
+}
+
+static int tcpReadBuf(serialPort_t *instance, uint8_t *data, int count)
+{
+    count = MIN(count, (int)tcpTotalRxBytesWaiting(instance));
+    for (int i = 0; i < count; i++) {
+        data[i] = instance->rxBuffer[instance->rxBufferTail];
+        instance->rxBufferTail = (instance->rxBufferTail + 1) % instance->rxBufferSize;
+    }
+    return count;
+}
+
+static void tcpWrite(serialPort_t *instance, uint8_t ch)
+{
+    tcpPort_t *s = (tcpPort_t *)instance;
+    const uint32_t next = (instance->txBufferHead + 1) % instance->txBufferSize;
+    if (next == instance->txBufferTail) {
+        tcpFlush(s);
+        if (next == instance->txBufferTail) {
+            return;
+        }
+    }
+    instance->txBuffer[instance->txBufferHead] = ch;
+    instance->txBufferHead = next;
+    if (!s->buffering) {
+        tcpFlush(s);
+    }
+}
+
+static void tcpSetBaudRate(serialPort_t *instance, uint32_t baudRate)
+{
+    instance->baudRate = baudRate;
+}
+
+static void tcpSetMode(serialPort_t *instance, portMode_t mode)
+{
+    instance->mode = mode;
+}
+
+static void tcpBeginWrite(serialPort_t *instance)
+{
+    ((tcpPort_t *)instance)->buffering = true;
+}
+
+static void tcpEndWrite(serialPort_t *instance)
+{
+    tcpPort_t *s = (tcpPort_t *)instance;
+    s->buffering = false;
+    tcpFlush(s);
+}
+
+static const struct serialPortVTable tcpVTable = {
+    .serialWrite = tcpWrite,
+    .serialTotalRxWaiting = tcpTotalRxBytesWaiting,
+    .serialTotalTxFree = tcpTotalTxBytesFree,
+    .serialRead = tcpRead,
+    .serialSetBaudRate = tcpSetBaudRate,
+    .isSerialTransmitBufferEmpty = tcpIsTransmitBufferEmpty,
+    .setMode = tcpSetMode,
+    .writeBuf = NULL,
+    .beginWrite = tcpBeginWrite,
+    .endWrite = tcpEndWrite,
+    .readBuf = tcpReadBuf,
+};
+
+serialPort_t *tcpSerialOpen(int index, serialReceiveCallbackPtr rxCallback, uint32_t baudRate, portMode_t mode, portOptions_t options)
+{
+    if (index < 0 || index >= SERIAL_PORT_COUNT) {
+        return NULL;
+    }
+
+    tcpPort_t *s = &tcpPorts[index];
+    if (s->port.vTable == NULL) {
+        s->listenFd = -1;
+        s->clientFd = -1;
+        s->tcpPort = TCP_SERIAL_BASE_PORT + index;
+        if (!tcpListen(s, index)) {
+            return NULL;
+        }
+    }
+
+    s->port.vTable = &tcpVTable;
+    s->port.identifier = index;
+    s->port.rxBuffer = s->rxBuffer;
+    s->port.txBuffer = s->txBuffer;
+    s->port.rxBufferSize = TCP_SERIAL_RX_BUFFER_SIZE;
+    s->port.txBufferSize = TCP_SERIAL_TX_BUFFER_SIZE;
+    s->port.rxBufferHead = s->port.rxBufferTail = 0;
+    s->port.txBufferHead = s->port.txBufferTail = 0;
+    s->port.rxCallback = rxCallback;
+    s->port.baudRate = baudRate;
+    s->port.mode = mode;
+    s->port.options = options;
+    s->buffering = false;
+
+    return &s->port;
+}
+
+void tcpSerialPollAll(void)
+{
+    for (int i = 0; i < SERIAL_PORT_COUNT; i++) {
+        tcpPort_t *s = &tcpPorts[i];
+        if (s->port.vTable && s->port.rxCallback) {
+            tcpPoll(s);
+        }
+    }
+}
+
+// the UART "peripheral" pointers of target.h carry the port number, see serial.c
+serialPort_t *uartOpen(USART_TypeDef *USARTx, serialReceiveCallbackPtr rxCallback, uint32_t baudRate, portMode_t mode, portOptions_t options)
+{
+    return tcpSerialOpen((int)(uintptr_t)USARTx - 1, rxCallback, baudRate, mode, options);
+}
@@ -0,0 +1,42 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "drivers/serial.h"
+
+#define TCP_SERIAL_BASE_PORT    5760    // UART1 listens on this port, UART2 on the next one and so on
+#define TCP_SERIAL_RX_BUFFER_SIZE   1024
+#define TCP_SERIAL_TX_BUFFER_SIZE   2048
+
+typedef struct tcpPort_s {
+    serialPort_t port;
+
+    volatile uint8_t rxBuffer[TCP_SERIAL_RX_BUFFER_SIZE];
+    volatile uint8_t txBuffer[TCP_SERIAL_TX_BUFFER_SIZE];
+
+    int listenFd;
+    int clientFd;
+    uint16_t tcpPort;
+    bool buffering;
+} tcpPort_t;
+
+serialPort_t *tcpSerialOpen(int index, serialReceiveCallbackPtr rxCallback, uint32_t baudRate, portMode_t mode, portOptions_t options);
+void tcpSerialPollAll(void);
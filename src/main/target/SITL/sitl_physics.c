@@ -0,0 +1,230 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Rigid body quadcopter model for the SITL target.
+ *
+ * The model is stepped each time the mixer completes a motor update and writes the
+ * resulting body rates, specific force, pressure and magnetic field into the fake
+ * sensor drivers, which the flight code then reads as if they were hardware.
+ *
+ * Axes and motor order follow the flight code rather than an aerospace convention:
+ * body rates are reported in the gyro's roll/pitch/yaw axes, the attitude quaternion
+ * is integrated exactly as imu.c does, and torques are derived from the quad X mixer
+ * coefficients, so a positive PID output always produces a positive gyro rate.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "platform.h"
+
+#include "common/axis.h"
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "drivers/accgyro_fake.h"
+#include "drivers/barometer_fake.h"
+#include "drivers/compass_fake.h"
+
+#include "sitl_physics.h"
+
+#define SITL_MOTOR_COUNT        4
+
+#define SITL_GRAVITY            9.80665f    // m/s/s
+#define SITL_MASS               0.5f        // kg
+#define SITL_ARM_LENGTH         0.08f       // m, effective lever arm for roll and pitch
+#define SITL_YAW_TORQUE_RATIO   0.012f      // m, reaction torque per unit thrust
+#define SITL_INERTIA_ROLL       0.0015f     // kg m^2
+#define SITL_INERTIA_PITCH      0.0015f
+#define SITL_INERTIA_YAW        0.0030f
+#define SITL_THRUST_TO_WEIGHT   4.0f
+#define SITL_MOTOR_TAU          0.02f       // s, first order motor spin up
+#define SITL_RATE_DRAG          0.002f      // N m s/rad, rotational damping
+#define SITL_LINEAR_DRAG        0.2f        // N s/m
+
+#define SITL_ACC_1G             256         // acc_1G default used by the fake accelerometer
+#define SITL_MAG_FIELD          4096        // fake magnetometer reading along north
+
+#define SITL_MAX_STEP_US        5000        // longer gaps (e.g. during init) are not integrated
+
+// throttle, roll, pitch, yaw, as mixerQuadX in flight/mixer.c
+static const float motorMix[SITL_MOTOR_COUNT][4] = {
+    { 1.0f, -1.0f,  1.0f, -1.0f },          // REAR_R
+    { 1.0f, -1.0f, -1.0f,  1.0f },          // FRONT_R
+    { 1.0f,  1.0f,  1.0f,  1.0f },          // REAR_L
+    { 1.0f,  1.0f, -1.0f, -1.0f },          // FRONT_L
+};
+
+typedef struct sitlState_s {
+    float q0, q1, q2, q3;                   // attitude, as imu.c
+    float rate[XYZ_AXIS_COUNT];             // rad/s, gyro axes
+    float position[XYZ_AXIS_COUNT];         // m, earth frame, z up
+    float velocity[XYZ_AXIS_COUNT];         // m/s, earth frame
+    float motorCommand[SITL_MOTOR_COUNT];   // 0..1
+    float motorThrust[SITL_MOTOR_COUNT];    // N
+    timeUs_t lastUpdateUs;
+} sitlState_t;
+
+static sitlState_t sitl;
+
+void sitlPhysicsInit(void)
+{
+    memset(&sitl, 0, sizeof(sitl));
+    sitl.q0 = 1.0f;
+    sitlPhysicsUpdate(0);
+}
+
+void sitlPhysicsSetMotor(uint8_t index, uint16_t value)
+{
+    if (index < SITL_MOTOR_COUNT) {
+        sitl.motorCommand[index] = constrainf((value - 1000) / 1000.0f, 0.0f, 1.0f);
+    }
+}
+
+static void integrateAttitude(float dt)
+{
+    const float gx = sitl.rate[FD_ROLL] * 0.5f * dt;
+    const float gy = sitl.rate[FD_PITCH] * 0.5f * dt;
+    const float gz = sitl.rate[FD_YAW] * 0.5f * dt;
+
+    const float qa = sitl.q0;
+    const float qb = sitl.q1;
+    const float qc = sitl.q2;
+    sitl.q0 += (-qb * gx - qc * gy - sitl.q3 * gz);
+    sitl.q1 += (qa * gx + qc * gz - sitl.q3 * gy);
+    sitl.q2 += (qa * gy - qb * gz + sitl.q3 * gx);
+    sitl.q3 += (qa * gz + qb * gy - qc * gx);
+
+    const float recipNorm = 1.0f / sqrtf(sq(sitl.q0) + sq(sitl.q1) + sq(sitl.q2) + sq(sitl.q3));
+    sitl.q0 *= recipNorm;
+    sitl.q1 *= recipNorm;
+    sitl.q2 *= recipNorm;
+    sitl.q3 *= recipNorm;
+}
+
+static void rotationMatrix(float rMat[3][3])
+{
+    const float q1q1 = sq(sitl.q1);
+    const float q2q2 = sq(sitl.q2);
+    const float q3q3 = sq(sitl.q3);
+    const float q0q1 = sitl.q0 * sitl.q1;
+    const float q0q2 = sitl.q0 * sitl.q2;
+    const float q0q3 = sitl.q0 * sitl.q3;
+    const float q1q2 = sitl.q1 * sitl.q2;
+    const float q1q3 = sitl.q1 * sitl.q3;
+    const float q2q3 = sitl.q2 * sitl.q3;
+
+    rMat[0][0] = 1.0f - 2.0f * q2q2 - 2.0f * q3q3;
+    rMat[0][1] = 2.0f * (q1q2 - q0q3);
+    rMat[0][2] = 2.0f * (q1q3 + q0q2);
+    rMat[1][0] = 2.0f * (q1q2 + q0q3);
+    rMat[1][1] = 1.0f - 2.0f * q1q1 - 2.0f * q3q3;
+    rMat[1][2] = 2.0f * (q2q3 - q0q1);
+    rMat[2][0] = 2.0f * (q1q3 - q0q2);
+    rMat[2][1] = 2.0f * (q2q3 + q0q1);
+    rMat[2][2] = 1.0f - 2.0f * q1q1 - 2.0f * q2q2;
+}
+
+static void updateSensors(float rMat[3][3], const float specificForce[XYZ_AXIS_COUNT])
+{
+    // the fake gyro has a scale of 1, so readings are in deg/s
+    fakeGyroSet(
+        lrintf(constrainf(sitl.rate[X] * (180.0f / M_PIf), INT16_MIN, INT16_MAX)),
+        lrintf(constrainf(sitl.rate[Y] * (180.0f / M_PIf), INT16_MIN, INT16_MAX)),
+        lrintf(constrainf(sitl.rate[Z] * (180.0f / M_PIf), INT16_MIN, INT16_MAX))
+    );
+
+    // accelerometers measure specific force in the body frame
+    float acc[XYZ_AXIS_COUNT];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        acc[axis] = rMat[X][axis] * specificForce[X] + rMat[Y][axis] * specificForce[Y] + rMat[Z][axis] * specificForce[Z];
+    }
+    const float accScale = SITL_ACC_1G / SITL_GRAVITY;
+    fakeAccSet(
+        lrintf(constrainf(acc[X] * accScale, INT16_MIN, INT16_MAX)),
+        lrintf(constrainf(acc[Y] * accScale, INT16_MIN, INT16_MAX)),
+        lrintf(constrainf(acc[Z] * accScale, INT16_MIN, INT16_MAX))
+    );
+
+    // international standard atmosphere, valid well beyond anything flown here
+    const float pressure = 101325.0f * powf(1.0f - 2.25577e-5f * sitl.position[Z], 5.25588f);
+    fakeBaroSet(lrintf(pressure), 2500);
+
+    // field points north (earth x), rotated into the body frame
+    fakeMagSet(lrintf(rMat[X][X] * SITL_MAG_FIELD), lrintf(rMat[X][Y] * SITL_MAG_FIELD), lrintf(rMat[X][Z] * SITL_MAG_FIELD));
+}
+
+void sitlPhysicsUpdate(timeUs_t currentTimeUs)
+{
+    const timeDelta_t deltaUs = cmpTimeUs(currentTimeUs, sitl.lastUpdateUs);
+    sitl.lastUpdateUs = currentTimeUs;
+    const float dt = (deltaUs > 0 && deltaUs <= SITL_MAX_STEP_US) ? deltaUs * 1e-6f : 0.0f;
+
+    const float maxThrust = SITL_THRUST_TO_WEIGHT * SITL_MASS * SITL_GRAVITY / SITL_MOTOR_COUNT;
+    const float motorK = dt / (SITL_MOTOR_TAU + dt);
+    float thrust = 0;
+    float torque[XYZ_AXIS_COUNT] = { 0, 0, 0 };
+    for (int i = 0; i < SITL_MOTOR_COUNT; i++) {
+        // thrust grows with the square of rpm, which is taken as linear in command
+        const float target = maxThrust * sq(sitl.motorCommand[i]);
+        sitl.motorThrust[i] += motorK * (target - sitl.motorThrust[i]);
+        thrust += sitl.motorThrust[i];
+        torque[FD_ROLL] += motorMix[i][1] * sitl.motorThrust[i] * SITL_ARM_LENGTH;
+        torque[FD_PITCH] += motorMix[i][2] * sitl.motorThrust[i] * SITL_ARM_LENGTH;
+        torque[FD_YAW] += motorMix[i][3] * sitl.motorThrust[i] * SITL_YAW_TORQUE_RATIO;
+    }
+
+    static const float inertia[XYZ_AXIS_COUNT] = { SITL_INERTIA_ROLL, SITL_INERTIA_PITCH, SITL_INERTIA_YAW };
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        sitl.rate[axis] += (torque[axis] - SITL_RATE_DRAG * sitl.rate[axis]) / inertia[axis] * dt;
+    }
+    integrateAttitude(dt);
+
+    float rMat[3][3];
+    rotationMatrix(rMat);
+
+    // thrust acts along body z, rMat maps body to earth
+    float specificForce[XYZ_AXIS_COUNT];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        specificForce[axis] = (rMat[axis][Z] * thrust - SITL_LINEAR_DRAG * sitl.velocity[axis]) / SITL_MASS;
+    }
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        const float accel = specificForce[axis] - (axis == Z ? SITL_GRAVITY : 0.0f);
+        sitl.velocity[axis] += accel * dt;
+        sitl.position[axis] += sitl.velocity[axis] * dt;
+    }
+
+    if (sitl.position[Z] <= 0.0f) {
+        // resting on the ground, which pushes back with whatever the motors do not carry
+        sitl.position[Z] = 0.0f;
+        if (sitl.velocity[Z] < 0.0f) {
+            memset(sitl.velocity, 0, sizeof(sitl.velocity));
+        }
+        if (thrust < SITL_MASS * SITL_GRAVITY) {
+            memset(sitl.rate, 0, sizeof(sitl.rate));
+            specificForce[X] = 0.0f;
+            specificForce[Y] = 0.0f;
+            specificForce[Z] = SITL_GRAVITY;
+        }
+    }
+
+    updateSensors(rMat, specificForce);
+}
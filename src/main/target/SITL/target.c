@@ -0,0 +1,274 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Platform layer of the SITL target: clock, system, config storage and motor outputs.
+ *
+ * micros() is host monotonic time multiplied by SITL_SPEED (environment, default 1), so the
+ * scheduler, PID loop and physics model can be run faster or slower than real time.
+ * Hardware drivers that have no host equivalent are reduced to stubs.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <time.h>
+#include <unistd.h>
+
+#include "platform.h"
+
+#include "common/maths.h"
+#include "common/utils.h"
+
+#include "drivers/adc.h"
+#include "drivers/io.h"
+#include "drivers/light_led.h"
+#include "drivers/pwm_output.h"
+#include "drivers/stack_check.h"
+#include "drivers/system.h"
+#include "drivers/timer.h"
+
+#include "sitl_physics.h"
+#include "serial_tcp.h"
+
+#define EEPROM_FILENAME "eeprom.bin"
+
+uint32_t SystemCoreClock = 1000000000;  // reported by the CLI only
+
+uint8_t eepromData[EEPROM_SIZE] __attribute__((section(".eeprom"), aligned(4)));
+
+static struct timespec startTime;
+static double clockSpeed = 1.0;
+
+static uint64_t hostNanos(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)(now.tv_sec - startTime.tv_sec) * 1000000000ULL + now.tv_nsec - startTime.tv_nsec;
+}
+
+uint32_t micros(void)
+{
+    return (uint32_t)(uint64_t)(hostNanos() * clockSpeed / 1000);
+}
+
+uint32_t microsISR(void)
+{
+    return micros();
+}
+
+uint32_t millis(void)
+{
+    return (uint32_t)(uint64_t)(hostNanos() * clockSpeed / 1000000);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    const struct timespec ts = {
+        .tv_sec = (time_t)(us / clockSpeed / 1000000),
+        .tv_nsec = (long)((uint64_t)(us / clockSpeed * 1000) % 1000000000)
+    };
+    nanosleep(&ts, NULL);
+}
+
+void delay(uint32_t ms)
+{
+    delayMicroseconds(ms * 1000);
+}
+
+static void eepromLoad(void)
+{
+    memset(eepromData, 0, sizeof(eepromData));
+    FILE *f = fopen(EEPROM_FILENAME, "rb");
+    if (f) {
+        const size_t n = fread(eepromData, 1, sizeof(eepromData), f);
+        fclose(f);
+        printf("[SITL] loaded %u bytes of config from %s\n", (unsigned)n, EEPROM_FILENAME);
+    }
+}
+
+static void eepromSave(void)
+{
+    FILE *f = fopen(EEPROM_FILENAME, "wb");
+    if (!f) {
+        fprintf(stderr, "[SITL] unable to write %s\n", EEPROM_FILENAME);
+        return;
+    }
+    fwrite(eepromData, 1, sizeof(eepromData), f);
+    fclose(f);
+}
+
+void systemInit(void)
+{
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+    const char *speed = getenv("SITL_SPEED");
+    if (speed && atof(speed) > 0) {
+        clockSpeed = atof(speed);
+    }
+    printf("[SITL] %s running at %.2fx real time\n", TARGET_BOARD_IDENTIFIER, clockSpeed);
+
+    // output is read by scripts, do not let it sit in a buffer
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    eepromLoad();
+    sitlPhysicsInit();
+}
+
+void systemReset(void)
+{
+    printf("[SITL] reset\n");
+    // start over with a fresh process, sockets are close-on-exec
+    execl("/proc/self/exe", "betaflight_SITL", (char *)NULL);
+    exit(0);
+}
+
+void systemResetToBootloader(void)
+{
+    printf("[SITL] no bootloader, exiting\n");
+    exit(0);
+}
+
+void failureMode(failureMode_e mode)
+{
+    fprintf(stderr, "[SITL] failure mode %d\n", mode);
+    exit(1);
+}
+
+// config area, see target/link/sitl.ld
+
+void FLASH_Unlock(void)
+{
+}
+
+void FLASH_Lock(void)
+{
+    eepromSave();
+}
+
+FLASH_Status FLASH_ErasePage(uintptr_t Page_Address)
+{
+    if (Page_Address < (uintptr_t)eepromData || Page_Address >= (uintptr_t)eepromData + EEPROM_SIZE) {
+        return FLASH_ERROR_PG;
+    }
+    const uintptr_t offset = Page_Address - (uintptr_t)eepromData;
+    memset(&eepromData[offset], 0xff, MIN((uintptr_t)FLASH_PAGE_SIZE, EEPROM_SIZE - offset));
+    return FLASH_COMPLETE;
+}
+
+FLASH_Status FLASH_ProgramWord(uintptr_t addr, uint32_t Data)
+{
+    if (addr < (uintptr_t)eepromData || addr + sizeof(Data) > (uintptr_t)eepromData + EEPROM_SIZE) {
+        return FLASH_ERROR_PG;
+    }
+    // the words are stored little endian like the MCU does, byte by byte so LTO doesn't size the write by the
+    // one byte __config_start symbol the config code derives the address from
+    uint8_t *dst = eepromData + (addr - (uintptr_t)eepromData);
+    for (unsigned i = 0; i < sizeof(Data); i++) {
+        dst[i] = Data >> (8 * i);
+    }
+    return FLASH_COMPLETE;
+}
+
+// motors drive the physics model, which is stepped once per mixer update
+
+static pwmOutputPort_t motors[MAX_SUPPORTED_MOTORS];
+static uint8_t motorCount;
+static bool motorsEnabled = false;
+
+void motorDevInit(const motorDevConfig_t *motorConfig, uint16_t idlePulse, uint8_t count)
+{
+    UNUSED(motorConfig);
+    UNUSED(idlePulse);
+
+    motorCount = MIN(count, MAX_SUPPORTED_MOTORS);
+    for (int i = 0; i < motorCount; i++) {
+        motors[i].enabled = true;
+    }
+    motorsEnabled = true;
+}
+
+void pwmWriteMotor(uint8_t index, uint16_t value)
+{
+    if (index < motorCount) {
+        sitlPhysicsSetMotor(index, value);
+    }
+}
+
+void pwmShutdownPulsesForAllMotors(uint8_t count)
+{
+    UNUSED(count);
+    motorsEnabled = false;
+    for (int i = 0; i < motorCount; i++) {
+        sitlPhysicsSetMotor(i, 0);
+    }
+}
+
+void pwmCompleteMotorUpdate(uint8_t count)
+{
+    UNUSED(count);
+    sitlPhysicsUpdate(micros());
+    tcpSerialPollAll();
+}
+
+pwmOutputPort_t *pwmGetMotors(void)
+{
+    return motors;
+}
+
+bool pwmAreMotorsEnabled(void)
+{
+    return motorsEnabled;
+}
+
+// no hardware behind these
+
+void IOInitGlobal(void)
+{
+}
+
+void ledInit(const statusLedConfig_t *statusLedConfig)
+{
+    UNUSED(statusLedConfig);
+}
+
+void timerInit(void)
+{
+}
+
+void timerStart(void)
+{
+}
+
+uint16_t adcGetChannel(uint8_t channel)
+{
+    UNUSED(channel);
+    return 0;
+}
+
+uint32_t stackTotalSize(void)
+{
+    return 0;
+}
+
+uint32_t stackHighMem(void)
+{
+    return 0;
+}
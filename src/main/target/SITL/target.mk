@@ -0,0 +1,7 @@
+SITL_TARGETS += $(TARGET)
+FEATURES    =
+
+TARGET_SRC = \
+            drivers/accgyro_fake.c \
+            drivers/barometer_fake.c \
+            drivers/compass_fake.c
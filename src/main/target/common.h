@@ -27,6 +27,7 @@
 
 //#define SCHEDULER_DEBUG // define this to use scheduler debug[] values. Undefined by default for performance reasons
 #define DEBUG_MODE DEBUG_NONE // change this to change initial debug mode
+#define USE_SCHEDULER_DEADLINE_QUEUE // only visit due tasks each cycle, undefine to scan the whole task queue
 
 #define I2C1_OVERCLOCK true
 #define I2C2_OVERCLOCK true
@@ -45,19 +46,31 @@
 
 #ifdef STM32F4
 #define USE_DSHOT
+#define USE_DSHOT_TELEMETRY
 #define I2C3_OVERCLOCK true
 #define TELEMETRY_IBUS
+#define USE_GYRO_DATA_ANALYSE
+#define USE_SCHEDULER_TRACE
+#define USE_PROFILE
+#define USE_CLI_SETTING_NAME_INDEX // sorted in RAM, two bytes per setting
 #endif
 
 #ifdef STM32F7
 #define I2C3_OVERCLOCK true
 #define I2C4_OVERCLOCK true
 #define TELEMETRY_IBUS
+#define USE_GYRO_DATA_ANALYSE
+#define USE_SCHEDULER_TRACE
+#define USE_PROFILE
+#define USE_CLI_SETTING_NAME_INDEX // sorted in RAM, two bytes per setting
 #endif
 
 #if defined(STM32F4) || defined(STM32F7)
 #define TASK_GYROPID_DESIRED_PERIOD     125
 #define SCHEDULER_DELAY_LIMIT           10
+#define FLASHFS_WRITE_BUFFER_SIZE       1024
+#define USE_FLASHFS_LOG_INDEX
+#define AFATFS_NUM_CACHE_SECTORS        16
 #else
 #define TASK_GYROPID_DESIRED_PERIOD     1000
 #define SCHEDULER_DELAY_LIMIT           100
@@ -103,6 +116,7 @@
 #define TELEMETRY_SRXL
 #define USE_DASHBOARD
 #define USE_MSP_DISPLAYPORT
+#define USE_MSP_PUSH
 #define USE_RX_MSP
 #define USE_SERIALRX_JETIEXBUS
 #define USE_SENSOR_NAMES
@@ -25,3 +25,8 @@
 # undef VTX_SMARTAUDIO
 # undef VTX_TRAMP
 #endif
+
+// The log index is part of flashfs
+#ifndef USE_FLASHFS
+# undef USE_FLASHFS_LOG_INDEX
+#endif
@@ -64,7 +64,7 @@
 #include "fc/config.h"
 #endif
 
-#define CRSF_CYCLETIME_US                   100000 // 100ms, 10 Hz
+#define CRSF_CYCLETIME_US                   100000 // 100ms, 10 Hz for the whole schedule
 
 static bool crsfTelemetryEnabled;
 static uint8_t crsfFrame[CRSF_FRAME_SIZE_MAX];
@@ -314,12 +314,12 @@ void handleCrsfTelemetry(timeUs_t currentTimeUs)
         return;
     }
     // Give the receiver a chance to send any outstanding telemetry data.
-    // This needs to be done at high frequency, to enable the RX to send the telemetry frame
-    // in between the RX frames.
+    // The RX driver also does this as soon as an RX frame arrives, this catches the rest of the response window.
     crsfRxSendTelemetryData();
 
-    // Actual telemetry data only needs to be sent at a low frequency, ie 10Hz
-    if (currentTimeUs >= crsfLastCycleTime + CRSF_CYCLETIME_US) {
+    // The frames of the schedule are spread over the cycle, and a frame is only built once the receiver
+    // has sent the previous one, so none are overwritten when the response windows are busy
+    if (crsfRxIsTelemetryBufEmpty() && cmpTimeUs(currentTimeUs, crsfLastCycleTime) >= CRSF_CYCLETIME_US / crsfScheduleCount) {
         crsfLastCycleTime = currentTimeUs;
         processCrsf();
     }
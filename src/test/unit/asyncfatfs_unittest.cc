@@ -0,0 +1,293 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+
+    #include "drivers/block_device_mmap.h"
+    #include "drivers/sdcard.h"
+
+    #include "io/asyncfatfs/asyncfatfs.h"
+    #include "io/asyncfatfs/fat_standard.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SECTOR_SIZE             512
+
+/*
+ * A FAT16 volume of 8000 clusters of 4KiB, the freefile takes most of it so that contiguous files have superclusters
+ * of 1MiB to work with.
+ */
+#define PARTITION_START         8
+#define RESERVED_SECTORS        1
+#define SECTORS_PER_CLUSTER     8
+#define CLUSTER_COUNT           8000
+#define FAT_SECTORS             32
+#define ROOT_ENTRY_COUNT        512
+#define ROOT_DIR_SECTORS        (ROOT_ENTRY_COUNT * FAT_DIRECTORY_ENTRY_SIZE / SECTOR_SIZE)
+#define VOLUME_SECTORS          (RESERVED_SECTORS + 2 * FAT_SECTORS + ROOT_DIR_SECTORS + CLUSTER_COUNT * SECTORS_PER_CLUSTER)
+#define CARD_BLOCKS             (PARTITION_START + VOLUME_SECTORS)
+
+// Timing of a slow card on a 21MHz SPI bus
+#define LOOP_TIME_US            125     // afatfs_poll() is called once per loop
+#define TRANSMIT_TIME_US        200     // sending a block
+#define READ_TIME_US            300
+#define SINGLE_WRITE_BUSY_US    1500    // programming a block written by itself
+#define MULTI_WRITE_BUSY_US     250     // programming a block of a pre-erased multi-block write
+#define STOP_TRAN_BUSY_US       500     // finishing a multi-block write
+
+static const blockDeviceTiming_t cardTiming = {
+    .readUs = READ_TIME_US,
+    .transmitUs = TRANSMIT_TIME_US,
+    .writeUs = SINGLE_WRITE_BUSY_US,
+    .multiWriteUs = MULTI_WRITE_BUSY_US,
+    .stopUs = STOP_TRAN_BUSY_US,
+    .eraseUs = 0,
+    .failEvery = 0,
+};
+
+static uint8_t *card;
+
+static uint32_t simTimeUs;
+
+static afatfsFilePtr_t openedFile;
+static bool fileOpenComplete;
+static bool fileCloseComplete;
+
+static void formatCard(void)
+{
+    ASSERT_TRUE(blockDeviceMmapOpen(NULL, CARD_BLOCKS * SECTOR_SIZE, 4096));
+    card = blockDeviceMmapGetImage();
+
+    mbrPartitionEntry_t *partition = (mbrPartitionEntry_t *)(card + 446);
+    partition->type = MBR_PARTITION_TYPE_FAT16_LBA;
+    partition->lbaBegin = PARTITION_START;
+    partition->numSectors = VOLUME_SECTORS;
+    card[510] = 0x55;
+    card[511] = 0xAA;
+
+    uint8_t *volumeSector = card + PARTITION_START * SECTOR_SIZE;
+    fatVolumeID_t *volume = (fatVolumeID_t *)volumeSector;
+    volume->bytesPerSector = SECTOR_SIZE;
+    volume->sectorsPerCluster = SECTORS_PER_CLUSTER;
+    volume->reservedSectorCount = RESERVED_SECTORS;
+    volume->numFATs = 2;
+    volume->rootEntryCount = ROOT_ENTRY_COUNT;
+    volume->media = 0xF8;
+    volume->FATSize16 = FAT_SECTORS;
+    volume->totalSectors32 = VOLUME_SECTORS;
+    volumeSector[510] = FAT_VOLUME_ID_SIGNATURE_1;
+    volumeSector[511] = FAT_VOLUME_ID_SIGNATURE_2;
+
+    for (int fat = 0; fat < 2; fat++) {
+        uint16_t *entries = (uint16_t *)(volumeSector + (RESERVED_SECTORS + fat * FAT_SECTORS) * SECTOR_SIZE);
+        entries[0] = 0xFFF8;
+        entries[1] = 0xFFFF;
+    }
+}
+
+static void runLoop(void)
+{
+    simTimeUs += LOOP_TIME_US;
+    afatfs_poll();
+}
+
+static void mountCard(void)
+{
+    simTimeUs = 0;
+    formatCard();
+    blockDeviceMmapSetTiming(&cardTiming);
+
+    afatfs_init(&blockDeviceMmapSdcardVTable);
+    for (int i = 0; i < 100000 && afatfs_getFilesystemState() == AFATFS_FILESYSTEM_STATE_INITIALIZATION; i++) {
+        runLoop();
+    }
+    ASSERT_EQ(AFATFS_FILESYSTEM_STATE_READY, afatfs_getFilesystemState());
+}
+
+static void unmountCard(void)
+{
+    for (int i = 0; i < 100000 && !afatfs_destroy(false); i++) {
+        runLoop();
+    }
+    blockDeviceMmapClose();
+}
+
+static void fileOpened(afatfsFilePtr_t file)
+{
+    openedFile = file;
+    fileOpenComplete = true;
+}
+
+static void fileClosed(void)
+{
+    fileCloseComplete = true;
+}
+
+static afatfsFilePtr_t openFile(const char *filename, const char *mode)
+{
+    fileOpenComplete = false;
+    openedFile = NULL;
+    EXPECT_TRUE(afatfs_fopen(filename, mode, fileOpened));
+    for (int i = 0; i < 100000 && !fileOpenComplete; i++) {
+        runLoop();
+    }
+    EXPECT_TRUE(fileOpenComplete);
+    return openedFile;
+}
+
+static void closeFile(afatfsFilePtr_t file)
+{
+    fileCloseComplete = false;
+    for (int i = 0; i < 100000 && !afatfs_fclose(file, fileClosed); i++) {
+        runLoop();
+    }
+    for (int i = 0; i < 100000 && !fileCloseComplete; i++) {
+        runLoop();
+    }
+    EXPECT_TRUE(fileCloseComplete);
+}
+
+static uint8_t fileByte(uint32_t offset)
+{
+    return (uint8_t)(offset * 13 + (offset >> 9) + (offset >> 17));
+}
+
+/*
+ * Write `length` bytes to a new file, offering up to `bytesPerLoop` each loop like the blackbox does. Returns the number
+ * of bytes that were dropped because the cache was full.
+ */
+static uint32_t writeFile(const char *filename, const char *mode, uint32_t length, uint32_t bytesPerLoop, bool retry)
+{
+    afatfsFilePtr_t file = openFile(filename, mode);
+    EXPECT_TRUE(file != NULL);
+    if (!file) {
+        return length;
+    }
+
+    uint8_t buffer[SECTOR_SIZE];
+    uint32_t offset = 0;
+    uint32_t dropped = 0;
+
+    while (offset + dropped < length) {
+        const uint32_t chunk = MIN(bytesPerLoop, length - offset - dropped);
+        for (uint32_t i = 0; i < chunk; i++) {
+            buffer[i] = fileByte(offset + i);
+        }
+        const uint32_t written = afatfs_fwrite(file, buffer, chunk);
+        offset += written;
+        if (!retry) {
+            dropped += chunk - written;
+        }
+        runLoop();
+        if (afatfs_getFilesystemState() != AFATFS_FILESYSTEM_STATE_READY || afatfs_isFull()) {
+            ADD_FAILURE() << "filesystem failed while writing";
+            break;
+        }
+    }
+
+    closeFile(file);
+    return dropped;
+}
+
+static void expectFileContent(const char *filename, uint32_t length)
+{
+    afatfsFilePtr_t file = openFile(filename, "r");
+    ASSERT_TRUE(file != NULL);
+
+    uint8_t buffer[SECTOR_SIZE];
+    uint32_t offset = 0;
+    for (int i = 0; i < 1000000 && !afatfs_feof(file); i++) {
+        const uint32_t bytesRead = afatfs_fread(file, buffer, sizeof(buffer));
+        for (uint32_t j = 0; j < bytesRead; j++) {
+            if (buffer[j] != fileByte(offset + j)) {
+                ADD_FAILURE() << filename << " differs at offset " << offset + j;
+                closeFile(file);
+                return;
+            }
+        }
+        offset += bytesRead;
+        runLoop();
+    }
+    EXPECT_EQ(length, offset);
+
+    closeFile(file);
+}
+
+static void checkStreamedAppend(const char *filename, const char *mode, uint32_t length)
+{
+    mountCard();
+
+    const int startMulti = blockDeviceMmapGetStats()->multiWrites;
+
+    EXPECT_EQ(0u, writeFile(filename, mode, length, SECTOR_SIZE, true));
+
+    const int multi = blockDeviceMmapGetStats()->multiWrites - startMulti;
+
+    // Nearly every block of the file goes out as part of a multi-block write, leaving the FAT and directory updates
+    EXPECT_GE(multi, (int)(length / SECTOR_SIZE) * 95 / 100);
+
+    expectFileContent(filename, length);
+
+    unmountCard();
+}
+
+TEST(AsyncfatfsUnittest, TestContiguousAppendStreams)
+{
+    checkStreamedAppend("LOG00001.BFL", "as", 2 * 1024 * 1024);
+}
+
+TEST(AsyncfatfsUnittest, TestAppendStreams)
+{
+    // Regular files only get the clusters the freefile leaves behind
+    checkStreamedAppend("LOG00001.TXT", "a", 256 * 1024);
+}
+
+TEST(AsyncfatfsUnittest, TestLoggingRateIsSustained)
+{
+    mountCard();
+
+    // 48 bytes every 125us is 375KiB/s, well within the streaming rate but over four times the single block one
+    EXPECT_EQ(0u, writeFile("LOG00002.BFL", "as", 3 * 1024 * 1024 / 2, 48, false));
+    expectFileContent("LOG00002.BFL", 3 * 1024 * 1024 / 2);
+
+    unmountCard();
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void)
+{
+    return simTimeUs;
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    simTimeUs += us;
+}
+
+}
@@ -21,6 +21,7 @@
 #include <limits.h>
 
 #include <math.h>
+#include <stdio.h>
 
 extern "C" {
     #include "common/filter.h"
@@ -145,3 +146,60 @@ TEST(FilterUnittest, TestFirFilterApply)
     expected = 7.0f * 26.0f + 6.0 * 27.0 + 5.0 * 28.0 + 4.0f * 29.0f;
     EXPECT_FLOAT_EQ(expected, firFilterApply(&filter));
 }
+
+TEST(FilterUnittest, TestBiquadFilterUpdateNotch)
+{
+    const uint32_t looptime = 125;
+    const float Q = 2.5f;
+    biquadFilter_t reference;
+    biquadFilter_t filter;
+
+    biquadFilterInit(&filter, 400, looptime, Q, FILTER_NOTCH);
+    filter.d1 = 1.0f;
+    filter.d2 = 2.0f;
+
+    for (int notchHz = 50; notchHz < 4000; notchHz += 37) {
+        biquadFilterInit(&reference, notchHz, looptime, Q, FILTER_NOTCH);
+        biquadFilterUpdateNotch(&filter, notchHz, looptime, Q);
+
+        EXPECT_NEAR(reference.b0, filter.b0, 1e-4f);
+        EXPECT_NEAR(reference.b1, filter.b1, 1e-4f);
+        EXPECT_NEAR(reference.b2, filter.b2, 1e-4f);
+        EXPECT_NEAR(reference.a1, filter.a1, 1e-4f);
+        EXPECT_NEAR(reference.a2, filter.a2, 1e-4f);
+    }
+    // retuning must not disturb the filter state
+    EXPECT_FLOAT_EQ(1.0f, filter.d1);
+    EXPECT_FLOAT_EQ(2.0f, filter.d2);
+}
+
+TEST(FilterUnittest, TestFilter3MatchesPerAxisFilters)
+{
+    const uint32_t looptime = 125;
+    pt1Filter_t pt1[XYZ_AXIS_COUNT];
+    biquadFilter_t notch[XYZ_AXIS_COUNT];
+    pt1Filter3_t pt13;
+    biquadFilter3_t notch3;
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        pt1FilterInit(&pt1[axis], 90, looptime * 1e-6f);
+        pt1[axis].state = 0;
+        biquadFilterInit(&notch[axis], 300, looptime, filterGetNotchQ(300, 200), FILTER_NOTCH);
+    }
+    pt1Filter3Init(&pt13, 90, looptime * 1e-6f);
+    biquadFilter3Init(&notch3, 300, looptime, filterGetNotchQ(300, 200), FILTER_NOTCH);
+
+    for (int i = 0; i < 1000; i++) {
+        float input[XYZ_AXIS_COUNT];
+        float expected[XYZ_AXIS_COUNT];
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            input[axis] = 100.0f * sinf(i * 0.1f * (axis + 1)) + 10.0f * axis;
+            expected[axis] = biquadFilterApply(&notch[axis], pt1FilterApply(&pt1[axis], input[axis]));
+        }
+        pt1Filter3Apply(&pt13, input);
+        biquadFilter3Apply(&notch3, input);
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            EXPECT_FLOAT_EQ(expected[axis], input[axis]);
+        }
+    }
+}
@@ -0,0 +1,191 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/utils.h"
+
+    #include "drivers/dshot.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define BIT_TICKS 16    // DShot600 with the timer at 12MHz
+
+static const uint8_t nibbleToGcr[16] = {
+    0x19, 0x1b, 0x12, 0x13, 0x1d, 0x15, 0x16, 0x17, 0x1a, 0x09, 0x0a, 0x0b, 0x1e, 0x0d, 0x0e, 0x0f
+};
+
+// telemetry value as sent by the ESC for a 12 bit eRPM period
+static uint16_t telemetryValue(uint16_t data)
+{
+    const uint16_t csum = ~(data ^ (data >> 4) ^ (data >> 8)) & 0xf;
+    return (data << 4) | csum;
+}
+
+static uint32_t valueToGcr(uint16_t value)
+{
+    uint32_t gcr = 1; // start bit
+    for (int shift = 12; shift >= 0; shift -= 4) {
+        gcr = (gcr << 5) | nibbleToGcr[(value >> shift) & 0xf];
+    }
+    return gcr;
+}
+
+// timer captures of the line, every 1 in the frame is an edge, jitter is added to each edge in turn
+static int gcrToEdges(uint32_t gcr, uint32_t *edges, uint32_t start, const int *jitter, int jitterCount, bool idleEdge = true)
+{
+    int count = 0;
+    bool low = false;
+    for (int bit = DSHOT_TELEMETRY_GCR_BITS - 1; bit >= 0; bit--) {
+        if (gcr & (1 << bit)) {
+            const int offset = jitterCount ? jitter[count % jitterCount] : 0;
+            edges[count++] = (start + (DSHOT_TELEMETRY_GCR_BITS - 1 - bit) * BIT_TICKS + offset) & 0xffff;
+            low = !low;
+        }
+    }
+    if (low && idleEdge) {
+        // back to idle
+        edges[count++] = (start + DSHOT_TELEMETRY_GCR_BITS * BIT_TICKS) & 0xffff;
+    }
+    return count;
+}
+
+TEST(DshotTest, PacketChecksum)
+{
+    EXPECT_EQ(0x0000, prepareDshotPacket(0, false, false));
+    EXPECT_EQ(0x82c6, prepareDshotPacket(1046, false, false));
+    EXPECT_EQ(0x82d7, prepareDshotPacket(1046, true, false));
+
+    // bidirectional frames carry the inverted checksum
+    EXPECT_EQ(0x82c9, prepareDshotPacket(1046, false, true));
+    EXPECT_EQ(0x000f, prepareDshotPacket(0, false, true));
+}
+
+TEST(DshotTest, ValueToErpm)
+{
+    // 250us << 2 = 1000us per electrical revolution
+    EXPECT_EQ(600, dshotTelemetryValueToErpm(telemetryValue((2 << 9) | 250)));
+    EXPECT_EQ(1200, dshotTelemetryValueToErpm(telemetryValue(500)));
+    EXPECT_EQ(16, dshotTelemetryValueToErpm(telemetryValue((7 << 9) | 300)));
+
+    // longest period means stopped
+    EXPECT_EQ(0, dshotTelemetryValueToErpm(telemetryValue(0xfff)));
+
+    // zero period cannot be converted
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotTelemetryValueToErpm(telemetryValue(0)));
+
+    // shortest periods saturate
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID - 1, dshotTelemetryValueToErpm(telemetryValue(1)));
+}
+
+TEST(DshotTest, GcrToValue)
+{
+    for (uint32_t data = 0; data <= 0xfff; data++) {
+        const uint16_t value = telemetryValue(data);
+        EXPECT_EQ(value, dshotTelemetryGcrToValue(valueToGcr(value)));
+    }
+
+    // every single bit error is caught by the GCR code or the checksum
+    const uint32_t gcr = valueToGcr(telemetryValue((3 << 9) | 123));
+    for (int bit = 0; bit < 20; bit++) {
+        EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotTelemetryGcrToValue(gcr ^ (1 << bit)));
+    }
+
+    // valid GCR, wrong checksum
+    const uint16_t badCsum = telemetryValue(500) ^ 0x1;
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotTelemetryGcrToValue(valueToGcr(badCsum)));
+
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotTelemetryGcrToValue(0));
+}
+
+TEST(DshotTest, DecodeEdges)
+{
+    uint32_t edges[DSHOT_TELEMETRY_INPUT_LEN];
+
+    for (uint32_t data = 1; data <= 0xfff; data++) {
+        const uint16_t value = telemetryValue(data);
+        const int count = gcrToEdges(valueToGcr(value), edges, 1000, NULL, 0);
+        ASSERT_LE(count, DSHOT_TELEMETRY_INPUT_LEN);
+
+        EXPECT_EQ(valueToGcr(value), dshotTelemetryEdgesToGcr(edges, count, BIT_TICKS));
+        EXPECT_EQ(dshotTelemetryValueToErpm(value), dshotTelemetryDecode(edges, count, BIT_TICKS));
+    }
+}
+
+TEST(DshotTest, DecodeEdgesWithJitterAndWrap)
+{
+    uint32_t edges[DSHOT_TELEMETRY_INPUT_LEN];
+    // edge to edge error stays below half a bit
+    static const int jitter[] = { 0, 3, -3, 2, -2, 1, -1, 3 };
+
+    for (uint32_t data = 1; data <= 0xfff; data += 7) {
+        const uint16_t value = telemetryValue(data);
+        // the capture counter wraps within the frame
+        const int count = gcrToEdges(valueToGcr(value), edges, 0xfff0, jitter, ARRAYLEN(jitter));
+
+        EXPECT_EQ(dshotTelemetryValueToErpm(value), dshotTelemetryDecode(edges, count, BIT_TICKS));
+    }
+}
+
+TEST(DshotTest, DecodeEdgesWithoutIdleEdge)
+{
+    uint32_t edges[DSHOT_TELEMETRY_INPUT_LEN];
+
+    // the return to idle edge is not needed, the last run fills the frame
+    for (uint32_t data = 1; data <= 0xfff; data++) {
+        const uint16_t value = telemetryValue(data);
+        const int count = gcrToEdges(valueToGcr(value), edges, 0, NULL, 0, false);
+
+        EXPECT_EQ(dshotTelemetryValueToErpm(value), dshotTelemetryDecode(edges, count, BIT_TICKS));
+    }
+}
+
+TEST(DshotTest, DecodeBrokenFrames)
+{
+    uint32_t edges[DSHOT_TELEMETRY_INPUT_LEN];
+    const uint16_t value = telemetryValue((2 << 9) | 250);
+    const int count = gcrToEdges(valueToGcr(value), edges, 100, NULL, 0);
+
+    // nothing or only the start edge captured
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotTelemetryDecode(edges, 0, BIT_TICKS));
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotTelemetryDecode(edges, 1, BIT_TICKS));
+
+    // answer cut short by the next frame
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotTelemetryDecode(edges, count / 2, BIT_TICKS));
+
+    // glitch within a bit
+    uint32_t glitched[DSHOT_TELEMETRY_INPUT_LEN];
+    glitched[0] = edges[0];
+    glitched[1] = edges[0] + 2;
+    glitched[2] = edges[0] + 4;
+    for (int i = 1; i < count; i++) {
+        glitched[i + 2] = edges[i];
+    }
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotTelemetryDecode(glitched, count + 2, BIT_TICKS));
+
+    // too slow, frame longer than 21 bits
+    uint32_t stretched[DSHOT_TELEMETRY_INPUT_LEN];
+    for (int i = 0; i < count; i++) {
+        stretched[i] = edges[i] * 2;
+    }
+    EXPECT_EQ(DSHOT_TELEMETRY_INVALID, dshotTelemetryDecode(stretched, count, BIT_TICKS));
+}
@@ -0,0 +1,436 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/debug.h"
+
+    #include "common/filter.h"
+    #include "common/maths.h"
+    #include "common/time.h"
+
+    #include "config/parameter_group.h"
+    #include "config/parameter_group_ids.h"
+
+    #include "fc/config.h"
+    #include "fc/controlrate_profile.h"
+    #include "fc/fc_core.h"
+    #include "fc/fc_rc.h"
+    #include "fc/rc_controls.h"
+    #include "fc/runtime_config.h"
+
+    #include "flight/imu.h"
+    #include "flight/pid.h"
+
+    #include "rx/rx.h"
+
+    #include "scheduler/scheduler.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define PID_LOOPTIME_US     125
+#define SETTLE_US           500000
+
+/*
+ * A receiver sending a frame every intervalUs, each arriving up to jitterUs early or late and picked up by the RX task
+ * up to pickupUs after its ISR timestamped it.
+ */
+typedef struct frameStream_s {
+    uint32_t intervalUs;
+    uint32_t jitterUs;
+    uint32_t pickupUs;
+    int dropEvery;          // every n-th frame is lost, 0 for none
+} frameStream_t;
+
+typedef float (*stickFnPtr)(uint32_t timeUs);
+
+static const frameStream_t jitteryStream = { 4000, 500, 1000, 0 };
+
+static controlRateConfig_t controlRateConfig;
+static pidProfile_t pidProfile;
+
+static uint32_t simTimeUs;
+static timeUs_t frameTimeUs;
+static timeDelta_t rxTaskDeltaUs;
+static uint32_t randomState;
+
+static uint32_t simRandom(uint32_t range)
+{
+    randomState = randomState * 1103515245 + 12345;
+    return (randomState >> 8) % (range + 1);
+}
+
+static void setupRc(uint8_t interpolation, uint8_t filterType, uint8_t cutoffHz)
+{
+    memset(&rxConfig_System, 0, sizeof(rxConfig_System));
+    rxConfig_System.rcInterpolation = interpolation;
+    rxConfig_System.rcInterpolationChannels = 0;
+    rxConfig_System.rcInterpolationInterval = 19;
+    rxConfig_System.rcSmoothingFilterType = filterType;
+    rxConfig_System.rcSmoothingCutoffHz = cutoffHz;
+    rxConfig_System.midrc = 1500;
+    rxConfig_System.mincheck = 1000;
+
+    memset(&controlRateConfig, 0, sizeof(controlRateConfig));
+    controlRateConfig.rcRate8 = 100;
+    controlRateConfig.rcYawRate8 = 100;
+    controlRateConfig.thrMid8 = 50;
+    currentControlRateProfile = &controlRateConfig;
+    generateRcCurves();
+
+    pidProfile.itermAcceleratorGain = 1.0f;
+    currentPidProfile = &pidProfile;
+
+    targetPidLooptime = PID_LOOPTIME_US;
+    randomState = 1;
+}
+
+/*
+ * Runs the PID loop for durationUs, with the frames of the stream carrying the stick position at the time they were
+ * sent. The roll setpoint of every loop is written to setpoints, which must hold durationUs / PID_LOOPTIME_US values.
+ */
+static void runStream(const frameStream_t *stream, stickFnPtr stick, uint32_t durationUs, float *setpoints, uint32_t *firstFrameAfter, uint32_t firstFrameAfterUs)
+{
+    const uint32_t startUs = simTimeUs;
+    uint32_t frame = startUs / stream->intervalUs + 1;
+    uint32_t sentAt = 0;
+    uint32_t nextFrameAt = 0;
+    uint32_t pickupAt = 0;
+    int16_t frameCommand = 0;
+    bool framePending = false;
+    uint32_t lastPickupAt = startUs;
+
+    if (firstFrameAfter) {
+        *firstFrameAfter = 0;
+    }
+
+    for (uint32_t loop = 0; loop < durationUs / PID_LOOPTIME_US; loop++) {
+        if (!framePending) {
+            sentAt = frame * stream->intervalUs;
+            nextFrameAt = sentAt + simRandom(2 * stream->jitterUs) - stream->jitterUs;
+            pickupAt = nextFrameAt + simRandom(stream->pickupUs);
+            framePending = !(stream->dropEvery && frame % stream->dropEvery == 0);
+            frameCommand = lrintf(stick(sentAt - startUs));
+            frame++;
+        }
+        if (framePending && cmpTimeUs(simTimeUs, pickupAt) >= 0) {
+            framePending = false;
+            // updateRcCommands() runs with the RX task
+            rcCommand[ROLL] = frameCommand;
+            frameTimeUs = nextFrameAt;
+            rxTaskDeltaUs = simTimeUs - lastPickupAt;
+            lastPickupAt = simTimeUs;
+            isRXDataNew = true;
+            if (firstFrameAfter && !*firstFrameAfter && sentAt - startUs >= firstFrameAfterUs) {
+                *firstFrameAfter = nextFrameAt - startUs;
+            }
+        }
+
+        processRcCommand();
+        setpoints[loop] = getSetpointRate(ROLL);
+        simTimeUs += PID_LOOPTIME_US;
+    }
+}
+
+static uint32_t stepAtUs;
+
+static float stickStep(uint32_t timeUs)
+{
+    return timeUs < stepAtUs ? 0 : 500; // 200 deg/s
+}
+
+static float stickSine(uint32_t timeUs)
+{
+    return 300 * sinf(2 * M_PI * 3 * timeUs * 1e-6f);
+}
+
+static float stickCentred(uint32_t timeUs)
+{
+    UNUSED(timeUs);
+    return 0;
+}
+
+typedef struct rcResponse_s {
+    float latencyUs;        // from the frame carrying a full stick step arriving to the setpoint reaching half of it
+    float overshoot;        // in deg/s
+    float roughness;        // RMS of the second difference of the setpoint following a smooth stick, deg/s per loop
+} rcResponse_t;
+
+#define STEP_RUN_US     100000
+#define SINE_RUN_US     1000000
+
+static float setpoints[SINE_RUN_US / PID_LOOPTIME_US];
+
+static rcResponse_t measureResponse(const frameStream_t *stream)
+{
+    rcResponse_t response;
+
+    simTimeUs = 0;
+    runStream(stream, stickCentred, SETTLE_US, setpoints, NULL, 0);
+
+    stepAtUs = 20000;
+    uint32_t stepArrivedAt;
+    runStream(stream, stickStep, STEP_RUN_US, setpoints, &stepArrivedAt, stepAtUs);
+    response.latencyUs = 0;
+    response.overshoot = 0;
+    for (int loop = 0; loop < STEP_RUN_US / PID_LOOPTIME_US; loop++) {
+        if (!response.latencyUs && setpoints[loop] >= 100.0f) {
+            response.latencyUs = loop * PID_LOOPTIME_US - (float)stepArrivedAt;
+        }
+        response.overshoot = MAX(response.overshoot, setpoints[loop] - 200.0f);
+    }
+
+    runStream(stream, stickSine, SINE_RUN_US, setpoints, NULL, 0);
+    float sum = 0;
+    int count = 0;
+    // skip the transition from the step
+    for (int loop = 2 + 100000 / PID_LOOPTIME_US; loop < SINE_RUN_US / PID_LOOPTIME_US; loop++) {
+        const float secondDifference = setpoints[loop] - 2 * setpoints[loop - 1] + setpoints[loop - 2];
+        sum += secondDifference * secondDifference;
+        count++;
+    }
+    response.roughness = sqrtf(sum / count);
+
+    return response;
+}
+
+static rcResponse_t jitteryStreamResponse(uint8_t interpolation, uint8_t filterType, uint8_t cutoffHz)
+{
+    setupRc(interpolation, filterType, cutoffHz);
+    return measureResponse(&jitteryStream);
+}
+
+TEST(FcRcUnittest, TestFrameIntervalIgnoresJitterAndLostFrames)
+{
+    setupRc(RC_SMOOTHING_FILTER, FILTER_PT1, 0);
+    simTimeUs = 0;
+
+    const frameStream_t stream = { 4000, 500, 1000, 7 };
+    runStream(&stream, stickCentred, SETTLE_US, setpoints, NULL, 0);
+    EXPECT_NEAR(4000, getRcFrameIntervalUs(), 100);
+
+    // the interval the RX task sees includes its pickup latency
+    const frameStream_t lateStream = { 4000, 0, 3000, 0 };
+    runStream(&lateStream, stickCentred, SETTLE_US, setpoints, NULL, 0);
+    EXPECT_NEAR(4000, getRcFrameIntervalUs(), 50);
+
+    // a link switching to a lower rate is followed after a few frames
+    const frameStream_t slowStream = { 6667, 200, 500, 0 };
+    runStream(&slowStream, stickCentred, 200000, setpoints, NULL, 0);
+    EXPECT_NEAR(6667, getRcFrameIntervalUs(), 100);
+}
+
+TEST(FcRcUnittest, TestSmoothingFilterFollowsSticks)
+{
+    setupRc(RC_SMOOTHING_FILTER, FILTER_BIQUAD, 30);
+    simTimeUs = 0;
+
+    stepAtUs = 0;
+    runStream(&jitteryStream, stickStep, SETTLE_US, setpoints, NULL, 0);
+    EXPECT_NEAR(200.0f, getSetpointRate(ROLL), 0.1f);
+
+    // changing the cutoff in flight keeps the output where it was
+    rxConfig_System.rcSmoothingCutoffHz = 80;
+    runStream(&jitteryStream, stickStep, PID_LOOPTIME_US, setpoints, NULL, 0);
+    EXPECT_NEAR(200.0f, setpoints[0], 0.5f);
+
+    rxConfig_System.rcSmoothingFilterType = FILTER_PT1;
+    runStream(&jitteryStream, stickCentred, SETTLE_US, setpoints, NULL, 0);
+    EXPECT_NEAR(0.0f, getSetpointRate(ROLL), 0.1f);
+}
+
+TEST(FcRcUnittest, TestSmoothingLatencyAndRoughness)
+{
+    const rcResponse_t off = jitteryStreamResponse(RC_SMOOTHING_OFF, FILTER_PT1, 0);
+    const rcResponse_t interpolation = jitteryStreamResponse(RC_SMOOTHING_AUTO, FILTER_PT1, 0);
+    const rcResponse_t pt1 = jitteryStreamResponse(RC_SMOOTHING_FILTER, FILTER_PT1, 0);
+    const rcResponse_t biquad = jitteryStreamResponse(RC_SMOOTHING_FILTER, FILTER_BIQUAD, 0);
+
+    // the filters add no more delay than interpolating over a frame does
+    EXPECT_LT(pt1.latencyUs, interpolation.latencyUs);
+    EXPECT_LT(biquad.latencyUs, interpolation.latencyUs + jitteryStream.intervalUs / 2);
+
+    EXPECT_LT(pt1.roughness, off.roughness / 4);
+    EXPECT_LT(biquad.roughness, interpolation.roughness);
+    EXPECT_LT(biquad.roughness, pt1.roughness);
+
+    EXPECT_LT(pt1.overshoot, 1.0f);
+    EXPECT_LT(biquad.overshoot, 0.1f * 200);
+}
+
+// The rate curve as calculateSetpointRate() worked it out before it was tabulated
+static float referenceBetaflightRate(int axis, int16_t command)
+{
+    const controlRateConfig_t *profile = currentControlRateProfile;
+    float rcRate = (axis == YAW ? profile->rcYawRate8 : profile->rcRate8) / 100.0f;
+    const uint8_t rcExpo = axis == YAW ? profile->rcYawExpo8 : profile->rcExpo8;
+    if (rcRate > 2.0f) {
+        rcRate += 14.54f * (rcRate - 2.0f);
+    }
+    float rcCommandf = command / 500.0f;
+    const float rcCommandfAbs = ABS(rcCommandf);
+    if (rcExpo) {
+        const float expof = rcExpo / 100.0f;
+        rcCommandf = rcCommandf * power3(rcCommandfAbs) * expof + rcCommandf * (1 - expof);
+    }
+    float angleRate = 200.0f * rcRate * rcCommandf;
+    if (profile->rates[axis]) {
+        angleRate /= constrainf(1.0f - rcCommandfAbs * profile->rates[axis] / 100.0f, 0.01f, 1.0f);
+    }
+    return constrainf(angleRate, -1998.0f, 1998.0f);
+}
+
+static float setpointFor(int axis, int16_t command)
+{
+    rcCommand[axis] = command;
+    isRXDataNew = true;
+    processRcCommand();
+    return getSetpointRate(axis);
+}
+
+TEST(FcRcUnittest, TestSetpointRateCurvesMatchTheRateModel)
+{
+    setupRc(RC_SMOOTHING_OFF, FILTER_PT1, 0);
+
+    const struct {
+        uint8_t rcRate8, rcExpo8, rate;
+    } profiles[] = {
+        { 100, 0, 0 },
+        { 100, 0, 70 },
+        { 120, 30, 70 },
+        { 230, 60, 50 },
+        { 180, 100, 100 },
+    };
+
+    for (unsigned p = 0; p < ARRAYLEN(profiles); p++) {
+        controlRateConfig.rcRate8 = controlRateConfig.rcYawRate8 = profiles[p].rcRate8;
+        controlRateConfig.rcExpo8 = controlRateConfig.rcYawExpo8 = profiles[p].rcExpo8;
+        controlRateConfig.rates[FD_ROLL] = controlRateConfig.rates[FD_PITCH] = profiles[p].rate;
+        controlRateConfig.rates[FD_YAW] = 100 - profiles[p].rate;
+        generateRcCurves();
+
+        for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+            for (int command = -500; command <= 500; command++) {
+                const float expected = referenceBetaflightRate(axis, command);
+                const float error = ABS(setpointFor(axis, command) - expected);
+                ASSERT_LE(error, 0.5f + ABS(expected) * 0.002f) << "profile " << p << " axis " << axis << " command " << command;
+            }
+        }
+    }
+}
+
+TEST(FcRcUnittest, TestActualRates)
+{
+    setupRc(RC_SMOOTHING_OFF, FILTER_PT1, 0);
+
+    // 200deg/s around centre, 670deg/s at full stick
+    controlRateConfig.ratesType = RATES_TYPE_ACTUAL;
+    controlRateConfig.rcRate8 = controlRateConfig.rcYawRate8 = 20;
+    controlRateConfig.rcExpo8 = controlRateConfig.rcYawExpo8 = 54;
+    controlRateConfig.rates[FD_ROLL] = controlRateConfig.rates[FD_PITCH] = controlRateConfig.rates[FD_YAW] = 67;
+    generateRcCurves();
+
+    for (int axis = FD_ROLL; axis <= FD_YAW; axis++) {
+        EXPECT_FLOAT_EQ(0.0f, setpointFor(axis, 0));
+        EXPECT_NEAR(670.0f, setpointFor(axis, 500), 0.01f);
+        EXPECT_NEAR(-670.0f, setpointFor(axis, -500), 0.01f);
+        EXPECT_NEAR(2.0f, setpointFor(axis, 5), 0.05f);
+
+        float previous = 0;
+        for (int command = 1; command <= 500; command++) {
+            const float rate = setpointFor(axis, command);
+            EXPECT_GT(rate, previous);
+            previous = rate;
+        }
+    }
+
+    // without expo the rate rises in a straight line up to the centre sensitivity and curves from there
+    controlRateConfig.rcExpo8 = 0;
+    generateRcCurves();
+    EXPECT_NEAR(0.5f * 200 + 0.25f * 470, setpointFor(FD_ROLL, 250), 0.05f);
+
+    controlRateConfig.ratesType = RATES_TYPE_BETAFLIGHT;
+}
+
+TEST(FcRcUnittest, TestThrottleCurve)
+{
+    setupRc(RC_SMOOTHING_OFF, FILTER_PT1, 0);
+
+    for (int throttle = 1000; throttle <= 2000; throttle++) {
+        rcData[THROTTLE] = throttle;
+        updateRcCommands();
+        ASSERT_EQ(throttle, rcCommand[THROTTLE]);
+    }
+
+    // the mid point and the ends stay where they are with expo
+    controlRateConfig.thrMid8 = 40;
+    controlRateConfig.thrExpo8 = 80;
+    generateRcCurves();
+    int16_t previous = 0;
+    for (int throttle = 1000; throttle <= 2000; throttle++) {
+        rcData[THROTTLE] = throttle;
+        updateRcCommands();
+        ASSERT_GE(rcCommand[THROTTLE], previous);
+        previous = rcCommand[THROTTLE];
+        if (throttle == 1000 || throttle == 1400 || throttle == 2000) {
+            EXPECT_EQ(throttle, rcCommand[THROTTLE]);
+        }
+    }
+    // expo flattens the curve around the mid point
+    rcData[THROTTLE] = 1500;
+    updateRcCommands();
+    EXPECT_LT(rcCommand[THROTTLE], 1440);
+}
+
+// STUBS
+
+extern "C" {
+
+int16_t debug[DEBUG16_VALUE_COUNT];
+uint8_t debugMode;
+
+int16_t rcCommand[4];
+int16_t rcData[MAX_SUPPORTED_RC_CHANNEL_COUNT];
+uint32_t rcModeActivationMask;
+uint16_t flightModeFlags;
+attitudeEulerAngles_t attitude;
+int16_t headFreeModeHold;
+bool isRXDataNew;
+uint32_t targetPidLooptime;
+
+controlRateConfig_t *currentControlRateProfile;
+pidProfile_t *currentPidProfile;
+
+rxConfig_t rxConfig_System;
+rcControlsConfig_t rcControlsConfig_System;
+
+bool feature(uint32_t) { return false; }
+bool failsafeIsActive(void) { return false; }
+void pidSetItermAccelerator(float) {}
+
+uint16_t rxGetRefreshRate(void) { return 11000; }
+timeUs_t rxFrameTimeUs(void) { return frameTimeUs; }
+timeDelta_t getTaskDeltaTime(cfTaskId_e) { return rxTaskDeltaUs; }
+
+}
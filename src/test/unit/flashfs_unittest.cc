@@ -0,0 +1,442 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+
+    #include "drivers/block_device_mmap.h"
+    #include "drivers/flash.h"
+    #include "drivers/flash_m25p16.h"
+
+    #include "io/flashfs.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define SECTOR_SIZE     4096
+#define SECTORS         9
+#define FLASH_SIZE      (SECTOR_SIZE * SECTORS)
+// The last two sectors hold the copies of the log index
+#define VOLUME_SIZE     (FLASH_SIZE - 2 * SECTOR_SIZE)
+#define INDEX_ENTRIES   (SECTOR_SIZE / 16 - 1)
+
+static uint8_t *flash;
+
+static uint8_t logData[VOLUME_SIZE];
+
+static void eraseFlash(void)
+{
+    ASSERT_TRUE(blockDeviceMmapOpen(NULL, FLASH_SIZE, SECTOR_SIZE));
+    flash = blockDeviceMmapGetImage();
+    memset(flash, 0xff, FLASH_SIZE);
+}
+
+static uint8_t logByte(int log, int offset)
+{
+    return (uint8_t)(log * 37 + offset * 7 + (offset >> 8));
+}
+
+static void writeLog(int log, int length, uint32_t durationMs)
+{
+    for (int i = 0; i < length; i++) {
+        logData[i] = logByte(log, i);
+    }
+
+    EXPECT_TRUE(flashfsLogBegin());
+    // Write in blackbox sized pieces so both the buffered and the write through paths are used
+    for (int i = 0; i < length; i += 100) {
+        flashfsWrite(logData + i, MIN(100, length - i), true);
+        flashfsUpdate(0);
+    }
+    flashfsLogEnd(durationMs);
+}
+
+static void expectLogContent(int index, int log, int length)
+{
+    static uint8_t buffer[VOLUME_SIZE];
+
+    memset(buffer, 0, sizeof(buffer));
+    EXPECT_EQ(length, flashfsReadLog(index, 0, buffer, sizeof(buffer)));
+    for (int i = 0; i < length; i++) {
+        if (buffer[i] != logByte(log, i)) {
+            ADD_FAILURE() << "log " << log << " differs at offset " << i;
+            return;
+        }
+    }
+}
+
+static void waitForErase(void)
+{
+    for (int i = 0; i < SECTORS && !flashfsIsReady(); i++) {
+        flashfsUpdate(0);
+    }
+    EXPECT_TRUE(flashfsIsReady());
+}
+
+TEST(FlashfsUnittest, TestEmptyFlashUsesIndex)
+{
+    eraseFlash();
+    flashfsInit(&blockDeviceMmapFlashVTable);
+
+    EXPECT_EQ(VOLUME_SIZE, (int)flashfsGetSize());
+    EXPECT_EQ(0, flashfsGetLogCount());
+    EXPECT_EQ(0u, flashfsGetOffset());
+    EXPECT_FALSE(flashfsIsEOF());
+    EXPECT_FALSE(flashfsLogIndexIsFull());
+}
+
+TEST(FlashfsUnittest, TestLogsSurviveRestart)
+{
+    eraseFlash();
+    flashfsInit(&blockDeviceMmapFlashVTable);
+
+    writeLog(1, 1000, 1234);
+    writeLog(2, 500, 50);
+
+    flashfsInit(&blockDeviceMmapFlashVTable);
+
+    ASSERT_EQ(2, flashfsGetLogCount());
+
+    flashfsLog_t log;
+    EXPECT_TRUE(flashfsGetLog(0, &log));
+    EXPECT_EQ(0u, log.start);
+    EXPECT_EQ(1000u, log.length);
+    EXPECT_EQ(1234u, log.durationMs);
+    EXPECT_FALSE(log.open);
+
+    EXPECT_TRUE(flashfsGetLog(1, &log));
+    EXPECT_EQ(1000u, log.start);
+    EXPECT_EQ(500u, log.length);
+    EXPECT_EQ(50u, log.durationMs);
+
+    EXPECT_FALSE(flashfsGetLog(2, &log));
+    EXPECT_EQ(1500u, flashfsGetOffset());
+
+    expectLogContent(0, 1, 1000);
+    expectLogContent(1, 2, 500);
+
+    // Reads from an offset stop at the end of the log
+    uint8_t buffer[64];
+    EXPECT_EQ(20, flashfsReadLog(1, 480, buffer, sizeof(buffer)));
+    EXPECT_EQ(logByte(2, 480), buffer[0]);
+    EXPECT_EQ(0, flashfsReadLog(1, 500, buffer, sizeof(buffer)));
+
+    EXPECT_EQ(0u, blockDeviceMmapGetStats()->programErrors);
+}
+
+TEST(FlashfsUnittest, TestOpenLogIsRecoveredAfterPowerLoss)
+{
+    eraseFlash();
+    flashfsInit(&blockDeviceMmapFlashVTable);
+
+    writeLog(1, 700, 100);
+
+    EXPECT_TRUE(flashfsLogBegin());
+    for (int i = 0; i < 3000; i++) {
+        flashfsWriteByte(logByte(2, i));
+    }
+    flashfsFlushSync();
+
+    flashfsLog_t log;
+    EXPECT_TRUE(flashfsGetLog(1, &log));
+    EXPECT_TRUE(log.open);
+    EXPECT_EQ(3000u, log.length);
+
+    // Power lost without the log being closed
+    flashfsInit(&blockDeviceMmapFlashVTable);
+
+    ASSERT_EQ(2, flashfsGetLogCount());
+    EXPECT_TRUE(flashfsGetLog(1, &log));
+    EXPECT_FALSE(log.open);
+    EXPECT_EQ(700u, log.start);
+    EXPECT_EQ(FLASHFS_LOG_DURATION_UNKNOWN, log.durationMs);
+    // Recovered to the first erased block after the data
+    EXPECT_GE(log.length, 3000u);
+    EXPECT_LT(log.length, 3000u + 2048);
+    EXPECT_EQ(log.start + log.length, flashfsGetOffset());
+
+    // New logs follow on
+    writeLog(3, 200, 10);
+    ASSERT_EQ(3, flashfsGetLogCount());
+    expectLogContent(2, 3, 200);
+
+    EXPECT_EQ(0u, blockDeviceMmapGetStats()->programErrors);
+}
+
+TEST(FlashfsUnittest, TestDeviceWithoutBackgroundProgram)
+{
+    // Pages are then programmed through begin/continue/finish instead of the page buffers
+    flashVTable_t device = blockDeviceMmapFlashVTable;
+    device.pageProgramStart = NULL;
+
+    eraseFlash();
+    flashfsInit(&device);
+
+    writeLog(1, 1000, 1234);
+    writeLog(2, 300, 50);
+
+    flashfsInit(&device);
+
+    ASSERT_EQ(2, flashfsGetLogCount());
+    expectLogContent(0, 1, 1000);
+    expectLogContent(1, 2, 300);
+
+    EXPECT_EQ(0u, blockDeviceMmapGetStats()->programErrors);
+}
+
+TEST(FlashfsUnittest, TestDataWithoutIndexIsKeptAsOneLog)
+{
+    eraseFlash();
+    for (int i = 0; i < 5000; i++) {
+        flash[i] = logByte(1, i);
+    }
+
+    flashfsInit(&blockDeviceMmapFlashVTable);
+
+    ASSERT_EQ(1, flashfsGetLogCount());
+    flashfsLog_t log;
+    EXPECT_TRUE(flashfsGetLog(0, &log));
+    EXPECT_EQ(0u, log.start);
+    EXPECT_GE(log.length, 5000u);
+    EXPECT_EQ(FLASHFS_LOG_DURATION_UNKNOWN, log.durationMs);
+
+    writeLog(2, 300, 20);
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    EXPECT_EQ(2, flashfsGetLogCount());
+    expectLogContent(1, 2, 300);
+}
+
+TEST(FlashfsUnittest, TestDataInIndexSectorDisablesIndex)
+{
+    eraseFlash();
+    memset(flash, 0x55, FLASH_SIZE - 1000);
+
+    flashfsInit(&blockDeviceMmapFlashVTable);
+
+    // Without an index the whole flash is used as before
+    EXPECT_EQ(FLASH_SIZE, (int)flashfsGetSize());
+    EXPECT_EQ(0, flashfsGetLogCount());
+    EXPECT_TRUE(flashfsLogBegin());
+
+    // Erasing the flash makes room for the index
+    flashfsEraseCompletely();
+    EXPECT_EQ(VOLUME_SIZE, (int)flashfsGetSize());
+    writeLog(1, 100, 5);
+    EXPECT_EQ(1, flashfsGetLogCount());
+}
+
+TEST(FlashfsUnittest, TestEraseOldestLogsAndWrapAround)
+{
+    eraseFlash();
+    flashfsInit(&blockDeviceMmapFlashVTable);
+
+    writeLog(1, 10000, 1);
+    writeLog(2, 10000, 2);
+    writeLog(3, 6000, 3);
+    EXPECT_EQ(26000u, flashfsGetOffset());
+
+    EXPECT_FALSE(flashfsEraseOldestLogs(0));
+    EXPECT_FALSE(flashfsEraseOldestLogs(4));
+
+    // The first two sectors only hold the first log
+    EXPECT_TRUE(flashfsEraseOldestLogs(1));
+    EXPECT_FALSE(flashfsIsReady());
+    EXPECT_FALSE(flashfsEraseOldestLogs(1));
+    waitForErase();
+
+    ASSERT_EQ(2, flashfsGetLogCount());
+    EXPECT_EQ(0xff, flash[0]);
+    EXPECT_EQ(0xff, flash[2 * SECTOR_SIZE - 1]);
+    // The sector holding the start of the second log is kept
+    EXPECT_EQ(logByte(1, 2 * SECTOR_SIZE), flash[2 * SECTOR_SIZE]);
+
+    // Wraps around the end of the volume into the erased space
+    writeLog(4, 8000, 4);
+    ASSERT_EQ(3, flashfsGetLogCount());
+
+    flashfsLog_t log;
+    EXPECT_TRUE(flashfsGetLog(2, &log));
+    EXPECT_EQ(26000u, log.start);
+    EXPECT_EQ(8000u, log.length);
+    EXPECT_EQ(26000u + 8000 - VOLUME_SIZE, flashfsGetOffset());
+    expectLogContent(2, 4, 8000);
+
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    ASSERT_EQ(3, flashfsGetLogCount());
+    EXPECT_EQ(26000u + 8000 - VOLUME_SIZE, flashfsGetOffset());
+    expectLogContent(0, 2, 10000);
+    expectLogContent(1, 3, 6000);
+    expectLogContent(2, 4, 8000);
+
+    // Writing stops short of the second log, leaving a page spare
+    writeLog(5, 4000, 5);
+    EXPECT_TRUE(flashfsIsEOF());
+    EXPECT_TRUE(flashfsGetLog(3, &log));
+    EXPECT_LT(log.length, 2 * SECTOR_SIZE - (26000u + 8000 - VOLUME_SIZE));
+    EXPECT_GT(log.length, 2 * SECTOR_SIZE - (26000u + 8000 - VOLUME_SIZE) - 2 * M25P16_PAGESIZE);
+    expectLogContent(0, 2, 10000);
+
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    EXPECT_TRUE(flashfsIsEOF());
+    EXPECT_EQ(4, flashfsGetLogCount());
+
+    // Erasing every log erases the flash
+    EXPECT_TRUE(flashfsEraseOldestLogs(4));
+    EXPECT_EQ(0, flashfsGetLogCount());
+    EXPECT_EQ(0u, flashfsGetOffset());
+    EXPECT_FALSE(flashfsIsEOF());
+
+    EXPECT_EQ(0u, blockDeviceMmapGetStats()->programErrors);
+}
+
+TEST(FlashfsUnittest, TestUsedSizeAfterWrapAround)
+{
+    eraseFlash();
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    EXPECT_EQ(0u, flashfsGetUsedSize());
+
+    writeLog(1, 10000, 1);
+    writeLog(2, 10000, 2);
+    writeLog(3, 6000, 3);
+    EXPECT_EQ(26000u, flashfsGetUsedSize());
+
+    EXPECT_TRUE(flashfsEraseOldestLogs(1));
+    waitForErase();
+    EXPECT_EQ(16000u, flashfsGetUsedSize());
+
+    // Once the ring wraps the offset is only the write head, the used space runs from the start of the oldest log
+    writeLog(4, 8000, 4);
+    EXPECT_LT(flashfsGetOffset(), 10000u);
+    EXPECT_EQ(24000u, flashfsGetUsedSize());
+
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    EXPECT_EQ(24000u, flashfsGetUsedSize());
+
+    // Filling the ring leaves a page spare between the write head and the oldest log
+    writeLog(5, 4000, 5);
+    EXPECT_TRUE(flashfsIsEOF());
+    EXPECT_LE(flashfsGetUsedSize(), (uint32_t)VOLUME_SIZE - 10000 + 2 * SECTOR_SIZE);
+    EXPECT_GT(flashfsGetUsedSize(), (uint32_t)VOLUME_SIZE - 10000 + 2 * SECTOR_SIZE - 2 * M25P16_PAGESIZE);
+
+    EXPECT_TRUE(flashfsEraseOldestLogs(4));
+    EXPECT_EQ(0u, flashfsGetUsedSize());
+}
+
+TEST(FlashfsUnittest, TestIndexIsCompacted)
+{
+    eraseFlash();
+    flashfsInit(&blockDeviceMmapFlashVTable);
+
+    const int capacity = INDEX_ENTRIES;
+    for (int i = 0; i < capacity; i++) {
+        writeLog(i, 10, i);
+    }
+    EXPECT_TRUE(flashfsLogIndexIsFull());
+    EXPECT_EQ(capacity, flashfsGetLogCount());
+
+    // The oldest logs are merged to free up the journal
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    EXPECT_FALSE(flashfsLogIndexIsFull());
+    ASSERT_EQ(16, flashfsGetLogCount());
+
+    flashfsLog_t log;
+    EXPECT_TRUE(flashfsGetLog(0, &log));
+    EXPECT_EQ(0u, log.start);
+    EXPECT_EQ((uint32_t)(capacity - 15) * 10, log.length);
+    EXPECT_TRUE(flashfsGetLog(15, &log));
+    EXPECT_EQ((uint32_t)(capacity - 1) * 10, log.start);
+    EXPECT_EQ((uint32_t)(capacity - 1), log.durationMs);
+    EXPECT_EQ((uint32_t)capacity * 10, flashfsGetOffset());
+}
+
+static void expectCompactedLogs(void)
+{
+    ASSERT_EQ(16, flashfsGetLogCount());
+
+    flashfsLog_t log;
+    EXPECT_TRUE(flashfsGetLog(0, &log));
+    EXPECT_EQ(0u, log.start);
+    EXPECT_EQ((uint32_t)(INDEX_ENTRIES - 15) * 10, log.length);
+    EXPECT_TRUE(flashfsGetLog(15, &log));
+    EXPECT_EQ((uint32_t)(INDEX_ENTRIES - 1) * 10, log.start);
+    EXPECT_EQ((uint32_t)INDEX_ENTRIES * 10, flashfsGetOffset());
+    expectLogContent(15, INDEX_ENTRIES - 1, 10);
+}
+
+TEST(FlashfsUnittest, TestIndexCompactionSurvivesPowerLoss)
+{
+    uint8_t * const firstIndex = flash + VOLUME_SIZE;
+    uint8_t * const secondIndex = flash + VOLUME_SIZE + SECTOR_SIZE;
+
+    eraseFlash();
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    for (int i = 0; i < INDEX_ENTRIES; i++) {
+        writeLog(i, 10, i);
+    }
+
+    // Compacted into the second index sector, the first still holds the whole journal
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    expectCompactedLogs();
+    EXPECT_EQ(0x4c, firstIndex[INDEX_ENTRIES * 16]);
+    EXPECT_EQ(0xff, secondIndex[17 * 16]);
+
+    // Power lost before the header of the new copy was programmed, the old copy is used and compacted again
+    memset(secondIndex, 0xff, 16);
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    expectCompactedLogs();
+
+    // Power lost while the new copy was being erased
+    memset(secondIndex, 0x00, 100);
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    expectCompactedLogs();
+
+    // A header that was only partly programmed isn't used either
+    secondIndex[8] = 0xff;
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    expectCompactedLogs();
+
+    // The newer copy is used from now on, the next compaction goes back to the first sector
+    for (int i = 0; i < INDEX_ENTRIES - 16; i++) {
+        writeLog(i, 10, i);
+    }
+    EXPECT_TRUE(flashfsLogIndexIsFull());
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    EXPECT_EQ(16, flashfsGetLogCount());
+    EXPECT_EQ(0xff, firstIndex[17 * 16]);
+    EXPECT_EQ(0x4c, secondIndex[INDEX_ENTRIES * 16]);
+
+    flashfsInit(&blockDeviceMmapFlashVTable);
+    EXPECT_EQ(16, flashfsGetLogCount());
+    EXPECT_EQ((uint32_t)(2 * INDEX_ENTRIES - 16) * 10, flashfsGetOffset());
+
+    EXPECT_EQ(0u, blockDeviceMmapGetStats()->programErrors);
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void) { return 0; }
+void delayMicroseconds(uint32_t) {}
+
+}
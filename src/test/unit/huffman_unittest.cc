@@ -0,0 +1,171 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern "C" {
+    #include "common/huffman.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define LOG_SIZE (1024 * 1024)
+
+static uint8_t source[LOG_SIZE];
+static uint8_t encoded[LOG_SIZE * 2];
+static uint8_t decoded[LOG_SIZE];
+
+// bytes of blackbox-like data: frame markers followed by zigzag variable byte encoded small deltas
+static int fillBlackboxLike(uint8_t *buf, int len)
+{
+    srand(1);
+    int pos = 0;
+    while (pos < len) {
+        buf[pos++] = (rand() % 32) ? 'P' : 'I';
+        for (int field = 0; field < 20 && pos < len; field++) {
+            const int delta = (rand() % 16) - 8 + ((rand() % 32) ? 0 : (rand() % 4000) - 2000);
+            uint32_t value = (uint32_t)((delta << 1) ^ (delta >> 31));
+            while (value > 127 && pos < len) {
+                buf[pos++] = value | 0x80;
+                value >>= 7;
+            }
+            if (pos < len) {
+                buf[pos++] = value;
+            }
+        }
+    }
+    return len;
+}
+
+static int encodeAll(const uint8_t *in, int inLen, uint8_t *out, int outLen)
+{
+    huffmanState_t state;
+    huffmanEncodeInit(&state, out, outLen);
+    EXPECT_EQ(inLen, huffmanEncode(&state, huffmanTable, in, inLen));
+    return huffmanEncodeFinish(&state);
+}
+
+TEST(HuffmanUnittest, TestTableIsCompleteCanonicalCode)
+{
+    // Kraft sum of exactly one: prefix free and no unused codes
+    uint32_t kraft = 0;
+    for (int i = 0; i < HUFFMAN_TABLE_SIZE; i++) {
+        ASSERT_GE(huffmanTable[i].codeLen, 1);
+        ASSERT_LE(huffmanTable[i].codeLen, HUFFMAN_MAX_CODE_LEN);
+        ASSERT_LT(huffmanTable[i].code, 1 << huffmanTable[i].codeLen);
+        kraft += 1 << (HUFFMAN_MAX_CODE_LEN - huffmanTable[i].codeLen);
+    }
+    EXPECT_EQ(1u << HUFFMAN_MAX_CODE_LEN, kraft);
+
+    // canonical: codes of one length are consecutive in symbol order
+    for (int i = 0; i < HUFFMAN_TABLE_SIZE; i++) {
+        for (int j = i + 1; j < HUFFMAN_TABLE_SIZE; j++) {
+            if (huffmanTable[i].codeLen == huffmanTable[j].codeLen) {
+                EXPECT_LT(huffmanTable[i].code, huffmanTable[j].code);
+            }
+        }
+    }
+
+    // zero is the most common byte in a log
+    for (int i = 1; i < HUFFMAN_TABLE_SIZE; i++) {
+        EXPECT_LE(huffmanTable[0].codeLen, huffmanTable[i].codeLen);
+    }
+}
+
+TEST(HuffmanUnittest, TestRoundTripEveryByte)
+{
+    for (int i = 0; i < 256; i++) {
+        source[i] = 255 - i;
+    }
+    const int encodedLen = encodeAll(source, 256, encoded, sizeof(encoded));
+    EXPECT_EQ(256, huffmanDecode(decoded, 256, encoded, encodedLen, huffmanTable));
+    EXPECT_EQ(0, memcmp(source, decoded, 256));
+}
+
+TEST(HuffmanUnittest, TestRoundTripRandom)
+{
+    srand(2);
+    for (int i = 0; i < 65536; i++) {
+        source[i] = rand();
+    }
+    const int encodedLen = encodeAll(source, 65536, encoded, sizeof(encoded));
+    EXPECT_EQ(65536, huffmanDecode(decoded, 65536, encoded, encodedLen, huffmanTable));
+    EXPECT_EQ(0, memcmp(source, decoded, 65536));
+}
+
+TEST(HuffmanUnittest, TestStreamingMatchesSingleCall)
+{
+    fillBlackboxLike(source, 4096);
+    const int singleLen = encodeAll(source, 4096, encoded, sizeof(encoded));
+
+    static uint8_t streamed[4096 * 2];
+    huffmanState_t state;
+    huffmanEncodeInit(&state, streamed, sizeof(streamed));
+    for (int pos = 0; pos < 4096; pos += 7) {
+        const int len = pos + 7 > 4096 ? 4096 - pos : 7;
+        EXPECT_EQ(len, huffmanEncode(&state, huffmanTable, source + pos, len));
+    }
+    EXPECT_EQ(singleLen, huffmanEncodeFinish(&state));
+    EXPECT_EQ(0, memcmp(encoded, streamed, singleLen));
+}
+
+TEST(HuffmanUnittest, TestStopsWhenOutputIsFull)
+{
+    fillBlackboxLike(source, 4096);
+
+    for (int outLen = 1; outLen < 300; outLen += 13) {
+        memset(encoded, 0xaa, outLen + 16);
+        huffmanState_t state;
+        huffmanEncodeInit(&state, encoded, outLen);
+        const int consumed = huffmanEncode(&state, huffmanTable, source, 4096);
+        EXPECT_LT(consumed, 4096);
+        EXPECT_GT(consumed, 0);
+        // nothing more fits once the encoder has stopped
+        EXPECT_EQ(0, huffmanEncode(&state, huffmanTable, source + consumed, 4096 - consumed));
+
+        const int encodedLen = huffmanEncodeFinish(&state);
+        EXPECT_LE(encodedLen, outLen);
+        EXPECT_EQ(0xaa, encoded[outLen]);
+
+        EXPECT_EQ(consumed, huffmanDecode(decoded, consumed, encoded, encodedLen, huffmanTable));
+        EXPECT_EQ(0, memcmp(source, decoded, consumed));
+    }
+}
+
+TEST(HuffmanUnittest, TestDecodeTruncatedInput)
+{
+    fillBlackboxLike(source, 1024);
+    const int encodedLen = encodeAll(source, 1024, encoded, sizeof(encoded));
+
+    EXPECT_EQ(-1, huffmanDecode(decoded, 1024, encoded, encodedLen / 2, huffmanTable));
+    EXPECT_EQ(-1, huffmanDecode(decoded, 1, encoded, 0, huffmanTable));
+}
+
+TEST(HuffmanUnittest, TestBlackboxCompression)
+{
+    fillBlackboxLike(source, LOG_SIZE);
+
+    const int encodedLen = encodeAll(source, LOG_SIZE, encoded, sizeof(encoded));
+    EXPECT_EQ(LOG_SIZE, huffmanDecode(decoded, LOG_SIZE, encoded, encodedLen, huffmanTable));
+
+    EXPECT_EQ(0, memcmp(source, decoded, LOG_SIZE));
+    // small deltas dominate, so the log must shrink noticeably
+    EXPECT_LT(encodedLen, LOG_SIZE * 85 / 100);
+}
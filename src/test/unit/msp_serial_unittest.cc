@@ -0,0 +1,680 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+    #include "common/streambuf.h"
+
+    #include "drivers/serial.h"
+    #include "drivers/system.h"
+
+    #include "fc/fc_dispatch.h"
+
+    #include "io/serial.h"
+
+    #include "msp/msp.h"
+    #include "msp/msp_protocol.h"
+    #include "msp/msp_serial.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define MSP_TEST_ECHO           0x12        // replies with the request payload reversed
+#define MSP_TEST_ECHO_V2        0x3012      // the same with a command only MSPv2 can carry
+#define MSP_TEST_STREAM         0x3013      // replies with two bytes, then streams the number of bytes requested
+#define MSP_TEST_STREAM_V1      0x13
+#define MSP_TEST_POST_PROCESS   0x3014      // acknowledges, then runs a post process function
+#define MSP_TEST_STATUS         0x3015      // replies with four bytes, can be pushed
+#define MSP_TEST_STATUS_V1      0x15
+
+static serialPort_t serialPort;
+static serialPortConfig_t serialPortConfig;
+
+static uint8_t rxBuf[4096];
+static int rxHead;
+static int rxTail;
+
+static uint8_t txBuf[70000];
+static int txLen;
+static uint32_t txFree;
+static bool txEmpty;
+
+static int commandsProcessed;
+static int postProcessCalls;
+
+static void resetPort(uint32_t txSpace)
+{
+    rxHead = rxTail = 0;
+    txLen = 0;
+    txFree = txSpace;
+    txEmpty = true;
+    commandsProcessed = 0;
+    postProcessCalls = 0;
+}
+
+static void receive(const uint8_t *data, int len)
+{
+    for (int i = 0; i < len; i++) {
+        rxBuf[rxHead++ % sizeof(rxBuf)] = data[i];
+    }
+    EXPECT_LE(rxHead - rxTail, (int)sizeof(rxBuf));
+}
+
+// Send a v1 request, returns its length
+static int sendV1(uint8_t cmd, const uint8_t *payload, uint8_t size)
+{
+    uint8_t frame[6 + 255] = { '$', 'M', '<', size, cmd };
+    uint8_t checksum = size ^ cmd;
+    for (int i = 0; i < size; i++) {
+        frame[5 + i] = payload[i];
+        checksum ^= payload[i];
+    }
+    frame[5 + size] = checksum;
+    receive(frame, 6 + size);
+    return 6 + size;
+}
+
+static void sendV2(uint16_t cmd, const uint8_t *payload, uint16_t size, bool corrupt)
+{
+    uint8_t frame[9 + 256] = { '$', 'X', '<', 0, (uint8_t)(cmd & 0xff), (uint8_t)(cmd >> 8), (uint8_t)(size & 0xff), (uint8_t)(size >> 8) };
+    memcpy(frame + 8, payload, size);
+    uint8_t crc = 0;
+    for (int i = 3; i < 8 + size; i++) {
+        crc = crc8_dvb_s2(crc, frame[i]);
+    }
+    frame[8 + size] = corrupt ? crc ^ 1 : crc;
+    receive(frame, 9 + size);
+}
+
+static int streamTestData(uint32_t context, uint32_t offset, uint8_t *data, int len)
+{
+    for (int i = 0; i < len; i++) {
+        data[i] = (uint8_t)(context + offset + i);
+    }
+    return len;
+}
+
+static void testPostProcess(serialPort_t *port)
+{
+    EXPECT_EQ(&serialPort, port);
+    postProcessCalls++;
+}
+
+static mspResult_e testProcessCommand(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn)
+{
+    UNUSED(mspPostProcessFn);
+
+    commandsProcessed++;
+    reply->cmd = cmd->cmd;
+
+    switch (cmd->cmd) {
+    case MSP_TEST_ECHO:
+    case MSP_TEST_ECHO_V2:
+        for (int i = sbufBytesRemaining(&cmd->buf) - 1; i >= 0; i--) {
+            sbufWriteU8(&reply->buf, cmd->buf.ptr[i]);
+        }
+        return MSP_RESULT_ACK;
+    case MSP_TEST_STREAM:
+    case MSP_TEST_STREAM_V1: {
+        const uint16_t length = sbufReadU16(&cmd->buf);
+        EXPECT_LE(length, reply->streamLimit);
+        sbufWriteU16(&reply->buf, length);
+        reply->streamFn = streamTestData;
+        reply->streamContext = 7;
+        reply->streamLength = length;
+        return MSP_RESULT_ACK;
+    }
+    case MSP_TEST_POST_PROCESS:
+        *mspPostProcessFn = testPostProcess;
+        return MSP_RESULT_ACK;
+    default:
+        return MSP_RESULT_ERROR;
+    }
+}
+
+static bool testPushCommand(uint16_t cmd, sbuf_t *dst)
+{
+    switch (cmd) {
+    case MSP_TEST_STATUS:
+    case MSP_TEST_STATUS_V1:
+        sbufWriteU32(dst, 0x04030201);
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void process(void)
+{
+    mspSerialProcess(MSP_SKIP_NON_MSP_DATA, testProcessCommand);
+}
+
+/*
+ * Check the reply at the start of `frame` and return its payload size, or -1 if it's malformed. The payload is copied to
+ * `payload` and the length of the whole reply is returned in `frameLen`.
+ */
+static int parseReply(const uint8_t *frame, int available, uint16_t *cmd, uint8_t *payload, int *frameLen)
+{
+    if (available < 6 || frame[0] != '$' || frame[2] != '>') {
+        return -1;
+    }
+    if (frame[1] == 'X') {
+        const int size = frame[6] | frame[7] << 8;
+        *frameLen = 9 + size;
+        if (available < *frameLen) {
+            return -1;
+        }
+        uint8_t crc = 0;
+        for (int i = 3; i < 8 + size; i++) {
+            crc = crc8_dvb_s2(crc, frame[i]);
+        }
+        if (crc != frame[8 + size]) {
+            return -1;
+        }
+        *cmd = frame[4] | frame[5] << 8;
+        memcpy(payload, frame + 8, size);
+        return size;
+    }
+
+    int size = frame[3];
+    int headerLen = 5;
+    if (size == 255) {
+        size = frame[5] | frame[6] << 8;
+        headerLen = 7;
+    }
+    *frameLen = headerLen + size + 1;
+    if (available < *frameLen) {
+        return -1;
+    }
+    uint8_t checksum = 0;
+    for (int i = 3; i < headerLen + size; i++) {
+        checksum ^= frame[i];
+    }
+    if (checksum != frame[headerLen + size]) {
+        return -1;
+    }
+    *cmd = frame[4];
+    memcpy(payload, frame + headerLen, size);
+    return size;
+}
+
+static uint8_t payload[70000];
+
+TEST(MspSerialUnittest, TestCrc8DvbS2)
+{
+    // the check value of CRC-8/DVB-S2
+    const char *check = "123456789";
+    uint8_t crc = 0;
+    for (int i = 0; i < 9; i++) {
+        crc = crc8_dvb_s2(crc, check[i]);
+    }
+    EXPECT_EQ(0xBC, crc);
+}
+
+TEST(MspSerialUnittest, TestV1RequestGetsV1Reply)
+{
+    mspSerialInit();
+    resetPort(1024);
+
+    const uint8_t request[] = { 1, 2, 3 };
+    sendV1(MSP_TEST_ECHO, request, sizeof(request));
+    process();
+
+    uint16_t cmd;
+    int frameLen;
+    ASSERT_EQ(3, parseReply(txBuf, txLen, &cmd, payload, &frameLen));
+    EXPECT_EQ(txLen, frameLen);
+    EXPECT_EQ('M', txBuf[1]);
+    EXPECT_EQ(MSP_TEST_ECHO, cmd);
+    EXPECT_EQ(3, payload[0]);
+    EXPECT_EQ(1, payload[2]);
+}
+
+TEST(MspSerialUnittest, TestV2RequestGetsV2Reply)
+{
+    mspSerialInit();
+    resetPort(1024);
+
+    uint8_t request[150];
+    for (int i = 0; i < 150; i++) {
+        request[i] = i;
+    }
+    sendV2(MSP_TEST_ECHO_V2, request, sizeof(request), false);
+    process();
+
+    uint16_t cmd;
+    int frameLen;
+    ASSERT_EQ(150, parseReply(txBuf, txLen, &cmd, payload, &frameLen));
+    EXPECT_EQ(txLen, frameLen);
+    EXPECT_EQ('X', txBuf[1]);
+    EXPECT_EQ(MSP_TEST_ECHO_V2, cmd);
+    EXPECT_EQ(149, payload[0]);
+    EXPECT_EQ(0, payload[149]);
+}
+
+TEST(MspSerialUnittest, TestV2BadRequestsAreIgnored)
+{
+    mspSerialInit();
+    resetPort(1024);
+
+    const uint8_t request[] = { 1, 2, 3 };
+    sendV2(MSP_TEST_ECHO_V2, request, sizeof(request), true);
+    process();
+    EXPECT_EQ(0, commandsProcessed);
+    EXPECT_EQ(0, txLen);
+
+    // larger than the receive buffer
+    const uint8_t oversized[] = { '$', 'X', '<', 0, 0x12, 0x30, (MSP_PORT_INBUF_SIZE + 1) & 0xff, (MSP_PORT_INBUF_SIZE + 1) >> 8 };
+    receive(oversized, sizeof(oversized));
+    process();
+    EXPECT_EQ(0, commandsProcessed);
+
+    // the parser has recovered for the next good request
+    sendV2(MSP_TEST_ECHO_V2, request, sizeof(request), false);
+    process();
+    EXPECT_EQ(1, commandsProcessed);
+    uint16_t cmd;
+    int frameLen;
+    EXPECT_EQ(3, parseReply(txBuf, txLen, &cmd, payload, &frameLen));
+}
+
+static void expectStreamedReply(bool v2, uint16_t length)
+{
+    mspSerialInit();
+    resetPort(100);
+
+    const uint8_t request[] = { (uint8_t)(length & 0xff), (uint8_t)(length >> 8) };
+    if (v2) {
+        sendV2(MSP_TEST_STREAM, request, sizeof(request), false);
+    } else {
+        sendV1(MSP_TEST_STREAM_V1, request, sizeof(request));
+    }
+    // a second request waits until the streamed reply is out
+    sendV2(MSP_TEST_ECHO_V2, request, sizeof(request), false);
+
+    int calls = 0;
+    while (commandsProcessed < 2 && calls < 10000) {
+        process();
+        calls++;
+        // the port sends up to 100 bytes between calls
+        txFree = 100;
+    }
+    EXPECT_EQ(2, commandsProcessed);
+    // the reply went out in pieces that fit the transmit buffer
+    EXPECT_GT(calls, length / 100);
+
+    uint16_t cmd;
+    int frameLen;
+    ASSERT_EQ(2 + length, parseReply(txBuf, txLen, &cmd, payload, &frameLen));
+    EXPECT_EQ(length, payload[0] | payload[1] << 8);
+    for (int i = 0; i < length; i++) {
+        if (payload[2 + i] != (uint8_t)(7 + i)) {
+            ADD_FAILURE() << "streamed reply differs at " << i;
+            break;
+        }
+    }
+
+    // followed by the reply to the second request
+    int echoLen;
+    EXPECT_EQ(2, parseReply(txBuf + frameLen, txLen - frameLen, &cmd, payload, &echoLen));
+    EXPECT_EQ(txLen, frameLen + echoLen);
+    EXPECT_EQ(MSP_TEST_ECHO_V2, cmd);
+}
+
+TEST(MspSerialUnittest, TestV2ReplyIsStreamed)
+{
+    expectStreamedReply(true, 20000);
+}
+
+TEST(MspSerialUnittest, TestV1JumboReplyIsStreamed)
+{
+    expectStreamedReply(false, 5000);
+}
+
+TEST(MspSerialUnittest, TestPipelinedCommandsInOneCall)
+{
+    mspSerialInit();
+    resetPort(1024);
+
+    const uint8_t request[] = { 1, 2, 3, 4 };
+    for (int i = 0; i < 20; i++) {
+        sendV2(MSP_TEST_ECHO_V2, request, sizeof(request), false);
+    }
+    process();
+    EXPECT_EQ(20, commandsProcessed);
+
+    int offset = 0;
+    for (int i = 0; i < 20; i++) {
+        uint16_t cmd;
+        int frameLen;
+        ASSERT_EQ(4, parseReply(txBuf + offset, txLen - offset, &cmd, payload, &frameLen));
+        offset += frameLen;
+    }
+    EXPECT_EQ(txLen, offset);
+}
+
+TEST(MspSerialUnittest, TestCommandsWaitForTransmitSpace)
+{
+    mspSerialInit();
+    resetPort(MSP_PORT_MAX_HEADER_SIZE - 1);
+
+    uint8_t request[150] = { 0 };
+    sendV2(MSP_TEST_ECHO_V2, request, sizeof(request), false);
+    sendV2(MSP_TEST_ECHO_V2, request, 10, false);
+
+    // no room for a reply header, the command is kept
+    process();
+    EXPECT_EQ(0, commandsProcessed);
+    EXPECT_EQ(0, txLen);
+
+    // the reply is larger than the transmit buffer, so it goes out over several calls
+    txFree = 50;
+    process();
+    EXPECT_EQ(1, commandsProcessed);
+    EXPECT_EQ(50, txLen);
+
+    for (int i = 0; i < 10 && commandsProcessed < 2; i++) {
+        txFree = 50;
+        process();
+    }
+    EXPECT_EQ(2, commandsProcessed);
+
+    uint16_t cmd;
+    int frameLen;
+    ASSERT_EQ(150, parseReply(txBuf, txLen, &cmd, payload, &frameLen));
+    ASSERT_EQ(10, parseReply(txBuf + frameLen, txLen - frameLen, &cmd, payload, &frameLen));
+}
+
+TEST(MspSerialUnittest, TestPostProcessIsDispatched)
+{
+    mspSerialInit();
+    resetPort(1024);
+
+    sendV2(MSP_TEST_POST_PROCESS, NULL, 0, false);
+    sendV2(MSP_TEST_ECHO_V2, NULL, 0, false);
+    txEmpty = false;
+
+    // the reply is sent, the post process waits for the port and holds back the next command
+    process();
+    EXPECT_EQ(1, commandsProcessed);
+    EXPECT_EQ(0, postProcessCalls);
+    EXPECT_EQ(9, txLen);
+
+    dispatchProcess(micros());
+    EXPECT_EQ(0, postProcessCalls);
+    process();
+    EXPECT_EQ(1, commandsProcessed);
+
+    // the dispatcher polls the port again a little later
+    txEmpty = true;
+    dispatchProcess(micros() + 10000);
+    EXPECT_EQ(1, postProcessCalls);
+
+    process();
+    EXPECT_EQ(2, commandsProcessed);
+    dispatchProcess(micros() + 10000);
+    EXPECT_EQ(1, postProcessCalls);
+}
+
+static void subscribe(uint16_t rateHz, const uint16_t *cmds, int count, bool v2)
+{
+    uint8_t request[2 + 2 * MSP_PUSH_MAX_COMMANDS + 2] = { (uint8_t)(rateHz & 0xff), (uint8_t)(rateHz >> 8) };
+    for (int i = 0; i < count; i++) {
+        request[2 + 2 * i] = cmds[i] & 0xff;
+        request[3 + 2 * i] = cmds[i] >> 8;
+    }
+    if (v2) {
+        sendV2(MSP_SET_PUSH_SUBSCRIPTION, request, 2 + 2 * count, false);
+    } else {
+        sendV1(MSP_SET_PUSH_SUBSCRIPTION, request, 2 + 2 * count);
+    }
+    process();
+}
+
+// Count the pushed frames in the transmit buffer and check each carries `cmd`
+static int pushedFrames(uint16_t cmd)
+{
+    int frames = 0;
+    int offset = 0;
+    uint16_t replyCmd;
+    int frameLen;
+    while (offset < txLen) {
+        EXPECT_EQ(4, parseReply(txBuf + offset, txLen - offset, &replyCmd, payload, &frameLen));
+        EXPECT_EQ(cmd, replyCmd);
+        EXPECT_EQ(0x01, payload[0]);
+        EXPECT_EQ(0x04, payload[3]);
+        offset += frameLen;
+        frames++;
+    }
+    txLen = 0;
+    return frames;
+}
+
+TEST(MspSerialUnittest, TestPushSubscription)
+{
+    mspSerialInit();
+    resetPort(1024);
+    EXPECT_EQ(0, mspSerialPushPeriod());
+
+    // commands that need a request can't be pushed and are left out
+    const uint16_t cmds[] = { MSP_TEST_STATUS, MSP_TEST_ECHO_V2 };
+    subscribe(50, cmds, 2, true);
+    uint16_t cmd;
+    int frameLen;
+    EXPECT_EQ(0, parseReply(txBuf, txLen, &cmd, payload, &frameLen));
+    EXPECT_EQ(MSP_SET_PUSH_SUBSCRIPTION, cmd);
+    EXPECT_EQ(0, commandsProcessed);
+    EXPECT_EQ(20000, mspSerialPushPeriod());
+    txLen = 0;
+
+    const timeUs_t startUs = micros();
+    mspSerialPushSubscriptions(startUs, testPushCommand);
+    EXPECT_EQ(1, pushedFrames(MSP_TEST_STATUS));
+
+    // nothing more until the period has passed, a task running a little early still pushes
+    mspSerialPushSubscriptions(startUs + 5000, testPushCommand);
+    EXPECT_EQ(0, pushedFrames(MSP_TEST_STATUS));
+    mspSerialPushSubscriptions(startUs + 18000, testPushCommand);
+    EXPECT_EQ(1, pushedFrames(MSP_TEST_STATUS));
+
+    // a late task doesn't catch up on the batches it missed
+    mspSerialPushSubscriptions(startUs + 100000, testPushCommand);
+    EXPECT_EQ(1, pushedFrames(MSP_TEST_STATUS));
+    mspSerialPushSubscriptions(startUs + 105000, testPushCommand);
+    EXPECT_EQ(0, pushedFrames(MSP_TEST_STATUS));
+    mspSerialPushSubscriptions(startUs + 120000, testPushCommand);
+    EXPECT_EQ(1, pushedFrames(MSP_TEST_STATUS));
+
+    subscribe(0, NULL, 0, true);
+    EXPECT_EQ(0, mspSerialPushPeriod());
+    txLen = 0;
+    mspSerialPushSubscriptions(startUs + 200000, testPushCommand);
+    EXPECT_EQ(0, txLen);
+}
+
+TEST(MspSerialUnittest, TestPushIsSkippedWithoutTransmitSpace)
+{
+    mspSerialInit();
+    resetPort(1024);
+
+    const uint16_t cmds[] = { MSP_TEST_STATUS_V1, MSP_TEST_STATUS_V1 };
+    subscribe(100, cmds, 2, false);
+    txLen = 0;
+
+    // a v1 push frame is 10 bytes, only one of the two fits
+    const timeUs_t startUs = micros();
+    txFree = 15;
+    mspSerialPushSubscriptions(startUs, testPushCommand);
+    EXPECT_EQ(1, pushedFrames(MSP_TEST_STATUS_V1));
+
+    txFree = 5;
+    mspSerialPushSubscriptions(startUs + 10000, testPushCommand);
+    EXPECT_EQ(0, txLen);
+
+    // the next batch goes out on time once there is room again
+    txFree = 1024;
+    mspSerialPushSubscriptions(startUs + 20000, testPushCommand);
+    EXPECT_EQ(2, pushedFrames(MSP_TEST_STATUS_V1));
+}
+
+TEST(MspSerialUnittest, TestBadPushSubscriptionsAreRejected)
+{
+    mspSerialInit();
+    resetPort(1024);
+
+    const uint16_t cmds[] = { MSP_TEST_STATUS };
+    subscribe(MSP_PUSH_MAX_RATE_HZ + 1, cmds, 1, true);
+    EXPECT_EQ('!', txBuf[2]);
+    EXPECT_EQ(0, mspSerialPushPeriod());
+    txLen = 0;
+
+    const uint16_t tooMany[MSP_PUSH_MAX_COMMANDS + 1] = { 0 };
+    subscribe(10, tooMany, MSP_PUSH_MAX_COMMANDS + 1, true);
+    EXPECT_EQ('!', txBuf[2]);
+    EXPECT_EQ(0, mspSerialPushPeriod());
+    txLen = 0;
+
+    // a v1 frame can't carry the command
+    subscribe(10, cmds, 1, false);
+    EXPECT_EQ('!', txBuf[2]);
+    EXPECT_EQ(0, mspSerialPushPeriod());
+}
+
+/*
+ * A ground station on a loopback link that keeps `window` requests outstanding and sends a new one for each reply.
+ * With more than one request outstanding, a single run of the serial task must answer several of them.
+ */
+static void checkPipelinedRequests(int window, int commands)
+{
+    mspSerialInit();
+    resetPort(0);
+
+    const uint8_t request[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    int sent = 0;
+    for (; sent < window; sent++) {
+        sendV2(MSP_TEST_ECHO_V2, request, sizeof(request), false);
+    }
+
+    int replies = 0;
+    int ticks = 0;
+    while (replies < commands && ticks < 100000) {
+        // the link drains the transmit buffer between task runs
+        txLen = 0;
+        txFree = 256;
+
+        process();
+        ticks++;
+
+        int offset = 0;
+        uint16_t cmd;
+        int frameLen;
+        while (offset < txLen) {
+            ASSERT_EQ((int)sizeof(request), parseReply(txBuf + offset, txLen - offset, &cmd, payload, &frameLen));
+            offset += frameLen;
+            replies++;
+            if (sent < commands) {
+                sendV2(MSP_TEST_ECHO_V2, request, sizeof(request), false);
+                sent++;
+            }
+        }
+    }
+    EXPECT_EQ(commands, replies);
+    if (window > 1) {
+        // one command per run was the old limit
+        EXPECT_GT(replies, ticks);
+    }
+}
+
+TEST(MspSerialUnittest, TestPipelinedRequestRate)
+{
+    checkPipelinedRequests(1, 200);
+    checkPipelinedRequests(8, 2000);
+    checkPipelinedRequests(32, 5000);
+}
+
+// STUBS
+
+extern "C" {
+
+const uint32_t baudRates[] = {0, 9600, 19200, 38400, 57600, 115200, 230400, 250000, 400000, 460800, 500000, 921600, 1000000, 1500000, 2000000, 2470000};
+
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e)
+{
+    serialPortConfig.identifier = SERIAL_PORT_USART1;
+    return &serialPortConfig;
+}
+
+serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e)
+{
+    return NULL;
+}
+
+serialPort_t *openSerialPort(serialPortIdentifier_e identifier, serialPortFunction_e, serialReceiveCallbackPtr, uint32_t, portMode_t, portOptions_t)
+{
+    serialPort.identifier = identifier;
+    return &serialPort;
+}
+
+void closeSerialPort(serialPort_t *) {}
+void serialEvaluateNonMspData(serialPort_t *, uint8_t) {}
+
+void serialBeginWrite(serialPort_t *) {}
+void serialEndWrite(serialPort_t *) {}
+
+int serialReadBuf(serialPort_t *, uint8_t *data, int count)
+{
+    count = MIN(count, rxHead - rxTail);
+    for (int i = 0; i < count; i++) {
+        data[i] = rxBuf[rxTail++ % sizeof(rxBuf)];
+    }
+    return count;
+}
+
+uint32_t serialTxBytesFree(const serialPort_t *)
+{
+    return txFree;
+}
+
+bool isSerialTransmitBufferEmpty(const serialPort_t *)
+{
+    return txEmpty;
+}
+
+uint32_t micros(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+void serialWriteBuf(serialPort_t *, const uint8_t *data, int count)
+{
+    EXPECT_LE((uint32_t)count, txFree);
+    memcpy(txBuf + txLen, data, count);
+    txLen += count;
+    txFree -= MIN((uint32_t)count, txFree);
+}
+
+}
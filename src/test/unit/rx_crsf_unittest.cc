@@ -18,8 +18,12 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include <stdio.h>
+#include <string.h>
+
 #include <limits.h>
 #include <algorithm>
+#include <vector>
 
 extern "C" {
     #include <platform.h>
@@ -27,6 +31,7 @@ extern "C" {
     #include "build/debug.h"
 
     #include "common/maths.h"
+    #include "common/time.h"
     #include "common/utils.h"
 
     #include "io/serial.h"
@@ -35,6 +40,7 @@ extern "C" {
     #include "rx/crsf.h"
 
     void crsfDataReceive(uint16_t c);
+    void crsfFrameReceive(const uint8_t *data, int length);
     uint8_t crsfFrameCRC(void);
     uint8_t crsfFrameStatus(void);
     uint16_t crsfReadRawRC(const rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan);
@@ -42,8 +48,10 @@ extern "C" {
     extern bool crsfFrameDone;
     extern crsfFrame_t crsfFrame;
     extern uint32_t crsfChannelData[CRSF_MAX_CHANNEL];
+    extern crsfLinkStatistics_t crsfLinkStatistics;
 
     uint32_t dummyTimeUs;
+    uint16_t linkRssi;
 }
 
 #include "unittest_macros.h"
@@ -269,15 +277,287 @@ TEST(CrossFireTest, TestCrsfDataReceive)
     EXPECT_EQ(crc, crsfFrame.frame.payload[CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE]);
 }
 
+TEST(CrossFireTest, TestCrsfFrameReceive)
+{
+    // whole frames handed over by the idle line interrupt, one transmitter period apart
+    const crsfRcChannelsFrame_t *framePtr = (const crsfRcChannelsFrame_t*)capturedData;
+    for (int frame = 0; frame < 2; frame++, framePtr++) {
+        dummyTimeUs += 4000;
+        crsfFrameDone = false;
+        crsfFrameReceive((const uint8_t *)framePtr, sizeof(crsfRcChannelsFrame_t));
+        EXPECT_EQ(true, crsfFrameDone);
+        EXPECT_EQ(RX_FRAME_COMPLETE, crsfFrameStatus());
+        EXPECT_EQ(CRSF_FRAMETYPE_RC_CHANNELS_PACKED, crsfFrame.frame.type);
+        EXPECT_EQ(189, crsfChannelData[0]);
+        EXPECT_EQ(frame == 0 ? 983u : 981u, crsfChannelData[3]);
+    }
+}
+
+#define TIME_PER_BYTE_US 22 // 420000 baud, as used by the receiver
+
+typedef struct telemetryWrite_s {
+    uint32_t startUs;
+    int length;
+} telemetryWrite_t;
+
+static std::vector<telemetryWrite_t> telemetryWrites;
+
+static int makeFrame(uint8_t *frame, uint8_t type, const uint8_t *payload, int payloadSize)
+{
+    frame[0] = CRSF_ADDRESS_COLIBRI_RACE_FC;
+    frame[1] = payloadSize + CRSF_FRAME_LENGTH_TYPE_CRC;
+    frame[2] = type;
+    memcpy(&frame[3], payload, payloadSize);
+    frame[3 + payloadSize] = crc8_dvb_s2_buf(&frame[2], payloadSize + CRSF_FRAME_LENGTH_TYPE);
+    return payloadSize + 4;
+}
+
+static int makeRcFrame(uint8_t *frame, uint16_t chan0)
+{
+    // only channel 0 is set, the others are zero
+    uint8_t payload[CRSF_FRAME_RC_CHANNELS_PAYLOAD_SIZE] = { (uint8_t)chan0, (uint8_t)(chan0 >> 8) };
+    return makeFrame(frame, CRSF_FRAMETYPE_RC_CHANNELS_PACKED, payload, sizeof(payload));
+}
+
+static int makeLinkStatisticsFrame(uint8_t *frame, uint8_t uplinkLQ)
+{
+    const crsfLinkStatistics_t stats = { 60, 65, uplinkLQ, 9, 1, 2, 3, 70, 100, -5 };
+    return makeFrame(frame, CRSF_FRAMETYPE_LINK_STATISTICS, (const uint8_t *)&stats, sizeof(stats));
+}
+
+static void initHalfDuplex(void)
+{
+    rxConfig_t rxConfig;
+    memset(&rxConfig, 0, sizeof(rxConfig));
+    rxConfig.midrc = 1500;
+    rxConfig.halfDuplex = 1;
+    rxRuntimeConfig_t rxRuntimeConfig;
+    EXPECT_TRUE(crsfRxInit(&rxConfig, &rxRuntimeConfig));
+    telemetryWrites.clear();
+}
+
+TEST(CrossFireTest, TestCrsfFrameReceiveSplit)
+{
+    // a frame handed over in two chunks, the line having paused for a few characters in between
+    uint8_t frame[CRSF_FRAME_SIZE_MAX];
+    const int length = makeRcFrame(frame, 1234);
+    const int firstLength = 10;
+
+    dummyTimeUs += 10000;
+    crsfFrameDone = false;
+    crsfFrameReceive(frame, firstLength);
+    EXPECT_EQ(false, crsfFrameDone);
+    dummyTimeUs += 3 * TIME_PER_BYTE_US + (length - firstLength) * TIME_PER_BYTE_US;
+    crsfFrameReceive(frame + firstLength, length - firstLength);
+    EXPECT_EQ(true, crsfFrameDone);
+    EXPECT_EQ(RX_FRAME_COMPLETE, crsfFrameStatus());
+    EXPECT_EQ(1234u, crsfChannelData[0]);
+}
+
+TEST(CrossFireTest, TestLinkStatistics)
+{
+    initHalfDuplex();
+    uint8_t frame[CRSF_FRAME_SIZE_MAX];
+
+    dummyTimeUs += 10000;
+    crsfFrameReceive(frame, makeLinkStatisticsFrame(frame, 80));
+    EXPECT_EQ(RX_FRAME_PENDING, crsfFrameStatus());
+    EXPECT_EQ(60, crsfLinkStatistics.uplinkRSSIAnt1);
+    EXPECT_EQ(65, crsfLinkStatistics.uplinkRSSIAnt2);
+    EXPECT_EQ(80, crsfLinkStatistics.uplinkLQ);
+    EXPECT_EQ(9, crsfLinkStatistics.uplinkSNR);
+    EXPECT_EQ(2, crsfLinkStatistics.rfMode);
+    EXPECT_EQ(-5, crsfLinkStatistics.downlinkSNR);
+    EXPECT_EQ(818, linkRssi); // 80% of 1023
+
+    dummyTimeUs += 4000;
+    crsfFrameReceive(frame, makeRcFrame(frame, 992));
+    EXPECT_EQ(RX_FRAME_COMPLETE, crsfFrameStatus());
+    EXPECT_EQ(992u, crsfChannelData[0]);
+
+    // a corrupted frame is ignored
+    makeLinkStatisticsFrame(frame, 50);
+    frame[5] ^= 0x01;
+    dummyTimeUs += 4000;
+    crsfFrameReceive(frame, CRSF_FRAME_LINK_STATISTICS_PAYLOAD_SIZE + 4);
+    EXPECT_EQ(RX_FRAME_PENDING, crsfFrameStatus());
+    EXPECT_EQ(80, crsfLinkStatistics.uplinkLQ);
+    EXPECT_EQ(818, linkRssi);
+
+    // the uplink is lost, the receiver carries on with its failsafe channel values
+    dummyTimeUs += 4000;
+    crsfFrameReceive(frame, makeLinkStatisticsFrame(frame, 0));
+    EXPECT_EQ(RX_FRAME_PENDING, crsfFrameStatus());
+    EXPECT_EQ(0, linkRssi);
+    dummyTimeUs += 4000;
+    crsfFrameReceive(frame, makeRcFrame(frame, 172));
+    EXPECT_EQ(RX_FRAME_COMPLETE | RX_FRAME_FAILSAFE, crsfFrameStatus());
+
+    // and the statistics it sent last go stale
+    dummyTimeUs += 1000000;
+    crsfFrameReceive(frame, makeRcFrame(frame, 172));
+    EXPECT_EQ(RX_FRAME_COMPLETE, crsfFrameStatus());
+}
+
+TEST(CrossFireTest, TestFrameLength)
+{
+    uint8_t frame[CRSF_FRAME_SIZE_MAX];
+
+    // a frame of the largest size takes longer than a millisecond to arrive
+    uint8_t payload[CRSF_PAYLOAD_SIZE_MAX];
+    for (unsigned int ii = 0; ii < sizeof(payload); ii++) {
+        payload[ii] = ii;
+    }
+    const int length = makeFrame(frame, CRSF_FRAMETYPE_GPS, payload, sizeof(payload));
+    EXPECT_EQ(CRSF_FRAME_SIZE_MAX, length);
+    dummyTimeUs += 10000;
+    crsfFrameDone = false;
+    for (int ii = 0; ii < length; ii++) {
+        dummyTimeUs += TIME_PER_BYTE_US;
+        crsfDataReceive(frame[ii]);
+    }
+    EXPECT_EQ(true, crsfFrameDone);
+    EXPECT_EQ(0, memcmp(frame, crsfFrame.bytes, length));
+    EXPECT_EQ(RX_FRAME_PENDING, crsfFrameStatus());
+
+    // a length that does not fit is dropped, and so is the rest of that frame
+    const uint8_t tooLong[] = { CRSF_ADDRESS_COLIBRI_RACE_FC, 0xFE, CRSF_FRAMETYPE_RC_CHANNELS_PACKED, 0x00, 0x18, 0x16, 0x00 };
+    dummyTimeUs += 10000;
+    for (unsigned int ii = 0; ii < sizeof(tooLong); ii++) {
+        dummyTimeUs += TIME_PER_BYTE_US;
+        crsfDataReceive(tooLong[ii]);
+    }
+    EXPECT_EQ(false, crsfFrameDone);
+
+    // as is a frame too short to have a type and CRC
+    const uint8_t tooShort[] = { CRSF_ADDRESS_COLIBRI_RACE_FC, 0x01, 0x16, 0x00, 0x00 };
+    dummyTimeUs += 10000;
+    for (unsigned int ii = 0; ii < sizeof(tooShort); ii++) {
+        dummyTimeUs += TIME_PER_BYTE_US;
+        crsfDataReceive(tooShort[ii]);
+    }
+    EXPECT_EQ(false, crsfFrameDone);
+
+    // the line going quiet resynchronises on the next frame
+    const int rcLength = makeRcFrame(frame, 1811);
+    dummyTimeUs += 1000;
+    for (int ii = 0; ii < rcLength; ii++) {
+        dummyTimeUs += TIME_PER_BYTE_US;
+        crsfDataReceive(frame[ii]);
+    }
+    EXPECT_EQ(RX_FRAME_COMPLETE, crsfFrameStatus());
+    EXPECT_EQ(1811u, crsfChannelData[0]);
+}
+
+/*
+ * Simulates the receiver sending RC frames byte by byte at the given rate while the scheduler polls the RX every
+ * 125us and the telemetry buffer is always kept full, so every response window is offered a frame.
+ */
+static void checkFrameRate(int frameRateHz, int telemetryFrameSize)
+{
+    const uint32_t loopTimeUs = 125;
+    const uint32_t durationUs = 2000000;
+    const uint32_t framePeriodUs = 1000000 / frameRateHz;
+
+    initHalfDuplex();
+
+    uint8_t telemetryFrame[CRSF_FRAME_SIZE_MAX];
+    memset(telemetryFrame, 0, sizeof(telemetryFrame));
+
+    std::vector<uint32_t> frameStartUs;
+    uint8_t frame[CRSF_FRAME_SIZE_MAX];
+    int frameLength = 0;
+    int bytePos = 0;
+    int framesSent = 0;
+    int framesDecoded = 0;
+    int channelErrors = 0;
+    uint32_t frameDoneUs = 0;
+    uint32_t maxLatencyUs = 0;
+
+    const uint32_t startUs = dummyTimeUs + 100000; // start with the line quiet
+    for (uint32_t t = 0; t < durationUs; t++) {
+        dummyTimeUs = startUs + t;
+        if (t % framePeriodUs == 0) {
+            frameLength = makeRcFrame(frame, 172 + framesSent % 1640);
+            frameStartUs.push_back(dummyTimeUs);
+            bytePos = 0;
+        }
+        if (bytePos < frameLength && t % framePeriodUs == (uint32_t)(bytePos + 1) * TIME_PER_BYTE_US) {
+            crsfDataReceive(frame[bytePos++]);
+            if (bytePos == frameLength) {
+                framesSent++;
+                frameDoneUs = dummyTimeUs;
+            }
+        }
+        if (t % loopTimeUs == 0) {
+            if (crsfRxIsTelemetryBufEmpty()) {
+                crsfRxWriteTelemetryData(telemetryFrame, telemetryFrameSize);
+            }
+            if (crsfFrameStatus() & RX_FRAME_COMPLETE) {
+                const uint32_t latencyUs = dummyTimeUs - frameDoneUs;
+                maxLatencyUs = MAX(maxLatencyUs, latencyUs);
+                if (crsfChannelData[0] != (uint32_t)(172 + (framesSent - 1) % 1640)) {
+                    channelErrors++;
+                }
+                framesDecoded++;
+            }
+        }
+    }
+
+    // no frame is lost or decoded late
+    EXPECT_EQ(framesSent, framesDecoded);
+    EXPECT_EQ(0, channelErrors);
+    EXPECT_LT(maxLatencyUs, loopTimeUs);
+
+    // every telemetry frame fits between the end of an RC frame and the start of the next one, one per RC frame
+    const uint32_t rcFrameTimeUs = frameLength * TIME_PER_BYTE_US;
+    unsigned int frameIndex = 0;
+    uint32_t lastWindowStartUs = 0;
+    for (const telemetryWrite_t &write : telemetryWrites) {
+        while (frameIndex + 1 < frameStartUs.size() && frameStartUs[frameIndex + 1] <= write.startUs) {
+            frameIndex++;
+        }
+        const uint32_t windowStartUs = frameStartUs[frameIndex] + rcFrameTimeUs;
+        const uint32_t windowEndUs = frameStartUs[frameIndex] + framePeriodUs;
+        EXPECT_GE(write.startUs, windowStartUs);
+        EXPECT_LE(write.startUs + write.length * TIME_PER_BYTE_US, windowEndUs);
+        EXPECT_NE(lastWindowStartUs, windowStartUs);
+        lastWindowStartUs = windowStartUs;
+    }
+    // only the first frame, before the period was measured, goes without telemetry
+    const int telemetryFrames = telemetryWrites.size();
+    EXPECT_EQ(framesSent - 1, telemetryFrames);
+}
+
+TEST(CrossFireTest, TestThroughput150Hz)
+{
+    checkFrameRate(150, 19);
+}
+
+TEST(CrossFireTest, TestThroughput250Hz)
+{
+    checkFrameRate(250, 19);
+}
+
+TEST(CrossFireTest, TestThroughput500Hz)
+{
+    // the response window is 1428us less the turnaround times
+    checkFrameRate(500, 40);
+}
+
 // STUBS
 
 extern "C" {
 
 int16_t debug[DEBUG16_VALUE_COUNT];
 uint32_t micros(void) {return dummyTimeUs;}
-serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, uint32_t, portMode_t, portOptions_t) {return NULL;}
-serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return NULL;}
-void serialWriteBuf(serialPort_t *, const uint8_t *, int) {}
+static serialPort_t dummySerialPort;
+static serialPortConfig_t dummyPortConfig;
+serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, uint32_t, portMode_t, portOptions_t) {return &dummySerialPort;}
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e ) {return &dummyPortConfig;}
+void serialWriteBuf(serialPort_t *, const uint8_t *, int count) {telemetryWrites.push_back({dummyTimeUs, count});}
+void rxSetLinkRssi(uint16_t value) {linkRssi = value;}
+bool serialSetRxFrameCallback(serialPort_t *, serialReceiveFrameCallbackPtr) {return false;}
 bool telemetryCheckRxPortShared(const serialPortConfig_t *) {return false;}
 serialPort_t *telemetrySharedPort = NULL;
 }
@@ -0,0 +1,186 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "rx/packed_channels.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+/*
+ * The bitfield structs the SBUS and CRSF drivers unpacked their channels with, kept as the reference decoders.
+ */
+struct crsfPayloadRcChannelsPacked_s {
+    unsigned int chan0 : 11;
+    unsigned int chan1 : 11;
+    unsigned int chan2 : 11;
+    unsigned int chan3 : 11;
+    unsigned int chan4 : 11;
+    unsigned int chan5 : 11;
+    unsigned int chan6 : 11;
+    unsigned int chan7 : 11;
+    unsigned int chan8 : 11;
+    unsigned int chan9 : 11;
+    unsigned int chan10 : 11;
+    unsigned int chan11 : 11;
+    unsigned int chan12 : 11;
+    unsigned int chan13 : 11;
+    unsigned int chan14 : 11;
+    unsigned int chan15 : 11;
+} __attribute__ ((__packed__));
+
+struct sbusFrame_s {
+    uint8_t syncByte;
+    unsigned int chan0 : 11;
+    unsigned int chan1 : 11;
+    unsigned int chan2 : 11;
+    unsigned int chan3 : 11;
+    unsigned int chan4 : 11;
+    unsigned int chan5 : 11;
+    unsigned int chan6 : 11;
+    unsigned int chan7 : 11;
+    unsigned int chan8 : 11;
+    unsigned int chan9 : 11;
+    unsigned int chan10 : 11;
+    unsigned int chan11 : 11;
+    unsigned int chan12 : 11;
+    unsigned int chan13 : 11;
+    unsigned int chan14 : 11;
+    unsigned int chan15 : 11;
+    uint8_t flags;
+    uint8_t endByte;
+} __attribute__ ((__packed__));
+
+static void crsfBitfieldUnpack(uint32_t *channels, const uint8_t *packed)
+{
+    const struct crsfPayloadRcChannelsPacked_s *rcChannels = (const struct crsfPayloadRcChannelsPacked_s *)packed;
+    channels[0] = rcChannels->chan0;
+    channels[1] = rcChannels->chan1;
+    channels[2] = rcChannels->chan2;
+    channels[3] = rcChannels->chan3;
+    channels[4] = rcChannels->chan4;
+    channels[5] = rcChannels->chan5;
+    channels[6] = rcChannels->chan6;
+    channels[7] = rcChannels->chan7;
+    channels[8] = rcChannels->chan8;
+    channels[9] = rcChannels->chan9;
+    channels[10] = rcChannels->chan10;
+    channels[11] = rcChannels->chan11;
+    channels[12] = rcChannels->chan12;
+    channels[13] = rcChannels->chan13;
+    channels[14] = rcChannels->chan14;
+    channels[15] = rcChannels->chan15;
+}
+
+static void sbusBitfieldUnpack(uint32_t *channels, const uint8_t *frameBytes)
+{
+    const struct sbusFrame_s *frame = (const struct sbusFrame_s *)frameBytes;
+    channels[0] = frame->chan0;
+    channels[1] = frame->chan1;
+    channels[2] = frame->chan2;
+    channels[3] = frame->chan3;
+    channels[4] = frame->chan4;
+    channels[5] = frame->chan5;
+    channels[6] = frame->chan6;
+    channels[7] = frame->chan7;
+    channels[8] = frame->chan8;
+    channels[9] = frame->chan9;
+    channels[10] = frame->chan10;
+    channels[11] = frame->chan11;
+    channels[12] = frame->chan12;
+    channels[13] = frame->chan13;
+    channels[14] = frame->chan14;
+    channels[15] = frame->chan15;
+}
+
+#define TEST_FRAME_COUNT 256
+
+static uint8_t testFrames[TEST_FRAME_COUNT][1 + PACKED_CHANNELS_SIZE + 2]; // laid out as SBUS frames
+
+static void makeTestFrames(void)
+{
+    uint32_t seed = 12345;
+    for (int ii = 0; ii < TEST_FRAME_COUNT; ii++) {
+        testFrames[ii][0] = 0x0F;
+        for (int jj = 1; jj < (int)sizeof(testFrames[ii]); jj++) {
+            seed = seed * 1103515245 + 12345;
+            testFrames[ii][jj] = seed >> 16;
+        }
+    }
+    // and the edge cases, all bits clear and all set
+    memset(&testFrames[0][1], 0x00, PACKED_CHANNELS_SIZE);
+    memset(&testFrames[1][1], 0xFF, PACKED_CHANNELS_SIZE);
+}
+
+TEST(PackedChannelsUnittest, TestUnpackMatchesBitfields)
+{
+    makeTestFrames();
+    for (int ii = 0; ii < TEST_FRAME_COUNT; ii++) {
+        uint32_t expected[PACKED_CHANNELS_COUNT];
+        uint32_t expectedSbus[PACKED_CHANNELS_COUNT];
+        uint32_t channels[PACKED_CHANNELS_COUNT + 1];
+        channels[PACKED_CHANNELS_COUNT] = 0xDEADBEEF;
+
+        crsfBitfieldUnpack(expected, &testFrames[ii][1]);
+        sbusBitfieldUnpack(expectedSbus, testFrames[ii]);
+        packedChannelsUnpack(channels, &testFrames[ii][1]);
+
+        for (int jj = 0; jj < PACKED_CHANNELS_COUNT; jj++) {
+            EXPECT_EQ(expected[jj], channels[jj]) << "frame " << ii << " channel " << jj;
+            EXPECT_EQ(expectedSbus[jj], channels[jj]) << "frame " << ii << " channel " << jj;
+        }
+        EXPECT_EQ(0xDEADBEEF, channels[PACKED_CHANNELS_COUNT]);
+    }
+}
+
+TEST(PackedChannelsUnittest, TestSingleChannels)
+{
+    // each channel on its own, with all bits set, lands in its own slot only
+    for (int chan = 0; chan < PACKED_CHANNELS_COUNT; chan++) {
+        uint8_t packed[PACKED_CHANNELS_SIZE] = { 0 };
+        for (int bit = chan * 11; bit < (chan + 1) * 11; bit++) {
+            packed[bit / 8] |= 1 << (bit % 8);
+        }
+        uint32_t channels[PACKED_CHANNELS_COUNT];
+        packedChannelsUnpack(channels, packed);
+        for (int jj = 0; jj < PACKED_CHANNELS_COUNT; jj++) {
+            EXPECT_EQ(jj == chan ? 0x7FFu : 0u, channels[jj]) << "channel " << chan;
+        }
+    }
+}
+
+TEST(PackedChannelsUnittest, TestPwmConversion)
+{
+    // the same values as the conversions the drivers had, over the whole 11 bit range
+    for (uint32_t value = 0; value < 2048; value++) {
+        EXPECT_EQ((uint16_t)((5 * value / 8) + 880), packedChannelToPwm(PACKED_CHANNELS_SBUS, value)) << value;
+        EXPECT_EQ((uint16_t)((0.62477120195241f * value) + 881), packedChannelToPwm(PACKED_CHANNELS_CRSF, value)) << value;
+    }
+    EXPECT_EQ(988, packedChannelToPwm(PACKED_CHANNELS_SBUS, 173));
+    EXPECT_EQ(1500, packedChannelToPwm(PACKED_CHANNELS_SBUS, 993));
+    EXPECT_EQ(2012, packedChannelToPwm(PACKED_CHANNELS_SBUS, 1812));
+    EXPECT_EQ(988, packedChannelToPwm(PACKED_CHANNELS_CRSF, 172));
+    EXPECT_EQ(1500, packedChannelToPwm(PACKED_CHANNELS_CRSF, 992));
+    EXPECT_EQ(2012, packedChannelToPwm(PACKED_CHANNELS_CRSF, 1811));
+}
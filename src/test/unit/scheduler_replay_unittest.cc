@@ -0,0 +1,608 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Scheduler replay harness.
+ *
+ * Runs the real scheduler() against cfTasks[] driven by a virtual micros() clock. Each task
+ * advances the clock by an execution time drawn from a per-task distribution, so a given
+ * task set, distribution and seed always produce the same schedule. The harness reports
+ * GYROPID period jitter, worst case latency and starvation count of each task and the
+ * averageSystemLoadPercent computed by taskSystem().
+ *
+ * Distributions default to representative F4 figures and can be replaced with recorded
+ * ones by pointing SCHEDULER_REPLAY_PROFILE at a file of "<task name> <us> <count>" lines,
+ * blank lines and lines starting with '#' are ignored.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "build/profile.h"
+
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "scheduler/scheduler.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define REPLAY_MAX_BUCKETS      16
+#define REPLAY_SCHEDULER_COST   1       // us per scheduler() call, also the idle loop step
+
+typedef struct replayBucket_s {
+    timeUs_t executionTimeUs;
+    uint32_t weight;
+} replayBucket_t;
+
+typedef struct replayDistribution_s {
+    replayBucket_t bucket[REPLAY_MAX_BUCKETS];
+    int bucketCount;
+    uint32_t totalWeight;
+} replayDistribution_t;
+
+typedef struct replayTaskStats_s {
+    uint32_t runs;
+    timeUs_t lastRunAt;
+    timeDelta_t minPeriod;
+    timeDelta_t maxPeriod;
+    double sumPeriod;
+    double sumSqPeriod;
+    timeDelta_t maxLatency;             // start of execution after it was due
+    uint32_t starved;                   // executions that missed at least one whole period
+} replayTaskStats_t;
+
+typedef struct replayTask_s {
+    timeDelta_t eventPeriodUs;          // event driven tasks only, interval between events
+    timeUs_t checkCostUs;               // event driven tasks only, cost of the check function
+    replayDistribution_t execution;
+
+    timeUs_t nextEventAt;
+    timeUs_t pendingEventAt;
+    bool eventPending;
+
+    replayTaskStats_t stats;
+} replayTask_t;
+
+typedef struct replayReport_s {
+    uint32_t schedulerCalls;
+    uint32_t loadSamples;
+    uint32_t loadSum;
+    uint16_t maxLoad;
+} replayReport_t;
+
+static timeUs_t simulatedTimeUs;
+static uint32_t replaySeed;
+static replayTask_t replayTasks[TASK_COUNT];
+static replayReport_t replayReport;
+
+extern "C" {
+    cfTask_t cfTasks[TASK_COUNT] = {};
+
+    uint32_t micros(void) { return simulatedTimeUs; }
+    profileTicks_t profileTicks(void) { return simulatedTimeUs * PROFILE_TICKS_PER_US; }
+}
+
+// xorshift32, deterministic across hosts
+static uint32_t replayRandom(void)
+{
+    replaySeed ^= replaySeed << 13;
+    replaySeed ^= replaySeed >> 17;
+    replaySeed ^= replaySeed << 5;
+    return replaySeed;
+}
+
+static timeUs_t replaySample(const replayDistribution_t *d)
+{
+    if (d->totalWeight == 0) {
+        return 0;
+    }
+    uint32_t r = replayRandom() % d->totalWeight;
+    for (int i = 0; i < d->bucketCount; i++) {
+        if (r < d->bucket[i].weight) {
+            return d->bucket[i].executionTimeUs;
+        }
+        r -= d->bucket[i].weight;
+    }
+    return d->bucket[d->bucketCount - 1].executionTimeUs;
+}
+
+static void replayAddBucket(replayDistribution_t *d, timeUs_t executionTimeUs, uint32_t weight)
+{
+    for (int i = 0; i < d->bucketCount; i++) {
+        if (d->bucket[i].executionTimeUs == executionTimeUs) {
+            d->bucket[i].weight += weight;
+            d->totalWeight += weight;
+            return;
+        }
+    }
+    if (d->bucketCount < REPLAY_MAX_BUCKETS) {
+        d->bucket[d->bucketCount].executionTimeUs = executionTimeUs;
+        d->bucket[d->bucketCount].weight = weight;
+        d->bucketCount++;
+        d->totalWeight += weight;
+    }
+}
+
+static void replaySetDistribution(cfTaskId_e taskId, const replayBucket_t *buckets, int count)
+{
+    replayDistribution_t *d = &replayTasks[taskId].execution;
+    memset(d, 0, sizeof(*d));
+    for (int i = 0; i < count; i++) {
+        replayAddBucket(d, buckets[i].executionTimeUs, buckets[i].weight);
+    }
+}
+
+static void replayRecordRun(cfTaskId_e taskId, timeUs_t currentTimeUs, timeUs_t dueAt)
+{
+    replayTask_t *t = &replayTasks[taskId];
+    replayTaskStats_t *s = &t->stats;
+
+    if (s->runs > 0) {
+        const timeDelta_t period = cmpTimeUs(currentTimeUs, s->lastRunAt);
+        s->minPeriod = MIN(s->minPeriod, period);
+        s->maxPeriod = MAX(s->maxPeriod, period);
+        s->sumPeriod += period;
+        s->sumSqPeriod += (double)period * period;
+
+        const timeDelta_t latency = cmpTimeUs(currentTimeUs, dueAt);
+        s->maxLatency = MAX(s->maxLatency, latency);
+        if (latency >= cfTasks[taskId].desiredPeriod) {
+            s->starved++;
+        }
+    }
+    s->lastRunAt = currentTimeUs;
+    s->runs++;
+}
+
+template <cfTaskId_e taskId>
+static void replayTaskFunc(timeUs_t currentTimeUs)
+{
+    replayTask_t *t = &replayTasks[taskId];
+    timeUs_t dueAt;
+    if (t->eventPeriodUs) {
+        dueAt = t->eventPending ? t->pendingEventAt : t->stats.lastRunAt + cfTasks[taskId].desiredPeriod;
+        t->eventPending = false;
+    } else {
+        dueAt = t->stats.lastRunAt + cfTasks[taskId].desiredPeriod;
+    }
+    replayRecordRun(taskId, currentTimeUs, dueAt);
+
+    if (taskId == TASK_SYSTEM) {
+        taskSystem(currentTimeUs);
+        replayReport.loadSamples++;
+        replayReport.loadSum += averageSystemLoadPercent;
+        replayReport.maxLoad = MAX(replayReport.maxLoad, averageSystemLoadPercent);
+    }
+
+    simulatedTimeUs += replaySample(&t->execution);
+}
+
+template <cfTaskId_e taskId>
+static bool replayCheckFunc(timeUs_t currentTimeUs, timeDelta_t currentDeltaTimeUs)
+{
+    UNUSED(currentDeltaTimeUs);
+
+    replayTask_t *t = &replayTasks[taskId];
+    while (cmpTimeUs(currentTimeUs, t->nextEventAt) >= 0) {
+        if (!t->eventPending) {
+            t->pendingEventAt = t->nextEventAt;
+            t->eventPending = true;
+        }
+        t->nextEventAt += t->eventPeriodUs;
+    }
+    simulatedTimeUs += t->checkCostUs;
+    return t->eventPending;
+}
+
+static void replayDefineTask(cfTaskId_e taskId, const char *name, const char *subName,
+    bool (*checkFunc)(timeUs_t, timeDelta_t), void (*taskFunc)(timeUs_t),
+    timeDelta_t desiredPeriod, uint8_t staticPriority)
+{
+    // staticPriority is const, so entries are built whole rather than assigned, the rest is zero
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+    const cfTask_t task = {
+        .taskName = name,
+        .subTaskName = subName,
+        .checkFunc = checkFunc,
+        .taskFunc = taskFunc,
+        .desiredPeriod = desiredPeriod,
+        .staticPriority = staticPriority,
+    };
+#pragma GCC diagnostic pop
+    memcpy((void *)&cfTasks[taskId], &task, sizeof(task));
+}
+
+#define REPLAY_TASK(id, name, subName, period, priority) \
+    replayDefineTask(id, name, subName, NULL, replayTaskFunc<id>, period, priority)
+#define REPLAY_EVENT_TASK(id, name, subName, period, priority) \
+    replayDefineTask(id, name, subName, replayCheckFunc<id>, replayTaskFunc<id>, period, priority)
+
+// Task table and execution times representative of an F405 at 8k gyro / 4k PID.
+static void replayDefaultTaskSet(timeDelta_t gyroPidPeriodUs)
+{
+    memset((void *)cfTasks, 0, sizeof(cfTasks));
+    memset(replayTasks, 0, sizeof(replayTasks));
+
+    REPLAY_TASK(TASK_SYSTEM, "SYSTEM", NULL, 100000, TASK_PRIORITY_MEDIUM_HIGH);
+    REPLAY_TASK(TASK_GYROPID, "PID", "GYRO", gyroPidPeriodUs, TASK_PRIORITY_REALTIME);
+    REPLAY_TASK(TASK_ACCEL, "ACCEL", NULL, 1000, TASK_PRIORITY_MEDIUM);
+    REPLAY_TASK(TASK_ATTITUDE, "ATTITUDE", NULL, 10000, TASK_PRIORITY_MEDIUM);
+    REPLAY_EVENT_TASK(TASK_RX, "RX", NULL, 20000, TASK_PRIORITY_HIGH);
+    REPLAY_TASK(TASK_SERIAL, "SERIAL", NULL, 10000, TASK_PRIORITY_LOW);
+    REPLAY_TASK(TASK_DISPATCH, "DISPATCH", NULL, 1000, TASK_PRIORITY_HIGH);
+    REPLAY_TASK(TASK_BATTERY_ALERTS, "BATTERY_ALERTS", NULL, 200000, TASK_PRIORITY_MEDIUM);
+    REPLAY_TASK(TASK_BATTERY_VOLTAGE, "BATTERY_VOLTAGE", NULL, 20000, TASK_PRIORITY_MEDIUM);
+    REPLAY_TASK(TASK_BATTERY_CURRENT, "BATTERY_CURRENT", NULL, 20000, TASK_PRIORITY_MEDIUM);
+    REPLAY_TASK(TASK_COMPASS, "COMPASS", NULL, 100000, TASK_PRIORITY_LOW);
+    REPLAY_TASK(TASK_BARO, "BARO", NULL, 50000, TASK_PRIORITY_LOW);
+    REPLAY_TASK(TASK_ALTITUDE, "ALTITUDE", NULL, 25000, TASK_PRIORITY_LOW);
+    REPLAY_TASK(TASK_TELEMETRY, "TELEMETRY", NULL, 4000, TASK_PRIORITY_LOW);
+
+    static const replayBucket_t system[] = { { 2, 1 } };
+    static const replayBucket_t gyroPid[] = { { 60, 70 }, { 75, 25 }, { 110, 5 } };
+    static const replayBucket_t accel[] = { { 18, 9 }, { 25, 1 } };
+    static const replayBucket_t attitude[] = { { 40, 9 }, { 55, 1 } };
+    static const replayBucket_t rx[] = { { 25, 9 }, { 60, 1 } };
+    static const replayBucket_t serial[] = { { 3, 95 }, { 150, 5 } };
+    static const replayBucket_t dispatch[] = { { 1, 1 } };
+    static const replayBucket_t battery[] = { { 8, 1 } };
+    static const replayBucket_t compass[] = { { 30, 1 } };
+    static const replayBucket_t baro[] = { { 20, 1 } };
+    static const replayBucket_t altitude[] = { { 35, 1 } };
+    static const replayBucket_t telemetry[] = { { 5, 9 }, { 40, 1 } };
+
+    replaySetDistribution(TASK_SYSTEM, system, ARRAYLEN(system));
+    replaySetDistribution(TASK_GYROPID, gyroPid, ARRAYLEN(gyroPid));
+    replaySetDistribution(TASK_ACCEL, accel, ARRAYLEN(accel));
+    replaySetDistribution(TASK_ATTITUDE, attitude, ARRAYLEN(attitude));
+    replaySetDistribution(TASK_RX, rx, ARRAYLEN(rx));
+    replaySetDistribution(TASK_SERIAL, serial, ARRAYLEN(serial));
+    replaySetDistribution(TASK_DISPATCH, dispatch, ARRAYLEN(dispatch));
+    replaySetDistribution(TASK_BATTERY_ALERTS, battery, ARRAYLEN(battery));
+    replaySetDistribution(TASK_BATTERY_VOLTAGE, battery, ARRAYLEN(battery));
+    replaySetDistribution(TASK_BATTERY_CURRENT, battery, ARRAYLEN(battery));
+    replaySetDistribution(TASK_COMPASS, compass, ARRAYLEN(compass));
+    replaySetDistribution(TASK_BARO, baro, ARRAYLEN(baro));
+    replaySetDistribution(TASK_ALTITUDE, altitude, ARRAYLEN(altitude));
+    replaySetDistribution(TASK_TELEMETRY, telemetry, ARRAYLEN(telemetry));
+
+    replayTasks[TASK_RX].eventPeriodUs = 9000;      // SBUS frame interval
+    replayTasks[TASK_RX].checkCostUs = 1;
+}
+
+static cfTaskId_e replayFindTask(const char *name)
+{
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        if (cfTasks[taskId].taskName && strcasecmp(cfTasks[taskId].taskName, name) == 0) {
+            return (cfTaskId_e)taskId;
+        }
+    }
+    return TASK_NONE;
+}
+
+/*
+ * Parse one "<task name> <us> <count>" line into the task's distribution. The first line
+ * for a task replaces its default distribution. Returns false on a malformed line.
+ */
+static bool replayParseProfileLine(const char *line, bool replaced[TASK_COUNT])
+{
+    char name[32];
+    unsigned executionTimeUs;
+    unsigned count;
+
+    while (*line == ' ' || *line == '\t') {
+        line++;
+    }
+    if (*line == '\0' || *line == '\n' || *line == '#') {
+        return true;
+    }
+    if (sscanf(line, "%31s %u %u", name, &executionTimeUs, &count) != 3) {
+        return false;
+    }
+    const cfTaskId_e taskId = replayFindTask(name);
+    if (taskId == TASK_NONE) {
+        return false;
+    }
+    if (!replaced[taskId]) {
+        memset(&replayTasks[taskId].execution, 0, sizeof(replayDistribution_t));
+        replaced[taskId] = true;
+    }
+    replayAddBucket(&replayTasks[taskId].execution, executionTimeUs, count);
+    return true;
+}
+
+static void replayLoadProfile(const char *filename)
+{
+    FILE *f = fopen(filename, "r");
+    if (!f) {
+        printf("[ REPLAY   ] unable to open %s\n", filename);
+        return;
+    }
+    bool replaced[TASK_COUNT] = { false };
+    char line[128];
+    int lineNumber = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineNumber++;
+        if (!replayParseProfileLine(line, replaced)) {
+            printf("[ REPLAY   ] %s:%d ignored\n", filename, lineNumber);
+        }
+    }
+    fclose(f);
+}
+
+static void replayStart(uint32_t seed)
+{
+    simulatedTimeUs = 0;
+    replaySeed = seed;
+    memset(&replayReport, 0, sizeof(replayReport));
+
+    // start from a clean scheduler state, taskSystem() also clears the load accumulators
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        cfTask_t *task = &cfTasks[taskId];
+        task->dynamicPriority = 0;
+        task->taskAgeCycles = 0;
+        task->taskLatestDeltaTime = 0;
+        task->lastExecutedAt = 0;
+        task->lastSignaledAt = 0;
+        schedulerResetTaskStatistics((cfTaskId_e)taskId);
+    }
+    schedulerInit();
+    taskSystem(0);
+    averageSystemLoadPercent = 0;
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        replayTask_t *t = &replayTasks[taskId];
+        memset(&t->stats, 0, sizeof(t->stats));
+        t->stats.minPeriod = INT32_MAX;
+        t->nextEventAt = t->eventPeriodUs;
+        t->eventPending = false;
+        if (cfTasks[taskId].taskFunc) {
+            setTaskEnabled((cfTaskId_e)taskId, true);
+        }
+    }
+}
+
+static void replayContinue(timeUs_t untilUs)
+{
+    while (cmpTimeUs(simulatedTimeUs, untilUs) < 0) {
+        simulatedTimeUs += REPLAY_SCHEDULER_COST;
+        scheduler();
+        replayReport.schedulerCalls++;
+    }
+}
+
+static void replayRun(timeUs_t durationUs, uint32_t seed)
+{
+    replayStart(seed);
+    replayContinue(durationUs);
+}
+
+static double replayPeriodStdDev(const replayTaskStats_t *s)
+{
+    if (s->runs < 2) {
+        return 0;
+    }
+    const double n = s->runs - 1;
+    const double mean = s->sumPeriod / n;
+    return sqrt(MAX(0.0, s->sumSqPeriod / n - mean * mean));
+}
+
+static void replayPrintReport(const char *title)
+{
+    printf("[ REPLAY   ] %s\n", title);
+    printf("[ REPLAY   ] %-16s %8s %8s %8s %8s %8s %8s %8s\n",
+        "task", "period", "runs", "mean", "jitter", "max", "maxlat", "starved");
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        if (!cfTasks[taskId].taskFunc) {
+            continue;
+        }
+        const replayTaskStats_t *s = &replayTasks[taskId].stats;
+        printf("[ REPLAY   ] %-16s %8d %8u %8.1f %8.1f %8d %8d %8u\n",
+            cfTasks[taskId].taskName, cfTasks[taskId].desiredPeriod, s->runs,
+            s->runs > 1 ? s->sumPeriod / (s->runs - 1) : 0.0, replayPeriodStdDev(s),
+            s->runs > 1 ? s->maxPeriod : 0, s->maxLatency, s->starved);
+    }
+    printf("[ REPLAY   ] load avg %u%% max %u%%, %u scheduler calls\n",
+        replayReport.loadSamples ? replayReport.loadSum / replayReport.loadSamples : 0,
+        replayReport.maxLoad, replayReport.schedulerCalls);
+}
+
+TEST(SchedulerReplayUnittest, TestDeterministic)
+{
+    replayDefaultTaskSet(250);
+    replayRun(2000000, 1);
+    replayTaskStats_t first[TASK_COUNT];
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        first[taskId] = replayTasks[taskId].stats;
+    }
+    const replayReport_t firstReport = replayReport;
+
+    replayRun(2000000, 1);
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        EXPECT_EQ(first[taskId].runs, replayTasks[taskId].stats.runs);
+        EXPECT_EQ(first[taskId].maxLatency, replayTasks[taskId].stats.maxLatency);
+        EXPECT_EQ(first[taskId].sumPeriod, replayTasks[taskId].stats.sumPeriod);
+    }
+    EXPECT_EQ(firstReport.schedulerCalls, replayReport.schedulerCalls);
+    EXPECT_EQ(firstReport.loadSum, replayReport.loadSum);
+}
+
+TEST(SchedulerReplayUnittest, TestDefaultTaskSet)
+{
+    replayDefaultTaskSet(250);
+    const char *profile = getenv("SCHEDULER_REPLAY_PROFILE");
+    if (profile) {
+        replayLoadProfile(profile);
+    }
+    replayRun(10000000, 1);
+    replayPrintReport("4k PID, default task set");
+
+    if (profile) {
+        // recorded profiles are reported only, they may well overload the scheduler
+        return;
+    }
+
+    const replayTaskStats_t *pid = &replayTasks[TASK_GYROPID].stats;
+    EXPECT_NEAR(250, pid->sumPeriod / (pid->runs - 1), 1);
+    EXPECT_EQ(0u, pid->starved);
+    EXPECT_LT(pid->maxLatency, 250);
+
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        if (cfTasks[taskId].taskFunc) {
+            EXPECT_GT(replayTasks[taskId].stats.runs, 0u) << cfTasks[taskId].taskName;
+        }
+    }
+    // RX runs once per event, not at its fallback period
+    EXPECT_NEAR(10000000 / 9000, replayTasks[TASK_RX].stats.runs, 2);
+    EXPECT_LT(replayReport.maxLoad, LOAD_PERCENTAGE_ONE);
+}
+
+TEST(SchedulerReplayUnittest, TestOverloadedTaskSet)
+{
+    // 8k PID taking most of its period leaves too little time for everything else
+    replayDefaultTaskSet(125);
+    static const replayBucket_t gyroPid[] = { { 120, 1 } };
+    replaySetDistribution(TASK_GYROPID, gyroPid, ARRAYLEN(gyroPid));
+    replayRun(10000000, 1);
+    replayPrintReport("8k PID taking 120us, default task set");
+
+    // other tasks only get a turn once they are a whole period late, and then delay the PID loop
+    const replayTaskStats_t *pid = &replayTasks[TASK_GYROPID].stats;
+    EXPECT_GT(pid->sumPeriod / (pid->runs - 1), 126);
+    EXPECT_GT(pid->starved, 0u);
+    EXPECT_GT(replayReport.maxLoad, 25);
+
+    // dynamic priority ageing still gets every task run close to its rate
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        if (cfTasks[taskId].taskFunc && taskId != TASK_GYROPID && taskId != TASK_RX) {
+            const replayTaskStats_t *s = &replayTasks[taskId].stats;
+            EXPECT_LT(s->sumPeriod / (s->runs - 1), cfTasks[taskId].desiredPeriod * 1.1) << cfTasks[taskId].taskName;
+        }
+    }
+}
+
+TEST(SchedulerReplayUnittest, TestProfileParser)
+{
+    replayDefaultTaskSet(250);
+    bool replaced[TASK_COUNT] = { false };
+
+    EXPECT_TRUE(replayParseProfileLine("# comment\n", replaced));
+    EXPECT_TRUE(replayParseProfileLine("\n", replaced));
+    EXPECT_TRUE(replayParseProfileLine("PID 50 3\n", replaced));
+    EXPECT_TRUE(replayParseProfileLine("pid 80 1\n", replaced));
+    EXPECT_TRUE(replayParseProfileLine("  PID 50 1\n", replaced));
+    EXPECT_FALSE(replayParseProfileLine("NOSUCHTASK 50 1\n", replaced));
+    EXPECT_FALSE(replayParseProfileLine("PID fifty\n", replaced));
+
+    const replayDistribution_t *d = &replayTasks[TASK_GYROPID].execution;
+    EXPECT_EQ(2, d->bucketCount);
+    EXPECT_EQ(5u, d->totalWeight);
+    EXPECT_EQ(50u, d->bucket[0].executionTimeUs);
+    EXPECT_EQ(4u, d->bucket[0].weight);
+
+    // untouched tasks keep their defaults
+    EXPECT_EQ(2, replayTasks[TASK_ACCEL].execution.bucketCount);
+}
+
+TEST(SchedulerReplayUnittest, TestRescheduleAndDisable)
+{
+    replayDefaultTaskSet(250);
+    replayStart(1);
+    replayContinue(1000000);
+
+    rescheduleTask(TASK_ACCEL, 2000);
+    setTaskEnabled(TASK_TELEMETRY, false);
+    const uint32_t accelRuns = replayTasks[TASK_ACCEL].stats.runs;
+    const uint32_t telemetryRuns = replayTasks[TASK_TELEMETRY].stats.runs;
+    const uint32_t pidRuns = replayTasks[TASK_GYROPID].stats.runs;
+
+    replayContinue(3000000);
+
+    EXPECT_NEAR(1000, replayTasks[TASK_ACCEL].stats.runs - accelRuns, 5);
+    EXPECT_EQ(telemetryRuns, replayTasks[TASK_TELEMETRY].stats.runs);
+    EXPECT_NEAR(8000, replayTasks[TASK_GYROPID].stats.runs - pidRuns, 80);
+    EXPECT_EQ(0u, replayTasks[TASK_GYROPID].stats.starved);
+
+    setTaskEnabled(TASK_TELEMETRY, true);
+    replayContinue(4000000);
+    EXPECT_NEAR(250, replayTasks[TASK_TELEMETRY].stats.runs - telemetryRuns, 5);
+}
+
+TEST(SchedulerReplayUnittest, TestTraceAndHistograms)
+{
+    replayDefaultTaskSet(250);
+    const uint32_t startSequence = schedulerTraceSequence();
+    replayRun(1000000, 1);
+
+    // every task execution is counted once in each histogram and once in the trace
+    uint32_t executions = 0;
+    for (int taskId = 0; taskId < TASK_COUNT; taskId++) {
+        uint32_t latenessSum = 0;
+        uint32_t executionSum = 0;
+        for (int i = 0; i < SCHEDULER_HISTOGRAM_BUCKETS; i++) {
+            latenessSum += getTaskLatenessHistogram((cfTaskId_e)taskId)[i];
+            executionSum += getTaskExecutionHistogram((cfTaskId_e)taskId)[i];
+        }
+        EXPECT_EQ(latenessSum, executionSum);
+        if (taskId != TASK_SYSTEM) {
+            EXPECT_EQ(replayTasks[taskId].stats.runs, executionSum);
+        }
+        executions += executionSum;
+    }
+    EXPECT_EQ(executions, schedulerTraceSequence() - startSequence);
+
+    // a stale sequence number returns the oldest entries still held
+    schedulerTraceEntry_t entries[SCHEDULER_TRACE_SIZE];
+    uint32_t sequence = startSequence;
+    EXPECT_EQ(SCHEDULER_TRACE_SIZE, schedulerTraceRead(&sequence, entries, SCHEDULER_TRACE_SIZE));
+    EXPECT_EQ(schedulerTraceSequence() - SCHEDULER_TRACE_SIZE, sequence);
+    for (int i = 1; i < SCHEDULER_TRACE_SIZE; i++) {
+        EXPECT_GT(cmpTimeUs(entries[i].startedAt, entries[i - 1].startedAt), 0);
+        EXPECT_LT(entries[i].taskId, TASK_COUNT);
+    }
+
+    // reading in chunks continues where the last read stopped
+    schedulerTraceEntry_t chunk[10];
+    sequence = schedulerTraceSequence() - 15;
+    EXPECT_EQ(10, schedulerTraceRead(&sequence, chunk, 10));
+    EXPECT_EQ(schedulerTraceSequence() - 15, sequence);
+    EXPECT_EQ(entries[SCHEDULER_TRACE_SIZE - 15].startedAt, chunk[0].startedAt);
+    sequence += 10;
+    EXPECT_EQ(5, schedulerTraceRead(&sequence, chunk, 10));
+    EXPECT_EQ(entries[SCHEDULER_TRACE_SIZE - 1].startedAt, chunk[4].startedAt);
+    sequence += 5;
+    EXPECT_EQ(0, schedulerTraceRead(&sequence, chunk, 10));
+
+    // PID loop runs on time in the default task set
+    const uint16_t *pidLateness = getTaskLatenessHistogram(TASK_GYROPID);
+    uint32_t pidOnTime = 0;
+    for (int i = 0; i < 8; i++) {
+        pidOnTime += pidLateness[i];
+    }
+    EXPECT_GT(pidOnTime, replayTasks[TASK_GYROPID].stats.runs * 9 / 10);
+}
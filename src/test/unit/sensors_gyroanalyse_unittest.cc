@@ -0,0 +1,226 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "arm_math.h"
+
+    #include "build/debug.h"
+
+    #include "common/axis.h"
+    #include "common/maths.h"
+    #include "common/utils.h"
+
+    #include "drivers/accgyro.h"
+
+    #include "sensors/gyro.h"
+    #include "sensors/gyroanalyse.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+#define GYRO_LOOPTIME_US        125     // 8kHz gyro
+#define ANALYSE_TASK_PERIOD_US  3333    // TASK_GYRO_DATA_ANALYSE at 300Hz
+
+static gyroDev_t testGyroDev;
+static gyro_t testGyro;
+static uint32_t simTimeUs;
+static uint32_t nextTaskTimeUs;
+
+static void resetSimulation(void)
+{
+    memset(&testGyroDev, 0, sizeof(testGyroDev));
+    memset(&testGyro, 0, sizeof(testGyro));
+    testGyroDev.scale = 1.0f;
+    testGyro.targetLooptime = GYRO_LOOPTIME_US;
+    simTimeUs = 0;
+    nextTaskTimeUs = ANALYSE_TASK_PERIOD_US;
+    gyroDataAnalyseInit(GYRO_LOOPTIME_US);
+}
+
+// motor noise: a sine per axis plus a little broadband noise, in gyro counts
+static void simulateGyroSample(const float freqHz[XYZ_AXIS_COUNT], float amplitude)
+{
+    static float phase[XYZ_AXIS_COUNT];
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        phase[axis] += 2.0f * M_PIf * freqHz[axis] * GYRO_LOOPTIME_US * 1e-6f;
+        if (phase[axis] > 2.0f * M_PIf) {
+            phase[axis] -= 2.0f * M_PIf;
+        }
+        const float noise = (rand() % 21) - 10;
+        testGyroDev.gyroADC[axis] = lrintf(amplitude * sinf(phase[axis]) + noise);
+    }
+    gyroDataAnalyse(&testGyroDev, &testGyro);
+
+    simTimeUs += GYRO_LOOPTIME_US;
+    if (simTimeUs >= nextTaskTimeUs) {
+        gyroDataAnalyseUpdate(simTimeUs);
+        nextTaskTimeUs += ANALYSE_TASK_PERIOD_US;
+    }
+}
+
+static void simulate(const float freqHz[XYZ_AXIS_COUNT], float amplitude, uint32_t durationUs)
+{
+    const uint32_t endTimeUs = simTimeUs + durationUs;
+    while (simTimeUs < endTimeUs) {
+        simulateGyroSample(freqHz, amplitude);
+    }
+}
+
+TEST(GyroAnalyseUnittest, TestInit)
+{
+    resetSimulation();
+
+    // 8kHz gyro decimated to 1kHz gives 31.25Hz bins
+    EXPECT_FLOAT_EQ(1000.0f / FFT_WINDOW_SIZE, gyroFftResolution());
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_EQ(0, gyroFftData(axis)->centerFreq);
+    }
+}
+
+TEST(GyroAnalyseUnittest, TestMaxFreq)
+{
+    // 8kHz gyro, limited by the analysis rate
+    EXPECT_EQ(468, gyroFftMaxFreq(125));
+    EXPECT_LT(gyroFftMaxFreq(125), FFT_SAMPLING_RATE / 2);
+
+    // 1kHz gyro with gyro_sync_denom 2, limited by the gyro loop
+    EXPECT_EQ(234, gyroFftMaxFreq(2000));
+
+    // the notch must stay below the Nyquist frequency of the loop it filters
+    const uint32_t looptimesUs[] = { 125, 250, 312, 500, 1000, 2000, 4000 };
+    for (unsigned i = 0; i < ARRAYLEN(looptimesUs); i++) {
+        const float omega = 2.0f * M_PIf * gyroFftMaxFreq(looptimesUs[i]) * looptimesUs[i] * 1e-6f;
+        EXPECT_LT(omega, M_PIf);
+        EXPECT_GT(gyroFftMaxFreq(looptimesUs[i]), 0);
+    }
+}
+
+TEST(GyroAnalyseUnittest, TestDetectStaticPeaks)
+{
+    resetSimulation();
+
+    const float freqHz[XYZ_AXIS_COUNT] = { 250, 180, 400 };
+    simulate(freqHz, 200, 200000);
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        EXPECT_NEAR(freqHz[axis], gyroFftData(axis)->centerFreq, gyroFftResolution());
+        EXPECT_GT(gyroFftData(axis)->peakAmplitude, 4 * gyroFftData(axis)->meanAmplitude);
+    }
+}
+
+TEST(GyroAnalyseUnittest, TestDetectionLatency)
+{
+    resetSimulation();
+
+    // throttle punch moves motor noise from 200Hz to 350Hz
+    const float lowHz[XYZ_AXIS_COUNT] = { 200, 200, 200 };
+    const float highHz[XYZ_AXIS_COUNT] = { 350, 350, 350 };
+    simulate(lowHz, 200, 200000);
+    EXPECT_NEAR(200, gyroFftData(FD_ROLL)->centerFreq, gyroFftResolution());
+
+    const uint32_t stepTimeUs = simTimeUs;
+    uint32_t detectedTimeUs[XYZ_AXIS_COUNT] = { 0, 0, 0 };
+    while (simTimeUs < stepTimeUs + 500000) {
+        simulateGyroSample(highHz, 200);
+        for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+            if (!detectedTimeUs[axis] && fabsf(gyroFftData(axis)->centerFreq - highHz[axis]) <= gyroFftResolution()) {
+                detectedTimeUs[axis] = simTimeUs;
+            }
+        }
+    }
+
+    for (int axis = 0; axis < XYZ_AXIS_COUNT; axis++) {
+        ASSERT_NE(0U, detectedTimeUs[axis]);
+        const uint32_t latencyUs = detectedTimeUs[axis] - stepTimeUs;
+        // one window plus one full round of analysis steps
+        EXPECT_LT(latencyUs, FFT_WINDOW_SIZE * 1000 + 9 * ANALYSE_TASK_PERIOD_US + 2 * ANALYSE_TASK_PERIOD_US);
+    }
+}
+
+TEST(GyroAnalyseUnittest, TestSweepTracking)
+{
+    resetSimulation();
+
+    // linear sweep of motor noise from 150Hz to 450Hz over one second
+    float freqHz[XYZ_AXIS_COUNT];
+    float maxErrorHz = 0;
+    const uint32_t sweepUs = 1000000;
+    while (simTimeUs < sweepUs) {
+        const float f = 150 + 300.0f * simTimeUs / sweepUs;
+        freqHz[FD_ROLL] = freqHz[FD_PITCH] = freqHz[FD_YAW] = f;
+        simulateGyroSample(freqHz, 200);
+        if (simTimeUs > 100000) {
+            maxErrorHz = MAX(maxErrorHz, fabsf(gyroFftData(FD_ROLL)->centerFreq - f));
+        }
+    }
+
+    // 300Hz/s sweep, the analysis lags by roughly one window
+    EXPECT_LT(maxErrorHz, 4 * gyroFftResolution());
+}
+
+// STUBS
+
+extern "C" {
+int16_t debug[DEBUG16_VALUE_COUNT];
+uint8_t debugMode;
+
+void gyroUpdateDynamicNotch(int, const gyroFftData_t *) {}
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen)
+{
+    S->fftLenRFFT = fftLen;
+    return ARM_MATH_SUCCESS;
+}
+
+// reference DFT producing the CMSIS packed output format: DC, Nyquist, then re/im pairs
+void arm_rfft_fast_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag)
+{
+    UNUSED(ifftFlag);
+    const int n = S->fftLenRFFT;
+    for (int k = 0; k <= n / 2; k++) {
+        float re = 0;
+        float im = 0;
+        for (int i = 0; i < n; i++) {
+            re += p[i] * cosf(2.0f * M_PIf * k * i / n);
+            im -= p[i] * sinf(2.0f * M_PIf * k * i / n);
+        }
+        if (k == 0) {
+            pOut[0] = re;
+        } else if (k == n / 2) {
+            pOut[1] = re;
+        } else {
+            pOut[2 * k] = re;
+            pOut[2 * k + 1] = im;
+        }
+    }
+}
+
+void arm_cmplx_mag_f32(float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+    for (uint32_t i = 0; i < numSamples; i++) {
+        pDst[i] = sqrtf(pSrc[2 * i] * pSrc[2 * i] + pSrc[2 * i + 1] * pSrc[2 * i + 1]);
+    }
+}
+}
@@ -0,0 +1,534 @@
+/*
+ * This file is part of Cleanflight.
+ *
+ * Cleanflight is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Cleanflight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Cleanflight.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+extern "C" {
+    #include "platform.h"
+
+    #include "common/maths.h"
+
+    #include "drivers/block_device_mmap.h"
+
+    #include "io/asyncfatfs/asyncfatfs.h"
+    #include "io/asyncfatfs/fat_standard.h"
+    #include "io/flashfs.h"
+}
+
+#include "unittest_macros.h"
+#include "gtest/gtest.h"
+
+/*
+ * Replays the writes of a blackbox log through asyncfatfs and flashfs on a simulated card or flash chip and checks
+ * that they keep up with it without dropping frames.
+ */
+
+#define LOOP_TIME_US            125     // 8kHz PID loop, the filesystem is polled once per loop
+#define LOG_EVERY_LOOPS         2       // blackbox_p_denom, a main frame every second loop
+#define I_INTERVAL              32      // an I frame every 32 main frames, P frames in between
+#define G_INTERVAL              16      // GPS frames
+#define S_INTERVAL              500     // slow frames when flight mode flags change
+#define HEADER_LINES            160
+#define HEADER_BYTES_PER_LOOP   256     // the blackbox sends the header as fast as the device buffer allows
+
+#define LOG_SIZE                (2 * 1024 * 1024)
+#define MAX_FRAMES              (LOG_SIZE / 8)
+
+// A FAT16 volume of 4KiB clusters, large enough that the freefile gives logs 1MiB superclusters
+#define SECTOR_SIZE             512
+#define PARTITION_START         8
+#define RESERVED_SECTORS        1
+#define SECTORS_PER_CLUSTER     8
+#define CLUSTER_COUNT           8000
+#define FAT_SECTORS             32
+#define ROOT_ENTRY_COUNT        512
+#define ROOT_DIR_SECTORS        (ROOT_ENTRY_COUNT * FAT_DIRECTORY_ENTRY_SIZE / SECTOR_SIZE)
+#define VOLUME_SECTORS          (RESERVED_SECTORS + 2 * FAT_SECTORS + ROOT_DIR_SECTORS + CLUSTER_COUNT * SECTORS_PER_CLUSTER)
+#define CARD_SIZE               ((PARTITION_START + VOLUME_SECTORS) * SECTOR_SIZE)
+
+// A 16MiB NOR chip of 64KiB sectors
+#define FLASH_SECTOR_SIZE       (64 * 1024)
+#define FLASH_SIZE              (16 * 1024 * 1024)
+
+// A slow card on a 21MHz SPI bus
+static const blockDeviceTiming_t cardTiming = {
+    .readUs = 300,
+    .transmitUs = 200,
+    .writeUs = 1500,
+    .multiWriteUs = 250,
+    .stopUs = 500,
+    .eraseUs = 0,
+    .failEvery = 0,
+};
+
+// Page program and sector erase times of an M25P16 class chip, reads are clocked out at 21MHz
+static const blockDeviceTiming_t flashTiming = {
+    .readUs = 100,
+    .transmitUs = 0,
+    .writeUs = 700,
+    .multiWriteUs = 0,
+    .stopUs = 0,
+    .eraseUs = 500000,
+    .failEvery = 0,
+};
+
+typedef struct frame_s {
+    uint32_t loop;
+    uint16_t length;
+} frame_t;
+
+static uint8_t logData[LOG_SIZE];
+static frame_t frames[MAX_FRAMES];
+static int frameCount;
+static uint32_t logLength;
+
+static uint8_t readBuffer[LOG_SIZE];
+
+static uint32_t simTimeUs;
+
+static afatfsFilePtr_t openedFile;
+static bool fileOpenComplete;
+static bool fileCloseComplete;
+
+typedef struct replayResult_s {
+    uint32_t bytesWritten;
+    uint32_t framesDropped;
+    uint32_t elapsedUs;
+} replayResult_t;
+
+// How the replay talks to the filesystem under test
+typedef struct replayTarget_s {
+    uint32_t (*freeSpace)(void);
+    void (*write)(const uint8_t *data, uint32_t length);
+    bool (*flush)(void);
+    void (*poll)(void);
+} replayTarget_t;
+
+static void addFrame(uint32_t loop, char type, int length)
+{
+    if (frameCount >= MAX_FRAMES || logLength + length > LOG_SIZE) {
+        return;
+    }
+
+    uint8_t *frame = logData + logLength;
+    frame[0] = type;
+    for (int i = 1; i < length; i++) {
+        // Mostly small zigzag deltas like the real encoder produces
+        frame[i] = (rand() % 8) ? rand() % 16 : rand();
+    }
+
+    frames[frameCount].loop = loop;
+    frames[frameCount].length = length;
+    frameCount++;
+    logLength += length;
+}
+
+/*
+ * Build the frames of a log: the header lines, then a main frame every LOG_EVERY_LOOPS loops with the occasional GPS
+ * and slow frame, and finally the end of log event.
+ */
+static void generateBlackboxLog(uint32_t size)
+{
+    srand(1);
+    frameCount = 0;
+    logLength = 0;
+
+    uint32_t loop = 0;
+    int headerBytesThisLoop = 0;
+    for (int line = 0; line < HEADER_LINES; line++) {
+        const int length = 20 + rand() % 40;
+        if (headerBytesThisLoop + length > HEADER_BYTES_PER_LOOP) {
+            loop++;
+            headerBytesThisLoop = 0;
+        }
+        addFrame(loop, 'H', length);
+        headerBytesThisLoop += length;
+    }
+
+    for (int frameIndex = 0; logLength < size - 64; frameIndex++) {
+        loop += LOG_EVERY_LOOPS;
+        if (frameIndex % I_INTERVAL == 0) {
+            addFrame(loop, 'I', 60 + rand() % 20);
+        } else {
+            addFrame(loop, 'P', 22 + rand() % 16);
+        }
+        if (frameIndex % G_INTERVAL == 0) {
+            addFrame(loop, 'G', 14 + rand() % 6);
+        }
+        if (frameIndex % S_INTERVAL == 0) {
+            addFrame(loop, 'S', 6);
+        }
+    }
+
+    addFrame(loop + LOG_EVERY_LOOPS, 'E', 16);
+}
+
+static double megabytesPerSecond(uint32_t bytes, uint32_t us)
+{
+    return us ? bytes / (double)us : 0;
+}
+
+/*
+ * Write the frames of the log on the loops the blackbox would have written them. Like the blackbox, header lines wait
+ * for buffer space and the header is flushed completely before logging begins, which delays the rest of the log, while
+ * data frames that don't fit are dropped.
+ */
+static replayResult_t replayLog(const replayTarget_t *target)
+{
+    replayResult_t result = { 0, 0, 0 };
+    const uint32_t startUs = simTimeUs;
+
+    uint32_t offset = 0;
+    uint32_t delayLoops = 0;
+    bool headerFlushed = false;
+    int frameIndex = 0;
+    for (uint32_t loop = 0; frameIndex < frameCount; loop++) {
+        for (; frameIndex < frameCount && frames[frameIndex].loop + delayLoops <= loop; frameIndex++) {
+            const uint16_t length = frames[frameIndex].length;
+            if (logData[offset] != 'H' && !headerFlushed) {
+                if (!target->flush()) {
+                    delayLoops++;
+                    break;
+                }
+                headerFlushed = true;
+            }
+            if (target->freeSpace() >= length) {
+                target->write(logData + offset, length);
+                result.bytesWritten += length;
+            } else if (logData[offset] == 'H') {
+                delayLoops++;
+                break;
+            } else {
+                result.framesDropped++;
+            }
+            offset += length;
+        }
+
+        simTimeUs += LOOP_TIME_US;
+        target->poll();
+    }
+
+    result.elapsedUs = simTimeUs - startUs;
+    return result;
+}
+
+// SD CARD
+
+static void formatCard(void)
+{
+    uint8_t *card = blockDeviceMmapGetImage();
+    memset(card, 0, CARD_SIZE);
+
+    mbrPartitionEntry_t *partition = (mbrPartitionEntry_t *)(card + 446);
+    partition->type = MBR_PARTITION_TYPE_FAT16_LBA;
+    partition->lbaBegin = PARTITION_START;
+    partition->numSectors = VOLUME_SECTORS;
+    card[510] = 0x55;
+    card[511] = 0xAA;
+
+    uint8_t *volumeSector = card + PARTITION_START * SECTOR_SIZE;
+    fatVolumeID_t *volume = (fatVolumeID_t *)volumeSector;
+    volume->bytesPerSector = SECTOR_SIZE;
+    volume->sectorsPerCluster = SECTORS_PER_CLUSTER;
+    volume->reservedSectorCount = RESERVED_SECTORS;
+    volume->numFATs = 2;
+    volume->rootEntryCount = ROOT_ENTRY_COUNT;
+    volume->media = 0xF8;
+    volume->FATSize16 = FAT_SECTORS;
+    volume->totalSectors32 = VOLUME_SECTORS;
+    volumeSector[510] = FAT_VOLUME_ID_SIGNATURE_1;
+    volumeSector[511] = FAT_VOLUME_ID_SIGNATURE_2;
+
+    for (int fat = 0; fat < 2; fat++) {
+        uint16_t *entries = (uint16_t *)(volumeSector + (RESERVED_SECTORS + fat * FAT_SECTORS) * SECTOR_SIZE);
+        entries[0] = 0xFFF8;
+        entries[1] = 0xFFFF;
+    }
+}
+
+static void runCardLoop(void)
+{
+    simTimeUs += LOOP_TIME_US;
+    afatfs_poll();
+}
+
+static void mountCard(void)
+{
+    afatfs_init(&blockDeviceMmapSdcardVTable);
+    for (int i = 0; i < 100000 && afatfs_getFilesystemState() == AFATFS_FILESYSTEM_STATE_INITIALIZATION; i++) {
+        runCardLoop();
+    }
+    ASSERT_EQ(AFATFS_FILESYSTEM_STATE_READY, afatfs_getFilesystemState());
+}
+
+static void unmountCard(void)
+{
+    for (int i = 0; i < 100000 && !afatfs_destroy(false); i++) {
+        runCardLoop();
+    }
+}
+
+static void openCard(const char *filename, const blockDeviceTiming_t *timing, bool format)
+{
+    simTimeUs = 0;
+    ASSERT_TRUE(blockDeviceMmapOpen(filename, CARD_SIZE, FLASH_SECTOR_SIZE));
+    if (format) {
+        formatCard();
+    }
+    blockDeviceMmapSetTiming(timing);
+    mountCard();
+}
+
+static void fileOpened(afatfsFilePtr_t file)
+{
+    openedFile = file;
+    fileOpenComplete = true;
+}
+
+static void fileClosed(void)
+{
+    fileCloseComplete = true;
+}
+
+static afatfsFilePtr_t openFile(const char *filename, const char *mode)
+{
+    fileOpenComplete = false;
+    openedFile = NULL;
+    EXPECT_TRUE(afatfs_fopen(filename, mode, fileOpened));
+    for (int i = 0; i < 100000 && !fileOpenComplete; i++) {
+        runCardLoop();
+    }
+    EXPECT_TRUE(fileOpenComplete);
+    return openedFile;
+}
+
+static void closeFile(afatfsFilePtr_t file)
+{
+    fileCloseComplete = false;
+    for (int i = 0; i < 100000 && !afatfs_fclose(file, fileClosed); i++) {
+        runCardLoop();
+    }
+    for (int i = 0; i < 100000 && !fileCloseComplete; i++) {
+        runCardLoop();
+    }
+    EXPECT_TRUE(fileCloseComplete);
+}
+
+static afatfsFilePtr_t replayFile;
+
+static uint32_t cardFreeSpace(void)
+{
+    return afatfs_getFreeBufferSpace();
+}
+
+static void cardWrite(const uint8_t *data, uint32_t length)
+{
+    EXPECT_EQ(length, afatfs_fwrite(replayFile, data, length));
+}
+
+static const replayTarget_t cardTarget = {
+    .freeSpace = cardFreeSpace,
+    .write = cardWrite,
+    .flush = afatfs_flush,
+    .poll = afatfs_poll,
+};
+
+// Write the log as fast as the card takes it
+static replayResult_t streamToCard(afatfsFilePtr_t file)
+{
+    replayResult_t result = { 0, 0, 0 };
+    const uint32_t startUs = simTimeUs;
+
+    while (result.bytesWritten < logLength) {
+        result.bytesWritten += afatfs_fwrite(file, logData + result.bytesWritten, MIN(SECTOR_SIZE, logLength - result.bytesWritten));
+
+        simTimeUs += LOOP_TIME_US;
+        afatfs_poll();
+    }
+
+    result.elapsedUs = simTimeUs - startUs;
+    return result;
+}
+
+static void expectCardFileContent(const char *filename)
+{
+    afatfsFilePtr_t file = openFile(filename, "r");
+    ASSERT_TRUE(file != NULL);
+
+    uint32_t offset = 0;
+    for (int i = 0; i < 1000000 && !afatfs_feof(file) && offset < sizeof(readBuffer); i++) {
+        offset += afatfs_fread(file, readBuffer + offset, MIN(SECTOR_SIZE, sizeof(readBuffer) - offset));
+        runCardLoop();
+    }
+    EXPECT_EQ(logLength, offset);
+    EXPECT_EQ(0, memcmp(logData, readBuffer, logLength));
+
+    closeFile(file);
+}
+
+TEST(StorageBenchmarkUnittest, TestCardKeepsUpWithBlackbox)
+{
+    generateBlackboxLog(LOG_SIZE);
+    openCard(NULL, &cardTiming, true);
+
+    afatfsFilePtr_t file = openFile("LOG00001.BFL", "as");
+    ASSERT_TRUE(file != NULL);
+    replayFile = file;
+    const replayResult_t result = replayLog(&cardTarget);
+    closeFile(file);
+
+    EXPECT_EQ(0u, result.framesDropped);
+    expectCardFileContent("LOG00001.BFL");
+
+    // appending keeps going back to the same FAT sector
+    afatfsCacheStats_t cacheStats;
+    afatfs_getCacheStats(&cacheStats);
+    EXPECT_GT(cacheStats.hits, 0u);
+
+    unmountCard();
+    blockDeviceMmapClose();
+}
+
+TEST(StorageBenchmarkUnittest, TestCardStreamingRate)
+{
+    generateBlackboxLog(LOG_SIZE);
+    openCard(NULL, &cardTiming, true);
+
+    afatfsFilePtr_t file = openFile("LOG00001.BFL", "as");
+    ASSERT_TRUE(file != NULL);
+    const replayResult_t result = streamToCard(file);
+    closeFile(file);
+
+    expectCardFileContent("LOG00001.BFL");
+
+    // Pre-erased multi-block writes take 450us a block, more than twice the blackbox's rate above
+    EXPECT_GT(megabytesPerSecond(result.bytesWritten, result.elapsedUs), 0.9);
+
+    unmountCard();
+    blockDeviceMmapClose();
+}
+
+TEST(StorageBenchmarkUnittest, TestCardRetriesFailedOperations)
+{
+    generateBlackboxLog(256 * 1024);
+
+    blockDeviceTiming_t failingTiming = cardTiming;
+    failingTiming.failEvery = 37;
+    openCard(NULL, &failingTiming, true);
+
+    afatfsFilePtr_t file = openFile("LOG00001.BFL", "as");
+    ASSERT_TRUE(file != NULL);
+    streamToCard(file);
+    closeFile(file);
+
+    expectCardFileContent("LOG00001.BFL");
+    EXPECT_GT(blockDeviceMmapGetStats()->failures, 0u);
+
+    unmountCard();
+    blockDeviceMmapClose();
+}
+
+TEST(StorageBenchmarkUnittest, TestCardImageFilePersists)
+{
+    char filename[] = "/tmp/storage_benchmark_XXXXXX";
+    const int fd = mkstemp(filename);
+    ASSERT_GE(fd, 0);
+    close(fd);
+
+    generateBlackboxLog(128 * 1024);
+    openCard(filename, &cardTiming, true);
+
+    afatfsFilePtr_t file = openFile("LOG00001.BFL", "as");
+    ASSERT_TRUE(file != NULL);
+    streamToCard(file);
+    closeFile(file);
+
+    unmountCard();
+    blockDeviceMmapClose();
+
+    // Mount the image again from the file
+    openCard(filename, &cardTiming, false);
+    expectCardFileContent("LOG00001.BFL");
+
+    unmountCard();
+    blockDeviceMmapClose();
+    unlink(filename);
+}
+
+// FLASH
+
+static void flashWrite(const uint8_t *data, uint32_t length)
+{
+    flashfsWrite(data, length, false);
+}
+
+static void flashPoll(void)
+{
+    flashfsUpdate(simTimeUs);
+}
+
+static const replayTarget_t flashTarget = {
+    .freeSpace = flashfsGetWriteBufferFreeSpace,
+    .write = flashWrite,
+    .flush = flashfsFlushAsync,
+    .poll = flashPoll,
+};
+
+TEST(StorageBenchmarkUnittest, TestFlashKeepsUpWithBlackbox)
+{
+    generateBlackboxLog(LOG_SIZE);
+
+    simTimeUs = 0;
+    ASSERT_TRUE(blockDeviceMmapOpen(NULL, FLASH_SIZE, FLASH_SECTOR_SIZE));
+    memset(blockDeviceMmapGetImage(), 0xFF, FLASH_SIZE);
+    blockDeviceMmapSetTiming(&flashTiming);
+    flashfsInit(&blockDeviceMmapFlashVTable);
+
+    ASSERT_TRUE(flashfsLogBegin());
+    const replayResult_t result = replayLog(&flashTarget);
+    flashfsFlushSync();
+    flashfsLogEnd(result.elapsedUs / 1000);
+
+    EXPECT_EQ(0u, result.framesDropped);
+    EXPECT_EQ(0u, blockDeviceMmapGetStats()->programErrors);
+
+    ASSERT_EQ(1, flashfsGetLogCount());
+    EXPECT_EQ((int)logLength, flashfsReadLog(0, 0, readBuffer, logLength));
+    EXPECT_EQ(0, memcmp(logData, readBuffer, logLength));
+
+    blockDeviceMmapClose();
+}
+
+// STUBS
+
+extern "C" {
+
+uint32_t micros(void)
+{
+    return simTimeUs;
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    simTimeUs += us;
+}
+
+}
@@ -297,6 +297,7 @@ uint32_t serialTxBytesFree(const serialPort_t *) {return 0;}
 uint8_t serialRead(serialPort_t *) {return 0;}
 void serialWrite(serialPort_t *, uint8_t) {}
 void serialWriteBuf(serialPort_t *, const uint8_t *, int) {}
+bool serialSetRxFrameCallback(serialPort_t *, serialReceiveFrameCallbackPtr) {return false;}
 void serialSetMode(serialPort_t *, portMode_t ) {}
 serialPort_t *openSerialPort(serialPortIdentifier_e, serialPortFunction_e, serialReceiveCallbackPtr, uint32_t, portMode_t, portOptions_t) {return NULL;}
 void closeSerialPort(serialPort_t *) {}
@@ -304,6 +305,7 @@ void closeSerialPort(serialPort_t *) {}
 serialPortConfig_t *findSerialPortConfig(serialPortFunction_e) {return NULL;}
 
 bool telemetryDetermineEnabledState(portSharing_e) {return true;}
+void rxSetLinkRssi(uint16_t) {}
 bool telemetryCheckRxPortShared(const serialPortConfig_t *) {return true;}
 
 portSharing_e determinePortSharing(const serialPortConfig_t *, serialPortFunction_e) {return PORTSHARING_NOT_SHARED;}